@@ -40,6 +40,8 @@
 
 
 #include "3dface.h"
+#include "bbox.h"
+#include "util.h"
 
 
 /*!
@@ -65,7 +67,7 @@ dxf_3dface_new
         size = sizeof (Dxf3dface);
         /* avoid malloc of 0 bytes */
         if (size == 0) size = 1;
-        face = malloc (size);
+        face = dxf_malloc (size);
         if (face == NULL)
         {
                 fprintf (stderr,
@@ -117,9 +119,9 @@ dxf_3dface_init
                 }
         }
         /* Assign initial values to members. */
-        face->id_code = 0;
-        face->linetype = strdup (DXF_DEFAULT_LINETYPE);
-        face->layer = strdup (DXF_DEFAULT_LAYER);
+        face->id_code = DXF_HANDLE_NONE;
+        face->linetype = dxf_strdup (DXF_DEFAULT_LINETYPE);
+        face->layer = dxf_strdup (DXF_DEFAULT_LAYER);
         face->elevation = 0.0;
         face->thickness = 0.0;
         face->linetype_scale = DXF_DEFAULT_LINETYPE_SCALE;
@@ -128,14 +130,14 @@ dxf_3dface_init
         face->paperspace = DXF_MODELSPACE;
         face->graphics_data_size = 0;
         face->shadow_mode = 0;
-        face->dictionary_owner_soft = strdup ("");
-        face->object_owner_soft = strdup ("");
-        face->material = strdup ("");
-        face->dictionary_owner_hard = strdup ("");
+        face->dictionary_owner_soft = 0;
+        face->object_owner_soft = 0;
+        face->material = 0;
+        face->dictionary_owner_hard = 0;
         face->lineweight = 0;
-        face->plot_style_name = strdup ("");
+        face->plot_style_name = 0;
         face->color_value = 0;
-        face->color_name = strdup ("");
+        face->color_name = dxf_strdup ("");
         face->transparency = 0;
         face->flag = 0;
 #ifdef DEBUG
@@ -168,7 +170,8 @@ dxf_3dface_read
 #ifdef DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        char *temp_string = NULL;
+        char temp_string[DXF_MAX_STRING_LENGTH];
+        int group_code;
         DxfBinaryData *iter310 = NULL;
         int iter330;
 
@@ -276,307 +279,230 @@ dxf_3dface_read
         }
         iter310 = (DxfBinaryData *) face->binary_graphics_data;
         iter330 = 0;
-        (fp->line_number)++;
-        fscanf (fp->fp, "%[^\n]", temp_string);
-        while (strcmp (temp_string, "0") != 0)
+        while ((dxf_read_group_code (fp, &group_code) == EXIT_SUCCESS)
+          && (group_code != 0))
         {
-                if (ferror (fp->fp))
+                if (dxf_read_error (fp))
                 {
                         fprintf (stderr,
                           (_("Error in %s () while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
                         return (EXIT_FAILURE);
                 }
-                if (strcmp (temp_string, "5") == 0)
-                {
-                        /* Now follows a string containing a sequential
-                         * id number. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%x\n", (uint *) &face->id_code);
-                }
-                else if (strcmp (temp_string, "6") == 0)
-                {
-                        /* Now follows a string containing a linetype
-                         * name. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, face->linetype);
-                }
-                else if (strcmp (temp_string, "8") == 0)
-                {
-                        /* Now follows a string containing a layer name. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, face->layer);
-                }
-                else if (strcmp (temp_string, "10") == 0)
-                {
-                        /* Now follows a string containing the
-                         * X-coordinate of the first point. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &face->p0->x0);
-                }
-                else if (strcmp (temp_string, "20") == 0)
-                {
-                        /* Now follows a string containing the
-                         * Y-coordinate of the first point. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &face->p0->y0);
-                }
-                else if (strcmp (temp_string, "30") == 0)
-                {
-                        /* Now follows a string containing the
-                         * Z-coordinate of first the point. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &face->p0->z0);
-                }
-                else if (strcmp (temp_string, "11") == 0)
-                {
-                        /* Now follows a string containing the
-                         * X-coordinate of the second point. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &face->p1->x0);
-                }
-                else if (strcmp (temp_string, "21") == 0)
-                {
-                        /* Now follows a string containing the
-                         * Y-coordinate of the second point. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &face->p1->y0);
-                }
-                else if (strcmp (temp_string, "31") == 0)
-                {
-                        /* Now follows a string containing the
-                         * Z-coordinate of the second point. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &face->p1->z0);
-                }
-                else if (strcmp (temp_string, "12") == 0)
-                {
-                        /* Now follows a string containing the
-                         * X-coordinate of the third point. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &face->p2->x0);
-                }
-                else if (strcmp (temp_string, "22") == 0)
-                {
-                        /* Now follows a string containing the
-                         * Y-coordinate of the third point. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &face->p2->y0);
-                }
-                else if (strcmp (temp_string, "32") == 0)
-                {
-                        /* Now follows a string containing the
-                         * Z-coordinate of the third point. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &face->p2->z0);
-                }
-                else if (strcmp (temp_string, "13") == 0)
-                {
-                        /* Now follows a string containing the
-                         * X-coordinate of the fourth point. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &face->p3->x0);
-                }
-                else if (strcmp (temp_string, "23") == 0)
-                {
-                        /* Now follows a string containing the
-                         * Y-coordinate of the fourth point. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &face->p3->y0);
-                }
-                else if (strcmp (temp_string, "33") == 0)
-                {
-                        /* Now follows a string containing the
-                         * Z-coordinate of the fourth point. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &face->p3->z0);
-                }
-                else if ((strcmp (temp_string, "38") == 0))
-                {
-                        /* Now follows a string containing the
-                         * elevation. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &face->elevation);
-                }
-                else if (strcmp (temp_string, "39") == 0)
-                {
-                        /* Now follows a string containing the
-                         * thickness. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &face->thickness);
-                }
-                else if (strcmp (temp_string, "48") == 0)
-                {
-                        /* Now follows a string containing the linetype
-                         * scale. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &face->linetype_scale);
-                }
-                else if (strcmp (temp_string, "60") == 0)
-                {
-                        /* Now follows a string containing the
-                         * visibility value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%hd\n", &face->visibility);
-                }
-                else if (strcmp (temp_string, "62") == 0)
-                {
-                        /* Now follows a string containing the
-                         * color value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%hd\n", &face->color);
-                }
-                else if (strcmp (temp_string, "67") == 0)
-                {
-                        /* Now follows a string containing the
-                         * paperspace value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%hd\n", &face->paperspace);
-                }
-                else if (strcmp (temp_string, "70") == 0)
-                {
-                        /* Now follows a string containing the
-                         * value of edge visibility flag. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%hd\n", &face->flag);
-                }
-                else if (strcmp (temp_string, "92") == 0)
-                {
-                        /* Now follows a string containing the
-                         * graphics data size value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%" PRIi32 "\n", &face->graphics_data_size);
-                }
-                else if (strcmp (temp_string, "100") == 0)
-                {
-                        /* Now follows a string containing the
-                         * subclass marker value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
-                        if ((strcmp (temp_string, "AcDbEntity") != 0)
-                        && (strcmp (temp_string, "AcDbFace") != 0))
-                        {
+                switch (group_code)
+                {
+                        case 5:
+                                /* Now follows a string containing a sequential
+                                 * id number. */
+                                dxf_read_handle (fp, &face->id_code);
+                                break;
+                        case 6:
+                                /* Now follows a string containing a linetype
+                                 * name. */
+                                dxf_read_string_interned (fp, &face->linetype);
+                                break;
+                        case 8:
+                                /* Now follows a string containing a layer name. */
+                                dxf_read_string_interned (fp, &face->layer);
+                                break;
+                        case 10:
+                                /* Now follows a string containing the
+                                 * X-coordinate of the first point. */
+                                dxf_read_double (fp, &face->p0->x0);
+                                break;
+                        case 20:
+                                /* Now follows a string containing the
+                                 * Y-coordinate of the first point. */
+                                dxf_read_double (fp, &face->p0->y0);
+                                break;
+                        case 30:
+                                /* Now follows a string containing the
+                                 * Z-coordinate of first the point. */
+                                dxf_read_double (fp, &face->p0->z0);
+                                break;
+                        case 11:
+                                /* Now follows a string containing the
+                                 * X-coordinate of the second point. */
+                                dxf_read_double (fp, &face->p1->x0);
+                                break;
+                        case 21:
+                                /* Now follows a string containing the
+                                 * Y-coordinate of the second point. */
+                                dxf_read_double (fp, &face->p1->y0);
+                                break;
+                        case 31:
+                                /* Now follows a string containing the
+                                 * Z-coordinate of the second point. */
+                                dxf_read_double (fp, &face->p1->z0);
+                                break;
+                        case 12:
+                                /* Now follows a string containing the
+                                 * X-coordinate of the third point. */
+                                dxf_read_double (fp, &face->p2->x0);
+                                break;
+                        case 22:
+                                /* Now follows a string containing the
+                                 * Y-coordinate of the third point. */
+                                dxf_read_double (fp, &face->p2->y0);
+                                break;
+                        case 32:
+                                /* Now follows a string containing the
+                                 * Z-coordinate of the third point. */
+                                dxf_read_double (fp, &face->p2->z0);
+                                break;
+                        case 13:
+                                /* Now follows a string containing the
+                                 * X-coordinate of the fourth point. */
+                                dxf_read_double (fp, &face->p3->x0);
+                                break;
+                        case 23:
+                                /* Now follows a string containing the
+                                 * Y-coordinate of the fourth point. */
+                                dxf_read_double (fp, &face->p3->y0);
+                                break;
+                        case 33:
+                                /* Now follows a string containing the
+                                 * Z-coordinate of the fourth point. */
+                                dxf_read_double (fp, &face->p3->z0);
+                                break;
+                        case 38:
+                                /* Now follows a string containing the
+                                 * elevation. */
+                                dxf_read_double (fp, &face->elevation);
+                                break;
+                        case 39:
+                                /* Now follows a string containing the
+                                 * thickness. */
+                                dxf_read_double (fp, &face->thickness);
+                                break;
+                        case 48:
+                                /* Now follows a string containing the linetype
+                                 * scale. */
+                                dxf_read_double (fp, &face->linetype_scale);
+                                break;
+                        case 60:
+                                /* Now follows a string containing the
+                                 * visibility value. */
+                                dxf_read_int16 (fp, &face->visibility);
+                                break;
+                        case 62:
+                                /* Now follows a string containing the
+                                 * color value. */
+                                dxf_read_int16 (fp, &face->color);
+                                break;
+                        case 67:
+                                /* Now follows a string containing the
+                                 * paperspace value. */
+                                dxf_read_int16 (fp, &face->paperspace);
+                                break;
+                        case 70:
+                                /* Now follows a string containing the
+                                 * value of edge visibility flag. */
+                                dxf_read_int16 (fp, &face->flag);
+                                break;
+                        case 92:
+                                /* Now follows a string containing the
+                                 * graphics data size value. */
+                                dxf_read_int32 (fp, &face->graphics_data_size);
+                                break;
+                        case 100:
+                                /* Now follows a string containing the
+                                 * subclass marker value. */
+                                dxf_read_line (temp_string, fp);
+                                if ((strcmp (temp_string, "AcDbEntity") != 0)
+                                && (strcmp (temp_string, "AcDbFace") != 0))
+                                {
+                                        fprintf (stderr,
+                                          (_("Warning in %s () found a bad subclass marker in: %s in line: %d.\n")),
+                                          __FUNCTION__, fp->filename, fp->line_number);
+                                }
+                                break;
+                        case 160:
+                                /* Now follows a string containing the
+                                 * graphics data size value. */
+                                dxf_read_int32 (fp, &face->graphics_data_size);
+                                break;
+                        case 284:
+                                /* Now follows a string containing the shadow
+                                 * mode value. */
+                                dxf_read_int16 (fp, &face->shadow_mode);
+                                break;
+                        case 310:
+                                /* Now follows a string containing binary
+                                 * graphics data. */
+                                iter310 = dxf_binary_data_read (fp, iter310);
+                                break;
+                        case 330:
+                                if (iter330 == 0)
+                                {
+                                        /* Now follows a string containing a soft-pointer
+                                         * ID/handle to owner dictionary. */
+                                        dxf_read_handle (fp, &face->dictionary_owner_soft);
+                                }
+                                if (iter330 == 1)
+                                {
+                                        /* Now follows a string containing a soft-pointer
+                                         * ID/handle to owner object. */
+                                        dxf_read_handle (fp, &face->object_owner_soft);
+                                }
+                                iter330++;
+                                break;
+                        case 347:
+                                /* Now follows a string containing a
+                                 * hard-pointer ID/handle to material object. */
+                                dxf_read_handle (fp, &face->material);
+                                break;
+                        case 360:
+                                /* Now follows a string containing Hard owner
+                                 * ID/handle to owner dictionary. */
+                                dxf_read_handle (fp, &face->dictionary_owner_hard);
+                                break;
+                        case 370:
+                                /* Now follows a string containing the lineweight
+                                 * value. */
+                                dxf_read_int16 (fp, &face->lineweight);
+                                break;
+                        case 390:
+                                /* Now follows a string containing a plot style
+                                 * name value. */
+                                dxf_read_handle (fp, &face->plot_style_name);
+                                break;
+                        case 420:
+                                /* Now follows a string containing a color value. */
+                                dxf_read_int32 (fp, &face->color_value);
+                                break;
+                        case 430:
+                                /* Now follows a string containing a color
+                                 * name value. */
+                                dxf_read_string_interned (fp, &face->color_name);
+                                break;
+                        case 440:
+                                /* Now follows a string containing a transparency
+                                 * value. */
+                                dxf_read_int32 (fp, &face->transparency);
+                                break;
+                        case 999:
+                                /* Now follows a string containing a comment. */
+                                dxf_read_line (temp_string, fp);
+                                fprintf (stdout, (_("DXF comment: %s\n")), temp_string);
+                                break;
+                        default:
                                 fprintf (stderr,
-                                  (_("Warning in %s () found a bad subclass marker in: %s in line: %d.\n")),
+                                  (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
                                   __FUNCTION__, fp->filename, fp->line_number);
-                        }
-                }
-                else if (strcmp (temp_string, "160") == 0)
-                {
-                        /* Now follows a string containing the
-                         * graphics data size value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%" PRIi32 "\n", &face->graphics_data_size);
-                }
-                else if (strcmp (temp_string, "284") == 0)
-                {
-                        /* Now follows a string containing the shadow
-                         * mode value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%hd\n", &face->shadow_mode);
-                }
-                else if (strcmp (temp_string, "310") == 0)
-                {
-                        /* Now follows a string containing binary
-                         * graphics data. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, iter310->data_line);
-                        dxf_binary_data_init ((DxfBinaryData *) iter310->next);
-                        iter310 = (DxfBinaryData *) iter310->next;
-                }
-                else if (strcmp (temp_string, "330") == 0)
-                {
-                        if (iter330 == 0)
-                        {
-                                /* Now follows a string containing a soft-pointer
-                                 * ID/handle to owner dictionary. */
-                                (fp->line_number)++;
-                                fscanf (fp->fp, DXF_MAX_STRING_FORMAT, face->dictionary_owner_soft);
-                        }
-                        if (iter330 == 1)
-                        {
-                                /* Now follows a string containing a soft-pointer
-                                 * ID/handle to owner object. */
-                                (fp->line_number)++;
-                                fscanf (fp->fp, DXF_MAX_STRING_FORMAT, face->object_owner_soft);
-                        }
-                        iter330++;
-                }
-                else if (strcmp (temp_string, "347") == 0)
-                {
-                        /* Now follows a string containing a
-                         * hard-pointer ID/handle to material object. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, face->material);
-                }
-                else if (strcmp (temp_string, "360") == 0)
-                {
-                        /* Now follows a string containing Hard owner
-                         * ID/handle to owner dictionary. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, face->dictionary_owner_hard);
-                }
-                else if (strcmp (temp_string, "370") == 0)
-                {
-                        /* Now follows a string containing the lineweight
-                         * value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%hd\n", &face->lineweight);
-                }
-                else if (strcmp (temp_string, "390") == 0)
-                {
-                        /* Now follows a string containing a plot style
-                         * name value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, face->plot_style_name);
-                }
-                else if (strcmp (temp_string, "420") == 0)
-                {
-                        /* Now follows a string containing a color value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%" PRIi32 "\n", &face->color_value);
-                }
-                else if (strcmp (temp_string, "430") == 0)
-                {
-                        /* Now follows a string containing a color
-                         * name value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", face->color_name);
-                }
-                else if (strcmp (temp_string, "440") == 0)
-                {
-                        /* Now follows a string containing a transparency
-                         * value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%" PRIi32 "\n", &face->transparency);
-                }
-                else if (strcmp (temp_string, "999") == 0)
-                {
-                        /* Now follows a string containing a comment. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
-                        fprintf (stdout, (_("DXF comment: %s\n")), temp_string);
-                }
-                else
-                {
-                        fprintf (stderr,
-                          (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
-                          __FUNCTION__, fp->filename, fp->line_number);
+                                /* Skip the value of the unknown group code. */
+                                dxf_read_line (temp_string, fp);
+                                break;
                 }
         }
         /* Handle omitted members and/or illegal values. */
         if (strcmp (face->linetype, "") == 0)
         {
-                face->linetype = strdup (DXF_DEFAULT_LINETYPE);
+                face->linetype = dxf_strdup (DXF_DEFAULT_LINETYPE);
         }
         if (strcmp (face->layer, "") == 0)
         {
-                face->layer = strdup (DXF_DEFAULT_LAYER);
-        }
-        /* Clean up any leftovers. */
-        if (temp_string)
-        {
-                free (temp_string);
+                face->layer = dxf_strdup (DXF_DEFAULT_LAYER);
         }
 #if DEBUG
         DXF_DEBUG_END
@@ -603,7 +529,7 @@ dxf_3dface_write
 #ifdef DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        char *dxf_entity_name = strdup ("3DFACE");
+        char *dxf_entity_name = dxf_strdup ("3DFACE");
 
         /* Do some basic checks. */
         if (fp == NULL)
@@ -612,7 +538,7 @@ dxf_3dface_write
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (face == NULL)
@@ -621,34 +547,34 @@ dxf_3dface_write
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if ((strcmp (face->layer, "") == 0) || (face->layer == NULL))
         {
                 fprintf (stderr,
-                  (_("Warning in %s () invalid layer string for the %s entity with id-code: %x\n")),
+                  (_("Warning in %s () invalid layer string for the %s entity with id-code: %" PRIx64 "\n")),
                   __FUNCTION__, dxf_entity_name, face->id_code);
                 fprintf (stderr,
                   (_("\t%s entity is relocated to layer 0")),
                   dxf_entity_name);
-                face->layer = strdup (DXF_DEFAULT_LAYER);
+                face->layer = dxf_strdup (DXF_DEFAULT_LAYER);
         }
         if (face->linetype == NULL)
         {
                 fprintf (stderr,
-                  (_("Warning in %s () invalid linetype string for the %s entity with id-code: %x\n")),
+                  (_("Warning in %s () invalid linetype string for the %s entity with id-code: %" PRIx64 "\n")),
                   __FUNCTION__, dxf_entity_name, face->id_code);
                 fprintf (stderr,
                   (_("\t%s linetype is set to %s\n")),
                   dxf_entity_name, DXF_DEFAULT_LINETYPE);
-                face->linetype = strdup (DXF_DEFAULT_LINETYPE);
+                face->linetype = dxf_strdup (DXF_DEFAULT_LINETYPE);
         }
         /* Start writing output. */
-        fprintf (fp->fp, "  0\n%s\n", dxf_entity_name);
-        if (face->id_code != -1)
+        dxf_write_string (fp, 0, dxf_entity_name);
+        if (face->id_code != DXF_HANDLE_NONE)
         {
-                fprintf (fp->fp, "  5\n%x\n", face->id_code);
+                dxf_write_hex (fp, 5, face->id_code);
         }
         /*!
          * \todo for version R14.\n
@@ -660,77 +586,77 @@ dxf_3dface_write
          * 102 groups are application defined (optional).\n\n
          * End of group, "}" (optional), with Group code 102.
          */
-        if ((strcmp (face->dictionary_owner_soft, "") != 0)
+        if ((face->dictionary_owner_soft != 0)
           && (fp->acad_version_number >= AutoCAD_14))
         {
-                fprintf (fp->fp, "102\n{ACAD_REACTORS\n");
-                fprintf (fp->fp, "330\n%s\n", face->dictionary_owner_soft);
-                fprintf (fp->fp, "102\n}\n");
+                dxf_write_string (fp, 102, "{ACAD_REACTORS");
+                dxf_write_hex (fp, 330, face->dictionary_owner_soft);
+                dxf_write_string (fp, 102, "}");
         }
-        if ((strcmp (face->dictionary_owner_hard, "") != 0)
+        if ((face->dictionary_owner_hard != 0)
           && (fp->acad_version_number >= AutoCAD_14))
         {
-                fprintf (fp->fp, "102\n{ACAD_XDICTIONARY\n");
-                fprintf (fp->fp, "360\n%s\n", face->dictionary_owner_hard);
-                fprintf (fp->fp, "102\n}\n");
+                dxf_write_string (fp, 102, "{ACAD_XDICTIONARY");
+                dxf_write_hex (fp, 360, face->dictionary_owner_hard);
+                dxf_write_string (fp, 102, "}");
         }
-        if ((strcmp (face->object_owner_soft, "") != 0)
+        if ((face->object_owner_soft != 0)
           && (fp->acad_version_number >= AutoCAD_2000))
         {
-                fprintf (fp->fp, "330\n%s\n", face->object_owner_soft);
+                dxf_write_hex (fp, 330, face->object_owner_soft);
         }
         if (fp->acad_version_number >= AutoCAD_13)
         {
-                fprintf (fp->fp, "100\nAcDbEntity\n");
+                dxf_write_string (fp, 100, "AcDbEntity");
         }
         if (face->paperspace == DXF_PAPERSPACE)
         {
-                fprintf (fp->fp, " 67\n%hd\n", (int16_t) DXF_PAPERSPACE);
+                dxf_write_int (fp, 67, (int16_t) DXF_PAPERSPACE);
         }
-        fprintf (fp->fp, "  8\n%s\n", face->layer);
+        dxf_write_string (fp, 8, face->layer);
         if (strcmp (face->linetype, DXF_DEFAULT_LINETYPE) != 0)
         {
-                fprintf (fp->fp, "  6\n%s\n", face->linetype);
+                dxf_write_string (fp, 6, face->linetype);
         }
         if ((fp->acad_version_number >= AutoCAD_2008)
-          && (strcmp (face->material, "") != 0))
+          && (face->material != 0))
         {
-                fprintf (fp->fp, "347\n%s\n", face->material);
+                dxf_write_hex (fp, 347, face->material);
         }
         if (face->color != DXF_COLOR_BYLAYER)
         {
-                fprintf (fp->fp, " 62\n%hd\n", face->color);
+                dxf_write_int (fp, 62, face->color);
         }
         if (fp->acad_version_number >= AutoCAD_2002)
         {
-                fprintf (fp->fp, "370\n%d\n", face->lineweight);
+                dxf_write_int (fp, 370, face->lineweight);
         }
         if ((fp->acad_version_number <= AutoCAD_11)
           && DXF_FLATLAND
           && (face->elevation != 0.0))
         {
-                fprintf (fp->fp, " 38\n%f\n", face->elevation);
+                dxf_write_double (fp, 38, face->elevation);
         }
         if ((fp->acad_version_number <= AutoCAD_13)
           && (face->thickness != 0.0))
         {
-                fprintf (fp->fp, " 39\n%f\n", face->thickness);
+                dxf_write_double (fp, 39, face->thickness);
         }
         if (face->linetype_scale != 1.0)
         {
-                fprintf (fp->fp, " 48\n%f\n", face->linetype_scale);
+                dxf_write_double (fp, 48, face->linetype_scale);
         }
         if (face->visibility != 0)
         {
-                fprintf (fp->fp, " 60\n%d\n", face->visibility);
+                dxf_write_int (fp, 60, face->visibility);
         }
         if ((fp->acad_version_number >= AutoCAD_2000)
           && (face->binary_graphics_data != NULL))
         {
 #ifdef BUILD_64
-                fprintf (fp->fp, "160\n%" PRIi32 "\n", face->graphics_data_size);
+                dxf_write_int (fp, 160, face->graphics_data_size);
 #else
-                fprintf (fp->fp, " 92\n%" PRIi32 "\n", face->graphics_data_size);
+                dxf_write_int (fp, 92, face->graphics_data_size);
 #endif
                 if (face->binary_graphics_data)
                 {
@@ -738,53 +664,53 @@ dxf_3dface_write
                         iter = (DxfBinaryData *) face->binary_graphics_data;
                         while (iter != NULL)
                         {
-                                fprintf (fp->fp, "310\n%s\n", iter->data_line);
+                                dxf_binary_data_write (fp, iter);
                                 iter = (DxfBinaryData *) iter->next;
                         }
                 }
         }
         if (fp->acad_version_number >= AutoCAD_2004)
         {
-                fprintf (fp->fp, "420\n%" PRIi32 "\n", face->color_value);
-                fprintf (fp->fp, "430\n%s\n", face->color_name);
-                fprintf (fp->fp, "440\n%" PRIi32 "\n", face->transparency);
+                dxf_write_int (fp, 420, face->color_value);
+                dxf_write_string (fp, 430, face->color_name);
+                dxf_write_int (fp, 440, face->transparency);
         }
         if (fp->acad_version_number >= AutoCAD_2009)
         {
-                fprintf (fp->fp, "390\n%s\n", face->plot_style_name);
-                fprintf (fp->fp, "284\n%d\n", face->shadow_mode);
+                dxf_write_hex (fp, 390, face->plot_style_name);
+                dxf_write_int (fp, 284, face->shadow_mode);
         }
         if (fp->acad_version_number >= AutoCAD_13)
         {
-                fprintf (fp->fp, "100\nAcDbFace\n");
+                dxf_write_string (fp, 100, "AcDbFace");
         }
         if (face->p0 != NULL)
         {
-                fprintf (fp->fp, " 10\n%f\n", face->p0->x0);
-                fprintf (fp->fp, " 20\n%f\n", face->p0->y0);
-                fprintf (fp->fp, " 30\n%f\n", face->p0->z0);
+                dxf_write_double (fp, 10, face->p0->x0);
+                dxf_write_double (fp, 20, face->p0->y0);
+                dxf_write_double (fp, 30, face->p0->z0);
         }
         if (face->p1 != NULL)
         {
-                fprintf (fp->fp, " 11\n%f\n", face->p1->x0);
-                fprintf (fp->fp, " 21\n%f\n", face->p1->y0);
-                fprintf (fp->fp, " 31\n%f\n", face->p1->z0);
+                dxf_write_double (fp, 11, face->p1->x0);
+                dxf_write_double (fp, 21, face->p1->y0);
+                dxf_write_double (fp, 31, face->p1->z0);
         }
         if (face->p2 != NULL)
         {
-                fprintf (fp->fp, " 12\n%f\n", face->p2->x0);
-                fprintf (fp->fp, " 22\n%f\n", face->p2->y0);
-                fprintf (fp->fp, " 32\n%f\n", face->p2->z0);
+                dxf_write_double (fp, 12, face->p2->x0);
+                dxf_write_double (fp, 22, face->p2->y0);
+                dxf_write_double (fp, 32, face->p2->z0);
         }
         if (face->p3)
         {
-                fprintf (fp->fp, " 13\n%f\n", face->p3->x0);
-                fprintf (fp->fp, " 23\n%f\n", face->p3->y0);
-                fprintf (fp->fp, " 33\n%f\n", face->p3->z0);
+                dxf_write_double (fp, 13, face->p3->x0);
+                dxf_write_double (fp, 23, face->p3->y0);
+                dxf_write_double (fp, 33, face->p3->z0);
         }
-        fprintf (fp->fp, " 70\n%hd\n", face->flag);
+        dxf_write_int (fp, 70, face->flag);
         /* Clean up. */
-        free (dxf_entity_name);
+        dxf_free (dxf_entity_name);
 #ifdef DEBUG
         DXF_DEBUG_END
 #endif
@@ -824,20 +750,15 @@ dxf_3dface_free
                 __FUNCTION__);
               return (EXIT_FAILURE);
         }
-        free (face->linetype);
-        free (face->layer);
+        dxf_string_free (face->linetype);
+        dxf_string_free (face->layer);
         dxf_binary_data_free_list (face->binary_graphics_data);
-        free (face->dictionary_owner_soft);
-        free (face->object_owner_soft);
-        free (face->material);
-        free (face->dictionary_owner_hard);
-        free (face->plot_style_name);
-        free (face->color_name);
+        dxf_string_free (face->color_name);
         dxf_point_free_list (face->p0);
         dxf_point_free_list (face->p1);
         dxf_point_free_list (face->p2);
         dxf_point_free_list (face->p3);
-        free (face);
+        dxf_free (face);
         face = NULL;
 #ifdef DEBUG
         DXF_DEBUG_END
@@ -897,7 +818,7 @@ dxf_3dface_get_id_code
 (
         Dxf3dface *face,
                 /*!< [in] a pointer to a DXF \c 3DFACE entity. */
-        int *id_code
+        uint64_t *id_code
                 /*!< [out] a pointer to \c id_code. */
 )
 {
@@ -919,12 +840,6 @@ dxf_3dface_get_id_code
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (face->id_code < 0)
-        {
-                fprintf (stderr,
-                  (_("Warning in %s () a negative value was found.\n")),
-                  __FUNCTION__);
-        }
         id_code = &face->id_code;
 #if DEBUG
         DXF_DEBUG_END
@@ -944,7 +859,7 @@ dxf_3dface_set_id_code
 (
         Dxf3dface *face,
                 /*!< [in,out] a pointer to a DXF \c 3DFACE entity. */
-        int id_code
+        uint64_t id_code
                 /*!< [in] Identification number for the entity.\n
                  * This is to be an unique (sequential) number in the DXF
                  * file. */
@@ -961,12 +876,6 @@ dxf_3dface_set_id_code
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (id_code < 0)
-        {
-                fprintf (stderr,
-                  (_("Warning in %s () a negative value was passed.\n")),
-                  __FUNCTION__);
-        }
         face->id_code = id_code;
 #if DEBUG
         DXF_DEBUG_END
@@ -1017,7 +926,7 @@ dxf_3dface_get_linetype
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        linetype = strdup (face->linetype);
+        linetype = dxf_strdup (face->linetype);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1061,7 +970,7 @@ dxf_3dface_set_linetype
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        face->linetype = strdup (linetype);
+        face->linetype = dxf_strdup (linetype);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1111,7 +1020,7 @@ dxf_3dface_get_layer
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        layer = strdup (face->layer);
+        layer = dxf_strdup (face->layer);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1155,7 +1064,7 @@ dxf_3dface_set_layer
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        face->layer = strdup (layer);
+        face->layer = dxf_strdup (layer);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2021,15 +1930,13 @@ dxf_3dface_set_binary_graphics_data
  *
  * \return \c EXIT_SUCCESS when successful, \c EXIT_FAILURE when an
  * error occurred.
- *
- * \warning No checks are performed on the returned pointer.
  */
 int
 dxf_3dface_get_dictionary_owner_soft
 (
         Dxf3dface *face,
                 /*!< [in] a pointer to a DXF \c 3DFACE entity. */
-        char *dictionary_owner_soft
+        uint64_t *dictionary_owner_soft
                 /*!< [out] a pointer to a \c dictionary_owner_soft. */
 )
 {
@@ -2044,21 +1951,7 @@ dxf_3dface_get_dictionary_owner_soft
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (face->dictionary_owner_soft ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (EXIT_FAILURE);
-        }
-        if (dictionary_owner_soft == NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was passed.\n")),
-                  __FUNCTION__);
-                return (EXIT_FAILURE);
-        }
-        dictionary_owner_soft = strdup (face->dictionary_owner_soft);
+        *dictionary_owner_soft = face->dictionary_owner_soft;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2078,7 +1971,7 @@ dxf_3dface_set_dictionary_owner_soft
 (
         Dxf3dface *face,
                 /*!< [in,out] a pointer to a DXF \c 3DFACE entity. */
-        char *dictionary_owner_soft
+        uint64_t dictionary_owner_soft
                 /*!< [in] a pointer to a string containing the pointer
                  * to the \c dictionary_owner_soft for the entity. */
 )
@@ -2094,14 +1987,7 @@ dxf_3dface_set_dictionary_owner_soft
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (dictionary_owner_soft == NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was passed.\n")),
-                  __FUNCTION__);
-                return (EXIT_FAILURE);
-        }
-        face->dictionary_owner_soft = strdup (dictionary_owner_soft);
+        face->dictionary_owner_soft = dictionary_owner_soft;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2115,15 +2001,13 @@ dxf_3dface_set_dictionary_owner_soft
  *
  * \return \c EXIT_SUCCESS when sucessful, \c EXIT_FAILURE when an error
  * occurred.
- *
- * \warning No checks are performed on the returned pointer.
  */
 int
 dxf_3dface_get_object_owner_soft
 (
         Dxf3dface *face,
                 /*!< [in] a pointer to a DXF \c 3DFACE entity. */
-        char *object_owner_soft
+        uint64_t *object_owner_soft
                 /*!< [out] a pointer to \c object_owner_soft. */
 )
 {
@@ -2138,21 +2022,7 @@ dxf_3dface_get_object_owner_soft
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (face->object_owner_soft ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (EXIT_FAILURE);
-        }
-        if (object_owner_soft == NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was passed.\n")),
-                  __FUNCTION__);
-                return (EXIT_FAILURE);
-        }
-        object_owner_soft = strdup (face->object_owner_soft);
+        *object_owner_soft = face->object_owner_soft;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2172,7 +2042,7 @@ dxf_3dface_set_object_owner_soft
 (
         Dxf3dface *face,
                 /*!< [in,out] a pointer to a DXF \c 3DFACE entity. */
-        char *object_owner_soft
+        uint64_t object_owner_soft
                 /*!< [in] a pointer to a string containing the pointer
                  * to the \c object_owner_soft for the entity. */
 )
@@ -2188,14 +2058,7 @@ dxf_3dface_set_object_owner_soft
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (object_owner_soft == NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was passed.\n")),
-                  __FUNCTION__);
-                return (EXIT_FAILURE);
-        }
-        face->object_owner_soft = strdup (object_owner_soft);
+        face->object_owner_soft = object_owner_soft;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2208,15 +2071,13 @@ dxf_3dface_set_object_owner_soft
  *
  * \return \c EXIT_SUCCESS when sucessful, \c EXIT_FAILURE when an error
  * occurred.
- *
- * \warning No checks are performed on the returned pointer.
  */
 int
 dxf_3dface_get_material
 (
         Dxf3dface *face,
                 /*!< [in] a pointer to a DXF \c 3DFACE entity. */
-        char *material
+        uint64_t *material
                 /*!< [out] a pointer to \c material. */
 )
 {
@@ -2231,21 +2092,7 @@ dxf_3dface_get_material
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (face->material ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (EXIT_FAILURE);
-        }
-        if (material == NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was passed.\n")),
-                  __FUNCTION__);
-                return (EXIT_FAILURE);
-        }
-        material = strdup (face->material);
+        *material = face->material;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2264,8 +2111,8 @@ dxf_3dface_set_material
 (
         Dxf3dface *face,
                 /*!< a [in.out] pointer to a DXF \c 3DFACE entity. */
-        char *material
-                /*!< [in] a string containing the pointer to the \c
+        uint64_t material
+                /*!< [in] the handle of the \c
                  * material for the entity. */
 )
 {
@@ -2280,14 +2127,7 @@ dxf_3dface_set_material
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (material == NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was passed.\n")),
-                  __FUNCTION__);
-                return (EXIT_FAILURE);
-        }
-        face->material = strdup (material);
+        face->material = material;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2301,15 +2141,13 @@ dxf_3dface_set_material
  *
  * \return \c EXIT_SUCCESS when successful, \c EXIT_FAILURE when an
  * error occurred.
- *
- * \warning No checks are performed on the returned pointer.
  */
 int
 dxf_3dface_get_dictionary_owner_hard
 (
         Dxf3dface *face,
                 /*!< [in] a pointer to a DXF \c 3DFACE entity. */
-        char *dictionary_owner_hard
+        uint64_t *dictionary_owner_hard
                 /*!< [out] a pointer to a \c dictionary_owner_hard. */
 )
 {
@@ -2324,21 +2162,7 @@ dxf_3dface_get_dictionary_owner_hard
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (face->dictionary_owner_hard ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (EXIT_FAILURE);
-        }
-        if (dictionary_owner_hard == NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was passed.\n")),
-                  __FUNCTION__);
-                return (EXIT_FAILURE);
-        }
-        dictionary_owner_hard = strdup (face->dictionary_owner_hard);
+        *dictionary_owner_hard = face->dictionary_owner_hard;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2358,8 +2182,8 @@ dxf_3dface_set_dictionary_owner_hard
 (
         Dxf3dface *face,
                 /*!< [in,out] a pointer to a DXF \c 3DFACE entity. */
-        char *dictionary_owner_hard
-                /*!< [in] a string containing the pointer to the \c
+        uint64_t dictionary_owner_hard
+                /*!< [in] the handle of the \c
                  * dictionary_owner_hard for the entity. */
 )
 {
@@ -2374,14 +2198,7 @@ dxf_3dface_set_dictionary_owner_hard
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (dictionary_owner_hard == NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was passed.\n")),
-                  __FUNCTION__);
-                return (EXIT_FAILURE);
-        }
-        face->dictionary_owner_hard = strdup (dictionary_owner_hard);
+        face->dictionary_owner_hard = dictionary_owner_hard;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2483,15 +2300,13 @@ dxf_3dface_set_lineweight
  *
  * \return \c EXIT_SUCCESS when sucessful, \c EXIT_FAILURE when an error
  * occurred.
- *
- * \warning No checks are performed on the returned pointer.
  */
 int
 dxf_3dface_get_plot_style_name
 (
         Dxf3dface *face,
                 /*!< [in] a pointer to a DXF \c 3DFACE entity. */
-        char *plot_style_name
+        uint64_t *plot_style_name
                 /*!< [out] a pointer to \c plot_style_name. */
 )
 {
@@ -2506,21 +2321,7 @@ dxf_3dface_get_plot_style_name
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (face->plot_style_name ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (EXIT_FAILURE);
-        }
-        if (plot_style_name == NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was passed.\n")),
-                  __FUNCTION__);
-                return (EXIT_FAILURE);
-        }
-        plot_style_name = strdup (face->plot_style_name);
+        *plot_style_name = face->plot_style_name;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2539,7 +2340,7 @@ dxf_3dface_set_plot_style_name
 (
         Dxf3dface *face,
                 /*!< [in,out] a pointer to a DXF \c 3DFACE entity. */
-        char *plot_style_name
+        uint64_t plot_style_name
                 /*!< [in] a string containing the \c plot_style_name for the
                  * entity. */
 )
@@ -2555,14 +2356,7 @@ dxf_3dface_set_plot_style_name
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (plot_style_name == NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was passed.\n")),
-                  __FUNCTION__);
-                return (EXIT_FAILURE);
-        }
-        face->plot_style_name = strdup (plot_style_name);
+        face->plot_style_name = plot_style_name;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2689,7 +2483,7 @@ dxf_3dface_get_color_name
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        color_name = strdup (face->color_name);
+        color_name = dxf_strdup (face->color_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2731,7 +2525,7 @@ dxf_3dface_set_color_name
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        face->color_name = strdup (color_name);
+        face->color_name = dxf_strdup (color_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2949,7 +2743,7 @@ dxf_3dface_get_x0
                 fprintf (stderr,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
-                x0 = malloc (sizeof (double));
+                x0 = dxf_malloc (sizeof (double));
                 if (x0 == NULL)
                 {
                         fprintf (stderr,
@@ -3059,7 +2853,7 @@ dxf_3dface_get_y0
                 fprintf (stderr,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
-                y0 = malloc (sizeof (double));
+                y0 = dxf_malloc (sizeof (double));
                 if (y0 == NULL)
                 {
                         fprintf (stderr,
@@ -3169,7 +2963,7 @@ dxf_3dface_get_z0
                 fprintf (stderr,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
-                z0 = malloc (sizeof (double));
+                z0 = dxf_malloc (sizeof (double));
                 if (z0 == NULL)
                 {
                         fprintf (stderr,
@@ -3377,7 +3171,7 @@ dxf_3dface_get_x1
                 fprintf (stderr,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
-                x1 = malloc (sizeof (double));
+                x1 = dxf_malloc (sizeof (double));
                 if (x1 == NULL)
                 {
                         fprintf (stderr,
@@ -3487,7 +3281,7 @@ dxf_3dface_get_y1
                 fprintf (stderr,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
-                y1 = malloc (sizeof (double));
+                y1 = dxf_malloc (sizeof (double));
                 if (y1 == NULL)
                 {
                         fprintf (stderr,
@@ -4460,7 +4254,7 @@ dxf_3dface_get_flag
                 fprintf (stderr,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
-                flag = malloc (sizeof (int16_t));
+                flag = dxf_malloc (sizeof (int16_t));
                 if (flag == NULL)
                 {
                         fprintf (stderr,
@@ -4675,7 +4469,7 @@ dxf_3dface_create_from_points
                 /*!< [in] a pointer to a DXF \c POINT entity. */
         DxfPoint *p3,
                 /*!< [in] a pointer to a DXF \c POINT entity. */
-        int id_code,
+        uint64_t id_code,
                 /*!< [in] Identification number for the entity.\n
                  * This is to be an unique (sequential) number in the DXF
                  * file. */
@@ -4730,12 +4524,6 @@ dxf_3dface_create_from_points
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (id_code < 0)
-        {
-                fprintf (stderr,
-                  (_("Warning in %s () a negative value was passed.\n")),
-                  __FUNCTION__);
-        }
         if ((inheritance < 0) || (inheritance > 4))
         {
                 fprintf (stderr,
@@ -4807,7 +4595,7 @@ dxf_3dface_create_from_points
                 }
                 else
                 {
-                        face->linetype = strdup (p0->linetype);
+                        face->linetype = dxf_strdup (p0->linetype);
                 }
                 if (p0->layer == NULL)
                 {
@@ -4817,7 +4605,7 @@ dxf_3dface_create_from_points
                 }
                 else
                 {
-                        face->layer = strdup (p0->layer);
+                        face->layer = dxf_strdup (p0->layer);
                 }
                 face->elevation = p0->elevation;
                 face->thickness = p0->thickness;
@@ -4828,57 +4616,12 @@ dxf_3dface_create_from_points
                 /*! \todo Add graphics_data_size. */
                 face->shadow_mode = p0->shadow_mode;
                 /*! \todo Add binary_graphics_data. */
-                if (p0->dictionary_owner_soft == NULL)
-                {
-                        fprintf (stderr,
-                          (_("Warning in %s () a NULL pointer was found.\n")),
-                          __FUNCTION__);
-                }
-                else
-                {
-                        face->dictionary_owner_soft = strdup (p0->dictionary_owner_soft);
-                }
-                if (p0->object_owner_soft == NULL)
-                {
-                        fprintf (stderr,
-                          (_("Warning in %s () a NULL pointer was found.\n")),
-                          __FUNCTION__);
-                }
-                else
-                {
-                        face->object_owner_soft = strdup (p0->object_owner_soft);
-                }
-                if (p0->material == NULL)
-                {
-                        fprintf (stderr,
-                          (_("Warning in %s () a NULL pointer was found.\n")),
-                          __FUNCTION__);
-                }
-                else
-                {
-                        face->material = strdup (p0->material);
-                }
-                if (p0->dictionary_owner_hard == NULL)
-                {
-                        fprintf (stderr,
-                          (_("Warning in %s () a NULL pointer was found.\n")),
-                          __FUNCTION__);
-                }
-                else
-                {
-                        face->dictionary_owner_hard = strdup (p0->dictionary_owner_hard);
-                }
+                face->dictionary_owner_soft = p0->dictionary_owner_soft;
+                face->object_owner_soft = p0->object_owner_soft;
+                face->material = p0->material;
+                face->dictionary_owner_hard = p0->dictionary_owner_hard;
                 face->lineweight = p0->lineweight;
-                if (p0->plot_style_name == NULL)
-                {
-                        fprintf (stderr,
-                          (_("Warning in %s () a NULL pointer was found.\n")),
-                          __FUNCTION__);
-                }
-                else
-                {
-                        face->plot_style_name = strdup (p0->plot_style_name);
-                }
+                face->plot_style_name = p0->plot_style_name;
                 face->color_value = p0->color_value;
                 if (p0->color_name == NULL)
                 {
@@ -4888,7 +4631,7 @@ dxf_3dface_create_from_points
                 }
                 else
                 {
-                        face->color_name = strdup (p0->color_name);
+                        face->color_name = dxf_strdup (p0->color_name);
                 }
                 face->transparency = p0->transparency;
                 return (EXIT_SUCCESS);
@@ -4910,7 +4653,7 @@ dxf_3dface_create_from_points
                 }
                 else
                 {
-                        face->linetype = strdup (p1->linetype);
+                        face->linetype = dxf_strdup (p1->linetype);
                 }
                 if (p1->layer == NULL)
                 {
@@ -4920,7 +4663,7 @@ dxf_3dface_create_from_points
                 }
                 else
                 {
-                        face->layer = strdup (p1->layer);
+                        face->layer = dxf_strdup (p1->layer);
                 }
                 face->elevation = p1->elevation;
                 face->thickness = p1->thickness;
@@ -4931,57 +4674,12 @@ dxf_3dface_create_from_points
                 /*! \todo Add graphics_data_size. */
                 face->shadow_mode = p1->shadow_mode;
                 /*! \todo Add binary_graphics_data. */
-                if (p1->dictionary_owner_soft == NULL)
-                {
-                        fprintf (stderr,
-                          (_("Warning in %s () a NULL pointer was found.\n")),
-                          __FUNCTION__);
-                }
-                else
-                {
-                        face->dictionary_owner_soft = strdup (p1->dictionary_owner_soft);
-                }
-                if (p1->object_owner_soft == NULL)
-                {
-                        fprintf (stderr,
-                          (_("Warning in %s () a NULL pointer was found.\n")),
-                          __FUNCTION__);
-                }
-                else
-                {
-                        face->object_owner_soft = strdup (p1->object_owner_soft);
-                }
-                if (p1->material == NULL)
-                {
-                        fprintf (stderr,
-                          (_("Warning in %s () a NULL pointer was found.\n")),
-                          __FUNCTION__);
-                }
-                else
-                {
-                        face->material = strdup (p1->material);
-                }
-                if (p1->dictionary_owner_hard == NULL)
-                {
-                        fprintf (stderr,
-                          (_("Warning in %s () a NULL pointer was found.\n")),
-                          __FUNCTION__);
-                }
-                else
-                {
-                        face->dictionary_owner_hard = strdup (p1->dictionary_owner_hard);
-                }
+                face->dictionary_owner_soft = p1->dictionary_owner_soft;
+                face->object_owner_soft = p1->object_owner_soft;
+                face->material = p1->material;
+                face->dictionary_owner_hard = p1->dictionary_owner_hard;
                 face->lineweight = p1->lineweight;
-                if (p1->plot_style_name == NULL)
-                {
-                        fprintf (stderr,
-                          (_("Warning in %s () a NULL pointer was found.\n")),
-                          __FUNCTION__);
-                }
-                else
-                {
-                        face->plot_style_name = strdup (p1->plot_style_name);
-                }
+                face->plot_style_name = p1->plot_style_name;
                 face->color_value = p1->color_value;
                 if (p1->color_name == NULL)
                 {
@@ -4991,7 +4689,7 @@ dxf_3dface_create_from_points
                 }
                 else
                 {
-                        face->color_name = strdup (p1->color_name);
+                        face->color_name = dxf_strdup (p1->color_name);
                 }
                 face->transparency = p1->transparency;
                 return (EXIT_SUCCESS);
@@ -5013,7 +4711,7 @@ dxf_3dface_create_from_points
                 }
                 else
                 {
-                        face->linetype = strdup (p2->linetype);
+                        face->linetype = dxf_strdup (p2->linetype);
                 }
                 if (p2->layer == NULL)
                 {
@@ -5023,7 +4721,7 @@ dxf_3dface_create_from_points
                 }
                 else
                 {
-                        face->layer = strdup (p2->layer);
+                        face->layer = dxf_strdup (p2->layer);
                 }
                 face->elevation = p2->elevation;
                 face->thickness = p2->thickness;
@@ -5034,57 +4732,12 @@ dxf_3dface_create_from_points
                 /*! \todo Add graphics_data_size. */
                 face->shadow_mode = p2->shadow_mode;
                 /*! \todo Add binary_graphics_data. */
-                if (p2->dictionary_owner_soft == NULL)
-                {
-                        fprintf (stderr,
-                          (_("Warning in %s () a NULL pointer was found.\n")),
-                          __FUNCTION__);
-                }
-                else
-                {
-                        face->dictionary_owner_soft = strdup (p2->dictionary_owner_soft);
-                }
-                if (p2->object_owner_soft == NULL)
-                {
-                        fprintf (stderr,
-                          (_("Warning in %s () a NULL pointer was found.\n")),
-                          __FUNCTION__);
-                }
-                else
-                {
-                        face->object_owner_soft = strdup (p2->object_owner_soft);
-                }
-                if (p2->material == NULL)
-                {
-                        fprintf (stderr,
-                          (_("Warning in %s () a NULL pointer was found.\n")),
-                          __FUNCTION__);
-                }
-                else
-                {
-                        face->material = strdup (p2->material);
-                }
-                if (p2->dictionary_owner_hard == NULL)
-                {
-                        fprintf (stderr,
-                          (_("Warning in %s () a NULL pointer was found.\n")),
-                          __FUNCTION__);
-                }
-                else
-                {
-                        face->dictionary_owner_hard = strdup (p2->dictionary_owner_hard);
-                }
+                face->dictionary_owner_soft = p2->dictionary_owner_soft;
+                face->object_owner_soft = p2->object_owner_soft;
+                face->material = p2->material;
+                face->dictionary_owner_hard = p2->dictionary_owner_hard;
                 face->lineweight = p2->lineweight;
-                if (p2->plot_style_name == NULL)
-                {
-                        fprintf (stderr,
-                          (_("Warning in %s () a NULL pointer was found.\n")),
-                          __FUNCTION__);
-                }
-                else
-                {
-                        face->plot_style_name = strdup (p2->plot_style_name);
-                }
+                face->plot_style_name = p2->plot_style_name;
                 face->color_value = p2->color_value;
                 if (p2->color_name == NULL)
                 {
@@ -5094,7 +4747,7 @@ dxf_3dface_create_from_points
                 }
                 else
                 {
-                        face->color_name = strdup (p2->color_name);
+                        face->color_name = dxf_strdup (p2->color_name);
                 }
                 face->transparency = p2->transparency;
                 return (EXIT_SUCCESS);
@@ -5116,7 +4769,7 @@ dxf_3dface_create_from_points
                 }
                 else
                 {
-                        face->linetype = strdup (p3->linetype);
+                        face->linetype = dxf_strdup (p3->linetype);
                 }
                 if (p3->layer == NULL)
                 {
@@ -5126,7 +4779,7 @@ dxf_3dface_create_from_points
                 }
                 else
                 {
-                        face->layer = strdup (p3->layer);
+                        face->layer = dxf_strdup (p3->layer);
                 }
                 face->elevation = p3->elevation;
                 face->thickness = p3->thickness;
@@ -5137,57 +4790,12 @@ dxf_3dface_create_from_points
                 /*! \todo Add graphics_data_size. */
                 face->shadow_mode = p3->shadow_mode;
                 /*! \todo Add binary_graphics_data. */
-                if (p3->dictionary_owner_soft == NULL)
-                {
-                        fprintf (stderr,
-                          (_("Warning in %s () a NULL pointer was found.\n")),
-                          __FUNCTION__);
-                }
-                else
-                {
-                        face->dictionary_owner_soft = strdup (p3->dictionary_owner_soft);
-                }
-                if (p3->object_owner_soft == NULL)
-                {
-                        fprintf (stderr,
-                          (_("Warning in %s () a NULL pointer was found.\n")),
-                          __FUNCTION__);
-                }
-                else
-                {
-                        face->object_owner_soft = strdup (p3->object_owner_soft);
-                }
-                if (p3->material == NULL)
-                {
-                        fprintf (stderr,
-                          (_("Warning in %s () a NULL pointer was found.\n")),
-                          __FUNCTION__);
-                }
-                else
-                {
-                        face->material = strdup (p3->material);
-                }
-                if (p3->dictionary_owner_hard == NULL)
-                {
-                        fprintf (stderr,
-                          (_("Warning in %s () a NULL pointer was found.\n")),
-                          __FUNCTION__);
-                }
-                else
-                {
-                        face->dictionary_owner_hard = strdup (p3->dictionary_owner_hard);
-                }
+                face->dictionary_owner_soft = p3->dictionary_owner_soft;
+                face->object_owner_soft = p3->object_owner_soft;
+                face->material = p3->material;
+                face->dictionary_owner_hard = p3->dictionary_owner_hard;
                 face->lineweight = p3->lineweight;
-                if (p3->plot_style_name == NULL)
-                {
-                        fprintf (stderr,
-                          (_("Warning in %s () a NULL pointer was found.\n")),
-                          __FUNCTION__);
-                }
-                else
-                {
-                        face->plot_style_name = strdup (p3->plot_style_name);
-                }
+                face->plot_style_name = p3->plot_style_name;
                 face->color_value = p3->color_value;
                 if (p3->color_name == NULL)
                 {
@@ -5197,7 +4805,7 @@ dxf_3dface_create_from_points
                 }
                 else
                 {
-                        face->color_name = strdup (p3->color_name);
+                        face->color_name = dxf_strdup (p3->color_name);
                 }
                 face->transparency = p3->transparency;
                 return (EXIT_SUCCESS);
@@ -5352,7 +4960,7 @@ dxf_3dface_get_last
                 fprintf (stderr,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
-                last = malloc (sizeof (Dxf3dface));
+                last = dxf_malloc (sizeof (Dxf3dface));
                 if (last == NULL)
                 {
                         fprintf (stderr,
@@ -5386,4 +4994,121 @@ dxf_3dface_get_last
 }
 
 
+/*!
+ * \brief Get the bounding box of a DXF \c 3DFACE.
+ *
+ * The box of the four corners of \c face.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_3dface_get_bbox
+(
+        Dxf3dface *face,
+                /*!< a pointer to a DXF \c 3DFACE entity. */
+        DxfBbox *bbox
+                /*!< a pointer to the libDXF bounding box to fill. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfPoint *corners[4];
+        int i;
+
+        /* Do some basic checks. */
+        if ((face == NULL) || (bbox == NULL))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        corners[0] = face->p0;
+        corners[1] = face->p1;
+        corners[2] = face->p2;
+        corners[3] = face->p3;
+        dxf_bbox_init (bbox);
+        for (i = 0; i < 4; i++)
+        {
+                if (corners[i] == NULL)
+                {
+                        fprintf (stderr,
+                          (_("Error in %s () a NULL pointer to a corner was found.\n")),
+                          __FUNCTION__);
+                        return (EXIT_FAILURE);
+                }
+                dxf_bbox_add_point (bbox, corners[i]->x0, corners[i]->y0, corners[i]->z0);
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Transform a DXF \c 3DFACE entity in place.
+ *
+ * The corners are in world coordinates.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_3dface_transform
+(
+        Dxf3dface *face,
+                /*!< a pointer to a DXF \c 3DFACE entity. */
+        DxfTransform *transform
+                /*!< a pointer to a libDXF affine transformation. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfPoint *corners[4];
+        DxfVec3 corner;
+        int i;
+
+        /* Do some basic checks. */
+        if ((face == NULL) || (transform == NULL))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        corners[0] = face->p0;
+        corners[1] = face->p1;
+        corners[2] = face->p2;
+        corners[3] = face->p3;
+        for (i = 0; i < 4; i++)
+        {
+                if (corners[i] == NULL)
+                {
+                        fprintf (stderr,
+                          (_("Error in %s () a NULL pointer to a corner was found.\n")),
+                          __FUNCTION__);
+                        return (EXIT_FAILURE);
+                }
+        }
+        for (i = 0; i < 4; i++)
+        {
+                corner.x = corners[i]->x0;
+                corner.y = corners[i]->y0;
+                corner.z = corners[i]->z0;
+                dxf_transform_apply_point (transform, &corner, &corner);
+                corners[i]->x0 = corner.x;
+                corners[i]->y0 = corner.y;
+                corners[i]->z0 = corner.z;
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (EXIT_SUCCESS);
+}
+
+
 /* EOF */
@@ -46,6 +46,7 @@
 #include "global.h"
 #include "point.h"
 #include "binary_data.h"
+#include "transform.h"
 
 
 #ifdef __cplusplus
@@ -60,7 +61,7 @@ typedef struct
 dxf_3dface_struct
 {
         /* Members common for all DXF drawable entities. */
-        int id_code;
+        uint64_t id_code;
                 /*!< Identification number for the entity.\n
                  * This is to be an unique (sequential) number in the DXF
                  * file.\n
@@ -133,20 +134,20 @@ dxf_3dface_struct
                  * (optional).\n
                  * Group code = 310.\n
                  * \since Introduced in version R2000. */
-        char *dictionary_owner_soft;
+        uint64_t dictionary_owner_soft;
                 /*!< Soft-pointer ID/handle to owner dictionary (optional).\n
                  * Group code = 330.\n
                  * \since Introduced in version R14. */
-        char *object_owner_soft;
+        uint64_t object_owner_soft;
                 /*!< Soft-pointer ID/handle  to owner BLOCK_RECORD object.\n
                  * Group code = 330.\n
                  * \since Introduced in version R2000. */
-        char *material;
+        uint64_t material;
                 /*!< Hard-pointer ID/handle to material object (present if
                  * not BYLAYER).\n
                  * Group code = 347.\n
                  * \since Introduced in version R2008. */
-        char *dictionary_owner_hard;
+        uint64_t dictionary_owner_hard;
                 /*!< Hard owner ID/handle to owner dictionary (optional).\n
                  * Group code = 360.\n
                  * \since Introduced in version R14. */
@@ -155,7 +156,7 @@ dxf_3dface_struct
                  * Stored and moved around as a 16-bit integer.\n
                  * Group code = 370.\n
                  * \since Introduced in version R2002. */
-        char *plot_style_name;
+        uint64_t plot_style_name;
                 /*!< Hard pointer ID / handle of PlotStyleName object.\n
                  * Group code = 390.\n
                  * \since Introduced in version R2009. */
@@ -222,8 +223,8 @@ int dxf_3dface_read (DxfFile *fp, Dxf3dface *face);
 int dxf_3dface_write (DxfFile *fp, Dxf3dface *face);
 int dxf_3dface_free (Dxf3dface *face);
 int dxf_3dface_free_list (Dxf3dface *faces);
-int dxf_3dface_get_id_code (Dxf3dface *face, int *id_code);
-int dxf_3dface_set_id_code (Dxf3dface *face, int id_code);
+int dxf_3dface_get_id_code (Dxf3dface *face, uint64_t *id_code);
+int dxf_3dface_set_id_code (Dxf3dface *face, uint64_t id_code);
 int dxf_3dface_get_linetype (Dxf3dface *face, char *linetype);
 int dxf_3dface_set_linetype (Dxf3dface *face, char *linetype);
 int dxf_3dface_get_layer (Dxf3dface *face, char *layer);
@@ -246,18 +247,18 @@ int dxf_3dface_get_shadow_mode (Dxf3dface *face, int16_t *shadow_mode);
 int dxf_3dface_set_shadow_mode (Dxf3dface *face, int16_t shadow_mode);
 int dxf_3dface_get_binary_graphics_data (Dxf3dface *face, DxfBinaryData *data);
 int dxf_3dface_set_binary_graphics_data (Dxf3dface *face, DxfBinaryData *data);
-int dxf_3dface_get_dictionary_owner_soft (Dxf3dface *face, char *dictionary_owner_soft);
-int dxf_3dface_set_dictionary_owner_soft (Dxf3dface *face, char *dictionary_owner_soft);
-int dxf_3dface_get_object_owner_soft (Dxf3dface *face, char *object_owner_soft);
-int dxf_3dface_set_object_owner_soft (Dxf3dface *face, char *object_owner_soft);
-int dxf_3dface_get_material (Dxf3dface *face, char *material);
-int dxf_3dface_set_material (Dxf3dface *face, char *material);
-int dxf_3dface_get_dictionary_owner_hard (Dxf3dface *face, char *dictionary_owner_hard);
-int dxf_3dface_set_dictionary_owner_hard (Dxf3dface *face, char *dictionary_owner_hard);
+int dxf_3dface_get_dictionary_owner_soft (Dxf3dface *face, uint64_t *dictionary_owner_soft);
+int dxf_3dface_set_dictionary_owner_soft (Dxf3dface *face, uint64_t dictionary_owner_soft);
+int dxf_3dface_get_object_owner_soft (Dxf3dface *face, uint64_t *object_owner_soft);
+int dxf_3dface_set_object_owner_soft (Dxf3dface *face, uint64_t object_owner_soft);
+int dxf_3dface_get_material (Dxf3dface *face, uint64_t *material);
+int dxf_3dface_set_material (Dxf3dface *face, uint64_t material);
+int dxf_3dface_get_dictionary_owner_hard (Dxf3dface *face, uint64_t *dictionary_owner_hard);
+int dxf_3dface_set_dictionary_owner_hard (Dxf3dface *face, uint64_t dictionary_owner_hard);
 int dxf_3dface_get_lineweight (Dxf3dface *face, int16_t *lineweight);
 int dxf_3dface_set_lineweight (Dxf3dface *face, int16_t lineweight);
-int dxf_3dface_get_plot_style_name (Dxf3dface *face, char *plot_style_name);
-int dxf_3dface_set_plot_style_name (Dxf3dface *face, char *plot_style_name);
+int dxf_3dface_get_plot_style_name (Dxf3dface *face, uint64_t *plot_style_name);
+int dxf_3dface_set_plot_style_name (Dxf3dface *face, uint64_t plot_style_name);
 int dxf_3dface_get_color_value (Dxf3dface *face, int32_t *color_value);
 int dxf_3dface_set_color_value (Dxf3dface *face, int32_t color_value);
 int dxf_3dface_get_color_name (Dxf3dface *face, char *color_name);
@@ -302,10 +303,12 @@ int dxf_3dface_is_first_edge_invisible (Dxf3dface *face);
 int dxf_3dface_is_second_edge_invisible (Dxf3dface *face);
 int dxf_3dface_is_third_edge_invisible (Dxf3dface *face);
 int dxf_3dface_is_fourth_edge_invisible (Dxf3dface *face);
-int dxf_3dface_create_from_points (Dxf3dface *face, DxfPoint *p0, DxfPoint *p1, DxfPoint *p2, DxfPoint *p3, int id_code, int inheritance);
+int dxf_3dface_create_from_points (Dxf3dface *face, DxfPoint *p0, DxfPoint *p1, DxfPoint *p2, DxfPoint *p3, uint64_t id_code, int inheritance);
 int dxf_3dface_get_next (Dxf3dface *face, Dxf3dface *next);
 int dxf_3dface_set_next (Dxf3dface *face, Dxf3dface *next);
 int dxf_3dface_get_last (Dxf3dface *face, Dxf3dface *last);
+int dxf_3dface_get_bbox (Dxf3dface *face, DxfBbox *bbox);
+int dxf_3dface_transform (Dxf3dface *face, DxfTransform *transform);
 
 
 #ifdef __cplusplus
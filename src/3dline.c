@@ -43,6 +43,7 @@
 
 
 #include "3dline.h"
+#include "util.h"
 
 
 /*!
@@ -68,7 +69,7 @@ dxf_3dline_new
         size = sizeof (Dxf3dline);
         /* avoid malloc of 0 bytes */
         if (size == 0) size = 1;
-        if ((line = malloc (size)) == NULL)
+        if ((line = dxf_malloc (size)) == NULL)
         {
                 fprintf (stderr,
                   (_("Critical error in %s () could not allocate memory.\n")),
@@ -119,9 +120,9 @@ dxf_3dline_init
                 exit (EXIT_FAILURE);
         }
         /* Assign initial values to members. */
-        line->id_code = 0;
-        line->linetype = strdup (DXF_DEFAULT_LINETYPE);
-        line->layer = strdup (DXF_DEFAULT_LAYER);
+        line->id_code = DXF_HANDLE_NONE;
+        line->linetype = dxf_strdup (DXF_DEFAULT_LINETYPE);
+        line->layer = dxf_strdup (DXF_DEFAULT_LAYER);
         line->elevation = 0.0;
         line->thickness = 0.0;
         line->linetype_scale = DXF_DEFAULT_LINETYPE_SCALE;
@@ -130,14 +131,14 @@ dxf_3dline_init
         line->paperspace = DXF_MODELSPACE;
         line->graphics_data_size = 0;
         line->shadow_mode = 0;
-        line->dictionary_owner_soft = strdup ("");
-        line->object_owner_soft = strdup ("");
-        line->material = strdup ("");
-        line->dictionary_owner_hard = strdup ("");
+        line->dictionary_owner_soft = 0;
+        line->object_owner_soft = 0;
+        line->material = 0;
+        line->dictionary_owner_hard = 0;
         line->lineweight = 0;
-        line->plot_style_name = strdup ("");
+        line->plot_style_name = 0;
         line->color_value = 0;
-        line->color_name = strdup ("");
+        line->color_name = dxf_strdup ("");
         line->transparency = 0;
         line->extr_x0 = 0.0;
         line->extr_y0 = 0.0;
@@ -173,7 +174,8 @@ dxf_3dline_read
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        char *temp_string = NULL;
+        char temp_string[DXF_MAX_STRING_LENGTH];
+        int group_code;
         DxfBinaryData *iter310 = NULL;
         int iter330;
 
@@ -183,8 +185,6 @@ dxf_3dline_read
                 fprintf (stderr,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
-                /* Clean up. */
-                free (temp_string);
                 return (EXIT_FAILURE);
         }
         if (line == NULL)
@@ -251,280 +251,211 @@ dxf_3dline_read
         }
         iter310 = (DxfBinaryData *) line->binary_graphics_data;
         iter330 = 0;
-        (fp->line_number)++;
-        fscanf (fp->fp, "%[^\n]", temp_string);
-        while (strcmp (temp_string, "0") != 0)
+        while ((dxf_read_group_code (fp, &group_code) == EXIT_SUCCESS)
+          && (group_code != 0))
         {
-                if (ferror (fp->fp))
+                if (dxf_read_error (fp))
                 {
                         fprintf (stderr,
                           (_("Error in %s () while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
-                        fclose (fp->fp);
-                        /* Clean up. */
-                        free (temp_string);
                         return (EXIT_FAILURE);
                 }
-                if (strcmp (temp_string, "5") == 0)
-                {
-                        /* Now follows a string containing a sequential
-                         * id number. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%x\n", (uint *) &line->id_code);
-                }
-                else if (strcmp (temp_string, "6") == 0)
-                {
-                        /* Now follows a string containing a linetype
-                         * name. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, line->linetype);
-                }
-                else if (strcmp (temp_string, "8") == 0)
-                {
-                        /* Now follows a string containing a layer name. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, line->layer);
-                }
-                else if (strcmp (temp_string, "10") == 0)
-                {
-                        /* Now follows a string containing the
-                         * X-coordinate of the center point. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &line->p0->x0);
-                }
-                else if (strcmp (temp_string, "20") == 0)
-                {
-                        /* Now follows a string containing the
-                         * Y-coordinate of the center point. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &line->p0->y0);
-                }
-                else if (strcmp (temp_string, "30") == 0)
-                {
-                        /* Now follows a string containing the
-                         * Z-coordinate of the center point. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &line->p0->z0);
-                }
-                else if (strcmp (temp_string, "11") == 0)
-                {
-                        /* Now follows a string containing the
-                         * X-coordinate of the center point. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &line->p1->x0);
-                }
-                else if (strcmp (temp_string, "21") == 0)
-                {
-                        /* Now follows a string containing the
-                         * Y-coordinate of the center point. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &line->p1->y0);
-                }
-                else if (strcmp (temp_string, "31") == 0)
-                {
-                        /* Now follows a string containing the
-                         * Z-coordinate of the center point. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &line->p1->z0);
-                }
-                else if (strcmp (temp_string, "38") == 0)
-                {
-                        /* Now follows a string containing the
-                         * elevation. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &line->elevation);
-                }
-                else if (strcmp (temp_string, "39") == 0)
-                {
-                        /* Now follows a string containing the
-                         * thickness. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &line->thickness);
-                }
-                else if (strcmp (temp_string, "48") == 0)
-                {
-                        /* Now follows a string containing the linetype
-                         * scale. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &line->linetype_scale);
-                }
-                else if (strcmp (temp_string, "60") == 0)
-                {
-                        /* Now follows a string containing the
-                         * visibility value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%hd\n", &line->visibility);
-                }
-                else if (strcmp (temp_string, "62") == 0)
+                switch (group_code)
                 {
-                        /* Now follows a string containing the
-                         * color value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%hd\n", &line->color);
-                }
-                else if (strcmp (temp_string, "67") == 0)
-                {
-                        /* Now follows a string containing the
-                         * paperspace value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%hd\n", &line->paperspace);
-                }
-                else if (strcmp (temp_string, "92") == 0)
-                {
-                        /* Now follows a string containing the
-                         * graphics data size value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%" PRIi32 "\n", &line->graphics_data_size);
-                }
-                else if (strcmp (temp_string, "100") == 0)
-                {
-                        /* Now follows a string containing the
-                         * subclass marker value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
-                        if ((strcmp (temp_string, "AcDbEntity") != 0)
-                        && ((strcmp (temp_string, "AcDbLine") != 0)))
-                        {
+                        case 5:
+                                /* Now follows a string containing a sequential
+                                 * id number. */
+                                dxf_read_handle (fp, &line->id_code);
+                                break;
+                        case 6:
+                                /* Now follows a string containing a linetype
+                                 * name. */
+                                dxf_read_string_interned (fp, &line->linetype);
+                                break;
+                        case 8:
+                                /* Now follows a string containing a layer name. */
+                                dxf_read_string_interned (fp, &line->layer);
+                                break;
+                        case 10:
+                                /* Now follows a string containing the
+                                 * X-coordinate of the center point. */
+                                dxf_read_double (fp, &line->p0->x0);
+                                break;
+                        case 20:
+                                /* Now follows a string containing the
+                                 * Y-coordinate of the center point. */
+                                dxf_read_double (fp, &line->p0->y0);
+                                break;
+                        case 30:
+                                /* Now follows a string containing the
+                                 * Z-coordinate of the center point. */
+                                dxf_read_double (fp, &line->p0->z0);
+                                break;
+                        case 11:
+                                /* Now follows a string containing the
+                                 * X-coordinate of the center point. */
+                                dxf_read_double (fp, &line->p1->x0);
+                                break;
+                        case 21:
+                                /* Now follows a string containing the
+                                 * Y-coordinate of the center point. */
+                                dxf_read_double (fp, &line->p1->y0);
+                                break;
+                        case 31:
+                                /* Now follows a string containing the
+                                 * Z-coordinate of the center point. */
+                                dxf_read_double (fp, &line->p1->z0);
+                                break;
+                        case 38:
+                                /* Now follows a string containing the
+                                 * elevation. */
+                                dxf_read_double (fp, &line->elevation);
+                                break;
+                        case 39:
+                                /* Now follows a string containing the
+                                 * thickness. */
+                                dxf_read_double (fp, &line->thickness);
+                                break;
+                        case 48:
+                                /* Now follows a string containing the linetype
+                                 * scale. */
+                                dxf_read_double (fp, &line->linetype_scale);
+                                break;
+                        case 60:
+                                /* Now follows a string containing the
+                                 * visibility value. */
+                                dxf_read_int16 (fp, &line->visibility);
+                                break;
+                        case 62:
+                                /* Now follows a string containing the
+                                 * color value. */
+                                dxf_read_int16 (fp, &line->color);
+                                break;
+                        case 67:
+                                /* Now follows a string containing the
+                                 * paperspace value. */
+                                dxf_read_int16 (fp, &line->paperspace);
+                                break;
+                        case 92:
+                                /* Now follows a string containing the
+                                 * graphics data size value. */
+                                dxf_read_int32 (fp, &line->graphics_data_size);
+                                break;
+                        case 100:
+                                /* Now follows a string containing the
+                                 * subclass marker value. */
+                                dxf_read_line (temp_string, fp);
+                                if ((strcmp (temp_string, "AcDbEntity") != 0)
+                                && ((strcmp (temp_string, "AcDbLine") != 0)))
+                                {
+                                        fprintf (stderr,
+                                          (_("Warning in %s () found a bad subclass marker in: %s in line: %d.\n")),
+                                          __FUNCTION__, fp->filename, fp->line_number);
+                                }
+                                break;
+                        case 160:
+                                /* Now follows a string containing the
+                                 * graphics data size value. */
+                                dxf_read_int32 (fp, &line->graphics_data_size);
+                                break;
+                        case 210:
+                                /* Now follows a string containing the
+                                 * X-value of the extrusion vector. */
+                                dxf_read_double (fp, &line->extr_x0);
+                                break;
+                        case 220:
+                                /* Now follows a string containing the
+                                 * Y-value of the extrusion vector. */
+                                dxf_read_double (fp, &line->extr_y0);
+                                break;
+                        case 230:
+                                /* Now follows a string containing the
+                                 * Z-value of the extrusion vector. */
+                                dxf_read_double (fp, &line->extr_z0);
+                                break;
+                        case 284:
+                                /* Now follows a string containing the shadow
+                                 * mode value. */
+                                dxf_read_int16 (fp, &line->shadow_mode);
+                                break;
+                        case 310:
+                                /* Now follows a string containing binary
+                                 * graphics data. */
+                                iter310 = dxf_binary_data_read (fp, iter310);
+                                break;
+                        case 330:
+                                if (iter330 == 0)
+                                {
+                                        /* Now follows a string containing a soft-pointer
+                                         * ID/handle to owner dictionary. */
+                                        dxf_read_handle (fp, &line->dictionary_owner_soft);
+                                }
+                                if (iter330 == 1)
+                                {
+                                        /* Now follows a string containing a soft-pointer
+                                         * ID/handle to owner object. */
+                                        dxf_read_handle (fp, &line->object_owner_soft);
+                                }
+                                iter330++;
+                                break;
+                        case 347:
+                                /* Now follows a string containing a
+                                 * hard-pointer ID/handle to material object. */
+                                dxf_read_handle (fp, &line->material);
+                                break;
+                        case 360:
+                                /* Now follows a string containing Hard owner
+                                 * ID/handle to owner dictionary. */
+                                dxf_read_handle (fp, &line->dictionary_owner_hard);
+                                break;
+                        case 370:
+                                /* Now follows a string containing the lineweight
+                                 * value. */
+                                dxf_read_int16 (fp, &line->lineweight);
+                                break;
+                        case 390:
+                                /* Now follows a string containing a plot style
+                                 * name value. */
+                                dxf_read_handle (fp, &line->plot_style_name);
+                                break;
+                        case 420:
+                                /* Now follows a string containing a color value. */
+                                dxf_read_int32 (fp, &line->color_value);
+                                break;
+                        case 430:
+                                /* Now follows a string containing a color
+                                 * name value. */
+                                dxf_read_string_interned (fp, &line->color_name);
+                                break;
+                        case 440:
+                                /* Now follows a string containing a transparency
+                                 * value. */
+                                dxf_read_int32 (fp, &line->transparency);
+                                break;
+                        case 999:
+                                /* Now follows a string containing a comment. */
+                                dxf_read_line (temp_string, fp);
+                                fprintf (stdout, "DXF comment: %s\n", temp_string);
+                                break;
+                        default:
                                 fprintf (stderr,
-                                  (_("Warning in %s () found a bad subclass marker in: %s in line: %d.\n")),
+                                  (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
                                   __FUNCTION__, fp->filename, fp->line_number);
-                        }
-                }
-                else if (strcmp (temp_string, "160") == 0)
-                {
-                        /* Now follows a string containing the
-                         * graphics data size value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%" PRIi32 "\n", &line->graphics_data_size);
-                }
-                else if (strcmp (temp_string, "210") == 0)
-                {
-                        /* Now follows a string containing the
-                         * X-value of the extrusion vector. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &line->extr_x0);
-                }
-                else if (strcmp (temp_string, "220") == 0)
-                {
-                        /* Now follows a string containing the
-                         * Y-value of the extrusion vector. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &line->extr_y0);
-                }
-                else if (strcmp (temp_string, "230") == 0)
-                {
-                        /* Now follows a string containing the
-                         * Z-value of the extrusion vector. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &line->extr_z0);
-                }
-                else if (strcmp (temp_string, "284") == 0)
-                {
-                        /* Now follows a string containing the shadow
-                         * mode value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%hd\n", &line->shadow_mode);
-                }
-                else if (strcmp (temp_string, "310") == 0)
-                {
-                        /* Now follows a string containing binary
-                         * graphics data. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, iter310->data_line);
-                        dxf_binary_data_init ((DxfBinaryData *) iter310->next);
-                        iter310 = (DxfBinaryData *) iter310->next;
-                }
-                else if (strcmp (temp_string, "330") == 0)
-                {
-                        if (iter330 == 0)
-                        {
-                                /* Now follows a string containing a soft-pointer
-                                 * ID/handle to owner dictionary. */
-                                (fp->line_number)++;
-                                fscanf (fp->fp, DXF_MAX_STRING_FORMAT, line->dictionary_owner_soft);
-                        }
-                        if (iter330 == 1)
-                        {
-                                /* Now follows a string containing a soft-pointer
-                                 * ID/handle to owner object. */
-                                (fp->line_number)++;
-                                fscanf (fp->fp, DXF_MAX_STRING_FORMAT, line->object_owner_soft);
-                        }
-                        iter330++;
-                }
-                else if (strcmp (temp_string, "347") == 0)
-                {
-                        /* Now follows a string containing a
-                         * hard-pointer ID/handle to material object. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, line->material);
-                }
-                else if (strcmp (temp_string, "360") == 0)
-                {
-                        /* Now follows a string containing Hard owner
-                         * ID/handle to owner dictionary. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, line->dictionary_owner_hard);
-                }
-                else if (strcmp (temp_string, "370") == 0)
-                {
-                        /* Now follows a string containing the lineweight
-                         * value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%hd\n", &line->lineweight);
-                }
-                else if (strcmp (temp_string, "390") == 0)
-                {
-                        /* Now follows a string containing a plot style
-                         * name value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, line->plot_style_name);
-                }
-                else if (strcmp (temp_string, "420") == 0)
-                {
-                        /* Now follows a string containing a color value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%" PRIi32 "\n", &line->color_value);
-                }
-                else if (strcmp (temp_string, "430") == 0)
-                {
-                        /* Now follows a string containing a color
-                         * name value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, line->color_name);
-                }
-                else if (strcmp (temp_string, "440") == 0)
-                {
-                        /* Now follows a string containing a transparency
-                         * value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%" PRIi32 "\n", &line->transparency);
-                }
-                else if (strcmp (temp_string, "999") == 0)
-                {
-                        /* Now follows a string containing a comment. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
-                        fprintf (stdout, "DXF comment: %s\n", temp_string);
-                }
-                else
-                {
-                        fprintf (stderr,
-                          (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
-                          __FUNCTION__, fp->filename, fp->line_number);
+                                /* Skip the value of the unknown group code. */
+                                dxf_read_line (temp_string, fp);
+                                break;
                 }
         }
         /* Handle omitted members and/or illegal values. */
         if (strcmp (line->linetype, "") == 0)
         {
-                line->linetype = strdup (DXF_DEFAULT_LINETYPE);
+                line->linetype = dxf_strdup (DXF_DEFAULT_LINETYPE);
         }
         if (strcmp (line->layer, "") == 0)
         {
-                line->layer = strdup (DXF_DEFAULT_LAYER);
+                line->layer = dxf_strdup (DXF_DEFAULT_LAYER);
         }
-        /* Clean up. */
-        free (temp_string);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -554,7 +485,7 @@ dxf_3dline_write
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        char *dxf_entity_name = strdup ("3DLINE");
+        char *dxf_entity_name = dxf_strdup ("3DLINE");
         double *extr_x0 = NULL;
         double *extr_y0 = NULL;
         double *extr_z0 = NULL;
@@ -566,7 +497,7 @@ dxf_3dline_write
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (line == NULL)
@@ -575,7 +506,7 @@ dxf_3dline_write
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if ((line->p0->x0 == line->p1->x0)
@@ -583,42 +514,42 @@ dxf_3dline_write
                 && (line->p0->z0 == line->p1->z0))
         {
                 fprintf (stderr,
-                  (_("Error in %s () start point and end point are identical for the %s entity with id-code: %x\n")),
+                  (_("Error in %s () start point and end point are identical for the %s entity with id-code: %" PRIx64 "\n")),
                   __FUNCTION__, dxf_entity_name, line->id_code);
                 dxf_entity_skip (dxf_entity_name);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if ((strcmp (line->layer, "") == 0) || (line->layer == NULL))
         {
                 fprintf (stderr,
-                  (_("Warning in %s () invalid layer string for the %s entity with id-code: %x\n")),
+                  (_("Warning in %s () invalid layer string for the %s entity with id-code: %" PRIx64 "\n")),
                   __FUNCTION__, dxf_entity_name, line->id_code);
                 fprintf (stderr,
                   (_("    %s entity is relocated to layer 0\n")),
                   dxf_entity_name);
-                line->layer = strdup (DXF_DEFAULT_LAYER);
+                line->layer = dxf_strdup (DXF_DEFAULT_LAYER);
         }
         if (line->linetype == NULL)
         {
                 fprintf (stderr,
-                  (_("Warning in %s () invalid linetype string for the %s entity with id-code: %x\n")),
+                  (_("Warning in %s () invalid linetype string for the %s entity with id-code: %" PRIx64 "\n")),
                   __FUNCTION__, dxf_entity_name, line->id_code);
                 fprintf (stderr,
                   (_("\t%s linetype is set to %s\n")),
                   dxf_entity_name, DXF_DEFAULT_LINETYPE);
-                line->linetype = strdup (DXF_DEFAULT_LINETYPE);
+                line->linetype = dxf_strdup (DXF_DEFAULT_LINETYPE);
         }
         if (fp->acad_version_number > AutoCAD_11)
         {
-                dxf_entity_name = strdup ("LINE");
+                dxf_entity_name = dxf_strdup ("LINE");
         }
         /* Start writing output. */
-        fprintf (fp->fp, "  0\n%s\n", dxf_entity_name);
-        if (line->id_code != -1)
+        dxf_write_string (fp, 0, dxf_entity_name);
+        if (line->id_code != DXF_HANDLE_NONE)
         {
-                fprintf (fp->fp, "  5\n%x\n", line->id_code);
+                dxf_write_hex (fp, 5, line->id_code);
         }
         /*!
          * \todo for version R14.\n
@@ -630,74 +561,74 @@ dxf_3dline_write
          * 102 groups are application defined (optional).\n\n
          * End of group, "}" (optional), with Group code 102.
          */
-        if ((strcmp (line->dictionary_owner_soft, "") != 0)
+        if ((line->dictionary_owner_soft != 0)
           && (fp->acad_version_number >= AutoCAD_14))
         {
-                fprintf (fp->fp, "102\n{ACAD_REACTORS\n");
-                fprintf (fp->fp, "330\n%s\n", line->dictionary_owner_soft);
-                fprintf (fp->fp, "102\n}\n");
+                dxf_write_string (fp, 102, "{ACAD_REACTORS");
+                dxf_write_hex (fp, 330, line->dictionary_owner_soft);
+                dxf_write_string (fp, 102, "}");
         }
-        if ((strcmp (line->dictionary_owner_hard, "") != 0)
+        if ((line->dictionary_owner_hard != 0)
           && (fp->acad_version_number >= AutoCAD_14))
         {
-                fprintf (fp->fp, "102\n{ACAD_XDICTIONARY\n");
-                fprintf (fp->fp, "360\n%s\n", line->dictionary_owner_hard);
-                fprintf (fp->fp, "102\n}\n");
+                dxf_write_string (fp, 102, "{ACAD_XDICTIONARY");
+                dxf_write_hex (fp, 360, line->dictionary_owner_hard);
+                dxf_write_string (fp, 102, "}");
         }
-        if ((strcmp (line->object_owner_soft, "") != 0)
+        if ((line->object_owner_soft != 0)
           && (fp->acad_version_number >= AutoCAD_2000))
         {
-                fprintf (fp->fp, "330\n%s\n", line->object_owner_soft);
+                dxf_write_hex (fp, 330, line->object_owner_soft);
         }
         if (fp->acad_version_number >= AutoCAD_13)
         {
-                fprintf (fp->fp, "100\nAcDbEntity\n");
+                dxf_write_string (fp, 100, "AcDbEntity");
         }
         if ((line->paperspace == DXF_PAPERSPACE)
           && (fp->acad_version_number >= AutoCAD_13))
         {
-                fprintf (fp->fp, " 67\n%hd\n", (int16_t) DXF_PAPERSPACE);
+                dxf_write_int (fp, 67, (int16_t) DXF_PAPERSPACE);
         }
-        fprintf (fp->fp, "  8\n%s\n", line->layer);
+        dxf_write_string (fp, 8, line->layer);
         if (strcmp (line->linetype, DXF_DEFAULT_LINETYPE) != 0)
         {
-                fprintf (fp->fp, "  6\n%s\n", line->linetype);
+                dxf_write_string (fp, 6, line->linetype);
         }
         if ((fp->acad_version_number <= AutoCAD_11)
           && DXF_FLATLAND
           && (line->elevation != 0.0))
         {
-                fprintf (fp->fp, " 38\n%f\n", line->elevation);
+                dxf_write_double (fp, 38, line->elevation);
         }
         if ((fp->acad_version_number >= AutoCAD_2008)
-          && (strcmp (line->material, "") != 0))
+          && (line->material != 0))
         {
-                fprintf (fp->fp, "347\n%s\n", line->material);
+                dxf_write_hex (fp, 347, line->material);
         }
         if (line->color != DXF_COLOR_BYLAYER)
         {
-                fprintf (fp->fp, " 62\n%hd\n", line->color);
+                dxf_write_int (fp, 62, line->color);
         }
         if (fp->acad_version_number >= AutoCAD_2002)
         {
-                fprintf (fp->fp, "370\n%hd\n", line->lineweight);
+                dxf_write_int (fp, 370, line->lineweight);
         }
         if ((line->linetype_scale != 1.0)
           && (fp->acad_version_number >= AutoCAD_13))
         {
-                fprintf (fp->fp, " 48\n%f\n", line->linetype_scale);
+                dxf_write_double (fp, 48, line->linetype_scale);
         }
         if ((line->visibility != 0)
           && (fp->acad_version_number >= AutoCAD_13))
         {
-                fprintf (fp->fp, " 60\n%hd\n", line->visibility);
+                dxf_write_int (fp, 60, line->visibility);
         }
         if (fp->acad_version_number >= AutoCAD_2000)
         {
 #ifdef BUILD_64
-                fprintf (fp->fp, "160\n%" PRIi32 "\n", line->graphics_data_size);
+                dxf_write_int (fp, 160, line->graphics_data_size);
 #else
-                fprintf (fp->fp, " 92\n%" PRIi32 "\n", line->graphics_data_size);
+                dxf_write_int (fp, 92, line->graphics_data_size);
 #endif
                 if (line->binary_graphics_data != NULL)
                 {
@@ -705,36 +636,36 @@ dxf_3dline_write
                         iter310 = (DxfBinaryData *) line->binary_graphics_data;
                         while (iter310 != NULL)
                         {
-                                fprintf (fp->fp, "310\n%s\n", iter310->data_line);
+                                dxf_binary_data_write (fp, iter310);
                                 iter310 = (DxfBinaryData *) iter310->next;
                         }
                 }
         }
         if (fp->acad_version_number >= AutoCAD_2004)
         {
-                fprintf (fp->fp, "420\n%" PRIi32 "\n", line->color_value);
-                fprintf (fp->fp, "430\n%s\n", line->color_name);
-                fprintf (fp->fp, "440\n%" PRIi32 "\n", line->transparency);
+                dxf_write_int (fp, 420, line->color_value);
+                dxf_write_string (fp, 430, line->color_name);
+                dxf_write_int (fp, 440, line->transparency);
         }
         if (fp->acad_version_number >= AutoCAD_2009)
         {
-                fprintf (fp->fp, "390\n%s\n", line->plot_style_name);
-                fprintf (fp->fp, "284\n%hd\n", line->shadow_mode);
+                dxf_write_hex (fp, 390, line->plot_style_name);
+                dxf_write_int (fp, 284, line->shadow_mode);
         }
         if (fp->acad_version_number >= AutoCAD_13)
         {
-                fprintf (fp->fp, "100\nAcDbLine\n");
+                dxf_write_string (fp, 100, "AcDbLine");
         }
         if (line->thickness != 0.0)
         {
-                fprintf (fp->fp, " 39\n%f\n", line->thickness);
+                dxf_write_double (fp, 39, line->thickness);
         }
-        fprintf (fp->fp, " 10\n%f\n", line->p0->x0);
-        fprintf (fp->fp, " 20\n%f\n", line->p0->y0);
-        fprintf (fp->fp, " 30\n%f\n", line->p0->z0);
-        fprintf (fp->fp, " 11\n%f\n", line->p1->x0);
-        fprintf (fp->fp, " 21\n%f\n", line->p1->y0);
-        fprintf (fp->fp, " 31\n%f\n", line->p1->z0);
+        dxf_write_double (fp, 10, line->p0->x0);
+        dxf_write_double (fp, 20, line->p0->y0);
+        dxf_write_double (fp, 30, line->p0->z0);
+        dxf_write_double (fp, 11, line->p1->x0);
+        dxf_write_double (fp, 21, line->p1->y0);
+        dxf_write_double (fp, 31, line->p1->z0);
         if (fp->acad_version_number >= AutoCAD_12)
         {
                 dxf_3dline_get_extr_x0 (line, extr_x0);
@@ -742,13 +673,13 @@ dxf_3dline_write
                 dxf_3dline_get_extr_z0 (line, extr_z0);
                 if ((*extr_x0 != 0.0) || (*extr_y0 != 0.0) || (*extr_z0 != 1.0))
                 {
-                        fprintf (fp->fp, "210\n%f\n", *extr_x0);
-                        fprintf (fp->fp, "220\n%f\n", *extr_y0);
-                        fprintf (fp->fp, "230\n%f\n", *extr_z0);
+                        dxf_write_double (fp, 210, *extr_x0);
+                        dxf_write_double (fp, 220, *extr_y0);
+                        dxf_write_double (fp, 230, *extr_z0);
                 }
         }
         /* Clean up. */
-        free (dxf_entity_name);
+        dxf_free (dxf_entity_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -788,18 +719,13 @@ dxf_3dline_free
                 __FUNCTION__);
               return (EXIT_FAILURE);
         }
-        free (line->linetype);
-        free (line->layer);
+        dxf_string_free (line->linetype);
+        dxf_string_free (line->layer);
         dxf_binary_data_free_list (line->binary_graphics_data);
-        free (line->dictionary_owner_soft);
-        free (line->object_owner_soft);
-        free (line->material);
-        free (line->dictionary_owner_hard);
-        free (line->plot_style_name);
-        free (line->color_name);
+        dxf_string_free (line->color_name);
         dxf_point_free_list (line->p0);
         dxf_point_free_list (line->p1);
-        free (line);
+        dxf_free (line);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -856,7 +782,7 @@ dxf_3dline_get_id_code
 (
         Dxf3dline *line,
                 /*!< [in] a pointer to a DXF \c 3DLINE entity. */
-        int *id_code
+        uint64_t *id_code
                 /*!< [out] a pointer to \c id_code. */
 )
 {
@@ -871,12 +797,6 @@ dxf_3dline_get_id_code
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (line->id_code < 0)
-        {
-                fprintf (stderr,
-                  (_("Warning in %s () a negative value was found.\n")),
-                  __FUNCTION__);
-        }
         id_code = &line->id_code;
 #if DEBUG
         DXF_DEBUG_END
@@ -896,7 +816,7 @@ dxf_3dline_set_id_code
 (
         Dxf3dline *line,
                 /*!< [in,out] a pointer to a DXF \c 3DLINE entity. */
-        int id_code
+        uint64_t id_code
                 /*!< [in] identification number for the entity.\n
                  * This is to be an unique (sequential) number in the DXF
                  * file. */
@@ -913,12 +833,6 @@ dxf_3dline_set_id_code
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (id_code < 0)
-        {
-                fprintf (stderr,
-                  (_("Warning in %s () a negative value was passed.\n")),
-                  __FUNCTION__);
-        }
         line->id_code = id_code;
 #if DEBUG
         DXF_DEBUG_END
@@ -968,7 +882,7 @@ dxf_3dline_get_linetype
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        linetype = strdup (line->linetype);
+        linetype = dxf_strdup (line->linetype);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1012,7 +926,7 @@ dxf_3dline_set_linetype
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        line->linetype = strdup (linetype);
+        line->linetype = dxf_strdup (linetype);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1060,7 +974,7 @@ dxf_3dline_get_layer
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        layer = strdup (line->layer);
+        layer = dxf_strdup (line->layer);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1103,7 +1017,7 @@ dxf_3dline_set_layer
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        line->layer = strdup (layer);
+        line->layer = dxf_strdup (layer);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1960,16 +1874,14 @@ dxf_3dline_set_binary_graphics_data
  *
  * \return \c EXIT_SUCCESS when sucessful, \c EXIT_FAILURE when an error
  * occurred.
- *
- * \warning No checks are performed on the returned pointer (string).
  */
 int
 dxf_3dline_get_dictionary_owner_soft
 (
         Dxf3dline *line,
                 /*!< [in] a pointer to a DXF \c 3DLINE entity. */
-        char *dictionary_owner_soft
-                /*!< [out] a string containing the pointer to the
+        uint64_t *dictionary_owner_soft
+                /*!< [out] the handle of the
                  * \c dictionary_owner_soft for the entity. */
 )
 {
@@ -1984,21 +1896,7 @@ dxf_3dline_get_dictionary_owner_soft
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (line->dictionary_owner_soft ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (EXIT_FAILURE);
-        }
-        if (dictionary_owner_soft == NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was passed.\n")),
-                  __FUNCTION__);
-                return (EXIT_FAILURE);
-        }
-        dictionary_owner_soft = strdup (line->dictionary_owner_soft);
+        *dictionary_owner_soft = line->dictionary_owner_soft;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2018,7 +1916,7 @@ dxf_3dline_set_dictionary_owner_soft
 (
         Dxf3dline *line,
                 /*!< [in,out] a pointer to a DXF \c 3DLINE entity. */
-        char *dictionary_owner_soft
+        uint64_t dictionary_owner_soft
                 /*!< [in] a pointer to \c dictionary_owner_soft for the
                  * entity. */
 )
@@ -2034,14 +1932,7 @@ dxf_3dline_set_dictionary_owner_soft
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (dictionary_owner_soft == NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was passed.\n")),
-                  __FUNCTION__);
-                return (EXIT_FAILURE);
-        }
-        line->dictionary_owner_soft = strdup (dictionary_owner_soft);
+        line->dictionary_owner_soft = dictionary_owner_soft;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2055,15 +1946,13 @@ dxf_3dline_set_dictionary_owner_soft
  *
  * \return \c EXIT_SUCCESS when sucessful, \c EXIT_FAILURE when an error
  * occurred.
- *
- * \warning No checks are performed on the returned pointer (string).
  */
 int
 dxf_3dline_get_object_owner_soft
 (
         Dxf3dline *line,
                 /*!< [in] a pointer to a DXF \c 3DLINE entity. */
-        char *object_owner_soft
+        uint64_t *object_owner_soft
                 /*!< [out] a pointer to a string containing the
                  * \c object_owner_soft. */
 )
@@ -2079,21 +1968,7 @@ dxf_3dline_get_object_owner_soft
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (line->object_owner_soft ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (EXIT_FAILURE);
-        }
-        if (object_owner_soft == NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was passed.\n")),
-                  __FUNCTION__);
-                return (EXIT_FAILURE);
-        }
-        object_owner_soft = strdup (line->object_owner_soft);
+        *object_owner_soft = line->object_owner_soft;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2113,7 +1988,7 @@ dxf_3dline_set_object_owner_soft
 (
         Dxf3dline *line,
                 /*!< [in,out] a pointer to a DXF \c 3DLINE entity. */
-        char *object_owner_soft
+        uint64_t object_owner_soft
                 /*!< [in] a pointer to a string containing the
                  * \c object_owner_soft for the entity. */
 )
@@ -2129,14 +2004,7 @@ dxf_3dline_set_object_owner_soft
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (object_owner_soft == NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was passed.\n")),
-                  __FUNCTION__);
-                return (EXIT_FAILURE);
-        }
-        line->object_owner_soft = strdup (object_owner_soft);
+        line->object_owner_soft = object_owner_soft;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2149,15 +2017,13 @@ dxf_3dline_set_object_owner_soft
  *
  * \return \c EXIT_SUCCESS when sucessful, \c EXIT_FAILURE when an error
  * occurred.
- *
- * \warning No checks are performed on the returned pointer.
  */
 int
 dxf_3dline_get_material
 (
         Dxf3dline *line,
                 /*!< [in] a pointer to a DXF \c 3DLINE entity. */
-        char *material
+        uint64_t *material
                 /*!< [out] a pointer to a string containing the the \c
                  * material. */
 )
@@ -2173,21 +2039,7 @@ dxf_3dline_get_material
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (line->material ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (EXIT_FAILURE);
-        }
-        if (material == NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was passed.\n")),
-                  __FUNCTION__);
-                return (EXIT_FAILURE);
-        }
-        material = strdup (line->material);
+        *material = line->material;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2206,7 +2058,7 @@ dxf_3dline_set_material
 (
         Dxf3dline *line,
                 /*!< [in,out] a pointer to a DXF \c 3DLINE entity. */
-        char *material
+        uint64_t material
                 /*!< [in] a pointer to a string containing to \c
                  * material for the entity. */
 )
@@ -2222,14 +2074,7 @@ dxf_3dline_set_material
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (material == NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was passed.\n")),
-                  __FUNCTION__);
-                return (EXIT_FAILURE);
-        }
-        line->material = strdup (material);
+        line->material = material;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2243,15 +2088,13 @@ dxf_3dline_set_material
  *
  * \return \c EXIT_SUCCESS when sucessful, \c EXIT_FAILURE when an error
  * occurred.
- *
- * \warning No checks are performed on the returned pointer (string).
  */
 int
 dxf_3dline_get_dictionary_owner_hard
 (
         Dxf3dline *line,
                 /*!< [in] a pointer to a DXF \c 3DLINE entity. */
-        char *dictionary_owner_hard
+        uint64_t *dictionary_owner_hard
                 /*!< [out] a pointer to a string containing the \c
                  * dictionary_owner_hard. */
 )
@@ -2267,21 +2110,7 @@ dxf_3dline_get_dictionary_owner_hard
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (line->dictionary_owner_hard ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (EXIT_FAILURE);
-        }
-        if (dictionary_owner_hard == NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was passed.\n")),
-                  __FUNCTION__);
-                return (EXIT_FAILURE);
-        }
-        dictionary_owner_hard = strdup (line->dictionary_owner_hard);
+        *dictionary_owner_hard = line->dictionary_owner_hard;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2301,7 +2130,7 @@ dxf_3dline_set_dictionary_owner_hard
 (
         Dxf3dline *line,
                 /*!< [in,out] a pointer to a DXF \c 3DLINE entity. */
-        char *dictionary_owner_hard
+        uint64_t dictionary_owner_hard
                 /*!< [in] a pointer to a string containing the \c
                  * dictionary_owner_hard for the entity. */
 )
@@ -2317,14 +2146,7 @@ dxf_3dline_set_dictionary_owner_hard
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (dictionary_owner_hard == NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was passed.\n")),
-                  __FUNCTION__);
-                return (EXIT_FAILURE);
-        }
-        line->dictionary_owner_hard = strdup (dictionary_owner_hard);
+        line->dictionary_owner_hard = dictionary_owner_hard;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2430,7 +2252,7 @@ dxf_3dline_get_plot_style_name
 (
         Dxf3dline *line,
                 /*!< [in] a pointer to a DXF \c 3DLINE entity. */
-        char *plot_style_name
+        uint64_t *plot_style_name
                 /*!< [out] a pointer to a string containing the
                  * \c plot_style_name. */
 )
@@ -2446,21 +2268,7 @@ dxf_3dline_get_plot_style_name
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (line->plot_style_name ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (EXIT_FAILURE);
-        }
-        if (plot_style_name == NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was passed.\n")),
-                  __FUNCTION__);
-                return (EXIT_FAILURE);
-        }
-        plot_style_name = strdup (line->plot_style_name);
+        *plot_style_name = line->plot_style_name;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2479,7 +2287,7 @@ dxf_3dline_set_plot_style_name
 (
         Dxf3dline *line,
                 /*!< [in,out] a pointer to a DXF \c 3DLINE entity. */
-        char *plot_style_name
+        uint64_t plot_style_name
                 /*!< [in] a pointer to a string containing the
                  * \c plot_style_name for the entity. */
 )
@@ -2495,14 +2303,7 @@ dxf_3dline_set_plot_style_name
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (plot_style_name == NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was passed.\n")),
-                  __FUNCTION__);
-                return (EXIT_FAILURE);
-        }
-        line->plot_style_name = strdup (plot_style_name);
+        line->plot_style_name = plot_style_name;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2626,7 +2427,7 @@ dxf_3dline_get_color_name
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        color_name = strdup (line->color_name);
+        color_name = dxf_strdup (line->color_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2668,7 +2469,7 @@ dxf_3dline_set_color_name
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        line->color_name = strdup (color_name);
+        line->color_name = dxf_strdup (color_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2873,7 +2674,7 @@ dxf_3dline_get_x0
                 fprintf (stderr,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
-                x0 = malloc (sizeof (double));
+                x0 = dxf_malloc (sizeof (double));
                 if (x0 == NULL)
                 {
                         fprintf (stderr,
@@ -2981,7 +2782,7 @@ dxf_3dline_get_y0
                 fprintf (stderr,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
-                y0 = malloc (sizeof (double));
+                y0 = dxf_malloc (sizeof (double));
                 if (y0 == NULL)
                 {
                         fprintf (stderr,
@@ -3375,7 +3176,7 @@ dxf_3dline_get_y1
                 fprintf (stderr,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
-                y1 = malloc (sizeof (double));
+                y1 = dxf_malloc (sizeof (double));
                 if (y1 == NULL)
                 {
                         fprintf (stderr,
@@ -3910,7 +3711,7 @@ dxf_3dline_get_mid_point
 (
         Dxf3dline *line,
                 /*!< [in] a pointer to a DXF \c 3DLINE entity. */
-        int id_code,
+        uint64_t id_code,
                 /*!< [in] Identification number for the entity.\n
                  * This is to be an unique (sequential) number in the DXF
                  * file. */
@@ -3957,12 +3758,6 @@ dxf_3dline_get_mid_point
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (id_code < 0)
-        {
-              fprintf (stderr,
-                  (_("Warning in %s () a negative value was passed.\n")),
-                __FUNCTION__);
-        }
         point->id_code = id_code;
         point->x0 = (line->p0->x0 + line->p1->x0) / 2;
         point->y0 = (line->p0->y0 + line->p1->y0) / 2;
@@ -3975,11 +3770,11 @@ dxf_3dline_get_mid_point
                 case 1:
                         if (line->linetype != NULL)
                         {
-                                point->linetype = strdup (line->linetype);
+                                point->linetype = dxf_strdup (line->linetype);
                         }
                         if (line->layer != NULL)
                         {
-                                point->layer = strdup (line->layer);
+                                point->layer = dxf_strdup (line->layer);
                         }
                         point->elevation = line->elevation;
                         point->thickness = line->thickness;
@@ -3990,31 +3785,16 @@ dxf_3dline_get_mid_point
                         /*! \todo Add graphics_data_size. */
                         point->shadow_mode = line->shadow_mode;
                         /*! \todo Add binary_graphics_data. */
-                        if (line->dictionary_owner_soft != NULL)
-                        {
-                                point->dictionary_owner_soft = strdup (line->dictionary_owner_soft);
-                        }
-                        if (line->object_owner_soft != NULL)
-                        {
-                                point->object_owner_soft = strdup (line->object_owner_soft);
-                        }
-                        if (line->material != NULL)
-                        {
-                                point->material = strdup (line->material);
-                        }
-                        if (line->dictionary_owner_hard != NULL)
-                        {
-                                point->dictionary_owner_hard = strdup (line->dictionary_owner_hard);
-                        }
+                        point->dictionary_owner_soft = line->dictionary_owner_soft;
+                        point->object_owner_soft = line->object_owner_soft;
+                        point->material = line->material;
+                        point->dictionary_owner_hard = line->dictionary_owner_hard;
                         point->lineweight = line->lineweight;
-                        if (line->plot_style_name != NULL)
-                        {
-                                point->plot_style_name = strdup (line->plot_style_name);
-                        }
+                        point->plot_style_name = line->plot_style_name;
                         point->color_value = line->color_value;
                         if (line->color_name != NULL)
                         {
-                                point->color_name = strdup (line->color_name);
+                                point->color_name = dxf_strdup (line->color_name);
                         }
                         point->transparency = line->transparency;
                         break;
@@ -4102,7 +3882,7 @@ dxf_3dline_create_from_points
                 /*!< [in] a pointer to a DXF \c POINT entity. */
         DxfPoint *p1,
                 /*!< [in] a pointer to a DXF \c POINT entity. */
-        int id_code,
+        uint64_t id_code,
                 /*!< [in] Identification number for the entity.\n
                  * This is to be an unique (sequential) number in the DXF
                  * file. */
@@ -4151,12 +3931,6 @@ dxf_3dline_create_from_points
                 __FUNCTION__);
               return (EXIT_FAILURE);
         }
-        if (id_code < 0)
-        {
-              fprintf (stderr,
-                  (_("Warning in %s () a negative value was passed.\n")),
-                __FUNCTION__);
-        }
         line->id_code = id_code;
         line->p0->x0 = p0->x0;
         line->p0->y0 = p0->y0;
@@ -4199,57 +3973,12 @@ dxf_3dline_create_from_points
                         /*! \todo Add graphics_data_size. */
                         line->shadow_mode = p0->shadow_mode;
                         /*! \todo Add binary_graphics_data. */
-                        if (p0->dictionary_owner_soft == NULL)
-                        {
-                                fprintf (stderr,
-                                  (_("Warning in %s () a NULL pointer was found.\n")),
-                                  __FUNCTION__);
-                        }
-                        else
-                        {
-                                line->dictionary_owner_soft = strdup (p0->dictionary_owner_soft);
-                        }
-                        if (p0->object_owner_soft == NULL)
-                        {
-                                fprintf (stderr,
-                                  (_("Warning in %s () a NULL pointer was found.\n")),
-                                  __FUNCTION__);
-                        }
-                        else
-                        {
-                                line->object_owner_soft = strdup (p0->object_owner_soft);
-                        }
-                        if (p0->material == NULL)
-                        {
-                                fprintf (stderr,
-                                  (_("Warning in %s () a NULL pointer was found.\n")),
-                                  __FUNCTION__);
-                        }
-                        else
-                        {
-                                line->material = strdup (p0->material);
-                        }
-                        if (p0->dictionary_owner_hard == NULL)
-                        {
-                                fprintf (stderr,
-                                  (_("Warning in %s () a NULL pointer was found.\n")),
-                                  __FUNCTION__);
-                        }
-                        else
-                        {
-                                line->dictionary_owner_hard = strdup (p0->dictionary_owner_hard);
-                        }
+                        line->dictionary_owner_soft = p0->dictionary_owner_soft;
+                        line->object_owner_soft = p0->object_owner_soft;
+                        line->material = p0->material;
+                        line->dictionary_owner_hard = p0->dictionary_owner_hard;
                         line->lineweight = p0->lineweight;
-                        if (p0->plot_style_name == NULL)
-                        {
-                                fprintf (stderr,
-                                  (_("Warning in %s () a NULL pointer was found.\n")),
-                                  __FUNCTION__);
-                        }
-                        else
-                        {
-                                line->plot_style_name = strdup (p0->plot_style_name);
-                        }
+                        line->plot_style_name = p0->plot_style_name;
                         line->color_value = p0->color_value;
                         if (p0->color_name == NULL)
                         {
@@ -4259,7 +3988,7 @@ dxf_3dline_create_from_points
                         }
                         else
                         {
-                                line->color_name = strdup (p0->color_name);
+                                line->color_name = dxf_strdup (p0->color_name);
                         }
                         line->transparency = p0->transparency;
                         break;
@@ -4293,57 +4022,12 @@ dxf_3dline_create_from_points
                         /*! \todo Add graphics_data_size. */
                         line->shadow_mode = p1->shadow_mode;
                         /*! \todo Add binary_graphics_data. */
-                        if (p1->dictionary_owner_soft == NULL)
-                        {
-                                fprintf (stderr,
-                                  (_("Warning in %s () a NULL pointer was found.\n")),
-                                  __FUNCTION__);
-                        }
-                        else
-                        {
-                                line->dictionary_owner_soft = strdup (p1->dictionary_owner_soft);
-                        }
-                        if (p1->object_owner_soft == NULL)
-                        {
-                                fprintf (stderr,
-                                  (_("Warning in %s () a NULL pointer was found.\n")),
-                                  __FUNCTION__);
-                        }
-                        else
-                        {
-                                line->object_owner_soft = strdup (p1->object_owner_soft);
-                        }
-                        if (p1->material == NULL)
-                        {
-                                fprintf (stderr,
-                                  (_("Warning in %s () a NULL pointer was found.\n")),
-                                  __FUNCTION__);
-                        }
-                        else
-                        {
-                                line->material = strdup (p1->material);
-                        }
-                        if (p1->dictionary_owner_hard == NULL)
-                        {
-                                fprintf (stderr,
-                                  (_("Warning in %s () a NULL pointer was found.\n")),
-                                  __FUNCTION__);
-                        }
-                        else
-                        {
-                                line->dictionary_owner_hard = strdup (p1->dictionary_owner_hard);
-                        }
+                        line->dictionary_owner_soft = p1->dictionary_owner_soft;
+                        line->object_owner_soft = p1->object_owner_soft;
+                        line->material = p1->material;
+                        line->dictionary_owner_hard = p1->dictionary_owner_hard;
                         line->lineweight = p1->lineweight;
-                        if (p1->plot_style_name == NULL)
-                        {
-                                fprintf (stderr,
-                                  (_("Warning in %s () a NULL pointer was found.\n")),
-                                  __FUNCTION__);
-                        }
-                        else
-                        {
-                                line->plot_style_name = strdup (p1->plot_style_name);
-                        }
+                        line->plot_style_name = p1->plot_style_name;
                         line->color_value = p1->color_value;
                         if (p1->color_name == NULL)
                         {
@@ -4353,7 +4037,7 @@ dxf_3dline_create_from_points
                         }
                         else
                         {
-                                line->color_name = strdup (p1->color_name);
+                                line->color_name = dxf_strdup (p1->color_name);
                         }
                         line->transparency = p1->transparency;
                         break;
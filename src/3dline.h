@@ -63,7 +63,7 @@ typedef struct
 dxf_3dline_struct
 {
         /* Members common for all DXF drawable entities. */
-        int id_code;
+        uint64_t id_code;
                 /*!< Identification number for the entity.\n
                  * This is to be an unique (sequential) number in the DXF
                  * file.\n
@@ -137,20 +137,20 @@ dxf_3dline_struct
                  * (optional).\n
                  * Group code = 310.\n
                  * \since Introduced in version R2000. */
-        char *dictionary_owner_soft;
+        uint64_t dictionary_owner_soft;
                 /*!< Soft-pointer ID/handle to owner dictionary (optional).\n
                  * Group code = 330.\n
                  * \since Introduced in version R14. */
-        char *object_owner_soft;
+        uint64_t object_owner_soft;
                 /*!< Soft-pointer ID/handle  to owner BLOCK_RECORD object.\n
                  * Group code = 330.\n
                  * \since Introduced in version R2000. */
-        char *material;
+        uint64_t material;
                 /*!< Hard-pointer ID/handle to material object (present if
                  * not BYLAYER).\n
                  * Group code = 347.\n
                  * \since Introduced in version R2008. */
-        char *dictionary_owner_hard;
+        uint64_t dictionary_owner_hard;
                 /*!< Hard owner ID/handle to owner dictionary (optional).\n
                  * Group code = 360.\n
                  * \since Introduced in version R14. */
@@ -159,7 +159,7 @@ dxf_3dline_struct
                  * Stored and moved around as a 16-bit integer.\n
                  * Group code = 370.\n
                  * \since Introduced in version R2002. */
-        char *plot_style_name;
+        uint64_t plot_style_name;
                 /*!< Hard pointer ID / handle of PlotStyleName object.\n
                  * Group code = 390.\n
                  * \since Introduced in version R2009. */
@@ -222,8 +222,8 @@ int dxf_3dline_read (DxfFile *fp, Dxf3dline *line);
 int dxf_3dline_write (DxfFile *fp, Dxf3dline *line);
 int dxf_3dline_free (Dxf3dline *line);
 int dxf_3dline_free_list (Dxf3dline *lines);
-int dxf_3dline_get_id_code (Dxf3dline *line, int *id_code);
-int dxf_3dline_set_id_code (Dxf3dline *line, int id_code);
+int dxf_3dline_get_id_code (Dxf3dline *line, uint64_t *id_code);
+int dxf_3dline_set_id_code (Dxf3dline *line, uint64_t id_code);
 int dxf_3dline_get_linetype (Dxf3dline *line, char *linetype);
 int dxf_3dline_set_linetype (Dxf3dline *line, char *linetype);
 int dxf_3dline_get_layer (Dxf3dline *line, char *layer);
@@ -246,18 +246,18 @@ int dxf_3dline_get_shadow_mode (Dxf3dline *line, int16_t *shadow_mode);
 int dxf_3dline_set_shadow_mode (Dxf3dline *line, int16_t shadow_mode);
 int dxf_3dline_get_binary_graphics_data (Dxf3dline *line, DxfBinaryData *data);
 int dxf_3dline_set_binary_graphics_data (Dxf3dline *line, DxfBinaryData *data);
-int dxf_3dline_get_dictionary_owner_soft (Dxf3dline *line, char *dictionary_owner_soft);
-int dxf_3dline_set_dictionary_owner_soft (Dxf3dline *line, char *dictionary_owner_soft);
-int dxf_3dline_get_object_owner_soft (Dxf3dline *line, char *object_owner_soft);
-int dxf_3dline_set_object_owner_soft (Dxf3dline *line, char *object_owner_soft);
-int dxf_3dline_get_material (Dxf3dline *line, char *material);
-int dxf_3dline_set_material (Dxf3dline *line, char *material);
-int dxf_3dline_get_dictionary_owner_hard (Dxf3dline *line, char *dictionary_owner_hard);
-int dxf_3dline_set_dictionary_owner_hard (Dxf3dline *line, char *dictionary_owner_hard);
+int dxf_3dline_get_dictionary_owner_soft (Dxf3dline *line, uint64_t *dictionary_owner_soft);
+int dxf_3dline_set_dictionary_owner_soft (Dxf3dline *line, uint64_t dictionary_owner_soft);
+int dxf_3dline_get_object_owner_soft (Dxf3dline *line, uint64_t *object_owner_soft);
+int dxf_3dline_set_object_owner_soft (Dxf3dline *line, uint64_t object_owner_soft);
+int dxf_3dline_get_material (Dxf3dline *line, uint64_t *material);
+int dxf_3dline_set_material (Dxf3dline *line, uint64_t material);
+int dxf_3dline_get_dictionary_owner_hard (Dxf3dline *line, uint64_t *dictionary_owner_hard);
+int dxf_3dline_set_dictionary_owner_hard (Dxf3dline *line, uint64_t dictionary_owner_hard);
 int dxf_3dline_get_lineweight (Dxf3dline *line, int16_t *lineweight);
 int dxf_3dline_set_lineweight (Dxf3dline *line, int16_t lineweight);
-int dxf_3dline_get_plot_style_name (Dxf3dline *line, char *plot_style_name);
-int dxf_3dline_set_plot_style_name (Dxf3dline *line, char *plot_style_name);
+int dxf_3dline_get_plot_style_name (Dxf3dline *line, uint64_t *plot_style_name);
+int dxf_3dline_set_plot_style_name (Dxf3dline *line, uint64_t plot_style_name);
 int dxf_3dline_get_color_value (Dxf3dline *line, int32_t *color_value);
 int dxf_3dline_set_color_value (Dxf3dline *line, int32_t color_value);
 int dxf_3dline_get_color_name (Dxf3dline *line, char *color_name);
@@ -289,9 +289,9 @@ int dxf_3dline_set_extr_z0 (Dxf3dline *line, double extr_z0);
 int dxf_3dline_get_extrusion_vector_as_point (Dxf3dline *line, DxfPoint *point);
 int dxf_3dline_set_extrusion_vector_from_point (Dxf3dline *line, DxfPoint *point);
 int dxf_3dline_set_extrusion_vector (Dxf3dline *line, double extr_x0, double extr_y0, double extr_z0);
-int dxf_3dline_get_mid_point (Dxf3dline *line, int id_code, int inheritance, DxfPoint *point);
+int dxf_3dline_get_mid_point (Dxf3dline *line, uint64_t id_code, int inheritance, DxfPoint *point);
 int dxf_3dline_get_length (Dxf3dline *line, double *length);
-int dxf_3dline_create_from_points (DxfPoint *p0, DxfPoint *p1, int id_code, int inheritance, Dxf3dline *line);
+int dxf_3dline_create_from_points (DxfPoint *p0, DxfPoint *p1, uint64_t id_code, int inheritance, Dxf3dline *line);
 int dxf_3dline_get_next (Dxf3dline *line, Dxf3dline *next);
 int dxf_3dline_set_next (Dxf3dline *line, Dxf3dline *next);
 int dxf_3dline_get_last (Dxf3dline *line, Dxf3dline *last);
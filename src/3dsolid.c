@@ -50,6 +50,7 @@
 
 
 #include "3dsolid.h"
+#include "util.h"
 
 
 /*!
@@ -75,7 +76,7 @@ dxf_3dsolid_new
         size = sizeof (Dxf3dsolid);
         /* avoid malloc of 0 bytes */
         if (size == 0) size = 1;
-        if ((solid = malloc (size)) == NULL)
+        if ((solid = dxf_malloc (size)) == NULL)
         {
                 fprintf (stderr,
                   (_("Error in %s () could not allocate memory.\n")),
@@ -126,9 +127,9 @@ dxf_3dsolid_init
                 return (EXIT_FAILURE);
         }
         /* Assign initial values to members. */
-        solid->id_code = 0;
-        solid->linetype = strdup (DXF_DEFAULT_LINETYPE);
-        solid->layer = strdup (DXF_DEFAULT_LAYER);
+        solid->id_code = DXF_HANDLE_NONE;
+        solid->linetype = dxf_strdup (DXF_DEFAULT_LINETYPE);
+        solid->layer = dxf_strdup (DXF_DEFAULT_LAYER);
         solid->elevation = 0.0;
         solid->thickness = 0.0;
         solid->linetype_scale = DXF_DEFAULT_LINETYPE_SCALE;
@@ -137,17 +138,17 @@ dxf_3dsolid_init
         solid->paperspace = DXF_MODELSPACE;
         solid->graphics_data_size = 0;
         solid->shadow_mode = 0;
-        solid->dictionary_owner_soft = strdup ("");
-        solid->object_owner_soft = strdup ("");
-        solid->material = strdup ("");
-        solid->dictionary_owner_hard = strdup ("");
+        solid->dictionary_owner_soft = 0;
+        solid->object_owner_soft = 0;
+        solid->material = 0;
+        solid->dictionary_owner_hard = 0;
         solid->lineweight = 0;
-        solid->plot_style_name = strdup ("");
+        solid->plot_style_name = 0;
         solid->color_value = 0;
-        solid->color_name = strdup ("");
+        solid->color_name = dxf_strdup ("");
         solid->transparency = 0;
         solid->modeler_format_version_number = 1;
-        solid->history = strdup ("");
+        solid->history = dxf_strdup ("");
         /* Initialize new structs for the following members later,
          * when they are required and when we have content. */
         solid->binary_graphics_data = NULL;
@@ -185,7 +186,8 @@ dxf_3dsolid_read
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        char *temp_string = NULL;
+        char temp_string[DXF_MAX_STRING_LENGTH];
+        int group_code;
         DxfBinaryData *iter310 = NULL;
         int iter330;
 
@@ -197,8 +199,6 @@ dxf_3dsolid_read
                 fprintf (stderr,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
-                /* Clean up. */
-                free (temp_string);
                 return (EXIT_FAILURE);
         }
         if (fp->acad_version_number < AutoCAD_13)
@@ -219,253 +219,195 @@ dxf_3dsolid_read
         solid->proprietary_data->order = 0;
         solid->additional_proprietary_data->order = 0;
         iter330 = 0;
-        (fp->line_number)++;
-        fscanf (fp->fp, "%[^\n]", temp_string);
-        while (strcmp (temp_string, "0") != 0)
+        while ((dxf_read_group_code (fp, &group_code) == EXIT_SUCCESS)
+          && (group_code != 0))
         {
-                if (ferror (fp->fp))
+                if (dxf_read_error (fp))
                 {
                         fprintf (stderr,
                           (_("Error in %s () while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
                         /* Clean up. */
-                        free (temp_string);
-                        fclose (fp->fp);
                         return (EXIT_FAILURE);
                 }
-                else if (strcmp (temp_string, "  1") == 0)
-                {
-                        /* Now follows a string containing proprietary
-                         * data. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, solid->proprietary_data->data_line);
-                        solid->proprietary_data->order = i;
-                        i++;
-                        dxf_binary_data_init ((DxfBinaryData *) solid->proprietary_data->next);
-                        solid->proprietary_data = (DxfBinaryData *) solid->proprietary_data->next;
-                }
-                else if (strcmp (temp_string, "  3") == 0)
-                {
-                        /* Now follows a string containing additional
-                         * proprietary data. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, solid->additional_proprietary_data->data_line);
-                        solid->additional_proprietary_data->order = i;
-                        i++;
-                        dxf_binary_data_init ((DxfBinaryData *) solid->additional_proprietary_data->next);
-                        solid->additional_proprietary_data = (DxfBinaryData *) solid->additional_proprietary_data->next;
-                }
-                if (strcmp (temp_string, "5") == 0)
-                {
-                        /* Now follows a string containing a sequential
-                         * id number. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%x\n", (uint *) &solid->id_code);
-                }
-                else if (strcmp (temp_string, "6") == 0)
-                {
-                        /* Now follows a string containing a linetype
-                         * name. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, solid->linetype);
-                }
-                else if (strcmp (temp_string, "8") == 0)
-                {
-                        /* Now follows a string containing a layer name. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, solid->layer);
-                }
-                else if (strcmp (temp_string, "38") == 0)
-                {
-                        /* Now follows a string containing the
-                         * elevation. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &solid->elevation);
-                }
-                else if (strcmp (temp_string, "39") == 0)
-                {
-                        /* Now follows a string containing the
-                         * thickness. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &solid->thickness);
-                }
-                else if (strcmp (temp_string, "48") == 0)
-                {
-                        /* Now follows a string containing the linetype
-                         * scale. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &solid->linetype_scale);
-                }
-                else if (strcmp (temp_string, "60") == 0)
-                {
-                        /* Now follows a string containing the
-                         * visibility value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%hd\n", &solid->visibility);
-                }
-                else if (strcmp (temp_string, "62") == 0)
-                {
-                        /* Now follows a string containing the
-                         * color value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%hd\n", &solid->color);
-                }
-                else if (strcmp (temp_string, "67") == 0)
-                {
-                        /* Now follows a string containing the
-                         * paperspace value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%hd\n", &solid->paperspace);
-                }
-                else if (strcmp (temp_string, "70") == 0)
-                {
-                        /* Now follows a string containing the modeler
-                         * format version number. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%hd\n", &solid->modeler_format_version_number);
-                }
-                else if (strcmp (temp_string, "92") == 0)
+                switch (group_code)
                 {
-                        /* Now follows a string containing the
-                         * graphics data size value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%" PRIi32 "\n", &solid->graphics_data_size);
-                }
-                else if (strcmp (temp_string, "100") == 0)
-                {
-                        /* Now follows a string containing the
-                         * subclass marker value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
-                        if ((strcmp (temp_string, "AcDbModelerGeometry") != 0)
-                          || (strcmp (temp_string, "AcDb3dSolid") != 0))
-                        {
+                        case 1:
+                                /* Now follows a string containing proprietary
+                                 * data. */
+                                dxf_read_string (fp, &solid->proprietary_data->data_line);
+                                solid->proprietary_data->order = i;
+                                i++;
+                                dxf_binary_data_init ((DxfBinaryData *) solid->proprietary_data->next);
+                                solid->proprietary_data = (DxfBinaryData *) solid->proprietary_data->next;
+                                break;
+                        case 3:
+                                /* Now follows a string containing additional
+                                 * proprietary data. */
+                                dxf_read_string (fp, &solid->additional_proprietary_data->data_line);
+                                solid->additional_proprietary_data->order = i;
+                                i++;
+                                dxf_binary_data_init ((DxfBinaryData *) solid->additional_proprietary_data->next);
+                                solid->additional_proprietary_data = (DxfBinaryData *) solid->additional_proprietary_data->next;
+                                break;
+                        case 5:
+                                /* Now follows a string containing a sequential
+                                 * id number. */
+                                dxf_read_handle (fp, &solid->id_code);
+                                break;
+                        case 6:
+                                /* Now follows a string containing a linetype
+                                 * name. */
+                                dxf_read_string_interned (fp, &solid->linetype);
+                                break;
+                        case 8:
+                                /* Now follows a string containing a layer name. */
+                                dxf_read_string_interned (fp, &solid->layer);
+                                break;
+                        case 38:
+                                /* Now follows a string containing the
+                                 * elevation. */
+                                dxf_read_double (fp, &solid->elevation);
+                                break;
+                        case 39:
+                                /* Now follows a string containing the
+                                 * thickness. */
+                                dxf_read_double (fp, &solid->thickness);
+                                break;
+                        case 48:
+                                /* Now follows a string containing the linetype
+                                 * scale. */
+                                dxf_read_double (fp, &solid->linetype_scale);
+                                break;
+                        case 60:
+                                /* Now follows a string containing the
+                                 * visibility value. */
+                                dxf_read_int16 (fp, &solid->visibility);
+                                break;
+                        case 62:
+                                /* Now follows a string containing the
+                                 * color value. */
+                                dxf_read_int16 (fp, &solid->color);
+                                break;
+                        case 67:
+                                /* Now follows a string containing the
+                                 * paperspace value. */
+                                dxf_read_int16 (fp, &solid->paperspace);
+                                break;
+                        case 70:
+                                /* Now follows a string containing the modeler
+                                 * format version number. */
+                                dxf_read_int16 (fp, &solid->modeler_format_version_number);
+                                break;
+                        case 92:
+                                /* Now follows a string containing the
+                                 * graphics data size value. */
+                                dxf_read_int32 (fp, &solid->graphics_data_size);
+                                break;
+                        case 100:
+                                /* Now follows a string containing the
+                                 * subclass marker value. */
+                                dxf_read_line (temp_string, fp);
+                                if ((strcmp (temp_string, "AcDbModelerGeometry") != 0)
+                                  || (strcmp (temp_string, "AcDb3dSolid") != 0))
+                                {
+                                        fprintf (stderr,
+                                          (_("Warning in %s () found a bad subclass marker in: %s in line: %d.\n")),
+                                          __FUNCTION__, fp->filename, fp->line_number);
+                                }
+                                break;
+                        case 160:
+                                /* Now follows a string containing the
+                                 * graphics data size value. */
+                                dxf_read_int32 (fp, &solid->graphics_data_size);
+                                break;
+                        case 284:
+                                /* Now follows a string containing the shadow
+                                 * mode value. */
+                                dxf_read_int16 (fp, &solid->shadow_mode);
+                                break;
+                        case 310:
+                                /* Now follows a string containing binary
+                                 * graphics data. */
+                                iter310 = dxf_binary_data_read (fp, iter310);
+                                break;
+                        case 330:
+                                if (iter330 == 0)
+                                {
+                                        /* Now follows a string containing a soft-pointer
+                                         * ID/handle to owner dictionary. */
+                                        dxf_read_handle (fp, &solid->dictionary_owner_soft);
+                                }
+                                if (iter330 == 1)
+                                {
+                                        /* Now follows a string containing a soft-pointer
+                                         * ID/handle to owner object. */
+                                        dxf_read_handle (fp, &solid->object_owner_soft);
+                                }
+                                iter330++;
+                                break;
+                        case 347:
+                                /* Now follows a string containing a
+                                 * hard-pointer ID/handle to material object. */
+                                dxf_read_handle (fp, &solid->material);
+                                break;
+                        case 350:
+                                /* Now follows a string containing a handle to a
+                                 * history object. */
+                                dxf_read_string (fp, &solid->history);
+                                break;
+                        case 360:
+                                /* Now follows a string containing Hard owner
+                                 * ID/handle to owner dictionary. */
+                                dxf_read_handle (fp, &solid->dictionary_owner_hard);
+                                break;
+                        case 370:
+                                /* Now follows a string containing the lineweight
+                                 * value. */
+                                dxf_read_int16 (fp, &solid->lineweight);
+                                break;
+                        case 390:
+                                /* Now follows a string containing a plot style
+                                 * name value. */
+                                dxf_read_handle (fp, &solid->plot_style_name);
+                                break;
+                        case 420:
+                                /* Now follows a string containing a color value. */
+                                dxf_read_int32 (fp, &solid->color_value);
+                                break;
+                        case 430:
+                                /* Now follows a string containing a color
+                                 * name value. */
+                                dxf_read_string_interned (fp, &solid->color_name);
+                                break;
+                        case 440:
+                                /* Now follows a string containing a transparency
+                                 * value. */
+                                dxf_read_int32 (fp, &solid->transparency);
+                                break;
+                        case 999:
+                                /* Now follows a string containing a comment. */
+                                dxf_read_line (temp_string, fp);
+                                fprintf (stdout, (_("DXF comment: %s\n")), temp_string);
+                                break;
+                        default:
                                 fprintf (stderr,
-                                  (_("Warning in %s () found a bad subclass marker in: %s in line: %d.\n")),
+                                  (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
                                   __FUNCTION__, fp->filename, fp->line_number);
-                        }
-                }
-                else if (strcmp (temp_string, "160") == 0)
-                {
-                        /* Now follows a string containing the
-                         * graphics data size value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%" PRIi32 "\n", &solid->graphics_data_size);
-                }
-                else if (strcmp (temp_string, "284") == 0)
-                {
-                        /* Now follows a string containing the shadow
-                         * mode value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%hd\n", &solid->shadow_mode);
-                }
-                else if (strcmp (temp_string, "310") == 0)
-                {
-                        /* Now follows a string containing binary
-                         * graphics data. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, iter310->data_line);
-                        dxf_binary_data_init ((DxfBinaryData *) iter310->next);
-                        iter310 = (DxfBinaryData *) iter310->next;
-                }
-                else if (strcmp (temp_string, "330") == 0)
-                {
-                        if (iter330 == 0)
-                        {
-                                /* Now follows a string containing a soft-pointer
-                                 * ID/handle to owner dictionary. */
-                                (fp->line_number)++;
-                                fscanf (fp->fp, DXF_MAX_STRING_FORMAT, solid->dictionary_owner_soft);
-                        }
-                        if (iter330 == 1)
-                        {
-                                /* Now follows a string containing a soft-pointer
-                                 * ID/handle to owner object. */
-                                (fp->line_number)++;
-                                fscanf (fp->fp, DXF_MAX_STRING_FORMAT, solid->object_owner_soft);
-                        }
-                        iter330++;
-                }
-                else if (strcmp (temp_string, "347") == 0)
-                {
-                        /* Now follows a string containing a
-                         * hard-pointer ID/handle to material object. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, solid->material);
-                }
-                else if (strcmp (temp_string, "350") == 0)
-                {
-                        /* Now follows a string containing a handle to a
-                         * history object. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, solid->history);
-                }
-                else if (strcmp (temp_string, "360") == 0)
-                {
-                        /* Now follows a string containing Hard owner
-                         * ID/handle to owner dictionary. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, solid->dictionary_owner_hard);
-                }
-                else if (strcmp (temp_string, "370") == 0)
-                {
-                        /* Now follows a string containing the lineweight
-                         * value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%hd\n", &solid->lineweight);
-                }
-                else if (strcmp (temp_string, "390") == 0)
-                {
-                        /* Now follows a string containing a plot style
-                         * name value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, solid->plot_style_name);
-                }
-                else if (strcmp (temp_string, "420") == 0)
-                {
-                        /* Now follows a string containing a color value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%" PRIi32 "\n", &solid->color_value);
-                }
-                else if (strcmp (temp_string, "430") == 0)
-                {
-                        /* Now follows a string containing a color
-                         * name value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, solid->color_name);
-                }
-                else if (strcmp (temp_string, "440") == 0)
-                {
-                        /* Now follows a string containing a transparency
-                         * value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%" PRIi32 "\n", &solid->transparency);
-                }
-                else if (strcmp (temp_string, "999") == 0)
-                {
-                        /* Now follows a string containing a comment. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
-                        fprintf (stdout, (_("DXF comment: %s\n")), temp_string);
-                }
-                else
-                {
-                        fprintf (stderr,
-                          (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
-                          __FUNCTION__, fp->filename, fp->line_number);
+                                /* Skip the value of the unknown group code. */
+                                dxf_read_line (temp_string, fp);
+                                break;
                 }
         }
         /* Handle omitted members and/or illegal values. */
         if (strcmp (solid->linetype, "") == 0)
         {
-                solid->linetype = strdup (DXF_DEFAULT_LINETYPE);
+                solid->linetype = dxf_strdup (DXF_DEFAULT_LINETYPE);
         }
         if (strcmp (solid->layer, "") == 0)
         {
-                solid->layer = strdup (DXF_DEFAULT_LAYER);
+                solid->layer = dxf_strdup (DXF_DEFAULT_LAYER);
         }
-        /* Clean up. */
-        free (temp_string);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -491,7 +433,7 @@ dxf_3dsolid_write
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        char *dxf_entity_name = strdup ("3DSOLID");
+        char *dxf_entity_name = dxf_strdup ("3DSOLID");
         DxfBinaryData *iter = NULL;
         DxfBinaryData *additional_iter = NULL;
         int i;
@@ -503,7 +445,7 @@ dxf_3dsolid_write
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (solid == NULL)
@@ -512,41 +454,41 @@ dxf_3dsolid_write
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (fp->acad_version_number < AutoCAD_13)
         {
                 fprintf (stderr,
-                  (_("Warning in %s () illegal DXF version for this %s entity with id-code: %x.\n")),
+                  (_("Warning in %s () illegal DXF version for this %s entity with id-code: %" PRIx64 ".\n")),
                   __FUNCTION__, dxf_entity_name, solid->id_code);
         }
         if (strcmp (solid->linetype, "") == 0)
         {
                 fprintf (stderr,
-                  (_("Warning in %s () empty linetype string for the %s entity with id-code: %x\n")),
+                  (_("Warning in %s () empty linetype string for the %s entity with id-code: %" PRIx64 "\n")),
                   __FUNCTION__, dxf_entity_name, solid->id_code);
                 fprintf (stderr,
                   (_("\t%s entity is reset to default linetype")),
                   dxf_entity_name);
-                solid->linetype = strdup (DXF_DEFAULT_LINETYPE);
+                solid->linetype = dxf_strdup (DXF_DEFAULT_LINETYPE);
         }
         if (strcmp (solid->layer, "") == 0)
         {
                 fprintf (stderr,
-                  (_("Warning in %s () empty layer string for the %s entity with id-code: %x\n")),
+                  (_("Warning in %s () empty layer string for the %s entity with id-code: %" PRIx64 "\n")),
                   __FUNCTION__, dxf_entity_name, solid->id_code);
                 fprintf (stderr,
                   (_("\t%s entity is relocated to layer 0")),
                   dxf_entity_name);
-                solid->layer = strdup (DXF_DEFAULT_LAYER);
+                solid->layer = dxf_strdup (DXF_DEFAULT_LAYER);
         }
         /* Start writing output. */
         i = 1;
-        fprintf (fp->fp, "  0\n%s\n", dxf_entity_name);
-        if (solid->id_code != -1)
+        dxf_write_string (fp, 0, dxf_entity_name);
+        if (solid->id_code != DXF_HANDLE_NONE)
         {
-                fprintf (fp->fp, "  5\n%x\n", solid->id_code);
+                dxf_write_hex (fp, 5, solid->id_code);
         }
         /*!
          * \todo for version R14.\n
@@ -558,75 +500,75 @@ dxf_3dsolid_write
          * 102 groups are application defined (optional).\n\n
          * End of group, "}" (optional), with Group code 102.
          */
-        if ((strcmp (solid->dictionary_owner_soft, "") != 0)
+        if ((solid->dictionary_owner_soft != 0)
           && (fp->acad_version_number >= AutoCAD_14))
         {
-                fprintf (fp->fp, "102\n{ACAD_REACTORS\n");
-                fprintf (fp->fp, "330\n%s\n", solid->dictionary_owner_soft);
-                fprintf (fp->fp, "102\n}\n");
+                dxf_write_string (fp, 102, "{ACAD_REACTORS");
+                dxf_write_hex (fp, 330, solid->dictionary_owner_soft);
+                dxf_write_string (fp, 102, "}");
         }
-        if ((strcmp (solid->dictionary_owner_hard, "") != 0)
+        if ((solid->dictionary_owner_hard != 0)
           && (fp->acad_version_number >= AutoCAD_14))
         {
-                fprintf (fp->fp, "102\n{ACAD_XDICTIONARY\n");
-                fprintf (fp->fp, "360\n%s\n", solid->dictionary_owner_hard);
-                fprintf (fp->fp, "102\n}\n");
+                dxf_write_string (fp, 102, "{ACAD_XDICTIONARY");
+                dxf_write_hex (fp, 360, solid->dictionary_owner_hard);
+                dxf_write_string (fp, 102, "}");
         }
-        if ((strcmp (solid->object_owner_soft, "") != 0)
+        if ((solid->object_owner_soft != 0)
           && (fp->acad_version_number >= AutoCAD_2000))
         {
-                fprintf (fp->fp, "330\n%s\n", solid->object_owner_soft);
+                dxf_write_hex (fp, 330, solid->object_owner_soft);
         }
         if (fp->acad_version_number >= AutoCAD_13)
         {
-                fprintf (fp->fp, "100\nAcDbEntity\n");
+                dxf_write_string (fp, 100, "AcDbEntity");
         }
         if (solid->paperspace == DXF_PAPERSPACE)
         {
-                fprintf (fp->fp, " 67\n%hd\n", (int16_t) DXF_PAPERSPACE);
+                dxf_write_int (fp, 67, (int16_t) DXF_PAPERSPACE);
         }
-        fprintf (fp->fp, "  8\n%s\n", solid->layer);
+        dxf_write_string (fp, 8, solid->layer);
         if (strcmp (solid->linetype, DXF_DEFAULT_LINETYPE) != 0)
         {
-                fprintf (fp->fp, "  6\n%s\n", solid->linetype);
+                dxf_write_string (fp, 6, solid->linetype);
         }
         if ((fp->acad_version_number >= AutoCAD_2008)
-          && (strcmp (solid->material, "") != 0))
+          && (solid->material != 0))
         {
-                fprintf (fp->fp, "347\n%s\n", solid->material);
+                dxf_write_hex (fp, 347, solid->material);
         }
         if (solid->color != DXF_COLOR_BYLAYER)
         {
-                fprintf (fp->fp, " 62\n%hd\n", solid->color);
+                dxf_write_int (fp, 62, solid->color);
         }
         if (fp->acad_version_number >= AutoCAD_2002)
         {
-                fprintf (fp->fp, "370\n%d\n", solid->lineweight);
+                dxf_write_int (fp, 370, solid->lineweight);
         }
         if ((fp->acad_version_number <= AutoCAD_11)
           && DXF_FLATLAND
           && (solid->elevation != 0.0))
         {
-                fprintf (fp->fp, " 38\n%f\n", solid->elevation);
+                dxf_write_double (fp, 38, solid->elevation);
         }
         if (solid->thickness != 0.0)
         {
-                fprintf (fp->fp, " 39\n%f\n", solid->thickness);
+                dxf_write_double (fp, 39, solid->thickness);
         }
         if (solid->linetype_scale != 1.0)
         {
-                fprintf (fp->fp, " 48\n%f\n", solid->linetype_scale);
+                dxf_write_double (fp, 48, solid->linetype_scale);
         }
         if (solid->visibility != 0)
         {
-                fprintf (fp->fp, " 60\n%hd\n", solid->visibility);
+                dxf_write_int (fp, 60, solid->visibility);
         }
         if (fp->acad_version_number >= AutoCAD_2000)
         {
 #ifdef BUILD_64
-                fprintf (fp->fp, "160\n%" PRIi32 "\n", solid->graphics_data_size);
+                dxf_write_int (fp, 160, solid->graphics_data_size);
 #else
-                fprintf (fp->fp, " 92\n%" PRIi32 "\n", solid->graphics_data_size);
+                dxf_write_int (fp, 92, solid->graphics_data_size);
 #endif
                 if (solid->binary_graphics_data != NULL)
                 {
@@ -634,33 +576,33 @@ dxf_3dsolid_write
                         iter = (DxfBinaryData *) solid->binary_graphics_data;
                         while (iter != NULL)
                         {
-                                fprintf (fp->fp, "310\n%s\n", iter->data_line);
+                                dxf_binary_data_write (fp, iter);
                                 iter = (DxfBinaryData *) iter->next;
                         }
                 }
         }
         if (fp->acad_version_number >= AutoCAD_2004)
         {
-                fprintf (fp->fp, "420\n%" PRIi32 "\n", solid->color_value);
-                fprintf (fp->fp, "430\n%s\n", solid->color_name);
-                fprintf (fp->fp, "440\n%" PRIi32 "\n", solid->transparency);
+                dxf_write_int (fp, 420, solid->color_value);
+                dxf_write_string (fp, 430, solid->color_name);
+                dxf_write_int (fp, 440, solid->transparency);
         }
         if (fp->acad_version_number >= AutoCAD_2009)
         {
-                fprintf (fp->fp, "390\n%s\n", solid->plot_style_name);
-                fprintf (fp->fp, "284\n%d\n", solid->shadow_mode);
+                dxf_write_hex (fp, 390, solid->plot_style_name);
+                dxf_write_int (fp, 284, solid->shadow_mode);
         }
         if (fp->acad_version_number >= AutoCAD_13)
         {
-                fprintf (fp->fp, "100\nAcDbModelerGeometry\n");
+                dxf_write_string (fp, 100, "AcDbModelerGeometry");
         }
         if (fp->acad_version_number >= AutoCAD_2008)
         {
-                fprintf (fp->fp, "100\nAcDb3dSolid\n");
+                dxf_write_string (fp, 100, "AcDb3dSolid");
         }
         if (fp->acad_version_number >= AutoCAD_13)
         {
-                fprintf (fp->fp, " 70\n%hd\n", solid->modeler_format_version_number);
+                dxf_write_int (fp, 70, solid->modeler_format_version_number);
         }
         if ((solid->proprietary_data != NULL) || (solid->additional_proprietary_data != NULL))
         {
@@ -670,13 +612,13 @@ dxf_3dsolid_write
                 {
                         if (iter->order == i)
                         {
-                                fprintf (fp->fp, "  1\n%s\n", iter->data_line);
+                                dxf_write_string (fp, 1, iter->data_line);
                                 iter = (DxfBinaryData *) iter->next;
                                 i++;
                         }
                         if (additional_iter->order == i)
                         {
-                                fprintf (fp->fp, "  3\n%s\n", additional_iter->data_line);
+                                dxf_write_string (fp, 3, additional_iter->data_line);
                                 additional_iter = (DxfBinaryData *) additional_iter->next;
                                 i++;
                         }
@@ -685,15 +627,15 @@ dxf_3dsolid_write
         else
         {
                 fprintf (stderr,
-                  (_("Warning in %s () no proprietary data found in the %s entity with id-code: %x\n")),
+                  (_("Warning in %s () no proprietary data found in the %s entity with id-code: %" PRIx64 "\n")),
                   __FUNCTION__, dxf_entity_name, solid->id_code);
         }
         if (fp->acad_version_number >= AutoCAD_2008)
         {
-                fprintf (fp->fp, "350\n%s\n", solid->history);
+                dxf_write_string (fp, 350, solid->history);
         }
         /* Clean up. */
-        free (dxf_entity_name);
+        dxf_free (dxf_entity_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -734,19 +676,14 @@ dxf_3dsolid_free
                 __FUNCTION__);
               return (EXIT_FAILURE);
         }
-        free (solid->linetype);
-        free (solid->layer);
+        dxf_string_free (solid->linetype);
+        dxf_string_free (solid->layer);
         dxf_binary_data_free_list (solid->binary_graphics_data);
-        free (solid->dictionary_owner_soft);
-        free (solid->object_owner_soft);
-        free (solid->material);
-        free (solid->dictionary_owner_hard);
-        free (solid->plot_style_name);
-        free (solid->color_name);
+        dxf_string_free (solid->color_name);
         dxf_binary_data_free_list (solid->proprietary_data);
         dxf_binary_data_free_list (solid->additional_proprietary_data);
-        free (solid->history);
-        free (solid);
+        dxf_free (solid->history);
+        dxf_free (solid);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -802,7 +739,7 @@ dxf_3dsolid_get_id_code
 (
         Dxf3dsolid *solid,
                 /*!< [in] a pointer to a DXF \c 3DSOLID entity. */
-        int *id_code
+        uint64_t *id_code
                 /*!< [out] a pointer to the Identification number for the
                  * entity.\n
                  * This is to be an unique (sequential) number in the
@@ -820,12 +757,6 @@ dxf_3dsolid_get_id_code
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (solid->id_code < 0)
-        {
-                fprintf (stderr,
-                  (_("Warning in %s () a negative value was found.\n")),
-                  __FUNCTION__);
-        }
         id_code = &solid->id_code;
 #if DEBUG
         DXF_DEBUG_END
@@ -845,7 +776,7 @@ dxf_3dsolid_set_id_code
 (
         Dxf3dsolid *solid,
                 /*!< [in,out] a pointer to a DXF \c 3DSOLID entity. */
-        int id_code
+        uint64_t id_code
                 /*!< [in] Identification number for the entity.\n
                  * This is to be an unique (sequential) number in the DXF
                  * file. */
@@ -862,12 +793,6 @@ dxf_3dsolid_set_id_code
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (id_code < 0)
-        {
-                fprintf (stderr,
-                  (_("Warning in %s () a negative value was passed.\n")),
-                  __FUNCTION__);
-        }
         solid->id_code = id_code;
 #if DEBUG
         DXF_DEBUG_END
@@ -917,7 +842,7 @@ dxf_3dsolid_get_linetype
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        linetype = strdup (solid->linetype);
+        linetype = dxf_strdup (solid->linetype);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -961,7 +886,7 @@ dxf_3dsolid_set_linetype
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        solid->linetype = strdup (linetype);
+        solid->linetype = dxf_strdup (linetype);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1009,7 +934,7 @@ dxf_3dsolid_get_layer
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        layer = strdup (solid->layer);
+        layer = dxf_strdup (solid->layer);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1050,7 +975,7 @@ dxf_3dsolid_set_layer
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        solid->layer = strdup (layer);
+        solid->layer = dxf_strdup (layer);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1803,10 +1728,8 @@ dxf_3dsolid_set_binary_graphics_data
  * \c 3DSOLID entity.
  *
  * \return soft pointer to the dictionary owner.
- *
- * \warning No checks are performed on the returned pointer (string).
  */
-char *
+uint64_t
 dxf_3dsolid_get_dictionary_owner_soft
 (
         Dxf3dsolid *solid
@@ -1822,19 +1745,12 @@ dxf_3dsolid_get_dictionary_owner_soft
                 fprintf (stderr,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
-                return (NULL);
-        }
-        if (solid->dictionary_owner_soft ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
+                return (0);
         }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (solid->dictionary_owner_soft));
+        return (solid->dictionary_owner_soft);
 }
 
 
@@ -1847,8 +1763,8 @@ dxf_3dsolid_set_dictionary_owner_soft
 (
         Dxf3dsolid *solid,
                 /*!< a pointer to a DXF \c 3DSOLID entity. */
-        char *dictionary_owner_soft
-                /*!< a string containing the pointer to the
+        uint64_t dictionary_owner_soft
+                /*!< the handle of the
                  * dictionary_owner_soft for the entity. */
 )
 {
@@ -1863,14 +1779,7 @@ dxf_3dsolid_set_dictionary_owner_soft
                   __FUNCTION__);
                 return (NULL);
         }
-        if (dictionary_owner_soft == NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was passed.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
-        solid->dictionary_owner_soft = strdup (dictionary_owner_soft);
+        solid->dictionary_owner_soft = dictionary_owner_soft;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1883,10 +1792,8 @@ dxf_3dsolid_set_dictionary_owner_soft
  * \c 3DSOLID entity.
  *
  * \return soft pointer to the object owner.
- *
- * \warning No checks are performed on the returned pointer (string).
  */
-char *
+uint64_t
 dxf_3dsolid_get_object_owner_soft
 (
         Dxf3dsolid *solid
@@ -1902,19 +1809,12 @@ dxf_3dsolid_get_object_owner_soft
                 fprintf (stderr,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
-                return (NULL);
-        }
-        if (solid->object_owner_soft ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
+                return (0);
         }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (solid->object_owner_soft));
+        return (solid->object_owner_soft);
 }
 
 
@@ -1927,8 +1827,8 @@ dxf_3dsolid_set_object_owner_soft
 (
         Dxf3dsolid *solid,
                 /*!< a pointer to a DXF \c 3DSOLID entity. */
-        char *object_owner_soft
-                /*!< a string containing the pointer to the
+        uint64_t object_owner_soft
+                /*!< the handle of the
                  * \c object_owner_soft for the entity. */
 )
 {
@@ -1943,14 +1843,7 @@ dxf_3dsolid_set_object_owner_soft
                   __FUNCTION__);
                 return (NULL);
         }
-        if (object_owner_soft == NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was passed.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
-        solid->object_owner_soft = strdup (object_owner_soft);
+        solid->object_owner_soft = object_owner_soft;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1962,12 +1855,10 @@ dxf_3dsolid_set_object_owner_soft
  * \brief Get the pointer to the \c material from a DXF \c 3DSOLID
  * entity.
  *
- * \return a pointer to \c material when successful, or \c NULL when an
+ * \return the handle \c material when successful, or 0 when an
  * error occurred.
- *
- * \warning No checks are performed on the returned pointer.
  */
-char *
+uint64_t
 dxf_3dsolid_get_material
 (
         Dxf3dsolid *solid
@@ -1983,19 +1874,12 @@ dxf_3dsolid_get_material
                 fprintf (stderr,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
-                return (NULL);
-        }
-        if (solid->material ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
+                return (0);
         }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (solid->material));
+        return (solid->material);
 }
 
 
@@ -2010,8 +1894,8 @@ dxf_3dsolid_set_material
 (
         Dxf3dsolid *solid,
                 /*!< a pointer to a DXF \c 3DSOLID entity. */
-        char *material
-                /*!< a string containing the pointer to the \c
+        uint64_t material
+                /*!< the handle of the \c
                  * material for the entity. */
 )
 {
@@ -2026,14 +1910,7 @@ dxf_3dsolid_set_material
                   __FUNCTION__);
                 return (NULL);
         }
-        if (material == NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was passed.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
-        solid->material = strdup (material);
+        solid->material = material;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2046,10 +1923,8 @@ dxf_3dsolid_set_material
  * \c 3DSOLID entity.
  *
  * \return hard pointer to the dictionary owner.
- *
- * \warning No checks are performed on the returned pointer (string).
  */
-char *
+uint64_t
 dxf_3dsolid_get_dictionary_owner_hard
 (
         Dxf3dsolid *solid
@@ -2065,19 +1940,12 @@ dxf_3dsolid_get_dictionary_owner_hard
                 fprintf (stderr,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
-                return (NULL);
-        }
-        if (solid->dictionary_owner_hard ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
+                return (0);
         }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (solid->dictionary_owner_hard));
+        return (solid->dictionary_owner_hard);
 }
 
 
@@ -2090,8 +1958,8 @@ dxf_3dsolid_set_dictionary_owner_hard
 (
         Dxf3dsolid *solid,
                 /*!< a pointer to a DXF \c 3DSOLID entity. */
-        char *dictionary_owner_hard
-                /*!< a string containing the pointer to the \c
+        uint64_t dictionary_owner_hard
+                /*!< the handle of the \c
                  * dictionary_owner_hard for the entity. */
 )
 {
@@ -2106,14 +1974,7 @@ dxf_3dsolid_set_dictionary_owner_hard
                   __FUNCTION__);
                 return (NULL);
         }
-        if (dictionary_owner_hard == NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was passed.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
-        solid->dictionary_owner_hard = strdup (dictionary_owner_hard);
+        solid->dictionary_owner_hard = dictionary_owner_hard;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2189,10 +2050,10 @@ dxf_3dsolid_set_lineweight
 /*!
  * \brief Get the \c plot_style_name from a DXF \c 3DSOLID entity.
  *
- * \return \c plot_style_name when sucessful, or \c NULL when an error
+ * \return \c plot_style_name when sucessful, or 0 when an error
  * occurred.
  */
-char *
+uint64_t
 dxf_3dsolid_get_plot_style_name
 (
         Dxf3dsolid *solid
@@ -2208,19 +2069,12 @@ dxf_3dsolid_get_plot_style_name
                 fprintf (stderr,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
-                return (NULL);
-        }
-        if (solid->plot_style_name ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
+                return (0);
         }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (solid->plot_style_name));
+        return (solid->plot_style_name);
 }
 
 
@@ -2235,7 +2089,7 @@ dxf_3dsolid_set_plot_style_name
 (
         Dxf3dsolid *solid,
                 /*!< a pointer to a DXF \c 3DSOLID entity. */
-        char *plot_style_name
+        uint64_t plot_style_name
                 /*!< a string containing the \c plot_style_name for the
                  * entity. */
 )
@@ -2251,14 +2105,7 @@ dxf_3dsolid_set_plot_style_name
                   __FUNCTION__);
                 return (NULL);
         }
-        if (plot_style_name == NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was passed.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
-        solid->plot_style_name = strdup (plot_style_name);
+        solid->plot_style_name = plot_style_name;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2365,7 +2212,7 @@ dxf_3dsolid_get_color_name
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (solid->color_name));
+        return (dxf_strdup (solid->color_name));
 }
 
 
@@ -2403,7 +2250,7 @@ dxf_3dsolid_set_color_name
                   __FUNCTION__);
                 return (NULL);
         }
-        solid->color_name = strdup (color_name);
+        solid->color_name = dxf_strdup (color_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2786,7 +2633,7 @@ dxf_3dsolid_get_history
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (solid->history));
+        return (dxf_strdup (solid->history));
 }
 
 
@@ -2820,7 +2667,7 @@ dxf_3dsolid_set_history
                   __FUNCTION__);
                 return (NULL);
         }
-        solid->history = strdup (history);
+        solid->history = dxf_strdup (history);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -61,7 +61,7 @@ typedef struct
 dxf_3dsolid_struct
 {
         /* Members common for all DXF drawable entities. */
-        int id_code;
+        uint64_t id_code;
                 /*!< Identification number for the entity.\n
                  * This is to be an unique (sequential) number in the DXF
                  * file.\n
@@ -134,20 +134,20 @@ dxf_3dsolid_struct
                  * (optional).\n
                  * Group code = 310.\n
                  * \since Introduced in version R2000. */
-        char *dictionary_owner_soft;
+        uint64_t dictionary_owner_soft;
                 /*!< Soft-pointer ID/handle to owner dictionary (optional).\n
                  * Group code = 330.\n
                  * \since Introduced in version R14. */
-        char *object_owner_soft;
+        uint64_t object_owner_soft;
                 /*!< Soft-pointer ID/handle  to owner BLOCK_RECORD object.\n
                  * Group code = 330.\n
                  * \since Introduced in version R2000. */
-        char *material;
+        uint64_t material;
                 /*!< Hard-pointer ID/handle to material object (present if
                  * not BYLAYER).\n
                  * Group code = 347.\n
                  * \since Introduced in version R2008. */
-        char *dictionary_owner_hard;
+        uint64_t dictionary_owner_hard;
                 /*!< Hard owner ID/handle to owner dictionary (optional).\n
                  * Group code = 360.\n
                  * \since Introduced in version R14. */
@@ -156,7 +156,7 @@ dxf_3dsolid_struct
                  * Stored and moved around as a 16-bit integer.\n
                  * Group code = 370.\n
                  * \since Introduced in version R2002. */
-        char *plot_style_name;
+        uint64_t plot_style_name;
                 /*!< Hard pointer ID / handle of PlotStyleName object.\n
                  * Group code = 390.\n
                  * \since Introduced in version R2009. */
@@ -217,8 +217,8 @@ int dxf_3dsolid_read (DxfFile *fp, Dxf3dsolid *solid);
 int dxf_3dsolid_write (DxfFile *fp, Dxf3dsolid *solid);
 int dxf_3dsolid_free (Dxf3dsolid *solid);
 int dxf_3dsolid_free_list (Dxf3dsolid *solids);
-int dxf_3dsolid_get_id_code (Dxf3dsolid *solid, int *id_code);
-int dxf_3dsolid_set_id_code (Dxf3dsolid *solid, int id_code);
+int dxf_3dsolid_get_id_code (Dxf3dsolid *solid, uint64_t *id_code);
+int dxf_3dsolid_set_id_code (Dxf3dsolid *solid, uint64_t id_code);
 int dxf_3dsolid_get_linetype (Dxf3dsolid *solid, char *linetype);
 int dxf_3dsolid_set_linetype (Dxf3dsolid *solid, char *linetype);
 int dxf_3dsolid_get_layer (Dxf3dsolid *solid, char *layer);
@@ -241,18 +241,18 @@ int16_t dxf_3dsolid_get_shadow_mode (Dxf3dsolid *solid);
 Dxf3dsolid *dxf_3dsolid_set_shadow_mode (Dxf3dsolid *solid, int16_t shadow_mode);
 DxfBinaryData *dxf_3dsolid_get_binary_graphics_data (Dxf3dsolid *solid);
 Dxf3dsolid *dxf_3dsolid_set_binary_graphics_data (Dxf3dsolid *solid, DxfBinaryData *data);
-char *dxf_3dsolid_get_dictionary_owner_soft (Dxf3dsolid *solid);
-Dxf3dsolid *dxf_3dsolid_set_dictionary_owner_soft (Dxf3dsolid *solid, char *dictionary_owner_soft);
-char *dxf_3dsolid_get_object_owner_soft (Dxf3dsolid *solid);
-Dxf3dsolid *dxf_3dsolid_set_object_owner_soft (Dxf3dsolid *solid, char *object_owner_soft);
-char *dxf_3dsolid_get_material (Dxf3dsolid *solid);
-Dxf3dsolid *dxf_3dsolid_set_material (Dxf3dsolid *solid, char *material);
-char *dxf_3dsolid_get_dictionary_owner_hard (Dxf3dsolid *solid);
-Dxf3dsolid *dxf_3dsolid_set_dictionary_owner_hard (Dxf3dsolid *solid, char *dictionary_owner_hard);
+uint64_t dxf_3dsolid_get_dictionary_owner_soft (Dxf3dsolid *solid);
+Dxf3dsolid *dxf_3dsolid_set_dictionary_owner_soft (Dxf3dsolid *solid, uint64_t dictionary_owner_soft);
+uint64_t dxf_3dsolid_get_object_owner_soft (Dxf3dsolid *solid);
+Dxf3dsolid *dxf_3dsolid_set_object_owner_soft (Dxf3dsolid *solid, uint64_t object_owner_soft);
+uint64_t dxf_3dsolid_get_material (Dxf3dsolid *solid);
+Dxf3dsolid *dxf_3dsolid_set_material (Dxf3dsolid *solid, uint64_t material);
+uint64_t dxf_3dsolid_get_dictionary_owner_hard (Dxf3dsolid *solid);
+Dxf3dsolid *dxf_3dsolid_set_dictionary_owner_hard (Dxf3dsolid *solid, uint64_t dictionary_owner_hard);
 int16_t dxf_3dsolid_get_lineweight (Dxf3dsolid *solid);
 Dxf3dsolid *dxf_3dsolid_set_lineweight (Dxf3dsolid *solid, int16_t lineweight);
-char *dxf_3dsolid_get_plot_style_name (Dxf3dsolid *solid);
-Dxf3dsolid *dxf_3dsolid_set_plot_style_name (Dxf3dsolid *solid, char *plot_style_name);
+uint64_t dxf_3dsolid_get_plot_style_name (Dxf3dsolid *solid);
+Dxf3dsolid *dxf_3dsolid_set_plot_style_name (Dxf3dsolid *solid, uint64_t plot_style_name);
 int32_t dxf_3dsolid_get_color_value (Dxf3dsolid *solid);
 Dxf3dsolid *dxf_3dsolid_set_color_value (Dxf3dsolid *solid, int32_t color_value);
 char *dxf_3dsolid_get_color_name (Dxf3dsolid *solid);
@@ -53,6 +53,7 @@
 
 
 #include "acad_proxy_entity.h"
+#include "util.h"
 
 
 /*!
@@ -75,7 +76,7 @@ dxf_acad_proxy_entity_new ()
         size = sizeof (DxfAcadProxyEntity);
         /* avoid malloc of 0 bytes */
         if (size == 0) size = 1;
-        if ((acad_proxy_entity = malloc (size)) == NULL)
+        if ((acad_proxy_entity = dxf_malloc (size)) == NULL)
         {
                 fprintf (stderr,
                   (_("Error in %s () could not allocate memory.\n")),
@@ -126,9 +127,9 @@ dxf_acad_proxy_entity_init
                 return (NULL);
         }
         /* Assign initial values to members. */
-        acad_proxy_entity->id_code = 0;
-        acad_proxy_entity->linetype = strdup (DXF_DEFAULT_LINETYPE);
-        acad_proxy_entity->layer = strdup (DXF_DEFAULT_LAYER);
+        acad_proxy_entity->id_code = DXF_HANDLE_NONE;
+        acad_proxy_entity->linetype = dxf_strdup (DXF_DEFAULT_LINETYPE);
+        acad_proxy_entity->layer = dxf_strdup (DXF_DEFAULT_LAYER);
         acad_proxy_entity->elevation = 0.0;
         acad_proxy_entity->thickness = 0.0;
         acad_proxy_entity->linetype_scale = DXF_DEFAULT_LINETYPE_SCALE;
@@ -136,14 +137,14 @@ dxf_acad_proxy_entity_init
         acad_proxy_entity->color = DXF_COLOR_BYLAYER;
         acad_proxy_entity->paperspace = DXF_PAPERSPACE;
         acad_proxy_entity->shadow_mode = 0;
-        acad_proxy_entity->dictionary_owner_soft = strdup ("");
-        acad_proxy_entity->object_owner_soft = strdup ("");
-        acad_proxy_entity->material = strdup ("");
-        acad_proxy_entity->dictionary_owner_hard = strdup ("");
+        acad_proxy_entity->dictionary_owner_soft = 0;
+        acad_proxy_entity->object_owner_soft = 0;
+        acad_proxy_entity->material = 0;
+        acad_proxy_entity->dictionary_owner_hard = 0;
         acad_proxy_entity->lineweight = 0;
-        acad_proxy_entity->plot_style_name = strdup ("");
+        acad_proxy_entity->plot_style_name = 0;
         acad_proxy_entity->color_value = 0;
-        acad_proxy_entity->color_name = strdup ("");
+        acad_proxy_entity->color_name = dxf_strdup ("");
         acad_proxy_entity->transparency = 0;
         acad_proxy_entity->original_custom_object_data_format = 1;
         acad_proxy_entity->proxy_entity_class_id = DXF_DEFAULT_PROXY_ENTITY_ID;
@@ -151,8 +152,9 @@ dxf_acad_proxy_entity_init
         acad_proxy_entity->graphics_data_size = 0;
         acad_proxy_entity->entity_data_size = 0;
         acad_proxy_entity->object_drawing_format = 0;
+        acad_proxy_entity->object_id = dxf_object_id_init (dxf_object_id_new ());
         acad_proxy_entity->object_id->group_code = 0;
-        acad_proxy_entity->object_id->data = strdup ("");
+        acad_proxy_entity->object_id->data = dxf_strdup ("");
         acad_proxy_entity->object_id->length = 0;
         /* Initialize new structs for the following members later,
          * when they are required and when we have content. */
@@ -191,9 +193,11 @@ dxf_acad_proxy_entity_read
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        char *temp_string = NULL;
+        char temp_string[DXF_MAX_STRING_LENGTH];
+        int group_code;
         DxfBinaryData *iter310 = NULL;
         int iter330;
+        int32_t object_drawing_format;
         int i; /* flags whether group code 330, 340, 350 or 360 has been
                 * parsed for a first time. */
 
@@ -203,8 +207,6 @@ dxf_acad_proxy_entity_read
                 fprintf (stderr,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
-                /* Clean up. */
-                free (temp_string);
                 return (NULL);
         }
         if (fp->acad_version_number < AutoCAD_13)
@@ -255,86 +257,74 @@ dxf_acad_proxy_entity_read
         iter310 = (DxfBinaryData *) acad_proxy_entity->binary_graphics_data;
         iter330 = 0;
         i = 0;
-        (fp->line_number)++;
-        fscanf (fp->fp, "%[^\n]", temp_string);
-        while (strcmp (temp_string, "0") != 0)
+        while ((dxf_read_group_code (fp, &group_code) == EXIT_SUCCESS)
+          && (group_code != 0))
         {
-                if (ferror (fp->fp))
+                if (dxf_read_error (fp))
                 {
                         fprintf (stderr,
                           (_("Error in %s () while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
                         /* Clean up. */
-                        free (temp_string);
-                        fclose (fp->fp);
                         return (NULL);
                 }
-                else if (strcmp (temp_string, "5") == 0)
+                if (group_code == 5)
                 {
                         /* Now follows a string containing a sequential
                          * id number. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%x\n", (uint *) &acad_proxy_entity->id_code);
+                        dxf_read_handle (fp, &acad_proxy_entity->id_code);
                 }
-                else if (strcmp (temp_string, "6") == 0)
+                else if (group_code == 6)
                 {
                         /* Now follows a string containing the linetype
                          * name. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, acad_proxy_entity->linetype);
+                        dxf_read_string_interned (fp, &acad_proxy_entity->linetype);
                 }
-                else if (strcmp (temp_string, "8") == 0)
+                else if (group_code == 8)
                 {
                         /* Now follows a string containing the layer
                          * name. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, acad_proxy_entity->layer);
+                        dxf_read_string_interned (fp, &acad_proxy_entity->layer);
                 }
                 else if ((fp->acad_version_number <= AutoCAD_11)
                   && DXF_FLATLAND
-                  && (strcmp (temp_string, "38") == 0)
+                  && (group_code == 38)
                   && (acad_proxy_entity->elevation != 0.0))
                 {
                         /* Now follows a string containing the
                          * elevation. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &acad_proxy_entity->elevation);
+                        dxf_read_double (fp, &acad_proxy_entity->elevation);
                 }
-                else if (strcmp (temp_string, "39") == 0)
+                else if (group_code == 39)
                 {
                         /* Now follows a string containing the
                          * thickness. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &acad_proxy_entity->thickness);
+                        dxf_read_double (fp, &acad_proxy_entity->thickness);
                 }
-                else if (strcmp (temp_string, "48") == 0)
+                else if (group_code == 48)
                 {
                         /* Now follows a string containing the linetype
                          * scale value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &acad_proxy_entity->linetype_scale);
+                        dxf_read_double (fp, &acad_proxy_entity->linetype_scale);
                 }
-                else if (strcmp (temp_string, "60") == 0)
+                else if (group_code == 60)
                 {
                         /* Now follows a string containing the object
                          * visability value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%hd\n", &acad_proxy_entity->visibility);
+                        dxf_read_int16 (fp, &acad_proxy_entity->visibility);
                 }
-                else if (strcmp (temp_string, "62") == 0)
+                else if (group_code == 62)
                 {
                         /* Now follows a string containing the
                          * color value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%hd\n", &acad_proxy_entity->color);
+                        dxf_read_int16 (fp, &acad_proxy_entity->color);
                 }
                 else if ((fp->acad_version_number >= AutoCAD_2000)
-                  && (strcmp (temp_string, "70") == 0))
+                  && (group_code == 70))
                 {
                         /* Now follows a string containing the original
                          * custom object data format value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%hd\n", &acad_proxy_entity->original_custom_object_data_format);
+                        dxf_read_int16 (fp, &acad_proxy_entity->original_custom_object_data_format);
                         if (acad_proxy_entity->original_custom_object_data_format != 1)
                         {
                                 fprintf (stderr,
@@ -342,12 +332,11 @@ dxf_acad_proxy_entity_read
                                   __FUNCTION__, fp->filename, fp->line_number);
                         }
                 }
-                else if (strcmp (temp_string, "90") == 0)
+                else if (group_code == 90)
                 {
                         /* Now follows a string containing the proxy
                          * entity ID value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%" PRIi32 "\n", &acad_proxy_entity->proxy_entity_class_id);
+                        dxf_read_int32 (fp, &acad_proxy_entity->proxy_entity_class_id);
                         if (acad_proxy_entity->proxy_entity_class_id != DXF_DEFAULT_PROXY_ENTITY_ID)
                         {
                                 fprintf (stderr,
@@ -355,12 +344,11 @@ dxf_acad_proxy_entity_read
                                   __FUNCTION__, fp->filename, fp->line_number);
                         }
                 }
-                else if (strcmp (temp_string, "91") == 0)
+                else if (group_code == 91)
                 {
                         /* Now follows a string containing the application
                          * entity ID value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%" PRIi32 "\n", &acad_proxy_entity->application_entity_class_id);
+                        dxf_read_int32 (fp, &acad_proxy_entity->application_entity_class_id);
                         if (acad_proxy_entity->application_entity_class_id < 500)
                         {
                                 fprintf (stderr,
@@ -368,35 +356,32 @@ dxf_acad_proxy_entity_read
                                   __FUNCTION__, fp->filename, fp->line_number);
                         }
                 }
-                else if (strcmp (temp_string, "92") == 0)
+                else if (group_code == 92)
                 {
                         /* Now follows a string containing the graphics
                          * data size value (bytes). */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%" PRIi32 "\n", &acad_proxy_entity->graphics_data_size);
+                        dxf_read_int32 (fp, &acad_proxy_entity->graphics_data_size);
                 }
-                else if (strcmp (temp_string, "93") == 0)
+                else if (group_code == 93)
                 {
                         /* Now follows a string containing the entity
                          * data size value (bits). */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%" PRIi32 "\n", &acad_proxy_entity->entity_data_size);
+                        dxf_read_int32 (fp, &acad_proxy_entity->entity_data_size);
                 }
                 else if ((fp->acad_version_number >= AutoCAD_2000)
-                  && (strcmp (temp_string, "95") == 0))
+                  && (group_code == 95))
                 {
                         /* Now follows a string containing the object
                          * drawing format value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%" PRIi32 "\n", &acad_proxy_entity->object_drawing_format);
+                        dxf_read_int32 (fp, &object_drawing_format);
+                        acad_proxy_entity->object_drawing_format = (uint32_t) object_drawing_format;
                 }
                 else if ((fp->acad_version_number >= AutoCAD_13)
-                  && (strcmp (temp_string, "100") == 0))
+                  && (group_code == 100))
                 {
                         /* Now follows a string containing the
                          * subclass marker value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
+                        dxf_read_line (temp_string, fp);
                         if ((strcmp (temp_string, "AcDbEntity") != 0)
                           && ((strcmp (temp_string, "AcDbZombieEntity") != 0))
                           && ((strcmp (temp_string, "AcDbProxyEntity") != 0)))
@@ -406,51 +391,44 @@ dxf_acad_proxy_entity_read
                                   __FUNCTION__, fp->filename, fp->line_number);
                         }
                 }
-                else if (strcmp (temp_string, "284") == 0)
+                else if (group_code == 284)
                 {
                         /* Now follows a string containing the shadow
                          * mode value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%hd\n", &acad_proxy_entity->shadow_mode);
+                        dxf_read_int16 (fp, &acad_proxy_entity->shadow_mode);
                 }
-                else if (strcmp (temp_string, "310") == 0)
+                else if (group_code == 310)
                 {
                         /* Now follows a string containing binary
                          * graphics data. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, iter310->data_line);
-                        dxf_binary_data_init ((DxfBinaryData *) iter310->next);
-                        iter310 = (DxfBinaryData *) iter310->next;
+                        iter310 = dxf_binary_data_read (fp, iter310);
                 }
-                else if (strcmp (temp_string, "330") == 0)
+                else if (group_code == 330)
                 {
                         if (iter330 == 0)
                         {
                                 /* Now follows a string containing a soft-pointer
                                  * ID/handle to owner dictionary. */
-                                (fp->line_number)++;
-                                fscanf (fp->fp, DXF_MAX_STRING_FORMAT, acad_proxy_entity->dictionary_owner_soft);
+                                dxf_read_handle (fp, &acad_proxy_entity->dictionary_owner_soft);
                         }
                         if (iter330 == 1)
                         {
                                 /* Now follows a string containing a soft-pointer
                                  * ID/handle to owner object. */
-                                (fp->line_number)++;
-                                fscanf (fp->fp, DXF_MAX_STRING_FORMAT, acad_proxy_entity->object_owner_soft);
+                                dxf_read_handle (fp, &acad_proxy_entity->object_owner_soft);
                         }
                         iter330++;
                 }
-                else if ((strcmp (temp_string, "330") == 0)
-                  || (strcmp (temp_string, "340") == 0)
-                  || (strcmp (temp_string, "350") == 0)
-                  || (strcmp (temp_string, "360") == 0))
+                else if ((group_code == 330)
+                  || (group_code == 340)
+                  || (group_code == 350)
+                  || (group_code == 360))
                 {
                         if (!i) /* For the very first object_id. */
                         {
                                 dxf_object_id_set_group_code (acad_proxy_entity->object_id, atoi (temp_string));
                                 /* Now follows a string containing an object id line of data. */
-                                (fp->line_number)++;
-                                fscanf (fp->fp, DXF_MAX_STRING_FORMAT, acad_proxy_entity->object_id->data);
+                                dxf_read_string (fp, &acad_proxy_entity->object_id->data);
                         }
                         else /* For following object_id's. */
                         {
@@ -458,64 +436,55 @@ dxf_acad_proxy_entity_read
                                 iter = dxf_object_id_init ((DxfObjectId *) iter->next);
                                 dxf_object_id_set_group_code (iter, atoi (temp_string));
                                 /* Now follows a string containing an object id line of data. */
-                                (fp->line_number)++;
-                                fscanf (fp->fp, DXF_MAX_STRING_FORMAT, iter->data);
+                                dxf_read_string (fp, &iter->data);
                         }
                         i++;
                 }
-                else if (strcmp (temp_string, "347") == 0)
+                else if (group_code == 347)
                 {
                         /* Now follows a string containing a
                          * hard-pointer ID/handle to material object. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, acad_proxy_entity->material);
+                        dxf_read_handle (fp, &acad_proxy_entity->material);
                 }
-                else if (strcmp (temp_string, "360") == 0)
+                else if (group_code == 360)
                 {
                         /* Now follows a string containing Hard owner
                          * ID/handle to owner dictionary. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, acad_proxy_entity->dictionary_owner_hard);
+                        dxf_read_handle (fp, &acad_proxy_entity->dictionary_owner_hard);
                 }
-                else if (strcmp (temp_string, "370") == 0)
+                else if (group_code == 370)
                 {
                         /* Now follows a string containing the lineweight
                          * value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%hd\n", &acad_proxy_entity->lineweight);
+                        dxf_read_int16 (fp, &acad_proxy_entity->lineweight);
                 }
-                else if (strcmp (temp_string, "390") == 0)
+                else if (group_code == 390)
                 {
                         /* Now follows a string containing a plot style
                          * name value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, acad_proxy_entity->plot_style_name);
+                        dxf_read_handle (fp, &acad_proxy_entity->plot_style_name);
                 }
-                else if (strcmp (temp_string, "420") == 0)
+                else if (group_code == 420)
                 {
                         /* Now follows a string containing a color value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%" PRIi32 "\n", &acad_proxy_entity->color_value);
+                        dxf_read_int32 (fp, &acad_proxy_entity->color_value);
                 }
-                else if (strcmp (temp_string, "430") == 0)
+                else if (group_code == 430)
                 {
                         /* Now follows a string containing a color
                          * name value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, acad_proxy_entity->color_name);
+                        dxf_read_string_interned (fp, &acad_proxy_entity->color_name);
                 }
-                else if (strcmp (temp_string, "440") == 0)
+                else if (group_code == 440)
                 {
                         /* Now follows a string containing a transparency
                          * value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%" PRIi32 "\n", &acad_proxy_entity->transparency);
+                        dxf_read_int32 (fp, &acad_proxy_entity->transparency);
                 }
-                else if (strcmp (temp_string, "999") == 0)
+                else if (group_code == 999)
                 {
                         /* Now follows a string containing a comment. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
+                        dxf_read_line (temp_string, fp);
                         fprintf (stdout, "DXF comment: %s\n", temp_string);
                 }
                 else
@@ -523,10 +492,10 @@ dxf_acad_proxy_entity_read
                         fprintf (stderr,
                           (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
+                        /* Skip the value of the unknown group code. */
+                        dxf_read_line (temp_string, fp);
                 }
         }
-        /* Clean up. */
-        free (temp_string);
 #if DEBUG
         fprintf (stderr,
           (_("Information from %s() read %d object_id's from %s.\n")),
@@ -564,7 +533,7 @@ dxf_acad_proxy_entity_write
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (acad_proxy_entity == NULL)
@@ -573,7 +542,7 @@ dxf_acad_proxy_entity_write
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (fp->acad_version_number < AutoCAD_13)
@@ -584,7 +553,7 @@ dxf_acad_proxy_entity_write
                           (_("Error in %s () illegal DXF version for this entity.\n")),
                           __FUNCTION__);
                         fprintf (stderr,
-                          (_("\t entity %s with ID code %d is omitted from output.\n")),
+                          (_("\t entity %s with ID code %" PRIx64 " is omitted from output.\n")),
                           dxf_entity_name, acad_proxy_entity->id_code);
                         return (EXIT_FAILURE);
                 }
@@ -597,38 +566,38 @@ dxf_acad_proxy_entity_write
         }
         if (fp->acad_version_number <= AutoCAD_13)
         {
-                dxf_entity_name = strdup ("ACAD_ZOMBIE_ENTITY");
+                dxf_entity_name = dxf_strdup ("ACAD_ZOMBIE_ENTITY");
         }
         else if (fp->acad_version_number >= AutoCAD_14)
         {
-                dxf_entity_name = strdup ("ACAD_PROXY_ENTITY");
+                dxf_entity_name = dxf_strdup ("ACAD_PROXY_ENTITY");
         }
         if ((strcmp (acad_proxy_entity->layer, "") == 0)
           || (acad_proxy_entity->layer == NULL))
         {
                 fprintf (stderr,
-                  (_("Warning in %s () invalid layer string for the %s entity with id-code: %x\n")),
+                  (_("Warning in %s () invalid layer string for the %s entity with id-code: %" PRIx64 "\n")),
                   __FUNCTION__, dxf_entity_name, acad_proxy_entity->id_code);
                 fprintf (stderr,
                   (_("    %s entity is relocated to layer 0\n")),
                   dxf_entity_name);
-                acad_proxy_entity->layer = strdup (DXF_DEFAULT_LAYER);
+                acad_proxy_entity->layer = dxf_strdup (DXF_DEFAULT_LAYER);
         }
         if (acad_proxy_entity->linetype == NULL)
         {
                 fprintf (stderr,
-                  (_("Warning in %s () invalid linetype string for the %s entity with id-code: %x\n")),
+                  (_("Warning in %s () invalid linetype string for the %s entity with id-code: %" PRIx64 "\n")),
                   __FUNCTION__, dxf_entity_name, acad_proxy_entity->id_code);
                 fprintf (stderr,
                   (_("\t%s linetype is set to %s\n")),
                   dxf_entity_name, DXF_DEFAULT_LINETYPE);
-                acad_proxy_entity->linetype = strdup(DXF_DEFAULT_LINETYPE);
+                acad_proxy_entity->linetype = dxf_strdup (DXF_DEFAULT_LINETYPE);
         }
         /* Start writing output. */
-        fprintf (fp->fp, "  0\n%s\n", dxf_entity_name);
-        if (acad_proxy_entity->id_code != -1)
+        dxf_write_string (fp, 0, dxf_entity_name);
+        if (acad_proxy_entity->id_code != DXF_HANDLE_NONE)
         {
-                fprintf (fp->fp, "  5\n%x\n", acad_proxy_entity->id_code);
+                dxf_write_hex (fp, 5, acad_proxy_entity->id_code);
         }
         /*!
          * \todo for version R14.\n
@@ -640,95 +609,95 @@ dxf_acad_proxy_entity_write
          * 102 groups are application defined (optional).\n\n
          * End of group, "}" (optional), with Group code 102.
          */
-        if ((strcmp (acad_proxy_entity->dictionary_owner_soft, "") != 0)
+        if ((acad_proxy_entity->dictionary_owner_soft != 0)
           && (fp->acad_version_number >= AutoCAD_14))
         {
-                fprintf (fp->fp, "102\n{ACAD_REACTORS\n");
-                fprintf (fp->fp, "330\n%s\n", acad_proxy_entity->dictionary_owner_soft);
-                fprintf (fp->fp, "102\n}\n");
+                dxf_write_string (fp, 102, "{ACAD_REACTORS");
+                dxf_write_hex (fp, 330, acad_proxy_entity->dictionary_owner_soft);
+                dxf_write_string (fp, 102, "}");
         }
-        if ((strcmp (acad_proxy_entity->dictionary_owner_hard, "") != 0)
+        if ((acad_proxy_entity->dictionary_owner_hard != 0)
           && (fp->acad_version_number >= AutoCAD_14))
         {
-                fprintf (fp->fp, "102\n{ACAD_XDICTIONARY\n");
-                fprintf (fp->fp, "360\n%s\n", acad_proxy_entity->dictionary_owner_hard);
-                fprintf (fp->fp, "102\n}\n");
+                dxf_write_string (fp, 102, "{ACAD_XDICTIONARY");
+                dxf_write_hex (fp, 360, acad_proxy_entity->dictionary_owner_hard);
+                dxf_write_string (fp, 102, "}");
         }
-        if ((strcmp (acad_proxy_entity->object_owner_soft, "") != 0)
+        if ((acad_proxy_entity->object_owner_soft != 0)
           && (fp->acad_version_number >= AutoCAD_2000))
         {
-                fprintf (fp->fp, "330\n%s\n", acad_proxy_entity->object_owner_soft);
+                dxf_write_hex (fp, 330, acad_proxy_entity->object_owner_soft);
         }
         if (fp->acad_version_number >= AutoCAD_13)
         {
-                fprintf (fp->fp, "100\nAcDbEntity\n");
+                dxf_write_string (fp, 100, "AcDbEntity");
         }
         if (acad_proxy_entity->paperspace == DXF_PAPERSPACE)
         {
-                fprintf (fp->fp, " 67\n%hd\n", (int16_t) DXF_PAPERSPACE);
+                dxf_write_int (fp, 67, (int16_t) DXF_PAPERSPACE);
         }
-        fprintf (fp->fp, "  8\n%s\n", acad_proxy_entity->layer);
+        dxf_write_string (fp, 8, acad_proxy_entity->layer);
         if (strcmp (acad_proxy_entity->linetype, DXF_DEFAULT_LINETYPE) != 0)
         {
-                fprintf (fp->fp, "  6\n%s\n", acad_proxy_entity->linetype);
+                dxf_write_string (fp, 6, acad_proxy_entity->linetype);
         }
         if ((fp->acad_version_number >= AutoCAD_2008)
-          && (strcmp (acad_proxy_entity->material, "") != 0))
+          && (acad_proxy_entity->material != 0))
         {
-                fprintf (fp->fp, "347\n%s\n", acad_proxy_entity->material);
+                dxf_write_hex (fp, 347, acad_proxy_entity->material);
         }
         if (acad_proxy_entity->color != DXF_COLOR_BYLAYER)
         {
-                fprintf (fp->fp, " 62\n%hd\n", acad_proxy_entity->color);
+                dxf_write_int (fp, 62, acad_proxy_entity->color);
         }
         if (fp->acad_version_number >= AutoCAD_2002)
         {
-                fprintf (fp->fp, "370\n%d\n", acad_proxy_entity->lineweight);
+                dxf_write_int (fp, 370, acad_proxy_entity->lineweight);
         }
         if ((fp->acad_version_number <= AutoCAD_11)
           && DXF_FLATLAND
           && (acad_proxy_entity->elevation != 0.0))
         {
-                fprintf (fp->fp, " 38\n%f\n", acad_proxy_entity->elevation);
+                dxf_write_double (fp, 38, acad_proxy_entity->elevation);
         }
         if ((fp->acad_version_number <= AutoCAD_13)
           && (acad_proxy_entity->thickness != 0.0))
         {
-                fprintf (fp->fp, " 39\n%f\n", acad_proxy_entity->thickness);
+                dxf_write_double (fp, 39, acad_proxy_entity->thickness);
         }
-        fprintf (fp->fp, " 48\n%f\n", acad_proxy_entity->linetype_scale);
-        fprintf (fp->fp, " 60\n%hd\n", acad_proxy_entity->visibility);
+        dxf_write_double (fp, 48, acad_proxy_entity->linetype_scale);
+        dxf_write_int (fp, 60, acad_proxy_entity->visibility);
         if (fp->acad_version_number >= AutoCAD_2004)
         {
-                fprintf (fp->fp, "420\n%" PRIi32 "\n", acad_proxy_entity->color_value);
-                fprintf (fp->fp, "430\n%s\n", acad_proxy_entity->color_name);
-                fprintf (fp->fp, "440\n%" PRIi32 "\n", acad_proxy_entity->transparency);
+                dxf_write_int (fp, 420, acad_proxy_entity->color_value);
+                dxf_write_string (fp, 430, acad_proxy_entity->color_name);
+                dxf_write_int (fp, 440, acad_proxy_entity->transparency);
         }
         if (fp->acad_version_number >= AutoCAD_2009)
         {
-                fprintf (fp->fp, "390\n%s\n", acad_proxy_entity->plot_style_name);
-                fprintf (fp->fp, "284\n%d\n", acad_proxy_entity->shadow_mode);
+                dxf_write_hex (fp, 390, acad_proxy_entity->plot_style_name);
+                dxf_write_int (fp, 284, acad_proxy_entity->shadow_mode);
         }
         if (fp->acad_version_number == AutoCAD_13)
         {
-                fprintf (fp->fp, "100\nAcDbZombieEntity\n");
+                dxf_write_string (fp, 100, "AcDbZombieEntity");
         }
         if (fp->acad_version_number >= AutoCAD_14)
         {
-                fprintf (fp->fp, "100\nAcDbProxyEntity\n");
+                dxf_write_string (fp, 100, "AcDbProxyEntity");
         }
         if (fp->acad_version_number >= AutoCAD_2000)
         {
-                fprintf (fp->fp, " 70\n%hd\n", acad_proxy_entity->original_custom_object_data_format);
+                dxf_write_int (fp, 70, acad_proxy_entity->original_custom_object_data_format);
         }
-        fprintf (fp->fp, " 90\n%" PRIi32 "\n", acad_proxy_entity->proxy_entity_class_id);
-        fprintf (fp->fp, " 91\n%" PRIi32 "\n", acad_proxy_entity->application_entity_class_id);
+        dxf_write_int (fp, 90, acad_proxy_entity->proxy_entity_class_id);
+        dxf_write_int (fp, 91, acad_proxy_entity->application_entity_class_id);
         if (fp->acad_version_number >= AutoCAD_14)
         {
 #ifdef BUILD_64
-                fprintf (fp->fp, "160\n%" PRIi32 "\n", acad_proxy_entity->graphics_data_size);
+                dxf_write_int (fp, 160, acad_proxy_entity->graphics_data_size);
 #else
-                fprintf (fp->fp, " 92\n%" PRIi32 "\n", acad_proxy_entity->graphics_data_size);
+                dxf_write_int (fp, 92, acad_proxy_entity->graphics_data_size);
 #endif
                 if (acad_proxy_entity->binary_graphics_data != NULL)
                 {
@@ -736,18 +705,18 @@ dxf_acad_proxy_entity_write
                         iter310a = (DxfBinaryData *) acad_proxy_entity->binary_graphics_data;
                         while (iter310a != NULL)
                         {
-                                fprintf (fp->fp, "310\n%s\n", iter310a->data_line);
+                                dxf_binary_data_write (fp, iter310a);
                                 iter310a = (DxfBinaryData *) iter310a->next;
                         }
                 }
-                fprintf (fp->fp, " 93\n%" PRIi32 "\n", acad_proxy_entity->entity_data_size);
+                dxf_write_int (fp, 93, acad_proxy_entity->entity_data_size);
                 if (acad_proxy_entity->binary_entity_data != NULL)
                 {
                         DxfBinaryData *iter310b;
                         iter310b = (DxfBinaryData *) acad_proxy_entity->binary_entity_data;
                         while (iter310b != NULL)
                         {
-                                fprintf (fp->fp, "310\n%s\n", iter310b->data_line);
+                                dxf_binary_data_write (fp, iter310b);
                                 iter310b = (DxfBinaryData *) iter310b->next;
                         }
                 }
@@ -756,20 +725,20 @@ dxf_acad_proxy_entity_write
         iter330 = (DxfObjectId *) acad_proxy_entity->object_id;
         while (iter330)
         {
-                fprintf (fp->fp, "330\n%s\n", iter330->data);
+                dxf_write_string (fp, 330, iter330->data);
                 iter330 = (DxfObjectId *) iter330->next;
         }
-        fprintf (fp->fp, " 94\n  0\n");
+        dxf_write_string (fp, 94, "  0");
         if (fp->acad_version_number >= AutoCAD_2000)
         {
-                fprintf (fp->fp, " 95\n%" PRIi32 "\n", acad_proxy_entity->object_drawing_format);
+                dxf_write_int (fp, 95, acad_proxy_entity->object_drawing_format);
         }
         if (fp->acad_version_number >= AutoCAD_2000)
         {
-                fprintf (fp->fp, " 70\n%hd\n", acad_proxy_entity->original_custom_object_data_format);
+                dxf_write_int (fp, 70, acad_proxy_entity->original_custom_object_data_format);
         }
         /* Clean up. */
-        free (dxf_entity_name);
+        dxf_free (dxf_entity_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -809,18 +778,13 @@ dxf_acad_proxy_entity_free
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        free (acad_proxy_entity->linetype);
-        free (acad_proxy_entity->layer);
-        free (acad_proxy_entity->dictionary_owner_soft);
-        free (acad_proxy_entity->object_owner_soft);
-        free (acad_proxy_entity->material);
-        free (acad_proxy_entity->dictionary_owner_hard);
-        free (acad_proxy_entity->plot_style_name);
-        free (acad_proxy_entity->color_name);
+        dxf_string_free (acad_proxy_entity->linetype);
+        dxf_string_free (acad_proxy_entity->layer);
+        dxf_string_free (acad_proxy_entity->color_name);
         dxf_binary_data_free_list (acad_proxy_entity->binary_graphics_data);
         dxf_binary_data_free_list (acad_proxy_entity->binary_entity_data);
         dxf_object_id_free_list (acad_proxy_entity->object_id);
-        free (acad_proxy_entity);
+        dxf_free (acad_proxy_entity);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -866,7 +830,7 @@ dxf_acad_proxy_entity_free_list
  *
  * \return ID code.
  */
-int
+uint64_t
 dxf_acad_proxy_entity_get_id_code
 (
         DxfAcadProxyEntity *acad_proxy_entity
@@ -884,12 +848,6 @@ dxf_acad_proxy_entity_get_id_code
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (acad_proxy_entity->id_code < 0)
-        {
-                fprintf (stderr,
-                  (_("Warning in %s () a negative value was found.\n")),
-                  __FUNCTION__);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -905,7 +863,7 @@ dxf_acad_proxy_entity_set_id_code
 (
         DxfAcadProxyEntity *acad_proxy_entity,
                 /*!< a pointer to a DXF \c ACAD_PROXY_ENTITY entity. */
-        int id_code
+        uint64_t id_code
                 /*!< Identification number for the entity.\n
                  * This is to be an unique (sequential) number in the DXF
                  * file. */
@@ -922,12 +880,6 @@ dxf_acad_proxy_entity_set_id_code
                   __FUNCTION__);
                 return (NULL);
         }
-        if (id_code < 0)
-        {
-                fprintf (stderr,
-                  (_("Warning in %s () a negative value was passed.\n")),
-                  __FUNCTION__);
-        }
         acad_proxy_entity->id_code = id_code;
 #if DEBUG
         DXF_DEBUG_END
@@ -969,7 +921,7 @@ dxf_acad_proxy_entity_get_linetype
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (acad_proxy_entity->linetype));
+        return (dxf_strdup (acad_proxy_entity->linetype));
 }
 
 
@@ -1003,7 +955,7 @@ dxf_acad_proxy_entity_set_linetype
                   __FUNCTION__);
                 return (NULL);
         }
-        acad_proxy_entity->linetype = strdup (linetype);
+        acad_proxy_entity->linetype = dxf_strdup (linetype);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1044,7 +996,7 @@ dxf_acad_proxy_entity_get_layer
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (acad_proxy_entity->layer));
+        return (dxf_strdup (acad_proxy_entity->layer));
 }
 
 
@@ -1078,7 +1030,7 @@ dxf_acad_proxy_entity_set_layer
                   __FUNCTION__);
                 return (NULL);
         }
-        acad_proxy_entity->layer = strdup (layer);
+        acad_proxy_entity->layer = dxf_strdup (layer);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1639,10 +1591,8 @@ dxf_acad_proxy_entity_set_shadow_mode
  * \c ACAD_PROXY_ENTITY entity.
  *
  * \return soft pointer to the dictionary owner.
- *
- * \warning No checks are performed on the returned pointer (string).
  */
-char *
+uint64_t
 dxf_acad_proxy_entity_get_dictionary_owner_soft
 (
         DxfAcadProxyEntity *acad_proxy_entity
@@ -1658,19 +1608,12 @@ dxf_acad_proxy_entity_get_dictionary_owner_soft
                 fprintf (stderr,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
-                return (NULL);
-        }
-        if (acad_proxy_entity->dictionary_owner_soft ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
+                return (0);
         }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (acad_proxy_entity->dictionary_owner_soft));
+        return (acad_proxy_entity->dictionary_owner_soft);
 }
 
 
@@ -1683,8 +1626,8 @@ dxf_acad_proxy_entity_set_dictionary_owner_soft
 (
         DxfAcadProxyEntity *acad_proxy_entity,
                 /*!< a pointer to a DXF \c ACAD_PROXY_ENTITY entity. */
-        char *dictionary_owner_soft
-                /*!< a string containing the pointer to the
+        uint64_t dictionary_owner_soft
+                /*!< the handle of the
                  * dictionary_owner_soft for the entity. */
 )
 {
@@ -1699,14 +1642,7 @@ dxf_acad_proxy_entity_set_dictionary_owner_soft
                   __FUNCTION__);
                 return (NULL);
         }
-        if (dictionary_owner_soft == NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was passed.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
-        acad_proxy_entity->dictionary_owner_soft = strdup (dictionary_owner_soft);
+        acad_proxy_entity->dictionary_owner_soft = dictionary_owner_soft;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1719,10 +1655,8 @@ dxf_acad_proxy_entity_set_dictionary_owner_soft
  * \c ACAD_PROXY_ENTITY entity.
  *
  * \return soft pointer to the object owner.
- *
- * \warning No checks are performed on the returned pointer (string).
  */
-char *
+uint64_t
 dxf_acad_proxy_entity_get_object_owner_soft
 (
         DxfAcadProxyEntity *acad_proxy_entity
@@ -1738,19 +1672,12 @@ dxf_acad_proxy_entity_get_object_owner_soft
                 fprintf (stderr,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
-                return (NULL);
-        }
-        if (acad_proxy_entity->object_owner_soft ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
+                return (0);
         }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (acad_proxy_entity->object_owner_soft));
+        return (acad_proxy_entity->object_owner_soft);
 }
 
 
@@ -1763,8 +1690,8 @@ dxf_acad_proxy_entity_set_object_owner_soft
 (
         DxfAcadProxyEntity *acad_proxy_entity,
                 /*!< a pointer to a DXF \c ACAD_PROXY_ENTITY entity. */
-        char *object_owner_soft
-                /*!< a string containing the pointer to the
+        uint64_t object_owner_soft
+                /*!< the handle of the
                  * \c object_owner_soft for the entity. */
 )
 {
@@ -1779,14 +1706,7 @@ dxf_acad_proxy_entity_set_object_owner_soft
                   __FUNCTION__);
                 return (NULL);
         }
-        if (object_owner_soft == NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was passed.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
-        acad_proxy_entity->object_owner_soft = strdup (object_owner_soft);
+        acad_proxy_entity->object_owner_soft = object_owner_soft;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1797,12 +1717,10 @@ dxf_acad_proxy_entity_set_object_owner_soft
 /*!
  * \brief Get the pointer to the \c material from a DXF \c ACAD_PROXY_ENTITY entity.
  *
- * \return a pointer to \c material when successful, or \c NULL when an
+ * \return the handle \c material when successful, or 0 when an
  * error occurred.
- *
- * \warning No checks are performed on the returned pointer.
  */
-char *
+uint64_t
 dxf_acad_proxy_entity_get_material
 (
         DxfAcadProxyEntity *acad_proxy_entity
@@ -1818,19 +1736,12 @@ dxf_acad_proxy_entity_get_material
                 fprintf (stderr,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
-                return (NULL);
-        }
-        if (acad_proxy_entity->material ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
+                return (0);
         }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (acad_proxy_entity->material));
+        return (acad_proxy_entity->material);
 }
 
 
@@ -1846,8 +1757,8 @@ dxf_acad_proxy_entity_set_material
 (
         DxfAcadProxyEntity *acad_proxy_entity,
                 /*!< a pointer to a DXF \c ACAD_PROXY_ENTITY entity. */
-        char *material
-                /*!< a string containing the pointer to the \c
+        uint64_t material
+                /*!< the handle of the \c
                  * material for the entity. */
 )
 {
@@ -1862,14 +1773,7 @@ dxf_acad_proxy_entity_set_material
                   __FUNCTION__);
                 return (NULL);
         }
-        if (material == NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was passed.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
-        acad_proxy_entity->material = strdup (material);
+        acad_proxy_entity->material = material;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1882,10 +1786,8 @@ dxf_acad_proxy_entity_set_material
  * \c ACAD_PROXY_ENTITY entity.
  *
  * \return hard pointer to the dictionary owner.
- *
- * \warning No checks are performed on the returned pointer (string).
  */
-char *
+uint64_t
 dxf_acad_proxy_entity_get_dictionary_owner_hard
 (
         DxfAcadProxyEntity *acad_proxy_entity
@@ -1901,19 +1803,12 @@ dxf_acad_proxy_entity_get_dictionary_owner_hard
                 fprintf (stderr,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
-                return (NULL);
-        }
-        if (acad_proxy_entity->dictionary_owner_hard ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
+                return (0);
         }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (acad_proxy_entity->dictionary_owner_hard));
+        return (acad_proxy_entity->dictionary_owner_hard);
 }
 
 
@@ -1926,8 +1821,8 @@ dxf_acad_proxy_entity_set_dictionary_owner_hard
 (
         DxfAcadProxyEntity *acad_proxy_entity,
                 /*!< a pointer to a DXF \c ACAD_PROXY_ENTITY entity. */
-        char *dictionary_owner_hard
-                /*!< a string containing the pointer to the
+        uint64_t dictionary_owner_hard
+                /*!< the handle of the
                  * dictionary_owner_hard for the entity. */
 )
 {
@@ -1942,14 +1837,7 @@ dxf_acad_proxy_entity_set_dictionary_owner_hard
                   __FUNCTION__);
                 return (NULL);
         }
-        if (dictionary_owner_hard == NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was passed.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
-        acad_proxy_entity->dictionary_owner_hard = strdup (dictionary_owner_hard);
+        acad_proxy_entity->dictionary_owner_hard = dictionary_owner_hard;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2026,10 +1914,10 @@ dxf_acad_proxy_entity_set_lineweight
  * \brief Get the \c plot_style_name from a DXF \c ACAD_PROXY_ENTITY
  * entity.
  *
- * \return a pointer to \c plot_style_name when sucessful, or \c NULL
+ * \return the handle \c plot_style_name when sucessful, or 0
  * when an error occurred.
  */
-char *
+uint64_t
 dxf_acad_proxy_entity_get_plot_style_name
 (
         DxfAcadProxyEntity *acad_proxy_entity
@@ -2045,19 +1933,12 @@ dxf_acad_proxy_entity_get_plot_style_name
                 fprintf (stderr,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
-                return (NULL);
-        }
-        if (acad_proxy_entity->plot_style_name ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
+                return (0);
         }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (acad_proxy_entity->plot_style_name));
+        return (acad_proxy_entity->plot_style_name);
 }
 
 
@@ -2072,7 +1953,7 @@ dxf_acad_proxy_entity_set_plot_style_name
 (
         DxfAcadProxyEntity *acad_proxy_entity,
                 /*!< a pointer to a DXF \c ACAD_PROXY_ENTITY entity. */
-        char *plot_style_name
+        uint64_t plot_style_name
                 /*!< a string containing the \c plot_style_name for the
                  * entity. */
 )
@@ -2088,14 +1969,7 @@ dxf_acad_proxy_entity_set_plot_style_name
                   __FUNCTION__);
                 return (NULL);
         }
-        if (plot_style_name == NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was passed.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
-        acad_proxy_entity->plot_style_name = strdup (plot_style_name);
+        acad_proxy_entity->plot_style_name = plot_style_name;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2202,7 +2076,7 @@ dxf_acad_proxy_entity_get_color_name
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (acad_proxy_entity->color_name));
+        return (dxf_strdup (acad_proxy_entity->color_name));
 }
 
 
@@ -2240,7 +2114,7 @@ dxf_acad_proxy_entity_set_color_name
                   __FUNCTION__);
                 return (NULL);
         }
-        acad_proxy_entity->color_name = strdup (color_name);
+        acad_proxy_entity->color_name = dxf_strdup (color_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
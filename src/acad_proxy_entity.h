@@ -68,7 +68,7 @@ typedef struct
 dxf_acad_proxy_entity_struct
 {
         /* Members common for all DXF drawable entities. */
-        int id_code;
+        uint64_t id_code;
                 /*!< Identification number for the entity.\n
                  * This is to be an unique (sequential) number in the DXF
                  * file.\n
@@ -126,20 +126,20 @@ dxf_acad_proxy_entity_struct
                  * </ol>\n
                  * Group code = 284.\n
                  * \since Introduced in version R2009. */
-        char *dictionary_owner_soft;
+        uint64_t dictionary_owner_soft;
                 /*!< Soft-pointer ID/handle to owner dictionary (optional).\n
                  * Group code = 330.\n
                  * \since Introduced in version R14. */
-        char *object_owner_soft;
+        uint64_t object_owner_soft;
                 /*!< Soft-pointer ID/handle  to owner BLOCK_RECORD object.\n
                  * Group code = 330.\n
                  * \since Introduced in version R2000. */
-        char *material;
+        uint64_t material;
                 /*!< Hard-pointer ID/handle to material object (present if
                  * not BYLAYER).\n
                  * Group code = 347.\n
                  * \since Introduced in version R2008. */
-        char *dictionary_owner_hard;
+        uint64_t dictionary_owner_hard;
                 /*!< Hard owner ID/handle to owner dictionary (optional).\n
                  * Group code = 360.\n
                  * \since Introduced in version R14. */
@@ -148,7 +148,7 @@ dxf_acad_proxy_entity_struct
                  * Stored and moved around as a 16-bit integer.\n
                  * Group code = 370.\n
                  * \since Introduced in version R2002. */
-        char *plot_style_name;
+        uint64_t plot_style_name;
                 /*!< Hard pointer ID / handle of PlotStyleName object.\n
                  * Group code = 390.\n
                  * \since Introduced in version R2009. */
@@ -242,8 +242,8 @@ DxfAcadProxyEntity *dxf_acad_proxy_entity_read (DxfFile *fp, DxfAcadProxyEntity
 int dxf_acad_proxy_entity_write (DxfFile *fp, DxfAcadProxyEntity *acad_proxy_entity);
 int dxf_acad_proxy_entity_free (DxfAcadProxyEntity *acad_proxy_entity);
 void dxf_acad_proxy_entity_free_list (DxfAcadProxyEntity *acad_proxy_entities);
-int dxf_acad_proxy_entity_get_id_code (DxfAcadProxyEntity *acad_proxy_entity);
-DxfAcadProxyEntity *dxf_acad_proxy_entity_set_id_code (DxfAcadProxyEntity *acad_proxy_entity, int id_code);
+uint64_t dxf_acad_proxy_entity_get_id_code (DxfAcadProxyEntity *acad_proxy_entity);
+DxfAcadProxyEntity *dxf_acad_proxy_entity_set_id_code (DxfAcadProxyEntity *acad_proxy_entity, uint64_t id_code);
 char *dxf_acad_proxy_entity_get_linetype (DxfAcadProxyEntity *acad_proxy_entity);
 DxfAcadProxyEntity *dxf_acad_proxy_entity_set_linetype (DxfAcadProxyEntity *acad_proxy_entity, char *linetype);
 char *dxf_acad_proxy_entity_get_layer (DxfAcadProxyEntity *acad_proxy_entity);
@@ -262,18 +262,18 @@ int16_t dxf_acad_proxy_entity_get_paperspace (DxfAcadProxyEntity *acad_proxy_ent
 DxfAcadProxyEntity *dxf_acad_proxy_entity_set_paperspace (DxfAcadProxyEntity *acad_proxy_entity, int16_t paperspace);
 int16_t dxf_acad_proxy_entity_get_shadow_mode (DxfAcadProxyEntity *acad_proxy_entity);
 DxfAcadProxyEntity *dxf_acad_proxy_entity_set_shadow_mode (DxfAcadProxyEntity *acad_proxy_entity, int16_t shadow_mode);
-char *dxf_acad_proxy_entity_get_dictionary_owner_soft (DxfAcadProxyEntity *acad_proxy_entity);
-DxfAcadProxyEntity *dxf_acad_proxy_entity_set_dictionary_owner_soft (DxfAcadProxyEntity *acad_proxy_entity, char *dictionary_owner_soft);
-char *dxf_acad_proxy_entity_get_object_owner_soft (DxfAcadProxyEntity *acad_proxy_entity);
-DxfAcadProxyEntity *dxf_acad_proxy_entity_set_object_owner_soft (DxfAcadProxyEntity *acad_proxy_entity, char *object_owner_soft);
-char *dxf_acad_proxy_entity_get_material (DxfAcadProxyEntity *acad_proxy_entity);
-DxfAcadProxyEntity *dxf_acad_proxy_entity_set_material (DxfAcadProxyEntity *acad_proxy_entity, char *material);
-char *dxf_acad_proxy_entity_get_dictionary_owner_hard (DxfAcadProxyEntity *acad_proxy_entity);
-DxfAcadProxyEntity *dxf_acad_proxy_entity_set_dictionary_owner_hard (DxfAcadProxyEntity *acad_proxy_entity, char *dictionary_owner_hard);
+uint64_t dxf_acad_proxy_entity_get_dictionary_owner_soft (DxfAcadProxyEntity *acad_proxy_entity);
+DxfAcadProxyEntity *dxf_acad_proxy_entity_set_dictionary_owner_soft (DxfAcadProxyEntity *acad_proxy_entity, uint64_t dictionary_owner_soft);
+uint64_t dxf_acad_proxy_entity_get_object_owner_soft (DxfAcadProxyEntity *acad_proxy_entity);
+DxfAcadProxyEntity *dxf_acad_proxy_entity_set_object_owner_soft (DxfAcadProxyEntity *acad_proxy_entity, uint64_t object_owner_soft);
+uint64_t dxf_acad_proxy_entity_get_material (DxfAcadProxyEntity *acad_proxy_entity);
+DxfAcadProxyEntity *dxf_acad_proxy_entity_set_material (DxfAcadProxyEntity *acad_proxy_entity, uint64_t material);
+uint64_t dxf_acad_proxy_entity_get_dictionary_owner_hard (DxfAcadProxyEntity *acad_proxy_entity);
+DxfAcadProxyEntity *dxf_acad_proxy_entity_set_dictionary_owner_hard (DxfAcadProxyEntity *acad_proxy_entity, uint64_t dictionary_owner_hard);
 int16_t dxf_acad_proxy_entity_get_lineweight (DxfAcadProxyEntity *acad_proxy_entity);
 DxfAcadProxyEntity *dxf_acad_proxy_entity_set_lineweight (DxfAcadProxyEntity *acad_proxy_entity, int16_t lineweight);
-char *dxf_acad_proxy_entity_get_plot_style_name (DxfAcadProxyEntity *acad_proxy_entity);
-DxfAcadProxyEntity *dxf_acad_proxy_entity_set_plot_style_name (DxfAcadProxyEntity *acad_proxy_entity, char *plot_style_name);
+uint64_t dxf_acad_proxy_entity_get_plot_style_name (DxfAcadProxyEntity *acad_proxy_entity);
+DxfAcadProxyEntity *dxf_acad_proxy_entity_set_plot_style_name (DxfAcadProxyEntity *acad_proxy_entity, uint64_t plot_style_name);
 int32_t dxf_acad_proxy_entity_get_color_value (DxfAcadProxyEntity *acad_proxy_entity);
 DxfAcadProxyEntity *dxf_acad_proxy_entity_set_color_value (DxfAcadProxyEntity *acad_proxy_entity, int32_t color_value);
 char *dxf_acad_proxy_entity_get_color_name (DxfAcadProxyEntity *acad_proxy_entity);
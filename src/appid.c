@@ -57,6 +57,7 @@
 
 
 #include "appid.h"
+#include "util.h"
 
 
 /*!
@@ -76,7 +77,7 @@ dxf_appid_new ()
         size = sizeof (DxfAppid);
         /* avoid malloc of 0 bytes */
         if (size == 0) size = 1;
-        if ((appid = malloc (size)) == NULL)
+        if ((appid = dxf_malloc (size)) == NULL)
         {
                 fprintf (stderr,
                   (_("Error in %s () could not allocate memory.\n")),
@@ -126,12 +127,12 @@ dxf_appid_init
                   __FUNCTION__);
                 return (NULL);
         }
-        appid->id_code = 0;
-        appid->application_name = strdup ("");
+        appid->id_code = DXF_HANDLE_NONE;
+        appid->application_name = dxf_strdup ("");
         appid->flag = 0;
-        appid->dictionary_owner_soft = strdup ("");
-        appid->object_owner_soft = strdup ("");
-        appid->dictionary_owner_hard = strdup ("");
+        appid->dictionary_owner_soft = 0;
+        appid->object_owner_soft = 0;
+        appid->dictionary_owner_hard = 0;
         appid->next = NULL;
 #if DEBUG
         DXF_DEBUG_END
@@ -164,7 +165,8 @@ dxf_appid_read
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        char *temp_string = NULL;
+        char temp_string[DXF_MAX_STRING_LENGTH];
+        int group_code;
         int iter330;
 
         /* Do some basic checks. */
@@ -173,8 +175,6 @@ dxf_appid_read
                 fprintf (stderr,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
-                /* Clean up. */
-                free (temp_string);
                 return (NULL);
         }
         if (appid == NULL)
@@ -185,82 +185,67 @@ dxf_appid_read
                 appid = dxf_appid_init (appid);
         }
         iter330 = 0;
-        (fp->line_number)++;
-        fscanf (fp->fp, "%[^\n]", temp_string);
-        while (strcmp (temp_string, "0") != 0)
+        while ((dxf_read_group_code (fp, &group_code) == EXIT_SUCCESS)
+          && (group_code != 0))
         {
-                if (ferror (fp->fp))
+                if (dxf_read_error (fp))
                 {
                         fprintf (stderr,
                           (_("Error in %s () while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
-                        fclose (fp->fp);
-                        /* Clean up. */
-                        free (temp_string);
                         return (NULL);
                 }
-                if (strcmp (temp_string, "5") == 0)
-                {
-                        /* Now follows a string containing a sequential
-                         * id number. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%x\n", (uint *) &appid->id_code);
-                }
-                else if (strcmp (temp_string, "2") == 0)
-                {
-                        /* Now follows a string containing an application
-                         * name. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, appid->application_name);
-                }
-                else if (strcmp (temp_string, "70") == 0)
+                switch (group_code)
                 {
-                        /* Now follows a string containing the
-                         * standard flag value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%hd\n", &appid->flag);
-                }
-                else if (strcmp (temp_string, "330") == 0)
-                {
-                        if (iter330 == 0)
-                        {
-                                /* Now follows a string containing a soft-pointer
+                        case 5:
+                                /* Now follows a string containing a sequential
+                                 * id number. */
+                                dxf_read_handle (fp, &appid->id_code);
+                                break;
+                        case 2:
+                                /* Now follows a string containing an application
+                                 * name. */
+                                dxf_read_string (fp, &appid->application_name);
+                                break;
+                        case 70:
+                                /* Now follows a string containing the
+                                 * standard flag value. */
+                                dxf_read_int16 (fp, &appid->flag);
+                                break;
+                        case 330:
+                                if (iter330 == 0)
+                                {
+                                        /* Now follows a string containing a soft-pointer
+                                         * ID/handle to owner dictionary. */
+                                        dxf_read_handle (fp, &appid->dictionary_owner_soft);
+                                }
+                                if (iter330 == 1)
+                                {
+                                        /* Now follows a string containing a soft-pointer
+                                         * ID/handle to owner object. */
+                                        dxf_read_handle (fp, &appid->object_owner_soft);
+                                }
+                                iter330++;
+                                break;
+                        case 360:
+                                /* Now follows a string containing Hard owner
                                  * ID/handle to owner dictionary. */
-                                (fp->line_number)++;
-                                fscanf (fp->fp, DXF_MAX_STRING_FORMAT, appid->dictionary_owner_soft);
-                        }
-                        if (iter330 == 1)
-                        {
-                                /* Now follows a string containing a soft-pointer
-                                 * ID/handle to owner object. */
-                                (fp->line_number)++;
-                                fscanf (fp->fp, DXF_MAX_STRING_FORMAT, appid->object_owner_soft);
-                        }
-                        iter330++;
-                }
-                else if (strcmp (temp_string, "360") == 0)
-                {
-                        /* Now follows a string containing Hard owner
-                         * ID/handle to owner dictionary. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, appid->dictionary_owner_hard);
-                }
-                else if (strcmp (temp_string, "999") == 0)
-                {
-                        /* Now follows a string containing a comment. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
-                        fprintf (stdout, "DXF comment: %s\n", temp_string);
-                }
-                else
-                {
-                        fprintf (stderr,
-                          (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
-                          __FUNCTION__, fp->filename, fp->line_number);
+                                dxf_read_handle (fp, &appid->dictionary_owner_hard);
+                                break;
+                        case 999:
+                                /* Now follows a string containing a comment. */
+                                dxf_read_line (temp_string, fp);
+                                fprintf (stdout, "DXF comment: %s\n", temp_string);
+                                break;
+                        default:
+                                fprintf (stderr,
+                                  (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
+                                  __FUNCTION__, fp->filename, fp->line_number);
+                                /* Skip the value of the unknown group code. */
+                                dxf_read_line (temp_string, fp);
+                                break;
                 }
         }
-        /* Clean up. */
-        free (temp_string);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -284,7 +269,7 @@ dxf_appid_write
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        char *dxf_entity_name = strdup ("APPID");
+        char *dxf_entity_name = dxf_strdup ("APPID");
 
         /* Do some basic checks. */
         if (fp == NULL)
@@ -293,7 +278,7 @@ dxf_appid_write
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (appid == NULL)
@@ -302,20 +287,20 @@ dxf_appid_write
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if ((appid->application_name == NULL)
           || (strcmp (appid->application_name, "") == 0))
         {
                 fprintf (stderr,
-                  (_("Error in %s empty block name string for the %s entity with id-code: %x\n")),
+                  (_("Error in %s empty block name string for the %s entity with id-code: %" PRIx64 "\n")),
                   __FUNCTION__, dxf_entity_name, appid->id_code);
                 fprintf (stderr,
                   (_("\t%s entity is discarded from output.\n")),
                   dxf_entity_name);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (fp->acad_version_number < AutoCAD_12)
@@ -325,10 +310,10 @@ dxf_appid_write
                   __FUNCTION__);
         }
         /* Start writing output. */
-        fprintf (fp->fp, "  0\n%s\n", dxf_entity_name);
-        if (appid->id_code != -1)
+        dxf_write_string (fp, 0, dxf_entity_name);
+        if (appid->id_code != DXF_HANDLE_NONE)
         {
-                fprintf (fp->fp, "  5\n%x\n", appid->id_code);
+                dxf_write_hex (fp, 5, appid->id_code);
         }
         /*!
          * \todo for version R14.\n
@@ -340,34 +325,34 @@ dxf_appid_write
          * 102 groups are application defined (optional).\n\n
          * End of group, "}" (optional), with Group code 102.
          */
-        if ((strcmp (appid->dictionary_owner_soft, "") != 0)
+        if ((appid->dictionary_owner_soft != 0)
           && (fp->acad_version_number >= AutoCAD_14))
         {
-                fprintf (fp->fp, "102\n{ACAD_REACTORS\n");
-                fprintf (fp->fp, "330\n%s\n", appid->dictionary_owner_soft);
-                fprintf (fp->fp, "102\n}\n");
+                dxf_write_string (fp, 102, "{ACAD_REACTORS");
+                dxf_write_hex (fp, 330, appid->dictionary_owner_soft);
+                dxf_write_string (fp, 102, "}");
         }
-        if ((strcmp (appid->dictionary_owner_hard, "") != 0)
+        if ((appid->dictionary_owner_hard != 0)
           && (fp->acad_version_number >= AutoCAD_14))
         {
-                fprintf (fp->fp, "102\n{ACAD_XDICTIONARY\n");
-                fprintf (fp->fp, "360\n%s\n", appid->dictionary_owner_hard);
-                fprintf (fp->fp, "102\n}\n");
+                dxf_write_string (fp, 102, "{ACAD_XDICTIONARY");
+                dxf_write_hex (fp, 360, appid->dictionary_owner_hard);
+                dxf_write_string (fp, 102, "}");
         }
-        if ((strcmp (appid->object_owner_soft, "") != 0)
+        if ((appid->object_owner_soft != 0)
           && (fp->acad_version_number >= AutoCAD_2000))
         {
-                fprintf (fp->fp, "330\n%s\n", appid->object_owner_soft);
+                dxf_write_hex (fp, 330, appid->object_owner_soft);
         }
         if (fp->acad_version_number >= AutoCAD_13)
         {
-                fprintf (fp->fp, "100\nAcDbSymbolTableRecord\n");
-                fprintf (fp->fp, "100\nAcDbRegAppTableRecord\n");
+                dxf_write_string (fp, 100, "AcDbSymbolTableRecord");
+                dxf_write_string (fp, 100, "AcDbRegAppTableRecord");
         }
-        fprintf (fp->fp, "  2\n%s\n", appid->application_name);
-        fprintf (fp->fp, " 70\n%hd\n", appid->flag);
+        dxf_write_string (fp, 2, appid->application_name);
+        dxf_write_int (fp, 70, appid->flag);
         /* Clean up. */
-        free (dxf_entity_name);
+        dxf_free (dxf_entity_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -406,11 +391,8 @@ dxf_appid_free
                 __FUNCTION__);
               return (EXIT_FAILURE);
         }
-        free (appid->application_name);
-        free (appid->dictionary_owner_soft);
-        free (appid->object_owner_soft);
-        free (appid->dictionary_owner_hard);
-        free (appid);
+        dxf_free (appid->application_name);
+        dxf_free (appid);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -456,7 +438,7 @@ dxf_appid_free_list
  *
  * \return ID code.
  */
-int
+uint64_t
 dxf_appid_get_id_code
 (
         DxfAppid *appid
@@ -474,12 +456,6 @@ dxf_appid_get_id_code
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (appid->id_code < 0)
-        {
-                fprintf (stderr,
-                  (_("Warning in %s () a negative value was found.\n")),
-                  __FUNCTION__);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -495,7 +471,7 @@ dxf_appid_set_id_code
 (
         DxfAppid *appid,
                 /*!< a pointer to a DXF \c APPID symbol table entry. */
-        int id_code
+        uint64_t id_code
                 /*!< Identification number for the symbol table entry.\n
                  * This is to be an unique (sequential) number in the DXF
                  * file. */
@@ -512,12 +488,6 @@ dxf_appid_set_id_code
                   __FUNCTION__);
                 return (NULL);
         }
-        if (id_code < 0)
-        {
-                fprintf (stderr,
-                  (_("Warning in %s () a negative value was passed.\n")),
-                  __FUNCTION__);
-        }
         appid->id_code = id_code;
 #if DEBUG
         DXF_DEBUG_END
@@ -560,7 +530,7 @@ dxf_appid_get_application_name
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (appid->application_name));
+        return (dxf_strdup (appid->application_name));
 }
 
 
@@ -604,7 +574,7 @@ dxf_appid_set_application_name
                   __FUNCTION__);
                 return (NULL);
         }
-        appid->application_name = strdup (name);
+        appid->application_name = dxf_strdup (name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -831,10 +801,8 @@ dxf_appid_is_referenced
  * \c APPID symbol table entry.
  *
  * \return soft pointer to the dictionary owner.
- *
- * \warning No checks are performed on the returned pointer (string).
  */
-char *
+uint64_t
 dxf_appid_get_dictionary_owner_soft
 (
         DxfAppid *appid
@@ -850,19 +818,12 @@ dxf_appid_get_dictionary_owner_soft
                 fprintf (stderr,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
-                return (NULL);
-        }
-        if (appid->dictionary_owner_soft ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
+                return (0);
         }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (appid->dictionary_owner_soft));
+        return (appid->dictionary_owner_soft);
 }
 
 
@@ -875,8 +836,8 @@ dxf_appid_set_dictionary_owner_soft
 (
         DxfAppid *appid,
                 /*!< a pointer to a DXF \c APPID symbol table entry. */
-        char *dictionary_owner_soft
-                /*!< a string containing the pointer to the
+        uint64_t dictionary_owner_soft
+                /*!< the handle of the
                  * dictionary_owner_soft for the symbol table entry. */
 )
 {
@@ -891,14 +852,7 @@ dxf_appid_set_dictionary_owner_soft
                   __FUNCTION__);
                 return (NULL);
         }
-        if (dictionary_owner_soft == NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was passed.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
-        appid->dictionary_owner_soft = strdup (dictionary_owner_soft);
+        appid->dictionary_owner_soft = dictionary_owner_soft;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -911,10 +865,8 @@ dxf_appid_set_dictionary_owner_soft
  * \c APPID symbol table entry.
  *
  * \return soft pointer to the object owner.
- *
- * \warning No checks are performed on the returned pointer (string).
  */
-char *
+uint64_t
 dxf_appid_get_object_owner_soft
 (
         DxfAppid *appid
@@ -930,19 +882,12 @@ dxf_appid_get_object_owner_soft
                 fprintf (stderr,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
-                return (NULL);
-        }
-        if (appid->object_owner_soft ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
+                return (0);
         }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (appid->object_owner_soft));
+        return (appid->object_owner_soft);
 }
 
 
@@ -955,8 +900,8 @@ dxf_appid_set_object_owner_soft
 (
         DxfAppid *appid,
                 /*!< a pointer to a DXF \c APPID symbol table entry. */
-        char *object_owner_soft
-                /*!< a string containing the pointer to the
+        uint64_t object_owner_soft
+                /*!< the handle of the
                  * \c object_owner_soft for the symbol table entry. */
 )
 {
@@ -971,14 +916,7 @@ dxf_appid_set_object_owner_soft
                   __FUNCTION__);
                 return (NULL);
         }
-        if (object_owner_soft == NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was passed.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
-        appid->object_owner_soft = strdup (object_owner_soft);
+        appid->object_owner_soft = object_owner_soft;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -991,10 +929,8 @@ dxf_appid_set_object_owner_soft
  * \c APPID symbol table entry.
  *
  * \return hard pointer to the dictionary owner.
- *
- * \warning No checks are performed on the returned pointer (string).
  */
-char *
+uint64_t
 dxf_appid_get_dictionary_owner_hard
 (
         DxfAppid *appid
@@ -1010,19 +946,12 @@ dxf_appid_get_dictionary_owner_hard
                 fprintf (stderr,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
-                return (NULL);
-        }
-        if (appid->dictionary_owner_hard ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
+                return (0);
         }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (appid->dictionary_owner_hard));
+        return (appid->dictionary_owner_hard);
 }
 
 
@@ -1035,8 +964,8 @@ dxf_appid_set_dictionary_owner_hard
 (
         DxfAppid *appid,
                 /*!< a pointer to a DXF \c APPID symbol table entry. */
-        char *dictionary_owner_hard
-                /*!< a string containing the pointer to the
+        uint64_t dictionary_owner_hard
+                /*!< the handle of the
                  * dictionary_owner_hard for the symbol table entry. */
 )
 {
@@ -1051,14 +980,7 @@ dxf_appid_set_dictionary_owner_hard
                   __FUNCTION__);
                 return (NULL);
         }
-        if (dictionary_owner_hard == NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was passed.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
-        appid->dictionary_owner_hard = strdup (dictionary_owner_hard);
+        appid->dictionary_owner_hard = dictionary_owner_hard;
 #if DEBUG
         DXF_DEBUG_END
 #endif
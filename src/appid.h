@@ -70,7 +70,7 @@ extern "C" {
 typedef struct
 dxf_appid_struct
 {
-        int id_code;
+        uint64_t id_code;
                 /*!< Identification number for the entry.\n
                  * This is to be an unique (sequential) number in the DXF
                  * file.\n
@@ -94,15 +94,15 @@ dxf_appid_struct
                  * last time the drawing was edited.</li>
                  * </ol>
                  * Group code = 70. */
-        char *dictionary_owner_soft;
+        uint64_t dictionary_owner_soft;
                 /*!< Soft-pointer ID/handle to owner dictionary
                  * (optional).\n
                  * Group code = 330. */
-        char *object_owner_soft;
+        uint64_t object_owner_soft;
                 /*!< Soft-pointer ID/handle  to owner BLOCK_RECORD object.\n
                  * Group code = 330.\n
                  * \since Introduced in version R2000. */
-        char *dictionary_owner_hard;
+        uint64_t dictionary_owner_hard;
                 /*!< Hard owner ID/handle to owner dictionary
                  * (optional).\n
                  * Group code = 360. */
@@ -118,8 +118,8 @@ DxfAppid *dxf_appid_read (DxfFile *fp, DxfAppid *appid);
 int dxf_appid_write (DxfFile *fp, DxfAppid* appid);
 int dxf_appid_free (DxfAppid *appid);
 void dxf_appid_free_list (DxfAppid *appids);
-int dxf_appid_get_id_code (DxfAppid *appid);
-DxfAppid *dxf_appid_set_id_code (DxfAppid *appid, int id_code);
+uint64_t dxf_appid_get_id_code (DxfAppid *appid);
+DxfAppid *dxf_appid_set_id_code (DxfAppid *appid, uint64_t id_code);
 char *dxf_appid_get_application_name (DxfAppid *appid);
 DxfAppid *dxf_appid_set_application_name (DxfAppid *appid, char *name);
 int16_t dxf_appid_get_flag (DxfAppid *appid);
@@ -128,12 +128,12 @@ int dxf_appid_is_xreferenced (DxfAppid *appid);
 int dxf_appid_is_xresolved (DxfAppid *appid);
 int dxf_appid_is_referenced (DxfAppid *appid);
 int dxf_appid_is_no_save_xdata (DxfAppid *appid);
-char *dxf_appid_get_dictionary_owner_soft (DxfAppid *appid);
-DxfAppid *dxf_appid_set_dictionary_owner_soft (DxfAppid *appid, char *dictionary_owner_soft);
-char *dxf_appid_get_object_owner_soft (DxfAppid *appid);
-DxfAppid *dxf_appid_set_object_owner_soft (DxfAppid *appid, char *object_owner_soft);
-char *dxf_appid_get_dictionary_owner_hard (DxfAppid *appid);
-DxfAppid *dxf_appid_set_dictionary_owner_hard (DxfAppid *appid, char *dictionary_owner_hard);
+uint64_t dxf_appid_get_dictionary_owner_soft (DxfAppid *appid);
+DxfAppid *dxf_appid_set_dictionary_owner_soft (DxfAppid *appid, uint64_t dictionary_owner_soft);
+uint64_t dxf_appid_get_object_owner_soft (DxfAppid *appid);
+DxfAppid *dxf_appid_set_object_owner_soft (DxfAppid *appid, uint64_t object_owner_soft);
+uint64_t dxf_appid_get_dictionary_owner_hard (DxfAppid *appid);
+DxfAppid *dxf_appid_set_dictionary_owner_hard (DxfAppid *appid, uint64_t dictionary_owner_hard);
 DxfAppid *dxf_appid_get_next (DxfAppid *appid);
 DxfAppid *dxf_appid_set_next (DxfAppid *appid, DxfAppid *next);
 DxfAppid *dxf_appid_get_last (DxfAppid *appid);
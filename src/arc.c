@@ -40,6 +40,8 @@
 
 
 #include "arc.h"
+#include "bbox.h"
+#include "util.h"
 
 
 /*!
@@ -62,7 +64,7 @@ dxf_arc_new ()
         size = sizeof (DxfArc);
         /* avoid malloc of 0 bytes */
         if (size == 0) size = 1;
-        if ((arc = malloc (size)) == NULL)
+        if ((arc = dxf_malloc (size)) == NULL)
         {
                 fprintf (stderr,
                   (_("Error in %s () could not allocate memory.\n")),
@@ -113,9 +115,9 @@ dxf_arc_init
                 return (NULL);
         }
         /* Assign initial values to members. */
-        arc->id_code = 0;
-        arc->linetype = strdup (DXF_DEFAULT_LINETYPE);
-        arc->layer = strdup (DXF_DEFAULT_LAYER);
+        arc->id_code = DXF_HANDLE_NONE;
+        arc->linetype = dxf_strdup (DXF_DEFAULT_LINETYPE);
+        arc->layer = dxf_strdup (DXF_DEFAULT_LAYER);
         arc->elevation = 0.0;
         arc->thickness = 0.0;
         arc->linetype_scale = DXF_DEFAULT_LINETYPE_SCALE;
@@ -124,18 +126,18 @@ dxf_arc_init
         arc->paperspace = DXF_MODELSPACE;
         arc->graphics_data_size = 0;
         arc->shadow_mode = 0;
-        arc->dictionary_owner_soft = strdup ("");
-        arc->object_owner_soft = strdup ("");
-        arc->material = strdup ("");
-        arc->dictionary_owner_hard = strdup ("");
+        arc->dictionary_owner_soft = 0;
+        arc->object_owner_soft = 0;
+        arc->material = 0;
+        arc->dictionary_owner_hard = 0;
         arc->lineweight = 0;
-        arc->plot_style_name = strdup ("");
+        arc->plot_style_name = 0;
         arc->color_value = 0;
-        arc->color_name = strdup ("");
+        arc->color_name = dxf_strdup ("");
         arc->transparency = 0;
-        arc->p0->x0 = 0.0;
-        arc->p0->y0 = 0.0;
-        arc->p0->z0 = 0.0;
+        arc->p0.x = 0.0;
+        arc->p0.y = 0.0;
+        arc->p0.z = 0.0;
         arc->radius = 0.0;
         arc->start_angle = 0.0;
         arc->end_angle = 0.0;
@@ -145,7 +147,6 @@ dxf_arc_init
         /* Initialize new structs for the following members later,
          * when they are required and when we have content. */
         arc->binary_graphics_data = NULL;
-        arc->p0 = NULL;
         arc->next = NULL;
 #if DEBUG
         DXF_DEBUG_END
@@ -177,7 +178,8 @@ dxf_arc_read
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        char *temp_string = NULL;
+        char temp_string[DXF_MAX_STRING_LENGTH];
+        int group_code;
         DxfBinaryData *iter310 = NULL;
         int iter330;
 
@@ -187,8 +189,6 @@ dxf_arc_read
                 fprintf (stderr,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
-                /* Clean up. */
-                free (temp_string);
                 return (NULL);
         }
         if (arc == NULL)
@@ -214,300 +214,235 @@ dxf_arc_read
                         return (NULL);
                 }
         }
-        if (arc->p0 == NULL)
-        {
-                fprintf (stderr,
-                  (_("Warning in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                fprintf (stderr,
-                  (_("Initializing a DxfPoint.\n")));
-                arc->p0 = dxf_point_init (arc->p0);
-                if (arc->p0 == NULL)
-                {
-                        fprintf (stderr,
-                          (_("Error in %s () could not allocate memory.\n")),
-                          __FUNCTION__);
-                        return (NULL);
-                }
-        }
         iter310 = (DxfBinaryData *) arc->binary_graphics_data;
         iter330 = 0;
-        (fp->line_number)++;
-        fscanf (fp->fp, "%[^\n]", temp_string);
-        while (strcmp (temp_string, "0") != 0)
+        while ((dxf_read_group_code (fp, &group_code) == EXIT_SUCCESS)
+          && (group_code != 0))
         {
-                if (ferror (fp->fp))
+                if (dxf_read_error (fp))
                 {
                         fprintf (stderr,
                           (_("Error in %s () while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
-                        fclose (fp->fp);
-                        /* Clean up. */
-                        free (temp_string);
                         return (NULL);
                 }
-                if (strcmp (temp_string, "5") == 0)
-                {
-                        /* Now follows a string containing a sequential
-                         * id number. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%x\n", (uint *) &arc->id_code);
-                }
-                else if (strcmp (temp_string, "6") == 0)
-                {
-                        /* Now follows a string containing a linetype
-                         * name. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, arc->linetype);
-                }
-                else if (strcmp (temp_string, "8") == 0)
-                {
-                        /* Now follows a string containing a layer name. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, arc->layer);
-                }
-                else if (strcmp (temp_string, "10") == 0)
-                {
-                        /* Now follows a string containing the
-                         * X-coordinate of the center point. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &arc->p0->x0);
-                }
-                else if (strcmp (temp_string, "20") == 0)
-                {
-                        /* Now follows a string containing the
-                         * Y-coordinate of the center point. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &arc->p0->y0);
-                }
-                else if (strcmp (temp_string, "30") == 0)
-                {
-                        /* Now follows a string containing the
-                         * Z-coordinate of the center point. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &arc->p0->z0);
-                }
-                else if ((fp->acad_version_number <= AutoCAD_11)
-                        && (strcmp (temp_string, "38") == 0))
-                {
-                        /* Now follows a string containing the
-                         * elevation. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &arc->elevation);
-                }
-                else if (strcmp (temp_string, "39") == 0)
-                {
-                        /* Now follows a string containing the
-                         * thickness. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &arc->thickness);
-                }
-                else if (strcmp (temp_string, "40") == 0)
-                {
-                        /* Now follows a string containing the
-                         * radius. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &arc->radius);
-                }
-                else if (strcmp (temp_string, "48") == 0)
-                {
-                        /* Now follows a string containing the linetype
-                         * scale. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &arc->linetype_scale);
-                }
-                else if (strcmp (temp_string, "50") == 0)
-                {
-                        /* Now follows a string containing the
-                         * start angle. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &arc->start_angle);
-                }
-                else if (strcmp (temp_string, "51") == 0)
-                {
-                        /* Now follows a string containing the
-                         * end angle. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &arc->end_angle);
-                }
-                else if (strcmp (temp_string, "60") == 0)
-                {
-                        /* Now follows a string containing the
-                         * visibility value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%hd\n", &arc->visibility);
-                }
-                else if (strcmp (temp_string, "62") == 0)
+                switch (group_code)
                 {
-                        /* Now follows a string containing the
-                         * color value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%hd\n", &arc->color);
-                }
-                else if (strcmp (temp_string, "67") == 0)
-                {
-                        /* Now follows a string containing the
-                         * paperspace value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%hd\n", &arc->paperspace);
-                }
-                else if (strcmp (temp_string, "92") == 0)
-                {
-                        /* Now follows a string containing the
-                         * graphics data size value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%" PRIi32 "\n", &arc->graphics_data_size);
-                }
-                else if ((fp->acad_version_number >= AutoCAD_13)
-                        && (strcmp (temp_string, "100") == 0))
-                {
-                        /* Now follows a string containing the
-                         * subclass marker value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
-                        if ((strcmp (temp_string, "AcDbEntity") != 0)
-                        && ((strcmp (temp_string, "AcDbCircle") != 0)))
-                        {
+                        case 5:
+                                /* Now follows a string containing a sequential
+                                 * id number. */
+                                dxf_read_handle (fp, &arc->id_code);
+                                break;
+                        case 6:
+                                /* Now follows a string containing a linetype
+                                 * name. */
+                                dxf_read_string_interned (fp, &arc->linetype);
+                                break;
+                        case 8:
+                                /* Now follows a string containing a layer name. */
+                                dxf_read_string_interned (fp, &arc->layer);
+                                break;
+                        case 10:
+                                /* Now follows a string containing the
+                                 * X-coordinate of the center point. */
+                                dxf_read_double (fp, &arc->p0.x);
+                                break;
+                        case 20:
+                                /* Now follows a string containing the
+                                 * Y-coordinate of the center point. */
+                                dxf_read_double (fp, &arc->p0.y);
+                                break;
+                        case 30:
+                                /* Now follows a string containing the
+                                 * Z-coordinate of the center point. */
+                                dxf_read_double (fp, &arc->p0.z);
+                                break;
+                        case 38:
+                                if (fp->acad_version_number <= AutoCAD_11)
+                                {
+                                        /* Now follows a string containing the
+                                         * elevation. */
+                                        dxf_read_double (fp, &arc->elevation);
+                                }
+                                else
+                                {
+                                        fprintf (stderr,
+                                          (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
+                                          __FUNCTION__, fp->filename, fp->line_number);
+                                        /* Skip the value of the unknown group code. */
+                                        dxf_read_line (temp_string, fp);
+                                }
+                                break;
+                        case 39:
+                                /* Now follows a string containing the
+                                 * thickness. */
+                                dxf_read_double (fp, &arc->thickness);
+                                break;
+                        case 40:
+                                /* Now follows a string containing the
+                                 * radius. */
+                                dxf_read_double (fp, &arc->radius);
+                                break;
+                        case 48:
+                                /* Now follows a string containing the linetype
+                                 * scale. */
+                                dxf_read_double (fp, &arc->linetype_scale);
+                                break;
+                        case 50:
+                                /* Now follows a string containing the
+                                 * start angle. */
+                                dxf_read_double (fp, &arc->start_angle);
+                                break;
+                        case 51:
+                                /* Now follows a string containing the
+                                 * end angle. */
+                                dxf_read_double (fp, &arc->end_angle);
+                                break;
+                        case 60:
+                                /* Now follows a string containing the
+                                 * visibility value. */
+                                dxf_read_int16 (fp, &arc->visibility);
+                                break;
+                        case 62:
+                                /* Now follows a string containing the
+                                 * color value. */
+                                dxf_read_int16 (fp, &arc->color);
+                                break;
+                        case 67:
+                                /* Now follows a string containing the
+                                 * paperspace value. */
+                                dxf_read_int16 (fp, &arc->paperspace);
+                                break;
+                        case 92:
+                                /* Now follows a string containing the
+                                 * graphics data size value. */
+                                dxf_read_int32 (fp, &arc->graphics_data_size);
+                                break;
+                        case 100:
+                                if (fp->acad_version_number >= AutoCAD_13)
+                                {
+                                        /* Now follows a string containing the
+                                         * subclass marker value. */
+                                        dxf_read_line (temp_string, fp);
+                                        if ((strcmp (temp_string, "AcDbEntity") != 0)
+                                        && ((strcmp (temp_string, "AcDbCircle") != 0)))
+                                        {
+                                                fprintf (stderr,
+                                                  (_("Warning in %s () found a bad subclass marker in: %s in line: %d.\n")),
+                                                  __FUNCTION__, fp->filename, fp->line_number);
+                                        }
+                                }
+                                else
+                                {
+                                        fprintf (stderr,
+                                          (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
+                                          __FUNCTION__, fp->filename, fp->line_number);
+                                        /* Skip the value of the unknown group code. */
+                                        dxf_read_line (temp_string, fp);
+                                }
+                                break;
+                        case 160:
+                                /* Now follows a string containing the
+                                 * graphics data size value. */
+                                dxf_read_int32 (fp, &arc->graphics_data_size);
+                                break;
+                        case 210:
+                                /* Now follows a string containing the
+                                 * X-value of the extrusion vector. */
+                                dxf_read_double (fp, &arc->extr_x0);
+                                break;
+                        case 220:
+                                /* Now follows a string containing the
+                                 * Y-value of the extrusion vector. */
+                                dxf_read_double (fp, &arc->extr_y0);
+                                break;
+                        case 230:
+                                /* Now follows a string containing the
+                                 * Z-value of the extrusion vector. */
+                                dxf_read_double (fp, &arc->extr_z0);
+                                break;
+                        case 284:
+                                /* Now follows a string containing the shadow
+                                 * mode value. */
+                                dxf_read_int16 (fp, &arc->shadow_mode);
+                                break;
+                        case 310:
+                                /* Now follows a string containing binary
+                                 * graphics data. */
+                                iter310 = dxf_binary_data_read (fp, iter310);
+                                break;
+                        case 330:
+                                if (iter330 == 0)
+                                {
+                                        /* Now follows a string containing a soft-pointer
+                                         * ID/handle to owner dictionary. */
+                                        dxf_read_handle (fp, &arc->dictionary_owner_soft);
+                                }
+                                if (iter330 == 1)
+                                {
+                                        /* Now follows a string containing a soft-pointer
+                                         * ID/handle to owner object. */
+                                        dxf_read_handle (fp, &arc->object_owner_soft);
+                                }
+                                iter330++;
+                                break;
+                        case 347:
+                                /* Now follows a string containing a
+                                 * hard-pointer ID/handle to material object. */
+                                dxf_read_handle (fp, &arc->material);
+                                break;
+                        case 360:
+                                /* Now follows a string containing Hard owner
+                                 * ID/handle to owner dictionary. */
+                                dxf_read_handle (fp, &arc->dictionary_owner_hard);
+                                break;
+                        case 370:
+                                /* Now follows a string containing the lineweight
+                                 * value. */
+                                dxf_read_int16 (fp, &arc->lineweight);
+                                break;
+                        case 390:
+                                /* Now follows a string containing a plot style
+                                 * name value. */
+                                dxf_read_handle (fp, &arc->plot_style_name);
+                                break;
+                        case 420:
+                                /* Now follows a string containing a color value. */
+                                dxf_read_int32 (fp, &arc->color_value);
+                                break;
+                        case 430:
+                                /* Now follows a string containing a color
+                                 * name value. */
+                                dxf_read_string_interned (fp, &arc->color_name);
+                                break;
+                        case 440:
+                                /* Now follows a string containing a transparency
+                                 * value. */
+                                dxf_read_int32 (fp, &arc->transparency);
+                                break;
+                        case 999:
+                                /* Now follows a string containing a comment. */
+                                dxf_read_line (temp_string, fp);
+                                fprintf (stdout, "DXF comment: %s\n", temp_string);
+                                break;
+                        default:
                                 fprintf (stderr,
-                                  (_("Warning in %s () found a bad subclass marker in: %s in line: %d.\n")),
+                                  (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
                                   __FUNCTION__, fp->filename, fp->line_number);
-                        }
-                }
-                else if (strcmp (temp_string, "160") == 0)
-                {
-                        /* Now follows a string containing the
-                         * graphics data size value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%" PRIi32 "\n", &arc->graphics_data_size);
-                }
-                else if (strcmp (temp_string, "210") == 0)
-                {
-                        /* Now follows a string containing the
-                         * X-value of the extrusion vector. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &arc->extr_x0);
-                }
-                else if (strcmp (temp_string, "220") == 0)
-                {
-                        /* Now follows a string containing the
-                         * Y-value of the extrusion vector. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &arc->extr_y0);
-                }
-                else if (strcmp (temp_string, "230") == 0)
-                {
-                        /* Now follows a string containing the
-                         * Z-value of the extrusion vector. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &arc->extr_z0);
-                }
-                else if (strcmp (temp_string, "284") == 0)
-                {
-                        /* Now follows a string containing the shadow
-                         * mode value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%hd\n", &arc->shadow_mode);
-                }
-                else if (strcmp (temp_string, "310") == 0)
-                {
-                        /* Now follows a string containing binary
-                         * graphics data. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, iter310->data_line);
-                        dxf_binary_data_init ((DxfBinaryData *) iter310->next);
-                        iter310 = (DxfBinaryData *) iter310->next;
-                }
-                else if (strcmp (temp_string, "330") == 0)
-                {
-                        if (iter330 == 0)
-                        {
-                                /* Now follows a string containing a soft-pointer
-                                 * ID/handle to owner dictionary. */
-                                (fp->line_number)++;
-                                fscanf (fp->fp, DXF_MAX_STRING_FORMAT, arc->dictionary_owner_soft);
-                        }
-                        if (iter330 == 1)
-                        {
-                                /* Now follows a string containing a soft-pointer
-                                 * ID/handle to owner object. */
-                                (fp->line_number)++;
-                                fscanf (fp->fp, DXF_MAX_STRING_FORMAT, arc->object_owner_soft);
-                        }
-                        iter330++;
-                }
-                else if (strcmp (temp_string, "347") == 0)
-                {
-                        /* Now follows a string containing a
-                         * hard-pointer ID/handle to material object. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, arc->material);
-                }
-                else if (strcmp (temp_string, "360") == 0)
-                {
-                        /* Now follows a string containing Hard owner
-                         * ID/handle to owner dictionary. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, arc->dictionary_owner_hard);
-                }
-                else if (strcmp (temp_string, "370") == 0)
-                {
-                        /* Now follows a string containing the lineweight
-                         * value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%hd\n", &arc->lineweight);
-                }
-                else if (strcmp (temp_string, "390") == 0)
-                {
-                        /* Now follows a string containing a plot style
-                         * name value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, arc->plot_style_name);
-                }
-                else if (strcmp (temp_string, "420") == 0)
-                {
-                        /* Now follows a string containing a color value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%" PRIi32 "\n", &arc->color_value);
-                }
-                else if (strcmp (temp_string, "430") == 0)
-                {
-                        /* Now follows a string containing a color
-                         * name value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, arc->color_name);
-                }
-                else if (strcmp (temp_string, "440") == 0)
-                {
-                        /* Now follows a string containing a transparency
-                         * value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%" PRIi32 "\n", &arc->transparency);
-                }
-                else if (strcmp (temp_string, "999") == 0)
-                {
-                        /* Now follows a string containing a comment. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
-                        fprintf (stdout, "DXF comment: %s\n", temp_string);
-                }
-                else
-                {
-                        fprintf (stderr,
-                          (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
-                          __FUNCTION__, fp->filename, fp->line_number);
+                                /* Skip the value of the unknown group code. */
+                                dxf_read_line (temp_string, fp);
+                                break;
                 }
         }
         /* Handle omitted members and/or illegal values. */
         if (strcmp (arc->linetype, "") == 0)
         {
-                arc->linetype = strdup (DXF_DEFAULT_LINETYPE);
+                arc->linetype = dxf_strdup (DXF_DEFAULT_LINETYPE);
         }
         if (strcmp (arc->layer, "") == 0)
         {
-                arc->layer = strdup (DXF_DEFAULT_LAYER);
+                arc->layer = dxf_strdup (DXF_DEFAULT_LAYER);
         }
-        /* Clean up. */
-        free (temp_string);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -533,7 +468,7 @@ dxf_arc_write
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        char *dxf_entity_name = strdup ("ARC");
+        char *dxf_entity_name = dxf_strdup ("ARC");
 
         /* Do some basic checks. */
         if (fp == NULL)
@@ -542,7 +477,7 @@ dxf_arc_write
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (arc == NULL)
@@ -551,84 +486,84 @@ dxf_arc_write
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (arc->start_angle == arc->end_angle)
         {
                 fprintf (stderr,
-                  (_("Error in %s () start angle and end angle are identical for the %s entity with id-code: %x.\n")),
+                  (_("Error in %s () start angle and end angle are identical for the %s entity with id-code: %" PRIx64 ".\n")),
                     __FUNCTION__, dxf_entity_name, arc->id_code);
                 fprintf (stderr,
                   (_("\tskipping %s entity.\n")), dxf_entity_name);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (arc->start_angle > 360.0)
         {
-                fprintf (stderr, "Error in %s () start angle is greater than 360 degrees for the %s entity with id-code: %x.\n",
+                fprintf (stderr, "Error in %s () start angle is greater than 360 degrees for the %s entity with id-code: %" PRIx64 ".\n",
                         __FUNCTION__, dxf_entity_name, arc->id_code);
                 fprintf (stderr, "\tskipping %s entity.\n",
                         dxf_entity_name);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (arc->start_angle < 0.0)
         {
-                fprintf (stderr, "Error in %s () start angle is lesser than 0 degrees for the %s entity with id-code: %x.\n",
+                fprintf (stderr, "Error in %s () start angle is lesser than 0 degrees for the %s entity with id-code: %" PRIx64 ".\n",
                         __FUNCTION__, dxf_entity_name, arc->id_code);
                 fprintf (stderr, "\tskipping %s entity.\n",
                         dxf_entity_name);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (arc->end_angle > 360.0)
         {
-                fprintf (stderr, "Error in %s () end angle is greater than 360 degrees for the %s entity with id-code: %x.\n",
+                fprintf (stderr, "Error in %s () end angle is greater than 360 degrees for the %s entity with id-code: %" PRIx64 ".\n",
                         __FUNCTION__, dxf_entity_name, arc->id_code);
                 fprintf (stderr, "\tskipping %s entity.\n",
                         dxf_entity_name);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (arc->end_angle < 0.0)
         {
-                fprintf (stderr, "Error in %s () end angle is lesser than 0 degrees for the %s entity with id-code: %x.\n",
+                fprintf (stderr, "Error in %s () end angle is lesser than 0 degrees for the %s entity with id-code: %" PRIx64 ".\n",
                         __FUNCTION__, dxf_entity_name, arc->id_code);
                 fprintf (stderr, "\tskipping %s entity.\n",
                         dxf_entity_name);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (arc->radius == 0.0)
         {
-                fprintf (stderr, "Error in %s () radius value equals 0.0 for the %s entity with id-code: %x.\n",
+                fprintf (stderr, "Error in %s () radius value equals 0.0 for the %s entity with id-code: %" PRIx64 ".\n",
                         __FUNCTION__, dxf_entity_name, arc->id_code);
                 fprintf (stderr, "\tskipping %s entity.\n",
                         dxf_entity_name);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (strcmp (arc->linetype, "") == 0)
         {
                 fprintf (stderr,
-                  (_("Warning in %s () empty linetype string for the %s entity with id-code: %x\n")),
+                  (_("Warning in %s () empty linetype string for the %s entity with id-code: %" PRIx64 "\n")),
                   __FUNCTION__, dxf_entity_name, arc->id_code);
                 fprintf (stderr,
                   (_("\t%s entity is reset to default linetype")),
                   dxf_entity_name);
-                arc->linetype = strdup (DXF_DEFAULT_LINETYPE);
+                arc->linetype = dxf_strdup (DXF_DEFAULT_LINETYPE);
         }
         if (strcmp (arc->layer, "") == 0)
         {
                 fprintf (stderr,
-                  (_("Warning in %s () empty layer string for the %s entity with id-code: %x\n")),
+                  (_("Warning in %s () empty layer string for the %s entity with id-code: %" PRIx64 "\n")),
                   __FUNCTION__, dxf_entity_name, arc->id_code);
                 fprintf (stderr,
                   (_("\t%s entity is relocated to layer 0")),
@@ -636,10 +571,10 @@ dxf_arc_write
                 arc->layer = DXF_DEFAULT_LAYER;
         }
         /* Start writing output. */
-        fprintf (fp->fp, "  0\n%s\n", dxf_entity_name);
-        if (arc->id_code != -1)
+        dxf_write_string (fp, 0, dxf_entity_name);
+        if (arc->id_code != DXF_HANDLE_NONE)
         {
-                fprintf (fp->fp, "  5\n%x\n", arc->id_code);
+                dxf_write_hex (fp, 5, arc->id_code);
         }
         /*!
          * \todo for version R14.\n
@@ -651,71 +586,71 @@ dxf_arc_write
          * 102 groups are application defined (optional).\n\n
          * End of group, "}" (optional), with Group code 102.
          */
-        if ((strcmp (arc->dictionary_owner_soft, "") != 0)
+        if ((arc->dictionary_owner_soft != 0)
           && (fp->acad_version_number >= AutoCAD_14))
         {
-                fprintf (fp->fp, "102\n{ACAD_REACTORS\n");
-                fprintf (fp->fp, "330\n%s\n", arc->dictionary_owner_soft);
-                fprintf (fp->fp, "102\n}\n");
+                dxf_write_string (fp, 102, "{ACAD_REACTORS");
+                dxf_write_hex (fp, 330, arc->dictionary_owner_soft);
+                dxf_write_string (fp, 102, "}");
         }
-        if ((strcmp (arc->dictionary_owner_hard, "") != 0)
+        if ((arc->dictionary_owner_hard != 0)
           && (fp->acad_version_number >= AutoCAD_14))
         {
-                fprintf (fp->fp, "102\n{ACAD_XDICTIONARY\n");
-                fprintf (fp->fp, "360\n%s\n", arc->dictionary_owner_hard);
-                fprintf (fp->fp, "102\n}\n");
+                dxf_write_string (fp, 102, "{ACAD_XDICTIONARY");
+                dxf_write_hex (fp, 360, arc->dictionary_owner_hard);
+                dxf_write_string (fp, 102, "}");
         }
-        if ((strcmp (arc->object_owner_soft, "") != 0)
+        if ((arc->object_owner_soft != 0)
           && (fp->acad_version_number >= AutoCAD_2000))
         {
-                fprintf (fp->fp, "330\n%s\n", arc->object_owner_soft);
+                dxf_write_hex (fp, 330, arc->object_owner_soft);
         }
         if (fp->acad_version_number >= AutoCAD_13)
         {
-                fprintf (fp->fp, "100\nAcDbEntity\n");
+                dxf_write_string (fp, 100, "AcDbEntity");
         }
         if (arc->paperspace == DXF_PAPERSPACE)
         {
-                fprintf (fp->fp, " 67\n%hd\n", (int16_t) DXF_PAPERSPACE);
+                dxf_write_int (fp, 67, (int16_t) DXF_PAPERSPACE);
         }
-        fprintf (fp->fp, "  8\n%s\n", arc->layer);
+        dxf_write_string (fp, 8, arc->layer);
         if (strcmp (arc->linetype, DXF_DEFAULT_LINETYPE) != 0)
         {
-                fprintf (fp->fp, "  6\n%s\n", arc->linetype);
+                dxf_write_string (fp, 6, arc->linetype);
         }
         if ((fp->acad_version_number >= AutoCAD_2008)
-          && (strcmp (arc->material, "") != 0))
+          && (arc->material != 0))
         {
-                fprintf (fp->fp, "347\n%s\n", arc->material);
+                dxf_write_hex (fp, 347, arc->material);
         }
         if ((fp->acad_version_number <= AutoCAD_11)
           && DXF_FLATLAND
           && (arc->elevation != 0.0))
         {
-                fprintf (fp->fp, " 38\n%f\n", arc->elevation);
+                dxf_write_double (fp, 38, arc->elevation);
         }
         if (arc->color != DXF_COLOR_BYLAYER)
         {
-                fprintf (fp->fp, " 62\n%hd\n", arc->color);
+                dxf_write_int (fp, 62, arc->color);
         }
         if (fp->acad_version_number >= AutoCAD_2002)
         {
-                fprintf (fp->fp, "370\n%hd\n", arc->lineweight);
+                dxf_write_int (fp, 370, arc->lineweight);
         }
         if (arc->linetype_scale != 1.0)
         {
-                fprintf (fp->fp, " 48\n%f\n", arc->linetype_scale);
+                dxf_write_double (fp, 48, arc->linetype_scale);
         }
         if (arc->visibility != 0)
         {
-                fprintf (fp->fp, " 60\n%hd\n", arc->visibility);
+                dxf_write_int (fp, 60, arc->visibility);
         }
         if (fp->acad_version_number >= AutoCAD_2000)
         {
 #ifdef BUILD_64
-                fprintf (fp->fp, "160\n%" PRIi32 "\n", arc->graphics_data_size);
+                dxf_write_int (fp, 160, arc->graphics_data_size);
 #else
-                fprintf (fp->fp, " 92\n%" PRIi32 "\n", arc->graphics_data_size);
+                dxf_write_int (fp, 92, arc->graphics_data_size);
 #endif
                 if (arc->binary_graphics_data != NULL)
                 {
@@ -723,51 +658,51 @@ dxf_arc_write
                         iter = (DxfBinaryData *) arc->binary_graphics_data;
                         while (iter != NULL)
                         {
-                                fprintf (fp->fp, "310\n%s\n", iter->data_line);
+                                dxf_binary_data_write (fp, iter);
                                 iter = (DxfBinaryData *) iter->next;
                         }
                 }
         }
         if (fp->acad_version_number >= AutoCAD_2004)
         {
-                fprintf (fp->fp, "420\n%" PRIi32 "\n", arc->color_value);
-                fprintf (fp->fp, "430\n%s\n", arc->color_name);
-                fprintf (fp->fp, "440\n%" PRIi32 "\n", arc->transparency);
+                dxf_write_int (fp, 420, arc->color_value);
+                dxf_write_string (fp, 430, arc->color_name);
+                dxf_write_int (fp, 440, arc->transparency);
         }
         if (fp->acad_version_number >= AutoCAD_2009)
         {
-                fprintf (fp->fp, "390\n%s\n", arc->plot_style_name);
-                fprintf (fp->fp, "284\n%hd\n", arc->shadow_mode);
+                dxf_write_hex (fp, 390, arc->plot_style_name);
+                dxf_write_int (fp, 284, arc->shadow_mode);
         }
         if (fp->acad_version_number >= AutoCAD_13)
         {
-                fprintf (fp->fp, "100\nAcDbCircle\n");
+                dxf_write_string (fp, 100, "AcDbCircle");
         }
         if (arc->thickness != 0.0)
         {
-                fprintf (fp->fp, " 39\n%f\n", arc->thickness);
+                dxf_write_double (fp, 39, arc->thickness);
         }
-        fprintf (fp->fp, " 10\n%f\n", arc->p0->x0);
-        fprintf (fp->fp, " 20\n%f\n", arc->p0->y0);
-        fprintf (fp->fp, " 30\n%f\n", arc->p0->z0);
-        fprintf (fp->fp, " 40\n%f\n", arc->radius);
+        dxf_write_double (fp, 10, arc->p0.x);
+        dxf_write_double (fp, 20, arc->p0.y);
+        dxf_write_double (fp, 30, arc->p0.z);
+        dxf_write_double (fp, 40, arc->radius);
         if (fp->acad_version_number >= AutoCAD_13)
         {
-                fprintf (fp->fp, "100\nAcDbArc\n");
+                dxf_write_string (fp, 100, "AcDbArc");
         }
-        fprintf (fp->fp, " 50\n%f\n", arc->start_angle);
-        fprintf (fp->fp, " 51\n%f\n", arc->end_angle);
+        dxf_write_double (fp, 50, arc->start_angle);
+        dxf_write_double (fp, 51, arc->end_angle);
         if ((fp->acad_version_number >= AutoCAD_12)
                 && (arc->extr_x0 != 0.0)
                 && (arc->extr_y0 != 0.0)
                 && (arc->extr_z0 != 1.0))
         {
-                fprintf (fp->fp, "210\n%f\n", arc->extr_x0);
-                fprintf (fp->fp, "220\n%f\n", arc->extr_y0);
-                fprintf (fp->fp, "230\n%f\n", arc->extr_z0);
+                dxf_write_double (fp, 210, arc->extr_x0);
+                dxf_write_double (fp, 220, arc->extr_y0);
+                dxf_write_double (fp, 230, arc->extr_z0);
         }
         /* Clean up. */
-        free (dxf_entity_name);
+        dxf_free (dxf_entity_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -808,17 +743,11 @@ dxf_arc_free
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        free (arc->linetype);
-        free (arc->layer);
+        dxf_string_free (arc->linetype);
+        dxf_string_free (arc->layer);
         dxf_binary_data_free (arc->binary_graphics_data);
-        free (arc->dictionary_owner_soft);
-        free (arc->object_owner_soft);
-        free (arc->material);
-        free (arc->dictionary_owner_hard);
-        free (arc->plot_style_name);
-        free (arc->color_name);
-        dxf_point_free (arc->p0);
-        free (arc);
+        dxf_string_free (arc->color_name);
+        dxf_free (arc);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -864,7 +793,7 @@ dxf_arc_free_list
  *
  * \return \c id_code.
  */
-int
+uint64_t
 dxf_arc_get_id_code
 (
         DxfArc *arc
@@ -882,12 +811,6 @@ dxf_arc_get_id_code
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (arc->id_code < 0)
-        {
-                fprintf (stderr,
-                  (_("Warning in %s () a negative value was found.\n")),
-                  __FUNCTION__);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -906,7 +829,7 @@ dxf_arc_set_id_code
 (
         DxfArc *arc,
                 /*!< a pointer to a DXF \c ARC entity. */
-        int id_code
+        uint64_t id_code
                 /*!< the \c id_code to be set for the entity.\n
                  * This is to be an unique (sequential) number in the
                  * DXF file. */
@@ -923,12 +846,6 @@ dxf_arc_set_id_code
                   __FUNCTION__);
                 return (NULL);
         }
-        if (id_code < 0)
-        {
-                fprintf (stderr,
-                  (_("Warning in %s () a negative value was passed.\n")),
-                  __FUNCTION__);
-        }
         arc->id_code = id_code;
 #if DEBUG
         DXF_DEBUG_END
@@ -970,7 +887,7 @@ dxf_arc_get_linetype
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (arc->linetype));
+        return (dxf_strdup (arc->linetype));
 }
 
 
@@ -1010,7 +927,7 @@ dxf_arc_set_linetype
                   __FUNCTION__);
                 return (NULL);
         }
-        arc->linetype = strdup (linetype);
+        arc->linetype = dxf_strdup (linetype);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1051,7 +968,7 @@ dxf_arc_get_layer
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (arc->layer));
+        return (dxf_strdup (arc->layer));
 }
 
 
@@ -1089,7 +1006,7 @@ dxf_arc_set_layer
                   __FUNCTION__);
                 return (NULL);
         }
-        arc->layer = strdup (layer);
+        arc->layer = dxf_strdup (layer);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1856,11 +1773,9 @@ dxf_arc_set_binary_graphics_data
  * \brief Get the pointer to the \c dictionary_owner_soft from a DXF 
  * \c ARC entity.
  *
- * \return pointer to the \c dictionary_owner_soft.
- *
- * \warning No checks are performed on the returned pointer (string).
+ * \return the handle of the \c dictionary_owner_soft.
  */
-char *
+uint64_t
 dxf_arc_get_dictionary_owner_soft
 (
         DxfArc *arc
@@ -1876,19 +1791,12 @@ dxf_arc_get_dictionary_owner_soft
                 fprintf (stderr,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
-                return (NULL);
-        }
-        if (arc->dictionary_owner_soft ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
+                return (0);
         }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (arc->dictionary_owner_soft));
+        return (arc->dictionary_owner_soft);
 }
 
 
@@ -1904,8 +1812,8 @@ dxf_arc_set_dictionary_owner_soft
 (
         DxfArc *arc,
                 /*!< a pointer to a DXF \c ARC entity. */
-        char *dictionary_owner_soft
-                /*!< a string containing the pointer to the \c
+        uint64_t dictionary_owner_soft
+                /*!< the handle of the \c
                  * dictionary_owner_soft for the entity. */
 )
 {
@@ -1920,14 +1828,7 @@ dxf_arc_set_dictionary_owner_soft
                   __FUNCTION__);
                 return (NULL);
         }
-        if (dictionary_owner_soft == NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was passed.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
-        arc->dictionary_owner_soft = strdup (dictionary_owner_soft);
+        arc->dictionary_owner_soft = dictionary_owner_soft;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1940,10 +1841,8 @@ dxf_arc_set_dictionary_owner_soft
  * \c ARC entity.
  *
  * \return soft pointer to the object owner.
- *
- * \warning No checks are performed on the returned pointer (string).
  */
-char *
+uint64_t
 dxf_arc_get_object_owner_soft
 (
         DxfArc *arc
@@ -1959,19 +1858,12 @@ dxf_arc_get_object_owner_soft
                 fprintf (stderr,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
-                return (NULL);
-        }
-        if (arc->object_owner_soft ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
+                return (0);
         }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (arc->object_owner_soft));
+        return (arc->object_owner_soft);
 }
 
 
@@ -1984,8 +1876,8 @@ dxf_arc_set_object_owner_soft
 (
         DxfArc *arc,
                 /*!< a pointer to a DXF \c ARC entity. */
-        char *object_owner_soft
-                /*!< a string containing the pointer to the
+        uint64_t object_owner_soft
+                /*!< the handle of the
                  * \c object_owner_soft for the entity. */
 )
 {
@@ -2000,14 +1892,7 @@ dxf_arc_set_object_owner_soft
                   __FUNCTION__);
                 return (NULL);
         }
-        if (object_owner_soft == NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was passed.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
-        arc->object_owner_soft = strdup (object_owner_soft);
+        arc->object_owner_soft = object_owner_soft;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2018,12 +1903,10 @@ dxf_arc_set_object_owner_soft
 /*!
  * \brief Get the pointer to the \c material from a DXF \c ARC entity.
  *
- * \return a pointer to \c material when successful, or \c NULL when an
+ * \return the handle \c material when successful, or 0 when an
  * error occurred.
- *
- * \warning No checks are performed on the returned pointer.
  */
-char *
+uint64_t
 dxf_arc_get_material
 (
         DxfArc *arc
@@ -2039,19 +1922,12 @@ dxf_arc_get_material
                 fprintf (stderr,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
-                return (NULL);
-        }
-        if (arc->material ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
+                return (0);
         }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (arc->material));
+        return (arc->material);
 }
 
 
@@ -2066,8 +1942,8 @@ dxf_arc_set_material
 (
         DxfArc *arc,
                 /*!< a pointer to a DXF \c ARC entity. */
-        char *material
-                /*!< a string containing the pointer to the \c
+        uint64_t material
+                /*!< the handle of the \c
                  * material for the entity. */
 )
 {
@@ -2082,14 +1958,7 @@ dxf_arc_set_material
                   __FUNCTION__);
                 return (NULL);
         }
-        if (material == NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was passed.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
-        arc->material = strdup (material);
+        arc->material = material;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2101,11 +1970,9 @@ dxf_arc_set_material
  * \brief Get the pointer to the \c dictionary_owner_hard from a DXF 
  * \c ARC entity.
  *
- * \return pointer to the \c dictionary_owner_hard.
- *
- * \warning No checks are performed on the returned pointer (string).
+ * \return the handle of the \c dictionary_owner_hard.
  */
-char *
+uint64_t
 dxf_arc_get_dictionary_owner_hard
 (
         DxfArc *arc
@@ -2121,19 +1988,12 @@ dxf_arc_get_dictionary_owner_hard
                 fprintf (stderr,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
-                return (NULL);
-        }
-        if (arc->dictionary_owner_hard ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
+                return (0);
         }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (arc->dictionary_owner_hard));
+        return (arc->dictionary_owner_hard);
 }
 
 
@@ -2149,8 +2009,8 @@ dxf_arc_set_dictionary_owner_hard
 (
         DxfArc *arc,
                 /*!< a pointer to a DXF \c ARC entity. */
-        char *dictionary_owner_hard
-                /*!< a string containing the pointer to the \c
+        uint64_t dictionary_owner_hard
+                /*!< the handle of the \c
                  * dictionary_owner_hard for the entity. */
 )
 {
@@ -2165,14 +2025,7 @@ dxf_arc_set_dictionary_owner_hard
                   __FUNCTION__);
                 return (NULL);
         }
-        if (dictionary_owner_hard == NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was passed.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
-        arc->dictionary_owner_hard = strdup (dictionary_owner_hard);
+        arc->dictionary_owner_hard = dictionary_owner_hard;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2248,10 +2101,10 @@ dxf_arc_set_lineweight
 /*!
  * \brief Get the \c plot_style_name from a DXF \c ARC entity.
  *
- * \return a pointer to \c plot_style_name when successful, or \c NULL
+ * \return the handle \c plot_style_name when successful, or 0
  * when an error occurred.
  */
-char *
+uint64_t
 dxf_arc_get_plot_style_name
 (
         DxfArc *arc
@@ -2267,19 +2120,12 @@ dxf_arc_get_plot_style_name
                 fprintf (stderr,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
-                return (NULL);
-        }
-        if (arc->plot_style_name ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
+                return (0);
         }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (arc->plot_style_name));
+        return (arc->plot_style_name);
 }
 
 
@@ -2294,7 +2140,7 @@ dxf_arc_set_plot_style_name
 (
         DxfArc *arc,
                 /*!< a pointer to a DXF \c ARC entity. */
-        char *plot_style_name
+        uint64_t plot_style_name
                 /*!< a string containing the \c plot_style_name for the
                  * entity. */
 )
@@ -2310,14 +2156,7 @@ dxf_arc_set_plot_style_name
                   __FUNCTION__);
                 return (NULL);
         }
-        if (plot_style_name == NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was passed.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
-        arc->plot_style_name = strdup (plot_style_name);
+        arc->plot_style_name = plot_style_name;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2424,7 +2263,7 @@ dxf_arc_get_color_name
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (arc->color_name));
+        return (dxf_strdup (arc->color_name));
 }
 
 
@@ -2462,7 +2301,7 @@ dxf_arc_set_color_name
                   __FUNCTION__);
                 return (NULL);
         }
-        arc->color_name = strdup (color_name);
+        arc->color_name = dxf_strdup (color_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2540,7 +2379,7 @@ dxf_arc_set_transparency
  *
  * \return the center point \c p0.
  */
-DxfPoint *
+DxfVec3 *
 dxf_arc_get_p0
 (
         DxfArc *arc
@@ -2558,17 +2397,10 @@ dxf_arc_get_p0
                   __FUNCTION__);
                 return (NULL);
         }
-        if (arc->p0 == NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (arc->p0);
+        return (&arc->p0);
 }
 
 
@@ -2583,8 +2415,8 @@ dxf_arc_set_p0
 (
         DxfArc *arc,
                 /*!< a pointer to a DXF \c ARC entity. */
-        DxfPoint *p0
-                /*!< a pointer to a DXF \c POINT entity. */
+        DxfVec3 *p0
+                /*!< a pointer to the coordinates. */
 )
 {
 #ifdef DEBUG
@@ -2605,7 +2437,7 @@ dxf_arc_set_p0
                   __FUNCTION__);
                 return (NULL);
         }
-        arc->p0 = p0;
+        arc->p0 = *p0;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2638,17 +2470,10 @@ dxf_arc_get_x0
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (arc->p0 == NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (EXIT_FAILURE);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (arc->p0->x0);
+        return (arc->p0.x);
 }
 
 
@@ -2680,23 +2505,7 @@ dxf_arc_set_x0
                   __FUNCTION__);
                 return (NULL);
         }
-        if (arc->p0 == NULL)
-        {
-                fprintf (stderr,
-                  (_("Warning in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                fprintf (stderr,
-                  (_("Initializing a DxfPoint.\n")));
-                arc->p0 = dxf_point_init (arc->p0);
-                if (arc->p0 == NULL)
-                {
-                        fprintf (stderr,
-                          (_("Error in %s () could not allocate memory.\n")),
-                          __FUNCTION__);
-                        return (NULL);
-                }
-        }
-        arc->p0->x0 = x0;
+        arc->p0.x = x0;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2729,17 +2538,10 @@ dxf_arc_get_y0
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (arc->p0 == NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (EXIT_FAILURE);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (arc->p0->y0);
+        return (arc->p0.y);
 }
 
 
@@ -2771,23 +2573,7 @@ dxf_arc_set_y0
                   __FUNCTION__);
                 return (NULL);
         }
-        if (arc->p0 == NULL)
-        {
-                fprintf (stderr,
-                  (_("Warning in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                fprintf (stderr,
-                  (_("Initializing a DxfPoint.\n")));
-                arc->p0 = dxf_point_init (arc->p0);
-                if (arc->p0 == NULL)
-                {
-                        fprintf (stderr,
-                          (_("Error in %s () could not allocate memory.\n")),
-                          __FUNCTION__);
-                        return (NULL);
-                }
-        }
-        arc->p0->y0 = y0;
+        arc->p0.y = y0;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2820,17 +2606,10 @@ dxf_arc_get_z0
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (arc->p0 == NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (EXIT_FAILURE);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (arc->p0->z0);
+        return (arc->p0.z);
 }
 
 
@@ -2862,23 +2641,7 @@ dxf_arc_set_z0
                   __FUNCTION__);
                 return (NULL);
         }
-        if (arc->p0 == NULL)
-        {
-                fprintf (stderr,
-                  (_("Warning in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                fprintf (stderr,
-                  (_("Initializing a DxfPoint.\n")));
-                arc->p0 = dxf_point_init (arc->p0);
-                if (arc->p0 == NULL)
-                {
-                        fprintf (stderr,
-                          (_("Error in %s () could not allocate memory.\n")),
-                          __FUNCTION__);
-                        return (NULL);
-                }
-        }
-        arc->p0->z0 = z0;
+        arc->p0.z = z0;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -3605,4 +3368,121 @@ dxf_arc_get_last
 }
 
 
+/*!
+ * \brief Get the bounding box of a DXF \c ARC.
+ *
+ * The box of the start point, the end point and the points at 0, 90,
+ * 180 and 270 degrees passed by the counterclockwise sweep of \c arc,
+ * in the plane of it's Object Coordinate System (OCS), see
+ * dxf_bbox_add_ocs_arc ().
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_arc_get_bbox
+(
+        DxfArc *arc,
+                /*!< a pointer to a DXF \c ARC entity. */
+        DxfBbox *bbox
+                /*!< a pointer to the libDXF bounding box to fill. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfVec3 extrusion;
+
+        /* Do some basic checks. */
+        if ((arc == NULL) || (bbox == NULL))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        extrusion.x = arc->extr_x0;
+        extrusion.y = arc->extr_y0;
+        extrusion.z = arc->extr_z0;
+        dxf_bbox_init (bbox);
+        dxf_bbox_add_ocs_arc (bbox, &extrusion, &arc->p0, arc->radius,
+          arc->start_angle, arc->end_angle);
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Transform a DXF \c ARC entity in place.
+ *
+ * The entity lies in the plane of it's Object Coordinate System
+ * (OCS), \c transform has to map this plane with a uniform scale,
+ * see dxf_transform_get_ocs_transform ().\n
+ * The start angle and end angle follow the rotation within the plane.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred, or when \c transform does not map the entity without
+ * distortion.
+ */
+int
+dxf_arc_transform
+(
+        DxfArc *arc,
+                /*!< a pointer to a DXF \c ARC entity. */
+        DxfTransform *transform
+                /*!< a pointer to a libDXF affine transformation. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfTransform ocs;
+        DxfVec3 extrusion;
+        double scale;
+        double rotation;
+
+        /* Do some basic checks. */
+        if ((arc == NULL) || (transform == NULL))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        extrusion.x = arc->extr_x0;
+        extrusion.y = arc->extr_y0;
+        extrusion.z = arc->extr_z0;
+        if (dxf_transform_get_ocs_transform (transform, &extrusion, &ocs, &scale) == EXIT_FAILURE)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () the transformation distorts the ARC entity with id-code: %" PRIx64 "\n")),
+                  __FUNCTION__, arc->id_code);
+                return (EXIT_FAILURE);
+        }
+        dxf_transform_apply_point (&ocs, &arc->p0, &arc->p0);
+        arc->radius *= scale;
+        rotation = atan2 (ocs.m[1][0], ocs.m[0][0]) * 180.0 / M_PI;
+        arc->start_angle = fmod (arc->start_angle + rotation, 360.0);
+        if (arc->start_angle < 0.0)
+        {
+                arc->start_angle += 360.0;
+        }
+        arc->end_angle = fmod (arc->end_angle + rotation, 360.0);
+        if (arc->end_angle < 0.0)
+        {
+                arc->end_angle += 360.0;
+        }
+        arc->extr_x0 = extrusion.x;
+        arc->extr_y0 = extrusion.y;
+        arc->extr_z0 = extrusion.z;
+        arc->thickness *= ocs.m[2][2];
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (EXIT_SUCCESS);
+}
+
+
 /* EOF*/
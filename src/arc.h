@@ -40,6 +40,7 @@
 #include "global.h"
 #include "point.h"
 #include "binary_data.h"
+#include "transform.h"
 
 
 #ifdef __cplusplus
@@ -60,7 +61,7 @@ typedef struct
 dxf_arc_struct
 {
         /* Members common for all DXF drawable entities. */
-        int id_code;
+        uint64_t id_code;
                 /*!< Identification number for the entity.\n
                  * This is to be an unique (sequential) number in the DXF
                  * file.\n
@@ -133,20 +134,20 @@ dxf_arc_struct
                  * (optional).\n
                  * Group code = 310.\n
                  * \since Introduced in version R2000. */
-        char *dictionary_owner_soft;
+        uint64_t dictionary_owner_soft;
                 /*!< Soft-pointer ID/handle to owner dictionary (optional).\n
                  * Group code = 330.\n
                  * \since Introduced in version R14. */
-        char *object_owner_soft;
+        uint64_t object_owner_soft;
                 /*!< Soft-pointer ID/handle  to owner BLOCK_RECORD object.\n
                  * Group code = 330.\n
                  * \since Introduced in version R2000. */
-        char *material;
+        uint64_t material;
                 /*!< Hard-pointer ID/handle to material object (present if
                  * not BYLAYER).\n
                  * Group code = 347.\n
                  * \since Introduced in version R2008. */
-        char *dictionary_owner_hard;
+        uint64_t dictionary_owner_hard;
                 /*!< Hard owner ID/handle to owner dictionary (optional).\n
                  * Group code = 360.\n
                  * \since Introduced in version R14. */
@@ -155,7 +156,7 @@ dxf_arc_struct
                  * Stored and moved around as a 16-bit integer.\n
                  * Group code = 370.\n
                  * \since Introduced in version R2002. */
-        char *plot_style_name;
+        uint64_t plot_style_name;
                 /*!< Hard pointer ID / handle of PlotStyleName object.\n
                  * Group code = 390.\n
                  * \since Introduced in version R2009. */
@@ -188,7 +189,7 @@ dxf_arc_struct
                  * Group code = 440.\n
                  * \since Introduced in version R2004. */
         /* Specific members for a DXF arc. */
-        DxfPoint *p0;
+        DxfVec3 p0;
                 /*!< Center point.\n
                  * Group codes = 10, 20 and 30.*/
         double radius;
@@ -224,8 +225,8 @@ DxfArc *dxf_arc_read (DxfFile *fp, DxfArc *arc);
 int dxf_arc_write (DxfFile *fp, DxfArc *arc);
 int dxf_arc_free (DxfArc *arc);
 void dxf_arc_free_list (DxfArc *arcs);
-int dxf_arc_get_id_code (DxfArc *arc);
-DxfArc *dxf_arc_set_id_code (DxfArc *arc, int id_code);
+uint64_t dxf_arc_get_id_code (DxfArc *arc);
+DxfArc *dxf_arc_set_id_code (DxfArc *arc, uint64_t id_code);
 char *dxf_arc_get_linetype (DxfArc *arc);
 DxfArc *dxf_arc_set_linetype (DxfArc *arc, char *linetype);
 char *dxf_arc_get_layer (DxfArc *arc);
@@ -248,26 +249,26 @@ int16_t dxf_arc_get_shadow_mode (DxfArc *arc);
 DxfArc *dxf_arc_set_shadow_mode (DxfArc *arc, int16_t shadow_mode);
 DxfBinaryData *dxf_arc_get_binary_graphics_data (DxfArc *arc);
 DxfArc *dxf_arc_set_binary_graphics_data (DxfArc *arc, DxfBinaryData *data);
-char *dxf_arc_get_dictionary_owner_soft (DxfArc *arc);
-DxfArc *dxf_arc_set_dictionary_owner_soft (DxfArc *arc, char *dictionary_owner_soft);
-char *dxf_arc_get_object_owner_soft (DxfArc *arc);
-DxfArc *dxf_arc_set_object_owner_soft (DxfArc *arc, char *object_owner_soft);
-char *dxf_arc_get_material (DxfArc *arc);
-DxfArc *dxf_arc_set_material (DxfArc *arc, char *material);
-char *dxf_arc_get_dictionary_owner_hard (DxfArc *arc);
-DxfArc *dxf_arc_set_dictionary_owner_hard (DxfArc *arc, char *dictionary_owner_hard);
+uint64_t dxf_arc_get_dictionary_owner_soft (DxfArc *arc);
+DxfArc *dxf_arc_set_dictionary_owner_soft (DxfArc *arc, uint64_t dictionary_owner_soft);
+uint64_t dxf_arc_get_object_owner_soft (DxfArc *arc);
+DxfArc *dxf_arc_set_object_owner_soft (DxfArc *arc, uint64_t object_owner_soft);
+uint64_t dxf_arc_get_material (DxfArc *arc);
+DxfArc *dxf_arc_set_material (DxfArc *arc, uint64_t material);
+uint64_t dxf_arc_get_dictionary_owner_hard (DxfArc *arc);
+DxfArc *dxf_arc_set_dictionary_owner_hard (DxfArc *arc, uint64_t dictionary_owner_hard);
 int16_t dxf_arc_get_lineweight (DxfArc *arc);
 DxfArc *dxf_arc_set_lineweight (DxfArc *arc, int16_t lineweight);
-char *dxf_arc_get_plot_style_name (DxfArc *arc);
-DxfArc *dxf_arc_set_plot_style_name (DxfArc *arc, char *plot_style_name);
+uint64_t dxf_arc_get_plot_style_name (DxfArc *arc);
+DxfArc *dxf_arc_set_plot_style_name (DxfArc *arc, uint64_t plot_style_name);
 int32_t dxf_arc_get_color_value (DxfArc *arc);
 DxfArc *dxf_arc_set_color_value (DxfArc *arc, int32_t color_value);
 char *dxf_arc_get_color_name (DxfArc *arc);
 DxfArc *dxf_arc_set_color_name (DxfArc *arc, char *color_name);
 int32_t dxf_arc_get_transparency (DxfArc *arc);
 DxfArc *dxf_arc_set_transparency (DxfArc *arc, int32_t transparency);
-DxfPoint *dxf_arc_get_p0 (DxfArc *arc);
-DxfArc *dxf_arc_set_p0 (DxfArc *arc, DxfPoint *p0);
+DxfVec3 *dxf_arc_get_p0 (DxfArc *arc);
+DxfArc *dxf_arc_set_p0 (DxfArc *arc, DxfVec3 *p0);
 double dxf_arc_get_x0 (DxfArc *arc);
 DxfArc *dxf_arc_set_x0 (DxfArc *arc, double x0);
 double dxf_arc_get_y0 (DxfArc *arc);
@@ -293,6 +294,8 @@ DxfArc *dxf_arc_set_extrusion_vector (DxfArc *arc, double extr_x0, double extr_y
 DxfArc *dxf_arc_get_next (DxfArc *arc);
 DxfArc *dxf_arc_set_next (DxfArc *arc, DxfArc *next);
 DxfArc *dxf_arc_get_last (DxfArc *arc);
+int dxf_arc_get_bbox (DxfArc *arc, DxfBbox *bbox);
+int dxf_arc_transform (DxfArc *arc, DxfTransform *transform);
 
 
 #ifdef __cplusplus
@@ -0,0 +1,851 @@
+/*!
+ * \file arena.c
+ *
+ * \author Copyright (C) 2026
+ * by Bert Timmerman <bert.timmerman@xs4all.nl>.
+ *
+ * \brief Functions for a libDXF arena (drawing scoped memory).
+ *
+ * Parsing a drawing creates millions of small entities, strings and
+ * lists, each allocated with its own malloc () call and freed one by
+ * one.\n
+ * An arena hands out memory from large chunks by bumping a pointer,
+ * and releases all of it at once by freeing the chunks.
+ *
+ * <hr>
+ * <h1><b>Copyright Notices.</b></h1>\n
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License,
+ * or (at your option) any later version.\n\n
+ * This program is distributed in the hope that it will be useful, but
+ * <b>WITHOUT ANY WARRANTY</b>; without even the implied warranty of
+ * <b>MERCHANTABILITY</b> or <b>FITNESS FOR A PARTICULAR PURPOSE</b>.\n
+ * See the GNU General Public License for more details.\n\n
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to:\n
+ * Free Software Foundation, Inc.,\n
+ * 59 Temple Place,\n
+ * Suite 330,\n
+ * Boston,\n
+ * MA 02111 USA.\n
+ * \n
+ * Drawing eXchange Format (DXF) is a defacto industry standard for the
+ * exchange of drawing files between various Computer Aided Drafting
+ * programs.\n
+ * DXF is an industry standard designed by Autodesk(TM).\n
+ * For more details see http://www.autodesk.com.
+ * <hr>
+ */
+
+
+#include "arena.h"
+
+#if !defined (_WIN32)
+#  include <pthread.h>
+#  define DXF_ARENA_PTHREADS 1
+#endif
+
+
+/*!
+ * \brief Alignment of every allocation from a \c DxfArena.
+ */
+#define DXF_ARENA_ALIGNMENT 16
+
+
+/*!
+ * \brief Allocations larger than this fraction of the chunk size get a
+ * chunk of their own.
+ */
+#define DXF_ARENA_LARGE_FRACTION 4
+
+
+#if defined (_MSC_VER)
+#  define DXF_THREAD_LOCAL __declspec(thread)
+#else
+#  define DXF_THREAD_LOCAL __thread
+#endif
+
+
+/*!
+ * \brief DXF definition of the address range of a chunk of a live
+ * \c DxfArena or \c DxfStringPool.
+ */
+typedef struct
+dxf_arena_range_struct
+{
+    uintptr_t start;
+        /*!< Address of the first byte of the chunk. */
+    uintptr_t end;
+        /*!< Address past the last byte of the chunk. */
+    const void *owner;
+        /*!< The arena or string pool owning the chunk. */
+    int type;
+        /*!< The \c DXF_ARENA_OWNER_* type of \c owner. */
+} DxfArenaRange;
+
+
+/*!
+ * \brief Address ranges of the chunks of all live arenas and string
+ * pools, sorted on address, used by dxf_free (), dxf_realloc () and
+ * dxf_string_is_interned ().
+ */
+static DxfArenaRange *dxf_arena_ranges = NULL;
+
+
+/*!
+ * \brief Number of ranges in \c dxf_arena_ranges.
+ */
+static size_t dxf_arena_number_ranges = 0;
+
+
+/*!
+ * \brief Number of ranges allocated in \c dxf_arena_ranges.
+ */
+static size_t dxf_arena_max_ranges = 0;
+
+
+#if DXF_ARENA_PTHREADS
+/*!
+ * \brief Lock guarding \c dxf_arena_ranges, held for reading by
+ * dxf_free () and for writing while chunks are added or released.
+ */
+static pthread_rwlock_t dxf_arena_ranges_lock = PTHREAD_RWLOCK_INITIALIZER;
+#endif
+
+
+/*!
+ * \brief The arena \c dxf_malloc () allocates from in this thread,
+ * \c NULL for the heap.
+ */
+static DXF_THREAD_LOCAL DxfArena *dxf_arena_current = NULL;
+
+
+/*!
+ * \brief Get the number of ranges in \c dxf_arena_ranges without taking
+ * the lock.
+ *
+ * Only used to skip the lookup while no arena has any chunk, memory of
+ * an arena is registered before it is handed out.
+ */
+static size_t
+dxf_arena_get_number_ranges ()
+{
+#ifdef __GNUC__
+        return (__atomic_load_n (&dxf_arena_number_ranges, __ATOMIC_ACQUIRE));
+#else
+        return (dxf_arena_number_ranges);
+#endif
+}
+
+
+/*!
+ * \brief Register the address range of a new chunk of an arena or a
+ * string pool.
+ *
+ * Memory in a registered chunk is left alone by dxf_free () until the
+ * chunk is unregistered with dxf_arena_unregister_chunks ().
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when no memory
+ * was allocated.
+ */
+int
+dxf_arena_register_chunk
+(
+        const void *owner,
+                /*!< The arena or string pool owning the chunk. */
+        int type,
+                /*!< The \c DXF_ARENA_OWNER_* type of \c owner. */
+        const void *data,
+                /*!< Start of the chunk. */
+        size_t size
+                /*!< Size of the chunk. */
+)
+{
+        DxfArenaRange *ranges;
+        size_t max_ranges;
+        size_t low;
+        size_t high;
+        size_t mid;
+        int result = EXIT_SUCCESS;
+
+#if DXF_ARENA_PTHREADS
+        pthread_rwlock_wrlock (&dxf_arena_ranges_lock);
+#endif
+        if (dxf_arena_number_ranges == dxf_arena_max_ranges)
+        {
+                max_ranges = dxf_arena_max_ranges ? 2 * dxf_arena_max_ranges : 64;
+                ranges = realloc (dxf_arena_ranges, max_ranges * sizeof (DxfArenaRange));
+                if (ranges == NULL)
+                {
+                        fprintf (stderr,
+                          (_("Error in %s () could not allocate memory.\n")),
+                          __FUNCTION__);
+                        result = EXIT_FAILURE;
+                        goto unlock;
+                }
+                dxf_arena_ranges = ranges;
+                dxf_arena_max_ranges = max_ranges;
+        }
+        /* Binary search for the insertion point. */
+        low = 0;
+        high = dxf_arena_number_ranges;
+        while (low < high)
+        {
+                mid = low + (high - low) / 2;
+                if (dxf_arena_ranges[mid].start < (uintptr_t) data)
+                {
+                        low = mid + 1;
+                }
+                else
+                {
+                        high = mid;
+                }
+        }
+        memmove (&dxf_arena_ranges[low + 1], &dxf_arena_ranges[low],
+          (dxf_arena_number_ranges - low) * sizeof (DxfArenaRange));
+        dxf_arena_ranges[low].start = (uintptr_t) data;
+        dxf_arena_ranges[low].end = (uintptr_t) data + size;
+        dxf_arena_ranges[low].owner = owner;
+        dxf_arena_ranges[low].type = type;
+#ifdef __GNUC__
+        __atomic_store_n (&dxf_arena_number_ranges, dxf_arena_number_ranges + 1, __ATOMIC_RELEASE);
+#else
+        dxf_arena_number_ranges++;
+#endif
+unlock:
+#if DXF_ARENA_PTHREADS
+        pthread_rwlock_unlock (&dxf_arena_ranges_lock);
+#endif
+        return (result);
+}
+
+
+/*!
+ * \brief Unregister the address ranges of all chunks of an arena or a
+ * string pool.
+ */
+void
+dxf_arena_unregister_chunks
+(
+        const void *owner
+                /*!< The arena or string pool owning the chunks. */
+)
+{
+        size_t i;
+        size_t j = 0;
+
+#if DXF_ARENA_PTHREADS
+        pthread_rwlock_wrlock (&dxf_arena_ranges_lock);
+#endif
+        for (i = 0; i < dxf_arena_number_ranges; i++)
+        {
+                if (dxf_arena_ranges[i].owner != owner)
+                {
+                        dxf_arena_ranges[j++] = dxf_arena_ranges[i];
+                }
+        }
+#ifdef __GNUC__
+        __atomic_store_n (&dxf_arena_number_ranges, j, __ATOMIC_RELEASE);
+#else
+        dxf_arena_number_ranges = j;
+#endif
+#if DXF_ARENA_PTHREADS
+        pthread_rwlock_unlock (&dxf_arena_ranges_lock);
+#endif
+}
+
+
+/*!
+ * \brief Find the live arena or string pool owning memory.
+ *
+ * \return the owner of the chunk \c ptr points into, or \c NULL for
+ * heap memory.
+ */
+const void *
+dxf_arena_find_owner
+(
+        const void *ptr,
+                /*!< Pointer to test. */
+        int *type
+                /*!< Returns the \c DXF_ARENA_OWNER_* type of the
+                 * owner, may be \c NULL. */
+)
+{
+        uintptr_t p = (uintptr_t) ptr;
+        const void *result = NULL;
+        size_t low;
+        size_t high;
+        size_t mid;
+
+        if ((ptr == NULL) || (dxf_arena_get_number_ranges () == 0))
+        {
+                return (NULL);
+        }
+#if DXF_ARENA_PTHREADS
+        pthread_rwlock_rdlock (&dxf_arena_ranges_lock);
+#endif
+        /* Binary search for the first range starting after ptr. */
+        low = 0;
+        high = dxf_arena_number_ranges;
+        while (low < high)
+        {
+                mid = low + (high - low) / 2;
+                if (dxf_arena_ranges[mid].start <= p)
+                {
+                        low = mid + 1;
+                }
+                else
+                {
+                        high = mid;
+                }
+        }
+        if ((low > 0) && (p < dxf_arena_ranges[low - 1].end))
+        {
+                result = dxf_arena_ranges[low - 1].owner;
+                if (type != NULL)
+                {
+                        *type = dxf_arena_ranges[low - 1].type;
+                }
+        }
+#if DXF_ARENA_PTHREADS
+        pthread_rwlock_unlock (&dxf_arena_ranges_lock);
+#endif
+        return (result);
+}
+
+
+/*!
+ * \brief Allocate a new chunk of at least \c size bytes and insert it
+ * in the address ordered chunk table of an arena.
+ *
+ * \return a pointer to the data of the new chunk, or \c NULL when no
+ * memory was allocated.
+ */
+static char *
+dxf_arena_add_chunk
+(
+        DxfArena *arena,
+                /*!< a pointer to a libDXF arena. */
+        size_t size
+                /*!< Minimum size of the chunk. */
+)
+{
+        DxfArenaChunk *chunks;
+        char *data;
+        int i;
+
+        if (arena->number_chunks == arena->max_chunks)
+        {
+                chunks = realloc (arena->chunks,
+                  (arena->max_chunks ? 2 * arena->max_chunks : 16)
+                  * sizeof (DxfArenaChunk));
+                if (chunks == NULL)
+                {
+                        fprintf (stderr,
+                          (_("Error in %s () could not allocate memory.\n")),
+                          __FUNCTION__);
+                        return (NULL);
+                }
+                arena->chunks = chunks;
+                arena->max_chunks = arena->max_chunks ? 2 * arena->max_chunks : 16;
+        }
+        if ((data = malloc (size)) == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () could not allocate memory.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        if (dxf_arena_register_chunk (arena, DXF_ARENA_OWNER_ARENA, data, size) == EXIT_FAILURE)
+        {
+                free (data);
+                return (NULL);
+        }
+        /* Keep the table sorted on address, chunks are few compared to
+         * allocations, so an insertion sort step is cheap. */
+        i = arena->number_chunks;
+        while ((i > 0)
+          && ((uintptr_t) arena->chunks[i - 1].data > (uintptr_t) data))
+        {
+                arena->chunks[i] = arena->chunks[i - 1];
+                i--;
+        }
+        arena->chunks[i].data = data;
+        arena->chunks[i].size = size;
+        arena->number_chunks++;
+        return (data);
+}
+
+
+/*!
+ * \brief Allocate memory for a libDXF \c DxfArena.
+ *
+ * The arena does not become the current arena, see
+ * dxf_arena_set_current ().
+ *
+ * \return \c NULL when no memory was allocated, a pointer to the
+ * allocated memory when successful.
+ */
+DxfArena *
+dxf_arena_new
+(
+        size_t chunk_size
+                /*!< Size of a chunk, 0 for \c DXF_ARENA_CHUNK_SIZE. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfArena *arena = NULL;
+
+        if ((arena = malloc (sizeof (DxfArena))) == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () could not allocate memory.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        memset (arena, 0, sizeof (DxfArena));
+        arena->chunk_size = (chunk_size == 0) ? DXF_ARENA_CHUNK_SIZE : chunk_size;
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (arena);
+}
+
+
+/*!
+ * \brief Free the allocated memory for a libDXF \c DxfArena and
+ * everything allocated from it.
+ *
+ * When \c arena is the current arena of the calling thread, the
+ * calling thread allocates from the heap again.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_arena_free
+(
+        DxfArena *arena
+                /*!< a pointer to the memory occupied by the libDXF
+                 * arena. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        int i;
+
+        /* Do some basic checks. */
+        if (arena == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        if (dxf_arena_current == arena)
+        {
+                dxf_arena_current = NULL;
+        }
+        if (arena->number_chunks > 0)
+        {
+                dxf_arena_unregister_chunks (arena);
+        }
+        for (i = 0; i < arena->number_chunks; i++)
+        {
+                free (arena->chunks[i].data);
+        }
+        free (arena->chunks);
+        free (arena);
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Allocate memory from a libDXF \c DxfArena.
+ *
+ * The memory is aligned on \c DXF_ARENA_ALIGNMENT bytes and is \b not
+ * cleared.
+ *
+ * \return a pointer to the allocated memory, or \c NULL when no memory
+ * was allocated.
+ */
+void *
+dxf_arena_alloc
+(
+        DxfArena *arena,
+                /*!< a pointer to a libDXF arena. */
+        size_t size
+                /*!< Number of bytes to allocate. */
+)
+{
+        char *result;
+
+        /* Do some basic checks. */
+        if (arena == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        /* avoid allocations of 0 bytes */
+        if (size == 0) size = 1;
+        size = (size + DXF_ARENA_ALIGNMENT - 1) & ~((size_t) DXF_ARENA_ALIGNMENT - 1);
+        if (size > arena->chunk_size / DXF_ARENA_LARGE_FRACTION)
+        {
+                /* Large blocks get a chunk of their own, so the tail of
+                 * the current chunk is not wasted. */
+                result = dxf_arena_add_chunk (arena, size);
+                if (result != NULL)
+                {
+                        arena->allocated += size;
+                }
+                return (result);
+        }
+        if ((arena->cursor == NULL)
+          || ((size_t) (arena->limit - arena->cursor) < size))
+        {
+                result = dxf_arena_add_chunk (arena, arena->chunk_size);
+                if (result == NULL)
+                {
+                        return (NULL);
+                }
+                arena->cursor = result;
+                arena->limit = result + arena->chunk_size;
+        }
+        result = arena->cursor;
+        arena->cursor += size;
+        arena->allocated += size;
+        return (result);
+}
+
+
+/*!
+ * \brief Test if memory was allocated from a libDXF \c DxfArena.
+ *
+ * \return \c TRUE when \c ptr points into a chunk of \c arena,
+ * \c FALSE otherwise.
+ */
+int
+dxf_arena_owns
+(
+        DxfArena *arena,
+                /*!< a pointer to a libDXF arena. */
+        const void *ptr
+                /*!< Pointer to test. */
+)
+{
+        uintptr_t p = (uintptr_t) ptr;
+        int low;
+        int high;
+        int mid;
+
+        if ((arena == NULL) || (ptr == NULL))
+        {
+                return (FALSE);
+        }
+        /* Binary search for the last chunk starting at or before ptr. */
+        low = 0;
+        high = arena->number_chunks - 1;
+        while (low <= high)
+        {
+                mid = low + (high - low) / 2;
+                if ((uintptr_t) arena->chunks[mid].data <= p)
+                {
+                        low = mid + 1;
+                }
+                else
+                {
+                        high = mid - 1;
+                }
+        }
+        if (high < 0)
+        {
+                return (FALSE);
+        }
+        return (p < (uintptr_t) arena->chunks[high].data + arena->chunks[high].size);
+}
+
+
+/*!
+ * \brief Move all memory of a libDXF \c DxfArena into another arena
+ * and free it.
+ *
+ * Used to gather the arenas of worker threads into the arena of a
+ * drawing, in O(chunks), without copying any allocation.\n
+ * Allocations keep bumping from the current chunk of \c arena, the
+ * unused tail of the last chunk of \c source is not reused.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred, in which case \c source is left untouched.
+ */
+int
+dxf_arena_merge
+(
+        DxfArena *arena,
+                /*!< a pointer to the libDXF arena receiving the
+                 * memory. */
+        DxfArena *source
+                /*!< a pointer to the libDXF arena to empty and free. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfArenaChunk *chunks;
+        size_t i;
+        int a;
+        int b;
+        int n;
+
+        /* Do some basic checks. */
+        if ((arena == NULL) || (source == NULL) || (arena == source))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        if (source->number_chunks > 0)
+        {
+                chunks = malloc ((arena->number_chunks + source->number_chunks)
+                  * sizeof (DxfArenaChunk));
+                if (chunks == NULL)
+                {
+                        fprintf (stderr,
+                          (_("Error in %s () could not allocate memory.\n")),
+                          __FUNCTION__);
+                        return (EXIT_FAILURE);
+                }
+                /* Merge the address ordered chunk tables. */
+                a = 0;
+                b = 0;
+                n = 0;
+                while ((a < arena->number_chunks) || (b < source->number_chunks))
+                {
+                        if ((b == source->number_chunks)
+                          || ((a < arena->number_chunks)
+                          && ((uintptr_t) arena->chunks[a].data < (uintptr_t) source->chunks[b].data)))
+                        {
+                                chunks[n++] = arena->chunks[a++];
+                        }
+                        else
+                        {
+                                chunks[n++] = source->chunks[b++];
+                        }
+                }
+                free (arena->chunks);
+                arena->chunks = chunks;
+                arena->number_chunks = n;
+                arena->max_chunks = n;
+                /* Hand the registered chunks over to arena. */
+#if DXF_ARENA_PTHREADS
+                pthread_rwlock_wrlock (&dxf_arena_ranges_lock);
+#endif
+                for (i = 0; i < dxf_arena_number_ranges; i++)
+                {
+                        if (dxf_arena_ranges[i].owner == source)
+                        {
+                                dxf_arena_ranges[i].owner = arena;
+                        }
+                }
+#if DXF_ARENA_PTHREADS
+                pthread_rwlock_unlock (&dxf_arena_ranges_lock);
+#endif
+        }
+        arena->allocated += source->allocated;
+        if (dxf_arena_current == source)
+        {
+                dxf_arena_current = NULL;
+        }
+        free (source->chunks);
+        free (source);
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Get the number of bytes allocated from a libDXF
+ * \c DxfArena.
+ *
+ * \return the number of bytes handed out, including alignment padding.
+ */
+size_t
+dxf_arena_get_allocated
+(
+        DxfArena *arena
+                /*!< a pointer to a libDXF arena. */
+)
+{
+        /* Do some basic checks. */
+        if (arena == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (0);
+        }
+        return (arena->allocated);
+}
+
+
+/*!
+ * \brief Get the current arena of the calling thread.
+ *
+ * \return the current arena, or \c NULL when the calling thread
+ * allocates from the heap.
+ */
+DxfArena *
+dxf_arena_get_current ()
+{
+        return (dxf_arena_current);
+}
+
+
+/*!
+ * \brief Set the current arena of the calling thread.
+ *
+ * \return the previous current arena, so it can be restored.
+ */
+DxfArena *
+dxf_arena_set_current
+(
+        DxfArena *arena
+                /*!< a pointer to a libDXF arena, or \c NULL to allocate
+                 * from the heap. */
+)
+{
+        DxfArena *previous = dxf_arena_current;
+
+        dxf_arena_current = arena;
+        return (previous);
+}
+
+
+/*!
+ * \brief Allocate memory from the current arena, or from the heap when
+ * there is no current arena.
+ *
+ * \return a pointer to the allocated memory, or \c NULL when no memory
+ * was allocated.
+ */
+void *
+dxf_malloc
+(
+        size_t size
+                /*!< Number of bytes to allocate. */
+)
+{
+        if (dxf_arena_current != NULL)
+        {
+                return (dxf_arena_alloc (dxf_arena_current, size));
+        }
+        return (malloc (size));
+}
+
+
+/*!
+ * \brief Resize memory allocated with dxf_malloc ().
+ *
+ * Arena memory can not grow in place, the contents are copied to a new
+ * allocation, so the caller has to pass the old size.
+ *
+ * \return a pointer to the resized memory, or \c NULL when no memory
+ * was allocated, in which case \c ptr is left untouched.
+ */
+void *
+dxf_realloc
+(
+        void *ptr,
+                /*!< Pointer to the memory to resize, may be \c NULL. */
+        size_t old_size,
+                /*!< Number of valid bytes at \c ptr. */
+        size_t new_size
+                /*!< Number of bytes requested. */
+)
+{
+        void *result;
+        int owned;
+
+        owned = (dxf_arena_find_owner (ptr, NULL) != NULL);
+        if (owned && (new_size <= old_size))
+        {
+                return (ptr);
+        }
+        if (!owned && (dxf_arena_current == NULL))
+        {
+                return (realloc (ptr, new_size));
+        }
+        if ((result = dxf_malloc (new_size)) == NULL)
+        {
+                return (NULL);
+        }
+        if (ptr != NULL)
+        {
+                memcpy (result, ptr, (old_size < new_size) ? old_size : new_size);
+                dxf_free (ptr);
+        }
+        return (result);
+}
+
+
+/*!
+ * \brief Duplicate a string with dxf_malloc ().
+ *
+ * \return a pointer to the copy, or \c NULL when no memory was
+ * allocated.
+ */
+char *
+dxf_strdup
+(
+        const char *s
+                /*!< String to copy. */
+)
+{
+        char *result;
+        size_t size = strlen (s) + 1;
+
+        if ((result = dxf_malloc (size)) == NULL)
+        {
+                return (NULL);
+        }
+        memcpy (result, s, size);
+        return (result);
+}
+
+
+/*!
+ * \brief Free memory allocated with dxf_malloc ().
+ *
+ * Memory owned by a live arena or string pool is left alone, it is
+ * released with it's owner, any other memory is passed to free ().\n
+ * Safe to call from several threads at once, also while arenas are
+ * created or freed.
+ */
+void
+dxf_free
+(
+        void *ptr
+                /*!< Pointer to the memory to free, may be \c NULL. */
+)
+{
+        if ((ptr == NULL)
+          || (dxf_arena_find_owner (ptr, NULL) != NULL))
+        {
+                return;
+        }
+        free (ptr);
+}
+
+
+/* EOF */
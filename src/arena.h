@@ -0,0 +1,135 @@
+/*!
+ * \file arena.h
+ *
+ * \author Copyright (C) 2026
+ * by Bert Timmerman <bert.timmerman@xs4all.nl>.
+ *
+ * \brief Prototypes for a libDXF arena (drawing scoped memory).
+ *
+ * <hr>
+ * <h1><b>Copyright Notices.</b></h1>\n
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License,
+ * or (at your option) any later version.\n\n
+ * This program is distributed in the hope that it will be useful, but
+ * <b>WITHOUT ANY WARRANTY</b>; without even the implied warranty of
+ * <b>MERCHANTABILITY</b> or <b>FITNESS FOR A PARTICULAR PURPOSE</b>.\n
+ * See the GNU General Public License for more details.\n\n
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to:\n
+ * Free Software Foundation, Inc.,\n
+ * 59 Temple Place,\n
+ * Suite 330,\n
+ * Boston,\n
+ * MA 02111 USA.\n
+ * \n
+ * Drawing eXchange Format (DXF) is a defacto industry standard for the
+ * exchange of drawing files between various Computer Aided Drafting
+ * programs.\n
+ * DXF is an industry standard designed by Autodesk(TM).\n
+ * For more details see http://www.autodesk.com.
+ * <hr>
+ */
+
+
+#ifndef LIBDXF_SRC_ARENA_H
+#define LIBDXF_SRC_ARENA_H
+
+
+#include "global.h"
+
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+/*!
+ * \brief Default size of a chunk of a \c DxfArena.
+ */
+#define DXF_ARENA_CHUNK_SIZE 1048576
+
+
+/*!
+ * \brief Type of the owner of a chunk registered with
+ * dxf_arena_register_chunk ().
+ */
+#define DXF_ARENA_OWNER_ARENA 0
+#define DXF_ARENA_OWNER_STRING_POOL 1
+
+
+/*!
+ * \brief DXF definition of a chunk of memory in a \c DxfArena.
+ */
+typedef struct
+dxf_arena_chunk_struct
+{
+    char *data;
+        /*!< Start of the usable memory of the chunk. */
+    size_t size;
+        /*!< Number of bytes available at \c data. */
+} DxfArenaChunk;
+
+
+/*!
+ * \brief DXF definition of an arena (bump allocator).
+ *
+ * While an arena is the current arena of a thread (see
+ * dxf_arena_set_current ()) every \c dxf_*_new (), \c dxf_*_init ()
+ * and \c dxf_*_read () function running in that thread allocates from
+ * the arena instead of from the heap.\n
+ * Memory handed out by an arena is only released by dxf_arena_free (),
+ * in O(chunks), passing it to dxf_free () is a no-op.\n
+ * The chunks of all live arenas (and string pools) are registered in
+ * one address ordered table, guarded by a lock, together with their
+ * owner, so dxf_free () can tell arena memory from heap memory in
+ * O(log chunks) from any thread.
+ */
+typedef struct
+dxf_arena_struct
+{
+    DxfArenaChunk *chunks;
+        /*!< Chunks sorted on address, for dxf_arena_owns (). */
+    int number_chunks;
+        /*!< Number of chunks in use. */
+    int max_chunks;
+        /*!< Number of chunks allocated in \c chunks. */
+    char *cursor;
+        /*!< Next free byte in the chunk allocations are bumped from,
+         * \c NULL when no chunk was allocated yet. */
+    char *limit;
+        /*!< End of the chunk allocations are bumped from. */
+    size_t chunk_size;
+        /*!< Size of a regular chunk. */
+    size_t allocated;
+        /*!< Number of bytes handed out. */
+} DxfArena;
+
+
+DxfArena *dxf_arena_new (size_t chunk_size);
+int dxf_arena_free (DxfArena *arena);
+void *dxf_arena_alloc (DxfArena *arena, size_t size);
+int dxf_arena_merge (DxfArena *arena, DxfArena *source);
+int dxf_arena_owns (DxfArena *arena, const void *ptr);
+size_t dxf_arena_get_allocated (DxfArena *arena);
+int dxf_arena_register_chunk (const void *owner, int type, const void *data, size_t size);
+void dxf_arena_unregister_chunks (const void *owner);
+const void *dxf_arena_find_owner (const void *ptr, int *type);
+DxfArena *dxf_arena_get_current ();
+DxfArena *dxf_arena_set_current (DxfArena *arena);
+void *dxf_malloc (size_t size);
+void *dxf_realloc (void *ptr, size_t old_size, size_t new_size);
+char *dxf_strdup (const char *s);
+void dxf_free (void *ptr);
+
+
+#ifdef __cplusplus
+}
+#endif
+
+
+#endif /* LIBDXF_SRC_ARENA_H */
+
+
+/* EOF */
@@ -40,6 +40,7 @@
 
 
 #include "attdef.h"
+#include "util.h"
 
 
 /*!
@@ -59,7 +60,7 @@ dxf_attdef_new ()
         size = sizeof (DxfAttdef);
         /* avoid malloc of 0 bytes */
         if (size == 0) size = 1;
-        if ((attdef = malloc (size)) == NULL)
+        if ((attdef = dxf_malloc (size)) == NULL)
         {
                 fprintf (stderr,
                   (_("Error in %s () could not allocate memory.\n")),
@@ -109,9 +110,9 @@ dxf_attdef_init
               return (NULL);
         }
         /* Assign initial values to members. */
-        attdef->id_code = 0;
-        attdef->linetype = strdup (DXF_DEFAULT_LINETYPE);
-        attdef->layer = strdup (DXF_DEFAULT_LAYER);
+        attdef->id_code = DXF_HANDLE_NONE;
+        attdef->linetype = dxf_strdup (DXF_DEFAULT_LINETYPE);
+        attdef->layer = dxf_strdup (DXF_DEFAULT_LAYER);
         attdef->elevation = 0.0;
         attdef->thickness = 0.0;
         attdef->linetype_scale = DXF_DEFAULT_LINETYPE_SCALE;
@@ -120,19 +121,19 @@ dxf_attdef_init
         attdef->paperspace = DXF_MODELSPACE;
         attdef->graphics_data_size = 0;
         attdef->shadow_mode = 0;
-        attdef->dictionary_owner_soft = strdup ("");
-        attdef->object_owner_soft = strdup ("");
-        attdef->material = strdup ("");
-        attdef->dictionary_owner_hard = strdup ("");
+        attdef->dictionary_owner_soft = 0;
+        attdef->object_owner_soft = 0;
+        attdef->material = 0;
+        attdef->dictionary_owner_hard = 0;
         attdef->lineweight = 0.0;
-        attdef->plot_style_name = strdup ("");
+        attdef->plot_style_name = 0;
         attdef->color_value = 0;
-        attdef->color_name = strdup ("");
+        attdef->color_name = dxf_strdup ("");
         attdef->transparency = 0;
-        attdef->default_value = strdup ("");
-        attdef->tag_value = strdup ("");
-        attdef->prompt_value = strdup ("");
-        attdef->text_style = strdup (DXF_DEFAULT_TEXTSTYLE);
+        attdef->default_value = dxf_strdup ("");
+        attdef->tag_value = dxf_strdup ("");
+        attdef->prompt_value = dxf_strdup ("");
+        attdef->text_style = dxf_strdup (DXF_DEFAULT_TEXTSTYLE);
         attdef->height = 0.0;
         attdef->rel_x_scale = 0.0;
         attdef->rot_angle = 0.0;
@@ -181,7 +182,8 @@ dxf_attdef_read
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        char *temp_string = NULL;
+        char temp_string[DXF_MAX_STRING_LENGTH];
+        int group_code;
         DxfBinaryData *iter310 = NULL;
         int iter330;
 
@@ -191,8 +193,6 @@ dxf_attdef_read
                 fprintf (stderr,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
-                /* Clean up. */
-                free (temp_string);
                 return (NULL);
         }
         if (attdef == NULL)
@@ -259,379 +259,303 @@ dxf_attdef_read
         }
         iter310 = (DxfBinaryData *) attdef->binary_graphics_data;
         iter330 = 0;
-        (fp->line_number)++;
-        fscanf (fp->fp, "%[^\n]", temp_string);
-        while (strcmp (temp_string, "0") != 0)
+        while ((dxf_read_group_code (fp, &group_code) == EXIT_SUCCESS)
+          && (group_code != 0))
         {
-                if (ferror (fp->fp))
+                if (dxf_read_error (fp))
                 {
                         fprintf (stderr,
                           (_("Error in %s () while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
-                        fclose (fp->fp);
-                        /* Clean up. */
-                        free (temp_string);
                         return (NULL);
                 }
-                if (strcmp (temp_string, "1") == 0)
-                {
-                        /* Now follows a string containing the attribute
-                         * default value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, attdef->default_value);
-                }
-                else if (strcmp (temp_string, "2") == 0)
-                {
-                        /* Now follows a string containing a tag value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, attdef->tag_value);
-                }
-                else if (strcmp (temp_string, "3") == 0)
-                {
-                        /* Now follows a string containing a prompt
-                         * value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, attdef->prompt_value);
-                }
-                else if (strcmp (temp_string, "5") == 0)
-                {
-                        /* Now follows a string containing a sequential
-                         * id number. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%x\n", (uint *) &attdef->id_code);
-                }
-                else if (strcmp (temp_string, "6") == 0)
-                {
-                        /* Now follows a string containing a linetype
-                         * name. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, attdef->linetype);
-                }
-                else if (strcmp (temp_string, "7") == 0)
-                {
-                        /* Now follows a string containing a text style. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, attdef->text_style);
-                }
-                else if (strcmp (temp_string, "8") == 0)
-                {
-                        /* Now follows a string containing a layer name. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, attdef->layer);
-                }
-                else if (strcmp (temp_string, "10") == 0)
-                {
-                        /* Now follows a string containing the
-                         * X-coordinate of the center point. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &attdef->p0->x0);
-                }
-                else if (strcmp (temp_string, "20") == 0)
-                {
-                        /* Now follows a string containing the
-                         * Y-coordinate of the center point. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &attdef->p0->y0);
-                }
-                else if (strcmp (temp_string, "30") == 0)
-                {
-                        /* Now follows a string containing the
-                         * Z-coordinate of the center point. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &attdef->p0->z0);
-                }
-                else if (strcmp (temp_string, "11") == 0)
-                {
-                        /* Now follows a string containing the
-                         * X-coordinate of the align point. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &attdef->p1->x0);
-                }
-                else if (strcmp (temp_string, "21") == 0)
-                {
-                        /* Now follows a string containing the
-                         * Y-coordinate of the align point. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &attdef->p1->y0);
-                }
-                else if (strcmp (temp_string, "31") == 0)
-                {
-                        /* Now follows a string containing the
-                         * Z-coordinate of the align point. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &attdef->p1->z0);
-                }
-                else if ((fp->acad_version_number <= AutoCAD_11)
-                        && (strcmp (temp_string, "38") == 0)
-                        && (attdef->elevation = 0.0))
-                {
-                        /* Elevation is a pre AutoCAD R11 variable
-                         * so additional testing for the version should
-                         * probably be added.
-                         * Now follows a string containing the
-                         * elevation. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &attdef->elevation);
-                }
-                else if (strcmp (temp_string, "39") == 0)
-                {
-                        /* Now follows a string containing the
-                         * thickness. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &attdef->thickness);
-                }
-                else if (strcmp (temp_string, "40") == 0)
-                {
-                        /* Now follows a string containing the
-                         * height. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &attdef->height);
-                }
-                else if (strcmp (temp_string, "41") == 0)
-                {
-                        /* Now follows a string containing the
-                         * relative X-scale. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &attdef->rel_x_scale);
-                }
-                else if (strcmp (temp_string, "48") == 0)
-                {
-                        /* Now follows a string containing the linetype
-                         * scale. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &attdef->linetype_scale);
-                }
-                else if (strcmp (temp_string, "50") == 0)
-                {
-                        /* Now follows a string containing the
-                         * rotation angle. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &attdef->rot_angle);
-                }
-                else if (strcmp (temp_string, "51") == 0)
-                {
-                        /* Now follows a string containing the
-                         * end angle. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &attdef->obl_angle);
-                }
-                else if (strcmp (temp_string, "60") == 0)
-                {
-                        /* Now follows a string containing the
-                         * visibility value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%hd\n", &attdef->visibility);
-                }
-                else if (strcmp (temp_string, "62") == 0)
-                {
-                        /* Now follows a string containing the
-                         * color value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%hd\n", &attdef->color);
-                }
-                else if (strcmp (temp_string, "67") == 0)
-                {
-                        /* Now follows a string containing the
-                         * paperspace value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%hd\n", &attdef->paperspace);
-                }
-                else if (strcmp (temp_string, "70") == 0)
-                {
-                        /* Now follows a string containing the
-                         * attribute flags value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%hd\n", &attdef->attr_flags);
-                }
-                else if (strcmp (temp_string, "71") == 0)
+                switch (group_code)
                 {
-                        /* Now follows a string containing the
-                         * text flags value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%hd\n", &attdef->text_flags);
-                }
-                else if (strcmp (temp_string, "72") == 0)
-                {
-                        /* Now follows a string containing the
-                         * horizontal alignment value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%hd\n", &attdef->hor_align);
-                }
-                else if (strcmp (temp_string, "73") == 0)
-                {
-                        /* Now follows a string containing the
-                         * field length value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%hd\n", &attdef->field_length);
-                }
-                else if (strcmp (temp_string, "74") == 0)
-                {
-                        /* Now follows a string containing the
-                         * vertical alignment value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%hd\n", &attdef->vert_align);
-                }
-                else if (strcmp (temp_string, "92") == 0)
-                {
-                        /* Now follows a string containing the
-                         * graphics data size value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%" PRIi32 "\n", &attdef->graphics_data_size);
-                }
-                else if ((fp->acad_version_number >= AutoCAD_13)
-                        && (strcmp (temp_string, "100") == 0))
-                {
-                        /* Subclass markers are post AutoCAD R12
-                         * variable so additional testing for the
-                         * version should probably be added here.
-                         * Now follows a string containing the
-                         * subclass marker value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
-                        if ((strcmp (temp_string, "AcDbEntity") != 0)
-                        && (strcmp (temp_string, "AcDbText") != 0)
-                        && (strcmp (temp_string, "AcDbAttributeDefinition") != 0))
-                        {
+                        case 1:
+                                /* Now follows a string containing the attribute
+                                 * default value. */
+                                dxf_read_string (fp, &attdef->default_value);
+                                break;
+                        case 2:
+                                /* Now follows a string containing a tag value. */
+                                dxf_read_string (fp, &attdef->tag_value);
+                                break;
+                        case 3:
+                                /* Now follows a string containing a prompt
+                                 * value. */
+                                dxf_read_string (fp, &attdef->prompt_value);
+                                break;
+                        case 5:
+                                /* Now follows a string containing a sequential
+                                 * id number. */
+                                dxf_read_handle (fp, &attdef->id_code);
+                                break;
+                        case 6:
+                                /* Now follows a string containing a linetype
+                                 * name. */
+                                dxf_read_string_interned (fp, &attdef->linetype);
+                                break;
+                        case 7:
+                                /* Now follows a string containing a text style. */
+                                dxf_read_string_interned (fp, &attdef->text_style);
+                                break;
+                        case 8:
+                                /* Now follows a string containing a layer name. */
+                                dxf_read_string_interned (fp, &attdef->layer);
+                                break;
+                        case 10:
+                                /* Now follows a string containing the
+                                 * X-coordinate of the center point. */
+                                dxf_read_double (fp, &attdef->p0->x0);
+                                break;
+                        case 20:
+                                /* Now follows a string containing the
+                                 * Y-coordinate of the center point. */
+                                dxf_read_double (fp, &attdef->p0->y0);
+                                break;
+                        case 30:
+                                /* Now follows a string containing the
+                                 * Z-coordinate of the center point. */
+                                dxf_read_double (fp, &attdef->p0->z0);
+                                break;
+                        case 11:
+                                /* Now follows a string containing the
+                                 * X-coordinate of the align point. */
+                                dxf_read_double (fp, &attdef->p1->x0);
+                                break;
+                        case 21:
+                                /* Now follows a string containing the
+                                 * Y-coordinate of the align point. */
+                                dxf_read_double (fp, &attdef->p1->y0);
+                                break;
+                        case 31:
+                                /* Now follows a string containing the
+                                 * Z-coordinate of the align point. */
+                                dxf_read_double (fp, &attdef->p1->z0);
+                                break;
+                        case 38:
+                                if ((fp->acad_version_number <= AutoCAD_11) && (attdef->elevation = 0.0))
+                                {
+                                        /* Elevation is a pre AutoCAD R11 variable
+                                         * so additional testing for the version should
+                                         * probably be added.
+                                         * Now follows a string containing the
+                                         * elevation. */
+                                        dxf_read_double (fp, &attdef->elevation);
+                                }
+                                else
+                                {
+                                        fprintf (stderr,
+                                          (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
+                                          __FUNCTION__, fp->filename, fp->line_number);
+                                        /* Skip the value of the unknown group code. */
+                                        dxf_read_line (temp_string, fp);
+                                }
+                                break;
+                        case 39:
+                                /* Now follows a string containing the
+                                 * thickness. */
+                                dxf_read_double (fp, &attdef->thickness);
+                                break;
+                        case 40:
+                                /* Now follows a string containing the
+                                 * height. */
+                                dxf_read_double (fp, &attdef->height);
+                                break;
+                        case 41:
+                                /* Now follows a string containing the
+                                 * relative X-scale. */
+                                dxf_read_double (fp, &attdef->rel_x_scale);
+                                break;
+                        case 48:
+                                /* Now follows a string containing the linetype
+                                 * scale. */
+                                dxf_read_double (fp, &attdef->linetype_scale);
+                                break;
+                        case 50:
+                                /* Now follows a string containing the
+                                 * rotation angle. */
+                                dxf_read_double (fp, &attdef->rot_angle);
+                                break;
+                        case 51:
+                                /* Now follows a string containing the
+                                 * end angle. */
+                                dxf_read_double (fp, &attdef->obl_angle);
+                                break;
+                        case 60:
+                                /* Now follows a string containing the
+                                 * visibility value. */
+                                dxf_read_int16 (fp, &attdef->visibility);
+                                break;
+                        case 62:
+                                /* Now follows a string containing the
+                                 * color value. */
+                                dxf_read_int16 (fp, &attdef->color);
+                                break;
+                        case 67:
+                                /* Now follows a string containing the
+                                 * paperspace value. */
+                                dxf_read_int16 (fp, &attdef->paperspace);
+                                break;
+                        case 70:
+                                /* Now follows a string containing the
+                                 * attribute flags value. */
+                                dxf_read_int16 (fp, &attdef->attr_flags);
+                                break;
+                        case 71:
+                                /* Now follows a string containing the
+                                 * text flags value. */
+                                dxf_read_int16 (fp, &attdef->text_flags);
+                                break;
+                        case 72:
+                                /* Now follows a string containing the
+                                 * horizontal alignment value. */
+                                dxf_read_int16 (fp, &attdef->hor_align);
+                                break;
+                        case 73:
+                                /* Now follows a string containing the
+                                 * field length value. */
+                                dxf_read_int16 (fp, &attdef->field_length);
+                                break;
+                        case 74:
+                                /* Now follows a string containing the
+                                 * vertical alignment value. */
+                                dxf_read_int16 (fp, &attdef->vert_align);
+                                break;
+                        case 92:
+                                /* Now follows a string containing the
+                                 * graphics data size value. */
+                                dxf_read_int32 (fp, &attdef->graphics_data_size);
+                                break;
+                        case 100:
+                                if (fp->acad_version_number >= AutoCAD_13)
+                                {
+                                        /* Subclass markers are post AutoCAD R12
+                                         * variable so additional testing for the
+                                         * version should probably be added here.
+                                         * Now follows a string containing the
+                                         * subclass marker value. */
+                                        dxf_read_line (temp_string, fp);
+                                        if ((strcmp (temp_string, "AcDbEntity") != 0)
+                                        && (strcmp (temp_string, "AcDbText") != 0)
+                                        && (strcmp (temp_string, "AcDbAttributeDefinition") != 0))
+                                        {
+                                                fprintf (stderr,
+                                                  (_("Warning in %s () found a bad subclass marker in: %s in line: %d.\n")),
+                                                  __FUNCTION__, fp->filename, fp->line_number);
+                                        }
+                                }
+                                else
+                                {
+                                        fprintf (stderr,
+                                          (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
+                                          __FUNCTION__, fp->filename, fp->line_number);
+                                        /* Skip the value of the unknown group code. */
+                                        dxf_read_line (temp_string, fp);
+                                }
+                                break;
+                        case 160:
+                                /* Now follows a string containing the
+                                 * graphics data size value. */
+                                dxf_read_int32 (fp, &attdef->graphics_data_size);
+                                break;
+                        case 210:
+                                /* Now follows a string containing the
+                                 * X-value of the extrusion vector. */
+                                dxf_read_double (fp, &attdef->extr_x0);
+                                break;
+                        case 220:
+                                /* Now follows a string containing the
+                                 * Y-value of the extrusion vector. */
+                                dxf_read_double (fp, &attdef->extr_y0);
+                                break;
+                        case 230:
+                                /* Now follows a string containing the
+                                 * Z-value of the extrusion vector. */
+                                dxf_read_double (fp, &attdef->extr_z0);
+                                break;
+                        case 284:
+                                /* Now follows a string containing the shadow
+                                 * mode value. */
+                                dxf_read_int16 (fp, &attdef->shadow_mode);
+                                break;
+                        case 310:
+                                /* Now follows a string containing binary
+                                 * graphics data. */
+                                iter310 = dxf_binary_data_read (fp, iter310);
+                                break;
+                        case 330:
+                                if (iter330 == 0)
+                                {
+                                        /* Now follows a string containing a soft-pointer
+                                         * ID/handle to owner dictionary. */
+                                        dxf_read_handle (fp, &attdef->dictionary_owner_soft);
+                                }
+                                if (iter330 == 1)
+                                {
+                                        /* Now follows a string containing a soft-pointer
+                                         * ID/handle to owner object. */
+                                        dxf_read_handle (fp, &attdef->object_owner_soft);
+                                }
+                                iter330++;
+                                break;
+                        case 347:
+                                /* Now follows a string containing a
+                                 * hard-pointer ID/handle to material object. */
+                                dxf_read_handle (fp, &attdef->material);
+                                break;
+                        case 360:
+                                /* Now follows a string containing Hard owner
+                                 * ID/handle to owner dictionary. */
+                                dxf_read_handle (fp, &attdef->dictionary_owner_hard);
+                                break;
+                        case 370:
+                                /* Now follows a string containing the lineweight
+                                 * value. */
+                                dxf_read_int16 (fp, &attdef->lineweight);
+                                break;
+                        case 390:
+                                /* Now follows a string containing a plot style
+                                 * name value. */
+                                dxf_read_handle (fp, &attdef->plot_style_name);
+                                break;
+                        case 420:
+                                /* Now follows a string containing a color value. */
+                                dxf_read_int32 (fp, &attdef->color_value);
+                                break;
+                        case 430:
+                                /* Now follows a string containing a color
+                                 * name value. */
+                                dxf_read_string_interned (fp, &attdef->color_name);
+                                break;
+                        case 440:
+                                /* Now follows a string containing a transparency
+                                 * value. */
+                                dxf_read_int32 (fp, &attdef->transparency);
+                                break;
+                        case 999:
+                                /* Now follows a string containing a comment. */
+                                dxf_read_line (temp_string, fp);
+                                fprintf (stdout, "DXF comment: %s\n", temp_string);
+                                break;
+                        default:
                                 fprintf (stderr,
-                                  (_("Warning in %s () found a bad subclass marker in: %s in line: %d.\n")),
+                                  (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
                                   __FUNCTION__, fp->filename, fp->line_number);
-                        }
-                }
-                else if (strcmp (temp_string, "160") == 0)
-                {
-                        /* Now follows a string containing the
-                         * graphics data size value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%" PRIi32 "\n", &attdef->graphics_data_size);
-                }
-                else if (strcmp (temp_string, "210") == 0)
-                {
-                        /* Now follows a string containing the
-                         * X-value of the extrusion vector. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &attdef->extr_x0);
-                }
-                else if (strcmp (temp_string, "220") == 0)
-                {
-                        /* Now follows a string containing the
-                         * Y-value of the extrusion vector. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &attdef->extr_y0);
-                }
-                else if (strcmp (temp_string, "230") == 0)
-                {
-                        /* Now follows a string containing the
-                         * Z-value of the extrusion vector. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &attdef->extr_z0);
-                }
-                else if (strcmp (temp_string, "284") == 0)
-                {
-                        /* Now follows a string containing the shadow
-                         * mode value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%hd\n", &attdef->shadow_mode);
-                }
-                else if (strcmp (temp_string, "310") == 0)
-                {
-                        /* Now follows a string containing binary
-                         * graphics data. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, iter310->data_line);
-                        dxf_binary_data_init ((DxfBinaryData *) iter310->next);
-                        iter310 = (DxfBinaryData *) iter310->next;
-                }
-                else if (strcmp (temp_string, "330") == 0)
-                {
-                        if (iter330 == 0)
-                        {
-                                /* Now follows a string containing a soft-pointer
-                                 * ID/handle to owner dictionary. */
-                                (fp->line_number)++;
-                                fscanf (fp->fp, DXF_MAX_STRING_FORMAT, attdef->dictionary_owner_soft);
-                        }
-                        if (iter330 == 1)
-                        {
-                                /* Now follows a string containing a soft-pointer
-                                 * ID/handle to owner object. */
-                                (fp->line_number)++;
-                                fscanf (fp->fp, DXF_MAX_STRING_FORMAT, attdef->object_owner_soft);
-                        }
-                        iter330++;
-                }
-                else if (strcmp (temp_string, "347") == 0)
-                {
-                        /* Now follows a string containing a
-                         * hard-pointer ID/handle to material object. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, attdef->material);
-                }
-                else if (strcmp (temp_string, "360") == 0)
-                {
-                        /* Now follows a string containing Hard owner
-                         * ID/handle to owner dictionary. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, attdef->dictionary_owner_hard);
-                }
-                else if (strcmp (temp_string, "370") == 0)
-                {
-                        /* Now follows a string containing the lineweight
-                         * value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%hd\n", &attdef->lineweight);
-                }
-                else if (strcmp (temp_string, "390") == 0)
-                {
-                        /* Now follows a string containing a plot style
-                         * name value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, attdef->plot_style_name);
-                }
-                else if (strcmp (temp_string, "420") == 0)
-                {
-                        /* Now follows a string containing a color value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%" PRIi32 "\n", &attdef->color_value);
-                }
-                else if (strcmp (temp_string, "430") == 0)
-                {
-                        /* Now follows a string containing a color
-                         * name value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, attdef->color_name);
-                }
-                else if (strcmp (temp_string, "440") == 0)
-                {
-                        /* Now follows a string containing a transparency
-                         * value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%" PRIi32 "\n", &attdef->transparency);
-                }
-                else if (strcmp (temp_string, "999") == 0)
-                {
-                        /* Now follows a string containing a comment. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
-                        fprintf (stdout, "DXF comment: %s\n", temp_string);
-                }
-                else
-                {
-                        fprintf (stderr,
-                          (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
-                          __FUNCTION__, fp->filename, fp->line_number);
+                                /* Skip the value of the unknown group code. */
+                                dxf_read_line (temp_string, fp);
+                                break;
                 }
         }
         /* Handle omitted members and/or illegal values. */
         if (strcmp (attdef->linetype, "") == 0)
         {
-                attdef->linetype = strdup (DXF_DEFAULT_LINETYPE);
+                attdef->linetype = dxf_strdup (DXF_DEFAULT_LINETYPE);
         }
         if (strcmp (attdef->layer, "") == 0)
         {
-                attdef->layer = strdup (DXF_DEFAULT_LAYER);
+                attdef->layer = dxf_strdup (DXF_DEFAULT_LAYER);
         }
-        /* Clean up. */
-        free (temp_string);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -654,7 +578,7 @@ dxf_attdef_write
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        char *dxf_entity_name = strdup ("ATTDEF");
+        char *dxf_entity_name = dxf_strdup ("ATTDEF");
 
         /* Do some basic checks. */
         if (fp == NULL)
@@ -663,7 +587,7 @@ dxf_attdef_write
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (attdef == NULL)
@@ -672,52 +596,52 @@ dxf_attdef_write
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (strcmp (attdef->tag_value, "") == 0)
         {
                 fprintf (stderr,
-                  (_("Error in %s () default tag value string is empty for the %s entity with id-code: %x.\n")),
+                  (_("Error in %s () default tag value string is empty for the %s entity with id-code: %" PRIx64 ".\n")),
                   __FUNCTION__, dxf_entity_name, attdef->id_code);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (strcmp (attdef->text_style, "") == 0)
         {
                 fprintf (stderr,
-                  (_("Warning in %s () text style string is empty for the %s entity with id-code: %x.\n")),
+                  (_("Warning in %s () text style string is empty for the %s entity with id-code: %" PRIx64 ".\n")),
                   __FUNCTION__, dxf_entity_name, attdef->id_code);
                 fprintf (stderr,
                   (_("\tdefault text style STANDARD applied to %s entity.\n")),
                   dxf_entity_name);
-                attdef->text_style = strdup (DXF_DEFAULT_TEXTSTYLE);
+                attdef->text_style = dxf_strdup (DXF_DEFAULT_TEXTSTYLE);
         }
         if (strcmp (attdef->linetype, "") == 0)
         {
                 fprintf (stderr,
-                  (_("Warning in %s () empty linetype string for the %s entity with id-code: %x\n")),
+                  (_("Warning in %s () empty linetype string for the %s entity with id-code: %" PRIx64 "\n")),
                   __FUNCTION__, dxf_entity_name, attdef->id_code);
                 fprintf (stderr,
                   (_("\t%s entity is reset to default linetype")),
                   dxf_entity_name);
-                attdef->linetype = strdup (DXF_DEFAULT_LINETYPE);
+                attdef->linetype = dxf_strdup (DXF_DEFAULT_LINETYPE);
         }
         if (strcmp (attdef->layer, "") == 0)
         {
                 fprintf (stderr,
-                  (_("Warning in %s () empty layer string for the %s entity with id-code: %x\n")),
+                  (_("Warning in %s () empty layer string for the %s entity with id-code: %" PRIx64 "\n")),
                   __FUNCTION__, dxf_entity_name, attdef->id_code);
                 fprintf (stderr,
                   (_("\t%s entity is relocated to layer 0")),
                   dxf_entity_name);
-                attdef->layer = strdup (DXF_DEFAULT_LAYER);
+                attdef->layer = dxf_strdup (DXF_DEFAULT_LAYER);
         }
         if (attdef->height == 0.0)
         {
                 fprintf (stderr,
-                  (_("Warning in %s () height has a value of 0.0 for the %s entity with id-code: %x.\n")),
+                  (_("Warning in %s () height has a value of 0.0 for the %s entity with id-code: %" PRIx64 ".\n")),
                   __FUNCTION__, dxf_entity_name, attdef->id_code);
                 fprintf (stderr,
                   (_("\tdefault height of 1.0 applied to %s entity.\n")),
@@ -727,7 +651,7 @@ dxf_attdef_write
         if (attdef->rel_x_scale == 0.0)
         {
                 fprintf (stderr,
-                  (_("Warning in %s () relative X-scale factor has a value of 0.0 for the %s entity with id-code: %x.\n")),
+                  (_("Warning in %s () relative X-scale factor has a value of 0.0 for the %s entity with id-code: %" PRIx64 ".\n")),
                   __FUNCTION__, dxf_entity_name, attdef->id_code);
                 fprintf (stderr,
                   (_("\tdefault relative X-scale of 1.0 applied to %s entity.\n")),
@@ -735,10 +659,10 @@ dxf_attdef_write
                 attdef->rel_x_scale = 1.0;
         }
         /* Start writing output. */
-        fprintf (fp->fp, "  0\n%s\n", dxf_entity_name);
-        if (attdef->id_code != -1)
+        dxf_write_string (fp, 0, dxf_entity_name);
+        if (attdef->id_code != DXF_HANDLE_NONE)
         {
-                fprintf (fp->fp, "  5\n%x\n", attdef->id_code);
+                dxf_write_hex (fp, 5, attdef->id_code);
         }
         /*!
          * \todo for version R14.\n
@@ -750,69 +674,69 @@ dxf_attdef_write
          * 102 groups are application defined (optional).\n\n
          * End of group, "}" (optional), with Group code 102.
          */
-        if ((strcmp (attdef->dictionary_owner_soft, "") != 0)
+        if ((attdef->dictionary_owner_soft != 0)
           && (fp->acad_version_number >= AutoCAD_14))
         {
-                fprintf (fp->fp, "102\n{ACAD_REACTORS\n");
-                fprintf (fp->fp, "330\n%s\n", attdef->dictionary_owner_soft);
-                fprintf (fp->fp, "102\n}\n");
+                dxf_write_string (fp, 102, "{ACAD_REACTORS");
+                dxf_write_hex (fp, 330, attdef->dictionary_owner_soft);
+                dxf_write_string (fp, 102, "}");
         }
-        if ((strcmp (attdef->dictionary_owner_hard, "") != 0)
+        if ((attdef->dictionary_owner_hard != 0)
           && (fp->acad_version_number >= AutoCAD_14))
         {
-                fprintf (fp->fp, "102\n{ACAD_XDICTIONARY\n");
-                fprintf (fp->fp, "360\n%s\n", attdef->dictionary_owner_hard);
-                fprintf (fp->fp, "102\n}\n");
+                dxf_write_string (fp, 102, "{ACAD_XDICTIONARY");
+                dxf_write_hex (fp, 360, attdef->dictionary_owner_hard);
+                dxf_write_string (fp, 102, "}");
         }
-        if ((strcmp (attdef->object_owner_soft, "") != 0)
+        if ((attdef->object_owner_soft != 0)
           && (fp->acad_version_number >= AutoCAD_2000))
         {
-                fprintf (fp->fp, "330\n%s\n", attdef->object_owner_soft);
+                dxf_write_hex (fp, 330, attdef->object_owner_soft);
         }
         if (fp->acad_version_number >= AutoCAD_13)
         {
-                fprintf (fp->fp, "100\nAcDbEntity\n");
+                dxf_write_string (fp, 100, "AcDbEntity");
         }
         if (attdef->paperspace == DXF_PAPERSPACE)
         {
-                fprintf (fp->fp, " 67\n%hd\n", (int16_t) DXF_PAPERSPACE);
+                dxf_write_int (fp, 67, (int16_t) DXF_PAPERSPACE);
         }
-        fprintf (fp->fp, "  8\n%s\n", attdef->layer);
+        dxf_write_string (fp, 8, attdef->layer);
         if (strcmp (attdef->linetype, DXF_DEFAULT_LINETYPE) != 0)
         {
-                fprintf (fp->fp, "  6\n%s\n", attdef->linetype);
+                dxf_write_string (fp, 6, attdef->linetype);
         }
         if ((fp->acad_version_number >= AutoCAD_2008)
-          && (strcmp (attdef->material, "") != 0))
+          && (attdef->material != 0))
         {
-                fprintf (fp->fp, "347\n%s\n", attdef->material);
+                dxf_write_hex (fp, 347, attdef->material);
         }
         if (attdef->color != DXF_COLOR_BYLAYER)
         {
-                fprintf (fp->fp, " 62\n%hd\n", attdef->color);
+                dxf_write_int (fp, 62, attdef->color);
         }
         if (fp->acad_version_number >= AutoCAD_2002)
         {
-                fprintf (fp->fp, "370\n%d\n", attdef->lineweight);
+                dxf_write_int (fp, 370, attdef->lineweight);
         }
         if (attdef->thickness != 0.0)
         {
-                fprintf (fp->fp, " 39\n%f\n", attdef->thickness);
+                dxf_write_double (fp, 39, attdef->thickness);
         }
         if (attdef->linetype_scale != 1.0)
         {
-                fprintf (fp->fp, " 48\n%f\n", attdef->linetype_scale);
+                dxf_write_double (fp, 48, attdef->linetype_scale);
         }
         if (attdef->visibility != 0)
         {
-                fprintf (fp->fp, " 60\n%hd\n", attdef->visibility);
+                dxf_write_int (fp, 60, attdef->visibility);
         }
         if (fp->acad_version_number >= AutoCAD_2000)
         {
 #ifdef BUILD_64
-                fprintf (fp->fp, "160\n%" PRIi32 "\n", attdef->graphics_data_size);
+                dxf_write_int (fp, 160, attdef->graphics_data_size);
 #else
-                fprintf (fp->fp, " 92\n%" PRIi32 "\n", attdef->graphics_data_size);
+                dxf_write_int (fp, 92, attdef->graphics_data_size);
 #endif
                 if (attdef->binary_graphics_data != NULL)
                 {
@@ -820,69 +744,69 @@ dxf_attdef_write
                         iter = (DxfBinaryData *) attdef->binary_graphics_data;
                         while (iter != NULL)
                         {
-                                fprintf (fp->fp, "310\n%s\n", iter->data_line);
+                                dxf_binary_data_write (fp, iter);
                                 iter = (DxfBinaryData *) iter->next;
                         }
                 }
         }
         if (fp->acad_version_number >= AutoCAD_2004)
         {
-                fprintf (fp->fp, "420\n%" PRIi32 "\n", attdef->color_value);
-                fprintf (fp->fp, "430\n%s\n", attdef->color_name);
-                fprintf (fp->fp, "440\n%" PRIi32 "\n", attdef->transparency);
+                dxf_write_int (fp, 420, attdef->color_value);
+                dxf_write_string (fp, 430, attdef->color_name);
+                dxf_write_int (fp, 440, attdef->transparency);
         }
         if (fp->acad_version_number >= AutoCAD_2009)
         {
-                fprintf (fp->fp, "390\n%s\n", attdef->plot_style_name);
-                fprintf (fp->fp, "284\n%d\n", attdef->shadow_mode);
+                dxf_write_hex (fp, 390, attdef->plot_style_name);
+                dxf_write_int (fp, 284, attdef->shadow_mode);
         }
         if (fp->acad_version_number >= AutoCAD_13)
         {
-                fprintf (fp->fp, "100\nAcDbText\n");
+                dxf_write_string (fp, 100, "AcDbText");
         }
-        fprintf (fp->fp, " 10\n%f\n", attdef->p0->x0);
-        fprintf (fp->fp, " 20\n%f\n", attdef->p0->y0);
-        fprintf (fp->fp, " 30\n%f\n", attdef->p0->z0);
-        fprintf (fp->fp, " 40\n%f\n", attdef->height);
-        fprintf (fp->fp, "  1\n%s\n", attdef->default_value);
+        dxf_write_double (fp, 10, attdef->p0->x0);
+        dxf_write_double (fp, 20, attdef->p0->y0);
+        dxf_write_double (fp, 30, attdef->p0->z0);
+        dxf_write_double (fp, 40, attdef->height);
+        dxf_write_string (fp, 1, attdef->default_value);
         if (fp->acad_version_number >= AutoCAD_13)
         {
-                fprintf (fp->fp, "100\nAcDbAttributeDefinition\n");
+                dxf_write_string (fp, 100, "AcDbAttributeDefinition");
         }
-        fprintf (fp->fp, "  3\n%s\n", attdef->prompt_value);
-        fprintf (fp->fp, "  2\n%s\n", attdef->tag_value);
-        fprintf (fp->fp, " 70\n%hd\n", attdef->attr_flags);
+        dxf_write_string (fp, 3, attdef->prompt_value);
+        dxf_write_string (fp, 2, attdef->tag_value);
+        dxf_write_int (fp, 70, attdef->attr_flags);
         if (attdef->field_length != 0)
         {
-                fprintf (fp->fp, " 73\n%hd\n", attdef->field_length);
+                dxf_write_int (fp, 73, attdef->field_length);
         }
         if (attdef->rot_angle != 0.0)
         {
-                fprintf (fp->fp, " 50\n%f\n", attdef->rot_angle);
+                dxf_write_double (fp, 50, attdef->rot_angle);
         }
         if (attdef->rel_x_scale != 1.0)
         {
-                fprintf (fp->fp, " 41\n%f\n", attdef->rel_x_scale);
+                dxf_write_double (fp, 41, attdef->rel_x_scale);
         }
         if (attdef->obl_angle != 0.0)
         {
-                fprintf (fp->fp, " 51\n%f\n", attdef->obl_angle);
+                dxf_write_double (fp, 51, attdef->obl_angle);
         }
         if (strcmp (attdef->text_style, "STANDARD") != 0)
         {
-                fprintf (fp->fp, "  7\n%s\n", attdef->text_style);
+                dxf_write_string (fp, 7, attdef->text_style);
         }
         if (attdef->text_flags != 0)
         {
-                fprintf (fp->fp, " 71\n%hd\n", attdef->text_flags);
+                dxf_write_int (fp, 71, attdef->text_flags);
         }
         if (attdef->hor_align != 0)
         {
-                fprintf (fp->fp, " 72\n%hd\n", attdef->hor_align);
+                dxf_write_int (fp, 72, attdef->hor_align);
         }
         if (attdef->vert_align != 0)
         {
-                fprintf (fp->fp, " 74\n%hd\n", attdef->vert_align);
+                dxf_write_int (fp, 74, attdef->vert_align);
         }
         if ((attdef->hor_align != 0) || (attdef->vert_align != 0))
         {
@@ -891,7 +815,7 @@ dxf_attdef_write
                         && (attdef->p0->z0 == attdef->p1->z0))
                 {
                         fprintf (stderr,
-                          (_("Warning in %s () insertion point and alignment point are identical for the %s entity with id-code: %x.\n")),
+                          (_("Warning in %s () insertion point and alignment point are identical for the %s entity with id-code: %" PRIx64 ".\n")),
                           __FUNCTION__, dxf_entity_name, attdef->id_code);
                         fprintf (stderr,
                           (_("\tdefault justification applied to %s entity.\n")),
@@ -901,19 +825,19 @@ dxf_attdef_write
                 }
                 else
                 {
-                        fprintf (fp->fp, " 11\n%f\n", attdef->p1->x0);
-                        fprintf (fp->fp, " 21\n%f\n", attdef->p1->y0);
-                        fprintf (fp->fp, " 31\n%f\n", attdef->p1->z0);
+                        dxf_write_double (fp, 11, attdef->p1->x0);
+                        dxf_write_double (fp, 21, attdef->p1->y0);
+                        dxf_write_double (fp, 31, attdef->p1->z0);
                 }
         }
         if (fp->acad_version_number >= AutoCAD_12)
         {
-                fprintf (fp->fp, "210\n%f\n", attdef->extr_x0);
-                fprintf (fp->fp, "220\n%f\n", attdef->extr_y0);
-                fprintf (fp->fp, "230\n%f\n", attdef->extr_z0);
+                dxf_write_double (fp, 210, attdef->extr_x0);
+                dxf_write_double (fp, 220, attdef->extr_y0);
+                dxf_write_double (fp, 230, attdef->extr_z0);
         }
         /* Clean up. */
-        free (dxf_entity_name);
+        dxf_free (dxf_entity_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -952,22 +876,17 @@ dxf_attdef_free
                 __FUNCTION__);
               return (EXIT_FAILURE);
         }
-        free (attdef->linetype);
-        free (attdef->layer);
+        dxf_string_free (attdef->linetype);
+        dxf_string_free (attdef->layer);
         dxf_binary_data_free_list (attdef->binary_graphics_data);
-        free (attdef->dictionary_owner_soft);
-        free (attdef->object_owner_soft);
-        free (attdef->material);
-        free (attdef->dictionary_owner_hard);
-        free (attdef->plot_style_name);
-        free (attdef->color_name);
-        free (attdef->default_value);
-        free (attdef->tag_value);
-        free (attdef->prompt_value);
-        free (attdef->text_style);
+        dxf_string_free (attdef->color_name);
+        dxf_free (attdef->default_value);
+        dxf_free (attdef->tag_value);
+        dxf_free (attdef->prompt_value);
+        dxf_string_free (attdef->text_style);
         dxf_point_free_list (attdef->p0);
         dxf_point_free_list (attdef->p1);
-        free (attdef);
+        dxf_free (attdef);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1013,7 +932,7 @@ dxf_attdef_free_list
  *
  * \return ID code.
  */
-int
+uint64_t
 dxf_attdef_get_id_code
 (
         DxfAttdef *attdef
@@ -1031,12 +950,6 @@ dxf_attdef_get_id_code
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (attdef->id_code < 0)
-        {
-                fprintf (stderr,
-                  (_("Warning in %s () a negative value was found.\n")),
-                  __FUNCTION__);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1052,7 +965,7 @@ dxf_attdef_set_id_code
 (
         DxfAttdef *attdef,
                 /*!< a pointer to a DXF \c ATTDEF entity. */
-        int id_code
+        uint64_t id_code
                 /*!< Identification number for the entity.\n
                  * This is to be an unique (sequential) number in the DXF
                  * file. */
@@ -1069,12 +982,6 @@ dxf_attdef_set_id_code
                   __FUNCTION__);
                 return (NULL);
         }
-        if (id_code < 0)
-        {
-                fprintf (stderr,
-                  (_("Warning in %s () a negative value was passed.\n")),
-                  __FUNCTION__);
-        }
         attdef->id_code = id_code;
 #if DEBUG
         DXF_DEBUG_END
@@ -1116,7 +1023,7 @@ dxf_attdef_get_linetype
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (attdef->linetype));
+        return (dxf_strdup (attdef->linetype));
 }
 
 
@@ -1150,7 +1057,7 @@ dxf_attdef_set_linetype
                   __FUNCTION__);
                 return (NULL);
         }
-        attdef->linetype = strdup (linetype);
+        attdef->linetype = dxf_strdup (linetype);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1191,7 +1098,7 @@ dxf_attdef_get_layer
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (attdef->layer));
+        return (dxf_strdup (attdef->layer));
 }
 
 
@@ -1225,7 +1132,7 @@ dxf_attdef_set_layer
                   __FUNCTION__);
                 return (NULL);
         }
-        attdef->layer = strdup (layer);
+        attdef->layer = dxf_strdup (layer);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1949,10 +1856,8 @@ dxf_attdef_set_binary_graphics_data
  * \c ATTDEF entity.
  *
  * \return soft pointer to the dictionary owner.
- *
- * \warning No checks are performed on the returned pointer (string).
  */
-char *
+uint64_t
 dxf_attdef_get_dictionary_owner_soft
 (
         DxfAttdef *attdef
@@ -1968,19 +1873,12 @@ dxf_attdef_get_dictionary_owner_soft
                 fprintf (stderr,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
-                return (NULL);
-        }
-        if (attdef->dictionary_owner_soft ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
+                return (0);
         }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (attdef->dictionary_owner_soft));
+        return (attdef->dictionary_owner_soft);
 }
 
 
@@ -1993,8 +1891,8 @@ dxf_attdef_set_dictionary_owner_soft
 (
         DxfAttdef *attdef,
                 /*!< a pointer to a DXF \c ATTDEF entity. */
-        char *dictionary_owner_soft
-                /*!< a string containing the pointer to the
+        uint64_t dictionary_owner_soft
+                /*!< the handle of the
                  * dictionary_owner_soft for the entity. */
 )
 {
@@ -2009,14 +1907,7 @@ dxf_attdef_set_dictionary_owner_soft
                   __FUNCTION__);
                 return (NULL);
         }
-        if (dictionary_owner_soft == NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was passed.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
-        attdef->dictionary_owner_soft = strdup (dictionary_owner_soft);
+        attdef->dictionary_owner_soft = dictionary_owner_soft;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2029,10 +1920,8 @@ dxf_attdef_set_dictionary_owner_soft
  * \c ATTDEF entity.
  *
  * \return soft pointer to the object owner.
- *
- * \warning No checks are performed on the returned pointer (string).
  */
-char *
+uint64_t
 dxf_attdef_get_object_owner_soft
 (
         DxfAttdef *attdef
@@ -2048,19 +1937,12 @@ dxf_attdef_get_object_owner_soft
                 fprintf (stderr,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
-                return (NULL);
-        }
-        if (attdef->object_owner_soft ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
+                return (0);
         }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (attdef->object_owner_soft));
+        return (attdef->object_owner_soft);
 }
 
 
@@ -2073,8 +1955,8 @@ dxf_attdef_set_object_owner_soft
 (
         DxfAttdef *attdef,
                 /*!< a pointer to a DXF \c ATTDEF entity. */
-        char *object_owner_soft
-                /*!< a string containing the pointer to the
+        uint64_t object_owner_soft
+                /*!< the handle of the
                  * \c object_owner_soft for the entity. */
 )
 {
@@ -2089,14 +1971,7 @@ dxf_attdef_set_object_owner_soft
                   __FUNCTION__);
                 return (NULL);
         }
-        if (object_owner_soft == NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was passed.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
-        attdef->object_owner_soft = strdup (object_owner_soft);
+        attdef->object_owner_soft = object_owner_soft;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2107,12 +1982,10 @@ dxf_attdef_set_object_owner_soft
 /*!
  * \brief Get the pointer to the \c material from a DXF \c ATTDEF entity.
  *
- * \return a pointer to \c material when successful, or \c NULL when an
+ * \return the handle \c material when successful, or 0 when an
  * error occurred.
- *
- * \warning No checks are performed on the returned pointer.
  */
-char *
+uint64_t
 dxf_attdef_get_material
 (
         DxfAttdef *attdef
@@ -2128,19 +2001,12 @@ dxf_attdef_get_material
                 fprintf (stderr,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
-                return (NULL);
-        }
-        if (attdef->material ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
+                return (0);
         }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (attdef->material));
+        return (attdef->material);
 }
 
 
@@ -2155,8 +2021,8 @@ dxf_attdef_set_material
 (
         DxfAttdef *attdef,
                 /*!< a pointer to a DXF \c ATTDEF entity. */
-        char *material
-                /*!< a string containing the pointer to the \c
+        uint64_t material
+                /*!< the handle of the \c
                  * material for the entity. */
 )
 {
@@ -2171,14 +2037,7 @@ dxf_attdef_set_material
                   __FUNCTION__);
                 return (NULL);
         }
-        if (material == NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was passed.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
-        attdef->material = strdup (material);
+        attdef->material = material;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2191,10 +2050,8 @@ dxf_attdef_set_material
  * \c ATTDEF entity.
  *
  * \return hard pointer to the dictionary owner.
- *
- * \warning No checks are performed on the returned pointer (string).
  */
-char *
+uint64_t
 dxf_attdef_get_dictionary_owner_hard
 (
         DxfAttdef *attdef
@@ -2210,19 +2067,12 @@ dxf_attdef_get_dictionary_owner_hard
                 fprintf (stderr,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
-                return (NULL);
-        }
-        if (attdef->dictionary_owner_hard ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
+                return (0);
         }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (attdef->dictionary_owner_hard));
+        return (attdef->dictionary_owner_hard);
 }
 
 
@@ -2235,8 +2085,8 @@ dxf_attdef_set_dictionary_owner_hard
 (
         DxfAttdef *attdef,
                 /*!< a pointer to a DXF \c ATTDEF entity. */
-        char *dictionary_owner_hard
-                /*!< a string containing the pointer to the
+        uint64_t dictionary_owner_hard
+                /*!< the handle of the
                  * dictionary_owner_hard for the entity. */
 )
 {
@@ -2251,14 +2101,7 @@ dxf_attdef_set_dictionary_owner_hard
                   __FUNCTION__);
                 return (NULL);
         }
-        if (dictionary_owner_hard == NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was passed.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
-        attdef->dictionary_owner_hard = strdup (dictionary_owner_hard);
+        attdef->dictionary_owner_hard = dictionary_owner_hard;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2334,10 +2177,10 @@ dxf_attdef_set_lineweight
 /*!
  * \brief Get the \c plot_style_name from a DXF \c ATTDEF entity.
  *
- * \return a pointer to \c plot_style_name when sucessful, or \c NULL
+ * \return the handle \c plot_style_name when sucessful, or 0
  * when an error occurred.
  */
-char *
+uint64_t
 dxf_attdef_get_plot_style_name
 (
         DxfAttdef *attdef
@@ -2353,19 +2196,12 @@ dxf_attdef_get_plot_style_name
                 fprintf (stderr,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
-                return (NULL);
-        }
-        if (attdef->plot_style_name ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
+                return (0);
         }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (attdef->plot_style_name));
+        return (attdef->plot_style_name);
 }
 
 
@@ -2380,7 +2216,7 @@ dxf_attdef_set_plot_style_name
 (
         DxfAttdef *attdef,
                 /*!< a pointer to a DXF \c ATTDEF entity. */
-        char *plot_style_name
+        uint64_t plot_style_name
                 /*!< a string containing the \c plot_style_name for the
                  * entity. */
 )
@@ -2396,14 +2232,7 @@ dxf_attdef_set_plot_style_name
                   __FUNCTION__);
                 return (NULL);
         }
-        if (plot_style_name == NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was passed.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
-        attdef->plot_style_name = strdup (plot_style_name);
+        attdef->plot_style_name = plot_style_name;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2510,7 +2339,7 @@ dxf_attdef_get_color_name
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (attdef->color_name));
+        return (dxf_strdup (attdef->color_name));
 }
 
 
@@ -2548,7 +2377,7 @@ dxf_attdef_set_color_name
                   __FUNCTION__);
                 return (NULL);
         }
-        attdef->color_name = strdup (color_name);
+        attdef->color_name = dxf_strdup (color_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2656,7 +2485,7 @@ dxf_attdef_get_default_value
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (attdef->default_value));
+        return (dxf_strdup (attdef->default_value));
 }
 
 
@@ -2691,7 +2520,7 @@ dxf_attdef_set_default_value
                   __FUNCTION__);
                 return (NULL);
         }
-        attdef->default_value = strdup (default_value);
+        attdef->default_value = dxf_strdup (default_value);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2734,7 +2563,7 @@ dxf_attdef_get_tag_value
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (attdef->tag_value));
+        return (dxf_strdup (attdef->tag_value));
 }
 
 
@@ -2769,7 +2598,7 @@ dxf_attdef_set_tag_value
                   __FUNCTION__);
                 return (NULL);
         }
-        attdef->tag_value = strdup (tag_value);
+        attdef->tag_value = dxf_strdup (tag_value);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2812,7 +2641,7 @@ dxf_attdef_get_prompt_value
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (attdef->prompt_value));
+        return (dxf_strdup (attdef->prompt_value));
 }
 
 
@@ -2847,7 +2676,7 @@ dxf_attdef_set_prompt_value
                   __FUNCTION__);
                 return (NULL);
         }
-        attdef->prompt_value = strdup (prompt_value);
+        attdef->prompt_value = dxf_strdup (prompt_value);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2890,7 +2719,7 @@ dxf_attdef_get_text_style
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (attdef->text_style));
+        return (dxf_strdup (attdef->text_style));
 }
 
 
@@ -2925,7 +2754,7 @@ dxf_attdef_set_text_style
                   __FUNCTION__);
                 return (NULL);
         }
-        attdef->text_style = strdup (text_style);
+        attdef->text_style = dxf_strdup (text_style);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -61,7 +61,7 @@ typedef struct
 dxf_attdef_struct
 {
         /* Members common for all DXF drawable entities. */
-        int id_code;
+        uint64_t id_code;
                 /*!< Identification number for the entity.\n
                  * This is to be an unique (sequential) number in the DXF
                  * file.\n
@@ -132,20 +132,20 @@ dxf_attdef_struct
                  * (optional).\n
                  * Group code = 310.\n
                  * \since Introduced in version R2000. */
-        char *dictionary_owner_soft;
+        uint64_t dictionary_owner_soft;
                 /*!< Soft-pointer ID/handle to owner dictionary (optional).\n
                  * Group code = 330.\n
                  * \since Introduced in version R14. */
-        char *object_owner_soft;
+        uint64_t object_owner_soft;
                 /*!< Soft-pointer ID/handle  to owner BLOCK_RECORD object.\n
                  * Group code = 330.\n
                  * \since Introduced in version R2000. */
-        char *material;
+        uint64_t material;
                 /*!< Hard-pointer ID/handle to material object (present if
                  * not BYLAYER).\n
                  * Group code = 347.\n
                  * \since Introduced in version R2008. */
-        char *dictionary_owner_hard;
+        uint64_t dictionary_owner_hard;
                 /*!< Hard owner ID/handle to owner dictionary (optional).\n
                  * Group code = 360.\n
                  * \since Introduced in version R14. */
@@ -154,7 +154,7 @@ dxf_attdef_struct
                  * Stored and moved around as a 16-bit integer.\n
                  * Group code = 370.\n
                  * \since Introduced in version R2002. */
-        char *plot_style_name;
+        uint64_t plot_style_name;
                 /*!< Hard pointer ID / handle of PlotStyleName object.\n
                  * Group code = 390.\n
                  * \since Introduced in version R2009. */
@@ -299,8 +299,8 @@ DxfAttdef *dxf_attdef_read (DxfFile *fp, DxfAttdef *attdef);
 int dxf_attdef_write (DxfFile *fp, DxfAttdef *attdef);
 int dxf_attdef_free (DxfAttdef *attdef);
 void dxf_attdef_free_list (DxfAttdef *attdefs);
-int dxf_attdef_get_id_code (DxfAttdef *attdef);
-DxfAttdef *dxf_attdef_set_id_code (DxfAttdef *attdef, int id_code);
+uint64_t dxf_attdef_get_id_code (DxfAttdef *attdef);
+DxfAttdef *dxf_attdef_set_id_code (DxfAttdef *attdef, uint64_t id_code);
 char *dxf_attdef_get_linetype (DxfAttdef *attdef);
 DxfAttdef *dxf_attdef_set_linetype (DxfAttdef *attdef, char *linetype);
 char *dxf_attdef_get_layer (DxfAttdef *attdef);
@@ -323,18 +323,18 @@ int16_t dxf_attdef_get_shadow_mode (DxfAttdef *attdef);
 DxfAttdef *dxf_attdef_set_shadow_mode (DxfAttdef *attdef, int16_t shadow_mode);
 DxfBinaryData *dxf_attdef_get_binary_graphics_data (DxfAttdef *attdef);
 DxfAttdef *dxf_attdef_set_binary_graphics_data (DxfAttdef *attdef, DxfBinaryData *data);
-char *dxf_attdef_get_dictionary_owner_soft (DxfAttdef *attdef);
-DxfAttdef *dxf_attdef_set_dictionary_owner_soft (DxfAttdef *attdef, char *dictionary_owner_soft);
-char *dxf_attdef_get_object_owner_soft (DxfAttdef *attdef);
-DxfAttdef *dxf_attdef_set_object_owner_soft (DxfAttdef *attdef, char *object_owner_soft);
-char *dxf_attdef_get_material (DxfAttdef *attdef);
-DxfAttdef *dxf_attdef_set_material (DxfAttdef *attdef, char *material);
-char *dxf_attdef_get_dictionary_owner_hard (DxfAttdef *attdef);
-DxfAttdef *dxf_attdef_set_dictionary_owner_hard (DxfAttdef *attdef, char *dictionary_owner_hard);
+uint64_t dxf_attdef_get_dictionary_owner_soft (DxfAttdef *attdef);
+DxfAttdef *dxf_attdef_set_dictionary_owner_soft (DxfAttdef *attdef, uint64_t dictionary_owner_soft);
+uint64_t dxf_attdef_get_object_owner_soft (DxfAttdef *attdef);
+DxfAttdef *dxf_attdef_set_object_owner_soft (DxfAttdef *attdef, uint64_t object_owner_soft);
+uint64_t dxf_attdef_get_material (DxfAttdef *attdef);
+DxfAttdef *dxf_attdef_set_material (DxfAttdef *attdef, uint64_t material);
+uint64_t dxf_attdef_get_dictionary_owner_hard (DxfAttdef *attdef);
+DxfAttdef *dxf_attdef_set_dictionary_owner_hard (DxfAttdef *attdef, uint64_t dictionary_owner_hard);
 int16_t dxf_attdef_get_lineweight (DxfAttdef *attdef);
 DxfAttdef *dxf_attdef_set_lineweight (DxfAttdef *attdef, int16_t lineweight);
-char *dxf_attdef_get_plot_style_name (DxfAttdef *attdef);
-DxfAttdef *dxf_attdef_set_plot_style_name (DxfAttdef *attdef, char *plot_style_name);
+uint64_t dxf_attdef_get_plot_style_name (DxfAttdef *attdef);
+DxfAttdef *dxf_attdef_set_plot_style_name (DxfAttdef *attdef, uint64_t plot_style_name);
 int32_t dxf_attdef_get_color_value (DxfAttdef *attdef);
 DxfAttdef *dxf_attdef_set_color_value (DxfAttdef *attdef, int32_t color_value);
 char *dxf_attdef_get_color_name (DxfAttdef *attdef);
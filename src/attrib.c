@@ -40,6 +40,7 @@
 
 
 #include "attrib.h"
+#include "util.h"
 
 
 /*!
@@ -59,7 +60,7 @@ dxf_attrib_new ()
         size = sizeof (DxfAttrib);
         /* avoid malloc of 0 bytes */
         if (size == 0) size = 1;
-        if ((attrib = malloc (size)) == NULL)
+        if ((attrib = dxf_malloc (size)) == NULL)
         {
                 fprintf (stderr,
                   (_("Error in %s () could not allocate memory.\n")),
@@ -110,10 +111,10 @@ dxf_attrib_init
                 return (NULL);
         }
         /* Assign initial values to members. */
-        attrib->id_code = 0;
-        attrib->linetype = strdup (DXF_DEFAULT_LINETYPE);
-        attrib->text_style = strdup (DXF_DEFAULT_TEXTSTYLE);
-        attrib->layer = strdup (DXF_DEFAULT_LAYER);
+        attrib->id_code = DXF_HANDLE_NONE;
+        attrib->linetype = dxf_strdup (DXF_DEFAULT_LINETYPE);
+        attrib->text_style = dxf_strdup (DXF_DEFAULT_TEXTSTYLE);
+        attrib->layer = dxf_strdup (DXF_DEFAULT_LAYER);
         attrib->elevation = 0.0;
         attrib->thickness = 0.0;
         attrib->linetype_scale = DXF_DEFAULT_LINETYPE_SCALE;
@@ -122,17 +123,17 @@ dxf_attrib_init
         attrib->paperspace = DXF_MODELSPACE;
         attrib->graphics_data_size = 0;
         attrib->shadow_mode = 0;
-        attrib->dictionary_owner_soft = strdup("");
-        attrib->object_owner_soft = strdup("");
-        attrib->material = strdup("");
-        attrib->dictionary_owner_hard = strdup("");
+        attrib->dictionary_owner_soft = 0;
+        attrib->object_owner_soft = 0;
+        attrib->material = 0;
+        attrib->dictionary_owner_hard = 0;
         attrib->lineweight = 0;
-        attrib->plot_style_name = strdup ("");
+        attrib->plot_style_name = 0;
         attrib->color_value = 0;
-        attrib->color_name = strdup ("");
+        attrib->color_name = dxf_strdup ("");
         attrib->transparency = 0;
-        attrib->default_value = strdup ("");
-        attrib->tag_value = strdup ("");
+        attrib->default_value = dxf_strdup ("");
+        attrib->tag_value = dxf_strdup ("");
         attrib->height = 0.0;
         attrib->rel_x_scale = 0.0;
         attrib->rot_angle = 0.0;
@@ -181,7 +182,8 @@ dxf_attrib_read
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        char *temp_string = NULL;
+        char temp_string[DXF_MAX_STRING_LENGTH];
+        int group_code;
         DxfBinaryData *iter310 = NULL;
         int iter330;
 
@@ -191,8 +193,6 @@ dxf_attrib_read
                 fprintf (stderr,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
-                /* Clean up. */
-                free (temp_string);
                 return (NULL);
         }
         if (attrib == NULL)
@@ -259,376 +259,302 @@ dxf_attrib_read
         }
         iter310 = (DxfBinaryData *) attrib->binary_graphics_data;
         iter330 = 0;
-        (fp->line_number)++;
-        fscanf (fp->fp, "%[^\n]", temp_string);
-        while (strcmp (temp_string, "0") != 0)
+        while ((dxf_read_group_code (fp, &group_code) == EXIT_SUCCESS)
+          && (group_code != 0))
         {
-                if (ferror (fp->fp))
+                if (dxf_read_error (fp))
                 {
                         fprintf (stderr,
                           (_("Error in %s () while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
-                        fclose (fp->fp);
-                        /* Clean up. */
-                        free (temp_string);
                         return (NULL);
                 }
-                if (strcmp (temp_string, "1") == 0)
-                {
-                        /* Now follows a string containing the attribute
-                         * value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, attrib->default_value);
-                }
-                else if (strcmp (temp_string, "2") == 0)
-                {
-                        /* Now follows a string containing a tag value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, attrib->tag_value);
-                }
-                else if (strcmp (temp_string, "5") == 0)
-                {
-                        /* Now follows a string containing a sequential
-                         * id number. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%x\n", (uint *) &attrib->id_code);
-                }
-                else if (strcmp (temp_string, "6") == 0)
-                {
-                        /* Now follows a string containing a linetype
-                         * name. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, attrib->linetype);
-                }
-                else if (strcmp (temp_string, "7") == 0)
-                {
-                        /* Now follows a string containing a text style. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, attrib->text_style);
-                }
-                else if (strcmp (temp_string, "8") == 0)
-                {
-                        /* Now follows a string containing a layer name. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, attrib->layer);
-                }
-                else if (strcmp (temp_string, "10") == 0)
-                {
-                        /* Now follows a string containing the
-                         * X-coordinate of the start point. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &attrib->p0->x0);
-                }
-                else if (strcmp (temp_string, "20") == 0)
-                {
-                        /* Now follows a string containing the
-                         * Y-coordinate of the start point. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &attrib->p0->y0);
-                }
-                else if (strcmp (temp_string, "30") == 0)
-                {
-                        /* Now follows a string containing the
-                         * Z-coordinate of the start point. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &attrib->p0->z0);
-                }
-                else if (strcmp (temp_string, "11") == 0)
-                {
-                        /* Now follows a string containing the
-                         * X-coordinate of the align point. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &attrib->p1->x0);
-                }
-                else if (strcmp (temp_string, "21") == 0)
-                {
-                        /* Now follows a string containing the
-                         * Y-coordinate of the align point. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &attrib->p1->y0);
-                }
-                else if (strcmp (temp_string, "31") == 0)
-                {
-                        /* Now follows a string containing the
-                         * Z-coordinate of the align point. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &attrib->p1->z0);
-                }
-                else if ((fp->acad_version_number <= AutoCAD_11)
-                        && (strcmp (temp_string, "38") == 0)
-                        && (attrib->elevation = 0.0))
-                {
-                        /* Elevation is a pre AutoCAD R11 variable
-                         * so additional testing for the version should
-                         * probably be added.
-                         * Now follows a string containing the
-                         * elevation. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &attrib->elevation);
-                }
-                else if (strcmp (temp_string, "39") == 0)
-                {
-                        /* Now follows a string containing the
-                         * thickness. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &attrib->thickness);
-                }
-                else if (strcmp (temp_string, "40") == 0)
-                {
-                        /* Now follows a string containing the
-                         * height. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &attrib->height);
-                }
-                else if (strcmp (temp_string, "41") == 0)
-                {
-                        /* Now follows a string containing the
-                         * relative X-scale. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &attrib->rel_x_scale);
-                }
-                else if (strcmp (temp_string, "48") == 0)
-                {
-                        /* Now follows a string containing the linetype
-                         * scale. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &attrib->linetype_scale);
-                }
-                else if (strcmp (temp_string, "50") == 0)
-                {
-                        /* Now follows a string containing the
-                         * rotation angle. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &attrib->rot_angle);
-                }
-                else if (strcmp (temp_string, "51") == 0)
-                {
-                        /* Now follows a string containing the
-                         * end angle. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &attrib->obl_angle);
-                }
-                else if (strcmp (temp_string, "60") == 0)
-                {
-                        /* Now follows a string containing the
-                         * visibility value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%hd\n", &attrib->visibility);
-                }
-                else if (strcmp (temp_string, "62") == 0)
-                {
-                        /* Now follows a string containing the
-                         * color value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%hd\n", &attrib->color);
-                }
-                else if (strcmp (temp_string, "67") == 0)
-                {
-                        /* Now follows a string containing the
-                         * paperspace value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%hd\n", &attrib->paperspace);
-                }
-                else if (strcmp (temp_string, "70") == 0)
-                {
-                        /* Now follows a string containing the
-                         * attribute flags value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%hd\n", &attrib->attr_flags);
-                }
-                else if (strcmp (temp_string, "71") == 0)
-                {
-                        /* Now follows a string containing the
-                         * text flags value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%hd\n", &attrib->text_flags);
-                }
-                else if (strcmp (temp_string, "72") == 0)
+                switch (group_code)
                 {
-                        /* Now follows a string containing the
-                         * horizontal alignment value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%hd\n", &attrib->hor_align);
-                }
-                else if (strcmp (temp_string, "73") == 0)
-                {
-                        /* Now follows a string containing the
-                         * field length value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%hd\n", &attrib->field_length);
-                }
-                else if (strcmp (temp_string, "74") == 0)
-                {
-                        /* Now follows a string containing the
-                         * vertical alignment value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%hd\n", &attrib->vert_align);
-                }
-                else if (strcmp (temp_string, "92") == 0)
-                {
-                        /* Now follows a string containing the
-                         * graphics data size value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%" PRIi32 "\n", &attrib->graphics_data_size);
-                }
-                else if ((fp->acad_version_number >= AutoCAD_12)
-                        && (strcmp (temp_string, "100") == 0))
-                {
-                        /* Subclass markers are post AutoCAD R12
-                         * variable so additional testing for the
-                         * version should probably be added here.
-                         * Now follows a string containing the
-                         * subclass marker value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
-                        if ((strcmp (temp_string, "AcDbEntity") != 0)
-                        && (strcmp (temp_string, "AcDbText") != 0)
-                        && (strcmp (temp_string, "AcDbAttribute") != 0))
-                        {
+                        case 1:
+                                /* Now follows a string containing the attribute
+                                 * value. */
+                                dxf_read_string (fp, &attrib->default_value);
+                                break;
+                        case 2:
+                                /* Now follows a string containing a tag value. */
+                                dxf_read_string (fp, &attrib->tag_value);
+                                break;
+                        case 5:
+                                /* Now follows a string containing a sequential
+                                 * id number. */
+                                dxf_read_handle (fp, &attrib->id_code);
+                                break;
+                        case 6:
+                                /* Now follows a string containing a linetype
+                                 * name. */
+                                dxf_read_string_interned (fp, &attrib->linetype);
+                                break;
+                        case 7:
+                                /* Now follows a string containing a text style. */
+                                dxf_read_string_interned (fp, &attrib->text_style);
+                                break;
+                        case 8:
+                                /* Now follows a string containing a layer name. */
+                                dxf_read_string_interned (fp, &attrib->layer);
+                                break;
+                        case 10:
+                                /* Now follows a string containing the
+                                 * X-coordinate of the start point. */
+                                dxf_read_double (fp, &attrib->p0->x0);
+                                break;
+                        case 20:
+                                /* Now follows a string containing the
+                                 * Y-coordinate of the start point. */
+                                dxf_read_double (fp, &attrib->p0->y0);
+                                break;
+                        case 30:
+                                /* Now follows a string containing the
+                                 * Z-coordinate of the start point. */
+                                dxf_read_double (fp, &attrib->p0->z0);
+                                break;
+                        case 11:
+                                /* Now follows a string containing the
+                                 * X-coordinate of the align point. */
+                                dxf_read_double (fp, &attrib->p1->x0);
+                                break;
+                        case 21:
+                                /* Now follows a string containing the
+                                 * Y-coordinate of the align point. */
+                                dxf_read_double (fp, &attrib->p1->y0);
+                                break;
+                        case 31:
+                                /* Now follows a string containing the
+                                 * Z-coordinate of the align point. */
+                                dxf_read_double (fp, &attrib->p1->z0);
+                                break;
+                        case 38:
+                                if ((fp->acad_version_number <= AutoCAD_11) && (attrib->elevation = 0.0))
+                                {
+                                        /* Elevation is a pre AutoCAD R11 variable
+                                         * so additional testing for the version should
+                                         * probably be added.
+                                         * Now follows a string containing the
+                                         * elevation. */
+                                        dxf_read_double (fp, &attrib->elevation);
+                                }
+                                else
+                                {
+                                        fprintf (stderr,
+                                          (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
+                                          __FUNCTION__, fp->filename, fp->line_number);
+                                        /* Skip the value of the unknown group code. */
+                                        dxf_read_line (temp_string, fp);
+                                }
+                                break;
+                        case 39:
+                                /* Now follows a string containing the
+                                 * thickness. */
+                                dxf_read_double (fp, &attrib->thickness);
+                                break;
+                        case 40:
+                                /* Now follows a string containing the
+                                 * height. */
+                                dxf_read_double (fp, &attrib->height);
+                                break;
+                        case 41:
+                                /* Now follows a string containing the
+                                 * relative X-scale. */
+                                dxf_read_double (fp, &attrib->rel_x_scale);
+                                break;
+                        case 48:
+                                /* Now follows a string containing the linetype
+                                 * scale. */
+                                dxf_read_double (fp, &attrib->linetype_scale);
+                                break;
+                        case 50:
+                                /* Now follows a string containing the
+                                 * rotation angle. */
+                                dxf_read_double (fp, &attrib->rot_angle);
+                                break;
+                        case 51:
+                                /* Now follows a string containing the
+                                 * end angle. */
+                                dxf_read_double (fp, &attrib->obl_angle);
+                                break;
+                        case 60:
+                                /* Now follows a string containing the
+                                 * visibility value. */
+                                dxf_read_int16 (fp, &attrib->visibility);
+                                break;
+                        case 62:
+                                /* Now follows a string containing the
+                                 * color value. */
+                                dxf_read_int16 (fp, &attrib->color);
+                                break;
+                        case 67:
+                                /* Now follows a string containing the
+                                 * paperspace value. */
+                                dxf_read_int16 (fp, &attrib->paperspace);
+                                break;
+                        case 70:
+                                /* Now follows a string containing the
+                                 * attribute flags value. */
+                                dxf_read_int16 (fp, &attrib->attr_flags);
+                                break;
+                        case 71:
+                                /* Now follows a string containing the
+                                 * text flags value. */
+                                dxf_read_int16 (fp, &attrib->text_flags);
+                                break;
+                        case 72:
+                                /* Now follows a string containing the
+                                 * horizontal alignment value. */
+                                dxf_read_int16 (fp, &attrib->hor_align);
+                                break;
+                        case 73:
+                                /* Now follows a string containing the
+                                 * field length value. */
+                                dxf_read_int16 (fp, &attrib->field_length);
+                                break;
+                        case 74:
+                                /* Now follows a string containing the
+                                 * vertical alignment value. */
+                                dxf_read_int16 (fp, &attrib->vert_align);
+                                break;
+                        case 92:
+                                /* Now follows a string containing the
+                                 * graphics data size value. */
+                                dxf_read_int32 (fp, &attrib->graphics_data_size);
+                                break;
+                        case 100:
+                                if (fp->acad_version_number >= AutoCAD_12)
+                                {
+                                        /* Subclass markers are post AutoCAD R12
+                                         * variable so additional testing for the
+                                         * version should probably be added here.
+                                         * Now follows a string containing the
+                                         * subclass marker value. */
+                                        dxf_read_line (temp_string, fp);
+                                        if ((strcmp (temp_string, "AcDbEntity") != 0)
+                                        && (strcmp (temp_string, "AcDbText") != 0)
+                                        && (strcmp (temp_string, "AcDbAttribute") != 0))
+                                        {
+                                                fprintf (stderr,
+                                                  (_("Warning in %s () found a bad subclass marker in: %s in line: %d.\n")),
+                                                  __FUNCTION__, fp->filename, fp->line_number);
+                                        }
+                                }
+                                else
+                                {
+                                        fprintf (stderr,
+                                          (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
+                                          __FUNCTION__, fp->filename, fp->line_number);
+                                        /* Skip the value of the unknown group code. */
+                                        dxf_read_line (temp_string, fp);
+                                }
+                                break;
+                        case 160:
+                                /* Now follows a string containing the
+                                 * graphics data size value. */
+                                dxf_read_int32 (fp, &attrib->graphics_data_size);
+                                break;
+                        case 210:
+                                /* Now follows a string containing the
+                                 * X-value of the extrusion vector. */
+                                dxf_read_double (fp, &attrib->extr_x0);
+                                break;
+                        case 220:
+                                /* Now follows a string containing the
+                                 * Y-value of the extrusion vector. */
+                                dxf_read_double (fp, &attrib->extr_y0);
+                                break;
+                        case 230:
+                                /* Now follows a string containing the
+                                 * Z-value of the extrusion vector. */
+                                dxf_read_double (fp, &attrib->extr_z0);
+                                break;
+                        case 284:
+                                /* Now follows a string containing the shadow
+                                 * mode value. */
+                                dxf_read_int16 (fp, &attrib->shadow_mode);
+                                break;
+                        case 310:
+                                /* Now follows a string containing binary
+                                 * graphics data. */
+                                iter310 = dxf_binary_data_read (fp, iter310);
+                                break;
+                        case 330:
+                                if (iter330 == 0)
+                                {
+                                        /* Now follows a string containing a soft-pointer
+                                         * ID/handle to owner dictionary. */
+                                        dxf_read_handle (fp, &attrib->dictionary_owner_soft);
+                                }
+                                if (iter330 == 1)
+                                {
+                                        /* Now follows a string containing a soft-pointer
+                                         * ID/handle to owner object. */
+                                        dxf_read_handle (fp, &attrib->object_owner_soft);
+                                }
+                                iter330++;
+                                break;
+                        case 347:
+                                /* Now follows a string containing a
+                                 * hard-pointer ID/handle to material object. */
+                                dxf_read_handle (fp, &attrib->material);
+                                break;
+                        case 360:
+                                /* Now follows a string containing Hard owner
+                                 * ID/handle to owner dictionary. */
+                                dxf_read_handle (fp, &attrib->dictionary_owner_hard);
+                                break;
+                        case 370:
+                                /* Now follows a string containing the lineweight
+                                 * value. */
+                                dxf_read_int16 (fp, &attrib->lineweight);
+                                break;
+                        case 390:
+                                /* Now follows a string containing a plot style
+                                 * name value. */
+                                dxf_read_handle (fp, &attrib->plot_style_name);
+                                break;
+                        case 420:
+                                /* Now follows a string containing a color value. */
+                                dxf_read_int32 (fp, &attrib->color_value);
+                                break;
+                        case 430:
+                                /* Now follows a string containing a color
+                                 * name value. */
+                                dxf_read_string_interned (fp, &attrib->color_name);
+                                break;
+                        case 440:
+                                /* Now follows a string containing a transparency
+                                 * value. */
+                                dxf_read_int32 (fp, &attrib->transparency);
+                                break;
+                        case 999:
+                                /* Now follows a string containing a comment. */
+                                dxf_read_line (temp_string, fp);
+                                fprintf (stdout, "DXF comment: %s\n", temp_string);
+                                break;
+                        default:
                                 fprintf (stderr,
-                                  (_("Warning in %s () found a bad subclass marker in: %s in line: %d.\n")),
+                                  (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
                                   __FUNCTION__, fp->filename, fp->line_number);
-                        }
-                }
-                else if (strcmp (temp_string, "160") == 0)
-                {
-                        /* Now follows a string containing the
-                         * graphics data size value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%" PRIi32 "\n", &attrib->graphics_data_size);
-                }
-                else if (strcmp (temp_string, "210") == 0)
-                {
-                        /* Now follows a string containing the
-                         * X-value of the extrusion vector. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &attrib->extr_x0);
-                }
-                else if (strcmp (temp_string, "220") == 0)
-                {
-                        /* Now follows a string containing the
-                         * Y-value of the extrusion vector. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &attrib->extr_y0);
-                }
-                else if (strcmp (temp_string, "230") == 0)
-                {
-                        /* Now follows a string containing the
-                         * Z-value of the extrusion vector. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &attrib->extr_z0);
-                }
-                else if (strcmp (temp_string, "284") == 0)
-                {
-                        /* Now follows a string containing the shadow
-                         * mode value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%hd\n", &attrib->shadow_mode);
-                }
-                else if (strcmp (temp_string, "310") == 0)
-                {
-                        /* Now follows a string containing binary
-                         * graphics data. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, iter310->data_line);
-                        dxf_binary_data_init ((DxfBinaryData *) iter310->next);
-                        iter310 = (DxfBinaryData *) iter310->next;
-                }
-                else if (strcmp (temp_string, "330") == 0)
-                {
-                        if (iter330 == 0)
-                        {
-                                /* Now follows a string containing a soft-pointer
-                                 * ID/handle to owner dictionary. */
-                                (fp->line_number)++;
-                                fscanf (fp->fp, DXF_MAX_STRING_FORMAT, attrib->dictionary_owner_soft);
-                        }
-                        if (iter330 == 1)
-                        {
-                                /* Now follows a string containing a soft-pointer
-                                 * ID/handle to owner object. */
-                                (fp->line_number)++;
-                                fscanf (fp->fp, DXF_MAX_STRING_FORMAT, attrib->object_owner_soft);
-                        }
-                        iter330++;
-                }
-                else if (strcmp (temp_string, "347") == 0)
-                {
-                        /* Now follows a string containing a
-                         * hard-pointer ID/handle to material object. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, attrib->material);
-                }
-                else if (strcmp (temp_string, "360") == 0)
-                {
-                        /* Now follows a string containing Hard owner
-                         * ID/handle to owner dictionary. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, attrib->dictionary_owner_hard);
-                }
-                else if (strcmp (temp_string, "370") == 0)
-                {
-                        /* Now follows a string containing the lineweight
-                         * value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%hd\n", &attrib->lineweight);
-                }
-                else if (strcmp (temp_string, "390") == 0)
-                {
-                        /* Now follows a string containing a plot style
-                         * name value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, attrib->plot_style_name);
-                }
-                else if (strcmp (temp_string, "420") == 0)
-                {
-                        /* Now follows a string containing a color value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%" PRIi32 "\n", &attrib->color_value);
-                }
-                else if (strcmp (temp_string, "430") == 0)
-                {
-                        /* Now follows a string containing a color
-                         * name value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, attrib->color_name);
-                }
-                else if (strcmp (temp_string, "440") == 0)
-                {
-                        /* Now follows a string containing a transparency
-                         * value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%" PRIi32 "\n", &attrib->transparency);
-                }
-                else if (strcmp (temp_string, "999") == 0)
-                {
-                        /* Now follows a string containing a comment. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
-                        fprintf (stdout, "DXF comment: %s\n", temp_string);
-                }
-                else
-                {
-                        fprintf (stderr,
-                          (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
-                          __FUNCTION__, fp->filename, fp->line_number);
+                                /* Skip the value of the unknown group code. */
+                                dxf_read_line (temp_string, fp);
+                                break;
                 }
         }
         /* Handle omitted members and/or illegal values. */
         if (strcmp (attrib->linetype, "") == 0)
         {
-                attrib->linetype = strdup (DXF_DEFAULT_LINETYPE);
+                attrib->linetype = dxf_strdup (DXF_DEFAULT_LINETYPE);
         }
         if (strcmp (attrib->layer, "") == 0)
         {
-                attrib->layer = strdup (DXF_DEFAULT_LAYER);
+                attrib->layer = dxf_strdup (DXF_DEFAULT_LAYER);
         }
-        /* Clean up. */
-        free (temp_string);
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (EXIT_SUCCESS);
+        return (attrib);
 }
 
 
@@ -647,7 +573,7 @@ dxf_attrib_write
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        char *dxf_entity_name = strdup ("ATTRIB");
+        char *dxf_entity_name = dxf_strdup ("ATTRIB");
 
         /* Do some basic checks. */
         if (fp == NULL)
@@ -656,7 +582,7 @@ dxf_attrib_write
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (attrib == NULL)
@@ -665,61 +591,61 @@ dxf_attrib_write
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (strcmp (attrib->default_value, "") == 0)
         {
                 fprintf (stderr,
-                  (_("Error in %s () default value string is empty for the %s entity with id-code: %x.\n")),
+                  (_("Error in %s () default value string is empty for the %s entity with id-code: %" PRIx64 ".\n")),
                   __FUNCTION__, dxf_entity_name, attrib->id_code);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (strcmp (attrib->tag_value, "") == 0)
         {
                 fprintf (stderr,
-                  (_("Error in %s () tag value string is empty for the %s entity with id-code: %x.\n")),
+                  (_("Error in %s () tag value string is empty for the %s entity with id-code: %" PRIx64 ".\n")),
                   __FUNCTION__, dxf_entity_name, attrib->id_code);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (strcmp (attrib->text_style, "") == 0)
         {
                 fprintf (stderr,
-                  (_("Warning in %s () text style string is empty for the %s entity with id-code: %x.\n")),
+                  (_("Warning in %s () text style string is empty for the %s entity with id-code: %" PRIx64 ".\n")),
                   __FUNCTION__, dxf_entity_name, attrib->id_code);
                 fprintf (stderr,
                   (_("\tdefault text style STANDARD applied to %s entity.\n")),
                   dxf_entity_name);
-                attrib->text_style = strdup (DXF_DEFAULT_TEXTSTYLE);
+                attrib->text_style = dxf_strdup (DXF_DEFAULT_TEXTSTYLE);
         }
         if (strcmp (attrib->linetype, "") == 0)
         {
                 fprintf (stderr,
-                  (_("Warning in %s () empty linetype string for the %s entity with id-code: %x\n")),
+                  (_("Warning in %s () empty linetype string for the %s entity with id-code: %" PRIx64 "\n")),
                   __FUNCTION__, dxf_entity_name, attrib->id_code);
                 fprintf (stderr,
                   (_("\t%s entity is reset to default linetype")),
                   dxf_entity_name);
-                attrib->linetype = strdup (DXF_DEFAULT_LINETYPE);
+                attrib->linetype = dxf_strdup (DXF_DEFAULT_LINETYPE);
         }
         if (strcmp (attrib->layer, "") == 0)
         {
                 fprintf (stderr,
-                  (_("Warning in %s () empty layer string for the %s entity with id-code: %x.\n")),
+                  (_("Warning in %s () empty layer string for the %s entity with id-code: %" PRIx64 ".\n")),
                   __FUNCTION__, dxf_entity_name, attrib->id_code);
                 fprintf (stderr,
                   (_("\t%s entity is relocated to the default layer.\n")),
                   dxf_entity_name);
-                attrib->layer = strdup (DXF_DEFAULT_LAYER);
+                attrib->layer = dxf_strdup (DXF_DEFAULT_LAYER);
         }
         if (attrib->height == 0.0)
         {
                 fprintf (stderr,
-                  (_("Warning in %s () height has a value of 0.0 for the %s entity with id-code: %x.\n")),
+                  (_("Warning in %s () height has a value of 0.0 for the %s entity with id-code: %" PRIx64 ".\n")),
                   __FUNCTION__, dxf_entity_name, attrib->id_code);
                 fprintf (stderr,
                   (_("\tdefault height of 1.0 applied to %s entity.\n")),
@@ -729,7 +655,7 @@ dxf_attrib_write
         if (attrib->rel_x_scale == 0.0)
         {
                 fprintf (stderr,
-                  (_("Warning in %s () relative X-scale factor has a value of 0.0 for the %s entity with id-code: %x.\n")),
+                  (_("Warning in %s () relative X-scale factor has a value of 0.0 for the %s entity with id-code: %" PRIx64 ".\n")),
                   __FUNCTION__, dxf_entity_name, attrib->id_code);
                 fprintf (stderr,
                   (_("\tdefault relative X-scale of 1.0 applied to %s entity.\n")),
@@ -737,10 +663,10 @@ dxf_attrib_write
                 attrib->rel_x_scale = 1.0;
         }
         /* Start writing output. */
-        fprintf (fp->fp, "  0\n%s\n", dxf_entity_name);
-        if (attrib->id_code != -1)
+        dxf_write_string (fp, 0, dxf_entity_name);
+        if (attrib->id_code != DXF_HANDLE_NONE)
         {
-                fprintf (fp->fp, "  5\n%x\n", attrib->id_code);
+                dxf_write_hex (fp, 5, attrib->id_code);
         }
         /*!
          * \todo for version R14.\n
@@ -752,75 +678,75 @@ dxf_attrib_write
          * 102 groups are application defined (optional).\n\n
          * End of group, "}" (optional), with Group code 102.
          */
-        if ((strcmp (attrib->dictionary_owner_soft, "") != 0)
+        if ((attrib->dictionary_owner_soft != 0)
           && (fp->acad_version_number >= AutoCAD_14))
         {
-                fprintf (fp->fp, "102\n{ACAD_REACTORS\n");
-                fprintf (fp->fp, "330\n%s\n", attrib->dictionary_owner_soft);
-                fprintf (fp->fp, "102\n}\n");
+                dxf_write_string (fp, 102, "{ACAD_REACTORS");
+                dxf_write_hex (fp, 330, attrib->dictionary_owner_soft);
+                dxf_write_string (fp, 102, "}");
         }
-        if ((strcmp (attrib->dictionary_owner_hard, "") != 0)
+        if ((attrib->dictionary_owner_hard != 0)
           && (fp->acad_version_number >= AutoCAD_14))
         {
-                fprintf (fp->fp, "102\n{ACAD_XDICTIONARY\n");
-                fprintf (fp->fp, "360\n%s\n", attrib->dictionary_owner_hard);
-                fprintf (fp->fp, "102\n}\n");
+                dxf_write_string (fp, 102, "{ACAD_XDICTIONARY");
+                dxf_write_hex (fp, 360, attrib->dictionary_owner_hard);
+                dxf_write_string (fp, 102, "}");
         }
-        if ((strcmp (attrib->object_owner_soft, "") != 0)
+        if ((attrib->object_owner_soft != 0)
           && (fp->acad_version_number >= AutoCAD_2000))
         {
-                fprintf (fp->fp, "330\n%s\n", attrib->object_owner_soft);
+                dxf_write_hex (fp, 330, attrib->object_owner_soft);
         }
         if (fp->acad_version_number >= AutoCAD_13)
         {
-                fprintf (fp->fp, "100\nAcDbEntity\n");
+                dxf_write_string (fp, 100, "AcDbEntity");
         }
         if (attrib->paperspace == DXF_PAPERSPACE)
         {
-                fprintf (fp->fp, " 67\n%hd\n", (int16_t) DXF_PAPERSPACE);
+                dxf_write_int (fp, 67, (int16_t) DXF_PAPERSPACE);
         }
-        fprintf (fp->fp, "  8\n%s\n", attrib->layer);
+        dxf_write_string (fp, 8, attrib->layer);
         if (strcmp (attrib->linetype, DXF_DEFAULT_LINETYPE) != 0)
         {
-                fprintf (fp->fp, "  6\n%s\n", attrib->linetype);
+                dxf_write_string (fp, 6, attrib->linetype);
         }
         if ((fp->acad_version_number >= AutoCAD_2008)
-          && (strcmp (attrib->material, "") != 0))
+          && (attrib->material != 0))
         {
-                fprintf (fp->fp, "347\n%s\n", attrib->material);
+                dxf_write_hex (fp, 347, attrib->material);
         }
         if (attrib->color != DXF_COLOR_BYLAYER)
         {
-                fprintf (fp->fp, " 62\n%hd\n", attrib->color);
+                dxf_write_int (fp, 62, attrib->color);
         }
         if (fp->acad_version_number >= AutoCAD_2002)
         {
-                fprintf (fp->fp, "370\n%d\n", attrib->lineweight);
+                dxf_write_int (fp, 370, attrib->lineweight);
         }
         if ((fp->acad_version_number <= AutoCAD_11)
           && DXF_FLATLAND
           && (attrib->elevation != 0.0))
         {
-                fprintf (fp->fp, " 38\n%f\n", attrib->elevation);
+                dxf_write_double (fp, 38, attrib->elevation);
         }
         if (attrib->thickness != 0.0)
         {
-                fprintf (fp->fp, " 39\n%f\n", attrib->thickness);
+                dxf_write_double (fp, 39, attrib->thickness);
         }
         if (attrib->linetype_scale != 1.0)
         {
-                fprintf (fp->fp, " 48\n%f\n", attrib->linetype_scale);
+                dxf_write_double (fp, 48, attrib->linetype_scale);
         }
         if (attrib->visibility != 0)
         {
-                fprintf (fp->fp, " 60\n%hd\n", attrib->visibility);
+                dxf_write_int (fp, 60, attrib->visibility);
         }
         if (fp->acad_version_number >= AutoCAD_2000)
         {
 #ifdef BUILD_64
-                fprintf (fp->fp, "160\n%" PRIi32 "\n", attrib->graphics_data_size);
+                dxf_write_int (fp, 160, attrib->graphics_data_size);
 #else
-                fprintf (fp->fp, " 92\n%" PRIi32 "\n", attrib->graphics_data_size);
+                dxf_write_int (fp, 92, attrib->graphics_data_size);
 #endif
                 if (attrib->binary_graphics_data != NULL)
                 {
@@ -828,68 +754,68 @@ dxf_attrib_write
                         iter = (DxfBinaryData *) attrib->binary_graphics_data;
                         while (iter != NULL)
                         {
-                                fprintf (fp->fp, "310\n%s\n", iter->data_line);
+                                dxf_binary_data_write (fp, iter);
                                 iter = (DxfBinaryData *) iter->next;
                         }
                 }
         }
         if (fp->acad_version_number >= AutoCAD_2004)
         {
-                fprintf (fp->fp, "420\n%" PRIi32 "\n", attrib->color_value);
-                fprintf (fp->fp, "430\n%s\n", attrib->color_name);
-                fprintf (fp->fp, "440\n%" PRIi32 "\n", attrib->transparency);
+                dxf_write_int (fp, 420, attrib->color_value);
+                dxf_write_string (fp, 430, attrib->color_name);
+                dxf_write_int (fp, 440, attrib->transparency);
         }
         if (fp->acad_version_number >= AutoCAD_2009)
         {
-                fprintf (fp->fp, "390\n%s\n", attrib->plot_style_name);
-                fprintf (fp->fp, "284\n%d\n", attrib->shadow_mode);
+                dxf_write_hex (fp, 390, attrib->plot_style_name);
+                dxf_write_int (fp, 284, attrib->shadow_mode);
         }
         if (fp->acad_version_number >= AutoCAD_13)
         {
-                fprintf (fp->fp, "100\nAcDbText\n");
+                dxf_write_string (fp, 100, "AcDbText");
         }
-        fprintf (fp->fp, " 10\n%f\n", attrib->p0->x0);
-        fprintf (fp->fp, " 20\n%f\n", attrib->p0->y0);
-        fprintf (fp->fp, " 30\n%f\n", attrib->p0->z0);
-        fprintf (fp->fp, " 40\n%f\n", attrib->height);
-        fprintf (fp->fp, "  1\n%s\n", attrib->default_value);
+        dxf_write_double (fp, 10, attrib->p0->x0);
+        dxf_write_double (fp, 20, attrib->p0->y0);
+        dxf_write_double (fp, 30, attrib->p0->z0);
+        dxf_write_double (fp, 40, attrib->height);
+        dxf_write_string (fp, 1, attrib->default_value);
         if (fp->acad_version_number >= AutoCAD_13)
         {
-                fprintf (fp->fp, "100\nAcDbAttribute\n");
+                dxf_write_string (fp, 100, "AcDbAttribute");
         }
-        fprintf (fp->fp, "  2\n%s\n", attrib->tag_value);
-        fprintf (fp->fp, " 70\n%hd\n", attrib->attr_flags);
+        dxf_write_string (fp, 2, attrib->tag_value);
+        dxf_write_int (fp, 70, attrib->attr_flags);
         if (attrib->field_length != 0)
         {
-                fprintf (fp->fp, " 73\n%hd\n", attrib->field_length);
+                dxf_write_int (fp, 73, attrib->field_length);
         }
         if (attrib->rot_angle != 0.0)
         {
-                fprintf (fp->fp, " 50\n%f\n", attrib->rot_angle);
+                dxf_write_double (fp, 50, attrib->rot_angle);
         }
         if (attrib->rel_x_scale != 1.0)
         {
-                fprintf (fp->fp, " 41\n%f\n", attrib->rel_x_scale);
+                dxf_write_double (fp, 41, attrib->rel_x_scale);
         }
         if (attrib->obl_angle != 0.0)
         {
-                fprintf (fp->fp, " 51\n%f\n", attrib->obl_angle);
+                dxf_write_double (fp, 51, attrib->obl_angle);
         }
         if (strcmp (attrib->text_style, "STANDARD") != 0)
         {
-                fprintf (fp->fp, "  7\n%s\n", attrib->text_style);
+                dxf_write_string (fp, 7, attrib->text_style);
         }
         if (attrib->text_flags != 0)
         {
-                fprintf (fp->fp, " 71\n%hd\n", attrib->text_flags);
+                dxf_write_int (fp, 71, attrib->text_flags);
         }
         if (attrib->hor_align != 0)
         {
-                fprintf (fp->fp, " 72\n%hd\n", attrib->hor_align);
+                dxf_write_int (fp, 72, attrib->hor_align);
         }
         if (attrib->vert_align != 0)
         {
-                fprintf (fp->fp, " 74\n%hd\n", attrib->vert_align);
+                dxf_write_int (fp, 74, attrib->vert_align);
         }
         if ((attrib->hor_align != 0) || (attrib->vert_align != 0))
         {
@@ -898,7 +824,7 @@ dxf_attrib_write
                         && (attrib->p0->z0 == attrib->p1->z0))
                 {
                         fprintf (stderr,
-                          (_("Warning in %s () insertion point and alignment point are identical for the %s entity with id-code: %x.\n")),
+                          (_("Warning in %s () insertion point and alignment point are identical for the %s entity with id-code: %" PRIx64 ".\n")),
                           __FUNCTION__, dxf_entity_name, attrib->id_code);
                         fprintf (stderr,
                           (_("    default justification applied to %s entity\n")),
@@ -908,9 +834,9 @@ dxf_attrib_write
                 }
                 else
                 {
-                        fprintf (fp->fp, " 11\n%f\n", attrib->p1->x0);
-                        fprintf (fp->fp, " 21\n%f\n", attrib->p1->y0);
-                        fprintf (fp->fp, " 31\n%f\n", attrib->p1->z0);
+                        dxf_write_double (fp, 11, attrib->p1->x0);
+                        dxf_write_double (fp, 21, attrib->p1->y0);
+                        dxf_write_double (fp, 31, attrib->p1->z0);
                 }
         }
         if ((fp->acad_version_number >= AutoCAD_12)
@@ -918,12 +844,12 @@ dxf_attrib_write
                 && (attrib->extr_y0 != 0.0)
                 && (attrib->extr_z0 != 1.0))
         {
-                fprintf (fp->fp, "210\n%f\n", attrib->extr_x0);
-                fprintf (fp->fp, "220\n%f\n", attrib->extr_y0);
-                fprintf (fp->fp, "230\n%f\n", attrib->extr_z0);
+                dxf_write_double (fp, 210, attrib->extr_x0);
+                dxf_write_double (fp, 220, attrib->extr_y0);
+                dxf_write_double (fp, 230, attrib->extr_z0);
         }
         /* Clean up. */
-        free (dxf_entity_name);
+        dxf_free (dxf_entity_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -962,21 +888,16 @@ dxf_attrib_free
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        free (attrib->linetype);
-        free (attrib->layer);
+        dxf_string_free (attrib->linetype);
+        dxf_string_free (attrib->layer);
         dxf_binary_data_free_list (attrib->binary_graphics_data);
-        free (attrib->dictionary_owner_soft);
-        free (attrib->object_owner_soft);
-        free (attrib->material);
-        free (attrib->dictionary_owner_hard);
-        free (attrib->plot_style_name);
-        free (attrib->color_name);
-        free (attrib->default_value);
-        free (attrib->tag_value);
-        free (attrib->text_style);
+        dxf_string_free (attrib->color_name);
+        dxf_free (attrib->default_value);
+        dxf_free (attrib->tag_value);
+        dxf_string_free (attrib->text_style);
         dxf_point_free (attrib->p0);
         dxf_point_free (attrib->p1);
-        free (attrib);
+        dxf_free (attrib);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1022,7 +943,7 @@ dxf_attrib_free_list
  *
  * \return ID code.
  */
-int
+uint64_t
 dxf_attrib_get_id_code
 (
         DxfAttrib *attrib
@@ -1040,12 +961,6 @@ dxf_attrib_get_id_code
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (attrib->id_code < 0)
-        {
-                fprintf (stderr,
-                  (_("Warning in %s () a negative value was found.\n")),
-                  __FUNCTION__);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1061,7 +976,7 @@ dxf_attrib_set_id_code
 (
         DxfAttrib *attrib,
                 /*!< a pointer to a DXF \c ATTRIB entity. */
-        int id_code
+        uint64_t id_code
                 /*!< Identification number for the entity.\n
                  * This is to be an unique (sequential) number in the DXF
                  * file. */
@@ -1078,12 +993,6 @@ dxf_attrib_set_id_code
                   __FUNCTION__);
                 return (NULL);
         }
-        if (id_code < 0)
-        {
-                fprintf (stderr,
-                  (_("Warning in %s () a negative value was passed.\n")),
-                  __FUNCTION__);
-        }
         attrib->id_code = id_code;
 #if DEBUG
         DXF_DEBUG_END
@@ -1125,7 +1034,7 @@ dxf_attrib_get_linetype
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (attrib->linetype));
+        return (dxf_strdup (attrib->linetype));
 }
 
 
@@ -1159,7 +1068,7 @@ dxf_attrib_set_linetype
                   __FUNCTION__);
                 return (NULL);
         }
-        attrib->linetype = strdup (linetype);
+        attrib->linetype = dxf_strdup (linetype);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1200,7 +1109,7 @@ dxf_attrib_get_layer
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (attrib->layer));
+        return (dxf_strdup (attrib->layer));
 }
 
 
@@ -1234,7 +1143,7 @@ dxf_attrib_set_layer
                   __FUNCTION__);
                 return (NULL);
         }
-        attrib->layer = strdup (layer);
+        attrib->layer = dxf_strdup (layer);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1960,10 +1869,8 @@ dxf_attrib_set_binary_graphics_data
  * \c ATTRIB entity.
  *
  * \return soft pointer to the dictionary owner.
- *
- * \warning No checks are performed on the returned pointer (string).
  */
-char *
+uint64_t
 dxf_attrib_get_dictionary_owner_soft
 (
         DxfAttrib *attrib
@@ -1979,19 +1886,12 @@ dxf_attrib_get_dictionary_owner_soft
                 fprintf (stderr,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
-                return (NULL);
-        }
-        if (attrib->dictionary_owner_soft ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
+                return (0);
         }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (attrib->dictionary_owner_soft));
+        return (attrib->dictionary_owner_soft);
 }
 
 
@@ -2004,8 +1904,8 @@ dxf_attrib_set_dictionary_owner_soft
 (
         DxfAttrib *attrib,
                 /*!< a pointer to a DXF \c ATTRIB entity. */
-        char *dictionary_owner_soft
-                /*!< a string containing the pointer to the
+        uint64_t dictionary_owner_soft
+                /*!< the handle of the
                  * dictionary_owner_soft for the entity. */
 )
 {
@@ -2020,14 +1920,7 @@ dxf_attrib_set_dictionary_owner_soft
                   __FUNCTION__);
                 return (NULL);
         }
-        if (dictionary_owner_soft == NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was passed.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
-        attrib->dictionary_owner_soft = strdup (dictionary_owner_soft);
+        attrib->dictionary_owner_soft = dictionary_owner_soft;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2040,10 +1933,8 @@ dxf_attrib_set_dictionary_owner_soft
  * \c ATTRIB entity.
  *
  * \return soft pointer to the object owner.
- *
- * \warning No checks are performed on the returned pointer (string).
  */
-char *
+uint64_t
 dxf_attrib_get_object_owner_soft
 (
         DxfAttrib *attrib
@@ -2059,19 +1950,12 @@ dxf_attrib_get_object_owner_soft
                 fprintf (stderr,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
-                return (NULL);
-        }
-        if (attrib->object_owner_soft ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
+                return (0);
         }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (attrib->object_owner_soft));
+        return (attrib->object_owner_soft);
 }
 
 
@@ -2084,8 +1968,8 @@ dxf_attrib_set_object_owner_soft
 (
         DxfAttrib *attrib,
                 /*!< a pointer to a DXF \c ATTRIB entity. */
-        char *object_owner_soft
-                /*!< a string containing the pointer to the
+        uint64_t object_owner_soft
+                /*!< the handle of the
                  * \c object_owner_soft for the entity. */
 )
 {
@@ -2100,14 +1984,7 @@ dxf_attrib_set_object_owner_soft
                   __FUNCTION__);
                 return (NULL);
         }
-        if (object_owner_soft == NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was passed.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
-        attrib->object_owner_soft = strdup (object_owner_soft);
+        attrib->object_owner_soft = object_owner_soft;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2118,12 +1995,10 @@ dxf_attrib_set_object_owner_soft
 /*!
  * \brief Get the pointer to the \c material from a DXF \c ATTRIB entity.
  *
- * \return a pointer to \c material when successful, or \c NULL when an
+ * \return the handle \c material when successful, or 0 when an
  * error occurred.
- *
- * \warning No checks are performed on the returned pointer.
  */
-char *
+uint64_t
 dxf_attrib_get_material
 (
         DxfAttrib *attrib
@@ -2139,19 +2014,12 @@ dxf_attrib_get_material
                 fprintf (stderr,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
-                return (NULL);
-        }
-        if (attrib->material ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
+                return (0);
         }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (attrib->material));
+        return (attrib->material);
 }
 
 
@@ -2166,8 +2034,8 @@ dxf_attrib_set_material
 (
         DxfAttrib *attrib,
                 /*!< a pointer to a DXF \c ATTRIB entity. */
-        char *material
-                /*!< a string containing the pointer to the \c
+        uint64_t material
+                /*!< the handle of the \c
                  * material for the entity. */
 )
 {
@@ -2182,14 +2050,7 @@ dxf_attrib_set_material
                   __FUNCTION__);
                 return (NULL);
         }
-        if (material == NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was passed.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
-        attrib->material = strdup (material);
+        attrib->material = material;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2202,10 +2063,8 @@ dxf_attrib_set_material
  * \c ATTRIB entity.
  *
  * \return hard pointer to the dictionary owner.
- *
- * \warning No checks are performed on the returned pointer (string).
  */
-char *
+uint64_t
 dxf_attrib_get_dictionary_owner_hard
 (
         DxfAttrib *attrib
@@ -2221,19 +2080,12 @@ dxf_attrib_get_dictionary_owner_hard
                 fprintf (stderr,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
-                return (NULL);
-        }
-        if (attrib->dictionary_owner_hard ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
+                return (0);
         }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (attrib->dictionary_owner_hard));
+        return (attrib->dictionary_owner_hard);
 }
 
 
@@ -2246,8 +2098,8 @@ dxf_attrib_set_dictionary_owner_hard
 (
         DxfAttrib *attrib,
                 /*!< a pointer to a DXF \c ATTRIB entity. */
-        char *dictionary_owner_hard
-                /*!< a string containing the pointer to the
+        uint64_t dictionary_owner_hard
+                /*!< the handle of the
                  * dictionary_owner_hard for the entity. */
 )
 {
@@ -2262,14 +2114,7 @@ dxf_attrib_set_dictionary_owner_hard
                   __FUNCTION__);
                 return (NULL);
         }
-        if (dictionary_owner_hard == NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was passed.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
-        attrib->dictionary_owner_hard = strdup (dictionary_owner_hard);
+        attrib->dictionary_owner_hard = dictionary_owner_hard;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2345,10 +2190,10 @@ dxf_attrib_set_lineweight
 /*!
  * \brief Get the \c plot_style_name from a DXF \c ATTRIB entity.
  *
- * \return a pointer to \c plot_style_name when sucessful, or \c NULL
+ * \return the handle \c plot_style_name when sucessful, or 0
  * when an error occurred.
  */
-char *
+uint64_t
 dxf_attrib_get_plot_style_name
 (
         DxfAttrib *attrib
@@ -2364,19 +2209,12 @@ dxf_attrib_get_plot_style_name
                 fprintf (stderr,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
-                return (NULL);
-        }
-        if (attrib->plot_style_name ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
+                return (0);
         }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (attrib->plot_style_name));
+        return (attrib->plot_style_name);
 }
 
 
@@ -2391,7 +2229,7 @@ dxf_attrib_set_plot_style_name
 (
         DxfAttrib *attrib,
                 /*!< a pointer to a DXF \c ATTRIB entity. */
-        char *plot_style_name
+        uint64_t plot_style_name
                 /*!< a string containing the \c plot_style_name for the
                  * entity. */
 )
@@ -2407,14 +2245,7 @@ dxf_attrib_set_plot_style_name
                   __FUNCTION__);
                 return (NULL);
         }
-        if (plot_style_name == NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was passed.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
-        attrib->plot_style_name = strdup (plot_style_name);
+        attrib->plot_style_name = plot_style_name;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2521,7 +2352,7 @@ dxf_attrib_get_color_name
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (attrib->color_name));
+        return (dxf_strdup (attrib->color_name));
 }
 
 
@@ -2559,7 +2390,7 @@ dxf_attrib_set_color_name
                   __FUNCTION__);
                 return (NULL);
         }
-        attrib->color_name = strdup (color_name);
+        attrib->color_name = dxf_strdup (color_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2667,7 +2498,7 @@ dxf_attrib_get_default_value
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (attrib->default_value));
+        return (dxf_strdup (attrib->default_value));
 }
 
 
@@ -2702,7 +2533,7 @@ dxf_attrib_set_default_value
                   __FUNCTION__);
                 return (NULL);
         }
-        attrib->default_value = strdup (default_value);
+        attrib->default_value = dxf_strdup (default_value);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2745,7 +2576,7 @@ dxf_attrib_get_tag_value
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (attrib->tag_value));
+        return (dxf_strdup (attrib->tag_value));
 }
 
 
@@ -2780,7 +2611,7 @@ dxf_attrib_set_tag_value
                   __FUNCTION__);
                 return (NULL);
         }
-        attrib->tag_value = strdup (tag_value);
+        attrib->tag_value = dxf_strdup (tag_value);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2823,7 +2654,7 @@ dxf_attrib_get_text_style
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (attrib->text_style));
+        return (dxf_strdup (attrib->text_style));
 }
 
 
@@ -2858,7 +2689,7 @@ dxf_attrib_set_text_style
                   __FUNCTION__);
                 return (NULL);
         }
-        attrib->text_style = strdup (text_style);
+        attrib->text_style = dxf_strdup (text_style);
 #if DEBUG
         DXF_DEBUG_END
 #endif
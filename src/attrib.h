@@ -60,7 +60,7 @@ typedef struct
 dxf_attrib_struct
 {
         /* Members common for all DXF drawable entities. */
-        int id_code;
+        uint64_t id_code;
                 /*!< Identification number for the entity.\n
                  * This is to be an unique (sequential) number in the DXF
                  * file.\n
@@ -132,20 +132,20 @@ dxf_attrib_struct
                  * (optional).\n
                  * Group code = 310.\n
                  * \since Introduced in version R2000. */
-        char *dictionary_owner_soft;
+        uint64_t dictionary_owner_soft;
                 /*!< Soft-pointer ID/handle to owner dictionary (optional).\n
                  * Group code = 330.\n
                  * \since Introduced in version R14. */
-        char *object_owner_soft;
+        uint64_t object_owner_soft;
                 /*!< Soft-pointer ID/handle  to owner BLOCK_RECORD object.\n
                  * Group code = 330.\n
                  * \since Introduced in version R2000. */
-        char *material;
+        uint64_t material;
                 /*!< Hard-pointer ID/handle to material object (present if
                  * not BYLAYER).\n
                  * Group code = 347.\n
                  * \since Introduced in version R2008. */
-        char *dictionary_owner_hard;
+        uint64_t dictionary_owner_hard;
                 /*!< Hard owner ID/handle to owner dictionary (optional).\n
                  * Group code = 360.\n
                  * \since Introduced in version R14. */
@@ -154,7 +154,7 @@ dxf_attrib_struct
                  * Stored and moved around as a 16-bit integer.\n
                  * Group code = 370.\n
                  * \since Introduced in version R2002. */
-        char *plot_style_name;
+        uint64_t plot_style_name;
                 /*!< Hard pointer ID / handle of PlotStyleName object.\n
                  * Group code = 390.\n
                  * \since Introduced in version R2009. */
@@ -297,8 +297,8 @@ DxfAttrib *dxf_attrib_read (DxfFile *fp, DxfAttrib *attrib);
 int dxf_attrib_write (DxfFile *fp, DxfAttrib *attrib);
 int dxf_attrib_free (DxfAttrib *attrib);
 void dxf_attrib_free_list (DxfAttrib *attribs);
-int dxf_attrib_get_id_code (DxfAttrib *attrib);
-DxfAttrib *dxf_attrib_set_id_code (DxfAttrib *attrib, int id_code);
+uint64_t dxf_attrib_get_id_code (DxfAttrib *attrib);
+DxfAttrib *dxf_attrib_set_id_code (DxfAttrib *attrib, uint64_t id_code);
 char *dxf_attrib_get_linetype (DxfAttrib *attrib);
 DxfAttrib *dxf_attrib_set_linetype (DxfAttrib *attrib, char *linetype);
 char *dxf_attrib_get_layer (DxfAttrib *attrib);
@@ -321,18 +321,18 @@ int16_t dxf_attrib_get_shadow_mode (DxfAttrib *attrib);
 DxfAttrib *dxf_attrib_set_shadow_mode (DxfAttrib *attrib, int16_t shadow_mode);
 DxfBinaryData *dxf_attrib_get_binary_graphics_data (DxfAttrib *attrib);
 DxfAttrib *dxf_attrib_set_binary_graphics_data (DxfAttrib *attrib, DxfBinaryData *data);
-char *dxf_attrib_get_dictionary_owner_soft (DxfAttrib *attrib);
-DxfAttrib *dxf_attrib_set_dictionary_owner_soft (DxfAttrib *attrib, char *dictionary_owner_soft);
-char *dxf_attrib_get_object_owner_soft (DxfAttrib *attrib);
-DxfAttrib *dxf_attrib_set_object_owner_soft (DxfAttrib *attrib, char *object_owner_soft);
-char *dxf_attrib_get_material (DxfAttrib *attrib);
-DxfAttrib *dxf_attrib_set_material (DxfAttrib *attrib, char *material);
-char *dxf_attrib_get_dictionary_owner_hard (DxfAttrib *attrib);
-DxfAttrib *dxf_attrib_set_dictionary_owner_hard (DxfAttrib *attrib, char *dictionary_owner_hard);
+uint64_t dxf_attrib_get_dictionary_owner_soft (DxfAttrib *attrib);
+DxfAttrib *dxf_attrib_set_dictionary_owner_soft (DxfAttrib *attrib, uint64_t dictionary_owner_soft);
+uint64_t dxf_attrib_get_object_owner_soft (DxfAttrib *attrib);
+DxfAttrib *dxf_attrib_set_object_owner_soft (DxfAttrib *attrib, uint64_t object_owner_soft);
+uint64_t dxf_attrib_get_material (DxfAttrib *attrib);
+DxfAttrib *dxf_attrib_set_material (DxfAttrib *attrib, uint64_t material);
+uint64_t dxf_attrib_get_dictionary_owner_hard (DxfAttrib *attrib);
+DxfAttrib *dxf_attrib_set_dictionary_owner_hard (DxfAttrib *attrib, uint64_t dictionary_owner_hard);
 int16_t dxf_attrib_get_lineweight (DxfAttrib *attrib);
 DxfAttrib *dxf_attrib_set_lineweight (DxfAttrib *attrib, int16_t lineweight);
-char *dxf_attrib_get_plot_style_name (DxfAttrib *attrib);
-DxfAttrib *dxf_attrib_set_plot_style_name (DxfAttrib *attrib, char *plot_style_name);
+uint64_t dxf_attrib_get_plot_style_name (DxfAttrib *attrib);
+DxfAttrib *dxf_attrib_set_plot_style_name (DxfAttrib *attrib, uint64_t plot_style_name);
 int32_t dxf_attrib_get_color_value (DxfAttrib *attrib);
 DxfAttrib *dxf_attrib_set_color_value (DxfAttrib *attrib, int32_t color_value);
 char *dxf_attrib_get_color_name (DxfAttrib *attrib);
@@ -0,0 +1,773 @@
+/*!
+ * \file bbox.c
+ *
+ * \author Copyright (C) 2026
+ * by Bert Timmerman <bert.timmerman@xs4all.nl>.
+ *
+ * \brief Functions for libDXF bounding boxes of entities.
+ *
+ * The bounding box of an entity is the smallest axis aligned box in
+ * world coordinates containing the entity, it is used by the spatial
+ * index of a drawing.\n
+ * The per type functions (dxf_line_get_bbox () and such) live with
+ * their entity, dxf_entity_get_bbox () dispatches on the type name.
+ *
+ * <hr>
+ * <h1><b>Copyright Notices.</b></h1>\n
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License,
+ * or (at your option) any later version.\n\n
+ * This program is distributed in the hope that it will be useful, but
+ * <b>WITHOUT ANY WARRANTY</b>; without even the implied warranty of
+ * <b>MERCHANTABILITY</b> or <b>FITNESS FOR A PARTICULAR PURPOSE</b>.\n
+ * See the GNU General Public License for more details.\n\n
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to:\n
+ * Free Software Foundation, Inc.,\n
+ * 59 Temple Place,\n
+ * Suite 330,\n
+ * Boston,\n
+ * MA 02111 USA.\n
+ * \n
+ * Drawing eXchange Format (DXF) is a defacto industry standard for the
+ * exchange of drawing files between various Computer Aided Drafting
+ * programs.\n
+ * DXF is an industry standard designed by Autodesk(TM).\n
+ * For more details see http://www.autodesk.com.
+ * <hr>
+ */
+
+
+
+#include <float.h>
+
+#include "bbox.h"
+#include "3dface.h"
+#include "arc.h"
+#include "circle.h"
+#include "ellipse.h"
+#include "hatch.h"
+#include "insert.h"
+#include "line.h"
+#include "lwpolyline.h"
+#include "mtext.h"
+#include "point.h"
+#include "polyline.h"
+#include "solid.h"
+#include "spline.h"
+#include "text.h"
+#include "trace.h"
+#include "transform.h"
+#include "util.h"
+
+
+/*!
+ * \brief Define the wrappers of an entity type for the dispatch table of
+ * dxf_entity_get_bbox () and dxf_entity_is_paperspace ().
+ */
+#define DXF_BBOX_WRAPPERS(type, Type) \
+static int \
+dxf_bbox_dispatch_##type (void *entity, DxfBbox *bbox) \
+{ \
+        return (dxf_##type##_get_bbox ((Type *) entity, bbox)); \
+} \
+static int \
+dxf_bbox_dispatch_paperspace_##type (void *entity) \
+{ \
+        return (((Type *) entity)->paperspace == DXF_PAPERSPACE); \
+}
+
+
+DXF_BBOX_WRAPPERS (3dface, Dxf3dface)
+DXF_BBOX_WRAPPERS (arc, DxfArc)
+DXF_BBOX_WRAPPERS (circle, DxfCircle)
+DXF_BBOX_WRAPPERS (ellipse, DxfEllipse)
+DXF_BBOX_WRAPPERS (hatch, DxfHatch)
+DXF_BBOX_WRAPPERS (insert, DxfInsert)
+DXF_BBOX_WRAPPERS (line, DxfLine)
+DXF_BBOX_WRAPPERS (lwpolyline, DxfLWPolyline)
+DXF_BBOX_WRAPPERS (mtext, DxfMtext)
+DXF_BBOX_WRAPPERS (point, DxfPoint)
+DXF_BBOX_WRAPPERS (polyline, DxfPolyline)
+DXF_BBOX_WRAPPERS (solid, DxfSolid)
+DXF_BBOX_WRAPPERS (spline, DxfSpline)
+DXF_BBOX_WRAPPERS (text, DxfText)
+DXF_BBOX_WRAPPERS (trace, DxfTrace)
+
+
+/*!
+ * \brief Dispatch table of dxf_entity_get_bbox ().
+ *
+ * Sorted on \c name for bsearch ().
+ */
+static const struct dxf_bbox_getter_struct
+{
+        const char *name;
+                /*!< Entity type name as found after group code 0. */
+        int (*get_bbox) (void *entity, DxfBbox *bbox);
+                /*!< Get the bounding box of an entity. */
+        int (*is_paperspace) (void *entity);
+                /*!< Test if an entity is in paper space. */
+} dxf_bbox_getters[] =
+{
+#define DXF_BBOX_GETTER(name, type) \
+        {name, dxf_bbox_dispatch_##type, dxf_bbox_dispatch_paperspace_##type}
+        DXF_BBOX_GETTER ("3DFACE", 3dface),
+        DXF_BBOX_GETTER ("ARC", arc),
+        DXF_BBOX_GETTER ("CIRCLE", circle),
+        DXF_BBOX_GETTER ("ELLIPSE", ellipse),
+        DXF_BBOX_GETTER ("HATCH", hatch),
+        DXF_BBOX_GETTER ("INSERT", insert),
+        DXF_BBOX_GETTER ("LINE", line),
+        DXF_BBOX_GETTER ("LWPOLYLINE", lwpolyline),
+        DXF_BBOX_GETTER ("MTEXT", mtext),
+        DXF_BBOX_GETTER ("POINT", point),
+        DXF_BBOX_GETTER ("POLYLINE", polyline),
+        DXF_BBOX_GETTER ("SOLID", solid),
+        DXF_BBOX_GETTER ("SPLINE", spline),
+        DXF_BBOX_GETTER ("TEXT", text),
+        DXF_BBOX_GETTER ("TRACE", trace)
+#undef DXF_BBOX_GETTER
+};
+
+
+/*!
+ * \brief Compare a name with an entry of the dispatch table, for
+ * bsearch ().
+ */
+static int
+dxf_bbox_getter_compare
+(
+        const void *name,
+        const void *getter
+)
+{
+        return (strcmp ((const char *) name,
+          ((const struct dxf_bbox_getter_struct *) getter)->name));
+}
+
+
+/*!
+ * \brief Initialize a libDXF bounding box to the empty box.
+ *
+ * \return a pointer to \c bbox, or \c NULL when a \c NULL pointer
+ * was passed.
+ */
+DxfBbox *
+dxf_bbox_init
+(
+        DxfBbox *bbox
+                /*!< a pointer to a libDXF bounding box. */
+)
+{
+        /* Do some basic checks. */
+        if (bbox == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        bbox->min.x = DBL_MAX;
+        bbox->min.y = DBL_MAX;
+        bbox->min.z = DBL_MAX;
+        bbox->max.x = -DBL_MAX;
+        bbox->max.y = -DBL_MAX;
+        bbox->max.z = -DBL_MAX;
+        return (bbox);
+}
+
+
+/*!
+ * \brief Test if a libDXF bounding box is empty (contains no point).
+ *
+ * \return \c TRUE when \c bbox is empty or \c NULL, \c FALSE
+ * otherwise.
+ */
+int
+dxf_bbox_is_empty
+(
+        DxfBbox *bbox
+                /*!< a pointer to a libDXF bounding box. */
+)
+{
+        if (bbox == NULL)
+        {
+                return (TRUE);
+        }
+        return ((bbox->min.x > bbox->max.x)
+          || (bbox->min.y > bbox->max.y)
+          || (bbox->min.z > bbox->max.z));
+}
+
+
+/*!
+ * \brief Extend a libDXF bounding box with a point.
+ *
+ * \return a pointer to \c bbox, or \c NULL when a \c NULL pointer
+ * was passed.
+ */
+DxfBbox *
+dxf_bbox_add_point
+(
+        DxfBbox *bbox,
+                /*!< a pointer to a libDXF bounding box. */
+        double x,
+                /*!< X-value of the point. */
+        double y,
+                /*!< Y-value of the point. */
+        double z
+                /*!< Z-value of the point. */
+)
+{
+        /* Do some basic checks. */
+        if (bbox == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        if (x < bbox->min.x) bbox->min.x = x;
+        if (x > bbox->max.x) bbox->max.x = x;
+        if (y < bbox->min.y) bbox->min.y = y;
+        if (y > bbox->max.y) bbox->max.y = y;
+        if (z < bbox->min.z) bbox->min.z = z;
+        if (z > bbox->max.z) bbox->max.z = z;
+        return (bbox);
+}
+
+
+/*!
+ * \brief Extend a libDXF bounding box with another bounding box.
+ *
+ * An empty \c other leaves \c bbox as it is.
+ *
+ * \return a pointer to \c bbox, or \c NULL when a \c NULL pointer
+ * was passed.
+ */
+DxfBbox *
+dxf_bbox_add_bbox
+(
+        DxfBbox *bbox,
+                /*!< a pointer to a libDXF bounding box. */
+        DxfBbox *other
+                /*!< a pointer to the libDXF bounding box to add. */
+)
+{
+        /* Do some basic checks. */
+        if ((bbox == NULL) || (other == NULL))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        if (dxf_bbox_is_empty (other))
+        {
+                return (bbox);
+        }
+        dxf_bbox_add_point (bbox, other->min.x, other->min.y, other->min.z);
+        dxf_bbox_add_point (bbox, other->max.x, other->max.y, other->max.z);
+        return (bbox);
+}
+
+
+/*!
+ * \brief Extend a libDXF bounding box with a circular arc in a plane
+ * parallel to the XY plane.
+ *
+ * The arc runs counterclockwise from \c start_angle to \c end_angle,
+ * a full circle when they are equal.\n
+ * The end points are added, and the points at 0, 90, 180 and 270
+ * degrees the arc passes.
+ *
+ * \return a pointer to \c bbox, or \c NULL when a \c NULL pointer
+ * was passed.
+ */
+DxfBbox *
+dxf_bbox_add_arc
+(
+        DxfBbox *bbox,
+                /*!< a pointer to a libDXF bounding box. */
+        double x,
+                /*!< X-value of the center point. */
+        double y,
+                /*!< Y-value of the center point. */
+        double z,
+                /*!< Z-value of the center point. */
+        double radius,
+                /*!< Radius of the arc. */
+        double start_angle,
+                /*!< Start angle in degrees. */
+        double end_angle
+                /*!< End angle in degrees. */
+)
+{
+        double start;
+        double sweep;
+        double angle;
+        double delta;
+        int quadrant;
+
+        /* Do some basic checks. */
+        if (bbox == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        radius = fabs (radius);
+        start = fmod (start_angle, 360.0);
+        if (start < 0.0)
+        {
+                start += 360.0;
+        }
+        sweep = fmod (end_angle - start_angle, 360.0);
+        if (sweep <= 0.0)
+        {
+                sweep += 360.0;
+        }
+        angle = start * M_PI / 180.0;
+        dxf_bbox_add_point (bbox, x + radius * cos (angle), y + radius * sin (angle), z);
+        angle = (start + sweep) * M_PI / 180.0;
+        dxf_bbox_add_point (bbox, x + radius * cos (angle), y + radius * sin (angle), z);
+        for (quadrant = 0; quadrant < 4; quadrant++)
+        {
+                delta = (90.0 * quadrant) - start;
+                if (delta < 0.0)
+                {
+                        delta += 360.0;
+                }
+                if (delta > sweep)
+                {
+                        continue;
+                }
+                switch (quadrant)
+                {
+                        case 0:
+                                dxf_bbox_add_point (bbox, x + radius, y, z);
+                                break;
+                        case 1:
+                                dxf_bbox_add_point (bbox, x, y + radius, z);
+                                break;
+                        case 2:
+                                dxf_bbox_add_point (bbox, x - radius, y, z);
+                                break;
+                        default:
+                                dxf_bbox_add_point (bbox, x, y - radius, z);
+                                break;
+                }
+        }
+        return (bbox);
+}
+
+
+/*!
+ * \brief Extend a libDXF bounding box with a polyline segment in a
+ * plane parallel to the XY plane.
+ *
+ * A \c bulge of 0.0 is a straight segment, otherwise it is the tangent
+ * of a quarter of the included angle of an arc segment, negative when
+ * the arc runs clockwise from the start point to the end point.
+ *
+ * \return a pointer to \c bbox, or \c NULL when a \c NULL pointer
+ * was passed.
+ */
+DxfBbox *
+dxf_bbox_add_bulge
+(
+        DxfBbox *bbox,
+                /*!< a pointer to a libDXF bounding box. */
+        double x0,
+                /*!< X-value of the start point. */
+        double y0,
+                /*!< Y-value of the start point. */
+        double x1,
+                /*!< X-value of the end point. */
+        double y1,
+                /*!< Y-value of the end point. */
+        double z,
+                /*!< Z-value of the segment. */
+        double bulge
+                /*!< Bulge of the segment. */
+)
+{
+        double factor;
+        double radius;
+        double x;
+        double y;
+        double start_angle;
+        double end_angle;
+
+        if (dxf_bbox_add_point (bbox, x0, y0, z) == NULL)
+        {
+                return (NULL);
+        }
+        dxf_bbox_add_point (bbox, x1, y1, z);
+        if ((bulge == 0.0) || ((x0 == x1) && (y0 == y1)))
+        {
+                return (bbox);
+        }
+        /* The center lies on the perpendicular bisector of the chord,
+         * left of it for a counterclockwise arc less than half a
+         * circle. */
+        factor = (1.0 - (bulge * bulge)) / (4.0 * bulge);
+        x = ((x0 + x1) / 2.0) - (factor * (y1 - y0));
+        y = ((y0 + y1) / 2.0) + (factor * (x1 - x0));
+        radius = hypot (x0 - x, y0 - y);
+        start_angle = atan2 (y0 - y, x0 - x) * 180.0 / M_PI;
+        end_angle = atan2 (y1 - y, x1 - x) * 180.0 / M_PI;
+        if (bulge > 0.0)
+        {
+                return (dxf_bbox_add_arc (bbox, x, y, z, radius, start_angle, end_angle));
+        }
+        return (dxf_bbox_add_arc (bbox, x, y, z, radius, end_angle, start_angle));
+}
+
+
+/*!
+ * \brief Extend a libDXF bounding box with an elliptical arc.
+ *
+ * The points of the arc are \c center + cos (t) \c major + sin (t)
+ * \c minor for a parameter t running from \c start_parameter to
+ * \c end_parameter, a full ellipse when they are equal.\n
+ * Along every axis the extremes are at the parameters t where the
+ * derivative is 0, tan (t) = \c minor / \c major; those the arc
+ * passes are added together with the end points.
+ *
+ * \return a pointer to \c bbox, or \c NULL when a \c NULL pointer
+ * was passed.
+ */
+DxfBbox *
+dxf_bbox_add_ellipse
+(
+        DxfBbox *bbox,
+                /*!< a pointer to a libDXF bounding box. */
+        DxfVec3 *center,
+                /*!< Center point. */
+        DxfVec3 *major,
+                /*!< Major axis, relative to the center. */
+        DxfVec3 *minor,
+                /*!< Minor axis, relative to the center. */
+        double start_parameter,
+                /*!< Start parameter in radians. */
+        double end_parameter
+                /*!< End parameter in radians. */
+)
+{
+        double a[3];
+        double b[3];
+        double sweep;
+        double delta;
+        double t;
+        int axis;
+        int i;
+
+        /* Do some basic checks. */
+        if ((bbox == NULL) || (center == NULL) || (major == NULL) || (minor == NULL))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        a[0] = major->x;
+        a[1] = major->y;
+        a[2] = major->z;
+        b[0] = minor->x;
+        b[1] = minor->y;
+        b[2] = minor->z;
+        sweep = fmod (end_parameter - start_parameter, 2.0 * M_PI);
+        if (sweep <= 0.0)
+        {
+                sweep += 2.0 * M_PI;
+        }
+        for (i = 0; i < 2; i++)
+        {
+                t = start_parameter + (i * sweep);
+                dxf_bbox_add_point (bbox,
+                  center->x + (a[0] * cos (t)) + (b[0] * sin (t)),
+                  center->y + (a[1] * cos (t)) + (b[1] * sin (t)),
+                  center->z + (a[2] * cos (t)) + (b[2] * sin (t)));
+        }
+        for (axis = 0; axis < 3; axis++)
+        {
+                if ((a[axis] == 0.0) && (b[axis] == 0.0))
+                {
+                        continue;
+                }
+                for (i = 0; i < 2; i++)
+                {
+                        t = atan2 (b[axis], a[axis]) + (i * M_PI);
+                        delta = fmod (t - start_parameter, 2.0 * M_PI);
+                        if (delta < 0.0)
+                        {
+                                delta += 2.0 * M_PI;
+                        }
+                        if (delta > sweep)
+                        {
+                                continue;
+                        }
+                        dxf_bbox_add_point (bbox,
+                          center->x + (a[0] * cos (t)) + (b[0] * sin (t)),
+                          center->y + (a[1] * cos (t)) + (b[1] * sin (t)),
+                          center->z + (a[2] * cos (t)) + (b[2] * sin (t)));
+                }
+        }
+        return (bbox);
+}
+
+
+/*!
+ * \brief Test if an extrusion direction is the world Z-axis, in which
+ * case the Object Coordinate System (OCS) is the world coordinate
+ * system.
+ *
+ * A zero extrusion direction is taken as the world Z-axis.
+ */
+static int
+dxf_bbox_is_world_extrusion
+(
+        DxfVec3 *extrusion
+                /*!< a pointer to the extrusion direction. */
+)
+{
+        return ((extrusion->x == 0.0)
+          && (extrusion->y == 0.0)
+          && (extrusion->z >= 0.0));
+}
+
+
+/*!
+ * \brief Map a libDXF bounding box with a libDXF affine
+ * transformation.
+ *
+ * \c bbox is replaced by the box of it's eight mapped corners, which
+ * holds everything in \c bbox, and is the tightest box when
+ * \c transform only swaps, mirrors and scales the axes.\n
+ * An empty \c bbox stays empty.
+ *
+ * \return a pointer to \c bbox, or \c NULL when a \c NULL pointer
+ * was passed.
+ */
+DxfBbox *
+dxf_bbox_transform
+(
+        DxfBbox *bbox,
+                /*!< a pointer to a libDXF bounding box. */
+        DxfTransform *transform
+                /*!< a pointer to a libDXF affine transformation. */
+)
+{
+        DxfVec3 corner;
+        DxfBbox result;
+        int i;
+
+        /* Do some basic checks. */
+        if ((bbox == NULL) || (transform == NULL))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        if (dxf_bbox_is_empty (bbox))
+        {
+                return (bbox);
+        }
+        dxf_bbox_init (&result);
+        for (i = 0; i < 8; i++)
+        {
+                corner.x = (i & 1) ? bbox->max.x : bbox->min.x;
+                corner.y = (i & 2) ? bbox->max.y : bbox->min.y;
+                corner.z = (i & 4) ? bbox->max.z : bbox->min.z;
+                dxf_transform_apply_point (transform, &corner, &corner);
+                dxf_bbox_add_point (&result, corner.x, corner.y, corner.z);
+        }
+        *bbox = result;
+        return (bbox);
+}
+
+
+/*!
+ * \brief Map a libDXF bounding box in the Object Coordinate System
+ * (OCS) of an extrusion direction to world coordinates.
+ *
+ * See dxf_bbox_transform (), \c bbox is left as it is when the
+ * extrusion direction is the world Z-axis.
+ *
+ * \return a pointer to \c bbox, or \c NULL when a \c NULL pointer
+ * was passed.
+ */
+DxfBbox *
+dxf_bbox_ocs_to_wcs
+(
+        DxfBbox *bbox,
+                /*!< a pointer to a libDXF bounding box. */
+        DxfVec3 *extrusion
+                /*!< a pointer to the extrusion direction. */
+)
+{
+        DxfTransform ocs;
+
+        /* Do some basic checks. */
+        if ((bbox == NULL) || (extrusion == NULL))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        if (dxf_bbox_is_world_extrusion (extrusion))
+        {
+                return (bbox);
+        }
+        dxf_transform_set_ocs (&ocs, extrusion);
+        return (dxf_bbox_transform (bbox, &ocs));
+}
+
+
+/*!
+ * \brief Extend a libDXF bounding box with a circular arc in the plane
+ * of an Object Coordinate System (OCS).
+ *
+ * The center point, the angles and the counterclockwise direction of
+ * the arc are in the OCS of \c extrusion, see dxf_bbox_add_arc ().\n
+ * The arc is mapped to world coordinates as an elliptical arc with two
+ * perpendicular axes of length \c radius (see
+ * dxf_bbox_add_ellipse ()), so the box is the tightest box for any
+ * extrusion direction.
+ *
+ * \return a pointer to \c bbox, or \c NULL when a \c NULL pointer
+ * was passed.
+ */
+DxfBbox *
+dxf_bbox_add_ocs_arc
+(
+        DxfBbox *bbox,
+                /*!< a pointer to a libDXF bounding box. */
+        DxfVec3 *extrusion,
+                /*!< a pointer to the extrusion direction. */
+        DxfVec3 *center,
+                /*!< Center point, in the OCS. */
+        double radius,
+                /*!< Radius of the arc. */
+        double start_angle,
+                /*!< Start angle in degrees. */
+        double end_angle
+                /*!< End angle in degrees. */
+)
+{
+        DxfTransform ocs;
+        DxfVec3 point;
+        DxfVec3 major;
+        DxfVec3 minor;
+
+        /* Do some basic checks. */
+        if ((bbox == NULL) || (extrusion == NULL) || (center == NULL))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        if (dxf_bbox_is_world_extrusion (extrusion))
+        {
+                return (dxf_bbox_add_arc (bbox, center->x, center->y,
+                  center->z, radius, start_angle, end_angle));
+        }
+        radius = fabs (radius);
+        dxf_transform_set_ocs (&ocs, extrusion);
+        dxf_transform_apply_point (&ocs, center, &point);
+        major.x = radius * ocs.m[0][0];
+        major.y = radius * ocs.m[1][0];
+        major.z = radius * ocs.m[2][0];
+        minor.x = radius * ocs.m[0][1];
+        minor.y = radius * ocs.m[1][1];
+        minor.z = radius * ocs.m[2][1];
+        return (dxf_bbox_add_ellipse (bbox, &point, &major, &minor,
+          start_angle * M_PI / 180.0, end_angle * M_PI / 180.0));
+}
+
+
+/*!
+ * \brief Get the bounding box of a DXF entity by it's type name.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred or when the bounding box of \c type entities is not
+ * supported (yet), in which case \c bbox is left empty.
+ */
+int
+dxf_entity_get_bbox
+(
+        const char *type,
+                /*!< Entity type name, for example "LINE". */
+        void *entity,
+                /*!< a pointer to the entity. */
+        DxfBbox *bbox
+                /*!< a pointer to the libDXF bounding box to fill. */
+)
+{
+        const struct dxf_bbox_getter_struct *getter;
+
+        /* Do some basic checks. */
+        if ((type == NULL) || (entity == NULL) || (bbox == NULL))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        dxf_bbox_init (bbox);
+        getter = bsearch (type, dxf_bbox_getters,
+          sizeof (dxf_bbox_getters) / sizeof (dxf_bbox_getters[0]),
+          sizeof (dxf_bbox_getters[0]), dxf_bbox_getter_compare);
+        if (getter == NULL)
+        {
+                return (EXIT_FAILURE);
+        }
+        return (getter->get_bbox (entity, bbox));
+}
+
+
+/*!
+ * \brief Test if a DXF entity with a bounding box is in paper space.
+ *
+ * \return \c TRUE when \c entity is in paper space, \c FALSE when it
+ * is in model space or the bounding box of \c type entities is not
+ * supported.
+ */
+int
+dxf_entity_is_paperspace
+(
+        const char *type,
+                /*!< Entity type name, for example "LINE". */
+        void *entity
+                /*!< a pointer to the entity. */
+)
+{
+        const struct dxf_bbox_getter_struct *getter;
+
+        /* Do some basic checks. */
+        if ((type == NULL) || (entity == NULL))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (FALSE);
+        }
+        getter = bsearch (type, dxf_bbox_getters,
+          sizeof (dxf_bbox_getters) / sizeof (dxf_bbox_getters[0]),
+          sizeof (dxf_bbox_getters[0]), dxf_bbox_getter_compare);
+        if (getter == NULL)
+        {
+                return (FALSE);
+        }
+        return (getter->is_paperspace (entity));
+}
+
+
+/* EOF */
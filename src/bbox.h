@@ -0,0 +1,72 @@
+/*!
+ * \file bbox.h
+ *
+ * \author Copyright (C) 2026
+ * by Bert Timmerman <bert.timmerman@xs4all.nl>.
+ *
+ * \brief Prototypes for libDXF bounding boxes of entities.
+ *
+ * <hr>
+ * <h1><b>Copyright Notices.</b></h1>\n
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License,
+ * or (at your option) any later version.\n\n
+ * This program is distributed in the hope that it will be useful, but
+ * <b>WITHOUT ANY WARRANTY</b>; without even the implied warranty of
+ * <b>MERCHANTABILITY</b> or <b>FITNESS FOR A PARTICULAR PURPOSE</b>.\n
+ * See the GNU General Public License for more details.\n\n
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to:\n
+ * Free Software Foundation, Inc.,\n
+ * 59 Temple Place,\n
+ * Suite 330,\n
+ * Boston,\n
+ * MA 02111 USA.\n
+ * \n
+ * Drawing eXchange Format (DXF) is a defacto industry standard for the
+ * exchange of drawing files between various Computer Aided Drafting
+ * programs.\n
+ * DXF is an industry standard designed by Autodesk(TM).\n
+ * For more details see http://www.autodesk.com.
+ * <hr>
+ */
+
+
+
+#ifndef LIBDXF_SRC_BBOX_H
+#define LIBDXF_SRC_BBOX_H
+
+
+#include "global.h"
+#include "transform.h"
+
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+DxfBbox *dxf_bbox_init (DxfBbox *bbox);
+int dxf_bbox_is_empty (DxfBbox *bbox);
+DxfBbox *dxf_bbox_add_point (DxfBbox *bbox, double x, double y, double z);
+DxfBbox *dxf_bbox_add_bbox (DxfBbox *bbox, DxfBbox *other);
+DxfBbox *dxf_bbox_add_arc (DxfBbox *bbox, double x, double y, double z, double radius, double start_angle, double end_angle);
+DxfBbox *dxf_bbox_add_bulge (DxfBbox *bbox, double x0, double y0, double x1, double y1, double z, double bulge);
+DxfBbox *dxf_bbox_add_ellipse (DxfBbox *bbox, DxfVec3 *center, DxfVec3 *major, DxfVec3 *minor, double start_parameter, double end_parameter);
+DxfBbox *dxf_bbox_transform (DxfBbox *bbox, DxfTransform *transform);
+DxfBbox *dxf_bbox_ocs_to_wcs (DxfBbox *bbox, DxfVec3 *extrusion);
+DxfBbox *dxf_bbox_add_ocs_arc (DxfBbox *bbox, DxfVec3 *extrusion, DxfVec3 *center, double radius, double start_angle, double end_angle);
+int dxf_entity_get_bbox (const char *type, void *entity, DxfBbox *bbox);
+int dxf_entity_is_paperspace (const char *type, void *entity);
+
+
+#ifdef __cplusplus
+}
+#endif
+
+
+#endif /* LIBDXF_SRC_BBOX_H */
+
+
+/* EOF */
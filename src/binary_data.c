@@ -34,6 +34,7 @@
 
 
 #include "binary_data.h"
+#include "util.h"
 
 
 /*!
@@ -53,7 +54,7 @@ dxf_binary_data_new ()
         size = sizeof (DxfBinaryData);
         /* avoid malloc of 0 bytes */
         if (size == 0) size = 1;
-        if ((data = malloc (size)) == NULL)
+        if ((data = dxf_malloc (size)) == NULL)
         {
                 fprintf (stderr,
                   (_("Error in %s () could not allocate memory.\n")),
@@ -104,7 +105,7 @@ dxf_binary_data_init
                 return (NULL);
         }
         data->order = 0;
-        data->data_line = strdup ("");
+        data->data_line = dxf_strdup ("");
         data->length = 0;
         data->next = NULL;
 #if DEBUG
@@ -114,6 +115,273 @@ dxf_binary_data_init
 }
 
 
+/*!
+ * \brief Take the next line from the \c source of a binary data
+ * object.
+ *
+ * \return \c TRUE when a line was found, \c FALSE past the last line.
+ */
+static int
+dxf_binary_data_next_line
+(
+        DxfBinaryData *data,
+                /*!< a pointer to the binary data object. */
+        size_t *pos,
+                /*!< Offset in \c source of the next line, updated. */
+        const char **line,
+                /*!< Returns a pointer to the first char of the line. */
+        size_t *length
+                /*!< Returns the length of the line. */
+)
+{
+        const char *newline;
+
+        if (*pos > data->source_length)
+        {
+                return (FALSE);
+        }
+        *line = data->source + *pos;
+        newline = memchr (*line, '\n', data->source_length - *pos);
+        *length = (newline == NULL) ? data->source_length - *pos : (size_t) (newline - *line);
+        *pos += *length + 1;
+        if ((*length > 0) && ((*line)[*length - 1] == '\r'))
+        {
+                (*length)--;
+        }
+        return (TRUE);
+}
+
+
+/*!
+ * \brief Decode hexadecimal text into bytes.
+ *
+ * Chars which are not hexadecimal digits are skipped, a digit left
+ * over at the end is kept in \c high for the next call.
+ */
+static void
+dxf_binary_data_decode
+(
+        const char *s,
+                /*!< Hexadecimal text. */
+        size_t length,
+                /*!< Length of \c s. */
+        uint8_t *bytes,
+                /*!< Buffer receiving the bytes. */
+        size_t *number_bytes,
+                /*!< Number of bytes in \c bytes, updated. */
+        int *high
+                /*!< Pending high digit, or -1. */
+)
+{
+        size_t i = 0;
+        size_t count;
+        int digit;
+
+        if (*high < 0)
+        {
+                count = dxf_reader_decode_hex (s, length, bytes + *number_bytes);
+                *number_bytes += count;
+                i = 2 * count;
+        }
+        for (; i < length; i++)
+        {
+                if ((s[i] >= '0') && (s[i] <= '9'))
+                        digit = s[i] - '0';
+                else if ((s[i] >= 'A') && (s[i] <= 'F'))
+                        digit = s[i] - 'A' + 10;
+                else if ((s[i] >= 'a') && (s[i] <= 'f'))
+                        digit = s[i] - 'a' + 10;
+                else
+                        continue;
+                if (*high < 0)
+                {
+                        *high = digit;
+                }
+                else
+                {
+                        bytes[(*number_bytes)++] = (uint8_t) ((*high << 4) | digit);
+                        *high = -1;
+                }
+        }
+}
+
+
+/*!
+ * \brief Release the undecoded \c source of a binary data object.
+ */
+static void
+dxf_binary_data_free_source
+(
+        DxfBinaryData *data
+                /*!< a pointer to the binary data object. */
+)
+{
+        if (data->mapping != NULL)
+        {
+                dxf_mapping_release (data->mapping);
+        }
+        else
+        {
+                dxf_free ((char *) data->source);
+        }
+        data->source = NULL;
+        data->source_length = 0;
+        data->mapping = NULL;
+        dxf_free (data->bytes);
+        data->bytes = NULL;
+        data->number_bytes = 0;
+}
+
+
+/*!
+ * \brief Read a run of group code 310 lines from a DXF file into a
+ * binary data object, without decoding them.
+ *
+ * The last line read from file contained group code 310.\n
+ * The value and all directly following group code 310 pairs are kept
+ * as found in the file: when \c fp is a memory mapped ASCII file (see
+ * dxf_read_init_mapped ()) the object refers to the lines in the map,
+ * which stays mapped until the object is freed, otherwise the lines
+ * are copied into one buffer.\n
+ * Without a current arena (see dxf_arena_set_current ()) only, with an
+ * arena the lines are always copied into the arena.\n
+ * The hexadecimal text is decoded on demand, with
+ * dxf_binary_data_get_bytes () or dxf_binary_data_get_data_line ().\n
+ * When \c data is the empty object made by dxf_binary_data_init () the
+ * run is read into it, otherwise a new object is appended to the list
+ * starting at \c data.
+ *
+ * \return a pointer to the object holding the run, or \c data when an
+ * error occurred.
+ */
+DxfBinaryData *
+dxf_binary_data_read
+(
+        DxfFile *fp,
+                /*!< DXF file pointer to an input file (or device). */
+        DxfBinaryData *data
+                /*!< a pointer to a list of binary data objects, or
+                 * \c NULL. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfBinaryData *run;
+        DxfBinaryData *new_data;
+        const char *value;
+        const char *first = NULL;
+        char *copy = NULL;
+        char *new_copy;
+        size_t length;
+        size_t copy_length = 0;
+        size_t copy_size = 0;
+        size_t number_digits = 0;
+        int group_code;
+        int reference;
+
+        /* Do some basic checks. */
+        if ((fp == NULL) || (fp->reader == NULL))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL file pointer was passed.\n")),
+                  __FUNCTION__);
+                return (data);
+        }
+        run = data;
+        while ((run != NULL) && (run->next != NULL))
+        {
+                run = (DxfBinaryData *) run->next;
+        }
+        if ((run == NULL)
+          || (run->source != NULL)
+          || ((run->data_line != NULL) && (run->data_line[0] != '\0')))
+        {
+                new_data = dxf_binary_data_init (dxf_binary_data_new ());
+                if (new_data == NULL)
+                {
+                        return (data);
+                }
+                if (run != NULL)
+                {
+                        run->next = (struct DxfBinaryData *) new_data;
+                }
+                run = new_data;
+        }
+        reference = ((fp->reader->mapping != NULL)
+          && (!fp->reader->binary)
+          && (dxf_arena_get_current () == NULL));
+        for (;;)
+        {
+                if (dxf_read_string_view (fp, &value, &length) == EXIT_FAILURE)
+                {
+                        break;
+                }
+                if (reference)
+                {
+                        if (first == NULL)
+                        {
+                                first = value;
+                        }
+                        run->source_length = value + length - first;
+                }
+                else
+                {
+                        if (copy_length + length + 5 > copy_size)
+                        {
+                                new_copy = dxf_realloc (copy, copy_size,
+                                  2 * (copy_length + length + 5));
+                                if (new_copy == NULL)
+                                {
+                                        fprintf (stderr,
+                                          (_("Error in %s () could not allocate memory.\n")),
+                                          __FUNCTION__);
+                                        dxf_free (copy);
+                                        return (data);
+                                }
+                                copy = new_copy;
+                                copy_size = 2 * (copy_length + length + 5);
+                        }
+                        if (copy_length > 0)
+                        {
+                                /* Keep the layout of the file, values
+                                 * alternating with group codes. */
+                                memcpy (copy + copy_length, "\n310\n", 5);
+                                copy_length += 5;
+                        }
+                        memcpy (copy + copy_length, value, length);
+                        copy_length += length;
+                }
+                number_digits += length;
+                if (dxf_read_group_code (fp, &group_code) == EXIT_FAILURE)
+                {
+                        break;
+                }
+                if (group_code != 310)
+                {
+                        /* Leave the pair to the caller. */
+                        dxf_reader_push_back (fp);
+                        break;
+                }
+        }
+        if (first != NULL)
+        {
+                run->source = first;
+                run->mapping = dxf_mapping_retain (fp->reader->mapping);
+        }
+        else if (copy != NULL)
+        {
+                run->source = copy;
+                run->source_length = copy_length;
+        }
+        run->length = (int) number_digits;
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (run);
+}
+
+
 /*!
  * \brief Write DXF output to fp for a binary data object.
  *
@@ -132,8 +400,13 @@ dxf_binary_data_write
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
+        const char *line;
+        size_t length;
+        size_t pos = 0;
+        int i = 0;
+
         /* Do some basic checks. */
-        if (fp == NULL)
+        if ((fp == NULL) || (data == NULL))
         {
                 fprintf (stderr,
                   (_("Error in %s () a NULL pointer was passed.\n")),
@@ -141,7 +414,22 @@ dxf_binary_data_write
                 return (EXIT_FAILURE);
         }
         /* Start writing output. */
-        fprintf (fp->fp, "310\n%s\n", data->data_line);
+        if (data->source != NULL)
+        {
+                /* Write the value lines as read, skipping the group
+                 * code lines. */
+                while (dxf_binary_data_next_line (data, &pos, &line, &length))
+                {
+                        if ((i++ % 2) == 0)
+                        {
+                                dxf_write_slice (fp, 310, line, length);
+                        }
+                }
+        }
+        else
+        {
+                dxf_write_string (fp, 310, data->data_line);
+        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -182,8 +470,9 @@ dxf_binary_data_free
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        free (data->data_line);
-        free (data);
+        dxf_free (data->data_line);
+        dxf_binary_data_free_source (data);
+        dxf_free (data);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -304,6 +593,9 @@ dxf_binary_data_set_order
 /*!
  * \brief Get the data_line from a binary data object.
  *
+ * For an object read by dxf_binary_data_read () the hexadecimal lines
+ * of the run are joined into \c data_line on the first call.
+ *
  * \return \c data_line when sucessful, \c NULL when an error occurred.
  */
 char *
@@ -316,6 +608,12 @@ dxf_binary_data_get_data_line
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
+        const char *line;
+        size_t length;
+        size_t pos;
+        size_t n;
+        int i;
+
         /* Do some basic checks. */
         if (data == NULL)
         {
@@ -324,6 +622,33 @@ dxf_binary_data_get_data_line
                   __FUNCTION__);
                 return (NULL);
         }
+        if ((data->source != NULL)
+          && ((data->data_line == NULL) || (data->data_line[0] == '\0')))
+        {
+                /* Join the value lines read lazily. */
+                dxf_free (data->data_line);
+                data->data_line = dxf_malloc (data->source_length + 1);
+                if (data->data_line == NULL)
+                {
+                        fprintf (stderr,
+                          (_("Error in %s () could not allocate memory.\n")),
+                          __FUNCTION__);
+                        return (NULL);
+                }
+                data->data_line[0] = '\0';
+                pos = 0;
+                i = 0;
+                n = 0;
+                while (dxf_binary_data_next_line (data, &pos, &line, &length))
+                {
+                        if ((i++ % 2) == 0)
+                        {
+                                memcpy (data->data_line + n, line, length);
+                                n += length;
+                        }
+                }
+                data->data_line[n] = '\0';
+        }
         if (data->data_line ==  NULL)
         {
                 fprintf (stderr,
@@ -334,7 +659,7 @@ dxf_binary_data_get_data_line
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (data->data_line));
+        return (dxf_strdup (data->data_line));
 }
 
 
@@ -369,7 +694,8 @@ dxf_binary_data_set_data_line
                   __FUNCTION__);
                 return (NULL);
         }
-        data->data_line = strdup (data_line);
+        dxf_binary_data_free_source (data);
+        data->data_line = dxf_strdup (data_line);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -453,6 +779,92 @@ dxf_binary_data_set_length
 }
 
 
+/*!
+ * \brief Get the bytes of a list of binary data objects, decoded from
+ * their hexadecimal group code 310 lines.
+ *
+ * The bytes of \c data and all following objects are decoded into one
+ * contiguous buffer on the first call, the buffer is owned by \c data
+ * and returned again by later calls.
+ *
+ * \return a pointer to the bytes, or \c NULL when an error occurred.
+ */
+uint8_t *
+dxf_binary_data_get_bytes
+(
+        DxfBinaryData *data,
+                /*!< a pointer to the first binary data object. */
+        size_t *number_bytes
+                /*!< Returns the number of bytes. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfBinaryData *iter;
+        const char *line;
+        size_t length;
+        size_t pos;
+        size_t size = 0;
+        int high = -1;
+        int i;
+
+        /* Do some basic checks. */
+        if ((data == NULL) || (number_bytes == NULL))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        if (data->bytes == NULL)
+        {
+                for (iter = data; iter != NULL; iter = (DxfBinaryData *) iter->next)
+                {
+                        size += (iter->source != NULL) ? iter->source_length
+                          : ((iter->data_line != NULL) ? strlen (iter->data_line) : 0);
+                }
+                data->bytes = dxf_malloc (size / 2 + 1);
+                if (data->bytes == NULL)
+                {
+                        fprintf (stderr,
+                          (_("Error in %s () could not allocate memory.\n")),
+                          __FUNCTION__);
+                        return (NULL);
+                }
+                data->number_bytes = 0;
+                for (iter = data; iter != NULL; iter = (DxfBinaryData *) iter->next)
+                {
+                        if (iter->source == NULL)
+                        {
+                                if (iter->data_line != NULL)
+                                {
+                                        dxf_binary_data_decode (iter->data_line,
+                                          strlen (iter->data_line), data->bytes,
+                                          &data->number_bytes, &high);
+                                }
+                                continue;
+                        }
+                        pos = 0;
+                        i = 0;
+                        while (dxf_binary_data_next_line (iter, &pos, &line, &length))
+                        {
+                                if ((i++ % 2) == 0)
+                                {
+                                        dxf_binary_data_decode (line, length,
+                                          data->bytes, &data->number_bytes, &high);
+                                }
+                        }
+                }
+        }
+        *number_bytes = data->number_bytes;
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (data->bytes);
+}
+
+
 /*!
  * \brief Get the pointer to the next binary data object from a
  * binary data object.
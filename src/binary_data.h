@@ -47,6 +47,11 @@ extern "C" {
 
 /*!
  * \brief DXF definition of an AutoCAD binary data object.
+ *
+ * An object read by dxf_binary_data_read () holds a whole run of
+ * group code 310 lines in \c source, as found in the file, and is only
+ * decoded when asked for with dxf_binary_data_get_bytes () or
+ * dxf_binary_data_get_data_line ().
  */
 typedef struct
 dxf_binary_data_struct
@@ -64,11 +69,28 @@ dxf_binary_data_struct
         struct DxfBinaryData *next;
                 /*!< Pointer to the next DxfBinaryData.\n
                  * \c NULL if the last DxfBinaryData. */
+        const char *source;
+                /*!< Hexadecimal lines of a run of group code 310
+                 * values, not decoded yet, alternating with their
+                 * group code lines, or \c NULL.\n
+                 * Not '\\0' terminated. */
+        size_t source_length;
+                /*!< Length of \c source. */
+        struct dxf_mapping_struct *mapping;
+                /*!< The memory map holding \c source, or \c NULL
+                 * when \c source is owned. */
+        uint8_t *bytes;
+                /*!< The decoded bytes of this and all following
+                 * objects, \c NULL until the first call to
+                 * dxf_binary_data_get_bytes (). */
+        size_t number_bytes;
+                /*!< Number of bytes in \c bytes. */
 } DxfBinaryData;
 
 
 DxfBinaryData *dxf_binary_data_new ();
 DxfBinaryData *dxf_binary_data_init (DxfBinaryData *data);
+DxfBinaryData *dxf_binary_data_read (DxfFile *fp, DxfBinaryData *data);
 int dxf_binary_data_write (DxfFile *fp, DxfBinaryData *data);
 int dxf_binary_data_free (DxfBinaryData *data);
 void dxf_binary_data_free_list (DxfBinaryData *data);
@@ -78,6 +100,7 @@ char *dxf_binary_data_get_data_line (DxfBinaryData *data);
 DxfBinaryData *dxf_binary_data_set_data_line (DxfBinaryData *data, char *data_line);
 int dxf_binary_data_get_length (DxfBinaryData *data);
 DxfBinaryData *dxf_binary_data_set_length (DxfBinaryData *data, int length);
+uint8_t *dxf_binary_data_get_bytes (DxfBinaryData *data, size_t *number_bytes);
 DxfBinaryData *dxf_binary_data_get_next (DxfBinaryData *data);
 DxfBinaryData *dxf_binary_data_set_next (DxfBinaryData *data, DxfBinaryData *next);
 DxfBinaryData *dxf_binary_data_get_last (DxfBinaryData *data);
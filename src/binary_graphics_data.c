@@ -34,6 +34,7 @@
 
 
 #include "binary_graphics_data.h"
+#include "util.h"
 
 
 /*!
@@ -53,7 +54,7 @@ dxf_binary_graphics_data_new ()
         size = sizeof (DxfBinaryGraphicsData);
         /* avoid malloc of 0 bytes */
         if (size == 0) size = 1;
-        if ((data = malloc (size)) == NULL)
+        if ((data = dxf_malloc (size)) == NULL)
         {
                 fprintf (stderr,
                   (_("Error in %s () could not allocate memory.\n")),
@@ -103,7 +104,7 @@ dxf_binary_graphics_data_init
                   __FUNCTION__);
                 return (NULL);
         }
-        data->data_line = strdup ("");
+        data->data_line = dxf_strdup ("");
         data->length = 0;
         data->next = NULL;
 #if DEBUG
@@ -140,7 +141,7 @@ dxf_binary_graphics_data_write
                 return (EXIT_FAILURE);
         }
         /* Start writing output. */
-        fprintf (fp->fp, "310\n%s\n", data->data_line);
+        dxf_write_string (fp, 310, data->data_line);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -181,8 +182,8 @@ dxf_binary_graphics_data_free
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        free (data->data_line);
-        free (data);
+        dxf_free (data->data_line);
+        dxf_free (data);
         data = NULL;
 #if DEBUG
         DXF_DEBUG_END
@@ -258,7 +259,7 @@ dxf_binary_graphics_data_get_data_line
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (data->data_line));
+        return (dxf_strdup (data->data_line));
 }
 
 
@@ -292,7 +293,7 @@ dxf_binary_graphics_data_set_data_line
                   __FUNCTION__);
                 return (NULL);
         }
-        data->data_line = strdup (data_line);
+        data->data_line = dxf_strdup (data_line);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -42,6 +42,11 @@
 
 
 #include "block.h"
+#include "section.h"
+#include "endsec.h"
+#include "entities.h"
+#include "bbox.h"
+#include "spatial_index.h"
 
 
 /*!
@@ -62,7 +67,7 @@ dxf_block_new ()
         size = sizeof (DxfBlock);
         /* avoid malloc of 0 bytes */
         if (size == 0) size = 1;
-        if ((block = malloc (size)) == NULL)
+        if ((block = dxf_malloc (size)) == NULL)
         {
                 fprintf (stderr,
                   (_("Error in %s () could not allocate memory.\n")),
@@ -113,21 +118,24 @@ dxf_block_init
                 return (NULL);
         }
         /* Assign initial values to members. */
-        block->xref_name = strdup ("");
-        block->block_name = strdup ("");
-        block->block_name_additional = strdup ("");
-        block->description = strdup ("");
-        block->id_code = 0;
-        block->layer = strdup (DXF_DEFAULT_LAYER);
-        block->p0->x0 = 0.0;
-        block->p0->y0 = 0.0;
-        block->p0->z0 = 0.0;
+        block->xref_name = dxf_strdup ("");
+        block->block_name = dxf_strdup ("");
+        block->block_name_additional = dxf_strdup ("");
+        block->description = dxf_strdup ("");
+        block->id_code = DXF_HANDLE_NONE;
+        block->layer = dxf_strdup (DXF_DEFAULT_LAYER);
         block->block_type = 0; /* 0 = invalid type */
         block->extr_x0 = 0.0;
         block->extr_y0 = 0.0;
         block->extr_z0 = 0.0;
-        block->object_owner_soft = strdup ("");
-        block->endblk = (struct DxfEndblk *) dxf_endblk_new ();
+        block->object_owner_soft = 0;
+        block->endblk = (struct DxfEndblk *) dxf_endblk_init (dxf_endblk_new ());
+        block->entities = NULL;
+        block->entity_list = NULL;
+        block->number_of_entities = 0;
+        block->spatial_index = NULL;
+        dxf_bbox_init (&block->extents);
+        block->extents_state = DXF_BLOCK_EXTENTS_UNKNOWN;
         /* Initialize new structs for the following members later,
          * when they are required and when we have content. */
         block->p0 = NULL;
@@ -168,7 +176,9 @@ dxf_block_read
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        char *temp_string = NULL;
+        char temp_string[DXF_MAX_STRING_LENGTH];
+        char id_string[DXF_MAX_STRING_LENGTH];
+        int group_code;
 
         /* Do some basic checks. */
         if (fp == NULL)
@@ -176,8 +186,6 @@ dxf_block_read
                 fprintf (stderr,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
-                /* Clean up. */
-                free (temp_string);
                 return (NULL);
         }
         if (block == NULL)
@@ -219,135 +227,138 @@ dxf_block_read
                         return (NULL);
                 }
         }
-        fscanf (fp->fp, "%[^\n]", temp_string);
-        while (strcmp (temp_string, "0") != 0)
+        while ((dxf_read_group_code (fp, &group_code) == EXIT_SUCCESS)
+          && (group_code != 0))
         {
-                if (ferror (fp->fp))
+                if (dxf_read_error (fp))
                 {
                         fprintf (stderr,
                           (_("Error in %s () while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
-                        fclose (fp->fp);
-                        /* Clean up. */
-                        free (temp_string);
                         return (NULL);
                 }
-                if (strcmp (temp_string, "1") == 0)
-                {
-                        /* Now follows a string containing a external
-                         * reference name. */
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, block->xref_name);
-                }
-                else if (strcmp (temp_string, "2") == 0)
-                {
-                        /* Now follows a string containing a block name. */
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, block->block_name);
-                }
-                else if (strcmp (temp_string, "3") == 0)
-                {
-                        /* Now follows a string containing a block name. */
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, block->block_name_additional);
-                }
-                else if (strcmp (temp_string, "4") == 0)
-                {
-                        /* Now follows a string containing a description. */
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, block->description);
-                }
-                else if (strcmp (temp_string, "5") == 0)
-                {
-                        /* Now follows a string containing a sequential
-                         * id number. */
-                        fscanf (fp->fp, "%x\n", (uint *) &block->id_code);
-                }
-                else if (strcmp (temp_string, "8") == 0)
-                {
-                        /* Now follows a string containing a layer name. */
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, block->layer);
-                }
-                else if (strcmp (temp_string, "10") == 0)
-                {
-                        /* Now follows a string containing the
-                         * X-coordinate of the center point. */
-                        fscanf (fp->fp, "%lf\n", &block->p0->x0);
-                }
-                else if (strcmp (temp_string, "20") == 0)
+                switch (group_code)
                 {
-                        /* Now follows a string containing the
-                         * Y-coordinate of the center point. */
-                        fscanf (fp->fp, "%lf\n", &block->p0->y0);
-                }
-                else if (strcmp (temp_string, "30") == 0)
-                {
-                        /* Now follows a string containing the
-                         * Z-coordinate of the center point. */
-                        fscanf (fp->fp, "%lf\n", &block->p0->z0);
-                }
-                else if ((fp->acad_version_number <= AutoCAD_11)
-                        && (strcmp (temp_string, "38") == 0)
-                        && (block->p0->z0 = 0.0))
-                {
-                        /* Elevation is a pre AutoCAD R11 variable
-                         * so additional testing for the version should
-                         * probably be added.
-                         * Now follows a string containing the
-                         * elevation. */
-                        fscanf (fp->fp, "%lf\n", &block->p0->z0);
-                }
-                else if (strcmp (temp_string, "70") == 0)
-                {
-                        /* Now follows a string containing the block
-                         * type value. */
-                        fscanf (fp->fp, "%hd\n", &block->block_type);
-                }
-                else if ((fp->acad_version_number >= AutoCAD_13)
-                        && (strcmp (temp_string, "100") == 0))
-                {
-                        /* Now follows a string containing the
-                         * subclass marker value. */
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
-                        if ((strcmp (temp_string, "AcDbEntity") != 0)
-                        && ((strcmp (temp_string, "AcDbBlockBegin") != 0)))
-                        {
+                        case 1:
+                                /* Now follows a string containing a external
+                                 * reference name. */
+                                dxf_read_string (fp, &block->xref_name);
+                                break;
+                        case 2:
+                                /* Now follows a string containing a block name. */
+                                dxf_read_string_interned (fp, &block->block_name);
+                                break;
+                        case 3:
+                                /* Now follows a string containing a block name. */
+                                dxf_read_string (fp, &block->block_name_additional);
+                                break;
+                        case 4:
+                                /* Now follows a string containing a description. */
+                                dxf_read_string (fp, &block->description);
+                                break;
+                        case 5:
+                                /* Now follows a string containing a sequential
+                                 * id number. */
+                                dxf_read_handle (fp, &block->id_code);
+                                break;
+                        case 8:
+                                /* Now follows a string containing a layer name. */
+                                dxf_read_string_interned (fp, &block->layer);
+                                break;
+                        case 10:
+                                /* Now follows a string containing the
+                                 * X-coordinate of the center point. */
+                                dxf_read_double (fp, &block->p0->x0);
+                                break;
+                        case 20:
+                                /* Now follows a string containing the
+                                 * Y-coordinate of the center point. */
+                                dxf_read_double (fp, &block->p0->y0);
+                                break;
+                        case 30:
+                                /* Now follows a string containing the
+                                 * Z-coordinate of the center point. */
+                                dxf_read_double (fp, &block->p0->z0);
+                                break;
+                        case 38:
+                                if ((fp->acad_version_number <= AutoCAD_11) && (block->p0->z0 = 0.0))
+                                {
+                                        /* Elevation is a pre AutoCAD R11 variable
+                                         * so additional testing for the version should
+                                         * probably be added.
+                                         * Now follows a string containing the
+                                         * elevation. */
+                                        dxf_read_double (fp, &block->p0->z0);
+                                }
+                                else
+                                {
+                                        fprintf (stderr,
+                                          (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
+                                          __FUNCTION__, fp->filename, fp->line_number);
+                                        /* Skip the value of the unknown group code. */
+                                        dxf_read_line (temp_string, fp);
+                                }
+                                break;
+                        case 70:
+                                /* Now follows a string containing the block
+                                 * type value. */
+                                dxf_read_int16 (fp, &block->block_type);
+                                break;
+                        case 100:
+                                if (fp->acad_version_number >= AutoCAD_13)
+                                {
+                                        /* Now follows a string containing the
+                                         * subclass marker value. */
+                                        dxf_read_line (temp_string, fp);
+                                        if ((strcmp (temp_string, "AcDbEntity") != 0)
+                                        && ((strcmp (temp_string, "AcDbBlockBegin") != 0)))
+                                        {
+                                                fprintf (stderr,
+                                                  (_("Warning in %s () found a bad subclass marker in: %s in line: %d.\n")),
+                                                  __FUNCTION__, fp->filename, fp->line_number);
+                                        }
+                                }
+                                else
+                                {
+                                        fprintf (stderr,
+                                          (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
+                                          __FUNCTION__, fp->filename, fp->line_number);
+                                        /* Skip the value of the unknown group code. */
+                                        dxf_read_line (temp_string, fp);
+                                }
+                                break;
+                        case 210:
+                                /* Now follows a string containing the
+                                 * X-value of the extrusion vector. */
+                                dxf_read_double (fp, &block->extr_x0);
+                                break;
+                        case 220:
+                                /* Now follows a string containing the
+                                 * Y-value of the extrusion vector. */
+                                dxf_read_double (fp, &block->extr_y0);
+                                break;
+                        case 230:
+                                /* Now follows a string containing the
+                                 * Z-value of the extrusion vector. */
+                                dxf_read_double (fp, &block->extr_z0);
+                                break;
+                        case 330:
+                                /* Now follows a string containing Soft-pointer
+                                 * ID/handle to owner object. */
+                                dxf_read_handle (fp, &block->object_owner_soft);
+                                break;
+                        case 999:
+                                /* Now follows a string containing a comment. */
+                                dxf_read_line (temp_string, fp);
+                                fprintf (stdout, "DXF comment: %s\n", temp_string);
+                                break;
+                        default:
                                 fprintf (stderr,
-                                  (_("Warning in %s () found a bad subclass marker in: %s in line: %d.\n")),
+                                  (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
                                   __FUNCTION__, fp->filename, fp->line_number);
-                        }
-                }
-                else if (strcmp (temp_string, "210") == 0)
-                {
-                        /* Now follows a string containing the
-                         * X-value of the extrusion vector. */
-                        fscanf (fp->fp, "%lf\n", &block->extr_x0);
-                }
-                else if (strcmp (temp_string, "220") == 0)
-                {
-                        /* Now follows a string containing the
-                         * Y-value of the extrusion vector. */
-                        fscanf (fp->fp, "%lf\n", &block->extr_y0);
-                }
-                else if (strcmp (temp_string, "230") == 0)
-                {
-                        /* Now follows a string containing the
-                         * Z-value of the extrusion vector. */
-                        fscanf (fp->fp, "%lf\n", &block->extr_z0);
-                }
-                else if (strcmp (temp_string, "330") == 0)
-                {
-                        /* Now follows a string containing Soft-pointer
-                         * ID/handle to owner object. */
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, block->object_owner_soft);
-                }
-                else if (strcmp (temp_string, "999") == 0)
-                {
-                        /* Now follows a string containing a comment. */
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
-                        fprintf (stdout, "DXF comment: %s\n", temp_string);
-                }
-                else
-                {
-                        fprintf (stderr,
-                          (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
-                          __FUNCTION__, fp->filename, fp->line_number);
+                                /* Skip the value of the unknown group code. */
+                                dxf_read_line (temp_string, fp);
+                                break;
                 }
         }
         /* Handle omitted members and/or illegal values. */
@@ -357,11 +368,13 @@ dxf_block_read
          */
         if (strcmp (block->block_name, "") == 0)
         {
-                sprintf (block->block_name, "%i", block->id_code);
+                snprintf (id_string, sizeof (id_string), "%" PRIu64, block->id_code);
+                dxf_string_free (block->block_name);
+                block->block_name = dxf_strdup (id_string);
         }
         if (strcmp (block->layer, "") == 0)
         {
-                block->layer = strdup (DXF_DEFAULT_LAYER);
+                block->layer = dxf_strdup (DXF_DEFAULT_LAYER);
         }
         if (block->block_type == 0)
         {
@@ -372,8 +385,6 @@ dxf_block_read
                   (_("\tblock type value is reset to 1.\n")));
                 block->block_type = 1;
         }
-        /* Clean up. */
-        free (temp_string);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -399,8 +410,9 @@ dxf_block_write
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        char *dxf_entity_name = strdup ("BLOCK");
+        char *dxf_entity_name = dxf_strdup ("BLOCK");
         DxfEndblk *endblk = NULL;
+        DxfEntitiesCursor cursor;
 
         /* Do some basic checks. */
         if (fp == NULL)
@@ -409,7 +421,7 @@ dxf_block_write
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (block == NULL)
@@ -418,31 +430,31 @@ dxf_block_write
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (block->block_name == NULL)
         {
                 fprintf (stderr,
-                  (_("Error in %s () empty block name string for the %s entity with id-code: %x\n")),
+                  (_("Error in %s () empty block name string for the %s entity with id-code: %" PRIx64 "\n")),
                   __FUNCTION__, dxf_entity_name, block->id_code);
                 fprintf (stderr,
                   (_("\t%s entity is discarded from output.\n")),
                   dxf_entity_name);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (block->endblk == NULL)
         {
                 fprintf (stderr,
-                  (_("Error in %s () NULL pointer to endblk was passed or the %s entity with id-code: %x\n")),
+                  (_("Error in %s () NULL pointer to endblk was passed or the %s entity with id-code: %" PRIx64 "\n")),
                   __FUNCTION__, dxf_entity_name, block->id_code);
                 fprintf (stderr,
                   (_("\t%s entity is discarded from output.\n")),
                   dxf_entity_name);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if ((block->block_type == 4) || (block->block_type == 32))
@@ -450,46 +462,39 @@ dxf_block_write
                 if ((block->xref_name == NULL) || (strcmp (block->xref_name, "") == 0))
                 {
                         fprintf (stderr,
-                          (_("Error in %s () empty xref path name string for the %s entity with id-code: %x\n")),
+                          (_("Error in %s () empty xref path name string for the %s entity with id-code: %" PRIx64 "\n")),
                           __FUNCTION__, dxf_entity_name, block->id_code);
                         fprintf (stderr,
                           (_("\t%s entity is discarded from output.\n")),
                           dxf_entity_name);
                         /* Clean up. */
-                        free (dxf_entity_name);
+                        dxf_free (dxf_entity_name);
                         return (EXIT_FAILURE);
                 }
         }
         if (block->description == NULL)
         {
                 fprintf (stderr,
-                  (_("Warning in %s () NULL pointer to description string for the %s entity with id-code: %x\n")),
+                  (_("Warning in %s () NULL pointer to description string for the %s entity with id-code: %" PRIx64 "\n")),
                   __FUNCTION__, dxf_entity_name, block->id_code);
-                block->description = strdup ("");
+                block->description = dxf_strdup ("");
         }
         if (strcmp (block->layer, "") == 0)
         {
                 fprintf (stderr,
-                  (_("Warning in %s () empty layer string for the %s entity with id-code: %x\n")),
+                  (_("Warning in %s () empty layer string for the %s entity with id-code: %" PRIx64 "\n")),
                   __FUNCTION__, dxf_entity_name, block->id_code);
                 fprintf (stderr,
                   (_("\t%s entity is relocated to layer 0.\n")),
                   dxf_entity_name);
-                block->layer = strdup (DXF_DEFAULT_LAYER);
-        }
-        if (block->object_owner_soft == NULL)
-        {
-                fprintf (stderr,
-                  (_("Warning in %s () NULL pointer to soft owner object string for the %s entity with id-code: %x\n")),
-                  __FUNCTION__, dxf_entity_name, block->id_code);
-                block->object_owner_soft = strdup ("");
+                block->layer = dxf_strdup (DXF_DEFAULT_LAYER);
         }
         /* Start writing output. */
-        fprintf (fp->fp, "  0\n%s\n", dxf_entity_name);
+        dxf_write_string (fp, 0, dxf_entity_name);
         if ((fp->acad_version_number >= AutoCAD_13)
-          && (block->id_code != -1))
+          && (block->id_code != DXF_HANDLE_NONE))
         {
-                fprintf (fp->fp, "  5\n%x\n", block->id_code);
+                dxf_write_hex (fp, 5, block->id_code);
         }
         /*!
          * \todo for version R14.\n
@@ -501,44 +506,49 @@ dxf_block_write
          * 102 groups are application defined (optional).\n\n
          * End of group, "}" (optional), with Group code 102.
          */
-        if ((strcmp (block->object_owner_soft, "") != 0)
+        if ((block->object_owner_soft != 0)
           && (fp->acad_version_number >= AutoCAD_14))
         {
-                fprintf (fp->fp, "330\n%s\n", block->object_owner_soft);
+                dxf_write_hex (fp, 330, block->object_owner_soft);
         }
         if (fp->acad_version_number >= AutoCAD_13)
         {
-                fprintf (fp->fp, "100\nAcDbEntity\n");
+                dxf_write_string (fp, 100, "AcDbEntity");
         }
-        fprintf (fp->fp, "  8\n%s\n", block->layer);
+        dxf_write_string (fp, 8, block->layer);
         if (fp->acad_version_number >= AutoCAD_13)
         {
-                fprintf (fp->fp, "100\nAcDbBlockBegin\n");
+                dxf_write_string (fp, 100, "AcDbBlockBegin");
         }
-        fprintf (fp->fp, "  2\n%s\n", block->block_name);
-        fprintf (fp->fp, " 70\n%hd\n", block->block_type);
-        fprintf (fp->fp, " 10\n%f\n", block->p0->x0);
-        fprintf (fp->fp, " 20\n%f\n", block->p0->y0);
-        fprintf (fp->fp, " 30\n%f\n", block->p0->z0);
+        dxf_write_string (fp, 2, block->block_name);
+        dxf_write_int (fp, 70, block->block_type);
+        dxf_write_double (fp, 10, block->p0->x0);
+        dxf_write_double (fp, 20, block->p0->y0);
+        dxf_write_double (fp, 30, block->p0->z0);
         if (fp->acad_version_number >= AutoCAD_13)
         {
-                fprintf (fp->fp, "  3\n%s\n", block->block_name);
+                dxf_write_string (fp, 3, block->block_name);
         }
         if ((fp->acad_version_number >= AutoCAD_13)
         && ((block->block_type & 4)
         || (block->block_type & 32)))
         {
-                fprintf (fp->fp, "  1\n%s\n", block->xref_name);
+                dxf_write_string (fp, 1, block->xref_name);
         }
         if ((fp->acad_version_number >= AutoCAD_2000)
         && (strcmp (block->description, "") != 0))
         {
-                fprintf (fp->fp, "  4\n%s\n", block->description);
+                dxf_write_string (fp, 4, block->description);
+        }
+        if (block->entities != NULL)
+        {
+                dxf_entities_cursor_init (&cursor, (DxfEntities *) block->entities);
+                dxf_entities_write_cursor (fp, &cursor, SIZE_MAX);
         }
         endblk = (DxfEndblk *) block->endblk;
         dxf_endblk_write (fp, endblk);
         /* Clean up. */
-        free (dxf_entity_name);
+        dxf_free (dxf_entity_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -550,6 +560,12 @@ dxf_block_write
  * \brief Write DXF output to a file for a list of block definitions.
  *
  * Appears only in the \c BLOCKS section.\n
+ * The \c BLOCKS section is written with every block definition of
+ * \c blocks_list, each followed by it's \c ENDBLK marker.\n
+ * A block rejected by dxf_block_write () is left out.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
  */
 int
 dxf_block_write_table
@@ -563,6 +579,9 @@ dxf_block_write_table
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
+        DxfBlock *iter;
+        char *dxf_section_name = NULL;
+
         /* Do some basic checks. */
         if (fp == NULL)
         {
@@ -571,12 +590,19 @@ dxf_block_write_table
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-
-        /*! \todo Add code here. */
+        dxf_section_name = dxf_strdup ("BLOCKS");
+        dxf_section_write (fp, dxf_section_name);
+        for (iter = blocks_list; iter != NULL; iter = (DxfBlock *) iter->next)
+        {
+                dxf_block_write (fp, iter);
+        }
+        dxf_endsec_write (fp);
+        /* Clean up. */
+        dxf_free (dxf_section_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (EXIT_SUCCESS);
+        return (((fp->writer != NULL) && fp->writer->error) ? EXIT_FAILURE : EXIT_SUCCESS);
 }
 
 
@@ -612,13 +638,17 @@ dxf_block_free
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        free (block->xref_name);
-        free (block->block_name);
-        free (block->block_name_additional);
-        free (block->description);
-        free (block->layer);
-        free (block->object_owner_soft);
-        free (block);
+        dxf_free (block->xref_name);
+        dxf_string_free (block->block_name);
+        dxf_free (block->block_name_additional);
+        dxf_free (block->description);
+        dxf_string_free (block->layer);
+        if (block->entities != NULL)
+        {
+                dxf_entities_free ((DxfEntities *) block->entities);
+        }
+        dxf_block_free_caches (block);
+        dxf_free (block);
         block = NULL;
 #if DEBUG
         DXF_DEBUG_END
@@ -695,7 +725,7 @@ dxf_block_get_xref_name
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (block->xref_name));
+        return (dxf_strdup (block->xref_name));
 }
 
 
@@ -730,7 +760,7 @@ dxf_block_set_xref_name
                   __FUNCTION__);
                 return (NULL);
         }
-        block->xref_name = strdup (xref_name);
+        block->xref_name = dxf_strdup (xref_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -773,7 +803,7 @@ dxf_block_get_block_name
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (block->block_name));
+        return (dxf_strdup (block->block_name));
 }
 
 
@@ -808,7 +838,7 @@ dxf_block_set_block_name
                   __FUNCTION__);
                 return (NULL);
         }
-        block->block_name = strdup (block_name);
+        block->block_name = dxf_strdup (block_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -851,7 +881,7 @@ dxf_block_get_block_name_additional
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (block->block_name_additional));
+        return (dxf_strdup (block->block_name_additional));
 }
 
 
@@ -886,7 +916,7 @@ dxf_block_set_block_name_additional
                   __FUNCTION__);
                 return (NULL);
         }
-        block->block_name_additional = strdup (block_name_additional);
+        block->block_name_additional = dxf_strdup (block_name_additional);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -929,7 +959,7 @@ dxf_block_get_description
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (block->description));
+        return (dxf_strdup (block->description));
 }
 
 
@@ -964,7 +994,7 @@ dxf_block_set_description
                   __FUNCTION__);
                 return (NULL);
         }
-        block->description = strdup (description);
+        block->description = dxf_strdup (description);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -977,7 +1007,7 @@ dxf_block_set_description
  *
  * \return ID code.
  */
-int
+uint64_t
 dxf_block_get_id_code
 (
         DxfBlock *block
@@ -995,12 +1025,6 @@ dxf_block_get_id_code
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (block->id_code < 0)
-        {
-                fprintf (stderr,
-                  (_("Warning in %s () a negative value was found.\n")),
-                  __FUNCTION__);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1016,7 +1040,7 @@ dxf_block_set_id_code
 (
         DxfBlock *block,
                 /*!< a pointer to a DXF \c BLOCK entity. */
-        int id_code
+        uint64_t id_code
                 /*!< Identification number for the entity.\n
                  * This is to be an unique (sequential) number in the DXF
                  * file. */
@@ -1033,12 +1057,6 @@ dxf_block_set_id_code
                   __FUNCTION__);
                 return (NULL);
         }
-        if (id_code < 0)
-        {
-                fprintf (stderr,
-                  (_("Warning in %s () a negative value was passed.\n")),
-                  __FUNCTION__);
-        }
         block->id_code = id_code;
 #if DEBUG
         DXF_DEBUG_END
@@ -1080,7 +1098,7 @@ dxf_block_get_layer
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (block->layer));
+        return (dxf_strdup (block->layer));
 }
 
 
@@ -1114,7 +1132,7 @@ dxf_block_set_layer
                   __FUNCTION__);
                 return (NULL);
         }
-        block->layer = strdup (layer);
+        block->layer = dxf_strdup (layer);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2024,10 +2042,8 @@ dxf_block_set_extrusion_vector
  * \c BLOCK entity.
  *
  * \return soft pointer to the object owner.
- *
- * \warning No checks are performed on the returned pointer (string).
  */
-char *
+uint64_t
 dxf_block_get_object_owner_soft
 (
         DxfBlock *block
@@ -2043,19 +2059,12 @@ dxf_block_get_object_owner_soft
                 fprintf (stderr,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
-                return (NULL);
-        }
-        if (block->object_owner_soft ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
+                return (0);
         }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (block->object_owner_soft));
+        return (block->object_owner_soft);
 }
 
 
@@ -2068,8 +2077,8 @@ dxf_block_set_object_owner_soft
 (
         DxfBlock *block,
                 /*!< a pointer to a DXF \c BLOCK entity. */
-        char *object_owner_soft
-                /*!< a string containing the pointer to the
+        uint64_t object_owner_soft
+                /*!< the handle of the
                  * object_owner_soft for the entity. */
 )
 {
@@ -2084,14 +2093,7 @@ dxf_block_set_object_owner_soft
                   __FUNCTION__);
                 return (NULL);
         }
-        if (object_owner_soft == NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was passed.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
-        block->object_owner_soft = strdup (object_owner_soft);
+        block->object_owner_soft = object_owner_soft;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2319,4 +2321,907 @@ dxf_block_get_last
 }
 
 
+/*!
+ * \brief Get the pointer to the entities of a DXF \c BLOCK entity.
+ *
+ * \return pointer to the entities, \c NULL for an empty block.
+ *
+ * \warning No checks are performed on the returned pointer.
+ */
+struct dxf_entities_struct *
+dxf_block_get_entities
+(
+        DxfBlock *block
+                /*!< a pointer to a DXF \c BLOCK entity. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        /* Do some basic checks. */
+        if (block == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return ((struct dxf_entities_struct *) block->entities);
+}
+
+
+/*!
+ * \brief Set the pointer to the entities for a DXF \c BLOCK entity.
+ *
+ * \c block takes ownership of \c entities, the entities set before are
+ * not freed.\n
+ * The cached entity list, extents and spatial index of \c block are
+ * invalidated.
+ */
+DxfBlock *
+dxf_block_set_entities
+(
+        DxfBlock *block,
+                /*!< a pointer to a DXF \c BLOCK entity. */
+        struct dxf_entities_struct *entities
+                /*!< a pointer to the entities for the entity. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        /* Do some basic checks. */
+        if (block == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        block->entities = entities;
+        dxf_block_free_caches (block);
+        dxf_bbox_init (&block->extents);
+        block->extents_state = DXF_BLOCK_EXTENTS_UNKNOWN;
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (block);
+}
+
+
+/*!
+ * \brief Get the extents of the entities of a DXF \c BLOCK entity, in
+ * the coordinates of the block definition.
+ *
+ * The extents are computed once with dxf_entity_get_bbox () and cached
+ * in \c block, entities without a bounding box are left out.\n
+ * A block which (indirectly) inserts itself ends the recursion with
+ * an empty box.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_block_get_bbox
+(
+        DxfBlock *block,
+                /*!< a pointer to a DXF \c BLOCK entity. */
+        DxfBbox *bbox
+                /*!< the bounding box, empty for an empty block. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfBlockEntity *entity_list;
+        DxfBbox entity_bbox;
+        size_t number_of_entities;
+        size_t i;
+
+        /* Do some basic checks. */
+        if ((block == NULL) || (bbox == NULL))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        if (block->extents_state == DXF_BLOCK_EXTENTS_BUSY)
+        {
+                fprintf (stderr,
+                  (_("Warning in %s () block %s is inserted in itself.\n")),
+                  __FUNCTION__, block->block_name);
+                dxf_bbox_init (bbox);
+                return (EXIT_SUCCESS);
+        }
+        if (block->extents_state == DXF_BLOCK_EXTENTS_UNKNOWN)
+        {
+                block->extents_state = DXF_BLOCK_EXTENTS_BUSY;
+                dxf_bbox_init (&block->extents);
+                entity_list = dxf_block_get_entity_list (block, &number_of_entities);
+                for (i = 0; (entity_list != NULL) && (i < number_of_entities); i++)
+                {
+                        if (dxf_entity_get_bbox (entity_list[i].type,
+                          entity_list[i].entity, &entity_bbox) == EXIT_SUCCESS)
+                        {
+                                dxf_bbox_add_bbox (&block->extents, &entity_bbox);
+                        }
+                }
+                block->extents_state = DXF_BLOCK_EXTENTS_VALID;
+        }
+        *bbox = block->extents;
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Get the entity list of a DXF \c BLOCK entity.
+ *
+ * The entities of \c block are collected once into an array of
+ * references, in cursor order, which is cached in \c block until
+ * dxf_block_set_entities () is called, so walking the entities of a
+ * block inserted many times does not walk the lists of it's
+ * \c DxfEntities every time.
+ *
+ * \warning The entity list is built on first use, call this (or
+ * dxf_block_map_resolve ()) before sharing \c block between threads.
+ *
+ * \return a pointer to the entity list, \c NULL for an empty block or
+ * when an error occurred.
+ */
+DxfBlockEntity *
+dxf_block_get_entity_list
+(
+        DxfBlock *block,
+                /*!< a pointer to a DXF \c BLOCK entity. */
+        size_t *number_of_entities
+                /*!< Returns the number of entities in the list. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfEntitiesCursor cursor;
+        size_t number = 0;
+        size_t i;
+
+        /* Do some basic checks. */
+        if ((block == NULL) || (number_of_entities == NULL))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        if ((block->entity_list == NULL) && (block->entities != NULL))
+        {
+                dxf_entities_cursor_init (&cursor, (DxfEntities *) block->entities);
+                number = dxf_entities_cursor_skip (&cursor, SIZE_MAX);
+                if (number > 0)
+                {
+                        block->entity_list = malloc (number * sizeof (DxfBlockEntity));
+                        if (block->entity_list == NULL)
+                        {
+                                fprintf (stderr,
+                                  (_("Error in %s () could not allocate memory.\n")),
+                                  __FUNCTION__);
+                                *number_of_entities = 0;
+                                return (NULL);
+                        }
+                        dxf_entities_cursor_init (&cursor, (DxfEntities *) block->entities);
+                        for (i = 0; i < number; i++)
+                        {
+                                block->entity_list[i].type = dxf_entities_cursor_get_type (&cursor);
+                                block->entity_list[i].entity = cursor.entity;
+                                dxf_entities_cursor_skip (&cursor, 1);
+                        }
+                }
+                block->number_of_entities = number;
+        }
+        *number_of_entities = block->number_of_entities;
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (block->entity_list);
+}
+
+
+/*!
+ * \brief Get the spatial index of the entities of a DXF \c BLOCK
+ * entity, in the coordinates of the block definition.
+ *
+ * The index is bulk loaded from the bounding boxes of the entities of
+ * \c block on first use (see dxf_spatial_index_tree_add_entities ()),
+ * and cached in \c block until dxf_block_set_entities () is called.\n
+ * Nested \c INSERT entities are only indexed when they are resolved,
+ * see dxf_block_map_resolve ().
+ *
+ * \warning The index is built on first use, call this before sharing
+ * \c block between threads.
+ *
+ * \return a pointer to the spatial index, or \c NULL when an error
+ * occurred.
+ */
+struct dxf_spatial_index_tree_struct *
+dxf_block_get_spatial_index
+(
+        DxfBlock *block
+                /*!< a pointer to a DXF \c BLOCK entity. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfSpatialIndexTree *tree;
+
+        /* Do some basic checks. */
+        if (block == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        if (block->spatial_index == NULL)
+        {
+                tree = dxf_spatial_index_tree_new ();
+                if (tree == NULL)
+                {
+                        return (NULL);
+                }
+                if ((block->entities != NULL)
+                  && (dxf_spatial_index_tree_add_entities (tree,
+                  (DxfEntities *) block->entities) == EXIT_FAILURE))
+                {
+                        dxf_spatial_index_tree_free (tree);
+                        return (NULL);
+                }
+                block->spatial_index = (struct dxf_spatial_index_tree_struct *) tree;
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (block->spatial_index);
+}
+
+
+/*!
+ * \brief Free the entity list and the spatial index cached in a DXF
+ * \c BLOCK entity.
+ *
+ * The caches are allocated from the heap, also for a block in an
+ * arena, so they have to be freed before the arena is freed (see
+ * dxf_drawing_free ()).  They are built again on next use.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_block_free_caches
+(
+        DxfBlock *block
+                /*!< a pointer to a DXF \c BLOCK entity. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        /* Do some basic checks. */
+        if (block == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        free (block->entity_list);
+        block->entity_list = NULL;
+        block->number_of_entities = 0;
+        if (block->spatial_index != NULL)
+        {
+                dxf_spatial_index_tree_free ((DxfSpatialIndexTree *) block->spatial_index);
+                block->spatial_index = NULL;
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Read and parse the \c BLOCKS section from a DXF file.
+ *
+ * The last line read from file contained the string "BLOCKS".\n
+ * Every block definition up to the \c ENDSEC marker is read with
+ * dxf_block_read (), followed by it's entities (see
+ * dxf_entities_read_block ()) and it's \c ENDBLK marker, and appended
+ * to \c blocks_list.
+ *
+ * \return \c EXIT_SUCCESS when the \c ENDSEC marker was read, or
+ * \c EXIT_FAILURE when an error occurred.
+ */
+int
+dxf_block_read_table
+(
+        DxfFile *fp,
+                /*!< DXF file pointer to an input file (or device). */
+        DxfBlock **blocks_list
+                /*!< Pointer to the list of block definitions to append
+                 * to, the list may be empty (\c NULL). */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfBlock *block;
+        DxfBlock *last;
+        DxfEntities *entities;
+        const char *value;
+        size_t length;
+        int group_code;
+
+        /* Do some basic checks. */
+        if (fp == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL file pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        if (blocks_list == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        last = *blocks_list;
+        while ((last != NULL) && (last->next != NULL))
+        {
+                last = (DxfBlock *) last->next;
+        }
+        for (;;)
+        {
+                if ((dxf_read_group_code (fp, &group_code) == EXIT_FAILURE)
+                  || (group_code != 0)
+                  || (dxf_read_string_view (fp, &value, &length) == EXIT_FAILURE))
+                {
+                        fprintf (stderr,
+                          (_("Error in %s () BLOCK or ENDSEC expected while reading from: %s in line: %d.\n")),
+                          __FUNCTION__, fp->filename, fp->line_number);
+                        return (EXIT_FAILURE);
+                }
+                if ((length == 6) && (strncmp (value, "ENDSEC", 6) == 0))
+                {
+                        break;
+                }
+                if ((length != 5) || (strncmp (value, "BLOCK", 5) != 0))
+                {
+                        fprintf (stderr,
+                          (_("Error in %s () BLOCK or ENDSEC expected while reading from: %s in line: %d.\n")),
+                          __FUNCTION__, fp->filename, fp->line_number);
+                        return (EXIT_FAILURE);
+                }
+                block = dxf_block_init (dxf_block_new ());
+                if (block == NULL)
+                {
+                        return (EXIT_FAILURE);
+                }
+                block->p0 = dxf_point_init (dxf_point_new ());
+                if (dxf_block_read (fp, block) == NULL)
+                {
+                        dxf_block_free (block);
+                        return (EXIT_FAILURE);
+                }
+                /* Append the block before reading it's entities, so it
+                 * is freed with the list after an error. */
+                if (last == NULL)
+                {
+                        *blocks_list = block;
+                }
+                else
+                {
+                        last->next = (struct DxfBlock *) block;
+                }
+                last = block;
+                /* The group code 0 of the first entity, or of the
+                 * ENDBLK marker, was read already. */
+                dxf_reader_push_back (fp);
+                entities = dxf_entities_new ();
+                if (entities == NULL)
+                {
+                        return (EXIT_FAILURE);
+                }
+                block->entities = (struct dxf_entities_struct *) entities;
+                if ((dxf_entities_read_block (fp, entities) == EXIT_FAILURE)
+                  || (dxf_endblk_read (fp, (DxfEndblk *) block->endblk) == NULL))
+                {
+                        return (EXIT_FAILURE);
+                }
+                dxf_reader_push_back (fp);
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Initial number of slots in the hash table of a
+ * \c DxfBlockMap.
+ */
+#define DXF_BLOCK_MAP_INITIAL_CAPACITY 64
+
+
+/*!
+ * \brief Compute the hash of an interned block name from it's
+ * address.
+ */
+static size_t
+dxf_block_map_hash
+(
+        const char *block_name
+                /*!< Interned block name. */
+)
+{
+        uint64_t hash = (uint64_t) (uintptr_t) block_name;
+
+        /* Fibonacci hashing, the high bits are the best mixed. */
+        hash *= 11400714819323198485ULL;
+        return ((size_t) (hash >> 32));
+}
+
+
+/*!
+ * \brief Find the slot holding an interned block name, or the empty
+ * slot where it should be inserted.
+ */
+static size_t
+dxf_block_map_find_slot
+(
+        DxfBlockMap *map,
+                /*!< a pointer to a libDXF block map. */
+        const char *block_name
+                /*!< Interned block name. */
+)
+{
+        size_t mask = map->capacity - 1;
+        size_t i = dxf_block_map_hash (block_name) & mask;
+
+        while ((map->entries[i].block_name != NULL)
+          && (map->entries[i].block_name != block_name))
+        {
+                i = (i + 1) & mask;
+        }
+        return (i);
+}
+
+
+/*!
+ * \brief Double the number of slots in the hash table of a
+ * \c DxfBlockMap.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+static int
+dxf_block_map_grow
+(
+        DxfBlockMap *map
+                /*!< a pointer to a libDXF block map. */
+)
+{
+        DxfBlockMapEntry *old_entries = map->entries;
+        size_t old_capacity = map->capacity;
+        size_t i;
+
+        map->capacity = old_capacity * 2;
+        map->entries = calloc (map->capacity, sizeof (DxfBlockMapEntry));
+        if (map->entries == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () could not allocate memory.\n")),
+                  __FUNCTION__);
+                map->entries = old_entries;
+                map->capacity = old_capacity;
+                return (EXIT_FAILURE);
+        }
+        for (i = 0; i < old_capacity; i++)
+        {
+                if (old_entries[i].block_name != NULL)
+                {
+                        map->entries[dxf_block_map_find_slot (map,
+                          old_entries[i].block_name)] = old_entries[i];
+                }
+        }
+        free (old_entries);
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Allocate memory for a libDXF \c DxfBlockMap.
+ *
+ * The block names are interned in \c string_pool, usually the string
+ * pool of the drawing (see dxf_drawing_get_string_pool ()), which
+ * must outlive the map.
+ *
+ * \return \c NULL when no memory was allocated, a pointer to the
+ * allocated memory when successful.
+ */
+DxfBlockMap *
+dxf_block_map_new
+(
+        DxfStringPool *string_pool
+                /*!< a pointer to the string pool for the block
+                 * names. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfBlockMap *map = NULL;
+
+        /* Do some basic checks. */
+        if (string_pool == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        if ((map = malloc (sizeof (DxfBlockMap))) == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () could not allocate memory.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        memset (map, 0, sizeof (DxfBlockMap));
+        map->string_pool = string_pool;
+        map->capacity = DXF_BLOCK_MAP_INITIAL_CAPACITY;
+        map->entries = calloc (map->capacity, sizeof (DxfBlockMapEntry));
+        if (map->entries == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () could not allocate memory.\n")),
+                  __FUNCTION__);
+                free (map);
+                return (NULL);
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (map);
+}
+
+
+/*!
+ * \brief Free the allocated memory for a libDXF \c DxfBlockMap.
+ *
+ * The blocks and the interned block names are not freed.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_block_map_free
+(
+        DxfBlockMap *map
+                /*!< a pointer to the memory occupied by the libDXF
+                 * block map. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        /* Do some basic checks. */
+        if (map == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        free (map->entries);
+        free (map);
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Add a block definition to a libDXF \c DxfBlockMap.
+ *
+ * The block is added under it's \c block_name, replacing a block with
+ * the same name added before.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_block_map_add
+(
+        DxfBlockMap *map,
+                /*!< a pointer to a libDXF block map. */
+        DxfBlock *block
+                /*!< a pointer to a DXF \c BLOCK entity. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        const char *block_name;
+        size_t i;
+
+        /* Do some basic checks. */
+        if ((map == NULL) || (block == NULL) || (block->block_name == NULL))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        block_name = dxf_string_pool_intern (map->string_pool,
+          block->block_name, strlen (block->block_name));
+        if (block_name == NULL)
+        {
+                return (EXIT_FAILURE);
+        }
+        i = dxf_block_map_find_slot (map, block_name);
+        if (map->entries[i].block_name == NULL)
+        {
+                /* Keep the load factor at or below one half. */
+                if (2 * (map->count + 1) > map->capacity)
+                {
+                        if (dxf_block_map_grow (map) == EXIT_FAILURE)
+                        {
+                                return (EXIT_FAILURE);
+                        }
+                        i = dxf_block_map_find_slot (map, block_name);
+                }
+                map->entries[i].block_name = block_name;
+                map->count++;
+        }
+        map->entries[i].block = block;
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Add a list of block definitions to a libDXF \c DxfBlockMap.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_block_map_add_list
+(
+        DxfBlockMap *map,
+                /*!< a pointer to a libDXF block map. */
+        DxfBlock *blocks
+                /*!< a pointer to the first DXF \c BLOCK entity of a
+                 * list, may be \c NULL. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        /* Do some basic checks. */
+        if (map == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        for (; blocks != NULL; blocks = (DxfBlock *) blocks->next)
+        {
+                if (dxf_block_map_add (map, blocks) == EXIT_FAILURE)
+                {
+                        return (EXIT_FAILURE);
+                }
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Find a block definition by name in a libDXF \c DxfBlockMap.
+ *
+ * A name interned in the string pool of the map is found without
+ * looking at it's contents.
+ *
+ * \return a pointer to the block definition, or \c NULL when no block
+ * named \c block_name is in the map.
+ */
+DxfBlock *
+dxf_block_map_lookup
+(
+        DxfBlockMap *map,
+                /*!< a pointer to a libDXF block map. */
+        const char *block_name
+                /*!< Block name. */
+)
+{
+        const char *interned;
+        size_t i;
+
+        /* Do some basic checks. */
+        if ((map == NULL) || (block_name == NULL))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        interned = block_name;
+        if (!dxf_string_pool_owns (map->string_pool, block_name))
+        {
+                interned = dxf_string_pool_lookup (map->string_pool,
+                  block_name, strlen (block_name));
+                if (interned == NULL)
+                {
+                        return (NULL);
+                }
+        }
+        i = dxf_block_map_find_slot (map, interned);
+        return (map->entries[i].block);
+}
+
+
+/*!
+ * \brief Get the number of block definitions in a libDXF
+ * \c DxfBlockMap.
+ *
+ * \return the number of blocks.
+ */
+size_t
+dxf_block_map_get_count
+(
+        DxfBlockMap *map
+                /*!< a pointer to a libDXF block map. */
+)
+{
+        /* Do some basic checks. */
+        if (map == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (0);
+        }
+        return (map->count);
+}
+
+
+/*!
+ * \brief Resolve the block definitions of the not yet resolved
+ * \c INSERT entities in a list with a libDXF \c DxfBlockMap.
+ *
+ * \c INSERT entities naming a block which is not in the map stay
+ * unresolved.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_block_map_resolve_inserts
+(
+        DxfBlockMap *map,
+                /*!< a pointer to a libDXF block map. */
+        DxfInsert *inserts
+                /*!< a pointer to the first DXF \c INSERT entity of a
+                 * list, may be \c NULL. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfInsert *insert;
+
+        /* Do some basic checks. */
+        if (map == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        for (insert = inserts;
+          insert != NULL;
+          insert = (DxfInsert *) insert->next)
+        {
+                if ((insert->block == NULL) && (insert->block_name != NULL))
+                {
+                        insert->block = (struct dxf_block_struct *)
+                          dxf_block_map_lookup (map, insert->block_name);
+                }
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Resolve the \c INSERT entities inside the block definitions
+ * of a libDXF \c DxfBlockMap, and build the entity list and the
+ * extents of every block definition.
+ *
+ * Afterwards the blocks are only read by dxf_block_get_entity_list (),
+ * dxf_block_get_bbox (), dxf_insert_get_bbox () and
+ * dxf_insert_explode_next (), so these can be used from multiple
+ * threads.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_block_map_resolve
+(
+        DxfBlockMap *map
+                /*!< a pointer to a libDXF block map. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfBlock *block;
+        DxfBbox bbox;
+        size_t number_of_entities;
+        size_t i;
+
+        /* Do some basic checks. */
+        if (map == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        /* Resolve all blocks first, the extents of a block depend on
+         * the blocks it inserts. */
+        for (i = 0; i < map->capacity; i++)
+        {
+                block = map->entries[i].block;
+                if ((block != NULL) && (block->entities != NULL))
+                {
+                        dxf_block_map_resolve_inserts (map,
+                          (DxfInsert *) ((DxfEntities *) block->entities)->insert_list);
+                        dxf_block_get_entity_list (block, &number_of_entities);
+                }
+        }
+        for (i = 0; i < map->capacity; i++)
+        {
+                block = map->entries[i].block;
+                if (block != NULL)
+                {
+                        dxf_block_get_bbox (block, &bbox);
+                }
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (EXIT_SUCCESS);
+}
+
+
 /* EOF */
@@ -49,6 +49,8 @@
 #include "util.h"
 #include "endblk.h"
 #include "point.h"
+#include "string_pool.h"
+#include "insert.h"
 
 
 #ifdef __cplusplus
@@ -56,6 +58,33 @@ extern "C" {
 #endif
 
 
+/*!
+ * \brief The extents of a DxfBlock were not computed yet. */
+#define DXF_BLOCK_EXTENTS_UNKNOWN 0
+/*!
+ * \brief The extents of a DxfBlock are being computed. */
+#define DXF_BLOCK_EXTENTS_BUSY 1
+/*!
+ * \brief The extents of a DxfBlock are cached. */
+#define DXF_BLOCK_EXTENTS_VALID 2
+
+
+/*!
+ * \brief DXF definition of an entity reference in the entity list of a
+ * \c DxfBlock.
+ */
+typedef struct
+dxf_block_entity_struct
+{
+        const char *type;
+                /*!< Entity type name, for example "LINE" (not
+                 * owned). */
+        void *entity;
+                /*!< The entity (owned by the \c entities of the
+                 * DxfBlock). */
+} DxfBlockEntity;
+
+
 /*!
  * \brief DXF definition of an AutoCAD block entity.
  *
@@ -91,7 +120,7 @@ dxf_block_struct
         char *description;
                 /*!< Block description (optional).\n
                  * Group code = 4. */
-        int id_code;
+        uint64_t id_code;
                 /*!< Identification number for the entity.\n
                  * This is to be an unique (sequential) number in the DXF
                  * file.\n
@@ -130,11 +159,33 @@ dxf_block_struct
                 /*!< Z-value of the extrusion vector.\n
                  * Defaults to 1.0 if omitted in the DXF file.\n
                  * Group code = 230. */
-        char *object_owner_soft;
+        uint64_t object_owner_soft;
                 /*!< Soft-pointer ID/handle to owner object.\n
                  * Group code = 330. */
         struct DxfEndblk *endblk;
                 /*!< pointer to the end of block marker. */
+        struct dxf_entities_struct *entities;
+                /*!< pointer to the entities between the \c BLOCK and
+                 * the \c ENDBLK, owned by the DxfBlock.\n
+                 * \c NULL for an empty block. */
+        DxfBlockEntity *entity_list;
+                /*!< cached array of the entities in \c entities, in
+                 * cursor order, \c NULL when not built yet.\n
+                 * See dxf_block_get_entity_list (). */
+        size_t number_of_entities;
+                /*!< Number of entities in \c entity_list. */
+        struct dxf_spatial_index_tree_struct *spatial_index;
+                /*!< cached spatial index of the entities in
+                 * \c entities, in the coordinates of the block
+                 * definition, \c NULL when not built yet.\n
+                 * See dxf_block_get_spatial_index (). */
+        DxfBbox extents;
+                /*!< cached extents of \c entities, valid when
+                 * \c extents_state is \c DXF_BLOCK_EXTENTS_VALID. */
+        int extents_state;
+                /*!< one of \c DXF_BLOCK_EXTENTS_UNKNOWN,
+                 * \c DXF_BLOCK_EXTENTS_BUSY or
+                 * \c DXF_BLOCK_EXTENTS_VALID. */
         struct DxfBlock *next;
                 /*!< pointer to the next DxfBlock.\n
                  * \c NULL in the last DxfBlock. */
@@ -142,6 +193,46 @@ dxf_block_struct
 } DxfBlock;
 
 
+/*!
+ * \brief DXF definition of an entry of a \c DxfBlockMap.
+ */
+typedef struct
+dxf_block_map_entry_struct
+{
+        const char *block_name;
+                /*!< Interned block name (owned by the string pool of
+                 * the map), \c NULL for an empty slot. */
+        DxfBlock *block;
+                /*!< The block definition (not owned). */
+} DxfBlockMapEntry;
+
+
+/*!
+ * \brief DXF definition of an in memory table of block definitions,
+ * keyed by block name.
+ *
+ * An open addressing hash table mapping interned block names to the
+ * block definitions of a drawing, so the \c INSERT entities can be
+ * resolved to their block definition in constant time.\n
+ * The block names are interned in the string pool of the map, which
+ * makes a lookup a pointer comparison.\n
+ * The map does not own the blocks.
+ */
+typedef struct
+dxf_block_map_struct
+{
+        DxfBlockMapEntry *entries;
+                /*!< The hash table. */
+        size_t capacity;
+                /*!< Number of slots, always a power of two. */
+        size_t count;
+                /*!< Number of blocks in the map. */
+        DxfStringPool *string_pool;
+                /*!< String pool holding the block names (not
+                 * owned). */
+} DxfBlockMap;
+
+
 DxfBlock *dxf_block_new ();
 DxfBlock *dxf_block_init (DxfBlock *block);
 DxfBlock *dxf_block_read (DxfFile *fp, DxfBlock *block);
@@ -158,8 +249,8 @@ char *dxf_block_get_block_name_additional (DxfBlock *block);
 DxfBlock *dxf_block_set_block_name_additional (DxfBlock *block, char *block_name_additional);
 char *dxf_block_get_description (DxfBlock *block);
 DxfBlock *dxf_block_set_description (DxfBlock *block, char *description);
-int dxf_block_get_id_code (DxfBlock *block);
-DxfBlock *dxf_block_set_id_code (DxfBlock *block, int id_code);
+uint64_t dxf_block_get_id_code (DxfBlock *block);
+DxfBlock *dxf_block_set_id_code (DxfBlock *block, uint64_t id_code);
 char *dxf_block_get_layer (DxfBlock *block);
 DxfBlock *dxf_block_set_layer (DxfBlock *block, char *layer);
 DxfPoint *dxf_block_get_p0 (DxfBlock *block);
@@ -186,13 +277,28 @@ double dxf_block_get_extr_z0 (DxfBlock *block);
 DxfBlock *dxf_block_set_extr_z0 (DxfBlock *block, double extr_z0);
 DxfPoint *dxf_block_get_extrusion_vector_as_point (DxfBlock *block);
 DxfBlock *dxf_block_set_extrusion_vector (DxfBlock *block, double extr_x0, double extr_y0, double extr_z0);
-char *dxf_block_get_object_owner_soft (DxfBlock *block);
-DxfBlock *dxf_block_set_object_owner_soft (DxfBlock *block, char *object_owner_soft);
+uint64_t dxf_block_get_object_owner_soft (DxfBlock *block);
+DxfBlock *dxf_block_set_object_owner_soft (DxfBlock *block, uint64_t object_owner_soft);
 struct DxfEndblk *dxf_block_get_endblk (DxfBlock *block);
 DxfBlock *dxf_block_set_endblk (DxfBlock *block, struct DxfEndblk *endblk);
 DxfBlock *dxf_block_get_next (DxfBlock *block);
 DxfBlock *dxf_block_set_next (DxfBlock *block, DxfBlock *next);
 DxfBlock *dxf_block_get_last (DxfBlock *block);
+struct dxf_entities_struct *dxf_block_get_entities (DxfBlock *block);
+DxfBlock *dxf_block_set_entities (DxfBlock *block, struct dxf_entities_struct *entities);
+int dxf_block_get_bbox (DxfBlock *block, DxfBbox *bbox);
+DxfBlockEntity *dxf_block_get_entity_list (DxfBlock *block, size_t *number_of_entities);
+struct dxf_spatial_index_tree_struct *dxf_block_get_spatial_index (DxfBlock *block);
+int dxf_block_free_caches (DxfBlock *block);
+int dxf_block_read_table (DxfFile *fp, DxfBlock **blocks_list);
+DxfBlockMap *dxf_block_map_new (DxfStringPool *string_pool);
+int dxf_block_map_free (DxfBlockMap *map);
+int dxf_block_map_add (DxfBlockMap *map, DxfBlock *block);
+int dxf_block_map_add_list (DxfBlockMap *map, DxfBlock *blocks);
+DxfBlock *dxf_block_map_lookup (DxfBlockMap *map, const char *block_name);
+size_t dxf_block_map_get_count (DxfBlockMap *map);
+int dxf_block_map_resolve_inserts (DxfBlockMap *map, DxfInsert *inserts);
+int dxf_block_map_resolve (DxfBlockMap *map);
 
 
 #ifdef __cplusplus
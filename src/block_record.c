@@ -43,6 +43,7 @@
 
 
 #include "block_record.h"
+#include "util.h"
 
 
 /*!
@@ -62,7 +63,7 @@ dxf_block_record_new ()
         size = sizeof (DxfBlockRecord);
         /* avoid malloc of 0 bytes */
         if (size == 0) size = 1;
-        if ((block_record = malloc (size)) == NULL)
+        if ((block_record = dxf_malloc (size)) == NULL)
         {
                 fprintf (stderr,
                   (_("Error in %s () could not allocate memory.\n")),
@@ -113,17 +114,17 @@ dxf_block_record_init
                 return (NULL);
         }
         /* Assign initial values to members. */
-        block_record->id_code = 0;
-        block_record->block_name = strdup ("");
+        block_record->id_code = DXF_HANDLE_NONE;
+        block_record->block_name = dxf_strdup ("");
         block_record->flag = 0;
         block_record->insert_units = 0;
         block_record->explodability = 0;
         block_record->scalability = 0;
-        block_record->dictionary_owner_soft = strdup ("");
-        block_record->object_owner_soft = strdup ("");
-        block_record->dictionary_owner_hard = strdup ("");
-        block_record->xdata_string_data = strdup ("DesignCenter Data");
-        block_record->xdata_application_name = strdup ("ACAD");
+        block_record->dictionary_owner_soft = 0;
+        block_record->object_owner_soft = 0;
+        block_record->dictionary_owner_hard = 0;
+        block_record->xdata_string_data = dxf_strdup ("DesignCenter Data");
+        block_record->xdata_application_name = dxf_strdup ("ACAD");
         block_record->design_center_version_number = 0;
         block_record->insert_units = 0;
         /* Initialize new structs for the following members later,
@@ -161,7 +162,8 @@ dxf_block_record_read
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        char *temp_string = NULL;
+        char temp_string[DXF_MAX_STRING_LENGTH];
+        int group_code;
         DxfBinaryData *iter310 = NULL;
         int iter330;
 
@@ -171,8 +173,6 @@ dxf_block_record_read
                 fprintf (stderr,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
-                /* Clean up. */
-                free (temp_string);
                 return (NULL);
         }
         if (block_record == NULL)
@@ -200,140 +200,111 @@ dxf_block_record_read
         }
         iter310 = (DxfBinaryData *) block_record->binary_graphics_data;
         iter330 = 0;
-        (fp->line_number)++;
-        fscanf (fp->fp, "%[^\n]", temp_string);
-        while (strcmp (temp_string, "0") != 0)
+        while ((dxf_read_group_code (fp, &group_code) == EXIT_SUCCESS)
+          && (group_code != 0))
         {
-                if (ferror (fp->fp))
+                if (dxf_read_error (fp))
                 {
                         fprintf (stderr,
                           (_("Error in %s () while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
-                        fclose (fp->fp);
-                        /* Clean up. */
-                        free (temp_string);
                         return (NULL);
                 }
-                if (strcmp (temp_string, "5") == 0)
-                {
-                        /* Now follows a string containing a sequential
-                         * id number. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%x\n", (uint *) &block_record->id_code);
-                }
-                else if (strcmp (temp_string, "2") == 0)
-                {
-                        /* Now follows a string containing an application
-                         * name. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, block_record->block_name);
-                }
-/*! \todo Implement Group Code = 70 in a proper way. */
-                else if (strcmp (temp_string, "70") == 0)
-                {
-                        /* Now follows a string containing the
-                         * standard flag value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%hd\n", &block_record->flag);
-                }
-                else if (strcmp (temp_string, "280") == 0)
-                {
-                        /* Now follows a string containing the block
-                         * explodability value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%hd\n", &block_record->explodability);
-                }
-                else if (strcmp (temp_string, "281") == 0)
-                {
-                        /* Now follows a string containing the block
-                         * scalability value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%hd\n", &block_record->scalability);
-                }
-                else if (strcmp (temp_string, "310") == 0)
-                {
-                        /* Now follows a string containing binary
-                         * graphics data. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, iter310->data_line);
-                        dxf_binary_data_init ((DxfBinaryData *) iter310->next);
-                        iter310 = (DxfBinaryData *) iter310->next;
-                }
-                else if (strcmp (temp_string, "330") == 0)
+                switch (group_code)
                 {
-                        if (iter330 == 0)
-                        {
-                                /* Now follows a string containing a soft-pointer
+                        case 5:
+                                /* Now follows a string containing a sequential
+                                 * id number. */
+                                dxf_read_handle (fp, &block_record->id_code);
+                                break;
+                        case 2:
+                                /* Now follows a string containing an application
+                                 * name. */
+                                dxf_read_string (fp, &block_record->block_name);
+                                break;
+                        case 70:
+                                /*! \todo Implement Group Code = 70 in a proper way. */
+                                /* Now follows a string containing the
+                                 * standard flag value. */
+                                dxf_read_int16 (fp, &block_record->flag);
+                                break;
+                        case 280:
+                                /* Now follows a string containing the block
+                                 * explodability value. */
+                                dxf_read_int16 (fp, &block_record->explodability);
+                                break;
+                        case 281:
+                                /* Now follows a string containing the block
+                                 * scalability value. */
+                                dxf_read_int16 (fp, &block_record->scalability);
+                                break;
+                        case 310:
+                                /* Now follows a string containing binary
+                                 * graphics data. */
+                                iter310 = dxf_binary_data_read (fp, iter310);
+                                break;
+                        case 330:
+                                if (iter330 == 0)
+                                {
+                                        /* Now follows a string containing a soft-pointer
+                                         * ID/handle to owner dictionary. */
+                                        dxf_read_handle (fp, &block_record->dictionary_owner_soft);
+                                }
+                                if (iter330 == 1)
+                                {
+                                        /* Now follows a string containing a soft-pointer
+                                         * ID/handle to owner object. */
+                                        dxf_read_handle (fp, &block_record->object_owner_soft);
+                                }
+                                iter330++;
+                                break;
+                        case 340:
+                                /* Now follows a string containing Hard-pointer
+                                 * ID/handle to associated LAYOUT object. */
+                                dxf_read_string (fp, &block_record->associated_layout_hard);
+                                break;
+                        case 360:
+                                /* Now follows a string containing Hard owner
                                  * ID/handle to owner dictionary. */
-                                (fp->line_number)++;
-                                fscanf (fp->fp, DXF_MAX_STRING_FORMAT, block_record->dictionary_owner_soft);
-                        }
-                        if (iter330 == 1)
-                        {
-                                /* Now follows a string containing a soft-pointer
-                                 * ID/handle to owner object. */
-                                (fp->line_number)++;
-                                fscanf (fp->fp, DXF_MAX_STRING_FORMAT, block_record->object_owner_soft);
-                        }
-                        iter330++;
-                }
-                else if (strcmp (temp_string, "340") == 0)
-                {
-                        /* Now follows a string containing Hard-pointer
-                         * ID/handle to associated LAYOUT object. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, block_record->associated_layout_hard);
-                }
-                else if (strcmp (temp_string, "360") == 0)
-                {
-                        /* Now follows a string containing Hard owner
-                         * ID/handle to owner dictionary. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, block_record->dictionary_owner_hard);
-                }
-                else if (strcmp (temp_string, "999") == 0)
-                {
-                        /* Now follows a string containing a comment. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
-                        fprintf (stdout, "DXF comment: %s\n", temp_string);
-                }
-                else if (strcmp (temp_string, "1000") == 0)
-                {
-                        /* Now follows a string containing the Xdata
-                         * string data. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, block_record->xdata_string_data);
-                        if (strcmp (block_record->xdata_string_data, "DesignCenter Data") != 0)
-                        {
+                                dxf_read_handle (fp, &block_record->dictionary_owner_hard);
+                                break;
+                        case 999:
+                                /* Now follows a string containing a comment. */
+                                dxf_read_line (temp_string, fp);
+                                fprintf (stdout, "DXF comment: %s\n", temp_string);
+                                break;
+                        case 1000:
+                                /* Now follows a string containing the Xdata
+                                 * string data. */
+                                dxf_read_string (fp, &block_record->xdata_string_data);
+                                if (strcmp (block_record->xdata_string_data, "DesignCenter Data") != 0)
+                                {
+                                        fprintf (stderr,
+                                          (_("Warning in %s () unfamiliar string found while reading from: %s in line: %d.\n")),
+                                          __FUNCTION__, fp->filename, fp->line_number);
+                                }
+                                break;
+                        case 1001:
+                                /* Now follows a string containing the Xdata
+                                 * application name. */
+                                dxf_read_string (fp, &block_record->xdata_application_name);
+                                if (strcmp (block_record->xdata_application_name, "ACAD") != 0)
+                                {
+                                        fprintf (stderr,
+                                          (_("Warning in %s () unfamiliar string found while reading from: %s in line: %d.\n")),
+                                          __FUNCTION__, fp->filename, fp->line_number);
+                                }
+                                break;
+                        default:
+                                /*! \todo Implement Group Code = 1070 in a proper way. */
                                 fprintf (stderr,
-                                  (_("Warning in %s () unfamiliar string found while reading from: %s in line: %d.\n")),
+                                  (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
                                   __FUNCTION__, fp->filename, fp->line_number);
-                        }
-                }
-                else if (strcmp (temp_string, "1001") == 0)
-                {
-                        /* Now follows a string containing the Xdata
-                         * application name. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, block_record->xdata_application_name);
-                        if (strcmp (block_record->xdata_application_name, "ACAD") != 0)
-                        {
-                                fprintf (stderr,
-                                  (_("Warning in %s () unfamiliar string found while reading from: %s in line: %d.\n")),
-                                  __FUNCTION__, fp->filename, fp->line_number);
-                        }
-                }
-/*! \todo Implement Group Code = 1070 in a proper way. */
-                else
-                {
-                        fprintf (stderr,
-                          (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
-                          __FUNCTION__, fp->filename, fp->line_number);
+                                /* Skip the value of the unknown group code. */
+                                dxf_read_line (temp_string, fp);
+                                break;
                 }
         }
-        /* Clean up. */
-        free (temp_string);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -357,7 +328,7 @@ dxf_block_record_write
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        char *dxf_entity_name = strdup ("BLOCK_RECORD");
+        char *dxf_entity_name = dxf_strdup ("BLOCK_RECORD");
 
         /* Do some basic checks. */
         if (fp == NULL)
@@ -366,7 +337,7 @@ dxf_block_record_write
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (fp->acad_version_number < AutoCAD_13)
@@ -375,7 +346,7 @@ dxf_block_record_write
                   (_("Error in %s () illegal DXF version for this entity.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (block_record == NULL)
@@ -384,27 +355,27 @@ dxf_block_record_write
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if ((block_record->block_name == NULL)
           || (strcmp (block_record->block_name, "") == 0))
         {
                 fprintf (stderr,
-                  (_("Error in %s empty block name string for the %s entity with id-code: %x\n")),
+                  (_("Error in %s empty block name string for the %s entity with id-code: %" PRIx64 "\n")),
                   __FUNCTION__, dxf_entity_name, block_record->id_code);
                 fprintf (stderr,
                   (_("\t%s entity is discarded from output.\n")),
                   dxf_entity_name);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         /* Start writing output. */
-        fprintf (fp->fp, "  0\n%s\n", dxf_entity_name);
-        if (block_record->id_code != -1)
+        dxf_write_string (fp, 0, dxf_entity_name);
+        if (block_record->id_code != DXF_HANDLE_NONE)
         {
-                fprintf (fp->fp, "  5\n%x\n", block_record->id_code);
+                dxf_write_hex (fp, 5, block_record->id_code);
         }
         /*!
          * \todo for version R14.\n
@@ -416,40 +387,40 @@ dxf_block_record_write
          * 102 groups are application defined (optional).\n\n
          * End of group, "}" (optional), with Group code 102.
          */
-        if ((strcmp (block_record->dictionary_owner_soft, "") != 0)
+        if ((block_record->dictionary_owner_soft != 0)
           && (fp->acad_version_number >= AutoCAD_14))
         {
-                fprintf (fp->fp, "102\n{ACAD_REACTORS\n");
-                fprintf (fp->fp, "330\n%s\n", block_record->dictionary_owner_soft);
-                fprintf (fp->fp, "102\n}\n");
+                dxf_write_string (fp, 102, "{ACAD_REACTORS");
+                dxf_write_hex (fp, 330, block_record->dictionary_owner_soft);
+                dxf_write_string (fp, 102, "}");
         }
-        if ((strcmp (block_record->dictionary_owner_hard, "") != 0)
+        if ((block_record->dictionary_owner_hard != 0)
           && (fp->acad_version_number >= AutoCAD_14))
         {
-                fprintf (fp->fp, "102\n{ACAD_XDICTIONARY\n");
-                fprintf (fp->fp, "360\n%s\n", block_record->dictionary_owner_hard);
-                fprintf (fp->fp, "102\n}\n");
+                dxf_write_string (fp, 102, "{ACAD_XDICTIONARY");
+                dxf_write_hex (fp, 360, block_record->dictionary_owner_hard);
+                dxf_write_string (fp, 102, "}");
         }
-        if ((strcmp (block_record->object_owner_soft, "") != 0)
+        if ((block_record->object_owner_soft != 0)
           && (fp->acad_version_number >= AutoCAD_14))
         {
-                fprintf (fp->fp, "330\n%s\n", block_record->object_owner_soft);
+                dxf_write_hex (fp, 330, block_record->object_owner_soft);
         }
         if (fp->acad_version_number >= AutoCAD_13)
         {
-                fprintf (fp->fp, "100\nAcDbSymbolTableRecord\n");
-                fprintf (fp->fp, "100\nAcDbRegAppTableRecord\n");
+                dxf_write_string (fp, 100, "AcDbSymbolTableRecord");
+                dxf_write_string (fp, 100, "AcDbRegAppTableRecord");
         }
-        fprintf (fp->fp, "  2\n%s\n", block_record->block_name);
-        fprintf (fp->fp, " 70\n%hd\n", block_record->flag);
+        dxf_write_string (fp, 2, block_record->block_name);
+        dxf_write_int (fp, 70, block_record->flag);
         if (fp->acad_version_number >= AutoCAD_2000)
         {
-                fprintf (fp->fp, "340\n%s\n", block_record->associated_layout_hard);
+                dxf_write_string (fp, 340, block_record->associated_layout_hard);
         }
         if (fp->acad_version_number >= AutoCAD_2007)
         {
-                fprintf (fp->fp, "280\n%hd\n", block_record->explodability);
-                fprintf (fp->fp, "281\n%hd\n", block_record->scalability);
+                dxf_write_int (fp, 280, block_record->explodability);
+                dxf_write_int (fp, 281, block_record->scalability);
         }
         if (fp->acad_version_number >= AutoCAD_2000)
         {
@@ -459,25 +430,25 @@ dxf_block_record_write
                         iter = (DxfBinaryData *) block_record->binary_graphics_data;
                         while (iter != NULL)
                         {
-                                fprintf (fp->fp, "310\n%s\n", iter->data_line);
+                                dxf_binary_data_write (fp, iter);
                                 iter = (DxfBinaryData *) iter->next;
                         }
                 }
                 if (block_record->xdata_application_name != NULL)
                 {
-                        fprintf (fp->fp, "1001\n%s\n", block_record->xdata_application_name);
+                        dxf_write_string (fp, 1001, block_record->xdata_application_name);
                 }
                 if (block_record->xdata_string_data != NULL)
                 {
-                        fprintf (fp->fp, "1000\n%s\n", block_record->xdata_string_data);
-                        fprintf (fp->fp, "1002\n{\n");
-                        fprintf (fp->fp, "1070\n%hd\n", block_record->design_center_version_number);
-                        fprintf (fp->fp, "1070\n%hd\n", block_record->insert_units);
-                        fprintf (fp->fp, "1002\n}\n");
+                        dxf_write_string (fp, 1000, block_record->xdata_string_data);
+                        dxf_write_string (fp, 1002, "{");
+                        dxf_write_int (fp, 1070, block_record->design_center_version_number);
+                        dxf_write_int (fp, 1070, block_record->insert_units);
+                        dxf_write_string (fp, 1002, "}");
                 }
         }
         /* Clean up. */
-        free (dxf_entity_name);
+        dxf_free (dxf_entity_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -516,11 +487,9 @@ dxf_block_record_free
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        free (block_record->block_name);
+        dxf_free (block_record->block_name);
         dxf_binary_data_free_list (block_record->binary_graphics_data);
-        free (block_record->dictionary_owner_soft);
-        free (block_record->dictionary_owner_hard);
-        free (block_record);
+        dxf_free (block_record);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -566,7 +535,7 @@ dxf_block_record_free_list
  *
  * \return ID code.
  */
-int
+uint64_t
 dxf_block_record_get_id_code
 (
         DxfBlockRecord *block_record
@@ -585,12 +554,6 @@ dxf_block_record_get_id_code
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (block_record->id_code < 0)
-        {
-                fprintf (stderr,
-                  (_("Warning in %s () a negative value was found.\n")),
-                  __FUNCTION__);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -607,7 +570,7 @@ dxf_block_record_set_id_code
         DxfBlockRecord *block_record,
                 /*!< a pointer to a DXF \c BLOCK_RECORD symbol table
                  * entry. */
-        int id_code
+        uint64_t id_code
                 /*!< Identification number for the entity.\n
                  * This is to be an unique (sequential) number in the DXF
                  * file. */
@@ -624,12 +587,6 @@ dxf_block_record_set_id_code
                   __FUNCTION__);
                 return (NULL);
         }
-        if (id_code < 0)
-        {
-                fprintf (stderr,
-                  (_("Warning in %s () a negative value was passed.\n")),
-                  __FUNCTION__);
-        }
         block_record->id_code = id_code;
 #if DEBUG
         DXF_DEBUG_END
@@ -673,7 +630,7 @@ dxf_block_record_get_block_name
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (block_record->block_name));
+        return (dxf_strdup (block_record->block_name));
 }
 
 
@@ -710,7 +667,7 @@ dxf_block_record_set_block_name
                   __FUNCTION__);
                 return (NULL);
         }
-        block_record->block_name= strdup (block_name);
+        block_record->block_name= dxf_strdup (block_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1268,10 +1225,8 @@ dxf_block_record_set_binary_graphics_data
  * \c BLOCK_RECORD symbol table entry.
  *
  * \return soft pointer to the dictionary owner.
- *
- * \warning No checks are performed on the returned pointer (string).
  */
-char *
+uint64_t
 dxf_block_record_get_dictionary_owner_soft
 (
         DxfBlockRecord *block_record
@@ -1288,19 +1243,12 @@ dxf_block_record_get_dictionary_owner_soft
                 fprintf (stderr,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
-                return (NULL);
-        }
-        if (block_record->dictionary_owner_soft ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
+                return (0);
         }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (block_record->dictionary_owner_soft));
+        return (block_record->dictionary_owner_soft);
 }
 
 
@@ -1314,8 +1262,8 @@ dxf_block_record_set_dictionary_owner_soft
         DxfBlockRecord *block_record,
                 /*!< a pointer to a DXF \c BLOCK_RECORD symbol table
                  * entry. */
-        char *dictionary_owner_soft
-                /*!< a string containing the pointer to the
+        uint64_t dictionary_owner_soft
+                /*!< the handle of the
                  * dictionary_owner_soft for the entity. */
 )
 {
@@ -1330,14 +1278,7 @@ dxf_block_record_set_dictionary_owner_soft
                   __FUNCTION__);
                 return (NULL);
         }
-        if (dictionary_owner_soft == NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was passed.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
-        block_record->dictionary_owner_soft = strdup (dictionary_owner_soft);
+        block_record->dictionary_owner_soft = dictionary_owner_soft;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1350,10 +1291,8 @@ dxf_block_record_set_dictionary_owner_soft
  * \c BLOCK_RECORD symbol table entry.
  *
  * \return soft pointer to the object owner.
- *
- * \warning No checks are performed on the returned pointer (string).
  */
-char *
+uint64_t
 dxf_block_record_get_object_owner_soft
 (
         DxfBlockRecord *block_record
@@ -1370,19 +1309,12 @@ dxf_block_record_get_object_owner_soft
                 fprintf (stderr,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
-                return (NULL);
-        }
-        if (block_record->object_owner_soft ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
+                return (0);
         }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (block_record->object_owner_soft));
+        return (block_record->object_owner_soft);
 }
 
 
@@ -1396,8 +1328,8 @@ dxf_block_record_set_object_owner_soft
         DxfBlockRecord *block_record,
                 /*!< a pointer to a DXF \c BLOCK_RECORD symbol table
                  * entry. */
-        char *object_owner_soft
-                /*!< a string containing the pointer to the
+        uint64_t object_owner_soft
+                /*!< the handle of the
                  * \c object_owner_soft for the entity. */
 )
 {
@@ -1412,14 +1344,7 @@ dxf_block_record_set_object_owner_soft
                   __FUNCTION__);
                 return (NULL);
         }
-        if (object_owner_soft == NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was passed.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
-        block_record->object_owner_soft = strdup (object_owner_soft);
+        block_record->object_owner_soft = object_owner_soft;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1464,7 +1389,7 @@ dxf_block_record_get_associated_layout_hard
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (block_record->associated_layout_hard));
+        return (dxf_strdup (block_record->associated_layout_hard));
 }
 
 
@@ -1473,10 +1398,8 @@ dxf_block_record_get_associated_layout_hard
  * \c BLOCK_RECORD symbol table entry.
  *
  * \return hard pointer to the dictionary owner.
- *
- * \warning No checks are performed on the returned pointer (string).
  */
-char *
+uint64_t
 dxf_block_record_get_dictionary_owner_hard
 (
         DxfBlockRecord *block_record
@@ -1493,19 +1416,12 @@ dxf_block_record_get_dictionary_owner_hard
                 fprintf (stderr,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
-                return (NULL);
-        }
-        if (block_record->dictionary_owner_hard ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
+                return (0);
         }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (block_record->dictionary_owner_hard));
+        return (block_record->dictionary_owner_hard);
 }
 
 
@@ -1519,8 +1435,8 @@ dxf_block_record_set_dictionary_owner_hard
         DxfBlockRecord *block_record,
                 /*!< a pointer to a DXF \c BLOCK_RECORD symbol table
                  * entry. */
-        char *dictionary_owner_hard
-                /*!< a string containing the pointer to the
+        uint64_t dictionary_owner_hard
+                /*!< the handle of the
                  * dictionary_owner_hard for the symbol table entry. */
 )
 {
@@ -1535,14 +1451,7 @@ dxf_block_record_set_dictionary_owner_hard
                   __FUNCTION__);
                 return (NULL);
         }
-        if (dictionary_owner_hard == NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was passed.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
-        block_record->dictionary_owner_hard = strdup (dictionary_owner_hard);
+        block_record->dictionary_owner_hard = dictionary_owner_hard;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1587,7 +1496,7 @@ dxf_block_record_get_xdata_string_data
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (block_record->xdata_string_data));
+        return (dxf_strdup (block_record->xdata_string_data));
 }
 
 
@@ -1624,7 +1533,7 @@ dxf_block_record_set_xdata_string_data
                   __FUNCTION__);
                 return (NULL);
         }
-        block_record->xdata_string_data = strdup (xdata_string_data);
+        block_record->xdata_string_data = dxf_strdup (xdata_string_data);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1669,7 +1578,7 @@ dxf_block_record_get_xdata_application_name
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (block_record->xdata_application_name));
+        return (dxf_strdup (block_record->xdata_application_name));
 }
 
 
@@ -1706,7 +1615,7 @@ dxf_block_record_set_xdata_application_name
                   __FUNCTION__);
                 return (NULL);
         }
-        block_record->xdata_application_name = strdup (xdata_application_name);
+        block_record->xdata_application_name = dxf_strdup (xdata_application_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
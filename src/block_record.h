@@ -65,7 +65,7 @@ extern "C" {
 typedef struct
 dxf_block_record_struct
 {
-        int id_code;
+        uint64_t id_code;
                 /*!< Identification number for the entity.\n
                  * This is to be an unique (sequential) number in the DXF
                  * file.\n
@@ -104,17 +104,17 @@ dxf_block_record_struct
                  * (optional).\n
                  * Group code = 310.\n
                  * \since Introduced in version R2000. */
-        char *dictionary_owner_soft;
+        uint64_t dictionary_owner_soft;
                 /*!< Soft-pointer ID/handle to owner dictionary
                  * (optional).\n
                  * Group code = 330. */
-        char *object_owner_soft;
+        uint64_t object_owner_soft;
                 /*!< Soft-pointer ID/handle to owner object (optional).\n
                  * Group code = 330. */
         char *associated_layout_hard;
                 /*!< Hard-pointer ID/handle to associated LAYOUT object.\n
                  * Group code = 340. */
-        char *dictionary_owner_hard;
+        uint64_t dictionary_owner_hard;
                 /*!< Hard owner ID/handle to owner dictionary
                  * (optional).\n
                  * Group code = 360. */
@@ -165,8 +165,8 @@ DxfBlockRecord *dxf_block_record_read (DxfFile *fp, DxfBlockRecord *block_record
 int dxf_block_record_write (DxfFile *fp, DxfBlockRecord *block_record);
 int dxf_block_record_free (DxfBlockRecord *block_record);
 void dxf_block_record_free_list (DxfBlockRecord *block_records);
-int dxf_block_record_get_id_code (DxfBlockRecord *block_record);
-DxfBlockRecord *dxf_block_record_set_id_code (DxfBlockRecord *block_record, int id_code);
+uint64_t dxf_block_record_get_id_code (DxfBlockRecord *block_record);
+DxfBlockRecord *dxf_block_record_set_id_code (DxfBlockRecord *block_record, uint64_t id_code);
 char *dxf_block_record_get_block_name (DxfBlockRecord *block_record);
 DxfBlockRecord *dxf_block_record_set_block_name (DxfBlockRecord *block_record, char *block_name);
 int16_t dxf_block_record_get_flag (DxfBlockRecord *block_record);
@@ -182,13 +182,13 @@ int16_t dxf_block_record_get_scalability (DxfBlockRecord *block_record);
 DxfBlockRecord *dxf_block_record_set_scalability (DxfBlockRecord *block_record, int16_t scalability);
 DxfBinaryData *dxf_block_record_get_binary_graphics_data (DxfBlockRecord *block_record);
 DxfBlockRecord *dxf_block_record_set_binary_graphics_data (DxfBlockRecord *block_record, DxfBinaryData *data);
-char *dxf_block_record_get_dictionary_owner_soft (DxfBlockRecord *block_record);
-DxfBlockRecord *dxf_block_record_set_dictionary_owner_soft (DxfBlockRecord *block_record, char *dictionary_owner_soft);
-char *dxf_block_record_get_object_owner_soft (DxfBlockRecord *block_record);
-DxfBlockRecord *dxf_block_record_set_object_owner_soft (DxfBlockRecord *block_record, char *object_owner_soft);
+uint64_t dxf_block_record_get_dictionary_owner_soft (DxfBlockRecord *block_record);
+DxfBlockRecord *dxf_block_record_set_dictionary_owner_soft (DxfBlockRecord *block_record, uint64_t dictionary_owner_soft);
+uint64_t dxf_block_record_get_object_owner_soft (DxfBlockRecord *block_record);
+DxfBlockRecord *dxf_block_record_set_object_owner_soft (DxfBlockRecord *block_record, uint64_t object_owner_soft);
 char *dxf_block_record_get_associated_layout_hard (DxfBlockRecord *block_record);
-char *dxf_block_record_get_dictionary_owner_hard (DxfBlockRecord *block_record);
-DxfBlockRecord *dxf_block_record_set_dictionary_owner_hard (DxfBlockRecord *block_record, char *dictionary_owner_hard);
+uint64_t dxf_block_record_get_dictionary_owner_hard (DxfBlockRecord *block_record);
+DxfBlockRecord *dxf_block_record_set_dictionary_owner_hard (DxfBlockRecord *block_record, uint64_t dictionary_owner_hard);
 char *dxf_block_record_get_xdata_string_data (DxfBlockRecord *block_record);
 DxfBlockRecord *dxf_block_record_set_xdata_string_data (DxfBlockRecord *block_record, char *xdata_string_data);
 char *dxf_block_record_get_xdata_application_name (DxfBlockRecord *block_record);
@@ -42,6 +42,7 @@
 
 
 #include "body.h"
+#include "util.h"
 
 
 /*!
@@ -61,7 +62,7 @@ dxf_body_new ()
         size = sizeof (DxfBody);
         /* avoid malloc of 0 bytes */
         if (size == 0) size = 1;
-        if ((body = malloc (size)) == NULL)
+        if ((body = dxf_malloc (size)) == NULL)
         {
                 fprintf (stderr,
                   (_("Error in %s () could not allocate memory.\n")),
@@ -112,9 +113,9 @@ dxf_body_init
                 return (NULL);
         }
         /* Assign initial values to members. */
-        body->id_code = 0;
-        body->linetype = strdup (DXF_DEFAULT_LINETYPE);
-        body->layer = strdup (DXF_DEFAULT_LAYER);
+        body->id_code = DXF_HANDLE_NONE;
+        body->linetype = dxf_strdup (DXF_DEFAULT_LINETYPE);
+        body->layer = dxf_strdup (DXF_DEFAULT_LAYER);
         body->elevation = 0.0;
         body->thickness = 0.0;
         body->linetype_scale = DXF_DEFAULT_LINETYPE_SCALE;
@@ -123,13 +124,13 @@ dxf_body_init
         body->paperspace = DXF_MODELSPACE;
         body->graphics_data_size = 0;
         body->shadow_mode = 0;
-        body->dictionary_owner_soft = strdup ("");
-        body->object_owner_soft = strdup ("");
-        body->material = strdup ("");
-        body->dictionary_owner_hard = strdup ("");
-        body->plot_style_name = strdup ("");
+        body->dictionary_owner_soft = 0;
+        body->object_owner_soft = 0;
+        body->material = 0;
+        body->dictionary_owner_hard = 0;
+        body->plot_style_name = 0;
         body->color_value = 0;
-        body->color_name = strdup ("");
+        body->color_name = dxf_strdup ("");
         body->transparency = 0;
         body->modeler_format_version_number = 1;
         /* Initialize new structs for members. */
@@ -167,7 +168,8 @@ dxf_body_read
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        char *temp_string = NULL;
+        char temp_string[DXF_MAX_STRING_LENGTH];
+        int group_code;
         int i;
         DxfBinaryData *iter310 = NULL;
         int iter330;
@@ -178,8 +180,6 @@ dxf_body_read
                 fprintf (stderr,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
-                /* Clean up. */
-                free (temp_string);
                 return (NULL);
         }
         if (body == NULL)
@@ -246,238 +246,214 @@ dxf_body_read
         i = 0;
         iter310 = (DxfBinaryData *) body->binary_graphics_data;
         iter330 = 0;
-        (fp->line_number)++;
-        fscanf (fp->fp, "%[^\n]", temp_string);
-        while (strcmp (temp_string, "0") != 0)
+        while ((dxf_read_group_code (fp, &group_code) == EXIT_SUCCESS)
+          && (group_code != 0))
         {
-                if (ferror (fp->fp))
+                if (dxf_read_error (fp))
                 {
                         fprintf (stderr,
                           (_("Error in %s () while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
-                        fclose (fp->fp);
-                        /* Clean up. */
-                        free (temp_string);
                         return (NULL);
                 }
-                else if (strcmp (temp_string, "  1") == 0)
-                {
-                        /* Now follows a string containing proprietary
-                         * data. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, body->proprietary_data->data_line);
-                        body->proprietary_data->order = i;
-                        i++;
-                        dxf_binary_data_init ((DxfBinaryData *) body->proprietary_data->next);
-                        body->proprietary_data = (DxfBinaryData *) body->proprietary_data->next;
-                }
-                else if (strcmp (temp_string, "  3") == 0)
-                {
-                        /* Now follows a string containing additional
-                         * proprietary data. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, body->additional_proprietary_data->data_line);
-                        body->additional_proprietary_data->order = i;
-                        i++;
-                        dxf_binary_data_init ((DxfBinaryData *) body->additional_proprietary_data->next);
-                        body->additional_proprietary_data = (DxfBinaryData *) body->additional_proprietary_data->next;
-                }
-                if (strcmp (temp_string, "5") == 0)
-                {
-                        /* Now follows a string containing a sequential
-                         * id number. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%x\n", (uint *) &body->id_code);
-                }
-                else if (strcmp (temp_string, "6") == 0)
-                {
-                        /* Now follows a string containing a linetype
-                         * name. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, body->linetype);
-                }
-                else if (strcmp (temp_string, "8") == 0)
-                {
-                        /* Now follows a string containing a layer name. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, body->layer);
-                }
-                else if ((fp->acad_version_number <= AutoCAD_11)
-                  && DXF_FLATLAND
-                  && (strcmp (temp_string, "38") == 0))
-                {
-                        /* Now follows a string containing the
-                         * elevation. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &body->elevation);
-                }
-                else if (strcmp (temp_string, "39") == 0)
+                switch (group_code)
                 {
-                        /* Now follows a string containing the
-                         * thickness. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &body->thickness);
-                }
-                else if (strcmp (temp_string, "60") == 0)
-                {
-                        /* Now follows a string containing the
-                         * visibility value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%hd\n", &body->visibility);
-                }
-                else if (strcmp (temp_string, "62") == 0)
-                {
-                        /* Now follows a string containing the
-                         * color value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%hd\n", &body->color);
-                }
-                else if (strcmp (temp_string, "67") == 0)
-                {
-                        /* Now follows a string containing the
-                         * paperspace value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%hd\n", &body->paperspace);
-                }
-                else if ((fp->acad_version_number >= AutoCAD_13)
-                        && (strcmp (temp_string, "70") == 0))
-                {
-                        /* Now follows a string containing the modeler
-                         * format version number. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%hd\n", &body->modeler_format_version_number);
-                }
-                else if (strcmp (temp_string, "92") == 0)
-                {
-                        /* Now follows a string containing the
-                         * graphics data size value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%" PRIi32 "\n", &body->graphics_data_size);
-                }
-                else if ((fp->acad_version_number >= AutoCAD_13)
-                        && (strcmp (temp_string, "100") == 0))
-                {
-                        /* Now follows a string containing the
-                         * subclass marker value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
-                        if (strcmp (temp_string, "AcDbModelerGeometry") != 0)
-                        {
-                                fprintf (stderr, "Warning in dxf_body_read () found a bad subclass marker in: %s in line: %d.\n",
-                                        fp->filename, fp->line_number);
-                        }
-                }
-                else if (strcmp (temp_string, "160") == 0)
-                {
-                        /* Now follows a string containing the
-                         * graphics data size value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%d\n", &body->graphics_data_size);
-                }
-                else if (strcmp (temp_string, "284") == 0)
-                {
-                        /* Now follows a string containing the shadow
-                         * mode value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%hd\n", &body->shadow_mode);
-                }
-                else if (strcmp (temp_string, "310") == 0)
-                {
-                        /* Now follows a string containing binary
-                         * graphics data. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, iter310->data_line);
-                        dxf_binary_data_init ((DxfBinaryData *) iter310->next);
-                        iter310 = (DxfBinaryData *) iter310->next;
-                }
-                else if (strcmp (temp_string, "330") == 0)
-                {
-                        if (iter330 == 0)
-                        {
-                                /* Now follows a string containing a soft-pointer
+                        case 1:
+                                /* Now follows a string containing proprietary
+                                 * data. */
+                                dxf_read_string (fp, &body->proprietary_data->data_line);
+                                body->proprietary_data->order = i;
+                                i++;
+                                dxf_binary_data_init ((DxfBinaryData *) body->proprietary_data->next);
+                                body->proprietary_data = (DxfBinaryData *) body->proprietary_data->next;
+                                break;
+                        case 3:
+                                /* Now follows a string containing additional
+                                 * proprietary data. */
+                                dxf_read_string (fp, &body->additional_proprietary_data->data_line);
+                                body->additional_proprietary_data->order = i;
+                                i++;
+                                dxf_binary_data_init ((DxfBinaryData *) body->additional_proprietary_data->next);
+                                body->additional_proprietary_data = (DxfBinaryData *) body->additional_proprietary_data->next;
+                                break;
+                        case 5:
+                                /* Now follows a string containing a sequential
+                                 * id number. */
+                                dxf_read_handle (fp, &body->id_code);
+                                break;
+                        case 6:
+                                /* Now follows a string containing a linetype
+                                 * name. */
+                                dxf_read_string_interned (fp, &body->linetype);
+                                break;
+                        case 8:
+                                /* Now follows a string containing a layer name. */
+                                dxf_read_string_interned (fp, &body->layer);
+                                break;
+                        case 38:
+                                if ((fp->acad_version_number <= AutoCAD_11) && DXF_FLATLAND)
+                                {
+                                        /* Now follows a string containing the
+                                         * elevation. */
+                                        dxf_read_double (fp, &body->elevation);
+                                }
+                                else
+                                {
+                                        fprintf (stderr,
+                                          (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
+                                          __FUNCTION__, fp->filename, fp->line_number);
+                                        /* Skip the value of the unknown group code. */
+                                        dxf_read_line (temp_string, fp);
+                                }
+                                break;
+                        case 39:
+                                /* Now follows a string containing the
+                                 * thickness. */
+                                dxf_read_double (fp, &body->thickness);
+                                break;
+                        case 60:
+                                /* Now follows a string containing the
+                                 * visibility value. */
+                                dxf_read_int16 (fp, &body->visibility);
+                                break;
+                        case 62:
+                                /* Now follows a string containing the
+                                 * color value. */
+                                dxf_read_int16 (fp, &body->color);
+                                break;
+                        case 67:
+                                /* Now follows a string containing the
+                                 * paperspace value. */
+                                dxf_read_int16 (fp, &body->paperspace);
+                                break;
+                        case 70:
+                                if (fp->acad_version_number >= AutoCAD_13)
+                                {
+                                        /* Now follows a string containing the modeler
+                                         * format version number. */
+                                        dxf_read_int16 (fp, &body->modeler_format_version_number);
+                                }
+                                else
+                                {
+                                        fprintf (stderr,
+                                          (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
+                                          __FUNCTION__, fp->filename, fp->line_number);
+                                        /* Skip the value of the unknown group code. */
+                                        dxf_read_line (temp_string, fp);
+                                }
+                                break;
+                        case 92:
+                                /* Now follows a string containing the
+                                 * graphics data size value. */
+                                dxf_read_int32 (fp, &body->graphics_data_size);
+                                break;
+                        case 100:
+                                if (fp->acad_version_number >= AutoCAD_13)
+                                {
+                                        /* Now follows a string containing the
+                                         * subclass marker value. */
+                                        dxf_read_line (temp_string, fp);
+                                        if (strcmp (temp_string, "AcDbModelerGeometry") != 0)
+                                        {
+                                                fprintf (stderr, "Warning in dxf_body_read () found a bad subclass marker in: %s in line: %d.\n",
+                                                        fp->filename, fp->line_number);
+                                        }
+                                }
+                                else
+                                {
+                                        fprintf (stderr,
+                                          (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
+                                          __FUNCTION__, fp->filename, fp->line_number);
+                                        /* Skip the value of the unknown group code. */
+                                        dxf_read_line (temp_string, fp);
+                                }
+                                break;
+                        case 160:
+                                /* Now follows a string containing the
+                                 * graphics data size value. */
+                                dxf_read_int (fp, &body->graphics_data_size);
+                                break;
+                        case 284:
+                                /* Now follows a string containing the shadow
+                                 * mode value. */
+                                dxf_read_int16 (fp, &body->shadow_mode);
+                                break;
+                        case 310:
+                                /* Now follows a string containing binary
+                                 * graphics data. */
+                                iter310 = dxf_binary_data_read (fp, iter310);
+                                break;
+                        case 330:
+                                if (iter330 == 0)
+                                {
+                                        /* Now follows a string containing a soft-pointer
+                                         * ID/handle to owner dictionary. */
+                                        dxf_read_handle (fp, &body->dictionary_owner_soft);
+                                }
+                                if (iter330 == 1)
+                                {
+                                        /* Now follows a string containing a soft-pointer
+                                         * ID/handle to owner object. */
+                                        dxf_read_handle (fp, &body->object_owner_soft);
+                                }
+                                iter330++;
+                                break;
+                        case 347:
+                                /* Now follows a string containing a
+                                 * hard-pointer ID/handle to material object. */
+                                dxf_read_handle (fp, &body->material);
+                                break;
+                        case 360:
+                                /* Now follows a string containing Hard owner
                                  * ID/handle to owner dictionary. */
-                                (fp->line_number)++;
-                                fscanf (fp->fp, DXF_MAX_STRING_FORMAT, body->dictionary_owner_soft);
-                        }
-                        if (iter330 == 1)
-                        {
-                                /* Now follows a string containing a soft-pointer
-                                 * ID/handle to owner object. */
-                                (fp->line_number)++;
-                                fscanf (fp->fp, DXF_MAX_STRING_FORMAT, body->object_owner_soft);
-                        }
-                        iter330++;
-                }
-                else if (strcmp (temp_string, "347") == 0)
-                {
-                        /* Now follows a string containing a
-                         * hard-pointer ID/handle to material object. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, body->material);
-                }
-                else if (strcmp (temp_string, "360") == 0)
-                {
-                        /* Now follows a string containing Hard owner
-                         * ID/handle to owner dictionary. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, body->dictionary_owner_hard);
-                }
-                else if (strcmp (temp_string, "370") == 0)
-                {
-                        /* Now follows a string containing the lineweight
-                         * value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%hd\n", &body->lineweight);
-                }
-                else if (strcmp (temp_string, "390") == 0)
-                {
-                        /* Now follows a string containing a plot style
-                         * name value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, body->plot_style_name);
-                }
-                else if (strcmp (temp_string, "420") == 0)
-                {
-                        /* Now follows a string containing a color value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%" PRIi32 "\n", &body->color_value);
-                }
-                else if (strcmp (temp_string, "430") == 0)
-                {
-                        /* Now follows a string containing a color
-                         * name value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, body->color_name);
-                }
-                else if (strcmp (temp_string, "440") == 0)
-                {
-                        /* Now follows a string containing a transparency
-                         * value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%" PRIi32 "\n", &body->transparency);
-                }
-                else if (strcmp (temp_string, "999") == 0)
-                {
-                        /* Now follows a string containing a comment. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
-                        fprintf (stdout, "DXF comment: %s\n", temp_string);
-                }
-                else
-                {
-                        fprintf (stderr,
-                          (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
-                          __FUNCTION__, fp->filename, fp->line_number);
+                                dxf_read_handle (fp, &body->dictionary_owner_hard);
+                                break;
+                        case 370:
+                                /* Now follows a string containing the lineweight
+                                 * value. */
+                                dxf_read_int16 (fp, &body->lineweight);
+                                break;
+                        case 390:
+                                /* Now follows a string containing a plot style
+                                 * name value. */
+                                dxf_read_handle (fp, &body->plot_style_name);
+                                break;
+                        case 420:
+                                /* Now follows a string containing a color value. */
+                                dxf_read_int32 (fp, &body->color_value);
+                                break;
+                        case 430:
+                                /* Now follows a string containing a color
+                                 * name value. */
+                                dxf_read_string_interned (fp, &body->color_name);
+                                break;
+                        case 440:
+                                /* Now follows a string containing a transparency
+                                 * value. */
+                                dxf_read_int32 (fp, &body->transparency);
+                                break;
+                        case 999:
+                                /* Now follows a string containing a comment. */
+                                dxf_read_line (temp_string, fp);
+                                fprintf (stdout, "DXF comment: %s\n", temp_string);
+                                break;
+                        default:
+                                fprintf (stderr,
+                                  (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
+                                  __FUNCTION__, fp->filename, fp->line_number);
+                                /* Skip the value of the unknown group code. */
+                                dxf_read_line (temp_string, fp);
+                                break;
                 }
         }
         /* Handle omitted members and/or illegal values. */
         if (strcmp (body->linetype, "") == 0)
         {
-                body->linetype = strdup (DXF_DEFAULT_LINETYPE);
+                body->linetype = dxf_strdup (DXF_DEFAULT_LINETYPE);
         }
         if (strcmp (body->layer, "") == 0)
         {
-                body->layer = strdup (DXF_DEFAULT_LAYER);
+                body->layer = dxf_strdup (DXF_DEFAULT_LAYER);
         }
         if (body->modeler_format_version_number == 0)
         {
@@ -488,8 +464,6 @@ dxf_body_read
                   (_("\tmodeler format version number is reset to 1.\n")));
                 body->modeler_format_version_number = 1;
         }
-        /* Clean up. */
-        free (temp_string);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -515,7 +489,7 @@ dxf_body_write
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        char *dxf_entity_name = strdup ("BODY");
+        char *dxf_entity_name = dxf_strdup ("BODY");
         DxfProprietaryData *iter = NULL;
         DxfProprietaryData *additional_iter = NULL;
         int i;
@@ -527,7 +501,7 @@ dxf_body_write
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (body == NULL)
@@ -536,41 +510,41 @@ dxf_body_write
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (fp->acad_version_number < AutoCAD_13)
         {
                 fprintf (stderr,
-                  (_("Warning in %s () illegal DXF version for this %s entity with id-code: %x.\n")),
+                  (_("Warning in %s () illegal DXF version for this %s entity with id-code: %" PRIx64 ".\n")),
                   __FUNCTION__, dxf_entity_name, body->id_code);
         }
         if (strcmp (body->linetype, "") == 0)
         {
                 fprintf (stderr,
-                  (_("Warning in %s () empty linetype string for the %s entity with id-code: %x\n")),
+                  (_("Warning in %s () empty linetype string for the %s entity with id-code: %" PRIx64 "\n")),
                   __FUNCTION__, dxf_entity_name, body->id_code);
                 fprintf (stderr,
                   (_("\t%s entity is reset to default linetype")),
                   dxf_entity_name);
-                body->linetype = strdup (DXF_DEFAULT_LINETYPE);
+                body->linetype = dxf_strdup (DXF_DEFAULT_LINETYPE);
         }
         if (strcmp (body->layer, "") == 0)
         {
                 fprintf (stderr,
-                  (_("Warning in %s () empty layer string for the %s entity with id-code: %x\n")),
+                  (_("Warning in %s () empty layer string for the %s entity with id-code: %" PRIx64 "\n")),
                   __FUNCTION__, dxf_entity_name, body->id_code);
                 fprintf (stderr,
                   (_("\t%s entity is relocated to layer 0")),
                   dxf_entity_name);
-                body->layer = strdup (DXF_DEFAULT_LAYER);
+                body->layer = dxf_strdup (DXF_DEFAULT_LAYER);
         }
         /* Start writing output. */
         i = 1;
-        fprintf (fp->fp, "  0\n%s\n", dxf_entity_name);
-        if (body->id_code != -1)
+        dxf_write_string (fp, 0, dxf_entity_name);
+        if (body->id_code != DXF_HANDLE_NONE)
         {
-                fprintf (fp->fp, "  5\n%x\n", body->id_code);
+                dxf_write_hex (fp, 5, body->id_code);
         }
         /*!
          * \todo for version R14.\n
@@ -582,71 +556,71 @@ dxf_body_write
          * 102 groups are application defined (optional).\n\n
          * End of group, "}" (optional), with Group code 102.
          */
-        if ((strcmp (body->dictionary_owner_soft, "") != 0)
+        if ((body->dictionary_owner_soft != 0)
           && (fp->acad_version_number >= AutoCAD_14))
         {
-                fprintf (fp->fp, "102\n{ACAD_REACTORS\n");
-                fprintf (fp->fp, "330\n%s\n", body->dictionary_owner_soft);
-                fprintf (fp->fp, "102\n}\n");
+                dxf_write_string (fp, 102, "{ACAD_REACTORS");
+                dxf_write_hex (fp, 330, body->dictionary_owner_soft);
+                dxf_write_string (fp, 102, "}");
         }
-        if ((strcmp (body->dictionary_owner_hard, "") != 0)
+        if ((body->dictionary_owner_hard != 0)
           && (fp->acad_version_number >= AutoCAD_14))
         {
-                fprintf (fp->fp, "102\n{ACAD_XDICTIONARY\n");
-                fprintf (fp->fp, "360\n%s\n", body->dictionary_owner_hard);
-                fprintf (fp->fp, "102\n}\n");
+                dxf_write_string (fp, 102, "{ACAD_XDICTIONARY");
+                dxf_write_hex (fp, 360, body->dictionary_owner_hard);
+                dxf_write_string (fp, 102, "}");
         }
-        if ((strcmp (body->object_owner_soft, "") != 0)
+        if ((body->object_owner_soft != 0)
           && (fp->acad_version_number >= AutoCAD_2000))
         {
-                fprintf (fp->fp, "330\n%s\n", body->object_owner_soft);
+                dxf_write_hex (fp, 330, body->object_owner_soft);
         }
         if (fp->acad_version_number >= AutoCAD_13)
         {
-                fprintf (fp->fp, "100\nAcDbEntity\n");
+                dxf_write_string (fp, 100, "AcDbEntity");
         }
         if (body->paperspace == DXF_PAPERSPACE)
         {
-                fprintf (fp->fp, " 67\n%hd\n", (int16_t) DXF_PAPERSPACE);
+                dxf_write_int (fp, 67, (int16_t) DXF_PAPERSPACE);
         }
-        fprintf (fp->fp, "  8\n%s\n", body->layer);
+        dxf_write_string (fp, 8, body->layer);
         if (strcmp (body->linetype, DXF_DEFAULT_LINETYPE) != 0)
         {
-                fprintf (fp->fp, "  6\n%s\n", body->linetype);
+                dxf_write_string (fp, 6, body->linetype);
         }
         if ((fp->acad_version_number >= AutoCAD_2008)
-          && (strcmp (body->material, "") != 0))
+          && (body->material != 0))
         {
-                fprintf (fp->fp, "347\n%s\n", body->material);
+                dxf_write_hex (fp, 347, body->material);
         }
         if ((fp->acad_version_number <= AutoCAD_11)
           && DXF_FLATLAND
           && (body->elevation != 0.0))
         {
-                fprintf (fp->fp, " 38\n%f\n", body->elevation);
+                dxf_write_double (fp, 38, body->elevation);
         }
         if (body->thickness != 0.0)
         {
-                fprintf (fp->fp, " 39\n%f\n", body->thickness);
+                dxf_write_double (fp, 39, body->thickness);
         }
         if (body->linetype_scale != 1.0)
         {
-                fprintf (fp->fp, " 48\n%f\n", body->linetype_scale);
+                dxf_write_double (fp, 48, body->linetype_scale);
         }
         if (body->visibility != 0)
         {
-                fprintf (fp->fp, " 60\n%hd\n", body->visibility);
+                dxf_write_int (fp, 60, body->visibility);
         }
         if (body->color != DXF_COLOR_BYLAYER)
         {
-                fprintf (fp->fp, " 62\n%hd\n", body->color);
+                dxf_write_int (fp, 62, body->color);
         }
         if (fp->acad_version_number >= AutoCAD_2000)
         {
 #ifdef BUILD_64
-                fprintf (fp->fp, "160\n%" PRIi32 "\n", body->graphics_data_size);
+                dxf_write_int (fp, 160, body->graphics_data_size);
 #else
-                fprintf (fp->fp, " 92\n%" PRIi32 "\n", body->graphics_data_size);
+                dxf_write_int (fp, 92, body->graphics_data_size);
 #endif
                 if (body->binary_graphics_data != NULL)
                 {
@@ -654,29 +628,29 @@ dxf_body_write
                         iter = (DxfBinaryData *) body->binary_graphics_data;
                         while (iter != NULL)
                         {
-                                fprintf (fp->fp, "310\n%s\n", iter->data_line);
+                                dxf_binary_data_write (fp, iter);
                                 iter = (DxfBinaryData *) iter->next;
                         }
                 }
         }
         if (fp->acad_version_number >= AutoCAD_2004)
         {
-                fprintf (fp->fp, "420\n%" PRIi32 "\n", body->color_value);
-                fprintf (fp->fp, "430\n%s\n", body->color_name);
-                fprintf (fp->fp, "440\n%" PRIi32 "\n", body->transparency);
+                dxf_write_int (fp, 420, body->color_value);
+                dxf_write_string (fp, 430, body->color_name);
+                dxf_write_int (fp, 440, body->transparency);
         }
         if (fp->acad_version_number >= AutoCAD_2009)
         {
-                fprintf (fp->fp, "390\n%s\n", body->plot_style_name);
-                fprintf (fp->fp, "284\n%d\n", body->shadow_mode);
+                dxf_write_hex (fp, 390, body->plot_style_name);
+                dxf_write_int (fp, 284, body->shadow_mode);
         }
         if (fp->acad_version_number >= AutoCAD_13)
         {
-                fprintf (fp->fp, "100\nAcDbModelerGeometry\n");
+                dxf_write_string (fp, 100, "AcDbModelerGeometry");
         }
         if (fp->acad_version_number >= AutoCAD_13)
         {
-                fprintf (fp->fp, " 70\n%hd\n", body->modeler_format_version_number);
+                dxf_write_int (fp, 70, body->modeler_format_version_number);
         }
         iter = (DxfProprietaryData *) body->proprietary_data;
         additional_iter = (DxfProprietaryData *) body->additional_proprietary_data;
@@ -684,19 +658,19 @@ dxf_body_write
         {
                 if (iter->order == i)
                 {
-                        fprintf (fp->fp, "  1\n%s\n", iter->line);
+                        dxf_write_string (fp, 1, iter->line);
                         iter = (DxfProprietaryData *) iter->next;
                         i++;
                 }
                 if (additional_iter->order == i)
                 {
-                        fprintf (fp->fp, "  3\n%s\n", additional_iter->line);
+                        dxf_write_string (fp, 3, additional_iter->line);
                         additional_iter = (DxfProprietaryData *) additional_iter->next;
                         i++;
                 }
         }
         /* Clean up. */
-        free (dxf_entity_name);
+        dxf_free (dxf_entity_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -737,18 +711,13 @@ dxf_body_free
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        free (body->linetype);
-        free (body->layer);
+        dxf_string_free (body->linetype);
+        dxf_string_free (body->layer);
         dxf_binary_data_free_list (body->binary_graphics_data);
-        free (body->dictionary_owner_soft);
-        free (body->object_owner_soft);
-        free (body->material);
-        free (body->dictionary_owner_hard);
-        free (body->plot_style_name);
-        free (body->color_name);
+        dxf_string_free (body->color_name);
         dxf_binary_data_free_list (body->proprietary_data);
         dxf_binary_data_free_list (body->additional_proprietary_data);
-        free (body);
+        dxf_free (body);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -794,7 +763,7 @@ dxf_body_free_list
  *
  * \return ID code.
  */
-int
+uint64_t
 dxf_body_get_id_code
 (
         DxfBody *body
@@ -812,13 +781,6 @@ dxf_body_get_id_code
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (body->id_code < 0)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a negative value was found.\n")),
-                  __FUNCTION__);
-                return (EXIT_FAILURE);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -834,7 +796,7 @@ dxf_body_set_id_code
 (
         DxfBody *body,
                 /*!< a pointer to a DXF \c BODY entity. */
-        int id_code
+        uint64_t id_code
                 /*!< Identification number for the entity.\n
                  * This is to be an unique (sequential) number in the DXF
                  * file. */
@@ -851,13 +813,6 @@ dxf_body_set_id_code
                   __FUNCTION__);
                 return (NULL);
         }
-        if (id_code < 0)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a negative value was passed.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
         body->id_code = id_code;
 #if DEBUG
         DXF_DEBUG_END
@@ -899,7 +854,7 @@ dxf_body_get_linetype
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (body->linetype));
+        return (dxf_strdup (body->linetype));
 }
 
 
@@ -933,7 +888,7 @@ dxf_body_set_linetype
                   __FUNCTION__);
                 return (NULL);
         }
-        body->linetype = strdup (linetype);
+        body->linetype = dxf_strdup (linetype);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -974,7 +929,7 @@ dxf_body_get_layer
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (body->layer));
+        return (dxf_strdup (body->layer));
 }
 
 
@@ -1008,7 +963,7 @@ dxf_body_set_layer
                   __FUNCTION__);
                 return (NULL);
         }
-        body->layer = strdup (layer);
+        body->layer = dxf_strdup (layer);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1751,10 +1706,8 @@ dxf_body_set_binary_graphics_data
  * \c BODY entity.
  *
  * \return soft pointer to the dictionary owner.
- *
- * \warning No checks are performed on the returned pointer (string).
  */
-char *
+uint64_t
 dxf_body_get_dictionary_owner_soft
 (
         DxfBody *body
@@ -1770,19 +1723,12 @@ dxf_body_get_dictionary_owner_soft
                 fprintf (stderr,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
-                return (NULL);
-        }
-        if (body->dictionary_owner_soft ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
+                return (0);
         }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (body->dictionary_owner_soft));
+        return (body->dictionary_owner_soft);
 }
 
 
@@ -1795,8 +1741,8 @@ dxf_body_set_dictionary_owner_soft
 (
         DxfBody *body,
                 /*!< a pointer to a DXF \c BODY entity. */
-        char *dictionary_owner_soft
-                /*!< a string containing the pointer to the
+        uint64_t dictionary_owner_soft
+                /*!< the handle of the
                  * dictionary_owner_soft for the entity. */
 )
 {
@@ -1811,14 +1757,7 @@ dxf_body_set_dictionary_owner_soft
                   __FUNCTION__);
                 return (NULL);
         }
-        if (dictionary_owner_soft == NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was passed.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
-        body->dictionary_owner_soft = strdup (dictionary_owner_soft);
+        body->dictionary_owner_soft = dictionary_owner_soft;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1831,10 +1770,8 @@ dxf_body_set_dictionary_owner_soft
  * \c BODY entity.
  *
  * \return soft pointer to the object owner.
- *
- * \warning No checks are performed on the returned pointer (string).
  */
-char *
+uint64_t
 dxf_body_get_object_owner_soft
 (
         DxfBody *body
@@ -1850,19 +1787,12 @@ dxf_body_get_object_owner_soft
                 fprintf (stderr,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
-                return (NULL);
-        }
-        if (body->object_owner_soft ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
+                return (0);
         }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (body->object_owner_soft));
+        return (body->object_owner_soft);
 }
 
 
@@ -1875,8 +1805,8 @@ dxf_body_set_object_owner_soft
 (
         DxfBody *body,
                 /*!< a pointer to a DXF \c BODY entity. */
-        char *object_owner_soft
-                /*!< a string containing the pointer to the
+        uint64_t object_owner_soft
+                /*!< the handle of the
                  * \c object_owner_soft for the entity. */
 )
 {
@@ -1891,14 +1821,7 @@ dxf_body_set_object_owner_soft
                   __FUNCTION__);
                 return (NULL);
         }
-        if (object_owner_soft == NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was passed.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
-        body->object_owner_soft = strdup (object_owner_soft);
+        body->object_owner_soft = object_owner_soft;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1910,12 +1833,10 @@ dxf_body_set_object_owner_soft
  * \brief Get the pointer to the \c material from a DXF \c BODY
  * entity.
  *
- * \return a pointer to \c material when successful, or \c NULL when an
+ * \return the handle \c material when successful, or 0 when an
  * error occurred.
- *
- * \warning No checks are performed on the returned pointer.
  */
-char *
+uint64_t
 dxf_body_get_material
 (
         DxfBody *body
@@ -1931,19 +1852,12 @@ dxf_body_get_material
                 fprintf (stderr,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
-                return (NULL);
-        }
-        if (body->material ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
+                return (0);
         }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (body->material));
+        return (body->material);
 }
 
 
@@ -1958,8 +1872,8 @@ dxf_body_set_material
 (
         DxfBody *body,
                 /*!< a pointer to a DXF \c BODY entity. */
-        char *material
-                /*!< a string containing the pointer to the \c
+        uint64_t material
+                /*!< the handle of the \c
                  * material for the entity. */
 )
 {
@@ -1974,14 +1888,7 @@ dxf_body_set_material
                   __FUNCTION__);
                 return (NULL);
         }
-        if (material == NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was passed.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
-        body->material = strdup (material);
+        body->material = material;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1994,10 +1901,8 @@ dxf_body_set_material
  * \c BODY entity.
  *
  * \return hard pointer to the dictionary owner.
- *
- * \warning No checks are performed on the returned pointer (string).
  */
-char *
+uint64_t
 dxf_body_get_dictionary_owner_hard
 (
         DxfBody *body
@@ -2013,19 +1918,12 @@ dxf_body_get_dictionary_owner_hard
                 fprintf (stderr,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
-                return (NULL);
-        }
-        if (body->dictionary_owner_hard ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
+                return (0);
         }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (body->dictionary_owner_hard));
+        return (body->dictionary_owner_hard);
 }
 
 
@@ -2038,8 +1936,8 @@ dxf_body_set_dictionary_owner_hard
 (
         DxfBody *body,
                 /*!< a pointer to a DXF \c BODY entity. */
-        char *dictionary_owner_hard
-                /*!< a string containing the pointer to the
+        uint64_t dictionary_owner_hard
+                /*!< the handle of the
                  * dictionary_owner_hard for the entity. */
 )
 {
@@ -2054,14 +1952,7 @@ dxf_body_set_dictionary_owner_hard
                   __FUNCTION__);
                 return (NULL);
         }
-        if (dictionary_owner_hard == NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was passed.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
-        body->dictionary_owner_hard = strdup (dictionary_owner_hard);
+        body->dictionary_owner_hard = dictionary_owner_hard;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2137,10 +2028,10 @@ dxf_body_set_lineweight
 /*!
  * \brief Get the \c plot_style_name from a DXF \c BODY entity.
  *
- * \return \c plot_style_name when sucessful, or \c NULL when an error
+ * \return \c plot_style_name when sucessful, or 0 when an error
  * occurred.
  */
-char *
+uint64_t
 dxf_body_get_plot_style_name
 (
         DxfBody *body
@@ -2156,19 +2047,12 @@ dxf_body_get_plot_style_name
                 fprintf (stderr,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
-                return (NULL);
-        }
-        if (body->plot_style_name ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
+                return (0);
         }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (body->plot_style_name));
+        return (body->plot_style_name);
 }
 
 
@@ -2183,7 +2067,7 @@ dxf_body_set_plot_style_name
 (
         DxfBody *body,
                 /*!< a pointer to a DXF \c BODY entity. */
-        char *plot_style_name
+        uint64_t plot_style_name
                 /*!< a string containing the \c plot_style_name for the
                  * entity. */
 )
@@ -2199,14 +2083,7 @@ dxf_body_set_plot_style_name
                   __FUNCTION__);
                 return (NULL);
         }
-        if (plot_style_name == NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was passed.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
-        body->plot_style_name = strdup (plot_style_name);
+        body->plot_style_name = plot_style_name;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2313,7 +2190,7 @@ dxf_body_get_color_name
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (body->color_name));
+        return (dxf_strdup (body->color_name));
 }
 
 
@@ -2351,7 +2228,7 @@ dxf_body_set_color_name
                   __FUNCTION__);
                 return (NULL);
         }
-        body->color_name = strdup (color_name);
+        body->color_name = dxf_strdup (color_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -60,7 +60,7 @@ typedef struct
 dxf_body_struct
 {
         /* Members common for all DXF drawable entities. */
-        int id_code;
+        uint64_t id_code;
                 /*!< Identification number for the entity.\n
                  * This is to be an unique (sequential) number in the DXF
                  * file.\n
@@ -135,20 +135,20 @@ dxf_body_struct
                  * (optional).\n
                  * Group code = 310.\n
                  * \since Introduced in version R2000. */
-        char *dictionary_owner_soft;
+        uint64_t dictionary_owner_soft;
                 /*!< Soft-pointer ID/handle to owner dictionary (optional).\n
                  * Group code = 330.\n
                  * \since Introduced in version R14. */
-        char *object_owner_soft;
+        uint64_t object_owner_soft;
                 /*!< Soft-pointer ID/handle  to owner BLOCK_RECORD object.\n
                  * Group code = 330.\n
                  * \since Introduced in version R2000. */
-        char *material;
+        uint64_t material;
                 /*!< Hard-pointer ID/handle to material object (present if
                  * not BYLAYER).\n
                  * Group code = 347.\n
                  * \since Introduced in version R2008. */
-        char *dictionary_owner_hard;
+        uint64_t dictionary_owner_hard;
                 /*!< Hard owner ID/handle to owner dictionary (optional).\n
                  * Group code = 360.\n
                  * \since Introduced in version R14. */
@@ -157,7 +157,7 @@ dxf_body_struct
                  * Stored and moved around as a 16-bit integer.\n
                  * Group code = 370.\n
                  * \since Introduced in version R2002. */
-        char *plot_style_name;
+        uint64_t plot_style_name;
                 /*!< Hard pointer ID / handle of PlotStyleName object.\n
                  * Group code = 390.\n
                  * \since Introduced in version R2009. */
@@ -214,8 +214,8 @@ DxfBody *dxf_body_read (DxfFile *fp, DxfBody *body);
 int dxf_body_write (DxfFile *fp, DxfBody *body);
 int dxf_body_free (DxfBody *body);
 void dxf_body_free_list (DxfBody *bodies);
-int dxf_body_get_id_code (DxfBody *body);
-DxfBody *dxf_body_set_id_code (DxfBody *body, int id_code);
+uint64_t dxf_body_get_id_code (DxfBody *body);
+DxfBody *dxf_body_set_id_code (DxfBody *body, uint64_t id_code);
 char *dxf_body_get_linetype (DxfBody *body);
 DxfBody *dxf_body_set_linetype (DxfBody *body, char *linetype);
 char *dxf_body_get_layer (DxfBody *body);
@@ -238,18 +238,18 @@ int16_t dxf_body_get_shadow_mode (DxfBody *body);
 DxfBody *dxf_body_set_shadow_mode (DxfBody *body, int16_t shadow_mode);
 DxfBinaryData *dxf_body_get_binary_graphics_data (DxfBody *body);
 DxfBody *dxf_body_set_binary_graphics_data (DxfBody *body, DxfBinaryData *data);
-char *dxf_body_get_dictionary_owner_soft (DxfBody *body);
-DxfBody *dxf_body_set_dictionary_owner_soft (DxfBody *body, char *dictionary_owner_soft);
-char *dxf_body_get_object_owner_soft (DxfBody *body);
-DxfBody *dxf_body_set_object_owner_soft (DxfBody *body, char *object_owner_soft);
-char *dxf_body_get_material (DxfBody *body);
-DxfBody *dxf_body_set_material (DxfBody *body, char *material);
-char *dxf_body_get_dictionary_owner_hard (DxfBody *body);
-DxfBody *dxf_body_set_dictionary_owner_hard (DxfBody *body, char *dictionary_owner_hard);
+uint64_t dxf_body_get_dictionary_owner_soft (DxfBody *body);
+DxfBody *dxf_body_set_dictionary_owner_soft (DxfBody *body, uint64_t dictionary_owner_soft);
+uint64_t dxf_body_get_object_owner_soft (DxfBody *body);
+DxfBody *dxf_body_set_object_owner_soft (DxfBody *body, uint64_t object_owner_soft);
+uint64_t dxf_body_get_material (DxfBody *body);
+DxfBody *dxf_body_set_material (DxfBody *body, uint64_t material);
+uint64_t dxf_body_get_dictionary_owner_hard (DxfBody *body);
+DxfBody *dxf_body_set_dictionary_owner_hard (DxfBody *body, uint64_t dictionary_owner_hard);
 int16_t dxf_body_get_lineweight (DxfBody *body);
 DxfBody *dxf_body_set_lineweight (DxfBody *body, int16_t lineweight);
-char *dxf_body_get_plot_style_name (DxfBody *body);
-DxfBody *dxf_body_set_plot_style_name (DxfBody *body, char *plot_style_name);
+uint64_t dxf_body_get_plot_style_name (DxfBody *body);
+DxfBody *dxf_body_set_plot_style_name (DxfBody *body, uint64_t plot_style_name);
 int32_t dxf_body_get_color_value (DxfBody *body);
 DxfBody *dxf_body_set_color_value (DxfBody *body, int32_t color_value);
 char *dxf_body_get_color_name (DxfBody *body);
@@ -42,6 +42,8 @@
 
 
 #include "circle.h"
+#include "bbox.h"
+#include "util.h"
 
 
 /*!
@@ -61,7 +63,7 @@ dxf_circle_new ()
         size = sizeof (DxfCircle);
         /* avoid malloc of 0 bytes */
         if (size == 0) size = 1;
-        if ((circle = malloc (size)) == NULL)
+        if ((circle = dxf_malloc (size)) == NULL)
         {
                 fprintf (stderr,
                   (_("Error in %s () could not allocate memory.\n")),
@@ -112,9 +114,9 @@ dxf_circle_init
               return (NULL);
         }
         /* Assign initial values to members. */
-        circle->id_code = 0;
-        circle->linetype = strdup (DXF_DEFAULT_LINETYPE);
-        circle->layer = strdup (DXF_DEFAULT_LAYER);
+        circle->id_code = DXF_HANDLE_NONE;
+        circle->linetype = dxf_strdup (DXF_DEFAULT_LINETYPE);
+        circle->layer = dxf_strdup (DXF_DEFAULT_LAYER);
         circle->elevation = 0.0;
         circle->thickness = 0.0;
         circle->linetype_scale = DXF_DEFAULT_LINETYPE_SCALE;
@@ -123,15 +125,17 @@ dxf_circle_init
         circle->paperspace = DXF_MODELSPACE;
         circle->graphics_data_size = 0;
         circle->shadow_mode = 0;
-        circle->dictionary_owner_soft = strdup ("");
-        circle->object_owner_soft = strdup ("");
-        circle->material = strdup ("");
-        circle->dictionary_owner_hard = strdup ("");
+        circle->dictionary_owner_soft = 0;
+        circle->object_owner_soft = 0;
+        circle->material = 0;
+        circle->dictionary_owner_hard = 0;
         circle->lineweight = 0;
-        circle->plot_style_name = strdup ("");
+        circle->plot_style_name = 0;
         circle->color_value = 0;
-        circle->color_name = strdup ("");
+        circle->color_name = dxf_strdup ("");
         circle->transparency = 0;
+        circle->p0 = (DxfPoint *) dxf_point_new ();
+        circle->p0 = dxf_point_init ((DxfPoint *) circle->p0);
         circle->p0->x0 = 0.0;
         circle->p0->y0 = 0.0;
         circle->p0->z0 = 0.0;
@@ -174,7 +178,8 @@ dxf_circle_read
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        char *temp_string = NULL;
+        char temp_string[DXF_MAX_STRING_LENGTH];
+        int group_code;
         DxfBinaryData *iter310 = NULL;
         int iter330;
 
@@ -184,8 +189,6 @@ dxf_circle_read
                 fprintf (stderr,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
-                /* Clean up. */
-                free (temp_string);
                 return (NULL);
         }
         if (circle == NULL)
@@ -229,269 +232,223 @@ dxf_circle_read
         }
         iter310 = (DxfBinaryData *) circle->binary_graphics_data;
         iter330 = 0;
-        (fp->line_number)++;
-        fscanf (fp->fp, "%[^\n]", temp_string);
-        while (strcmp (temp_string, "0") != 0)
+        while ((dxf_read_group_code (fp, &group_code) == EXIT_SUCCESS)
+          && (group_code != 0))
         {
-                if (ferror (fp->fp))
+                if (dxf_read_error (fp))
                 {
                         fprintf (stderr,
                           (_("Error in %s () while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
-                        fclose (fp->fp);
-                        /* Clean up. */
-                        free (temp_string);
                         return (NULL);
                 }
-                if (strcmp (temp_string, "5") == 0)
-                {
-                        /* Now follows a string containing a sequential
-                         * id number. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%x\n", (uint *) &circle->id_code);
-                }
-                else if (strcmp (temp_string, "6") == 0)
-                {
-                        /* Now follows a string containing a linetype
-                         * name. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, circle->linetype);
-                }
-                else if (strcmp (temp_string, "8") == 0)
-                {
-                        /* Now follows a string containing a layer name. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, circle->layer);
-                }
-                else if (strcmp (temp_string, "10") == 0)
-                {
-                        /* Now follows a string containing the
-                         * X-coordinate of the center point. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &circle->p0->x0);
-                }
-                else if (strcmp (temp_string, "20") == 0)
-                {
-                        /* Now follows a string containing the
-                         * Y-coordinate of the center point. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &circle->p0->y0);
-                }
-                else if (strcmp (temp_string, "30") == 0)
-                {
-                        /* Now follows a string containing the
-                         * Z-coordinate of the center point. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &circle->p0->z0);
-                }
-                else if ((fp->acad_version_number <= AutoCAD_11)
-                        && (strcmp (temp_string, "38") == 0)
-                        && (circle->elevation != 0.0))
-                {
-                        /* Now follows a string containing the
-                         * elevation. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &circle->elevation);
-                }
-                else if (strcmp (temp_string, "39") == 0)
+                switch (group_code)
                 {
-                        /* Now follows a string containing the
-                         * thickness. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &circle->thickness);
-                }
-                else if (strcmp (temp_string, "40") == 0)
-                {
-                        /* Now follows a string containing the
-                         * radius. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &circle->radius);
-                }
-                else if (strcmp (temp_string, "48") == 0)
-                {
-                        /* Now follows a string containing the linetype
-                         * scale. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &circle->linetype_scale);
-                }
-                else if (strcmp (temp_string, "60") == 0)
-                {
-                        /* Now follows a string containing the
-                         * visibility value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%hd\n", &circle->visibility);
-                }
-                else if (strcmp (temp_string, "62") == 0)
-                {
-                        /* Now follows a string containing the
-                         * color value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%hd\n", &circle->color);
-                }
-                else if (strcmp (temp_string, "67") == 0)
-                {
-                        /* Now follows a string containing the
-                         * paperspace value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%hd\n", &circle->paperspace);
-                }
-                else if (strcmp (temp_string, "92") == 0)
-                {
-                        /* Now follows a string containing the
-                         * graphics data size value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%" PRIi32 "\n", &circle->graphics_data_size);
-                }
-                else if ((fp->acad_version_number >= AutoCAD_13)
-                        && (strcmp (temp_string, "100") == 0))
-                {
-                        /* Now follows a string containing the
-                         * subclass marker value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
-                        if ((strcmp (temp_string, "AcDbEntity") != 0)
-                        && (strcmp (temp_string, "AcDbCircle") != 0))
-                        {
+                        case 5:
+                                /* Now follows a string containing a sequential
+                                 * id number. */
+                                dxf_read_handle (fp, &circle->id_code);
+                                break;
+                        case 6:
+                                /* Now follows a string containing a linetype
+                                 * name. */
+                                dxf_read_string_interned (fp, &circle->linetype);
+                                break;
+                        case 8:
+                                /* Now follows a string containing a layer name. */
+                                dxf_read_string_interned (fp, &circle->layer);
+                                break;
+                        case 10:
+                                /* Now follows a string containing the
+                                 * X-coordinate of the center point. */
+                                dxf_read_double (fp, &circle->p0->x0);
+                                break;
+                        case 20:
+                                /* Now follows a string containing the
+                                 * Y-coordinate of the center point. */
+                                dxf_read_double (fp, &circle->p0->y0);
+                                break;
+                        case 30:
+                                /* Now follows a string containing the
+                                 * Z-coordinate of the center point. */
+                                dxf_read_double (fp, &circle->p0->z0);
+                                break;
+                        case 38:
+                                if ((fp->acad_version_number <= AutoCAD_11) && (circle->elevation != 0.0))
+                                {
+                                        /* Now follows a string containing the
+                                         * elevation. */
+                                        dxf_read_double (fp, &circle->elevation);
+                                }
+                                else
+                                {
+                                        fprintf (stderr,
+                                          (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
+                                          __FUNCTION__, fp->filename, fp->line_number);
+                                        /* Skip the value of the unknown group code. */
+                                        dxf_read_line (temp_string, fp);
+                                }
+                                break;
+                        case 39:
+                                /* Now follows a string containing the
+                                 * thickness. */
+                                dxf_read_double (fp, &circle->thickness);
+                                break;
+                        case 40:
+                                /* Now follows a string containing the
+                                 * radius. */
+                                dxf_read_double (fp, &circle->radius);
+                                break;
+                        case 48:
+                                /* Now follows a string containing the linetype
+                                 * scale. */
+                                dxf_read_double (fp, &circle->linetype_scale);
+                                break;
+                        case 60:
+                                /* Now follows a string containing the
+                                 * visibility value. */
+                                dxf_read_int16 (fp, &circle->visibility);
+                                break;
+                        case 62:
+                                /* Now follows a string containing the
+                                 * color value. */
+                                dxf_read_int16 (fp, &circle->color);
+                                break;
+                        case 67:
+                                /* Now follows a string containing the
+                                 * paperspace value. */
+                                dxf_read_int16 (fp, &circle->paperspace);
+                                break;
+                        case 92:
+                                /* Now follows a string containing the
+                                 * graphics data size value. */
+                                dxf_read_int32 (fp, &circle->graphics_data_size);
+                                break;
+                        case 100:
+                                if (fp->acad_version_number >= AutoCAD_13)
+                                {
+                                        /* Now follows a string containing the
+                                         * subclass marker value. */
+                                        dxf_read_line (temp_string, fp);
+                                        if ((strcmp (temp_string, "AcDbEntity") != 0)
+                                        && (strcmp (temp_string, "AcDbCircle") != 0))
+                                        {
+                                                fprintf (stderr,
+                                                  (_("Warning in %s () found a bad subclass marker in: %s in line: %d.\n")),
+                                                  __FUNCTION__, fp->filename, fp->line_number);
+                                        }
+                                }
+                                else
+                                {
+                                        fprintf (stderr,
+                                          (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
+                                          __FUNCTION__, fp->filename, fp->line_number);
+                                        /* Skip the value of the unknown group code. */
+                                        dxf_read_line (temp_string, fp);
+                                }
+                                break;
+                        case 160:
+                                /* Now follows a string containing the
+                                 * graphics data size value. */
+                                dxf_read_int32 (fp, &circle->graphics_data_size);
+                                break;
+                        case 284:
+                                /* Now follows a string containing the shadow
+                                 * mode value. */
+                                dxf_read_int16 (fp, &circle->shadow_mode);
+                                break;
+                        case 210:
+                                /* Now follows a string containing the
+                                 * X-value of the extrusion vector. */
+                                dxf_read_double (fp, &circle->extr_x0);
+                                break;
+                        case 220:
+                                /* Now follows a string containing the
+                                 * Y-value of the extrusion vector. */
+                                dxf_read_double (fp, &circle->extr_y0);
+                                break;
+                        case 230:
+                                /* Now follows a string containing the
+                                 * Z-value of the extrusion vector. */
+                                dxf_read_double (fp, &circle->extr_z0);
+                                break;
+                        case 310:
+                                /* Now follows a string containing binary
+                                 * graphics data. */
+                                iter310 = dxf_binary_data_read (fp, iter310);
+                                break;
+                        case 330:
+                                if (iter330 == 0)
+                                {
+                                        /* Now follows a string containing a soft-pointer
+                                         * ID/handle to owner dictionary. */
+                                        dxf_read_handle (fp, &circle->dictionary_owner_soft);
+                                }
+                                if (iter330 == 1)
+                                {
+                                        /* Now follows a string containing a soft-pointer
+                                         * ID/handle to owner object. */
+                                        dxf_read_handle (fp, &circle->object_owner_soft);
+                                }
+                                iter330++;
+                                break;
+                        case 347:
+                                /* Now follows a string containing a
+                                 * hard-pointer ID/handle to material object. */
+                                dxf_read_handle (fp, &circle->material);
+                                break;
+                        case 360:
+                                /* Now follows a string containing Hard owner
+                                 * ID/handle to owner dictionary. */
+                                dxf_read_handle (fp, &circle->dictionary_owner_hard);
+                                break;
+                        case 370:
+                                /* Now follows a string containing the lineweight
+                                 * value. */
+                                dxf_read_int16 (fp, &circle->lineweight);
+                                break;
+                        case 390:
+                                /* Now follows a string containing a plot style
+                                 * name value. */
+                                dxf_read_handle (fp, &circle->plot_style_name);
+                                break;
+                        case 420:
+                                /* Now follows a string containing a color value. */
+                                dxf_read_int32 (fp, &circle->color_value);
+                                break;
+                        case 430:
+                                /* Now follows a string containing a color
+                                 * name value. */
+                                dxf_read_string_interned (fp, &circle->color_name);
+                                break;
+                        case 440:
+                                /* Now follows a string containing a transparency
+                                 * value. */
+                                dxf_read_int32 (fp, &circle->transparency);
+                                break;
+                        case 999:
+                                /* Now follows a string containing a comment. */
+                                dxf_read_line (temp_string, fp);
+                                fprintf (stdout, "DXF comment: %s\n", temp_string);
+                                break;
+                        default:
                                 fprintf (stderr,
-                                  (_("Warning in %s () found a bad subclass marker in: %s in line: %d.\n")),
+                                  (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
                                   __FUNCTION__, fp->filename, fp->line_number);
-                        }
-                }
-                else if (strcmp (temp_string, "160") == 0)
-                {
-                        /* Now follows a string containing the
-                         * graphics data size value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%" PRIi32 "\n", &circle->graphics_data_size);
-                }
-                else if (strcmp (temp_string, "284") == 0)
-                {
-                        /* Now follows a string containing the shadow
-                         * mode value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%hd\n", &circle->shadow_mode);
-                }
-                else if (strcmp (temp_string, "210") == 0)
-                {
-                        /* Now follows a string containing the
-                         * X-value of the extrusion vector. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &circle->extr_x0);
-                }
-                else if (strcmp (temp_string, "220") == 0)
-                {
-                        /* Now follows a string containing the
-                         * Y-value of the extrusion vector. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &circle->extr_y0);
-                }
-                else if (strcmp (temp_string, "230") == 0)
-                {
-                        /* Now follows a string containing the
-                         * Z-value of the extrusion vector. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &circle->extr_z0);
-                }
-                else if (strcmp (temp_string, "310") == 0)
-                {
-                        /* Now follows a string containing binary
-                         * graphics data. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, iter310->data_line);
-                        dxf_binary_data_init ((DxfBinaryData *) iter310->next);
-                        iter310 = (DxfBinaryData *) iter310->next;
-                }
-                else if (strcmp (temp_string, "330") == 0)
-                {
-                        if (iter330 == 0)
-                        {
-                                /* Now follows a string containing a soft-pointer
-                                 * ID/handle to owner dictionary. */
-                                (fp->line_number)++;
-                                fscanf (fp->fp, DXF_MAX_STRING_FORMAT, circle->dictionary_owner_soft);
-                        }
-                        if (iter330 == 1)
-                        {
-                                /* Now follows a string containing a soft-pointer
-                                 * ID/handle to owner object. */
-                                (fp->line_number)++;
-                                fscanf (fp->fp, DXF_MAX_STRING_FORMAT, circle->object_owner_soft);
-                        }
-                        iter330++;
-                }
-                else if (strcmp (temp_string, "347") == 0)
-                {
-                        /* Now follows a string containing a
-                         * hard-pointer ID/handle to material object. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, circle->material);
-                }
-                else if (strcmp (temp_string, "360") == 0)
-                {
-                        /* Now follows a string containing Hard owner
-                         * ID/handle to owner dictionary. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, circle->dictionary_owner_hard);
-                }
-                else if (strcmp (temp_string, "370") == 0)
-                {
-                        /* Now follows a string containing the lineweight
-                         * value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%hd\n", &circle->lineweight);
-                }
-                else if (strcmp (temp_string, "390") == 0)
-                {
-                        /* Now follows a string containing a plot style
-                         * name value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, circle->plot_style_name);
-                }
-                else if (strcmp (temp_string, "420") == 0)
-                {
-                        /* Now follows a string containing a color value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%" PRIi32 "\n", &circle->color_value);
-                }
-                else if (strcmp (temp_string, "430") == 0)
-                {
-                        /* Now follows a string containing a color
-                         * name value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, circle->color_name);
-                }
-                else if (strcmp (temp_string, "440") == 0)
-                {
-                        /* Now follows a string containing a transparency
-                         * value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%" PRIi32 "\n", &circle->transparency);
-                }
-                else if (strcmp (temp_string, "999") == 0)
-                {
-                        /* Now follows a string containing a comment. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
-                        fprintf (stdout, "DXF comment: %s\n", temp_string);
-                }
-                else
-                {
-                        fprintf (stderr,
-                          (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
-                          __FUNCTION__, fp->filename, fp->line_number);
+                                /* Skip the value of the unknown group code. */
+                                dxf_read_line (temp_string, fp);
+                                break;
                 }
         }
         /* Handle omitted members and/or illegal values. */
         if (strcmp (circle->linetype, "") == 0)
         {
-                circle->linetype = strdup (DXF_DEFAULT_LINETYPE);
+                circle->linetype = dxf_strdup (DXF_DEFAULT_LINETYPE);
         }
         if (strcmp (circle->layer, "") == 0)
         {
-                circle->layer = strdup (DXF_DEFAULT_LAYER);
+                circle->layer = dxf_strdup (DXF_DEFAULT_LAYER);
         }
-        /* Clean up. */
-        free (temp_string);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -514,7 +471,7 @@ dxf_circle_write
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        char *dxf_entity_name = strdup ("CIRCLE");
+        char *dxf_entity_name = dxf_strdup ("CIRCLE");
 
         /* Do some basic checks. */
         if (fp == NULL)
@@ -523,7 +480,7 @@ dxf_circle_write
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (circle == NULL)
@@ -532,40 +489,40 @@ dxf_circle_write
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (strcmp (circle->linetype, "") == 0)
         {
                 fprintf (stderr,
-                  (_("Warning in %s () empty linetype string for the %s entity with id-code: %x\n")),
+                  (_("Warning in %s () empty linetype string for the %s entity with id-code: %" PRIx64 "\n")),
                   __FUNCTION__, dxf_entity_name, circle->id_code);
                 fprintf (stderr,
                   (_("\t%s entity is reset to default linetype")),
                   dxf_entity_name);
-                circle->linetype = strdup (DXF_DEFAULT_LINETYPE);
+                circle->linetype = dxf_strdup (DXF_DEFAULT_LINETYPE);
         }
         if (strcmp (circle->layer, "") == 0)
         {
                 fprintf (stderr,
-                  (_("Warning in %s () empty layer string for the %s entity with id-code: %x\n")),
+                  (_("Warning in %s () empty layer string for the %s entity with id-code: %" PRIx64 "\n")),
                   __FUNCTION__, dxf_entity_name, circle->id_code);
                 fprintf (stderr,
                   (_("\t%s entity is relocated to layer 0")),
                   dxf_entity_name );
-                circle->layer = strdup (DXF_DEFAULT_LAYER);
+                circle->layer = dxf_strdup (DXF_DEFAULT_LAYER);
         }
         if (circle->radius == 0.0)
         {
                 fprintf (stderr,
-                  (_("Warning in %s () radius value equals 0.0 for the %s entity with id-code: %x\n")),
+                  (_("Warning in %s () radius value equals 0.0 for the %s entity with id-code: %" PRIx64 "\n")),
                   __FUNCTION__, dxf_entity_name, circle->id_code);
         }
         /* Start writing output. */
-        fprintf (fp->fp, "  0\n%s\n", dxf_entity_name);
-        if (circle->id_code != -1)
+        dxf_write_string (fp, 0, dxf_entity_name);
+        if (circle->id_code != DXF_HANDLE_NONE)
         {
-                fprintf (fp->fp, "  5\n%x\n", circle->id_code);
+                dxf_write_hex (fp, 5, circle->id_code);
         }
         /*!
          * \todo for version R14.\n
@@ -577,65 +534,65 @@ dxf_circle_write
          * 102 groups are application defined (optional).\n\n
          * End of group, "}" (optional), with Group code 102.
          */
-        if ((strcmp (circle->dictionary_owner_soft, "") != 0)
+        if ((circle->dictionary_owner_soft != 0)
           && (fp->acad_version_number >= AutoCAD_14))
         {
-                fprintf (fp->fp, "102\n{ACAD_REACTORS\n");
-                fprintf (fp->fp, "330\n%s\n", circle->dictionary_owner_soft);
-                fprintf (fp->fp, "102\n}\n");
+                dxf_write_string (fp, 102, "{ACAD_REACTORS");
+                dxf_write_hex (fp, 330, circle->dictionary_owner_soft);
+                dxf_write_string (fp, 102, "}");
         }
-        if ((strcmp (circle->dictionary_owner_hard, "") != 0)
+        if ((circle->dictionary_owner_hard != 0)
           && (fp->acad_version_number >= AutoCAD_14))
         {
-                fprintf (fp->fp, "102\n{ACAD_XDICTIONARY\n");
-                fprintf (fp->fp, "360\n%s\n", circle->dictionary_owner_hard);
-                fprintf (fp->fp, "102\n}\n");
+                dxf_write_string (fp, 102, "{ACAD_XDICTIONARY");
+                dxf_write_hex (fp, 360, circle->dictionary_owner_hard);
+                dxf_write_string (fp, 102, "}");
         }
-        if ((strcmp (circle->object_owner_soft, "") != 0)
+        if ((circle->object_owner_soft != 0)
           && (fp->acad_version_number >= AutoCAD_2000))
         {
-                fprintf (fp->fp, "330\n%s\n", circle->object_owner_soft);
+                dxf_write_hex (fp, 330, circle->object_owner_soft);
         }
         if (fp->acad_version_number >= AutoCAD_13)
         {
-                fprintf (fp->fp, "100\nAcDbEntity\n");
+                dxf_write_string (fp, 100, "AcDbEntity");
         }
         if (circle->paperspace == DXF_PAPERSPACE)
         {
-                fprintf (fp->fp, " 67\n%hd\n", (int16_t) DXF_PAPERSPACE);
+                dxf_write_int (fp, 67, (int16_t) DXF_PAPERSPACE);
         }
-        fprintf (fp->fp, "  8\n%s\n", circle->layer);
+        dxf_write_string (fp, 8, circle->layer);
         if (strcmp (circle->linetype, DXF_DEFAULT_LINETYPE) != 0)
         {
-                fprintf (fp->fp, "  6\n%s\n", circle->linetype);
+                dxf_write_string (fp, 6, circle->linetype);
         }
         if ((fp->acad_version_number >= AutoCAD_2008)
-          && (strcmp (circle->material, "") != 0))
+          && (circle->material != 0))
         {
-                fprintf (fp->fp, "347\n%s\n", circle->material);
+                dxf_write_hex (fp, 347, circle->material);
         }
         if (circle->color != DXF_COLOR_BYLAYER)
         {
-                fprintf (fp->fp, " 62\n%hd\n", circle->color);
+                dxf_write_int (fp, 62, circle->color);
         }
         if (fp->acad_version_number >= AutoCAD_2002)
         {
-                fprintf (fp->fp, "370\n%hd\n", circle->lineweight);
+                dxf_write_int (fp, 370, circle->lineweight);
         }
         if (circle->linetype_scale != 1.0)
         {
-                fprintf (fp->fp, " 48\n%f\n", circle->linetype_scale);
+                dxf_write_double (fp, 48, circle->linetype_scale);
         }
         if (circle->visibility != 0)
         {
-                fprintf (fp->fp, " 60\n%hd\n", circle->visibility);
+                dxf_write_int (fp, 60, circle->visibility);
         }
         if (fp->acad_version_number >= AutoCAD_2000)
         {
 #ifdef BUILD_64
-                fprintf (fp->fp, "160\n%" PRIi32 "\n", circle->graphics_data_size);
+                dxf_write_int (fp, 160, circle->graphics_data_size);
 #else
-                fprintf (fp->fp, " 92\n%" PRIi32 "\n", circle->graphics_data_size);
+                dxf_write_int (fp, 92, circle->graphics_data_size);
 #endif
                 if (circle->binary_graphics_data != NULL)
                 {
@@ -643,51 +600,51 @@ dxf_circle_write
                         iter = (DxfBinaryData *) circle->binary_graphics_data;
                         while (iter != NULL)
                         {
-                                fprintf (fp->fp, "310\n%s\n", iter->data_line);
+                                dxf_binary_data_write (fp, iter);
                                 iter = (DxfBinaryData *) iter->next;
                         }
                 }
         }
         if (fp->acad_version_number >= AutoCAD_2004)
         {
-                fprintf (fp->fp, "420\n%" PRIi32 "\n", circle->color_value);
-                fprintf (fp->fp, "430\n%s\n", circle->color_name);
-                fprintf (fp->fp, "440\n%" PRIi32 "\n", circle->transparency);
+                dxf_write_int (fp, 420, circle->color_value);
+                dxf_write_string (fp, 430, circle->color_name);
+                dxf_write_int (fp, 440, circle->transparency);
         }
         if (fp->acad_version_number >= AutoCAD_2009)
         {
-                fprintf (fp->fp, "390\n%s\n", circle->plot_style_name);
-                fprintf (fp->fp, "284\n%hd\n", circle->shadow_mode);
+                dxf_write_hex (fp, 390, circle->plot_style_name);
+                dxf_write_int (fp, 284, circle->shadow_mode);
         }
         if (fp->acad_version_number >= AutoCAD_13)
         {
-                fprintf (fp->fp, "100\nAcDbCircle\n");
+                dxf_write_string (fp, 100, "AcDbCircle");
         }
         if ((fp->acad_version_number <= AutoCAD_11)
           && DXF_FLATLAND
           && (circle->elevation != 0.0))
         {
-                fprintf (fp->fp, " 38\n%f\n", circle->elevation);
+                dxf_write_double (fp, 38, circle->elevation);
         }
         if (circle->thickness != 0.0)
         {
-                fprintf (fp->fp, " 39\n%f\n", circle->thickness);
+                dxf_write_double (fp, 39, circle->thickness);
         }
-        fprintf (fp->fp, " 10\n%f\n", circle->p0->x0);
-        fprintf (fp->fp, " 20\n%f\n", circle->p0->y0);
-        fprintf (fp->fp, " 30\n%f\n", circle->p0->z0);
-        fprintf (fp->fp, " 40\n%f\n", circle->radius);
+        dxf_write_double (fp, 10, circle->p0->x0);
+        dxf_write_double (fp, 20, circle->p0->y0);
+        dxf_write_double (fp, 30, circle->p0->z0);
+        dxf_write_double (fp, 40, circle->radius);
         if ((fp->acad_version_number >= AutoCAD_12)
                 && (circle->extr_x0 != 0.0)
                 && (circle->extr_y0 != 0.0)
                 && (circle->extr_z0 != 1.0))
         {
-                fprintf (fp->fp, "210\n%f\n", circle->extr_x0);
-                fprintf (fp->fp, "220\n%f\n", circle->extr_y0);
-                fprintf (fp->fp, "230\n%f\n", circle->extr_z0);
+                dxf_write_double (fp, 210, circle->extr_x0);
+                dxf_write_double (fp, 220, circle->extr_y0);
+                dxf_write_double (fp, 230, circle->extr_z0);
         }
         /* Clean up. */
-        free (dxf_entity_name);
+        dxf_free (dxf_entity_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -727,12 +684,10 @@ dxf_circle_free
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        free (circle->linetype);
-        free (circle->layer);
+        dxf_string_free (circle->linetype);
+        dxf_string_free (circle->layer);
         dxf_binary_data_free (circle->binary_graphics_data);
-        free (circle->dictionary_owner_soft);
-        free (circle->dictionary_owner_hard);
-        free (circle);
+        dxf_free (circle);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -778,7 +733,7 @@ dxf_circle_free_list
  *
  * \return ID code.
  */
-int
+uint64_t
 dxf_circle_get_id_code
 (
         DxfCircle *circle
@@ -796,12 +751,6 @@ dxf_circle_get_id_code
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (circle->id_code < 0)
-        {
-                fprintf (stderr,
-                  (_("Warning in %s () a negative value was found.\n")),
-                  __FUNCTION__);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -817,7 +766,7 @@ dxf_circle_set_id_code
 (
         DxfCircle *circle,
                 /*!< a pointer to a DXF \c CIRCLE entity. */
-        int id_code
+        uint64_t id_code
                 /*!< Identification number for the entity.\n
                  * This is to be an unique (sequential) number in the DXF
                  * file. */
@@ -834,12 +783,6 @@ dxf_circle_set_id_code
                   __FUNCTION__);
                 return (NULL);
         }
-        if (id_code < 0)
-        {
-                fprintf (stderr,
-                  (_("Warning in %s () a negative value was passed.\n")),
-                  __FUNCTION__);
-        }
         circle->id_code = id_code;
 #if DEBUG
         DXF_DEBUG_END
@@ -881,7 +824,7 @@ dxf_circle_get_linetype
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (circle->linetype));
+        return (dxf_strdup (circle->linetype));
 }
 
 
@@ -915,7 +858,7 @@ dxf_circle_set_linetype
                   __FUNCTION__);
                 return (NULL);
         }
-        circle->linetype = strdup (linetype);
+        circle->linetype = dxf_strdup (linetype);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -956,7 +899,7 @@ dxf_circle_get_layer
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (circle->layer));
+        return (dxf_strdup (circle->layer));
 }
 
 
@@ -990,7 +933,7 @@ dxf_circle_set_layer
                   __FUNCTION__);
                 return (NULL);
         }
-        circle->layer = strdup (layer);
+        circle->layer = dxf_strdup (layer);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1720,10 +1663,8 @@ dxf_circle_set_binary_graphics_data
  * \c CIRCLE entity.
  *
  * \return soft pointer to the dictionary owner.
- *
- * \warning no checks are performed on the returned pointer (string).
  */
-char *
+uint64_t
 dxf_circle_get_dictionary_owner_soft
 (
         DxfCircle *circle
@@ -1739,19 +1680,12 @@ dxf_circle_get_dictionary_owner_soft
                 fprintf (stderr,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
-                return (NULL);
-        }
-        if (circle->dictionary_owner_soft ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
+                return (0);
         }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (circle->dictionary_owner_soft));
+        return (circle->dictionary_owner_soft);
 }
 
 
@@ -1764,8 +1698,8 @@ dxf_circle_set_dictionary_owner_soft
 (
         DxfCircle *circle,
                 /*!< a pointer to a DXF \c CIRCLE entity. */
-        char *dictionary_owner_soft
-                /*!< a string containing the pointer to the
+        uint64_t dictionary_owner_soft
+                /*!< the handle of the
                  * dictionary_owner_soft for the entity. */
 )
 {
@@ -1780,14 +1714,7 @@ dxf_circle_set_dictionary_owner_soft
                   __FUNCTION__);
                 return (NULL);
         }
-        if (dictionary_owner_soft == NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was passed.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
-        circle->dictionary_owner_soft = strdup (dictionary_owner_soft);
+        circle->dictionary_owner_soft = dictionary_owner_soft;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1800,10 +1727,8 @@ dxf_circle_set_dictionary_owner_soft
  * \c CIRCLE entity.
  *
  * \return soft pointer to the object owner.
- *
- * \warning no checks are performed on the returned pointer (string).
  */
-char *
+uint64_t
 dxf_circle_get_object_owner_soft
 (
         DxfCircle *circle
@@ -1819,19 +1744,12 @@ dxf_circle_get_object_owner_soft
                 fprintf (stderr,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
-                return (NULL);
-        }
-        if (circle->object_owner_soft ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
+                return (0);
         }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (circle->object_owner_soft));
+        return (circle->object_owner_soft);
 }
 
 
@@ -1844,8 +1762,8 @@ dxf_circle_set_object_owner_soft
 (
         DxfCircle *circle,
                 /*!< a pointer to a DXF \c CIRCLE entity. */
-        char *object_owner_soft
-                /*!< a string containing the pointer to the
+        uint64_t object_owner_soft
+                /*!< the handle of the
                  * \c object_owner_soft for the entity. */
 )
 {
@@ -1860,14 +1778,7 @@ dxf_circle_set_object_owner_soft
                   __FUNCTION__);
                 return (NULL);
         }
-        if (object_owner_soft == NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was passed.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
-        circle->object_owner_soft = strdup (object_owner_soft);
+        circle->object_owner_soft = object_owner_soft;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1879,12 +1790,10 @@ dxf_circle_set_object_owner_soft
  * \brief Get the pointer to the \c material from a DXF \c CIRCLE
  * entity.
  *
- * \return a pointer to \c material when successful, or \c NULL when an
+ * \return the handle \c material when successful, or 0 when an
  * error occurred.
- *
- * \warning No checks are performed on the returned pointer.
  */
-char *
+uint64_t
 dxf_circle_get_material
 (
         DxfCircle *circle
@@ -1900,19 +1809,12 @@ dxf_circle_get_material
                 fprintf (stderr,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
-                return (NULL);
-        }
-        if (circle->material ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
+                return (0);
         }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (circle->material));
+        return (circle->material);
 }
 
 
@@ -1927,8 +1829,8 @@ dxf_circle_set_material
 (
         DxfCircle *circle,
                 /*!< a pointer to a DXF \c CIRCLE entity. */
-        char *material
-                /*!< a string containing the pointer to the \c
+        uint64_t material
+                /*!< the handle of the \c
                  * material for the entity. */
 )
 {
@@ -1943,14 +1845,7 @@ dxf_circle_set_material
                   __FUNCTION__);
                 return (NULL);
         }
-        if (material == NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was passed.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
-        circle->material = strdup (material);
+        circle->material = material;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1963,10 +1858,8 @@ dxf_circle_set_material
  * \c CIRCLE entity.
  *
  * \return hard pointer to the dictionary owner.
- *
- * \warning No checks are performed on the returned pointer (string).
  */
-char *
+uint64_t
 dxf_circle_get_dictionary_owner_hard
 (
         DxfCircle *circle
@@ -1982,19 +1875,12 @@ dxf_circle_get_dictionary_owner_hard
                 fprintf (stderr,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
-                return (NULL);
-        }
-        if (circle->dictionary_owner_hard ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
+                return (0);
         }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (circle->dictionary_owner_hard));
+        return (circle->dictionary_owner_hard);
 }
 
 
@@ -2007,8 +1893,8 @@ dxf_circle_set_dictionary_owner_hard
 (
         DxfCircle *circle,
                 /*!< a pointer to a DXF \c CIRCLE entity. */
-        char *dictionary_owner_hard
-                /*!< a string containing the pointer to the
+        uint64_t dictionary_owner_hard
+                /*!< the handle of the
                  * dictionary_owner_hard for the entity. */
 )
 {
@@ -2023,14 +1909,7 @@ dxf_circle_set_dictionary_owner_hard
                   __FUNCTION__);
                 return (NULL);
         }
-        if (dictionary_owner_hard == NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was passed.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
-        circle->dictionary_owner_hard = strdup (dictionary_owner_hard);
+        circle->dictionary_owner_hard = dictionary_owner_hard;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2106,10 +1985,10 @@ dxf_circle_set_lineweight
 /*!
  * \brief Get the \c plot_style_name from a DXF \c CIRCLE entity.
  *
- * \return \c plot_style_name when sucessful, or \c NULL when an error
+ * \return \c plot_style_name when sucessful, or 0 when an error
  * occurred.
  */
-char *
+uint64_t
 dxf_circle_get_plot_style_name
 (
         DxfCircle *circle
@@ -2125,19 +2004,12 @@ dxf_circle_get_plot_style_name
                 fprintf (stderr,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
-                return (NULL);
-        }
-        if (circle->plot_style_name ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
+                return (0);
         }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (circle->plot_style_name));
+        return (circle->plot_style_name);
 }
 
 
@@ -2152,7 +2024,7 @@ dxf_circle_set_plot_style_name
 (
         DxfCircle *circle,
                 /*!< a pointer to a DXF \c CIRCLE entity. */
-        char *plot_style_name
+        uint64_t plot_style_name
                 /*!< a string containing the \c plot_style_name for the
                  * entity. */
 )
@@ -2168,14 +2040,7 @@ dxf_circle_set_plot_style_name
                   __FUNCTION__);
                 return (NULL);
         }
-        if (plot_style_name == NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was passed.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
-        circle->plot_style_name = strdup (plot_style_name);
+        circle->plot_style_name = plot_style_name;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2282,7 +2147,7 @@ dxf_circle_get_color_name
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (circle->color_name));
+        return (dxf_strdup (circle->color_name));
 }
 
 
@@ -2320,7 +2185,7 @@ dxf_circle_set_color_name
                   __FUNCTION__);
                 return (NULL);
         }
-        circle->color_name = strdup (color_name);
+        circle->color_name = dxf_strdup (color_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -3377,4 +3242,132 @@ dxf_circle_get_last
 }
 
 
+/*!
+ * \brief Get the bounding box of a DXF \c CIRCLE.
+ *
+ * The box of the points of \c circle at the left, right, bottom and
+ * top of the center, in the plane of it's Object Coordinate System
+ * (OCS), see dxf_bbox_add_ocs_arc ().
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_circle_get_bbox
+(
+        DxfCircle *circle,
+                /*!< a pointer to a DXF \c CIRCLE entity. */
+        DxfBbox *bbox
+                /*!< a pointer to the libDXF bounding box to fill. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfVec3 center;
+        DxfVec3 extrusion;
+
+        /* Do some basic checks. */
+        if ((circle == NULL) || (bbox == NULL))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        if (circle->p0 == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer to the center point was found.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        center.x = circle->p0->x0;
+        center.y = circle->p0->y0;
+        center.z = circle->p0->z0;
+        extrusion.x = circle->extr_x0;
+        extrusion.y = circle->extr_y0;
+        extrusion.z = circle->extr_z0;
+        dxf_bbox_init (bbox);
+        dxf_bbox_add_ocs_arc (bbox, &extrusion, &center, circle->radius,
+          0.0, 0.0);
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Transform a DXF \c CIRCLE entity in place.
+ *
+ * The entity lies in the plane of it's Object Coordinate System
+ * (OCS), \c transform has to map this plane with a uniform scale,
+ * see dxf_transform_get_ocs_transform ().
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred, or when \c transform does not map the entity without
+ * distortion.
+ */
+int
+dxf_circle_transform
+(
+        DxfCircle *circle,
+                /*!< a pointer to a DXF \c CIRCLE entity. */
+        DxfTransform *transform
+                /*!< a pointer to a libDXF affine transformation. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfTransform ocs;
+        DxfVec3 extrusion;
+        DxfVec3 center;
+        double scale;
+
+        /* Do some basic checks. */
+        if ((circle == NULL) || (transform == NULL))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        if (circle->p0 == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer to the center point was found.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        extrusion.x = circle->extr_x0;
+        extrusion.y = circle->extr_y0;
+        extrusion.z = circle->extr_z0;
+        if (dxf_transform_get_ocs_transform (transform, &extrusion, &ocs, &scale) == EXIT_FAILURE)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () the transformation distorts the CIRCLE entity with id-code: %" PRIx64 "\n")),
+                  __FUNCTION__, circle->id_code);
+                return (EXIT_FAILURE);
+        }
+        center.x = circle->p0->x0;
+        center.y = circle->p0->y0;
+        center.z = circle->p0->z0;
+        dxf_transform_apply_point (&ocs, &center, &center);
+        circle->p0->x0 = center.x;
+        circle->p0->y0 = center.y;
+        circle->p0->z0 = center.z;
+        circle->radius *= scale;
+        circle->extr_x0 = extrusion.x;
+        circle->extr_y0 = extrusion.y;
+        circle->extr_z0 = extrusion.z;
+        circle->thickness *= ocs.m[2][2];
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (EXIT_SUCCESS);
+}
+
+
 /* EOF */
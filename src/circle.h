@@ -49,6 +49,7 @@
 #include "global.h"
 #include "point.h"
 #include "binary_data.h"
+#include "transform.h"
 
 
 #ifdef __cplusplus
@@ -63,7 +64,7 @@ typedef struct
 dxf_circle_struct
 {
         /* Members common for all DXF drawable entities. */
-        int id_code;
+        uint64_t id_code;
                 /*!< Identification number for the entity.\n
                  * This is to be an unique (sequential) number in the DXF
                  * file.\n
@@ -136,20 +137,20 @@ dxf_circle_struct
                  * (optional).\n
                  * Group code = 310.\n
                  * \since Introduced in version R2000. */
-        char *dictionary_owner_soft;
+        uint64_t dictionary_owner_soft;
                 /*!< Soft-pointer ID/handle to owner dictionary (optional).\n
                  * Group code = 330.\n
                  * \since Introduced in version R14. */
-        char *object_owner_soft;
+        uint64_t object_owner_soft;
                 /*!< Soft-pointer ID/handle  to owner BLOCK_RECORD object.\n
                  * Group code = 330.\n
                  * \since Introduced in version R2000. */
-        char *material;
+        uint64_t material;
                 /*!< Hard-pointer ID/handle to material object (present if
                  * not BYLAYER).\n
                  * Group code = 347.\n
                  * \since Introduced in version R2008. */
-        char *dictionary_owner_hard;
+        uint64_t dictionary_owner_hard;
                 /*!< Hard owner ID/handle to owner dictionary (optional).\n
                  * Group code = 360.\n
                  * \since Introduced in version R14. */
@@ -158,7 +159,7 @@ dxf_circle_struct
                  * Stored and moved around as a 16-bit integer.\n
                  * Group code = 370.\n
                  * \since Introduced in version R2002. */
-        char *plot_style_name;
+        uint64_t plot_style_name;
                 /*!< Hard pointer ID / handle of PlotStyleName object.\n
                  * Group code = 390.\n
                  * \since Introduced in version R2009. */
@@ -221,8 +222,8 @@ DxfCircle *dxf_circle_read (DxfFile *fp, DxfCircle *circle);
 int dxf_circle_write (DxfFile *fp, DxfCircle *circle);
 int dxf_circle_free (DxfCircle *circle);
 void dxf_circle_free_list (DxfCircle *circles);
-int dxf_circle_get_id_code (DxfCircle *circle);
-DxfCircle *dxf_circle_set_id_code (DxfCircle *circle, int id_code);
+uint64_t dxf_circle_get_id_code (DxfCircle *circle);
+DxfCircle *dxf_circle_set_id_code (DxfCircle *circle, uint64_t id_code);
 char *dxf_circle_get_linetype (DxfCircle *circle);
 DxfCircle *dxf_circle_set_linetype (DxfCircle *circle, char *linetype);
 char *dxf_circle_get_layer (DxfCircle *circle);
@@ -245,18 +246,18 @@ int16_t dxf_circle_get_shadow_mode (DxfCircle *circle);
 DxfCircle *dxf_circle_set_shadow_mode (DxfCircle *circle, int16_t shadow_mode);
 DxfBinaryData *dxf_circle_get_binary_graphics_data (DxfCircle *circle);
 DxfCircle *dxf_circle_set_binary_graphics_data (DxfCircle *circle, DxfBinaryData *data);
-char *dxf_circle_get_dictionary_owner_soft (DxfCircle *circle);
-DxfCircle *dxf_circle_set_dictionary_owner_soft (DxfCircle *circle, char *dictionary_owner_soft);
-char *dxf_circle_get_object_owner_soft (DxfCircle *circle);
-DxfCircle *dxf_circle_set_object_owner_soft (DxfCircle *circle, char *object_owner_soft);
-char *dxf_circle_get_material (DxfCircle *circle);
-DxfCircle *dxf_circle_set_material (DxfCircle *circle, char *material);
-char *dxf_circle_get_dictionary_owner_hard (DxfCircle *circle);
-DxfCircle *dxf_circle_set_dictionary_owner_hard (DxfCircle *circle, char *dictionary_owner_hard);
+uint64_t dxf_circle_get_dictionary_owner_soft (DxfCircle *circle);
+DxfCircle *dxf_circle_set_dictionary_owner_soft (DxfCircle *circle, uint64_t dictionary_owner_soft);
+uint64_t dxf_circle_get_object_owner_soft (DxfCircle *circle);
+DxfCircle *dxf_circle_set_object_owner_soft (DxfCircle *circle, uint64_t object_owner_soft);
+uint64_t dxf_circle_get_material (DxfCircle *circle);
+DxfCircle *dxf_circle_set_material (DxfCircle *circle, uint64_t material);
+uint64_t dxf_circle_get_dictionary_owner_hard (DxfCircle *circle);
+DxfCircle *dxf_circle_set_dictionary_owner_hard (DxfCircle *circle, uint64_t dictionary_owner_hard);
 int16_t dxf_circle_get_lineweight (DxfCircle *circle);
 DxfCircle *dxf_circle_set_lineweight (DxfCircle *circle, int16_t lineweight);
-char *dxf_circle_get_plot_style_name (DxfCircle *circle);
-DxfCircle *dxf_circle_set_plot_style_name (DxfCircle *circle, char *plot_style_name);
+uint64_t dxf_circle_get_plot_style_name (DxfCircle *circle);
+DxfCircle *dxf_circle_set_plot_style_name (DxfCircle *circle, uint64_t plot_style_name);
 int32_t dxf_circle_get_color_value (DxfCircle *circle);
 DxfCircle *dxf_circle_set_color_value (DxfCircle *circle, int32_t color_value);
 char *dxf_circle_get_color_name (DxfCircle *circle);
@@ -287,6 +288,8 @@ int dxf_circle_test_point_in_circle (DxfPoint *point, DxfCircle *circle);
 DxfCircle *dxf_circle_get_next (DxfCircle *circle);
 DxfCircle *dxf_circle_set_next (DxfCircle *circle, DxfCircle *next);
 DxfCircle *dxf_circle_get_last (DxfCircle *circle);
+int dxf_circle_get_bbox (DxfCircle *circle, DxfBbox *bbox);
+int dxf_circle_transform (DxfCircle *circle, DxfTransform *transform);
 
 
 #ifdef __cplusplus
@@ -44,6 +44,7 @@
 
 
 #include "class.h"
+#include "util.h"
 
 
 /*!
@@ -63,7 +64,7 @@ dxf_class_new ()
         size = sizeof (DxfClass);
         /* avoid malloc of 0 bytes */
         if (size == 0) size = 1;
-        if ((class = malloc (size)) == NULL)
+        if ((class = dxf_malloc (size)) == NULL)
         {
                 fprintf (stderr,
                   (_("Error in %s () could not allocate memory for a DxfClass struct.\n")),
@@ -113,10 +114,10 @@ dxf_class_init
                 __FUNCTION__);
               return (NULL);
         }
-        class->record_type = strdup ("");
-        class->record_name = strdup ("");
-        class->class_name = strdup ("");
-        class->app_name = strdup ("");
+        class->record_type = dxf_strdup ("");
+        class->record_name = dxf_strdup ("");
+        class->class_name = dxf_strdup ("");
+        class->app_name = dxf_strdup ("");
         class->proxy_cap_flag = 0;
         class->was_a_proxy_flag = 0;
         class->is_an_entity_flag = 0;
@@ -151,7 +152,8 @@ dxf_class_read
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        char *temp_string = NULL;
+        char temp_string[DXF_MAX_STRING_LENGTH];
+        int group_code;
 
         /* Do some basic checks. */
         if (fp == NULL)
@@ -159,8 +161,6 @@ dxf_class_read
                 fprintf (stderr,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
-                /* Clean up. */
-                free (temp_string);
                 return (NULL);
         }
         if (class == NULL)
@@ -170,86 +170,70 @@ dxf_class_read
                   __FUNCTION__);
                 class = dxf_class_init (class);
         }
-        (fp->line_number)++;
-        fscanf (fp->fp, "%[^\n]", temp_string);
-        while (strcmp (temp_string, "0") != 0)
+        while ((dxf_read_group_code (fp, &group_code) == EXIT_SUCCESS)
+          && (group_code != 0))
         {
-                if (ferror (fp->fp))
+                if (dxf_read_error (fp))
                 {
                         fprintf (stderr,
                           (_("Error in %s () while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
-                        fclose (fp->fp);
-                        /* Clean up. */
-                        free (temp_string);
                         return (NULL);
                 }
-                if (strcmp (temp_string, "0") == 0)
-                {
-                        /* Now follows a string containing a record type
-                         * number. */
-                        /*! \bug \c record_type has group code 0 which
-                         * will cause a parsing error and \c record_type
-                         * and other \c class variables  will not be
-                         * read. See the while condition above.
-                         */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, class->record_type);
-                }
-                else if (strcmp (temp_string, "1") == 0)
-                {
-                        /* Now follows a string containing a record
-                         * name. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, class->record_name);
-                }
-                else if (strcmp (temp_string, "2") == 0)
-                {
-                        /* Now follows a string containing a class name.
-                         */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, class->class_name);
-                }
-                else if (strcmp (temp_string, "3") == 0)
-                {
-                        /* Now follows a string containing the
-                         * application name. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, class->app_name);
-                }
-                else if (strcmp (temp_string, "90") == 0)
-                {
-                        /* Now follows a string containing the
-                         * proxy cap flag value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%" PRIi32 "\n", &class->proxy_cap_flag);
-                }
-                else if (strcmp (temp_string, "280") == 0)
-                {
-                        /* Now follows a string containing the
-                         * was a proxy flag value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%hd\n", &class->was_a_proxy_flag);
-                }
-                else if (strcmp (temp_string, "281") == 0)
-                {
-                        /* Now follows a string containing the
-                         * is an entity flag value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%hd\n", &class->is_an_entity_flag);
-                }
-                else if (strcmp (temp_string, "999") == 0)
+                switch (group_code)
                 {
-                        /* Now follows a string containing a comment. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
-                        fprintf (stdout, "DXF comment: %s\n", temp_string);
-                }
-                else
-                {
-                        fprintf (stderr,
-                          (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
-                          __FUNCTION__, fp->filename, fp->line_number);
+                        case 0:
+                                /* Now follows a string containing a record type
+                                 * number. */
+                                /*! \bug \c record_type has group code 0 which
+                                 * will cause a parsing error and \c record_type
+                                 * and other \c class variables  will not be
+                                 * read. See the while condition above.
+                                 */
+                                dxf_read_string (fp, &class->record_type);
+                                break;
+                        case 1:
+                                /* Now follows a string containing a record
+                                 * name. */
+                                dxf_read_string (fp, &class->record_name);
+                                break;
+                        case 2:
+                                /* Now follows a string containing a class name.
+                                 */
+                                dxf_read_string (fp, &class->class_name);
+                                break;
+                        case 3:
+                                /* Now follows a string containing the
+                                 * application name. */
+                                dxf_read_string (fp, &class->app_name);
+                                break;
+                        case 90:
+                                /* Now follows a string containing the
+                                 * proxy cap flag value. */
+                                dxf_read_int32 (fp, &class->proxy_cap_flag);
+                                break;
+                        case 280:
+                                /* Now follows a string containing the
+                                 * was a proxy flag value. */
+                                dxf_read_int16 (fp, &class->was_a_proxy_flag);
+                                break;
+                        case 281:
+                                /* Now follows a string containing the
+                                 * is an entity flag value. */
+                                dxf_read_int16 (fp, &class->is_an_entity_flag);
+                                break;
+                        case 999:
+                                /* Now follows a string containing a comment. */
+                                dxf_read_line (temp_string, fp);
+                                fprintf (stdout, "DXF comment: %s\n", temp_string);
+                                break;
+                        default:
+                                fprintf (stderr,
+                                  (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
+                                  __FUNCTION__, fp->filename, fp->line_number);
+                                /* Skip the value of the unknown group code. */
+                                dxf_read_line (temp_string, fp);
+                                break;
                 }
         }
         /* Handle omitted members and/or illegal values. */
@@ -275,8 +259,6 @@ dxf_class_read
                   __FUNCTION__, fp->filename, fp->line_number);
                 return (NULL);
         }
-        /* Clean up. */
-        free (temp_string);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -302,7 +284,7 @@ dxf_class_write
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        char *dxf_entity_name = strdup ("CLASS");
+        char *dxf_entity_name = dxf_strdup ("CLASS");
 
         /* Do some basic checks. */
         if (fp == NULL)
@@ -311,7 +293,7 @@ dxf_class_write
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (class == NULL)
@@ -320,7 +302,7 @@ dxf_class_write
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if ((!class->record_type)
@@ -330,7 +312,7 @@ dxf_class_write
                   (_("Error in %s () empty record type string for the %s entity\n")),
                   __FUNCTION__, dxf_entity_name);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if ((!class->class_name)
@@ -340,7 +322,7 @@ dxf_class_write
                   (_("Error in %s () empty class name string for the %s entity\n")),
                   __FUNCTION__, dxf_entity_name);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (!class->record_name)
@@ -351,7 +333,7 @@ dxf_class_write
                 fprintf (stderr,
                   (_("\trecord_name of %s entity is reset to \"\"")),
                   dxf_entity_name );
-                class->record_name = strdup ("");
+                class->record_name = dxf_strdup ("");
         }
         if (!class->app_name)
         {
@@ -361,21 +343,21 @@ dxf_class_write
                 fprintf (stderr,
                   (_("\tapp_name of %s entity is reset to \"\"")),
                   dxf_entity_name );
-                class->app_name = strdup ("");
+                class->app_name = dxf_strdup ("");
         }
         /* Start writing output. */
-        fprintf (fp->fp, "  0\n%s\n", dxf_entity_name);
-        fprintf (fp->fp, "  1\n%s\n", class->record_name);
-        fprintf (fp->fp, "  2\n%s\n", class->class_name);
+        dxf_write_string (fp, 0, dxf_entity_name);
+        dxf_write_string (fp, 1, class->record_name);
+        dxf_write_string (fp, 2, class->class_name);
         if (fp->acad_version_number >= AutoCAD_14)
         {
-                fprintf (fp->fp, "  3\n%s\n", class->app_name);
+                dxf_write_string (fp, 3, class->app_name);
         }
-        fprintf (fp->fp, " 90\n%" PRIi32 "\n", class->proxy_cap_flag);
-        fprintf (fp->fp, "280\n%hd\n", class->was_a_proxy_flag);
-        fprintf (fp->fp, "281\n%hd\n", class->is_an_entity_flag);
+        dxf_write_int (fp, 90, class->proxy_cap_flag);
+        dxf_write_int (fp, 280, class->was_a_proxy_flag);
+        dxf_write_int (fp, 281, class->is_an_entity_flag);
         /* Clean up. */
-        free (dxf_entity_name);
+        dxf_free (dxf_entity_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -408,7 +390,7 @@ dxf_class_write_endclass
                 return (EXIT_FAILURE);
         }
         /* Start writing output. */
-        fprintf (fp->fp, "  0\nENDSEC\n");
+        dxf_write_string (fp, 0, "ENDSEC");
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -448,11 +430,11 @@ dxf_class_free
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        free (class->record_type);
-        free (class->record_name);
-        free (class->class_name);
-        free (class->app_name);
-        free (class);
+        dxf_free (class->record_type);
+        dxf_free (class->record_name);
+        dxf_free (class->class_name);
+        dxf_free (class->app_name);
+        dxf_free (class);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -525,7 +507,7 @@ dxf_class_get_record_type
                   __FUNCTION__);
                 return (NULL);
         }
-        result = strdup (class->record_type);
+        result = dxf_strdup (class->record_type);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -563,7 +545,7 @@ dxf_class_set_record_type
                   __FUNCTION__);
                 return (NULL);
         }
-        class->record_type = strdup (record_type);
+        class->record_type = dxf_strdup (record_type);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -603,7 +585,7 @@ dxf_class_get_record_name
                   __FUNCTION__);
                 return (NULL);
         }
-        result = strdup (class->record_name);
+        result = dxf_strdup (class->record_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -641,7 +623,7 @@ dxf_class_set_record_name
                   __FUNCTION__);
                 return (NULL);
         }
-        class->record_name = strdup (record_name);
+        class->record_name = dxf_strdup (record_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -681,7 +663,7 @@ dxf_class_get_class_name
                   __FUNCTION__);
                 return (NULL);
         }
-        result = strdup (class->class_name);
+        result = dxf_strdup (class->class_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -719,7 +701,7 @@ dxf_class_set_class_name
                   __FUNCTION__);
                 return (NULL);
         }
-        class->class_name = strdup (class_name);
+        class->class_name = dxf_strdup (class_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -759,7 +741,7 @@ dxf_class_get_app_name
                   __FUNCTION__);
                 return (NULL);
         }
-        result = strdup (class->app_name);
+        result = dxf_strdup (class->app_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -798,7 +780,7 @@ dxf_class_set_app_name
                   __FUNCTION__);
                 return (NULL);
         }
-        class->app_name = strdup (app_name);
+        class->app_name = dxf_strdup (app_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -41,6 +41,7 @@
  */
 
 #include "comment.h"
+#include "util.h"
 
 /*!
  * \brief Allocate memory for a DXF \c COMMENT.
@@ -59,7 +60,7 @@ dxf_comment_new ()
         size = sizeof (DxfComment);
         /* avoid malloc of 0 bytes */
         if (size == 0) size = 1;
-        if ((comment = malloc (size)) == NULL)
+        if ((comment = dxf_malloc (size)) == NULL)
         {
                 fprintf (stderr,
                   (_("Error in %s () could not allocate memory for a DxfComment struct.\n")),
@@ -110,7 +111,7 @@ dxf_comment_init
                 return (NULL);
         }
         dxf_comment_set_id_code (comment, 0);
-        dxf_comment_set_value (comment, strdup (""));
+        dxf_comment_set_value (comment, dxf_strdup (""));
         dxf_comment_set_next (comment, NULL);
 #ifdef DEBUG
         DXF_DEBUG_END
@@ -159,7 +160,7 @@ dxf_comment_write
         DxfComment *iter = (DxfComment *) comment;
         while (dxf_comment_get_value (iter) != NULL)
         {
-                fprintf (fp->fp, "999\n%s\n", dxf_comment_get_value (iter));
+                dxf_write_string (fp, 999, dxf_comment_get_value (iter));
                 iter = dxf_comment_get_next (iter);
         }
 #if DEBUG
@@ -201,8 +202,8 @@ dxf_comment_free
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        free (dxf_comment_get_value (comment));
-        free (comment);
+        dxf_free (dxf_comment_get_value (comment));
+        dxf_free (comment);
 #ifdef DEBUG
         DXF_DEBUG_END
 #endif
@@ -248,7 +249,7 @@ dxf_comment_free_list
  *
  * \return ID code.
  */
-int
+uint64_t
 dxf_comment_get_id_code
 (
         DxfComment *comment
@@ -266,13 +267,6 @@ dxf_comment_get_id_code
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (comment->id_code < 0)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a negative value was found in the id-code member.\n")),
-                  __FUNCTION__);
-                return (EXIT_FAILURE);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -288,7 +282,7 @@ dxf_comment_set_id_code
 (
         DxfComment *comment,
                 /*!< a pointer to a DXF \c COMMENT entity. */
-        int id_code
+        uint64_t id_code
                 /*!< Identification number for the entity.\n
                  * This is to be an unique (sequential) number in the DXF
                  * file. */
@@ -305,13 +299,6 @@ dxf_comment_set_id_code
                   __FUNCTION__);
                 return (NULL);
         }
-        if (id_code < 0)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a negative id-code value was passed.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
         comment->id_code = id_code;
 #if DEBUG
         DXF_DEBUG_END
@@ -383,7 +370,7 @@ dxf_comment_set_value
                 __FUNCTION__);
               return (NULL);
         }
-        comment->value = strdup (value);
+        comment->value = dxf_strdup (value);
 #if DEBUG
         DXF_DEBUG_END
 #endif
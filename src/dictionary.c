@@ -42,6 +42,7 @@
 
 
 #include "dictionary.h"
+#include "util.h"
 
 
 /*!
@@ -61,7 +62,7 @@ dxf_dictionary_new ()
         size = sizeof (DxfDictionary);
         /* avoid malloc of 0 bytes */
         if (size == 0) size = 1;
-        if ((dictionary = malloc (size)) == NULL)
+        if ((dictionary = dxf_malloc (size)) == NULL)
         {
                 fprintf (stderr,
                   (_("Error in %s () could not allocate memory for a DxfDictionary struct.\n")),
@@ -111,11 +112,11 @@ dxf_dictionary_init
                   __FUNCTION__);
                 return (NULL);
         }
-        dictionary->id_code = 0;
-        dictionary->dictionary_owner_soft = strdup ("");
-        dictionary->dictionary_owner_hard = strdup ("");
-        dictionary->entry_name = strdup ("");
-        dictionary->entry_object_handle = strdup ("");
+        dictionary->id_code = DXF_HANDLE_NONE;
+        dictionary->dictionary_owner_soft = 0;
+        dictionary->dictionary_owner_hard = 0;
+        dictionary->entry_name = dxf_strdup ("");
+        dictionary->entry_object_handle = 0;
         dictionary->next = NULL;
 #if DEBUG
         DXF_DEBUG_END
@@ -146,7 +147,8 @@ dxf_dictionary_read
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        char *temp_string = NULL;
+        char temp_string[DXF_MAX_STRING_LENGTH];
+        int group_code;
 
         /* Do some basic checks. */
         if (fp == NULL)
@@ -154,8 +156,6 @@ dxf_dictionary_read
                 fprintf (stderr,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
-                /* Clean up. */
-                free (temp_string);
                 return (NULL);
         }
         if (fp->acad_version_number < AutoCAD_13)
@@ -171,85 +171,80 @@ dxf_dictionary_read
                   __FUNCTION__);
                 dictionary = dxf_dictionary_init (dictionary);
         }
-        (fp->line_number)++;
-        fscanf (fp->fp, "%[^\n]", temp_string);
-        while (strcmp (temp_string, "0") != 0)
+        while ((dxf_read_group_code (fp, &group_code) == EXIT_SUCCESS)
+          && (group_code != 0))
         {
-                if (ferror (fp->fp))
+                if (dxf_read_error (fp))
                 {
                         fprintf (stderr,
                           (_("Error in %s () while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
                         /* Clean up. */
-                        free (temp_string);
-                        fclose (fp->fp);
                         return (NULL);
                 }
-                else if (strcmp (temp_string, "3") == 0)
-                {
-                        /* Now follows a string containing additional
-                         * proprietary data. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, dictionary->entry_name);
-                }
-                if (strcmp (temp_string, "5") == 0)
-                {
-                        /* Now follows a string containing a sequential
-                         * id number. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%x\n", (uint *) &dictionary->id_code);
-                }
-                else if ((fp->acad_version_number >= AutoCAD_13)
-                        && (strcmp (temp_string, "100") == 0))
+                switch (group_code)
                 {
-                        /* Now follows a string containing the
-                         * subclass marker value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
-                        if (strcmp (temp_string, "AcDbDictionary") != 0)
-                        {
+                        case 3:
+                                /* Now follows a string containing additional
+                                 * proprietary data. */
+                                dxf_read_string (fp, &dictionary->entry_name);
+                                break;
+                        case 5:
+                                /* Now follows a string containing a sequential
+                                 * id number. */
+                                dxf_read_handle (fp, &dictionary->id_code);
+                                break;
+                        case 100:
+                                if (fp->acad_version_number >= AutoCAD_13)
+                                {
+                                        /* Now follows a string containing the
+                                         * subclass marker value. */
+                                        dxf_read_line (temp_string, fp);
+                                        if (strcmp (temp_string, "AcDbDictionary") != 0)
+                                        {
+                                                fprintf (stderr,
+                                                  (_("Warning in %s () found a bad subclass marker in: %s in line: %d.\n")),
+                                                  __FUNCTION__, fp->filename, fp->line_number);
+                                        }
+                                }
+                                else
+                                {
+                                        fprintf (stderr,
+                                          (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
+                                          __FUNCTION__, fp->filename, fp->line_number);
+                                        /* Skip the value of the unknown group code. */
+                                        dxf_read_line (temp_string, fp);
+                                }
+                                break;
+                        case 330:
+                                /* Now follows a string containing Soft-pointer
+                                 * ID/handle to owner dictionary. */
+                                dxf_read_handle (fp, &dictionary->dictionary_owner_soft);
+                                break;
+                        case 350:
+                                /* Now follows a string containing a handle to ae
+                                 * entry object. */
+                                dxf_read_handle (fp, &dictionary->entry_object_handle);
+                                break;
+                        case 360:
+                                /* Now follows a string containing Hard owner
+                                 * ID/handle to owner dictionary. */
+                                dxf_read_handle (fp, &dictionary->dictionary_owner_hard);
+                                break;
+                        case 999:
+                                /* Now follows a string containing a comment. */
+                                dxf_read_line (temp_string, fp);
+                                fprintf (stdout, (_("DXF comment: %s\n")), temp_string);
+                                break;
+                        default:
                                 fprintf (stderr,
-                                  (_("Warning in %s () found a bad subclass marker in: %s in line: %d.\n")),
+                                  (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
                                   __FUNCTION__, fp->filename, fp->line_number);
-                        }
-                }
-                else if (strcmp (temp_string, "330") == 0)
-                {
-                        /* Now follows a string containing Soft-pointer
-                         * ID/handle to owner dictionary. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, dictionary->dictionary_owner_soft);
-                }
-                else if (strcmp (temp_string, "350") == 0)
-                {
-                        /* Now follows a string containing a handle to ae
-                         * entry object. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, dictionary->entry_object_handle);
-                }
-                else if (strcmp (temp_string, "360") == 0)
-                {
-                        /* Now follows a string containing Hard owner
-                         * ID/handle to owner dictionary. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, dictionary->dictionary_owner_hard);
-                }
-                else if (strcmp (temp_string, "999") == 0)
-                {
-                        /* Now follows a string containing a comment. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
-                        fprintf (stdout, (_("DXF comment: %s\n")), temp_string);
-                }
-                else
-                {
-                        fprintf (stderr,
-                          (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
-                          __FUNCTION__, fp->filename, fp->line_number);
+                                /* Skip the value of the unknown group code. */
+                                dxf_read_line (temp_string, fp);
+                                break;
                 }
         }
-        /* Clean up. */
-        free (temp_string);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -275,7 +270,7 @@ dxf_dictionary_write
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        char *dxf_entity_name = strdup ("DICTIONARY");
+        char *dxf_entity_name = dxf_strdup ("DICTIONARY");
 
         /* Do some basic checks. */
         if (fp == NULL)
@@ -284,7 +279,7 @@ dxf_dictionary_write
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (dictionary == NULL)
@@ -293,29 +288,29 @@ dxf_dictionary_write
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (strcmp (dictionary->entry_name, "") == 0)
         {
                 fprintf (stderr,
-                  (_("Error in %s () empty entry name string for the %s entity with id-code: %x\n")),
+                  (_("Error in %s () empty entry name string for the %s entity with id-code: %" PRIx64 "\n")),
                   __FUNCTION__, dxf_entity_name, dictionary->id_code);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (fp->acad_version_number < AutoCAD_13)
         {
                 fprintf (stderr,
-                  (_("Warning in %s () illegal DXF version for this %s entity with id-code: %x.\n")),
+                  (_("Warning in %s () illegal DXF version for this %s entity with id-code: %" PRIx64 ".\n")),
                   __FUNCTION__, dxf_entity_name, dictionary->id_code);
         }
         /* Start writing output. */
-        fprintf (fp->fp, "  0\n%s\n", dxf_entity_name);
-        if (dictionary->id_code != -1)
+        dxf_write_string (fp, 0, dxf_entity_name);
+        if (dictionary->id_code != DXF_HANDLE_NONE)
         {
-                fprintf (fp->fp, "  5\n%x\n", dictionary->id_code);
+                dxf_write_hex (fp, 5, dictionary->id_code);
         }
         /*!
          * \todo for version R14.\n
@@ -327,28 +322,28 @@ dxf_dictionary_write
          * 102 groups are application defined (optional).\n\n
          * End of group, "}" (optional), with Group code 102.
          */
-        if ((strcmp (dictionary->dictionary_owner_soft, "") != 0)
+        if ((dictionary->dictionary_owner_soft != 0)
           && (fp->acad_version_number >= AutoCAD_14))
         {
-                fprintf (fp->fp, "102\n{ACAD_REACTORS\n");
-                fprintf (fp->fp, "330\n%s\n", dictionary->dictionary_owner_soft);
-                fprintf (fp->fp, "102\n}\n");
+                dxf_write_string (fp, 102, "{ACAD_REACTORS");
+                dxf_write_hex (fp, 330, dictionary->dictionary_owner_soft);
+                dxf_write_string (fp, 102, "}");
         }
-        if ((strcmp (dictionary->dictionary_owner_hard, "") != 0)
+        if ((dictionary->dictionary_owner_hard != 0)
           && (fp->acad_version_number >= AutoCAD_14))
         {
-                fprintf (fp->fp, "102\n{ACAD_XDICTIONARY\n");
-                fprintf (fp->fp, "360\n%s\n", dictionary->dictionary_owner_hard);
-                fprintf (fp->fp, "102\n}\n");
+                dxf_write_string (fp, 102, "{ACAD_XDICTIONARY");
+                dxf_write_hex (fp, 360, dictionary->dictionary_owner_hard);
+                dxf_write_string (fp, 102, "}");
         }
         if (fp->acad_version_number >= AutoCAD_13)
         {
-                fprintf (fp->fp, "100\nAcDbDictionary\n");
+                dxf_write_string (fp, 100, "AcDbDictionary");
         }
-        fprintf (fp->fp, "  3\n%s\n", dictionary->entry_name);
-        fprintf (fp->fp, "350\n%s\n", dictionary->entry_object_handle);
+        dxf_write_string (fp, 3, dictionary->entry_name);
+        dxf_write_hex (fp, 350, dictionary->entry_object_handle);
         /* Clean up. */
-        free (dxf_entity_name);
+        dxf_free (dxf_entity_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -389,11 +384,8 @@ dxf_dictionary_free
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        free (dictionary->dictionary_owner_soft);
-        free (dictionary->dictionary_owner_hard);
-        free (dictionary->entry_name);
-        free (dictionary->entry_object_handle);
-        free (dictionary);
+        dxf_free (dictionary->entry_name);
+        dxf_free (dictionary);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -439,7 +431,7 @@ dxf_dictionary_free_list
  *
  * \return ID code.
  */
-int
+uint64_t
 dxf_dictionary_get_id_code
 (
         DxfDictionary *dictionary
@@ -457,12 +449,6 @@ dxf_dictionary_get_id_code
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (dictionary->id_code < 0)
-        {
-                fprintf (stderr,
-                  (_("Warning in %s () a negative value was found.\n")),
-                  __FUNCTION__);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -478,7 +464,7 @@ dxf_dictionary_set_id_code
 (
         DxfDictionary *dictionary,
                 /*!< a pointer to a DXF \c DICTIONARY object. */
-        int id_code
+        uint64_t id_code
                 /*!< Identification number for the object.\n
                  * This is to be an unique (sequential) number in the DXF
                  * file. */
@@ -495,12 +481,6 @@ dxf_dictionary_set_id_code
                   __FUNCTION__);
                 return (NULL);
         }
-        if (id_code < 0)
-        {
-                fprintf (stderr,
-                  (_("Warning in %s () a negative value was passed.\n")),
-                  __FUNCTION__);
-        }
         dictionary->id_code = id_code;
 #if DEBUG
         DXF_DEBUG_END
@@ -514,10 +494,8 @@ dxf_dictionary_set_id_code
  * \c DICTIONARY object.
  *
  * \return soft pointer to the dictionary owner.
- *
- * \warning No checks are performed on the returned pointer (string).
  */
-char *
+uint64_t
 dxf_dictionary_get_dictionary_owner_soft
 (
         DxfDictionary *dictionary
@@ -533,19 +511,12 @@ dxf_dictionary_get_dictionary_owner_soft
                 fprintf (stderr,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
-                return (NULL);
-        }
-        if (dictionary->dictionary_owner_soft ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
+                return (0);
         }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (dictionary->dictionary_owner_soft));
+        return (dictionary->dictionary_owner_soft);
 }
 
 
@@ -558,8 +529,8 @@ dxf_dictionary_set_dictionary_owner_soft
 (
         DxfDictionary *dictionary,
                 /*!< a pointer to a DXF \c DICTIONARY object. */
-        char *dictionary_owner_soft
-                /*!< a string containing the pointer to the
+        uint64_t dictionary_owner_soft
+                /*!< the handle of the
                  * dictionary_owner_soft for the object. */
 )
 {
@@ -574,14 +545,7 @@ dxf_dictionary_set_dictionary_owner_soft
                   __FUNCTION__);
                 return (NULL);
         }
-        if (dictionary_owner_soft == NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was passed.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
-        dictionary->dictionary_owner_soft = strdup (dictionary_owner_soft);
+        dictionary->dictionary_owner_soft = dictionary_owner_soft;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -594,10 +558,8 @@ dxf_dictionary_set_dictionary_owner_soft
  * \c DICTIONARY object.
  *
  * \return hard pointer to the dictionary owner.
- *
- * \warning No checks are performed on the returned pointer (string).
  */
-char *
+uint64_t
 dxf_dictionary_get_dictionary_owner_hard
 (
         DxfDictionary *dictionary
@@ -613,19 +575,12 @@ dxf_dictionary_get_dictionary_owner_hard
                 fprintf (stderr,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
-                return (NULL);
-        }
-        if (dictionary->dictionary_owner_hard ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
+                return (0);
         }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (dictionary->dictionary_owner_hard));
+        return (dictionary->dictionary_owner_hard);
 }
 
 
@@ -638,8 +593,8 @@ dxf_dictionary_set_dictionary_owner_hard
 (
         DxfDictionary *dictionary,
                 /*!< a pointer to a DXF \c DICTIONARY object. */
-        char *dictionary_owner_hard
-                /*!< a string containing the pointer to the
+        uint64_t dictionary_owner_hard
+                /*!< the handle of the
                  * dictionary_owner_hard for the entity. */
 )
 {
@@ -654,14 +609,7 @@ dxf_dictionary_set_dictionary_owner_hard
                   __FUNCTION__);
                 return (NULL);
         }
-        if (dictionary_owner_hard == NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was passed.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
-        dictionary->dictionary_owner_hard = strdup (dictionary_owner_hard);
+        dictionary->dictionary_owner_hard = dictionary_owner_hard;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -702,7 +650,7 @@ dxf_dictionary_get_entry_name
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (dictionary->entry_name));
+        return (dxf_strdup (dictionary->entry_name));
 }
 
 
@@ -736,7 +684,7 @@ dxf_dictionary_set_entry_name
                   __FUNCTION__);
                 return (NULL);
         }
-        dictionary->entry_name = strdup (entry_name);
+        dictionary->entry_name = dxf_strdup (entry_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -747,9 +695,9 @@ dxf_dictionary_set_entry_name
 /*!
  * \brief Get the entry object handle from a DXF \c DICTIONARY object.
  *
- * \return entry object handle when sucessful, \c NULL when an error occurred.
+ * \return entry object handle when sucessful, 0 when an error occurred.
  */
-char *
+uint64_t
 dxf_dictionary_get_entry_object_handle
 (
         DxfDictionary *dictionary
@@ -765,19 +713,12 @@ dxf_dictionary_get_entry_object_handle
                 fprintf (stderr,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
-                return (NULL);
-        }
-        if (dictionary->entry_object_handle ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
+                return (0);
         }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (dictionary->entry_object_handle));
+        return (dictionary->entry_object_handle);
 }
 
 
@@ -789,7 +730,7 @@ dxf_dictionary_set_entry_object_handle
 (
         DxfDictionary *dictionary,
                 /*!< a pointer to a DXF \c DICTIONARY object. */
-        char *entry_object_handle
+        uint64_t entry_object_handle
                 /*!< a string containing the entry object handle for the
                  * entity. */
 )
@@ -805,14 +746,7 @@ dxf_dictionary_set_entry_object_handle
                   __FUNCTION__);
                 return (NULL);
         }
-        if (entry_object_handle == NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was passed.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
-        dictionary->entry_object_handle = strdup (entry_object_handle);
+        dictionary->entry_object_handle = entry_object_handle;
 #if DEBUG
         DXF_DEBUG_END
 #endif
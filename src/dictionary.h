@@ -60,22 +60,22 @@ typedef struct
 dxf_dictionary_struct
 {
         /* Members common for all DXF group objects. */
-        int id_code;
+        uint64_t id_code;
                 /*!< Identification number for the entity.\n
                  * This is to be an unique (sequential) number in the DXF
                  * file.\n
                  * Group code = 5. */
-        char *dictionary_owner_soft;
+        uint64_t dictionary_owner_soft;
                 /*!< Soft-pointer ID/handle to owner dictionary (optional).\n
                  * Group code = 330. */
-        char *dictionary_owner_hard;
+        uint64_t dictionary_owner_hard;
                 /*!< Hard owner ID/handle to owner dictionary (optional).\n
                  * Group code = 360. */
         /* Specific members for a DXF dictionary. */
         char *entry_name;
                 /*!< Entry name (one for each entry).\n
                  * Group code = 3. */
-        char *entry_object_handle;
+        uint64_t entry_object_handle;
                 /*!< Handle of entry object (one for each entry).\n
                  * Group code = 350. */
         struct DxfDictionary *next;
@@ -90,16 +90,16 @@ DxfDictionary *dxf_dictionary_read (DxfFile *fp, DxfDictionary *dictionary);
 int dxf_dictionary_write (DxfFile *fp, DxfDictionary *dictionary);
 int dxf_dictionary_free (DxfDictionary *dictionary);
 void dxf_dictionary_free_list (DxfDictionary *dictionaries);
-int dxf_dictionary_get_id_code (DxfDictionary *dictionary);
-DxfDictionary *dxf_dictionary_set_id_code (DxfDictionary *dictionary, int id_code);
-char *dxf_dictionary_get_dictionary_owner_soft (DxfDictionary *dictionary);
-DxfDictionary *dxf_dictionary_set_dictionary_owner_soft (DxfDictionary *dictionary, char *dictionary_owner_soft);
-char *dxf_dictionary_get_dictionary_owner_hard (DxfDictionary *dictionary);
-DxfDictionary *dxf_dictionary_set_dictionary_owner_hard (DxfDictionary *dictionary, char *dictionary_owner_hard);
+uint64_t dxf_dictionary_get_id_code (DxfDictionary *dictionary);
+DxfDictionary *dxf_dictionary_set_id_code (DxfDictionary *dictionary, uint64_t id_code);
+uint64_t dxf_dictionary_get_dictionary_owner_soft (DxfDictionary *dictionary);
+DxfDictionary *dxf_dictionary_set_dictionary_owner_soft (DxfDictionary *dictionary, uint64_t dictionary_owner_soft);
+uint64_t dxf_dictionary_get_dictionary_owner_hard (DxfDictionary *dictionary);
+DxfDictionary *dxf_dictionary_set_dictionary_owner_hard (DxfDictionary *dictionary, uint64_t dictionary_owner_hard);
 char *dxf_dictionary_get_entry_name (DxfDictionary *dictionary);
 DxfDictionary *dxf_dictionary_set_entry_name (DxfDictionary *dictionary, char *entry_name);
-char *dxf_dictionary_get_entry_object_handle (DxfDictionary *dictionary);
-DxfDictionary *dxf_dictionary_set_entry_object_handle (DxfDictionary *dictionary, char *entry_object_handle);
+uint64_t dxf_dictionary_get_entry_object_handle (DxfDictionary *dictionary);
+DxfDictionary *dxf_dictionary_set_entry_object_handle (DxfDictionary *dictionary, uint64_t entry_object_handle);
 DxfDictionary *dxf_dictionary_get_next (DxfDictionary *dictionary);
 DxfDictionary *dxf_dictionary_set_next (DxfDictionary *dictionary, DxfDictionary *next);
 DxfDictionary *dxf_dictionary_get_last (DxfDictionary *dictionary);
@@ -42,6 +42,7 @@
 
 
 #include "dictionaryvar.h"
+#include "util.h"
 
 
 /*!
@@ -61,7 +62,7 @@ dxf_dictionaryvar_new ()
         size = sizeof (DxfDictionaryVar);
         /* avoid malloc of 0 bytes */
         if (size == 0) size = 1;
-        if ((dictionaryvar = malloc (size)) == NULL)
+        if ((dictionaryvar = dxf_malloc (size)) == NULL)
         {
                 fprintf (stderr,
                   (_("Error in %s () could not allocate memory.\n")),
@@ -112,10 +113,10 @@ dxf_dictionaryvar_init
                 return (NULL);
         }
         dxf_dictionaryvar_set_id_code (dictionaryvar, 0);
-        dxf_dictionaryvar_set_value (dictionaryvar, strdup (""));
-        dxf_dictionaryvar_set_object_schema_number (dictionaryvar, strdup (""));
-        dxf_dictionaryvar_set_dictionary_owner_soft (dictionaryvar, strdup (""));
-        dxf_dictionaryvar_set_dictionary_owner_hard (dictionaryvar, strdup (""));
+        dxf_dictionaryvar_set_value (dictionaryvar, dxf_strdup (""));
+        dxf_dictionaryvar_set_object_schema_number (dictionaryvar, dxf_strdup (""));
+        dxf_dictionaryvar_set_dictionary_owner_soft (dictionaryvar, 0);
+        dxf_dictionaryvar_set_dictionary_owner_hard (dictionaryvar, 0);
         dxf_dictionaryvar_set_next (dictionaryvar, NULL);
 #if DEBUG
         DXF_DEBUG_END
@@ -146,7 +147,8 @@ dxf_dictionaryvar_read
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        char *temp_string = NULL;
+        char temp_string[DXF_MAX_STRING_LENGTH];
+        int group_code;
 
         /* Do some basic checks. */
         if (fp == NULL)
@@ -154,8 +156,6 @@ dxf_dictionaryvar_read
                 fprintf (stderr,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
-                /* Clean up. */
-                free (temp_string);
                 return (NULL);
         }
         if (fp->acad_version_number < AutoCAD_14)
@@ -171,85 +171,80 @@ dxf_dictionaryvar_read
                   __FUNCTION__);
                 dictionaryvar = dxf_dictionaryvar_init (dictionaryvar);
         }
-        (fp->line_number)++;
-        fscanf (fp->fp, "%[^\n]", temp_string);
-        while (strcmp (temp_string, "0") != 0)
+        while ((dxf_read_group_code (fp, &group_code) == EXIT_SUCCESS)
+          && (group_code != 0))
         {
-                if (ferror (fp->fp))
+                if (dxf_read_error (fp))
                 {
                         fprintf (stderr,
                           (_("Error in %s () while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
                         /* Clean up. */
-                        free (temp_string);
-                        fclose (fp->fp);
                         return (NULL);
                 }
-                else if (strcmp (temp_string, "1") == 0)
-                {
-                        /* Now follows a string containing additional
-                         * proprietary data. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, dictionaryvar->value);
-                }
-                if (strcmp (temp_string, "5") == 0)
-                {
-                        /* Now follows a string containing a sequential
-                         * id number. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%x\n", (uint *) &dictionaryvar->id_code);
-                }
-                else if ((fp->acad_version_number >= AutoCAD_13)
-                        && (strcmp (temp_string, "100") == 0))
+                switch (group_code)
                 {
-                        /* Now follows a string containing the
-                         * subclass marker value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
-                        if (strcmp (temp_string, "DictionaryVariables") != 0)
-                        {
+                        case 1:
+                                /* Now follows a string containing additional
+                                 * proprietary data. */
+                                dxf_read_string (fp, &dictionaryvar->value);
+                                break;
+                        case 5:
+                                /* Now follows a string containing a sequential
+                                 * id number. */
+                                dxf_read_handle (fp, &dictionaryvar->id_code);
+                                break;
+                        case 100:
+                                if (fp->acad_version_number >= AutoCAD_13)
+                                {
+                                        /* Now follows a string containing the
+                                         * subclass marker value. */
+                                        dxf_read_line (temp_string, fp);
+                                        if (strcmp (temp_string, "DictionaryVariables") != 0)
+                                        {
+                                                fprintf (stderr,
+                                                  (_("Warning in %s () found a bad subclass marker in: %s in line: %d.\n")),
+                                                  __FUNCTION__, fp->filename, fp->line_number);
+                                        }
+                                }
+                                else
+                                {
+                                        fprintf (stderr,
+                                          (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
+                                          __FUNCTION__, fp->filename, fp->line_number);
+                                        /* Skip the value of the unknown group code. */
+                                        dxf_read_line (temp_string, fp);
+                                }
+                                break;
+                        case 280:
+                                /* Now follows a string containing a handle to ae
+                                 * entry object. */
+                                dxf_read_string (fp, &dictionaryvar->object_schema_number);
+                                break;
+                        case 330:
+                                /* Now follows a string containing Soft-pointer
+                                 * ID/handle to owner dictionary. */
+                                dxf_read_handle (fp, &dictionaryvar->dictionary_owner_soft);
+                                break;
+                        case 360:
+                                /* Now follows a string containing Hard owner
+                                 * ID/handle to owner dictionary. */
+                                dxf_read_handle (fp, &dictionaryvar->dictionary_owner_hard);
+                                break;
+                        case 999:
+                                /* Now follows a string containing a comment. */
+                                dxf_read_line (temp_string, fp);
+                                fprintf (stdout, (_("DXF comment: %s\n")), temp_string);
+                                break;
+                        default:
                                 fprintf (stderr,
-                                  (_("Warning in %s () found a bad subclass marker in: %s in line: %d.\n")),
+                                  (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
                                   __FUNCTION__, fp->filename, fp->line_number);
-                        }
-                }
-                else if (strcmp (temp_string, "280") == 0)
-                {
-                        /* Now follows a string containing a handle to ae
-                         * entry object. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, dictionaryvar->object_schema_number);
-                }
-                else if (strcmp (temp_string, "330") == 0)
-                {
-                        /* Now follows a string containing Soft-pointer
-                         * ID/handle to owner dictionary. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, dictionaryvar->dictionary_owner_soft);
-                }
-                else if (strcmp (temp_string, "360") == 0)
-                {
-                        /* Now follows a string containing Hard owner
-                         * ID/handle to owner dictionary. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, dictionaryvar->dictionary_owner_hard);
-                }
-                else if (strcmp (temp_string, "999") == 0)
-                {
-                        /* Now follows a string containing a comment. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
-                        fprintf (stdout, (_("DXF comment: %s\n")), temp_string);
-                }
-                else
-                {
-                        fprintf (stderr,
-                          (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
-                          __FUNCTION__, fp->filename, fp->line_number);
+                                /* Skip the value of the unknown group code. */
+                                dxf_read_line (temp_string, fp);
+                                break;
                 }
         }
-        /* Clean up. */
-        free (temp_string);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -275,7 +270,7 @@ dxf_dictionaryvar_write
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        char *dxf_entity_name = strdup ("DICTIONARYVAR");
+        char *dxf_entity_name = dxf_strdup ("DICTIONARYVAR");
 
         /* Do some basic checks. */
         if (fp == NULL)
@@ -284,7 +279,7 @@ dxf_dictionaryvar_write
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (dictionaryvar == NULL)
@@ -293,32 +288,32 @@ dxf_dictionaryvar_write
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (strcmp (dxf_dictionaryvar_get_value (dictionaryvar), "") == 0)
         {
                 fprintf (stderr,
-                  (_("Warning in %s () empty value string for the %s entity with id-code: %x\n")),
+                  (_("Warning in %s () empty value string for the %s entity with id-code: %" PRIx64 "\n")),
                   __FUNCTION__, dxf_entity_name, dxf_dictionaryvar_get_id_code (dictionaryvar));
         }
         if (strcmp (dxf_dictionaryvar_get_object_schema_number (dictionaryvar), "0") == 0)
         {
                 fprintf (stderr,
-                  (_("Warning in %s () empty object schema number string for the %s entity with id-code: %x\n")),
+                  (_("Warning in %s () empty object schema number string for the %s entity with id-code: %" PRIx64 "\n")),
                   __FUNCTION__, dxf_entity_name, dxf_dictionaryvar_get_id_code (dictionaryvar));
         }
         if (fp->acad_version_number < AutoCAD_14)
         {
                 fprintf (stderr,
-                  (_("Warning in %s () illegal DXF version for this %s entity with id-code: %x.\n")),
+                  (_("Warning in %s () illegal DXF version for this %s entity with id-code: %" PRIx64 ".\n")),
                   __FUNCTION__, dxf_entity_name, dxf_dictionaryvar_get_id_code (dictionaryvar));
         }
         /* Start writing output. */
-        fprintf (fp->fp, "  0\n%s\n", dxf_entity_name);
-        if (dxf_dictionaryvar_get_id_code (dictionaryvar) != -1)
+        dxf_write_string (fp, 0, dxf_entity_name);
+        if (dxf_dictionaryvar_get_id_code (dictionaryvar) != DXF_HANDLE_NONE)
         {
-                fprintf (fp->fp, "  5\n%x\n", dxf_dictionaryvar_get_id_code (dictionaryvar));
+                dxf_write_hex (fp, 5, dxf_dictionaryvar_get_id_code (dictionaryvar));
         }
         /*!
          * \todo for version R14.\n
@@ -330,28 +325,28 @@ dxf_dictionaryvar_write
          * 102 groups are application defined (optional).\n\n
          * End of group, "}" (optional), with Group code 102.
          */
-        if ((strcmp (dxf_dictionaryvar_get_dictionary_owner_soft (dictionaryvar), "") != 0)
+        if ((dxf_dictionaryvar_get_dictionary_owner_soft (dictionaryvar) != 0)
           && (fp->acad_version_number >= AutoCAD_14))
         {
-                fprintf (fp->fp, "102\n{ACAD_REACTORS\n");
-                fprintf (fp->fp, "330\n%s\n", dxf_dictionaryvar_get_dictionary_owner_soft (dictionaryvar));
-                fprintf (fp->fp, "102\n}\n");
+                dxf_write_string (fp, 102, "{ACAD_REACTORS");
+                dxf_write_hex (fp, 330, dxf_dictionaryvar_get_dictionary_owner_soft (dictionaryvar));
+                dxf_write_string (fp, 102, "}");
         }
-        if ((strcmp (dxf_dictionaryvar_get_dictionary_owner_hard (dictionaryvar), "") != 0)
+        if ((dxf_dictionaryvar_get_dictionary_owner_hard (dictionaryvar) != 0)
           && (fp->acad_version_number >= AutoCAD_14))
         {
-                fprintf (fp->fp, "102\n{ACAD_XDICTIONARY\n");
-                fprintf (fp->fp, "360\n%s\n", dxf_dictionaryvar_get_dictionary_owner_hard (dictionaryvar));
-                fprintf (fp->fp, "102\n}\n");
+                dxf_write_string (fp, 102, "{ACAD_XDICTIONARY");
+                dxf_write_hex (fp, 360, dxf_dictionaryvar_get_dictionary_owner_hard (dictionaryvar));
+                dxf_write_string (fp, 102, "}");
         }
         if (fp->acad_version_number >= AutoCAD_13)
         {
-                fprintf (fp->fp, "100\nDictionaryVariables\n");
+                dxf_write_string (fp, 100, "DictionaryVariables");
         }
-        fprintf (fp->fp, "280\n%s\n", dxf_dictionaryvar_get_object_schema_number (dictionaryvar));
-        fprintf (fp->fp, "  1\n%s\n", dxf_dictionaryvar_get_value (dictionaryvar));
+        dxf_write_string (fp, 280, dxf_dictionaryvar_get_object_schema_number (dictionaryvar));
+        dxf_write_string (fp, 1, dxf_dictionaryvar_get_value (dictionaryvar));
         /* Clean up. */
-        free (dxf_entity_name);
+        dxf_free (dxf_entity_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -392,11 +387,9 @@ dxf_dictionaryvar_free
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        free (dxf_dictionaryvar_get_dictionary_owner_soft (dictionaryvar));
-        free (dxf_dictionaryvar_get_dictionary_owner_hard (dictionaryvar));
-        free (dxf_dictionaryvar_get_value (dictionaryvar));
-        free (dxf_dictionaryvar_get_object_schema_number (dictionaryvar));
-        free (dictionaryvar);
+        dxf_free (dxf_dictionaryvar_get_value (dictionaryvar));
+        dxf_free (dxf_dictionaryvar_get_object_schema_number (dictionaryvar));
+        dxf_free (dictionaryvar);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -442,7 +435,7 @@ dxf_dictionaryvar_free_list
  *
  * \return ID code.
  */
-int
+uint64_t
 dxf_dictionaryvar_get_id_code
 (
         DxfDictionaryVar *dictionaryvar
@@ -460,12 +453,6 @@ dxf_dictionaryvar_get_id_code
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (dictionaryvar->id_code < 0)
-        {
-                fprintf (stderr,
-                  (_("Warning in %s () a negative value was found.\n")),
-                  __FUNCTION__);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -481,7 +468,7 @@ dxf_dictionaryvar_set_id_code
 (
         DxfDictionaryVar *dictionaryvar,
                 /*!< a pointer to a DXF \c DICTIONARYVAR object. */
-        int id_code
+        uint64_t id_code
                 /*!< Identification number for the object.\n
                  * This is to be an unique (sequential) number in the DXF
                  * file. */
@@ -498,12 +485,6 @@ dxf_dictionaryvar_set_id_code
                   __FUNCTION__);
                 return (NULL);
         }
-        if (id_code < 0)
-        {
-                fprintf (stderr,
-                  (_("Warning in %s () a negative value was passed.\n")),
-                  __FUNCTION__);
-        }
         dictionaryvar->id_code = id_code;
 #if DEBUG
         DXF_DEBUG_END
@@ -517,10 +498,8 @@ dxf_dictionaryvar_set_id_code
  * \c DICTIONARYVAR object.
  *
  * \return soft pointer to the dictionary owner.
- *
- * \warning No checks are performed on the returned pointer (string).
  */
-char *
+uint64_t
 dxf_dictionaryvar_get_dictionary_owner_soft
 (
         DxfDictionaryVar *dictionaryvar
@@ -536,19 +515,12 @@ dxf_dictionaryvar_get_dictionary_owner_soft
                 fprintf (stderr,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
-                return (NULL);
-        }
-        if (dictionaryvar->dictionary_owner_soft ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
+                return (0);
         }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (dictionaryvar->dictionary_owner_soft));
+        return (dictionaryvar->dictionary_owner_soft);
 }
 
 
@@ -561,8 +533,8 @@ dxf_dictionaryvar_set_dictionary_owner_soft
 (
         DxfDictionaryVar *dictionaryvar,
                 /*!< a pointer to a DXF \c DICTIONARYVAR object. */
-        char *dictionary_owner_soft
-                /*!< a string containing the pointer to the
+        uint64_t dictionary_owner_soft
+                /*!< the handle of the
                  * dictionary_owner_soft for the object. */
 )
 {
@@ -577,14 +549,7 @@ dxf_dictionaryvar_set_dictionary_owner_soft
                   __FUNCTION__);
                 return (NULL);
         }
-        if (dictionary_owner_soft == NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was passed.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
-        dictionaryvar->dictionary_owner_soft = strdup (dictionary_owner_soft);
+        dictionaryvar->dictionary_owner_soft = dictionary_owner_soft;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -597,10 +562,8 @@ dxf_dictionaryvar_set_dictionary_owner_soft
  * \c DICTIONARYVAR object.
  *
  * \return hard pointer to the dictionary owner.
- *
- * \warning No checks are performed on the returned pointer (string).
  */
-char *
+uint64_t
 dxf_dictionaryvar_get_dictionary_owner_hard
 (
         DxfDictionaryVar *dictionaryvar
@@ -616,19 +579,12 @@ dxf_dictionaryvar_get_dictionary_owner_hard
                 fprintf (stderr,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
-                return (NULL);
-        }
-        if (dictionaryvar->dictionary_owner_hard ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
+                return (0);
         }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (dictionaryvar->dictionary_owner_hard));
+        return (dictionaryvar->dictionary_owner_hard);
 }
 
 
@@ -641,8 +597,8 @@ dxf_dictionaryvar_set_dictionary_owner_hard
 (
         DxfDictionaryVar *dictionaryvar,
                 /*!< a pointer to a DXF \c DICTIONARYVAR object. */
-        char *dictionary_owner_hard
-                /*!< a string containing the pointer to the
+        uint64_t dictionary_owner_hard
+                /*!< the handle of the
                  * dictionary_owner_hard for the entity. */
 )
 {
@@ -657,14 +613,7 @@ dxf_dictionaryvar_set_dictionary_owner_hard
                   __FUNCTION__);
                 return (NULL);
         }
-        if (dictionary_owner_hard == NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was passed.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
-        dictionaryvar->dictionary_owner_hard = strdup (dictionary_owner_hard);
+        dictionaryvar->dictionary_owner_hard = dictionary_owner_hard;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -705,7 +654,7 @@ dxf_dictionaryvar_get_value
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (dictionaryvar->value));
+        return (dxf_strdup (dictionaryvar->value));
 }
 
 
@@ -739,7 +688,7 @@ dxf_dictionaryvar_set_value
                   __FUNCTION__);
                 return (NULL);
         }
-        dictionaryvar->value = strdup (value);
+        dictionaryvar->value = dxf_strdup (value);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -782,7 +731,7 @@ dxf_dictionaryvar_get_object_schema_number
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (dictionaryvar->object_schema_number));
+        return (dxf_strdup (dictionaryvar->object_schema_number));
 }
 
 
@@ -817,7 +766,7 @@ dxf_dictionaryvar_set_object_schema_number
                   __FUNCTION__);
                 return (NULL);
         }
-        dictionaryvar->object_schema_number = strdup (object_schema_number);
+        dictionaryvar->object_schema_number = dxf_strdup (object_schema_number);
 #if DEBUG
         DXF_DEBUG_END
 #endif
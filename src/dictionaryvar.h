@@ -60,15 +60,15 @@ typedef struct
 dxf_dictionaryvar_struct
 {
         /* Members common for all DXF group objects. */
-        int id_code;
+        uint64_t id_code;
                 /*!< Identification number for the entity.\n
                  * This is to be an unique (sequential) number in the DXF
                  * file.\n
                  * Group code = 5. */
-        char *dictionary_owner_soft;
+        uint64_t dictionary_owner_soft;
                 /*!< Soft-pointer ID/handle to owner dictionary (optional).\n
                  * Group code = 330. */
-        char *dictionary_owner_hard;
+        uint64_t dictionary_owner_hard;
                 /*!< Hard owner ID/handle to owner dictionary (optional).\n
                  * Group code = 360. */
         /* Specific members for a DXF dictionaryvar. */
@@ -90,12 +90,12 @@ DxfDictionaryVar *dxf_dictionaryvar_read (DxfFile *fp, DxfDictionaryVar *diction
 int dxf_dictionaryvar_write (DxfFile *fp, DxfDictionaryVar *dictionaryvar);
 int dxf_dictionaryvar_free (DxfDictionaryVar *dictionaryvar);
 void dxf_dictionaryvar_free_list (DxfDictionaryVar *dictionaryvars);
-int dxf_dictionaryvar_get_id_code (DxfDictionaryVar *dictionaryvar);
-DxfDictionaryVar *dxf_dictionaryvar_set_id_code (DxfDictionaryVar *dictionaryvar, int id_code);
-char *dxf_dictionaryvar_get_dictionary_owner_soft (DxfDictionaryVar *dictionaryvar);
-DxfDictionaryVar *dxf_dictionaryvar_set_dictionary_owner_soft (DxfDictionaryVar *dictionaryvar, char *dictionary_owner_soft);
-char *dxf_dictionaryvar_get_dictionary_owner_hard (DxfDictionaryVar *dictionaryvar);
-DxfDictionaryVar *dxf_dictionaryvar_set_dictionary_owner_hard (DxfDictionaryVar *dictionaryvar, char *dictionary_owner_hard);
+uint64_t dxf_dictionaryvar_get_id_code (DxfDictionaryVar *dictionaryvar);
+DxfDictionaryVar *dxf_dictionaryvar_set_id_code (DxfDictionaryVar *dictionaryvar, uint64_t id_code);
+uint64_t dxf_dictionaryvar_get_dictionary_owner_soft (DxfDictionaryVar *dictionaryvar);
+DxfDictionaryVar *dxf_dictionaryvar_set_dictionary_owner_soft (DxfDictionaryVar *dictionaryvar, uint64_t dictionary_owner_soft);
+uint64_t dxf_dictionaryvar_get_dictionary_owner_hard (DxfDictionaryVar *dictionaryvar);
+DxfDictionaryVar *dxf_dictionaryvar_set_dictionary_owner_hard (DxfDictionaryVar *dictionaryvar, uint64_t dictionary_owner_hard);
 char *dxf_dictionaryvar_get_value (DxfDictionaryVar *dictionaryvar);
 DxfDictionaryVar *dxf_dictionaryvar_set_value (DxfDictionaryVar *dictionaryvar, char *value);
 char *dxf_dictionaryvar_get_object_schema_number (DxfDictionaryVar *dictionaryvar);
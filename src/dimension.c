@@ -41,6 +41,7 @@
 
 
 #include "dimension.h"
+#include "util.h"
 
 
 /*!
@@ -63,7 +64,7 @@ dxf_dimension_new ()
         size = sizeof (DxfDimension);
         /* avoid malloc of 0 bytes */
         if (size == 0) size = 1;
-        if ((dimension = malloc (size)) == NULL)
+        if ((dimension = dxf_malloc (size)) == NULL)
         {
                 fprintf (stderr,
                   (_("Error in %s () could not allocate memory.\n")),
@@ -115,9 +116,9 @@ dxf_dimension_init
               return (NULL);
         }
         /* Assign initial values to members. */
-        dimension->id_code = 0;
-        dimension->linetype = strdup (DXF_DEFAULT_LINETYPE);
-        dimension->layer = strdup (DXF_DEFAULT_LAYER);
+        dimension->id_code = DXF_HANDLE_NONE;
+        dimension->linetype = dxf_strdup (DXF_DEFAULT_LINETYPE);
+        dimension->layer = dxf_strdup (DXF_DEFAULT_LAYER);
         dimension->elevation = 0.0;
         dimension->thickness = 0.0;
         dimension->linetype_scale = DXF_DEFAULT_LINETYPE_SCALE;
@@ -126,36 +127,50 @@ dxf_dimension_init
         dimension->paperspace = DXF_PAPERSPACE;
         dimension->graphics_data_size = 0;
         dimension->shadow_mode = 0;
-        dimension->dictionary_owner_soft = strdup ("");
-        dimension->object_owner_soft = strdup ("");
-        dimension->material = strdup ("");
-        dimension->dictionary_owner_hard = strdup ("");
+        dimension->dictionary_owner_soft = 0;
+        dimension->object_owner_soft = 0;
+        dimension->material = 0;
+        dimension->dictionary_owner_hard = 0;
         dimension->lineweight = 0;
-        dimension->plot_style_name = strdup ("");
+        dimension->plot_style_name = 0;
         dimension->color_value = 0;
-        dimension->color_name = strdup ("");
+        dimension->color_name = dxf_strdup ("");
         dimension->transparency = 0;
-        dimension->dim_text = strdup ("");
-        dimension->dimblock_name = strdup ("");
-        dimension->dimstyle_name = strdup ("");
+        dimension->dim_text = dxf_strdup ("");
+        dimension->dimblock_name = dxf_strdup ("");
+        dimension->dimstyle_name = dxf_strdup ("");
+        dimension->p0 = (DxfPoint *) dxf_point_new ();
+        dimension->p0 = dxf_point_init ((DxfPoint *) dimension->p0);
         dimension->p0->x0 = 0.0;
         dimension->p0->y0 = 0.0;
         dimension->p0->z0 = 0.0;
+        dimension->p1 = (DxfPoint *) dxf_point_new ();
+        dimension->p1 = dxf_point_init ((DxfPoint *) dimension->p1);
         dimension->p1->x0 = 0.0;
         dimension->p1->y0 = 0.0;
         dimension->p1->z0 = 0.0;
+        dimension->p2 = (DxfPoint *) dxf_point_new ();
+        dimension->p2 = dxf_point_init ((DxfPoint *) dimension->p2);
         dimension->p2->x0 = 0.0;
         dimension->p2->y0 = 0.0;
         dimension->p2->z0 = 0.0;
+        dimension->p3 = (DxfPoint *) dxf_point_new ();
+        dimension->p3 = dxf_point_init ((DxfPoint *) dimension->p3);
         dimension->p3->x0 = 0.0;
         dimension->p3->y0 = 0.0;
         dimension->p3->z0 = 0.0;
+        dimension->p4 = (DxfPoint *) dxf_point_new ();
+        dimension->p4 = dxf_point_init ((DxfPoint *) dimension->p4);
         dimension->p4->x0 = 0.0;
         dimension->p4->y0 = 0.0;
         dimension->p4->z0 = 0.0;
+        dimension->p5 = (DxfPoint *) dxf_point_new ();
+        dimension->p5 = dxf_point_init ((DxfPoint *) dimension->p5);
         dimension->p5->x0 = 0.0;
         dimension->p5->y0 = 0.0;
         dimension->p5->z0 = 0.0;
+        dimension->p6 = (DxfPoint *) dxf_point_new ();
+        dimension->p6 = dxf_point_init ((DxfPoint *) dimension->p6);
         dimension->p6->x0 = 0.0;
         dimension->p6->y0 = 0.0;
         dimension->p6->z0 = 0.0;
@@ -214,7 +229,8 @@ dxf_dimension_read
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        char *temp_string = NULL;
+        char temp_string[DXF_MAX_STRING_LENGTH];
+        int group_code;
         DxfBinaryData *iter310 = NULL;
         int iter330;
 
@@ -224,8 +240,6 @@ dxf_dimension_read
                 fprintf (stderr,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
-                /* Clean up. */
-                free (temp_string);
                 return (NULL);
         }
         if (dimension == NULL)
@@ -365,509 +379,392 @@ dxf_dimension_read
         }
         iter310 = (DxfBinaryData *) dimension->binary_graphics_data;
         iter330 = 0;
-        (fp->line_number)++;
-        fscanf (fp->fp, "%[^\n]", temp_string);
-        while (strcmp (temp_string, "0") != 0)
+        while ((dxf_read_group_code (fp, &group_code) == EXIT_SUCCESS)
+          && (group_code != 0))
         {
-                if (ferror (fp->fp))
+                if (dxf_read_error (fp))
                 {
                         fprintf (stderr,
                           (_("Error in %s () while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
-                        fclose (fp->fp);
-                        /* Clean up. */
-                        free (temp_string);
                         return (NULL);
                 }
-                if (strcmp (temp_string, "1") == 0)
-                {
-                        /* Now follows a string containing a dimension
-                         * text string. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, dimension->dim_text);
-                }
-                if (strcmp (temp_string, "2") == 0)
-                {
-                        /* Now follows a string containing a dimension
-                         * block name string. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, dimension->dimblock_name);
-                }
-                if (strcmp (temp_string, "3") == 0)
-                {
-                        /* Now follows a string containing a dimension
-                         * style name string. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, dimension->dimstyle_name);
-                }
-                if (strcmp (temp_string, "5") == 0)
-                {
-                        /* Now follows a string containing a sequential
-                         * id number. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%x\n", (uint *) &dimension->id_code);
-                }
-                else if (strcmp (temp_string, "6") == 0)
-                {
-                        /* Now follows a string containing a linetype
-                         * name. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, dimension->linetype);
-                }
-                else if (strcmp (temp_string, "8") == 0)
-                {
-                        /* Now follows a string containing a layer name. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, dimension->layer);
-                }
-                else if (strcmp (temp_string, "10") == 0)
-                {
-                        /* Now follows a string containing the
-                         * X-value of the definition point for all
-                         * dimension types. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &dimension->p0->x0);
-                }
-                else if (strcmp (temp_string, "20") == 0)
-                {
-                        /* Now follows a string containing the
-                         * Y-value of the definition point for all
-                         * dimension types. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &dimension->p0->y0);
-                }
-                else if (strcmp (temp_string, "30") == 0)
-                {
-                        /* Now follows a string containing the
-                         * Z-value of the definition point for all
-                         * dimension types. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &dimension->p0->z0);
-                }
-                else if (strcmp (temp_string, "11") == 0)
-                {
-                        /* Now follows a string containing the
-                         * X-value of the middle point of dimension text. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &dimension->p1->x0);
-                }
-                else if (strcmp (temp_string, "21") == 0)
-                {
-                        /* Now follows a string containing the
-                         * Y-value of the middle point of dimension text. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &dimension->p1->y0);
-                }
-                else if (strcmp (temp_string, "31") == 0)
-                {
-                        /* Now follows a string containing the
-                         * Z-value of the middle point of dimension text. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &dimension->p1->z0);
-                }
-                else if (strcmp (temp_string, "12") == 0)
-                {
-                        /* Now follows a string containing the
-                         * X-value of the dimension block translation
-                         * vector. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &dimension->p2->x0);
-                }
-                else if (strcmp (temp_string, "22") == 0)
-                {
-                        /* Now follows a string containing the
-                         * Y-value of the dimension block translation
-                         * vector. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &dimension->p2->y0);
-                }
-                else if (strcmp (temp_string, "32") == 0)
-                {
-                        /* Now follows a string containing the
-                         * Z-value of the dimension block translation
-                         * vector. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &dimension->p2->z0);
-                }
-                else if (strcmp (temp_string, "13") == 0)
-                {
-                        /* Now follows a string containing the
-                         * X-value of the definition point for linear and
-                         * angular dimensions. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &dimension->p3->x0);
-                }
-                else if (strcmp (temp_string, "23") == 0)
-                {
-                        /* Now follows a string containing the
-                         * Y-value of the definition point for linear and
-                         * angular dimensions. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &dimension->p3->y0);
-                }
-                else if (strcmp (temp_string, "33") == 0)
-                {
-                        /* Now follows a string containing the
-                         * Z-value of the definition point for linear and
-                         * angular dimensions. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &dimension->p3->z0);
-                }
-                else if (strcmp (temp_string, "14") == 0)
-                {
-                        /* Now follows a string containing the
-                         * X-value of the definition point for linear and
-                         * angular dimensions. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &dimension->p4->x0);
-                }
-                else if (strcmp (temp_string, "24") == 0)
-                {
-                        /* Now follows a string containing the
-                         * Y-value of the definition point for linear and
-                         * angular dimensions. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &dimension->p4->y0);
-                }
-                else if (strcmp (temp_string, "34") == 0)
-                {
-                        /* Now follows a string containing the
-                         * Z-value of the definition point for linear and
-                         * angular dimensions. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &dimension->p4->z0);
-                }
-                else if (strcmp (temp_string, "15") == 0)
-                {
-                        /* Now follows a string containing the
-                         * X-value of the definition point for diameter,
-                         * radius, and angular dimensions. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &dimension->p5->x0);
-                }
-                else if (strcmp (temp_string, "25") == 0)
-                {
-                        /* Now follows a string containing the
-                         * Y-value of the definition point for diameter,
-                         * radius, and angular dimensions. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &dimension->p5->y0);
-                }
-                else if (strcmp (temp_string, "35") == 0)
-                {
-                        /* Now follows a string containing the
-                         * Z-value of the definition point for diameter,
-                         * radius, and angular dimensions. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &dimension->p5->z0);
-                }
-                else if (strcmp (temp_string, "16") == 0)
-                {
-                        /* Now follows a string containing the
-                         * X-value of the point defining dimension arc for
-                         * angular dimensions. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &dimension->p6->x0);
-                }
-                else if (strcmp (temp_string, "26") == 0)
-                {
-                        /* Now follows a string containing the
-                         * Y-value of the point defining dimension arc for
-                         * angular dimensions. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &dimension->p6->y0);
-                }
-                else if (strcmp (temp_string, "36") == 0)
-                {
-                        /* Now follows a string containing the
-                         * Z-value of the point defining dimension arc for
-                         * angular dimensions. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &dimension->p6->z0);
-                }
-                else if (strcmp (temp_string, "38") == 0)
-                {
-                        /* Now follows a string containing the
-                         * elevation. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &dimension->elevation);
-                }
-                else if (strcmp (temp_string, "39") == 0)
-                {
-                        /* Now follows a string containing the
-                         * thickness. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &dimension->thickness);
-                }
-                else if (strcmp (temp_string, "40") == 0)
-                {
-                        /* Now follows a string containing the leader
-                         * length. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &dimension->leader_length);
-                }
-                else if (strcmp (temp_string, "41") == 0)
-                {
-                        /* Now follows a string containing the text line
-                         * spacing factor. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &dimension->text_line_spacing_factor);
-                }
-                else if (strcmp (temp_string, "42") == 0)
-                {
-                        /* Now follows a string containing the actual
-                         * measurement. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &dimension->actual_measurement);
-                }
-                else if (strcmp (temp_string, "48") == 0)
-                {
-                        /* Now follows a string containing the linetype
-                         * scale. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &dimension->linetype_scale);
-                }
-                else if (strcmp (temp_string, "50") == 0)
-                {
-                        /* Now follows a string containing the angle of
-                         * rotated, horizontal, or vertical linear
-                         * dimensions. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &dimension->angle);
-                }
-                else if (strcmp (temp_string, "51") == 0)
-                {
-                        /* Now follows a string containing the horizontal
-                         * direction. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &dimension->hor_dir);
-                }
-                else if (strcmp (temp_string, "52") == 0)
-                {
-                        /* Now follows a string containing the oblique
-                         * angle. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &dimension->obl_angle);
-                }
-                else if (strcmp (temp_string, "53") == 0)
-                {
-                        /* Now follows a string containing the text
-                         * angle. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &dimension->text_angle);
-                }
-                else if (strcmp (temp_string, "60") == 0)
-                {
-                        /* Now follows a string containing the
-                         * visibility value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%hd\n", &dimension->visibility);
-                }
-                else if (strcmp (temp_string, "62") == 0)
-                {
-                        /* Now follows a string containing the
-                         * color value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%hd\n", &dimension->color);
-                }
-                else if (strcmp (temp_string, "67") == 0)
-                {
-                        /* Now follows a string containing the
-                         * paperspace value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%hd\n", &dimension->paperspace);
-                }
-                else if (strcmp (temp_string, "70") == 0)
-                {
-                        /* Now follows a string containing a flag
-                         * value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%hd\n", &dimension->flag);
-                }
-                else if (strcmp (temp_string, "71") == 0)
-                {
-                        /* Now follows a string containing the attachment
-                         * point value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%hd\n", &dimension->attachment_point);
-                }
-                else if (strcmp (temp_string, "72") == 0)
-                {
-                        /* Now follows a string containing the text line
-                         * spacing value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%hd\n", &dimension->text_line_spacing);
-                }
-                else if (strcmp (temp_string, "92") == 0)
+                switch (group_code)
                 {
-                        /* Now follows a string containing the
-                         * graphics data size value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%" PRIi32 "\n", &dimension->graphics_data_size);
-                }
-                else if ((fp->acad_version_number >= AutoCAD_13)
-                        && (strcmp (temp_string, "100") == 0))
-                {
-                        /* Now follows a string containing the
-                         * subclass marker value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
-                        if ((strcmp (temp_string, "AcDbEntity") != 0)
-                          && (strcmp (temp_string, "AcDbDimension") != 0)
-                          && (strcmp (temp_string, "AcDbAlignedDimension") != 0)
-                          && (strcmp (temp_string, "AcDbRotatedDimension") != 0)
-                          && (strcmp (temp_string, "AcDb3PointAngularDimension") != 0)
-                          && (strcmp (temp_string, "AcDbDiametricDimension") != 0)
-                          && (strcmp (temp_string, "AcDbRadialDimension") != 0)
-                          && (strcmp (temp_string, "AcDbOrdinateDimension") != 0))
-                        {
+                        case 1:
+                                /* Now follows a string containing a dimension
+                                 * text string. */
+                                dxf_read_string (fp, &dimension->dim_text);
+                                break;
+                        case 2:
+                                /* Now follows a string containing a dimension
+                                 * block name string. */
+                                dxf_read_string (fp, &dimension->dimblock_name);
+                                break;
+                        case 3:
+                                /* Now follows a string containing a dimension
+                                 * style name string. */
+                                dxf_read_string_interned (fp, &dimension->dimstyle_name);
+                                break;
+                        case 5:
+                                /* Now follows a string containing a sequential
+                                 * id number. */
+                                dxf_read_handle (fp, &dimension->id_code);
+                                break;
+                        case 6:
+                                /* Now follows a string containing a linetype
+                                 * name. */
+                                dxf_read_string_interned (fp, &dimension->linetype);
+                                break;
+                        case 8:
+                                /* Now follows a string containing a layer name. */
+                                dxf_read_string_interned (fp, &dimension->layer);
+                                break;
+                        case 10:
+                                /* Now follows a string containing the
+                                 * X-value of the definition point for all
+                                 * dimension types. */
+                                dxf_read_double (fp, &dimension->p0->x0);
+                                break;
+                        case 20:
+                                /* Now follows a string containing the
+                                 * Y-value of the definition point for all
+                                 * dimension types. */
+                                dxf_read_double (fp, &dimension->p0->y0);
+                                break;
+                        case 30:
+                                /* Now follows a string containing the
+                                 * Z-value of the definition point for all
+                                 * dimension types. */
+                                dxf_read_double (fp, &dimension->p0->z0);
+                                break;
+                        case 11:
+                                /* Now follows a string containing the
+                                 * X-value of the middle point of dimension text. */
+                                dxf_read_double (fp, &dimension->p1->x0);
+                                break;
+                        case 21:
+                                /* Now follows a string containing the
+                                 * Y-value of the middle point of dimension text. */
+                                dxf_read_double (fp, &dimension->p1->y0);
+                                break;
+                        case 31:
+                                /* Now follows a string containing the
+                                 * Z-value of the middle point of dimension text. */
+                                dxf_read_double (fp, &dimension->p1->z0);
+                                break;
+                        case 12:
+                                /* Now follows a string containing the
+                                 * X-value of the dimension block translation
+                                 * vector. */
+                                dxf_read_double (fp, &dimension->p2->x0);
+                                break;
+                        case 22:
+                                /* Now follows a string containing the
+                                 * Y-value of the dimension block translation
+                                 * vector. */
+                                dxf_read_double (fp, &dimension->p2->y0);
+                                break;
+                        case 32:
+                                /* Now follows a string containing the
+                                 * Z-value of the dimension block translation
+                                 * vector. */
+                                dxf_read_double (fp, &dimension->p2->z0);
+                                break;
+                        case 13:
+                                /* Now follows a string containing the
+                                 * X-value of the definition point for linear and
+                                 * angular dimensions. */
+                                dxf_read_double (fp, &dimension->p3->x0);
+                                break;
+                        case 23:
+                                /* Now follows a string containing the
+                                 * Y-value of the definition point for linear and
+                                 * angular dimensions. */
+                                dxf_read_double (fp, &dimension->p3->y0);
+                                break;
+                        case 33:
+                                /* Now follows a string containing the
+                                 * Z-value of the definition point for linear and
+                                 * angular dimensions. */
+                                dxf_read_double (fp, &dimension->p3->z0);
+                                break;
+                        case 14:
+                                /* Now follows a string containing the
+                                 * X-value of the definition point for linear and
+                                 * angular dimensions. */
+                                dxf_read_double (fp, &dimension->p4->x0);
+                                break;
+                        case 24:
+                                /* Now follows a string containing the
+                                 * Y-value of the definition point for linear and
+                                 * angular dimensions. */
+                                dxf_read_double (fp, &dimension->p4->y0);
+                                break;
+                        case 34:
+                                /* Now follows a string containing the
+                                 * Z-value of the definition point for linear and
+                                 * angular dimensions. */
+                                dxf_read_double (fp, &dimension->p4->z0);
+                                break;
+                        case 15:
+                                /* Now follows a string containing the
+                                 * X-value of the definition point for diameter,
+                                 * radius, and angular dimensions. */
+                                dxf_read_double (fp, &dimension->p5->x0);
+                                break;
+                        case 25:
+                                /* Now follows a string containing the
+                                 * Y-value of the definition point for diameter,
+                                 * radius, and angular dimensions. */
+                                dxf_read_double (fp, &dimension->p5->y0);
+                                break;
+                        case 35:
+                                /* Now follows a string containing the
+                                 * Z-value of the definition point for diameter,
+                                 * radius, and angular dimensions. */
+                                dxf_read_double (fp, &dimension->p5->z0);
+                                break;
+                        case 16:
+                                /* Now follows a string containing the
+                                 * X-value of the point defining dimension arc for
+                                 * angular dimensions. */
+                                dxf_read_double (fp, &dimension->p6->x0);
+                                break;
+                        case 26:
+                                /* Now follows a string containing the
+                                 * Y-value of the point defining dimension arc for
+                                 * angular dimensions. */
+                                dxf_read_double (fp, &dimension->p6->y0);
+                                break;
+                        case 36:
+                                /* Now follows a string containing the
+                                 * Z-value of the point defining dimension arc for
+                                 * angular dimensions. */
+                                dxf_read_double (fp, &dimension->p6->z0);
+                                break;
+                        case 38:
+                                /* Now follows a string containing the
+                                 * elevation. */
+                                dxf_read_double (fp, &dimension->elevation);
+                                break;
+                        case 39:
+                                /* Now follows a string containing the
+                                 * thickness. */
+                                dxf_read_double (fp, &dimension->thickness);
+                                break;
+                        case 40:
+                                /* Now follows a string containing the leader
+                                 * length. */
+                                dxf_read_double (fp, &dimension->leader_length);
+                                break;
+                        case 41:
+                                /* Now follows a string containing the text line
+                                 * spacing factor. */
+                                dxf_read_double (fp, &dimension->text_line_spacing_factor);
+                                break;
+                        case 42:
+                                /* Now follows a string containing the actual
+                                 * measurement. */
+                                dxf_read_double (fp, &dimension->actual_measurement);
+                                break;
+                        case 48:
+                                /* Now follows a string containing the linetype
+                                 * scale. */
+                                dxf_read_double (fp, &dimension->linetype_scale);
+                                break;
+                        case 50:
+                                /* Now follows a string containing the angle of
+                                 * rotated, horizontal, or vertical linear
+                                 * dimensions. */
+                                dxf_read_double (fp, &dimension->angle);
+                                break;
+                        case 51:
+                                /* Now follows a string containing the horizontal
+                                 * direction. */
+                                dxf_read_double (fp, &dimension->hor_dir);
+                                break;
+                        case 52:
+                                /* Now follows a string containing the oblique
+                                 * angle. */
+                                dxf_read_double (fp, &dimension->obl_angle);
+                                break;
+                        case 53:
+                                /* Now follows a string containing the text
+                                 * angle. */
+                                dxf_read_double (fp, &dimension->text_angle);
+                                break;
+                        case 60:
+                                /* Now follows a string containing the
+                                 * visibility value. */
+                                dxf_read_int16 (fp, &dimension->visibility);
+                                break;
+                        case 62:
+                                /* Now follows a string containing the
+                                 * color value. */
+                                dxf_read_int16 (fp, &dimension->color);
+                                break;
+                        case 67:
+                                /* Now follows a string containing the
+                                 * paperspace value. */
+                                dxf_read_int16 (fp, &dimension->paperspace);
+                                break;
+                        case 70:
+                                /* Now follows a string containing a flag
+                                 * value. */
+                                dxf_read_int16 (fp, &dimension->flag);
+                                break;
+                        case 71:
+                                /* Now follows a string containing the attachment
+                                 * point value. */
+                                dxf_read_int16 (fp, &dimension->attachment_point);
+                                break;
+                        case 72:
+                                /* Now follows a string containing the text line
+                                 * spacing value. */
+                                dxf_read_int16 (fp, &dimension->text_line_spacing);
+                                break;
+                        case 92:
+                                /* Now follows a string containing the
+                                 * graphics data size value. */
+                                dxf_read_int32 (fp, &dimension->graphics_data_size);
+                                break;
+                        case 100:
+                                if (fp->acad_version_number >= AutoCAD_13)
+                                {
+                                        /* Now follows a string containing the
+                                         * subclass marker value. */
+                                        dxf_read_line (temp_string, fp);
+                                        if ((strcmp (temp_string, "AcDbEntity") != 0)
+                                          && (strcmp (temp_string, "AcDbDimension") != 0)
+                                          && (strcmp (temp_string, "AcDbAlignedDimension") != 0)
+                                          && (strcmp (temp_string, "AcDbRotatedDimension") != 0)
+                                          && (strcmp (temp_string, "AcDb3PointAngularDimension") != 0)
+                                          && (strcmp (temp_string, "AcDbDiametricDimension") != 0)
+                                          && (strcmp (temp_string, "AcDbRadialDimension") != 0)
+                                          && (strcmp (temp_string, "AcDbOrdinateDimension") != 0))
+                                        {
+                                                fprintf (stderr,
+                                                  (_("Warning in %s () found a bad subclass marker in: %s in line: %d.\n")),
+                                                  __FUNCTION__, fp->filename, fp->line_number);
+                                        }
+                                }
+                                else
+                                {
+                                        fprintf (stderr,
+                                          (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
+                                          __FUNCTION__, fp->filename, fp->line_number);
+                                        /* Skip the value of the unknown group code. */
+                                        dxf_read_line (temp_string, fp);
+                                }
+                                break;
+                        case 160:
+                                /* Now follows a string containing the
+                                 * graphics data size value. */
+                                dxf_read_int32 (fp, &dimension->graphics_data_size);
+                                break;
+                        case 210:
+                                /* Now follows a string containing the
+                                 * X-value of the extrusion vector. */
+                                dxf_read_double (fp, &dimension->extr_x0);
+                                break;
+                        case 220:
+                                /* Now follows a string containing the
+                                 * Y-value of the extrusion vector. */
+                                dxf_read_double (fp, &dimension->extr_y0);
+                                break;
+                        case 230:
+                                /* Now follows a string containing the
+                                 * Z-value of the extrusion vector. */
+                                dxf_read_double (fp, &dimension->extr_z0);
+                                break;
+                        case 280:
+                                /* Now follows a string containing the version
+                                 * number value. */
+                                dxf_read_int16 (fp, &dimension->version_number);
+                                break;
+                        case 284:
+                                /* Now follows a string containing the shadow
+                                 * mode value. */
+                                dxf_read_int16 (fp, &dimension->shadow_mode);
+                                break;
+                        case 310:
+                                /* Now follows a string containing binary
+                                 * graphics data. */
+                                iter310 = dxf_binary_data_read (fp, iter310);
+                                break;
+                        case 330:
+                                if (iter330 == 0)
+                                {
+                                        /* Now follows a string containing a soft-pointer
+                                         * ID/handle to owner dictionary. */
+                                        dxf_read_handle (fp, &dimension->dictionary_owner_soft);
+                                }
+                                if (iter330 == 1)
+                                {
+                                        /* Now follows a string containing a soft-pointer
+                                         * ID/handle to owner object. */
+                                        dxf_read_handle (fp, &dimension->object_owner_soft);
+                                }
+                                iter330++;
+                                break;
+                        case 347:
+                                /* Now follows a string containing a
+                                 * hard-pointer ID/handle to material object. */
+                                dxf_read_handle (fp, &dimension->material);
+                                break;
+                        case 360:
+                                /* Now follows a string containing Hard owner
+                                 * ID/handle to owner dictionary. */
+                                dxf_read_handle (fp, &dimension->dictionary_owner_hard);
+                                break;
+                        case 370:
+                                /* Now follows a string containing the lineweight
+                                 * value. */
+                                dxf_read_int16 (fp, &dimension->lineweight);
+                                break;
+                        case 390:
+                                /* Now follows a string containing a plot style
+                                 * name value. */
+                                dxf_read_handle (fp, &dimension->plot_style_name);
+                                break;
+                        case 420:
+                                /* Now follows a string containing a color value. */
+                                dxf_read_int32 (fp, &dimension->color_value);
+                                break;
+                        case 430:
+                                /* Now follows a string containing a color
+                                 * name value. */
+                                dxf_read_string_interned (fp, &dimension->color_name);
+                                break;
+                        case 440:
+                                /* Now follows a string containing a transparency
+                                 * value. */
+                                dxf_read_int32 (fp, &dimension->transparency);
+                                break;
+                        case 999:
+                                /* Now follows a string containing a comment. */
+                                dxf_read_line (temp_string, fp);
+                                fprintf (stdout, "DXF comment: %s\n", temp_string);
+                                break;
+                        default:
                                 fprintf (stderr,
-                                  (_("Warning in %s () found a bad subclass marker in: %s in line: %d.\n")),
+                                  (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
                                   __FUNCTION__, fp->filename, fp->line_number);
-                        }
-                }
-                else if (strcmp (temp_string, "160") == 0)
-                {
-                        /* Now follows a string containing the
-                         * graphics data size value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%" PRIi32 "\n", &dimension->graphics_data_size);
-                }
-                else if (strcmp (temp_string, "210") == 0)
-                {
-                        /* Now follows a string containing the
-                         * X-value of the extrusion vector. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &dimension->extr_x0);
-                }
-                else if (strcmp (temp_string, "220") == 0)
-                {
-                        /* Now follows a string containing the
-                         * Y-value of the extrusion vector. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &dimension->extr_y0);
-                }
-                else if (strcmp (temp_string, "230") == 0)
-                {
-                        /* Now follows a string containing the
-                         * Z-value of the extrusion vector. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &dimension->extr_z0);
-                }
-                else if (strcmp (temp_string, "280") == 0)
-                {
-                        /* Now follows a string containing the version
-                         * number value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%hd\n", &dimension->version_number);
-                }
-                else if (strcmp (temp_string, "284") == 0)
-                {
-                        /* Now follows a string containing the shadow
-                         * mode value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%hd\n", &dimension->shadow_mode);
-                }
-                else if (strcmp (temp_string, "310") == 0)
-                {
-                        /* Now follows a string containing binary
-                         * graphics data. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, iter310->data_line);
-                        dxf_binary_data_init ((DxfBinaryData *) iter310->next);
-                        iter310 = (DxfBinaryData *) iter310->next;
-                }
-                else if (strcmp (temp_string, "330") == 0)
-                {
-                        if (iter330 == 0)
-                        {
-                                /* Now follows a string containing a soft-pointer
-                                 * ID/handle to owner dictionary. */
-                                (fp->line_number)++;
-                                fscanf (fp->fp, DXF_MAX_STRING_FORMAT, dimension->dictionary_owner_soft);
-                        }
-                        if (iter330 == 1)
-                        {
-                                /* Now follows a string containing a soft-pointer
-                                 * ID/handle to owner object. */
-                                (fp->line_number)++;
-                                fscanf (fp->fp, DXF_MAX_STRING_FORMAT, dimension->object_owner_soft);
-                        }
-                        iter330++;
-                }
-                else if (strcmp (temp_string, "347") == 0)
-                {
-                        /* Now follows a string containing a
-                         * hard-pointer ID/handle to material object. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, dimension->material);
-                }
-                else if (strcmp (temp_string, "360") == 0)
-                {
-                        /* Now follows a string containing Hard owner
-                         * ID/handle to owner dictionary. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, dimension->dictionary_owner_hard);
-                }
-                else if (strcmp (temp_string, "370") == 0)
-                {
-                        /* Now follows a string containing the lineweight
-                         * value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%hd\n", &dimension->lineweight);
-                }
-                else if (strcmp (temp_string, "390") == 0)
-                {
-                        /* Now follows a string containing a plot style
-                         * name value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, dimension->plot_style_name);
-                }
-                else if (strcmp (temp_string, "420") == 0)
-                {
-                        /* Now follows a string containing a color value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%" PRIi32 "\n", &dimension->color_value);
-                }
-                else if (strcmp (temp_string, "430") == 0)
-                {
-                        /* Now follows a string containing a color
-                         * name value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, dimension->color_name);
-                }
-                else if (strcmp (temp_string, "440") == 0)
-                {
-                        /* Now follows a string containing a transparency
-                         * value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%" PRIi32 "\n", &dimension->transparency);
-                }
-                else if (strcmp (temp_string, "999") == 0)
-                {
-                        /* Now follows a string containing a comment. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
-                        fprintf (stdout, "DXF comment: %s\n", temp_string);
-                }
-                else
-                {
-                        fprintf (stderr,
-                          (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
-                          __FUNCTION__, fp->filename, fp->line_number);
+                                /* Skip the value of the unknown group code. */
+                                dxf_read_line (temp_string, fp);
+                                break;
                 }
         }
         /* Handle omitted members and/or illegal values. */
         if (strcmp (dxf_dimension_get_linetype (dimension), "") == 0)
         {
-                dxf_dimension_set_linetype (dimension, strdup (DXF_DEFAULT_LINETYPE));
+                dxf_dimension_set_linetype (dimension, dxf_strdup (DXF_DEFAULT_LINETYPE));
         }
         if (strcmp (dxf_dimension_get_layer (dimension), "") == 0)
         {
-                dxf_dimension_set_layer (dimension, strdup (DXF_DEFAULT_LAYER));
+                dxf_dimension_set_layer (dimension, dxf_strdup (DXF_DEFAULT_LAYER));
         }
-        /* Clean up. */
-        free (temp_string);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -894,7 +791,7 @@ dxf_dimension_write
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        char *dxf_entity_name = strdup ("DIMENSION");
+        char *dxf_entity_name = dxf_strdup ("DIMENSION");
 
         /* Do some basic checks. */
         if (fp == NULL)
@@ -905,7 +802,7 @@ dxf_dimension_write
                 /* Clean up. */
                 if (!dxf_entity_name)
                 {
-                        free (dxf_entity_name);
+                        dxf_free (dxf_entity_name);
                 }
                 dxf_entity_name = NULL;
                 return (EXIT_FAILURE);
@@ -918,7 +815,7 @@ dxf_dimension_write
                 /* Clean up. */
                 if (!dxf_entity_name)
                 {
-                        free (dxf_entity_name);
+                        dxf_free (dxf_entity_name);
                 }
                 dxf_entity_name = NULL;
                 return (EXIT_FAILURE);
@@ -933,18 +830,18 @@ dxf_dimension_write
         if (strcmp (dimension->layer, "") == 0)
         {
                 fprintf (stderr,
-                  (_("Warning in %s () empty layer string for the %s entity with id-code: %x\n")),
+                  (_("Warning in %s () empty layer string for the %s entity with id-code: %" PRIx64 "\n")),
                   __FUNCTION__, dxf_entity_name, dimension->id_code);
                 fprintf (stderr,
                   (_("\t%s entity is relocated to layer 0")),
                   dxf_entity_name);
-                dimension->layer = strdup (DXF_DEFAULT_LAYER);
+                dimension->layer = dxf_strdup (DXF_DEFAULT_LAYER);
         }
         /* Start writing output. */
-        fprintf (fp->fp, "  0\n%s\n", dxf_entity_name);
-        if (dimension->id_code != -1)
+        dxf_write_string (fp, 0, dxf_entity_name);
+        if (dimension->id_code != DXF_HANDLE_NONE)
         {
-                fprintf (fp->fp, "  5\n%x\n", dimension->id_code);
+                dxf_write_hex (fp, 5, dimension->id_code);
         }
         /*!
          * \todo for version R14.\n
@@ -956,65 +853,65 @@ dxf_dimension_write
          * 102 groups are application defined (optional).\n\n
          * End of group, "}" (optional), with Group code 102.
          */
-        if ((strcmp (dimension->dictionary_owner_soft, "") != 0)
+        if ((dimension->dictionary_owner_soft != 0)
           && (fp->acad_version_number >= AutoCAD_14))
         {
-                fprintf (fp->fp, "102\n{ACAD_REACTORS\n");
-                fprintf (fp->fp, "330\n%s\n", dimension->dictionary_owner_soft);
-                fprintf (fp->fp, "102\n}\n");
+                dxf_write_string (fp, 102, "{ACAD_REACTORS");
+                dxf_write_hex (fp, 330, dimension->dictionary_owner_soft);
+                dxf_write_string (fp, 102, "}");
         }
-        if ((strcmp (dimension->dictionary_owner_hard, "") != 0)
+        if ((dimension->dictionary_owner_hard != 0)
           && (fp->acad_version_number >= AutoCAD_14))
         {
-                fprintf (fp->fp, "102\n{ACAD_XDICTIONARY\n");
-                fprintf (fp->fp, "360\n%s\n", dimension->dictionary_owner_hard);
-                fprintf (fp->fp, "102\n}\n");
+                dxf_write_string (fp, 102, "{ACAD_XDICTIONARY");
+                dxf_write_hex (fp, 360, dimension->dictionary_owner_hard);
+                dxf_write_string (fp, 102, "}");
         }
-        if ((strcmp (dimension->object_owner_soft, "") != 0)
+        if ((dimension->object_owner_soft != 0)
           && (fp->acad_version_number >= AutoCAD_2000))
         {
-                fprintf (fp->fp, "330\n%s\n", dimension->object_owner_soft);
+                dxf_write_hex (fp, 330, dimension->object_owner_soft);
         }
         if (fp->acad_version_number >= AutoCAD_13)
         {
-                fprintf (fp->fp, "100\nAcDbEntity\n");
+                dxf_write_string (fp, 100, "AcDbEntity");
         }
         if (dimension->paperspace == DXF_PAPERSPACE)
         {
-                fprintf (fp->fp, " 67\n%hd\n", (int16_t) DXF_PAPERSPACE);
+                dxf_write_int (fp, 67, (int16_t) DXF_PAPERSPACE);
         }
-        fprintf (fp->fp, "  8\n%s\n", dimension->layer);
+        dxf_write_string (fp, 8, dimension->layer);
         if (strcmp (dimension->linetype, DXF_DEFAULT_LINETYPE) != 0)
         {
-                fprintf (fp->fp, "  6\n%s\n", dimension->linetype);
+                dxf_write_string (fp, 6, dimension->linetype);
         }
         if ((fp->acad_version_number >= AutoCAD_2008)
-          && (strcmp (dimension->material, "") != 0))
+          && (dimension->material != 0))
         {
-                fprintf (fp->fp, "347\n%s\n", dimension->material);
+                dxf_write_hex (fp, 347, dimension->material);
         }
         if (dimension->color != DXF_COLOR_BYLAYER)
         {
-                fprintf (fp->fp, " 62\n%hd\n", dimension->color);
+                dxf_write_int (fp, 62, dimension->color);
         }
         if (fp->acad_version_number >= AutoCAD_2002)
         {
-                fprintf (fp->fp, "370\n%hd\n", dimension->lineweight);
+                dxf_write_int (fp, 370, dimension->lineweight);
         }
         if (dimension->linetype_scale != 1.0)
         {
-                fprintf (fp->fp, " 48\n%f\n", dimension->linetype_scale);
+                dxf_write_double (fp, 48, dimension->linetype_scale);
         }
         if (dimension->visibility != 0)
         {
-                fprintf (fp->fp, " 60\n%hd\n", dimension->visibility);
+                dxf_write_int (fp, 60, dimension->visibility);
         }
         if (fp->acad_version_number >= AutoCAD_2000)
         {
 #ifdef BUILD_64
-                fprintf (fp->fp, "160\n%" PRIi32 "\n", dimension->graphics_data_size);
+                dxf_write_int (fp, 160, dimension->graphics_data_size);
 #else
-                fprintf (fp->fp, " 92\n%" PRIi32 "\n", dimension->graphics_data_size);
+                dxf_write_int (fp, 92, dimension->graphics_data_size);
 #endif
                 if (dimension->binary_graphics_data != NULL)
                 {
@@ -1022,73 +919,73 @@ dxf_dimension_write
                         iter = (DxfBinaryData *) dimension->binary_graphics_data;
                         while (iter != NULL)
                         {
-                                fprintf (fp->fp, "310\n%s\n", iter->data_line);
+                                dxf_binary_data_write (fp, iter);
                                 iter = (DxfBinaryData *) iter->next;
                         }
                 }
         }
         if (fp->acad_version_number >= AutoCAD_2004)
         {
-                fprintf (fp->fp, "420\n%" PRIi32 "\n", dimension->color_value);
-                fprintf (fp->fp, "430\n%s\n", dimension->color_name);
-                fprintf (fp->fp, "440\n%" PRIi32 "\n", dimension->transparency);
+                dxf_write_int (fp, 420, dimension->color_value);
+                dxf_write_string (fp, 430, dimension->color_name);
+                dxf_write_int (fp, 440, dimension->transparency);
         }
         if (fp->acad_version_number >= AutoCAD_2009)
         {
-                fprintf (fp->fp, "390\n%s\n", dimension->plot_style_name);
-                fprintf (fp->fp, "284\n%hd\n", dimension->shadow_mode);
+                dxf_write_hex (fp, 390, dimension->plot_style_name);
+                dxf_write_int (fp, 284, dimension->shadow_mode);
         }
         if (fp->acad_version_number >= AutoCAD_13)
         {
-                fprintf (fp->fp, "100\nAcDbDimension\n");
+                dxf_write_string (fp, 100, "AcDbDimension");
         }
-        fprintf (fp->fp, "  2\n%s\n", dimension->dimblock_name);
+        dxf_write_string (fp, 2, dimension->dimblock_name);
         if (fp->acad_version_number >= AutoCAD_2010)
         {
-                fprintf (fp->fp, "280\n%d\n", dimension->version_number);
+                dxf_write_int (fp, 280, dimension->version_number);
         }
-        fprintf (fp->fp, " 10\n%f\n", dimension->p0->x0);
-        fprintf (fp->fp, " 20\n%f\n", dimension->p0->y0);
-        fprintf (fp->fp, " 30\n%f\n", dimension->p0->z0);
-        fprintf (fp->fp, " 11\n%f\n", dimension->p1->x0);
-        fprintf (fp->fp, " 21\n%f\n", dimension->p1->y0);
-        fprintf (fp->fp, " 31\n%f\n", dimension->p1->z0);
-        fprintf (fp->fp, " 70\n%hd\n", dimension->flag);
+        dxf_write_double (fp, 10, dimension->p0->x0);
+        dxf_write_double (fp, 20, dimension->p0->y0);
+        dxf_write_double (fp, 30, dimension->p0->z0);
+        dxf_write_double (fp, 11, dimension->p1->x0);
+        dxf_write_double (fp, 21, dimension->p1->y0);
+        dxf_write_double (fp, 31, dimension->p1->z0);
+        dxf_write_int (fp, 70, dimension->flag);
         if (fp->acad_version_number >= AutoCAD_2000)
         {
-                fprintf (fp->fp, " 71\n%hd\n", dimension->attachment_point);
-                fprintf (fp->fp, " 72\n%hd\n", dimension->text_line_spacing);
-                fprintf (fp->fp, " 41\n%f\n", dimension->text_line_spacing_factor);
-                fprintf (fp->fp, " 42\n%f\n", dimension->actual_measurement);
-        }
-        fprintf (fp->fp, "  1\n%s\n", dimension->dim_text);
-        fprintf (fp->fp, " 53\n%f\n", dimension->text_angle);
-        fprintf (fp->fp, " 51\n%f\n", dimension->hor_dir);
-        fprintf (fp->fp, "210\n%fn", dimension->extr_x0);
-        fprintf (fp->fp, "220\n%fn", dimension->extr_y0);
-        fprintf (fp->fp, "230\n%fn", dimension->extr_z0);
-        fprintf (fp->fp, "  3\n%s\n", dimension->dimstyle_name);
+                dxf_write_int (fp, 71, dimension->attachment_point);
+                dxf_write_int (fp, 72, dimension->text_line_spacing);
+                dxf_write_double (fp, 41, dimension->text_line_spacing_factor);
+                dxf_write_double (fp, 42, dimension->actual_measurement);
+        }
+        dxf_write_string (fp, 1, dimension->dim_text);
+        dxf_write_double (fp, 53, dimension->text_angle);
+        dxf_write_double (fp, 51, dimension->hor_dir);
+        dxf_write_double (fp, 210, dimension->extr_x0);
+        dxf_write_double (fp, 220, dimension->extr_y0);
+        dxf_write_double (fp, 230, dimension->extr_z0);
+        dxf_write_string (fp, 3, dimension->dimstyle_name);
         /* Rotated, horizontal, or vertical dimension. */
         if (dimension->flag == 0)
         {
                 if (fp->acad_version_number >= AutoCAD_13)
                 {
-                        fprintf (fp->fp, "100\nAcDbAlignedDimension\n");
+                        dxf_write_string (fp, 100, "AcDbAlignedDimension");
                 }
-                fprintf (fp->fp, " 12\n%f\n", dimension->p2->x0);
-                fprintf (fp->fp, " 22\n%f\n", dimension->p2->y0);
-                fprintf (fp->fp, " 32\n%f\n", dimension->p2->z0);
-                fprintf (fp->fp, " 13\n%f\n", dimension->p3->x0);
-                fprintf (fp->fp, " 23\n%f\n", dimension->p3->y0);
-                fprintf (fp->fp, " 33\n%f\n", dimension->p3->z0);
-                fprintf (fp->fp, " 14\n%f\n", dimension->p4->x0);
-                fprintf (fp->fp, " 24\n%f\n", dimension->p4->y0);
-                fprintf (fp->fp, " 34\n%f\n", dimension->p4->z0);
-                fprintf (fp->fp, " 50\n%f\n", dimension->angle);
-                fprintf (fp->fp, " 52\n%f\n", dimension->obl_angle);
+                dxf_write_double (fp, 12, dimension->p2->x0);
+                dxf_write_double (fp, 22, dimension->p2->y0);
+                dxf_write_double (fp, 32, dimension->p2->z0);
+                dxf_write_double (fp, 13, dimension->p3->x0);
+                dxf_write_double (fp, 23, dimension->p3->y0);
+                dxf_write_double (fp, 33, dimension->p3->z0);
+                dxf_write_double (fp, 14, dimension->p4->x0);
+                dxf_write_double (fp, 24, dimension->p4->y0);
+                dxf_write_double (fp, 34, dimension->p4->z0);
+                dxf_write_double (fp, 50, dimension->angle);
+                dxf_write_double (fp, 52, dimension->obl_angle);
                 if (fp->acad_version_number >= AutoCAD_13)
                 {
-                        fprintf (fp->fp, "100\nAcDbRotatedDimension\n");
+                        dxf_write_string (fp, 100, "AcDbRotatedDimension");
                 }
         }
         /* Aligned dimension. */
@@ -1096,105 +993,105 @@ dxf_dimension_write
         {
                 if (fp->acad_version_number >= AutoCAD_13)
                 {
-                        fprintf (fp->fp, "100\nAcDbAlignedDimension\n");
+                        dxf_write_string (fp, 100, "AcDbAlignedDimension");
                 }
-                fprintf (fp->fp, " 12\n%f\n", dimension->p2->x0);
-                fprintf (fp->fp, " 22\n%f\n", dimension->p2->y0);
-                fprintf (fp->fp, " 32\n%f\n", dimension->p2->z0);
-                fprintf (fp->fp, " 13\n%f\n", dimension->p3->x0);
-                fprintf (fp->fp, " 23\n%f\n", dimension->p3->y0);
-                fprintf (fp->fp, " 33\n%f\n", dimension->p3->z0);
-                fprintf (fp->fp, " 14\n%f\n", dimension->p4->x0);
-                fprintf (fp->fp, " 24\n%f\n", dimension->p4->y0);
-                fprintf (fp->fp, " 34\n%f\n", dimension->p4->z0);
-                fprintf (fp->fp, " 50\n%f\n", dimension->angle);
+                dxf_write_double (fp, 12, dimension->p2->x0);
+                dxf_write_double (fp, 22, dimension->p2->y0);
+                dxf_write_double (fp, 32, dimension->p2->z0);
+                dxf_write_double (fp, 13, dimension->p3->x0);
+                dxf_write_double (fp, 23, dimension->p3->y0);
+                dxf_write_double (fp, 33, dimension->p3->z0);
+                dxf_write_double (fp, 14, dimension->p4->x0);
+                dxf_write_double (fp, 24, dimension->p4->y0);
+                dxf_write_double (fp, 34, dimension->p4->z0);
+                dxf_write_double (fp, 50, dimension->angle);
         }
         /* Angular dimension. */
         else if (dimension->flag == 2)
         {
                 if (fp->acad_version_number >= AutoCAD_13)
                 {
-                        fprintf (fp->fp, "100\nAcDb3PointAngularDimension\n");
+                        dxf_write_string (fp, 100, "AcDb3PointAngularDimension");
                 }
-                fprintf (fp->fp, " 13\n%f\n", dimension->p3->x0);
-                fprintf (fp->fp, " 23\n%f\n", dimension->p3->y0);
-                fprintf (fp->fp, " 33\n%f\n", dimension->p3->z0);
-                fprintf (fp->fp, " 14\n%f\n", dimension->p4->x0);
-                fprintf (fp->fp, " 24\n%f\n", dimension->p4->y0);
-                fprintf (fp->fp, " 34\n%f\n", dimension->p4->z0);
-                fprintf (fp->fp, " 15\n%f\n", dimension->p5->x0);
-                fprintf (fp->fp, " 25\n%f\n", dimension->p5->y0);
-                fprintf (fp->fp, " 35\n%f\n", dimension->p5->z0);
-                fprintf (fp->fp, " 16\n%f\n", dimension->p6->x0);
-                fprintf (fp->fp, " 26\n%f\n", dimension->p6->y0);
-                fprintf (fp->fp, " 36\n%f\n", dimension->p6->z0);
+                dxf_write_double (fp, 13, dimension->p3->x0);
+                dxf_write_double (fp, 23, dimension->p3->y0);
+                dxf_write_double (fp, 33, dimension->p3->z0);
+                dxf_write_double (fp, 14, dimension->p4->x0);
+                dxf_write_double (fp, 24, dimension->p4->y0);
+                dxf_write_double (fp, 34, dimension->p4->z0);
+                dxf_write_double (fp, 15, dimension->p5->x0);
+                dxf_write_double (fp, 25, dimension->p5->y0);
+                dxf_write_double (fp, 35, dimension->p5->z0);
+                dxf_write_double (fp, 16, dimension->p6->x0);
+                dxf_write_double (fp, 26, dimension->p6->y0);
+                dxf_write_double (fp, 36, dimension->p6->z0);
         }
         /* Diameter dimension. */
         else if (dimension->flag == 3)
         {
                 if (fp->acad_version_number >= AutoCAD_13)
                 {
-                        fprintf (fp->fp, "100\nAcDbDiametricDimension\n");
+                        dxf_write_string (fp, 100, "AcDbDiametricDimension");
                 }
-                fprintf (fp->fp, " 15\n%f\n", dimension->p5->x0);
-                fprintf (fp->fp, " 25\n%f\n", dimension->p5->y0);
-                fprintf (fp->fp, " 35\n%f\n", dimension->p5->z0);
-                fprintf (fp->fp, " 40\n%f\n", dimension->leader_length);
+                dxf_write_double (fp, 15, dimension->p5->x0);
+                dxf_write_double (fp, 25, dimension->p5->y0);
+                dxf_write_double (fp, 35, dimension->p5->z0);
+                dxf_write_double (fp, 40, dimension->leader_length);
         }
         /* Radius dimension. */
         else if (dimension->flag == 4)
         {
                 if (fp->acad_version_number >= AutoCAD_13)
                 {
-                        fprintf (fp->fp, "100\nAcDbRadialDimension\n");
+                        dxf_write_string (fp, 100, "AcDbRadialDimension");
                 }
-                fprintf (fp->fp, " 15\n%f\n", dimension->p5->x0);
-                fprintf (fp->fp, " 25\n%f\n", dimension->p5->y0);
-                fprintf (fp->fp, " 35\n%f\n", dimension->p5->z0);
-                fprintf (fp->fp, " 40\n%f\n", dimension->leader_length);
+                dxf_write_double (fp, 15, dimension->p5->x0);
+                dxf_write_double (fp, 25, dimension->p5->y0);
+                dxf_write_double (fp, 35, dimension->p5->z0);
+                dxf_write_double (fp, 40, dimension->leader_length);
         }
         /* Angular 3-point dimension. */
         else if (dimension->flag == 5)
         {
                 if (fp->acad_version_number >= AutoCAD_13)
                 {
-                        fprintf (fp->fp, "100\nAcDb3PointAngularDimension\n");
+                        dxf_write_string (fp, 100, "AcDb3PointAngularDimension");
                 }
-                fprintf (fp->fp, " 13\n%f\n", dimension->p3->x0);
-                fprintf (fp->fp, " 23\n%f\n", dimension->p3->y0);
-                fprintf (fp->fp, " 33\n%f\n", dimension->p3->z0);
-                fprintf (fp->fp, " 14\n%f\n", dimension->p4->x0);
-                fprintf (fp->fp, " 24\n%f\n", dimension->p4->y0);
-                fprintf (fp->fp, " 34\n%f\n", dimension->p4->z0);
-                fprintf (fp->fp, " 15\n%f\n", dimension->p5->x0);
-                fprintf (fp->fp, " 25\n%f\n", dimension->p5->y0);
-                fprintf (fp->fp, " 35\n%f\n", dimension->p5->z0);
-                fprintf (fp->fp, " 16\n%f\n", dimension->p6->x0);
-                fprintf (fp->fp, " 26\n%f\n", dimension->p6->y0);
-                fprintf (fp->fp, " 36\n%f\n", dimension->p6->z0);
+                dxf_write_double (fp, 13, dimension->p3->x0);
+                dxf_write_double (fp, 23, dimension->p3->y0);
+                dxf_write_double (fp, 33, dimension->p3->z0);
+                dxf_write_double (fp, 14, dimension->p4->x0);
+                dxf_write_double (fp, 24, dimension->p4->y0);
+                dxf_write_double (fp, 34, dimension->p4->z0);
+                dxf_write_double (fp, 15, dimension->p5->x0);
+                dxf_write_double (fp, 25, dimension->p5->y0);
+                dxf_write_double (fp, 35, dimension->p5->z0);
+                dxf_write_double (fp, 16, dimension->p6->x0);
+                dxf_write_double (fp, 26, dimension->p6->y0);
+                dxf_write_double (fp, 36, dimension->p6->z0);
         }
         /* Ordinate dimension. */
         else if (dimension->flag == 6)
         {
                 if (fp->acad_version_number >= AutoCAD_13)
                 {
-                        fprintf (fp->fp, "100\nAcDbOrdinateDimension\n");
+                        dxf_write_string (fp, 100, "AcDbOrdinateDimension");
                 }
-                fprintf (fp->fp, " 13\n%f\n", dimension->p3->x0);
-                fprintf (fp->fp, " 23\n%f\n", dimension->p3->y0);
-                fprintf (fp->fp, " 33\n%f\n", dimension->p3->z0);
-                fprintf (fp->fp, " 14\n%f\n", dimension->p4->x0);
-                fprintf (fp->fp, " 24\n%f\n", dimension->p4->y0);
-                fprintf (fp->fp, " 34\n%f\n", dimension->p4->z0);
+                dxf_write_double (fp, 13, dimension->p3->x0);
+                dxf_write_double (fp, 23, dimension->p3->y0);
+                dxf_write_double (fp, 33, dimension->p3->z0);
+                dxf_write_double (fp, 14, dimension->p4->x0);
+                dxf_write_double (fp, 24, dimension->p4->y0);
+                dxf_write_double (fp, 34, dimension->p4->z0);
         }
         if (dimension->thickness != 0.0)
         {
-                fprintf (fp->fp, " 39\n%f\n", dimension->thickness);
+                dxf_write_double (fp, 39, dimension->thickness);
         }
         /* Clean up. */
         if (!dxf_entity_name)
         {
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
         }
 #if DEBUG
         DXF_DEBUG_END
@@ -1236,19 +1133,14 @@ dxf_dimension_free
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        free (dimension->linetype);
-        free (dimension->layer);
+        dxf_string_free (dimension->linetype);
+        dxf_string_free (dimension->layer);
         dxf_binary_data_free_list (dimension->binary_graphics_data);
-        free (dimension->dim_text);
-        free (dimension->dimblock_name);
-        free (dimension->dimstyle_name);
-        free (dimension->dictionary_owner_soft);
-        free (dimension->object_owner_soft);
-        free (dimension->material);
-        free (dimension->dictionary_owner_hard);
-        free (dimension->plot_style_name);
-        free (dimension->color_name);
-        free (dimension);
+        dxf_free (dimension->dim_text);
+        dxf_free (dimension->dimblock_name);
+        dxf_string_free (dimension->dimstyle_name);
+        dxf_string_free (dimension->color_name);
+        dxf_free (dimension);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1295,7 +1187,7 @@ dxf_dimension_free_list
  *
  * \return \c id_code, or \c DXF_ERROR when an error occurred.
  */
-int
+uint64_t
 dxf_dimension_get_id_code
 (
         DxfDimension *dimension
@@ -1313,12 +1205,6 @@ dxf_dimension_get_id_code
                   __FUNCTION__);
                 return (DXF_ERROR);
         }
-        if (dimension->id_code < 0)
-        {
-                fprintf (stderr,
-                  (_("Warning in %s () a negative value was found.\n")),
-                  __FUNCTION__);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1337,7 +1223,7 @@ dxf_dimension_set_id_code
 (
         DxfDimension *dimension,
                 /*!< a pointer to a DXF \c DIMENSION entity. */
-        int id_code
+        uint64_t id_code
                 /*!< Identification number for the entity.\n
                  * This is to be an unique (sequential) number in the DXF
                  * file. */
@@ -1354,12 +1240,6 @@ dxf_dimension_set_id_code
                   __FUNCTION__);
                 return (NULL);
         }
-        if (id_code < 0)
-        {
-                fprintf (stderr,
-                  (_("Warning in %s () a negative value was passed.\n")),
-                  __FUNCTION__);
-        }
         dimension->id_code = id_code;
 #if DEBUG
         DXF_DEBUG_END
@@ -1401,7 +1281,7 @@ dxf_dimension_get_linetype
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (dimension->linetype));
+        return (dxf_strdup (dimension->linetype));
 }
 
 
@@ -1438,7 +1318,7 @@ dxf_dimension_set_linetype
                   __FUNCTION__);
                 return (NULL);
         }
-        dimension->linetype = strdup (linetype);
+        dimension->linetype = dxf_strdup (linetype);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1479,7 +1359,7 @@ dxf_dimension_get_layer
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (dimension->layer));
+        return (dxf_strdup (dimension->layer));
 }
 
 
@@ -1516,7 +1396,7 @@ dxf_dimension_set_layer
                   __FUNCTION__);
                 return (NULL);
         }
-        dimension->layer = strdup (layer);
+        dimension->layer = dxf_strdup (layer);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2263,12 +2143,10 @@ dxf_dimension_set_binary_graphics_data
  * \brief Get the pointer to the \c dictionary_owner_soft from a DXF 
  * \c DIMENSION entity.
  *
- * \return pointer to the \c dictionary_owner_soft, or \c NULL when an
+ * \return the handle of the \c dictionary_owner_soft, or 0 when an
  * error occurred.
- *
- * \warning No checks are performed on the returned pointer (string).
  */
-char *
+uint64_t
 dxf_dimension_get_dictionary_owner_soft
 (
         DxfDimension *dimension
@@ -2284,19 +2162,12 @@ dxf_dimension_get_dictionary_owner_soft
                 fprintf (stderr,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
-                return (NULL);
-        }
-        if (dimension->dictionary_owner_soft ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
+                return (0);
         }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (dimension->dictionary_owner_soft));
+        return (dimension->dictionary_owner_soft);
 }
 
 
@@ -2312,8 +2183,8 @@ dxf_dimension_set_dictionary_owner_soft
 (
         DxfDimension *dimension,
                 /*!< a pointer to a DXF \c DIMENSION entity. */
-        char *dictionary_owner_soft
-                /*!< a string containing the pointer to the
+        uint64_t dictionary_owner_soft
+                /*!< the handle of the
                  * \c dictionary_owner_soft for the entity. */
 )
 {
@@ -2328,14 +2199,7 @@ dxf_dimension_set_dictionary_owner_soft
                   __FUNCTION__);
                 return (NULL);
         }
-        if (dictionary_owner_soft == NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was passed.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
-        dimension->dictionary_owner_soft = strdup (dictionary_owner_soft);
+        dimension->dictionary_owner_soft = dictionary_owner_soft;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2348,10 +2212,8 @@ dxf_dimension_set_dictionary_owner_soft
  * \c DIMENSION entity.
  *
  * \return soft pointer to the object owner.
- *
- * \warning No checks are performed on the returned pointer (string).
  */
-char *
+uint64_t
 dxf_dimension_get_object_owner_soft
 (
         DxfDimension *dimension
@@ -2367,19 +2229,12 @@ dxf_dimension_get_object_owner_soft
                 fprintf (stderr,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
-                return (NULL);
-        }
-        if (dimension->object_owner_soft ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
+                return (0);
         }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (dimension->object_owner_soft));
+        return (dimension->object_owner_soft);
 }
 
 
@@ -2392,8 +2247,8 @@ dxf_dimension_set_object_owner_soft
 (
         DxfDimension *dimension,
                 /*!< a pointer to a DXF \c DIMENSION entity. */
-        char *object_owner_soft
-                /*!< a string containing the pointer to the
+        uint64_t object_owner_soft
+                /*!< the handle of the
                  * \c object_owner_soft for the entity. */
 )
 {
@@ -2408,14 +2263,7 @@ dxf_dimension_set_object_owner_soft
                   __FUNCTION__);
                 return (NULL);
         }
-        if (object_owner_soft == NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was passed.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
-        dimension->object_owner_soft = strdup (object_owner_soft);
+        dimension->object_owner_soft = object_owner_soft;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2426,12 +2274,10 @@ dxf_dimension_set_object_owner_soft
 /*!
  * \brief Get the pointer to the \c material from a DXF \c DIMENSION entity.
  *
- * \return a pointer to \c material when successful, or \c NULL when an
+ * \return the handle \c material when successful, or 0 when an
  * error occurred.
- *
- * \warning No checks are performed on the returned pointer.
  */
-char *
+uint64_t
 dxf_dimension_get_material
 (
         DxfDimension *dimension
@@ -2447,19 +2293,12 @@ dxf_dimension_get_material
                 fprintf (stderr,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
-                return (NULL);
-        }
-        if (dimension->material ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
+                return (0);
         }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (dimension->material));
+        return (dimension->material);
 }
 
 
@@ -2475,8 +2314,8 @@ dxf_dimension_set_material
 (
         DxfDimension *dimension,
                 /*!< a pointer to a DXF \c DIMENSION entity. */
-        char *material
-                /*!< a string containing the pointer to the \c
+        uint64_t material
+                /*!< the handle of the \c
                  * material for the entity. */
 )
 {
@@ -2491,14 +2330,7 @@ dxf_dimension_set_material
                   __FUNCTION__);
                 return (NULL);
         }
-        if (material == NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was passed.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
-        dimension->material = strdup (material);
+        dimension->material = material;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2510,12 +2342,10 @@ dxf_dimension_set_material
  * \brief Get the pointer to the \c dictionary_owner_hard from a DXF 
  * \c DIMENSION entity.
  *
- * \return pointer to the \c dictionary_owner_hard, or \c NULL when an
+ * \return the handle of the \c dictionary_owner_hard, or 0 when an
  * error occurred.
- *
- * \warning No checks are performed on the returned pointer (string).
  */
-char *
+uint64_t
 dxf_dimension_get_dictionary_owner_hard
 (
         DxfDimension *dimension
@@ -2531,19 +2361,12 @@ dxf_dimension_get_dictionary_owner_hard
                 fprintf (stderr,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
-                return (NULL);
-        }
-        if (dimension->dictionary_owner_hard ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
+                return (0);
         }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (dimension->dictionary_owner_hard));
+        return (dimension->dictionary_owner_hard);
 }
 
 
@@ -2559,8 +2382,8 @@ dxf_dimension_set_dictionary_owner_hard
 (
         DxfDimension *dimension,
                 /*!< a pointer to a DXF \c DIMENSION entity. */
-        char *dictionary_owner_hard
-                /*!< a string containing the pointer to the
+        uint64_t dictionary_owner_hard
+                /*!< the handle of the
                  * \c dictionary_owner_hard for the entity. */
 )
 {
@@ -2575,14 +2398,7 @@ dxf_dimension_set_dictionary_owner_hard
                   __FUNCTION__);
                 return (NULL);
         }
-        if (dictionary_owner_hard == NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was passed.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
-        dimension->dictionary_owner_hard = strdup (dictionary_owner_hard);
+        dimension->dictionary_owner_hard = dictionary_owner_hard;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2658,10 +2474,10 @@ dxf_dimension_set_lineweight
 /*!
  * \brief Get the \c plot_style_name from a DXF \c DIMENSION entity.
  *
- * \return a pointer to \c plot_style_name when sucessful, or \c NULL
+ * \return the handle \c plot_style_name when sucessful, or 0
  * when an error occurred.
  */
-char *
+uint64_t
 dxf_dimension_get_plot_style_name
 (
         DxfDimension *dimension
@@ -2677,19 +2493,12 @@ dxf_dimension_get_plot_style_name
                 fprintf (stderr,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
-                return (NULL);
-        }
-        if (dimension->plot_style_name ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
+                return (0);
         }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (dimension->plot_style_name));
+        return (dimension->plot_style_name);
 }
 
 
@@ -2704,7 +2513,7 @@ dxf_dimension_set_plot_style_name
 (
         DxfDimension *dimension,
                 /*!< a pointer to a DXF \c DIMENSION entity. */
-        char *plot_style_name
+        uint64_t plot_style_name
                 /*!< a string containing the \c plot_style_name for the
                  * entity. */
 )
@@ -2720,14 +2529,7 @@ dxf_dimension_set_plot_style_name
                   __FUNCTION__);
                 return (NULL);
         }
-        if (plot_style_name == NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was passed.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
-        dimension->plot_style_name = strdup (plot_style_name);
+        dimension->plot_style_name = plot_style_name;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2834,7 +2636,7 @@ dxf_dimension_get_color_name
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (dimension->color_name));
+        return (dxf_strdup (dimension->color_name));
 }
 
 
@@ -2872,7 +2674,7 @@ dxf_dimension_set_color_name
                   __FUNCTION__);
                 return (NULL);
         }
-        dimension->color_name = strdup (color_name);
+        dimension->color_name = dxf_strdup (color_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2979,7 +2781,7 @@ dxf_dimension_get_dim_text
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (dimension->dim_text));
+        return (dxf_strdup (dimension->dim_text));
 }
 
 
@@ -3016,7 +2818,7 @@ dxf_dimension_set_dim_text
                   __FUNCTION__);
                 return (NULL);
         }
-        dimension->dim_text = strdup (dim_text);
+        dimension->dim_text = dxf_strdup (dim_text);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -3058,7 +2860,7 @@ dxf_dimension_get_dimblock_name
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (dimension->dimblock_name));
+        return (dxf_strdup (dimension->dimblock_name));
 }
 
 
@@ -3095,7 +2897,7 @@ dxf_dimension_set_dimblock_name
                   __FUNCTION__);
                 return (NULL);
         }
-        dimension->dimblock_name = strdup (dimblock_name);
+        dimension->dimblock_name = dxf_strdup (dimblock_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -3137,7 +2939,7 @@ dxf_dimension_get_dimstyle_name
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (dimension->dimstyle_name));
+        return (dxf_strdup (dimension->dimstyle_name));
 }
 
 
@@ -3174,7 +2976,7 @@ dxf_dimension_set_dimstyle_name
                   __FUNCTION__);
                 return (NULL);
         }
-        dimension->dimblock_name = strdup (dimstyle_name);
+        dimension->dimblock_name = dxf_strdup (dimstyle_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
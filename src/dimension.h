@@ -61,7 +61,7 @@ typedef struct
 dxf_dimension_struct
 {
         /* Members common for all DXF drawable entities. */
-        int id_code;
+        uint64_t id_code;
                 /*!< Identification number for the entity.\n
                  * This is to be an unique (sequential) number in the DXF
                  * file.\n
@@ -134,20 +134,20 @@ dxf_dimension_struct
                  * (optional).\n
                  * Group code = 310.\n
                  * \since Introduced in version R2000. */
-        char *dictionary_owner_soft;
+        uint64_t dictionary_owner_soft;
                 /*!< Soft-pointer ID/handle to owner dictionary (optional).\n
                  * Group code = 330.\n
                  * \since Introduced in version R14. */
-        char *object_owner_soft;
+        uint64_t object_owner_soft;
                 /*!< Soft-pointer ID/handle  to owner BLOCK_RECORD object.\n
                  * Group code = 330.\n
                  * \since Introduced in version R2000. */
-        char *material;
+        uint64_t material;
                 /*!< Hard-pointer ID/handle to material object (present if
                  * not BYLAYER).\n
                  * Group code = 347.\n
                  * \since Introduced in version R2008. */
-        char *dictionary_owner_hard;
+        uint64_t dictionary_owner_hard;
                 /*!< Hard owner ID/handle to owner dictionary (optional).\n
                  * Group code = 360.\n
                  * \since Introduced in version R14. */
@@ -156,7 +156,7 @@ dxf_dimension_struct
                  * Stored and moved around as a 16-bit integer.\n
                  * Group code = 370.\n
                  * \since Introduced in version R2002. */
-        char *plot_style_name;
+        uint64_t plot_style_name;
                 /*!< Hard pointer ID / handle of PlotStyleName object.\n
                  * Group code = 390.\n
                  * \since Introduced in version R2009. */
@@ -345,8 +345,8 @@ DxfDimension *dxf_dimension_read (DxfFile *fp, DxfDimension *dimension);
 int dxf_dimension_write (DxfFile *fp, DxfDimension *dimension);
 int dxf_dimension_free (DxfDimension *dimension);
 void dxf_dimension_free_list (DxfDimension *dimensions);
-int dxf_dimension_get_id_code (DxfDimension *dimension);
-DxfDimension *dxf_dimension_set_id_code (DxfDimension *dimension, int id_code);
+uint64_t dxf_dimension_get_id_code (DxfDimension *dimension);
+DxfDimension *dxf_dimension_set_id_code (DxfDimension *dimension, uint64_t id_code);
 char *dxf_dimension_get_linetype (DxfDimension *dimension);
 DxfDimension *dxf_dimension_set_linetype (DxfDimension *dimension, char *linetype);
 char *dxf_dimension_get_layer (DxfDimension *dimension);
@@ -369,18 +369,18 @@ int16_t dxf_dimension_get_shadow_mode (DxfDimension *dimension);
 DxfDimension *dxf_dimension_set_shadow_mode (DxfDimension *dimension, int16_t shadow_mode);
 DxfBinaryData *dxf_dimension_get_binary_graphics_data (DxfDimension *dimension);
 DxfDimension *dxf_dimension_set_binary_graphics_data (DxfDimension *dimension, DxfBinaryData *data);
-char *dxf_dimension_get_dictionary_owner_soft (DxfDimension *dimension);
-DxfDimension *dxf_dimension_set_dictionary_owner_soft (DxfDimension *dimension, char *dictionary_owner_soft);
-char *dxf_dimension_get_object_owner_soft (DxfDimension *dimension);
-DxfDimension *dxf_dimension_set_object_owner_soft (DxfDimension *dimension, char *object_owner_soft);
-char *dxf_dimension_get_material (DxfDimension *dimension);
-DxfDimension *dxf_dimension_set_material (DxfDimension *dimension, char *material);
-char *dxf_dimension_get_dictionary_owner_hard (DxfDimension *dimension);
-DxfDimension *dxf_dimension_set_dictionary_owner_hard (DxfDimension *dimension, char *dictionary_owner_hard);
+uint64_t dxf_dimension_get_dictionary_owner_soft (DxfDimension *dimension);
+DxfDimension *dxf_dimension_set_dictionary_owner_soft (DxfDimension *dimension, uint64_t dictionary_owner_soft);
+uint64_t dxf_dimension_get_object_owner_soft (DxfDimension *dimension);
+DxfDimension *dxf_dimension_set_object_owner_soft (DxfDimension *dimension, uint64_t object_owner_soft);
+uint64_t dxf_dimension_get_material (DxfDimension *dimension);
+DxfDimension *dxf_dimension_set_material (DxfDimension *dimension, uint64_t material);
+uint64_t dxf_dimension_get_dictionary_owner_hard (DxfDimension *dimension);
+DxfDimension *dxf_dimension_set_dictionary_owner_hard (DxfDimension *dimension, uint64_t dictionary_owner_hard);
 int16_t dxf_dimension_get_lineweight (DxfDimension *dimension);
 DxfDimension *dxf_dimension_set_lineweight (DxfDimension *dimension, int16_t lineweight);
-char *dxf_dimension_get_plot_style_name (DxfDimension *dimension);
-DxfDimension *dxf_dimension_set_plot_style_name (DxfDimension *dimension, char *plot_style_name);
+uint64_t dxf_dimension_get_plot_style_name (DxfDimension *dimension);
+DxfDimension *dxf_dimension_set_plot_style_name (DxfDimension *dimension, uint64_t plot_style_name);
 int32_t dxf_dimension_get_color_value (DxfDimension *dimension);
 DxfDimension *dxf_dimension_set_color_value (DxfDimension *dimension, int32_t color_value);
 char *dxf_dimension_get_color_name (DxfDimension *dimension);
@@ -40,6 +40,7 @@
 
 
 #include "dimstyle.h"
+#include "util.h"
 
 
 /*!
@@ -62,7 +63,7 @@ dxf_dimstyle_new ()
         size = sizeof (DxfDimStyle);
         /* avoid malloc of 0 bytes */
         if (size == 0) size = 1;
-        if ((dimstyle = malloc (size)) == NULL)
+        if ((dimstyle = dxf_malloc (size)) == NULL)
         {
                 fprintf (stderr,
                   (_("Error in %s () could not allocate memory.\n")),
@@ -113,12 +114,12 @@ dxf_dimstyle_init
                 __FUNCTION__);
               return (NULL);
         }
-        dimstyle->dimstyle_name = strdup ("");
-        dimstyle->dimpost = strdup ("");
-        dimstyle->dimapost = strdup ("");
-        dimstyle->dimblk = strdup ("");
-        dimstyle->dimblk1 = strdup ("");
-        dimstyle->dimblk2 = strdup ("");
+        dimstyle->dimstyle_name = dxf_strdup ("");
+        dimstyle->dimpost = dxf_strdup ("");
+        dimstyle->dimapost = dxf_strdup ("");
+        dimstyle->dimblk = dxf_strdup ("");
+        dimstyle->dimblk1 = dxf_strdup ("");
+        dimstyle->dimblk2 = dxf_strdup ("");
         dimstyle->dimscale = 0.0;
         dimstyle->dimasz = 0.0;
         dimstyle->dimexo = 0.0;
@@ -154,9 +155,9 @@ dxf_dimstyle_init
         dimstyle->dimclrd = DXF_COLOR_BYLAYER;
         dimstyle->dimclre = DXF_COLOR_BYLAYER;
         dimstyle->dimclrt = DXF_COLOR_BYLAYER;
-        dimstyle->dictionary_owner_soft = strdup ("");
-        dimstyle->object_owner_soft = strdup ("");
-        dimstyle->dictionary_owner_hard = strdup ("");
+        dimstyle->dictionary_owner_soft = 0;
+        dimstyle->object_owner_soft = 0;
+        dimstyle->dictionary_owner_hard = 0;
         dimstyle->next = NULL;
 #if DEBUG
         DXF_DEBUG_END
@@ -188,7 +189,8 @@ dxf_dimstyle_read
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        char *temp_string = NULL;
+        char temp_string[DXF_MAX_STRING_LENGTH];
+        int group_code;
         int iter330;
 
         /* Do some basic checks. */
@@ -197,8 +199,6 @@ dxf_dimstyle_read
                 fprintf (stderr,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
-                /* Clean up. */
-                free (temp_string);
                 return (NULL);
         }
         if (dimstyle == NULL)
@@ -209,503 +209,386 @@ dxf_dimstyle_read
                 dimstyle = dxf_dimstyle_init (dimstyle);
         }
         iter330 = 0;
-        (fp->line_number)++;
-        fscanf (fp->fp, "%[^\n]", temp_string);
-        while (strcmp (temp_string, "0") != 0)
+        while ((dxf_read_group_code (fp, &group_code) == EXIT_SUCCESS)
+          && (group_code != 0))
         {
-                if (ferror (fp->fp))
+                if (dxf_read_error (fp))
                 {
                         fprintf (stderr,
                           (_("Error in %s () while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
                         /* Clean up. */
-                        free (temp_string);
-                        fclose (fp->fp);
                         return (NULL);
                 }
-                if (strcmp (temp_string, "2") == 0)
-                {
-                        /* Now follows a string containing a dimension
-                         * style name. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, dimstyle->dimstyle_name);
-                }
-                else if (strcmp (temp_string, "3") == 0)
-                {
-                        /* Now follows a string containing a general
-                         * dimensioning suffix. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, dimstyle->dimpost);
-                }
-                else if (strcmp (temp_string, "4") == 0)
-                {
-                        /* Now follows a string containing an alternate
-                         * dimensioning suffix. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, dimstyle->dimapost);
-                }
-                else if ((fp->acad_version_number < AutoCAD_2000)
-                        && (strcmp (temp_string, "5") == 0))
-                {
-                        /* Now follows a string containing an arrow
-                         * block name. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, dimstyle->dimblk);
-                }
-                else if ((fp->acad_version_number < AutoCAD_2000)
-                        && (strcmp (temp_string, "6") == 0))
-                {
-                        /* Now follows a string containing a first arrow
-                         * block name. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, dimstyle->dimblk1);
-                }
-#if 0
-/*!
- * \todo For AutoCAD versions > 2000 the value of group code 6 has to be
- * tested before overwriting the id_code.
- */
-                else if ((fp->acad_version_number >= AutoCAD_2000)
-                        && (strcmp (temp_string, "6") == 0))
-                {
-                        /* Now follows a string containing a sequential
-                         * id number. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%x\n", &dimstyle->id_code);
-                }
-#endif
-                else if ((fp->acad_version_number < AutoCAD_2000)
-                        && (strcmp (temp_string, "7") == 0))
-                {
-                        /* Now follows a string containing a first arrow
-                         * block name. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, dimstyle->dimblk2);
-                }
-#if 0
-/*!
- * \todo For AutoCAD versions > 2000 the value of group code 7 has to be
- * tested before overwriting the id_code.
- */
-                else if ((fp->acad_version_number >= AutoCAD_2000)
-                        && (strcmp (temp_string, "7") == 0))
-                {
-                        /* Now follows a string containing a sequential
-                         * id number. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%x\n", &dimstyle->id_code);
-                }
-#endif
-                else if (strcmp (temp_string, "40") == 0)
-                {
-                        /* Now follows a string containing an overall
-                         * dimensioning scale factor. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &dimstyle->dimscale);
-                }
-                else if (strcmp (temp_string, "41") == 0)
-                {
-                        /* Now follows a string containing a
-                         * dimensioning arrow size. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &dimstyle->dimasz);
-                }
-                else if (strcmp (temp_string, "42") == 0)
-                {
-                        /* Now follows a string containing a
-                         * extension line offset. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &dimstyle->dimexo);
-                }
-                else if (strcmp (temp_string, "43") == 0)
-                {
-                        /* Now follows a string containing a
-                         * dimension line increment. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &dimstyle->dimdli);
-                }
-                else if (strcmp (temp_string, "44") == 0)
-                {
-                        /* Now follows a string containing a
-                         * extension line extension. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &dimstyle->dimexe);
-                }
-                else if (strcmp (temp_string, "45") == 0)
-                {
-                        /* Now follows a string containing a
-                         * rounding value for dimension distances. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &dimstyle->dimrnd);
-                }
-                else if (strcmp (temp_string, "46") == 0)
-                {
-                        /* Now follows a string containing a
-                         * dimension line extension. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &dimstyle->dimdle);
-                }
-                else if (strcmp (temp_string, "47") == 0)
-                {
-                        /* Now follows a string containing a
-                         * plus tolerance. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &dimstyle->dimtp);
-                }
-                else if (strcmp (temp_string, "48") == 0)
-                {
-                        /* Now follows a string containing a
-                         * minus tolerance. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &dimstyle->dimtm);
-                }
-                else if (strcmp (temp_string, "70") == 0)
-                {
-                        /* Now follows a string containing a flag. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%hd\n", &dimstyle->flag);
-                }
-                else if (strcmp (temp_string, "71") == 0)
-                {
-                        /* Now follows a string containing a dimension
-                         * tolerances flag. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%hd\n", &dimstyle->dimtol);
-                }
-                else if (strcmp (temp_string, "72") == 0)
-                {
-                        /* Now follows a string containing a dimension
-                         * limits flag. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%hd\n", &dimstyle->dimlim);
-                }
-                else if (strcmp (temp_string, "73") == 0)
-                {
-                        /* Now follows a string containing a dimension
-                         * text inside horizontal flag. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%hd\n", &dimstyle->dimtih);
-                }
-                else if (strcmp (temp_string, "74") == 0)
-                {
-                        /* Now follows a string containing a dimension
-                         * text outside horizontal flag. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%hd\n", &dimstyle->dimtoh);
-                }
-                else if (strcmp (temp_string, "75") == 0)
-                {
-                        /* Now follows a string containing a first
-                         * extension line suppression flag. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%hd\n", &dimstyle->dimse1);
-                }
-                else if (strcmp (temp_string, "76") == 0)
-                {
-                        /* Now follows a string containing a second
-                         * extension line suppression flag. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%hd\n", &dimstyle->dimse2);
-                }
-                else if (strcmp (temp_string, "77") == 0)
-                {
-                        /* Now follows a string containing a text above
-                         * dimension line flag. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%hd\n", &dimstyle->dimtad);
-                }
-                else if (strcmp (temp_string, "78") == 0)
-                {
-                        /* Now follows a string containing a zero
-                         * suppression for "feet & inch" dimensions
-                         * flag. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%hd\n", &dimstyle->dimzin);
-                }
-                else if ((fp->acad_version_number >= AutoCAD_13)
-                        && (strcmp (temp_string, "100") == 0))
-                {
-                        /* Now follows a string containing the
-                         * subclass marker value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
-                        if ((strcmp (temp_string, "AcDbSymbolTableRecord") != 0)
-                        && (strcmp (temp_string, "AcDbDimStyleTableRecord") != 0))
-                        {
-                                fprintf (stderr,
-                                  (_("Warning in %s () found a bad subclass marker in: %s in line: %d.\n")),
-                                  __FUNCTION__, fp->filename, fp->line_number);
-                        }
-                }
-                else if (strcmp (temp_string, "105") == 0)
-                {
-                        /* Now follows a string containing a sequential
-                         * id number. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%x\n", (uint *) &dimstyle->id_code);
-                }
-                else if (strcmp (temp_string, "140") == 0)
-                {
-                        /* Now follows a string containing a
-                         * dimensioning text height. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &dimstyle->dimtxt);
-                }
-                else if (strcmp (temp_string, "141") == 0)
-                {
-                        /* Now follows a string containing a size of
-                         * center mark/lines. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &dimstyle->dimcen);
-                }
-                else if (strcmp (temp_string, "142") == 0)
-                {
-                        /* Now follows a string containing a
-                         * dimensioning tick size: 0 = no ticks. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &dimstyle->dimtsz);
-                }
-                else if (strcmp (temp_string, "143") == 0)
-                {
-                        /* Now follows a string containing a
-                         * alternate unit scale factor. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &dimstyle->dimaltf);
-                }
-                else if (strcmp (temp_string, "144") == 0)
-                {
-                        /* Now follows a string containing a linear
-                         * measurements scale factor. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &dimstyle->dimlfac);
-                }
-                else if (strcmp (temp_string, "145") == 0)
-                {
-                        /* Now follows a string containing a text
-                         * vertical position. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &dimstyle->dimtvp);
-                }
-                else if (strcmp (temp_string, "146") == 0)
-                {
-                        /* Now follows a string containing a dimension
-                         * tolerance display scale factor. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &dimstyle->dimtfac);
-                }
-                else if (strcmp (temp_string, "147") == 0)
-                {
-                        /* Now follows a string containing a dimension
-                         * line gap. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &dimstyle->dimgap);
-                }
-                else if (strcmp (temp_string, "170") == 0)
-                {
-                        /* Now follows a string containing a alternate
-                         * unit dimensioning flag. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%hd\n", &dimstyle->dimalt);
-                }
-                else if (strcmp (temp_string, "171") == 0)
-                {
-                        /* Now follows a string containing a alternate
-                         * unit decimal places. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%hd\n", &dimstyle->dimaltd);
-                }
-                else if (strcmp (temp_string, "172") == 0)
-                {
-                        /* Now follows a string containing a text
-                         * outside extensions, force line extensions
-                         * between extensions flag. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%hd\n", &dimstyle->dimtofl);
-                }
-                else if (strcmp (temp_string, "173") == 0)
-                {
-                        /* Now follows a string containing a use
-                         * separate arrow blocks flag. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%hd\n", &dimstyle->dimsah);
-                }
-                else if (strcmp (temp_string, "174") == 0)
-                {
-                        /* Now follows a string containing a force text
-                         * inside extensions flag. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%hd\n", &dimstyle->dimtix);
-                }
-                else if (strcmp (temp_string, "175") == 0)
-                {
-                        /* Now follows a string containing a suppress
-                         * outside-extensions dimension lines flag. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%hd\n", &dimstyle->dimsoxd);
-                }
-                else if (strcmp (temp_string, "176") == 0)
+                switch (group_code)
                 {
-                        /* Now follows a string containing a dimension
-                         * line color value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%hd\n", &dimstyle->dimclrd);
-                }
-                else if (strcmp (temp_string, "177") == 0)
-                {
-                        /* Now follows a string containing a dimension
-                         * extension line color value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%hd\n", &dimstyle->dimclre);
-                }
-                else if (strcmp (temp_string, "178") == 0)
-                {
-                        /* Now follows a string containing a dimension
-                         * text color value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%hd\n", &dimstyle->dimclrt);
-                }
-                else if (strcmp (temp_string, "270") == 0)
-                {
-                        /* Now follows a string containing a units
-                         * format for all dimension style family members
-                         * except angular. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%hd\n", &dimstyle->dimunit);
-                }
-                else if (strcmp (temp_string, "271") == 0)
-                {
-                        /* Now follows a string containing a number of
-                         * decimal places for the tolerance values of
-                         * a primary units dimension. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%hd\n", &dimstyle->dimdec);
-                }
-                else if (strcmp (temp_string, "272") == 0)
-                {
-                        /* Now follows a string containing a number of
-                         * decimal places to display the tolerance
-                         * values. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%hd\n", &dimstyle->dimtdec);
-                }
-                else if (strcmp (temp_string, "273") == 0)
-                {
-                        /* Now follows a string containing a units
-                         * format for alternate units of all dimension
-                         * style family members except angular. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%hd\n", &dimstyle->dimaltu);
-                }
-                else if (strcmp (temp_string, "274") == 0)
-                {
-                        /* Now follows a string containing a number of
-                         * decimal places for tolerance values of an
-                         * alternate units dimension. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%hd\n", &dimstyle->dimalttd);
-                }
-                else if (strcmp (temp_string, "275") == 0)
-                {
-                        /* Now follows a string containing an angle
-                         * format for angular dimensions. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%hd\n", &dimstyle->dimaunit);
-                }
-                else if (strcmp (temp_string, "280") == 0)
-                {
-                        /* Now follows a string containing a horizontal
-                         * dimension text position. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%hd\n", &dimstyle->dimjust);
-                }
-                else if (strcmp (temp_string, "281") == 0)
-                {
-                        /* Now follows a string containing suppression
-                         * of first extension line. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%hd\n", &dimstyle->dimsd1);
-                }
-                else if (strcmp (temp_string, "282") == 0)
-                {
-                        /* Now follows a string containing suppression
-                         * of second extension line. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%hd\n", &dimstyle->dimsd2);
-                }
-                else if (strcmp (temp_string, "283") == 0)
-                {
-                        /* Now follows a string containing vertical
-                         * justification for tolerance values. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%hd\n", &dimstyle->dimtolj);
-                }
-                else if (strcmp (temp_string, "284") == 0)
-                {
-                        /* Now follows a string containing suppression
-                         * of zeros for tolerance values. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%hd\n", &dimstyle->dimtzin);
-                }
-                else if (strcmp (temp_string, "285") == 0)
-                {
-                        /* Now follows a string containing toggles
-                         * suppression of zeros for alternate unit
-                         * dimension values. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%hd\n", &dimstyle->dimaltz);
-                }
-                else if (strcmp (temp_string, "286") == 0)
-                {
-                        /* Now follows a string containing toggles
-                         * suppression of zeros for tolerance values. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%hd\n", &dimstyle->dimalttz);
-                }
-                else if (strcmp (temp_string, "287") == 0)
-                {
-                        /* Now follows a string containing placement of
-                         * text and arrowheads. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%hd\n", &dimstyle->dimfit);
-                }
-                else if (strcmp (temp_string, "288") == 0)
-                {
-                        /* Now follows a string containing cursor
-                         * functionality for user positioned text. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%hd\n", &dimstyle->dimupt);
-                }
-                else if (strcmp (temp_string, "330") == 0)
-                {
-                        if (iter330 == 0)
-                        {
-                                /* Now follows a string containing a soft-pointer
+                        case 2:
+                                /* Now follows a string containing a dimension
+                                 * style name. */
+                                dxf_read_string_interned (fp, &dimstyle->dimstyle_name);
+                                break;
+                        case 3:
+                                /* Now follows a string containing a general
+                                 * dimensioning suffix. */
+                                dxf_read_string (fp, &dimstyle->dimpost);
+                                break;
+                        case 4:
+                                /* Now follows a string containing an alternate
+                                 * dimensioning suffix. */
+                                dxf_read_string (fp, &dimstyle->dimapost);
+                                break;
+                        case 5:
+                                if (fp->acad_version_number < AutoCAD_2000)
+                                {
+                                        /* Now follows a string containing an arrow
+                                         * block name. */
+                                        dxf_read_string (fp, &dimstyle->dimblk);
+                                }
+                                else
+                                {
+                                        dxf_read_line (temp_string, fp);
+                                }
+                                break;
+                        case 6:
+                                if (fp->acad_version_number < AutoCAD_2000)
+                                {
+                                        /* Now follows a string containing a first arrow
+                                         * block name. */
+                                        dxf_read_string (fp, &dimstyle->dimblk1);
+                                }
+                                else
+                                {
+                                        /*!
+                                         * \todo For AutoCAD versions >= 2000 the
+                                         * value of group code 6 has to be tested
+                                         * before overwriting the id_code.
+                                         */
+                                        dxf_read_line (temp_string, fp);
+                                }
+                                break;
+                        case 7:
+                                if (fp->acad_version_number < AutoCAD_2000)
+                                {
+                                        /* Now follows a string containing a first arrow
+                                         * block name. */
+                                        dxf_read_string (fp, &dimstyle->dimblk2);
+                                }
+                                else
+                                {
+                                        /*!
+                                         * \todo For AutoCAD versions >= 2000 the
+                                         * value of group code 7 has to be tested
+                                         * before overwriting the id_code.
+                                         */
+                                        dxf_read_line (temp_string, fp);
+                                }
+                                break;
+                        case 40:
+                                /* Now follows a string containing an overall
+                                 * dimensioning scale factor. */
+                                dxf_read_double (fp, &dimstyle->dimscale);
+                                break;
+                        case 41:
+                                /* Now follows a string containing a
+                                 * dimensioning arrow size. */
+                                dxf_read_double (fp, &dimstyle->dimasz);
+                                break;
+                        case 42:
+                                /* Now follows a string containing a
+                                 * extension line offset. */
+                                dxf_read_double (fp, &dimstyle->dimexo);
+                                break;
+                        case 43:
+                                /* Now follows a string containing a
+                                 * dimension line increment. */
+                                dxf_read_double (fp, &dimstyle->dimdli);
+                                break;
+                        case 44:
+                                /* Now follows a string containing a
+                                 * extension line extension. */
+                                dxf_read_double (fp, &dimstyle->dimexe);
+                                break;
+                        case 45:
+                                /* Now follows a string containing a
+                                 * rounding value for dimension distances. */
+                                dxf_read_double (fp, &dimstyle->dimrnd);
+                                break;
+                        case 46:
+                                /* Now follows a string containing a
+                                 * dimension line extension. */
+                                dxf_read_double (fp, &dimstyle->dimdle);
+                                break;
+                        case 47:
+                                /* Now follows a string containing a
+                                 * plus tolerance. */
+                                dxf_read_double (fp, &dimstyle->dimtp);
+                                break;
+                        case 48:
+                                /* Now follows a string containing a
+                                 * minus tolerance. */
+                                dxf_read_double (fp, &dimstyle->dimtm);
+                                break;
+                        case 70:
+                                /* Now follows a string containing a flag. */
+                                dxf_read_int16 (fp, &dimstyle->flag);
+                                break;
+                        case 71:
+                                /* Now follows a string containing a dimension
+                                 * tolerances flag. */
+                                dxf_read_int16 (fp, &dimstyle->dimtol);
+                                break;
+                        case 72:
+                                /* Now follows a string containing a dimension
+                                 * limits flag. */
+                                dxf_read_int16 (fp, &dimstyle->dimlim);
+                                break;
+                        case 73:
+                                /* Now follows a string containing a dimension
+                                 * text inside horizontal flag. */
+                                dxf_read_int16 (fp, &dimstyle->dimtih);
+                                break;
+                        case 74:
+                                /* Now follows a string containing a dimension
+                                 * text outside horizontal flag. */
+                                dxf_read_int16 (fp, &dimstyle->dimtoh);
+                                break;
+                        case 75:
+                                /* Now follows a string containing a first
+                                 * extension line suppression flag. */
+                                dxf_read_int16 (fp, &dimstyle->dimse1);
+                                break;
+                        case 76:
+                                /* Now follows a string containing a second
+                                 * extension line suppression flag. */
+                                dxf_read_int16 (fp, &dimstyle->dimse2);
+                                break;
+                        case 77:
+                                /* Now follows a string containing a text above
+                                 * dimension line flag. */
+                                dxf_read_int16 (fp, &dimstyle->dimtad);
+                                break;
+                        case 78:
+                                /* Now follows a string containing a zero
+                                 * suppression for "feet & inch" dimensions
+                                 * flag. */
+                                dxf_read_int16 (fp, &dimstyle->dimzin);
+                                break;
+                        case 100:
+                                if (fp->acad_version_number >= AutoCAD_13)
+                                {
+                                        /* Now follows a string containing the
+                                         * subclass marker value. */
+                                        dxf_read_line (temp_string, fp);
+                                        if ((strcmp (temp_string, "AcDbSymbolTableRecord") != 0)
+                                        && (strcmp (temp_string, "AcDbDimStyleTableRecord") != 0))
+                                        {
+                                                fprintf (stderr,
+                                                  (_("Warning in %s () found a bad subclass marker in: %s in line: %d.\n")),
+                                                  __FUNCTION__, fp->filename, fp->line_number);
+                                        }
+                                }
+                                break;
+                        case 105:
+                                /* Now follows a string containing a sequential
+                                 * id number. */
+                                dxf_read_handle (fp, &dimstyle->id_code);
+                                break;
+                        case 140:
+                                /* Now follows a string containing a
+                                 * dimensioning text height. */
+                                dxf_read_double (fp, &dimstyle->dimtxt);
+                                break;
+                        case 141:
+                                /* Now follows a string containing a size of
+                                 * center mark/lines. */
+                                dxf_read_double (fp, &dimstyle->dimcen);
+                                break;
+                        case 142:
+                                /* Now follows a string containing a
+                                 * dimensioning tick size: 0 = no ticks. */
+                                dxf_read_double (fp, &dimstyle->dimtsz);
+                                break;
+                        case 143:
+                                /* Now follows a string containing a
+                                 * alternate unit scale factor. */
+                                dxf_read_double (fp, &dimstyle->dimaltf);
+                                break;
+                        case 144:
+                                /* Now follows a string containing a linear
+                                 * measurements scale factor. */
+                                dxf_read_double (fp, &dimstyle->dimlfac);
+                                break;
+                        case 145:
+                                /* Now follows a string containing a text
+                                 * vertical position. */
+                                dxf_read_double (fp, &dimstyle->dimtvp);
+                                break;
+                        case 146:
+                                /* Now follows a string containing a dimension
+                                 * tolerance display scale factor. */
+                                dxf_read_double (fp, &dimstyle->dimtfac);
+                                break;
+                        case 147:
+                                /* Now follows a string containing a dimension
+                                 * line gap. */
+                                dxf_read_double (fp, &dimstyle->dimgap);
+                                break;
+                        case 170:
+                                /* Now follows a string containing a alternate
+                                 * unit dimensioning flag. */
+                                dxf_read_int16 (fp, &dimstyle->dimalt);
+                                break;
+                        case 171:
+                                /* Now follows a string containing a alternate
+                                 * unit decimal places. */
+                                dxf_read_int16 (fp, &dimstyle->dimaltd);
+                                break;
+                        case 172:
+                                /* Now follows a string containing a text
+                                 * outside extensions, force line extensions
+                                 * between extensions flag. */
+                                dxf_read_int16 (fp, &dimstyle->dimtofl);
+                                break;
+                        case 173:
+                                /* Now follows a string containing a use
+                                 * separate arrow blocks flag. */
+                                dxf_read_int16 (fp, &dimstyle->dimsah);
+                                break;
+                        case 174:
+                                /* Now follows a string containing a force text
+                                 * inside extensions flag. */
+                                dxf_read_int16 (fp, &dimstyle->dimtix);
+                                break;
+                        case 175:
+                                /* Now follows a string containing a suppress
+                                 * outside-extensions dimension lines flag. */
+                                dxf_read_int16 (fp, &dimstyle->dimsoxd);
+                                break;
+                        case 176:
+                                /* Now follows a string containing a dimension
+                                 * line color value. */
+                                dxf_read_int16 (fp, &dimstyle->dimclrd);
+                                break;
+                        case 177:
+                                /* Now follows a string containing a dimension
+                                 * extension line color value. */
+                                dxf_read_int16 (fp, &dimstyle->dimclre);
+                                break;
+                        case 178:
+                                /* Now follows a string containing a dimension
+                                 * text color value. */
+                                dxf_read_int16 (fp, &dimstyle->dimclrt);
+                                break;
+                        case 270:
+                                /* Now follows a string containing a units
+                                 * format for all dimension style family members
+                                 * except angular. */
+                                dxf_read_int16 (fp, &dimstyle->dimunit);
+                                break;
+                        case 271:
+                                /* Now follows a string containing a number of
+                                 * decimal places for the tolerance values of
+                                 * a primary units dimension. */
+                                dxf_read_int16 (fp, &dimstyle->dimdec);
+                                break;
+                        case 272:
+                                /* Now follows a string containing a number of
+                                 * decimal places to display the tolerance
+                                 * values. */
+                                dxf_read_int16 (fp, &dimstyle->dimtdec);
+                                break;
+                        case 273:
+                                /* Now follows a string containing a units
+                                 * format for alternate units of all dimension
+                                 * style family members except angular. */
+                                dxf_read_int16 (fp, &dimstyle->dimaltu);
+                                break;
+                        case 274:
+                                /* Now follows a string containing a number of
+                                 * decimal places for tolerance values of an
+                                 * alternate units dimension. */
+                                dxf_read_int16 (fp, &dimstyle->dimalttd);
+                                break;
+                        case 275:
+                                /* Now follows a string containing an angle
+                                 * format for angular dimensions. */
+                                dxf_read_int16 (fp, &dimstyle->dimaunit);
+                                break;
+                        case 280:
+                                /* Now follows a string containing a horizontal
+                                 * dimension text position. */
+                                dxf_read_int16 (fp, &dimstyle->dimjust);
+                                break;
+                        case 281:
+                                /* Now follows a string containing suppression
+                                 * of first extension line. */
+                                dxf_read_int16 (fp, &dimstyle->dimsd1);
+                                break;
+                        case 282:
+                                /* Now follows a string containing suppression
+                                 * of second extension line. */
+                                dxf_read_int16 (fp, &dimstyle->dimsd2);
+                                break;
+                        case 283:
+                                /* Now follows a string containing vertical
+                                 * justification for tolerance values. */
+                                dxf_read_int16 (fp, &dimstyle->dimtolj);
+                                break;
+                        case 284:
+                                /* Now follows a string containing suppression
+                                 * of zeros for tolerance values. */
+                                dxf_read_int16 (fp, &dimstyle->dimtzin);
+                                break;
+                        case 285:
+                                /* Now follows a string containing toggles
+                                 * suppression of zeros for alternate unit
+                                 * dimension values. */
+                                dxf_read_int16 (fp, &dimstyle->dimaltz);
+                                break;
+                        case 286:
+                                /* Now follows a string containing toggles
+                                 * suppression of zeros for tolerance values. */
+                                dxf_read_int16 (fp, &dimstyle->dimalttz);
+                                break;
+                        case 287:
+                                /* Now follows a string containing placement of
+                                 * text and arrowheads. */
+                                dxf_read_int16 (fp, &dimstyle->dimfit);
+                                break;
+                        case 288:
+                                /* Now follows a string containing cursor
+                                 * functionality for user positioned text. */
+                                dxf_read_int16 (fp, &dimstyle->dimupt);
+                                break;
+                        case 330:
+                                if (iter330 == 0)
+                                {
+                                        /* Now follows a string containing a soft-pointer
+                                         * ID/handle to owner dictionary. */
+                                        dxf_read_handle (fp, &dimstyle->dictionary_owner_soft);
+                                }
+                                if (iter330 == 1)
+                                {
+                                        /* Now follows a string containing a soft-pointer
+                                         * ID/handle to owner object. */
+                                        dxf_read_handle (fp, &dimstyle->object_owner_soft);
+                                }
+                                iter330++;
+                                break;
+                        case 340:
+                                /* Now follows a string containing dimension
+                                 * text style. */
+                                dxf_read_string (fp, &dimstyle->dimtxsty);
+                                break;
+                        case 360:
+                                /* Now follows a string containing Hard owner
                                  * ID/handle to owner dictionary. */
-                                (fp->line_number)++;
-                                fscanf (fp->fp, DXF_MAX_STRING_FORMAT, dimstyle->dictionary_owner_soft);
-                        }
-                        if (iter330 == 1)
-                        {
-                                /* Now follows a string containing a soft-pointer
-                                 * ID/handle to owner object. */
-                                (fp->line_number)++;
-                                fscanf (fp->fp, DXF_MAX_STRING_FORMAT, dimstyle->object_owner_soft);
-                        }
-                        iter330++;
-                }
-                else if (strcmp (temp_string, "340") == 0)
-                {
-                        /* Now follows a string containing dimension
-                         * text style. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, dimstyle->dimtxsty);
-                }
-                else if (strcmp (temp_string, "360") == 0)
-                {
-                        /* Now follows a string containing Hard owner
-                         * ID/handle to owner dictionary. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, dimstyle->dictionary_owner_hard);
+                                dxf_read_handle (fp, &dimstyle->dictionary_owner_hard);
+                                break;
+                        default:
+                                /* Skip the value of the unknown group code. */
+                                dxf_read_line (temp_string, fp);
+                                break;
                 }
         }
         /* Handle omitted members and/or illegal values. */
@@ -714,12 +597,8 @@ dxf_dimstyle_read
                 fprintf (stderr,
                   (_("Error in %s () dimstyle_name value is empty.\n")),
                   __FUNCTION__);
-                /* Clean up. */
-                free (temp_string);
                 return (NULL);
         }
-        /* Clean up. */
-        free (temp_string);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -746,7 +625,7 @@ dxf_dimstyle_write
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        char *dxf_entity_name = strdup ("DIMSTYLE");
+        char *dxf_entity_name = dxf_strdup ("DIMSTYLE");
 
         /* Do some basic checks. */
         if (fp == NULL)
@@ -755,7 +634,7 @@ dxf_dimstyle_write
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (dimstyle == NULL)
@@ -764,7 +643,7 @@ dxf_dimstyle_write
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (strcmp (dimstyle->dimstyle_name, "") == 0)
@@ -776,7 +655,7 @@ dxf_dimstyle_write
                   (_("\tskipping %s table.\n")),
                   dxf_entity_name);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (!dimstyle->dimstyle_name)
@@ -788,40 +667,40 @@ dxf_dimstyle_write
                   (_("\tskipping %s table.\n")),
                   dxf_entity_name);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (fp->acad_version_number < AutoCAD_13)
         {
                 fprintf (stderr,
-                  (_("Warning in %s () illegal DXF version for this %s entity with id-code: %x.\n")),
+                  (_("Warning in %s () illegal DXF version for this %s entity with id-code: %" PRIx64 ".\n")),
                   __FUNCTION__, dxf_entity_name, dimstyle->id_code);
         }
         if (!dimstyle->dimpost)
         {
-                dimstyle->dimpost = strdup ("");
+                dimstyle->dimpost = dxf_strdup ("");
         }
         if (!dimstyle->dimapost)
         {
-                dimstyle->dimapost = strdup ("");
+                dimstyle->dimapost = dxf_strdup ("");
         }
         if (!dimstyle->dimblk)
         {
-                dimstyle->dimblk = strdup ("");
+                dimstyle->dimblk = dxf_strdup ("");
         }
         if (!dimstyle->dimblk1)
         {
-                dimstyle->dimblk1 = strdup ("");
+                dimstyle->dimblk1 = dxf_strdup ("");
         }
         if (!dimstyle->dimblk2)
         {
-                dimstyle->dimblk2 = strdup ("");
+                dimstyle->dimblk2 = dxf_strdup ("");
         }
         /* Start writing output. */
-        fprintf (fp->fp, "  0\n%s\n", dxf_entity_name);
-        if (dimstyle->id_code != -1)
+        dxf_write_string (fp, 0, dxf_entity_name);
+        if (dimstyle->id_code != DXF_HANDLE_NONE)
         {
-                fprintf (fp->fp, "105\n%x\n", dimstyle->id_code);
+                dxf_write_hex (fp, 105, dimstyle->id_code);
         }
         /*!
          * \todo for version R14.\n
@@ -833,106 +712,106 @@ dxf_dimstyle_write
          * 102 groups are application defined (optional).\n\n
          * End of group, "}" (optional), with Group code 102.
          */
-        if ((strcmp (dimstyle->dictionary_owner_soft, "") != 0)
+        if ((dimstyle->dictionary_owner_soft != 0)
           && (fp->acad_version_number >= AutoCAD_14))
         {
-                fprintf (fp->fp, "102\n{ACAD_REACTORS\n");
-                fprintf (fp->fp, "330\n%s\n", dimstyle->dictionary_owner_soft);
-                fprintf (fp->fp, "102\n}\n");
+                dxf_write_string (fp, 102, "{ACAD_REACTORS");
+                dxf_write_hex (fp, 330, dimstyle->dictionary_owner_soft);
+                dxf_write_string (fp, 102, "}");
         }
-        if ((strcmp (dimstyle->dictionary_owner_hard, "") != 0)
+        if ((dimstyle->dictionary_owner_hard != 0)
           && (fp->acad_version_number >= AutoCAD_14))
         {
-                fprintf (fp->fp, "102\n{ACAD_XDICTIONARY\n");
-                fprintf (fp->fp, "360\n%s\n", dimstyle->dictionary_owner_hard);
-                fprintf (fp->fp, "102\n}\n");
+                dxf_write_string (fp, 102, "{ACAD_XDICTIONARY");
+                dxf_write_hex (fp, 360, dimstyle->dictionary_owner_hard);
+                dxf_write_string (fp, 102, "}");
         }
-        if ((strcmp (dimstyle->object_owner_soft, "") != 0)
+        if ((dimstyle->object_owner_soft != 0)
           && (fp->acad_version_number >= AutoCAD_2000))
         {
-                fprintf (fp->fp, "330\n%s\n", dimstyle->object_owner_soft);
+                dxf_write_hex (fp, 330, dimstyle->object_owner_soft);
         }
         if (fp->acad_version_number >= AutoCAD_13)
         {
-                fprintf (fp->fp, "100\nAcDbSymbolTableRecord\n");
+                dxf_write_string (fp, 100, "AcDbSymbolTableRecord");
         }
         if (fp->acad_version_number >= AutoCAD_13)
         {
-                fprintf (fp->fp, "100\nAcDbDimStyleTableRecord\n");
+                dxf_write_string (fp, 100, "AcDbDimStyleTableRecord");
         }
-        fprintf (fp->fp, "  2\n%s\n", dimstyle->dimstyle_name);
-        fprintf (fp->fp, " 70\n%hd\n", dimstyle->flag);
-        fprintf (fp->fp, "  3\n%s\n", dimstyle->dimpost);
-        fprintf (fp->fp, "  4\n%s\n", dimstyle->dimapost);
+        dxf_write_string (fp, 2, dimstyle->dimstyle_name);
+        dxf_write_int (fp, 70, dimstyle->flag);
+        dxf_write_string (fp, 3, dimstyle->dimpost);
+        dxf_write_string (fp, 4, dimstyle->dimapost);
         if (fp->acad_version_number < AutoCAD_2000)
         {
-                fprintf (fp->fp, "  5\n%s\n", dimstyle->dimblk);
+                dxf_write_string (fp, 5, dimstyle->dimblk);
         }
         if (fp->acad_version_number < AutoCAD_2000)
         {
-                fprintf (fp->fp, "  6\n%s\n", dimstyle->dimblk1);
+                dxf_write_string (fp, 6, dimstyle->dimblk1);
         }
         if (fp->acad_version_number < AutoCAD_2000)
         {
-                fprintf (fp->fp, "  7\n%s\n", dimstyle->dimblk2);
-        }
-        fprintf (fp->fp, " 40\n%f\n", dimstyle->dimscale);
-        fprintf (fp->fp, " 41\n%f\n", dimstyle->dimasz);
-        fprintf (fp->fp, " 42\n%f\n", dimstyle->dimexo);
-        fprintf (fp->fp, " 43\n%f\n", dimstyle->dimdli);
-        fprintf (fp->fp, " 44\n%f\n", dimstyle->dimexe);
-        fprintf (fp->fp, " 45\n%f\n", dimstyle->dimrnd);
-        fprintf (fp->fp, " 46\n%f\n", dimstyle->dimdle);
-        fprintf (fp->fp, " 47\n%f\n", dimstyle->dimtp);
-        fprintf (fp->fp, " 48\n%f\n", dimstyle->dimtm);
-        fprintf (fp->fp, "140\n%f\n", dimstyle->dimtxt);
-        fprintf (fp->fp, "141\n%f\n", dimstyle->dimcen);
-        fprintf (fp->fp, "142\n%f\n", dimstyle->dimtsz);
-        fprintf (fp->fp, "143\n%f\n", dimstyle->dimaltf);
-        fprintf (fp->fp, "144\n%f\n", dimstyle->dimlfac);
-        fprintf (fp->fp, "145\n%f\n", dimstyle->dimtvp);
-        fprintf (fp->fp, "146\n%f\n", dimstyle->dimtfac);
-        fprintf (fp->fp, "147\n%f\n", dimstyle->dimgap);
-        fprintf (fp->fp, " 71\n%hd\n", dimstyle->dimtol);
-        fprintf (fp->fp, " 72\n%hd\n", dimstyle->dimlim);
-        fprintf (fp->fp, " 73\n%hd\n", dimstyle->dimtih);
-        fprintf (fp->fp, " 74\n%hd\n", dimstyle->dimtoh);
-        fprintf (fp->fp, " 75\n%hd\n", dimstyle->dimse1);
-        fprintf (fp->fp, " 76\n%hd\n", dimstyle->dimse2);
-        fprintf (fp->fp, " 77\n%hd\n", dimstyle->dimtad);
-        fprintf (fp->fp, " 78\n%hd\n", dimstyle->dimzin);
-        fprintf (fp->fp, "170\n%hd\n", dimstyle->dimalt);
-        fprintf (fp->fp, "171\n%hd\n", dimstyle->dimaltd);
-        fprintf (fp->fp, "172\n%hd\n", dimstyle->dimtofl);
-        fprintf (fp->fp, "173\n%hd\n", dimstyle->dimsah);
-        fprintf (fp->fp, "174\n%hd\n", dimstyle->dimtix);
-        fprintf (fp->fp, "175\n%hd\n", dimstyle->dimsoxd);
-        fprintf (fp->fp, "176\n%hd\n", dimstyle->dimclrd);
-        fprintf (fp->fp, "177\n%hd\n", dimstyle->dimclre);
-        fprintf (fp->fp, "178\n%dh\n", dimstyle->dimclrt);
+                dxf_write_string (fp, 7, dimstyle->dimblk2);
+        }
+        dxf_write_double (fp, 40, dimstyle->dimscale);
+        dxf_write_double (fp, 41, dimstyle->dimasz);
+        dxf_write_double (fp, 42, dimstyle->dimexo);
+        dxf_write_double (fp, 43, dimstyle->dimdli);
+        dxf_write_double (fp, 44, dimstyle->dimexe);
+        dxf_write_double (fp, 45, dimstyle->dimrnd);
+        dxf_write_double (fp, 46, dimstyle->dimdle);
+        dxf_write_double (fp, 47, dimstyle->dimtp);
+        dxf_write_double (fp, 48, dimstyle->dimtm);
+        dxf_write_double (fp, 140, dimstyle->dimtxt);
+        dxf_write_double (fp, 141, dimstyle->dimcen);
+        dxf_write_double (fp, 142, dimstyle->dimtsz);
+        dxf_write_double (fp, 143, dimstyle->dimaltf);
+        dxf_write_double (fp, 144, dimstyle->dimlfac);
+        dxf_write_double (fp, 145, dimstyle->dimtvp);
+        dxf_write_double (fp, 146, dimstyle->dimtfac);
+        dxf_write_double (fp, 147, dimstyle->dimgap);
+        dxf_write_int (fp, 71, dimstyle->dimtol);
+        dxf_write_int (fp, 72, dimstyle->dimlim);
+        dxf_write_int (fp, 73, dimstyle->dimtih);
+        dxf_write_int (fp, 74, dimstyle->dimtoh);
+        dxf_write_int (fp, 75, dimstyle->dimse1);
+        dxf_write_int (fp, 76, dimstyle->dimse2);
+        dxf_write_int (fp, 77, dimstyle->dimtad);
+        dxf_write_int (fp, 78, dimstyle->dimzin);
+        dxf_write_int (fp, 170, dimstyle->dimalt);
+        dxf_write_int (fp, 171, dimstyle->dimaltd);
+        dxf_write_int (fp, 172, dimstyle->dimtofl);
+        dxf_write_int (fp, 173, dimstyle->dimsah);
+        dxf_write_int (fp, 174, dimstyle->dimtix);
+        dxf_write_int (fp, 175, dimstyle->dimsoxd);
+        dxf_write_int (fp, 176, dimstyle->dimclrd);
+        dxf_write_int (fp, 177, dimstyle->dimclre);
+        dxf_write_int (fp, 178, dimstyle->dimclrt);
         if ((fp->acad_version_number >= AutoCAD_13)
           && (fp->acad_version_number < AutoCAD_2000))
         {
-                fprintf (fp->fp, "270\n%hd\n", dimstyle->dimunit);
-                fprintf (fp->fp, "271\n%hd\n", dimstyle->dimdec);
-                fprintf (fp->fp, "272\n%hd\n", dimstyle->dimtdec);
-                fprintf (fp->fp, "273\n%hd\n", dimstyle->dimaltu);
-                fprintf (fp->fp, "274\n%hd\n", dimstyle->dimalttd);
-                fprintf (fp->fp, "340\n%s\n", dimstyle->dimtxsty);
-                fprintf (fp->fp, "275\n%hd\n", dimstyle->dimaunit);
-                fprintf (fp->fp, "280\n%hd\n", dimstyle->dimjust);
-                fprintf (fp->fp, "281\n%hd\n", dimstyle->dimsd1);
-                fprintf (fp->fp, "282\n%hd\n", dimstyle->dimsd2);
-                fprintf (fp->fp, "283\n%hd\n", dimstyle->dimtolj);
-                fprintf (fp->fp, "284\n%hd\n", dimstyle->dimtzin);
-                fprintf (fp->fp, "285\n%hd\n", dimstyle->dimaltz);
-                fprintf (fp->fp, "286\n%hd\n", dimstyle->dimalttz);
-                fprintf (fp->fp, "287\n%hd\n", dimstyle->dimfit);
-                fprintf (fp->fp, "288\n%hd\n", dimstyle->dimupt);
-                fprintf (fp->fp, "  0\nENDTAB\n");
+                dxf_write_int (fp, 270, dimstyle->dimunit);
+                dxf_write_int (fp, 271, dimstyle->dimdec);
+                dxf_write_int (fp, 272, dimstyle->dimtdec);
+                dxf_write_int (fp, 273, dimstyle->dimaltu);
+                dxf_write_int (fp, 274, dimstyle->dimalttd);
+                dxf_write_string (fp, 340, dimstyle->dimtxsty);
+                dxf_write_int (fp, 275, dimstyle->dimaunit);
+                dxf_write_int (fp, 280, dimstyle->dimjust);
+                dxf_write_int (fp, 281, dimstyle->dimsd1);
+                dxf_write_int (fp, 282, dimstyle->dimsd2);
+                dxf_write_int (fp, 283, dimstyle->dimtolj);
+                dxf_write_int (fp, 284, dimstyle->dimtzin);
+                dxf_write_int (fp, 285, dimstyle->dimaltz);
+                dxf_write_int (fp, 286, dimstyle->dimalttz);
+                dxf_write_int (fp, 287, dimstyle->dimfit);
+                dxf_write_int (fp, 288, dimstyle->dimupt);
+                dxf_write_string (fp, 0, "ENDTAB");
         }
         /* Clean up. */
-        free (dxf_entity_name);
+        dxf_free (dxf_entity_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -973,16 +852,13 @@ dxf_dimstyle_free
                 __FUNCTION__);
               return (EXIT_FAILURE);
         }
-        free (dimstyle->dimstyle_name);
-        free (dimstyle->dimpost);
-        free (dimstyle->dimapost);
-        free (dimstyle->dimblk);
-        free (dimstyle->dimblk1);
-        free (dimstyle->dimblk2);
-        free (dimstyle->dictionary_owner_soft);
-        free (dimstyle->object_owner_soft);
-        free (dimstyle->dictionary_owner_hard);
-        free (dimstyle);
+        dxf_string_free (dimstyle->dimstyle_name);
+        dxf_free (dimstyle->dimpost);
+        dxf_free (dimstyle->dimapost);
+        dxf_free (dimstyle->dimblk);
+        dxf_free (dimstyle->dimblk1);
+        dxf_free (dimstyle->dimblk2);
+        dxf_free (dimstyle);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1058,7 +934,7 @@ dxf_dimstyle_get_dimstyle_name
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (dimstyle->dimstyle_name));
+        return (dxf_strdup (dimstyle->dimstyle_name));
 }
 
 
@@ -1104,7 +980,7 @@ dxf_dimstyle_set_dimstyle_name
                   __FUNCTION__);
                 return (NULL);
         }
-        dimstyle->dimstyle_name = strdup (dimstyle_name);
+        dimstyle->dimstyle_name = dxf_strdup (dimstyle_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1147,7 +1023,7 @@ dxf_dimstyle_get_dimpost
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (dimstyle->dimpost));
+        return (dxf_strdup (dimstyle->dimpost));
 }
 
 
@@ -1193,7 +1069,7 @@ dxf_dimstyle_set_dimpost
                   __FUNCTION__);
                 return (NULL);
         }
-        dimstyle->dimpost = strdup (dimpost);
+        dimstyle->dimpost = dxf_strdup (dimpost);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1236,7 +1112,7 @@ dxf_dimstyle_get_dimapost
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (dimstyle->dimapost));
+        return (dxf_strdup (dimstyle->dimapost));
 }
 
 
@@ -1282,7 +1158,7 @@ dxf_dimstyle_set_dimapost
                   __FUNCTION__);
                 return (NULL);
         }
-        dimstyle->dimapost = strdup (dimapost);
+        dimstyle->dimapost = dxf_strdup (dimapost);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1325,7 +1201,7 @@ dxf_dimstyle_get_dimblk
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (dimstyle->dimblk));
+        return (dxf_strdup (dimstyle->dimblk));
 }
 
 
@@ -1370,7 +1246,7 @@ dxf_dimstyle_set_dimblk
                   __FUNCTION__);
                 return (NULL);
         }
-        dimstyle->dimblk = strdup (dimblk);
+        dimstyle->dimblk = dxf_strdup (dimblk);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1413,7 +1289,7 @@ dxf_dimstyle_get_dimblk1
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (dimstyle->dimblk1));
+        return (dxf_strdup (dimstyle->dimblk1));
 }
 
 
@@ -1459,7 +1335,7 @@ dxf_dimstyle_set_dimblk1
                   __FUNCTION__);
                 return (NULL);
         }
-        dimstyle->dimblk1 = strdup (dimblk1);
+        dimstyle->dimblk1 = dxf_strdup (dimblk1);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1502,7 +1378,7 @@ dxf_dimstyle_get_dimblk2
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (dimstyle->dimblk2));
+        return (dxf_strdup (dimstyle->dimblk2));
 }
 
 
@@ -1548,7 +1424,7 @@ dxf_dimstyle_set_dimblk2
                   __FUNCTION__);
                 return (NULL);
         }
-        dimstyle->dimblk2 = strdup (dimblk2);
+        dimstyle->dimblk2 = dxf_strdup (dimblk2);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2836,7 +2712,7 @@ dxf_dimstyle_set_dimzin
  *
  * \return ID code.
  */
-int
+uint64_t
 dxf_dimstyle_get_id_code
 (
         DxfDimStyle *dimstyle
@@ -2874,7 +2750,7 @@ dxf_dimstyle_set_id_code
         DxfDimStyle *dimstyle,
                 /*!< a pointer to a DXF dimenstion style symbol table
                  * (\c DIMSTYLE). */
-        int id_code
+        uint64_t id_code
                 /*!< Identification number for the entity.\n
                  * This is to be an unique (sequential) number in the DXF
                  * file. */
@@ -5400,11 +5276,9 @@ dxf_dimstyle_set_dimupt
  * \brief Get the soft pointer to the \c dictionary_owner_soft from a
  * DXF \c DIMSTYLE symbol table entry.
  *
- * \return a pointer to the \c dictionary_owner_soft.
- *
- * \warning No checks are performed on the returned pointer.
+ * \return the handle of the \c dictionary_owner_soft.
  */
-char *
+uint64_t
 dxf_dimstyle_get_dictionary_owner_soft
 (
         DxfDimStyle *dimstyle
@@ -5420,19 +5294,12 @@ dxf_dimstyle_get_dictionary_owner_soft
                 fprintf (stderr,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
-                return (NULL);
-        }
-        if (dimstyle->dictionary_owner_soft ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
+                return (0);
         }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (dimstyle->dictionary_owner_soft));
+        return (dimstyle->dictionary_owner_soft);
 }
 
 
@@ -5448,8 +5315,8 @@ dxf_dimstyle_set_dictionary_owner_soft
 (
         DxfDimStyle *dimstyle,
                 /*!< a pointer to a DXF \c DIMSTYLE symbol table entry. */
-        char *dictionary_owner_soft
-                /*!< a string containing the pointer to the
+        uint64_t dictionary_owner_soft
+                /*!< the handle of the
                  * \c dictionary_owner_soft for the entity. */
 )
 {
@@ -5464,14 +5331,7 @@ dxf_dimstyle_set_dictionary_owner_soft
                   __FUNCTION__);
                 return (NULL);
         }
-        if (dictionary_owner_soft == NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was passed.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
-        dimstyle->dictionary_owner_soft = strdup (dictionary_owner_soft);
+        dimstyle->dictionary_owner_soft = dictionary_owner_soft;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -5484,10 +5344,8 @@ dxf_dimstyle_set_dictionary_owner_soft
  * \c DIMSTYLE symbol table.
  *
  * \return soft pointer to the object owner.
- *
- * \warning No checks are performed on the returned pointer (string).
  */
-char *
+uint64_t
 dxf_dimstyle_get_object_owner_soft
 (
         DxfDimStyle *dimstyle
@@ -5503,19 +5361,12 @@ dxf_dimstyle_get_object_owner_soft
                 fprintf (stderr,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
-                return (NULL);
-        }
-        if (dimstyle->object_owner_soft ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
+                return (0);
         }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (dimstyle->object_owner_soft));
+        return (dimstyle->object_owner_soft);
 }
 
 
@@ -5531,8 +5382,8 @@ dxf_dimstyle_set_object_owner_soft
 (
         DxfDimStyle *dimstyle,
                 /*!< a pointer to a DXF \c DIMSTYLE symbol table. */
-        char *object_owner_soft
-                /*!< a string containing the pointer to the
+        uint64_t object_owner_soft
+                /*!< the handle of the
                  * \c object_owner_soft for the symbol table. */
 )
 {
@@ -5547,14 +5398,7 @@ dxf_dimstyle_set_object_owner_soft
                   __FUNCTION__);
                 return (NULL);
         }
-        if (object_owner_soft == NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was passed.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
-        dimstyle->object_owner_soft = strdup (object_owner_soft);
+        dimstyle->object_owner_soft = object_owner_soft;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -5566,11 +5410,9 @@ dxf_dimstyle_set_object_owner_soft
  * \brief Get the pointer to the \c dictionary_owner_hard from a DXF 
  * \c DIMSTYLE symbol table entry.
  *
- * \return a pointer to the \c dictionary_owner_hard.
- *
- * \warning No checks are performed on the returned pointer.
+ * \return the handle of the \c dictionary_owner_hard.
  */
-char *
+uint64_t
 dxf_dimstyle_get_dictionary_owner_hard
 (
         DxfDimStyle *dimstyle
@@ -5586,19 +5428,12 @@ dxf_dimstyle_get_dictionary_owner_hard
                 fprintf (stderr,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
-                return (NULL);
-        }
-        if (dimstyle->dictionary_owner_hard ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
+                return (0);
         }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (dimstyle->dictionary_owner_hard));
+        return (dimstyle->dictionary_owner_hard);
 }
 
 
@@ -5614,8 +5449,8 @@ dxf_dimstyle_set_dictionary_owner_hard
 (
         DxfDimStyle *dimstyle,
                 /*!< a pointer to a DXF \c DIMSTYLE symbol table entry. */
-        char *dictionary_owner_hard
-                /*!< a string containing the pointer to the \c
+        uint64_t dictionary_owner_hard
+                /*!< the handle of the \c
                  * dictionary_owner_hard for the entity. */
 )
 {
@@ -5630,14 +5465,7 @@ dxf_dimstyle_set_dictionary_owner_hard
                   __FUNCTION__);
                 return (NULL);
         }
-        if (dictionary_owner_hard == NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was passed.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
-        dimstyle->dictionary_owner_hard = strdup (dictionary_owner_hard);
+        dimstyle->dictionary_owner_hard = dictionary_owner_hard;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -5680,7 +5508,7 @@ dxf_dimstyle_get_dimtxsty
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (dimstyle->dimtxsty));
+        return (dxf_strdup (dimstyle->dimtxsty));
 }
 
 
@@ -5720,7 +5548,7 @@ dxf_dimstyle_set_dimtxsty
                   __FUNCTION__);
                 return (NULL);
         }
-        dimstyle->dimtxsty = strdup (dimtxsty);
+        dimstyle->dimtxsty = dxf_strdup (dimtxsty);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -142,7 +142,7 @@ dxf_dimstyle_struct
         int16_t dimzin;
                 /*!< Zero suppression for "feet & inch" dimensions.\n
                  * Group code = 78. */
-        int id_code;
+        uint64_t id_code;
                 /*!< Identification number for the entity.\n
                  * This is to be an unique (sequential) number in the
                  * DXF file.\n
@@ -315,18 +315,18 @@ dxf_dimstyle_struct
                  * the dimension line location.</li>
                  * </ol>
                  * Group code = 288. */
-        char *dictionary_owner_soft;
+        uint64_t dictionary_owner_soft;
                 /*!< Soft-pointer ID/handle to owner dictionary (optional).\n
                  * Group code = 330.\n
                  * \since Introduced in version R14. */
-        char *object_owner_soft;
+        uint64_t object_owner_soft;
                 /*!< Soft-pointer ID/handle  to owner BLOCK_RECORD object.\n
                  * Group code = 330.\n
                  * \since Introduced in version R2000. */
         char *dimtxsty;
                 /*!< Dimension text style.\n
                  * Group code = 340. */
-        char *dictionary_owner_hard;
+        uint64_t dictionary_owner_hard;
                 /*!< Hard owner ID/handle to owner dictionary (optional).\n
                  * Group code = 360.\n
                  * \since Introduced in version R14. */
@@ -390,8 +390,8 @@ int16_t dxf_dimstyle_get_dimtad (DxfDimStyle *dimstyle);
 DxfDimStyle *dxf_dimstyle_set_dimtad (DxfDimStyle *dimstyle, int16_t dimtad);
 int16_t dxf_dimstyle_get_dimzin (DxfDimStyle *dimstyle);
 DxfDimStyle *dxf_dimstyle_set_dimzin (DxfDimStyle *dimstyle, int16_t dimzin);
-int dxf_dimstyle_get_id_code (DxfDimStyle *dimstyle);
-DxfDimStyle *dxf_dimstyle_set_id_code (DxfDimStyle *dimstyle, int id_code);
+uint64_t dxf_dimstyle_get_id_code (DxfDimStyle *dimstyle);
+DxfDimStyle *dxf_dimstyle_set_id_code (DxfDimStyle *dimstyle, uint64_t id_code);
 double dxf_dimstyle_get_dimtxt (DxfDimStyle *dimstyle);
 DxfDimStyle *dxf_dimstyle_set_dimtxt (DxfDimStyle *dimstyle, double dimtxt);
 double dxf_dimstyle_get_dimcen (DxfDimStyle *dimstyle);
@@ -456,12 +456,12 @@ int16_t dxf_dimstyle_get_dimfit (DxfDimStyle *dimstyle);
 DxfDimStyle *dxf_dimstyle_set_dimfit (DxfDimStyle *dimstyle, int16_t dimfit);
 int16_t dxf_dimstyle_get_dimupt (DxfDimStyle *dimstyle);
 DxfDimStyle *dxf_dimstyle_set_dimupt (DxfDimStyle *dimstyle, int16_t dimupt);
-char *dxf_dimstyle_get_dictionary_owner_soft (DxfDimStyle *dimstyle);
-DxfDimStyle *dxf_dimstyle_set_dictionary_owner_soft (DxfDimStyle *dimstyle, char *dictionary_owner_soft);
-char *dxf_dimstyle_get_object_owner_soft (DxfDimStyle *dimstyle);
-DxfDimStyle *dxf_dimstyle_set_object_owner_soft (DxfDimStyle *dimstyle, char *object_owner_soft);
-char *dxf_dimstyle_get_dictionary_owner_hard (DxfDimStyle *dimstyle);
-DxfDimStyle *dxf_dimstyle_set_dictionary_owner_hard (DxfDimStyle *dimstyle, char *dictionary_owner_hard);
+uint64_t dxf_dimstyle_get_dictionary_owner_soft (DxfDimStyle *dimstyle);
+DxfDimStyle *dxf_dimstyle_set_dictionary_owner_soft (DxfDimStyle *dimstyle, uint64_t dictionary_owner_soft);
+uint64_t dxf_dimstyle_get_object_owner_soft (DxfDimStyle *dimstyle);
+DxfDimStyle *dxf_dimstyle_set_object_owner_soft (DxfDimStyle *dimstyle, uint64_t object_owner_soft);
+uint64_t dxf_dimstyle_get_dictionary_owner_hard (DxfDimStyle *dimstyle);
+DxfDimStyle *dxf_dimstyle_set_dictionary_owner_hard (DxfDimStyle *dimstyle, uint64_t dictionary_owner_hard);
 char *dxf_dimstyle_get_dimtxsty (DxfDimStyle *dimstyle);
 DxfDimStyle *dxf_dimstyle_set_dimtxsty (DxfDimStyle *dimstyle, char *dimtxsty);
 DxfDimStyle *dxf_dimstyle_get_next (DxfDimStyle *dimstyle);
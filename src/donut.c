@@ -46,6 +46,7 @@
 
 
 #include "donut.h"
+#include "util.h"
 
 
 /*!
@@ -68,7 +69,7 @@ dxf_donut_new ()
         size = sizeof (DxfDonut);
         /* avoid malloc of 0 bytes */
         if (size == 0) size = 1;
-        if ((donut = malloc (size)) == NULL)
+        if ((donut = dxf_malloc (size)) == NULL)
         {
                 fprintf (stderr,
                   (_("Error in %s () could not allocate memory.\n")),
@@ -120,9 +121,9 @@ dxf_donut_init
         }
         /* Assign initial values to members. */
         /* Members common for all DXF drawable entities. */
-        donut->id_code = 0;
-        donut->linetype = strdup (DXF_DEFAULT_LINETYPE);
-        donut->layer = strdup (DXF_DEFAULT_LAYER);
+        donut->id_code = DXF_HANDLE_NONE;
+        donut->linetype = dxf_strdup (DXF_DEFAULT_LINETYPE);
+        donut->layer = dxf_strdup (DXF_DEFAULT_LAYER);
         donut->elevation = 0.0;
         donut->thickness = 0.0;
         donut->linetype_scale = DXF_DEFAULT_LINETYPE_SCALE;
@@ -131,13 +132,13 @@ dxf_donut_init
         donut->paperspace = DXF_MODELSPACE;
         donut->graphics_data_size = 0;
         donut->shadow_mode = 0;
-        donut->dictionary_owner_soft = strdup ("");
-        donut->material = strdup ("");
-        donut->dictionary_owner_hard = strdup ("");
+        donut->dictionary_owner_soft = 0;
+        donut->material = 0;
+        donut->dictionary_owner_hard = 0;
         donut->lineweight = 0;
-        donut->plot_style_name = strdup ("");
+        donut->plot_style_name = 0;
         donut->color_value = 0;
-        donut->color_name = strdup ("");
+        donut->color_name = dxf_strdup ("");
         donut->transparency = 0;
         /* Specific members for a libDXF donut. */
         donut->p0->x0 = 0.0;
@@ -181,10 +182,10 @@ dxf_donut_write
         DxfVertex *vertex_1 = NULL;
         DxfVertex *vertex_2 = NULL;
         DxfSeqend *seqend = NULL;
-        char *dxf_entity_name = strdup ("POLYLINE");
+        char *dxf_entity_name = dxf_strdup ("POLYLINE");
         double start_width;
         double end_width;
-        int id_code = -1;
+        uint64_t id_code = 0;
 
         /* Do some basic checks. */
         if (fp == NULL)
@@ -193,7 +194,7 @@ dxf_donut_write
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (donut == NULL)
@@ -202,16 +203,16 @@ dxf_donut_write
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (dxf_donut_get_outside_diameter (donut) > dxf_donut_get_inside_diameter (donut))
         {
                 fprintf (stderr,
-                  (_("Error in %s () outside diameter is smaller than the inside diameter for the %s entity with id-code: %x\n")),
+                  (_("Error in %s () outside diameter is smaller than the inside diameter for the %s entity with id-code: %" PRIx64 "\n")),
                   __FUNCTION__, dxf_entity_name, id_code);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         start_width = 0.5 * (dxf_donut_get_outside_diameter (donut) - dxf_donut_get_inside_diameter (donut));
@@ -219,22 +220,22 @@ dxf_donut_write
         if (strcmp (dxf_donut_get_linetype (donut), "") == 0)
         {
                 fprintf (stderr,
-                  (_("Warning in %s () empty linetype string for the %s entity with id-code: %x\n")),
+                  (_("Warning in %s () empty linetype string for the %s entity with id-code: %" PRIx64 "\n")),
                   __FUNCTION__, dxf_entity_name, dxf_donut_get_id_code (donut));
                 fprintf (stderr,
                   (_("\t%s entity is reset to default linetype")),
                   dxf_entity_name);
-                dxf_donut_set_linetype (donut, strdup (DXF_DEFAULT_LINETYPE));
+                dxf_donut_set_linetype (donut, dxf_strdup (DXF_DEFAULT_LINETYPE));
         }
         if (strcmp (dxf_donut_get_layer (donut), "") == 0)
         {
                 fprintf (stderr,
-                  (_("Warning in %s () empty layer string for the %s entity with id-code: %x\n")),
+                  (_("Warning in %s () empty layer string for the %s entity with id-code: %" PRIx64 "\n")),
                   __FUNCTION__, dxf_entity_name, id_code);
                 fprintf (stderr,
                   (_("\t%s entity is relocated to layer 0\n")),
                   dxf_entity_name);
-                dxf_donut_set_layer (donut, strdup (DXF_DEFAULT_LAYER));
+                dxf_donut_set_layer (donut, dxf_strdup (DXF_DEFAULT_LAYER));
         }
         /* Create and write a polyline primitive. */
         dxf_polyline_new (polyline);
@@ -269,9 +270,9 @@ dxf_donut_write
         vertex_1->id_code = id_code;
         vertex_1->layer = dxf_donut_get_layer (donut);
         vertex_1->linetype = dxf_donut_get_linetype (donut);
-        vertex_1->p0->x0 = dxf_donut_get_x0 (donut) - (0.25 * (dxf_donut_get_outside_diameter (donut) + dxf_donut_get_inside_diameter (donut)));
-        vertex_1->p0->y0 = dxf_donut_get_y0 (donut);
-        vertex_1->p0->z0 = dxf_donut_get_z0 (donut);
+        vertex_1->p0.x = dxf_donut_get_x0 (donut) - (0.25 * (dxf_donut_get_outside_diameter (donut) + dxf_donut_get_inside_diameter (donut)));
+        vertex_1->p0.y = dxf_donut_get_y0 (donut);
+        vertex_1->p0.z = dxf_donut_get_z0 (donut);
         vertex_1->thickness = dxf_donut_get_thickness (donut);
         vertex_1->start_width = 0.5 * start_width;
         vertex_1->end_width = 0.5 * end_width;
@@ -290,9 +291,9 @@ dxf_donut_write
         vertex_2->id_code = id_code;
         vertex_2->layer = dxf_donut_get_layer (donut);
         vertex_2->linetype = dxf_donut_get_linetype (donut);
-        vertex_2->p0->x0 = dxf_donut_get_x0 (donut) + (0.25 * (dxf_donut_get_outside_diameter (donut) + dxf_donut_get_inside_diameter (donut)));
-        vertex_2->p0->y0 = dxf_donut_get_y0 (donut);
-        vertex_2->p0->z0 = dxf_donut_get_z0 (donut);
+        vertex_2->p0.x = dxf_donut_get_x0 (donut) + (0.25 * (dxf_donut_get_outside_diameter (donut) + dxf_donut_get_inside_diameter (donut)));
+        vertex_2->p0.y = dxf_donut_get_y0 (donut);
+        vertex_2->p0.z = dxf_donut_get_z0 (donut);
         vertex_2->thickness = dxf_donut_get_thickness (donut);
         vertex_2->start_width = 0.5 * start_width;
         vertex_2->end_width = 0.5 * end_width;
@@ -314,7 +315,7 @@ dxf_donut_write
         dxf_seqend_write (fp, seqend);
         /*! \todo Hook up this seqend to the list of seqends. */
         /* Clean up. */
-        free (dxf_entity_name);
+        dxf_free (dxf_entity_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -355,11 +356,9 @@ dxf_donut_free
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        free (donut->linetype);
-        free (donut->layer);
-        free (donut->dictionary_owner_soft);
-        free (donut->dictionary_owner_hard);
-        free (donut);
+        dxf_string_free (donut->linetype);
+        dxf_string_free (donut->layer);
+        dxf_free (donut);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -405,7 +404,7 @@ dxf_donut_free_list
  *
  * \return \c id_code.
  */
-int
+uint64_t
 dxf_donut_get_id_code
 (
         DxfDonut *donut
@@ -423,12 +422,6 @@ dxf_donut_get_id_code
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (donut->id_code < 0)
-        {
-                fprintf (stderr,
-                  (_("Warning in %s () a negative value was found.\n")),
-                  __FUNCTION__);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -447,7 +440,7 @@ dxf_donut_set_id_code
 (
         DxfDonut *donut,
                 /*!< a pointer to a libDXF \c donut entity. */
-        int id_code
+        uint64_t id_code
                 /*!< Identification number for the entity.\n
                  * This is to be an unique (sequential) number in the DXF
                  * file. */
@@ -464,12 +457,6 @@ dxf_donut_set_id_code
                   __FUNCTION__);
                 return (NULL);
         }
-        if (id_code < 0)
-        {
-                fprintf (stderr,
-                  (_("Warning in %s () a negative value was passed.\n")),
-                  __FUNCTION__);
-        }
         donut->id_code = id_code;
 #if DEBUG
         DXF_DEBUG_END
@@ -512,7 +499,7 @@ dxf_donut_get_linetype
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (donut->linetype));
+        return (dxf_strdup (donut->linetype));
 }
 
 
@@ -552,7 +539,7 @@ dxf_donut_set_linetype
                   __FUNCTION__);
                 return (NULL);
         }
-        donut->linetype = strdup (linetype);
+        donut->linetype = dxf_strdup (linetype);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -594,7 +581,7 @@ dxf_donut_get_layer
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (donut->layer));
+        return (dxf_strdup (donut->layer));
 }
 
 
@@ -633,7 +620,7 @@ dxf_donut_set_layer
                   __FUNCTION__);
                 return (NULL);
         }
-        donut->layer = strdup (layer);
+        donut->layer = dxf_strdup (layer);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1376,11 +1363,9 @@ dxf_donut_set_binary_graphics_data
  * \brief Get the soft pointer to the \c dictionary_owner_soft from a
  * libDXF \c donut entity.
  *
- * \return a pointer to the \c dictionary_owner_soft.
- *
- * \warning No checks are performed on the returned pointer.
+ * \return the handle of the \c dictionary_owner_soft.
  */
-char *
+uint64_t
 dxf_donut_get_dictionary_owner_soft
 (
         DxfDonut *donut
@@ -1396,19 +1381,12 @@ dxf_donut_get_dictionary_owner_soft
                 fprintf (stderr,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
-                return (NULL);
-        }
-        if (donut->dictionary_owner_soft ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
+                return (0);
         }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (donut->dictionary_owner_soft));
+        return (donut->dictionary_owner_soft);
 }
 
 
@@ -1421,8 +1399,8 @@ dxf_donut_set_dictionary_owner_soft
 (
         DxfDonut *donut,
                 /*!< a pointer to a libDXF \c donut entity. */
-        char *dictionary_owner_soft
-                /*!< a string containing the pointer to the
+        uint64_t dictionary_owner_soft
+                /*!< the handle of the
                  * \c dictionary_owner_soft for the entity. */
 )
 {
@@ -1437,14 +1415,7 @@ dxf_donut_set_dictionary_owner_soft
                   __FUNCTION__);
                 return (NULL);
         }
-        if (dictionary_owner_soft == NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was passed.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
-        donut->dictionary_owner_soft = strdup (dictionary_owner_soft);
+        donut->dictionary_owner_soft = dictionary_owner_soft;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1456,12 +1427,10 @@ dxf_donut_set_dictionary_owner_soft
  * \brief Get the pointer to the \c material from a libDXF \c donut
  * entity.
  *
- * \return a pointer to \c material when successful, or \c NULL when an
+ * \return the handle \c material when successful, or 0 when an
  * error occurred.
- *
- * \warning No checks are performed on the returned pointer.
  */
-char *
+uint64_t
 dxf_donut_get_material
 (
         DxfDonut *donut
@@ -1477,19 +1446,12 @@ dxf_donut_get_material
                 fprintf (stderr,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
-                return (NULL);
-        }
-        if (donut->material ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
+                return (0);
         }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (donut->material));
+        return (donut->material);
 }
 
 
@@ -1505,8 +1467,8 @@ dxf_donut_set_material
 (
         DxfDonut *donut,
                 /*!< a pointer to a libDXF \c donut entity. */
-        char *material
-                /*!< a string containing the pointer to the \c
+        uint64_t material
+                /*!< the handle of the \c
                  * material for the entity. */
 )
 {
@@ -1521,14 +1483,7 @@ dxf_donut_set_material
                   __FUNCTION__);
                 return (NULL);
         }
-        if (material == NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was passed.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
-        donut->material = strdup (material);
+        donut->material = material;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1540,11 +1495,9 @@ dxf_donut_set_material
  * \brief Get the pointer to the \c dictionary_owner_hard from a libDXF 
  * \c donut entity.
  *
- * \return a pointer to the \c dictionary_owner_hard.
- *
- * \warning No checks are performed on the returned pointer.
+ * \return the handle of the \c dictionary_owner_hard.
  */
-char *
+uint64_t
 dxf_donut_get_dictionary_owner_hard
 (
         DxfDonut *donut
@@ -1560,19 +1513,12 @@ dxf_donut_get_dictionary_owner_hard
                 fprintf (stderr,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
-                return (NULL);
-        }
-        if (donut->dictionary_owner_hard ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
+                return (0);
         }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (donut->dictionary_owner_hard));
+        return (donut->dictionary_owner_hard);
 }
 
 
@@ -1588,8 +1534,8 @@ dxf_donut_set_dictionary_owner_hard
 (
         DxfDonut *donut,
                 /*!< a pointer to a libDXF \c donut entity. */
-        char *dictionary_owner_hard
-                /*!< a string containing the pointer to the \c
+        uint64_t dictionary_owner_hard
+                /*!< the handle of the \c
                  * dictionary_owner_hard for the entity. */
 )
 {
@@ -1604,14 +1550,7 @@ dxf_donut_set_dictionary_owner_hard
                   __FUNCTION__);
                 return (NULL);
         }
-        if (dictionary_owner_hard == NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was passed.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
-        donut->dictionary_owner_hard = strdup (dictionary_owner_hard);
+        donut->dictionary_owner_hard = dictionary_owner_hard;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1687,10 +1626,10 @@ dxf_donut_set_lineweight
 /*!
  * \brief Get the \c plot_style_name from a libDXF \c donut entity.
  *
- * \return a pointer to \c plot_style_name when sucessful, or \c NULL
+ * \return the handle \c plot_style_name when sucessful, or 0
  * when an error occurred.
  */
-char *
+uint64_t
 dxf_donut_get_plot_style_name
 (
         DxfDonut *donut
@@ -1706,19 +1645,12 @@ dxf_donut_get_plot_style_name
                 fprintf (stderr,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
-                return (NULL);
-        }
-        if (donut->plot_style_name ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
+                return (0);
         }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (donut->plot_style_name));
+        return (donut->plot_style_name);
 }
 
 
@@ -1733,7 +1665,7 @@ dxf_donut_set_plot_style_name
 (
         DxfDonut *donut,
                 /*!< a pointer to a libDXF \c donut entity. */
-        char *plot_style_name
+        uint64_t plot_style_name
                 /*!< a string containing the \c plot_style_name for the
                  * entity. */
 )
@@ -1749,14 +1681,7 @@ dxf_donut_set_plot_style_name
                   __FUNCTION__);
                 return (NULL);
         }
-        if (plot_style_name == NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was passed.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
-        donut->plot_style_name = strdup (plot_style_name);
+        donut->plot_style_name = plot_style_name;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1863,7 +1788,7 @@ dxf_donut_get_color_name
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (donut->color_name));
+        return (dxf_strdup (donut->color_name));
 }
 
 
@@ -1901,7 +1826,7 @@ dxf_donut_set_color_name
                   __FUNCTION__);
                 return (NULL);
         }
-        donut->color_name = strdup (color_name);
+        donut->color_name = dxf_strdup (color_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
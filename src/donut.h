@@ -69,7 +69,7 @@ typedef struct
 dxf_donut_struct
 {
         /* Members common for all DXF drawable entities. */
-        int id_code;
+        uint64_t id_code;
                 /*!< Identification number for the entity.\n
                  * This is to be an unique (sequential) number in the DXF
                  * file.\n
@@ -142,16 +142,16 @@ dxf_donut_struct
                  * (optional).\n
                  * Group code = 310.\n
                  * \since Introduced in version R2000. */
-        char *dictionary_owner_soft;
+        uint64_t dictionary_owner_soft;
                 /*!< Soft-pointer ID/handle to owner dictionary (optional).\n
                  * Group code = 330.\n
                  * \since Introduced in version R14. */
-        char *material;
+        uint64_t material;
                 /*!< Hard-pointer ID/handle to material object (present if
                  * not BYLAYER).\n
                  * Group code = 347.\n
                  * \since Introduced in version R2008. */
-        char *dictionary_owner_hard;
+        uint64_t dictionary_owner_hard;
                 /*!< Hard owner ID/handle to owner dictionary (optional).\n
                  * Group code = 360.\n
                  * \since Introduced in version R14. */
@@ -160,7 +160,7 @@ dxf_donut_struct
                  * Stored and moved around as a 16-bit integer.\n
                  * Group code = 370.\n
                  * \since Introduced in version R2002. */
-        char *plot_style_name;
+        uint64_t plot_style_name;
                 /*!< Hard pointer ID / handle of PlotStyleName object.\n
                  * Group code = 390.\n
                  * \since Introduced in version R2009. */
@@ -211,8 +211,8 @@ DxfDonut *dxf_donut_init (DxfDonut *donut);
 int dxf_donut_write (DxfFile *fp, DxfDonut *donut);
 int dxf_donut_free (DxfDonut *donut);
 void dxf_donut_free_list (DxfDonut *donuts);
-int dxf_donut_get_id_code (DxfDonut *donut);
-DxfDonut *dxf_donut_set_id_code (DxfDonut *donut, int id_code);
+uint64_t dxf_donut_get_id_code (DxfDonut *donut);
+DxfDonut *dxf_donut_set_id_code (DxfDonut *donut, uint64_t id_code);
 char *dxf_donut_get_linetype (DxfDonut *donut);
 DxfDonut *dxf_donut_set_linetype (DxfDonut *donut, char *linetype);
 char *dxf_donut_get_layer (DxfDonut *donut);
@@ -235,16 +235,16 @@ int16_t dxf_donut_get_shadow_mode (DxfDonut *donut);
 DxfDonut *dxf_donut_set_shadow_mode (DxfDonut *donut, int16_t shadow_mode);
 DxfBinaryData *dxf_donut_get_binary_graphics_data (DxfDonut *donut);
 DxfDonut *dxf_donut_set_binary_graphics_data (DxfDonut *donut, DxfBinaryData *data);
-char *dxf_donut_get_dictionary_owner_soft (DxfDonut *donut);
-DxfDonut *dxf_donut_set_dictionary_owner_soft (DxfDonut *donut, char *dictionary_owner_soft);
-char *dxf_donut_get_material (DxfDonut *donut);
-DxfDonut *dxf_donut_set_material (DxfDonut *donut, char *material);
-char *dxf_donut_get_dictionary_owner_hard (DxfDonut *donut);
-DxfDonut *dxf_donut_set_dictionary_owner_hard (DxfDonut *donut, char *dictionary_owner_hard);
+uint64_t dxf_donut_get_dictionary_owner_soft (DxfDonut *donut);
+DxfDonut *dxf_donut_set_dictionary_owner_soft (DxfDonut *donut, uint64_t dictionary_owner_soft);
+uint64_t dxf_donut_get_material (DxfDonut *donut);
+DxfDonut *dxf_donut_set_material (DxfDonut *donut, uint64_t material);
+uint64_t dxf_donut_get_dictionary_owner_hard (DxfDonut *donut);
+DxfDonut *dxf_donut_set_dictionary_owner_hard (DxfDonut *donut, uint64_t dictionary_owner_hard);
 int16_t dxf_donut_get_lineweight (DxfDonut *donut);
 DxfDonut *dxf_donut_set_lineweight (DxfDonut *donut, int16_t lineweight);
-char *dxf_donut_get_plot_style_name (DxfDonut *donut);
-DxfDonut *dxf_donut_set_plot_style_name (DxfDonut *donut, char *plot_style_name);
+uint64_t dxf_donut_get_plot_style_name (DxfDonut *donut);
+DxfDonut *dxf_donut_set_plot_style_name (DxfDonut *donut, uint64_t plot_style_name);
 int32_t dxf_donut_get_color_value (DxfDonut *donut);
 DxfDonut *dxf_donut_set_color_value (DxfDonut *donut, int32_t color_value);
 char *dxf_donut_get_color_name (DxfDonut *donut);
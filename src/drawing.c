@@ -34,6 +34,261 @@
 
 
 #include "drawing.h"
+#include "util.h"
+#include "bbox.h"
+#include "parallel.h"
+
+
+/*!
+ * \brief Resolve the \c INSERT entities of a libDXF drawing, in the
+ * \c ENTITIES section and in the block definitions, and compute the
+ * entity lists and extents of all block definitions.
+ *
+ * The entity lists and extents of the block definitions are cached in
+ * the blocks, so the \c INSERT entities can be measured and exploded
+ * from worker threads afterwards.
+ */
+static int
+dxf_drawing_prepare_blocks
+(
+        DxfDrawing *drawing
+                /*!< a pointer to a libDXF drawing. */
+)
+{
+        DxfBlockMap *map;
+
+        if (drawing->block_list == NULL)
+        {
+                return (EXIT_SUCCESS);
+        }
+        map = dxf_drawing_get_block_map (drawing);
+        if (map == NULL)
+        {
+                return (EXIT_FAILURE);
+        }
+        if (drawing->entities_list != NULL)
+        {
+                dxf_block_map_resolve_inserts (map,
+                  (DxfInsert *) ((DxfEntities *) drawing->entities_list)->insert_list);
+        }
+        return (dxf_block_map_resolve (map));
+}
+
+
+/*!
+ * \brief Add the entities, block definitions and table entries of a
+ * libDXF drawing to it's handle index.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+static int
+dxf_drawing_index_handles
+(
+        DxfDrawing *drawing
+                /*!< a pointer to a libDXF drawing with a handle
+                 * index. */
+)
+{
+        if ((drawing->tables_list != NULL)
+          && (dxf_handle_index_add_tables (drawing->handle_index,
+          (DxfTables *) drawing->tables_list) == EXIT_FAILURE))
+        {
+                return (EXIT_FAILURE);
+        }
+        if ((drawing->block_list != NULL)
+          && (dxf_handle_index_add_blocks (drawing->handle_index,
+          (DxfBlock *) drawing->block_list) == EXIT_FAILURE))
+        {
+                return (EXIT_FAILURE);
+        }
+        if ((drawing->entities_list != NULL)
+          && (dxf_handle_index_add_entities (drawing->handle_index,
+          (DxfEntities *) drawing->entities_list) == EXIT_FAILURE))
+        {
+                return (EXIT_FAILURE);
+        }
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Build the layer index of a libDXF drawing from it's entities,
+ * replacing the layer index it had.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+static int
+dxf_drawing_index_layers
+(
+        DxfDrawing *drawing
+                /*!< a pointer to a libDXF drawing. */
+)
+{
+        if (drawing->layer_index != NULL)
+        {
+                dxf_layer_index_map_free (drawing->layer_index);
+        }
+        drawing->layer_index = dxf_layer_index_map_new ();
+        if (drawing->layer_index == NULL)
+        {
+                return (EXIT_FAILURE);
+        }
+        if ((drawing->entities_list != NULL)
+          && (dxf_layer_index_map_add_entities (drawing->layer_index,
+          (DxfEntities *) drawing->entities_list) == EXIT_FAILURE))
+        {
+                dxf_layer_index_map_free (drawing->layer_index);
+                drawing->layer_index = NULL;
+                return (EXIT_FAILURE);
+        }
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Build the spatial index of a libDXF drawing from it's
+ * entities, replacing the spatial index it had.
+ *
+ * The \c INSERT entities are resolved first, so they are indexed by
+ * the extents of their block definitions, and the spatial index of
+ * every block definition is built (see dxf_block_get_spatial_index ()).
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+static int
+dxf_drawing_index_extents
+(
+        DxfDrawing *drawing
+                /*!< a pointer to a libDXF drawing. */
+)
+{
+        DxfBlock *block;
+
+        if (dxf_drawing_prepare_blocks (drawing) == EXIT_FAILURE)
+        {
+                return (EXIT_FAILURE);
+        }
+        for (block = (DxfBlock *) drawing->block_list;
+          block != NULL;
+          block = (DxfBlock *) block->next)
+        {
+                if (dxf_block_get_spatial_index (block) == NULL)
+                {
+                        return (EXIT_FAILURE);
+                }
+        }
+        if (drawing->spatial_index != NULL)
+        {
+                dxf_spatial_index_tree_free (drawing->spatial_index);
+        }
+        drawing->spatial_index = dxf_spatial_index_tree_new ();
+        if (drawing->spatial_index == NULL)
+        {
+                return (EXIT_FAILURE);
+        }
+        if ((drawing->entities_list != NULL)
+          && (dxf_spatial_index_tree_add_entities (drawing->spatial_index,
+          (DxfEntities *) drawing->entities_list) == EXIT_FAILURE))
+        {
+                dxf_spatial_index_tree_free (drawing->spatial_index);
+                drawing->spatial_index = NULL;
+                return (EXIT_FAILURE);
+        }
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Definition of a range of entities of a libDXF drawing, of
+ * which dxf_drawing_get_extents () computes the extents on a worker
+ * thread.
+ */
+typedef struct
+dxf_drawing_extents_item_struct
+{
+    DxfEntitiesCursor cursor;
+        /*!< First entity of the range. */
+    size_t number_entities;
+        /*!< Number of entities in the range. */
+    DxfBbox extents;
+        /*!< Extents of the model space entities in the range. */
+    DxfBbox paper_extents;
+        /*!< Extents of the paper space entities in the range. */
+    size_t number_skipped;
+        /*!< Number of entities in the range without a bounding box. */
+} DxfDrawingExtentsItem;
+
+
+/*!
+ * \brief Compute the extents of a range of entities, task of
+ * dxf_parallel_map ().
+ *
+ * \return \c EXIT_SUCCESS.
+ */
+static int
+dxf_drawing_extents_item
+(
+        void *data
+                /*!< a pointer to a DxfDrawingExtentsItem. */
+)
+{
+        DxfDrawingExtentsItem *item = (DxfDrawingExtentsItem *) data;
+        DxfEntitiesCursor cursor = item->cursor;
+        DxfBbox bbox;
+        const char *type;
+        size_t i;
+
+        dxf_bbox_init (&item->extents);
+        dxf_bbox_init (&item->paper_extents);
+        item->number_skipped = 0;
+        for (i = 0; (i < item->number_entities) && (cursor.entity != NULL); i++)
+        {
+                type = dxf_entities_cursor_get_type (&cursor);
+                if (dxf_entity_get_bbox (type, cursor.entity, &bbox) == EXIT_FAILURE)
+                {
+                        item->number_skipped++;
+                }
+                else if (dxf_entity_is_paperspace (type, cursor.entity))
+                {
+                        dxf_bbox_add_bbox (&item->paper_extents, &bbox);
+                }
+                else
+                {
+                        dxf_bbox_add_bbox (&item->extents, &bbox);
+                }
+                dxf_entities_cursor_skip (&cursor, 1);
+        }
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Merge the extents of a range of entities into the extents of
+ * the drawing, done callback of dxf_parallel_map ().
+ *
+ * \return \c EXIT_SUCCESS.
+ */
+static int
+dxf_drawing_extents_item_done
+(
+        void *data,
+                /*!< a pointer to a DxfDrawingExtentsItem. */
+        void *user_data
+                /*!< a pointer to the DxfDrawingExtentsItem holding the
+                 * total. */
+)
+{
+        DxfDrawingExtentsItem *item = (DxfDrawingExtentsItem *) data;
+        DxfDrawingExtentsItem *total = (DxfDrawingExtentsItem *) user_data;
+
+        dxf_bbox_add_bbox (&total->extents, &item->extents);
+        dxf_bbox_add_bbox (&total->paper_extents, &item->paper_extents);
+        total->number_skipped += item->number_skipped;
+        return (EXIT_SUCCESS);
+}
 
 
 /*!
@@ -115,6 +370,12 @@ dxf_drawing_init
         drawing->entities_list = NULL;
         drawing->object_list = NULL;
         drawing->thumbnail = NULL;
+        drawing->string_pool = NULL;
+        drawing->handle_index = NULL;
+        drawing->layer_index = NULL;
+        drawing->spatial_index = NULL;
+        drawing->arena = NULL;
+        drawing->block_map = NULL;
         drawing->next = NULL;
 #if DEBUG
         DXF_DEBUG_END
@@ -127,6 +388,11 @@ dxf_drawing_init
  * \brief Free the allocated memory for a libDXF drawing and all it's
  * data fields.
  *
+ * When the drawing has an arena (see dxf_drawing_get_arena ()) the
+ * arena is freed as a whole, in O(chunks), instead of freeing every
+ * member one by one, the caches of the blocks which live in the heap
+ * are freed first (see dxf_block_free_caches ()).
+ *
  * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
  * occurred.
  */
@@ -141,6 +407,8 @@ dxf_drawing_free
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
+        DxfBlock *block;
+
         /* Do some basic checks. */
         if (drawing == NULL)
         {
@@ -156,12 +424,50 @@ dxf_drawing_free
                 __FUNCTION__);
               return (EXIT_FAILURE);
         }
-        dxf_header_free ((DxfHeader *) drawing->header);
-        dxf_class_free_list ((DxfClass *) drawing->class_list);
-        dxf_block_free_list ((DxfBlock *) drawing->block_list);
-        //dxf_entities_free_list ((DxfEntities *) drawing->entities_list);
-        dxf_object_free_list ((DxfObject *) drawing->object_list);
-        dxf_thumbnail_free ((DxfThumbnail *) drawing->thumbnail);
+        if (drawing->handle_index != NULL)
+        {
+                dxf_handle_index_free (drawing->handle_index);
+        }
+        if (drawing->layer_index != NULL)
+        {
+                dxf_layer_index_map_free (drawing->layer_index);
+        }
+        if (drawing->spatial_index != NULL)
+        {
+                dxf_spatial_index_tree_free (drawing->spatial_index);
+        }
+        if (drawing->block_map != NULL)
+        {
+                dxf_block_map_free (drawing->block_map);
+        }
+        if (drawing->arena != NULL)
+        {
+                /* The caches of the blocks live in the heap. */
+                for (block = (DxfBlock *) drawing->block_list;
+                  block != NULL;
+                  block = (DxfBlock *) block->next)
+                {
+                        dxf_block_free_caches (block);
+                }
+                /* All members live in the arena, release them at once
+                 * instead of walking the lists. */
+                dxf_arena_free (drawing->arena);
+        }
+        else
+        {
+                dxf_header_free ((DxfHeader *) drawing->header);
+                dxf_class_free_list ((DxfClass *) drawing->class_list);
+                dxf_block_free_list ((DxfBlock *) drawing->block_list);
+                //dxf_entities_free_list ((DxfEntities *) drawing->entities_list);
+                dxf_object_free_list ((DxfObject *) drawing->object_list);
+                dxf_thumbnail_free ((DxfThumbnail *) drawing->thumbnail);
+        }
+        /* Free the string pool last, the members freed above may hold
+         * interned strings. */
+        if (drawing->string_pool != NULL)
+        {
+                dxf_string_pool_free (drawing->string_pool);
+        }
         free (drawing);
 #if DEBUG
         DXF_DEBUG_END
@@ -491,6 +797,12 @@ dxf_drawing_set_block_list
                 return (NULL);
         }
         drawing->block_list = (struct DxfBlock *) block_list;
+        /* The block map refers to the old block list. */
+        if (drawing->block_map != NULL)
+        {
+                dxf_block_map_free (drawing->block_map);
+                drawing->block_map = NULL;
+        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -746,6 +1058,693 @@ dxf_drawing_set_thumbnail
 }
 
 
+/*!
+ * \brief Get the string pool from a libDXF drawing.
+ *
+ * The pool is created on first use and freed by dxf_drawing_free ().\n
+ * Pass it to dxf_read_set_string_pool () to have the layer, linetype
+ * and style names read for this drawing interned, so equal names share
+ * one copy and can be compared with \c ==.
+ *
+ * \return \c string_pool when successful, \c NULL when an error
+ * occurred.
+ */
+DxfStringPool *
+dxf_drawing_get_string_pool
+(
+        DxfDrawing *drawing
+                /*!< a pointer to a libDXF drawing. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        /* Do some basic checks. */
+        if (drawing == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        if (drawing->string_pool == NULL)
+        {
+                drawing->string_pool = dxf_string_pool_new ();
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return ((DxfStringPool *) drawing->string_pool);
+}
+
+
+/*!
+ * \brief Get the handle index from a libDXF drawing.
+ *
+ * The index is built from the entities, block definitions and table
+ * entries of the drawing on first use, kept up to date by
+ * dxf_drawing_read_sections (), and freed by dxf_drawing_free ().\n
+ * Use it to resolve the soft and hard pointers of the members of the
+ * drawing with dxf_handle_index_lookup ().
+ *
+ * \warning Entities or table entries added to or freed from the
+ * drawing otherwise are not seen by the index, add them with
+ * dxf_handle_index_insert () or free the index and set
+ * \c handle_index to \c NULL to have it rebuilt.
+ *
+ * \return \c handle_index when successful, \c NULL when an error
+ * occurred.
+ */
+DxfHandleIndex *
+dxf_drawing_get_handle_index
+(
+        DxfDrawing *drawing
+                /*!< a pointer to a libDXF drawing. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        /* Do some basic checks. */
+        if (drawing == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        if (drawing->handle_index == NULL)
+        {
+                drawing->handle_index = dxf_handle_index_new ();
+                if ((drawing->handle_index != NULL)
+                  && (dxf_drawing_index_handles (drawing) == EXIT_FAILURE))
+                {
+                        dxf_handle_index_free (drawing->handle_index);
+                        drawing->handle_index = NULL;
+                }
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return ((DxfHandleIndex *) drawing->handle_index);
+}
+
+
+/*!
+ * \brief Get the layer index from a libDXF drawing.
+ *
+ * The index is built when dxf_drawing_read_sections () reads the
+ * \c ENTITIES section, or from the entities of the drawing on first
+ * use, and freed by dxf_drawing_free ().\n
+ * Use it to find the entities on a layer with
+ * dxf_layer_index_map_get_entities ().\n
+ * dxf_file_write () writes it to the \c OBJECTS section.
+ *
+ * \warning Entities added to or freed from the drawing otherwise have
+ * to be added to or removed from the index with
+ * dxf_layer_index_map_add () and dxf_layer_index_map_remove ().
+ *
+ * \return \c layer_index when successful, \c NULL when an error
+ * occurred.
+ */
+DxfLayerIndexMap *
+dxf_drawing_get_layer_index
+(
+        DxfDrawing *drawing
+                /*!< a pointer to a libDXF drawing. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        /* Do some basic checks. */
+        if (drawing == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        if (drawing->layer_index == NULL)
+        {
+                dxf_drawing_index_layers (drawing);
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return ((DxfLayerIndexMap *) drawing->layer_index);
+}
+
+
+/*!
+ * \brief Get the spatial index from a libDXF drawing.
+ *
+ * The index is bulk loaded from the bounding boxes of the entities of
+ * the drawing on first use, rebuilt by dxf_drawing_read_sections ()
+ * when it reads the \c BLOCKS or \c ENTITIES section, and freed by
+ * dxf_drawing_free ().\n
+ * The entities of the block definitions are indexed per block, in
+ * block coordinates, see dxf_block_get_spatial_index ().\n
+ * Use it for viewport culling with
+ * dxf_spatial_index_tree_search_window () and to find the entities
+ * under the cursor with dxf_spatial_index_tree_search_point () or
+ * dxf_spatial_index_tree_nearest ().
+ *
+ * \warning Entities added to, edited in or freed from the drawing
+ * otherwise have to be inserted into or removed from the index with
+ * dxf_spatial_index_tree_insert () and
+ * dxf_spatial_index_tree_remove ().
+ *
+ * \return \c spatial_index when successful, \c NULL when an error
+ * occurred.
+ */
+DxfSpatialIndexTree *
+dxf_drawing_get_spatial_index
+(
+        DxfDrawing *drawing
+                /*!< a pointer to a libDXF drawing. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        /* Do some basic checks. */
+        if (drawing == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        if (drawing->spatial_index == NULL)
+        {
+                dxf_drawing_index_extents (drawing);
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return ((DxfSpatialIndexTree *) drawing->spatial_index);
+}
+
+
+/*!
+ * \brief Get the arena from a libDXF drawing.
+ *
+ * The arena is created on first use and freed by dxf_drawing_free ().\n
+ * Make it the current arena with dxf_arena_set_current () before
+ * creating or reading the members of the drawing, so they are
+ * allocated from the arena, and restore the previous arena when done.
+ *
+ * \warning Once a drawing has an arena, dxf_drawing_free () does not
+ * free the members of the drawing one by one, all of them have to be
+ * allocated from the arena.
+ *
+ * \return \c arena when successful, \c NULL when an error occurred.
+ */
+DxfArena *
+dxf_drawing_get_arena
+(
+        DxfDrawing *drawing
+                /*!< a pointer to a libDXF drawing. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        /* Do some basic checks. */
+        if (drawing == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        if (drawing->arena == NULL)
+        {
+                drawing->arena = dxf_arena_new (0);
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return ((DxfArena *) drawing->arena);
+}
+
+
+/*!
+ * \brief Get the block map from a libDXF drawing.
+ *
+ * The map is built from the block definitions of the drawing on first
+ * use, with the block names interned in the string pool of the drawing
+ * (see dxf_drawing_get_string_pool ()), rebuilt by
+ * dxf_drawing_read_sections () when it reads the \c BLOCKS section,
+ * and freed by dxf_drawing_free ().\n
+ * The \c INSERT entities in the block definitions are resolved and
+ * the entity lists and extents of the block definitions are cached
+ * when the map is built, see dxf_block_map_resolve ().
+ *
+ * \warning Block definitions added to the drawing otherwise have to be
+ * added to the map with dxf_block_map_add ().
+ *
+ * \return \c block_map when successful, \c NULL when an error
+ * occurred.
+ */
+DxfBlockMap *
+dxf_drawing_get_block_map
+(
+        DxfDrawing *drawing
+                /*!< a pointer to a libDXF drawing. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfBlockMap *map;
+
+        /* Do some basic checks. */
+        if (drawing == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        if (drawing->block_map == NULL)
+        {
+                map = dxf_block_map_new (dxf_drawing_get_string_pool (drawing));
+                if (map == NULL)
+                {
+                        return (NULL);
+                }
+                if ((dxf_block_map_add_list (map, (DxfBlock *) drawing->block_list) == EXIT_FAILURE)
+                  || (dxf_block_map_resolve (map) == EXIT_FAILURE))
+                {
+                        dxf_block_map_free (map);
+                        return (NULL);
+                }
+                drawing->block_map = (struct dxf_block_map_struct *) map;
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return ((DxfBlockMap *) drawing->block_map);
+}
+
+
+/*!
+ * \brief Read only the selected sections of a DXF file into a libDXF
+ * drawing.
+ *
+ * The sections are located with a \c DxfSectionIndex, the sections
+ * not selected in \c sections are skipped without being parsed.\n
+ * Selected sections are read in file order, so a \c HEADER section
+ * sets the DXF version used for reading the other sections.\n
+ * When \c index is \c NULL the file is scanned for its sections
+ * first.
+ *
+ * \todo Add reading of the \c CLASSES and \c OBJECTS sections.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_drawing_read_sections
+(
+        DxfDrawing *drawing,
+                /*!< a pointer to a libDXF drawing. */
+        DxfFile *fp,
+                /*!< DXF file pointer to an input file (or device). */
+        DxfSectionIndex *index,
+                /*!< a pointer to the section index of \c fp, or
+                 * \c NULL. */
+        int sections
+                /*!< a bitwise or of \c DXF_SECTION_* flags. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfSectionIndex *scanned_index = NULL;
+        DxfSectionIndexEntry *entry;
+        DxfHeader *header;
+        DxfTables *tables;
+        DxfEntities *entities;
+        DxfThumbnail *thumbnail;
+        int flag;
+        int i;
+        int result = EXIT_SUCCESS;
+
+        /* Do some basic checks. */
+        if (drawing == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        if (fp == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL file pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        if (index == NULL)
+        {
+                scanned_index = dxf_section_index_scan (fp);
+                if (scanned_index == NULL)
+                {
+                        return (EXIT_FAILURE);
+                }
+                index = scanned_index;
+        }
+        for (i = 0; (i < index->number_sections) && (result == EXIT_SUCCESS); i++)
+        {
+                entry = &index->sections[i];
+                if (strcmp (entry->name, "HEADER") == 0)
+                        flag = DXF_SECTION_HEADER;
+                else if (strcmp (entry->name, "CLASSES") == 0)
+                        flag = DXF_SECTION_CLASSES;
+                else if (strcmp (entry->name, "TABLES") == 0)
+                        flag = DXF_SECTION_TABLES;
+                else if (strcmp (entry->name, "BLOCKS") == 0)
+                        flag = DXF_SECTION_BLOCKS;
+                else if (strcmp (entry->name, "ENTITIES") == 0)
+                        flag = DXF_SECTION_ENTITIES;
+                else if (strcmp (entry->name, "OBJECTS") == 0)
+                        flag = DXF_SECTION_OBJECTS;
+                else if (strcmp (entry->name, "THUMBNAILIMAGE") == 0)
+                        flag = DXF_SECTION_THUMBNAIL;
+                else
+                        flag = 0;
+                if ((flag & sections) == 0)
+                {
+                        continue;
+                }
+                if (dxf_read_seek (fp, entry->content, entry->content_line - 1) == EXIT_FAILURE)
+                {
+                        result = EXIT_FAILURE;
+                        break;
+                }
+                switch (flag)
+                {
+                        case DXF_SECTION_HEADER:
+                                header = (DxfHeader *) drawing->header;
+                                if (header == NULL)
+                                {
+                                        /* The version is overwritten by
+                                         * $ACADVER while reading. */
+                                        header = dxf_header_init (dxf_header_new (),
+                                          (fp->acad_version_number != 0) ? fp->acad_version_number : AutoCAD_2000);
+                                }
+                                if ((header == NULL)
+                                  || (dxf_header_read (fp, header) == NULL))
+                                {
+                                        result = EXIT_FAILURE;
+                                        break;
+                                }
+                                drawing->header = (struct DxfHeader *) header;
+                                if (header->_AcadVer != 0)
+                                {
+                                        fp->acad_version_number = header->_AcadVer;
+                                }
+                                break;
+                        case DXF_SECTION_TABLES:
+                                tables = (DxfTables *) drawing->tables_list;
+                                if (tables == NULL)
+                                {
+                                        tables = dxf_tables_new ();
+                                }
+                                if (tables == NULL)
+                                {
+                                        result = EXIT_FAILURE;
+                                        break;
+                                }
+                                drawing->tables_list = (struct DxfTables *) tables;
+                                result = dxf_tables_read (fp, tables);
+                                break;
+                        case DXF_SECTION_BLOCKS:
+                                result = dxf_block_read_table (fp,
+                                  (DxfBlock **) &drawing->block_list);
+                                break;
+                        case DXF_SECTION_ENTITIES:
+                                entities = (DxfEntities *) drawing->entities_list;
+                                if (entities == NULL)
+                                {
+                                        entities = dxf_entities_new ();
+                                }
+                                if (entities == NULL)
+                                {
+                                        result = EXIT_FAILURE;
+                                        break;
+                                }
+                                drawing->entities_list = (struct DxfEntities *) entities;
+                                result = dxf_entities_read_table (fp, entities);
+                                break;
+                        case DXF_SECTION_THUMBNAIL:
+                                thumbnail = (DxfThumbnail *) drawing->thumbnail;
+                                if (thumbnail == NULL)
+                                {
+                                        thumbnail = dxf_thumbnail_init (dxf_thumbnail_new ());
+                                }
+                                if ((thumbnail == NULL)
+                                  || (dxf_thumbnail_read (fp, thumbnail) == NULL))
+                                {
+                                        result = EXIT_FAILURE;
+                                        break;
+                                }
+                                drawing->thumbnail = (struct DxfThumbnail *) thumbnail;
+                                break;
+                        default:
+                                fprintf (stderr,
+                                  (_("Warning in %s () reading the %s section is not supported yet, section skipped.\n")),
+                                  __FUNCTION__, entry->name);
+                                break;
+                }
+        }
+        if ((result == EXIT_SUCCESS)
+          && (drawing->handle_index != NULL)
+          && ((sections & (DXF_SECTION_TABLES | DXF_SECTION_BLOCKS | DXF_SECTION_ENTITIES)) != 0))
+        {
+                /* Index the entities, blocks and table entries just
+                 * read, an entry read again replaces the old one. */
+                result = dxf_drawing_index_handles (drawing);
+        }
+        if ((result == EXIT_SUCCESS)
+          && ((sections & DXF_SECTION_ENTITIES) != 0))
+        {
+                result = dxf_drawing_index_layers (drawing);
+        }
+        if ((result == EXIT_SUCCESS)
+          && (drawing->block_map != NULL)
+          && ((sections & DXF_SECTION_BLOCKS) != 0))
+        {
+                /* Rebuild the block map with the blocks just read. */
+                dxf_block_map_free (drawing->block_map);
+                drawing->block_map = NULL;
+                if (dxf_drawing_get_block_map (drawing) == NULL)
+                {
+                        result = EXIT_FAILURE;
+                }
+        }
+        if ((result == EXIT_SUCCESS)
+          && (drawing->spatial_index != NULL)
+          && ((sections & (DXF_SECTION_BLOCKS | DXF_SECTION_ENTITIES)) != 0))
+        {
+                result = dxf_drawing_index_extents (drawing);
+        }
+        if (scanned_index != NULL)
+        {
+                dxf_section_index_free (scanned_index);
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (result);
+}
+
+
+/*!
+ * \brief Compute the extents of the entities of a libDXF drawing.
+ *
+ * The \c INSERT entities are resolved to the block definitions of
+ * \c drawing by block name first (see dxf_insert_set_block ()), then
+ * the bounding boxes of the entities (see dxf_entity_get_bbox ()) are
+ * computed in ranges of \c DXF_WRITER_CHUNK_ENTITIES entities by
+ * worker threads and merged.\n
+ * Entities without a bounding box, such as entity types not supported
+ * by dxf_entity_get_bbox () or unresolved \c INSERT entities, are
+ * counted in \c number_skipped.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_drawing_get_extents
+(
+        DxfDrawing *drawing,
+                /*!< a pointer to a libDXF drawing. */
+        int number_threads,
+                /*!< Number of worker threads, 0 for one per processor,
+                 * 1 to compute in the calling thread only. */
+        DxfBbox *extents,
+                /*!< the extents of the model space entities, empty when
+                 * there are none, may be \c NULL. */
+        DxfBbox *paper_extents,
+                /*!< the extents of the paper space entities, empty when
+                 * there are none, may be \c NULL. */
+        size_t *number_skipped
+                /*!< the number of entities without a bounding box, may
+                 * be \c NULL. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfDrawingExtentsItem *items = NULL;
+        DxfDrawingExtentsItem *grown;
+        DxfDrawingExtentsItem total;
+        DxfEntitiesCursor cursor;
+        size_t number_items = 0;
+        size_t size = 0;
+        int result = EXIT_SUCCESS;
+
+        /* Do some basic checks. */
+        if (drawing == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        if (dxf_drawing_prepare_blocks (drawing) == EXIT_FAILURE)
+        {
+                return (EXIT_FAILURE);
+        }
+        memset (&total, 0, sizeof (DxfDrawingExtentsItem));
+        dxf_bbox_init (&total.extents);
+        dxf_bbox_init (&total.paper_extents);
+        if (drawing->entities_list != NULL)
+        {
+                /* One item per range of entities. */
+                dxf_entities_cursor_init (&cursor, (DxfEntities *) drawing->entities_list);
+                while (cursor.entity != NULL)
+                {
+                        if (number_items == size)
+                        {
+                                size = 2 * (size + 8);
+                                grown = realloc (items, size * sizeof (DxfDrawingExtentsItem));
+                                if (grown == NULL)
+                                {
+                                        fprintf (stderr,
+                                          (_("Error in %s () could not allocate memory.\n")),
+                                          __FUNCTION__);
+                                        free (items);
+                                        return (EXIT_FAILURE);
+                                }
+                                items = grown;
+                        }
+                        items[number_items].cursor = cursor;
+                        items[number_items].number_entities = dxf_entities_cursor_skip (&cursor, DXF_WRITER_CHUNK_ENTITIES);
+                        number_items++;
+                }
+                result = dxf_parallel_map (items, sizeof (DxfDrawingExtentsItem),
+                  number_items, number_threads, dxf_drawing_extents_item,
+                  dxf_drawing_extents_item_done, &total);
+                free (items);
+        }
+        if (extents != NULL)
+        {
+                *extents = total.extents;
+        }
+        if (paper_extents != NULL)
+        {
+                *paper_extents = total.paper_extents;
+        }
+        if (number_skipped != NULL)
+        {
+                *number_skipped = total.number_skipped;
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (result);
+}
+
+
+/*!
+ * \brief Update the \c $EXTMIN and \c $EXTMAX (and \c $PEXTMIN and
+ * \c $PEXTMAX) header variables of a libDXF drawing to the extents of
+ * it's model space (and paper space) entities.
+ *
+ * The extents are computed with dxf_drawing_get_extents ().\n
+ * The header variables are replaced, not merged with their previous
+ * values, so the extents shrink when entities are removed.\n
+ * Entities without a bounding box (see dxf_entity_get_bbox ()) do not
+ * contribute, their number is returned in \c number_skipped.\n
+ * Header variables of a space without entities are left alone.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_drawing_update_extents
+(
+        DxfDrawing *drawing,
+                /*!< a pointer to a libDXF drawing. */
+        int number_threads,
+                /*!< Number of worker threads, 0 for one per processor,
+                 * 1 to compute in the calling thread only. */
+        size_t *number_skipped
+                /*!< the number of entities without a bounding box, may
+                 * be \c NULL. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfHeader *header;
+        DxfBbox extents;
+        DxfBbox paper_extents;
+
+        /* Do some basic checks. */
+        if ((drawing == NULL) || (drawing->header == NULL))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        if (dxf_drawing_get_extents (drawing, number_threads, &extents,
+          &paper_extents, number_skipped) == EXIT_FAILURE)
+        {
+                return (EXIT_FAILURE);
+        }
+        header = (DxfHeader *) drawing->header;
+        if (!dxf_bbox_is_empty (&extents))
+        {
+                header->ExtMin.x0 = extents.min.x;
+                header->ExtMin.y0 = extents.min.y;
+                header->ExtMin.z0 = extents.min.z;
+                header->ExtMax.x0 = extents.max.x;
+                header->ExtMax.y0 = extents.max.y;
+                header->ExtMax.z0 = extents.max.z;
+        }
+        if (!dxf_bbox_is_empty (&paper_extents))
+        {
+                header->PExtMin.x0 = paper_extents.min.x;
+                header->PExtMin.y0 = paper_extents.min.y;
+                header->PExtMin.z0 = paper_extents.min.z;
+                header->PExtMax.x0 = paper_extents.max.x;
+                header->PExtMax.y0 = paper_extents.max.y;
+                header->PExtMax.z0 = paper_extents.max.z;
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (EXIT_SUCCESS);
+}
+
+
 /*!
  * \brief Get the pointer to the next \c DRAWING from a DXF 
  * \c DRAWING.
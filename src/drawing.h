@@ -46,6 +46,11 @@
 #include "entities.h"
 #include "object.h"
 #include "thumbnail.h"
+#include "string_pool.h"
+#include "handle_index.h"
+#include "layer_index.h"
+#include "spatial_index.h"
+#include "section.h"
 
 
 #ifdef __cplusplus
@@ -73,6 +78,34 @@ dxf_drawing_struct
         /*!< Objects section data (single linked list).*/
     struct DxfThumbnail *thumbnail;
         /*!< Thumbnail data.*/
+    struct dxf_string_pool_struct *string_pool;
+        /*!< Interned layer, linetype and style names shared by the
+         * members of this drawing (owned).\n
+         * \c NULL until the first call to
+         * dxf_drawing_get_string_pool ().*/
+    struct dxf_handle_index_struct *handle_index;
+        /*!< Index of the handles of the entities and table entries
+         * of this drawing (owned).\n
+         * \c NULL until the first call to
+         * dxf_drawing_get_handle_index ().*/
+    struct dxf_layer_index_map_struct *layer_index;
+        /*!< Index of the entities of this drawing by layer
+         * (owned).\n
+         * Built when the \c ENTITIES section is read, or on the
+         * first call to dxf_drawing_get_layer_index ().*/
+    struct dxf_spatial_index_tree_struct *spatial_index;
+        /*!< Spatial index (R-tree) of the entities of this drawing
+         * (owned).\n
+         * \c NULL until the first call to
+         * dxf_drawing_get_spatial_index ().*/
+    struct dxf_arena_struct *arena;
+        /*!< Arena holding all members of this drawing (owned).\n
+         * \c NULL until the first call to dxf_drawing_get_arena (),
+         * in which case the members live on the heap.*/
+    struct dxf_block_map_struct *block_map;
+        /*!< Block definitions of this drawing by name (owned).\n
+         * \c NULL until the first call to
+         * dxf_drawing_get_block_map ().*/
     struct DxfDrawing *next;
                 /*!< Pointer to the next DxfDrawing.\n
                  * \c NULL in the last DxfDrawing. */
@@ -96,6 +129,15 @@ DxfObject *dxf_drawing_get_object_list (DxfDrawing *drawing);
 DxfDrawing *dxf_drawing_set_object_list (DxfDrawing *drawing, DxfObject *object_list);
 DxfThumbnail *dxf_drawing_get_thumbnail (DxfDrawing *drawing);
 DxfDrawing *dxf_drawing_set_thumbnail (DxfDrawing *drawing, DxfThumbnail *thumbnail);
+DxfStringPool *dxf_drawing_get_string_pool (DxfDrawing *drawing);
+DxfHandleIndex *dxf_drawing_get_handle_index (DxfDrawing *drawing);
+DxfLayerIndexMap *dxf_drawing_get_layer_index (DxfDrawing *drawing);
+DxfSpatialIndexTree *dxf_drawing_get_spatial_index (DxfDrawing *drawing);
+DxfArena *dxf_drawing_get_arena (DxfDrawing *drawing);
+DxfBlockMap *dxf_drawing_get_block_map (DxfDrawing *drawing);
+int dxf_drawing_read_sections (DxfDrawing *drawing, DxfFile *fp, DxfSectionIndex *index, int sections);
+int dxf_drawing_get_extents (DxfDrawing *drawing, int number_threads, DxfBbox *extents, DxfBbox *paper_extents, size_t *number_skipped);
+int dxf_drawing_update_extents (DxfDrawing *drawing, int number_threads, size_t *number_skipped);
 DxfDrawing *dxf_drawing_get_next (DxfDrawing *drawing);
 DxfDrawing *dxf_drawing_set_next (DxfDrawing *drawing, DxfDrawing *next);
 DxfDrawing *dxf_drawing_get_last (DxfDrawing *drawing);
@@ -43,8 +43,10 @@
 #include "acad_proxy_entity.h"
 #include "appid.h"
 #include "arc.h"
+#include "arena.h"
 #include "attdef.h"
 #include "attrib.h"
+#include "bbox.h"
 #include "binary_entity_data.h"
 #include "binary_graphics_data.h"
 #include "block.h"
@@ -70,6 +72,7 @@
 #include "file.h"
 #include "global.h"
 #include "group.h"
+#include "handle_index.h"
 #include "hatch.h"
 #include "header.h"
 #include "helix.h"
@@ -97,6 +100,7 @@
 #include "object_ptr.h"
 #include "oleframe.h"
 #include "ole2frame.h"
+#include "parallel.h"
 #include "param.h"
 #include "point.h"
 #include "polyline.h"
@@ -113,6 +117,7 @@
 #include "spatial_filter.h"
 #include "spatial_index.h"
 #include "spline.h"
+#include "string_pool.h"
 #include "style.h"
 #include "sun.h"
 #include "table.h"
@@ -121,6 +126,7 @@
 #include "thumbnail.h"
 #include "tolerance.h"
 #include "trace.h"
+#include "transform.h"
 #include "ucs.h"
 #include "util.h"
 #include "vertex.h"
@@ -42,6 +42,8 @@
 
 
 #include "ellipse.h"
+#include "bbox.h"
+#include "util.h"
 
 
 /*!
@@ -64,7 +66,7 @@ dxf_ellipse_new ()
         size = sizeof (DxfEllipse);
         /* avoid malloc of 0 bytes */
         if (size == 0) size = 1;
-        if ((ellipse = malloc (size)) == NULL)
+        if ((ellipse = dxf_malloc (size)) == NULL)
         {
                 fprintf (stderr,
                   (_("Error in %s () could not allocate memory.\n")),
@@ -115,9 +117,9 @@ dxf_ellipse_init
               return (NULL);
         }
         /* Assign initial values to members. */
-        ellipse->id_code = 0;
-        ellipse->linetype = strdup (DXF_DEFAULT_LINETYPE);
-        ellipse->layer = strdup (DXF_DEFAULT_LAYER);
+        ellipse->id_code = DXF_HANDLE_NONE;
+        ellipse->linetype = dxf_strdup (DXF_DEFAULT_LINETYPE);
+        ellipse->layer = dxf_strdup (DXF_DEFAULT_LAYER);
         ellipse->elevation = 0.0;
         ellipse->thickness = 0.0;
         ellipse->linetype_scale = DXF_DEFAULT_LINETYPE_SCALE;
@@ -126,14 +128,14 @@ dxf_ellipse_init
         ellipse->paperspace = DXF_MODELSPACE;
         ellipse->graphics_data_size = 0;
         ellipse->shadow_mode = 0;
-        ellipse->dictionary_owner_soft = strdup ("");
-        ellipse->object_owner_soft = strdup ("");
-        ellipse->material = strdup ("");
-        ellipse->dictionary_owner_hard = strdup ("");
+        ellipse->dictionary_owner_soft = 0;
+        ellipse->object_owner_soft = 0;
+        ellipse->material = 0;
+        ellipse->dictionary_owner_hard = 0;
         ellipse->lineweight = 0;
-        ellipse->plot_style_name = strdup ("");
+        ellipse->plot_style_name = 0;
         ellipse->color_value = 0;
-        ellipse->color_name = strdup ("");
+        ellipse->color_name = dxf_strdup ("");
         ellipse->transparency = 0;
         ellipse->extr_x0 = 0.0;
         ellipse->extr_y0 = 0.0;
@@ -177,7 +179,8 @@ dxf_ellipse_read
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        char *temp_string = NULL;
+        char temp_string[DXF_MAX_STRING_LENGTH];
+        int group_code;
         DxfBinaryData *iter310 = NULL;
         int iter330;
 
@@ -187,8 +190,6 @@ dxf_ellipse_read
                 fprintf (stderr,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
-                /* Clean up. */
-                free (temp_string);
                 return (NULL);
         }
         if (ellipse == NULL)
@@ -248,310 +249,254 @@ dxf_ellipse_read
         }
         iter310 = (DxfBinaryData *) ellipse->binary_graphics_data;
         iter330 = 0;
-        (fp->line_number)++;
-        fscanf (fp->fp, "%[^\n]", temp_string);
-        while (strcmp (temp_string, "0") != 0)
+        while ((dxf_read_group_code (fp, &group_code) == EXIT_SUCCESS)
+          && (group_code != 0))
         {
-                if (ferror (fp->fp))
+                if (dxf_read_error (fp))
                 {
                         fprintf (stderr,
                           (_("Error in %s () while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
-                        fclose (fp->fp);
-                        /* Clean up. */
-                        free (temp_string);
                         return (NULL);
                 }
-                if (strcmp (temp_string, "5") == 0)
-                {
-                        /* Now follows a string containing a sequential
-                         * id number. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%x\n", (uint *) &ellipse->id_code);
-                }
-                else if (strcmp (temp_string, "6") == 0)
-                {
-                        /* Now follows a string containing a linetype
-                         * name. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, ellipse->linetype);
-                }
-                else if (strcmp (temp_string, "8") == 0)
-                {
-                        /* Now follows a string containing a layer name. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, ellipse->layer);
-                }
-                else if (strcmp (temp_string, "10") == 0)
-                {
-                        /* Now follows a string containing the
-                         * X-coordinate of the center point. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &ellipse->p0->x0);
-                }
-                else if (strcmp (temp_string, "20") == 0)
-                {
-                        /* Now follows a string containing the
-                         * Y-coordinate of the center point. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &ellipse->p0->y0);
-                }
-                else if (strcmp (temp_string, "30") == 0)
-                {
-                        /* Now follows a string containing the
-                         * Z-coordinate of the center point. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &ellipse->p0->z0);
-                }
-                else if (strcmp (temp_string, "11") == 0)
-                {
-                        /* Now follows a string containing the
-                         * X-coordinate of the center point. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &ellipse->p1->x0);
-                }
-                else if (strcmp (temp_string, "21") == 0)
-                {
-                        /* Now follows a string containing the
-                         * Y-coordinate of the center point. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &ellipse->p1->y0);
-                }
-                else if (strcmp (temp_string, "31") == 0)
-                {
-                        /* Now follows a string containing the
-                         * Z-coordinate of the center point. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &ellipse->p1->z0);
-                }
-                else if ((fp->acad_version_number <= AutoCAD_11)
-                        && (strcmp (temp_string, "38") == 0)
-                        && (ellipse->elevation = 0.0))
-                {
-                        /* Elevation is a pre AutoCAD R11 variable
-                         * so additional testing for the version should
-                         * probably be added.
-                         * Now follows a string containing the
-                         * elevation. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &ellipse->elevation);
-                }
-                else if (strcmp (temp_string, "39") == 0)
-                {
-                        /* Now follows a string containing the
-                         * thickness. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &ellipse->thickness);
-                }
-                else if (strcmp (temp_string, "40") == 0)
-                {
-                        /* Now follows a string containing the
-                         * radius. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &ellipse->ratio);
-                }
-                else if (strcmp (temp_string, "41") == 0)
-                {
-                        /* Now follows a string containing the
-                         * start angle. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &ellipse->start_angle);
-                }
-                else if (strcmp (temp_string, "42") == 0)
-                {
-                        /* Now follows a string containing the
-                         * end angle. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &ellipse->end_angle);
-                }
-                else if (strcmp (temp_string, "48") == 0)
-                {
-                        /* Now follows a string containing the linetype
-                         * scale. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &ellipse->linetype_scale);
-                }
-                else if (strcmp (temp_string, "60") == 0)
+                switch (group_code)
                 {
-                        /* Now follows a string containing the
-                         * visibility value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%hd\n", &ellipse->visibility);
-                }
-                else if (strcmp (temp_string, "62") == 0)
-                {
-                        /* Now follows a string containing the
-                         * color value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%hd\n", &ellipse->color);
-                }
-                else if (strcmp (temp_string, "67") == 0)
-                {
-                        /* Now follows a string containing the
-                         * paperspace value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%hd\n", &ellipse->paperspace);
-                }
-                else if (strcmp (temp_string, "92") == 0)
-                {
-                        /* Now follows a string containing the
-                         * graphics data size value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%" PRIi32 "\n", &ellipse->graphics_data_size);
-                }
-                else if ((fp->acad_version_number >= AutoCAD_12)
-                        && (strcmp (temp_string, "100") == 0))
-                {
-                        /* Subclass markers are post AutoCAD R12
-                         * variable so additional testing for the
-                         * version should probably be added here.
-                         * Now follows a string containing the
-                         * subclass marker value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
-                        if ((strcmp (temp_string, "AcDbEntity") != 0)
-                        && ((strcmp (temp_string, "AcDbEllipse") != 0)))
-                        {
+                        case 5:
+                                /* Now follows a string containing a sequential
+                                 * id number. */
+                                dxf_read_handle (fp, &ellipse->id_code);
+                                break;
+                        case 6:
+                                /* Now follows a string containing a linetype
+                                 * name. */
+                                dxf_read_string_interned (fp, &ellipse->linetype);
+                                break;
+                        case 8:
+                                /* Now follows a string containing a layer name. */
+                                dxf_read_string_interned (fp, &ellipse->layer);
+                                break;
+                        case 10:
+                                /* Now follows a string containing the
+                                 * X-coordinate of the center point. */
+                                dxf_read_double (fp, &ellipse->p0->x0);
+                                break;
+                        case 20:
+                                /* Now follows a string containing the
+                                 * Y-coordinate of the center point. */
+                                dxf_read_double (fp, &ellipse->p0->y0);
+                                break;
+                        case 30:
+                                /* Now follows a string containing the
+                                 * Z-coordinate of the center point. */
+                                dxf_read_double (fp, &ellipse->p0->z0);
+                                break;
+                        case 11:
+                                /* Now follows a string containing the
+                                 * X-coordinate of the center point. */
+                                dxf_read_double (fp, &ellipse->p1->x0);
+                                break;
+                        case 21:
+                                /* Now follows a string containing the
+                                 * Y-coordinate of the center point. */
+                                dxf_read_double (fp, &ellipse->p1->y0);
+                                break;
+                        case 31:
+                                /* Now follows a string containing the
+                                 * Z-coordinate of the center point. */
+                                dxf_read_double (fp, &ellipse->p1->z0);
+                                break;
+                        case 38:
+                                if ((fp->acad_version_number <= AutoCAD_11) && (ellipse->elevation = 0.0))
+                                {
+                                        /* Elevation is a pre AutoCAD R11 variable
+                                         * so additional testing for the version should
+                                         * probably be added.
+                                         * Now follows a string containing the
+                                         * elevation. */
+                                        dxf_read_double (fp, &ellipse->elevation);
+                                }
+                                else
+                                {
+                                        fprintf (stderr,
+                                          (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
+                                          __FUNCTION__, fp->filename, fp->line_number);
+                                        /* Skip the value of the unknown group code. */
+                                        dxf_read_line (temp_string, fp);
+                                }
+                                break;
+                        case 39:
+                                /* Now follows a string containing the
+                                 * thickness. */
+                                dxf_read_double (fp, &ellipse->thickness);
+                                break;
+                        case 40:
+                                /* Now follows a string containing the
+                                 * radius. */
+                                dxf_read_double (fp, &ellipse->ratio);
+                                break;
+                        case 41:
+                                /* Now follows a string containing the
+                                 * start angle. */
+                                dxf_read_double (fp, &ellipse->start_angle);
+                                break;
+                        case 42:
+                                /* Now follows a string containing the
+                                 * end angle. */
+                                dxf_read_double (fp, &ellipse->end_angle);
+                                break;
+                        case 48:
+                                /* Now follows a string containing the linetype
+                                 * scale. */
+                                dxf_read_double (fp, &ellipse->linetype_scale);
+                                break;
+                        case 60:
+                                /* Now follows a string containing the
+                                 * visibility value. */
+                                dxf_read_int16 (fp, &ellipse->visibility);
+                                break;
+                        case 62:
+                                /* Now follows a string containing the
+                                 * color value. */
+                                dxf_read_int16 (fp, &ellipse->color);
+                                break;
+                        case 67:
+                                /* Now follows a string containing the
+                                 * paperspace value. */
+                                dxf_read_int16 (fp, &ellipse->paperspace);
+                                break;
+                        case 92:
+                                /* Now follows a string containing the
+                                 * graphics data size value. */
+                                dxf_read_int32 (fp, &ellipse->graphics_data_size);
+                                break;
+                        case 100:
+                                if (fp->acad_version_number >= AutoCAD_12)
+                                {
+                                        /* Subclass markers are post AutoCAD R12
+                                         * variable so additional testing for the
+                                         * version should probably be added here.
+                                         * Now follows a string containing the
+                                         * subclass marker value. */
+                                        dxf_read_line (temp_string, fp);
+                                        if ((strcmp (temp_string, "AcDbEntity") != 0)
+                                        && ((strcmp (temp_string, "AcDbEllipse") != 0)))
+                                        {
+                                                fprintf (stderr,
+                                                  (_("Warning in %s () found a bad subclass marker in: %s in line: %d.\n")),
+                                                  __FUNCTION__, fp->filename, fp->line_number);
+                                        }
+                                }
+                                else
+                                {
+                                        fprintf (stderr,
+                                          (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
+                                          __FUNCTION__, fp->filename, fp->line_number);
+                                        /* Skip the value of the unknown group code. */
+                                        dxf_read_line (temp_string, fp);
+                                }
+                                break;
+                        case 160:
+                                /* Now follows a string containing the
+                                 * graphics data size value. */
+                                dxf_read_int32 (fp, &ellipse->graphics_data_size);
+                                break;
+                        case 210:
+                                /* Now follows a string containing the
+                                 * X-value of the extrusion vector. */
+                                dxf_read_double (fp, &ellipse->extr_x0);
+                                break;
+                        case 220:
+                                /* Now follows a string containing the
+                                 * Y-value of the extrusion vector. */
+                                dxf_read_double (fp, &ellipse->extr_y0);
+                                break;
+                        case 230:
+                                /* Now follows a string containing the
+                                 * Z-value of the extrusion vector. */
+                                dxf_read_double (fp, &ellipse->extr_z0);
+                                break;
+                        case 284:
+                                /* Now follows a string containing the shadow
+                                 * mode value. */
+                                dxf_read_int16 (fp, &ellipse->shadow_mode);
+                                break;
+                        case 310:
+                                /* Now follows a string containing binary
+                                 * graphics data. */
+                                iter310 = dxf_binary_data_read (fp, iter310);
+                                break;
+                        case 330:
+                                if (iter330 == 0)
+                                {
+                                        /* Now follows a string containing a soft-pointer
+                                         * ID/handle to owner dictionary. */
+                                        dxf_read_handle (fp, &ellipse->dictionary_owner_soft);
+                                }
+                                if (iter330 == 1)
+                                {
+                                        /* Now follows a string containing a soft-pointer
+                                         * ID/handle to owner object. */
+                                        dxf_read_handle (fp, &ellipse->object_owner_soft);
+                                }
+                                iter330++;
+                                break;
+                        case 347:
+                                /* Now follows a string containing a
+                                 * hard-pointer ID/handle to material object. */
+                                dxf_read_handle (fp, &ellipse->material);
+                                break;
+                        case 360:
+                                /* Now follows a string containing Hard owner
+                                 * ID/handle to owner dictionary. */
+                                dxf_read_handle (fp, &ellipse->dictionary_owner_hard);
+                                break;
+                        case 370:
+                                /* Now follows a string containing the lineweight
+                                 * value. */
+                                dxf_read_int16 (fp, &ellipse->lineweight);
+                                break;
+                        case 390:
+                                /* Now follows a string containing a plot style
+                                 * name value. */
+                                dxf_read_handle (fp, &ellipse->plot_style_name);
+                                break;
+                        case 420:
+                                /* Now follows a string containing a color value. */
+                                dxf_read_int32 (fp, &ellipse->color_value);
+                                break;
+                        case 430:
+                                /* Now follows a string containing a color
+                                 * name value. */
+                                dxf_read_string_interned (fp, &ellipse->color_name);
+                                break;
+                        case 440:
+                                /* Now follows a string containing a transparency
+                                 * value. */
+                                dxf_read_int32 (fp, &ellipse->transparency);
+                                break;
+                        case 999:
+                                /* Now follows a string containing a comment. */
+                                dxf_read_line (temp_string, fp);
+                                fprintf (stdout, "DXF comment: %s\n", temp_string);
+                                break;
+                        default:
                                 fprintf (stderr,
-                                  (_("Warning in %s () found a bad subclass marker in: %s in line: %d.\n")),
+                                  (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
                                   __FUNCTION__, fp->filename, fp->line_number);
-                        }
-                }
-                else if (strcmp (temp_string, "160") == 0)
-                {
-                        /* Now follows a string containing the
-                         * graphics data size value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%" PRIi32 "\n", &ellipse->graphics_data_size);
-                }
-                else if (strcmp (temp_string, "210") == 0)
-                {
-                        /* Now follows a string containing the
-                         * X-value of the extrusion vector. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &ellipse->extr_x0);
-                }
-                else if (strcmp (temp_string, "220") == 0)
-                {
-                        /* Now follows a string containing the
-                         * Y-value of the extrusion vector. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &ellipse->extr_y0);
-                }
-                else if (strcmp (temp_string, "230") == 0)
-                {
-                        /* Now follows a string containing the
-                         * Z-value of the extrusion vector. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &ellipse->extr_z0);
-                }
-                else if (strcmp (temp_string, "284") == 0)
-                {
-                        /* Now follows a string containing the shadow
-                         * mode value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%hd\n", &ellipse->shadow_mode);
-                }
-                else if (strcmp (temp_string, "310") == 0)
-                {
-                        /* Now follows a string containing binary
-                         * graphics data. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, iter310->data_line);
-                        dxf_binary_data_init ((DxfBinaryData *) iter310->next);
-                        iter310 = (DxfBinaryData *) iter310->next;
-                }
-                else if (strcmp (temp_string, "330") == 0)
-                {
-                        if (iter330 == 0)
-                        {
-                                /* Now follows a string containing a soft-pointer
-                                 * ID/handle to owner dictionary. */
-                                (fp->line_number)++;
-                                fscanf (fp->fp, DXF_MAX_STRING_FORMAT, ellipse->dictionary_owner_soft);
-                        }
-                        if (iter330 == 1)
-                        {
-                                /* Now follows a string containing a soft-pointer
-                                 * ID/handle to owner object. */
-                                (fp->line_number)++;
-                                fscanf (fp->fp, DXF_MAX_STRING_FORMAT, ellipse->object_owner_soft);
-                        }
-                        iter330++;
-                }
-                else if (strcmp (temp_string, "347") == 0)
-                {
-                        /* Now follows a string containing a
-                         * hard-pointer ID/handle to material object. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, ellipse->material);
-                }
-                else if (strcmp (temp_string, "360") == 0)
-                {
-                        /* Now follows a string containing Hard owner
-                         * ID/handle to owner dictionary. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, ellipse->dictionary_owner_hard);
-                }
-                else if (strcmp (temp_string, "370") == 0)
-                {
-                        /* Now follows a string containing the lineweight
-                         * value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%hd\n", &ellipse->lineweight);
-                }
-                else if (strcmp (temp_string, "390") == 0)
-                {
-                        /* Now follows a string containing a plot style
-                         * name value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, ellipse->plot_style_name);
-                }
-                else if (strcmp (temp_string, "420") == 0)
-                {
-                        /* Now follows a string containing a color value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%" PRIi32 "\n", &ellipse->color_value);
-                }
-                else if (strcmp (temp_string, "430") == 0)
-                {
-                        /* Now follows a string containing a color
-                         * name value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, ellipse->color_name);
-                }
-                else if (strcmp (temp_string, "440") == 0)
-                {
-                        /* Now follows a string containing a transparency
-                         * value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%" PRIi32 "\n", &ellipse->transparency);
-                }
-                else if (strcmp (temp_string, "999") == 0)
-                {
-                        /* Now follows a string containing a comment. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
-                        fprintf (stdout, "DXF comment: %s\n", temp_string);
-                }
-                else
-                {
-                        fprintf (stderr,
-                          (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
-                          __FUNCTION__, fp->filename, fp->line_number);
+                                /* Skip the value of the unknown group code. */
+                                dxf_read_line (temp_string, fp);
+                                break;
                 }
         }
         /* Handle omitted members and/or illegal values. */
         if (strcmp (ellipse->linetype, "") == 0)
         {
-                ellipse->linetype = strdup (DXF_DEFAULT_LINETYPE);
+                ellipse->linetype = dxf_strdup (DXF_DEFAULT_LINETYPE);
         }
         if (strcmp (ellipse->layer, "") == 0)
         {
-                ellipse->layer = strdup (DXF_DEFAULT_LAYER);
+                ellipse->layer = dxf_strdup (DXF_DEFAULT_LAYER);
         }
-        /* Clean up. */
-        free (temp_string);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -580,7 +525,7 @@ dxf_ellipse_write
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        char *dxf_entity_name = strdup ("ELLIPSE");
+        char *dxf_entity_name = dxf_strdup ("ELLIPSE");
 
         /* Do some basic checks. */
         if (fp == NULL)
@@ -589,7 +534,7 @@ dxf_ellipse_write
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (fp->acad_version_number < AutoCAD_13)
@@ -598,7 +543,7 @@ dxf_ellipse_write
                   (_("Error in %s () illegal DXF version for this entity.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (ellipse == NULL)
@@ -607,7 +552,7 @@ dxf_ellipse_write
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (ellipse->p0 == NULL)
@@ -616,7 +561,7 @@ dxf_ellipse_write
                   (_("Error in %s () a NULL pointer was found.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (ellipse->p1 == NULL)
@@ -625,40 +570,40 @@ dxf_ellipse_write
                   (_("Error in %s () a NULL pointer was found.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (strcmp (ellipse->linetype, "") == 0)
         {
                 fprintf (stderr,
-                  (_("Warning in %s () empty linetype string for the %s entity with id-code: %x\n")),
+                  (_("Warning in %s () empty linetype string for the %s entity with id-code: %" PRIx64 "\n")),
                   __FUNCTION__, dxf_entity_name, ellipse->id_code);
                 fprintf (stderr,
                   (_("\t%s entity is reset to default linetype")),
                   dxf_entity_name);
-                ellipse->linetype = strdup (DXF_DEFAULT_LINETYPE);
+                ellipse->linetype = dxf_strdup (DXF_DEFAULT_LINETYPE);
         }
         if (strcmp (ellipse->layer, "") == 0)
         {
                 fprintf (stderr,
-                  (_("Warning in %s () empty layer string for the %s entity with id-code: %x\n")),
+                  (_("Warning in %s () empty layer string for the %s entity with id-code: %" PRIx64 "\n")),
                   __FUNCTION__, dxf_entity_name, ellipse->id_code);
                 fprintf (stderr,
                   (_("\t%s entity is relocated to layer 0")),
                   dxf_entity_name);
-                ellipse->layer = strdup (DXF_DEFAULT_LAYER);
+                ellipse->layer = dxf_strdup (DXF_DEFAULT_LAYER);
         }
         if (ellipse->ratio == 0.0)
         {
                 fprintf (stderr,
-                  (_("Warning in %s () ratio value equals 0.0 for the %s entity with id-code: %x\n")),
+                  (_("Warning in %s () ratio value equals 0.0 for the %s entity with id-code: %" PRIx64 "\n")),
                   __FUNCTION__, dxf_entity_name, ellipse->id_code);
         }
         /* Start writing output. */
-        fprintf (fp->fp, "  0\n%s\n", dxf_entity_name);
-        if (ellipse->id_code != -1)
+        dxf_write_string (fp, 0, dxf_entity_name);
+        if (ellipse->id_code != DXF_HANDLE_NONE)
         {
-                fprintf (fp->fp, "  5\n%x\n", ellipse->id_code);
+                dxf_write_hex (fp, 5, ellipse->id_code);
         }
         /*!
          * \todo for version R14.\n
@@ -670,67 +615,67 @@ dxf_ellipse_write
          * 102 groups are application defined (optional).\n\n
          * End of group, "}" (optional), with Group code 102.
          */
-        if ((strcmp (ellipse->dictionary_owner_soft, "") != 0)
+        if ((ellipse->dictionary_owner_soft != 0)
           && (fp->acad_version_number >= AutoCAD_14))
         {
-                fprintf (fp->fp, "102\n{ACAD_REACTORS\n");
-                fprintf (fp->fp, "330\n%s\n", ellipse->dictionary_owner_soft);
-                fprintf (fp->fp, "102\n}\n");
+                dxf_write_string (fp, 102, "{ACAD_REACTORS");
+                dxf_write_hex (fp, 330, ellipse->dictionary_owner_soft);
+                dxf_write_string (fp, 102, "}");
         }
-        if ((strcmp (ellipse->dictionary_owner_hard, "") != 0)
+        if ((ellipse->dictionary_owner_hard != 0)
           && (fp->acad_version_number >= AutoCAD_14))
         {
-                fprintf (fp->fp, "102\n{ACAD_XDICTIONARY\n");
-                fprintf (fp->fp, "360\n%s\n", ellipse->dictionary_owner_hard);
-                fprintf (fp->fp, "102\n}\n");
+                dxf_write_string (fp, 102, "{ACAD_XDICTIONARY");
+                dxf_write_hex (fp, 360, ellipse->dictionary_owner_hard);
+                dxf_write_string (fp, 102, "}");
         }
-        if ((strcmp (ellipse->object_owner_soft, "") != 0)
+        if ((ellipse->object_owner_soft != 0)
           && (fp->acad_version_number >= AutoCAD_2000))
         {
-                fprintf (fp->fp, "330\n%s\n", ellipse->object_owner_soft);
+                dxf_write_hex (fp, 330, ellipse->object_owner_soft);
         }
         if (fp->acad_version_number >= AutoCAD_13)
         {
-                fprintf (fp->fp, "100\nAcDbEntity\n");
+                dxf_write_string (fp, 100, "AcDbEntity");
         }
         if (ellipse->paperspace == DXF_PAPERSPACE)
         {
-                fprintf (fp->fp, " 67\n%hd\n", (int16_t) DXF_PAPERSPACE);
+                dxf_write_int (fp, 67, (int16_t) DXF_PAPERSPACE);
         }
-        fprintf (fp->fp, "  8\n%s\n", ellipse->layer);
+        dxf_write_string (fp, 8, ellipse->layer);
         if (strcmp (ellipse->linetype, DXF_DEFAULT_LINETYPE) != 0)
         {
-                fprintf (fp->fp, "  6\n%s\n", ellipse->linetype);
+                dxf_write_string (fp, 6, ellipse->linetype);
         }
         if ((fp->acad_version_number <= AutoCAD_11)
           && DXF_FLATLAND
           && (ellipse->elevation != 0.0))
         {
-                fprintf (fp->fp, " 38\n%f\n", ellipse->elevation);
+                dxf_write_double (fp, 38, ellipse->elevation);
         }
         if ((fp->acad_version_number <= AutoCAD_13)
           && (ellipse->thickness != 0.0))
         {
-                fprintf (fp->fp, " 39\n%f\n", ellipse->thickness);
+                dxf_write_double (fp, 39, ellipse->thickness);
         }
         if (ellipse->color != DXF_COLOR_BYLAYER)
         {
-                fprintf (fp->fp, " 62\n%hd\n", ellipse->color);
+                dxf_write_int (fp, 62, ellipse->color);
         }
         if (ellipse->linetype_scale != 1.0)
         {
-                fprintf (fp->fp, " 48\n%f\n", ellipse->linetype_scale);
+                dxf_write_double (fp, 48, ellipse->linetype_scale);
         }
         if (ellipse->visibility != 0)
         {
-                fprintf (fp->fp, " 60\n%hd\n", ellipse->visibility);
+                dxf_write_int (fp, 60, ellipse->visibility);
         }
         if (fp->acad_version_number >= AutoCAD_2000)
         {
 #ifdef BUILD_64
-                fprintf (fp->fp, "160\n%" PRIi32 "\n", ellipse->graphics_data_size);
+                dxf_write_int (fp, 160, ellipse->graphics_data_size);
 #else
-                fprintf (fp->fp, " 92\n%" PRIi32 "\n", ellipse->graphics_data_size);
+                dxf_write_int (fp, 92, ellipse->graphics_data_size);
 #endif
                 if (ellipse->binary_graphics_data != NULL)
                 {
@@ -738,40 +683,40 @@ dxf_ellipse_write
                         iter = (DxfBinaryData *) ellipse->binary_graphics_data;
                         while (iter != NULL)
                         {
-                                fprintf (fp->fp, "310\n%s\n", iter->data_line);
+                                dxf_binary_data_write (fp, iter);
                                 iter = (DxfBinaryData *) iter->next;
                         }
                 }
         }
         if (fp->acad_version_number >= AutoCAD_2004)
         {
-                fprintf (fp->fp, "420\n%" PRIi32 "\n", ellipse->color_value);
-                fprintf (fp->fp, "430\n%s\n", ellipse->color_name);
-                fprintf (fp->fp, "440\n%" PRIi32 "\n", ellipse->transparency);
+                dxf_write_int (fp, 420, ellipse->color_value);
+                dxf_write_string (fp, 430, ellipse->color_name);
+                dxf_write_int (fp, 440, ellipse->transparency);
         }
         if (fp->acad_version_number >= AutoCAD_2009)
         {
-                fprintf (fp->fp, "390\n%s\n", ellipse->plot_style_name);
-                fprintf (fp->fp, "284\n%hd\n", ellipse->shadow_mode);
+                dxf_write_hex (fp, 390, ellipse->plot_style_name);
+                dxf_write_int (fp, 284, ellipse->shadow_mode);
         }
         if (fp->acad_version_number >= AutoCAD_13)
         {
-                fprintf (fp->fp, "100\nAcDbEllipse\n");
-        }
-        fprintf (fp->fp, " 10\n%f\n", ellipse->p0->x0);
-        fprintf (fp->fp, " 20\n%f\n", ellipse->p0->y0);
-        fprintf (fp->fp, " 30\n%f\n", ellipse->p0->z0);
-        fprintf (fp->fp, " 11\n%f\n", ellipse->p1->x0);
-        fprintf (fp->fp, " 21\n%f\n", ellipse->p1->y0);
-        fprintf (fp->fp, " 31\n%f\n", ellipse->p1->z0);
-        fprintf (fp->fp, " 210\n%f\n", ellipse->extr_x0);
-        fprintf (fp->fp, " 220\n%f\n", ellipse->extr_y0);
-        fprintf (fp->fp, " 230\n%f\n", ellipse->extr_z0);
-        fprintf (fp->fp, " 40\n%f\n", ellipse->ratio);
-        fprintf (fp->fp, " 41\n%f\n", ellipse->start_angle);
-        fprintf (fp->fp, " 42\n%f\n", ellipse->end_angle);
+                dxf_write_string (fp, 100, "AcDbEllipse");
+        }
+        dxf_write_double (fp, 10, ellipse->p0->x0);
+        dxf_write_double (fp, 20, ellipse->p0->y0);
+        dxf_write_double (fp, 30, ellipse->p0->z0);
+        dxf_write_double (fp, 11, ellipse->p1->x0);
+        dxf_write_double (fp, 21, ellipse->p1->y0);
+        dxf_write_double (fp, 31, ellipse->p1->z0);
+        dxf_write_double (fp, 210, ellipse->extr_x0);
+        dxf_write_double (fp, 220, ellipse->extr_y0);
+        dxf_write_double (fp, 230, ellipse->extr_z0);
+        dxf_write_double (fp, 40, ellipse->ratio);
+        dxf_write_double (fp, 41, ellipse->start_angle);
+        dxf_write_double (fp, 42, ellipse->end_angle);
         /* Clean up. */
-        free (dxf_entity_name);
+        dxf_free (dxf_entity_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -812,18 +757,13 @@ dxf_ellipse_free
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        free (ellipse->linetype);
-        free (ellipse->layer);
+        dxf_string_free (ellipse->linetype);
+        dxf_string_free (ellipse->layer);
         dxf_binary_data_free_list (ellipse->binary_graphics_data);
-        free (ellipse->dictionary_owner_soft);
-        free (ellipse->object_owner_soft);
-        free (ellipse->material);
-        free (ellipse->dictionary_owner_hard);
-        free (ellipse->plot_style_name);
-        free (ellipse->color_name);
+        dxf_string_free (ellipse->color_name);
         dxf_point_free_list (ellipse->p0);
         dxf_point_free_list (ellipse->p1);
-        free (ellipse);
+        dxf_free (ellipse);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -869,7 +809,7 @@ dxf_ellipse_free_list
  *
  * \return \c id_code.
  */
-int
+uint64_t
 dxf_ellipse_get_id_code
 (
         DxfEllipse *ellipse
@@ -887,12 +827,6 @@ dxf_ellipse_get_id_code
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (ellipse->id_code < 0)
-        {
-                fprintf (stderr,
-                  (_("Warning in %s () a negative value was found.\n")),
-                  __FUNCTION__);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -908,7 +842,7 @@ dxf_ellipse_set_id_code
 (
         DxfEllipse *ellipse,
                 /*!< a pointer to a DXF \c ELLIPSE entity. */
-        int id_code
+        uint64_t id_code
                 /*!< Identification number for the entity.\n
                  * This is to be an unique (sequential) number in the DXF
                  * file. */
@@ -925,12 +859,6 @@ dxf_ellipse_set_id_code
                   __FUNCTION__);
                 return (NULL);
         }
-        if (id_code < 0)
-        {
-                fprintf (stderr,
-                  (_("Warning in %s () a negative value was passed.\n")),
-                  __FUNCTION__);
-        }
         ellipse->id_code = id_code;
 #if DEBUG
         DXF_DEBUG_END
@@ -972,7 +900,7 @@ dxf_ellipse_get_linetype
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (ellipse->linetype));
+        return (dxf_strdup (ellipse->linetype));
 }
 
 
@@ -1006,7 +934,7 @@ dxf_ellipse_set_linetype
                   __FUNCTION__);
                 return (NULL);
         }
-        ellipse->linetype = strdup (linetype);
+        ellipse->linetype = dxf_strdup (linetype);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1047,7 +975,7 @@ dxf_ellipse_get_layer
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (ellipse->layer));
+        return (dxf_strdup (ellipse->layer));
 }
 
 
@@ -1081,7 +1009,7 @@ dxf_ellipse_set_layer
                   __FUNCTION__);
                 return (NULL);
         }
-        ellipse->layer = strdup (layer);
+        ellipse->layer = dxf_strdup (layer);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1808,10 +1736,8 @@ dxf_ellipse_set_binary_graphics_data
  * \c ELLIPSE entity.
  *
  * \return soft pointer to the dictionary owner.
- *
- * \warning No checks are performed on the returned pointer (string).
  */
-char *
+uint64_t
 dxf_ellipse_get_dictionary_owner_soft
 (
         DxfEllipse *ellipse
@@ -1827,19 +1753,12 @@ dxf_ellipse_get_dictionary_owner_soft
                 fprintf (stderr,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
-                return (NULL);
-        }
-        if (ellipse->dictionary_owner_soft ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
+                return (0);
         }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (ellipse->dictionary_owner_soft));
+        return (ellipse->dictionary_owner_soft);
 }
 
 
@@ -1852,8 +1771,8 @@ dxf_ellipse_set_dictionary_owner_soft
 (
         DxfEllipse *ellipse,
                 /*!< a pointer to a DXF \c ELLIPSE entity. */
-        char *dictionary_owner_soft
-                /*!< a string containing the pointer to the
+        uint64_t dictionary_owner_soft
+                /*!< the handle of the
                  * dictionary_owner_soft for the entity. */
 )
 {
@@ -1868,14 +1787,7 @@ dxf_ellipse_set_dictionary_owner_soft
                   __FUNCTION__);
                 return (NULL);
         }
-        if (dictionary_owner_soft == NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was passed.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
-        ellipse->dictionary_owner_soft = strdup (dictionary_owner_soft);
+        ellipse->dictionary_owner_soft = dictionary_owner_soft;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1888,10 +1800,8 @@ dxf_ellipse_set_dictionary_owner_soft
  * \c ELLIPSE entity.
  *
  * \return soft pointer to the object owner.
- *
- * \warning No checks are performed on the returned pointer (string).
  */
-char *
+uint64_t
 dxf_ellipse_get_object_owner_soft
 (
         DxfEllipse *ellipse
@@ -1907,19 +1817,12 @@ dxf_ellipse_get_object_owner_soft
                 fprintf (stderr,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
-                return (NULL);
-        }
-        if (ellipse->object_owner_soft ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
+                return (0);
         }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (ellipse->object_owner_soft));
+        return (ellipse->object_owner_soft);
 }
 
 
@@ -1932,8 +1835,8 @@ dxf_ellipse_set_object_owner_soft
 (
         DxfEllipse *ellipse,
                 /*!< a pointer to a DXF \c ELLIPSE entity. */
-        char *object_owner_soft
-                /*!< a string containing the pointer to the
+        uint64_t object_owner_soft
+                /*!< the handle of the
                  * \c object_owner_soft for the entity. */
 )
 {
@@ -1948,14 +1851,7 @@ dxf_ellipse_set_object_owner_soft
                   __FUNCTION__);
                 return (NULL);
         }
-        if (object_owner_soft == NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was passed.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
-        ellipse->object_owner_soft = strdup (object_owner_soft);
+        ellipse->object_owner_soft = object_owner_soft;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1966,12 +1862,10 @@ dxf_ellipse_set_object_owner_soft
 /*!
  * \brief Get the pointer to the \c material from a DXF \c ELLIPSE entity.
  *
- * \return a pointer to \c material when successful, or \c NULL when an
+ * \return the handle \c material when successful, or 0 when an
  * error occurred.
- *
- * \warning No checks are performed on the returned pointer.
  */
-char *
+uint64_t
 dxf_ellipse_get_material
 (
         DxfEllipse *ellipse
@@ -1987,19 +1881,12 @@ dxf_ellipse_get_material
                 fprintf (stderr,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
-                return (NULL);
-        }
-        if (ellipse->material ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
+                return (0);
         }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (ellipse->material));
+        return (ellipse->material);
 }
 
 
@@ -2014,8 +1901,8 @@ dxf_ellipse_set_material
 (
         DxfEllipse *ellipse,
                 /*!< a pointer to a DXF \c ELLIPSE entity. */
-        char *material
-                /*!< a string containing the pointer to the \c
+        uint64_t material
+                /*!< the handle of the \c
                  * material for the entity. */
 )
 {
@@ -2030,14 +1917,7 @@ dxf_ellipse_set_material
                   __FUNCTION__);
                 return (NULL);
         }
-        if (material == NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was passed.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
-        ellipse->material = strdup (material);
+        ellipse->material = material;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2050,10 +1930,8 @@ dxf_ellipse_set_material
  * \c ELLIPSE entity.
  *
  * \return hard pointer to the dictionary owner.
- *
- * \warning No checks are performed on the returned pointer (string).
  */
-char *
+uint64_t
 dxf_ellipse_get_dictionary_owner_hard
 (
         DxfEllipse *ellipse
@@ -2069,19 +1947,12 @@ dxf_ellipse_get_dictionary_owner_hard
                 fprintf (stderr,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
-                return (NULL);
-        }
-        if (ellipse->dictionary_owner_hard ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
+                return (0);
         }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (ellipse->dictionary_owner_hard));
+        return (ellipse->dictionary_owner_hard);
 }
 
 
@@ -2094,8 +1965,8 @@ dxf_ellipse_set_dictionary_owner_hard
 (
         DxfEllipse *ellipse,
                 /*!< a pointer to a DXF \c ELLIPSE entity. */
-        char *dictionary_owner_hard
-                /*!< a string containing the pointer to the
+        uint64_t dictionary_owner_hard
+                /*!< the handle of the
                  * dictionary_owner_hard for the entity. */
 )
 {
@@ -2110,14 +1981,7 @@ dxf_ellipse_set_dictionary_owner_hard
                   __FUNCTION__);
                 return (NULL);
         }
-        if (dictionary_owner_hard == NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was passed.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
-        ellipse->dictionary_owner_hard = strdup (dictionary_owner_hard);
+        ellipse->dictionary_owner_hard = dictionary_owner_hard;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2193,10 +2057,10 @@ dxf_ellipse_set_lineweight
 /*!
  * \brief Get the \c plot_style_name from a DXF \c ELLIPSE entity.
  *
- * \return a pointer to \c plot_style_name when sucessful, or \c NULL
+ * \return the handle \c plot_style_name when sucessful, or 0
  * when an error occurred.
  */
-char *
+uint64_t
 dxf_ellipse_get_plot_style_name
 (
         DxfEllipse *ellipse
@@ -2212,19 +2076,12 @@ dxf_ellipse_get_plot_style_name
                 fprintf (stderr,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
-                return (NULL);
-        }
-        if (ellipse->plot_style_name ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
+                return (0);
         }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (ellipse->plot_style_name));
+        return (ellipse->plot_style_name);
 }
 
 
@@ -2239,7 +2096,7 @@ dxf_ellipse_set_plot_style_name
 (
         DxfEllipse *ellipse,
                 /*!< a pointer to a DXF \c ELLIPSE entity. */
-        char *plot_style_name
+        uint64_t plot_style_name
                 /*!< a string containing the \c plot_style_name for the
                  * entity. */
 )
@@ -2255,14 +2112,7 @@ dxf_ellipse_set_plot_style_name
                   __FUNCTION__);
                 return (NULL);
         }
-        if (plot_style_name == NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was passed.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
-        ellipse->plot_style_name = strdup (plot_style_name);
+        ellipse->plot_style_name = plot_style_name;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2369,7 +2219,7 @@ dxf_ellipse_get_color_name
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (ellipse->color_name));
+        return (dxf_strdup (ellipse->color_name));
 }
 
 
@@ -2407,7 +2257,7 @@ dxf_ellipse_set_color_name
                   __FUNCTION__);
                 return (NULL);
         }
-        ellipse->color_name = strdup (color_name);
+        ellipse->color_name = dxf_strdup (color_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -3883,4 +3733,162 @@ dxf_ellipse_get_last
 }
 
 
+/*!
+ * \brief Get the bounding box of a DXF \c ELLIPSE.
+ *
+ * The exact box of \c ellipse, with the extremes along every axis
+ * found analytically, see dxf_bbox_add_ellipse ().\n
+ * The minor axis is the major axis turned a quarter counterclockwise
+ * around the extrusion direction, scaled by the ratio.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_ellipse_get_bbox
+(
+        DxfEllipse *ellipse,
+                /*!< a pointer to a DXF \c ELLIPSE entity. */
+        DxfBbox *bbox
+                /*!< a pointer to the libDXF bounding box to fill. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfVec3 center;
+        DxfVec3 major;
+        DxfVec3 minor;
+        double nx;
+        double ny;
+        double nz;
+        double length;
+
+        /* Do some basic checks. */
+        if ((ellipse == NULL) || (bbox == NULL))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        if ((ellipse->p0 == NULL) || (ellipse->p1 == NULL))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer to the center point or end point was found.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        center.x = ellipse->p0->x0;
+        center.y = ellipse->p0->y0;
+        center.z = ellipse->p0->z0;
+        major.x = ellipse->p1->x0;
+        major.y = ellipse->p1->y0;
+        major.z = ellipse->p1->z0;
+        length = sqrt ((ellipse->extr_x0 * ellipse->extr_x0)
+          + (ellipse->extr_y0 * ellipse->extr_y0)
+          + (ellipse->extr_z0 * ellipse->extr_z0));
+        if (length == 0.0)
+        {
+                nx = 0.0;
+                ny = 0.0;
+                nz = 1.0;
+        }
+        else
+        {
+                nx = ellipse->extr_x0 / length;
+                ny = ellipse->extr_y0 / length;
+                nz = ellipse->extr_z0 / length;
+        }
+        minor.x = ellipse->ratio * ((ny * major.z) - (nz * major.y));
+        minor.y = ellipse->ratio * ((nz * major.x) - (nx * major.z));
+        minor.z = ellipse->ratio * ((nx * major.y) - (ny * major.x));
+        dxf_bbox_init (bbox);
+        dxf_bbox_add_ellipse (bbox, &center, &major, &minor,
+          ellipse->start_angle, ellipse->end_angle);
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Transform a DXF \c ELLIPSE entity in place.
+ *
+ * The center point and the end point of the major axis are in world
+ * coordinates, \c transform has to map the plane of the ellipse with a
+ * uniform scale, see dxf_transform_get_ocs_transform ().
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred, or when \c transform does not map the entity without
+ * distortion.
+ */
+int
+dxf_ellipse_transform
+(
+        DxfEllipse *ellipse,
+                /*!< a pointer to a DXF \c ELLIPSE entity. */
+        DxfTransform *transform
+                /*!< a pointer to a libDXF affine transformation. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfTransform ocs;
+        DxfVec3 extrusion;
+        DxfVec3 center;
+        DxfVec3 major;
+
+        /* Do some basic checks. */
+        if ((ellipse == NULL) || (transform == NULL))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        if ((ellipse->p0 == NULL) || (ellipse->p1 == NULL))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer to the center point or end point was found.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        extrusion.x = ellipse->extr_x0;
+        extrusion.y = ellipse->extr_y0;
+        extrusion.z = ellipse->extr_z0;
+        if (dxf_transform_get_ocs_transform (transform, &extrusion, &ocs, NULL) == EXIT_FAILURE)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () the transformation distorts the ELLIPSE entity with id-code: %" PRIx64 "\n")),
+                  __FUNCTION__, ellipse->id_code);
+                return (EXIT_FAILURE);
+        }
+        center.x = ellipse->p0->x0;
+        center.y = ellipse->p0->y0;
+        center.z = ellipse->p0->z0;
+        major.x = ellipse->p1->x0;
+        major.y = ellipse->p1->y0;
+        major.z = ellipse->p1->z0;
+        dxf_transform_apply_point (transform, &center, &center);
+        dxf_transform_apply_vector (transform, &major, &major);
+        ellipse->p0->x0 = center.x;
+        ellipse->p0->y0 = center.y;
+        ellipse->p0->z0 = center.z;
+        ellipse->p1->x0 = major.x;
+        ellipse->p1->y0 = major.y;
+        ellipse->p1->z0 = major.z;
+        ellipse->extr_x0 = extrusion.x;
+        ellipse->extr_y0 = extrusion.y;
+        ellipse->extr_z0 = extrusion.z;
+        ellipse->thickness *= ocs.m[2][2];
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (EXIT_SUCCESS);
+}
+
+
 /* EOF */
@@ -46,6 +46,7 @@
 #include "global.h"
 #include "point.h"
 #include "binary_data.h"
+#include "transform.h"
 
 
 #ifdef __cplusplus
@@ -62,7 +63,7 @@ typedef struct
 dxf_ellipse_struct
 {
         /* Members common for all DXF drawable entities. */
-        int id_code;
+        uint64_t id_code;
                 /*!< Identification number for the entity.\n
                  * This is to be an unique (sequential) number in the DXF
                  * file.\n
@@ -135,20 +136,20 @@ dxf_ellipse_struct
                  * (optional).\n
                  * Group code = 310.\n
                  * \since Introduced in version R2000. */
-        char *dictionary_owner_soft;
+        uint64_t dictionary_owner_soft;
                 /*!< Soft-pointer ID/handle to owner dictionary (optional).\n
                  * Group code = 330.\n
                  * \since Introduced in version R14. */
-        char *object_owner_soft;
+        uint64_t object_owner_soft;
                 /*!< Soft-pointer ID/handle  to owner BLOCK_RECORD object.\n
                  * Group code = 330.\n
                  * \since Introduced in version R2000. */
-        char *material;
+        uint64_t material;
                 /*!< Hard-pointer ID/handle to material object (present if
                  * not BYLAYER).\n
                  * Group code = 347.\n
                  * \since Introduced in version R2008. */
-        char *dictionary_owner_hard;
+        uint64_t dictionary_owner_hard;
                 /*!< Hard owner ID/handle to owner dictionary (optional).\n
                  * Group code = 360.\n
                  * \since Introduced in version R14. */
@@ -157,7 +158,7 @@ dxf_ellipse_struct
                  * Stored and moved around as a 16-bit integer.\n
                  * Group code = 370.\n
                  * \since Introduced in version R2002. */
-        char *plot_style_name;
+        uint64_t plot_style_name;
                 /*!< Hard pointer ID / handle of PlotStyleName object.\n
                  * Group code = 390.\n
                  * \since Introduced in version R2009. */
@@ -249,8 +250,8 @@ DxfEllipse *dxf_ellipse_read (DxfFile *fp, DxfEllipse *ellipse);
 int dxf_ellipse_write (DxfFile *fp, DxfEllipse *ellipse);
 int dxf_ellipse_free (DxfEllipse *ellipse);
 void dxf_ellipse_free_list (DxfEllipse *ellipses);
-int dxf_ellipse_get_id_code (DxfEllipse *ellipse);
-DxfEllipse *dxf_ellipse_set_id_code (DxfEllipse *ellipse, int id_code);
+uint64_t dxf_ellipse_get_id_code (DxfEllipse *ellipse);
+DxfEllipse *dxf_ellipse_set_id_code (DxfEllipse *ellipse, uint64_t id_code);
 char *dxf_ellipse_get_linetype (DxfEllipse *ellipse);
 DxfEllipse *dxf_ellipse_set_linetype (DxfEllipse *ellipse, char *linetype);
 char *dxf_ellipse_get_layer (DxfEllipse *ellipse);
@@ -273,18 +274,18 @@ int16_t dxf_ellipse_get_shadow_mode (DxfEllipse *ellipse);
 DxfEllipse *dxf_ellipse_set_shadow_mode (DxfEllipse *ellipse, int16_t shadow_mode);
 DxfBinaryData *dxf_ellipse_get_binary_graphics_data (DxfEllipse *ellipse);
 DxfEllipse *dxf_ellipse_set_binary_graphics_data (DxfEllipse *ellipse, DxfBinaryData *data);
-char *dxf_ellipse_get_dictionary_owner_soft (DxfEllipse *ellipse);
-DxfEllipse *dxf_ellipse_set_dictionary_owner_soft (DxfEllipse *ellipse, char *dictionary_owner_soft);
-char *dxf_ellipse_get_object_owner_soft (DxfEllipse *ellipse);
-DxfEllipse *dxf_ellipse_set_object_owner_soft (DxfEllipse *ellipse, char *object_owner_soft);
-char *dxf_ellipse_get_material (DxfEllipse *ellipse);
-DxfEllipse *dxf_ellipse_set_material (DxfEllipse *ellipse, char *material);
-char *dxf_ellipse_get_dictionary_owner_hard (DxfEllipse *ellipse);
-DxfEllipse *dxf_ellipse_set_dictionary_owner_hard (DxfEllipse *ellipse, char *dictionary_owner_hard);
+uint64_t dxf_ellipse_get_dictionary_owner_soft (DxfEllipse *ellipse);
+DxfEllipse *dxf_ellipse_set_dictionary_owner_soft (DxfEllipse *ellipse, uint64_t dictionary_owner_soft);
+uint64_t dxf_ellipse_get_object_owner_soft (DxfEllipse *ellipse);
+DxfEllipse *dxf_ellipse_set_object_owner_soft (DxfEllipse *ellipse, uint64_t object_owner_soft);
+uint64_t dxf_ellipse_get_material (DxfEllipse *ellipse);
+DxfEllipse *dxf_ellipse_set_material (DxfEllipse *ellipse, uint64_t material);
+uint64_t dxf_ellipse_get_dictionary_owner_hard (DxfEllipse *ellipse);
+DxfEllipse *dxf_ellipse_set_dictionary_owner_hard (DxfEllipse *ellipse, uint64_t dictionary_owner_hard);
 int16_t dxf_ellipse_get_lineweight (DxfEllipse *ellipse);
 DxfEllipse *dxf_ellipse_set_lineweight (DxfEllipse *ellipse, int16_t lineweight);
-char *dxf_ellipse_get_plot_style_name (DxfEllipse *ellipse);
-DxfEllipse *dxf_ellipse_set_plot_style_name (DxfEllipse *ellipse, char *plot_style_name);
+uint64_t dxf_ellipse_get_plot_style_name (DxfEllipse *ellipse);
+DxfEllipse *dxf_ellipse_set_plot_style_name (DxfEllipse *ellipse, uint64_t plot_style_name);
 int32_t dxf_ellipse_get_color_value (DxfEllipse *ellipse);
 DxfEllipse *dxf_ellipse_set_color_value (DxfEllipse *ellipse, int32_t color_value);
 char *dxf_ellipse_get_color_name (DxfEllipse *ellipse);
@@ -325,6 +326,8 @@ DxfEllipse *dxf_ellipse_set_extrusion_vector (DxfEllipse *ellipse, double extr_x
 DxfEllipse *dxf_ellipse_get_next (DxfEllipse *ellipse);
 DxfEllipse *dxf_ellipse_set_next (DxfEllipse *ellipse, DxfEllipse *next);
 DxfEllipse *dxf_ellipse_get_last (DxfEllipse *ellipse);
+int dxf_ellipse_get_bbox (DxfEllipse *ellipse, DxfBbox *bbox);
+int dxf_ellipse_transform (DxfEllipse *ellipse, DxfTransform *transform);
 
 
 #ifdef __cplusplus
@@ -61,7 +61,7 @@ dxf_endblk_new ()
         size = sizeof (DxfEndblk);
         /* avoid malloc of 0 bytes */
         if (size == 0) size = 1;
-        if ((endblk = malloc (size)) == NULL)
+        if ((endblk = dxf_malloc (size)) == NULL)
         {
                 fprintf (stderr,
                   (_("Error in %s () could not allocate memory.\n")),
@@ -111,9 +111,9 @@ dxf_endblk_init
                   __FUNCTION__);
                 return (NULL);
         }
-        endblk->id_code = 0;
-        endblk->layer = strdup (DXF_DEFAULT_LAYER);
-        endblk->object_owner_soft = strdup ("");
+        endblk->id_code = DXF_HANDLE_NONE;
+        endblk->layer = dxf_strdup (DXF_DEFAULT_LAYER);
+        endblk->object_owner_soft = 0;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -149,7 +149,8 @@ dxf_endblk_read
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        char *temp_string = NULL;
+        char temp_string[DXF_MAX_STRING_LENGTH];
+        int group_code;
 
         /* Do some basic checks. */
         if (fp == NULL)
@@ -157,8 +158,6 @@ dxf_endblk_read
                 fprintf (stderr,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
-                /* Clean up. */
-                free (temp_string);
                 return (NULL);
         }
         if (endblk == NULL)
@@ -168,56 +167,51 @@ dxf_endblk_read
                   __FUNCTION__);
                 endblk = dxf_endblk_init (endblk);
         }
-        fscanf (fp->fp, "%[^\n]", temp_string);
-        while (strcmp (temp_string, "0") != 0)
+        while ((dxf_read_group_code (fp, &group_code) == EXIT_SUCCESS)
+          && (group_code != 0))
         {
-                if (ferror (fp->fp))
+                if (dxf_read_error (fp))
                 {
                         fprintf (stderr,
                           (_("Error in %s () while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
-                        fclose (fp->fp);
-                        /* Clean up. */
-                        free (temp_string);
                         return (NULL);
                 }
-                else if (strcmp (temp_string, "5") == 0)
+                switch (group_code)
                 {
-                        /* Now follows a string containing a sequential
-                         * id number. */
-                        fscanf (fp->fp, "%x\n", &endblk->id_code);
-                }
-                else if (strcmp (temp_string, "8") == 0)
-                {
-                        /* Now follows a string containing a layer name. */
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, endblk->layer);
-                }
-                else if (strcmp (temp_string, "330") == 0)
-                {
-                        /* Now follows a string containing Soft-pointer
-                         * ID/handle to owner object. */
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, endblk->object_owner_soft);
-                }
-                else if (strcmp (temp_string, "999") == 0)
-                {
-                        /* Now follows a string containing a comment. */
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
-                        fprintf (stdout, "DXF comment: %s\n", temp_string);
-                }
-                else
-                {
-                        fprintf (stderr,
-                          (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
-                          __FUNCTION__, fp->filename, fp->line_number);
+                        case 5:
+                                /* Now follows a string containing a sequential
+                                 * id number. */
+                                dxf_read_handle (fp, &endblk->id_code);
+                                break;
+                        case 8:
+                                /* Now follows a string containing a layer name. */
+                                dxf_read_string_interned (fp, &endblk->layer);
+                                break;
+                        case 330:
+                                /* Now follows a string containing Soft-pointer
+                                 * ID/handle to owner object. */
+                                dxf_read_handle (fp, &endblk->object_owner_soft);
+                                break;
+                        case 999:
+                                /* Now follows a string containing a comment. */
+                                dxf_read_line (temp_string, fp);
+                                fprintf (stdout, "DXF comment: %s\n", temp_string);
+                                break;
+                        default:
+                                fprintf (stderr,
+                                  (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
+                                  __FUNCTION__, fp->filename, fp->line_number);
+                                /* Skip the value of the unknown group code. */
+                                dxf_read_line (temp_string, fp);
+                                break;
                 }
         }
         /* Handle ommitted members and/or illegal values. */
         if (strcmp (endblk->layer, "") == 0)
         {
-                endblk->layer = strdup (DXF_DEFAULT_LAYER);
+                endblk->layer = dxf_strdup (DXF_DEFAULT_LAYER);
         }
-        /* Clean up. */
-        free (temp_string);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -259,10 +253,10 @@ dxf_endblk_write
                 return (EXIT_FAILURE);
         }
         /* Start writing output. */
-        fprintf (fp->fp, "  0\nENDBLK\n");
+        dxf_write_string (fp, 0, "ENDBLK");
         if (fp->acad_version_number >= AutoCAD_13)
         {
-                fprintf (fp->fp, "  5\n%x\n", endblk->id_code);
+                dxf_write_hex (fp, 5, endblk->id_code);
         }
         /*!
          * \todo for version R14.\n
@@ -274,16 +268,16 @@ dxf_endblk_write
          * 102 groups are application defined (optional).\n\n
          * End of group, "}" (optional), with Group code 102.
          */
-        if ((strcmp (endblk->object_owner_soft, "") != 0)
+        if ((endblk->object_owner_soft != 0)
           && (fp->acad_version_number >= AutoCAD_2000))
         {
-                fprintf (fp->fp, "330\n%s\n", endblk->object_owner_soft);
+                dxf_write_hex (fp, 330, endblk->object_owner_soft);
         }
         if (fp->acad_version_number >= AutoCAD_13)
         {
-                fprintf (fp->fp, "100\nAcDbEntity\n");
-                fprintf (fp->fp, "  8\n%s\n", endblk->layer);
-                fprintf (fp->fp, "100\nAcDbBlockEnd\n");
+                dxf_write_string (fp, 100, "AcDbEntity");
+                dxf_write_string (fp, 8, endblk->layer);
+                dxf_write_string (fp, 100, "AcDbBlockEnd");
         }
 #if DEBUG
         DXF_DEBUG_END
@@ -317,9 +311,8 @@ dxf_endblk_free
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        free (endblk->layer);
-        free (endblk->object_owner_soft);
-        free (endblk);
+        dxf_string_free (endblk->layer);
+        dxf_free (endblk);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -332,7 +325,7 @@ dxf_endblk_free
  *
  * \return ID code.
  */
-int
+uint64_t
 dxf_endblk_get_id_code
 (
         DxfEndblk *endblk
@@ -342,7 +335,7 @@ dxf_endblk_get_id_code
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        int result;
+        uint64_t result;
 
         /* Do some basic checks. */
         if (endblk == NULL)
@@ -352,12 +345,6 @@ dxf_endblk_get_id_code
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (endblk->id_code < 0)
-        {
-                fprintf (stderr,
-                  (_("Warning in %s () a negative value was found.\n")),
-                  __FUNCTION__);
-        }
         result = endblk->id_code;
 #if DEBUG
         DXF_DEBUG_END
@@ -374,7 +361,7 @@ dxf_endblk_set_id_code
 (
         DxfEndblk *endblk,
                 /*!< a pointer to a DxfEndblk (a DXF \c ENDBLK entity). */
-        int id_code
+        uint64_t id_code
                 /*!< Identification number for the entity.\n
                  * This is to be an unique (sequential) number in the DXF
                  * file. */
@@ -391,12 +378,6 @@ dxf_endblk_set_id_code
                   __FUNCTION__);
                 return (NULL);
         }
-        if (id_code < 0)
-        {
-                fprintf (stderr,
-                  (_("Warning in %s () a negative value was passed.\n")),
-                  __FUNCTION__);
-        }
         endblk->id_code = id_code;
 #if DEBUG
         DXF_DEBUG_END
@@ -437,7 +418,7 @@ dxf_endblk_get_layer
                   __FUNCTION__);
                 return (NULL);
         }
-        result = strdup (endblk->layer);
+        result = dxf_strdup (endblk->layer);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -475,7 +456,7 @@ dxf_endblk_set_layer
                   __FUNCTION__);
                 return (NULL);
         }
-        endblk->layer = strdup (layer);
+        endblk->layer = dxf_strdup (layer);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -488,10 +469,8 @@ dxf_endblk_set_layer
  * (a DXF \c ENDBLK entity).
  *
  * \return soft pointer to the object owner.
- *
- * \warning No checks are performed on the returned pointer (string).
  */
-char *
+uint64_t
 dxf_endblk_get_object_owner_soft
 (
         DxfEndblk *endblk
@@ -501,7 +480,7 @@ dxf_endblk_get_object_owner_soft
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        char *result;
+        uint64_t result;
 
         /* Do some basic checks. */
         if (endblk == NULL)
@@ -509,16 +488,9 @@ dxf_endblk_get_object_owner_soft
                 fprintf (stderr,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
-                return (NULL);
+                return (0);
         }
-        if (endblk->object_owner_soft ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
-        result = strdup (endblk->object_owner_soft);
+        result = endblk->object_owner_soft;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -535,8 +507,8 @@ dxf_endblk_set_object_owner_soft
 (
         DxfEndblk *endblk,
                 /*!< a pointer to a DxfEndblk (a DXF \c ENDBLK entity). */
-        char *object_owner_soft
-                /*!< a string containing the pointer to the
+        uint64_t object_owner_soft
+                /*!< the handle of the
                  * \c object_owner_soft for the entity. */
 )
 {
@@ -551,14 +523,7 @@ dxf_endblk_set_object_owner_soft
                   __FUNCTION__);
                 return (NULL);
         }
-        if (object_owner_soft == NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was passed.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
-        endblk->object_owner_soft = strdup (object_owner_soft);
+        endblk->object_owner_soft = object_owner_soft;
 #if DEBUG
         DXF_DEBUG_END
 #endif
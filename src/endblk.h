@@ -75,7 +75,7 @@ extern "C" {
 typedef struct
 dxf_endblk_struct
 {
-        int id_code;
+        uint64_t id_code;
                 /*!< Identification number for the entity.\n
                  * This is to be an unique (sequential) number in the DXF
                  * file.\n
@@ -84,7 +84,7 @@ dxf_endblk_struct
                 /*!< Layer on which the entity is drawn.\n
                  * Defaults to layer "0" if no valid layername is given.\n
                  * Group code = 8. */
-        char *object_owner_soft;
+        uint64_t object_owner_soft;
                 /*!< Soft-pointer ID/handle to owner object
                  * (optional).\n
                  * Group code = 330. */
@@ -96,12 +96,12 @@ DxfEndblk *dxf_endblk_init (DxfEndblk *endblk);
 DxfEndblk *dxf_endblk_read (DxfFile *fp, DxfEndblk *endblk);
 int dxf_endblk_write (DxfFile *fp, DxfEndblk *endblk);
 int dxf_endblk_free (DxfEndblk *endblk);
-int dxf_endblk_get_id_code (DxfEndblk *endblk);
-DxfEndblk *dxf_endblk_set_id_code (DxfEndblk *endblk, int id_code);
+uint64_t dxf_endblk_get_id_code (DxfEndblk *endblk);
+DxfEndblk *dxf_endblk_set_id_code (DxfEndblk *endblk, uint64_t id_code);
 char *dxf_endblk_get_layer (DxfEndblk *endblk);
 DxfEndblk *dxf_endblk_set_layer (DxfEndblk *endblk, char *layer);
-char *dxf_endblk_get_object_owner_soft (DxfEndblk *endblk);
-DxfEndblk *dxf_endblk_set_object_owner_soft (DxfEndblk *endblk, char *object_owner_soft);
+uint64_t dxf_endblk_get_object_owner_soft (DxfEndblk *endblk);
+DxfEndblk *dxf_endblk_set_object_owner_soft (DxfEndblk *endblk, uint64_t object_owner_soft);
 
 
 #ifdef __cplusplus
@@ -42,6 +42,7 @@
 
 
 #include "endtab.h"
+#include "util.h"
 
 
 /*!
@@ -70,7 +71,7 @@ dxf_endtab_write
                 return (EXIT_FAILURE);
         }
         /* Start writing output. */
-        fprintf (fp->fp, "  0\nENDTAB\n");
+        dxf_write_string (fp, 0, "ENDTAB");
 #if DEBUG
         DXF_DEBUG_END
 #endif
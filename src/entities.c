@@ -53,6 +53,272 @@
 
 
 #include "entities.h"
+#include "endsec.h"
+#include "util.h"
+#include "helix.h"
+#include "mesh.h"
+#include "seqend.h"
+#include "spline.h"
+#include "parallel.h"
+#include <stddef.h>
+
+
+/*!
+ * \brief Define the read, write and free wrappers of an entity type for
+ * the dispatch table of the \c ENTITIES section reader and writer.
+ *
+ * The read wrapper allocates and initializes a new entity and reads
+ * it from \c fp, the write wrapper writes it to \c fp, the free
+ * wrapper releases it.
+ */
+#define DXF_ENTITIES_WRAPPERS(type, Type) \
+static void * \
+dxf_entities_dispatch_read_##type (DxfFile *fp) \
+{ \
+        Type *entity = dxf_##type##_init (dxf_##type##_new ()); \
+        if (entity == NULL) \
+        { \
+                return (NULL); \
+        } \
+        if (dxf_##type##_read (fp, entity) == NULL) \
+        { \
+                dxf_##type##_free (entity); \
+                return (NULL); \
+        } \
+        return (entity); \
+} \
+static int \
+dxf_entities_dispatch_write_##type (DxfFile *fp, void *entity) \
+{ \
+        return (dxf_##type##_write (fp, (Type *) entity)); \
+} \
+static int \
+dxf_entities_dispatch_free_##type (void *entity) \
+{ \
+        return (dxf_##type##_free ((Type *) entity)); \
+}
+
+
+/*!
+ * \brief Marker for an entity type without a list in \c DxfEntities.
+ */
+#define DXF_ENTITIES_NO_LIST ((size_t) -1)
+
+
+/* The 3DFACE and 3DSOLID functions return a status instead of a
+ * pointer, their wrappers are written out. */
+static void *
+dxf_entities_dispatch_read_3dface (DxfFile *fp)
+{
+        Dxf3dface *entity = dxf_malloc (sizeof (Dxf3dface));
+
+        if (entity == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () could not allocate memory.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        memset (entity, 0, sizeof (Dxf3dface));
+        dxf_3dface_init (entity);
+        if (dxf_3dface_read (fp, entity) != EXIT_SUCCESS)
+        {
+                dxf_3dface_free (entity);
+                return (NULL);
+        }
+        return (entity);
+}
+static int
+dxf_entities_dispatch_write_3dface (DxfFile *fp, void *entity)
+{
+        return (dxf_3dface_write (fp, (Dxf3dface *) entity));
+}
+static int
+dxf_entities_dispatch_free_3dface (void *entity)
+{
+        return (dxf_3dface_free ((Dxf3dface *) entity));
+}
+static void *
+dxf_entities_dispatch_read_3dsolid (DxfFile *fp)
+{
+        Dxf3dsolid *entity = dxf_malloc (sizeof (Dxf3dsolid));
+
+        if (entity == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () could not allocate memory.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        memset (entity, 0, sizeof (Dxf3dsolid));
+        dxf_3dsolid_init (entity);
+        if (dxf_3dsolid_read (fp, entity) != EXIT_SUCCESS)
+        {
+                dxf_3dsolid_free (entity);
+                return (NULL);
+        }
+        return (entity);
+}
+static int
+dxf_entities_dispatch_write_3dsolid (DxfFile *fp, void *entity)
+{
+        return (dxf_3dsolid_write (fp, (Dxf3dsolid *) entity));
+}
+static int
+dxf_entities_dispatch_free_3dsolid (void *entity)
+{
+        return (dxf_3dsolid_free ((Dxf3dsolid *) entity));
+}
+DXF_ENTITIES_WRAPPERS (acad_proxy_entity, DxfAcadProxyEntity)
+DXF_ENTITIES_WRAPPERS (table, DxfTable)
+DXF_ENTITIES_WRAPPERS (arc, DxfArc)
+DXF_ENTITIES_WRAPPERS (attdef, DxfAttdef)
+DXF_ENTITIES_WRAPPERS (attrib, DxfAttrib)
+DXF_ENTITIES_WRAPPERS (body, DxfBody)
+DXF_ENTITIES_WRAPPERS (circle, DxfCircle)
+DXF_ENTITIES_WRAPPERS (dimension, DxfDimension)
+DXF_ENTITIES_WRAPPERS (ellipse, DxfEllipse)
+DXF_ENTITIES_WRAPPERS (helix, DxfHelix)
+DXF_ENTITIES_WRAPPERS (image, DxfImage)
+DXF_ENTITIES_WRAPPERS (insert, DxfInsert)
+DXF_ENTITIES_WRAPPERS (leader, DxfLeader)
+DXF_ENTITIES_WRAPPERS (light, DxfLight)
+DXF_ENTITIES_WRAPPERS (line, DxfLine)
+DXF_ENTITIES_WRAPPERS (lwpolyline, DxfLWPolyline)
+DXF_ENTITIES_WRAPPERS (mesh, DxfMesh)
+DXF_ENTITIES_WRAPPERS (mline, DxfMline)
+DXF_ENTITIES_WRAPPERS (mtext, DxfMtext)
+DXF_ENTITIES_WRAPPERS (ole2frame, DxfOle2Frame)
+DXF_ENTITIES_WRAPPERS (oleframe, DxfOleFrame)
+DXF_ENTITIES_WRAPPERS (point, DxfPoint)
+DXF_ENTITIES_WRAPPERS (polyline, DxfPolyline)
+DXF_ENTITIES_WRAPPERS (ray, DxfRay)
+DXF_ENTITIES_WRAPPERS (region, DxfRegion)
+DXF_ENTITIES_WRAPPERS (seqend, DxfSeqend)
+DXF_ENTITIES_WRAPPERS (shape, DxfShape)
+DXF_ENTITIES_WRAPPERS (solid, DxfSolid)
+DXF_ENTITIES_WRAPPERS (spline, DxfSpline)
+DXF_ENTITIES_WRAPPERS (text, DxfText)
+DXF_ENTITIES_WRAPPERS (tolerance, DxfTolerance)
+DXF_ENTITIES_WRAPPERS (trace, DxfTrace)
+DXF_ENTITIES_WRAPPERS (vertex, DxfVertex)
+DXF_ENTITIES_WRAPPERS (viewport, DxfViewport)
+DXF_ENTITIES_WRAPPERS (xline, DxfXLine)
+
+
+/*!
+ * \brief Dispatch table of the \c ENTITIES section reader.
+ *
+ * Sorted on \c name for bsearch ().
+ */
+static const struct dxf_entities_reader_struct
+{
+        const char *name;
+                /*!< Entity type name as found after group code 0. */
+        void *(*read) (DxfFile *fp);
+                /*!< Allocate, initialize and read an entity. */
+        int (*write) (DxfFile *fp, void *entity);
+                /*!< Write an entity. */
+        int (*free) (void *entity);
+                /*!< Free an entity. */
+        size_t list_offset;
+                /*!< Offset of the list in \c DxfEntities, or
+                 * \c DXF_ENTITIES_NO_LIST. */
+        size_t next_offset;
+                /*!< Offset of the \c next member in the entity, only
+                 * used for types with a list. */
+        size_t id_code_offset;
+                /*!< Offset of the \c id_code member in the entity,
+                 * only used for types with a list. */
+        size_t layer_offset;
+                /*!< Offset of the \c layer member in the entity,
+                 * only used for types with a list. */
+} dxf_entities_readers[] =
+{
+#define DXF_ENTITIES_READER(name, type, Type, list) \
+        {name, dxf_entities_dispatch_read_##type, dxf_entities_dispatch_write_##type, \
+          dxf_entities_dispatch_free_##type, \
+          offsetof (DxfEntities, list), offsetof (Type, next), \
+          offsetof (Type, id_code), offsetof (Type, layer)}
+#define DXF_ENTITIES_READER_NO_LIST(name, type) \
+        {name, dxf_entities_dispatch_read_##type, dxf_entities_dispatch_write_##type, \
+          dxf_entities_dispatch_free_##type, \
+          DXF_ENTITIES_NO_LIST, 0, 0, 0}
+        DXF_ENTITIES_READER ("3DFACE", 3dface, Dxf3dface, dface_list),
+        DXF_ENTITIES_READER ("3DSOLID", 3dsolid, Dxf3dsolid, dsolid_list),
+        DXF_ENTITIES_READER ("ACAD_PROXY_ENTITY", acad_proxy_entity, DxfAcadProxyEntity, acad_proxy_entity_list),
+        DXF_ENTITIES_READER ("ACAD_TABLE", table, DxfTable, table_list),
+        DXF_ENTITIES_READER ("ARC", arc, DxfArc, arc_list),
+        DXF_ENTITIES_READER ("ATTDEF", attdef, DxfAttdef, attdef_list),
+        DXF_ENTITIES_READER ("ATTRIB", attrib, DxfAttrib, attrib_list),
+        DXF_ENTITIES_READER ("BODY", body, DxfBody, body_list),
+        DXF_ENTITIES_READER ("CIRCLE", circle, DxfCircle, circle_list),
+        DXF_ENTITIES_READER ("DIMENSION", dimension, DxfDimension, dimension_list),
+        DXF_ENTITIES_READER ("ELLIPSE", ellipse, DxfEllipse, ellipse_list),
+        DXF_ENTITIES_READER ("HELIX", helix, DxfHelix, helix_list),
+        DXF_ENTITIES_READER ("IMAGE", image, DxfImage, image_list),
+        DXF_ENTITIES_READER ("INSERT", insert, DxfInsert, insert_list),
+        DXF_ENTITIES_READER ("LEADER", leader, DxfLeader, leader_list),
+        DXF_ENTITIES_READER ("LIGHT", light, DxfLight, light_list),
+        DXF_ENTITIES_READER ("LINE", line, DxfLine, line_list),
+        DXF_ENTITIES_READER ("LWPOLYLINE", lwpolyline, DxfLWPolyline, lw_polyline_list),
+        DXF_ENTITIES_READER_NO_LIST ("MESH", mesh),
+        DXF_ENTITIES_READER ("MLINE", mline, DxfMline, mline_list),
+        DXF_ENTITIES_READER ("MTEXT", mtext, DxfMtext, mtext_list),
+        DXF_ENTITIES_READER ("OLE2FRAME", ole2frame, DxfOle2Frame, ole2frame_list),
+        DXF_ENTITIES_READER ("OLEFRAME", oleframe, DxfOleFrame, oleframe_list),
+        DXF_ENTITIES_READER ("POINT", point, DxfPoint, point_list),
+        DXF_ENTITIES_READER ("POLYLINE", polyline, DxfPolyline, polyline_list),
+        DXF_ENTITIES_READER ("RAY", ray, DxfRay, ray_list),
+        DXF_ENTITIES_READER ("REGION", region, DxfRegion, region_list),
+        DXF_ENTITIES_READER_NO_LIST ("SEQEND", seqend),
+        DXF_ENTITIES_READER ("SHAPE", shape, DxfShape, shape_list),
+        DXF_ENTITIES_READER ("SOLID", solid, DxfSolid, solid_list),
+        DXF_ENTITIES_READER ("SPLINE", spline, DxfSpline, spline_list),
+        DXF_ENTITIES_READER ("TEXT", text, DxfText, text_list),
+        DXF_ENTITIES_READER ("TOLERANCE", tolerance, DxfTolerance, tolerance_list),
+        DXF_ENTITIES_READER ("TRACE", trace, DxfTrace, trace_list),
+        DXF_ENTITIES_READER ("VERTEX", vertex, DxfVertex, vertex_list),
+        DXF_ENTITIES_READER ("VIEWPORT", viewport, DxfViewport, viewport_list),
+        DXF_ENTITIES_READER_NO_LIST ("XLINE", xline)
+#undef DXF_ENTITIES_READER
+#undef DXF_ENTITIES_READER_NO_LIST
+};
+
+
+/*!
+ * \brief Compare a name with an entry of the dispatch table, for
+ * bsearch ().
+ */
+static int
+dxf_entities_reader_compare
+(
+        const void *name,
+        const void *reader
+)
+{
+        return (strcmp ((const char *) name,
+          ((const struct dxf_entities_reader_struct *) reader)->name));
+}
+
+
+/*!
+ * \brief Find the dispatch table entry for an entity type name.
+ *
+ * \return a pointer to the entry, or \c NULL for an unsupported
+ * entity type.
+ */
+static const struct dxf_entities_reader_struct *
+dxf_entities_find_reader
+(
+        const char *name
+                /*!< Entity type name. */
+)
+{
+        return (bsearch (name, dxf_entities_readers,
+          sizeof (dxf_entities_readers) / sizeof (dxf_entities_readers[0]),
+          sizeof (dxf_entities_readers[0]), dxf_entities_reader_compare));
+}
 
 
 /*!
@@ -72,7 +338,7 @@ dxf_entities_new ()
         size = sizeof (DxfEntities);
         /* avoid malloc of 0 bytes */
         if (size == 0) size = 1;
-        if ((entities = malloc (size)) == NULL)
+        if ((entities = dxf_malloc (size)) == NULL)
         {
                 fprintf (stderr,
                   (_("Error in %s () could not allocate memory.\n")),
@@ -420,54 +686,1279 @@ dxf_entities_init
 
 
 /*!
- * \brief Read and parse the \c ENTITIES table from a DXF file.
+ * \brief Context of dxf_entities_read_table () for appending entities
+ * to the lists of a \c DxfEntities.
+ */
+typedef struct
+dxf_entities_append_struct
+{
+        DxfEntities *entities;
+                /*!< Entities section to append to. */
+        void *tails[sizeof (dxf_entities_readers) / sizeof (dxf_entities_readers[0])];
+                /*!< Last entity of each list, \c NULL when not known
+                 * yet. */
+} DxfEntitiesAppend;
+
+
+/*!
+ * \brief Append a linked list of entities of one type, from \c first
+ * up to and including \c last, to the list for that type.
+ */
+static void
+dxf_entities_append_list
+(
+        DxfEntitiesAppend *append,
+                /*!< Context to append to. */
+        const struct dxf_entities_reader_struct *reader,
+                /*!< Dispatch table entry of the entity type. */
+        void *first,
+                /*!< First entity to append. */
+        void *last
+                /*!< Last entity to append. */
+)
+{
+        void **head;
+        void **tail;
+
+        head = (void **) ((char *) append->entities + reader->list_offset);
+        tail = &append->tails[reader - dxf_entities_readers];
+        if (*tail == NULL)
+        {
+                /* Find the end of a list which was not empty when
+                 * reading started, only once per list. */
+                *tail = *head;
+                while ((*tail != NULL)
+                  && (*(void **) ((char *) *tail + reader->next_offset) != NULL))
+                {
+                        *tail = *(void **) ((char *) *tail + reader->next_offset);
+                }
+        }
+        if (*tail == NULL)
+        {
+                *head = first;
+        }
+        else
+        {
+                *(void **) ((char *) *tail + reader->next_offset) = first;
+        }
+        *tail = last;
+}
+
+
+/*!
+ * \brief Callback of dxf_entities_read_table () appending an entity to
+ * the list for its type.
+ *
+ * Entities of a type without a list in \c DxfEntities are freed.
+ */
+static int
+dxf_entities_append
+(
+        const char *type,
+        void *entity,
+        void *user_data
+)
+{
+        DxfEntitiesAppend *append = (DxfEntitiesAppend *) user_data;
+        const struct dxf_entities_reader_struct *reader;
+
+        reader = dxf_entities_find_reader (type);
+        if (reader->list_offset == DXF_ENTITIES_NO_LIST)
+        {
+                return (reader->free (entity));
+        }
+        dxf_entities_append_list (append, reader, entity, entity);
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Read the entity type name following a group code 0 into
+ * \c name.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when no name
+ * could be read.
+ */
+static int
+dxf_entities_read_name
+(
+        DxfFile *fp,
+                /*!< DXF file pointer to an input file (or device). */
+        char *name
+                /*!< Buffer of \c DXF_MAX_STRING_LENGTH characters. */
+)
+{
+        const char *value;
+        size_t length;
+
+        if (dxf_read_string_view (fp, &value, &length) == EXIT_FAILURE)
+        {
+                return (EXIT_FAILURE);
+        }
+        if (length >= DXF_MAX_STRING_LENGTH)
+        {
+                length = DXF_MAX_STRING_LENGTH - 1;
+        }
+        memcpy (name, value, length);
+        name[length] = '\0';
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Read the \c VERTEX entities following a \c POLYLINE entity
+ * into the list of vertices of \c polyline.
+ *
+ * The vertices replace the vertex allocated by dxf_polyline_init (),
+ * the \c SEQEND marker ending the sequence is read and freed.\n
+ * When another entity follows the last vertex (no \c SEQEND marker),
+ * it's type name is returned in \c name and \c have_name is set.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+static int
+dxf_entities_read_vertices
+(
+        DxfFile *fp,
+                /*!< DXF file pointer to an input file (or device). */
+        DxfPolyline *polyline,
+                /*!< a pointer to the \c POLYLINE entity just read. */
+        int *group_code,
+                /*!< The last group code read, updated. */
+        char *name,
+                /*!< Returns the type name of the entity following the
+                 * sequence. */
+        int *have_name
+                /*!< Returns \c TRUE when \c name was read. */
+)
+{
+        DxfVertex *vertex;
+        DxfVertex *tail = NULL;
+        void *seqend;
+
+        *have_name = FALSE;
+        while ((*group_code == 0)
+          && (dxf_entities_read_name (fp, name) == EXIT_SUCCESS))
+        {
+                if (strcmp (name, "VERTEX") == 0)
+                {
+                        vertex = (DxfVertex *) dxf_entities_dispatch_read_vertex (fp);
+                        if (vertex == NULL)
+                        {
+                                fprintf (stderr,
+                                  (_("Error in %s () could not read entity %s from: %s in line: %d.\n")),
+                                  __FUNCTION__, name, fp->filename, fp->line_number);
+                                return (EXIT_FAILURE);
+                        }
+                        if (tail == NULL)
+                        {
+                                dxf_vertex_free_list (polyline->vertices);
+                                polyline->vertices = vertex;
+                        }
+                        else
+                        {
+                                tail->next = (struct DxfVertex *) vertex;
+                        }
+                        tail = vertex;
+                }
+                else if (strcmp (name, "SEQEND") == 0)
+                {
+                        seqend = dxf_entities_dispatch_read_seqend (fp);
+                        if (seqend == NULL)
+                        {
+                                fprintf (stderr,
+                                  (_("Error in %s () could not read entity %s from: %s in line: %d.\n")),
+                                  __FUNCTION__, name, fp->filename, fp->line_number);
+                                return (EXIT_FAILURE);
+                        }
+                        dxf_entities_dispatch_free_seqend (seqend);
+                        *group_code = fp->reader->group_code;
+                        break;
+                }
+                else
+                {
+                        *have_name = TRUE;
+                        break;
+                }
+                *group_code = fp->reader->group_code;
+        }
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Read the entities of a \c DxfFile up to an end marker
+ * (\c ENDSEC or \c ENDBLK), or up to the end of a range of the
+ * \c ENTITIES section.
+ *
+ * A range (\c range is \c TRUE) ends after the group code 0 of the
+ * entity following the range.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred or the callback stopped reading.
+ */
+static int
+dxf_entities_read_entities
+(
+        DxfFile *fp,
+                /*!< DXF file pointer to an input file (or device). */
+        DxfEntityCallback on_entity,
+                /*!< Function called for every entity read, may be
+                 * \c NULL. */
+        void *user_data,
+                /*!< Pointer passed to \c on_entity. */
+        int range,
+                /*!< \c fp holds a range of the section. */
+        const char *marker
+                /*!< Entity type name of the end marker. */
+)
+{
+        char name[DXF_MAX_STRING_LENGTH];
+        const char *value;
+        size_t length;
+        int group_code;
+        int have_name = FALSE;
+        const struct dxf_entities_reader_struct *reader;
+        void *entity;
+
+        if (dxf_read_group_code (fp, &group_code) == EXIT_FAILURE)
+        {
+                group_code = -1;
+        }
+        for (;;)
+        {
+                if ((!have_name)
+                  && ((group_code != 0)
+                  || (dxf_entities_read_name (fp, name) == EXIT_FAILURE)))
+                {
+                        if (range && (group_code == 0) && dxf_read_eof (fp))
+                        {
+                                break;
+                        }
+                        fprintf (stderr,
+                          (_("Error in %s () %s expected while reading from: %s in line: %d.\n")),
+                          __FUNCTION__, marker, fp->filename, fp->line_number);
+                        return (EXIT_FAILURE);
+                }
+                have_name = FALSE;
+                if (strcmp (name, marker) == 0)
+                {
+                        break;
+                }
+                reader = dxf_entities_find_reader (name);
+                if (reader == NULL)
+                {
+                        fprintf (stderr,
+                          (_("Warning in %s () unsupported entity %s skipped in line: %d.\n")),
+                          __FUNCTION__, name, fp->line_number);
+                        /* Skip the pairs up to the next group code 0. */
+                        while ((dxf_read_group_code (fp, &group_code) == EXIT_SUCCESS)
+                          && (group_code != 0))
+                        {
+                                dxf_read_string_view (fp, &value, &length);
+                        }
+                        if (dxf_read_error (fp))
+                        {
+                                return (EXIT_FAILURE);
+                        }
+                        continue;
+                }
+                entity = reader->read (fp);
+                if (entity == NULL)
+                {
+                        fprintf (stderr,
+                          (_("Error in %s () could not read entity %s from: %s in line: %d.\n")),
+                          __FUNCTION__, name, fp->filename, fp->line_number);
+                        return (EXIT_FAILURE);
+                }
+                /* The entity reader stopped after the group code 0 of
+                 * the next entity, or at the end of the file. */
+                group_code = fp->reader->group_code;
+                if ((reader->read == dxf_entities_dispatch_read_polyline)
+                  && (dxf_entities_read_vertices (fp, (DxfPolyline *) entity,
+                  &group_code, name, &have_name) == EXIT_FAILURE))
+                {
+                        reader->free (entity);
+                        return (EXIT_FAILURE);
+                }
+                if (on_entity == NULL)
+                {
+                        reader->free (entity);
+                }
+                else if (on_entity (reader->name, entity, user_data) != EXIT_SUCCESS)
+                {
+                        return (EXIT_FAILURE);
+                }
+        }
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Read and parse the \c ENTITIES section from a DXF file,
+ * handing every entity to a callback.
+ *
+ * The last line read from file contained the string "ENTITIES".\n
+ * Every entity found up to the \c ENDSEC marker is allocated,
+ * initialized and read with the matching \c dxf_<type>_read ()
+ * function and then passed to \c on_entity together with its type
+ * name (for example "LINE") and \c user_data.\n
+ * The \c VERTEX entities following a \c POLYLINE entity are read into
+ * it's list of vertices and the \c SEQEND marker is freed, the
+ * \c POLYLINE entity is passed with it's vertices.\n
+ * The callback takes ownership of the entity and can process and free
+ * it (see dxf_entities_free_entity ()) before the next entity is read,
+ * so a section of any size is processed in constant memory.\n
+ * The callback returns \c EXIT_SUCCESS to continue reading, any other
+ * value stops reading.\n
+ * With a \c NULL callback every entity is freed right after reading,
+ * which validates and skips the section.\n
+ * Entities of an unsupported type are skipped with a warning.
+ *
+ * \return \c EXIT_SUCCESS when the \c ENDSEC marker was read, or
+ * \c EXIT_FAILURE when an error occurred or the callback stopped
+ * reading.
+ */
+int
+dxf_entities_read_callback
+(
+        DxfFile *fp,
+                /*!< DXF file pointer to an input file (or device). */
+        DxfEntityCallback on_entity,
+                /*!< Function called for every entity read, may be
+                 * \c NULL. */
+        void *user_data
+                /*!< Pointer passed to \c on_entity. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        int result;
+
+        /* Do some basic checks. */
+        if (fp == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL file pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        result = dxf_entities_read_entities (fp, on_entity, user_data, FALSE, "ENDSEC");
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (result);
+}
+
+
+/*!
+ * \brief Definition of a range of the \c ENTITIES section, read by a
+ * worker thread of dxf_entities_read_table ().
+ */
+typedef struct
+dxf_entities_range_struct
+{
+        DxfFile *fp;
+                /*!< The memory mapped DXF file being read. */
+        size_t start;
+                /*!< Offset of the group code 0 line of the first entity
+                 * in the range. */
+        size_t end;
+                /*!< Offset past the group code 0 line of the entity
+                 * following the range. */
+        int line_number;
+                /*!< Number of the line before \c start. */
+        DxfEntities entities;
+                /*!< Entities read from the range. */
+        DxfEntitiesAppend append;
+                /*!< Context for appending to \c entities. */
+        DxfArena *arena;
+                /*!< Arena the range is read into, merged into the
+                 * current arena of the calling thread when spliced,
+                 * \c NULL to read into the heap. */
+        DxfStringPool *string_pool;
+                /*!< Cache of the string pool of the file, \c NULL when
+                 * strings are not interned. */
+        int spliced;
+                /*!< \c entities were moved to the section. */
+} DxfEntitiesRange;
+
+
+/*!
+ * \brief Set up a \c DxfFile reading a part of a memory mapped DXF
+ * file in place, with a reader of its own.
+ */
+static void
+dxf_entities_init_view
+(
+        DxfFile *view,
+                /*!< a pointer to the \c DxfFile to set up. */
+        DxfReader *reader,
+                /*!< a pointer to the \c DxfReader of \c view. */
+        DxfFile *fp,
+                /*!< DXF file pointer to a memory mapped input file. */
+        size_t start,
+                /*!< Offset of the first byte to read. */
+        size_t end,
+                /*!< Offset past the last byte to read. */
+        int line_number
+                /*!< Number of the line before \c start. */
+)
+{
+        memset (reader, 0, sizeof (DxfReader));
+        reader->buffer = fp->reader->buffer;
+        reader->size = end;
+        reader->start = start;
+        reader->end = end;
+        reader->eof = TRUE;
+        reader->mapped = TRUE;
+        reader->mapping = fp->reader->mapping;
+        memset (view, 0, sizeof (DxfFile));
+        view->reader = reader;
+        view->filename = fp->filename;
+        view->line_number = line_number;
+        view->acad_version_number = fp->acad_version_number;
+        view->follow_strict_version_rules = fp->follow_strict_version_rules;
+        view->number_threads = 1;
+}
+
+
+/*!
+ * \brief Split the rest of the \c ENTITIES section of a memory mapped
+ * ASCII DXF file into ranges of at least \c DXF_READER_CHUNK_SIZE
+ * bytes.
+ *
+ * Every range starts at the group code 0 line of an entity, never at
+ * a \c VERTEX or \c SEQEND entity of a \c POLYLINE.\n
+ * The lines are only split (see dxf_reader_index_lines ()) and checked
+ * for group code 0 pairs, no entity is parsed.
+ *
+ * \return a pointer to the allocated ranges, or \c NULL when the
+ * \c ENDSEC marker was not found or no memory was allocated.
+ */
+static DxfEntitiesRange *
+dxf_entities_split
+(
+        DxfFile *fp,
+                /*!< DXF file pointer to a memory mapped input file. */
+        size_t *number_ranges,
+                /*!< Returns the number of ranges. */
+        size_t *end_pair,
+                /*!< Returns the offset of the group code 0 line before
+                 * the \c ENDSEC line. */
+        size_t *end,
+                /*!< Returns the offset past the \c ENDSEC line. */
+        int *end_line
+                /*!< Returns the number of the \c ENDSEC line. */
+)
+{
+        DxfEntitiesRange *ranges = NULL;
+        DxfEntitiesRange *new_ranges;
+        DxfReader reader;
+        DxfFile view;
+        const char *line;
+        const char *value;
+        size_t length;
+        size_t size = 0;
+        size_t pos;
+        size_t range_start;
+        int range_line;
+        int line_number;
+        int endsec;
+        long long code;
+
+        *number_ranges = 0;
+        dxf_entities_init_view (&view, &reader, fp, fp->reader->start,
+          fp->reader->end, fp->line_number);
+        range_start = reader.start;
+        range_line = view.line_number;
+        for (;;)
+        {
+                pos = reader.start;
+                line_number = view.line_number;
+                if ((dxf_reader_next_line (&view, &line, &length) == EXIT_FAILURE)
+                  || (dxf_reader_parse_long (line, length, 10, &code) == EXIT_FAILURE)
+                  || (dxf_reader_next_line (&view, &value, &length) == EXIT_FAILURE))
+                {
+                        break;
+                }
+                if (code != 0)
+                {
+                        continue;
+                }
+                endsec = ((length == 6) && (memcmp (value, "ENDSEC", 6) == 0));
+                if ((!endsec) && (pos - range_start < DXF_READER_CHUNK_SIZE))
+                {
+                        continue;
+                }
+                if (((length == 6) && (memcmp (value, "VERTEX", 6) == 0))
+                  || ((length == 6) && (memcmp (value, "SEQEND", 6) == 0)))
+                {
+                        /* Keep the vertices with their polyline. */
+                        continue;
+                }
+                if (*number_ranges == size)
+                {
+                        new_ranges = realloc (ranges, 2 * (size + 8) * sizeof (DxfEntitiesRange));
+                        if (new_ranges == NULL)
+                        {
+                                fprintf (stderr,
+                                  (_("Error in %s () could not allocate memory.\n")),
+                                  __FUNCTION__);
+                                break;
+                        }
+                        ranges = new_ranges;
+                        size = 2 * (size + 8);
+                }
+                memset (&ranges[*number_ranges], 0, sizeof (DxfEntitiesRange));
+                ranges[*number_ranges].fp = fp;
+                ranges[*number_ranges].start = range_start;
+                ranges[*number_ranges].end = value - reader.buffer;
+                ranges[*number_ranges].line_number = range_line;
+                (*number_ranges)++;
+                if (endsec)
+                {
+                        *end_pair = pos;
+                        *end = reader.start;
+                        *end_line = view.line_number;
+                        return (ranges);
+                }
+                range_start = pos;
+                range_line = line_number;
+        }
+        free (ranges);
+        *number_ranges = 0;
+        return (NULL);
+}
+
+
+/*!
+ * \brief Task of dxf_entities_read_table (), reading the entities of a
+ * range in a worker thread.
+ *
+ * The range is read in place from the memory map, into the arena and
+ * through the string pool cache of the range.
+ */
+static int
+dxf_entities_read_range
+(
+        void *item
+                /*!< a pointer to the \c DxfEntitiesRange. */
+)
+{
+        DxfEntitiesRange *range = (DxfEntitiesRange *) item;
+        DxfArena *previous = NULL;
+        DxfReader reader;
+        DxfFile view;
+        int result;
+
+        dxf_entities_init_view (&view, &reader, range->fp, range->start,
+          range->end, range->line_number);
+        view.string_pool = range->string_pool;
+        range->append.entities = &range->entities;
+        if (range->arena != NULL)
+        {
+                previous = dxf_arena_set_current (range->arena);
+        }
+        result = dxf_entities_read_entities (&view, dxf_entities_append,
+          &range->append, TRUE, "ENDSEC");
+        if (range->arena != NULL)
+        {
+                dxf_arena_set_current (previous);
+        }
+        return (result);
+}
+
+
+/*!
+ * \brief Callback of dxf_entities_read_table (), moving the entities
+ * of a range to the lists of the section, in file order.
+ */
+static int
+dxf_entities_splice_range
+(
+        void *item,
+                /*!< a pointer to the \c DxfEntitiesRange. */
+        void *user_data
+                /*!< a pointer to the \c DxfEntitiesAppend of the
+                 * section. */
+)
+{
+        DxfEntitiesRange *range = (DxfEntitiesRange *) item;
+        const struct dxf_entities_reader_struct *reader;
+        void *first;
+        size_t i;
+
+        /* The entities of the range now belong to the arena of the
+         * section. */
+        if ((range->arena != NULL)
+          && (dxf_arena_merge (dxf_arena_get_current (), range->arena) == EXIT_FAILURE))
+        {
+                return (EXIT_FAILURE);
+        }
+        range->arena = NULL;
+        for (i = 0; i < sizeof (dxf_entities_readers) / sizeof (dxf_entities_readers[0]); i++)
+        {
+                reader = &dxf_entities_readers[i];
+                if (reader->list_offset == DXF_ENTITIES_NO_LIST)
+                {
+                        continue;
+                }
+                first = *(void **) ((char *) &range->entities + reader->list_offset);
+                if (first != NULL)
+                {
+                        dxf_entities_append_list ((DxfEntitiesAppend *) user_data,
+                          reader, first, range->append.tails[i]);
+                }
+        }
+        range->spliced = TRUE;
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Free the entities of a range which were not moved to the
+ * section after an error.
+ */
+static void
+dxf_entities_free_range
+(
+        DxfEntitiesRange *range
+                /*!< a pointer to the \c DxfEntitiesRange. */
+)
+{
+        const struct dxf_entities_reader_struct *reader;
+        void *entity;
+        void *next;
+        size_t i;
+
+        for (i = 0; i < sizeof (dxf_entities_readers) / sizeof (dxf_entities_readers[0]); i++)
+        {
+                reader = &dxf_entities_readers[i];
+                if (reader->list_offset == DXF_ENTITIES_NO_LIST)
+                {
+                        continue;
+                }
+                entity = *(void **) ((char *) &range->entities + reader->list_offset);
+                while (entity != NULL)
+                {
+                        next = *(void **) ((char *) entity + reader->next_offset);
+                        /* The free functions refuse an entity which is
+                         * still linked. */
+                        *(void **) ((char *) entity + reader->next_offset) = NULL;
+                        reader->free (entity);
+                        entity = next;
+                }
+        }
+}
+
+
+/*!
+ * \brief Free the arenas not merged into the section and the string
+ * pool caches of the ranges of dxf_entities_read_table ().
+ *
+ * The entities of ranges which were not spliced have to be freed with
+ * dxf_entities_free_range () first.
+ */
+static void
+dxf_entities_free_range_resources
+(
+        DxfEntitiesRange *ranges,
+                /*!< a pointer to the ranges. */
+        size_t number_ranges
+                /*!< Number of ranges. */
+)
+{
+        size_t i;
+
+        for (i = 0; i < number_ranges; i++)
+        {
+                if (ranges[i].arena != NULL)
+                {
+                        dxf_arena_free (ranges[i].arena);
+                        ranges[i].arena = NULL;
+                }
+                if (ranges[i].string_pool != NULL)
+                {
+                        dxf_string_pool_free (ranges[i].string_pool);
+                        ranges[i].string_pool = NULL;
+                }
+        }
+}
+
+
+/*!
+ * \brief Read and parse the \c ENTITIES section from a DXF file into
+ * the lists of a \c DxfEntities.
+ *
+ * The last line read from file contained the string "ENTITIES".\n
+ * Entities are appended to the list for their type, in file order,
+ * the vertices of a \c POLYLINE entity to it's list of vertices.\n
+ * Entities of a type without a list in \c DxfEntities (\c MESH,
+ * \c SEQEND and \c XLINE) are freed after reading, use
+ * dxf_entities_read_callback () to receive them.\n
+ * When more than one thread was set with dxf_read_set_number_threads ()
+ * for a memory mapped ASCII DXF file, the section is first split at
+ * entity boundaries into ranges of at least \c DXF_READER_CHUNK_SIZE
+ * bytes, the ranges are then read concurrently by worker threads and
+ * their entities are appended to the lists in file order, giving the
+ * same lists as reading in the calling thread.\n
+ * When the calling thread has a current arena (see
+ * dxf_arena_set_current ()) every range is read into an arena of it's
+ * own, which is merged into the current arena when the range is
+ * spliced.\n
+ * When \c fp has a string pool (see dxf_read_set_string_pool ()) the
+ * workers intern through a cache of their own (see
+ * dxf_string_pool_new_cache ()), so every name is still interned once,
+ * in the string pool of \c fp.\n
+ * After an error the entities of the ranges before the failing range
+ * are kept.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
  */
 int
 dxf_entities_read_table
 (
-        char *filename,
-                /*!< filename of input file (or device). */
-        FILE *fp,
-                /*!< filepointer to the input file (or device). */
-        int line_number,
-                /*!< current line number in the input file (or device). */
-        char *dxf_entities_list,
-                /*!< pointer to a list of entities. */
-        int acad_version_number
-                /*!< AutoCAD DXF version number. */
+        DxfFile *fp,
+                /*!< DXF file pointer to an input file (or device). */
+        DxfEntities *entities
+                /*!< Pointer to the DXF \c ENTITIES section. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfEntitiesAppend append;
+        DxfEntitiesRange *ranges = NULL;
+        DxfArena *arena;
+        size_t number_ranges = 0;
+        size_t end_pair = 0;
+        size_t end = 0;
+        size_t i;
+        int end_line = 0;
+        int number_threads;
+        int result;
+
+        /* Do some basic checks. */
+        if (fp == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL file pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        if (entities == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        memset (&append, 0, sizeof (append));
+        append.entities = entities;
+        number_threads = fp->number_threads;
+        if (number_threads == 0)
+        {
+                number_threads = dxf_parallel_get_number_threads ();
+        }
+        arena = dxf_arena_get_current ();
+        if ((number_threads > 1)
+          && (fp->reader != NULL)
+          && (fp->reader->mapped)
+          && (!fp->reader->binary))
+        {
+                ranges = dxf_entities_split (fp, &number_ranges, &end_pair, &end, &end_line);
+        }
+        /* Every worker gets an arena and a string pool cache of it's
+         * own, read in the calling thread when they can not be
+         * allocated. */
+        for (i = 0; (i < number_ranges) && (number_ranges > 1); i++)
+        {
+                if (((arena != NULL)
+                  && ((ranges[i].arena = dxf_arena_new (arena->chunk_size)) == NULL))
+                  || ((fp->string_pool != NULL)
+                  && ((ranges[i].string_pool = dxf_string_pool_new_cache (fp->string_pool)) == NULL)))
+                {
+                        dxf_entities_free_range_resources (ranges, number_ranges);
+                        number_ranges = 0;
+                }
+        }
+        if (number_ranges > 1)
+        {
+                result = dxf_parallel_map (ranges, sizeof (DxfEntitiesRange),
+                  number_ranges, number_threads, dxf_entities_read_range,
+                  dxf_entities_splice_range, &append);
+                for (i = 0; i < number_ranges; i++)
+                {
+                        if (!ranges[i].spliced)
+                        {
+                                dxf_entities_free_range (&ranges[i]);
+                        }
+                }
+                dxf_entities_free_range_resources (ranges, number_ranges);
+                if (result == EXIT_SUCCESS)
+                {
+                        /* Continue after the ENDSEC marker, as if the
+                         * section was read in this thread. */
+                        fp->reader->pair_start = end_pair;
+                        fp->reader->pair_lines = 2;
+                        fp->reader->start = end;
+                        fp->reader->group_code = 0;
+                        fp->line_number = end_line;
+                }
+        }
+        else
+        {
+                result = dxf_entities_read_callback (fp, dxf_entities_append, &append);
+        }
+        free (ranges);
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (result);
+}
+
+
+/*!
+ * \brief Read the entities of a block definition from the \c BLOCKS
+ * section of a DXF file into the lists of a \c DxfEntities.
+ *
+ * The next line to read is the group code 0 of the first entity
+ * following the \c BLOCK entity.\n
+ * Entities are appended to the list for their type, in file order, up
+ * to the \c ENDBLK marker, the vertices of a \c POLYLINE entity to
+ * it's list of vertices, the last line read contains the string
+ * "ENDBLK".
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_entities_read_block
+(
+        DxfFile *fp,
+                /*!< DXF file pointer to an input file (or device). */
+        DxfEntities *entities
+                /*!< Pointer to the entities of the block definition. */
 )
 {
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        /*! \todo Add code here. */
+        DxfEntitiesAppend append;
+        int result;
+
+        /* Do some basic checks. */
+        if (fp == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL file pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        if (entities == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        memset (&append, 0, sizeof (append));
+        append.entities = entities;
+        result = dxf_entities_read_entities (fp, dxf_entities_append, &append, FALSE, "ENDBLK");
 #if DEBUG
         DXF_DEBUG_END
 #endif
+        return (result);
+}
+
+
+/*!
+ * \brief Free an entity handed out by dxf_entities_read_callback ().
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_entities_free_entity
+(
+        const char *type,
+                /*!< Entity type name as passed to the callback. */
+        void *entity
+                /*!< Pointer to the entity. */
+)
+{
+        const struct dxf_entities_reader_struct *reader;
+
+        /* Do some basic checks. */
+        if ((type == NULL) || (entity == NULL))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        reader = dxf_entities_find_reader (type);
+        if (reader == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () unsupported entity %s.\n")),
+                  __FUNCTION__, type);
+                return (EXIT_FAILURE);
+        }
+        return (reader->free (entity));
+}
+
+
+/*!
+ * \brief Get the handle (\c id_code) of an entity.
+ *
+ * \return the \c id_code of the entity, or 0 for an entity of a type
+ * without a list in \c DxfEntities.
+ */
+uint64_t
+dxf_entities_get_entity_id_code
+(
+        const char *type,
+                /*!< Entity type name, for example "LINE". */
+        void *entity
+                /*!< Pointer to the entity. */
+)
+{
+        const struct dxf_entities_reader_struct *reader;
+
+        /* Do some basic checks. */
+        if ((type == NULL) || (entity == NULL))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (0);
+        }
+        reader = dxf_entities_find_reader (type);
+        if ((reader == NULL) || (reader->list_offset == DXF_ENTITIES_NO_LIST))
+        {
+                return (0);
+        }
+        return (*(uint64_t *) ((char *) entity + reader->id_code_offset));
+}
+
+
+/*!
+ * \brief Get the layer name of an entity.
+ *
+ * \return the \c layer of the entity (not copied), or \c NULL for an
+ * entity of a type without a list in \c DxfEntities.
+ */
+const char *
+dxf_entities_get_entity_layer
+(
+        const char *type,
+                /*!< Entity type name, for example "LINE". */
+        void *entity
+                /*!< Pointer to the entity. */
+)
+{
+        const struct dxf_entities_reader_struct *reader;
+
+        /* Do some basic checks. */
+        if ((type == NULL) || (entity == NULL))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        reader = dxf_entities_find_reader (type);
+        if ((reader == NULL) || (reader->list_offset == DXF_ENTITIES_NO_LIST))
+        {
+                return (NULL);
+        }
+        return (*(const char **) ((char *) entity + reader->layer_offset));
+}
+
+
+/*!
+ * \brief Move a cursor to the first entity of the first non empty list
+ * at or after dispatch table entry \c reader.
+ */
+static void
+dxf_entities_cursor_find
+(
+        DxfEntitiesCursor *cursor,
+                /*!< a pointer to the cursor. */
+        size_t reader
+                /*!< Index of the first dispatch table entry to look
+                 * at. */
+)
+{
+        size_t number_readers = sizeof (dxf_entities_readers) / sizeof (dxf_entities_readers[0]);
+
+        cursor->entity = NULL;
+        for (; reader < number_readers; reader++)
+        {
+                if (dxf_entities_readers[reader].list_offset == DXF_ENTITIES_NO_LIST)
+                {
+                        continue;
+                }
+                cursor->entity = *(void **) ((char *) cursor->entities
+                  + dxf_entities_readers[reader].list_offset);
+                if (cursor->entity != NULL)
+                {
+                        break;
+                }
+        }
+        cursor->reader = reader;
+}
+
+
+/*!
+ * \brief Move a cursor to the next entity.
+ */
+static void
+dxf_entities_cursor_next
+(
+        DxfEntitiesCursor *cursor
+                /*!< a pointer to the cursor. */
+)
+{
+        cursor->entity = *(void **) ((char *) cursor->entity
+          + dxf_entities_readers[cursor->reader].next_offset);
+        if (cursor->entity == NULL)
+        {
+                dxf_entities_cursor_find (cursor, cursor->reader + 1);
+        }
+}
+
+
+/*!
+ * \brief Initialize a cursor over the entities of a DXF \c ENTITIES
+ * section.
+ *
+ * The cursor visits the lists of \c entities in the order of the
+ * entity type names, and every list from head to tail.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_entities_cursor_init
+(
+        DxfEntitiesCursor *cursor,
+                /*!< a pointer to the cursor. */
+        DxfEntities *entities
+                /*!< Pointer to the DXF \c ENTITIES section. */
+)
+{
+        /* Do some basic checks. */
+        if ((cursor == NULL) || (entities == NULL))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        cursor->entities = entities;
+        dxf_entities_cursor_find (cursor, 0);
         return (EXIT_SUCCESS);
 }
 
 
 /*!
- * \brief Write DXF output to a file for a DXF \c ENTITIES table.
+ * \brief Get the entity type name of the entity at a cursor.
+ *
+ * \return the entity type name, for example "LINE", or \c NULL at the
+ * end of the container.
+ */
+const char *
+dxf_entities_cursor_get_type
+(
+        DxfEntitiesCursor *cursor
+                /*!< a pointer to the cursor. */
+)
+{
+        if ((cursor == NULL) || (cursor->entity == NULL))
+        {
+                return (NULL);
+        }
+        return (dxf_entities_readers[cursor->reader].name);
+}
+
+
+/*!
+ * \brief Get the handle (\c id_code) of the entity at a cursor.
+ *
+ * \return the \c id_code of the entity, or 0 at the end of the
+ * container.
+ */
+uint64_t
+dxf_entities_cursor_get_id_code
+(
+        DxfEntitiesCursor *cursor
+                /*!< a pointer to the cursor. */
+)
+{
+        if ((cursor == NULL) || (cursor->entity == NULL))
+        {
+                return (0);
+        }
+        return (*(uint64_t *) ((char *) cursor->entity
+          + dxf_entities_readers[cursor->reader].id_code_offset));
+}
+
+
+/*!
+ * \brief Get the layer name of the entity at a cursor.
+ *
+ * \return the \c layer of the entity (not copied), or \c NULL at the
+ * end of the container.
+ */
+const char *
+dxf_entities_cursor_get_layer
+(
+        DxfEntitiesCursor *cursor
+                /*!< a pointer to the cursor. */
+)
+{
+        if ((cursor == NULL) || (cursor->entity == NULL))
+        {
+                return (NULL);
+        }
+        return (*(const char **) ((char *) cursor->entity
+          + dxf_entities_readers[cursor->reader].layer_offset));
+}
+
+
+/*!
+ * \brief Move a cursor forward over a number of entities without
+ * writing them.
+ *
+ * \return the number of entities skipped, less than \c count at the
+ * end of the section.
+ */
+size_t
+dxf_entities_cursor_skip
+(
+        DxfEntitiesCursor *cursor,
+                /*!< a pointer to the cursor. */
+        size_t count
+                /*!< Number of entities to skip. */
+)
+{
+        size_t i;
+
+        for (i = 0; (i < count) && (cursor->entity != NULL); i++)
+        {
+                dxf_entities_cursor_next (cursor);
+        }
+        return (i);
+}
+
+
+/*!
+ * \brief Write DXF output for a number of entities, starting at the
+ * entity of a cursor, and move the cursor past them.
+ *
+ * Every entity is written with the \c dxf_<type>_write () function of
+ * it's type.\n
+ * An entity rejected by it's writer (see dxf_entity_skip ()) is left
+ * out, the other entities are still written.\n
+ * Several ranges of the same \c ENTITIES section can be written
+ * concurrently, each to it's own buffer (see dxf_write_init_buffer ()).
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_entities_write_cursor
+(
+        DxfFile *fp,
+                /*!< DXF file pointer to an output file (or device). */
+        DxfEntitiesCursor *cursor,
+                /*!< a pointer to the cursor. */
+        size_t count
+                /*!< Maximum number of entities to write. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        size_t i;
+
+        /* Do some basic checks. */
+        if (fp == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL file pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        if (cursor == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        for (i = 0; (i < count) && (cursor->entity != NULL); i++)
+        {
+                dxf_entities_readers[cursor->reader].write (fp, cursor->entity);
+                dxf_entities_cursor_next (cursor);
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (((fp->writer != NULL) && fp->writer->error) ? EXIT_FAILURE : EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Write DXF output to a file for a DXF \c ENTITIES section.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
  */
 int
 dxf_entities_write_table
 (
-        char *dxf_entities_list,
-                /*!< pointer to a list of entities. */
-        int acad_version_number
-                /*!< AutoCAD DXF version number. */
+        DxfFile *fp,
+                /*!< DXF file pointer to an output file (or device). */
+        DxfEntities *entities
+                /*!< Pointer to the DXF \c ENTITIES section. */
 )
 {
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        /*! \todo Add code here. */
+        DxfEntitiesCursor cursor;
+        char *dxf_section_name = NULL;
+        int result;
+
+        /* Do some basic checks. */
+        if (fp == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL file pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        if (dxf_entities_cursor_init (&cursor, entities) == EXIT_FAILURE)
+        {
+                return (EXIT_FAILURE);
+        }
+        dxf_section_name = dxf_strdup ("ENTITIES");
+        dxf_section_write (fp, dxf_section_name);
+        result = dxf_entities_write_cursor (fp, &cursor, (size_t) -1);
+        dxf_endsec_write (fp);
+        /* Clean up. */
+        dxf_free (dxf_section_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (EXIT_SUCCESS);
+        return (result);
 }
 
 
@@ -540,7 +2031,7 @@ dxf_entities_free
         dxf_viewport_free_list ((DxfViewport *) entities->viewport_list);
         //dxf_wipeout_free_list (DxfWipeout *) entities->wipeout_list);
         //dxf_xline_free_list (DxfXLine *) entities->xline_list);
-        free (entities);
+        dxf_free (entities);
 #if DEBUG
         DXF_DEBUG_END
 #endif
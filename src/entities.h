@@ -160,10 +160,50 @@ dxf_entities_struct
 } DxfEntities;
 
 
+/*!
+ * \brief Callback of dxf_entities_read_callback (), called for every
+ * entity read from the \c ENTITIES section.
+ *
+ * \c type is the entity type name (for example "LINE"), \c entity
+ * points to the entity, owned by the callback from now on.\n
+ * Return \c EXIT_SUCCESS to continue reading, any other value stops
+ * reading.
+ */
+typedef int (*DxfEntityCallback) (const char *type, void *entity, void *user_data);
+
+
+/*!
+ * \brief Definition of a position in a DXF entity container, used to
+ * write the entities in ranges.
+ */
+typedef struct
+dxf_entities_cursor_struct
+{
+    DxfEntities *entities;
+        /*!< The entity container. */
+    size_t reader;
+        /*!< Index of the entity type of \c entity. */
+    void *entity;
+        /*!< The entity at the cursor, \c NULL at the end of the
+         * container. */
+} DxfEntitiesCursor;
+
+
 DxfEntities *dxf_entities_new ();
 DxfEntities *dxf_entities_init (DxfEntities *entities);
-int dxf_entities_read_table (char *filename, FILE *fp, int line_number, char *dxf_entities_list, int acad_version_number);
-int dxf_entities_write_table (char *dxf_entities_list, int acad_version_number);
+int dxf_entities_read_callback (DxfFile *fp, DxfEntityCallback on_entity, void *user_data);
+int dxf_entities_read_table (DxfFile *fp, DxfEntities *entities);
+int dxf_entities_read_block (DxfFile *fp, DxfEntities *entities);
+int dxf_entities_free_entity (const char *type, void *entity);
+uint64_t dxf_entities_get_entity_id_code (const char *type, void *entity);
+const char *dxf_entities_get_entity_layer (const char *type, void *entity);
+int dxf_entities_cursor_init (DxfEntitiesCursor *cursor, DxfEntities *entities);
+const char *dxf_entities_cursor_get_type (DxfEntitiesCursor *cursor);
+uint64_t dxf_entities_cursor_get_id_code (DxfEntitiesCursor *cursor);
+const char *dxf_entities_cursor_get_layer (DxfEntitiesCursor *cursor);
+size_t dxf_entities_cursor_skip (DxfEntitiesCursor *cursor, size_t count);
+int dxf_entities_write_cursor (DxfFile *fp, DxfEntitiesCursor *cursor, size_t count);
+int dxf_entities_write_table (DxfFile *fp, DxfEntities *entities);
 int dxf_entities_free (DxfEntities *entities);
 
 
@@ -38,6 +38,10 @@
 
 
 #include "file.h"
+#include "dictionary.h"
+#include "drawing.h"
+#include "endsec.h"
+#include "parallel.h"
 
 
 char *dxf_entities_list;
@@ -76,7 +80,7 @@ dxf_file_read
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        while (fp)
+        while (!dxf_read_eof (fp))
         {
                 memset(temp_string, 0, sizeof(temp_string));
                 dxf_read_line (temp_string, fp);
@@ -92,7 +96,7 @@ dxf_file_read
                 else if (strcmp (temp_string, "0") == 0)
                 {
                 /* Now follows some meaningfull dxf data. */
-                        while (!feof (fp->fp))
+                        while (!dxf_read_eof (fp))
                         {
                                 dxf_read_line (temp_string, fp);
                                 if (strcmp (temp_string, "SECTION") == 0)
@@ -127,29 +131,330 @@ dxf_file_read
 }
 
 
+/*!
+ * \brief Definition of a part of the output of dxf_file_write (), a
+ * section or a range of entities, serialized by a worker thread.
+ */
+typedef struct
+dxf_file_write_item_struct
+{
+    int section;
+        /*!< The \c DXF_SECTION_* flag of the section. */
+    DxfFile *fp;
+        /*!< The output file. */
+    DxfDrawing *drawing;
+        /*!< The drawing. */
+    DxfFile *buffer;
+        /*!< Buffer collecting the output of this item. */
+    DxfEntitiesCursor cursor;
+        /*!< First entity of a range of entities. */
+    size_t number_entities;
+        /*!< Number of entities in a range of entities. */
+    int first;
+        /*!< This range of entities starts the \c ENTITIES section. */
+    int last;
+        /*!< This range of entities ends the \c ENTITIES section. */
+    uint64_t handle_seed;
+        /*!< First handle reserved for the objects of the \c OBJECTS
+         * section. */
+} DxfFileWriteItem;
+
+
+/*!
+ * \brief Get the first free handle of a drawing.
+ *
+ * The larger of the \c $HANDSEED header variable and the largest
+ * handle in the handle index of \c drawing plus one.
+ */
+static uint64_t
+dxf_file_write_get_handle_seed
+(
+        DxfDrawing *drawing
+                /*!< a pointer to the drawing. */
+)
+{
+        DxfHeader *header = (DxfHeader *) drawing->header;
+        DxfHandleIndex *index;
+        uint64_t handle_seed = 1;
+        size_t i;
+
+        if ((header != NULL) && (header->HandSeed != NULL))
+        {
+                handle_seed = strtoull (header->HandSeed, NULL, 16);
+        }
+        index = dxf_drawing_get_handle_index (drawing);
+        if (index != NULL)
+        {
+                for (i = 0; i < index->capacity; i++)
+                {
+                        if ((index->slots[i].object != NULL)
+                          && (index->slots[i].handle >= handle_seed))
+                        {
+                                handle_seed = index->slots[i].handle + 1;
+                        }
+                }
+        }
+        if (handle_seed == DXF_HANDLE_NONE)
+        {
+                handle_seed = 1;
+        }
+        return (handle_seed);
+}
+
+
+/*!
+ * \brief Write DXF output for the \c OBJECTS section of a drawing.
+ *
+ * Writes the root dictionary, with the layer index of \c drawing as
+ * it's \c ACAD_LAYERINDEX entry, followed by the layer index itself
+ * (see dxf_layer_index_map_write ()).\n
+ * The objects get consecutive handles starting at \c handle_seed.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+static int
+dxf_file_write_objects
+(
+        DxfFile *fp,
+                /*!< file pointer to output file (or device). */
+        DxfDrawing *drawing,
+                /*!< a pointer to the drawing. */
+        uint64_t handle_seed
+                /*!< First handle reserved for the objects. */
+)
+{
+        DxfDictionary *dictionary = NULL;
+        char *dxf_section_name = NULL;
+        int result;
+
+        dictionary = dxf_dictionary_init (dxf_dictionary_new ());
+        if (dictionary == NULL)
+        {
+                return (EXIT_FAILURE);
+        }
+        dictionary->id_code = handle_seed++;
+        dxf_free (dictionary->entry_name);
+        dictionary->entry_name = dxf_strdup ("ACAD_LAYERINDEX");
+        dictionary->entry_object_handle = handle_seed;
+        dxf_section_name = dxf_strdup ("OBJECTS");
+        dxf_section_write (fp, dxf_section_name);
+        result = dxf_dictionary_write (fp, dictionary);
+        if (result == EXIT_SUCCESS)
+        {
+                result = dxf_layer_index_map_write (fp,
+                  (DxfLayerIndexMap *) drawing->layer_index,
+                  dictionary->id_code, &handle_seed);
+        }
+        dxf_endsec_write (fp);
+        /* Clean up. */
+        dxf_free (dxf_section_name);
+        dxf_dictionary_free (dictionary);
+        return (result);
+}
+
+
+/*!
+ * \brief Serialize an item of dxf_file_write () into it's own buffer.
+ *
+ * Runs on a worker thread.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+static int
+dxf_file_write_item
+(
+        void *data
+                /*!< a pointer to the \c DxfFileWriteItem. */
+)
+{
+        DxfFileWriteItem *item = (DxfFileWriteItem *) data;
+        DxfDrawing *drawing = item->drawing;
+        DxfFile *fp;
+        DxfClass *class;
+        char *dxf_section_name = NULL;
+        int result = EXIT_SUCCESS;
+
+        fp = item->buffer = dxf_write_init_buffer (item->fp);
+        if (fp == NULL)
+        {
+                return (EXIT_FAILURE);
+        }
+        switch (item->section)
+        {
+                case DXF_SECTION_HEADER:
+                        result = dxf_header_write (fp, (DxfHeader *) drawing->header);
+                        break;
+                case DXF_SECTION_CLASSES:
+                        dxf_section_name = dxf_strdup ("CLASSES");
+                        dxf_section_write (fp, dxf_section_name);
+                        for (class = (DxfClass *) drawing->class_list;
+                          (class != NULL) && (result == EXIT_SUCCESS);
+                          class = (DxfClass *) class->next)
+                        {
+                                result = dxf_class_write (fp, class);
+                        }
+                        dxf_class_write_endclass (fp);
+                        break;
+                case DXF_SECTION_TABLES:
+                        result = dxf_tables_write (fp, (DxfTables *) drawing->tables_list);
+                        break;
+                case DXF_SECTION_BLOCKS:
+                        result = dxf_block_write_table (fp, (DxfBlock *) drawing->block_list);
+                        break;
+                case DXF_SECTION_ENTITIES:
+                        if (item->first)
+                        {
+                                dxf_section_name = dxf_strdup ("ENTITIES");
+                                dxf_section_write (fp, dxf_section_name);
+                        }
+                        result = dxf_entities_write_cursor (fp, &item->cursor, item->number_entities);
+                        if (item->last)
+                        {
+                                dxf_endsec_write (fp);
+                        }
+                        break;
+                case DXF_SECTION_OBJECTS:
+                        result = dxf_file_write_objects (fp, drawing, item->handle_seed);
+                        break;
+                case DXF_SECTION_THUMBNAIL:
+                        dxf_section_name = dxf_strdup ("THUMBNAILIMAGE");
+                        dxf_section_write (fp, dxf_section_name);
+                        result = dxf_thumbnail_write (fp, (DxfThumbnail *) drawing->thumbnail);
+                        dxf_endsec_write (fp);
+                        break;
+                default:
+                        result = EXIT_FAILURE;
+                        break;
+        }
+        /* Clean up. */
+        dxf_free (dxf_section_name);
+        if (fp->writer->error)
+        {
+                result = EXIT_FAILURE;
+        }
+        return (result);
+}
+
+
+/*!
+ * \brief Append the buffer of a serialized item of dxf_file_write () to
+ * the output file.
+ *
+ * Runs in the calling thread, in item order.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+static int
+dxf_file_write_item_done
+(
+        void *data,
+                /*!< a pointer to the \c DxfFileWriteItem. */
+        void *user_data
+                /*!< Not used. */
+)
+{
+        DxfFileWriteItem *item = (DxfFileWriteItem *) data;
+        int result;
+
+        result = dxf_write_append (item->fp, item->buffer);
+        dxf_write_close (item->buffer);
+        item->buffer = NULL;
+        return (result);
+}
+
+
+/*!
+ * \brief Append a new item to the items of dxf_file_write ().
+ *
+ * \return a pointer to the new item, filled with zeros, or \c NULL
+ * when no memory was allocated.
+ */
+static DxfFileWriteItem *
+dxf_file_write_add_item
+(
+        DxfFileWriteItem **items,
+                /*!< a pointer to the items. */
+        size_t *number_items,
+                /*!< a pointer to the number of items. */
+        size_t *size,
+                /*!< a pointer to the number of allocated items. */
+        int section
+                /*!< The \c DXF_SECTION_* flag of the new item. */
+)
+{
+        DxfFileWriteItem *new_items;
+
+        if (*number_items == *size)
+        {
+                new_items = realloc (*items, 2 * (*size + 8) * sizeof (DxfFileWriteItem));
+                if (new_items == NULL)
+                {
+                        fprintf (stderr,
+                          (_("Error in %s () could not allocate memory.\n")),
+                          __FUNCTION__);
+                        return (NULL);
+                }
+                *items = new_items;
+                *size = 2 * (*size + 8);
+        }
+        memset (&(*items)[*number_items], 0, sizeof (DxfFileWriteItem));
+        (*items)[*number_items].section = section;
+        return (&(*items)[(*number_items)++]);
+}
+
+
 /*!
  * \brief Function generates dxf output to a file for a complete DXF file.
+ *
+ * The \c HEADER, \c CLASSES, \c TABLES, \c BLOCKS, \c ENTITIES and
+ * \c THUMBNAILIMAGE sections of \c drawing which are present (not
+ * \c NULL) are written, followed by the \c EOF marker.\n
+ * \c CLASSES are only written for DXF R13 and later, a thumbnail
+ * only for DXF R2000 and later.\n
+ * For DXF R14 and later the \c OBJECTS section is written with the
+ * layer index of the entities (see dxf_drawing_get_layer_index ()),
+ * the handles of it's objects are taken from \c $HANDSEED, which is
+ * advanced past them.\n
+ * The other objects of \c drawing are not written yet.
+ *
+ * Every section, and every range of \c DXF_WRITER_CHUNK_ENTITIES
+ * entities of the \c ENTITIES section, is serialized into it's own
+ * memory buffer by a worker thread, and the buffers are appended to
+ * \c fp in file order.\n
+ * The output does not depend on \c number_threads.\n
+ * The \c $EXTMIN and \c $EXTMAX header variables are updated with
+ * dxf_drawing_update_extents () first.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
  */
 int
 dxf_file_write
 (
         DxfFile *fp,
                 /*!< file pointer to output file (or device). */
-        DxfHeader dxf_header,
-                /*!< a dxf header. */
-        DxfClass dxf_classes_list,
-                /*!< pointer to a list of CLASSES. */
-        DxfTable dxf_tables_list
-                /*!< pointer to a list of TABLES. */
+        DxfDrawing *drawing,
+                /*!< a pointer to the drawing to write. */
+        int number_threads
+                /*!< Number of worker threads, 0 for one per processor,
+                 * 1 to write in the calling thread only. */
 )
 {
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        extern char *dxf_entities_list;
-        extern char *dxf_objects_list;
-//        DxfBlock *dxf_blocks_list;
-        extern DxfThumbnail *dxf_thumbnail;
+        DxfFileWriteItem *items = NULL;
+        DxfFileWriteItem *item = NULL;
+        DxfEntitiesCursor cursor;
+        DxfHeader *header;
+        char handle_seed[DXF_MAX_STRING_LENGTH];
+        size_t number_items = 0;
+        size_t size = 0;
+        size_t i;
+        int result;
 
         /* Do some basic checks. */
         if (fp == NULL)
@@ -159,19 +464,124 @@ dxf_file_write
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-//        dxf_header_init (dxf_header);
-//        dxf_header_write (fp, dxf_header);
-//        dxf_write_classes (fp, dxf_classes_list);
-//        dxf_write_tables (fp, dxf_tables_list);
-//        dxf_block_write_table (fp, dxf_blocks_list);
-//        dxf_entities_write_table (fp, dxf_entities_list);
-//        dxf_object_write_objects (fp, dxf_objects_list);
-//        dxf_thumbnail_write (fp, dxf_thumbnail);
-//        dxf_file_write_eof (fp);
+        if (drawing == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        if (drawing->object_list != NULL)
+        {
+                fprintf (stderr,
+                  (_("Warning in %s () writing the objects of the OBJECTS section is not supported yet, objects skipped.\n")),
+                  __FUNCTION__);
+        }
+        /* Bring $EXTMIN and $EXTMAX up to date. */
+        if ((drawing->header != NULL)
+          && (drawing->entities_list != NULL))
+        {
+                dxf_drawing_update_extents (drawing, number_threads, NULL);
+        }
+        /* Split the drawing in items, in file order. */
+        if ((drawing->header != NULL)
+          && (dxf_file_write_add_item (&items, &number_items, &size, DXF_SECTION_HEADER) == NULL))
+        {
+                return (EXIT_FAILURE);
+        }
+        if ((drawing->class_list != NULL)
+          && (fp->acad_version_number >= AutoCAD_13)
+          && (dxf_file_write_add_item (&items, &number_items, &size, DXF_SECTION_CLASSES) == NULL))
+        {
+                free (items);
+                return (EXIT_FAILURE);
+        }
+        if ((drawing->tables_list != NULL)
+          && (dxf_file_write_add_item (&items, &number_items, &size, DXF_SECTION_TABLES) == NULL))
+        {
+                free (items);
+                return (EXIT_FAILURE);
+        }
+        if ((drawing->block_list != NULL)
+          && (dxf_file_write_add_item (&items, &number_items, &size, DXF_SECTION_BLOCKS) == NULL))
+        {
+                free (items);
+                return (EXIT_FAILURE);
+        }
+        if (drawing->entities_list != NULL)
+        {
+                /* One item per range of entities. */
+                dxf_entities_cursor_init (&cursor, (DxfEntities *) drawing->entities_list);
+                do
+                {
+                        item = dxf_file_write_add_item (&items, &number_items, &size, DXF_SECTION_ENTITIES);
+                        if (item == NULL)
+                        {
+                                free (items);
+                                return (EXIT_FAILURE);
+                        }
+                        item->cursor = cursor;
+                        item->number_entities = dxf_entities_cursor_skip (&cursor, DXF_WRITER_CHUNK_ENTITIES);
+                        item->first = ((item == items)
+                          || (item[-1].section != DXF_SECTION_ENTITIES));
+                }
+                while (cursor.entity != NULL);
+                item->last = TRUE;
+        }
+        if ((drawing->entities_list != NULL)
+          && (fp->acad_version_number >= AutoCAD_14)
+          && (dxf_drawing_get_layer_index (drawing) != NULL))
+        {
+                item = dxf_file_write_add_item (&items, &number_items, &size, DXF_SECTION_OBJECTS);
+                if (item == NULL)
+                {
+                        free (items);
+                        return (EXIT_FAILURE);
+                }
+                /* Reserve the handles of the root dictionary and the
+                 * layer index before the header is written. */
+                item->handle_seed = dxf_file_write_get_handle_seed (drawing);
+                if (drawing->header != NULL)
+                {
+                        header = (DxfHeader *) drawing->header;
+                        snprintf (handle_seed, sizeof (handle_seed), "%" PRIX64,
+                          item->handle_seed + 1
+                          + dxf_layer_index_map_get_number_of_objects ((DxfLayerIndexMap *) drawing->layer_index));
+                        dxf_free (header->HandSeed);
+                        header->HandSeed = dxf_strdup (handle_seed);
+                }
+        }
+        if ((drawing->thumbnail != NULL)
+          && (fp->acad_version_number >= AutoCAD_2000)
+          && (dxf_file_write_add_item (&items, &number_items, &size, DXF_SECTION_THUMBNAIL) == NULL))
+        {
+                free (items);
+                return (EXIT_FAILURE);
+        }
+        for (i = 0; i < number_items; i++)
+        {
+                items[i].fp = fp;
+                items[i].drawing = drawing;
+        }
+        result = dxf_parallel_map (items, sizeof (DxfFileWriteItem), number_items,
+          number_threads, dxf_file_write_item, dxf_file_write_item_done, NULL);
+        if (result == EXIT_SUCCESS)
+        {
+                result = dxf_file_write_eof (fp);
+        }
+        /* Clean up the buffers of items not appended after an error. */
+        for (i = 0; i < number_items; i++)
+        {
+                if (items[i].buffer != NULL)
+                {
+                        dxf_write_close (items[i].buffer);
+                }
+        }
+        free (items);
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (EXIT_SUCCESS);
+        return (result);
 }
 
 
@@ -197,7 +607,7 @@ dxf_file_write_eof
                 return (EXIT_FAILURE);
         }
         /* Start writing output. */
-        fprintf (fp->fp, "  0\nEOF\n");
+        dxf_write_string (fp, 0, "EOF");
 #if DEBUG
         DXF_DEBUG_END
 #endif
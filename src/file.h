@@ -57,8 +57,12 @@ extern "C" {
 #endif
 
 
+/* drawing.h includes this header through util.h. */
+struct dxf_drawing_struct;
+
+
 int dxf_file_read (char *filename);
-int dxf_file_write (DxfFile *fp, DxfHeader dxf_header, DxfClass dxf_classes_list, DxfTable dxf_tables_list);
+int dxf_file_write (DxfFile *fp, struct dxf_drawing_struct *drawing, int number_threads);
 int dxf_file_write_eof (DxfFile *fp);
 
 
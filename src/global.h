@@ -188,6 +188,169 @@
          * Compile with -DDEBUG compiler directive enabled. */
 
 
+/*!
+ * \brief The sentinel at the start of a binary DXF file.
+ */
+#define DXF_BINARY_SENTINEL "AutoCAD Binary DXF\r\n\x1a"
+#define DXF_BINARY_SENTINEL_LENGTH 22
+        /*!< \brief Length of the sentinel, including the trailing
+         * '\0'. */
+
+#define DXF_BINARY_LINE_LENGTH 512
+        /*!< \brief The size of the buffer holding a value of a binary
+         * DXF record formatted as a line.
+         *
+         * Large enough for the hexadecimal text of a binary chunk of
+         * 255 bytes. */
+
+#define DXF_READER_LINE_INDEX_SIZE 256
+        /*!< \brief The number of line terminators indexed ahead by a
+         * \c DxfReader. */
+
+
+/*!
+ * \brief DXF definition of a shared, read only memory map of a file.
+ *
+ * The map is removed when the last reference is released with
+ * dxf_mapping_release (), so data read lazily can refer to it after
+ * the \c DxfFile was closed.
+ */
+typedef struct
+dxf_mapping_struct
+{
+    void *address;
+        /*!< Start of the memory map. */
+    size_t size;
+        /*!< Size of the memory map. */
+    int references;
+        /*!< Number of references. */
+} DxfMapping;
+
+
+/*!
+ * \brief DXF definition of a buffered group code reader.
+ *
+ * The input is read in large blocks into \c buffer, lines are handed
+ * out as slices (pointer and length) into this buffer.\n
+ * A slice is \b not terminated with a '\\0' and stays valid until the
+ * next line is requested from the reader.\n
+ * When \c mapped is set, \c buffer points to a read only memory map of
+ * the whole file and slices stay valid until the reader is freed.
+ */
+typedef struct
+dxf_reader_struct
+{
+    FILE *fp;
+        /*!< File handle to read blocks from. */
+    char *buffer;
+        /*!< Block buffer. */
+    size_t size;
+        /*!< Allocated size of \c buffer. */
+    size_t start;
+        /*!< Offset of the first unread byte in \c buffer. */
+    size_t end;
+        /*!< Offset past the last valid byte in \c buffer. */
+    int64_t offset;
+        /*!< File offset of the first byte in \c buffer. */
+    size_t pair_start;
+        /*!< Offset of the first byte of the last group code / value
+         * pair, used for pushing back a pair. */
+    int pair_lines;
+        /*!< Number of lines consumed by the last pair. */
+    int eof;
+        /*!< End of input was reached. */
+    int error;
+        /*!< A read error occurred. */
+    int mapped;
+        /*!< \c buffer is a memory map of the whole file, not an
+         * allocated block buffer. */
+    DxfMapping *mapping;
+        /*!< The memory map when \c mapped is set, shared with data
+         * read lazily, otherwise \c NULL. */
+    int group_code;
+        /*!< Last group code read. */
+    const char *value;
+        /*!< Slice of the last value read. */
+    size_t length;
+        /*!< Length of the slice of the last value read. */
+    int binary;
+        /*!< 0 for an ASCII DXF file, otherwise the size in bytes of
+         * a group code in a binary DXF file (1 for R12, 2 for R13 and
+         * later). */
+    int binary_pending;
+        /*!< The value of the last binary record was not read yet. */
+    int binary_group_code;
+        /*!< Group code of the last binary record. */
+    int binary_type;
+        /*!< Value type of the last binary record. */
+    double binary_double;
+        /*!< Value of the last binary record holding a real. */
+    long long binary_integer;
+        /*!< Value of the last binary record holding an integer. */
+    const char *binary_value;
+        /*!< Slice of the last binary record holding a string or a
+         * binary chunk. */
+    size_t binary_length;
+        /*!< Length of \c binary_value. */
+    char binary_line[DXF_BINARY_LINE_LENGTH];
+        /*!< The group code or value of the last binary record
+         * formatted as a line. */
+    size_t line_index[DXF_READER_LINE_INDEX_SIZE];
+        /*!< Offsets in \c buffer of the line terminators from
+         * \c line_index_from up to \c line_index_to, see
+         * dxf_reader_index_lines (). */
+    size_t line_index_from;
+        /*!< Offset in \c buffer of the first byte indexed. */
+    size_t line_index_to;
+        /*!< Offset in \c buffer past the last byte indexed. */
+    int line_index_count;
+        /*!< Number of offsets in \c line_index. */
+    int line_index_next;
+        /*!< Index of the first offset in \c line_index not handed
+         * out yet. */
+} DxfReader;
+
+
+/*!
+ * \brief Number of group codes with a precomputed prefix in a
+ * \c DxfWriter (0 up to and including 1071).
+ */
+#define DXF_WRITER_PREFIXES 1072
+
+
+/*!
+ * \brief DXF definition of a buffered group code writer.
+ *
+ * Group code / value pairs are formatted into \c buffer, which is
+ * written to file in large blocks.\n
+ * The group code lines ("%3d\n") of all common group codes are
+ * formatted once, when the writer is created.\n
+ * When \c binary is set the pairs are encoded as binary DXF records
+ * instead.
+ */
+typedef struct
+dxf_writer_struct
+{
+    FILE *fp;
+        /*!< File handle to write blocks to. */
+    char *buffer;
+        /*!< Block buffer. */
+    size_t size;
+        /*!< Allocated size of \c buffer. */
+    size_t used;
+        /*!< Number of bytes in \c buffer not written yet. */
+    int error;
+        /*!< A write error occurred. */
+    char prefixes[DXF_WRITER_PREFIXES][6];
+        /*!< Group code lines of the group codes 0 up to and including
+         * 1071. */
+    int binary;
+        /*!< Pairs are written as binary DXF records, with 1 byte
+         * group codes for DXF R12 and earlier, 2 byte group codes for
+         * DXF R13 and later. */
+} DxfWriter;
+
+
 /*!
  * \brief DXF definition of a DXF file.
  */
@@ -196,6 +359,12 @@ dxf_file_struct
 {
     FILE *fp;
         /*!< File handle. */
+    DxfReader *reader;
+        /*!< Buffered group code reader, \c NULL when writing. */
+    DxfWriter *writer;
+        /*!< Buffered group code writer, \c NULL when reading.\n
+         * When \c NULL while writing, pairs are written directly to
+         * \c fp. */
     char *filename;
         /*!< Dxf filename. */
     int line_number;
@@ -206,9 +375,52 @@ dxf_file_struct
         /*!< AutoCAD version number. */
     int follow_strict_version_rules;
         /*!< follow strict rules when writing to file. */
+    struct dxf_string_pool_struct *string_pool;
+        /*!< String pool for interning repeated names while reading,
+         * \c NULL when strings are not interned.\n
+         * Borrowed, usually from the \c DxfDrawing being read. */
+    int number_threads;
+        /*!< Number of worker threads reading the \c ENTITIES section,
+         * 0 for one per processor, 1 to read in the calling thread
+         * only. */
 } DxfFile;
 
 
+/*!
+ * \brief DXF definition of a coordinate triplet.
+ *
+ * A plain value type for geometric members of entities (start and end
+ * points, centers, vectors), as opposed to \c DxfPoint, which is a
+ * complete \c POINT entity.
+ */
+typedef struct
+dxf_vec3_struct
+{
+    double x;
+        /*!< X-value. */
+    double y;
+        /*!< Y-value. */
+    double z;
+        /*!< Z-value. */
+} DxfVec3;
+
+
+/*!
+ * \brief DXF definition of an axis aligned bounding box.
+ *
+ * An empty box (see dxf_bbox_init ()) has a \c min larger than it's
+ * \c max.
+ */
+typedef struct
+dxf_bbox_struct
+{
+    DxfVec3 min;
+        /*!< Lower left (bottom) corner. */
+    DxfVec3 max;
+        /*!< Upper right (top) corner. */
+} DxfBbox;
+
+
 /*!
  * \brief DXF definition of a single linked list of char.
  */
@@ -458,6 +670,52 @@ dxf_int64_struct
          * \note one (1) char is reserved for '\0'. */
 #endif
 
+#ifndef DXF_READER_BUFFER_SIZE
+#  define DXF_READER_BUFFER_SIZE 262144
+        /*!< \brief The size of a block read by a \c DxfReader.
+         *
+         * If not already defined as a compiler directive the default
+         * value is 256 KiB. */
+#endif
+
+#ifndef DXF_WRITER_BUFFER_SIZE
+#  define DXF_WRITER_BUFFER_SIZE 262144
+        /*!< \brief The size of a block written by a \c DxfWriter.
+         *
+         * If not already defined as a compiler directive the default
+         * value is 256 KiB. */
+#endif
+
+#ifndef DXF_WRITER_CHUNK_ENTITIES
+#  define DXF_WRITER_CHUNK_ENTITIES 4096
+        /*!< \brief The number of entities serialized into one buffer
+         * by a worker thread of dxf_file_write ().
+         *
+         * If not already defined as a compiler directive the default
+         * value is 4096. */
+#endif
+
+#ifndef DXF_READER_CHUNK_SIZE
+#  define DXF_READER_CHUNK_SIZE 4194304
+        /*!< \brief The minimum size of a range of the \c ENTITIES
+         * section read by a worker thread of dxf_entities_read_table ().
+         *
+         * If not already defined as a compiler directive the default
+         * value is 4 MiB. */
+#endif
+
+#define DXF_DOUBLE_STRING_LENGTH 32
+        /*!< \brief The size of a buffer holding a formatted double.
+         *
+         * Large enough for 17 significant digits, sign, decimal point
+         * and exponent. */
+
+#define DXF_HANDLE_NONE (uint64_t) 0
+        /*!< \brief The id code of an object without a handle.
+         *
+         * Handle 0 is never assigned by AutoCAD, so it marks an object
+         * whose group code 5 is not to be written. */
+
 #define DXF_COLOR_INDEX_MAX_NUMBER_OF_COLORS 256
         /*!< \brief The maximum number of colors in a \c DxfColorIndex. */
 
@@ -605,6 +863,10 @@ dxf_int64_struct
          * symbol table entry. */
 
 
+/* Allocation functions used by all libDXF members. */
+#include "arena.h"
+
+
 #endif /* LIBDXF_SRC_GLOBAL_H */
 
 
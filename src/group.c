@@ -42,6 +42,7 @@
 
 
 #include "group.h"
+#include "util.h"
 
 
 /*!
@@ -61,7 +62,7 @@ dxf_group_new ()
         size = sizeof (DxfGroup);
         /* avoid malloc of 0 bytes */
         if (size == 0) size = 1;
-        if ((group = malloc (size)) == NULL)
+        if ((group = dxf_malloc (size)) == NULL)
         {
                 fprintf (stderr,
                   (_("Error in %s () could not allocate memory.\n")),
@@ -111,13 +112,13 @@ dxf_group_init
                   __FUNCTION__);
                 return (NULL);
         }
-        group->id_code = 0;
-        group->description = strdup ("");
-        group->handle_entity_in_group = strdup ("");
+        group->id_code = DXF_HANDLE_NONE;
+        group->description = dxf_strdup ("");
+        group->handle_entity_in_group = dxf_strdup ("");
         group->unnamed_flag = 0;
         group->selectability_flag = 0;
-        group->dictionary_owner_soft = strdup ("");
-        group->dictionary_owner_hard = strdup ("");
+        group->dictionary_owner_soft = 0;
+        group->dictionary_owner_hard = 0;
         group->next = NULL;
 #if DEBUG
         DXF_DEBUG_END
@@ -148,7 +149,8 @@ dxf_group_read
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        char *temp_string = NULL;
+        char temp_string[DXF_MAX_STRING_LENGTH];
+        int group_code;
 
         /* Do some basic checks. */
         if (fp == NULL)
@@ -156,8 +158,6 @@ dxf_group_read
                 fprintf (stderr,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
-                /* Clean up. */
-                free (temp_string);
                 return (NULL);
         }
         if (fp->acad_version_number < AutoCAD_13)
@@ -173,98 +173,89 @@ dxf_group_read
                   __FUNCTION__);
                 group = dxf_group_init (group);
         }
-        (fp->line_number)++;
-        fscanf (fp->fp, "%[^\n]", temp_string);
-        while (strcmp (temp_string, "0") != 0)
+        while ((dxf_read_group_code (fp, &group_code) == EXIT_SUCCESS)
+          && (group_code != 0))
         {
-                if (ferror (fp->fp))
+                if (dxf_read_error (fp))
                 {
                         fprintf (stderr,
                           (_("Error in %s () while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
                         /* Clean up. */
-                        free (temp_string);
-                        fclose (fp->fp);
                         return (NULL);
                 }
-                if (strcmp (temp_string, "5") == 0)
-                {
-                        /* Now follows a string containing a sequential
-                         * id number. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%x\n", (uint *) &group->id_code);
-                }
-                else if (strcmp (temp_string, "70") == 0)
-                {
-                        /* Now follows a string containing the
-                         * unnamed flag value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%hd\n", &group->unnamed_flag);
-                }
-                else if (strcmp (temp_string, "71") == 0)
+                switch (group_code)
                 {
-                        /* Now follows a string containing the
-                         * selectability flag value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%hd\n", &group->selectability_flag);
-                }
-                else if ((fp->acad_version_number >= AutoCAD_13)
-                        && (strcmp (temp_string, "100") == 0))
-                {
-                        /* Now follows a string containing the
-                         * subclass marker value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
-                        if (strcmp (temp_string, "AcDbGroup") != 0)
-                        {
+                        case 5:
+                                /* Now follows a string containing a sequential
+                                 * id number. */
+                                dxf_read_handle (fp, &group->id_code);
+                                break;
+                        case 70:
+                                /* Now follows a string containing the
+                                 * unnamed flag value. */
+                                dxf_read_int16 (fp, &group->unnamed_flag);
+                                break;
+                        case 71:
+                                /* Now follows a string containing the
+                                 * selectability flag value. */
+                                dxf_read_int16 (fp, &group->selectability_flag);
+                                break;
+                        case 100:
+                                if (fp->acad_version_number >= AutoCAD_13)
+                                {
+                                        /* Now follows a string containing the
+                                         * subclass marker value. */
+                                        dxf_read_line (temp_string, fp);
+                                        if (strcmp (temp_string, "AcDbGroup") != 0)
+                                        {
+                                                fprintf (stderr,
+                                                  (_("Warning in %s () found a bad subclass marker in: %s in line: %d.\n")),
+                                                  __FUNCTION__, fp->filename, fp->line_number);
+                                        }
+                                }
+                                else
+                                {
+                                        fprintf (stderr,
+                                          (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
+                                          __FUNCTION__, fp->filename, fp->line_number);
+                                        /* Skip the value of the unknown group code. */
+                                        dxf_read_line (temp_string, fp);
+                                }
+                                break;
+                        case 300:
+                                /* Now follows a string containing a description. */
+                                dxf_read_string (fp, &group->description);
+                                break;
+                        case 330:
+                                /* Now follows a string containing Soft-pointer
+                                 * ID/handle to owner dictionary. */
+                                dxf_read_handle (fp, &group->dictionary_owner_soft);
+                                break;
+                        case 340:
+                                /* Now follows a string containing a handle to an
+                                 * entry in group object. */
+                                dxf_read_string (fp, &group->handle_entity_in_group);
+                                break;
+                        case 360:
+                                /* Now follows a string containing Hard owner
+                                 * ID/handle to owner dictionary. */
+                                dxf_read_handle (fp, &group->dictionary_owner_hard);
+                                break;
+                        case 999:
+                                /* Now follows a string containing a comment. */
+                                dxf_read_line (temp_string, fp);
+                                fprintf (stdout, (_("DXF comment: %s\n")), temp_string);
+                                break;
+                        default:
                                 fprintf (stderr,
-                                  (_("Warning in %s () found a bad subclass marker in: %s in line: %d.\n")),
+                                  (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
                                   __FUNCTION__, fp->filename, fp->line_number);
-                        }
-                }
-                else if (strcmp (temp_string, "300") == 0)
-                {
-                        /* Now follows a string containing a description. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, group->description);
-                }
-                else if (strcmp (temp_string, "330") == 0)
-                {
-                        /* Now follows a string containing Soft-pointer
-                         * ID/handle to owner dictionary. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, group->dictionary_owner_soft);
-                }
-                else if (strcmp (temp_string, "340") == 0)
-                {
-                        /* Now follows a string containing a handle to an
-                         * entry in group object. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, group->handle_entity_in_group);
-                }
-                else if (strcmp (temp_string, "360") == 0)
-                {
-                        /* Now follows a string containing Hard owner
-                         * ID/handle to owner dictionary. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, group->dictionary_owner_hard);
-                }
-                else if (strcmp (temp_string, "999") == 0)
-                {
-                        /* Now follows a string containing a comment. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
-                        fprintf (stdout, (_("DXF comment: %s\n")), temp_string);
-                }
-                else
-                {
-                        fprintf (stderr,
-                          (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
-                          __FUNCTION__, fp->filename, fp->line_number);
+                                /* Skip the value of the unknown group code. */
+                                dxf_read_line (temp_string, fp);
+                                break;
                 }
         }
-        /* Clean up. */
-        free (temp_string);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -290,7 +281,7 @@ dxf_group_write
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        char *dxf_entity_name = strdup ("GROUP");
+        char *dxf_entity_name = dxf_strdup ("GROUP");
 
         /* Do some basic checks. */
         if (fp == NULL)
@@ -299,7 +290,7 @@ dxf_group_write
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (group == NULL)
@@ -308,38 +299,38 @@ dxf_group_write
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (strcmp (group->description, "") == 0)
         {
                 fprintf (stderr,
-                  (_("Error in %s () empty description string for the %s entity with id-code: %x\n")),
+                  (_("Error in %s () empty description string for the %s entity with id-code: %" PRIx64 "\n")),
                   __FUNCTION__, dxf_entity_name, group->id_code);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (strcmp (group->handle_entity_in_group, "") == 0)
         {
                 fprintf (stderr,
-                  (_("Error in %s () empty string for handle entity in group for the %s entity with id-code: %x\n")),
+                  (_("Error in %s () empty string for handle entity in group for the %s entity with id-code: %" PRIx64 "\n")),
                   __FUNCTION__, dxf_entity_name, group->id_code);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (fp->acad_version_number < AutoCAD_13)
         {
                 fprintf (stderr,
-                  (_("Warning in %s () illegal DXF version for this %s entity with id-code: %x.\n")),
+                  (_("Warning in %s () illegal DXF version for this %s entity with id-code: %" PRIx64 ".\n")),
                   __FUNCTION__, dxf_entity_name, group->id_code);
         }
         /* Start writing output. */
-        fprintf (fp->fp, "  0\n%s\n", dxf_entity_name);
-        if (group->id_code != -1)
+        dxf_write_string (fp, 0, dxf_entity_name);
+        if (group->id_code != DXF_HANDLE_NONE)
         {
-                fprintf (fp->fp, "  5\n%x\n", group->id_code);
+                dxf_write_hex (fp, 5, group->id_code);
         }
         /*!
          * \todo for version R14.\n
@@ -351,30 +342,30 @@ dxf_group_write
          * 102 groups are application defined (optional).\n\n
          * End of group, "}" (optional), with Group code 102.
          */
-        if ((strcmp (group->dictionary_owner_soft, "") != 0)
+        if ((group->dictionary_owner_soft != 0)
           && (fp->acad_version_number >= AutoCAD_14))
         {
-                fprintf (fp->fp, "102\n{ACAD_REACTORS\n");
-                fprintf (fp->fp, "330\n%s\n", group->dictionary_owner_soft);
-                fprintf (fp->fp, "102\n}\n");
+                dxf_write_string (fp, 102, "{ACAD_REACTORS");
+                dxf_write_hex (fp, 330, group->dictionary_owner_soft);
+                dxf_write_string (fp, 102, "}");
         }
-        if ((strcmp (group->dictionary_owner_hard, "") != 0)
+        if ((group->dictionary_owner_hard != 0)
           && (fp->acad_version_number >= AutoCAD_14))
         {
-                fprintf (fp->fp, "102\n{ACAD_XDICTIONARY\n");
-                fprintf (fp->fp, "360\n%s\n", group->dictionary_owner_hard);
-                fprintf (fp->fp, "102\n}\n");
+                dxf_write_string (fp, 102, "{ACAD_XDICTIONARY");
+                dxf_write_hex (fp, 360, group->dictionary_owner_hard);
+                dxf_write_string (fp, 102, "}");
         }
         if (fp->acad_version_number >= AutoCAD_13)
         {
-                fprintf (fp->fp, "100\nAcDbGroup\n");
+                dxf_write_string (fp, 100, "AcDbGroup");
         }
-        fprintf (fp->fp, "300\n%s\n", group->description);
-        fprintf (fp->fp, " 70\n%d\n", group->unnamed_flag);
-        fprintf (fp->fp, " 71\n%d\n", group->selectability_flag);
-        fprintf (fp->fp, "340\n%s\n", group->handle_entity_in_group);
+        dxf_write_string (fp, 300, group->description);
+        dxf_write_int (fp, 70, group->unnamed_flag);
+        dxf_write_int (fp, 71, group->selectability_flag);
+        dxf_write_string (fp, 340, group->handle_entity_in_group);
         /* Clean up. */
-        free (dxf_entity_name);
+        dxf_free (dxf_entity_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -415,11 +406,9 @@ dxf_group_free
                 __FUNCTION__);
               return (EXIT_FAILURE);
         }
-        free (group->dictionary_owner_soft);
-        free (group->dictionary_owner_hard);
-        free (group->description);
-        free (group->handle_entity_in_group);
-        free (group);
+        dxf_free (group->description);
+        dxf_free (group->handle_entity_in_group);
+        dxf_free (group);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -465,7 +454,7 @@ dxf_group_free_list
  *
  * \return ID code.
  */
-int
+uint64_t
 dxf_group_get_id_code
 (
         DxfGroup *group
@@ -483,12 +472,6 @@ dxf_group_get_id_code
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (group->id_code < 0)
-        {
-                fprintf (stderr,
-                  (_("Warning in %s () a negative value was found.\n")),
-                  __FUNCTION__);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -504,7 +487,7 @@ dxf_group_set_id_code
 (
         DxfGroup *group,
                 /*!< a pointer to a DXF \c GROUP object. */
-        int id_code
+        uint64_t id_code
                 /*!< Identification number for the entity.\n
                  * This is to be an unique (sequential) number in the DXF
                  * file. */
@@ -521,12 +504,6 @@ dxf_group_set_id_code
                   __FUNCTION__);
                 return (NULL);
         }
-        if (id_code < 0)
-        {
-                fprintf (stderr,
-                  (_("Warning in %s () a negative value was passed.\n")),
-                  __FUNCTION__);
-        }
         group->id_code = id_code;
 #if DEBUG
         DXF_DEBUG_END
@@ -540,10 +517,8 @@ dxf_group_set_id_code
  * \c GROUP object.
  *
  * \return soft pointer to the dictionary owner.
- *
- * \warning No checks are performed on the returned pointer (string).
  */
-char *
+uint64_t
 dxf_group_get_dictionary_owner_soft
 (
         DxfGroup *group
@@ -559,19 +534,12 @@ dxf_group_get_dictionary_owner_soft
                 fprintf (stderr,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
-                return (NULL);
-        }
-        if (group->dictionary_owner_soft ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
+                return (0);
         }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (group->dictionary_owner_soft));
+        return (group->dictionary_owner_soft);
 }
 
 
@@ -584,8 +552,8 @@ dxf_group_set_dictionary_owner_soft
 (
         DxfGroup *group,
                 /*!< a pointer to a DXF \c GROUP object. */
-        char *dictionary_owner_soft
-                /*!< a string containing the pointer to the
+        uint64_t dictionary_owner_soft
+                /*!< the handle of the
                  * dictionary_owner_soft for the entity. */
 )
 {
@@ -600,14 +568,7 @@ dxf_group_set_dictionary_owner_soft
                   __FUNCTION__);
                 return (NULL);
         }
-        if (dictionary_owner_soft == NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was passed.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
-        group->dictionary_owner_soft = strdup (dictionary_owner_soft);
+        group->dictionary_owner_soft = dictionary_owner_soft;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -620,10 +581,8 @@ dxf_group_set_dictionary_owner_soft
  * \c GROUP object.
  *
  * \return soft pointer to the object owner.
- *
- * \warning No checks are performed on the returned pointer (string).
  */
-char *
+uint64_t
 dxf_group_get_object_owner_soft
 (
         DxfGroup *group
@@ -639,19 +598,12 @@ dxf_group_get_object_owner_soft
                 fprintf (stderr,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
-                return (NULL);
-        }
-        if (group->object_owner_soft ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
+                return (0);
         }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (group->object_owner_soft));
+        return (group->object_owner_soft);
 }
 
 
@@ -664,8 +616,8 @@ dxf_group_set_object_owner_soft
 (
         DxfGroup *group,
                 /*!< a pointer to a DXF \c GROUP object. */
-        char *object_owner_soft
-                /*!< a string containing the pointer to the
+        uint64_t object_owner_soft
+                /*!< the handle of the
                  * \c object_owner_soft for the object. */
 )
 {
@@ -680,14 +632,7 @@ dxf_group_set_object_owner_soft
                   __FUNCTION__);
                 return (NULL);
         }
-        if (object_owner_soft == NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was passed.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
-        group->object_owner_soft = strdup (object_owner_soft);
+        group->object_owner_soft = object_owner_soft;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -700,10 +645,8 @@ dxf_group_set_object_owner_soft
  * \c GROUP object.
  *
  * \return hard pointer to the dictionary owner.
- *
- * \warning No checks are performed on the returned pointer (string).
  */
-char *
+uint64_t
 dxf_group_get_dictionary_owner_hard
 (
         DxfGroup *group
@@ -719,19 +662,12 @@ dxf_group_get_dictionary_owner_hard
                 fprintf (stderr,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
-                return (NULL);
-        }
-        if (group->dictionary_owner_hard ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
+                return (0);
         }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (group->dictionary_owner_hard));
+        return (group->dictionary_owner_hard);
 }
 
 
@@ -744,8 +680,8 @@ dxf_group_set_dictionary_owner_hard
 (
         DxfGroup *group,
                 /*!< a pointer to a DXF \c GROUP object. */
-        char *dictionary_owner_hard
-                /*!< a string containing the pointer to the
+        uint64_t dictionary_owner_hard
+                /*!< the handle of the
                  * dictionary_owner_hard for the entity. */
 )
 {
@@ -760,14 +696,7 @@ dxf_group_set_dictionary_owner_hard
                   __FUNCTION__);
                 return (NULL);
         }
-        if (dictionary_owner_hard == NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was passed.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
-        group->dictionary_owner_hard = strdup (dictionary_owner_hard);
+        group->dictionary_owner_hard = dictionary_owner_hard;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -972,7 +901,7 @@ dxf_group_get_description
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (group->description));
+        return (dxf_strdup (group->description));
 }
 
 
@@ -1006,7 +935,7 @@ dxf_group_set_description
                   __FUNCTION__);
                 return (NULL);
         }
-        group->description = strdup (description);
+        group->description = dxf_strdup (description);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1048,7 +977,7 @@ dxf_group_get_handle_entity_in_group
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (group->handle_entity_in_group));
+        return (dxf_strdup (group->handle_entity_in_group));
 }
 
 
@@ -1083,7 +1012,7 @@ dxf_group_set_handle_entity_in_group
                   __FUNCTION__);
                 return (NULL);
         }
-        group->handle_entity_in_group = strdup (handle_entity_in_group);
+        group->handle_entity_in_group = dxf_strdup (handle_entity_in_group);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -60,20 +60,20 @@ typedef struct
 dxf_group_struct
 {
         /* Members common for all DXF group objects. */
-        int id_code;
+        uint64_t id_code;
                 /*!< Identification number for the entity.\n
                  * This is to be an unique (sequential) number in the DXF
                  * file.\n
                  * Group code = 5. */
-        char *dictionary_owner_soft;
+        uint64_t dictionary_owner_soft;
                 /*!< Soft-pointer ID/handle to owner dictionary (optional).\n
                  * Group code = 330.\n
                  * \since Introduced in version R14. */
-        char *object_owner_soft;
+        uint64_t object_owner_soft;
                 /*!< Soft-pointer ID/handle  to owner BLOCK_RECORD object.\n
                  * Group code = 330.\n
                  * \since Introduced in version R2000. */
-        char *dictionary_owner_hard;
+        uint64_t dictionary_owner_hard;
                 /*!< Hard owner ID/handle to owner dictionary (optional).\n
                  * Group code = 360.\n
                  * \since Introduced in version R14. */
@@ -111,14 +111,14 @@ DxfGroup *dxf_group_read (DxfFile *fp, DxfGroup *group);
 int dxf_group_write (DxfFile *fp, DxfGroup *group);
 int dxf_group_free (DxfGroup *group);
 void dxf_group_free_list (DxfGroup *groups);
-int dxf_group_get_id_code (DxfGroup *group);
-DxfGroup *dxf_group_set_id_code (DxfGroup *group, int id_code);
-char *dxf_group_get_dictionary_owner_soft (DxfGroup *group);
-DxfGroup *dxf_group_set_dictionary_owner_soft (DxfGroup *group, char *dictionary_owner_soft);
-char *dxf_group_get_object_owner_soft (DxfGroup *group);
-DxfGroup *dxf_group_set_object_owner_soft (DxfGroup *group, char *object_owner_soft);
-char *dxf_group_get_dictionary_owner_hard (DxfGroup *group);
-DxfGroup *dxf_group_set_dictionary_owner_hard (DxfGroup *group, char *dictionary_owner_hard);
+uint64_t dxf_group_get_id_code (DxfGroup *group);
+DxfGroup *dxf_group_set_id_code (DxfGroup *group, uint64_t id_code);
+uint64_t dxf_group_get_dictionary_owner_soft (DxfGroup *group);
+DxfGroup *dxf_group_set_dictionary_owner_soft (DxfGroup *group, uint64_t dictionary_owner_soft);
+uint64_t dxf_group_get_object_owner_soft (DxfGroup *group);
+DxfGroup *dxf_group_set_object_owner_soft (DxfGroup *group, uint64_t object_owner_soft);
+uint64_t dxf_group_get_dictionary_owner_hard (DxfGroup *group);
+DxfGroup *dxf_group_set_dictionary_owner_hard (DxfGroup *group, uint64_t dictionary_owner_hard);
 int16_t dxf_group_get_unnamed_flag (DxfGroup *group);
 DxfGroup *dxf_group_set_unnamed_flag (DxfGroup *group, int16_t unnamed_flag);
 int16_t dxf_group_get_selectability_flag (DxfGroup *group);
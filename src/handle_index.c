@@ -0,0 +1,598 @@
+/*!
+ * \file handle_index.c
+ *
+ * \author Copyright (C) 2026
+ * by Bert Timmerman <bert.timmerman@xs4all.nl>.
+ *
+ * \brief Functions for a libDXF handle index (handle to object hash
+ * table).
+ *
+ * Entities and objects refer to each other by handle: owners (group
+ * code 330), reactors, dictionary entries (group codes 350 and 360)
+ * and other soft and hard pointers (group code 340).\n
+ * Resolving such a pointer by walking every list of a drawing makes
+ * reactor and dictionary traversal quadratic, the handle index turns
+ * every lookup into one probe of a hash table.
+ *
+ * <hr>
+ * <h1><b>Copyright Notices.</b></h1>\n
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License,
+ * or (at your option) any later version.\n\n
+ * This program is distributed in the hope that it will be useful, but
+ * <b>WITHOUT ANY WARRANTY</b>; without even the implied warranty of
+ * <b>MERCHANTABILITY</b> or <b>FITNESS FOR A PARTICULAR PURPOSE</b>.\n
+ * See the GNU General Public License for more details.\n\n
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to:\n
+ * Free Software Foundation, Inc.,\n
+ * 59 Temple Place,\n
+ * Suite 330,\n
+ * Boston,\n
+ * MA 02111 USA.\n
+ * \n
+ * Drawing eXchange Format (DXF) is a defacto industry standard for the
+ * exchange of drawing files between various Computer Aided Drafting
+ * programs.\n
+ * DXF is an industry standard designed by Autodesk(TM).\n
+ * For more details see http://www.autodesk.com.
+ * <hr>
+ */
+
+
+
+#include <stddef.h>
+
+#include "handle_index.h"
+#include "util.h"
+
+
+/*!
+ * \brief Initial number of slots in the hash table of a
+ * \c DxfHandleIndex.
+ */
+#define DXF_HANDLE_INDEX_INITIAL_CAPACITY 1024
+
+
+/*!
+ * \brief Compute the hash of a handle.
+ *
+ * Handles are mostly consecutive numbers, the bits are mixed with the
+ * finalizer of MurmurHash3 so they spread over the whole table.
+ */
+static size_t
+dxf_handle_index_hash
+(
+        uint64_t handle
+                /*!< the handle. */
+)
+{
+        handle ^= handle >> 33;
+        handle *= 0xff51afd7ed558ccdULL;
+        handle ^= handle >> 33;
+        handle *= 0xc4ceb9fe1a85ec53ULL;
+        handle ^= handle >> 33;
+        return ((size_t) handle);
+}
+
+
+/*!
+ * \brief Find the slot holding a handle, or the empty slot where it
+ * should be inserted.
+ */
+static size_t
+dxf_handle_index_find_slot
+(
+        DxfHandleIndex *index,
+                /*!< a pointer to a libDXF handle index. */
+        uint64_t handle
+                /*!< the handle. */
+)
+{
+        size_t mask = index->capacity - 1;
+        size_t i = dxf_handle_index_hash (handle) & mask;
+
+        while ((index->slots[i].object != NULL)
+          && (index->slots[i].handle != handle))
+        {
+                i = (i + 1) & mask;
+        }
+        return (i);
+}
+
+
+/*!
+ * \brief Double the number of slots in the hash table of a
+ * \c DxfHandleIndex.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+static int
+dxf_handle_index_grow
+(
+        DxfHandleIndex *index
+                /*!< a pointer to a libDXF handle index. */
+)
+{
+        DxfHandleIndexEntry *old_slots = index->slots;
+        size_t old_capacity = index->capacity;
+        size_t i;
+
+        index->capacity = old_capacity * 2;
+        index->slots = calloc (index->capacity, sizeof (DxfHandleIndexEntry));
+        if (index->slots == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () could not allocate memory.\n")),
+                  __FUNCTION__);
+                index->slots = old_slots;
+                index->capacity = old_capacity;
+                return (EXIT_FAILURE);
+        }
+        for (i = 0; i < old_capacity; i++)
+        {
+                if (old_slots[i].object != NULL)
+                {
+                        index->slots[dxf_handle_index_find_slot (index,
+                          old_slots[i].handle)] = old_slots[i];
+                }
+        }
+        free (old_slots);
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Add the objects of a linked list to a libDXF
+ * \c DxfHandleIndex.
+ *
+ * Objects without a handle (an \c id_code of 0) are skipped.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+static int
+dxf_handle_index_add_list
+(
+        DxfHandleIndex *index,
+                /*!< a pointer to a libDXF handle index. */
+        void *object,
+                /*!< the first object of the list, may be \c NULL. */
+        const char *type,
+                /*!< Type name of the objects. */
+        size_t id_code_offset,
+                /*!< Offset of the \c id_code member in the object. */
+        size_t next_offset
+                /*!< Offset of the \c next member in the object. */
+)
+{
+        uint64_t id_code;
+
+        for (; object != NULL; object = *(void **) ((char *) object + next_offset))
+        {
+                id_code = *(uint64_t *) ((char *) object + id_code_offset);
+                if ((id_code != 0)
+                  && (dxf_handle_index_insert (index, id_code,
+                  type, object) == EXIT_FAILURE))
+                {
+                        return (EXIT_FAILURE);
+                }
+        }
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Allocate memory for a libDXF \c DxfHandleIndex.
+ *
+ * \return \c NULL when no memory was allocated, a pointer to the
+ * allocated memory when successful.
+ */
+DxfHandleIndex *
+dxf_handle_index_new ()
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfHandleIndex *index = NULL;
+
+        if ((index = malloc (sizeof (DxfHandleIndex))) == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () could not allocate memory.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        memset (index, 0, sizeof (DxfHandleIndex));
+        index->capacity = DXF_HANDLE_INDEX_INITIAL_CAPACITY;
+        index->slots = calloc (index->capacity, sizeof (DxfHandleIndexEntry));
+        if (index->slots == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () could not allocate memory.\n")),
+                  __FUNCTION__);
+                free (index);
+                return (NULL);
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (index);
+}
+
+
+/*!
+ * \brief Free the allocated memory for a libDXF \c DxfHandleIndex.
+ *
+ * The indexed objects are not freed.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_handle_index_free
+(
+        DxfHandleIndex *index
+                /*!< a pointer to the memory occupied by the libDXF
+                 * handle index. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        /* Do some basic checks. */
+        if (index == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        free (index->slots);
+        free (index);
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Add an object to a libDXF \c DxfHandleIndex.
+ *
+ * An object already indexed with the same handle is replaced.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_handle_index_insert
+(
+        DxfHandleIndex *index,
+                /*!< a pointer to a libDXF handle index. */
+        uint64_t handle,
+                /*!< the handle of \c object. */
+        const char *type,
+                /*!< Type name of \c object, for example "LINE" (not
+                 * copied). */
+        void *object
+                /*!< the entity or table entry. */
+)
+{
+        size_t i;
+
+        /* Do some basic checks. */
+        if ((index == NULL) || (object == NULL))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        i = dxf_handle_index_find_slot (index, handle);
+        if (index->slots[i].object == NULL)
+        {
+                /* Keep the load factor at or below one half. */
+                if (2 * (index->count + 1) > index->capacity)
+                {
+                        if (dxf_handle_index_grow (index) == EXIT_FAILURE)
+                        {
+                                return (EXIT_FAILURE);
+                        }
+                        i = dxf_handle_index_find_slot (index, handle);
+                }
+                index->count++;
+        }
+        index->slots[i].handle = handle;
+        index->slots[i].type = type;
+        index->slots[i].object = object;
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Look up a handle in a libDXF \c DxfHandleIndex.
+ *
+ * \return a pointer to the object with \c handle, or \c NULL when the
+ * handle is not in the index.
+ */
+void *
+dxf_handle_index_lookup
+(
+        DxfHandleIndex *index,
+                /*!< a pointer to a libDXF handle index. */
+        uint64_t handle,
+                /*!< the handle to look up. */
+        const char **type
+                /*!< Returns the type name of the object, may be
+                 * \c NULL. */
+)
+{
+        DxfHandleIndexEntry *entry;
+
+        /* Do some basic checks. */
+        if (index == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        entry = &index->slots[dxf_handle_index_find_slot (index, handle)];
+        if (type != NULL)
+        {
+                *type = entry->type;
+        }
+        return (entry->object);
+}
+
+
+/*!
+ * \brief Resolve a pointer to an object in a libDXF
+ * \c DxfHandleIndex.
+ *
+ * \c pointer is the value of a soft or hard pointer as read from a DXF
+ * file (group codes 330, 340, 350 and 360), the handle of the object
+ * in hexadecimal.
+ *
+ * \return a pointer to the object, or \c NULL when \c pointer is not a
+ * handle or the handle is not in the index.
+ */
+void *
+dxf_handle_index_resolve
+(
+        DxfHandleIndex *index,
+                /*!< a pointer to a libDXF handle index. */
+        const char *pointer,
+                /*!< the pointer, a hexadecimal handle. */
+        const char **type
+                /*!< Returns the type name of the object, may be
+                 * \c NULL. */
+)
+{
+        long long handle;
+
+        if (type != NULL)
+        {
+                *type = NULL;
+        }
+        /* Do some basic checks. */
+        if ((index == NULL) || (pointer == NULL))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        if ((dxf_reader_parse_long (pointer, strlen (pointer), 16, &handle) == EXIT_FAILURE)
+          || (handle == 0))
+        {
+                return (NULL);
+        }
+        return (dxf_handle_index_lookup (index, (uint64_t) handle, type));
+}
+
+
+/*!
+ * \brief Add the entities of a DXF \c ENTITIES section to a libDXF
+ * \c DxfHandleIndex.
+ *
+ * The vertices of polylines are added as well.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_handle_index_add_entities
+(
+        DxfHandleIndex *index,
+                /*!< a pointer to a libDXF handle index. */
+        DxfEntities *entities
+                /*!< Pointer to the DXF \c ENTITIES section. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfEntitiesCursor cursor;
+        const char *type;
+        uint64_t id_code;
+
+        /* Do some basic checks. */
+        if ((index == NULL) || (entities == NULL))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        dxf_entities_cursor_init (&cursor, entities);
+        while (cursor.entity != NULL)
+        {
+                type = dxf_entities_cursor_get_type (&cursor);
+                id_code = dxf_entities_cursor_get_id_code (&cursor);
+                if ((id_code != 0)
+                  && (dxf_handle_index_insert (index, id_code,
+                  type, cursor.entity) == EXIT_FAILURE))
+                {
+                        return (EXIT_FAILURE);
+                }
+                if ((strcmp (type, "POLYLINE") == 0)
+                  && (dxf_handle_index_add_list (index,
+                  ((DxfPolyline *) cursor.entity)->vertices, "VERTEX",
+                  offsetof (DxfVertex, id_code), offsetof (DxfVertex, next)) == EXIT_FAILURE))
+                {
+                        return (EXIT_FAILURE);
+                }
+                dxf_entities_cursor_skip (&cursor, 1);
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Add the table entries of a DXF \c TABLES section to a libDXF
+ * \c DxfHandleIndex.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_handle_index_add_tables
+(
+        DxfHandleIndex *index,
+                /*!< a pointer to a libDXF handle index. */
+        DxfTables *tables
+                /*!< Pointer to the DXF \c TABLES section. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        int result = EXIT_SUCCESS;
+
+        /* Do some basic checks. */
+        if ((index == NULL) || (tables == NULL))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+#define DXF_HANDLE_INDEX_ADD_TABLE(list, type, Type) \
+        if (result == EXIT_SUCCESS) \
+        { \
+                result = dxf_handle_index_add_list (index, tables->list, type, \
+                  offsetof (Type, id_code), offsetof (Type, next)); \
+        }
+        DXF_HANDLE_INDEX_ADD_TABLE (appids, "APPID", DxfAppid)
+        DXF_HANDLE_INDEX_ADD_TABLE (block_records, "BLOCK_RECORD", DxfBlockRecord)
+        DXF_HANDLE_INDEX_ADD_TABLE (dimstyles, "DIMSTYLE", DxfDimStyle)
+        DXF_HANDLE_INDEX_ADD_TABLE (layers, "LAYER", DxfLayer)
+        DXF_HANDLE_INDEX_ADD_TABLE (ltypes, "LTYPE", DxfLType)
+        DXF_HANDLE_INDEX_ADD_TABLE (styles, "STYLE", DxfStyle)
+        DXF_HANDLE_INDEX_ADD_TABLE (ucss, "UCS", DxfUcs)
+        DXF_HANDLE_INDEX_ADD_TABLE (views, "VIEW", DxfView)
+        DXF_HANDLE_INDEX_ADD_TABLE (vports, "VPORT", DxfVPort)
+#undef DXF_HANDLE_INDEX_ADD_TABLE
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (result);
+}
+
+
+/*!
+ * \brief Add the block definitions of a DXF \c BLOCKS section to a
+ * libDXF \c DxfHandleIndex.
+ *
+ * Every \c BLOCK, it's entities (see dxf_handle_index_add_entities ())
+ * and it's \c ENDBLK marker are added.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_handle_index_add_blocks
+(
+        DxfHandleIndex *index,
+                /*!< a pointer to a libDXF handle index. */
+        DxfBlock *blocks
+                /*!< Pointer to the first block definition of the DXF
+                 * \c BLOCKS section. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfBlock *block;
+        DxfEndblk *endblk;
+
+        /* Do some basic checks. */
+        if (index == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        for (block = blocks; block != NULL; block = (DxfBlock *) block->next)
+        {
+                if ((block->id_code != DXF_HANDLE_NONE)
+                  && (dxf_handle_index_insert (index, block->id_code,
+                  "BLOCK", block) == EXIT_FAILURE))
+                {
+                        return (EXIT_FAILURE);
+                }
+                if ((block->entities != NULL)
+                  && (dxf_handle_index_add_entities (index,
+                  (DxfEntities *) block->entities) == EXIT_FAILURE))
+                {
+                        return (EXIT_FAILURE);
+                }
+                endblk = (DxfEndblk *) block->endblk;
+                if ((endblk != NULL)
+                  && (endblk->id_code != DXF_HANDLE_NONE)
+                  && (dxf_handle_index_insert (index, endblk->id_code,
+                  "ENDBLK", endblk) == EXIT_FAILURE))
+                {
+                        return (EXIT_FAILURE);
+                }
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Get the number of objects in a libDXF \c DxfHandleIndex.
+ *
+ * \return the number of indexed objects.
+ */
+size_t
+dxf_handle_index_get_count
+(
+        DxfHandleIndex *index
+                /*!< a pointer to a libDXF handle index. */
+)
+{
+        /* Do some basic checks. */
+        if (index == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (0);
+        }
+        return (index->count);
+}
+
+
+/* EOF */
@@ -0,0 +1,110 @@
+/*!
+ * \file handle_index.h
+ *
+ * \author Copyright (C) 2026
+ * by Bert Timmerman <bert.timmerman@xs4all.nl>.
+ *
+ * \brief Prototypes for a libDXF handle index (handle to object hash
+ * table).
+ *
+ * <hr>
+ * <h1><b>Copyright Notices.</b></h1>\n
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License,
+ * or (at your option) any later version.\n\n
+ * This program is distributed in the hope that it will be useful, but
+ * <b>WITHOUT ANY WARRANTY</b>; without even the implied warranty of
+ * <b>MERCHANTABILITY</b> or <b>FITNESS FOR A PARTICULAR PURPOSE</b>.\n
+ * See the GNU General Public License for more details.\n\n
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to:\n
+ * Free Software Foundation, Inc.,\n
+ * 59 Temple Place,\n
+ * Suite 330,\n
+ * Boston,\n
+ * MA 02111 USA.\n
+ * \n
+ * Drawing eXchange Format (DXF) is a defacto industry standard for the
+ * exchange of drawing files between various Computer Aided Drafting
+ * programs.\n
+ * DXF is an industry standard designed by Autodesk(TM).\n
+ * For more details see http://www.autodesk.com.
+ * <hr>
+ */
+
+
+
+#ifndef LIBDXF_SRC_HANDLE_INDEX_H
+#define LIBDXF_SRC_HANDLE_INDEX_H
+
+
+#include "global.h"
+#include "entities.h"
+#include "tables.h"
+#include "block.h"
+
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+/*!
+ * \brief DXF definition of a slot in a \c DxfHandleIndex.
+ */
+typedef struct
+dxf_handle_index_entry_struct
+{
+    uint64_t handle;
+        /*!< Handle (group code 5) of \c object. */
+    const char *type;
+        /*!< Type name of \c object, for example "LINE" or "LAYER"
+         * (not owned). */
+    void *object;
+        /*!< The entity or table entry, \c NULL for an empty slot. */
+} DxfHandleIndexEntry;
+
+
+/*!
+ * \brief DXF definition of a handle index.
+ *
+ * An open addressing hash table mapping the handles of the entities
+ * and table entries of a drawing to the objects themselves, so the
+ * soft and hard pointers (group codes 330, 340, 350 and 360) can be
+ * resolved without walking every list.\n
+ * The index does not own the objects, it has to be rebuilt or freed
+ * when objects are freed.
+ */
+typedef struct
+dxf_handle_index_struct
+{
+    DxfHandleIndexEntry *slots;
+        /*!< The hash table. */
+    size_t capacity;
+        /*!< Number of slots, always a power of two. */
+    size_t count;
+        /*!< Number of objects in the index. */
+} DxfHandleIndex;
+
+
+DxfHandleIndex *dxf_handle_index_new ();
+int dxf_handle_index_free (DxfHandleIndex *index);
+int dxf_handle_index_insert (DxfHandleIndex *index, uint64_t handle, const char *type, void *object);
+void *dxf_handle_index_lookup (DxfHandleIndex *index, uint64_t handle, const char **type);
+void *dxf_handle_index_resolve (DxfHandleIndex *index, const char *pointer, const char **type);
+int dxf_handle_index_add_entities (DxfHandleIndex *index, DxfEntities *entities);
+int dxf_handle_index_add_tables (DxfHandleIndex *index, DxfTables *tables);
+int dxf_handle_index_add_blocks (DxfHandleIndex *index, DxfBlock *blocks);
+size_t dxf_handle_index_get_count (DxfHandleIndex *index);
+
+
+#ifdef __cplusplus
+}
+#endif
+
+
+#endif /* LIBDXF_SRC_HANDLE_INDEX_H */
+
+
+/* EOF */
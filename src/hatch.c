@@ -40,6 +40,8 @@
 
 
 #include "hatch.h"
+#include "bbox.h"
+#include "util.h"
 
 
 /* dxf_hatch functions. */
@@ -61,7 +63,7 @@ dxf_hatch_new ()
         size = sizeof (DxfHatch);
         /* avoid malloc of 0 bytes */
         if (size == 0) size = 1;
-        if ((hatch = malloc (size)) == NULL)
+        if ((hatch = dxf_malloc (size)) == NULL)
         {
                 fprintf (stderr,
                   (_("Error in %s () could not allocate memory.\n")),
@@ -112,9 +114,9 @@ dxf_hatch_init
                 return (NULL);
         }
         /* Assign initial values to members. */
-        hatch->id_code = 0;
-        hatch->linetype = strdup (DXF_DEFAULT_LINETYPE);
-        hatch->layer = strdup (DXF_DEFAULT_LAYER);
+        hatch->id_code = DXF_HANDLE_NONE;
+        hatch->linetype = dxf_strdup (DXF_DEFAULT_LINETYPE);
+        hatch->layer = dxf_strdup (DXF_DEFAULT_LAYER);
         hatch->elevation = 0.0;
         hatch->thickness = 0.0;
         hatch->linetype_scale = DXF_DEFAULT_LINETYPE_SCALE;
@@ -123,16 +125,16 @@ dxf_hatch_init
         hatch->paperspace = DXF_MODELSPACE;
         hatch->graphics_data_size = 0;
         hatch->shadow_mode = 0;
-        hatch->dictionary_owner_soft = strdup ("");
-        hatch->object_owner_soft = strdup ("");
-        hatch->material = strdup ("");
-        hatch->dictionary_owner_hard = strdup ("");
+        hatch->dictionary_owner_soft = 0;
+        hatch->object_owner_soft = 0;
+        hatch->material = 0;
+        hatch->dictionary_owner_hard = 0;
         hatch->lineweight = 0;
-        hatch->plot_style_name = strdup ("");
+        hatch->plot_style_name = 0;
         hatch->color_value = 0;
-        hatch->color_name = strdup ("");
+        hatch->color_name = dxf_strdup ("");
         hatch->transparency = 0;
-        hatch->pattern_name = strdup ("");
+        hatch->pattern_name = dxf_strdup ("");
         hatch->pattern_scale = 1.0;
         hatch->pixel_size = 1.0;
         hatch->pattern_angle = 0.0;
@@ -178,7 +180,7 @@ dxf_hatch_write
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        char *dxf_entity_name = strdup ("HATCH");
+        char *dxf_entity_name = dxf_strdup ("HATCH");
         DxfHatchPatternDefLine *line = NULL;
         DxfHatchPatternSeedPoint *point = NULL;
 
@@ -189,7 +191,7 @@ dxf_hatch_write
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (fp->acad_version_number < AutoCAD_14)
@@ -198,7 +200,7 @@ dxf_hatch_write
                   (_("Error in %s () illegal DXF version for this entity.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (hatch == NULL)
@@ -207,7 +209,7 @@ dxf_hatch_write
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (hatch->p0 == NULL)
@@ -216,34 +218,34 @@ dxf_hatch_write
                   (_("Error in %s () a NULL pointer was found.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (strcmp (hatch->layer, "") == 0)
         {
                 fprintf (stderr,
-                  (_("Warning: empty layer string for the %s entity with id-code: %x\n")),
+                  (_("Warning: empty layer string for the %s entity with id-code: %" PRIx64 "\n")),
                         dxf_entity_name, hatch->id_code);
                 fprintf (stderr,
                   (_("    %s entity is relocated to layer 0")),
                         dxf_entity_name);
-                hatch->layer = strdup (DXF_DEFAULT_LAYER);
+                hatch->layer = dxf_strdup (DXF_DEFAULT_LAYER);
         }
         if (strcmp (hatch->linetype, "") == 0)
         {
                 fprintf (stderr,
-                  (_("Warning: empty linetype string for the %s entity with id-code: %x\n")),
+                  (_("Warning: empty linetype string for the %s entity with id-code: %" PRIx64 "\n")),
                         dxf_entity_name, hatch->id_code);
                 fprintf (stderr,
                   (_("    %s entity is reset to default linetype")),
                         dxf_entity_name);
-                hatch->linetype = strdup (DXF_DEFAULT_LINETYPE);
+                hatch->linetype = dxf_strdup (DXF_DEFAULT_LINETYPE);
         }
         /* Start writing output. */
-        fprintf (fp->fp, "  0\n%s\n", dxf_entity_name);
-        if (hatch->id_code != -1)
+        dxf_write_string (fp, 0, dxf_entity_name);
+        if (hatch->id_code != DXF_HANDLE_NONE)
         {
-                fprintf (fp->fp, "  5\n%x\n", hatch->id_code);
+                dxf_write_hex (fp, 5, hatch->id_code);
         }
         /*!
          * \todo for version R14.\n
@@ -255,75 +257,75 @@ dxf_hatch_write
          * 102 groups are application defined (optional).\n\n
          * End of group, "}" (optional), with Group code 102.
          */
-        if ((strcmp (hatch->dictionary_owner_soft, "") != 0)
+        if ((hatch->dictionary_owner_soft != 0)
           && (fp->acad_version_number >= AutoCAD_14))
         {
-                fprintf (fp->fp, "102\n{ACAD_REACTORS\n");
-                fprintf (fp->fp, "330\n%s\n", hatch->dictionary_owner_soft);
-                fprintf (fp->fp, "102\n}\n");
+                dxf_write_string (fp, 102, "{ACAD_REACTORS");
+                dxf_write_hex (fp, 330, hatch->dictionary_owner_soft);
+                dxf_write_string (fp, 102, "}");
         }
-        if ((strcmp (hatch->dictionary_owner_hard, "") != 0)
+        if ((hatch->dictionary_owner_hard != 0)
           && (fp->acad_version_number >= AutoCAD_14))
         {
-                fprintf (fp->fp, "102\n{ACAD_XDICTIONARY\n");
-                fprintf (fp->fp, "360\n%s\n", hatch->dictionary_owner_hard);
-                fprintf (fp->fp, "102\n}\n");
+                dxf_write_string (fp, 102, "{ACAD_XDICTIONARY");
+                dxf_write_hex (fp, 360, hatch->dictionary_owner_hard);
+                dxf_write_string (fp, 102, "}");
         }
-        if ((strcmp (hatch->object_owner_soft, "") != 0)
+        if ((hatch->object_owner_soft != 0)
           && (fp->acad_version_number >= AutoCAD_2000))
         {
-                fprintf (fp->fp, "330\n%s\n", hatch->object_owner_soft);
+                dxf_write_hex (fp, 330, hatch->object_owner_soft);
         }
         if (fp->acad_version_number >= AutoCAD_13)
         {
-                fprintf (fp->fp, "100\nAcDbEntity\n");
+                dxf_write_string (fp, 100, "AcDbEntity");
         }
         if (hatch->paperspace == DXF_PAPERSPACE)
         {
-                fprintf (fp->fp, " 67\n%hd\n", (int16_t) DXF_PAPERSPACE);
+                dxf_write_int (fp, 67, (int16_t) DXF_PAPERSPACE);
         }
-        fprintf (fp->fp, "  8\n%s\n", hatch->layer);
+        dxf_write_string (fp, 8, hatch->layer);
         if (strcmp (hatch->linetype, DXF_DEFAULT_LINETYPE) != 0)
         {
-                fprintf (fp->fp, "  6\n%s\n", hatch->linetype);
+                dxf_write_string (fp, 6, hatch->linetype);
         }
         if ((fp->acad_version_number >= AutoCAD_2008)
-          && (strcmp (hatch->material, "") != 0))
+          && (hatch->material != 0))
         {
-                fprintf (fp->fp, "347\n%s\n", hatch->material);
+                dxf_write_hex (fp, 347, hatch->material);
         }
         if (hatch->color != DXF_COLOR_BYLAYER)
         {
-                fprintf (fp->fp, " 62\n%hd\n", hatch->color);
+                dxf_write_int (fp, 62, hatch->color);
         }
         if (fp->acad_version_number >= AutoCAD_2002)
         {
-                fprintf (fp->fp, "370\n%d\n", hatch->lineweight);
+                dxf_write_int (fp, 370, hatch->lineweight);
         }
         if ((fp->acad_version_number <= AutoCAD_11)
           && DXF_FLATLAND
           && (hatch->elevation != 0.0))
         {
-                fprintf (fp->fp, " 38\n%f\n", hatch->elevation);
+                dxf_write_double (fp, 38, hatch->elevation);
         }
         if (hatch->thickness != 0.0)
         {
-                fprintf (fp->fp, " 39\n%f\n", hatch->thickness);
+                dxf_write_double (fp, 39, hatch->thickness);
         }
         if (hatch->linetype_scale != 1.0)
         {
-                fprintf (fp->fp, " 48\n%f\n", hatch->linetype_scale);
+                dxf_write_double (fp, 48, hatch->linetype_scale);
         }
         if (hatch->visibility != 0)
         {
-                fprintf (fp->fp, " 60\n%hd\n", hatch->visibility);
+                dxf_write_int (fp, 60, hatch->visibility);
         }
         if (fp->acad_version_number >= AutoCAD_2000)
         {
 #ifdef BUILD_64
-                fprintf (fp->fp, "160\n%" PRIi32 "\n", hatch->graphics_data_size);
+                dxf_write_int (fp, 160, hatch->graphics_data_size);
 #else
-                fprintf (fp->fp, " 92\n%" PRIi32 "\n", hatch->graphics_data_size);
+                dxf_write_int (fp, 92, hatch->graphics_data_size);
 #endif
                 if (hatch->binary_graphics_data != NULL)
                 {
@@ -331,51 +333,51 @@ dxf_hatch_write
                         iter = (DxfBinaryData *) hatch->binary_graphics_data;
                         while (iter != NULL)
                         {
-                                fprintf (fp->fp, "310\n%s\n", iter->data_line);
+                                dxf_write_string (fp, 310, iter->data_line);
                                 iter = (DxfBinaryData *) iter->next;
                         }
                 }
         }
         if (fp->acad_version_number >= AutoCAD_2004)
         {
-                fprintf (fp->fp, "420\n%" PRIi32 "\n", hatch->color_value);
-                fprintf (fp->fp, "430\n%s\n", hatch->color_name);
-                fprintf (fp->fp, "440\n%" PRIi32 "\n", hatch->transparency);
+                dxf_write_int (fp, 420, hatch->color_value);
+                dxf_write_string (fp, 430, hatch->color_name);
+                dxf_write_int (fp, 440, hatch->transparency);
         }
         if (fp->acad_version_number >= AutoCAD_2009)
         {
-                fprintf (fp->fp, "390\n%s\n", hatch->plot_style_name);
-                fprintf (fp->fp, "284\n%hd\n", hatch->shadow_mode);
-        }
-        fprintf (fp->fp, "100\nAcDbHatch\n");
-        fprintf (fp->fp, " 10\n%f\n", hatch->p0->x0);
-        fprintf (fp->fp, " 20\n%f\n", hatch->p0->y0);
-        fprintf (fp->fp, " 30\n%f\n", hatch->p0->z0);
-        fprintf (fp->fp, "210\n%f\n", hatch->extr_x0);
-        fprintf (fp->fp, "220\n%f\n", hatch->extr_y0);
-        fprintf (fp->fp, "230\n%f\n", hatch->extr_z0);
-        fprintf (fp->fp, "  2\n%s\n", hatch->pattern_name);
-        fprintf (fp->fp, " 70\n%hd\n", hatch->solid_fill);
-        fprintf (fp->fp, " 71\n%hd\n", hatch->associative);
-        fprintf (fp->fp, " 91\n%" PRIi32 "\n", hatch->number_of_boundary_paths);
+                dxf_write_hex (fp, 390, hatch->plot_style_name);
+                dxf_write_int (fp, 284, hatch->shadow_mode);
+        }
+        dxf_write_string (fp, 100, "AcDbHatch");
+        dxf_write_double (fp, 10, hatch->p0->x0);
+        dxf_write_double (fp, 20, hatch->p0->y0);
+        dxf_write_double (fp, 30, hatch->p0->z0);
+        dxf_write_double (fp, 210, hatch->extr_x0);
+        dxf_write_double (fp, 220, hatch->extr_y0);
+        dxf_write_double (fp, 230, hatch->extr_z0);
+        dxf_write_string (fp, 2, hatch->pattern_name);
+        dxf_write_int (fp, 70, hatch->solid_fill);
+        dxf_write_int (fp, 71, hatch->associative);
+        dxf_write_int (fp, 91, hatch->number_of_boundary_paths);
         dxf_hatch_boundary_path_write (fp, (DxfHatchBoundaryPath *) hatch->paths);
-        fprintf (fp->fp, " 75\n%hd\n", hatch->hatch_style);
-        fprintf (fp->fp, " 76\n%hd\n", hatch->hatch_pattern_type);
+        dxf_write_int (fp, 75, hatch->hatch_style);
+        dxf_write_int (fp, 76, hatch->hatch_pattern_type);
         if (!hatch->solid_fill)
         {
-                fprintf (fp->fp, " 52\n%f\n", hatch->pattern_angle);
-                fprintf (fp->fp, " 41\n%f\n", hatch->pattern_scale);
-                fprintf (fp->fp, " 77\n%hd\n", hatch->pattern_double);
+                dxf_write_double (fp, 52, hatch->pattern_angle);
+                dxf_write_double (fp, 41, hatch->pattern_scale);
+                dxf_write_int (fp, 77, hatch->pattern_double);
         }
-        fprintf (fp->fp, " 78\n%hd\n", hatch->number_of_pattern_def_lines);
+        dxf_write_int (fp, 78, hatch->number_of_pattern_def_lines);
         line = (DxfHatchPatternDefLine *) hatch->def_lines;
         while (line != NULL)
         {
                 dxf_hatch_pattern_def_line_write (fp, (DxfHatchPatternDefLine *) line);
                 line = (DxfHatchPatternDefLine *) line->next;
         }
-        fprintf (fp->fp, " 47\n%f\n", hatch->pixel_size);
-        fprintf (fp->fp, " 98\n%" PRIi32 "\n", hatch->number_of_seed_points);
+        dxf_write_double (fp, 47, hatch->pixel_size);
+        dxf_write_int (fp, 98, hatch->number_of_seed_points);
         point = (DxfHatchPatternSeedPoint *) hatch->seed_points;
         while (point != NULL)
         {
@@ -385,7 +387,7 @@ dxf_hatch_write
         /* Clean up. */
         dxf_hatch_pattern_def_line_free (line);
         dxf_hatch_pattern_seedpoint_free (point);
-        free (dxf_entity_name);
+        dxf_free (dxf_entity_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -426,21 +428,17 @@ dxf_hatch_free
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        free (hatch->linetype);
-        free (hatch->layer);
+        dxf_string_free (hatch->linetype);
+        dxf_string_free (hatch->layer);
         dxf_binary_data_free_list ((DxfBinaryData *) hatch->binary_graphics_data);
-        free (hatch->dictionary_owner_soft);
-        free (hatch->material);
-        free (hatch->dictionary_owner_hard);
-        free (hatch->plot_style_name);
-        free (hatch->color_name);
-        free (hatch->pattern_name);
+        dxf_string_free (hatch->color_name);
+        dxf_free (hatch->pattern_name);
         dxf_point_free ((DxfPoint *) hatch->p0);
         dxf_hatch_boundary_path_free_list ((DxfHatchBoundaryPath *) hatch->paths);
         dxf_hatch_pattern_free_list ((DxfHatchPattern *) hatch->patterns);
         dxf_hatch_pattern_def_line_free_list ((DxfHatchPatternDefLine *) hatch->def_lines);
         dxf_hatch_pattern_seedpoint_free_list ((DxfHatchPatternSeedPoint *) hatch->seed_points);
-        free (hatch);
+        dxf_free (hatch);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -487,7 +485,7 @@ dxf_hatch_free_list
  *
  * \return ID code.
  */
-int
+uint64_t
 dxf_hatch_get_id_code
 (
         DxfHatch *hatch
@@ -505,12 +503,6 @@ dxf_hatch_get_id_code
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (hatch->id_code < 0)
-        {
-                fprintf (stderr,
-                  (_("Warning in %s () a negative value was found.\n")),
-                  __FUNCTION__);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -526,7 +518,7 @@ dxf_hatch_set_id_code
 (
         DxfHatch *hatch,
                 /*!< a pointer to a DXF \c HATCH pattern. */
-        int id_code
+        uint64_t id_code
                 /*!< Identification number for the entity.\n
                  * This is to be an unique (sequential) number in the DXF
                  * file. */
@@ -543,12 +535,6 @@ dxf_hatch_set_id_code
                   __FUNCTION__);
                 return (NULL);
         }
-        if (id_code < 0)
-        {
-                fprintf (stderr,
-                  (_("Warning in %s () a negative value was passed.\n")),
-                  __FUNCTION__);
-        }
         hatch->id_code = id_code;
 #if DEBUG
         DXF_DEBUG_END
@@ -590,7 +576,7 @@ dxf_hatch_get_linetype
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (hatch->linetype));
+        return (dxf_strdup (hatch->linetype));
 }
 
 
@@ -624,7 +610,7 @@ dxf_hatch_set_linetype
                   __FUNCTION__);
                 return (NULL);
         }
-        hatch->linetype = strdup (linetype);
+        hatch->linetype = dxf_strdup (linetype);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -665,7 +651,7 @@ dxf_hatch_get_layer
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (hatch->layer));
+        return (dxf_strdup (hatch->layer));
 }
 
 
@@ -699,7 +685,7 @@ dxf_hatch_set_layer
                   __FUNCTION__);
                 return (NULL);
         }
-        hatch->layer = strdup (layer);
+        hatch->layer = dxf_strdup (layer);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1330,10 +1316,8 @@ dxf_hatch_set_binary_graphics_data
  * \c HATCH entity.
  *
  * \return soft pointer to the dictionary owner.
- *
- * \warning No checks are performed on the returned pointer (string).
  */
-char *
+uint64_t
 dxf_hatch_get_dictionary_owner_soft
 (
         DxfHatch *hatch
@@ -1349,19 +1333,12 @@ dxf_hatch_get_dictionary_owner_soft
                 fprintf (stderr,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
-                return (NULL);
-        }
-        if (hatch->dictionary_owner_soft ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
+                return (0);
         }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (hatch->dictionary_owner_soft));
+        return (hatch->dictionary_owner_soft);
 }
 
 
@@ -1374,8 +1351,8 @@ dxf_hatch_set_dictionary_owner_soft
 (
         DxfHatch *hatch,
                 /*!< a pointer to a DXF \c HATCH entity. */
-        char *dictionary_owner_soft
-                /*!< a string containing the pointer to the
+        uint64_t dictionary_owner_soft
+                /*!< the handle of the
                  * dictionary_owner_soft for the entity. */
 )
 {
@@ -1390,14 +1367,7 @@ dxf_hatch_set_dictionary_owner_soft
                   __FUNCTION__);
                 return (NULL);
         }
-        if (dictionary_owner_soft == NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was passed.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
-        hatch->dictionary_owner_soft = strdup (dictionary_owner_soft);
+        hatch->dictionary_owner_soft = dictionary_owner_soft;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1410,10 +1380,8 @@ dxf_hatch_set_dictionary_owner_soft
  * \c HATCH entity.
  *
  * \return soft pointer to the object_owner.
- *
- * \warning No checks are performed on the returned pointer (string).
  */
-char *
+uint64_t
 dxf_hatch_get_object_owner_soft
 (
         DxfHatch *hatch
@@ -1429,19 +1397,12 @@ dxf_hatch_get_object_owner_soft
                 fprintf (stderr,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
-                return (NULL);
-        }
-        if (hatch->object_owner_soft ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
+                return (0);
         }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (hatch->object_owner_soft));
+        return (hatch->object_owner_soft);
 }
 
 
@@ -1454,8 +1415,8 @@ dxf_hatch_set_object_owner_soft
 (
         DxfHatch *hatch,
                 /*!< a pointer to a DXF \c HATCH entity. */
-        char *object_owner_soft
-                /*!< a string containing the pointer to the
+        uint64_t object_owner_soft
+                /*!< the handle of the
                  * \c object_owner_soft for the entity. */
 )
 {
@@ -1470,14 +1431,7 @@ dxf_hatch_set_object_owner_soft
                   __FUNCTION__);
                 return (NULL);
         }
-        if (object_owner_soft == NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was passed.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
-        hatch->object_owner_soft = strdup (object_owner_soft);
+        hatch->object_owner_soft = object_owner_soft;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1488,12 +1442,10 @@ dxf_hatch_set_object_owner_soft
 /*!
  * \brief Get the pointer to the \c material from a DXF \c HATCH entity.
  *
- * \return a pointer to \c material when successful, or \c NULL when an
+ * \return the handle \c material when successful, or 0 when an
  * error occurred.
- *
- * \warning No checks are performed on the returned pointer.
  */
-char *
+uint64_t
 dxf_hatch_get_material
 (
         DxfHatch *hatch
@@ -1509,19 +1461,12 @@ dxf_hatch_get_material
                 fprintf (stderr,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
-                return (NULL);
-        }
-        if (hatch->material ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
+                return (0);
         }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (hatch->material));
+        return (hatch->material);
 }
 
 
@@ -1536,8 +1481,8 @@ dxf_hatch_set_material
 (
         DxfHatch *hatch,
                 /*!< a pointer to a DXF \c HATCH entity. */
-        char *material
-                /*!< a string containing the pointer to the \c
+        uint64_t material
+                /*!< the handle of the \c
                  * material for the entity. */
 )
 {
@@ -1552,14 +1497,7 @@ dxf_hatch_set_material
                   __FUNCTION__);
                 return (NULL);
         }
-        if (material == NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was passed.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
-        hatch->material = strdup (material);
+        hatch->material = material;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1572,10 +1510,8 @@ dxf_hatch_set_material
  * \c HATCH entity.
  *
  * \return hard pointer to the dictionary owner.
- *
- * \warning No checks are performed on the returned pointer (string).
  */
-char *
+uint64_t
 dxf_hatch_get_dictionary_owner_hard
 (
         DxfHatch *hatch
@@ -1591,19 +1527,12 @@ dxf_hatch_get_dictionary_owner_hard
                 fprintf (stderr,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
-                return (NULL);
-        }
-        if (hatch->dictionary_owner_hard ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
+                return (0);
         }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (hatch->dictionary_owner_hard));
+        return (hatch->dictionary_owner_hard);
 }
 
 
@@ -1616,8 +1545,8 @@ dxf_hatch_set_dictionary_owner_hard
 (
         DxfHatch *hatch,
                 /*!< a pointer to a DXF \c HATCH entity. */
-        char *dictionary_owner_hard
-                /*!< a string containing the pointer to the
+        uint64_t dictionary_owner_hard
+                /*!< the handle of the
                  * dictionary_owner_hard for the entity. */
 )
 {
@@ -1632,14 +1561,7 @@ dxf_hatch_set_dictionary_owner_hard
                   __FUNCTION__);
                 return (NULL);
         }
-        if (dictionary_owner_hard == NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was passed.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
-        hatch->dictionary_owner_hard = strdup (dictionary_owner_hard);
+        hatch->dictionary_owner_hard = dictionary_owner_hard;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1739,10 +1661,10 @@ dxf_hatch_set_lineweight
 /*!
  * \brief Get the \c plot_style_name from a DXF \c HATCH entity.
  *
- * \return a pointer to \c plot_style_name when sucessful, or \c NULL
+ * \return the handle \c plot_style_name when sucessful, or 0
  * when an error occurred.
  */
-char *
+uint64_t
 dxf_hatch_get_plot_style_name
 (
         DxfHatch *hatch
@@ -1758,19 +1680,12 @@ dxf_hatch_get_plot_style_name
                 fprintf (stderr,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
-                return (NULL);
-        }
-        if (hatch->plot_style_name ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
+                return (0);
         }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (hatch->plot_style_name));
+        return (hatch->plot_style_name);
 }
 
 
@@ -1785,7 +1700,7 @@ dxf_hatch_set_plot_style_name
 (
         DxfHatch *hatch,
                 /*!< a pointer to a DXF \c HATCH entity. */
-        char *plot_style_name
+        uint64_t plot_style_name
                 /*!< a string containing the \c plot_style_name for the
                  * entity. */
 )
@@ -1801,14 +1716,7 @@ dxf_hatch_set_plot_style_name
                   __FUNCTION__);
                 return (NULL);
         }
-        if (plot_style_name == NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was passed.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
-        hatch->plot_style_name = strdup (plot_style_name);
+        hatch->plot_style_name = plot_style_name;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1915,7 +1823,7 @@ dxf_hatch_get_color_name
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (hatch->color_name));
+        return (dxf_strdup (hatch->color_name));
 }
 
 
@@ -1953,7 +1861,7 @@ dxf_hatch_set_color_name
                   __FUNCTION__);
                 return (NULL);
         }
-        hatch->color_name = strdup (color_name);
+        hatch->color_name = dxf_strdup (color_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2059,7 +1967,7 @@ dxf_hatch_get_pattern_name
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (hatch->pattern_name));
+        return (dxf_strdup (hatch->pattern_name));
 }
 
 
@@ -2093,7 +2001,7 @@ dxf_hatch_set_pattern_name
                   __FUNCTION__);
                 return (NULL);
         }
-        hatch->pattern_name = strdup (pattern_name);
+        hatch->pattern_name = dxf_strdup (pattern_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -3544,7 +3452,7 @@ dxf_hatch_pattern_new ()
         size = sizeof (DxfHatchPattern);
         /* avoid malloc of 0 bytes */
         if (size == 0) size = 1;
-        if ((pattern = malloc (size)) == NULL)
+        if ((pattern = dxf_malloc (size)) == NULL)
         {
                 fprintf (stderr,
                   (_("Error in %s () could not allocate memory.\n")),
@@ -3595,7 +3503,7 @@ dxf_hatch_pattern_init
                 return (NULL);
         }
         /* Assign initial values to members. */
-        pattern->id_code = 0;
+        pattern->id_code = DXF_HANDLE_NONE;
         pattern->number_of_def_lines = 0;
         pattern->number_of_seed_points = 0;
         /* Initialize new structs for the following members later,
@@ -3643,9 +3551,9 @@ dxf_hatch_pattern_free
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        free (pattern->def_lines);
-        free (pattern->seed_points);
-        free (pattern);
+        dxf_free (pattern->def_lines);
+        dxf_free (pattern->seed_points);
+        dxf_free (pattern);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -3692,7 +3600,7 @@ dxf_hatch_pattern_free_list
  *
  * \return ID code.
  */
-int
+uint64_t
 dxf_hatch_pattern_get_id_code
 (
         DxfHatchPattern *pattern
@@ -3710,12 +3618,6 @@ dxf_hatch_pattern_get_id_code
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (pattern->id_code < 0)
-        {
-                fprintf (stderr,
-                  (_("Warning in %s () a negative value was found.\n")),
-                  __FUNCTION__);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -3731,7 +3633,7 @@ dxf_hatch_pattern_set_id_code
 (
         DxfHatchPattern *pattern,
                 /*!< a pointer to a DXF \c HATCH pattern. */
-        int id_code
+        uint64_t id_code
                 /*!< Identification number for the entity.\n
                  * This is to be an unique (sequential) number in the DXF
                  * file. */
@@ -3748,12 +3650,6 @@ dxf_hatch_pattern_set_id_code
                   __FUNCTION__);
                 return (NULL);
         }
-        if (id_code < 0)
-        {
-                fprintf (stderr,
-                  (_("Warning in %s () a negative value was passed.\n")),
-                  __FUNCTION__);
-        }
         pattern->id_code = id_code;
 #if DEBUG
         DXF_DEBUG_END
@@ -4215,7 +4111,7 @@ dxf_hatch_pattern_def_line_dash_new ()
         size = sizeof (DxfHatchPatternDefLineDash);
         /* avoid malloc of 0 bytes */
         if (size == 0) size = 1;
-        if ((dash = malloc (size)) == NULL)
+        if ((dash = dxf_malloc (size)) == NULL)
         {
                 fprintf (stderr,
                   (_("Error in %s () could not allocate memory.\n")),
@@ -4302,7 +4198,7 @@ dxf_hatch_pattern_def_line_dash_free
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        free (dash);
+        dxf_free (dash);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -4550,7 +4446,7 @@ dxf_hatch_pattern_def_line_new ()
         size = sizeof (DxfHatchPatternDefLine);
         /* avoid malloc of 0 bytes */
         if (size == 0) size = 1;
-        if ((line = malloc (size)) == NULL)
+        if ((line = dxf_malloc (size)) == NULL)
         {
                 fprintf (stderr,
                   (_("Error in %s () could not allocate memory.\n")),
@@ -4602,7 +4498,7 @@ dxf_hatch_pattern_def_line_init
         }
         /* Initialize new structs for members. */
         /* Assign initial values to members. */
-        line->id_code = 0;
+        line->id_code = DXF_HANDLE_NONE;
         line->angle = 0.0;
         line->x0 = 0.0;
         line->y0 = 0.0;
@@ -4657,12 +4553,12 @@ dxf_hatch_pattern_def_line_write
                 return (EXIT_FAILURE);
         }
         /* Start writing output. */
-        fprintf (fp->fp, " 53\n%f\n", line->angle);
-        fprintf (fp->fp, " 43\n%f\n", line->x0);
-        fprintf (fp->fp, " 44\n%f\n", line->y0);
-        fprintf (fp->fp, " 45\n%f\n", line->x1);
-        fprintf (fp->fp, " 46\n%f\n", line->y1);
-        fprintf (fp->fp, " 79\n%d\n", line->number_of_dash_items);
+        dxf_write_double (fp, 53, line->angle);
+        dxf_write_double (fp, 43, line->x0);
+        dxf_write_double (fp, 44, line->y0);
+        dxf_write_double (fp, 45, line->x1);
+        dxf_write_double (fp, 46, line->y1);
+        dxf_write_int (fp, 79, line->number_of_dash_items);
         if (line->number_of_dash_items > 0)
         {
                 /* Draw hatch pattern definition line dash items. */
@@ -4678,7 +4574,7 @@ dxf_hatch_pattern_def_line_write
                 }
                 while (dash != NULL)
                 {
-                        fprintf (fp->fp, " 49\n%f\n", dash->length);
+                        dxf_write_double (fp, 49, dash->length);
                         i++;
                         dash = dxf_hatch_pattern_def_line_dash_get_next (dash);
                 }
@@ -4736,7 +4632,7 @@ dxf_hatch_pattern_def_line_free
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        free (line);
+        dxf_free (line);
         line = NULL;
 #if DEBUG
         DXF_DEBUG_END
@@ -4784,7 +4680,7 @@ dxf_hatch_pattern_def_line_free_list
  *
  * \return ID code.
  */
-int
+uint64_t
 dxf_hatch_pattern_def_line_get_id_code
 (
         DxfHatchPatternDefLine *line
@@ -4802,12 +4698,6 @@ dxf_hatch_pattern_def_line_get_id_code
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (line->id_code < 0)
-        {
-                fprintf (stderr,
-                  (_("Warning in %s () a negative value was found.\n")),
-                  __FUNCTION__);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -4823,7 +4713,7 @@ dxf_hatch_pattern_def_line_set_id_code
 (
         DxfHatchPatternDefLine *line,
                 /*!< a pointer to a DXF \c HATCH pattern def line. */
-        int id_code
+        uint64_t id_code
                 /*!< Identification number for the entity.\n
                  * This is to be an unique (sequential) number in the DXF
                  * file. */
@@ -4840,12 +4730,6 @@ dxf_hatch_pattern_def_line_set_id_code
                   __FUNCTION__);
                 return (NULL);
         }
-        if (id_code < 0)
-        {
-                fprintf (stderr,
-                  (_("Warning in %s () a negative value was passed.\n")),
-                  __FUNCTION__);
-        }
         line->id_code = id_code;
 #if DEBUG
         DXF_DEBUG_END
@@ -5465,7 +5349,7 @@ dxf_hatch_pattern_seedpoint_new ()
         size = sizeof (DxfHatchPatternSeedPoint);
         /* avoid malloc of 0 bytes */
         if (size == 0) size = 1;
-        if ((seedpoint = malloc (size)) == NULL)
+        if ((seedpoint = dxf_malloc (size)) == NULL)
         {
                 fprintf (stderr,
                   (_("Error in %s () could not allocate memory.\n")),
@@ -5516,7 +5400,7 @@ dxf_hatch_pattern_seedpoint_init
                 return (NULL);
         }
         /* Initialize new structs for members. */
-        seedpoint->id_code = 0;
+        seedpoint->id_code = DXF_HANDLE_NONE;
         seedpoint->x0 = 0.0;
         seedpoint->y0 = 0.0;
         /* Initialize new structs for the following members later,
@@ -5564,8 +5448,8 @@ dxf_hatch_pattern_seedpoint_write
                 return (EXIT_FAILURE);
         }
         /* Start writing output. */
-        fprintf (fp->fp, " 10\n%f\n", seedpoint->x0);
-        fprintf (fp->fp, " 20\n%f\n", seedpoint->y0);
+        dxf_write_double (fp, 10, seedpoint->x0);
+        dxf_write_double (fp, 20, seedpoint->y0);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -5606,7 +5490,7 @@ dxf_hatch_pattern_seedpoint_free
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        free (seedpoint);
+        dxf_free (seedpoint);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -5653,7 +5537,7 @@ dxf_hatch_pattern_seedpoint_free_list
  *
  * \return ID code.
  */
-int
+uint64_t
 dxf_hatch_pattern_seedpoint_get_id_code
 (
         DxfHatchPatternSeedPoint *point
@@ -5671,12 +5555,6 @@ dxf_hatch_pattern_seedpoint_get_id_code
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (point->id_code < 0)
-        {
-                fprintf (stderr,
-                  (_("Warning in %s () a negative value was found.\n")),
-                  __FUNCTION__);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -5692,7 +5570,7 @@ dxf_hatch_pattern_seedpoint_set_id_code
 (
         DxfHatchPatternSeedPoint *point,
                 /*!< a pointer to a DXF \c HATCH pattern seed point. */
-        int id_code
+        uint64_t id_code
                 /*!< Identification number for the entity.\n
                  * This is to be an unique (sequential) number in the DXF
                  * file. */
@@ -5709,12 +5587,6 @@ dxf_hatch_pattern_seedpoint_set_id_code
                   __FUNCTION__);
                 return (NULL);
         }
-        if (id_code < 0)
-        {
-                fprintf (stderr,
-                  (_("Warning in %s () a negative value was passed.\n")),
-                  __FUNCTION__);
-        }
         point->id_code = id_code;
 #if DEBUG
         DXF_DEBUG_END
@@ -5989,7 +5861,7 @@ dxf_hatch_boundary_path_new ()
         size = sizeof (DxfHatchBoundaryPath);
         /* avoid malloc of 0 bytes */
         if (size == 0) size = 1;
-        if ((path = malloc (size)) == NULL)
+        if ((path = dxf_malloc (size)) == NULL)
         {
                 fprintf (stderr,
                   (_("Error in %s () could not allocate memory.\n")),
@@ -6040,7 +5912,7 @@ dxf_hatch_boundary_path_init
                 return (NULL);
         }
         /* Assign initial values to members. */
-        path->id_code = 0;
+        path->id_code = DXF_HANDLE_NONE;
         /* Initialize new structs for the following members later,
          * when they are required and when we have content. */
         path->edges = NULL;
@@ -6171,9 +6043,9 @@ dxf_hatch_boundary_path_free
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        free (path->edges);
-        free (path->polylines);
-        free (path);
+        dxf_free (path->edges);
+        dxf_free (path->polylines);
+        dxf_free (path);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -6220,7 +6092,7 @@ dxf_hatch_boundary_path_free_list
  *
  * \return ID code.
  */
-int
+uint64_t
 dxf_hatch_boundary_path_get_id_code
 (
         DxfHatchBoundaryPath *path
@@ -6238,12 +6110,6 @@ dxf_hatch_boundary_path_get_id_code
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (path->id_code < 0)
-        {
-                fprintf (stderr,
-                  (_("Warning in %s () a negative value was found.\n")),
-                  __FUNCTION__);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -6259,7 +6125,7 @@ dxf_hatch_boundary_path_set_id_code
 (
         DxfHatchBoundaryPath *path,
                 /*!< a pointer to a DXF \c HATCH boundary path. */
-        int id_code
+        uint64_t id_code
                 /*!< Identification number for the entity.\n
                  * This is to be an unique (sequential) number in the DXF
                  * file. */
@@ -6276,12 +6142,6 @@ dxf_hatch_boundary_path_set_id_code
                   __FUNCTION__);
                 return (NULL);
         }
-        if (id_code < 0)
-        {
-                fprintf (stderr,
-                  (_("Warning in %s () a negative value was passed.\n")),
-                  __FUNCTION__);
-        }
         path->id_code = id_code;
 #if DEBUG
         DXF_DEBUG_END
@@ -6588,7 +6448,7 @@ dxf_hatch_boundary_path_polyline_new ()
         size = sizeof (DxfHatchBoundaryPathPolyline);
         /* avoid malloc of 0 bytes */
         if (size == 0) size = 1;
-        if ((polyline = malloc (size)) == NULL)
+        if ((polyline = dxf_malloc (size)) == NULL)
         {
                 fprintf (stderr,
                   (_("Error in %s () could not allocate memory.\n")),
@@ -6639,7 +6499,7 @@ dxf_hatch_boundary_path_polyline_init
                 return (NULL);
         }
         /* Assign initial values to members. */
-        polyline->id_code = 0;
+        polyline->id_code = DXF_HANDLE_NONE;
         polyline->is_closed = 0;
         polyline->number_of_vertices = 0;
         /* Initialize new structs for the following members later,
@@ -6688,8 +6548,8 @@ dxf_hatch_boundary_path_polyline_write
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        fprintf (fp->fp, " 73\n%hd\n", polyline->is_closed);
-        fprintf (fp->fp, " 93\n%" PRIi32 "\n", polyline->number_of_vertices);
+        dxf_write_int (fp, 73, polyline->is_closed);
+        dxf_write_int (fp, 93, polyline->number_of_vertices);
         /* draw hatch boundary vertices. */
         iter = dxf_hatch_boundary_path_polyline_vertex_new ();
         iter = (DxfHatchBoundaryPathPolylineVertex *) polyline->vertices;
@@ -6755,8 +6615,8 @@ dxf_hatch_boundary_path_polyline_free
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        free (polyline->vertices);
-        free (polyline);
+        dxf_free (polyline->vertices);
+        dxf_free (polyline);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -6803,7 +6663,7 @@ dxf_hatch_boundary_path_polyline_free_list
  *
  * \return ID code.
  */
-int
+uint64_t
 dxf_hatch_boundary_path_polyline_get_id_code
 (
         DxfHatchBoundaryPathPolyline *polyline
@@ -6821,12 +6681,6 @@ dxf_hatch_boundary_path_polyline_get_id_code
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (polyline->id_code < 0)
-        {
-                fprintf (stderr,
-                  (_("Warning in %s () a negative value was found.\n")),
-                  __FUNCTION__);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -6842,7 +6696,7 @@ dxf_hatch_boundary_path_polyline_set_id_code
 (
         DxfHatchBoundaryPathPolyline *polyline,
                 /*!< a pointer to a DXF \c HATCH boundary path polyline. */
-        int id_code
+        uint64_t id_code
                 /*!< Identification number for the entity.\n
                  * This is to be an unique (sequential) number in the DXF
                  * file. */
@@ -6859,12 +6713,6 @@ dxf_hatch_boundary_path_polyline_set_id_code
                   __FUNCTION__);
                 return (NULL);
         }
-        if (id_code < 0)
-        {
-                fprintf (stderr,
-                  (_("Warning in %s () a negative value was passed.\n")),
-                  __FUNCTION__);
-        }
         polyline->id_code = id_code;
 #if DEBUG
         DXF_DEBUG_END
@@ -7469,7 +7317,7 @@ dxf_hatch_boundary_path_polyline_vertex_new ()
         size = sizeof (DxfHatchBoundaryPathPolylineVertex);
         /* avoid malloc of 0 bytes */
         if (size == 0) size = 1;
-        if ((vertex = malloc (size)) == NULL)
+        if ((vertex = dxf_malloc (size)) == NULL)
         {
                 fprintf (stderr,
                   (_("Error in %s () could not allocate memory.\n")),
@@ -7520,7 +7368,7 @@ dxf_hatch_boundary_path_polyline_vertex_init
                 return (NULL);
         }
         /* Initialize new structs for members. */
-        vertex->id_code = 0;
+        vertex->id_code = DXF_HANDLE_NONE;
         vertex->x0 = 0.0;
         vertex->y0 = 0.0;
         vertex->bulge = 0.0;
@@ -7566,12 +7414,12 @@ dxf_hatch_boundary_path_polyline_vertex_write
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        fprintf (fp->fp, " 10\n%f\n", vertex->x0);
-        fprintf (fp->fp, " 20\n%f\n", vertex->y0);
-        fprintf (fp->fp, " 72\n%hd\n", vertex->has_bulge);
+        dxf_write_double (fp, 10, vertex->x0);
+        dxf_write_double (fp, 20, vertex->y0);
+        dxf_write_int (fp, 72, vertex->has_bulge);
         if (vertex->has_bulge)
         {
-                fprintf (fp->fp, " 42\n%f\n", vertex->bulge);
+                dxf_write_double (fp, 42, vertex->bulge);
         }
 #if DEBUG
         DXF_DEBUG_END
@@ -7613,7 +7461,7 @@ dxf_hatch_boundary_path_polyline_vertex_free
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        free (vertex);
+        dxf_free (vertex);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -7661,7 +7509,7 @@ dxf_hatch_boundary_path_polyline_vertex_free_list
  *
  * \return ID code.
  */
-int
+uint64_t
 dxf_hatch_boundary_path_polyline_vertex_get_id_code
 (
         DxfHatchBoundaryPathPolylineVertex *vertex
@@ -7680,12 +7528,6 @@ dxf_hatch_boundary_path_polyline_vertex_get_id_code
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (vertex->id_code < 0)
-        {
-                fprintf (stderr,
-                  (_("Warning in %s () a negative value was found.\n")),
-                  __FUNCTION__);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -7703,7 +7545,7 @@ dxf_hatch_boundary_path_polyline_vertex_set_id_code
         DxfHatchBoundaryPathPolylineVertex *vertex,
                 /*!< a pointer to a DXF \c HATCH boundary path polyline
                  * vertex. */
-        int id_code
+        uint64_t id_code
                 /*!< Identification number for the entity.\n
                  * This is to be an unique (sequential) number in the DXF
                  * file. */
@@ -7720,12 +7562,6 @@ dxf_hatch_boundary_path_polyline_vertex_set_id_code
                   __FUNCTION__);
                 return (NULL);
         }
-        if (id_code < 0)
-        {
-                fprintf (stderr,
-                  (_("Warning in %s () a negative value was passed.\n")),
-                  __FUNCTION__);
-        }
         vertex->id_code = id_code;
 #if DEBUG
         DXF_DEBUG_END
@@ -8238,7 +8074,7 @@ dxf_hatch_boundary_path_edge_new ()
         size = sizeof (DxfHatchBoundaryPathEdge);
         /* avoid malloc of 0 bytes */
         if (size == 0) size = 1;
-        if ((edge = malloc (size)) == NULL)
+        if ((edge = dxf_malloc (size)) == NULL)
         {
                 fprintf (stderr,
                   (_("Error in %s () could not allocate memory.\n")),
@@ -8289,7 +8125,7 @@ dxf_hatch_boundary_path_edge_init
                 return (NULL);
         }
         /* Assign initial values to members. */
-        edge->id_code = 0;
+        edge->id_code = DXF_HANDLE_NONE;
         /* Initialize new structs for the following members later,
          * when they are required and when we have content. */
         edge->arcs = NULL;
@@ -8337,11 +8173,11 @@ dxf_hatch_boundary_path_edge_free
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        free (edge->arcs);
-        free (edge->ellipses);
-        free (edge->lines);
-        free (edge->splines);
-        free (edge);
+        dxf_free (edge->arcs);
+        dxf_free (edge->ellipses);
+        dxf_free (edge->lines);
+        dxf_free (edge->splines);
+        dxf_free (edge);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -8388,7 +8224,7 @@ dxf_hatch_boundary_path_edge_free_list
  *
  * \return ID code.
  */
-int
+uint64_t
 dxf_hatch_boundary_path_edge_get_id_code
 (
         DxfHatchBoundaryPathEdge *edge
@@ -8406,12 +8242,6 @@ dxf_hatch_boundary_path_edge_get_id_code
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (edge->id_code < 0)
-        {
-                fprintf (stderr,
-                  (_("Warning in %s () a negative value was found.\n")),
-                  __FUNCTION__);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -8427,7 +8257,7 @@ dxf_hatch_boundary_path_edge_set_id_code
 (
         DxfHatchBoundaryPathEdge *edge,
                 /*!< a pointer to a DXF \c HATCH boundary path edge. */
-        int id_code
+        uint64_t id_code
                 /*!< Identification number for the entity.\n
                  * This is to be an unique (sequential) number in the DXF
                  * file. */
@@ -8444,12 +8274,6 @@ dxf_hatch_boundary_path_edge_set_id_code
                   __FUNCTION__);
                 return (NULL);
         }
-        if (id_code < 0)
-        {
-                fprintf (stderr,
-                  (_("Warning in %s () a negative value was passed.\n")),
-                  __FUNCTION__);
-        }
         edge->id_code = id_code;
 #if DEBUG
         DXF_DEBUG_END
@@ -8914,7 +8738,7 @@ dxf_hatch_boundary_path_edge_arc_new ()
         size = sizeof (DxfHatchBoundaryPathEdgeArc);
         /* avoid malloc of 0 bytes */
         if (size == 0) size = 1;
-        if ((arc = malloc (size)) == NULL)
+        if ((arc = dxf_malloc (size)) == NULL)
         {
                 fprintf (stderr,
                   (_("Error in %s () could not allocate memory.\n")),
@@ -8965,7 +8789,7 @@ dxf_hatch_boundary_path_edge_arc_init
                 return (NULL);
         }
         /* Assign initial values to members. */
-        arc->id_code = 0;
+        arc->id_code = DXF_HANDLE_NONE;
         arc->x0 = 0.0;
         arc->y0 = 0.0;
         arc->radius = 0.0;
@@ -9015,7 +8839,7 @@ dxf_hatch_boundary_path_edge_arc_free
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        free (arc);
+        dxf_free (arc);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -9062,7 +8886,7 @@ dxf_hatch_boundary_path_edge_arc_free_list
  *
  * \return ID code.
  */
-int
+uint64_t
 dxf_hatch_boundary_path_edge_arc_get_id_code
 (
         DxfHatchBoundaryPathEdgeArc *arc
@@ -9080,12 +8904,6 @@ dxf_hatch_boundary_path_edge_arc_get_id_code
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (arc->id_code < 0)
-        {
-                fprintf (stderr,
-                  (_("Warning in %s () a negative value was found.\n")),
-                  __FUNCTION__);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -9101,7 +8919,7 @@ dxf_hatch_boundary_path_edge_arc_set_id_code
 (
         DxfHatchBoundaryPathEdgeArc *arc,
                 /*!< a pointer to a DXF \c HATCH boundary path edge arc. */
-        int id_code
+        uint64_t id_code
                 /*!< Identification number for the entity.\n
                  * This is to be an unique (sequential) number in the DXF
                  * file. */
@@ -9118,12 +8936,6 @@ dxf_hatch_boundary_path_edge_arc_set_id_code
                   __FUNCTION__);
                 return (NULL);
         }
-        if (id_code < 0)
-        {
-                fprintf (stderr,
-                  (_("Warning in %s () a negative value was passed.\n")),
-                  __FUNCTION__);
-        }
         arc->id_code = id_code;
 #if DEBUG
         DXF_DEBUG_END
@@ -9268,7 +9080,7 @@ dxf_hatch_boundary_path_edge_arc_get_center_point
 (
         DxfHatchBoundaryPathEdgeArc *arc,
                 /*!< a pointer to a DXF \c HATCH boundary path edge arc. */
-        int id_code
+        uint64_t id_code
                 /*!< Identification number for the \c DXfPoint entity.\n
                  * This is to be an unique (sequential) number in the DXF
                  * file. */
@@ -9295,12 +9107,6 @@ dxf_hatch_boundary_path_edge_arc_get_center_point
                 __FUNCTION__);
               return (NULL);
         }
-        if (id_code < 0)
-        {
-              fprintf (stderr,
-                  (_("Warning in %s () a negative value was passed.\n")),
-                __FUNCTION__);
-        }
         p1->id_code = id_code;
         p1->x0 = arc->x0;
         p1->y0 = arc->y0;
@@ -9781,7 +9587,7 @@ dxf_hatch_boundary_path_edge_ellipse_new ()
         size = sizeof (DxfHatchBoundaryPathEdgeEllipse);
         /* avoid malloc of 0 bytes */
         if (size == 0) size = 1;
-        if ((ellipse = malloc (size)) == NULL)
+        if ((ellipse = dxf_malloc (size)) == NULL)
         {
                 fprintf (stderr,
                   (_("Error in %s () could not allocate memory.\n")),
@@ -9832,7 +9638,7 @@ dxf_hatch_boundary_path_edge_ellipse_init
                 return (NULL);
         }
         /* Assign initial values to members. */
-        ellipse->id_code = 0;
+        ellipse->id_code = DXF_HANDLE_NONE;
         ellipse->x0 = 0.0;
         ellipse->y0 = 0.0;
         ellipse->x1 = 0.0;
@@ -9884,7 +9690,7 @@ dxf_hatch_boundary_path_edge_ellipse_free
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        free (ellipse);
+        dxf_free (ellipse);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -9932,7 +9738,7 @@ dxf_hatch_boundary_path_edge_ellipse_free_list
  *
  * \return ID code.
  */
-int
+uint64_t
 dxf_hatch_boundary_path_edge_ellipse_get_id_code
 (
         DxfHatchBoundaryPathEdgeEllipse *ellipse
@@ -9951,12 +9757,6 @@ dxf_hatch_boundary_path_edge_ellipse_get_id_code
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (ellipse->id_code < 0)
-        {
-                fprintf (stderr,
-                  (_("Warning in %s () a negative value was found.\n")),
-                  __FUNCTION__);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -9973,7 +9773,7 @@ dxf_hatch_boundary_path_edge_ellipse_set_id_code
         DxfHatchBoundaryPathEdgeEllipse *ellipse,
                 /*!< a pointer to a DXF \c HATCH boundary path edge
                  * ellipse. */
-        int id_code
+        uint64_t id_code
                 /*!< Identification number for the entity.\n
                  * This is to be an unique (sequential) number in the DXF
                  * file. */
@@ -9990,12 +9790,6 @@ dxf_hatch_boundary_path_edge_ellipse_set_id_code
                   __FUNCTION__);
                 return (NULL);
         }
-        if (id_code < 0)
-        {
-                fprintf (stderr,
-                  (_("Warning in %s () a negative value was passed.\n")),
-                  __FUNCTION__);
-        }
         ellipse->id_code = id_code;
 #if DEBUG
         DXF_DEBUG_END
@@ -10148,7 +9942,7 @@ dxf_hatch_boundary_path_edge_ellipse_get_center_point
         DxfHatchBoundaryPathEdgeEllipse *ellipse,
                 /*!< a pointer to a DXF \c HATCH boundary path edge
                  * ellipse. */
-        int id_code
+        uint64_t id_code
                 /*!< Identification number for the entity.\n
                  * This is to be an unique (sequential) number in the DXF
                  * file. */
@@ -10175,12 +9969,6 @@ dxf_hatch_boundary_path_edge_ellipse_get_center_point
                 __FUNCTION__);
               return (NULL);
         }
-        if (id_code < 0)
-        {
-              fprintf (stderr,
-                  (_("Warning in %s () a negative value was passed.\n")),
-                __FUNCTION__);
-        }
         p1->id_code = id_code;
         p1->x0 = ellipse->x0;
         p1->y0 = ellipse->y0;
@@ -10378,7 +10166,7 @@ dxf_hatch_boundary_path_edge_ellipse_get_end_point
         DxfHatchBoundaryPathEdgeEllipse *ellipse,
                 /*!< a pointer to a DXF \c HATCH boundary path edge
                  * ellipse. */
-        int id_code
+        uint64_t id_code
                 /*!< Identification number for the entity.\n
                  * This is to be an unique (sequential) number in the DXF
                  * file. */
@@ -10405,12 +10193,6 @@ dxf_hatch_boundary_path_edge_ellipse_get_end_point
                 __FUNCTION__);
               return (NULL);
         }
-        if (id_code < 0)
-        {
-              fprintf (stderr,
-                  (_("Warning in %s () a negative value was passed.\n")),
-                __FUNCTION__);
-        }
         p1->id_code = id_code;
         p1->x0 = ellipse->x1;
         p1->y0 = ellipse->y1;
@@ -10912,7 +10694,7 @@ dxf_hatch_boundary_path_edge_line_new ()
         size = sizeof (DxfHatchBoundaryPathEdgeLine);
         /* avoid malloc of 0 bytes */
         if (size == 0) size = 1;
-        if ((line = malloc (size)) == NULL)
+        if ((line = dxf_malloc (size)) == NULL)
         {
                 fprintf (stderr,
                   (_("Error in %s () could not allocate memory.\n")),
@@ -10963,7 +10745,7 @@ dxf_hatch_boundary_path_edge_line_init
                 return (NULL);
         }
         /* Assign initial values to members. */
-        line->id_code = 0;
+        line->id_code = DXF_HANDLE_NONE;
         line->x0 = 0.0;
         line->y0 = 0.0;
         line->x1 = 0.0;
@@ -11011,7 +10793,7 @@ dxf_hatch_boundary_path_edge_line_free
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        free (line);
+        dxf_free (line);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -11058,7 +10840,7 @@ dxf_hatch_boundary_path_edge_line_free_list
  *
  * \return ID code.
  */
-int
+uint64_t
 dxf_hatch_boundary_path_edge_line_get_id_code
 (
         DxfHatchBoundaryPathEdgeLine *line
@@ -11077,12 +10859,6 @@ dxf_hatch_boundary_path_edge_line_get_id_code
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (line->id_code < 0)
-        {
-                fprintf (stderr,
-                  (_("Warning in %s () a negative value was found.\n")),
-                  __FUNCTION__);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -11099,7 +10875,7 @@ dxf_hatch_boundary_path_edge_line_set_id_code
         DxfHatchBoundaryPathEdgeLine *line,
                 /*!< a pointer to a DXF \c HATCH boundary path edge
                  * line. */
-        int id_code
+        uint64_t id_code
                 /*!< Identification number for the entity.\n
                  * This is to be an unique (sequential) number in the DXF
                  * file. */
@@ -11116,12 +10892,6 @@ dxf_hatch_boundary_path_edge_line_set_id_code
                   __FUNCTION__);
                 return (NULL);
         }
-        if (id_code < 0)
-        {
-                fprintf (stderr,
-                  (_("Warning in %s () a negative value was passed.\n")),
-                  __FUNCTION__);
-        }
         line->id_code = id_code;
 #if DEBUG
         DXF_DEBUG_END
@@ -11268,7 +11038,7 @@ dxf_hatch_boundary_path_edge_line_get_start_point
 (
         DxfHatchBoundaryPathEdgeLine *line,
                 /*!< a pointer to a DXF \c HATCH boundary path edge line. */
-        int id_code
+        uint64_t id_code
                 /*!< Identification number for the entity.\n
                  * This is to be an unique (sequential) number in the DXF
                  * file. */
@@ -11303,12 +11073,6 @@ dxf_hatch_boundary_path_edge_line_get_start_point
                 __FUNCTION__);
               return (NULL);
         }
-        if (id_code < 0)
-        {
-              fprintf (stderr,
-                  (_("Warning in %s () a negative value was passed.\n")),
-                __FUNCTION__);
-        }
         p1->id_code = id_code;
         p1->x0 = line->x0;
         p1->y0 = line->y0;
@@ -11498,7 +11262,7 @@ dxf_hatch_boundary_path_edge_line_get_end_point
 (
         DxfHatchBoundaryPathEdgeLine *line,
                 /*!< a pointer to a DXF \c HATCH boundary path edge line. */
-        int id_code
+        uint64_t id_code
                 /*!< Identification number for the entity.\n
                  * This is to be an unique (sequential) number in the DXF
                  * file. */
@@ -11533,12 +11297,6 @@ dxf_hatch_boundary_path_edge_line_get_end_point
                 __FUNCTION__);
               return (NULL);
         }
-        if (id_code < 0)
-        {
-              fprintf (stderr,
-                  (_("Warning in %s () a negative value was passed.\n")),
-                __FUNCTION__);
-        }
         p2->id_code = id_code;
         p2->x0 = line->x1;
         p2->y0 = line->y1;
@@ -11734,7 +11492,7 @@ dxf_hatch_boundary_path_edge_spline_new ()
         size = sizeof (DxfHatchBoundaryPathEdgeSpline);
         /* avoid malloc of 0 bytes */
         if (size == 0) size = 1;
-        if ((spline = malloc (size)) == NULL)
+        if ((spline = dxf_malloc (size)) == NULL)
         {
                 fprintf (stderr,
                   (_("Error in %s () could not allocate memory.\n")),
@@ -11787,7 +11545,7 @@ dxf_hatch_boundary_path_edge_spline_init
                 return (NULL);
         }
         /* Assign initial values to members. */
-        spline->id_code = 0;
+        spline->id_code = DXF_HANDLE_NONE;
         spline->degree = 0;
         spline->rational = 0;
         spline->periodic = 0;
@@ -11841,8 +11599,8 @@ dxf_hatch_boundary_path_edge_spline_free
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        free (spline->control_points);
-        free (spline);
+        dxf_free (spline->control_points);
+        dxf_free (spline);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -11889,7 +11647,7 @@ dxf_hatch_boundary_path_edge_spline_free_list
  *
  * \return ID code.
  */
-int
+uint64_t
 dxf_hatch_boundary_path_edge_spline_get_id_code
 (
         DxfHatchBoundaryPathEdgeSpline *spline
@@ -11908,12 +11666,6 @@ dxf_hatch_boundary_path_edge_spline_get_id_code
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (spline->id_code < 0)
-        {
-                fprintf (stderr,
-                  (_("Warning in %s () a negative value was found.\n")),
-                  __FUNCTION__);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -11930,7 +11682,7 @@ dxf_hatch_boundary_path_edge_spline_set_id_code
         DxfHatchBoundaryPathEdgeSpline *spline,
                 /*!< a pointer to a DXF \c HATCH boundary path edge
                  * spline. */
-        int id_code
+        uint64_t id_code
                 /*!< Identification number for the entity.\n
                  * This is to be an unique (sequential) number in the DXF
                  * file. */
@@ -11947,12 +11699,6 @@ dxf_hatch_boundary_path_edge_spline_set_id_code
                   __FUNCTION__);
                 return (NULL);
         }
-        if (id_code < 0)
-        {
-                fprintf (stderr,
-                  (_("Warning in %s () a negative value was passed.\n")),
-                  __FUNCTION__);
-        }
         spline->id_code = id_code;
 #if DEBUG
         DXF_DEBUG_END
@@ -12575,7 +12321,9 @@ dxf_hatch_boundary_path_edge_spline_append_control_point
         }
         if (sizeof (spline) < sizeof (DxfHatchBoundaryPathEdgeSpline))
         {
-                spline = realloc (spline, sizeof (DxfHatchBoundaryPathEdgeSpline));
+                spline = dxf_realloc (spline,
+                  sizeof (DxfHatchBoundaryPathEdgeSpline),
+                  sizeof (DxfHatchBoundaryPathEdgeSpline));
         }
         if (spline->control_points == NULL)
         {
@@ -12716,7 +12464,9 @@ dxf_hatch_boundary_path_edge_spline_prepend_control_point
         }
         if (sizeof (spline) < sizeof (DxfHatchBoundaryPathEdgeSpline))
         {
-                spline = realloc (spline, sizeof (DxfHatchBoundaryPathEdgeSpline));
+                spline = dxf_realloc (spline,
+                  sizeof (DxfHatchBoundaryPathEdgeSpline),
+                  sizeof (DxfHatchBoundaryPathEdgeSpline));
         }
         if (spline->control_points == NULL)
         {
@@ -12802,7 +12552,9 @@ dxf_hatch_boundary_path_edge_spline_get_control_point
         }
         if (sizeof (spline) < sizeof (DxfHatchBoundaryPathEdgeSpline))
         {
-                spline = realloc (spline, sizeof (DxfHatchBoundaryPathEdgeSpline));
+                spline = dxf_realloc (spline,
+                  sizeof (DxfHatchBoundaryPathEdgeSpline),
+                  sizeof (DxfHatchBoundaryPathEdgeSpline));
         }
         if (spline->number_of_control_points <= position)
         {
@@ -12900,7 +12652,9 @@ dxf_hatch_boundary_path_edge_spline_set_control_point
         }
         if (sizeof (spline) < sizeof (DxfHatchBoundaryPathEdgeSpline))
         {
-                spline = realloc (spline, sizeof (DxfHatchBoundaryPathEdgeSpline));
+                spline = dxf_realloc (spline,
+                  sizeof (DxfHatchBoundaryPathEdgeSpline),
+                  sizeof (DxfHatchBoundaryPathEdgeSpline));
         }
         if (spline->number_of_control_points <= position)
         {
@@ -13089,7 +12843,9 @@ dxf_hatch_boundary_path_edge_spline_insert_control_point
         }
         if (sizeof (spline) < sizeof (DxfHatchBoundaryPathEdgeSpline))
         {
-                spline = realloc (spline, sizeof (DxfHatchBoundaryPathEdgeSpline));
+                spline = dxf_realloc (spline,
+                  sizeof (DxfHatchBoundaryPathEdgeSpline),
+                  sizeof (DxfHatchBoundaryPathEdgeSpline));
         }
         if (spline->control_points == NULL)
         {
@@ -13221,7 +12977,9 @@ dxf_hatch_boundary_path_edge_spline_remove_control_point
         }
         if (sizeof (spline) < sizeof (DxfHatchBoundaryPathEdgeSpline))
         {
-                spline = realloc (spline, sizeof (DxfHatchBoundaryPathEdgeSpline));
+                spline = dxf_realloc (spline,
+                  sizeof (DxfHatchBoundaryPathEdgeSpline),
+                  sizeof (DxfHatchBoundaryPathEdgeSpline));
         }
         if (spline->control_points == NULL)
         {
@@ -13384,7 +13142,9 @@ dxf_hatch_boundary_path_edge_spline_copy_control_points
         }
         if (sizeof (spline) < sizeof (DxfHatchBoundaryPathEdgeSpline))
         {
-                spline = realloc (spline, sizeof (DxfHatchBoundaryPathEdgeSpline));
+                spline = dxf_realloc (spline,
+                  sizeof (DxfHatchBoundaryPathEdgeSpline),
+                  sizeof (DxfHatchBoundaryPathEdgeSpline));
         }
         if (spline->control_points == NULL)
         {
@@ -14014,7 +13774,7 @@ dxf_hatch_boundary_path_edge_spline_control_point_new ()
         size = sizeof (DxfHatchBoundaryPathEdgeSplineCp);
         /* avoid malloc of 0 bytes */
         if (size == 0) size = 1;
-        if ((control_point = malloc (size)) == NULL)
+        if ((control_point = dxf_malloc (size)) == NULL)
         {
                 fprintf (stderr,
                   (_("Error in %s () could not allocate memory.\n")),
@@ -14065,7 +13825,7 @@ dxf_hatch_boundary_path_edge_spline_control_point_init
                 return (NULL);
         }
         /* Assign initial values to members. */
-        control_point->id_code = 0;
+        control_point->id_code = DXF_HANDLE_NONE;
         control_point->x0 = 0.0;
         control_point->y0 = 0.0;
         control_point->weight = 0.0;
@@ -14112,7 +13872,7 @@ dxf_hatch_boundary_path_edge_spline_control_point_free
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        free (control_point);
+        dxf_free (control_point);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -14161,7 +13921,7 @@ dxf_hatch_boundary_path_edge_spline_control_point_free_list
  *
  * \return ID code.
  */
-int
+uint64_t
 dxf_hatch_boundary_path_edge_spline_cp_get_id_code
 (
         DxfHatchBoundaryPathEdgeSplineCp *control_point
@@ -14180,13 +13940,6 @@ dxf_hatch_boundary_path_edge_spline_cp_get_id_code
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (control_point->id_code < 0)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a negative value was found.\n")),
-                  __FUNCTION__);
-                return (EXIT_FAILURE);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -14204,7 +13957,7 @@ dxf_hatch_boundary_path_edge_spline_cp_set_id_code
         DxfHatchBoundaryPathEdgeSplineCp *control_point,
                 /*!< a pointer to a DXF \c HATCH boundary path spline
                  * control point. */
-        int id_code
+        uint64_t id_code
                 /*!< Identification number for the entity.\n
                  * This is to be an unique (sequential) number in the DXF
                  * file. */
@@ -14221,12 +13974,6 @@ dxf_hatch_boundary_path_edge_spline_cp_set_id_code
                   __FUNCTION__);
                 return (NULL);
         }
-        if (id_code < 0)
-        {
-                fprintf (stderr,
-                  (_("Warning in %s () a negative value was passed.\n")),
-                  __FUNCTION__);
-        }
         control_point->id_code = id_code;
 #if DEBUG
         DXF_DEBUG_END
@@ -14379,7 +14126,7 @@ dxf_hatch_boundary_path_edge_spline_cp_get_point
         DxfHatchBoundaryPathEdgeSplineCp *control_point,
                 /*!< a pointer to a DXF \c HATCH boundary path spline
                  * control point. */
-        int id_code
+        uint64_t id_code
                 /*!< Identification number for the \c DXfPoint entity.\n
                  * This is to be an unique (sequential) number in the DXF
                  * file. */
@@ -14406,12 +14153,6 @@ dxf_hatch_boundary_path_edge_spline_cp_get_point
                 __FUNCTION__);
               return (NULL);
         }
-        if (id_code < 0)
-        {
-              fprintf (stderr,
-                  (_("Warning in %s () a negative value was passed.\n")),
-                __FUNCTION__);
-        }
         p1->id_code = id_code;
         p1->x0 = control_point->x0;
         p1->y0 = control_point->y0;
@@ -14666,4 +14407,429 @@ dxf_hatch_boundary_path_edge_spline_cp_get_last
 }
 
 
+/*!
+ * \brief Get the bounding box of a DXF \c HATCH.
+ *
+ * The box of the boundary paths of \c hatch: polyline paths with
+ * their arc segments, and line, arc, ellipse and spline edges (spline
+ * edges by their control points), at the elevation of \c hatch.\n
+ * The box is computed in the Object Coordinate System (OCS) of
+ * \c hatch and mapped to world coordinates, see
+ * dxf_bbox_ocs_to_wcs ().
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_hatch_get_bbox
+(
+        DxfHatch *hatch,
+                /*!< a pointer to a DXF \c HATCH entity. */
+        DxfBbox *bbox
+                /*!< a pointer to the libDXF bounding box to fill. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfHatchBoundaryPath *path;
+        DxfHatchBoundaryPathPolyline *polyline;
+        DxfHatchBoundaryPathPolylineVertex *vertex;
+        DxfHatchBoundaryPathPolylineVertex *target;
+        DxfHatchBoundaryPathEdge *edge;
+        DxfHatchBoundaryPathEdgeLine *line;
+        DxfHatchBoundaryPathEdgeArc *arc;
+        DxfHatchBoundaryPathEdgeEllipse *ellipse;
+        DxfHatchBoundaryPathEdgeSpline *spline;
+        DxfHatchBoundaryPathEdgeSplineCp *control_point;
+        DxfVec3 center;
+        DxfVec3 major;
+        DxfVec3 minor;
+        DxfVec3 extrusion;
+        double z;
+
+        /* Do some basic checks. */
+        if ((hatch == NULL) || (bbox == NULL))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        z = (hatch->p0 != NULL) ? hatch->p0->z0 : hatch->elevation;
+        dxf_bbox_init (bbox);
+        for (path = (DxfHatchBoundaryPath *) hatch->paths;
+          path != NULL;
+          path = (DxfHatchBoundaryPath *) path->next)
+        {
+                for (polyline = (DxfHatchBoundaryPathPolyline *) path->polylines;
+                  polyline != NULL;
+                  polyline = (DxfHatchBoundaryPathPolyline *) polyline->next)
+                {
+                        for (vertex = (DxfHatchBoundaryPathPolylineVertex *) polyline->vertices;
+                          vertex != NULL;
+                          vertex = (DxfHatchBoundaryPathPolylineVertex *) vertex->next)
+                        {
+                                target = (DxfHatchBoundaryPathPolylineVertex *) vertex->next;
+                                if ((target == NULL) && polyline->is_closed)
+                                {
+                                        target = (DxfHatchBoundaryPathPolylineVertex *) polyline->vertices;
+                                }
+                                if (target == NULL)
+                                {
+                                        dxf_bbox_add_point (bbox, vertex->x0, vertex->y0, z);
+                                        continue;
+                                }
+                                dxf_bbox_add_bulge (bbox, vertex->x0, vertex->y0,
+                                  target->x0, target->y0, z,
+                                  vertex->has_bulge ? vertex->bulge : 0.0);
+                        }
+                }
+                for (edge = (DxfHatchBoundaryPathEdge *) path->edges;
+                  edge != NULL;
+                  edge = (DxfHatchBoundaryPathEdge *) edge->next)
+                {
+                        for (line = (DxfHatchBoundaryPathEdgeLine *) edge->lines;
+                          line != NULL;
+                          line = (DxfHatchBoundaryPathEdgeLine *) line->next)
+                        {
+                                dxf_bbox_add_point (bbox, line->x0, line->y0, z);
+                                dxf_bbox_add_point (bbox, line->x1, line->y1, z);
+                        }
+                        /* A clockwise arc from a to b, with the angles
+                         * measured clockwise, is the counterclockwise
+                         * arc from -b to -a. */
+                        for (arc = (DxfHatchBoundaryPathEdgeArc *) edge->arcs;
+                          arc != NULL;
+                          arc = (DxfHatchBoundaryPathEdgeArc *) arc->next)
+                        {
+                                if (arc->is_ccw)
+                                {
+                                        dxf_bbox_add_arc (bbox, arc->x0, arc->y0, z,
+                                          arc->radius, arc->start_angle, arc->end_angle);
+                                }
+                                else
+                                {
+                                        dxf_bbox_add_arc (bbox, arc->x0, arc->y0, z,
+                                          arc->radius, -arc->end_angle, -arc->start_angle);
+                                }
+                        }
+                        for (ellipse = (DxfHatchBoundaryPathEdgeEllipse *) edge->ellipses;
+                          ellipse != NULL;
+                          ellipse = (DxfHatchBoundaryPathEdgeEllipse *) ellipse->next)
+                        {
+                                center.x = ellipse->x0;
+                                center.y = ellipse->y0;
+                                center.z = z;
+                                major.x = ellipse->x1;
+                                major.y = ellipse->y1;
+                                major.z = 0.0;
+                                minor.x = -ellipse->ratio * ellipse->y1;
+                                minor.y = ellipse->ratio * ellipse->x1;
+                                minor.z = 0.0;
+                                if (ellipse->is_ccw)
+                                {
+                                        dxf_bbox_add_ellipse (bbox, &center, &major, &minor,
+                                          ellipse->start_angle * M_PI / 180.0,
+                                          ellipse->end_angle * M_PI / 180.0);
+                                }
+                                else
+                                {
+                                        dxf_bbox_add_ellipse (bbox, &center, &major, &minor,
+                                          -ellipse->end_angle * M_PI / 180.0,
+                                          -ellipse->start_angle * M_PI / 180.0);
+                                }
+                        }
+                        for (spline = (DxfHatchBoundaryPathEdgeSpline *) edge->splines;
+                          spline != NULL;
+                          spline = (DxfHatchBoundaryPathEdgeSpline *) spline->next)
+                        {
+                                for (control_point = (DxfHatchBoundaryPathEdgeSplineCp *) spline->control_points;
+                                  control_point != NULL;
+                                  control_point = (DxfHatchBoundaryPathEdgeSplineCp *) control_point->next)
+                                {
+                                        dxf_bbox_add_point (bbox, control_point->x0, control_point->y0, z);
+                                }
+                        }
+                }
+        }
+        extrusion.x = hatch->extr_x0;
+        extrusion.y = hatch->extr_y0;
+        extrusion.z = hatch->extr_z0;
+        dxf_bbox_ocs_to_wcs (bbox, &extrusion);
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Map a point in the plane Z = 0 of a \c HATCH with the
+ * transformation of it's Object Coordinate System (OCS) coordinates.
+ */
+static void
+dxf_hatch_transform_point
+(
+        DxfTransform *ocs,
+                /*!< a pointer to the transformation of the OCS
+                 * coordinates, with the elevation in the
+                 * translation. */
+        double *x,
+                /*!< X-value of the point. */
+        double *y
+                /*!< Y-value of the point. */
+)
+{
+        double u = *x;
+        double v = *y;
+
+        *x = (ocs->m[0][0] * u) + (ocs->m[0][1] * v) + ocs->m[0][3];
+        *y = (ocs->m[1][0] * u) + (ocs->m[1][1] * v) + ocs->m[1][3];
+}
+
+
+/*!
+ * \brief Map a direction or displacement in the plane of a \c HATCH
+ * with the transformation of it's Object Coordinate System (OCS)
+ * coordinates, leaving out the translation.
+ */
+static void
+dxf_hatch_transform_vector
+(
+        DxfTransform *ocs,
+                /*!< a pointer to the transformation of the OCS
+                 * coordinates. */
+        double *x,
+                /*!< X-value of the vector. */
+        double *y
+                /*!< Y-value of the vector. */
+)
+{
+        double u = *x;
+        double v = *y;
+
+        *x = (ocs->m[0][0] * u) + (ocs->m[0][1] * v);
+        *y = (ocs->m[1][0] * u) + (ocs->m[1][1] * v);
+}
+
+
+/*!
+ * \brief Map the pattern definition lines and seed points of a
+ * \c HATCH with the transformation of it's Object Coordinate System
+ * (OCS) coordinates.
+ */
+static void
+dxf_hatch_transform_pattern
+(
+        DxfHatchPatternDefLine *def_lines,
+                /*!< a pointer to the first pattern definition line,
+                 * may be \c NULL. */
+        DxfHatchPatternSeedPoint *seed_points,
+                /*!< a pointer to the first seed point, may be
+                 * \c NULL. */
+        DxfTransform *ocs,
+                /*!< a pointer to the transformation of the OCS
+                 * coordinates, with the elevation in the
+                 * translation. */
+        double scale,
+                /*!< Scale factor in the plane of the \c HATCH. */
+        double rotation
+                /*!< Rotation in the plane of the \c HATCH, in
+                 * degrees. */
+)
+{
+        DxfHatchPatternDefLine *def_line;
+        DxfHatchPatternDefLineDash *dash;
+        DxfHatchPatternSeedPoint *seed_point;
+
+        for (def_line = def_lines;
+          def_line != NULL;
+          def_line = (DxfHatchPatternDefLine *) def_line->next)
+        {
+                def_line->angle = fmod (def_line->angle + rotation, 360.0);
+                dxf_hatch_transform_point (ocs, &def_line->x0, &def_line->y0);
+                dxf_hatch_transform_vector (ocs, &def_line->x1, &def_line->y1);
+                for (dash = (DxfHatchPatternDefLineDash *) def_line->dashes;
+                  dash != NULL;
+                  dash = (DxfHatchPatternDefLineDash *) dash->next)
+                {
+                        dash->length *= scale;
+                }
+        }
+        for (seed_point = seed_points;
+          seed_point != NULL;
+          seed_point = (DxfHatchPatternSeedPoint *) seed_point->next)
+        {
+                dxf_hatch_transform_point (ocs, &seed_point->x0, &seed_point->y0);
+        }
+}
+
+
+/*!
+ * \brief Transform a DXF \c HATCH entity in place.
+ *
+ * The boundary paths, the pattern definition lines and the seed
+ * points of \c hatch lie at it's elevation in it's Object Coordinate
+ * System (OCS), \c transform has to map the plane of the OCS with a
+ * uniform scale, see dxf_transform_get_ocs_transform ().\n
+ * Arc and ellipse edges keep their direction, the angles of
+ * clockwise arc edges are measured clockwise.  The pattern angle and
+ * scale follow the rotation and scale in the plane.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred, or when \c transform does not map the entity without
+ * distortion.
+ */
+int
+dxf_hatch_transform
+(
+        DxfHatch *hatch,
+                /*!< a pointer to a DXF \c HATCH entity. */
+        DxfTransform *transform
+                /*!< a pointer to a libDXF affine transformation. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfHatchBoundaryPath *path;
+        DxfHatchBoundaryPathPolyline *polyline;
+        DxfHatchBoundaryPathPolylineVertex *vertex;
+        DxfHatchBoundaryPathEdge *edge;
+        DxfHatchBoundaryPathEdgeLine *line;
+        DxfHatchBoundaryPathEdgeArc *arc;
+        DxfHatchBoundaryPathEdgeEllipse *ellipse;
+        DxfHatchBoundaryPathEdgeSpline *spline;
+        DxfHatchBoundaryPathEdgeSplineCp *control_point;
+        DxfHatchPattern *pattern;
+        DxfTransform ocs;
+        DxfVec3 extrusion;
+        double scale;
+        double rotation;
+        double z;
+        int i;
+
+        /* Do some basic checks. */
+        if ((hatch == NULL) || (transform == NULL))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        extrusion.x = hatch->extr_x0;
+        extrusion.y = hatch->extr_y0;
+        extrusion.z = hatch->extr_z0;
+        if (dxf_transform_get_ocs_transform (transform, &extrusion, &ocs, &scale) == EXIT_FAILURE)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () the transformation distorts the HATCH entity with id-code: %" PRIx64 "\n")),
+                  __FUNCTION__, hatch->id_code);
+                return (EXIT_FAILURE);
+        }
+        /* Move the elevation into the translation, the boundary
+         * paths are in the plane Z = 0 then. */
+        z = (hatch->p0 != NULL) ? hatch->p0->z0 : hatch->elevation;
+        for (i = 0; i < 3; i++)
+        {
+                ocs.m[i][3] += ocs.m[i][2] * z;
+        }
+        rotation = atan2 (ocs.m[1][0], ocs.m[0][0]) * 180.0 / M_PI;
+        for (path = (DxfHatchBoundaryPath *) hatch->paths;
+          path != NULL;
+          path = (DxfHatchBoundaryPath *) path->next)
+        {
+                for (polyline = (DxfHatchBoundaryPathPolyline *) path->polylines;
+                  polyline != NULL;
+                  polyline = (DxfHatchBoundaryPathPolyline *) polyline->next)
+                {
+                        for (vertex = (DxfHatchBoundaryPathPolylineVertex *) polyline->vertices;
+                          vertex != NULL;
+                          vertex = (DxfHatchBoundaryPathPolylineVertex *) vertex->next)
+                        {
+                                dxf_hatch_transform_point (&ocs, &vertex->x0, &vertex->y0);
+                        }
+                }
+                for (edge = (DxfHatchBoundaryPathEdge *) path->edges;
+                  edge != NULL;
+                  edge = (DxfHatchBoundaryPathEdge *) edge->next)
+                {
+                        for (line = (DxfHatchBoundaryPathEdgeLine *) edge->lines;
+                          line != NULL;
+                          line = (DxfHatchBoundaryPathEdgeLine *) line->next)
+                        {
+                                dxf_hatch_transform_point (&ocs, &line->x0, &line->y0);
+                                dxf_hatch_transform_point (&ocs, &line->x1, &line->y1);
+                        }
+                        for (arc = (DxfHatchBoundaryPathEdgeArc *) edge->arcs;
+                          arc != NULL;
+                          arc = (DxfHatchBoundaryPathEdgeArc *) arc->next)
+                        {
+                                dxf_hatch_transform_point (&ocs, &arc->x0, &arc->y0);
+                                arc->radius *= scale;
+                                if (arc->is_ccw)
+                                {
+                                        arc->start_angle = fmod (arc->start_angle + rotation, 360.0);
+                                        arc->end_angle = fmod (arc->end_angle + rotation, 360.0);
+                                }
+                                else
+                                {
+                                        arc->start_angle = fmod (arc->start_angle - rotation, 360.0);
+                                        arc->end_angle = fmod (arc->end_angle - rotation, 360.0);
+                                }
+                        }
+                        /* The parameters of an ellipse edge are relative
+                         * to it's major axis and stay the same. */
+                        for (ellipse = (DxfHatchBoundaryPathEdgeEllipse *) edge->ellipses;
+                          ellipse != NULL;
+                          ellipse = (DxfHatchBoundaryPathEdgeEllipse *) ellipse->next)
+                        {
+                                dxf_hatch_transform_point (&ocs, &ellipse->x0, &ellipse->y0);
+                                dxf_hatch_transform_vector (&ocs, &ellipse->x1, &ellipse->y1);
+                        }
+                        for (spline = (DxfHatchBoundaryPathEdgeSpline *) edge->splines;
+                          spline != NULL;
+                          spline = (DxfHatchBoundaryPathEdgeSpline *) spline->next)
+                        {
+                                for (control_point = (DxfHatchBoundaryPathEdgeSplineCp *) spline->control_points;
+                                  control_point != NULL;
+                                  control_point = (DxfHatchBoundaryPathEdgeSplineCp *) control_point->next)
+                                {
+                                        dxf_hatch_transform_point (&ocs, &control_point->x0, &control_point->y0);
+                                }
+                        }
+                }
+        }
+        dxf_hatch_transform_pattern ((DxfHatchPatternDefLine *) hatch->def_lines,
+          (DxfHatchPatternSeedPoint *) hatch->seed_points, &ocs, scale, rotation);
+        for (pattern = (DxfHatchPattern *) hatch->patterns;
+          pattern != NULL;
+          pattern = (DxfHatchPattern *) pattern->next)
+        {
+                dxf_hatch_transform_pattern ((DxfHatchPatternDefLine *) pattern->def_lines,
+                  (DxfHatchPatternSeedPoint *) pattern->seed_points, &ocs, scale, rotation);
+        }
+        if (hatch->p0 != NULL)
+        {
+                hatch->p0->z0 = ocs.m[2][3];
+        }
+        else
+        {
+                hatch->elevation = ocs.m[2][3];
+        }
+        hatch->pattern_angle = fmod (hatch->pattern_angle + rotation, 360.0);
+        hatch->pattern_scale *= scale;
+        hatch->pixel_size *= scale;
+        hatch->extr_x0 = extrusion.x;
+        hatch->extr_y0 = extrusion.y;
+        hatch->extr_z0 = extrusion.z;
+        hatch->thickness *= ocs.m[2][2];
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (EXIT_SUCCESS);
+}
+
+
 /* EOF */
@@ -48,6 +48,7 @@
 #include "global.h"
 #include "point.h"
 #include "binary_data.h"
+#include "transform.h"
 
 
 #ifdef __cplusplus
@@ -65,7 +66,7 @@ extern "C" {
 typedef struct
 dxf_hatch_boundary_path_edge_arc_struct
 {
-        int id_code;
+        uint64_t id_code;
                 /*!< Identification number for the entity.\n
                  * This is to be an unique (sequential) number in the
                  * DXF file.\n
@@ -97,7 +98,7 @@ dxf_hatch_boundary_path_edge_arc_struct
 typedef struct
 dxf_hatch_boundary_path_edge_ellipse_struct
 {
-        int id_code;
+        uint64_t id_code;
                 /*!< Identification number for the entity.\n
                  * This is to be an unique (sequential) number in the
                  * DXF file.\n
@@ -138,7 +139,7 @@ dxf_hatch_boundary_path_edge_ellipse_struct
 typedef struct
 dxf_hatch_boundary_path_edge_line_struct
 {
-        int id_code;
+        uint64_t id_code;
                 /*!< Identification number for the entity.\n
                  * This is to be an unique (sequential) number in the
                  * DXF file.\n
@@ -168,7 +169,7 @@ dxf_hatch_boundary_path_edge_line_struct
 typedef struct
 dxf_hatch_boundary_path_edge_spline_cp_struct
 {
-        int id_code;
+        uint64_t id_code;
                 /*!< Identification number for the entity.\n
                  * This is to be an unique (sequential) number in the
                  * DXF file.\n
@@ -194,7 +195,7 @@ dxf_hatch_boundary_path_edge_spline_cp_struct
 typedef struct
 dxf_hatch_boundary_path_edge_spline_struct
 {
-        int id_code;
+        uint64_t id_code;
                 /*!< group code = 5. */
         int32_t degree;
                 /*!< group code = 94. */
@@ -229,7 +230,7 @@ dxf_hatch_boundary_path_edge_spline_struct
 typedef struct
 dxf_hatch_boundary_path_edge_struct
 {
-        int id_code;
+        uint64_t id_code;
                 /*!< Treat the boundary path edge as if it were a single
                  * (composite) entity.\n
                  * Group code = 5. */
@@ -262,7 +263,7 @@ dxf_hatch_boundary_path_edge_struct
 typedef struct
 dxf_hatch_boundary_path_polyline_vertex_struct
 {
-        int id_code;
+        uint64_t id_code;
                 /*!< Group code = 5.*/
         double x0;
                 /*!< Group code = 10. */
@@ -289,7 +290,7 @@ dxf_hatch_boundary_path_polyline_vertex_struct
 typedef struct
 dxf_hatch_boundary_path_polyline_struct
 {
-        int id_code;
+        uint64_t id_code;
                 /*!< Group code = 5. */
         int16_t is_closed;
                 /*!< Group code = 73. */
@@ -316,7 +317,7 @@ dxf_hatch_boundary_path_polyline_struct
 typedef struct
 dxf_hatch_boundary_path_struct
 {
-        int id_code;
+        uint64_t id_code;
                 /*!< Treat the boundary path as if it were a single
                  * (composite) entity.\n
                  * Group code = 5. */
@@ -356,7 +357,7 @@ dxf_hatch_pattern_def_line_dash_struct
 typedef struct
 dxf_hatch_pattern_def_line_struct
 {
-        int id_code;
+        uint64_t id_code;
                 /*!< group code = 5. */
         double angle;
                 /*!< Hatch pattern line angle.\n
@@ -391,7 +392,7 @@ dxf_hatch_pattern_def_line_struct
 typedef struct
 dxf_hatch_pattern_seedpoint_struct
 {
-        int id_code;
+        uint64_t id_code;
                 /*!< group code = 5. */
         double x0;
                 /*!< Seed point X-value.\n
@@ -411,7 +412,7 @@ dxf_hatch_pattern_seedpoint_struct
 typedef struct
 dxf_hatch_pattern_struct
 {
-        int id_code;
+        uint64_t id_code;
                 /*!< group code = 5. */
         int16_t number_of_def_lines;
                 /*!< Number of hatch pattern definition lines.\n
@@ -436,7 +437,7 @@ typedef struct
 dxf_hatch_struct
 {
         /* Members common for all DXF drawable entities. */
-        int id_code;
+        uint64_t id_code;
                 /*!< Identification number for the entity.\n
                  * This is to be an unique (sequential) number in the DXF
                  * file.\n
@@ -506,20 +507,20 @@ dxf_hatch_struct
                  * (optional).\n
                  * Group code = 310.\n
                  * \since Introduced in version R2000. */
-        char *dictionary_owner_soft;
+        uint64_t dictionary_owner_soft;
                 /*!< Soft-pointer ID/handle to owner dictionary (optional).\n
                  * Group code = 330.\n
                  * \since Introduced in version R14. */
-        char *object_owner_soft;
+        uint64_t object_owner_soft;
                 /*!< Soft-pointer ID/handle  to owner BLOCK_RECORD object.\n
                  * Group code = 330.\n
                  * \since Introduced in version R2000. */
-        char *material;
+        uint64_t material;
                 /*!< Hard-pointer ID/handle to material object (present if
                  * not BYLAYER).\n
                  * Group code = 347.\n
                  * \since Introduced in version R2008. */
-        char *dictionary_owner_hard;
+        uint64_t dictionary_owner_hard;
                 /*!< Hard owner ID/handle to owner dictionary (optional).\n
                  * Group code = 360.\n
                  * \since Introduced in version R14. */
@@ -528,7 +529,7 @@ dxf_hatch_struct
                  * Stored and moved around as a 16-bit integer.\n
                  * Group code = 370.\n
                  * \since Introduced in version R2002. */
-        char *plot_style_name;
+        uint64_t plot_style_name;
                 /*!< Hard pointer ID / handle of PlotStyleName object.\n
                  * Group code = 390.\n
                  * \since Introduced in version R2009. */
@@ -644,8 +645,8 @@ DxfHatch *dxf_hatch_init (DxfHatch *hatch);
 int dxf_hatch_write (DxfFile *fp, DxfHatch *hatch);
 int dxf_hatch_free (DxfHatch *hatch);
 void dxf_hatch_free_list (DxfHatch *hatches);
-int dxf_hatch_get_id_code (DxfHatch *hatch);
-DxfHatch *dxf_hatch_set_id_code (DxfHatch *hatch, int id_code);
+uint64_t dxf_hatch_get_id_code (DxfHatch *hatch);
+DxfHatch *dxf_hatch_set_id_code (DxfHatch *hatch, uint64_t id_code);
 char *dxf_hatch_get_linetype (DxfHatch *hatch);
 DxfHatch *dxf_hatch_set_linetype (DxfHatch *hatch, char *linetype);
 char *dxf_hatch_get_layer (DxfHatch *hatch);
@@ -666,18 +667,18 @@ int32_t dxf_hatch_get_graphics_data_size (DxfHatch *hatch);
 DxfHatch *dxf_hatch_set_graphics_data_size (DxfHatch *hatch, int32_t graphics_data_size);
 DxfBinaryData *dxf_hatch_get_binary_graphics_data (DxfHatch *hatch);
 DxfHatch *dxf_hatch_set_binary_graphics_data (DxfHatch *hatch, DxfBinaryData *data);
-char *dxf_hatch_get_dictionary_owner_soft (DxfHatch *hatch);
-DxfHatch *dxf_hatch_set_dictionary_owner_soft (DxfHatch *hatch, char *dictionary_owner_soft);
-char *dxf_hatch_get_object_owner_soft (DxfHatch *hatch);
-DxfHatch *dxf_hatch_set_object_owner_soft (DxfHatch *hatch, char *object_owner_soft);
-char *dxf_hatch_get_material (DxfHatch *hatch);
-DxfHatch *dxf_hatch_set_material (DxfHatch *hatch, char *material);
-char *dxf_hatch_get_dictionary_owner_hard (DxfHatch *hatch);
-DxfHatch *dxf_hatch_set_dictionary_owner_hard (DxfHatch *hatch, char *dictionary_owner_hard);
+uint64_t dxf_hatch_get_dictionary_owner_soft (DxfHatch *hatch);
+DxfHatch *dxf_hatch_set_dictionary_owner_soft (DxfHatch *hatch, uint64_t dictionary_owner_soft);
+uint64_t dxf_hatch_get_object_owner_soft (DxfHatch *hatch);
+DxfHatch *dxf_hatch_set_object_owner_soft (DxfHatch *hatch, uint64_t object_owner_soft);
+uint64_t dxf_hatch_get_material (DxfHatch *hatch);
+DxfHatch *dxf_hatch_set_material (DxfHatch *hatch, uint64_t material);
+uint64_t dxf_hatch_get_dictionary_owner_hard (DxfHatch *hatch);
+DxfHatch *dxf_hatch_set_dictionary_owner_hard (DxfHatch *hatch, uint64_t dictionary_owner_hard);
 int16_t dxf_hatch_get_lineweight (DxfHatch *hatch);
 DxfHatch *dxf_hatch_set_lineweight (DxfHatch *hatch, int16_t lineweight);
-char *dxf_hatch_get_plot_style_name (DxfHatch *hatch);
-DxfHatch *dxf_hatch_set_plot_style_name (DxfHatch *hatch, char *plot_style_name);
+uint64_t dxf_hatch_get_plot_style_name (DxfHatch *hatch);
+DxfHatch *dxf_hatch_set_plot_style_name (DxfHatch *hatch, uint64_t plot_style_name);
 int32_t dxf_hatch_get_color_value (DxfHatch *hatch);
 DxfHatch *dxf_hatch_set_color_value (DxfHatch *hatch, int32_t color_value);
 char *dxf_hatch_get_color_name (DxfHatch *hatch);
@@ -728,8 +729,8 @@ DxfHatchPattern *dxf_hatch_pattern_new ();
 DxfHatchPattern *dxf_hatch_pattern_init (DxfHatchPattern *pattern);
 int dxf_hatch_pattern_free (DxfHatchPattern *pattern);
 void dxf_hatch_pattern_free_list (DxfHatchPattern *patterns);
-int dxf_hatch_pattern_get_id_code (DxfHatchPattern *pattern);
-DxfHatchPattern *dxf_hatch_pattern_set_id_code (DxfHatchPattern *pattern, int id_code);
+uint64_t dxf_hatch_pattern_get_id_code (DxfHatchPattern *pattern);
+DxfHatchPattern *dxf_hatch_pattern_set_id_code (DxfHatchPattern *pattern, uint64_t id_code);
 int16_t dxf_hatch_pattern_get_number_of_def_lines (DxfHatchPattern *pattern);
 DxfHatchPattern *dxf_hatch_pattern_set_number_of_def_lines (DxfHatchPattern *pattern, int16_t number_of_def_lines);
 DxfHatchPatternDefLine *dxf_hatch_pattern_get_def_lines (DxfHatchPattern *pattern);
@@ -757,8 +758,8 @@ DxfHatchPatternDefLine *dxf_hatch_pattern_def_line_init (DxfHatchPatternDefLine
 int dxf_hatch_pattern_def_line_write (DxfFile *fp, DxfHatchPatternDefLine *line);
 int dxf_hatch_pattern_def_line_free (DxfHatchPatternDefLine *line);
 void dxf_hatch_pattern_def_line_free_list (DxfHatchPatternDefLine *lines);
-int dxf_hatch_pattern_def_line_get_id_code (DxfHatchPatternDefLine *line);
-DxfHatchPatternDefLine *dxf_hatch_pattern_def_line_set_id_code (DxfHatchPatternDefLine *line, int id_code);
+uint64_t dxf_hatch_pattern_def_line_get_id_code (DxfHatchPatternDefLine *line);
+DxfHatchPatternDefLine *dxf_hatch_pattern_def_line_set_id_code (DxfHatchPatternDefLine *line, uint64_t id_code);
 double dxf_hatch_pattern_def_line_get_angle (DxfHatchPatternDefLine *line);
 DxfHatchPatternDefLine *dxf_hatch_pattern_def_line_set_angle (DxfHatchPatternDefLine *line, double angle);
 double dxf_hatch_pattern_def_line_get_x0 (DxfHatchPatternDefLine *line);
@@ -782,8 +783,8 @@ DxfHatchPatternSeedPoint *dxf_hatch_pattern_seedpoint_init (DxfHatchPatternSeedP
 int dxf_hatch_pattern_seedpoint_write (DxfFile *fp, DxfHatchPatternSeedPoint *seedpoint);
 int dxf_hatch_pattern_seedpoint_free (DxfHatchPatternSeedPoint *seedpoint);
 void dxf_hatch_pattern_seedpoint_free_list (DxfHatchPatternSeedPoint *hatch_pattern_seed_points);
-int dxf_hatch_pattern_seedpoint_get_id_code (DxfHatchPatternSeedPoint *point);
-DxfHatchPatternSeedPoint *dxf_hatch_pattern_seedpoint_set_id_code (DxfHatchPatternSeedPoint *point, int id_code);
+uint64_t dxf_hatch_pattern_seedpoint_get_id_code (DxfHatchPatternSeedPoint *point);
+DxfHatchPatternSeedPoint *dxf_hatch_pattern_seedpoint_set_id_code (DxfHatchPatternSeedPoint *point, uint64_t id_code);
 double dxf_hatch_pattern_seedpoint_get_x0 (DxfHatchPatternSeedPoint *point);
 DxfHatchPatternSeedPoint *dxf_hatch_pattern_seedpoint_set_x0 (DxfHatchPatternSeedPoint *point, double x0);
 double dxf_hatch_pattern_seedpoint_get_y0 (DxfHatchPatternSeedPoint *point);
@@ -797,8 +798,8 @@ DxfHatchBoundaryPath *dxf_hatch_boundary_path_init (DxfHatchBoundaryPath *path);
 int dxf_hatch_boundary_path_write (DxfFile *fp, DxfHatchBoundaryPath *path);
 int dxf_hatch_boundary_path_free (DxfHatchBoundaryPath *path);
 void dxf_hatch_boundary_path_free_list (DxfHatchBoundaryPath *hatch_boundary_paths);
-int dxf_hatch_boundary_path_get_id_code (DxfHatchBoundaryPath *path);
-DxfHatchBoundaryPath *dxf_hatch_boundary_path_set_id_code (DxfHatchBoundaryPath *path, int id_code);
+uint64_t dxf_hatch_boundary_path_get_id_code (DxfHatchBoundaryPath *path);
+DxfHatchBoundaryPath *dxf_hatch_boundary_path_set_id_code (DxfHatchBoundaryPath *path, uint64_t id_code);
 DxfHatchBoundaryPathEdge *dxf_hatch_boundary_path_get_edges (DxfHatchBoundaryPath *path);
 DxfHatchBoundaryPath *dxf_hatch_boundary_path_set_edges (DxfHatchBoundaryPath *path, DxfHatchBoundaryPathEdge *edges);
 DxfHatchBoundaryPathPolyline *dxf_hatch_boundary_path_get_polylines (DxfHatchBoundaryPath *path);
@@ -812,8 +813,8 @@ DxfHatchBoundaryPathPolyline *dxf_hatch_boundary_path_polyline_init (DxfHatchBou
 int dxf_hatch_boundary_path_polyline_write (DxfFile *fp, DxfHatchBoundaryPathPolyline *polyline);
 int dxf_hatch_boundary_path_polyline_free (DxfHatchBoundaryPathPolyline *polyline);
 void dxf_hatch_boundary_path_polyline_free_list (DxfHatchBoundaryPathPolyline *polylines);
-int dxf_hatch_boundary_path_polyline_get_id_code (DxfHatchBoundaryPathPolyline *polyline);
-DxfHatchBoundaryPathPolyline *dxf_hatch_boundary_path_polyline_set_id_code (DxfHatchBoundaryPathPolyline *polyline, int id_code);
+uint64_t dxf_hatch_boundary_path_polyline_get_id_code (DxfHatchBoundaryPathPolyline *polyline);
+DxfHatchBoundaryPathPolyline *dxf_hatch_boundary_path_polyline_set_id_code (DxfHatchBoundaryPathPolyline *polyline, uint64_t id_code);
 int16_t dxf_hatch_boundary_path_polyline_get_is_closed (DxfHatchBoundaryPathPolyline *polyline);
 DxfHatchBoundaryPathPolyline *dxf_hatch_boundary_path_polyline_set_is_closed (DxfHatchBoundaryPathPolyline *polyline, int16_t is_closed);
 int32_t dxf_hatch_boundary_path_polyline_get_number_of_vertices (DxfHatchBoundaryPathPolyline *polyline);
@@ -831,8 +832,8 @@ DxfHatchBoundaryPathPolylineVertex *dxf_hatch_boundary_path_polyline_vertex_init
 int dxf_hatch_boundary_path_polyline_vertex_write (DxfFile *fp, DxfHatchBoundaryPathPolylineVertex *vertex);
 int dxf_hatch_boundary_path_polyline_vertex_free (DxfHatchBoundaryPathPolylineVertex *vertex);
 void dxf_hatch_boundary_path_polyline_vertex_free_list (DxfHatchBoundaryPathPolylineVertex *hatch_boundary_path_polyline_vertices);
-int dxf_hatch_boundary_path_polyline_vertex_get_id_code (DxfHatchBoundaryPathPolylineVertex *vertex);
-DxfHatchBoundaryPathPolylineVertex *dxf_hatch_boundary_path_polyline_vertex_set_id_code (DxfHatchBoundaryPathPolylineVertex *vertex, int id_code);
+uint64_t dxf_hatch_boundary_path_polyline_vertex_get_id_code (DxfHatchBoundaryPathPolylineVertex *vertex);
+DxfHatchBoundaryPathPolylineVertex *dxf_hatch_boundary_path_polyline_vertex_set_id_code (DxfHatchBoundaryPathPolylineVertex *vertex, uint64_t id_code);
 double dxf_hatch_boundary_path_polyline_vertex_get_x0 (DxfHatchBoundaryPathPolylineVertex *vertex);
 DxfHatchBoundaryPathPolylineVertex *dxf_hatch_boundary_path_polyline_vertex_set_x0 (DxfHatchBoundaryPathPolylineVertex *vertex, double x0);
 double dxf_hatch_boundary_path_polyline_vertex_get_y0 (DxfHatchBoundaryPathPolylineVertex *vertex);
@@ -850,8 +851,8 @@ DxfHatchBoundaryPathEdge *dxf_hatch_boundary_path_edge_new ();
 DxfHatchBoundaryPathEdge * dxf_hatch_boundary_path_edge_init (DxfHatchBoundaryPathEdge *edge);
 int dxf_hatch_boundary_path_edge_free (DxfHatchBoundaryPathEdge *edge);
 void dxf_hatch_boundary_path_edge_free_list (DxfHatchBoundaryPathEdge *edges);
-int dxf_hatch_boundary_path_edge_get_id_code (DxfHatchBoundaryPathEdge *edge);
-DxfHatchBoundaryPathEdge *dxf_hatch_boundary_path_edge_set_id_code (DxfHatchBoundaryPathEdge *edge, int id_code);
+uint64_t dxf_hatch_boundary_path_edge_get_id_code (DxfHatchBoundaryPathEdge *edge);
+DxfHatchBoundaryPathEdge *dxf_hatch_boundary_path_edge_set_id_code (DxfHatchBoundaryPathEdge *edge, uint64_t id_code);
 DxfHatchBoundaryPathEdgeArc *dxf_hatch_boundary_path_edge_get_arcs (DxfHatchBoundaryPathEdge *edge);
 DxfHatchBoundaryPathEdge *dxf_hatch_boundary_path_edge_set_arcs (DxfHatchBoundaryPathEdge *edge, DxfHatchBoundaryPathEdgeArc *arcs);
 DxfHatchBoundaryPathEdgeEllipse *dxf_hatch_boundary_path_edge_get_ellipses (DxfHatchBoundaryPathEdge *edge);
@@ -868,13 +869,13 @@ DxfHatchBoundaryPathEdgeArc *dxf_hatch_boundary_path_edge_arc_new ();
 DxfHatchBoundaryPathEdgeArc *dxf_hatch_boundary_path_edge_arc_init (DxfHatchBoundaryPathEdgeArc *arc);
 int dxf_hatch_boundary_path_edge_arc_free (DxfHatchBoundaryPathEdgeArc *arc);
 void dxf_hatch_boundary_path_edge_arc_free_list (DxfHatchBoundaryPathEdgeArc *hatch_boundary_path_edge_arcs);
-int dxf_hatch_boundary_path_edge_arc_get_id_code (DxfHatchBoundaryPathEdgeArc *arc);
-DxfHatchBoundaryPathEdgeArc *dxf_hatch_boundary_path_edge_arc_set_id_code (DxfHatchBoundaryPathEdgeArc *arc, int id_code);
+uint64_t dxf_hatch_boundary_path_edge_arc_get_id_code (DxfHatchBoundaryPathEdgeArc *arc);
+DxfHatchBoundaryPathEdgeArc *dxf_hatch_boundary_path_edge_arc_set_id_code (DxfHatchBoundaryPathEdgeArc *arc, uint64_t id_code);
 double dxf_hatch_boundary_path_edge_arc_get_x0 (DxfHatchBoundaryPathEdgeArc *arc);
 DxfHatchBoundaryPathEdgeArc *dxf_hatch_boundary_path_edge_arc_set_x0 (DxfHatchBoundaryPathEdgeArc *arc, double x0);
 double dxf_hatch_boundary_path_edge_arc_get_y0 (DxfHatchBoundaryPathEdgeArc *arc);
 DxfHatchBoundaryPathEdgeArc *dxf_hatch_boundary_path_edge_arc_set_y0 (DxfHatchBoundaryPathEdgeArc *arc, double y0);
-DxfPoint *dxf_hatch_boundary_path_edge_arc_get_center_point (DxfHatchBoundaryPathEdgeArc *arc, int id_code);
+DxfPoint *dxf_hatch_boundary_path_edge_arc_get_center_point (DxfHatchBoundaryPathEdgeArc *arc, uint64_t id_code);
 DxfHatchBoundaryPathEdgeArc *dxf_hatch_boundary_path_edge_arc_set_center_point (DxfHatchBoundaryPathEdgeArc *arc, DxfPoint *point);
 double dxf_hatch_boundary_path_edge_arc_get_radius (DxfHatchBoundaryPathEdgeArc *arc);
 DxfHatchBoundaryPathEdgeArc *dxf_hatch_boundary_path_edge_arc_set_radius (DxfHatchBoundaryPathEdgeArc *arc, double radius);
@@ -892,19 +893,19 @@ DxfHatchBoundaryPathEdgeEllipse *dxf_hatch_boundary_path_edge_ellipse_new ();
 DxfHatchBoundaryPathEdgeEllipse *dxf_hatch_boundary_path_edge_ellipse_init (DxfHatchBoundaryPathEdgeEllipse *ellipse);
 int dxf_hatch_boundary_path_edge_ellipse_free (DxfHatchBoundaryPathEdgeEllipse *ellipse);
 void dxf_hatch_boundary_path_edge_ellipse_free_list (DxfHatchBoundaryPathEdgeEllipse *hatch_boundary_path_edge_ellipses);
-int dxf_hatch_boundary_path_edge_ellipse_get_id_code (DxfHatchBoundaryPathEdgeEllipse *ellipse);
-DxfHatchBoundaryPathEdgeEllipse *dxf_hatch_boundary_path_edge_ellipse_set_id_code (DxfHatchBoundaryPathEdgeEllipse *ellipse, int id_code);
+uint64_t dxf_hatch_boundary_path_edge_ellipse_get_id_code (DxfHatchBoundaryPathEdgeEllipse *ellipse);
+DxfHatchBoundaryPathEdgeEllipse *dxf_hatch_boundary_path_edge_ellipse_set_id_code (DxfHatchBoundaryPathEdgeEllipse *ellipse, uint64_t id_code);
 double dxf_hatch_boundary_path_edge_ellipse_get_x0 (DxfHatchBoundaryPathEdgeEllipse *ellipse);
 DxfHatchBoundaryPathEdgeEllipse *dxf_hatch_boundary_path_edge_ellipse_set_x0 (DxfHatchBoundaryPathEdgeEllipse *ellipse, double x0);
 double dxf_hatch_boundary_path_edge_ellipse_get_y0 (DxfHatchBoundaryPathEdgeEllipse *ellipse);
 DxfHatchBoundaryPathEdgeEllipse *dxf_hatch_boundary_path_edge_ellipse_set_y0 (DxfHatchBoundaryPathEdgeEllipse *ellipse, double y0);
-DxfPoint *dxf_hatch_boundary_path_edge_ellipse_get_center_point (DxfHatchBoundaryPathEdgeEllipse *ellipse, int id_code);
+DxfPoint *dxf_hatch_boundary_path_edge_ellipse_get_center_point (DxfHatchBoundaryPathEdgeEllipse *ellipse, uint64_t id_code);
 DxfHatchBoundaryPathEdgeEllipse *dxf_hatch_boundary_path_edge_ellipse_set_center_point (DxfHatchBoundaryPathEdgeEllipse *ellipse, DxfPoint *point);
 double dxf_hatch_boundary_path_edge_ellipse_get_x1 (DxfHatchBoundaryPathEdgeEllipse *ellipse);
 DxfHatchBoundaryPathEdgeEllipse *dxf_hatch_boundary_path_edge_ellipse_set_x1 (DxfHatchBoundaryPathEdgeEllipse *ellipse, double x1);
 double dxf_hatch_boundary_path_edge_ellipse_get_y1 (DxfHatchBoundaryPathEdgeEllipse *ellipse);
 DxfHatchBoundaryPathEdgeEllipse *dxf_hatch_boundary_path_edge_ellipse_set_y1 (DxfHatchBoundaryPathEdgeEllipse *ellipse, double y1);
-DxfPoint *dxf_hatch_boundary_path_edge_ellipse_get_end_point (DxfHatchBoundaryPathEdgeEllipse *ellipse, int id_code);
+DxfPoint *dxf_hatch_boundary_path_edge_ellipse_get_end_point (DxfHatchBoundaryPathEdgeEllipse *ellipse, uint64_t id_code);
 DxfHatchBoundaryPathEdgeEllipse *dxf_hatch_boundary_path_edge_ellipse_set_end_point (DxfHatchBoundaryPathEdgeEllipse *ellipse, DxfPoint *point);
 double dxf_hatch_boundary_path_edge_ellipse_get_ratio (DxfHatchBoundaryPathEdgeEllipse *ellipse);
 DxfHatchBoundaryPathEdgeEllipse *dxf_hatch_boundary_path_edge_ellipse_set_ratio (DxfHatchBoundaryPathEdgeEllipse *ellipse, double ratio);
@@ -922,19 +923,19 @@ DxfHatchBoundaryPathEdgeLine *dxf_hatch_boundary_path_edge_line_new ();
 DxfHatchBoundaryPathEdgeLine *dxf_hatch_boundary_path_edge_line_init (DxfHatchBoundaryPathEdgeLine *line);
 int dxf_hatch_boundary_path_edge_line_free (DxfHatchBoundaryPathEdgeLine *line);
 void dxf_hatch_boundary_path_edge_line_free_list (DxfHatchBoundaryPathEdgeLine *hatch_boundary_path_edge_lines);
-int dxf_hatch_boundary_path_edge_line_get_id_code (DxfHatchBoundaryPathEdgeLine *line);
-DxfHatchBoundaryPathEdgeLine *dxf_hatch_boundary_path_edge_line_set_id_code (DxfHatchBoundaryPathEdgeLine *line, int id_code);
+uint64_t dxf_hatch_boundary_path_edge_line_get_id_code (DxfHatchBoundaryPathEdgeLine *line);
+DxfHatchBoundaryPathEdgeLine *dxf_hatch_boundary_path_edge_line_set_id_code (DxfHatchBoundaryPathEdgeLine *line, uint64_t id_code);
 double dxf_hatch_boundary_path_edge_line_get_x0 (DxfHatchBoundaryPathEdgeLine *line);
 DxfHatchBoundaryPathEdgeLine *dxf_hatch_boundary_path_edge_line_set_x0 (DxfHatchBoundaryPathEdgeLine *line, double x0);
 double dxf_hatch_boundary_path_edge_line_get_y0 (DxfHatchBoundaryPathEdgeLine *line);
 DxfHatchBoundaryPathEdgeLine *dxf_hatch_boundary_path_edge_line_set_y0 (DxfHatchBoundaryPathEdgeLine *line, double y0);
-DxfPoint *dxf_hatch_boundary_path_edge_line_get_start_point (DxfHatchBoundaryPathEdgeLine *line, int id_code);
+DxfPoint *dxf_hatch_boundary_path_edge_line_get_start_point (DxfHatchBoundaryPathEdgeLine *line, uint64_t id_code);
 DxfHatchBoundaryPathEdgeLine *dxf_hatch_boundary_path_edge_line_set_start_point (DxfHatchBoundaryPathEdgeLine *line, DxfPoint *point);
 double dxf_hatch_boundary_path_edge_line_get_x1 (DxfHatchBoundaryPathEdgeLine *line);
 DxfHatchBoundaryPathEdgeLine *dxf_hatch_boundary_path_edge_line_set_x1 (DxfHatchBoundaryPathEdgeLine *line, double x1);
 double dxf_hatch_boundary_path_edge_line_get_y1 (DxfHatchBoundaryPathEdgeLine *line);
 DxfHatchBoundaryPathEdgeLine *dxf_hatch_boundary_path_edge_line_set_y1 (DxfHatchBoundaryPathEdgeLine *line, double y1);
-DxfPoint *dxf_hatch_boundary_path_edge_line_get_end_point (DxfHatchBoundaryPathEdgeLine *line, int id_code);
+DxfPoint *dxf_hatch_boundary_path_edge_line_get_end_point (DxfHatchBoundaryPathEdgeLine *line, uint64_t id_code);
 DxfHatchBoundaryPathEdgeLine *dxf_hatch_boundary_path_edge_line_set_end_point (DxfHatchBoundaryPathEdgeLine *line, DxfPoint *point);
 DxfHatchBoundaryPathEdgeLine *dxf_hatch_boundary_path_edge_line_get_next (DxfHatchBoundaryPathEdgeLine *line);
 DxfHatchBoundaryPathEdgeLine *dxf_hatch_boundary_path_edge_line_set_next (DxfHatchBoundaryPathEdgeLine *line, DxfHatchBoundaryPathEdgeLine *next);
@@ -944,8 +945,8 @@ DxfHatchBoundaryPathEdgeSpline *dxf_hatch_boundary_path_edge_spline_new ();
 DxfHatchBoundaryPathEdgeSpline *dxf_hatch_boundary_path_edge_spline_init (DxfHatchBoundaryPathEdgeSpline *spline);
 int dxf_hatch_boundary_path_edge_spline_free (DxfHatchBoundaryPathEdgeSpline *spline);
 void dxf_hatch_boundary_path_edge_spline_free_list (DxfHatchBoundaryPathEdgeSpline *hatch_boundary_path_edge_splines);
-int dxf_hatch_boundary_path_edge_spline_get_id_code (DxfHatchBoundaryPathEdgeSpline *spline);
-DxfHatchBoundaryPathEdgeSpline *dxf_hatch_boundary_path_edge_spline_set_id_code (DxfHatchBoundaryPathEdgeSpline *spline, int id_code);
+uint64_t dxf_hatch_boundary_path_edge_spline_get_id_code (DxfHatchBoundaryPathEdgeSpline *spline);
+DxfHatchBoundaryPathEdgeSpline *dxf_hatch_boundary_path_edge_spline_set_id_code (DxfHatchBoundaryPathEdgeSpline *spline, uint64_t id_code);
 int32_t dxf_hatch_boundary_path_edge_spline_get_degree (DxfHatchBoundaryPathEdgeSpline *spline);
 DxfHatchBoundaryPathEdgeSpline *dxf_hatch_boundary_path_edge_spline_set_degree (DxfHatchBoundaryPathEdgeSpline *spline, int32_t degree);
 int16_t dxf_hatch_boundary_path_edge_spline_get_rational (DxfHatchBoundaryPathEdgeSpline *spline);
@@ -982,19 +983,21 @@ DxfHatchBoundaryPathEdgeSplineCp *dxf_hatch_boundary_path_edge_spline_control_po
 DxfHatchBoundaryPathEdgeSplineCp *dxf_hatch_boundary_path_edge_spline_control_point_init (DxfHatchBoundaryPathEdgeSplineCp *control_point);
 int dxf_hatch_boundary_path_edge_spline_control_point_free (DxfHatchBoundaryPathEdgeSplineCp *control_point);
 void dxf_hatch_boundary_path_edge_spline_control_point_free_list (DxfHatchBoundaryPathEdgeSplineCp *hatch_boundary_path_edge_spline_control_points);
-int dxf_hatch_boundary_path_edge_spline_cp_get_id_code (DxfHatchBoundaryPathEdgeSplineCp *control_point);
-DxfHatchBoundaryPathEdgeSplineCp *dxf_hatch_boundary_path_edge_spline_cp_set_id_code (DxfHatchBoundaryPathEdgeSplineCp *control_point, int id_code);
+uint64_t dxf_hatch_boundary_path_edge_spline_cp_get_id_code (DxfHatchBoundaryPathEdgeSplineCp *control_point);
+DxfHatchBoundaryPathEdgeSplineCp *dxf_hatch_boundary_path_edge_spline_cp_set_id_code (DxfHatchBoundaryPathEdgeSplineCp *control_point, uint64_t id_code);
 double dxf_hatch_boundary_path_edge_spline_cp_get_x0 (DxfHatchBoundaryPathEdgeSplineCp *control_point);
 DxfHatchBoundaryPathEdgeSplineCp *dxf_hatch_boundary_path_edge_spline_cp_set_x0 (DxfHatchBoundaryPathEdgeSplineCp *control_point, double x0);
 double dxf_hatch_boundary_path_edge_spline_cp_get_y0 (DxfHatchBoundaryPathEdgeSplineCp *control_point);
 DxfHatchBoundaryPathEdgeSplineCp *dxf_hatch_boundary_path_edge_spline_cp_set_y0 (DxfHatchBoundaryPathEdgeSplineCp *control_point, double y0);
-DxfPoint *dxf_hatch_boundary_path_edge_spline_cp_get_point (DxfHatchBoundaryPathEdgeSplineCp *control_point, int id_code);
+DxfPoint *dxf_hatch_boundary_path_edge_spline_cp_get_point (DxfHatchBoundaryPathEdgeSplineCp *control_point, uint64_t id_code);
 DxfHatchBoundaryPathEdgeSplineCp *dxf_hatch_boundary_path_edge_spline_cp_set_point (DxfHatchBoundaryPathEdgeSplineCp *control_point, DxfPoint *point);
 double dxf_hatch_boundary_path_edge_spline_cp_get_weight (DxfHatchBoundaryPathEdgeSplineCp *control_point);
 DxfHatchBoundaryPathEdgeSplineCp *dxf_hatch_boundary_path_edge_spline_cp_set_weight (DxfHatchBoundaryPathEdgeSplineCp *control_point, double weight);
 DxfHatchBoundaryPathEdgeSplineCp *dxf_hatch_boundary_path_edge_spline_cp_get_next (DxfHatchBoundaryPathEdgeSplineCp *control_point);
 DxfHatchBoundaryPathEdgeSplineCp *dxf_hatch_boundary_path_edge_spline_cp_set_next (DxfHatchBoundaryPathEdgeSplineCp *control_point, DxfHatchBoundaryPathEdgeSplineCp *next);
 DxfHatchBoundaryPathEdgeSplineCp *dxf_hatch_boundary_path_edge_spline_cp_get_last (DxfHatchBoundaryPathEdgeSplineCp *control_point);
+int dxf_hatch_get_bbox (DxfHatch *hatch, DxfBbox *bbox);
+int dxf_hatch_transform (DxfHatch *hatch, DxfTransform *transform);
 
 
 #ifdef __cplusplus
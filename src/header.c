@@ -51,12 +51,278 @@
 #include "util.h"
 #include "point.h"
 
+#include <stddef.h>
+
 static void dxf_header_get_int_variable(int *res, DxfFile *fp);
 static void dxf_header_get_int16_variable(int16_t *res, DxfFile *fp);
 static void dxf_header_get_double_variable(double *res, DxfFile *fp);
 static void dxf_header_get_string_variable(char **res, DxfFile *fp);
 static void dxf_header_get_dxf_point_variable(DxfPoint *res, DxfFile *fp);
 
+
+/*!
+ * \brief Value types of the header variables.
+ */
+enum dxf_header_variable_type
+{
+        DXF_HEADER_VARIABLE_INT,
+        DXF_HEADER_VARIABLE_INT16,
+        DXF_HEADER_VARIABLE_DOUBLE,
+        DXF_HEADER_VARIABLE_STRING,
+        DXF_HEADER_VARIABLE_POINT
+};
+
+
+/*!
+ * \brief Descriptor of a header variable.
+ */
+typedef struct
+dxf_header_variable_struct
+{
+        const char *name;
+                /*!< Variable name, including the leading "$". */
+        int type;
+                /*!< Value type of the member. */
+        size_t offset;
+                /*!< Offset of the member in a \c DxfHeader. */
+} DxfHeaderVariable;
+
+
+/*!
+ * \brief Header variables read by dxf_header_read () and
+ * dxf_header_read_parser ().
+ *
+ * \warning Keep this table sorted by name (in \c strcmp () order), it
+ * is searched with \c bsearch ().
+ */
+static const DxfHeaderVariable dxf_header_variables[] =
+{
+        {"$ACADMAINTVER", DXF_HEADER_VARIABLE_INT, offsetof (DxfHeader, AcadMaintVer)},
+        {"$ACADVER", DXF_HEADER_VARIABLE_STRING, offsetof (DxfHeader, AcadVer)},
+        {"$ANGBASE", DXF_HEADER_VARIABLE_DOUBLE, offsetof (DxfHeader, AngBase)},
+        {"$ANGDIR", DXF_HEADER_VARIABLE_INT, offsetof (DxfHeader, AngDir)},
+        {"$ATTMODE", DXF_HEADER_VARIABLE_INT, offsetof (DxfHeader, AttMode)},
+        {"$AUNITS", DXF_HEADER_VARIABLE_INT, offsetof (DxfHeader, AUnits)},
+        {"$AUPREC", DXF_HEADER_VARIABLE_INT, offsetof (DxfHeader, AUPrec)},
+        {"$CECOLOR", DXF_HEADER_VARIABLE_INT, offsetof (DxfHeader, CEColor)},
+        {"$CELTSCALE", DXF_HEADER_VARIABLE_DOUBLE, offsetof (DxfHeader, CELTScale)},
+        {"$CELTYPE", DXF_HEADER_VARIABLE_STRING, offsetof (DxfHeader, CELType)},
+        {"$CELWEIGHT", DXF_HEADER_VARIABLE_INT, offsetof (DxfHeader, CELWeight)},
+        {"$CEPSNID", DXF_HEADER_VARIABLE_STRING, offsetof (DxfHeader, CEPSNID)},
+        {"$CEPSNTYPE", DXF_HEADER_VARIABLE_INT, offsetof (DxfHeader, CEPSNType)},
+        {"$CHAMFERA", DXF_HEADER_VARIABLE_DOUBLE, offsetof (DxfHeader, ChamferA)},
+        {"$CHAMFERB", DXF_HEADER_VARIABLE_DOUBLE, offsetof (DxfHeader, ChamferB)},
+        {"$CHAMFERC", DXF_HEADER_VARIABLE_DOUBLE, offsetof (DxfHeader, ChamferC)},
+        {"$CHAMFERD", DXF_HEADER_VARIABLE_DOUBLE, offsetof (DxfHeader, ChamferD)},
+        {"$CLAYER", DXF_HEADER_VARIABLE_STRING, offsetof (DxfHeader, CLayer)},
+        {"$CMLJUST", DXF_HEADER_VARIABLE_INT, offsetof (DxfHeader, CMLJust)},
+        {"$CMLSCALE", DXF_HEADER_VARIABLE_DOUBLE, offsetof (DxfHeader, CMLScale)},
+        {"$CMLSTYLE", DXF_HEADER_VARIABLE_STRING, offsetof (DxfHeader, CMLStyle)},
+        {"$CSHADOW", DXF_HEADER_VARIABLE_INT16, offsetof (DxfHeader, CShadow)},
+        {"$DELOBJ", DXF_HEADER_VARIABLE_INT, offsetof (DxfHeader, DelObj)},
+        {"$DIMADEC", DXF_HEADER_VARIABLE_INT, offsetof (DxfHeader, DimADEC)},
+        {"$DIMALT", DXF_HEADER_VARIABLE_INT, offsetof (DxfHeader, DimALT)},
+        {"$DIMALTD", DXF_HEADER_VARIABLE_INT, offsetof (DxfHeader, DimALTD)},
+        {"$DIMALTF", DXF_HEADER_VARIABLE_DOUBLE, offsetof (DxfHeader, DimALTF)},
+        {"$DIMALTRND", DXF_HEADER_VARIABLE_DOUBLE, offsetof (DxfHeader, DimALTRND)},
+        {"$DIMALTTD", DXF_HEADER_VARIABLE_INT, offsetof (DxfHeader, DimALTTD)},
+        {"$DIMALTTZ", DXF_HEADER_VARIABLE_INT, offsetof (DxfHeader, DimALTTZ)},
+        {"$DIMALTU", DXF_HEADER_VARIABLE_INT, offsetof (DxfHeader, DimALTU)},
+        {"$DIMALTZ", DXF_HEADER_VARIABLE_INT, offsetof (DxfHeader, DimALTZ)},
+        {"$DIMAPOST", DXF_HEADER_VARIABLE_STRING, offsetof (DxfHeader, DimAPOST)},
+        {"$DIMASO", DXF_HEADER_VARIABLE_INT, offsetof (DxfHeader, DimASO)},
+        {"$DIMASSOC", DXF_HEADER_VARIABLE_INT, offsetof (DxfHeader, DimASSOC)},
+        {"$DIMASZ", DXF_HEADER_VARIABLE_DOUBLE, offsetof (DxfHeader, DimASZ)},
+        {"$DIMATFIT", DXF_HEADER_VARIABLE_INT, offsetof (DxfHeader, DimATFIT)},
+        {"$DIMAUNIT", DXF_HEADER_VARIABLE_INT, offsetof (DxfHeader, DimAUNIT)},
+        {"$DIMAZIN", DXF_HEADER_VARIABLE_INT, offsetof (DxfHeader, DimAZIN)},
+        {"$DIMBLK", DXF_HEADER_VARIABLE_STRING, offsetof (DxfHeader, DimBLK)},
+        {"$DIMBLK1", DXF_HEADER_VARIABLE_STRING, offsetof (DxfHeader, DimBLK1)},
+        {"$DIMBLK2", DXF_HEADER_VARIABLE_STRING, offsetof (DxfHeader, DimBLK2)},
+        {"$DIMCEN", DXF_HEADER_VARIABLE_DOUBLE, offsetof (DxfHeader, DimCEN)},
+        {"$DIMCLRD", DXF_HEADER_VARIABLE_INT, offsetof (DxfHeader, DimCLRD)},
+        {"$DIMCLRE", DXF_HEADER_VARIABLE_INT, offsetof (DxfHeader, DimCLRE)},
+        {"$DIMCLRT", DXF_HEADER_VARIABLE_INT, offsetof (DxfHeader, DimCLRT)},
+        {"$DIMDEC", DXF_HEADER_VARIABLE_INT, offsetof (DxfHeader, DimDEC)},
+        {"$DIMDLE", DXF_HEADER_VARIABLE_DOUBLE, offsetof (DxfHeader, DimDLE)},
+        {"$DIMDLI", DXF_HEADER_VARIABLE_DOUBLE, offsetof (DxfHeader, DimDLI)},
+        {"$DIMDSEP", DXF_HEADER_VARIABLE_INT, offsetof (DxfHeader, DimDSEP)},
+        {"$DIMEXE", DXF_HEADER_VARIABLE_DOUBLE, offsetof (DxfHeader, DimEXE)},
+        {"$DIMEXO", DXF_HEADER_VARIABLE_DOUBLE, offsetof (DxfHeader, DimEXO)},
+        {"$DIMFAC", DXF_HEADER_VARIABLE_DOUBLE, offsetof (DxfHeader, DimFAC)},
+        {"$DIMGAP", DXF_HEADER_VARIABLE_DOUBLE, offsetof (DxfHeader, DimGAP)},
+        {"$DIMJUST", DXF_HEADER_VARIABLE_INT, offsetof (DxfHeader, DimJUST)},
+        {"$DIMLDRBLK", DXF_HEADER_VARIABLE_STRING, offsetof (DxfHeader, DimLDRBLK)},
+        {"$DIMLFAC", DXF_HEADER_VARIABLE_DOUBLE, offsetof (DxfHeader, DimLFAC)},
+        {"$DIMLIM", DXF_HEADER_VARIABLE_INT, offsetof (DxfHeader, DimLIM)},
+        {"$DIMLUNIT", DXF_HEADER_VARIABLE_INT, offsetof (DxfHeader, DimLUNIT)},
+        {"$DIMLWD", DXF_HEADER_VARIABLE_INT, offsetof (DxfHeader, DimLWD)},
+        {"$DIMLWE", DXF_HEADER_VARIABLE_INT, offsetof (DxfHeader, DimLWE)},
+        {"$DIMPOST", DXF_HEADER_VARIABLE_STRING, offsetof (DxfHeader, DimPOST)},
+        {"$DIMRND", DXF_HEADER_VARIABLE_DOUBLE, offsetof (DxfHeader, DimRND)},
+        {"$DIMSAH", DXF_HEADER_VARIABLE_INT, offsetof (DxfHeader, DimSAH)},
+        {"$DIMSCALE", DXF_HEADER_VARIABLE_DOUBLE, offsetof (DxfHeader, DimSCALE)},
+        {"$DIMSD1", DXF_HEADER_VARIABLE_INT, offsetof (DxfHeader, DimSD1)},
+        {"$DIMSD2", DXF_HEADER_VARIABLE_INT, offsetof (DxfHeader, DimSD2)},
+        {"$DIMSE1", DXF_HEADER_VARIABLE_INT, offsetof (DxfHeader, DimSE1)},
+        {"$DIMSE2", DXF_HEADER_VARIABLE_INT, offsetof (DxfHeader, DimSE2)},
+        {"$DIMSHO", DXF_HEADER_VARIABLE_INT, offsetof (DxfHeader, DimSHO)},
+        {"$DIMSOXD", DXF_HEADER_VARIABLE_INT, offsetof (DxfHeader, DimSOXD)},
+        {"$DIMSTYLE", DXF_HEADER_VARIABLE_STRING, offsetof (DxfHeader, DimSTYLE)},
+        {"$DIMTAD", DXF_HEADER_VARIABLE_INT, offsetof (DxfHeader, DimTAD)},
+        {"$DIMTDEC", DXF_HEADER_VARIABLE_INT, offsetof (DxfHeader, DimTDEC)},
+        {"$DIMTFAC", DXF_HEADER_VARIABLE_DOUBLE, offsetof (DxfHeader, DimTFAC)},
+        {"$DIMTIH", DXF_HEADER_VARIABLE_INT, offsetof (DxfHeader, DimTIH)},
+        {"$DIMTIX", DXF_HEADER_VARIABLE_INT, offsetof (DxfHeader, DimTIX)},
+        {"$DIMTM", DXF_HEADER_VARIABLE_DOUBLE, offsetof (DxfHeader, DimTM)},
+        {"$DIMTMOVE", DXF_HEADER_VARIABLE_INT, offsetof (DxfHeader, DimTMOVE)},
+        {"$DIMTOFL", DXF_HEADER_VARIABLE_INT, offsetof (DxfHeader, DimTOFL)},
+        {"$DIMTOH", DXF_HEADER_VARIABLE_INT, offsetof (DxfHeader, DimTOH)},
+        {"$DIMTOL", DXF_HEADER_VARIABLE_INT, offsetof (DxfHeader, DimTOL)},
+        {"$DIMTOLJ", DXF_HEADER_VARIABLE_INT, offsetof (DxfHeader, DimTOLJ)},
+        {"$DIMTP", DXF_HEADER_VARIABLE_DOUBLE, offsetof (DxfHeader, DimTP)},
+        {"$DIMTSZ", DXF_HEADER_VARIABLE_DOUBLE, offsetof (DxfHeader, DimTSZ)},
+        {"$DIMTVP", DXF_HEADER_VARIABLE_DOUBLE, offsetof (DxfHeader, DimTVP)},
+        {"$DIMTXSTY", DXF_HEADER_VARIABLE_STRING, offsetof (DxfHeader, DimTXSTY)},
+        {"$DIMTXT", DXF_HEADER_VARIABLE_DOUBLE, offsetof (DxfHeader, DimTXT)},
+        {"$DIMTZIN", DXF_HEADER_VARIABLE_INT, offsetof (DxfHeader, DimTZIN)},
+        {"$DIMUPT", DXF_HEADER_VARIABLE_INT, offsetof (DxfHeader, DimUPT)},
+        {"$DIMZIN", DXF_HEADER_VARIABLE_INT, offsetof (DxfHeader, DimZIN)},
+        {"$DISPSILH", DXF_HEADER_VARIABLE_INT, offsetof (DxfHeader, DispSilH)},
+        {"$DRAGMODE", DXF_HEADER_VARIABLE_INT, offsetof (DxfHeader, DragMode)},
+        {"$DRAGVS", DXF_HEADER_VARIABLE_STRING, offsetof (DxfHeader, DragVS)},
+        {"$DWGCODEPAGE", DXF_HEADER_VARIABLE_STRING, offsetof (DxfHeader, DWGCodePage)},
+        {"$ELEVATION", DXF_HEADER_VARIABLE_DOUBLE, offsetof (DxfHeader, Elevation)},
+        {"$ENDCAPS", DXF_HEADER_VARIABLE_INT, offsetof (DxfHeader, EndCaps)},
+        {"$EXTMAX", DXF_HEADER_VARIABLE_POINT, offsetof (DxfHeader, ExtMax)},
+        {"$EXTMIN", DXF_HEADER_VARIABLE_POINT, offsetof (DxfHeader, ExtMin)},
+        {"$EXTNAMES", DXF_HEADER_VARIABLE_INT, offsetof (DxfHeader, ExtNames)},
+        {"$FILLETRAD", DXF_HEADER_VARIABLE_DOUBLE, offsetof (DxfHeader, FilletRad)},
+        {"$FILLMODE", DXF_HEADER_VARIABLE_INT, offsetof (DxfHeader, FillMode)},
+        {"$FINGERPRINTGUID", DXF_HEADER_VARIABLE_STRING, offsetof (DxfHeader, FingerPrintGUID)},
+        {"$GRIDMODE", DXF_HEADER_VARIABLE_INT, offsetof (DxfHeader, GridMode)},
+        {"$GRIDUNIT", DXF_HEADER_VARIABLE_POINT, offsetof (DxfHeader, GridUnit)},
+        {"$HALOGAP", DXF_HEADER_VARIABLE_INT, offsetof (DxfHeader, HaloGap)},
+        {"$HANDSEED", DXF_HEADER_VARIABLE_STRING, offsetof (DxfHeader, HandSeed)},
+        {"$HIDETEXT", DXF_HEADER_VARIABLE_INT, offsetof (DxfHeader, HideText)},
+        {"$HYPERLINKBASE", DXF_HEADER_VARIABLE_STRING, offsetof (DxfHeader, HyperLinkBase)},
+        {"$INDEXCTL", DXF_HEADER_VARIABLE_INT, offsetof (DxfHeader, IndexCtl)},
+        {"$INSBASE", DXF_HEADER_VARIABLE_POINT, offsetof (DxfHeader, InsBase)},
+        {"$INSUNITS", DXF_HEADER_VARIABLE_INT, offsetof (DxfHeader, InsUnits)},
+        {"$INTERFERECOLOR", DXF_HEADER_VARIABLE_INT16, offsetof (DxfHeader, InterfereColor)},
+        {"$INTERFEREOBJVS", DXF_HEADER_VARIABLE_STRING, offsetof (DxfHeader, InterfereObjVS)},
+        {"$INTERFEREVPVS", DXF_HEADER_VARIABLE_STRING, offsetof (DxfHeader, InterfereVPVS)},
+        {"$INTERSECTIONCOLOR", DXF_HEADER_VARIABLE_INT, offsetof (DxfHeader, InterSectionColor)},
+        {"$INTERSECTIONDISPLAY", DXF_HEADER_VARIABLE_INT, offsetof (DxfHeader, InterSectionDisplay)},
+        {"$JOINSTYLE", DXF_HEADER_VARIABLE_INT, offsetof (DxfHeader, JoinStyle)},
+        {"$LIMCHECK", DXF_HEADER_VARIABLE_INT, offsetof (DxfHeader, LimCheck)},
+        {"$LIMMAX", DXF_HEADER_VARIABLE_POINT, offsetof (DxfHeader, LimMax)},
+        {"$LIMMIN", DXF_HEADER_VARIABLE_POINT, offsetof (DxfHeader, LimMin)},
+        {"$LTSCALE", DXF_HEADER_VARIABLE_DOUBLE, offsetof (DxfHeader, LTScale)},
+        {"$LUNITS", DXF_HEADER_VARIABLE_INT, offsetof (DxfHeader, LUnits)},
+        {"$LUPREC", DXF_HEADER_VARIABLE_INT, offsetof (DxfHeader, LUPrec)},
+        {"$LWDISPLAY", DXF_HEADER_VARIABLE_INT, offsetof (DxfHeader, LWDisplay)},
+        {"$MAXACTVP", DXF_HEADER_VARIABLE_INT, offsetof (DxfHeader, MaxActVP)},
+        {"$MEASUREMENT", DXF_HEADER_VARIABLE_INT, offsetof (DxfHeader, Measurement)},
+        {"$MENU", DXF_HEADER_VARIABLE_STRING, offsetof (DxfHeader, Menu)},
+        {"$MIRRTEXT", DXF_HEADER_VARIABLE_INT, offsetof (DxfHeader, MirrText)},
+        {"$OBSCOLOR", DXF_HEADER_VARIABLE_INT, offsetof (DxfHeader, ObsColor)},
+        {"$OBSLTYPE", DXF_HEADER_VARIABLE_INT, offsetof (DxfHeader, ObsLType)},
+        {"$ORTHOMODE", DXF_HEADER_VARIABLE_INT, offsetof (DxfHeader, OrthoMode)},
+        {"$OSMODE", DXF_HEADER_VARIABLE_INT, offsetof (DxfHeader, OSMode)},
+        {"$PDMODE", DXF_HEADER_VARIABLE_INT, offsetof (DxfHeader, PDMode)},
+        {"$PDSIZE", DXF_HEADER_VARIABLE_DOUBLE, offsetof (DxfHeader, PDSize)},
+        {"$PELEVATION", DXF_HEADER_VARIABLE_DOUBLE, offsetof (DxfHeader, PElevation)},
+        {"$PEXTMAX", DXF_HEADER_VARIABLE_POINT, offsetof (DxfHeader, PExtMax)},
+        {"$PEXTMIN", DXF_HEADER_VARIABLE_POINT, offsetof (DxfHeader, PExtMin)},
+        {"$PINSBASE", DXF_HEADER_VARIABLE_POINT, offsetof (DxfHeader, PInsBase)},
+        {"$PLIMCHECK", DXF_HEADER_VARIABLE_INT, offsetof (DxfHeader, PLimCheck)},
+        {"$PLIMMAX", DXF_HEADER_VARIABLE_POINT, offsetof (DxfHeader, PLimMax)},
+        {"$PLIMMIN", DXF_HEADER_VARIABLE_POINT, offsetof (DxfHeader, PLimMin)},
+        {"$PLINEGEN", DXF_HEADER_VARIABLE_INT, offsetof (DxfHeader, PLineGen)},
+        {"$PLINEWID", DXF_HEADER_VARIABLE_DOUBLE, offsetof (DxfHeader, PLineWid)},
+        {"$PROJECTNAME", DXF_HEADER_VARIABLE_STRING, offsetof (DxfHeader, ProjectName)},
+        {"$PROXYGRAPHICS", DXF_HEADER_VARIABLE_INT, offsetof (DxfHeader, ProxyGraphics)},
+        {"$PSLTSCALE", DXF_HEADER_VARIABLE_INT, offsetof (DxfHeader, PSLTScale)},
+        {"$PSTYLEMODE", DXF_HEADER_VARIABLE_INT, offsetof (DxfHeader, PStyleMode)},
+        {"$PSVPSCALE", DXF_HEADER_VARIABLE_DOUBLE, offsetof (DxfHeader, PSVPScale)},
+        {"$PUCSBASE", DXF_HEADER_VARIABLE_STRING, offsetof (DxfHeader, PUCSBase)},
+        {"$PUCSNAME", DXF_HEADER_VARIABLE_STRING, offsetof (DxfHeader, PUCSName)},
+        {"$PUCSORG", DXF_HEADER_VARIABLE_POINT, offsetof (DxfHeader, PUCSOrg)},
+        {"$PUCSORGBACK", DXF_HEADER_VARIABLE_POINT, offsetof (DxfHeader, PUCSOrgBack)},
+        {"$PUCSORGBOTTOM", DXF_HEADER_VARIABLE_POINT, offsetof (DxfHeader, PUCSOrgBottom)},
+        {"$PUCSORGFRONT", DXF_HEADER_VARIABLE_POINT, offsetof (DxfHeader, PUCSOrgFront)},
+        {"$PUCSORGLEFT", DXF_HEADER_VARIABLE_POINT, offsetof (DxfHeader, PUCSOrgLeft)},
+        {"$PUCSORGRIGHT", DXF_HEADER_VARIABLE_POINT, offsetof (DxfHeader, PUCSOrgRight)},
+        {"$PUCSORGTOP", DXF_HEADER_VARIABLE_POINT, offsetof (DxfHeader, PUCSOrgTop)},
+        {"$PUCSORTHOREF", DXF_HEADER_VARIABLE_STRING, offsetof (DxfHeader, PUCSOrthoRef)},
+        {"$PUCSORTHOVIEW", DXF_HEADER_VARIABLE_INT, offsetof (DxfHeader, PUCSOrthoView)},
+        {"$PUCSXDIR", DXF_HEADER_VARIABLE_POINT, offsetof (DxfHeader, PUCSXDir)},
+        {"$PUCSYDIR", DXF_HEADER_VARIABLE_POINT, offsetof (DxfHeader, PUCSYDir)},
+        {"$QTEXTMODE", DXF_HEADER_VARIABLE_INT, offsetof (DxfHeader, QTextMode)},
+        {"$REGENMODE", DXF_HEADER_VARIABLE_INT, offsetof (DxfHeader, RegenMode)},
+        {"$SHADEDIF", DXF_HEADER_VARIABLE_INT, offsetof (DxfHeader, ShadeDif)},
+        {"$SHADEEDGE", DXF_HEADER_VARIABLE_INT, offsetof (DxfHeader, ShadEdge)},
+        {"$SHADOWPLANELOCATION", DXF_HEADER_VARIABLE_DOUBLE, offsetof (DxfHeader, ShadowPlaneLocation)},
+        {"$SKETCHINC", DXF_HEADER_VARIABLE_DOUBLE, offsetof (DxfHeader, Sketchinc)},
+        {"$SKPOLY", DXF_HEADER_VARIABLE_INT, offsetof (DxfHeader, SKPoly)},
+        {"$SORTENTS", DXF_HEADER_VARIABLE_INT, offsetof (DxfHeader, SortEnts)},
+        {"$SPLINESEGS", DXF_HEADER_VARIABLE_INT, offsetof (DxfHeader, SPLineSegs)},
+        {"$SPLINETYPE", DXF_HEADER_VARIABLE_INT, offsetof (DxfHeader, SPLineType)},
+        {"$SURFTAB1", DXF_HEADER_VARIABLE_INT, offsetof (DxfHeader, SurfTab1)},
+        {"$SURFTAB2", DXF_HEADER_VARIABLE_INT, offsetof (DxfHeader, SurfTab2)},
+        {"$SURFTYPE", DXF_HEADER_VARIABLE_INT, offsetof (DxfHeader, SurfType)},
+        {"$SURFU", DXF_HEADER_VARIABLE_INT, offsetof (DxfHeader, SurfU)},
+        {"$SURFV", DXF_HEADER_VARIABLE_INT, offsetof (DxfHeader, SurfV)},
+        {"$TDCREATE", DXF_HEADER_VARIABLE_DOUBLE, offsetof (DxfHeader, TDCreate)},
+        {"$TDINDWG", DXF_HEADER_VARIABLE_DOUBLE, offsetof (DxfHeader, TDInDWG)},
+        {"$TDUCREATE", DXF_HEADER_VARIABLE_DOUBLE, offsetof (DxfHeader, TDUCreate)},
+        {"$TDUPDATE", DXF_HEADER_VARIABLE_DOUBLE, offsetof (DxfHeader, TDUpdate)},
+        {"$TDUSRTIMER", DXF_HEADER_VARIABLE_DOUBLE, offsetof (DxfHeader, TDUSRTimer)},
+        {"$TDUUPDATE", DXF_HEADER_VARIABLE_DOUBLE, offsetof (DxfHeader, TDUUpdate)},
+        {"$TEXTSIZE", DXF_HEADER_VARIABLE_DOUBLE, offsetof (DxfHeader, TextSize)},
+        {"$TEXTSTYLE", DXF_HEADER_VARIABLE_STRING, offsetof (DxfHeader, TextStyle)},
+        {"$THICKNESS", DXF_HEADER_VARIABLE_DOUBLE, offsetof (DxfHeader, Thickness)},
+        {"$TILEMODE", DXF_HEADER_VARIABLE_INT, offsetof (DxfHeader, TileMode)},
+        {"$TRACEWID", DXF_HEADER_VARIABLE_DOUBLE, offsetof (DxfHeader, TraceWid)},
+        {"$TREEDEPTH", DXF_HEADER_VARIABLE_INT, offsetof (DxfHeader, TreeDepth)},
+        {"$UCSBASE", DXF_HEADER_VARIABLE_STRING, offsetof (DxfHeader, UCSBase)},
+        {"$UCSNAME", DXF_HEADER_VARIABLE_STRING, offsetof (DxfHeader, UCSName)},
+        {"$UCSORG", DXF_HEADER_VARIABLE_POINT, offsetof (DxfHeader, UCSOrg)},
+        {"$UCSORGBACK", DXF_HEADER_VARIABLE_POINT, offsetof (DxfHeader, UCSOrgBack)},
+        {"$UCSORGBOTTOM", DXF_HEADER_VARIABLE_POINT, offsetof (DxfHeader, UCSOrgBottom)},
+        {"$UCSORGFRONT", DXF_HEADER_VARIABLE_POINT, offsetof (DxfHeader, UCSOrgFront)},
+        {"$UCSORGLEFT", DXF_HEADER_VARIABLE_POINT, offsetof (DxfHeader, UCSOrgLeft)},
+        {"$UCSORGRIGHT", DXF_HEADER_VARIABLE_POINT, offsetof (DxfHeader, UCSOrgRight)},
+        {"$UCSORGTOP", DXF_HEADER_VARIABLE_POINT, offsetof (DxfHeader, UCSOrgTop)},
+        {"$UCSORTHOREF", DXF_HEADER_VARIABLE_STRING, offsetof (DxfHeader, UCSOrthoRef)},
+        {"$UCSORTHOVIEW", DXF_HEADER_VARIABLE_INT, offsetof (DxfHeader, UCSOrthoView)},
+        {"$UCSXDIR", DXF_HEADER_VARIABLE_POINT, offsetof (DxfHeader, UCSXDir)},
+        {"$UCSYDIR", DXF_HEADER_VARIABLE_POINT, offsetof (DxfHeader, UCSYDir)},
+        {"$UNITMODE", DXF_HEADER_VARIABLE_INT, offsetof (DxfHeader, UnitMode)},
+        {"$USERI1", DXF_HEADER_VARIABLE_INT, offsetof (DxfHeader, UserI1)},
+        {"$USERI2", DXF_HEADER_VARIABLE_INT, offsetof (DxfHeader, UserI2)},
+        {"$USERI3", DXF_HEADER_VARIABLE_INT, offsetof (DxfHeader, UserI3)},
+        {"$USERI4", DXF_HEADER_VARIABLE_INT, offsetof (DxfHeader, UserI4)},
+        {"$USERI5", DXF_HEADER_VARIABLE_INT, offsetof (DxfHeader, UserI5)},
+        {"$USERR1", DXF_HEADER_VARIABLE_DOUBLE, offsetof (DxfHeader, UserR1)},
+        {"$USERR2", DXF_HEADER_VARIABLE_DOUBLE, offsetof (DxfHeader, UserR2)},
+        {"$USERR3", DXF_HEADER_VARIABLE_DOUBLE, offsetof (DxfHeader, UserR3)},
+        {"$USERR4", DXF_HEADER_VARIABLE_DOUBLE, offsetof (DxfHeader, UserR4)},
+        {"$USERR5", DXF_HEADER_VARIABLE_DOUBLE, offsetof (DxfHeader, UserR5)},
+        {"$USRTIMER", DXF_HEADER_VARIABLE_INT, offsetof (DxfHeader, USRTimer)},
+        {"$VERSIONGUID", DXF_HEADER_VARIABLE_STRING, offsetof (DxfHeader, VersionGUID)},
+        {"$VISRETAIN", DXF_HEADER_VARIABLE_INT, offsetof (DxfHeader, VisRetain)},
+        {"$WORLDVIEW", DXF_HEADER_VARIABLE_INT, offsetof (DxfHeader, WorldView)},
+        {"$XCLIPFRAME", DXF_HEADER_VARIABLE_INT, offsetof (DxfHeader, XClipFrame)},
+        {"$XEDIT", DXF_HEADER_VARIABLE_INT, offsetof (DxfHeader, XEdit)}
+};
+
+
+static int dxf_header_variable_compare (const void *name, const void *variable);
+static const DxfHeaderVariable *dxf_header_variable_find (const char *name);
+static void dxf_header_read_variable (DxfFile *fp, DxfHeader *header, const DxfHeaderVariable *variable);
+
 /*!
  * \brief Allocate memory for a \c DxfHeader.
  *
@@ -74,7 +340,7 @@ dxf_header_new ()
         size = sizeof (DxfHeader);
         /* avoid malloc of 0 bytes */
         if (size == 0) size = 1;
-        if ((header = malloc (size)) == NULL)
+        if ((header = dxf_malloc (size)) == NULL)
         {
                 fprintf (stderr,
                   (_("Error in %s () could not allocate memory for a DxfHeader struct.\n")),
@@ -233,12 +499,12 @@ dxf_header_init
                         header->AttDia = 0;
                         header->AttReq = 1;
                         header->Handling = 1;
-                        header->HandSeed = strdup ("233");
+                        header->HandSeed = dxf_strdup ("233");
 
                 }
                 case AC1012: /* AutoCAD 13 */
                 {
-                        header->DWGCodePage = strdup ("ANSI_1252");
+                        header->DWGCodePage = dxf_strdup ("ANSI_1252");
                         header->DragMode = 2;
                         header->OSMode = 125;
                         header->CELTScale = 1.0;
@@ -258,7 +524,7 @@ dxf_header_init
                         header->DimTDEC = 4;
                         header->DimALTU = 2;
                         header->DimALTTD = 2;
-                        header->DimTXSTY = strdup ("STANDARD");
+                        header->DimTXSTY = dxf_strdup ("STANDARD");
                         header->DimAUNIT = 0;
                         header->BlipMode = 0;
                         header->ChamferC = 10.0;
@@ -267,10 +533,10 @@ dxf_header_init
                         header->AttDia = 0;
                         header->AttReq = 1;
                         header->Handling = 1;
-                        header->HandSeed = strdup ("233");
+                        header->HandSeed = dxf_strdup ("233");
                         header->TreeDepth = 3020;
                         header->PickStyle = 1;
-                        header->CMLStyle = strdup ("STANDARD");
+                        header->CMLStyle = dxf_strdup ("STANDARD");
                         header->CMLJust = 0;
                         header->CMLScale = 1.0;
                         header->SaveImages = 1;
@@ -278,7 +544,7 @@ dxf_header_init
                 case AC1014: /* AutoCAD 14 */
                 {
                         header->AcadMaintVer = 0;
-                        header->DWGCodePage = strdup ("ANSI_1252");
+                        header->DWGCodePage = dxf_strdup ("ANSI_1252");
                         header->DragMode = 2;
                         header->OSMode = 125;
                         header->CELTScale = 1.0;
@@ -298,7 +564,7 @@ dxf_header_init
                         header->DimTDEC = 4;
                         header->DimALTU = 2;
                         header->DimALTTD = 2;
-                        header->DimTXSTY = strdup ("STANDARD");
+                        header->DimTXSTY = dxf_strdup ("STANDARD");
                         header->DimAUNIT = 0;
                         header->BlipMode = 0;
                         header->ChamferC = 10.0;
@@ -307,10 +573,10 @@ dxf_header_init
                         header->AttDia = 0;
                         header->AttReq = 1;
                         header->Handling = 1;
-                        header->HandSeed = strdup ("262");
+                        header->HandSeed = dxf_strdup ("262");
                         header->TreeDepth = 3020;
                         header->PickStyle = 1;
-                        header->CMLStyle = strdup ("STANDARD");
+                        header->CMLStyle = dxf_strdup ("STANDARD");
                         header->CMLJust = 0;
                         header->CMLScale = 1.0;
                         header->ProxyGraphics = 1;
@@ -319,7 +585,7 @@ dxf_header_init
                 case AC1015: /* AutoCAD 2000 */
                 {
                         header->AcadMaintVer = 20;
-                        header->DWGCodePage = strdup ("ANSI_1252");
+                        header->DWGCodePage = dxf_strdup ("ANSI_1252");
                         header->CELTScale = 1.0;
                         header->DispSilH = 0;
                         header->DimJUST = 0;
@@ -334,7 +600,7 @@ dxf_header_init
                         header->DimTDEC = 4;
                         header->DimALTU = 2;
                         header->DimALTTD = 2;
-                        header->DimTXSTY = strdup ("STANDARD");
+                        header->DimTXSTY = dxf_strdup ("STANDARD");
                         header->DimAUNIT = 0;
                         header->DimADEC = 0;
                         header->DimALTRND = 0.0;
@@ -342,7 +608,7 @@ dxf_header_init
                         header->DimDSEP = 46;
                         header->DimATFIT = 3;
                         header->DimFRAC = 0;
-                        header->DimLDRBLK = strdup ("");
+                        header->DimLDRBLK = dxf_strdup ("");
                         header->DimLUNIT = 2;
                         header->DimLWD = -2;
                         header->DimLWE = -2;
@@ -351,9 +617,9 @@ dxf_header_init
                         header->ChamferD = 10.0;
                         header->TDUCreate = 0.0;
                         header->TDUUpdate = 0.0;
-                        header->HandSeed = strdup ("274");
-                        header->UCSBase = strdup ("");
-                        header->UCSOrthoRef = strdup ("");
+                        header->HandSeed = dxf_strdup ("274");
+                        header->UCSBase = dxf_strdup ("");
+                        header->UCSOrthoRef = dxf_strdup ("");
                         header->UCSOrthoView = 0;
                         header->UCSOrgTop.x0 = 0.0;
                         header->UCSOrgTop.y0 = 0.0;
@@ -373,8 +639,8 @@ dxf_header_init
                         header->UCSOrgBack.x0 = 0.0;
                         header->UCSOrgBack.y0 = 0.0;
                         header->UCSOrgBack.z0 = 0.0;
-                        header->PUCSBase = strdup ("");
-                        header->PUCSOrthoRef = strdup ("");
+                        header->PUCSBase = dxf_strdup ("");
+                        header->PUCSOrthoRef = dxf_strdup ("");
                         header->PUCSOrthoView = 0;
                         header->PUCSOrgTop.x0 = 0.0;
                         header->PUCSOrgTop.y0 = 0.0;
@@ -395,7 +661,7 @@ dxf_header_init
                         header->PUCSOrgBack.y0 = 0.0;
                         header->PUCSOrgBack.z0 = 0.0;
                         header->TreeDepth = 3020;
-                        header->CMLStyle = strdup ("STANDARD");
+                        header->CMLStyle = dxf_strdup ("STANDARD");
                         header->CMLJust = 0;
                         header->CMLScale = 1.0;
                         header->ProxyGraphics = 1;
@@ -405,13 +671,13 @@ dxf_header_init
                         header->JoinStyle = 0;
                         header->LWDisplay = 0;
                         header->InsUnits = 0;
-                        header->HyperLinkBase = strdup ("");
-                        header->StyleSheet = strdup ("");
+                        header->HyperLinkBase = dxf_strdup ("");
+                        header->StyleSheet = dxf_strdup ("");
                         header->XEdit = 1;
                         header->CEPSNType = 0;
                         header->PStyleMode = 1;
-                        header->FingerPrintGUID = strdup ("");
-                        header->VersionGUID = strdup ("");
+                        header->FingerPrintGUID = dxf_strdup ("");
+                        header->VersionGUID = dxf_strdup ("");
                         header->ExtNames = 0;
                         header->PSVPScale = 0.0;
                         header->OLEStartUp = 0;
@@ -419,7 +685,7 @@ dxf_header_init
                 case AC1018: /* AutoCAD 2004 */
                 {
                         header->AcadMaintVer = 0;
-                        header->DWGCodePage = strdup ("ANSI_1252");
+                        header->DWGCodePage = dxf_strdup ("ANSI_1252");
                         header->CELTScale = 1.0;
                         header->DispSilH = 0;
                         header->DimJUST = 0;
@@ -434,7 +700,7 @@ dxf_header_init
                         header->DimTDEC = 4;
                         header->DimALTU = 2;
                         header->DimALTTD = 2;
-                        header->DimTXSTY = strdup ("STANDARD");
+                        header->DimTXSTY = dxf_strdup ("STANDARD");
                         header->DimAUNIT = 0;
                         header->DimADEC = 0;
                         header->DimALTRND = 0.0;
@@ -442,7 +708,7 @@ dxf_header_init
                         header->DimDSEP = 46;
                         header->DimATFIT = 3;
                         header->DimFRAC = 0;
-                        header->DimLDRBLK = strdup ("");
+                        header->DimLDRBLK = dxf_strdup ("");
                         header->DimLUNIT = 2;
                         header->DimLWD = -2;
                         header->DimLWE = -2;
@@ -451,9 +717,9 @@ dxf_header_init
                         header->ChamferD = 10.0;
                         header->TDUCreate = 0.0;
                         header->TDUUpdate = 0.0;
-                        header->HandSeed = strdup ("26A");
-                        header->UCSBase = strdup ("");
-                        header->UCSOrthoRef = strdup ("");
+                        header->HandSeed = dxf_strdup ("26A");
+                        header->UCSBase = dxf_strdup ("");
+                        header->UCSOrthoRef = dxf_strdup ("");
                         header->UCSOrthoView = 0;
                         header->UCSOrgTop.x0 = 0.0;
                         header->UCSOrgTop.y0 = 0.0;
@@ -473,8 +739,8 @@ dxf_header_init
                         header->UCSOrgBack.x0 = 0.0;
                         header->UCSOrgBack.y0 = 0.0;
                         header->UCSOrgBack.z0 = 0.0;
-                        header->PUCSBase = strdup ("");
-                        header->PUCSOrthoRef = strdup ("");
+                        header->PUCSBase = dxf_strdup ("");
+                        header->PUCSOrthoRef = dxf_strdup ("");
                         header->PUCSOrthoView = 0;
                         header->PUCSOrgTop.x0 = 0.0;
                         header->PUCSOrgTop.y0 = 0.0;
@@ -495,7 +761,7 @@ dxf_header_init
                         header->PUCSOrgBack.y0 = 0.0;
                         header->PUCSOrgBack.z0 = 0.0;
                         header->TreeDepth = 3020;
-                        header->CMLStyle = strdup ("STANDARD");
+                        header->CMLStyle = dxf_strdup ("STANDARD");
                         header->CMLJust = 0;
                         header->CMLScale = 1.0;
                         header->ProxyGraphics = 1;
@@ -505,13 +771,13 @@ dxf_header_init
                         header->JoinStyle = 0;
                         header->LWDisplay = 0;
                         header->InsUnits = 0;
-                        header->HyperLinkBase = strdup ("");
-                        header->StyleSheet = strdup ("");
+                        header->HyperLinkBase = dxf_strdup ("");
+                        header->StyleSheet = dxf_strdup ("");
                         header->XEdit = 1;
                         header->CEPSNType = 0;
                         header->PStyleMode = 1;
-                        header->FingerPrintGUID = strdup ("");
-                        header->VersionGUID = strdup ("");
+                        header->FingerPrintGUID = dxf_strdup ("");
+                        header->VersionGUID = dxf_strdup ("");
                         header->ExtNames = 0;
                         header->PSVPScale = 0.0;
                         header->OLEStartUp = 0;
@@ -525,10 +791,10 @@ dxf_header_init
                         header->InterSectionDisplay = 0;
                         header->InterSectionColor = 257;
                         header->DimASSOC = 1;
-                        header->ProjectName = strdup ("");
+                        header->ProjectName = dxf_strdup ("");
                 }
         }
-        header->AcadVer = strdup (dxf_header_acad_version_to_string (acad_version_number));
+        header->AcadVer = dxf_strdup (dxf_header_acad_version_to_string (acad_version_number));
         header->InsBase.x0 = 0.0;
         header->InsBase.y0 = 0.0;
         header->InsBase.z0 = 0.0;
@@ -551,9 +817,9 @@ dxf_header_init
         header->AttMode = 1;
         header->TextSize = 2.5;
         header->TraceWid = 1.0;
-        header->TextStyle = strdup ("STANDARD");
-        header->CELType = strdup ("BYLAYER");
-        header->CLayer = strdup ("0");
+        header->TextStyle = dxf_strdup ("STANDARD");
+        header->CELType = dxf_strdup ("BYLAYER");
+        header->CLayer = dxf_strdup ("0");
         header->CEColor = 256;
         header->DimSCALE = 1.0;
         header->DimASZ = 2.5;
@@ -575,11 +841,11 @@ dxf_header_init
         header->DimSE2 = 0;
         header->DimTAD = 1;
         header->DimZIN = 8;
-        header->DimBLK = strdup ("");
+        header->DimBLK = dxf_strdup ("");
         header->DimASO = 1;
         header->DimSHO = 1;
-        header->DimPOST = strdup ("");
-        header->DimAPOST = strdup ("");
+        header->DimPOST = dxf_strdup ("");
+        header->DimAPOST = dxf_strdup ("");
         header->DimALT = 0;
         header->DimALTD = 4;
         header->DimALTF = 0.0394;
@@ -589,8 +855,8 @@ dxf_header_init
         header->DimTIX = 0;
         header->DimSOXD = 0;
         header->DimSAH = 0;
-        header->DimBLK1 = strdup ("");
-        header->DimBLK2 = strdup ("");
+        header->DimBLK1 = dxf_strdup ("");
+        header->DimBLK2 = dxf_strdup ("");
         header->DimCLRD = 0;
         header->DimCLRE = 0;
         header->DimCLRT = 0;
@@ -602,7 +868,7 @@ dxf_header_init
         header->FilletRad = 1.0;
         header->AUnits = 0;
         header->AUPrec = 0;
-        header->Menu = strdup (".");
+        header->Menu = dxf_strdup (".");
         header->Elevation = 0.0;
         header->PElevation = 0.0;
         header->Thickness = 0.0;
@@ -628,7 +894,7 @@ dxf_header_init
         header->SurfType = 6;
         header->SurfU = 6;
         header->SurfV = 6;
-        header->UCSName = strdup ("");
+        header->UCSName = dxf_strdup ("");
         header->UCSOrg.x0 = 0.0;
         header->UCSOrg.y0 = 0.0;
         header->UCSOrg.z0 = 0.0;
@@ -638,7 +904,7 @@ dxf_header_init
         header->UCSYDir.x0 = 0.0;
         header->UCSYDir.y0 = 0.0;
         header->UCSYDir.z0 = 0.0;
-        header->PUCSName = strdup ("");
+        header->PUCSName = dxf_strdup ("");
         header->PUCSOrg.x0 = 0.0;
         header->PUCSOrg.y0 = 0.0;
         header->PUCSOrg.z0 = 0.0;
@@ -734,109 +1000,218 @@ dxf_header_write_metric_new
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        fprintf (fp->fp, "  0\nSECTION\n");
-        fprintf (fp->fp, "  2\nHEADER\n");
-        fprintf (fp->fp, "  9\n$ACADVER\n  1\nAC1014\n");
-        fprintf (fp->fp, "  9\n$ACADMAINTVER\n 70\n     0\n");
-        fprintf (fp->fp, "  9\n$DWGCODEPAGE\n  3\nANSI_1252\n");
-        fprintf (fp->fp, "  9\n$INSBASE\n 10\n0.0\n 20\n0.0\n 30\n0.0\n");
-        fprintf (fp->fp, "  9\n$EXTMIN\n 10\n-0.012816\n 20\n-0.009063\n 30\n-0.001526\n");
-        fprintf (fp->fp, "  9\n$EXTMAX\n 10\n88.01056\n 20\n35.022217\n 30\n0.0\n");
-        fprintf (fp->fp, "  9\n$LIMMIN\n 10\n0.0\n 20\n0.0\n");
-        fprintf (fp->fp, "  9\n$LIMMAX\n 10\n420.0\n 20\n297.0\n");
-        fprintf (fp->fp, "  9\n$ORTHOMODE\n 70\n     0\n");
-        fprintf (fp->fp, "  9\n$REGENMODE\n 70\n     1\n");
-        fprintf (fp->fp, "  9\n$FILLMODE\n 70\n     1\n");
-        fprintf (fp->fp, "  9\n$QTEXTMODE\n 70\n     0\n");
-        fprintf (fp->fp, "  9\n$MIRRTEXT\n 70\n     1\n");
-        fprintf (fp->fp, "  9\n$DRAGMODE\n 70\n     2\n");
-        fprintf (fp->fp, "  9\n$LTSCALE\n 40\n1.0\n");
-        fprintf (fp->fp, "  9\n$OSMODE\n 70\n   125\n");
-        fprintf (fp->fp, "  9\n$ATTMODE\n 70\n     1\n");
-        fprintf (fp->fp, "  9\n$TEXTSIZE\n 40\n2.5\n");
-        fprintf (fp->fp, "  9\n$TRACEWID\n 40\n1.0\n");
-        fprintf (fp->fp, "  9\n$TEXTSTYLE\n  7\nSTANDARD\n");
-        fprintf (fp->fp, "  9\n$CLAYER\n  8\n0\n");
-        fprintf (fp->fp, "  9\n$CELTYPE\n  6\nBYLAYER\n");
-        fprintf (fp->fp, "  9\n$CECOLOR\n 62\n   256\n");
-        fprintf (fp->fp, "  9\n$CELTSCALE\n 40\n1.0\n");
-        fprintf (fp->fp, "  9\n$DELOBJ\n 70\n     1\n");
-        fprintf (fp->fp, "  9\n$DISPSILH\n 70\n     0\n");
-        fprintf (fp->fp, "  9\n$DIMSCALE\n 40\n1.0\n");
-        fprintf (fp->fp, "  9\n$DIMASZ\n 40\n2.5\n");
-        fprintf (fp->fp, "  9\n$DIMEXO\n 40\n0.625\n");
-        fprintf (fp->fp, "  9\n$DIMDLI\n 40\n3.75\n");
-        fprintf (fp->fp, "  9\n$DIMRND\n 40\n0.0\n");
-        fprintf (fp->fp, "  9\n$DIMDLE\n 40\n0.0\n");
-        fprintf (fp->fp, "  9\n$DIMEXE\n 40\n1.25\n");
-        fprintf (fp->fp, "  9\n$DIMTP\n 40\n0.0\n");
-        fprintf (fp->fp, "  9\n$DIMTM\n 40\n0.0\n");
-        fprintf (fp->fp, "  9\n$DIMTXT\n 40\n2.5\n");
-        fprintf (fp->fp, "  9\n$DIMCEN\n 40\n2.5\n");
-        fprintf (fp->fp, "  9\n$DIMTSZ\n 40\n0.0\n");
-        fprintf (fp->fp, "  9\n$DIMTOL\n 70\n     0\n");
-        fprintf (fp->fp, "  9\n$DIMLIM\n 70\n     0\n");
-        fprintf (fp->fp, "  9\n$DIMTIH\n 70\n     0\n");
-        fprintf (fp->fp, "  9\n$DIMTOH\n 70\n     0\n");
-        fprintf (fp->fp, "  9\n$DIMSE1\n 70\n     0\n");
-        fprintf (fp->fp, "  9\n$DIMSE2\n 70\n     0\n");
-        fprintf (fp->fp, "  9\n$DIMTAD\n 70\n     1\n");
-        fprintf (fp->fp, "  9\n$DIMZIN\n 70\n     8\n");
-        fprintf (fp->fp, "  9\n$DIMBLK\n  1\n\n");
-        fprintf (fp->fp, "  9\n$DIMASO\n 70\n     1\n");
-        fprintf (fp->fp, "  9\n$DIMSHO\n 70\n     1\n");
-        fprintf (fp->fp, "  9\n$DIMPOST\n  1\n\n");
-        fprintf (fp->fp, "  9\n$DIMAPOST\n  1\n\n");
-        fprintf (fp->fp, "  9\n$DIMALT\n 70\n     0\n");
-        fprintf (fp->fp, "  9\n$DIMALTD\n 70\n     4\n");
-        fprintf (fp->fp, "  9\n$DIMALTF\n 40\n0.0394\n");
-        fprintf (fp->fp, "  9\n$DIMLFAC\n 40\n1.0\n");
-        fprintf (fp->fp, "  9\n$DIMTOFL\n 70\n     1\n");
-        fprintf (fp->fp, "  9\n$DIMTVP\n 40\n0.0\n");
-        fprintf (fp->fp, "  9\n$DIMTIX\n 70\n     0\n");
-        fprintf (fp->fp, "  9\n$DIMSOXD\n 70\n     0\n");
-        fprintf (fp->fp, "  9\n$DIMSAH\n 70\n     0\n");
-        fprintf (fp->fp, "  9\n$DIMBLK1\n  1\n\n");
-        fprintf (fp->fp, "  9\n$DIMBLK2\n  1\n\n");
-        fprintf (fp->fp, "  9\n$DIMSTYLE\n  2\nSTANDARD\n");
-        fprintf (fp->fp, "  9\n$DIMCLRD\n 70\n     0\n");
-        fprintf (fp->fp, "  9\n$DIMCLRE\n 70\n     0\n");
-        fprintf (fp->fp, "  9\n$DIMCLRT\n 70\n     0\n");
-        fprintf (fp->fp, "  9\n$DIMTFAC\n 40\n1.0\n");
-        fprintf (fp->fp, "  9\n$DIMGAP\n 40\n0.625\n");
-        fprintf (fp->fp, "  9\n$DIMJUST\n 70\n     0\n");
-        fprintf (fp->fp, "  9\n$DIMSD1\n 70\n     0\n");
-        fprintf (fp->fp, "  9\n$DIMSD2\n 70\n     0\n");
-        fprintf (fp->fp, "  9\n$DIMTOLJ\n 70\n     1\n");
-        fprintf (fp->fp, "  9\n$DIMTZIN\n 70\n     0\n");
-        fprintf (fp->fp, "  9\n$DIMALTZ\n 70\n     0\n");
-        fprintf (fp->fp, "  9\n$DIMALTTZ\n 70\n     0\n");
-        fprintf (fp->fp, "  9\n$DIMFIT\n 70\n     3\n");
-        fprintf (fp->fp, "  9\n$DIMUPT\n 70\n     0\n");
-        fprintf (fp->fp, "  9\n$DIMUNIT\n 70\n     2\n");
-        fprintf (fp->fp, "  9\n$DIMDEC\n 70\n     4\n");
-        fprintf (fp->fp, "  9\n$DIMTDEC\n 70\n     4\n");
-        fprintf (fp->fp, "  9\n$DIMALTU\n 70\n     2\n");
-        fprintf (fp->fp, "  9\n$DIMALTTD\n 70\n     2\n");
-        fprintf (fp->fp, "  9\n$DIMTXSTY\n  7\nSTANDARD\n");
-        fprintf (fp->fp, "  9\n$DIMAUNIT\n 70\n     0\n");
-        fprintf (fp->fp, "  9\n$LUNITS\n 70\n     2\n");
-        fprintf (fp->fp, "  9\n$LUPREC\n 70\n     4\n");
-        fprintf (fp->fp, "  9\n$SKETCHINC\n 40\n1.0\n");
-        fprintf (fp->fp, "  9\n$FILLETRAD\n 40\n1.0\n");
-        fprintf (fp->fp, "  9\n$AUNITS\n 70\n     0\n");
-        fprintf (fp->fp, "  9\n$AUPREC\n 70\n     0\n");
-        fprintf (fp->fp, "  9\n$MENU\n  1\n.\n");
-        fprintf (fp->fp, "  9\n$ELEVATION\n 40\n0.0\n");
-        fprintf (fp->fp, "  9\n$PELEVATION\n 40\n0.0\n");
-        fprintf (fp->fp, "  9\n$THICKNESS\n 40\n0.0\n");
-        fprintf (fp->fp, "  9\n$LIMCHECK\n 70\n     0\n");
-        fprintf (fp->fp, "  9\n$BLIPMODE\n 70\n     0\n");
-        fprintf (fp->fp, "  9\n$CHAMFERA\n 40\n10.0\n");
-        fprintf (fp->fp, "  9\n$CHAMFERB\n 40\n10.0\n");
-        fprintf (fp->fp, "  9\n$CHAMFERC\n 40\n0.0\n");
-        fprintf (fp->fp, "  9\n$CHAMFERD\n 40\n0.0\n");
-        fprintf (fp->fp, "  9\n$SKPOLY\n 70\n     0\n");
+        dxf_write_string (fp, 0, "SECTION");
+        dxf_write_string (fp, 2, "HEADER");
+        dxf_write_string (fp, 9, "$ACADVER");
+        dxf_write_string (fp, 1, "AC1014");
+        dxf_write_string (fp, 9, "$ACADMAINTVER");
+        dxf_write_string (fp, 70, "     0");
+        dxf_write_string (fp, 9, "$DWGCODEPAGE");
+        dxf_write_string (fp, 3, "ANSI_1252");
+        dxf_write_string (fp, 9, "$INSBASE");
+        dxf_write_string (fp, 10, "0.0");
+        dxf_write_string (fp, 20, "0.0");
+        dxf_write_string (fp, 30, "0.0");
+        dxf_write_string (fp, 9, "$EXTMIN");
+        dxf_write_string (fp, 10, "-0.012816");
+        dxf_write_string (fp, 20, "-0.009063");
+        dxf_write_string (fp, 30, "-0.001526");
+        dxf_write_string (fp, 9, "$EXTMAX");
+        dxf_write_string (fp, 10, "88.01056");
+        dxf_write_string (fp, 20, "35.022217");
+        dxf_write_string (fp, 30, "0.0");
+        dxf_write_string (fp, 9, "$LIMMIN");
+        dxf_write_string (fp, 10, "0.0");
+        dxf_write_string (fp, 20, "0.0");
+        dxf_write_string (fp, 9, "$LIMMAX");
+        dxf_write_string (fp, 10, "420.0");
+        dxf_write_string (fp, 20, "297.0");
+        dxf_write_string (fp, 9, "$ORTHOMODE");
+        dxf_write_string (fp, 70, "     0");
+        dxf_write_string (fp, 9, "$REGENMODE");
+        dxf_write_string (fp, 70, "     1");
+        dxf_write_string (fp, 9, "$FILLMODE");
+        dxf_write_string (fp, 70, "     1");
+        dxf_write_string (fp, 9, "$QTEXTMODE");
+        dxf_write_string (fp, 70, "     0");
+        dxf_write_string (fp, 9, "$MIRRTEXT");
+        dxf_write_string (fp, 70, "     1");
+        dxf_write_string (fp, 9, "$DRAGMODE");
+        dxf_write_string (fp, 70, "     2");
+        dxf_write_string (fp, 9, "$LTSCALE");
+        dxf_write_string (fp, 40, "1.0");
+        dxf_write_string (fp, 9, "$OSMODE");
+        dxf_write_string (fp, 70, "   125");
+        dxf_write_string (fp, 9, "$ATTMODE");
+        dxf_write_string (fp, 70, "     1");
+        dxf_write_string (fp, 9, "$TEXTSIZE");
+        dxf_write_string (fp, 40, "2.5");
+        dxf_write_string (fp, 9, "$TRACEWID");
+        dxf_write_string (fp, 40, "1.0");
+        dxf_write_string (fp, 9, "$TEXTSTYLE");
+        dxf_write_string (fp, 7, "STANDARD");
+        dxf_write_string (fp, 9, "$CLAYER");
+        dxf_write_string (fp, 8, "0");
+        dxf_write_string (fp, 9, "$CELTYPE");
+        dxf_write_string (fp, 6, "BYLAYER");
+        dxf_write_string (fp, 9, "$CECOLOR");
+        dxf_write_string (fp, 62, "   256");
+        dxf_write_string (fp, 9, "$CELTSCALE");
+        dxf_write_string (fp, 40, "1.0");
+        dxf_write_string (fp, 9, "$DELOBJ");
+        dxf_write_string (fp, 70, "     1");
+        dxf_write_string (fp, 9, "$DISPSILH");
+        dxf_write_string (fp, 70, "     0");
+        dxf_write_string (fp, 9, "$DIMSCALE");
+        dxf_write_string (fp, 40, "1.0");
+        dxf_write_string (fp, 9, "$DIMASZ");
+        dxf_write_string (fp, 40, "2.5");
+        dxf_write_string (fp, 9, "$DIMEXO");
+        dxf_write_string (fp, 40, "0.625");
+        dxf_write_string (fp, 9, "$DIMDLI");
+        dxf_write_string (fp, 40, "3.75");
+        dxf_write_string (fp, 9, "$DIMRND");
+        dxf_write_string (fp, 40, "0.0");
+        dxf_write_string (fp, 9, "$DIMDLE");
+        dxf_write_string (fp, 40, "0.0");
+        dxf_write_string (fp, 9, "$DIMEXE");
+        dxf_write_string (fp, 40, "1.25");
+        dxf_write_string (fp, 9, "$DIMTP");
+        dxf_write_string (fp, 40, "0.0");
+        dxf_write_string (fp, 9, "$DIMTM");
+        dxf_write_string (fp, 40, "0.0");
+        dxf_write_string (fp, 9, "$DIMTXT");
+        dxf_write_string (fp, 40, "2.5");
+        dxf_write_string (fp, 9, "$DIMCEN");
+        dxf_write_string (fp, 40, "2.5");
+        dxf_write_string (fp, 9, "$DIMTSZ");
+        dxf_write_string (fp, 40, "0.0");
+        dxf_write_string (fp, 9, "$DIMTOL");
+        dxf_write_string (fp, 70, "     0");
+        dxf_write_string (fp, 9, "$DIMLIM");
+        dxf_write_string (fp, 70, "     0");
+        dxf_write_string (fp, 9, "$DIMTIH");
+        dxf_write_string (fp, 70, "     0");
+        dxf_write_string (fp, 9, "$DIMTOH");
+        dxf_write_string (fp, 70, "     0");
+        dxf_write_string (fp, 9, "$DIMSE1");
+        dxf_write_string (fp, 70, "     0");
+        dxf_write_string (fp, 9, "$DIMSE2");
+        dxf_write_string (fp, 70, "     0");
+        dxf_write_string (fp, 9, "$DIMTAD");
+        dxf_write_string (fp, 70, "     1");
+        dxf_write_string (fp, 9, "$DIMZIN");
+        dxf_write_string (fp, 70, "     8");
+        dxf_write_string (fp, 9, "$DIMBLK");
+        dxf_write_string (fp, 1, "");
+        dxf_write_string (fp, 9, "$DIMASO");
+        dxf_write_string (fp, 70, "     1");
+        dxf_write_string (fp, 9, "$DIMSHO");
+        dxf_write_string (fp, 70, "     1");
+        dxf_write_string (fp, 9, "$DIMPOST");
+        dxf_write_string (fp, 1, "");
+        dxf_write_string (fp, 9, "$DIMAPOST");
+        dxf_write_string (fp, 1, "");
+        dxf_write_string (fp, 9, "$DIMALT");
+        dxf_write_string (fp, 70, "     0");
+        dxf_write_string (fp, 9, "$DIMALTD");
+        dxf_write_string (fp, 70, "     4");
+        dxf_write_string (fp, 9, "$DIMALTF");
+        dxf_write_string (fp, 40, "0.0394");
+        dxf_write_string (fp, 9, "$DIMLFAC");
+        dxf_write_string (fp, 40, "1.0");
+        dxf_write_string (fp, 9, "$DIMTOFL");
+        dxf_write_string (fp, 70, "     1");
+        dxf_write_string (fp, 9, "$DIMTVP");
+        dxf_write_string (fp, 40, "0.0");
+        dxf_write_string (fp, 9, "$DIMTIX");
+        dxf_write_string (fp, 70, "     0");
+        dxf_write_string (fp, 9, "$DIMSOXD");
+        dxf_write_string (fp, 70, "     0");
+        dxf_write_string (fp, 9, "$DIMSAH");
+        dxf_write_string (fp, 70, "     0");
+        dxf_write_string (fp, 9, "$DIMBLK1");
+        dxf_write_string (fp, 1, "");
+        dxf_write_string (fp, 9, "$DIMBLK2");
+        dxf_write_string (fp, 1, "");
+        dxf_write_string (fp, 9, "$DIMSTYLE");
+        dxf_write_string (fp, 2, "STANDARD");
+        dxf_write_string (fp, 9, "$DIMCLRD");
+        dxf_write_string (fp, 70, "     0");
+        dxf_write_string (fp, 9, "$DIMCLRE");
+        dxf_write_string (fp, 70, "     0");
+        dxf_write_string (fp, 9, "$DIMCLRT");
+        dxf_write_string (fp, 70, "     0");
+        dxf_write_string (fp, 9, "$DIMTFAC");
+        dxf_write_string (fp, 40, "1.0");
+        dxf_write_string (fp, 9, "$DIMGAP");
+        dxf_write_string (fp, 40, "0.625");
+        dxf_write_string (fp, 9, "$DIMJUST");
+        dxf_write_string (fp, 70, "     0");
+        dxf_write_string (fp, 9, "$DIMSD1");
+        dxf_write_string (fp, 70, "     0");
+        dxf_write_string (fp, 9, "$DIMSD2");
+        dxf_write_string (fp, 70, "     0");
+        dxf_write_string (fp, 9, "$DIMTOLJ");
+        dxf_write_string (fp, 70, "     1");
+        dxf_write_string (fp, 9, "$DIMTZIN");
+        dxf_write_string (fp, 70, "     0");
+        dxf_write_string (fp, 9, "$DIMALTZ");
+        dxf_write_string (fp, 70, "     0");
+        dxf_write_string (fp, 9, "$DIMALTTZ");
+        dxf_write_string (fp, 70, "     0");
+        dxf_write_string (fp, 9, "$DIMFIT");
+        dxf_write_string (fp, 70, "     3");
+        dxf_write_string (fp, 9, "$DIMUPT");
+        dxf_write_string (fp, 70, "     0");
+        dxf_write_string (fp, 9, "$DIMUNIT");
+        dxf_write_string (fp, 70, "     2");
+        dxf_write_string (fp, 9, "$DIMDEC");
+        dxf_write_string (fp, 70, "     4");
+        dxf_write_string (fp, 9, "$DIMTDEC");
+        dxf_write_string (fp, 70, "     4");
+        dxf_write_string (fp, 9, "$DIMALTU");
+        dxf_write_string (fp, 70, "     2");
+        dxf_write_string (fp, 9, "$DIMALTTD");
+        dxf_write_string (fp, 70, "     2");
+        dxf_write_string (fp, 9, "$DIMTXSTY");
+        dxf_write_string (fp, 7, "STANDARD");
+        dxf_write_string (fp, 9, "$DIMAUNIT");
+        dxf_write_string (fp, 70, "     0");
+        dxf_write_string (fp, 9, "$LUNITS");
+        dxf_write_string (fp, 70, "     2");
+        dxf_write_string (fp, 9, "$LUPREC");
+        dxf_write_string (fp, 70, "     4");
+        dxf_write_string (fp, 9, "$SKETCHINC");
+        dxf_write_string (fp, 40, "1.0");
+        dxf_write_string (fp, 9, "$FILLETRAD");
+        dxf_write_string (fp, 40, "1.0");
+        dxf_write_string (fp, 9, "$AUNITS");
+        dxf_write_string (fp, 70, "     0");
+        dxf_write_string (fp, 9, "$AUPREC");
+        dxf_write_string (fp, 70, "     0");
+        dxf_write_string (fp, 9, "$MENU");
+        dxf_write_string (fp, 1, ".");
+        dxf_write_string (fp, 9, "$ELEVATION");
+        dxf_write_string (fp, 40, "0.0");
+        dxf_write_string (fp, 9, "$PELEVATION");
+        dxf_write_string (fp, 40, "0.0");
+        dxf_write_string (fp, 9, "$THICKNESS");
+        dxf_write_string (fp, 40, "0.0");
+        dxf_write_string (fp, 9, "$LIMCHECK");
+        dxf_write_string (fp, 70, "     0");
+        dxf_write_string (fp, 9, "$BLIPMODE");
+        dxf_write_string (fp, 70, "     0");
+        dxf_write_string (fp, 9, "$CHAMFERA");
+        dxf_write_string (fp, 40, "10.0");
+        dxf_write_string (fp, 9, "$CHAMFERB");
+        dxf_write_string (fp, 40, "10.0");
+        dxf_write_string (fp, 9, "$CHAMFERC");
+        dxf_write_string (fp, 40, "0.0");
+        dxf_write_string (fp, 9, "$CHAMFERD");
+        dxf_write_string (fp, 40, "0.0");
+        dxf_write_string (fp, 9, "$SKPOLY");
+        dxf_write_string (fp, 70, "     0");
         time_t now;
         if (time(&now) != (time_t)(-1))
         {
@@ -848,72 +1223,155 @@ dxf_header_write_metric_new
             fraction_day=(current_time->tm_hour+(current_time->tm_min/60.0)+(current_time->tm_sec/3600.0))/24.0;
             /* Transforms the current local clock time in fraction of day.*/
 
-            fprintf (fp->fp, "  9\n$TDCREATE\n 40\n%7.9f\n", JD+fraction_day);
-            fprintf (fp->fp, "  9\n$TDUPDATE\n 40\n%7.9f\n", JD+fraction_day);
+            dxf_write_string (fp, 9, "$TDCREATE");
+            dxf_write_double (fp, 40, JD+fraction_day);
+            dxf_write_string (fp, 9, "$TDUPDATE");
+            dxf_write_double (fp, 40, JD+fraction_day);
         }
-        fprintf (fp->fp, "  9\n$TDINDWG\n 40\n0.0000000000\n");
-        fprintf (fp->fp, "  9\n$TDUSRTIMER\n 40\n0.0000000000\n");
+        dxf_write_string (fp, 9, "$TDINDWG");
+        dxf_write_string (fp, 40, "0.0000000000");
+        dxf_write_string (fp, 9, "$TDUSRTIMER");
+        dxf_write_string (fp, 40, "0.0000000000");
         /* In a new DXF file, $TDINDWG and $TDUSERTIMER are always 0, can change the decimal precision in according to the DXF version.*/
-        fprintf (fp->fp, "  9\n$USRTIMER\n 70\n     1\n");
-        fprintf (fp->fp, "  9\n$ANGBASE\n 50\n0.0\n");
-        fprintf (fp->fp, "  9\n$ANGDIR\n 70\n     0\n");
-        fprintf (fp->fp, "  9\n$PDMODE\n 70\n    98\n");
-        fprintf (fp->fp, "  9\n$PDSIZE\n 40\n0.0\n");
-        fprintf (fp->fp, "  9\n$PLINEWID\n 40\n0.0\n");
-        fprintf (fp->fp, "  9\n$COORDS\n 70\n     2\n");
-        fprintf (fp->fp, "  9\n$SPLFRAME\n 70\n     0\n");
-        fprintf (fp->fp, "  9\n$SPLINETYPE\n 70\n     6\n");
-        fprintf (fp->fp, "  9\n$SPLINESEGS\n 70\n     8\n");
-        fprintf (fp->fp, "  9\n$ATTDIA\n 70\n     0\n");
-        fprintf (fp->fp, "  9\n$ATTREQ\n 70\n     1\n");
-        fprintf (fp->fp, "  9\n$HANDLING\n 70\n     1\n");
-        fprintf (fp->fp, "  9\n$HANDSEED\n  5\n262\n");
-        fprintf (fp->fp, "  9\n$SURFTAB1\n 70\n     6\n");
-        fprintf (fp->fp, "  9\n$SURFTAB2\n 70\n     6\n");
-        fprintf (fp->fp, "  9\n$SURFTYPE\n 70\n     6\n");
-        fprintf (fp->fp, "  9\n$SURFU\n 70\n     6\n");
-        fprintf (fp->fp, "  9\n$SURFV\n 70\n     6\n");
-        fprintf (fp->fp, "  9\n$UCSNAME\n  2\n\n");
-        fprintf (fp->fp, "  9\n$UCSORG\n 10\n0.0\n 20\n0.0\n 30\n0.0\n");
-        fprintf (fp->fp, "  9\n$UCSXDIR\n 10\n1.0\n 20\n0.0\n 30\n0.0\n");
-        fprintf (fp->fp, "  9\n$UCSYDIR\n 10\n0.0\n 20\n1.0\n 30\n0.0\n");
-        fprintf (fp->fp, "  9\n$PUCSNAME\n  2\n\n");
-        fprintf (fp->fp, "  9\n$PUCSORG\n 10\n0.0\n 20\n0.0\n 30\n0.0\n");
-        fprintf (fp->fp, "  9\n$PUCSXDIR\n 10\n1.0\n 20\n0.0\n 30\n0.0\n");
-        fprintf (fp->fp, "  9\n$PUCSYDIR\n 10\n0.0\n 20\n1.0\n 30\n0.0\n");
-        fprintf (fp->fp, "  9\n$USERI1\n 70\n     0\n");
-        fprintf (fp->fp, "  9\n$USERI2\n 70\n     0\n");
-        fprintf (fp->fp, "  9\n$USERI3\n 70\n     0\n");
-        fprintf (fp->fp, "  9\n$USERI4\n 70\n     0\n");
-        fprintf (fp->fp, "  9\n$USERI5\n 70\n     0\n");
-        fprintf (fp->fp, "  9\n$USERR1\n 40\n0.0\n");
-        fprintf (fp->fp, "  9\n$USERR2\n 40\n0.0\n");
-        fprintf (fp->fp, "  9\n$USERR3\n 40\n0.0\n");
-        fprintf (fp->fp, "  9\n$USERR4\n 40\n0.0\n");
-        fprintf (fp->fp, "  9\n$USERR5\n 40\n0.0\n");
-        fprintf (fp->fp, "  9\n$WORLDVIEW\n 70\n     1\n");
-        fprintf (fp->fp, "  9\n$SHADEDGE\n 70\n     3\n");
-        fprintf (fp->fp, "  9\n$SHADEDIF\n 70\n    70\n");
-        fprintf (fp->fp, "  9\n$TILEMODE\n 70\n     1\n");
-        fprintf (fp->fp, "  9\n$MAXACTVP\n 70\n    48\n");
-        fprintf (fp->fp, "  9\n$PINSBASE\n 10\n0.0\n 20\n0.0\n 30\n0.0\n");
-        fprintf (fp->fp, "  9\n$PLIMCHECK\n 70\n     0\n");
-        fprintf (fp->fp, "  9\n$PEXTMIN\n 10\n1.000000E+20\n 20\n1.000000E+20\n 30\n1.000000E+20\n");
-        fprintf (fp->fp, "  9\n$PEXTMAX\n 10\n-1.000000E+20\n 20\n-1.000000E+20\n 30\n-1.000000E+20\n");
-        fprintf (fp->fp, "  9\n$PLIMMIN\n 10\n0.0\n 20\n0.0\n");
-        fprintf (fp->fp, "  9\n$PLIMMAX\n 10\n420.0\n 20\n297.0");
-        fprintf (fp->fp, "  9\n$UNITMODE\n 70\n     0\n");
-        fprintf (fp->fp, "  9\n$VISRETAIN\n 70\n     1\n");
-        fprintf (fp->fp, "  9\n$PLINEGEN\n 70\n     0\n");
-        fprintf (fp->fp, "  9\n$PSLTSCALE\n 70\n     1\n");
-        fprintf (fp->fp, "  9\n$TREEDEPTH\n 70\n  3020\n");
-        fprintf (fp->fp, "  9\n$PICKSTYLE\n 70\n     1\n");
-        fprintf (fp->fp, "  9\n$CMLSTYLE\n  2\nSTANDARD\n");
-        fprintf (fp->fp, "  9\n$CMLJUST\n 70\n     0\n");
-        fprintf (fp->fp, "  9\n$CMLSCALE\n 40\n1.0\n");
-        fprintf (fp->fp, "  9\n$PROXYGRAPHICS\n 70\n     1\n");
-        fprintf (fp->fp, "  9\n$MEASUREMENT\n 70\n     0\n");
-        fprintf (fp->fp, "  0\nENDSEC\n");
+        dxf_write_string (fp, 9, "$USRTIMER");
+        dxf_write_string (fp, 70, "     1");
+        dxf_write_string (fp, 9, "$ANGBASE");
+        dxf_write_string (fp, 50, "0.0");
+        dxf_write_string (fp, 9, "$ANGDIR");
+        dxf_write_string (fp, 70, "     0");
+        dxf_write_string (fp, 9, "$PDMODE");
+        dxf_write_string (fp, 70, "    98");
+        dxf_write_string (fp, 9, "$PDSIZE");
+        dxf_write_string (fp, 40, "0.0");
+        dxf_write_string (fp, 9, "$PLINEWID");
+        dxf_write_string (fp, 40, "0.0");
+        dxf_write_string (fp, 9, "$COORDS");
+        dxf_write_string (fp, 70, "     2");
+        dxf_write_string (fp, 9, "$SPLFRAME");
+        dxf_write_string (fp, 70, "     0");
+        dxf_write_string (fp, 9, "$SPLINETYPE");
+        dxf_write_string (fp, 70, "     6");
+        dxf_write_string (fp, 9, "$SPLINESEGS");
+        dxf_write_string (fp, 70, "     8");
+        dxf_write_string (fp, 9, "$ATTDIA");
+        dxf_write_string (fp, 70, "     0");
+        dxf_write_string (fp, 9, "$ATTREQ");
+        dxf_write_string (fp, 70, "     1");
+        dxf_write_string (fp, 9, "$HANDLING");
+        dxf_write_string (fp, 70, "     1");
+        dxf_write_string (fp, 9, "$HANDSEED");
+        dxf_write_string (fp, 5, "262");
+        dxf_write_string (fp, 9, "$SURFTAB1");
+        dxf_write_string (fp, 70, "     6");
+        dxf_write_string (fp, 9, "$SURFTAB2");
+        dxf_write_string (fp, 70, "     6");
+        dxf_write_string (fp, 9, "$SURFTYPE");
+        dxf_write_string (fp, 70, "     6");
+        dxf_write_string (fp, 9, "$SURFU");
+        dxf_write_string (fp, 70, "     6");
+        dxf_write_string (fp, 9, "$SURFV");
+        dxf_write_string (fp, 70, "     6");
+        dxf_write_string (fp, 9, "$UCSNAME");
+        dxf_write_string (fp, 2, "");
+        dxf_write_string (fp, 9, "$UCSORG");
+        dxf_write_string (fp, 10, "0.0");
+        dxf_write_string (fp, 20, "0.0");
+        dxf_write_string (fp, 30, "0.0");
+        dxf_write_string (fp, 9, "$UCSXDIR");
+        dxf_write_string (fp, 10, "1.0");
+        dxf_write_string (fp, 20, "0.0");
+        dxf_write_string (fp, 30, "0.0");
+        dxf_write_string (fp, 9, "$UCSYDIR");
+        dxf_write_string (fp, 10, "0.0");
+        dxf_write_string (fp, 20, "1.0");
+        dxf_write_string (fp, 30, "0.0");
+        dxf_write_string (fp, 9, "$PUCSNAME");
+        dxf_write_string (fp, 2, "");
+        dxf_write_string (fp, 9, "$PUCSORG");
+        dxf_write_string (fp, 10, "0.0");
+        dxf_write_string (fp, 20, "0.0");
+        dxf_write_string (fp, 30, "0.0");
+        dxf_write_string (fp, 9, "$PUCSXDIR");
+        dxf_write_string (fp, 10, "1.0");
+        dxf_write_string (fp, 20, "0.0");
+        dxf_write_string (fp, 30, "0.0");
+        dxf_write_string (fp, 9, "$PUCSYDIR");
+        dxf_write_string (fp, 10, "0.0");
+        dxf_write_string (fp, 20, "1.0");
+        dxf_write_string (fp, 30, "0.0");
+        dxf_write_string (fp, 9, "$USERI1");
+        dxf_write_string (fp, 70, "     0");
+        dxf_write_string (fp, 9, "$USERI2");
+        dxf_write_string (fp, 70, "     0");
+        dxf_write_string (fp, 9, "$USERI3");
+        dxf_write_string (fp, 70, "     0");
+        dxf_write_string (fp, 9, "$USERI4");
+        dxf_write_string (fp, 70, "     0");
+        dxf_write_string (fp, 9, "$USERI5");
+        dxf_write_string (fp, 70, "     0");
+        dxf_write_string (fp, 9, "$USERR1");
+        dxf_write_string (fp, 40, "0.0");
+        dxf_write_string (fp, 9, "$USERR2");
+        dxf_write_string (fp, 40, "0.0");
+        dxf_write_string (fp, 9, "$USERR3");
+        dxf_write_string (fp, 40, "0.0");
+        dxf_write_string (fp, 9, "$USERR4");
+        dxf_write_string (fp, 40, "0.0");
+        dxf_write_string (fp, 9, "$USERR5");
+        dxf_write_string (fp, 40, "0.0");
+        dxf_write_string (fp, 9, "$WORLDVIEW");
+        dxf_write_string (fp, 70, "     1");
+        dxf_write_string (fp, 9, "$SHADEDGE");
+        dxf_write_string (fp, 70, "     3");
+        dxf_write_string (fp, 9, "$SHADEDIF");
+        dxf_write_string (fp, 70, "    70");
+        dxf_write_string (fp, 9, "$TILEMODE");
+        dxf_write_string (fp, 70, "     1");
+        dxf_write_string (fp, 9, "$MAXACTVP");
+        dxf_write_string (fp, 70, "    48");
+        dxf_write_string (fp, 9, "$PINSBASE");
+        dxf_write_string (fp, 10, "0.0");
+        dxf_write_string (fp, 20, "0.0");
+        dxf_write_string (fp, 30, "0.0");
+        dxf_write_string (fp, 9, "$PLIMCHECK");
+        dxf_write_string (fp, 70, "     0");
+        dxf_write_string (fp, 9, "$PEXTMIN");
+        dxf_write_string (fp, 10, "1.000000E+20");
+        dxf_write_string (fp, 20, "1.000000E+20");
+        dxf_write_string (fp, 30, "1.000000E+20");
+        dxf_write_string (fp, 9, "$PEXTMAX");
+        dxf_write_string (fp, 10, "-1.000000E+20");
+        dxf_write_string (fp, 20, "-1.000000E+20");
+        dxf_write_string (fp, 30, "-1.000000E+20");
+        dxf_write_string (fp, 9, "$PLIMMIN");
+        dxf_write_string (fp, 10, "0.0");
+        dxf_write_string (fp, 20, "0.0");
+        dxf_write_string (fp, 9, "$PLIMMAX");
+        dxf_write_string (fp, 10, "420.0");
+        dxf_write_string (fp, 20, "297.0");
+        dxf_write_string (fp, 9, "$UNITMODE");
+        dxf_write_string (fp, 70, "     0");
+        dxf_write_string (fp, 9, "$VISRETAIN");
+        dxf_write_string (fp, 70, "     1");
+        dxf_write_string (fp, 9, "$PLINEGEN");
+        dxf_write_string (fp, 70, "     0");
+        dxf_write_string (fp, 9, "$PSLTSCALE");
+        dxf_write_string (fp, 70, "     1");
+        dxf_write_string (fp, 9, "$TREEDEPTH");
+        dxf_write_string (fp, 70, "  3020");
+        dxf_write_string (fp, 9, "$PICKSTYLE");
+        dxf_write_string (fp, 70, "     1");
+        dxf_write_string (fp, 9, "$CMLSTYLE");
+        dxf_write_string (fp, 2, "STANDARD");
+        dxf_write_string (fp, 9, "$CMLJUST");
+        dxf_write_string (fp, 70, "     0");
+        dxf_write_string (fp, 9, "$CMLSCALE");
+        dxf_write_string (fp, 40, "1.0");
+        dxf_write_string (fp, 9, "$PROXYGRAPHICS");
+        dxf_write_string (fp, 70, "     1");
+        dxf_write_string (fp, 9, "$MEASUREMENT");
+        dxf_write_string (fp, 70, "     0");
+        dxf_write_string (fp, 0, "ENDSEC");
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -936,7 +1394,7 @@ dxf_header_write
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        char *dxf_entity_name = strdup ("HEADER");
+        char *dxf_entity_name = dxf_strdup ("HEADER");
 
         /* Do some basic checks. */
         if (fp == NULL)
@@ -945,7 +1403,7 @@ dxf_header_write
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (header == NULL)
@@ -954,240 +1412,803 @@ dxf_header_write
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         dxf_section_write (fp, dxf_entity_name);
-        fprintf (fp->fp, "  9\n$ACADVER\n  1\n%s\n", header->AcadVer);
-        if (fp->acad_version_number >= AC1014) fprintf (fp->fp, "  9\n$ACADMAINTVER\n 70\n%i\n", header->AcadMaintVer);
-        if (fp->acad_version_number >= AC1012) fprintf (fp->fp, "  9\n$DWGCODEPAGE\n  3\n%s\n", header->DWGCodePage);
-        if (fp->acad_version_number >= AC1018) fprintf (fp->fp, "  9\n$LASTSAVEDBY\n  1\n%s\n", getenv("USER"));
-        fprintf (fp->fp, "  9\n$INSBASE\n 10\n%f\n 20\n%f\n 30\n%f\n", header->InsBase.x0, header->InsBase.y0, header->InsBase.z0);
-        fprintf (fp->fp, "  9\n$EXTMIN\n 10\n%f\n 20\n%f\n 30\n%f\n", header->ExtMin.x0, header->ExtMin.y0, header->ExtMin.z0);
-        fprintf (fp->fp, "  9\n$EXTMAX\n 10\n%f\n 20\n%f\n 30\n%f\n", header->ExtMax.x0, header->ExtMax.y0, header->ExtMax.z0);
-        fprintf (fp->fp, "  9\n$LIMMIN\n 10\n%f\n 20\n%f\n", header->LimMin.x0, header->LimMin.y0);
-        fprintf (fp->fp, "  9\n$LIMMAX\n 10\n%f\n 20\n%f\n", header->LimMax.x0, header->LimMax.y0);
-        fprintf (fp->fp, "  9\n$ORTHOMODE\n 70\n%i\n", header->OrthoMode);
-        fprintf (fp->fp, "  9\n$REGENMODE\n 70\n%i\n", header->RegenMode);
-        fprintf (fp->fp, "  9\n$FILLMODE\n 70\n%i\n", header->FillMode);
-        fprintf (fp->fp, "  9\n$QTEXTMODE\n 70\n%i\n", header->QTextMode);
-        fprintf (fp->fp, "  9\n$MIRRTEXT\n 70\n%i\n", header->MirrText);
-        if (fp->acad_version_number <= AC1015) fprintf (fp->fp, "  9\n$DRAGMODE\n 70\n%i\n", header->DragMode);
-        fprintf (fp->fp, "  9\n$LTSCALE\n 40\n%f\n", header->LTScale);
-        if (fp->acad_version_number <= AC1014) fprintf (fp->fp, "  9\n$OSMODE\n 70\n%i\n", header->OSMode);
-        fprintf (fp->fp, "  9\n$ATTMODE\n 70\n%i\n", header->AttMode);
-        fprintf (fp->fp, "  9\n$TEXTSIZE\n 40\n%f\n", header->TextSize);
-        fprintf (fp->fp, "  9\n$TRACEWID\n 40\n%f\n", header->TraceWid);
-        fprintf (fp->fp, "  9\n$TEXTSTYLE\n  7\n%s\n", header->TextStyle);
-        fprintf (fp->fp, "  9\n$CLAYER\n  8\n%s\n", header->CLayer);
-        fprintf (fp->fp, "  9\n$CELTYPE\n  6\n%s\n", header->CELType);
-        fprintf (fp->fp, "  9\n$CECOLOR\n 62\n%i\n", header->CEColor);
-        if (fp->acad_version_number >= AC1012) fprintf (fp->fp, "  9\n$CELTSCALE\n 40\n%f\n", header->CELTScale);
+        dxf_write_string (fp, 9, "$ACADVER");
+        dxf_write_string (fp, 1, header->AcadVer);
+        if (fp->acad_version_number >= AC1014)
+        {
+                dxf_write_string (fp, 9, "$ACADMAINTVER");
+                dxf_write_int (fp, 70, header->AcadMaintVer);
+        }
+        if (fp->acad_version_number >= AC1012)
+        {
+                dxf_write_string (fp, 9, "$DWGCODEPAGE");
+                dxf_write_string (fp, 3, header->DWGCodePage);
+        }
+        if (fp->acad_version_number >= AC1018)
+        {
+                dxf_write_string (fp, 9, "$LASTSAVEDBY");
+                dxf_write_string (fp, 1, getenv("USER"));
+        }
+        dxf_write_string (fp, 9, "$INSBASE");
+        dxf_write_double (fp, 10, header->InsBase.x0);
+        dxf_write_double (fp, 20, header->InsBase.y0);
+        dxf_write_double (fp, 30, header->InsBase.z0);
+        dxf_write_string (fp, 9, "$EXTMIN");
+        dxf_write_double (fp, 10, header->ExtMin.x0);
+        dxf_write_double (fp, 20, header->ExtMin.y0);
+        dxf_write_double (fp, 30, header->ExtMin.z0);
+        dxf_write_string (fp, 9, "$EXTMAX");
+        dxf_write_double (fp, 10, header->ExtMax.x0);
+        dxf_write_double (fp, 20, header->ExtMax.y0);
+        dxf_write_double (fp, 30, header->ExtMax.z0);
+        dxf_write_string (fp, 9, "$LIMMIN");
+        dxf_write_double (fp, 10, header->LimMin.x0);
+        dxf_write_double (fp, 20, header->LimMin.y0);
+        dxf_write_string (fp, 9, "$LIMMAX");
+        dxf_write_double (fp, 10, header->LimMax.x0);
+        dxf_write_double (fp, 20, header->LimMax.y0);
+        dxf_write_string (fp, 9, "$ORTHOMODE");
+        dxf_write_int (fp, 70, header->OrthoMode);
+        dxf_write_string (fp, 9, "$REGENMODE");
+        dxf_write_int (fp, 70, header->RegenMode);
+        dxf_write_string (fp, 9, "$FILLMODE");
+        dxf_write_int (fp, 70, header->FillMode);
+        dxf_write_string (fp, 9, "$QTEXTMODE");
+        dxf_write_int (fp, 70, header->QTextMode);
+        dxf_write_string (fp, 9, "$MIRRTEXT");
+        dxf_write_int (fp, 70, header->MirrText);
+        if (fp->acad_version_number <= AC1015)
+        {
+                dxf_write_string (fp, 9, "$DRAGMODE");
+                dxf_write_int (fp, 70, header->DragMode);
+        }
+        dxf_write_string (fp, 9, "$LTSCALE");
+        dxf_write_double (fp, 40, header->LTScale);
+        if (fp->acad_version_number <= AC1014)
+        {
+                dxf_write_string (fp, 9, "$OSMODE");
+                dxf_write_int (fp, 70, header->OSMode);
+        }
+        dxf_write_string (fp, 9, "$ATTMODE");
+        dxf_write_int (fp, 70, header->AttMode);
+        dxf_write_string (fp, 9, "$TEXTSIZE");
+        dxf_write_double (fp, 40, header->TextSize);
+        dxf_write_string (fp, 9, "$TRACEWID");
+        dxf_write_double (fp, 40, header->TraceWid);
+        dxf_write_string (fp, 9, "$TEXTSTYLE");
+        dxf_write_string (fp, 7, header->TextStyle);
+        dxf_write_string (fp, 9, "$CLAYER");
+        dxf_write_string (fp, 8, header->CLayer);
+        dxf_write_string (fp, 9, "$CELTYPE");
+        dxf_write_string (fp, 6, header->CELType);
+        dxf_write_string (fp, 9, "$CECOLOR");
+        dxf_write_int (fp, 62, header->CEColor);
+        if (fp->acad_version_number >= AC1012)
+        {
+                dxf_write_string (fp, 9, "$CELTSCALE");
+                dxf_write_double (fp, 40, header->CELTScale);
+        }
         if ((fp->acad_version_number == AC1012)
-          || (fp->acad_version_number == AC1014)) fprintf (fp->fp, "  9\n$DELOBJ\n 70\n%i\n", header->DelObj);
-        if (fp->acad_version_number <= AC1012) fprintf (fp->fp, "  9\n$DISPSILH\n 70\n%i\n", header->DispSilH);
-        fprintf (fp->fp, "  9\n$DIMSCALE\n 40\n%f\n", header->DimSCALE);
-        fprintf (fp->fp, "  9\n$DIMASZ\n 40\n%f\n", header->DimASZ);
-        fprintf (fp->fp, "  9\n$DIMEXO\n 40\n%f\n", header->DimEXO);
-        fprintf (fp->fp, "  9\n$DIMDLI\n 40\n%f\n", header->DimDLI);
-        fprintf (fp->fp, "  9\n$DIMRND\n 40\n%f\n", header->DimRND);
-        fprintf (fp->fp, "  9\n$DIMDLE\n 40\n%f\n", header->DimDLE);
-        fprintf (fp->fp, "  9\n$DIMEXE\n 40\n%f\n", header->DimEXE);
-        fprintf (fp->fp, "  9\n$DIMTP\n 40\n%f\n", header->DimTP);
-        fprintf (fp->fp, "  9\n$DIMTM\n 40\n%f\n", header->DimTM);
-        fprintf (fp->fp, "  9\n$DIMTXT\n 40\n%f\n", header->DimTXT);
-        fprintf (fp->fp, "  9\n$DIMCEN\n 40\n%f\n", header->DimCEN);
-        fprintf (fp->fp, "  9\n$DIMTSZ\n 40\n%f\n", header->DimTSZ);
-        fprintf (fp->fp, "  9\n$DIMTOL\n 70\n%i\n", header->DimTOL);
-        fprintf (fp->fp, "  9\n$DIMLIM\n 70\n%i\n", header->DimLIM);
-        fprintf (fp->fp, "  9\n$DIMTIH\n 70\n%i\n", header->DimTIH);
-        fprintf (fp->fp, "  9\n$DIMTOH\n 70\n%i\n", header->DimTOH);
-        fprintf (fp->fp, "  9\n$DIMSE1\n 70\n%i\n", header->DimSE1);
-        fprintf (fp->fp, "  9\n$DIMSE2\n 70\n%i\n", header->DimSE2);
-        fprintf (fp->fp, "  9\n$DIMTAD\n 70\n%i\n", header->DimTAD);
-        fprintf (fp->fp, "  9\n$DIMZIN\n 70\n%i\n", header->DimZIN);
-        fprintf (fp->fp, "  9\n$DIMBLK\n  1\n%s\n", header->DimBLK);
-        fprintf (fp->fp, "  9\n$DIMASO\n 70\n%i\n", header->DimASO);
-        fprintf (fp->fp, "  9\n$DIMSHO\n 70\n%i\n", header->DimSHO);
-        fprintf (fp->fp, "  9\n$DIMPOST\n  1\n%s\n", header->DimPOST);
-        fprintf (fp->fp, "  9\n$DIMAPOST\n  1\n%s\n", header->DimAPOST);
-        fprintf (fp->fp, "  9\n$DIMALT\n 70\n%i\n", header->DimALT);
-        fprintf (fp->fp, "  9\n$DIMALTD\n 70\n%i\n", header->DimALTD);
-        fprintf (fp->fp, "  9\n$DIMALTF\n 40\n%f\n", header->DimALTF);
-        fprintf (fp->fp, "  9\n$DIMLFAC\n 40\n%f\n", header->DimLFAC);
-        fprintf (fp->fp, "  9\n$DIMTOFL\n 70\n%i\n", header->DimTOFL);
-        fprintf (fp->fp, "  9\n$DIMTVP\n 40\n%f\n", header->DimTVP);
-        fprintf (fp->fp, "  9\n$DIMTIX\n 70\n%i\n", header->DimTIX);
-        fprintf (fp->fp, "  9\n$DIMSOXD\n 70\n%i\n", header->DimSOXD);
-        fprintf (fp->fp, "  9\n$DIMSAH\n 70\n%i\n", header->DimSAH);
-        fprintf (fp->fp, "  9\n$DIMBLK1\n  1\n%s\n", header->DimBLK1);
-        fprintf (fp->fp, "  9\n$DIMBLK2\n  1\n%s\n", header->DimBLK2);
-        fprintf (fp->fp, "  9\n$DIMSTYLE\n  2\n%s\n", header->DimSTYLE);
-        fprintf (fp->fp, "  9\n$DIMCLRD\n 70\n%i\n", header->DimCLRD);
-        fprintf (fp->fp, "  9\n$DIMCLRE\n 70\n%i\n", header->DimCLRE);
-        fprintf (fp->fp, "  9\n$DIMCLRT\n 70\n%i\n", header->DimCLRT);
-        fprintf (fp->fp, "  9\n$DIMTFAC\n 40\n%f\n", header->DimTFAC);
-        fprintf (fp->fp, "  9\n$DIMGAP\n 40\n%f\n", header->DimGAP);
-        if (fp->acad_version_number >= AC1012) fprintf (fp->fp, "  9\n$DIMJUST\n 70\n%i\n", header->DimJUST);
-        if (fp->acad_version_number >= AC1012) fprintf (fp->fp, "  9\n$DIMSD1\n 70\n%i\n", header->DimSD1);
-        if (fp->acad_version_number >= AC1012) fprintf (fp->fp, "  9\n$DIMSD2\n 70\n%i\n", header->DimSD2);
-        if (fp->acad_version_number >= AC1012) fprintf (fp->fp, "  9\n$DIMTOLJ\n 70\n%i\n", header->DimTOLJ);
-        if (fp->acad_version_number >= AC1012) fprintf (fp->fp, "  9\n$DIMTZIN\n 70\n%i\n", header->DimTZIN);
-        if (fp->acad_version_number >= AC1012) fprintf (fp->fp, "  9\n$DIMALTZ\n 70\n%i\n", header->DimALTZ);
-        if (fp->acad_version_number >= AC1012) fprintf (fp->fp, "  9\n$DIMALTTZ\n 70\n%i\n", header->DimALTTZ);
+          || (fp->acad_version_number == AC1014))
+          {
+                  dxf_write_string (fp, 9, "$DELOBJ");
+                  dxf_write_int (fp, 70, header->DelObj);
+          }
+        if (fp->acad_version_number <= AC1012)
+        {
+                dxf_write_string (fp, 9, "$DISPSILH");
+                dxf_write_int (fp, 70, header->DispSilH);
+        }
+        dxf_write_string (fp, 9, "$DIMSCALE");
+        dxf_write_double (fp, 40, header->DimSCALE);
+        dxf_write_string (fp, 9, "$DIMASZ");
+        dxf_write_double (fp, 40, header->DimASZ);
+        dxf_write_string (fp, 9, "$DIMEXO");
+        dxf_write_double (fp, 40, header->DimEXO);
+        dxf_write_string (fp, 9, "$DIMDLI");
+        dxf_write_double (fp, 40, header->DimDLI);
+        dxf_write_string (fp, 9, "$DIMRND");
+        dxf_write_double (fp, 40, header->DimRND);
+        dxf_write_string (fp, 9, "$DIMDLE");
+        dxf_write_double (fp, 40, header->DimDLE);
+        dxf_write_string (fp, 9, "$DIMEXE");
+        dxf_write_double (fp, 40, header->DimEXE);
+        dxf_write_string (fp, 9, "$DIMTP");
+        dxf_write_double (fp, 40, header->DimTP);
+        dxf_write_string (fp, 9, "$DIMTM");
+        dxf_write_double (fp, 40, header->DimTM);
+        dxf_write_string (fp, 9, "$DIMTXT");
+        dxf_write_double (fp, 40, header->DimTXT);
+        dxf_write_string (fp, 9, "$DIMCEN");
+        dxf_write_double (fp, 40, header->DimCEN);
+        dxf_write_string (fp, 9, "$DIMTSZ");
+        dxf_write_double (fp, 40, header->DimTSZ);
+        dxf_write_string (fp, 9, "$DIMTOL");
+        dxf_write_int (fp, 70, header->DimTOL);
+        dxf_write_string (fp, 9, "$DIMLIM");
+        dxf_write_int (fp, 70, header->DimLIM);
+        dxf_write_string (fp, 9, "$DIMTIH");
+        dxf_write_int (fp, 70, header->DimTIH);
+        dxf_write_string (fp, 9, "$DIMTOH");
+        dxf_write_int (fp, 70, header->DimTOH);
+        dxf_write_string (fp, 9, "$DIMSE1");
+        dxf_write_int (fp, 70, header->DimSE1);
+        dxf_write_string (fp, 9, "$DIMSE2");
+        dxf_write_int (fp, 70, header->DimSE2);
+        dxf_write_string (fp, 9, "$DIMTAD");
+        dxf_write_int (fp, 70, header->DimTAD);
+        dxf_write_string (fp, 9, "$DIMZIN");
+        dxf_write_int (fp, 70, header->DimZIN);
+        dxf_write_string (fp, 9, "$DIMBLK");
+        dxf_write_string (fp, 1, header->DimBLK);
+        dxf_write_string (fp, 9, "$DIMASO");
+        dxf_write_int (fp, 70, header->DimASO);
+        dxf_write_string (fp, 9, "$DIMSHO");
+        dxf_write_int (fp, 70, header->DimSHO);
+        dxf_write_string (fp, 9, "$DIMPOST");
+        dxf_write_string (fp, 1, header->DimPOST);
+        dxf_write_string (fp, 9, "$DIMAPOST");
+        dxf_write_string (fp, 1, header->DimAPOST);
+        dxf_write_string (fp, 9, "$DIMALT");
+        dxf_write_int (fp, 70, header->DimALT);
+        dxf_write_string (fp, 9, "$DIMALTD");
+        dxf_write_int (fp, 70, header->DimALTD);
+        dxf_write_string (fp, 9, "$DIMALTF");
+        dxf_write_double (fp, 40, header->DimALTF);
+        dxf_write_string (fp, 9, "$DIMLFAC");
+        dxf_write_double (fp, 40, header->DimLFAC);
+        dxf_write_string (fp, 9, "$DIMTOFL");
+        dxf_write_int (fp, 70, header->DimTOFL);
+        dxf_write_string (fp, 9, "$DIMTVP");
+        dxf_write_double (fp, 40, header->DimTVP);
+        dxf_write_string (fp, 9, "$DIMTIX");
+        dxf_write_int (fp, 70, header->DimTIX);
+        dxf_write_string (fp, 9, "$DIMSOXD");
+        dxf_write_int (fp, 70, header->DimSOXD);
+        dxf_write_string (fp, 9, "$DIMSAH");
+        dxf_write_int (fp, 70, header->DimSAH);
+        dxf_write_string (fp, 9, "$DIMBLK1");
+        dxf_write_string (fp, 1, header->DimBLK1);
+        dxf_write_string (fp, 9, "$DIMBLK2");
+        dxf_write_string (fp, 1, header->DimBLK2);
+        dxf_write_string (fp, 9, "$DIMSTYLE");
+        dxf_write_string (fp, 2, header->DimSTYLE);
+        dxf_write_string (fp, 9, "$DIMCLRD");
+        dxf_write_int (fp, 70, header->DimCLRD);
+        dxf_write_string (fp, 9, "$DIMCLRE");
+        dxf_write_int (fp, 70, header->DimCLRE);
+        dxf_write_string (fp, 9, "$DIMCLRT");
+        dxf_write_int (fp, 70, header->DimCLRT);
+        dxf_write_string (fp, 9, "$DIMTFAC");
+        dxf_write_double (fp, 40, header->DimTFAC);
+        dxf_write_string (fp, 9, "$DIMGAP");
+        dxf_write_double (fp, 40, header->DimGAP);
+        if (fp->acad_version_number >= AC1012)
+        {
+                dxf_write_string (fp, 9, "$DIMJUST");
+                dxf_write_int (fp, 70, header->DimJUST);
+        }
+        if (fp->acad_version_number >= AC1012)
+        {
+                dxf_write_string (fp, 9, "$DIMSD1");
+                dxf_write_int (fp, 70, header->DimSD1);
+        }
+        if (fp->acad_version_number >= AC1012)
+        {
+                dxf_write_string (fp, 9, "$DIMSD2");
+                dxf_write_int (fp, 70, header->DimSD2);
+        }
+        if (fp->acad_version_number >= AC1012)
+        {
+                dxf_write_string (fp, 9, "$DIMTOLJ");
+                dxf_write_int (fp, 70, header->DimTOLJ);
+        }
+        if (fp->acad_version_number >= AC1012)
+        {
+                dxf_write_string (fp, 9, "$DIMTZIN");
+                dxf_write_int (fp, 70, header->DimTZIN);
+        }
+        if (fp->acad_version_number >= AC1012)
+        {
+                dxf_write_string (fp, 9, "$DIMALTZ");
+                dxf_write_int (fp, 70, header->DimALTZ);
+        }
+        if (fp->acad_version_number >= AC1012)
+        {
+                dxf_write_string (fp, 9, "$DIMALTTZ");
+                dxf_write_int (fp, 70, header->DimALTTZ);
+        }
         if ((fp->acad_version_number == AC1012)
-          || (fp->acad_version_number == AC1014)) fprintf (fp->fp, "  9\n$DIMFIT\n 70\n%i\n", header->DimFIT);
-        if (fp->acad_version_number >= AC1012) fprintf (fp->fp, "  9\n$DIMUPT\n 70\n%i\n", header->DimUPT);
+          || (fp->acad_version_number == AC1014))
+          {
+                  dxf_write_string (fp, 9, "$DIMFIT");
+                  dxf_write_int (fp, 70, header->DimFIT);
+          }
+        if (fp->acad_version_number >= AC1012)
+        {
+                dxf_write_string (fp, 9, "$DIMUPT");
+                dxf_write_int (fp, 70, header->DimUPT);
+        }
         if ((fp->acad_version_number == AC1012) ||
-          (fp->acad_version_number == AC1014)) fprintf (fp->fp, "  9\n$DIMUNIT\n 70\n%i\n", header->DimUNIT);
-        if (fp->acad_version_number >= AC1012) fprintf (fp->fp, "  9\n$DIMDEC\n 70\n%i\n", header->DimDEC);
-        if (fp->acad_version_number >= AC1012) fprintf (fp->fp, "  9\n$DIMTDEC\n 70\n%i\n", header->DimTDEC);
-        if (fp->acad_version_number >= AC1012) fprintf (fp->fp, "  9\n$DIMALTU\n 70\n%i\n", header->DimALTU);
-        if (fp->acad_version_number >= AC1012) fprintf (fp->fp, "  9\n$DIMALTTD\n 70\n%i\n", header->DimALTTD);
-        if (fp->acad_version_number >= AC1012) fprintf (fp->fp, "  9\n$DIMTXSTY\n  7\n%s\n", header->DimTXSTY);
-        if (fp->acad_version_number >= AC1012) fprintf (fp->fp, "  9\n$DIMAUNIT\n 70\n%i\n", header->DimAUNIT);
-        if (fp->acad_version_number >= AC1015) fprintf (fp->fp, "  9\n$DIMADEC\n 70\n%i\n", header->DimADEC);
-        if (fp->acad_version_number >= AC1015) fprintf (fp->fp, "  9\n$DIMALTRND\n 40\n%f\n", header->DimALTRND);
-        if (fp->acad_version_number >= AC1015) fprintf (fp->fp, "  9\n$DIMAZIN\n 70\n%i\n", header->DimAZIN);
-        if (fp->acad_version_number >= AC1015) fprintf (fp->fp, "  9\n$DIMDSEP\n 70\n%i\n", header->DimDSEP);
-        if (fp->acad_version_number >= AC1015) fprintf (fp->fp, "  9\n$DIMATFIT\n 70\n%i\n", header->DimATFIT);
-        if (fp->acad_version_number >= AC1015) fprintf (fp->fp, "  9\n$DIMFRAC\n 70\n%i\n", header->DimFRAC);
-        if (fp->acad_version_number >= AC1015) fprintf (fp->fp, "  9\n$DIMLDRBLK\n  1\n%s\n", header->DimLDRBLK);
-        if (fp->acad_version_number >= AC1015) fprintf (fp->fp, "  9\n$DIMLUNIT\n 70\n%i\n", header->DimLUNIT);
-        if (fp->acad_version_number >= AC1015) fprintf (fp->fp, "  9\n$DIMLWD\n 70\n%i\n", header->DimLWD);
-        if (fp->acad_version_number >= AC1015) fprintf (fp->fp, "  9\n$DIMLWE\n 70\n%i\n", header->DimLWE);
-        if (fp->acad_version_number >= AC1015) fprintf (fp->fp, "  9\n$DIMTMOVE\n 70\n%i\n", header->DimTMOVE);
-        fprintf (fp->fp, "  9\n$LUNITS\n 70\n%i\n", header->LUnits);
-        fprintf (fp->fp, "  9\n$LUPREC\n 70\n%i\n", header->LUPrec);
-        fprintf (fp->fp, "  9\n$SKETCHINC\n 40\n%f\n", header->Sketchinc);
-        fprintf (fp->fp, "  9\n$FILLETRAD\n 40\n%f\n", header->FilletRad);
-        fprintf (fp->fp, "  9\n$AUNITS\n 70\n%i\n", header->AUnits);
-        fprintf (fp->fp, "  9\n$AUPREC\n 70\n%i\n", header->AUPrec);
-        fprintf (fp->fp, "  9\n$MENU\n  1\n%s\n", header->Menu);
-        fprintf (fp->fp, "  9\n$ELEVATION\n 40\n%f\n", header->Elevation);
-        fprintf (fp->fp, "  9\n$PELEVATION\n 40\n%f\n", header->PElevation);
-        fprintf (fp->fp, "  9\n$THICKNESS\n 40\n%f\n", header->Thickness);
-        fprintf (fp->fp, "  9\n$LIMCHECK\n 70\n%i\n", header->LimCheck);
-        if (fp->acad_version_number <= AC1014) fprintf (fp->fp, "  9\n$BLIPMODE\n 70\n%i\n", header->BlipMode);
-        fprintf (fp->fp, "  9\n$CHAMFERA\n 40\n%f\n", header->ChamferA);
-        fprintf (fp->fp, "  9\n$CHAMFERB\n 40\n%f\n", header->ChamferB);
-        if (fp->acad_version_number >= AC1012) fprintf (fp->fp, "  9\n$CHAMFERC\n 40\n%f\n", header->ChamferC);
-        if (fp->acad_version_number >= AC1012) fprintf (fp->fp, "  9\n$CHAMFERD\n 40\n%f\n", header->ChamferD);
-        fprintf (fp->fp, "  9\n$SKPOLY\n 70\n%i\n", header->SKPoly);
-        fprintf (fp->fp, "  9\n$TDCREATE\n 40\n%f\n", header->TDCreate);
-        if (fp->acad_version_number >= AC1015) fprintf (fp->fp, "  9\n$TDUCREATE\n 40\n%f\n", header->TDUCreate);
-        fprintf (fp->fp, "  9\n$TDUPDATE\n 40\n%f\n", header->TDUpdate);
-        if (fp->acad_version_number >= AC1015) fprintf (fp->fp, "  9\n$TDUUPDATE\n 40\n%f\n", header->TDUUpdate);
-        fprintf (fp->fp, "  9\n$TDINDWG\n 40\n%f\n", header->TDInDWG);
-        fprintf (fp->fp, "  9\n$TDUSRTIMER\n 40\n%f\n", header->TDUSRTimer);
-        fprintf (fp->fp, "  9\n$USRTIMER\n 70\n%i\n", header->USRTimer);
-        fprintf (fp->fp, "  9\n$ANGBASE\n 50\n%f\n", header->AngBase);
-        fprintf (fp->fp, "  9\n$ANGDIR\n 70\n%i\n", header->AngDir);
-        fprintf (fp->fp, "  9\n$PDMODE\n 70\n%i\n", header->PDMode);
-        fprintf (fp->fp, "  9\n$PDSIZE\n 40\n%f\n", header->PDSize);
-        fprintf (fp->fp, "  9\n$PLINEWID\n 40\n%f\n", header->PLineWid);
-        if (fp->acad_version_number <= AC1014) fprintf (fp->fp, "  9\n$COORDS\n 70\n%i\n", header->Coords);
-        fprintf (fp->fp, "  9\n$SPLFRAME\n 70\n%i\n", header->SPLFrame);
-        fprintf (fp->fp, "  9\n$SPLINETYPE\n 70\n%i\n", header->SPLineType);
-        if (fp->acad_version_number <= AC1014) fprintf (fp->fp, "  9\n$ATTDIA\n 70\n%i\n", header->AttDia);
-        if (fp->acad_version_number <= AC1014) fprintf (fp->fp, "  9\n$ATTREQ\n 70\n%i\n", header->AttReq);
-        if (fp->acad_version_number <= AC1014) fprintf (fp->fp, "  9\n$HANDLING\n 70\n%i\n", header->Handling);
-        fprintf (fp->fp, "  9\n$SPLINESEGS\n 70\n%i\n", header->SPLineSegs);
-        fprintf (fp->fp, "  9\n$HANDSEED\n  5\n%s\n", header->HandSeed);
-        fprintf (fp->fp, "  9\n$SURFTAB1\n 70\n%i\n", header->SurfTab1);
-        fprintf (fp->fp, "  9\n$SURFTAB2\n 70\n%i\n", header->SurfTab2);
-        fprintf (fp->fp, "  9\n$SURFTYPE\n 70\n%i\n", header->SurfType);
-        fprintf (fp->fp, "  9\n$SURFU\n 70\n%i\n", header->SurfU);
-        fprintf (fp->fp, "  9\n$SURFV\n 70\n%i\n", header->SurfV);
-        if (fp->acad_version_number >= AC1015) fprintf (fp->fp, "  9\n$UCSBASE\n  2\n%s\n", header->UCSBase);
-        fprintf (fp->fp, "  9\n$UCSNAME\n  2\n%s\n", header->UCSName);
-        fprintf (fp->fp, "  9\n$UCSORG\n 10\n%f\n 20\n%f\n 30\n%f\n", header->UCSOrg.x0, header->UCSOrg.y0, header->UCSOrg.z0);
-        fprintf (fp->fp, "  9\n$UCSXDIR\n 10\n%f\n 20\n%f\n 30\n%f\n", header->UCSXDir.x0, header->UCSXDir.y0, header->UCSXDir.z0);
-        fprintf (fp->fp, "  9\n$UCSYDIR\n 10\n%f\n 20\n%f\n 30\n%f\n", header->UCSYDir.x0, header->UCSYDir.y0, header->UCSYDir.z0);
-        if (fp->acad_version_number >= AC1015) fprintf (fp->fp, "  9\n$UCSORTHOREF\n  2\n%s\n", header->UCSOrthoRef);
-        if (fp->acad_version_number >= AC1015) fprintf (fp->fp, "  9\n$UCSORTHOVIEW\n 70\n%i\n", header->UCSOrthoView);
-        if (fp->acad_version_number >= AC1015) fprintf (fp->fp, "  9\n$UCSORGTOP\n 10\n%f\n 20\n%f\n 30\n%f\n", header->UCSOrgTop.x0, header->UCSOrgTop.y0, header->UCSOrgTop.z0);
-        if (fp->acad_version_number >= AC1015) fprintf (fp->fp, "  9\n$UCSORGBOTTOM\n 10\n%f\n 20\n%f\n 30\n%f\n", header->UCSOrgBottom.x0, header->UCSOrgBottom.y0, header->UCSOrgBottom.z0);
-        if (fp->acad_version_number >= AC1015) fprintf (fp->fp, "  9\n$UCSORGLEFT\n 10\n%f\n 20\n%f\n 30\n%f\n", header->UCSOrgLeft.x0, header->UCSOrgLeft.y0, header->UCSOrgLeft.z0);
-        if (fp->acad_version_number >= AC1015) fprintf (fp->fp, "  9\n$UCSORGRIGHT\n 10\n%f\n 20\n%f\n 30\n%f\n", header->UCSOrgRight.x0, header->UCSOrgRight.y0, header->UCSOrgRight.z0);
-        if (fp->acad_version_number >= AC1015) fprintf (fp->fp, "  9\n$UCSORGFRONT\n 10\n%f\n 20\n%f\n 30\n%f\n", header->UCSOrgFront.x0, header->UCSOrgFront.y0, header->UCSOrgFront.z0);
-        if (fp->acad_version_number >= AC1015) fprintf (fp->fp, "  9\n$UCSORGBACK\n 10\n%f\n 20\n%f\n 30\n%f\n", header->UCSOrgBack.x0, header->UCSOrgBack.y0, header->UCSOrgBack.z0);
-        if (fp->acad_version_number >= AC1015) fprintf (fp->fp, "  9\n$PUCSBASE\n  2\n%s\n", header->PUCSBase);
-        fprintf (fp->fp, "  9\n$PUCSNAME\n  2\n%s\n", header->PUCSName);
-        fprintf (fp->fp, "  9\n$PUCSORG\n 10\n%f\n 20\n%f\n 30\n%f\n", header->PUCSOrg.x0, header->PUCSOrg.y0, header->PUCSOrg.z0);
-        fprintf (fp->fp, "  9\n$PUCSXDIR\n 10\n%f\n 20\n%f\n 30\n%f\n", header->PUCSXDir.x0, header->PUCSXDir.y0, header->PUCSXDir.z0);
-        fprintf (fp->fp, "  9\n$PUCSYDIR\n 10\n%f\n 20\n%f\n 30\n%f\n", header->PUCSYDir.x0, header->PUCSYDir.y0, header->PUCSYDir.z0);
-        if (fp->acad_version_number >= AC1015) fprintf (fp->fp, "  9\n$PUCSORTHOREF\n  2\n%s\n", header->PUCSOrthoRef);
-        if (fp->acad_version_number >= AC1015) fprintf (fp->fp, "  9\n$PUCSORTHOVIEW\n 70\n%i\n", header->PUCSOrthoView);
-        if (fp->acad_version_number >= AC1015) fprintf (fp->fp, "  9\n$PUCSORGTOP\n 10\n%f\n 20\n%f\n 30\n%f\n", header->PUCSOrgTop.x0, header->PUCSOrgTop.y0, header->PUCSOrgTop.z0);
-        if (fp->acad_version_number >= AC1015) fprintf (fp->fp, "  9\n$PUCSORGBOTTOM\n 10\n%f\n 20\n%f\n 30\n%f\n", header->PUCSOrgBottom.x0, header->PUCSOrgBottom.y0, header->PUCSOrgBottom.z0);
-        if (fp->acad_version_number >= AC1015) fprintf (fp->fp, "  9\n$PUCSORGLEFT\n 10\n%f\n 20\n%f\n 30\n%f\n", header->PUCSOrgLeft.x0, header->PUCSOrgLeft.y0, header->PUCSOrgLeft.z0);
-        if (fp->acad_version_number >= AC1015) fprintf (fp->fp, "  9\n$PUCSORGRIGHT\n 10\n%f\n 20\n%f\n 30\n%f\n", header->PUCSOrgRight.x0, header->PUCSOrgRight.y0, header->PUCSOrgRight.z0);
-        if (fp->acad_version_number >= AC1015) fprintf (fp->fp, "  9\n$PUCSORGFRONT\n 10\n%f\n 20\n%f\n 30\n%f\n", header->PUCSOrgFront.x0, header->PUCSOrgFront.y0, header->PUCSOrgFront.z0);
-        if (fp->acad_version_number >= AC1015) fprintf (fp->fp, "  9\n$PUCSORGBACK\n 10\n%f\n 20\n%f\n 30\n%f\n", header->PUCSOrgBack.x0, header->PUCSOrgBack.y0, header->PUCSOrgBack.z0);
-        fprintf (fp->fp, "  9\n$USERI1\n 70\n%i\n", header->UserI1);
-        fprintf (fp->fp, "  9\n$USERI2\n 70\n%i\n", header->UserI2);
-        fprintf (fp->fp, "  9\n$USERI3\n 70\n%i\n", header->UserI3);
-        fprintf (fp->fp, "  9\n$USERI4\n 70\n%i\n", header->UserI4);
-        fprintf (fp->fp, "  9\n$USERI5\n 70\n%i\n", header->UserI5);
-        fprintf (fp->fp, "  9\n$USERR1\n 40\n%f\n", header->UserR1);
-        fprintf (fp->fp, "  9\n$USERR2\n 40\n%f\n", header->UserR2);
-        fprintf (fp->fp, "  9\n$USERR3\n 40\n%f\n", header->UserR3);
-        fprintf (fp->fp, "  9\n$USERR4\n 40\n%f\n", header->UserR4);
-        fprintf (fp->fp, "  9\n$USERR5\n 40\n%f\n", header->UserR5);
-        fprintf (fp->fp, "  9\n$WORLDVIEW\n 70\n%i\n", header->WorldView);
-        fprintf (fp->fp, "  9\n$SHADEDGE\n 70\n%i\n", header->ShadEdge);
-        fprintf (fp->fp, "  9\n$SHADEDIF\n 70\n%i\n", header->ShadeDif);
-        fprintf (fp->fp, "  9\n$TILEMODE\n 70\n%i\n", header->TileMode);
-        fprintf (fp->fp, "  9\n$MAXACTVP\n 70\n%i\n", header->MaxActVP);
-        fprintf (fp->fp, "  9\n$PINSBASE\n 10\n%f\n 20\n%f\n 30\n%f\n", header->PInsBase.x0, header->PInsBase.y0, header->PInsBase.z0);
-        fprintf (fp->fp, "  9\n$PLIMCHECK\n 70\n%i\n", header->PLimCheck);
-        fprintf (fp->fp, "  9\n$PEXTMIN\n 10\n%f\n 20\n%f\n 30\n%f\n", header->PExtMin.x0, header->PExtMin.y0, header->PExtMin.z0);
-        fprintf (fp->fp, "  9\n$PEXTMAX\n 10\n%f\n 20\n%f\n 30\n%f\n", header->PExtMax.x0, header->PExtMax.y0, header->PExtMax.z0);
-        fprintf (fp->fp, "  9\n$PLIMMIN\n 10\n%f\n 20\n%f\n", header->PLimMin.x0, header->PLimMin.y0);
-        fprintf (fp->fp, "  9\n$PLIMMAX\n 10\n%f\n 20\n%f\n", header->PLimMax.x0, header->PLimMax.y0);
-        fprintf (fp->fp, "  9\n$UNITMODE\n 70\n%i\n", header->UnitMode);
-        fprintf (fp->fp, "  9\n$VISRETAIN\n 70\n%i\n", header->VisRetain);
-        fprintf (fp->fp, "  9\n$PLINEGEN\n 70\n%i\n", header->PLineGen);
-        fprintf (fp->fp, "  9\n$PSLTSCALE\n 70\n%i\n", header->PSLTScale);
-        if (fp->acad_version_number >= AC1012) fprintf (fp->fp, "  9\n$TREEDEPTH\n 70\n%i\n", header->TreeDepth);
+          (fp->acad_version_number == AC1014))
+          {
+                  dxf_write_string (fp, 9, "$DIMUNIT");
+                  dxf_write_int (fp, 70, header->DimUNIT);
+          }
+        if (fp->acad_version_number >= AC1012)
+        {
+                dxf_write_string (fp, 9, "$DIMDEC");
+                dxf_write_int (fp, 70, header->DimDEC);
+        }
+        if (fp->acad_version_number >= AC1012)
+        {
+                dxf_write_string (fp, 9, "$DIMTDEC");
+                dxf_write_int (fp, 70, header->DimTDEC);
+        }
+        if (fp->acad_version_number >= AC1012)
+        {
+                dxf_write_string (fp, 9, "$DIMALTU");
+                dxf_write_int (fp, 70, header->DimALTU);
+        }
+        if (fp->acad_version_number >= AC1012)
+        {
+                dxf_write_string (fp, 9, "$DIMALTTD");
+                dxf_write_int (fp, 70, header->DimALTTD);
+        }
+        if (fp->acad_version_number >= AC1012)
+        {
+                dxf_write_string (fp, 9, "$DIMTXSTY");
+                dxf_write_string (fp, 7, header->DimTXSTY);
+        }
+        if (fp->acad_version_number >= AC1012)
+        {
+                dxf_write_string (fp, 9, "$DIMAUNIT");
+                dxf_write_int (fp, 70, header->DimAUNIT);
+        }
+        if (fp->acad_version_number >= AC1015)
+        {
+                dxf_write_string (fp, 9, "$DIMADEC");
+                dxf_write_int (fp, 70, header->DimADEC);
+        }
+        if (fp->acad_version_number >= AC1015)
+        {
+                dxf_write_string (fp, 9, "$DIMALTRND");
+                dxf_write_double (fp, 40, header->DimALTRND);
+        }
+        if (fp->acad_version_number >= AC1015)
+        {
+                dxf_write_string (fp, 9, "$DIMAZIN");
+                dxf_write_int (fp, 70, header->DimAZIN);
+        }
+        if (fp->acad_version_number >= AC1015)
+        {
+                dxf_write_string (fp, 9, "$DIMDSEP");
+                dxf_write_int (fp, 70, header->DimDSEP);
+        }
+        if (fp->acad_version_number >= AC1015)
+        {
+                dxf_write_string (fp, 9, "$DIMATFIT");
+                dxf_write_int (fp, 70, header->DimATFIT);
+        }
+        if (fp->acad_version_number >= AC1015)
+        {
+                dxf_write_string (fp, 9, "$DIMFRAC");
+                dxf_write_int (fp, 70, header->DimFRAC);
+        }
+        if (fp->acad_version_number >= AC1015)
+        {
+                dxf_write_string (fp, 9, "$DIMLDRBLK");
+                dxf_write_string (fp, 1, header->DimLDRBLK);
+        }
+        if (fp->acad_version_number >= AC1015)
+        {
+                dxf_write_string (fp, 9, "$DIMLUNIT");
+                dxf_write_int (fp, 70, header->DimLUNIT);
+        }
+        if (fp->acad_version_number >= AC1015)
+        {
+                dxf_write_string (fp, 9, "$DIMLWD");
+                dxf_write_int (fp, 70, header->DimLWD);
+        }
+        if (fp->acad_version_number >= AC1015)
+        {
+                dxf_write_string (fp, 9, "$DIMLWE");
+                dxf_write_int (fp, 70, header->DimLWE);
+        }
+        if (fp->acad_version_number >= AC1015)
+        {
+                dxf_write_string (fp, 9, "$DIMTMOVE");
+                dxf_write_int (fp, 70, header->DimTMOVE);
+        }
+        dxf_write_string (fp, 9, "$LUNITS");
+        dxf_write_int (fp, 70, header->LUnits);
+        dxf_write_string (fp, 9, "$LUPREC");
+        dxf_write_int (fp, 70, header->LUPrec);
+        dxf_write_string (fp, 9, "$SKETCHINC");
+        dxf_write_double (fp, 40, header->Sketchinc);
+        dxf_write_string (fp, 9, "$FILLETRAD");
+        dxf_write_double (fp, 40, header->FilletRad);
+        dxf_write_string (fp, 9, "$AUNITS");
+        dxf_write_int (fp, 70, header->AUnits);
+        dxf_write_string (fp, 9, "$AUPREC");
+        dxf_write_int (fp, 70, header->AUPrec);
+        dxf_write_string (fp, 9, "$MENU");
+        dxf_write_string (fp, 1, header->Menu);
+        dxf_write_string (fp, 9, "$ELEVATION");
+        dxf_write_double (fp, 40, header->Elevation);
+        dxf_write_string (fp, 9, "$PELEVATION");
+        dxf_write_double (fp, 40, header->PElevation);
+        dxf_write_string (fp, 9, "$THICKNESS");
+        dxf_write_double (fp, 40, header->Thickness);
+        dxf_write_string (fp, 9, "$LIMCHECK");
+        dxf_write_int (fp, 70, header->LimCheck);
+        if (fp->acad_version_number <= AC1014)
+        {
+                dxf_write_string (fp, 9, "$BLIPMODE");
+                dxf_write_int (fp, 70, header->BlipMode);
+        }
+        dxf_write_string (fp, 9, "$CHAMFERA");
+        dxf_write_double (fp, 40, header->ChamferA);
+        dxf_write_string (fp, 9, "$CHAMFERB");
+        dxf_write_double (fp, 40, header->ChamferB);
+        if (fp->acad_version_number >= AC1012)
+        {
+                dxf_write_string (fp, 9, "$CHAMFERC");
+                dxf_write_double (fp, 40, header->ChamferC);
+        }
+        if (fp->acad_version_number >= AC1012)
+        {
+                dxf_write_string (fp, 9, "$CHAMFERD");
+                dxf_write_double (fp, 40, header->ChamferD);
+        }
+        dxf_write_string (fp, 9, "$SKPOLY");
+        dxf_write_int (fp, 70, header->SKPoly);
+        dxf_write_string (fp, 9, "$TDCREATE");
+        dxf_write_double (fp, 40, header->TDCreate);
+        if (fp->acad_version_number >= AC1015)
+        {
+                dxf_write_string (fp, 9, "$TDUCREATE");
+                dxf_write_double (fp, 40, header->TDUCreate);
+        }
+        dxf_write_string (fp, 9, "$TDUPDATE");
+        dxf_write_double (fp, 40, header->TDUpdate);
+        if (fp->acad_version_number >= AC1015)
+        {
+                dxf_write_string (fp, 9, "$TDUUPDATE");
+                dxf_write_double (fp, 40, header->TDUUpdate);
+        }
+        dxf_write_string (fp, 9, "$TDINDWG");
+        dxf_write_double (fp, 40, header->TDInDWG);
+        dxf_write_string (fp, 9, "$TDUSRTIMER");
+        dxf_write_double (fp, 40, header->TDUSRTimer);
+        dxf_write_string (fp, 9, "$USRTIMER");
+        dxf_write_int (fp, 70, header->USRTimer);
+        dxf_write_string (fp, 9, "$ANGBASE");
+        dxf_write_double (fp, 50, header->AngBase);
+        dxf_write_string (fp, 9, "$ANGDIR");
+        dxf_write_int (fp, 70, header->AngDir);
+        dxf_write_string (fp, 9, "$PDMODE");
+        dxf_write_int (fp, 70, header->PDMode);
+        dxf_write_string (fp, 9, "$PDSIZE");
+        dxf_write_double (fp, 40, header->PDSize);
+        dxf_write_string (fp, 9, "$PLINEWID");
+        dxf_write_double (fp, 40, header->PLineWid);
+        if (fp->acad_version_number <= AC1014)
+        {
+                dxf_write_string (fp, 9, "$COORDS");
+                dxf_write_int (fp, 70, header->Coords);
+        }
+        dxf_write_string (fp, 9, "$SPLFRAME");
+        dxf_write_int (fp, 70, header->SPLFrame);
+        dxf_write_string (fp, 9, "$SPLINETYPE");
+        dxf_write_int (fp, 70, header->SPLineType);
+        if (fp->acad_version_number <= AC1014)
+        {
+                dxf_write_string (fp, 9, "$ATTDIA");
+                dxf_write_int (fp, 70, header->AttDia);
+        }
+        if (fp->acad_version_number <= AC1014)
+        {
+                dxf_write_string (fp, 9, "$ATTREQ");
+                dxf_write_int (fp, 70, header->AttReq);
+        }
+        if (fp->acad_version_number <= AC1014)
+        {
+                dxf_write_string (fp, 9, "$HANDLING");
+                dxf_write_int (fp, 70, header->Handling);
+        }
+        dxf_write_string (fp, 9, "$SPLINESEGS");
+        dxf_write_int (fp, 70, header->SPLineSegs);
+        dxf_write_string (fp, 9, "$HANDSEED");
+        dxf_write_string (fp, 5, header->HandSeed);
+        dxf_write_string (fp, 9, "$SURFTAB1");
+        dxf_write_int (fp, 70, header->SurfTab1);
+        dxf_write_string (fp, 9, "$SURFTAB2");
+        dxf_write_int (fp, 70, header->SurfTab2);
+        dxf_write_string (fp, 9, "$SURFTYPE");
+        dxf_write_int (fp, 70, header->SurfType);
+        dxf_write_string (fp, 9, "$SURFU");
+        dxf_write_int (fp, 70, header->SurfU);
+        dxf_write_string (fp, 9, "$SURFV");
+        dxf_write_int (fp, 70, header->SurfV);
+        if (fp->acad_version_number >= AC1015)
+        {
+                dxf_write_string (fp, 9, "$UCSBASE");
+                dxf_write_string (fp, 2, header->UCSBase);
+        }
+        dxf_write_string (fp, 9, "$UCSNAME");
+        dxf_write_string (fp, 2, header->UCSName);
+        dxf_write_string (fp, 9, "$UCSORG");
+        dxf_write_double (fp, 10, header->UCSOrg.x0);
+        dxf_write_double (fp, 20, header->UCSOrg.y0);
+        dxf_write_double (fp, 30, header->UCSOrg.z0);
+        dxf_write_string (fp, 9, "$UCSXDIR");
+        dxf_write_double (fp, 10, header->UCSXDir.x0);
+        dxf_write_double (fp, 20, header->UCSXDir.y0);
+        dxf_write_double (fp, 30, header->UCSXDir.z0);
+        dxf_write_string (fp, 9, "$UCSYDIR");
+        dxf_write_double (fp, 10, header->UCSYDir.x0);
+        dxf_write_double (fp, 20, header->UCSYDir.y0);
+        dxf_write_double (fp, 30, header->UCSYDir.z0);
+        if (fp->acad_version_number >= AC1015)
+        {
+                dxf_write_string (fp, 9, "$UCSORTHOREF");
+                dxf_write_string (fp, 2, header->UCSOrthoRef);
+        }
+        if (fp->acad_version_number >= AC1015)
+        {
+                dxf_write_string (fp, 9, "$UCSORTHOVIEW");
+                dxf_write_int (fp, 70, header->UCSOrthoView);
+        }
+        if (fp->acad_version_number >= AC1015)
+        {
+                dxf_write_string (fp, 9, "$UCSORGTOP");
+                dxf_write_double (fp, 10, header->UCSOrgTop.x0);
+                dxf_write_double (fp, 20, header->UCSOrgTop.y0);
+                dxf_write_double (fp, 30, header->UCSOrgTop.z0);
+        }
+        if (fp->acad_version_number >= AC1015)
+        {
+                dxf_write_string (fp, 9, "$UCSORGBOTTOM");
+                dxf_write_double (fp, 10, header->UCSOrgBottom.x0);
+                dxf_write_double (fp, 20, header->UCSOrgBottom.y0);
+                dxf_write_double (fp, 30, header->UCSOrgBottom.z0);
+        }
+        if (fp->acad_version_number >= AC1015)
+        {
+                dxf_write_string (fp, 9, "$UCSORGLEFT");
+                dxf_write_double (fp, 10, header->UCSOrgLeft.x0);
+                dxf_write_double (fp, 20, header->UCSOrgLeft.y0);
+                dxf_write_double (fp, 30, header->UCSOrgLeft.z0);
+        }
+        if (fp->acad_version_number >= AC1015)
+        {
+                dxf_write_string (fp, 9, "$UCSORGRIGHT");
+                dxf_write_double (fp, 10, header->UCSOrgRight.x0);
+                dxf_write_double (fp, 20, header->UCSOrgRight.y0);
+                dxf_write_double (fp, 30, header->UCSOrgRight.z0);
+        }
+        if (fp->acad_version_number >= AC1015)
+        {
+                dxf_write_string (fp, 9, "$UCSORGFRONT");
+                dxf_write_double (fp, 10, header->UCSOrgFront.x0);
+                dxf_write_double (fp, 20, header->UCSOrgFront.y0);
+                dxf_write_double (fp, 30, header->UCSOrgFront.z0);
+        }
+        if (fp->acad_version_number >= AC1015)
+        {
+                dxf_write_string (fp, 9, "$UCSORGBACK");
+                dxf_write_double (fp, 10, header->UCSOrgBack.x0);
+                dxf_write_double (fp, 20, header->UCSOrgBack.y0);
+                dxf_write_double (fp, 30, header->UCSOrgBack.z0);
+        }
+        if (fp->acad_version_number >= AC1015)
+        {
+                dxf_write_string (fp, 9, "$PUCSBASE");
+                dxf_write_string (fp, 2, header->PUCSBase);
+        }
+        dxf_write_string (fp, 9, "$PUCSNAME");
+        dxf_write_string (fp, 2, header->PUCSName);
+        dxf_write_string (fp, 9, "$PUCSORG");
+        dxf_write_double (fp, 10, header->PUCSOrg.x0);
+        dxf_write_double (fp, 20, header->PUCSOrg.y0);
+        dxf_write_double (fp, 30, header->PUCSOrg.z0);
+        dxf_write_string (fp, 9, "$PUCSXDIR");
+        dxf_write_double (fp, 10, header->PUCSXDir.x0);
+        dxf_write_double (fp, 20, header->PUCSXDir.y0);
+        dxf_write_double (fp, 30, header->PUCSXDir.z0);
+        dxf_write_string (fp, 9, "$PUCSYDIR");
+        dxf_write_double (fp, 10, header->PUCSYDir.x0);
+        dxf_write_double (fp, 20, header->PUCSYDir.y0);
+        dxf_write_double (fp, 30, header->PUCSYDir.z0);
+        if (fp->acad_version_number >= AC1015)
+        {
+                dxf_write_string (fp, 9, "$PUCSORTHOREF");
+                dxf_write_string (fp, 2, header->PUCSOrthoRef);
+        }
+        if (fp->acad_version_number >= AC1015)
+        {
+                dxf_write_string (fp, 9, "$PUCSORTHOVIEW");
+                dxf_write_int (fp, 70, header->PUCSOrthoView);
+        }
+        if (fp->acad_version_number >= AC1015)
+        {
+                dxf_write_string (fp, 9, "$PUCSORGTOP");
+                dxf_write_double (fp, 10, header->PUCSOrgTop.x0);
+                dxf_write_double (fp, 20, header->PUCSOrgTop.y0);
+                dxf_write_double (fp, 30, header->PUCSOrgTop.z0);
+        }
+        if (fp->acad_version_number >= AC1015)
+        {
+                dxf_write_string (fp, 9, "$PUCSORGBOTTOM");
+                dxf_write_double (fp, 10, header->PUCSOrgBottom.x0);
+                dxf_write_double (fp, 20, header->PUCSOrgBottom.y0);
+                dxf_write_double (fp, 30, header->PUCSOrgBottom.z0);
+        }
+        if (fp->acad_version_number >= AC1015)
+        {
+                dxf_write_string (fp, 9, "$PUCSORGLEFT");
+                dxf_write_double (fp, 10, header->PUCSOrgLeft.x0);
+                dxf_write_double (fp, 20, header->PUCSOrgLeft.y0);
+                dxf_write_double (fp, 30, header->PUCSOrgLeft.z0);
+        }
+        if (fp->acad_version_number >= AC1015)
+        {
+                dxf_write_string (fp, 9, "$PUCSORGRIGHT");
+                dxf_write_double (fp, 10, header->PUCSOrgRight.x0);
+                dxf_write_double (fp, 20, header->PUCSOrgRight.y0);
+                dxf_write_double (fp, 30, header->PUCSOrgRight.z0);
+        }
+        if (fp->acad_version_number >= AC1015)
+        {
+                dxf_write_string (fp, 9, "$PUCSORGFRONT");
+                dxf_write_double (fp, 10, header->PUCSOrgFront.x0);
+                dxf_write_double (fp, 20, header->PUCSOrgFront.y0);
+                dxf_write_double (fp, 30, header->PUCSOrgFront.z0);
+        }
+        if (fp->acad_version_number >= AC1015)
+        {
+                dxf_write_string (fp, 9, "$PUCSORGBACK");
+                dxf_write_double (fp, 10, header->PUCSOrgBack.x0);
+                dxf_write_double (fp, 20, header->PUCSOrgBack.y0);
+                dxf_write_double (fp, 30, header->PUCSOrgBack.z0);
+        }
+        dxf_write_string (fp, 9, "$USERI1");
+        dxf_write_int (fp, 70, header->UserI1);
+        dxf_write_string (fp, 9, "$USERI2");
+        dxf_write_int (fp, 70, header->UserI2);
+        dxf_write_string (fp, 9, "$USERI3");
+        dxf_write_int (fp, 70, header->UserI3);
+        dxf_write_string (fp, 9, "$USERI4");
+        dxf_write_int (fp, 70, header->UserI4);
+        dxf_write_string (fp, 9, "$USERI5");
+        dxf_write_int (fp, 70, header->UserI5);
+        dxf_write_string (fp, 9, "$USERR1");
+        dxf_write_double (fp, 40, header->UserR1);
+        dxf_write_string (fp, 9, "$USERR2");
+        dxf_write_double (fp, 40, header->UserR2);
+        dxf_write_string (fp, 9, "$USERR3");
+        dxf_write_double (fp, 40, header->UserR3);
+        dxf_write_string (fp, 9, "$USERR4");
+        dxf_write_double (fp, 40, header->UserR4);
+        dxf_write_string (fp, 9, "$USERR5");
+        dxf_write_double (fp, 40, header->UserR5);
+        dxf_write_string (fp, 9, "$WORLDVIEW");
+        dxf_write_int (fp, 70, header->WorldView);
+        dxf_write_string (fp, 9, "$SHADEDGE");
+        dxf_write_int (fp, 70, header->ShadEdge);
+        dxf_write_string (fp, 9, "$SHADEDIF");
+        dxf_write_int (fp, 70, header->ShadeDif);
+        dxf_write_string (fp, 9, "$TILEMODE");
+        dxf_write_int (fp, 70, header->TileMode);
+        dxf_write_string (fp, 9, "$MAXACTVP");
+        dxf_write_int (fp, 70, header->MaxActVP);
+        dxf_write_string (fp, 9, "$PINSBASE");
+        dxf_write_double (fp, 10, header->PInsBase.x0);
+        dxf_write_double (fp, 20, header->PInsBase.y0);
+        dxf_write_double (fp, 30, header->PInsBase.z0);
+        dxf_write_string (fp, 9, "$PLIMCHECK");
+        dxf_write_int (fp, 70, header->PLimCheck);
+        dxf_write_string (fp, 9, "$PEXTMIN");
+        dxf_write_double (fp, 10, header->PExtMin.x0);
+        dxf_write_double (fp, 20, header->PExtMin.y0);
+        dxf_write_double (fp, 30, header->PExtMin.z0);
+        dxf_write_string (fp, 9, "$PEXTMAX");
+        dxf_write_double (fp, 10, header->PExtMax.x0);
+        dxf_write_double (fp, 20, header->PExtMax.y0);
+        dxf_write_double (fp, 30, header->PExtMax.z0);
+        dxf_write_string (fp, 9, "$PLIMMIN");
+        dxf_write_double (fp, 10, header->PLimMin.x0);
+        dxf_write_double (fp, 20, header->PLimMin.y0);
+        dxf_write_string (fp, 9, "$PLIMMAX");
+        dxf_write_double (fp, 10, header->PLimMax.x0);
+        dxf_write_double (fp, 20, header->PLimMax.y0);
+        dxf_write_string (fp, 9, "$UNITMODE");
+        dxf_write_int (fp, 70, header->UnitMode);
+        dxf_write_string (fp, 9, "$VISRETAIN");
+        dxf_write_int (fp, 70, header->VisRetain);
+        dxf_write_string (fp, 9, "$PLINEGEN");
+        dxf_write_int (fp, 70, header->PLineGen);
+        dxf_write_string (fp, 9, "$PSLTSCALE");
+        dxf_write_int (fp, 70, header->PSLTScale);
+        if (fp->acad_version_number >= AC1012)
+        {
+                dxf_write_string (fp, 9, "$TREEDEPTH");
+                dxf_write_int (fp, 70, header->TreeDepth);
+        }
         if ((fp->acad_version_number == AC1012)
-          || (fp->acad_version_number == AC1014)) fprintf (fp->fp, "  9\n$PICKSTYLE\n 70\n%i\n", header->PickStyle);
-        if (fp->acad_version_number >= AC1012) fprintf (fp->fp, "  9\n$CMLSTYLE\n  2\n%s\n", header->CMLStyle);
-        if (fp->acad_version_number >= AC1012) fprintf (fp->fp, "  9\n$CMLJUST\n 70\n%i\n", header->CMLJust);
-        if (fp->acad_version_number >= AC1012) fprintf (fp->fp, "  9\n$CMLSCALE\n 40\n%f\n", header->CMLScale);
-        if (fp->acad_version_number >= AC1014) fprintf (fp->fp, "  9\n$PROXYGRAPHICS\n 70\n%i\n", header->ProxyGraphics);
-        if (fp->acad_version_number >= AC1014) fprintf (fp->fp, "  9\n$MEASUREMENT\n 70\n%i\n", header->Measurement);
-        if (fp->acad_version_number == AC1012) fprintf (fp->fp, "  9\n$SAVEIMAGES\n 70\n%i\n", header->SaveImages);
-        if (fp->acad_version_number >= AC1015) fprintf (fp->fp, "  9\n$CELWEIGHT\n370\n%i\n", header->CELWeight);
-        if (fp->acad_version_number >= AC1015) fprintf (fp->fp, "  9\n$ENDCAPS\n280\n%i\n", header->EndCaps);
-        if (fp->acad_version_number >= AC1015) fprintf (fp->fp, "  9\n$JOINSTYLE\n280\n%i\n", header->JoinStyle);
-        if (fp->acad_version_number >= AC1015) fprintf (fp->fp, "  9\n$LWDISPLAY\n290\n%i\n", header->LWDisplay);
-        if (fp->acad_version_number >= AC1015) fprintf (fp->fp, "  9\n$INSUNITS\n 70\n%i\n", header->InsUnits);
-        if (fp->acad_version_number >= AC1015) fprintf (fp->fp, "  9\n$HYPERLINKBASE\n  1\n%s\n", header->HyperLinkBase);
-        if (fp->acad_version_number >= AC1015) fprintf (fp->fp, "  9\n$STYLESHEET\n  1\n%s\n", header->StyleSheet);
-        if (fp->acad_version_number >= AC1015) fprintf (fp->fp, "  9\n$XEDIT\n290\n%i\n", header->XEdit);
-        if (fp->acad_version_number >= AC1015) fprintf (fp->fp, "  9\n$CEPSNTYPE\n380\n%i\n", header->CEPSNType);
-        if (fp->acad_version_number >= AC1015) fprintf (fp->fp, "  9\n$PSTYLEMODE\n290\n%i\n", header->PStyleMode);
-        if (fp->acad_version_number >= AC1015) fprintf (fp->fp, "  9\n$FINGERPRINTGUID\n  2\n%s\n", header->FingerPrintGUID);
-        if (fp->acad_version_number >= AC1015) fprintf (fp->fp, "  9\n$VERSIONGUID\n  2\n%s\n", header->VersionGUID);
-        if (fp->acad_version_number >= AC1015) fprintf (fp->fp, "  9\n$EXTNAMES\n290\n%i\n", header->ExtNames);
-        if (fp->acad_version_number >= AC1015) fprintf (fp->fp, "  9\n$PSVPSCALE\n 40\n%f\n", header->PSVPScale);
-        if (fp->acad_version_number >= AC1015) fprintf (fp->fp, "  9\n$OLESTARTUP\n290\n%i\n", header->OLEStartUp);
-        if (fp->acad_version_number >= AC1018) fprintf (fp->fp, "  9\n$SORTENTS\n280\n%i\n", header->SortEnts);
-        if (fp->acad_version_number >= AC1018) fprintf (fp->fp, "  9\n$INDEXCTL\n280\n%i\n", header->IndexCtl);
-        if (fp->acad_version_number >= AC1018) fprintf (fp->fp, "  9\n$HIDETEXT\n280\n%i\n", header->HideText);
-        if (fp->acad_version_number >= AC1018) fprintf (fp->fp, "  9\n$XCLIPFRAME\n290\n%i\n", header->XClipFrame);
-        if (fp->acad_version_number >= AC1018) fprintf (fp->fp, "  9\n$HALOGAP\n280\n%i\n", header->HaloGap);
-        if (fp->acad_version_number >= AC1018) fprintf (fp->fp, "  9\n$OBSCOLOR\n 70\n%i\n", header->ObsColor);
-        if (fp->acad_version_number >= AC1018) fprintf (fp->fp, "  9\n$OBSLTYPE\n280\n%i\n", header->ObsLType);
-        if (fp->acad_version_number >= AC1018) fprintf (fp->fp, "  9\n$INTERSECTIONDISPLAY\n280\n%i\n", header->InterSectionDisplay);
-        if (fp->acad_version_number >= AC1018) fprintf (fp->fp, "  9\n$INTERSECTIONCOLOR\n 70\n%i\n", header->InterSectionColor);
-        if (fp->acad_version_number >= AC1018) fprintf (fp->fp, "  9\n$DIMASSOC\n280\n%i\n", header->DimASSOC);
-        if (fp->acad_version_number >= AC1018) fprintf (fp->fp, "  9\n$PROJECTNAME\n  1\n%s\n", header->ProjectName);
+          || (fp->acad_version_number == AC1014))
+          {
+                  dxf_write_string (fp, 9, "$PICKSTYLE");
+                  dxf_write_int (fp, 70, header->PickStyle);
+          }
+        if (fp->acad_version_number >= AC1012)
+        {
+                dxf_write_string (fp, 9, "$CMLSTYLE");
+                dxf_write_string (fp, 2, header->CMLStyle);
+        }
+        if (fp->acad_version_number >= AC1012)
+        {
+                dxf_write_string (fp, 9, "$CMLJUST");
+                dxf_write_int (fp, 70, header->CMLJust);
+        }
+        if (fp->acad_version_number >= AC1012)
+        {
+                dxf_write_string (fp, 9, "$CMLSCALE");
+                dxf_write_double (fp, 40, header->CMLScale);
+        }
+        if (fp->acad_version_number >= AC1014)
+        {
+                dxf_write_string (fp, 9, "$PROXYGRAPHICS");
+                dxf_write_int (fp, 70, header->ProxyGraphics);
+        }
+        if (fp->acad_version_number >= AC1014)
+        {
+                dxf_write_string (fp, 9, "$MEASUREMENT");
+                dxf_write_int (fp, 70, header->Measurement);
+        }
+        if (fp->acad_version_number == AC1012)
+        {
+                dxf_write_string (fp, 9, "$SAVEIMAGES");
+                dxf_write_int (fp, 70, header->SaveImages);
+        }
+        if (fp->acad_version_number >= AC1015)
+        {
+                dxf_write_string (fp, 9, "$CELWEIGHT");
+                dxf_write_int (fp, 370, header->CELWeight);
+        }
+        if (fp->acad_version_number >= AC1015)
+        {
+                dxf_write_string (fp, 9, "$ENDCAPS");
+                dxf_write_int (fp, 280, header->EndCaps);
+        }
+        if (fp->acad_version_number >= AC1015)
+        {
+                dxf_write_string (fp, 9, "$JOINSTYLE");
+                dxf_write_int (fp, 280, header->JoinStyle);
+        }
+        if (fp->acad_version_number >= AC1015)
+        {
+                dxf_write_string (fp, 9, "$LWDISPLAY");
+                dxf_write_int (fp, 290, header->LWDisplay);
+        }
+        if (fp->acad_version_number >= AC1015)
+        {
+                dxf_write_string (fp, 9, "$INSUNITS");
+                dxf_write_int (fp, 70, header->InsUnits);
+        }
+        if (fp->acad_version_number >= AC1015)
+        {
+                dxf_write_string (fp, 9, "$HYPERLINKBASE");
+                dxf_write_string (fp, 1, header->HyperLinkBase);
+        }
+        if (fp->acad_version_number >= AC1015)
+        {
+                dxf_write_string (fp, 9, "$STYLESHEET");
+                dxf_write_string (fp, 1, header->StyleSheet);
+        }
+        if (fp->acad_version_number >= AC1015)
+        {
+                dxf_write_string (fp, 9, "$XEDIT");
+                dxf_write_int (fp, 290, header->XEdit);
+        }
+        if (fp->acad_version_number >= AC1015)
+        {
+                dxf_write_string (fp, 9, "$CEPSNTYPE");
+                dxf_write_int (fp, 380, header->CEPSNType);
+        }
+        if (fp->acad_version_number >= AC1015)
+        {
+                dxf_write_string (fp, 9, "$PSTYLEMODE");
+                dxf_write_int (fp, 290, header->PStyleMode);
+        }
+        if (fp->acad_version_number >= AC1015)
+        {
+                dxf_write_string (fp, 9, "$FINGERPRINTGUID");
+                dxf_write_string (fp, 2, header->FingerPrintGUID);
+        }
+        if (fp->acad_version_number >= AC1015)
+        {
+                dxf_write_string (fp, 9, "$VERSIONGUID");
+                dxf_write_string (fp, 2, header->VersionGUID);
+        }
+        if (fp->acad_version_number >= AC1015)
+        {
+                dxf_write_string (fp, 9, "$EXTNAMES");
+                dxf_write_int (fp, 290, header->ExtNames);
+        }
+        if (fp->acad_version_number >= AC1015)
+        {
+                dxf_write_string (fp, 9, "$PSVPSCALE");
+                dxf_write_double (fp, 40, header->PSVPScale);
+        }
+        if (fp->acad_version_number >= AC1015)
+        {
+                dxf_write_string (fp, 9, "$OLESTARTUP");
+                dxf_write_int (fp, 290, header->OLEStartUp);
+        }
+        if (fp->acad_version_number >= AC1018)
+        {
+                dxf_write_string (fp, 9, "$SORTENTS");
+                dxf_write_int (fp, 280, header->SortEnts);
+        }
+        if (fp->acad_version_number >= AC1018)
+        {
+                dxf_write_string (fp, 9, "$INDEXCTL");
+                dxf_write_int (fp, 280, header->IndexCtl);
+        }
+        if (fp->acad_version_number >= AC1018)
+        {
+                dxf_write_string (fp, 9, "$HIDETEXT");
+                dxf_write_int (fp, 280, header->HideText);
+        }
+        if (fp->acad_version_number >= AC1018)
+        {
+                dxf_write_string (fp, 9, "$XCLIPFRAME");
+                dxf_write_int (fp, 290, header->XClipFrame);
+        }
+        if (fp->acad_version_number >= AC1018)
+        {
+                dxf_write_string (fp, 9, "$HALOGAP");
+                dxf_write_int (fp, 280, header->HaloGap);
+        }
+        if (fp->acad_version_number >= AC1018)
+        {
+                dxf_write_string (fp, 9, "$OBSCOLOR");
+                dxf_write_int (fp, 70, header->ObsColor);
+        }
+        if (fp->acad_version_number >= AC1018)
+        {
+                dxf_write_string (fp, 9, "$OBSLTYPE");
+                dxf_write_int (fp, 280, header->ObsLType);
+        }
+        if (fp->acad_version_number >= AC1018)
+        {
+                dxf_write_string (fp, 9, "$INTERSECTIONDISPLAY");
+                dxf_write_int (fp, 280, header->InterSectionDisplay);
+        }
+        if (fp->acad_version_number >= AC1018)
+        {
+                dxf_write_string (fp, 9, "$INTERSECTIONCOLOR");
+                dxf_write_int (fp, 70, header->InterSectionColor);
+        }
+        if (fp->acad_version_number >= AC1018)
+        {
+                dxf_write_string (fp, 9, "$DIMASSOC");
+                dxf_write_int (fp, 280, header->DimASSOC);
+        }
+        if (fp->acad_version_number >= AC1018)
+        {
+                dxf_write_string (fp, 9, "$PROJECTNAME");
+                dxf_write_string (fp, 1, header->ProjectName);
+        }
         dxf_endsec_write (fp);
         /* Clean up. */
-        free (dxf_entity_name);
+        dxf_free (dxf_entity_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1216,7 +2237,7 @@ dxf_header_read_parse_string
                 dxf_read_scanf (fp, "%i\n%s\n", &n, tstring);
                 if (dxf_read_is_string(n))
                 {
-                        *value_string = strdup(tstring);
+                        *value_string = dxf_strdup (tstring);
                 }
                 else
                         ret = FAIL;
@@ -1367,7 +2388,16 @@ dxf_header_read_parse_n_double
 
 
 /*!
- * \brief Parses the header from a DXF file, with no particulary order.
+ * \brief Parses a header variable from a DXF file, with no particulary
+ * order.
+ *
+ * The variable name in \c temp_string is looked up in the same table
+ * as used by dxf_header_read (), and its value is read into the
+ * matching member of \c header.
+ *
+ * \return \c FOUND when the variable was read, \c FAIL when an error
+ * occurred while reading its value, or \c FALSE for an unknown
+ * variable.
  */
 int
 dxf_header_read_parser
@@ -1377,13 +2407,16 @@ dxf_header_read_parser
         DxfHeader *header,
                 /*!< DXF header to be initialized.\n */
         char * temp_string,
+                /*!< Variable name, including the leading "$". */
         int acad_version_number
+                /*!< AutoCAD version number, not used: variables are
+                 * read whatever the version of the file. */
 )
 {
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        int ret;
+        const DxfHeaderVariable *variable;
 
         /* Do some basic checks. */
         if (fp == NULL)
@@ -1407,464 +2440,23 @@ dxf_header_read_parser
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        /*!
-        * \todo: add some kind of control to what we have already read
-        * and check if we read all header data.
-        */
-        ret = dxf_header_read_parse_int (fp, temp_string, "$ACADMAINTVER",
-                                         &header->AcadMaintVer,
-                                         acad_version_number > AC1014);
-        dxf_return(ret);
-
-        ret = dxf_header_read_parse_string (fp, temp_string, "$DWGCODEPAGE",
-                                            &header->DWGCodePage,
-                                            acad_version_number >= AC1012);
-        dxf_return(ret);
-
-        ret = dxf_header_read_parse_n_double (fp, temp_string, "$INSBASE",
-                                              TRUE,
-                                              3,
-                                              &header->InsBase.x0,
-                                              &header->InsBase.y0,
-                                              &header->InsBase.z0);
-        dxf_return(ret);
-
-        ret = dxf_header_read_parse_n_double (fp, temp_string, "$EXTMIN",
-                                              TRUE,
-                                              3,
-                                              &header->ExtMin.x0,
-                                              &header->ExtMin.y0,
-                                              &header->ExtMin.z0);
-        dxf_return(ret);
-
-        ret = dxf_header_read_parse_n_double (fp, temp_string, "$EXTMAX",
-                                              TRUE,
-                                              3,
-                                              &header->ExtMax.x0,
-                                              &header->ExtMax.y0,
-                                              &header->ExtMax.z0);
-        dxf_return(ret);
-
-        ret = dxf_header_read_parse_n_double (fp, temp_string, "$LIMMIN",
-                                              TRUE,
-                                              2,
-                                              &header->LimMin.x0,
-                                              &header->LimMin.y0);
-        dxf_return(ret);
-
-        ret = dxf_header_read_parse_n_double (fp, temp_string, "$LIMMAX",
-                                              TRUE,
-                                              2,
-                                              &header->LimMax.x0,
-                                              &header->LimMax.y0);
-        dxf_return(ret);
-
-        ret = dxf_header_read_parse_int (fp, temp_string, "$ORTHOMODE",
-                                         &header->OrthoMode,
-                                         TRUE);
-        dxf_return(ret);
-
-        ret = dxf_header_read_parse_int (fp, temp_string, "$REGENMODE",
-                                         &header->RegenMode,
-                                         TRUE);
-        dxf_return(ret);
-
-        ret = dxf_header_read_parse_int (fp, temp_string, "$FILLMODE",
-                                         &header->FillMode,
-                                         TRUE);
-        dxf_return(ret);
-
-        ret = dxf_header_read_parse_int (fp, temp_string, "$QTEXTMODE",
-                                         &header->QTextMode,
-                                         TRUE);
-        dxf_return(ret);
-
-        ret = dxf_header_read_parse_int (fp, temp_string, "$MIRRTEXT",
-                                         &header->MirrText,
-                                         TRUE);
-        dxf_return(ret);
-
-        ret = dxf_header_read_parse_int (fp, temp_string, "$DRAGMODE",
-                                         &header->MirrText,
-                                         acad_version_number < AC1015);
-        dxf_return(ret);
-
-        ret = dxf_header_read_parse_n_double (fp, temp_string, "$LTSCALE",
-                                              TRUE,
-                                              1,
-                                              &header->LTScale);
-        dxf_return(ret);
-
-        ret = dxf_header_read_parse_int (fp, temp_string, "$OSMODE",
-                                         &header->OSMode,
-                                         acad_version_number <= AC1014);
-        dxf_return(ret);
-
-        ret = dxf_header_read_parse_int (fp, temp_string, "$ATTMODE",
-                                         &header->AttMode,
-                                         TRUE);
-        dxf_return(ret);
-    
-        ret = dxf_header_read_parse_n_double (fp, temp_string, "$TEXTSIZE",
-                                              TRUE,
-                                              1,
-                                              &header->TextSize);
-        dxf_return(ret);
-
-        ret = dxf_header_read_parse_n_double (fp, temp_string, "$TRACEWID",
-                                              TRUE,
-                                              1,
-                                              &header->TraceWid);
-        dxf_return(ret);
-
-        ret = dxf_header_read_parse_string (fp, temp_string, "$TEXTSTYLE",
-                                            &header->TextStyle,
-                                            TRUE);
-        dxf_return(ret);
-
-        ret = dxf_header_read_parse_string (fp, temp_string, "$CLAYER",
-                                            &header->CLayer,
-                                            TRUE);
-        dxf_return(ret);
-
-        ret = dxf_header_read_parse_string (fp, temp_string, "$CELTYPE",
-                                            &header->CELType,
-                                            TRUE);
-        dxf_return(ret);
-
-        ret = dxf_header_read_parse_int (fp, temp_string, "$CECOLOR",
-                                         &header->CEColor,
-                                         TRUE);
-        dxf_return(ret);
-
-        ret = dxf_header_read_parse_n_double (fp, temp_string, "$CELTSCALE",
-                                              acad_version_number >= AC1012,
-                                              1,
-                                              &header->CELTScale);
-        dxf_return(ret);
-
-        ret = dxf_header_read_parse_int (fp, temp_string, "$DELOBJ",
-                                         &header->DelObj,
-                                         (acad_version_number == AC1012)
-                                         || (acad_version_number == AC1014));
-        dxf_return(ret);
-
-        /*! \todo FIXME: changed from AC1012 to AC1015 */
-        ret = dxf_header_read_parse_int (fp, temp_string, "$DISPSILH",
-                                         &header->DispSilH,
-                                         acad_version_number <= AC1015);
-        dxf_return(ret);
-
-        ret = dxf_header_read_parse_n_double (fp, temp_string, "$DIMSCALE",
-                                              TRUE,
-                                              1,
-                                              &header->DimSCALE);
-        dxf_return(ret);
-
-        ret = dxf_header_read_parse_n_double (fp, temp_string, "$DIMASZ",
-                                              TRUE,
-                                              1,
-                                              &header->DimASZ);
-        dxf_return(ret);
-
-        ret = dxf_header_read_parse_n_double (fp, temp_string, "$DIMEXO",
-                                              TRUE,
-                                              1,
-                                              &header->DimEXO);
-        dxf_return(ret);
-
-        /*
-        fprintf (fp, "  9\n$DIMDLI\n 40\n%f\n", header->DimDLI);
-        fprintf (fp, "  9\n$DIMRND\n 40\n%f\n", header->DimRND);
-        fprintf (fp, "  9\n$DIMDLE\n 40\n%f\n", header->DimDLE);
-        */
-        ret = dxf_header_read_parse_n_double (fp, temp_string, "$DIMEXE",
-                                              TRUE,
-                                              1,
-                                              &header->DimEXE);
-        dxf_return(ret);
-        /*
-        fprintf (fp, "  9\n$DIMTP\n 40\n%f\n", header->DimTP);
-        fprintf (fp, "  9\n$DIMTM\n 40\n%f\n", header->DimTM);
-        */
-        ret = dxf_header_read_parse_n_double (fp, temp_string, "$DIMTXT",
-                                              TRUE,
-                                              1,
-                                              &header->DimTXT);
-        dxf_return(ret);
-        /*
-        fprintf (fp, "  9\n$DIMCEN\n 40\n%f\n", header->DimCEN);
-        fprintf (fp, "  9\n$DIMTSZ\n 40\n%f\n", header->DimTSZ);
-        fprintf (fp, "  9\n$DIMTOL\n 70\n%i\n", header->DimTOL);
-        fprintf (fp, "  9\n$DIMLIM\n 70\n%i\n", header->DimLIM);
-        fprintf (fp, "  9\n$DIMTIH\n 70\n%i\n", header->DimTIH);
-        fprintf (fp, "  9\n$DIMTOH\n 70\n%i\n", header->DimTOH);
-        fprintf (fp, "  9\n$DIMSE1\n 70\n%i\n", header->DimSE1);
-        fprintf (fp, "  9\n$DIMSE2\n 70\n%i\n", header->DimSE2);
-        fprintf (fp, "  9\n$DIMTAD\n 70\n%i\n", header->DimTAD);
-        fprintf (fp, "  9\n$DIMZIN\n 70\n%i\n", header->DimZIN);
-        fprintf (fp, "  9\n$DIMBLK\n  1\n%s\n", header->DimBLK);
-        fprintf (fp, "  9\n$DIMASO\n 70\n%i\n", header->DimASO);
-        fprintf (fp, "  9\n$DIMSHO\n 70\n%i\n", header->DimSHO);
-        fprintf (fp, "  9\n$DIMPOST\n  1\n%s\n", header->DimPOST);
-        fprintf (fp, "  9\n$DIMAPOST\n  1\n%s\n", header->DimAPOST);
-        fprintf (fp, "  9\n$DIMALT\n 70\n%i\n", header->DimALT);
-        fprintf (fp, "  9\n$DIMALTD\n 70\n%i\n", header->DimALTD);
-        fprintf (fp, "  9\n$DIMALTF\n 40\n%f\n", header->DimALTF);
-        fprintf (fp, "  9\n$DIMLFAC\n 40\n%f\n", header->DimLFAC);
-        fprintf (fp, "  9\n$DIMTOFL\n 70\n%i\n", header->DimTOFL);
-        fprintf (fp, "  9\n$DIMTVP\n 40\n%f\n", header->DimTVP);
-        fprintf (fp, "  9\n$DIMTIX\n 70\n%i\n", header->DimTIX);
-        fprintf (fp, "  9\n$DIMSOXD\n 70\n%i\n", header->DimSOXD);
-        fprintf (fp, "  9\n$DIMSAH\n 70\n%i\n", header->DimSAH);
-        fprintf (fp, "  9\n$DIMBLK1\n  1\n%s\n", header->DimBLK1);
-        fprintf (fp, "  9\n$DIMBLK2\n  1\n%s\n", header->DimBLK2);
-        */
-        ret = dxf_header_read_parse_string (fp, temp_string, "$DIMSTYLE",
-                                            &header->DimSTYLE,
-                                            TRUE);
-        dxf_return(ret);
-        /*
-        fprintf (fp, "  9\n$DIMCLRD\n 70\n%i\n", header->DimCLRD);
-        fprintf (fp, "  9\n$DIMCLRE\n 70\n%i\n", header->DimCLRE);
-        fprintf (fp, "  9\n$DIMCLRT\n 70\n%i\n", header->DimCLRT);
-        fprintf (fp, "  9\n$DIMTFAC\n 40\n%f\n", header->DimTFAC);
-        */
-        ret = dxf_header_read_parse_n_double (fp, temp_string, "$DIMGAP",
-                                              TRUE,
-                                              1,
-                                              &header->DimGAP);
-        dxf_return(ret);
-        /*
-        if (acad_version_number >= AC1012) fprintf (fp, "  9\n$DIMJUST\n 70\n%i\n", header->DimJUST);
-        if (acad_version_number >= AC1012) fprintf (fp, "  9\n$DIMSD1\n 70\n%i\n", header->DimSD1);
-        if (acad_version_number >= AC1012) fprintf (fp, "  9\n$DIMSD2\n 70\n%i\n", header->DimSD2);
-        if (acad_version_number >= AC1012) fprintf (fp, "  9\n$DIMTOLJ\n 70\n%i\n", header->DimTOLJ);
-        if (acad_version_number >= AC1012) fprintf (fp, "  9\n$DIMTZIN\n 70\n%i\n", header->DimTZIN);
-        if (acad_version_number >= AC1012) fprintf (fp, "  9\n$DIMALTZ\n 70\n%i\n", header->DimALTZ);
-        if (acad_version_number >= AC1012) fprintf (fp, "  9\n$DIMALTTZ\n 70\n%i\n", header->DimALTTZ);
-        if ((acad_version_number == AC1012) || (acad_version_number == AC1014)) fprintf (fp, "  9\n$DIMFIT\n 70\n%i\n", header->DimFIT);
-        if (acad_version_number >= AC1012) fprintf (fp, "  9\n$DIMUPT\n 70\n%i\n", header->DimUPT);
-        if ((acad_version_number == AC1012) || (acad_version_number == AC1014)) fprintf (fp, "  9\n$DIMUNIT\n 70\n%i\n", header->DimUNIT);
-        if (acad_version_number >= AC1012) fprintf (fp, "  9\n$DIMDEC\n 70\n%i\n", header->DimDEC);
-        if (acad_version_number >= AC1012) fprintf (fp, "  9\n$DIMTDEC\n 70\n%i\n", header->DimTDEC);
-        if (acad_version_number >= AC1012) fprintf (fp, "  9\n$DIMALTU\n 70\n%i\n", header->DimALTU);
-        if (acad_version_number >= AC1012) fprintf (fp, "  9\n$DIMALTTD\n 70\n%i\n", header->DimALTTD);
-        if (acad_version_number >= AC1012) fprintf (fp, "  9\n$DIMTXSTY\n  7\n%s\n", header->DimTXSTY);
-        */
-        ret = dxf_header_read_parse_int (fp, temp_string, "$DIMAUNIT",
-                                         &header->DimAUNIT,
-                                         acad_version_number >= AC1012);
-        dxf_return(ret);
-    
-        ret = dxf_header_read_parse_int (fp, temp_string, "$DIMADEC",
-                                         &header->DimADEC,
-                                         acad_version_number >= AC1015);
-        dxf_return(ret);
-        /*
-        if (acad_version_number >= AC1015) fprintf (fp, "  9\n$DIMALTRND\n 40\n%f\n", header->DimALTRND);
-        if (acad_version_number >= AC1015) fprintf (fp, "  9\n$DIMAZIN\n 70\n%i\n", header->DimAZIN);
-        if (acad_version_number >= AC1015) fprintf (fp, "  9\n$DIMDSEP\n 70\n%i\n", header->DimDSEP);
-        if (acad_version_number >= AC1015) fprintf (fp, "  9\n$DIMATFIT\n 70\n%i\n", header->DimATFIT);
-        if (acad_version_number >= AC1015) fprintf (fp, "  9\n$DIMFRAC\n 70\n%i\n", header->DimFRAC);
-        if (acad_version_number >= AC1015) fprintf (fp, "  9\n$DIMLDRBLK\n  1\n%s\n", header->DimLDRBLK);
-        */
-        ret = dxf_header_read_parse_int (fp, temp_string, "$DIMLUNIT",
-                                         &header->DimLUNIT,
-                                         acad_version_number >= AC1015);
-        dxf_return(ret);
-        /*
-        if (acad_version_number >= AC1015) fprintf (fp, "  9\n$DIMLWD\n 70\n%i\n", header->DimLWD);
-        if (acad_version_number >= AC1015) fprintf (fp, "  9\n$DIMLWE\n 70\n%i\n", header->DimLWE);
-        if (acad_version_number >= AC1015) fprintf (fp, "  9\n$DIMTMOVE\n 70\n%i\n", header->DimTMOVE);
-        */
-        ret = dxf_header_read_parse_int (fp, temp_string, "$LUNITS",
-                                         &header->LUnits,
-                                         TRUE);
-        dxf_return(ret);
-        
-        ret = dxf_header_read_parse_int (fp, temp_string, "$LUPREC",
-                                         &header->LUPrec,
-                                         TRUE);
-        dxf_return(ret);
-        /*
-        fprintf (fp, "  9\n$SKETCHINC\n 40\n%f\n", header->Sketchinc);
-        fprintf (fp, "  9\n$FILLETRAD\n 40\n%f\n", header->FilletRad);
-        */
-        ret = dxf_header_read_parse_int (fp, temp_string, "$AUNITS",
-                                         &header->AUnits,
-                                         TRUE);
-        dxf_return(ret);
-    
-        ret = dxf_header_read_parse_int (fp, temp_string, "$AUPREC",
-                                         &header->AUPrec,
-                                         TRUE);
-        dxf_return(ret);
-        /*
-        fprintf (fp, "  9\n$MENU\n  1\n%s\n", header->Menu);
-        fprintf (fp, "  9\n$ELEVATION\n 40\n%f\n", header->Elevation);
-        fprintf (fp, "  9\n$PELEVATION\n 40\n%f\n", header->PElevation);
-        fprintf (fp, "  9\n$THICKNESS\n 40\n%f\n", header->Thickness);
-        fprintf (fp, "  9\n$LIMCHECK\n 70\n%i\n", header->LimCheck);
-        if (acad_version_number <= AC1014) fprintf (fp, "  9\n$BLIPMODE\n 70\n%i\n", header->BlipMode);
-        fprintf (fp, "  9\n$CHAMFERA\n 40\n%f\n", header->ChamferA);
-        fprintf (fp, "  9\n$CHAMFERB\n 40\n%f\n", header->ChamferB);
-        if (acad_version_number >= AC1012) fprintf (fp, "  9\n$CHAMFERC\n 40\n%f\n", header->ChamferC);
-        if (acad_version_number >= AC1012) fprintf (fp, "  9\n$CHAMFERD\n 40\n%f\n", header->ChamferD);
-        fprintf (fp, "  9\n$SKPOLY\n 70\n%i\n", header->SKPoly);
-        fprintf (fp, "  9\n$TDCREATE\n 40\n%f\n", header->TDCreate);
-        if (acad_version_number >= AC1015) fprintf (fp, "  9\n$TDUCREATE\n 40\n%f\n", header->TDUCreate);
-        fprintf (fp, "  9\n$TDUPDATE\n 40\n%f\n", header->TDUpdate);
-        if (acad_version_number >= AC1015) fprintf (fp, "  9\n$TDUUPDATE\n 40\n%f\n", header->TDUUpdate);
-        fprintf (fp, "  9\n$TDINDWG\n 40\n%f\n", header->TDInDWG);
-        fprintf (fp, "  9\n$TDUSRTIMER\n 40\n%f\n", header->TDUSRTimer);
-        fprintf (fp, "  9\n$USRTIMER\n 70\n%i\n", header->USRTimer);
-        fprintf (fp, "  9\n$ANGBASE\n 50\n%f\n", header->AngBase);
-        fprintf (fp, "  9\n$ANGDIR\n 70\n%i\n", header->AngDir);
-        fprintf (fp, "  9\n$PDMODE\n 70\n%i\n", header->PDMode);
-        fprintf (fp, "  9\n$PDSIZE\n 40\n%f\n", header->PDSize);
-        fprintf (fp, "  9\n$PLINEWID\n 40\n%f\n", header->PLineWid);
-        if (acad_version_number <= AC1014) fprintf (fp, "  9\n$COORDS\n 70\n%i\n", header->Coords);
-        fprintf (fp, "  9\n$SPLFRAME\n 70\n%i\n", header->SPLFrame);
-        fprintf (fp, "  9\n$SPLINETYPE\n 70\n%i\n", header->SPLineType);
-        if (acad_version_number <= AC1014) fprintf (fp, "  9\n$ATTDIA\n 70\n%i\n", header->AttDia);
-        if (acad_version_number <= AC1014) fprintf (fp, "  9\n$ATTREQ\n 70\n%i\n", header->AttReq);
-        if (acad_version_number <= AC1014) fprintf (fp, "  9\n$HANDLING\n 70\n%i\n", header->Handling);
-        */
-        ret = dxf_header_read_parse_int (fp, temp_string, "$SPLINESEGS",
-                                         &header->SPLineSegs,
-                                         TRUE);
-        dxf_return(ret);
-        
-        ret = dxf_header_read_parse_string (fp, temp_string, "$HANDSEED",
-                                            &header->HandSeed,
-                                            TRUE);
-        dxf_return(ret);
-    /*
-        fprintf (fp, "  9\n$SURFTAB1\n 70\n%i\n", header->SurfTab1);
-        fprintf (fp, "  9\n$SURFTAB2\n 70\n%i\n", header->SurfTab2);
-        fprintf (fp, "  9\n$SURFTYPE\n 70\n%i\n", header->SurfType);
-        fprintf (fp, "  9\n$SURFU\n 70\n%i\n", header->SurfU);
-        fprintf (fp, "  9\n$SURFV\n 70\n%i\n", header->SurfV);
-        if (acad_version_number >= AC1015) fprintf (fp, "  9\n$UCSBASE\n  2\n%s\n", header->UCSBase);
-        fprintf (fp, "  9\n$UCSNAME\n  2\n%s\n", header->UCSName);
-        fprintf (fp, "  9\n$UCSORG\n 10\n%f\n 20\n%f\n 30\n%f\n", header->UCSOrg.x0, header->UCSOrg.y0, header->UCSOrg.z0);
-        fprintf (fp, "  9\n$UCSXDIR\n 10\n%f\n 20\n%f\n 30\n%f\n", header->UCSXDir.x0, header->UCSXDir.y0, header->UCSXDir.z0);
-        fprintf (fp, "  9\n$UCSYDIR\n 10\n%f\n 20\n%f\n 30\n%f\n", header->UCSYDir.x0, header->UCSYDir.y0, header->UCSYDir.z0);
-        if (acad_version_number >= AC1015) fprintf (fp, "  9\n$UCSORTHOREF\n  2\n%s\n", header->UCSOrthoRef);
-        if (acad_version_number >= AC1015) fprintf (fp, "  9\n$UCSORTHOVIEW\n 70\n%i\n", header->UCSOrthoView);
-        if (acad_version_number >= AC1015) fprintf (fp, "  9\n$UCSORGTOP\n 10\n%f\n 20\n%f\n 30\n%f\n", header->UCSOrgTop.x0, header->UCSOrgTop.y0, header->UCSOrgTop.z0);
-        if (acad_version_number >= AC1015) fprintf (fp, "  9\n$UCSORGBOTTOM\n 10\n%f\n 20\n%f\n 30\n%f\n", header->UCSOrgBottom.x0, header->UCSOrgBottom.y0, header->UCSOrgBottom.z0);
-        if (acad_version_number >= AC1015) fprintf (fp, "  9\n$UCSORGLEFT\n 10\n%f\n 20\n%f\n 30\n%f\n", header->UCSOrgLeft.x0, header->UCSOrgLeft.y0, header->UCSOrgLeft.z0);
-        if (acad_version_number >= AC1015) fprintf (fp, "  9\n$UCSORGRIGHT\n 10\n%f\n 20\n%f\n 30\n%f\n", header->UCSOrgRight.x0, header->UCSOrgRight.y0, header->UCSOrgRight.z0);
-        if (acad_version_number >= AC1015) fprintf (fp, "  9\n$UCSORGFRONT\n 10\n%f\n 20\n%f\n 30\n%f\n", header->UCSOrgFront.x0, header->UCSOrgFront.y0, header->UCSOrgFront.z0);
-        if (acad_version_number >= AC1015) fprintf (fp, "  9\n$UCSORGBACK\n 10\n%f\n 20\n%f\n 30\n%f\n", header->UCSOrgBack.x0, header->UCSOrgBack.y0, header->UCSOrgBack.z0);
-        if (acad_version_number >= AC1015) fprintf (fp, "  9\n$PUCSBASE\n  2\n%s\n", header->PUCSBase);
-        fprintf (fp, "  9\n$PUCSNAME\n  2\n%s\n", header->PUCSName);
-        fprintf (fp, "  9\n$PUCSORG\n 10\n%f\n 20\n%f\n 30\n%f\n", header->PUCSOrg.x0, header->PUCSOrg.y0, header->PUCSOrg.z0);
-        fprintf (fp, "  9\n$PUCSXDIR\n 10\n%f\n 20\n%f\n 30\n%f\n", header->PUCSXDir.x0, header->PUCSXDir.y0, header->PUCSXDir.z0);
-        fprintf (fp, "  9\n$PUCSYDIR\n 10\n%f\n 20\n%f\n 30\n%f\n", header->PUCSYDir.x0, header->PUCSYDir.y0, header->PUCSYDir.z0);
-        if (acad_version_number >= AC1015) fprintf (fp, "  9\n$PUCSORTHOREF\n  2\n%s\n", header->PUCSOrthoRef);
-        if (acad_version_number >= AC1015) fprintf (fp, "  9\n$PUCSORTHOVIEW\n 70\n%i\n", header->PUCSOrthoView);
-        if (acad_version_number >= AC1015) fprintf (fp, "  9\n$PUCSORGTOP\n 10\n%f\n 20\n%f\n 30\n%f\n", header->PUCSOrgTop.x0, header->PUCSOrgTop.y0, header->PUCSOrgTop.z0);
-        if (acad_version_number >= AC1015) fprintf (fp, "  9\n$PUCSORGBOTTOM\n 10\n%f\n 20\n%f\n 30\n%f\n", header->PUCSOrgBottom.x0, header->PUCSOrgBottom.y0, header->PUCSOrgBottom.z0);
-        if (acad_version_number >= AC1015) fprintf (fp, "  9\n$PUCSORGLEFT\n 10\n%f\n 20\n%f\n 30\n%f\n", header->PUCSOrgLeft.x0, header->PUCSOrgLeft.y0, header->PUCSOrgLeft.z0);
-        if (acad_version_number >= AC1015) fprintf (fp, "  9\n$PUCSORGRIGHT\n 10\n%f\n 20\n%f\n 30\n%f\n", header->PUCSOrgRight.x0, header->PUCSOrgRight.y0, header->PUCSOrgRight.z0);
-        if (acad_version_number >= AC1015) fprintf (fp, "  9\n$PUCSORGFRONT\n 10\n%f\n 20\n%f\n 30\n%f\n", header->PUCSOrgFront.x0, header->PUCSOrgFront.y0, header->PUCSOrgFront.z0);
-        if (acad_version_number >= AC1015) fprintf (fp, "  9\n$PUCSORGBACK\n 10\n%f\n 20\n%f\n 30\n%f\n", header->PUCSOrgBack.x0, header->PUCSOrgBack.y0, header->PUCSOrgBack.z0);
-        fprintf (fp, "  9\n$USERI1\n 70\n%i\n", header->UserI1);
-        fprintf (fp, "  9\n$USERI2\n 70\n%i\n", header->UserI2);
-        fprintf (fp, "  9\n$USERI3\n 70\n%i\n", header->UserI3);
-        fprintf (fp, "  9\n$USERI4\n 70\n%i\n", header->UserI4);
-        fprintf (fp, "  9\n$USERI5\n 70\n%i\n", header->UserI5);
-        fprintf (fp, "  9\n$USERR1\n 40\n%f\n", header->UserR1);
-        fprintf (fp, "  9\n$USERR2\n 40\n%f\n", header->UserR2);
-        fprintf (fp, "  9\n$USERR3\n 40\n%f\n", header->UserR3);
-        fprintf (fp, "  9\n$USERR4\n 40\n%f\n", header->UserR4);
-        fprintf (fp, "  9\n$USERR5\n 40\n%f\n", header->UserR5);
-        fprintf (fp, "  9\n$WORLDVIEW\n 70\n%i\n", header->WorldView);
-        fprintf (fp, "  9\n$SHADEDGE\n 70\n%i\n", header->ShadEdge);
-        fprintf (fp, "  9\n$SHADEDIF\n 70\n%i\n", header->ShadeDif);
-        fprintf (fp, "  9\n$TILEMODE\n 70\n%i\n", header->TileMode);
-        fprintf (fp, "  9\n$MAXACTVP\n 70\n%i\n", header->MaxActVP);
-        fprintf (fp, "  9\n$PINSBASE\n 10\n%f\n 20\n%f\n 30\n%f\n", header->PInsBase.x0, header->PInsBase.y0, header->PInsBase.z0);
-        fprintf (fp, "  9\n$PLIMCHECK\n 70\n%i\n", header->PLimCheck);
-        fprintf (fp, "  9\n$PEXTMIN\n 10\n%f\n 20\n%f\n 30\n%f\n", header->PExtMin.x0, header->PExtMin.y0, header->PExtMin.z0);
-        fprintf (fp, "  9\n$PEXTMAX\n 10\n%f\n 20\n%f\n 30\n%f\n", header->PExtMax.x0, header->PExtMax.y0, header->PExtMax.z0);
-        */
-        ret = dxf_header_read_parse_n_double (fp, temp_string, "$PLIMMIN",
-                                              TRUE,
-                                              2,
-                                              &header->PLimMin.x0,
-                                              &header->PLimMin.y0);
-        dxf_return(ret);
-    
-        ret = dxf_header_read_parse_n_double (fp, temp_string, "$PLIMMAX",
-                                              TRUE,
-                                              2,
-                                              &header->PLimMax.x0,
-                                              &header->PLimMax.y0);
-        dxf_return(ret);
-        /*
-        fprintf (fp, "  9\n$UNITMODE\n 70\n%i\n", header->UnitMode);
-        fprintf (fp, "  9\n$VISRETAIN\n 70\n%i\n", header->VisRetain);
-        fprintf (fp, "  9\n$PLINEGEN\n 70\n%i\n", header->PLineGen);
-        fprintf (fp, "  9\n$PSLTSCALE\n 70\n%i\n", header->PSLTScale);
-        if (acad_version_number >= AC1012) fprintf (fp, "  9\n$TREEDEPTH\n 70\n%i\n", header->TreeDepth);
-        if ((acad_version_number == AC1012) || (acad_version_number == AC1014)) fprintf (fp, "  9\n$PICKSTYLE\n 70\n%i\n", header->PickStyle);
-        if (acad_version_number >= AC1012) fprintf (fp, "  9\n$CMLSTYLE\n  2\n%s\n", header->CMLStyle);
-        if (acad_version_number >= AC1012) fprintf (fp, "  9\n$CMLJUST\n 70\n%i\n", header->CMLJust);
-        if (acad_version_number >= AC1012) fprintf (fp, "  9\n$CMLSCALE\n 40\n%f\n", header->CMLScale);
-        if (acad_version_number >= AC1014) fprintf (fp, "  9\n$PROXYGRAPHICS\n 70\n%i\n", header->ProxyGraphics);
-        if (acad_version_number >= AC1014) fprintf (fp, "  9\n$MEASUREMENT\n 70\n%i\n", header->Measurement);
-        if (acad_version_number == AC1012) fprintf (fp, "  9\n$SAVEIMAGES\n 70\n%i\n", header->SaveImages);
-        if (acad_version_number >= AC1015) fprintf (fp, "  9\n$CELWEIGHT\n370\n%i\n", header->CELWeight);
-        if (acad_version_number >= AC1015) fprintf (fp, "  9\n$ENDCAPS\n280\n%i\n", header->EndCaps);
-        if (acad_version_number >= AC1015) fprintf (fp, "  9\n$JOINSTYLE\n280\n%i\n", header->JoinStyle);
-        if (acad_version_number >= AC1015) fprintf (fp, "  9\n$LWDISPLAY\n290\n%i\n", header->LWDisplay);
-        */
-        ret = dxf_header_read_parse_int (fp, temp_string, "$INSUNITS",
-                                         &header->InsUnits,
-                                         acad_version_number >= AC1015);
-        dxf_return(ret);
-        /*
-        if (acad_version_number >= AC1015) fprintf (fp, "  9\n$HYPERLINKBASE\n  1\n%s\n", header->HyperLinkBase);
-        if (acad_version_number >= AC1015) fprintf (fp, "  9\n$STYLESHEET\n  1\n%s\n", header->StyleSheet);
-        if (acad_version_number >= AC1015) fprintf (fp, "  9\n$XEDIT\n290\n%i\n", header->XEdit);
-        if (acad_version_number >= AC1015) fprintf (fp, "  9\n$CEPSNTYPE\n380\n%i\n", header->CEPSNType);
-        if (acad_version_number >= AC1015) fprintf (fp, "  9\n$PSTYLEMODE\n290\n%i\n", header->PStyleMode);
-        if (acad_version_number >= AC1015) fprintf (fp, "  9\n$FINGERPRINTGUID\n  2\n%s\n", header->FingerPrintGUID);
-        if (acad_version_number >= AC1015) fprintf (fp, "  9\n$VERSIONGUID\n  2\n%s\n", header->VersionGUID);
-        if (acad_version_number >= AC1015) fprintf (fp, "  9\n$EXTNAMES\n290\n%i\n", header->ExtNames);
-        if (acad_version_number >= AC1015) fprintf (fp, "  9\n$PSVPSCALE\n 40\n%f\n", header->PSVPScale);
-        if (acad_version_number >= AC1015) fprintf (fp, "  9\n$OLESTARTUP\n290\n%i\n", header->OLEStartUp);
-        if (acad_version_number >= AC1018) fprintf (fp, "  9\n$SORTENTS\n280\n%i\n", header->SortEnts);
-        if (acad_version_number >= AC1018) fprintf (fp, "  9\n$INDEXCTL\n280\n%i\n", header->IndexCtl);
-        if (acad_version_number >= AC1018) fprintf (fp, "  9\n$HIDETEXT\n280\n%i\n", header->HideText);
-        if (acad_version_number >= AC1018) fprintf (fp, "  9\n$XCLIPFRAME\n290\n%i\n", header->XClipFrame);
-        if (acad_version_number >= AC1018) fprintf (fp, "  9\n$HALOGAP\n280\n%i\n", header->HaloGap);
-        if (acad_version_number >= AC1018) fprintf (fp, "  9\n$OBSCOLOR\n 70\n%i\n", header->ObsColor);
-        if (acad_version_number >= AC1018) fprintf (fp, "  9\n$OBSLTYPE\n280\n%i\n", header->ObsLType);
-        if (acad_version_number >= AC1018) fprintf (fp, "  9\n$INTERSECTIONDISPLAY\n280\n%i\n", header->InterSectionDisplay);
-        if (acad_version_number >= AC1018) fprintf (fp, "  9\n$INTERSECTIONCOLOR\n 70\n%i\n", header->InterSectionColor);
-        if (acad_version_number >= AC1018) fprintf (fp, "  9\n$DIMASSOC\n280\n%i\n", header->DimASSOC);
-        if (acad_version_number >= AC1018) fprintf (fp, "  9\n$PROJECTNAME\n  1\n%s\n", header->ProjectName);        
-*/
-        ret = dxf_header_read_parse_n_double (fp, temp_string, "$GRIDUNIT",
-                                              acad_version_number >= AC1009,
-                                              2,
-                                              &header->GridUnit.x0,
-                                              &header->GridUnit.y0);
-        dxf_return(ret);
-
-        ret = dxf_header_read_parse_int (fp, temp_string, "$GRIDMODE",
-                                         &header->GridMode,
-                                         acad_version_number >= AC1009);
-        dxf_return(ret);
+        variable = dxf_header_variable_find (temp_string);
+        if (variable == NULL)
+        {
+#if DEBUG
+                DXF_DEBUG_END
+#endif
+                return (FALSE);
+        }
+        dxf_header_read_variable (fp, header, variable);
+        if (dxf_read_error (fp))
+        {
+                return (FAIL);
+        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-       return FALSE;
+        return (FOUND);
 }
 
 /*!
@@ -1883,902 +2475,44 @@ dxf_header_read
         DXF_DEBUG_BEGIN
 #endif
 
-        char line_in[256];
         char temp_string[256];
-        int ch;
+        int group_code;
+        const char *value;
+        size_t length;
+        const DxfHeaderVariable *variable;
 
-        while((ch = fgetc(fp->fp)) != EOF)
+        while (dxf_reader_next_pair (fp, &group_code, &value, &length) == EXIT_SUCCESS)
         {
-            /* Skip whitespace */
-            if(isspace(ch))
+            if(group_code == 0)
             {
-                if(ch == '\n')
-                {
-                    fp->line_number++;
-                }
-                continue;
+                /* End of header section */
+                break;
             }
 
-            if(ch == '9')
+            if(group_code == 9)
             {
-                /* Skip to variable name */
-                while((ch = fgetc(fp->fp)) != '$')
-                {
-                    if(ch == '\n')
-                    {
-                        fp->line_number++;
-                    }
-                    continue;
-                }
-                ungetc(ch, fp->fp);
-                fgets(line_in, sizeof(line_in), fp->fp);
-                fp->line_number++;
-                sscanf(line_in, "%s", temp_string);
-                /* TODO: Match temp_string to variable name, then get
-                 * value for variable */
-                if(!strcmp(temp_string, "$ACADMAINTVER"))
-                {
-                    /* Do nothing. $ACADMAINTVER is an ignored variable */
-                    continue;
-                }
-                else if(!strcmp(temp_string, "$ACADVER"))
-                {
-                    dxf_header_get_string_variable(&header->AcadVer, fp);
-                    header->_AcadVer = dxf_header_acad_version_from_string(header->AcadVer);
-                }
-                else if(!strcmp(temp_string, "$ANGBASE"))
-                {
-                    dxf_header_get_double_variable(&header->AngBase, fp);
-                }
-                else if(!strcmp(temp_string, "$ANGDIR"))
-                {
-                    dxf_header_get_int_variable(&header->AngDir, fp);
-                }
-                else if(!strcmp(temp_string, "$ATTMODE"))
-                {
-                    dxf_header_get_int_variable(&header->AttMode, fp);
-                }
-                else if(!strcmp(temp_string, "$AUNITS"))
-                {
-                    dxf_header_get_int_variable(&header->AUnits, fp);
-                }
-                else if(!strcmp(temp_string, "$AUPREC"))
-                {
-                    dxf_header_get_int_variable(&header->AUPrec, fp);
-                }
-                else if(!strcmp(temp_string, "$CECOLOR"))
-                {
-                    dxf_header_get_int_variable(&header->CEColor, fp);
-                }
-                else if(!strcmp(temp_string, "$CELTSCALE"))
-                {
-                    dxf_header_get_double_variable(&header->CELTScale, fp);
-                }
-                else if(!strcmp(temp_string, "$CELTYPE"))
-                {
-                    dxf_header_get_string_variable(&header->CELType, fp);
-                }
-                else if(!strcmp(temp_string, "$CELWEIGHT"))
-                {
-                    dxf_header_get_int_variable(&header->CELWeight, fp);
-                }
-                else if(!strcmp(temp_string, "$CEPSNID"))
-                {
-                    dxf_header_get_string_variable(&header->CEPSNID, fp);
-                }
-                else if(!strcmp(temp_string, "$CEPSNTYPE"))
-                {
-                    dxf_header_get_int_variable(&header->CEPSNType, fp);
-                }
-                else if(!strcmp(temp_string, "$CHAMFERA"))
-                {
-                    dxf_header_get_double_variable(&header->ChamferA, fp);
-                }
-                else if(!strcmp(temp_string, "$CHAMFERB"))
-                {
-                    dxf_header_get_double_variable(&header->ChamferB, fp);
-                }
-                else if(!strcmp(temp_string, "$CHAMFER"))
-                {
-                    dxf_header_get_double_variable(&header->ChamferC, fp);
-                }
-                else if(!strcmp(temp_string, "$CHAMFERD"))
+                /* Copy the variable name */
+                while((length > 0) && isspace((unsigned char) value[length - 1]))
                 {
-                    dxf_header_get_double_variable(&header->ChamferD, fp);
+                    length--;
                 }
-                else if(!strcmp(temp_string, "$CLAYER"))
+                if(length >= sizeof(temp_string))
                 {
-                    dxf_header_get_string_variable(&header->CLayer, fp);
+                    length = sizeof(temp_string) - 1;
                 }
-                else if(!strcmp(temp_string, "$CMLJUST"))
+                memcpy(temp_string, value, length);
+                temp_string[length] = '\0';
+                variable = dxf_header_variable_find (temp_string);
+                if (variable == NULL)
                 {
-                    dxf_header_get_int_variable(&header->CMLJust, fp);
-                }
-                else if(!strcmp(temp_string, "$CMLSCALE"))
-                {
-                    dxf_header_get_double_variable(&header->CMLScale, fp);
-                }
-                else if(!strcmp(temp_string, "$CMLSTYLE"))
-                {
-                    dxf_header_get_string_variable(&header->CMLStyle, fp);
-                }
-                else if(!strcmp(temp_string, "$CSHADOW"))
-                {
-                    dxf_header_get_int16_variable(&header->CShadow, fp);
-                }
-                else if(!strcmp(temp_string, "$DIMADEC"))
-                {
-                    dxf_header_get_int_variable(&header->DimADEC, fp);
-                }
-                else if(!strcmp(temp_string, "$DIMALT"))
-                {
-                    dxf_header_get_int_variable(&header->DimALT, fp);
-                }
-                else if(!strcmp(temp_string, "$DIMALTD"))
-                {
-                    dxf_header_get_int_variable(&header->DimALTD, fp);
-                }
-                else if(!strcmp(temp_string, "$DIMALTF"))
-                {
-                    dxf_header_get_double_variable(&header->DimALTF, fp);
-                }
-                else if(!strcmp(temp_string, "$DIMALTRND"))
-                {
-                    dxf_header_get_double_variable(&header->DimALTRND, fp);
-                }
-                else if(!strcmp(temp_string, "$DIMALTTD"))
-                {
-                    dxf_header_get_int_variable(&header->DimALTTD, fp);
-                }
-                else if(!strcmp(temp_string, "$DIMALTTZ"))
-                {
-                    dxf_header_get_int_variable(&header->DimALTTZ, fp);
-                }
-                else if(!strcmp(temp_string, "$DIMALTU"))
-                {
-                    dxf_header_get_int_variable(&header->DimALTU, fp);
-                }
-                else if(!strcmp(temp_string, "$DIMALTZ"))
-                {
-                    dxf_header_get_int_variable(&header->DimALTZ, fp);
-                }
-                else if(!strcmp(temp_string, "$DIMAPOST"))
-                {
-                    dxf_header_get_string_variable(&header->DimAPOST, fp);
-                }
-                else if(!strcmp(temp_string, "$DIMASO"))
-                {
-                    dxf_header_get_int_variable(&header->DimASO, fp);
-                }
-                else if(!strcmp(temp_string, "$DIMASSOC"))
-                {
-                    dxf_header_get_int_variable(&header->DimASSOC, fp);
-                }
-                else if(!strcmp(temp_string, "$DIMASZ"))
-                {
-                    dxf_header_get_double_variable(&header->DimASZ, fp);
-                }
-                else if(!strcmp(temp_string, "$DIMATFIT"))
-                {
-                    dxf_header_get_int_variable(&header->DimATFIT, fp);
-                }
-                else if(!strcmp(temp_string, "$DIMAUNIT"))
-                {
-                    dxf_header_get_int_variable(&header->DimAUNIT, fp);
-                }
-                else if(!strcmp(temp_string, "$DIMAZIN"))
-                {
-                    dxf_header_get_int_variable(&header->DimAZIN, fp);
-                }
-                else if(!strcmp(temp_string, "$DIMBLK"))
-                {
-                    dxf_header_get_string_variable(&header->DimBLK, fp);
-                }
-                else if(!strcmp(temp_string, "$DIMBLK1"))
-                {
-                    dxf_header_get_string_variable(&header->DimBLK1, fp);
-                }
-                else if(!strcmp(temp_string, "$DIMBLK2"))
-                {
-                    dxf_header_get_string_variable(&header->DimBLK2, fp);
-                }
-                else if(!strcmp(temp_string, "$DIMCEN"))
-                {
-                    dxf_header_get_double_variable(&header->DimCEN, fp);
-                }
-                else if(!strcmp(temp_string, "$DIMCLRD"))
-                {
-                    dxf_header_get_int_variable(&header->DimCLRD, fp);
-                }
-                else if(!strcmp(temp_string, "$DIMCLRE"))
-                {
-                    dxf_header_get_int_variable(&header->DimCLRE, fp);
-                }
-                else if(!strcmp(temp_string, "$DIMCLRT"))
-                {
-                    dxf_header_get_int_variable(&header->DimCLRT, fp);
-                }
-                else if(!strcmp(temp_string, "$DIMDEC"))
-                {
-                    dxf_header_get_int_variable(&header->DimDEC, fp);
-                }
-                else if(!strcmp(temp_string, "$DIMDLE"))
-                {
-                    dxf_header_get_double_variable(&header->DimDLE, fp);
-                }
-                else if(!strcmp(temp_string, "$DIMDLI"))
-                {
-                    dxf_header_get_double_variable(&header->DimDLI, fp);
-                }
-                else if(!strcmp(temp_string, "$DIMDSEP"))
-                {
-                    dxf_header_get_int_variable(&header->DimDSEP, fp);
-                }
-                else if(!strcmp(temp_string, "$DIMEXE"))
-                {
-                    dxf_header_get_double_variable(&header->DimEXE, fp);
-                }
-                else if(!strcmp(temp_string, "$DIMEXO"))
-                {
-                    dxf_header_get_double_variable(&header->DimEXO, fp);
-                }
-                else if(!strcmp(temp_string, "$DIMFAC"))
-                {
-                    dxf_header_get_double_variable(&header->DimFAC, fp);
-                }
-                else if(!strcmp(temp_string, "$DIMGAP"))
-                {
-                    dxf_header_get_double_variable(&header->DimGAP, fp);
-                }
-                else if(!strcmp(temp_string, "$DIMJUST"))
-                {
-                    dxf_header_get_int_variable(&header->DimJUST, fp);
-                }
-                else if(!strcmp(temp_string, "$DIMLDRBLK"))
-                {
-                    dxf_header_get_string_variable(&header->DimLDRBLK, fp);
-                }
-                else if(!strcmp(temp_string, "$DIMLFAC"))
-                {
-                    dxf_header_get_double_variable(&header->DimLFAC, fp);
-                }
-                else if(!strcmp(temp_string, "$DIMLIM"))
-                {
-                    dxf_header_get_int_variable(&header->DimLIM, fp);
-                }
-                else if(!strcmp(temp_string, "$DIMLUNIT"))
-                {
-                    dxf_header_get_int_variable(&header->DimLUNIT, fp);
-                }
-                else if(!strcmp(temp_string, "$DIMLWD"))
-                {
-                    dxf_header_get_int_variable(&header->DimLWD, fp);
-                }
-                else if(!strcmp(temp_string, "$DIMLWE"))
-                {
-                    dxf_header_get_int_variable(&header->DimLWE, fp);
-                }
-                else if(!strcmp(temp_string, "$DIMPOST"))
-                {
-                    dxf_header_get_string_variable(&header->DimPOST, fp);
-                }
-                else if(!strcmp(temp_string, "$DIMRND"))
-                {
-                    dxf_header_get_double_variable(&header->DimRND, fp);
-                }
-                else if(!strcmp(temp_string, "$DIMSAH"))
-                {
-                    dxf_header_get_int_variable(&header->DimSAH, fp);
-                }
-                else if(!strcmp(temp_string, "$DIMSCALE"))
-                {
-                    dxf_header_get_double_variable(&header->DimSCALE, fp);
-                }
-                else if(!strcmp(temp_string, "$DIMSD1"))
-                {
-                    dxf_header_get_int_variable(&header->DimSD1, fp);
-                }
-                else if(!strcmp(temp_string, "$DIMSD2"))
-                {
-                    dxf_header_get_int_variable(&header->DimSD2, fp);
-                }
-                else if(!strcmp(temp_string, "$DIMSE1"))
-                {
-                    dxf_header_get_int_variable(&header->DimSE1, fp);
-                }
-                else if(!strcmp(temp_string, "$DIMSE2"))
-                {
-                    dxf_header_get_int_variable(&header->DimSE2, fp);
-                }
-                else if(!strcmp(temp_string, "$DIMSHO"))
-                {
-                    dxf_header_get_int_variable(&header->DimSHO, fp);
-                }
-                else if(!strcmp(temp_string, "$DIMSOXD"))
-                {
-                    dxf_header_get_int_variable(&header->DimSOXD, fp);
-                }
-                else if(!strcmp(temp_string, "$DIMSTYLE"))
-                {
-                    dxf_header_get_string_variable(&header->DimSTYLE, fp);
-                }
-                else if(!strcmp(temp_string, "$DIMTAD"))
-                {
-                    dxf_header_get_int_variable(&header->DimTAD, fp);
-                }
-                else if(!strcmp(temp_string, "$DIMTDEC"))
-                {
-                    dxf_header_get_int_variable(&header->DimTDEC, fp);
-                }
-                else if(!strcmp(temp_string, "$DIMTFAC"))
-                {
-                    dxf_header_get_double_variable(&header->DimTFAC, fp);
-                }
-                else if(!strcmp(temp_string, "$DIMTIH"))
-                {
-                    dxf_header_get_int_variable(&header->DimTIH, fp);
-                }
-                else if(!strcmp(temp_string, "$DIMTIX"))
-                {
-                    dxf_header_get_int_variable(&header->DimTIX, fp);
-                }
-                else if(!strcmp(temp_string, "$DIMTM"))
-                {
-                    dxf_header_get_double_variable(&header->DimTM, fp);
-                }
-                else if(!strcmp(temp_string, "$DIMTMOVE"))
-                {
-                    dxf_header_get_int_variable(&header->DimTMOVE, fp);
-                }
-                else if(!strcmp(temp_string, "$DIMTOFL"))
-                {
-                    dxf_header_get_int_variable(&header->DimTOFL, fp);
-                }
-                else if(!strcmp(temp_string, "$DIMTOH"))
-                {
-                    dxf_header_get_int_variable(&header->DimTOH, fp);
-                }
-                else if(!strcmp(temp_string, "$DIMTOL"))
-                {
-                    dxf_header_get_int_variable(&header->DimTOL, fp);
-                }
-                else if(!strcmp(temp_string, "$DIMTOLJ"))
-                {
-                    dxf_header_get_int_variable(&header->DimTOLJ, fp);
-                }
-                else if(!strcmp(temp_string, "$DIMTP"))
-                {
-                    dxf_header_get_double_variable(&header->DimTP, fp);
-                }
-                else if(!strcmp(temp_string, "$DIMTSZ"))
-                {
-                    dxf_header_get_double_variable(&header->DimTSZ, fp);
-                }
-                else if(!strcmp(temp_string, "$DIMTVP"))
-                {
-                    dxf_header_get_double_variable(&header->DimTVP, fp);
-                }
-                else if(!strcmp(temp_string, "$DIMTXSTY"))
-                {
-                    dxf_header_get_string_variable(&header->DimTXSTY, fp);
-                }
-                else if(!strcmp(temp_string, "$DIMTXT"))
-                {
-                    dxf_header_get_double_variable(&header->DimTXT, fp);
-                }
-                else if(!strcmp(temp_string, "$DIMTZIN"))
-                {
-                    dxf_header_get_int_variable(&header->DimTZIN, fp);
-                }
-                else if(!strcmp(temp_string, "$DIMUPT"))
-                {
-                    dxf_header_get_int_variable(&header->DimUPT, fp);
-                }
-                else if(!strcmp(temp_string, "$DIMZIN"))
-                {
-                    dxf_header_get_int_variable(&header->DimZIN, fp);
-                }
-                else if(!strcmp(temp_string, "$DISPSILH"))
-                {
-                    dxf_header_get_int_variable(&header->DispSilH, fp);
-                }
-                else if(!strcmp(temp_string, "$DRAGVS"))
-                {
-                    dxf_header_get_string_variable(&header->DragVS, fp);
-                }
-                else if(!strcmp(temp_string, "$DWGCODEPAGE"))
-                {
-                    dxf_header_get_string_variable(&header->DWGCodePage, fp);
-                }
-                else if(!strcmp(temp_string, "$ELEVATION"))
-                {
-                    dxf_header_get_double_variable(&header->Elevation, fp);
-                }
-                else if(!strcmp(temp_string, "$ENDCAPS"))
-                {
-                    dxf_header_get_int_variable(&header->EndCaps, fp);
-                }
-                else if(!strcmp(temp_string, "$EXTMAX"))
-                {
-                    dxf_header_get_dxf_point_variable(&header->ExtMax, fp);
-                }
-                else if(!strcmp(temp_string, "$EXTMIN"))
-                {
-                    dxf_header_get_dxf_point_variable(&header->ExtMin, fp);
-                }
-                else if(!strcmp(temp_string, "$EXTNAMES"))
-                {
-                    dxf_header_get_int_variable(&header->ExtNames, fp);
-                }
-                else if(!strcmp(temp_string, "$FILLETRAD"))
-                {
-                    dxf_header_get_double_variable(&header->FilletRad, fp);
-                }
-                else if(!strcmp(temp_string, "$FILLMODE"))
-                {
-                    dxf_header_get_int_variable(&header->FillMode, fp);
-                }
-                else if(!strcmp(temp_string, "$FINGERPRINTGUID"))
-                {
-                    dxf_header_get_string_variable(&header->FingerPrintGUID, fp);
-                }
-                else if(!strcmp(temp_string, "$HALOGAP"))
-                {
-                    dxf_header_get_int_variable(&header->HaloGap, fp);
-                }
-                else if(!strcmp(temp_string, "$HANDSEED"))
-                {
-                    dxf_header_get_string_variable(&header->HandSeed, fp);
-                }
-                else if(!strcmp(temp_string, "$HIDETEXT"))
-                {
-                    dxf_header_get_int_variable(&header->HideText, fp);
-                }
-                else if(!strcmp(temp_string, "$HYPERLINKBASE"))
-                {
-                    dxf_header_get_string_variable(&header->HyperLinkBase, fp);
-                }
-                else if(!strcmp(temp_string, "$INDEXCTL"))
-                {
-                    dxf_header_get_int_variable(&header->IndexCtl, fp);
-                }
-                else if(!strcmp(temp_string, "$INSBASE"))
-                {
-                    dxf_header_get_dxf_point_variable(&header->InsBase, fp);
-                }
-                else if(!strcmp(temp_string, "$INSUNITS"))
-                {
-                    dxf_header_get_int_variable(&header->InsUnits, fp);
-                }
-                else if(!strcmp(temp_string, "$INTERFERECOLOR"))
-                {
-                    dxf_header_get_int16_variable(&header->InterfereColor, fp);
-                }
-                else if(!strcmp(temp_string, "$INTERFEREOBJVS"))
-                {
-                    dxf_header_get_string_variable(&header->InterfereObjVS, fp);
-                }
-                else if(!strcmp(temp_string, "$INTERFEREVPVS"))
-                {
-                    dxf_header_get_string_variable(&header->InterfereVPVS, fp);
-                }
-                else if(!strcmp(temp_string, "$INTERSECTIONCOLOR"))
-                {
-                    dxf_header_get_int_variable(&header->InterSectionColor, fp);
-                }
-                else if(!strcmp(temp_string, "$INTERSECTIONDISPLAY"))
-                {
-                    dxf_header_get_int_variable(&header->InterSectionDisplay, fp);
-                }
-                else if(!strcmp(temp_string, "$JOINSTYLE"))
-                {
-                    dxf_header_get_int_variable(&header->JoinStyle, fp);
-                }
-                else if(!strcmp(temp_string, "$LIMCHECK"))
-                {
-                    dxf_header_get_int_variable(&header->LimCheck, fp);
-                }
-                else if(!strcmp(temp_string, "$LIMMAX"))
-                {
-                    dxf_header_get_dxf_point_variable(&header->LimMax, fp);
-                }
-                else if(!strcmp(temp_string, "$LIMMIN"))
-                {
-                    dxf_header_get_dxf_point_variable(&header->LimMin, fp);
-                }
-                else if(!strcmp(temp_string, "$LTSCALE"))
-                {
-                    dxf_header_get_double_variable(&header->LTScale, fp);
-                }
-                else if(!strcmp(temp_string, "$LUNITS"))
-                {
-                    dxf_header_get_int_variable(&header->LUnits, fp);
-                }
-                else if(!strcmp(temp_string, "$LUPREC"))
-                {
-                    dxf_header_get_int_variable(&header->LUPrec, fp);
-                }
-                else if(!strcmp(temp_string, "$LWDISPLAY"))
-                {
-                    dxf_header_get_int_variable(&header->LWDisplay, fp);
-                }
-                else if(!strcmp(temp_string, "$MAXACTVP"))
-                {
-                    dxf_header_get_int_variable(&header->MaxActVP, fp);
-                }
-                else if(!strcmp(temp_string, "$MEASUREMENT"))
-                {
-                    dxf_header_get_int_variable(&header->Measurement, fp);
-                }
-                else if(!strcmp(temp_string, "$MENU"))
-                {
-                    dxf_header_get_string_variable(&header->Menu, fp);
-                }
-                else if(!strcmp(temp_string, "$OBSCOLOR"))
-                {
-                    dxf_header_get_int_variable(&header->ObsColor, fp);
-                }
-                else if(!strcmp(temp_string, "$OBSLTYPE"))
-                {
-                    dxf_header_get_int_variable(&header->ObsLType, fp);
-                }
-                else if(!strcmp(temp_string, "$ORTHOMODE"))
-                {
-                    dxf_header_get_int_variable(&header->OrthoMode, fp);
-                }
-                else if(!strcmp(temp_string, "$PDMODE"))
-                {
-                    dxf_header_get_int_variable(&header->PDMode, fp);
-                }
-                else if(!strcmp(temp_string, "$PDSIZE"))
-                {
-                    dxf_header_get_double_variable(&header->PDSize, fp);
-                }
-                else if(!strcmp(temp_string, "$PELEVATION"))
-                {
-                    dxf_header_get_double_variable(&header->PElevation, fp);
-                }
-                else if(!strcmp(temp_string, "$PEXTMAX"))
-                {
-                    dxf_header_get_dxf_point_variable(&header->PExtMax, fp);
-                }
-                else if(!strcmp(temp_string, "$PEXTMIN"))
-                {
-                    dxf_header_get_dxf_point_variable(&header->PExtMin, fp);
-                }
-                else if(!strcmp(temp_string, "$PINSBASE"))
-                {
-                    dxf_header_get_dxf_point_variable(&header->PInsBase, fp);
-                }
-                else if(!strcmp(temp_string, "$PLIMCHECK"))
-                {
-                    dxf_header_get_int_variable(&header->PLimCheck, fp);
-                }
-                else if(!strcmp(temp_string, "$PLIMMAX"))
-                {
-                    dxf_header_get_dxf_point_variable(&header->PLimMax, fp);
-                }
-                else if(!strcmp(temp_string, "$PLIMMIN"))
-                {
-                    dxf_header_get_dxf_point_variable(&header->PLimMin, fp);
-                }
-                else if(!strcmp(temp_string, "$PLINEGEN"))
-                {
-                    dxf_header_get_int_variable(&header->PLineGen, fp);
-                }
-                else if(!strcmp(temp_string, "$PLINEWID"))
-                {
-                    dxf_header_get_double_variable(&header->PLineWid, fp);
-                }
-                else if(!strcmp(temp_string, "$PROJECTNAME"))
-                {
-                    dxf_header_get_string_variable(&header->ProjectName, fp);
-                }
-                else if(!strcmp(temp_string, "$PROXYGRAPHICS"))
-                {
-                    dxf_header_get_int_variable(&header->ProxyGraphics, fp);
-                }
-                else if(!strcmp(temp_string, "$PSLTSCALE"))
-                {
-                    dxf_header_get_int_variable(&header->PSLTScale, fp);
-                }
-                else if(!strcmp(temp_string, "$PSTYLEMODE"))
-                {
-                    dxf_header_get_int_variable(&header->PStyleMode, fp);
-                }
-                else if(!strcmp(temp_string, "$PSVPSCALE"))
-                {
-                    dxf_header_get_double_variable(&header->PSVPScale, fp);
-                }
-                else if(!strcmp(temp_string, "$PUCSBASE"))
-                {
-                    dxf_header_get_string_variable(&header->PUCSBase, fp);
-                }
-                else if(!strcmp(temp_string, "$PUCSNAME"))
-                {
-                    dxf_header_get_string_variable(&header->PUCSName, fp);
-                }
-                else if(!strcmp(temp_string, "$PUCSORG"))
-                {
-                    dxf_header_get_dxf_point_variable(&header->PUCSOrg, fp);
-                }
-                else if(!strcmp(temp_string, "$PUCSORGBACK"))
-                {
-                    dxf_header_get_dxf_point_variable(&header->PUCSOrgBack, fp);
-                }
-                else if(!strcmp(temp_string, "$PUCSORGBOTTOM"))
-                {
-                    dxf_header_get_dxf_point_variable(&header->PUCSOrgBottom, fp);
-                }
-                else if(!strcmp(temp_string, "$PUCSORGFRONT"))
-                {
-                    dxf_header_get_dxf_point_variable(&header->PUCSOrgFront, fp);
-                }
-                else if(!strcmp(temp_string, "$PUCSORGLEFT"))
-                {
-                    dxf_header_get_dxf_point_variable(&header->PUCSOrgLeft, fp);
-                }
-                else if(!strcmp(temp_string, "$PUCSORGRIGHT"))
-                {
-                    dxf_header_get_dxf_point_variable(&header->PUCSOrgRight, fp);
-                }
-                else if(!strcmp(temp_string, "$PUCSORGTOP"))
-                {
-                    dxf_header_get_dxf_point_variable(&header->PUCSOrgTop, fp);
-                }
-                else if(!strcmp(temp_string, "$PUCSORTHOREF"))
-                {
-                    dxf_header_get_string_variable(&header->PUCSOrthoRef, fp);
-                }
-                else if(!strcmp(temp_string, "$PUCSORTHOVIEW"))
-                {
-                    dxf_header_get_int_variable(&header->PUCSOrthoView, fp);
-                }
-                else if(!strcmp(temp_string, "$PUCSXDIR"))
-                {
-                    dxf_header_get_dxf_point_variable(&header->PUCSXDir, fp);
-                }
-                else if(!strcmp(temp_string, "$PUCSYDIR"))
-                {
-                    dxf_header_get_dxf_point_variable(&header->PUCSYDir, fp);
-                }
-                else if(!strcmp(temp_string, "$QTEXTMODE"))
-                {
-                    dxf_header_get_int_variable(&header->QTextMode, fp);
-                }
-                else if(!strcmp(temp_string, "$REGENMODE"))
-                {
-                    dxf_header_get_int_variable(&header->RegenMode, fp);
-                }
-                else if(!strcmp(temp_string, "$SHADEEDGE"))
-                {
-                    dxf_header_get_int_variable(&header->ShadEdge, fp);
-                }
-                else if(!strcmp(temp_string, "$SHADEDIF"))
-                {
-                    dxf_header_get_int_variable(&header->ShadeDif, fp);
-                }
-                else if(!strcmp(temp_string, "$SHADOWPLANELOCATION"))
-                {
-                    dxf_header_get_double_variable(&header->ShadowPlaneLocation, fp);
-                }
-                else if(!strcmp(temp_string, "$SKETCHINC"))
-                {
-                    dxf_header_get_double_variable(&header->Sketchinc, fp);
-                }
-                else if(!strcmp(temp_string, "$SKPOLY"))
-                {
-                    dxf_header_get_int_variable(&header->SKPoly, fp);
-                }
-                else if(!strcmp(temp_string, "$SORTENTS"))
-                {
-                    dxf_header_get_int_variable(&header->SortEnts, fp);
-                }
-                else if(!strcmp(temp_string, "$SPLINESEGS"))
-                {
-                    dxf_header_get_int_variable(&header->SPLineSegs, fp);
-                }
-                else if(!strcmp(temp_string, "$SPLINETYPE"))
-                {
-                    dxf_header_get_int_variable(&header->SPLineType, fp);
-                }
-                else if(!strcmp(temp_string, "$SURFTAB1"))
-                {
-                    dxf_header_get_int_variable(&header->SurfTab1, fp);
-                }
-                else if(!strcmp(temp_string, "$SURFTAB2"))
-                {
-                    dxf_header_get_int_variable(&header->SurfTab2, fp);
-                }
-                else if(!strcmp(temp_string, "$SURFTYPE"))
-                {
-                    dxf_header_get_int_variable(&header->SurfType, fp);
-                }
-                else if(!strcmp(temp_string, "$SURFU"))
-                {
-                    dxf_header_get_int_variable(&header->SurfU, fp);
-                }
-                else if(!strcmp(temp_string, "$SURFV"))
-                {
-                    dxf_header_get_int_variable(&header->SurfV, fp);
-                }
-                else if(!strcmp(temp_string, "$TDCREATE"))
-                {
-                    dxf_header_get_double_variable(&header->TDCreate, fp);
-                }
-                else if(!strcmp(temp_string, "$TDINDWG"))
-                {
-                    dxf_header_get_double_variable(&header->TDInDWG, fp);
-                }
-                else if(!strcmp(temp_string, "$TDUCREATE"))
-                {
-                    dxf_header_get_double_variable(&header->TDUCreate, fp);
-                }
-                else if(!strcmp(temp_string, "$TDUPDATE"))
-                {
-                    dxf_header_get_double_variable(&header->TDUpdate, fp);
-                }
-                else if(!strcmp(temp_string, "$TDUSRTIMER"))
-                {
-                    dxf_header_get_double_variable(&header->TDUSRTimer, fp);
-                }
-                else if(!strcmp(temp_string, "$TDUUPDATE"))
-                {
-                    dxf_header_get_double_variable(&header->TDUpdate, fp);
-                }
-                else if(!strcmp(temp_string, "$TEXTSIZE"))
-                {
-                    dxf_header_get_double_variable(&header->TextSize, fp);
-                }
-                else if(!strcmp(temp_string, "$TEXTSTYLE"))
-                {
-                    dxf_header_get_string_variable(&header->TextStyle, fp);
-                }
-                else if(!strcmp(temp_string, "$THICKNESS"))
-                {
-                    dxf_header_get_double_variable(&header->Thickness, fp);
-                }
-                else if(!strcmp(temp_string, "$TILEMODE"))
-                {
-                    dxf_header_get_int_variable(&header->TileMode, fp);
-                }
-                else if(!strcmp(temp_string, "$TRACEWID"))
-                {
-                    dxf_header_get_double_variable(&header->TraceWid, fp);
-                }
-                else if(!strcmp(temp_string, "$TREEDEPTH"))
-                {
-                    dxf_header_get_int_variable(&header->TreeDepth, fp);
-                }
-                else if(!strcmp(temp_string, "$UCSBASE"))
-                {
-                    dxf_header_get_string_variable(&header->UCSBase, fp);
-                }
-                else if(!strcmp(temp_string, "$UCSNAME"))
-                {
-                    dxf_header_get_string_variable(&header->UCSName, fp);
-                }
-                else if(!strcmp(temp_string, "$UCSORG"))
-                {
-                    dxf_header_get_dxf_point_variable(&header->UCSOrg, fp);
-                }
-                else if(!strcmp(temp_string, "$UCSORGBACK"))
-                {
-                    dxf_header_get_dxf_point_variable(&header->UCSOrgBack, fp);
-                }
-                else if(!strcmp(temp_string, "$UCSORGBOTTOM"))
-                {
-                    dxf_header_get_dxf_point_variable(&header->UCSOrgBottom, fp);
-                }
-                else if(!strcmp(temp_string, "$UCSORGFRONT"))
-                {
-                    dxf_header_get_dxf_point_variable(&header->UCSOrgFront, fp);
-                }
-                else if(!strcmp(temp_string, "$UCSORGLEFT"))
-                {
-                    dxf_header_get_dxf_point_variable(&header->UCSOrgLeft, fp);
-                }
-                else if(!strcmp(temp_string, "$UCSORGRIGHT"))
-                {
-                    dxf_header_get_dxf_point_variable(&header->UCSOrgRight, fp);
-                }
-                else if(!strcmp(temp_string, "$UCSORGTOP"))
-                {
-                    dxf_header_get_dxf_point_variable(&header->UCSOrgTop, fp);
-                }
-                else if(!strcmp(temp_string, "$UCSORTHOREF"))
-                {
-                    dxf_header_get_string_variable(&header->UCSOrthoRef, fp);
-                }
-                else if(!strcmp(temp_string, "$UCSORTHOVIEW"))
-                {
-                    dxf_header_get_int_variable(&header->UCSOrthoView, fp);
-                }
-                else if(!strcmp(temp_string, "$UCSXDIR"))
-                {
-                    dxf_header_get_dxf_point_variable(&header->UCSXDir, fp);
-                }
-                else if(!strcmp(temp_string, "$UCSYDIR"))
-                {
-                    dxf_header_get_dxf_point_variable(&header->UCSYDir, fp);
-                }
-                else if(!strcmp(temp_string, "$UNITMODE"))
-                {
-                    dxf_header_get_int_variable(&header->UnitMode, fp);
-                }
-                else if(!strcmp(temp_string, "$USERI1"))
-                {
-                    dxf_header_get_int_variable(&header->UserI1, fp);
-                }
-                else if(!strcmp(temp_string, "$USERI2"))
-                {
-                    dxf_header_get_int_variable(&header->UserI2, fp);
-                }
-                else if(!strcmp(temp_string, "$USERI3"))
-                {
-                    dxf_header_get_int_variable(&header->UserI3, fp);
-                }
-                else if(!strcmp(temp_string, "$USERI4"))
-                {
-                    dxf_header_get_int_variable(&header->UserI4, fp);
-                }
-                else if(!strcmp(temp_string, "$USERI5"))
-                {
-                    dxf_header_get_int_variable(&header->UserI5, fp);
-                }
-                else if(!strcmp(temp_string, "$USERR1"))
-                {
-                    dxf_header_get_double_variable(&header->UserR1, fp);
-                }
-                else if(!strcmp(temp_string, "$USERR2"))
-                {
-                    dxf_header_get_double_variable(&header->UserR2, fp);
-                }
-                else if(!strcmp(temp_string, "$USERR3"))
-                {
-                    dxf_header_get_double_variable(&header->UserR3, fp);
-                }
-                else if(!strcmp(temp_string, "$USERR4"))
-                {
-                    dxf_header_get_double_variable(&header->UserR4, fp);
-                }
-                else if(!strcmp(temp_string, "$USERR5"))
-                {
-                    dxf_header_get_double_variable(&header->UserR5, fp);
-                }
-                else if(!strcmp(temp_string, "$USRTIMER"))
-                {
-                    dxf_header_get_int_variable(&header->USRTimer, fp);
-                }
-                else if(!strcmp(temp_string, "$VERSIONGUID"))
-                {
-                    dxf_header_get_string_variable(&header->VersionGUID, fp);
-                }
-                else if(!strcmp(temp_string, "$VISRETAIN"))
-                {
-                    dxf_header_get_int_variable(&header->VisRetain, fp);
-                }
-                else if(!strcmp(temp_string, "$WORLDVIEW"))
-                {
-                    dxf_header_get_int_variable(&header->WorldView, fp);
-                }
-                else if(!strcmp(temp_string, "$XCLIPFRAME"))
-                {
-                    dxf_header_get_int_variable(&header->XClipFrame, fp);
-                }
-                else if(!strcmp(temp_string, "$XEDIT"))
-                {
-                    dxf_header_get_int_variable(&header->XEdit, fp);
-                }
-                else
-                {
-                    fprintf(stderr, (_("Warning in %s () unknown variable name: %s\n"
-                                       "File: %s\n"
-                                       "Line: %d\n")),
-                            __FUNCTION__, temp_string,
-                            fp->filename, fp->line_number);
-                    continue;
+                    fprintf(stderr, (_("Warning in %s () unknown variable name: %s\n"
+                                       "File: %s\n"
+                                       "Line: %d\n")),
+                            __FUNCTION__, temp_string,
+                            fp->filename, fp->line_number);
+                    continue;
                 }
+                dxf_header_read_variable (fp, header, variable);
                 /* TODO: Investigate overflow risk of member
                  * variables stored as an int, but that can have up
                  * to sixteen hexadecimal digits (64 bits) */
@@ -2791,12 +2525,6 @@ dxf_header_read
                  * specifications more recent than 2012. */
 
             }
-
-            if(ch == '0')
-            {
-                /* End of header section */
-                break;
-            }
         }
 
 #if DEBUG
@@ -2837,32 +2565,32 @@ dxf_header_free
                   __FUNCTION__);
                 return (header);
         }
-        free (header->AcadVer);
-        free (header->DWGCodePage);
+        dxf_free (header->AcadVer);
+        dxf_free (header->DWGCodePage);
 //        dxf_point_free ((struct DxfPoint) header->InsBase);
 //        dxf_point_free ((struct DxfPoint) header->ExtMin);
 //        dxf_point_free ((struct DxfPoint) header->ExtMax);
 //        dxf_point_free ((struct DxfPoint) header->LimMin);
 //        dxf_point_free ((struct DxfPoint) header->LimMax);
-        free (header->TextStyle);
-        free (header->CLayer);
-        free (header->CELType);
-        free (header->DimBLK);
-        free (header->DimPOST);
-        free (header->DimAPOST);
-        free (header->DimBLK1);
-        free (header->DimBLK2);
-        free (header->DimSTYLE);
-        free (header->DimTXSTY);
-        free (header->DimLDRBLK);
-        free (header->Menu);
-        free (header->HandSeed);
-        free (header->UCSBase);
-        free (header->UCSName);
+        dxf_free (header->TextStyle);
+        dxf_free (header->CLayer);
+        dxf_free (header->CELType);
+        dxf_free (header->DimBLK);
+        dxf_free (header->DimPOST);
+        dxf_free (header->DimAPOST);
+        dxf_free (header->DimBLK1);
+        dxf_free (header->DimBLK2);
+        dxf_free (header->DimSTYLE);
+        dxf_free (header->DimTXSTY);
+        dxf_free (header->DimLDRBLK);
+        dxf_free (header->Menu);
+        dxf_free (header->HandSeed);
+        dxf_free (header->UCSBase);
+        dxf_free (header->UCSName);
 //        dxf_point_free ((struct DxfPoint) header->UCSOrg);
 //        dxf_point_free ((struct DxfPoint) header->UCSXDir);
 //        dxf_point_free ((struct DxfPoint) header->UCSYDir);
-        free (header->UCSOrthoRef);
+        dxf_free (header->UCSOrthoRef);
 //        dxf_point_free ((struct DxfPoint) header->UCSOrgTop);
 //        dxf_point_free ((struct DxfPoint) header->UCSOrgBottom);
 //        dxf_point_free ((struct DxfPoint) header->UCSOrgLeft);
@@ -2872,7 +2600,7 @@ dxf_header_free
 //        dxf_point_free ((struct DxfPoint) header->PUCSOrg);
 //        dxf_point_free ((struct DxfPoint) header->PUCSXDir);
 //        dxf_point_free ((struct DxfPoint) header->PUCSYDir);
-        free (header->PUCSOrthoRef);
+        dxf_free (header->PUCSOrthoRef);
 //        dxf_point_free ((struct DxfPoint) header->PUCSOrgTop);
 //        dxf_point_free ((struct DxfPoint) header->PUCSOrgBottom);
 //        dxf_point_free ((struct DxfPoint) header->PUCSOrgLeft);
@@ -2884,13 +2612,13 @@ dxf_header_free
 //        dxf_point_free ((struct DxfPoint) header->PExtMax);
 //        dxf_point_free ((struct DxfPoint) header->PLimMin);
 //        dxf_point_free ((struct DxfPoint) header->PLimMax);
-        free (header->CMLStyle);
-        free (header->HyperLinkBase);
-        free (header->StyleSheet);
-        free (header->FingerPrintGUID);
-        free (header->VersionGUID);
-        free (header->ProjectName);
-        free (header);
+        dxf_free (header->CMLStyle);
+        dxf_free (header->HyperLinkBase);
+        dxf_free (header->StyleSheet);
+        dxf_free (header->FingerPrintGUID);
+        dxf_free (header->VersionGUID);
+        dxf_free (header->ProjectName);
+        dxf_free (header);
 #ifdef DEBUG
         DXF_DEBUG_END
 #endif
@@ -2910,74 +2638,12 @@ dxf_header_get_int_variable
         /*!< DXF file handle of input file (or device)  */
 )
 {
-        int ch;
-        while((ch = fgetc(fp->fp)) != EOF)
-        {
-                /* Skip whitespace */
-                if(ch == '\n')
-                {
-                        fp->line_number++;
-                        continue;
-                }
-                else if(isspace(ch))
-                {
-                        continue;
-                }
-                else if(isdigit(ch))
-                {
-                        ungetc(ch, fp->fp);
-                        char line_in[64] = {};
-                        int group_code;
-                        /* Get the group code. This will, for now at least, be ignored. */
-                        fgets(line_in, sizeof(line_in), fp->fp);
-                        sscanf(line_in, "%d", &group_code);
-                        break;
-                }
-                else
-                {
-                        ungetc(ch, fp->fp);
-                        char line_in[64] = {};
-                        fgets(line_in, sizeof(line_in), fp->fp);
-                        fprintf(stderr, (_("Warning in %s () unknown input: %s"
-                                           "File: %s\n"
-                                           "Line: %d\n")),
-                                __FUNCTION__, line_in, fp->filename, fp->line_number);
-                        fp->line_number++;
-                }
-        }
+        char temp_string[DXF_MAX_STRING_LENGTH];
 
-        while((ch = fgetc(fp->fp)) != EOF)
-        {
-                /* Skip whitespace */
-                if(ch == '\n')
-                {
-                        fp->line_number++;
-                }
-                else if(isspace(ch))
-                {
-                        continue;
-                }
-                else if(isdigit(ch))
-                {
-                        /* Store the variable value in the result */
-                        ungetc(ch, fp->fp);
-                        char line_in[64] = {};
-                        fgets(line_in, sizeof(line_in), fp->fp);
-                        sscanf(line_in, "%d", res);
-                        break;
-                }
-                else
-                {
-                        ungetc(ch, fp->fp);
-                        char line_in[64] = {};
-                        fgets(line_in, sizeof(line_in), fp->fp);
-                        fprintf(stderr, (_("Warning in %s () unknown input: %s"
-                                           "File: %s\n"
-                                           "Line: %d\n")),
-                                __FUNCTION__, line_in, fp->filename, fp->line_number);
-                        fp->line_number++;
-                }
-        }
+        /* Get the group code. This will, for now at least, be ignored. */
+        dxf_read_line (temp_string, fp);
+        /* Store the variable value in the result */
+        dxf_read_int (fp, res);
 }
 
 /*!
@@ -2993,74 +2659,12 @@ dxf_header_get_int16_variable
         /*!< DXF file handle of input file (or device)  */
 )
 {
-        int ch;
-        while((ch = fgetc(fp->fp)) != EOF)
-        {
-                /* Skip whitespace */
-                if(ch == '\n')
-                {
-                        fp->line_number++;
-                        continue;
-                }
-                else if(isspace(ch))
-                {
-                        continue;
-                }
-                else if(isdigit(ch))
-                {
-                        ungetc(ch, fp->fp);
-                        char line_in[64] = {};
-                        int group_code;
-                        /* Get the group code. This will, for now at least, be ignored. */
-                        fgets(line_in, sizeof(line_in), fp->fp);
-                        sscanf(line_in, "%d", &group_code);
-                        break;
-                }
-                else
-                {
-                        ungetc(ch, fp->fp);
-                        char line_in[64] = {};
-                        fgets(line_in, sizeof(line_in), fp->fp);
-                        fprintf(stderr, (_("Warning in %s () unknown input: %s"
-                                           "File: %s\n"
-                                           "Line: %d\n")),
-                                __FUNCTION__, line_in, fp->filename, fp->line_number);
-                        fp->line_number++;
-                }
-        }
+        char temp_string[DXF_MAX_STRING_LENGTH];
 
-        while((ch = fgetc(fp->fp)) != EOF)
-        {
-                /* Skip whitespace */
-                if(ch == '\n')
-                {
-                        fp->line_number++;
-                }
-                else if(isspace(ch))
-                {
-                        continue;
-                }
-                else if(isdigit(ch))
-                {
-                        /* Store the variable value in the result */
-                        ungetc(ch, fp->fp);
-                        char line_in[64] = {};
-                        fgets(line_in, sizeof(line_in), fp->fp);
-                        sscanf(line_in, "%" SCNd16, res);
-                        break;
-                }
-                else
-                {
-                        ungetc(ch, fp->fp);
-                        char line_in[64] = {};
-                        fgets(line_in, sizeof(line_in), fp->fp);
-                        fprintf(stderr, (_("Warning in %s () unknown input: %s"
-                                           "File: %s\n"
-                                           "Line: %d\n")),
-                                __FUNCTION__, line_in, fp->filename, fp->line_number);
-                        fp->line_number++;
-                }
-        }
+        /* Get the group code. This will, for now at least, be ignored. */
+        dxf_read_line (temp_string, fp);
+        /* Store the variable value in the result */
+        dxf_read_int16 (fp, res);
 }
 
 /*!
@@ -3077,74 +2681,12 @@ dxf_header_get_double_variable
         /*!< DXF file handle of input file (or device)  */
 )
 {
-        int ch;
-        while((ch = fgetc(fp->fp)) != EOF)
-        {
-                /* Skip whitespace */
-                if(ch == '\n')
-                {
-                        fp->line_number++;
-                        continue;
-                }
-                else if(isspace(ch))
-                {
-                        continue;
-                }
-                else if(isdigit(ch))
-                {
-                        ungetc(ch, fp->fp);
-                        char line_in[64] = {};
-                        int group_code;
-                        /* Get the group code. This will, for now at least, be ignored. */
-                        fgets(line_in, sizeof(line_in), fp->fp);
-                        sscanf(line_in, "%d", &group_code);
-                        break;
-                }
-                else
-                {
-                        ungetc(ch, fp->fp);
-                        char line_in[64] = {};
-                        fgets(line_in, sizeof(line_in), fp->fp);
-                        fprintf(stderr, (_("Warning in %s () unknown input: %s"
-                                           "File: %s\n"
-                                           "Line: %d\n")),
-                                __FUNCTION__, line_in, fp->filename, fp->line_number);
-                        fp->line_number++;
-                }
-        }
+        char temp_string[DXF_MAX_STRING_LENGTH];
 
-        while((ch = fgetc(fp->fp)) != EOF)
-        {
-                /* Skip whitespace */
-                if(ch == '\n')
-                {
-                        fp->line_number++;
-                }
-                else if(isspace(ch))
-                {
-                        continue;
-                }
-                else if(isdigit(ch))
-                {
-                        /* Store the variable value in the result */
-                        ungetc(ch, fp->fp);
-                        char line_in[64] = {};
-                        fgets(line_in, sizeof(line_in), fp->fp);
-                        sscanf(line_in, "%lf", res);
-                        break;
-                }
-                else
-                {
-                        ungetc(ch, fp->fp);
-                        char line_in[64] = {};
-                        fgets(line_in, sizeof(line_in), fp->fp);
-                        fprintf(stderr, (_("Warning in %s () unknown input: %s"
-                                           "File: %s\n"
-                                           "Line: %d\n")),
-                                __FUNCTION__, line_in, fp->filename, fp->line_number);
-                        fp->line_number++;
-                }
-        }
+        /* Get the group code. This will, for now at least, be ignored. */
+        dxf_read_line (temp_string, fp);
+        /* Store the variable value in the result */
+        dxf_read_double (fp, res);
 }
 
 /*!
@@ -3160,94 +2702,135 @@ dxf_header_get_string_variable
         /*!< DXF file handle of input file (or device)  */
         )
 {
-        int ch;
-        while((ch = fgetc(fp->fp)) != EOF)
-        {
-                /* Skip whitespace */
-                if(ch == '\n')
-                {
-                        fp->line_number++;
-                        continue;
-                }
-                else if(isspace(ch))
-                {
-                        continue;
-                }
-                else if(isdigit(ch))
-                {
-                        ungetc(ch, fp->fp);
-                        char line_in[64] = {};
-                        int group_code;
-                        /* Get the group code. This will, for now at least, be ignored. */
-                        fgets(line_in, sizeof(line_in), fp->fp);
-                        sscanf(line_in, "%d", &group_code);
-                        break;
-                }
-                else
-                {
-                        ungetc(ch, fp->fp);
-                        char line_in[64] = {};
-                        fgets(line_in, sizeof(line_in), fp->fp);
-                        fprintf(stderr, (_("Warning in %s () unknown input: %s"
-                                           "File: %s\n"
-                                           "Line: %d\n")),
-                                __FUNCTION__, line_in, fp->filename, fp->line_number);
-                        fp->line_number++;
-                }
-        }
+        char temp_string[DXF_MAX_STRING_LENGTH];
+
+        /* Get the group code. This will, for now at least, be ignored. */
+        dxf_read_line (temp_string, fp);
+        /* Swap out the default string for the new one */
+        dxf_read_string (fp, res);
+}
+
+/*!
+ *  \brief Read a DxfPoint variable from a /c DxfFile
+ *
+ * The coordinates (group codes 10, 20 and 30) are read until another
+ * group code is found, this pair is pushed back for the next variable.
+ */
+static void
+dxf_header_get_dxf_point_variable
+(
+        DxfPoint *res,
+        /*!< Pointer to the member variable in which the resulting
+          value shall be stored. */
+        DxfFile *fp
+        /*!< DXF file handle of input file (or device)  */
+        )
+{
+        int group_code;
+        const char *value;
+        size_t length;
 
-        while((ch = fgetc(fp->fp))!= EOF)
+        while (dxf_reader_next_pair (fp, &group_code, &value, &length) == EXIT_SUCCESS)
         {
-                /* Skip whitespace */
-                if(ch == '\n')
+                if (group_code == 10)
                 {
-                        fp->line_number++;
+                        dxf_reader_parse_double (value, length, &res->x0);
                 }
-                else if(isspace(ch))
+                else if (group_code == 20)
                 {
-                        continue;
+                        dxf_reader_parse_double (value, length, &res->y0);
                 }
-                else if(isalpha(ch))
+                else if (group_code == 30)
                 {
-                        /* Store the variable value in the result */
-                        ungetc(ch, fp->fp);
-                        char line_in[64] = {};
-                        char temp_string[64] = {};
-                        fgets(line_in, sizeof(line_in), fp->fp);
-                        sscanf(line_in, "%s", temp_string);
-                        /* Swap out the default string for the new one */
-                        free(*res);
-                        *res = strdup(temp_string);
-                        break;
+                        dxf_reader_parse_double (value, length, &res->z0);
                 }
                 else
                 {
-                        ungetc(ch, fp->fp);
-                        char line_in[64] = {};
-                        fgets(line_in, sizeof(line_in), fp->fp);
-                        fprintf(stderr, (_("Warning in %s () unknown input: %s"
-                                           "File: %s\n"
-                                           "Line: %d\n")),
-                                __FUNCTION__, line_in, fp->filename, fp->line_number);
-                        fp->line_number++;
+                        dxf_reader_push_back (fp);
+                        break;
                 }
         }
 }
 
+
 /*!
- *  \brief Read a DxfPoint variable from a /c DxfFile
+ * \brief Compare a variable name with the name of a header variable
+ * descriptor, for \c bsearch ().
+ */
+static int
+dxf_header_variable_compare
+(
+        const void *name,
+                /*!< Variable name. */
+        const void *variable
+                /*!< Header variable descriptor. */
+)
+{
+        return (strcmp ((const char *) name,
+          ((const DxfHeaderVariable *) variable)->name));
+}
+
+
+/*!
+ * \brief Find the descriptor of a header variable by name.
+ *
+ * \return a pointer to the descriptor, or \c NULL for an unknown
+ * variable.
+ */
+static const DxfHeaderVariable *
+dxf_header_variable_find
+(
+        const char *name
+                /*!< Variable name, including the leading "$". */
+)
+{
+        return ((const DxfHeaderVariable *) bsearch (name,
+          dxf_header_variables,
+          sizeof (dxf_header_variables) / sizeof (dxf_header_variables[0]),
+          sizeof (DxfHeaderVariable),
+          dxf_header_variable_compare));
+}
+
+
+/*!
+ * \brief Read the value of a header variable from a /c DxfFile into
+ * the member of \c header given by its descriptor.
  */
 static void
-dxf_header_get_dxf_point_variable
+dxf_header_read_variable
 (
-        DxfPoint *res,
-        /*!< Pointer to the member variable in which the resulting
-          value shall be stored. */
-        DxfFile *fp
+        DxfFile *fp,
         /*!< DXF file handle of input file (or device)  */
-        )
+        DxfHeader *header,
+        /*!< DXF header to store the value in. */
+        const DxfHeaderVariable *variable
+        /*!< Descriptor of the variable. */
+)
 {
-        dxf_point_read(fp, res);
+        char *member = (char *) header + variable->offset;
+
+        switch (variable->type)
+        {
+                case DXF_HEADER_VARIABLE_INT:
+                        dxf_header_get_int_variable ((int *) member, fp);
+                        break;
+                case DXF_HEADER_VARIABLE_INT16:
+                        dxf_header_get_int16_variable ((int16_t *) member, fp);
+                        break;
+                case DXF_HEADER_VARIABLE_DOUBLE:
+                        dxf_header_get_double_variable ((double *) member, fp);
+                        break;
+                case DXF_HEADER_VARIABLE_STRING:
+                        dxf_header_get_string_variable ((char **) member, fp);
+                        break;
+                case DXF_HEADER_VARIABLE_POINT:
+                        dxf_header_get_dxf_point_variable ((DxfPoint *) member, fp);
+                        break;
+        }
+        if (variable->offset == offsetof (DxfHeader, AcadVer))
+        {
+                header->_AcadVer = dxf_header_acad_version_from_string (header->AcadVer);
+        }
 }
 
 /* EOF */
@@ -58,7 +58,7 @@ extern "C" {
 typedef struct
 dxf_header_struct
 {
-        int id_code;
+        uint64_t id_code;
                 /*!< Identification number for the entity.\n
                  * This is to be an unique (sequential) number in the DXF
                  * file.\n
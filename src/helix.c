@@ -38,6 +38,7 @@
 
 
 #include "helix.h"
+#include "util.h"
 
 
 /*!
@@ -60,7 +61,7 @@ dxf_helix_new ()
         size = sizeof (DxfHelix);
         /* avoid malloc of 0 bytes */
         if (size == 0) size = 1;
-        if ((helix = malloc (size)) == NULL)
+        if ((helix = dxf_malloc (size)) == NULL)
         {
                 fprintf (stderr,
                   (_("Error in %s () could not allocate memory.\n")),
@@ -111,9 +112,9 @@ dxf_helix_init
               return (NULL);
         }
         /* Assign initial values to members. */
-        helix->id_code = 0;
-        helix->linetype = strdup (DXF_DEFAULT_LINETYPE);
-        helix->layer = strdup (DXF_DEFAULT_LAYER);
+        helix->id_code = DXF_HANDLE_NONE;
+        helix->linetype = dxf_strdup (DXF_DEFAULT_LINETYPE);
+        helix->layer = dxf_strdup (DXF_DEFAULT_LAYER);
         helix->thickness = 0.0;
         helix->radius = 0.0;
         helix->number_of_turns = 0.0;
@@ -128,13 +129,13 @@ dxf_helix_init
         helix->constraint_type = 0;
         helix->shadow_mode = 0;
         helix->handedness = 0;
-        helix->dictionary_owner_hard = strdup ("");
-        helix->material = strdup ("");
-        helix->dictionary_owner_soft = strdup ("");
+        helix->dictionary_owner_hard = 0;
+        helix->material = 0;
+        helix->dictionary_owner_soft = 0;
         helix->lineweight = 0;
-        helix->plot_style_name = strdup ("");
+        helix->plot_style_name = 0;
         helix->color_value = 0;
-        helix->color_name = strdup ("");
+        helix->color_name = dxf_strdup ("");
         helix->transparency = 0;
         /* Initialize new structs for the following members later,
          * when they are required and when we have content. */
@@ -175,7 +176,8 @@ dxf_helix_read
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        char *temp_string = NULL;
+        char temp_string[DXF_MAX_STRING_LENGTH];
+        int group_code;
 
         /* Do some basic checks. */
         if (fp == NULL)
@@ -183,8 +185,6 @@ dxf_helix_read
                 fprintf (stderr,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
-                /* Clean up. */
-                free (temp_string);
                 return (NULL);
         }
         if (helix == NULL)
@@ -258,315 +258,237 @@ dxf_helix_read
                         return (NULL);
                 }
         }
-        (fp->line_number)++;
-        fscanf (fp->fp, "%[^\n]", temp_string);
-        while (strcmp (temp_string, "0") != 0)
+        while ((dxf_read_group_code (fp, &group_code) == EXIT_SUCCESS)
+          && (group_code != 0))
         {
-                if (ferror (fp->fp))
+                if (dxf_read_error (fp))
                 {
                         fprintf (stderr,
                           (_("Error in %s () while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
-                        fclose (fp->fp);
-                        /* Clean up. */
-                        free (temp_string);
                         return (NULL);
                 }
-                if (strcmp (temp_string, "5") == 0)
-                {
-                        /* Now follows a string containing a sequential
-                         * id number. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%x\n", (uint *) &helix->id_code);
-                }
-                else if (strcmp (temp_string, "6") == 0)
-                {
-                        /* Now follows a string containing a linetype
-                         * name. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, helix->linetype);
-                }
-                else if (strcmp (temp_string, "8") == 0)
-                {
-                        /* Now follows a string containing a layer name. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, helix->layer);
-                }
-                else if (strcmp (temp_string, "10") == 0)
-                {
-                        /* Now follows a string containing the
-                         * X-coordinate of the axis base point. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &helix->p0->x0);
-                }
-                else if (strcmp (temp_string, "20") == 0)
-                {
-                        /* Now follows a string containing the
-                         * Y-coordinate of the axis base point. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &helix->p0->y0);
-                }
-                else if (strcmp (temp_string, "30") == 0)
-                {
-                        /* Now follows a string containing the
-                         * Z-coordinate of the axis base point. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &helix->p0->z0);
-                }
-                else if (strcmp (temp_string, "11") == 0)
-                {
-                        /* Now follows a string containing the
-                         * X-coordinate of the start point. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &helix->p1->x0);
-                }
-                else if (strcmp (temp_string, "21") == 0)
-                {
-                        /* Now follows a string containing the
-                         * Y-coordinate of the start point. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &helix->p1->y0);
-                }
-                else if (strcmp (temp_string, "31") == 0)
-                {
-                        /* Now follows a string containing the
-                         * Z-coordinate of the start point. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &helix->p1->z0);
-                }
-                else if (strcmp (temp_string, "12") == 0)
-                {
-                        /* Now follows a string containing the
-                         * X-coordinate of the axis vector point. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &helix->p2->x0);
-                }
-                else if (strcmp (temp_string, "22") == 0)
-                {
-                        /* Now follows a string containing the
-                         * Y-coordinate of the axis vector point. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &helix->p2->y0);
-                }
-                else if (strcmp (temp_string, "32") == 0)
-                {
-                        /* Now follows a string containing the
-                         * Z-coordinate of the axis vector point. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &helix->p2->z0);
-                }
-                else if (strcmp (temp_string, "39") == 0)
-                {
-                        /* Now follows a string containing the
-                         * thickness. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &helix->thickness);
-                }
-                else if (strcmp (temp_string, "40") == 0)
-                {
-                        /* Now follows a string containing the
-                         * radius. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &helix->radius);
-                }
-                else if (strcmp (temp_string, "41") == 0)
-                {
-                        /* Now follows a string containing the number of
-                         * turns. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &helix->number_of_turns);
-                }
-                else if (strcmp (temp_string, "42") == 0)
-                {
-                        /* Now follows a string containing the turn
-                         * height. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &helix->turn_height);
-                }
-                else if (strcmp (temp_string, "48") == 0)
-                {
-                        /* Now follows a string containing the linetype
-                         * scale. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &helix->linetype_scale);
-                }
-                else if (strcmp (temp_string, "60") == 0)
-                {
-                        /* Now follows a string containing the
-                         * visibility value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%hd\n", &helix->visibility);
-                }
-                else if (strcmp (temp_string, "62") == 0)
-                {
-                        /* Now follows a string containing the
-                         * color value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%hd\n", &helix->color);
-                }
-                else if (strcmp (temp_string, "67") == 0)
-                {
-                        /* Now follows a string containing the
-                         * paperspace value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%hd\n", &helix->paperspace);
-                }
-                else if (strcmp (temp_string, "90") == 0)
-                {
-                        /* Now follows a string containing a major
-                         * release number. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%" PRIi32 "\n", &helix->major_release_number);
-                }
-                else if (strcmp (temp_string, "91") == 0)
+                switch (group_code)
                 {
-                        /* Now follows a string containing a maintenance
-                         * release number. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%" PRIi32 "\n", &helix->maintainance_release_number);
-                }
-                else if (strcmp (temp_string, "92") == 0)
-                {
-                        /* Now follows a string containing the
-                         * paperspace value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%d\n", &helix->graphics_data_size);
-                }
-                else if (strcmp (temp_string, "100") == 0)
-                {
-                        /* Now follows a string containing the
-                         * subclass marker value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
-                        if ((strcmp (temp_string, "AcDbSpline") == 0))
-                        {
-                                helix->spline = dxf_spline_read (fp, helix->spline);
-                        }
-                        else if ((strcmp (temp_string, "AcDbEntity") != 0)
-                                && ((strcmp (temp_string, "AcDbHelix") != 0)))
-                        {
+                        case 5:
+                                /* Now follows a string containing a sequential
+                                 * id number. */
+                                dxf_read_handle (fp, &helix->id_code);
+                                break;
+                        case 6:
+                                /* Now follows a string containing a linetype
+                                 * name. */
+                                dxf_read_string_interned (fp, &helix->linetype);
+                                break;
+                        case 8:
+                                /* Now follows a string containing a layer name. */
+                                dxf_read_string_interned (fp, &helix->layer);
+                                break;
+                        case 10:
+                                /* Now follows a string containing the
+                                 * X-coordinate of the axis base point. */
+                                dxf_read_double (fp, &helix->p0->x0);
+                                break;
+                        case 20:
+                                /* Now follows a string containing the
+                                 * Y-coordinate of the axis base point. */
+                                dxf_read_double (fp, &helix->p0->y0);
+                                break;
+                        case 30:
+                                /* Now follows a string containing the
+                                 * Z-coordinate of the axis base point. */
+                                dxf_read_double (fp, &helix->p0->z0);
+                                break;
+                        case 11:
+                                /* Now follows a string containing the
+                                 * X-coordinate of the start point. */
+                                dxf_read_double (fp, &helix->p1->x0);
+                                break;
+                        case 21:
+                                /* Now follows a string containing the
+                                 * Y-coordinate of the start point. */
+                                dxf_read_double (fp, &helix->p1->y0);
+                                break;
+                        case 31:
+                                /* Now follows a string containing the
+                                 * Z-coordinate of the start point. */
+                                dxf_read_double (fp, &helix->p1->z0);
+                                break;
+                        case 12:
+                                /* Now follows a string containing the
+                                 * X-coordinate of the axis vector point. */
+                                dxf_read_double (fp, &helix->p2->x0);
+                                break;
+                        case 22:
+                                /* Now follows a string containing the
+                                 * Y-coordinate of the axis vector point. */
+                                dxf_read_double (fp, &helix->p2->y0);
+                                break;
+                        case 32:
+                                /* Now follows a string containing the
+                                 * Z-coordinate of the axis vector point. */
+                                dxf_read_double (fp, &helix->p2->z0);
+                                break;
+                        case 39:
+                                /* Now follows a string containing the
+                                 * thickness. */
+                                dxf_read_double (fp, &helix->thickness);
+                                break;
+                        case 40:
+                                /* Now follows a string containing the
+                                 * radius. */
+                                dxf_read_double (fp, &helix->radius);
+                                break;
+                        case 41:
+                                /* Now follows a string containing the number of
+                                 * turns. */
+                                dxf_read_double (fp, &helix->number_of_turns);
+                                break;
+                        case 42:
+                                /* Now follows a string containing the turn
+                                 * height. */
+                                dxf_read_double (fp, &helix->turn_height);
+                                break;
+                        case 48:
+                                /* Now follows a string containing the linetype
+                                 * scale. */
+                                dxf_read_double (fp, &helix->linetype_scale);
+                                break;
+                        case 60:
+                                /* Now follows a string containing the
+                                 * visibility value. */
+                                dxf_read_int16 (fp, &helix->visibility);
+                                break;
+                        case 62:
+                                /* Now follows a string containing the
+                                 * color value. */
+                                dxf_read_int16 (fp, &helix->color);
+                                break;
+                        case 67:
+                                /* Now follows a string containing the
+                                 * paperspace value. */
+                                dxf_read_int16 (fp, &helix->paperspace);
+                                break;
+                        case 90:
+                                /* Now follows a string containing a major
+                                 * release number. */
+                                dxf_read_int32 (fp, &helix->major_release_number);
+                                break;
+                        case 91:
+                                /* Now follows a string containing a maintenance
+                                 * release number. */
+                                dxf_read_int32 (fp, &helix->maintainance_release_number);
+                                break;
+                        case 92:
+                                /* Now follows a string containing the
+                                 * paperspace value. */
+                                dxf_read_int (fp, &helix->graphics_data_size);
+                                break;
+                        case 100:
+                                /* Now follows a string containing the
+                                 * subclass marker value. */
+                                dxf_read_line (temp_string, fp);
+                                if ((strcmp (temp_string, "AcDbSpline") == 0))
+                                {
+                                        helix->spline = dxf_spline_read (fp, helix->spline);
+                                }
+                                else if ((strcmp (temp_string, "AcDbEntity") != 0)
+                                        && ((strcmp (temp_string, "AcDbHelix") != 0)))
+                                {
+                                        fprintf (stderr,
+                                          (_("Warning in %s () found a bad subclass marker in: %s in line: %d.\n")),
+                                          __FUNCTION__, fp->filename, fp->line_number);
+                                }
+                                break;
+                        case 160:
+                                /* Now follows a string containing the
+                                 * graphics data size value. */
+                                dxf_read_int32 (fp, &helix->graphics_data_size);
+                                break;
+                        case 280:
+                                /* Now follows a string containing a constraint
+                                 * type value. */
+                                dxf_read_int16 (fp, &helix->constraint_type);
+                                break;
+                        case 284:
+                                /* Now follows a string containing the shadow
+                                 * mode value. */
+                                dxf_read_int16 (fp, &helix->shadow_mode);
+                                break;
+                        case 290:
+                                /* Now follows a string containing a handedness
+                                 * value. */
+                                dxf_read_int (fp, &helix->handedness);
+                                break;
+                        case 310:
+                                /* Now follows a string containing binary
+                                 * graphics data. */
+                                dxf_read_string (fp, &helix->binary_graphics_data->data_line);
+                                dxf_binary_graphics_data_init ((DxfBinaryGraphicsData *) helix->binary_graphics_data->next);
+                                helix->binary_graphics_data = (DxfBinaryGraphicsData *) helix->binary_graphics_data->next;
+                                break;
+                        case 330:
+                                /* Now follows a string containing a
+                                 * soft-pointer ID/handle to owner dictionary. */
+                                dxf_read_handle (fp, &helix->dictionary_owner_soft);
+                                break;
+                        case 347:
+                                /* Now follows a string containing a
+                                 * hard-pointer ID/handle to material object. */
+                                dxf_read_handle (fp, &helix->material);
+                                break;
+                        case 360:
+                                /* Now follows a string containing a
+                                 * hard-pointer ID/handle to owner dictionary. */
+                                dxf_read_handle (fp, &helix->dictionary_owner_hard);
+                                break;
+                        case 370:
+                                /* Now follows a string containing the lineweight
+                                 * value. */
+                                dxf_read_int16 (fp, &helix->lineweight);
+                                break;
+                        case 390:
+                                /* Now follows a string containing a plot style
+                                 * name value. */
+                                dxf_read_handle (fp, &helix->plot_style_name);
+                                break;
+                        case 420:
+                                /* Now follows a string containing a color value. */
+                                dxf_read_int32 (fp, &helix->color_value);
+                                break;
+                        case 430:
+                                /* Now follows a string containing a color
+                                 * name value. */
+                                dxf_read_string_interned (fp, &helix->color_name);
+                                break;
+                        case 440:
+                                /* Now follows a string containing a transparency
+                                 * value. */
+                                dxf_read_int32 (fp, &helix->transparency);
+                                break;
+                        case 999:
+                                /* Now follows a string containing a comment. */
+                                dxf_read_line (temp_string, fp);
+                                fprintf (stdout, "DXF comment: %s\n", temp_string);
+                                break;
+                        default:
                                 fprintf (stderr,
-                                  (_("Warning in %s () found a bad subclass marker in: %s in line: %d.\n")),
+                                  (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
                                   __FUNCTION__, fp->filename, fp->line_number);
-                        }
-                }
-                else if (strcmp (temp_string, "160") == 0)
-                {
-                        /* Now follows a string containing the
-                         * graphics data size value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%" PRIi32 "\n", &helix->graphics_data_size);
-                }
-                else if (strcmp (temp_string, "280") == 0)
-                {
-                        /* Now follows a string containing a constraint
-                         * type value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%hd\n", &helix->constraint_type);
-                }
-                else if (strcmp (temp_string, "284") == 0)
-                {
-                        /* Now follows a string containing the shadow
-                         * mode value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%hd\n", &helix->shadow_mode);
-                }
-                else if (strcmp (temp_string, "290") == 0)
-                {
-                        /* Now follows a string containing a handedness
-                         * value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%d\n", &helix->handedness);
-                }
-                else if (strcmp (temp_string, "310") == 0)
-                {
-                        /* Now follows a string containing binary
-                         * graphics data. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, helix->binary_graphics_data->data_line);
-                        dxf_binary_graphics_data_init ((DxfBinaryGraphicsData *) helix->binary_graphics_data->next);
-                        helix->binary_graphics_data = (DxfBinaryGraphicsData *) helix->binary_graphics_data->next;
-                }
-                else if (strcmp (temp_string, "330") == 0)
-                {
-                        /* Now follows a string containing a
-                         * soft-pointer ID/handle to owner dictionary. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, helix->dictionary_owner_soft);
-                }
-                else if (strcmp (temp_string, "347") == 0)
-                {
-                        /* Now follows a string containing a
-                         * hard-pointer ID/handle to material object. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, helix->material);
-                }
-                else if (strcmp (temp_string, "360") == 0)
-                {
-                        /* Now follows a string containing a
-                         * hard-pointer ID/handle to owner dictionary. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, helix->dictionary_owner_hard);
-                }
-                else if (strcmp (temp_string, "370") == 0)
-                {
-                        /* Now follows a string containing the lineweight
-                         * value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%hd\n", &helix->lineweight);
-                }
-                else if (strcmp (temp_string, "390") == 0)
-                {
-                        /* Now follows a string containing a plot style
-                         * name value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, helix->plot_style_name);
-                }
-                else if (strcmp (temp_string, "420") == 0)
-                {
-                        /* Now follows a string containing a color value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%" PRIi32 "\n", &helix->color_value);
-                }
-                else if (strcmp (temp_string, "430") == 0)
-                {
-                        /* Now follows a string containing a color
-                         * name value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, helix->color_name);
-                }
-                else if (strcmp (temp_string, "440") == 0)
-                {
-                        /* Now follows a string containing a transparency
-                         * value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%" PRIi32 "\n", &helix->transparency);
-                }
-                else if (strcmp (temp_string, "999") == 0)
-                {
-                        /* Now follows a string containing a comment. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
-                        fprintf (stdout, "DXF comment: %s\n", temp_string);
-                }
-                else
-                {
-                        fprintf (stderr,
-                          (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
-                          __FUNCTION__, fp->filename, fp->line_number);
+                                /* Skip the value of the unknown group code. */
+                                dxf_read_line (temp_string, fp);
+                                break;
                 }
         }
         /* Handle omitted members and/or illegal values. */
         if (strcmp (helix->linetype, "") == 0)
         {
-                helix->linetype = strdup (DXF_DEFAULT_LINETYPE);
+                helix->linetype = dxf_strdup (DXF_DEFAULT_LINETYPE);
         }
         if (strcmp (helix->layer, "") == 0)
         {
-                helix->layer = strdup (DXF_DEFAULT_LAYER);
+                helix->layer = dxf_strdup (DXF_DEFAULT_LAYER);
         }
-        /* Clean up. */
-        free (temp_string);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -592,7 +514,7 @@ dxf_helix_write
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        char *dxf_entity_name = strdup ("HELIX");
+        char *dxf_entity_name = dxf_strdup ("HELIX");
         int i;
         DxfPoint *iter = NULL;
         DxfBinaryGraphicsData *iter_310 = NULL;
@@ -604,7 +526,7 @@ dxf_helix_write
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (helix == NULL)
@@ -613,7 +535,7 @@ dxf_helix_write
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (helix->spline == NULL)
@@ -622,18 +544,18 @@ dxf_helix_write
                   (_("Error in %s () a NULL pointer was found.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (helix->radius == 0.0)
         {
                 fprintf (stderr,
-                  (_("Error in %s () radius value equals 0.0 for the %s entity with id-code: %x.\n")),
+                  (_("Error in %s () radius value equals 0.0 for the %s entity with id-code: %" PRIx64 ".\n")),
                   __FUNCTION__, dxf_entity_name, helix->id_code);
                 fprintf (stderr, "    skipping %s entity.\n",
                         dxf_entity_name);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (fp->acad_version_number < AutoCAD_2007)
@@ -645,17 +567,17 @@ dxf_helix_write
         if (strcmp (helix->linetype, "") == 0)
         {
                 fprintf (stderr,
-                  (_("Warning in %s () empty linetype string for the %s entity with id-code: %x\n")),
+                  (_("Warning in %s () empty linetype string for the %s entity with id-code: %" PRIx64 "\n")),
                   __FUNCTION__, dxf_entity_name, helix->id_code);
                 fprintf (stderr,
                   (_("\t%s entity is reset to default linetype")),
                   dxf_entity_name);
-                helix->linetype = strdup (DXF_DEFAULT_LINETYPE);
+                helix->linetype = dxf_strdup (DXF_DEFAULT_LINETYPE);
         }
         if (strcmp (helix->layer, "") == 0)
         {
                 fprintf (stderr,
-                  (_("Warning in %s () empty layer string for the %s entity with id-code: %x.\n")),
+                  (_("Warning in %s () empty layer string for the %s entity with id-code: %" PRIx64 ".\n")),
                   __FUNCTION__, dxf_entity_name, helix->id_code);
                 fprintf (stderr,
                   (_("\t%s entity is relocated to default layer.\n")),
@@ -663,125 +585,125 @@ dxf_helix_write
                 helix->layer = DXF_DEFAULT_LAYER;
         }
         /* Start writing output. */
-        fprintf (fp->fp, "  0\n%s\n", dxf_entity_name);
-        if (helix->id_code != -1)
+        dxf_write_string (fp, 0, dxf_entity_name);
+        if (helix->id_code != DXF_HANDLE_NONE)
         {
-                fprintf (fp->fp, "  5\n%x\n", helix->id_code);
+                dxf_write_hex (fp, 5, helix->id_code);
         }
-        fprintf (fp->fp, "330\n%s\n", helix->dictionary_owner_soft);
-        fprintf (fp->fp, "100\nAcDbEntity\n");
+        dxf_write_hex (fp, 330, helix->dictionary_owner_soft);
+        dxf_write_string (fp, 100, "AcDbEntity");
         if (helix->paperspace != DXF_MODELSPACE)
         {
-                fprintf (fp->fp, " 67\n%hd\n", (int16_t) DXF_PAPERSPACE);
+                dxf_write_int (fp, 67, (int16_t) DXF_PAPERSPACE);
         }
-        fprintf (fp->fp, "  8\n%s\n", helix->layer);
+        dxf_write_string (fp, 8, helix->layer);
         if (strcmp (helix->linetype, DXF_DEFAULT_LINETYPE) != 0)
         {
-                fprintf (fp->fp, "  6\n%s\n", helix->linetype);
+                dxf_write_string (fp, 6, helix->linetype);
         }
-        if (strcmp (helix->material, "") != 0)
+        if (helix->material != 0)
         {
-                fprintf (fp->fp, "347\n%s\n", helix->material);
+                dxf_write_hex (fp, 347, helix->material);
         }
         if (helix->color != DXF_COLOR_BYLAYER)
         {
-                fprintf (fp->fp, " 62\n%hd\n", helix->color);
+                dxf_write_int (fp, 62, helix->color);
         }
-        fprintf (fp->fp, "370\n%d\n", helix->lineweight);
+        dxf_write_int (fp, 370, helix->lineweight);
         if (helix->thickness != 0.0)
         {
-                fprintf (fp->fp, " 39\n%f\n", helix->thickness);
+                dxf_write_double (fp, 39, helix->thickness);
         }
         if (helix->linetype_scale != 1.0)
         {
-                fprintf (fp->fp, " 48\n%f\n", helix->linetype_scale);
+                dxf_write_double (fp, 48, helix->linetype_scale);
         }
         if (helix->visibility != 0)
         {
-                fprintf (fp->fp, " 60\n%hd\n", helix->visibility);
+                dxf_write_int (fp, 60, helix->visibility);
         }
 #ifdef BUILD_64
-        fprintf (fp->fp, "160\n%" PRIi32 "\n", helix->graphics_data_size);
+        dxf_write_int (fp, 160, helix->graphics_data_size);
 #else
-        fprintf (fp->fp, " 92\n%" PRIi32 "\n", helix->graphics_data_size);
+        dxf_write_int (fp, 92, helix->graphics_data_size);
 #endif
         iter_310 = (DxfBinaryGraphicsData *) helix->binary_graphics_data;
         while (iter_310 != NULL)
         {
-                fprintf (fp->fp, "310\n%s\n", iter_310->data_line);
+                dxf_write_string (fp, 310, iter_310->data_line);
                 iter_310 = (DxfBinaryGraphicsData *) iter_310->next;
         }
-        fprintf (fp->fp, "420\n%" PRIi32 "\n", helix->color_value);
-        fprintf (fp->fp, "430\n%s\n", helix->color_name);
-        fprintf (fp->fp, "440\n%" PRIi32 "\n", helix->transparency);
-        fprintf (fp->fp, "390\n%s\n", helix->plot_style_name);
-        fprintf (fp->fp, "284\n%hd\n", helix->shadow_mode);
+        dxf_write_int (fp, 420, helix->color_value);
+        dxf_write_string (fp, 430, helix->color_name);
+        dxf_write_int (fp, 440, helix->transparency);
+        dxf_write_hex (fp, 390, helix->plot_style_name);
+        dxf_write_int (fp, 284, helix->shadow_mode);
         /* Write a spline to a DxfFile. */
         helix->spline->flag = 0;
         helix->spline->degree = 3;
-        fprintf (fp->fp, "100\nAcDbSpline\n");
-        fprintf (fp->fp, " 70\n%hd\n", helix->spline->flag);
-        fprintf (fp->fp, " 71\n%hd\n", helix->spline->degree);
-        fprintf (fp->fp, " 72\n%hd\n", helix->spline->number_of_knots);
-        fprintf (fp->fp, " 73\n%hd\n", helix->spline->number_of_control_points);
-        fprintf (fp->fp, " 74\n%hd\n", helix->spline->number_of_fit_points);
-        fprintf (fp->fp, " 42\n%f\n", helix->spline->knot_tolerance);
-        fprintf (fp->fp, " 43\n%f\n", helix->spline->control_point_tolerance);
-        fprintf (fp->fp, " 12\n%f\n", helix->spline->p2->x0);
-        fprintf (fp->fp, " 22\n%f\n", helix->spline->p2->y0);
-        fprintf (fp->fp, " 32\n%f\n", helix->spline->p2->z0);
-        fprintf (fp->fp, " 13\n%f\n", helix->spline->p3->x0);
-        fprintf (fp->fp, " 23\n%f\n", helix->spline->p3->y0);
-        fprintf (fp->fp, " 33\n%f\n", helix->spline->p3->z0);
+        dxf_write_string (fp, 100, "AcDbSpline");
+        dxf_write_int (fp, 70, helix->spline->flag);
+        dxf_write_int (fp, 71, helix->spline->degree);
+        dxf_write_int (fp, 72, helix->spline->number_of_knots);
+        dxf_write_int (fp, 73, helix->spline->number_of_control_points);
+        dxf_write_int (fp, 74, helix->spline->number_of_fit_points);
+        dxf_write_double (fp, 42, helix->spline->knot_tolerance);
+        dxf_write_double (fp, 43, helix->spline->control_point_tolerance);
+        dxf_write_double (fp, 12, helix->spline->p2.x);
+        dxf_write_double (fp, 22, helix->spline->p2.y);
+        dxf_write_double (fp, 32, helix->spline->p2.z);
+        dxf_write_double (fp, 13, helix->spline->p3.x);
+        dxf_write_double (fp, 23, helix->spline->p3.y);
+        dxf_write_double (fp, 33, helix->spline->p3.z);
         for (i = 0; i < helix->spline->number_of_knots; i++)
         {
-                fprintf (fp->fp, " 40\n%f\n", helix->spline->knot_value->value);
+                dxf_write_double (fp, 40, helix->spline->knot_value->value);
                 /*! \todo implement as a single linked list of double. */
         }
         if (helix->spline->number_of_fit_points != 0)
         {
                 for (i = 0; i < helix->spline->number_of_fit_points; i++)
                 {
-                        fprintf (fp->fp, " 41\n%f\n", helix->spline->weight_value->value);
+                        dxf_write_double (fp, 41, helix->spline->weight_value->value);
                         /*! \todo implement as a single linked list of double. */
                 }
         }
         iter = (DxfPoint *) helix->spline->p0;
         while (iter != NULL)
         {
-                fprintf (fp->fp, " 10\n%f\n", iter->x0);
-                fprintf (fp->fp, " 20\n%f\n", iter->y0);
-                fprintf (fp->fp, " 30\n%f\n", iter->z0);
+                dxf_write_double (fp, 10, iter->x0);
+                dxf_write_double (fp, 20, iter->y0);
+                dxf_write_double (fp, 30, iter->z0);
                 iter = (DxfPoint *) iter->next;
         }
         iter = (DxfPoint *) helix->spline->p1;
         while (iter != NULL)
         {
-                fprintf (fp->fp, " 11\n%f\n", iter->x0);
-                fprintf (fp->fp, " 21\n%f\n", iter->y0);
-                fprintf (fp->fp, " 31\n%f\n", iter->z0);
+                dxf_write_double (fp, 11, iter->x0);
+                dxf_write_double (fp, 21, iter->y0);
+                dxf_write_double (fp, 31, iter->z0);
                 iter = (DxfPoint *) iter->next;
         }
         /* Continue writing helix entity parameters. */
-        fprintf (fp->fp, "100\nAcDbHelix\n");
-        fprintf (fp->fp, " 90\n%" PRIi32 "\n", helix->major_release_number);
-        fprintf (fp->fp, " 91\n%" PRIi32 "\n", helix->maintainance_release_number);
-        fprintf (fp->fp, " 10\n%f\n", helix->p0->x0);
-        fprintf (fp->fp, " 20\n%f\n", helix->p0->y0);
-        fprintf (fp->fp, " 30\n%f\n", helix->p0->z0);
-        fprintf (fp->fp, " 11\n%f\n", helix->p1->x0);
-        fprintf (fp->fp, " 21\n%f\n", helix->p1->y0);
-        fprintf (fp->fp, " 31\n%f\n", helix->p1->z0);
-        fprintf (fp->fp, " 12\n%f\n", helix->p2->x0);
-        fprintf (fp->fp, " 22\n%f\n", helix->p2->y0);
-        fprintf (fp->fp, " 32\n%f\n", helix->p2->z0);
-        fprintf (fp->fp, " 40\n%f\n", helix->radius);
-        fprintf (fp->fp, " 41\n%f\n", helix->number_of_turns);
-        fprintf (fp->fp, " 42\n%f\n", helix->turn_height);
-        fprintf (fp->fp, "290\n%d\n", helix->handedness);
-        fprintf (fp->fp, "280\n%hd\n", helix->constraint_type);
+        dxf_write_string (fp, 100, "AcDbHelix");
+        dxf_write_int (fp, 90, helix->major_release_number);
+        dxf_write_int (fp, 91, helix->maintainance_release_number);
+        dxf_write_double (fp, 10, helix->p0->x0);
+        dxf_write_double (fp, 20, helix->p0->y0);
+        dxf_write_double (fp, 30, helix->p0->z0);
+        dxf_write_double (fp, 11, helix->p1->x0);
+        dxf_write_double (fp, 21, helix->p1->y0);
+        dxf_write_double (fp, 31, helix->p1->z0);
+        dxf_write_double (fp, 12, helix->p2->x0);
+        dxf_write_double (fp, 22, helix->p2->y0);
+        dxf_write_double (fp, 32, helix->p2->z0);
+        dxf_write_double (fp, 40, helix->radius);
+        dxf_write_double (fp, 41, helix->number_of_turns);
+        dxf_write_double (fp, 42, helix->turn_height);
+        dxf_write_int (fp, 290, helix->handedness);
+        dxf_write_int (fp, 280, helix->constraint_type);
         /* Clean up. */
-        free (dxf_entity_name);
+        dxf_free (dxf_entity_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -822,18 +744,14 @@ dxf_helix_free
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        free (helix->linetype);
-        free (helix->layer);
+        dxf_string_free (helix->linetype);
+        dxf_string_free (helix->layer);
         dxf_binary_graphics_data_free_list ((DxfBinaryGraphicsData *) helix->binary_graphics_data);
-        free (helix->dictionary_owner_hard);
-        free (helix->material);
-        free (helix->dictionary_owner_soft);
-        free (helix->plot_style_name);
-        free (helix->color_name);
+        dxf_string_free (helix->color_name);
         dxf_point_free (helix->p0);
         dxf_point_free (helix->p1);
         dxf_point_free (helix->p2);
-        free (helix);
+        dxf_free (helix);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -880,7 +798,7 @@ dxf_helix_free_list
  * \return \c id_code when successful, or \c EXIT_FAILURE when an error
  * occurred.
  */
-int
+uint64_t
 dxf_helix_get_id_code
 (
         DxfHelix *helix
@@ -898,12 +816,6 @@ dxf_helix_get_id_code
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (helix->id_code < 0)
-        {
-                fprintf (stderr,
-                  (_("Warning in %s () a negative value was found.\n")),
-                  __FUNCTION__);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -922,7 +834,7 @@ dxf_helix_set_id_code
 (
         DxfHelix *helix,
                 /*!< a pointer to a DXF \c HELIX entity. */
-        int id_code
+        uint64_t id_code
                 /*!< Identification number for the entity.\n
                  * This is to be an unique (sequential) number in the DXF
                  * file. */
@@ -939,12 +851,6 @@ dxf_helix_set_id_code
                   __FUNCTION__);
                 return (NULL);
         }
-        if (id_code < 0)
-        {
-                fprintf (stderr,
-                  (_("Warning in %s () a negative value was passed.\n")),
-                  __FUNCTION__);
-        }
         helix->id_code = id_code;
 #if DEBUG
         DXF_DEBUG_END
@@ -986,7 +892,7 @@ dxf_helix_get_linetype
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (helix->linetype));
+        return (dxf_strdup (helix->linetype));
 }
 
 
@@ -1023,7 +929,7 @@ dxf_helix_set_linetype
                   __FUNCTION__);
                 return (NULL);
         }
-        helix->linetype = strdup (linetype);
+        helix->linetype = dxf_strdup (linetype);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1064,7 +970,7 @@ dxf_helix_get_layer
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (helix->layer));
+        return (dxf_strdup (helix->layer));
 }
 
 
@@ -1101,7 +1007,7 @@ dxf_helix_set_layer
                   __FUNCTION__);
                 return (NULL);
         }
-        helix->layer = strdup (layer);
+        helix->layer = dxf_strdup (layer);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1787,12 +1693,10 @@ dxf_helix_set_binary_graphics_data
  * \brief Get the pointer to the \c dictionary_owner_soft from a DXF 
  * \c HELIX entity.
  *
- * \return pointer to the \c dictionary_owner_soft, or \c NULL when an
+ * \return the handle of the \c dictionary_owner_soft, or 0 when an
  * error occurred.
- *
- * \warning No checks are performed on the returned pointer (string).
  */
-char *
+uint64_t
 dxf_helix_get_dictionary_owner_soft
 (
         DxfHelix *helix
@@ -1808,19 +1712,12 @@ dxf_helix_get_dictionary_owner_soft
                 fprintf (stderr,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
-                return (NULL);
-        }
-        if (helix->dictionary_owner_soft ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
+                return (0);
         }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (helix->dictionary_owner_soft));
+        return (helix->dictionary_owner_soft);
 }
 
 
@@ -1836,8 +1733,8 @@ dxf_helix_set_dictionary_owner_soft
 (
         DxfHelix *helix,
                 /*!< a pointer to a DXF \c HELIX entity. */
-        char *dictionary_owner_soft
-                /*!< a string containing the pointer to the
+        uint64_t dictionary_owner_soft
+                /*!< the handle of the
                  * \c dictionary_owner_soft for the entity. */
 )
 {
@@ -1852,14 +1749,7 @@ dxf_helix_set_dictionary_owner_soft
                   __FUNCTION__);
                 return (NULL);
         }
-        if (dictionary_owner_soft == NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was passed.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
-        helix->dictionary_owner_soft = strdup (dictionary_owner_soft);
+        helix->dictionary_owner_soft = dictionary_owner_soft;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1872,10 +1762,8 @@ dxf_helix_set_dictionary_owner_soft
  * \c HELIX entity.
  *
  * \return soft pointer to the object owner.
- *
- * \warning No checks are performed on the returned pointer (string).
  */
-char *
+uint64_t
 dxf_helix_get_object_owner_soft
 (
         DxfHelix *helix
@@ -1891,19 +1779,12 @@ dxf_helix_get_object_owner_soft
                 fprintf (stderr,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
-                return (NULL);
-        }
-        if (helix->object_owner_soft ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
+                return (0);
         }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (helix->object_owner_soft));
+        return (helix->object_owner_soft);
 }
 
 
@@ -1916,8 +1797,8 @@ dxf_helix_set_object_owner_soft
 (
         DxfHelix *helix,
                 /*!< a pointer to a DXF \c HELIX entity. */
-        char *object_owner_soft
-                /*!< a string containing the pointer to the
+        uint64_t object_owner_soft
+                /*!< the handle of the
                  * \c object_owner_soft for the entity. */
 )
 {
@@ -1932,14 +1813,7 @@ dxf_helix_set_object_owner_soft
                   __FUNCTION__);
                 return (NULL);
         }
-        if (object_owner_soft == NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was passed.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
-        helix->object_owner_soft = strdup (object_owner_soft);
+        helix->object_owner_soft = object_owner_soft;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1950,12 +1824,10 @@ dxf_helix_set_object_owner_soft
 /*!
  * \brief Get the pointer to the \c material from a DXF \c HELIX entity.
  *
- * \return a pointer to \c material when successful, or \c NULL when an
+ * \return the handle \c material when successful, or 0 when an
  * error occurred.
- *
- * \warning No checks are performed on the returned pointer.
  */
-char *
+uint64_t
 dxf_helix_get_material
 (
         DxfHelix *helix
@@ -1971,19 +1843,12 @@ dxf_helix_get_material
                 fprintf (stderr,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
-                return (NULL);
-        }
-        if (helix->material ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
+                return (0);
         }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (helix->material));
+        return (helix->material);
 }
 
 
@@ -1998,8 +1863,8 @@ dxf_helix_set_material
 (
         DxfHelix *helix,
                 /*!< a pointer to a DXF \c HELIX entity. */
-        char *material
-                /*!< a string containing the pointer to the \c
+        uint64_t material
+                /*!< the handle of the \c
                  * material for the entity. */
 )
 {
@@ -2014,14 +1879,7 @@ dxf_helix_set_material
                   __FUNCTION__);
                 return (NULL);
         }
-        if (material == NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was passed.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
-        helix->material = strdup (material);
+        helix->material = material;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2033,12 +1891,10 @@ dxf_helix_set_material
  * \brief Get the pointer to the \c dictionary_owner_hard from a DXF
  * \c HELIX entity.
  *
- * \return a pointer to \c dictionary_owner_hard when successful, or
- * \c NULL when an error occurred.
- *
- * \warning No checks are performed on the returned pointer.
+ * \return the handle \c dictionary_owner_hard when successful, or
+ * 0 when an error occurred.
  */
-char *
+uint64_t
 dxf_helix_get_dictionary_owner_hard
 (
         DxfHelix *helix
@@ -2054,19 +1910,12 @@ dxf_helix_get_dictionary_owner_hard
                 fprintf (stderr,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
-                return (NULL);
-        }
-        if (helix->dictionary_owner_hard ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
+                return (0);
         }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (helix->dictionary_owner_hard));
+        return (helix->dictionary_owner_hard);
 }
 
 
@@ -2082,8 +1931,8 @@ dxf_helix_set_dictionary_owner_hard
 (
         DxfHelix *helix,
                 /*!< a pointer to a DXF \c HELIX entity. */
-        char *dictionary_owner_hard
-                /*!< a string containing the pointer to the \c
+        uint64_t dictionary_owner_hard
+                /*!< the handle of the \c
                  * dictionary_owner_hard for the entity. */
 )
 {
@@ -2098,14 +1947,7 @@ dxf_helix_set_dictionary_owner_hard
                   __FUNCTION__);
                 return (NULL);
         }
-        if (dictionary_owner_hard == NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was passed.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
-        helix->dictionary_owner_hard = strdup (dictionary_owner_hard);
+        helix->dictionary_owner_hard = dictionary_owner_hard;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2181,10 +2023,10 @@ dxf_helix_set_lineweight
 /*!
  * \brief Get the \c plot_style_name from a DXF \c HELIX entity.
  *
- * \return \c plot_style_name when sucessful, or \c NULL when an error
+ * \return \c plot_style_name when sucessful, or 0 when an error
  * occurred.
  */
-char *
+uint64_t
 dxf_helix_get_plot_style_name
 (
         DxfHelix *helix
@@ -2200,19 +2042,12 @@ dxf_helix_get_plot_style_name
                 fprintf (stderr,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
-                return (NULL);
-        }
-        if (helix->plot_style_name ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
+                return (0);
         }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (helix->plot_style_name));
+        return (helix->plot_style_name);
 }
 
 
@@ -2227,7 +2062,7 @@ dxf_helix_set_plot_style_name
 (
         DxfHelix *helix,
                 /*!< a pointer to a DXF \c HELIX entity. */
-        char *plot_style_name
+        uint64_t plot_style_name
                 /*!< a string containing the \c plot_style_name for the
                  * entity. */
 )
@@ -2243,14 +2078,7 @@ dxf_helix_set_plot_style_name
                   __FUNCTION__);
                 return (NULL);
         }
-        if (plot_style_name == NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was passed.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
-        helix->plot_style_name = strdup (plot_style_name);
+        helix->plot_style_name = plot_style_name;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2357,7 +2185,7 @@ dxf_helix_get_color_name
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (helix->color_name));
+        return (dxf_strdup (helix->color_name));
 }
 
 
@@ -2395,7 +2223,7 @@ dxf_helix_set_color_name
                   __FUNCTION__);
                 return (NULL);
         }
-        helix->color_name = strdup (color_name);
+        helix->color_name = dxf_strdup (color_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
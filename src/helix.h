@@ -57,7 +57,7 @@ typedef struct
 dxf_helix_struct
 {
         /* Members common for all DXF drawable entities. */
-        int id_code;
+        uint64_t id_code;
                 /*!< Identification number for the entity.\n
                  * This is to be an unique (sequential) number in the DXF
                  * file.\n
@@ -124,20 +124,20 @@ dxf_helix_struct
                  * (optional).\n
                  * Group code = 310.\n
                  * \since Introduced in version R2000. */
-        char *dictionary_owner_soft;
+        uint64_t dictionary_owner_soft;
                 /*!< Soft-pointer ID/handle to owner dictionary (optional).\n
                  * Group code = 330.\n
                  * \since Introduced in version R14. */
-        char *object_owner_soft;
+        uint64_t object_owner_soft;
                 /*!< Soft-pointer ID/handle  to owner BLOCK_RECORD object.\n
                  * Group code = 330.\n
                  * \since Introduced in version R2000. */
-        char *material;
+        uint64_t material;
                 /*!< Hard-pointer ID/handle to material object (present if
                  * not BYLAYER).\n
                  * Group code = 347.\n
                  * \since Introduced in version R2008. */
-        char *dictionary_owner_hard;
+        uint64_t dictionary_owner_hard;
                 /*!< Hard owner ID/handle to owner dictionary (optional).\n
                  * Group code = 360.\n
                  * \since Introduced in version R14. */
@@ -146,7 +146,7 @@ dxf_helix_struct
                  * Stored and moved around as a 16-bit integer.\n
                  * Group code = 370.\n
                  * \since Introduced in version R2002. */
-        char *plot_style_name;
+        uint64_t plot_style_name;
                 /*!< Hard pointer ID / handle of PlotStyleName object.\n
                  * Group code = 390.\n
                  * \since Introduced in version R2009. */
@@ -232,8 +232,8 @@ DxfHelix *dxf_helix_read (DxfFile *fp, DxfHelix *helix);
 int dxf_helix_write (DxfFile *fp, DxfHelix *helix);
 int dxf_helix_free (DxfHelix *helix);
 void dxf_helix_free_list (DxfHelix *helices);
-int dxf_helix_get_id_code (DxfHelix *helix);
-DxfHelix *dxf_helix_set_id_code (DxfHelix *helix, int id_code);
+uint64_t dxf_helix_get_id_code (DxfHelix *helix);
+DxfHelix *dxf_helix_set_id_code (DxfHelix *helix, uint64_t id_code);
 char *dxf_helix_get_linetype (DxfHelix *helix);
 DxfHelix *dxf_helix_set_linetype (DxfHelix *helix, char *linetype);
 char *dxf_helix_get_layer (DxfHelix *helix);
@@ -254,18 +254,18 @@ int16_t dxf_helix_get_shadow_mode (DxfHelix *helix);
 DxfHelix *dxf_helix_set_shadow_mode (DxfHelix *helix, int16_t shadow_mode);
 DxfBinaryGraphicsData *dxf_helix_get_binary_graphics_data (DxfHelix *helix);
 DxfHelix *dxf_helix_set_binary_graphics_data (DxfHelix *helix, DxfBinaryGraphicsData *data);
-char *dxf_helix_get_dictionary_owner_soft (DxfHelix *helix);
-DxfHelix *dxf_helix_set_dictionary_owner_soft (DxfHelix *helix, char *dictionary_owner_soft);
-char *dxf_helix_get_object_owner_soft (DxfHelix *helix);
-DxfHelix *dxf_helix_set_object_owner_soft (DxfHelix *helix, char *object_owner_soft);
-char *dxf_helix_get_material (DxfHelix *helix);
-DxfHelix *dxf_helix_set_material (DxfHelix *helix, char *material);
-char *dxf_helix_get_dictionary_owner_hard (DxfHelix *helix);
-DxfHelix *dxf_helix_set_dictionary_owner_hard (DxfHelix *helix, char *dictionary_owner_hard);
+uint64_t dxf_helix_get_dictionary_owner_soft (DxfHelix *helix);
+DxfHelix *dxf_helix_set_dictionary_owner_soft (DxfHelix *helix, uint64_t dictionary_owner_soft);
+uint64_t dxf_helix_get_object_owner_soft (DxfHelix *helix);
+DxfHelix *dxf_helix_set_object_owner_soft (DxfHelix *helix, uint64_t object_owner_soft);
+uint64_t dxf_helix_get_material (DxfHelix *helix);
+DxfHelix *dxf_helix_set_material (DxfHelix *helix, uint64_t material);
+uint64_t dxf_helix_get_dictionary_owner_hard (DxfHelix *helix);
+DxfHelix *dxf_helix_set_dictionary_owner_hard (DxfHelix *helix, uint64_t dictionary_owner_hard);
 int16_t dxf_helix_get_lineweight (DxfHelix *helix);
 DxfHelix *dxf_helix_set_lineweight (DxfHelix *helix, int16_t lineweight);
-char *dxf_helix_get_plot_style_name (DxfHelix *helix);
-DxfHelix *dxf_helix_set_plot_style_name (DxfHelix *helix, char *plot_style_name);
+uint64_t dxf_helix_get_plot_style_name (DxfHelix *helix);
+DxfHelix *dxf_helix_set_plot_style_name (DxfHelix *helix, uint64_t plot_style_name);
 int32_t dxf_helix_get_color_value (DxfHelix *helix);
 DxfHelix *dxf_helix_set_color_value (DxfHelix *helix, int32_t color_value);
 char *dxf_helix_get_color_name (DxfHelix *helix);
@@ -45,6 +45,7 @@
 
 
 #include "idbuffer.h"
+#include "util.h"
 
 
 /*!
@@ -64,7 +65,7 @@ dxf_idbuffer_new ()
         size = sizeof (DxfIdbuffer);
         /* avoid malloc of 0 bytes */
         if (size == 0) size = 1;
-        if ((idbuffer = malloc (size)) == NULL)
+        if ((idbuffer = dxf_malloc (size)) == NULL)
         {
                 fprintf (stderr,
                   (_("Error in %s () could not allocate memory.\n")),
@@ -115,10 +116,10 @@ dxf_idbuffer_init
                 return (NULL);
         }
         /* Assign initial values to members. */
-        idbuffer->id_code = 0;
-        idbuffer->dictionary_owner_soft = strdup ("");
-        idbuffer->object_owner_soft = strdup ("");
-        idbuffer->dictionary_owner_hard = strdup ("");
+        idbuffer->id_code = DXF_HANDLE_NONE;
+        idbuffer->dictionary_owner_soft = 0;
+        idbuffer->object_owner_soft = 0;
+        idbuffer->dictionary_owner_hard = 0;
         /* Initialize new structs for the following members later,
          * when they are required and when we have content. */
         idbuffer->entity_pointer = NULL;
@@ -153,7 +154,8 @@ dxf_idbuffer_read
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        char *temp_string = NULL;
+        char temp_string[DXF_MAX_STRING_LENGTH];
+        int group_code;
         int i;
         DxfIdbufferEntityPointer *entity_pointer = NULL;
         int iter330;
@@ -164,8 +166,6 @@ dxf_idbuffer_read
                 fprintf (stderr,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
-                /* Clean up. */
-                free (temp_string);
                 return (NULL);
         }
         if (fp->acad_version_number < AutoCAD_14)
@@ -184,93 +184,89 @@ dxf_idbuffer_read
         i = 0;
         entity_pointer = (DxfIdbufferEntityPointer *) dxf_idbuffer_entity_pointer_init (entity_pointer);
         iter330 = 0;
-        (fp->line_number)++;
-        fscanf (fp->fp, "%[^\n]", temp_string);
-        while (strcmp (temp_string, "0") != 0)
+        while ((dxf_read_group_code (fp, &group_code) == EXIT_SUCCESS)
+          && (group_code != 0))
         {
-                if (ferror (fp->fp))
+                if (dxf_read_error (fp))
                 {
                         fprintf (stderr,
                           (_("Error in %s () while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
                         /* Clean up. */
-                        free (temp_string);
-                        fclose (fp->fp);
                         return (NULL);
                 }
-                if (strcmp (temp_string, "5") == 0)
-                {
-                        /* Now follows a string containing a sequential
-                         * id number. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%x\n", (uint *) &idbuffer->id_code);
-                }
-                else if (strcmp (temp_string, "100") == 0)
+                switch (group_code)
                 {
-                        /* Now follows a string containing the
-                         * subclass marker value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
-                        if (strcmp (temp_string, "AcDbIdBuffer") != 0)
-                        {
+                        case 5:
+                                /* Now follows a string containing a sequential
+                                 * id number. */
+                                dxf_read_handle (fp, &idbuffer->id_code);
+                                break;
+                        case 100:
+                                /* Now follows a string containing the
+                                 * subclass marker value. */
+                                dxf_read_line (temp_string, fp);
+                                if (strcmp (temp_string, "AcDbIdBuffer") != 0)
+                                {
+                                        fprintf (stderr,
+                                          (_("Warning in %s () found a bad subclass marker in: %s in line: %d.\n")),
+                                          __FUNCTION__, fp->filename, fp->line_number);
+                                }
+                                break;
+                        case 330:
+                                if (i == 0)
+                                {
+                                        if (iter330 == 0)
+                                        {
+                                                /* Now follows a string containing a soft-pointer
+                                                 * ID/handle to owner dictionary. */
+                                                dxf_read_handle (fp, &idbuffer->dictionary_owner_soft);
+                                                i++;
+                                        }
+                                        if (iter330 == 1)
+                                        {
+                                                /* Now follows a string containing a soft-pointer
+                                                 * ID/handle to owner object. */
+                                                dxf_read_handle (fp, &idbuffer->object_owner_soft);
+                                        }
+                                        iter330++;
+                                }
+                                else if (i > 0)
+                                {
+                                        /* Now follows a string containing a Soft
+                                         * pointer reference to entity. */
+                                        dxf_read_handle (fp, &entity_pointer->soft_pointer);
+                                        dxf_idbuffer_entity_pointer_init ((DxfIdbufferEntityPointer *) entity_pointer->next);
+                                        entity_pointer = (DxfIdbufferEntityPointer *) entity_pointer->next;
+                                }
+                                else
+                                {
+                                        fprintf (stderr,
+                                          (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
+                                          __FUNCTION__, fp->filename, fp->line_number);
+                                        /* Skip the value of the unknown group code. */
+                                        dxf_read_line (temp_string, fp);
+                                }
+                                break;
+                        case 360:
+                                /* Now follows a string containing Hard owner
+                                 * ID/handle to owner dictionary. */
+                                dxf_read_handle (fp, &idbuffer->dictionary_owner_hard);
+                                break;
+                        case 999:
+                                /* Now follows a string containing a comment. */
+                                dxf_read_line (temp_string, fp);
+                                fprintf (stdout, (_("DXF comment: %s\n")), temp_string);
+                                break;
+                        default:
                                 fprintf (stderr,
-                                  (_("Warning in %s () found a bad subclass marker in: %s in line: %d.\n")),
+                                  (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
                                   __FUNCTION__, fp->filename, fp->line_number);
-                        }
-                }
-                else if ((strcmp (temp_string, "330") == 0)
-                  && (i == 0))
-                {
-                        if (iter330 == 0)
-                        {
-                                /* Now follows a string containing a soft-pointer
-                                 * ID/handle to owner dictionary. */
-                                (fp->line_number)++;
-                                fscanf (fp->fp, DXF_MAX_STRING_FORMAT, idbuffer->dictionary_owner_soft);
-                                i++;
-                        }
-                        if (iter330 == 1)
-                        {
-                                /* Now follows a string containing a soft-pointer
-                                 * ID/handle to owner object. */
-                                (fp->line_number)++;
-                                fscanf (fp->fp, DXF_MAX_STRING_FORMAT, idbuffer->object_owner_soft);
-                        }
-                        iter330++;
-                }
-                else if ((strcmp (temp_string, "330") == 0)
-                  && (i > 0))
-                {
-                        /* Now follows a string containing a Soft
-                         * pointer reference to entity. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, entity_pointer->soft_pointer);
-                        dxf_idbuffer_entity_pointer_init ((DxfIdbufferEntityPointer *) entity_pointer->next);
-                        entity_pointer = (DxfIdbufferEntityPointer *) entity_pointer->next;
-                }
-                else if (strcmp (temp_string, "360") == 0)
-                {
-                        /* Now follows a string containing Hard owner
-                         * ID/handle to owner dictionary. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, idbuffer->dictionary_owner_hard);
-                }
-                else if (strcmp (temp_string, "999") == 0)
-                {
-                        /* Now follows a string containing a comment. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
-                        fprintf (stdout, (_("DXF comment: %s\n")), temp_string);
-                }
-                else
-                {
-                        fprintf (stderr,
-                          (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
-                          __FUNCTION__, fp->filename, fp->line_number);
+                                /* Skip the value of the unknown group code. */
+                                dxf_read_line (temp_string, fp);
+                                break;
                 }
         }
-        /* Clean up. */
-        free (temp_string);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -296,7 +292,7 @@ dxf_idbuffer_write
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        char *dxf_entity_name = strdup ("IDBUFFER");
+        char *dxf_entity_name = dxf_strdup ("IDBUFFER");
         DxfIdbufferEntityPointer * entity_pointer = NULL;
 
         /* Do some basic checks. */
@@ -306,7 +302,7 @@ dxf_idbuffer_write
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (idbuffer == NULL)
@@ -315,20 +311,20 @@ dxf_idbuffer_write
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (fp->acad_version_number < AutoCAD_14)
         {
                 fprintf (stderr,
-                  (_("Warning in %s () illegal DXF version for this %s entity with id-code: %x.\n")),
+                  (_("Warning in %s () illegal DXF version for this %s entity with id-code: %" PRIx64 ".\n")),
                   __FUNCTION__, dxf_entity_name, dxf_idbuffer_get_id_code (idbuffer));
         }
         /* Start writing output. */
-        fprintf (fp->fp, "  0\n%s\n", dxf_entity_name);
-        if (dxf_idbuffer_get_id_code (idbuffer) != -1)
+        dxf_write_string (fp, 0, dxf_entity_name);
+        if (dxf_idbuffer_get_id_code (idbuffer) != DXF_HANDLE_NONE)
         {
-                fprintf (fp->fp, "  5\n%x\n", dxf_idbuffer_get_id_code (idbuffer));
+                dxf_write_hex (fp, 5, dxf_idbuffer_get_id_code (idbuffer));
         }
         /*!
          * \todo for version R14.\n
@@ -340,37 +336,37 @@ dxf_idbuffer_write
          * 102 groups are application defined (optional).\n\n
          * End of group, "}" (optional), with Group code 102.
          */
-        if ((strcmp (idbuffer->dictionary_owner_soft, "") != 0)
+        if ((idbuffer->dictionary_owner_soft != 0)
           && (fp->acad_version_number >= AutoCAD_14))
         {
-                fprintf (fp->fp, "102\n{ACAD_REACTORS\n");
-                fprintf (fp->fp, "330\n%s\n", dxf_idbuffer_get_dictionary_owner_soft (idbuffer));
-                fprintf (fp->fp, "102\n}\n");
+                dxf_write_string (fp, 102, "{ACAD_REACTORS");
+                dxf_write_hex (fp, 330, dxf_idbuffer_get_dictionary_owner_soft (idbuffer));
+                dxf_write_string (fp, 102, "}");
         }
-        if ((strcmp (idbuffer->dictionary_owner_hard, "") != 0)
+        if ((idbuffer->dictionary_owner_hard != 0)
           && (fp->acad_version_number >= AutoCAD_14))
         {
-                fprintf (fp->fp, "102\n{ACAD_XDICTIONARY\n");
-                fprintf (fp->fp, "360\n%s\n", dxf_idbuffer_get_dictionary_owner_hard (idbuffer));
-                fprintf (fp->fp, "102\n}\n");
+                dxf_write_string (fp, 102, "{ACAD_XDICTIONARY");
+                dxf_write_hex (fp, 360, dxf_idbuffer_get_dictionary_owner_hard (idbuffer));
+                dxf_write_string (fp, 102, "}");
         }
-        if ((strcmp (idbuffer->object_owner_soft, "") != 0)
+        if ((idbuffer->object_owner_soft != 0)
           && (fp->acad_version_number >= AutoCAD_2000))
         {
-                fprintf (fp->fp, "330\n%s\n", idbuffer->object_owner_soft);
+                dxf_write_hex (fp, 330, idbuffer->object_owner_soft);
         }
         if (fp->acad_version_number >= AutoCAD_13)
         {
-                fprintf (fp->fp, "100\nAcDbIdBuffer\n");
+                dxf_write_string (fp, 100, "AcDbIdBuffer");
         }
         entity_pointer = (DxfIdbufferEntityPointer *) idbuffer->entity_pointer;
         while (entity_pointer != NULL)
         {
-                fprintf (fp->fp, "330\n%s\n", entity_pointer->soft_pointer);
+                dxf_write_hex (fp, 330, entity_pointer->soft_pointer);
                 entity_pointer = (DxfIdbufferEntityPointer *) entity_pointer->next;
         }
         /* Clean up. */
-        free (dxf_entity_name);
+        dxf_free (dxf_entity_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -411,11 +407,8 @@ dxf_idbuffer_free
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        free (idbuffer->dictionary_owner_soft);
-        free (idbuffer->object_owner_soft);
-        free (idbuffer->dictionary_owner_hard);
         dxf_idbuffer_entity_pointer_free_list ((DxfIdbufferEntityPointer *) idbuffer->entity_pointer);
-        free (idbuffer);
+        dxf_free (idbuffer);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -462,7 +455,7 @@ dxf_idbuffer_free_list
  * \return \c id_code when successful, or \c EXIT_FAILURE when an error
  * occurred.
  */
-int
+uint64_t
 dxf_idbuffer_get_id_code
 (
         DxfIdbuffer *idbuffer
@@ -480,12 +473,6 @@ dxf_idbuffer_get_id_code
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (idbuffer->id_code < 0)
-        {
-                fprintf (stderr,
-                  (_("Warning in %s () a negative value was found.\n")),
-                  __FUNCTION__);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -504,7 +491,7 @@ dxf_idbuffer_set_id_code
 (
         DxfIdbuffer *idbuffer,
                 /*!< a pointer to a DXF \c IDBUFFER. */
-        int id_code
+        uint64_t id_code
                 /*!< Identification number for the entity.\n
                  * This is to be an unique (sequential) number in the DXF
                  * file. */
@@ -521,12 +508,6 @@ dxf_idbuffer_set_id_code
                   __FUNCTION__);
                 return (NULL);
         }
-        if (id_code < 0)
-        {
-                fprintf (stderr,
-                  (_("Warning in %s () a negative value was passed.\n")),
-                  __FUNCTION__);
-        }
         idbuffer->id_code = id_code;
 #if DEBUG
         DXF_DEBUG_END
@@ -539,12 +520,10 @@ dxf_idbuffer_set_id_code
  * \brief Get the pointer to the \c dictionary_owner_soft from a DXF
  * \c IDBUFFER object.
  *
- * \return a pointer to \c dictionary_owner_soft when successful, or
- * \c NULL when an error occurred.
- *
- * \warning No checks are performed on the returned pointer.
+ * \return the handle \c dictionary_owner_soft when successful, or
+ * 0 when an error occurred.
  */
-char *
+uint64_t
 dxf_idbuffer_get_dictionary_owner_soft
 (
         DxfIdbuffer *idbuffer
@@ -560,19 +539,12 @@ dxf_idbuffer_get_dictionary_owner_soft
                 fprintf (stderr,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
-                return (NULL);
-        }
-        if (idbuffer->dictionary_owner_soft ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
+                return (0);
         }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (idbuffer->dictionary_owner_soft));
+        return (idbuffer->dictionary_owner_soft);
 }
 
 
@@ -588,8 +560,8 @@ dxf_idbuffer_set_dictionary_owner_soft
 (
         DxfIdbuffer *idbuffer,
                 /*!< a pointer to a DXF \c IDBUFFER object. */
-        char *dictionary_owner_soft
-                /*!< a string containing the pointer to the \c
+        uint64_t dictionary_owner_soft
+                /*!< the handle of the \c
                  * dictionary_owner_soft for the entity. */
 )
 {
@@ -604,14 +576,7 @@ dxf_idbuffer_set_dictionary_owner_soft
                   __FUNCTION__);
                 return (NULL);
         }
-        if (dictionary_owner_soft == NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was passed.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
-        idbuffer->dictionary_owner_soft = strdup (dictionary_owner_soft);
+        idbuffer->dictionary_owner_soft = dictionary_owner_soft;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -624,10 +589,8 @@ dxf_idbuffer_set_dictionary_owner_soft
  * \c IDBUFFER object.
  *
  * \return soft pointer to the object owner.
- *
- * \warning No checks are performed on the returned pointer (string).
  */
-char *
+uint64_t
 dxf_idbuffer_get_object_owner_soft
 (
         DxfIdbuffer *idbuffer
@@ -643,19 +606,12 @@ dxf_idbuffer_get_object_owner_soft
                 fprintf (stderr,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
-                return (NULL);
-        }
-        if (idbuffer->object_owner_soft ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
+                return (0);
         }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (idbuffer->object_owner_soft));
+        return (idbuffer->object_owner_soft);
 }
 
 
@@ -668,8 +624,8 @@ dxf_idbuffer_set_object_owner_soft
 (
         DxfIdbuffer *idbuffer,
                 /*!< a pointer to a DXF \c IDBUFFER object. */
-        char *object_owner_soft
-                /*!< a string containing the pointer to the
+        uint64_t object_owner_soft
+                /*!< the handle of the
                  * \c object_owner_soft for the object. */
 )
 {
@@ -684,14 +640,7 @@ dxf_idbuffer_set_object_owner_soft
                   __FUNCTION__);
                 return (NULL);
         }
-        if (object_owner_soft == NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was passed.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
-        idbuffer->object_owner_soft = strdup (object_owner_soft);
+        idbuffer->object_owner_soft = object_owner_soft;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -703,12 +652,10 @@ dxf_idbuffer_set_object_owner_soft
  * \brief Get the pointer to the \c dictionary_owner_hard from a DXF
  * \c IDBUFFER object.
  *
- * \return a pointer to \c dictionary_owner_hard when successful, or
- * \c NULL when an error occurred.
- *
- * \warning No checks are performed on the returned pointer.
+ * \return the handle \c dictionary_owner_hard when successful, or
+ * 0 when an error occurred.
  */
-char *
+uint64_t
 dxf_idbuffer_get_dictionary_owner_hard
 (
         DxfIdbuffer *idbuffer
@@ -724,19 +671,12 @@ dxf_idbuffer_get_dictionary_owner_hard
                 fprintf (stderr,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
-                return (NULL);
-        }
-        if (idbuffer->dictionary_owner_soft ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
+                return (0);
         }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (idbuffer->dictionary_owner_hard));
+        return (idbuffer->dictionary_owner_hard);
 }
 
 
@@ -752,8 +692,8 @@ dxf_idbuffer_set_dictionary_owner_hard
 (
         DxfIdbuffer *idbuffer,
                 /*!< a pointer to a DXF \c IDBUFFER object. */
-        char *dictionary_owner_hard
-                /*!< a string containing the pointer to the \c
+        uint64_t dictionary_owner_hard
+                /*!< the handle of the \c
                  * dictionary_owner_hard for the entity. */
 )
 {
@@ -768,14 +708,7 @@ dxf_idbuffer_set_dictionary_owner_hard
                   __FUNCTION__);
                 return (NULL);
         }
-        if (dictionary_owner_hard == NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was passed.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
-        idbuffer->dictionary_owner_hard = strdup (dictionary_owner_hard);
+        idbuffer->dictionary_owner_hard = dictionary_owner_hard;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1010,7 +943,7 @@ dxf_idbuffer_entity_pointer_new ()
         size = sizeof (DxfIdbufferEntityPointer);
         /* avoid malloc of 0 bytes */
         if (size == 0) size = 1;
-        if ((entity_pointer = malloc (size)) == NULL)
+        if ((entity_pointer = dxf_malloc (size)) == NULL)
         {
                 fprintf (stderr,
                   (_("Error in %s () could not allocate memory.\n")),
@@ -1060,7 +993,7 @@ dxf_idbuffer_entity_pointer_init
                   __FUNCTION__);
                 return (NULL);
         }
-        entity_pointer->soft_pointer = strdup ("");
+        entity_pointer->soft_pointer = 0;
         entity_pointer->next = NULL;
 #if DEBUG
         DXF_DEBUG_END
@@ -1102,8 +1035,7 @@ dxf_idbuffer_entity_pointer_free
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        free (entity_pointer->soft_pointer);
-        free (entity_pointer);
+        dxf_free (entity_pointer);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1148,12 +1080,10 @@ dxf_idbuffer_entity_pointer_free_list
  * \brief Get the pointer to the \c soft_pointer from a DXF
  * \c DxfIdbufferEntityPointer object.
  *
- * \return a pointer to \c soft_pointer when successful, or
- * \c NULL when an error occurred.
- *
- * \warning No checks are performed on the returned pointer.
+ * \return the handle \c soft_pointer when successful, or
+ * 0 when an error occurred.
  */
-char *
+uint64_t
 dxf_idbuffer_entity_pointer_get_soft_pointer
 (
         DxfIdbufferEntityPointer *entity_pointer
@@ -1169,19 +1099,12 @@ dxf_idbuffer_entity_pointer_get_soft_pointer
                 fprintf (stderr,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
-                return (NULL);
-        }
-        if (entity_pointer->soft_pointer ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
+                return (0);
         }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (entity_pointer->soft_pointer));
+        return (entity_pointer->soft_pointer);
 }
 
 
@@ -1197,8 +1120,8 @@ dxf_idbuffer_entity_pointer_set_soft_pointer
 (
         DxfIdbufferEntityPointer *entity_pointer,
                 /*!< a pointer to a DXF \c DxfIdbufferEntityPointer object. */
-        char *soft_pointer
-                /*!< a string containing the pointer to the \c
+        uint64_t soft_pointer
+                /*!< the handle of the \c
                  * soft_pointer for the entity. */
 )
 {
@@ -1213,14 +1136,7 @@ dxf_idbuffer_entity_pointer_set_soft_pointer
                   __FUNCTION__);
                 return (NULL);
         }
-        if (soft_pointer == NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was passed.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
-        entity_pointer->soft_pointer = strdup (soft_pointer);
+        entity_pointer->soft_pointer = soft_pointer;
 #if DEBUG
         DXF_DEBUG_END
 #endif
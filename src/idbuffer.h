@@ -62,7 +62,7 @@ extern "C" {
 typedef struct
 dxf_idbuffer_entity_pointer_struct
 {
-        char *soft_pointer;
+        uint64_t soft_pointer;
                 /*!< Soft pointer reference to entity (multiple entries
                  * may exist).\n
                  * Group code = 330. */
@@ -79,19 +79,19 @@ typedef struct
 dxf_idbuffer_struct
 {
         /* Members common for all DXF objects. */
-        int id_code;
+        uint64_t id_code;
                 /*!< Identification number for the entity.\n
                  * This is to be an unique (sequential) number in the DXF
                  * file.\n
                  * Group code = 5. */
-        char *dictionary_owner_soft;
+        uint64_t dictionary_owner_soft;
                 /*!< Soft-pointer ID/handle to owner dictionary (optional).\n
                  * Group code = 330. */
-        char *object_owner_soft;
+        uint64_t object_owner_soft;
                 /*!< Soft-pointer ID/handle  to owner BLOCK_RECORD object.\n
                  * Group code = 330.\n
                  * \since Introduced in version R2000. */
-        char *dictionary_owner_hard;
+        uint64_t dictionary_owner_hard;
                 /*!< Hard owner ID/handle to owner dictionary (optional).\n
                  * Group code = 360. */
         /* Specific members for a DXF idbuffer. */
@@ -112,14 +112,14 @@ DxfIdbuffer *dxf_idbuffer_read (DxfFile *fp, DxfIdbuffer *idbuffer);
 int dxf_idbuffer_write (DxfFile *fp, DxfIdbuffer *idbuffer);
 int dxf_idbuffer_free (DxfIdbuffer *idbuffer);
 void dxf_idbuffer_free_list (DxfIdbuffer *id_buffers);
-int dxf_idbuffer_get_id_code (DxfIdbuffer *idbuffer);
-DxfIdbuffer *dxf_idbuffer_set_id_code (DxfIdbuffer *idbuffer, int id_code);
-char *dxf_idbuffer_get_dictionary_owner_soft (DxfIdbuffer *idbuffer);
-DxfIdbuffer *dxf_idbuffer_set_dictionary_owner_soft (DxfIdbuffer *idbuffer, char *dictionary_owner_soft);
-char *dxf_idbuffer_get_object_owner_soft (DxfIdbuffer *idbuffer);
-DxfIdbuffer *dxf_idbuffer_set_object_owner_soft (DxfIdbuffer *idbuffer, char *object_owner_soft);
-char *dxf_idbuffer_get_dictionary_owner_hard (DxfIdbuffer *idbuffer);
-DxfIdbuffer *dxf_idbuffer_set_dictionary_owner_hard (DxfIdbuffer *idbuffer, char *dictionary_owner_hard);
+uint64_t dxf_idbuffer_get_id_code (DxfIdbuffer *idbuffer);
+DxfIdbuffer *dxf_idbuffer_set_id_code (DxfIdbuffer *idbuffer, uint64_t id_code);
+uint64_t dxf_idbuffer_get_dictionary_owner_soft (DxfIdbuffer *idbuffer);
+DxfIdbuffer *dxf_idbuffer_set_dictionary_owner_soft (DxfIdbuffer *idbuffer, uint64_t dictionary_owner_soft);
+uint64_t dxf_idbuffer_get_object_owner_soft (DxfIdbuffer *idbuffer);
+DxfIdbuffer *dxf_idbuffer_set_object_owner_soft (DxfIdbuffer *idbuffer, uint64_t object_owner_soft);
+uint64_t dxf_idbuffer_get_dictionary_owner_hard (DxfIdbuffer *idbuffer);
+DxfIdbuffer *dxf_idbuffer_set_dictionary_owner_hard (DxfIdbuffer *idbuffer, uint64_t dictionary_owner_hard);
 DxfIdbufferEntityPointer *dxf_idbuffer_get_entity_pointer (DxfIdbuffer *idbuffer);
 DxfIdbuffer *dxf_idbuffer_set_entity_pointer (DxfIdbuffer *idbuffer, DxfIdbufferEntityPointer *entity_pointer);
 DxfIdbuffer *dxf_idbuffer_get_next (DxfIdbuffer *idbuffer);
@@ -129,8 +129,8 @@ DxfIdbufferEntityPointer *dxf_idbuffer_entity_pointer_new ();
 DxfIdbufferEntityPointer *dxf_idbuffer_entity_pointer_init (DxfIdbufferEntityPointer *entity_pointer);
 int dxf_idbuffer_entity_pointer_free (DxfIdbufferEntityPointer *entity_pointer);
 void dxf_idbuffer_entity_pointer_free_list (DxfIdbufferEntityPointer *entity_pointers);
-char *dxf_idbuffer_entity_pointer_get_soft_pointer (DxfIdbufferEntityPointer *entity_pointer);
-DxfIdbufferEntityPointer *dxf_idbuffer_entity_pointer_set_soft_pointer (DxfIdbufferEntityPointer *entity_pointer, char *soft_pointer);
+uint64_t dxf_idbuffer_entity_pointer_get_soft_pointer (DxfIdbufferEntityPointer *entity_pointer);
+DxfIdbufferEntityPointer *dxf_idbuffer_entity_pointer_set_soft_pointer (DxfIdbufferEntityPointer *entity_pointer, uint64_t soft_pointer);
 DxfIdbufferEntityPointer *dxf_idbuffer_entity_pointer_get_next (DxfIdbufferEntityPointer *entity_pointer);
 DxfIdbufferEntityPointer *dxf_idbuffer_entity_pointer_set_next (DxfIdbufferEntityPointer *entity_pointer, DxfIdbufferEntityPointer *next);
 DxfIdbufferEntityPointer *dxf_idbuffer_entity_pointer_get_last (DxfIdbufferEntityPointer *entity_pointer);
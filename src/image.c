@@ -46,6 +46,7 @@
 
 
 #include "image.h"
+#include "util.h"
 
 
 /*!
@@ -68,7 +69,7 @@ dxf_image_new ()
         size = sizeof (DxfImage);
         /* avoid malloc of 0 bytes */
         if (size == 0) size = 1;
-        if ((image = malloc (size)) == NULL)
+        if ((image = dxf_malloc (size)) == NULL)
         {
                 fprintf (stderr,
                   (_("Error in %s () could not allocate memory.\n")),
@@ -119,9 +120,9 @@ dxf_image_init
               return (NULL);
         }
         /* Assign initial values to members. */
-        image->id_code = 0;
-        image->linetype = strdup (DXF_DEFAULT_LINETYPE);
-        image->layer = strdup (DXF_DEFAULT_LAYER);
+        image->id_code = DXF_HANDLE_NONE;
+        image->linetype = dxf_strdup (DXF_DEFAULT_LINETYPE);
+        image->layer = dxf_strdup (DXF_DEFAULT_LAYER);
         image->elevation = 0.0;
         image->thickness = 0.0;
         image->linetype_scale = DXF_DEFAULT_LINETYPE_SCALE;
@@ -130,13 +131,13 @@ dxf_image_init
         image->paperspace = DXF_MODELSPACE;
         image->graphics_data_size = 0;
         image->shadow_mode = 0;
-        image->dictionary_owner_soft = strdup ("");
-        image->material = strdup ("");
-        image->dictionary_owner_hard = strdup ("");
+        image->dictionary_owner_soft = 0;
+        image->material = 0;
+        image->dictionary_owner_hard = 0;
         image->lineweight = 0;
-        image->plot_style_name = strdup ("");
+        image->plot_style_name = 0;
         image->color_value = 0;
-        image->color_name = strdup ("");
+        image->color_name = dxf_strdup ("");
         image->transparency = 0;
         image->image_display_properties = 0;
         image->clipping_boundary_type = 0;
@@ -146,14 +147,22 @@ dxf_image_init
         image->brightness = 50;
         image->contrast = 50;
         image->fade = 50;
-        image->imagedef_object = strdup ("");
-        image->imagedef_reactor_object = strdup ("");
+        image->imagedef_object = dxf_strdup ("");
+        image->imagedef_reactor_object = dxf_strdup ("");
+        image->p0.x = 0.0;
+        image->p0.y = 0.0;
+        image->p0.z = 0.0;
+        image->p1.x = 0.0;
+        image->p1.y = 0.0;
+        image->p1.z = 0.0;
+        image->p2.x = 0.0;
+        image->p2.y = 0.0;
+        image->p2.z = 0.0;
+        image->p3.x = 0.0;
+        image->p3.y = 0.0;
+        image->p3.z = 0.0;
         /* Initialize new structs for the following members later,
          * when they are required and when we have content. */
-        image->p0 = NULL;
-        image->p1 = NULL;
-        image->p2 = NULL;
-        image->p3 = NULL;
         image->p4 = NULL;
         image->binary_graphics_data = NULL;
         image->next = NULL;
@@ -187,7 +196,8 @@ dxf_image_read
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        char *temp_string = NULL;
+        char temp_string[DXF_MAX_STRING_LENGTH];
+        int group_code;
         DxfPoint *iter = NULL;
         int next_x4;
         DxfBinaryData *iter310 = NULL;
@@ -200,8 +210,6 @@ dxf_image_read
                 fprintf (stderr,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
-                /* Clean up. */
-                free (temp_string);
                 return (NULL);
         }
         if (image == NULL)
@@ -227,70 +235,6 @@ dxf_image_read
                         return (NULL);
                 }
         }
-        if (image->p0 == NULL)
-        {
-                fprintf (stderr,
-                  (_("Warning in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                fprintf (stderr,
-                  (_("Initializing a DxfPoint.\n")));
-                image->p0 = dxf_point_init (image->p0);
-                if (image->p0 == NULL)
-                {
-                        fprintf (stderr,
-                          (_("Error in %s () could not allocate memory.\n")),
-                          __FUNCTION__);
-                        return (NULL);
-                }
-        }
-        if (image->p1 == NULL)
-        {
-                fprintf (stderr,
-                  (_("Warning in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                fprintf (stderr,
-                  (_("Initializing a DxfPoint.\n")));
-                image->p1 = dxf_point_init (image->p1);
-                if (image->p1 == NULL)
-                {
-                        fprintf (stderr,
-                          (_("Error in %s () could not allocate memory.\n")),
-                          __FUNCTION__);
-                        return (NULL);
-                }
-        }
-        if (image->p2 == NULL)
-        {
-                fprintf (stderr,
-                  (_("Warning in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                fprintf (stderr,
-                  (_("Initializing a DxfPoint.\n")));
-                image->p2 = dxf_point_init (image->p2);
-                if (image->p2 == NULL)
-                {
-                        fprintf (stderr,
-                          (_("Error in %s () could not allocate memory.\n")),
-                          __FUNCTION__);
-                        return (NULL);
-                }
-        }
-        if (image->p3 == NULL)
-        {
-                fprintf (stderr,
-                  (_("Warning in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                fprintf (stderr,
-                  (_("Initializing a DxfPoint.\n")));
-                image->p3 = dxf_point_init (image->p3);
-                if (image->p3 == NULL)
-                {
-                        fprintf (stderr,
-                          (_("Error in %s () could not allocate memory.\n")),
-                          __FUNCTION__);
-                        return (NULL);
-                }
-        }
         if (image->p4 == NULL)
         {
                 fprintf (stderr,
@@ -312,392 +256,315 @@ dxf_image_read
         iter310 = (DxfBinaryData *) image->binary_graphics_data;
         iter330 = 0;
         iter360 = 0;
-        (fp->line_number)++;
-        fscanf (fp->fp, "%[^\n]", temp_string);
-        while (strcmp (temp_string, "0") != 0)
+        while ((dxf_read_group_code (fp, &group_code) == EXIT_SUCCESS)
+          && (group_code != 0))
         {
-                if (ferror (fp->fp))
+                if (dxf_read_error (fp))
                 {
                         fprintf (stderr,
                           (_("Error in %s () while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
-                        fclose (fp->fp);
-                        /* Clean up. */
-                        free (temp_string);
                         return (NULL);
                 }
-                if (strcmp (temp_string, "5") == 0)
-                {
-                        /* Now follows a string containing a sequential
-                         * id number. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%x\n", (uint *) &image->id_code);
-                }
-                else if (strcmp (temp_string, "6") == 0)
+                switch (group_code)
                 {
-                        /* Now follows a string containing a linetype
-                         * name. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, image->linetype);
-                }
-                else if (strcmp (temp_string, "8") == 0)
-                {
-                        /* Now follows a string containing a layer name. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, image->layer);
-                }
-                else if (strcmp (temp_string, "10") == 0)
-                {
-                        /* Now follows a string containing the
-                         * X-value of the insertion point coordinate. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &image->p0->x0);
-                }
-                else if (strcmp (temp_string, "20") == 0)
-                {
-                        /* Now follows a string containing the
-                         * Y-value of the insertion point coordinate. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &image->p0->y0);
-                }
-                else if (strcmp (temp_string, "30") == 0)
-                {
-                        /* Now follows a string containing the
-                         * Z-value of the insertion point coordinate. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &image->p0->z0);
-                }
-                else if (strcmp (temp_string, "11") == 0)
-                {
-                        /* Now follows a string containing the
-                         * X-value of the U-vector of a single pixel. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &image->p1->x0);
-                }
-                else if (strcmp (temp_string, "21") == 0)
-                {
-                        /* Now follows a string containing the
-                         * Y-value of the U-vector of a single pixel. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &image->p1->y0);
-                }
-                else if (strcmp (temp_string, "31") == 0)
-                {
-                        /* Now follows a string containing the
-                         * Z-value of the U-vector of a single pixel. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &image->p1->z0);
-                }
-                else if (strcmp (temp_string, "12") == 0)
-                {
-                        /* Now follows a string containing the
-                         * X-value of the V-vector of a single pixel. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &image->p2->x0);
-                }
-                else if (strcmp (temp_string, "22") == 0)
-                {
-                        /* Now follows a string containing the
-                         * Y-value of the V-vector of a single pixel. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &image->p2->y0);
-                }
-                else if (strcmp (temp_string, "32") == 0)
-                {
-                        /* Now follows a string containing the
-                         * Z-value of the V-vector of a single pixel. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &image->p2->z0);
-                }
-                else if (strcmp (temp_string, "13") == 0)
-                {
-                        /* Now follows a string containing the
-                         * U-value of image size in pixels. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &image->p3->x0);
-                }
-                else if (strcmp (temp_string, "23") == 0)
-                {
-                        /* Now follows a string containing the
-                         * V-value of image size in pixels. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &image->p3->y0);
-                }
-                else if (strcmp (temp_string, "14") == 0)
-                {
-                        /* Now follows a string containing the
-                         * X-value of a clip boundary vertex. */
-                        (fp->line_number)++;
-                        if (next_x4)
-                        {
-                                iter->next = (struct DxfPoint *) dxf_point_init ((DxfPoint *) iter->next);
-                                iter = (DxfPoint *) iter->next;
-                                next_x4 = 0;
-                        }
-                        fscanf (fp->fp, "%lf\n", &iter->x0);
-                }
-                else if (strcmp (temp_string, "24") == 0)
-                {
-                        /* Now follows a string containing the
-                         * Y-value of a clip boundary vertex. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &iter->y0);
-                        next_x4 = 1;
-                }
-                else if ((fp->acad_version_number <= AutoCAD_11)
-                        && (strcmp (temp_string, "38") == 0)
-                        && (image->elevation != 0.0))
-                {
-                        /* Now follows a string containing the
-                         * elevation. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &image->elevation);
-                }
-                else if (strcmp (temp_string, "39") == 0)
-                {
-                        /* Now follows a string containing the
-                         * thickness. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &image->thickness);
-                }
-                else if (strcmp (temp_string, "48") == 0)
-                {
-                        /* Now follows a string containing the linetype
-                         * scale. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &image->linetype_scale);
-                }
-                else if (strcmp (temp_string, "60") == 0)
-                {
-                        /* Now follows a string containing the
-                         * visibility value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%hd\n", &image->visibility);
-                }
-                else if (strcmp (temp_string, "62") == 0)
-                {
-                        /* Now follows a string containing the
-                         * color value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%hd\n", &image->color);
-                }
-                else if (strcmp (temp_string, "67") == 0)
-                {
-                        /* Now follows a string containing the
-                         * paperspace value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%hd\n", &image->paperspace);
-                }
-                else if (strcmp (temp_string, "70") == 0)
-                {
-                        /* Now follows a string containing the
-                         * image display properties. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%hd\n", &image->image_display_properties);
-                }
-                else if (strcmp (temp_string, "71") == 0)
-                {
-                        /* Now follows a string containing the
-                         * clipping boundary type. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%hd\n", &image->clipping_boundary_type);
-                }
-                else if (strcmp (temp_string, "90") == 0)
-                {
-                        /* Now follows a string containing the class
-                         * version. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%" PRIi32 "\n", &image->class_version);
-                }
-                else if (strcmp (temp_string, "91") == 0)
-                {
-                        /* Now follows a string containing the number of
-                         * clip boundary vertices. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%" PRIi32 "\n", &image->number_of_clip_boundary_vertices);
-                }
-                else if (strcmp (temp_string, "92") == 0)
-                {
-                        /* Now follows a string containing the
-                         * graphics data size value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%" PRIi32 "\n", &image->graphics_data_size);
-                }
-                else if ((fp->acad_version_number >= AutoCAD_13)
-                        && (strcmp (temp_string, "100") == 0))
-                {
-                        /* Now follows a string containing the
-                         * subclass marker value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
-                        if ((strcmp (temp_string, "AcDbEntity") != 0)
-                        && ((strcmp (temp_string, "AcDbRasterImage") != 0)))
-                        {
+                        case 5:
+                                /* Now follows a string containing a sequential
+                                 * id number. */
+                                dxf_read_handle (fp, &image->id_code);
+                                break;
+                        case 6:
+                                /* Now follows a string containing a linetype
+                                 * name. */
+                                dxf_read_string_interned (fp, &image->linetype);
+                                break;
+                        case 8:
+                                /* Now follows a string containing a layer name. */
+                                dxf_read_string_interned (fp, &image->layer);
+                                break;
+                        case 10:
+                                /* Now follows a string containing the
+                                 * X-value of the insertion point coordinate. */
+                                dxf_read_double (fp, &image->p0.x);
+                                break;
+                        case 20:
+                                /* Now follows a string containing the
+                                 * Y-value of the insertion point coordinate. */
+                                dxf_read_double (fp, &image->p0.y);
+                                break;
+                        case 30:
+                                /* Now follows a string containing the
+                                 * Z-value of the insertion point coordinate. */
+                                dxf_read_double (fp, &image->p0.z);
+                                break;
+                        case 11:
+                                /* Now follows a string containing the
+                                 * X-value of the U-vector of a single pixel. */
+                                dxf_read_double (fp, &image->p1.x);
+                                break;
+                        case 21:
+                                /* Now follows a string containing the
+                                 * Y-value of the U-vector of a single pixel. */
+                                dxf_read_double (fp, &image->p1.y);
+                                break;
+                        case 31:
+                                /* Now follows a string containing the
+                                 * Z-value of the U-vector of a single pixel. */
+                                dxf_read_double (fp, &image->p1.z);
+                                break;
+                        case 12:
+                                /* Now follows a string containing the
+                                 * X-value of the V-vector of a single pixel. */
+                                dxf_read_double (fp, &image->p2.x);
+                                break;
+                        case 22:
+                                /* Now follows a string containing the
+                                 * Y-value of the V-vector of a single pixel. */
+                                dxf_read_double (fp, &image->p2.y);
+                                break;
+                        case 32:
+                                /* Now follows a string containing the
+                                 * Z-value of the V-vector of a single pixel. */
+                                dxf_read_double (fp, &image->p2.z);
+                                break;
+                        case 13:
+                                /* Now follows a string containing the
+                                 * U-value of image size in pixels. */
+                                dxf_read_double (fp, &image->p3.x);
+                                break;
+                        case 23:
+                                /* Now follows a string containing the
+                                 * V-value of image size in pixels. */
+                                dxf_read_double (fp, &image->p3.y);
+                                break;
+                        case 14:
+                                /* Now follows a string containing the
+                                 * X-value of a clip boundary vertex. */
+                                if (next_x4)
+                                {
+                                        iter->next = (struct DxfPoint *) dxf_point_init ((DxfPoint *) iter->next);
+                                        iter = (DxfPoint *) iter->next;
+                                        next_x4 = 0;
+                                }
+                                dxf_read_double (fp, &iter->x0);
+                                break;
+                        case 24:
+                                /* Now follows a string containing the
+                                 * Y-value of a clip boundary vertex. */
+                                dxf_read_double (fp, &iter->y0);
+                                next_x4 = 1;
+                                break;
+                        case 38:
+                                if ((fp->acad_version_number <= AutoCAD_11) && (image->elevation != 0.0))
+                                {
+                                        /* Now follows a string containing the
+                                         * elevation. */
+                                        dxf_read_double (fp, &image->elevation);
+                                }
+                                else
+                                {
+                                        fprintf (stderr,
+                                          (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
+                                          __FUNCTION__, fp->filename, fp->line_number);
+                                        /* Skip the value of the unknown group code. */
+                                        dxf_read_line (temp_string, fp);
+                                }
+                                break;
+                        case 39:
+                                /* Now follows a string containing the
+                                 * thickness. */
+                                dxf_read_double (fp, &image->thickness);
+                                break;
+                        case 48:
+                                /* Now follows a string containing the linetype
+                                 * scale. */
+                                dxf_read_double (fp, &image->linetype_scale);
+                                break;
+                        case 60:
+                                /* Now follows a string containing the
+                                 * visibility value. */
+                                dxf_read_int16 (fp, &image->visibility);
+                                break;
+                        case 62:
+                                /* Now follows a string containing the
+                                 * color value. */
+                                dxf_read_int16 (fp, &image->color);
+                                break;
+                        case 67:
+                                /* Now follows a string containing the
+                                 * paperspace value. */
+                                dxf_read_int16 (fp, &image->paperspace);
+                                break;
+                        case 70:
+                                /* Now follows a string containing the
+                                 * image display properties. */
+                                dxf_read_int16 (fp, &image->image_display_properties);
+                                break;
+                        case 71:
+                                /* Now follows a string containing the
+                                 * clipping boundary type. */
+                                dxf_read_int16 (fp, &image->clipping_boundary_type);
+                                break;
+                        case 90:
+                                /* Now follows a string containing the class
+                                 * version. */
+                                dxf_read_int32 (fp, &image->class_version);
+                                break;
+                        case 91:
+                                /* Now follows a string containing the number of
+                                 * clip boundary vertices. */
+                                dxf_read_int32 (fp, &image->number_of_clip_boundary_vertices);
+                                break;
+                        case 92:
+                                /* Now follows a string containing the
+                                 * graphics data size value. */
+                                dxf_read_int32 (fp, &image->graphics_data_size);
+                                break;
+                        case 100:
+                                if (fp->acad_version_number >= AutoCAD_13)
+                                {
+                                        /* Now follows a string containing the
+                                         * subclass marker value. */
+                                        dxf_read_line (temp_string, fp);
+                                        if ((strcmp (temp_string, "AcDbEntity") != 0)
+                                        && ((strcmp (temp_string, "AcDbRasterImage") != 0)))
+                                        {
+                                                fprintf (stderr,
+                                                  (_("Warning in %s () found a bad subclass marker in: %s in line: %d.\n")),
+                                                  __FUNCTION__, fp->filename, fp->line_number);
+                                        }
+                                }
+                                else
+                                {
+                                        fprintf (stderr,
+                                          (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
+                                          __FUNCTION__, fp->filename, fp->line_number);
+                                        /* Skip the value of the unknown group code. */
+                                        dxf_read_line (temp_string, fp);
+                                }
+                                break;
+                        case 160:
+                                /* Now follows a string containing the
+                                 * graphics data size value. */
+                                dxf_read_int (fp, &image->graphics_data_size);
+                                break;
+                        case 280:
+                                /* Now follows a string containing the clipping
+                                 * state. */
+                                dxf_read_int16 (fp, &image->clipping_state);
+                                break;
+                        case 281:
+                                /* Now follows a string containing the
+                                 * brightness value. */
+                                dxf_read_int16 (fp, &image->brightness);
+                                break;
+                        case 282:
+                                /* Now follows a string containing the contrast
+                                 * value. */
+                                dxf_read_int16 (fp, &image->contrast);
+                                break;
+                        case 283:
+                                /* Now follows a string containing the fade
+                                 * value. */
+                                dxf_read_int16 (fp, &image->fade);
+                                break;
+                        case 284:
+                                /* Now follows a string containing the shadow
+                                 * mode value. */
+                                dxf_read_int16 (fp, &image->shadow_mode);
+                                break;
+                        case 310:
+                                /* Now follows a string containing binary
+                                 * graphics data. */
+                                iter310 = dxf_binary_data_read (fp, iter310);
+                                break;
+                        case 330:
+                                if (iter330 == 0)
+                                {
+                                        /* Now follows a string containing a soft-pointer
+                                         * ID/handle to owner dictionary. */
+                                        dxf_read_handle (fp, &image->dictionary_owner_soft);
+                                }
+                                if (iter330 == 1)
+                                {
+                                        /* Now follows a string containing a soft-pointer
+                                         * ID/handle to owner object. */
+                                        dxf_read_handle (fp, &image->object_owner_soft);
+                                }
+                                iter330++;
+                                break;
+                        case 340:
+                                /* Now follows a string containing a hard
+                                 * reference to imagedef object. */
+                                dxf_read_string (fp, &image->imagedef_object);
+                                break;
+                        case 347:
+                                /* Now follows a string containing a
+                                 * hard-pointer ID/handle to material object. */
+                                dxf_read_handle (fp, &image->material);
+                                break;
+                        case 360:
+                                if (iter360 == 0)
+                                {
+                                        /* Now follows a string containing a hard-pointer
+                                         * ID/handle to owner dictionary. */
+                                        dxf_read_handle (fp, &image->dictionary_owner_hard);
+                                }
+                                if (iter360 == 1)
+                                {
+                                        /* Now follows a string containing a hard
+                                         * reference to imagedef_reactor object. */
+                                        dxf_read_string (fp, &image->imagedef_reactor_object);
+                                }
+                                iter360++;
+                                break;
+                        case 370:
+                                /* Now follows a string containing the lineweight
+                                 * value. */
+                                dxf_read_int16 (fp, &image->lineweight);
+                                break;
+                        case 390:
+                                /* Now follows a string containing a plot style
+                                 * name value. */
+                                dxf_read_handle (fp, &image->plot_style_name);
+                                break;
+                        case 420:
+                                /* Now follows a string containing a color value. */
+                                dxf_read_int32 (fp, &image->color_value);
+                                break;
+                        case 430:
+                                /* Now follows a string containing a color
+                                 * name value. */
+                                dxf_read_string_interned (fp, &image->color_name);
+                                break;
+                        case 440:
+                                /* Now follows a string containing a transparency
+                                 * value. */
+                                dxf_read_int32 (fp, &image->transparency);
+                                break;
+                        case 999:
+                                /* Now follows a string containing a comment. */
+                                dxf_read_line (temp_string, fp);
+                                fprintf (stdout, "DXF comment: %s\n", temp_string);
+                                break;
+                        default:
                                 fprintf (stderr,
-                                  (_("Warning in %s () found a bad subclass marker in: %s in line: %d.\n")),
+                                  (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
                                   __FUNCTION__, fp->filename, fp->line_number);
-                        }
-                }
-                else if (strcmp (temp_string, "160") == 0)
-                {
-                        /* Now follows a string containing the
-                         * graphics data size value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%d\n", &image->graphics_data_size);
-                }
-                else if (strcmp (temp_string, "280") == 0)
-                {
-                        /* Now follows a string containing the clipping
-                         * state. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%hd\n", &image->clipping_state);
-                }
-                else if (strcmp (temp_string, "281") == 0)
-                {
-                        /* Now follows a string containing the
-                         * brightness value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%hd\n", &image->brightness);
-                }
-                else if (strcmp (temp_string, "282") == 0)
-                {
-                        /* Now follows a string containing the contrast
-                         * value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%hd\n", &image->contrast);
-                }
-                else if (strcmp (temp_string, "283") == 0)
-                {
-                        /* Now follows a string containing the fade
-                         * value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%hd\n", &image->fade);
-                }
-                else if (strcmp (temp_string, "284") == 0)
-                {
-                        /* Now follows a string containing the shadow
-                         * mode value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%hd\n", &image->shadow_mode);
-                }
-                else if (strcmp (temp_string, "310") == 0)
-                {
-                        /* Now follows a string containing binary
-                         * graphics data. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, iter310->data_line);
-                        dxf_binary_data_init ((DxfBinaryData *) iter310->next);
-                        iter310 = (DxfBinaryData *) iter310->next;
-                }
-                else if (strcmp (temp_string, "330") == 0)
-                {
-                        if (iter330 == 0)
-                        {
-                                /* Now follows a string containing a soft-pointer
-                                 * ID/handle to owner dictionary. */
-                                (fp->line_number)++;
-                                fscanf (fp->fp, DXF_MAX_STRING_FORMAT, image->dictionary_owner_soft);
-                        }
-                        if (iter330 == 1)
-                        {
-                                /* Now follows a string containing a soft-pointer
-                                 * ID/handle to owner object. */
-                                (fp->line_number)++;
-                                fscanf (fp->fp, DXF_MAX_STRING_FORMAT, image->object_owner_soft);
-                        }
-                        iter330++;
-                }
-                else if (strcmp (temp_string, "340") == 0)
-                {
-                        /* Now follows a string containing a hard
-                         * reference to imagedef object. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, image->imagedef_object);
-                }
-                else if (strcmp (temp_string, "347") == 0)
-                {
-                        /* Now follows a string containing a
-                         * hard-pointer ID/handle to material object. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, image->material);
-                }
-                else if (strcmp (temp_string, "360") == 0)
-                {
-                        if (iter360 == 0)
-                        {
-                                /* Now follows a string containing a hard-pointer
-                                 * ID/handle to owner dictionary. */
-                                (fp->line_number)++;
-                                fscanf (fp->fp, DXF_MAX_STRING_FORMAT, image->dictionary_owner_hard);
-                        }
-                        if (iter360 == 1)
-                        {
-                                /* Now follows a string containing a hard
-                                 * reference to imagedef_reactor object. */
-                                (fp->line_number)++;
-                                fscanf (fp->fp, DXF_MAX_STRING_FORMAT, image->imagedef_reactor_object);
-                        }
-                        iter360++;
-                }
-                else if (strcmp (temp_string, "370") == 0)
-                {
-                        /* Now follows a string containing the lineweight
-                         * value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%hd\n", &image->lineweight);
-                }
-                else if (strcmp (temp_string, "390") == 0)
-                {
-                        /* Now follows a string containing a plot style
-                         * name value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, image->plot_style_name);
-                }
-                else if (strcmp (temp_string, "420") == 0)
-                {
-                        /* Now follows a string containing a color value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%" PRIi32 "\n", &image->color_value);
-                }
-                else if (strcmp (temp_string, "430") == 0)
-                {
-                        /* Now follows a string containing a color
-                         * name value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, image->color_name);
-                }
-                else if (strcmp (temp_string, "440") == 0)
-                {
-                        /* Now follows a string containing a transparency
-                         * value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%" PRIi32 "\n", &image->transparency);
-                }
-                else if (strcmp (temp_string, "999") == 0)
-                {
-                        /* Now follows a string containing a comment. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
-                        fprintf (stdout, "DXF comment: %s\n", temp_string);
-                }
-                else
-                {
-                        fprintf (stderr,
-                          (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
-                          __FUNCTION__, fp->filename, fp->line_number);
+                                /* Skip the value of the unknown group code. */
+                                dxf_read_line (temp_string, fp);
+                                break;
                 }
         }
         /* Handle omitted members and/or illegal values. */
         if (strcmp (image->linetype, "") == 0)
         {
-                image->linetype = strdup (DXF_DEFAULT_LINETYPE);
+                image->linetype = dxf_strdup (DXF_DEFAULT_LINETYPE);
         }
         if (strcmp (image->layer, "") == 0)
         {
-                image->layer = strdup (DXF_DEFAULT_LAYER);
+                image->layer = dxf_strdup (DXF_DEFAULT_LAYER);
         }
-        /* Clean up. */
-        free (temp_string);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -723,7 +590,7 @@ dxf_image_write
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        char *dxf_entity_name = strdup ("IMAGE");
+        char *dxf_entity_name = dxf_strdup ("IMAGE");
         DxfPoint *iter = NULL;
 
         /* Do some basic checks. */
@@ -733,7 +600,7 @@ dxf_image_write
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (image == NULL)
@@ -742,7 +609,7 @@ dxf_image_write
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (fp->acad_version_number < AutoCAD_14)
@@ -754,28 +621,28 @@ dxf_image_write
         if (strcmp (image->linetype, "") == 0)
         {
                 fprintf (stderr,
-                  (_("Warning in %s () empty linetype string for the %s entity with id-code: %x\n")),
+                  (_("Warning in %s () empty linetype string for the %s entity with id-code: %" PRIx64 "\n")),
                   __FUNCTION__, dxf_entity_name, image->id_code);
                 fprintf (stderr,
                   (_("\t%s entity is reset to default linetype")),
                   dxf_entity_name);
-                image->linetype = strdup (DXF_DEFAULT_LINETYPE);
+                image->linetype = dxf_strdup (DXF_DEFAULT_LINETYPE);
         }
         if (strcmp (image->layer, "") == 0)
         {
                 fprintf (stderr,
-                  (_("Warning in %s () empty layer string for the %s entity with id-code: %x.\n")),
+                  (_("Warning in %s () empty layer string for the %s entity with id-code: %" PRIx64 ".\n")),
                   __FUNCTION__, dxf_entity_name, image->id_code);
                 fprintf (stderr,
                   (_("\t%s entity is relocated to default layer.\n")),
                   dxf_entity_name);
-                image->layer = strdup (DXF_DEFAULT_LAYER);
+                image->layer = dxf_strdup (DXF_DEFAULT_LAYER);
         }
         /* Start writing output. */
-        fprintf (fp->fp, "  0\n%s\n", dxf_entity_name);
-        if (image->id_code != -1)
+        dxf_write_string (fp, 0, dxf_entity_name);
+        if (image->id_code != DXF_HANDLE_NONE)
         {
-                fprintf (fp->fp, "  5\n%x\n", image->id_code);
+                dxf_write_hex (fp, 5, image->id_code);
         }
         /*!
          * \todo for version R14.\n
@@ -787,70 +654,70 @@ dxf_image_write
          * 102 groups are application defined (optional).\n\n
          * End of group, "}" (optional), with Group code 102.
          */
-        if ((strcmp (image->dictionary_owner_soft, "") != 0)
+        if ((image->dictionary_owner_soft != 0)
           && (fp->acad_version_number >= AutoCAD_14))
         {
-                fprintf (fp->fp, "102\n{ACAD_REACTORS\n");
-                fprintf (fp->fp, "330\n%s\n", image->dictionary_owner_soft);
-                fprintf (fp->fp, "102\n}\n");
+                dxf_write_string (fp, 102, "{ACAD_REACTORS");
+                dxf_write_hex (fp, 330, image->dictionary_owner_soft);
+                dxf_write_string (fp, 102, "}");
         }
-        if ((strcmp (image->dictionary_owner_hard, "") != 0)
+        if ((image->dictionary_owner_hard != 0)
           && (fp->acad_version_number >= AutoCAD_14))
         {
-                fprintf (fp->fp, "102\n{ACAD_XDICTIONARY\n");
-                fprintf (fp->fp, "360\n%s\n", image->dictionary_owner_hard);
-                fprintf (fp->fp, "102\n}\n");
+                dxf_write_string (fp, 102, "{ACAD_XDICTIONARY");
+                dxf_write_hex (fp, 360, image->dictionary_owner_hard);
+                dxf_write_string (fp, 102, "}");
         }
-        if ((strcmp (image->object_owner_soft, "") != 0)
+        if ((image->object_owner_soft != 0)
           && (fp->acad_version_number >= AutoCAD_2000))
         {
-                fprintf (fp->fp, "330\n%s\n", image->object_owner_soft);
+                dxf_write_hex (fp, 330, image->object_owner_soft);
         }
         if (fp->acad_version_number >= AutoCAD_13)
         {
-                fprintf (fp->fp, "100\nAcDbEntity\n");
+                dxf_write_string (fp, 100, "AcDbEntity");
         }
         if (image->paperspace == DXF_PAPERSPACE)
         {
-                fprintf (fp->fp, " 67\n%hd\n", (int16_t) DXF_PAPERSPACE);
+                dxf_write_int (fp, 67, (int16_t) DXF_PAPERSPACE);
         }
-        fprintf (fp->fp, "  8\n%s\n", image->layer);
+        dxf_write_string (fp, 8, image->layer);
         if (strcmp (image->linetype, DXF_DEFAULT_LINETYPE) != 0)
         {
-                fprintf (fp->fp, "  6\n%s\n", image->linetype);
+                dxf_write_string (fp, 6, image->linetype);
         }
         if ((fp->acad_version_number >= AutoCAD_2008)
-          && (strcmp (image->material, "") != 0))
+          && (image->material != 0))
         {
-                fprintf (fp->fp, "347\n%s\n", image->material);
+                dxf_write_hex (fp, 347, image->material);
         }
         if ((fp->acad_version_number <= AutoCAD_11)
           && DXF_FLATLAND
           && (image->elevation != 0.0))
         {
-                fprintf (fp->fp, " 38\n%f\n", image->elevation);
+                dxf_write_double (fp, 38, image->elevation);
         }
         if (image->color != DXF_COLOR_BYLAYER)
         {
-                fprintf (fp->fp, " 62\n%hd\n", image->color);
+                dxf_write_int (fp, 62, image->color);
         }
         if (fp->acad_version_number >= AutoCAD_2002)
         {
-                fprintf (fp->fp, "370\n%d\n", image->lineweight);
+                dxf_write_int (fp, 370, image->lineweight);
         }
         if (image->linetype_scale != 1.0)
         {
-                fprintf (fp->fp, " 48\n%f\n", image->linetype_scale);
+                dxf_write_double (fp, 48, image->linetype_scale);
         }
         if (image->visibility != 0)
         {
-                fprintf (fp->fp, " 60\n%hd\n", image->visibility);
+                dxf_write_int (fp, 60, image->visibility);
         }        if (fp->acad_version_number >= AutoCAD_2000)
         {
 #ifdef BUILD_64
-                fprintf (fp->fp, "160\n%" PRIi32 "\n", image->graphics_data_size);
+                dxf_write_int (fp, 160, image->graphics_data_size);
 #else
-                fprintf (fp->fp, " 92\n%" PRIi32 "\n", image->graphics_data_size);
+                dxf_write_int (fp, 92, image->graphics_data_size);
 #endif
                 if (image->binary_graphics_data != NULL)
                 {
@@ -858,63 +725,63 @@ dxf_image_write
                         iter = (DxfBinaryData *) image->binary_graphics_data;
                         while (iter != NULL)
                         {
-                                fprintf (fp->fp, "310\n%s\n", iter->data_line);
+                                dxf_binary_data_write (fp, iter);
                                 iter = (DxfBinaryData *) iter->next;
                         }
                 }
         }
         if (fp->acad_version_number >= AutoCAD_2004)
         {
-                fprintf (fp->fp, "420\n%" PRIi32 "\n", image->color_value);
-                fprintf (fp->fp, "430\n%s\n", image->color_name);
-                fprintf (fp->fp, "440\n%" PRIi32 "\n", image->transparency);
+                dxf_write_int (fp, 420, image->color_value);
+                dxf_write_string (fp, 430, image->color_name);
+                dxf_write_int (fp, 440, image->transparency);
         }
         if (fp->acad_version_number >= AutoCAD_2009)
         {
-                fprintf (fp->fp, "390\n%s\n", image->plot_style_name);
-                fprintf (fp->fp, "284\n%d\n", image->shadow_mode);
+                dxf_write_hex (fp, 390, image->plot_style_name);
+                dxf_write_int (fp, 284, image->shadow_mode);
         }
         if (fp->acad_version_number >= AutoCAD_13)
         {
-                fprintf (fp->fp, "100\nAcDbRasterImage\n");
+                dxf_write_string (fp, 100, "AcDbRasterImage");
         }
         if (image->thickness != 0.0)
         {
-                fprintf (fp->fp, " 39\n%f\n", image->thickness);
-        }
-        fprintf (fp->fp, " 90\n%" PRIi32 "\n", image->class_version);
-        fprintf (fp->fp, " 10\n%f\n", image->p0->x0);
-        fprintf (fp->fp, " 20\n%f\n", image->p0->y0);
-        fprintf (fp->fp, " 30\n%f\n", image->p0->z0);
-        fprintf (fp->fp, " 11\n%f\n", image->p1->x0);
-        fprintf (fp->fp, " 21\n%f\n", image->p1->y0);
-        fprintf (fp->fp, " 31\n%f\n", image->p1->z0);
-        fprintf (fp->fp, " 12\n%f\n", image->p2->x0);
-        fprintf (fp->fp, " 22\n%f\n", image->p2->y0);
-        fprintf (fp->fp, " 32\n%f\n", image->p2->z0);
-        fprintf (fp->fp, " 13\n%f\n", image->p3->x0);
-        fprintf (fp->fp, " 23\n%f\n", image->p3->y0);
-        fprintf (fp->fp, "340\n%s\n", image->imagedef_object);
-        fprintf (fp->fp, " 70\n%hd\n", image->image_display_properties);
-        fprintf (fp->fp, "280\n%hd\n", image->clipping_state);
-        fprintf (fp->fp, "281\n%hd\n", image->brightness);
-        fprintf (fp->fp, "282\n%hd\n", image->contrast);
-        fprintf (fp->fp, "283\n%hd\n", image->fade);
-        fprintf (fp->fp, "360\n%s\n", image->imagedef_reactor_object);
-        fprintf (fp->fp, " 71\n%hd\n", image->clipping_boundary_type);
-        fprintf (fp->fp, " 91\n%" PRIi32 "\n", image->number_of_clip_boundary_vertices);
+                dxf_write_double (fp, 39, image->thickness);
+        }
+        dxf_write_int (fp, 90, image->class_version);
+        dxf_write_double (fp, 10, image->p0.x);
+        dxf_write_double (fp, 20, image->p0.y);
+        dxf_write_double (fp, 30, image->p0.z);
+        dxf_write_double (fp, 11, image->p1.x);
+        dxf_write_double (fp, 21, image->p1.y);
+        dxf_write_double (fp, 31, image->p1.z);
+        dxf_write_double (fp, 12, image->p2.x);
+        dxf_write_double (fp, 22, image->p2.y);
+        dxf_write_double (fp, 32, image->p2.z);
+        dxf_write_double (fp, 13, image->p3.x);
+        dxf_write_double (fp, 23, image->p3.y);
+        dxf_write_string (fp, 340, image->imagedef_object);
+        dxf_write_int (fp, 70, image->image_display_properties);
+        dxf_write_int (fp, 280, image->clipping_state);
+        dxf_write_int (fp, 281, image->brightness);
+        dxf_write_int (fp, 282, image->contrast);
+        dxf_write_int (fp, 283, image->fade);
+        dxf_write_string (fp, 360, image->imagedef_reactor_object);
+        dxf_write_int (fp, 71, image->clipping_boundary_type);
+        dxf_write_int (fp, 91, image->number_of_clip_boundary_vertices);
         /* Now follows a sinle linked list of points (vertices).
          * We do not keep track of the number of points (vertices),
          * we just traverse down until the first NULL pointer is found.  */
         iter = (DxfPoint *) image->p4;
         while (iter != NULL)
         {
-                fprintf (fp->fp, " 14\n%f\n", iter->x0);
-                fprintf (fp->fp, " 24\n%f\n", iter->y0);
+                dxf_write_double (fp, 14, iter->x0);
+                dxf_write_double (fp, 24, iter->y0);
                 iter = (DxfPoint *) iter->next;
         }
         /* Clean up. */
-        free (dxf_entity_name);
+        dxf_free (dxf_entity_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -955,23 +822,14 @@ dxf_image_free
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        free (image->linetype);
-        free (image->layer);
+        dxf_string_free (image->linetype);
+        dxf_string_free (image->layer);
         dxf_binary_data_free_list (image->binary_graphics_data);
-        free (image->dictionary_owner_soft);
-        free (image->material);
-        free (image->dictionary_owner_hard);
-        free (image->object_owner_soft);
-        free (image->plot_style_name);
-        free (image->color_name);
-        dxf_point_free (image->p0);
-        dxf_point_free (image->p1);
-        dxf_point_free (image->p2);
-        dxf_point_free (image->p3);
+        dxf_string_free (image->color_name);
         dxf_point_free_list (image->p4);
-        free (image->imagedef_object);
-        free (image->imagedef_reactor_object);
-        free (image);
+        dxf_free (image->imagedef_object);
+        dxf_free (image->imagedef_reactor_object);
+        dxf_free (image);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1018,7 +876,7 @@ dxf_image_free_list
  * \return \c id_code when successful, or \c EXIT_FAILURE when an error
  * occurred.
  */
-int
+uint64_t
 dxf_image_get_id_code
 (
         DxfImage *image
@@ -1036,12 +894,6 @@ dxf_image_get_id_code
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (image->id_code < 0)
-        {
-                fprintf (stderr,
-                  (_("Warning in %s () a negative value was found.\n")),
-                  __FUNCTION__);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1060,7 +912,7 @@ dxf_image_set_id_code
 (
         DxfImage *image,
                 /*!< a pointer to a DXF \c IMAGE entity. */
-        int id_code
+        uint64_t id_code
                 /*!< Identification number for the entity.\n
                  * This is to be an unique (sequential) number in the DXF
                  * file. */
@@ -1077,12 +929,6 @@ dxf_image_set_id_code
                   __FUNCTION__);
                 return (NULL);
         }
-        if (id_code < 0)
-        {
-                fprintf (stderr,
-                  (_("Warning in %s () a negative value was passed.\n")),
-                  __FUNCTION__);
-        }
         image->id_code = id_code;
 #if DEBUG
         DXF_DEBUG_END
@@ -1124,7 +970,7 @@ dxf_image_get_linetype
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (image->linetype));
+        return (dxf_strdup (image->linetype));
 }
 
 
@@ -1161,7 +1007,7 @@ dxf_image_set_linetype
                   __FUNCTION__);
                 return (NULL);
         }
-        image->linetype = strdup (linetype);
+        image->linetype = dxf_strdup (linetype);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1202,7 +1048,7 @@ dxf_image_get_layer
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (image->layer));
+        return (dxf_strdup (image->layer));
 }
 
 
@@ -1239,7 +1085,7 @@ dxf_image_set_layer
                   __FUNCTION__);
                 return (NULL);
         }
-        image->layer = strdup (layer);
+        image->layer = dxf_strdup (layer);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1992,12 +1838,10 @@ dxf_image_set_binary_graphics_data
  * \brief Get the pointer to the \c dictionary_owner_soft from a DXF
  * \c IMAGE entity.
  *
- * \return a pointer to \c dictionary_owner_soft when successful, or
- * \c NULL when an error occurred.
- *
- * \warning No checks are performed on the returned pointer.
+ * \return the handle \c dictionary_owner_soft when successful, or
+ * 0 when an error occurred.
  */
-char *
+uint64_t
 dxf_image_get_dictionary_owner_soft
 (
         DxfImage *image
@@ -2013,19 +1857,12 @@ dxf_image_get_dictionary_owner_soft
                 fprintf (stderr,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
-                return (NULL);
-        }
-        if (image->dictionary_owner_soft ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
+                return (0);
         }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (image->dictionary_owner_soft));
+        return (image->dictionary_owner_soft);
 }
 
 
@@ -2041,8 +1878,8 @@ dxf_image_set_dictionary_owner_soft
 (
         DxfImage *image,
                 /*!< a pointer to a DXF \c IMAGE entity. */
-        char *dictionary_owner_soft
-                /*!< a string containing the pointer to the \c
+        uint64_t dictionary_owner_soft
+                /*!< the handle of the \c
                  * dictionary_owner_soft for the entity. */
 )
 {
@@ -2057,14 +1894,7 @@ dxf_image_set_dictionary_owner_soft
                   __FUNCTION__);
                 return (NULL);
         }
-        if (dictionary_owner_soft == NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was passed.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
-        image->dictionary_owner_soft = strdup (dictionary_owner_soft);
+        image->dictionary_owner_soft = dictionary_owner_soft;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2077,10 +1907,8 @@ dxf_image_set_dictionary_owner_soft
  * \c IMAGE entity.
  *
  * \return soft pointer to the object owner.
- *
- * \warning No checks are performed on the returned pointer (string).
  */
-char *
+uint64_t
 dxf_image_get_object_owner_soft
 (
         DxfImage *image
@@ -2096,19 +1924,12 @@ dxf_image_get_object_owner_soft
                 fprintf (stderr,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
-                return (NULL);
-        }
-        if (image->object_owner_soft ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
+                return (0);
         }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (image->object_owner_soft));
+        return (image->object_owner_soft);
 }
 
 
@@ -2121,8 +1942,8 @@ dxf_image_set_object_owner_soft
 (
         DxfImage *image,
                 /*!< a pointer to a DXF \c IMAGE entity. */
-        char *object_owner_soft
-                /*!< a string containing the pointer to the
+        uint64_t object_owner_soft
+                /*!< the handle of the
                  * \c object_owner_soft for the entity. */
 )
 {
@@ -2137,14 +1958,7 @@ dxf_image_set_object_owner_soft
                   __FUNCTION__);
                 return (NULL);
         }
-        if (object_owner_soft == NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was passed.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
-        image->object_owner_soft = strdup (object_owner_soft);
+        image->object_owner_soft = object_owner_soft;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2155,12 +1969,10 @@ dxf_image_set_object_owner_soft
 /*!
  * \brief Get the pointer to the \c material from a DXF \c IMAGE entity.
  *
- * \return a pointer to \c material when successful, or \c NULL when an
+ * \return the handle \c material when successful, or 0 when an
  * error occurred.
- *
- * \warning No checks are performed on the returned pointer.
  */
-char *
+uint64_t
 dxf_image_get_material
 (
         DxfImage *image
@@ -2176,19 +1988,12 @@ dxf_image_get_material
                 fprintf (stderr,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
-                return (NULL);
-        }
-        if (image->material ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
+                return (0);
         }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (image->material));
+        return (image->material);
 }
 
 
@@ -2203,8 +2008,8 @@ dxf_image_set_material
 (
         DxfImage *image,
                 /*!< a pointer to a DXF \c IMAGE entity. */
-        char *material
-                /*!< a string containing the pointer to the \c
+        uint64_t material
+                /*!< the handle of the \c
                  * material for the entity. */
 )
 {
@@ -2219,14 +2024,7 @@ dxf_image_set_material
                   __FUNCTION__);
                 return (NULL);
         }
-        if (material == NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was passed.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
-        image->material = strdup (material);
+        image->material = material;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2238,12 +2036,10 @@ dxf_image_set_material
  * \brief Get the pointer to the \c dictionary_owner_hard from a DXF
  * \c IMAGE entity.
  *
- * \return a pointer to \c dictionary_owner_hard when successful, or
- * \c NULL when an error occurred.
- *
- * \warning No checks are performed on the returned pointer.
+ * \return the handle \c dictionary_owner_hard when successful, or
+ * 0 when an error occurred.
  */
-char *
+uint64_t
 dxf_image_get_dictionary_owner_hard
 (
         DxfImage *image
@@ -2259,19 +2055,12 @@ dxf_image_get_dictionary_owner_hard
                 fprintf (stderr,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
-                return (NULL);
-        }
-        if (image->dictionary_owner_hard ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
+                return (0);
         }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (image->dictionary_owner_hard));
+        return (image->dictionary_owner_hard);
 }
 
 
@@ -2287,8 +2076,8 @@ dxf_image_set_dictionary_owner_hard
 (
         DxfImage *image,
                 /*!< a pointer to a DXF \c IMAGE entity. */
-        char *dictionary_owner_hard
-                /*!< a string containing the pointer to the \c
+        uint64_t dictionary_owner_hard
+                /*!< the handle of the \c
                  * dictionary_owner_hard for the entity. */
 )
 {
@@ -2303,14 +2092,7 @@ dxf_image_set_dictionary_owner_hard
                   __FUNCTION__);
                 return (NULL);
         }
-        if (dictionary_owner_hard == NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was passed.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
-        image->dictionary_owner_hard = strdup (dictionary_owner_hard);
+        image->dictionary_owner_hard = dictionary_owner_hard;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2386,10 +2168,10 @@ dxf_image_set_lineweight
 /*!
  * \brief Get the \c plot_style_name from a DXF \c IMAGE entity.
  *
- * \return \c plot_style_name when sucessful, or \c NULL when an error
+ * \return \c plot_style_name when sucessful, or 0 when an error
  * occurred.
  */
-char *
+uint64_t
 dxf_image_get_plot_style_name
 (
         DxfImage *image
@@ -2405,19 +2187,12 @@ dxf_image_get_plot_style_name
                 fprintf (stderr,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
-                return (NULL);
-        }
-        if (image->plot_style_name ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
+                return (0);
         }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (image->plot_style_name));
+        return (image->plot_style_name);
 }
 
 
@@ -2432,7 +2207,7 @@ dxf_image_set_plot_style_name
 (
         DxfImage *image,
                 /*!< a pointer to a DXF \c IMAGE entity. */
-        char *plot_style_name
+        uint64_t plot_style_name
                 /*!< a string containing the \c plot_style_name for the
                  * entity. */
 )
@@ -2448,14 +2223,7 @@ dxf_image_set_plot_style_name
                   __FUNCTION__);
                 return (NULL);
         }
-        if (plot_style_name == NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was passed.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
-        image->plot_style_name = strdup (plot_style_name);
+        image->plot_style_name = plot_style_name;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2562,7 +2330,7 @@ dxf_image_get_color_name
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (image->color_name));
+        return (dxf_strdup (image->color_name));
 }
 
 
@@ -2600,7 +2368,7 @@ dxf_image_set_color_name
                   __FUNCTION__);
                 return (NULL);
         }
-        image->color_name = strdup (color_name);
+        image->color_name = dxf_strdup (color_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2678,7 +2446,7 @@ dxf_image_set_transparency
  *
  * \return the insertion point \c p0.
  */
-DxfPoint *
+DxfVec3 *
 dxf_image_get_p0
 (
         DxfImage *image
@@ -2696,17 +2464,10 @@ dxf_image_get_p0
                   __FUNCTION__);
                 return (NULL);
         }
-        if (image->p0 == NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (image->p0);
+        return (&image->p0);
 }
 
 
@@ -2720,8 +2481,8 @@ dxf_image_set_p0
 (
         DxfImage *image,
                 /*!< a pointer to a DXF \c IMAGE entity. */
-        DxfPoint *p0
-                /*!< a pointer to a DXF \c POINT entity. */
+        DxfVec3 *p0
+                /*!< a pointer to the coordinates. */
 )
 {
 #ifdef DEBUG
@@ -2742,7 +2503,7 @@ dxf_image_set_p0
                   __FUNCTION__);
                 return (NULL);
         }
-        image->p0 = p0;
+        image->p0 = *p0;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2775,17 +2536,10 @@ dxf_image_get_x0
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (image->p0 == NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (EXIT_FAILURE);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (image->p0->x0);
+        return (image->p0.x);
 }
 
 
@@ -2817,23 +2571,7 @@ dxf_image_set_x0
                   __FUNCTION__);
                 return (NULL);
         }
-        if (image->p0 == NULL)
-        {
-                fprintf (stderr,
-                  (_("Warning in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                fprintf (stderr,
-                  (_("Initializing a DxfPoint.\n")));
-                image->p0 = dxf_point_init (image->p0);
-                if (image->p0 == NULL)
-                {
-                        fprintf (stderr,
-                          (_("Error in %s () could not allocate memory.\n")),
-                          __FUNCTION__);
-                        return (NULL);
-                }
-        }
-        image->p0->x0 = x0;
+        image->p0.x = x0;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2866,17 +2604,10 @@ dxf_image_get_y0
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (image->p0 == NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (EXIT_FAILURE);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (image->p0->y0);
+        return (image->p0.y);
 }
 
 
@@ -2908,23 +2639,7 @@ dxf_image_set_y0
                   __FUNCTION__);
                 return (NULL);
         }
-        if (image->p0 == NULL)
-        {
-                fprintf (stderr,
-                  (_("Warning in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                fprintf (stderr,
-                  (_("Initializing a DxfPoint.\n")));
-                image->p0 = dxf_point_init (image->p0);
-                if (image->p0 == NULL)
-                {
-                        fprintf (stderr,
-                          (_("Error in %s () could not allocate memory.\n")),
-                          __FUNCTION__);
-                        return (NULL);
-                }
-        }
-        image->p0->y0 = y0;
+        image->p0.y = y0;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2957,17 +2672,10 @@ dxf_image_get_z0
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (image->p0 == NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (EXIT_FAILURE);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (image->p0->z0);
+        return (image->p0.z);
 }
 
 
@@ -2999,23 +2707,7 @@ dxf_image_set_z0
                   __FUNCTION__);
                 return (NULL);
         }
-        if (image->p0 == NULL)
-        {
-                fprintf (stderr,
-                  (_("Warning in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                fprintf (stderr,
-                  (_("Initializing a DxfPoint.\n")));
-                image->p0 = dxf_point_init (image->p0);
-                if (image->p0 == NULL)
-                {
-                        fprintf (stderr,
-                          (_("Error in %s () could not allocate memory.\n")),
-                          __FUNCTION__);
-                        return (NULL);
-                }
-        }
-        image->p0->z0 = z0;
+        image->p0.z = z0;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -3029,7 +2721,7 @@ dxf_image_set_z0
  *
  * \return the U-vector of a single pixel \c p1.
  */
-DxfPoint *
+DxfVec3 *
 dxf_image_get_p1
 (
         DxfImage *image
@@ -3047,17 +2739,10 @@ dxf_image_get_p1
                   __FUNCTION__);
                 return (NULL);
         }
-        if (image->p1 == NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (image->p1);
+        return (&image->p1);
 }
 
 
@@ -3072,8 +2757,8 @@ dxf_image_set_p1
 (
         DxfImage *image,
                 /*!< a pointer to a DXF \c IMAGE entity. */
-        DxfPoint *p1
-                /*!< a pointer to a DXF \c POINT entity. */
+        DxfVec3 *p1
+                /*!< a pointer to the coordinates. */
 )
 {
 #ifdef DEBUG
@@ -3094,7 +2779,7 @@ dxf_image_set_p1
                   __FUNCTION__);
                 return (NULL);
         }
-        image->p1 = p1;
+        image->p1 = *p1;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -3127,17 +2812,10 @@ dxf_image_get_x1
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (image->p1 == NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (EXIT_FAILURE);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (image->p1->x0);
+        return (image->p1.x);
 }
 
 
@@ -3169,23 +2847,7 @@ dxf_image_set_x1
                   __FUNCTION__);
                 return (NULL);
         }
-        if (image->p1 == NULL)
-        {
-                fprintf (stderr,
-                  (_("Warning in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                fprintf (stderr,
-                  (_("Initializing a DxfPoint.\n")));
-                image->p1 = dxf_point_init (image->p1);
-                if (image->p1 == NULL)
-                {
-                        fprintf (stderr,
-                          (_("Error in %s () could not allocate memory.\n")),
-                          __FUNCTION__);
-                        return (NULL);
-                }
-        }
-        image->p1->x0 = x1;
+        image->p1.x = x1;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -3218,17 +2880,10 @@ dxf_image_get_y1
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (image->p1 == NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (EXIT_FAILURE);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (image->p1->y0);
+        return (image->p1.y);
 }
 
 
@@ -3260,23 +2915,7 @@ dxf_image_set_y1
                   __FUNCTION__);
                 return (NULL);
         }
-        if (image->p1 == NULL)
-        {
-                fprintf (stderr,
-                  (_("Warning in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                fprintf (stderr,
-                  (_("Initializing a DxfPoint.\n")));
-                image->p1 = dxf_point_init (image->p1);
-                if (image->p1 == NULL)
-                {
-                        fprintf (stderr,
-                          (_("Error in %s () could not allocate memory.\n")),
-                          __FUNCTION__);
-                        return (NULL);
-                }
-        }
-        image->p1->y0 = y1;
+        image->p1.y = y1;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -3309,17 +2948,10 @@ dxf_image_get_z1
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (image->p1 == NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (EXIT_FAILURE);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (image->p1->z0);
+        return (image->p1.z);
 }
 
 
@@ -3351,23 +2983,7 @@ dxf_image_set_z1
                   __FUNCTION__);
                 return (NULL);
         }
-        if (image->p1 == NULL)
-        {
-                fprintf (stderr,
-                  (_("Warning in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                fprintf (stderr,
-                  (_("Initializing a DxfPoint.\n")));
-                image->p1 = dxf_point_init (image->p1);
-                if (image->p1 == NULL)
-                {
-                        fprintf (stderr,
-                          (_("Error in %s () could not allocate memory.\n")),
-                          __FUNCTION__);
-                        return (NULL);
-                }
-        }
-        image->p1->z0 = z1;
+        image->p1.z = z1;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -3381,7 +2997,7 @@ dxf_image_set_z1
  *
  * \return the V-vector of a single pixel \c p2.
  */
-DxfPoint *
+DxfVec3 *
 dxf_image_get_p2
 (
         DxfImage *image
@@ -3399,17 +3015,10 @@ dxf_image_get_p2
                   __FUNCTION__);
                 return (NULL);
         }
-        if (image->p2 == NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (image->p2);
+        return (&image->p2);
 }
 
 
@@ -3424,8 +3033,8 @@ dxf_image_set_p2
 (
         DxfImage *image,
                 /*!< a pointer to a DXF \c IMAGE entity. */
-        DxfPoint *p2
-                /*!< a pointer to a DXF \c POINT entity. */
+        DxfVec3 *p2
+                /*!< a pointer to the coordinates. */
 )
 {
 #ifdef DEBUG
@@ -3446,7 +3055,7 @@ dxf_image_set_p2
                   __FUNCTION__);
                 return (NULL);
         }
-        image->p2 = p2;
+        image->p2 = *p2;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -3479,17 +3088,10 @@ dxf_image_get_x2
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (image->p2 == NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (EXIT_FAILURE);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (image->p2->x0);
+        return (image->p2.x);
 }
 
 
@@ -3521,23 +3123,7 @@ dxf_image_set_x2
                   __FUNCTION__);
                 return (NULL);
         }
-        if (image->p2 == NULL)
-        {
-                fprintf (stderr,
-                  (_("Warning in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                fprintf (stderr,
-                  (_("Initializing a DxfPoint.\n")));
-                image->p2 = dxf_point_init (image->p2);
-                if (image->p2 == NULL)
-                {
-                        fprintf (stderr,
-                          (_("Error in %s () could not allocate memory.\n")),
-                          __FUNCTION__);
-                        return (NULL);
-                }
-        }
-        image->p2->x0 = x2;
+        image->p2.x = x2;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -3570,17 +3156,10 @@ dxf_image_get_y2
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (image->p2 == NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (EXIT_FAILURE);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (image->p2->y0);
+        return (image->p2.y);
 }
 
 
@@ -3612,23 +3191,7 @@ dxf_image_set_y2
                   __FUNCTION__);
                 return (NULL);
         }
-        if (image->p2 == NULL)
-        {
-                fprintf (stderr,
-                  (_("Warning in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                fprintf (stderr,
-                  (_("Initializing a DxfPoint.\n")));
-                image->p2 = dxf_point_init (image->p2);
-                if (image->p2 == NULL)
-                {
-                        fprintf (stderr,
-                          (_("Error in %s () could not allocate memory.\n")),
-                          __FUNCTION__);
-                        return (NULL);
-                }
-        }
-        image->p2->y0 = y2;
+        image->p2.y = y2;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -3661,17 +3224,10 @@ dxf_image_get_z2
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (image->p2 == NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (EXIT_FAILURE);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (image->p2->z0);
+        return (image->p2.z);
 }
 
 
@@ -3703,23 +3259,7 @@ dxf_image_set_z2
                   __FUNCTION__);
                 return (NULL);
         }
-        if (image->p2 == NULL)
-        {
-                fprintf (stderr,
-                  (_("Warning in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                fprintf (stderr,
-                  (_("Initializing a DxfPoint.\n")));
-                image->p2 = dxf_point_init (image->p2);
-                if (image->p2 == NULL)
-                {
-                        fprintf (stderr,
-                          (_("Error in %s () could not allocate memory.\n")),
-                          __FUNCTION__);
-                        return (NULL);
-                }
-        }
-        image->p2->z0 = z2;
+        image->p2.z = z2;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -3733,7 +3273,7 @@ dxf_image_set_z2
  *
  * \return the U- and V-value of the image in pixel size \c p3.
  */
-DxfPoint *
+DxfVec3 *
 dxf_image_get_p3
 (
         DxfImage *image
@@ -3751,17 +3291,10 @@ dxf_image_get_p3
                   __FUNCTION__);
                 return (NULL);
         }
-        if (image->p3 == NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (image->p3);
+        return (&image->p3);
 }
 
 
@@ -3776,8 +3309,8 @@ dxf_image_set_p3
 (
         DxfImage *image,
                 /*!< a pointer to a DXF \c IMAGE entity. */
-        DxfPoint *p3
-                /*!< a pointer to a DXF \c POINT entity. */
+        DxfVec3 *p3
+                /*!< a pointer to the coordinates. */
 )
 {
 #ifdef DEBUG
@@ -3798,7 +3331,7 @@ dxf_image_set_p3
                   __FUNCTION__);
                 return (NULL);
         }
-        image->p3 = p3;
+        image->p3 = *p3;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -3831,17 +3364,10 @@ dxf_image_get_x3
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (image->p3 == NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (EXIT_FAILURE);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (image->p3->x0);
+        return (image->p3.x);
 }
 
 
@@ -3873,23 +3399,7 @@ dxf_image_set_x3
                   __FUNCTION__);
                 return (NULL);
         }
-        if (image->p3 == NULL)
-        {
-                fprintf (stderr,
-                  (_("Warning in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                fprintf (stderr,
-                  (_("Initializing a DxfPoint.\n")));
-                image->p3 = dxf_point_init (image->p3);
-                if (image->p3 == NULL)
-                {
-                        fprintf (stderr,
-                          (_("Error in %s () could not allocate memory.\n")),
-                          __FUNCTION__);
-                        return (NULL);
-                }
-        }
-        image->p3->x0 = x3;
+        image->p3.x = x3;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -3922,17 +3432,10 @@ dxf_image_get_y3
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (image->p3 == NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (EXIT_FAILURE);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (image->p3->y0);
+        return (image->p3.y);
 }
 
 
@@ -3964,23 +3467,7 @@ dxf_image_set_y3
                   __FUNCTION__);
                 return (NULL);
         }
-        if (image->p3 == NULL)
-        {
-                fprintf (stderr,
-                  (_("Warning in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                fprintf (stderr,
-                  (_("Initializing a DxfPoint.\n")));
-                image->p3 = dxf_point_init (image->p3);
-                if (image->p3 == NULL)
-                {
-                        fprintf (stderr,
-                          (_("Error in %s () could not allocate memory.\n")),
-                          __FUNCTION__);
-                        return (NULL);
-                }
-        }
-        image->p3->y0 = y3;
+        image->p3.y = y3;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -4962,7 +4449,7 @@ dxf_image_get_imagedef_object
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (image->imagedef_object));
+        return (dxf_strdup (image->imagedef_object));
 }
 
 
@@ -5000,7 +4487,7 @@ dxf_image_set_imagedef_object
                   __FUNCTION__);
                 return (NULL);
         }
-        image->imagedef_object = strdup (imagedef_object);
+        image->imagedef_object = dxf_strdup (imagedef_object);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -5042,7 +4529,7 @@ dxf_image_get_imagedef_reactor_object
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (image->imagedef_reactor_object));
+        return (dxf_strdup (image->imagedef_reactor_object));
 }
 
 
@@ -5080,7 +4567,7 @@ dxf_image_set_imagedef_reactor_object
                   __FUNCTION__);
                 return (NULL);
         }
-        image->imagedef_reactor_object = strdup (imagedef_reactor_object);
+        image->imagedef_reactor_object = dxf_strdup (imagedef_reactor_object);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -66,7 +66,7 @@ typedef struct
 dxf_image_struct
 {
         /* Members common for all DXF drawable entities. */
-        int id_code;
+        uint64_t id_code;
                 /*!< Identification number for the entity.\n
                  * This is to be an unique (sequential) number in the DXF
                  * file.\n
@@ -137,20 +137,20 @@ dxf_image_struct
                  * (optional).\n
                  * Group code = 310.\n
                  * \since Introduced in version R2000. */
-        char *dictionary_owner_soft;
+        uint64_t dictionary_owner_soft;
                 /*!< Soft-pointer ID/handle to owner dictionary (optional).\n
                  * Group code = 330.\n
                  * \since Introduced in version R14. */
-        char *object_owner_soft;
+        uint64_t object_owner_soft;
                 /*!< Soft-pointer ID/handle  to owner BLOCK_RECORD object.\n
                  * Group code = 330.\n
                  * \since Introduced in version R2000. */
-        char *material;
+        uint64_t material;
                 /*!< Hard-pointer ID/handle to material object (present if
                  * not BYLAYER).\n
                  * Group code = 347.\n
                  * \since Introduced in version R2008. */
-        char *dictionary_owner_hard;
+        uint64_t dictionary_owner_hard;
                 /*!< Hard owner ID/handle to owner dictionary (optional).\n
                  * Group code = 360.\n
                  * \since Introduced in version R14. */
@@ -159,7 +159,7 @@ dxf_image_struct
                  * Stored and moved around as a 16-bit integer.\n
                  * Group code = 370.\n
                  * \since Introduced in version R2002. */
-        char *plot_style_name;
+        uint64_t plot_style_name;
                 /*!< Hard pointer ID / handle of PlotStyleName object.\n
                  * Group code = 390.\n
                  * \since Introduced in version R2009. */
@@ -192,20 +192,20 @@ dxf_image_struct
                  * Group code = 440.\n
                  * \since Introduced in version R2004. */
         /* Specific members for a DXF image. */
-        DxfPoint *p0;
+        DxfVec3 p0;
                 /*!< Insertion point.\n
                  * Group codes = 10, 20 and 30.*/
-        DxfPoint *p1;
+        DxfVec3 p1;
                 /*!< U-vector of a single pixel (points
                  * along the visual bottom of the image, starting at the
                  * insertion point) (in OCS).\n
                  * Group codes = 11, 21 and 31.*/
-        DxfPoint *p2;
+        DxfVec3 p2;
                 /*!< V-vector of a single pixel (points
                  * along the visual left side of the image, starting at
                  * the insertion point) (in OCS).\n
                  * Group codes = 12, 22 and 32.*/
-        DxfPoint *p3;
+        DxfVec3 p3;
                 /*!< U- and V-value of image size in pixels.\n
                  * Group codes = 13 and 23.*/
         DxfPoint *p4;
@@ -269,8 +269,8 @@ DxfImage *dxf_image_read (DxfFile *fp, DxfImage *image);
 int dxf_image_write (DxfFile *fp, DxfImage *image);
 int dxf_image_free (DxfImage *image);
 void dxf_image_free_list (DxfImage *images);
-int dxf_image_get_id_code (DxfImage *image);
-DxfImage *dxf_image_set_id_code (DxfImage *image, int id_code);
+uint64_t dxf_image_get_id_code (DxfImage *image);
+DxfImage *dxf_image_set_id_code (DxfImage *image, uint64_t id_code);
 char *dxf_image_get_linetype (DxfImage *image);
 DxfImage *dxf_image_set_linetype (DxfImage *image, char *linetype);
 char *dxf_image_get_layer (DxfImage *image);
@@ -293,50 +293,50 @@ int16_t dxf_image_get_shadow_mode (DxfImage *image);
 DxfImage *dxf_image_set_shadow_mode (DxfImage *image, int16_t shadow_mode);
 DxfBinaryData *dxf_image_get_binary_graphics_data (DxfImage *image);
 DxfImage *dxf_image_set_binary_graphics_data (DxfImage *image, DxfBinaryData *data);
-char *dxf_image_get_dictionary_owner_soft (DxfImage *image);
-DxfImage *dxf_image_set_dictionary_owner_soft (DxfImage *image, char *dictionary_owner_soft);
-char *dxf_image_get_object_owner_soft (DxfImage *image);
-DxfImage *dxf_image_set_object_owner_soft (DxfImage *image, char *object_owner_soft);
-char *dxf_image_get_material (DxfImage *image);
-DxfImage *dxf_image_set_material (DxfImage *image, char *material);
-char *dxf_image_get_dictionary_owner_hard (DxfImage *image);
-DxfImage *dxf_image_set_dictionary_owner_hard (DxfImage *image, char *dictionary_owner_hard);
+uint64_t dxf_image_get_dictionary_owner_soft (DxfImage *image);
+DxfImage *dxf_image_set_dictionary_owner_soft (DxfImage *image, uint64_t dictionary_owner_soft);
+uint64_t dxf_image_get_object_owner_soft (DxfImage *image);
+DxfImage *dxf_image_set_object_owner_soft (DxfImage *image, uint64_t object_owner_soft);
+uint64_t dxf_image_get_material (DxfImage *image);
+DxfImage *dxf_image_set_material (DxfImage *image, uint64_t material);
+uint64_t dxf_image_get_dictionary_owner_hard (DxfImage *image);
+DxfImage *dxf_image_set_dictionary_owner_hard (DxfImage *image, uint64_t dictionary_owner_hard);
 int16_t dxf_image_get_lineweight (DxfImage *image);
 DxfImage *dxf_image_set_lineweight (DxfImage *image, int16_t lineweight);
-char *dxf_image_get_plot_style_name (DxfImage *image);
-DxfImage *dxf_image_set_plot_style_name (DxfImage *image, char *plot_style_name);
+uint64_t dxf_image_get_plot_style_name (DxfImage *image);
+DxfImage *dxf_image_set_plot_style_name (DxfImage *image, uint64_t plot_style_name);
 int32_t dxf_image_get_color_value (DxfImage *image);
 DxfImage *dxf_image_set_color_value (DxfImage *image, int32_t color_value);
 char *dxf_image_get_color_name (DxfImage *image);
 DxfImage *dxf_image_set_color_name (DxfImage *image, char *color_name);
 int32_t dxf_image_get_transparency (DxfImage *image);
 DxfImage *dxf_image_set_transparency (DxfImage *image, int32_t transparency);
-DxfPoint *dxf_image_get_p0 (DxfImage *image);
-DxfImage *dxf_image_set_p0 (DxfImage *image, DxfPoint *p0);
+DxfVec3 *dxf_image_get_p0 (DxfImage *image);
+DxfImage *dxf_image_set_p0 (DxfImage *image, DxfVec3 *p0);
 double dxf_image_get_x0 (DxfImage *image);
 DxfImage *dxf_image_set_x0 (DxfImage *image, double x0);
 double dxf_image_get_y0 (DxfImage *image);
 DxfImage *dxf_image_set_y0 (DxfImage *image, double y0);
 double dxf_image_get_z0 (DxfImage *image);
 DxfImage *dxf_image_set_z0 (DxfImage *image, double z0);
-DxfPoint *dxf_image_get_p1 (DxfImage *image);
-DxfImage *dxf_image_set_p1 (DxfImage *image, DxfPoint *p1);
+DxfVec3 *dxf_image_get_p1 (DxfImage *image);
+DxfImage *dxf_image_set_p1 (DxfImage *image, DxfVec3 *p1);
 double dxf_image_get_x1 (DxfImage *image);
 DxfImage *dxf_image_set_x1 (DxfImage *image, double x1);
 double dxf_image_get_y1 (DxfImage *image);
 DxfImage *dxf_image_set_y1 (DxfImage *image, double y1);
 double dxf_image_get_z1 (DxfImage *image);
 DxfImage *dxf_image_set_z1 (DxfImage *image, double z1);
-DxfPoint *dxf_image_get_p2 (DxfImage *image);
-DxfImage *dxf_image_set_p2 (DxfImage *image, DxfPoint *p2);
+DxfVec3 *dxf_image_get_p2 (DxfImage *image);
+DxfImage *dxf_image_set_p2 (DxfImage *image, DxfVec3 *p2);
 double dxf_image_get_x2 (DxfImage *image);
 DxfImage *dxf_image_set_x2 (DxfImage *image, double x2);
 double dxf_image_get_y2 (DxfImage *image);
 DxfImage *dxf_image_set_y2 (DxfImage *image, double y2);
 double dxf_image_get_z2 (DxfImage *image);
 DxfImage *dxf_image_set_z2 (DxfImage *image, double z2);
-DxfPoint *dxf_image_get_p3 (DxfImage *image);
-DxfImage *dxf_image_set_p3 (DxfImage *image, DxfPoint *p3);
+DxfVec3 *dxf_image_get_p3 (DxfImage *image);
+DxfImage *dxf_image_set_p3 (DxfImage *image, DxfVec3 *p3);
 double dxf_image_get_x3 (DxfImage *image);
 DxfImage *dxf_image_set_x3 (DxfImage *image, double x3);
 double dxf_image_get_y3 (DxfImage *image);
@@ -44,6 +44,7 @@
 
 
 #include "imagedef.h"
+#include "util.h"
 
 
 /*!
@@ -63,7 +64,7 @@ dxf_imagedef_new ()
         size = sizeof (DxfImagedef);
         /* avoid malloc of 0 bytes */
         if (size == 0) size = 1;
-        if ((imagedef = malloc (size)) == NULL)
+        if ((imagedef = dxf_malloc (size)) == NULL)
         {
                 fprintf (stderr,
                   (_("Error in %s () could not allocate memory.\n")),
@@ -114,14 +115,14 @@ dxf_imagedef_init
                 return (NULL);
         }
         /* Assign initial values to members. */
-        imagedef->id_code = 0;
-        imagedef->dictionary_owner_soft = strdup ("");
-        imagedef->dictionary_owner_hard = strdup ("");
-        imagedef->file_name = strdup ("");
+        imagedef->id_code = DXF_HANDLE_NONE;
+        imagedef->dictionary_owner_soft = 0;
+        imagedef->dictionary_owner_hard = 0;
+        imagedef->file_name = dxf_strdup ("");
         imagedef->class_version = 0;
         imagedef->image_is_loaded_flag = 0;
         imagedef->resolution_units = 0;
-        imagedef->acad_image_dict_soft = strdup ("");
+        imagedef->acad_image_dict_soft = dxf_strdup ("");
         /* Initialize new structs for the following members later,
          * when they are required and when we have content. */
         imagedef->p0 = NULL;
@@ -158,7 +159,8 @@ dxf_imagedef_read
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        char *temp_string = NULL;
+        char temp_string[DXF_MAX_STRING_LENGTH];
+        int group_code;
         int i;
 
         /* Do some basic checks. */
@@ -167,8 +169,6 @@ dxf_imagedef_read
                 fprintf (stderr,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
-                /* Clean up. */
-                free (temp_string);
                 return (NULL);
         }
         if (fp->acad_version_number < AutoCAD_14)
@@ -217,149 +217,138 @@ dxf_imagedef_read
                 }
         }
         i = 0;
-        (fp->line_number)++;
-        fscanf (fp->fp, "%[^\n]", temp_string);
-        while (strcmp (temp_string, "0") != 0)
+        while ((dxf_read_group_code (fp, &group_code) == EXIT_SUCCESS)
+          && (group_code != 0))
         {
-                if (ferror (fp->fp))
+                if (dxf_read_error (fp))
                 {
                         fprintf (stderr,
                           (_("Error in %s () while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
                         /* Clean up. */
-                        free (temp_string);
-                        fclose (fp->fp);
                         return (NULL);
                 }
-                else if (strcmp (temp_string, "1") == 0)
-                {
-                        /* Now follows a string containing a file name. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, imagedef->file_name);
-                }
-                if (strcmp (temp_string, "5") == 0)
-                {
-                        /* Now follows a string containing a sequential
-                         * id number. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%x\n", (uint *) &imagedef->id_code);
-                }
-                else if (strcmp (temp_string, "10") == 0)
-                {
-                        /* Now follows a string containing the
-                         * U-value of the image size in pixels. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &imagedef->p0->x0);
-                }
-                else if (strcmp (temp_string, "20") == 0)
-                {
-                        /* Now follows a string containing the
-                         * V-value of the image size in pixels. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &imagedef->p0->y0);
-                }
-                else if (strcmp (temp_string, "11") == 0)
-                {
-                        /* Now follows a string containing the
-                         * U-value of the default size of one pixel in
-                         * AutoCAD units. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &imagedef->p1->x0);
-                }
-                else if (strcmp (temp_string, "12") == 0)
+                switch (group_code)
                 {
-                        /* Now follows a string containing the
-                         * V-value of the default size of one pixel in
-                         * AutoCAD units. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &imagedef->p1->y0);
-                }
-                else if (strcmp (temp_string, "90") == 0)
-                {
-                        /* Now follows a string containing the
-                         * value of class version. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%d\n", &imagedef->class_version);
-                }
-                else if ((fp->acad_version_number >= AutoCAD_13)
-                        && (strcmp (temp_string, "100") == 0))
-                {
-                        /* Now follows a string containing the
-                         * subclass marker value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
-                        if (strcmp (temp_string, "AcDbRasterImageDef") != 0)
-                        {
+                        case 1:
+                                /* Now follows a string containing a file name. */
+                                dxf_read_string (fp, &imagedef->file_name);
+                                break;
+                        case 5:
+                                /* Now follows a string containing a sequential
+                                 * id number. */
+                                dxf_read_handle (fp, &imagedef->id_code);
+                                break;
+                        case 10:
+                                /* Now follows a string containing the
+                                 * U-value of the image size in pixels. */
+                                dxf_read_double (fp, &imagedef->p0->x0);
+                                break;
+                        case 20:
+                                /* Now follows a string containing the
+                                 * V-value of the image size in pixels. */
+                                dxf_read_double (fp, &imagedef->p0->y0);
+                                break;
+                        case 11:
+                                /* Now follows a string containing the
+                                 * U-value of the default size of one pixel in
+                                 * AutoCAD units. */
+                                dxf_read_double (fp, &imagedef->p1->x0);
+                                break;
+                        case 12:
+                                /* Now follows a string containing the
+                                 * V-value of the default size of one pixel in
+                                 * AutoCAD units. */
+                                dxf_read_double (fp, &imagedef->p1->y0);
+                                break;
+                        case 90:
+                                /* Now follows a string containing the
+                                 * value of class version. */
+                                dxf_read_int (fp, &imagedef->class_version);
+                                break;
+                        case 100:
+                                if (fp->acad_version_number >= AutoCAD_13)
+                                {
+                                        /* Now follows a string containing the
+                                         * subclass marker value. */
+                                        dxf_read_line (temp_string, fp);
+                                        if (strcmp (temp_string, "AcDbRasterImageDef") != 0)
+                                        {
+                                                fprintf (stderr,
+                                                  (_("Warning in %s () found a bad subclass marker in: %s in line: %d.\n")),
+                                                  __FUNCTION__, fp->filename, fp->line_number);
+                                        }
+                                }
+                                else
+                                {
+                                        fprintf (stderr,
+                                          (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
+                                          __FUNCTION__, fp->filename, fp->line_number);
+                                        /* Skip the value of the unknown group code. */
+                                        dxf_read_line (temp_string, fp);
+                                }
+                                break;
+                        case 280:
+                                /* Now follows a string containing the
+                                 * value of the image is loaded flag. */
+                                dxf_read_int16 (fp, &imagedef->image_is_loaded_flag);
+                                break;
+                        case 281:
+                                /* Now follows a string containing the
+                                 * value of the resolution units. */
+                                dxf_read_int16 (fp, &imagedef->resolution_units);
+                                break;
+                        case 330:
+                                if (i == 0)
+                                {
+                                        /* Now follows a string containing Soft-pointer
+                                         * ID/handle to owner dictionary. */
+                                        dxf_read_handle (fp, &imagedef->dictionary_owner_soft);
+                                        i++;
+                                }
+                                else if (i == 1)
+                                {
+                                        /* Now follows a string containing Soft-pointer
+                                         * ID/handle to owner dictionary. */
+                                        dxf_read_string (fp, &imagedef->acad_image_dict_soft);
+                                        i++;
+                                        /*! \todo Check for overrun of array index. */
+                                }
+                                else if (i > 1)
+                                {
+                                        /* Now follows a string containing a Soft
+                                         * pointer reference to entity. */
+                                        dxf_read_string (fp, &imagedef->imagedef_reactor_soft[i]);
+                                        i++;
+                                }
+                                else
+                                {
+                                        fprintf (stderr,
+                                          (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
+                                          __FUNCTION__, fp->filename, fp->line_number);
+                                        /* Skip the value of the unknown group code. */
+                                        dxf_read_line (temp_string, fp);
+                                }
+                                break;
+                        case 360:
+                                /* Now follows a string containing Hard owner
+                                 * ID/handle to owner dictionary. */
+                                dxf_read_handle (fp, &imagedef->dictionary_owner_hard);
+                                break;
+                        case 999:
+                                /* Now follows a string containing a comment. */
+                                dxf_read_line (temp_string, fp);
+                                fprintf (stdout, (_("DXF comment: %s\n")), temp_string);
+                                break;
+                        default:
                                 fprintf (stderr,
-                                  (_("Warning in %s () found a bad subclass marker in: %s in line: %d.\n")),
+                                  (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
                                   __FUNCTION__, fp->filename, fp->line_number);
-                        }
-                }
-                else if (strcmp (temp_string, "280") == 0)
-                {
-                        /* Now follows a string containing the
-                         * value of the image is loaded flag. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%hd\n", &imagedef->image_is_loaded_flag);
-                }
-                else if (strcmp (temp_string, "281") == 0)
-                {
-                        /* Now follows a string containing the
-                         * value of the resolution units. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%hd\n", &imagedef->resolution_units);
-                }
-                else if ((strcmp (temp_string, "330") == 0)
-                  && (i == 0))
-                {
-                        /* Now follows a string containing Soft-pointer
-                         * ID/handle to owner dictionary. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, imagedef->dictionary_owner_soft);
-                        i++;
-                }
-                else if ((strcmp (temp_string, "330") == 0)
-                  && (i == 1))
-                {
-                        /* Now follows a string containing Soft-pointer
-                         * ID/handle to owner dictionary. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, imagedef->acad_image_dict_soft);
-                        i++;
-                        /*! \todo Check for overrun of array index. */
-                }
-                else if ((strcmp (temp_string, "330") == 0)
-                  && (i > 1))
-                {
-                        /* Now follows a string containing a Soft
-                         * pointer reference to entity. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, imagedef->imagedef_reactor_soft[i]);
-                        i++;
-                }
-                else if (strcmp (temp_string, "360") == 0)
-                {
-                        /* Now follows a string containing Hard owner
-                         * ID/handle to owner dictionary. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, imagedef->dictionary_owner_hard);
-                }
-                else if (strcmp (temp_string, "999") == 0)
-                {
-                        /* Now follows a string containing a comment. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
-                        fprintf (stdout, (_("DXF comment: %s\n")), temp_string);
-                }
-                else
-                {
-                        fprintf (stderr,
-                          (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
-                          __FUNCTION__, fp->filename, fp->line_number);
+                                /* Skip the value of the unknown group code. */
+                                dxf_read_line (temp_string, fp);
+                                break;
                 }
         }
-        /* Clean up. */
-        free (temp_string);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -385,7 +374,7 @@ dxf_imagedef_write
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        char *dxf_entity_name = strdup ("IMAGEDEF");
+        char *dxf_entity_name = dxf_strdup ("IMAGEDEF");
 
         /* Do some basic checks. */
         if (fp == NULL)
@@ -394,7 +383,7 @@ dxf_imagedef_write
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (imagedef == NULL)
@@ -403,7 +392,7 @@ dxf_imagedef_write
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (imagedef->p0 == NULL)
@@ -412,7 +401,7 @@ dxf_imagedef_write
                   (_("Error in %s () a NULL pointer was found.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (imagedef->p1 == NULL)
@@ -421,20 +410,20 @@ dxf_imagedef_write
                   (_("Error in %s () a NULL pointer was found.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (fp->acad_version_number < AutoCAD_14)
         {
                 fprintf (stderr,
-                  (_("Warning in %s () illegal DXF version for this %s entity with id-code: %x.\n")),
+                  (_("Warning in %s () illegal DXF version for this %s entity with id-code: %" PRIx64 ".\n")),
                   __FUNCTION__, dxf_entity_name, imagedef->id_code);
         }
         /* Start writing output. */
-        fprintf (fp->fp, "  0\n%s\n", dxf_entity_name);
-        if (imagedef->id_code != -1)
+        dxf_write_string (fp, 0, dxf_entity_name);
+        if (imagedef->id_code != DXF_HANDLE_NONE)
         {
-                fprintf (fp->fp, "  5\n%x\n", imagedef->id_code);
+                dxf_write_hex (fp, 5, imagedef->id_code);
         }
         /*!
          * \todo for version R14.\n
@@ -446,45 +435,45 @@ dxf_imagedef_write
          * 102 groups are application defined (optional).\n\n
          * End of group, "}" (optional), with Group code 102.
          */
-        if ((strcmp (imagedef->dictionary_owner_soft, "") != 0)
+        if ((imagedef->dictionary_owner_soft != 0)
           && (fp->acad_version_number >= AutoCAD_14))
         {
-                fprintf (fp->fp, "102\n{ACAD_REACTORS\n");
-                fprintf (fp->fp, "330\n%s\n", imagedef->dictionary_owner_soft);
-                fprintf (fp->fp, "330\n%s\n", imagedef->acad_image_dict_soft);
+                dxf_write_string (fp, 102, "{ACAD_REACTORS");
+                dxf_write_hex (fp, 330, imagedef->dictionary_owner_soft);
+                dxf_write_string (fp, 330, imagedef->acad_image_dict_soft);
                 if (imagedef->imagedef_reactor != NULL)
                 {
                         DxfImagedefReactor *iter;
                         iter = imagedef->imagedef_reactor;
                         while (iter != NULL)
                         {
-                                fprintf (fp->fp, "330\n%s\n", dxf_imagedef_reactor_get_associated_image_object (iter));
+                                dxf_write_string (fp, 330, dxf_imagedef_reactor_get_associated_image_object (iter));
                                 iter = (DxfImagedefReactor *) dxf_imagedef_reactor_get_next (iter);
                         }
                 }
-                fprintf (fp->fp, "102\n}\n");
+                dxf_write_string (fp, 102, "}");
         }
-        if ((strcmp (imagedef->dictionary_owner_hard, "") != 0)
+        if ((imagedef->dictionary_owner_hard != 0)
           && (fp->acad_version_number >= AutoCAD_14))
         {
-                fprintf (fp->fp, "102\n{ACAD_XDICTIONARY\n");
-                fprintf (fp->fp, "360\n%s\n", imagedef->dictionary_owner_hard);
-                fprintf (fp->fp, "102\n}\n");
+                dxf_write_string (fp, 102, "{ACAD_XDICTIONARY");
+                dxf_write_hex (fp, 360, imagedef->dictionary_owner_hard);
+                dxf_write_string (fp, 102, "}");
         }
         if (fp->acad_version_number >= AutoCAD_13)
         {
-                fprintf (fp->fp, "100\nAcDbRasterImageDef\n");
+                dxf_write_string (fp, 100, "AcDbRasterImageDef");
         }
-        fprintf (fp->fp, " 90\n%" PRIi32 "\n", imagedef->class_version);
-        fprintf (fp->fp, "  1\n%s\n", imagedef->file_name);
-        fprintf (fp->fp, " 10\n%f\n", imagedef->p0->x0);
-        fprintf (fp->fp, " 20\n%f\n", imagedef->p0->y0);
-        fprintf (fp->fp, " 11\n%f\n", imagedef->p1->x0);
-        fprintf (fp->fp, " 12\n%f\n", imagedef->p1->y0);
-        fprintf (fp->fp, "280\n%hd\n", imagedef->image_is_loaded_flag);
-        fprintf (fp->fp, "281\n%hd\n", imagedef->resolution_units);
+        dxf_write_int (fp, 90, imagedef->class_version);
+        dxf_write_string (fp, 1, imagedef->file_name);
+        dxf_write_double (fp, 10, imagedef->p0->x0);
+        dxf_write_double (fp, 20, imagedef->p0->y0);
+        dxf_write_double (fp, 11, imagedef->p1->x0);
+        dxf_write_double (fp, 12, imagedef->p1->y0);
+        dxf_write_int (fp, 280, imagedef->image_is_loaded_flag);
+        dxf_write_int (fp, 281, imagedef->resolution_units);
         /* Clean up. */
-        free (dxf_entity_name);
+        dxf_free (dxf_entity_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -527,15 +516,13 @@ dxf_imagedef_free
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        free (imagedef->dictionary_owner_soft);
-        free (imagedef->dictionary_owner_hard);
-        free (imagedef->file_name);
-        free (imagedef->acad_image_dict_soft);
+        dxf_free (imagedef->file_name);
+        dxf_free (imagedef->acad_image_dict_soft);
         for (i = 0; i < DXF_MAX_PARAM; i++)
         {
-                free (imagedef->imagedef_reactor_soft[i]);
+                dxf_free (imagedef->imagedef_reactor_soft[i]);
         }
-        free (imagedef);
+        dxf_free (imagedef);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -582,7 +569,7 @@ dxf_imagedef_free_list
  * \return \c id_code when successful, or \c EXIT_FAILURE when an error
  * occurred.
  */
-int
+uint64_t
 dxf_imagedef_get_id_code
 (
         DxfImagedef *imagedef
@@ -600,12 +587,6 @@ dxf_imagedef_get_id_code
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (imagedef->id_code < 0)
-        {
-                fprintf (stderr,
-                  (_("Warning in %s () a negative value was found.\n")),
-                  __FUNCTION__);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -624,7 +605,7 @@ dxf_imagedef_set_id_code
 (
         DxfImagedef *imagedef,
                 /*!< a pointer to a DXF \c IMAGEDEF object. */
-        int id_code
+        uint64_t id_code
                 /*!< Identification number for the entity.\n
                  * This is to be an unique (sequential) number in the DXF
                  * file. */
@@ -641,12 +622,6 @@ dxf_imagedef_set_id_code
                   __FUNCTION__);
                 return (NULL);
         }
-        if (id_code < 0)
-        {
-                fprintf (stderr,
-                  (_("Warning in %s () a negative value was passed.\n")),
-                  __FUNCTION__);
-        }
         imagedef->id_code = id_code;
 #if DEBUG
         DXF_DEBUG_END
@@ -659,12 +634,10 @@ dxf_imagedef_set_id_code
  * \brief Get the pointer to the \c dictionary_owner_soft from a DXF
  * \c IMAGEDEF object.
  *
- * \return a pointer to \c dictionary_owner_soft when successful, or
- * \c NULL when an error occurred.
- *
- * \warning No checks are performed on the returned pointer.
+ * \return the handle \c dictionary_owner_soft when successful, or
+ * 0 when an error occurred.
  */
-char *
+uint64_t
 dxf_imagedef_get_dictionary_owner_soft
 (
         DxfImagedef *imagedef
@@ -680,19 +653,12 @@ dxf_imagedef_get_dictionary_owner_soft
                 fprintf (stderr,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
-                return (NULL);
-        }
-        if (imagedef->dictionary_owner_soft ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
+                return (0);
         }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (imagedef->dictionary_owner_soft));
+        return (imagedef->dictionary_owner_soft);
 }
 
 
@@ -708,8 +674,8 @@ dxf_imagedef_set_dictionary_owner_soft
 (
         DxfImagedef *imagedef,
                 /*!< a pointer to a DXF \c IMAGEDEF object. */
-        char *dictionary_owner_soft
-                /*!< a string containing the pointer to the \c
+        uint64_t dictionary_owner_soft
+                /*!< the handle of the \c
                  * dictionary_owner_soft for the entity. */
 )
 {
@@ -724,14 +690,7 @@ dxf_imagedef_set_dictionary_owner_soft
                   __FUNCTION__);
                 return (NULL);
         }
-        if (dictionary_owner_soft == NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was passed.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
-        imagedef->dictionary_owner_soft = strdup (dictionary_owner_soft);
+        imagedef->dictionary_owner_soft = dictionary_owner_soft;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -743,12 +702,10 @@ dxf_imagedef_set_dictionary_owner_soft
  * \brief Get the pointer to the \c dictionary_owner_hard from a DXF
  * \c IMAGEDEF object.
  *
- * \return a pointer to \c dictionary_owner_hard when successful, or
- * \c NULL when an error occurred.
- *
- * \warning No checks are performed on the returned pointer.
+ * \return the handle \c dictionary_owner_hard when successful, or
+ * 0 when an error occurred.
  */
-char *
+uint64_t
 dxf_imagedef_get_dictionary_owner_hard
 (
         DxfImagedef *imagedef
@@ -764,19 +721,12 @@ dxf_imagedef_get_dictionary_owner_hard
                 fprintf (stderr,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
-                return (NULL);
-        }
-        if (imagedef->dictionary_owner_hard ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
+                return (0);
         }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (imagedef->dictionary_owner_hard));
+        return (imagedef->dictionary_owner_hard);
 }
 
 
@@ -792,8 +742,8 @@ dxf_imagedef_set_dictionary_owner_hard
 (
         DxfImagedef *imagedef,
                 /*!< a pointer to a DXF \c IMAGEDEF object. */
-        char *dictionary_owner_hard
-                /*!< a string containing the pointer to the \c
+        uint64_t dictionary_owner_hard
+                /*!< the handle of the \c
                  * dictionary_owner_hard for the entity. */
 )
 {
@@ -808,14 +758,7 @@ dxf_imagedef_set_dictionary_owner_hard
                   __FUNCTION__);
                 return (NULL);
         }
-        if (dictionary_owner_hard == NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was passed.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
-        imagedef->dictionary_owner_hard = strdup (dictionary_owner_hard);
+        imagedef->dictionary_owner_hard = dictionary_owner_hard;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -856,7 +799,7 @@ dxf_imagedef_get_file_name
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (imagedef->file_name));
+        return (dxf_strdup (imagedef->file_name));
 }
 
 
@@ -894,7 +837,7 @@ dxf_imagedef_set_file_name
                   __FUNCTION__);
                 return (NULL);
         }
-        imagedef->file_name = strdup (file_name);
+        imagedef->file_name = dxf_strdup (file_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1726,7 +1669,7 @@ dxf_imagedef_get_acad_image_dict_soft
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (imagedef->acad_image_dict_soft));
+        return (dxf_strdup (imagedef->acad_image_dict_soft));
 }
 
 
@@ -1765,7 +1708,7 @@ dxf_imagedef_set_acad_image_dict_soft
                   __FUNCTION__);
                 return (NULL);
         }
-        imagedef->acad_image_dict_soft = strdup (acad_image_dict_soft);
+        imagedef->acad_image_dict_soft = dxf_strdup (acad_image_dict_soft);
 #if DEBUG
         DXF_DEBUG_END
 #endif
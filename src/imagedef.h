@@ -64,15 +64,15 @@ typedef struct
 dxf_imagedef_struct
 {
         /* Members common for all DXF group objects. */
-        int id_code;
+        uint64_t id_code;
                 /*!< Identification number for the entity.\n
                  * This is to be an unique (sequential) number in the DXF
                  * file.\n
                  * Group code = 5. */
-        char *dictionary_owner_soft;
+        uint64_t dictionary_owner_soft;
                 /*!< Soft-pointer ID/handle to owner dictionary (optional).\n
                  * Group code = 330. */
-        char *dictionary_owner_hard;
+        uint64_t dictionary_owner_hard;
                 /*!< Hard owner ID/handle to owner dictionary (optional).\n
                  * Group code = 360. */
         /* Specific members for a DXF imagedef. */
@@ -131,12 +131,12 @@ DxfImagedef *dxf_imagedef_read (DxfFile *fp, DxfImagedef *imagedef);
 int dxf_imagedef_write (DxfFile *fp, DxfImagedef *imagedef);
 int dxf_imagedef_free (DxfImagedef *imagedef);
 void dxf_imagedef_free_list (DxfImagedef *imagedefs);
-int dxf_imagedef_get_id_code (DxfImagedef *imagedef);
-DxfImagedef *dxf_imagedef_set_id_code (DxfImagedef *imagedef, int id_code);
-char *dxf_imagedef_get_dictionary_owner_soft (DxfImagedef *imagedef);
-DxfImagedef *dxf_imagedef_set_dictionary_owner_soft (DxfImagedef *imagedef, char *dictionary_owner_soft);
-char *dxf_imagedef_get_dictionary_owner_hard (DxfImagedef *imagedef);
-DxfImagedef *dxf_imagedef_set_dictionary_owner_hard (DxfImagedef *imagedef, char *dictionary_owner_hard);
+uint64_t dxf_imagedef_get_id_code (DxfImagedef *imagedef);
+DxfImagedef *dxf_imagedef_set_id_code (DxfImagedef *imagedef, uint64_t id_code);
+uint64_t dxf_imagedef_get_dictionary_owner_soft (DxfImagedef *imagedef);
+DxfImagedef *dxf_imagedef_set_dictionary_owner_soft (DxfImagedef *imagedef, uint64_t dictionary_owner_soft);
+uint64_t dxf_imagedef_get_dictionary_owner_hard (DxfImagedef *imagedef);
+DxfImagedef *dxf_imagedef_set_dictionary_owner_hard (DxfImagedef *imagedef, uint64_t dictionary_owner_hard);
 char *dxf_imagedef_get_file_name (DxfImagedef *imagedef);
 DxfImagedef *dxf_imagedef_set_file_name (DxfImagedef *imagedef, char *file_name);
 DxfPoint *dxf_imagedef_get_p0 (DxfImagedef *imagedef);
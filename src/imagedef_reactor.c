@@ -45,6 +45,7 @@
 
 
 #include "imagedef_reactor.h"
+#include "util.h"
 
 
 /*!
@@ -64,7 +65,7 @@ dxf_imagedef_reactor_new ()
         size = sizeof (DxfImagedefReactor);
         /* avoid malloc of 0 bytes */
         if (size == 0) size = 1;
-        if ((imagedef_reactor = malloc (size)) == NULL)
+        if ((imagedef_reactor = dxf_malloc (size)) == NULL)
         {
                 fprintf (stderr,
                   (_("Error in %s () could not allocate memory.\n")),
@@ -114,11 +115,11 @@ dxf_imagedef_reactor_init
                   __FUNCTION__);
                 return (NULL);
         }
-        imagedef_reactor->id_code = 0;
-        imagedef_reactor->dictionary_owner_soft = strdup ("");
-        imagedef_reactor->dictionary_owner_hard = strdup ("");
+        imagedef_reactor->id_code = DXF_HANDLE_NONE;
+        imagedef_reactor->dictionary_owner_soft = 0;
+        imagedef_reactor->dictionary_owner_hard = 0;
         imagedef_reactor->class_version = 2;
-        imagedef_reactor->associated_image_object = strdup ("");
+        imagedef_reactor->associated_image_object = dxf_strdup ("");
         imagedef_reactor->associated_image_object_length = 0;
         /* Initialize new structs for the following members later,
          * when they are required and when we have content. */
@@ -154,7 +155,8 @@ dxf_imagedef_reactor_read
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        char *temp_string = NULL;
+        char temp_string[DXF_MAX_STRING_LENGTH];
+        int group_code;
         int i;
 
         /* Do some basic checks. */
@@ -163,8 +165,6 @@ dxf_imagedef_reactor_read
                 fprintf (stderr,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
-                /* Clean up. */
-                free (temp_string);
                 return (NULL);
         }
         if (fp->acad_version_number < AutoCAD_14)
@@ -181,89 +181,94 @@ dxf_imagedef_reactor_read
                 imagedef_reactor = dxf_imagedef_reactor_init (imagedef_reactor);
         }
         i = 0;
-        (fp->line_number)++;
-        fscanf (fp->fp, "%[^\n]", temp_string);
-        while (strcmp (temp_string, "0") != 0)
+        while ((dxf_read_group_code (fp, &group_code) == EXIT_SUCCESS)
+          && (group_code != 0))
         {
-                if (ferror (fp->fp))
+                if (dxf_read_error (fp))
                 {
                         fprintf (stderr,
                           (_("Error in %s () while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
                         /* Clean up. */
-                        free (temp_string);
-                        fclose (fp->fp);
                         return (NULL);
                 }
-                if (strcmp (temp_string, "5") == 0)
-                {
-                        /* Now follows a string containing a sequential
-                         * id number. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%x\n", (uint *) &imagedef_reactor->id_code);
-                }
-                else if (strcmp (temp_string, "90") == 0)
-                {
-                        /* Now follows a string containing the
-                         * value of class version. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%" PRIi32 "\n", &imagedef_reactor->class_version);
-                }
-                else if ((fp->acad_version_number >= AutoCAD_13)
-                        && (strcmp (temp_string, "100") == 0))
+                switch (group_code)
                 {
-                        /* Now follows a string containing the
-                         * subclass marker value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
-                        if (strcmp (temp_string, "AcDbRasterImageDef") != 0)
-                        {
+                        case 5:
+                                /* Now follows a string containing a sequential
+                                 * id number. */
+                                dxf_read_handle (fp, &imagedef_reactor->id_code);
+                                break;
+                        case 90:
+                                /* Now follows a string containing the
+                                 * value of class version. */
+                                dxf_read_int32 (fp, &imagedef_reactor->class_version);
+                                break;
+                        case 100:
+                                if (fp->acad_version_number >= AutoCAD_13)
+                                {
+                                        /* Now follows a string containing the
+                                         * subclass marker value. */
+                                        dxf_read_line (temp_string, fp);
+                                        if (strcmp (temp_string, "AcDbRasterImageDef") != 0)
+                                        {
+                                                fprintf (stderr,
+                                                  (_("Warning in %s () found a bad subclass marker in: %s in line: %d.\n")),
+                                                  __FUNCTION__, fp->filename, fp->line_number);
+                                        }
+                                }
+                                else
+                                {
+                                        fprintf (stderr,
+                                          (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
+                                          __FUNCTION__, fp->filename, fp->line_number);
+                                        /* Skip the value of the unknown group code. */
+                                        dxf_read_line (temp_string, fp);
+                                }
+                                break;
+                        case 330:
+                                if (i == 0)
+                                {
+                                        /* Now follows a string containing Soft-pointer
+                                         * ID/handle to owner dictionary. */
+                                        dxf_read_handle (fp, &imagedef_reactor->dictionary_owner_soft);
+                                        i++;
+                                }
+                                else if (i == 1)
+                                {
+                                        /* Now follows a string containing object ID for
+                                         * associated image object. */
+                                        dxf_read_string (fp, &imagedef_reactor->associated_image_object);
+                                        i++;
+                                }
+                                else
+                                {
+                                        fprintf (stderr,
+                                          (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
+                                          __FUNCTION__, fp->filename, fp->line_number);
+                                        /* Skip the value of the unknown group code. */
+                                        dxf_read_line (temp_string, fp);
+                                }
+                                break;
+                        case 360:
+                                /* Now follows a string containing Hard owner
+                                 * ID/handle to owner dictionary. */
+                                dxf_read_handle (fp, &imagedef_reactor->dictionary_owner_hard);
+                                break;
+                        case 999:
+                                /* Now follows a string containing a comment. */
+                                dxf_read_line (temp_string, fp);
+                                fprintf (stdout, (_("DXF comment: %s\n")), temp_string);
+                                break;
+                        default:
                                 fprintf (stderr,
-                                  (_("Warning in %s () found a bad subclass marker in: %s in line: %d.\n")),
+                                  (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
                                   __FUNCTION__, fp->filename, fp->line_number);
-                        }
-                }
-                else if ((strcmp (temp_string, "330") == 0)
-                  && (i == 0))
-                {
-                        /* Now follows a string containing Soft-pointer
-                         * ID/handle to owner dictionary. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, imagedef_reactor->dictionary_owner_soft);
-                        i++;
-                }
-                else if ((strcmp (temp_string, "330") == 0)
-                  && (i == 1))
-                {
-                        /* Now follows a string containing object ID for
-                         * associated image object. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, imagedef_reactor->associated_image_object);
-                        i++;
-                }
-                else if (strcmp (temp_string, "360") == 0)
-                {
-                        /* Now follows a string containing Hard owner
-                         * ID/handle to owner dictionary. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, imagedef_reactor->dictionary_owner_hard);
-                }
-                else if (strcmp (temp_string, "999") == 0)
-                {
-                        /* Now follows a string containing a comment. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
-                        fprintf (stdout, (_("DXF comment: %s\n")), temp_string);
-                }
-                else
-                {
-                        fprintf (stderr,
-                          (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
-                          __FUNCTION__, fp->filename, fp->line_number);
+                                /* Skip the value of the unknown group code. */
+                                dxf_read_line (temp_string, fp);
+                                break;
                 }
         }
-        /* Clean up. */
-        free (temp_string);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -290,7 +295,7 @@ dxf_imagedef_reactor_write
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        char *dxf_entity_name = strdup ("IMAGEDEF_REACTOR");
+        char *dxf_entity_name = dxf_strdup ("IMAGEDEF_REACTOR");
 
         /* Do some basic checks. */
         if (fp == NULL)
@@ -299,7 +304,7 @@ dxf_imagedef_reactor_write
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (imagedef_reactor == NULL)
@@ -308,13 +313,13 @@ dxf_imagedef_reactor_write
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (fp->acad_version_number < AutoCAD_14)
         {
                 fprintf (stderr,
-                  (_("Warning in %s () illegal DXF version for this %s entity with id-code: %x.\n")),
+                  (_("Warning in %s () illegal DXF version for this %s entity with id-code: %" PRIx64 ".\n")),
                   __FUNCTION__, dxf_entity_name, imagedef_reactor->id_code);
         }
         if (fp->acad_version_number == AutoCAD_14)
@@ -322,10 +327,10 @@ dxf_imagedef_reactor_write
                 imagedef_reactor->class_version = 2;
         }
         /* Start writing output. */
-        fprintf (fp->fp, "  0\n%s\n", dxf_entity_name);
-        if (imagedef_reactor->id_code != -1)
+        dxf_write_string (fp, 0, dxf_entity_name);
+        if (imagedef_reactor->id_code != DXF_HANDLE_NONE)
         {
-                fprintf (fp->fp, "  5\n%x\n", imagedef_reactor->id_code);
+                dxf_write_hex (fp, 5, imagedef_reactor->id_code);
         }
         /*!
          * \todo for version R14.\n
@@ -337,28 +342,28 @@ dxf_imagedef_reactor_write
          * 102 groups are application defined (optional).\n\n
          * End of group, "}" (optional), with Group code 102.
          */
-        if ((strcmp (imagedef_reactor->dictionary_owner_soft, "") != 0)
+        if ((imagedef_reactor->dictionary_owner_soft != 0)
           && (fp->acad_version_number >= AutoCAD_14))
         {
-                fprintf (fp->fp, "102\n{ACAD_REACTORS\n");
-                fprintf (fp->fp, "330\n%s\n", imagedef_reactor->dictionary_owner_soft);
-                fprintf (fp->fp, "102\n}\n");
+                dxf_write_string (fp, 102, "{ACAD_REACTORS");
+                dxf_write_hex (fp, 330, imagedef_reactor->dictionary_owner_soft);
+                dxf_write_string (fp, 102, "}");
         }
-        if ((strcmp (imagedef_reactor->dictionary_owner_hard, "") != 0)
+        if ((imagedef_reactor->dictionary_owner_hard != 0)
           && (fp->acad_version_number >= AutoCAD_14))
         {
-                fprintf (fp->fp, "102\n{ACAD_XDICTIONARY\n");
-                fprintf (fp->fp, "360\n%s\n", imagedef_reactor->dictionary_owner_hard);
-                fprintf (fp->fp, "102\n}\n");
+                dxf_write_string (fp, 102, "{ACAD_XDICTIONARY");
+                dxf_write_hex (fp, 360, imagedef_reactor->dictionary_owner_hard);
+                dxf_write_string (fp, 102, "}");
         }
         if (fp->acad_version_number >= AutoCAD_13)
         {
-                fprintf (fp->fp, "100\nAcDbRasterImageDefReactor\n");
+                dxf_write_string (fp, 100, "AcDbRasterImageDefReactor");
         }
-        fprintf (fp->fp, " 90\n%" PRIi32 "\n", imagedef_reactor->class_version);
-        fprintf (fp->fp, "330\n%s\n", imagedef_reactor->associated_image_object);
+        dxf_write_int (fp, 90, imagedef_reactor->class_version);
+        dxf_write_string (fp, 330, imagedef_reactor->associated_image_object);
         /* Clean up. */
-        free (dxf_entity_name);
+        dxf_free (dxf_entity_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -399,10 +404,8 @@ dxf_imagedef_reactor_free
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        free (imagedef_reactor->dictionary_owner_soft);
-        free (imagedef_reactor->dictionary_owner_hard);
-        free (imagedef_reactor->associated_image_object);
-        free (imagedef_reactor);
+        dxf_free (imagedef_reactor->associated_image_object);
+        dxf_free (imagedef_reactor);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -449,7 +452,7 @@ dxf_imagedef_reactor_free_list
  * \return \c id_code when successful, or \c EXIT_FAILURE when an error
  * occurred.
  */
-int
+uint64_t
 dxf_imagedef_reactor_get_id_code
 (
         DxfImagedefReactor *imagedef_reactor
@@ -467,13 +470,6 @@ dxf_imagedef_reactor_get_id_code
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (imagedef_reactor->id_code < 0)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a negative value was found in the id_code member.\n")),
-                  __FUNCTION__);
-                return (EXIT_FAILURE);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -492,7 +488,7 @@ dxf_imagedef_reactor_set_id_code
 (
         DxfImagedefReactor *imagedef_reactor,
                 /*!< a pointer to a DXF \c IMAGEDEF_REACTOR object. */
-        int id_code
+        uint64_t id_code
                 /*!< Identification number for the entity.\n
                  * This is to be an unique (sequential) number in the DXF
                  * file. */
@@ -509,13 +505,6 @@ dxf_imagedef_reactor_set_id_code
                   __FUNCTION__);
                 return (NULL);
         }
-        if (id_code < 0)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a negative id-code value was passed.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
         imagedef_reactor->id_code = id_code;
 #if DEBUG
         DXF_DEBUG_END
@@ -528,12 +517,10 @@ dxf_imagedef_reactor_set_id_code
  * \brief Get the pointer to the \c dictionary_owner_soft from a DXF
  * \c IMAGEDEF_REACTOR object.
  *
- * \return a pointer to \c dictionary_owner_soft when successful, or
- * \c NULL when an error occurred.
- *
- * \warning No checks are performed on the returned pointer.
+ * \return the handle \c dictionary_owner_soft when successful, or
+ * 0 when an error occurred.
  */
-char *
+uint64_t
 dxf_imagedef_reactor_get_dictionary_owner_soft
 (
         DxfImagedefReactor *imagedef_reactor
@@ -549,19 +536,12 @@ dxf_imagedef_reactor_get_dictionary_owner_soft
                 fprintf (stderr,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
-                return (NULL);
-        }
-        if (imagedef_reactor->dictionary_owner_soft ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found in the dictionary_owner_soft member.\n")),
-                  __FUNCTION__);
-                return (NULL);
+                return (0);
         }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (imagedef_reactor->dictionary_owner_soft));
+        return (imagedef_reactor->dictionary_owner_soft);
 }
 
 
@@ -577,8 +557,8 @@ dxf_imagedef_reactor_set_dictionary_owner_soft
 (
         DxfImagedefReactor *imagedef_reactor,
                 /*!< a pointer to a DXF \c IMAGEDEF_REACTOR object. */
-        char *dictionary_owner_soft
-                /*!< a string containing the pointer to the \c
+        uint64_t dictionary_owner_soft
+                /*!< the handle of the \c
                  * dictionary_owner_soft for the entity. */
 )
 {
@@ -593,14 +573,7 @@ dxf_imagedef_reactor_set_dictionary_owner_soft
                   __FUNCTION__);
                 return (NULL);
         }
-        if (dictionary_owner_soft == NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was passed.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
-        imagedef_reactor->dictionary_owner_soft = strdup (dictionary_owner_soft);
+        imagedef_reactor->dictionary_owner_soft = dictionary_owner_soft;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -612,12 +585,10 @@ dxf_imagedef_reactor_set_dictionary_owner_soft
  * \brief Get the pointer to the \c dictionary_owner_hard from a DXF
  * \c IMAGEDEF_REACTOR object.
  *
- * \return a pointer to \c dictionary_owner_hard when successful, or
- * \c NULL when an error occurred.
- *
- * \warning No checks are performed on the returned pointer.
+ * \return the handle \c dictionary_owner_hard when successful, or
+ * 0 when an error occurred.
  */
-char *
+uint64_t
 dxf_imagedef_reactor_get_dictionary_owner_hard
 (
         DxfImagedefReactor *imagedef_reactor
@@ -633,19 +604,12 @@ dxf_imagedef_reactor_get_dictionary_owner_hard
                 fprintf (stderr,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
-                return (NULL);
-        }
-        if (imagedef_reactor->dictionary_owner_hard ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found in the dictionary_owner_hard member.\n")),
-                  __FUNCTION__);
-                return (NULL);
+                return (0);
         }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (imagedef_reactor->dictionary_owner_hard));
+        return (imagedef_reactor->dictionary_owner_hard);
 }
 
 
@@ -661,8 +625,8 @@ dxf_imagedef_reactor_set_dictionary_owner_hard
 (
         DxfImagedefReactor *imagedef_reactor,
                 /*!< a pointer to a DXF \c IMAGEDEF_REACTOR object. */
-        char *dictionary_owner_hard
-                /*!< a string containing the pointer to the \c
+        uint64_t dictionary_owner_hard
+                /*!< the handle of the \c
                  * dictionary_owner_hard for the entity. */
 )
 {
@@ -677,14 +641,7 @@ dxf_imagedef_reactor_set_dictionary_owner_hard
                   __FUNCTION__);
                 return (NULL);
         }
-        if (dictionary_owner_hard == NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was passed.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
-        imagedef_reactor->dictionary_owner_hard = strdup (dictionary_owner_hard);
+        imagedef_reactor->dictionary_owner_hard = dictionary_owner_hard;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -822,7 +779,7 @@ dxf_imagedef_reactor_get_associated_image_object
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (imagedef_reactor->associated_image_object));
+        return (dxf_strdup (imagedef_reactor->associated_image_object));
 }
 
 
@@ -861,7 +818,7 @@ dxf_imagedef_reactor_set_associated_image_object
                   __FUNCTION__);
                 return (NULL);
         }
-        imagedef_reactor->associated_image_object = strdup (associated_image_object);
+        imagedef_reactor->associated_image_object = dxf_strdup (associated_image_object);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -64,15 +64,15 @@ typedef struct
 dxf_imagedef_reactor_struct
 {
         /* Members common for all DXF group objects. */
-        int id_code;
+        uint64_t id_code;
                 /*!< Identification number for the entity.\n
                  * This is to be an unique (sequential) number in the DXF
                  * file.\n
                  * Group code = 5. */
-        char *dictionary_owner_soft;
+        uint64_t dictionary_owner_soft;
                 /*!< Soft-pointer ID/handle to owner dictionary (optional).\n
                  * Group code = 330. */
-        char *dictionary_owner_hard;
+        uint64_t dictionary_owner_hard;
                 /*!< Hard owner ID/handle to owner dictionary (optional).\n
                  * Group code = 360. */
         /* Specific members for a DXF imagedef_reactor. */
@@ -97,12 +97,12 @@ DxfImagedefReactor *dxf_imagedef_reactor_read (DxfFile *fp, DxfImagedefReactor *
 int dxf_imagedef_reactor_write (DxfFile *fp, DxfImagedefReactor *imagedef_reactor);
 int dxf_imagedef_reactor_free (DxfImagedefReactor *imagedef_reactor);
 void dxf_imagedef_reactor_free_list (DxfImagedefReactor *imagedef_reactors);
-int dxf_imagedef_reactor_get_id_code (DxfImagedefReactor *imagedef_reactor);
-DxfImagedefReactor *dxf_imagedef_reactor_set_id_code (DxfImagedefReactor *imagedef_reactor, int id_code);
-char *dxf_imagedef_reactor_get_dictionary_owner_soft (DxfImagedefReactor *imagedef_reactor);
-DxfImagedefReactor *dxf_imagedef_reactor_set_dictionary_owner_soft (DxfImagedefReactor *imagedef_reactor, char *dictionary_owner_soft);
-char *dxf_imagedef_reactor_get_dictionary_owner_hard (DxfImagedefReactor *imagedef_reactor);
-DxfImagedefReactor *dxf_imagedef_reactor_set_dictionary_owner_hard (DxfImagedefReactor *imagedef_reactor, char *dictionary_owner_hard);
+uint64_t dxf_imagedef_reactor_get_id_code (DxfImagedefReactor *imagedef_reactor);
+DxfImagedefReactor *dxf_imagedef_reactor_set_id_code (DxfImagedefReactor *imagedef_reactor, uint64_t id_code);
+uint64_t dxf_imagedef_reactor_get_dictionary_owner_soft (DxfImagedefReactor *imagedef_reactor);
+DxfImagedefReactor *dxf_imagedef_reactor_set_dictionary_owner_soft (DxfImagedefReactor *imagedef_reactor, uint64_t dictionary_owner_soft);
+uint64_t dxf_imagedef_reactor_get_dictionary_owner_hard (DxfImagedefReactor *imagedef_reactor);
+DxfImagedefReactor *dxf_imagedef_reactor_set_dictionary_owner_hard (DxfImagedefReactor *imagedef_reactor, uint64_t dictionary_owner_hard);
 int32_t dxf_imagedef_reactor_get_class_version (DxfImagedefReactor *imagedef_reactor);
 DxfImagedefReactor *dxf_imagedef_reactor_set_class_version (DxfImagedefReactor *imagedef_reactor, int32_t class_version);
 char *dxf_imagedef_reactor_get_associated_image_object (DxfImagedefReactor *imagedef_reactor);
@@ -45,6 +45,9 @@
 
 
 #include "insert.h"
+#include "bbox.h"
+#include "block.h"
+#include "util.h"
 
 
 /*!
@@ -64,7 +67,7 @@ dxf_insert_new ()
         size = sizeof (DxfInsert);
         /* avoid malloc of 0 bytes */
         if (size == 0) size = 1;
-        if ((insert = malloc (size)) == NULL)
+        if ((insert = dxf_malloc (size)) == NULL)
         {
                 fprintf (stderr,
                   (_("Error in %s () could not allocate memory.\n")),
@@ -113,9 +116,9 @@ dxf_insert_init
                 __FUNCTION__);
               return (NULL);
         }
-        insert->id_code = 0;
-        insert->linetype = strdup (DXF_DEFAULT_LINETYPE);
-        insert->layer = strdup (DXF_DEFAULT_LAYER);
+        insert->id_code = DXF_HANDLE_NONE;
+        insert->linetype = dxf_strdup (DXF_DEFAULT_LINETYPE);
+        insert->layer = dxf_strdup (DXF_DEFAULT_LAYER);
         insert->elevation = 0.0;
         insert->thickness = 0.0;
         insert->linetype_scale = DXF_DEFAULT_LINETYPE_SCALE;
@@ -124,15 +127,15 @@ dxf_insert_init
         insert->paperspace = DXF_MODELSPACE;
         insert->graphics_data_size = 0;
         insert->shadow_mode = 0;
-        insert->dictionary_owner_soft = strdup ("");
-        insert->material = strdup ("");
-        insert->dictionary_owner_hard = strdup ("");
+        insert->dictionary_owner_soft = 0;
+        insert->material = 0;
+        insert->dictionary_owner_hard = 0;
         insert->lineweight = 0.0;
-        insert->plot_style_name = strdup ("");
+        insert->plot_style_name = 0;
         insert->color_value = 0;
-        insert->color_name = strdup ("");
+        insert->color_name = dxf_strdup ("");
         insert->transparency = 0;
-        insert->block_name = strdup ("");
+        insert->block_name = dxf_strdup ("");
         insert->rel_x_scale = 1.0;
         insert->rel_y_scale = 1.0;
         insert->rel_z_scale = 1.0;
@@ -149,6 +152,7 @@ dxf_insert_init
          * when they are required and when we have content. */
         insert->binary_graphics_data = NULL;
         insert->p0 = NULL;
+        insert->block = NULL;
         insert->next = NULL;
 #if DEBUG
         DXF_DEBUG_END
@@ -180,7 +184,8 @@ dxf_insert_read
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        char *temp_string = NULL;
+        char temp_string[DXF_MAX_STRING_LENGTH];
+        int group_code;
 
         /* Do some basic checks. */
         if (fp == NULL)
@@ -188,8 +193,6 @@ dxf_insert_read
                 fprintf (stderr,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
-                /* Clean up. */
-                free (temp_string);
                 return (NULL);
         }
         if (insert == NULL)
@@ -231,255 +234,214 @@ dxf_insert_read
                         return (NULL);
                 }
         }
-        (fp->line_number)++;
-        fscanf (fp->fp, "%[^\n]", temp_string);
-        while (strcmp (temp_string, "0") != 0)
+        while ((dxf_read_group_code (fp, &group_code) == EXIT_SUCCESS)
+          && (group_code != 0))
         {
-                if (ferror (fp->fp))
+                if (dxf_read_error (fp))
                 {
                         fprintf (stderr,
                           (_("Error in %s () while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
-                        fclose (fp->fp);
-                        /* Clean up. */
-                        free (temp_string);
                         return (NULL);
                 }
-                if (strcmp (temp_string, "2") == 0)
-                {
-                        /* Now follows a string containing a block name
-                         * value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, insert->block_name);
-                }
-                else if (strcmp (temp_string, "5") == 0)
-                {
-                        /* Now follows a string containing a sequential
-                         * id number. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%x\n", (uint *) &insert->id_code);
-                }
-                else if (strcmp (temp_string, "6") == 0)
-                {
-                        /* Now follows a string containing a linetype
-                         * name. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, insert->linetype);
-                }
-                else if (strcmp (temp_string, "8") == 0)
-                {
-                        /* Now follows a string containing a layer name. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, insert->layer);
-                }
-                else if (strcmp (temp_string, "10") == 0)
-                {
-                        /* Now follows a string containing the
-                         * X-coordinate of the center point. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &insert->p0->x0);
-                }
-                else if (strcmp (temp_string, "20") == 0)
-                {
-                        /* Now follows a string containing the
-                         * Y-coordinate of the center point. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &insert->p0->y0);
-                }
-                else if (strcmp (temp_string, "30") == 0)
-                {
-                        /* Now follows a string containing the
-                         * Z-coordinate of the center point. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &insert->p0->z0);
-                }
-                else if ((fp->acad_version_number <= AutoCAD_11)
-                        && (strcmp (temp_string, "38") == 0)
-                        && (insert->elevation != 0.0))
-                {
-                        /* Now follows a string containing the
-                         * elevation. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &insert->elevation);
-                }
-                else if (strcmp (temp_string, "39") == 0)
-                {
-                        /* Now follows a string containing the
-                         * thickness. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &insert->thickness);
-                }
-                else if (strcmp (temp_string, "41") == 0)
-                {
-                        /* Now follows a string containing the
-                         * relative X-scale. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &insert->rel_x_scale);
-                }
-                else if (strcmp (temp_string, "42") == 0)
-                {
-                        /* Now follows a string containing the
-                         * relative Y-scale. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &insert->rel_y_scale);
-                }
-                else if (strcmp (temp_string, "43") == 0)
-                {
-                        /* Now follows a string containing the
-                         * relative Z-scale. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &insert->rel_z_scale);
-                }
-                else if (strcmp (temp_string, "44") == 0)
-                {
-                        /* Now follows a string containing the
-                         * column spacing. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &insert->column_spacing);
-                }
-                else if (strcmp (temp_string, "45") == 0)
-                {
-                        /* Now follows a string containing the
-                         * row spacing. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &insert->row_spacing);
-                }
-                else if (strcmp (temp_string, "48") == 0)
-                {
-                        /* Now follows a string containing the linetype
-                         * scale. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &insert->linetype_scale);
-                }
-                else if (strcmp (temp_string, "50") == 0)
-                {
-                        /* Now follows a string containing the
-                         * rotation angle. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &insert->rot_angle);
-                }
-                else if (strcmp (temp_string, "60") == 0)
-                {
-                        /* Now follows a string containing the
-                         * visibility value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%hd\n", &insert->visibility);
-                }
-                else if (strcmp (temp_string, "62") == 0)
-                {
-                        /* Now follows a string containing the
-                         * color value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%d\n", &insert->color);
-                }
-                else if (strcmp (temp_string, "66") == 0)
-                {
-                        /* Now follows a string containing the
-                         * attributes follow flag. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%d\n", &insert->attributes_follow);
-                        /*!
-                         * \todo After a set attributes_follow flag is
-                         * detected, parsing of following entities should
-                         * be implemented until the end of sequence
-                         * marker (\c SEQEND) is encountered. */
-                }
-                else if (strcmp (temp_string, "67") == 0)
-                {
-                        /* Now follows a string containing the
-                         * paperspace value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%d\n", &insert->paperspace);
-                }
-                else if (strcmp (temp_string, "70") == 0)
-                {
-                        /* Now follows a string containing the
-                         * number of columns. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%d\n", &insert->columns);
-                }
-                else if (strcmp (temp_string, "71") == 0)
-                {
-                        /* Now follows a string containing the
-                         * number of rows. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%d\n", &insert->rows);
-                }
-                else if ((fp->acad_version_number >= AutoCAD_13)
-                        && (strcmp (temp_string, "100") == 0))
+                switch (group_code)
                 {
-                        /* Now follows a string containing the
-                         * subclass marker value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
-                        if ((strcmp (temp_string, "AcDbEntity") != 0)
-                        && (strcmp (temp_string, "AcDbBlockReference") != 0))
-                        {
+                        case 2:
+                                /* Now follows a string containing a block name
+                                 * value. */
+                                dxf_read_string_interned (fp, &insert->block_name);
+                                break;
+                        case 5:
+                                /* Now follows a string containing a sequential
+                                 * id number. */
+                                dxf_read_handle (fp, &insert->id_code);
+                                break;
+                        case 6:
+                                /* Now follows a string containing a linetype
+                                 * name. */
+                                dxf_read_string_interned (fp, &insert->linetype);
+                                break;
+                        case 8:
+                                /* Now follows a string containing a layer name. */
+                                dxf_read_string_interned (fp, &insert->layer);
+                                break;
+                        case 10:
+                                /* Now follows a string containing the
+                                 * X-coordinate of the center point. */
+                                dxf_read_double (fp, &insert->p0->x0);
+                                break;
+                        case 20:
+                                /* Now follows a string containing the
+                                 * Y-coordinate of the center point. */
+                                dxf_read_double (fp, &insert->p0->y0);
+                                break;
+                        case 30:
+                                /* Now follows a string containing the
+                                 * Z-coordinate of the center point. */
+                                dxf_read_double (fp, &insert->p0->z0);
+                                break;
+                        case 38:
+                                if ((fp->acad_version_number <= AutoCAD_11) && (insert->elevation != 0.0))
+                                {
+                                        /* Now follows a string containing the
+                                         * elevation. */
+                                        dxf_read_double (fp, &insert->elevation);
+                                }
+                                else
+                                {
+                                        fprintf (stderr,
+                                          (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
+                                          __FUNCTION__, fp->filename, fp->line_number);
+                                        /* Skip the value of the unknown group code. */
+                                        dxf_read_line (temp_string, fp);
+                                }
+                                break;
+                        case 39:
+                                /* Now follows a string containing the
+                                 * thickness. */
+                                dxf_read_double (fp, &insert->thickness);
+                                break;
+                        case 41:
+                                /* Now follows a string containing the
+                                 * relative X-scale. */
+                                dxf_read_double (fp, &insert->rel_x_scale);
+                                break;
+                        case 42:
+                                /* Now follows a string containing the
+                                 * relative Y-scale. */
+                                dxf_read_double (fp, &insert->rel_y_scale);
+                                break;
+                        case 43:
+                                /* Now follows a string containing the
+                                 * relative Z-scale. */
+                                dxf_read_double (fp, &insert->rel_z_scale);
+                                break;
+                        case 44:
+                                /* Now follows a string containing the
+                                 * column spacing. */
+                                dxf_read_double (fp, &insert->column_spacing);
+                                break;
+                        case 45:
+                                /* Now follows a string containing the
+                                 * row spacing. */
+                                dxf_read_double (fp, &insert->row_spacing);
+                                break;
+                        case 48:
+                                /* Now follows a string containing the linetype
+                                 * scale. */
+                                dxf_read_double (fp, &insert->linetype_scale);
+                                break;
+                        case 50:
+                                /* Now follows a string containing the
+                                 * rotation angle. */
+                                dxf_read_double (fp, &insert->rot_angle);
+                                break;
+                        case 60:
+                                /* Now follows a string containing the
+                                 * visibility value. */
+                                dxf_read_int16 (fp, &insert->visibility);
+                                break;
+                        case 62:
+                                /* Now follows a string containing the
+                                 * color value. */
+                                dxf_read_int (fp, &insert->color);
+                                break;
+                        case 66:
+                                /* Now follows a string containing the
+                                 * attributes follow flag. */
+                                dxf_read_int (fp, &insert->attributes_follow);
+                                /*!
+                                 * \todo After a set attributes_follow flag is
+                                 * detected, parsing of following entities should
+                                 * be implemented until the end of sequence
+                                 * marker (\c SEQEND) is encountered. */
+                                break;
+                        case 67:
+                                /* Now follows a string containing the
+                                 * paperspace value. */
+                                dxf_read_int (fp, &insert->paperspace);
+                                break;
+                        case 70:
+                                /* Now follows a string containing the
+                                 * number of columns. */
+                                dxf_read_int (fp, &insert->columns);
+                                break;
+                        case 71:
+                                /* Now follows a string containing the
+                                 * number of rows. */
+                                dxf_read_int (fp, &insert->rows);
+                                break;
+                        case 100:
+                                if (fp->acad_version_number >= AutoCAD_13)
+                                {
+                                        /* Now follows a string containing the
+                                         * subclass marker value. */
+                                        dxf_read_line (temp_string, fp);
+                                        if ((strcmp (temp_string, "AcDbEntity") != 0)
+                                        && (strcmp (temp_string, "AcDbBlockReference") != 0))
+                                        {
+                                                fprintf (stderr,
+                                                  (_("Warning in %s () found a bad subclass marker in: %s in line: %d.\n")),
+                                                  __FUNCTION__, fp->filename, fp->line_number);
+                                        }
+                                }
+                                else
+                                {
+                                        fprintf (stderr,
+                                          (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
+                                          __FUNCTION__, fp->filename, fp->line_number);
+                                        /* Skip the value of the unknown group code. */
+                                        dxf_read_line (temp_string, fp);
+                                }
+                                break;
+                        case 210:
+                                /* Now follows a string containing the
+                                 * X-value of the extrusion vector. */
+                                dxf_read_double (fp, &insert->extr_x0);
+                                break;
+                        case 220:
+                                /* Now follows a string containing the
+                                 * Y-value of the extrusion vector. */
+                                dxf_read_double (fp, &insert->extr_y0);
+                                break;
+                        case 230:
+                                /* Now follows a string containing the
+                                 * Z-value of the extrusion vector. */
+                                dxf_read_double (fp, &insert->extr_z0);
+                                break;
+                        case 330:
+                                /* Now follows a string containing Soft-pointer
+                                 * ID/handle to owner dictionary. */
+                                dxf_read_handle (fp, &insert->dictionary_owner_soft);
+                                break;
+                        case 360:
+                                /* Now follows a string containing Hard owner
+                                 * ID/handle to owner dictionary. */
+                                dxf_read_handle (fp, &insert->dictionary_owner_hard);
+                                break;
+                        case 999:
+                                /* Now follows a string containing a comment. */
+                                dxf_read_line (temp_string, fp);
+                                fprintf (stdout, "DXF comment: %s\n", temp_string);
+                                break;
+                        default:
                                 fprintf (stderr,
-                                  (_("Warning in %s () found a bad subclass marker in: %s in line: %d.\n")),
+                                  (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
                                   __FUNCTION__, fp->filename, fp->line_number);
-                        }
-                }
-                else if (strcmp (temp_string, "210") == 0)
-                {
-                        /* Now follows a string containing the
-                         * X-value of the extrusion vector. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &insert->extr_x0);
-                }
-                else if (strcmp (temp_string, "220") == 0)
-                {
-                        /* Now follows a string containing the
-                         * Y-value of the extrusion vector. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &insert->extr_y0);
-                }
-                else if (strcmp (temp_string, "230") == 0)
-                {
-                        /* Now follows a string containing the
-                         * Z-value of the extrusion vector. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &insert->extr_z0);
-                }
-                else if (strcmp (temp_string, "330") == 0)
-                {
-                        /* Now follows a string containing Soft-pointer
-                         * ID/handle to owner dictionary. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, insert->dictionary_owner_soft);
-                }
-                else if (strcmp (temp_string, "360") == 0)
-                {
-                        /* Now follows a string containing Hard owner
-                         * ID/handle to owner dictionary. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, insert->dictionary_owner_hard);
-                }
-                else if (strcmp (temp_string, "999") == 0)
-                {
-                        /* Now follows a string containing a comment. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
-                        fprintf (stdout, "DXF comment: %s\n", temp_string);
-                }
-                else
-                {
-                        fprintf (stderr,
-                          (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
-                          __FUNCTION__, fp->filename, fp->line_number);
+                                /* Skip the value of the unknown group code. */
+                                dxf_read_line (temp_string, fp);
+                                break;
                 }
         }
         /* Handle omitted members and/or illegal values. */
         if (strcmp (insert->linetype, "") == 0)
         {
-                insert->linetype = strdup (DXF_DEFAULT_LINETYPE);
+                insert->linetype = dxf_strdup (DXF_DEFAULT_LINETYPE);
         }
         if (strcmp (insert->layer, "") == 0)
         {
-                insert->layer = strdup (DXF_DEFAULT_LAYER);
+                insert->layer = dxf_strdup (DXF_DEFAULT_LAYER);
         }
-        /* Clean up. */
-        free (temp_string);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -505,7 +467,7 @@ dxf_insert_write
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        char *dxf_entity_name = strdup ("INSERT");
+        char *dxf_entity_name = dxf_strdup ("INSERT");
 
         /* Do some basic checks. */
         if (fp == NULL)
@@ -514,7 +476,7 @@ dxf_insert_write
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (insert == NULL)
@@ -523,33 +485,33 @@ dxf_insert_write
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (strcmp (insert->linetype, "") == 0)
         {
                 fprintf (stderr,
-                  (_("Warning in %s () empty linetype string for the %s entity with id-code: %x\n")),
+                  (_("Warning in %s () empty linetype string for the %s entity with id-code: %" PRIx64 "\n")),
                   __FUNCTION__, dxf_entity_name, insert->id_code);
                 fprintf (stderr,
                   (_("\t%s entity is reset to default linetype")),
                   dxf_entity_name);
-                insert->linetype = strdup (DXF_DEFAULT_LINETYPE);
+                insert->linetype = dxf_strdup (DXF_DEFAULT_LINETYPE);
         }
         if (strcmp (insert->layer, "") == 0)
         {
                 fprintf (stderr,
-                  (_("Warning in %s () empty layer string for the %s entity with id-code: %x\n")),
+                  (_("Warning in %s () empty layer string for the %s entity with id-code: %" PRIx64 "\n")),
                   __FUNCTION__, dxf_entity_name, insert->id_code);
                 fprintf (stderr,
                   (_("\t%s entity is relocated to layer 0.\n")),
                   dxf_entity_name);
-                insert->layer = strdup (DXF_DEFAULT_LAYER);
+                insert->layer = dxf_strdup (DXF_DEFAULT_LAYER);
         }
         if (insert->rel_x_scale == 0.0)
         {
                 fprintf (stderr,
-                  (_("Warning in %s () relative X-scale factor has a value of 0.0 for the %s entity with id-code: %x\n")),
+                  (_("Warning in %s () relative X-scale factor has a value of 0.0 for the %s entity with id-code: %" PRIx64 "\n")),
                   __FUNCTION__, dxf_entity_name, insert->id_code);
                 fprintf (stderr,
                   (_("\tdefault relative X-scale of 1.0 applied to %s entity.\n")),
@@ -559,7 +521,7 @@ dxf_insert_write
         if (insert->rel_y_scale == 0.0)
         {
                 fprintf (stderr,
-                  (_("Warning in %s () relative Y-scale factor has a value of 0.0 for the %s entity with id-code: %x\n")),
+                  (_("Warning in %s () relative Y-scale factor has a value of 0.0 for the %s entity with id-code: %" PRIx64 "\n")),
                   __FUNCTION__, dxf_entity_name, insert->id_code);
                 fprintf (stderr,
                   (_("\tdefault relative Y-scale of 1.0 applied to %s entity.\n")),
@@ -569,7 +531,7 @@ dxf_insert_write
         if (insert->rel_z_scale == 0.0)
         {
                 fprintf (stderr,
-                  (_("Warning in %s () relative Z-scale factor has a value of 0.0 for the %s entity with id-code: %x\n")),
+                  (_("Warning in %s () relative Z-scale factor has a value of 0.0 for the %s entity with id-code: %" PRIx64 "\n")),
                   __FUNCTION__, dxf_entity_name, insert->id_code);
                 fprintf (stderr,
                   (_("\tdefault relative Z-scale of 1.0 applied to %s entity.\n")),
@@ -580,7 +542,7 @@ dxf_insert_write
           && (insert->column_spacing == 0.0))
         {
                 fprintf (stderr,
-                  (_("Warning in %s () number of columns is greater than 1 and the column spacing has a value of 0.0 for the %s entity with id-code: %x\n")),
+                  (_("Warning in %s () number of columns is greater than 1 and the column spacing has a value of 0.0 for the %s entity with id-code: %" PRIx64 "\n")),
                   __FUNCTION__, dxf_entity_name, insert->id_code);
                 fprintf (stderr,
                   (_("\tdefault number of columns value of 1 applied to %s entity.\n")),
@@ -591,7 +553,7 @@ dxf_insert_write
           && (insert->row_spacing == 0.0))
         {
                 fprintf (stderr,
-                  (_("Warning in %s () number of rows is greater than 1 and the row spacing has a value of 0.0 for the %s entity with id-code: %x\n")),
+                  (_("Warning in %s () number of rows is greater than 1 and the row spacing has a value of 0.0 for the %s entity with id-code: %" PRIx64 "\n")),
                   __FUNCTION__, dxf_entity_name, insert->id_code);
                 fprintf (stderr,
                   (_("\tdefault number of rows value of 1 applied to %s entity.\n")),
@@ -599,10 +561,10 @@ dxf_insert_write
                 insert->rows = 1;
         }
         /* Start writing output. */
-        fprintf (fp->fp, "  0\n%s\n", dxf_entity_name);
-        if (insert->id_code != -1)
+        dxf_write_string (fp, 0, dxf_entity_name);
+        if (insert->id_code != DXF_HANDLE_NONE)
         {
-                fprintf (fp->fp, "  5\n%x\n", insert->id_code);
+                dxf_write_hex (fp, 5, insert->id_code);
         }
         /*!
          * \todo for version R14.\n
@@ -614,114 +576,114 @@ dxf_insert_write
          * 102 groups are application defined (optional).\n\n
          * End of group, "}" (optional), with Group code 102.
          */
-        if ((strcmp (insert->dictionary_owner_soft, "") != 0)
+        if ((insert->dictionary_owner_soft != 0)
           && (fp->acad_version_number >= AutoCAD_14))
         {
-                fprintf (fp->fp, "102\n{ACAD_REACTORS\n");
-                fprintf (fp->fp, "330\n%s\n", insert->dictionary_owner_soft);
-                fprintf (fp->fp, "102\n}\n");
+                dxf_write_string (fp, 102, "{ACAD_REACTORS");
+                dxf_write_hex (fp, 330, insert->dictionary_owner_soft);
+                dxf_write_string (fp, 102, "}");
         }
-        if ((strcmp (insert->dictionary_owner_hard, "") != 0)
+        if ((insert->dictionary_owner_hard != 0)
           && (fp->acad_version_number >= AutoCAD_14))
         {
-                fprintf (fp->fp, "102\n{ACAD_XDICTIONARY\n");
-                fprintf (fp->fp, "360\n%s\n", insert->dictionary_owner_hard);
-                fprintf (fp->fp, "102\n}\n");
+                dxf_write_string (fp, 102, "{ACAD_XDICTIONARY");
+                dxf_write_hex (fp, 360, insert->dictionary_owner_hard);
+                dxf_write_string (fp, 102, "}");
         }
         if (fp->acad_version_number >= AutoCAD_13)
         {
-                fprintf (fp->fp, "100\nAcDbEntity\n");
+                dxf_write_string (fp, 100, "AcDbEntity");
         }
         if (insert->paperspace == DXF_PAPERSPACE)
         {
-                fprintf (fp->fp, " 67\n%d\n", (int16_t) DXF_PAPERSPACE);
+                dxf_write_int (fp, 67, (int16_t) DXF_PAPERSPACE);
         }
-        fprintf (fp->fp, "  8\n%s\n", insert->layer);
+        dxf_write_string (fp, 8, insert->layer);
         if (strcmp (insert->linetype, DXF_DEFAULT_LINETYPE) != 0)
         {
-                fprintf (fp->fp, "  6\n%s\n", insert->linetype);
+                dxf_write_string (fp, 6, insert->linetype);
         }
         if ((fp->acad_version_number <= AutoCAD_11)
           && DXF_FLATLAND
           && (insert->elevation != 0.0))
         {
-                fprintf (fp->fp, " 38\n%f\n", insert->elevation);
+                dxf_write_double (fp, 38, insert->elevation);
         }
         if (insert->thickness != 0.0)
         {
-                fprintf (fp->fp, " 39\n%f\n", insert->thickness);
+                dxf_write_double (fp, 39, insert->thickness);
         }
         if (insert->color!= DXF_COLOR_BYLAYER)
         {
-                fprintf (fp->fp, " 62\n%d\n", insert->color);
+                dxf_write_int (fp, 62, insert->color);
         }
         if (insert->linetype_scale != 1.0)
         {
-                fprintf (fp->fp, " 48\n%f\n", insert->linetype_scale);
+                dxf_write_double (fp, 48, insert->linetype_scale);
         }
         if (insert->visibility != 0)
         {
-                fprintf (fp->fp, " 60\n%d\n", insert->visibility);
+                dxf_write_int (fp, 60, insert->visibility);
         }
         if (fp->acad_version_number >= AutoCAD_13)
         {
-                fprintf (fp->fp, "100\nAcDbBlockReference\n");
+                dxf_write_string (fp, 100, "AcDbBlockReference");
         }
         if (insert->attributes_follow != 0)
         {
-                fprintf (fp->fp, " 66\n%d\n", insert->attributes_follow);
+                dxf_write_int (fp, 66, insert->attributes_follow);
                 /*!
                  * \todo After a set attributes_follow flag is
                  * detected, the writing of following entities should
                  * be implemented and an end of sequence
                  * marker (\c SEQEND) written. */
         }
-        fprintf (fp->fp, "  2\n%s\n", insert->block_name);
-        fprintf (fp->fp, " 10\n%f\n", insert->p0->x0);
-        fprintf (fp->fp, " 20\n%f\n", insert->p0->y0);
-        fprintf (fp->fp, " 30\n%f\n", insert->p0->z0);
+        dxf_write_string (fp, 2, insert->block_name);
+        dxf_write_double (fp, 10, insert->p0->x0);
+        dxf_write_double (fp, 20, insert->p0->y0);
+        dxf_write_double (fp, 30, insert->p0->z0);
         if (insert->rel_x_scale != 1.0)
         {
-                fprintf (fp->fp, " 41\n%f\n", insert->rel_x_scale);
+                dxf_write_double (fp, 41, insert->rel_x_scale);
         }
         if (insert->rel_y_scale != 1.0)
         {
-                fprintf (fp->fp, " 42\n%f\n", insert->rel_y_scale);
+                dxf_write_double (fp, 42, insert->rel_y_scale);
         }
         if (insert->rel_z_scale != 1.0)
         {
-                fprintf (fp->fp, " 43\n%f\n", insert->rel_z_scale);
+                dxf_write_double (fp, 43, insert->rel_z_scale);
         }
         if (insert->rot_angle != 0.0)
         {
-                fprintf (fp->fp, " 50\n%f\n", insert->rot_angle);
+                dxf_write_double (fp, 50, insert->rot_angle);
         }
         if (insert->columns > 1)
         {
-                fprintf (fp->fp, " 70\n%d\n", insert->columns);
+                dxf_write_int (fp, 70, insert->columns);
         }
         if (insert->rows > 1)
         {
-                fprintf (fp->fp, " 71\n%d\n", insert->rows);
+                dxf_write_int (fp, 71, insert->rows);
         }
         if ((insert->columns > 1)
           && (insert->column_spacing > 0.0))
         {
-                fprintf (fp->fp, " 44\n%f\n", insert->column_spacing);
+                dxf_write_double (fp, 44, insert->column_spacing);
         }
         if ((insert->rows > 1)
           && (insert->row_spacing > 0.0))
         {
-                fprintf (fp->fp, " 45\n%f\n", insert->row_spacing);
+                dxf_write_double (fp, 45, insert->row_spacing);
         }
         if (fp->acad_version_number >= AutoCAD_12)
         {
-                fprintf (fp->fp, "210\n%f\n", insert->extr_x0);
-                fprintf (fp->fp, "220\n%f\n", insert->extr_y0);
-                fprintf (fp->fp, "230\n%f\n", insert->extr_z0);
+                dxf_write_double (fp, 210, insert->extr_x0);
+                dxf_write_double (fp, 220, insert->extr_y0);
+                dxf_write_double (fp, 230, insert->extr_z0);
         }
         /* Clean up. */
-        free (dxf_entity_name);
+        dxf_free (dxf_entity_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -762,17 +724,13 @@ dxf_insert_free
                 __FUNCTION__);
               return (EXIT_FAILURE);
         }
-        free (insert->linetype);
-        free (insert->layer);
+        dxf_string_free (insert->linetype);
+        dxf_string_free (insert->layer);
         dxf_binary_data_free_list (insert->binary_graphics_data);
-        free (insert->dictionary_owner_soft);
-        free (insert->material);
-        free (insert->dictionary_owner_hard);
-        free (insert->plot_style_name);
-        free (insert->color_name);
-        free (insert->block_name);
+        dxf_string_free (insert->color_name);
+        dxf_string_free (insert->block_name);
         dxf_point_free_list (insert->p0);
-        free (insert);
+        dxf_free (insert);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -818,7 +776,7 @@ dxf_insert_free_list
  *
  * \return ID code.
  */
-int
+uint64_t
 dxf_insert_get_id_code
 (
         DxfInsert *insert
@@ -836,13 +794,6 @@ dxf_insert_get_id_code
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (insert->id_code < 0)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a negative value was found.\n")),
-                  __FUNCTION__);
-                return (EXIT_FAILURE);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -858,7 +809,7 @@ dxf_insert_set_id_code
 (
         DxfInsert *insert,
                 /*!< a pointer to a DXF \c INSERT entity. */
-        int id_code
+        uint64_t id_code
                 /*!< Identification number for the entity.\n
                  * This is to be an unique (sequential) number in the DXF
                  * file. */
@@ -875,13 +826,6 @@ dxf_insert_set_id_code
                   __FUNCTION__);
                 return (NULL);
         }
-        if (id_code < 0)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a negative id-code value was passed.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
         insert->id_code = id_code;
 #if DEBUG
         DXF_DEBUG_END
@@ -923,7 +867,7 @@ dxf_insert_get_linetype
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (insert->linetype));
+        return (dxf_strdup (insert->linetype));
 }
 
 
@@ -957,7 +901,7 @@ dxf_insert_set_linetype
                   __FUNCTION__);
                 return (NULL);
         }
-        insert->linetype = strdup (linetype);
+        insert->linetype = dxf_strdup (linetype);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -998,7 +942,7 @@ dxf_insert_get_layer
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (insert->layer));
+        return (dxf_strdup (insert->layer));
 }
 
 
@@ -1032,7 +976,7 @@ dxf_insert_set_layer
                   __FUNCTION__);
                 return (NULL);
         }
-        insert->layer = strdup (layer);
+        insert->layer = dxf_strdup (layer);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1773,10 +1717,8 @@ dxf_insert_set_binary_graphics_data
  * \c INSERT entity.
  *
  * \return soft pointer to the dictionary owner.
- *
- * \warning No checks are performed on the returned pointer (string).
  */
-char *
+uint64_t
 dxf_insert_get_dictionary_owner_soft
 (
         DxfInsert *insert
@@ -1792,19 +1734,12 @@ dxf_insert_get_dictionary_owner_soft
                 fprintf (stderr,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
-                return (NULL);
-        }
-        if (insert->dictionary_owner_soft ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
+                return (0);
         }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (insert->dictionary_owner_soft));
+        return (insert->dictionary_owner_soft);
 }
 
 
@@ -1817,8 +1752,8 @@ dxf_insert_set_dictionary_owner_soft
 (
         DxfInsert *insert,
                 /*!< a pointer to a DXF \c INSERT entity. */
-        char *dictionary_owner_soft
-                /*!< a string containing the pointer to the
+        uint64_t dictionary_owner_soft
+                /*!< the handle of the
                  * dictionary_owner_soft for the entity. */
 )
 {
@@ -1833,14 +1768,7 @@ dxf_insert_set_dictionary_owner_soft
                   __FUNCTION__);
                 return (NULL);
         }
-        if (dictionary_owner_soft == NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was passed.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
-        insert->dictionary_owner_soft = strdup (dictionary_owner_soft);
+        insert->dictionary_owner_soft = dictionary_owner_soft;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1851,12 +1779,10 @@ dxf_insert_set_dictionary_owner_soft
 /*!
  * \brief Get the pointer to the \c material from a DXF \c INSERT entity.
  *
- * \return a pointer to \c material when successful, or \c NULL when an
+ * \return the handle \c material when successful, or 0 when an
  * error occurred.
- *
- * \warning No checks are performed on the returned pointer.
  */
-char *
+uint64_t
 dxf_insert_get_material
 (
         DxfInsert *insert
@@ -1872,19 +1798,12 @@ dxf_insert_get_material
                 fprintf (stderr,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
-                return (NULL);
-        }
-        if (insert->material ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
+                return (0);
         }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (insert->material));
+        return (insert->material);
 }
 
 
@@ -1899,8 +1818,8 @@ dxf_insert_set_material
 (
         DxfInsert *insert,
                 /*!< a pointer to a DXF \c INSERT entity. */
-        char *material
-                /*!< a string containing the pointer to the \c
+        uint64_t material
+                /*!< the handle of the \c
                  * material for the entity. */
 )
 {
@@ -1915,14 +1834,7 @@ dxf_insert_set_material
                   __FUNCTION__);
                 return (NULL);
         }
-        if (material == NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was passed.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
-        insert->material = strdup (material);
+        insert->material = material;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1935,10 +1847,8 @@ dxf_insert_set_material
  * \c INSERT entity.
  *
  * \return hard pointer to the dictionary owner.
- *
- * \warning No checks are performed on the returned pointer (string).
  */
-char *
+uint64_t
 dxf_insert_get_dictionary_owner_hard
 (
         DxfInsert *insert
@@ -1954,19 +1864,12 @@ dxf_insert_get_dictionary_owner_hard
                 fprintf (stderr,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
-                return (NULL);
-        }
-        if (insert->dictionary_owner_hard ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
+                return (0);
         }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (insert->dictionary_owner_hard));
+        return (insert->dictionary_owner_hard);
 }
 
 
@@ -1979,8 +1882,8 @@ dxf_insert_set_dictionary_owner_hard
 (
         DxfInsert *insert,
                 /*!< a pointer to a DXF \c INSERT entity. */
-        char *dictionary_owner_hard
-                /*!< a string containing the pointer to the
+        uint64_t dictionary_owner_hard
+                /*!< the handle of the
                  * dictionary_owner_hard for the entity. */
 )
 {
@@ -1995,14 +1898,7 @@ dxf_insert_set_dictionary_owner_hard
                   __FUNCTION__);
                 return (NULL);
         }
-        if (dictionary_owner_hard == NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was passed.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
-        insert->dictionary_owner_hard = strdup (dictionary_owner_hard);
+        insert->dictionary_owner_hard = dictionary_owner_hard;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2078,10 +1974,10 @@ dxf_insert_set_lineweight
 /*!
  * \brief Get the \c plot_style_name from a DXF \c INSERT entity.
  *
- * \return a pointer to \c plot_style_name when sucessful, or \c NULL
+ * \return the handle \c plot_style_name when sucessful, or 0
  * when an error occurred.
  */
-char *
+uint64_t
 dxf_insert_get_plot_style_name
 (
         DxfInsert *insert
@@ -2097,19 +1993,12 @@ dxf_insert_get_plot_style_name
                 fprintf (stderr,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
-                return (NULL);
-        }
-        if (insert->plot_style_name ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
+                return (0);
         }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (insert->plot_style_name));
+        return (insert->plot_style_name);
 }
 
 
@@ -2124,7 +2013,7 @@ dxf_insert_set_plot_style_name
 (
         DxfInsert *insert,
                 /*!< a pointer to a DXF \c INSERT entity. */
-        char *plot_style_name
+        uint64_t plot_style_name
                 /*!< a string containing the \c plot_style_name for the
                  * entity. */
 )
@@ -2140,14 +2029,7 @@ dxf_insert_set_plot_style_name
                   __FUNCTION__);
                 return (NULL);
         }
-        if (plot_style_name == NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was passed.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
-        insert->plot_style_name = strdup (plot_style_name);
+        insert->plot_style_name = plot_style_name;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2254,7 +2136,7 @@ dxf_insert_get_color_name
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (insert->color_name));
+        return (dxf_strdup (insert->color_name));
 }
 
 
@@ -2292,7 +2174,7 @@ dxf_insert_set_color_name
                   __FUNCTION__);
                 return (NULL);
         }
-        insert->color_name = strdup (color_name);
+        insert->color_name = dxf_strdup (color_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2399,7 +2281,7 @@ dxf_insert_get_block_name
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (insert->block_name));
+        return (dxf_strdup (insert->block_name));
 }
 
 
@@ -2437,7 +2319,7 @@ dxf_insert_set_block_name
                   __FUNCTION__);
                 return (NULL);
         }
-        insert->block_name = strdup (block_name);
+        insert->block_name = dxf_strdup (block_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -3933,4 +3815,642 @@ dxf_insert_get_last
 }
 
 
+/*!
+ * \brief Get the pointer to the resolved block definition from a DXF
+ * \c INSERT entity.
+ *
+ * \return pointer to the block definition, \c NULL when the block name
+ * was not (yet) resolved.
+ *
+ * \warning No checks are performed on the returned pointer.
+ */
+struct dxf_block_struct *
+dxf_insert_get_block
+(
+        DxfInsert *insert
+                /*!< a pointer to a DXF \c INSERT entity. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        /* Do some basic checks. */
+        if (insert == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return ((struct dxf_block_struct *) insert->block);
+}
+
+
+/*!
+ * \brief Set the pointer to the resolved block definition for a DXF
+ * \c INSERT entity.
+ *
+ * The block definition is not owned by \c insert and has to outlive
+ * it, \c NULL clears the resolution.
+ */
+DxfInsert *
+dxf_insert_set_block
+(
+        DxfInsert *insert,
+                /*!< a pointer to a DXF \c INSERT entity. */
+        struct dxf_block_struct *block
+                /*!< a pointer to the block definition named by the
+                 * \c block_name of the entity. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        /* Do some basic checks. */
+        if (insert == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        insert->block = block;
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (insert);
+}
+
+
+/*!
+ * \brief Get the affine transformation from the block coordinates of
+ * a block definition to the coordinates of one cell of an \c INSERT
+ * entity.
+ *
+ * A point of the block maps to it's offset from the base point of the
+ * block, scaled, moved by the column and row spacing, rotated and
+ * moved to the insertion point, all in the Object Coordinate System
+ * (OCS) of the \c INSERT, and then mapped to world coordinates (see
+ * dxf_transform_set_ocs ()).
+ */
+static void
+dxf_insert_get_cell_transform
+(
+        DxfInsert *insert,
+                /*!< a pointer to a DXF \c INSERT entity with an
+                 * insertion point. */
+        DxfBlock *block,
+                /*!< a pointer to the block definition, or \c NULL for
+                 * a base point at the origin. */
+        int column,
+                /*!< Column of the cell, starting at 0. */
+        int row,
+                /*!< Row of the cell, starting at 0. */
+        DxfTransform *transform
+                /*!< a pointer to the transformation to fill. */
+)
+{
+        DxfTransform ocs;
+        DxfVec3 extrusion;
+        double angle = insert->rot_angle * M_PI / 180.0;
+        double c = cos (angle);
+        double s = sin (angle);
+        double u;
+        double v;
+        double w;
+
+        u = column * insert->column_spacing;
+        v = row * insert->row_spacing;
+        w = 0.0;
+        if ((block != NULL) && (block->p0 != NULL))
+        {
+                u -= insert->rel_x_scale * block->p0->x0;
+                v -= insert->rel_y_scale * block->p0->y0;
+                w -= insert->rel_z_scale * block->p0->z0;
+        }
+        transform->m[0][0] = insert->rel_x_scale * c;
+        transform->m[0][1] = -insert->rel_y_scale * s;
+        transform->m[0][2] = 0.0;
+        transform->m[0][3] = insert->p0->x0 + (u * c) - (v * s);
+        transform->m[1][0] = insert->rel_x_scale * s;
+        transform->m[1][1] = insert->rel_y_scale * c;
+        transform->m[1][2] = 0.0;
+        transform->m[1][3] = insert->p0->y0 + (u * s) + (v * c);
+        transform->m[2][0] = 0.0;
+        transform->m[2][1] = 0.0;
+        transform->m[2][2] = insert->rel_z_scale;
+        transform->m[2][3] = insert->p0->z0 + w;
+        extrusion.x = insert->extr_x0;
+        extrusion.y = insert->extr_y0;
+        extrusion.z = insert->extr_z0;
+        dxf_transform_set_ocs (&ocs, &extrusion);
+        dxf_transform_multiply (transform, &ocs, transform);
+}
+
+
+/*!
+ * \brief Get the affine transformation from the coordinates of the
+ * block definition of a DXF \c INSERT entity to the coordinates of
+ * one cell of the \c INSERT.
+ *
+ * The base point of the block definition is taken from the resolved
+ * block (see dxf_insert_set_block ()), or is the origin for an
+ * unresolved \c INSERT.\n
+ * The transformation includes the mapping of the Object Coordinate
+ * System (OCS) of \c insert to world coordinates.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_insert_get_transform
+(
+        DxfInsert *insert,
+                /*!< a pointer to a DXF \c INSERT entity. */
+        int column,
+                /*!< Column of the cell, starting at 0. */
+        int row,
+                /*!< Row of the cell, starting at 0. */
+        DxfTransform *transform
+                /*!< a pointer to the libDXF affine transformation to
+                 * fill. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        /* Do some basic checks. */
+        if ((insert == NULL) || (transform == NULL))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        if (insert->p0 == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer to the insertion point was found.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        dxf_insert_get_cell_transform (insert, (DxfBlock *) insert->block,
+          column, row, transform);
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Get the bounding box of a DXF \c INSERT.
+ *
+ * The corners of the extents of the block definition of \c insert
+ * (see dxf_block_get_bbox ()), mapped with the transformations of the
+ * cells in the corners of the array (see dxf_insert_get_transform ()).\n
+ * The block definition has to be resolved with dxf_insert_set_block ()
+ * first.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_insert_get_bbox
+(
+        DxfInsert *insert,
+                /*!< a pointer to a DXF \c INSERT entity. */
+        DxfBbox *bbox
+                /*!< a pointer to the libDXF bounding box to fill. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfBlock *block;
+        DxfBbox extents;
+        DxfTransform transform;
+        DxfVec3 corner;
+        int columns;
+        int rows;
+        int cell;
+        int i;
+
+        /* Do some basic checks. */
+        if ((insert == NULL) || (bbox == NULL))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        block = (DxfBlock *) insert->block;
+        if ((insert->p0 == NULL) || (block == NULL)
+          || (dxf_block_get_bbox (block, &extents) == EXIT_FAILURE)
+          || dxf_bbox_is_empty (&extents))
+        {
+                /* Not resolved, or an empty block. */
+                dxf_bbox_init (bbox);
+                return (EXIT_FAILURE);
+        }
+        columns = (insert->columns > 1) ? insert->columns : 1;
+        rows = (insert->rows > 1) ? insert->rows : 1;
+        dxf_bbox_init (bbox);
+        /* The cells in the corners of the array hold the whole
+         * array. */
+        for (cell = 0; cell < 4; cell++)
+        {
+                dxf_insert_get_cell_transform (insert, block,
+                  (cell & 1) ? (columns - 1) : 0,
+                  (cell & 2) ? (rows - 1) : 0, &transform);
+                for (i = 0; i < 8; i++)
+                {
+                        corner.x = (i & 1) ? extents.max.x : extents.min.x;
+                        corner.y = (i & 2) ? extents.max.y : extents.min.y;
+                        corner.z = (i & 4) ? extents.max.z : extents.min.z;
+                        dxf_transform_apply_point (&transform, &corner, &corner);
+                        dxf_bbox_add_point (bbox, corner.x, corner.y, corner.z);
+                }
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (EXIT_SUCCESS);
+}
+
+/*!
+ * \brief Transform a DXF \c INSERT entity in place.
+ *
+ * The transformation of the block definition (see
+ * dxf_insert_get_transform ()) is composed with \c transform.  This is
+ * possible when \c transform maps the plane of the Object Coordinate
+ * System (OCS) of \c insert with a uniform scale and scales the
+ * extrusion direction by the same factor, without shear (see
+ * dxf_transform_get_ocs_transform ()), a mirrored \c insert gets a
+ * negative Z scale factor.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred, or when \c transform does not map the entity without
+ * distortion.
+ */
+int
+dxf_insert_transform
+(
+        DxfInsert *insert,
+                /*!< a pointer to a DXF \c INSERT entity. */
+        DxfTransform *transform
+                /*!< a pointer to a libDXF affine transformation. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfTransform ocs;
+        DxfVec3 extrusion;
+        DxfVec3 point;
+        double scale;
+        double rotation;
+
+        /* Do some basic checks. */
+        if ((insert == NULL) || (transform == NULL))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        if (insert->p0 == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer to the insertion point was found.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        extrusion.x = insert->extr_x0;
+        extrusion.y = insert->extr_y0;
+        extrusion.z = insert->extr_z0;
+        if ((dxf_transform_get_ocs_transform (transform, &extrusion, &ocs, &scale) == EXIT_FAILURE)
+          || (fabs (ocs.m[0][2]) > (DXF_TRANSFORM_TOLERANCE * scale))
+          || (fabs (ocs.m[1][2]) > (DXF_TRANSFORM_TOLERANCE * scale))
+          || (fabs (fabs (ocs.m[2][2]) - scale) > (DXF_TRANSFORM_TOLERANCE * scale)))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () the transformation distorts the INSERT entity with id-code: %" PRIx64 "\n")),
+                  __FUNCTION__, insert->id_code);
+                return (EXIT_FAILURE);
+        }
+        point.x = insert->p0->x0;
+        point.y = insert->p0->y0;
+        point.z = insert->p0->z0;
+        dxf_transform_apply_point (&ocs, &point, &point);
+        insert->p0->x0 = point.x;
+        insert->p0->y0 = point.y;
+        insert->p0->z0 = point.z;
+        rotation = atan2 (ocs.m[1][0], ocs.m[0][0]) * 180.0 / M_PI;
+        insert->rot_angle = fmod (insert->rot_angle + rotation, 360.0);
+        if (insert->rot_angle < 0.0)
+        {
+                insert->rot_angle += 360.0;
+        }
+        insert->rel_x_scale *= scale;
+        insert->rel_y_scale *= scale;
+        insert->rel_z_scale *= ocs.m[2][2];
+        insert->column_spacing *= scale;
+        insert->row_spacing *= scale;
+        insert->extr_x0 = extrusion.x;
+        insert->extr_y0 = extrusion.y;
+        insert->extr_z0 = extrusion.z;
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (EXIT_SUCCESS);
+}
+
+
+
+/*!
+ * \brief Set the transformation of the current cell of the innermost
+ * \c INSERT of an explode iterator, from the transformation of the
+ * \c INSERT around it.
+ */
+static void
+dxf_insert_explode_set_transform
+(
+        DxfInsertExplode *explode
+                /*!< a pointer to a libDXF explode iterator with at
+                 * least one frame. */
+)
+{
+        DxfInsertExplodeFrame *frame = &explode->frames[explode->depth - 1];
+
+        dxf_insert_get_cell_transform (frame->insert, (DxfBlock *) frame->block,
+          frame->column, frame->row, &frame->transform);
+        if (explode->depth > 1)
+        {
+                dxf_transform_multiply (&frame->transform,
+                  &explode->frames[explode->depth - 2].transform,
+                  &frame->transform);
+        }
+}
+
+
+/*!
+ * \brief Enter an \c INSERT entity in an explode iterator.
+ *
+ * \c INSERT entities without an insertion point or a block definition,
+ * nested too deep or inserting a block which is being expanded already
+ * are counted in \c number_skipped.
+ */
+static void
+dxf_insert_explode_push
+(
+        DxfInsertExplode *explode,
+                /*!< a pointer to a libDXF explode iterator. */
+        DxfInsert *insert
+                /*!< a pointer to the DXF \c INSERT entity to enter. */
+)
+{
+        DxfInsertExplodeFrame *frame;
+        DxfBlock *block;
+        int i;
+
+        block = (DxfBlock *) insert->block;
+        if ((block == NULL)
+          && (explode->blocks != NULL)
+          && (insert->block_name != NULL))
+        {
+                block = dxf_block_map_lookup ((DxfBlockMap *) explode->blocks,
+                  insert->block_name);
+        }
+        if ((block == NULL)
+          || (insert->p0 == NULL)
+          || (explode->depth == DXF_INSERT_EXPLODE_MAX_DEPTH))
+        {
+                explode->number_skipped++;
+                return;
+        }
+        for (i = 0; i < explode->depth; i++)
+        {
+                if (explode->frames[i].block == (struct dxf_block_struct *) block)
+                {
+                        /* The block inserts itself. */
+                        explode->number_skipped++;
+                        return;
+                }
+        }
+        frame = &explode->frames[explode->depth];
+        frame->insert = insert;
+        frame->block = (struct dxf_block_struct *) block;
+        frame->entity_list = dxf_block_get_entity_list (block, &frame->number_of_entities);
+        if (frame->entity_list == NULL)
+        {
+                frame->number_of_entities = 0;
+        }
+        frame->index = 0;
+        frame->column = 0;
+        frame->row = 0;
+        frame->columns = (insert->columns > 1) ? insert->columns : 1;
+        frame->rows = (insert->rows > 1) ? insert->rows : 1;
+        explode->depth++;
+        dxf_insert_explode_set_transform (explode);
+}
+
+
+/*!
+ * \brief Start iterating over the geometry of a DXF \c INSERT entity.
+ *
+ * The entities of the block definition of \c insert are handed out by
+ * dxf_insert_explode_next () for every cell of the column and row
+ * array, together with the transformation from their coordinates to
+ * the coordinates of \c insert (see
+ * dxf_insert_explode_get_transform ()).\n
+ * Nested \c INSERT entities are expanded in place, up to
+ * \c DXF_INSERT_EXPLODE_MAX_DEPTH levels deep.\n
+ * No entity is copied: the iterator only holds a fixed stack of
+ * frames, so it can live on the stack of the caller.\n
+ * \c INSERT entities are expanded with their resolved block definition
+ * (see dxf_insert_set_block ()), or with the block of the same name in
+ * \c blocks.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_insert_explode_init
+(
+        DxfInsertExplode *explode,
+                /*!< a pointer to a libDXF explode iterator. */
+        DxfInsert *insert,
+                /*!< a pointer to a DXF \c INSERT entity. */
+        struct dxf_block_map_struct *blocks
+                /*!< a pointer to a libDXF block map resolving the
+                 * block names of unresolved \c INSERT entities, may be
+                 * \c NULL. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        /* Do some basic checks. */
+        if ((explode == NULL) || (insert == NULL))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        explode->depth = 0;
+        explode->blocks = blocks;
+        explode->type = NULL;
+        explode->entity = NULL;
+        explode->number_skipped = 0;
+        dxf_insert_explode_push (explode, insert);
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Get the next entity of the geometry of a DXF \c INSERT
+ * entity.
+ *
+ * The entity is handed out as it is stored in it's block definition,
+ * map it's coordinates with the transformation returned by
+ * dxf_insert_explode_get_transform ().
+ *
+ * \return a pointer to the entity, or \c NULL when all entities were
+ * handed out.
+ */
+void *
+dxf_insert_explode_next
+(
+        DxfInsertExplode *explode
+                /*!< a pointer to a libDXF explode iterator. */
+)
+{
+        DxfInsertExplodeFrame *frame;
+        DxfBlockEntity *item;
+
+        /* Do some basic checks. */
+        if (explode == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        explode->type = NULL;
+        explode->entity = NULL;
+        while (explode->depth > 0)
+        {
+                frame = &explode->frames[explode->depth - 1];
+                if (frame->index == frame->number_of_entities)
+                {
+                        /* Continue with the next cell of the array, or
+                         * leave the INSERT after the last cell. */
+                        frame->index = 0;
+                        frame->column++;
+                        if (frame->column == frame->columns)
+                        {
+                                frame->column = 0;
+                                frame->row++;
+                        }
+                        if ((frame->row == frame->rows)
+                          || (frame->number_of_entities == 0))
+                        {
+                                explode->depth--;
+                                continue;
+                        }
+                        dxf_insert_explode_set_transform (explode);
+                        continue;
+                }
+                item = &frame->entity_list[frame->index++];
+                if (strcmp (item->type, "INSERT") == 0)
+                {
+                        dxf_insert_explode_push (explode, (DxfInsert *) item->entity);
+                        continue;
+                }
+                explode->type = item->type;
+                explode->entity = item->entity;
+                return (item->entity);
+        }
+        return (NULL);
+}
+
+
+/*!
+ * \brief Get the entity type name of the entity last handed out by
+ * dxf_insert_explode_next ().
+ *
+ * \return the entity type name, for example "LINE", or \c NULL at the
+ * end.
+ */
+const char *
+dxf_insert_explode_get_type
+(
+        DxfInsertExplode *explode
+                /*!< a pointer to a libDXF explode iterator. */
+)
+{
+        if (explode == NULL)
+        {
+                return (NULL);
+        }
+        return (explode->type);
+}
+
+
+/*!
+ * \brief Get the transformation from the coordinates of the entity
+ * last handed out by dxf_insert_explode_next () to the coordinates of
+ * the exploded \c INSERT entity.
+ *
+ * \return a pointer to the transformation, owned by the iterator and
+ * valid up to the next call to dxf_insert_explode_next (), or \c NULL
+ * at the end.
+ */
+DxfTransform *
+dxf_insert_explode_get_transform
+(
+        DxfInsertExplode *explode
+                /*!< a pointer to a libDXF explode iterator. */
+)
+{
+        if ((explode == NULL) || (explode->entity == NULL))
+        {
+                return (NULL);
+        }
+        return (&explode->frames[explode->depth - 1].transform);
+}
+
+
+/*!
+ * \brief Get the innermost \c INSERT entity holding the entity last
+ * handed out by dxf_insert_explode_next ().
+ *
+ * Use it for the properties inherited by entities on layer "0" or
+ * with color or linetype \c BYBLOCK.
+ *
+ * \return a pointer to the \c INSERT entity, or \c NULL at the end.
+ */
+DxfInsert *
+dxf_insert_explode_get_insert
+(
+        DxfInsertExplode *explode
+                /*!< a pointer to a libDXF explode iterator. */
+)
+{
+        if ((explode == NULL) || (explode->entity == NULL))
+        {
+                return (NULL);
+        }
+        return (explode->frames[explode->depth - 1].insert);
+}
+
+
 /* EOF */
@@ -51,6 +51,7 @@
 #include "global.h"
 #include "point.h"
 #include "binary_data.h"
+#include "transform.h"
 
 
 #ifdef __cplusplus
@@ -66,7 +67,7 @@ typedef struct
 dxf_insert_struct
 {
         /* Members common for all DXF drawable entities. */
-        int id_code;
+        uint64_t id_code;
                 /*!< Identification number for the entity.\n
                  * This is to be an unique (sequential) number in the DXF
                  * file.\n
@@ -139,16 +140,16 @@ dxf_insert_struct
                  * (optional).\n
                  * Group code = 310.\n
                  * \since Introduced in version R2000. */
-        char *dictionary_owner_soft;
+        uint64_t dictionary_owner_soft;
                 /*!< Soft-pointer ID/handle to owner dictionary (optional).\n
                  * Group code = 330.\n
                  * \since Introduced in version R14. */
-        char *material;
+        uint64_t material;
                 /*!< Hard-pointer ID/handle to material object (present if
                  * not BYLAYER).\n
                  * Group code = 347.\n
                  * \since Introduced in version R2008. */
-        char *dictionary_owner_hard;
+        uint64_t dictionary_owner_hard;
                 /*!< Hard owner ID/handle to owner dictionary (optional).\n
                  * Group code = 360.\n
                  * \since Introduced in version R14. */
@@ -157,7 +158,7 @@ dxf_insert_struct
                  * Stored and moved around as a 16-bit integer.\n
                  * Group code = 370.\n
                  * \since Introduced in version R2002. */
-        char *plot_style_name;
+        uint64_t plot_style_name;
                 /*!< Hard pointer ID / handle of PlotStyleName object.\n
                  * Group code = 390.\n
                  * \since Introduced in version R2009. */
@@ -247,20 +248,90 @@ dxf_insert_struct
                 /*!< Z-value of the extrusion vector.\n
                  * Defaults to 1.0 if ommitted in the DXF file.\n
                  * Group code = 230. */
+        struct dxf_block_struct *block;
+                /*!< pointer to the resolved definition of the block
+                 * named \c block_name, not owned by the DxfInsert.\n
+                 * \c NULL when not (yet) resolved. */
         struct DxfInsert *next;
                 /*!< pointer to the next DxfInsert.\n
                  * \c NULL in the last DxfInsert. */
 } DxfInsert;
 
 
+/*!
+ * \brief Maximum number of nested \c INSERT entities expanded by a
+ * \c DxfInsertExplode.
+ */
+#define DXF_INSERT_EXPLODE_MAX_DEPTH 16
+
+
+/*!
+ * \brief DXF definition of one \c INSERT entity being expanded by a
+ * \c DxfInsertExplode.
+ */
+typedef struct
+dxf_insert_explode_frame_struct
+{
+        DxfInsert *insert;
+                /*!< The \c INSERT entity. */
+        struct dxf_block_struct *block;
+                /*!< The block definition of \c insert. */
+        struct dxf_block_entity_struct *entity_list;
+                /*!< The entity list of \c block. */
+        size_t number_of_entities;
+                /*!< Number of entities in \c entity_list. */
+        size_t index;
+                /*!< Index of the next entity in \c entity_list. */
+        int column;
+                /*!< Column of the current cell. */
+        int row;
+                /*!< Row of the current cell. */
+        int columns;
+                /*!< Number of columns, at least 1. */
+        int rows;
+                /*!< Number of rows, at least 1. */
+        DxfTransform transform;
+                /*!< Transformation from the coordinates of \c block to
+                 * the coordinates of the exploded \c INSERT, for the
+                 * current cell. */
+} DxfInsertExplodeFrame;
+
+
+/*!
+ * \brief DXF definition of an iterator over the geometry of an
+ * \c INSERT entity.
+ *
+ * See dxf_insert_explode_init ().
+ */
+typedef struct
+dxf_insert_explode_struct
+{
+        DxfInsertExplodeFrame frames[DXF_INSERT_EXPLODE_MAX_DEPTH];
+                /*!< The \c INSERT entities being expanded, outermost
+                 * first. */
+        int depth;
+                /*!< Number of frames in use. */
+        struct dxf_block_map_struct *blocks;
+                /*!< Block map resolving unresolved \c INSERT entities,
+                 * may be \c NULL. */
+        const char *type;
+                /*!< Entity type name of \c entity. */
+        void *entity;
+                /*!< The entity last handed out, \c NULL at the end. */
+        size_t number_skipped;
+                /*!< Number of \c INSERT entities which could not be
+                 * expanded. */
+} DxfInsertExplode;
+
+
 DxfInsert *dxf_insert_new ();
 DxfInsert *dxf_insert_init (DxfInsert *insert);
 DxfInsert *dxf_insert_read (DxfFile *fp, DxfInsert *insert);
 int dxf_insert_write (DxfFile *fp, DxfInsert *insert);
 int dxf_insert_free (DxfInsert *insert);
 void dxf_insert_free_list (DxfInsert *inserts);
-int dxf_insert_get_id_code (DxfInsert *insert);
-DxfInsert *dxf_insert_set_id_code (DxfInsert *insert, int id_code);
+uint64_t dxf_insert_get_id_code (DxfInsert *insert);
+DxfInsert *dxf_insert_set_id_code (DxfInsert *insert, uint64_t id_code);
 char *dxf_insert_get_linetype (DxfInsert *insert);
 DxfInsert *dxf_insert_set_linetype (DxfInsert *insert, char *linetype);
 char *dxf_insert_get_layer (DxfInsert *insert);
@@ -283,16 +354,16 @@ int16_t dxf_insert_get_shadow_mode (DxfInsert *insert);
 DxfInsert *dxf_insert_set_shadow_mode (DxfInsert *insert, int16_t shadow_mode);
 DxfBinaryData *dxf_insert_get_binary_graphics_data (DxfInsert *insert);
 DxfInsert *dxf_insert_set_binary_graphics_data (DxfInsert *insert, DxfBinaryData *data);
-char *dxf_insert_get_dictionary_owner_soft (DxfInsert *insert);
-DxfInsert *dxf_insert_set_dictionary_owner_soft (DxfInsert *insert, char *dictionary_owner_soft);
-char *dxf_insert_get_material (DxfInsert *insert);
-DxfInsert *dxf_insert_set_material (DxfInsert *insert, char *material);
-char *dxf_insert_get_dictionary_owner_hard (DxfInsert *insert);
-DxfInsert *dxf_insert_set_dictionary_owner_hard (DxfInsert *insert, char *dictionary_owner_hard);
+uint64_t dxf_insert_get_dictionary_owner_soft (DxfInsert *insert);
+DxfInsert *dxf_insert_set_dictionary_owner_soft (DxfInsert *insert, uint64_t dictionary_owner_soft);
+uint64_t dxf_insert_get_material (DxfInsert *insert);
+DxfInsert *dxf_insert_set_material (DxfInsert *insert, uint64_t material);
+uint64_t dxf_insert_get_dictionary_owner_hard (DxfInsert *insert);
+DxfInsert *dxf_insert_set_dictionary_owner_hard (DxfInsert *insert, uint64_t dictionary_owner_hard);
 int16_t dxf_insert_get_lineweight (DxfInsert *insert);
 DxfInsert *dxf_insert_set_lineweight (DxfInsert *insert, int16_t lineweight);
-char *dxf_insert_get_plot_style_name (DxfInsert *insert);
-DxfInsert *dxf_insert_set_plot_style_name (DxfInsert *insert, char *plot_style_name);
+uint64_t dxf_insert_get_plot_style_name (DxfInsert *insert);
+DxfInsert *dxf_insert_set_plot_style_name (DxfInsert *insert, uint64_t plot_style_name);
 long dxf_insert_get_color_value (DxfInsert *insert);
 DxfInsert *dxf_insert_set_color_value (DxfInsert *insert, long color_value);
 char *dxf_insert_get_color_name (DxfInsert *insert);
@@ -338,6 +409,16 @@ DxfInsert *dxf_insert_set_extrusion_vector (DxfInsert *insert, double extr_x0, d
 DxfInsert *dxf_insert_get_next (DxfInsert *insert);
 DxfInsert *dxf_insert_set_next (DxfInsert *insert, DxfInsert *next);
 DxfInsert *dxf_insert_get_last (DxfInsert *insert);
+struct dxf_block_struct *dxf_insert_get_block (DxfInsert *insert);
+DxfInsert *dxf_insert_set_block (DxfInsert *insert, struct dxf_block_struct *block);
+int dxf_insert_get_transform (DxfInsert *insert, int column, int row, DxfTransform *transform);
+int dxf_insert_get_bbox (DxfInsert *insert, DxfBbox *bbox);
+int dxf_insert_transform (DxfInsert *insert, DxfTransform *transform);
+int dxf_insert_explode_init (DxfInsertExplode *explode, DxfInsert *insert, struct dxf_block_map_struct *blocks);
+void *dxf_insert_explode_next (DxfInsertExplode *explode);
+const char *dxf_insert_explode_get_type (DxfInsertExplode *explode);
+DxfTransform *dxf_insert_explode_get_transform (DxfInsertExplode *explode);
+DxfInsert *dxf_insert_explode_get_insert (DxfInsertExplode *explode);
 
 
 #ifdef __cplusplus
@@ -44,6 +44,7 @@
 
 
 #include "layer.h"
+#include "util.h"
 
 
 /*!
@@ -66,7 +67,7 @@ dxf_layer_new ()
         size = sizeof (DxfLayer);
         /* avoid malloc of 0 bytes */
         if (size == 0) size = 1;
-        if ((layer = malloc (size)) == NULL)
+        if ((layer = dxf_malloc (size)) == NULL)
         {
                 fprintf (stderr,
                   (_("Error in %s () could not allocate memory for a DxfLayer struct.\n")),
@@ -117,16 +118,16 @@ dxf_layer_init
               return (NULL);
         }
         dxf_layer_set_id_code (layer, 0);
-        dxf_layer_set_layer_name (layer, strdup (""));
-        dxf_layer_set_linetype (layer, strdup (DXF_DEFAULT_LINETYPE));
+        dxf_layer_set_layer_name (layer, dxf_strdup (""));
+        dxf_layer_set_linetype (layer, dxf_strdup (DXF_DEFAULT_LINETYPE));
         dxf_layer_set_color (layer, DXF_COLOR_BYLAYER);
         dxf_layer_set_flag (layer, 0);
         dxf_layer_set_plotting_flag (layer, 0);
-        dxf_layer_set_dictionary_owner_soft (layer, strdup (""));
-        dxf_layer_set_material (layer, strdup (""));
-        dxf_layer_set_dictionary_owner_hard (layer, strdup (""));
+        dxf_layer_set_dictionary_owner_soft (layer, 0);
+        dxf_layer_set_material (layer, 0);
+        dxf_layer_set_dictionary_owner_hard (layer, 0);
         dxf_layer_set_lineweight (layer, 0);
-        dxf_layer_set_plot_style_name (layer, strdup (""));
+        dxf_layer_set_plot_style_name (layer, 0);
         /* Initialize new structs for the following members later,
          * when they are required and when we have content. */
         dxf_layer_set_next (layer, NULL);
@@ -160,7 +161,8 @@ dxf_layer_read
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        char *temp_string = NULL;
+        char temp_string[DXF_MAX_STRING_LENGTH];
+        int group_code;
 
         /* Do some basic checks. */
         if (fp == NULL)
@@ -168,8 +170,6 @@ dxf_layer_read
                 fprintf (stderr,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
-                /* Clean up. */
-                free (temp_string);
                 return (NULL);
         }
         if (layer == NULL)
@@ -179,116 +179,107 @@ dxf_layer_read
                   __FUNCTION__);
                 layer = dxf_layer_init (layer);
         }
-        (fp->line_number)++;
-        fscanf (fp->fp, "%[^\n]", temp_string);
-        while (strcmp (temp_string, "0") != 0)
+        while ((dxf_read_group_code (fp, &group_code) == EXIT_SUCCESS)
+          && (group_code != 0))
         {
-                if (ferror (fp->fp))
+                if (dxf_read_error (fp))
                 {
                         fprintf (stderr,
                           (_("Error in %s () while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
-                        fclose (fp->fp);
-                        /* Clean up. */
-                        free (temp_string);
                         return (NULL);
                 }
-                if (strcmp (temp_string, "2") == 0)
-                {
-                        /* Now follows a string containing the layer
-                         * name. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, layer->layer_name);
-                }
-                else if (strcmp (temp_string, "6") == 0)
-                {
-                        /* Now follows a string containing the linetype
-                         * name. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, layer->linetype);
-                }
-                else if (strcmp (temp_string, "62") == 0)
-                {
-                        /* Now follows a string containing the
-                         * color value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%d\n", &layer->color);
-                }
-                else if (strcmp (temp_string, "70") == 0)
+                switch (group_code)
                 {
-                        /* Now follows a string containing the
-                         * flag value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%d\n", &layer->flag);
-                }
-                else if ((fp->acad_version_number >= AutoCAD_13)
-                        && (strcmp (temp_string, "100") == 0))
-                {
-                        /* Now follows a string containing the
-                         * subclass marker value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
-                        if ((strcmp (temp_string, "AcDbSymbolTable") != 0)
-                        && ((strcmp (temp_string, "AcDbLayerTableRecord") != 0)))
-                        {
+                        case 5:
+                                /* Now follows a string containing a sequential
+                                 * id number. */
+                                dxf_read_handle (fp, &layer->id_code);
+                                break;
+                        case 2:
+                                /* Now follows a string containing the layer
+                                 * name. */
+                                dxf_read_string (fp, &layer->layer_name);
+                                break;
+                        case 6:
+                                /* Now follows a string containing the linetype
+                                 * name. */
+                                dxf_read_string_interned (fp, &layer->linetype);
+                                break;
+                        case 62:
+                                /* Now follows a string containing the
+                                 * color value. */
+                                dxf_read_int (fp, &layer->color);
+                                break;
+                        case 70:
+                                /* Now follows a string containing the
+                                 * flag value. */
+                                dxf_read_int (fp, &layer->flag);
+                                break;
+                        case 100:
+                                if (fp->acad_version_number >= AutoCAD_13)
+                                {
+                                        /* Now follows a string containing the
+                                         * subclass marker value. */
+                                        dxf_read_line (temp_string, fp);
+                                        if ((strcmp (temp_string, "AcDbSymbolTable") != 0)
+                                        && ((strcmp (temp_string, "AcDbLayerTableRecord") != 0)))
+                                        {
+                                                fprintf (stderr,
+                                                  (_("Warning in %s () found a bad subclass marker in: %s in line: %d.\n")),
+                                                  __FUNCTION__, fp->filename, fp->line_number);
+                                        }
+                                }
+                                else
+                                {
+                                        fprintf (stderr,
+                                          (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
+                                          __FUNCTION__, fp->filename, fp->line_number);
+                                        /* Skip the value of the unknown group code. */
+                                        dxf_read_line (temp_string, fp);
+                                }
+                                break;
+                        case 290:
+                                /* Now follows a string containing the plotting
+                                 * flag value. */
+                                dxf_read_int (fp, &layer->plotting_flag);
+                                break;
+                        case 330:
+                                /* Now follows a string containing Soft-pointer
+                                 * ID/handle to owner dictionary. */
+                                dxf_read_handle (fp, &layer->dictionary_owner_soft);
+                                break;
+                        case 347:
+                                /* Now follows a string containing the material. */
+                                dxf_read_handle (fp, &layer->material);
+                                break;
+                        case 360:
+                                /* Now follows a string containing Hard owner
+                                 * ID/handle to owner dictionary. */
+                                dxf_read_handle (fp, &layer->dictionary_owner_hard);
+                                break;
+                        case 370:
+                                /* Now follows a string containing the
+                                 * lineweight. */
+                                dxf_read_int16 (fp, &layer->lineweight);
+                                break;
+                        case 390:
+                                /* Now follows a string containing the plot style
+                                 * name. */
+                                dxf_read_handle (fp, &layer->plot_style_name);
+                                break;
+                        case 999:
+                                /* Now follows a string containing a comment. */
+                                dxf_read_line (temp_string, fp);
+                                fprintf (stdout, "DXF comment: %s\n", temp_string);
+                                break;
+                        default:
                                 fprintf (stderr,
-                                  (_("Warning in %s () found a bad subclass marker in: %s in line: %d.\n")),
+                                  (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
                                   __FUNCTION__, fp->filename, fp->line_number);
-                        }
-                }
-                else if (strcmp (temp_string, "290") == 0)
-                {
-                        /* Now follows a string containing the plotting
-                         * flag value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%d\n", &layer->plotting_flag);
-                }
-                else if (strcmp (temp_string, "330") == 0)
-                {
-                        /* Now follows a string containing Soft-pointer
-                         * ID/handle to owner dictionary. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, layer->dictionary_owner_soft);
-                }
-                else if (strcmp (temp_string, "347") == 0)
-                {
-                        /* Now follows a string containing the material. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, layer->material);
-                }
-                else if (strcmp (temp_string, "360") == 0)
-                {
-                        /* Now follows a string containing Hard owner
-                         * ID/handle to owner dictionary. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, layer->dictionary_owner_hard);
-                }
-                else if (strcmp (temp_string, "370") == 0)
-                {
-                        /* Now follows a string containing the
-                         * lineweight. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%hd\n", &layer->lineweight);
-                }
-                else if (strcmp (temp_string, "390") == 0)
-                {
-                        /* Now follows a string containing the plot style
-                         * name. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, layer->plot_style_name);
-                }
-                else if (strcmp (temp_string, "999") == 0)
-                {
-                        /* Now follows a string containing a comment. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
-                        fprintf (stdout, "DXF comment: %s\n", temp_string);
-                }
-                else
-                {
-                        fprintf (stderr,
-                          (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
-                          __FUNCTION__, fp->filename, fp->line_number);
+                                /* Skip the value of the unknown group code. */
+                                dxf_read_line (temp_string, fp);
+                                break;
                 }
         }
         /* Handle omitted members and/or illegal values. */
@@ -303,10 +294,8 @@ dxf_layer_read
         }
         if (strcmp (layer->linetype, "") == 0)
         {
-                layer->linetype = strdup (DXF_DEFAULT_LINETYPE);
+                layer->linetype = dxf_strdup (DXF_DEFAULT_LINETYPE);
         }
-        /* Clean up. */
-        free (temp_string);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -332,7 +321,7 @@ dxf_layer_write
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        char *dxf_entity_name = strdup ("LAYER");
+        char *dxf_entity_name = dxf_strdup ("LAYER");
 
         /* Do some basic checks. */
         if (fp == NULL)
@@ -341,7 +330,7 @@ dxf_layer_write
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (layer == NULL)
@@ -350,7 +339,7 @@ dxf_layer_write
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (strcmp (dxf_layer_get_layer_name (layer), "") == 0)
@@ -359,7 +348,7 @@ dxf_layer_write
                   (_("Error in %s () empty layer string for the %s table.\n")),
                   __FUNCTION__, dxf_entity_name);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (strcmp (dxf_layer_get_linetype (layer), "") == 0)
@@ -370,13 +359,13 @@ dxf_layer_write
                 fprintf (stderr,
                   (_("\t%s entity is reset to default linetype")),
                   dxf_entity_name);
-                dxf_layer_set_linetype (layer, strdup (DXF_DEFAULT_LINETYPE));
+                dxf_layer_set_linetype (layer, dxf_strdup (DXF_DEFAULT_LINETYPE));
         }
         /* Start writing output. */
-        fprintf (fp->fp, "  0\n%s\n", dxf_entity_name);
-        if (layer->id_code != -1)
+        dxf_write_string (fp, 0, dxf_entity_name);
+        if (layer->id_code != DXF_HANDLE_NONE)
         {
-                fprintf (fp->fp, "  5\n%x\n", dxf_layer_get_id_code (layer));
+                dxf_write_hex (fp, 5, dxf_layer_get_id_code (layer));
         }
         /*!
          * \todo for version R14.\n
@@ -388,37 +377,37 @@ dxf_layer_write
          * 102 groups are application defined (optional).\n\n
          * End of group, "}" (optional), with Group code 102.
          */
-        if ((strcmp (dxf_layer_get_dictionary_owner_soft (layer), "") != 0)
+        if ((dxf_layer_get_dictionary_owner_soft (layer) != 0)
           && (fp->acad_version_number >= AutoCAD_14))
         {
-                fprintf (fp->fp, "102\n{ACAD_REACTORS\n");
-                fprintf (fp->fp, "330\n%s\n", dxf_layer_get_dictionary_owner_soft (layer));
-                fprintf (fp->fp, "102\n}\n");
+                dxf_write_string (fp, 102, "{ACAD_REACTORS");
+                dxf_write_hex (fp, 330, dxf_layer_get_dictionary_owner_soft (layer));
+                dxf_write_string (fp, 102, "}");
         }
         if (fp->acad_version_number >= AutoCAD_14)
         {
-                fprintf (fp->fp, "100\nAcDbSymbolTable\n");
+                dxf_write_string (fp, 100, "AcDbSymbolTable");
         }
         if (fp->acad_version_number >= AutoCAD_14)
         {
-                fprintf (fp->fp, "100\nAcDbLayerTableRecord\n");
+                dxf_write_string (fp, 100, "AcDbLayerTableRecord");
         }
-        fprintf (fp->fp, "  2\n%s\n", dxf_layer_get_layer_name (layer));
-        fprintf (fp->fp, " 70\n%d\n", dxf_layer_get_flag (layer));
-        fprintf (fp->fp, " 62\n%d\n", dxf_layer_get_color (layer));
-        fprintf (fp->fp, "  6\n%s\n", dxf_layer_get_linetype (layer));
+        dxf_write_string (fp, 2, dxf_layer_get_layer_name (layer));
+        dxf_write_int (fp, 70, dxf_layer_get_flag (layer));
+        dxf_write_int (fp, 62, dxf_layer_get_color (layer));
+        dxf_write_string (fp, 6, dxf_layer_get_linetype (layer));
         if (fp->acad_version_number >= AutoCAD_2000)
         {
-                fprintf (fp->fp, "290\n%d\n", dxf_layer_get_plotting_flag (layer));
-                fprintf (fp->fp, "370\n%hd\n", dxf_layer_get_lineweight (layer));
-                fprintf (fp->fp, "390\n%s\n", dxf_layer_get_plot_style_name (layer));
+                dxf_write_int (fp, 290, dxf_layer_get_plotting_flag (layer));
+                dxf_write_int (fp, 370, dxf_layer_get_lineweight (layer));
+                dxf_write_hex (fp, 390, dxf_layer_get_plot_style_name (layer));
         }
         if (fp->acad_version_number >= AutoCAD_2007)
         {
-                fprintf (fp->fp, "347\n%s\n", dxf_layer_get_material (layer));
+                dxf_write_hex (fp, 347, dxf_layer_get_material (layer));
         }
         /* Clean up. */
-        free (dxf_entity_name);
+        dxf_free (dxf_entity_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -459,13 +448,9 @@ dxf_layer_free
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        free (dxf_layer_get_layer_name (layer));
-        free (dxf_layer_get_linetype (layer));
-        free (dxf_layer_get_dictionary_owner_soft (layer));
-        free (dxf_layer_get_material (layer));
-        free (dxf_layer_get_dictionary_owner_hard (layer));
-        free (dxf_layer_get_plot_style_name (layer));
-        free (layer);
+        dxf_free (dxf_layer_get_layer_name (layer));
+        dxf_free (dxf_layer_get_linetype (layer));
+        dxf_free (layer);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -511,7 +496,7 @@ dxf_layer_free_list
  *
  * \return ID code.
  */
-int
+uint64_t
 dxf_layer_get_id_code
 (
         DxfLayer *layer
@@ -529,13 +514,6 @@ dxf_layer_get_id_code
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (layer->id_code < 0)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a negative value was found.\n")),
-                  __FUNCTION__);
-                return (EXIT_FAILURE);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -551,7 +529,7 @@ dxf_layer_set_id_code
 (
         DxfLayer *layer,
                 /*!< a pointer to a DXF \c LAYER entity. */
-        int id_code
+        uint64_t id_code
                 /*!< Identification number for the entity.\n
                  * This is to be an unique (sequential) number in the DXF
                  * file. */
@@ -568,13 +546,6 @@ dxf_layer_set_id_code
                   __FUNCTION__);
                 return (NULL);
         }
-        if (id_code < 0)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a negative value was passed.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
         layer->id_code = id_code;
 #if DEBUG
         DXF_DEBUG_END
@@ -616,7 +587,7 @@ dxf_layer_get_layer_name
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (layer->layer_name));
+        return (dxf_strdup (layer->layer_name));
 }
 
 
@@ -651,7 +622,7 @@ dxf_layer_set_layer_name
                   __FUNCTION__);
                 return (NULL);
         }
-        layer->layer_name = strdup (layer_name);
+        layer->layer_name = dxf_strdup (layer_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -692,7 +663,7 @@ dxf_layer_get_linetype
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (layer->linetype));
+        return (dxf_strdup (layer->linetype));
 }
 
 
@@ -726,7 +697,7 @@ dxf_layer_set_linetype
                   __FUNCTION__);
                 return (NULL);
         }
-        layer->linetype = strdup (linetype);
+        layer->linetype = dxf_strdup (linetype);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1173,10 +1144,8 @@ dxf_layer_set_plotting_flag
  * \c LAYER entity.
  *
  * \return soft pointer to the dictionary owner.
- *
- * \warning No checks are performed on the returned pointer (string).
  */
-char *
+uint64_t
 dxf_layer_get_dictionary_owner_soft
 (
         DxfLayer *layer
@@ -1192,19 +1161,12 @@ dxf_layer_get_dictionary_owner_soft
                 fprintf (stderr,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
-                return (NULL);
-        }
-        if (layer->dictionary_owner_soft ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
+                return (0);
         }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (layer->dictionary_owner_soft));
+        return (layer->dictionary_owner_soft);
 }
 
 
@@ -1217,8 +1179,8 @@ dxf_layer_set_dictionary_owner_soft
 (
         DxfLayer *layer,
                 /*!< a pointer to a DXF \c LAYER entity. */
-        char *dictionary_owner_soft
-                /*!< a string containing the pointer to the
+        uint64_t dictionary_owner_soft
+                /*!< the handle of the
                  * dictionary_owner_soft for the entity. */
 )
 {
@@ -1233,14 +1195,7 @@ dxf_layer_set_dictionary_owner_soft
                   __FUNCTION__);
                 return (NULL);
         }
-        if (dictionary_owner_soft == NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was passed.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
-        layer->dictionary_owner_soft = strdup (dictionary_owner_soft);
+        layer->dictionary_owner_soft = dictionary_owner_soft;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1251,12 +1206,10 @@ dxf_layer_set_dictionary_owner_soft
 /*!
  * \brief Get the pointer to the \c material from a DXF \c LAYER entity.
  *
- * \return a pointer to \c material when successful, or \c NULL when an
+ * \return the handle \c material when successful, or 0 when an
  * error occurred.
- *
- * \warning No checks are performed on the returned pointer.
  */
-char *
+uint64_t
 dxf_layer_get_material
 (
         DxfLayer *layer
@@ -1272,19 +1225,12 @@ dxf_layer_get_material
                 fprintf (stderr,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
-                return (NULL);
-        }
-        if (layer->material ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
+                return (0);
         }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (layer->material));
+        return (layer->material);
 }
 
 
@@ -1299,8 +1245,8 @@ dxf_layer_set_material
 (
         DxfLayer *layer,
                 /*!< a pointer to a DXF \c LAYER entity. */
-        char *material
-                /*!< a string containing the pointer to the \c
+        uint64_t material
+                /*!< the handle of the \c
                  * material for the entity. */
 )
 {
@@ -1315,14 +1261,7 @@ dxf_layer_set_material
                   __FUNCTION__);
                 return (NULL);
         }
-        if (material == NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was passed.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
-        layer->material = strdup (material);
+        layer->material = material;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1335,10 +1274,8 @@ dxf_layer_set_material
  * \c LAYER entity.
  *
  * \return hard pointer to the dictionary owner.
- *
- * \warning No checks are performed on the returned pointer (string).
  */
-char *
+uint64_t
 dxf_layer_get_dictionary_owner_hard
 (
         DxfLayer *layer
@@ -1354,19 +1291,12 @@ dxf_layer_get_dictionary_owner_hard
                 fprintf (stderr,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
-                return (NULL);
-        }
-        if (layer->dictionary_owner_hard ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
+                return (0);
         }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (layer->dictionary_owner_hard));
+        return (layer->dictionary_owner_hard);
 }
 
 
@@ -1379,8 +1309,8 @@ dxf_layer_set_dictionary_owner_hard
 (
         DxfLayer *layer,
                 /*!< a pointer to a DXF \c LAYER entity. */
-        char *dictionary_owner_hard
-                /*!< a string containing the pointer to the
+        uint64_t dictionary_owner_hard
+                /*!< the handle of the
                  * dictionary_owner_hard for the entity. */
 )
 {
@@ -1395,14 +1325,7 @@ dxf_layer_set_dictionary_owner_hard
                   __FUNCTION__);
                 return (NULL);
         }
-        if (dictionary_owner_hard == NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was passed.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
-        layer->dictionary_owner_hard = strdup (dictionary_owner_hard);
+        layer->dictionary_owner_hard = dictionary_owner_hard;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1478,10 +1401,10 @@ dxf_layer_set_lineweight
 /*!
  * \brief Get the \c plot_style_name from a DXF \c LAYER entity.
  *
- * \return a pointer to \c plot_style_name when sucessful, or \c NULL
+ * \return the handle \c plot_style_name when sucessful, or 0
  * when an error occurred.
  */
-char *
+uint64_t
 dxf_layer_get_plot_style_name
 (
         DxfLayer *layer
@@ -1497,19 +1420,12 @@ dxf_layer_get_plot_style_name
                 fprintf (stderr,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
-                return (NULL);
-        }
-        if (layer->plot_style_name ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
+                return (0);
         }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (layer->plot_style_name));
+        return (layer->plot_style_name);
 }
 
 
@@ -1524,7 +1440,7 @@ dxf_layer_set_plot_style_name
 (
         DxfLayer *layer,
                 /*!< a pointer to a DXF \c LAYER entity. */
-        char *plot_style_name
+        uint64_t plot_style_name
                 /*!< a string containing the \c plot_style_name for the
                  * entity. */
 )
@@ -1540,14 +1456,7 @@ dxf_layer_set_plot_style_name
                   __FUNCTION__);
                 return (NULL);
         }
-        if (plot_style_name == NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was passed.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
-        layer->plot_style_name = strdup (plot_style_name);
+        layer->plot_style_name = plot_style_name;
 #if DEBUG
         DXF_DEBUG_END
 #endif
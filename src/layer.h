@@ -57,7 +57,7 @@ extern "C" {
 typedef struct
 dxf_layer_struct
 {
-        int id_code;
+        uint64_t id_code;
                 /*!< Identification number for the entity.\n
                  * This is to be an unique (sequential) number in the DXF
                  * file.\n
@@ -90,20 +90,20 @@ dxf_layer_struct
                 /*!< Plotting flag.\n
                  * Boolean, if set to 0, do not plot this layer.\n
                  * Group code = 290. */
-        char *dictionary_owner_soft;
+        uint64_t dictionary_owner_soft;
                 /*!< Soft-pointer ID/handle to owner dictionary
                  * (optional).\n
                  * Group code = 330. */
-        char *material;
+        uint64_t material;
                 /*!< Hard-pointer ID / handle to Material object.\n
                  * Group code = 347. */
-        char *dictionary_owner_hard;
+        uint64_t dictionary_owner_hard;
                 /*!< group code = 360\n
                  * Hard owner ID/handle to owner dictionary (optional). */
         int16_t lineweight;
                 /*!< Lineweight enum value.\n
                  * Group code = 370. */
-        char *plot_style_name;
+        uint64_t plot_style_name;
                 /*!< Hard pointer ID / handle of PlotStyleName object.\n
                  * Group code = 390. */
         struct DxfLayer *next;
@@ -118,8 +118,8 @@ DxfLayer *dxf_layer_read (DxfFile *fp, DxfLayer *layer);
 int dxf_layer_write (DxfFile *fp, DxfLayer *layer);
 int dxf_layer_free (DxfLayer *layer);
 void dxf_layer_free_list (DxfLayer *layers);
-int dxf_layer_get_id_code (DxfLayer *layer);
-DxfLayer *dxf_layer_set_id_code (DxfLayer *layer, int id_code);
+uint64_t dxf_layer_get_id_code (DxfLayer *layer);
+DxfLayer *dxf_layer_set_id_code (DxfLayer *layer, uint64_t id_code);
 char *dxf_layer_get_layer_name (DxfLayer *layer);
 DxfLayer *dxf_layer_set_layer_name (DxfLayer *layer, char *layer_name);
 char *dxf_layer_get_linetype (DxfLayer *layer);
@@ -136,16 +136,16 @@ int dxf_layer_is_xresolved (DxfLayer *layer);
 int dxf_layer_is_referenced (DxfLayer *layer);
 int dxf_layer_get_plotting_flag (DxfLayer *layer);
 DxfLayer *dxf_layer_set_plotting_flag (DxfLayer *layer, int plotting_flag);
-char *dxf_layer_get_dictionary_owner_soft (DxfLayer *layer);
-DxfLayer *dxf_layer_set_dictionary_owner_soft (DxfLayer *layer, char *dictionary_owner_soft);
-char *dxf_layer_get_material (DxfLayer *layer);
-DxfLayer *dxf_layer_set_material (DxfLayer *layer, char *material);
-char *dxf_layer_get_dictionary_owner_hard (DxfLayer *layer);
-DxfLayer *dxf_layer_set_dictionary_owner_hard (DxfLayer *layer, char *dictionary_owner_hard);
+uint64_t dxf_layer_get_dictionary_owner_soft (DxfLayer *layer);
+DxfLayer *dxf_layer_set_dictionary_owner_soft (DxfLayer *layer, uint64_t dictionary_owner_soft);
+uint64_t dxf_layer_get_material (DxfLayer *layer);
+DxfLayer *dxf_layer_set_material (DxfLayer *layer, uint64_t material);
+uint64_t dxf_layer_get_dictionary_owner_hard (DxfLayer *layer);
+DxfLayer *dxf_layer_set_dictionary_owner_hard (DxfLayer *layer, uint64_t dictionary_owner_hard);
 int16_t dxf_layer_get_lineweight (DxfLayer *layer);
 DxfLayer *dxf_layer_set_lineweight (DxfLayer *layer, int16_t lineweight);
-char *dxf_layer_get_plot_style_name (DxfLayer *layer);
-DxfLayer *dxf_layer_set_plot_style_name (DxfLayer *layer, char *plot_style_name);
+uint64_t dxf_layer_get_plot_style_name (DxfLayer *layer);
+DxfLayer *dxf_layer_set_plot_style_name (DxfLayer *layer, uint64_t plot_style_name);
 DxfLayer *dxf_layer_get_next (DxfLayer *layer);
 DxfLayer *dxf_layer_set_next (DxfLayer *layer, DxfLayer *next);
 DxfLayer *dxf_layer_get_last (DxfLayer *layer);
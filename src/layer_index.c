@@ -61,6 +61,7 @@
 
 
 #include "layer_index.h"
+#include "idbuffer.h"
 
 
 /*!
@@ -80,7 +81,7 @@ dxf_layer_index_new ()
         size = sizeof (DxfLayerIndex);
         /* avoid malloc of 0 bytes */
         if (size == 0) size = 1;
-        if ((layer_index = malloc (size)) == NULL)
+        if ((layer_index = dxf_malloc (size)) == NULL)
         {
                 fprintf (stderr,
                   (_("Error in %s () could not allocate memory for a DxfLayerIndex struct.\n")),
@@ -130,14 +131,12 @@ dxf_layer_index_init
                   __FUNCTION__);
                 return (NULL);
         }
-        layer_index->id_code = 0;
-        layer_index->dictionary_owner_soft = strdup ("");
-        layer_index->dictionary_owner_hard = strdup ("");
+        layer_index->id_code = DXF_HANDLE_NONE;
+        layer_index->dictionary_owner_soft = 0;
+        layer_index->dictionary_owner_hard = 0;
         layer_index->time_stamp = 0;
         /* Initialize new structs for the following members later,
          * when they are required and when we have content. */
-        /*! \todo Proper implementation \c number_of_entries and
-         * \c hard_owner_reference required. */ 
         layer_index->layer_name = NULL;
         layer_index->number_of_entries = NULL;
         layer_index->hard_owner_reference = NULL;
@@ -157,11 +156,12 @@ dxf_layer_index_init
  * "  0" string announcing the following entity, or the end of the
  * \c ENTITY section marker \c ENDSEC. \n
  * While parsing the DXF file store data in \c layer_index. \n
+ * Every layer name (group code 8) is followed by the hard owner
+ * reference to it's \c IDBUFFER (group code 360) and the number of
+ * entries in that \c IDBUFFER (group code 90), a group code 360
+ * before the first layer name is the hard owner dictionary.
  *
  * \return a pointer to \c layer_index.
- *
- * \todo Proper implementation \c number_of_entries and
- * \c hard_owner_reference required.
  */
 DxfLayerIndex *
 dxf_layer_index_read
@@ -175,10 +175,15 @@ dxf_layer_index_read
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        char *temp_string = NULL;
-        DxfLayerName *iter;
-        int i;
-        int k;
+        char temp_string[DXF_MAX_STRING_LENGTH];
+        int group_code;
+        DxfLayerName *name_iter = NULL;
+        DxfInt32 *entries_iter = NULL;
+        DxfInt64 *reference_iter = NULL;
+        DxfLayerName *name;
+        DxfInt32 *entries;
+        DxfInt64 *reference;
+        uint64_t handle;
 
         /* Do some basic checks. */
         if (fp == NULL)
@@ -186,8 +191,6 @@ dxf_layer_index_read
                 fprintf (stderr,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
-                /* Clean up. */
-                free (temp_string);
                 return (NULL);
         }
         if (fp->acad_version_number < AutoCAD_14)
@@ -203,119 +206,137 @@ dxf_layer_index_read
                   __FUNCTION__);
                 layer_index = dxf_layer_index_init (layer_index);
         }
-        i = 0;
-        k = 0;
-        iter = (DxfLayerName *) layer_index->layer_name; /* Pointer to first entry. */
-        (fp->line_number)++;
-        fscanf (fp->fp, "%[^\n]", temp_string);
-        while (strcmp (temp_string, "0") != 0)
+        while ((dxf_read_group_code (fp, &group_code) == EXIT_SUCCESS)
+          && (group_code != 0))
         {
-                if (ferror (fp->fp))
+                if (dxf_read_error (fp))
                 {
                         fprintf (stderr,
                           (_("Error in %s () while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
                         /* Clean up. */
-                        free (temp_string);
-                        fclose (fp->fp);
                         return (NULL);
                 }
-                if (strcmp (temp_string, "5") == 0)
-                {
-                        /* Now follows a string containing a sequential
-                         * id number. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%x\n", (uint *) &layer_index->id_code);
-                }
-                if (strcmp (temp_string, "8") == 0)
-                {
-                        /* Now follows a string containing a layer name
-                         * (multiple entries may exist). */
-                        if (i > 0) /* Create a pointer for the next entry. */
-                        {
-                                dxf_layer_name_init ((DxfLayerName *) iter->next);
-                                iter = (DxfLayerName *) iter->next;
-                        }
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, iter->name);
-                        i++; /* Increase number of entries. */
-                }
-                if (strcmp (temp_string, "40") == 0)
+                switch (group_code)
                 {
-                        /* Now follows a string containing a time stamp. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &layer_index->time_stamp);
-                }
-                if (strcmp (temp_string, "90") == 0)
-                {
-                        /* Now follows a string containing a number of
-                         * entries in the LAYER_INDEX list (multiple
-                         * entries may exist). */
-                        (fp->line_number)++;
-                        /*! \todo Implement reading of \c number_of_entries
-                         * properly.
-                        fscanf (fp->fp, "%d\n", &layer_index->number_of_entries);
-                         */
-                }
-                else if ((fp->acad_version_number >= AutoCAD_13)
-                        && (strcmp (temp_string, "100") == 0))
-                {
-                        /* Now follows a string containing the
-                         * subclass marker value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
-                        if ((strcmp (temp_string, "AcDbIndex") != 0)
-                          && (strcmp (temp_string, "AcDbLayerIndex") != 0))
-                        {
+                        case 5:
+                                /* Now follows a string containing a sequential
+                                 * id number. */
+                                dxf_read_handle (fp, &layer_index->id_code);
+                                break;
+                        case 8:
+                                /* Now follows a string containing a layer name
+                                 * (multiple entries may exist). */
+                                name = dxf_layer_name_init (dxf_layer_name_new ());
+                                if (name == NULL)
+                                {
+                                        return (NULL);
+                                }
+                                dxf_read_string (fp, &name->name);
+                                if (name_iter == NULL)
+                                {
+                                        layer_index->layer_name = name;
+                                }
+                                else
+                                {
+                                        name_iter->next = (struct DxfLayerName *) name;
+                                }
+                                name_iter = name;
+                                break;
+                        case 40:
+                                /* Now follows a string containing a time stamp. */
+                                dxf_read_double (fp, &layer_index->time_stamp);
+                                break;
+                        case 90:
+                                /* Now follows a string containing a number of
+                                 * entries in the IDBUFFER list (multiple
+                                 * entries may exist). */
+                                entries = dxf_int32_init (dxf_int32_new ());
+                                if (entries == NULL)
+                                {
+                                        return (NULL);
+                                }
+                                dxf_read_int32 (fp, &entries->value);
+                                if (entries_iter == NULL)
+                                {
+                                        layer_index->number_of_entries = entries;
+                                }
+                                else
+                                {
+                                        entries_iter->next = (struct DxfInt32 *) entries;
+                                }
+                                entries_iter = entries;
+                                break;
+                        case 100:
+                                if (fp->acad_version_number >= AutoCAD_13)
+                                {
+                                        /* Now follows a string containing the
+                                         * subclass marker value. */
+                                        dxf_read_line (temp_string, fp);
+                                        if ((strcmp (temp_string, "AcDbIndex") != 0)
+                                          && (strcmp (temp_string, "AcDbLayerIndex") != 0))
+                                        {
+                                                fprintf (stderr,
+                                                  (_("Warning in %s () found a bad subclass marker in: %s in line: %d.\n")),
+                                                  __FUNCTION__, fp->filename, fp->line_number);
+                                        }
+                                }
+                                else
+                                {
+                                        fprintf (stderr,
+                                          (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
+                                          __FUNCTION__, fp->filename, fp->line_number);
+                                        /* Skip the value of the unknown group code. */
+                                        dxf_read_line (temp_string, fp);
+                                }
+                                break;
+                        case 330:
+                                /* Now follows a string containing Soft-pointer
+                                 * ID/handle to owner dictionary. */
+                                dxf_read_handle (fp, &layer_index->dictionary_owner_soft);
+                                break;
+                        case 360:
+                                if (name_iter == NULL)
+                                {
+                                        /* Now follows a string containing Hard owner
+                                         * ID/handle to owner dictionary. */
+                                        dxf_read_handle (fp, &layer_index->dictionary_owner_hard);
+                                        break;
+                                }
+                                /* Now follows a string containing a Hard owner
+                                 * reference to an IDBUFFER (multiple entries
+                                 * may exist). */
+                                reference = dxf_int64_init (dxf_int64_new ());
+                                if (reference == NULL)
+                                {
+                                        return (NULL);
+                                }
+                                dxf_read_handle (fp, &handle);
+                                reference->value = (int64_t) handle;
+                                if (reference_iter == NULL)
+                                {
+                                        layer_index->hard_owner_reference = reference;
+                                }
+                                else
+                                {
+                                        reference_iter->next = (struct DxfInt64 *) reference;
+                                }
+                                reference_iter = reference;
+                                break;
+                        case 999:
+                                /* Now follows a string containing a comment. */
+                                dxf_read_line (temp_string, fp);
+                                fprintf (stdout, (_("DXF comment: %s\n")), temp_string);
+                                break;
+                        default:
                                 fprintf (stderr,
-                                  (_("Warning in %s () found a bad subclass marker in: %s in line: %d.\n")),
+                                  (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
                                   __FUNCTION__, fp->filename, fp->line_number);
-                        }
-                }
-                else if (strcmp (temp_string, "330") == 0)
-                {
-                        /* Now follows a string containing Soft-pointer
-                         * ID/handle to owner dictionary. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, layer_index->dictionary_owner_soft);
-                }
-                else if ((strcmp (temp_string, "360") == 0)
-                  && (k == 0))
-                {
-                        /* Now follows a string containing Hard owner
-                         * ID/handle to owner dictionary. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, layer_index->dictionary_owner_hard);
-                        k++;
-                }
-                else if ((strcmp (temp_string, "360") == 0)
-                  && (k > 0))
-                {
-                        /* Now follows a string containing a Hard owner
-                         * reference LAYER_INDEX (multiple entries may
-                         * exist). */
-                        (fp->line_number)++;
-                        /*! \todo Implement reading of \c hard_owner_reference
-                         * properly.
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, layer_index->hard_owner_reference);
-                         */
-                }
-                else if (strcmp (temp_string, "999") == 0)
-                {
-                        /* Now follows a string containing a comment. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
-                        fprintf (stdout, (_("DXF comment: %s\n")), temp_string);
-                }
-                else
-                {
-                        fprintf (stderr,
-                          (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
-                          __FUNCTION__, fp->filename, fp->line_number);
+                                /* Skip the value of the unknown group code. */
+                                dxf_read_line (temp_string, fp);
+                                break;
                 }
         }
-        /* Clean up. */
-        free (temp_string);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -328,9 +349,6 @@ dxf_layer_index_read
  *
  * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
  * occurred.
- *
- * \todo Proper implementation \c number_of_entries and
- * \c hard_owner_reference required.
  */
 int
 dxf_layer_index_write
@@ -344,9 +362,10 @@ dxf_layer_index_write
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        char *dxf_entity_name = strdup ("LAYER_INDEX");
-        DxfLayerName *iter;
-        int i;
+        char *dxf_entity_name = dxf_strdup ("LAYER_INDEX");
+        DxfLayerName *name;
+        DxfInt32 *entries;
+        DxfInt64 *reference;
 
         /* Do some basic checks. */
         if (fp == NULL)
@@ -355,7 +374,7 @@ dxf_layer_index_write
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (layer_index == NULL)
@@ -364,20 +383,20 @@ dxf_layer_index_write
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (fp->acad_version_number < AutoCAD_14)
         {
                 fprintf (stderr,
-                  (_("Warning in %s () illegal DXF version for this %s entity with id-code: %x.\n")),
+                  (_("Warning in %s () illegal DXF version for this %s entity with id-code: %" PRIx64 ".\n")),
                   __FUNCTION__, dxf_entity_name, layer_index->id_code);
         }
         /* Start writing output. */
-        fprintf (fp->fp, "  0\n%s\n", dxf_entity_name);
-        if (layer_index->id_code != -1)
+        dxf_write_string (fp, 0, dxf_entity_name);
+        if (layer_index->id_code != DXF_HANDLE_NONE)
         {
-                fprintf (fp->fp, "  5\n%x\n", layer_index->id_code);
+                dxf_write_hex (fp, 5, layer_index->id_code);
         }
         /*!
          * \todo for version R14.\n
@@ -389,43 +408,49 @@ dxf_layer_index_write
          * 102 groups are application defined (optional).\n\n
          * End of group, "}" (optional), with Group code 102.
          */
-        if ((strcmp (layer_index->dictionary_owner_soft, "") != 0)
+        if ((layer_index->dictionary_owner_soft != 0)
           && (fp->acad_version_number >= AutoCAD_14))
         {
-                fprintf (fp->fp, "102\n{ACAD_REACTORS\n");
-                fprintf (fp->fp, "330\n%s\n", layer_index->dictionary_owner_soft);
-                fprintf (fp->fp, "102\n}\n");
+                dxf_write_string (fp, 102, "{ACAD_REACTORS");
+                dxf_write_hex (fp, 330, layer_index->dictionary_owner_soft);
+                dxf_write_string (fp, 102, "}");
         }
-        if ((strcmp (layer_index->dictionary_owner_hard, "") != 0)
+        if ((layer_index->dictionary_owner_hard != 0)
           && (fp->acad_version_number >= AutoCAD_14))
         {
-                fprintf (fp->fp, "102\n{ACAD_XDICTIONARY\n");
-                fprintf (fp->fp, "360\n%s\n", layer_index->dictionary_owner_hard);
-                fprintf (fp->fp, "102\n}\n");
+                dxf_write_string (fp, 102, "{ACAD_XDICTIONARY");
+                dxf_write_hex (fp, 360, layer_index->dictionary_owner_hard);
+                dxf_write_string (fp, 102, "}");
         }
         if (fp->acad_version_number >= AutoCAD_13)
         {
-                fprintf (fp->fp, "100\nAcDbIndex\n");
+                dxf_write_string (fp, 100, "AcDbIndex");
         }
-        fprintf (fp->fp, " 40\n%lf\n", layer_index->time_stamp);
-        iter = (DxfLayerName *) layer_index->layer_name;
-        i = 0;
-        while (strlen (iter->name) > 0)
+        dxf_write_double (fp, 40, layer_index->time_stamp);
+        if (fp->acad_version_number >= AutoCAD_13)
         {
-                fprintf (fp->fp, "  8\n%s\n", iter->name);
-                iter = (DxfLayerName *) iter->next;
-                i++;
+                dxf_write_string (fp, 100, "AcDbLayerIndex");
         }
-        /*! \todo Implement reading of \c hard_owner_reference and
-         * \c number_of_entries  properly.
-        while (strlen (layer_index->layer_name->name) > 0)
+        name = (DxfLayerName *) layer_index->layer_name;
+        entries = (DxfInt32 *) layer_index->number_of_entries;
+        reference = (DxfInt64 *) layer_index->hard_owner_reference;
+        while (name != NULL)
         {
-                fprintf (fp->fp, "360\n%s\n", layer_index->hard_owner_reference);
-                fprintf (fp->fp, " 90\n%d\n", layer_index->number_of_entries);
+                dxf_write_string (fp, 8, name->name);
+                if (reference != NULL)
+                {
+                        dxf_write_hex (fp, 360, (uint64_t) reference->value);
+                        reference = (DxfInt64 *) reference->next;
+                }
+                if (entries != NULL)
+                {
+                        dxf_write_int (fp, 90, entries->value);
+                        entries = (DxfInt32 *) entries->next;
+                }
+                name = (DxfLayerName *) name->next;
         }
-         */
         /* Clean up. */
-        free (dxf_entity_name);
+        dxf_free (dxf_entity_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -466,11 +491,19 @@ dxf_layer_index_free
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        free (layer_index->dictionary_owner_soft);
-        free (layer_index->dictionary_owner_hard);
-        dxf_char_free_list (layer_index->layer_name);
-        dxf_char_free_list (layer_index->hard_owner_reference);
-        free (layer_index);
+        if (layer_index->layer_name != NULL)
+        {
+                dxf_layer_name_free_list (layer_index->layer_name);
+        }
+        if (layer_index->number_of_entries != NULL)
+        {
+                dxf_int32_free_list (layer_index->number_of_entries);
+        }
+        if (layer_index->hard_owner_reference != NULL)
+        {
+                dxf_int64_free_list (layer_index->hard_owner_reference);
+        }
+        dxf_free (layer_index);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -517,7 +550,7 @@ dxf_layer_index_free_list
  * \return \c id_code if successful, or \c EXIT_FAILURE when an error
  * occurred.
  */
-int
+uint64_t
 dxf_layer_index_get_id_code
 (
         DxfLayerIndex *layer_index
@@ -535,13 +568,6 @@ dxf_layer_index_get_id_code
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (layer_index->id_code < 0)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a negative value was found.\n")),
-                  __FUNCTION__);
-                return (EXIT_FAILURE);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -560,7 +586,7 @@ dxf_layer_index_set_id_code
 (
         DxfLayerIndex *layer_index,
                 /*!< a pointer to a DXF \c LAYER_INDEX object. */
-        int id_code
+        uint64_t id_code
                 /*!< Identification number for the object.\n
                  * This is to be an unique (sequential) number in the DXF
                  * file. */
@@ -577,13 +603,6 @@ dxf_layer_index_set_id_code
                   __FUNCTION__);
                 return (NULL);
         }
-        if (id_code < 0)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a negative value was passed.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
         layer_index->id_code = id_code;
 #if DEBUG
         DXF_DEBUG_END
@@ -597,12 +616,10 @@ dxf_layer_index_set_id_code
  * \c LAYER_INDEX object.
  *
  *
- * \return a pointer to \c dictionary_owner_soft if successful,
+ * \return the handle \c dictionary_owner_soft if successful,
  * or \c EXIT_FAILURE when an error occurred.
- *
- * \warning No checks are performed on the returned pointer (string).
  */
-char *
+uint64_t
 dxf_layer_index_get_dictionary_owner_soft
 (
         DxfLayerIndex *layer_index
@@ -618,19 +635,12 @@ dxf_layer_index_get_dictionary_owner_soft
                 fprintf (stderr,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
-                return (NULL);
-        }
-        if (layer_index->dictionary_owner_soft ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
+                return (0);
         }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (layer_index->dictionary_owner_soft));
+        return (layer_index->dictionary_owner_soft);
 }
 
 
@@ -646,8 +656,8 @@ dxf_layer_index_set_dictionary_owner_soft
 (
         DxfLayerIndex *layer_index,
                 /*!< a pointer to a DXF \c LAYER_INDEX object. */
-        char *dictionary_owner_soft
-                /*!< a string containing the pointer to the
+        uint64_t dictionary_owner_soft
+                /*!< the handle of the
                  * dictionary_owner_soft for the entity. */
 )
 {
@@ -662,14 +672,7 @@ dxf_layer_index_set_dictionary_owner_soft
                   __FUNCTION__);
                 return (NULL);
         }
-        if (dictionary_owner_soft == NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was passed.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
-        layer_index->dictionary_owner_soft = strdup (dictionary_owner_soft);
+        layer_index->dictionary_owner_soft = dictionary_owner_soft;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -681,12 +684,10 @@ dxf_layer_index_set_dictionary_owner_soft
  * \brief Get the hard pointer to the dictionary owner from a DXF 
  * \c LAYER_INDEX object.
  *
- * \return a pointer to \c dictionary_owner_hard, or \c NULL when an
+ * \return the handle \c dictionary_owner_hard, or 0 when an
  * error occurred.
- *
- * \warning No checks are performed on the returned pointer (string).
  */
-char *
+uint64_t
 dxf_layer_index_get_dictionary_owner_hard
 (
         DxfLayerIndex *layer_index
@@ -702,19 +703,12 @@ dxf_layer_index_get_dictionary_owner_hard
                 fprintf (stderr,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
-                return (NULL);
-        }
-        if (layer_index->dictionary_owner_hard ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
+                return (0);
         }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (layer_index->dictionary_owner_hard));
+        return (layer_index->dictionary_owner_hard);
 }
 
 
@@ -730,8 +724,8 @@ dxf_layer_index_set_dictionary_owner_hard
 (
         DxfLayerIndex *layer_index,
                 /*!< a pointer to a DXF \c LAYER_INDEX object. */
-        char *dictionary_owner_hard
-                /*!< a string containing the pointer to the
+        uint64_t dictionary_owner_hard
+                /*!< the handle of the
                  * dictionary_owner_hard for the entity. */
 )
 {
@@ -746,14 +740,7 @@ dxf_layer_index_set_dictionary_owner_hard
                   __FUNCTION__);
                 return (NULL);
         }
-        if (dictionary_owner_hard == NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was passed.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
-        layer_index->dictionary_owner_hard = strdup (dictionary_owner_hard);
+        layer_index->dictionary_owner_hard = dictionary_owner_hard;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -970,4 +957,748 @@ dxf_layer_index_get_last
 }
 
 
+/*!
+ * \brief Initial number of slots in the hash table of a
+ * \c DxfLayerIndexMap.
+ */
+#define DXF_LAYER_INDEX_MAP_INITIAL_CAPACITY 64
+
+
+/*!
+ * \brief Compute the FNV-1a hash of a layer name.
+ */
+static size_t
+dxf_layer_index_map_hash
+(
+        const char *layer_name
+                /*!< Layer name. */
+)
+{
+        uint64_t hash = 14695981039346656037ULL;
+
+        for (; *layer_name != '\0'; layer_name++)
+        {
+                hash ^= (unsigned char) *layer_name;
+                hash *= 1099511628211ULL;
+        }
+        return ((size_t) hash);
+}
+
+
+/*!
+ * \brief Find the slot holding a layer name, or the empty slot where
+ * it should be inserted.
+ *
+ * Interned layer names are matched on their pointer, other names are
+ * compared.
+ */
+static size_t
+dxf_layer_index_map_find_slot
+(
+        DxfLayerIndexMap *map,
+                /*!< a pointer to a libDXF layer index map. */
+        const char *layer_name,
+                /*!< Layer name. */
+        size_t hash
+                /*!< Hash of \c layer_name. */
+)
+{
+        size_t mask = map->capacity - 1;
+        size_t i = hash & mask;
+
+        while (map->layers[i].layer_name != NULL)
+        {
+                if ((map->layers[i].hash == hash)
+                  && (strcmp (map->layers[i].layer_name, layer_name) == 0))
+                {
+                        break;
+                }
+                i = (i + 1) & mask;
+        }
+        return (i);
+}
+
+
+/*!
+ * \brief Double the number of slots in the hash table of a
+ * \c DxfLayerIndexMap.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+static int
+dxf_layer_index_map_grow
+(
+        DxfLayerIndexMap *map
+                /*!< a pointer to a libDXF layer index map. */
+)
+{
+        DxfLayerIndexLayer *old_layers = map->layers;
+        size_t old_capacity = map->capacity;
+        size_t i;
+
+        map->capacity = old_capacity * 2;
+        map->layers = calloc (map->capacity, sizeof (DxfLayerIndexLayer));
+        if (map->layers == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () could not allocate memory.\n")),
+                  __FUNCTION__);
+                map->layers = old_layers;
+                map->capacity = old_capacity;
+                return (EXIT_FAILURE);
+        }
+        for (i = 0; i < old_capacity; i++)
+        {
+                if (old_layers[i].layer_name != NULL)
+                {
+                        map->layers[dxf_layer_index_map_find_slot (map,
+                          old_layers[i].layer_name, old_layers[i].hash)] = old_layers[i];
+                }
+        }
+        free (old_layers);
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Find the entities on a layer in a \c DxfLayerIndexMap.
+ *
+ * \return a pointer to the layer, or \c NULL when the layer is not in
+ * the map and \c create is \c FALSE, or when an error occurred.
+ */
+static DxfLayerIndexLayer *
+dxf_layer_index_map_find_layer
+(
+        DxfLayerIndexMap *map,
+                /*!< a pointer to a libDXF layer index map. */
+        const char *layer_name,
+                /*!< Layer name. */
+        int create
+                /*!< Add the layer when it is not in the map yet. */
+)
+{
+        size_t hash = dxf_layer_index_map_hash (layer_name);
+        size_t length;
+        size_t i;
+
+        i = dxf_layer_index_map_find_slot (map, layer_name, hash);
+        if (map->layers[i].layer_name != NULL)
+        {
+                return (&map->layers[i]);
+        }
+        if (!create)
+        {
+                return (NULL);
+        }
+        /* Keep the load factor at or below one half. */
+        if (2 * (map->count + 1) > map->capacity)
+        {
+                if (dxf_layer_index_map_grow (map) == EXIT_FAILURE)
+                {
+                        return (NULL);
+                }
+                i = dxf_layer_index_map_find_slot (map, layer_name, hash);
+        }
+        length = strlen (layer_name);
+        if ((map->layers[i].layer_name = malloc (length + 1)) == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () could not allocate memory.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        memcpy (map->layers[i].layer_name, layer_name, length + 1);
+        map->layers[i].hash = hash;
+        map->count++;
+        return (&map->layers[i]);
+}
+
+
+/*!
+ * \brief Append an entity to the entities on a layer.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+static int
+dxf_layer_index_layer_append
+(
+        DxfLayerIndexLayer *layer,
+                /*!< a pointer to the layer. */
+        const char *type,
+                /*!< Entity type name. */
+        void *entity
+                /*!< the entity. */
+)
+{
+        DxfLayerIndexEntity *entities;
+        size_t capacity;
+
+        if (layer->number_of_entities == layer->capacity)
+        {
+                capacity = (layer->capacity == 0) ? 16 : 2 * layer->capacity;
+                entities = realloc (layer->entities, capacity * sizeof (DxfLayerIndexEntity));
+                if (entities == NULL)
+                {
+                        fprintf (stderr,
+                          (_("Error in %s () could not allocate memory.\n")),
+                          __FUNCTION__);
+                        return (EXIT_FAILURE);
+                }
+                layer->entities = entities;
+                layer->capacity = capacity;
+        }
+        layer->entities[layer->number_of_entities].type = type;
+        layer->entities[layer->number_of_entities].entity = entity;
+        layer->number_of_entities++;
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Allocate memory for a libDXF \c DxfLayerIndexMap.
+ *
+ * \return \c NULL when no memory was allocated, a pointer to the
+ * allocated memory when successful.
+ */
+DxfLayerIndexMap *
+dxf_layer_index_map_new ()
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfLayerIndexMap *map = NULL;
+
+        if ((map = malloc (sizeof (DxfLayerIndexMap))) == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () could not allocate memory.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        memset (map, 0, sizeof (DxfLayerIndexMap));
+        map->capacity = DXF_LAYER_INDEX_MAP_INITIAL_CAPACITY;
+        map->layers = calloc (map->capacity, sizeof (DxfLayerIndexLayer));
+        if (map->layers == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () could not allocate memory.\n")),
+                  __FUNCTION__);
+                free (map);
+                return (NULL);
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (map);
+}
+
+
+/*!
+ * \brief Free the allocated memory for a libDXF \c DxfLayerIndexMap.
+ *
+ * The indexed entities are not freed.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_layer_index_map_free
+(
+        DxfLayerIndexMap *map
+                /*!< a pointer to the memory occupied by the libDXF
+                 * layer index map. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        size_t i;
+
+        /* Do some basic checks. */
+        if (map == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        for (i = 0; i < map->capacity; i++)
+        {
+                free (map->layers[i].layer_name);
+                free (map->layers[i].entities);
+        }
+        free (map->layers);
+        free (map);
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Add an entity to a libDXF \c DxfLayerIndexMap.
+ *
+ * The entity is added to the layer named by it's \c layer member.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_layer_index_map_add
+(
+        DxfLayerIndexMap *map,
+                /*!< a pointer to a libDXF layer index map. */
+        const char *type,
+                /*!< Entity type name, for example "LINE" (not
+                 * copied). */
+        void *entity
+                /*!< the entity. */
+)
+{
+        const char *layer_name;
+        DxfLayerIndexLayer *layer;
+
+        /* Do some basic checks. */
+        if ((map == NULL) || (type == NULL) || (entity == NULL))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        layer_name = dxf_entities_get_entity_layer (type, entity);
+        if (layer_name == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () no layer found for the %s entity.\n")),
+                  __FUNCTION__, type);
+                return (EXIT_FAILURE);
+        }
+        layer = dxf_layer_index_map_find_layer (map, layer_name, TRUE);
+        if (layer == NULL)
+        {
+                return (EXIT_FAILURE);
+        }
+        return (dxf_layer_index_layer_append (layer, type, entity));
+}
+
+
+/*!
+ * \brief Remove an entity from a libDXF \c DxfLayerIndexMap.
+ *
+ * The order of the other entities on the layer is kept.
+ *
+ * \warning Remove an entity before changing it's \c layer member, and
+ * add it again afterwards.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when the entity
+ * was not found or an error occurred.
+ */
+int
+dxf_layer_index_map_remove
+(
+        DxfLayerIndexMap *map,
+                /*!< a pointer to a libDXF layer index map. */
+        const char *type,
+                /*!< Entity type name, for example "LINE". */
+        void *entity
+                /*!< the entity. */
+)
+{
+        const char *layer_name;
+        DxfLayerIndexLayer *layer;
+        size_t i;
+
+        /* Do some basic checks. */
+        if ((map == NULL) || (type == NULL) || (entity == NULL))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        layer_name = dxf_entities_get_entity_layer (type, entity);
+        layer = (layer_name == NULL) ? NULL
+          : dxf_layer_index_map_find_layer (map, layer_name, FALSE);
+        if (layer != NULL)
+        {
+                /* Entities removed are mostly the ones added last. */
+                for (i = layer->number_of_entities; i > 0; i--)
+                {
+                        if (layer->entities[i - 1].entity == entity)
+                        {
+                                memmove (&layer->entities[i - 1], &layer->entities[i],
+                                  (layer->number_of_entities - i) * sizeof (DxfLayerIndexEntity));
+                                layer->number_of_entities--;
+                                return (EXIT_SUCCESS);
+                        }
+                }
+        }
+        fprintf (stderr,
+          (_("Warning in %s () the %s entity was not found in the layer index.\n")),
+          __FUNCTION__, type);
+        return (EXIT_FAILURE);
+}
+
+
+/*!
+ * \brief Add the entities of a DXF \c ENTITIES section to a libDXF
+ * \c DxfLayerIndexMap.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_layer_index_map_add_entities
+(
+        DxfLayerIndexMap *map,
+                /*!< a pointer to a libDXF layer index map. */
+        DxfEntities *entities
+                /*!< a pointer to the DXF \c ENTITIES section. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfEntitiesCursor cursor;
+        const char *layer_name;
+        const char *last_layer_name = NULL;
+        DxfLayerIndexLayer *layer = NULL;
+
+        /* Do some basic checks. */
+        if ((map == NULL) || (entities == NULL))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        dxf_entities_cursor_init (&cursor, entities);
+        while (cursor.entity != NULL)
+        {
+                layer_name = dxf_entities_cursor_get_layer (&cursor);
+                if (layer_name == NULL)
+                {
+                        layer_name = DXF_DEFAULT_LAYER;
+                }
+                /* Consecutive entities are mostly on the same layer,
+                 * with interned layer names that is one compare. */
+                if ((layer == NULL) || (layer_name != last_layer_name))
+                {
+                        layer = dxf_layer_index_map_find_layer (map, layer_name, TRUE);
+                        if (layer == NULL)
+                        {
+                                return (EXIT_FAILURE);
+                        }
+                        last_layer_name = layer_name;
+                }
+                if (dxf_layer_index_layer_append (layer,
+                  dxf_entities_cursor_get_type (&cursor), cursor.entity) == EXIT_FAILURE)
+                {
+                        return (EXIT_FAILURE);
+                }
+                dxf_entities_cursor_skip (&cursor, 1);
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Get the entities on a layer from a libDXF
+ * \c DxfLayerIndexMap.
+ *
+ * \return a pointer to the first of \c number_of_entities entity
+ * references, valid until the map is changed, or \c NULL when there
+ * are no entities on the layer.
+ */
+DxfLayerIndexEntity *
+dxf_layer_index_map_get_entities
+(
+        DxfLayerIndexMap *map,
+                /*!< a pointer to a libDXF layer index map. */
+        const char *layer_name,
+                /*!< Layer name. */
+        size_t *number_of_entities
+                /*!< Returns the number of entities on the layer. */
+)
+{
+        DxfLayerIndexLayer *layer;
+
+        /* Do some basic checks. */
+        if ((map == NULL) || (layer_name == NULL) || (number_of_entities == NULL))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        layer = dxf_layer_index_map_find_layer (map, layer_name, FALSE);
+        if ((layer == NULL) || (layer->number_of_entities == 0))
+        {
+                *number_of_entities = 0;
+                return (NULL);
+        }
+        *number_of_entities = layer->number_of_entities;
+        return (layer->entities);
+}
+
+
+/*!
+ * \brief Get the number of layers in a libDXF \c DxfLayerIndexMap.
+ *
+ * \return the number of layers, 0 when an error occurred.
+ */
+size_t
+dxf_layer_index_map_get_count
+(
+        DxfLayerIndexMap *map
+                /*!< a pointer to a libDXF layer index map. */
+)
+{
+        /* Do some basic checks. */
+        if (map == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (0);
+        }
+        return (map->count);
+}
+
+
+/*!
+ * \brief Count the entities with a handle on a layer.
+ */
+static int32_t
+dxf_layer_index_layer_count_handles
+(
+        DxfLayerIndexLayer *layer
+                /*!< a pointer to the layer. */
+)
+{
+        int32_t number = 0;
+        size_t i;
+
+        for (i = 0; i < layer->number_of_entities; i++)
+        {
+                if (dxf_entities_get_entity_id_code (layer->entities[i].type,
+                  layer->entities[i].entity) != 0)
+                {
+                        number++;
+                }
+        }
+        return (number);
+}
+
+
+/*!
+ * \brief Get the number of objects dxf_layer_index_map_write () writes
+ * for a libDXF \c DxfLayerIndexMap.
+ *
+ * One \c LAYER_INDEX object plus one \c IDBUFFER object for every
+ * layer with entities with a handle, so the caller can reserve their
+ * handles up front.
+ *
+ * \return the number of objects, or 0 when an error occurred.
+ */
+size_t
+dxf_layer_index_map_get_number_of_objects
+(
+        DxfLayerIndexMap *map
+                /*!< a pointer to a libDXF layer index map. */
+)
+{
+        size_t number = 1;
+        size_t i;
+
+        /* Do some basic checks. */
+        if (map == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (0);
+        }
+        for (i = 0; i < map->capacity; i++)
+        {
+                if ((map->layers[i].layer_name != NULL)
+                  && (dxf_layer_index_layer_count_handles (&map->layers[i]) != 0))
+                {
+                        number++;
+                }
+        }
+        return (number);
+}
+
+
+/*!
+ * \brief Write DXF output to a file for a libDXF \c DxfLayerIndexMap.
+ *
+ * The map is written as a \c LAYER_INDEX object followed by an
+ * \c IDBUFFER object for every layer, to be called while writing the
+ * \c OBJECTS section.\n
+ * The objects get consecutive handles starting at \c handle_seed,
+ * entities without a handle are left out.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_layer_index_map_write
+(
+        DxfFile *fp,
+                /*!< DXF file pointer to an output file (or device). */
+        DxfLayerIndexMap *map,
+                /*!< a pointer to a libDXF layer index map. */
+        uint64_t owner,
+                /*!< Handle of the dictionary owning the
+                 * \c LAYER_INDEX object. */
+        uint64_t *handle_seed
+                /*!< Next free handle, returns the next handle not
+                 * used. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfLayerIndex *layer_index = NULL;
+        DxfIdbuffer *idbuffer = NULL;
+        DxfLayerName *name;
+        DxfLayerName *name_iter = NULL;
+        DxfInt32 *entries;
+        DxfInt32 *entries_iter = NULL;
+        DxfInt64 *reference;
+        DxfInt64 *reference_iter = NULL;
+        int32_t number;
+        uint64_t id_code;
+        size_t i;
+        size_t j;
+        int result = EXIT_FAILURE;
+
+        /* Do some basic checks. */
+        if ((fp == NULL) || (map == NULL) || (handle_seed == NULL))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        layer_index = dxf_layer_index_init (dxf_layer_index_new ());
+        idbuffer = dxf_idbuffer_init (dxf_idbuffer_new ());
+        if ((layer_index == NULL) || (idbuffer == NULL))
+        {
+                goto cleanup;
+        }
+        layer_index->id_code = (*handle_seed)++;
+        layer_index->dictionary_owner_soft = owner;
+        /* Julian date of the Unix epoch plus the days since. */
+        layer_index->time_stamp = 2440587.5 + (double) time (NULL) / 86400.0;
+        for (i = 0; i < map->capacity; i++)
+        {
+                if ((map->layers[i].layer_name == NULL)
+                  || ((number = dxf_layer_index_layer_count_handles (&map->layers[i])) == 0))
+                {
+                        continue;
+                }
+                name = dxf_layer_name_new ();
+                entries = dxf_int32_init (dxf_int32_new ());
+                reference = dxf_int64_init (dxf_int64_new ());
+                if ((name == NULL) || (entries == NULL) || (reference == NULL))
+                {
+                        if (name != NULL)
+                        {
+                                dxf_layer_name_free (name);
+                        }
+                        if (entries != NULL)
+                        {
+                                dxf_int32_free (entries);
+                        }
+                        if (reference != NULL)
+                        {
+                                dxf_int64_free (reference);
+                        }
+                        goto cleanup;
+                }
+                name->name = dxf_strdup (map->layers[i].layer_name);
+                entries->value = number;
+                reference->value = (int64_t) (*handle_seed)++;
+                if (name_iter == NULL)
+                {
+                        layer_index->layer_name = name;
+                        layer_index->number_of_entries = entries;
+                        layer_index->hard_owner_reference = reference;
+                }
+                else
+                {
+                        name_iter->next = (struct DxfLayerName *) name;
+                        entries_iter->next = (struct DxfInt32 *) entries;
+                        reference_iter->next = (struct DxfInt64 *) reference;
+                }
+                name_iter = name;
+                entries_iter = entries;
+                reference_iter = reference;
+        }
+        if (dxf_layer_index_write (fp, layer_index) == EXIT_FAILURE)
+        {
+                goto cleanup;
+        }
+        /* The IDBUFFER objects, in the order of the layer names. */
+        reference = (DxfInt64 *) layer_index->hard_owner_reference;
+        idbuffer->object_owner_soft = layer_index->id_code;
+        for (i = 0; i < map->capacity; i++)
+        {
+                if ((map->layers[i].layer_name == NULL)
+                  || (dxf_layer_index_layer_count_handles (&map->layers[i]) == 0))
+                {
+                        continue;
+                }
+                idbuffer->id_code = (uint64_t) reference->value;
+                reference = (DxfInt64 *) reference->next;
+                /* The entity pointers are the last group codes of an
+                 * IDBUFFER, write them straight from the map instead
+                 * of building a list. */
+                if (dxf_idbuffer_write (fp, idbuffer) == EXIT_FAILURE)
+                {
+                        goto cleanup;
+                }
+                for (j = 0; j < map->layers[i].number_of_entities; j++)
+                {
+                        id_code = dxf_entities_get_entity_id_code (map->layers[i].entities[j].type,
+                          map->layers[i].entities[j].entity);
+                        if (id_code != 0)
+                        {
+                                dxf_write_hex (fp, 330, id_code);
+                        }
+                }
+        }
+        result = EXIT_SUCCESS;
+cleanup:
+        if (result == EXIT_FAILURE)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () could not write the layer index.\n")),
+                  __FUNCTION__);
+        }
+        if (layer_index != NULL)
+        {
+                dxf_layer_index_free (layer_index);
+        }
+        if (idbuffer != NULL)
+        {
+                dxf_idbuffer_free (idbuffer);
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (result);
+}
+
+
 /* EOF*/
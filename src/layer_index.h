@@ -67,6 +67,7 @@
 #include "global.h"
 #include "util.h"
 #include "layer_name.h"
+#include "entities.h"
 
 
 #ifdef __cplusplus
@@ -81,19 +82,19 @@ typedef struct
 dxf_layer_index_struct
 {
         /* Members common for all DXF group objects. */
-        int id_code;
+        uint64_t id_code;
                 /*!< Identification number for the entity.\n
                  * This is to be an unique (sequential) number in the DXF
                  * file.\n
                  * Group code = 5. */
-        char *dictionary_owner_soft;
+        uint64_t dictionary_owner_soft;
                 /*!< Soft-pointer ID/handle to owner dictionary (optional).\n
                  * Group code = 330. */
-        char *dictionary_owner_hard;
+        uint64_t dictionary_owner_hard;
                 /*!< Hard owner ID/handle to owner dictionary (optional).\n
                  * Group code = 360. */
         /* Specific members for a DXF idbuffer. */
-        struct dxf_char_struct *layer_name;
+        struct dxf_layer_name_struct *layer_name;
                 /*!< Layer name (multiple entries may exist).\n
                  * Group code = 8. */
         double time_stamp;
@@ -103,9 +104,9 @@ dxf_layer_index_struct
                 /*!< Number of entries in the IDBUFFER list (multiple
                  * entries may exist).\n
                  * Group code = 90. */
-        struct dxf_char_struct *hard_owner_reference;
-                /*!< Hard owner reference to IDBUFFER (multiple entries
-                 * may exist).\n
+        struct dxf_int64_struct *hard_owner_reference;
+                /*!< Hard owner reference (handle) to IDBUFFER (multiple
+                 * entries may exist).\n
                  * Group code = 360. */
         struct DxfLayerIndex *next;
                 /*!< Pointer to the next DxfLayerIndex.\n
@@ -113,23 +114,91 @@ dxf_layer_index_struct
 } DxfLayerIndex;
 
 
+/*!
+ * \brief DXF definition of an entity reference in a
+ * \c DxfLayerIndexMap.
+ */
+typedef struct
+dxf_layer_index_entity_struct
+{
+        const char *type;
+                /*!< Entity type name, for example "LINE" (not
+                 * owned). */
+        void *entity;
+                /*!< The entity (not owned). */
+} DxfLayerIndexEntity;
+
+
+/*!
+ * \brief DXF definition of the entities on one layer in a
+ * \c DxfLayerIndexMap.
+ */
+typedef struct
+dxf_layer_index_layer_struct
+{
+        char *layer_name;
+                /*!< Layer name (owned), \c NULL for an empty slot. */
+        size_t hash;
+                /*!< Hash of \c layer_name. */
+        DxfLayerIndexEntity *entities;
+                /*!< The entities on the layer, in the order they were
+                 * added. */
+        size_t number_of_entities;
+                /*!< Number of entities in \c entities. */
+        size_t capacity;
+                /*!< Number of entities \c entities has room for. */
+} DxfLayerIndexLayer;
+
+
+/*!
+ * \brief DXF definition of an in memory layer index.
+ *
+ * An open addressing hash table mapping layer names to compact arrays
+ * of the entities on each layer, so the entities on a layer can be
+ * found without walking every list of a \c DxfEntities.\n
+ * The map does not own the entities, entities added to or freed from
+ * a drawing have to be added to or removed from the map as well.\n
+ * On output it is written as a \c LAYER_INDEX object with one
+ * \c IDBUFFER object per layer.
+ */
+typedef struct
+dxf_layer_index_map_struct
+{
+        DxfLayerIndexLayer *layers;
+                /*!< The hash table. */
+        size_t capacity;
+                /*!< Number of slots, always a power of two. */
+        size_t count;
+                /*!< Number of layers in the map. */
+} DxfLayerIndexMap;
+
+
 DxfLayerIndex *dxf_layer_index_new ();
 DxfLayerIndex *dxf_layer_index_init (DxfLayerIndex *layer_index);
 DxfLayerIndex *dxf_layer_index_read (DxfFile *fp, DxfLayerIndex *layer_index);
 int dxf_layer_index_write (DxfFile *fp, DxfLayerIndex *layer_index);
 int dxf_layer_index_free (DxfLayerIndex *layer_index);
 void dxf_layer_index_free_list (DxfLayerIndex *layer_indices);
-int dxf_layer_index_get_id_code (DxfLayerIndex *layer_index);
-DxfLayerIndex *dxf_layer_index_set_id_code (DxfLayerIndex *layer_index, int id_code);
-char *dxf_layer_index_get_dictionary_owner_soft (DxfLayerIndex *layer_index);
-DxfLayerIndex *dxf_layer_index_set_dictionary_owner_soft (DxfLayerIndex *layer_index, char *dictionary_owner_soft);
-char *dxf_layer_index_get_dictionary_owner_hard (DxfLayerIndex *layer_index);
-DxfLayerIndex *dxf_layer_index_set_dictionary_owner_hard (DxfLayerIndex *layer_index, char *dictionary_owner_hard);
+uint64_t dxf_layer_index_get_id_code (DxfLayerIndex *layer_index);
+DxfLayerIndex *dxf_layer_index_set_id_code (DxfLayerIndex *layer_index, uint64_t id_code);
+uint64_t dxf_layer_index_get_dictionary_owner_soft (DxfLayerIndex *layer_index);
+DxfLayerIndex *dxf_layer_index_set_dictionary_owner_soft (DxfLayerIndex *layer_index, uint64_t dictionary_owner_soft);
+uint64_t dxf_layer_index_get_dictionary_owner_hard (DxfLayerIndex *layer_index);
+DxfLayerIndex *dxf_layer_index_set_dictionary_owner_hard (DxfLayerIndex *layer_index, uint64_t dictionary_owner_hard);
 double dxf_layer_index_get_time_stamp (DxfLayerIndex *layer_index);
 DxfLayerIndex *dxf_layer_index_set_time_stamp (DxfLayerIndex *layer_index, double time_stamp);
 DxfLayerIndex *dxf_layer_index_get_next (DxfLayerIndex *layer_index);
 DxfLayerIndex *dxf_layer_index_set_next (DxfLayerIndex *layer_index, DxfLayerIndex *next);
 DxfLayerIndex *dxf_layer_index_get_last (DxfLayerIndex *layer_index);
+DxfLayerIndexMap *dxf_layer_index_map_new ();
+int dxf_layer_index_map_free (DxfLayerIndexMap *map);
+int dxf_layer_index_map_add (DxfLayerIndexMap *map, const char *type, void *entity);
+int dxf_layer_index_map_remove (DxfLayerIndexMap *map, const char *type, void *entity);
+int dxf_layer_index_map_add_entities (DxfLayerIndexMap *map, DxfEntities *entities);
+DxfLayerIndexEntity *dxf_layer_index_map_get_entities (DxfLayerIndexMap *map, const char *layer_name, size_t *number_of_entities);
+size_t dxf_layer_index_map_get_count (DxfLayerIndexMap *map);
+size_t dxf_layer_index_map_get_number_of_objects (DxfLayerIndexMap *map);
+int dxf_layer_index_map_write (DxfFile *fp, DxfLayerIndexMap *map, uint64_t owner, uint64_t *handle_seed);
 
 
 #ifdef __cplusplus
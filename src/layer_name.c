@@ -61,7 +61,7 @@ dxf_layer_name_new ()
         size = sizeof (DxfLayerName);
         /* avoid malloc of 0 bytes */
         if (size == 0) size = 1;
-        if ((layer_name = malloc (size)) == NULL)
+        if ((layer_name = dxf_malloc (size)) == NULL)
         {
                 fprintf (stderr,
                   (_("Error in %s () could not allocate memory.\n")),
@@ -111,7 +111,7 @@ dxf_layer_name_init
                   __FUNCTION__);
                 return (NULL);
         }
-        layer_name->name = strdup ("");
+        layer_name->name = dxf_strdup ("");
         layer_name->length = 0;
         layer_name->next = NULL;
 #if DEBUG
@@ -154,8 +154,8 @@ dxf_layer_name_free
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        free (layer_name->name);
-        free (layer_name);
+        dxf_free (layer_name->name);
+        dxf_free (layer_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -231,7 +231,7 @@ dxf_layer_name_get_name
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (layer_name->name));
+        return (dxf_strdup (layer_name->name));
 }
 
 
@@ -265,7 +265,7 @@ dxf_layer_name_set_name
                   __FUNCTION__);
                 return (NULL);
         }
-        layer_name->name = strdup (name);
+        layer_name->name = dxf_strdup (name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -42,6 +42,7 @@
 
 
 #include "leader.h"
+#include "util.h"
 
 
 /*!
@@ -64,7 +65,7 @@ dxf_leader_new ()
         size = sizeof (DxfLeader);
         /* avoid malloc of 0 bytes */
         if (size == 0) size = 1;
-        if ((leader = malloc (size)) == NULL)
+        if ((leader = dxf_malloc (size)) == NULL)
         {
                 fprintf (stderr,
                   (_("Error in %s () could not allocate memory for a DxfArc struct.\n")),
@@ -114,9 +115,9 @@ dxf_leader_init
                   __FUNCTION__);
                 return (NULL);
         }
-        leader->id_code = 0;
-        leader->linetype = strdup (DXF_DEFAULT_LINETYPE);
-        leader->layer = strdup (DXF_DEFAULT_LAYER);
+        leader->id_code = DXF_HANDLE_NONE;
+        leader->linetype = dxf_strdup (DXF_DEFAULT_LINETYPE);
+        leader->layer = dxf_strdup (DXF_DEFAULT_LAYER);
         leader->elevation = 0.0;
         leader->thickness = 0.0;
         leader->linetype_scale = DXF_DEFAULT_LINETYPE_SCALE;
@@ -125,16 +126,16 @@ dxf_leader_init
         leader->paperspace = DXF_MODELSPACE;
         leader->graphics_data_size = 0;
         leader->shadow_mode = 0;
-        leader->dictionary_owner_soft = strdup ("");
-        leader->object_owner_soft = strdup ("");
-        leader->material = strdup ("");
-        leader->dictionary_owner_hard = strdup ("");
+        leader->dictionary_owner_soft = 0;
+        leader->object_owner_soft = 0;
+        leader->material = 0;
+        leader->dictionary_owner_hard = 0;
         leader->lineweight = 0;
-        leader->plot_style_name = strdup ("");
+        leader->plot_style_name = 0;
         leader->color_value = 0;
-        leader->color_name = strdup ("");
+        leader->color_name = dxf_strdup ("");
         leader->transparency = 0;
-        leader->dimension_style_name = strdup ("");
+        leader->dimension_style_name = dxf_strdup ("");
         leader->text_annotation_height = 0.0;
         leader->text_annotation_width = 0.0;
         leader->arrow_head_flag = 0;
@@ -147,7 +148,7 @@ dxf_leader_init
         leader->extr_x0 = 0.0;
         leader->extr_y0 = 0.0;
         leader->extr_z0 = 0.0;
-        leader->annotation_reference_hard = strdup ("");
+        leader->annotation_reference_hard = dxf_strdup ("");
         /* Initialize new structs for the following members later,
          * when they are required and when we have content. */
         leader->binary_graphics_data = NULL;
@@ -186,7 +187,8 @@ dxf_leader_read
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        char *temp_string = NULL;
+        char temp_string[DXF_MAX_STRING_LENGTH];
+        int group_code;
         DxfPoint *iter;
         int i;
 
@@ -196,8 +198,6 @@ dxf_leader_read
                 fprintf (stderr,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
-                /* Clean up. */
-                free (temp_string);
                 return (NULL);
         }
         if (fp->acad_version_number < AutoCAD_13)
@@ -217,8 +217,6 @@ dxf_leader_read
                         fprintf (stderr,
                           (_("Error in %s () could not allocate memory.\n")),
                           __FUNCTION__);
-                        /* Clean up. */
-                        free (temp_string);
                         return (NULL);
                 }
         }
@@ -235,8 +233,6 @@ dxf_leader_read
                         fprintf (stderr,
                           (_("Error in %s () could not allocate memory.\n")),
                           __FUNCTION__);
-                        /* Clean up. */
-                        free (temp_string);
                         return (NULL);
                 }
         }
@@ -253,8 +249,6 @@ dxf_leader_read
                         fprintf (stderr,
                           (_("Error in %s () could not allocate memory.\n")),
                           __FUNCTION__);
-                        /* Clean up. */
-                        free (temp_string);
                         return (NULL);
                 }
         }
@@ -271,8 +265,6 @@ dxf_leader_read
                         fprintf (stderr,
                           (_("Error in %s () could not allocate memory.\n")),
                           __FUNCTION__);
-                        /* Clean up. */
-                        free (temp_string);
                         return (NULL);
                 }
         }
@@ -289,8 +281,6 @@ dxf_leader_read
                         fprintf (stderr,
                           (_("Error in %s () could not allocate memory.\n")),
                           __FUNCTION__);
-                        /* Clean up. */
-                        free (temp_string);
                         return (NULL);
                 }
         }
@@ -307,336 +297,278 @@ dxf_leader_read
                         fprintf (stderr,
                           (_("Error in %s () could not allocate memory.\n")),
                           __FUNCTION__);
-                        /* Clean up. */
-                        free (temp_string);
                         return (NULL);
                 }
         }
         i = 0; /* Number of found vertices. */
         iter = (DxfPoint *) leader->p0; /* Pointer to first vertex */
-        (fp->line_number)++;
-        fscanf (fp->fp, "%[^\n]", temp_string);
-        while (strcmp (temp_string, "0") != 0)
+        while ((dxf_read_group_code (fp, &group_code) == EXIT_SUCCESS)
+          && (group_code != 0))
         {
-                if (ferror (fp->fp))
+                if (dxf_read_error (fp))
                 {
                         fprintf (stderr,
                           (_("Error in %s () while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
                         /* Clean up. */
-                        free (temp_string);
-                        fclose (fp->fp);
                         return (NULL);
                 }
-                else if (strcmp (temp_string, "  3") == 0)
-                {
-                        /* Now follows a string containing additional
-                         * proprietary data. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, leader->dimension_style_name);
-                }
-                if (strcmp (temp_string, "5") == 0)
+                switch (group_code)
                 {
-                        /* Now follows a string containing a sequential
-                         * id number. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%x\n", (uint *) &leader->id_code);
-                }
-                else if (strcmp (temp_string, "6") == 0)
-                {
-                        /* Now follows a string containing a linetype
-                         * name. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, leader->linetype);
-                }
-                else if (strcmp (temp_string, "8") == 0)
-                {
-                        /* Now follows a string containing a layer name. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, leader->layer);
-                }
-                else if ((strcmp (temp_string, "10") == 0)
-                  || (strcmp (temp_string, "20") == 0)
-                  || (strcmp (temp_string, "30") == 0))
-                {
-                        if (strcmp (temp_string, "10") == 0)
-                        {
-                                /* Now follows a string containing the X-value
-                                 * of the Vertex coordinates (one entry for each
-                                 * vertex). */
-                                if (i > 0) /* Create a pointer for the next vertex. */
+                        case 3:
+                                /* Now follows a string containing additional
+                                 * proprietary data. */
+                                dxf_read_string (fp, &leader->dimension_style_name);
+                                break;
+                        case 5:
+                                /* Now follows a string containing a sequential
+                                 * id number. */
+                                dxf_read_handle (fp, &leader->id_code);
+                                break;
+                        case 6:
+                                /* Now follows a string containing a linetype
+                                 * name. */
+                                dxf_read_string_interned (fp, &leader->linetype);
+                                break;
+                        case 8:
+                                /* Now follows a string containing a layer name. */
+                                dxf_read_string_interned (fp, &leader->layer);
+                                break;
+                        case 10:
+                        case 20:
+                        case 30:
+                                if (group_code == 10)
                                 {
-                                        dxf_point_init ((DxfPoint *) iter->next);
-                                        iter = (DxfPoint *) iter->next;
+                                        /* Now follows a string containing the X-value
+                                         * of the Vertex coordinates (one entry for each
+                                         * vertex). */
+                                        if (i > 0) /* Create a pointer for the next vertex. */
+                                        {
+                                                dxf_point_init ((DxfPoint *) iter->next);
+                                                iter = (DxfPoint *) iter->next;
+                                        }
+                                        dxf_read_double (fp, &iter->x0);
                                 }
-                                (fp->line_number)++;
-                                fscanf (fp->fp, "%lf\n", &iter->x0);
-                        }
-                        else if (strcmp (temp_string, "20") == 0)
-                        {
-                                /* Now follows a string containing the Y-value
-                                 * of the Vertex coordinates (one entry for each
-                                 * vertex). */
-                                (fp->line_number)++;
-                                fscanf (fp->fp, "%lf\n", &iter->y0);
-                        }
-                        else if (strcmp (temp_string, "30") == 0)
-                        {
-                                /* Now follows a string containing the Z-value
-                                 * of the Vertex coordinates (one entry for each
-                                 * vertex). */
-                                (fp->line_number)++;
-                                fscanf (fp->fp, "%lf\n", &iter->z0);
-                                i++; /* Increase the number of found vertices. */
-                        }
-                }
-                else if ((fp->acad_version_number <= AutoCAD_11)
-                  && DXF_FLATLAND
-                  && (strcmp (temp_string, "38") == 0))
-                {
-                        /* Now follows a string containing the
-                         * elevation. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &leader->elevation);
-                }
-                else if (strcmp (temp_string, "39") == 0)
-                {
-                        /* Now follows a string containing the
-                         * thickness. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &leader->thickness);
-                }
-                else if (strcmp (temp_string, "40") == 0)
-                {
-                        /* Now follows a string containing the text
-                         * annotation height. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &leader->text_annotation_height);
-                }
-                else if (strcmp (temp_string, "41") == 0)
-                {
-                        /* Now follows a string containing the text
-                         * annotation width. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &leader->text_annotation_width);
-                }
-                else if (strcmp (temp_string, "48") == 0)
-                {
-                        /* Now follows a string containing the linetype
-                         * scale. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &leader->linetype_scale);
-                }
-                else if (strcmp (temp_string, "60") == 0)
-                {
-                        /* Now follows a string containing the
-                         * visibility value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%hd\n", &leader->visibility);
-                }
-                else if (strcmp (temp_string, "62") == 0)
-                {
-                        /* Now follows a string containing the
-                         * color value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%hd\n", &leader->color);
-                }
-                else if (strcmp (temp_string, "67") == 0)
-                {
-                        /* Now follows a string containing the
-                         * paperspace value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%hd\n", &leader->paperspace);
-                }
-                else if (strcmp (temp_string, "71") == 0)
-                {
-                        /* Now follows a string containing the arrow
-                         * head flag. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%d\n", &leader->arrow_head_flag);
-                }
-                else if (strcmp (temp_string, "72") == 0)
-                {
-                        /* Now follows a string containing the path type. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%d\n", &leader->path_type);
-                }
-                else if (strcmp (temp_string, "73") == 0)
-                {
-                        /* Now follows a string containing the creation
-                         * flag. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%d\n", &leader->creation_flag);
-                }
-                else if (strcmp (temp_string, "74") == 0)
-                {
-                        /* Now follows a string containing the hookline
-                         * direction flag. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%d\n", &leader->hookline_direction_flag);
-                }
-                else if (strcmp (temp_string, "75") == 0)
-                {
-                        /* Now follows a string containing the hookline
-                         * flag. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%d\n", &leader->hookline_flag);
-                }
-                else if (strcmp (temp_string, "76") == 0)
-                {
-                        /* Now follows a string containing the number of
-                         * vertices. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%d\n", &leader->number_vertices);
-                }
-                else if (strcmp (temp_string, "77") == 0)
-                {
-                        /* Now follows a string containing the leader
-                         * color. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%d\n", &leader->leader_color);
-                }
-                else if ((fp->acad_version_number >= AutoCAD_13)
-                        && (strcmp (temp_string, "100") == 0))
-                {
-                        /* Now follows a string containing the
-                         * subclass marker value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
-                        if (strcmp (temp_string, "AcDbLeader") != 0)
-                        {
+                                else if (group_code == 20)
+                                {
+                                        /* Now follows a string containing the Y-value
+                                         * of the Vertex coordinates (one entry for each
+                                         * vertex). */
+                                        dxf_read_double (fp, &iter->y0);
+                                }
+                                else if (group_code == 30)
+                                {
+                                        /* Now follows a string containing the Z-value
+                                         * of the Vertex coordinates (one entry for each
+                                         * vertex). */
+                                        dxf_read_double (fp, &iter->z0);
+                                        i++; /* Increase the number of found vertices. */
+                                }
+                                break;
+                        case 38:
+                                if ((fp->acad_version_number <= AutoCAD_11) && DXF_FLATLAND)
+                                {
+                                        /* Now follows a string containing the
+                                         * elevation. */
+                                        dxf_read_double (fp, &leader->elevation);
+                                }
+                                else
+                                {
+                                        fprintf (stderr,
+                                          (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
+                                          __FUNCTION__, fp->filename, fp->line_number);
+                                        /* Skip the value of the unknown group code. */
+                                        dxf_read_line (temp_string, fp);
+                                }
+                                break;
+                        case 39:
+                                /* Now follows a string containing the
+                                 * thickness. */
+                                dxf_read_double (fp, &leader->thickness);
+                                break;
+                        case 40:
+                                /* Now follows a string containing the text
+                                 * annotation height. */
+                                dxf_read_double (fp, &leader->text_annotation_height);
+                                break;
+                        case 41:
+                                /* Now follows a string containing the text
+                                 * annotation width. */
+                                dxf_read_double (fp, &leader->text_annotation_width);
+                                break;
+                        case 48:
+                                /* Now follows a string containing the linetype
+                                 * scale. */
+                                dxf_read_double (fp, &leader->linetype_scale);
+                                break;
+                        case 60:
+                                /* Now follows a string containing the
+                                 * visibility value. */
+                                dxf_read_int16 (fp, &leader->visibility);
+                                break;
+                        case 62:
+                                /* Now follows a string containing the
+                                 * color value. */
+                                dxf_read_int16 (fp, &leader->color);
+                                break;
+                        case 67:
+                                /* Now follows a string containing the
+                                 * paperspace value. */
+                                dxf_read_int16 (fp, &leader->paperspace);
+                                break;
+                        case 71:
+                                /* Now follows a string containing the arrow
+                                 * head flag. */
+                                dxf_read_int (fp, &leader->arrow_head_flag);
+                                break;
+                        case 72:
+                                /* Now follows a string containing the path type. */
+                                dxf_read_int (fp, &leader->path_type);
+                                break;
+                        case 73:
+                                /* Now follows a string containing the creation
+                                 * flag. */
+                                dxf_read_int (fp, &leader->creation_flag);
+                                break;
+                        case 74:
+                                /* Now follows a string containing the hookline
+                                 * direction flag. */
+                                dxf_read_int (fp, &leader->hookline_direction_flag);
+                                break;
+                        case 75:
+                                /* Now follows a string containing the hookline
+                                 * flag. */
+                                dxf_read_int (fp, &leader->hookline_flag);
+                                break;
+                        case 76:
+                                /* Now follows a string containing the number of
+                                 * vertices. */
+                                dxf_read_int (fp, &leader->number_vertices);
+                                break;
+                        case 77:
+                                /* Now follows a string containing the leader
+                                 * color. */
+                                dxf_read_int (fp, &leader->leader_color);
+                                break;
+                        case 100:
+                                if (fp->acad_version_number >= AutoCAD_13)
+                                {
+                                        /* Now follows a string containing the
+                                         * subclass marker value. */
+                                        dxf_read_line (temp_string, fp);
+                                        if (strcmp (temp_string, "AcDbLeader") != 0)
+                                        {
+                                                fprintf (stderr,
+                                                  (_("Warning in %s () found a bad subclass marker in: %s in line: %d.\n")),
+                                                  __FUNCTION__, fp->filename, fp->line_number);
+                                        }
+                                }
+                                else
+                                {
+                                        fprintf (stderr,
+                                          (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
+                                          __FUNCTION__, fp->filename, fp->line_number);
+                                        /* Skip the value of the unknown group code. */
+                                        dxf_read_line (temp_string, fp);
+                                }
+                                break;
+                        case 210:
+                                /* Now follows a string containing the
+                                 * X-value of the extrusion vector. */
+                                dxf_read_double (fp, &leader->extr_x0);
+                                break;
+                        case 220:
+                                /* Now follows a string containing the
+                                 * Y-value of the extrusion vector. */
+                                dxf_read_double (fp, &leader->extr_y0);
+                                break;
+                        case 230:
+                                /* Now follows a string containing the
+                                 * Z-value of the extrusion vector. */
+                                dxf_read_double (fp, &leader->extr_z0);
+                                break;
+                        case 211:
+                                /* Now follows a string containing the
+                                 * X-value of the "Horizontal" direction for
+                                 * leader. */
+                                dxf_read_double (fp, &leader->p1->x0);
+                                break;
+                        case 221:
+                                /* Now follows a string containing the
+                                 * Y-value of the "Horizontal" direction for
+                                 * leader. */
+                                dxf_read_double (fp, &leader->p1->y0);
+                                break;
+                        case 231:
+                                /* Now follows a string containing the
+                                 * Z-value of the "Horizontal" direction for
+                                 * leader. */
+                                dxf_read_double (fp, &leader->p1->z0);
+                                break;
+                        case 212:
+                                /* Now follows a string containing the
+                                 * X-value of the Block reference insertion
+                                 * point offset from last leader vertex. */
+                                dxf_read_double (fp, &leader->p2->x0);
+                                break;
+                        case 222:
+                                /* Now follows a string containing the
+                                 * Y-value of the Block reference insertion
+                                 * point offset from last leader vertex. */
+                                dxf_read_double (fp, &leader->p2->y0);
+                                break;
+                        case 232:
+                                /* Now follows a string containing the
+                                 * Z-value of the Block reference insertion
+                                 * point offset from last leader vertex. */
+                                dxf_read_double (fp, &leader->p2->z0);
+                                break;
+                        case 213:
+                                /* Now follows a string containing the
+                                 * X-value of the Annotation placement point
+                                 * offset from last leader vertex. */
+                                dxf_read_double (fp, &leader->p3->x0);
+                                break;
+                        case 223:
+                                /* Now follows a string containing the
+                                 * Y-value of the Annotation placement point
+                                 * offset from last leader vertex. */
+                                dxf_read_double (fp, &leader->p3->y0);
+                                break;
+                        case 233:
+                                /* Now follows a string containing the
+                                 * Z-value of the Annotation placement point
+                                 * offset from last leader vertex. */
+                                dxf_read_double (fp, &leader->p3->z0);
+                                break;
+                        case 330:
+                                /* Now follows a string containing Soft-pointer
+                                 * ID/handle to owner dictionary. */
+                                dxf_read_handle (fp, &leader->dictionary_owner_soft);
+                                break;
+                        case 340:
+                                /* Now follows a string containing Hard
+                                 * reference to associated annotation (mtext,
+                                 * tolerance, or insert entity). */
+                                dxf_read_string (fp, &leader->annotation_reference_hard);
+                                break;
+                        case 360:
+                                /* Now follows a string containing Hard owner
+                                 * ID/handle to owner dictionary. */
+                                dxf_read_handle (fp, &leader->dictionary_owner_hard);
+                                break;
+                        case 999:
+                                /* Now follows a string containing a comment. */
+                                dxf_read_line (temp_string, fp);
+                                fprintf (stdout, (_("DXF comment: %s\n")), temp_string);
+                                break;
+                        default:
                                 fprintf (stderr,
-                                  (_("Warning in %s () found a bad subclass marker in: %s in line: %d.\n")),
+                                  (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
                                   __FUNCTION__, fp->filename, fp->line_number);
-                        }
-                }
-                else if (strcmp (temp_string, "210") == 0)
-                {
-                        /* Now follows a string containing the
-                         * X-value of the extrusion vector. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &leader->extr_x0);
-                }
-                else if (strcmp (temp_string, "220") == 0)
-                {
-                        /* Now follows a string containing the
-                         * Y-value of the extrusion vector. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &leader->extr_y0);
-                }
-                else if (strcmp (temp_string, "230") == 0)
-                {
-                        /* Now follows a string containing the
-                         * Z-value of the extrusion vector. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &leader->extr_z0);
-                }
-                else if (strcmp (temp_string, "211") == 0)
-                {
-                        /* Now follows a string containing the
-                         * X-value of the "Horizontal" direction for
-                         * leader. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &leader->p1->x0);
-                }
-                else if (strcmp (temp_string, "221") == 0)
-                {
-                        /* Now follows a string containing the
-                         * Y-value of the "Horizontal" direction for
-                         * leader. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &leader->p1->y0);
-                }
-                else if (strcmp (temp_string, "231") == 0)
-                {
-                        /* Now follows a string containing the
-                         * Z-value of the "Horizontal" direction for
-                         * leader. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &leader->p1->z0);
-                }
-                else if (strcmp (temp_string, "212") == 0)
-                {
-                        /* Now follows a string containing the
-                         * X-value of the Block reference insertion
-                         * point offset from last leader vertex. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &leader->p2->x0);
-                }
-                else if (strcmp (temp_string, "222") == 0)
-                {
-                        /* Now follows a string containing the
-                         * Y-value of the Block reference insertion
-                         * point offset from last leader vertex. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &leader->p2->y0);
-                }
-                else if (strcmp (temp_string, "232") == 0)
-                {
-                        /* Now follows a string containing the
-                         * Z-value of the Block reference insertion
-                         * point offset from last leader vertex. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &leader->p2->z0);
-                }
-                else if (strcmp (temp_string, "213") == 0)
-                {
-                        /* Now follows a string containing the
-                         * X-value of the Annotation placement point
-                         * offset from last leader vertex. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &leader->p3->x0);
-                }
-                else if (strcmp (temp_string, "223") == 0)
-                {
-                        /* Now follows a string containing the
-                         * Y-value of the Annotation placement point
-                         * offset from last leader vertex. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &leader->p3->y0);
-                }
-                else if (strcmp (temp_string, "233") == 0)
-                {
-                        /* Now follows a string containing the
-                         * Z-value of the Annotation placement point
-                         * offset from last leader vertex. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &leader->p3->z0);
-                }
-                else if (strcmp (temp_string, "330") == 0)
-                {
-                        /* Now follows a string containing Soft-pointer
-                         * ID/handle to owner dictionary. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, leader->dictionary_owner_soft);
-                }
-                else if (strcmp (temp_string, "340") == 0)
-                {
-                        /* Now follows a string containing Hard
-                         * reference to associated annotation (mtext,
-                         * tolerance, or insert entity). */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, leader->annotation_reference_hard);
-                }
-                else if (strcmp (temp_string, "360") == 0)
-                {
-                        /* Now follows a string containing Hard owner
-                         * ID/handle to owner dictionary. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, leader->dictionary_owner_hard);
-                }
-                else if (strcmp (temp_string, "999") == 0)
-                {
-                        /* Now follows a string containing a comment. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
-                        fprintf (stdout, (_("DXF comment: %s\n")), temp_string);
-                }
-                else
-                {
-                        fprintf (stderr,
-                          (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
-                          __FUNCTION__, fp->filename, fp->line_number);
+                                /* Skip the value of the unknown group code. */
+                                dxf_read_line (temp_string, fp);
+                                break;
                 }
         }
         if (i != leader->number_vertices)
@@ -648,14 +580,12 @@ dxf_leader_read
         /* Handle omitted members and/or illegal values. */
         if (strcmp (leader->linetype, "") == 0)
         {
-                leader->linetype = strdup (DXF_DEFAULT_LINETYPE);
+                leader->linetype = dxf_strdup (DXF_DEFAULT_LINETYPE);
         }
         if (strcmp (leader->layer, "") == 0)
         {
-                leader->layer = strdup (DXF_DEFAULT_LAYER);
+                leader->layer = dxf_strdup (DXF_DEFAULT_LAYER);
         }
-        /* Clean up. */
-        free (temp_string);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -681,7 +611,7 @@ dxf_leader_write
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        char *dxf_entity_name = strdup ("LEADER");
+        char *dxf_entity_name = dxf_strdup ("LEADER");
         int i;
         DxfPoint *iter;
 
@@ -692,7 +622,7 @@ dxf_leader_write
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (leader == NULL)
@@ -701,7 +631,7 @@ dxf_leader_write
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (leader->p0 == NULL)
@@ -710,40 +640,40 @@ dxf_leader_write
                   (_("Error in %s () a NULL pointer was found.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (fp->acad_version_number < AutoCAD_13)
         {
                 fprintf (stderr,
-                  (_("Warning in %s () illegal DXF version for this %s entity with id-code: %x.\n")),
+                  (_("Warning in %s () illegal DXF version for this %s entity with id-code: %" PRIx64 ".\n")),
                   __FUNCTION__, dxf_entity_name, leader->id_code);
         }
         if (strcmp (leader->linetype, "") == 0)
         {
                 fprintf (stderr,
-                  (_("Warning in %s () empty linetype string for the %s entity with id-code: %x\n")),
+                  (_("Warning in %s () empty linetype string for the %s entity with id-code: %" PRIx64 "\n")),
                   __FUNCTION__, dxf_entity_name, leader->id_code);
                 fprintf (stderr,
                   (_("\t%s entity is reset to default linetype")),
                   dxf_entity_name);
-                leader->linetype = strdup (DXF_DEFAULT_LINETYPE);
+                leader->linetype = dxf_strdup (DXF_DEFAULT_LINETYPE);
         }
         if (strcmp (leader->layer, "") == 0)
         {
                 fprintf (stderr,
-                  (_("Warning in %s () empty layer string for the %s entity with id-code: %x\n")),
+                  (_("Warning in %s () empty layer string for the %s entity with id-code: %" PRIx64 "\n")),
                   __FUNCTION__, dxf_entity_name, leader->id_code);
                 fprintf (stderr,
                   (_("\t%s entity is relocated to layer 0")),
                   dxf_entity_name);
-                leader->layer = strdup (DXF_DEFAULT_LAYER);
+                leader->layer = dxf_strdup (DXF_DEFAULT_LAYER);
         }
         /* Start writing output. */
-        fprintf (fp->fp, "  0\n%s\n", dxf_entity_name);
-        if (leader->id_code != -1)
+        dxf_write_string (fp, 0, dxf_entity_name);
+        if (leader->id_code != DXF_HANDLE_NONE)
         {
-                fprintf (fp->fp, "  5\n%x\n", leader->id_code);
+                dxf_write_hex (fp, 5, leader->id_code);
         }
         /*!
          * \todo for version R14.\n
@@ -755,75 +685,75 @@ dxf_leader_write
          * 102 groups are application defined (optional).\n\n
          * End of group, "}" (optional), with Group code 102.
          */
-        if ((strcmp (leader->dictionary_owner_soft, "") != 0)
+        if ((leader->dictionary_owner_soft != 0)
           && (fp->acad_version_number >= AutoCAD_14))
         {
-                fprintf (fp->fp, "102\n{ACAD_REACTORS\n");
-                fprintf (fp->fp, "330\n%s\n", leader->dictionary_owner_soft);
-                fprintf (fp->fp, "102\n}\n");
+                dxf_write_string (fp, 102, "{ACAD_REACTORS");
+                dxf_write_hex (fp, 330, leader->dictionary_owner_soft);
+                dxf_write_string (fp, 102, "}");
         }
-        if ((strcmp (leader->dictionary_owner_hard, "") != 0)
+        if ((leader->dictionary_owner_hard != 0)
           && (fp->acad_version_number >= AutoCAD_14))
         {
-                fprintf (fp->fp, "102\n{ACAD_XDICTIONARY\n");
-                fprintf (fp->fp, "360\n%s\n", leader->dictionary_owner_hard);
-                fprintf (fp->fp, "102\n}\n");
+                dxf_write_string (fp, 102, "{ACAD_XDICTIONARY");
+                dxf_write_hex (fp, 360, leader->dictionary_owner_hard);
+                dxf_write_string (fp, 102, "}");
         }
         if (fp->acad_version_number >= AutoCAD_13)
         {
-                fprintf (fp->fp, "100\nAcDbEntity\n");
+                dxf_write_string (fp, 100, "AcDbEntity");
         }
         if (leader->paperspace == DXF_PAPERSPACE)
         {
-                fprintf (fp->fp, " 67\n%hd\n", (int16_t) DXF_PAPERSPACE);
+                dxf_write_int (fp, 67, (int16_t) DXF_PAPERSPACE);
         }
-        fprintf (fp->fp, "  8\n%s\n", leader->layer);
+        dxf_write_string (fp, 8, leader->layer);
         if (strcmp (leader->linetype, DXF_DEFAULT_LINETYPE) != 0)
         {
-                fprintf (fp->fp, "  6\n%s\n", leader->linetype);
+                dxf_write_string (fp, 6, leader->linetype);
         }
         if (leader->color != DXF_COLOR_BYLAYER)
         {
-                fprintf (fp->fp, " 62\n%hd\n", leader->color);
+                dxf_write_int (fp, 62, leader->color);
         }
         if ((fp->acad_version_number <= AutoCAD_11)
           && DXF_FLATLAND
           && (leader->elevation != 0.0))
         {
-                fprintf (fp->fp, " 38\n%f\n", leader->elevation);
+                dxf_write_double (fp, 38, leader->elevation);
         }
         if (leader->thickness != 0.0)
         {
-                fprintf (fp->fp, " 39\n%f\n", leader->thickness);
+                dxf_write_double (fp, 39, leader->thickness);
         }
         if (leader->linetype_scale != 1.0)
         {
-                fprintf (fp->fp, " 48\n%f\n", leader->linetype_scale);
+                dxf_write_double (fp, 48, leader->linetype_scale);
         }
         if (leader->visibility != 0)
         {
-                fprintf (fp->fp, " 60\n%d\n", leader->visibility);
+                dxf_write_int (fp, 60, leader->visibility);
         }
         if (fp->acad_version_number >= AutoCAD_13)
         {
-                fprintf (fp->fp, "100\nAcDbLeader\n");
-        }
-        fprintf (fp->fp, "  3\n%s\n", leader->dimension_style_name);
-        fprintf (fp->fp, " 71\n%d\n", leader->arrow_head_flag);
-        fprintf (fp->fp, " 72\n%d\n", leader->path_type);
-        fprintf (fp->fp, " 73\n%d\n", leader->creation_flag);
-        fprintf (fp->fp, " 74\n%d\n", leader->hookline_direction_flag);
-        fprintf (fp->fp, " 75\n%d\n", leader->hookline_flag);
-        fprintf (fp->fp, " 40\n%f\n", leader->text_annotation_height);
-        fprintf (fp->fp, " 41\n%f\n", leader->text_annotation_width);
-        fprintf (fp->fp, " 76\n%d\n", leader->number_vertices);
+                dxf_write_string (fp, 100, "AcDbLeader");
+        }
+        dxf_write_string (fp, 3, leader->dimension_style_name);
+        dxf_write_int (fp, 71, leader->arrow_head_flag);
+        dxf_write_int (fp, 72, leader->path_type);
+        dxf_write_int (fp, 73, leader->creation_flag);
+        dxf_write_int (fp, 74, leader->hookline_direction_flag);
+        dxf_write_int (fp, 75, leader->hookline_flag);
+        dxf_write_double (fp, 40, leader->text_annotation_height);
+        dxf_write_double (fp, 41, leader->text_annotation_width);
+        dxf_write_int (fp, 76, leader->number_vertices);
         iter = (DxfPoint *) leader->p0;
         i = 1;
         while (iter->next != NULL)
         {
-                fprintf (fp->fp, " 10\n%f\n", iter->x0);
-                fprintf (fp->fp, " 20\n%f\n", iter->y0);
-                fprintf (fp->fp, " 30\n%f\n", iter->z0);
+                dxf_write_double (fp, 10, iter->x0);
+                dxf_write_double (fp, 20, iter->y0);
+                dxf_write_double (fp, 30, iter->z0);
                 iter = (DxfPoint *) iter->next;
                 i++;
         }
@@ -833,25 +763,25 @@ dxf_leader_write
                   (_("Warning in %s () actual number of vertices differs from number_vertices value in struct.\n")),
                   __FUNCTION__);
         }
-        fprintf (fp->fp, " 77\n%d\n", leader->leader_color);
-        fprintf (fp->fp, "340\n%s\n", leader->annotation_reference_hard);
-        fprintf (fp->fp, "210\n%f\n", leader->extr_x0);
-        fprintf (fp->fp, "220\n%f\n", leader->extr_y0);
-        fprintf (fp->fp, "230\n%f\n", leader->extr_z0);
-        fprintf (fp->fp, "211\n%f\n", leader->p1->x0);
-        fprintf (fp->fp, "221\n%f\n", leader->p1->y0);
-        fprintf (fp->fp, "231\n%f\n", leader->p1->z0);
-        fprintf (fp->fp, "212\n%f\n", leader->p2->x0);
-        fprintf (fp->fp, "222\n%f\n", leader->p2->y0);
-        fprintf (fp->fp, "232\n%f\n", leader->p2->z0);
-        fprintf (fp->fp, "213\n%f\n", leader->p3->x0);
-        fprintf (fp->fp, "223\n%f\n", leader->p3->y0);
-        fprintf (fp->fp, "233\n%f\n", leader->p3->z0);
+        dxf_write_int (fp, 77, leader->leader_color);
+        dxf_write_string (fp, 340, leader->annotation_reference_hard);
+        dxf_write_double (fp, 210, leader->extr_x0);
+        dxf_write_double (fp, 220, leader->extr_y0);
+        dxf_write_double (fp, 230, leader->extr_z0);
+        dxf_write_double (fp, 211, leader->p1->x0);
+        dxf_write_double (fp, 221, leader->p1->y0);
+        dxf_write_double (fp, 231, leader->p1->z0);
+        dxf_write_double (fp, 212, leader->p2->x0);
+        dxf_write_double (fp, 222, leader->p2->y0);
+        dxf_write_double (fp, 232, leader->p2->z0);
+        dxf_write_double (fp, 213, leader->p3->x0);
+        dxf_write_double (fp, 223, leader->p3->y0);
+        dxf_write_double (fp, 233, leader->p3->z0);
         /*! \todo Xdata belonging to the application ID "ACAD" may
          * follow.\n This describes any dimension overrides that have
          * been applied to this entity. */
         /* Clean up. */
-        free (dxf_entity_name);
+        dxf_free (dxf_entity_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -892,13 +822,11 @@ dxf_leader_free
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        free (leader->linetype);
-        free (leader->layer);
-        free (leader->dictionary_owner_soft);
-        free (leader->dictionary_owner_hard);
-        free (leader->dimension_style_name);
-        free (leader->annotation_reference_hard);
-        free (leader);
+        dxf_string_free (leader->linetype);
+        dxf_string_free (leader->layer);
+        dxf_free (leader->dimension_style_name);
+        dxf_free (leader->annotation_reference_hard);
+        dxf_free (leader);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -944,7 +872,7 @@ dxf_leader_free_list
  *
  * \return ID code.
  */
-int
+uint64_t
 dxf_leader_get_id_code
 (
         DxfLeader *leader
@@ -962,13 +890,6 @@ dxf_leader_get_id_code
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (leader->id_code < 0)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a negative value was found.\n")),
-                  __FUNCTION__);
-                return (EXIT_FAILURE);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -984,7 +905,7 @@ dxf_leader_set_id_code
 (
         DxfLeader *leader,
                 /*!< a pointer to a DXF \c LEADER entity. */
-        int id_code
+        uint64_t id_code
                 /*!< Identification number for the entity.\n
                  * This is to be an unique (sequential) number in the DXF
                  * file. */
@@ -1001,13 +922,6 @@ dxf_leader_set_id_code
                   __FUNCTION__);
                 return (NULL);
         }
-        if (id_code < 0)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a negative value was passed.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
         leader->id_code = id_code;
 #if DEBUG
         DXF_DEBUG_END
@@ -1049,7 +963,7 @@ dxf_leader_get_linetype
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (leader->linetype));
+        return (dxf_strdup (leader->linetype));
 }
 
 
@@ -1083,7 +997,7 @@ dxf_leader_set_linetype
                   __FUNCTION__);
                 return (NULL);
         }
-        leader->linetype = strdup (linetype);
+        leader->linetype = dxf_strdup (linetype);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1124,7 +1038,7 @@ dxf_leader_get_layer
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (leader->layer));
+        return (dxf_strdup (leader->layer));
 }
 
 
@@ -1158,7 +1072,7 @@ dxf_leader_set_layer
                   __FUNCTION__);
                 return (NULL);
         }
-        leader->layer = strdup (layer);
+        leader->layer = dxf_strdup (layer);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1631,10 +1545,8 @@ dxf_leader_set_paperspace
  * \c LEADER entity.
  *
  * \return soft pointer to the dictionary owner.
- *
- * \warning No checks are performed on the returned pointer (string).
  */
-char *
+uint64_t
 dxf_leader_get_dictionary_owner_soft
 (
         DxfLeader *leader
@@ -1650,19 +1562,12 @@ dxf_leader_get_dictionary_owner_soft
                 fprintf (stderr,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
-                return (NULL);
-        }
-        if (leader->dictionary_owner_soft ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
+                return (0);
         }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (leader->dictionary_owner_soft));
+        return (leader->dictionary_owner_soft);
 }
 
 
@@ -1675,8 +1580,8 @@ dxf_leader_set_dictionary_owner_soft
 (
         DxfLeader *leader,
                 /*!< a pointer to a DXF \c LEADER entity. */
-        char *dictionary_owner_soft
-                /*!< a string containing the pointer to the
+        uint64_t dictionary_owner_soft
+                /*!< the handle of the
                  * dictionary_owner_soft for the entity. */
 )
 {
@@ -1691,14 +1596,7 @@ dxf_leader_set_dictionary_owner_soft
                   __FUNCTION__);
                 return (NULL);
         }
-        if (dictionary_owner_soft == NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was passed.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
-        leader->dictionary_owner_soft = strdup (dictionary_owner_soft);
+        leader->dictionary_owner_soft = dictionary_owner_soft;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1711,10 +1609,8 @@ dxf_leader_set_dictionary_owner_soft
  * \c LEADER entity.
  *
  * \return hard pointer to the dictionary owner.
- *
- * \warning No checks are performed on the returned pointer (string).
  */
-char *
+uint64_t
 dxf_leader_get_dictionary_owner_hard
 (
         DxfLeader *leader
@@ -1730,19 +1626,12 @@ dxf_leader_get_dictionary_owner_hard
                 fprintf (stderr,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
-                return (NULL);
-        }
-        if (leader->dictionary_owner_hard ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
+                return (0);
         }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (leader->dictionary_owner_hard));
+        return (leader->dictionary_owner_hard);
 }
 
 
@@ -1755,8 +1644,8 @@ dxf_leader_set_dictionary_owner_hard
 (
         DxfLeader *leader,
                 /*!< a pointer to a DXF \c LEADER entity. */
-        char *dictionary_owner_hard
-                /*!< a string containing the pointer to the
+        uint64_t dictionary_owner_hard
+                /*!< the handle of the
                  * dictionary_owner_hard for the entity. */
 )
 {
@@ -1771,14 +1660,7 @@ dxf_leader_set_dictionary_owner_hard
                   __FUNCTION__);
                 return (NULL);
         }
-        if (dictionary_owner_hard == NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was passed.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
-        leader->dictionary_owner_hard = strdup (dictionary_owner_hard);
+        leader->dictionary_owner_hard = dictionary_owner_hard;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1820,7 +1702,7 @@ dxf_leader_get_dimension_style_name
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (leader->dimension_style_name));
+        return (dxf_strdup (leader->dimension_style_name));
 }
 
 
@@ -1855,7 +1737,7 @@ dxf_leader_set_dimension_style_name
                   __FUNCTION__);
                 return (NULL);
         }
-        leader->layer = strdup (dimension_style_name);
+        leader->layer = dxf_strdup (dimension_style_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -4270,7 +4152,7 @@ dxf_leader_get_annotation_reference_hard
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (leader->annotation_reference_hard));
+        return (dxf_strdup (leader->annotation_reference_hard));
 }
 
 
@@ -4306,7 +4188,7 @@ dxf_leader_set_annotation_reference_hard
                   __FUNCTION__);
                 return (NULL);
         }
-        leader->annotation_reference_hard = strdup (annotation_reference_hard);
+        leader->annotation_reference_hard = dxf_strdup (annotation_reference_hard);
 #if DEBUG
         DXF_DEBUG_END
 #endif
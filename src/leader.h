@@ -61,7 +61,7 @@ typedef struct
 dxf_leader_struct
 {
         /* Members common for all DXF drawable entities. */
-        int id_code;
+        uint64_t id_code;
                 /*!< Identification number for the entity.\n
                  * This is to be an unique (sequential) number in the DXF
                  * file.\n
@@ -130,20 +130,20 @@ dxf_leader_struct
                  * (optional).\n
                  * Group code = 310.\n
                  * \since Introduced in version R2000. */
-        char *dictionary_owner_soft;
+        uint64_t dictionary_owner_soft;
                 /*!< Soft-pointer ID/handle to owner dictionary (optional).\n
                  * Group code = 330.\n
                  * \since Introduced in version R14. */
-        char *object_owner_soft;
+        uint64_t object_owner_soft;
                 /*!< Soft-pointer ID/handle  to owner BLOCK_RECORD object.\n
                  * Group code = 330.\n
                  * \since Introduced in version R2000. */
-        char *material;
+        uint64_t material;
                 /*!< Hard-pointer ID/handle to material object (present if
                  * not BYLAYER).\n
                  * Group code = 347.\n
                  * \since Introduced in version R2008. */
-        char *dictionary_owner_hard;
+        uint64_t dictionary_owner_hard;
                 /*!< Hard owner ID/handle to owner dictionary (optional).\n
                  * Group code = 360.\n
                  * \since Introduced in version R14. */
@@ -152,7 +152,7 @@ dxf_leader_struct
                  * Stored and moved around as a 16-bit integer.\n
                  * Group code = 370.\n
                  * \since Introduced in version R2002. */
-        char *plot_style_name;
+        uint64_t plot_style_name;
                 /*!< Hard pointer ID / handle of PlotStyleName object.\n
                  * Group code = 390.\n
                  * \since Introduced in version R2009. */
@@ -289,8 +289,8 @@ DxfLeader *dxf_leader_read (DxfFile *fp, DxfLeader *leader);
 int dxf_leader_write (DxfFile *fp, DxfLeader *leader);
 int dxf_leader_free (DxfLeader *leader);
 void dxf_leader_free_list (DxfLeader *leaders);
-int dxf_leader_get_id_code (DxfLeader *leader);
-DxfLeader *dxf_leader_set_id_code (DxfLeader *leader, int id_code);
+uint64_t dxf_leader_get_id_code (DxfLeader *leader);
+DxfLeader *dxf_leader_set_id_code (DxfLeader *leader, uint64_t id_code);
 char *dxf_leader_get_linetype (DxfLeader *leader);
 DxfLeader *dxf_leader_set_linetype (DxfLeader *leader, char *linetype);
 char *dxf_leader_get_layer (DxfLeader *leader);
@@ -307,10 +307,10 @@ int dxf_leader_get_color (DxfLeader *leader);
 DxfLeader *dxf_leader_set_color (DxfLeader *leader, int color);
 int dxf_leader_get_paperspace (DxfLeader *leader);
 DxfLeader *dxf_leader_set_paperspace (DxfLeader *leader, int paperspace);
-char *dxf_leader_get_dictionary_owner_soft (DxfLeader *leader);
-DxfLeader *dxf_leader_set_dictionary_owner_soft (DxfLeader *leader, char *dictionary_owner_soft);
-char *dxf_leader_get_dictionary_owner_hard (DxfLeader *leader);
-DxfLeader *dxf_leader_set_dictionary_owner_hard (DxfLeader *leader, char *dictionary_owner_hard);
+uint64_t dxf_leader_get_dictionary_owner_soft (DxfLeader *leader);
+DxfLeader *dxf_leader_set_dictionary_owner_soft (DxfLeader *leader, uint64_t dictionary_owner_soft);
+uint64_t dxf_leader_get_dictionary_owner_hard (DxfLeader *leader);
+DxfLeader *dxf_leader_set_dictionary_owner_hard (DxfLeader *leader, uint64_t dictionary_owner_hard);
 char *dxf_leader_get_dimension_style_name (DxfLeader *leader);
 DxfLeader *dxf_leader_set_dimension_style_name (DxfLeader *leader, char *dimension_style_name);
 DxfPoint *dxf_leader_get_p0 (DxfLeader *leader);
@@ -36,6 +36,7 @@
 
 
 #include "light.h"
+#include "util.h"
 
 
 /*!
@@ -58,7 +59,7 @@ dxf_light_new ()
         size = sizeof (DxfLight);
         /* avoid malloc of 0 bytes */
         if (size == 0) size = 1;
-        if ((light = malloc (size)) == NULL)
+        if ((light = dxf_malloc (size)) == NULL)
         {
                 fprintf (stderr,
                   (_("Error in %s () could not allocate memory.\n")),
@@ -109,9 +110,9 @@ dxf_light_init
                 }
         }
         /* Assign initial values to members. */
-        light->id_code = 0;
-        light->linetype = strdup (DXF_DEFAULT_LINETYPE);
-        light->layer = strdup (DXF_DEFAULT_LAYER);
+        light->id_code = DXF_HANDLE_NONE;
+        light->linetype = dxf_strdup (DXF_DEFAULT_LINETYPE);
+        light->layer = dxf_strdup (DXF_DEFAULT_LAYER);
         light->thickness = 0.0;
         light->linetype_scale = 0.0;
         light->visibility = 0;
@@ -119,15 +120,15 @@ dxf_light_init
         light->paperspace = DXF_MODELSPACE;
         light->graphics_data_size = 0;
         light->shadow_mode = 0;
-        light->dictionary_owner_hard = strdup ("");
-        light->material = strdup ("");
-        light->dictionary_owner_soft = strdup ("");
+        light->dictionary_owner_hard = 0;
+        light->material = 0;
+        light->dictionary_owner_soft = 0;
         light->lineweight = 0;
-        light->plot_style_name = strdup ("");
+        light->plot_style_name = 0;
         light->color_value = 0;
-        light->color_name = strdup ("");
+        light->color_name = dxf_strdup ("");
         light->transparency = 0;
-        light->light_name = strdup ("");
+        light->light_name = dxf_strdup ("");
         light->intensity = 0.0;
         light->attenuation_start_limit = 0.0;
         light->attenuation_end_limit = 0.0;
@@ -180,7 +181,8 @@ dxf_light_read
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        char *temp_string = NULL;
+        char temp_string[DXF_MAX_STRING_LENGTH];
+        int group_code;
 
         /* Do some basic checks. */
         if (fp == NULL)
@@ -188,8 +190,6 @@ dxf_light_read
                 fprintf (stderr,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
-                /* Clean up. */
-                free (temp_string);
                 return (NULL);
         }
         if (light == NULL)
@@ -254,323 +254,239 @@ dxf_light_read
                         return (NULL);
                 }
         }
-        (fp->line_number)++;
-        fscanf (fp->fp, "%[^\n]", temp_string);
-        while (strcmp (temp_string, "0") != 0)
+        while ((dxf_read_group_code (fp, &group_code) == EXIT_SUCCESS)
+          && (group_code != 0))
         {
-                if (ferror (fp->fp))
+                if (dxf_read_error (fp))
                 {
                         fprintf (stderr,
                           (_("Error in %s () while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
-                        fclose (fp->fp);
-                        /* Clean up. */
-                        free (temp_string);
                         return (NULL);
                 }
-                if (strcmp (temp_string, "5") == 0)
-                {
-                        /* Now follows a string containing a sequential
-                         * id number. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%x\n", (uint *) &light->id_code);
-                }
-                else if (strcmp (temp_string, "6") == 0)
-                {
-                        /* Now follows a string containing a linetype
-                         * name. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, light->linetype);
-                }
-                else if (strcmp (temp_string, "8") == 0)
-                {
-                        /* Now follows a string containing a layer name. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, light->layer);
-                }
-                else if (strcmp (temp_string, "10") == 0)
-                {
-                        /* Now follows a string containing the
-                         * X-coordinate of the axis base point. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &light->p0->x0);
-                }
-                else if (strcmp (temp_string, "20") == 0)
-                {
-                        /* Now follows a string containing the
-                         * Y-coordinate of the axis base point. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &light->p0->y0);
-                }
-                else if (strcmp (temp_string, "30") == 0)
-                {
-                        /* Now follows a string containing the
-                         * Z-coordinate of the axis base point. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &light->p0->z0);
-                }
-                else if (strcmp (temp_string, "11") == 0)
-                {
-                        /* Now follows a string containing the
-                         * X-coordinate of the start point. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &light->p1->x0);
-                }
-                else if (strcmp (temp_string, "21") == 0)
-                {
-                        /* Now follows a string containing the
-                         * Y-coordinate of the start point. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &light->p1->y0);
-                }
-                else if (strcmp (temp_string, "31") == 0)
-                {
-                        /* Now follows a string containing the
-                         * Z-coordinate of the start point. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &light->p1->z0);
-                }
-                else if (strcmp (temp_string, "39") == 0)
-                {
-                        /* Now follows a string containing the
-                         * thickness. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &light->thickness);
-                }
-                else if (strcmp (temp_string, "40") == 0)
-                {
-                        /* Now follows a string containing the
-                         * intensity. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &light->intensity);
-                }
-                else if (strcmp (temp_string, "41") == 0)
-                {
-                        /* Now follows a string containing the
-                         * attenuation start limit. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &light->attenuation_start_limit);
-                }
-                else if (strcmp (temp_string, "42") == 0)
-                {
-                        /* Now follows a string containing the
-                         * attenuation end limit. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &light->attenuation_end_limit);
-                }
-                else if (strcmp (temp_string, "48") == 0)
-                {
-                        /* Now follows a string containing the linetype
-                         * scale. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &light->linetype_scale);
-                }
-                else if (strcmp (temp_string, "50") == 0)
-                {
-                        /* Now follows a string containing the hotspot
-                         * angle. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &light->hotspot_angle);
-                }
-                else if (strcmp (temp_string, "51") == 0)
-                {
-                        /* Now follows a string containing the falloff
-                         * angle. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &light->falloff_angle);
-                }
-                else if (strcmp (temp_string, "60") == 0)
+                switch (group_code)
                 {
-                        /* Now follows a string containing the
-                         * visibility value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%hd\n", &light->visibility);
-                }
-                else if (strcmp (temp_string, "62") == 0)
-                {
-                        /* Now follows a string containing the
-                         * color value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%d\n", &light->color);
-                }
-                else if (strcmp (temp_string, "67") == 0)
-                {
-                        /* Now follows a string containing the
-                         * paperspace value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%d\n", &light->paperspace);
-                }
-                else if (strcmp (temp_string, "70") == 0)
-                {
-                        /* Now follows a string containing a light type. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%hi\n", &light->light_type);
-                }
-                else if (strcmp (temp_string, "72") == 0)
-                {
-                        /* Now follows a string containing an
-                         * attenuation type. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%hi\n", &light->attenuation_type);
-                }
-                else if (strcmp (temp_string, "73") == 0)
-                {
-                        /* Now follows a string containing a shadow type. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%hi\n", &light->shadow_type);
-                }
-                else if (strcmp (temp_string, "90") == 0)
-                {
-                        /* Now follows a string containing a version
-                         * number. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%" PRIi32 "\n", &light->version_number);
-                }
-                else if (strcmp (temp_string, "91") == 0)
-                {
-                        /* Now follows a string containing a shadow map
-                         * size. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%" PRIi32 "\n", &light->shadow_map_size);
-                }
-                else if (strcmp (temp_string, "92") == 0)
-                {
-                        /* Now follows a string containing the
-                         * paperspace value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%d\n", &light->graphics_data_size);
-                }
-                else if (strcmp (temp_string, "100") == 0)
-                {
-                        /* Now follows a string containing the
-                         * subclass marker value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
-                        if ((strcmp (temp_string, "AcDbEntity") != 0)
-                                && ((strcmp (temp_string, "AcDbLight") != 0)))
-                        {
+                        case 5:
+                                /* Now follows a string containing a sequential
+                                 * id number. */
+                                dxf_read_handle (fp, &light->id_code);
+                                break;
+                        case 6:
+                                /* Now follows a string containing a linetype
+                                 * name. */
+                                dxf_read_string_interned (fp, &light->linetype);
+                                break;
+                        case 8:
+                                /* Now follows a string containing a layer name. */
+                                dxf_read_string_interned (fp, &light->layer);
+                                break;
+                        case 10:
+                                /* Now follows a string containing the
+                                 * X-coordinate of the axis base point. */
+                                dxf_read_double (fp, &light->p0->x0);
+                                break;
+                        case 20:
+                                /* Now follows a string containing the
+                                 * Y-coordinate of the axis base point. */
+                                dxf_read_double (fp, &light->p0->y0);
+                                break;
+                        case 30:
+                                /* Now follows a string containing the
+                                 * Z-coordinate of the axis base point. */
+                                dxf_read_double (fp, &light->p0->z0);
+                                break;
+                        case 11:
+                                /* Now follows a string containing the
+                                 * X-coordinate of the start point. */
+                                dxf_read_double (fp, &light->p1->x0);
+                                break;
+                        case 21:
+                                /* Now follows a string containing the
+                                 * Y-coordinate of the start point. */
+                                dxf_read_double (fp, &light->p1->y0);
+                                break;
+                        case 31:
+                                /* Now follows a string containing the
+                                 * Z-coordinate of the start point. */
+                                dxf_read_double (fp, &light->p1->z0);
+                                break;
+                        case 39:
+                                /* Now follows a string containing the
+                                 * thickness. */
+                                dxf_read_double (fp, &light->thickness);
+                                break;
+                        case 40:
+                                /* Now follows a string containing the
+                                 * intensity. */
+                                dxf_read_double (fp, &light->intensity);
+                                break;
+                        case 41:
+                                /* Now follows a string containing the
+                                 * attenuation start limit. */
+                                dxf_read_double (fp, &light->attenuation_start_limit);
+                                break;
+                        case 42:
+                                /* Now follows a string containing the
+                                 * attenuation end limit. */
+                                dxf_read_double (fp, &light->attenuation_end_limit);
+                                break;
+                        case 48:
+                                /* Now follows a string containing the linetype
+                                 * scale. */
+                                dxf_read_double (fp, &light->linetype_scale);
+                                break;
+                        case 50:
+                                /* Now follows a string containing the hotspot
+                                 * angle. */
+                                dxf_read_double (fp, &light->hotspot_angle);
+                                break;
+                        case 51:
+                                /* Now follows a string containing the falloff
+                                 * angle. */
+                                dxf_read_double (fp, &light->falloff_angle);
+                                break;
+                        case 60:
+                                /* Now follows a string containing the
+                                 * visibility value. */
+                                dxf_read_int16 (fp, &light->visibility);
+                                break;
+                        case 62:
+                                /* Now follows a string containing the
+                                 * color value. */
+                                dxf_read_int (fp, &light->color);
+                                break;
+                        case 67:
+                                /* Now follows a string containing the
+                                 * paperspace value. */
+                                dxf_read_int (fp, &light->paperspace);
+                                break;
+                        case 70:
+                                /* Now follows a string containing a light type. */
+                                dxf_read_int16 (fp, &light->light_type);
+                                break;
+                        case 72:
+                                /* Now follows a string containing an
+                                 * attenuation type. */
+                                dxf_read_int16 (fp, &light->attenuation_type);
+                                break;
+                        case 73:
+                                /* Now follows a string containing a shadow type. */
+                                dxf_read_int16 (fp, &light->shadow_type);
+                                break;
+                        case 90:
+                                /* Now follows a string containing a version
+                                 * number. */
+                                dxf_read_int32 (fp, &light->version_number);
+                                break;
+                        case 91:
+                                /* Now follows a string containing a shadow map
+                                 * size. */
+                                dxf_read_int32 (fp, &light->shadow_map_size);
+                                break;
+                        case 92:
+                                /* Now follows a string containing the
+                                 * paperspace value. */
+                                dxf_read_int (fp, &light->graphics_data_size);
+                                break;
+                        case 100:
+                                /* Now follows a string containing the
+                                 * subclass marker value. */
+                                dxf_read_line (temp_string, fp);
+                                if ((strcmp (temp_string, "AcDbEntity") != 0)
+                                        && ((strcmp (temp_string, "AcDbLight") != 0)))
+                                {
+                                        fprintf (stderr,
+                                          (_("Warning in %s () found a bad subclass marker in: %s in line: %d.\n")),
+                                          __FUNCTION__, fp->filename, fp->line_number);
+                                }
+                                break;
+                        case 160:
+                                /* Now follows a string containing the
+                                 * graphics data size value. */
+                                dxf_read_int (fp, &light->graphics_data_size);
+                                break;
+                        case 280:
+                                /* Now follows a string containing a shadow map
+                                 * softness value. */
+                                dxf_read_int16 (fp, &light->shadow_map_softness);
+                                break;
+                        case 284:
+                                /* Now follows a string containing the shadow
+                                 * mode value. */
+                                dxf_read_int16 (fp, &light->shadow_mode);
+                                break;
+                        case 290:
+                                /* Now follows a string containing a status
+                                 * value. */
+                                dxf_read_int (fp, &light->status);
+                                break;
+                        case 310:
+                                /* Now follows a string containing binary
+                                 * graphics data. */
+                                dxf_binary_data_read (fp, light->binary_graphics_data);
+                                break;
+                        case 330:
+                                /* Now follows a string containing a
+                                 * soft-pointer ID/handle to owner dictionary. */
+                                dxf_read_handle (fp, &light->dictionary_owner_soft);
+                                break;
+                        case 347:
+                                /* Now follows a string containing a
+                                 * hard-pointer ID/handle to material object. */
+                                dxf_read_handle (fp, &light->material);
+                                break;
+                        case 360:
+                                /* Now follows a string containing a
+                                 * hard-pointer ID/handle to owner dictionary. */
+                                dxf_read_handle (fp, &light->dictionary_owner_hard);
+                                break;
+                        case 370:
+                                /* Now follows a string containing the lineweight
+                                 * value. */
+                                dxf_read_int16 (fp, &light->lineweight);
+                                break;
+                        case 390:
+                                /* Now follows a string containing a plot style
+                                 * name value. */
+                                dxf_read_handle (fp, &light->plot_style_name);
+                                break;
+                        case 420:
+                                /* Now follows a string containing a color value. */
+                                dxf_read_long (fp, &light->color_value);
+                                break;
+                        case 430:
+                                /* Now follows a string containing a color
+                                 * name value. */
+                                dxf_read_string_interned (fp, &light->color_name);
+                                break;
+                        case 440:
+                                /* Now follows a string containing a transparency
+                                 * value. */
+                                dxf_read_long (fp, &light->transparency);
+                                break;
+                        case 999:
+                                /* Now follows a string containing a comment. */
+                                dxf_read_line (temp_string, fp);
+                                fprintf (stdout, "DXF comment: %s\n", temp_string);
+                                break;
+                        default:
                                 fprintf (stderr,
-                                  (_("Warning in %s () found a bad subclass marker in: %s in line: %d.\n")),
+                                  (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
                                   __FUNCTION__, fp->filename, fp->line_number);
-                        }
-                }
-                else if (strcmp (temp_string, "160") == 0)
-                {
-                        /* Now follows a string containing the
-                         * graphics data size value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%d\n", &light->graphics_data_size);
-                }
-                else if (strcmp (temp_string, "280") == 0)
-                {
-                        /* Now follows a string containing a shadow map
-                         * softness value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%hi\n", &light->shadow_map_softness);
-                }
-                else if (strcmp (temp_string, "284") == 0)
-                {
-                        /* Now follows a string containing the shadow
-                         * mode value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%hd\n", &light->shadow_mode);
-                }
-                else if (strcmp (temp_string, "290") == 0)
-                {
-                        /* Now follows a string containing a status
-                         * value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%d\n", &light->status);
-                }
-                else if (strcmp (temp_string, "310") == 0)
-                {
-                        /* Now follows a string containing binary
-                         * graphics data. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, light->binary_graphics_data->data_line);
-                        dxf_binary_data_init ((DxfBinaryData *) light->binary_graphics_data->next);
-                        light->binary_graphics_data = (DxfBinaryData *) light->binary_graphics_data->next;
-                }
-                else if (strcmp (temp_string, "330") == 0)
-                {
-                        /* Now follows a string containing a
-                         * soft-pointer ID/handle to owner dictionary. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, light->dictionary_owner_soft);
-                }
-                else if (strcmp (temp_string, "347") == 0)
-                {
-                        /* Now follows a string containing a
-                         * hard-pointer ID/handle to material object. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, light->material);
-                }
-                else if (strcmp (temp_string, "360") == 0)
-                {
-                        /* Now follows a string containing a
-                         * hard-pointer ID/handle to owner dictionary. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, light->dictionary_owner_hard);
-                }
-                else if (strcmp (temp_string, "370") == 0)
-                {
-                        /* Now follows a string containing the lineweight
-                         * value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%hd\n", &light->lineweight);
-                }
-                else if (strcmp (temp_string, "390") == 0)
-                {
-                        /* Now follows a string containing a plot style
-                         * name value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, light->plot_style_name);
-                }
-                else if (strcmp (temp_string, "420") == 0)
-                {
-                        /* Now follows a string containing a color value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%ld\n", &light->color_value);
-                }
-                else if (strcmp (temp_string, "430") == 0)
-                {
-                        /* Now follows a string containing a color
-                         * name value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, light->color_name);
-                }
-                else if (strcmp (temp_string, "440") == 0)
-                {
-                        /* Now follows a string containing a transparency
-                         * value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%ld\n", &light->transparency);
-                }
-                else if (strcmp (temp_string, "999") == 0)
-                {
-                        /* Now follows a string containing a comment. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
-                        fprintf (stdout, "DXF comment: %s\n", temp_string);
-                }
-                else
-                {
-                        fprintf (stderr,
-                          (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
-                          __FUNCTION__, fp->filename, fp->line_number);
+                                /* Skip the value of the unknown group code. */
+                                dxf_read_line (temp_string, fp);
+                                break;
                 }
         }
         /* Handle omitted members and/or illegal values. */
         if (strcmp (light->linetype, "") == 0)
         {
-                light->linetype = strdup (DXF_DEFAULT_LINETYPE);
+                light->linetype = dxf_strdup (DXF_DEFAULT_LINETYPE);
         }
         if (strcmp (light->layer, "") == 0)
         {
-                light->layer = strdup (DXF_DEFAULT_LAYER);
+                light->layer = dxf_strdup (DXF_DEFAULT_LAYER);
         }
-        /* Clean up. */
-        free (temp_string);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -596,7 +512,7 @@ dxf_light_write
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        char *dxf_entity_name = strdup ("LIGHT");
+        char *dxf_entity_name = dxf_strdup ("LIGHT");
         DxfBinaryData *iter_310 = NULL;
 
         /* Do some basic checks. */
@@ -606,7 +522,7 @@ dxf_light_write
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (light == NULL)
@@ -615,7 +531,7 @@ dxf_light_write
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (fp->acad_version_number < AutoCAD_2007)
@@ -627,17 +543,17 @@ dxf_light_write
         if (strcmp (light->linetype, "") == 0)
         {
                 fprintf (stderr,
-                  (_("Warning in %s () empty linetype string for the %s entity with id-code: %x\n")),
+                  (_("Warning in %s () empty linetype string for the %s entity with id-code: %" PRIx64 "\n")),
                   __FUNCTION__, dxf_entity_name, light->id_code);
                 fprintf (stderr,
                   (_("\t%s entity is reset to default linetype")),
                   dxf_entity_name);
-                light->linetype = strdup (DXF_DEFAULT_LINETYPE);
+                light->linetype = dxf_strdup (DXF_DEFAULT_LINETYPE);
         }
         if (strcmp (light->layer, "") == 0)
         {
                 fprintf (stderr,
-                  (_("Warning in %s () empty layer string for the %s entity with id-code: %x.\n")),
+                  (_("Warning in %s () empty layer string for the %s entity with id-code: %" PRIx64 ".\n")),
                   __FUNCTION__, dxf_entity_name, light->id_code);
                 fprintf (stderr,
                   (_("\t%s entity is relocated to default layer.\n")),
@@ -645,84 +561,84 @@ dxf_light_write
                 light->layer = DXF_DEFAULT_LAYER;
         }
         /* Start writing output. */
-        fprintf (fp->fp, "  0\n%s\n", dxf_entity_name);
-        if (light->id_code != -1)
+        dxf_write_string (fp, 0, dxf_entity_name);
+        if (light->id_code != DXF_HANDLE_NONE)
         {
-                fprintf (fp->fp, "  5\n%x\n", light->id_code);
+                dxf_write_hex (fp, 5, light->id_code);
         }
-        fprintf (fp->fp, "330\n%s\n", light->dictionary_owner_soft);
-        fprintf (fp->fp, "100\nAcDbEntity\n");
+        dxf_write_hex (fp, 330, light->dictionary_owner_soft);
+        dxf_write_string (fp, 100, "AcDbEntity");
         if (light->paperspace != DXF_MODELSPACE)
         {
-                fprintf (fp->fp, " 67\n%d\n", (int16_t) DXF_PAPERSPACE);
+                dxf_write_int (fp, 67, (int16_t) DXF_PAPERSPACE);
         }
-        fprintf (fp->fp, "  8\n%s\n", light->layer);
+        dxf_write_string (fp, 8, light->layer);
         if (strcmp (light->linetype, DXF_DEFAULT_LINETYPE) != 0)
         {
-                fprintf (fp->fp, "  6\n%s\n", light->linetype);
+                dxf_write_string (fp, 6, light->linetype);
         }
-        if (strcmp (light->material, "") != 0)
+        if (light->material != 0)
         {
-                fprintf (fp->fp, "347\n%s\n", light->material);
+                dxf_write_hex (fp, 347, light->material);
         }
         if (light->color != DXF_COLOR_BYLAYER)
         {
-                fprintf (fp->fp, " 62\n%d\n", light->color);
+                dxf_write_int (fp, 62, light->color);
         }
-        fprintf (fp->fp, "370\n%d\n", light->lineweight);
+        dxf_write_int (fp, 370, light->lineweight);
         if (light->thickness != 0.0)
         {
-                fprintf (fp->fp, " 39\n%f\n", light->thickness);
+                dxf_write_double (fp, 39, light->thickness);
         }
         if (light->linetype_scale != 1.0)
         {
-                fprintf (fp->fp, " 48\n%f\n", light->linetype_scale);
+                dxf_write_double (fp, 48, light->linetype_scale);
         }
         if (light->visibility != 0)
         {
-                fprintf (fp->fp, " 60\n%d\n", light->visibility);
+                dxf_write_int (fp, 60, light->visibility);
         }
 #ifdef BUILD_64
-        fprintf (fp->fp, "160\n%d\n", light->graphics_data_size);
+        dxf_write_int (fp, 160, light->graphics_data_size);
 #else
-        fprintf (fp->fp, " 92\n%d\n", light->graphics_data_size);
+        dxf_write_int (fp, 92, light->graphics_data_size);
 #endif
         iter_310 = (DxfBinaryData *) light->binary_graphics_data;
         while (iter_310 != NULL)
         {
-                fprintf (fp->fp, "310\n%s\n", iter_310->data_line);
+                dxf_binary_data_write (fp, iter_310);
                 iter_310 = (DxfBinaryData *) iter_310->next;
         }
-        fprintf (fp->fp, "420\n%ld\n", light->color_value);
-        fprintf (fp->fp, "430\n%s\n", light->color_name);
-        fprintf (fp->fp, "440\n%ld\n", light->transparency);
-        fprintf (fp->fp, "390\n%s\n", light->plot_style_name);
-        fprintf (fp->fp, "284\n%d\n", light->shadow_mode);
-        fprintf (fp->fp, "100\nAcDbLight\n");
-        fprintf (fp->fp, " 90\n%i\n", light->version_number);
-        fprintf (fp->fp, "  1\n%s\n", light->light_name);
-        fprintf (fp->fp, " 70\n%hi\n", light->light_type);
-        fprintf (fp->fp, "290\n%d\n", light->status);
-        fprintf (fp->fp, "291\n%d\n", light->plot_glyph);
-        fprintf (fp->fp, " 40\n%f\n", light->intensity);
-        fprintf (fp->fp, " 10\n%f\n", light->p0->x0);
-        fprintf (fp->fp, " 20\n%f\n", light->p0->y0);
-        fprintf (fp->fp, " 30\n%f\n", light->p0->z0);
-        fprintf (fp->fp, " 11\n%f\n", light->p1->x0);
-        fprintf (fp->fp, " 21\n%f\n", light->p1->y0);
-        fprintf (fp->fp, " 31\n%f\n", light->p1->z0);
-        fprintf (fp->fp, " 72\n%hi\n", light->attenuation_type);
-        fprintf (fp->fp, "292\n%d\n", light->use_attenuation_limits);
-        fprintf (fp->fp, " 41\n%f\n", light->attenuation_start_limit);
-        fprintf (fp->fp, " 42\n%f\n", light->attenuation_end_limit);
-        fprintf (fp->fp, " 50\n%f\n", light->hotspot_angle);
-        fprintf (fp->fp, " 51\n%f\n", light->falloff_angle);
-        fprintf (fp->fp, "293\n%d\n", light->cast_shadows);
-        fprintf (fp->fp, " 73\n%hi\n", light->shadow_type);
-        fprintf (fp->fp, " 91\n%i\n", light->shadow_map_size);
-        fprintf (fp->fp, "280\n%d\n", light->shadow_map_softness);
+        dxf_write_int (fp, 420, light->color_value);
+        dxf_write_string (fp, 430, light->color_name);
+        dxf_write_int (fp, 440, light->transparency);
+        dxf_write_hex (fp, 390, light->plot_style_name);
+        dxf_write_int (fp, 284, light->shadow_mode);
+        dxf_write_string (fp, 100, "AcDbLight");
+        dxf_write_int (fp, 90, light->version_number);
+        dxf_write_string (fp, 1, light->light_name);
+        dxf_write_int (fp, 70, light->light_type);
+        dxf_write_int (fp, 290, light->status);
+        dxf_write_int (fp, 291, light->plot_glyph);
+        dxf_write_double (fp, 40, light->intensity);
+        dxf_write_double (fp, 10, light->p0->x0);
+        dxf_write_double (fp, 20, light->p0->y0);
+        dxf_write_double (fp, 30, light->p0->z0);
+        dxf_write_double (fp, 11, light->p1->x0);
+        dxf_write_double (fp, 21, light->p1->y0);
+        dxf_write_double (fp, 31, light->p1->z0);
+        dxf_write_int (fp, 72, light->attenuation_type);
+        dxf_write_int (fp, 292, light->use_attenuation_limits);
+        dxf_write_double (fp, 41, light->attenuation_start_limit);
+        dxf_write_double (fp, 42, light->attenuation_end_limit);
+        dxf_write_double (fp, 50, light->hotspot_angle);
+        dxf_write_double (fp, 51, light->falloff_angle);
+        dxf_write_int (fp, 293, light->cast_shadows);
+        dxf_write_int (fp, 73, light->shadow_type);
+        dxf_write_int (fp, 91, light->shadow_map_size);
+        dxf_write_int (fp, 280, light->shadow_map_softness);
         /* Clean up. */
-        free (dxf_entity_name);
+        dxf_free (dxf_entity_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -763,18 +679,14 @@ dxf_light_free
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        free (light->linetype);
-        free (light->layer);
+        dxf_string_free (light->linetype);
+        dxf_string_free (light->layer);
         dxf_binary_data_free_list ((DxfBinaryData *) light->binary_graphics_data);
-        free (light->dictionary_owner_hard);
-        free (light->material);
-        free (light->dictionary_owner_soft);
-        free (light->plot_style_name);
-        free (light->color_name);
-        free (light->light_name);
+        dxf_string_free (light->color_name);
+        dxf_free (light->light_name);
         dxf_point_free (light->p0);
         dxf_point_free (light->p1);
-        free (light);
+        dxf_free (light);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -821,7 +733,7 @@ dxf_light_free_list
  * \return \c id_code when successful, or \c EXIT_FAILURE when an error
  * occurred.
  */
-int
+uint64_t
 dxf_light_get_id_code
 (
         DxfLight *light
@@ -839,12 +751,6 @@ dxf_light_get_id_code
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (light->id_code < 0)
-        {
-                fprintf (stderr,
-                  (_("Warning in %s () a negative value was found.\n")),
-                  __FUNCTION__);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -863,7 +769,7 @@ dxf_light_set_id_code
 (
         DxfLight *light,
                 /*!< a pointer to a DXF \c LIGHT entity. */
-        int id_code
+        uint64_t id_code
                 /*!< Identification number for the entity.\n
                  * This is to be an unique (sequential) number in the DXF
                  * file. */
@@ -880,12 +786,6 @@ dxf_light_set_id_code
                   __FUNCTION__);
                 return (NULL);
         }
-        if (id_code < 0)
-        {
-                fprintf (stderr,
-                  (_("Warning in %s () a negative value was passed.\n")),
-                  __FUNCTION__);
-        }
         light->id_code = id_code;
 #if DEBUG
         DXF_DEBUG_END
@@ -927,7 +827,7 @@ dxf_light_get_linetype
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (light->linetype));
+        return (dxf_strdup (light->linetype));
 }
 
 
@@ -964,7 +864,7 @@ dxf_light_set_linetype
                   __FUNCTION__);
                 return (NULL);
         }
-        light->linetype = strdup (linetype);
+        light->linetype = dxf_strdup (linetype);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1005,7 +905,7 @@ dxf_light_get_layer
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (light->layer));
+        return (dxf_strdup (light->layer));
 }
 
 
@@ -1042,7 +942,7 @@ dxf_light_set_layer
                   __FUNCTION__);
                 return (NULL);
         }
-        light->layer = strdup (layer);
+        light->layer = dxf_strdup (layer);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1728,12 +1628,10 @@ dxf_light_set_binary_graphics_data
  * \brief Get the pointer to the \c dictionary_owner_soft from a DXF 
  * \c LIGHT entity.
  *
- * \return pointer to the \c dictionary_owner_soft, or \c NULL when an
+ * \return the handle of the \c dictionary_owner_soft, or 0 when an
  * error occurred.
- *
- * \warning No checks are performed on the returned pointer (string).
  */
-char *
+uint64_t
 dxf_light_get_dictionary_owner_soft
 (
         DxfLight *light
@@ -1749,19 +1647,12 @@ dxf_light_get_dictionary_owner_soft
                 fprintf (stderr,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
-                return (NULL);
-        }
-        if (light->dictionary_owner_soft ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
+                return (0);
         }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (light->dictionary_owner_soft));
+        return (light->dictionary_owner_soft);
 }
 
 
@@ -1777,8 +1668,8 @@ dxf_light_set_dictionary_owner_soft
 (
         DxfLight *light,
                 /*!< a pointer to a DXF \c LIGHT entity. */
-        char *dictionary_owner_soft
-                /*!< a string containing the pointer to the
+        uint64_t dictionary_owner_soft
+                /*!< the handle of the
                  * \c dictionary_owner_soft for the entity. */
 )
 {
@@ -1793,14 +1684,7 @@ dxf_light_set_dictionary_owner_soft
                   __FUNCTION__);
                 return (NULL);
         }
-        if (dictionary_owner_soft == NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was passed.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
-        light->dictionary_owner_soft = strdup (dictionary_owner_soft);
+        light->dictionary_owner_soft = dictionary_owner_soft;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1813,10 +1697,8 @@ dxf_light_set_dictionary_owner_soft
  * \c LIGHT entity.
  *
  * \return soft pointer to the object owner.
- *
- * \warning No checks are performed on the returned pointer (string).
  */
-char *
+uint64_t
 dxf_light_get_object_owner_soft
 (
         DxfLight *light
@@ -1832,19 +1714,12 @@ dxf_light_get_object_owner_soft
                 fprintf (stderr,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
-                return (NULL);
-        }
-        if (light->object_owner_soft ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
+                return (0);
         }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (light->object_owner_soft));
+        return (light->object_owner_soft);
 }
 
 
@@ -1857,8 +1732,8 @@ dxf_light_set_object_owner_soft
 (
         DxfLight *light,
                 /*!< a pointer to a DXF \c LIGHT entity. */
-        char *object_owner_soft
-                /*!< a string containing the pointer to the
+        uint64_t object_owner_soft
+                /*!< the handle of the
                  * \c object_owner_soft for the entity. */
 )
 {
@@ -1873,14 +1748,7 @@ dxf_light_set_object_owner_soft
                   __FUNCTION__);
                 return (NULL);
         }
-        if (object_owner_soft == NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was passed.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
-        light->object_owner_soft = strdup (object_owner_soft);
+        light->object_owner_soft = object_owner_soft;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1891,12 +1759,10 @@ dxf_light_set_object_owner_soft
 /*!
  * \brief Get the pointer to the \c material from a DXF \c LIGHT entity.
  *
- * \return a pointer to \c material when successful, or \c NULL when an
+ * \return the handle \c material when successful, or 0 when an
  * error occurred.
- *
- * \warning No checks are performed on the returned pointer.
  */
-char *
+uint64_t
 dxf_light_get_material
 (
         DxfLight *light
@@ -1912,19 +1778,12 @@ dxf_light_get_material
                 fprintf (stderr,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
-                return (NULL);
-        }
-        if (light->material ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
+                return (0);
         }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (light->material));
+        return (light->material);
 }
 
 
@@ -1939,8 +1798,8 @@ dxf_light_set_material
 (
         DxfLight *light,
                 /*!< a pointer to a DXF \c LIGHT entity. */
-        char *material
-                /*!< a string containing the pointer to the \c
+        uint64_t material
+                /*!< the handle of the \c
                  * material for the entity. */
 )
 {
@@ -1955,14 +1814,7 @@ dxf_light_set_material
                   __FUNCTION__);
                 return (NULL);
         }
-        if (material == NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was passed.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
-        light->material = strdup (material);
+        light->material = material;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1974,12 +1826,10 @@ dxf_light_set_material
  * \brief Get the pointer to the \c dictionary_owner_hard from a DXF
  * \c LIGHT entity.
  *
- * \return a pointer to \c dictionary_owner_hard when successful, or
- * \c NULL when an error occurred.
- *
- * \warning No checks are performed on the returned pointer.
+ * \return the handle \c dictionary_owner_hard when successful, or
+ * 0 when an error occurred.
  */
-char *
+uint64_t
 dxf_light_get_dictionary_owner_hard
 (
         DxfLight *light
@@ -1995,19 +1845,12 @@ dxf_light_get_dictionary_owner_hard
                 fprintf (stderr,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
-                return (NULL);
-        }
-        if (light->dictionary_owner_hard ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
+                return (0);
         }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (light->dictionary_owner_hard));
+        return (light->dictionary_owner_hard);
 }
 
 
@@ -2023,8 +1866,8 @@ dxf_light_set_dictionary_owner_hard
 (
         DxfLight *light,
                 /*!< a pointer to a DXF \c LIGHT entity. */
-        char *dictionary_owner_hard
-                /*!< a string containing the pointer to the \c
+        uint64_t dictionary_owner_hard
+                /*!< the handle of the \c
                  * dictionary_owner_hard for the entity. */
 )
 {
@@ -2039,14 +1882,7 @@ dxf_light_set_dictionary_owner_hard
                   __FUNCTION__);
                 return (NULL);
         }
-        if (dictionary_owner_hard == NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was passed.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
-        light->dictionary_owner_hard = strdup (dictionary_owner_hard);
+        light->dictionary_owner_hard = dictionary_owner_hard;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2122,10 +1958,10 @@ dxf_light_set_lineweight
 /*!
  * \brief Get the \c plot_style_name from a DXF \c LIGHT entity.
  *
- * \return \c plot_style_name when sucessful, or \c NULL when an error
+ * \return \c plot_style_name when sucessful, or 0 when an error
  * occurred.
  */
-char *
+uint64_t
 dxf_light_get_plot_style_name
 (
         DxfLight *light
@@ -2141,19 +1977,12 @@ dxf_light_get_plot_style_name
                 fprintf (stderr,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
-                return (NULL);
-        }
-        if (light->plot_style_name ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
+                return (0);
         }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (light->plot_style_name));
+        return (light->plot_style_name);
 }
 
 
@@ -2168,7 +1997,7 @@ dxf_light_set_plot_style_name
 (
         DxfLight *light,
                 /*!< a pointer to a DXF \c LIGHT entity. */
-        char *plot_style_name
+        uint64_t plot_style_name
                 /*!< a string containing the \c plot_style_name for the
                  * entity. */
 )
@@ -2184,14 +2013,7 @@ dxf_light_set_plot_style_name
                   __FUNCTION__);
                 return (NULL);
         }
-        if (plot_style_name == NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was passed.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
-        light->plot_style_name = strdup (plot_style_name);
+        light->plot_style_name = plot_style_name;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2298,7 +2120,7 @@ dxf_light_get_color_name
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (light->color_name));
+        return (dxf_strdup (light->color_name));
 }
 
 
@@ -2336,7 +2158,7 @@ dxf_light_set_color_name
                   __FUNCTION__);
                 return (NULL);
         }
-        light->color_name = strdup (color_name);
+        light->color_name = dxf_strdup (color_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
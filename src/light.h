@@ -56,7 +56,7 @@ typedef struct
 dxf_light_struct
 {
         /* Members common for all DXF drawable entities. */
-        int id_code;
+        uint64_t id_code;
                 /*!< Identification number for the entity.\n
                  * This is to be an unique (sequential) number in the DXF
                  * file.\n
@@ -129,20 +129,20 @@ dxf_light_struct
                  * (optional).\n
                  * Group code = 310.\n
                  * \since Introduced in version R2000. */
-        char *dictionary_owner_soft;
+        uint64_t dictionary_owner_soft;
                 /*!< Soft-pointer ID/handle to owner dictionary (optional).\n
                  * Group code = 330.\n
                  * \since Introduced in version R14. */
-        char *object_owner_soft;
+        uint64_t object_owner_soft;
                 /*!< Soft-pointer ID/handle  to owner BLOCK_RECORD object.\n
                  * Group code = 330.\n
                  * \since Introduced in version R2000. */
-        char *material;
+        uint64_t material;
                 /*!< Hard-pointer ID/handle to material object (present if
                  * not BYLAYER).\n
                  * Group code = 347.\n
                  * \since Introduced in version R2008. */
-        char *dictionary_owner_hard;
+        uint64_t dictionary_owner_hard;
                 /*!< Hard owner ID/handle to owner dictionary (optional).\n
                  * Group code = 360.\n
                  * \since Introduced in version R14. */
@@ -151,7 +151,7 @@ dxf_light_struct
                  * Stored and moved around as a 16-bit integer.\n
                  * Group code = 370.\n
                  * \since Introduced in version R2002. */
-        char *plot_style_name;
+        uint64_t plot_style_name;
                 /*!< Hard pointer ID / handle of PlotStyleName object.\n
                  * Group code = 390.\n
                  * \since Introduced in version R2009. */
@@ -264,8 +264,8 @@ DxfLight *dxf_light_read (DxfFile *fp, DxfLight *light);
 int dxf_light_write (DxfFile *fp, DxfLight *light);
 int dxf_light_free (DxfLight *light);
 void dxf_light_free_list (DxfLight *light_list);
-int dxf_light_get_id_code (DxfLight *light);
-DxfLight *dxf_light_set_id_code (DxfLight *light, int id_code);
+uint64_t dxf_light_get_id_code (DxfLight *light);
+DxfLight *dxf_light_set_id_code (DxfLight *light, uint64_t id_code);
 char *dxf_light_get_linetype (DxfLight *light);
 DxfLight *dxf_light_set_linetype (DxfLight *light, char *linetype);
 char *dxf_light_get_layer (DxfLight *light);
@@ -286,18 +286,18 @@ int16_t dxf_light_get_shadow_mode (DxfLight *light);
 DxfLight *dxf_light_set_shadow_mode (DxfLight *light, int16_t shadow_mode);
 DxfBinaryData *dxf_light_get_binary_graphics_data (DxfLight *light);
 DxfLight *dxf_light_set_binary_graphics_data (DxfLight *light, DxfBinaryData *data);
-char *dxf_light_get_dictionary_owner_soft (DxfLight *light);
-DxfLight *dxf_light_set_dictionary_owner_soft (DxfLight *light, char *dictionary_owner_soft);
-char *dxf_light_get_object_owner_soft (DxfLight *light);
-DxfLight *dxf_light_set_object_owner_soft (DxfLight *light, char *object_owner_soft);
-char *dxf_light_get_material (DxfLight *light);
-DxfLight *dxf_light_set_material (DxfLight *light, char *material);
-char *dxf_light_get_dictionary_owner_hard (DxfLight *light);
-DxfLight *dxf_light_set_dictionary_owner_hard (DxfLight *light, char *dictionary_owner_hard);
+uint64_t dxf_light_get_dictionary_owner_soft (DxfLight *light);
+DxfLight *dxf_light_set_dictionary_owner_soft (DxfLight *light, uint64_t dictionary_owner_soft);
+uint64_t dxf_light_get_object_owner_soft (DxfLight *light);
+DxfLight *dxf_light_set_object_owner_soft (DxfLight *light, uint64_t object_owner_soft);
+uint64_t dxf_light_get_material (DxfLight *light);
+DxfLight *dxf_light_set_material (DxfLight *light, uint64_t material);
+uint64_t dxf_light_get_dictionary_owner_hard (DxfLight *light);
+DxfLight *dxf_light_set_dictionary_owner_hard (DxfLight *light, uint64_t dictionary_owner_hard);
 int16_t dxf_light_get_lineweight (DxfLight *light);
 DxfLight *dxf_light_set_lineweight (DxfLight *light, int16_t lineweight);
-char *dxf_light_get_plot_style_name (DxfLight *light);
-DxfLight *dxf_light_set_plot_style_name (DxfLight *light, char *plot_style_name);
+uint64_t dxf_light_get_plot_style_name (DxfLight *light);
+DxfLight *dxf_light_set_plot_style_name (DxfLight *light, uint64_t plot_style_name);
 long dxf_light_get_color_value (DxfLight *light);
 DxfLight *dxf_light_set_color_value (DxfLight *light, long color_value);
 char *dxf_light_get_color_name (DxfLight *light);
@@ -40,6 +40,8 @@
 
 
 #include "line.h"
+#include "bbox.h"
+#include "util.h"
 
 
 /*!
@@ -62,7 +64,7 @@ dxf_line_new ()
         size = sizeof (DxfLine);
         /* avoid malloc of 0 bytes */
         if (size == 0) size = 1;
-        if ((line = malloc (size)) == NULL)
+        if ((line = dxf_malloc (size)) == NULL)
         {
                 fprintf (stderr,
                   (_("Error in %s () could not allocate memory.\n")),
@@ -121,26 +123,10 @@ dxf_line_init
                 __FUNCTION__);
               return (NULL);
         }
-        line->p0 = (DxfPoint *) dxf_point_init (line->p0);
-        if (line->p0 == NULL)
-        {
-              fprintf (stderr,
-                (_("Error in %s () could not allocate memory.\n")),
-                __FUNCTION__);
-              return (NULL);
-        }
-        line->p1 = (DxfPoint *) dxf_point_init (line->p1);
-        if (line->p1 == NULL)
-        {
-              fprintf (stderr,
-                (_("Error in %s () could not allocate memory.\n")),
-                __FUNCTION__);
-              return (NULL);
-        }
         /* Assign initial values to members. */
-        line->id_code = 0;
-        line->linetype = strdup (DXF_DEFAULT_LINETYPE);
-        line->layer = strdup (DXF_DEFAULT_LAYER);
+        line->id_code = DXF_HANDLE_NONE;
+        line->linetype = dxf_strdup (DXF_DEFAULT_LINETYPE);
+        line->layer = dxf_strdup (DXF_DEFAULT_LAYER);
         line->elevation = 0.0;
         line->thickness = 0.0;
         line->linetype_scale = DXF_DEFAULT_LINETYPE_SCALE;
@@ -149,23 +135,27 @@ dxf_line_init
         line->paperspace = DXF_MODELSPACE;
         line->graphics_data_size = 0;
         line->shadow_mode = 0;
-        line->dictionary_owner_soft = strdup ("");
-        line->object_owner_soft = strdup ("");
-        line->material = strdup ("");
-        line->dictionary_owner_hard = strdup ("");
+        line->dictionary_owner_soft = 0;
+        line->object_owner_soft = 0;
+        line->material = 0;
+        line->dictionary_owner_hard = 0;
         line->lineweight = 0;
-        line->plot_style_name = strdup ("");
+        line->plot_style_name = 0;
         line->color_value = 0;
-        line->color_name = strdup ("");
+        line->color_name = dxf_strdup ("");
         line->transparency = 0;
         line->extr_x0 = 0.0;
         line->extr_y0 = 0.0;
         line->extr_z0 = 0.0;
+        line->p0.x = 0.0;
+        line->p0.y = 0.0;
+        line->p0.z = 0.0;
+        line->p1.x = 0.0;
+        line->p1.y = 0.0;
+        line->p1.z = 0.0;
         /* Initialize new structs for the following members later,
          * when they are required and when we have content. */
         line->binary_graphics_data = NULL;
-        line->p0 = NULL;
-        line->p1 = NULL;
         line->next = NULL;
 #if DEBUG
         DXF_DEBUG_END
@@ -197,7 +187,8 @@ dxf_line_read
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        char *temp_string = NULL;
+        char temp_string[DXF_MAX_STRING_LENGTH];
+        int group_code;
         DxfBinaryData *iter310 = NULL;
         int iter330;
 
@@ -207,8 +198,6 @@ dxf_line_read
                 fprintf (stderr,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
-                /* Clean up. */
-                free (temp_string);
                 return (NULL);
         }
         if (line == NULL)
@@ -231,323 +220,216 @@ dxf_line_read
                         fprintf (stderr,
                           (_("Error in %s () could not allocate memory.\n")),
                           __FUNCTION__);
-                        /* Clean up. */
-                        free (temp_string);
-                        return (NULL);
-                }
-        }
-        if (line->p0 == NULL)
-        {
-                fprintf (stderr,
-                  (_("Warning in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                fprintf (stderr,
-                  (_("Initializing a DxfPoint.\n")));
-                line->p0 = dxf_point_init (line->p0);
-                if (line->p0 == NULL)
-                {
-                        fprintf (stderr,
-                          (_("Error in %s () could not allocate memory.\n")),
-                          __FUNCTION__);
-                        /* Clean up. */
-                        free (temp_string);
-                        return (NULL);
-                }
-        }
-        if (line->p1 == NULL)
-        {
-                fprintf (stderr,
-                  (_("Warning in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                fprintf (stderr,
-                  (_("Initializing a DxfPoint.\n")));
-                line->p1 = dxf_point_init (line->p1);
-                if (line->p1 == NULL)
-                {
-                        fprintf (stderr,
-                          (_("Error in %s () could not allocate memory.\n")),
-                          __FUNCTION__);
-                        /* Clean up. */
-                        free (temp_string);
                         return (NULL);
                 }
         }
         iter310 = (DxfBinaryData *) line->binary_graphics_data;
         iter330 = 0;
-        (fp->line_number)++;
-        fscanf (fp->fp, "%[^\n]", temp_string);
-        while (strcmp (temp_string, "0") != 0)
+        while ((dxf_read_group_code (fp, &group_code) == EXIT_SUCCESS)
+          && (group_code != 0))
         {
-                if (ferror (fp->fp))
+                if (dxf_read_error (fp))
                 {
                         fprintf (stderr,
                           (_("Error in %s () while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
-                        fclose (fp->fp);
-                        /* Clean up. */
-                        free (temp_string);
                         return (NULL);
                 }
-                if (strcmp (temp_string, "5") == 0)
-                {
-                        /* Now follows a string containing a sequential
-                         * id number. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%x\n", (uint *) &line->id_code);
-                }
-                else if (strcmp (temp_string, "6") == 0)
-                {
-                        /* Now follows a string containing a linetype
-                         * name. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, line->linetype);
-                }
-                else if (strcmp (temp_string, "8") == 0)
-                {
-                        /* Now follows a string containing a layer name. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, line->layer);
-                }
-                else if (strcmp (temp_string, "10") == 0)
-                {
-                        /* Now follows a string containing the
-                         * X-coordinate of the start point. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &line->p0->x0);
-                }
-                else if (strcmp (temp_string, "20") == 0)
-                {
-                        /* Now follows a string containing the
-                         * Y-coordinate of the start point. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &line->p0->y0);
-                }
-                else if (strcmp (temp_string, "30") == 0)
-                {
-                        /* Now follows a string containing the
-                         * Z-coordinate of the start point. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &line->p0->z0);
-                }
-                else if (strcmp (temp_string, "11") == 0)
-                {
-                        /* Now follows a string containing the
-                         * X-coordinate of the end point. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &line->p1->x0);
-                }
-                else if (strcmp (temp_string, "21") == 0)
+                switch (group_code)
                 {
-                        /* Now follows a string containing the
-                         * Y-coordinate of the end point. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &line->p1->y0);
-                }
-                else if (strcmp (temp_string, "31") == 0)
-                {
-                        /* Now follows a string containing the
-                         * Z-coordinate of the end point. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &line->p1->z0);
-                }
-                else if (strcmp (temp_string, "38") == 0)
-                {
-                        /* Now follows a string containing the
-                         * elevation. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &line->elevation);
-                }
-                else if (strcmp (temp_string, "39") == 0)
-                {
-                        /* Now follows a string containing the
-                         * thickness. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &line->thickness);
-                }
-                else if (strcmp (temp_string, "48") == 0)
-                {
-                        /* Now follows a string containing the linetype
-                         * scale. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &line->linetype_scale);
-                }
-                else if (strcmp (temp_string, "60") == 0)
-                {
-                        /* Now follows a string containing the
-                         * visibility value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%hd\n", &line->visibility);
-                }
-                else if (strcmp (temp_string, "62") == 0)
-                {
-                        /* Now follows a string containing the
-                         * color value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%hd\n", &line->color);
-                }
-                else if (strcmp (temp_string, "67") == 0)
-                {
-                        /* Now follows a string containing the
-                         * paperspace value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%hd\n", &line->paperspace);
-                }
-                else if (strcmp (temp_string, "92") == 0)
-                {
-                        /* Now follows a string containing the
-                         * graphics data size value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%" PRIi32 "\n", &line->graphics_data_size);
-                }
-                else if (strcmp (temp_string, "100") == 0)
-                {
-                        /* Now follows a string containing the
-                         * subclass marker value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
-                        if ((strcmp (temp_string, "AcDbEntity") != 0)
-                        && ((strcmp (temp_string, "AcDbLine") != 0)))
-                        {
+                        case 5:
+                                /* Now follows a string containing a sequential
+                                 * id number. */
+                                dxf_read_handle (fp, &line->id_code);
+                                break;
+                        case 6:
+                                /* Now follows a string containing a linetype
+                                 * name. */
+                                dxf_read_string_interned (fp, &line->linetype);
+                                break;
+                        case 8:
+                                /* Now follows a string containing a layer name. */
+                                dxf_read_string_interned (fp, &line->layer);
+                                break;
+                        case 10:
+                                /* Now follows a string containing the
+                                 * X-coordinate of the start point. */
+                                dxf_read_double (fp, &line->p0.x);
+                                break;
+                        case 20:
+                                /* Now follows a string containing the
+                                 * Y-coordinate of the start point. */
+                                dxf_read_double (fp, &line->p0.y);
+                                break;
+                        case 30:
+                                /* Now follows a string containing the
+                                 * Z-coordinate of the start point. */
+                                dxf_read_double (fp, &line->p0.z);
+                                break;
+                        case 11:
+                                /* Now follows a string containing the
+                                 * X-coordinate of the end point. */
+                                dxf_read_double (fp, &line->p1.x);
+                                break;
+                        case 21:
+                                /* Now follows a string containing the
+                                 * Y-coordinate of the end point. */
+                                dxf_read_double (fp, &line->p1.y);
+                                break;
+                        case 31:
+                                /* Now follows a string containing the
+                                 * Z-coordinate of the end point. */
+                                dxf_read_double (fp, &line->p1.z);
+                                break;
+                        case 38:
+                                /* Now follows a string containing the
+                                 * elevation. */
+                                dxf_read_double (fp, &line->elevation);
+                                break;
+                        case 39:
+                                /* Now follows a string containing the
+                                 * thickness. */
+                                dxf_read_double (fp, &line->thickness);
+                                break;
+                        case 48:
+                                /* Now follows a string containing the linetype
+                                 * scale. */
+                                dxf_read_double (fp, &line->linetype_scale);
+                                break;
+                        case 60:
+                                /* Now follows a string containing the
+                                 * visibility value. */
+                                dxf_read_int16 (fp, &line->visibility);
+                                break;
+                        case 62:
+                                /* Now follows a string containing the
+                                 * color value. */
+                                dxf_read_int16 (fp, &line->color);
+                                break;
+                        case 67:
+                                /* Now follows a string containing the
+                                 * paperspace value. */
+                                dxf_read_int16 (fp, &line->paperspace);
+                                break;
+                        case 92:
+                                /* Now follows a string containing the
+                                 * graphics data size value. */
+                                dxf_read_int32 (fp, &line->graphics_data_size);
+                                break;
+                        case 100:
+                                /* Now follows a string containing the
+                                 * subclass marker value. */
+                                dxf_read_line (temp_string, fp);
+                                if ((strcmp (temp_string, "AcDbEntity") != 0)
+                                && ((strcmp (temp_string, "AcDbLine") != 0)))
+                                {
+                                        fprintf (stderr,
+                                          (_("Warning in %s () found a bad subclass marker in: %s in line: %d.\n")),
+                                          __FUNCTION__, fp->filename, fp->line_number);
+                                }
+                                break;
+                        case 160:
+                                /* Now follows a string containing the
+                                 * graphics data size value. */
+                                dxf_read_int32 (fp, &line->graphics_data_size);
+                                break;
+                        case 210:
+                                /* Now follows a string containing the
+                                 * X-value of the extrusion vector. */
+                                dxf_read_double (fp, &line->extr_x0);
+                                break;
+                        case 220:
+                                /* Now follows a string containing the
+                                 * Y-value of the extrusion vector. */
+                                dxf_read_double (fp, &line->extr_y0);
+                                break;
+                        case 230:
+                                /* Now follows a string containing the
+                                 * Z-value of the extrusion vector. */
+                                dxf_read_double (fp, &line->extr_z0);
+                                break;
+                        case 284:
+                                /* Now follows a string containing the shadow
+                                 * mode value. */
+                                dxf_read_int16 (fp, &line->shadow_mode);
+                                break;
+                        case 310:
+                                /* Now follows a string containing binary
+                                 * graphics data. */
+                                iter310 = dxf_binary_data_read (fp, iter310);
+                                break;
+                        case 330:
+                                if (iter330 == 0)
+                                {
+                                        /* Now follows a string containing a soft-pointer
+                                         * ID/handle to owner dictionary. */
+                                        dxf_read_handle (fp, &line->dictionary_owner_soft);
+                                }
+                                if (iter330 == 1)
+                                {
+                                        /* Now follows a string containing a soft-pointer
+                                         * ID/handle to owner object. */
+                                        dxf_read_handle (fp, &line->object_owner_soft);
+                                }
+                                iter330++;
+                                break;
+                        case 347:
+                                /* Now follows a string containing a
+                                 * hard-pointer ID/handle to material object. */
+                                dxf_read_handle (fp, &line->material);
+                                break;
+                        case 360:
+                                /* Now follows a string containing Hard owner
+                                 * ID/handle to owner dictionary. */
+                                dxf_read_handle (fp, &line->dictionary_owner_hard);
+                                break;
+                        case 370:
+                                /* Now follows a string containing the lineweight
+                                 * value. */
+                                dxf_read_int16 (fp, &line->lineweight);
+                                break;
+                        case 390:
+                                /* Now follows a string containing a plot style
+                                 * name value. */
+                                dxf_read_handle (fp, &line->plot_style_name);
+                                break;
+                        case 420:
+                                /* Now follows a string containing a color value. */
+                                dxf_read_int32 (fp, &line->color_value);
+                                break;
+                        case 430:
+                                /* Now follows a string containing a color
+                                 * name value. */
+                                dxf_read_string_interned (fp, &line->color_name);
+                                break;
+                        case 440:
+                                /* Now follows a string containing a transparency
+                                 * value. */
+                                dxf_read_int32 (fp, &line->transparency);
+                                break;
+                        case 999:
+                                /* Now follows a string containing a comment. */
+                                dxf_read_line (temp_string, fp);
+                                fprintf (stdout, "DXF comment: %s\n", temp_string);
+                                break;
+                        default:
                                 fprintf (stderr,
-                                  (_("Warning in %s () found a bad subclass marker in: %s in line: %d.\n")),
+                                  (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
                                   __FUNCTION__, fp->filename, fp->line_number);
-                        }
-                }
-                else if (strcmp (temp_string, "160") == 0)
-                {
-                        /* Now follows a string containing the
-                         * graphics data size value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%" PRIi32 "\n", &line->graphics_data_size);
-                }
-                else if (strcmp (temp_string, "210") == 0)
-                {
-                        /* Now follows a string containing the
-                         * X-value of the extrusion vector. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &line->extr_x0);
-                }
-                else if (strcmp (temp_string, "220") == 0)
-                {
-                        /* Now follows a string containing the
-                         * Y-value of the extrusion vector. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &line->extr_y0);
-                }
-                else if (strcmp (temp_string, "230") == 0)
-                {
-                        /* Now follows a string containing the
-                         * Z-value of the extrusion vector. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &line->extr_z0);
-                }
-                else if (strcmp (temp_string, "284") == 0)
-                {
-                        /* Now follows a string containing the shadow
-                         * mode value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%hd\n", &line->shadow_mode);
-                }
-                else if (strcmp (temp_string, "310") == 0)
-                {
-                        /* Now follows a string containing binary
-                         * graphics data. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, iter310->data_line);
-                        dxf_binary_data_init ((DxfBinaryData *) iter310->next);
-                        iter310 = (DxfBinaryData *) iter310->next;
-                }
-                else if (strcmp (temp_string, "330") == 0)
-                {
-                        if (iter330 == 0)
-                        {
-                                /* Now follows a string containing a soft-pointer
-                                 * ID/handle to owner dictionary. */
-                                (fp->line_number)++;
-                                fscanf (fp->fp, DXF_MAX_STRING_FORMAT, line->dictionary_owner_soft);
-                        }
-                        if (iter330 == 1)
-                        {
-                                /* Now follows a string containing a soft-pointer
-                                 * ID/handle to owner object. */
-                                (fp->line_number)++;
-                                fscanf (fp->fp, DXF_MAX_STRING_FORMAT, line->object_owner_soft);
-                        }
-                        iter330++;
-                }
-                else if (strcmp (temp_string, "347") == 0)
-                {
-                        /* Now follows a string containing a
-                         * hard-pointer ID/handle to material object. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, line->material);
-                }
-                else if (strcmp (temp_string, "360") == 0)
-                {
-                        /* Now follows a string containing Hard owner
-                         * ID/handle to owner dictionary. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, line->dictionary_owner_hard);
-                }
-                else if (strcmp (temp_string, "370") == 0)
-                {
-                        /* Now follows a string containing the lineweight
-                         * value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%hd\n", &line->lineweight);
-                }
-                else if (strcmp (temp_string, "390") == 0)
-                {
-                        /* Now follows a string containing a plot style
-                         * name value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, line->plot_style_name);
-                }
-                else if (strcmp (temp_string, "420") == 0)
-                {
-                        /* Now follows a string containing a color value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%" PRIi32 "\n", &line->color_value);
-                }
-                else if (strcmp (temp_string, "430") == 0)
-                {
-                        /* Now follows a string containing a color
-                         * name value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, line->color_name);
-                }
-                else if (strcmp (temp_string, "440") == 0)
-                {
-                        /* Now follows a string containing a transparency
-                         * value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%" PRIi32 "\n", &line->transparency);
-                }
-                else if (strcmp (temp_string, "999") == 0)
-                {
-                        /* Now follows a string containing a comment. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
-                        fprintf (stdout, "DXF comment: %s\n", temp_string);
-                }
-                else
-                {
-                        fprintf (stderr,
-                          (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
-                          __FUNCTION__, fp->filename, fp->line_number);
+                                /* Skip the value of the unknown group code. */
+                                dxf_read_line (temp_string, fp);
+                                break;
                 }
         }
         /* Handle omitted members and/or illegal values. */
         if (strcmp (line->linetype, "") == 0)
         {
-                line->linetype = strdup (DXF_DEFAULT_LINETYPE);
+                line->linetype = dxf_strdup (DXF_DEFAULT_LINETYPE);
         }
         if (strcmp (line->layer, "") == 0)
         {
-                line->layer = strdup (DXF_DEFAULT_LAYER);
+                line->layer = dxf_strdup (DXF_DEFAULT_LAYER);
         }
-        /* Clean up. */
-        free (temp_string);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -573,7 +455,7 @@ dxf_line_write
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        char *dxf_entity_name = strdup ("LINE");
+        char *dxf_entity_name = dxf_strdup ("LINE");
 
         /* Do some basic checks. */
         if (fp == NULL)
@@ -582,7 +464,7 @@ dxf_line_write
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (line == NULL)
@@ -591,46 +473,46 @@ dxf_line_write
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
-        if ((line->p0->x0 == line->p1->x0)
-                && (line->p0->y0 == line->p1->y0)
-                && (line->p0->z0 == line->p1->z0))
+        if ((line->p0.x == line->p1.x)
+                && (line->p0.y == line->p1.y)
+                && (line->p0.z == line->p1.z))
         {
                 fprintf (stderr,
-                  (_("Error in %s () start point and end point are identical for the %s entity with id-code: %x\n")),
+                  (_("Error in %s () start point and end point are identical for the %s entity with id-code: %" PRIx64 "\n")),
                   __FUNCTION__, dxf_entity_name, line->id_code);
                 dxf_entity_skip (dxf_entity_name);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (strcmp (line->linetype, "") == 0)
         {
                 fprintf (stderr,
-                  (_("Warning in %s () empty linetype string for the %s entity with id-code: %x\n")),
+                  (_("Warning in %s () empty linetype string for the %s entity with id-code: %" PRIx64 "\n")),
                   __FUNCTION__, dxf_entity_name, line->id_code);
                 fprintf (stderr,
                   (_("    %s entity is relocated to layer 0\n")),
                   dxf_entity_name);
-                line->linetype = strdup (DXF_DEFAULT_LINETYPE);
+                line->linetype = dxf_strdup (DXF_DEFAULT_LINETYPE);
         }
         if (strcmp (line->layer, "") == 0)
         {
                 fprintf (stderr,
-                  (_("Warning in %s () empty layer string for the %s entity with id-code: %x\n")),
+                  (_("Warning in %s () empty layer string for the %s entity with id-code: %" PRIx64 "\n")),
                   __FUNCTION__, dxf_entity_name, line->id_code);
                 fprintf (stderr,
                   (_("    %s entity is relocated to layer 0\n")),
                   dxf_entity_name);
-                line->layer = strdup (DXF_DEFAULT_LAYER);
+                line->layer = dxf_strdup (DXF_DEFAULT_LAYER);
         }
         /* Start writing output. */
-        fprintf (fp->fp, "  0\n%s\n", dxf_entity_name);
-        if (line->id_code != -1)
+        dxf_write_string (fp, 0, dxf_entity_name);
+        if (line->id_code != DXF_HANDLE_NONE)
         {
-                fprintf (fp->fp, "  5\n%x\n", line->id_code);
+                dxf_write_hex (fp, 5, line->id_code);
         }
         /*!
          * \todo for version R14.\n
@@ -642,76 +524,76 @@ dxf_line_write
          * 102 groups are application defined (optional).\n\n
          * End of group, "}" (optional), with Group code 102.
          */
-        if ((strcmp (line->dictionary_owner_soft, "") != 0)
+        if ((line->dictionary_owner_soft != 0)
           && (fp->acad_version_number >= AutoCAD_14))
         {
-                fprintf (fp->fp, "102\n{ACAD_REACTORS\n");
-                fprintf (fp->fp, "330\n%s\n", line->dictionary_owner_soft);
-                fprintf (fp->fp, "102\n}\n");
+                dxf_write_string (fp, 102, "{ACAD_REACTORS");
+                dxf_write_hex (fp, 330, line->dictionary_owner_soft);
+                dxf_write_string (fp, 102, "}");
         }
-        if ((strcmp (line->dictionary_owner_hard, "") != 0)
+        if ((line->dictionary_owner_hard != 0)
           && (fp->acad_version_number >= AutoCAD_14))
         {
-                fprintf (fp->fp, "102\n{ACAD_XDICTIONARY\n");
-                fprintf (fp->fp, "360\n%s\n", line->dictionary_owner_hard);
-                fprintf (fp->fp, "102\n}\n");
+                dxf_write_string (fp, 102, "{ACAD_XDICTIONARY");
+                dxf_write_hex (fp, 360, line->dictionary_owner_hard);
+                dxf_write_string (fp, 102, "}");
         }
-        if ((strcmp (line->object_owner_soft, "") != 0)
+        if ((line->object_owner_soft != 0)
           && (fp->acad_version_number >= AutoCAD_2000))
         {
-                fprintf (fp->fp, "330\n%s\n", line->object_owner_soft);
+                dxf_write_hex (fp, 330, line->object_owner_soft);
         }
         if (fp->acad_version_number >= AutoCAD_13)
         {
-                fprintf (fp->fp, "100\nAcDbEntity\n");
+                dxf_write_string (fp, 100, "AcDbEntity");
         }
         if (line->paperspace == DXF_PAPERSPACE)
         {
-                fprintf (fp->fp, " 67\n%hd\n", (int16_t) DXF_PAPERSPACE);
+                dxf_write_int (fp, 67, (int16_t) DXF_PAPERSPACE);
         }
-        fprintf (fp->fp, "  8\n%s\n", line->layer);
+        dxf_write_string (fp, 8, line->layer);
         if (strcmp (line->linetype, DXF_DEFAULT_LINETYPE) != 0)
         {
-                fprintf (fp->fp, "  6\n%s\n", line->linetype);
+                dxf_write_string (fp, 6, line->linetype);
         }
         if ((fp->acad_version_number >= AutoCAD_2008)
-          && (strcmp (line->material, "") != 0))
+          && (line->material != 0))
         {
-                fprintf (fp->fp, "347\n%s\n", line->material);
+                dxf_write_hex (fp, 347, line->material);
         }
         if (line->color != DXF_COLOR_BYLAYER)
         {
-                fprintf (fp->fp, " 62\n%hd\n", line->color);
+                dxf_write_int (fp, 62, line->color);
         }
         if (fp->acad_version_number >= AutoCAD_2002)
         {
-                fprintf (fp->fp, "370\n%hd\n", line->lineweight);
+                dxf_write_int (fp, 370, line->lineweight);
         }
         if ((fp->acad_version_number <= AutoCAD_11)
           && DXF_FLATLAND
           && (line->elevation != 0.0))
         {
-                fprintf (fp->fp, " 38\n%f\n", line->elevation);
+                dxf_write_double (fp, 38, line->elevation);
         }
         if (line->thickness != 0.0)
         {
-                fprintf (fp->fp, " 39\n%f\n", line->thickness);
+                dxf_write_double (fp, 39, line->thickness);
         }
         if (line->linetype_scale != 1.0)
         {
-                fprintf (fp->fp, " 48\n%f\n", line->linetype_scale);
+                dxf_write_double (fp, 48, line->linetype_scale);
         }
         if (line->visibility != 0)
         {
-                fprintf (fp->fp, " 60\n%hd\n", line->visibility);
+                dxf_write_int (fp, 60, line->visibility);
         }
         if ((fp->acad_version_number >= AutoCAD_2000)
           && (line->graphics_data_size > 0))
         {
 #ifdef BUILD_64
-                fprintf (fp->fp, "160\n%" PRIi32 "\n", line->graphics_data_size);
+                dxf_write_int (fp, 160, line->graphics_data_size);
 #else
-                fprintf (fp->fp, " 92\n%" PRIi32 "\n", line->graphics_data_size);
+                dxf_write_int (fp, 92, line->graphics_data_size);
 #endif
                 if (line->binary_graphics_data != NULL)
                 {
@@ -719,43 +601,43 @@ dxf_line_write
                         iter = (DxfBinaryData *) line->binary_graphics_data;
                         while (iter != NULL)
                         {
-                                fprintf (fp->fp, "310\n%s\n", iter->data_line);
+                                dxf_binary_data_write (fp, iter);
                                 iter = (DxfBinaryData *) iter->next;
                         }
                 }
         }
         if (fp->acad_version_number >= AutoCAD_2004)
         {
-                fprintf (fp->fp, "420\n%" PRIi32 "\n", line->color_value);
-                fprintf (fp->fp, "430\n%s\n", line->color_name);
-                fprintf (fp->fp, "440\n%" PRIi32 "\n", line->transparency);
+                dxf_write_int (fp, 420, line->color_value);
+                dxf_write_string (fp, 430, line->color_name);
+                dxf_write_int (fp, 440, line->transparency);
         }
         if (fp->acad_version_number >= AutoCAD_2009)
         {
-                fprintf (fp->fp, "390\n%s\n", line->plot_style_name);
-                fprintf (fp->fp, "284\n%hd\n", line->shadow_mode);
+                dxf_write_hex (fp, 390, line->plot_style_name);
+                dxf_write_int (fp, 284, line->shadow_mode);
         }
         if (fp->acad_version_number >= AutoCAD_13)
         {
-                fprintf (fp->fp, "100\nAcDbLine\n");
+                dxf_write_string (fp, 100, "AcDbLine");
         }
-        fprintf (fp->fp, " 10\n%f\n", line->p0->x0);
-        fprintf (fp->fp, " 20\n%f\n", line->p0->y0);
-        fprintf (fp->fp, " 30\n%f\n", line->p0->z0);
-        fprintf (fp->fp, " 11\n%f\n", line->p1->x0);
-        fprintf (fp->fp, " 21\n%f\n", line->p1->y0);
-        fprintf (fp->fp, " 31\n%f\n", line->p1->z0);
+        dxf_write_double (fp, 10, line->p0.x);
+        dxf_write_double (fp, 20, line->p0.y);
+        dxf_write_double (fp, 30, line->p0.z);
+        dxf_write_double (fp, 11, line->p1.x);
+        dxf_write_double (fp, 21, line->p1.y);
+        dxf_write_double (fp, 31, line->p1.z);
         if ((fp->acad_version_number >= AutoCAD_12)
                 && (line->extr_x0 != 0.0)
                 && (line->extr_y0 != 0.0)
                 && (line->extr_z0 != 1.0))
         {
-                fprintf (fp->fp, "210\n%f\n", line->extr_x0);
-                fprintf (fp->fp, "220\n%f\n", line->extr_y0);
-                fprintf (fp->fp, "230\n%f\n", line->extr_z0);
+                dxf_write_double (fp, 210, line->extr_x0);
+                dxf_write_double (fp, 220, line->extr_y0);
+                dxf_write_double (fp, 230, line->extr_z0);
         }
         /* Clean up. */
-        free (dxf_entity_name);
+        dxf_free (dxf_entity_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -796,18 +678,11 @@ dxf_line_free
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        free (line->linetype);
-        free (line->layer);
+        dxf_string_free (line->linetype);
+        dxf_string_free (line->layer);
         dxf_binary_data_free_list (line->binary_graphics_data);
-        free (line->dictionary_owner_soft);
-        free (line->object_owner_soft);
-        free (line->material);
-        free (line->dictionary_owner_hard);
-        free (line->plot_style_name);
-        free (line->color_name);
-        dxf_point_free (line->p0);
-        dxf_point_free (line->p1);
-        free (line);
+        dxf_string_free (line->color_name);
+        dxf_free (line);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -853,7 +728,7 @@ dxf_line_free_list
  *
  * \return ID code.
  */
-int
+uint64_t
 dxf_line_get_id_code
 (
         DxfLine *line
@@ -871,12 +746,6 @@ dxf_line_get_id_code
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (line->id_code < 0)
-        {
-                fprintf (stderr,
-                  (_("Warning in %s () a negative value was found.\n")),
-                  __FUNCTION__);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -892,7 +761,7 @@ dxf_line_set_id_code
 (
         DxfLine *line,
                 /*!< a pointer to a DXF \c LINE entity. */
-        int id_code
+        uint64_t id_code
                 /*!< Identification number for the entity.\n
                  * This is to be an unique (sequential) number in the DXF
                  * file. */
@@ -909,12 +778,6 @@ dxf_line_set_id_code
                   __FUNCTION__);
                 return (NULL);
         }
-        if (id_code < 0)
-        {
-                fprintf (stderr,
-                  (_("Warning in %s () a negative value was passed.\n")),
-                  __FUNCTION__);
-        }
         line->id_code = id_code;
 #if DEBUG
         DXF_DEBUG_END
@@ -956,7 +819,7 @@ dxf_line_get_linetype
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (line->linetype));
+        return (dxf_strdup (line->linetype));
 }
 
 
@@ -990,7 +853,7 @@ dxf_line_set_linetype
                   __FUNCTION__);
                 return (NULL);
         }
-        line->linetype = strdup (linetype);
+        line->linetype = dxf_strdup (linetype);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1031,7 +894,7 @@ dxf_line_get_layer
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (line->layer));
+        return (dxf_strdup (line->layer));
 }
 
 
@@ -1065,7 +928,7 @@ dxf_line_set_layer
                   __FUNCTION__);
                 return (NULL);
         }
-        line->layer = strdup (layer);
+        line->layer = dxf_strdup (layer);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1791,10 +1654,8 @@ dxf_line_set_binary_graphics_data
  * \c LINE entity.
  *
  * \return soft pointer to the dictionary owner.
- *
- * \warning No checks are performed on the returned pointer (string).
  */
-char *
+uint64_t
 dxf_line_get_dictionary_owner_soft
 (
         DxfLine *line
@@ -1810,19 +1671,12 @@ dxf_line_get_dictionary_owner_soft
                 fprintf (stderr,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
-                return (NULL);
-        }
-        if (line->dictionary_owner_soft ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
+                return (0);
         }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (line->dictionary_owner_soft));
+        return (line->dictionary_owner_soft);
 }
 
 
@@ -1835,8 +1689,8 @@ dxf_line_set_dictionary_owner_soft
 (
         DxfLine *line,
                 /*!< a pointer to a DXF \c LINE entity. */
-        char *dictionary_owner_soft
-                /*!< a string containing the pointer to the
+        uint64_t dictionary_owner_soft
+                /*!< the handle of the
                  * dictionary_owner_soft for the entity. */
 )
 {
@@ -1851,14 +1705,7 @@ dxf_line_set_dictionary_owner_soft
                   __FUNCTION__);
                 return (NULL);
         }
-        if (dictionary_owner_soft == NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was passed.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
-        line->dictionary_owner_soft = strdup (dictionary_owner_soft);
+        line->dictionary_owner_soft = dictionary_owner_soft;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1870,12 +1717,10 @@ dxf_line_set_dictionary_owner_soft
  * \brief Get the pointer to the \c material from a DXF \c LINE
  * entity.
  *
- * \return a pointer to \c material when successful, or \c NULL when an
+ * \return the handle \c material when successful, or 0 when an
  * error occurred.
- *
- * \warning No checks are performed on the returned pointer.
  */
-char *
+uint64_t
 dxf_line_get_material
 (
         DxfLine *line
@@ -1891,19 +1736,12 @@ dxf_line_get_material
                 fprintf (stderr,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
-                return (NULL);
-        }
-        if (line->material ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
+                return (0);
         }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (line->material));
+        return (line->material);
 }
 
 
@@ -1919,8 +1757,8 @@ dxf_line_set_material
 (
         DxfLine *line,
                 /*!< a pointer to a DXF \c LINE entity. */
-        char *material
-                /*!< a string containing the pointer to the \c
+        uint64_t material
+                /*!< the handle of the \c
                  * material for the entity. */
 )
 {
@@ -1935,14 +1773,7 @@ dxf_line_set_material
                   __FUNCTION__);
                 return (NULL);
         }
-        if (material == NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was passed.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
-        line->material = strdup (material);
+        line->material = material;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1955,10 +1786,8 @@ dxf_line_set_material
  * \c LINE entity.
  *
  * \return hard pointer to the dictionary owner.
- *
- * \warning No checks are performed on the returned pointer (string).
  */
-char *
+uint64_t
 dxf_line_get_dictionary_owner_hard
 (
         DxfLine *line
@@ -1974,19 +1803,12 @@ dxf_line_get_dictionary_owner_hard
                 fprintf (stderr,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
-                return (NULL);
-        }
-        if (line->dictionary_owner_hard ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
+                return (0);
         }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (line->dictionary_owner_hard));
+        return (line->dictionary_owner_hard);
 }
 
 
@@ -1999,8 +1821,8 @@ dxf_line_set_dictionary_owner_hard
 (
         DxfLine *line,
                 /*!< a pointer to a DXF \c LINE entity. */
-        char *dictionary_owner_hard
-                /*!< a string containing the pointer to the
+        uint64_t dictionary_owner_hard
+                /*!< the handle of the
                  * dictionary_owner_hard for the entity. */
 )
 {
@@ -2015,14 +1837,7 @@ dxf_line_set_dictionary_owner_hard
                   __FUNCTION__);
                 return (NULL);
         }
-        if (dictionary_owner_hard == NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was passed.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
-        line->dictionary_owner_hard = strdup (dictionary_owner_hard);
+        line->dictionary_owner_hard = dictionary_owner_hard;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2098,10 +1913,10 @@ dxf_line_set_lineweight
 /*!
  * \brief Get the \c plot_style_name from a DXF \c LINE entity.
  *
- * \return a pointer to \c plot_style_name when sucessful, or \c NULL
+ * \return the handle \c plot_style_name when sucessful, or 0
  * when an error occurred.
  */
-char *
+uint64_t
 dxf_line_get_plot_style_name
 (
         DxfLine *line
@@ -2117,19 +1932,12 @@ dxf_line_get_plot_style_name
                 fprintf (stderr,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
-                return (NULL);
-        }
-        if (line->plot_style_name ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
+                return (0);
         }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (line->plot_style_name));
+        return (line->plot_style_name);
 }
 
 
@@ -2144,7 +1952,7 @@ dxf_line_set_plot_style_name
 (
         DxfLine *line,
                 /*!< a pointer to a DXF \c LINE entity. */
-        char *plot_style_name
+        uint64_t plot_style_name
                 /*!< a string containing the \c plot_style_name for the
                  * entity. */
 )
@@ -2160,14 +1968,7 @@ dxf_line_set_plot_style_name
                   __FUNCTION__);
                 return (NULL);
         }
-        if (plot_style_name == NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was passed.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
-        line->plot_style_name = strdup (plot_style_name);
+        line->plot_style_name = plot_style_name;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2274,7 +2075,7 @@ dxf_line_get_color_name
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (line->color_name));
+        return (dxf_strdup (line->color_name));
 }
 
 
@@ -2312,7 +2113,7 @@ dxf_line_set_color_name
                   __FUNCTION__);
                 return (NULL);
         }
-        line->color_name = strdup (color_name);
+        line->color_name = dxf_strdup (color_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2390,7 +2191,7 @@ dxf_line_set_transparency
  *
  * \return the start point \c p0.
  */
-DxfPoint *
+DxfVec3 *
 dxf_line_get_p0
 (
         DxfLine *line
@@ -2408,17 +2209,10 @@ dxf_line_get_p0
                   __FUNCTION__);
                 return (NULL);
         }
-        if (line->p0 == NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return ((DxfPoint *) line->p0);
+        return (&line->p0);
 }
 
 
@@ -2432,8 +2226,8 @@ dxf_line_set_p0
 (
         DxfLine *line,
                 /*!< a pointer to a DXF \c LINE entity. */
-        DxfPoint *p0
-                /*!< a pointer to a DXF \c POINT entity. */
+        DxfVec3 *p0
+                /*!< a pointer to the coordinates. */
 )
 {
 #ifdef DEBUG
@@ -2454,7 +2248,7 @@ dxf_line_set_p0
                   __FUNCTION__);
                 return (NULL);
         }
-        line->p0 = p0;
+        line->p0 = *p0;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2487,17 +2281,10 @@ dxf_line_get_x0
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (line->p0 == NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was passed.\n")),
-                  __FUNCTION__);
-                return (EXIT_FAILURE);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (line->p0->x0);
+        return (line->p0.x);
 }
 
 
@@ -2529,23 +2316,7 @@ dxf_line_set_x0
                   __FUNCTION__);
                 return (NULL);
         }
-        if (line->p0 == NULL)
-        {
-                fprintf (stderr,
-                  (_("Warning in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                fprintf (stderr,
-                  (_("Initializing a DxfPoint.\n")));
-                line->p0 = dxf_point_init (line->p0);
-                if (line->p0 == NULL)
-                {
-                        fprintf (stderr,
-                          (_("Error in %s () could not allocate memory.\n")),
-                          __FUNCTION__);
-                        return (NULL);
-                }
-        }
-        line->p0->x0 = x0;
+        line->p0.x = x0;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2578,17 +2349,10 @@ dxf_line_get_y0
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (line->p0 == NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (EXIT_FAILURE);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (line->p0->y0);
+        return (line->p0.y);
 }
 
 
@@ -2620,23 +2384,7 @@ dxf_line_set_y0
                   __FUNCTION__);
                 return (NULL);
         }
-        if (line->p0 == NULL)
-        {
-                fprintf (stderr,
-                  (_("Warning in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                fprintf (stderr,
-                  (_("Initializing a DxfPoint.\n")));
-                line->p0 = dxf_point_init (line->p0);
-                if (line->p0 == NULL)
-                {
-                        fprintf (stderr,
-                          (_("Error in %s () could not allocate memory.\n")),
-                          __FUNCTION__);
-                        return (NULL);
-                }
-        }
-        line->p0->y0 = y0;
+        line->p0.y = y0;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2669,17 +2417,10 @@ dxf_line_get_z0
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (line->p0 == NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (EXIT_FAILURE);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (line->p0->z0);
+        return (line->p0.z);
 }
 
 
@@ -2711,23 +2452,7 @@ dxf_line_set_z0
                   __FUNCTION__);
                 return (NULL);
         }
-        if (line->p0 == NULL)
-        {
-                fprintf (stderr,
-                  (_("Warning in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                fprintf (stderr,
-                  (_("Initializing a DxfPoint.\n")));
-                line->p0 = dxf_point_init (line->p0);
-                if (line->p0 == NULL)
-                {
-                        fprintf (stderr,
-                          (_("Error in %s () could not allocate memory.\n")),
-                          __FUNCTION__);
-                        return (NULL);
-                }
-        }
-        line->p0->z0 = z0;
+        line->p0.z = z0;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2740,7 +2465,7 @@ dxf_line_set_z0
  *
  * \return the end point \c p1.
  */
-DxfPoint *
+DxfVec3 *
 dxf_line_get_p1
 (
         DxfLine *line
@@ -2758,17 +2483,10 @@ dxf_line_get_p1
                   __FUNCTION__);
                 return (NULL);
         }
-        if (line->p1 == NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (line->p1);
+        return (&line->p1);
 }
 
 
@@ -2782,8 +2500,8 @@ dxf_line_set_p1
 (
         DxfLine *line,
                 /*!< a pointer to a DXF \c LINE entity. */
-        DxfPoint *p1
-                /*!< a pointer to a DXF \c POINT entity. */
+        DxfVec3 *p1
+                /*!< a pointer to the coordinates. */
 )
 {
 #ifdef DEBUG
@@ -2804,7 +2522,7 @@ dxf_line_set_p1
                   __FUNCTION__);
                 return (NULL);
         }
-        line->p1 = p1;
+        line->p1 = *p1;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2837,17 +2555,10 @@ dxf_line_get_x1
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (line->p1 == NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was passed.\n")),
-                  __FUNCTION__);
-                return (EXIT_FAILURE);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (line->p1->x0);
+        return (line->p1.x);
 }
 
 
@@ -2879,23 +2590,7 @@ dxf_line_set_x1
                   __FUNCTION__);
                 return (NULL);
         }
-        if (line->p1 == NULL)
-        {
-                fprintf (stderr,
-                  (_("Warning in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                fprintf (stderr,
-                  (_("Initializing a DxfPoint.\n")));
-                line->p1 = dxf_point_init (line->p1);
-                if (line->p1 == NULL)
-                {
-                        fprintf (stderr,
-                          (_("Error in %s () could not allocate memory.\n")),
-                          __FUNCTION__);
-                        return (NULL);
-                }
-        }
-        line->p1->x0 = x1;
+        line->p1.x = x1;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2928,17 +2623,10 @@ dxf_line_get_y1
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (line->p1 == NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (EXIT_FAILURE);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (line->p1->y0);
+        return (line->p1.y);
 }
 
 
@@ -2970,23 +2658,7 @@ dxf_line_set_y1
                   __FUNCTION__);
                 return (NULL);
         }
-        if (line->p1 == NULL)
-        {
-                fprintf (stderr,
-                  (_("Warning in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                fprintf (stderr,
-                  (_("Initializing a DxfPoint.\n")));
-                line->p1 = dxf_point_init (line->p1);
-                if (line->p1 == NULL)
-                {
-                        fprintf (stderr,
-                          (_("Error in %s () could not allocate memory.\n")),
-                          __FUNCTION__);
-                        return (NULL);
-                }
-        }
-        line->p1->y0 = y1;
+        line->p1.y = y1;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -3019,17 +2691,10 @@ dxf_line_get_z1
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (line->p1 == NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (EXIT_FAILURE);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (line->p1->z0);
+        return (line->p1.z);
 }
 
 
@@ -3061,23 +2726,7 @@ dxf_line_set_z1
                   __FUNCTION__);
                 return (NULL);
         }
-        if (line->p1 == NULL)
-        {
-                fprintf (stderr,
-                  (_("Warning in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                fprintf (stderr,
-                  (_("Initializing a DxfPoint.\n")));
-                line->p1 = dxf_point_init (line->p1);
-                if (line->p1 == NULL)
-                {
-                        fprintf (stderr,
-                          (_("Error in %s () could not allocate memory.\n")),
-                          __FUNCTION__);
-                        return (NULL);
-                }
-        }
-        line->p1->z0 = z1;
+        line->p1.z = z1;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -3317,9 +2966,9 @@ dxf_line_get_extrusion_vector_as_point
                   __FUNCTION__);
                 return (NULL);
         }
-        if ((line->p0->x0 == line->p1->x0)
-          && (line->p0->y0 == line->p1->y0)
-          && (line->p0->z0 == line->p1->z0))
+        if ((line->p0.x == line->p1.x)
+          && (line->p0.y == line->p1.y)
+          && (line->p0.z == line->p1.z))
         {
                 fprintf (stderr,
                   (_("Error in %s () a 3DLINE with points with identical coordinates were passed.\n")),
@@ -3515,7 +3164,7 @@ dxf_line_get_mid_point
 (
         DxfLine *line,
                 /*!< a pointer to a DXF \c LINE entity. */
-        int id_code,
+        uint64_t id_code,
                 /*!< Identification number for the entity.\n
                  * This is to be an unique (sequential) number in the DXF
                  * file. */
@@ -3542,9 +3191,9 @@ dxf_line_get_mid_point
                   __FUNCTION__);
                 return (NULL);
         }
-        if ((line->p0->x0 == line->p1->x0)
-          && (line->p0->y0 == line->p1->y0)
-          && (line->p0->z0 == line->p1->z0))
+        if ((line->p0.x == line->p1.x)
+          && (line->p0.y == line->p1.y)
+          && (line->p0.z == line->p1.z))
         {
                 fprintf (stderr,
                   (_("Error in %s () a 3DLINE with points with identical coordinates were passed.\n")),
@@ -3559,16 +3208,10 @@ dxf_line_get_mid_point
                 __FUNCTION__);
               return (NULL);
         }
-        if (id_code < 0)
-        {
-              fprintf (stderr,
-                  (_("Warning in %s () a negative value was passed.\n")),
-                __FUNCTION__);
-        }
         point->id_code = id_code;
-        point->x0 = (line->p0->x0 + line->p1->x0) / 2;
-        point->y0 = (line->p0->y0 + line->p1->y0) / 2;
-        point->z0 = (line->p0->z0 + line->p1->z0) / 2;
+        point->x0 = (line->p0.x + line->p1.x) / 2;
+        point->y0 = (line->p0.y + line->p1.y) / 2;
+        point->z0 = (line->p0.z + line->p1.z) / 2;
         switch (inheritance)
         {
                 case 0:
@@ -3577,25 +3220,19 @@ dxf_line_get_mid_point
                 case 1:
                         if (line->linetype != NULL)
                         {
-                                point->linetype = strdup (line->linetype);
+                                point->linetype = dxf_strdup (line->linetype);
                         }
                         if (line->layer != NULL)
                         {
-                                point->layer = strdup (line->layer);
+                                point->layer = dxf_strdup (line->layer);
                         }
                         point->thickness = line->thickness;
                         point->linetype_scale = line->linetype_scale;
                         point->visibility = line->visibility;
                         point->color = line->color;
                         point->paperspace = line->paperspace;
-                        if (line->dictionary_owner_soft != NULL)
-                        {
-                                point->dictionary_owner_soft = strdup (line->dictionary_owner_soft);
-                        }
-                        if (line->dictionary_owner_hard != NULL)
-                        {
-                                point->dictionary_owner_hard = strdup (line->dictionary_owner_hard);
-                        }
+                        point->dictionary_owner_soft = line->dictionary_owner_soft;
+                        point->dictionary_owner_hard = line->dictionary_owner_hard;
                         break;
                 default:
                         fprintf (stderr,
@@ -3638,9 +3275,9 @@ dxf_line_get_length
                   __FUNCTION__);
                 return (0.0);
         }
-        if ((line->p0->x0 == line->p1->x0)
-          && (line->p0->y0 == line->p1->y0)
-          && (line->p0->z0 == line->p1->z0))
+        if ((line->p0.x == line->p1.x)
+          && (line->p0.y == line->p1.y)
+          && (line->p0.z == line->p1.z))
         {
                 fprintf (stderr,
                   (_("Error in %s () endpoints with identical coordinates were passed.\n")),
@@ -3649,9 +3286,9 @@ dxf_line_get_length
         }
         length = sqrt
         (
-          ((line->p1->x0 - line->p0->x0) * (line->p1->x0 - line->p0->x0))
-          + ((line->p1->y0 - line->p0->y0) * (line->p1->y0 - line->p0->y0))
-          + ((line->p1->z0 - line->p0->z0) * (line->p1->z0 - line->p0->z0))
+          ((line->p1.x - line->p0.x) * (line->p1.x - line->p0.x))
+          + ((line->p1.y - line->p0.y) * (line->p1.y - line->p0.y))
+          + ((line->p1.z - line->p0.z) * (line->p1.z - line->p0.z))
         );
 #if DEBUG
         DXF_DEBUG_END
@@ -3675,7 +3312,7 @@ dxf_line_create_from_points
                 /*!< a pointer to a DXF \c POINT entity. */
         DxfPoint *p2,
                 /*!< a pointer to a DXF \c POINT entity. */
-        int id_code,
+        uint64_t id_code,
                 /*!< Identification number for the entity.\n
                  * This is to be an unique (sequential) number in the DXF
                  * file. */
@@ -3725,19 +3362,13 @@ dxf_line_create_from_points
                 __FUNCTION__);
               return (NULL);
         }
-        if (id_code < 0)
-        {
-              fprintf (stderr,
-                  (_("Warning in %s () a negative value was passed.\n")),
-                __FUNCTION__);
-        }
         line->id_code = id_code;
-        line->p0->x0 = p1->x0;
-        line->p0->y0 = p1->y0;
-        line->p0->z0 = p1->z0;
-        line->p1->x0 = p2->x0;
-        line->p1->y0 = p2->y0;
-        line->p1->z0 = p2->z0;
+        line->p0.x = p1->x0;
+        line->p0.y = p1->y0;
+        line->p0.z = p1->z0;
+        line->p1.x = p2->x0;
+        line->p1.y = p2->y0;
+        line->p1.z = p2->z0;
         switch (inheritance)
         {
                 case 0:
@@ -3761,27 +3392,15 @@ dxf_line_create_from_points
                         line-> shadow_mode = p1->shadow_mode;
                         /*! \todo Do a deep copy of \c binary_graphics_data. */
                         line->binary_graphics_data = p1->binary_graphics_data;
-                        if (p1->dictionary_owner_soft != NULL)
-                        {
-                                line->dictionary_owner_soft = strdup (p1->dictionary_owner_soft);
-                        }
-                        if (p1->material != NULL)
-                        {
-                                line->material = strdup (p1->material);
-                        }
-                        if (p1->dictionary_owner_hard != NULL)
-                        {
-                                line->dictionary_owner_hard = strdup (p1->dictionary_owner_hard);
-                        }
+                        line->dictionary_owner_soft = p1->dictionary_owner_soft;
+                        line->material = p1->material;
+                        line->dictionary_owner_hard = p1->dictionary_owner_hard;
                         line->lineweight = p1->lineweight;
-                        if (p1->plot_style_name != NULL)
-                        {
-                                line->plot_style_name = strdup (p1->plot_style_name);
-                        }
+                        line->plot_style_name = p1->plot_style_name;
                         line->color_value = p1->color_value;
                         if (p1->color_name != NULL)
                         {
-                                line->color_name = strdup (p1->color_name);
+                                line->color_name = dxf_strdup (p1->color_name);
                         }
                         line->transparency = p1->transparency;
                         break;
@@ -3803,27 +3422,15 @@ dxf_line_create_from_points
                         line-> shadow_mode = p2->shadow_mode;
                         /*! \todo Do a deep copy of \c binary_graphics_data. */
                         line->binary_graphics_data = p2->binary_graphics_data;
-                        if (p2->dictionary_owner_soft != NULL)
-                        {
-                                line->dictionary_owner_soft = strdup (p2->dictionary_owner_soft);
-                        }
-                        if (p2->material != NULL)
-                        {
-                                line->material = strdup (p2->material);
-                        }
-                        if (p2->dictionary_owner_hard != NULL)
-                        {
-                                line->dictionary_owner_hard = strdup (p2->dictionary_owner_hard);
-                        }
+                        line->dictionary_owner_soft = p2->dictionary_owner_soft;
+                        line->material = p2->material;
+                        line->dictionary_owner_hard = p2->dictionary_owner_hard;
                         line->lineweight = p2->lineweight;
-                        if (p2->plot_style_name != NULL)
-                        {
-                                line->plot_style_name = strdup (p2->plot_style_name);
-                        }
+                        line->plot_style_name = p2->plot_style_name;
                         line->color_value = p2->color_value;
                         if (p2->color_name != NULL)
                         {
-                                line->color_name = strdup (p2->color_name);
+                                line->color_name = dxf_strdup (p2->color_name);
                         }
                         line->transparency = p2->transparency;
                         break;
@@ -3842,4 +3449,98 @@ dxf_line_create_from_points
 }
 
 
+/*!
+ * \brief Get the bounding box of a DXF \c LINE.
+ *
+ * The box of the start point and the end point of \c line.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_line_get_bbox
+(
+        DxfLine *line,
+                /*!< a pointer to a DXF \c LINE entity. */
+        DxfBbox *bbox
+                /*!< a pointer to the libDXF bounding box to fill. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        /* Do some basic checks. */
+        if ((line == NULL) || (bbox == NULL))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        dxf_bbox_init (bbox);
+        dxf_bbox_add_point (bbox, line->p0.x, line->p0.y, line->p0.z);
+        dxf_bbox_add_point (bbox, line->p1.x, line->p1.y, line->p1.z);
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Transform a DXF \c LINE entity in place.
+ *
+ * The start point and end point are in world coordinates, the
+ * extrusion direction and thickness follow the transformation.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_line_transform
+(
+        DxfLine *line,
+                /*!< a pointer to a DXF \c LINE entity. */
+        DxfTransform *transform
+                /*!< a pointer to a libDXF affine transformation. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfVec3 extrusion;
+        double length;
+
+        /* Do some basic checks. */
+        if ((line == NULL) || (transform == NULL))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        dxf_transform_apply_point (transform, &line->p0, &line->p0);
+        dxf_transform_apply_point (transform, &line->p1, &line->p1);
+        /* The thickness is measured along the extrusion direction. */
+        extrusion.x = line->extr_x0;
+        extrusion.y = line->extr_y0;
+        extrusion.z = line->extr_z0;
+        dxf_transform_apply_vector (transform, &extrusion, &extrusion);
+        length = sqrt ((extrusion.x * extrusion.x)
+          + (extrusion.y * extrusion.y)
+          + (extrusion.z * extrusion.z));
+        if (length > 0.0)
+        {
+                line->extr_x0 = extrusion.x / length;
+                line->extr_y0 = extrusion.y / length;
+                line->extr_z0 = extrusion.z / length;
+                line->thickness *= length;
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (EXIT_SUCCESS);
+}
+
+
 /* EOF */
@@ -45,6 +45,7 @@
 
 #include "global.h"
 #include "binary_data.h"
+#include "transform.h"
 #include "point.h"
 
 
@@ -60,7 +61,7 @@ typedef struct
 dxf_line_struct
 {
         /* Members common for all DXF drawable entities. */
-        int id_code;
+        uint64_t id_code;
                 /*!< Identification number for the entity.\n
                  * This is to be an unique (sequential) number in the DXF
                  * file.\n
@@ -133,20 +134,20 @@ dxf_line_struct
                  * (optional).\n
                  * Group code = 310.\n
                  * \since Introduced in version R2000. */
-        char *dictionary_owner_soft;
+        uint64_t dictionary_owner_soft;
                 /*!< Soft-pointer ID/handle to owner dictionary (optional).\n
                  * Group code = 330.\n
                  * \since Introduced in version R14. */
-        char *object_owner_soft;
+        uint64_t object_owner_soft;
                 /*!< Soft-pointer ID/handle  to owner BLOCK_RECORD object.\n
                  * Group code = 330.\n
                  * \since Introduced in version R2000. */
-        char *material;
+        uint64_t material;
                 /*!< Hard-pointer ID/handle to material object (present if
                  * not BYLAYER).\n
                  * Group code = 347.\n
                  * \since Introduced in version R2008. */
-        char *dictionary_owner_hard;
+        uint64_t dictionary_owner_hard;
                 /*!< Hard owner ID/handle to owner dictionary (optional).\n
                  * Group code = 360.\n
                  * \since Introduced in version R14. */
@@ -155,7 +156,7 @@ dxf_line_struct
                  * Stored and moved around as a 16-bit integer.\n
                  * Group code = 370.\n
                  * \since Introduced in version R2002. */
-        char *plot_style_name;
+        uint64_t plot_style_name;
                 /*!< Hard pointer ID / handle of PlotStyleName object.\n
                  * Group code = 390.\n
                  * \since Introduced in version R2009. */
@@ -188,10 +189,10 @@ dxf_line_struct
                  * Group code = 440.\n
                  * \since Introduced in version R2004. */
         /* Specific members for a DXF line. */
-        DxfPoint *p0;
+        DxfVec3 p0;
                 /*!< Start point for the line.\n
                  * Group codes = 10, 20 and 30.*/
-        DxfPoint *p1;
+        DxfVec3 p1;
                 /*!< End point for the line.\n
                  * Group codes = 11, 21 and 31.*/
         double extr_x0;
@@ -218,8 +219,8 @@ DxfLine *dxf_line_read (DxfFile *fp, DxfLine *line);
 int dxf_line_write (DxfFile *fp, DxfLine *line);
 int dxf_line_free (DxfLine *line);
 void dxf_line_free_list (DxfLine *lines);
-int dxf_line_get_id_code (DxfLine *line);
-DxfLine *dxf_line_set_id_code (DxfLine *line, int id_code);
+uint64_t dxf_line_get_id_code (DxfLine *line);
+DxfLine *dxf_line_set_id_code (DxfLine *line, uint64_t id_code);
 char *dxf_line_get_linetype (DxfLine *line);
 DxfLine *dxf_line_set_linetype (DxfLine *line, char *linetype);
 char *dxf_line_get_layer (DxfLine *line);
@@ -242,32 +243,32 @@ int16_t dxf_line_get_shadow_mode (DxfLine *line);
 DxfLine *dxf_line_set_shadow_mode (DxfLine *line, int16_t shadow_mode);
 DxfBinaryData *dxf_line_get_binary_graphics_data (DxfLine *line);
 DxfLine *dxf_line_set_binary_graphics_data (DxfLine *line, DxfBinaryData *data);
-char *dxf_line_get_dictionary_owner_soft (DxfLine *line);
-DxfLine *dxf_line_set_dictionary_owner_soft (DxfLine *line, char *dictionary_owner_soft);
-char *dxf_line_get_material (DxfLine *line);
-DxfLine *dxf_line_set_material (DxfLine *line, char *material);
-char *dxf_line_get_dictionary_owner_hard (DxfLine *line);
-DxfLine *dxf_line_set_dictionary_owner_hard (DxfLine *line, char *dictionary_owner_hard);
+uint64_t dxf_line_get_dictionary_owner_soft (DxfLine *line);
+DxfLine *dxf_line_set_dictionary_owner_soft (DxfLine *line, uint64_t dictionary_owner_soft);
+uint64_t dxf_line_get_material (DxfLine *line);
+DxfLine *dxf_line_set_material (DxfLine *line, uint64_t material);
+uint64_t dxf_line_get_dictionary_owner_hard (DxfLine *line);
+DxfLine *dxf_line_set_dictionary_owner_hard (DxfLine *line, uint64_t dictionary_owner_hard);
 int16_t dxf_line_get_lineweight (DxfLine *line);
 DxfLine *dxf_line_set_lineweight (DxfLine *line, int16_t lineweight);
-char *dxf_line_get_plot_style_name (DxfLine *line);
-DxfLine *dxf_line_set_plot_style_name (DxfLine *line, char *plot_style_name);
+uint64_t dxf_line_get_plot_style_name (DxfLine *line);
+DxfLine *dxf_line_set_plot_style_name (DxfLine *line, uint64_t plot_style_name);
 int32_t dxf_line_get_color_value (DxfLine *line);
 DxfLine *dxf_line_set_color_value (DxfLine *line, int32_t color_value);
 char *dxf_line_get_color_name (DxfLine *line);
 DxfLine *dxf_line_set_color_name (DxfLine *line, char *color_name);
 int32_t dxf_line_get_transparency (DxfLine *line);
 DxfLine *dxf_line_set_transparency (DxfLine *line, int32_t transparency);
-DxfPoint *dxf_line_get_p0 (DxfLine *line);
-DxfLine *dxf_line_set_p0 (DxfLine *line, DxfPoint *p0);
+DxfVec3 *dxf_line_get_p0 (DxfLine *line);
+DxfLine *dxf_line_set_p0 (DxfLine *line, DxfVec3 *p0);
 double dxf_line_get_x0 (DxfLine *line);
 DxfLine *dxf_line_set_x0 (DxfLine *line, double x0);
 double dxf_line_get_y0 (DxfLine *line);
 DxfLine *dxf_line_set_y0 (DxfLine *line, double y0);
 double dxf_line_get_z0 (DxfLine *line);
 DxfLine *dxf_line_set_z0 (DxfLine *line, double z0);
-DxfPoint *dxf_line_get_p1 (DxfLine *line);
-DxfLine *dxf_line_set_p1 (DxfLine *line, DxfPoint *p1);
+DxfVec3 *dxf_line_get_p1 (DxfLine *line);
+DxfLine *dxf_line_set_p1 (DxfLine *line, DxfVec3 *p1);
 double dxf_line_get_x1 (DxfLine *line);
 DxfLine *dxf_line_set_x1 (DxfLine *line, double x1);
 double dxf_line_get_y1 (DxfLine *line);
@@ -285,9 +286,11 @@ DxfLine *dxf_line_set_extrusion_vector (DxfLine *line, double extr_x0, double ex
 DxfLine *dxf_line_get_next (DxfLine *line);
 DxfLine *dxf_line_set_next (DxfLine *line, DxfLine *next);
 DxfLine *dxf_line_get_last (DxfLine *line);
-DxfPoint *dxf_line_get_mid_point (DxfLine *line, int id_code, int inheritance);
+DxfPoint *dxf_line_get_mid_point (DxfLine *line, uint64_t id_code, int inheritance);
 double dxf_line_get_length (DxfLine *line);
-DxfLine *dxf_line_create_from_points (DxfPoint *p1, DxfPoint *p2, int id_code, int inheritance);
+DxfLine *dxf_line_create_from_points (DxfPoint *p1, DxfPoint *p2, uint64_t id_code, int inheritance);
+int dxf_line_get_bbox (DxfLine *line, DxfBbox *bbox);
+int dxf_line_transform (DxfLine *line, DxfTransform *transform);
 
 
 #ifdef __cplusplus
@@ -59,7 +59,7 @@ dxf_ltype_new ()
         size = sizeof (DxfLType);
         /* avoid malloc of 0 bytes */
         if (size == 0) size = 1;
-        if ((ltype = malloc (size)) == NULL)
+        if ((ltype = dxf_malloc (size)) == NULL)
         {
                 fprintf (stderr,
                   (_("Error in %s () could not allocate memory for a DxfArc struct.\n")),
@@ -110,15 +110,15 @@ dxf_ltype_init
               return (NULL);
         }
         /* Assign initial values to members. */
-        ltype->id_code = 0;
-        ltype->linetype_name = strdup ("");
-        ltype->description = strdup ("");
+        ltype->id_code = DXF_HANDLE_NONE;
+        ltype->linetype_name = dxf_strdup ("");
+        ltype->description = dxf_strdup ("");
         ltype->total_pattern_length = 0.0;
         ltype->number_of_linetype_elements = 0;
         ltype->flag = 0;
         ltype->alignment = 65;
-        ltype->dictionary_owner_soft = strdup ("");
-        ltype->dictionary_owner_hard = strdup ("");
+        ltype->dictionary_owner_soft = 0;
+        ltype->dictionary_owner_hard = 0;
         /* Initialize new structs for the following members later,
          * when they are required and when we have content. */
         ltype->complex_text_string = NULL;
@@ -161,7 +161,8 @@ dxf_ltype_read
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        char *temp_string = NULL;
+        char temp_string[DXF_MAX_STRING_LENGTH];
+        int group_code;
         int element;
 
         /* Do some basic checks. */
@@ -170,8 +171,6 @@ dxf_ltype_read
                 fprintf (stderr,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
-                /* Clean up. */
-                free (temp_string);
                 return (NULL);
         }
         if (ltype == NULL)
@@ -182,182 +181,152 @@ dxf_ltype_read
                 ltype = dxf_ltype_init (ltype);
         }
         element = 0;
-        (fp->line_number)++;
-        fscanf (fp->fp, "%[^\n]", temp_string);
-        while (strcmp (temp_string, "0") != 0)
+        while ((dxf_read_group_code (fp, &group_code) == EXIT_SUCCESS)
+          && (group_code != 0))
         {
-                if (ferror (fp->fp))
+                if (dxf_read_error (fp))
                 {
                         fprintf (stderr,
                           (_("Error in %s () while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
-                        fclose (fp->fp);
-                        /* Clean up. */
-                        free (temp_string);
                         return (NULL);
                 }
-                if (strcmp (temp_string, "5") == 0)
-                {
-                        /* Now follows a string containing a sequential
-                         * id number. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%x\n", (uint *) &ltype->id_code);
-                }
-                else if (strcmp (temp_string, "2") == 0)
-                {
-                        /* Now follows a string containing a linetype
-                         * name. */
-                        (fp->line_number)++;
-                        /*! \todo add code for proper implementation. */
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, ltype->linetype_name);
-                }
-                else if (strcmp (temp_string, "3") == 0)
-                {
-                        /* Now follows a string containing a description. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, ltype->description);
-                }
-                else if (strcmp (temp_string, "9") == 0)
-                {
-                        /* Now follows a string containing a complex
-                         * text string (multiple entries possible). */
-                        (fp->line_number)++;
-                        /*! \todo add code for proper implementation. */
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, ltype->complex_text_string->value);
-                }
-                else if (strcmp (temp_string, "40") == 0)
-                {
-                        /* Now follows a string containing the total
-                         * pattern length value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &ltype->total_pattern_length);
-                }
-                else if (strcmp (temp_string, "44") == 0)
-                {
-                        /* Now follows a string containing a complex
-                         * x offset value (multiple entries possible). */
-                        (fp->line_number)++;
-                        /*! \todo add code for proper implementation. */
-//                        fscanf (fp->fp, "%lf\n", ltype->complex_x_offset);
-                }
-                else if (strcmp (temp_string, "45") == 0)
-                {
-                        /* Now follows a string containing a complex
-                         * y offset value (multiple entries possible). */
-                        (fp->line_number)++;
-                        /*! \todo add code for proper implementation. */
-//                        fscanf (fp->fp, "%lf\n", &ltype->complex_y_offset);
-                }
-                else if (strcmp (temp_string, "46") == 0)
-                {
-                        /* Now follows a string containing a complex
-                         * scale value (multiple entries possible). */
-                        (fp->line_number)++;
-                        /*! \todo add code for proper implementation. */
-//                        fscanf (fp->fp, "%lf\n", &ltype->complex_scale);
-                }
-                else if (strcmp (temp_string, "49") == 0)
+                switch (group_code)
                 {
-                        /* Now follows a string containing a dash length
-                         * value (multiple entries possible). */
-                        (fp->line_number)++;
-                        /*! \todo add code for proper implementation. */
-//                        fscanf (fp->fp, "%lf\n", &ltype->dash_length);
+                        case 5:
+                                /* Now follows a string containing a sequential
+                                 * id number. */
+                                dxf_read_handle (fp, &ltype->id_code);
+                                break;
+                        case 2:
+                                /* Now follows a string containing a linetype
+                                 * name. */
+                                /*! \todo add code for proper implementation. */
+                                dxf_read_string (fp, &ltype->linetype_name);
+                                break;
+                        case 3:
+                                /* Now follows a string containing a description. */
+                                dxf_read_string (fp, &ltype->description);
+                                break;
+                        case 9:
+                                /* Now follows a string containing a complex
+                                 * text string (multiple entries possible). */
+                                /*! \todo add code for proper implementation. */
+                                dxf_read_string (fp, &ltype->complex_text_string->value);
+                                break;
+                        case 40:
+                                /* Now follows a string containing the total
+                                 * pattern length value. */
+                                dxf_read_double (fp, &ltype->total_pattern_length);
+                                break;
+                        case 44:
+                                /* Now follows a string containing a complex
+                                 * x offset value (multiple entries possible). */
+                                dxf_read_line (temp_string, fp);
+                                /*! \todo add code for proper implementation. */
+//                        dxf_read_double (fp, ltype->complex_x_offset);
+                                break;
+                        case 45:
+                                /* Now follows a string containing a complex
+                                 * y offset value (multiple entries possible). */
+                                dxf_read_line (temp_string, fp);
+                                /*! \todo add code for proper implementation. */
+//                        dxf_read_double (fp, &ltype->complex_y_offset);
+                                break;
+                        case 46:
+                                /* Now follows a string containing a complex
+                                 * scale value (multiple entries possible). */
+                                dxf_read_line (temp_string, fp);
+                                /*! \todo add code for proper implementation. */
+//                        dxf_read_double (fp, &ltype->complex_scale);
+                                break;
+                        case 49:
+                                /* Now follows a string containing a dash length
+                                 * value (multiple entries possible). */
+                                dxf_read_line (temp_string, fp);
+                                /*! \todo add code for proper implementation. */
+//                        dxf_read_double (fp, &ltype->dash_length);
 //                        element++;
-                        /*! \todo We are assuming that 49 is the first
-                         * group code that is encountered for each
-                         * element in the linetype definition.\n
-                         * This assumption breaks the "rule" of parsing
-                         * the dxf file regardless the order in which
-                         * group codes appear within an entity.
-                         */
-                }
-                else if (strcmp (temp_string, "50") == 0)
-                {
-                        /* Now follows a string containing a complex
-                         * rotation value (multiple entries possible). */
-                        (fp->line_number)++;
-                        /*! \todo add code for proper implementation. */
-//                        fscanf (fp->fp, "%lf\n", &ltype->complex_rotation);
-                }
-                else if (strcmp (temp_string, "70") == 0)
-                {
-                        /* Now follows a string containing the
-                         * standard flag value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%d\n", &ltype->flag);
-                }
-                else if (strcmp (temp_string, "72") == 0)
-                {
-                        /* Now follows a string containing the
-                         * alignment value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%d\n", &ltype->alignment);
-                }
-                else if (strcmp (temp_string, "73") == 0)
-                {
-                        /* Now follows a string containing the number of
-                         * dash length items value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%d\n", &ltype->number_of_linetype_elements);
-                }
-                else if (strcmp (temp_string, "74") == 0)
-                {
-                        /* Now follows a string containing a complex
-                         * element value (multiple entries possible). */
-                        (fp->line_number)++;
-                        /*! \todo add code for proper implementation. */
-//                        fscanf (fp->fp, "%d\n", &ltype->complex_element);
-                }
-                else if (strcmp (temp_string, "75") == 0)
-                {
-                        /* Now follows a string containing a complex
-                         * element value (multiple entries possible). */
-                        (fp->line_number)++;
-                        /*! \todo add code for proper implementation. */
-//                        fscanf (fp->fp, "%d\n", &ltype->complex_shape_number[element]);
-                }
-                else if (strcmp (temp_string, "330") == 0)
-                {
-                        /* Now follows a string containing Soft-pointer
-                         * ID/handle to owner dictionary. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, ltype->dictionary_owner_soft);
-                }
-                else if (strcmp (temp_string, "340") == 0)
-                {
-                        /* Now follows a string containing a complex
-                         * style pointer string (multiple entries possible). */
-                        (fp->line_number)++;
-                        /*! \todo add code for proper implementation. */
-//                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, ltype->complex_style_pointer[element]);
-                }
-                else if (strcmp (temp_string, "360") == 0)
-                {
-                        /* Now follows a string containing Hard owner
-                         * ID/handle to owner dictionary. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, ltype->dictionary_owner_hard);
-                }
-                else if (strcmp (temp_string, "999") == 0)
-                {
-                        /* Now follows a string containing a comment. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
-                        fprintf (stdout, "DXF comment: %s\n", temp_string);
-                }
-                else
-                {
-                        fprintf (stderr,
-                          (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
-                          __FUNCTION__, fp->filename, fp->line_number);
+                                /*! \todo We are assuming that 49 is the first
+                                 * group code that is encountered for each
+                                 * element in the linetype definition.\n
+                                 * This assumption breaks the "rule" of parsing
+                                 * the dxf file regardless the order in which
+                                 * group codes appear within an entity.
+                                 */
+                                break;
+                        case 50:
+                                /* Now follows a string containing a complex
+                                 * rotation value (multiple entries possible). */
+                                dxf_read_line (temp_string, fp);
+                                /*! \todo add code for proper implementation. */
+//                        dxf_read_double (fp, &ltype->complex_rotation);
+                                break;
+                        case 70:
+                                /* Now follows a string containing the
+                                 * standard flag value. */
+                                dxf_read_int (fp, &ltype->flag);
+                                break;
+                        case 72:
+                                /* Now follows a string containing the
+                                 * alignment value. */
+                                dxf_read_int (fp, &ltype->alignment);
+                                break;
+                        case 73:
+                                /* Now follows a string containing the number of
+                                 * dash length items value. */
+                                dxf_read_int (fp, &ltype->number_of_linetype_elements);
+                                break;
+                        case 74:
+                                /* Now follows a string containing a complex
+                                 * element value (multiple entries possible). */
+                                dxf_read_line (temp_string, fp);
+                                /*! \todo add code for proper implementation. */
+//                        dxf_read_int (fp, &ltype->complex_element);
+                                break;
+                        case 75:
+                                /* Now follows a string containing a complex
+                                 * element value (multiple entries possible). */
+                                dxf_read_line (temp_string, fp);
+                                /*! \todo add code for proper implementation. */
+//                        dxf_read_int (fp, &ltype->complex_shape_number[element]);
+                                break;
+                        case 330:
+                                /* Now follows a string containing Soft-pointer
+                                 * ID/handle to owner dictionary. */
+                                dxf_read_handle (fp, &ltype->dictionary_owner_soft);
+                                break;
+                        case 340:
+                                /* Now follows a string containing a complex
+                                 * style pointer string (multiple entries possible). */
+                                dxf_read_line (temp_string, fp);
+                                /*! \todo add code for proper implementation. */
+//                        dxf_read_string (fp, &ltype->complex_style_pointer[element]);
+                                break;
+                        case 360:
+                                /* Now follows a string containing Hard owner
+                                 * ID/handle to owner dictionary. */
+                                dxf_read_handle (fp, &ltype->dictionary_owner_hard);
+                                break;
+                        case 999:
+                                /* Now follows a string containing a comment. */
+                                dxf_read_line (temp_string, fp);
+                                fprintf (stdout, "DXF comment: %s\n", temp_string);
+                                break;
+                        default:
+                                fprintf (stderr,
+                                  (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
+                                  __FUNCTION__, fp->filename, fp->line_number);
+                                /* Skip the value of the unknown group code. */
+                                dxf_read_line (temp_string, fp);
+                                break;
                 }
         }
         /* Handle omitted members and/or illegal values. */
         if (strcmp (ltype->linetype_name, "") == 0)
         {
                 fprintf (stderr,
-                  (_("Error in %s (): empty linetype name string for the entity with id-code: %x\n")),
+                  (_("Error in %s (): empty linetype name string for the entity with id-code: %" PRIx64 "\n")),
                   __FUNCTION__, ltype->id_code);
                 fprintf (stderr,
                   (_("\tentity is discarded from output.\n")));
@@ -367,8 +336,6 @@ dxf_ltype_read
         {
                 ltype->alignment = 65;
         }
-        /* Clean up. */
-        free (temp_string);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -394,7 +361,8 @@ dxf_ltype_write
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        char *dxf_entity_name = strdup ("LTYPE");
+        char *dxf_entity_name = dxf_strdup ("LTYPE");
+        DxfInt16 *complex_element;
         int i;
 
         /* Do some basic checks. */
@@ -404,7 +372,7 @@ dxf_ltype_write
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (ltype == NULL)
@@ -413,26 +381,26 @@ dxf_ltype_write
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (strcmp (ltype->linetype_name, "") == 0)
         {
                 fprintf (stderr,
-                  (_("Warning in %s (): empty linetype name string for the %s entity with id-code: %x\n")),
+                  (_("Warning in %s (): empty linetype name string for the %s entity with id-code: %" PRIx64 "\n")),
                   __FUNCTION__, dxf_entity_name, ltype->id_code);
                 fprintf (stderr,
                   (_("\t%s entity is discarded from output.\n")),
                   dxf_entity_name);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         /* Start writing output. */
-        fprintf (fp->fp, "  0\n%s\n", dxf_entity_name);
-        if (ltype->id_code != -1)
+        dxf_write_string (fp, 0, dxf_entity_name);
+        if (ltype->id_code != DXF_HANDLE_NONE)
         {
-                fprintf (fp->fp, "  5\n%x\n", ltype->id_code);
+                dxf_write_hex (fp, 5, ltype->id_code);
         }
         /*!
          * \todo for version R14.\n
@@ -444,44 +412,48 @@ dxf_ltype_write
          * 102 groups are application defined (optional).\n\n
          * End of group, "}" (optional), with Group code 102.
          */
-        if ((strcmp (ltype->dictionary_owner_soft, "") != 0)
+        if ((ltype->dictionary_owner_soft != 0)
           && (fp->acad_version_number >= AutoCAD_14))
         {
-                fprintf (fp->fp, "102\n{ACAD_REACTORS\n");
-                fprintf (fp->fp, "330\n%s\n", ltype->dictionary_owner_soft);
-                fprintf (fp->fp, "102\n}\n");
+                dxf_write_string (fp, 102, "{ACAD_REACTORS");
+                dxf_write_hex (fp, 330, ltype->dictionary_owner_soft);
+                dxf_write_string (fp, 102, "}");
         }
-        if ((strcmp (ltype->dictionary_owner_hard, "") != 0)
+        if ((ltype->dictionary_owner_hard != 0)
           && (fp->acad_version_number >= AutoCAD_14))
         {
-                fprintf (fp->fp, "102\n{ACAD_XDICTIONARY\n");
-                fprintf (fp->fp, "360\n%s\n", ltype->dictionary_owner_hard);
-                fprintf (fp->fp, "102\n}\n");
+                dxf_write_string (fp, 102, "{ACAD_XDICTIONARY");
+                dxf_write_hex (fp, 360, ltype->dictionary_owner_hard);
+                dxf_write_string (fp, 102, "}");
         }
         if (fp->acad_version_number >= AutoCAD_14)
         {
-                fprintf (fp->fp, "100\nAcDbSymbolTableRecord\n");
-                fprintf (fp->fp, "100\nAcDbLinetypeTableRecord\n");
+                dxf_write_string (fp, 100, "AcDbSymbolTableRecord");
+                dxf_write_string (fp, 100, "AcDbLinetypeTableRecord");
         }
-        fprintf (fp->fp, "  2\n%s\n", ltype->linetype_name);
-        fprintf (fp->fp, " 70\n%d\n", ltype->flag);
+        dxf_write_string (fp, 2, ltype->linetype_name);
+        dxf_write_int (fp, 70, ltype->flag);
         if (ltype->description)
         {
-                fprintf (fp->fp, "  3\n%s\n", ltype->description);
+                dxf_write_string (fp, 3, ltype->description);
         }
         else
         {
-                fprintf (fp->fp, "  3\n\n");
+                dxf_write_string (fp, 3, "");
         }
-        fprintf (fp->fp, " 72\n%d\n", ltype->alignment);
-        fprintf (fp->fp, " 73\n%d\n", ltype->number_of_linetype_elements);
-        fprintf (fp->fp, " 40\n%f\n", ltype->total_pattern_length);
-        for ((i = 0); (i < ltype->number_of_linetype_elements); i++)
+        dxf_write_int (fp, 72, ltype->alignment);
+        dxf_write_int (fp, 73, ltype->number_of_linetype_elements);
+        dxf_write_double (fp, 40, ltype->total_pattern_length);
+        /* The complex elements are not read yet, the list may be
+         * shorter than the number of elements. */
+        complex_element = ltype->complex_element;
+        for ((i = 0); (i < ltype->number_of_linetype_elements)
+          && (complex_element != NULL); i++)
         {
                                 /*! \todo add code for a proper implementation. */
 //                fprintf (fp->fp, " 49\n%f\n", dxf_ltype_get_dash_length (ltype, i));
 //                fprintf (fp->fp, " 74\n%d\n", dxf_ltype_get_complex_element (ltype, i));
-                switch (ltype->complex_element->value)
+                switch (complex_element->value)
                 {
                         case 0:
                                 /* No embedded shape/text. */
@@ -556,13 +528,14 @@ dxf_ltype_write
                                 break;
                         default:
                                 fprintf (stderr,
-                                  (_("Warning in %s (): unknown complex element code for the %s entity with id-code: %x\n")),
+                                  (_("Warning in %s (): unknown complex element code for the %s entity with id-code: %" PRIx64 "\n")),
                                   __FUNCTION__, dxf_entity_name, ltype->id_code);
                                 break;
                 }
+                complex_element = (DxfInt16 *) complex_element->next;
         }
         /* Clean up. */
-        free (dxf_entity_name);
+        dxf_free (dxf_entity_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -603,11 +576,9 @@ dxf_ltype_free
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        free (ltype->linetype_name);
-        free (ltype->description);
-        free (ltype->complex_style_pointer);
-        free (ltype->dictionary_owner_soft);
-        free (ltype->dictionary_owner_hard);
+        dxf_free (ltype->linetype_name);
+        dxf_free (ltype->description);
+        dxf_free (ltype->complex_style_pointer);
         dxf_char_free_list (ltype->complex_text_string);
         dxf_double_free_list (ltype->complex_x_offset);
         dxf_double_free_list (ltype->complex_y_offset);
@@ -617,7 +588,7 @@ dxf_ltype_free
         dxf_int16_free_list (ltype->complex_element);
         dxf_int16_free_list (ltype->complex_shape_number);
         dxf_char_free_list (ltype->complex_style_pointer);
-        free (ltype);
+        dxf_free (ltype);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -663,7 +634,7 @@ dxf_ltype_free_list
  *
  * \return ID code.
  */
-int
+uint64_t
 dxf_ltype_get_id_code
 (
         DxfLType *ltype
@@ -681,13 +652,6 @@ dxf_ltype_get_id_code
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (ltype->id_code < 0)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a negative value was found.\n")),
-                  __FUNCTION__);
-                return (EXIT_FAILURE);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -706,7 +670,7 @@ dxf_ltype_set_id_code
 (
         DxfLType *ltype,
                 /*!< a pointer to a DXF \c LTYPE entity. */
-        int id_code
+        uint64_t id_code
                 /*!< Identification number for the entity.\n
                  * This is to be an unique (sequential) number in the DXF
                  * file. */
@@ -723,13 +687,6 @@ dxf_ltype_set_id_code
                   __FUNCTION__);
                 return (NULL);
         }
-        if (id_code < 0)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a negative value was passed.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
         ltype->id_code = id_code;
 #if DEBUG
         DXF_DEBUG_END
@@ -772,7 +729,7 @@ dxf_ltype_get_linetype_name
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (ltype->linetype_name));
+        return (dxf_strdup (ltype->linetype_name));
 }
 
 
@@ -810,7 +767,7 @@ dxf_ltype_set_linetype_name
                   __FUNCTION__);
                 return (NULL);
         }
-        ltype->linetype_name = strdup (linetype_name);
+        ltype->linetype_name = dxf_strdup (linetype_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -852,7 +809,7 @@ dxf_ltype_get_description
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (ltype->description));
+        return (dxf_strdup (ltype->description));
 }
 
 
@@ -890,7 +847,7 @@ dxf_ltype_set_description
                   __FUNCTION__);
                 return (NULL);
         }
-        ltype->description = strdup (description);
+        ltype->description = dxf_strdup (description);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1972,11 +1929,9 @@ dxf_ltype_set_complex_shape_number
  * \c LTYPE entity.
  *
  * \return soft pointer to the dictionary owner \dictonary_owner_soft,
- * \c NULL when an error occurred.
- *
- * \warning no checks are performed on the returned pointer (string).
+ * 0 when an error occurred.
  */
-char *
+uint64_t
 dxf_ltype_get_dictionary_owner_soft
 (
         DxfLType *ltype
@@ -1992,19 +1947,12 @@ dxf_ltype_get_dictionary_owner_soft
                 fprintf (stderr,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
-                return (NULL);
-        }
-        if (ltype->dictionary_owner_soft ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
+                return (0);
         }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (ltype->dictionary_owner_soft));
+        return (ltype->dictionary_owner_soft);
 }
 
 
@@ -2019,8 +1967,8 @@ dxf_ltype_set_dictionary_owner_soft
 (
         DxfLType *ltype,
                 /*!< a pointer to a DXF \c LTYPE entity. */
-        char *dictionary_owner_soft
-                /*!< a string containing the pointer to the
+        uint64_t dictionary_owner_soft
+                /*!< the handle of the
                  * \c dictionary_owner_soft for the entity. */
 )
 {
@@ -2035,14 +1983,7 @@ dxf_ltype_set_dictionary_owner_soft
                   __FUNCTION__);
                 return (NULL);
         }
-        if (dictionary_owner_soft == NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was passed.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
-        ltype->dictionary_owner_soft = strdup (dictionary_owner_soft);
+        ltype->dictionary_owner_soft = dictionary_owner_soft;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2136,11 +2077,9 @@ dxf_ltype_set_complex_style_pointer
  * \c LTYPE entity.
  *
  * \return A hard pointer to the dictionary owner \c dictionay_owner_hard,
- * or \c NULL when an error occurred.
- *
- * \warning No checks are performed on the returned pointer (string).
+ * or 0 when an error occurred.
  */
-char *
+uint64_t
 dxf_ltype_get_dictionary_owner_hard
 (
         DxfLType *ltype
@@ -2156,19 +2095,12 @@ dxf_ltype_get_dictionary_owner_hard
                 fprintf (stderr,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
-                return (NULL);
-        }
-        if (ltype->dictionary_owner_hard ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
+                return (0);
         }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (ltype->dictionary_owner_hard));
+        return (ltype->dictionary_owner_hard);
 }
 
 
@@ -2183,8 +2115,8 @@ dxf_ltype_set_dictionary_owner_hard
 (
         DxfLType *ltype,
                 /*!< a pointer to a DXF \c LTYPE entity. */
-        char *dictionary_owner_hard
-                /*!< a string containing the pointer to the
+        uint64_t dictionary_owner_hard
+                /*!< the handle of the
                  * dictionary_owner_hard for the entity. */
 )
 {
@@ -2199,14 +2131,7 @@ dxf_ltype_set_dictionary_owner_hard
                   __FUNCTION__);
                 return (NULL);
         }
-        if (dictionary_owner_hard == NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was passed.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
-        ltype->dictionary_owner_hard = strdup (dictionary_owner_hard);
+        ltype->dictionary_owner_hard = dictionary_owner_hard;
 #if DEBUG
         DXF_DEBUG_END
 #endif
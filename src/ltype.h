@@ -58,7 +58,7 @@ extern "C" {
 typedef struct
 dxf_ltype_struct
 {
-        int id_code;
+        uint64_t id_code;
                 /*!< Entity handle; text string of up to 16 hexadecimal
                  * digits (fixed).\n
                  * Group code = 5. */
@@ -138,14 +138,14 @@ dxf_ltype_struct
                  * value is set to 0.\n
                  * If code 74 is set to 0, code 75 is omitted.\n
                  * Group code = 75. */
-        char *dictionary_owner_soft;
+        uint64_t dictionary_owner_soft;
                 /*!< Soft-pointer ID/handle to owner dictionary (optional).\n
                  * Group code = 330. */
         DxfChar *complex_style_pointer;
                 /*!< group code = 340.Pointer to \c STYLE object.\n
                  * One per element if group code 74 > 0.\n
                  * Group code = 340. */
-        char *dictionary_owner_hard;
+        uint64_t dictionary_owner_hard;
                 /*!< Hard owner ID/handle to owner dictionary (optional).\n
                  * Group code = 360. */
         struct DxfLType *next;
@@ -160,8 +160,8 @@ DxfLType *dxf_ltype_read (DxfFile *fp, DxfLType *ltype);
 int dxf_ltype_write (DxfFile *fp, DxfLType *ltype);
 int dxf_ltype_free (DxfLType *ltype);
 void dxf_ltype_free_list (DxfLType *ltypes);
-int dxf_ltype_get_id_code (DxfLType *ltype);
-DxfLType *dxf_ltype_set_id_code (DxfLType *ltype, int id_code);
+uint64_t dxf_ltype_get_id_code (DxfLType *ltype);
+DxfLType *dxf_ltype_set_id_code (DxfLType *ltype, uint64_t id_code);
 char *dxf_ltype_get_linetype_name (DxfLType *ltype);
 DxfLType *dxf_ltype_set_linetype_name (DxfLType *ltype, char *linetype_name);
 char *dxf_ltype_get_description (DxfLType *ltype);
@@ -193,12 +193,12 @@ DxfInt16 *dxf_ltype_get_complex_element (DxfLType *ltype);
 DxfLType *dxf_ltype_set_complex_element (DxfLType *ltype, DxfInt16 *complex_element);
 DxfInt16 *dxf_ltype_get_complex_shape_number (DxfLType *ltype);
 DxfLType *dxf_ltype_set_complex_shape_number (DxfLType *ltype, DxfInt16 *complex_shape_number);
-char *dxf_ltype_get_dictionary_owner_soft (DxfLType *ltype);
-DxfLType *dxf_ltype_set_dictionary_owner_soft (DxfLType *ltype, char *dictionary_owner_soft);
+uint64_t dxf_ltype_get_dictionary_owner_soft (DxfLType *ltype);
+DxfLType *dxf_ltype_set_dictionary_owner_soft (DxfLType *ltype, uint64_t dictionary_owner_soft);
 DxfChar *dxf_ltype_get_complex_style_pointer (DxfLType *ltype);
 DxfLType *dxf_ltype_set_complex_style_pointer (DxfLType *ltype, DxfChar *complex_style_pointer);
-char *dxf_ltype_get_dictionary_owner_hard (DxfLType *ltype);
-DxfLType *dxf_ltype_set_dictionary_owner_hard (DxfLType *ltype, char *dictionary_owner_hard);
+uint64_t dxf_ltype_get_dictionary_owner_hard (DxfLType *ltype);
+DxfLType *dxf_ltype_set_dictionary_owner_hard (DxfLType *ltype, uint64_t dictionary_owner_hard);
 DxfLType *dxf_ltype_get_next (DxfLType *ltype);
 DxfLType *dxf_ltype_set_next (DxfLType *ltype, DxfLType *next);
 DxfLType *dxf_ltype_get_last (DxfLType *ltype);
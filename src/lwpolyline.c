@@ -44,6 +44,8 @@
 
 
 #include "lwpolyline.h"
+#include "bbox.h"
+#include "util.h"
 
 
 /*!
@@ -65,7 +67,7 @@ dxf_lwpolyline_new ()
         size = sizeof (DxfLWPolyline);
         /* avoid malloc of 0 bytes */
         if (size == 0) size = 1;
-        if ((lwpolyline = malloc (size)) == NULL)
+        if ((lwpolyline = dxf_malloc (size)) == NULL)
         {
                 fprintf (stderr,
                   (_("Error in %s () could not allocate memory for a DxfLWPolyline struct.\n")),
@@ -116,9 +118,9 @@ dxf_lwpolyline_init
               return (NULL);
         }
         /* Assign initial values to members. */
-        lwpolyline->id_code = 0;
-        lwpolyline->linetype = strdup (DXF_DEFAULT_LINETYPE);
-        lwpolyline->layer = strdup (DXF_DEFAULT_LAYER);
+        lwpolyline->id_code = DXF_HANDLE_NONE;
+        lwpolyline->linetype = dxf_strdup (DXF_DEFAULT_LINETYPE);
+        lwpolyline->layer = dxf_strdup (DXF_DEFAULT_LAYER);
         lwpolyline->elevation = 0.0;
         lwpolyline->thickness = 0.0;
         lwpolyline->linetype_scale = DXF_DEFAULT_LINETYPE_SCALE;
@@ -128,14 +130,14 @@ dxf_lwpolyline_init
         lwpolyline->paperspace = DXF_MODELSPACE;
         lwpolyline->graphics_data_size = 0;
         lwpolyline->shadow_mode = 0;
-        lwpolyline->dictionary_owner_soft = strdup ("");
-        lwpolyline->object_owner_soft = strdup ("");
-        lwpolyline->material = strdup ("");
-        lwpolyline->dictionary_owner_hard = strdup ("");
+        lwpolyline->dictionary_owner_soft = 0;
+        lwpolyline->object_owner_soft = 0;
+        lwpolyline->material = 0;
+        lwpolyline->dictionary_owner_hard = 0;
         lwpolyline->lineweight = 0;
-        lwpolyline->plot_style_name = strdup ("");
+        lwpolyline->plot_style_name = 0;
         lwpolyline->color_value = 0;
-        lwpolyline->color_name = strdup ("");
+        lwpolyline->color_name = dxf_strdup ("");
         lwpolyline->transparency = 0;
         lwpolyline->constant_width = 0.0;
         lwpolyline->flag = 0;
@@ -146,7 +148,12 @@ dxf_lwpolyline_init
         /* Initialize new structs for the following members later,
          * when they are required and when we have content. */
         lwpolyline->binary_graphics_data = NULL;
-        lwpolyline->vertices = NULL;
+        lwpolyline->max_vertices = 0;
+        lwpolyline->x = NULL;
+        lwpolyline->y = NULL;
+        lwpolyline->start_width = NULL;
+        lwpolyline->end_width = NULL;
+        lwpolyline->bulge = NULL;
         lwpolyline->next = NULL;
 #if DEBUG
         DXF_DEBUG_END
@@ -178,8 +185,9 @@ dxf_lwpolyline_read
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        char *temp_string = NULL;
-        DxfVertex *iter = NULL;
+        char temp_string[DXF_MAX_STRING_LENGTH];
+        int group_code;
+        int i; /* Index of the vertex being read. */
 
         /* Do some basic checks. */
         if (fp == NULL)
@@ -187,8 +195,6 @@ dxf_lwpolyline_read
                 fprintf (stderr,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
-                /* Clean up. */
-                free (temp_string);
                 return (NULL);
         }
         if (lwpolyline == NULL)
@@ -214,237 +220,223 @@ dxf_lwpolyline_read
                         return (NULL);
                 }
         }
-        if (lwpolyline->vertices == NULL)
-        {
-                fprintf (stderr,
-                  (_("Warning in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                fprintf (stderr,
-                  (_("Initializing a DxfVertex struct.\n")));
-                lwpolyline->vertices = (struct DxfVertex *) dxf_vertex_init ((DxfVertex *) lwpolyline->vertices);
-                if (lwpolyline->vertices == NULL)
-                {
-                        fprintf (stderr,
-                          (_("Error in %s () could not allocate memory.\n")),
-                          __FUNCTION__);
-                        return (NULL);
-                }
-        }
-        iter = (DxfVertex *) lwpolyline->vertices;
-        (fp->line_number)++;
-        fscanf (fp->fp, "%[^\n]", temp_string);
-        while (strcmp (temp_string, "0") != 0)
+        i = -1;
+        while ((dxf_read_group_code (fp, &group_code) == EXIT_SUCCESS)
+          && (group_code != 0))
         {
-                if (ferror (fp->fp))
+                if (dxf_read_error (fp))
                 {
                         fprintf (stderr,
                           (_("Error in %s () while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
-                        fclose (fp->fp);
                         return (NULL);
                 }
-                if (strcmp (temp_string, "5") == 0)
-                {
-                        /* Now follows a string containing a sequential
-                         * id number. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%x\n", (uint *) &lwpolyline->id_code);
-                }
-                else if (strcmp (temp_string, "6") == 0)
-                {
-                        /* Now follows a string containing a linetype
-                         * name. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, lwpolyline->linetype);
-                }
-                else if (strcmp (temp_string, "8") == 0)
-                {
-                        /* Now follows a string containing a layer name. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, lwpolyline->layer);
-                }
-                else if (strcmp (temp_string, "10") == 0)
-                {
-                        /* Now follows a string containing the
-                        * X-coordinate of a vertex. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &iter->p0->x0);
-                        /*! \todo Create a pointer to the next DxfVertex if and when required. */
-                }
-                else if (strcmp (temp_string, "20") == 0)
-                {
-                        /* Now follows a string containing the
-                        * Y-coordinate of a vertex. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &iter->p0->y0);
-                        /*! \todo Create a pointer to the next DxfVertex if and when required. */
-                }
-                else if ((fp->acad_version_number <= AutoCAD_11)
-                        && (strcmp (temp_string, "38") == 0)
-                        && (lwpolyline->elevation != 0.0))
-                {
-                        /* Now follows a string containing the
-                         * elevation. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &lwpolyline->elevation);
-                }
-                else if (strcmp (temp_string, "39") == 0)
-                {
-                        /* Now follows a string containing the
-                         * thickness. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &lwpolyline->thickness);
-                }
-                else if (strcmp (temp_string, "40") == 0)
-                {
-                        /* Now follows a string containing the
-                         * start width of the vertex. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &iter->start_width);
-                }
-                else if (strcmp (temp_string, "41") == 0)
-                {
-                        /* Now follows a string containing the
-                         * start width of the vertex. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &iter->end_width);
-                }
-                else if (strcmp (temp_string, "42") == 0)
-                {
-                        /* Now follows a string containing the bulge of
-                         * the vertex. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &iter->bulge);
-                        /* The last member of the vertex is read.\n */
-                        /*! \todo The pointer administration needs to be checked for functionality. */
-                         /* Increment iter to next DxfVertex. */
-                        iter->next = (struct DxfVertex *) dxf_vertex_new ();
-                        iter = (DxfVertex *) iter->next;
-                }
-                else if (strcmp (temp_string, "43") == 0)
-                {
-                        /* Now follows a string containing the
-                         * constant width. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &lwpolyline->constant_width);
-                }
-                else if (strcmp (temp_string, "48") == 0)
-                {
-                        /* Now follows a string containing the linetype
-                         * scale. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &lwpolyline->linetype_scale);
-                }
-                else if (strcmp (temp_string, "60") == 0)
-                {
-                        /* Now follows a string containing the
-                         * visibility value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%hd\n", &lwpolyline->visibility);
-                }
-                else if (strcmp (temp_string, "62") == 0)
-                {
-                        /* Now follows a string containing the
-                         * color value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%d\n", &lwpolyline->color);
-                }
-                else if (strcmp (temp_string, "67") == 0)
-                {
-                        /* Now follows a string containing the
-                         * paperspace value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%d\n", &lwpolyline->paperspace);
-                }
-                else if (strcmp (temp_string, "70") == 0)
-                {
-                        /* Now follows a string containing the
-                         * flag value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%d\n", &lwpolyline->flag);
-                }
-                else if (strcmp (temp_string, "90") == 0)
-                {
-                        /* Now follows a string containing the number
-                         * of following vertices. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%d\n", &lwpolyline->number_vertices);
-                }
-                else if ((fp->acad_version_number >= AutoCAD_12)
-                        && (strcmp (temp_string, "100") == 0))
-                {
-                        /* Subclass markers are post AutoCAD R12
-                         * variable so additional testing for the
-                         * version should probably be added here.
-                         * Now follows a string containing the
-                         * subclass marker value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
-                }
-                else if (strcmp (temp_string, "210") == 0)
+                switch (group_code)
                 {
-                        /* Now follows a string containing the
-                         * X-value of the extrusion vector. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &lwpolyline->extr_x0);
-                }
-                else if (strcmp (temp_string, "220") == 0)
-                {
-                        /* Now follows a string containing the
-                         * Y-value of the extrusion vector. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &lwpolyline->extr_y0);
-                }
-                else if (strcmp (temp_string, "230") == 0)
-                {
-                        /* Now follows a string containing the
-                         * Z-value of the extrusion vector. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &lwpolyline->extr_z0);
-                }
-                else if (strcmp (temp_string, "330") == 0)
-                {
-                        /* Now follows a string containing Soft-pointer
-                         * ID/handle to owner dictionary. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, lwpolyline->dictionary_owner_soft);
-                }
-                else if (strcmp (temp_string, "360") == 0)
-                {
-                        /* Now follows a string containing Hard owner
-                         * ID/handle to owner dictionary. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, lwpolyline->dictionary_owner_hard);
-                }
-                else if (strcmp (temp_string, "999") == 0)
-                {
-                        /* Now follows a string containing a comment. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
-                        fprintf (stdout, "DXF comment: %s\n", temp_string);
-                }
-                else
-                {
-                        fprintf (stderr,
-                          (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
-                          __FUNCTION__, fp->filename, fp->line_number);
+                        case 5:
+                                /* Now follows a string containing a sequential
+                                 * id number. */
+                                dxf_read_handle (fp, &lwpolyline->id_code);
+                                break;
+                        case 6:
+                                /* Now follows a string containing a linetype
+                                 * name. */
+                                dxf_read_string_interned (fp, &lwpolyline->linetype);
+                                break;
+                        case 8:
+                                /* Now follows a string containing a layer name. */
+                                dxf_read_string_interned (fp, &lwpolyline->layer);
+                                break;
+                        case 10:
+                                /* Now follows a string containing the
+                                 * X-coordinate of a vertex, this starts
+                                 * a new vertex. */
+                                i++;
+                                if ((i >= lwpolyline->max_vertices)
+                                  && (dxf_lwpolyline_reserve_vertices (lwpolyline, (i < 4) ? 4 : 2 * i) == EXIT_FAILURE))
+                                {
+                                        return (NULL);
+                                }
+                                dxf_read_double (fp, &lwpolyline->x[i]);
+                                lwpolyline->y[i] = 0.0;
+                                lwpolyline->start_width[i] = lwpolyline->constant_width;
+                                lwpolyline->end_width[i] = lwpolyline->constant_width;
+                                lwpolyline->bulge[i] = 0.0;
+                                break;
+                        case 20:
+                        case 40:
+                        case 41:
+                        case 42:
+                                if (i < 0)
+                                {
+                                        fprintf (stderr,
+                                          (_("Warning in %s () vertex data before the first vertex found while reading from: %s in line: %d.\n")),
+                                          __FUNCTION__, fp->filename, fp->line_number);
+                                        /* Skip the value. */
+                                        dxf_read_line (temp_string, fp);
+                                }
+                                else if (group_code == 20)
+                                {
+                                        /* Now follows a string containing the
+                                         * Y-coordinate of the vertex. */
+                                        dxf_read_double (fp, &lwpolyline->y[i]);
+                                }
+                                else if (group_code == 40)
+                                {
+                                        /* Now follows a string containing the
+                                         * start width of the vertex. */
+                                        dxf_read_double (fp, &lwpolyline->start_width[i]);
+                                }
+                                else if (group_code == 41)
+                                {
+                                        /* Now follows a string containing the
+                                         * end width of the vertex. */
+                                        dxf_read_double (fp, &lwpolyline->end_width[i]);
+                                }
+                                else
+                                {
+                                        /* Now follows a string containing the
+                                         * bulge of the vertex. */
+                                        dxf_read_double (fp, &lwpolyline->bulge[i]);
+                                }
+                                break;
+                        case 38:
+                                if ((fp->acad_version_number <= AutoCAD_11) && (lwpolyline->elevation != 0.0))
+                                {
+                                        /* Now follows a string containing the
+                                         * elevation. */
+                                        dxf_read_double (fp, &lwpolyline->elevation);
+                                }
+                                else
+                                {
+                                        fprintf (stderr,
+                                          (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
+                                          __FUNCTION__, fp->filename, fp->line_number);
+                                        /* Skip the value of the unknown group code. */
+                                        dxf_read_line (temp_string, fp);
+                                }
+                                break;
+                        case 39:
+                                /* Now follows a string containing the
+                                 * thickness. */
+                                dxf_read_double (fp, &lwpolyline->thickness);
+                                break;
+                        case 43:
+                                /* Now follows a string containing the
+                                 * constant width. */
+                                dxf_read_double (fp, &lwpolyline->constant_width);
+                                break;
+                        case 48:
+                                /* Now follows a string containing the linetype
+                                 * scale. */
+                                dxf_read_double (fp, &lwpolyline->linetype_scale);
+                                break;
+                        case 60:
+                                /* Now follows a string containing the
+                                 * visibility value. */
+                                dxf_read_int16 (fp, &lwpolyline->visibility);
+                                break;
+                        case 62:
+                                /* Now follows a string containing the
+                                 * color value. */
+                                dxf_read_int (fp, &lwpolyline->color);
+                                break;
+                        case 67:
+                                /* Now follows a string containing the
+                                 * paperspace value. */
+                                dxf_read_int (fp, &lwpolyline->paperspace);
+                                break;
+                        case 70:
+                                /* Now follows a string containing the
+                                 * flag value. */
+                                dxf_read_int (fp, &lwpolyline->flag);
+                                break;
+                        case 90:
+                                /* Now follows a string containing the number
+                                 * of following vertices, allocate the vertex
+                                 * arrays in one go. */
+                                dxf_read_int (fp, &lwpolyline->number_vertices);
+                                if ((lwpolyline->number_vertices > lwpolyline->max_vertices)
+                                  && (dxf_lwpolyline_reserve_vertices (lwpolyline, lwpolyline->number_vertices) == EXIT_FAILURE))
+                                {
+                                        return (NULL);
+                                }
+                                break;
+                        case 100:
+                                if (fp->acad_version_number >= AutoCAD_12)
+                                {
+                                        /* Subclass markers are post AutoCAD R12
+                                         * variable so additional testing for the
+                                         * version should probably be added here.
+                                         * Now follows a string containing the
+                                         * subclass marker value. */
+                                        dxf_read_line (temp_string, fp);
+                                }
+                                else
+                                {
+                                        fprintf (stderr,
+                                          (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
+                                          __FUNCTION__, fp->filename, fp->line_number);
+                                        /* Skip the value of the unknown group code. */
+                                        dxf_read_line (temp_string, fp);
+                                }
+                                break;
+                        case 210:
+                                /* Now follows a string containing the
+                                 * X-value of the extrusion vector. */
+                                dxf_read_double (fp, &lwpolyline->extr_x0);
+                                break;
+                        case 220:
+                                /* Now follows a string containing the
+                                 * Y-value of the extrusion vector. */
+                                dxf_read_double (fp, &lwpolyline->extr_y0);
+                                break;
+                        case 230:
+                                /* Now follows a string containing the
+                                 * Z-value of the extrusion vector. */
+                                dxf_read_double (fp, &lwpolyline->extr_z0);
+                                break;
+                        case 330:
+                                /* Now follows a string containing Soft-pointer
+                                 * ID/handle to owner dictionary. */
+                                dxf_read_handle (fp, &lwpolyline->dictionary_owner_soft);
+                                break;
+                        case 360:
+                                /* Now follows a string containing Hard owner
+                                 * ID/handle to owner dictionary. */
+                                dxf_read_handle (fp, &lwpolyline->dictionary_owner_hard);
+                                break;
+                        case 999:
+                                /* Now follows a string containing a comment. */
+                                dxf_read_line (temp_string, fp);
+                                fprintf (stdout, "DXF comment: %s\n", temp_string);
+                                break;
+                        default:
+                                fprintf (stderr,
+                                  (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
+                                  __FUNCTION__, fp->filename, fp->line_number);
+                                /* Skip the value of the unknown group code. */
+                                dxf_read_line (temp_string, fp);
+                                break;
                 }
         }
-        /*! \todo Free memory to the last (unused) vertex in the linked list. */
-
-        /* Set the pointer to the last (unused) vertex in the linked list to NULL. */
-        iter->next = NULL;
+        if ((lwpolyline->number_vertices != 0)
+          && (lwpolyline->number_vertices != i + 1))
+        {
+                fprintf (stderr,
+                  (_("Warning in %s () %d vertices found, %d vertices expected.\n")),
+                  __FUNCTION__, i + 1, lwpolyline->number_vertices);
+        }
+        lwpolyline->number_vertices = i + 1;
         /* Handle omitted members and/or illegal values. */
         if (strcmp (lwpolyline->linetype, "") == 0)
         {
-                lwpolyline->linetype = strdup (DXF_DEFAULT_LINETYPE);
+                lwpolyline->linetype = dxf_strdup (DXF_DEFAULT_LINETYPE);
         }
         if (strcmp (lwpolyline->layer, "") == 0)
         {
-                lwpolyline->layer = strdup (DXF_DEFAULT_LAYER);
+                lwpolyline->layer = dxf_strdup (DXF_DEFAULT_LAYER);
         }
-        /* Clean up. */
-        free (temp_string);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -477,8 +469,8 @@ dxf_lwpolyline_write
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        char *dxf_entity_name = strdup ("LWPOLYLINE");
-        DxfVertex *iter = NULL;
+        char *dxf_entity_name = dxf_strdup ("LWPOLYLINE");
+        int i;
 
         /* Do some basic checks. */
         if (fp == NULL)
@@ -487,7 +479,7 @@ dxf_lwpolyline_write
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (lwpolyline == NULL)
@@ -496,57 +488,59 @@ dxf_lwpolyline_write
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
-        if (lwpolyline->vertices == NULL)
+        if ((lwpolyline->number_vertices > 0)
+          && ((lwpolyline->x == NULL)
+          || (lwpolyline->max_vertices < lwpolyline->number_vertices)))
         {
                 fprintf (stderr,
                   (_("Error in %s () a NULL pointer was found.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if ((fp->acad_version_number < AutoCAD_14)
           && (fp->follow_strict_version_rules))
         {
                 fprintf (stderr,
-                  (_("Error in %s () illegal DXF version for this %s entity with id-code: %x.\n")),
+                  (_("Error in %s () illegal DXF version for this %s entity with id-code: %" PRIx64 ".\n")),
                   __FUNCTION__, dxf_entity_name, lwpolyline->id_code);
                 return (EXIT_FAILURE);
         }
         else
         {
                 fprintf (stderr,
-                  (_("Warning in %s () illegal DXF version for this %s entity with id-code: %x.\n")),
+                  (_("Warning in %s () illegal DXF version for this %s entity with id-code: %" PRIx64 ".\n")),
                   __FUNCTION__, dxf_entity_name, lwpolyline->id_code);
         }
         if (strcmp (lwpolyline->linetype, "") == 0)
         {
                 fprintf (stderr,
-                  (_("Warning in %s () empty linetype string for the %s entity with id-code: %x\n")),
+                  (_("Warning in %s () empty linetype string for the %s entity with id-code: %" PRIx64 "\n")),
                   __FUNCTION__, dxf_entity_name, lwpolyline->id_code);
                 fprintf (stderr,
                   (_("\t%s entity is reset to default linetype")),
                   dxf_entity_name);
-                lwpolyline->linetype = strdup (DXF_DEFAULT_LINETYPE);
+                lwpolyline->linetype = dxf_strdup (DXF_DEFAULT_LINETYPE);
         }
         if (strcmp (lwpolyline->layer, "") == 0)
         {
                 fprintf (stderr,
-                  (_("Warning in %s () empty layer string for the %s entity with id-code: %x\n")),
+                  (_("Warning in %s () empty layer string for the %s entity with id-code: %" PRIx64 "\n")),
                   __FUNCTION__, dxf_entity_name, lwpolyline->id_code);
                 fprintf (stderr,
                   (_("\t%s entity is relocated to layer 0\n")),
                   dxf_entity_name);
-                lwpolyline->layer = strdup (DXF_DEFAULT_LAYER);
+                lwpolyline->layer = dxf_strdup (DXF_DEFAULT_LAYER);
         }
         /* Start writing output. */
-        fprintf (fp->fp, "  0\n%s\n", dxf_entity_name);
-        if (lwpolyline->id_code != -1)
+        dxf_write_string (fp, 0, dxf_entity_name);
+        if (lwpolyline->id_code != DXF_HANDLE_NONE)
         {
-                fprintf (fp->fp, "  5\n%x\n", lwpolyline->id_code);
+                dxf_write_hex (fp, 5, lwpolyline->id_code);
         }
         /*!
          * \todo for version R14.\n
@@ -558,91 +552,82 @@ dxf_lwpolyline_write
          * 102 groups are application defined (optional).\n\n
          * End of group, "}" (optional), with Group code 102.
          */
-        if ((strcmp (lwpolyline->dictionary_owner_soft, "") != 0)
+        if ((lwpolyline->dictionary_owner_soft != 0)
           && (fp->acad_version_number >= AutoCAD_14))
         {
-                fprintf (fp->fp, "102\n{ACAD_REACTORS\n");
-                fprintf (fp->fp, "330\n%s\n", lwpolyline->dictionary_owner_soft);
-                fprintf (fp->fp, "102\n}\n");
+                dxf_write_string (fp, 102, "{ACAD_REACTORS");
+                dxf_write_hex (fp, 330, lwpolyline->dictionary_owner_soft);
+                dxf_write_string (fp, 102, "}");
         }
-        if ((strcmp (lwpolyline->dictionary_owner_hard, "") != 0)
+        if ((lwpolyline->dictionary_owner_hard != 0)
           && (fp->acad_version_number >= AutoCAD_14))
         {
-                fprintf (fp->fp, "102\n{ACAD_XDICTIONARY\n");
-                fprintf (fp->fp, "360\n%s\n", lwpolyline->dictionary_owner_hard);
-                fprintf (fp->fp, "102\n}\n");
+                dxf_write_string (fp, 102, "{ACAD_XDICTIONARY");
+                dxf_write_hex (fp, 360, lwpolyline->dictionary_owner_hard);
+                dxf_write_string (fp, 102, "}");
         }
         if (fp->acad_version_number >= AutoCAD_13)
         {
-                fprintf (fp->fp, "100\nAcDbEntity\n");
+                dxf_write_string (fp, 100, "AcDbEntity");
         }
         if (lwpolyline->paperspace == DXF_PAPERSPACE)
         {
-                fprintf (fp->fp, " 67\n%d\n", (int16_t) DXF_PAPERSPACE);
+                dxf_write_int (fp, 67, (int16_t) DXF_PAPERSPACE);
         }
-        fprintf (fp->fp, "  8\n%s\n", lwpolyline->layer);
+        dxf_write_string (fp, 8, lwpolyline->layer);
         if (strcmp (lwpolyline->linetype, DXF_DEFAULT_LINETYPE) != 0)
         {
-                fprintf (fp->fp, "  6\n%s\n", lwpolyline->linetype);
+                dxf_write_string (fp, 6, lwpolyline->linetype);
         }
         if (lwpolyline->color != DXF_COLOR_BYLAYER)
         {
-                fprintf (fp->fp, " 62\n%d\n", lwpolyline->color);
+                dxf_write_int (fp, 62, lwpolyline->color);
         }
         if (lwpolyline->linetype_scale != 1.0)
         {
-                fprintf (fp->fp, " 48\n%f\n", lwpolyline->linetype_scale);
+                dxf_write_double (fp, 48, lwpolyline->linetype_scale);
         }
         if (lwpolyline->visibility != 0)
         {
-                fprintf (fp->fp, " 60\n%d\n", lwpolyline->visibility);
+                dxf_write_int (fp, 60, lwpolyline->visibility);
         }
         if (fp->acad_version_number >= AutoCAD_13)
         {
-                fprintf (fp->fp, "100\nAcDbPolyline\n");
+                dxf_write_string (fp, 100, "AcDbPolyline");
         }
-        fprintf (fp->fp, " 90\n%d\n", lwpolyline->number_vertices);
-        fprintf (fp->fp, " 70\n%d\n", lwpolyline->flag);
-        fprintf (fp->fp, " 43\n%f\n", lwpolyline->constant_width);
+        dxf_write_int (fp, 90, lwpolyline->number_vertices);
+        dxf_write_int (fp, 70, lwpolyline->flag);
+        dxf_write_double (fp, 43, lwpolyline->constant_width);
         if (lwpolyline->elevation != 0.0)
         {
-                fprintf (fp->fp, " 38\n%f\n", lwpolyline->elevation);
+                dxf_write_double (fp, 38, lwpolyline->elevation);
         }
         if (lwpolyline->thickness != 0.0)
         {
-                fprintf (fp->fp, " 39\n%f\n", lwpolyline->thickness);
+                dxf_write_double (fp, 39, lwpolyline->thickness);
         }
         /* Start of writing (multiple) vertices. */
-        iter = (DxfVertex *) lwpolyline->vertices;
-        while (iter != NULL)
+        for (i = 0; i < lwpolyline->number_vertices; i++)
         {
-                if (iter->p0 == NULL)
-                {
-                        fprintf (stderr,
-                          (_("Error in %s () a NULL pointer was found.\n")),
-                          __FUNCTION__);
-                        return (EXIT_FAILURE);
-                }
-                fprintf (fp->fp, " 10\n%f\n", iter->p0->x0);
-                fprintf (fp->fp, " 20\n%f\n", iter->p0->y0);
-                if ((iter->start_width != lwpolyline->constant_width)
-                  || (iter->end_width != lwpolyline->constant_width))
+                dxf_write_double (fp, 10, lwpolyline->x[i]);
+                dxf_write_double (fp, 20, lwpolyline->y[i]);
+                if ((lwpolyline->start_width[i] != lwpolyline->constant_width)
+                  || (lwpolyline->end_width[i] != lwpolyline->constant_width))
                 {
-                        fprintf (fp->fp, " 40\n%f\n", iter->start_width);
-                        fprintf (fp->fp, " 41\n%f\n", iter->end_width);
+                        dxf_write_double (fp, 40, lwpolyline->start_width[i]);
+                        dxf_write_double (fp, 41, lwpolyline->end_width[i]);
                 }
-                fprintf (fp->fp, " 42\n%f\n", iter->bulge);
-                iter = (DxfVertex *) iter->next;
+                dxf_write_double (fp, 42, lwpolyline->bulge[i]);
         }
         /* End of writing (multiple) vertices. */
         if (fp->acad_version_number >= AutoCAD_12)
         {
-                fprintf (fp->fp, "210\n%f\n", lwpolyline->extr_x0);
-                fprintf (fp->fp, "220\n%f\n", lwpolyline->extr_y0);
-                fprintf (fp->fp, "230\n%f\n", lwpolyline->extr_z0);
+                dxf_write_double (fp, 210, lwpolyline->extr_x0);
+                dxf_write_double (fp, 220, lwpolyline->extr_y0);
+                dxf_write_double (fp, 230, lwpolyline->extr_z0);
         }
         /* Clean up. */
-        free (dxf_entity_name);
+        dxf_free (dxf_entity_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -682,9 +667,14 @@ dxf_lwpolyline_free
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        free (lwpolyline->linetype);
-        free (lwpolyline->layer);
-        free (lwpolyline);
+        dxf_string_free (lwpolyline->linetype);
+        dxf_string_free (lwpolyline->layer);
+        dxf_free (lwpolyline->x);
+        dxf_free (lwpolyline->y);
+        dxf_free (lwpolyline->start_width);
+        dxf_free (lwpolyline->end_width);
+        dxf_free (lwpolyline->bulge);
+        dxf_free (lwpolyline);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -730,7 +720,7 @@ dxf_lwpolyline_free_list
  *
  * \return ID code.
  */
-int
+uint64_t
 dxf_lwpolyline_get_id_code
 (
         DxfLWPolyline *lwpolyline
@@ -748,13 +738,6 @@ dxf_lwpolyline_get_id_code
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (lwpolyline->id_code < 0)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a negative value was found.\n")),
-                  __FUNCTION__);
-                return (EXIT_FAILURE);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -770,7 +753,7 @@ dxf_lwpolyline_set_id_code
 (
         DxfLWPolyline *lwpolyline,
                 /*!< a pointer to a DXF \c LWPOLYLINE entity. */
-        int id_code
+        uint64_t id_code
                 /*!< Identification number for the entity.\n
                  * This is to be an unique (sequential) number in the DXF
                  * file. */
@@ -787,13 +770,6 @@ dxf_lwpolyline_set_id_code
                   __FUNCTION__);
                 return (NULL);
         }
-        if (id_code < 0)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a negative value was passed.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
         lwpolyline->id_code = id_code;
 #if DEBUG
         DXF_DEBUG_END
@@ -835,7 +811,7 @@ dxf_lwpolyline_get_linetype
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (lwpolyline->linetype));
+        return (dxf_strdup (lwpolyline->linetype));
 }
 
 
@@ -869,7 +845,7 @@ dxf_lwpolyline_set_linetype
                   __FUNCTION__);
                 return (NULL);
         }
-        lwpolyline->linetype = strdup (linetype);
+        lwpolyline->linetype = dxf_strdup (linetype);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -910,7 +886,7 @@ dxf_lwpolyline_get_layer
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (lwpolyline->layer));
+        return (dxf_strdup (lwpolyline->layer));
 }
 
 
@@ -944,7 +920,7 @@ dxf_lwpolyline_set_layer
                   __FUNCTION__);
                 return (NULL);
         }
-        lwpolyline->layer = strdup (layer);
+        lwpolyline->layer = dxf_strdup (layer);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1683,10 +1659,8 @@ dxf_lwpolyline_set_binary_graphics_data
  * \c LWPOLYLINE entity.
  *
  * \return soft pointer to the dictionary owner.
- *
- * \warning No checks are performed on the returned pointer (string).
  */
-char *
+uint64_t
 dxf_lwpolyline_get_dictionary_owner_soft
 (
         DxfLWPolyline *lwpolyline
@@ -1702,19 +1676,12 @@ dxf_lwpolyline_get_dictionary_owner_soft
                 fprintf (stderr,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
-                return (NULL);
-        }
-        if (lwpolyline->dictionary_owner_soft ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
+                return (0);
         }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (lwpolyline->dictionary_owner_soft));
+        return (lwpolyline->dictionary_owner_soft);
 }
 
 
@@ -1727,8 +1694,8 @@ dxf_lwpolyline_set_dictionary_owner_soft
 (
         DxfLWPolyline *lwpolyline,
                 /*!< a pointer to a DXF \c LWPOLYLINE entity. */
-        char *dictionary_owner_soft
-                /*!< a string containing the pointer to the
+        uint64_t dictionary_owner_soft
+                /*!< the handle of the
                  * dictionary_owner_soft for the entity. */
 )
 {
@@ -1743,14 +1710,7 @@ dxf_lwpolyline_set_dictionary_owner_soft
                   __FUNCTION__);
                 return (NULL);
         }
-        if (dictionary_owner_soft == NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was passed.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
-        lwpolyline->dictionary_owner_soft = strdup (dictionary_owner_soft);
+        lwpolyline->dictionary_owner_soft = dictionary_owner_soft;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1761,12 +1721,10 @@ dxf_lwpolyline_set_dictionary_owner_soft
 /*!
  * \brief Get the pointer to the \c material from a DXF \c LWPOLYLINE entity.
  *
- * \return a pointer to \c material when successful, or \c NULL when an
+ * \return the handle \c material when successful, or 0 when an
  * error occurred.
- *
- * \warning No checks are performed on the returned pointer.
  */
-char *
+uint64_t
 dxf_lwpolyline_get_material
 (
         DxfLWPolyline *lwpolyline
@@ -1782,19 +1740,12 @@ dxf_lwpolyline_get_material
                 fprintf (stderr,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
-                return (NULL);
-        }
-        if (lwpolyline->material ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
+                return (0);
         }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (lwpolyline->material));
+        return (lwpolyline->material);
 }
 
 
@@ -1810,8 +1761,8 @@ dxf_lwpolyline_set_material
 (
         DxfLWPolyline *lwpolyline,
                 /*!< a pointer to a DXF \c LWPOLYLINE entity. */
-        char *material
-                /*!< a string containing the pointer to the \c
+        uint64_t material
+                /*!< the handle of the \c
                  * material for the entity. */
 )
 {
@@ -1826,14 +1777,7 @@ dxf_lwpolyline_set_material
                   __FUNCTION__);
                 return (NULL);
         }
-        if (material == NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was passed.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
-        lwpolyline->material = strdup (material);
+        lwpolyline->material = material;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1846,10 +1790,8 @@ dxf_lwpolyline_set_material
  * \c LWPOLYLINE entity.
  *
  * \return hard pointer to the dictionary owner.
- *
- * \warning No checks are performed on the returned pointer (string).
  */
-char *
+uint64_t
 dxf_lwpolyline_get_dictionary_owner_hard
 (
         DxfLWPolyline *lwpolyline
@@ -1865,19 +1807,12 @@ dxf_lwpolyline_get_dictionary_owner_hard
                 fprintf (stderr,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
-                return (NULL);
-        }
-        if (lwpolyline->dictionary_owner_hard ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
+                return (0);
         }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (lwpolyline->dictionary_owner_hard));
+        return (lwpolyline->dictionary_owner_hard);
 }
 
 
@@ -1890,8 +1825,8 @@ dxf_lwpolyline_set_dictionary_owner_hard
 (
         DxfLWPolyline *lwpolyline,
                 /*!< a pointer to a DXF \c LWPOLYLINE entity. */
-        char *dictionary_owner_hard
-                /*!< a string containing the pointer to the
+        uint64_t dictionary_owner_hard
+                /*!< the handle of the
                  * dictionary_owner_hard for the entity. */
 )
 {
@@ -1906,14 +1841,7 @@ dxf_lwpolyline_set_dictionary_owner_hard
                   __FUNCTION__);
                 return (NULL);
         }
-        if (dictionary_owner_hard == NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was passed.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
-        lwpolyline->dictionary_owner_hard = strdup (dictionary_owner_hard);
+        lwpolyline->dictionary_owner_hard = dictionary_owner_hard;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1989,10 +1917,10 @@ dxf_lwpolyline_set_lineweight
 /*!
  * \brief Get the \c plot_style_name from a DXF \c LWPOLYLINE entity.
  *
- * \return a pointer to \c plot_style_name when sucessful, or \c NULL
+ * \return the handle \c plot_style_name when sucessful, or 0
  * when an error occurred.
  */
-char *
+uint64_t
 dxf_lwpolyline_get_plot_style_name
 (
         DxfLWPolyline *lwpolyline
@@ -2008,19 +1936,12 @@ dxf_lwpolyline_get_plot_style_name
                 fprintf (stderr,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
-                return (NULL);
-        }
-        if (lwpolyline->plot_style_name ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
+                return (0);
         }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (lwpolyline->plot_style_name));
+        return (lwpolyline->plot_style_name);
 }
 
 
@@ -2035,7 +1956,7 @@ dxf_lwpolyline_set_plot_style_name
 (
         DxfLWPolyline *lwpolyline,
                 /*!< a pointer to a DXF \c LWPOLYLINE entity. */
-        char *plot_style_name
+        uint64_t plot_style_name
                 /*!< a string containing the \c plot_style_name for the
                  * entity. */
 )
@@ -2051,14 +1972,7 @@ dxf_lwpolyline_set_plot_style_name
                   __FUNCTION__);
                 return (NULL);
         }
-        if (plot_style_name == NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was passed.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
-        lwpolyline->plot_style_name = strdup (plot_style_name);
+        lwpolyline->plot_style_name = plot_style_name;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2165,7 +2079,7 @@ dxf_lwpolyline_get_color_name
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (lwpolyline->color_name));
+        return (dxf_strdup (lwpolyline->color_name));
 }
 
 
@@ -2203,7 +2117,7 @@ dxf_lwpolyline_set_color_name
                   __FUNCTION__);
                 return (NULL);
         }
-        lwpolyline->color_name = strdup (color_name);
+        lwpolyline->color_name = dxf_strdup (color_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2470,6 +2384,9 @@ dxf_lwpolyline_get_number_vertices
 /*!
  * \brief Set the \c number_vertices value for a DXF \c LWPOLYLINE
  * entity.
+ *
+ * The vertex arrays are grown when needed, added vertices are not
+ * initialised.
  */
 DxfLWPolyline *
 dxf_lwpolyline_set_number_vertices
@@ -2498,6 +2415,10 @@ dxf_lwpolyline_set_number_vertices
                   __FUNCTION__);
                 return (NULL);
         }
+        if (dxf_lwpolyline_reserve_vertices (lwpolyline, number_vertices) == EXIT_FAILURE)
+        {
+                return (NULL);
+        }
         lwpolyline->number_vertices = number_vertices;
 #if DEBUG
         DXF_DEBUG_END
@@ -2711,15 +2632,143 @@ dxf_lwpolyline_set_extr_z0
 
 
 /*!
- * \brief Get the pointer to the first vertex of a linked list of
- * \c vertices from a DXF \c LWPOLYLINE entity.
+ * \brief Make room for at least \c max_vertices vertices in the vertex
+ * arrays of a DXF \c LWPOLYLINE entity.
  *
- * \return pointer to the first vertex of a linked list of \c vertices.
+ * The \c x, \c y, \c start_width, \c end_width and \c bulge arrays are
+ * grown together, existing vertices are kept.
  *
- * \warning No checks are performed on the returned pointer.
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_lwpolyline_reserve_vertices
+(
+        DxfLWPolyline *lwpolyline,
+                /*!< a pointer to a DXF \c LWPOLYLINE entity. */
+        int max_vertices
+                /*!< the number of vertices to make room for. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        double **arrays[5];
+        double *array;
+        int i;
+
+        /* Do some basic checks. */
+        if (lwpolyline == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        if (max_vertices < 0)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a negative value was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        if (max_vertices <= lwpolyline->max_vertices)
+        {
+                return (EXIT_SUCCESS);
+        }
+        arrays[0] = &lwpolyline->x;
+        arrays[1] = &lwpolyline->y;
+        arrays[2] = &lwpolyline->start_width;
+        arrays[3] = &lwpolyline->end_width;
+        arrays[4] = &lwpolyline->bulge;
+        for (i = 0; i < 5; i++)
+        {
+                array = dxf_realloc (*arrays[i],
+                  lwpolyline->max_vertices * sizeof (double),
+                  max_vertices * sizeof (double));
+                if (array == NULL)
+                {
+                        fprintf (stderr,
+                          (_("Error in %s () could not allocate memory.\n")),
+                          __FUNCTION__);
+                        return (EXIT_FAILURE);
+                }
+                *arrays[i] = array;
+        }
+        lwpolyline->max_vertices = max_vertices;
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Append a vertex to a DXF \c LWPOLYLINE entity.
+ *
+ * \return a pointer to \c lwpolyline when successful, or \c NULL when
+ * an error occurred.
  */
-DxfVertex *
-dxf_lwpolyline_get_vertices
+DxfLWPolyline *
+dxf_lwpolyline_append_vertex
+(
+        DxfLWPolyline *lwpolyline,
+                /*!< a pointer to a DXF \c LWPOLYLINE entity. */
+        double x,
+                /*!< the X-value of the vertex (in OCS). */
+        double y,
+                /*!< the Y-value of the vertex (in OCS). */
+        double start_width,
+                /*!< the start width of the vertex. */
+        double end_width,
+                /*!< the end width of the vertex. */
+        double bulge
+                /*!< the bulge of the vertex. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        int i;
+
+        /* Do some basic checks. */
+        if (lwpolyline == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        i = lwpolyline->number_vertices;
+        if ((i >= lwpolyline->max_vertices)
+          && (dxf_lwpolyline_reserve_vertices (lwpolyline, (i < 4) ? 4 : 2 * i) == EXIT_FAILURE))
+        {
+                return (NULL);
+        }
+        lwpolyline->x[i] = x;
+        lwpolyline->y[i] = y;
+        lwpolyline->start_width[i] = start_width;
+        lwpolyline->end_width[i] = end_width;
+        lwpolyline->bulge[i] = bulge;
+        lwpolyline->number_vertices++;
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (lwpolyline);
+}
+
+
+/*!
+ * \brief Get the array of X-values of the vertices from a DXF
+ * \c LWPOLYLINE entity.
+ *
+ * The array holds \c number_vertices entries (group code 10).
+ *
+ * \return a pointer to the first element of the array, or \c NULL
+ * when the entity has no vertices.
+ */
+double *
+dxf_lwpolyline_get_x
 (
         DxfLWPolyline *lwpolyline
                 /*!< a pointer to a DXF \c LWPOLYLINE entity. */
@@ -2736,32 +2785,61 @@ dxf_lwpolyline_get_vertices
                   __FUNCTION__);
                 return (NULL);
         }
-        if (lwpolyline->vertices == NULL)
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (lwpolyline->x);
+}
+
+
+/*!
+ * \brief Get the array of Y-values of the vertices from a DXF
+ * \c LWPOLYLINE entity.
+ *
+ * The array holds \c number_vertices entries (group code 20).
+ *
+ * \return a pointer to the first element of the array, or \c NULL
+ * when the entity has no vertices.
+ */
+double *
+dxf_lwpolyline_get_y
+(
+        DxfLWPolyline *lwpolyline
+                /*!< a pointer to a DXF \c LWPOLYLINE entity. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        /* Do some basic checks. */
+        if (lwpolyline == NULL)
         {
                 fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found in the vertices member.\n")),
+                  (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return ((DxfVertex *) lwpolyline->vertices);
+        return (lwpolyline->y);
 }
 
 
 /*!
- * \brief Set the pointer to the first vertex of a linked list of
- * \c vertices for a DXF \c LWPOLYLINE entity.
+ * \brief Get the array of start widths of the vertices from a DXF
+ * \c LWPOLYLINE entity.
+ *
+ * The array holds \c number_vertices entries (group code 40).
+ *
+ * \return a pointer to the first element of the array, or \c NULL
+ * when the entity has no vertices.
  */
-DxfLWPolyline *
-dxf_lwpolyline_set_vertices
+double *
+dxf_lwpolyline_get_start_width
 (
-        DxfLWPolyline *lwpolyline,
+        DxfLWPolyline *lwpolyline
                 /*!< a pointer to a DXF \c LWPOLYLINE entity. */
-        DxfVertex *vertices
-                /*!< a pointer to the first vertex of a linked list of
-                 * \c vertices. */
 )
 {
 #if DEBUG
@@ -2775,18 +2853,78 @@ dxf_lwpolyline_set_vertices
                   __FUNCTION__);
                 return (NULL);
         }
-        if (vertices == NULL)
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (lwpolyline->start_width);
+}
+
+
+/*!
+ * \brief Get the array of end widths of the vertices from a DXF
+ * \c LWPOLYLINE entity.
+ *
+ * The array holds \c number_vertices entries (group code 41).
+ *
+ * \return a pointer to the first element of the array, or \c NULL
+ * when the entity has no vertices.
+ */
+double *
+dxf_lwpolyline_get_end_width
+(
+        DxfLWPolyline *lwpolyline
+                /*!< a pointer to a DXF \c LWPOLYLINE entity. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        /* Do some basic checks. */
+        if (lwpolyline == NULL)
         {
                 fprintf (stderr,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
-        lwpolyline->vertices = (struct DxfVertex *) vertices;
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (lwpolyline);
+        return (lwpolyline->end_width);
+}
+
+
+/*!
+ * \brief Get the array of bulges of the vertices from a DXF
+ * \c LWPOLYLINE entity.
+ *
+ * The array holds \c number_vertices entries (group code 42).
+ *
+ * \return a pointer to the first element of the array, or \c NULL
+ * when the entity has no vertices.
+ */
+double *
+dxf_lwpolyline_get_bulge
+(
+        DxfLWPolyline *lwpolyline
+                /*!< a pointer to a DXF \c LWPOLYLINE entity. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        /* Do some basic checks. */
+        if (lwpolyline == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (lwpolyline->bulge);
 }
 
 
@@ -2914,4 +3052,155 @@ dxf_lwpolyline_get_last
 }
 
 
+/*!
+ * \brief Get the bounding box of a DXF \c LWPOLYLINE.
+ *
+ * The box of the straight and arc segments of \c lwpolyline at it's
+ * elevation, including the closing segment of a closed
+ * \c lwpolyline, see dxf_bbox_add_bulge ().\n
+ * An \c lwpolyline without vertices gives an empty box.\n
+ * The box is computed in the Object Coordinate System (OCS) of
+ * \c lwpolyline and mapped to world coordinates, see
+ * dxf_bbox_ocs_to_wcs ().\n
+ * \todo Take the widths into account.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_lwpolyline_get_bbox
+(
+        DxfLWPolyline *lwpolyline,
+                /*!< a pointer to a DXF \c LWPOLYLINE entity. */
+        DxfBbox *bbox
+                /*!< a pointer to the libDXF bounding box to fill. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfVec3 extrusion;
+        int i;
+        int j;
+
+        /* Do some basic checks. */
+        if ((lwpolyline == NULL) || (bbox == NULL))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        dxf_bbox_init (bbox);
+        for (i = 0; i < lwpolyline->number_vertices; i++)
+        {
+                if (i + 1 < lwpolyline->number_vertices)
+                {
+                        j = i + 1;
+                }
+                else if ((lwpolyline->flag & 1) && (i > 0))
+                {
+                        j = 0;
+                }
+                else
+                {
+                        dxf_bbox_add_point (bbox, lwpolyline->x[i],
+                          lwpolyline->y[i], lwpolyline->elevation);
+                        continue;
+                }
+                dxf_bbox_add_bulge (bbox, lwpolyline->x[i], lwpolyline->y[i],
+                  lwpolyline->x[j], lwpolyline->y[j], lwpolyline->elevation,
+                  (lwpolyline->bulge != NULL) ? lwpolyline->bulge[i] : 0.0);
+        }
+        extrusion.x = lwpolyline->extr_x0;
+        extrusion.y = lwpolyline->extr_y0;
+        extrusion.z = lwpolyline->extr_z0;
+        dxf_bbox_ocs_to_wcs (bbox, &extrusion);
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Transform a DXF \c LWPOLYLINE entity in place.
+ *
+ * The entity lies in the plane of it's Object Coordinate System
+ * (OCS), \c transform has to map this plane with a uniform scale,
+ * see dxf_transform_get_ocs_transform ().\n
+ * The vertices are transformed in one batch with
+ * dxf_transform_apply_arrays (), widths scale with the entity.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred, or when \c transform does not map the entity without
+ * distortion.
+ */
+int
+dxf_lwpolyline_transform
+(
+        DxfLWPolyline *lwpolyline,
+                /*!< a pointer to a DXF \c LWPOLYLINE entity. */
+        DxfTransform *transform
+                /*!< a pointer to a libDXF affine transformation. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfTransform ocs;
+        DxfVec3 extrusion;
+        double scale;
+        int i;
+
+        /* Do some basic checks. */
+        if ((lwpolyline == NULL) || (transform == NULL))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        extrusion.x = lwpolyline->extr_x0;
+        extrusion.y = lwpolyline->extr_y0;
+        extrusion.z = lwpolyline->extr_z0;
+        if (dxf_transform_get_ocs_transform (transform, &extrusion, &ocs, &scale) == EXIT_FAILURE)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () the transformation distorts the LWPOLYLINE entity with id-code: %" PRIx64 "\n")),
+                  __FUNCTION__, lwpolyline->id_code);
+                return (EXIT_FAILURE);
+        }
+        /* Move the elevation into the translation, the vertices
+         * are in the plane Z = 0 then. */
+        for (i = 0; i < 3; i++)
+        {
+                ocs.m[i][3] += ocs.m[i][2] * lwpolyline->elevation;
+        }
+        dxf_transform_apply_arrays (&ocs, lwpolyline->x, lwpolyline->y,
+          NULL, (size_t) lwpolyline->number_vertices);
+        lwpolyline->elevation = ocs.m[2][3];
+        lwpolyline->constant_width *= scale;
+        for (i = 0; i < lwpolyline->number_vertices; i++)
+        {
+                if (lwpolyline->start_width != NULL)
+                {
+                        lwpolyline->start_width[i] *= scale;
+                }
+                if (lwpolyline->end_width != NULL)
+                {
+                        lwpolyline->end_width[i] *= scale;
+                }
+        }
+        lwpolyline->extr_x0 = extrusion.x;
+        lwpolyline->extr_y0 = extrusion.y;
+        lwpolyline->extr_z0 = extrusion.z;
+        lwpolyline->thickness *= ocs.m[2][2];
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (EXIT_SUCCESS);
+}
+
+
 /* EOF */
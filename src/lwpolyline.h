@@ -48,6 +48,7 @@
 #include "global.h"
 #include "point.h"
 #include "binary_data.h"
+#include "transform.h"
 #include "vertex.h"
 
 
@@ -63,7 +64,7 @@ typedef struct
 dxf_lwpolyline_struct
 {
         /* Members common for all DXF drawable entities. */
-        int id_code;
+        uint64_t id_code;
                 /*!< Identification number for the entity.\n
                  * This is to be an unique (sequential) number in the DXF
                  * file.\n
@@ -136,20 +137,20 @@ dxf_lwpolyline_struct
                  * (optional).\n
                  * Group code = 310.\n
                  * \since Introduced in version R2000. */
-        char *dictionary_owner_soft;
+        uint64_t dictionary_owner_soft;
                 /*!< Soft-pointer ID/handle to owner dictionary (optional).\n
                  * Group code = 330.\n
                  * \since Introduced in version R14. */
-        char *object_owner_soft;
+        uint64_t object_owner_soft;
                 /*!< Soft-pointer ID/handle  to owner BLOCK_RECORD object.\n
                  * Group code = 330.\n
                  * \since Introduced in version R2000. */
-        char *material;
+        uint64_t material;
                 /*!< Hard-pointer ID/handle to material object (present if
                  * not BYLAYER).\n
                  * Group code = 347.\n
                  * \since Introduced in version R2008. */
-        char *dictionary_owner_hard;
+        uint64_t dictionary_owner_hard;
                 /*!< Hard owner ID/handle to owner dictionary (optional).\n
                  * Group code = 360.\n
                  * \since Introduced in version R14. */
@@ -158,7 +159,7 @@ dxf_lwpolyline_struct
                  * Stored and moved around as a 16-bit integer.\n
                  * Group code = 370.\n
                  * \since Introduced in version R2002. */
-        char *plot_style_name;
+        uint64_t plot_style_name;
                 /*!< Hard pointer ID / handle of PlotStyleName object.\n
                  * Group code = 390.\n
                  * \since Introduced in version R2009. */
@@ -221,11 +222,32 @@ dxf_lwpolyline_struct
         double extr_z0;
                 /*!< DXF: Z value of extrusion direction (optional).\n
                  * Group code = 230. */
-        struct DxfVertex *vertices;
-                /*!< Pointer to the first DxfVertex of the lwpolyline.\n
-                 * \c NULL in the last DxfVertex.\n
-                 * \note Not all members of the DxfVertex struct are
-                 * used for lwpolylines. */
+        int max_vertices;
+                /*!< Number of vertices allocated in the vertex arrays.\n
+                 * Always at least \c number_vertices. */
+        double *x;
+                /*!< X-values of the vertices (\c number_vertices
+                 * entries, in OCS).\n
+                 * Group code = 10. */
+        double *y;
+                /*!< Y-values of the vertices (\c number_vertices
+                 * entries, in OCS).\n
+                 * Group code = 20. */
+        double *start_width;
+                /*!< Start widths of the vertices (\c number_vertices
+                 * entries).\n
+                 * Defaults to \c constant_width.\n
+                 * Group code = 40. */
+        double *end_width;
+                /*!< End widths of the vertices (\c number_vertices
+                 * entries).\n
+                 * Defaults to \c constant_width.\n
+                 * Group code = 41. */
+        double *bulge;
+                /*!< Bulges of the vertices (\c number_vertices
+                 * entries).\n
+                 * Defaults to 0.0.\n
+                 * Group code = 42. */
         struct DxfLWPolyline *next;
                 /*!< Pointer to the next DxfLWPolyline.\n
                  * \c NULL in the last DxfLWPolyline. */
@@ -238,8 +260,8 @@ DxfLWPolyline *dxf_lwpolyline_read (DxfFile *fp, DxfLWPolyline *lwpolyline);
 int dxf_lwpolyline_write (DxfFile *fp, DxfLWPolyline *lwpolyline);
 int dxf_lwpolyline_free (DxfLWPolyline *lwpolyline);
 void dxf_lwpolyline_free_list (DxfLWPolyline *lwpolylines);
-int dxf_lwpolyline_get_id_code (DxfLWPolyline *lwpolyline);
-DxfLWPolyline *dxf_lwpolyline_set_id_code (DxfLWPolyline *lwpolyline, int id_code);
+uint64_t dxf_lwpolyline_get_id_code (DxfLWPolyline *lwpolyline);
+DxfLWPolyline *dxf_lwpolyline_set_id_code (DxfLWPolyline *lwpolyline, uint64_t id_code);
 char *dxf_lwpolyline_get_linetype (DxfLWPolyline *lwpolyline);
 DxfLWPolyline *dxf_lwpolyline_set_linetype (DxfLWPolyline *lwpolyline, char *linetype);
 char *dxf_lwpolyline_get_layer (DxfLWPolyline *lwpolyline);
@@ -262,16 +284,16 @@ int16_t dxf_lwpolyline_get_shadow_mode (DxfLWPolyline *lwpolyline);
 DxfLWPolyline *dxf_lwpolyline_set_shadow_mode (DxfLWPolyline *lwpolyline, int16_t shadow_mode);
 DxfBinaryData *dxf_lwpolyline_get_binary_graphics_data (DxfLWPolyline *lwpolyline);
 DxfLWPolyline *dxf_lwpolyline_set_binary_graphics_data (DxfLWPolyline *lwpolyline, DxfBinaryData *data);
-char *dxf_lwpolyline_get_dictionary_owner_soft (DxfLWPolyline *lwpolyline);
-DxfLWPolyline *dxf_lwpolyline_set_dictionary_owner_soft (DxfLWPolyline *lwpolyline, char *dictionary_owner_soft);
-char *dxf_lwpolyline_get_material (DxfLWPolyline *lwpolyline);
-DxfLWPolyline *dxf_lwpolyline_set_material (DxfLWPolyline *lwpolyline, char *material);
-char *dxf_lwpolyline_get_dictionary_owner_hard (DxfLWPolyline *lwpolyline);
-DxfLWPolyline *dxf_lwpolyline_set_dictionary_owner_hard (DxfLWPolyline *lwpolyline, char *dictionary_owner_hard);
+uint64_t dxf_lwpolyline_get_dictionary_owner_soft (DxfLWPolyline *lwpolyline);
+DxfLWPolyline *dxf_lwpolyline_set_dictionary_owner_soft (DxfLWPolyline *lwpolyline, uint64_t dictionary_owner_soft);
+uint64_t dxf_lwpolyline_get_material (DxfLWPolyline *lwpolyline);
+DxfLWPolyline *dxf_lwpolyline_set_material (DxfLWPolyline *lwpolyline, uint64_t material);
+uint64_t dxf_lwpolyline_get_dictionary_owner_hard (DxfLWPolyline *lwpolyline);
+DxfLWPolyline *dxf_lwpolyline_set_dictionary_owner_hard (DxfLWPolyline *lwpolyline, uint64_t dictionary_owner_hard);
 int16_t dxf_lwpolyline_get_lineweight (DxfLWPolyline *lwpolyline);
 DxfLWPolyline *dxf_lwpolyline_set_lineweight (DxfLWPolyline *lwpolyline, int16_t lineweight);
-char *dxf_lwpolyline_get_plot_style_name (DxfLWPolyline *lwpolyline);
-DxfLWPolyline *dxf_lwpolyline_set_plot_style_name (DxfLWPolyline *lwpolyline, char *plot_style_name);
+uint64_t dxf_lwpolyline_get_plot_style_name (DxfLWPolyline *lwpolyline);
+DxfLWPolyline *dxf_lwpolyline_set_plot_style_name (DxfLWPolyline *lwpolyline, uint64_t plot_style_name);
 int32_t dxf_lwpolyline_get_color_value (DxfLWPolyline *lwpolyline);
 DxfLWPolyline *dxf_lwpolyline_set_color_value (DxfLWPolyline *lwpolyline, int32_t color_value);
 char *dxf_lwpolyline_get_color_name (DxfLWPolyline *lwpolyline);
@@ -290,11 +312,18 @@ double dxf_lwpolyline_get_extr_y0 (DxfLWPolyline *lwpolyline);
 DxfLWPolyline *dxf_lwpolyline_set_extr_y0 (DxfLWPolyline *lwpolyline, double extr_y0);
 double dxf_lwpolyline_get_extr_z0 (DxfLWPolyline *lwpolyline);
 DxfLWPolyline *dxf_lwpolyline_set_extr_z0 (DxfLWPolyline *lwpolyline, double extr_z0);
-DxfVertex *dxf_lwpolyline_get_vertices (DxfLWPolyline *lwpolyline);
-DxfLWPolyline *dxf_lwpolyline_set_vertices (DxfLWPolyline *lwpolyline, DxfVertex *vertices);
+int dxf_lwpolyline_reserve_vertices (DxfLWPolyline *lwpolyline, int max_vertices);
+DxfLWPolyline *dxf_lwpolyline_append_vertex (DxfLWPolyline *lwpolyline, double x, double y, double start_width, double end_width, double bulge);
+double *dxf_lwpolyline_get_x (DxfLWPolyline *lwpolyline);
+double *dxf_lwpolyline_get_y (DxfLWPolyline *lwpolyline);
+double *dxf_lwpolyline_get_start_width (DxfLWPolyline *lwpolyline);
+double *dxf_lwpolyline_get_end_width (DxfLWPolyline *lwpolyline);
+double *dxf_lwpolyline_get_bulge (DxfLWPolyline *lwpolyline);
 DxfLWPolyline *dxf_lwpolyline_get_next (DxfLWPolyline *lwpolyline);
 DxfLWPolyline *dxf_lwpolyline_set_next (DxfLWPolyline *lwpolyline, DxfLWPolyline *next);
 DxfLWPolyline *dxf_lwpolyline_get_last (DxfLWPolyline *lwpolyline);
+int dxf_lwpolyline_get_bbox (DxfLWPolyline *lwpolyline, DxfBbox *bbox);
+int dxf_lwpolyline_transform (DxfLWPolyline *lwpolyline, DxfTransform *transform);
 
 
 #ifdef __cplusplus
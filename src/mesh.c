@@ -58,7 +58,7 @@ dxf_mesh_new ()
         size = sizeof (DxfMesh);
         /* avoid malloc of 0 bytes */
         if (size == 0) size = 1;
-        if ((mesh = malloc (size)) == NULL)
+        if ((mesh = dxf_malloc (size)) == NULL)
         {
                 fprintf (stderr,
                   (_("Error in %s () could not allocate memory.\n")),
@@ -109,9 +109,9 @@ dxf_mesh_init
                 return (NULL);
         }
         /* Assign initial values to members. */
-        mesh->id_code = 0;
-        mesh->linetype = strdup (DXF_DEFAULT_LINETYPE);
-        mesh->layer = strdup (DXF_DEFAULT_LAYER);
+        mesh->id_code = DXF_HANDLE_NONE;
+        mesh->linetype = dxf_strdup (DXF_DEFAULT_LINETYPE);
+        mesh->layer = dxf_strdup (DXF_DEFAULT_LAYER);
         mesh->elevation = 0.0;
         mesh->thickness = 0.0;
         mesh->linetype_scale = DXF_DEFAULT_LINETYPE_SCALE;
@@ -120,14 +120,14 @@ dxf_mesh_init
         mesh->paperspace = DXF_MODELSPACE;
         mesh->graphics_data_size = 0;
         mesh->shadow_mode = 0;
-        mesh->dictionary_owner_soft = strdup ("");
-        mesh->object_owner_soft = strdup ("");
-        mesh->material = strdup ("");
-        mesh->dictionary_owner_hard = strdup ("");
+        mesh->dictionary_owner_soft = 0;
+        mesh->object_owner_soft = 0;
+        mesh->material = 0;
+        mesh->dictionary_owner_hard = 0;
         mesh->lineweight = 0;
-        mesh->plot_style_name = strdup ("");
+        mesh->plot_style_name = 0;
         mesh->color_value = 0;
-        mesh->color_name = strdup ("");
+        mesh->color_name = dxf_strdup ("");
         mesh->transparency = 0;
         mesh->p0 = dxf_point_new ();
         mesh->p0 = dxf_point_init (mesh->p0);
@@ -185,7 +185,8 @@ dxf_mesh_read
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        char *temp_string = NULL;
+        char temp_string[DXF_MAX_STRING_LENGTH];
+        int group_code;
         DxfBinaryData *iter310 = NULL;
         int iter330;
 
@@ -195,8 +196,6 @@ dxf_mesh_read
                 fprintf (stderr,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
-                /* Clean up. */
-                free (temp_string);
                 return (NULL);
         }
         if (mesh == NULL)
@@ -219,8 +218,6 @@ dxf_mesh_read
                         fprintf (stderr,
                           (_("Error in %s () could not allocate memory.\n")),
                           __FUNCTION__);
-                        /* Clean up. */
-                        free (temp_string);
                         return (NULL);
                 }
         }
@@ -237,247 +234,208 @@ dxf_mesh_read
                         fprintf (stderr,
                           (_("Error in %s () could not allocate memory.\n")),
                           __FUNCTION__);
-                        /* Clean up. */
-                        free (temp_string);
                         return (NULL);
                 }
         }
         iter310 = (DxfBinaryData *) mesh->binary_graphics_data;
         iter330 = 0;
-        (fp->line_number)++;
-        fscanf (fp->fp, "%[^\n]", temp_string);
-        while (strcmp (temp_string, "0") != 0)
+        while ((dxf_read_group_code (fp, &group_code) == EXIT_SUCCESS)
+          && (group_code != 0))
         {
-                if (ferror (fp->fp))
+                if (dxf_read_error (fp))
                 {
                         fprintf (stderr,
                           (_("Error in %s () while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
-                        fclose (fp->fp);
-                        /* Clean up. */
-                        free (temp_string);
                         return (NULL);
                 }
-                if (strcmp (temp_string, "5") == 0)
-                {
-                        /* Now follows a string containing a sequential
-                         * id number. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%x\n", (uint *) &mesh->id_code);
-                }
-                else if (strcmp (temp_string, "6") == 0)
-                {
-                        /* Now follows a string containing a linetype
-                         * name. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, mesh->linetype);
-                }
-                else if (strcmp (temp_string, "8") == 0)
-                {
-                        /* Now follows a string containing a layer name. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, mesh->layer);
-                }
-                else if (strcmp (temp_string, "10") == 0)
-                {
-                        /* Now follows a string containing the
-                         * X-coordinate of the center point. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &mesh->p0->x0);
-                }
-                else if (strcmp (temp_string, "20") == 0)
-                {
-                        /* Now follows a string containing the
-                         * Y-coordinate of the center point. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &mesh->p0->y0);
-                }
-                else if (strcmp (temp_string, "30") == 0)
-                {
-                        /* Now follows a string containing the
-                         * Z-coordinate of the center point. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &mesh->p0->z0);
-                }
-                else if ((fp->acad_version_number <= AutoCAD_11)
-                        && (strcmp (temp_string, "38") == 0))
-                {
-                        /* Now follows a string containing the
-                         * elevation. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &mesh->elevation);
-                }
-                else if (strcmp (temp_string, "39") == 0)
-                {
-                        /* Now follows a string containing the
-                         * thickness. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &mesh->thickness);
-                }
-                else if (strcmp (temp_string, "48") == 0)
-                {
-                        /* Now follows a string containing the linetype
-                         * scale. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &mesh->linetype_scale);
-                }
-                else if (strcmp (temp_string, "60") == 0)
+                switch (group_code)
                 {
-                        /* Now follows a string containing the
-                         * visibility value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%hd\n", &mesh->visibility);
-                }
-                else if (strcmp (temp_string, "62") == 0)
-                {
-                        /* Now follows a string containing the
-                         * color value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%d\n", &mesh->color);
-                }
-                else if (strcmp (temp_string, "67") == 0)
-                {
-                        /* Now follows a string containing the
-                         * paperspace value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%d\n", &mesh->paperspace);
-                }
-                /*! \todo Implement Group codes 90 - 95 in a proper way. */
-                else if (strcmp (temp_string, "92") == 0)
-                {
-                        /* Now follows a string containing the
-                         * graphics data size value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%d\n", &mesh->graphics_data_size);
-                }
-                else if ((fp->acad_version_number >= AutoCAD_13)
-                        && (strcmp (temp_string, "100") == 0))
-                {
-                        /* Now follows a string containing the
-                         * subclass marker value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
-                        if (strcmp (temp_string, "AcDbSubMesh") != 0)
-                        {
+                        case 5:
+                                /* Now follows a string containing a sequential
+                                 * id number. */
+                                dxf_read_handle (fp, &mesh->id_code);
+                                break;
+                        case 6:
+                                /* Now follows a string containing a linetype
+                                 * name. */
+                                dxf_read_string_interned (fp, &mesh->linetype);
+                                break;
+                        case 8:
+                                /* Now follows a string containing a layer name. */
+                                dxf_read_string_interned (fp, &mesh->layer);
+                                break;
+                        case 10:
+                                /* Now follows a string containing the
+                                 * X-coordinate of the center point. */
+                                dxf_read_double (fp, &mesh->p0->x0);
+                                break;
+                        case 20:
+                                /* Now follows a string containing the
+                                 * Y-coordinate of the center point. */
+                                dxf_read_double (fp, &mesh->p0->y0);
+                                break;
+                        case 30:
+                                /* Now follows a string containing the
+                                 * Z-coordinate of the center point. */
+                                dxf_read_double (fp, &mesh->p0->z0);
+                                break;
+                        case 38:
+                                if (fp->acad_version_number <= AutoCAD_11)
+                                {
+                                        /* Now follows a string containing the
+                                         * elevation. */
+                                        dxf_read_double (fp, &mesh->elevation);
+                                }
+                                else
+                                {
+                                        fprintf (stderr,
+                                          (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
+                                          __FUNCTION__, fp->filename, fp->line_number);
+                                        /* Skip the value of the unknown group code. */
+                                        dxf_read_line (temp_string, fp);
+                                }
+                                break;
+                        case 39:
+                                /* Now follows a string containing the
+                                 * thickness. */
+                                dxf_read_double (fp, &mesh->thickness);
+                                break;
+                        case 48:
+                                /* Now follows a string containing the linetype
+                                 * scale. */
+                                dxf_read_double (fp, &mesh->linetype_scale);
+                                break;
+                        case 60:
+                                /* Now follows a string containing the
+                                 * visibility value. */
+                                dxf_read_int16 (fp, &mesh->visibility);
+                                break;
+                        case 62:
+                                /* Now follows a string containing the
+                                 * color value. */
+                                dxf_read_int (fp, &mesh->color);
+                                break;
+                        case 67:
+                                /* Now follows a string containing the
+                                 * paperspace value. */
+                                dxf_read_int (fp, &mesh->paperspace);
+                                break;
+                        case 92:
+                                /*! \todo Implement Group codes 90 - 95 in a proper way. */
+                                /* Now follows a string containing the
+                                 * graphics data size value. */
+                                dxf_read_int (fp, &mesh->graphics_data_size);
+                                break;
+                        case 100:
+                                if (fp->acad_version_number >= AutoCAD_13)
+                                {
+                                        /* Now follows a string containing the
+                                         * subclass marker value. */
+                                        dxf_read_line (temp_string, fp);
+                                        if (strcmp (temp_string, "AcDbSubMesh") != 0)
+                                        {
+                                                fprintf (stderr,
+                                                  (_("Warning in %s () found a bad subclass marker in: %s in line: %d.\n")),
+                                                  __FUNCTION__, fp->filename, fp->line_number);
+                                        }
+                                }
+                                else
+                                {
+                                        fprintf (stderr,
+                                          (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
+                                          __FUNCTION__, fp->filename, fp->line_number);
+                                        /* Skip the value of the unknown group code. */
+                                        dxf_read_line (temp_string, fp);
+                                }
+                                break;
+                        case 160:
+                                /* Now follows a string containing the
+                                 * graphics data size value. */
+                                dxf_read_int (fp, &mesh->graphics_data_size);
+                                break;
+                        case 284:
+                                /* Now follows a string containing the shadow
+                                 * mode value. */
+                                dxf_read_int16 (fp, &mesh->shadow_mode);
+                                break;
+                        case 310:
+                                /* Now follows a string containing binary
+                                 * graphics data. */
+                                iter310 = dxf_binary_data_read (fp, iter310);
+                                break;
+                        case 330:
+                                if (iter330 == 0)
+                                {
+                                        /* Now follows a string containing a soft-pointer
+                                         * ID/handle to owner dictionary. */
+                                        dxf_read_handle (fp, &mesh->dictionary_owner_soft);
+                                }
+                                if (iter330 == 1)
+                                {
+                                        /* Now follows a string containing a soft-pointer
+                                         * ID/handle to owner object. */
+                                        dxf_read_handle (fp, &mesh->object_owner_soft);
+                                }
+                                iter330++;
+                                break;
+                        case 347:
+                                /* Now follows a string containing a
+                                 * hard-pointer ID/handle to material object. */
+                                dxf_read_handle (fp, &mesh->material);
+                                break;
+                        case 360:
+                                /* Now follows a string containing Hard owner
+                                 * ID/handle to owner dictionary. */
+                                dxf_read_handle (fp, &mesh->dictionary_owner_hard);
+                                break;
+                        case 370:
+                                /* Now follows a string containing the lineweight
+                                 * value. */
+                                dxf_read_int16 (fp, &mesh->lineweight);
+                                break;
+                        case 390:
+                                /* Now follows a string containing a plot style
+                                 * name value. */
+                                dxf_read_handle (fp, &mesh->plot_style_name);
+                                break;
+                        case 420:
+                                /* Now follows a string containing a color value. */
+                                dxf_read_long (fp, &mesh->color_value);
+                                break;
+                        case 430:
+                                /* Now follows a string containing a color
+                                 * name value. */
+                                dxf_read_string_interned (fp, &mesh->color_name);
+                                break;
+                        case 440:
+                                /* Now follows a string containing a transparency
+                                 * value. */
+                                dxf_read_long (fp, &mesh->transparency);
+                                break;
+                        case 999:
+                                /* Now follows a string containing a comment. */
+                                dxf_read_line (temp_string, fp);
+                                fprintf (stdout, "DXF comment: %s\n", temp_string);
+                                break;
+                        default:
                                 fprintf (stderr,
-                                  (_("Warning in %s () found a bad subclass marker in: %s in line: %d.\n")),
+                                  (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
                                   __FUNCTION__, fp->filename, fp->line_number);
-                        }
-                }
-                else if (strcmp (temp_string, "160") == 0)
-                {
-                        /* Now follows a string containing the
-                         * graphics data size value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%d\n", &mesh->graphics_data_size);
-                }
-                else if (strcmp (temp_string, "284") == 0)
-                {
-                        /* Now follows a string containing the shadow
-                         * mode value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%hd\n", &mesh->shadow_mode);
-                }
-                else if (strcmp (temp_string, "310") == 0)
-                {
-                        /* Now follows a string containing binary
-                         * graphics data. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, iter310->data_line);
-                        dxf_binary_data_init ((DxfBinaryData *) iter310->next);
-                        iter310 = (DxfBinaryData *) iter310->next;
-                }
-                else if (strcmp (temp_string, "330") == 0)
-                {
-                        if (iter330 == 0)
-                        {
-                                /* Now follows a string containing a soft-pointer
-                                 * ID/handle to owner dictionary. */
-                                (fp->line_number)++;
-                                fscanf (fp->fp, DXF_MAX_STRING_FORMAT, mesh->dictionary_owner_soft);
-                        }
-                        if (iter330 == 1)
-                        {
-                                /* Now follows a string containing a soft-pointer
-                                 * ID/handle to owner object. */
-                                (fp->line_number)++;
-                                fscanf (fp->fp, DXF_MAX_STRING_FORMAT, mesh->object_owner_soft);
-                        }
-                        iter330++;
-                }
-                else if (strcmp (temp_string, "347") == 0)
-                {
-                        /* Now follows a string containing a
-                         * hard-pointer ID/handle to material object. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, mesh->material);
-                }
-                else if (strcmp (temp_string, "360") == 0)
-                {
-                        /* Now follows a string containing Hard owner
-                         * ID/handle to owner dictionary. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, mesh->dictionary_owner_hard);
-                }
-                else if (strcmp (temp_string, "370") == 0)
-                {
-                        /* Now follows a string containing the lineweight
-                         * value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%hd\n", &mesh->lineweight);
-                }
-                else if (strcmp (temp_string, "390") == 0)
-                {
-                        /* Now follows a string containing a plot style
-                         * name value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, mesh->plot_style_name);
-                }
-                else if (strcmp (temp_string, "420") == 0)
-                {
-                        /* Now follows a string containing a color value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%ld\n", &mesh->color_value);
-                }
-                else if (strcmp (temp_string, "430") == 0)
-                {
-                        /* Now follows a string containing a color
-                         * name value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, mesh->color_name);
-                }
-                else if (strcmp (temp_string, "440") == 0)
-                {
-                        /* Now follows a string containing a transparency
-                         * value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%ld\n", &mesh->transparency);
-                }
-                else if (strcmp (temp_string, "999") == 0)
-                {
-                        /* Now follows a string containing a comment. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
-                        fprintf (stdout, "DXF comment: %s\n", temp_string);
-                }
-                else
-                {
-                        fprintf (stderr,
-                          (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
-                          __FUNCTION__, fp->filename, fp->line_number);
+                                /* Skip the value of the unknown group code. */
+                                dxf_read_line (temp_string, fp);
+                                break;
                 }
         }
         /* Handle omitted members and/or illegal values. */
         if (strcmp (mesh->linetype, "") == 0)
         {
-                mesh->linetype = strdup (DXF_DEFAULT_LINETYPE);
+                mesh->linetype = dxf_strdup (DXF_DEFAULT_LINETYPE);
         }
         if (strcmp (mesh->layer, "") == 0)
         {
-                mesh->layer = strdup (DXF_DEFAULT_LAYER);
+                mesh->layer = dxf_strdup (DXF_DEFAULT_LAYER);
         }
-        /* Clean up. */
-        free (temp_string);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -503,7 +461,7 @@ dxf_mesh_write
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        char *dxf_entity_name = strdup ("MESH");
+        char *dxf_entity_name = dxf_strdup ("MESH");
 
         /* Do some basic checks. */
         if (fp == NULL)
@@ -512,7 +470,7 @@ dxf_mesh_write
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (mesh == NULL)
@@ -521,7 +479,7 @@ dxf_mesh_write
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (mesh->p0 == NULL)
@@ -530,23 +488,23 @@ dxf_mesh_write
                   (_("Error in %s () a NULL pointer was found.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (strcmp (mesh->linetype, "") == 0)
         {
                 fprintf (stderr,
-                  (_("Warning in %s () empty linetype string for the %s entity with id-code: %x\n")),
+                  (_("Warning in %s () empty linetype string for the %s entity with id-code: %" PRIx64 "\n")),
                   __FUNCTION__, dxf_entity_name, mesh->id_code);
                 fprintf (stderr,
                   (_("\t%s entity is reset to default linetype")),
                   dxf_entity_name);
-                mesh->linetype = strdup (DXF_DEFAULT_LINETYPE);
+                mesh->linetype = dxf_strdup (DXF_DEFAULT_LINETYPE);
         }
         if (strcmp (mesh->layer, "") == 0)
         {
                 fprintf (stderr,
-                  (_("Warning in %s () empty layer string for the %s entity with id-code: %x\n")),
+                  (_("Warning in %s () empty layer string for the %s entity with id-code: %" PRIx64 "\n")),
                   __FUNCTION__, dxf_entity_name, mesh->id_code);
                 fprintf (stderr,
                   (_("\t%s entity is relocated to layer 0")),
@@ -554,10 +512,10 @@ dxf_mesh_write
                 mesh->layer = DXF_DEFAULT_LAYER;
         }
         /* Start writing output. */
-        fprintf (fp->fp, "  0\n%s\n", dxf_entity_name);
-        if (mesh->id_code != -1)
+        dxf_write_string (fp, 0, dxf_entity_name);
+        if (mesh->id_code != DXF_HANDLE_NONE)
         {
-                fprintf (fp->fp, "  5\n%x\n", mesh->id_code);
+                dxf_write_hex (fp, 5, mesh->id_code);
         }
         /*!
          * \todo for version R14.\n
@@ -569,71 +527,71 @@ dxf_mesh_write
          * 102 groups are application defined (optional).\n\n
          * End of group, "}" (optional), with Group code 102.
          */
-        if ((strcmp (mesh->dictionary_owner_soft, "") != 0)
+        if ((mesh->dictionary_owner_soft != 0)
           && (fp->acad_version_number >= AutoCAD_14))
         {
-                fprintf (fp->fp, "102\n{ACAD_REACTORS\n");
-                fprintf (fp->fp, "330\n%s\n", mesh->dictionary_owner_soft);
-                fprintf (fp->fp, "102\n}\n");
+                dxf_write_string (fp, 102, "{ACAD_REACTORS");
+                dxf_write_hex (fp, 330, mesh->dictionary_owner_soft);
+                dxf_write_string (fp, 102, "}");
         }
-        if ((strcmp (mesh->dictionary_owner_hard, "") != 0)
+        if ((mesh->dictionary_owner_hard != 0)
           && (fp->acad_version_number >= AutoCAD_14))
         {
-                fprintf (fp->fp, "102\n{ACAD_XDICTIONARY\n");
-                fprintf (fp->fp, "360\n%s\n", mesh->dictionary_owner_hard);
-                fprintf (fp->fp, "102\n}\n");
+                dxf_write_string (fp, 102, "{ACAD_XDICTIONARY");
+                dxf_write_hex (fp, 360, mesh->dictionary_owner_hard);
+                dxf_write_string (fp, 102, "}");
         }
-        if ((strcmp (mesh->object_owner_soft, "") != 0)
+        if ((mesh->object_owner_soft != 0)
           && (fp->acad_version_number >= AutoCAD_2000))
         {
-                fprintf (fp->fp, "330\n%s\n", mesh->object_owner_soft);
+                dxf_write_hex (fp, 330, mesh->object_owner_soft);
         }
         if (fp->acad_version_number >= AutoCAD_13)
         {
-                fprintf (fp->fp, "100\nAcDbEntity\n");
+                dxf_write_string (fp, 100, "AcDbEntity");
         }
         if (mesh->paperspace == DXF_PAPERSPACE)
         {
-                fprintf (fp->fp, " 67\n%d\n", (int16_t) DXF_PAPERSPACE);
+                dxf_write_int (fp, 67, (int16_t) DXF_PAPERSPACE);
         }
-        fprintf (fp->fp, "  8\n%s\n", mesh->layer);
+        dxf_write_string (fp, 8, mesh->layer);
         if (strcmp (mesh->linetype, DXF_DEFAULT_LINETYPE) != 0)
         {
-                fprintf (fp->fp, "  6\n%s\n", mesh->linetype);
+                dxf_write_string (fp, 6, mesh->linetype);
         }
         if ((fp->acad_version_number >= AutoCAD_2008)
-          && (strcmp (mesh->material, "") != 0))
+          && (mesh->material != 0))
         {
-                fprintf (fp->fp, "347\n%s\n", mesh->material);
+                dxf_write_hex (fp, 347, mesh->material);
         }
         if ((fp->acad_version_number <= AutoCAD_11)
           && DXF_FLATLAND
           && (mesh->elevation != 0.0))
         {
-                fprintf (fp->fp, " 38\n%f\n", mesh->elevation);
+                dxf_write_double (fp, 38, mesh->elevation);
         }
         if (mesh->color != DXF_COLOR_BYLAYER)
         {
-                fprintf (fp->fp, " 62\n%d\n", mesh->color);
+                dxf_write_int (fp, 62, mesh->color);
         }
         if (fp->acad_version_number >= AutoCAD_2002)
         {
-                fprintf (fp->fp, "370\n%d\n", mesh->lineweight);
+                dxf_write_int (fp, 370, mesh->lineweight);
         }
         if (mesh->linetype_scale != 1.0)
         {
-                fprintf (fp->fp, " 48\n%f\n", mesh->linetype_scale);
+                dxf_write_double (fp, 48, mesh->linetype_scale);
         }
         if (mesh->visibility != 0)
         {
-                fprintf (fp->fp, " 60\n%d\n", mesh->visibility);
+                dxf_write_int (fp, 60, mesh->visibility);
         }
         if (fp->acad_version_number >= AutoCAD_2000)
         {
 #ifdef BUILD_64
-                fprintf (fp->fp, "160\n%d\n", mesh->graphics_data_size);
+                dxf_write_int (fp, 160, mesh->graphics_data_size);
 #else
-                fprintf (fp->fp, " 92\n%d\n", mesh->graphics_data_size);
+                dxf_write_int (fp, 92, mesh->graphics_data_size);
 #endif
                 if (mesh->binary_graphics_data != NULL)
                 {
@@ -641,85 +599,85 @@ dxf_mesh_write
                         iter = (DxfBinaryData *) mesh->binary_graphics_data;
                         while (iter != NULL)
                         {
-                                fprintf (fp->fp, "310\n%s\n", iter->data_line);
+                                dxf_binary_data_write (fp, iter);
                                 iter = (DxfBinaryData *) iter->next;
                         }
                 }
         }
         if (fp->acad_version_number >= AutoCAD_2004)
         {
-                fprintf (fp->fp, "420\n%ld\n", mesh->color_value);
-                fprintf (fp->fp, "430\n%s\n", mesh->color_name);
-                fprintf (fp->fp, "440\n%ld\n", mesh->transparency);
+                dxf_write_int (fp, 420, mesh->color_value);
+                dxf_write_string (fp, 430, mesh->color_name);
+                dxf_write_int (fp, 440, mesh->transparency);
         }
         if (fp->acad_version_number >= AutoCAD_2009)
         {
-                fprintf (fp->fp, "390\n%s\n", mesh->plot_style_name);
-                fprintf (fp->fp, "284\n%d\n", mesh->shadow_mode);
+                dxf_write_hex (fp, 390, mesh->plot_style_name);
+                dxf_write_int (fp, 284, mesh->shadow_mode);
         }
         if (mesh->thickness != 0.0)
         {
-                fprintf (fp->fp, " 39\n%f\n", mesh->thickness);
+                dxf_write_double (fp, 39, mesh->thickness);
         }
         if (fp->acad_version_number >= AutoCAD_13)
         {
-                fprintf (fp->fp, "100\nAcDbSubMesh\n");
+                dxf_write_string (fp, 100, "AcDbSubMesh");
         }
-        fprintf (fp->fp, " 71\n%d\n", mesh->version);
-        fprintf (fp->fp, " 72\n%d\n", mesh->blend_crease_property);
-        fprintf (fp->fp, " 91\n%d\n", mesh->subdivision_level);
-        fprintf (fp->fp, " 92\n%d\n", mesh->vertex_count_level_0);
+        dxf_write_int (fp, 71, mesh->version);
+        dxf_write_int (fp, 72, mesh->blend_crease_property);
+        dxf_write_int (fp, 91, mesh->subdivision_level);
+        dxf_write_int (fp, 92, mesh->vertex_count_level_0);
         if (mesh->p0 != NULL)
         {
                 DxfPoint *p0_iter;
                 p0_iter = (DxfPoint *) mesh->p0;
                 while (p0_iter != NULL)
                 {
-                        fprintf (fp->fp, " 10\n%f\n", mesh->p0->x0);
-                        fprintf (fp->fp, " 20\n%f\n", mesh->p0->y0);
-                        fprintf (fp->fp, " 30\n%f\n", mesh->p0->z0);
+                        dxf_write_double (fp, 10, mesh->p0->x0);
+                        dxf_write_double (fp, 20, mesh->p0->y0);
+                        dxf_write_double (fp, 30, mesh->p0->z0);
                         p0_iter = (DxfPoint *) p0_iter->next;
                 }
         }
-        fprintf (fp->fp, " 93\n%d\n", mesh->face_list_size_level_0);
+        dxf_write_int (fp, 93, mesh->face_list_size_level_0);
         if (mesh->face_list_item != NULL)
         {
                 DxfInt32 *face_list_item_iter;
                 face_list_item_iter = (DxfInt32 *) mesh->face_list_item;
                 while (face_list_item_iter != NULL)
                 {
-                        fprintf (fp->fp, " 90\n%d\n", face_list_item_iter->value);
+                        dxf_write_int (fp, 90, face_list_item_iter->value);
                         face_list_item_iter = (DxfInt32 *) face_list_item_iter->next;
                 }
         }
-        fprintf (fp->fp, " 94\n%d\n", mesh->edge_count_level_0);
+        dxf_write_int (fp, 94, mesh->edge_count_level_0);
         if (mesh->edge_vertex_index != NULL)
         {
                 DxfInt32 *edge_vertex_index_iter;
                 edge_vertex_index_iter = (DxfInt32 *) mesh->edge_vertex_index;
                 while (edge_vertex_index_iter != NULL)
                 {
-                        fprintf (fp->fp, " 90\n%d\n", edge_vertex_index_iter->value);
+                        dxf_write_int (fp, 90, edge_vertex_index_iter->value);
                         edge_vertex_index_iter = (DxfInt32 *) edge_vertex_index_iter->next;
                 }
         }
-        fprintf (fp->fp, " 95\n%d\n", mesh->edge_crease_count_level_0);
+        dxf_write_int (fp, 95, mesh->edge_crease_count_level_0);
         if (mesh->edge_create_value != NULL)
         {
                 DxfDouble *edge_create_value_iter;
                 edge_create_value_iter = (DxfDouble *) mesh->edge_create_value;
                 while (edge_create_value_iter != NULL)
                 {
-                        fprintf (fp->fp, "140\n%f\n", mesh->edge_create_value->value);
+                        dxf_write_double (fp, 140, mesh->edge_create_value->value);
                         edge_create_value_iter = (DxfDouble *) edge_create_value_iter->next;
                 }
         }
-        fprintf (fp->fp, " 90\n%d\n", mesh->number_of_property_overridden_sub_entities);
-        fprintf (fp->fp, " 91\n%d\n", mesh->sub_entity_marker);
-        fprintf (fp->fp, " 92\n%d\n", mesh->count_of_property_overridden);
-        fprintf (fp->fp, " 90\n%d\n", mesh->property_type);
+        dxf_write_int (fp, 90, mesh->number_of_property_overridden_sub_entities);
+        dxf_write_int (fp, 91, mesh->sub_entity_marker);
+        dxf_write_int (fp, 92, mesh->count_of_property_overridden);
+        dxf_write_int (fp, 90, mesh->property_type);
         /* Clean up. */
-        free (dxf_entity_name);
+        dxf_free (dxf_entity_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -760,20 +718,15 @@ dxf_mesh_free
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        free (mesh->linetype);
-        free (mesh->layer);
+        dxf_string_free (mesh->linetype);
+        dxf_string_free (mesh->layer);
         dxf_binary_data_free_list (mesh->binary_graphics_data);
-        free (mesh->dictionary_owner_soft);
-        free (mesh->object_owner_soft);
-        free (mesh->material);
-        free (mesh->dictionary_owner_hard);
-        free (mesh->plot_style_name);
-        free (mesh->color_name);
+        dxf_string_free (mesh->color_name);
         dxf_point_free_list (mesh->p0);
         dxf_int32_free_list (mesh->face_list_item);
         dxf_int32_free_list (mesh->edge_vertex_index);
         dxf_double_free_list (mesh->edge_create_value);
-        free (mesh);
+        dxf_free (mesh);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -819,7 +772,7 @@ dxf_mesh_free_list
  *
  * \return \c id_code.
  */
-int
+uint64_t
 dxf_mesh_get_id_code
 (
         DxfMesh *mesh
@@ -837,12 +790,6 @@ dxf_mesh_get_id_code
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (mesh->id_code < 0)
-        {
-                fprintf (stderr,
-                  (_("Warning in %s () a negative value was found.\n")),
-                  __FUNCTION__);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -861,7 +808,7 @@ dxf_mesh_set_id_code
 (
         DxfMesh *mesh,
                 /*!< a pointer to a DXF \c MESH entity. */
-        int id_code
+        uint64_t id_code
                 /*!< the \c id_code to be set for the entity.\n
                  * This is to be an unique (sequential) number in the
                  * DXF file. */
@@ -878,12 +825,6 @@ dxf_mesh_set_id_code
                   __FUNCTION__);
                 return (NULL);
         }
-        if (id_code < 0)
-        {
-                fprintf (stderr,
-                  (_("Warning in %s () a negative value was passed.\n")),
-                  __FUNCTION__);
-        }
         mesh->id_code = id_code;
 #if DEBUG
         DXF_DEBUG_END
@@ -925,7 +866,7 @@ dxf_mesh_get_linetype
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (mesh->linetype));
+        return (dxf_strdup (mesh->linetype));
 }
 
 
@@ -963,7 +904,7 @@ dxf_mesh_set_linetype
                   __FUNCTION__);
                 return (NULL);
         }
-        mesh->linetype = strdup (linetype);
+        mesh->linetype = dxf_strdup (linetype);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1004,7 +945,7 @@ dxf_mesh_get_layer
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (mesh->layer));
+        return (dxf_strdup (mesh->layer));
 }
 
 
@@ -1042,7 +983,7 @@ dxf_mesh_set_layer
                   __FUNCTION__);
                 return (NULL);
         }
-        mesh->layer = strdup (layer);
+        mesh->layer = dxf_strdup (layer);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1786,11 +1727,9 @@ dxf_mesh_set_binary_graphics_data
  * \brief Get the pointer to the \c dictionary_owner_soft from a DXF 
  * \c MESH entity.
  *
- * \return pointer to the \c dictionary_owner_soft.
- *
- * \warning No checks are performed on the returned pointer (string).
+ * \return the handle of the \c dictionary_owner_soft.
  */
-char *
+uint64_t
 dxf_mesh_get_dictionary_owner_soft
 (
         DxfMesh *mesh
@@ -1806,19 +1745,12 @@ dxf_mesh_get_dictionary_owner_soft
                 fprintf (stderr,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
-                return (NULL);
-        }
-        if (mesh->dictionary_owner_soft ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
+                return (0);
         }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (mesh->dictionary_owner_soft));
+        return (mesh->dictionary_owner_soft);
 }
 
 
@@ -1834,8 +1766,8 @@ dxf_mesh_set_dictionary_owner_soft
 (
         DxfMesh *mesh,
                 /*!< a pointer to a DXF \c MESH entity. */
-        char *dictionary_owner_soft
-                /*!< a string containing the pointer to the \c
+        uint64_t dictionary_owner_soft
+                /*!< the handle of the \c
                  * dictionary_owner_soft for the entity. */
 )
 {
@@ -1850,14 +1782,7 @@ dxf_mesh_set_dictionary_owner_soft
                   __FUNCTION__);
                 return (NULL);
         }
-        if (dictionary_owner_soft == NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was passed.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
-        mesh->dictionary_owner_soft = strdup (dictionary_owner_soft);
+        mesh->dictionary_owner_soft = dictionary_owner_soft;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1870,10 +1795,8 @@ dxf_mesh_set_dictionary_owner_soft
  * \c MESH entity.
  *
  * \return soft pointer to the object owner.
- *
- * \warning No checks are performed on the returned pointer (string).
  */
-char *
+uint64_t
 dxf_mesh_get_object_owner_soft
 (
         DxfMesh *mesh
@@ -1889,19 +1812,12 @@ dxf_mesh_get_object_owner_soft
                 fprintf (stderr,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
-                return (NULL);
-        }
-        if (mesh->object_owner_soft ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
+                return (0);
         }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (mesh->object_owner_soft));
+        return (mesh->object_owner_soft);
 }
 
 
@@ -1917,8 +1833,8 @@ dxf_mesh_set_object_owner_soft
 (
         DxfMesh *mesh,
                 /*!< a pointer to a DXF \c MESH entity. */
-        char *object_owner_soft
-                /*!< a string containing the pointer to the
+        uint64_t object_owner_soft
+                /*!< the handle of the
                  * \c object_owner_soft for the entity. */
 )
 {
@@ -1933,14 +1849,7 @@ dxf_mesh_set_object_owner_soft
                   __FUNCTION__);
                 return (NULL);
         }
-        if (object_owner_soft == NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was passed.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
-        mesh->object_owner_soft = strdup (object_owner_soft);
+        mesh->object_owner_soft = object_owner_soft;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1951,12 +1860,10 @@ dxf_mesh_set_object_owner_soft
 /*!
  * \brief Get the pointer to the \c material from a DXF \c MESH entity.
  *
- * \return a pointer to \c material when successful, or \c NULL when an
+ * \return the handle \c material when successful, or 0 when an
  * error occurred.
- *
- * \warning No checks are performed on the returned pointer.
  */
-char *
+uint64_t
 dxf_mesh_get_material
 (
         DxfMesh *mesh
@@ -1972,19 +1879,12 @@ dxf_mesh_get_material
                 fprintf (stderr,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
-                return (NULL);
-        }
-        if (mesh->material ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
+                return (0);
         }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (mesh->material));
+        return (mesh->material);
 }
 
 
@@ -1999,8 +1899,8 @@ dxf_mesh_set_material
 (
         DxfMesh *mesh,
                 /*!< a pointer to a DXF \c MESH entity. */
-        char *material
-                /*!< a string containing the pointer to the \c
+        uint64_t material
+                /*!< the handle of the \c
                  * material for the entity. */
 )
 {
@@ -2015,14 +1915,7 @@ dxf_mesh_set_material
                   __FUNCTION__);
                 return (NULL);
         }
-        if (material == NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was passed.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
-        mesh->material = strdup (material);
+        mesh->material = material;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2034,11 +1927,9 @@ dxf_mesh_set_material
  * \brief Get the pointer to the \c dictionary_owner_hard from a DXF 
  * \c MESH entity.
  *
- * \return pointer to the \c dictionary_owner_hard.
- *
- * \warning No checks are performed on the returned pointer (string).
+ * \return the handle of the \c dictionary_owner_hard.
  */
-char *
+uint64_t
 dxf_mesh_get_dictionary_owner_hard
 (
         DxfMesh *mesh
@@ -2054,19 +1945,12 @@ dxf_mesh_get_dictionary_owner_hard
                 fprintf (stderr,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
-                return (NULL);
-        }
-        if (mesh->dictionary_owner_hard ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
+                return (0);
         }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (mesh->dictionary_owner_hard));
+        return (mesh->dictionary_owner_hard);
 }
 
 
@@ -2082,8 +1966,8 @@ dxf_mesh_set_dictionary_owner_hard
 (
         DxfMesh *mesh,
                 /*!< a pointer to a DXF \c MESH entity. */
-        char *dictionary_owner_hard
-                /*!< a string containing the pointer to the \c
+        uint64_t dictionary_owner_hard
+                /*!< the handle of the \c
                  * dictionary_owner_hard for the entity. */
 )
 {
@@ -2098,14 +1982,7 @@ dxf_mesh_set_dictionary_owner_hard
                   __FUNCTION__);
                 return (NULL);
         }
-        if (dictionary_owner_hard == NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was passed.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
-        mesh->dictionary_owner_hard = strdup (dictionary_owner_hard);
+        mesh->dictionary_owner_hard = dictionary_owner_hard;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2181,10 +2058,10 @@ dxf_mesh_set_lineweight
 /*!
  * \brief Get the \c plot_style_name from a DXF \c MESH entity.
  *
- * \return a pointer to \c plot_style_name when successful, or \c NULL
+ * \return the handle \c plot_style_name when successful, or 0
  * when an error occurred.
  */
-char *
+uint64_t
 dxf_mesh_get_plot_style_name
 (
         DxfMesh *mesh
@@ -2200,19 +2077,12 @@ dxf_mesh_get_plot_style_name
                 fprintf (stderr,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
-                return (NULL);
-        }
-        if (mesh->plot_style_name ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
+                return (0);
         }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (mesh->plot_style_name));
+        return (mesh->plot_style_name);
 }
 
 
@@ -2227,7 +2097,7 @@ dxf_mesh_set_plot_style_name
 (
         DxfMesh *mesh,
                 /*!< a pointer to a DXF \c MESH entity. */
-        char *plot_style_name
+        uint64_t plot_style_name
                 /*!< a string containing the \c plot_style_name for the
                  * entity. */
 )
@@ -2243,14 +2113,7 @@ dxf_mesh_set_plot_style_name
                   __FUNCTION__);
                 return (NULL);
         }
-        if (plot_style_name == NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was passed.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
-        mesh->plot_style_name = strdup (plot_style_name);
+        mesh->plot_style_name = plot_style_name;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2357,7 +2220,7 @@ dxf_mesh_get_color_name
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (mesh->color_name));
+        return (dxf_strdup (mesh->color_name));
 }
 
 
@@ -2395,7 +2258,7 @@ dxf_mesh_set_color_name
                   __FUNCTION__);
                 return (NULL);
         }
-        mesh->color_name = strdup (color_name);
+        mesh->color_name = dxf_strdup (color_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -57,7 +57,7 @@ typedef struct
 dxf_mesh_struct
 {
         /* Members common for all DXF drawable entities. */
-        int id_code;
+        uint64_t id_code;
                 /*!< Identification number for the entity.\n
                  * This is to be an unique (sequential) number in the DXF
                  * file.\n
@@ -130,20 +130,20 @@ dxf_mesh_struct
                  * (optional).\n
                  * Group code = 310.\n
                  * \since Introduced in version R2000. */
-        char *dictionary_owner_soft;
+        uint64_t dictionary_owner_soft;
                 /*!< Soft-pointer ID/handle to owner dictionary (optional).\n
                  * Group code = 330.\n
                  * \since Introduced in version R14. */
-        char *object_owner_soft;
+        uint64_t object_owner_soft;
                 /*!< Soft-pointer ID/handle  to owner BLOCK_RECORD object.\n
                  * Group code = 330.\n
                  * \since Introduced in version R2000. */
-        char *material;
+        uint64_t material;
                 /*!< Hard-pointer ID/handle to material object (present if
                  * not BYLAYER).\n
                  * Group code = 347.\n
                  * \since Introduced in version R2008. */
-        char *dictionary_owner_hard;
+        uint64_t dictionary_owner_hard;
                 /*!< Hard owner ID/handle to owner dictionary (optional).\n
                  * Group code = 360.\n
                  * \since Introduced in version R14. */
@@ -152,7 +152,7 @@ dxf_mesh_struct
                  * Stored and moved around as a 16-bit integer.\n
                  * Group code = 370.\n
                  * \since Introduced in version R2002. */
-        char *plot_style_name;
+        uint64_t plot_style_name;
                 /*!< Hard pointer ID / handle of PlotStyleName object.\n
                  * Group code = 390.\n
                  * \since Introduced in version R2009. */
@@ -258,8 +258,8 @@ DxfMesh *dxf_mesh_read (DxfFile *fp, DxfMesh *mesh);
 int dxf_mesh_write (DxfFile *fp, DxfMesh *mesh);
 int dxf_mesh_free (DxfMesh *mesh);
 void dxf_mesh_free_list (DxfMesh *meshes);
-int dxf_mesh_get_id_code (DxfMesh *mesh);
-DxfMesh *dxf_mesh_set_id_code (DxfMesh *mesh, int id_code);
+uint64_t dxf_mesh_get_id_code (DxfMesh *mesh);
+DxfMesh *dxf_mesh_set_id_code (DxfMesh *mesh, uint64_t id_code);
 char *dxf_mesh_get_linetype (DxfMesh *mesh);
 DxfMesh *dxf_mesh_set_linetype (DxfMesh *mesh, char *linetype);
 char *dxf_mesh_get_layer (DxfMesh *mesh);
@@ -282,18 +282,18 @@ int16_t dxf_mesh_get_shadow_mode (DxfMesh *mesh);
 DxfMesh *dxf_mesh_set_shadow_mode (DxfMesh *mesh, int16_t shadow_mode);
 DxfBinaryData *dxf_mesh_get_binary_graphics_data (DxfMesh *mesh);
 DxfMesh *dxf_mesh_set_binary_graphics_data (DxfMesh *mesh, DxfBinaryData *data);
-char *dxf_mesh_get_dictionary_owner_soft (DxfMesh *mesh);
-DxfMesh *dxf_mesh_set_dictionary_owner_soft (DxfMesh *mesh, char *dictionary_owner_soft);
-char *dxf_mesh_get_object_owner_soft (DxfMesh *mesh);
-DxfMesh *dxf_mesh_set_object_owner_soft (DxfMesh *mesh, char *object_owner_soft);
-char *dxf_mesh_get_material (DxfMesh *mesh);
-DxfMesh *dxf_mesh_set_material (DxfMesh *mesh, char *material);
-char *dxf_mesh_get_dictionary_owner_hard (DxfMesh *mesh);
-DxfMesh *dxf_mesh_set_dictionary_owner_hard (DxfMesh *mesh, char *dictionary_owner_hard);
+uint64_t dxf_mesh_get_dictionary_owner_soft (DxfMesh *mesh);
+DxfMesh *dxf_mesh_set_dictionary_owner_soft (DxfMesh *mesh, uint64_t dictionary_owner_soft);
+uint64_t dxf_mesh_get_object_owner_soft (DxfMesh *mesh);
+DxfMesh *dxf_mesh_set_object_owner_soft (DxfMesh *mesh, uint64_t object_owner_soft);
+uint64_t dxf_mesh_get_material (DxfMesh *mesh);
+DxfMesh *dxf_mesh_set_material (DxfMesh *mesh, uint64_t material);
+uint64_t dxf_mesh_get_dictionary_owner_hard (DxfMesh *mesh);
+DxfMesh *dxf_mesh_set_dictionary_owner_hard (DxfMesh *mesh, uint64_t dictionary_owner_hard);
 int16_t dxf_mesh_get_lineweight (DxfMesh *mesh);
 DxfMesh *dxf_mesh_set_lineweight (DxfMesh *mesh, int16_t lineweight);
-char *dxf_mesh_get_plot_style_name (DxfMesh *mesh);
-DxfMesh *dxf_mesh_set_plot_style_name (DxfMesh *mesh, char *plot_style_name);
+uint64_t dxf_mesh_get_plot_style_name (DxfMesh *mesh);
+DxfMesh *dxf_mesh_set_plot_style_name (DxfMesh *mesh, uint64_t plot_style_name);
 long dxf_mesh_get_color_value (DxfMesh *mesh);
 DxfMesh *dxf_mesh_set_color_value (DxfMesh *mesh, long color_value);
 char *dxf_mesh_get_color_name (DxfMesh *mesh);
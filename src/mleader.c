@@ -36,6 +36,7 @@
 
 
 #include "mleader.h"
+#include "util.h"
 
 
 /*!
@@ -58,7 +59,7 @@ dxf_mleader_new ()
         size = sizeof (DxfMLeader);
         /* avoid malloc of 0 bytes */
         if (size == 0) size = 1;
-        if ((mleader = malloc (size)) == NULL)
+        if ((mleader = dxf_malloc (size)) == NULL)
         {
                 fprintf (stderr,
                   (_("Error in %s () could not allocate memory.\n")),
@@ -108,9 +109,9 @@ dxf_mleader_init
                   __FUNCTION__);
                 return (NULL);
         }
-        mleader->id_code = 0;
-        mleader->linetype = strdup (DXF_DEFAULT_LINETYPE);
-        mleader->layer = strdup (DXF_DEFAULT_LAYER);
+        mleader->id_code = DXF_HANDLE_NONE;
+        mleader->linetype = dxf_strdup (DXF_DEFAULT_LINETYPE);
+        mleader->layer = dxf_strdup (DXF_DEFAULT_LAYER);
         mleader->elevation = 0.0;
         mleader->thickness = 0.0;
         mleader->linetype_scale = DXF_DEFAULT_LINETYPE_SCALE;
@@ -121,14 +122,14 @@ dxf_mleader_init
         mleader->shadow_mode = 0;
         mleader->binary_graphics_data = (DxfBinaryGraphicsData *) dxf_binary_graphics_data_new ();
         mleader->binary_graphics_data = (DxfBinaryGraphicsData *) dxf_binary_graphics_data_init (mleader->binary_graphics_data);
-        mleader->dictionary_owner_soft = strdup ("");
-        mleader->object_owner_soft = strdup ("");
-        mleader->material = strdup ("");
-        mleader->dictionary_owner_hard = strdup ("");
+        mleader->dictionary_owner_soft = 0;
+        mleader->object_owner_soft = 0;
+        mleader->material = 0;
+        mleader->dictionary_owner_hard = 0;
         mleader->lineweight = 0;
-        mleader->plot_style_name = strdup ("");
+        mleader->plot_style_name = 0;
         mleader->color_value = 0;
-        mleader->color_name = strdup ("");
+        mleader->color_name = dxf_strdup ("");
         mleader->transparency = 0;
         mleader->block_content_scale = 0.0;
         mleader->dogleg_length = 0.0;
@@ -159,13 +160,13 @@ dxf_mleader_init
         mleader->enable_frame_text = 0;
         mleader->enable_annotation_scale = 0;
         mleader->text_direction_negative = 0;
-        mleader->block_attribute_text_string = strdup ("");
-        mleader->block_attribute_id = strdup ("");
-        mleader->leader_style_id = strdup ("");
-        mleader->arrowhead_id = strdup ("");
-        mleader->text_style_id = strdup ("");
-        mleader->block_content_id = strdup ("");
-        mleader->arrow_head_id = strdup ("");
+        mleader->block_attribute_text_string = dxf_strdup ("");
+        mleader->block_attribute_id = dxf_strdup ("");
+        mleader->leader_style_id = dxf_strdup ("");
+        mleader->arrowhead_id = dxf_strdup ("");
+        mleader->text_style_id = dxf_strdup ("");
+        mleader->block_content_id = dxf_strdup ("");
+        mleader->arrow_head_id = dxf_strdup ("");
         mleader->next = NULL;
 #if DEBUG
         DXF_DEBUG_END
@@ -197,7 +198,8 @@ dxf_mleader_read
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        char *temp_string = NULL;
+        char temp_string[DXF_MAX_STRING_LENGTH];
+        int group_code;
         DxfBinaryGraphicsData *iter310 = NULL;
         int iter92;
         int iter330;
@@ -208,8 +210,6 @@ dxf_mleader_read
                 fprintf (stderr,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
-                /* Clean up. */
-                free (temp_string);
                 return (NULL);
         }
         if (mleader == NULL)
@@ -222,467 +222,358 @@ dxf_mleader_read
         iter310 = (DxfBinaryGraphicsData *) mleader->binary_graphics_data;
         iter92 = 0;
         iter330 = 0;
-        (fp->line_number)++;
-        fscanf (fp->fp, "%[^\n]", temp_string);
-        while (strcmp (temp_string, "0") != 0)
+        while ((dxf_read_group_code (fp, &group_code) == EXIT_SUCCESS)
+          && (group_code != 0))
         {
-                if (ferror (fp->fp))
+                if (dxf_read_error (fp))
                 {
                         fprintf (stderr,
                           (_("Error in %s () while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
-                        fclose (fp->fp);
-                        /* Clean up. */
-                        free (temp_string);
                         return (NULL);
                 }
-                if (strcmp (temp_string, "5") == 0)
-                {
-                        /* Now follows a string containing a sequential
-                         * id number. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%x\n", (uint *) &mleader->id_code);
-                }
-                else if (strcmp (temp_string, "6") == 0)
-                {
-                        /* Now follows a string containing a linetype
-                         * name. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, mleader->linetype);
-                }
-                else if (strcmp (temp_string, "8") == 0)
-                {
-                        /* Now follows a string containing a layer name. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, mleader->layer);
-                }
-                else if (strcmp (temp_string, "10") == 0)
-                {
-                        /* Now follows a string containing the
-                         * Block content scale. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &mleader->block_content_scale);
-                }
-                else if ((fp->acad_version_number <= AutoCAD_11)
-                        && (strcmp (temp_string, "38") == 0))
-                {
-                        /* Now follows a string containing the
-                         * elevation. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &mleader->elevation);
-                }
-                else if (strcmp (temp_string, "39") == 0)
-                {
-                        /* Now follows a string containing the
-                         * thickness. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &mleader->thickness);
-                }
-                else if (strcmp (temp_string, "41") == 0)
-                {
-                        /* Now follows a string containing the
-                         * Dogleg length. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &mleader->dogleg_length);
-                }
-                else if (strcmp (temp_string, "42") == 0)
-                {
-                        /* Now follows a string containing the
-                         * Arrowhead size. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &mleader->arrowhead_size);
-                }
-                else if (strcmp (temp_string, "43") == 0)
-                {
-                        /* Now follows a string containing the
-                         * Block content rotation. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &mleader->block_content_rotation);
-                }
-                else if (strcmp (temp_string, "44") == 0)
-                {
-                        /* Now follows a string containing the
-                         * Block attribute width. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &mleader->block_attribute_width);
-                }
-                else if (strcmp (temp_string, "48") == 0)
-                {
-                        /* Now follows a string containing the linetype
-                         * scale. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &mleader->linetype_scale);
-                }
-                else if (strcmp (temp_string, "60") == 0)
-                {
-                        /* Now follows a string containing the
-                         * visibility value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%hd\n", &mleader->visibility);
-                }
-                else if (strcmp (temp_string, "62") == 0)
-                {
-                        /* Now follows a string containing the
-                         * color value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%d\n", &mleader->color);
-                }
-                else if (strcmp (temp_string, "67") == 0)
-                {
-                        /* Now follows a string containing the
-                         * paperspace value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%d\n", &mleader->paperspace);
-                }
-                else if (strcmp (temp_string, "90") == 0)
-                {
-                        /* Now follows a string containing the
-                         * Property override flag. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%d\n", &mleader->property_override_flag);
-                }
-                else if (strcmp (temp_string, "91") == 0)
-                {
-                        /* Now follows a string containing the
-                         * Leader line color value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%d\n", &mleader->leader_line_color);
-                }
-                else if (strcmp (temp_string, "92") == 0)
+                switch (group_code)
                 {
-                        if (iter92 == 0)
-                        {
+                        case 5:
+                                /* Now follows a string containing a sequential
+                                 * id number. */
+                                dxf_read_handle (fp, &mleader->id_code);
+                                break;
+                        case 6:
+                                /* Now follows a string containing a linetype
+                                 * name. */
+                                dxf_read_string_interned (fp, &mleader->linetype);
+                                break;
+                        case 8:
+                                /* Now follows a string containing a layer name. */
+                                dxf_read_string_interned (fp, &mleader->layer);
+                                break;
+                        case 10:
+                                /* Now follows a string containing the
+                                 * Block content scale. */
+                                dxf_read_double (fp, &mleader->block_content_scale);
+                                break;
+                        case 38:
+                                if (fp->acad_version_number <= AutoCAD_11)
+                                {
+                                        /* Now follows a string containing the
+                                         * elevation. */
+                                        dxf_read_double (fp, &mleader->elevation);
+                                }
+                                else
+                                {
+                                        fprintf (stderr,
+                                          (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
+                                          __FUNCTION__, fp->filename, fp->line_number);
+                                        /* Skip the value of the unknown group code. */
+                                        dxf_read_line (temp_string, fp);
+                                }
+                                break;
+                        case 39:
+                                /* Now follows a string containing the
+                                 * thickness. */
+                                dxf_read_double (fp, &mleader->thickness);
+                                break;
+                        case 41:
+                                /* Now follows a string containing the
+                                 * Dogleg length. */
+                                dxf_read_double (fp, &mleader->dogleg_length);
+                                break;
+                        case 42:
+                                /* Now follows a string containing the
+                                 * Arrowhead size. */
+                                dxf_read_double (fp, &mleader->arrowhead_size);
+                                break;
+                        case 43:
+                                /* Now follows a string containing the
+                                 * Block content rotation. */
+                                dxf_read_double (fp, &mleader->block_content_rotation);
+                                break;
+                        case 44:
+                                /* Now follows a string containing the
+                                 * Block attribute width. */
+                                dxf_read_double (fp, &mleader->block_attribute_width);
+                                break;
+                        case 48:
+                                /* Now follows a string containing the linetype
+                                 * scale. */
+                                dxf_read_double (fp, &mleader->linetype_scale);
+                                break;
+                        case 60:
+                                /* Now follows a string containing the
+                                 * visibility value. */
+                                dxf_read_int16 (fp, &mleader->visibility);
+                                break;
+                        case 62:
+                                /* Now follows a string containing the
+                                 * color value. */
+                                dxf_read_int (fp, &mleader->color);
+                                break;
+                        case 67:
+                                /* Now follows a string containing the
+                                 * paperspace value. */
+                                dxf_read_int (fp, &mleader->paperspace);
+                                break;
+                        case 90:
+                                /* Now follows a string containing the
+                                 * Property override flag. */
+                                dxf_read_int (fp, &mleader->property_override_flag);
+                                break;
+                        case 91:
+                                /* Now follows a string containing the
+                                 * Leader line color value. */
+                                dxf_read_int (fp, &mleader->leader_line_color);
+                                break;
+                        case 92:
+                                if (iter92 == 0)
+                                {
+                                        /* Now follows a string containing the
+                                         * graphics data size value. */
+                                        dxf_read_int (fp, &mleader->graphics_data_size);
+                                }
+                                if (iter92 == 1)
+                                {
+                                        /* Now follows a string containing the
+                                         * text color. */
+                                        dxf_read_int (fp, &mleader->text_color);
+                                }
+                                iter92++;
+                                break;
+                        case 93:
+                                /* Now follows a string containing the
+                                 * Block content color. */
+                                dxf_read_int (fp, &mleader->block_content_color);
+                                break;
+                        case 94:
+                                /* Now follows a string containing the
+                                 * Arrowhead index. */
+                                dxf_read_int (fp, &mleader->arrowhead_index);
+                                break;
+                        case 95:
+                                /* Now follows a string containing the
+                                 * Text right attachment type value. */
+                                dxf_read_int (fp, &mleader->text_right_attachment_type);
+                                break;
+                        case 160:
                                 /* Now follows a string containing the
                                  * graphics data size value. */
-                                (fp->line_number)++;
-                                fscanf (fp->fp, "%d\n", &mleader->graphics_data_size);
-                        }
-                        if (iter92 == 1)
-                        {
+                                dxf_read_int (fp, &mleader->graphics_data_size);
+                                break;
+                        case 170:
                                 /* Now follows a string containing the
-                                 * text color. */
-                                (fp->line_number)++;
-                                fscanf (fp->fp, "%d\n", &mleader->text_color);
-                        }
-                        iter92++;
-                }
-                else if (strcmp (temp_string, "93") == 0)
-                {
-                        /* Now follows a string containing the
-                         * Block content color. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%d\n", &mleader->block_content_color);
-                }
-                else if (strcmp (temp_string, "94") == 0)
-                {
-                        /* Now follows a string containing the
-                         * Arrowhead index. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%d\n", &mleader->arrowhead_index);
-                }
-                else if (strcmp (temp_string, "95") == 0)
-                {
-                        /* Now follows a string containing the
-                         * Text right attachment type value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%d\n", &mleader->text_right_attachment_type);
-                }
-                else if (strcmp (temp_string, "160") == 0)
-                {
-                        /* Now follows a string containing the
-                         * graphics data size value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%d\n", &mleader->graphics_data_size);
-                }
-                else if (strcmp (temp_string, "170") == 0)
-                {
-                        /* Now follows a string containing the
-                         * Leader linetype style. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%hd\n", &mleader->leader_linetype_style);
-                }
-                else if (strcmp (temp_string, "171") == 0)
-                {
-                        /* Now follows a string containing the
-                         * Leader line weight. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%hd\n", &mleader->leader_line_weight);
-                }
-                else if (strcmp (temp_string, "172") == 0)
-                {
-                        /* Now follows a string containing the
-                         * Content type. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%hd\n", &mleader->content_type);
-                }
-                else if (strcmp (temp_string, "173") == 0)
-                {
-                        /* Now follows a string containing the
-                         * Text left attachment type value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%hd\n", &mleader->text_left_attachment_type);
-                }
-                else if (strcmp (temp_string, "174") == 0)
-                {
-                        /* Now follows a string containing the
-                         * Text angle type. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%hd\n", &mleader->text_angle_type);
-                }
-                else if (strcmp (temp_string, "175") == 0)
-                {
-                        /* Now follows a string containing the
-                         * Text alignment type. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%hd\n", &mleader->text_alignment_type);
-                }
-                else if (strcmp (temp_string, "176") == 0)
-                {
-                        /* Now follows a string containing the
-                         * Block content connection type. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%hd\n", &mleader->block_content_connection_type);
-                }
-                else if (strcmp (temp_string, "177") == 0)
-                {
-                        /* Now follows a string containing the
-                         * Block attribute index. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%hd\n", &mleader->block_attribute_index);
-                }
-                else if (strcmp (temp_string, "178") == 0)
-                {
-                        /* Now follows a string containing the
-                         * Text align in IPE. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%hd\n", &mleader->text_align_in_IPE);
-                }
-                else if (strcmp (temp_string, "179") == 0)
-                {
-                        /* Now follows a string containing the
-                         * Text attachment point. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%hd\n", &mleader->text_attachment_point);
-                }
-                else if (strcmp (temp_string, "271") == 0)
-                {
-                        /* Now follows a string containing the
-                         * Text attachment direction. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%hd\n", &mleader->text_attachment_direction);
-                }
-                else if (strcmp (temp_string, "272") == 0)
-                {
-                        /* Now follows a string containing the
-                         * Bottom text attachment direction. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%hd\n", &mleader->bottom_text_attachment_direction);
-                }
-                else if (strcmp (temp_string, "273") == 0)
-                {
-                        /* Now follows a string containing the
-                         * Top text attachment direction. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%hd\n", &mleader->top_text_attachment_direction);
-                }
-                else if (strcmp (temp_string, "284") == 0)
-                {
-                        /* Now follows a string containing the shadow
-                         * mode value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%hd\n", &mleader->shadow_mode);
-                }
-                else if (strcmp (temp_string, "290") == 0)
-                {
-                        /* Now follows a string containing the
-                         * Enable landing value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%d\n", &mleader->enable_landing);
-                }
-                else if (strcmp (temp_string, "291") == 0)
-                {
-                        /* Now follows a string containing the
-                         * Enable dogleg value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%d\n", &mleader->enable_dogleg);
-                }
-                else if (strcmp (temp_string, "292") == 0)
-                {
-                        /* Now follows a string containing the
-                         * Enable frame text value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%d\n", &mleader->enable_frame_text);
-                }
-                else if (strcmp (temp_string, "293") == 0)
-                {
-                        /* Now follows a string containing the
-                         * Enable annotation scale value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%d\n", &mleader->enable_annotation_scale);
-                }
-                else if (strcmp (temp_string, "294") == 0)
-                {
-                        /* Now follows a string containing the
-                         * Text direction negative value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%d\n", &mleader->text_direction_negative);
-                }
-                else if (strcmp (temp_string, "302") == 0)
-                {
-                        /* Now follows a string containing a
-                         * Block attribute text string. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, mleader->block_attribute_text_string);
-                }
-                else if (strcmp (temp_string, "310") == 0)
-                {
-                        /* Now follows a string containing binary
-                         * graphics data. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, iter310->data_line);
-                        dxf_binary_graphics_data_init ((DxfBinaryGraphicsData *) iter310->next);
-                        iter310 = (DxfBinaryGraphicsData *) iter310->next;
-                }
-                else if (strcmp (temp_string, "330") == 0)
-                {
-                        if (iter330 == 0)
-                        {
-                                /* Now follows a string containing a soft-pointer
-                                 * ID/handle to owner dictionary. */
-                                (fp->line_number)++;
-                                fscanf (fp->fp, DXF_MAX_STRING_FORMAT, mleader->dictionary_owner_soft);
-                        }
-                        if (iter330 == 1)
-                        {
-                                /* Now follows a string containing a soft-pointer
-                                 * ID/handle to owner object. */
-                                (fp->line_number)++;
-                                fscanf (fp->fp, DXF_MAX_STRING_FORMAT, mleader->object_owner_soft);
-                        }
-                        if (iter330 == 2)
-                        {
+                                 * Leader linetype style. */
+                                dxf_read_int16 (fp, &mleader->leader_linetype_style);
+                                break;
+                        case 171:
+                                /* Now follows a string containing the
+                                 * Leader line weight. */
+                                dxf_read_int16 (fp, &mleader->leader_line_weight);
+                                break;
+                        case 172:
+                                /* Now follows a string containing the
+                                 * Content type. */
+                                dxf_read_int16 (fp, &mleader->content_type);
+                                break;
+                        case 173:
+                                /* Now follows a string containing the
+                                 * Text left attachment type value. */
+                                dxf_read_int16 (fp, &mleader->text_left_attachment_type);
+                                break;
+                        case 174:
+                                /* Now follows a string containing the
+                                 * Text angle type. */
+                                dxf_read_int16 (fp, &mleader->text_angle_type);
+                                break;
+                        case 175:
+                                /* Now follows a string containing the
+                                 * Text alignment type. */
+                                dxf_read_int16 (fp, &mleader->text_alignment_type);
+                                break;
+                        case 176:
+                                /* Now follows a string containing the
+                                 * Block content connection type. */
+                                dxf_read_int16 (fp, &mleader->block_content_connection_type);
+                                break;
+                        case 177:
+                                /* Now follows a string containing the
+                                 * Block attribute index. */
+                                dxf_read_int16 (fp, &mleader->block_attribute_index);
+                                break;
+                        case 178:
+                                /* Now follows a string containing the
+                                 * Text align in IPE. */
+                                dxf_read_int16 (fp, &mleader->text_align_in_IPE);
+                                break;
+                        case 179:
+                                /* Now follows a string containing the
+                                 * Text attachment point. */
+                                dxf_read_int16 (fp, &mleader->text_attachment_point);
+                                break;
+                        case 271:
+                                /* Now follows a string containing the
+                                 * Text attachment direction. */
+                                dxf_read_int16 (fp, &mleader->text_attachment_direction);
+                                break;
+                        case 272:
+                                /* Now follows a string containing the
+                                 * Bottom text attachment direction. */
+                                dxf_read_int16 (fp, &mleader->bottom_text_attachment_direction);
+                                break;
+                        case 273:
+                                /* Now follows a string containing the
+                                 * Top text attachment direction. */
+                                dxf_read_int16 (fp, &mleader->top_text_attachment_direction);
+                                break;
+                        case 284:
+                                /* Now follows a string containing the shadow
+                                 * mode value. */
+                                dxf_read_int16 (fp, &mleader->shadow_mode);
+                                break;
+                        case 290:
+                                /* Now follows a string containing the
+                                 * Enable landing value. */
+                                dxf_read_int (fp, &mleader->enable_landing);
+                                break;
+                        case 291:
+                                /* Now follows a string containing the
+                                 * Enable dogleg value. */
+                                dxf_read_int (fp, &mleader->enable_dogleg);
+                                break;
+                        case 292:
+                                /* Now follows a string containing the
+                                 * Enable frame text value. */
+                                dxf_read_int (fp, &mleader->enable_frame_text);
+                                break;
+                        case 293:
+                                /* Now follows a string containing the
+                                 * Enable annotation scale value. */
+                                dxf_read_int (fp, &mleader->enable_annotation_scale);
+                                break;
+                        case 294:
+                                /* Now follows a string containing the
+                                 * Text direction negative value. */
+                                dxf_read_int (fp, &mleader->text_direction_negative);
+                                break;
+                        case 302:
                                 /* Now follows a string containing a
-                                 * Block attribute ID. */
-                                (fp->line_number)++;
-                                fscanf (fp->fp, DXF_MAX_STRING_FORMAT, mleader->block_attribute_id);
-                        }
-                        iter330++;
-                }
-                else if (strcmp (temp_string, "340") == 0)
-                {
-                        /* Now follows a string containing a
-                         * Leader style ID. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, mleader->leader_style_id);
-                }
-                else if (strcmp (temp_string, "341") == 0)
-                {
-                        /* Now follows a string containing a
-                         * Leader linetype ID. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, mleader->leader_linetype_id);
-                }
-                else if (strcmp (temp_string, "342") == 0)
-                {
-                        /* Now follows a string containing a
-                         * Arrowhead ID. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, mleader->arrowhead_id);
-                }
-                else if (strcmp (temp_string, "343") == 0)
-                {
-                        /* Now follows a string containing a
-                         * Text style ID. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, mleader->text_style_id);
-                }
-                else if (strcmp (temp_string, "344") == 0)
-                {
-                        /* Now follows a string containing a
-                         * Block content ID. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, mleader->block_content_id);
-                }
-                else if (strcmp (temp_string, "345") == 0)
-                {
-                        /* Now follows a string containing a
-                         * Arrow head ID. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, mleader->arrow_head_id);
-                }
-                else if (strcmp (temp_string, "347") == 0)
-                {
-                        /* Now follows a string containing a
-                         * hard-pointer ID/handle to material object. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, mleader->material);
-                }
-                else if (strcmp (temp_string, "360") == 0)
-                {
-                        /* Now follows a string containing Hard owner
-                         * ID/handle to owner dictionary. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, mleader->dictionary_owner_hard);
-                }
-                else if (strcmp (temp_string, "370") == 0)
-                {
-                        /* Now follows a string containing the lineweight
-                         * value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%hd\n", &mleader->lineweight);
-                }
-                else if (strcmp (temp_string, "390") == 0)
-                {
-                        /* Now follows a string containing a plot style
-                         * name value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, mleader->plot_style_name);
-                }
-                else if (strcmp (temp_string, "420") == 0)
-                {
-                        /* Now follows a string containing a color value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%ld\n", &mleader->color_value);
-                }
-                else if (strcmp (temp_string, "430") == 0)
-                {
-                        /* Now follows a string containing a color
-                         * name value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, mleader->color_name);
-                }
-                else if (strcmp (temp_string, "440") == 0)
-                {
-                        /* Now follows a string containing a transparency
-                         * value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%ld\n", &mleader->transparency);
-                }
-                else if (strcmp (temp_string, "999") == 0)
-                {
-                        /* Now follows a string containing a comment. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
-                        fprintf (stdout, "DXF comment: %s\n", temp_string);
-                }
-                else
-                {
-                        fprintf (stderr,
-                          (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
-                          __FUNCTION__, fp->filename, fp->line_number);
+                                 * Block attribute text string. */
+                                dxf_read_string (fp, &mleader->block_attribute_text_string);
+                                break;
+                        case 310:
+                                /* Now follows a string containing binary
+                                 * graphics data. */
+                                dxf_read_string (fp, &iter310->data_line);
+                                dxf_binary_graphics_data_init ((DxfBinaryGraphicsData *) iter310->next);
+                                iter310 = (DxfBinaryGraphicsData *) iter310->next;
+                                break;
+                        case 330:
+                                if (iter330 == 0)
+                                {
+                                        /* Now follows a string containing a soft-pointer
+                                         * ID/handle to owner dictionary. */
+                                        dxf_read_handle (fp, &mleader->dictionary_owner_soft);
+                                }
+                                if (iter330 == 1)
+                                {
+                                        /* Now follows a string containing a soft-pointer
+                                         * ID/handle to owner object. */
+                                        dxf_read_handle (fp, &mleader->object_owner_soft);
+                                }
+                                if (iter330 == 2)
+                                {
+                                        /* Now follows a string containing a
+                                         * Block attribute ID. */
+                                        dxf_read_string (fp, &mleader->block_attribute_id);
+                                }
+                                iter330++;
+                                break;
+                        case 340:
+                                /* Now follows a string containing a
+                                 * Leader style ID. */
+                                dxf_read_string (fp, &mleader->leader_style_id);
+                                break;
+                        case 341:
+                                /* Now follows a string containing a
+                                 * Leader linetype ID. */
+                                dxf_read_string (fp, &mleader->leader_linetype_id);
+                                break;
+                        case 342:
+                                /* Now follows a string containing a
+                                 * Arrowhead ID. */
+                                dxf_read_string (fp, &mleader->arrowhead_id);
+                                break;
+                        case 343:
+                                /* Now follows a string containing a
+                                 * Text style ID. */
+                                dxf_read_string (fp, &mleader->text_style_id);
+                                break;
+                        case 344:
+                                /* Now follows a string containing a
+                                 * Block content ID. */
+                                dxf_read_string (fp, &mleader->block_content_id);
+                                break;
+                        case 345:
+                                /* Now follows a string containing a
+                                 * Arrow head ID. */
+                                dxf_read_string (fp, &mleader->arrow_head_id);
+                                break;
+                        case 347:
+                                /* Now follows a string containing a
+                                 * hard-pointer ID/handle to material object. */
+                                dxf_read_handle (fp, &mleader->material);
+                                break;
+                        case 360:
+                                /* Now follows a string containing Hard owner
+                                 * ID/handle to owner dictionary. */
+                                dxf_read_handle (fp, &mleader->dictionary_owner_hard);
+                                break;
+                        case 370:
+                                /* Now follows a string containing the lineweight
+                                 * value. */
+                                dxf_read_int16 (fp, &mleader->lineweight);
+                                break;
+                        case 390:
+                                /* Now follows a string containing a plot style
+                                 * name value. */
+                                dxf_read_handle (fp, &mleader->plot_style_name);
+                                break;
+                        case 420:
+                                /* Now follows a string containing a color value. */
+                                dxf_read_long (fp, &mleader->color_value);
+                                break;
+                        case 430:
+                                /* Now follows a string containing a color
+                                 * name value. */
+                                dxf_read_string_interned (fp, &mleader->color_name);
+                                break;
+                        case 440:
+                                /* Now follows a string containing a transparency
+                                 * value. */
+                                dxf_read_long (fp, &mleader->transparency);
+                                break;
+                        case 999:
+                                /* Now follows a string containing a comment. */
+                                dxf_read_line (temp_string, fp);
+                                fprintf (stdout, "DXF comment: %s\n", temp_string);
+                                break;
+                        default:
+                                fprintf (stderr,
+                                  (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
+                                  __FUNCTION__, fp->filename, fp->line_number);
+                                /* Skip the value of the unknown group code. */
+                                dxf_read_line (temp_string, fp);
+                                break;
                 }
         }
         /* Handle omitted members and/or illegal values. */
         if (strcmp (mleader->linetype, "") == 0)
         {
-                mleader->linetype = strdup (DXF_DEFAULT_LINETYPE);
+                mleader->linetype = dxf_strdup (DXF_DEFAULT_LINETYPE);
         }
         if (strcmp (mleader->layer, "") == 0)
         {
-                mleader->layer = strdup (DXF_DEFAULT_LAYER);
+                mleader->layer = dxf_strdup (DXF_DEFAULT_LAYER);
         }
-        /* Clean up. */
-        free (temp_string);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -708,7 +599,7 @@ dxf_mleader_write
 #ifdef DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        char *dxf_entity_name = strdup ("MLEADER");
+        char *dxf_entity_name = dxf_strdup ("MLEADER");
 
         /* Do some basic checks. */
         if (fp == NULL)
@@ -717,7 +608,7 @@ dxf_mleader_write
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (mleader == NULL)
@@ -726,34 +617,34 @@ dxf_mleader_write
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if ((strcmp (mleader->layer, "") == 0) || (mleader->layer == NULL))
         {
                 fprintf (stderr,
-                  (_("Warning in %s () invalid layer string for the %s entity with id-code: %x\n")),
+                  (_("Warning in %s () invalid layer string for the %s entity with id-code: %" PRIx64 "\n")),
                   __FUNCTION__, dxf_entity_name, mleader->id_code);
                 fprintf (stderr,
                   (_("\t%s entity is relocated to layer 0")),
                   dxf_entity_name);
-                mleader->layer = strdup (DXF_DEFAULT_LAYER);
+                mleader->layer = dxf_strdup (DXF_DEFAULT_LAYER);
         }
         if (mleader->linetype == NULL)
         {
                 fprintf (stderr,
-                  (_("Warning in %s () invalid linetype string for the %s entity with id-code: %x\n")),
+                  (_("Warning in %s () invalid linetype string for the %s entity with id-code: %" PRIx64 "\n")),
                   __FUNCTION__, dxf_entity_name, mleader->id_code);
                 fprintf (stderr,
                   (_("\t%s linetype is set to %s\n")),
                   dxf_entity_name, DXF_DEFAULT_LINETYPE);
-                mleader->linetype = strdup (DXF_DEFAULT_LINETYPE);
+                mleader->linetype = dxf_strdup (DXF_DEFAULT_LINETYPE);
         }
         /* Start writing output. */
-        fprintf (fp->fp, "  0\n%s\n", dxf_entity_name);
-        if (mleader->id_code != -1)
+        dxf_write_string (fp, 0, dxf_entity_name);
+        if (mleader->id_code != DXF_HANDLE_NONE)
         {
-                fprintf (fp->fp, "  5\n%x\n", mleader->id_code);
+                dxf_write_hex (fp, 5, mleader->id_code);
         }
         /*!
          * \todo for version R14.\n
@@ -765,76 +656,76 @@ dxf_mleader_write
          * 102 groups are application defined (optional).\n\n
          * End of group, "}" (optional), with Group code 102.
          */
-        if ((strcmp (mleader->dictionary_owner_soft, "") != 0)
+        if ((mleader->dictionary_owner_soft != 0)
           && (fp->acad_version_number >= AutoCAD_14))
         {
-                fprintf (fp->fp, "102\n{ACAD_REACTORS\n");
-                fprintf (fp->fp, "330\n%s\n", mleader->dictionary_owner_soft);
-                fprintf (fp->fp, "102\n}\n");
+                dxf_write_string (fp, 102, "{ACAD_REACTORS");
+                dxf_write_hex (fp, 330, mleader->dictionary_owner_soft);
+                dxf_write_string (fp, 102, "}");
         }
-        if ((strcmp (mleader->dictionary_owner_hard, "") != 0)
+        if ((mleader->dictionary_owner_hard != 0)
           && (fp->acad_version_number >= AutoCAD_14))
         {
-                fprintf (fp->fp, "102\n{ACAD_XDICTIONARY\n");
-                fprintf (fp->fp, "360\n%s\n", mleader->dictionary_owner_hard);
-                fprintf (fp->fp, "102\n}\n");
+                dxf_write_string (fp, 102, "{ACAD_XDICTIONARY");
+                dxf_write_hex (fp, 360, mleader->dictionary_owner_hard);
+                dxf_write_string (fp, 102, "}");
         }
-        if ((strcmp (mleader->object_owner_soft, "") != 0)
+        if ((mleader->object_owner_soft != 0)
           && (fp->acad_version_number >= AutoCAD_2000))
         {
-                fprintf (fp->fp, "330\n%s\n", mleader->object_owner_soft);
+                dxf_write_hex (fp, 330, mleader->object_owner_soft);
         }
         if (fp->acad_version_number >= AutoCAD_13)
         {
-                fprintf (fp->fp, "100\nAcDbEntity\n");
+                dxf_write_string (fp, 100, "AcDbEntity");
         }
         if (mleader->paperspace == DXF_PAPERSPACE)
         {
-                fprintf (fp->fp, " 67\n%d\n", (int16_t) DXF_PAPERSPACE);
+                dxf_write_int (fp, 67, (int16_t) DXF_PAPERSPACE);
         }
-        fprintf (fp->fp, "  8\n%s\n", mleader->layer);
+        dxf_write_string (fp, 8, mleader->layer);
         if (strcmp (mleader->linetype, DXF_DEFAULT_LINETYPE) != 0)
         {
-                fprintf (fp->fp, "  6\n%s\n", mleader->linetype);
+                dxf_write_string (fp, 6, mleader->linetype);
         }
         if ((fp->acad_version_number >= AutoCAD_2008)
-          && (strcmp (mleader->material, "") != 0))
+          && (mleader->material != 0))
         {
-                fprintf (fp->fp, "347\n%s\n", mleader->material);
+                dxf_write_hex (fp, 347, mleader->material);
         }
         if (mleader->color != DXF_COLOR_BYLAYER)
         {
-                fprintf (fp->fp, " 62\n%d\n", mleader->color);
+                dxf_write_int (fp, 62, mleader->color);
         }
         if (fp->acad_version_number >= AutoCAD_2002)
         {
-                fprintf (fp->fp, "370\n%d\n", mleader->lineweight);
+                dxf_write_int (fp, 370, mleader->lineweight);
         }
         if ((fp->acad_version_number <= AutoCAD_11)
           && DXF_FLATLAND
           && (mleader->elevation != 0.0))
         {
-                fprintf (fp->fp, " 38\n%f\n", mleader->elevation);
+                dxf_write_double (fp, 38, mleader->elevation);
         }
         if ((fp->acad_version_number <= AutoCAD_13)
           && (mleader->thickness != 0.0))
         {
-                fprintf (fp->fp, " 39\n%f\n", mleader->thickness);
+                dxf_write_double (fp, 39, mleader->thickness);
         }
         if (mleader->linetype_scale != 1.0)
         {
-                fprintf (fp->fp, " 48\n%f\n", mleader->linetype_scale);
+                dxf_write_double (fp, 48, mleader->linetype_scale);
         }
         if (mleader->visibility != 0)
         {
-                fprintf (fp->fp, " 60\n%d\n", mleader->visibility);
+                dxf_write_int (fp, 60, mleader->visibility);
         }
         if (fp->acad_version_number >= AutoCAD_2000)
         {
 #ifdef BUILD_64
-                fprintf (fp->fp, "160\n%d\n", mleader->graphics_data_size);
+                dxf_write_int (fp, 160, mleader->graphics_data_size);
 #else
-                fprintf (fp->fp, " 92\n%d\n", mleader->graphics_data_size);
+                dxf_write_int (fp, 92, mleader->graphics_data_size);
 #endif
                 if (mleader->binary_graphics_data != NULL)
                 {
@@ -842,24 +733,24 @@ dxf_mleader_write
                         iter = (DxfBinaryGraphicsData *) mleader->binary_graphics_data;
                         while (iter != NULL)
                         {
-                                fprintf (fp->fp, "310\n%s\n", iter->data_line);
+                                dxf_write_string (fp, 310, iter->data_line);
                                 iter = (DxfBinaryGraphicsData *) iter->next;
                         }
                 }
         }
         if (fp->acad_version_number >= AutoCAD_2004)
         {
-                fprintf (fp->fp, "420\n%ld\n", mleader->color_value);
-                fprintf (fp->fp, "430\n%s\n", mleader->color_name);
-                fprintf (fp->fp, "440\n%ld\n", mleader->transparency);
+                dxf_write_int (fp, 420, mleader->color_value);
+                dxf_write_string (fp, 430, mleader->color_name);
+                dxf_write_int (fp, 440, mleader->transparency);
         }
         if (fp->acad_version_number >= AutoCAD_2009)
         {
-                fprintf (fp->fp, "390\n%s\n", mleader->plot_style_name);
-                fprintf (fp->fp, "284\n%d\n", mleader->shadow_mode);
+                dxf_write_hex (fp, 390, mleader->plot_style_name);
+                dxf_write_int (fp, 284, mleader->shadow_mode);
         }
         /* Clean up. */
-        free (dxf_entity_name);
+        dxf_free (dxf_entity_name);
 #ifdef DEBUG
         DXF_DEBUG_END
 #endif
@@ -900,24 +791,19 @@ dxf_mleader_free
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        free (mleader->linetype);
-        free (mleader->layer);
+        dxf_string_free (mleader->linetype);
+        dxf_string_free (mleader->layer);
         dxf_binary_graphics_data_free_list (mleader->binary_graphics_data);
-        free (mleader->dictionary_owner_soft);
-        free (mleader->object_owner_soft);
-        free (mleader->material);
-        free (mleader->dictionary_owner_hard);
-        free (mleader->plot_style_name);
-        free (mleader->color_name);
-        free (mleader->block_attribute_text_string);
-        free (mleader->block_attribute_id);
-        free (mleader->leader_style_id);
-        free (mleader->leader_linetype_id);
-        free (mleader->arrowhead_id);
-        free (mleader->text_style_id);
-        free (mleader->block_content_id);
-        free (mleader->arrow_head_id);
-        free (mleader);
+        dxf_string_free (mleader->color_name);
+        dxf_free (mleader->block_attribute_text_string);
+        dxf_free (mleader->block_attribute_id);
+        dxf_free (mleader->leader_style_id);
+        dxf_free (mleader->leader_linetype_id);
+        dxf_free (mleader->arrowhead_id);
+        dxf_free (mleader->text_style_id);
+        dxf_free (mleader->block_content_id);
+        dxf_free (mleader->arrow_head_id);
+        dxf_free (mleader);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -963,7 +849,7 @@ dxf_mleader_free_list
  *
  * \return \c id_code.
  */
-int
+uint64_t
 dxf_mleader_get_id_code
 (
         DxfMLeader *mleader
@@ -981,12 +867,6 @@ dxf_mleader_get_id_code
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (mleader->id_code < 0)
-        {
-                fprintf (stderr,
-                  (_("Warning in %s () a negative value was found.\n")),
-                  __FUNCTION__);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1005,7 +885,7 @@ dxf_mleader_set_id_code
 (
         DxfMLeader *mleader,
                 /*!< a pointer to a DXF \c MLEADER entity. */
-        int id_code
+        uint64_t id_code
                 /*!< the \c id_code to be set for the entity.\n
                  * This is to be an unique (sequential) number in the
                  * DXF file. */
@@ -1022,12 +902,6 @@ dxf_mleader_set_id_code
                   __FUNCTION__);
                 return (NULL);
         }
-        if (id_code < 0)
-        {
-                fprintf (stderr,
-                  (_("Warning in %s () a negative value was passed.\n")),
-                  __FUNCTION__);
-        }
         mleader->id_code = id_code;
 #if DEBUG
         DXF_DEBUG_END
@@ -1069,7 +943,7 @@ dxf_mleader_get_linetype
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (mleader->linetype));
+        return (dxf_strdup (mleader->linetype));
 }
 
 
@@ -1107,7 +981,7 @@ dxf_mleader_set_linetype
                   __FUNCTION__);
                 return (NULL);
         }
-        mleader->linetype = strdup (linetype);
+        mleader->linetype = dxf_strdup (linetype);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1148,7 +1022,7 @@ dxf_mleader_get_layer
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (mleader->layer));
+        return (dxf_strdup (mleader->layer));
 }
 
 
@@ -1186,7 +1060,7 @@ dxf_mleader_set_layer
                   __FUNCTION__);
                 return (NULL);
         }
-        mleader->layer = strdup (layer);
+        mleader->layer = dxf_strdup (layer);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1932,11 +1806,9 @@ dxf_mleader_set_binary_graphics_data
  * \brief Get the pointer to the \c dictionary_owner_soft from a DXF 
  * \c MLEADER entity.
  *
- * \return pointer to the \c dictionary_owner_soft.
- *
- * \warning No checks are performed on the returned pointer (string).
+ * \return the handle of the \c dictionary_owner_soft.
  */
-char *
+uint64_t
 dxf_mleader_get_dictionary_owner_soft
 (
         DxfMLeader *mleader
@@ -1952,19 +1824,12 @@ dxf_mleader_get_dictionary_owner_soft
                 fprintf (stderr,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
-                return (NULL);
-        }
-        if (mleader->dictionary_owner_soft ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
+                return (0);
         }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (mleader->dictionary_owner_soft));
+        return (mleader->dictionary_owner_soft);
 }
 
 
@@ -1980,8 +1845,8 @@ dxf_mleader_set_dictionary_owner_soft
 (
         DxfMLeader *mleader,
                 /*!< a pointer to a DXF \c MLEADER entity. */
-        char *dictionary_owner_soft
-                /*!< a string containing the pointer to the \c
+        uint64_t dictionary_owner_soft
+                /*!< the handle of the \c
                  * dictionary_owner_soft for the entity. */
 )
 {
@@ -1996,14 +1861,7 @@ dxf_mleader_set_dictionary_owner_soft
                   __FUNCTION__);
                 return (NULL);
         }
-        if (dictionary_owner_soft == NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was passed.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
-        mleader->dictionary_owner_soft = strdup (dictionary_owner_soft);
+        mleader->dictionary_owner_soft = dictionary_owner_soft;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2016,10 +1874,8 @@ dxf_mleader_set_dictionary_owner_soft
  * \c MLEADER entity.
  *
  * \return soft pointer to the object owner.
- *
- * \warning No checks are performed on the returned pointer (string).
  */
-char *
+uint64_t
 dxf_mleader_get_object_owner_soft
 (
         DxfMLeader *mleader
@@ -2035,19 +1891,12 @@ dxf_mleader_get_object_owner_soft
                 fprintf (stderr,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
-                return (NULL);
-        }
-        if (mleader->object_owner_soft ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
+                return (0);
         }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (mleader->object_owner_soft));
+        return (mleader->object_owner_soft);
 }
 
 
@@ -2063,8 +1912,8 @@ dxf_mleader_set_object_owner_soft
 (
         DxfMLeader *mleader,
                 /*!< a pointer to a DXF \c MLEADER entity. */
-        char *object_owner_soft
-                /*!< a string containing the pointer to the
+        uint64_t object_owner_soft
+                /*!< the handle of the
                  * \c object_owner_soft for the entity. */
 )
 {
@@ -2079,14 +1928,7 @@ dxf_mleader_set_object_owner_soft
                   __FUNCTION__);
                 return (NULL);
         }
-        if (object_owner_soft == NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was passed.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
-        mleader->object_owner_soft = strdup (object_owner_soft);
+        mleader->object_owner_soft = object_owner_soft;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2098,12 +1940,10 @@ dxf_mleader_set_object_owner_soft
  * \brief Get the pointer to the \c material from a DXF \c MLEADER
  * entity.
  *
- * \return a pointer to \c material when successful, or \c NULL when an
+ * \return the handle \c material when successful, or 0 when an
  * error occurred.
- *
- * \warning No checks are performed on the returned pointer.
  */
-char *
+uint64_t
 dxf_mleader_get_material
 (
         DxfMLeader *mleader
@@ -2119,19 +1959,12 @@ dxf_mleader_get_material
                 fprintf (stderr,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
-                return (NULL);
-        }
-        if (mleader->material ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
+                return (0);
         }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (mleader->material));
+        return (mleader->material);
 }
 
 
@@ -2146,8 +1979,8 @@ dxf_mleader_set_material
 (
         DxfMLeader *mleader,
                 /*!< a pointer to a DXF \c MLEADER entity. */
-        char *material
-                /*!< a string containing the pointer to the \c
+        uint64_t material
+                /*!< the handle of the \c
                  * material for the entity. */
 )
 {
@@ -2162,14 +1995,7 @@ dxf_mleader_set_material
                   __FUNCTION__);
                 return (NULL);
         }
-        if (material == NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was passed.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
-        mleader->material = strdup (material);
+        mleader->material = material;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2181,11 +2007,9 @@ dxf_mleader_set_material
  * \brief Get the pointer to the \c dictionary_owner_hard from a DXF 
  * \c MLEADER entity.
  *
- * \return pointer to the \c dictionary_owner_hard.
- *
- * \warning No checks are performed on the returned pointer (string).
+ * \return the handle of the \c dictionary_owner_hard.
  */
-char *
+uint64_t
 dxf_mleader_get_dictionary_owner_hard
 (
         DxfMLeader *mleader
@@ -2201,19 +2025,12 @@ dxf_mleader_get_dictionary_owner_hard
                 fprintf (stderr,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
-                return (NULL);
-        }
-        if (mleader->dictionary_owner_hard ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
+                return (0);
         }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (mleader->dictionary_owner_hard));
+        return (mleader->dictionary_owner_hard);
 }
 
 
@@ -2229,8 +2046,8 @@ dxf_mleader_set_dictionary_owner_hard
 (
         DxfMLeader *mleader,
                 /*!< a pointer to a DXF \c MLEADER entity. */
-        char *dictionary_owner_hard
-                /*!< a string containing the pointer to the \c
+        uint64_t dictionary_owner_hard
+                /*!< the handle of the \c
                  * dictionary_owner_hard for the entity. */
 )
 {
@@ -2245,14 +2062,7 @@ dxf_mleader_set_dictionary_owner_hard
                   __FUNCTION__);
                 return (NULL);
         }
-        if (dictionary_owner_hard == NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was passed.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
-        mleader->dictionary_owner_hard = strdup (dictionary_owner_hard);
+        mleader->dictionary_owner_hard = dictionary_owner_hard;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2328,10 +2138,10 @@ dxf_mleader_set_lineweight
 /*!
  * \brief Get the \c plot_style_name from a DXF \c MLEADER entity.
  *
- * \return a pointer to \c plot_style_name when successful, or \c NULL
+ * \return the handle \c plot_style_name when successful, or 0
  * when an error occurred.
  */
-char *
+uint64_t
 dxf_mleader_get_plot_style_name
 (
         DxfMLeader *mleader
@@ -2347,19 +2157,12 @@ dxf_mleader_get_plot_style_name
                 fprintf (stderr,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
-                return (NULL);
-        }
-        if (mleader->plot_style_name ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
+                return (0);
         }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (mleader->plot_style_name));
+        return (mleader->plot_style_name);
 }
 
 
@@ -2374,7 +2177,7 @@ dxf_mleader_set_plot_style_name
 (
         DxfMLeader *mleader,
                 /*!< a pointer to a DXF \c MLEADER entity. */
-        char *plot_style_name
+        uint64_t plot_style_name
                 /*!< a string containing the \c plot_style_name for the
                  * entity. */
 )
@@ -2390,14 +2193,7 @@ dxf_mleader_set_plot_style_name
                   __FUNCTION__);
                 return (NULL);
         }
-        if (plot_style_name == NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was passed.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
-        mleader->plot_style_name = strdup (plot_style_name);
+        mleader->plot_style_name = plot_style_name;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2504,7 +2300,7 @@ dxf_mleader_get_color_name
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (mleader->color_name));
+        return (dxf_strdup (mleader->color_name));
 }
 
 
@@ -2542,7 +2338,7 @@ dxf_mleader_set_color_name
                   __FUNCTION__);
                 return (NULL);
         }
-        mleader->color_name = strdup (color_name);
+        mleader->color_name = dxf_strdup (color_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -4699,7 +4495,7 @@ dxf_mleader_get_block_attribute_text_string
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (mleader->block_attribute_text_string));
+        return (dxf_strdup (mleader->block_attribute_text_string));
 }
 
 
@@ -4739,7 +4535,7 @@ dxf_mleader_set_block_attribute_text_string
                   __FUNCTION__);
                 return (NULL);
         }
-        mleader->block_attribute_text_string = strdup (block_attribute_text_string);
+        mleader->block_attribute_text_string = dxf_strdup (block_attribute_text_string);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -4781,7 +4577,7 @@ dxf_mleader_get_block_attribute_id
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (mleader->block_attribute_id));
+        return (dxf_strdup (mleader->block_attribute_id));
 }
 
 
@@ -4819,7 +4615,7 @@ dxf_mleader_set_block_attribute_id
                   __FUNCTION__);
                 return (NULL);
         }
-        mleader->block_attribute_id = strdup (block_attribute_id);
+        mleader->block_attribute_id = dxf_strdup (block_attribute_id);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -4861,7 +4657,7 @@ dxf_mleader_get_leader_style_id
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (mleader->leader_style_id));
+        return (dxf_strdup (mleader->leader_style_id));
 }
 
 
@@ -4899,7 +4695,7 @@ dxf_mleader_set_leader_style_id
                   __FUNCTION__);
                 return (NULL);
         }
-        mleader->leader_style_id = strdup (leader_style_id);
+        mleader->leader_style_id = dxf_strdup (leader_style_id);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -4941,7 +4737,7 @@ dxf_mleader_get_leader_linetype_id
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (mleader->leader_linetype_id));
+        return (dxf_strdup (mleader->leader_linetype_id));
 }
 
 
@@ -4979,7 +4775,7 @@ dxf_mleader_set_leader_linetype_id
                   __FUNCTION__);
                 return (NULL);
         }
-        mleader->leader_linetype_id = strdup (leader_linetype_id);
+        mleader->leader_linetype_id = dxf_strdup (leader_linetype_id);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -5021,7 +4817,7 @@ dxf_mleader_get_arrowhead_id
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (mleader->arrowhead_id));
+        return (dxf_strdup (mleader->arrowhead_id));
 }
 
 
@@ -5059,7 +4855,7 @@ dxf_mleader_set_arrowhead_id
                   __FUNCTION__);
                 return (NULL);
         }
-        mleader->arrowhead_id = strdup (arrowhead_id);
+        mleader->arrowhead_id = dxf_strdup (arrowhead_id);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -5101,7 +4897,7 @@ dxf_mleader_get_text_style_id
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (mleader->text_style_id));
+        return (dxf_strdup (mleader->text_style_id));
 }
 
 
@@ -5139,7 +4935,7 @@ dxf_mleader_set_text_style_id
                   __FUNCTION__);
                 return (NULL);
         }
-        mleader->text_style_id = strdup (text_style_id);
+        mleader->text_style_id = dxf_strdup (text_style_id);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -5181,7 +4977,7 @@ dxf_mleader_get_block_content_id
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (mleader->block_content_id));
+        return (dxf_strdup (mleader->block_content_id));
 }
 
 
@@ -5219,7 +5015,7 @@ dxf_mleader_set_block_content_id
                   __FUNCTION__);
                 return (NULL);
         }
-        mleader->block_content_id = strdup (block_content_id);
+        mleader->block_content_id = dxf_strdup (block_content_id);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -5261,7 +5057,7 @@ dxf_mleader_get_arrow_head_id
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (mleader->arrow_head_id));
+        return (dxf_strdup (mleader->arrow_head_id));
 }
 
 
@@ -5299,7 +5095,7 @@ dxf_mleader_set_arrow_head_id
                   __FUNCTION__);
                 return (NULL);
         }
-        mleader->arrow_head_id = strdup (arrow_head_id);
+        mleader->arrow_head_id = dxf_strdup (arrow_head_id);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -5455,7 +5251,7 @@ dxf_mleader_context_data_new ()
         size = sizeof (DxfMLeaderContextData);
         /* avoid malloc of 0 bytes */
         if (size == 0) size = 1;
-        if ((data = malloc (size)) == NULL)
+        if ((data = dxf_malloc (size)) == NULL)
         {
                 fprintf (stderr,
                   (_("Error in %s () could not allocate memory.\n")),
@@ -5555,9 +5351,9 @@ dxf_mleader_context_data_init
         data->text_use_word_break = 0;
         data->has_block = 0;
         data->MLeader_plane_normal_reversed = 0;
-        data->default_text_contents = strdup ("");
-        data->type_style_id = strdup ("");
-        data->block_content_id = strdup ("");
+        data->default_text_contents = dxf_strdup ("");
+        data->type_style_id = dxf_strdup ("");
+        data->block_content_id = dxf_strdup ("");
         data->next = NULL;
 #if DEBUG
         DXF_DEBUG_END
@@ -5607,10 +5403,10 @@ dxf_mleader_context_data_free
         dxf_point_free_list (data->p3);
         dxf_point_free_list (data->p4);
         dxf_point_free_list (data->p5);
-        free (data->default_text_contents);
-        free (data->type_style_id);
-        free (data->block_content_id);
-        free (data);
+        dxf_free (data->default_text_contents);
+        dxf_free (data->type_style_id);
+        dxf_free (data->block_content_id);
+        dxf_free (data);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -10624,7 +10420,7 @@ dxf_mleader_leader_node_new ()
         size = sizeof (DxfMLeaderLeaderNode);
         /* avoid malloc of 0 bytes */
         if (size == 0) size = 1;
-        if ((node = malloc (size)) == NULL)
+        if ((node = dxf_malloc (size)) == NULL)
         {
                 fprintf (stderr,
                   (_("Error in %s () could not allocate memory.\n")),
@@ -10733,7 +10529,7 @@ dxf_mleader_leader_node_free
         dxf_point_free_list (node->p1);
         dxf_point_free_list (node->p2);
         dxf_point_free_list (node->p3);
-        free (node);
+        dxf_free (node);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -12512,7 +12308,7 @@ dxf_mleader_leader_line_new ()
         size = sizeof (DxfMLeaderLeaderLine);
         /* avoid malloc of 0 bytes */
         if (size == 0) size = 1;
-        if ((line = malloc (size)) == NULL)
+        if ((line = dxf_malloc (size)) == NULL)
         {
                 fprintf (stderr,
                   (_("Error in %s () could not allocate memory.\n")),
@@ -12616,7 +12412,7 @@ dxf_mleader_leader_line_free
         dxf_point_free_list (line->p0);
         dxf_point_free_list (line->p1);
         dxf_point_free_list (line->p2);
-        free (line);
+        dxf_free (line);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -55,7 +55,7 @@ typedef struct
 dxf_mleader_struct
 {
         /* Members common for all DXF drawable entities. */
-        int id_code;
+        uint64_t id_code;
                 /*!< Identification number for the entity.\n
                  * This is to be an unique (sequential) number in the DXF
                  * file.\n
@@ -128,20 +128,20 @@ dxf_mleader_struct
                  * (optional).\n
                  * Group code = 310.\n
                  * \since Introduced in version R2000. */
-        char *dictionary_owner_soft;
+        uint64_t dictionary_owner_soft;
                 /*!< Soft-pointer ID/handle to owner dictionary (optional).\n
                  * Group code = 330.\n
                  * \since Introduced in version R14. */
-        char *object_owner_soft;
+        uint64_t object_owner_soft;
                 /*!< Soft-pointer ID/handle  to owner BLOCK_RECORD object.\n
                  * Group code = 330.\n
                  * \since Introduced in version R2000. */
-        char *material;
+        uint64_t material;
                 /*!< Hard-pointer ID/handle to material object (present if
                  * not BYLAYER).\n
                  * Group code = 347.\n
                  * \since Introduced in version R2008. */
-        char *dictionary_owner_hard;
+        uint64_t dictionary_owner_hard;
                 /*!< Hard owner ID/handle to owner dictionary (optional).\n
                  * Group code = 360.\n
                  * \since Introduced in version R14. */
@@ -150,7 +150,7 @@ dxf_mleader_struct
                  * Stored and moved around as a 16-bit integer.\n
                  * Group code = 370.\n
                  * \since Introduced in version R2002. */
-        char *plot_style_name;
+        uint64_t plot_style_name;
                 /*!< Hard pointer ID / handle of PlotStyleName object.\n
                  * Group code = 390.\n
                  * \since Introduced in version R2009. */
@@ -536,8 +536,8 @@ DxfMLeader *dxf_mleader_read (DxfFile *fp, DxfMLeader *mleader);
 int dxf_mleader_write (DxfFile *fp, DxfMLeader *mleader);
 int dxf_mleader_free (DxfMLeader *mleader);
 void dxf_mleader_free_list (DxfMLeader *mleaders);
-int dxf_mleader_get_id_code (DxfMLeader *mleader);
-DxfMLeader *dxf_mleader_set_id_code (DxfMLeader *mleader, int id_code);
+uint64_t dxf_mleader_get_id_code (DxfMLeader *mleader);
+DxfMLeader *dxf_mleader_set_id_code (DxfMLeader *mleader, uint64_t id_code);
 char *dxf_mleader_get_linetype (DxfMLeader *mleader);
 DxfMLeader *dxf_mleader_set_linetype (DxfMLeader *mleader, char *linetype);
 char *dxf_mleader_get_layer (DxfMLeader *mleader);
@@ -560,18 +560,18 @@ int16_t dxf_mleader_get_shadow_mode (DxfMLeader *mleader);
 DxfMLeader *dxf_mleader_set_shadow_mode (DxfMLeader *mleader, int16_t shadow_mode);
 DxfBinaryGraphicsData *dxf_mleader_get_binary_graphics_data (DxfMLeader *mleader);
 DxfMLeader *dxf_mleader_set_binary_graphics_data (DxfMLeader *mleader, DxfBinaryGraphicsData *data);
-char *dxf_mleader_get_dictionary_owner_soft (DxfMLeader *mleader);
-DxfMLeader *dxf_mleader_set_dictionary_owner_soft (DxfMLeader *mleader, char *dictionary_owner_soft);
-char *dxf_mleader_get_object_owner_soft (DxfMLeader *mleader);
-DxfMLeader *dxf_mleader_set_object_owner_soft (DxfMLeader *mleader, char *object_owner_soft);
-char *dxf_mleader_get_material (DxfMLeader *mleader);
-DxfMLeader *dxf_mleader_set_material (DxfMLeader *mleader, char *material);
-char *dxf_mleader_get_dictionary_owner_hard (DxfMLeader *mleader);
-DxfMLeader *dxf_mleader_set_dictionary_owner_hard (DxfMLeader *mleader, char *dictionary_owner_hard);
+uint64_t dxf_mleader_get_dictionary_owner_soft (DxfMLeader *mleader);
+DxfMLeader *dxf_mleader_set_dictionary_owner_soft (DxfMLeader *mleader, uint64_t dictionary_owner_soft);
+uint64_t dxf_mleader_get_object_owner_soft (DxfMLeader *mleader);
+DxfMLeader *dxf_mleader_set_object_owner_soft (DxfMLeader *mleader, uint64_t object_owner_soft);
+uint64_t dxf_mleader_get_material (DxfMLeader *mleader);
+DxfMLeader *dxf_mleader_set_material (DxfMLeader *mleader, uint64_t material);
+uint64_t dxf_mleader_get_dictionary_owner_hard (DxfMLeader *mleader);
+DxfMLeader *dxf_mleader_set_dictionary_owner_hard (DxfMLeader *mleader, uint64_t dictionary_owner_hard);
 int16_t dxf_mleader_get_lineweight (DxfMLeader *mleader);
 DxfMLeader *dxf_mleader_set_lineweight (DxfMLeader *mleader, int16_t lineweight);
-char *dxf_mleader_get_plot_style_name (DxfMLeader *mleader);
-DxfMLeader *dxf_mleader_set_plot_style_name (DxfMLeader *mleader, char *plot_style_name);
+uint64_t dxf_mleader_get_plot_style_name (DxfMLeader *mleader);
+DxfMLeader *dxf_mleader_set_plot_style_name (DxfMLeader *mleader, uint64_t plot_style_name);
 long dxf_mleader_get_color_value (DxfMLeader *mleader);
 DxfMLeader *dxf_mleader_set_color_value (DxfMLeader *mleader, long color_value);
 char *dxf_mleader_get_color_name (DxfMLeader *mleader);
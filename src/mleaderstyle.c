@@ -36,6 +36,7 @@
 
 
 #include "mleaderstyle.h"
+#include "util.h"
 
 
 /*!
@@ -58,7 +59,7 @@ dxf_mleaderstyle_new ()
         size = sizeof (DxfMLeaderstyle);
         /* avoid malloc of 0 bytes */
         if (size == 0) size = 1;
-        if ((mleaderstyle = malloc (size)) == NULL)
+        if ((mleaderstyle = dxf_malloc (size)) == NULL)
         {
                 fprintf (stderr,
                   (_("Error in %s () could not allocate memory.\n")),
@@ -108,9 +109,9 @@ dxf_mleaderstyle_init
                   __FUNCTION__);
                 return (NULL);
         }
-        mleaderstyle->id_code = 0;
-        mleaderstyle->linetype = strdup (DXF_DEFAULT_LINETYPE);
-        mleaderstyle->layer = strdup (DXF_DEFAULT_LAYER);
+        mleaderstyle->id_code = DXF_HANDLE_NONE;
+        mleaderstyle->linetype = dxf_strdup (DXF_DEFAULT_LINETYPE);
+        mleaderstyle->layer = dxf_strdup (DXF_DEFAULT_LAYER);
         mleaderstyle->elevation = 0.0;
         mleaderstyle->thickness = 0.0;
         mleaderstyle->linetype_scale = DXF_DEFAULT_LINETYPE_SCALE;
@@ -121,16 +122,16 @@ dxf_mleaderstyle_init
         mleaderstyle->shadow_mode = 0;
         mleaderstyle->binary_graphics_data = (DxfBinaryGraphicsData *) dxf_binary_graphics_data_new ();
         mleaderstyle->binary_graphics_data = (DxfBinaryGraphicsData *) dxf_binary_graphics_data_init (mleaderstyle->binary_graphics_data);
-        mleaderstyle->dictionary_owner_soft = strdup ("");
-        mleaderstyle->object_owner_soft = strdup ("");
-        mleaderstyle->material = strdup ("");
-        mleaderstyle->dictionary_owner_hard = strdup ("");
+        mleaderstyle->dictionary_owner_soft = 0;
+        mleaderstyle->object_owner_soft = 0;
+        mleaderstyle->material = 0;
+        mleaderstyle->dictionary_owner_hard = 0;
         mleaderstyle->lineweight = 0;
-        mleaderstyle->plot_style_name = strdup ("");
+        mleaderstyle->plot_style_name = 0;
         mleaderstyle->color_value = 0;
-        mleaderstyle->color_name = strdup ("");
+        mleaderstyle->color_name = dxf_strdup ("");
         mleaderstyle->transparency = 0;
-        mleaderstyle->mleaderstyle_description = strdup ("");
+        mleaderstyle->mleaderstyle_description = dxf_strdup ("");
         mleaderstyle->first_segment_angle_constraint = 0.0;
         mleaderstyle->second_segment_angle_constraint = 0.0;
         mleaderstyle->landing_gap = 0.0;
@@ -167,11 +168,11 @@ dxf_mleaderstyle_init
         mleaderstyle->overwrite_property_value = 1;
         mleaderstyle->is_annotative = 1;
         mleaderstyle->text_align_always_left = 1;
-        mleaderstyle->default_mtext_contents = strdup ("");
-        mleaderstyle->leader_linetype_id = strdup ("");
-        mleaderstyle->arrow_head_id = strdup ("");
-        mleaderstyle->mtext_style_id = strdup ("");
-        mleaderstyle->block_content_id = strdup ("");
+        mleaderstyle->default_mtext_contents = dxf_strdup ("");
+        mleaderstyle->leader_linetype_id = dxf_strdup ("");
+        mleaderstyle->arrow_head_id = dxf_strdup ("");
+        mleaderstyle->mtext_style_id = dxf_strdup ("");
+        mleaderstyle->block_content_id = dxf_strdup ("");
         mleaderstyle->next = NULL;
 #if DEBUG
         DXF_DEBUG_END
@@ -203,7 +204,8 @@ dxf_mleaderstyle_read
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        char *temp_string = NULL;
+        char temp_string[DXF_MAX_STRING_LENGTH];
+        int group_code;
         DxfBinaryGraphicsData *iter310 = NULL;
         int iter330;
 
@@ -213,8 +215,6 @@ dxf_mleaderstyle_read
                 fprintf (stderr,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
-                /* Clean up. */
-                free (temp_string);
                 return (NULL);
         }
         if (mleaderstyle == NULL)
@@ -226,211 +226,172 @@ dxf_mleaderstyle_read
         }
         iter310 = (DxfBinaryGraphicsData *) mleaderstyle->binary_graphics_data;
         iter330 = 0;
-        (fp->line_number)++;
-        fscanf (fp->fp, "%[^\n]", temp_string);
-        while (strcmp (temp_string, "0") != 0)
+        while ((dxf_read_group_code (fp, &group_code) == EXIT_SUCCESS)
+          && (group_code != 0))
         {
-                if (ferror (fp->fp))
+                if (dxf_read_error (fp))
                 {
                         fprintf (stderr,
                           (_("Error in %s () while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
-                        fclose (fp->fp);
-                        /* Clean up. */
-                        free (temp_string);
                         return (NULL);
                 }
-                if (strcmp (temp_string, "5") == 0)
+                switch (group_code)
                 {
-                        /* Now follows a string containing a sequential
-                         * id number. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%x\n", (uint *) &mleaderstyle->id_code);
-                }
-                else if (strcmp (temp_string, "6") == 0)
-                {
-                        /* Now follows a string containing a linetype
-                         * name. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, mleaderstyle->linetype);
-                }
-                else if (strcmp (temp_string, "8") == 0)
-                {
-                        /* Now follows a string containing a layer name. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, mleaderstyle->layer);
-                }
-                else if ((fp->acad_version_number <= AutoCAD_11)
-                        && (strcmp (temp_string, "38") == 0))
-                {
-                        /* Now follows a string containing the
-                         * elevation. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &mleaderstyle->elevation);
-                }
-                else if (strcmp (temp_string, "39") == 0)
-                {
-                        /* Now follows a string containing the
-                         * thickness. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &mleaderstyle->thickness);
-                }
-                else if (strcmp (temp_string, "48") == 0)
-                {
-                        /* Now follows a string containing the linetype
-                         * scale. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &mleaderstyle->linetype_scale);
-                }
-                else if (strcmp (temp_string, "60") == 0)
-                {
-                        /* Now follows a string containing the
-                         * visibility value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%hd\n", &mleaderstyle->visibility);
-                }
-                else if (strcmp (temp_string, "62") == 0)
-                {
-                        /* Now follows a string containing the
-                         * color value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%d\n", &mleaderstyle->color);
-                }
-                else if (strcmp (temp_string, "67") == 0)
-                {
-                        /* Now follows a string containing the
-                         * paperspace value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%d\n", &mleaderstyle->paperspace);
-                }
-                else if (strcmp (temp_string, "92") == 0)
-                {
-                        /* Now follows a string containing the
-                         * graphics data size value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%d\n", &mleaderstyle->graphics_data_size);
-                }
-                else if (strcmp (temp_string, "93") == 0)
-                {
-                        /* Now follows a string containing the
-                         * text color. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%d\n", &mleaderstyle->text_color);
-                }
-                else if (strcmp (temp_string, "160") == 0)
-                {
-                        /* Now follows a string containing the
-                         * graphics data size value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%d\n", &mleaderstyle->graphics_data_size);
-                }
-                else if (strcmp (temp_string, "284") == 0)
-                {
-                        /* Now follows a string containing the shadow
-                         * mode value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%hd\n", &mleaderstyle->shadow_mode);
-                }
-                else if (strcmp (temp_string, "310") == 0)
-                {
-                        /* Now follows a string containing binary
-                         * graphics data. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, iter310->data_line);
-                        dxf_binary_graphics_data_init ((DxfBinaryGraphicsData *) iter310->next);
-                        iter310 = (DxfBinaryGraphicsData *) iter310->next;
-                }
-                else if (strcmp (temp_string, "330") == 0)
-                {
-                        if (iter330 == 0)
-                        {
-                                /* Now follows a string containing a soft-pointer
+                        case 5:
+                                /* Now follows a string containing a sequential
+                                 * id number. */
+                                dxf_read_handle (fp, &mleaderstyle->id_code);
+                                break;
+                        case 6:
+                                /* Now follows a string containing a linetype
+                                 * name. */
+                                dxf_read_string_interned (fp, &mleaderstyle->linetype);
+                                break;
+                        case 8:
+                                /* Now follows a string containing a layer name. */
+                                dxf_read_string_interned (fp, &mleaderstyle->layer);
+                                break;
+                        case 38:
+                                if (fp->acad_version_number <= AutoCAD_11)
+                                {
+                                        /* Now follows a string containing the
+                                         * elevation. */
+                                        dxf_read_double (fp, &mleaderstyle->elevation);
+                                }
+                                else
+                                {
+                                        fprintf (stderr,
+                                          (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
+                                          __FUNCTION__, fp->filename, fp->line_number);
+                                        /* Skip the value of the unknown group code. */
+                                        dxf_read_line (temp_string, fp);
+                                }
+                                break;
+                        case 39:
+                                /* Now follows a string containing the
+                                 * thickness. */
+                                dxf_read_double (fp, &mleaderstyle->thickness);
+                                break;
+                        case 48:
+                                /* Now follows a string containing the linetype
+                                 * scale. */
+                                dxf_read_double (fp, &mleaderstyle->linetype_scale);
+                                break;
+                        case 60:
+                                /* Now follows a string containing the
+                                 * visibility value. */
+                                dxf_read_int16 (fp, &mleaderstyle->visibility);
+                                break;
+                        case 62:
+                                /* Now follows a string containing the
+                                 * color value. */
+                                dxf_read_int (fp, &mleaderstyle->color);
+                                break;
+                        case 67:
+                                /* Now follows a string containing the
+                                 * paperspace value. */
+                                dxf_read_int (fp, &mleaderstyle->paperspace);
+                                break;
+                        case 92:
+                                /* Now follows a string containing the
+                                 * graphics data size value. */
+                                dxf_read_int (fp, &mleaderstyle->graphics_data_size);
+                                break;
+                        case 93:
+                                /* Now follows a string containing the
+                                 * text color. */
+                                dxf_read_int (fp, &mleaderstyle->text_color);
+                                break;
+                        case 160:
+                                /* Now follows a string containing the
+                                 * graphics data size value. */
+                                dxf_read_int (fp, &mleaderstyle->graphics_data_size);
+                                break;
+                        case 284:
+                                /* Now follows a string containing the shadow
+                                 * mode value. */
+                                dxf_read_int16 (fp, &mleaderstyle->shadow_mode);
+                                break;
+                        case 310:
+                                /* Now follows a string containing binary
+                                 * graphics data. */
+                                dxf_read_string (fp, &iter310->data_line);
+                                dxf_binary_graphics_data_init ((DxfBinaryGraphicsData *) iter310->next);
+                                iter310 = (DxfBinaryGraphicsData *) iter310->next;
+                                break;
+                        case 330:
+                                if (iter330 == 0)
+                                {
+                                        /* Now follows a string containing a soft-pointer
+                                         * ID/handle to owner dictionary. */
+                                        dxf_read_handle (fp, &mleaderstyle->dictionary_owner_soft);
+                                }
+                                if (iter330 == 1)
+                                {
+                                        /* Now follows a string containing a soft-pointer
+                                         * ID/handle to owner object. */
+                                        dxf_read_handle (fp, &mleaderstyle->object_owner_soft);
+                                }
+                                iter330++;
+                                break;
+                        case 347:
+                                /* Now follows a string containing a
+                                 * hard-pointer ID/handle to material object. */
+                                dxf_read_handle (fp, &mleaderstyle->material);
+                                break;
+                        case 360:
+                                /* Now follows a string containing Hard owner
                                  * ID/handle to owner dictionary. */
-                                (fp->line_number)++;
-                                fscanf (fp->fp, DXF_MAX_STRING_FORMAT, mleaderstyle->dictionary_owner_soft);
-                        }
-                        if (iter330 == 1)
-                        {
-                                /* Now follows a string containing a soft-pointer
-                                 * ID/handle to owner object. */
-                                (fp->line_number)++;
-                                fscanf (fp->fp, DXF_MAX_STRING_FORMAT, mleaderstyle->object_owner_soft);
-                        }
-                        iter330++;
-                }
-                else if (strcmp (temp_string, "347") == 0)
-                {
-                        /* Now follows a string containing a
-                         * hard-pointer ID/handle to material object. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, mleaderstyle->material);
-                }
-                else if (strcmp (temp_string, "360") == 0)
-                {
-                        /* Now follows a string containing Hard owner
-                         * ID/handle to owner dictionary. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, mleaderstyle->dictionary_owner_hard);
-                }
-                else if (strcmp (temp_string, "370") == 0)
-                {
-                        /* Now follows a string containing the lineweight
-                         * value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%hd\n", &mleaderstyle->lineweight);
-                }
-                else if (strcmp (temp_string, "390") == 0)
-                {
-                        /* Now follows a string containing a plot style
-                         * name value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, mleaderstyle->plot_style_name);
-                }
-                else if (strcmp (temp_string, "420") == 0)
-                {
-                        /* Now follows a string containing a color value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%ld\n", &mleaderstyle->color_value);
-                }
-                else if (strcmp (temp_string, "430") == 0)
-                {
-                        /* Now follows a string containing a color
-                         * name value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, mleaderstyle->color_name);
-                }
-                else if (strcmp (temp_string, "440") == 0)
-                {
-                        /* Now follows a string containing a transparency
-                         * value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%ld\n", &mleaderstyle->transparency);
-                }
-                else if (strcmp (temp_string, "999") == 0)
-                {
-                        /* Now follows a string containing a comment. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
-                        fprintf (stdout, "DXF comment: %s\n", temp_string);
-                }
-                else
-                {
-                        fprintf (stderr,
-                          (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
-                          __FUNCTION__, fp->filename, fp->line_number);
+                                dxf_read_handle (fp, &mleaderstyle->dictionary_owner_hard);
+                                break;
+                        case 370:
+                                /* Now follows a string containing the lineweight
+                                 * value. */
+                                dxf_read_int16 (fp, &mleaderstyle->lineweight);
+                                break;
+                        case 390:
+                                /* Now follows a string containing a plot style
+                                 * name value. */
+                                dxf_read_handle (fp, &mleaderstyle->plot_style_name);
+                                break;
+                        case 420:
+                                /* Now follows a string containing a color value. */
+                                dxf_read_long (fp, &mleaderstyle->color_value);
+                                break;
+                        case 430:
+                                /* Now follows a string containing a color
+                                 * name value. */
+                                dxf_read_string_interned (fp, &mleaderstyle->color_name);
+                                break;
+                        case 440:
+                                /* Now follows a string containing a transparency
+                                 * value. */
+                                dxf_read_long (fp, &mleaderstyle->transparency);
+                                break;
+                        case 999:
+                                /* Now follows a string containing a comment. */
+                                dxf_read_line (temp_string, fp);
+                                fprintf (stdout, "DXF comment: %s\n", temp_string);
+                                break;
+                        default:
+                                fprintf (stderr,
+                                  (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
+                                  __FUNCTION__, fp->filename, fp->line_number);
+                                /* Skip the value of the unknown group code. */
+                                dxf_read_line (temp_string, fp);
+                                break;
                 }
         }
         /* Handle omitted members and/or illegal values. */
         if (strcmp (mleaderstyle->linetype, "") == 0)
         {
-                mleaderstyle->linetype = strdup (DXF_DEFAULT_LINETYPE);
+                mleaderstyle->linetype = dxf_strdup (DXF_DEFAULT_LINETYPE);
         }
         if (strcmp (mleaderstyle->layer, "") == 0)
         {
-                mleaderstyle->layer = strdup (DXF_DEFAULT_LAYER);
+                mleaderstyle->layer = dxf_strdup (DXF_DEFAULT_LAYER);
         }
-        /* Clean up. */
-        free (temp_string);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -456,12 +417,12 @@ dxf_mleaderstyle_write
 #ifdef DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        char *dxf_entity_name = strdup ("MLEADERSTYLE");
+        char *dxf_entity_name = dxf_strdup ("MLEADERSTYLE");
 
 /*! \todo Add code here. */
 
         /* Clean up. */
-        free (dxf_entity_name);
+        dxf_free (dxf_entity_name);
 #ifdef DEBUG
         DXF_DEBUG_END
 #endif
@@ -502,22 +463,17 @@ dxf_mleaderstyle_free
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        free (mleaderstyle->linetype);
-        free (mleaderstyle->layer);
+        dxf_string_free (mleaderstyle->linetype);
+        dxf_string_free (mleaderstyle->layer);
         dxf_binary_graphics_data_free_list (mleaderstyle->binary_graphics_data);
-        free (mleaderstyle->dictionary_owner_soft);
-        free (mleaderstyle->object_owner_soft);
-        free (mleaderstyle->material);
-        free (mleaderstyle->dictionary_owner_hard);
-        free (mleaderstyle->plot_style_name);
-        free (mleaderstyle->color_name);
-        free (mleaderstyle->mleaderstyle_description);
-        free (mleaderstyle->default_mtext_contents);
-        free (mleaderstyle->leader_linetype_id);
-        free (mleaderstyle->arrow_head_id);
-        free (mleaderstyle->mtext_style_id);
-        free (mleaderstyle->block_content_id);
-        free (mleaderstyle);
+        dxf_string_free (mleaderstyle->color_name);
+        dxf_free (mleaderstyle->mleaderstyle_description);
+        dxf_free (mleaderstyle->default_mtext_contents);
+        dxf_free (mleaderstyle->leader_linetype_id);
+        dxf_free (mleaderstyle->arrow_head_id);
+        dxf_free (mleaderstyle->mtext_style_id);
+        dxf_free (mleaderstyle->block_content_id);
+        dxf_free (mleaderstyle);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -563,7 +519,7 @@ dxf_mleaderstyle_free_list
  *
  * \return \c id_code.
  */
-int
+uint64_t
 dxf_mleaderstyle_get_id_code
 (
         DxfMLeaderstyle *mleaderstyle
@@ -581,12 +537,6 @@ dxf_mleaderstyle_get_id_code
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (mleaderstyle->id_code < 0)
-        {
-                fprintf (stderr,
-                  (_("Warning in %s () a negative value was found.\n")),
-                  __FUNCTION__);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -605,7 +555,7 @@ dxf_mleaderstyle_set_id_code
 (
         DxfMLeaderstyle *mleaderstyle,
                 /*!< a pointer to a DXF \c MLEADERSTYLE entity. */
-        int id_code
+        uint64_t id_code
                 /*!< the \c id_code to be set for the entity.\n
                  * This is to be an unique (sequential) number in the
                  * DXF file. */
@@ -622,12 +572,6 @@ dxf_mleaderstyle_set_id_code
                   __FUNCTION__);
                 return (NULL);
         }
-        if (id_code < 0)
-        {
-                fprintf (stderr,
-                  (_("Warning in %s () a negative value was passed.\n")),
-                  __FUNCTION__);
-        }
         mleaderstyle->id_code = id_code;
 #if DEBUG
         DXF_DEBUG_END
@@ -669,7 +613,7 @@ dxf_mleaderstyle_get_linetype
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (mleaderstyle->linetype));
+        return (dxf_strdup (mleaderstyle->linetype));
 }
 
 
@@ -707,7 +651,7 @@ dxf_mleaderstyle_set_linetype
                   __FUNCTION__);
                 return (NULL);
         }
-        mleaderstyle->linetype = strdup (linetype);
+        mleaderstyle->linetype = dxf_strdup (linetype);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -748,7 +692,7 @@ dxf_mleaderstyle_get_layer
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (mleaderstyle->layer));
+        return (dxf_strdup (mleaderstyle->layer));
 }
 
 
@@ -786,7 +730,7 @@ dxf_mleaderstyle_set_layer
                   __FUNCTION__);
                 return (NULL);
         }
-        mleaderstyle->layer = strdup (layer);
+        mleaderstyle->layer = dxf_strdup (layer);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1533,11 +1477,9 @@ dxf_mleaderstyle_set_binary_graphics_data
  * \brief Get the pointer to the \c dictionary_owner_soft from a DXF 
  * \c MLEADERSTYLE entity.
  *
- * \return pointer to the \c dictionary_owner_soft.
- *
- * \warning No checks are performed on the returned pointer (string).
+ * \return the handle of the \c dictionary_owner_soft.
  */
-char *
+uint64_t
 dxf_mleaderstyle_get_dictionary_owner_soft
 (
         DxfMLeaderstyle *mleaderstyle
@@ -1553,19 +1495,12 @@ dxf_mleaderstyle_get_dictionary_owner_soft
                 fprintf (stderr,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
-                return (NULL);
-        }
-        if (mleaderstyle->dictionary_owner_soft ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
+                return (0);
         }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (mleaderstyle->dictionary_owner_soft));
+        return (mleaderstyle->dictionary_owner_soft);
 }
 
 
@@ -1581,8 +1516,8 @@ dxf_mleaderstyle_set_dictionary_owner_soft
 (
         DxfMLeaderstyle *mleaderstyle,
                 /*!< a pointer to a DXF \c MLEADERSTYLE entity. */
-        char *dictionary_owner_soft
-                /*!< a string containing the pointer to the \c
+        uint64_t dictionary_owner_soft
+                /*!< the handle of the \c
                  * dictionary_owner_soft for the entity. */
 )
 {
@@ -1597,14 +1532,7 @@ dxf_mleaderstyle_set_dictionary_owner_soft
                   __FUNCTION__);
                 return (NULL);
         }
-        if (dictionary_owner_soft == NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was passed.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
-        mleaderstyle->dictionary_owner_soft = strdup (dictionary_owner_soft);
+        mleaderstyle->dictionary_owner_soft = dictionary_owner_soft;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1617,10 +1545,8 @@ dxf_mleaderstyle_set_dictionary_owner_soft
  * \c MLEADERSTYLE entity.
  *
  * \return soft pointer to the object owner.
- *
- * \warning No checks are performed on the returned pointer (string).
  */
-char *
+uint64_t
 dxf_mleaderstyle_get_object_owner_soft
 (
         DxfMLeaderstyle *mleaderstyle
@@ -1636,19 +1562,12 @@ dxf_mleaderstyle_get_object_owner_soft
                 fprintf (stderr,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
-                return (NULL);
-        }
-        if (mleaderstyle->object_owner_soft ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
+                return (0);
         }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (mleaderstyle->object_owner_soft));
+        return (mleaderstyle->object_owner_soft);
 }
 
 
@@ -1664,8 +1583,8 @@ dxf_mleaderstyle_set_object_owner_soft
 (
         DxfMLeaderstyle *mleaderstyle,
                 /*!< a pointer to a DXF \c MLEADERSTYLE entity. */
-        char *object_owner_soft
-                /*!< a string containing the pointer to the
+        uint64_t object_owner_soft
+                /*!< the handle of the
                  * \c object_owner_soft for the entity. */
 )
 {
@@ -1680,14 +1599,7 @@ dxf_mleaderstyle_set_object_owner_soft
                   __FUNCTION__);
                 return (NULL);
         }
-        if (object_owner_soft == NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was passed.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
-        mleaderstyle->object_owner_soft = strdup (object_owner_soft);
+        mleaderstyle->object_owner_soft = object_owner_soft;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1699,12 +1611,10 @@ dxf_mleaderstyle_set_object_owner_soft
  * \brief Get the pointer to the \c material from a DXF \c MLEADERSTYLE
  * entity.
  *
- * \return a pointer to \c material when successful, or \c NULL when an
+ * \return the handle \c material when successful, or 0 when an
  * error occurred.
- *
- * \warning No checks are performed on the returned pointer.
  */
-char *
+uint64_t
 dxf_mleaderstyle_get_material
 (
         DxfMLeaderstyle *mleaderstyle
@@ -1720,19 +1630,12 @@ dxf_mleaderstyle_get_material
                 fprintf (stderr,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
-                return (NULL);
-        }
-        if (mleaderstyle->material ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
+                return (0);
         }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (mleaderstyle->material));
+        return (mleaderstyle->material);
 }
 
 
@@ -1748,8 +1651,8 @@ dxf_mleaderstyle_set_material
 (
         DxfMLeaderstyle *mleaderstyle,
                 /*!< a pointer to a DXF \c MLEADERSTYLE entity. */
-        char *material
-                /*!< a string containing the pointer to the \c
+        uint64_t material
+                /*!< the handle of the \c
                  * material for the entity. */
 )
 {
@@ -1764,14 +1667,7 @@ dxf_mleaderstyle_set_material
                   __FUNCTION__);
                 return (NULL);
         }
-        if (material == NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was passed.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
-        mleaderstyle->material = strdup (material);
+        mleaderstyle->material = material;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1783,11 +1679,9 @@ dxf_mleaderstyle_set_material
  * \brief Get the pointer to the \c dictionary_owner_hard from a DXF 
  * \c MLEADERSTYLE entity.
  *
- * \return pointer to the \c dictionary_owner_hard.
- *
- * \warning No checks are performed on the returned pointer (string).
+ * \return the handle of the \c dictionary_owner_hard.
  */
-char *
+uint64_t
 dxf_mleaderstyle_get_dictionary_owner_hard
 (
         DxfMLeaderstyle *mleaderstyle
@@ -1803,19 +1697,12 @@ dxf_mleaderstyle_get_dictionary_owner_hard
                 fprintf (stderr,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
-                return (NULL);
-        }
-        if (mleaderstyle->dictionary_owner_hard ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
+                return (0);
         }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (mleaderstyle->dictionary_owner_hard));
+        return (mleaderstyle->dictionary_owner_hard);
 }
 
 
@@ -1831,8 +1718,8 @@ dxf_mleaderstyle_set_dictionary_owner_hard
 (
         DxfMLeaderstyle *mleaderstyle,
                 /*!< a pointer to a DXF \c MLEADERSTYLE entity. */
-        char *dictionary_owner_hard
-                /*!< a string containing the pointer to the \c
+        uint64_t dictionary_owner_hard
+                /*!< the handle of the \c
                  * dictionary_owner_hard for the entity. */
 )
 {
@@ -1847,14 +1734,7 @@ dxf_mleaderstyle_set_dictionary_owner_hard
                   __FUNCTION__);
                 return (NULL);
         }
-        if (dictionary_owner_hard == NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was passed.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
-        mleaderstyle->dictionary_owner_hard = strdup (dictionary_owner_hard);
+        mleaderstyle->dictionary_owner_hard = dictionary_owner_hard;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1930,10 +1810,10 @@ dxf_mleaderstyle_set_lineweight
 /*!
  * \brief Get the \c plot_style_name from a DXF \c MLEADERSTYLE entity.
  *
- * \return a pointer to \c plot_style_name when successful, or \c NULL
+ * \return the handle \c plot_style_name when successful, or 0
  * when an error occurred.
  */
-char *
+uint64_t
 dxf_mleaderstyle_get_plot_style_name
 (
         DxfMLeaderstyle *mleaderstyle
@@ -1949,19 +1829,12 @@ dxf_mleaderstyle_get_plot_style_name
                 fprintf (stderr,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
-                return (NULL);
-        }
-        if (mleaderstyle->plot_style_name ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
+                return (0);
         }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (mleaderstyle->plot_style_name));
+        return (mleaderstyle->plot_style_name);
 }
 
 
@@ -1976,7 +1849,7 @@ dxf_mleaderstyle_set_plot_style_name
 (
         DxfMLeaderstyle *mleaderstyle,
                 /*!< a pointer to a DXF \c MLEADERSTYLE entity. */
-        char *plot_style_name
+        uint64_t plot_style_name
                 /*!< a string containing the \c plot_style_name for the
                  * entity. */
 )
@@ -1992,14 +1865,7 @@ dxf_mleaderstyle_set_plot_style_name
                   __FUNCTION__);
                 return (NULL);
         }
-        if (plot_style_name == NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was passed.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
-        mleaderstyle->plot_style_name = strdup (plot_style_name);
+        mleaderstyle->plot_style_name = plot_style_name;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2106,7 +1972,7 @@ dxf_mleaderstyle_get_color_name
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (mleaderstyle->color_name));
+        return (dxf_strdup (mleaderstyle->color_name));
 }
 
 
@@ -2144,7 +2010,7 @@ dxf_mleaderstyle_set_color_name
                   __FUNCTION__);
                 return (NULL);
         }
-        mleaderstyle->color_name = strdup (color_name);
+        mleaderstyle->color_name = dxf_strdup (color_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2252,7 +2118,7 @@ dxf_mleaderstyle_get_mleaderstyle_description
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (mleaderstyle->mleaderstyle_description));
+        return (dxf_strdup (mleaderstyle->mleaderstyle_description));
 }
 
 
@@ -2291,7 +2157,7 @@ dxf_mleaderstyle_set_mleaderstyle_description
                   __FUNCTION__);
                 return (NULL);
         }
-        mleaderstyle->mleaderstyle_description = strdup (mleaderstyle_description);
+        mleaderstyle->mleaderstyle_description = dxf_strdup (mleaderstyle_description);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -4764,7 +4630,7 @@ dxf_mleaderstyle_get_default_mtext_contents
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (mleaderstyle->default_mtext_contents));
+        return (dxf_strdup (mleaderstyle->default_mtext_contents));
 }
 
 
@@ -4803,7 +4669,7 @@ dxf_mleaderstyle_set_default_mtext_contents
                   __FUNCTION__);
                 return (NULL);
         }
-        mleaderstyle->default_mtext_contents = strdup (default_mtext_contents);
+        mleaderstyle->default_mtext_contents = dxf_strdup (default_mtext_contents);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -4846,7 +4712,7 @@ dxf_mleaderstyle_get_leader_linetype_id
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (mleaderstyle->leader_linetype_id));
+        return (dxf_strdup (mleaderstyle->leader_linetype_id));
 }
 
 
@@ -4885,7 +4751,7 @@ dxf_mleaderstyle_set_leader_linetype_id
                   __FUNCTION__);
                 return (NULL);
         }
-        mleaderstyle->leader_linetype_id = strdup (leader_linetype_id);
+        mleaderstyle->leader_linetype_id = dxf_strdup (leader_linetype_id);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -4928,7 +4794,7 @@ dxf_mleaderstyle_get_arrow_head_id
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (mleaderstyle->arrow_head_id));
+        return (dxf_strdup (mleaderstyle->arrow_head_id));
 }
 
 
@@ -4967,7 +4833,7 @@ dxf_mleaderstyle_set_arrow_head_id
                   __FUNCTION__);
                 return (NULL);
         }
-        mleaderstyle->arrow_head_id = strdup (arrow_head_id);
+        mleaderstyle->arrow_head_id = dxf_strdup (arrow_head_id);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -5010,7 +4876,7 @@ dxf_mleaderstyle_get_mtext_style_id
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (mleaderstyle->mtext_style_id));
+        return (dxf_strdup (mleaderstyle->mtext_style_id));
 }
 
 
@@ -5049,7 +4915,7 @@ dxf_mleaderstyle_set_mtext_style_id
                   __FUNCTION__);
                 return (NULL);
         }
-        mleaderstyle->mtext_style_id = strdup (mtext_style_id);
+        mleaderstyle->mtext_style_id = dxf_strdup (mtext_style_id);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -5092,7 +4958,7 @@ dxf_mleaderstyle_get_block_content_id
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (mleaderstyle->block_content_id));
+        return (dxf_strdup (mleaderstyle->block_content_id));
 }
 
 
@@ -5131,7 +4997,7 @@ dxf_mleaderstyle_set_block_content_id
                   __FUNCTION__);
                 return (NULL);
         }
-        mleaderstyle->block_content_id = strdup (block_content_id);
+        mleaderstyle->block_content_id = dxf_strdup (block_content_id);
 #if DEBUG
         DXF_DEBUG_END
 #endif
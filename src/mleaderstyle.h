@@ -53,7 +53,7 @@ typedef struct
 dxf_mleaderstyle_struct
 {
         /* Members common for all DXF drawable entities. */
-        int id_code;
+        uint64_t id_code;
                 /*!< Identification number for the entity.\n
                  * This is to be an unique (sequential) number in the DXF
                  * file.\n
@@ -126,20 +126,20 @@ dxf_mleaderstyle_struct
                  * (optional).\n
                  * Group code = 310.\n
                  * \since Introduced in version R2000. */
-        char *dictionary_owner_soft;
+        uint64_t dictionary_owner_soft;
                 /*!< Soft-pointer ID/handle to owner dictionary (optional).\n
                  * Group code = 330.\n
                  * \since Introduced in version R14. */
-        char *object_owner_soft;
+        uint64_t object_owner_soft;
                 /*!< Soft-pointer ID/handle  to owner BLOCK_RECORD object.\n
                  * Group code = 330.\n
                  * \since Introduced in version R2000. */
-        char *material;
+        uint64_t material;
                 /*!< Hard-pointer ID/handle to material object (present if
                  * not BYLAYER).\n
                  * Group code = 347.\n
                  * \since Introduced in version R2008. */
-        char *dictionary_owner_hard;
+        uint64_t dictionary_owner_hard;
                 /*!< Hard owner ID/handle to owner dictionary (optional).\n
                  * Group code = 360.\n
                  * \since Introduced in version R14. */
@@ -148,7 +148,7 @@ dxf_mleaderstyle_struct
                  * Stored and moved around as a 16-bit integer.\n
                  * Group code = 370.\n
                  * \since Introduced in version R2002. */
-        char *plot_style_name;
+        uint64_t plot_style_name;
                 /*!< Hard pointer ID / handle of PlotStyleName object.\n
                  * Group code = 390.\n
                  * \since Introduced in version R2009. */
@@ -338,8 +338,8 @@ DxfMLeaderstyle *dxf_mleaderstyle_read (DxfFile *fp, DxfMLeaderstyle *mleadersty
 int dxf_mleaderstyle_write (DxfFile *fp, DxfMLeaderstyle *mleaderstyle);
 int dxf_mleaderstyle_free (DxfMLeaderstyle *mleaderstyle);
 void dxf_mleaderstyle_free_list (DxfMLeaderstyle *mleaderstyles);
-int dxf_mleaderstyle_get_id_code (DxfMLeaderstyle *mleaderstyle);
-DxfMLeaderstyle *dxf_mleaderstyle_set_id_code (DxfMLeaderstyle *mleaderstyle, int id_code);
+uint64_t dxf_mleaderstyle_get_id_code (DxfMLeaderstyle *mleaderstyle);
+DxfMLeaderstyle *dxf_mleaderstyle_set_id_code (DxfMLeaderstyle *mleaderstyle, uint64_t id_code);
 char *dxf_mleaderstyle_get_linetype (DxfMLeaderstyle *mleaderstyle);
 DxfMLeaderstyle *dxf_mleaderstyle_set_linetype (DxfMLeaderstyle *mleaderstyle, char *linetype);
 char *dxf_mleaderstyle_get_layer (DxfMLeaderstyle *mleaderstyle);
@@ -362,18 +362,18 @@ int16_t dxf_mleaderstyle_get_shadow_mode (DxfMLeaderstyle *mleaderstyle);
 DxfMLeaderstyle *dxf_mleaderstyle_set_shadow_mode (DxfMLeaderstyle *mleaderstyle, int16_t shadow_mode);
 DxfBinaryGraphicsData *dxf_mleaderstyle_get_binary_graphics_data (DxfMLeaderstyle *mleaderstyle);
 DxfMLeaderstyle *dxf_mleaderstyle_set_binary_graphics_data (DxfMLeaderstyle *mleaderstyle, DxfBinaryGraphicsData *data);
-char *dxf_mleaderstyle_get_dictionary_owner_soft (DxfMLeaderstyle *mleaderstyle);
-DxfMLeaderstyle *dxf_mleaderstyle_set_dictionary_owner_soft (DxfMLeaderstyle *mleaderstyle, char *dictionary_owner_soft);
-char *dxf_mleaderstyle_get_object_owner_soft (DxfMLeaderstyle *mleaderstyle);
-DxfMLeaderstyle *dxf_mleaderstyle_set_object_owner_soft (DxfMLeaderstyle *mleaderstyle, char *object_owner_soft);
-char *dxf_mleaderstyle_get_material (DxfMLeaderstyle *mleaderstyle);
-DxfMLeaderstyle *dxf_mleaderstyle_set_material (DxfMLeaderstyle *mleaderstyle, char *material);
-char *dxf_mleaderstyle_get_dictionary_owner_hard (DxfMLeaderstyle *mleaderstyle);
-DxfMLeaderstyle *dxf_mleaderstyle_set_dictionary_owner_hard (DxfMLeaderstyle *mleaderstyle, char *dictionary_owner_hard);
+uint64_t dxf_mleaderstyle_get_dictionary_owner_soft (DxfMLeaderstyle *mleaderstyle);
+DxfMLeaderstyle *dxf_mleaderstyle_set_dictionary_owner_soft (DxfMLeaderstyle *mleaderstyle, uint64_t dictionary_owner_soft);
+uint64_t dxf_mleaderstyle_get_object_owner_soft (DxfMLeaderstyle *mleaderstyle);
+DxfMLeaderstyle *dxf_mleaderstyle_set_object_owner_soft (DxfMLeaderstyle *mleaderstyle, uint64_t object_owner_soft);
+uint64_t dxf_mleaderstyle_get_material (DxfMLeaderstyle *mleaderstyle);
+DxfMLeaderstyle *dxf_mleaderstyle_set_material (DxfMLeaderstyle *mleaderstyle, uint64_t material);
+uint64_t dxf_mleaderstyle_get_dictionary_owner_hard (DxfMLeaderstyle *mleaderstyle);
+DxfMLeaderstyle *dxf_mleaderstyle_set_dictionary_owner_hard (DxfMLeaderstyle *mleaderstyle, uint64_t dictionary_owner_hard);
 int16_t dxf_mleaderstyle_get_lineweight (DxfMLeaderstyle *mleaderstyle);
 DxfMLeaderstyle *dxf_mleaderstyle_set_lineweight (DxfMLeaderstyle *mleaderstyle, int16_t lineweight);
-char *dxf_mleaderstyle_get_plot_style_name (DxfMLeaderstyle *mleaderstyle);
-DxfMLeaderstyle *dxf_mleaderstyle_set_plot_style_name (DxfMLeaderstyle *mleaderstyle, char *plot_style_name);
+uint64_t dxf_mleaderstyle_get_plot_style_name (DxfMLeaderstyle *mleaderstyle);
+DxfMLeaderstyle *dxf_mleaderstyle_set_plot_style_name (DxfMLeaderstyle *mleaderstyle, uint64_t plot_style_name);
 long dxf_mleaderstyle_get_color_value (DxfMLeaderstyle *mleaderstyle);
 DxfMLeaderstyle *dxf_mleaderstyle_set_color_value (DxfMLeaderstyle *mleaderstyle, long color_value);
 char *dxf_mleaderstyle_get_color_name (DxfMLeaderstyle *mleaderstyle);
@@ -42,6 +42,7 @@
 
 
 #include "mline.h"
+#include "util.h"
 
 
 /*!
@@ -64,7 +65,7 @@ dxf_mline_new ()
         size = sizeof (DxfMline);
         /* avoid malloc of 0 bytes */
         if (size == 0) size = 1;
-        if ((mline = malloc (size)) == NULL)
+        if ((mline = dxf_malloc (size)) == NULL)
         {
                 fprintf (stderr,
                   (_("Error in %s () could not allocate memory for a DxfMline struct.\n")),
@@ -116,8 +117,8 @@ dxf_mline_init
               return (NULL);
         }
         dxf_mline_set_id_code (mline, 0);
-        dxf_mline_set_linetype (mline, strdup (DXF_DEFAULT_LINETYPE));
-        dxf_mline_set_layer (mline, strdup (DXF_DEFAULT_LAYER));
+        dxf_mline_set_linetype (mline, dxf_strdup (DXF_DEFAULT_LINETYPE));
+        dxf_mline_set_layer (mline, dxf_strdup (DXF_DEFAULT_LAYER));
         dxf_mline_set_elevation (mline, 0.0);
         dxf_mline_set_thickness (mline, 0.0);
         dxf_mline_set_linetype_scale (mline, DXF_DEFAULT_LINETYPE_SCALE);
@@ -128,15 +129,15 @@ dxf_mline_init
         dxf_mline_set_shadow_mode (mline, 0);
         dxf_mline_set_binary_graphics_data (mline, dxf_binary_graphics_data_new ());
         dxf_binary_graphics_data_init ((DxfBinaryGraphicsData *) dxf_mline_get_binary_graphics_data (mline));
-        dxf_mline_set_dictionary_owner_soft (mline, strdup (""));
-        dxf_mline_set_material (mline, strdup (""));
-        dxf_mline_set_dictionary_owner_hard (mline, strdup (""));
+        dxf_mline_set_dictionary_owner_soft (mline, 0);
+        dxf_mline_set_material (mline, 0);
+        dxf_mline_set_dictionary_owner_hard (mline, 0);
         dxf_mline_set_lineweight (mline, 0);
-        dxf_mline_set_plot_style_name (mline, strdup (""));
+        dxf_mline_set_plot_style_name (mline, 0);
         dxf_mline_set_color_value (mline, 0);
-        dxf_mline_set_color_name (mline, strdup (""));
+        dxf_mline_set_color_name (mline, dxf_strdup (""));
         dxf_mline_set_transparency (mline, 0);
-        dxf_mline_set_style_name (mline, strdup (""));
+        dxf_mline_set_style_name (mline, dxf_strdup (""));
         dxf_mline_set_p0 (mline, dxf_point_new ());
         dxf_point_init ((DxfPoint *) dxf_mline_get_p0 (mline));
         dxf_mline_set_p1 (mline, dxf_point_new ());
@@ -159,7 +160,7 @@ dxf_mline_init
         dxf_mline_set_extr_x0 (mline, 0.0);
         dxf_mline_set_extr_y0 (mline, 0.0);
         dxf_mline_set_extr_z0 (mline, 1.0);
-        dxf_mline_set_mlinestyle_dictionary (mline, strdup (""));
+        dxf_mline_set_mlinestyle_dictionary (mline, dxf_strdup (""));
         dxf_mline_set_next (mline, NULL);
 #if DEBUG
         DXF_DEBUG_END
@@ -191,7 +192,8 @@ dxf_mline_read
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        char *temp_string = NULL;
+        char temp_string[DXF_MAX_STRING_LENGTH];
+        int group_code;
         int i;
         int j;
         int k;
@@ -207,8 +209,6 @@ dxf_mline_read
                 fprintf (stderr,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
-                /* Clean up. */
-                free (temp_string);
                 return (NULL);
         }
         if (mline == NULL)
@@ -226,366 +226,312 @@ dxf_mline_read
         iter_p2 = (DxfPoint *) mline->p2; /* Pointer to first direction vector p2. */
         k = 0;
         iter_p3 = (DxfPoint *) mline->p3; /* Pointer to first direction vector p3. */
-        (fp->line_number)++;
-        fscanf (fp->fp, "%[^\n]", temp_string);
-        while (strcmp (temp_string, "0") != 0)
+        while ((dxf_read_group_code (fp, &group_code) == EXIT_SUCCESS)
+          && (group_code != 0))
         {
-                if (ferror (fp->fp))
+                if (dxf_read_error (fp))
                 {
                         fprintf (stderr,
                           (_("Error in %s () while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
-                        fclose (fp->fp);
-                        /* Clean up. */
-                        free (temp_string);
                         return (NULL);
                 }
-                if (strcmp (temp_string, "2") == 0)
-                {
-                        /* Now follows a string containing a string of
-                         * up to 32 characters with the name of the
-                         * style used for this mline. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, mline->style_name);
-                }
-                if (strcmp (temp_string, "5") == 0)
-                {
-                        /* Now follows a string containing a sequential
-                         * id number. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%x\n", (uint *) &mline->id_code);
-                }
-                else if (strcmp (temp_string, "6") == 0)
-                {
-                        /* Now follows a string containing a linetype
-                         * name. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, mline->linetype);
-                }
-                else if (strcmp (temp_string, "8") == 0)
-                {
-                        /* Now follows a string containing a layer name. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, mline->layer);
-                }
-                else if (strcmp (temp_string, "10") == 0)
-                {
-                        /* Now follows a string containing the
-                         * X value of the start point. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &mline->p0->x0);
-                }
-                else if (strcmp (temp_string, "20") == 0)
+                switch (group_code)
                 {
-                        /* Now follows a string containing the
-                         * Y value of the start point. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &mline->p0->y0);
-                }
-                else if (strcmp (temp_string, "30") == 0)
-                {
-                        /* Now follows a string containing the
-                         * Z value of the start point. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &mline->p0->z0);
-                }
-                else if ((strcmp (temp_string, "11") == 0)
-                  || (strcmp (temp_string, "21") == 0)
-                  || (strcmp (temp_string, "31") == 0))
-                {
-                        if (strcmp (temp_string, "11") == 0)
-                        {
-                                /* Now follows a string containing the X-value
-                                 * of the Vertex coordinates (one entry for each
-                                 * vertex). */
-                                if (i > 0) /* Create a pointer for the next vertex. */
+                        case 2:
+                                /* Now follows a string containing a string of
+                                 * up to 32 characters with the name of the
+                                 * style used for this mline. */
+                                dxf_read_string_interned (fp, &mline->style_name);
+                                break;
+                        case 5:
+                                /* Now follows a string containing a sequential
+                                 * id number. */
+                                dxf_read_handle (fp, &mline->id_code);
+                                break;
+                        case 6:
+                                /* Now follows a string containing a linetype
+                                 * name. */
+                                dxf_read_string_interned (fp, &mline->linetype);
+                                break;
+                        case 8:
+                                /* Now follows a string containing a layer name. */
+                                dxf_read_string_interned (fp, &mline->layer);
+                                break;
+                        case 10:
+                                /* Now follows a string containing the
+                                 * X value of the start point. */
+                                dxf_read_double (fp, &mline->p0->x0);
+                                break;
+                        case 20:
+                                /* Now follows a string containing the
+                                 * Y value of the start point. */
+                                dxf_read_double (fp, &mline->p0->y0);
+                                break;
+                        case 30:
+                                /* Now follows a string containing the
+                                 * Z value of the start point. */
+                                dxf_read_double (fp, &mline->p0->z0);
+                                break;
+                        case 11:
+                        case 21:
+                        case 31:
+                                if (group_code == 11)
                                 {
-                                        dxf_point_init ((DxfPoint *) iter_p1->next);
-                                        iter_p1 = (DxfPoint *) iter_p1->next;
+                                        /* Now follows a string containing the X-value
+                                         * of the Vertex coordinates (one entry for each
+                                         * vertex). */
+                                        if (i > 0) /* Create a pointer for the next vertex. */
+                                        {
+                                                dxf_point_init ((DxfPoint *) iter_p1->next);
+                                                iter_p1 = (DxfPoint *) iter_p1->next;
+                                        }
+                                        dxf_read_double (fp, &iter_p1->x0);
                                 }
-                                (fp->line_number)++;
-                                fscanf (fp->fp, "%lf\n", &iter_p1->x0);
-                        }
-                        else if (strcmp (temp_string, "21") == 0)
-                        {
-                                /* Now follows a string containing the Y-value
-                                 * of the Vertex coordinates (one entry for each
-                                 * vertex). */
-                                (fp->line_number)++;
-                                fscanf (fp->fp, "%lf\n", &iter_p1->y0);
-                        }
-                        else if (strcmp (temp_string, "31") == 0)
-                        {
-                                /* Now follows a string containing the Z-value
-                                 * of the Vertex coordinates (one entry for each
-                                 * vertex). */
-                                (fp->line_number)++;
-                                fscanf (fp->fp, "%lf\n", &iter_p1->z0);
-                                i++; /* Increase the number of found vertices. */
-                        }
-                }
-                else if ((strcmp (temp_string, "12") == 0)
-                  || (strcmp (temp_string, "22") == 0)
-                  || (strcmp (temp_string, "32") == 0))
-                {
-                        if (strcmp (temp_string, "12") == 0)
-                        {
-                                /* Now follows a string containing the X-value
-                                 * of the Direction vector (one entry for each
-                                 * vector). */
-                                if (j > 0) /* Create a pointer for the next vector. */
+                                else if (group_code == 21)
                                 {
-                                        dxf_point_init ((DxfPoint *) iter_p2->next);
-                                        iter_p2 = (DxfPoint *) iter_p2->next;
+                                        /* Now follows a string containing the Y-value
+                                         * of the Vertex coordinates (one entry for each
+                                         * vertex). */
+                                        dxf_read_double (fp, &iter_p1->y0);
                                 }
-                                (fp->line_number)++;
-                                fscanf (fp->fp, "%lf\n", &iter_p2->x0);
-                        }
-                        else if (strcmp (temp_string, "22") == 0)
-                        {
-                                /* Now follows a string containing the Y-value
-                                 * of the Direction vector (one entry for each
-                                 * vector). */
-                                (fp->line_number)++;
-                                fscanf (fp->fp, "%lf\n", &iter_p2->y0);
-                        }
-                        else if (strcmp (temp_string, "32") == 0)
-                        {
-                                /* Now follows a string containing the Z-value
-                                 * of the Direction vector (one entry for each
-                                 * vector). */
-                                (fp->line_number)++;
-                                fscanf (fp->fp, "%lf\n", &iter_p2->z0);
-                                j++; /* Increase the number of found vectors. */
-                        }
-                }
-                else if ((strcmp (temp_string, "13") == 0)
-                  || (strcmp (temp_string, "23") == 0)
-                  || (strcmp (temp_string, "33") == 0))
-                {
-                        if (strcmp (temp_string, "13") == 0)
-                        {
-                                /* Now follows a string containing the X-value
-                                 * of the Direction vector (one entry for each
-                                 * vector). */
-                                if (k > 0) /* Create a pointer for the next vector. */
+                                else if (group_code == 31)
                                 {
-                                        dxf_point_init ((DxfPoint *) iter_p3->next);
-                                        iter_p3 = (DxfPoint *) iter_p3->next;
+                                        /* Now follows a string containing the Z-value
+                                         * of the Vertex coordinates (one entry for each
+                                         * vertex). */
+                                        dxf_read_double (fp, &iter_p1->z0);
+                                        i++; /* Increase the number of found vertices. */
                                 }
-                                (fp->line_number)++;
-                                fscanf (fp->fp, "%lf\n", &iter_p3->x0);
-                        }
-                        else if (strcmp (temp_string, "23") == 0)
-                        {
-                                /* Now follows a string containing the Y-value
-                                 * of the Direction vector (one entry for each
-                                 * vector). */
-                                (fp->line_number)++;
-                                fscanf (fp->fp, "%lf\n", &iter_p3->y0);
-                        }
-                        else if (strcmp (temp_string, "33") == 0)
-                        {
-                                /* Now follows a string containing the Z-value
-                                 * of the Direction vector (one entry for each
-                                 * vector). */
-                                (fp->line_number)++;
-                                fscanf (fp->fp, "%lf\n", &iter_p3->z0);
-                                k++; /* Increase the number of found vectors. */
-                        }
-                }
-                else if ((fp->acad_version_number <= AutoCAD_11)
-                        && (strcmp (temp_string, "38") == 0))
-                {
-                        /* Now follows a string containing the
-                         * elevation. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &mline->elevation);
-                }
-                else if (strcmp (temp_string, "39") == 0)
-                {
-                        /* Now follows a string containing the
-                         * thickness. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &mline->thickness);
-                }
-                else if (strcmp (temp_string, "40") == 0)
-                {
-                        /* Now follows a string containing the scale
-                         * factor. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &mline->scale_factor);
-                }
-                else if (strcmp (temp_string, "41") == 0)
-                {
-                        /* Now follows a string containing the element
-                         * parameters (repeats based on previous code 74). */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &mline->element_parameters[l]);
-                        l++;
-                }
-                else if (strcmp (temp_string, "42") == 0)
-                {
-                        /* Now follows a string containing the area fill
-                         * parameters (repeats based on previous code 75). */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &mline->area_fill_parameters[m]);
-                        m++;
-                }
-                else if (strcmp (temp_string, "48") == 0)
-                {
-                        /* Now follows a string containing the linetype
-                         * scale. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &mline->linetype_scale);
-                }
-                else if (strcmp (temp_string, "60") == 0)
-                {
-                        /* Now follows a string containing the
-                         * visibility value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%hd\n", &mline->visibility);
-                }
-                else if (strcmp (temp_string, "62") == 0)
-                {
-                        /* Now follows a string containing the
-                         * color value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%d\n", &mline->color);
-                }
-                else if (strcmp (temp_string, "67") == 0)
-                {
-                        /* Now follows a string containing the
-                         * paperspace value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%d\n", &mline->paperspace);
-                }
-                else if (strcmp (temp_string, "70") == 0)
-                {
-                        /* Now follows a string containing the
-                         * justification value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%d\n", &mline->justification);
-                }
-                else if (strcmp (temp_string, "71") == 0)
-                {
-                        /* Now follows a string containing the flags
-                         * value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%d\n", &mline->flags);
-                }
-                else if (strcmp (temp_string, "72") == 0)
-                {
-                        /* Now follows a string containing the number of
-                         * vertices value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%d\n", &mline->number_of_vertices);
-                }
-                else if (strcmp (temp_string, "73") == 0)
-                {
-                        /* Now follows a string containing the number of
-                         * elements in MLINESTYLE definition. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%d\n", &mline->number_of_elements);
-                }
-                else if (strcmp (temp_string, "74") == 0)
-                {
-                        /* Now follows a string containing the number of
-                         * parameters for this element (repeats for each
-                         * element in segment). */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%d\n", &mline->number_of_parameters);
-                }
-                else if (strcmp (temp_string, "75") == 0)
-                {
-                        /* Now follows a string containing the number of
-                         * area fill parameters for this element
-                         * (repeats for each element in segment). */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%d\n", &mline->number_of_area_fill_parameters);
-                }
-                else if ((fp->acad_version_number >= AutoCAD_13)
-                        && (strcmp (temp_string, "100") == 0))
-                {
-                        /* Now follows a string containing the
-                         * subclass marker value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
-                        if ((strcmp (temp_string, "AcDbEntity") != 0)
-                        && ((strcmp (temp_string, "AcDbMline") != 0)))
-                        {
+                                break;
+                        case 12:
+                        case 22:
+                        case 32:
+                                if (group_code == 12)
+                                {
+                                        /* Now follows a string containing the X-value
+                                         * of the Direction vector (one entry for each
+                                         * vector). */
+                                        if (j > 0) /* Create a pointer for the next vector. */
+                                        {
+                                                dxf_point_init ((DxfPoint *) iter_p2->next);
+                                                iter_p2 = (DxfPoint *) iter_p2->next;
+                                        }
+                                        dxf_read_double (fp, &iter_p2->x0);
+                                }
+                                else if (group_code == 22)
+                                {
+                                        /* Now follows a string containing the Y-value
+                                         * of the Direction vector (one entry for each
+                                         * vector). */
+                                        dxf_read_double (fp, &iter_p2->y0);
+                                }
+                                else if (group_code == 32)
+                                {
+                                        /* Now follows a string containing the Z-value
+                                         * of the Direction vector (one entry for each
+                                         * vector). */
+                                        dxf_read_double (fp, &iter_p2->z0);
+                                        j++; /* Increase the number of found vectors. */
+                                }
+                                break;
+                        case 13:
+                        case 23:
+                        case 33:
+                                if (group_code == 13)
+                                {
+                                        /* Now follows a string containing the X-value
+                                         * of the Direction vector (one entry for each
+                                         * vector). */
+                                        if (k > 0) /* Create a pointer for the next vector. */
+                                        {
+                                                dxf_point_init ((DxfPoint *) iter_p3->next);
+                                                iter_p3 = (DxfPoint *) iter_p3->next;
+                                        }
+                                        dxf_read_double (fp, &iter_p3->x0);
+                                }
+                                else if (group_code == 23)
+                                {
+                                        /* Now follows a string containing the Y-value
+                                         * of the Direction vector (one entry for each
+                                         * vector). */
+                                        dxf_read_double (fp, &iter_p3->y0);
+                                }
+                                else if (group_code == 33)
+                                {
+                                        /* Now follows a string containing the Z-value
+                                         * of the Direction vector (one entry for each
+                                         * vector). */
+                                        dxf_read_double (fp, &iter_p3->z0);
+                                        k++; /* Increase the number of found vectors. */
+                                }
+                                break;
+                        case 38:
+                                if (fp->acad_version_number <= AutoCAD_11)
+                                {
+                                        /* Now follows a string containing the
+                                         * elevation. */
+                                        dxf_read_double (fp, &mline->elevation);
+                                }
+                                else
+                                {
+                                        fprintf (stderr,
+                                          (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
+                                          __FUNCTION__, fp->filename, fp->line_number);
+                                        /* Skip the value of the unknown group code. */
+                                        dxf_read_line (temp_string, fp);
+                                }
+                                break;
+                        case 39:
+                                /* Now follows a string containing the
+                                 * thickness. */
+                                dxf_read_double (fp, &mline->thickness);
+                                break;
+                        case 40:
+                                /* Now follows a string containing the scale
+                                 * factor. */
+                                dxf_read_double (fp, &mline->scale_factor);
+                                break;
+                        case 41:
+                                /* Now follows a string containing the element
+                                 * parameters (repeats based on previous code 74). */
+                                dxf_read_double (fp, &mline->element_parameters[l]);
+                                l++;
+                                break;
+                        case 42:
+                                /* Now follows a string containing the area fill
+                                 * parameters (repeats based on previous code 75). */
+                                dxf_read_double (fp, &mline->area_fill_parameters[m]);
+                                m++;
+                                break;
+                        case 48:
+                                /* Now follows a string containing the linetype
+                                 * scale. */
+                                dxf_read_double (fp, &mline->linetype_scale);
+                                break;
+                        case 60:
+                                /* Now follows a string containing the
+                                 * visibility value. */
+                                dxf_read_int16 (fp, &mline->visibility);
+                                break;
+                        case 62:
+                                /* Now follows a string containing the
+                                 * color value. */
+                                dxf_read_int (fp, &mline->color);
+                                break;
+                        case 67:
+                                /* Now follows a string containing the
+                                 * paperspace value. */
+                                dxf_read_int (fp, &mline->paperspace);
+                                break;
+                        case 70:
+                                /* Now follows a string containing the
+                                 * justification value. */
+                                dxf_read_int (fp, &mline->justification);
+                                break;
+                        case 71:
+                                /* Now follows a string containing the flags
+                                 * value. */
+                                dxf_read_int (fp, &mline->flags);
+                                break;
+                        case 72:
+                                /* Now follows a string containing the number of
+                                 * vertices value. */
+                                dxf_read_int (fp, &mline->number_of_vertices);
+                                break;
+                        case 73:
+                                /* Now follows a string containing the number of
+                                 * elements in MLINESTYLE definition. */
+                                dxf_read_int (fp, &mline->number_of_elements);
+                                break;
+                        case 74:
+                                /* Now follows a string containing the number of
+                                 * parameters for this element (repeats for each
+                                 * element in segment). */
+                                dxf_read_int (fp, &mline->number_of_parameters);
+                                break;
+                        case 75:
+                                /* Now follows a string containing the number of
+                                 * area fill parameters for this element
+                                 * (repeats for each element in segment). */
+                                dxf_read_int (fp, &mline->number_of_area_fill_parameters);
+                                break;
+                        case 100:
+                                if (fp->acad_version_number >= AutoCAD_13)
+                                {
+                                        /* Now follows a string containing the
+                                         * subclass marker value. */
+                                        dxf_read_line (temp_string, fp);
+                                        if ((strcmp (temp_string, "AcDbEntity") != 0)
+                                        && ((strcmp (temp_string, "AcDbMline") != 0)))
+                                        {
+                                                fprintf (stderr,
+                                                  (_("Warning in %s () found a bad subclass marker in: %s in line: %d.\n")),
+                                                  __FUNCTION__, fp->filename, fp->line_number);
+                                        }
+                                }
+                                else
+                                {
+                                        fprintf (stderr,
+                                          (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
+                                          __FUNCTION__, fp->filename, fp->line_number);
+                                        /* Skip the value of the unknown group code. */
+                                        dxf_read_line (temp_string, fp);
+                                }
+                                break;
+                        case 210:
+                                /* Now follows a string containing the
+                                 * X value of the extrusion direction. */
+                                dxf_read_double (fp, &mline->extr_x0);
+                                break;
+                        case 220:
+                                /* Now follows a string containing the
+                                 * Y value of the extrusion direction. */
+                                dxf_read_double (fp, &mline->extr_y0);
+                                break;
+                        case 230:
+                                /* Now follows a string containing the
+                                 * Z value of the extrusion direction. */
+                                dxf_read_double (fp, &mline->extr_z0);
+                                break;
+                        case 330:
+                                /* Now follows a string containing Soft-pointer
+                                 * ID/handle to owner dictionary. */
+                                dxf_read_handle (fp, &mline->dictionary_owner_soft);
+                                break;
+                        case 340:
+                                /* Now follows a string containing a
+                                 * Pointer-handle/ID of MLINESTYLE dictionary. */
+                                dxf_read_string (fp, &mline->mlinestyle_dictionary);
+                                break;
+                        case 360:
+                                /* Now follows a string containing Hard owner
+                                 * ID/handle to owner dictionary. */
+                                dxf_read_handle (fp, &mline->dictionary_owner_hard);
+                                break;
+                        case 999:
+                                /* Now follows a string containing a comment. */
+                                dxf_read_line (temp_string, fp);
+                                fprintf (stdout, "DXF comment: %s\n", temp_string);
+                                break;
+                        default:
                                 fprintf (stderr,
-                                  (_("Warning in %s () found a bad subclass marker in: %s in line: %d.\n")),
+                                  (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
                                   __FUNCTION__, fp->filename, fp->line_number);
-                        }
-                }
-                else if (strcmp (temp_string, "210") == 0)
-                {
-                        /* Now follows a string containing the
-                         * X value of the extrusion direction. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &mline->extr_x0);
-                }
-                else if (strcmp (temp_string, "220") == 0)
-                {
-                        /* Now follows a string containing the
-                         * Y value of the extrusion direction. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &mline->extr_y0);
-                }
-                else if (strcmp (temp_string, "230") == 0)
-                {
-                        /* Now follows a string containing the
-                         * Z value of the extrusion direction. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &mline->extr_z0);
-                }
-                else if (strcmp (temp_string, "330") == 0)
-                {
-                        /* Now follows a string containing Soft-pointer
-                         * ID/handle to owner dictionary. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, mline->dictionary_owner_soft);
-                }
-                else if (strcmp (temp_string, "340") == 0)
-                {
-                        /* Now follows a string containing a
-                         * Pointer-handle/ID of MLINESTYLE dictionary. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, mline->mlinestyle_dictionary);
-                }
-                else if (strcmp (temp_string, "360") == 0)
-                {
-                        /* Now follows a string containing Hard owner
-                         * ID/handle to owner dictionary. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, mline->dictionary_owner_hard);
-                }
-                else if (strcmp (temp_string, "999") == 0)
-                {
-                        /* Now follows a string containing a comment. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
-                        fprintf (stdout, "DXF comment: %s\n", temp_string);
-                }
-                else
-                {
-                        fprintf (stderr,
-                          (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
-                          __FUNCTION__, fp->filename, fp->line_number);
+                                /* Skip the value of the unknown group code. */
+                                dxf_read_line (temp_string, fp);
+                                break;
                 }
         }
         /* Handle omitted members and/or illegal values. */
         if (strcmp (dxf_mline_get_linetype (mline), "") == 0)
         {
-                dxf_mline_set_linetype (mline, strdup (DXF_DEFAULT_LINETYPE));
+                dxf_mline_set_linetype (mline, dxf_strdup (DXF_DEFAULT_LINETYPE));
         }
         if (strcmp (dxf_mline_get_layer (mline), "") == 0)
         {
-                dxf_mline_set_layer (mline, strdup (DXF_DEFAULT_LAYER));
+                dxf_mline_set_layer (mline, dxf_strdup (DXF_DEFAULT_LAYER));
         }
-        /* Clean up. */
-        free (temp_string);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -618,7 +564,7 @@ dxf_mline_write
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        char *dxf_entity_name = strdup ("MLINE");
+        char *dxf_entity_name = dxf_strdup ("MLINE");
         int i;
         DxfPoint *iter;
 
@@ -629,7 +575,7 @@ dxf_mline_write
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (mline == NULL)
@@ -638,42 +584,42 @@ dxf_mline_write
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if ((fp->acad_version_number < AutoCAD_13)
           && (fp->follow_strict_version_rules))
         {
                 fprintf (stderr,
-                  (_("Error in %s () illegal DXF version for this %s entity with id-code: %x.\n")),
+                  (_("Error in %s () illegal DXF version for this %s entity with id-code: %" PRIx64 ".\n")),
                   __FUNCTION__, dxf_entity_name, mline->id_code);
                 return (EXIT_FAILURE);
         }
         else
         {
                 fprintf (stderr,
-                  (_("Warning in %s () illegal DXF version for this %s entity with id-code: %x.\n")),
+                  (_("Warning in %s () illegal DXF version for this %s entity with id-code: %" PRIx64 ".\n")),
                   __FUNCTION__, dxf_entity_name, dxf_mline_get_id_code (mline));
         }
         if (strcmp (dxf_mline_get_linetype (mline), "") == 0)
         {
                 fprintf (stderr,
-                  (_("Warning in %s () empty linetype string for the %s entity with id-code: %x\n")),
+                  (_("Warning in %s () empty linetype string for the %s entity with id-code: %" PRIx64 "\n")),
                   __FUNCTION__, dxf_entity_name, dxf_mline_get_id_code (mline));
                 fprintf (stderr,
                   (_("    %s entity is relocated to layer 0\n")),
                   dxf_entity_name);
-                dxf_mline_set_linetype (mline, strdup (DXF_DEFAULT_LINETYPE));
+                dxf_mline_set_linetype (mline, dxf_strdup (DXF_DEFAULT_LINETYPE));
         }
         if (strcmp (dxf_mline_get_layer (mline), "") == 0)
         {
                 fprintf (stderr,
-                  (_("Warning in %s () empty layer string for the %s entity with id-code: %x\n")),
+                  (_("Warning in %s () empty layer string for the %s entity with id-code: %" PRIx64 "\n")),
                   __FUNCTION__, dxf_entity_name, dxf_mline_get_id_code (mline));
                 fprintf (stderr,
                   (_("    %s entity is relocated to layer 0\n")),
                   dxf_entity_name);
-                dxf_mline_set_layer (mline, strdup (DXF_DEFAULT_LAYER));
+                dxf_mline_set_layer (mline, dxf_strdup (DXF_DEFAULT_LAYER));
         }
         if (dxf_mline_get_number_of_parameters (mline) >= (DXF_MAX_PARAM - 1))
         {
@@ -681,7 +627,7 @@ dxf_mline_write
                   (_("Error in %s () too many parameters.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (dxf_mline_get_number_of_area_fill_parameters (mline) >= (DXF_MAX_PARAM - 1))
@@ -690,14 +636,14 @@ dxf_mline_write
                   (_("Error in %s () too many area fill parameters.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         /* Start writing output. */
-        fprintf (fp->fp, "  0\n%s\n", dxf_entity_name);
-        if (dxf_mline_get_id_code (mline) != -1)
+        dxf_write_string (fp, 0, dxf_entity_name);
+        if (dxf_mline_get_id_code (mline) != DXF_HANDLE_NONE)
         {
-                fprintf (fp->fp, "  5\n%x\n", dxf_mline_get_id_code (mline));
+                dxf_write_hex (fp, 5, dxf_mline_get_id_code (mline));
         }
         /*!
          * \todo for version R14.\n
@@ -709,119 +655,119 @@ dxf_mline_write
          * 102 groups are application defined (optional).\n\n
          * End of group, "}" (optional), with Group code 102.
          */
-        if ((strcmp (mline->dictionary_owner_soft, "") != 0)
+        if ((mline->dictionary_owner_soft != 0)
           && (fp->acad_version_number >= AutoCAD_14))
         {
-                fprintf (fp->fp, "102\n{ACAD_REACTORS\n");
-                fprintf (fp->fp, "330\n%s\n", dxf_mline_get_dictionary_owner_soft (mline));
-                fprintf (fp->fp, "102\n}\n");
+                dxf_write_string (fp, 102, "{ACAD_REACTORS");
+                dxf_write_hex (fp, 330, dxf_mline_get_dictionary_owner_soft (mline));
+                dxf_write_string (fp, 102, "}");
         }
-        if ((strcmp (dxf_mline_get_dictionary_owner_hard (mline), "") != 0)
+        if ((dxf_mline_get_dictionary_owner_hard (mline) != 0)
           && (fp->acad_version_number >= AutoCAD_14))
         {
-                fprintf (fp->fp, "102\n{ACAD_XDICTIONARY\n");
-                fprintf (fp->fp, "360\n%s\n", dxf_mline_get_dictionary_owner_hard (mline));
-                fprintf (fp->fp, "102\n}\n");
+                dxf_write_string (fp, 102, "{ACAD_XDICTIONARY");
+                dxf_write_hex (fp, 360, dxf_mline_get_dictionary_owner_hard (mline));
+                dxf_write_string (fp, 102, "}");
         }
         if (fp->acad_version_number >= AutoCAD_13)
         {
-                fprintf (fp->fp, "100\nAcDbEntity\n");
+                dxf_write_string (fp, 100, "AcDbEntity");
         }
         if (dxf_mline_get_paperspace (mline) == DXF_PAPERSPACE)
         {
-                fprintf (fp->fp, " 67\n%d\n", (int16_t) DXF_PAPERSPACE);
+                dxf_write_int (fp, 67, (int16_t) DXF_PAPERSPACE);
         }
-        fprintf (fp->fp, "  8\n%s\n", dxf_mline_get_layer (mline));
+        dxf_write_string (fp, 8, dxf_mline_get_layer (mline));
         if (strcmp (dxf_mline_get_linetype (mline), DXF_DEFAULT_LINETYPE) != 0)
         {
-                fprintf (fp->fp, "  6\n%s\n", dxf_mline_get_linetype (mline));
+                dxf_write_string (fp, 6, dxf_mline_get_linetype (mline));
         }
         if ((fp->acad_version_number >= AutoCAD_2008)
-          && (strcmp (dxf_mline_get_material (mline), "") != 0))
+          && (dxf_mline_get_material (mline) != 0))
         {
-                fprintf (fp->fp, "347\n%s\n", dxf_mline_get_material (mline));
+                dxf_write_hex (fp, 347, dxf_mline_get_material (mline));
         }
         if ((fp->acad_version_number <= AutoCAD_11)
           && DXF_FLATLAND
           && (dxf_mline_get_elevation (mline) != 0.0))
         {
-                fprintf (fp->fp, " 38\n%f\n", dxf_mline_get_elevation (mline));
+                dxf_write_double (fp, 38, dxf_mline_get_elevation (mline));
         }
         if (dxf_mline_get_color (mline) != DXF_COLOR_BYLAYER)
         {
-                fprintf (fp->fp, " 62\n%d\n", dxf_mline_get_color (mline));
+                dxf_write_int (fp, 62, dxf_mline_get_color (mline));
         }
         if (fp->acad_version_number >= AutoCAD_2002)
         {
-                fprintf (fp->fp, "370\n%d\n", dxf_mline_get_lineweight (mline));
+                dxf_write_int (fp, 370, dxf_mline_get_lineweight (mline));
         }
         if (dxf_mline_get_linetype_scale (mline) != 1.0)
         {
-                fprintf (fp->fp, " 48\n%f\n", dxf_mline_get_linetype_scale (mline));
+                dxf_write_double (fp, 48, dxf_mline_get_linetype_scale (mline));
         }
         if (dxf_mline_get_visibility (mline) != 0)
         {
-                fprintf (fp->fp, " 60\n%d\n", dxf_mline_get_visibility (mline));
+                dxf_write_int (fp, 60, dxf_mline_get_visibility (mline));
         }
         if (fp->acad_version_number >= AutoCAD_2000)
         {
 #ifdef BUILD_64
-                fprintf (fp->fp, "160\n%d\n", dxf_mline_get_graphics_data_size (mline));
+                dxf_write_int (fp, 160, dxf_mline_get_graphics_data_size (mline));
 #else
-                fprintf (fp->fp, " 92\n%d\n", dxf_mline_get_graphics_data_size (mline));
+                dxf_write_int (fp, 92, dxf_mline_get_graphics_data_size (mline));
 #endif
                 DxfBinaryGraphicsData *bgd_iter = (DxfBinaryGraphicsData *) dxf_mline_get_binary_graphics_data (mline);
                 while (dxf_binary_graphics_data_get_data_line (bgd_iter) != NULL)
                 {
-                        fprintf (fp->fp, "310\n%s\n", dxf_binary_graphics_data_get_data_line (bgd_iter));
+                        dxf_write_string (fp, 310, dxf_binary_graphics_data_get_data_line (bgd_iter));
                         bgd_iter = (DxfBinaryGraphicsData *) dxf_binary_graphics_data_get_next (bgd_iter);
                 }
         }
         if (fp->acad_version_number >= AutoCAD_2004)
         {
-                fprintf (fp->fp, "420\n%ld\n", dxf_mline_get_color_value (mline));
-                fprintf (fp->fp, "430\n%s\n", dxf_mline_get_color_name (mline));
-                fprintf (fp->fp, "440\n%ld\n", dxf_mline_get_transparency (mline));
+                dxf_write_int (fp, 420, dxf_mline_get_color_value (mline));
+                dxf_write_string (fp, 430, dxf_mline_get_color_name (mline));
+                dxf_write_int (fp, 440, dxf_mline_get_transparency (mline));
         }
         if (fp->acad_version_number >= AutoCAD_2009)
         {
-                fprintf (fp->fp, "390\n%s\n", dxf_mline_get_plot_style_name (mline));
-                fprintf (fp->fp, "284\n%d\n", dxf_mline_get_shadow_mode (mline));
+                dxf_write_hex (fp, 390, dxf_mline_get_plot_style_name (mline));
+                dxf_write_int (fp, 284, dxf_mline_get_shadow_mode (mline));
         }
         if (fp->acad_version_number >= AutoCAD_13)
         {
-                fprintf (fp->fp, "100\nAcDbMline\n");
+                dxf_write_string (fp, 100, "AcDbMline");
         }
         if (mline->thickness != 0.0)
         {
-                fprintf (fp->fp, " 39\n%f\n", dxf_mline_get_thickness (mline));
-        }
-        fprintf (fp->fp, "  2\n%s\n", dxf_mline_get_style_name (mline));
-        fprintf (fp->fp, "340\n%s\n", dxf_mline_get_mlinestyle_dictionary (mline));
-        fprintf (fp->fp, " 40\n%f\n", dxf_mline_get_scale_factor (mline));
-        fprintf (fp->fp, " 70\n%d\n", dxf_mline_get_justification (mline));
-        fprintf (fp->fp, " 71\n%d\n", dxf_mline_get_flags (mline));
-        fprintf (fp->fp, " 72\n%d\n", dxf_mline_get_number_of_vertices (mline));
-        fprintf (fp->fp, " 73\n%d\n", dxf_mline_get_number_of_elements (mline));
-        fprintf (fp->fp, " 10\n%f\n", dxf_mline_get_x0 (mline));
-        fprintf (fp->fp, " 20\n%f\n", dxf_mline_get_y0 (mline));
-        fprintf (fp->fp, " 30\n%f\n", dxf_mline_get_z0 (mline));
+                dxf_write_double (fp, 39, dxf_mline_get_thickness (mline));
+        }
+        dxf_write_string (fp, 2, dxf_mline_get_style_name (mline));
+        dxf_write_string (fp, 340, dxf_mline_get_mlinestyle_dictionary (mline));
+        dxf_write_double (fp, 40, dxf_mline_get_scale_factor (mline));
+        dxf_write_int (fp, 70, dxf_mline_get_justification (mline));
+        dxf_write_int (fp, 71, dxf_mline_get_flags (mline));
+        dxf_write_int (fp, 72, dxf_mline_get_number_of_vertices (mline));
+        dxf_write_int (fp, 73, dxf_mline_get_number_of_elements (mline));
+        dxf_write_double (fp, 10, dxf_mline_get_x0 (mline));
+        dxf_write_double (fp, 20, dxf_mline_get_y0 (mline));
+        dxf_write_double (fp, 30, dxf_mline_get_z0 (mline));
         if ((fp->acad_version_number >= AutoCAD_12)
                 && (dxf_mline_get_extr_x0 (mline) != 0.0)
                 && (dxf_mline_get_extr_y0 (mline) != 0.0)
                 && (dxf_mline_get_extr_z0 (mline) != 1.0))
         {
-                fprintf (fp->fp, "210\n%f\n", dxf_mline_get_extr_x0 (mline));
-                fprintf (fp->fp, "220\n%f\n", dxf_mline_get_extr_y0 (mline));
-                fprintf (fp->fp, "230\n%f\n", dxf_mline_get_extr_z0 (mline));
+                dxf_write_double (fp, 210, dxf_mline_get_extr_x0 (mline));
+                dxf_write_double (fp, 220, dxf_mline_get_extr_y0 (mline));
+                dxf_write_double (fp, 230, dxf_mline_get_extr_z0 (mline));
         }
         iter = (DxfPoint *) mline->p1;
         i = 1;
         while (iter->next != NULL)
         {
-                fprintf (fp->fp, " 11\n%f\n", iter->x0);
-                fprintf (fp->fp, " 21\n%f\n", iter->y0);
-                fprintf (fp->fp, " 31\n%f\n", iter->z0);
+                dxf_write_double (fp, 11, iter->x0);
+                dxf_write_double (fp, 21, iter->y0);
+                dxf_write_double (fp, 31, iter->z0);
                 iter = (DxfPoint *) iter->next;
                 i++;
         }
@@ -835,9 +781,9 @@ dxf_mline_write
         i = 1;
         while (iter->next != NULL)
         {
-                fprintf (fp->fp, " 12\n%f\n", iter->x0);
-                fprintf (fp->fp, " 22\n%f\n", iter->y0);
-                fprintf (fp->fp, " 32\n%f\n", iter->z0);
+                dxf_write_double (fp, 12, iter->x0);
+                dxf_write_double (fp, 22, iter->y0);
+                dxf_write_double (fp, 32, iter->z0);
                 iter = (DxfPoint *) iter->next;
                 i++;
         }
@@ -851,9 +797,9 @@ dxf_mline_write
         i = 1;
         while (iter->next != NULL)
         {
-                fprintf (fp->fp, " 13\n%f\n", iter->x0);
-                fprintf (fp->fp, " 23\n%f\n", iter->y0);
-                fprintf (fp->fp, " 33\n%f\n", iter->z0);
+                dxf_write_double (fp, 13, iter->x0);
+                dxf_write_double (fp, 23, iter->y0);
+                dxf_write_double (fp, 33, iter->z0);
                 iter = (DxfPoint *) iter->next;
                 i++;
         }
@@ -863,18 +809,18 @@ dxf_mline_write
                   (_("Warning in %s () actual number of vertices differs from number_of_vertices value in struct.\n")),
                   __FUNCTION__);
         }
-        fprintf (fp->fp, " 74\n%d\n", mline->number_of_parameters);
+        dxf_write_int (fp, 74, mline->number_of_parameters);
         for (i = 0; i < mline->number_of_parameters; i++)
         {
-                fprintf (fp->fp, " 41\n%f\n", mline->element_parameters[i]);
+                dxf_write_double (fp, 41, mline->element_parameters[i]);
         }
-        fprintf (fp->fp, " 75\n%d\n", mline->number_of_area_fill_parameters);
+        dxf_write_int (fp, 75, mline->number_of_area_fill_parameters);
         for (i = 0; i < mline->number_of_area_fill_parameters; i++)
         {
-                fprintf (fp->fp, " 42\n%f\n", mline->area_fill_parameters[i]);
+                dxf_write_double (fp, 42, mline->area_fill_parameters[i]);
         }
         /* Clean up. */
-        free (dxf_entity_name);
+        dxf_free (dxf_entity_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -915,21 +861,17 @@ dxf_mline_free
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        free (mline->linetype);
-        free (mline->layer);
+        dxf_string_free (mline->linetype);
+        dxf_string_free (mline->layer);
         dxf_binary_graphics_data_free_list (mline->binary_graphics_data);
-        free (mline->dictionary_owner_soft);
-        free (mline->material);
-        free (mline->dictionary_owner_hard);
-        free (mline->plot_style_name);
-        free (mline->color_name);
-        free (mline->style_name);
+        dxf_string_free (mline->color_name);
+        dxf_string_free (mline->style_name);
         dxf_point_free (mline->p0);
         dxf_point_free_list (mline->p1);
         dxf_point_free_list (mline->p2);
         dxf_point_free_list (mline->p3);
-        free (mline->mlinestyle_dictionary);
-        free (mline);
+        dxf_free (mline->mlinestyle_dictionary);
+        dxf_free (mline);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -975,7 +917,7 @@ dxf_mline_free_list
  *
  * \return ID code.
  */
-int
+uint64_t
 dxf_mline_get_id_code
 (
         DxfMline *mline
@@ -993,13 +935,6 @@ dxf_mline_get_id_code
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (mline->id_code < 0)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a negative value was found.\n")),
-                  __FUNCTION__);
-                return (EXIT_FAILURE);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1015,7 +950,7 @@ dxf_mline_set_id_code
 (
         DxfMline *mline,
                 /*!< a pointer to a DXF \c MLINE entity. */
-        int id_code
+        uint64_t id_code
                 /*!< Identification number for the entity.\n
                  * This is to be an unique (sequential) number in the DXF
                  * file. */
@@ -1032,13 +967,6 @@ dxf_mline_set_id_code
                   __FUNCTION__);
                 return (NULL);
         }
-        if (id_code < 0)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a negative value was passed.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
         mline->id_code = id_code;
 #if DEBUG
         DXF_DEBUG_END
@@ -1080,7 +1008,7 @@ dxf_mline_get_linetype
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (mline->linetype));
+        return (dxf_strdup (mline->linetype));
 }
 
 
@@ -1114,7 +1042,7 @@ dxf_mline_set_linetype
                   __FUNCTION__);
                 return (NULL);
         }
-        mline->linetype = strdup (linetype);
+        mline->linetype = dxf_strdup (linetype);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1155,7 +1083,7 @@ dxf_mline_get_layer
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (mline->layer));
+        return (dxf_strdup (mline->layer));
 }
 
 
@@ -1189,7 +1117,7 @@ dxf_mline_set_layer
                   __FUNCTION__);
                 return (NULL);
         }
-        mline->layer = strdup (layer);
+        mline->layer = dxf_strdup (layer);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1926,10 +1854,8 @@ dxf_mline_set_binary_graphics_data
  * \c MLINE entity.
  *
  * \return soft pointer to the dictionary owner.
- *
- * \warning No checks are performed on the returned pointer (string).
  */
-char *
+uint64_t
 dxf_mline_get_dictionary_owner_soft
 (
         DxfMline *mline
@@ -1945,19 +1871,12 @@ dxf_mline_get_dictionary_owner_soft
                 fprintf (stderr,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
-                return (NULL);
-        }
-        if (mline->dictionary_owner_soft ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
+                return (0);
         }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (mline->dictionary_owner_soft));
+        return (mline->dictionary_owner_soft);
 }
 
 
@@ -1970,8 +1889,8 @@ dxf_mline_set_dictionary_owner_soft
 (
         DxfMline *mline,
                 /*!< a pointer to a DXF \c MLINE entity. */
-        char *dictionary_owner_soft
-                /*!< a string containing the pointer to the
+        uint64_t dictionary_owner_soft
+                /*!< the handle of the
                  * dictionary_owner_soft for the entity. */
 )
 {
@@ -1986,14 +1905,7 @@ dxf_mline_set_dictionary_owner_soft
                   __FUNCTION__);
                 return (NULL);
         }
-        if (dictionary_owner_soft == NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was passed.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
-        mline->dictionary_owner_soft = strdup (dictionary_owner_soft);
+        mline->dictionary_owner_soft = dictionary_owner_soft;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2004,12 +1916,10 @@ dxf_mline_set_dictionary_owner_soft
 /*!
  * \brief Get the pointer to the \c material from a DXF \c MLINE entity.
  *
- * \return a pointer to \c material when successful, or \c NULL when an
+ * \return the handle \c material when successful, or 0 when an
  * error occurred.
- *
- * \warning No checks are performed on the returned pointer.
  */
-char *
+uint64_t
 dxf_mline_get_material
 (
         DxfMline *mline
@@ -2025,19 +1935,12 @@ dxf_mline_get_material
                 fprintf (stderr,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
-                return (NULL);
-        }
-        if (mline->material ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
+                return (0);
         }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (mline->material));
+        return (mline->material);
 }
 
 
@@ -2052,8 +1955,8 @@ dxf_mline_set_material
 (
         DxfMline *mline,
                 /*!< a pointer to a DXF \c MLINE entity. */
-        char *material
-                /*!< a string containing the pointer to the \c
+        uint64_t material
+                /*!< the handle of the \c
                  * material for the entity. */
 )
 {
@@ -2068,14 +1971,7 @@ dxf_mline_set_material
                   __FUNCTION__);
                 return (NULL);
         }
-        if (material == NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was passed.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
-        mline->material = strdup (material);
+        mline->material = material;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2088,10 +1984,8 @@ dxf_mline_set_material
  * \c MLINE entity.
  *
  * \return hard pointer to the dictionary owner.
- *
- * \warning No checks are performed on the returned pointer (string).
  */
-char *
+uint64_t
 dxf_mline_get_dictionary_owner_hard
 (
         DxfMline *mline
@@ -2107,19 +2001,12 @@ dxf_mline_get_dictionary_owner_hard
                 fprintf (stderr,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
-                return (NULL);
-        }
-        if (mline->dictionary_owner_hard ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
+                return (0);
         }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (mline->dictionary_owner_hard));
+        return (mline->dictionary_owner_hard);
 }
 
 
@@ -2132,8 +2019,8 @@ dxf_mline_set_dictionary_owner_hard
 (
         DxfMline *mline,
                 /*!< a pointer to a DXF \c MLINE entity. */
-        char *dictionary_owner_hard
-                /*!< a string containing the pointer to the
+        uint64_t dictionary_owner_hard
+                /*!< the handle of the
                  * dictionary_owner_hard for the entity. */
 )
 {
@@ -2148,14 +2035,7 @@ dxf_mline_set_dictionary_owner_hard
                   __FUNCTION__);
                 return (NULL);
         }
-        if (dictionary_owner_hard == NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was passed.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
-        mline->dictionary_owner_hard = strdup (dictionary_owner_hard);
+        mline->dictionary_owner_hard = dictionary_owner_hard;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2231,10 +2111,10 @@ dxf_mline_set_lineweight
 /*!
  * \brief Get the \c plot_style_name from a DXF \c MLINE entity.
  *
- * \return a pointer to \c plot_style_name when sucessful, or \c NULL
+ * \return the handle \c plot_style_name when sucessful, or 0
  * when an error occurred.
  */
-char *
+uint64_t
 dxf_mline_get_plot_style_name
 (
         DxfMline *mline
@@ -2250,19 +2130,12 @@ dxf_mline_get_plot_style_name
                 fprintf (stderr,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
-                return (NULL);
-        }
-        if (mline->plot_style_name ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
+                return (0);
         }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (mline->plot_style_name));
+        return (mline->plot_style_name);
 }
 
 
@@ -2277,7 +2150,7 @@ dxf_mline_set_plot_style_name
 (
         DxfMline *mline,
                 /*!< a pointer to a DXF \c MLINE entity. */
-        char *plot_style_name
+        uint64_t plot_style_name
                 /*!< a string containing the \c plot_style_name for the
                  * entity. */
 )
@@ -2293,14 +2166,7 @@ dxf_mline_set_plot_style_name
                   __FUNCTION__);
                 return (NULL);
         }
-        if (plot_style_name == NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was passed.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
-        mline->plot_style_name = strdup (plot_style_name);
+        mline->plot_style_name = plot_style_name;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2407,7 +2273,7 @@ dxf_mline_get_color_name
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (mline->color_name));
+        return (dxf_strdup (mline->color_name));
 }
 
 
@@ -2445,7 +2311,7 @@ dxf_mline_set_color_name
                   __FUNCTION__);
                 return (NULL);
         }
-        mline->color_name = strdup (color_name);
+        mline->color_name = dxf_strdup (color_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2552,7 +2418,7 @@ dxf_mline_get_style_name
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (mline->style_name));
+        return (dxf_strdup (mline->style_name));
 }
 
 
@@ -2590,7 +2456,7 @@ dxf_mline_set_style_name
                   __FUNCTION__);
                 return (NULL);
         }
-        mline->style_name = strdup (style_name);
+        mline->style_name = dxf_strdup (style_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -4987,7 +4853,7 @@ dxf_mline_get_mlinestyle_dictionary
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (mline->mlinestyle_dictionary));
+        return (dxf_strdup (mline->mlinestyle_dictionary));
 }
 
 
@@ -5025,7 +4891,7 @@ dxf_mline_set_mlinestyle_dictionary
                   __FUNCTION__);
                 return (NULL);
         }
-        mline->mlinestyle_dictionary = strdup (mlinestyle_dictionary);
+        mline->mlinestyle_dictionary = dxf_strdup (mlinestyle_dictionary);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -73,7 +73,7 @@ typedef struct
 dxf_mline_struct
 {
         /* Members common for all DXF drawable entities. */
-        int id_code;
+        uint64_t id_code;
                 /*!< Identification number for the entity.\n
                  * This is to be an unique (sequential) number in the DXF
                  * file.\n
@@ -146,16 +146,16 @@ dxf_mline_struct
                  * (optional).\n
                  * Group code = 310.\n
                  * \since Introduced in version R2000. */
-        char *dictionary_owner_soft;
+        uint64_t dictionary_owner_soft;
                 /*!< Soft-pointer ID/handle to owner dictionary (optional).\n
                  * Group code = 330.\n
                  * \since Introduced in version R14. */
-        char *material;
+        uint64_t material;
                 /*!< Hard-pointer ID/handle to material object (present if
                  * not BYLAYER).\n
                  * Group code = 347.\n
                  * \since Introduced in version R2008. */
-        char *dictionary_owner_hard;
+        uint64_t dictionary_owner_hard;
                 /*!< Hard owner ID/handle to owner dictionary (optional).\n
                  * Group code = 360.\n
                  * \since Introduced in version R14. */
@@ -164,7 +164,7 @@ dxf_mline_struct
                  * Stored and moved around as a 16-bit integer.\n
                  * Group code = 370.\n
                  * \since Introduced in version R2002. */
-        char *plot_style_name;
+        uint64_t plot_style_name;
                 /*!< Hard pointer ID / handle of PlotStyleName object.\n
                  * Group code = 390.\n
                  * \since Introduced in version R2009. */
@@ -287,8 +287,8 @@ DxfMline *dxf_mline_read (DxfFile *fp, DxfMline *mline);
 int dxf_mline_write (DxfFile *fp, DxfMline *mline);
 int dxf_mline_free (DxfMline *mline);
 void dxf_mline_free_list (DxfMline *mlines);
-int dxf_mline_get_id_code (DxfMline *mline);
-DxfMline *dxf_mline_set_id_code (DxfMline *mline, int id_code);
+uint64_t dxf_mline_get_id_code (DxfMline *mline);
+DxfMline *dxf_mline_set_id_code (DxfMline *mline, uint64_t id_code);
 char *dxf_mline_get_linetype (DxfMline *mline);
 DxfMline *dxf_mline_set_linetype (DxfMline *mline, char *linetype);
 char *dxf_mline_get_layer (DxfMline *mline);
@@ -311,16 +311,16 @@ int16_t dxf_mline_get_shadow_mode (DxfMline *mline);
 DxfMline *dxf_mline_set_shadow_mode (DxfMline *mline, int16_t shadow_mode);
 DxfBinaryGraphicsData *dxf_mline_get_binary_graphics_data (DxfMline *mline);
 DxfMline *dxf_mline_set_binary_graphics_data (DxfMline *mline, DxfBinaryGraphicsData *data);
-char *dxf_mline_get_dictionary_owner_soft (DxfMline *mline);
-DxfMline *dxf_mline_set_dictionary_owner_soft (DxfMline *mline, char *dictionary_owner_soft);
-char *dxf_mline_get_material (DxfMline *mline);
-DxfMline *dxf_mline_set_material (DxfMline *mline, char *material);
-char *dxf_mline_get_dictionary_owner_hard (DxfMline *mline);
-DxfMline *dxf_mline_set_dictionary_owner_hard (DxfMline *mline, char *dictionary_owner_hard);
+uint64_t dxf_mline_get_dictionary_owner_soft (DxfMline *mline);
+DxfMline *dxf_mline_set_dictionary_owner_soft (DxfMline *mline, uint64_t dictionary_owner_soft);
+uint64_t dxf_mline_get_material (DxfMline *mline);
+DxfMline *dxf_mline_set_material (DxfMline *mline, uint64_t material);
+uint64_t dxf_mline_get_dictionary_owner_hard (DxfMline *mline);
+DxfMline *dxf_mline_set_dictionary_owner_hard (DxfMline *mline, uint64_t dictionary_owner_hard);
 int16_t dxf_mline_get_lineweight (DxfMline *mline);
 DxfMline *dxf_mline_set_lineweight (DxfMline *mline, int16_t lineweight);
-char *dxf_mline_get_plot_style_name (DxfMline *mline);
-DxfMline *dxf_mline_set_plot_style_name (DxfMline *mline, char *plot_style_name);
+uint64_t dxf_mline_get_plot_style_name (DxfMline *mline);
+DxfMline *dxf_mline_set_plot_style_name (DxfMline *mline, uint64_t plot_style_name);
 long dxf_mline_get_color_value (DxfMline *mline);
 DxfMline *dxf_mline_set_color_value (DxfMline *mline, long color_value);
 char *dxf_mline_get_color_name (DxfMline *mline);
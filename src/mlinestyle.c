@@ -42,6 +42,7 @@
 
 
 #include "mlinestyle.h"
+#include "util.h"
 
 
 /*!
@@ -64,7 +65,7 @@ dxf_mlinestyle_new ()
         size = sizeof (DxfMlinestyle);
         /* avoid malloc of 0 bytes */
         if (size == 0) size = 1;
-        if ((mlinestyle = malloc (size)) == NULL)
+        if ((mlinestyle = dxf_malloc (size)) == NULL)
         {
                 fprintf (stderr,
                   (_("Error in %s () could not allocate memory for a DxfMlinestyle struct.\n")),
@@ -116,11 +117,11 @@ dxf_mlinestyle_init
                   __FUNCTION__);
                 return (NULL);
         }
-        dxf_mlinestyle_set_name (mlinestyle, strdup (""));
-        dxf_mlinestyle_set_description (mlinestyle, strdup (""));
+        dxf_mlinestyle_set_name (mlinestyle, dxf_strdup (""));
+        dxf_mlinestyle_set_description (mlinestyle, dxf_strdup (""));
         dxf_mlinestyle_set_id_code (mlinestyle, 0);
-        dxf_mlinestyle_set_dictionary_owner_soft (mlinestyle, strdup (""));
-        dxf_mlinestyle_set_dictionary_owner_hard (mlinestyle, strdup (""));
+        dxf_mlinestyle_set_dictionary_owner_soft (mlinestyle, 0);
+        dxf_mlinestyle_set_dictionary_owner_hard (mlinestyle, 0);
         dxf_mlinestyle_set_start_angle (mlinestyle, 0.0);
         dxf_mlinestyle_set_end_angle (mlinestyle, 0.0);
         dxf_mlinestyle_set_color (mlinestyle, DXF_COLOR_BYLAYER);
@@ -128,7 +129,7 @@ dxf_mlinestyle_init
         dxf_mlinestyle_set_number_of_elements (mlinestyle, 0);
         for (i = 0; i < DXF_MAX_PARAM; i++)
         {
-                dxf_mlinestyle_set_ith_element_linetype (mlinestyle, strdup (""), i);
+                dxf_mlinestyle_set_ith_element_linetype (mlinestyle, dxf_strdup (""), i);
                 dxf_mlinestyle_set_ith_element_offset (mlinestyle, 0.0, i);
                 dxf_mlinestyle_set_ith_element_color (mlinestyle, 0, i);
         }
@@ -163,7 +164,8 @@ dxf_mlinestyle_read
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        char *temp_string = NULL;
+        char temp_string[DXF_MAX_STRING_LENGTH];
+        int group_code;
         int i;
 
         /* Do some basic checks. */
@@ -172,8 +174,6 @@ dxf_mlinestyle_read
                 fprintf (stderr,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
-                /* Clean up. */
-                free (temp_string);
                 return (NULL);
         }
         if (fp->acad_version_number < AutoCAD_14)
@@ -190,145 +190,134 @@ dxf_mlinestyle_read
                 mlinestyle = dxf_mlinestyle_init (mlinestyle);
         }
         i = 0;
-        (fp->line_number)++;
-        fscanf (fp->fp, "%[^\n]", temp_string);
-        while (strcmp (temp_string, "0") != 0)
+        while ((dxf_read_group_code (fp, &group_code) == EXIT_SUCCESS)
+          && (group_code != 0))
         {
-                if (ferror (fp->fp))
+                if (dxf_read_error (fp))
                 {
                         fprintf (stderr,
                           (_("Error in %s () while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
                         /* Clean up. */
-                        free (temp_string);
-                        fclose (fp->fp);
                         return (NULL);
                 }
-                if (strcmp (temp_string, "2") == 0)
-                {
-                        /* Now follows a string containing a mlinestyle
-                         * name string. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, mlinestyle->name);
-                }
-                if (strcmp (temp_string, "3") == 0)
-                {
-                        /* Now follows a string containing a description
-                         * string. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, mlinestyle->description);
-                }
-                if (strcmp (temp_string, "5") == 0)
-                {
-                        /* Now follows a string containing a sequential
-                         * id number. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%x\n", (uint *) &mlinestyle->id_code);
-                }
-                if (strcmp (temp_string, "6") == 0)
-                {
-                        /* Now follows a string containing an element
-                         * linetype. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, mlinestyle->element_linetype[i]);
-                        i++;
-                }
-                if (strcmp (temp_string, "49") == 0)
-                {
-                        /* Now follows a string containing an element
-                         * offset value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &mlinestyle->element_offset[i]);
-                }
-                if (strcmp (temp_string, "51") == 0)
-                {
-                        /* Now follows a string containing a start angle
-                         * value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &mlinestyle->start_angle);
-                }
-                if (strcmp (temp_string, "52") == 0)
-                {
-                        /* Now follows a string containing a end angle
-                         * value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &mlinestyle->end_angle);
-                }
-                if ((strcmp (temp_string, "62") == 0)
-                  && (i == 0))
-                {
-                        /* Now follows a string containing a fill color
-                         * value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%d\n", &mlinestyle->color);
-                        i++;
-                }
-                if ((strcmp (temp_string, "62") == 0)
-                  && (i > 0))
-                {
-                        /* Now follows a string containing an element
-                         * color value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%d\n", &mlinestyle->element_color[i]);
-                }
-                if (strcmp (temp_string, "70") == 0)
-                {
-                        /* Now follows a string containing a flags
-                         * value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%d\n", &mlinestyle->flags);
-                }
-                if (strcmp (temp_string, "71") == 0)
-                {
-                        /* Now follows a string containing a number of
-                         * elements value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%d\n", &mlinestyle->number_of_elements);
-                }
-                else if ((fp->acad_version_number >= AutoCAD_13)
-                        && (strcmp (temp_string, "100") == 0))
+                switch (group_code)
                 {
-                        /* Now follows a string containing the
-                         * subclass marker value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
-                        if (strcmp (temp_string, "AcDbMlineStyle") != 0)
-                        {
+                        case 2:
+                                /* Now follows a string containing a mlinestyle
+                                 * name string. */
+                                dxf_read_string (fp, &mlinestyle->name);
+                                break;
+                        case 3:
+                                /* Now follows a string containing a description
+                                 * string. */
+                                dxf_read_string (fp, &mlinestyle->description);
+                                break;
+                        case 5:
+                                /* Now follows a string containing a sequential
+                                 * id number. */
+                                dxf_read_handle (fp, &mlinestyle->id_code);
+                                break;
+                        case 6:
+                                /* Now follows a string containing an element
+                                 * linetype. */
+                                dxf_read_string (fp, &mlinestyle->element_linetype[i]);
+                                i++;
+                                break;
+                        case 49:
+                                /* Now follows a string containing an element
+                                 * offset value. */
+                                dxf_read_double (fp, &mlinestyle->element_offset[i]);
+                                break;
+                        case 51:
+                                /* Now follows a string containing a start angle
+                                 * value. */
+                                dxf_read_double (fp, &mlinestyle->start_angle);
+                                break;
+                        case 52:
+                                /* Now follows a string containing a end angle
+                                 * value. */
+                                dxf_read_double (fp, &mlinestyle->end_angle);
+                                break;
+                        case 62:
+                                if (i == 0)
+                                {
+                                        /* Now follows a string containing a fill color
+                                         * value. */
+                                        dxf_read_int (fp, &mlinestyle->color);
+                                        i++;
+                                }
+                                else if (i > 0)
+                                {
+                                        /* Now follows a string containing an element
+                                         * color value. */
+                                        dxf_read_int (fp, &mlinestyle->element_color[i]);
+                                }
+                                else
+                                {
+                                        fprintf (stderr,
+                                          (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
+                                          __FUNCTION__, fp->filename, fp->line_number);
+                                        /* Skip the value of the unknown group code. */
+                                        dxf_read_line (temp_string, fp);
+                                }
+                                break;
+                        case 70:
+                                /* Now follows a string containing a flags
+                                 * value. */
+                                dxf_read_int (fp, &mlinestyle->flags);
+                                break;
+                        case 71:
+                                /* Now follows a string containing a number of
+                                 * elements value. */
+                                dxf_read_int (fp, &mlinestyle->number_of_elements);
+                                break;
+                        case 100:
+                                if (fp->acad_version_number >= AutoCAD_13)
+                                {
+                                        /* Now follows a string containing the
+                                         * subclass marker value. */
+                                        dxf_read_line (temp_string, fp);
+                                        if (strcmp (temp_string, "AcDbMlineStyle") != 0)
+                                        {
+                                                fprintf (stderr,
+                                                  (_("Warning in %s () found a bad subclass marker in: %s in line: %d.\n")),
+                                                  __FUNCTION__, fp->filename, fp->line_number);
+                                        }
+                                }
+                                else
+                                {
+                                        fprintf (stderr,
+                                          (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
+                                          __FUNCTION__, fp->filename, fp->line_number);
+                                        /* Skip the value of the unknown group code. */
+                                        dxf_read_line (temp_string, fp);
+                                }
+                                break;
+                        case 330:
+                                /* Now follows a string containing Soft-pointer
+                                 * ID/handle to owner dictionary. */
+                                dxf_read_handle (fp, &mlinestyle->dictionary_owner_soft);
+                                break;
+                        case 360:
+                                /* Now follows a string containing Hard owner
+                                 * ID/handle to owner dictionary. */
+                                dxf_read_handle (fp, &mlinestyle->dictionary_owner_hard);
+                                break;
+                        case 999:
+                                /* Now follows a string containing a comment. */
+                                dxf_read_line (temp_string, fp);
+                                fprintf (stdout, (_("DXF comment: %s\n")), temp_string);
+                                break;
+                        default:
                                 fprintf (stderr,
-                                  (_("Warning in %s () found a bad subclass marker in: %s in line: %d.\n")),
+                                  (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
                                   __FUNCTION__, fp->filename, fp->line_number);
-                        }
-                }
-                else if (strcmp (temp_string, "330") == 0)
-                {
-                        /* Now follows a string containing Soft-pointer
-                         * ID/handle to owner dictionary. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, mlinestyle->dictionary_owner_soft);
-                }
-                else if (strcmp (temp_string, "360") == 0)
-                {
-                        /* Now follows a string containing Hard owner
-                         * ID/handle to owner dictionary. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, mlinestyle->dictionary_owner_hard);
-                }
-                else if (strcmp (temp_string, "999") == 0)
-                {
-                        /* Now follows a string containing a comment. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
-                        fprintf (stdout, (_("DXF comment: %s\n")), temp_string);
-                }
-                else
-                {
-                        fprintf (stderr,
-                          (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
-                          __FUNCTION__, fp->filename, fp->line_number);
+                                /* Skip the value of the unknown group code. */
+                                dxf_read_line (temp_string, fp);
+                                break;
                 }
         }
-        /* Clean up. */
-        free (temp_string);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -361,7 +350,7 @@ dxf_mlinestyle_write
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        char *dxf_entity_name = strdup ("MLINESTYLE");
+        char *dxf_entity_name = dxf_strdup ("MLINESTYLE");
         int i;
 
         /* Do some basic checks. */
@@ -371,7 +360,7 @@ dxf_mlinestyle_write
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (mlinestyle == NULL)
@@ -380,28 +369,28 @@ dxf_mlinestyle_write
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if ((fp->acad_version_number < AutoCAD_13)
           && (fp->follow_strict_version_rules))
         {
                 fprintf (stderr,
-                  (_("Error in %s () illegal DXF version for this %s entity with id-code: %x.\n")),
+                  (_("Error in %s () illegal DXF version for this %s entity with id-code: %" PRIx64 ".\n")),
                   __FUNCTION__, dxf_entity_name, dxf_mlinestyle_get_id_code (mlinestyle));
                 return (EXIT_FAILURE);
         }
         else
         {
                 fprintf (stderr,
-                  (_("Warning in %s () illegal DXF version for this %s entity with id-code: %x.\n")),
+                  (_("Warning in %s () illegal DXF version for this %s entity with id-code: %" PRIx64 ".\n")),
                   __FUNCTION__, dxf_entity_name, dxf_mlinestyle_get_id_code (mlinestyle));
         }
         /* Start writing output. */
-        fprintf (fp->fp, "  0\n%s\n", dxf_entity_name);
-        if (dxf_mlinestyle_get_id_code (mlinestyle) != -1)
+        dxf_write_string (fp, 0, dxf_entity_name);
+        if (dxf_mlinestyle_get_id_code (mlinestyle) != DXF_HANDLE_NONE)
         {
-                fprintf (fp->fp, "  5\n%x\n", dxf_mlinestyle_get_id_code (mlinestyle));
+                dxf_write_hex (fp, 5, dxf_mlinestyle_get_id_code (mlinestyle));
         }
         /*!
          * \todo for version R14.\n
@@ -413,39 +402,39 @@ dxf_mlinestyle_write
          * 102 groups are application defined (optional).\n\n
          * End of group, "}" (optional), with Group code 102.
          */
-        if ((strcmp (dxf_mlinestyle_get_dictionary_owner_soft (mlinestyle), "") != 0)
+        if ((dxf_mlinestyle_get_dictionary_owner_soft (mlinestyle) != 0)
           && (fp->acad_version_number >= AutoCAD_14))
         {
-                fprintf (fp->fp, "102\n{ACAD_REACTORS\n");
-                fprintf (fp->fp, "330\n%s\n", dxf_mlinestyle_get_dictionary_owner_soft (mlinestyle));
-                fprintf (fp->fp, "102\n}\n");
+                dxf_write_string (fp, 102, "{ACAD_REACTORS");
+                dxf_write_hex (fp, 330, dxf_mlinestyle_get_dictionary_owner_soft (mlinestyle));
+                dxf_write_string (fp, 102, "}");
         }
-        if ((strcmp (dxf_mlinestyle_get_dictionary_owner_hard (mlinestyle), "") != 0)
+        if ((dxf_mlinestyle_get_dictionary_owner_hard (mlinestyle) != 0)
           && (fp->acad_version_number >= AutoCAD_14))
         {
-                fprintf (fp->fp, "102\n{ACAD_XDICTIONARY\n");
-                fprintf (fp->fp, "360\n%s\n", dxf_mlinestyle_get_dictionary_owner_hard (mlinestyle));
-                fprintf (fp->fp, "102\n}\n");
+                dxf_write_string (fp, 102, "{ACAD_XDICTIONARY");
+                dxf_write_hex (fp, 360, dxf_mlinestyle_get_dictionary_owner_hard (mlinestyle));
+                dxf_write_string (fp, 102, "}");
         }
         if (fp->acad_version_number >= AutoCAD_13)
         {
-                fprintf (fp->fp, "100\nAcDbMlineStyle\n");
+                dxf_write_string (fp, 100, "AcDbMlineStyle");
         }
-        fprintf (fp->fp, "  2\n%s\n", dxf_mlinestyle_get_name (mlinestyle));
-        fprintf (fp->fp, " 70\n%d\n", dxf_mlinestyle_get_flags (mlinestyle));
-        fprintf (fp->fp, "  3\n%s\n", dxf_mlinestyle_get_description (mlinestyle));
-        fprintf (fp->fp, " 62\n%d\n", dxf_mlinestyle_get_color (mlinestyle));
-        fprintf (fp->fp, " 51\n%lf\n", dxf_mlinestyle_get_start_angle (mlinestyle));
-        fprintf (fp->fp, " 52\n%lf\n", dxf_mlinestyle_get_end_angle (mlinestyle));
-        fprintf (fp->fp, " 71\n%d\n", dxf_mlinestyle_get_number_of_elements (mlinestyle));
+        dxf_write_string (fp, 2, dxf_mlinestyle_get_name (mlinestyle));
+        dxf_write_int (fp, 70, dxf_mlinestyle_get_flags (mlinestyle));
+        dxf_write_string (fp, 3, dxf_mlinestyle_get_description (mlinestyle));
+        dxf_write_int (fp, 62, dxf_mlinestyle_get_color (mlinestyle));
+        dxf_write_double (fp, 51, dxf_mlinestyle_get_start_angle (mlinestyle));
+        dxf_write_double (fp, 52, dxf_mlinestyle_get_end_angle (mlinestyle));
+        dxf_write_int (fp, 71, dxf_mlinestyle_get_number_of_elements (mlinestyle));
         for (i = 1; i < DXF_MAX_PARAM; i++)
         {
-                fprintf (fp->fp, " 49\n%lf\n", dxf_mlinestyle_get_ith_element_offset (mlinestyle, i));
-                fprintf (fp->fp, " 62\n%d\n", dxf_mlinestyle_get_ith_element_color (mlinestyle, i));
-                fprintf (fp->fp, "  6\n%s\n", dxf_mlinestyle_get_ith_element_linetype (mlinestyle, i));
+                dxf_write_double (fp, 49, dxf_mlinestyle_get_ith_element_offset (mlinestyle, i));
+                dxf_write_int (fp, 62, dxf_mlinestyle_get_ith_element_color (mlinestyle, i));
+                dxf_write_string (fp, 6, dxf_mlinestyle_get_ith_element_linetype (mlinestyle, i));
         }
         /* Clean up. */
-        free (dxf_entity_name);
+        dxf_free (dxf_entity_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -488,15 +477,13 @@ dxf_mlinestyle_free
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        free (dxf_mlinestyle_get_dictionary_owner_soft (mlinestyle));
-        free (dxf_mlinestyle_get_dictionary_owner_hard (mlinestyle));
-        free (dxf_mlinestyle_get_name (mlinestyle));
-        free (dxf_mlinestyle_get_description (mlinestyle));
+        dxf_free (dxf_mlinestyle_get_name (mlinestyle));
+        dxf_free (dxf_mlinestyle_get_description (mlinestyle));
         for (i = 0; i < DXF_MAX_PARAM; i++)
         {
-                free (dxf_mlinestyle_get_ith_element_linetype (mlinestyle, 1));
+                dxf_free (dxf_mlinestyle_get_ith_element_linetype (mlinestyle, 1));
         }
-        free (mlinestyle);
+        dxf_free (mlinestyle);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -542,7 +529,7 @@ dxf_mlinestyle_free_list
  *
  * \return \c id_code.
  */
-int
+uint64_t
 dxf_mlinestyle_get_id_code
 (
         DxfMlinestyle *mlinestyle
@@ -560,13 +547,6 @@ dxf_mlinestyle_get_id_code
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (mlinestyle->id_code < 0)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a negative value was found.\n")),
-                  __FUNCTION__);
-                return (EXIT_FAILURE);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -582,7 +562,7 @@ dxf_mlinestyle_set_id_code
 (
         DxfMlinestyle *mlinestyle,
                 /*!< a pointer to a DXF \c MLINESTYLE object. */
-        int id_code
+        uint64_t id_code
                 /*!< Identification number for the object.\n
                  * This is to be an unique (sequential) number in the DXF
                  * file. */
@@ -599,13 +579,6 @@ dxf_mlinestyle_set_id_code
                   __FUNCTION__);
                 return (NULL);
         }
-        if (id_code < 0)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a negative value was passed.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
         mlinestyle->id_code = id_code;
 #if DEBUG
         DXF_DEBUG_END
@@ -619,10 +592,8 @@ dxf_mlinestyle_set_id_code
  * \c MLINESTYLE object.
  *
  * \return soft pointer to the dictionary owner.
- *
- * \warning No checks are performed on the returned pointer (string).
  */
-char *
+uint64_t
 dxf_mlinestyle_get_dictionary_owner_soft
 (
         DxfMlinestyle *mlinestyle
@@ -638,19 +609,12 @@ dxf_mlinestyle_get_dictionary_owner_soft
                 fprintf (stderr,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
-                return (NULL);
-        }
-        if (mlinestyle->dictionary_owner_soft ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
+                return (0);
         }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (mlinestyle->dictionary_owner_soft));
+        return (mlinestyle->dictionary_owner_soft);
 }
 
 
@@ -663,8 +627,8 @@ dxf_mlinestyle_set_dictionary_owner_soft
 (
         DxfMlinestyle *mlinestyle,
                 /*!< a pointer to a DXF \c MLINESTYLE object. */
-        char *dictionary_owner_soft
-                /*!< a string containing the pointer to the
+        uint64_t dictionary_owner_soft
+                /*!< the handle of the
                  * dictionary_owner_soft for the object. */
 )
 {
@@ -679,14 +643,7 @@ dxf_mlinestyle_set_dictionary_owner_soft
                   __FUNCTION__);
                 return (NULL);
         }
-        if (dictionary_owner_soft == NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was passed.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
-        mlinestyle->dictionary_owner_soft = strdup (dictionary_owner_soft);
+        mlinestyle->dictionary_owner_soft = dictionary_owner_soft;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -699,10 +656,8 @@ dxf_mlinestyle_set_dictionary_owner_soft
  * \c MLINESTYLE object.
  *
  * \return hard pointer to the dictionary owner.
- *
- * \warning No checks are performed on the returned pointer (string).
  */
-char *
+uint64_t
 dxf_mlinestyle_get_dictionary_owner_hard
 (
         DxfMlinestyle *mlinestyle
@@ -718,19 +673,12 @@ dxf_mlinestyle_get_dictionary_owner_hard
                 fprintf (stderr,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
-                return (NULL);
-        }
-        if (mlinestyle->dictionary_owner_hard ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
+                return (0);
         }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (mlinestyle->dictionary_owner_hard));
+        return (mlinestyle->dictionary_owner_hard);
 }
 
 
@@ -743,8 +691,8 @@ dxf_mlinestyle_set_dictionary_owner_hard
 (
         DxfMlinestyle *mlinestyle,
                 /*!< a pointer to a DXF \c MLINESTYLE object. */
-        char *dictionary_owner_hard
-                /*!< a string containing the pointer to the
+        uint64_t dictionary_owner_hard
+                /*!< the handle of the
                  * dictionary_owner_hard for the object. */
 )
 {
@@ -759,14 +707,7 @@ dxf_mlinestyle_set_dictionary_owner_hard
                   __FUNCTION__);
                 return (NULL);
         }
-        if (dictionary_owner_hard == NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was passed.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
-        mlinestyle->dictionary_owner_hard = strdup (dictionary_owner_hard);
+        mlinestyle->dictionary_owner_hard = dictionary_owner_hard;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -809,7 +750,7 @@ dxf_mlinestyle_get_name
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (mlinestyle->name));
+        return (dxf_strdup (mlinestyle->name));
 }
 
 
@@ -843,7 +784,7 @@ dxf_mlinestyle_set_name
                   __FUNCTION__);
                 return (NULL);
         }
-        mlinestyle->name = strdup (name);
+        mlinestyle->name = dxf_strdup (name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -886,7 +827,7 @@ dxf_mlinestyle_get_description
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (mlinestyle->description));
+        return (dxf_strdup (mlinestyle->description));
 }
 
 
@@ -921,7 +862,7 @@ dxf_mlinestyle_set_description
                   __FUNCTION__);
                 return (NULL);
         }
-        mlinestyle->description = strdup (description);
+        mlinestyle->description = dxf_strdup (description);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -980,7 +921,7 @@ dxf_mlinestyle_get_ith_element_linetype
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (mlinestyle->element_linetype[i]));
+        return (dxf_strdup (mlinestyle->element_linetype[i]));
 }
 
 
@@ -1031,7 +972,7 @@ dxf_mlinestyle_set_ith_element_linetype
                   __FUNCTION__);
                 return (NULL);
         }
-        mlinestyle->element_linetype[i] = strdup (element_linetype);
+        mlinestyle->element_linetype[i] = dxf_strdup (element_linetype);
 #if DEBUG
         DXF_DEBUG_END
 #endif
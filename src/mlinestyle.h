@@ -71,15 +71,15 @@ typedef struct
 dxf_mlinestyle_struct
 {
         /* Members common for all DXF objects. */
-        int id_code;
+        uint64_t id_code;
                 /*!< Identification number for the entity.\n
                  * This is to be an unique (sequential) number in the DXF
                  * file.\n
                  * Group code = 5. */
-        char *dictionary_owner_soft;
+        uint64_t dictionary_owner_soft;
                 /*!< Soft-pointer ID/handle to owner dictionary (optional).\n
                  * Group code = 330. */
-        char *dictionary_owner_hard;
+        uint64_t dictionary_owner_hard;
                 /*!< Hard owner ID/handle to owner dictionary (optional).\n
                  * Group code = 360. */
         /* Specific members for a DXF mlinestyle. */
@@ -141,12 +141,12 @@ DxfMlinestyle *dxf_mlinestyle_read (DxfFile *fp, DxfMlinestyle *mlinestyle);
 int dxf_mlinestyle_write (DxfFile *fp, DxfMlinestyle *mlinestyle);
 int dxf_mlinestyle_free (DxfMlinestyle *mlinestyle);
 void dxf_mlinestyle_free_list (DxfMlinestyle *mlinestyles);
-int dxf_mlinestyle_get_id_code (DxfMlinestyle *mlinestyle);
-DxfMlinestyle *dxf_mlinestyle_set_id_code (DxfMlinestyle *mlinestyle, int id_code);
-char *dxf_mlinestyle_get_dictionary_owner_soft (DxfMlinestyle *mlinestyle);
-DxfMlinestyle *dxf_mlinestyle_set_dictionary_owner_soft (DxfMlinestyle *mlinestyle, char *dictionary_owner_soft);
-char *dxf_mlinestyle_get_dictionary_owner_hard (DxfMlinestyle *mlinestyle);
-DxfMlinestyle *dxf_mlinestyle_set_dictionary_owner_hard (DxfMlinestyle *mlinestyle, char *dictionary_owner_hard);
+uint64_t dxf_mlinestyle_get_id_code (DxfMlinestyle *mlinestyle);
+DxfMlinestyle *dxf_mlinestyle_set_id_code (DxfMlinestyle *mlinestyle, uint64_t id_code);
+uint64_t dxf_mlinestyle_get_dictionary_owner_soft (DxfMlinestyle *mlinestyle);
+DxfMlinestyle *dxf_mlinestyle_set_dictionary_owner_soft (DxfMlinestyle *mlinestyle, uint64_t dictionary_owner_soft);
+uint64_t dxf_mlinestyle_get_dictionary_owner_hard (DxfMlinestyle *mlinestyle);
+DxfMlinestyle *dxf_mlinestyle_set_dictionary_owner_hard (DxfMlinestyle *mlinestyle, uint64_t dictionary_owner_hard);
 char *dxf_mlinestyle_get_name (DxfMlinestyle *mlinestyle);
 DxfMlinestyle *dxf_mlinestyle_set_name (DxfMlinestyle *mlinestyle, char *name);
 char *dxf_mlinestyle_get_description (DxfMlinestyle *mlinestyle);
@@ -42,6 +42,8 @@
 
 
 #include "mtext.h"
+#include "bbox.h"
+#include "util.h"
 
 
 /*!
@@ -61,7 +63,7 @@ dxf_mtext_new ()
         size = sizeof (DxfMtext);
         /* avoid malloc of 0 bytes */
         if (size == 0) size = 1;
-        if ((mtext = malloc (size)) == NULL)
+        if ((mtext = dxf_malloc (size)) == NULL)
         {
                 fprintf (stderr,
                   (_("Error in %s () could not allocate memory for a DxfMtext struct.\n")),
@@ -112,18 +114,24 @@ dxf_mtext_init
                 __FUNCTION__);
               return (NULL);
         }
-        mtext->id_code = 0;
-        mtext->text_value = strdup ("");
-        for (i = 1; i < DXF_MAX_PARAM; i++)
+        mtext->id_code = DXF_HANDLE_NONE;
+        mtext->text_value = dxf_strdup ("");
+        for (i = 0; i < DXF_MAX_PARAM; i++)
         {
-                mtext->text_additional_value[i] = strdup ("");
+                mtext->text_additional_value[i] = dxf_strdup ("");
         }
-        mtext->linetype = strdup (DXF_DEFAULT_LINETYPE);
-        mtext->text_style = strdup ("");
-        mtext->layer = strdup (DXF_DEFAULT_LAYER);
+        mtext->dictionary_owner_soft = 0;
+        mtext->dictionary_owner_hard = 0;
+        mtext->linetype = dxf_strdup (DXF_DEFAULT_LINETYPE);
+        mtext->text_style = dxf_strdup ("");
+        mtext->layer = dxf_strdup (DXF_DEFAULT_LAYER);
+        mtext->p0 = (DxfPoint *) dxf_point_new ();
+        mtext->p0 = dxf_point_init ((DxfPoint *) mtext->p0);
         mtext->p0->x0 = 0.0;
         mtext->p0->y0 = 0.0;
         mtext->p0->z0 = 0.0;
+        mtext->p1 = (DxfPoint *) dxf_point_new ();
+        mtext->p1 = dxf_point_init ((DxfPoint *) mtext->p1);
         mtext->p1->x0 = 0.0;
         mtext->p1->y0 = 0.0;
         mtext->p1->z0 = 0.0;
@@ -154,7 +162,7 @@ dxf_mtext_init
         mtext->extr_y0 = 0.0;
         mtext->extr_z0 = 0.0;
         mtext->background_color_rgb = 0;
-        mtext->background_color_name = strdup ("");
+        mtext->background_color_name = dxf_strdup ("");
         mtext->background_transparency = 0;
 #if DEBUG
         DXF_DEBUG_END
@@ -187,7 +195,8 @@ dxf_mtext_read
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        char *temp_string = NULL;
+        char temp_string[DXF_MAX_STRING_LENGTH];
+        int group_code;
 
         /* Do some basic checks. */
         if (fp == NULL)
@@ -195,8 +204,6 @@ dxf_mtext_read
                 fprintf (stderr,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
-                /* Clean up. */
-                free (temp_string);
                 return (NULL);
         }
         if (mtext == NULL)
@@ -206,320 +213,272 @@ dxf_mtext_read
                   __FUNCTION__);
                 mtext = dxf_mtext_init (mtext);
         }
-        (fp->line_number)++;
-        fscanf (fp->fp, "%[^\n]", temp_string);
-        while (strcmp (temp_string, "0") != 0)
+        while ((dxf_read_group_code (fp, &group_code) == EXIT_SUCCESS)
+          && (group_code != 0))
         {
-                if (ferror (fp->fp))
+                if (dxf_read_error (fp))
                 {
                         fprintf (stderr,
                           (_("Error in %s () while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
-                        fclose (fp->fp);
-                        /* Clean up. */
-                        free (temp_string);
                         return (NULL);
                 }
-                if (strcmp (temp_string, "1") == 0)
-                {
-                        /* Now follows a string containing a text value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, mtext->text_value);
-                }
-                else if (strcmp (temp_string, "3") == 0)
-                {
-                        /* Now follows a string containing a text value. */
-                        (fp->line_number)++;
-                        //fscanf (fp->fp, DXF_MAX_STRING_FORMAT, mtext->text_additional_value[number_additional]);
-                        //number_additional++;
-                }
-                /*!< I'm not sure this number_additional is correct.*/
-                else if (strcmp (temp_string, "5") == 0)
-                {
-                        /* Now follows a string containing a sequential
-                         * id number. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%x\n", (uint *) &mtext->id_code);
-                }
-                else if (strcmp (temp_string, "6") == 0)
-                {
-                        /* Now follows a string containing a linetype
-                         * name. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, mtext->linetype);
-                }
-                else if (strcmp (temp_string, "7") == 0)
-                {
-                        /* Now follows a string containing a text style
-                         * name. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, mtext->text_style);
-                }
-                else if (strcmp (temp_string, "8") == 0)
-                {
-                        /* Now follows a string containing a layer name. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, mtext->layer);
-                }
-                else if (strcmp (temp_string, "10") == 0)
-                {
-                        /* Now follows a string containing the
-                         * X-coordinate of the insertion point. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &mtext->p0->x0);
-                }
-                else if (strcmp (temp_string, "20") == 0)
-                {
-                        /* Now follows a string containing the
-                         * Y-coordinate of the insertion point. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &mtext->p0->y0);
-                }
-                else if (strcmp (temp_string, "30") == 0)
-                {
-                        /* Now follows a string containing the
-                         * Z-coordinate of the insertion point. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &mtext->p0->z0);
-                }
-                else if (strcmp (temp_string, "11") == 0)
-                {
-                        /* Now follows a string containing the
-                         * X-coordinate of the direction vector. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &mtext->p1->x0);
-                }
-                else if (strcmp (temp_string, "21") == 0)
-                {
-                        /* Now follows a string containing the
-                         * Y-coordinate of the direction vector. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &mtext->p1->y0);
-                }
-                else if (strcmp (temp_string, "31") == 0)
-                {
-                        /* Now follows a string containing the
-                         * Z-coordinate of the direction vector. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &mtext->p1->z0);
-                }
-                else if ((fp->acad_version_number <= AutoCAD_11)
-                  && DXF_FLATLAND
-                  && (strcmp (temp_string, "38") == 0))
-                {
-                        /* Now follows a string containing the
-                         * elevation. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &mtext->elevation);
-                }
-                else if (strcmp (temp_string, "39") == 0)
-                {
-                        /* Now follows a string containing the
-                         * thickness. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &mtext->thickness);
-                }
-                else if (strcmp (temp_string, "40") == 0)
-                {
-                        /* Now follows a string containing the
-                         * height. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &mtext->height);
-                }
-                else if (strcmp (temp_string, "41") == 0)
-                {
-                        /* Now follows a string containing the
-                         * reference rectangle width. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &mtext->rectangle_width);
-                }
-                else if (strcmp (temp_string, "42") == 0)
-                {
-                        /* Now follows a string containing the
-                         * horizontal width of the characters. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &mtext->horizontal_width);
-                }
-                else if (strcmp (temp_string, "43") == 0)
-                {
-                        /* Now follows a string containing the
-                         * vertical rectangle height. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &mtext->rectangle_height);
-                }
-                else if (strcmp (temp_string, "44") == 0)
-                {
-                        /* Now follows a string containing the
-                         * text line spacing factor. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &mtext->spacing_factor);
-                }
-                else if (strcmp (temp_string, "45") == 0)
-                {
-                        /* Now follows a string containing the
-                         * fill box scale (border around text). */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &mtext->box_scale);
-                }
-                else if (strcmp (temp_string, "48") == 0)
-                {
-                        /* Now follows a string containing the
-                         * column width. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &mtext->column_width);
-                }
-                else if (strcmp (temp_string, "49") == 0)
-                {
-                        /* Now follows a string containing the
-                         * column gutter. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &mtext->column_gutter);
-                }
-                else if ((fp->acad_version_number <= AutoCAD_2006)
-                        && (strcmp (temp_string, "50") == 0))
-                {
-                        /* Now follows a string containing the
-                         * rotation angle. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &mtext->rot_angle);
-                }
-                else if ((fp->acad_version_number >= AutoCAD_2007)
-                        && (strcmp (temp_string, "50") == 0))
-                {
-                        /* Can follows a string containing the
-                         * rotation angle or column heights. */
-                        (fp->line_number)++;
-                /*!< Add more code here, I'm stop because the double use of group code 50*/
-                }
-                else if (strcmp (temp_string, "63") == 0)
-                {
-                        /* Now follows a string containing the
-                         * color to use for background fill. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%d\n", &mtext->background_color);
-                }
-                else if (strcmp (temp_string, "71") == 0)
-                {
-                        /* Now follows a string containing the
-                         * attachment point. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%d\n", &mtext->attachment_point);
-                }
-                else if (strcmp (temp_string, "72") == 0)
-                {
-                        /* Now follows a string containing the
-                         * drawing direction. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%d\n", &mtext->drawing_direction);
-                }
-                else if (strcmp (temp_string, "73") == 0)
-                {
-                        /* Now follows a string containing the
-                         * mtext line spacing style. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%d\n", &mtext->spacing_style);
-                }
-                else if (strcmp (temp_string, "75") == 0)
-                {
-                        /* Now follows a string containing the
-                         * column type. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%d\n", &mtext->column_type);
-                }
-                else if (strcmp (temp_string, "76") == 0)
-                {
-                        /* Now follows a string containing the
-                         * column count. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%d\n", &mtext->column_count);
-                }
-                else if (strcmp (temp_string, "78") == 0)
-                {
-                        /* Now follows a string containing the
-                         * column flow reverse. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%d\n", &mtext->column_flow);
-                }
-                else if (strcmp (temp_string, "79") == 0)
-                {
-                        /* Now follows a string containing the
-                         * column autoheight. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%d\n", &mtext->column_autoheight);
-                }
-                else if (strcmp (temp_string, "90") == 0)
+                switch (group_code)
                 {
-                        /* Now follows a string containing the
-                         * background fill setting. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%d\n", &mtext->background_fill);
-                }
-                else if ((fp->acad_version_number >= AutoCAD_13)
-                        && (strcmp (temp_string, "100") == 0))
-                {
-                        /* Now follows a string containing the
-                         * subclass marker value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
-                        if ((strcmp (temp_string, "AcDbEntity") != 0)
-                        && ((strcmp (temp_string, "AcDbMText") != 0)))
-                        {
+                        case 1:
+                                /* Now follows a string containing a text value. */
+                                dxf_read_string (fp, &mtext->text_value);
+                                break;
+                        case 3:
+                                /* Now follows a string containing a text value. */
+                                dxf_read_line (temp_string, fp);
+                                //dxf_read_string (fp, &mtext->text_additional_value[number_additional]);
+                                //number_additional++;
+                                break;
+                        case 5:
+                                /*!< I'm not sure this number_additional is correct.*/
+                                /* Now follows a string containing a sequential
+                                 * id number. */
+                                dxf_read_handle (fp, &mtext->id_code);
+                                break;
+                        case 6:
+                                /* Now follows a string containing a linetype
+                                 * name. */
+                                dxf_read_string_interned (fp, &mtext->linetype);
+                                break;
+                        case 7:
+                                /* Now follows a string containing a text style
+                                 * name. */
+                                dxf_read_string_interned (fp, &mtext->text_style);
+                                break;
+                        case 8:
+                                /* Now follows a string containing a layer name. */
+                                dxf_read_string_interned (fp, &mtext->layer);
+                                break;
+                        case 10:
+                                /* Now follows a string containing the
+                                 * X-coordinate of the insertion point. */
+                                dxf_read_double (fp, &mtext->p0->x0);
+                                break;
+                        case 20:
+                                /* Now follows a string containing the
+                                 * Y-coordinate of the insertion point. */
+                                dxf_read_double (fp, &mtext->p0->y0);
+                                break;
+                        case 30:
+                                /* Now follows a string containing the
+                                 * Z-coordinate of the insertion point. */
+                                dxf_read_double (fp, &mtext->p0->z0);
+                                break;
+                        case 11:
+                                /* Now follows a string containing the
+                                 * X-coordinate of the direction vector. */
+                                dxf_read_double (fp, &mtext->p1->x0);
+                                break;
+                        case 21:
+                                /* Now follows a string containing the
+                                 * Y-coordinate of the direction vector. */
+                                dxf_read_double (fp, &mtext->p1->y0);
+                                break;
+                        case 31:
+                                /* Now follows a string containing the
+                                 * Z-coordinate of the direction vector. */
+                                dxf_read_double (fp, &mtext->p1->z0);
+                                break;
+                        case 38:
+                                if ((fp->acad_version_number <= AutoCAD_11) && DXF_FLATLAND)
+                                {
+                                        /* Now follows a string containing the
+                                         * elevation. */
+                                        dxf_read_double (fp, &mtext->elevation);
+                                }
+                                else
+                                {
+                                        fprintf (stderr,
+                                          (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
+                                          __FUNCTION__, fp->filename, fp->line_number);
+                                        /* Skip the value of the unknown group code. */
+                                        dxf_read_line (temp_string, fp);
+                                }
+                                break;
+                        case 39:
+                                /* Now follows a string containing the
+                                 * thickness. */
+                                dxf_read_double (fp, &mtext->thickness);
+                                break;
+                        case 40:
+                                /* Now follows a string containing the
+                                 * height. */
+                                dxf_read_double (fp, &mtext->height);
+                                break;
+                        case 41:
+                                /* Now follows a string containing the
+                                 * reference rectangle width. */
+                                dxf_read_double (fp, &mtext->rectangle_width);
+                                break;
+                        case 42:
+                                /* Now follows a string containing the
+                                 * horizontal width of the characters. */
+                                dxf_read_double (fp, &mtext->horizontal_width);
+                                break;
+                        case 43:
+                                /* Now follows a string containing the
+                                 * vertical rectangle height. */
+                                dxf_read_double (fp, &mtext->rectangle_height);
+                                break;
+                        case 44:
+                                /* Now follows a string containing the
+                                 * text line spacing factor. */
+                                dxf_read_double (fp, &mtext->spacing_factor);
+                                break;
+                        case 45:
+                                /* Now follows a string containing the
+                                 * fill box scale (border around text). */
+                                dxf_read_double (fp, &mtext->box_scale);
+                                break;
+                        case 48:
+                                /* Now follows a string containing the
+                                 * column width. */
+                                dxf_read_double (fp, &mtext->column_width);
+                                break;
+                        case 49:
+                                /* Now follows a string containing the
+                                 * column gutter. */
+                                dxf_read_double (fp, &mtext->column_gutter);
+                                break;
+                        case 50:
+                                if (fp->acad_version_number <= AutoCAD_2006)
+                                {
+                                        /* Now follows a string containing the
+                                         * rotation angle. */
+                                        dxf_read_double (fp, &mtext->rot_angle);
+                                }
+                                else if (fp->acad_version_number >= AutoCAD_2007)
+                                {
+                                        /* Can follows a string containing the
+                                         * rotation angle or column heights. */
+                                        dxf_read_line (temp_string, fp);
+                                /*!< Add more code here, I'm stop because the double use of group code 50*/
+                                }
+                                else
+                                {
+                                        fprintf (stderr,
+                                          (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
+                                          __FUNCTION__, fp->filename, fp->line_number);
+                                        /* Skip the value of the unknown group code. */
+                                        dxf_read_line (temp_string, fp);
+                                }
+                                break;
+                        case 63:
+                                /* Now follows a string containing the
+                                 * color to use for background fill. */
+                                dxf_read_int (fp, &mtext->background_color);
+                                break;
+                        case 71:
+                                /* Now follows a string containing the
+                                 * attachment point. */
+                                dxf_read_int (fp, &mtext->attachment_point);
+                                break;
+                        case 72:
+                                /* Now follows a string containing the
+                                 * drawing direction. */
+                                dxf_read_int (fp, &mtext->drawing_direction);
+                                break;
+                        case 73:
+                                /* Now follows a string containing the
+                                 * mtext line spacing style. */
+                                dxf_read_int (fp, &mtext->spacing_style);
+                                break;
+                        case 75:
+                                /* Now follows a string containing the
+                                 * column type. */
+                                dxf_read_int (fp, &mtext->column_type);
+                                break;
+                        case 76:
+                                /* Now follows a string containing the
+                                 * column count. */
+                                dxf_read_int (fp, &mtext->column_count);
+                                break;
+                        case 78:
+                                /* Now follows a string containing the
+                                 * column flow reverse. */
+                                dxf_read_int (fp, &mtext->column_flow);
+                                break;
+                        case 79:
+                                /* Now follows a string containing the
+                                 * column autoheight. */
+                                dxf_read_int (fp, &mtext->column_autoheight);
+                                break;
+                        case 90:
+                                /* Now follows a string containing the
+                                 * background fill setting. */
+                                dxf_read_int (fp, &mtext->background_fill);
+                                break;
+                        case 100:
+                                if (fp->acad_version_number >= AutoCAD_13)
+                                {
+                                        /* Now follows a string containing the
+                                         * subclass marker value. */
+                                        dxf_read_line (temp_string, fp);
+                                        if ((strcmp (temp_string, "AcDbEntity") != 0)
+                                        && ((strcmp (temp_string, "AcDbMText") != 0)))
+                                        {
+                                                fprintf (stderr,
+                                                  (_("Warning in %s () found a bad subclass marker in: %s in line: %d.\n")),
+                                                  __FUNCTION__, fp->filename, fp->line_number);
+                                        }
+                                }
+                                else
+                                {
+                                        fprintf (stderr,
+                                          (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
+                                          __FUNCTION__, fp->filename, fp->line_number);
+                                        /* Skip the value of the unknown group code. */
+                                        dxf_read_line (temp_string, fp);
+                                }
+                                break;
+                        case 210:
+                                /* Now follows a string containing the
+                                 * X-value of the extrusion vector. */
+                                dxf_read_double (fp, &mtext->extr_x0);
+                                break;
+                        case 220:
+                                /* Now follows a string containing the
+                                 * Y-value of the extrusion vector. */
+                                dxf_read_double (fp, &mtext->extr_y0);
+                                break;
+                        case 230:
+                                /* Now follows a string containing the
+                                 * Z-value of the extrusion vector. */
+                                dxf_read_double (fp, &mtext->extr_z0);
+                                break;
+                        case 999:
+                                /* Now follows a string containing a comment. */
+                                dxf_read_line (temp_string, fp);
+                                fprintf (stdout, "DXF comment: %s\n", temp_string);
+                                break;
+                        default:
                                 fprintf (stderr,
-                                  (_("Warning in %s () found a bad subclass marker in: %s in line: %d.\n")),
+                                  (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
                                   __FUNCTION__, fp->filename, fp->line_number);
-                        }
-                }
-                else if (strcmp (temp_string, "210") == 0)
-                {
-                        /* Now follows a string containing the
-                         * X-value of the extrusion vector. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &mtext->extr_x0);
-                }
-                else if (strcmp (temp_string, "220") == 0)
-                {
-                        /* Now follows a string containing the
-                         * Y-value of the extrusion vector. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &mtext->extr_y0);
-                }
-                else if (strcmp (temp_string, "230") == 0)
-                {
-                        /* Now follows a string containing the
-                         * Z-value of the extrusion vector. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &mtext->extr_z0);
-                }
-                else if (strcmp (temp_string, "999") == 0)
-                {
-                        /* Now follows a string containing a comment. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
-                        fprintf (stdout, "DXF comment: %s\n", temp_string);
-                }
-
-                else
-                {
-                        fprintf (stderr,
-                          (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
-                          __FUNCTION__, fp->filename, fp->line_number);
+                                /* Skip the value of the unknown group code. */
+                                dxf_read_line (temp_string, fp);
+                                break;
                 }
         }
         /* Handle omitted members and/or illegal values. */
         if (strcmp (mtext->linetype, "") == 0)
         {
-                mtext->linetype = strdup (DXF_DEFAULT_LINETYPE);
+                mtext->linetype = dxf_strdup (DXF_DEFAULT_LINETYPE);
         }
         if (strcmp (mtext->layer, "") == 0)
         {
-                mtext->layer = strdup (DXF_DEFAULT_LAYER);
+                mtext->layer = dxf_strdup (DXF_DEFAULT_LAYER);
         }
-        /* Clean up. */
-        free (temp_string);
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (EXIT_SUCCESS);
+        return (mtext);
 }
 
 
@@ -548,7 +507,7 @@ dxf_mtext_write
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        char *dxf_entity_name = strdup ("MTEXT");
+        char *dxf_entity_name = dxf_strdup ("MTEXT");
         int i;
 
         /* Do some basic checks. */
@@ -558,7 +517,7 @@ dxf_mtext_write
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (mtext == NULL)
@@ -567,37 +526,37 @@ dxf_mtext_write
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if ((fp->acad_version_number < AutoCAD_13)
           && (fp->follow_strict_version_rules))
         {
                 fprintf (stderr,
-                  (_("Error in %s () illegal DXF version for this %s entity with id-code: %x.\n")),
+                  (_("Error in %s () illegal DXF version for this %s entity with id-code: %" PRIx64 ".\n")),
                   __FUNCTION__, dxf_entity_name, mtext->id_code);
                 return (EXIT_FAILURE);
         }
         else
         {
                 fprintf (stderr,
-                  (_("Warning in %s () illegal DXF version for this %s entity with id-code: %x.\n")),
+                  (_("Warning in %s () illegal DXF version for this %s entity with id-code: %" PRIx64 ".\n")),
                   __FUNCTION__, dxf_entity_name, mtext->id_code);
         }
         if (strcmp (mtext->linetype, "") == 0)
         {
                 fprintf (stderr,
-                  (_("Warning in %s () empty linetype string for the %s entity with id-code: %x\n")),
+                  (_("Warning in %s () empty linetype string for the %s entity with id-code: %" PRIx64 "\n")),
                   __FUNCTION__, dxf_entity_name, mtext->id_code);
                 fprintf (stderr,
                   (_("\t%s entity is reset to default linetype")),
                   dxf_entity_name);
-                mtext->linetype = strdup (DXF_DEFAULT_LINETYPE);
+                mtext->linetype = dxf_strdup (DXF_DEFAULT_LINETYPE);
         }
         if (strcmp (mtext->layer, "") == 0)
         {
                 fprintf (stderr,
-                  (_("Warning in %s () empty layer string for the %s entity with id-code: %x\n")),
+                  (_("Warning in %s () empty layer string for the %s entity with id-code: %" PRIx64 "\n")),
                   __FUNCTION__, dxf_entity_name, mtext->id_code);
                 fprintf (stderr,
                   (_("\t%s entity is relocated to layer 0")),
@@ -605,10 +564,10 @@ dxf_mtext_write
                 mtext->layer = DXF_DEFAULT_LAYER;
         }
         /* Start writing output. */
-        fprintf (fp->fp, "  0\n%s\n", dxf_entity_name);
-        if (mtext->id_code != -1)
+        dxf_write_string (fp, 0, dxf_entity_name);
+        if (mtext->id_code != DXF_HANDLE_NONE)
         {
-                fprintf (fp->fp, "  5\n%x\n", mtext->id_code);
+                dxf_write_hex (fp, 5, mtext->id_code);
         }
         /*!
          * \todo for version R14.\n
@@ -620,92 +579,93 @@ dxf_mtext_write
          * 102 groups are application defined (optional).\n\n
          * End of group, "}" (optional), with Group code 102.
          */
-        if ((strcmp (mtext->dictionary_owner_soft, "") != 0)
+        if ((mtext->dictionary_owner_soft != 0)
           && (fp->acad_version_number >= AutoCAD_14))
         {
-                fprintf (fp->fp, "102\n{ACAD_REACTORS\n");
-                fprintf (fp->fp, "330\n%s\n", mtext->dictionary_owner_soft);
-                fprintf (fp->fp, "102\n}\n");
+                dxf_write_string (fp, 102, "{ACAD_REACTORS");
+                dxf_write_hex (fp, 330, mtext->dictionary_owner_soft);
+                dxf_write_string (fp, 102, "}");
         }
-        if ((strcmp (mtext->dictionary_owner_hard, "") != 0)
+        if ((mtext->dictionary_owner_hard != 0)
           && (fp->acad_version_number >= AutoCAD_14))
         {
-                fprintf (fp->fp, "102\n{ACAD_XDICTIONARY\n");
-                fprintf (fp->fp, "360\n%s\n", mtext->dictionary_owner_hard);
-                fprintf (fp->fp, "102\n}\n");
+                dxf_write_string (fp, 102, "{ACAD_XDICTIONARY");
+                dxf_write_hex (fp, 360, mtext->dictionary_owner_hard);
+                dxf_write_string (fp, 102, "}");
         }
         if (fp->acad_version_number >= AutoCAD_13)
         {
-                fprintf (fp->fp, "100\nAcDbEntity\n");
+                dxf_write_string (fp, 100, "AcDbEntity");
         }
         if (mtext->paperspace == DXF_PAPERSPACE)
         {
-                fprintf (fp->fp, " 67\n%d\n", (int16_t) DXF_PAPERSPACE);
+                dxf_write_int (fp, 67, (int16_t) DXF_PAPERSPACE);
         }
-        fprintf (fp->fp, "  8\n%s\n", mtext->layer);
+        dxf_write_string (fp, 8, mtext->layer);
         if (strcmp (mtext->linetype, DXF_DEFAULT_LINETYPE) != 0)
         {
-                fprintf (fp->fp, "  6\n%s\n", mtext->linetype);
+                dxf_write_string (fp, 6, mtext->linetype);
         }
         if (mtext->color != DXF_COLOR_BYLAYER)
         {
-                fprintf (fp->fp, " 62\n%d\n", mtext->color);
+                dxf_write_int (fp, 62, mtext->color);
         }
         if ((fp->acad_version_number <= AutoCAD_11)
           && DXF_FLATLAND
           && (mtext->elevation != 0.0))
         {
-                fprintf (fp->fp, " 38\n%f\n", mtext->elevation);
+                dxf_write_double (fp, 38, mtext->elevation);
         }
         if (mtext->thickness != 0.0)
         {
-                fprintf (fp->fp, " 39\n%f\n", mtext->thickness);
+                dxf_write_double (fp, 39, mtext->thickness);
         }
         if (mtext->linetype_scale != 1.0)
         {
-                fprintf (fp->fp, " 48\n%f\n", mtext->linetype_scale);
+                dxf_write_double (fp, 48, mtext->linetype_scale);
         }
         if (mtext->visibility != 0)
         {
-                fprintf (fp->fp, " 60\n%d\n", mtext->visibility);
+                dxf_write_int (fp, 60, mtext->visibility);
         }
         if (fp->acad_version_number >= AutoCAD_13)
         {
-                fprintf (fp->fp, "100\nAcDbMText\n");
+                dxf_write_string (fp, 100, "AcDbMText");
         }
-        fprintf (fp->fp, " 10\n%f\n", mtext->p0->x0);
-        fprintf (fp->fp, " 20\n%f\n", mtext->p0->y0);
-        fprintf (fp->fp, " 30\n%f\n", mtext->p0->z0);
-        fprintf (fp->fp, " 40\n%f\n", mtext->height);
-        fprintf (fp->fp, " 41\n%f\n", mtext->rectangle_width);
-        fprintf (fp->fp, " 71\n%d\n", mtext->attachment_point);
-        fprintf (fp->fp, " 72\n%d\n", mtext->drawing_direction);
-        fprintf (fp->fp, "  1\n%s\n", mtext->text_value);
+        dxf_write_double (fp, 10, mtext->p0->x0);
+        dxf_write_double (fp, 20, mtext->p0->y0);
+        dxf_write_double (fp, 30, mtext->p0->z0);
+        dxf_write_double (fp, 40, mtext->height);
+        dxf_write_double (fp, 41, mtext->rectangle_width);
+        dxf_write_int (fp, 71, mtext->attachment_point);
+        dxf_write_int (fp, 72, mtext->drawing_direction);
+        dxf_write_string (fp, 1, mtext->text_value);
         i = 0;
-        while (strlen (mtext->text_additional_value[i]) > 0)
+        while ((i < DXF_MAX_PARAM)
+          && (strlen (mtext->text_additional_value[i]) > 0))
         {
-                fprintf (fp->fp, "  3\n%s\n", mtext->text_additional_value[i]);
+                dxf_write_string (fp, 3, mtext->text_additional_value[i]);
                 i++;
         }
-        fprintf (fp->fp, "  7\n%s\n", mtext->text_style);
+        dxf_write_string (fp, 7, mtext->text_style);
 
         if ((fp->acad_version_number >= AutoCAD_12)
                 && (mtext->extr_x0 != 0.0)
                 && (mtext->extr_y0 != 0.0)
                 && (mtext->extr_z0 != 1.0))
         {
-                fprintf (fp->fp, "210\n%f\n", mtext->extr_x0);
-                fprintf (fp->fp, "220\n%f\n", mtext->extr_y0);
-                fprintf (fp->fp, "230\n%f\n", mtext->extr_z0);
+                dxf_write_double (fp, 210, mtext->extr_x0);
+                dxf_write_double (fp, 220, mtext->extr_y0);
+                dxf_write_double (fp, 230, mtext->extr_z0);
         }
-        fprintf (fp->fp, " 11\n%f\n", mtext->p1->x0);
-        fprintf (fp->fp, " 21\n%f\n", mtext->p1->y0);
-        fprintf (fp->fp, " 31\n%f\n", mtext->p1->z0);
-        fprintf (fp->fp, " 42\n%f\n", mtext->horizontal_width);
-        fprintf (fp->fp, " 43\n%f\n", mtext->rectangle_height);
-        fprintf (fp->fp, " 50\n%f\n", mtext->rot_angle);
+        dxf_write_double (fp, 11, mtext->p1->x0);
+        dxf_write_double (fp, 21, mtext->p1->y0);
+        dxf_write_double (fp, 31, mtext->p1->z0);
+        dxf_write_double (fp, 42, mtext->horizontal_width);
+        dxf_write_double (fp, 43, mtext->rectangle_height);
+        dxf_write_double (fp, 50, mtext->rot_angle);
         /* Clean up. */
-        free (dxf_entity_name);
+        dxf_free (dxf_entity_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -747,18 +707,16 @@ dxf_mtext_free
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        free (mtext->linetype);
-        free (mtext->layer);
-        free (mtext->text_value);
+        dxf_string_free (mtext->linetype);
+        dxf_string_free (mtext->layer);
+        dxf_free (mtext->text_value);
         for (i = 0; i < DXF_MAX_PARAM; i++)
         {
-                free (mtext->text_additional_value[i]);
+                dxf_free (mtext->text_additional_value[i]);
         }
-        free (mtext->text_style);
-        free (mtext->dictionary_owner_soft);
-        free (mtext->dictionary_owner_hard);
-        free (mtext->background_color_name);
-        free (mtext);
+        dxf_string_free (mtext->text_style);
+        dxf_free (mtext->background_color_name);
+        dxf_free (mtext);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -804,7 +762,7 @@ dxf_mtext_free_list
  *
  * \return \c id_code.
  */
-int
+uint64_t
 dxf_mtext_get_id_code
 (
         DxfMtext *mtext
@@ -822,13 +780,6 @@ dxf_mtext_get_id_code
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (mtext->id_code < 0)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a negative value was found.\n")),
-                  __FUNCTION__);
-                return (EXIT_FAILURE);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -844,7 +795,7 @@ dxf_mtext_set_id_code
 (
         DxfMtext *mtext,
                 /*!< a pointer to a DXF \c MTEXT entity. */
-        int id_code
+        uint64_t id_code
                 /*!< Identification number for the entity.\n
                  * This is to be an unique (sequential) number in the DXF
                  * file. */
@@ -861,13 +812,6 @@ dxf_mtext_set_id_code
                   __FUNCTION__);
                 return (NULL);
         }
-        if (id_code < 0)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a negative value was passed.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
         mtext->id_code = id_code;
 #if DEBUG
         DXF_DEBUG_END
@@ -909,7 +853,7 @@ dxf_mtext_get_linetype
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (mtext->linetype));
+        return (dxf_strdup (mtext->linetype));
 }
 
 
@@ -943,7 +887,7 @@ dxf_mtext_set_linetype
                   __FUNCTION__);
                 return (NULL);
         }
-        mtext->linetype = strdup (linetype);
+        mtext->linetype = dxf_strdup (linetype);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -984,7 +928,7 @@ dxf_mtext_get_layer
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (mtext->layer));
+        return (dxf_strdup (mtext->layer));
 }
 
 
@@ -1018,7 +962,7 @@ dxf_mtext_set_layer
                   __FUNCTION__);
                 return (NULL);
         }
-        mtext->layer = strdup (layer);
+        mtext->layer = dxf_strdup (layer);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1754,11 +1698,9 @@ dxf_mtext_set_binary_graphics_data
  * \brief Get the pointer to the \c dictionary_owner_soft from a DXF 
  * \c MTEXT entity.
  *
- * \return pointer to the \c dictionary_owner_soft.
- *
- * \warning No checks are performed on the returned pointer (string).
+ * \return the handle of the \c dictionary_owner_soft.
  */
-char *
+uint64_t
 dxf_mtext_get_dictionary_owner_soft
 (
         DxfMtext *mtext
@@ -1774,19 +1716,12 @@ dxf_mtext_get_dictionary_owner_soft
                 fprintf (stderr,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
-                return (NULL);
-        }
-        if (mtext->dictionary_owner_soft ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
+                return (0);
         }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (mtext->dictionary_owner_soft));
+        return (mtext->dictionary_owner_soft);
 }
 
 
@@ -1799,8 +1734,8 @@ dxf_mtext_set_dictionary_owner_soft
 (
         DxfMtext *mtext,
                 /*!< a pointer to a DXF \c MTEXT entity. */
-        char *dictionary_owner_soft
-                /*!< a string containing the pointer to the
+        uint64_t dictionary_owner_soft
+                /*!< the handle of the
                  * dictionary_owner_soft for the entity. */
 )
 {
@@ -1815,14 +1750,7 @@ dxf_mtext_set_dictionary_owner_soft
                   __FUNCTION__);
                 return (NULL);
         }
-        if (dictionary_owner_soft == NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was passed.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
-        mtext->dictionary_owner_soft = strdup (dictionary_owner_soft);
+        mtext->dictionary_owner_soft = dictionary_owner_soft;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1833,12 +1761,10 @@ dxf_mtext_set_dictionary_owner_soft
 /*!
  * \brief Get the pointer to the \c material from a DXF \c MTEXT entity.
  *
- * \return a pointer to \c material when successful, or \c NULL when an
+ * \return the handle \c material when successful, or 0 when an
  * error occurred.
- *
- * \warning No checks are performed on the returned pointer.
  */
-char *
+uint64_t
 dxf_mtext_get_material
 (
         DxfMtext *mtext
@@ -1854,19 +1780,12 @@ dxf_mtext_get_material
                 fprintf (stderr,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
-                return (NULL);
-        }
-        if (mtext->material ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
+                return (0);
         }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (mtext->material));
+        return (mtext->material);
 }
 
 
@@ -1881,8 +1800,8 @@ dxf_mtext_set_material
 (
         DxfMtext *mtext,
                 /*!< a pointer to a DXF \c MTEXT entity. */
-        char *material
-                /*!< a string containing the pointer to the \c
+        uint64_t material
+                /*!< the handle of the \c
                  * material for the entity. */
 )
 {
@@ -1897,14 +1816,7 @@ dxf_mtext_set_material
                   __FUNCTION__);
                 return (NULL);
         }
-        if (material == NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was passed.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
-        mtext->material = strdup (material);
+        mtext->material = material;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1917,10 +1829,8 @@ dxf_mtext_set_material
  * \c MTEXT entity.
  *
  * \return hard pointer to the dictionary owner.
- *
- * \warning No checks are performed on the returned pointer (string).
  */
-char *
+uint64_t
 dxf_mtext_get_dictionary_owner_hard
 (
         DxfMtext *mtext
@@ -1936,19 +1846,12 @@ dxf_mtext_get_dictionary_owner_hard
                 fprintf (stderr,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
-                return (NULL);
-        }
-        if (mtext->dictionary_owner_hard ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
+                return (0);
         }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (mtext->dictionary_owner_hard));
+        return (mtext->dictionary_owner_hard);
 }
 
 
@@ -1961,8 +1864,8 @@ dxf_mtext_set_dictionary_owner_hard
 (
         DxfMtext *mtext,
                 /*!< a pointer to a DXF \c MTEXT entity. */
-        char *dictionary_owner_hard
-                /*!< a string containing the pointer to the
+        uint64_t dictionary_owner_hard
+                /*!< the handle of the
                  * dictionary_owner_hard for the entity. */
 )
 {
@@ -1977,14 +1880,7 @@ dxf_mtext_set_dictionary_owner_hard
                   __FUNCTION__);
                 return (NULL);
         }
-        if (dictionary_owner_hard == NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was passed.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
-        mtext->dictionary_owner_hard = strdup (dictionary_owner_hard);
+        mtext->dictionary_owner_hard = dictionary_owner_hard;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2060,10 +1956,10 @@ dxf_mtext_set_lineweight
 /*!
  * \brief Get the \c plot_style_name from a DXF \c MTEXT entity.
  *
- * \return a pointer to \c plot_style_name when sucessful, or \c NULL
+ * \return the handle \c plot_style_name when sucessful, or 0
  * when an error occurred.
  */
-char *
+uint64_t
 dxf_mtext_get_plot_style_name
 (
         DxfMtext *mtext
@@ -2079,19 +1975,12 @@ dxf_mtext_get_plot_style_name
                 fprintf (stderr,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
-                return (NULL);
-        }
-        if (mtext->plot_style_name ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
+                return (0);
         }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (mtext->plot_style_name));
+        return (mtext->plot_style_name);
 }
 
 
@@ -2106,7 +1995,7 @@ dxf_mtext_set_plot_style_name
 (
         DxfMtext *mtext,
                 /*!< a pointer to a DXF \c MTEXT entity. */
-        char *plot_style_name
+        uint64_t plot_style_name
                 /*!< a string containing the \c plot_style_name for the
                  * entity. */
 )
@@ -2122,14 +2011,7 @@ dxf_mtext_set_plot_style_name
                   __FUNCTION__);
                 return (NULL);
         }
-        if (plot_style_name == NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was passed.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
-        mtext->plot_style_name = strdup (plot_style_name);
+        mtext->plot_style_name = plot_style_name;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2236,7 +2118,7 @@ dxf_mtext_get_color_name
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (mtext->color_name));
+        return (dxf_strdup (mtext->color_name));
 }
 
 
@@ -2274,7 +2156,7 @@ dxf_mtext_set_color_name
                   __FUNCTION__);
                 return (NULL);
         }
-        mtext->color_name = strdup (color_name);
+        mtext->color_name = dxf_strdup (color_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2381,7 +2263,7 @@ dxf_mtext_get_text_value
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (mtext->text_value));
+        return (dxf_strdup (mtext->text_value));
 }
 
 
@@ -2419,7 +2301,7 @@ dxf_mtext_set_text_value
                   __FUNCTION__);
                 return (NULL);
         }
-        mtext->text_value = strdup (text_value);
+        mtext->text_value = dxf_strdup (text_value);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2461,7 +2343,7 @@ dxf_mtext_get_text_style
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (mtext->text_style));
+        return (dxf_strdup (mtext->text_style));
 }
 
 
@@ -2499,7 +2381,7 @@ dxf_mtext_set_text_style
                   __FUNCTION__);
                 return (NULL);
         }
-        mtext->text_style = strdup (text_style);
+        mtext->text_style = dxf_strdup (text_style);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -4998,7 +4880,7 @@ dxf_mtext_get_background_color_name
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (mtext->background_color_name));
+        return (dxf_strdup (mtext->background_color_name));
 }
 
 
@@ -5036,7 +4918,7 @@ dxf_mtext_set_background_color_name
                   __FUNCTION__);
                 return (NULL);
         }
-        mtext->background_color_name = strdup (background_color_name);
+        mtext->background_color_name = dxf_strdup (background_color_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -5230,4 +5112,261 @@ dxf_mtext_get_last
 }
 
 
+/*!
+ * \brief Get the bounding box of a DXF \c MTEXT.
+ *
+ * An approximate box of \c mtext: every character is taken to be a
+ * square of the text height, lines (separated by "\\P") are 5/3 of
+ * the text height apart times the line spacing factor.\n
+ * The width of the characters (group code 42) or the reference
+ * rectangle width (group code 41) is used when known, the box is
+ * placed according to the attachment point and turned in the text
+ * direction, in the plane of the extrusion direction.\n
+ * The insertion point and the X-axis direction vector are in world
+ * coordinates, a rotation angle is taken in the Object Coordinate
+ * System (OCS), see dxf_transform_set_ocs ().\n
+ * \todo Take formatting codes and columns into account.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_mtext_get_bbox
+(
+        DxfMtext *mtext,
+                /*!< a pointer to a DXF \c MTEXT entity. */
+        DxfBbox *bbox
+                /*!< a pointer to the libDXF bounding box to fill. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        const char *value;
+        DxfTransform ocs;
+        DxfVec3 extrusion;
+        DxfVec3 x_axis;
+        DxfVec3 y_axis;
+        size_t length = 0;
+        size_t longest = 0;
+        size_t lines = 1;
+        double width;
+        double height;
+        double angle;
+        double length_x;
+        double dx;
+        double dy;
+        double u;
+        double v;
+        int column;
+        int row;
+        int i;
+
+        /* Do some basic checks. */
+        if ((mtext == NULL) || (bbox == NULL))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        if (mtext->p0 == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer to the insertion point was found.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        /* The additional text chunks (group code 3) come before the
+         * text value (group code 1). */
+        for (i = 0; i <= DXF_MAX_PARAM; i++)
+        {
+                value = (i < DXF_MAX_PARAM) ? mtext->text_additional_value[i] : mtext->text_value;
+                for (; (value != NULL) && (*value != '\0'); value++)
+                {
+                        if ((value[0] == '\\') && (value[1] == 'P'))
+                        {
+                                lines++;
+                                length = 0;
+                                value++;
+                                continue;
+                        }
+                        length++;
+                        if (length > longest)
+                        {
+                                longest = length;
+                        }
+                }
+        }
+        if (mtext->horizontal_width > 0.0)
+        {
+                width = mtext->horizontal_width;
+        }
+        else if (mtext->rectangle_width > 0.0)
+        {
+                width = mtext->rectangle_width;
+        }
+        else
+        {
+                width = longest * fabs (mtext->height);
+        }
+        if (mtext->rectangle_height > 0.0)
+        {
+                height = mtext->rectangle_height;
+        }
+        else
+        {
+                height = fabs (mtext->height) * (1.0 + ((lines - 1) * 5.0 / 3.0
+                  * ((mtext->spacing_factor > 0.0) ? mtext->spacing_factor : 1.0)));
+        }
+        extrusion.x = mtext->extr_x0;
+        extrusion.y = mtext->extr_y0;
+        extrusion.z = mtext->extr_z0;
+        dxf_transform_set_ocs (&ocs, &extrusion);
+        length_x = (mtext->p1 != NULL)
+          ? sqrt ((mtext->p1->x0 * mtext->p1->x0)
+          + (mtext->p1->y0 * mtext->p1->y0)
+          + (mtext->p1->z0 * mtext->p1->z0))
+          : 0.0;
+        if (length_x > 0.0)
+        {
+                /* The X-axis direction vector is in world
+                 * coordinates. */
+                x_axis.x = mtext->p1->x0 / length_x;
+                x_axis.y = mtext->p1->y0 / length_x;
+                x_axis.z = mtext->p1->z0 / length_x;
+        }
+        else
+        {
+                angle = mtext->rot_angle;
+                x_axis.x = (cos (angle) * ocs.m[0][0]) + (sin (angle) * ocs.m[0][1]);
+                x_axis.y = (cos (angle) * ocs.m[1][0]) + (sin (angle) * ocs.m[1][1]);
+                x_axis.z = (cos (angle) * ocs.m[2][0]) + (sin (angle) * ocs.m[2][1]);
+        }
+        /* The Y-axis is the extrusion direction cross the X-axis. */
+        y_axis.x = (ocs.m[1][2] * x_axis.z) - (ocs.m[2][2] * x_axis.y);
+        y_axis.y = (ocs.m[2][2] * x_axis.x) - (ocs.m[0][2] * x_axis.z);
+        y_axis.z = (ocs.m[0][2] * x_axis.y) - (ocs.m[1][2] * x_axis.x);
+        /* Attachment points 1 to 9 run left to right, top to bottom. */
+        column = ((mtext->attachment_point >= 1) && (mtext->attachment_point <= 9))
+          ? (mtext->attachment_point - 1) % 3 : 0;
+        row = ((mtext->attachment_point >= 1) && (mtext->attachment_point <= 9))
+          ? (mtext->attachment_point - 1) / 3 : 0;
+        dx = -width * column / 2.0;
+        dy = -height * (2 - row) / 2.0;
+        dxf_bbox_init (bbox);
+        for (i = 0; i < 4; i++)
+        {
+                u = dx + (((i == 1) || (i == 2)) ? width : 0.0);
+                v = dy + ((i >= 2) ? height : 0.0);
+                dxf_bbox_add_point (bbox,
+                  mtext->p0->x0 + (u * x_axis.x) + (v * y_axis.x),
+                  mtext->p0->y0 + (u * x_axis.y) + (v * y_axis.y),
+                  mtext->p0->z0 + (u * x_axis.z) + (v * y_axis.z));
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Transform a DXF \c MTEXT entity in place.
+ *
+ * The insertion point and the X-axis direction vector of \c mtext are
+ * in world coordinates, the text lies in the plane of the extrusion
+ * direction.  \c transform has to map this plane with a uniform scale,
+ * see dxf_transform_get_ocs_transform ().\n
+ * Without an X-axis direction vector the rotation angle, in the
+ * Object Coordinate System (OCS), is turned with the plane.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred, or when \c transform does not map the entity without
+ * distortion.
+ */
+int
+dxf_mtext_transform
+(
+        DxfMtext *mtext,
+                /*!< a pointer to a DXF \c MTEXT entity. */
+        DxfTransform *transform
+                /*!< a pointer to a libDXF affine transformation. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfTransform ocs;
+        DxfVec3 extrusion;
+        DxfVec3 point;
+        double scale;
+        double length;
+
+        /* Do some basic checks. */
+        if ((mtext == NULL) || (transform == NULL))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        if (mtext->p0 == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer to the insertion point was found.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        extrusion.x = mtext->extr_x0;
+        extrusion.y = mtext->extr_y0;
+        extrusion.z = mtext->extr_z0;
+        if (dxf_transform_get_ocs_transform (transform, &extrusion, &ocs, &scale) == EXIT_FAILURE)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () the transformation distorts the MTEXT entity with id-code: %" PRIx64 "\n")),
+                  __FUNCTION__, mtext->id_code);
+                return (EXIT_FAILURE);
+        }
+        point.x = mtext->p0->x0;
+        point.y = mtext->p0->y0;
+        point.z = mtext->p0->z0;
+        dxf_transform_apply_point (transform, &point, &point);
+        mtext->p0->x0 = point.x;
+        mtext->p0->y0 = point.y;
+        mtext->p0->z0 = point.z;
+        if ((mtext->p1 != NULL)
+          && ((mtext->p1->x0 != 0.0) || (mtext->p1->y0 != 0.0) || (mtext->p1->z0 != 0.0)))
+        {
+                point.x = mtext->p1->x0;
+                point.y = mtext->p1->y0;
+                point.z = mtext->p1->z0;
+                dxf_transform_apply_vector (transform, &point, &point);
+                length = sqrt ((point.x * point.x) + (point.y * point.y) + (point.z * point.z));
+                mtext->p1->x0 = point.x / length;
+                mtext->p1->y0 = point.y / length;
+                mtext->p1->z0 = point.z / length;
+        }
+        else
+        {
+                mtext->rot_angle += atan2 (ocs.m[1][0], ocs.m[0][0]);
+        }
+        mtext->height *= scale;
+        mtext->rectangle_width *= scale;
+        mtext->horizontal_width *= scale;
+        mtext->rectangle_height *= scale;
+        mtext->column_width *= scale;
+        mtext->column_gutter *= scale;
+        mtext->column_heights *= scale;
+        mtext->extr_x0 = extrusion.x;
+        mtext->extr_y0 = extrusion.y;
+        mtext->extr_z0 = extrusion.z;
+        mtext->thickness *= ocs.m[2][2];
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (EXIT_SUCCESS);
+}
+
+
 /* EOF */
@@ -48,6 +48,7 @@
 #include "global.h"
 #include "point.h"
 #include "binary_graphics_data.h"
+#include "transform.h"
 
 
 #ifdef __cplusplus
@@ -62,7 +63,7 @@ typedef struct
 dxf_mtext_struct
 {
         /* Members common for all DXF drawable entities. */
-        int id_code;
+        uint64_t id_code;
                 /*!< Identification code for the entity.\n
                  * This is to be an unique sequential code in the DXF
                  * file (the number can be hexadecimal).\n
@@ -135,16 +136,16 @@ dxf_mtext_struct
                  * (optional).\n
                  * Group code = 310.\n
                  * \since Introduced in version R2000. */
-        char *dictionary_owner_soft;
+        uint64_t dictionary_owner_soft;
                 /*!< Soft-pointer ID/handle to owner dictionary (optional).\n
                  * Group code = 330.\n
                  * \since Introduced in version R14. */
-        char *material;
+        uint64_t material;
                 /*!< Hard-pointer ID/handle to material object (present if
                  * not BYLAYER).\n
                  * Group code = 347.\n
                  * \since Introduced in version R2008. */
-        char *dictionary_owner_hard;
+        uint64_t dictionary_owner_hard;
                 /*!< Hard owner ID/handle to owner dictionary (optional).\n
                  * Group code = 360.\n
                  * \since Introduced in version R14. */
@@ -153,7 +154,7 @@ dxf_mtext_struct
                  * Stored and moved around as a 16-bit integer.\n
                  * Group code = 370.\n
                  * \since Introduced in version R2002. */
-        char *plot_style_name;
+        uint64_t plot_style_name;
                 /*!< Hard pointer ID / handle of PlotStyleName object.\n
                  * Group code = 390.\n
                  * \since Introduced in version R2009. */
@@ -352,8 +353,8 @@ DxfMtext *dxf_mtext_read (DxfFile *fp, DxfMtext *mtext);
 int dxf_mtext_write (DxfFile *fp, DxfMtext *mtext);
 int dxf_mtext_free (DxfMtext *mtext);
 void dxf_mtext_free_list (DxfMtext *mtexts);
-int dxf_mtext_get_id_code (DxfMtext *mtext);
-DxfMtext *dxf_mtext_set_id_code (DxfMtext *mtext, int id_code);
+uint64_t dxf_mtext_get_id_code (DxfMtext *mtext);
+DxfMtext *dxf_mtext_set_id_code (DxfMtext *mtext, uint64_t id_code);
 char *dxf_mtext_get_linetype (DxfMtext *mtext);
 DxfMtext *dxf_mtext_set_linetype (DxfMtext *mtext, char *linetype);
 char *dxf_mtext_get_layer (DxfMtext *mtext);
@@ -376,16 +377,16 @@ int16_t dxf_mtext_get_shadow_mode (DxfMtext *mtext);
 DxfMtext *dxf_mtext_set_shadow_mode (DxfMtext *mtext, int16_t shadow_mode);
 DxfBinaryGraphicsData *dxf_mtext_get_binary_graphics_data (DxfMtext *mtext);
 DxfMtext *dxf_mtext_set_binary_graphics_data (DxfMtext *mtext, DxfBinaryGraphicsData *data);
-char *dxf_mtext_get_dictionary_owner_soft (DxfMtext *mtext);
-DxfMtext *dxf_mtext_set_dictionary_owner_soft (DxfMtext *mtext, char *dictionary_owner_soft);
-char *dxf_mtext_get_material (DxfMtext *mtext);
-DxfMtext *dxf_mtext_set_material (DxfMtext *mtext, char *material);
-char *dxf_mtext_get_dictionary_owner_hard (DxfMtext *mtext);
-DxfMtext *dxf_mtext_set_dictionary_owner_hard (DxfMtext *mtext, char *dictionary_owner_hard);
+uint64_t dxf_mtext_get_dictionary_owner_soft (DxfMtext *mtext);
+DxfMtext *dxf_mtext_set_dictionary_owner_soft (DxfMtext *mtext, uint64_t dictionary_owner_soft);
+uint64_t dxf_mtext_get_material (DxfMtext *mtext);
+DxfMtext *dxf_mtext_set_material (DxfMtext *mtext, uint64_t material);
+uint64_t dxf_mtext_get_dictionary_owner_hard (DxfMtext *mtext);
+DxfMtext *dxf_mtext_set_dictionary_owner_hard (DxfMtext *mtext, uint64_t dictionary_owner_hard);
 int16_t dxf_mtext_get_lineweight (DxfMtext *mtext);
 DxfMtext *dxf_mtext_set_lineweight (DxfMtext *mtext, int16_t lineweight);
-char *dxf_mtext_get_plot_style_name (DxfMtext *mtext);
-DxfMtext *dxf_mtext_set_plot_style_name (DxfMtext *mtext, char *plot_style_name);
+uint64_t dxf_mtext_get_plot_style_name (DxfMtext *mtext);
+DxfMtext *dxf_mtext_set_plot_style_name (DxfMtext *mtext, uint64_t plot_style_name);
 long dxf_mtext_get_color_value (DxfMtext *mtext);
 DxfMtext *dxf_mtext_set_color_value (DxfMtext *mtext, long color_value);
 char *dxf_mtext_get_color_name (DxfMtext *mtext);
@@ -467,6 +468,8 @@ DxfMtext *dxf_mtext_set_background_transparency (DxfMtext *mtext, int32_t backgr
 DxfMtext *dxf_mtext_get_next (DxfMtext *mtext);
 DxfMtext *dxf_mtext_set_next (DxfMtext *mtext, DxfMtext *next);
 DxfMtext *dxf_mtext_get_last (DxfMtext *mtext);
+int dxf_mtext_get_bbox (DxfMtext *mtext, DxfBbox *bbox);
+int dxf_mtext_transform (DxfMtext *mtext, DxfTransform *transform);
 
 
 #ifdef __cplusplus
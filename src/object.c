@@ -53,7 +53,7 @@ dxf_object_new ()
         size = sizeof (DxfObject);
         /* avoid malloc of 0 bytes */
         if (size == 0) size = 1;
-        if ((object = malloc (size)) == NULL)
+        if ((object = dxf_malloc (size)) == NULL)
         {
                 fprintf (stderr,
                   (_("Error in %s () could not allocate memory for a DxfObject struct.\n")),
@@ -176,7 +176,7 @@ dxf_object_free
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        free (object);
+        dxf_free (object);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -53,7 +53,7 @@ dxf_object_id_new ()
         size = sizeof (DxfObjectId);
         /* avoid malloc of 0 bytes */
         if (size == 0) size = 1;
-        if ((object_id = malloc (size)) == NULL)
+        if ((object_id = dxf_malloc (size)) == NULL)
         {
                 fprintf (stderr,
                   (_("Error in %s () could not allocate memory for a DxfObjectId struct.\n")),
@@ -103,7 +103,7 @@ dxf_object_id_init
                 __FUNCTION__);
               return (NULL);
         }
-        object_id->data = strdup ("");
+        object_id->data = dxf_strdup ("");
         object_id->next = NULL;
 #if DEBUG
         DXF_DEBUG_END
@@ -145,8 +145,8 @@ dxf_object_id_free
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        free (object_id->data);
-        free (object_id);
+        dxf_free (object_id->data);
+        dxf_free (object_id);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -304,7 +304,7 @@ dxf_object_id_get_data
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (object_id->data));
+        return (dxf_strdup (object_id->data));
 }
 
 
@@ -338,7 +338,7 @@ dxf_object_id_set_data
                   __FUNCTION__);
                 return (NULL);
         }
-        object_id->data = strdup (data);
+        object_id->data = dxf_strdup (data);
 #if DEBUG
         DXF_DEBUG_END
 #endif
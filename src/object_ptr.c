@@ -42,6 +42,7 @@
 
 
 #include "object_ptr.h"
+#include "util.h"
 
 
 /*!
@@ -61,7 +62,7 @@ dxf_object_ptr_new ()
         size = sizeof (DxfObjectPtr);
         /* avoid malloc of 0 bytes */
         if (size == 0) size = 1;
-        if ((object_ptr = malloc (size)) == NULL)
+        if ((object_ptr = dxf_malloc (size)) == NULL)
         {
                 fprintf (stderr,
                   (_("Error in %s () could not allocate memory for a DxfObjectPtr struct.\n")),
@@ -111,9 +112,9 @@ dxf_object_ptr_init
                   __FUNCTION__);
                 return (NULL);
         }
-        object_ptr->id_code = 0;
-        object_ptr->dictionary_owner_soft = strdup ("");
-        object_ptr->dictionary_owner_hard = strdup ("");
+        object_ptr->id_code = DXF_HANDLE_NONE;
+        object_ptr->dictionary_owner_soft = 0;
+        object_ptr->dictionary_owner_hard = 0;
         object_ptr->xdata->value = NULL;
         object_ptr->xdata->length = 0;
         object_ptr->xdata->next = NULL;
@@ -148,7 +149,8 @@ dxf_object_ptr_read
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        char *temp_string = NULL;
+        char temp_string[DXF_MAX_STRING_LENGTH];
+        int group_code;
 
         /* Do some basic checks. */
         if (fp == NULL)
@@ -156,8 +158,6 @@ dxf_object_ptr_read
                 fprintf (stderr,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
-                /* Clean up. */
-                free (temp_string);
                 return (NULL);
         }
         if (fp->acad_version_number < AutoCAD_14)
@@ -173,66 +173,55 @@ dxf_object_ptr_read
                   __FUNCTION__);
                 object_ptr = dxf_object_ptr_init (object_ptr);
         }
-        (fp->line_number)++;
-        fscanf (fp->fp, "%[^\n]", temp_string);
-        while (strcmp (temp_string, "0") != 0)
+        while ((dxf_read_group_code (fp, &group_code) == EXIT_SUCCESS)
+          && (group_code != 0))
         {
-                if (ferror (fp->fp))
+                if (dxf_read_error (fp))
                 {
                         fprintf (stderr,
                           (_("Error in %s () while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
                         /* Clean up. */
-                        free (temp_string);
-                        fclose (fp->fp);
                         return (NULL);
                 }
-                if (strcmp (temp_string, "5") == 0)
-                {
-                        /* Now follows a string containing a sequential
-                         * id number. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%x\n", (uint *) &object_ptr->id_code);
-                }
-                else if (strcmp (temp_string, "330") == 0)
-                {
-                        /* Now follows a string containing Soft-pointer
-                         * ID/handle to owner dictionary. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, object_ptr->dictionary_owner_soft);
-                }
-                else if (strcmp (temp_string, "360") == 0)
-                {
-                        /* Now follows a string containing Hard owner
-                         * ID/handle to owner dictionary. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, object_ptr->dictionary_owner_hard);
-                }
-                else if (strcmp (temp_string, "999") == 0)
+                switch (group_code)
                 {
-                        /* Now follows a string containing a comment. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
-                        fprintf (stdout, (_("DXF comment: %s\n")), temp_string);
-                }
-                else if (strcmp (temp_string, "1001") == 0)
-                {
-                        /* Now follows a string containing extended data. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, object_ptr->xdata->value);
-                        object_ptr->xdata->length = strlen (object_ptr->xdata->value);
-                        /*! \todo Set pointer to xdata->next for
-                         * following xdata object. */
-                }
-                else
-                {
-                        fprintf (stderr,
-                          (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
-                          __FUNCTION__, fp->filename, fp->line_number);
+                        case 5:
+                                /* Now follows a string containing a sequential
+                                 * id number. */
+                                dxf_read_handle (fp, &object_ptr->id_code);
+                                break;
+                        case 330:
+                                /* Now follows a string containing Soft-pointer
+                                 * ID/handle to owner dictionary. */
+                                dxf_read_handle (fp, &object_ptr->dictionary_owner_soft);
+                                break;
+                        case 360:
+                                /* Now follows a string containing Hard owner
+                                 * ID/handle to owner dictionary. */
+                                dxf_read_handle (fp, &object_ptr->dictionary_owner_hard);
+                                break;
+                        case 999:
+                                /* Now follows a string containing a comment. */
+                                dxf_read_line (temp_string, fp);
+                                fprintf (stdout, (_("DXF comment: %s\n")), temp_string);
+                                break;
+                        case 1001:
+                                /* Now follows a string containing extended data. */
+                                dxf_read_string (fp, &object_ptr->xdata->value);
+                                object_ptr->xdata->length = strlen (object_ptr->xdata->value);
+                                /*! \todo Set pointer to xdata->next for
+                                 * following xdata object. */
+                                break;
+                        default:
+                                fprintf (stderr,
+                                  (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
+                                  __FUNCTION__, fp->filename, fp->line_number);
+                                /* Skip the value of the unknown group code. */
+                                dxf_read_line (temp_string, fp);
+                                break;
                 }
         }
-        /* Clean up. */
-        free (temp_string);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -258,7 +247,7 @@ dxf_object_ptr_write
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        char *dxf_entity_name = strdup ("OBJECT_PTR");
+        char *dxf_entity_name = dxf_strdup ("OBJECT_PTR");
 
         /* Do some basic checks. */
         if (fp == NULL)
@@ -267,7 +256,7 @@ dxf_object_ptr_write
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (object_ptr == NULL)
@@ -276,20 +265,20 @@ dxf_object_ptr_write
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (fp->acad_version_number < AutoCAD_14)
         {
                 fprintf (stderr,
-                  (_("Warning in %s () illegal DXF version for this %s entity with id-code: %x.\n")),
+                  (_("Warning in %s () illegal DXF version for this %s entity with id-code: %" PRIx64 ".\n")),
                   __FUNCTION__, dxf_entity_name, object_ptr->id_code);
         }
         /* Start writing output. */
-        fprintf (fp->fp, "  0\n%s\n", dxf_entity_name);
-        if (object_ptr->id_code != -1)
+        dxf_write_string (fp, 0, dxf_entity_name);
+        if (object_ptr->id_code != DXF_HANDLE_NONE)
         {
-                fprintf (fp->fp, "  5\n%x\n", object_ptr->id_code);
+                dxf_write_hex (fp, 5, object_ptr->id_code);
         }
         /*!
          * \todo for version R14.\n
@@ -301,27 +290,27 @@ dxf_object_ptr_write
          * 102 groups are application defined (optional).\n\n
          * End of group, "}" (optional), with Group code 102.
          */
-        if ((strcmp (object_ptr->dictionary_owner_soft, "") != 0)
+        if ((object_ptr->dictionary_owner_soft != 0)
           && (fp->acad_version_number >= AutoCAD_14))
         {
-                fprintf (fp->fp, "102\n{ACAD_REACTORS\n");
-                fprintf (fp->fp, "330\n%s\n", object_ptr->dictionary_owner_soft);
-                fprintf (fp->fp, "102\n}\n");
+                dxf_write_string (fp, 102, "{ACAD_REACTORS");
+                dxf_write_hex (fp, 330, object_ptr->dictionary_owner_soft);
+                dxf_write_string (fp, 102, "}");
         }
-        if ((strcmp (object_ptr->dictionary_owner_hard, "") != 0)
+        if ((object_ptr->dictionary_owner_hard != 0)
           && (fp->acad_version_number >= AutoCAD_14))
         {
-                fprintf (fp->fp, "102\n{ACAD_XDICTIONARY\n");
-                fprintf (fp->fp, "360\n%s\n", object_ptr->dictionary_owner_hard);
-                fprintf (fp->fp, "102\n}\n");
+                dxf_write_string (fp, 102, "{ACAD_XDICTIONARY");
+                dxf_write_hex (fp, 360, object_ptr->dictionary_owner_hard);
+                dxf_write_string (fp, 102, "}");
         }
         while (object_ptr->xdata->value != NULL)
         {
-                fprintf (fp->fp, "1001\n%s\n", object_ptr->xdata->value);
+                dxf_write_string (fp, 1001, object_ptr->xdata->value);
                 /*! \todo Write the complete linked list of char values. */
         }
         /* Clean up. */
-        free (dxf_entity_name);
+        dxf_free (dxf_entity_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -369,11 +358,11 @@ dxf_object_ptr_free
                 iter = (struct DxfChar *) object_ptr->xdata->next;
                 if (object_ptr->xdata->value)
                 {
-                        free (object_ptr->xdata->value);
+                        dxf_free (object_ptr->xdata->value);
                 }
                 if (object_ptr->xdata)
                 {
-                        free (object_ptr->xdata);
+                        dxf_free (object_ptr->xdata);
                 }
                 if (iter != NULL)
                 {
@@ -382,19 +371,17 @@ dxf_object_ptr_free
         }
         if (object_ptr->dictionary_owner_soft)
         {
-                free (object_ptr->dictionary_owner_soft);
         }
         if (object_ptr->dictionary_owner_soft)
         {
-                free (object_ptr->dictionary_owner_hard);
         }
         if (object_ptr)
         {
-                free (object_ptr);
+                dxf_free (object_ptr);
         }
         if (iter)
         {
-                free (iter);
+                dxf_free (iter);
         }
 #if DEBUG
         DXF_DEBUG_END
@@ -441,7 +428,7 @@ dxf_object_ptr_free_list
  *
  * \return \c id_code.
  */
-int
+uint64_t
 dxf_object_ptr_get_id_code
 (
         DxfObjectPtr *object_ptr
@@ -459,13 +446,6 @@ dxf_object_ptr_get_id_code
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (object_ptr->id_code < 0)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a negative value was found.\n")),
-                  __FUNCTION__);
-                return (EXIT_FAILURE);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -481,7 +461,7 @@ dxf_object_ptr_set_id_code
 (
         DxfObjectPtr *object_ptr,
                 /*!< a pointer to a DXF \c OBJECT_PTR object. */
-        int id_code
+        uint64_t id_code
                 /*!< Identification number for the object.\n
                  * This is to be an unique (sequential) number in the DXF
                  * file. */
@@ -498,13 +478,6 @@ dxf_object_ptr_set_id_code
                   __FUNCTION__);
                 return (NULL);
         }
-        if (id_code < 0)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a negative value was passed.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
         object_ptr->id_code = id_code;
 #if DEBUG
         DXF_DEBUG_END
@@ -517,11 +490,9 @@ dxf_object_ptr_set_id_code
  * \brief Get the pointer to the \c dictionary_owner_soft from a DXF 
  * \c OBJECT_PTR object.
  *
- * \return pointer to the \c dictionary_owner_soft.
- *
- * \warning No checks are performed on the returned pointer (string).
+ * \return the handle of the \c dictionary_owner_soft.
  */
-char *
+uint64_t
 dxf_object_ptr_get_dictionary_owner_soft
 (
         DxfObjectPtr *object_ptr
@@ -537,19 +508,12 @@ dxf_object_ptr_get_dictionary_owner_soft
                 fprintf (stderr,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
-                return (NULL);
-        }
-        if (object_ptr->dictionary_owner_soft ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
+                return (0);
         }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (object_ptr->dictionary_owner_soft));
+        return (object_ptr->dictionary_owner_soft);
 }
 
 
@@ -562,8 +526,8 @@ dxf_object_ptr_set_dictionary_owner_soft
 (
         DxfObjectPtr *object_ptr,
                 /*!< a pointer to a DXF \c OBJECT_PTR object. */
-        char *dictionary_owner_soft
-                /*!< a string containing the pointer to the
+        uint64_t dictionary_owner_soft
+                /*!< the handle of the
                  * dictionary_owner_soft for the object. */
 )
 {
@@ -578,14 +542,7 @@ dxf_object_ptr_set_dictionary_owner_soft
                   __FUNCTION__);
                 return (NULL);
         }
-        if (dictionary_owner_soft == NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was passed.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
-        object_ptr->dictionary_owner_soft = strdup (dictionary_owner_soft);
+        object_ptr->dictionary_owner_soft = dictionary_owner_soft;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -598,10 +555,8 @@ dxf_object_ptr_set_dictionary_owner_soft
  * \c OBJECT_PTR object.
  *
  * \return hard pointer to the dictionary owner.
- *
- * \warning No checks are performed on the returned pointer (string).
  */
-char *
+uint64_t
 dxf_object_ptr_get_dictionary_owner_hard
 (
         DxfObjectPtr *object_ptr
@@ -617,19 +572,12 @@ dxf_object_ptr_get_dictionary_owner_hard
                 fprintf (stderr,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
-                return (NULL);
-        }
-        if (object_ptr->dictionary_owner_hard ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
+                return (0);
         }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (object_ptr->dictionary_owner_hard));
+        return (object_ptr->dictionary_owner_hard);
 }
 
 
@@ -642,8 +590,8 @@ dxf_object_ptr_set_dictionary_owner_hard
 (
         DxfObjectPtr *object_ptr,
                 /*!< a pointer to a DXF \c OBJECT_PTR object. */
-        char *dictionary_owner_hard
-                /*!< a string containing the pointer to the
+        uint64_t dictionary_owner_hard
+                /*!< the handle of the
                  * dictionary_owner_hard for the object. */
 )
 {
@@ -658,14 +606,7 @@ dxf_object_ptr_set_dictionary_owner_hard
                   __FUNCTION__);
                 return (NULL);
         }
-        if (dictionary_owner_hard == NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was passed.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
-        object_ptr->dictionary_owner_hard = strdup (dictionary_owner_hard);
+        object_ptr->dictionary_owner_hard = dictionary_owner_hard;
 #if DEBUG
         DXF_DEBUG_END
 #endif
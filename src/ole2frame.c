@@ -61,7 +61,7 @@ dxf_ole2frame_new ()
         size = sizeof (DxfOle2Frame);
         /* avoid malloc of 0 bytes */
         if (size == 0) size = 1;
-        if ((ole2frame = malloc (size)) == NULL)
+        if ((ole2frame = dxf_malloc (size)) == NULL)
         {
                 fprintf (stderr,
                   (_("Error in %s () could not allocate memory for a DxfOle2Frame struct.\n")),
@@ -111,19 +111,19 @@ dxf_ole2frame_init
                 __FUNCTION__);
               return (NULL);
         }
-        ole2frame->id_code = 0;
-        ole2frame->linetype = strdup (DXF_DEFAULT_LINETYPE);
-        ole2frame->layer = strdup (DXF_DEFAULT_LAYER);
+        ole2frame->id_code = DXF_HANDLE_NONE;
+        ole2frame->linetype = dxf_strdup (DXF_DEFAULT_LINETYPE);
+        ole2frame->layer = dxf_strdup (DXF_DEFAULT_LAYER);
         ole2frame->elevation = 0.0;
         ole2frame->thickness = 0.0;
         ole2frame->linetype_scale = DXF_DEFAULT_LINETYPE_SCALE;
         ole2frame->visibility = DXF_DEFAULT_VISIBILITY;
         ole2frame->color = DXF_COLOR_BYLAYER;
         ole2frame->paperspace = DXF_MODELSPACE;
-        ole2frame->dictionary_owner_soft = strdup ("");
-        ole2frame->dictionary_owner_hard = strdup ("");
-        ole2frame->end_of_data = strdup ("OLE");
-        ole2frame->length_of_binary_data = strdup ("");
+        ole2frame->dictionary_owner_soft = 0;
+        ole2frame->dictionary_owner_hard = 0;
+        ole2frame->end_of_data = dxf_strdup ("OLE");
+        ole2frame->length_of_binary_data = dxf_strdup ("");
         dxf_ole2frame_set_p0 (ole2frame, dxf_point_new ());
         dxf_point_init ((DxfPoint *) dxf_ole2frame_get_p0 (ole2frame));
         ole2frame->p0->x0 = 0.0;
@@ -140,7 +140,7 @@ dxf_ole2frame_init
         ole2frame->length = 0;
         ole2frame->binary_data = dxf_char_new ();
         ole2frame->binary_data = dxf_char_init (ole2frame->binary_data);
-        ole2frame->binary_data->value = strdup ("");
+        ole2frame->binary_data->value = dxf_strdup ("");
         ole2frame->binary_data->length = 0;
         ole2frame->binary_data->next = NULL;
         ole2frame->next = NULL;
@@ -174,7 +174,8 @@ dxf_ole2frame_read
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        char *temp_string = NULL;
+        char temp_string[DXF_MAX_STRING_LENGTH];
+        int group_code;
         DxfChar *iter = NULL;
 
         /* Do some basic checks. */
@@ -183,8 +184,6 @@ dxf_ole2frame_read
                 fprintf (stderr,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
-                /* Clean up. */
-                free (temp_string);
                 return (NULL);
         }
         if (ole2frame == NULL)
@@ -195,235 +194,201 @@ dxf_ole2frame_read
                 ole2frame = dxf_ole2frame_init (ole2frame);
         }
         iter = (DxfChar *) ole2frame->binary_data;
-        (fp->line_number)++;
-        fscanf (fp->fp, "%[^\n]", temp_string);
-        while (strcmp (temp_string, "0") != 0)
+        while ((dxf_read_group_code (fp, &group_code) == EXIT_SUCCESS)
+          && (group_code != 0))
         {
-                if (ferror (fp->fp))
+                if (dxf_read_error (fp))
                 {
                         fprintf (stderr,
                           (_("Error in %s () while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
-                        fclose (fp->fp);
-                        /* Clean up. */
-                        free (temp_string);
                         return (NULL);
                 }
-                if (strcmp (temp_string, "1") == 0)
-                {
-                        /* Now follows a string containing a End of Ole
-                         * data marker. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
-                        if (strcmp (temp_string, "OLE") != 0)
-                        {
-                                fprintf (stderr,
-                                  (_("Warning in %s () found a bad End of Ole data marker in: %s in line: %d.\n")),
-                                  __FUNCTION__, fp->filename, fp->line_number);
-                        }
-                }
-                if (strcmp (temp_string, "3") == 0)
-                {
-                        /* Now follows a string containing the length of
-                         * binary data. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, ole2frame->length_of_binary_data);
-                }
-                if (strcmp (temp_string, "5") == 0)
-                {
-                        /* Now follows a string containing a sequential
-                         * id number. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%x\n", (uint *) &ole2frame->id_code);
-                }
-                else if (strcmp (temp_string, "6") == 0)
-                {
-                        /* Now follows a string containing a linetype
-                         * name. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, ole2frame->linetype);
-                }
-                else if (strcmp (temp_string, "8") == 0)
-                {
-                        /* Now follows a string containing a layer name. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, ole2frame->layer);
-                }
-                else if (strcmp (temp_string, "10") == 0)
-                {
-                        /* Now follows a string containing the
-                         * X-coordinate of the insertion point. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &ole2frame->p0->x0);
-                }
-                else if (strcmp (temp_string, "20") == 0)
-                {
-                        /* Now follows a string containing the
-                         * Y-coordinate of the insertion point. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &ole2frame->p0->y0);
-                }
-                else if (strcmp (temp_string, "30") == 0)
-                {
-                        /* Now follows a string containing the
-                         * Z-coordinate of the insertion point. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &ole2frame->p0->z0);
-                }
-                else if (strcmp (temp_string, "11") == 0)
-                {
-                        /* Now follows a string containing the
-                         * X-coordinate of the direction vector. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &ole2frame->p1->x0);
-                }
-                else if (strcmp (temp_string, "21") == 0)
-                {
-                        /* Now follows a string containing the
-                         * Y-coordinate of the direction vector. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &ole2frame->p1->y0);
-                }
-                else if (strcmp (temp_string, "31") == 0)
-                {
-                        /* Now follows a string containing the
-                         * Z-coordinate of the direction vector. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &ole2frame->p1->z0);
-                }
-                else if ((fp->acad_version_number <= AutoCAD_11)
-                        && (strcmp (temp_string, "38") == 0))
-                {
-                        /* Now follows a string containing the
-                         * elevation. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &ole2frame->elevation);
-                }
-                else if (strcmp (temp_string, "39") == 0)
-                {
-                        /* Now follows a string containing the
-                         * thickness. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &ole2frame->thickness);
-                }
-                else if (strcmp (temp_string, "48") == 0)
-                {
-                        /* Now follows a string containing the linetype
-                         * scale. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &ole2frame->linetype_scale);
-                }
-                else if (strcmp (temp_string, "60") == 0)
-                {
-                        /* Now follows a string containing the
-                         * visibility value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%hd\n", &ole2frame->visibility);
-                }
-                else if (strcmp (temp_string, "62") == 0)
+                switch (group_code)
                 {
-                        /* Now follows a string containing the
-                         * color value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%d\n", &ole2frame->color);
-                }
-                else if (strcmp (temp_string, "67") == 0)
-                {
-                        /* Now follows a string containing the
-                         * paperspace value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%d\n", &ole2frame->paperspace);
-                }
-                else if (strcmp (temp_string, "70") == 0)
-                {
-                        /* Now follows a string containing the ole
-                         * version number. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%d\n", &ole2frame->ole_version_number);
-                }
-                else if (strcmp (temp_string, "71") == 0)
-                {
-                        /* Now follows a string containing the ole
-                         * object type. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%d\n", &ole2frame->ole_object_type);
-                }
-                else if (strcmp (temp_string, "72") == 0)
-                {
-                        /* Now follows a string containing the tilemode
-                         * descriptor. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%d\n", &ole2frame->tilemode_descriptor);
-                }
-                else if (strcmp (temp_string, "90") == 0)
-                {
-                        /* Now follows a string containing the length of
-                         * binary data. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%ld\n", &ole2frame->length);
-                }
-                else if ((fp->acad_version_number >= AutoCAD_13)
-                        && (strcmp (temp_string, "100") == 0))
-                {
-                        /* Now follows a string containing the
-                         * subclass marker value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
-                        if ((strcmp (temp_string, "AcDbEntity") != 0)
-                        && ((strcmp (temp_string, "AcDbOle2Frame") != 0)))
-                        {
+                        case 1:
+                                /* Now follows a string containing a End of Ole
+                                 * data marker. */
+                                dxf_read_line (temp_string, fp);
+                                if (strcmp (temp_string, "OLE") != 0)
+                                {
+                                        fprintf (stderr,
+                                          (_("Warning in %s () found a bad End of Ole data marker in: %s in line: %d.\n")),
+                                          __FUNCTION__, fp->filename, fp->line_number);
+                                }
+                                break;
+                        case 3:
+                                /* Now follows a string containing the length of
+                                 * binary data. */
+                                dxf_read_string (fp, &ole2frame->length_of_binary_data);
+                                break;
+                        case 5:
+                                /* Now follows a string containing a sequential
+                                 * id number. */
+                                dxf_read_handle (fp, &ole2frame->id_code);
+                                break;
+                        case 6:
+                                /* Now follows a string containing a linetype
+                                 * name. */
+                                dxf_read_string_interned (fp, &ole2frame->linetype);
+                                break;
+                        case 8:
+                                /* Now follows a string containing a layer name. */
+                                dxf_read_string_interned (fp, &ole2frame->layer);
+                                break;
+                        case 10:
+                                /* Now follows a string containing the
+                                 * X-coordinate of the insertion point. */
+                                dxf_read_double (fp, &ole2frame->p0->x0);
+                                break;
+                        case 20:
+                                /* Now follows a string containing the
+                                 * Y-coordinate of the insertion point. */
+                                dxf_read_double (fp, &ole2frame->p0->y0);
+                                break;
+                        case 30:
+                                /* Now follows a string containing the
+                                 * Z-coordinate of the insertion point. */
+                                dxf_read_double (fp, &ole2frame->p0->z0);
+                                break;
+                        case 11:
+                                /* Now follows a string containing the
+                                 * X-coordinate of the direction vector. */
+                                dxf_read_double (fp, &ole2frame->p1->x0);
+                                break;
+                        case 21:
+                                /* Now follows a string containing the
+                                 * Y-coordinate of the direction vector. */
+                                dxf_read_double (fp, &ole2frame->p1->y0);
+                                break;
+                        case 31:
+                                /* Now follows a string containing the
+                                 * Z-coordinate of the direction vector. */
+                                dxf_read_double (fp, &ole2frame->p1->z0);
+                                break;
+                        case 38:
+                                if (fp->acad_version_number <= AutoCAD_11)
+                                {
+                                        /* Now follows a string containing the
+                                         * elevation. */
+                                        dxf_read_double (fp, &ole2frame->elevation);
+                                }
+                                else
+                                {
+                                        fprintf (stderr,
+                                          (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
+                                          __FUNCTION__, fp->filename, fp->line_number);
+                                        /* Skip the value of the unknown group code. */
+                                        dxf_read_line (temp_string, fp);
+                                }
+                                break;
+                        case 39:
+                                /* Now follows a string containing the
+                                 * thickness. */
+                                dxf_read_double (fp, &ole2frame->thickness);
+                                break;
+                        case 48:
+                                /* Now follows a string containing the linetype
+                                 * scale. */
+                                dxf_read_double (fp, &ole2frame->linetype_scale);
+                                break;
+                        case 60:
+                                /* Now follows a string containing the
+                                 * visibility value. */
+                                dxf_read_int16 (fp, &ole2frame->visibility);
+                                break;
+                        case 62:
+                                /* Now follows a string containing the
+                                 * color value. */
+                                dxf_read_int (fp, &ole2frame->color);
+                                break;
+                        case 67:
+                                /* Now follows a string containing the
+                                 * paperspace value. */
+                                dxf_read_int (fp, &ole2frame->paperspace);
+                                break;
+                        case 70:
+                                /* Now follows a string containing the ole
+                                 * version number. */
+                                dxf_read_int (fp, &ole2frame->ole_version_number);
+                                break;
+                        case 71:
+                                /* Now follows a string containing the ole
+                                 * object type. */
+                                dxf_read_int (fp, &ole2frame->ole_object_type);
+                                break;
+                        case 72:
+                                /* Now follows a string containing the tilemode
+                                 * descriptor. */
+                                dxf_read_int (fp, &ole2frame->tilemode_descriptor);
+                                break;
+                        case 90:
+                                /* Now follows a string containing the length of
+                                 * binary data. */
+                                dxf_read_long (fp, &ole2frame->length);
+                                break;
+                        case 100:
+                                if (fp->acad_version_number >= AutoCAD_13)
+                                {
+                                        /* Now follows a string containing the
+                                         * subclass marker value. */
+                                        dxf_read_line (temp_string, fp);
+                                        if ((strcmp (temp_string, "AcDbEntity") != 0)
+                                        && ((strcmp (temp_string, "AcDbOle2Frame") != 0)))
+                                        {
+                                                fprintf (stderr,
+                                                  (_("Warning in %s () found a bad subclass marker in: %s in line: %d.\n")),
+                                                  __FUNCTION__, fp->filename, fp->line_number);
+                                        }
+                                }
+                                else
+                                {
+                                        fprintf (stderr,
+                                          (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
+                                          __FUNCTION__, fp->filename, fp->line_number);
+                                        /* Skip the value of the unknown group code. */
+                                        dxf_read_line (temp_string, fp);
+                                }
+                                break;
+                        case 310:
+                                /* Now follows a string containing binary data. */
+                                dxf_read_string (fp, &iter->value);
+                                iter->next = (struct DxfChar *) dxf_char_init ((DxfChar *) iter->next);
+                                iter = (DxfChar *) iter->next;
+                                break;
+                        case 330:
+                                /* Now follows a string containing Soft-pointer
+                                 * ID/handle to owner dictionary. */
+                                dxf_read_handle (fp, &ole2frame->dictionary_owner_soft);
+                                break;
+                        case 360:
+                                /* Now follows a string containing Hard owner
+                                 * ID/handle to owner dictionary. */
+                                dxf_read_handle (fp, &ole2frame->dictionary_owner_hard);
+                                break;
+                        case 999:
+                                /* Now follows a string containing a comment. */
+                                dxf_read_line (temp_string, fp);
+                                fprintf (stdout, "DXF comment: %s\n", temp_string);
+                                break;
+                        default:
                                 fprintf (stderr,
-                                  (_("Warning in %s () found a bad subclass marker in: %s in line: %d.\n")),
+                                  (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
                                   __FUNCTION__, fp->filename, fp->line_number);
-                        }
-                }
-                else if (strcmp (temp_string, "310") == 0)
-                {
-                        /* Now follows a string containing binary data. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, iter->value);
-                        iter->next = (struct DxfChar *) dxf_char_init ((DxfChar *) iter->next);
-                        iter = (DxfChar *) iter->next;
-                }
-                else if (strcmp (temp_string, "330") == 0)
-                {
-                        /* Now follows a string containing Soft-pointer
-                         * ID/handle to owner dictionary. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, ole2frame->dictionary_owner_soft);
-                }
-                else if (strcmp (temp_string, "360") == 0)
-                {
-                        /* Now follows a string containing Hard owner
-                         * ID/handle to owner dictionary. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, ole2frame->dictionary_owner_hard);
-                }
-                else if (strcmp (temp_string, "999") == 0)
-                {
-                        /* Now follows a string containing a comment. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
-                        fprintf (stdout, "DXF comment: %s\n", temp_string);
-                }
-                else
-                {
-                        fprintf (stderr,
-                          (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
-                          __FUNCTION__, fp->filename, fp->line_number);
+                                /* Skip the value of the unknown group code. */
+                                dxf_read_line (temp_string, fp);
+                                break;
                 }
         }
         /* Handle omitted members and/or illegal values. */
         if (strcmp (ole2frame->linetype, "") == 0)
         {
-                ole2frame->linetype = strdup (DXF_DEFAULT_LINETYPE);
+                ole2frame->linetype = dxf_strdup (DXF_DEFAULT_LINETYPE);
         }
         if (strcmp (ole2frame->layer, "") == 0)
         {
-                ole2frame->layer = strdup (DXF_DEFAULT_LAYER);
+                ole2frame->layer = dxf_strdup (DXF_DEFAULT_LAYER);
         }
-        /* Clean up. */
-        free (temp_string);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -449,7 +414,7 @@ dxf_ole2frame_write
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        char *dxf_entity_name = strdup ("OLE2FRAME");
+        char *dxf_entity_name = dxf_strdup ("OLE2FRAME");
         DxfChar *iter = NULL;
 
         /* Do some basic checks. */
@@ -459,7 +424,7 @@ dxf_ole2frame_write
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (ole2frame == NULL)
@@ -468,7 +433,7 @@ dxf_ole2frame_write
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (fp->acad_version_number < AutoCAD_14)
@@ -480,28 +445,28 @@ dxf_ole2frame_write
         if (strcmp (ole2frame->linetype, "") == 0)
         {
                 fprintf (stderr,
-                  (_("Warning in %s () empty linetype string for the %s entity with id-code: %x\n")),
+                  (_("Warning in %s () empty linetype string for the %s entity with id-code: %" PRIx64 "\n")),
                   __FUNCTION__, dxf_entity_name, ole2frame->id_code);
                 fprintf (stderr,
                   (_("\t%s entity is reset to default linetype")),
                   dxf_entity_name);
-                ole2frame->linetype = strdup (DXF_DEFAULT_LINETYPE);
+                ole2frame->linetype = dxf_strdup (DXF_DEFAULT_LINETYPE);
         }
         if (strcmp (ole2frame->layer, "") == 0)
         {
                 fprintf (stderr,
-                  (_("Warning in %s () empty layer string for the %s entity with id-code: %x\n")),
+                  (_("Warning in %s () empty layer string for the %s entity with id-code: %" PRIx64 "\n")),
                   __FUNCTION__, dxf_entity_name, ole2frame->id_code);
                 fprintf (stderr,
                   (_("\t%s entity is relocated to layer 0")),
                   dxf_entity_name);
-                ole2frame->layer = strdup (DXF_DEFAULT_LAYER);
+                ole2frame->layer = dxf_strdup (DXF_DEFAULT_LAYER);
         }
         /* Start writing output. */
-        fprintf (fp->fp, "  0\n%s\n", dxf_entity_name);
-        if (ole2frame->id_code != -1)
+        dxf_write_string (fp, 0, dxf_entity_name);
+        if (ole2frame->id_code != DXF_HANDLE_NONE)
         {
-                fprintf (fp->fp, "  5\n%x\n", ole2frame->id_code);
+                dxf_write_hex (fp, 5, ole2frame->id_code);
         }
         /*!
          * \todo for version R14.\n
@@ -513,86 +478,86 @@ dxf_ole2frame_write
          * 102 groups are application defined (optional).\n\n
          * End of group, "}" (optional), with Group code 102.
          */
-        if ((strcmp (ole2frame->dictionary_owner_soft, "") != 0)
+        if ((ole2frame->dictionary_owner_soft != 0)
           && (fp->acad_version_number >= AutoCAD_14))
         {
-                fprintf (fp->fp, "102\n{ACAD_REACTORS\n");
-                fprintf (fp->fp, "330\n%s\n", ole2frame->dictionary_owner_soft);
-                fprintf (fp->fp, "102\n}\n");
+                dxf_write_string (fp, 102, "{ACAD_REACTORS");
+                dxf_write_hex (fp, 330, ole2frame->dictionary_owner_soft);
+                dxf_write_string (fp, 102, "}");
         }
-        if ((strcmp (ole2frame->dictionary_owner_hard, "") != 0)
+        if ((ole2frame->dictionary_owner_hard != 0)
           && (fp->acad_version_number >= AutoCAD_14))
         {
-                fprintf (fp->fp, "102\n{ACAD_XDICTIONARY\n");
-                fprintf (fp->fp, "360\n%s\n", ole2frame->dictionary_owner_hard);
-                fprintf (fp->fp, "102\n}\n");
+                dxf_write_string (fp, 102, "{ACAD_XDICTIONARY");
+                dxf_write_hex (fp, 360, ole2frame->dictionary_owner_hard);
+                dxf_write_string (fp, 102, "}");
         }
         if (fp->acad_version_number >= AutoCAD_13)
         {
-                fprintf (fp->fp, "100\nAcDbEntity\n");
+                dxf_write_string (fp, 100, "AcDbEntity");
         }
         if (ole2frame->paperspace == DXF_PAPERSPACE)
         {
-                fprintf (fp->fp, " 67\n%d\n", (int16_t) DXF_PAPERSPACE);
+                dxf_write_int (fp, 67, (int16_t) DXF_PAPERSPACE);
         }
-        fprintf (fp->fp, "  8\n%s\n", ole2frame->layer);
+        dxf_write_string (fp, 8, ole2frame->layer);
         if (strcmp (ole2frame->linetype, DXF_DEFAULT_LINETYPE) != 0)
         {
-                fprintf (fp->fp, "  6\n%s\n", ole2frame->linetype);
+                dxf_write_string (fp, 6, ole2frame->linetype);
         }
         if ((fp->acad_version_number <= AutoCAD_11)
           && DXF_FLATLAND
           && (ole2frame->elevation != 0.0))
         {
-                fprintf (fp->fp, " 38\n%f\n", ole2frame->elevation);
+                dxf_write_double (fp, 38, ole2frame->elevation);
         }
         if (ole2frame->color != DXF_COLOR_BYLAYER)
         {
-                fprintf (fp->fp, " 62\n%d\n", ole2frame->color);
+                dxf_write_int (fp, 62, ole2frame->color);
         }
         if (ole2frame->linetype_scale != 1.0)
         {
-                fprintf (fp->fp, " 48\n%f\n", ole2frame->linetype_scale);
+                dxf_write_double (fp, 48, ole2frame->linetype_scale);
         }
         if (ole2frame->visibility != 0)
         {
-                fprintf (fp->fp, " 60\n%d\n", ole2frame->visibility);
+                dxf_write_int (fp, 60, ole2frame->visibility);
         }
         if (fp->acad_version_number >= AutoCAD_13)
         {
-                fprintf (fp->fp, "100\nAcDbOle2Frame\n");
+                dxf_write_string (fp, 100, "AcDbOle2Frame");
         }
         if (ole2frame->thickness != 0.0)
         {
-                fprintf (fp->fp, " 39\n%f\n", ole2frame->thickness);
-        }
-        fprintf (fp->fp, " 70\n%d\n", ole2frame->ole_version_number);
-        fprintf (fp->fp, "  3\n%s\n", ole2frame->length_of_binary_data);
-        fprintf (fp->fp, " 10\n%f\n", ole2frame->p0->x0);
-        fprintf (fp->fp, " 20\n%f\n", ole2frame->p0->y0);
-        fprintf (fp->fp, " 30\n%f\n", ole2frame->p0->z0);
-        fprintf (fp->fp, " 11\n%f\n", ole2frame->p1->x0);
-        fprintf (fp->fp, " 21\n%f\n", ole2frame->p1->y0);
-        fprintf (fp->fp, " 31\n%f\n", ole2frame->p1->z0);
-        fprintf (fp->fp, " 71\n%d\n", ole2frame->ole_object_type);
-        fprintf (fp->fp, " 72\n%d\n", ole2frame->tilemode_descriptor);
-        fprintf (fp->fp, " 90\n%ld\n", ole2frame->length);
+                dxf_write_double (fp, 39, ole2frame->thickness);
+        }
+        dxf_write_int (fp, 70, ole2frame->ole_version_number);
+        dxf_write_string (fp, 3, ole2frame->length_of_binary_data);
+        dxf_write_double (fp, 10, ole2frame->p0->x0);
+        dxf_write_double (fp, 20, ole2frame->p0->y0);
+        dxf_write_double (fp, 30, ole2frame->p0->z0);
+        dxf_write_double (fp, 11, ole2frame->p1->x0);
+        dxf_write_double (fp, 21, ole2frame->p1->y0);
+        dxf_write_double (fp, 31, ole2frame->p1->z0);
+        dxf_write_int (fp, 71, ole2frame->ole_object_type);
+        dxf_write_int (fp, 72, ole2frame->tilemode_descriptor);
+        dxf_write_int (fp, 90, ole2frame->length);
         if (ole2frame->binary_data != NULL)
         {
                 iter = (DxfChar*) ole2frame->binary_data;
                 while ((iter != NULL) && (iter->value != NULL))
                 {
-                        fprintf (fp->fp, "310\n%s\n", iter->value);
+                        dxf_write_string (fp, 310, iter->value);
                         iter = (DxfChar*) iter->next;
                 }
         }
         else
         {
-                fprintf (fp->fp, "310\n\n");
+                dxf_write_string (fp, 310, "");
         }
-        fprintf (fp->fp, "  1\nOLE\n");
+        dxf_write_string (fp, 1, "OLE");
         /* Clean up. */
-        free (dxf_entity_name);
+        dxf_free (dxf_entity_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -633,17 +598,15 @@ dxf_ole2frame_free
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        free (ole2frame->end_of_data);
-        free (ole2frame->length_of_binary_data);
-        free (ole2frame->linetype);
-        free (ole2frame->layer);
-        free (ole2frame->dictionary_owner_soft);
-        free (ole2frame->dictionary_owner_hard);
-        free (ole2frame->binary_data->value);
+        dxf_free (ole2frame->end_of_data);
+        dxf_free (ole2frame->length_of_binary_data);
+        dxf_string_free (ole2frame->linetype);
+        dxf_string_free (ole2frame->layer);
+        dxf_free (ole2frame->binary_data->value);
         /*! \todo Needs a proper implementation. */
-        free (ole2frame->binary_data);
+        dxf_free (ole2frame->binary_data);
         /*! \todo Needs a proper implementation. */
-        free (ole2frame);
+        dxf_free (ole2frame);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -689,7 +652,7 @@ dxf_ole2frame_free_list
  *
  * \return \c id_code.
  */
-int
+uint64_t
 dxf_ole2frame_get_id_code
 (
         DxfOle2Frame *ole2frame
@@ -707,13 +670,6 @@ dxf_ole2frame_get_id_code
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (ole2frame->id_code < 0)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a negative value was found.\n")),
-                  __FUNCTION__);
-                return (EXIT_FAILURE);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -729,7 +685,7 @@ dxf_ole2frame_set_id_code
 (
         DxfOle2Frame *ole2frame,
                 /*!< a pointer to a DXF \c OLE2FRAME entity. */
-        int id_code
+        uint64_t id_code
                 /*!< Identification number for the entity.\n
                  * This is to be an unique (sequential) number in the DXF
                  * file. */
@@ -746,13 +702,6 @@ dxf_ole2frame_set_id_code
                   __FUNCTION__);
                 return (NULL);
         }
-        if (id_code < 0)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a negative value was passed.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
         ole2frame->id_code = id_code;
 #if DEBUG
         DXF_DEBUG_END
@@ -794,7 +743,7 @@ dxf_ole2frame_get_linetype
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (ole2frame->linetype));
+        return (dxf_strdup (ole2frame->linetype));
 }
 
 
@@ -828,7 +777,7 @@ dxf_ole2frame_set_linetype
                   __FUNCTION__);
                 return (NULL);
         }
-        ole2frame->linetype = strdup (linetype);
+        ole2frame->linetype = dxf_strdup (linetype);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -869,7 +818,7 @@ dxf_ole2frame_get_layer
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (ole2frame->layer));
+        return (dxf_strdup (ole2frame->layer));
 }
 
 
@@ -903,7 +852,7 @@ dxf_ole2frame_set_layer
                   __FUNCTION__);
                 return (NULL);
         }
-        ole2frame->layer = strdup (layer);
+        ole2frame->layer = dxf_strdup (layer);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1629,10 +1578,8 @@ dxf_ole2frame_set_binary_graphics_data
  * \c OLE2FRAME entity.
  *
  * \return soft pointer to the dictionary owner.
- *
- * \warning No checks are performed on the returned pointer (string).
  */
-char *
+uint64_t
 dxf_ole2frame_get_dictionary_owner_soft
 (
         DxfOle2Frame *ole2frame
@@ -1648,19 +1595,12 @@ dxf_ole2frame_get_dictionary_owner_soft
                 fprintf (stderr,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
-                return (NULL);
-        }
-        if (ole2frame->dictionary_owner_soft ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
+                return (0);
         }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (ole2frame->dictionary_owner_soft));
+        return (ole2frame->dictionary_owner_soft);
 }
 
 
@@ -1673,8 +1613,8 @@ dxf_ole2frame_set_dictionary_owner_soft
 (
         DxfOle2Frame *ole2frame,
                 /*!< a pointer to a DXF \c OLE2FRAME entity. */
-        char *dictionary_owner_soft
-                /*!< a string containing the pointer to the
+        uint64_t dictionary_owner_soft
+                /*!< the handle of the
                  * dictionary_owner_soft for the entity. */
 )
 {
@@ -1689,14 +1629,7 @@ dxf_ole2frame_set_dictionary_owner_soft
                   __FUNCTION__);
                 return (NULL);
         }
-        if (dictionary_owner_soft == NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was passed.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
-        ole2frame->dictionary_owner_soft = strdup (dictionary_owner_soft);
+        ole2frame->dictionary_owner_soft = dictionary_owner_soft;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1708,12 +1641,10 @@ dxf_ole2frame_set_dictionary_owner_soft
  * \brief Get the pointer to the \c material from a DXF \c OLE2FRAME
  * entity.
  *
- * \return a pointer to \c material when successful, or \c NULL when an
+ * \return the handle \c material when successful, or 0 when an
  * error occurred.
- *
- * \warning No checks are performed on the returned pointer.
  */
-char *
+uint64_t
 dxf_ole2frame_get_material
 (
         DxfOle2Frame *ole2frame
@@ -1729,19 +1660,12 @@ dxf_ole2frame_get_material
                 fprintf (stderr,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
-                return (NULL);
-        }
-        if (ole2frame->material ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
+                return (0);
         }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (ole2frame->material));
+        return (ole2frame->material);
 }
 
 
@@ -1757,8 +1681,8 @@ dxf_ole2frame_set_material
 (
         DxfOle2Frame *ole2frame,
                 /*!< a pointer to a DXF \c OLE2FRAME entity. */
-        char *material
-                /*!< a string containing the pointer to the \c
+        uint64_t material
+                /*!< the handle of the \c
                  * material for the entity. */
 )
 {
@@ -1773,14 +1697,7 @@ dxf_ole2frame_set_material
                   __FUNCTION__);
                 return (NULL);
         }
-        if (material == NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was passed.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
-        ole2frame->material = strdup (material);
+        ole2frame->material = material;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1793,10 +1710,8 @@ dxf_ole2frame_set_material
  * \c OLE2FRAME entity.
  *
  * \return hard pointer to the dictionary owner.
- *
- * \warning No checks are performed on the returned pointer (string).
  */
-char *
+uint64_t
 dxf_ole2frame_get_dictionary_owner_hard
 (
         DxfOle2Frame *ole2frame
@@ -1812,19 +1727,12 @@ dxf_ole2frame_get_dictionary_owner_hard
                 fprintf (stderr,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
-                return (NULL);
-        }
-        if (ole2frame->dictionary_owner_hard ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
+                return (0);
         }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (ole2frame->dictionary_owner_hard));
+        return (ole2frame->dictionary_owner_hard);
 }
 
 
@@ -1837,8 +1745,8 @@ dxf_ole2frame_set_dictionary_owner_hard
 (
         DxfOle2Frame *ole2frame,
                 /*!< a pointer to a DXF \c OLE2FRAME entity. */
-        char *dictionary_owner_hard
-                /*!< a string containing the pointer to the
+        uint64_t dictionary_owner_hard
+                /*!< the handle of the
                  * dictionary_owner_hard for the entity. */
 )
 {
@@ -1853,14 +1761,7 @@ dxf_ole2frame_set_dictionary_owner_hard
                   __FUNCTION__);
                 return (NULL);
         }
-        if (dictionary_owner_hard == NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was passed.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
-        ole2frame->dictionary_owner_hard = strdup (dictionary_owner_hard);
+        ole2frame->dictionary_owner_hard = dictionary_owner_hard;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1936,10 +1837,10 @@ dxf_ole2frame_set_lineweight
 /*!
  * \brief Get the \c plot_style_name from a DXF \c OLE2FRAME entity.
  *
- * \return a pointer to \c plot_style_name when sucessful, or \c NULL
+ * \return the handle \c plot_style_name when sucessful, or 0
  * when an error occurred.
  */
-char *
+uint64_t
 dxf_ole2frame_get_plot_style_name
 (
         DxfOle2Frame *ole2frame
@@ -1955,19 +1856,12 @@ dxf_ole2frame_get_plot_style_name
                 fprintf (stderr,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
-                return (NULL);
-        }
-        if (ole2frame->plot_style_name ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
+                return (0);
         }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (ole2frame->plot_style_name));
+        return (ole2frame->plot_style_name);
 }
 
 
@@ -1982,7 +1876,7 @@ dxf_ole2frame_set_plot_style_name
 (
         DxfOle2Frame *ole2frame,
                 /*!< a pointer to a DXF \c OLE2FRAME entity. */
-        char *plot_style_name
+        uint64_t plot_style_name
                 /*!< a string containing the \c plot_style_name for the
                  * entity. */
 )
@@ -1998,14 +1892,7 @@ dxf_ole2frame_set_plot_style_name
                   __FUNCTION__);
                 return (NULL);
         }
-        if (plot_style_name == NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was passed.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
-        ole2frame->plot_style_name = strdup (plot_style_name);
+        ole2frame->plot_style_name = plot_style_name;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2112,7 +1999,7 @@ dxf_ole2frame_get_color_name
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (ole2frame->color_name));
+        return (dxf_strdup (ole2frame->color_name));
 }
 
 
@@ -2150,7 +2037,7 @@ dxf_ole2frame_set_color_name
                   __FUNCTION__);
                 return (NULL);
         }
-        ole2frame->color_name = strdup (color_name);
+        ole2frame->color_name = dxf_strdup (color_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2257,7 +2144,7 @@ dxf_ole2frame_get_end_of_data
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (ole2frame->end_of_data));
+        return (dxf_strdup (ole2frame->end_of_data));
 }
 
 
@@ -2295,7 +2182,7 @@ dxf_ole2frame_set_end_of_data
                   __FUNCTION__);
                 return (NULL);
         }
-        ole2frame->end_of_data = strdup (end_of_data);
+        ole2frame->end_of_data = dxf_strdup (end_of_data);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2337,7 +2224,7 @@ dxf_ole2frame_get_length_of_binary_data
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (ole2frame->length_of_binary_data));
+        return (dxf_strdup (ole2frame->length_of_binary_data));
 }
 
 
@@ -2375,7 +2262,7 @@ dxf_ole2frame_set_length_of_binary_data
                   __FUNCTION__);
                 return (NULL);
         }
-        ole2frame->length_of_binary_data = strdup (length_of_binary_data);
+        ole2frame->length_of_binary_data = dxf_strdup (length_of_binary_data);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -63,7 +63,7 @@ typedef struct
 dxf_ole2frame_struct
 {
         /* Members common for all DXF drawable entities. */
-        int id_code;
+        uint64_t id_code;
                 /*!< Identification number for the entity.\n
                  * This is to be an unique (sequential) number in the DXF
                  * file.\n
@@ -132,15 +132,15 @@ dxf_ole2frame_struct
                  * (optional).\n
                  * Group code = 310.\n
                  * \since Introduced in version R2000. */
-        char *dictionary_owner_soft;
+        uint64_t dictionary_owner_soft;
                 /*!< Soft-pointer ID/handle to owner dictionary (optional).\n
                  * Group code = 330. */
-        char *material;
+        uint64_t material;
                 /*!< Hard-pointer ID/handle to material object (present if
                  * not BYLAYER).\n
                  * Group code = 347.\n
                  * \since Introduced in version R2008. */
-        char *dictionary_owner_hard;
+        uint64_t dictionary_owner_hard;
                 /*!< Hard owner ID/handle to owner dictionary (optional).\n
                  * Group code = 360. */
         int16_t lineweight;
@@ -148,7 +148,7 @@ dxf_ole2frame_struct
                  * Stored and moved around as a 16-bit integer.\n
                  * Group code = 370.\n
                  * \since Introduced in version R2002. */
-        char *plot_style_name;
+        uint64_t plot_style_name;
                 /*!< Hard pointer ID / handle of PlotStyleName object.\n
                  * Group code = 390.\n
                  * \since Introduced in version R2009. */
@@ -226,8 +226,8 @@ DxfOle2Frame *dxf_ole2frame_read (DxfFile *fp, DxfOle2Frame *ole2frame);
 int dxf_ole2frame_write (DxfFile *fp, DxfOle2Frame *ole2frame);
 int dxf_ole2frame_free (DxfOle2Frame *ole2frame);
 void dxf_ole2frame_free_list (DxfOle2Frame *ole2frames);
-int dxf_ole2frame_get_id_code (DxfOle2Frame *ole2frame);
-DxfOle2Frame *dxf_ole2frame_set_id_code (DxfOle2Frame *ole2frame, int id_code);
+uint64_t dxf_ole2frame_get_id_code (DxfOle2Frame *ole2frame);
+DxfOle2Frame *dxf_ole2frame_set_id_code (DxfOle2Frame *ole2frame, uint64_t id_code);
 char *dxf_ole2frame_get_linetype (DxfOle2Frame *ole2frame);
 DxfOle2Frame *dxf_ole2frame_set_linetype (DxfOle2Frame *ole2frame, char *linetype);
 char *dxf_ole2frame_get_layer (DxfOle2Frame *ole2frame);
@@ -250,16 +250,16 @@ int16_t dxf_ole2frame_get_shadow_mode (DxfOle2Frame *ole2frame);
 DxfOle2Frame *dxf_ole2frame_set_shadow_mode (DxfOle2Frame *ole2frame, int16_t shadow_mode);
 DxfBinaryGraphicsData *dxf_ole2frame_get_binary_graphics_data (DxfOle2Frame *ole2frame);
 DxfOle2Frame *dxf_ole2frame_set_binary_graphics_data (DxfOle2Frame *ole2frame, DxfBinaryGraphicsData *data);
-char *dxf_ole2frame_get_dictionary_owner_soft (DxfOle2Frame *ole2frame);
-DxfOle2Frame *dxf_ole2frame_set_dictionary_owner_soft (DxfOle2Frame *ole2frame, char *dictionary_owner_soft);
-char *dxf_ole2frame_get_material (DxfOle2Frame *ole2frame);
-DxfOle2Frame *dxf_ole2frame_set_material (DxfOle2Frame *ole2frame, char *material);
-char *dxf_ole2frame_get_dictionary_owner_hard (DxfOle2Frame *ole2frame);
-DxfOle2Frame *dxf_ole2frame_set_dictionary_owner_hard (DxfOle2Frame *ole2frame, char *dictionary_owner_hard);
+uint64_t dxf_ole2frame_get_dictionary_owner_soft (DxfOle2Frame *ole2frame);
+DxfOle2Frame *dxf_ole2frame_set_dictionary_owner_soft (DxfOle2Frame *ole2frame, uint64_t dictionary_owner_soft);
+uint64_t dxf_ole2frame_get_material (DxfOle2Frame *ole2frame);
+DxfOle2Frame *dxf_ole2frame_set_material (DxfOle2Frame *ole2frame, uint64_t material);
+uint64_t dxf_ole2frame_get_dictionary_owner_hard (DxfOle2Frame *ole2frame);
+DxfOle2Frame *dxf_ole2frame_set_dictionary_owner_hard (DxfOle2Frame *ole2frame, uint64_t dictionary_owner_hard);
 int16_t dxf_ole2frame_get_lineweight (DxfOle2Frame *ole2frame);
 DxfOle2Frame *dxf_ole2frame_set_lineweight (DxfOle2Frame *ole2frame, int16_t lineweight);
-char *dxf_ole2frame_get_plot_style_name (DxfOle2Frame *ole2frame);
-DxfOle2Frame *dxf_ole2frame_set_plot_style_name (DxfOle2Frame *ole2frame, char *plot_style_name);
+uint64_t dxf_ole2frame_get_plot_style_name (DxfOle2Frame *ole2frame);
+DxfOle2Frame *dxf_ole2frame_set_plot_style_name (DxfOle2Frame *ole2frame, uint64_t plot_style_name);
 long dxf_ole2frame_get_color_value (DxfOle2Frame *ole2frame);
 DxfOle2Frame *dxf_ole2frame_set_color_value (DxfOle2Frame *ole2frame, long color_value);
 char *dxf_ole2frame_get_color_name (DxfOle2Frame *ole2frame);
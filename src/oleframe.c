@@ -59,7 +59,7 @@ dxf_oleframe_new ()
         size = sizeof (DxfOleFrame);
         /* avoid malloc of 0 bytes */
         if (size == 0) size = 1;
-        if ((oleframe = malloc (size)) == NULL)
+        if ((oleframe = dxf_malloc (size)) == NULL)
         {
                 fprintf (stderr,
                   (_("Error in %s () could not allocate memory for a DxfOleFrame struct.\n")),
@@ -109,22 +109,22 @@ dxf_oleframe_init
                 __FUNCTION__);
               return (NULL);
         }
-        oleframe->id_code = 0;
-        oleframe->linetype = strdup (DXF_DEFAULT_LINETYPE);
-        oleframe->layer = strdup (DXF_DEFAULT_LAYER);
+        oleframe->id_code = DXF_HANDLE_NONE;
+        oleframe->linetype = dxf_strdup (DXF_DEFAULT_LINETYPE);
+        oleframe->layer = dxf_strdup (DXF_DEFAULT_LAYER);
         oleframe->elevation = 0.0;
         oleframe->thickness = 0.0;
         oleframe->linetype_scale = DXF_DEFAULT_LINETYPE_SCALE;
         oleframe->visibility = DXF_DEFAULT_VISIBILITY;
         oleframe->color = DXF_COLOR_BYLAYER;
         oleframe->paperspace = DXF_MODELSPACE;
-        oleframe->dictionary_owner_soft = strdup ("");
-        oleframe->dictionary_owner_hard = strdup ("");
+        oleframe->dictionary_owner_soft = 0;
+        oleframe->dictionary_owner_hard = 0;
         oleframe->ole_version_number = 1;
         oleframe->length = 0;
         oleframe->binary_data = dxf_char_new ();
         oleframe->binary_data = dxf_char_init (oleframe->binary_data);
-        oleframe->binary_data->value = strdup ("");
+        oleframe->binary_data->value = dxf_strdup ("");
         oleframe->binary_data->length = 0;
         oleframe->binary_data->next = NULL;
         oleframe->next = NULL;
@@ -158,7 +158,8 @@ dxf_oleframe_read
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        char *temp_string = NULL;
+        char temp_string[DXF_MAX_STRING_LENGTH];
+        int group_code;
         DxfChar *iter = NULL;
 
         /* Do some basic checks. */
@@ -167,8 +168,6 @@ dxf_oleframe_read
                 fprintf (stderr,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
-                /* Clean up. */
-                free (temp_string);
                 return (NULL);
         }
         if (oleframe == NULL)
@@ -179,173 +178,156 @@ dxf_oleframe_read
                 oleframe = dxf_oleframe_init (oleframe);
         }
         iter = (DxfChar *) oleframe->binary_data;
-        (fp->line_number)++;
-        fscanf (fp->fp, "%[^\n]", temp_string);
-        while (strcmp (temp_string, "0") != 0)
+        while ((dxf_read_group_code (fp, &group_code) == EXIT_SUCCESS)
+          && (group_code != 0))
         {
-                if (ferror (fp->fp))
+                if (dxf_read_error (fp))
                 {
                         fprintf (stderr,
                           (_("Error in %s () while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
-                        fclose (fp->fp);
-                        /* Clean up. */
-                        free (temp_string);
                         return (NULL);
                 }
-                if (strcmp (temp_string, "1") == 0)
+                switch (group_code)
                 {
-                        /* Now follows a string containing a End of Ole
-                         * data marker. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
-                        if (strcmp (temp_string, "OLE") != 0)
-                        {
+                        case 1:
+                                /* Now follows a string containing a End of Ole
+                                 * data marker. */
+                                dxf_read_line (temp_string, fp);
+                                if (strcmp (temp_string, "OLE") != 0)
+                                {
+                                        fprintf (stderr,
+                                          (_("Warning in %s () found a bad End of Ole data marker in: %s in line: %d.\n")),
+                                          __FUNCTION__, fp->filename, fp->line_number);
+                                }
+                                break;
+                        case 5:
+                                /* Now follows a string containing a sequential
+                                 * id number. */
+                                dxf_read_handle (fp, &oleframe->id_code);
+                                break;
+                        case 6:
+                                /* Now follows a string containing a linetype
+                                 * name. */
+                                dxf_read_string_interned (fp, &oleframe->linetype);
+                                break;
+                        case 8:
+                                /* Now follows a string containing a layer name. */
+                                dxf_read_string_interned (fp, &oleframe->layer);
+                                break;
+                        case 38:
+                                if ((fp->acad_version_number <= AutoCAD_11) && (oleframe->elevation != 0.0))
+                                {
+                                        /* Now follows a string containing the
+                                         * elevation. */
+                                        dxf_read_double (fp, &oleframe->elevation);
+                                }
+                                else
+                                {
+                                        fprintf (stderr,
+                                          (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
+                                          __FUNCTION__, fp->filename, fp->line_number);
+                                        /* Skip the value of the unknown group code. */
+                                        dxf_read_line (temp_string, fp);
+                                }
+                                break;
+                        case 39:
+                                /* Now follows a string containing the
+                                 * thickness. */
+                                dxf_read_double (fp, &oleframe->thickness);
+                                break;
+                        case 48:
+                                /* Now follows a string containing the linetype
+                                 * scale. */
+                                dxf_read_double (fp, &oleframe->linetype_scale);
+                                break;
+                        case 60:
+                                /* Now follows a string containing the
+                                 * visibility value. */
+                                dxf_read_int16 (fp, &oleframe->visibility);
+                                break;
+                        case 62:
+                                /* Now follows a string containing the
+                                 * color value. */
+                                dxf_read_int (fp, &oleframe->color);
+                                break;
+                        case 67:
+                                /* Now follows a string containing the
+                                 * paperspace value. */
+                                dxf_read_int (fp, &oleframe->paperspace);
+                                break;
+                        case 70:
+                                /* Now follows a string containing the ole
+                                 * version number. */
+                                dxf_read_int (fp, &oleframe->ole_version_number);
+                                break;
+                        case 90:
+                                /* Now follows a string containing the length of
+                                 * binary data. */
+                                dxf_read_long (fp, &oleframe->length);
+                                break;
+                        case 100:
+                                if (fp->acad_version_number >= AutoCAD_13)
+                                {
+                                        /* Now follows a string containing the
+                                         * subclass marker value. */
+                                        dxf_read_line (temp_string, fp);
+                                        if ((strcmp (temp_string, "AcDbEntity") != 0)
+                                        && ((strcmp (temp_string, "AcDbOleFrame") != 0)))
+                                        {
+                                                fprintf (stderr,
+                                                  (_("Warning in %s () found a bad subclass marker in: %s in line: %d.\n")),
+                                                  __FUNCTION__, fp->filename, fp->line_number);
+                                        }
+                                }
+                                else
+                                {
+                                        fprintf (stderr,
+                                          (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
+                                          __FUNCTION__, fp->filename, fp->line_number);
+                                        /* Skip the value of the unknown group code. */
+                                        dxf_read_line (temp_string, fp);
+                                }
+                                break;
+                        case 310:
+                                /* Now follows a string containing binary data. */
+                                dxf_read_string (fp, &iter->value);
+                                iter->next = (struct DxfChar *) dxf_char_init ((DxfChar *) iter->next);
+                                iter = (DxfChar *) iter->next;
+                                break;
+                        case 330:
+                                /* Now follows a string containing Soft-pointer
+                                 * ID/handle to owner dictionary. */
+                                dxf_read_handle (fp, &oleframe->dictionary_owner_soft);
+                                break;
+                        case 360:
+                                /* Now follows a string containing Hard owner
+                                 * ID/handle to owner dictionary. */
+                                dxf_read_handle (fp, &oleframe->dictionary_owner_hard);
+                                break;
+                        case 999:
+                                /* Now follows a string containing a comment. */
+                                dxf_read_line (temp_string, fp);
+                                fprintf (stdout, "DXF comment: %s\n", temp_string);
+                                break;
+                        default:
                                 fprintf (stderr,
-                                  (_("Warning in %s () found a bad End of Ole data marker in: %s in line: %d.\n")),
+                                  (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
                                   __FUNCTION__, fp->filename, fp->line_number);
-                        }
-                }
-                if (strcmp (temp_string, "5") == 0)
-                {
-                        /* Now follows a string containing a sequential
-                         * id number. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%x\n", (uint *) &oleframe->id_code);
-                }
-                else if (strcmp (temp_string, "6") == 0)
-                {
-                        /* Now follows a string containing a linetype
-                         * name. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, oleframe->linetype);
-                }
-                else if (strcmp (temp_string, "8") == 0)
-                {
-                        /* Now follows a string containing a layer name. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, oleframe->layer);
-                }
-                else if ((fp->acad_version_number <= AutoCAD_11)
-                        && (strcmp (temp_string, "38") == 0)
-                        && (oleframe->elevation != 0.0))
-                {
-                        /* Now follows a string containing the
-                         * elevation. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &oleframe->elevation);
-                }
-                else if (strcmp (temp_string, "39") == 0)
-                {
-                        /* Now follows a string containing the
-                         * thickness. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &oleframe->thickness);
-                }
-                else if (strcmp (temp_string, "48") == 0)
-                {
-                        /* Now follows a string containing the linetype
-                         * scale. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &oleframe->linetype_scale);
-                }
-                else if (strcmp (temp_string, "60") == 0)
-                {
-                        /* Now follows a string containing the
-                         * visibility value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%hd\n", &oleframe->visibility);
-                }
-                else if (strcmp (temp_string, "62") == 0)
-                {
-                        /* Now follows a string containing the
-                         * color value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%d\n", &oleframe->color);
-                }
-                else if (strcmp (temp_string, "67") == 0)
-                {
-                        /* Now follows a string containing the
-                         * paperspace value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%d\n", &oleframe->paperspace);
-                }
-                else if (strcmp (temp_string, "70") == 0)
-                {
-                        /* Now follows a string containing the ole
-                         * version number. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%d\n", &oleframe->ole_version_number);
-                }
-                else if (strcmp (temp_string, "90") == 0)
-                {
-                        /* Now follows a string containing the length of
-                         * binary data. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%ld\n", &oleframe->length);
-                }
-                else if ((fp->acad_version_number >= AutoCAD_13)
-                        && (strcmp (temp_string, "100") == 0))
-                {
-                        /* Now follows a string containing the
-                         * subclass marker value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
-                        if ((strcmp (temp_string, "AcDbEntity") != 0)
-                        && ((strcmp (temp_string, "AcDbOleFrame") != 0)))
-                        {
-                                fprintf (stderr,
-                                  (_("Warning in %s () found a bad subclass marker in: %s in line: %d.\n")),
-                                  __FUNCTION__, fp->filename, fp->line_number);
-                        }
-                }
-                else if (strcmp (temp_string, "310") == 0)
-                {
-                        /* Now follows a string containing binary data. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, iter->value);
-                        iter->next = (struct DxfChar *) dxf_char_init ((DxfChar *) iter->next);
-                        iter = (DxfChar *) iter->next;
-                }
-                else if (strcmp (temp_string, "330") == 0)
-                {
-                        /* Now follows a string containing Soft-pointer
-                         * ID/handle to owner dictionary. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, oleframe->dictionary_owner_soft);
-                }
-                else if (strcmp (temp_string, "360") == 0)
-                {
-                        /* Now follows a string containing Hard owner
-                         * ID/handle to owner dictionary. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, oleframe->dictionary_owner_hard);
-                }
-                else if (strcmp (temp_string, "999") == 0)
-                {
-                        /* Now follows a string containing a comment. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
-                        fprintf (stdout, "DXF comment: %s\n", temp_string);
-                }
-                else
-                {
-                        fprintf (stderr,
-                          (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
-                          __FUNCTION__, fp->filename, fp->line_number);
+                                /* Skip the value of the unknown group code. */
+                                dxf_read_line (temp_string, fp);
+                                break;
                 }
         }
         /* Handle omitted members and/or illegal values. */
         if (strcmp (oleframe->linetype, "") == 0)
         {
-                oleframe->linetype = strdup (DXF_DEFAULT_LINETYPE);
+                oleframe->linetype = dxf_strdup (DXF_DEFAULT_LINETYPE);
         }
         if (strcmp (oleframe->layer, "") == 0)
         {
-                oleframe->layer = strdup (DXF_DEFAULT_LAYER);
+                oleframe->layer = dxf_strdup (DXF_DEFAULT_LAYER);
         }
-        /* Clean up. */
-        free (temp_string);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -371,7 +353,7 @@ dxf_oleframe_write
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        char *dxf_entity_name = strdup ("OLEFRAME");
+        char *dxf_entity_name = dxf_strdup ("OLEFRAME");
         DxfChar *iter = NULL;
 
         /* Do some basic checks. */
@@ -381,7 +363,7 @@ dxf_oleframe_write
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (oleframe == NULL)
@@ -390,7 +372,7 @@ dxf_oleframe_write
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (fp->acad_version_number < AutoCAD_13)
@@ -402,28 +384,28 @@ dxf_oleframe_write
         if (strcmp (oleframe->linetype, "") == 0)
         {
                 fprintf (stderr,
-                  (_("Warning in %s () empty linetype string for the %s entity with id-code: %x\n")),
+                  (_("Warning in %s () empty linetype string for the %s entity with id-code: %" PRIx64 "\n")),
                   __FUNCTION__, dxf_entity_name, oleframe->id_code);
                 fprintf (stderr,
                   (_("\t%s entity is reset to default linetype")),
                   dxf_entity_name);
-                oleframe->linetype = strdup (DXF_DEFAULT_LINETYPE);
+                oleframe->linetype = dxf_strdup (DXF_DEFAULT_LINETYPE);
         }
         if (strcmp (oleframe->layer, "") == 0)
         {
                 fprintf (stderr,
-                  (_("Warning in %s () empty layer string for the %s entity with id-code: %x\n")),
+                  (_("Warning in %s () empty layer string for the %s entity with id-code: %" PRIx64 "\n")),
                   __FUNCTION__, dxf_entity_name, oleframe->id_code);
                 fprintf (stderr,
                   (_("\t%s entity is relocated to layer 0")),
                   dxf_entity_name);
-                oleframe->layer = strdup (DXF_DEFAULT_LAYER);
+                oleframe->layer = dxf_strdup (DXF_DEFAULT_LAYER);
         }
         /* Start writing output. */
-        fprintf (fp->fp, "  0\n%s\n", dxf_entity_name);
-        if (oleframe->id_code != -1)
+        dxf_write_string (fp, 0, dxf_entity_name);
+        if (oleframe->id_code != DXF_HANDLE_NONE)
         {
-                fprintf (fp->fp, "  5\n%x\n", oleframe->id_code);
+                dxf_write_hex (fp, 5, oleframe->id_code);
         }
         /*!
          * \todo for version R14.\n
@@ -435,77 +417,77 @@ dxf_oleframe_write
          * 102 groups are application defined (optional).\n\n
          * End of group, "}" (optional), with Group code 102.
          */
-        if ((strcmp (oleframe->dictionary_owner_soft, "") != 0)
+        if ((oleframe->dictionary_owner_soft != 0)
           && (fp->acad_version_number >= AutoCAD_14))
         {
-                fprintf (fp->fp, "102\n{ACAD_REACTORS\n");
-                fprintf (fp->fp, "330\n%s\n", oleframe->dictionary_owner_soft);
-                fprintf (fp->fp, "102\n}\n");
+                dxf_write_string (fp, 102, "{ACAD_REACTORS");
+                dxf_write_hex (fp, 330, oleframe->dictionary_owner_soft);
+                dxf_write_string (fp, 102, "}");
         }
-        if ((strcmp (oleframe->dictionary_owner_hard, "") != 0)
+        if ((oleframe->dictionary_owner_hard != 0)
           && (fp->acad_version_number >= AutoCAD_14))
         {
-                fprintf (fp->fp, "102\n{ACAD_XDICTIONARY\n");
-                fprintf (fp->fp, "360\n%s\n", oleframe->dictionary_owner_hard);
-                fprintf (fp->fp, "102\n}\n");
+                dxf_write_string (fp, 102, "{ACAD_XDICTIONARY");
+                dxf_write_hex (fp, 360, oleframe->dictionary_owner_hard);
+                dxf_write_string (fp, 102, "}");
         }
         if (fp->acad_version_number >= AutoCAD_13)
         {
-                fprintf (fp->fp, "100\nAcDbEntity\n");
+                dxf_write_string (fp, 100, "AcDbEntity");
         }
         if (oleframe->paperspace == DXF_PAPERSPACE)
         {
-                fprintf (fp->fp, " 67\n%d\n", (int16_t) DXF_PAPERSPACE);
+                dxf_write_int (fp, 67, (int16_t) DXF_PAPERSPACE);
         }
-        fprintf (fp->fp, "  8\n%s\n", oleframe->layer);
+        dxf_write_string (fp, 8, oleframe->layer);
         if (strcmp (oleframe->linetype, DXF_DEFAULT_LINETYPE) != 0)
         {
-                fprintf (fp->fp, "  6\n%s\n", oleframe->linetype);
+                dxf_write_string (fp, 6, oleframe->linetype);
         }
         if ((fp->acad_version_number <= AutoCAD_11)
           && DXF_FLATLAND
           && (oleframe->elevation != 0.0))
         {
-                fprintf (fp->fp, " 38\n%f\n", oleframe->elevation);
+                dxf_write_double (fp, 38, oleframe->elevation);
         }
         if (oleframe->color != DXF_COLOR_BYLAYER)
         {
-                fprintf (fp->fp, " 62\n%d\n", oleframe->color);
+                dxf_write_int (fp, 62, oleframe->color);
         }
         if (oleframe->linetype_scale != 1.0)
         {
-                fprintf (fp->fp, " 48\n%f\n", oleframe->linetype_scale);
+                dxf_write_double (fp, 48, oleframe->linetype_scale);
         }
         if (oleframe->visibility != 0)
         {
-                fprintf (fp->fp, " 60\n%d\n", oleframe->visibility);
+                dxf_write_int (fp, 60, oleframe->visibility);
         }
         if (fp->acad_version_number >= AutoCAD_13)
         {
-                fprintf (fp->fp, "100\nAcDbOleFrame\n");
+                dxf_write_string (fp, 100, "AcDbOleFrame");
         }
         if (oleframe->thickness != 0.0)
         {
-                fprintf (fp->fp, " 39\n%f\n", oleframe->thickness);
+                dxf_write_double (fp, 39, oleframe->thickness);
         }
-        fprintf (fp->fp, " 70\n%d\n", oleframe->ole_version_number);
-        fprintf (fp->fp, " 90\n%ld\n", oleframe->length);
+        dxf_write_int (fp, 70, oleframe->ole_version_number);
+        dxf_write_int (fp, 90, oleframe->length);
         if (oleframe->binary_data != NULL)
         {
                 iter = (DxfChar*) oleframe->binary_data;
                 while ((iter != NULL) && (iter->value != NULL))
                 {
-                        fprintf (fp->fp, "310\n%s\n", iter->value);
+                        dxf_write_string (fp, 310, iter->value);
                         iter = (DxfChar*) iter->next;
                 }
         }
         else
         {
-                fprintf (fp->fp, "310\n\n");
+                dxf_write_string (fp, 310, "");
         }
-        fprintf (fp->fp, "  1\nOLE\n");
+        dxf_write_string (fp, 1, "OLE");
         /* Clean up. */
-        free (dxf_entity_name);
+        dxf_free (dxf_entity_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -546,12 +528,10 @@ dxf_oleframe_free
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        free (oleframe->linetype);
-        free (oleframe->layer);
-        free (oleframe->dictionary_owner_soft);
-        free (oleframe->dictionary_owner_hard);
+        dxf_string_free (oleframe->linetype);
+        dxf_string_free (oleframe->layer);
         dxf_char_free_list (oleframe->binary_data);
-        free (oleframe);
+        dxf_free (oleframe);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -597,7 +577,7 @@ dxf_oleframe_free_list
  *
  * \return \c id_code.
  */
-int
+uint64_t
 dxf_oleframe_get_id_code
 (
         DxfOleFrame *oleframe
@@ -615,12 +595,6 @@ dxf_oleframe_get_id_code
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (oleframe->id_code < 0)
-        {
-                fprintf (stderr,
-                  (_("Warning in %s () a negative value was found.\n")),
-                  __FUNCTION__);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -636,7 +610,7 @@ dxf_oleframe_set_id_code
 (
         DxfOleFrame *oleframe,
                 /*!< a pointer to a DXF \c OLEFRAME entity. */
-        int id_code
+        uint64_t id_code
                 /*!< Identification number for the entity.\n
                  * This is to be an unique (sequential) number in the DXF
                  * file. */
@@ -653,12 +627,6 @@ dxf_oleframe_set_id_code
                   __FUNCTION__);
                 return (NULL);
         }
-        if (id_code < 0)
-        {
-                fprintf (stderr,
-                  (_("Warning in %s () a negative value was passed.\n")),
-                  __FUNCTION__);
-        }
         oleframe->id_code = id_code;
 #if DEBUG
         DXF_DEBUG_END
@@ -700,7 +668,7 @@ dxf_oleframe_get_linetype
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (oleframe->linetype));
+        return (dxf_strdup (oleframe->linetype));
 }
 
 
@@ -734,7 +702,7 @@ dxf_oleframe_set_linetype
                   __FUNCTION__);
                 return (NULL);
         }
-        oleframe->linetype = strdup (linetype);
+        oleframe->linetype = dxf_strdup (linetype);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -775,7 +743,7 @@ dxf_oleframe_get_layer
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (oleframe->layer));
+        return (dxf_strdup (oleframe->layer));
 }
 
 
@@ -809,7 +777,7 @@ dxf_oleframe_set_layer
                   __FUNCTION__);
                 return (NULL);
         }
-        oleframe->layer = strdup (layer);
+        oleframe->layer = dxf_strdup (layer);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1534,10 +1502,8 @@ dxf_oleframe_set_binary_graphics_data
  * \c OLEFRAME entity.
  *
  * \return soft pointer to the dictionary owner.
- *
- * \warning No checks are performed on the returned pointer (string).
  */
-char *
+uint64_t
 dxf_oleframe_get_dictionary_owner_soft
 (
         DxfOleFrame *oleframe
@@ -1553,19 +1519,12 @@ dxf_oleframe_get_dictionary_owner_soft
                 fprintf (stderr,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
-                return (NULL);
-        }
-        if (oleframe->dictionary_owner_soft ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
+                return (0);
         }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (oleframe->dictionary_owner_soft));
+        return (oleframe->dictionary_owner_soft);
 }
 
 
@@ -1578,8 +1537,8 @@ dxf_oleframe_set_dictionary_owner_soft
 (
         DxfOleFrame *oleframe,
                 /*!< a pointer to a DXF \c OLEFRAME entity. */
-        char *dictionary_owner_soft
-                /*!< a string containing the pointer to the
+        uint64_t dictionary_owner_soft
+                /*!< the handle of the
                  * dictionary_owner_soft for the entity. */
 )
 {
@@ -1594,14 +1553,7 @@ dxf_oleframe_set_dictionary_owner_soft
                   __FUNCTION__);
                 return (NULL);
         }
-        if (dictionary_owner_soft == NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was passed.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
-        oleframe->dictionary_owner_soft = strdup (dictionary_owner_soft);
+        oleframe->dictionary_owner_soft = dictionary_owner_soft;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1612,12 +1564,10 @@ dxf_oleframe_set_dictionary_owner_soft
 /*!
  * \brief Get the pointer to the \c material from a DXF \c OLEFRAME entity.
  *
- * \return a pointer to \c material when successful, or \c NULL when an
+ * \return the handle \c material when successful, or 0 when an
  * error occurred.
- *
- * \warning No checks are performed on the returned pointer.
  */
-char *
+uint64_t
 dxf_oleframe_get_material
 (
         DxfOleFrame *oleframe
@@ -1633,19 +1583,12 @@ dxf_oleframe_get_material
                 fprintf (stderr,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
-                return (NULL);
-        }
-        if (oleframe->material ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
+                return (0);
         }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (oleframe->material));
+        return (oleframe->material);
 }
 
 
@@ -1661,8 +1604,8 @@ dxf_oleframe_set_material
 (
         DxfOleFrame *oleframe,
                 /*!< a pointer to a DXF \c OLEFRAME entity. */
-        char *material
-                /*!< a string containing the pointer to the \c
+        uint64_t material
+                /*!< the handle of the \c
                  * material for the entity. */
 )
 {
@@ -1677,14 +1620,7 @@ dxf_oleframe_set_material
                   __FUNCTION__);
                 return (NULL);
         }
-        if (material == NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was passed.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
-        oleframe->material = strdup (material);
+        oleframe->material = material;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1697,10 +1633,8 @@ dxf_oleframe_set_material
  * \c OLEFRAME entity.
  *
  * \return hard pointer to the dictionary owner.
- *
- * \warning No checks are performed on the returned pointer (string).
  */
-char *
+uint64_t
 dxf_oleframe_get_dictionary_owner_hard
 (
         DxfOleFrame *oleframe
@@ -1716,19 +1650,12 @@ dxf_oleframe_get_dictionary_owner_hard
                 fprintf (stderr,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
-                return (NULL);
-        }
-        if (oleframe->dictionary_owner_hard ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
+                return (0);
         }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (oleframe->dictionary_owner_hard));
+        return (oleframe->dictionary_owner_hard);
 }
 
 
@@ -1741,8 +1668,8 @@ dxf_oleframe_set_dictionary_owner_hard
 (
         DxfOleFrame *oleframe,
                 /*!< a pointer to a DXF \c OLEFRAME entity. */
-        char *dictionary_owner_hard
-                /*!< a string containing the pointer to the
+        uint64_t dictionary_owner_hard
+                /*!< the handle of the
                  * dictionary_owner_hard for the entity. */
 )
 {
@@ -1757,14 +1684,7 @@ dxf_oleframe_set_dictionary_owner_hard
                   __FUNCTION__);
                 return (NULL);
         }
-        if (dictionary_owner_hard == NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was passed.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
-        oleframe->dictionary_owner_hard = strdup (dictionary_owner_hard);
+        oleframe->dictionary_owner_hard = dictionary_owner_hard;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1840,10 +1760,10 @@ dxf_oleframe_set_lineweight
 /*!
  * \brief Get the \c plot_style_name from a DXF \c OLEFRAME entity.
  *
- * \return a pointer to \c plot_style_name when sucessful, or \c NULL
+ * \return the handle \c plot_style_name when sucessful, or 0
  * when an error occurred.
  */
-char *
+uint64_t
 dxf_oleframe_get_plot_style_name
 (
         DxfOleFrame *oleframe
@@ -1859,19 +1779,12 @@ dxf_oleframe_get_plot_style_name
                 fprintf (stderr,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
-                return (NULL);
-        }
-        if (oleframe->plot_style_name ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
+                return (0);
         }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (oleframe->plot_style_name));
+        return (oleframe->plot_style_name);
 }
 
 
@@ -1886,7 +1799,7 @@ dxf_oleframe_set_plot_style_name
 (
         DxfOleFrame *oleframe,
                 /*!< a pointer to a DXF \c OLEFRAME entity. */
-        char *plot_style_name
+        uint64_t plot_style_name
                 /*!< a string containing the \c plot_style_name for the
                  * entity. */
 )
@@ -1902,14 +1815,7 @@ dxf_oleframe_set_plot_style_name
                   __FUNCTION__);
                 return (NULL);
         }
-        if (plot_style_name == NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was passed.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
-        oleframe->plot_style_name = strdup (plot_style_name);
+        oleframe->plot_style_name = plot_style_name;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2016,7 +1922,7 @@ dxf_oleframe_get_color_name
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (oleframe->color_name));
+        return (dxf_strdup (oleframe->color_name));
 }
 
 
@@ -2054,7 +1960,7 @@ dxf_oleframe_set_color_name
                   __FUNCTION__);
                 return (NULL);
         }
-        oleframe->color_name = strdup (color_name);
+        oleframe->color_name = dxf_strdup (color_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -61,7 +61,7 @@ typedef struct
 dxf_oleframe_struct
 {
         /* Members common for all DXF drawable entities. */
-        int id_code;
+        uint64_t id_code;
                 /*!< Identification number for the entity.\n
                  * This is to be an unique (sequential) number in the DXF
                  * file.\n
@@ -134,16 +134,16 @@ dxf_oleframe_struct
                  * (optional).\n
                  * Group code = 310.\n
                  * \since Introduced in version R2000. */
-        char *dictionary_owner_soft;
+        uint64_t dictionary_owner_soft;
                 /*!< Soft-pointer ID/handle to owner dictionary (optional).\n
                  * Group code = 330.\n
                  * \since Introduced in version R14. */
-        char *material;
+        uint64_t material;
                 /*!< Hard-pointer ID/handle to material object (present if
                  * not BYLAYER).\n
                  * Group code = 347.\n
                  * \since Introduced in version R2008. */
-        char *dictionary_owner_hard;
+        uint64_t dictionary_owner_hard;
                 /*!< Hard owner ID/handle to owner dictionary (optional).\n
                  * Group code = 360.\n
                  * \since Introduced in version R14. */
@@ -152,7 +152,7 @@ dxf_oleframe_struct
                  * Stored and moved around as a 16-bit integer.\n
                  * Group code = 370.\n
                  * \since Introduced in version R2002. */
-        char *plot_style_name;
+        uint64_t plot_style_name;
                 /*!< Hard pointer ID / handle of PlotStyleName object.\n
                  * Group code = 390.\n
                  * \since Introduced in version R2009. */
@@ -206,8 +206,8 @@ DxfOleFrame *dxf_oleframe_read (DxfFile *fp, DxfOleFrame *oleframe);
 int dxf_oleframe_write (DxfFile *fp, DxfOleFrame *oleframe);
 int dxf_oleframe_free (DxfOleFrame *oleframe);
 void dxf_oleframe_free_list (DxfOleFrame *oleframes);
-int dxf_oleframe_get_id_code (DxfOleFrame *oleframe);
-DxfOleFrame *dxf_oleframe_set_id_code (DxfOleFrame *oleframe, int id_code);
+uint64_t dxf_oleframe_get_id_code (DxfOleFrame *oleframe);
+DxfOleFrame *dxf_oleframe_set_id_code (DxfOleFrame *oleframe, uint64_t id_code);
 char *dxf_oleframe_get_linetype (DxfOleFrame *oleframe);
 DxfOleFrame *dxf_oleframe_set_linetype (DxfOleFrame *oleframe, char *linetype);
 char *dxf_oleframe_get_layer (DxfOleFrame *oleframe);
@@ -230,16 +230,16 @@ int16_t dxf_oleframe_get_shadow_mode (DxfOleFrame *oleframe);
 DxfOleFrame *dxf_oleframe_set_shadow_mode (DxfOleFrame *oleframe, int16_t shadow_mode);
 DxfBinaryGraphicsData *dxf_oleframe_get_binary_graphics_data (DxfOleFrame *oleframe);
 DxfOleFrame *dxf_oleframe_set_binary_graphics_data (DxfOleFrame *oleframe, DxfBinaryGraphicsData *data);
-char *dxf_oleframe_get_dictionary_owner_soft (DxfOleFrame *oleframe);
-DxfOleFrame *dxf_oleframe_set_dictionary_owner_soft (DxfOleFrame *oleframe, char *dictionary_owner_soft);
-char *dxf_oleframe_get_material (DxfOleFrame *oleframe);
-DxfOleFrame *dxf_oleframe_set_material (DxfOleFrame *oleframe, char *material);
-char *dxf_oleframe_get_dictionary_owner_hard (DxfOleFrame *oleframe);
-DxfOleFrame *dxf_oleframe_set_dictionary_owner_hard (DxfOleFrame *oleframe, char *dictionary_owner_hard);
+uint64_t dxf_oleframe_get_dictionary_owner_soft (DxfOleFrame *oleframe);
+DxfOleFrame *dxf_oleframe_set_dictionary_owner_soft (DxfOleFrame *oleframe, uint64_t dictionary_owner_soft);
+uint64_t dxf_oleframe_get_material (DxfOleFrame *oleframe);
+DxfOleFrame *dxf_oleframe_set_material (DxfOleFrame *oleframe, uint64_t material);
+uint64_t dxf_oleframe_get_dictionary_owner_hard (DxfOleFrame *oleframe);
+DxfOleFrame *dxf_oleframe_set_dictionary_owner_hard (DxfOleFrame *oleframe, uint64_t dictionary_owner_hard);
 int16_t dxf_oleframe_get_lineweight (DxfOleFrame *oleframe);
 DxfOleFrame *dxf_oleframe_set_lineweight (DxfOleFrame *oleframe, int16_t lineweight);
-char *dxf_oleframe_get_plot_style_name (DxfOleFrame *oleframe);
-DxfOleFrame *dxf_oleframe_set_plot_style_name (DxfOleFrame *oleframe, char *plot_style_name);
+uint64_t dxf_oleframe_get_plot_style_name (DxfOleFrame *oleframe);
+DxfOleFrame *dxf_oleframe_set_plot_style_name (DxfOleFrame *oleframe, uint64_t plot_style_name);
 long dxf_oleframe_get_color_value (DxfOleFrame *oleframe);
 DxfOleFrame *dxf_oleframe_set_color_value (DxfOleFrame *oleframe, long color_value);
 char *dxf_oleframe_get_color_name (DxfOleFrame *oleframe);
@@ -0,0 +1,304 @@
+/*!
+ * \file parallel.c
+ *
+ * \author Copyright (C) 2026
+ * by Bert Timmerman <bert.timmerman@xs4all.nl>.
+ *
+ * \brief Functions for running libDXF tasks on worker threads.
+ *
+ * Serializing or parsing a large drawing is split into independent
+ * items (sections, or chunks of a section), which are processed on a
+ * number of worker threads.\n
+ * The results are collected in the calling thread in item order, so
+ * the output does not depend on the number of threads.\n
+ * Without POSIX threads (Windows) the items are processed in the
+ * calling thread.
+ *
+ * <hr>
+ * <h1><b>Copyright Notices.</b></h1>\n
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License,
+ * or (at your option) any later version.\n\n
+ * This program is distributed in the hope that it will be useful, but
+ * <b>WITHOUT ANY WARRANTY</b>; without even the implied warranty of
+ * <b>MERCHANTABILITY</b> or <b>FITNESS FOR A PARTICULAR PURPOSE</b>.\n
+ * See the GNU General Public License for more details.\n\n
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to:\n
+ * Free Software Foundation, Inc.,\n
+ * 59 Temple Place,\n
+ * Suite 330,\n
+ * Boston,\n
+ * MA 02111 USA.\n
+ * \n
+ * Drawing eXchange Format (DXF) is a defacto industry standard for the
+ * exchange of drawing files between various Computer Aided Drafting
+ * programs.\n
+ * DXF is an industry standard designed by Autodesk(TM).\n
+ * For more details see http://www.autodesk.com.
+ * <hr>
+ */
+
+
+
+#include "parallel.h"
+
+#if !defined (_WIN32)
+#  include <pthread.h>
+#  include <unistd.h>
+#  define DXF_PARALLEL_PTHREADS 1
+#endif
+
+
+/*!
+ * \brief State of an item of dxf_parallel_map ().
+ */
+enum dxf_parallel_state
+{
+        DXF_PARALLEL_PENDING,
+        DXF_PARALLEL_DONE,
+        DXF_PARALLEL_FAILED
+};
+
+
+#if DXF_PARALLEL_PTHREADS
+/*!
+ * \brief Shared state of the worker threads of dxf_parallel_map ().
+ */
+typedef struct
+dxf_parallel_struct
+{
+    pthread_mutex_t mutex;
+        /*!< Protects \c next, \c stop and \c states. */
+    pthread_cond_t cond;
+        /*!< Signalled when the task of an item finished. */
+    char *items;
+        /*!< The items. */
+    size_t item_size;
+        /*!< Size of an item. */
+    size_t number_items;
+        /*!< Number of items. */
+    size_t next;
+        /*!< Index of the next item to start. */
+    int stop;
+        /*!< Do not start more items. */
+    int *states;
+        /*!< State of every item. */
+    DxfParallelTask task;
+        /*!< Task to run for every item. */
+} DxfParallel;
+
+
+/*!
+ * \brief Worker thread of dxf_parallel_map (), runs the task for the
+ * next item until all items are started.
+ */
+static void *
+dxf_parallel_worker
+(
+        void *data
+                /*!< a pointer to the \c DxfParallel. */
+)
+{
+        DxfParallel *parallel = (DxfParallel *) data;
+        size_t i;
+        int result;
+
+        pthread_mutex_lock (&parallel->mutex);
+        while ((!parallel->stop) && (parallel->next < parallel->number_items))
+        {
+                i = parallel->next++;
+                pthread_mutex_unlock (&parallel->mutex);
+                result = parallel->task (parallel->items + i * parallel->item_size);
+                pthread_mutex_lock (&parallel->mutex);
+                parallel->states[i] = (result == EXIT_SUCCESS)
+                  ? DXF_PARALLEL_DONE : DXF_PARALLEL_FAILED;
+                pthread_cond_broadcast (&parallel->cond);
+        }
+        pthread_mutex_unlock (&parallel->mutex);
+        return (NULL);
+}
+#endif
+
+
+/*!
+ * \brief Get the number of processors available to run worker
+ * threads.
+ *
+ * \return the number of online processors, at least 1.
+ */
+int
+dxf_parallel_get_number_threads ()
+{
+#if DXF_PARALLEL_PTHREADS
+        long number_processors;
+
+        number_processors = sysconf (_SC_NPROCESSORS_ONLN);
+        if (number_processors > 1)
+        {
+                return ((int) number_processors);
+        }
+#endif
+        return (1);
+}
+
+
+/*!
+ * \brief Run a task for every item of an array on worker threads.
+ *
+ * Up to \c number_threads items are processed concurrently, in no
+ * particular order.\n
+ * \c done is called in the calling thread for item 0, 1, 2, ... as
+ * soon as the task of that item (and of all items before it) finished,
+ * so results can be consumed in order while later items are still
+ * being processed.\n
+ * When a task or \c done fails no more items are started, items
+ * already running are finished, \c done is not called for them.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when a task
+ * or \c done failed, or an error occurred.
+ */
+int
+dxf_parallel_map
+(
+        void *items,
+                /*!< a pointer to the first item. */
+        size_t item_size,
+                /*!< Size of an item. */
+        size_t number_items,
+                /*!< Number of items. */
+        int number_threads,
+                /*!< Number of worker threads, 0 for
+                 * dxf_parallel_get_number_threads (). */
+        DxfParallelTask task,
+                /*!< Task to run for every item. */
+        DxfParallelDone done,
+                /*!< Callback for every finished item, or \c NULL. */
+        void *user_data
+                /*!< Passed to \c done. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        char *item;
+        size_t i;
+        int result = EXIT_SUCCESS;
+#if DXF_PARALLEL_PTHREADS
+        DxfParallel parallel;
+        pthread_t *threads;
+        int number_started;
+        int state;
+        int j;
+#endif
+
+        /* Do some basic checks. */
+        if ((items == NULL) && (number_items > 0))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        if (task == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        if (number_threads <= 0)
+        {
+                number_threads = dxf_parallel_get_number_threads ();
+        }
+        if ((size_t) number_threads > number_items)
+        {
+                number_threads = (int) number_items;
+        }
+#if DXF_PARALLEL_PTHREADS
+        if (number_threads > 1)
+        {
+                memset (&parallel, 0, sizeof (DxfParallel));
+                parallel.items = (char *) items;
+                parallel.item_size = item_size;
+                parallel.number_items = number_items;
+                parallel.task = task;
+                parallel.states = calloc (number_items, sizeof (int));
+                threads = malloc (number_threads * sizeof (pthread_t));
+                if ((parallel.states == NULL) || (threads == NULL))
+                {
+                        fprintf (stderr,
+                          (_("Error in %s () could not allocate memory.\n")),
+                          __FUNCTION__);
+                        free (parallel.states);
+                        free (threads);
+                        return (EXIT_FAILURE);
+                }
+                pthread_mutex_init (&parallel.mutex, NULL);
+                pthread_cond_init (&parallel.cond, NULL);
+                for (number_started = 0; number_started < number_threads; number_started++)
+                {
+                        if (pthread_create (&threads[number_started], NULL,
+                          dxf_parallel_worker, &parallel) != 0)
+                        {
+                                break;
+                        }
+                }
+                if (number_started == 0)
+                {
+                        /* Fall back to the calling thread. */
+                        dxf_parallel_worker (&parallel);
+                }
+                for (i = 0; i < number_items; i++)
+                {
+                        pthread_mutex_lock (&parallel.mutex);
+                        while (parallel.states[i] == DXF_PARALLEL_PENDING)
+                        {
+                                pthread_cond_wait (&parallel.cond, &parallel.mutex);
+                        }
+                        state = parallel.states[i];
+                        pthread_mutex_unlock (&parallel.mutex);
+                        if ((state == DXF_PARALLEL_FAILED)
+                          || ((done != NULL)
+                          && (done (parallel.items + i * item_size, user_data) != EXIT_SUCCESS)))
+                        {
+                                result = EXIT_FAILURE;
+                                pthread_mutex_lock (&parallel.mutex);
+                                parallel.stop = TRUE;
+                                pthread_mutex_unlock (&parallel.mutex);
+                                break;
+                        }
+                }
+                for (j = 0; j < number_started; j++)
+                {
+                        pthread_join (threads[j], NULL);
+                }
+                pthread_cond_destroy (&parallel.cond);
+                pthread_mutex_destroy (&parallel.mutex);
+                free (parallel.states);
+                free (threads);
+#if DEBUG
+                DXF_DEBUG_END
+#endif
+                return (result);
+        }
+#endif
+        for (i = 0; i < number_items; i++)
+        {
+                item = (char *) items + i * item_size;
+                if ((task (item) != EXIT_SUCCESS)
+                  || ((done != NULL) && (done (item, user_data) != EXIT_SUCCESS)))
+                {
+                        result = EXIT_FAILURE;
+                        break;
+                }
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (result);
+}
+
+
+/* EOF */
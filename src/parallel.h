@@ -0,0 +1,79 @@
+/*!
+ * \file parallel.h
+ *
+ * \author Copyright (C) 2026
+ * by Bert Timmerman <bert.timmerman@xs4all.nl>.
+ *
+ * \brief Prototypes for running libDXF tasks on worker threads.
+ *
+ * <hr>
+ * <h1><b>Copyright Notices.</b></h1>\n
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License,
+ * or (at your option) any later version.\n\n
+ * This program is distributed in the hope that it will be useful, but
+ * <b>WITHOUT ANY WARRANTY</b>; without even the implied warranty of
+ * <b>MERCHANTABILITY</b> or <b>FITNESS FOR A PARTICULAR PURPOSE</b>.\n
+ * See the GNU General Public License for more details.\n\n
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to:\n
+ * Free Software Foundation, Inc.,\n
+ * 59 Temple Place,\n
+ * Suite 330,\n
+ * Boston,\n
+ * MA 02111 USA.\n
+ * \n
+ * Drawing eXchange Format (DXF) is a defacto industry standard for the
+ * exchange of drawing files between various Computer Aided Drafting
+ * programs.\n
+ * DXF is an industry standard designed by Autodesk(TM).\n
+ * For more details see http://www.autodesk.com.
+ * <hr>
+ */
+
+
+
+#ifndef LIBDXF_SRC_PARALLEL_H
+#define LIBDXF_SRC_PARALLEL_H
+
+
+#include "global.h"
+
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+/*!
+ * \brief Task run by dxf_parallel_map () for an item, on a worker
+ * thread.
+ *
+ * Return \c EXIT_SUCCESS when done, any other value stops the map.
+ */
+typedef int (*DxfParallelTask) (void *item);
+
+
+/*!
+ * \brief Callback of dxf_parallel_map (), called in the calling thread
+ * for every item in item order, after the task of the item finished.
+ *
+ * Return \c EXIT_SUCCESS to continue, any other value stops the map.
+ */
+typedef int (*DxfParallelDone) (void *item, void *user_data);
+
+
+int dxf_parallel_get_number_threads ();
+int dxf_parallel_map (void *items, size_t item_size, size_t number_items, int number_threads, DxfParallelTask task, DxfParallelDone done, void *user_data);
+
+
+#ifdef __cplusplus
+}
+#endif
+
+
+#endif /* LIBDXF_SRC_PARALLEL_H */
+
+
+/* EOF */
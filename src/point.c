@@ -57,6 +57,8 @@
 
 
 #include "point.h"
+#include "bbox.h"
+#include "util.h"
 
 
 /*!
@@ -76,7 +78,7 @@ dxf_point_new ()
         size = sizeof (DxfPoint);
         /* avoid malloc of 0 bytes */
         if (size == 0) size = 1;
-        if ((point = malloc (size)) == NULL)
+        if ((point = dxf_malloc (size)) == NULL)
         {
                 fprintf (stderr,
                   (_("Error in %s () could not allocate memory for a DxfPoint struct.\n")),
@@ -125,9 +127,9 @@ dxf_point_init
                   __FUNCTION__);
                 return (NULL);
         }
-        point->id_code = 0;
-        point->linetype = strdup (DXF_DEFAULT_LINETYPE);
-        point->layer = strdup (DXF_DEFAULT_LAYER);
+        point->id_code = DXF_HANDLE_NONE;
+        point->linetype = dxf_strdup (DXF_DEFAULT_LINETYPE);
+        point->layer = dxf_strdup (DXF_DEFAULT_LAYER);
         point->elevation = 0.0;
         point->thickness = 0.0;
         point->linetype_scale = DXF_DEFAULT_LINETYPE_SCALE;
@@ -138,14 +140,14 @@ dxf_point_init
         point->shadow_mode = 0;
         point->binary_graphics_data = (DxfBinaryData *) dxf_binary_data_new ();
         point->binary_graphics_data = (DxfBinaryData *) dxf_binary_data_init (point->binary_graphics_data);
-        point->dictionary_owner_soft = strdup ("");
-        point->object_owner_soft = strdup ("");
-        point->material = strdup ("");
-        point->dictionary_owner_hard = strdup ("");
+        point->dictionary_owner_soft = 0;
+        point->object_owner_soft = 0;
+        point->material = 0;
+        point->dictionary_owner_hard = 0;
         point->lineweight = 0;
-        point->plot_style_name = strdup ("");
+        point->plot_style_name = 0;
         point->color_value = 0;
-        point->color_name = strdup ("");
+        point->color_name = dxf_strdup ("");
         point->transparency = 0;
         point->x0 = 0.0;
         point->y0 = 0.0;
@@ -186,7 +188,8 @@ dxf_point_read
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        char *temp_string = NULL;
+        char temp_string[DXF_MAX_STRING_LENGTH];
+        int group_code;
         DxfBinaryData *iter310 = NULL;
         int iter330;
 
@@ -196,8 +199,6 @@ dxf_point_read
                 fprintf (stderr,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
-                /* Clean up. */
-                free (temp_string);
                 return (NULL);
         }
         if (point == NULL)
@@ -209,269 +210,223 @@ dxf_point_read
         }
         iter310 = (DxfBinaryData *) point->binary_graphics_data;
         iter330 = 0;
-        (fp->line_number)++;
-        fscanf (fp->fp, "%[^\n]", temp_string);
-        while (strcmp (temp_string, "0") != 0)
+        while ((dxf_read_group_code (fp, &group_code) == EXIT_SUCCESS)
+          && (group_code != 0))
         {
-                if (ferror (fp->fp))
+                if (dxf_read_error (fp))
                 {
                         fprintf (stderr,
                           (_("Error in %s () while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
-                        fclose (fp->fp);
-                        /* Clean up. */
-                        free (temp_string);
                         return (NULL);
                 }
-                if (strcmp (temp_string, "5") == 0)
-                {
-                        /* Now follows a string containing a sequential
-                         * id number. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%x\n", (uint *) &point->id_code);
-                }
-                else if (strcmp (temp_string, "6") == 0)
-                {
-                        /* Now follows a string containing a linetype
-                         * name. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, point->linetype);
-                }
-                else if (strcmp (temp_string, "8") == 0)
-                {
-                        /* Now follows a string containing a layer name. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, point->layer);
-                }
-                else if (strcmp (temp_string, "10") == 0)
-                {
-                        /* Now follows a string containing the
-                         * X-coordinate of the center point. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &point->x0);
-                }
-                else if (strcmp (temp_string, "20") == 0)
-                {
-                        /* Now follows a string containing the
-                         * Y-coordinate of the center point. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &point->y0);
-                }
-                else if (strcmp (temp_string, "30") == 0)
-                {
-                        /* Now follows a string containing the
-                         * Z-coordinate of the center point. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &point->z0);
-                }
-                else if ((fp->acad_version_number <= AutoCAD_11)
-                        && (strcmp (temp_string, "38") == 0)
-                        && (point->elevation != 0.0))
-                {
-                        /* Now follows a string containing the
-                         * elevation. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &point->elevation);
-                }
-                else if (strcmp (temp_string, "39") == 0)
-                {
-                        /* Now follows a string containing the
-                         * thickness. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &point->thickness);
-                }
-                else if (strcmp (temp_string, "48") == 0)
-                {
-                        /* Now follows a string containing the linetype
-                         * scale. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &point->linetype_scale);
-                }
-                else if (strcmp (temp_string, "50") == 0)
-                {
-                        /* Now follows a string containing the
-                         * start angle. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &point->angle_to_X);
-                }
-                else if (strcmp (temp_string, "60") == 0)
-                {
-                        /* Now follows a string containing the
-                         * visibility value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%hd\n", &point->visibility);
-                }
-                else if (strcmp (temp_string, "62") == 0)
-                {
-                        /* Now follows a string containing the
-                         * color value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%hd\n", &point->color);
-                }
-                else if (strcmp (temp_string, "67") == 0)
-                {
-                        /* Now follows a string containing the
-                         * paperspace value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%hd\n", &point->paperspace);
-                }
-                else if (strcmp (temp_string, "92") == 0)
-                {
-                        /* Now follows a string containing the
-                         * graphics data size value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%" PRIi32 "\n", &point->graphics_data_size);
-                }
-                else if ((fp->acad_version_number >= AutoCAD_13)
-                        && (strcmp (temp_string, "100") == 0))
+                switch (group_code)
                 {
-                        /* Now follows a string containing the
-                         * subclass marker value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
-                        if ((strcmp (temp_string, "AcDbEntity") != 0)
-                        && ((strcmp (temp_string, "AcDbPoint") != 0)))
-                        {
+                        case 5:
+                                /* Now follows a string containing a sequential
+                                 * id number. */
+                                dxf_read_handle (fp, &point->id_code);
+                                break;
+                        case 6:
+                                /* Now follows a string containing a linetype
+                                 * name. */
+                                dxf_read_string_interned (fp, &point->linetype);
+                                break;
+                        case 8:
+                                /* Now follows a string containing a layer name. */
+                                dxf_read_string_interned (fp, &point->layer);
+                                break;
+                        case 10:
+                                /* Now follows a string containing the
+                                 * X-coordinate of the center point. */
+                                dxf_read_double (fp, &point->x0);
+                                break;
+                        case 20:
+                                /* Now follows a string containing the
+                                 * Y-coordinate of the center point. */
+                                dxf_read_double (fp, &point->y0);
+                                break;
+                        case 30:
+                                /* Now follows a string containing the
+                                 * Z-coordinate of the center point. */
+                                dxf_read_double (fp, &point->z0);
+                                break;
+                        case 38:
+                                if ((fp->acad_version_number <= AutoCAD_11) && (point->elevation != 0.0))
+                                {
+                                        /* Now follows a string containing the
+                                         * elevation. */
+                                        dxf_read_double (fp, &point->elevation);
+                                }
+                                else
+                                {
+                                        fprintf (stderr,
+                                          (_("Warning: in %s () unknown string tag found while reading from: %s in line: %d.\n")),
+                                          __FUNCTION__, fp->filename, fp->line_number);
+                                        /* Skip the value of the unknown group code. */
+                                        dxf_read_line (temp_string, fp);
+                                }
+                                break;
+                        case 39:
+                                /* Now follows a string containing the
+                                 * thickness. */
+                                dxf_read_double (fp, &point->thickness);
+                                break;
+                        case 48:
+                                /* Now follows a string containing the linetype
+                                 * scale. */
+                                dxf_read_double (fp, &point->linetype_scale);
+                                break;
+                        case 50:
+                                /* Now follows a string containing the
+                                 * start angle. */
+                                dxf_read_double (fp, &point->angle_to_X);
+                                break;
+                        case 60:
+                                /* Now follows a string containing the
+                                 * visibility value. */
+                                dxf_read_int16 (fp, &point->visibility);
+                                break;
+                        case 62:
+                                /* Now follows a string containing the
+                                 * color value. */
+                                dxf_read_int16 (fp, &point->color);
+                                break;
+                        case 67:
+                                /* Now follows a string containing the
+                                 * paperspace value. */
+                                dxf_read_int16 (fp, &point->paperspace);
+                                break;
+                        case 92:
+                                /* Now follows a string containing the
+                                 * graphics data size value. */
+                                dxf_read_int32 (fp, &point->graphics_data_size);
+                                break;
+                        case 100:
+                                if (fp->acad_version_number >= AutoCAD_13)
+                                {
+                                        /* Now follows a string containing the
+                                         * subclass marker value. */
+                                        dxf_read_line (temp_string, fp);
+                                        if ((strcmp (temp_string, "AcDbEntity") != 0)
+                                        && ((strcmp (temp_string, "AcDbPoint") != 0)))
+                                        {
+                                                fprintf (stderr,
+                                                  (_("Warning in %s () found a bad subclass marker in: %s in line: %d.\n")),
+                                                  __FUNCTION__, fp->filename, fp->line_number);
+                                        }
+                                }
+                                else
+                                {
+                                        fprintf (stderr,
+                                          (_("Warning: in %s () unknown string tag found while reading from: %s in line: %d.\n")),
+                                          __FUNCTION__, fp->filename, fp->line_number);
+                                        /* Skip the value of the unknown group code. */
+                                        dxf_read_line (temp_string, fp);
+                                }
+                                break;
+                        case 160:
+                                /* Now follows a string containing the
+                                 * graphics data size value. */
+                                dxf_read_int32 (fp, &point->graphics_data_size);
+                                break;
+                        case 210:
+                                /* Now follows a string containing the
+                                 * X-value of the extrusion vector. */
+                                dxf_read_double (fp, &point->extr_x0);
+                                break;
+                        case 220:
+                                /* Now follows a string containing the
+                                 * Y-value of the extrusion vector. */
+                                dxf_read_double (fp, &point->extr_y0);
+                                break;
+                        case 230:
+                                /* Now follows a string containing the
+                                 * Z-value of the extrusion vector. */
+                                dxf_read_double (fp, &point->extr_z0);
+                                break;
+                        case 284:
+                                /* Now follows a string containing the shadow
+                                 * mode value. */
+                                dxf_read_int16 (fp, &point->shadow_mode);
+                                break;
+                        case 310:
+                                /* Now follows a string containing binary
+                                 * graphics data. */
+                                iter310 = dxf_binary_data_read (fp, iter310);
+                                break;
+                        case 330:
+                                if (iter330 == 0)
+                                {
+                                        /* Now follows a string containing a soft-pointer
+                                         * ID/handle to owner dictionary. */
+                                        dxf_read_handle (fp, &point->dictionary_owner_soft);
+                                }
+                                if (iter330 == 1)
+                                {
+                                        /* Now follows a string containing a soft-pointer
+                                         * ID/handle to owner object. */
+                                        dxf_read_handle (fp, &point->object_owner_soft);
+                                }
+                                iter330++;
+                                break;
+                        case 347:
+                                /* Now follows a string containing a
+                                 * hard-pointer ID/handle to material object. */
+                                dxf_read_handle (fp, &point->material);
+                                break;
+                        case 360:
+                                /* Now follows a string containing Hard owner
+                                 * ID/handle to owner dictionary. */
+                                dxf_read_handle (fp, &point->dictionary_owner_hard);
+                                break;
+                        case 370:
+                                /* Now follows a string containing the lineweight
+                                 * value. */
+                                dxf_read_int16 (fp, &point->lineweight);
+                                break;
+                        case 390:
+                                /* Now follows a string containing a plot style
+                                 * name value. */
+                                dxf_read_handle (fp, &point->plot_style_name);
+                                break;
+                        case 420:
+                                /* Now follows a string containing a color value. */
+                                dxf_read_int32 (fp, &point->color_value);
+                                break;
+                        case 430:
+                                /* Now follows a string containing a color
+                                 * name value. */
+                                dxf_read_string_interned (fp, &point->color_name);
+                                break;
+                        case 440:
+                                /* Now follows a string containing a transparency
+                                 * value. */
+                                dxf_read_int32 (fp, &point->transparency);
+                                break;
+                        case 999:
+                                /* Now follows a string containing a comment. */
+                                dxf_read_line (temp_string, fp);
+                                fprintf (stdout, "DXF comment: %s\n", temp_string);
+                                break;
+                        default:
                                 fprintf (stderr,
-                                  (_("Warning in %s () found a bad subclass marker in: %s in line: %d.\n")),
+                                  (_("Warning: in %s () unknown string tag found while reading from: %s in line: %d.\n")),
                                   __FUNCTION__, fp->filename, fp->line_number);
-                        }
-                }
-                else if (strcmp (temp_string, "160") == 0)
-                {
-                        /* Now follows a string containing the
-                         * graphics data size value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%" PRIi32 "\n", &point->graphics_data_size);
-                }
-                else if (strcmp (temp_string, "210") == 0)
-                {
-                        /* Now follows a string containing the
-                         * X-value of the extrusion vector. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &point->extr_x0);
-                }
-                else if (strcmp (temp_string, "220") == 0)
-                {
-                        /* Now follows a string containing the
-                         * Y-value of the extrusion vector. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &point->extr_y0);
-                }
-                else if (strcmp (temp_string, "230") == 0)
-                {
-                        /* Now follows a string containing the
-                         * Z-value of the extrusion vector. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &point->extr_z0);
-                }
-                else if (strcmp (temp_string, "284") == 0)
-                {
-                        /* Now follows a string containing the shadow
-                         * mode value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%hd\n", &point->shadow_mode);
-                }
-                else if (strcmp (temp_string, "310") == 0)
-                {
-                        /* Now follows a string containing binary
-                         * graphics data. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, iter310->data_line);
-                        dxf_binary_data_init ((DxfBinaryData *) iter310->next);
-                        iter310 = (DxfBinaryData *) iter310->next;
-                }
-                else if (strcmp (temp_string, "330") == 0)
-                {
-                        if (iter330 == 0)
-                        {
-                                /* Now follows a string containing a soft-pointer
-                                 * ID/handle to owner dictionary. */
-                                (fp->line_number)++;
-                                fscanf (fp->fp, DXF_MAX_STRING_FORMAT, point->dictionary_owner_soft);
-                        }
-                        if (iter330 == 1)
-                        {
-                                /* Now follows a string containing a soft-pointer
-                                 * ID/handle to owner object. */
-                                (fp->line_number)++;
-                                fscanf (fp->fp, DXF_MAX_STRING_FORMAT, point->object_owner_soft);
-                        }
-                        iter330++;
-                }
-                else if (strcmp (temp_string, "347") == 0)
-                {
-                        /* Now follows a string containing a
-                         * hard-pointer ID/handle to material object. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, point->material);
-                }
-                else if (strcmp (temp_string, "360") == 0)
-                {
-                        /* Now follows a string containing Hard owner
-                         * ID/handle to owner dictionary. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, point->dictionary_owner_hard);
-                }
-                else if (strcmp (temp_string, "370") == 0)
-                {
-                        /* Now follows a string containing the lineweight
-                         * value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%hd\n", &point->lineweight);
-                }
-                else if (strcmp (temp_string, "390") == 0)
-                {
-                        /* Now follows a string containing a plot style
-                         * name value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, point->plot_style_name);
-                }
-                else if (strcmp (temp_string, "420") == 0)
-                {
-                        /* Now follows a string containing a color value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%" PRIi32 "\n", &point->color_value);
-                }
-                else if (strcmp (temp_string, "430") == 0)
-                {
-                        /* Now follows a string containing a color
-                         * name value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", point->color_name);
-                }
-                else if (strcmp (temp_string, "440") == 0)
-                {
-                        /* Now follows a string containing a transparency
-                         * value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%" PRIi32 "\n", &point->transparency);
-                }
-                else if (strcmp (temp_string, "999") == 0)
-                {
-                        /* Now follows a string containing a comment. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
-                        fprintf (stdout, "DXF comment: %s\n", temp_string);
-                }
-                else
-                {
-                        fprintf (stderr,
-                          (_("Warning: in %s () unknown string tag found while reading from: %s in line: %d.\n")),
-                          __FUNCTION__, fp->filename, fp->line_number);
+                                /* Skip the value of the unknown group code. */
+                                dxf_read_line (temp_string, fp);
+                                break;
                 }
         }
         /* Handle omitted members and/or illegal values. */
         if (strcmp (point->linetype, "") == 0)
         {
-                point->linetype = strdup (DXF_DEFAULT_LINETYPE);
+                point->linetype = dxf_strdup (DXF_DEFAULT_LINETYPE);
         }
         if (strcmp (point->layer, "") == 0)
         {
-                point->layer = strdup (DXF_DEFAULT_LAYER);
+                point->layer = dxf_strdup (DXF_DEFAULT_LAYER);
         }
-        /* Clean up. */
-        free (temp_string);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -497,7 +452,7 @@ dxf_point_write
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        char *dxf_entity_name = strdup ("POINT");
+        char *dxf_entity_name = dxf_strdup ("POINT");
 
         /* Do some basic checks. */
         if (fp == NULL)
@@ -506,7 +461,7 @@ dxf_point_write
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (point == NULL)
@@ -515,35 +470,35 @@ dxf_point_write
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (strcmp (point->linetype, "") == 0)
         {
                 fprintf (stderr,
-                  (_("Warning in %s () empty linetype string for the %s entity with id-code: %x\n")),
+                  (_("Warning in %s () empty linetype string for the %s entity with id-code: %" PRIx64 "\n")),
                   __FUNCTION__, dxf_entity_name, point->id_code);
                 fprintf (stderr,
                   (_("\t%s entity is reset to default linetype")),
                   dxf_entity_name);
-                point->linetype = strdup (DXF_DEFAULT_LINETYPE);
+                point->linetype = dxf_strdup (DXF_DEFAULT_LINETYPE);
         }
         if (strcmp (point->layer, "") == 0)
         {
                 fprintf (stderr,
-                  (_("Warning in %s () empty layer string for the %s entity with id-code: %x\n")),
+                  (_("Warning in %s () empty layer string for the %s entity with id-code: %" PRIx64 "\n")),
                   __FUNCTION__, dxf_entity_name,
                         point->id_code);
                 fprintf (stderr,
                   (_("\t%s entity is relocated to layer 0")),
                   dxf_entity_name);
-                point->layer = strdup (DXF_DEFAULT_LAYER);
+                point->layer = dxf_strdup (DXF_DEFAULT_LAYER);
         }
         /* Start writing output. */
-        fprintf (fp->fp, "  0\n%s\n", dxf_entity_name);
-        if (point->id_code != -1)
+        dxf_write_string (fp, 0, dxf_entity_name);
+        if (point->id_code != DXF_HANDLE_NONE)
         {
-                fprintf (fp->fp, "  5\n%x\n", point->id_code);
+                dxf_write_hex (fp, 5, point->id_code);
         }
         /*!
          * \todo for version R14.\n
@@ -555,70 +510,70 @@ dxf_point_write
          * 102 groups are application defined (optional).\n\n
          * End of group, "}" (optional), with Group code 102.
          */
-        if ((strcmp (point->dictionary_owner_soft, "") != 0)
+        if ((point->dictionary_owner_soft != 0)
           && (fp->acad_version_number >= AutoCAD_14))
         {
-                fprintf (fp->fp, "102\n{ACAD_REACTORS\n");
-                fprintf (fp->fp, "330\n%s\n", point->dictionary_owner_soft);
-                fprintf (fp->fp, "102\n}\n");
+                dxf_write_string (fp, 102, "{ACAD_REACTORS");
+                dxf_write_hex (fp, 330, point->dictionary_owner_soft);
+                dxf_write_string (fp, 102, "}");
         }
-        if ((strcmp (point->dictionary_owner_hard, "") != 0)
+        if ((point->dictionary_owner_hard != 0)
           && (fp->acad_version_number >= AutoCAD_14))
         {
-                fprintf (fp->fp, "102\n{ACAD_XDICTIONARY\n");
-                fprintf (fp->fp, "360\n%s\n", point->dictionary_owner_hard);
-                fprintf (fp->fp, "102\n}\n");
+                dxf_write_string (fp, 102, "{ACAD_XDICTIONARY");
+                dxf_write_hex (fp, 360, point->dictionary_owner_hard);
+                dxf_write_string (fp, 102, "}");
         }
         if (fp->acad_version_number >= AutoCAD_13)
         {
-                fprintf (fp->fp, "100\nAcDbEntity\n");
+                dxf_write_string (fp, 100, "AcDbEntity");
         }
         if (point->paperspace == DXF_PAPERSPACE)
         {
-                fprintf (fp->fp, " 67\n%hd\n", (int16_t) DXF_PAPERSPACE);
+                dxf_write_int (fp, 67, (int16_t) DXF_PAPERSPACE);
         }
-        fprintf (fp->fp, "  8\n%s\n", point->layer);
+        dxf_write_string (fp, 8, point->layer);
         if (strcmp (point->linetype, DXF_DEFAULT_LINETYPE) != 0)
         {
-                fprintf (fp->fp, "  6\n%s\n", point->linetype);
+                dxf_write_string (fp, 6, point->linetype);
         }
         if ((fp->acad_version_number >= AutoCAD_2008)
-          && (strcmp (point->material, "") != 0))
+          && (point->material != 0))
         {
-                fprintf (fp->fp, "347\n%s\n", point->material);
+                dxf_write_hex (fp, 347, point->material);
         }
         if (point->color != DXF_COLOR_BYLAYER)
         {
-                fprintf (fp->fp, " 62\n%hd\n", point->color);
+                dxf_write_int (fp, 62, point->color);
         }
         if (fp->acad_version_number >= AutoCAD_2002)
         {
-                fprintf (fp->fp, "370\n%d\n", point->lineweight);
+                dxf_write_int (fp, 370, point->lineweight);
         }
         if ((fp->acad_version_number <= AutoCAD_11)
           && DXF_FLATLAND
           && (point->elevation != 0.0))
         {
-                fprintf (fp->fp, " 38\n%f\n", point->elevation);
+                dxf_write_double (fp, 38, point->elevation);
         }
         if (point->thickness != 0.0)
         {
-                fprintf (fp->fp, " 39\n%f\n", point->thickness);
+                dxf_write_double (fp, 39, point->thickness);
         }
         if (point->linetype_scale != 1.0)
         {
-                fprintf (fp->fp, " 48\n%f\n", point->linetype_scale);
+                dxf_write_double (fp, 48, point->linetype_scale);
         }
         if (point->visibility != 0)
         {
-                fprintf (fp->fp, " 60\n%hd\n", point->visibility);
+                dxf_write_int (fp, 60, point->visibility);
         }
         if (fp->acad_version_number >= AutoCAD_2000)
         {
 #ifdef BUILD_64
-                fprintf (fp->fp, "160\n%" PRIi32 "\n", point->graphics_data_size);
+                dxf_write_int (fp, 160, point->graphics_data_size);
 #else
-                fprintf (fp->fp, " 92\n%" PRIi32 "\n", point->graphics_data_size);
+                dxf_write_int (fp, 92, point->graphics_data_size);
 #endif
                 if (point->binary_graphics_data != NULL)
                 {
@@ -626,41 +581,41 @@ dxf_point_write
                         iter = (DxfBinaryData *) point->binary_graphics_data;
                         while (iter != NULL)
                         {
-                                fprintf (fp->fp, "310\n%s\n", iter->data_line);
+                                dxf_binary_data_write (fp, iter);
                                 iter = (DxfBinaryData *) iter->next;
                         }
                 }
         }
         if (fp->acad_version_number >= AutoCAD_2004)
         {
-                fprintf (fp->fp, "420\n%" PRIi32 "\n", point->color_value);
-                fprintf (fp->fp, "430\n%s\n", point->color_name);
-                fprintf (fp->fp, "440\n%" PRIi32 "\n", point->transparency);
+                dxf_write_int (fp, 420, point->color_value);
+                dxf_write_string (fp, 430, point->color_name);
+                dxf_write_int (fp, 440, point->transparency);
         }
         if (fp->acad_version_number >= AutoCAD_2009)
         {
-                fprintf (fp->fp, "390\n%s\n", point->plot_style_name);
-                fprintf (fp->fp, "284\n%d\n", point->shadow_mode);
+                dxf_write_hex (fp, 390, point->plot_style_name);
+                dxf_write_int (fp, 284, point->shadow_mode);
         }
         if (fp->acad_version_number >= AutoCAD_13)
         {
-                fprintf (fp->fp, "100\nAcDbPoint\n");
+                dxf_write_string (fp, 100, "AcDbPoint");
         }
-        fprintf (fp->fp, " 10\n%f\n", point->x0);
-        fprintf (fp->fp, " 20\n%f\n", point->y0);
-        fprintf (fp->fp, " 30\n%f\n", point->z0);
+        dxf_write_double (fp, 10, point->x0);
+        dxf_write_double (fp, 20, point->y0);
+        dxf_write_double (fp, 30, point->z0);
         if ((fp->acad_version_number >= AutoCAD_12)
                 && (point->extr_x0 != 0.0)
                 && (point->extr_y0 != 0.0)
                 && (point->extr_z0 != 1.0))
         {
-                fprintf (fp->fp, "210\n%f\n", point->extr_x0);
-                fprintf (fp->fp, "220\n%f\n", point->extr_y0);
-                fprintf (fp->fp, "230\n%f\n", point->extr_z0);
+                dxf_write_double (fp, 210, point->extr_x0);
+                dxf_write_double (fp, 220, point->extr_y0);
+                dxf_write_double (fp, 230, point->extr_z0);
         }
-        fprintf (fp->fp, " 50\n%f\n", point->angle_to_X);
+        dxf_write_double (fp, 50, point->angle_to_X);
         /* Clean up. */
-        free (dxf_entity_name);
+        dxf_free (dxf_entity_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -701,11 +656,9 @@ dxf_point_free
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        free (point->linetype);
-        free (point->layer);
-        free (point->dictionary_owner_soft);
-        free (point->dictionary_owner_hard);
-        free (point);
+        dxf_string_free (point->linetype);
+        dxf_string_free (point->layer);
+        dxf_free (point);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -751,7 +704,7 @@ dxf_point_free_list
  *
  * \return \c id_code.
  */
-int
+uint64_t
 dxf_point_get_id_code
 (
         DxfPoint *point
@@ -769,12 +722,6 @@ dxf_point_get_id_code
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (point->id_code < 0)
-        {
-                fprintf (stderr,
-                  (_("Warning in %s () a negative value was found.\n")),
-                  __FUNCTION__);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -793,7 +740,7 @@ dxf_point_set_id_code
 (
         DxfPoint *point,
                 /*!< a pointer to a DXF \c POINT entity. */
-        int id_code
+        uint64_t id_code
                 /*!< Identification number for the entity.\n
                  * This is to be an unique (sequential) number in the DXF
                  * file. */
@@ -810,12 +757,6 @@ dxf_point_set_id_code
                   __FUNCTION__);
                 return (NULL);
         }
-        if (id_code < 0)
-        {
-                fprintf (stderr,
-                  (_("Warning in %s () a negative value was passed.\n")),
-                  __FUNCTION__);
-        }
         point->id_code = id_code;
 #if DEBUG
         DXF_DEBUG_END
@@ -857,7 +798,7 @@ dxf_point_get_linetype
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (point->linetype));
+        return (dxf_strdup (point->linetype));
 }
 
 
@@ -894,7 +835,7 @@ dxf_point_set_linetype
                   __FUNCTION__);
                 return (NULL);
         }
-        point->linetype = strdup (linetype);
+        point->linetype = dxf_strdup (linetype);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -935,7 +876,7 @@ dxf_point_get_layer
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (point->layer));
+        return (dxf_strdup (point->layer));
 }
 
 
@@ -972,7 +913,7 @@ dxf_point_set_layer
                   __FUNCTION__);
                 return (NULL);
         }
-        point->layer = strdup (layer);
+        point->layer = dxf_strdup (layer);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1717,11 +1658,9 @@ dxf_point_set_binary_graphics_data
  * \brief Get the pointer to the \c dictionary_owner_soft from a DXF 
  * \c POINT entity.
  *
- * \return pointer to the \c dictionary_owner_soft.
- *
- * \warning No checks are performed on the returned pointer.
+ * \return the handle of the \c dictionary_owner_soft.
  */
-char *
+uint64_t
 dxf_point_get_dictionary_owner_soft
 (
         DxfPoint *point
@@ -1737,19 +1676,12 @@ dxf_point_get_dictionary_owner_soft
                 fprintf (stderr,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
-                return (NULL);
-        }
-        if (point->dictionary_owner_soft ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
+                return (0);
         }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (point->dictionary_owner_soft));
+        return (point->dictionary_owner_soft);
 }
 
 
@@ -1765,8 +1697,8 @@ dxf_point_set_dictionary_owner_soft
 (
         DxfPoint *point,
                 /*!< a pointer to a DXF \c POINT entity. */
-        char *dictionary_owner_soft
-                /*!< a string containing the pointer to the
+        uint64_t dictionary_owner_soft
+                /*!< the handle of the
                  * \c dictionary_owner_soft for the entity. */
 )
 {
@@ -1781,14 +1713,7 @@ dxf_point_set_dictionary_owner_soft
                   __FUNCTION__);
                 return (NULL);
         }
-        if (dictionary_owner_soft == NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was passed.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
-        point->dictionary_owner_soft = strdup (dictionary_owner_soft);
+        point->dictionary_owner_soft = dictionary_owner_soft;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1799,12 +1724,10 @@ dxf_point_set_dictionary_owner_soft
 /*!
  * \brief Get the pointer to the \c material from a DXF \c POINT entity.
  *
- * \return a pointer to \c material when successful, or \c NULL when an
+ * \return the handle \c material when successful, or 0 when an
  * error occurred.
- *
- * \warning No checks are performed on the returned pointer.
  */
-char *
+uint64_t
 dxf_point_get_material
 (
         DxfPoint *point
@@ -1820,19 +1743,12 @@ dxf_point_get_material
                 fprintf (stderr,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
-                return (NULL);
-        }
-        if (point->material ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
+                return (0);
         }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (point->material));
+        return (point->material);
 }
 
 
@@ -1847,8 +1763,8 @@ dxf_point_set_material
 (
         DxfPoint *point,
                 /*!< a pointer to a DXF \c POINT entity. */
-        char *material
-                /*!< a string containing the pointer to the \c
+        uint64_t material
+                /*!< the handle of the \c
                  * material for the entity. */
 )
 {
@@ -1863,14 +1779,7 @@ dxf_point_set_material
                   __FUNCTION__);
                 return (NULL);
         }
-        if (material == NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was passed.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
-        point->material = strdup (material);
+        point->material = material;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1882,11 +1791,9 @@ dxf_point_set_material
  * \brief Get the pointer to the \c dictionary_owner_hard from a DXF 
  * \c POINT entity.
  *
- * \return pointer to the \c dictionary_owner_hard.
- *
- * \warning No checks are performed on the returned pointer.
+ * \return the handle of the \c dictionary_owner_hard.
  */
-char *
+uint64_t
 dxf_point_get_dictionary_owner_hard
 (
         DxfPoint *point
@@ -1902,19 +1809,12 @@ dxf_point_get_dictionary_owner_hard
                 fprintf (stderr,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
-                return (NULL);
-        }
-        if (point->dictionary_owner_hard ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
+                return (0);
         }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (point->dictionary_owner_hard));
+        return (point->dictionary_owner_hard);
 }
 
 
@@ -1930,8 +1830,8 @@ dxf_point_set_dictionary_owner_hard
 (
         DxfPoint *point,
                 /*!< a pointer to a DXF \c POINT entity. */
-        char *dictionary_owner_hard
-                /*!< a string containing the pointer to the
+        uint64_t dictionary_owner_hard
+                /*!< the handle of the
                  * \c dictionary_owner_hard for the entity. */
 )
 {
@@ -1946,14 +1846,7 @@ dxf_point_set_dictionary_owner_hard
                   __FUNCTION__);
                 return (NULL);
         }
-        if (dictionary_owner_hard == NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was passed.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
-        point->dictionary_owner_hard = strdup (dictionary_owner_hard);
+        point->dictionary_owner_hard = dictionary_owner_hard;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2029,10 +1922,10 @@ dxf_point_set_lineweight
 /*!
  * \brief Get the \c plot_style_name from a DXF \c POINT entity.
  *
- * \return \c plot_style_name when sucessful, or \c NULL when an error
+ * \return \c plot_style_name when sucessful, or 0 when an error
  * occurred.
  */
-char *
+uint64_t
 dxf_point_get_plot_style_name
 (
         DxfPoint *point
@@ -2048,19 +1941,12 @@ dxf_point_get_plot_style_name
                 fprintf (stderr,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
-                return (NULL);
-        }
-        if (point->plot_style_name ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
+                return (0);
         }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (point->plot_style_name));
+        return (point->plot_style_name);
 }
 
 
@@ -2075,7 +1961,7 @@ dxf_point_set_plot_style_name
 (
         DxfPoint *point,
                 /*!< a pointer to a DXF \c POINT entity. */
-        char *plot_style_name
+        uint64_t plot_style_name
                 /*!< a string containing the \c plot_style_name for the
                  * entity. */
 )
@@ -2091,14 +1977,7 @@ dxf_point_set_plot_style_name
                   __FUNCTION__);
                 return (NULL);
         }
-        if (plot_style_name == NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was passed.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
-        point->plot_style_name = strdup (plot_style_name);
+        point->plot_style_name = plot_style_name;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2205,7 +2084,7 @@ dxf_point_get_color_name
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (point->color_name));
+        return (dxf_strdup (point->color_name));
 }
 
 
@@ -2243,7 +2122,7 @@ dxf_point_set_color_name
                   __FUNCTION__);
                 return (NULL);
         }
-        point->color_name = strdup (color_name);
+        point->color_name = dxf_strdup (color_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2788,4 +2667,103 @@ dxf_point_get_last
 }
 
 
+/*!
+ * \brief Get the bounding box of a DXF \c POINT.
+ *
+ * The box of the single point of \c point.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_point_get_bbox
+(
+        DxfPoint *point,
+                /*!< a pointer to a DXF \c POINT entity. */
+        DxfBbox *bbox
+                /*!< a pointer to the libDXF bounding box to fill. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        /* Do some basic checks. */
+        if ((point == NULL) || (bbox == NULL))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        dxf_bbox_init (bbox);
+        dxf_bbox_add_point (bbox, point->x0, point->y0, point->z0);
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Transform a DXF \c POINT entity in place.
+ *
+ * The location is in world coordinates, the extrusion direction and
+ * thickness follow the transformation.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_point_transform
+(
+        DxfPoint *point,
+                /*!< a pointer to a DXF \c POINT entity. */
+        DxfTransform *transform
+                /*!< a pointer to a libDXF affine transformation. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfVec3 location;
+        DxfVec3 extrusion;
+        double length;
+
+        /* Do some basic checks. */
+        if ((point == NULL) || (transform == NULL))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        location.x = point->x0;
+        location.y = point->y0;
+        location.z = point->z0;
+        dxf_transform_apply_point (transform, &location, &location);
+        point->x0 = location.x;
+        point->y0 = location.y;
+        point->z0 = location.z;
+        /* The thickness is measured along the extrusion direction. */
+        extrusion.x = point->extr_x0;
+        extrusion.y = point->extr_y0;
+        extrusion.z = point->extr_z0;
+        dxf_transform_apply_vector (transform, &extrusion, &extrusion);
+        length = sqrt ((extrusion.x * extrusion.x)
+          + (extrusion.y * extrusion.y)
+          + (extrusion.z * extrusion.z));
+        if (length > 0.0)
+        {
+                point->extr_x0 = extrusion.x / length;
+                point->extr_y0 = extrusion.y / length;
+                point->extr_z0 = extrusion.z / length;
+                point->thickness *= length;
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (EXIT_SUCCESS);
+}
+
+
 /* EOF */
@@ -40,6 +40,7 @@
 
 #include "global.h"
 #include "binary_data.h"
+#include "transform.h"
 
 
 #ifdef __cplusplus
@@ -72,7 +73,7 @@ typedef struct
 dxf_point_struct
 {
         /* Members common for all DXF drawable entities. */
-        int id_code;
+        uint64_t id_code;
                 /*!< group code = 5\n
                  * Identification number for the entity.\n
                  * This is to be an unique (sequential) number in the DXF
@@ -131,25 +132,25 @@ dxf_point_struct
                  * Multiple lines of 256 characters maximum per line
                  * (optional).\n
                  * Group code = 310. */
-        char *dictionary_owner_soft;
+        uint64_t dictionary_owner_soft;
                 /*!< group code = 330\n
                  * Soft-pointer ID/handle to owner dictionary (optional). */
-        char *object_owner_soft;
+        uint64_t object_owner_soft;
                 /*!< Soft-pointer ID/handle  to owner BLOCK_RECORD object.\n
                  * Group code = 330.\n
                  * \since Introduced in version R2000. */
-        char *material;
+        uint64_t material;
                 /*!< Hard-pointer ID/handle to material object (present if
                  * not BYLAYER).\n
                  * Group code = 347. */
-        char *dictionary_owner_hard;
+        uint64_t dictionary_owner_hard;
                 /*!< group code = 360\n
                  * Hard owner ID/handle to owner dictionary (optional). */
         int16_t lineweight;
                 /*!< Lineweight enum value.\n
                  * Stored and moved around as a 16-bit integer.\n
                  * Group code = 370. */
-        char *plot_style_name;
+        uint64_t plot_style_name;
                 /*!< Hard pointer ID / handle of PlotStyleName object.\n
                  * Group code = 390. */
         int32_t color_value;
@@ -213,8 +214,8 @@ DxfPoint *dxf_point_read (DxfFile *fp, DxfPoint *point);
 int dxf_point_write (DxfFile *fp, DxfPoint *point);
 int dxf_point_free (DxfPoint *point);
 void dxf_point_free_list (DxfPoint *points);
-int dxf_point_get_id_code (DxfPoint *point);
-DxfPoint *dxf_point_set_id_code (DxfPoint *point, int id_code);
+uint64_t dxf_point_get_id_code (DxfPoint *point);
+DxfPoint *dxf_point_set_id_code (DxfPoint *point, uint64_t id_code);
 char *dxf_point_get_linetype (DxfPoint *point);
 DxfPoint *dxf_point_set_linetype (DxfPoint *point, char *linetype);
 char *dxf_point_get_layer (DxfPoint *point);
@@ -237,16 +238,16 @@ int16_t dxf_point_get_shadow_mode (DxfPoint *point);
 DxfPoint *dxf_point_set_shadow_mode (DxfPoint *point, int16_t shadow_mode);
 DxfBinaryData *dxf_point_get_binary_graphics_data (DxfPoint *point);
 DxfPoint *dxf_point_set_binary_graphics_data (DxfPoint *point, DxfBinaryData *data);
-char *dxf_point_get_dictionary_owner_soft (DxfPoint *point);
-DxfPoint *dxf_point_set_dictionary_owner_soft (DxfPoint *point, char *dictionary_owner_soft);
-char *dxf_point_get_material (DxfPoint *point);
-DxfPoint *dxf_point_set_material (DxfPoint *point, char *material);
-char *dxf_point_get_dictionary_owner_hard (DxfPoint *point);
-DxfPoint *dxf_point_set_dictionary_owner_hard (DxfPoint *point, char *dictionary_owner_hard);
+uint64_t dxf_point_get_dictionary_owner_soft (DxfPoint *point);
+DxfPoint *dxf_point_set_dictionary_owner_soft (DxfPoint *point, uint64_t dictionary_owner_soft);
+uint64_t dxf_point_get_material (DxfPoint *point);
+DxfPoint *dxf_point_set_material (DxfPoint *point, uint64_t material);
+uint64_t dxf_point_get_dictionary_owner_hard (DxfPoint *point);
+DxfPoint *dxf_point_set_dictionary_owner_hard (DxfPoint *point, uint64_t dictionary_owner_hard);
 int16_t dxf_point_get_lineweight (DxfPoint *point);
 DxfPoint *dxf_point_set_lineweight (DxfPoint *point, int16_t lineweight);
-char *dxf_point_get_plot_style_name (DxfPoint *point);
-DxfPoint *dxf_point_set_plot_style_name (DxfPoint *point, char *plot_style_name);
+uint64_t dxf_point_get_plot_style_name (DxfPoint *point);
+DxfPoint *dxf_point_set_plot_style_name (DxfPoint *point, uint64_t plot_style_name);
 int32_t dxf_point_get_color_value (DxfPoint *point);
 DxfPoint *dxf_point_set_color_value (DxfPoint *point, int32_t color_value);
 char *dxf_point_get_color_name (DxfPoint *point);
@@ -266,6 +267,8 @@ DxfPoint *dxf_point_set_extrusion_vector (DxfPoint *point, double extr_x0, doubl
 DxfPoint *dxf_point_get_next (DxfPoint *point);
 DxfPoint *dxf_point_set_next (DxfPoint *point, DxfPoint *next);
 DxfPoint *dxf_point_get_last (DxfPoint *point);
+int dxf_point_get_bbox (DxfPoint *point, DxfBbox *bbox);
+int dxf_point_transform (DxfPoint *point, DxfTransform *transform);
 
 
 #ifdef __cplusplus
@@ -42,6 +42,8 @@
 
 
 #include "polyline.h"
+#include "bbox.h"
+#include "util.h"
 
 
 /*!
@@ -61,7 +63,7 @@ dxf_polyline_new ()
         size = sizeof (DxfPolyline);
         /* avoid malloc of 0 bytes */
         if (size == 0) size = 1;
-        if ((polyline = malloc (size)) == NULL)
+        if ((polyline = dxf_malloc (size)) == NULL)
         {
                 fprintf (stderr,
                   (_("Error in %s () could not allocate memory for a DxfArc struct.\n")),
@@ -111,8 +113,8 @@ dxf_polyline_init
               return (NULL);
         }
         dxf_polyline_set_id_code (polyline, 0);
-        dxf_polyline_set_linetype (polyline, strdup (DXF_DEFAULT_LINETYPE));
-        dxf_polyline_set_layer (polyline, strdup (DXF_DEFAULT_LAYER));
+        dxf_polyline_set_linetype (polyline, dxf_strdup (DXF_DEFAULT_LINETYPE));
+        dxf_polyline_set_layer (polyline, dxf_strdup (DXF_DEFAULT_LAYER));
         dxf_polyline_set_elevation (polyline, 0.0);
         dxf_polyline_set_thickness (polyline, 0.0);
         dxf_polyline_set_linetype_scale (polyline, DXF_DEFAULT_LINETYPE_SCALE);
@@ -122,13 +124,13 @@ dxf_polyline_init
         dxf_polyline_set_graphics_data_size (polyline, 0);
         dxf_polyline_set_shadow_mode (polyline, 0);
         dxf_polyline_set_binary_graphics_data (polyline, (DxfBinaryGraphicsData *) dxf_binary_graphics_data_new ());
-        dxf_polyline_set_dictionary_owner_soft (polyline, strdup (""));
-        dxf_polyline_set_material (polyline, strdup (""));
-        dxf_polyline_set_dictionary_owner_hard (polyline, strdup (""));
+        dxf_polyline_set_dictionary_owner_soft (polyline, 0);
+        dxf_polyline_set_material (polyline, 0);
+        dxf_polyline_set_dictionary_owner_hard (polyline, 0);
         dxf_polyline_set_lineweight (polyline, 0);
-        dxf_polyline_set_plot_style_name (polyline, strdup (""));
+        dxf_polyline_set_plot_style_name (polyline, 0);
         dxf_polyline_set_color_value (polyline, 0);
-        dxf_polyline_set_color_name (polyline, strdup (""));
+        dxf_polyline_set_color_name (polyline, dxf_strdup (""));
         dxf_polyline_set_transparency (polyline, 0);
         dxf_polyline_set_p0 (polyline, (DxfPoint *) dxf_point_new ());
         dxf_point_init ((DxfPoint *) dxf_polyline_get_p0 (polyline));
@@ -182,7 +184,8 @@ dxf_polyline_read
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        char *temp_string = NULL;
+        char temp_string[DXF_MAX_STRING_LENGTH];
+        int group_code;
 
         /* Do some basic checks. */
         if (fp == NULL)
@@ -190,8 +193,6 @@ dxf_polyline_read
                 fprintf (stderr,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
-                /* Clean up. */
-                free (temp_string);
                 return (NULL);
         }
         if (polyline == NULL)
@@ -201,236 +202,178 @@ dxf_polyline_read
                   __FUNCTION__);
                 polyline = dxf_polyline_init (polyline);
         }
-        (fp->line_number)++;
-        fscanf (fp->fp, "%[^\n]", temp_string);
-        while (strcmp (temp_string, "0") != 0)
+        while ((dxf_read_group_code (fp, &group_code) == EXIT_SUCCESS)
+          && (group_code != 0))
         {
-                if (ferror (fp->fp))
+                if (dxf_read_error (fp))
                 {
                         fprintf (stderr,
                           (_("Error in %s () while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
-                        fclose (fp->fp);
-                        /* Clean up. */
-                        free (temp_string);
                         return (NULL);
                 }
-                if (strcmp (temp_string, "5") == 0)
-                {
-                        /* Now follows a string containing a sequential
-                         * id number. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%x\n", (uint *) &polyline->id_code);
-                }
-                else if (strcmp (temp_string, "6") == 0)
-                {
-                        /* Now follows a string containing a linetype
-                         * name. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, polyline->linetype);
-                }
-                else if (strcmp (temp_string, "8") == 0)
-                {
-                        /* Now follows a string containing a layer name. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, polyline->layer);
-                }
-                else if (strcmp (temp_string, "10") == 0)
-                {
-                        /* Now follows a string containing the
-                         * X-coordinate of the primary point. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &polyline->p0->x0);
-                }
-                else if (strcmp (temp_string, "20") == 0)
-                {
-                        /* Now follows a string containing the
-                         * Y-coordinate of the primary point. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &polyline->p0->y0);
-                }
-                else if (strcmp (temp_string, "30") == 0)
-                {
-                        /* Now follows a string containing the
-                         * Z-coordinate of the primary point. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &polyline->p0->z0);
-                }
-                else if (strcmp (temp_string, "38") == 0)
-                {
-                        /* Now follows a string containing the
-                         * elevation. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &polyline->elevation);
-                }
-                else if (strcmp (temp_string, "39") == 0)
-                {
-                        /* Now follows a string containing the
-                         * thickness. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &polyline->thickness);
-                }
-                else if (strcmp (temp_string, "40") == 0)
-                {
-                        /* Now follows a string containing the
-                         * starting width. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &polyline->start_width);
-                }
-                else if (strcmp (temp_string, "41") == 0)
-                {
-                        /* Now follows a string containing the
-                         * end width. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &polyline->end_width);
-                }
-                else if (strcmp (temp_string, "48") == 0)
-                {
-                        /* Now follows a string containing the linetype
-                         * scale. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &polyline->linetype_scale);
-                }
-                else if (strcmp (temp_string, "60") == 0)
-                {
-                        /* Now follows a string containing the
-                         * visibility value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%hd\n", &polyline->visibility);
-                }
-                else if (strcmp (temp_string, "62") == 0)
-                {
-                        /* Now follows a string containing the
-                         * color value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%d\n", &polyline->color);
-                }
-                else if (strcmp (temp_string, "66") == 0)
-                {
-                        /* Now follows a string containing the
-                         * vertces follow flag. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%d\n", &polyline->vertices_follow);
-                }
-                else if (strcmp (temp_string, "67") == 0)
-                {
-                        /* Now follows a string containing the
-                         * paperspace value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%d\n", &polyline->paperspace);
-                }
-                else if (strcmp (temp_string, "70") == 0)
-                {
-                        /* Now follows a string containing the
-                         * flag value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%d\n", &polyline->flag);
-                }
-                else if (strcmp (temp_string, "71") == 0)
-                {
-                        /* Now follows a string containing the polygon
-                         * mesh M vertex count value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%d\n", &polyline->polygon_mesh_M_vertex_count);
-                }
-                else if (strcmp (temp_string, "72") == 0)
-                {
-                        /* Now follows a string containing the polygon
-                         * mesh N vertex count value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%d\n", &polyline->polygon_mesh_N_vertex_count);
-                }
-                else if (strcmp (temp_string, "73") == 0)
-                {
-                        /* Now follows a string containing the smooth M
-                         * surface density value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%d\n", &polyline->smooth_M_surface_density);
-                }
-                else if (strcmp (temp_string, "74") == 0)
-                {
-                        /* Now follows a string containing the smooth N
-                         * surface density value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%d\n", &polyline->smooth_M_surface_density);
-                }
-                else if (strcmp (temp_string, "75") == 0)
-                {
-                        /* Now follows a string containing the surface
-                         * type value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%d\n", &polyline->surface_type);
-                }
-                else if (strcmp (temp_string, "100") == 0)
-                {
-                        /* Subclass markers are post AutoCAD R12
-                         * variable so additional testing for the
-                         * version should probably be added here.
-                         * Now follows a string containing the
-                         * subclass marker value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
-                }
-                else if (strcmp (temp_string, "210") == 0)
-                {
-                        /* Now follows a string containing the
-                         * X-value of the extrusion vector. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &polyline->extr_x0);
-                }
-                else if (strcmp (temp_string, "220") == 0)
-                {
-                        /* Now follows a string containing the
-                         * Y-value of the extrusion vector. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &polyline->extr_y0);
-                }
-                else if (strcmp (temp_string, "230") == 0)
-                {
-                        /* Now follows a string containing the
-                         * Z-value of the extrusion vector. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &polyline->extr_z0);
-                }
-                else if (strcmp (temp_string, "330") == 0)
-                {
-                        /* Now follows a string containing Soft-pointer
-                         * ID/handle to owner dictionary. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, polyline->dictionary_owner_soft);
-                }
-                else if (strcmp (temp_string, "360") == 0)
-                {
-                        /* Now follows a string containing Hard owner
-                         * ID/handle to owner dictionary. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, polyline->dictionary_owner_hard);
-                }
-                else if (strcmp (temp_string, "999") == 0)
+                switch (group_code)
                 {
-                        /* Now follows a string containing a comment. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
-                        fprintf (stdout, "DXF comment: %s\n", temp_string);
-                }
-                else
-                {
-                        fprintf (stderr,
-                          (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
-                          __FUNCTION__, fp->filename, fp->line_number);
+                        case 5:
+                                /* Now follows a string containing a sequential
+                                 * id number. */
+                                dxf_read_handle (fp, &polyline->id_code);
+                                break;
+                        case 6:
+                                /* Now follows a string containing a linetype
+                                 * name. */
+                                dxf_read_string_interned (fp, &polyline->linetype);
+                                break;
+                        case 8:
+                                /* Now follows a string containing a layer name. */
+                                dxf_read_string_interned (fp, &polyline->layer);
+                                break;
+                        case 10:
+                                /* Now follows a string containing the
+                                 * X-coordinate of the primary point. */
+                                dxf_read_double (fp, &polyline->p0->x0);
+                                break;
+                        case 20:
+                                /* Now follows a string containing the
+                                 * Y-coordinate of the primary point. */
+                                dxf_read_double (fp, &polyline->p0->y0);
+                                break;
+                        case 30:
+                                /* Now follows a string containing the
+                                 * Z-coordinate of the primary point. */
+                                dxf_read_double (fp, &polyline->p0->z0);
+                                break;
+                        case 38:
+                                /* Now follows a string containing the
+                                 * elevation. */
+                                dxf_read_double (fp, &polyline->elevation);
+                                break;
+                        case 39:
+                                /* Now follows a string containing the
+                                 * thickness. */
+                                dxf_read_double (fp, &polyline->thickness);
+                                break;
+                        case 40:
+                                /* Now follows a string containing the
+                                 * starting width. */
+                                dxf_read_double (fp, &polyline->start_width);
+                                break;
+                        case 41:
+                                /* Now follows a string containing the
+                                 * end width. */
+                                dxf_read_double (fp, &polyline->end_width);
+                                break;
+                        case 48:
+                                /* Now follows a string containing the linetype
+                                 * scale. */
+                                dxf_read_double (fp, &polyline->linetype_scale);
+                                break;
+                        case 60:
+                                /* Now follows a string containing the
+                                 * visibility value. */
+                                dxf_read_int16 (fp, &polyline->visibility);
+                                break;
+                        case 62:
+                                /* Now follows a string containing the
+                                 * color value. */
+                                dxf_read_int (fp, &polyline->color);
+                                break;
+                        case 66:
+                                /* Now follows a string containing the
+                                 * vertces follow flag. */
+                                dxf_read_int (fp, &polyline->vertices_follow);
+                                break;
+                        case 67:
+                                /* Now follows a string containing the
+                                 * paperspace value. */
+                                dxf_read_int (fp, &polyline->paperspace);
+                                break;
+                        case 70:
+                                /* Now follows a string containing the
+                                 * flag value. */
+                                dxf_read_int (fp, &polyline->flag);
+                                break;
+                        case 71:
+                                /* Now follows a string containing the polygon
+                                 * mesh M vertex count value. */
+                                dxf_read_int (fp, &polyline->polygon_mesh_M_vertex_count);
+                                break;
+                        case 72:
+                                /* Now follows a string containing the polygon
+                                 * mesh N vertex count value. */
+                                dxf_read_int (fp, &polyline->polygon_mesh_N_vertex_count);
+                                break;
+                        case 73:
+                                /* Now follows a string containing the smooth M
+                                 * surface density value. */
+                                dxf_read_int (fp, &polyline->smooth_M_surface_density);
+                                break;
+                        case 74:
+                                /* Now follows a string containing the smooth N
+                                 * surface density value. */
+                                dxf_read_int (fp, &polyline->smooth_M_surface_density);
+                                break;
+                        case 75:
+                                /* Now follows a string containing the surface
+                                 * type value. */
+                                dxf_read_int (fp, &polyline->surface_type);
+                                break;
+                        case 100:
+                                /* Subclass markers are post AutoCAD R12
+                                 * variable so additional testing for the
+                                 * version should probably be added here.
+                                 * Now follows a string containing the
+                                 * subclass marker value. */
+                                dxf_read_line (temp_string, fp);
+                                break;
+                        case 210:
+                                /* Now follows a string containing the
+                                 * X-value of the extrusion vector. */
+                                dxf_read_double (fp, &polyline->extr_x0);
+                                break;
+                        case 220:
+                                /* Now follows a string containing the
+                                 * Y-value of the extrusion vector. */
+                                dxf_read_double (fp, &polyline->extr_y0);
+                                break;
+                        case 230:
+                                /* Now follows a string containing the
+                                 * Z-value of the extrusion vector. */
+                                dxf_read_double (fp, &polyline->extr_z0);
+                                break;
+                        case 330:
+                                /* Now follows a string containing Soft-pointer
+                                 * ID/handle to owner dictionary. */
+                                dxf_read_handle (fp, &polyline->dictionary_owner_soft);
+                                break;
+                        case 360:
+                                /* Now follows a string containing Hard owner
+                                 * ID/handle to owner dictionary. */
+                                dxf_read_handle (fp, &polyline->dictionary_owner_hard);
+                                break;
+                        case 999:
+                                /* Now follows a string containing a comment. */
+                                dxf_read_line (temp_string, fp);
+                                fprintf (stdout, "DXF comment: %s\n", temp_string);
+                                break;
+                        default:
+                                fprintf (stderr,
+                                  (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
+                                  __FUNCTION__, fp->filename, fp->line_number);
+                                /* Skip the value of the unknown group code. */
+                                dxf_read_line (temp_string, fp);
+                                break;
                 }
         }
         /* Handle omitted members and/or illegal values. */
         if (strcmp (dxf_polyline_get_linetype (polyline), "") == 0)
         {
-                dxf_polyline_set_linetype (polyline, strdup (DXF_DEFAULT_LINETYPE));
+                dxf_polyline_set_linetype (polyline, dxf_strdup (DXF_DEFAULT_LINETYPE));
         }
         if (strcmp (dxf_polyline_get_layer (polyline), "") == 0)
         {
-                dxf_polyline_set_layer (polyline, strdup (DXF_DEFAULT_LAYER));
+                dxf_polyline_set_layer (polyline, dxf_strdup (DXF_DEFAULT_LAYER));
         }
-        /* Clean up. */
-        free (temp_string);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -456,7 +399,7 @@ dxf_polyline_write
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        char *dxf_entity_name = strdup ("POLYLINE");
+        char *dxf_entity_name = dxf_strdup ("POLYLINE");
         DxfVertex *iter = NULL;
 
         /* Do some basic checks. */
@@ -466,7 +409,7 @@ dxf_polyline_write
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (polyline == NULL)
@@ -475,61 +418,61 @@ dxf_polyline_write
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (dxf_polyline_get_x0 (polyline) != 0.0)
         {
                 fprintf (stderr,
-                  (_("Error in %s () start point has an invalid X-value for the %s entity with id-code: %x\n")),
+                  (_("Error in %s () start point has an invalid X-value for the %s entity with id-code: %" PRIx64 "\n")),
                   __FUNCTION__, dxf_entity_name, dxf_polyline_get_id_code (polyline));
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (dxf_polyline_get_y0 (polyline) != 0.0)
         {
                 fprintf (stderr,
-                  (_("Error in %s () start point has an invalid Y-value for the %s entity with id-code: %x\n")),
+                  (_("Error in %s () start point has an invalid Y-value for the %s entity with id-code: %" PRIx64 "\n")),
                   __FUNCTION__, dxf_entity_name, dxf_polyline_get_id_code (polyline));
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (dxf_polyline_get_vertices_follow (polyline) != 1)
         {
                 fprintf (stderr,
-                  (_("Error in %s () vertices follow flag has an invalid value for the %s entity with id-code: %x\n")),
+                  (_("Error in %s () vertices follow flag has an invalid value for the %s entity with id-code: %" PRIx64 "\n")),
                   __FUNCTION__, dxf_entity_name, dxf_polyline_get_id_code (polyline));
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (strcmp (dxf_polyline_get_linetype (polyline), "") == 0)
         {
                 fprintf (stderr,
-                  (_("Warning in %s () empty linetype string for the %s entity with id-code: %x\n")),
+                  (_("Warning in %s () empty linetype string for the %s entity with id-code: %" PRIx64 "\n")),
                   __FUNCTION__, dxf_entity_name, dxf_polyline_get_id_code (polyline));
                 fprintf (stderr,
                   (_("\t%s entity is reset to default linetype")),
                   dxf_entity_name);
-                dxf_polyline_set_linetype (polyline, strdup (DXF_DEFAULT_LINETYPE));
+                dxf_polyline_set_linetype (polyline, dxf_strdup (DXF_DEFAULT_LINETYPE));
         }
         if (strcmp (dxf_polyline_get_layer (polyline), "") == 0)
         {
                 fprintf (stderr,
-                  (_("Warning in %s () empty layer string for the %s entity with id-code: %x\n")),
+                  (_("Warning in %s () empty layer string for the %s entity with id-code: %" PRIx64 "\n")),
                   __FUNCTION__, dxf_entity_name, dxf_polyline_get_id_code (polyline));
                 fprintf (stderr,
                   (_("\t%s entity is relocated to layer 0\n")),
                   dxf_entity_name);
-                dxf_polyline_set_layer (polyline, strdup (DXF_DEFAULT_LAYER));
+                dxf_polyline_set_layer (polyline, dxf_strdup (DXF_DEFAULT_LAYER));
         }
         /* Start writing output. */
-        fprintf (fp->fp, "  0\n%s\n", dxf_entity_name);
-        if (dxf_polyline_get_id_code (polyline) != -1)
+        dxf_write_string (fp, 0, dxf_entity_name);
+        if (dxf_polyline_get_id_code (polyline) != DXF_HANDLE_NONE)
         {
-                fprintf (fp->fp, "  5\n%x\n", dxf_polyline_get_id_code (polyline));
+                dxf_write_hex (fp, 5, dxf_polyline_get_id_code (polyline));
         }
         /*!
          * \todo for version R14.\n
@@ -541,88 +484,88 @@ dxf_polyline_write
          * 102 groups are application defined (optional).\n\n
          * End of group, "}" (optional), with Group code 102.
          */
-        if ((strcmp (polyline->dictionary_owner_soft, "") != 0)
+        if ((polyline->dictionary_owner_soft != 0)
           && (fp->acad_version_number >= AutoCAD_14))
         {
-                fprintf (fp->fp, "102\n{ACAD_REACTORS\n");
-                fprintf (fp->fp, "330\n%s\n", dxf_polyline_get_dictionary_owner_soft (polyline));
-                fprintf (fp->fp, "102\n}\n");
+                dxf_write_string (fp, 102, "{ACAD_REACTORS");
+                dxf_write_hex (fp, 330, dxf_polyline_get_dictionary_owner_soft (polyline));
+                dxf_write_string (fp, 102, "}");
         }
-        if ((strcmp (polyline->dictionary_owner_hard, "") != 0)
+        if ((polyline->dictionary_owner_hard != 0)
           && (fp->acad_version_number >= AutoCAD_14))
         {
-                fprintf (fp->fp, "102\n{ACAD_XDICTIONARY\n");
-                fprintf (fp->fp, "360\n%s\n", dxf_polyline_get_dictionary_owner_hard (polyline));
-                fprintf (fp->fp, "102\n}\n");
+                dxf_write_string (fp, 102, "{ACAD_XDICTIONARY");
+                dxf_write_hex (fp, 360, dxf_polyline_get_dictionary_owner_hard (polyline));
+                dxf_write_string (fp, 102, "}");
         }
         if (fp->acad_version_number >= AutoCAD_13)
         {
-                fprintf (fp->fp, "100\nAcDbEntity\n");
+                dxf_write_string (fp, 100, "AcDbEntity");
         }
         if (dxf_polyline_get_paperspace (polyline) == DXF_PAPERSPACE)
         {
-                fprintf (fp->fp, " 67\n%d\n", (int16_t) DXF_PAPERSPACE);
+                dxf_write_int (fp, 67, (int16_t) DXF_PAPERSPACE);
         }
-        fprintf (fp->fp, "  8\n%s\n", dxf_polyline_get_layer (polyline));
+        dxf_write_string (fp, 8, dxf_polyline_get_layer (polyline));
         if (strcmp (dxf_polyline_get_linetype (polyline), DXF_DEFAULT_LINETYPE) != 0)
         {
-                fprintf (fp->fp, "  6\n%s\n", dxf_polyline_get_linetype (polyline));
+                dxf_write_string (fp, 6, dxf_polyline_get_linetype (polyline));
         }
         if ((fp->acad_version_number <= AutoCAD_11)
           && DXF_FLATLAND
           && (dxf_polyline_get_elevation (polyline) != 0.0))
         {
-                fprintf (fp->fp, " 38\n%f\n", dxf_polyline_get_elevation (polyline));
+                dxf_write_double (fp, 38, dxf_polyline_get_elevation (polyline));
         }
         if (dxf_polyline_get_color (polyline) != DXF_COLOR_BYLAYER)
         {
-                fprintf (fp->fp, " 62\n%d\n", dxf_polyline_get_color (polyline));
+                dxf_write_int (fp, 62, dxf_polyline_get_color (polyline));
         }
         if (dxf_polyline_get_linetype_scale (polyline) != 1.0)
         {
-                fprintf (fp->fp, " 48\n%f\n", dxf_polyline_get_linetype_scale (polyline));
+                dxf_write_double (fp, 48, dxf_polyline_get_linetype_scale (polyline));
         }
         if (dxf_polyline_get_visibility (polyline) != 0)
         {
-                fprintf (fp->fp, " 60\n%d\n", dxf_polyline_get_visibility (polyline));
+                dxf_write_int (fp, 60, dxf_polyline_get_visibility (polyline));
         }
         if (fp->acad_version_number >= AutoCAD_13)
         {
-                fprintf (fp->fp, "100\nAcDb3dPolyline\n");
+                dxf_write_string (fp, 100, "AcDb3dPolyline");
         }
         if (fp->acad_version_number < AutoCAD_2002)
         {
-                fprintf (fp->fp, " 66\n%d\n", dxf_polyline_get_vertices_follow (polyline));
+                dxf_write_int (fp, 66, dxf_polyline_get_vertices_follow (polyline));
         }
-        fprintf (fp->fp, " 10\n%f\n", dxf_polyline_get_x0 (polyline));
-        fprintf (fp->fp, " 20\n%f\n", dxf_polyline_get_y0 (polyline));
-        fprintf (fp->fp, " 30\n%f\n", dxf_polyline_get_z0 (polyline));
+        dxf_write_double (fp, 10, dxf_polyline_get_x0 (polyline));
+        dxf_write_double (fp, 20, dxf_polyline_get_y0 (polyline));
+        dxf_write_double (fp, 30, dxf_polyline_get_z0 (polyline));
         if (dxf_polyline_get_thickness (polyline) != 0.0)
         {
-                fprintf (fp->fp, " 39\n%f\n", dxf_polyline_get_thickness (polyline));
+                dxf_write_double (fp, 39, dxf_polyline_get_thickness (polyline));
         }
-        fprintf (fp->fp, " 70\n%d\n", dxf_polyline_get_flag (polyline));
+        dxf_write_int (fp, 70, dxf_polyline_get_flag (polyline));
         if (dxf_polyline_get_start_width (polyline) != 0.0)
         {
-                fprintf (fp->fp, " 40\n%f\n", dxf_polyline_get_start_width (polyline));
+                dxf_write_double (fp, 40, dxf_polyline_get_start_width (polyline));
         }
         if (dxf_polyline_get_end_width (polyline) != 0.0)
         {
-                fprintf (fp->fp, " 41\n%f\n", dxf_polyline_get_end_width (polyline));
+                dxf_write_double (fp, 41, dxf_polyline_get_end_width (polyline));
         }
-        fprintf (fp->fp, " 71\n%d\n", dxf_polyline_get_polygon_mesh_M_vertex_count (polyline));
-        fprintf (fp->fp, " 72\n%d\n", dxf_polyline_get_polygon_mesh_N_vertex_count (polyline));
-        fprintf (fp->fp, " 73\n%d\n", dxf_polyline_get_smooth_M_surface_density (polyline));
-        fprintf (fp->fp, " 74\n%d\n", dxf_polyline_get_smooth_N_surface_density (polyline));
-        fprintf (fp->fp, " 75\n%d\n", dxf_polyline_get_surface_type (polyline));
+        dxf_write_int (fp, 71, dxf_polyline_get_polygon_mesh_M_vertex_count (polyline));
+        dxf_write_int (fp, 72, dxf_polyline_get_polygon_mesh_N_vertex_count (polyline));
+        dxf_write_int (fp, 73, dxf_polyline_get_smooth_M_surface_density (polyline));
+        dxf_write_int (fp, 74, dxf_polyline_get_smooth_N_surface_density (polyline));
+        dxf_write_int (fp, 75, dxf_polyline_get_surface_type (polyline));
         if ((fp->acad_version_number >= AutoCAD_12)
                 && (dxf_polyline_get_extr_x0 (polyline) != 0.0)
                 && (dxf_polyline_get_extr_y0 (polyline) != 0.0)
                 && (dxf_polyline_get_extr_z0 (polyline) != 1.0))
         {
-                fprintf (fp->fp, "210\n%f\n", dxf_polyline_get_extr_x0 (polyline));
-                fprintf (fp->fp, "220\n%f\n", dxf_polyline_get_extr_y0 (polyline));
-                fprintf (fp->fp, "230\n%f\n", dxf_polyline_get_extr_z0 (polyline));
+                dxf_write_double (fp, 210, dxf_polyline_get_extr_x0 (polyline));
+                dxf_write_double (fp, 220, dxf_polyline_get_extr_y0 (polyline));
+                dxf_write_double (fp, 230, dxf_polyline_get_extr_z0 (polyline));
         }
         /* Start of writing (multiple) vertices. */
         iter = (DxfVertex *) dxf_polyline_get_vertices (polyline);
@@ -633,7 +576,7 @@ dxf_polyline_write
         }
         dxf_vertex_free (iter);
         /* Clean up. */
-        free (dxf_entity_name);
+        dxf_free (dxf_entity_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -674,17 +617,13 @@ dxf_polyline_free
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        free (dxf_polyline_get_linetype (polyline));
-        free (dxf_polyline_get_layer (polyline));
+        dxf_free (dxf_polyline_get_linetype (polyline));
+        dxf_free (dxf_polyline_get_layer (polyline));
         dxf_binary_graphics_data_free_list (dxf_polyline_get_binary_graphics_data (polyline));
-        free (dxf_polyline_get_dictionary_owner_soft (polyline));
-        free (dxf_polyline_get_material (polyline));
-        free (dxf_polyline_get_dictionary_owner_hard (polyline));
-        free (dxf_polyline_get_plot_style_name (polyline));
-        free (dxf_polyline_get_color_name (polyline));
+        dxf_free (dxf_polyline_get_color_name (polyline));
         dxf_point_free (dxf_polyline_get_p0 (polyline));
         dxf_vertex_free_list (dxf_polyline_get_vertices (polyline));
-        free (polyline);
+        dxf_free (polyline);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -730,7 +669,7 @@ dxf_polyline_free_list
  *
  * \return \c id_code.
  */
-int
+uint64_t
 dxf_polyline_get_id_code
 (
         DxfPolyline *polyline
@@ -748,12 +687,6 @@ dxf_polyline_get_id_code
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (polyline->id_code < 0)
-        {
-                fprintf (stderr,
-                  (_("Warning in %s () a negative value was found in the id-code member.\n")),
-                  __FUNCTION__);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -772,7 +705,7 @@ dxf_polyline_set_id_code
 (
         DxfPolyline *polyline,
                 /*!< a pointer to a DXF \c POLYLINE entity. */
-        int id_code
+        uint64_t id_code
                 /*!< Identification number for the entity.\n
                  * This is to be an unique (sequential) number in the DXF
                  * file. */
@@ -789,12 +722,6 @@ dxf_polyline_set_id_code
                   __FUNCTION__);
                 return (NULL);
         }
-        if (id_code < 0)
-        {
-                fprintf (stderr,
-                  (_("Warning in %s () a negative id-code value was passed.\n")),
-                  __FUNCTION__);
-        }
         polyline->id_code = id_code;
 #if DEBUG
         DXF_DEBUG_END
@@ -837,7 +764,7 @@ dxf_polyline_get_linetype
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (polyline->linetype));
+        return (dxf_strdup (polyline->linetype));
 }
 
 
@@ -877,7 +804,7 @@ dxf_polyline_set_linetype
                   __FUNCTION__);
                 return (NULL);
         }
-        polyline->linetype = strdup (linetype);
+        polyline->linetype = dxf_strdup (linetype);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -919,7 +846,7 @@ dxf_polyline_get_layer
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (polyline->layer));
+        return (dxf_strdup (polyline->layer));
 }
 
 
@@ -958,7 +885,7 @@ dxf_polyline_set_layer
                   __FUNCTION__);
                 return (NULL);
         }
-        polyline->layer = strdup (layer);
+        polyline->layer = dxf_strdup (layer);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1713,11 +1640,9 @@ dxf_polyline_set_binary_graphics_data
  * \brief Get the soft pointer to the \c dictionary_owner_soft from a
  * DXF \c POLYLINE entity.
  *
- * \return a pointer to the \c dictionary_owner_soft.
- *
- * \warning No checks are performed on the returned pointer.
+ * \return the handle of the \c dictionary_owner_soft.
  */
-char *
+uint64_t
 dxf_polyline_get_dictionary_owner_soft
 (
         DxfPolyline *polyline
@@ -1733,19 +1658,12 @@ dxf_polyline_get_dictionary_owner_soft
                 fprintf (stderr,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
-                return (NULL);
-        }
-        if (polyline->dictionary_owner_soft ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found in the dictionary_owner_soft member.\n")),
-                  __FUNCTION__);
-                return (NULL);
+                return (0);
         }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (polyline->dictionary_owner_soft));
+        return (polyline->dictionary_owner_soft);
 }
 
 
@@ -1758,8 +1676,8 @@ dxf_polyline_set_dictionary_owner_soft
 (
         DxfPolyline *polyline,
                 /*!< a pointer to a DXF \c POLYLINE entity. */
-        char *dictionary_owner_soft
-                /*!< a string containing the pointer to the
+        uint64_t dictionary_owner_soft
+                /*!< the handle of the
                  * \c dictionary_owner_soft for the entity. */
 )
 {
@@ -1774,14 +1692,7 @@ dxf_polyline_set_dictionary_owner_soft
                   __FUNCTION__);
                 return (NULL);
         }
-        if (dictionary_owner_soft == NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was passed.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
-        polyline->dictionary_owner_soft = strdup (dictionary_owner_soft);
+        polyline->dictionary_owner_soft = dictionary_owner_soft;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1793,12 +1704,10 @@ dxf_polyline_set_dictionary_owner_soft
  * \brief Get the pointer to the \c material from a DXF \c POLYLINE
  * entity.
  *
- * \return a pointer to \c material when successful, or \c NULL when an
+ * \return the handle \c material when successful, or 0 when an
  * error occurred.
- *
- * \warning No checks are performed on the returned pointer.
  */
-char *
+uint64_t
 dxf_polyline_get_material
 (
         DxfPolyline *polyline
@@ -1814,19 +1723,12 @@ dxf_polyline_get_material
                 fprintf (stderr,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
-                return (NULL);
-        }
-        if (polyline->material ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found in the material member.\n")),
-                  __FUNCTION__);
-                return (NULL);
+                return (0);
         }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (polyline->material));
+        return (polyline->material);
 }
 
 
@@ -1842,8 +1744,8 @@ dxf_polyline_set_material
 (
         DxfPolyline *polyline,
                 /*!< a pointer to a DXF \c POLYLINE entity. */
-        char *material
-                /*!< a string containing the pointer to the \c
+        uint64_t material
+                /*!< the handle of the \c
                  * material for the entity. */
 )
 {
@@ -1858,14 +1760,7 @@ dxf_polyline_set_material
                   __FUNCTION__);
                 return (NULL);
         }
-        if (material == NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was passed.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
-        polyline->material = strdup (material);
+        polyline->material = material;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1877,11 +1772,9 @@ dxf_polyline_set_material
  * \brief Get the pointer to the \c dictionary_owner_hard from a DXF 
  * \c POLYLINE entity.
  *
- * \return a pointer to the \c dictionary_owner_hard.
- *
- * \warning No checks are performed on the returned pointer.
+ * \return the handle of the \c dictionary_owner_hard.
  */
-char *
+uint64_t
 dxf_polyline_get_dictionary_owner_hard
 (
         DxfPolyline *polyline
@@ -1897,19 +1790,12 @@ dxf_polyline_get_dictionary_owner_hard
                 fprintf (stderr,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
-                return (NULL);
-        }
-        if (polyline->dictionary_owner_hard ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found in the dictionary_owner_hard member.\n")),
-                  __FUNCTION__);
-                return (NULL);
+                return (0);
         }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (polyline->dictionary_owner_hard));
+        return (polyline->dictionary_owner_hard);
 }
 
 
@@ -1925,8 +1811,8 @@ dxf_polyline_set_dictionary_owner_hard
 (
         DxfPolyline *polyline,
                 /*!< a pointer to a DXF \c POLYLINE entity. */
-        char *dictionary_owner_hard
-                /*!< a string containing the pointer to the \c
+        uint64_t dictionary_owner_hard
+                /*!< the handle of the \c
                  * dictionary_owner_hard for the entity. */
 )
 {
@@ -1941,14 +1827,7 @@ dxf_polyline_set_dictionary_owner_hard
                   __FUNCTION__);
                 return (NULL);
         }
-        if (dictionary_owner_hard == NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was passed.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
-        polyline->dictionary_owner_hard = strdup (dictionary_owner_hard);
+        polyline->dictionary_owner_hard = dictionary_owner_hard;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2024,10 +1903,10 @@ dxf_polyline_set_lineweight
 /*!
  * \brief Get the \c plot_style_name from a DXF \c POLYLINE entity.
  *
- * \return a pointer to \c plot_style_name when sucessful, or \c NULL
+ * \return the handle \c plot_style_name when sucessful, or 0
  * when an error occurred.
  */
-char *
+uint64_t
 dxf_polyline_get_plot_style_name
 (
         DxfPolyline *polyline
@@ -2043,19 +1922,12 @@ dxf_polyline_get_plot_style_name
                 fprintf (stderr,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
-                return (NULL);
-        }
-        if (polyline->plot_style_name ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found in the plot_style_name member.\n")),
-                  __FUNCTION__);
-                return (NULL);
+                return (0);
         }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (polyline->plot_style_name));
+        return (polyline->plot_style_name);
 }
 
 
@@ -2070,7 +1942,7 @@ dxf_polyline_set_plot_style_name
 (
         DxfPolyline *polyline,
                 /*!< a pointer to a DXF \c POLYLINE entity. */
-        char *plot_style_name
+        uint64_t plot_style_name
                 /*!< a string containing the \c plot_style_name for the
                  * entity. */
 )
@@ -2086,14 +1958,7 @@ dxf_polyline_set_plot_style_name
                   __FUNCTION__);
                 return (NULL);
         }
-        if (plot_style_name == NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was passed.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
-        polyline->plot_style_name = strdup (plot_style_name);
+        polyline->plot_style_name = plot_style_name;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2200,7 +2065,7 @@ dxf_polyline_get_color_name
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (polyline->color_name));
+        return (dxf_strdup (polyline->color_name));
 }
 
 
@@ -2238,7 +2103,7 @@ dxf_polyline_set_color_name
                   __FUNCTION__);
                 return (NULL);
         }
-        polyline->color_name = strdup (color_name);
+        polyline->color_name = dxf_strdup (color_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -3746,4 +3611,212 @@ dxf_polyline_get_last
 }
 
 
+/*!
+ * \brief Get the bounding box of a DXF \c POLYLINE.
+ *
+ * The box of the segments of \c polyline, the arc segments of a 2D
+ * polyline included (see dxf_bbox_add_bulge ()), the face records of a
+ * polyface mesh left out.\n
+ * The vertices of a 2D polyline lie at the elevation of \c polyline,
+ * in it's Object Coordinate System (OCS), the box is mapped to world
+ * coordinates (see dxf_bbox_ocs_to_wcs ()).  The vertices of 3D
+ * polylines and (polyface) meshes are in world coordinates.\n
+ * \todo Take the widths into account.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_polyline_get_bbox
+(
+        DxfPolyline *polyline,
+                /*!< a pointer to a DXF \c POLYLINE entity. */
+        DxfBbox *bbox
+                /*!< a pointer to the libDXF bounding box to fill. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfVertex *vertex;
+        DxfVertex *target;
+        DxfVec3 extrusion;
+        double z;
+        int bulges;
+
+        /* Do some basic checks. */
+        if ((polyline == NULL) || (bbox == NULL))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        /* 3D polylines and (polyface) meshes have no arc segments. */
+        bulges = ((polyline->flag & (8 | 16 | 64)) == 0);
+        z = (polyline->p0 != NULL) ? polyline->p0->z0 : polyline->elevation;
+        dxf_bbox_init (bbox);
+        for (vertex = (DxfVertex *) polyline->vertices;
+          vertex != NULL;
+          vertex = (DxfVertex *) vertex->next)
+        {
+                if (((vertex->flag & 128) != 0) && ((vertex->flag & 64) == 0))
+                {
+                        /* A face record, without coordinates. */
+                        continue;
+                }
+                if (!bulges)
+                {
+                        dxf_bbox_add_point (bbox, vertex->p0.x, vertex->p0.y, vertex->p0.z);
+                        continue;
+                }
+                target = (DxfVertex *) vertex->next;
+                if ((target == NULL) && ((polyline->flag & 1) != 0))
+                {
+                        target = (DxfVertex *) polyline->vertices;
+                }
+                if (target == NULL)
+                {
+                        dxf_bbox_add_point (bbox, vertex->p0.x, vertex->p0.y, z);
+                        continue;
+                }
+                dxf_bbox_add_bulge (bbox, vertex->p0.x, vertex->p0.y,
+                  target->p0.x, target->p0.y, z, vertex->bulge);
+        }
+        if (bulges)
+        {
+                extrusion.x = polyline->extr_x0;
+                extrusion.y = polyline->extr_y0;
+                extrusion.z = polyline->extr_z0;
+                dxf_bbox_ocs_to_wcs (bbox, &extrusion);
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Transform a DXF \c POLYLINE entity and it's \c VERTEX
+ * entities in place.
+ *
+ * The vertices of 3D polylines and (polyface) meshes are in world
+ * coordinates and are mapped with \c transform, any affine
+ * transformation is supported for them.\n
+ * The vertices of a 2D polyline lie at the elevation of \c polyline
+ * in it's Object Coordinate System (OCS), \c transform has to map the
+ * plane of the OCS with a uniform scale, see
+ * dxf_transform_get_ocs_transform ().  Widths are scaled and curve fit
+ * tangent directions are turned with the plane.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred, or when \c transform does not map the entity without
+ * distortion.
+ */
+int
+dxf_polyline_transform
+(
+        DxfPolyline *polyline,
+                /*!< a pointer to a DXF \c POLYLINE entity. */
+        DxfTransform *transform
+                /*!< a pointer to a libDXF affine transformation. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfTransform ocs;
+        DxfVertex *vertex;
+        DxfVec3 extrusion;
+        DxfVec3 point;
+        double scale;
+        double rotation;
+        double z;
+        int i;
+
+        /* Do some basic checks. */
+        if ((polyline == NULL) || (transform == NULL))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        if ((polyline->flag & (8 | 16 | 64)) != 0)
+        {
+                /* A 3D polyline or a (polyface) mesh. */
+                for (vertex = (DxfVertex *) polyline->vertices;
+                  vertex != NULL;
+                  vertex = (DxfVertex *) vertex->next)
+                {
+                        if (((vertex->flag & 128) != 0) && ((vertex->flag & 64) == 0))
+                        {
+                                /* A face record, without coordinates. */
+                                continue;
+                        }
+                        dxf_transform_apply_point (transform, &vertex->p0, &vertex->p0);
+                }
+#if DEBUG
+                DXF_DEBUG_END
+#endif
+                return (EXIT_SUCCESS);
+        }
+        extrusion.x = polyline->extr_x0;
+        extrusion.y = polyline->extr_y0;
+        extrusion.z = polyline->extr_z0;
+        if (dxf_transform_get_ocs_transform (transform, &extrusion, &ocs, &scale) == EXIT_FAILURE)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () the transformation distorts the POLYLINE entity with id-code: %" PRIx64 "\n")),
+                  __FUNCTION__, polyline->id_code);
+                return (EXIT_FAILURE);
+        }
+        /* Move the elevation into the translation, the vertices
+         * are in the plane Z = 0 then. */
+        z = (polyline->p0 != NULL) ? polyline->p0->z0 : polyline->elevation;
+        for (i = 0; i < 3; i++)
+        {
+                ocs.m[i][3] += ocs.m[i][2] * z;
+        }
+        rotation = atan2 (ocs.m[1][0], ocs.m[0][0]) * 180.0 / M_PI;
+        for (vertex = (DxfVertex *) polyline->vertices;
+          vertex != NULL;
+          vertex = (DxfVertex *) vertex->next)
+        {
+                point.x = vertex->p0.x;
+                point.y = vertex->p0.y;
+                point.z = 0.0;
+                dxf_transform_apply_point (&ocs, &point, &point);
+                vertex->p0.x = point.x;
+                vertex->p0.y = point.y;
+                vertex->start_width *= scale;
+                vertex->end_width *= scale;
+                if ((vertex->flag & 2) != 0)
+                {
+                        vertex->curve_fit_tangent_direction = fmod
+                          (vertex->curve_fit_tangent_direction + rotation, 360.0);
+                }
+        }
+        if (polyline->p0 != NULL)
+        {
+                polyline->p0->z0 = ocs.m[2][3];
+        }
+        else
+        {
+                polyline->elevation = ocs.m[2][3];
+        }
+        polyline->start_width *= scale;
+        polyline->end_width *= scale;
+        polyline->extr_x0 = extrusion.x;
+        polyline->extr_y0 = extrusion.y;
+        polyline->extr_z0 = extrusion.z;
+        polyline->thickness *= ocs.m[2][2];
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (EXIT_SUCCESS);
+}
+
+
 /* EOF */
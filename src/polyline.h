@@ -47,6 +47,7 @@
 #include "binary_graphics_data.h"
 #include "vertex.h"
 #include "point.h"
+#include "transform.h"
 
 
 #ifdef __cplusplus
@@ -104,7 +105,7 @@ typedef struct
 dxf_polyline_struct
 {
         /* Members common for all DXF drawable entities. */
-        int id_code;
+        uint64_t id_code;
                 /*!< Identification number for the entity.\n
                  * This is to be an unique (sequential) number in the DXF
                  * file.\n
@@ -177,16 +178,16 @@ dxf_polyline_struct
                  * (optional).\n
                  * Group code = 310.\n
                  * \since Introduced in version R2000. */
-        char *dictionary_owner_soft;
+        uint64_t dictionary_owner_soft;
                 /*!< Soft-pointer ID/handle to owner dictionary (optional).\n
                  * Group code = 330.\n
                  * \since Introduced in version R14. */
-        char *material;
+        uint64_t material;
                 /*!< Hard-pointer ID/handle to material object (present if
                  * not BYLAYER).\n
                  * Group code = 347.\n
                  * \since Introduced in version R2008. */
-        char *dictionary_owner_hard;
+        uint64_t dictionary_owner_hard;
                 /*!< Hard owner ID/handle to owner dictionary (optional).\n
                  * Group code = 360.\n
                  * \since Introduced in version R14. */
@@ -195,7 +196,7 @@ dxf_polyline_struct
                  * Stored and moved around as a 16-bit integer.\n
                  * Group code = 370.\n
                  * \since Introduced in version R2002. */
-        char *plot_style_name;
+        uint64_t plot_style_name;
                 /*!< Hard pointer ID / handle of PlotStyleName object.\n
                  * Group code = 390.\n
                  * \since Introduced in version R2009. */
@@ -313,8 +314,8 @@ DxfPolyline *dxf_polyline_read (DxfFile *fp, DxfPolyline *polyline);
 int dxf_polyline_write (DxfFile *fp, DxfPolyline *polyline);
 int dxf_polyline_free (DxfPolyline *polyline);
 void dxf_polyline_free_list (DxfPolyline *polylines);
-int dxf_polyline_get_id_code (DxfPolyline *polyline);
-DxfPolyline *dxf_polyline_set_id_code (DxfPolyline *polyline, int id_code);
+uint64_t dxf_polyline_get_id_code (DxfPolyline *polyline);
+DxfPolyline *dxf_polyline_set_id_code (DxfPolyline *polyline, uint64_t id_code);
 char *dxf_polyline_get_linetype (DxfPolyline *polyline);
 DxfPolyline *dxf_polyline_set_linetype (DxfPolyline *polyline, char *linetype);
 char *dxf_polyline_get_layer (DxfPolyline *polyline);
@@ -337,16 +338,16 @@ int16_t dxf_polyline_get_shadow_mode (DxfPolyline *polyline);
 DxfPolyline *dxf_polyline_set_shadow_mode (DxfPolyline *polyline, int16_t shadow_mode);
 DxfBinaryGraphicsData *dxf_polyline_get_binary_graphics_data (DxfPolyline *polyline);
 DxfPolyline *dxf_polyline_set_binary_graphics_data (DxfPolyline *polyline, DxfBinaryGraphicsData *data);
-char *dxf_polyline_get_dictionary_owner_soft (DxfPolyline *polyline);
-DxfPolyline *dxf_polyline_set_dictionary_owner_soft (DxfPolyline *polyline, char *dictionary_owner_soft);
-char *dxf_polyline_get_material (DxfPolyline *polyline);
-DxfPolyline *dxf_polyline_set_material (DxfPolyline *polyline, char *material);
-char *dxf_polyline_get_dictionary_owner_hard (DxfPolyline *polyline);
-DxfPolyline *dxf_polyline_set_dictionary_owner_hard (DxfPolyline *polyline, char *dictionary_owner_hard);
+uint64_t dxf_polyline_get_dictionary_owner_soft (DxfPolyline *polyline);
+DxfPolyline *dxf_polyline_set_dictionary_owner_soft (DxfPolyline *polyline, uint64_t dictionary_owner_soft);
+uint64_t dxf_polyline_get_material (DxfPolyline *polyline);
+DxfPolyline *dxf_polyline_set_material (DxfPolyline *polyline, uint64_t material);
+uint64_t dxf_polyline_get_dictionary_owner_hard (DxfPolyline *polyline);
+DxfPolyline *dxf_polyline_set_dictionary_owner_hard (DxfPolyline *polyline, uint64_t dictionary_owner_hard);
 int16_t dxf_polyline_get_lineweight (DxfPolyline *polyline);
 DxfPolyline *dxf_polyline_set_lineweight (DxfPolyline *polyline, int16_t lineweight);
-char *dxf_polyline_get_plot_style_name (DxfPolyline *polyline);
-DxfPolyline *dxf_polyline_set_plot_style_name (DxfPolyline *polyline, char *plot_style_name);
+uint64_t dxf_polyline_get_plot_style_name (DxfPolyline *polyline);
+DxfPolyline *dxf_polyline_set_plot_style_name (DxfPolyline *polyline, uint64_t plot_style_name);
 long dxf_polyline_get_color_value (DxfPolyline *polyline);
 DxfPolyline *dxf_polyline_set_color_value (DxfPolyline *polyline, long color_value);
 char *dxf_polyline_get_color_name (DxfPolyline *polyline);
@@ -390,6 +391,8 @@ DxfPolyline *dxf_polyline_set_vertices (DxfPolyline *polyline, DxfVertex *vertic
 DxfPolyline *dxf_polyline_get_next (DxfPolyline *polyline);
 DxfPolyline *dxf_polyline_set_next (DxfPolyline *polyline, DxfPolyline *next);
 DxfPolyline *dxf_polyline_get_last (DxfPolyline *polyline);
+int dxf_polyline_get_bbox (DxfPolyline *polyline, DxfBbox *bbox);
+int dxf_polyline_transform (DxfPolyline *polyline, DxfTransform *transform);
 
 
 #ifdef __cplusplus
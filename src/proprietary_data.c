@@ -53,7 +53,7 @@ dxf_proprietary_data_new ()
         size = sizeof (DxfProprietaryData);
         /* avoid malloc of 0 bytes */
         if (size == 0) size = 1;
-        if ((data = malloc (size)) == NULL)
+        if ((data = dxf_malloc (size)) == NULL)
         {
                 fprintf (stderr,
                   (_("Error in %s () could not allocate memory for a DxfProprietaryData struct.\n")),
@@ -103,7 +103,7 @@ dxf_proprietary_data_init
                 __FUNCTION__);
               return (NULL);
         }
-        data->line = strdup ("");
+        data->line = dxf_strdup ("");
         data->next = NULL;
 #if DEBUG
         DXF_DEBUG_END
@@ -145,8 +145,8 @@ dxf_proprietary_data_free
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        free (data->line);
-        free (data);
+        dxf_free (data->line);
+        dxf_free (data);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -297,7 +297,7 @@ dxf_proprietary_data_get_line
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (data->line));
+        return (dxf_strdup (data->line));
 }
 
 
@@ -334,7 +334,7 @@ dxf_proprietary_data_set_line
                   __FUNCTION__);
                 return (NULL);
         }
-        data->line = strdup (line);
+        data->line = dxf_strdup (line);
 #if DEBUG
         DXF_DEBUG_END
 #endif
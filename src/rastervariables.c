@@ -42,6 +42,7 @@
 
 
 #include "rastervariables.h"
+#include "util.h"
 
 
 /*!
@@ -61,7 +62,7 @@ dxf_rastervariables_new ()
         size = sizeof (DxfRasterVariables);
         /* avoid malloc of 0 bytes */
         if (size == 0) size = 1;
-        if ((rastervariables = malloc (size)) == NULL)
+        if ((rastervariables = dxf_malloc (size)) == NULL)
         {
                 fprintf (stderr,
                   (_("Error in %s () could not allocate memory for a DxfRasterVariables struct.\n")),
@@ -111,9 +112,9 @@ dxf_rastervariables_init
                   __FUNCTION__);
                 return (NULL);
         }
-        rastervariables->id_code = 0;
-        rastervariables->dictionary_owner_soft = strdup ("");
-        rastervariables->dictionary_owner_hard = strdup ("");
+        rastervariables->id_code = DXF_HANDLE_NONE;
+        rastervariables->dictionary_owner_soft = 0;
+        rastervariables->dictionary_owner_hard = 0;
         rastervariables->display_image_frame = 0;
         rastervariables->display_quality = 0;
         rastervariables->units = 0;
@@ -149,7 +150,8 @@ dxf_rastervariables_read
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        char *temp_string = NULL;
+        char temp_string[DXF_MAX_STRING_LENGTH];
+        int group_code;
         int i;
 
         /* Do some basic checks. */
@@ -158,8 +160,6 @@ dxf_rastervariables_read
                 fprintf (stderr,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
-                /* Clean up. */
-                free (temp_string);
                 return (NULL);
         }
         if (fp->acad_version_number < AutoCAD_14)
@@ -176,100 +176,91 @@ dxf_rastervariables_read
                 rastervariables = dxf_rastervariables_init (rastervariables);
         }
         i = 0;
-        (fp->line_number)++;
-        fscanf (fp->fp, "%[^\n]", temp_string);
-        while (strcmp (temp_string, "0") != 0)
+        while ((dxf_read_group_code (fp, &group_code) == EXIT_SUCCESS)
+          && (group_code != 0))
         {
-                if (ferror (fp->fp))
+                if (dxf_read_error (fp))
                 {
                         fprintf (stderr,
                           (_("Error in %s () while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
                         /* Clean up. */
-                        free (temp_string);
-                        fclose (fp->fp);
                         return (NULL);
                 }
-                if (strcmp (temp_string, "5") == 0)
-                {
-                        /* Now follows a string containing a sequential
-                         * id number. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%x\n", (uint *) &rastervariables->id_code);
-                }
-                if (strcmp (temp_string, "70") == 0)
-                {
-                        /* Now follows a string containing a display
-                         * image frame flag value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%d\n", &rastervariables->display_image_frame);
-                }
-                if (strcmp (temp_string, "71") == 0)
-                {
-                        /* Now follows a string containing a display
-                         * quality flag value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%d\n", &rastervariables->display_quality);
-                }
-                if (strcmp (temp_string, "72") == 0)
-                {
-                        /* Now follows a string containing a units
-                         * value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%d\n", &rastervariables->units);
-                }
-                else if (strcmp (temp_string, "90") == 0)
-                {
-                        /* Now follows a string containing the
-                         * value of class version. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%d\n", &rastervariables->class_version);
-                }
-                else if ((fp->acad_version_number >= AutoCAD_13)
-                        && (strcmp (temp_string, "100") == 0))
+                switch (group_code)
                 {
-                        /* Now follows a string containing the
-                         * subclass marker value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
-                        if (strcmp (temp_string, "AcDbIdBuffer") != 0)
-                        {
+                        case 5:
+                                /* Now follows a string containing a sequential
+                                 * id number. */
+                                dxf_read_handle (fp, &rastervariables->id_code);
+                                break;
+                        case 70:
+                                /* Now follows a string containing a display
+                                 * image frame flag value. */
+                                dxf_read_int (fp, &rastervariables->display_image_frame);
+                                break;
+                        case 71:
+                                /* Now follows a string containing a display
+                                 * quality flag value. */
+                                dxf_read_int (fp, &rastervariables->display_quality);
+                                break;
+                        case 72:
+                                /* Now follows a string containing a units
+                                 * value. */
+                                dxf_read_int (fp, &rastervariables->units);
+                                break;
+                        case 90:
+                                /* Now follows a string containing the
+                                 * value of class version. */
+                                dxf_read_int (fp, &rastervariables->class_version);
+                                break;
+                        case 100:
+                                if (fp->acad_version_number >= AutoCAD_13)
+                                {
+                                        /* Now follows a string containing the
+                                         * subclass marker value. */
+                                        dxf_read_line (temp_string, fp);
+                                        if (strcmp (temp_string, "AcDbIdBuffer") != 0)
+                                        {
+                                                fprintf (stderr,
+                                                  (_("Warning in %s () found a bad subclass marker in: %s in line: %d.\n")),
+                                                  __FUNCTION__, fp->filename, fp->line_number);
+                                        }
+                                }
+                                else
+                                {
+                                        fprintf (stderr,
+                                          (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
+                                          __FUNCTION__, fp->filename, fp->line_number);
+                                        /* Skip the value of the unknown group code. */
+                                        dxf_read_line (temp_string, fp);
+                                }
+                                break;
+                        case 330:
+                                /* Now follows a string containing Soft-pointer
+                                 * ID/handle to owner dictionary. */
+                                dxf_read_handle (fp, &rastervariables->dictionary_owner_soft);
+                                i++;
+                                break;
+                        case 360:
+                                /* Now follows a string containing Hard owner
+                                 * ID/handle to owner dictionary. */
+                                dxf_read_handle (fp, &rastervariables->dictionary_owner_hard);
+                                break;
+                        case 999:
+                                /* Now follows a string containing a comment. */
+                                dxf_read_line (temp_string, fp);
+                                fprintf (stdout, (_("DXF comment: %s\n")), temp_string);
+                                break;
+                        default:
                                 fprintf (stderr,
-                                  (_("Warning in %s () found a bad subclass marker in: %s in line: %d.\n")),
+                                  (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
                                   __FUNCTION__, fp->filename, fp->line_number);
-                        }
-                }
-                else if (strcmp (temp_string, "330") == 0)
-                {
-                        /* Now follows a string containing Soft-pointer
-                         * ID/handle to owner dictionary. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, rastervariables->dictionary_owner_soft);
-                        i++;
-                }
-                else if (strcmp (temp_string, "360") == 0)
-                {
-                        /* Now follows a string containing Hard owner
-                         * ID/handle to owner dictionary. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, rastervariables->dictionary_owner_hard);
-                }
-                else if (strcmp (temp_string, "999") == 0)
-                {
-                        /* Now follows a string containing a comment. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
-                        fprintf (stdout, (_("DXF comment: %s\n")), temp_string);
-                }
-                else
-                {
-                        fprintf (stderr,
-                          (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
-                          __FUNCTION__, fp->filename, fp->line_number);
+                                /* Skip the value of the unknown group code. */
+                                dxf_read_line (temp_string, fp);
+                                break;
                 }
         }
-        /* Clean up. */
-        free (temp_string);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -295,7 +286,7 @@ dxf_rastervariables_write
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        char *dxf_entity_name = strdup ("RASTERVARIABLES");
+        char *dxf_entity_name = dxf_strdup ("RASTERVARIABLES");
 
         /* Do some basic checks. */
         if (fp == NULL)
@@ -304,7 +295,7 @@ dxf_rastervariables_write
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (rastervariables == NULL)
@@ -313,20 +304,20 @@ dxf_rastervariables_write
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (fp->acad_version_number < AutoCAD_14)
         {
                 fprintf (stderr,
-                  (_("Warning in %s () illegal DXF version for this %s entity with id-code: %x.\n")),
+                  (_("Warning in %s () illegal DXF version for this %s entity with id-code: %" PRIx64 ".\n")),
                   __FUNCTION__, dxf_entity_name, rastervariables->id_code);
         }
         /* Start writing output. */
-        fprintf (fp->fp, "  0\n%s\n", dxf_entity_name);
-        if (rastervariables->id_code != -1)
+        dxf_write_string (fp, 0, dxf_entity_name);
+        if (rastervariables->id_code != DXF_HANDLE_NONE)
         {
-                fprintf (fp->fp, "  5\n%x\n", rastervariables->id_code);
+                dxf_write_hex (fp, 5, rastervariables->id_code);
         }
         /*!
          * \todo for version R14.\n
@@ -338,30 +329,30 @@ dxf_rastervariables_write
          * 102 groups are application defined (optional).\n\n
          * End of group, "}" (optional), with Group code 102.
          */
-        if ((strcmp (rastervariables->dictionary_owner_soft, "") != 0)
+        if ((rastervariables->dictionary_owner_soft != 0)
           && (fp->acad_version_number >= AutoCAD_14))
         {
-                fprintf (fp->fp, "102\n{ACAD_REACTORS\n");
-                fprintf (fp->fp, "330\n%s\n", rastervariables->dictionary_owner_soft);
-                fprintf (fp->fp, "102\n}\n");
+                dxf_write_string (fp, 102, "{ACAD_REACTORS");
+                dxf_write_hex (fp, 330, rastervariables->dictionary_owner_soft);
+                dxf_write_string (fp, 102, "}");
         }
-        if ((strcmp (rastervariables->dictionary_owner_hard, "") != 0)
+        if ((rastervariables->dictionary_owner_hard != 0)
           && (fp->acad_version_number >= AutoCAD_14))
         {
-                fprintf (fp->fp, "102\n{ACAD_XDICTIONARY\n");
-                fprintf (fp->fp, "360\n%s\n", rastervariables->dictionary_owner_hard);
-                fprintf (fp->fp, "102\n}\n");
+                dxf_write_string (fp, 102, "{ACAD_XDICTIONARY");
+                dxf_write_hex (fp, 360, rastervariables->dictionary_owner_hard);
+                dxf_write_string (fp, 102, "}");
         }
         if (fp->acad_version_number >= AutoCAD_13)
         {
-                fprintf (fp->fp, "100\nAcDbRasterVariables\n");
+                dxf_write_string (fp, 100, "AcDbRasterVariables");
         }
-        fprintf (fp->fp, " 90\n%d\n", rastervariables->class_version);
-        fprintf (fp->fp, " 70\n%d\n", rastervariables->display_image_frame);
-        fprintf (fp->fp, " 71\n%d\n", rastervariables->display_quality);
-        fprintf (fp->fp, " 72\n%d\n", rastervariables->units);
+        dxf_write_int (fp, 90, rastervariables->class_version);
+        dxf_write_int (fp, 70, rastervariables->display_image_frame);
+        dxf_write_int (fp, 71, rastervariables->display_quality);
+        dxf_write_int (fp, 72, rastervariables->units);
         /* Clean up. */
-        free (dxf_entity_name);
+        dxf_free (dxf_entity_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -402,9 +393,7 @@ dxf_rastervariables_free
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        free (rastervariables->dictionary_owner_soft);
-        free (rastervariables->dictionary_owner_hard);
-        free (rastervariables);
+        dxf_free (rastervariables);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -450,7 +439,7 @@ dxf_rastervariables_free_list
  *
  * \return \c id_code.
  */
-int
+uint64_t
 dxf_rastervariables_get_id_code
 (
         DxfRasterVariables *rastervariables
@@ -468,12 +457,6 @@ dxf_rastervariables_get_id_code
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (rastervariables->id_code < 0)
-        {
-                fprintf (stderr,
-                  (_("Warning in %s () a negative value was found.\n")),
-                  __FUNCTION__);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -489,7 +472,7 @@ dxf_rastervariables_set_id_code
 (
         DxfRasterVariables *rastervariables,
                 /*!< a pointer to a DXF \c RASTERVARIABLES object. */
-        int id_code
+        uint64_t id_code
                 /*!< the \c id_code to be set for the entity.\n
                  * This is to be an unique (sequential) number in the
                  * DXF file. */
@@ -506,12 +489,6 @@ dxf_rastervariables_set_id_code
                   __FUNCTION__);
                 return (NULL);
         }
-        if (id_code < 0)
-        {
-                fprintf (stderr,
-                  (_("Warning in %s () a negative value was passed.\n")),
-                  __FUNCTION__);
-        }
         rastervariables->id_code = id_code;
 #if DEBUG
         DXF_DEBUG_END
@@ -524,11 +501,9 @@ dxf_rastervariables_set_id_code
  * \brief Get the pointer to the \c dictionary_owner_soft from a DXF 
  * \c RASTERVARIABLES object.
  *
- * \return pointer to the \c dictionary_owner_soft.
- *
- * \warning No checks are performed on the returned pointer (string).
+ * \return the handle of the \c dictionary_owner_soft.
  */
-char *
+uint64_t
 dxf_rastervariables_get_dictionary_owner_soft
 (
         DxfRasterVariables *rastervariables
@@ -544,19 +519,12 @@ dxf_rastervariables_get_dictionary_owner_soft
                 fprintf (stderr,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
-                return (NULL);
-        }
-        if (rastervariables->dictionary_owner_soft ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
+                return (0);
         }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (rastervariables->dictionary_owner_soft));
+        return (rastervariables->dictionary_owner_soft);
 }
 
 
@@ -569,8 +537,8 @@ dxf_rastervariables_set_dictionary_owner_soft
 (
         DxfRasterVariables *rastervariables,
                 /*!< a pointer to a DXF \c RASTERVARIABLES object. */
-        char *dictionary_owner_soft
-                /*!< a string containing the pointer to the \c
+        uint64_t dictionary_owner_soft
+                /*!< the handle of the \c
                  * dictionary_owner_soft for the entity. */
 )
 {
@@ -585,14 +553,7 @@ dxf_rastervariables_set_dictionary_owner_soft
                   __FUNCTION__);
                 return (NULL);
         }
-        if (dictionary_owner_soft == NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was passed.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
-        rastervariables->dictionary_owner_soft = strdup (dictionary_owner_soft);
+        rastervariables->dictionary_owner_soft = dictionary_owner_soft;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -604,11 +565,9 @@ dxf_rastervariables_set_dictionary_owner_soft
  * \brief Get the pointer to the \c dictionary_owner_hard from a DXF 
  * \c RASTERVARIABLES object.
  *
- * \return pointer to the \c dictionary_owner_hard.
- *
- * \warning No checks are performed on the returned pointer (string).
+ * \return the handle of the \c dictionary_owner_hard.
  */
-char *
+uint64_t
 dxf_rastervariables_get_dictionary_owner_hard
 (
         DxfRasterVariables *rastervariables
@@ -624,19 +583,12 @@ dxf_rastervariables_get_dictionary_owner_hard
                 fprintf (stderr,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
-                return (NULL);
-        }
-        if (rastervariables->dictionary_owner_hard ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
+                return (0);
         }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (rastervariables->dictionary_owner_hard));
+        return (rastervariables->dictionary_owner_hard);
 }
 
 
@@ -649,8 +601,8 @@ dxf_rastervariables_set_dictionary_owner_hard
 (
         DxfRasterVariables *rastervariables,
                 /*!< a pointer to a DXF \c RASTERVARIABLES object. */
-        char *dictionary_owner_hard
-                /*!< a string containing the pointer to the \c
+        uint64_t dictionary_owner_hard
+                /*!< the handle of the \c
                  * dictionary_owner_hard for the object. */
 )
 {
@@ -665,14 +617,7 @@ dxf_rastervariables_set_dictionary_owner_hard
                   __FUNCTION__);
                 return (NULL);
         }
-        if (dictionary_owner_hard == NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was passed.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
-        rastervariables->dictionary_owner_hard = strdup (dictionary_owner_hard);
+        rastervariables->dictionary_owner_hard = dictionary_owner_hard;
 #if DEBUG
         DXF_DEBUG_END
 #endif
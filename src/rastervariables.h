@@ -61,15 +61,15 @@ typedef struct
 dxf_rastervariables_struct
 {
         /* Members common for all DXF objects. */
-        int id_code;
+        uint64_t id_code;
                 /*!< Identification number for the entity.\n
                  * This is to be an unique (sequential) number in the DXF
                  * file.\n
                  * Group code = 5. */
-        char *dictionary_owner_soft;
+        uint64_t dictionary_owner_soft;
                 /*!< Soft-pointer ID/handle to owner dictionary (optional).\n
                  * Group code = 330. */
-        char *dictionary_owner_hard;
+        uint64_t dictionary_owner_hard;
                 /*!< Hard owner ID/handle to owner dictionary (optional).\n
                  * Group code = 360. */
         /* Specific members for a DXF rastervariables. */
@@ -120,12 +120,12 @@ DxfRasterVariables *dxf_rastervariables_read (DxfFile *fp, DxfRasterVariables *r
 int dxf_rastervariables_write (DxfFile *fp, DxfRasterVariables *rastervariables);
 int dxf_rastervariables_free (DxfRasterVariables *rastervariables);
 void dxf_rastervariables_free_list (DxfRasterVariables *rastervariables);
-int dxf_rastervariables_get_id_code (DxfRasterVariables *rastervariables);
-DxfRasterVariables *dxf_rastervariables_set_id_code (DxfRasterVariables *rastervariables, int id_code);
-char *dxf_rastervariables_get_dictionary_owner_soft (DxfRasterVariables *rastervariables);
-DxfRasterVariables *dxf_rastervariables_set_dictionary_owner_soft (DxfRasterVariables *rastervariables, char *dictionary_owner_soft);
-char *dxf_rastervariables_get_dictionary_owner_hard (DxfRasterVariables *rastervariables);
-DxfRasterVariables *dxf_rastervariables_set_dictionary_owner_hard (DxfRasterVariables *rastervariables, char *dictionary_owner_hard);
+uint64_t dxf_rastervariables_get_id_code (DxfRasterVariables *rastervariables);
+DxfRasterVariables *dxf_rastervariables_set_id_code (DxfRasterVariables *rastervariables, uint64_t id_code);
+uint64_t dxf_rastervariables_get_dictionary_owner_soft (DxfRasterVariables *rastervariables);
+DxfRasterVariables *dxf_rastervariables_set_dictionary_owner_soft (DxfRasterVariables *rastervariables, uint64_t dictionary_owner_soft);
+uint64_t dxf_rastervariables_get_dictionary_owner_hard (DxfRasterVariables *rastervariables);
+DxfRasterVariables *dxf_rastervariables_set_dictionary_owner_hard (DxfRasterVariables *rastervariables, uint64_t dictionary_owner_hard);
 int dxf_rastervariables_get_display_image_frame (DxfRasterVariables *rastervariables);
 DxfRasterVariables *dxf_rastervariables_set_display_image_frame (DxfRasterVariables *rastervariables, int display_image_frame);
 int dxf_rastervariables_get_display_quality (DxfRasterVariables *rastervariables);
@@ -42,6 +42,7 @@
 
 
 #include "ray.h"
+#include "util.h"
 
 
 /*!
@@ -64,7 +65,7 @@ dxf_ray_new ()
         size = sizeof (DxfRay);
         /* avoid malloc of 0 bytes */
         if (size == 0) size = 1;
-        if ((ray = malloc (size)) == NULL)
+        if ((ray = dxf_malloc (size)) == NULL)
         {
                 fprintf (stderr,
                   (_("Error in %s () could not allocate memory for a DxfRay struct.\n")),
@@ -113,9 +114,9 @@ dxf_ray_init
                 __FUNCTION__);
               return (NULL);
         }
-        ray->id_code = 0;
-        ray->linetype = strdup (DXF_DEFAULT_LINETYPE);
-        ray->layer = strdup (DXF_DEFAULT_LAYER);
+        ray->id_code = DXF_HANDLE_NONE;
+        ray->linetype = dxf_strdup (DXF_DEFAULT_LINETYPE);
+        ray->layer = dxf_strdup (DXF_DEFAULT_LAYER);
         ray->elevation = 0.0;
         ray->thickness = 0.0;
         ray->linetype_scale = DXF_DEFAULT_LINETYPE_SCALE;
@@ -126,13 +127,13 @@ dxf_ray_init
         ray->shadow_mode = 0;
         ray->binary_graphics_data = (DxfBinaryGraphicsData *) dxf_binary_graphics_data_new ();
         ray->binary_graphics_data = (DxfBinaryGraphicsData *) dxf_binary_graphics_data_init ((DxfBinaryGraphicsData *) ray->binary_graphics_data);
-        ray->dictionary_owner_soft = strdup ("");
-        ray->material = strdup ("");
-        ray->dictionary_owner_hard = strdup ("");
+        ray->dictionary_owner_soft = 0;
+        ray->material = 0;
+        ray->dictionary_owner_hard = 0;
         ray->lineweight = 0;
-        ray->plot_style_name = strdup ("");
+        ray->plot_style_name = 0;
         ray->color_value = 0;
-        ray->color_name = strdup ("");
+        ray->color_name = dxf_strdup ("");
         ray->transparency = 0;
         ray->p0 = (DxfPoint *) dxf_point_new ();
         ray->p0 = dxf_point_init ((DxfPoint *) ray->p0);
@@ -176,7 +177,8 @@ dxf_ray_read
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        char *temp_string = NULL;
+        char temp_string[DXF_MAX_STRING_LENGTH];
+        int group_code;
 
         /* Do some basic checks. */
         if (fp == NULL)
@@ -184,8 +186,6 @@ dxf_ray_read
                 fprintf (stderr,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
-                /* Clean up. */
-                free (temp_string);
                 return (NULL);
         }
         if (ray == NULL)
@@ -195,180 +195,159 @@ dxf_ray_read
                   __FUNCTION__);
                 ray = dxf_ray_init (ray);
         }
-        (fp->line_number)++;
-        fscanf (fp->fp, "%[^\n]", temp_string);
-        while (strcmp (temp_string, "0") != 0)
+        while ((dxf_read_group_code (fp, &group_code) == EXIT_SUCCESS)
+          && (group_code != 0))
         {
-                if (ferror (fp->fp))
+                if (dxf_read_error (fp))
                 {
                         fprintf (stderr,
                           (_("Error in %s () while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
-                        fclose (fp->fp);
-                        /* Clean up. */
-                        free (temp_string);
                         return (NULL);
                 }
-                if (strcmp (temp_string, "5") == 0)
-                {
-                        /* Now follows a string containing a sequential
-                         * id number. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%x\n", (uint *) &ray->id_code);
-                }
-                else if (strcmp (temp_string, "6") == 0)
-                {
-                        /* Now follows a string containing a linetype
-                         * name. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, ray->linetype);
-                }
-                else if (strcmp (temp_string, "8") == 0)
-                {
-                        /* Now follows a string containing a layer name. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, ray->layer);
-                }
-                else if (strcmp (temp_string, "10") == 0)
-                {
-                        /* Now follows a string containing the
-                         * X-coordinate of the center point. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &ray->p0->x0);
-                }
-                else if (strcmp (temp_string, "20") == 0)
-                {
-                        /* Now follows a string containing the
-                         * Y-coordinate of the center point. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &ray->p0->y0);
-                }
-                else if (strcmp (temp_string, "30") == 0)
-                {
-                        /* Now follows a string containing the
-                         * Z-coordinate of the center point. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &ray->p0->z0);
-                }
-                else if (strcmp (temp_string, "11") == 0)
-                {
-                        /* Now follows a string containing the
-                         * X-coordinate of the center point. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &ray->p1->x0);
-                }
-                else if (strcmp (temp_string, "21") == 0)
-                {
-                        /* Now follows a string containing the
-                         * Y-coordinate of the center point. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &ray->p1->y0);
-                }
-                else if (strcmp (temp_string, "31") == 0)
-                {
-                        /* Now follows a string containing the
-                         * Z-coordinate of the center point. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &ray->p1->z0);
-                }
-                else if ((fp->acad_version_number <= AutoCAD_11)
-                        && (strcmp (temp_string, "38") == 0)
-                        && (ray->elevation != 0.0))
-                {
-                        /* Now follows a string containing the
-                         * elevation. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &ray->elevation);
-                }
-                else if (strcmp (temp_string, "39") == 0)
-                {
-                        /* Now follows a string containing the
-                         * thickness. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &ray->thickness);
-                }
-                else if (strcmp (temp_string, "48") == 0)
-                {
-                        /* Now follows a string containing the linetype
-                         * scale. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &ray->linetype_scale);
-                }
-                else if (strcmp (temp_string, "60") == 0)
-                {
-                        /* Now follows a string containing the
-                         * visibility value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%hd\n", &ray->visibility);
-                }
-                else if (strcmp (temp_string, "62") == 0)
-                {
-                        /* Now follows a string containing the
-                         * color value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%d\n", &ray->color);
-                }
-                else if (strcmp (temp_string, "67") == 0)
+                switch (group_code)
                 {
-                        /* Now follows a string containing the
-                         * paperspace value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%d\n", &ray->paperspace);
-                }
-                else if ((fp->acad_version_number >= AutoCAD_13)
-                        && (strcmp (temp_string, "100") == 0))
-                {
-                        /* Now follows a string containing the
-                         * subclass marker value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
-                        if ((strcmp (temp_string, "AcDbEntity") != 0)
-                        && ((strcmp (temp_string, "AcDbRay") != 0)))
-                        {
+                        case 5:
+                                /* Now follows a string containing a sequential
+                                 * id number. */
+                                dxf_read_handle (fp, &ray->id_code);
+                                break;
+                        case 6:
+                                /* Now follows a string containing a linetype
+                                 * name. */
+                                dxf_read_string_interned (fp, &ray->linetype);
+                                break;
+                        case 8:
+                                /* Now follows a string containing a layer name. */
+                                dxf_read_string_interned (fp, &ray->layer);
+                                break;
+                        case 10:
+                                /* Now follows a string containing the
+                                 * X-coordinate of the center point. */
+                                dxf_read_double (fp, &ray->p0->x0);
+                                break;
+                        case 20:
+                                /* Now follows a string containing the
+                                 * Y-coordinate of the center point. */
+                                dxf_read_double (fp, &ray->p0->y0);
+                                break;
+                        case 30:
+                                /* Now follows a string containing the
+                                 * Z-coordinate of the center point. */
+                                dxf_read_double (fp, &ray->p0->z0);
+                                break;
+                        case 11:
+                                /* Now follows a string containing the
+                                 * X-coordinate of the center point. */
+                                dxf_read_double (fp, &ray->p1->x0);
+                                break;
+                        case 21:
+                                /* Now follows a string containing the
+                                 * Y-coordinate of the center point. */
+                                dxf_read_double (fp, &ray->p1->y0);
+                                break;
+                        case 31:
+                                /* Now follows a string containing the
+                                 * Z-coordinate of the center point. */
+                                dxf_read_double (fp, &ray->p1->z0);
+                                break;
+                        case 38:
+                                if ((fp->acad_version_number <= AutoCAD_11) && (ray->elevation != 0.0))
+                                {
+                                        /* Now follows a string containing the
+                                         * elevation. */
+                                        dxf_read_double (fp, &ray->elevation);
+                                }
+                                else
+                                {
+                                        fprintf (stderr,
+                                          (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
+                                          __FUNCTION__, fp->filename, fp->line_number);
+                                        /* Skip the value of the unknown group code. */
+                                        dxf_read_line (temp_string, fp);
+                                }
+                                break;
+                        case 39:
+                                /* Now follows a string containing the
+                                 * thickness. */
+                                dxf_read_double (fp, &ray->thickness);
+                                break;
+                        case 48:
+                                /* Now follows a string containing the linetype
+                                 * scale. */
+                                dxf_read_double (fp, &ray->linetype_scale);
+                                break;
+                        case 60:
+                                /* Now follows a string containing the
+                                 * visibility value. */
+                                dxf_read_int16 (fp, &ray->visibility);
+                                break;
+                        case 62:
+                                /* Now follows a string containing the
+                                 * color value. */
+                                dxf_read_int (fp, &ray->color);
+                                break;
+                        case 67:
+                                /* Now follows a string containing the
+                                 * paperspace value. */
+                                dxf_read_int (fp, &ray->paperspace);
+                                break;
+                        case 100:
+                                if (fp->acad_version_number >= AutoCAD_13)
+                                {
+                                        /* Now follows a string containing the
+                                         * subclass marker value. */
+                                        dxf_read_line (temp_string, fp);
+                                        if ((strcmp (temp_string, "AcDbEntity") != 0)
+                                        && ((strcmp (temp_string, "AcDbRay") != 0)))
+                                        {
+                                                fprintf (stderr,
+                                                  (_("Error in %s () found a bad subclass marker in: %s in line: %d.\n")),
+                                                  __FUNCTION__, fp->filename, fp->line_number);
+                                        }
+                                }
+                                else
+                                {
+                                        fprintf (stderr,
+                                          (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
+                                          __FUNCTION__, fp->filename, fp->line_number);
+                                        /* Skip the value of the unknown group code. */
+                                        dxf_read_line (temp_string, fp);
+                                }
+                                break;
+                        case 330:
+                                /* Now follows a string containing Soft-pointer
+                                 * ID/handle to owner dictionary. */
+                                dxf_read_handle (fp, &ray->dictionary_owner_soft);
+                                break;
+                        case 360:
+                                /* Now follows a string containing Hard owner
+                                 * ID/handle to owner dictionary. */
+                                dxf_read_handle (fp, &ray->dictionary_owner_hard);
+                                break;
+                        case 999:
+                                /* Now follows a string containing a comment. */
+                                dxf_read_line (temp_string, fp);
+                                fprintf (stdout, "DXF comment: %s\n", temp_string);
+                                break;
+                        default:
                                 fprintf (stderr,
-                                  (_("Error in %s () found a bad subclass marker in: %s in line: %d.\n")),
+                                  (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
                                   __FUNCTION__, fp->filename, fp->line_number);
-                        }
-                }
-                else if (strcmp (temp_string, "330") == 0)
-                {
-                        /* Now follows a string containing Soft-pointer
-                         * ID/handle to owner dictionary. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, ray->dictionary_owner_soft);
-                }
-                else if (strcmp (temp_string, "360") == 0)
-                {
-                        /* Now follows a string containing Hard owner
-                         * ID/handle to owner dictionary. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, ray->dictionary_owner_hard);
-                }
-                else if (strcmp (temp_string, "999") == 0)
-                {
-                        /* Now follows a string containing a comment. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
-                        fprintf (stdout, "DXF comment: %s\n", temp_string);
-                }
-                else
-                {
-                        fprintf (stderr,
-                          (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
-                          __FUNCTION__, fp->filename, fp->line_number);
+                                /* Skip the value of the unknown group code. */
+                                dxf_read_line (temp_string, fp);
+                                break;
                 }
         }
         /* Handle omitted members and/or illegal values. */
         if (strcmp (ray->linetype, "") == 0)
         {
-                ray->linetype = strdup (DXF_DEFAULT_LINETYPE);
+                ray->linetype = dxf_strdup (DXF_DEFAULT_LINETYPE);
         }
         if (strcmp (ray->layer, "") == 0)
         {
-                ray->layer = strdup (DXF_DEFAULT_LAYER);
+                ray->layer = dxf_strdup (DXF_DEFAULT_LAYER);
         }
-        /* Clean up. */
-        free (temp_string);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -394,7 +373,7 @@ dxf_ray_write
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        char *dxf_entity_name = strdup ("RAY");
+        char *dxf_entity_name = dxf_strdup ("RAY");
 
         /* Do some basic checks. */
         if (fp == NULL)
@@ -403,7 +382,7 @@ dxf_ray_write
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (ray == NULL)
@@ -412,7 +391,7 @@ dxf_ray_write
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if ((ray->p0->x0 == ray->p1->x0)
@@ -420,11 +399,11 @@ dxf_ray_write
                 && (ray->p0->z0 == ray->p1->z0))
         {
                 fprintf (stderr,
-                  (_("Error in %s () start point and end point are identical for the %s entity with id-code: %x\n")),
+                  (_("Error in %s () start point and end point are identical for the %s entity with id-code: %" PRIx64 "\n")),
                   __FUNCTION__, dxf_entity_name, ray->id_code);
                 dxf_entity_skip (dxf_entity_name);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (fp->acad_version_number < AutoCAD_13)
@@ -436,28 +415,28 @@ dxf_ray_write
         if (strcmp (ray->linetype, "") == 0)
         {
                 fprintf (stderr,
-                  (_("Warning in %s () empty linetype string for the %s entity with id-code: %x\n")),
+                  (_("Warning in %s () empty linetype string for the %s entity with id-code: %" PRIx64 "\n")),
                   __FUNCTION__, dxf_entity_name, ray->id_code);
                 fprintf (stderr,
                   (_("\t%s entity is reset to default linetype")),
                   dxf_entity_name);
-                ray->linetype = strdup (DXF_DEFAULT_LINETYPE);
+                ray->linetype = dxf_strdup (DXF_DEFAULT_LINETYPE);
         }
         if (strcmp (ray->layer, "") == 0)
         {
                 fprintf (stderr,
-                  (_("Warning in %s () empty layer string for the %s entity with id-code: %x\n")),
+                  (_("Warning in %s () empty layer string for the %s entity with id-code: %" PRIx64 "\n")),
                   __FUNCTION__, dxf_entity_name, ray->id_code);
                 fprintf (stderr,
                   (_("\t%s entity is relocated to layer 0\n")),
                   dxf_entity_name);
-                ray->layer = strdup (DXF_DEFAULT_LAYER);
+                ray->layer = dxf_strdup (DXF_DEFAULT_LAYER);
         }
         /* Start writing output. */
-        fprintf (fp->fp, "  0\n%s\n", dxf_entity_name);
-        if (ray->id_code != -1)
+        dxf_write_string (fp, 0, dxf_entity_name);
+        if (ray->id_code != DXF_HANDLE_NONE)
         {
-                fprintf (fp->fp, "  5\n%x\n", ray->id_code);
+                dxf_write_hex (fp, 5, ray->id_code);
         }
         /*!
          * \todo for version R14.\n
@@ -469,67 +448,67 @@ dxf_ray_write
          * 102 groups are application defined (optional).\n\n
          * End of group, "}" (optional), with Group code 102.
          */
-        if ((strcmp (ray->dictionary_owner_soft, "") != 0)
+        if ((ray->dictionary_owner_soft != 0)
           && (fp->acad_version_number >= AutoCAD_14))
         {
-                fprintf (fp->fp, "102\n{ACAD_REACTORS\n");
-                fprintf (fp->fp, "330\n%s\n", ray->dictionary_owner_soft);
-                fprintf (fp->fp, "102\n}\n");
+                dxf_write_string (fp, 102, "{ACAD_REACTORS");
+                dxf_write_hex (fp, 330, ray->dictionary_owner_soft);
+                dxf_write_string (fp, 102, "}");
         }
-        if ((strcmp (ray->dictionary_owner_hard, "") != 0)
+        if ((ray->dictionary_owner_hard != 0)
           && (fp->acad_version_number >= AutoCAD_14))
         {
-                fprintf (fp->fp, "102\n{ACAD_XDICTIONARY\n");
-                fprintf (fp->fp, "360\n%s\n", ray->dictionary_owner_hard);
-                fprintf (fp->fp, "102\n}\n");
+                dxf_write_string (fp, 102, "{ACAD_XDICTIONARY");
+                dxf_write_hex (fp, 360, ray->dictionary_owner_hard);
+                dxf_write_string (fp, 102, "}");
         }
         if (fp->acad_version_number >= AutoCAD_13)
         {
-                fprintf (fp->fp, "100\nAcDbEntity\n");
+                dxf_write_string (fp, 100, "AcDbEntity");
         }
         if (ray->paperspace == DXF_PAPERSPACE)
         {
-                fprintf (fp->fp, " 67\n%d\n", (int16_t) DXF_PAPERSPACE);
+                dxf_write_int (fp, 67, (int16_t) DXF_PAPERSPACE);
         }
-        fprintf (fp->fp, "  8\n%s\n", ray->layer);
+        dxf_write_string (fp, 8, ray->layer);
         if (strcmp (ray->linetype, DXF_DEFAULT_LINETYPE) != 0)
         {
-                fprintf (fp->fp, "  6\n%s\n", ray->linetype);
+                dxf_write_string (fp, 6, ray->linetype);
         }
         if ((fp->acad_version_number <= AutoCAD_11)
           && DXF_FLATLAND
           && (ray->elevation != 0.0))
         {
-                fprintf (fp->fp, " 38\n%f\n", ray->elevation);
+                dxf_write_double (fp, 38, ray->elevation);
         }
         if (ray->color != DXF_COLOR_BYLAYER)
         {
-                fprintf (fp->fp, " 62\n%d\n", ray->color);
+                dxf_write_int (fp, 62, ray->color);
         }
         if (ray->linetype_scale != 1.0)
         {
-                fprintf (fp->fp, " 48\n%f\n", ray->linetype_scale);
+                dxf_write_double (fp, 48, ray->linetype_scale);
         }
         if (ray->visibility != 0)
         {
-                fprintf (fp->fp, " 60\n%d\n", ray->visibility);
+                dxf_write_int (fp, 60, ray->visibility);
         }
         if (fp->acad_version_number >= AutoCAD_13)
         {
-                fprintf (fp->fp, "100\nAcDbRay\n");
+                dxf_write_string (fp, 100, "AcDbRay");
         }
         if (ray->thickness != 0.0)
         {
-                fprintf (fp->fp, " 39\n%f\n", ray->thickness);
+                dxf_write_double (fp, 39, ray->thickness);
         }
-        fprintf (fp->fp, " 10\n%f\n", ray->p0->x0);
-        fprintf (fp->fp, " 20\n%f\n", ray->p0->y0);
-        fprintf (fp->fp, " 30\n%f\n", ray->p0->z0);
-        fprintf (fp->fp, " 11\n%f\n", ray->p1->x0);
-        fprintf (fp->fp, " 21\n%f\n", ray->p1->y0);
-        fprintf (fp->fp, " 31\n%f\n", ray->p1->z0);
+        dxf_write_double (fp, 10, ray->p0->x0);
+        dxf_write_double (fp, 20, ray->p0->y0);
+        dxf_write_double (fp, 30, ray->p0->z0);
+        dxf_write_double (fp, 11, ray->p1->x0);
+        dxf_write_double (fp, 21, ray->p1->y0);
+        dxf_write_double (fp, 31, ray->p1->z0);
         /* Clean up. */
-        free (dxf_entity_name);
+        dxf_free (dxf_entity_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -570,13 +549,11 @@ dxf_ray_free
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        free (ray->linetype);
-        free (ray->layer);
-        free (ray->dictionary_owner_soft);
-        free (ray->dictionary_owner_hard);
+        dxf_string_free (ray->linetype);
+        dxf_string_free (ray->layer);
         dxf_point_free (ray->p0);
         dxf_point_free (ray->p1);
-        free (ray);
+        dxf_free (ray);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -622,7 +599,7 @@ dxf_ray_free_list
  *
  * \return \c id_code.
  */
-int
+uint64_t
 dxf_ray_get_id_code
 (
         DxfRay *ray
@@ -640,12 +617,6 @@ dxf_ray_get_id_code
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (ray->id_code < 0)
-        {
-                fprintf (stderr,
-                  (_("Warning in %s () a negative value was found.\n")),
-                  __FUNCTION__);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -661,7 +632,7 @@ dxf_ray_set_id_code
 (
         DxfRay *ray,
                 /*!< a pointer to a DXF \c RAY entity. */
-        int id_code
+        uint64_t id_code
                 /*!< the \c id_code to be set for the entity.\n
                  * This is to be an unique (sequential) number in the
                  * DXF file. */
@@ -678,12 +649,6 @@ dxf_ray_set_id_code
                   __FUNCTION__);
                 return (NULL);
         }
-        if (id_code < 0)
-        {
-                fprintf (stderr,
-                  (_("Warning in %s () a negative value was passed.\n")),
-                  __FUNCTION__);
-        }
         ray->id_code = id_code;
 #if DEBUG
         DXF_DEBUG_END
@@ -725,7 +690,7 @@ dxf_ray_get_linetype
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (ray->linetype));
+        return (dxf_strdup (ray->linetype));
 }
 
 
@@ -760,7 +725,7 @@ dxf_ray_set_linetype
                   __FUNCTION__);
                 return (NULL);
         }
-        ray->linetype = strdup (linetype);
+        ray->linetype = dxf_strdup (linetype);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -801,7 +766,7 @@ dxf_ray_get_layer
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (ray->layer));
+        return (dxf_strdup (ray->layer));
 }
 
 
@@ -836,7 +801,7 @@ dxf_ray_set_layer
                   __FUNCTION__);
                 return (NULL);
         }
-        ray->layer = strdup (layer);
+        ray->layer = dxf_strdup (layer);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1573,11 +1538,9 @@ dxf_ray_set_binary_graphics_data
  * \brief Get the pointer to the \c dictionary_owner_soft from a DXF 
  * \c RAY entity.
  *
- * \return pointer to the \c dictionary_owner_soft.
- *
- * \warning No checks are performed on the returned pointer (string).
+ * \return the handle of the \c dictionary_owner_soft.
  */
-char *
+uint64_t
 dxf_ray_get_dictionary_owner_soft
 (
         DxfRay *ray
@@ -1593,19 +1556,12 @@ dxf_ray_get_dictionary_owner_soft
                 fprintf (stderr,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
-                return (NULL);
-        }
-        if (ray->dictionary_owner_soft ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
+                return (0);
         }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (ray->dictionary_owner_soft));
+        return (ray->dictionary_owner_soft);
 }
 
 
@@ -1618,8 +1574,8 @@ dxf_ray_set_dictionary_owner_soft
 (
         DxfRay *ray,
                 /*!< a pointer to a DXF \c RAY entity. */
-        char *dictionary_owner_soft
-                /*!< a string containing the pointer to the \c
+        uint64_t dictionary_owner_soft
+                /*!< the handle of the \c
                  * dictionary_owner_soft for the entity. */
 )
 {
@@ -1634,14 +1590,7 @@ dxf_ray_set_dictionary_owner_soft
                   __FUNCTION__);
                 return (NULL);
         }
-        if (dictionary_owner_soft == NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was passed.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
-        ray->dictionary_owner_soft = strdup (dictionary_owner_soft);
+        ray->dictionary_owner_soft = dictionary_owner_soft;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1652,12 +1601,10 @@ dxf_ray_set_dictionary_owner_soft
 /*!
  * \brief Get the pointer to the \c material from a DXF \c RAY entity.
  *
- * \return a pointer to \c material when successful, or \c NULL when an
+ * \return the handle \c material when successful, or 0 when an
  * error occurred.
- *
- * \warning No checks are performed on the returned pointer.
  */
-char *
+uint64_t
 dxf_ray_get_material
 (
         DxfRay *ray
@@ -1673,19 +1620,12 @@ dxf_ray_get_material
                 fprintf (stderr,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
-                return (NULL);
-        }
-        if (ray->material ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
+                return (0);
         }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (ray->material));
+        return (ray->material);
 }
 
 
@@ -1700,8 +1640,8 @@ dxf_ray_set_material
 (
         DxfRay *ray,
                 /*!< a pointer to a DXF \c RAY entity. */
-        char *material
-                /*!< a string containing the pointer to the \c
+        uint64_t material
+                /*!< the handle of the \c
                  * material for the entity. */
 )
 {
@@ -1716,14 +1656,7 @@ dxf_ray_set_material
                   __FUNCTION__);
                 return (NULL);
         }
-        if (material == NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was passed.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
-        ray->material = strdup (material);
+        ray->material = material;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1735,11 +1668,9 @@ dxf_ray_set_material
  * \brief Get the pointer to the \c dictionary_owner_hard from a DXF 
  * \c RAY entity.
  *
- * \return pointer to the \c dictionary_owner_hard.
- *
- * \warning No checks are performed on the returned pointer (string).
+ * \return the handle of the \c dictionary_owner_hard.
  */
-char *
+uint64_t
 dxf_ray_get_dictionary_owner_hard
 (
         DxfRay *ray
@@ -1755,19 +1686,12 @@ dxf_ray_get_dictionary_owner_hard
                 fprintf (stderr,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
-                return (NULL);
-        }
-        if (ray->dictionary_owner_hard ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
+                return (0);
         }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (ray->dictionary_owner_hard));
+        return (ray->dictionary_owner_hard);
 }
 
 
@@ -1780,8 +1704,8 @@ dxf_ray_set_dictionary_owner_hard
 (
         DxfRay *ray,
                 /*!< a pointer to a DXF \c RAY entity. */
-        char *dictionary_owner_hard
-                /*!< a string containing the pointer to the \c
+        uint64_t dictionary_owner_hard
+                /*!< the handle of the \c
                  * dictionary_owner_hard for the entity. */
 )
 {
@@ -1796,14 +1720,7 @@ dxf_ray_set_dictionary_owner_hard
                   __FUNCTION__);
                 return (NULL);
         }
-        if (dictionary_owner_hard == NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was passed.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
-        ray->dictionary_owner_hard = strdup (dictionary_owner_hard);
+        ray->dictionary_owner_hard = dictionary_owner_hard;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1879,10 +1796,10 @@ dxf_ray_set_lineweight
 /*!
  * \brief Get the \c plot_style_name from a DXF \c RAY entity.
  *
- * \return a pointer to \c plot_style_name when sucessful, or \c NULL
+ * \return the handle \c plot_style_name when sucessful, or 0
  * when an error occurred.
  */
-char *
+uint64_t
 dxf_ray_get_plot_style_name
 (
         DxfRay *ray
@@ -1898,19 +1815,12 @@ dxf_ray_get_plot_style_name
                 fprintf (stderr,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
-                return (NULL);
-        }
-        if (ray->plot_style_name ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
+                return (0);
         }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (ray->plot_style_name));
+        return (ray->plot_style_name);
 }
 
 
@@ -1925,7 +1835,7 @@ dxf_ray_set_plot_style_name
 (
         DxfRay *ray,
                 /*!< a pointer to a DXF \c RAY entity. */
-        char *plot_style_name
+        uint64_t plot_style_name
                 /*!< a string containing the \c plot_style_name for the
                  * entity. */
 )
@@ -1941,14 +1851,7 @@ dxf_ray_set_plot_style_name
                   __FUNCTION__);
                 return (NULL);
         }
-        if (plot_style_name == NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was passed.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
-        ray->plot_style_name = strdup (plot_style_name);
+        ray->plot_style_name = plot_style_name;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2055,7 +1958,7 @@ dxf_ray_get_color_name
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (ray->color_name));
+        return (dxf_strdup (ray->color_name));
 }
 
 
@@ -2093,7 +1996,7 @@ dxf_ray_set_color_name
                   __FUNCTION__);
                 return (NULL);
         }
-        ray->color_name = strdup (color_name);
+        ray->color_name = dxf_strdup (color_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -62,7 +62,7 @@ typedef struct
 dxf_ray_struct
 {
         /* Members common for all DXF drawable entities. */
-        int id_code;
+        uint64_t id_code;
                 /*!< Identification number for the entity.\n
                  * This is to be an unique (sequential) number in the DXF
                  * file.\n
@@ -135,16 +135,16 @@ dxf_ray_struct
                  * (optional).\n
                  * Group code = 310.\n
                  * \since Introduced in version R2000. */
-        char *dictionary_owner_soft;
+        uint64_t dictionary_owner_soft;
                 /*!< Soft-pointer ID/handle to owner dictionary (optional).\n
                  * Group code = 330.\n
                  * \since Introduced in version R14. */
-        char *material;
+        uint64_t material;
                 /*!< Hard-pointer ID/handle to material object (present if
                  * not BYLAYER).\n
                  * Group code = 347.\n
                  * \since Introduced in version R2008. */
-        char *dictionary_owner_hard;
+        uint64_t dictionary_owner_hard;
                 /*!< Hard owner ID/handle to owner dictionary (optional).\n
                  * Group code = 360.\n
                  * \since Introduced in version R14. */
@@ -153,7 +153,7 @@ dxf_ray_struct
                  * Stored and moved around as a 16-bit integer.\n
                  * Group code = 370.\n
                  * \since Introduced in version R2002. */
-        char *plot_style_name;
+        uint64_t plot_style_name;
                 /*!< Hard pointer ID / handle of PlotStyleName object.\n
                  * Group code = 390.\n
                  * \since Introduced in version R2009. */
@@ -204,8 +204,8 @@ DxfRay *dxf_ray_read (DxfFile *fp, DxfRay *ray);
 int dxf_ray_write (DxfFile *fp, DxfRay *ray);
 int dxf_ray_free (DxfRay *ray);
 void dxf_ray_free_list (DxfRay *rays);
-int dxf_ray_get_id_code (DxfRay *ray);
-DxfRay *dxf_ray_set_id_code (DxfRay *ray, int id_code);
+uint64_t dxf_ray_get_id_code (DxfRay *ray);
+DxfRay *dxf_ray_set_id_code (DxfRay *ray, uint64_t id_code);
 char *dxf_ray_get_linetype (DxfRay *ray);
 DxfRay *dxf_ray_set_linetype (DxfRay *ray, char *linetype);
 char *dxf_ray_get_layer (DxfRay *ray);
@@ -228,16 +228,16 @@ int16_t dxf_ray_get_shadow_mode (DxfRay *ray);
 DxfRay *dxf_ray_set_shadow_mode (DxfRay *ray, int16_t shadow_mode);
 DxfBinaryGraphicsData *dxf_ray_get_binary_graphics_data (DxfRay *ray);
 DxfRay *dxf_ray_set_binary_graphics_data (DxfRay *ray, DxfBinaryGraphicsData *data);
-char *dxf_ray_get_dictionary_owner_soft (DxfRay *ray);
-DxfRay *dxf_ray_set_dictionary_owner_soft (DxfRay *ray, char *dictionary_owner_soft);
-char *dxf_ray_get_material (DxfRay *ray);
-DxfRay *dxf_ray_set_material (DxfRay *ray, char *material);
-char *dxf_ray_get_dictionary_owner_hard (DxfRay *ray);
-DxfRay *dxf_ray_set_dictionary_owner_hard (DxfRay *ray, char *dictionary_owner_hard);
+uint64_t dxf_ray_get_dictionary_owner_soft (DxfRay *ray);
+DxfRay *dxf_ray_set_dictionary_owner_soft (DxfRay *ray, uint64_t dictionary_owner_soft);
+uint64_t dxf_ray_get_material (DxfRay *ray);
+DxfRay *dxf_ray_set_material (DxfRay *ray, uint64_t material);
+uint64_t dxf_ray_get_dictionary_owner_hard (DxfRay *ray);
+DxfRay *dxf_ray_set_dictionary_owner_hard (DxfRay *ray, uint64_t dictionary_owner_hard);
 int16_t dxf_ray_get_lineweight (DxfRay *ray);
 DxfRay *dxf_ray_set_lineweight (DxfRay *ray, int16_t lineweight);
-char *dxf_ray_get_plot_style_name (DxfRay *ray);
-DxfRay *dxf_ray_set_plot_style_name (DxfRay *ray, char *plot_style_name);
+uint64_t dxf_ray_get_plot_style_name (DxfRay *ray);
+DxfRay *dxf_ray_set_plot_style_name (DxfRay *ray, uint64_t plot_style_name);
 long dxf_ray_get_color_value (DxfRay *ray);
 DxfRay *dxf_ray_set_color_value (DxfRay *ray, long color_value);
 char *dxf_ray_get_color_name (DxfRay *ray);
@@ -61,7 +61,7 @@ dxf_region_new ()
         size = sizeof (DxfRegion);
         /* avoid malloc of 0 bytes */
         if (size == 0) size = 1;
-        if ((region = malloc (size)) == NULL)
+        if ((region = dxf_malloc (size)) == NULL)
         {
                 fprintf (stderr,
                   (_("Error in %s () could not allocate memory for a DxfRegion struct.\n")),
@@ -112,9 +112,9 @@ dxf_region_init
               return (NULL);
         }
         region->modeler_format_version_number = 0;
-        region->id_code = 0;
-        region->linetype = strdup (DXF_DEFAULT_LINETYPE);
-        region->layer = strdup (DXF_DEFAULT_LAYER);
+        region->id_code = DXF_HANDLE_NONE;
+        region->linetype = dxf_strdup (DXF_DEFAULT_LINETYPE);
+        region->layer = dxf_strdup (DXF_DEFAULT_LAYER);
         region->elevation = 0.0;
         region->thickness = 0.0;
         region->linetype_scale = DXF_DEFAULT_LINETYPE_SCALE;
@@ -124,16 +124,16 @@ dxf_region_init
         region->modeler_format_version_number = 1;
         dxf_char_new (region->proprietary_data);
         region->proprietary_data = dxf_char_init (region->proprietary_data);
-        region->proprietary_data->value = strdup ("");
+        region->proprietary_data->value = dxf_strdup ("");
         region->proprietary_data->length = 0;
         region->proprietary_data->next = NULL;
         dxf_char_new (region->additional_proprietary_data);
         region->additional_proprietary_data = dxf_char_init (region->additional_proprietary_data);
-        region->additional_proprietary_data->value = strdup ("");
+        region->additional_proprietary_data->value = dxf_strdup ("");
         region->additional_proprietary_data->length = 0;
         region->additional_proprietary_data->next = NULL;
-        region->dictionary_owner_soft = strdup ("");
-        region->dictionary_owner_hard = strdup ("");
+        region->dictionary_owner_soft = 0;
+        region->dictionary_owner_hard = 0;
         region->next = NULL;
 #if DEBUG
         DXF_DEBUG_END
@@ -166,7 +166,8 @@ dxf_region_read
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        char *temp_string = NULL;
+        char temp_string[DXF_MAX_STRING_LENGTH];
+        int group_code;
         DxfChar *iter1 = NULL;
         DxfChar *iter2 = NULL;
 
@@ -176,8 +177,6 @@ dxf_region_read
                 fprintf (stderr,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
-                /* Clean up. */
-                free (temp_string);
                 return (NULL);
         }
         if (region == NULL)
@@ -189,162 +188,157 @@ dxf_region_read
         }
         iter1 = (DxfChar *) region->proprietary_data;
         iter2 = (DxfChar *) region->additional_proprietary_data;
-        (fp->line_number)++;
-        fscanf (fp->fp, "%[^\n]", temp_string);
-        while (strcmp (temp_string, "0") != 0)
+        while ((dxf_read_group_code (fp, &group_code) == EXIT_SUCCESS)
+          && (group_code != 0))
         {
-                if (ferror (fp->fp))
+                if (dxf_read_error (fp))
                 {
                         fprintf (stderr,
                           (_("Error in %s () while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
-                        fclose (fp->fp);
-                        /* Clean up. */
-                        free (temp_string);
                         return (NULL);
                 }
-                else if (strcmp (temp_string, "  1") == 0)
-                {
-                        /* Now follows a string containing proprietary
-                         * data. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, iter1->value);
-                        iter1->next = (struct DxfChar *) dxf_char_init ((DxfChar *) iter1->next);
-                        iter1 = (DxfChar *) iter1->next;
-                }
-                else if (strcmp (temp_string, "  3") == 0)
-                {
-                        /* Now follows a string containing additional
-                         * proprietary data. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, iter2->value);
-                        iter2->next = (struct DxfChar *) dxf_char_init ((DxfChar *) iter2->next);
-                        iter2 = (DxfChar *) iter2->next;
-                }
-                if (strcmp (temp_string, "5") == 0)
-                {
-                        /* Now follows a string containing a sequential
-                         * id number. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%x\n", (uint *) &region->id_code);
-                }
-                else if (strcmp (temp_string, "6") == 0)
-                {
-                        /* Now follows a string containing a linetype
-                         * name. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, region->linetype);
-                }
-                else if (strcmp (temp_string, "8") == 0)
-                {
-                        /* Now follows a string containing a layer name. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, region->layer);
-                }
-                else if ((fp->acad_version_number <= AutoCAD_11)
-                        && (strcmp (temp_string, "38") == 0)
-                        && (region->elevation != 0.0))
-                {
-                        /* Now follows a string containing the
-                         * elevation. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &region->elevation);
-                }
-                else if (strcmp (temp_string, "39") == 0)
-                {
-                        /* Now follows a string containing the
-                         * thickness. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &region->thickness);
-                }
-                else if (strcmp (temp_string, "48") == 0)
-                {
-                        /* Now follows a string containing the linetype
-                         * scale. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &region->linetype_scale);
-                }
-                else if (strcmp (temp_string, "60") == 0)
-                {
-                        /* Now follows a string containing the
-                         * visibility value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%hd\n", &region->visibility);
-                }
-                else if (strcmp (temp_string, "62") == 0)
-                {
-                        /* Now follows a string containing the
-                         * color value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%d\n", &region->color);
-                }
-                else if (strcmp (temp_string, "67") == 0)
-                {
-                        /* Now follows a string containing the
-                         * paperspace value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%d\n", &region->paperspace);
-                }
-                else if ((fp->acad_version_number >= AutoCAD_13)
-                        && (strcmp (temp_string, "70") == 0))
-                {
-                        /* Now follows a string containing the modeler
-                         * format version number. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%d\n", &region->modeler_format_version_number);
-                }
-                else if ((fp->acad_version_number >= AutoCAD_13)
-                        && (strcmp (temp_string, "100") == 0))
-                {
-                        /* Now follows a string containing the
-                         * subclass marker value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
-                        if (strcmp (temp_string, "AcDbModelerGeometry") != 0)
-                        {
-                                fprintf (stderr, "Error in dxf_region_read () found a bad subclass marker in: %s in line: %d.\n",
-                                        fp->filename, fp->line_number);
-                        }
-                }
-                else if (strcmp (temp_string, "330") == 0)
+                switch (group_code)
                 {
-                        /* Now follows a string containing Soft-pointer
-                         * ID/handle to owner dictionary. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, region->dictionary_owner_soft);
-                }
-                else if (strcmp (temp_string, "360") == 0)
-                {
-                        /* Now follows a string containing Hard owner
-                         * ID/handle to owner dictionary. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, region->dictionary_owner_hard);
-                }
-                else if (strcmp (temp_string, "999") == 0)
-                {
-                        /* Now follows a string containing a comment. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
-                        fprintf (stdout, "DXF comment: %s\n", temp_string);
-                }
-                else
-                {
-                        fprintf (stderr,
-                          (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
-                          __FUNCTION__, fp->filename, fp->line_number);
+                        case 1:
+                                /* Now follows a string containing proprietary
+                                 * data. */
+                                dxf_read_string (fp, &iter1->value);
+                                iter1->next = (struct DxfChar *) dxf_char_init ((DxfChar *) iter1->next);
+                                iter1 = (DxfChar *) iter1->next;
+                                break;
+                        case 3:
+                                /* Now follows a string containing additional
+                                 * proprietary data. */
+                                dxf_read_string (fp, &iter2->value);
+                                iter2->next = (struct DxfChar *) dxf_char_init ((DxfChar *) iter2->next);
+                                iter2 = (DxfChar *) iter2->next;
+                                break;
+                        case 5:
+                                /* Now follows a string containing a sequential
+                                 * id number. */
+                                dxf_read_handle (fp, &region->id_code);
+                                break;
+                        case 6:
+                                /* Now follows a string containing a linetype
+                                 * name. */
+                                dxf_read_string_interned (fp, &region->linetype);
+                                break;
+                        case 8:
+                                /* Now follows a string containing a layer name. */
+                                dxf_read_string_interned (fp, &region->layer);
+                                break;
+                        case 38:
+                                if ((fp->acad_version_number <= AutoCAD_11) && (region->elevation != 0.0))
+                                {
+                                        /* Now follows a string containing the
+                                         * elevation. */
+                                        dxf_read_double (fp, &region->elevation);
+                                }
+                                else
+                                {
+                                        fprintf (stderr,
+                                          (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
+                                          __FUNCTION__, fp->filename, fp->line_number);
+                                        /* Skip the value of the unknown group code. */
+                                        dxf_read_line (temp_string, fp);
+                                }
+                                break;
+                        case 39:
+                                /* Now follows a string containing the
+                                 * thickness. */
+                                dxf_read_double (fp, &region->thickness);
+                                break;
+                        case 48:
+                                /* Now follows a string containing the linetype
+                                 * scale. */
+                                dxf_read_double (fp, &region->linetype_scale);
+                                break;
+                        case 60:
+                                /* Now follows a string containing the
+                                 * visibility value. */
+                                dxf_read_int16 (fp, &region->visibility);
+                                break;
+                        case 62:
+                                /* Now follows a string containing the
+                                 * color value. */
+                                dxf_read_int (fp, &region->color);
+                                break;
+                        case 67:
+                                /* Now follows a string containing the
+                                 * paperspace value. */
+                                dxf_read_int (fp, &region->paperspace);
+                                break;
+                        case 70:
+                                if (fp->acad_version_number >= AutoCAD_13)
+                                {
+                                        /* Now follows a string containing the modeler
+                                         * format version number. */
+                                        dxf_read_int (fp, &region->modeler_format_version_number);
+                                }
+                                else
+                                {
+                                        fprintf (stderr,
+                                          (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
+                                          __FUNCTION__, fp->filename, fp->line_number);
+                                        /* Skip the value of the unknown group code. */
+                                        dxf_read_line (temp_string, fp);
+                                }
+                                break;
+                        case 100:
+                                if (fp->acad_version_number >= AutoCAD_13)
+                                {
+                                        /* Now follows a string containing the
+                                         * subclass marker value. */
+                                        dxf_read_line (temp_string, fp);
+                                        if (strcmp (temp_string, "AcDbModelerGeometry") != 0)
+                                        {
+                                                fprintf (stderr, "Error in dxf_region_read () found a bad subclass marker in: %s in line: %d.\n",
+                                                        fp->filename, fp->line_number);
+                                        }
+                                }
+                                else
+                                {
+                                        fprintf (stderr,
+                                          (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
+                                          __FUNCTION__, fp->filename, fp->line_number);
+                                        /* Skip the value of the unknown group code. */
+                                        dxf_read_line (temp_string, fp);
+                                }
+                                break;
+                        case 330:
+                                /* Now follows a string containing Soft-pointer
+                                 * ID/handle to owner dictionary. */
+                                dxf_read_handle (fp, &region->dictionary_owner_soft);
+                                break;
+                        case 360:
+                                /* Now follows a string containing Hard owner
+                                 * ID/handle to owner dictionary. */
+                                dxf_read_handle (fp, &region->dictionary_owner_hard);
+                                break;
+                        case 999:
+                                /* Now follows a string containing a comment. */
+                                dxf_read_line (temp_string, fp);
+                                fprintf (stdout, "DXF comment: %s\n", temp_string);
+                                break;
+                        default:
+                                fprintf (stderr,
+                                  (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
+                                  __FUNCTION__, fp->filename, fp->line_number);
+                                /* Skip the value of the unknown group code. */
+                                dxf_read_line (temp_string, fp);
+                                break;
                 }
         }
         /* Handle omitted members and/or illegal values. */
         if (strcmp (region->linetype, "") == 0)
         {
-                region->linetype = strdup (DXF_DEFAULT_LINETYPE);
+                region->linetype = dxf_strdup (DXF_DEFAULT_LINETYPE);
         }
         if (strcmp (region->layer, "") == 0)
         {
-                region->layer = strdup (DXF_DEFAULT_LAYER);
+                region->layer = dxf_strdup (DXF_DEFAULT_LAYER);
         }
-        /* Clean up. */
-        free (temp_string);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -370,7 +364,7 @@ dxf_region_write
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        char *dxf_entity_name = strdup ("REGION");
+        char *dxf_entity_name = dxf_strdup ("REGION");
         DxfChar *iter1 = NULL;
         DxfChar *iter2 = NULL;
 
@@ -381,7 +375,7 @@ dxf_region_write
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (region == NULL)
@@ -390,40 +384,40 @@ dxf_region_write
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (fp->acad_version_number < AutoCAD_13)
         {
                 fprintf (stderr,
-                  (_("Warning in %s () illegal DXF version for this %s entity with id-code: %x.\n")),
+                  (_("Warning in %s () illegal DXF version for this %s entity with id-code: %" PRIx64 ".\n")),
                   __FUNCTION__, dxf_entity_name, region->id_code);
         }
         if (strcmp (region->linetype, "") == 0)
         {
                 fprintf (stderr,
-                  (_("Warning in %s () empty linetype string for the %s entity with id-code: %x\n")),
+                  (_("Warning in %s () empty linetype string for the %s entity with id-code: %" PRIx64 "\n")),
                   __FUNCTION__, dxf_entity_name, region->id_code);
                 fprintf (stderr,
                   (_("\t%s entity is reset to default linetype")),
                   dxf_entity_name);
-                region->linetype = strdup (DXF_DEFAULT_LINETYPE);
+                region->linetype = dxf_strdup (DXF_DEFAULT_LINETYPE);
         }
         if (strcmp (region->layer, "") == 0)
         {
                 fprintf (stderr,
-                  (_("Warning in %s () empty layer string for the %s entity with id-code: %x\n")),
+                  (_("Warning in %s () empty layer string for the %s entity with id-code: %" PRIx64 "\n")),
                   __FUNCTION__, dxf_entity_name, region->id_code);
                 fprintf (stderr,
                   (_("\t%s entity is relocated to layer 0")),
                   dxf_entity_name);
-                region->layer = strdup (DXF_DEFAULT_LAYER);
+                region->layer = dxf_strdup (DXF_DEFAULT_LAYER);
         }
         /* Start writing output. */
-        fprintf (fp->fp, "  0\n%s\n", dxf_entity_name);
-        if (region->id_code != -1)
+        dxf_write_string (fp, 0, dxf_entity_name);
+        if (region->id_code != DXF_HANDLE_NONE)
         {
-                fprintf (fp->fp, "  5\n%x\n", region->id_code);
+                dxf_write_hex (fp, 5, region->id_code);
         }
         /*!
          * \todo for version R14.\n
@@ -435,91 +429,91 @@ dxf_region_write
          * 102 groups are application defined (optional).\n\n
          * End of group, "}" (optional), with Group code 102.
          */
-        if ((strcmp (region->dictionary_owner_soft, "") != 0)
+        if ((region->dictionary_owner_soft != 0)
           && (fp->acad_version_number >= AutoCAD_14))
         {
-                fprintf (fp->fp, "102\n{ACAD_REACTORS\n");
-                fprintf (fp->fp, "330\n%s\n", region->dictionary_owner_soft);
-                fprintf (fp->fp, "102\n}\n");
+                dxf_write_string (fp, 102, "{ACAD_REACTORS");
+                dxf_write_hex (fp, 330, region->dictionary_owner_soft);
+                dxf_write_string (fp, 102, "}");
         }
-        if ((strcmp (region->dictionary_owner_hard, "") != 0)
+        if ((region->dictionary_owner_hard != 0)
           && (fp->acad_version_number >= AutoCAD_14))
         {
-                fprintf (fp->fp, "102\n{ACAD_XDICTIONARY\n");
-                fprintf (fp->fp, "360\n%s\n", region->dictionary_owner_hard);
-                fprintf (fp->fp, "102\n}\n");
+                dxf_write_string (fp, 102, "{ACAD_XDICTIONARY");
+                dxf_write_hex (fp, 360, region->dictionary_owner_hard);
+                dxf_write_string (fp, 102, "}");
         }
         if (fp->acad_version_number >= AutoCAD_13)
         {
-                fprintf (fp->fp, "100\nAcDbEntity\n");
+                dxf_write_string (fp, 100, "AcDbEntity");
         }
         if (region->paperspace == DXF_PAPERSPACE)
         {
-                fprintf (fp->fp, " 67\n%d\n", (int16_t) DXF_PAPERSPACE);
+                dxf_write_int (fp, 67, (int16_t) DXF_PAPERSPACE);
         }
-        fprintf (fp->fp, "  8\n%s\n", region->layer);
+        dxf_write_string (fp, 8, region->layer);
         if (strcmp (region->linetype, DXF_DEFAULT_LINETYPE) != 0)
         {
-                fprintf (fp->fp, "  6\n%s\n", region->linetype);
+                dxf_write_string (fp, 6, region->linetype);
         }
         if ((fp->acad_version_number <= AutoCAD_11)
           && DXF_FLATLAND
           && (region->elevation != 0.0))
         {
-                fprintf (fp->fp, " 38\n%f\n", region->elevation);
+                dxf_write_double (fp, 38, region->elevation);
         }
         if (region->color != DXF_COLOR_BYLAYER)
         {
-                fprintf (fp->fp, " 62\n%d\n", region->color);
+                dxf_write_int (fp, 62, region->color);
         }
         if (region->linetype_scale != 1.0)
         {
-                fprintf (fp->fp, " 48\n%f\n", region->linetype_scale);
+                dxf_write_double (fp, 48, region->linetype_scale);
         }
         if (region->visibility != 0)
         {
-                fprintf (fp->fp, " 60\n%d\n", region->visibility);
+                dxf_write_int (fp, 60, region->visibility);
         }
         if (fp->acad_version_number >= AutoCAD_13)
         {
-                fprintf (fp->fp, "100\nAcDbModelerGeometry\n");
+                dxf_write_string (fp, 100, "AcDbModelerGeometry");
         }
         if (region->thickness != 0.0)
         {
-                fprintf (fp->fp, " 39\n%f\n", region->thickness);
+                dxf_write_double (fp, 39, region->thickness);
         }
         if (fp->acad_version_number >= AutoCAD_13)
         {
-                fprintf (fp->fp, " 70\n%d\n", region->modeler_format_version_number);
+                dxf_write_int (fp, 70, region->modeler_format_version_number);
         }
         if (region->proprietary_data != NULL)
         {
                 iter1 = (DxfChar*) region->proprietary_data;
                 while ((iter1 != NULL) && (iter1->value != NULL))
                 {
-                        fprintf (fp->fp, "  1\n%s\n", iter1->value);
+                        dxf_write_string (fp, 1, iter1->value);
                         iter1 = (DxfChar*) iter1->next;
                 }
         }
         else
         {
-                fprintf (fp->fp, "  1\n\n");
+                dxf_write_string (fp, 1, "");
         }
         if (region->additional_proprietary_data != NULL)
         {
                 iter2 = (DxfChar*) region->additional_proprietary_data;
                 while ((iter2 != NULL) && (iter2->value != NULL))
                 {
-                        fprintf (fp->fp, "  3\n%s\n", iter2->value);
+                        dxf_write_string (fp, 3, iter2->value);
                         iter2 = (DxfChar*) iter2->next;
                 }
         }
         else
         {
-                fprintf (fp->fp, "  3\n\n");
+                dxf_write_string (fp, 3, "");
         }
         /* Clean up. */
-        free (dxf_entity_name);
+        dxf_free (dxf_entity_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -560,17 +554,13 @@ dxf_region_free
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        free (region->linetype);
-        free (region->layer);
+        dxf_string_free (region->linetype);
+        dxf_string_free (region->layer);
         dxf_binary_graphics_data_free_list (region->binary_graphics_data);
-        free (region->dictionary_owner_soft);
-        free (region->material);
-        free (region->dictionary_owner_hard);
-        free (region->plot_style_name);
-        free (region->color_name);
+        dxf_string_free (region->color_name);
         dxf_char_free_list (region->proprietary_data);
         dxf_char_free_list (region->additional_proprietary_data);
-        free (region);
+        dxf_free (region);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -616,7 +606,7 @@ dxf_region_free_list
  *
  * \return \c id_code.
  */
-int
+uint64_t
 dxf_region_get_id_code
 (
         DxfRegion *region
@@ -634,12 +624,6 @@ dxf_region_get_id_code
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (region->id_code < 0)
-        {
-                fprintf (stderr,
-                  (_("Warning in %s () a negative value was found.\n")),
-                  __FUNCTION__);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -655,7 +639,7 @@ dxf_region_set_id_code
 (
         DxfRegion *region,
                 /*!< a pointer to a DXF \c REGION entity. */
-        int id_code
+        uint64_t id_code
                 /*!< the \c id_code to be set for the entity.\n
                  * This is to be an unique (sequential) number in the
                  * DXF file. */
@@ -672,12 +656,6 @@ dxf_region_set_id_code
                   __FUNCTION__);
                 return (NULL);
         }
-        if (id_code < 0)
-        {
-                fprintf (stderr,
-                  (_("Warning in %s () a negative value was passed.\n")),
-                  __FUNCTION__);
-        }
         region->id_code = id_code;
 #if DEBUG
         DXF_DEBUG_END
@@ -719,7 +697,7 @@ dxf_region_get_linetype
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (region->linetype));
+        return (dxf_strdup (region->linetype));
 }
 
 
@@ -754,7 +732,7 @@ dxf_region_set_linetype
                   __FUNCTION__);
                 return (NULL);
         }
-        region->linetype = strdup (linetype);
+        region->linetype = dxf_strdup (linetype);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -795,7 +773,7 @@ dxf_region_get_layer
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (region->layer));
+        return (dxf_strdup (region->layer));
 }
 
 
@@ -830,7 +808,7 @@ dxf_region_set_layer
                   __FUNCTION__);
                 return (NULL);
         }
-        region->layer = strdup (layer);
+        region->layer = dxf_strdup (layer);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1568,11 +1546,9 @@ dxf_region_set_binary_graphics_data
  * \brief Get the pointer to the \c dictionary_owner_soft from a DXF 
  * \c REGION entity.
  *
- * \return pointer to the \c dictionary_owner_soft.
- *
- * \warning No checks are performed on the returned pointer (string).
+ * \return the handle of the \c dictionary_owner_soft.
  */
-char *
+uint64_t
 dxf_region_get_dictionary_owner_soft
 (
         DxfRegion *region
@@ -1588,19 +1564,12 @@ dxf_region_get_dictionary_owner_soft
                 fprintf (stderr,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
-                return (NULL);
-        }
-        if (region->dictionary_owner_soft ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
+                return (0);
         }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (region->dictionary_owner_soft));
+        return (region->dictionary_owner_soft);
 }
 
 
@@ -1613,8 +1582,8 @@ dxf_region_set_dictionary_owner_soft
 (
         DxfRegion *region,
                 /*!< a pointer to a DXF \c REGION entity. */
-        char *dictionary_owner_soft
-                /*!< a string containing the pointer to the \c
+        uint64_t dictionary_owner_soft
+                /*!< the handle of the \c
                  * dictionary_owner_soft for the entity. */
 )
 {
@@ -1629,14 +1598,7 @@ dxf_region_set_dictionary_owner_soft
                   __FUNCTION__);
                 return (NULL);
         }
-        if (dictionary_owner_soft == NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was passed.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
-        region->dictionary_owner_soft = strdup (dictionary_owner_soft);
+        region->dictionary_owner_soft = dictionary_owner_soft;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1647,12 +1609,10 @@ dxf_region_set_dictionary_owner_soft
 /*!
  * \brief Get the pointer to the \c material from a DXF \c REGION entity.
  *
- * \return a pointer to \c material when successful, or \c NULL when an
+ * \return the handle \c material when successful, or 0 when an
  * error occurred.
- *
- * \warning No checks are performed on the returned pointer.
  */
-char *
+uint64_t
 dxf_region_get_material
 (
         DxfRegion *region
@@ -1668,19 +1628,12 @@ dxf_region_get_material
                 fprintf (stderr,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
-                return (NULL);
-        }
-        if (region->material ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
+                return (0);
         }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (region->material));
+        return (region->material);
 }
 
 
@@ -1695,8 +1648,8 @@ dxf_region_set_material
 (
         DxfRegion *region,
                 /*!< a pointer to a DXF \c REGION entity. */
-        char *material
-                /*!< a string containing the pointer to the \c
+        uint64_t material
+                /*!< the handle of the \c
                  * material for the entity. */
 )
 {
@@ -1711,14 +1664,7 @@ dxf_region_set_material
                   __FUNCTION__);
                 return (NULL);
         }
-        if (material == NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was passed.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
-        region->material = strdup (material);
+        region->material = material;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1730,11 +1676,9 @@ dxf_region_set_material
  * \brief Get the pointer to the \c dictionary_owner_hard from a DXF 
  * \c REGION entity.
  *
- * \return pointer to the \c dictionary_owner_hard.
- *
- * \warning No checks are performed on the returned pointer (string).
+ * \return the handle of the \c dictionary_owner_hard.
  */
-char *
+uint64_t
 dxf_region_get_dictionary_owner_hard
 (
         DxfRegion *region
@@ -1750,19 +1694,12 @@ dxf_region_get_dictionary_owner_hard
                 fprintf (stderr,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
-                return (NULL);
-        }
-        if (region->dictionary_owner_hard ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
+                return (0);
         }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (region->dictionary_owner_hard));
+        return (region->dictionary_owner_hard);
 }
 
 
@@ -1775,8 +1712,8 @@ dxf_region_set_dictionary_owner_hard
 (
         DxfRegion *region,
                 /*!< a pointer to a DXF \c REGION entity. */
-        char *dictionary_owner_hard
-                /*!< a string containing the pointer to the \c
+        uint64_t dictionary_owner_hard
+                /*!< the handle of the \c
                  * dictionary_owner_hard for the entity. */
 )
 {
@@ -1791,14 +1728,7 @@ dxf_region_set_dictionary_owner_hard
                   __FUNCTION__);
                 return (NULL);
         }
-        if (dictionary_owner_hard == NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was passed.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
-        region->dictionary_owner_hard = strdup (dictionary_owner_hard);
+        region->dictionary_owner_hard = dictionary_owner_hard;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1874,10 +1804,10 @@ dxf_region_set_lineweight
 /*!
  * \brief Get the \c plot_style_name from a DXF \c REGION entity.
  *
- * \return a pointer to \c plot_style_name when sucessful, or \c NULL
+ * \return the handle \c plot_style_name when sucessful, or 0
  * when an error occurred.
  */
-char *
+uint64_t
 dxf_region_get_plot_style_name
 (
         DxfRegion *region
@@ -1893,19 +1823,12 @@ dxf_region_get_plot_style_name
                 fprintf (stderr,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
-                return (NULL);
-        }
-        if (region->plot_style_name ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
+                return (0);
         }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (region->plot_style_name));
+        return (region->plot_style_name);
 }
 
 
@@ -1920,7 +1843,7 @@ dxf_region_set_plot_style_name
 (
         DxfRegion *region,
                 /*!< a pointer to a DXF \c REGION entity. */
-        char *plot_style_name
+        uint64_t plot_style_name
                 /*!< a string containing the \c plot_style_name for the
                  * entity. */
 )
@@ -1936,14 +1859,7 @@ dxf_region_set_plot_style_name
                   __FUNCTION__);
                 return (NULL);
         }
-        if (plot_style_name == NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was passed.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
-        region->plot_style_name = strdup (plot_style_name);
+        region->plot_style_name = plot_style_name;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2050,7 +1966,7 @@ dxf_region_get_color_name
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (region->color_name));
+        return (dxf_strdup (region->color_name));
 }
 
 
@@ -2088,7 +2004,7 @@ dxf_region_set_color_name
                   __FUNCTION__);
                 return (NULL);
         }
-        region->color_name = strdup (color_name);
+        region->color_name = dxf_strdup (color_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
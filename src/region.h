@@ -63,7 +63,7 @@ typedef struct
 dxf_region_struct
 {
         /* Members common for all DXF drawable entities. */
-        int id_code;
+        uint64_t id_code;
                 /*!< Identification number for the entity.\n
                  * This is to be an unique (sequential) number in the DXF
                  * file.\n
@@ -136,16 +136,16 @@ dxf_region_struct
                  * (optional).\n
                  * Group code = 310.\n
                  * \since Introduced in version R2000. */
-        char *dictionary_owner_soft;
+        uint64_t dictionary_owner_soft;
                 /*!< Soft-pointer ID/handle to owner dictionary (optional).\n
                  * Group code = 330.\n
                  * \since Introduced in version R14. */
-        char *material;
+        uint64_t material;
                 /*!< Hard-pointer ID/handle to material object (present if
                  * not BYLAYER).\n
                  * Group code = 347.\n
                  * \since Introduced in version R2008. */
-        char *dictionary_owner_hard;
+        uint64_t dictionary_owner_hard;
                 /*!< Hard owner ID/handle to owner dictionary (optional).\n
                  * Group code = 360.\n
                  * \since Introduced in version R14. */
@@ -154,7 +154,7 @@ dxf_region_struct
                  * Stored and moved around as a 16-bit integer.\n
                  * Group code = 370.\n
                  * \since Introduced in version R2002. */
-        char *plot_style_name;
+        uint64_t plot_style_name;
                 /*!< Hard pointer ID / handle of PlotStyleName object.\n
                  * Group code = 390.\n
                  * \since Introduced in version R2009. */
@@ -211,8 +211,8 @@ DxfRegion *dxf_region_read (DxfFile *fp, DxfRegion *region);
 int dxf_region_write (DxfFile *fp, DxfRegion *region);
 int dxf_region_free (DxfRegion *region);
 void dxf_region_free_list (DxfRegion *regions);
-int dxf_region_get_id_code (DxfRegion *region);
-DxfRegion *dxf_region_set_id_code (DxfRegion *region, int id_code);
+uint64_t dxf_region_get_id_code (DxfRegion *region);
+DxfRegion *dxf_region_set_id_code (DxfRegion *region, uint64_t id_code);
 char *dxf_region_get_linetype (DxfRegion *region);
 DxfRegion *dxf_region_set_linetype (DxfRegion *region, char *linetype);
 char *dxf_region_get_layer (DxfRegion *region);
@@ -235,16 +235,16 @@ int16_t dxf_region_get_shadow_mode (DxfRegion *region);
 DxfRegion *dxf_region_set_shadow_mode (DxfRegion *region, int16_t shadow_mode);
 DxfBinaryGraphicsData *dxf_region_get_binary_graphics_data (DxfRegion *region);
 DxfRegion *dxf_region_set_binary_graphics_data (DxfRegion *region, DxfBinaryGraphicsData *data);
-char *dxf_region_get_dictionary_owner_soft (DxfRegion *region);
-DxfRegion *dxf_region_set_dictionary_owner_soft (DxfRegion *region, char *dictionary_owner_soft);
-char *dxf_region_get_material (DxfRegion *region);
-DxfRegion *dxf_region_set_material (DxfRegion *region, char *material);
-char *dxf_region_get_dictionary_owner_hard (DxfRegion *region);
-DxfRegion *dxf_region_set_dictionary_owner_hard (DxfRegion *region, char *dictionary_owner_hard);
+uint64_t dxf_region_get_dictionary_owner_soft (DxfRegion *region);
+DxfRegion *dxf_region_set_dictionary_owner_soft (DxfRegion *region, uint64_t dictionary_owner_soft);
+uint64_t dxf_region_get_material (DxfRegion *region);
+DxfRegion *dxf_region_set_material (DxfRegion *region, uint64_t material);
+uint64_t dxf_region_get_dictionary_owner_hard (DxfRegion *region);
+DxfRegion *dxf_region_set_dictionary_owner_hard (DxfRegion *region, uint64_t dictionary_owner_hard);
 int16_t dxf_region_get_lineweight (DxfRegion *region);
 DxfRegion *dxf_region_set_lineweight (DxfRegion *region, int16_t lineweight);
-char *dxf_region_get_plot_style_name (DxfRegion *region);
-DxfRegion *dxf_region_set_plot_style_name (DxfRegion *region, char *plot_style_name);
+uint64_t dxf_region_get_plot_style_name (DxfRegion *region);
+DxfRegion *dxf_region_set_plot_style_name (DxfRegion *region, uint64_t plot_style_name);
 long dxf_region_get_color_value (DxfRegion *region);
 DxfRegion *dxf_region_set_color_value (DxfRegion *region, long color_value);
 char *dxf_region_get_color_name (DxfRegion *region);
@@ -41,6 +41,7 @@
 
 
 #include "rtext.h"
+#include "util.h"
 
 
 /*!
@@ -60,7 +61,7 @@ dxf_rtext_new ()
         size = sizeof (DxfRText);
         /* avoid malloc of 0 bytes */
         if (size == 0) size = 1;
-        if ((rtext = malloc (size)) == NULL)
+        if ((rtext = dxf_malloc (size)) == NULL)
         {
                 fprintf (stderr,
                   (_("Error in %s () could not allocate memory for a DxfRText struct.\n")),
@@ -109,9 +110,9 @@ dxf_rtext_init
                 __FUNCTION__);
               return (NULL);
         }
-        rtext->id_code = 0;
-        rtext->linetype = strdup (DXF_DEFAULT_LINETYPE);
-        rtext->layer = strdup (DXF_DEFAULT_LAYER);
+        rtext->id_code = DXF_HANDLE_NONE;
+        rtext->linetype = dxf_strdup (DXF_DEFAULT_LINETYPE);
+        rtext->layer = dxf_strdup (DXF_DEFAULT_LAYER);
         rtext->elevation = 0.0;
         rtext->thickness = 0.0;
         rtext->linetype_scale = DXF_DEFAULT_LINETYPE_SCALE;
@@ -122,16 +123,16 @@ dxf_rtext_init
         rtext->shadow_mode = 0;
         rtext->binary_graphics_data = (DxfBinaryGraphicsData *) dxf_binary_graphics_data_new ();
         rtext->binary_graphics_data = (DxfBinaryGraphicsData *) dxf_binary_graphics_data_init ((DxfBinaryGraphicsData *) rtext->binary_graphics_data);
-        rtext->dictionary_owner_soft = strdup ("");
-        rtext->material = strdup ("");
-        rtext->dictionary_owner_hard = strdup ("");
+        rtext->dictionary_owner_soft = 0;
+        rtext->material = 0;
+        rtext->dictionary_owner_hard = 0;
         rtext->lineweight = 0;
-        rtext->plot_style_name = strdup ("");
+        rtext->plot_style_name = 0;
         rtext->color_value = 0;
-        rtext->color_name = strdup ("");
+        rtext->color_name = dxf_strdup ("");
         rtext->transparency = 0;
-        rtext->text_value = strdup ("");
-        rtext->text_style = strdup ("");
+        rtext->text_value = dxf_strdup ("");
+        rtext->text_style = dxf_strdup ("");
         rtext->p0 = (DxfPoint *) dxf_point_new ();
         rtext->p0 = dxf_point_init ((DxfPoint *) rtext->p0);
         rtext->p0->x0 = 0.0;
@@ -175,8 +176,9 @@ dxf_rtext_read
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        char *dxf_entity_name = strdup ("RTEXT");
-        char *temp_string = NULL;
+        char *dxf_entity_name = dxf_strdup ("RTEXT");
+        char temp_string[DXF_MAX_STRING_LENGTH];
+        int group_code;
 
         /* Do some basic checks. */
         if (fp == NULL)
@@ -184,8 +186,6 @@ dxf_rtext_read
                 fprintf (stderr,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
-                /* Clean up. */
-                free (temp_string);
                 return (NULL);
         }
         if (rtext == NULL)
@@ -195,293 +195,242 @@ dxf_rtext_read
                   __FUNCTION__);
                 rtext = dxf_rtext_init (rtext);
         }
-        (fp->line_number)++;
-        fscanf (fp->fp, "%[^\n]", temp_string);
-        while (strcmp (temp_string, "0") != 0)
+        while ((dxf_read_group_code (fp, &group_code) == EXIT_SUCCESS)
+          && (group_code != 0))
         {
-                if (ferror (fp->fp))
+                if (dxf_read_error (fp))
                 {
                         fprintf (stderr,
                           (_("Error in %s () while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
-                        fclose (fp->fp);
-                        /* Clean up. */
-                        free (temp_string);
                         return (NULL);
                 }
-                if (strcmp (temp_string, "1") == 0)
-                {
-                        /* Now follows a string containing a text value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, rtext->text_value);
-                }
-                else if (strcmp (temp_string, "5") == 0)
-                {
-                        /* Now follows a string containing a sequential
-                         * id number. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%x\n", (uint *) &rtext->id_code);
-                }
-                else if (strcmp (temp_string, "6") == 0)
-                {
-                        /* Now follows a string containing a linetype
-                         * name. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, rtext->linetype);
-                }
-                else if (strcmp (temp_string, "7") == 0)
-                {
-                        /* Now follows a string containing a text style
-                         * name. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, rtext->text_style);
-                }
-                else if (strcmp (temp_string, "8") == 0)
-                {
-                        /* Now follows a string containing a layer name. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, rtext->layer);
-                }
-                else if (strcmp (temp_string, "10") == 0)
-                {
-                        /* Now follows a string containing the
-                         * X-coordinate of the insertion point. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &rtext->p0->x0);
-                }
-                else if (strcmp (temp_string, "20") == 0)
-                {
-                        /* Now follows a string containing the
-                         * Y-coordinate of the insertion point. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &rtext->p0->y0);
-                }
-                else if (strcmp (temp_string, "30") == 0)
-                {
-                        /* Now follows a string containing the
-                         * Z-coordinate of the insertion point. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &rtext->p0->z0);
-                }
-                else if ((fp->acad_version_number <= AutoCAD_11)
-                        && (strcmp (temp_string, "38") == 0)
-                        && (rtext->elevation != 0.0))
-                {
-                        /* Now follows a string containing the
-                         * elevation. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &rtext->elevation);
-                }
-                else if (strcmp (temp_string, "39") == 0)
-                {
-                        /* Now follows a string containing the
-                         * thickness. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &rtext->thickness);
-                }
-                else if (strcmp (temp_string, "40") == 0)
-                {
-                        /* Now follows a string containing the
-                         * height. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &rtext->height);
-                }
-                else if (strcmp (temp_string, "48") == 0)
-                {
-                        /* Now follows a string containing the linetype
-                         * scale. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &rtext->linetype_scale);
-                }
-                else if (strcmp (temp_string, "50") == 0)
-                {
-                        /* Now follows a string containing the
-                         * rotation angle. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &rtext->rot_angle);
-                }
-                else if (strcmp (temp_string, "60") == 0)
-                {
-                        /* Now follows a string containing the
-                         * visibility value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%hd\n", &rtext->visibility);
-                }
-                else if (strcmp (temp_string, "62") == 0)
-                {
-                        /* Now follows a string containing the
-                         * color value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%d\n", &rtext->color);
-                }
-                else if (strcmp (temp_string, "67") == 0)
-                {
-                        /* Now follows a string containing the
-                         * paperspace value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%d\n", &rtext->paperspace);
-                }
-                else if (strcmp (temp_string, "70") == 0)
-                {
-                        /* Now follows a string containing the
-                         * text flags value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%d\n", &rtext->type_flags);
-                }
-                else if (strcmp (temp_string, "92") == 0)
-                {
-                        /* Now follows a string containing the
-                         * graphics data size value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%d\n", &rtext->graphics_data_size);
-                }
-                else if ((fp->acad_version_number >= AutoCAD_13)
-                        && (strcmp (temp_string, "100") == 0))
+                switch (group_code)
                 {
-                        /* Now follows a string containing the
-                         * subclass marker value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
-                        if ((strcmp (temp_string, "AcDbEntity") != 0)
-                        && ((strcmp (temp_string, "AcDbRText") != 0)))
-                        {
+                        case 1:
+                                /* Now follows a string containing a text value. */
+                                dxf_read_string (fp, &rtext->text_value);
+                                break;
+                        case 5:
+                                /* Now follows a string containing a sequential
+                                 * id number. */
+                                dxf_read_handle (fp, &rtext->id_code);
+                                break;
+                        case 6:
+                                /* Now follows a string containing a linetype
+                                 * name. */
+                                dxf_read_string_interned (fp, &rtext->linetype);
+                                break;
+                        case 7:
+                                /* Now follows a string containing a text style
+                                 * name. */
+                                dxf_read_string_interned (fp, &rtext->text_style);
+                                break;
+                        case 8:
+                                /* Now follows a string containing a layer name. */
+                                dxf_read_string_interned (fp, &rtext->layer);
+                                break;
+                        case 10:
+                                /* Now follows a string containing the
+                                 * X-coordinate of the insertion point. */
+                                dxf_read_double (fp, &rtext->p0->x0);
+                                break;
+                        case 20:
+                                /* Now follows a string containing the
+                                 * Y-coordinate of the insertion point. */
+                                dxf_read_double (fp, &rtext->p0->y0);
+                                break;
+                        case 30:
+                                /* Now follows a string containing the
+                                 * Z-coordinate of the insertion point. */
+                                dxf_read_double (fp, &rtext->p0->z0);
+                                break;
+                        case 38:
+                                if ((fp->acad_version_number <= AutoCAD_11) && (rtext->elevation != 0.0))
+                                {
+                                        /* Now follows a string containing the
+                                         * elevation. */
+                                        dxf_read_double (fp, &rtext->elevation);
+                                }
+                                else
+                                {
+                                        fprintf (stderr,
+                                          (_("Warning: in %s () unknown string tag found while reading from: %s in line: %d.\n")),
+                                          __FUNCTION__, fp->filename, fp->line_number);
+                                        /* Skip the value of the unknown group code. */
+                                        dxf_read_line (temp_string, fp);
+                                }
+                                break;
+                        case 39:
+                                /* Now follows a string containing the
+                                 * thickness. */
+                                dxf_read_double (fp, &rtext->thickness);
+                                break;
+                        case 40:
+                                /* Now follows a string containing the
+                                 * height. */
+                                dxf_read_double (fp, &rtext->height);
+                                break;
+                        case 48:
+                                /* Now follows a string containing the linetype
+                                 * scale. */
+                                dxf_read_double (fp, &rtext->linetype_scale);
+                                break;
+                        case 50:
+                                /* Now follows a string containing the
+                                 * rotation angle. */
+                                dxf_read_double (fp, &rtext->rot_angle);
+                                break;
+                        case 60:
+                                /* Now follows a string containing the
+                                 * visibility value. */
+                                dxf_read_int16 (fp, &rtext->visibility);
+                                break;
+                        case 62:
+                                /* Now follows a string containing the
+                                 * color value. */
+                                dxf_read_int (fp, &rtext->color);
+                                break;
+                        case 67:
+                                /* Now follows a string containing the
+                                 * paperspace value. */
+                                dxf_read_int (fp, &rtext->paperspace);
+                                break;
+                        case 70:
+                                /* Now follows a string containing the
+                                 * text flags value. */
+                                dxf_read_int (fp, &rtext->type_flags);
+                                break;
+                        case 92:
+                                /* Now follows a string containing the
+                                 * graphics data size value. */
+                                dxf_read_int (fp, &rtext->graphics_data_size);
+                                break;
+                        case 100:
+                                if (fp->acad_version_number >= AutoCAD_13)
+                                {
+                                        /* Now follows a string containing the
+                                         * subclass marker value. */
+                                        dxf_read_line (temp_string, fp);
+                                        if ((strcmp (temp_string, "AcDbEntity") != 0)
+                                        && ((strcmp (temp_string, "AcDbRText") != 0)))
+                                        {
+                                                fprintf (stderr,
+                                                  (_("Warning in %s () found a bad subclass marker in: %s in line: %d.\n")),
+                                                  __FUNCTION__, fp->filename, fp->line_number);
+                                        }
+                                }
+                                else
+                                {
+                                        fprintf (stderr,
+                                          (_("Warning: in %s () unknown string tag found while reading from: %s in line: %d.\n")),
+                                          __FUNCTION__, fp->filename, fp->line_number);
+                                        /* Skip the value of the unknown group code. */
+                                        dxf_read_line (temp_string, fp);
+                                }
+                                break;
+                        case 160:
+                                /* Now follows a string containing the
+                                 * graphics data size value. */
+                                dxf_read_int (fp, &rtext->graphics_data_size);
+                                break;
+                        case 210:
+                                /* Now follows a string containing the
+                                 * X-value of the extrusion vector. */
+                                dxf_read_double (fp, &rtext->extr_x0);
+                                break;
+                        case 220:
+                                /* Now follows a string containing the
+                                 * Y-value of the extrusion vector. */
+                                dxf_read_double (fp, &rtext->extr_y0);
+                                break;
+                        case 230:
+                                /* Now follows a string containing the
+                                 * Z-value of the extrusion vector. */
+                                dxf_read_double (fp, &rtext->extr_z0);
+                                break;
+                        case 284:
+                                /* Now follows a string containing the shadow
+                                 * mode value. */
+                                dxf_read_int16 (fp, &rtext->shadow_mode);
+                                break;
+                        case 310:
+                                /* Now follows a string containing binary
+                                 * graphics data. */
+                                dxf_read_string (fp, &rtext->binary_graphics_data->data_line);
+                                dxf_binary_graphics_data_init ((DxfBinaryGraphicsData *) rtext->binary_graphics_data->next);
+                                rtext->binary_graphics_data = (DxfBinaryGraphicsData *) rtext->binary_graphics_data->next;
+                                break;
+                        case 330:
+                                /* Now follows a string containing Soft-pointer
+                                 * ID/handle to owner dictionary. */
+                                dxf_read_handle (fp, &rtext->dictionary_owner_soft);
+                                break;
+                        case 347:
+                                /* Now follows a string containing a
+                                 * hard-pointer ID/handle to material object. */
+                                dxf_read_handle (fp, &rtext->material);
+                                break;
+                        case 360:
+                                /* Now follows a string containing Hard owner
+                                 * ID/handle to owner dictionary. */
+                                dxf_read_handle (fp, &rtext->dictionary_owner_hard);
+                                break;
+                        case 370:
+                                /* Now follows a string containing the lineweight
+                                 * value. */
+                                dxf_read_int16 (fp, &rtext->lineweight);
+                                break;
+                        case 390:
+                                /* Now follows a string containing a plot style
+                                 * name value. */
+                                dxf_read_handle (fp, &rtext->plot_style_name);
+                                break;
+                        case 420:
+                                /* Now follows a string containing a color value. */
+                                dxf_read_long (fp, &rtext->color_value);
+                                break;
+                        case 430:
+                                /* Now follows a string containing a color
+                                 * name value. */
+                                dxf_read_string_interned (fp, &rtext->color_name);
+                                break;
+                        case 440:
+                                /* Now follows a string containing a transparency
+                                 * value. */
+                                dxf_read_long (fp, &rtext->transparency);
+                                break;
+                        case 999:
+                                /* Now follows a string containing a comment. */
+                                dxf_read_line (temp_string, fp);
+                                fprintf (stdout, "DXF comment: %s\n", temp_string);
+                                break;
+                        default:
                                 fprintf (stderr,
-                                  (_("Warning in %s () found a bad subclass marker in: %s in line: %d.\n")),
+                                  (_("Warning: in %s () unknown string tag found while reading from: %s in line: %d.\n")),
                                   __FUNCTION__, fp->filename, fp->line_number);
-                        }
-                }
-                else if (strcmp (temp_string, "160") == 0)
-                {
-                        /* Now follows a string containing the
-                         * graphics data size value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%d\n", &rtext->graphics_data_size);
-                }
-                else if (strcmp (temp_string, "210") == 0)
-                {
-                        /* Now follows a string containing the
-                         * X-value of the extrusion vector. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &rtext->extr_x0);
-                }
-                else if (strcmp (temp_string, "220") == 0)
-                {
-                        /* Now follows a string containing the
-                         * Y-value of the extrusion vector. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &rtext->extr_y0);
-                }
-                else if (strcmp (temp_string, "230") == 0)
-                {
-                        /* Now follows a string containing the
-                         * Z-value of the extrusion vector. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &rtext->extr_z0);
-                }
-                else if (strcmp (temp_string, "284") == 0)
-                {
-                        /* Now follows a string containing the shadow
-                         * mode value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%hd\n", &rtext->shadow_mode);
-                }
-                else if (strcmp (temp_string, "310") == 0)
-                {
-                        /* Now follows a string containing binary
-                         * graphics data. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, rtext->binary_graphics_data->data_line);
-                        dxf_binary_graphics_data_init ((DxfBinaryGraphicsData *) rtext->binary_graphics_data->next);
-                        rtext->binary_graphics_data = (DxfBinaryGraphicsData *) rtext->binary_graphics_data->next;
-                }
-                else if (strcmp (temp_string, "330") == 0)
-                {
-                        /* Now follows a string containing Soft-pointer
-                         * ID/handle to owner dictionary. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, rtext->dictionary_owner_soft);
-                }
-                else if (strcmp (temp_string, "347") == 0)
-                {
-                        /* Now follows a string containing a
-                         * hard-pointer ID/handle to material object. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, rtext->material);
-                }
-                else if (strcmp (temp_string, "360") == 0)
-                {
-                        /* Now follows a string containing Hard owner
-                         * ID/handle to owner dictionary. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, rtext->dictionary_owner_hard);
-                }
-                else if (strcmp (temp_string, "370") == 0)
-                {
-                        /* Now follows a string containing the lineweight
-                         * value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%hd\n", &rtext->lineweight);
-                }
-                else if (strcmp (temp_string, "390") == 0)
-                {
-                        /* Now follows a string containing a plot style
-                         * name value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, rtext->plot_style_name);
-                }
-                else if (strcmp (temp_string, "420") == 0)
-                {
-                        /* Now follows a string containing a color value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%ld\n", &rtext->color_value);
-                }
-                else if (strcmp (temp_string, "430") == 0)
-                {
-                        /* Now follows a string containing a color
-                         * name value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, rtext->color_name);
-                }
-                else if (strcmp (temp_string, "440") == 0)
-                {
-                        /* Now follows a string containing a transparency
-                         * value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%ld\n", &rtext->transparency);
-                }
-                else if (strcmp (temp_string, "999") == 0)
-                {
-                        /* Now follows a string containing a comment. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
-                        fprintf (stdout, "DXF comment: %s\n", temp_string);
-                }
-                else
-                {
-                        fprintf (stderr,
-                          (_("Warning: in %s () unknown string tag found while reading from: %s in line: %d.\n")),
-                          __FUNCTION__, fp->filename, fp->line_number);
+                                /* Skip the value of the unknown group code. */
+                                dxf_read_line (temp_string, fp);
+                                break;
                 }
         }
         /* Handle omitted members and/or illegal values. */
         if (strcmp (rtext->text_value, "") == 0)
         {
                 fprintf (stderr,
-                  (_("Error in %s () text value string is empty for the %s entity with id-code: %x\n")),
+                  (_("Error in %s () text value string is empty for the %s entity with id-code: %" PRIx64 "\n")),
                   __FUNCTION__, dxf_entity_name, rtext->id_code);
                 dxf_entity_skip (dxf_entity_name);
                 return (NULL);
         }
         if (strcmp (rtext->linetype, "") == 0)
         {
-                rtext->linetype = strdup (DXF_DEFAULT_LINETYPE);
+                rtext->linetype = dxf_strdup (DXF_DEFAULT_LINETYPE);
         }
         if (strcmp (rtext->layer, "") == 0)
         {
-                rtext->layer = strdup (DXF_DEFAULT_LAYER);
+                rtext->layer = dxf_strdup (DXF_DEFAULT_LAYER);
         }
-        /* Clean up. */
-        free (temp_string);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -504,7 +453,7 @@ dxf_rtext_write
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        char *dxf_entity_name = strdup ("RTEXT");
+        char *dxf_entity_name = dxf_strdup ("RTEXT");
 
         /* Do some basic checks. */
         if (fp == NULL)
@@ -513,7 +462,7 @@ dxf_rtext_write
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (rtext == NULL)
@@ -522,47 +471,47 @@ dxf_rtext_write
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (strcmp (rtext->text_value, "") == 0)
         {
                 fprintf (stderr,
-                  (_("Error in %s () text value string is empty for the %s entity with id-code: %x\n")),
+                  (_("Error in %s () text value string is empty for the %s entity with id-code: %" PRIx64 "\n")),
                   __FUNCTION__, dxf_entity_name, rtext->id_code);
                 dxf_entity_skip (dxf_entity_name);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (strcmp (rtext->text_style, "") == 0)
         {
                 fprintf (stderr,
-                  (_("Warning in %s () text style string is empty for the %s entity with id-code: %x\n")),
+                  (_("Warning in %s () text style string is empty for the %s entity with id-code: %" PRIx64 "\n")),
                   __FUNCTION__, dxf_entity_name, rtext->id_code);
-                rtext->text_style = strdup (DXF_DEFAULT_TEXTSTYLE);
+                rtext->text_style = dxf_strdup (DXF_DEFAULT_TEXTSTYLE);
         }
         if (strcmp (rtext->layer, "") == 0)
         {
                 fprintf (stderr,
-                  (_("Warning in %s () empty layer string for the %s entity with id-code: %x\n")),
+                  (_("Warning in %s () empty layer string for the %s entity with id-code: %" PRIx64 "\n")),
                   __FUNCTION__, dxf_entity_name, rtext->id_code);
                 fprintf (stderr,
                   (_("\t%s entity is relocated to layer 0")),
                   dxf_entity_name);
-                rtext->layer = strdup (DXF_DEFAULT_LAYER);
+                rtext->layer = dxf_strdup (DXF_DEFAULT_LAYER);
         }
         if (rtext->height == 0.0)
         {
                 fprintf (stderr,
-                  (_("Warning in %s () height has a value of 0.0 for the %s entity with id-code: %x\n")),
+                  (_("Warning in %s () height has a value of 0.0 for the %s entity with id-code: %" PRIx64 "\n")),
                   __FUNCTION__, dxf_entity_name, rtext->id_code);
         }
         /* Start writing output. */
-        fprintf (fp->fp, "  0\n%s\n", dxf_entity_name);
-        if (rtext->id_code != -1)
+        dxf_write_string (fp, 0, dxf_entity_name);
+        if (rtext->id_code != DXF_HANDLE_NONE)
         {
-                fprintf (fp->fp, "  5\n%x\n", rtext->id_code);
+                dxf_write_hex (fp, 5, rtext->id_code);
         }
         /*!
          * \todo for version R14.\n
@@ -574,67 +523,67 @@ dxf_rtext_write
          * 102 groups are application defined (optional).\n\n
          * End of group, "}" (optional), with Group code 102.
          */
-        if ((strcmp (rtext->dictionary_owner_soft, "") != 0)
+        if ((rtext->dictionary_owner_soft != 0)
           && (fp->acad_version_number >= AutoCAD_14))
         {
-                fprintf (fp->fp, "102\n{ACAD_REACTORS\n");
-                fprintf (fp->fp, "330\n%s\n", rtext->dictionary_owner_soft);
-                fprintf (fp->fp, "102\n}\n");
+                dxf_write_string (fp, 102, "{ACAD_REACTORS");
+                dxf_write_hex (fp, 330, rtext->dictionary_owner_soft);
+                dxf_write_string (fp, 102, "}");
         }
-        if ((strcmp (rtext->dictionary_owner_hard, "") != 0)
+        if ((rtext->dictionary_owner_hard != 0)
           && (fp->acad_version_number >= AutoCAD_14))
         {
-                fprintf (fp->fp, "102\n{ACAD_XDICTIONARY\n");
-                fprintf (fp->fp, "360\n%s\n", rtext->dictionary_owner_hard);
-                fprintf (fp->fp, "102\n}\n");
+                dxf_write_string (fp, 102, "{ACAD_XDICTIONARY");
+                dxf_write_hex (fp, 360, rtext->dictionary_owner_hard);
+                dxf_write_string (fp, 102, "}");
         }
         if (fp->acad_version_number >= AutoCAD_13)
         {
-                fprintf (fp->fp, "100\nAcDbEntity\n");
+                dxf_write_string (fp, 100, "AcDbEntity");
         }
         if (rtext->paperspace == 1)
         {
-                fprintf (fp->fp, " 67\n%d\n", (int16_t) DXF_PAPERSPACE);
+                dxf_write_int (fp, 67, (int16_t) DXF_PAPERSPACE);
         }
-        fprintf (fp->fp, "  8\n%s\n", rtext->layer);
+        dxf_write_string (fp, 8, rtext->layer);
         if (strcmp (rtext->linetype, DXF_DEFAULT_LINETYPE) != 0)
         {
-                fprintf (fp->fp, "  6\n%s\n", rtext->linetype);
+                dxf_write_string (fp, 6, rtext->linetype);
         }
         if ((fp->acad_version_number >= AutoCAD_2008)
-          && (strcmp (rtext->material, "") != 0))
+          && (rtext->material != 0))
         {
-                fprintf (fp->fp, "347\n%s\n", rtext->material);
+                dxf_write_hex (fp, 347, rtext->material);
         }
         if (rtext->color != DXF_COLOR_BYLAYER)
         {
-                fprintf (fp->fp, " 62\n%d\n", rtext->color);
+                dxf_write_int (fp, 62, rtext->color);
         }
         if (fp->acad_version_number >= AutoCAD_2002)
         {
-                fprintf (fp->fp, "370\n%d\n", rtext->lineweight);
+                dxf_write_int (fp, 370, rtext->lineweight);
         }
         if ((fp->acad_version_number <= AutoCAD_11)
           && DXF_FLATLAND
           && (rtext->elevation != 0.0))
         {
-                fprintf (fp->fp, " 38\n%f\n", rtext->elevation);
+                dxf_write_double (fp, 38, rtext->elevation);
         }
         if (rtext->linetype_scale != 1.0)
         {
-                fprintf (fp->fp, " 48\n%f\n", rtext->linetype_scale);
+                dxf_write_double (fp, 48, rtext->linetype_scale);
         }
         if (rtext->visibility != 0)
         {
-                fprintf (fp->fp, " 60\n%d\n", rtext->visibility);
+                dxf_write_int (fp, 60, rtext->visibility);
         }
         if ((fp->acad_version_number >= AutoCAD_2000)
           && (rtext->graphics_data_size > 0))
         {
 #ifdef BUILD_64
-                fprintf (fp->fp, "160\n%d\n", rtext->graphics_data_size);
+                dxf_write_int (fp, 160, rtext->graphics_data_size);
 #else
-                fprintf (fp->fp, " 92\n%d\n", rtext->graphics_data_size);
+                dxf_write_int (fp, 92, rtext->graphics_data_size);
 #endif
                 if (rtext->binary_graphics_data != NULL)
                 {
@@ -642,62 +591,62 @@ dxf_rtext_write
                         iter = rtext->binary_graphics_data;
                         while (iter != NULL)
                         {
-                                fprintf (fp->fp, "310\n%s\n", dxf_binary_graphics_data_get_data_line (iter));
+                                dxf_write_string (fp, 310, dxf_binary_graphics_data_get_data_line (iter));
                                 iter = (DxfBinaryGraphicsData *) dxf_binary_graphics_data_get_next (iter);
                         }
                 }
         }
         if (fp->acad_version_number >= AutoCAD_2004)
         {
-                fprintf (fp->fp, "420\n%ld\n", rtext->color_value);
-                fprintf (fp->fp, "430\n%s\n", rtext->color_name);
-                fprintf (fp->fp, "440\n%ld\n", rtext->transparency);
+                dxf_write_int (fp, 420, rtext->color_value);
+                dxf_write_string (fp, 430, rtext->color_name);
+                dxf_write_int (fp, 440, rtext->transparency);
         }
         if (fp->acad_version_number >= AutoCAD_2009)
         {
-                fprintf (fp->fp, "390\n%s\n", rtext->plot_style_name);
-                fprintf (fp->fp, "284\n%d\n", rtext->shadow_mode);
+                dxf_write_hex (fp, 390, rtext->plot_style_name);
+                dxf_write_int (fp, 284, rtext->shadow_mode);
         }
         if (fp->acad_version_number >= AutoCAD_13)
         {
-                fprintf (fp->fp, "100\nAcDbRText\n");
+                dxf_write_string (fp, 100, "AcDbRText");
         }
         if (rtext->thickness != 0.0)
         {
-                fprintf (fp->fp, " 39\n%f\n", rtext->thickness);
+                dxf_write_double (fp, 39, rtext->thickness);
         }
-        fprintf (fp->fp, " 10\n%f\n", rtext->p0->x0);
-        fprintf (fp->fp, " 20\n%f\n", rtext->p0->y0);
-        fprintf (fp->fp, " 30\n%f\n", rtext->p0->z0);
-        fprintf (fp->fp, " 40\n%f\n", rtext->height);
-        fprintf (fp->fp, "  1\n%s\n", rtext->text_value);
+        dxf_write_double (fp, 10, rtext->p0->x0);
+        dxf_write_double (fp, 20, rtext->p0->y0);
+        dxf_write_double (fp, 30, rtext->p0->z0);
+        dxf_write_double (fp, 40, rtext->height);
+        dxf_write_string (fp, 1, rtext->text_value);
         if (rtext->rot_angle != 0.0)
         {
-                fprintf (fp->fp, " 50\n%f\n", rtext->rot_angle);
+                dxf_write_double (fp, 50, rtext->rot_angle);
         }
         if (strcmp (rtext->text_style, DXF_DEFAULT_TEXTSTYLE) != 0)
         {
-                fprintf (fp->fp, "  7\n%s\n", rtext->text_style);
+                dxf_write_string (fp, 7, rtext->text_style);
         }
         if (rtext->type_flags != 0)
         {
-                fprintf (fp->fp, " 70\n%d\n", rtext->type_flags);
+                dxf_write_int (fp, 70, rtext->type_flags);
         }
         if ((fp->acad_version_number >= AutoCAD_12)
                 && (rtext->extr_x0 != 0.0)
                 && (rtext->extr_y0 != 0.0)
                 && (rtext->extr_z0 != 1.0))
         {
-                fprintf (fp->fp, "210\n%f\n", rtext->extr_x0);
-                fprintf (fp->fp, "220\n%f\n", rtext->extr_y0);
-                fprintf (fp->fp, "230\n%f\n", rtext->extr_z0);
+                dxf_write_double (fp, 210, rtext->extr_x0);
+                dxf_write_double (fp, 220, rtext->extr_y0);
+                dxf_write_double (fp, 230, rtext->extr_z0);
         }
         if (fp->acad_version_number >= AutoCAD_13)
         {
-                fprintf (fp->fp, "100\nAcDbRText\n");
+                dxf_write_string (fp, 100, "AcDbRText");
         }
         /* Clean up. */
-        free (dxf_entity_name);
+        dxf_free (dxf_entity_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -737,18 +686,14 @@ dxf_rtext_free
                 __FUNCTION__);
               return (EXIT_FAILURE);
         }
-        free (rtext->linetype);
-        free (rtext->layer);
+        dxf_string_free (rtext->linetype);
+        dxf_string_free (rtext->layer);
         dxf_binary_graphics_data_free_list (rtext->binary_graphics_data);
-        free (rtext->dictionary_owner_soft);
-        free (rtext->material);
-        free (rtext->dictionary_owner_hard);
-        free (rtext->plot_style_name);
-        free (rtext->color_name);
-        free (rtext->text_value);
-        free (rtext->text_style);
+        dxf_string_free (rtext->color_name);
+        dxf_free (rtext->text_value);
+        dxf_string_free (rtext->text_style);
         dxf_point_free (rtext->p0);
-        free (rtext);
+        dxf_free (rtext);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -794,7 +739,7 @@ dxf_rtext_free_list
  *
  * \return \c id_code.
  */
-int
+uint64_t
 dxf_rtext_get_id_code
 (
         DxfRText *rtext
@@ -812,12 +757,6 @@ dxf_rtext_get_id_code
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (rtext->id_code < 0)
-        {
-                fprintf (stderr,
-                  (_("Warning in %s () a negative value was found.\n")),
-                  __FUNCTION__);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -833,7 +772,7 @@ dxf_rtext_set_id_code
 (
         DxfRText *rtext,
                 /*!< a pointer to a DXF \c RTEXT entity. */
-        int id_code
+        uint64_t id_code
                 /*!< the \c id_code to be set for the entity.\n
                  * This is to be an unique (sequential) number in the
                  * DXF file. */
@@ -850,12 +789,6 @@ dxf_rtext_set_id_code
                   __FUNCTION__);
                 return (NULL);
         }
-        if (id_code < 0)
-        {
-                fprintf (stderr,
-                  (_("Warning in %s () a negative value was passed.\n")),
-                  __FUNCTION__);
-        }
         rtext->id_code = id_code;
 #if DEBUG
         DXF_DEBUG_END
@@ -897,7 +830,7 @@ dxf_rtext_get_linetype
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (rtext->linetype));
+        return (dxf_strdup (rtext->linetype));
 }
 
 
@@ -932,7 +865,7 @@ dxf_rtext_set_linetype
                   __FUNCTION__);
                 return (NULL);
         }
-        rtext->linetype = strdup (linetype);
+        rtext->linetype = dxf_strdup (linetype);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -973,7 +906,7 @@ dxf_rtext_get_layer
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (rtext->layer));
+        return (dxf_strdup (rtext->layer));
 }
 
 
@@ -1008,7 +941,7 @@ dxf_rtext_set_layer
                   __FUNCTION__);
                 return (NULL);
         }
-        rtext->layer = strdup (layer);
+        rtext->layer = dxf_strdup (layer);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1730,11 +1663,9 @@ dxf_rtext_set_binary_graphics_data
  * \brief Get the pointer to the \c dictionary_owner_soft from a DXF 
  * \c RTEXT entity.
  *
- * \return pointer to the \c dictionary_owner_soft.
- *
- * \warning No checks are performed on the returned pointer (string).
+ * \return the handle of the \c dictionary_owner_soft.
  */
-char *
+uint64_t
 dxf_rtext_get_dictionary_owner_soft
 (
         DxfRText *rtext
@@ -1750,19 +1681,12 @@ dxf_rtext_get_dictionary_owner_soft
                 fprintf (stderr,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
-                return (NULL);
-        }
-        if (rtext->dictionary_owner_soft ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
+                return (0);
         }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (rtext->dictionary_owner_soft));
+        return (rtext->dictionary_owner_soft);
 }
 
 
@@ -1775,8 +1699,8 @@ dxf_rtext_set_dictionary_owner_soft
 (
         DxfRText *rtext,
                 /*!< a pointer to a DXF \c RTEXT entity. */
-        char *dictionary_owner_soft
-                /*!< a string containing the pointer to the \c
+        uint64_t dictionary_owner_soft
+                /*!< the handle of the \c
                  * dictionary_owner_soft for the entity. */
 )
 {
@@ -1791,14 +1715,7 @@ dxf_rtext_set_dictionary_owner_soft
                   __FUNCTION__);
                 return (NULL);
         }
-        if (dictionary_owner_soft == NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was passed.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
-        rtext->dictionary_owner_soft = strdup (dictionary_owner_soft);
+        rtext->dictionary_owner_soft = dictionary_owner_soft;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1809,12 +1726,10 @@ dxf_rtext_set_dictionary_owner_soft
 /*!
  * \brief Get the pointer to the \c material from a DXF \c RTEXT entity.
  *
- * \return a pointer to \c material when successful, or \c NULL when an
+ * \return the handle \c material when successful, or 0 when an
  * error occurred.
- *
- * \warning No checks are performed on the returned pointer.
  */
-char *
+uint64_t
 dxf_rtext_get_material
 (
         DxfRText *rtext
@@ -1830,19 +1745,12 @@ dxf_rtext_get_material
                 fprintf (stderr,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
-                return (NULL);
-        }
-        if (rtext->material ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
+                return (0);
         }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (rtext->material));
+        return (rtext->material);
 }
 
 
@@ -1857,8 +1765,8 @@ dxf_rtext_set_material
 (
         DxfRText *rtext,
                 /*!< a pointer to a DXF \c RTEXT entity. */
-        char *material
-                /*!< a string containing the pointer to the \c
+        uint64_t material
+                /*!< the handle of the \c
                  * material for the entity. */
 )
 {
@@ -1873,14 +1781,7 @@ dxf_rtext_set_material
                   __FUNCTION__);
                 return (NULL);
         }
-        if (material == NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was passed.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
-        rtext->material = strdup (material);
+        rtext->material = material;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1892,11 +1793,9 @@ dxf_rtext_set_material
  * \brief Get the pointer to the \c dictionary_owner_hard from a DXF 
  * \c RTEXT entity.
  *
- * \return pointer to the \c dictionary_owner_hard.
- *
- * \warning No checks are performed on the returned pointer (string).
+ * \return the handle of the \c dictionary_owner_hard.
  */
-char *
+uint64_t
 dxf_rtext_get_dictionary_owner_hard
 (
         DxfRText *rtext
@@ -1912,19 +1811,12 @@ dxf_rtext_get_dictionary_owner_hard
                 fprintf (stderr,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
-                return (NULL);
-        }
-        if (rtext->dictionary_owner_hard ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
+                return (0);
         }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (rtext->dictionary_owner_hard));
+        return (rtext->dictionary_owner_hard);
 }
 
 
@@ -1937,8 +1829,8 @@ dxf_rtext_set_dictionary_owner_hard
 (
         DxfRText *rtext,
                 /*!< a pointer to a DXF \c RTEXT entity. */
-        char *dictionary_owner_hard
-                /*!< a string containing the pointer to the \c
+        uint64_t dictionary_owner_hard
+                /*!< the handle of the \c
                  * dictionary_owner_hard for the entity. */
 )
 {
@@ -1953,14 +1845,7 @@ dxf_rtext_set_dictionary_owner_hard
                   __FUNCTION__);
                 return (NULL);
         }
-        if (dictionary_owner_hard == NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was passed.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
-        rtext->dictionary_owner_hard = strdup (dictionary_owner_hard);
+        rtext->dictionary_owner_hard = dictionary_owner_hard;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2036,10 +1921,10 @@ dxf_rtext_set_lineweight
 /*!
  * \brief Get the \c plot_style_name from a DXF \c RTEXT entity.
  *
- * \return a pointer to \c plot_style_name when sucessful, or \c NULL
+ * \return the handle \c plot_style_name when sucessful, or 0
  * when an error occurred.
  */
-char *
+uint64_t
 dxf_rtext_get_plot_style_name
 (
         DxfRText *rtext
@@ -2055,19 +1940,12 @@ dxf_rtext_get_plot_style_name
                 fprintf (stderr,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
-                return (NULL);
-        }
-        if (rtext->plot_style_name ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
+                return (0);
         }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (rtext->plot_style_name));
+        return (rtext->plot_style_name);
 }
 
 
@@ -2082,7 +1960,7 @@ dxf_rtext_set_plot_style_name
 (
         DxfRText *rtext,
                 /*!< a pointer to a DXF \c RTEXT entity. */
-        char *plot_style_name
+        uint64_t plot_style_name
                 /*!< a string containing the \c plot_style_name for the
                  * entity. */
 )
@@ -2098,14 +1976,7 @@ dxf_rtext_set_plot_style_name
                   __FUNCTION__);
                 return (NULL);
         }
-        if (plot_style_name == NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was passed.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
-        rtext->plot_style_name = strdup (plot_style_name);
+        rtext->plot_style_name = plot_style_name;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2212,7 +2083,7 @@ dxf_rtext_get_color_name
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (rtext->color_name));
+        return (dxf_strdup (rtext->color_name));
 }
 
 
@@ -2250,7 +2121,7 @@ dxf_rtext_set_color_name
                   __FUNCTION__);
                 return (NULL);
         }
-        rtext->color_name = strdup (color_name);
+        rtext->color_name = dxf_strdup (color_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2357,7 +2228,7 @@ dxf_rtext_get_text_value
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (rtext->text_value));
+        return (dxf_strdup (rtext->text_value));
 }
 
 
@@ -2395,7 +2266,7 @@ dxf_rtext_set_text_value
                   __FUNCTION__);
                 return (NULL);
         }
-        rtext->text_value = strdup (text_value);
+        rtext->text_value = dxf_strdup (text_value);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2437,7 +2308,7 @@ dxf_rtext_get_text_style
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (rtext->text_style));
+        return (dxf_strdup (rtext->text_style));
 }
 
 
@@ -2475,7 +2346,7 @@ dxf_rtext_set_text_style
                   __FUNCTION__);
                 return (NULL);
         }
-        rtext->text_style = strdup (text_style);
+        rtext->text_style = dxf_strdup (text_style);
 #if DEBUG
         DXF_DEBUG_END
 #endif
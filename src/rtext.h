@@ -60,7 +60,7 @@ typedef struct
 dxf_rtext_struct
 {
         /* Members common for all DXF drawable entities. */
-        int id_code;
+        uint64_t id_code;
                 /*!< Identification number for the entity.\n
                  * This is to be an unique (sequential) number in the DXF
                  * file.\n
@@ -133,16 +133,16 @@ dxf_rtext_struct
                  * (optional).\n
                  * Group code = 310.\n
                  * \since Introduced in version R2000. */
-        char *dictionary_owner_soft;
+        uint64_t dictionary_owner_soft;
                 /*!< Soft-pointer ID/handle to owner dictionary (optional).\n
                  * Group code = 330.\n
                  * \since Introduced in version R14. */
-        char *material;
+        uint64_t material;
                 /*!< Hard-pointer ID/handle to material object (present if
                  * not BYLAYER).\n
                  * Group code = 347.\n
                  * \since Introduced in version R2008. */
-        char *dictionary_owner_hard;
+        uint64_t dictionary_owner_hard;
                 /*!< Hard owner ID/handle to owner dictionary (optional).\n
                  * Group code = 360.\n
                  * \since Introduced in version R14. */
@@ -151,7 +151,7 @@ dxf_rtext_struct
                  * Stored and moved around as a 16-bit integer.\n
                  * Group code = 370.\n
                  * \since Introduced in version R2002. */
-        char *plot_style_name;
+        uint64_t plot_style_name;
                 /*!< Hard pointer ID / handle of PlotStyleName object.\n
                  * Group code = 390.\n
                  * \since Introduced in version R2009. */
@@ -238,8 +238,8 @@ DxfRText *dxf_rtext_read (DxfFile *fp, DxfRText *rtext);
 int dxf_rtext_write (DxfFile *fp, DxfRText *rtext);
 int dxf_rtext_free (DxfRText *rtext);
 void dxf_rtext_free_list (DxfRText *rtexts);
-int dxf_rtext_get_id_code (DxfRText *rtext);
-DxfRText *dxf_rtext_set_id_code (DxfRText *rtext, int id_code);
+uint64_t dxf_rtext_get_id_code (DxfRText *rtext);
+DxfRText *dxf_rtext_set_id_code (DxfRText *rtext, uint64_t id_code);
 char *dxf_rtext_get_linetype (DxfRText *rtext);
 DxfRText *dxf_rtext_set_linetype (DxfRText *rtext, char *linetype);
 char *dxf_rtext_get_layer (DxfRText *rtext);
@@ -262,16 +262,16 @@ int16_t dxf_rtext_get_shadow_mode (DxfRText *rtext);
 DxfRText *dxf_rtext_set_shadow_mode (DxfRText *rtext, int16_t shadow_mode);
 DxfBinaryGraphicsData *dxf_rtext_get_binary_graphics_data (DxfRText *rtext);
 DxfRText *dxf_rtext_set_binary_graphics_data (DxfRText *rtext, DxfBinaryGraphicsData *data);
-char *dxf_rtext_get_dictionary_owner_soft (DxfRText *rtext);
-DxfRText *dxf_rtext_set_dictionary_owner_soft (DxfRText *rtext, char *dictionary_owner_soft);
-char *dxf_rtext_get_material (DxfRText *rtext);
-DxfRText *dxf_rtext_set_material (DxfRText *rtext, char *material);
-char *dxf_rtext_get_dictionary_owner_hard (DxfRText *rtext);
-DxfRText *dxf_rtext_set_dictionary_owner_hard (DxfRText *rtext, char *dictionary_owner_hard);
+uint64_t dxf_rtext_get_dictionary_owner_soft (DxfRText *rtext);
+DxfRText *dxf_rtext_set_dictionary_owner_soft (DxfRText *rtext, uint64_t dictionary_owner_soft);
+uint64_t dxf_rtext_get_material (DxfRText *rtext);
+DxfRText *dxf_rtext_set_material (DxfRText *rtext, uint64_t material);
+uint64_t dxf_rtext_get_dictionary_owner_hard (DxfRText *rtext);
+DxfRText *dxf_rtext_set_dictionary_owner_hard (DxfRText *rtext, uint64_t dictionary_owner_hard);
 int16_t dxf_rtext_get_lineweight (DxfRText *rtext);
 DxfRText *dxf_rtext_set_lineweight (DxfRText *rtext, int16_t lineweight);
-char *dxf_rtext_get_plot_style_name (DxfRText *rtext);
-DxfRText *dxf_rtext_set_plot_style_name (DxfRText *rtext, char *plot_style_name);
+uint64_t dxf_rtext_get_plot_style_name (DxfRText *rtext);
+DxfRText *dxf_rtext_set_plot_style_name (DxfRText *rtext, uint64_t plot_style_name);
 long dxf_rtext_get_color_value (DxfRText *rtext);
 DxfRText *dxf_rtext_set_color_value (DxfRText *rtext, long color_value);
 char *dxf_rtext_get_color_name (DxfRText *rtext);
@@ -56,7 +56,6 @@ dxf_section_read
         char temp_string[DXF_MAX_STRING_LENGTH];
         DxfHeader dxf_header;
         DxfBlock dxf_block;
-        char *dxf_entities_list = NULL;
 
         /* Do some basic checks. */
         if (fp == NULL)
@@ -70,7 +69,7 @@ dxf_section_read
         dxf_read_line (temp_string, fp);
         if (strcmp (temp_string, "2") == 0)
         {
-                while (!feof (fp->fp)) /* Does this actually work? */
+                while (!dxf_read_eof (fp))
                 {
                         memset(temp_string, 0, sizeof(temp_string));
                         dxf_read_line (temp_string, fp);
@@ -104,11 +103,10 @@ dxf_section_read
                         else if (strcmp (temp_string, "ENTITIES") == 0)
                         {
                                 /* We have found the begin of the ENTITIES sction. */
-                                dxf_entities_read_table (fp->filename,
-                                                   fp->fp,
-                                                   fp->line_number,
-                                                   dxf_entities_list,
-                                                   dxf_header._AcadVer);                        }
+                                /*! \todo Store the entities in a drawing,
+                                 * for now they are validated and skipped. */
+                                dxf_entities_read_callback (fp, NULL, NULL);
+                        }
                         else if (strcmp (temp_string, "OBJECTS") == 0)
                         {
                                 /* We have found the begin of the OBJECTS sction. */
@@ -162,7 +160,72 @@ dxf_section_write
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        fprintf (fp->fp, "  0\nSECTION\n  2\n%s\n", section_name);
+        dxf_write_string (fp, 0, "SECTION");
+        dxf_write_string (fp, 2, section_name);
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Allocate memory for a \c DxfSectionIndex.
+ *
+ * Fill the memory contents with zeros.
+ *
+ * \return \c NULL when no memory was allocated, a pointer to the
+ * allocated memory when successful.
+ */
+DxfSectionIndex *
+dxf_section_index_new ()
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfSectionIndex *index = NULL;
+
+        if ((index = dxf_malloc (sizeof (DxfSectionIndex))) == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () could not allocate memory.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        memset (index, 0, sizeof (DxfSectionIndex));
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (index);
+}
+
+
+/*!
+ * \brief Free the allocated memory for a \c DxfSectionIndex.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_section_index_free
+(
+        DxfSectionIndex *index
+                /*!< a pointer to the memory occupied by the section
+                 * index. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        /* Do some basic checks. */
+        if (index == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        dxf_free (index);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -170,4 +233,254 @@ dxf_section_write
 }
 
 
+/*!
+ * \brief Compare a line with a keyword, ignoring leading and trailing
+ * white space in the line.
+ *
+ * \return \c TRUE when the line contains the keyword.
+ */
+static int
+dxf_section_line_is
+(
+        const char *line,
+                /*!< Pointer to the first char of the line. */
+        size_t length,
+                /*!< Length of the line. */
+        const char *keyword
+                /*!< Keyword to compare with. */
+)
+{
+        size_t keyword_length = strlen (keyword);
+
+        while ((length > 0) && ((*line == ' ') || (*line == '\t')))
+        {
+                line++;
+                length--;
+        }
+        while ((length > 0)
+          && ((line[length - 1] == ' ') || (line[length - 1] == '\t')))
+        {
+                length--;
+        }
+        return ((length == keyword_length)
+          && (memcmp (line, keyword, keyword_length) == 0));
+}
+
+
+/*!
+ * \brief Scan a DXF file for the locations of its sections.
+ *
+ * Starting at the current position, the lines of the file are walked
+ * once, looking for a \c SECTION or \c ENDSEC value after a group
+ * code 0.\n
+ * No pair is parsed: both keywords can only appear on a value line, so
+ * a line containing one of them, preceded by a line containing 0, is a
+ * section marker whatever the alignment of the pairs.\n
+ * Scanning stops at the \c EOF marker, afterwards the file is
+ * positioned where scanning started.
+ *
+ * \return a pointer to a newly allocated \c DxfSectionIndex, or
+ * \c NULL when an error occurred.
+ */
+DxfSectionIndex *
+dxf_section_index_scan
+(
+        DxfFile *fp
+                /*!< DXF file pointer to an input file (or device). */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfSectionIndex *index;
+        DxfSectionIndexEntry *entry;
+        const char *line;
+        size_t length;
+        int64_t scan_offset;
+        int scan_line;
+        int64_t offset;
+        int64_t zero_offset;
+        int zero_line;
+        int previous_is_zero;
+
+        /* Do some basic checks. */
+        if ((fp == NULL) || (fp->reader == NULL))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL file pointer was passed.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        if ((index = dxf_section_index_new ()) == NULL)
+        {
+                return (NULL);
+        }
+        scan_offset = dxf_read_tell (fp);
+        scan_line = fp->line_number;
+        entry = NULL;
+        zero_offset = -1;
+        zero_line = 0;
+        previous_is_zero = FALSE;
+        for (;;)
+        {
+                offset = dxf_read_tell (fp);
+                if (dxf_reader_next_line (fp, &line, &length) == EXIT_FAILURE)
+                {
+                        break;
+                }
+                if (previous_is_zero)
+                {
+                        if (dxf_section_line_is (line, length, "SECTION"))
+                        {
+                                if (index->number_sections == DXF_MAX_SECTIONS)
+                                {
+                                        fprintf (stderr,
+                                          (_("Warning in %s () too many sections, section in line: %d not indexed.\n")),
+                                          __FUNCTION__, zero_line);
+                                        entry = NULL;
+                                        previous_is_zero = FALSE;
+                                        continue;
+                                }
+                                entry = &index->sections[index->number_sections];
+                                entry->start = zero_offset;
+                                entry->start_line = zero_line;
+                                entry->end = -1;
+                                /* The section name follows with group
+                                 * code 2. */
+                                if ((dxf_reader_next_line (fp, &line, &length) == EXIT_FAILURE)
+                                  || (!dxf_section_line_is (line, length, "2"))
+                                  || (dxf_reader_next_line (fp, &line, &length) == EXIT_FAILURE))
+                                {
+                                        fprintf (stderr,
+                                          (_("Warning in %s () section name expected in line: %d.\n")),
+                                          __FUNCTION__, fp->line_number);
+                                        entry = NULL;
+                                        previous_is_zero = FALSE;
+                                        continue;
+                                }
+                                while ((length > 0) && (line[length - 1] == ' '))
+                                {
+                                        length--;
+                                }
+                                if (length >= DXF_SECTION_NAME_LENGTH)
+                                {
+                                        length = DXF_SECTION_NAME_LENGTH - 1;
+                                }
+                                memcpy (entry->name, line, length);
+                                entry->name[length] = '\0';
+                                entry->content = dxf_read_tell (fp);
+                                entry->content_line = fp->line_number + 1;
+                                index->number_sections++;
+                                previous_is_zero = FALSE;
+                                continue;
+                        }
+                        else if (dxf_section_line_is (line, length, "ENDSEC"))
+                        {
+                                if (entry != NULL)
+                                {
+                                        entry->end = zero_offset;
+                                        entry->end_line = zero_line;
+                                        entry = NULL;
+                                }
+                        }
+                        else if (dxf_section_line_is (line, length, "EOF"))
+                        {
+                                break;
+                        }
+                }
+                previous_is_zero = dxf_section_line_is (line, length, "0");
+                if (previous_is_zero)
+                {
+                        zero_offset = offset;
+                        zero_line = fp->line_number;
+                }
+        }
+        if (dxf_read_error (fp))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () while reading from: %s in line: %d.\n")),
+                  __FUNCTION__, fp->filename, fp->line_number);
+                dxf_section_index_free (index);
+                return (NULL);
+        }
+        if (dxf_read_seek (fp, scan_offset, scan_line) == EXIT_FAILURE)
+        {
+                dxf_section_index_free (index);
+                return (NULL);
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (index);
+}
+
+
+/*!
+ * \brief Find a section in a \c DxfSectionIndex by name.
+ *
+ * \return a pointer to the entry of the first section with the name,
+ * or \c NULL when the file has no such section.
+ */
+DxfSectionIndexEntry *
+dxf_section_index_find
+(
+        DxfSectionIndex *index,
+                /*!< a pointer to a section index. */
+        const char *name
+                /*!< Section name, for example "TABLES". */
+)
+{
+        int i;
+
+        /* Do some basic checks. */
+        if ((index == NULL) || (name == NULL))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        for (i = 0; i < index->number_sections; i++)
+        {
+                if (strcmp (index->sections[i].name, name) == 0)
+                {
+                        return (&index->sections[i]);
+                }
+        }
+        return (NULL);
+}
+
+
+/*!
+ * \brief Position a DXF file at the contents of a section.
+ *
+ * Afterwards the file is positioned as if the section name was just
+ * read, so the reader for the section (for example dxf_header_read (),
+ * dxf_tables_read () or dxf_entities_read_callback ()) can be called.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when the
+ * section was not found or an error occurred.
+ */
+int
+dxf_section_seek
+(
+        DxfFile *fp,
+                /*!< DXF file pointer to an input file (or device). */
+        DxfSectionIndex *index,
+                /*!< a pointer to the section index of \c fp. */
+        const char *name
+                /*!< Section name, for example "TABLES". */
+)
+{
+        DxfSectionIndexEntry *entry;
+
+        entry = dxf_section_index_find (index, name);
+        if (entry == NULL)
+        {
+                return (EXIT_FAILURE);
+        }
+        return (dxf_read_seek (fp, entry->content, entry->content_line - 1));
+}
+
+
 /* EOF */
@@ -51,8 +51,81 @@ extern "C" {
 #endif
 
 
+/*!
+ * \brief Maximum length of a section name in a \c DxfSectionIndex.
+ */
+#define DXF_SECTION_NAME_LENGTH 32
+
+
+/*!
+ * \brief Maximum number of sections recorded in a
+ * \c DxfSectionIndex.
+ */
+#define DXF_MAX_SECTIONS 16
+
+
+/*!
+ * \brief Flags for selecting sections, see
+ * dxf_drawing_read_sections ().
+ */
+#define DXF_SECTION_HEADER 0x01
+#define DXF_SECTION_CLASSES 0x02
+#define DXF_SECTION_TABLES 0x04
+#define DXF_SECTION_BLOCKS 0x08
+#define DXF_SECTION_ENTITIES 0x10
+#define DXF_SECTION_OBJECTS 0x20
+#define DXF_SECTION_THUMBNAIL 0x40
+#define DXF_SECTION_ALL 0x7f
+
+
+/*!
+ * \brief DXF definition of the location of a section in a DXF file.
+ */
+typedef struct
+dxf_section_index_entry_struct
+{
+    char name[DXF_SECTION_NAME_LENGTH];
+        /*!< Section name (group code 2), for example "HEADER". */
+    int64_t start;
+        /*!< File offset of the group code 0 line of \c SECTION. */
+    int64_t content;
+        /*!< File offset of the first pair after the section name. */
+    int64_t end;
+        /*!< File offset of the group code 0 line of \c ENDSEC,
+         * -1 when the section is not terminated. */
+    int start_line;
+        /*!< Line number of the line at \c start. */
+    int content_line;
+        /*!< Line number of the line at \c content. */
+    int end_line;
+        /*!< Line number of the line at \c end. */
+} DxfSectionIndexEntry;
+
+
+/*!
+ * \brief DXF definition of an index of the sections in a DXF file.
+ *
+ * Built by dxf_section_index_scan () in a single pass over the lines
+ * of the file, without parsing any pair, so a caller can seek to the
+ * sections it needs with dxf_section_seek () and skip the others.
+ */
+typedef struct
+dxf_section_index_struct
+{
+    int number_sections;
+        /*!< Number of sections found. */
+    DxfSectionIndexEntry sections[DXF_MAX_SECTIONS];
+        /*!< Sections in file order. */
+} DxfSectionIndex;
+
+
 int dxf_section_read (DxfFile *fp);
 int dxf_section_write (DxfFile *fp, char *section_name);
+DxfSectionIndex *dxf_section_index_new ();
+int dxf_section_index_free (DxfSectionIndex *index);
+DxfSectionIndex *dxf_section_index_scan (DxfFile *fp);
+DxfSectionIndexEntry *dxf_section_index_find (DxfSectionIndex *index, const char *name);
+int dxf_section_seek (DxfFile *fp, DxfSectionIndex *index, const char *name);
 
 
 #ifdef __cplusplus
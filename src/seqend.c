@@ -42,6 +42,7 @@
 
 
 #include "seqend.h"
+#include "util.h"
 
 
 /*!
@@ -64,7 +65,7 @@ dxf_seqend_new ()
         size = sizeof (DxfSeqend);
         /* avoid malloc of 0 bytes */
         if (size == 0) size = 1;
-        if ((seqend = malloc (size)) == NULL)
+        if ((seqend = dxf_malloc (size)) == NULL)
         {
                 fprintf (stderr,
                   (_("Error in %s () could not allocate memory for a DxfSeqend struct.\n")),
@@ -114,9 +115,9 @@ dxf_seqend_init
                 __FUNCTION__);
               return (NULL);
         }
-        seqend->id_code = 0;
-        seqend->linetype = strdup (DXF_DEFAULT_LINETYPE);
-        seqend->layer = strdup (DXF_DEFAULT_LAYER);
+        seqend->id_code = DXF_HANDLE_NONE;
+        seqend->linetype = dxf_strdup (DXF_DEFAULT_LINETYPE);
+        seqend->layer = dxf_strdup (DXF_DEFAULT_LAYER);
         seqend->elevation = 0.0;
         seqend->thickness = 0.0;
         seqend->linetype_scale = DXF_DEFAULT_LINETYPE_SCALE;
@@ -127,15 +128,15 @@ dxf_seqend_init
         seqend->shadow_mode = 0;
         seqend->binary_graphics_data = dxf_binary_graphics_data_new ();
         seqend->binary_graphics_data = dxf_binary_graphics_data_init (seqend->binary_graphics_data);
-        seqend->dictionary_owner_soft = strdup ("");
-        seqend->material = strdup ("");
-        seqend->dictionary_owner_hard = strdup ("");
+        seqend->dictionary_owner_soft = 0;
+        seqend->material = 0;
+        seqend->dictionary_owner_hard = 0;
         seqend->lineweight = 0;
-        seqend->plot_style_name = strdup ("");
+        seqend->plot_style_name = 0;
         seqend->color_value = 0;
-        seqend->color_name = strdup ("");
+        seqend->color_name = dxf_strdup ("");
         seqend->transparency = 0;
-        seqend->app_name = strdup ("");
+        seqend->app_name = dxf_strdup ("");
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -166,7 +167,8 @@ dxf_seqend_read
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        char *temp_string = NULL;
+        char temp_string[DXF_MAX_STRING_LENGTH];
+        int group_code;
 
         /* Do some basic checks. */
         if (fp == NULL)
@@ -174,8 +176,6 @@ dxf_seqend_read
                 fprintf (stderr,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
-                /* Clean up. */
-                free (temp_string);
                 return (NULL);
         }
         if (seqend == NULL)
@@ -185,206 +185,168 @@ dxf_seqend_read
                   __FUNCTION__);
                 seqend = dxf_seqend_init (seqend);
         }
-        (fp->line_number)++;
-        fscanf (fp->fp, "%[^\n]", temp_string);
-        while (strcmp (temp_string, "0") != 0)
+        while ((dxf_read_group_code (fp, &group_code) == EXIT_SUCCESS)
+          && (group_code != 0))
         {
-                if (ferror (fp->fp))
+                if (dxf_read_error (fp))
                 {
                         fprintf (stderr,
                           (_("Error in %s () while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
-                        fclose (fp->fp);
-                        /* Clean up. */
-                        free (temp_string);
                         return (NULL);
                 }
-                if (strcmp (temp_string, "2") == 0)
-                {
-                        /* Now follows a string containing an application
-                         * name. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, seqend->app_name);
-                }
-                else if (strcmp (temp_string, "5") == 0)
-                {
-                        /* Now follows a string containing a sequential
-                         * id number. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%x\n", (uint *) &seqend->id_code);
-                }
-                else if (strcmp (temp_string, "6") == 0)
-                {
-                        /* Now follows a string containing a linetype
-                         * name. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, seqend->linetype);
-                }
-                else if (strcmp (temp_string, "8") == 0)
-                {
-                        /* Now follows a string containing a layer name. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, seqend->layer);
-                }
-                else if (strcmp (temp_string, "38") == 0)
-                {
-                        /* Now follows a string containing the
-                         * elevation. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &seqend->elevation);
-                }
-                else if (strcmp (temp_string, "39") == 0)
-                {
-                        /* Now follows a string containing the
-                         * thickness. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &seqend->thickness);
-                }
-                else if (strcmp (temp_string, "48") == 0)
-                {
-                        /* Now follows a string containing the linetype
-                         * scale. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &seqend->linetype_scale);
-                }
-                else if (strcmp (temp_string, "60") == 0)
+                switch (group_code)
                 {
-                        /* Now follows a string containing the
-                         * visibility value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%hd\n", &seqend->visibility);
-                }
-                else if (strcmp (temp_string, "62") == 0)
-                {
-                        /* Now follows a string containing the
-                         * color value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%d\n", &seqend->color);
-                }
-                else if (strcmp (temp_string, "67") == 0)
-                {
-                        /* Now follows a string containing the
-                         * paperspace value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%d\n", &seqend->paperspace);
-                }
-                else if (strcmp (temp_string, "92") == 0)
-                {
-                        /* Now follows a string containing the
-                         * graphics data size value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%d\n", &seqend->graphics_data_size);
-                }
-                else if ((fp->acad_version_number >= AutoCAD_13)
-                        && (strcmp (temp_string, "100") == 0))
-                {
-                        /* Now follows a string containing the
-                         * subclass marker value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
-                        if (strcmp (temp_string, "AcDbEntity") != 0)
-                        {
+                        case 2:
+                                /* Now follows a string containing an application
+                                 * name. */
+                                dxf_read_string (fp, &seqend->app_name);
+                                break;
+                        case 5:
+                                /* Now follows a string containing a sequential
+                                 * id number. */
+                                dxf_read_handle (fp, &seqend->id_code);
+                                break;
+                        case 6:
+                                /* Now follows a string containing a linetype
+                                 * name. */
+                                dxf_read_string_interned (fp, &seqend->linetype);
+                                break;
+                        case 8:
+                                /* Now follows a string containing a layer name. */
+                                dxf_read_string_interned (fp, &seqend->layer);
+                                break;
+                        case 38:
+                                /* Now follows a string containing the
+                                 * elevation. */
+                                dxf_read_double (fp, &seqend->elevation);
+                                break;
+                        case 39:
+                                /* Now follows a string containing the
+                                 * thickness. */
+                                dxf_read_double (fp, &seqend->thickness);
+                                break;
+                        case 48:
+                                /* Now follows a string containing the linetype
+                                 * scale. */
+                                dxf_read_double (fp, &seqend->linetype_scale);
+                                break;
+                        case 60:
+                                /* Now follows a string containing the
+                                 * visibility value. */
+                                dxf_read_int16 (fp, &seqend->visibility);
+                                break;
+                        case 62:
+                                /* Now follows a string containing the
+                                 * color value. */
+                                dxf_read_int (fp, &seqend->color);
+                                break;
+                        case 67:
+                                /* Now follows a string containing the
+                                 * paperspace value. */
+                                dxf_read_int (fp, &seqend->paperspace);
+                                break;
+                        case 92:
+                                /* Now follows a string containing the
+                                 * graphics data size value. */
+                                dxf_read_int (fp, &seqend->graphics_data_size);
+                                break;
+                        case 100:
+                                if (fp->acad_version_number >= AutoCAD_13)
+                                {
+                                        /* Now follows a string containing the
+                                         * subclass marker value. */
+                                        dxf_read_line (temp_string, fp);
+                                        if (strcmp (temp_string, "AcDbEntity") != 0)
+                                        {
+                                                fprintf (stderr,
+                                                  (_("Warning in %s () found a bad subclass marker in: %s in line: %d.\n")),
+                                                  __FUNCTION__, fp->filename, fp->line_number);
+                                        }
+                                }
+                                else
+                                {
+                                        fprintf (stderr,
+                                          (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
+                                          __FUNCTION__, fp->filename, fp->line_number);
+                                        /* Skip the value of the unknown group code. */
+                                        dxf_read_line (temp_string, fp);
+                                }
+                                break;
+                        case 284:
+                                /* Now follows a string containing the shadow
+                                 * mode value. */
+                                dxf_read_int16 (fp, &seqend->shadow_mode);
+                                break;
+                        case 310:
+                                /* Now follows a string containing binary
+                                 * graphics data. */
+                                dxf_read_string (fp, &seqend->binary_graphics_data->data_line);
+                                dxf_binary_graphics_data_init ((DxfBinaryGraphicsData *) seqend->binary_graphics_data->next);
+                                seqend->binary_graphics_data = (DxfBinaryGraphicsData *) seqend->binary_graphics_data->next;
+                                break;
+                        case 330:
+                                /* Now follows a string containing Soft-pointer
+                                 * ID/handle to owner dictionary. */
+                                dxf_read_handle (fp, &seqend->dictionary_owner_soft);
+                                break;
+                        case 347:
+                                /* Now follows a string containing a
+                                 * hard-pointer ID/handle to material object. */
+                                dxf_read_handle (fp, &seqend->material);
+                                break;
+                        case 360:
+                                /* Now follows a string containing Hard owner
+                                 * ID/handle to owner dictionary. */
+                                dxf_read_handle (fp, &seqend->dictionary_owner_hard);
+                                break;
+                        case 370:
+                                /* Now follows a string containing the lineweight
+                                 * value. */
+                                dxf_read_int16 (fp, &seqend->lineweight);
+                                break;
+                        case 390:
+                                /* Now follows a string containing a plot style
+                                 * name value. */
+                                dxf_read_handle (fp, &seqend->plot_style_name);
+                                break;
+                        case 420:
+                                /* Now follows a string containing a color value. */
+                                dxf_read_long (fp, &seqend->color_value);
+                                break;
+                        case 430:
+                                /* Now follows a string containing a color
+                                 * name value. */
+                                dxf_read_string_interned (fp, &seqend->color_name);
+                                break;
+                        case 440:
+                                /* Now follows a string containing a transparency
+                                 * value. */
+                                dxf_read_long (fp, &seqend->transparency);
+                                break;
+                        case 999:
+                                /* Now follows a string containing a comment. */
+                                dxf_read_line (temp_string, fp);
+                                fprintf (stdout, "DXF comment: %s\n", temp_string);
+                                break;
+                        default:
                                 fprintf (stderr,
-                                  (_("Warning in %s () found a bad subclass marker in: %s in line: %d.\n")),
+                                  (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
                                   __FUNCTION__, fp->filename, fp->line_number);
-                        }
-                }
-                else if (strcmp (temp_string, "284") == 0)
-                {
-                        /* Now follows a string containing the shadow
-                         * mode value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%hd\n", &seqend->shadow_mode);
-                }
-                else if (strcmp (temp_string, "310") == 0)
-                {
-                        /* Now follows a string containing binary
-                         * graphics data. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, seqend->binary_graphics_data->data_line);
-                        dxf_binary_graphics_data_init ((DxfBinaryGraphicsData *) seqend->binary_graphics_data->next);
-                        seqend->binary_graphics_data = (DxfBinaryGraphicsData *) seqend->binary_graphics_data->next;
-                }
-                else if (strcmp (temp_string, "330") == 0)
-                {
-                        /* Now follows a string containing Soft-pointer
-                         * ID/handle to owner dictionary. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, seqend->dictionary_owner_soft);
-                }
-                else if (strcmp (temp_string, "347") == 0)
-                {
-                        /* Now follows a string containing a
-                         * hard-pointer ID/handle to material object. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, seqend->material);
-                }
-                else if (strcmp (temp_string, "360") == 0)
-                {
-                        /* Now follows a string containing Hard owner
-                         * ID/handle to owner dictionary. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, seqend->dictionary_owner_hard);
-                }
-                else if (strcmp (temp_string, "370") == 0)
-                {
-                        /* Now follows a string containing the lineweight
-                         * value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%hd\n", &seqend->lineweight);
-                }
-                else if (strcmp (temp_string, "390") == 0)
-                {
-                        /* Now follows a string containing a plot style
-                         * name value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, seqend->plot_style_name);
-                }
-                else if (strcmp (temp_string, "420") == 0)
-                {
-                        /* Now follows a string containing a color value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%ld\n", &seqend->color_value);
-                }
-                else if (strcmp (temp_string, "430") == 0)
-                {
-                        /* Now follows a string containing a color
-                         * name value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, seqend->color_name);
-                }
-                else if (strcmp (temp_string, "440") == 0)
-                {
-                        /* Now follows a string containing a transparency
-                         * value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%ld\n", &seqend->transparency);
-                }
-                else if (strcmp (temp_string, "999") == 0)
-                {
-                        /* Now follows a string containing a comment. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
-                        fprintf (stdout, "DXF comment: %s\n", temp_string);
-                }
-                else
-                {
-                        fprintf (stderr,
-                          (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
-                          __FUNCTION__, fp->filename, fp->line_number);
+                                /* Skip the value of the unknown group code. */
+                                dxf_read_line (temp_string, fp);
+                                break;
                 }
         }
         /* Handle omitted members and/or illegal values. */
         if (strcmp (seqend->linetype, "") == 0)
         {
-                seqend->linetype = strdup (DXF_DEFAULT_LINETYPE);
+                seqend->linetype = dxf_strdup (DXF_DEFAULT_LINETYPE);
         }
         if (strcmp (seqend->layer, "") == 0)
         {
-                seqend->layer = strdup (DXF_DEFAULT_LAYER);
+                seqend->layer = dxf_strdup (DXF_DEFAULT_LAYER);
         }
-        /* Clean up. */
-        free (temp_string);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -418,7 +380,7 @@ dxf_seqend_write
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        char *dxf_entity_name = strdup ("SEQEND");
+        char *dxf_entity_name = dxf_strdup ("SEQEND");
 
         /* Do some basic checks. */
         if (fp == NULL)
@@ -427,7 +389,7 @@ dxf_seqend_write
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (seqend == NULL)
@@ -436,23 +398,23 @@ dxf_seqend_write
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (strcmp (seqend->linetype, "") == 0)
         {
                 fprintf (stderr,
-                  (_("Warning in %s () empty linetype string for the %s entity with id-code: %x\n")),
+                  (_("Warning in %s () empty linetype string for the %s entity with id-code: %" PRIx64 "\n")),
                   __FUNCTION__, dxf_entity_name, seqend->id_code);
                 fprintf (stderr,
                   (_("\t%s entity is reset to default linetype")),
                   dxf_entity_name);
-                seqend->linetype = strdup (DXF_DEFAULT_LINETYPE);
+                seqend->linetype = dxf_strdup (DXF_DEFAULT_LINETYPE);
         }
         if (strcmp (seqend->layer, "") == 0)
         {
                 fprintf (stderr,
-                  (_("Warning in %s () empty layer string for the %s entity with id-code: %x\n")),
+                  (_("Warning in %s () empty layer string for the %s entity with id-code: %" PRIx64 "\n")),
                   __FUNCTION__, dxf_entity_name, seqend->id_code);
                 fprintf (stderr,
                   (_("\t%s entity is relocated to layer 0")),
@@ -460,10 +422,10 @@ dxf_seqend_write
                 seqend->layer = DXF_DEFAULT_LAYER;
         }
         /* Start writing output. */
-        fprintf (fp->fp, "  0\n%s\n", dxf_entity_name);
-        if (seqend->id_code != -1)
+        dxf_write_string (fp, 0, dxf_entity_name);
+        if (seqend->id_code != DXF_HANDLE_NONE)
         {
-                fprintf (fp->fp, "  5\n%x\n", seqend->id_code);
+                dxf_write_hex (fp, 5, seqend->id_code);
         }
         /*!
          * \todo for version R14.\n
@@ -475,72 +437,72 @@ dxf_seqend_write
          * 102 groups are application defined (optional).\n\n
          * End of group, "}" (optional), with Group code 102.
          */
-        if ((strcmp (seqend->dictionary_owner_soft, "") != 0)
+        if ((seqend->dictionary_owner_soft != 0)
           && (fp->acad_version_number >= AutoCAD_14))
         {
-                fprintf (fp->fp, "102\n{ACAD_REACTORS\n");
-                fprintf (fp->fp, "330\n%s\n", seqend->dictionary_owner_soft);
-                fprintf (fp->fp, "102\n}\n");
+                dxf_write_string (fp, 102, "{ACAD_REACTORS");
+                dxf_write_hex (fp, 330, seqend->dictionary_owner_soft);
+                dxf_write_string (fp, 102, "}");
         }
-        if ((strcmp (seqend->dictionary_owner_hard, "") != 0)
+        if ((seqend->dictionary_owner_hard != 0)
           && (fp->acad_version_number >= AutoCAD_14))
         {
-                fprintf (fp->fp, "102\n{ACAD_XDICTIONARY\n");
-                fprintf (fp->fp, "360\n%s\n", seqend->dictionary_owner_hard);
-                fprintf (fp->fp, "102\n}\n");
+                dxf_write_string (fp, 102, "{ACAD_XDICTIONARY");
+                dxf_write_hex (fp, 360, seqend->dictionary_owner_hard);
+                dxf_write_string (fp, 102, "}");
         }
         if (fp->acad_version_number >= AutoCAD_13)
         {
-                fprintf (fp->fp, "100\nAcDbEntity\n");
+                dxf_write_string (fp, 100, "AcDbEntity");
         }
         if (seqend->paperspace == DXF_PAPERSPACE)
         {
-                fprintf (fp->fp, " 67\n%d\n", (int16_t) DXF_PAPERSPACE);
+                dxf_write_int (fp, 67, (int16_t) DXF_PAPERSPACE);
         }
-        fprintf (fp->fp, "  8\n%s\n", seqend->layer);
+        dxf_write_string (fp, 8, seqend->layer);
         if (strcmp (seqend->linetype, DXF_DEFAULT_LINETYPE) != 0)
         {
-                fprintf (fp->fp, "  6\n%s\n", seqend->linetype);
+                dxf_write_string (fp, 6, seqend->linetype);
         }
         if ((fp->acad_version_number >= AutoCAD_2008)
-          && (strcmp (seqend->material, "") != 0))
+          && (seqend->material != 0))
         {
-                fprintf (fp->fp, "347\n%s\n", seqend->material);
+                dxf_write_hex (fp, 347, seqend->material);
         }
         if (seqend->color != DXF_COLOR_BYLAYER)
         {
-                fprintf (fp->fp, " 62\n%d\n", seqend->color);
+                dxf_write_int (fp, 62, seqend->color);
         }
         if (fp->acad_version_number >= AutoCAD_2002)
         {
-                fprintf (fp->fp, "370\n%d\n", seqend->lineweight);
+                dxf_write_int (fp, 370, seqend->lineweight);
         }
         if ((fp->acad_version_number <= AutoCAD_11)
           && DXF_FLATLAND
           && (seqend->elevation != 0.0))
         {
-                fprintf (fp->fp, " 38\n%f\n", seqend->elevation);
+                dxf_write_double (fp, 38, seqend->elevation);
         }
         if ((fp->acad_version_number <= AutoCAD_13)
           && (seqend->thickness != 0.0))
         {
-                fprintf (fp->fp, " 39\n%f\n", seqend->thickness);
+                dxf_write_double (fp, 39, seqend->thickness);
         }
         if (seqend->linetype_scale != 1.0)
         {
-                fprintf (fp->fp, " 48\n%f\n", seqend->linetype_scale);
+                dxf_write_double (fp, 48, seqend->linetype_scale);
         }
         if (seqend->visibility != 0)
         {
-                fprintf (fp->fp, " 60\n%d\n", seqend->visibility);
+                dxf_write_int (fp, 60, seqend->visibility);
         }
         if ((fp->acad_version_number >= AutoCAD_2000)
           && (seqend->graphics_data_size > 0))
         {
 #ifdef BUILD_64
-                fprintf (fp->fp, "160\n%d\n", seqend->graphics_data_size);
+                dxf_write_int (fp, 160, seqend->graphics_data_size);
 #else
-                fprintf (fp->fp, " 92\n%d\n", seqend->graphics_data_size);
+                dxf_write_int (fp, 92, seqend->graphics_data_size);
 #endif
                 if (seqend->binary_graphics_data != NULL)
                 {
@@ -548,24 +510,24 @@ dxf_seqend_write
                         iter = (DxfBinaryGraphicsData *) seqend->binary_graphics_data;
                         while (iter != NULL)
                         {
-                                fprintf (fp->fp, "310\n%s\n", dxf_binary_graphics_data_get_data_line (iter));
+                                dxf_write_string (fp, 310, dxf_binary_graphics_data_get_data_line (iter));
                                 iter = (DxfBinaryGraphicsData *) dxf_binary_graphics_data_get_next (iter);
                         }
                 }
         }
         if (fp->acad_version_number >= AutoCAD_2004)
         {
-                fprintf (fp->fp, "420\n%ld\n", seqend->color_value);
-                fprintf (fp->fp, "430\n%s\n", seqend->color_name);
-                fprintf (fp->fp, "440\n%ld\n", seqend->transparency);
+                dxf_write_int (fp, 420, seqend->color_value);
+                dxf_write_string (fp, 430, seqend->color_name);
+                dxf_write_int (fp, 440, seqend->transparency);
         }
         if (fp->acad_version_number >= AutoCAD_2009)
         {
-                fprintf (fp->fp, "390\n%s\n", seqend->plot_style_name);
-                fprintf (fp->fp, "284\n%d\n", seqend->shadow_mode);
+                dxf_write_hex (fp, 390, seqend->plot_style_name);
+                dxf_write_int (fp, 284, seqend->shadow_mode);
         }
         /* Clean up. */
-        free (dxf_entity_name);
+        dxf_free (dxf_entity_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -599,16 +561,12 @@ dxf_seqend_free
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        free (seqend->linetype);
-        free (seqend->layer);
+        dxf_string_free (seqend->linetype);
+        dxf_string_free (seqend->layer);
         dxf_binary_graphics_data_free_list (seqend->binary_graphics_data);
-        free (seqend->dictionary_owner_soft);
-        free (seqend->material);
-        free (seqend->dictionary_owner_hard);
-        free (seqend->plot_style_name);
-        free (seqend->color_name);
-        free (seqend->app_name);
-        free (seqend);
+        dxf_string_free (seqend->color_name);
+        dxf_free (seqend->app_name);
+        dxf_free (seqend);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -621,7 +579,7 @@ dxf_seqend_free
  *
  * \return \c id_code.
  */
-int
+uint64_t
 dxf_seqend_get_id_code
 (
         DxfSeqend *seqend
@@ -639,12 +597,6 @@ dxf_seqend_get_id_code
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (seqend->id_code < 0)
-        {
-                fprintf (stderr,
-                  (_("Warning in %s () a negative value was found.\n")),
-                  __FUNCTION__);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -660,7 +612,7 @@ dxf_seqend_set_id_code
 (
         DxfSeqend *seqend,
                 /*!< a pointer to a DXF \c SEQEND entity. */
-        int id_code
+        uint64_t id_code
                 /*!< the \c id_code to be set for the entity.\n
                  * This is to be an unique (sequential) number in the
                  * DXF file. */
@@ -677,12 +629,6 @@ dxf_seqend_set_id_code
                   __FUNCTION__);
                 return (NULL);
         }
-        if (id_code < 0)
-        {
-                fprintf (stderr,
-                  (_("Warning in %s () a negative value was passed.\n")),
-                  __FUNCTION__);
-        }
         seqend->id_code = id_code;
 #if DEBUG
         DXF_DEBUG_END
@@ -724,7 +670,7 @@ dxf_seqend_get_linetype
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (seqend->linetype));
+        return (dxf_strdup (seqend->linetype));
 }
 
 
@@ -759,7 +705,7 @@ dxf_seqend_set_linetype
                   __FUNCTION__);
                 return (NULL);
         }
-        seqend->linetype = strdup (linetype);
+        seqend->linetype = dxf_strdup (linetype);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -800,7 +746,7 @@ dxf_seqend_get_layer
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (seqend->layer));
+        return (dxf_strdup (seqend->layer));
 }
 
 
@@ -835,7 +781,7 @@ dxf_seqend_set_layer
                   __FUNCTION__);
                 return (NULL);
         }
-        seqend->layer = strdup (layer);
+        seqend->layer = dxf_strdup (layer);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1574,11 +1520,9 @@ dxf_seqend_set_binary_graphics_data
  * \brief Get the pointer to the \c dictionary_owner_soft from a DXF 
  * \c SEQEND entity.
  *
- * \return pointer to the \c dictionary_owner_soft.
- *
- * \warning No checks are performed on the returned pointer (string).
+ * \return the handle of the \c dictionary_owner_soft.
  */
-char *
+uint64_t
 dxf_seqend_get_dictionary_owner_soft
 (
         DxfSeqend *seqend
@@ -1594,19 +1538,12 @@ dxf_seqend_get_dictionary_owner_soft
                 fprintf (stderr,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
-                return (NULL);
-        }
-        if (seqend->dictionary_owner_soft ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
+                return (0);
         }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (seqend->dictionary_owner_soft));
+        return (seqend->dictionary_owner_soft);
 }
 
 
@@ -1619,8 +1556,8 @@ dxf_seqend_set_dictionary_owner_soft
 (
         DxfSeqend *seqend,
                 /*!< a pointer to a DXF \c SEQEND entity. */
-        char *dictionary_owner_soft
-                /*!< a string containing the pointer to the \c
+        uint64_t dictionary_owner_soft
+                /*!< the handle of the \c
                  * dictionary_owner_soft for the entity. */
 )
 {
@@ -1635,14 +1572,7 @@ dxf_seqend_set_dictionary_owner_soft
                   __FUNCTION__);
                 return (NULL);
         }
-        if (dictionary_owner_soft == NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was passed.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
-        seqend->dictionary_owner_soft = strdup (dictionary_owner_soft);
+        seqend->dictionary_owner_soft = dictionary_owner_soft;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1653,12 +1583,10 @@ dxf_seqend_set_dictionary_owner_soft
 /*!
  * \brief Get the pointer to the \c material from a DXF \c SEQEND entity.
  *
- * \return a pointer to \c material when successful, or \c NULL when an
+ * \return the handle \c material when successful, or 0 when an
  * error occurred.
- *
- * \warning No checks are performed on the returned pointer.
  */
-char *
+uint64_t
 dxf_seqend_get_material
 (
         DxfSeqend *seqend
@@ -1674,19 +1602,12 @@ dxf_seqend_get_material
                 fprintf (stderr,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
-                return (NULL);
-        }
-        if (seqend->material ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
+                return (0);
         }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (seqend->material));
+        return (seqend->material);
 }
 
 
@@ -1701,8 +1622,8 @@ dxf_seqend_set_material
 (
         DxfSeqend *seqend,
                 /*!< a pointer to a DXF \c SEQEND entity. */
-        char *material
-                /*!< a string containing the pointer to the \c
+        uint64_t material
+                /*!< the handle of the \c
                  * material for the entity. */
 )
 {
@@ -1717,14 +1638,7 @@ dxf_seqend_set_material
                   __FUNCTION__);
                 return (NULL);
         }
-        if (material == NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was passed.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
-        seqend->material = strdup (material);
+        seqend->material = material;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1736,11 +1650,9 @@ dxf_seqend_set_material
  * \brief Get the pointer to the \c dictionary_owner_hard from a DXF 
  * \c SEQEND entity.
  *
- * \return pointer to the \c dictionary_owner_hard.
- *
- * \warning No checks are performed on the returned pointer (string).
+ * \return the handle of the \c dictionary_owner_hard.
  */
-char *
+uint64_t
 dxf_seqend_get_dictionary_owner_hard
 (
         DxfSeqend *seqend
@@ -1756,19 +1668,12 @@ dxf_seqend_get_dictionary_owner_hard
                 fprintf (stderr,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
-                return (NULL);
-        }
-        if (seqend->dictionary_owner_hard ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
+                return (0);
         }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (seqend->dictionary_owner_hard));
+        return (seqend->dictionary_owner_hard);
 }
 
 
@@ -1781,8 +1686,8 @@ dxf_seqend_set_dictionary_owner_hard
 (
         DxfSeqend *seqend,
                 /*!< a pointer to a DXF \c SEQEND entity. */
-        char *dictionary_owner_hard
-                /*!< a string containing the pointer to the \c
+        uint64_t dictionary_owner_hard
+                /*!< the handle of the \c
                  * dictionary_owner_hard for the entity. */
 )
 {
@@ -1797,14 +1702,7 @@ dxf_seqend_set_dictionary_owner_hard
                   __FUNCTION__);
                 return (NULL);
         }
-        if (dictionary_owner_hard == NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was passed.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
-        seqend->dictionary_owner_hard = strdup (dictionary_owner_hard);
+        seqend->dictionary_owner_hard = dictionary_owner_hard;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1880,10 +1778,10 @@ dxf_seqend_set_lineweight
 /*!
  * \brief Get the \c plot_style_name from a DXF \c SEQEND entity.
  *
- * \return a pointer to \c plot_style_name when sucessful, or \c NULL
+ * \return the handle \c plot_style_name when sucessful, or 0
  * when an error occurred.
  */
-char *
+uint64_t
 dxf_seqend_get_plot_style_name
 (
         DxfSeqend *seqend
@@ -1899,19 +1797,12 @@ dxf_seqend_get_plot_style_name
                 fprintf (stderr,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
-                return (NULL);
-        }
-        if (seqend->plot_style_name ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
+                return (0);
         }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (seqend->plot_style_name));
+        return (seqend->plot_style_name);
 }
 
 
@@ -1926,7 +1817,7 @@ dxf_seqend_set_plot_style_name
 (
         DxfSeqend *seqend,
                 /*!< a pointer to a DXF \c SEQEND entity. */
-        char *plot_style_name
+        uint64_t plot_style_name
                 /*!< a string containing the \c plot_style_name for the
                  * entity. */
 )
@@ -1942,14 +1833,7 @@ dxf_seqend_set_plot_style_name
                   __FUNCTION__);
                 return (NULL);
         }
-        if (plot_style_name == NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was passed.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
-        seqend->plot_style_name = strdup (plot_style_name);
+        seqend->plot_style_name = plot_style_name;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2056,7 +1940,7 @@ dxf_seqend_get_color_name
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (seqend->color_name));
+        return (dxf_strdup (seqend->color_name));
 }
 
 
@@ -2094,7 +1978,7 @@ dxf_seqend_set_color_name
                   __FUNCTION__);
                 return (NULL);
         }
-        seqend->color_name = strdup (color_name);
+        seqend->color_name = dxf_strdup (color_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2201,7 +2085,7 @@ dxf_seqend_get_app_name
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (seqend->app_name));
+        return (dxf_strdup (seqend->app_name));
 }
 
 
@@ -2239,7 +2123,7 @@ dxf_seqend_set_app_name
                   __FUNCTION__);
                 return (NULL);
         }
-        seqend->app_name = strdup (app_name);
+        seqend->app_name = dxf_strdup (app_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -59,7 +59,7 @@ typedef struct
 dxf_seqend_struct
 {
         /* Members common for all DXF drawable entities. */
-        int id_code;
+        uint64_t id_code;
                 /*!< Identification number for the entity.\n
                  * This is to be an unique (sequential) number in the DXF
                  * file.\n
@@ -132,16 +132,16 @@ dxf_seqend_struct
                  * (optional).\n
                  * Group code = 310.\n
                  * \since Introduced in version R2000. */
-        char *dictionary_owner_soft;
+        uint64_t dictionary_owner_soft;
                 /*!< Soft-pointer ID/handle to owner dictionary (optional).\n
                  * Group code = 330.\n
                  * \since Introduced in version R14. */
-        char *material;
+        uint64_t material;
                 /*!< Hard-pointer ID/handle to material object (present if
                  * not BYLAYER).\n
                  * Group code = 347.\n
                  * \since Introduced in version R2008. */
-        char *dictionary_owner_hard;
+        uint64_t dictionary_owner_hard;
                 /*!< Hard owner ID/handle to owner dictionary (optional).\n
                  * Group code = 360.\n
                  * \since Introduced in version R14. */
@@ -150,7 +150,7 @@ dxf_seqend_struct
                  * Stored and moved around as a 16-bit integer.\n
                  * Group code = 370.\n
                  * \since Introduced in version R2002. */
-        char *plot_style_name;
+        uint64_t plot_style_name;
                 /*!< Hard pointer ID / handle of PlotStyleName object.\n
                  * Group code = 390.\n
                  * \since Introduced in version R2009. */
@@ -201,8 +201,8 @@ DxfSeqend *dxf_seqend_init (DxfSeqend *seqend);
 DxfSeqend *dxf_seqend_read (DxfFile *fp, DxfSeqend *seqend);
 int dxf_seqend_write (DxfFile *fp, DxfSeqend *seqend);
 int dxf_seqend_free (DxfSeqend *seqend);
-int dxf_seqend_get_id_code (DxfSeqend *seqend);
-DxfSeqend *dxf_seqend_set_id_code (DxfSeqend *seqend, int id_code);
+uint64_t dxf_seqend_get_id_code (DxfSeqend *seqend);
+DxfSeqend *dxf_seqend_set_id_code (DxfSeqend *seqend, uint64_t id_code);
 char *dxf_seqend_get_linetype (DxfSeqend *seqend);
 DxfSeqend *dxf_seqend_set_linetype (DxfSeqend *seqend, char *linetype);
 char *dxf_seqend_get_layer (DxfSeqend *seqend);
@@ -225,16 +225,16 @@ int16_t dxf_seqend_get_shadow_mode (DxfSeqend *seqend);
 DxfSeqend *dxf_seqend_set_shadow_mode (DxfSeqend *seqend, int16_t shadow_mode);
 DxfBinaryGraphicsData *dxf_seqend_get_binary_graphics_data (DxfSeqend *seqend);
 DxfSeqend *dxf_seqend_set_binary_graphics_data (DxfSeqend *seqend, DxfBinaryGraphicsData *data);
-char *dxf_seqend_get_dictionary_owner_soft (DxfSeqend *seqend);
-DxfSeqend *dxf_seqend_set_dictionary_owner_soft (DxfSeqend *seqend, char *dictionary_owner_soft);
-char *dxf_seqend_get_material (DxfSeqend *seqend);
-DxfSeqend *dxf_seqend_set_material (DxfSeqend *seqend, char *material);
-char *dxf_seqend_get_dictionary_owner_hard (DxfSeqend *seqend);
-DxfSeqend *dxf_seqend_set_dictionary_owner_hard (DxfSeqend *seqend, char *dictionary_owner_hard);
+uint64_t dxf_seqend_get_dictionary_owner_soft (DxfSeqend *seqend);
+DxfSeqend *dxf_seqend_set_dictionary_owner_soft (DxfSeqend *seqend, uint64_t dictionary_owner_soft);
+uint64_t dxf_seqend_get_material (DxfSeqend *seqend);
+DxfSeqend *dxf_seqend_set_material (DxfSeqend *seqend, uint64_t material);
+uint64_t dxf_seqend_get_dictionary_owner_hard (DxfSeqend *seqend);
+DxfSeqend *dxf_seqend_set_dictionary_owner_hard (DxfSeqend *seqend, uint64_t dictionary_owner_hard);
 int16_t dxf_seqend_get_lineweight (DxfSeqend *seqend);
 DxfSeqend *dxf_seqend_set_lineweight (DxfSeqend *seqend, int16_t lineweight);
-char *dxf_seqend_get_plot_style_name (DxfSeqend *seqend);
-DxfSeqend *dxf_seqend_set_plot_style_name (DxfSeqend *seqend, char *plot_style_name);
+uint64_t dxf_seqend_get_plot_style_name (DxfSeqend *seqend);
+DxfSeqend *dxf_seqend_set_plot_style_name (DxfSeqend *seqend, uint64_t plot_style_name);
 long dxf_seqend_get_color_value (DxfSeqend *seqend);
 DxfSeqend *dxf_seqend_set_color_value (DxfSeqend *seqend, long color_value);
 char *dxf_seqend_get_color_name (DxfSeqend *seqend);
@@ -42,6 +42,7 @@
 
 
 #include "shape.h"
+#include "util.h"
 
 
 /*!
@@ -64,7 +65,7 @@ dxf_shape_new ()
         size = sizeof (DxfShape);
         /* avoid malloc of 0 bytes */
         if (size == 0) size = 1;
-        if ((shape = malloc (size)) == NULL)
+        if ((shape = dxf_malloc (size)) == NULL)
         {
                 fprintf (stderr,
                   (_("Error in %s () could not allocate memory for a DxfShape struct.\n")),
@@ -114,9 +115,9 @@ dxf_shape_init
                 __FUNCTION__);
               return (NULL);
         }
-        shape->id_code = 0;
-        shape->linetype = strdup (DXF_DEFAULT_LINETYPE);
-        shape->layer = strdup (DXF_DEFAULT_LAYER);
+        shape->id_code = DXF_HANDLE_NONE;
+        shape->linetype = dxf_strdup (DXF_DEFAULT_LINETYPE);
+        shape->layer = dxf_strdup (DXF_DEFAULT_LAYER);
         shape->elevation = 0.0;
         shape->thickness = 0.0;
         shape->linetype_scale = DXF_DEFAULT_LINETYPE_SCALE;
@@ -127,15 +128,17 @@ dxf_shape_init
         shape->shadow_mode = 0;
         shape->binary_graphics_data = dxf_binary_graphics_data_new ();
         shape->binary_graphics_data = dxf_binary_graphics_data_init (shape->binary_graphics_data);
-        shape->dictionary_owner_soft = strdup ("");
-        shape->material = strdup ("");
-        shape->dictionary_owner_hard = strdup ("");
+        shape->dictionary_owner_soft = 0;
+        shape->material = 0;
+        shape->dictionary_owner_hard = 0;
         shape->lineweight = 0;
-        shape->plot_style_name = strdup ("");
+        shape->plot_style_name = 0;
         shape->color_value = 0;
-        shape->color_name = strdup ("");
+        shape->color_name = dxf_strdup ("");
         shape->transparency = 0;
-        shape->shape_name = strdup ("");
+        shape->shape_name = dxf_strdup ("");
+        shape->p0 = (DxfPoint *) dxf_point_new ();
+        shape->p0 = dxf_point_init ((DxfPoint *) shape->p0);
         shape->p0->x0 = 0.0;
         shape->p0->y0 = 0.0;
         shape->p0->z0 = 0.0;
@@ -176,8 +179,9 @@ dxf_shape_read
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        char *temp_string = NULL;
-        char *dxf_entity_name = strdup ("SHAPE");
+        char temp_string[DXF_MAX_STRING_LENGTH];
+        int group_code;
+        char *dxf_entity_name = dxf_strdup ("SHAPE");
 
         /* Do some basic checks. */
         if (fp == NULL)
@@ -185,8 +189,6 @@ dxf_shape_read
                 fprintf (stderr,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
-                /* Clean up. */
-                free (temp_string);
                 return (NULL);
         }
         if (shape == NULL)
@@ -196,284 +198,226 @@ dxf_shape_read
                   __FUNCTION__);
                 shape = dxf_shape_init (shape);
         }
-        (fp->line_number)++;
-        fscanf (fp->fp, "%[^\n]", temp_string);
-        while (strcmp (temp_string, "0") != 0)
+        while ((dxf_read_group_code (fp, &group_code) == EXIT_SUCCESS)
+          && (group_code != 0))
         {
-                if (ferror (fp->fp))
+                if (dxf_read_error (fp))
                 {
                         fprintf (stderr,
                           (_("Error in %s () while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
-                        fclose (fp->fp);
-                        /* Clean up. */
-                        free (temp_string);
                         return (NULL);
                 }
-                if (strcmp (temp_string, "2") == 0)
-                {
-                        /* Now follows a string containing a shape
-                         * name. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, shape->shape_name);
-                }
-                else if (strcmp (temp_string, "5") == 0)
-                {
-                        /* Now follows a string containing a sequential
-                         * id number. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%x\n", (uint *) &shape->id_code);
-                }
-                else if (strcmp (temp_string, "6") == 0)
-                {
-                        /* Now follows a string containing a linetype
-                         * name. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, shape->linetype);
-                }
-                else if (strcmp (temp_string, "8") == 0)
-                {
-                        /* Now follows a string containing a layer name. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, shape->layer);
-                }
-                else if (strcmp (temp_string, "10") == 0)
-                {
-                        /* Now follows a string containing the
-                         * X-coordinate of the insertion point. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &shape->p0->x0);
-                }
-                else if (strcmp (temp_string, "20") == 0)
-                {
-                        /* Now follows a string containing the
-                         * Y-coordinate of the insertion point. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &shape->p0->y0);
-                }
-                else if (strcmp (temp_string, "30") == 0)
-                {
-                        /* Now follows a string containing the
-                         * Z-coordinate of the insertion point. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &shape->p0->z0);
-                }
-                else if (strcmp (temp_string, "38") == 0)
-                {
-                        /* Now follows a string containing the
-                         * elevation. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &shape->elevation);
-                }
-                else if (strcmp (temp_string, "39") == 0)
-                {
-                        /* Now follows a string containing the
-                         * thickness. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &shape->thickness);
-                }
-                else if (strcmp (temp_string, "40") == 0)
-                {
-                        /* Now follows a string containing the
-                         * size. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &shape->size);
-                }
-                else if (strcmp (temp_string, "41") == 0)
-                {
-                        /* Now follows a string containing the
-                         * relative X scale. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &shape->rel_x_scale);
-                }
-                else if (strcmp (temp_string, "48") == 0)
-                {
-                        /* Now follows a string containing the linetype
-                         * scale. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &shape->linetype_scale);
-                }
-                else if (strcmp (temp_string, "50") == 0)
-                {
-                        /* Now follows a string containing the
-                         * rotation angle. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &shape->rot_angle);
-                }
-                else if (strcmp (temp_string, "51") == 0)
-                {
-                        /* Now follows a string containing the
-                         * oblique angle. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &shape->obl_angle);
-                }
-                else if (strcmp (temp_string, "60") == 0)
-                {
-                        /* Now follows a string containing the
-                         * visibility value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%hd\n", &shape->visibility);
-                }
-                else if (strcmp (temp_string, "62") == 0)
-                {
-                        /* Now follows a string containing the
-                         * color value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%d\n", &shape->color);
-                }
-                else if (strcmp (temp_string, "67") == 0)
-                {
-                        /* Now follows a string containing the
-                         * paperspace value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%d\n", &shape->paperspace);
-                }
-                else if (strcmp (temp_string, "92") == 0)
-                {
-                        /* Now follows a string containing the
-                         * graphics data size value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%d\n", &shape->graphics_data_size);
-                }
-                else if ((fp->acad_version_number >= AutoCAD_13)
-                        && (strcmp (temp_string, "100") == 0))
+                switch (group_code)
                 {
-                        /* Now follows a string containing the
-                         * subclass marker value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
-                        if ((strcmp (temp_string, "AcDbEntity") != 0)
-                        && ((strcmp (temp_string, "AcDbShape") != 0)))
-                        {
+                        case 2:
+                                /* Now follows a string containing a shape
+                                 * name. */
+                                dxf_read_string (fp, &shape->shape_name);
+                                break;
+                        case 5:
+                                /* Now follows a string containing a sequential
+                                 * id number. */
+                                dxf_read_handle (fp, &shape->id_code);
+                                break;
+                        case 6:
+                                /* Now follows a string containing a linetype
+                                 * name. */
+                                dxf_read_string_interned (fp, &shape->linetype);
+                                break;
+                        case 8:
+                                /* Now follows a string containing a layer name. */
+                                dxf_read_string_interned (fp, &shape->layer);
+                                break;
+                        case 10:
+                                /* Now follows a string containing the
+                                 * X-coordinate of the insertion point. */
+                                dxf_read_double (fp, &shape->p0->x0);
+                                break;
+                        case 20:
+                                /* Now follows a string containing the
+                                 * Y-coordinate of the insertion point. */
+                                dxf_read_double (fp, &shape->p0->y0);
+                                break;
+                        case 30:
+                                /* Now follows a string containing the
+                                 * Z-coordinate of the insertion point. */
+                                dxf_read_double (fp, &shape->p0->z0);
+                                break;
+                        case 38:
+                                /* Now follows a string containing the
+                                 * elevation. */
+                                dxf_read_double (fp, &shape->elevation);
+                                break;
+                        case 39:
+                                /* Now follows a string containing the
+                                 * thickness. */
+                                dxf_read_double (fp, &shape->thickness);
+                                break;
+                        case 40:
+                                /* Now follows a string containing the
+                                 * size. */
+                                dxf_read_double (fp, &shape->size);
+                                break;
+                        case 41:
+                                /* Now follows a string containing the
+                                 * relative X scale. */
+                                dxf_read_double (fp, &shape->rel_x_scale);
+                                break;
+                        case 48:
+                                /* Now follows a string containing the linetype
+                                 * scale. */
+                                dxf_read_double (fp, &shape->linetype_scale);
+                                break;
+                        case 50:
+                                /* Now follows a string containing the
+                                 * rotation angle. */
+                                dxf_read_double (fp, &shape->rot_angle);
+                                break;
+                        case 51:
+                                /* Now follows a string containing the
+                                 * oblique angle. */
+                                dxf_read_double (fp, &shape->obl_angle);
+                                break;
+                        case 60:
+                                /* Now follows a string containing the
+                                 * visibility value. */
+                                dxf_read_int16 (fp, &shape->visibility);
+                                break;
+                        case 62:
+                                /* Now follows a string containing the
+                                 * color value. */
+                                dxf_read_int (fp, &shape->color);
+                                break;
+                        case 67:
+                                /* Now follows a string containing the
+                                 * paperspace value. */
+                                dxf_read_int (fp, &shape->paperspace);
+                                break;
+                        case 92:
+                                /* Now follows a string containing the
+                                 * graphics data size value. */
+                                dxf_read_int (fp, &shape->graphics_data_size);
+                                break;
+                        case 100:
+                                if (fp->acad_version_number >= AutoCAD_13)
+                                {
+                                        /* Now follows a string containing the
+                                         * subclass marker value. */
+                                        dxf_read_line (temp_string, fp);
+                                        if ((strcmp (temp_string, "AcDbEntity") != 0)
+                                        && ((strcmp (temp_string, "AcDbShape") != 0)))
+                                        {
+                                                fprintf (stderr,
+                                                  (_("Warning in %s () found a bad subclass marker in: %s in line: %d.\n")),
+                                                  __FUNCTION__, fp->filename, fp->line_number);
+                                        }
+                                }
+                                else
+                                {
+                                        fprintf (stderr,
+                                          (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
+                                          __FUNCTION__, fp->filename, fp->line_number);
+                                        /* Skip the value of the unknown group code. */
+                                        dxf_read_line (temp_string, fp);
+                                }
+                                break;
+                        case 210:
+                                /* Now follows a string containing the
+                                 * X-value of the extrusion vector. */
+                                dxf_read_double (fp, &shape->extr_x0);
+                                break;
+                        case 220:
+                                /* Now follows a string containing the
+                                 * Y-value of the extrusion vector. */
+                                dxf_read_double (fp, &shape->extr_y0);
+                                break;
+                        case 230:
+                                /* Now follows a string containing the
+                                 * Z-value of the extrusion vector. */
+                                dxf_read_double (fp, &shape->extr_z0);
+                                break;
+                        case 284:
+                                /* Now follows a string containing the shadow
+                                 * mode value. */
+                                dxf_read_int16 (fp, &shape->shadow_mode);
+                                break;
+                        case 310:
+                                /* Now follows a string containing binary
+                                 * graphics data. */
+                                dxf_read_string (fp, &shape->binary_graphics_data->data_line);
+                                dxf_binary_graphics_data_init ((DxfBinaryGraphicsData *) shape->binary_graphics_data->next);
+                                shape->binary_graphics_data = (DxfBinaryGraphicsData *) shape->binary_graphics_data->next;
+                                break;
+                        case 330:
+                                /* Now follows a string containing Soft-pointer
+                                 * ID/handle to owner dictionary. */
+                                dxf_read_handle (fp, &shape->dictionary_owner_soft);
+                                break;
+                        case 347:
+                                /* Now follows a string containing a
+                                 * hard-pointer ID/handle to material object. */
+                                dxf_read_handle (fp, &shape->material);
+                                break;
+                        case 360:
+                                /* Now follows a string containing Hard owner
+                                 * ID/handle to owner dictionary. */
+                                dxf_read_handle (fp, &shape->dictionary_owner_hard);
+                                break;
+                        case 370:
+                                /* Now follows a string containing the lineweight
+                                 * value. */
+                                dxf_read_int16 (fp, &shape->lineweight);
+                                break;
+                        case 390:
+                                /* Now follows a string containing a plot style
+                                 * name value. */
+                                dxf_read_handle (fp, &shape->plot_style_name);
+                                break;
+                        case 420:
+                                /* Now follows a string containing a color value. */
+                                dxf_read_long (fp, &shape->color_value);
+                                break;
+                        case 430:
+                                /* Now follows a string containing a color
+                                 * name value. */
+                                dxf_read_string_interned (fp, &shape->color_name);
+                                break;
+                        case 440:
+                                /* Now follows a string containing a transparency
+                                 * value. */
+                                dxf_read_long (fp, &shape->transparency);
+                                break;
+                        case 999:
+                                /* Now follows a string containing a comment. */
+                                dxf_read_line (temp_string, fp);
+                                fprintf (stdout, "DXF comment: %s\n", temp_string);
+                                break;
+                        default:
                                 fprintf (stderr,
-                                  (_("Warning in %s () found a bad subclass marker in: %s in line: %d.\n")),
+                                  (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
                                   __FUNCTION__, fp->filename, fp->line_number);
-                        }
-                }
-                else if (strcmp (temp_string, "210") == 0)
-                {
-                        /* Now follows a string containing the
-                         * X-value of the extrusion vector. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &shape->extr_x0);
-                }
-                else if (strcmp (temp_string, "220") == 0)
-                {
-                        /* Now follows a string containing the
-                         * Y-value of the extrusion vector. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &shape->extr_y0);
-                }
-                else if (strcmp (temp_string, "230") == 0)
-                {
-                        /* Now follows a string containing the
-                         * Z-value of the extrusion vector. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &shape->extr_z0);
-                }
-                else if (strcmp (temp_string, "284") == 0)
-                {
-                        /* Now follows a string containing the shadow
-                         * mode value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%hd\n", &shape->shadow_mode);
-                }
-                else if (strcmp (temp_string, "310") == 0)
-                {
-                        /* Now follows a string containing binary
-                         * graphics data. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, shape->binary_graphics_data->data_line);
-                        dxf_binary_graphics_data_init ((DxfBinaryGraphicsData *) shape->binary_graphics_data->next);
-                        shape->binary_graphics_data = (DxfBinaryGraphicsData *) shape->binary_graphics_data->next;
-                }
-                else if (strcmp (temp_string, "330") == 0)
-                {
-                        /* Now follows a string containing Soft-pointer
-                         * ID/handle to owner dictionary. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, shape->dictionary_owner_soft);
-                }
-                else if (strcmp (temp_string, "347") == 0)
-                {
-                        /* Now follows a string containing a
-                         * hard-pointer ID/handle to material object. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, shape->material);
-                }
-                else if (strcmp (temp_string, "360") == 0)
-                {
-                        /* Now follows a string containing Hard owner
-                         * ID/handle to owner dictionary. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, shape->dictionary_owner_hard);
-                }
-                else if (strcmp (temp_string, "370") == 0)
-                {
-                        /* Now follows a string containing the lineweight
-                         * value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%hd\n", &shape->lineweight);
-                }
-                else if (strcmp (temp_string, "390") == 0)
-                {
-                        /* Now follows a string containing a plot style
-                         * name value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, shape->plot_style_name);
-                }
-                else if (strcmp (temp_string, "420") == 0)
-                {
-                        /* Now follows a string containing a color value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%ld\n", &shape->color_value);
-                }
-                else if (strcmp (temp_string, "430") == 0)
-                {
-                        /* Now follows a string containing a color
-                         * name value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, shape->color_name);
-                }
-                else if (strcmp (temp_string, "440") == 0)
-                {
-                        /* Now follows a string containing a transparency
-                         * value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%ld\n", &shape->transparency);
-                }
-                else if (strcmp (temp_string, "999") == 0)
-                {
-                        /* Now follows a string containing a comment. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
-                        fprintf (stdout, "DXF comment: %s\n", temp_string);
-                }
-                else
-                {
-                        fprintf (stderr,
-                          (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
-                          __FUNCTION__, fp->filename, fp->line_number);
+                                /* Skip the value of the unknown group code. */
+                                dxf_read_line (temp_string, fp);
+                                break;
                 }
         }
         /* Handle omitted members and/or illegal values. */
         if (strcmp (shape->shape_name, "") == 0)
         {
                 fprintf (stderr,
-                  (_("Error in %s () empty name string for the %s entity with id-code: %x\n")),
+                  (_("Error in %s () empty name string for the %s entity with id-code: %" PRIx64 "\n")),
                   __FUNCTION__, dxf_entity_name, shape->id_code);
                 return (NULL);
         }
         if (strcmp (shape->linetype, "") == 0)
         {
-                shape->linetype = strdup (DXF_DEFAULT_LINETYPE);
+                shape->linetype = dxf_strdup (DXF_DEFAULT_LINETYPE);
         }
         if (strcmp (shape->layer, "") == 0)
         {
-                shape->layer = strdup (DXF_DEFAULT_LAYER);
+                shape->layer = dxf_strdup (DXF_DEFAULT_LAYER);
         }
-        /* Clean up. */
-        free (temp_string);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -499,7 +443,7 @@ dxf_shape_write
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        char *dxf_entity_name = strdup ("SHAPE");
+        char *dxf_entity_name = dxf_strdup ("SHAPE");
 
         /* Do some basic checks. */
         if (fp == NULL)
@@ -508,7 +452,7 @@ dxf_shape_write
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (shape == NULL)
@@ -517,55 +461,55 @@ dxf_shape_write
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (strcmp (shape->shape_name, "") == 0)
         {
                 fprintf (stderr,
-                  (_("Error in %s () empty name string for the %s entity with id-code: %x\n")),
+                  (_("Error in %s () empty name string for the %s entity with id-code: %" PRIx64 "\n")),
                   __FUNCTION__, dxf_entity_name, shape->id_code);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (strcmp (shape->linetype, "") == 0)
         {
                 fprintf (stderr,
-                  (_("Warning in %s () empty linetype string for the %s entity with id-code: %x\n")),
+                  (_("Warning in %s () empty linetype string for the %s entity with id-code: %" PRIx64 "\n")),
                   __FUNCTION__, dxf_entity_name, shape->id_code);
                 fprintf (stderr,
                   (_("\t%s entity is reset to default linetype")),
                   dxf_entity_name);
-                shape->linetype = strdup (DXF_DEFAULT_LINETYPE);
+                shape->linetype = dxf_strdup (DXF_DEFAULT_LINETYPE);
         }
         if (strcmp (shape->layer, "") == 0)
         {
                 fprintf (stderr,
-                  (_("Warning in %s () empty layer string for the %s entity with id-code: %x\n")),
+                  (_("Warning in %s () empty layer string for the %s entity with id-code: %" PRIx64 "\n")),
                   __FUNCTION__, dxf_entity_name, shape->id_code);
                 fprintf (stderr,
                   (_("\t%s entity is relocated to layer 0")),
                   dxf_entity_name);
-                shape->layer = strdup (DXF_DEFAULT_LAYER);
+                shape->layer = dxf_strdup (DXF_DEFAULT_LAYER);
         }
         if (shape->size == 0.0)
         {
                 fprintf (stderr,
-                  (_("Warning in %s () size has a value of 0.0 for the %s entity with id-code: %x\n")),
+                  (_("Warning in %s () size has a value of 0.0 for the %s entity with id-code: %" PRIx64 "\n")),
                   __FUNCTION__, dxf_entity_name, shape->id_code);
         }
         if (shape->rel_x_scale == 0.0)
         {
                 fprintf (stderr,
-                  (_("Warning: in %s () relative X-scale factor has a value of 0.0 for the %s entity with id-code: %x\n")),
+                  (_("Warning: in %s () relative X-scale factor has a value of 0.0 for the %s entity with id-code: %" PRIx64 "\n")),
                   __FUNCTION__, dxf_entity_name, shape->id_code);
         }
         /* Start writing output. */
-        fprintf (fp->fp, "  0\n%s\n", dxf_entity_name);
-        if (shape->id_code != -1)
+        dxf_write_string (fp, 0, dxf_entity_name);
+        if (shape->id_code != DXF_HANDLE_NONE)
         {
-                fprintf (fp->fp, "  5\n%x\n", shape->id_code);
+                dxf_write_hex (fp, 5, shape->id_code);
         }
         /*!
          * \todo for version R14.\n
@@ -577,72 +521,72 @@ dxf_shape_write
          * 102 groups are application defined (optional).\n\n
          * End of group, "}" (optional), with Group code 102.
          */
-        if ((strcmp (shape->dictionary_owner_soft, "") != 0)
+        if ((shape->dictionary_owner_soft != 0)
           && (fp->acad_version_number >= AutoCAD_14))
         {
-                fprintf (fp->fp, "102\n{ACAD_REACTORS\n");
-                fprintf (fp->fp, "330\n%s\n", shape->dictionary_owner_soft);
-                fprintf (fp->fp, "102\n}\n");
+                dxf_write_string (fp, 102, "{ACAD_REACTORS");
+                dxf_write_hex (fp, 330, shape->dictionary_owner_soft);
+                dxf_write_string (fp, 102, "}");
         }
-        if ((strcmp (shape->dictionary_owner_hard, "") != 0)
+        if ((shape->dictionary_owner_hard != 0)
           && (fp->acad_version_number >= AutoCAD_14))
         {
-                fprintf (fp->fp, "102\n{ACAD_XDICTIONARY\n");
-                fprintf (fp->fp, "360\n%s\n", shape->dictionary_owner_hard);
-                fprintf (fp->fp, "102\n}\n");
+                dxf_write_string (fp, 102, "{ACAD_XDICTIONARY");
+                dxf_write_hex (fp, 360, shape->dictionary_owner_hard);
+                dxf_write_string (fp, 102, "}");
         }
         if (fp->acad_version_number >= AutoCAD_13)
         {
-                fprintf (fp->fp, "100\nAcDbEntity\n");
+                dxf_write_string (fp, 100, "AcDbEntity");
         }
         if (shape->paperspace == DXF_PAPERSPACE)
         {
-                fprintf (fp->fp, " 67\n%d\n", (int16_t) DXF_PAPERSPACE);
+                dxf_write_int (fp, 67, (int16_t) DXF_PAPERSPACE);
         }
-        fprintf (fp->fp, "  8\n%s\n", shape->layer);
+        dxf_write_string (fp, 8, shape->layer);
         if (strcmp (shape->linetype, DXF_DEFAULT_LINETYPE) != 0)
         {
-                fprintf (fp->fp, "  6\n%s\n", shape->linetype);
+                dxf_write_string (fp, 6, shape->linetype);
         }
         if ((fp->acad_version_number >= AutoCAD_2008)
-          && (strcmp (shape->material, "") != 0))
+          && (shape->material != 0))
         {
-                fprintf (fp->fp, "347\n%s\n", shape->material);
+                dxf_write_hex (fp, 347, shape->material);
         }
         if (shape->color != DXF_COLOR_BYLAYER)
         {
-                fprintf (fp->fp, " 62\n%d\n", shape->color);
+                dxf_write_int (fp, 62, shape->color);
         }
         if (fp->acad_version_number >= AutoCAD_2002)
         {
-                fprintf (fp->fp, "370\n%d\n", shape->lineweight);
+                dxf_write_int (fp, 370, shape->lineweight);
         }
         if ((fp->acad_version_number <= AutoCAD_11)
           && DXF_FLATLAND
           && (shape->elevation != 0.0))
         {
-                fprintf (fp->fp, " 38\n%f\n", shape->elevation);
+                dxf_write_double (fp, 38, shape->elevation);
         }
         if ((fp->acad_version_number <= AutoCAD_13)
           && (shape->thickness != 0.0))
         {
-                fprintf (fp->fp, " 39\n%f\n", shape->thickness);
+                dxf_write_double (fp, 39, shape->thickness);
         }
         if (shape->linetype_scale != 1.0)
         {
-                fprintf (fp->fp, " 48\n%f\n", shape->linetype_scale);
+                dxf_write_double (fp, 48, shape->linetype_scale);
         }
         if (shape->visibility != 0)
         {
-                fprintf (fp->fp, " 60\n%d\n", shape->visibility);
+                dxf_write_int (fp, 60, shape->visibility);
         }
         if ((fp->acad_version_number >= AutoCAD_2000)
           && (shape->graphics_data_size > 0))
         {
 #ifdef BUILD_64
-                fprintf (fp->fp, "160\n%d\n", shape->graphics_data_size);
+                dxf_write_int (fp, 160, shape->graphics_data_size);
 #else
-                fprintf (fp->fp, " 92\n%d\n", shape->graphics_data_size);
+                dxf_write_int (fp, 92, shape->graphics_data_size);
 #endif
                 if (shape->binary_graphics_data != NULL)
                 {
@@ -650,58 +594,58 @@ dxf_shape_write
                         iter = (DxfBinaryGraphicsData *) shape->binary_graphics_data;
                         while (iter != NULL)
                         {
-                                fprintf (fp->fp, "310\n%s\n", dxf_binary_graphics_data_get_data_line (iter));
+                                dxf_write_string (fp, 310, dxf_binary_graphics_data_get_data_line (iter));
                                 iter = (DxfBinaryGraphicsData *) dxf_binary_graphics_data_get_next (iter);
                         }
                 }
         }
         if (fp->acad_version_number >= AutoCAD_2004)
         {
-                fprintf (fp->fp, "420\n%ld\n", shape->color_value);
-                fprintf (fp->fp, "430\n%s\n", shape->color_name);
-                fprintf (fp->fp, "440\n%ld\n", shape->transparency);
+                dxf_write_int (fp, 420, shape->color_value);
+                dxf_write_string (fp, 430, shape->color_name);
+                dxf_write_int (fp, 440, shape->transparency);
         }
         if (fp->acad_version_number >= AutoCAD_2009)
         {
-                fprintf (fp->fp, "390\n%s\n", shape->plot_style_name);
-                fprintf (fp->fp, "284\n%d\n", shape->shadow_mode);
+                dxf_write_hex (fp, 390, shape->plot_style_name);
+                dxf_write_int (fp, 284, shape->shadow_mode);
         }
         if (fp->acad_version_number >= AutoCAD_13)
         {
-                fprintf (fp->fp, "100\nAcDbShape\n");
+                dxf_write_string (fp, 100, "AcDbShape");
         }
         if (shape->thickness != 0.0)
         {
-                fprintf (fp->fp, " 39\n%f\n", shape->thickness);
+                dxf_write_double (fp, 39, shape->thickness);
         }
-        fprintf (fp->fp, " 10\n%f\n", shape->x0);
-        fprintf (fp->fp, " 20\n%f\n", shape->y0);
-        fprintf (fp->fp, " 30\n%f\n", shape->z0);
-        fprintf (fp->fp, " 40\n%f\n", shape->size);
-        fprintf (fp->fp, "  2\n%s\n", shape->shape_name);
+        dxf_write_double (fp, 10, shape->x0);
+        dxf_write_double (fp, 20, shape->y0);
+        dxf_write_double (fp, 30, shape->z0);
+        dxf_write_double (fp, 40, shape->size);
+        dxf_write_string (fp, 2, shape->shape_name);
         if (shape->rot_angle != 0.0)
         {
-                fprintf (fp->fp, " 50\n%f\n", shape->rot_angle);
+                dxf_write_double (fp, 50, shape->rot_angle);
         }
         if (shape->rel_x_scale != 1.0)
         {
-                fprintf (fp->fp, " 41\n%f\n", shape->rel_x_scale);
+                dxf_write_double (fp, 41, shape->rel_x_scale);
         }
         if (shape->obl_angle != 0.0)
         {
-                fprintf (fp->fp, " 51\n%f\n", shape->obl_angle);
+                dxf_write_double (fp, 51, shape->obl_angle);
         }
         if ((fp->acad_version_number >= AutoCAD_12)
                 && (shape->extr_x0 != 0.0)
                 && (shape->extr_y0 != 0.0)
                 && (shape->extr_z0 != 1.0))
         {
-                fprintf (fp->fp, "210\n%f\n", shape->extr_x0);
-                fprintf (fp->fp, "220\n%f\n", shape->extr_y0);
-                fprintf (fp->fp, "230\n%f\n", shape->extr_z0);
+                dxf_write_double (fp, 210, shape->extr_x0);
+                dxf_write_double (fp, 220, shape->extr_y0);
+                dxf_write_double (fp, 230, shape->extr_z0);
         }
         /* Clean up. */
-        free (dxf_entity_name);
+        dxf_free (dxf_entity_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -742,17 +686,13 @@ dxf_shape_free
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        free (shape->linetype);
-        free (shape->layer);
+        dxf_string_free (shape->linetype);
+        dxf_string_free (shape->layer);
         dxf_binary_graphics_data_free_list (shape->binary_graphics_data);
-        free (shape->dictionary_owner_soft);
-        free (shape->material);
-        free (shape->dictionary_owner_hard);
-        free (shape->plot_style_name);
-        free (shape->color_name);
-        free (shape->shape_name);
+        dxf_string_free (shape->color_name);
+        dxf_free (shape->shape_name);
         dxf_point_free (shape->p0);
-        free (shape);
+        dxf_free (shape);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -798,7 +738,7 @@ dxf_shape_free_list
  *
  * \return \c id_code.
  */
-int
+uint64_t
 dxf_shape_get_id_code
 (
         DxfShape *shape
@@ -816,12 +756,6 @@ dxf_shape_get_id_code
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (shape->id_code < 0)
-        {
-                fprintf (stderr,
-                  (_("Warning in %s () a negative value was found.\n")),
-                  __FUNCTION__);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -837,7 +771,7 @@ dxf_shape_set_id_code
 (
         DxfShape *shape,
                 /*!< a pointer to a DXF \c SHAPE entity. */
-        int id_code
+        uint64_t id_code
                 /*!< the \c id_code to be set for the entity.\n
                  * This is to be an unique (sequential) number in the
                  * DXF file. */
@@ -854,12 +788,6 @@ dxf_shape_set_id_code
                   __FUNCTION__);
                 return (NULL);
         }
-        if (id_code < 0)
-        {
-                fprintf (stderr,
-                  (_("Warning in %s () a negative value was passed.\n")),
-                  __FUNCTION__);
-        }
         shape->id_code = id_code;
 #if DEBUG
         DXF_DEBUG_END
@@ -901,7 +829,7 @@ dxf_shape_get_linetype
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (shape->linetype));
+        return (dxf_strdup (shape->linetype));
 }
 
 
@@ -936,7 +864,7 @@ dxf_shape_set_linetype
                   __FUNCTION__);
                 return (NULL);
         }
-        shape->linetype = strdup (linetype);
+        shape->linetype = dxf_strdup (linetype);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -977,7 +905,7 @@ dxf_shape_get_layer
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (shape->layer));
+        return (dxf_strdup (shape->layer));
 }
 
 
@@ -1012,7 +940,7 @@ dxf_shape_set_layer
                   __FUNCTION__);
                 return (NULL);
         }
-        shape->layer = strdup (layer);
+        shape->layer = dxf_strdup (layer);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1737,11 +1665,9 @@ dxf_shape_set_binary_graphics_data
  * \brief Get the pointer to the \c dictionary_owner_soft from a DXF 
  * \c SHAPE entity.
  *
- * \return pointer to the \c dictionary_owner_soft.
- *
- * \warning No checks are performed on the returned pointer (string).
+ * \return the handle of the \c dictionary_owner_soft.
  */
-char *
+uint64_t
 dxf_shape_get_dictionary_owner_soft
 (
         DxfShape *shape
@@ -1757,19 +1683,12 @@ dxf_shape_get_dictionary_owner_soft
                 fprintf (stderr,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
-                return (NULL);
-        }
-        if (shape->dictionary_owner_soft ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
+                return (0);
         }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (shape->dictionary_owner_soft));
+        return (shape->dictionary_owner_soft);
 }
 
 
@@ -1782,8 +1701,8 @@ dxf_shape_set_dictionary_owner_soft
 (
         DxfShape *shape,
                 /*!< a pointer to a DXF \c SHAPE entity. */
-        char *dictionary_owner_soft
-                /*!< a string containing the pointer to the \c
+        uint64_t dictionary_owner_soft
+                /*!< the handle of the \c
                  * dictionary_owner_soft for the entity. */
 )
 {
@@ -1798,14 +1717,7 @@ dxf_shape_set_dictionary_owner_soft
                   __FUNCTION__);
                 return (NULL);
         }
-        if (dictionary_owner_soft == NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was passed.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
-        shape->dictionary_owner_soft = strdup (dictionary_owner_soft);
+        shape->dictionary_owner_soft = dictionary_owner_soft;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1816,12 +1728,10 @@ dxf_shape_set_dictionary_owner_soft
 /*!
  * \brief Get the pointer to the \c material from a DXF \c SHAPE entity.
  *
- * \return a pointer to \c material when successful, or \c NULL when an
+ * \return the handle \c material when successful, or 0 when an
  * error occurred.
- *
- * \warning No checks are performed on the returned pointer.
  */
-char *
+uint64_t
 dxf_shape_get_material
 (
         DxfShape *shape
@@ -1837,19 +1747,12 @@ dxf_shape_get_material
                 fprintf (stderr,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
-                return (NULL);
-        }
-        if (shape->material ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
+                return (0);
         }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (shape->material));
+        return (shape->material);
 }
 
 
@@ -1864,8 +1767,8 @@ dxf_shape_set_material
 (
         DxfShape *shape,
                 /*!< a pointer to a DXF \c SHAPE entity. */
-        char *material
-                /*!< a string containing the pointer to the \c
+        uint64_t material
+                /*!< the handle of the \c
                  * material for the entity. */
 )
 {
@@ -1880,14 +1783,7 @@ dxf_shape_set_material
                   __FUNCTION__);
                 return (NULL);
         }
-        if (material == NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was passed.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
-        shape->material = strdup (material);
+        shape->material = material;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1899,11 +1795,9 @@ dxf_shape_set_material
  * \brief Get the pointer to the \c dictionary_owner_hard from a DXF 
  * \c SHAPE entity.
  *
- * \return pointer to the \c dictionary_owner_hard.
- *
- * \warning No checks are performed on the returned pointer (string).
+ * \return the handle of the \c dictionary_owner_hard.
  */
-char *
+uint64_t
 dxf_shape_get_dictionary_owner_hard
 (
         DxfShape *shape
@@ -1919,19 +1813,12 @@ dxf_shape_get_dictionary_owner_hard
                 fprintf (stderr,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
-                return (NULL);
-        }
-        if (shape->dictionary_owner_hard ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
+                return (0);
         }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (shape->dictionary_owner_hard));
+        return (shape->dictionary_owner_hard);
 }
 
 
@@ -1944,8 +1831,8 @@ dxf_shape_set_dictionary_owner_hard
 (
         DxfShape *shape,
                 /*!< a pointer to a DXF \c SHAPE entity. */
-        char *dictionary_owner_hard
-                /*!< a string containing the pointer to the \c
+        uint64_t dictionary_owner_hard
+                /*!< the handle of the \c
                  * dictionary_owner_hard for the entity. */
 )
 {
@@ -1960,14 +1847,7 @@ dxf_shape_set_dictionary_owner_hard
                   __FUNCTION__);
                 return (NULL);
         }
-        if (dictionary_owner_hard == NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was passed.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
-        shape->dictionary_owner_hard = strdup (dictionary_owner_hard);
+        shape->dictionary_owner_hard = dictionary_owner_hard;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2043,10 +1923,10 @@ dxf_shape_set_lineweight
 /*!
  * \brief Get the \c plot_style_name from a DXF \c SHAPE entity.
  *
- * \return a pointer to \c plot_style_name when sucessful, or \c NULL
+ * \return the handle \c plot_style_name when sucessful, or 0
  * when an error occurred.
  */
-char *
+uint64_t
 dxf_shape_get_plot_style_name
 (
         DxfShape *shape
@@ -2062,19 +1942,12 @@ dxf_shape_get_plot_style_name
                 fprintf (stderr,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
-                return (NULL);
-        }
-        if (shape->plot_style_name ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
+                return (0);
         }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (shape->plot_style_name));
+        return (shape->plot_style_name);
 }
 
 
@@ -2089,7 +1962,7 @@ dxf_shape_set_plot_style_name
 (
         DxfShape *shape,
                 /*!< a pointer to a DXF \c SHAPE entity. */
-        char *plot_style_name
+        uint64_t plot_style_name
                 /*!< a string containing the \c plot_style_name for the
                  * entity. */
 )
@@ -2105,14 +1978,7 @@ dxf_shape_set_plot_style_name
                   __FUNCTION__);
                 return (NULL);
         }
-        if (plot_style_name == NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was passed.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
-        shape->plot_style_name = strdup (plot_style_name);
+        shape->plot_style_name = plot_style_name;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2219,7 +2085,7 @@ dxf_shape_get_color_name
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (shape->color_name));
+        return (dxf_strdup (shape->color_name));
 }
 
 
@@ -2257,7 +2123,7 @@ dxf_shape_set_color_name
                   __FUNCTION__);
                 return (NULL);
         }
-        shape->color_name = strdup (color_name);
+        shape->color_name = dxf_strdup (color_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -60,7 +60,7 @@ typedef struct
 dxf_shape_struct
 {
         /* Members common for all DXF drawable entities. */
-        int id_code;
+        uint64_t id_code;
                 /*!< Identification number for the entity.\n
                  * This is to be an unique (sequential) number in the DXF
                  * file.\n
@@ -133,16 +133,16 @@ dxf_shape_struct
                  * (optional).\n
                  * Group code = 310.\n
                  * \since Introduced in version R2000. */
-        char *dictionary_owner_soft;
+        uint64_t dictionary_owner_soft;
                 /*!< Soft-pointer ID/handle to owner dictionary (optional).\n
                  * Group code = 330.\n
                  * \since Introduced in version R14. */
-        char *material;
+        uint64_t material;
                 /*!< Hard-pointer ID/handle to material object (present if
                  * not BYLAYER).\n
                  * Group code = 347.\n
                  * \since Introduced in version R2008. */
-        char *dictionary_owner_hard;
+        uint64_t dictionary_owner_hard;
                 /*!< Hard owner ID/handle to owner dictionary (optional).\n
                  * Group code = 360.\n
                  * \since Introduced in version R14. */
@@ -151,7 +151,7 @@ dxf_shape_struct
                  * Stored and moved around as a 16-bit integer.\n
                  * Group code = 370.\n
                  * \since Introduced in version R2002. */
-        char *plot_style_name;
+        uint64_t plot_style_name;
                 /*!< Hard pointer ID / handle of PlotStyleName object.\n
                  * Group code = 390.\n
                  * \since Introduced in version R2009. */
@@ -235,8 +235,8 @@ DxfShape *dxf_shape_read (DxfFile *fp, DxfShape *shape);
 int dxf_shape_write (DxfFile *fp, DxfShape *shape);
 int dxf_shape_free (DxfShape *shape);
 void dxf_shape_free_list (DxfShape *shapes);
-int dxf_shape_get_id_code (DxfShape *shape);
-DxfShape *dxf_shape_set_id_code (DxfShape *shape, int id_code);
+uint64_t dxf_shape_get_id_code (DxfShape *shape);
+DxfShape *dxf_shape_set_id_code (DxfShape *shape, uint64_t id_code);
 char *dxf_shape_get_linetype (DxfShape *shape);
 DxfShape *dxf_shape_set_linetype (DxfShape *shape, char *linetype);
 char *dxf_shape_get_layer (DxfShape *shape);
@@ -259,16 +259,16 @@ int16_t dxf_shape_get_shadow_mode (DxfShape *shape);
 DxfShape *dxf_shape_set_shadow_mode (DxfShape *shape, int16_t shadow_mode);
 DxfBinaryGraphicsData *dxf_shape_get_binary_graphics_data (DxfShape *shape);
 DxfShape *dxf_shape_set_binary_graphics_data (DxfShape *shape, DxfBinaryGraphicsData *data);
-char *dxf_shape_get_dictionary_owner_soft (DxfShape *shape);
-DxfShape *dxf_shape_set_dictionary_owner_soft (DxfShape *shape, char *dictionary_owner_soft);
-char *dxf_shape_get_material (DxfShape *shape);
-DxfShape *dxf_shape_set_material (DxfShape *shape, char *material);
-char *dxf_shape_get_dictionary_owner_hard (DxfShape *shape);
-DxfShape *dxf_shape_set_dictionary_owner_hard (DxfShape *shape, char *dictionary_owner_hard);
+uint64_t dxf_shape_get_dictionary_owner_soft (DxfShape *shape);
+DxfShape *dxf_shape_set_dictionary_owner_soft (DxfShape *shape, uint64_t dictionary_owner_soft);
+uint64_t dxf_shape_get_material (DxfShape *shape);
+DxfShape *dxf_shape_set_material (DxfShape *shape, uint64_t material);
+uint64_t dxf_shape_get_dictionary_owner_hard (DxfShape *shape);
+DxfShape *dxf_shape_set_dictionary_owner_hard (DxfShape *shape, uint64_t dictionary_owner_hard);
 int16_t dxf_shape_get_lineweight (DxfShape *shape);
 DxfShape *dxf_shape_set_lineweight (DxfShape *shape, int16_t lineweight);
-char *dxf_shape_get_plot_style_name (DxfShape *shape);
-DxfShape *dxf_shape_set_plot_style_name (DxfShape *shape, char *plot_style_name);
+uint64_t dxf_shape_get_plot_style_name (DxfShape *shape);
+DxfShape *dxf_shape_set_plot_style_name (DxfShape *shape, uint64_t plot_style_name);
 long dxf_shape_get_color_value (DxfShape *shape);
 DxfShape *dxf_shape_set_color_value (DxfShape *shape, long color_value);
 char *dxf_shape_get_color_name (DxfShape *shape);
@@ -53,6 +53,7 @@
 #include "global.h"
 #include "point.h"
 #include "binary_graphics_data.h"
+#include "transform.h"
 
 
 #ifdef __cplusplus
@@ -70,7 +71,7 @@ typedef struct
 dxf_solid_struct
 {
         /* Members common for all DXF drawable entities. */
-        int id_code;
+        uint64_t id_code;
                 /*!< Identification number for the entity.\n
                  * This is to be an unique (sequential) number in the DXF
                  * file.\n
@@ -143,20 +144,20 @@ dxf_solid_struct
                  * (optional).\n
                  * Group code = 310.\n
                  * \since Introduced in version R2000. */
-        char *dictionary_owner_soft;
+        uint64_t dictionary_owner_soft;
                 /*!< Soft-pointer ID/handle to owner dictionary (optional).\n
                  * Group code = 330.\n
                  * \since Introduced in version R14. */
-        char *object_owner_soft;
+        uint64_t object_owner_soft;
                 /*!< Soft-pointer ID/handle  to owner BLOCK_RECORD object.\n
                  * Group code = 330.\n
                  * \since Introduced in version R2000. */
-        char *material;
+        uint64_t material;
                 /*!< Hard-pointer ID/handle to material object (present if
                  * not BYLAYER).\n
                  * Group code = 347.\n
                  * \since Introduced in version R2008. */
-        char *dictionary_owner_hard;
+        uint64_t dictionary_owner_hard;
                 /*!< Hard owner ID/handle to owner dictionary (optional).\n
                  * Group code = 360.\n
                  * \since Introduced in version R14. */
@@ -165,7 +166,7 @@ dxf_solid_struct
                  * Stored and moved around as a 16-bit integer.\n
                  * Group code = 370.\n
                  * \since Introduced in version R2002. */
-        char *plot_style_name;
+        uint64_t plot_style_name;
                 /*!< Hard pointer ID / handle of PlotStyleName object.\n
                  * Group code = 390.\n
                  * \since Introduced in version R2009. */
@@ -271,8 +272,8 @@ DxfSolid *dxf_solid_read (DxfFile *fp, DxfSolid *solid);
 int dxf_solid_write (DxfFile *fp, DxfSolid *solid);
 int dxf_solid_free (DxfSolid *solid);
 void dxf_solid_free_list (DxfSolid *solids);
-int dxf_solid_get_id_code (DxfSolid *solid);
-DxfSolid *dxf_solid_set_id_code (DxfSolid *solid, int id_code);
+uint64_t dxf_solid_get_id_code (DxfSolid *solid);
+DxfSolid *dxf_solid_set_id_code (DxfSolid *solid, uint64_t id_code);
 char *dxf_solid_get_linetype (DxfSolid *solid);
 DxfSolid *dxf_solid_set_linetype (DxfSolid *solid, char *linetype);
 char *dxf_solid_get_layer (DxfSolid *solid);
@@ -295,18 +296,18 @@ int16_t dxf_solid_get_shadow_mode (DxfSolid *solid);
 DxfSolid *dxf_solid_set_shadow_mode (DxfSolid *solid, int16_t shadow_mode);
 DxfBinaryGraphicsData *dxf_solid_get_binary_graphics_data (DxfSolid *solid);
 DxfSolid *dxf_solid_set_binary_graphics_data (DxfSolid *solid, DxfBinaryGraphicsData *data);
-char *dxf_solid_get_dictionary_owner_soft (DxfSolid *solid);
-DxfSolid *dxf_solid_set_dictionary_owner_soft (DxfSolid *solid, char *dictionary_owner_soft);
-char *dxf_solid_get_object_owner_soft (DxfSolid *solid);
-DxfSolid *dxf_solid_set_object_owner_soft (DxfSolid *solid, char *object_owner_soft);
-char *dxf_solid_get_material (DxfSolid *solid);
-DxfSolid *dxf_solid_set_material (DxfSolid *solid, char *material);
-char *dxf_solid_get_dictionary_owner_hard (DxfSolid *solid);
-DxfSolid *dxf_solid_set_dictionary_owner_hard (DxfSolid *solid, char *dictionary_owner_hard);
+uint64_t dxf_solid_get_dictionary_owner_soft (DxfSolid *solid);
+DxfSolid *dxf_solid_set_dictionary_owner_soft (DxfSolid *solid, uint64_t dictionary_owner_soft);
+uint64_t dxf_solid_get_object_owner_soft (DxfSolid *solid);
+DxfSolid *dxf_solid_set_object_owner_soft (DxfSolid *solid, uint64_t object_owner_soft);
+uint64_t dxf_solid_get_material (DxfSolid *solid);
+DxfSolid *dxf_solid_set_material (DxfSolid *solid, uint64_t material);
+uint64_t dxf_solid_get_dictionary_owner_hard (DxfSolid *solid);
+DxfSolid *dxf_solid_set_dictionary_owner_hard (DxfSolid *solid, uint64_t dictionary_owner_hard);
 int16_t dxf_solid_get_lineweight (DxfSolid *solid);
 DxfSolid *dxf_solid_set_lineweight (DxfSolid *solid, int16_t lineweight);
-char *dxf_solid_get_plot_style_name (DxfSolid *solid);
-DxfSolid *dxf_solid_set_plot_style_name (DxfSolid *solid, char *plot_style_name);
+uint64_t dxf_solid_get_plot_style_name (DxfSolid *solid);
+DxfSolid *dxf_solid_set_plot_style_name (DxfSolid *solid, uint64_t plot_style_name);
 long dxf_solid_get_color_value (DxfSolid *solid);
 DxfSolid *dxf_solid_set_color_value (DxfSolid *solid, long color_value);
 char *dxf_solid_get_color_name (DxfSolid *solid);
@@ -357,6 +358,8 @@ DxfSolid *dxf_solid_set_extr_z0 (DxfSolid *solid, double extr_z0);
 DxfSolid *dxf_solid_get_next (DxfSolid *solid);
 DxfSolid *dxf_solid_set_next (DxfSolid *solid, DxfSolid *next);
 DxfSolid *dxf_solid_get_last (DxfSolid *solid);
+int dxf_solid_get_bbox (DxfSolid *solid, DxfBbox *bbox);
+int dxf_solid_transform (DxfSolid *solid, DxfTransform *transform);
 
 
 #ifdef __cplusplus
@@ -70,7 +70,7 @@ dxf_sortentstable_new ()
         size = sizeof (DxfSortentsTable);
         /* avoid malloc of 0 bytes */
         if (size == 0) size = 1;
-        if ((sortentstable = malloc (size)) == NULL)
+        if ((sortentstable = dxf_malloc (size)) == NULL)
         {
                 fprintf (stderr,
                   (_("Error in %s () could not allocate memory for a DxfSortentsTable struct.\n")),
@@ -120,10 +120,10 @@ dxf_sortentstable_init
                   __FUNCTION__);
                 return (NULL);
         }
-        sortentstable->id_code = 0;
-        sortentstable->dictionary_owner_soft = strdup ("");
-        sortentstable->dictionary_owner_hard = strdup ("");
-        sortentstable->block_owner = strdup ("");
+        sortentstable->id_code = DXF_HANDLE_NONE;
+        sortentstable->dictionary_owner_soft = 0;
+        sortentstable->dictionary_owner_hard = 0;
+        sortentstable->block_owner = dxf_strdup ("");
         sortentstable->entity_owner = dxf_char_init (sortentstable->entity_owner);
         sortentstable->sort_handle->value = 0;
         sortentstable->next = NULL;
@@ -157,7 +157,8 @@ dxf_sortentstable_read
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        char *temp_string = NULL;
+        char temp_string[DXF_MAX_STRING_LENGTH];
+        int group_code;
         int i;
         int j;
         int k;
@@ -170,8 +171,6 @@ dxf_sortentstable_read
                 fprintf (stderr,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
-                /* Clean up. */
-                free (temp_string);
                 return (NULL);
         }
         if (fp->acad_version_number < AutoCAD_14)
@@ -192,105 +191,118 @@ dxf_sortentstable_read
         k = 0;
         iter_5 = (DxfInt *) sortentstable->sort_handle;
         iter_331 = (DxfChar *) sortentstable->entity_owner;
-        (fp->line_number)++;
-        fscanf (fp->fp, "%[^\n]", temp_string);
-        while (strcmp (temp_string, "0") != 0)
+        while ((dxf_read_group_code (fp, &group_code) == EXIT_SUCCESS)
+          && (group_code != 0))
         {
-                if (ferror (fp->fp))
+                if (dxf_read_error (fp))
                 {
                         fprintf (stderr,
                           (_("Error in %s () while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
                         /* Clean up. */
-                        free (temp_string);
-                        fclose (fp->fp);
                         return (NULL);
                 }
-                if ((strcmp (temp_string, "5") == 0)
-                  && (k == 0))
-                {
-                        /* Now follows a string containing a sequential
-                         * id number. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%x\n", (uint *) &sortentstable->id_code);
-                }
-                if ((strcmp (temp_string, "5") == 0)
-                  && (i > 0))
-                {
-                        /* Now follows a string containing a Sort handle
-                         * (zero or more entries may exist). */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%x\n", (uint *) &iter_5->value);
-                        iter_5->next = (struct DxfInt *) dxf_int_init ((DxfInt *) iter_5->next);
-                        iter_5 = (DxfInt *) iter_5->next;
-                }
-                else if ((fp->acad_version_number >= AutoCAD_13)
-                        && (strcmp (temp_string, "100") == 0))
+                switch (group_code)
                 {
-                        /* Now follows a string containing the
-                         * subclass marker value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
-                        if (strcmp (temp_string, "AcDbSortentsTable") != 0)
-                        {
+                        case 5:
+                                if (k == 0)
+                                {
+                                        /* Now follows a string containing a sequential
+                                         * id number. */
+                                        dxf_read_handle (fp, &sortentstable->id_code);
+                                }
+                                else if (i > 0)
+                                {
+                                        /* Now follows a string containing a Sort handle
+                                         * (zero or more entries may exist). */
+                                        dxf_read_hex (fp, &iter_5->value);
+                                        iter_5->next = (struct DxfInt *) dxf_int_init ((DxfInt *) iter_5->next);
+                                        iter_5 = (DxfInt *) iter_5->next;
+                                }
+                                else
+                                {
+                                        fprintf (stderr,
+                                          (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
+                                          __FUNCTION__, fp->filename, fp->line_number);
+                                        /* Skip the value of the unknown group code. */
+                                        dxf_read_line (temp_string, fp);
+                                }
+                                break;
+                        case 100:
+                                if (fp->acad_version_number >= AutoCAD_13)
+                                {
+                                        /* Now follows a string containing the
+                                         * subclass marker value. */
+                                        dxf_read_line (temp_string, fp);
+                                        if (strcmp (temp_string, "AcDbSortentsTable") != 0)
+                                        {
+                                                fprintf (stderr,
+                                                  (_("Warning in %s () found a bad subclass marker in: %s in line: %d.\n")),
+                                                  __FUNCTION__, fp->filename, fp->line_number);
+                                        }
+                                }
+                                else
+                                {
+                                        fprintf (stderr,
+                                          (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
+                                          __FUNCTION__, fp->filename, fp->line_number);
+                                        /* Skip the value of the unknown group code. */
+                                        dxf_read_line (temp_string, fp);
+                                }
+                                break;
+                        case 330:
+                                if (j == 0)
+                                {
+                                        /* Now follows a string containing a soft-pointer
+                                         * ID/handle to owner dictionary. */
+                                        dxf_read_handle (fp, &sortentstable->dictionary_owner_soft);
+                                        j++;
+                                }
+                                else if (j > 0)
+                                {
+                                        /* Now follows a string containing a soft pointer
+                                         * ID/handle to owner (currently only the
+                                         * *MODEL_SPACE or *PAPER_SPACE blocks). */
+                                        dxf_read_string (fp, &sortentstable->block_owner);
+                                        j++;
+                                        /*! \todo Check for overrun of array index. */
+                                }
+                                else
+                                {
+                                        fprintf (stderr,
+                                          (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
+                                          __FUNCTION__, fp->filename, fp->line_number);
+                                        /* Skip the value of the unknown group code. */
+                                        dxf_read_line (temp_string, fp);
+                                }
+                                break;
+                        case 331:
+                                /* Now follows a string containing a soft pointer
+                                 * ID/handle to an entity (zero or more entries
+                                 * may exist). */
+                                dxf_read_string (fp, &iter_331->value);
+                                iter_331->next = (struct DxfChar *) dxf_char_init ((DxfChar *) iter_331->next);
+                                iter_331 = (DxfChar *) iter_331->next;
+                                break;
+                        case 360:
+                                /* Now follows a string containing Hard owner
+                                 * ID/handle to owner dictionary. */
+                                dxf_read_handle (fp, &sortentstable->dictionary_owner_hard);
+                                break;
+                        case 999:
+                                /* Now follows a string containing a comment. */
+                                dxf_read_line (temp_string, fp);
+                                fprintf (stdout, (_("DXF comment: %s\n")), temp_string);
+                                break;
+                        default:
                                 fprintf (stderr,
-                                  (_("Warning in %s () found a bad subclass marker in: %s in line: %d.\n")),
+                                  (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
                                   __FUNCTION__, fp->filename, fp->line_number);
-                        }
-                }
-                else if ((strcmp (temp_string, "330") == 0)
-                  && (j == 0))
-                {
-                        /* Now follows a string containing a soft-pointer
-                         * ID/handle to owner dictionary. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, sortentstable->dictionary_owner_soft);
-                        j++;
-                }
-                else if ((strcmp (temp_string, "330") == 0)
-                  && (j > 0))
-                {
-                        /* Now follows a string containing a soft pointer
-                         * ID/handle to owner (currently only the
-                         * *MODEL_SPACE or *PAPER_SPACE blocks). */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, sortentstable->block_owner);
-                        j++;
-                        /*! \todo Check for overrun of array index. */
-                }
-                else if (strcmp (temp_string, "331") == 0)
-                {
-                        /* Now follows a string containing a soft pointer
-                         * ID/handle to an entity (zero or more entries
-                         * may exist). */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, iter_331->value);
-                        iter_331->next = (struct DxfChar *) dxf_char_init ((DxfChar *) iter_331->next);
-                        iter_331 = (DxfChar *) iter_331->next;
-                }
-                else if (strcmp (temp_string, "360") == 0)
-                {
-                        /* Now follows a string containing Hard owner
-                         * ID/handle to owner dictionary. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, sortentstable->dictionary_owner_hard);
-                }
-                else if (strcmp (temp_string, "999") == 0)
-                {
-                        /* Now follows a string containing a comment. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
-                        fprintf (stdout, (_("DXF comment: %s\n")), temp_string);
-                }
-                else
-                {
-                        fprintf (stderr,
-                          (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
-                          __FUNCTION__, fp->filename, fp->line_number);
+                                /* Skip the value of the unknown group code. */
+                                dxf_read_line (temp_string, fp);
+                                break;
                 }
         }
-        /* Clean up. */
-        free (temp_string);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -316,7 +328,7 @@ dxf_sortentstable_write
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        char *dxf_entity_name = strdup ("SORTENTSTABLE");
+        char *dxf_entity_name = dxf_strdup ("SORTENTSTABLE");
         DxfInt *iter_5 = NULL;
         DxfChar *iter_331 = NULL;
 
@@ -327,7 +339,7 @@ dxf_sortentstable_write
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (sortentstable == NULL)
@@ -336,20 +348,20 @@ dxf_sortentstable_write
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (fp->acad_version_number < AutoCAD_14)
         {
                 fprintf (stderr,
-                  (_("Warning in %s () illegal DXF version for this %s entity with id-code: %x.\n")),
+                  (_("Warning in %s () illegal DXF version for this %s entity with id-code: %" PRIx64 ".\n")),
                   __FUNCTION__, dxf_entity_name, sortentstable->id_code);
         }
         /* Start writing output. */
-        fprintf (fp->fp, "  0\n%s\n", dxf_entity_name);
-        if (sortentstable->id_code != -1)
+        dxf_write_string (fp, 0, dxf_entity_name);
+        if (sortentstable->id_code != DXF_HANDLE_NONE)
         {
-                fprintf (fp->fp, "  5\n%x\n", sortentstable->id_code);
+                dxf_write_hex (fp, 5, sortentstable->id_code);
         }
         /*!
          * \todo for version R14.\n
@@ -361,31 +373,31 @@ dxf_sortentstable_write
          * 102 groups are application defined (optional).\n\n
          * End of group, "}" (optional), with Group code 102.
          */
-        if ((strcmp (sortentstable->dictionary_owner_soft, "") != 0)
+        if ((sortentstable->dictionary_owner_soft != 0)
           && (fp->acad_version_number >= AutoCAD_14))
         {
-                fprintf (fp->fp, "102\n{ACAD_REACTORS\n");
-                fprintf (fp->fp, "330\n%s\n", sortentstable->dictionary_owner_soft);
-                fprintf (fp->fp, "102\n}\n");
+                dxf_write_string (fp, 102, "{ACAD_REACTORS");
+                dxf_write_hex (fp, 330, sortentstable->dictionary_owner_soft);
+                dxf_write_string (fp, 102, "}");
         }
-        if ((strcmp (sortentstable->dictionary_owner_hard, "") != 0)
+        if ((sortentstable->dictionary_owner_hard != 0)
           && (fp->acad_version_number >= AutoCAD_14))
         {
-                fprintf (fp->fp, "102\n{ACAD_XDICTIONARY\n");
-                fprintf (fp->fp, "360\n%s\n", sortentstable->dictionary_owner_hard);
-                fprintf (fp->fp, "102\n}\n");
+                dxf_write_string (fp, 102, "{ACAD_XDICTIONARY");
+                dxf_write_hex (fp, 360, sortentstable->dictionary_owner_hard);
+                dxf_write_string (fp, 102, "}");
         }
         if (fp->acad_version_number >= AutoCAD_13)
         {
-                fprintf (fp->fp, "100\nAcDbSortentsTable\n");
+                dxf_write_string (fp, 100, "AcDbSortentsTable");
         }
-        fprintf (fp->fp, "330\n%s\n", sortentstable->block_owner);
+        dxf_write_string (fp, 330, sortentstable->block_owner);
         if (sortentstable->entity_owner != NULL)
         {
                 iter_331 = (DxfChar*) sortentstable->entity_owner;
                 while ((iter_331 != NULL) && (iter_331->value != NULL))
                 {
-                        fprintf (fp->fp, "331\n%s\n", iter_331->value);
+                        dxf_write_string (fp, 331, iter_331->value);
                         iter_331 = (DxfChar*) iter_331->next;
                 }
         }
@@ -394,12 +406,12 @@ dxf_sortentstable_write
                 iter_5 = (DxfInt*) sortentstable->sort_handle;
                 while (iter_5 != NULL)
                 {
-                        fprintf (fp->fp, "  5\n%x\n", iter_5->value);
+                        dxf_write_hex (fp, 5, iter_5->value);
                         iter_5 = (DxfInt*) iter_5->next;
                 }
         }
         /* Clean up. */
-        free (dxf_entity_name);
+        dxf_free (dxf_entity_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -440,11 +452,9 @@ dxf_sortentstable_free
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        free (sortentstable->dictionary_owner_soft);
-        free (sortentstable->dictionary_owner_hard);
-        free (sortentstable->block_owner);
+        dxf_free (sortentstable->block_owner);
         dxf_char_free_list (sortentstable->entity_owner);
-        free (sortentstable);
+        dxf_free (sortentstable);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -490,7 +500,7 @@ dxf_sortentstable_free_list
  *
  * \return \c id_code.
  */
-int
+uint64_t
 dxf_sortentstable_get_id_code
 (
         DxfSortentsTable *sortentstable
@@ -508,12 +518,6 @@ dxf_sortentstable_get_id_code
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (sortentstable->id_code < 0)
-        {
-                fprintf (stderr,
-                  (_("Warning in %s () a negative value was found.\n")),
-                  __FUNCTION__);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -529,7 +533,7 @@ dxf_sortentstable_set_id_code
 (
         DxfSortentsTable *sortentstable,
                 /*!< a pointer to a DXF \c SORTENTSTABLE object. */
-        int id_code
+        uint64_t id_code
                 /*!< the \c id_code to be set for the entity.\n
                  * This is to be an unique (sequential) number in the
                  * DXF file. */
@@ -546,12 +550,6 @@ dxf_sortentstable_set_id_code
                   __FUNCTION__);
                 return (NULL);
         }
-        if (id_code < 0)
-        {
-                fprintf (stderr,
-                  (_("Warning in %s () a negative value was passed.\n")),
-                  __FUNCTION__);
-        }
         sortentstable->id_code = id_code;
 #if DEBUG
         DXF_DEBUG_END
@@ -564,11 +562,9 @@ dxf_sortentstable_set_id_code
  * \brief Get the pointer to the \c dictionary_owner_soft from a DXF 
  * \c SORTENTSTABLE object.
  *
- * \return pointer to the \c dictionary_owner_soft.
- *
- * \warning No checks are performed on the returned pointer (string).
+ * \return the handle of the \c dictionary_owner_soft.
  */
-char *
+uint64_t
 dxf_sortentstable_get_dictionary_owner_soft
 (
         DxfSortentsTable *sortentstable
@@ -584,19 +580,12 @@ dxf_sortentstable_get_dictionary_owner_soft
                 fprintf (stderr,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
-                return (NULL);
-        }
-        if (sortentstable->dictionary_owner_soft ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
+                return (0);
         }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (sortentstable->dictionary_owner_soft));
+        return (sortentstable->dictionary_owner_soft);
 }
 
 
@@ -609,8 +598,8 @@ dxf_sortentstable_set_dictionary_owner_soft
 (
         DxfSortentsTable *sortentstable,
                 /*!< a pointer to a DXF \c SORTENTSTABLE object. */
-        char *dictionary_owner_soft
-                /*!< a string containing the pointer to the \c
+        uint64_t dictionary_owner_soft
+                /*!< the handle of the \c
                  * dictionary_owner_soft for the object. */
 )
 {
@@ -625,14 +614,7 @@ dxf_sortentstable_set_dictionary_owner_soft
                   __FUNCTION__);
                 return (NULL);
         }
-        if (dictionary_owner_soft == NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was passed.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
-        sortentstable->dictionary_owner_soft = strdup (dictionary_owner_soft);
+        sortentstable->dictionary_owner_soft = dictionary_owner_soft;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -644,11 +626,9 @@ dxf_sortentstable_set_dictionary_owner_soft
  * \brief Get the pointer to the \c dictionary_owner_hard from a DXF 
  * \c SORTENTSTABLE object.
  *
- * \return pointer to the \c dictionary_owner_hard.
- *
- * \warning No checks are performed on the returned pointer (string).
+ * \return the handle of the \c dictionary_owner_hard.
  */
-char *
+uint64_t
 dxf_sortentstable_get_dictionary_owner_hard
 (
         DxfSortentsTable *sortentstable
@@ -664,19 +644,12 @@ dxf_sortentstable_get_dictionary_owner_hard
                 fprintf (stderr,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
-                return (NULL);
-        }
-        if (sortentstable->dictionary_owner_hard ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
+                return (0);
         }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (sortentstable->dictionary_owner_hard));
+        return (sortentstable->dictionary_owner_hard);
 }
 
 
@@ -689,8 +662,8 @@ dxf_sortentstable_set_dictionary_owner_hard
 (
         DxfSortentsTable *sortentstable,
                 /*!< a pointer to a DXF \c SORTENTSTABLE object. */
-        char *dictionary_owner_hard
-                /*!< a string containing the pointer to the \c
+        uint64_t dictionary_owner_hard
+                /*!< the handle of the \c
                  * dictionary_owner_hard for the object. */
 )
 {
@@ -705,14 +678,7 @@ dxf_sortentstable_set_dictionary_owner_hard
                   __FUNCTION__);
                 return (NULL);
         }
-        if (dictionary_owner_hard == NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was passed.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
-        sortentstable->dictionary_owner_hard = strdup (dictionary_owner_hard);
+        sortentstable->dictionary_owner_hard = dictionary_owner_hard;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -756,7 +722,7 @@ dxf_sortentstable_get_block_owner
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (sortentstable->block_owner));
+        return (dxf_strdup (sortentstable->block_owner));
 }
 
 
@@ -792,7 +758,7 @@ dxf_sortentstable_set_block_owner
                   __FUNCTION__);
                 return (NULL);
         }
-        sortentstable->block_owner = strdup (block_owner);
+        sortentstable->block_owner = dxf_strdup (block_owner);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -973,7 +939,7 @@ dxf_sortentstable_get_entity_owner_value
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (entity_owner->value));
+        return (dxf_strdup (entity_owner->value));
 }
 
 
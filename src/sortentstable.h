@@ -71,16 +71,16 @@ typedef struct
 dxf_sortentstable_struct
 {
         /* Members common for all DXF objects. */
-        int id_code;
+        uint64_t id_code;
                 /*!< Identification number for the entity.\n
                  * This is to be an unique (sequential) number in the DXF
                  * file.\n
                  * Group code = 5. */
-        char *dictionary_owner_soft;
+        uint64_t dictionary_owner_soft;
                 /*!< Soft-pointer ID/handle to owner dictionary
                  * (ACAD_SORTENTS).\n
                  * Group code = 330. */
-        char *dictionary_owner_hard;
+        uint64_t dictionary_owner_hard;
                 /*!< Hard owner ID/handle to owner dictionary (optional).\n
                  * Group code = 360. */
         /* Specific members for a DXF sortentstable. */
@@ -109,12 +109,12 @@ DxfSortentsTable *dxf_sortentstable_read (DxfFile *fp, DxfSortentsTable *sortent
 int dxf_sortentstable_write (DxfFile *fp, DxfSortentsTable *sortentstable);
 int dxf_sortentstable_free (DxfSortentsTable *sortentstable);
 void dxf_sortentstable_free_list (DxfSortentsTable *sortentstables);
-int dxf_sortentstable_get_id_code (DxfSortentsTable *sortentstable);
-DxfSortentsTable *dxf_sortentstable_set_id_code (DxfSortentsTable *sortentstable, int id_code);
-char *dxf_sortentstable_get_dictionary_owner_soft (DxfSortentsTable *sortentstable);
-DxfSortentsTable *dxf_sortentstable_set_dictionary_owner_soft (DxfSortentsTable *sortentstable, char *dictionary_owner_soft);
-char *dxf_sortentstable_get_dictionary_owner_hard (DxfSortentsTable *sortentstable);
-DxfSortentsTable *dxf_sortentstable_set_dictionary_owner_hard (DxfSortentsTable *sortentstable, char *dictionary_owner_hard);
+uint64_t dxf_sortentstable_get_id_code (DxfSortentsTable *sortentstable);
+DxfSortentsTable *dxf_sortentstable_set_id_code (DxfSortentsTable *sortentstable, uint64_t id_code);
+uint64_t dxf_sortentstable_get_dictionary_owner_soft (DxfSortentsTable *sortentstable);
+DxfSortentsTable *dxf_sortentstable_set_dictionary_owner_soft (DxfSortentsTable *sortentstable, uint64_t dictionary_owner_soft);
+uint64_t dxf_sortentstable_get_dictionary_owner_hard (DxfSortentsTable *sortentstable);
+DxfSortentsTable *dxf_sortentstable_set_dictionary_owner_hard (DxfSortentsTable *sortentstable, uint64_t dictionary_owner_hard);
 char *dxf_sortentstable_get_block_owner (DxfSortentsTable *sortentstable);
 DxfSortentsTable *dxf_sortentstable_set_block_owner (DxfSortentsTable *sortentstable, char *block_owner);
 DxfChar *dxf_sortentstable_get_entity_owner (DxfSortentsTable *sortentstable);
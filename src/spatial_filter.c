@@ -42,6 +42,7 @@
 
 
 #include "spatial_filter.h"
+#include "util.h"
 
 
 /*!
@@ -61,7 +62,7 @@ dxf_spatial_filter_new ()
         size = sizeof (DxfSpatialFilter);
         /* avoid malloc of 0 bytes */
         if (size == 0) size = 1;
-        if ((spatial_filter = malloc (size)) == NULL)
+        if ((spatial_filter = dxf_malloc (size)) == NULL)
         {
                 fprintf (stderr,
                   (_("Error in %s () could not allocate memory for a DxfSpatialFilter struct.\n")),
@@ -113,9 +114,9 @@ dxf_spatial_filter_init
                   __FUNCTION__);
                 return (NULL);
         }
-        spatial_filter->id_code = 0;
-        spatial_filter->dictionary_owner_soft = strdup ("");
-        spatial_filter->dictionary_owner_hard = strdup ("");
+        spatial_filter->id_code = DXF_HANDLE_NONE;
+        spatial_filter->dictionary_owner_soft = 0;
+        spatial_filter->dictionary_owner_hard = 0;
         spatial_filter->p0 = dxf_point_new ();
         spatial_filter->p0 = dxf_point_init (spatial_filter->p0);
         spatial_filter->p0->x0 = 0.0;
@@ -170,7 +171,8 @@ dxf_spatial_filter_read
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        char *temp_string = NULL;
+        char temp_string[DXF_MAX_STRING_LENGTH];
+        int group_code;
         int i;
         int k;
         DxfPoint *iter_p0 = NULL;
@@ -181,8 +183,6 @@ dxf_spatial_filter_read
                 fprintf (stderr,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
-                /* Clean up. */
-                free (temp_string);
                 return (NULL);
         }
         if (fp->acad_version_number < AutoCAD_14)
@@ -201,203 +201,188 @@ dxf_spatial_filter_read
         i = 0;
         k = 0;
         iter_p0 = (DxfPoint *) spatial_filter->p0;
-        (fp->line_number)++;
-        fscanf (fp->fp, "%[^\n]", temp_string);
-        while (strcmp (temp_string, "0") != 0)
+        while ((dxf_read_group_code (fp, &group_code) == EXIT_SUCCESS)
+          && (group_code != 0))
         {
-                if (ferror (fp->fp))
+                if (dxf_read_error (fp))
                 {
                         fprintf (stderr,
                           (_("Error in %s () while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
                         /* Clean up. */
-                        free (temp_string);
-                        fclose (fp->fp);
                         return (NULL);
                 }
-                if (strcmp (temp_string, "5") == 0)
-                {
-                        /* Now follows a string containing a sequential
-                         * id number. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%x\n", (uint *) &spatial_filter->id_code);
-                }
-                else if (strcmp (temp_string, "10") == 0)
-                {
-                        /* Now follows a string containing the
-                         * X-value of the clip boundary definition point. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &iter_p0->x0);
-                }
-                else if (strcmp (temp_string, "20") == 0)
-                {
-                        /* Now follows a string containing the
-                         * Y-value of the clip boundary definition point. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &iter_p0->y0);
-                        iter_p0->next = (struct DxfPoint *) dxf_point_init ((DxfPoint *) iter_p0->next);
-                        iter_p0 = (DxfPoint *) iter_p0->next;
-                }
-                else if (strcmp (temp_string, "11") == 0)
-                {
-                        /* Now follows a string containing the X-value
-                         * of the origin used to define the local
-                         * coordinate system of the clip boundary. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &spatial_filter->p1->x0);
-                }
-                else if (strcmp (temp_string, "21") == 0)
-                {
-                        /* Now follows a string containing the Y-value
-                         * of the origin used to define the local
-                         * coordinate system of the clip boundary. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &spatial_filter->p1->y0);
-                }
-                else if (strcmp (temp_string, "31") == 0)
-                {
-                        /* Now follows a string containing the Z-value
-                         * of the origin used to define the local
-                         * coordinate system of the clip boundary. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &spatial_filter->p1->z0);
-                }
-                else if ((strcmp (temp_string, "40") == 0)
-                  && (k == 0)
-                  && (spatial_filter->front_clipping_plane_flag == 1))
-                {
-                        /* Now follows a string containing the front
-                         * clipping plane distance. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &spatial_filter->front_clipping_plane_distance);
-                        k++;
-                }
-                else if ((strcmp (temp_string, "40") == 0)
-                  && (k > 0)
-                  && (k < 13)) /* k = 1 ... 12. */
-                {
-                        /* Now follows a string containing an element of
-                         * the 4x3 inverse transformation matrix. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &spatial_filter->inverse_block_transformation[(k - 1)]);
-                        k++;
-                }
-                else if ((strcmp (temp_string, "40") == 0)
-                  && (k >= 13)) /* k = 13 ...25. */
-                {
-                        /* Now follows a string containing an element of
-                         * the 4x3 transformation matrix. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &spatial_filter->block_transformation[(k - 13)]);
-                        k++;
-                }
-                else if ((strcmp (temp_string, "41") == 0)
-                  && (spatial_filter->back_clipping_plane_flag == 1))
-                {
-                        /* Now follows a string containing the back
-                         * clipping plane distance. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &spatial_filter->back_clipping_plane_distance);
-                        i++;
-                }
-                else if (strcmp (temp_string, "70") == 0)
-                {
-                        /* Now follows a string containing the
-                         * number of points. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%d\n", &spatial_filter->number_of_points);
-                }
-                else if (strcmp (temp_string, "71") == 0)
+                switch (group_code)
                 {
-                        /* Now follows a string containing the clip
-                         * boundary display enabled flag. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%d\n", &spatial_filter->clip_boundary_display_flag);
-                }
-                else if (strcmp (temp_string, "72") == 0)
-                {
-                        /* Now follows a string containing the front
-                         * clipping plane flag. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%d\n", &spatial_filter->front_clipping_plane_flag);
-                }
-                else if (strcmp (temp_string, "73") == 0)
-                {
-                        /* Now follows a string containing the back
-                         * clipping plane flag. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%d\n", &spatial_filter->back_clipping_plane_flag);
-                }
-                else if ((fp->acad_version_number >= AutoCAD_13)
-                        && (strcmp (temp_string, "100") == 0))
-                {
-                        /* Now follows a string containing the
-                         * subclass marker value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
-                        if ((strcmp (temp_string, "AcDbFilter") != 0)
-                          && (strcmp (temp_string, "AcDbSpatialFilter") != 0))
-                        {
+                        case 5:
+                                /* Now follows a string containing a sequential
+                                 * id number. */
+                                dxf_read_handle (fp, &spatial_filter->id_code);
+                                break;
+                        case 10:
+                                /* Now follows a string containing the
+                                 * X-value of the clip boundary definition point. */
+                                dxf_read_double (fp, &iter_p0->x0);
+                                break;
+                        case 20:
+                                /* Now follows a string containing the
+                                 * Y-value of the clip boundary definition point. */
+                                dxf_read_double (fp, &iter_p0->y0);
+                                iter_p0->next = (struct DxfPoint *) dxf_point_init ((DxfPoint *) iter_p0->next);
+                                iter_p0 = (DxfPoint *) iter_p0->next;
+                                break;
+                        case 11:
+                                /* Now follows a string containing the X-value
+                                 * of the origin used to define the local
+                                 * coordinate system of the clip boundary. */
+                                dxf_read_double (fp, &spatial_filter->p1->x0);
+                                break;
+                        case 21:
+                                /* Now follows a string containing the Y-value
+                                 * of the origin used to define the local
+                                 * coordinate system of the clip boundary. */
+                                dxf_read_double (fp, &spatial_filter->p1->y0);
+                                break;
+                        case 31:
+                                /* Now follows a string containing the Z-value
+                                 * of the origin used to define the local
+                                 * coordinate system of the clip boundary. */
+                                dxf_read_double (fp, &spatial_filter->p1->z0);
+                                break;
+                        case 40:
+                                if ((k == 0) && (spatial_filter->front_clipping_plane_flag == 1))
+                                {
+                                        /* Now follows a string containing the front
+                                         * clipping plane distance. */
+                                        dxf_read_double (fp, &spatial_filter->front_clipping_plane_distance);
+                                        k++;
+                                }
+                                else if ((k > 0) && (k < 13))
+                                {
+                                        /* Now follows a string containing an element of
+                                         * the 4x3 inverse transformation matrix. */
+                                        dxf_read_double (fp, &spatial_filter->inverse_block_transformation[(k - 1)]);
+                                        k++;
+                                }
+                                else if (k >= 13)
+                                {
+                                        /* Now follows a string containing an element of
+                                         * the 4x3 transformation matrix. */
+                                        dxf_read_double (fp, &spatial_filter->block_transformation[(k - 13)]);
+                                        k++;
+                                }
+                                else
+                                {
+                                        fprintf (stderr,
+                                          (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
+                                          __FUNCTION__, fp->filename, fp->line_number);
+                                        /* Skip the value of the unknown group code. */
+                                        dxf_read_line (temp_string, fp);
+                                }
+                                break;
+                        case 41:
+                                if (spatial_filter->back_clipping_plane_flag == 1)
+                                {
+                                        /* Now follows a string containing the back
+                                         * clipping plane distance. */
+                                        dxf_read_double (fp, &spatial_filter->back_clipping_plane_distance);
+                                        i++;
+                                }
+                                else
+                                {
+                                        fprintf (stderr,
+                                          (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
+                                          __FUNCTION__, fp->filename, fp->line_number);
+                                        /* Skip the value of the unknown group code. */
+                                        dxf_read_line (temp_string, fp);
+                                }
+                                break;
+                        case 70:
+                                /* Now follows a string containing the
+                                 * number of points. */
+                                dxf_read_int (fp, &spatial_filter->number_of_points);
+                                break;
+                        case 71:
+                                /* Now follows a string containing the clip
+                                 * boundary display enabled flag. */
+                                dxf_read_int (fp, &spatial_filter->clip_boundary_display_flag);
+                                break;
+                        case 72:
+                                /* Now follows a string containing the front
+                                 * clipping plane flag. */
+                                dxf_read_int (fp, &spatial_filter->front_clipping_plane_flag);
+                                break;
+                        case 73:
+                                /* Now follows a string containing the back
+                                 * clipping plane flag. */
+                                dxf_read_int (fp, &spatial_filter->back_clipping_plane_flag);
+                                break;
+                        case 100:
+                                if (fp->acad_version_number >= AutoCAD_13)
+                                {
+                                        /* Now follows a string containing the
+                                         * subclass marker value. */
+                                        dxf_read_line (temp_string, fp);
+                                        if ((strcmp (temp_string, "AcDbFilter") != 0)
+                                          && (strcmp (temp_string, "AcDbSpatialFilter") != 0))
+                                        {
+                                                fprintf (stderr,
+                                                  (_("Warning in %s () found a bad subclass marker in: %s in line: %d.\n")),
+                                                  __FUNCTION__, fp->filename, fp->line_number);
+                                        }
+                                }
+                                else
+                                {
+                                        fprintf (stderr,
+                                          (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
+                                          __FUNCTION__, fp->filename, fp->line_number);
+                                        /* Skip the value of the unknown group code. */
+                                        dxf_read_line (temp_string, fp);
+                                }
+                                break;
+                        case 210:
+                                /* Now follows a string containing the X-value
+                                 * of the normal to the plane containing the
+                                 * clip boundary. */
+                                dxf_read_double (fp, &spatial_filter->extr_x0);
+                                break;
+                        case 220:
+                                /* Now follows a string containing the Y-value
+                                 * of the normal to the plane containing the
+                                 * clip boundary. */
+                                dxf_read_double (fp, &spatial_filter->extr_y0);
+                                break;
+                        case 230:
+                                /* Now follows a string containing the
+                                 * Z-value of the extrusion vector. */
+                                dxf_read_double (fp, &spatial_filter->extr_z0);
+                                break;
+                        case 330:
+                                /* Now follows a string containing the Z-value
+                                 * of the normal to the plane containing the
+                                 * clip boundary. */
+                                dxf_read_handle (fp, &spatial_filter->dictionary_owner_soft);
+                                i++;
+                                break;
+                        case 360:
+                                /* Now follows a string containing Hard owner
+                                 * ID/handle to owner dictionary. */
+                                dxf_read_handle (fp, &spatial_filter->dictionary_owner_hard);
+                                break;
+                        case 999:
+                                /* Now follows a string containing a comment. */
+                                dxf_read_line (temp_string, fp);
+                                fprintf (stdout, (_("DXF comment: %s\n")), temp_string);
+                                break;
+                        default:
                                 fprintf (stderr,
-                                  (_("Warning in %s () found a bad subclass marker in: %s in line: %d.\n")),
+                                  (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
                                   __FUNCTION__, fp->filename, fp->line_number);
-                        }
-                }
-                else if (strcmp (temp_string, "210") == 0)
-                {
-                        /* Now follows a string containing the X-value
-                         * of the normal to the plane containing the
-                         * clip boundary. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &spatial_filter->extr_x0);
-                }
-                else if (strcmp (temp_string, "220") == 0)
-                {
-                        /* Now follows a string containing the Y-value
-                         * of the normal to the plane containing the
-                         * clip boundary. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &spatial_filter->extr_y0);
-                }
-                else if (strcmp (temp_string, "230") == 0)
-                {
-                        /* Now follows a string containing the
-                         * Z-value of the extrusion vector. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &spatial_filter->extr_z0);
-                }
-                else if (strcmp (temp_string, "330") == 0)
-                {
-                        /* Now follows a string containing the Z-value
-                         * of the normal to the plane containing the
-                         * clip boundary. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, spatial_filter->dictionary_owner_soft);
-                        i++;
-                }
-                else if (strcmp (temp_string, "360") == 0)
-                {
-                        /* Now follows a string containing Hard owner
-                         * ID/handle to owner dictionary. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, spatial_filter->dictionary_owner_hard);
-                }
-                else if (strcmp (temp_string, "999") == 0)
-                {
-                        /* Now follows a string containing a comment. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
-                        fprintf (stdout, (_("DXF comment: %s\n")), temp_string);
-                }
-                else
-                {
-                        fprintf (stderr,
-                          (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
-                          __FUNCTION__, fp->filename, fp->line_number);
+                                /* Skip the value of the unknown group code. */
+                                dxf_read_line (temp_string, fp);
+                                break;
                 }
         }
-        /* Clean up. */
-        free (temp_string);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -423,7 +408,7 @@ dxf_spatial_filter_write
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        char *dxf_entity_name = strdup ("SPATIAL_FILTER");
+        char *dxf_entity_name = dxf_strdup ("SPATIAL_FILTER");
         int i;
         DxfPoint *iter_p0 = NULL;
 
@@ -434,7 +419,7 @@ dxf_spatial_filter_write
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (spatial_filter == NULL)
@@ -443,7 +428,7 @@ dxf_spatial_filter_write
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (spatial_filter->number_of_points < 2)
@@ -452,23 +437,23 @@ dxf_spatial_filter_write
                   (_("Error in %s () number of the clip boundary definition points is too small.\n")),
                   __FUNCTION__);
                 fprintf (stderr,
-                  (_("\tThe %s object with id-code %x is dropped from output.\n")),
+                  (_("\tThe %s object with id-code %" PRIx64 " is dropped from output.\n")),
                   dxf_entity_name, spatial_filter->id_code);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (fp->acad_version_number < AutoCAD_14)
         {
                 fprintf (stderr,
-                  (_("Warning in %s () illegal DXF version for this %s entity with id-code: %x.\n")),
+                  (_("Warning in %s () illegal DXF version for this %s entity with id-code: %" PRIx64 ".\n")),
                   __FUNCTION__, dxf_entity_name, spatial_filter->id_code);
         }
         /* Start writing output. */
-        fprintf (fp->fp, "  0\n%s\n", dxf_entity_name);
-        if (spatial_filter->id_code != -1)
+        dxf_write_string (fp, 0, dxf_entity_name);
+        if (spatial_filter->id_code != DXF_HANDLE_NONE)
         {
-                fprintf (fp->fp, "  5\n%x\n", spatial_filter->id_code);
+                dxf_write_hex (fp, 5, spatial_filter->id_code);
         }
         /*!
          * \todo for version R14.\n
@@ -480,33 +465,33 @@ dxf_spatial_filter_write
          * 102 groups are application defined (optional).\n\n
          * End of group, "}" (optional), with Group code 102.
          */
-        if ((strcmp (spatial_filter->dictionary_owner_soft, "") != 0)
+        if ((spatial_filter->dictionary_owner_soft != 0)
           && (fp->acad_version_number >= AutoCAD_14))
         {
-                fprintf (fp->fp, "102\n{ACAD_REACTORS\n");
-                fprintf (fp->fp, "330\n%s\n", spatial_filter->dictionary_owner_soft);
-                fprintf (fp->fp, "102\n}\n");
+                dxf_write_string (fp, 102, "{ACAD_REACTORS");
+                dxf_write_hex (fp, 330, spatial_filter->dictionary_owner_soft);
+                dxf_write_string (fp, 102, "}");
         }
-        if ((strcmp (spatial_filter->dictionary_owner_hard, "") != 0)
+        if ((spatial_filter->dictionary_owner_hard != 0)
           && (fp->acad_version_number >= AutoCAD_14))
         {
-                fprintf (fp->fp, "102\n{ACAD_XDICTIONARY\n");
-                fprintf (fp->fp, "360\n%s\n", spatial_filter->dictionary_owner_hard);
-                fprintf (fp->fp, "102\n}\n");
+                dxf_write_string (fp, 102, "{ACAD_XDICTIONARY");
+                dxf_write_hex (fp, 360, spatial_filter->dictionary_owner_hard);
+                dxf_write_string (fp, 102, "}");
         }
         if (fp->acad_version_number >= AutoCAD_13)
         {
-                fprintf (fp->fp, "100\nAcDbFilter\n");
-                fprintf (fp->fp, "100\nAcDbSpatialFilter\n");
+                dxf_write_string (fp, 100, "AcDbFilter");
+                dxf_write_string (fp, 100, "AcDbSpatialFilter");
         }
-        fprintf (fp->fp, " 70\n%d\n", spatial_filter->number_of_points);
+        dxf_write_int (fp, 70, spatial_filter->number_of_points);
         if (spatial_filter->p0 != NULL)
         {
                 iter_p0 = (DxfPoint*) spatial_filter->p0;
                 while (iter_p0 != NULL)
                 {
-                        fprintf (fp->fp, " 10\n%f\n", iter_p0->x0);
-                        fprintf (fp->fp, " 20\n%f\n", iter_p0->y0);
+                        dxf_write_double (fp, 10, iter_p0->x0);
+                        dxf_write_double (fp, 20, iter_p0->y0);
                         iter_p0 = (DxfPoint*) iter_p0->next;
                 }
         }
@@ -515,34 +500,34 @@ dxf_spatial_filter_write
                 && (spatial_filter->extr_y0 != 0.0)
                 && (spatial_filter->extr_z0 != 1.0))
         {
-                fprintf (fp->fp, "210\n%f\n", spatial_filter->extr_x0);
-                fprintf (fp->fp, "220\n%f\n", spatial_filter->extr_y0);
-                fprintf (fp->fp, "230\n%f\n", spatial_filter->extr_z0);
+                dxf_write_double (fp, 210, spatial_filter->extr_x0);
+                dxf_write_double (fp, 220, spatial_filter->extr_y0);
+                dxf_write_double (fp, 230, spatial_filter->extr_z0);
         }
-        fprintf (fp->fp, " 11\n%f\n", spatial_filter->p1->x0);
-        fprintf (fp->fp, " 21\n%f\n", spatial_filter->p1->y0);
-        fprintf (fp->fp, " 31\n%f\n", spatial_filter->p1->z0);
-        fprintf (fp->fp, " 71\n%d\n", spatial_filter->clip_boundary_display_flag);
-        fprintf (fp->fp, " 72\n%d\n", spatial_filter->front_clipping_plane_flag);
+        dxf_write_double (fp, 11, spatial_filter->p1->x0);
+        dxf_write_double (fp, 21, spatial_filter->p1->y0);
+        dxf_write_double (fp, 31, spatial_filter->p1->z0);
+        dxf_write_int (fp, 71, spatial_filter->clip_boundary_display_flag);
+        dxf_write_int (fp, 72, spatial_filter->front_clipping_plane_flag);
         if (spatial_filter->front_clipping_plane_flag)
         {
-                fprintf (fp->fp, " 40\n%f\n", spatial_filter->front_clipping_plane_distance);
+                dxf_write_double (fp, 40, spatial_filter->front_clipping_plane_distance);
         }
-        fprintf (fp->fp, " 73\n%d\n", spatial_filter->back_clipping_plane_flag);
+        dxf_write_int (fp, 73, spatial_filter->back_clipping_plane_flag);
         if (spatial_filter->back_clipping_plane_flag)
         {
-                fprintf (fp->fp, " 41\n%f\n", spatial_filter->back_clipping_plane_distance);
+                dxf_write_double (fp, 41, spatial_filter->back_clipping_plane_distance);
         }
         for (i = 0; i < 12; i++)
         {
-                fprintf (fp->fp, " 40\n%f\n", spatial_filter->inverse_block_transformation[i]);
+                dxf_write_double (fp, 40, spatial_filter->inverse_block_transformation[i]);
         }
         for (i = 0; i < 12; i++)
         {
-                fprintf (fp->fp, " 40\n%f\n", spatial_filter->block_transformation[i]);
+                dxf_write_double (fp, 40, spatial_filter->block_transformation[i]);
         }
         /* Clean up. */
-        free (dxf_entity_name);
+        dxf_free (dxf_entity_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -583,9 +568,7 @@ dxf_spatial_filter_free
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        free (spatial_filter->dictionary_owner_soft);
-        free (spatial_filter->dictionary_owner_hard);
-        free (spatial_filter);
+        dxf_free (spatial_filter);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -631,7 +614,7 @@ dxf_spatial_filter_free_list
  *
  * \return \c id_code.
  */
-int
+uint64_t
 dxf_spatial_filter_get_id_code
 (
         DxfSpatialFilter *spatial_filter
@@ -649,12 +632,6 @@ dxf_spatial_filter_get_id_code
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (spatial_filter->id_code < 0)
-        {
-                fprintf (stderr,
-                  (_("Warning in %s () a negative value was found.\n")),
-                  __FUNCTION__);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -670,7 +647,7 @@ dxf_spatial_filter_set_id_code
 (
         DxfSpatialFilter *spatial_filter,
                 /*!< a pointer to a DXF \c SPATIAL_FILTER object. */
-        int id_code
+        uint64_t id_code
                 /*!< the \c id_code to be set for the object.\n
                  * This is to be an unique (sequential) number in the
                  * DXF file. */
@@ -687,12 +664,6 @@ dxf_spatial_filter_set_id_code
                   __FUNCTION__);
                 return (NULL);
         }
-        if (id_code < 0)
-        {
-                fprintf (stderr,
-                  (_("Warning in %s () a negative value was passed.\n")),
-                  __FUNCTION__);
-        }
         spatial_filter->id_code = id_code;
 #if DEBUG
         DXF_DEBUG_END
@@ -705,11 +676,9 @@ dxf_spatial_filter_set_id_code
  * \brief Get the pointer to the \c dictionary_owner_soft from a DXF 
  * \c SPATIAL_FILTER object.
  *
- * \return pointer to the \c dictionary_owner_soft.
- *
- * \warning No checks are performed on the returned pointer (string).
+ * \return the handle of the \c dictionary_owner_soft.
  */
-char *
+uint64_t
 dxf_spatial_filter_get_dictionary_owner_soft
 (
         DxfSpatialFilter *spatial_filter
@@ -725,19 +694,12 @@ dxf_spatial_filter_get_dictionary_owner_soft
                 fprintf (stderr,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
-                return (NULL);
-        }
-        if (spatial_filter->dictionary_owner_soft ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
+                return (0);
         }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (spatial_filter->dictionary_owner_soft));
+        return (spatial_filter->dictionary_owner_soft);
 }
 
 
@@ -750,8 +712,8 @@ dxf_spatial_filter_set_dictionary_owner_soft
 (
         DxfSpatialFilter *spatial_filter,
                 /*!< a pointer to a DXF \c SPATIAL_FILTER object. */
-        char *dictionary_owner_soft
-                /*!< a string containing the pointer to the \c
+        uint64_t dictionary_owner_soft
+                /*!< the handle of the \c
                  * dictionary_owner_soft for the object. */
 )
 {
@@ -766,14 +728,7 @@ dxf_spatial_filter_set_dictionary_owner_soft
                   __FUNCTION__);
                 return (NULL);
         }
-        if (dictionary_owner_soft == NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was passed.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
-        spatial_filter->dictionary_owner_soft = strdup (dictionary_owner_soft);
+        spatial_filter->dictionary_owner_soft = dictionary_owner_soft;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -785,11 +740,9 @@ dxf_spatial_filter_set_dictionary_owner_soft
  * \brief Get the pointer to the \c dictionary_owner_hard from a DXF 
  * \c SPATIAL_FILTER object.
  *
- * \return pointer to the \c dictionary_owner_hard.
- *
- * \warning No checks are performed on the returned pointer (string).
+ * \return the handle of the \c dictionary_owner_hard.
  */
-char *
+uint64_t
 dxf_spatial_filter_get_dictionary_owner_hard
 (
         DxfSpatialFilter *spatial_filter
@@ -805,19 +758,12 @@ dxf_spatial_filter_get_dictionary_owner_hard
                 fprintf (stderr,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
-                return (NULL);
-        }
-        if (spatial_filter->dictionary_owner_hard ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
+                return (0);
         }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (spatial_filter->dictionary_owner_hard));
+        return (spatial_filter->dictionary_owner_hard);
 }
 
 
@@ -830,8 +776,8 @@ dxf_spatial_filter_set_dictionary_owner_hard
 (
         DxfSpatialFilter *spatial_filter,
                 /*!< a pointer to a DXF \c SPATIAL_FILTER object. */
-        char *dictionary_owner_hard
-                /*!< a string containing the pointer to the \c
+        uint64_t dictionary_owner_hard
+                /*!< the handle of the \c
                  * dictionary_owner_hard for the object. */
 )
 {
@@ -846,14 +792,7 @@ dxf_spatial_filter_set_dictionary_owner_hard
                   __FUNCTION__);
                 return (NULL);
         }
-        if (dictionary_owner_hard == NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was passed.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
-        spatial_filter->dictionary_owner_hard = strdup (dictionary_owner_hard);
+        spatial_filter->dictionary_owner_hard = dictionary_owner_hard;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1528,23 +1467,149 @@ dxf_spatial_filter_set_z1
 
 
 /*!
- * \todo Add dxf_spatial_filter_get_inverse_block_transformation().
+ * \brief Get the inverse block transformation \c inverse_block_transformation of a DXF
+ * \c SPATIAL_FILTER object.
+ *
+ * \return a pointer to \c transform, or \c NULL when an error
+ * occurred.
  */
+DxfTransform *
+dxf_spatial_filter_get_inverse_block_transformation
+(
+        DxfSpatialFilter *spatial_filter,
+                /*!< a pointer to a DXF \c SPATIAL_FILTER object. */
+        DxfTransform *transform
+                /*!< a pointer to the libDXF affine transformation to
+                 * fill. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        /* Do some basic checks. */
+        if ((spatial_filter == NULL) || (transform == NULL))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        dxf_transform_set_column_major (transform,
+          spatial_filter->inverse_block_transformation);
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (transform);
+}
 
 
 /*!
- * \todo Add dxf_spatial_filter_set_inverse_block_transformation().
+ * \brief Set the inverse block transformation \c inverse_block_transformation of a DXF
+ * \c SPATIAL_FILTER object.
+ *
+ * \return a pointer to \c spatial_filter when successful, or \c NULL
+ * when an error occurred.
  */
+DxfSpatialFilter *
+dxf_spatial_filter_set_inverse_block_transformation
+(
+        DxfSpatialFilter *spatial_filter,
+                /*!< a pointer to a DXF \c SPATIAL_FILTER object. */
+        DxfTransform *transform
+                /*!< a pointer to a libDXF affine transformation. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        /* Do some basic checks. */
+        if ((spatial_filter == NULL) || (transform == NULL))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        dxf_transform_get_column_major (transform,
+          spatial_filter->inverse_block_transformation);
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (spatial_filter);
+}
 
 
 /*!
- * \todo Add dxf_spatial_filter_get_block_transformation().
+ * \brief Get the block transformation \c block_transformation of a DXF
+ * \c SPATIAL_FILTER object.
+ *
+ * \return a pointer to \c transform, or \c NULL when an error
+ * occurred.
  */
+DxfTransform *
+dxf_spatial_filter_get_block_transformation
+(
+        DxfSpatialFilter *spatial_filter,
+                /*!< a pointer to a DXF \c SPATIAL_FILTER object. */
+        DxfTransform *transform
+                /*!< a pointer to the libDXF affine transformation to
+                 * fill. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        /* Do some basic checks. */
+        if ((spatial_filter == NULL) || (transform == NULL))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        dxf_transform_set_column_major (transform,
+          spatial_filter->block_transformation);
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (transform);
+}
 
 
 /*!
- * \todo Add dxf_spatial_filter_set_block_transformation().
+ * \brief Set the block transformation \c block_transformation of a DXF
+ * \c SPATIAL_FILTER object.
+ *
+ * \return a pointer to \c spatial_filter when successful, or \c NULL
+ * when an error occurred.
  */
+DxfSpatialFilter *
+dxf_spatial_filter_set_block_transformation
+(
+        DxfSpatialFilter *spatial_filter,
+                /*!< a pointer to a DXF \c SPATIAL_FILTER object. */
+        DxfTransform *transform
+                /*!< a pointer to a libDXF affine transformation. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        /* Do some basic checks. */
+        if ((spatial_filter == NULL) || (transform == NULL))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        dxf_transform_get_column_major (transform,
+          spatial_filter->block_transformation);
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (spatial_filter);
+}
 
 
 /*!
@@ -47,6 +47,7 @@
 
 #include "global.h"
 #include "point.h"
+#include "transform.h"
 
 
 #ifdef __cplusplus
@@ -61,15 +62,15 @@ typedef struct
 dxf_spatial_filter_struct
 {
         /* Members common for all DXF objects. */
-        int id_code;
+        uint64_t id_code;
                 /*!< Identification number for the entity.\n
                  * This is to be an unique (sequential) number in the DXF
                  * file.\n
                  * Group code = 5. */
-        char *dictionary_owner_soft;
+        uint64_t dictionary_owner_soft;
                 /*!< Soft-pointer ID/handle to owner dictionary (SPATIAL).\n
                  * Group code = 330. */
-        char *dictionary_owner_hard;
+        uint64_t dictionary_owner_hard;
                 /*!< Hard owner ID/handle to owner dictionary (optional).\n
                  * Group code = 360. */
         /* Specific members for a DXF spatial_filter. */
@@ -173,12 +174,12 @@ DxfSpatialFilter *dxf_spatial_filter_read (DxfFile *fp, DxfSpatialFilter *spatia
 int dxf_spatial_filter_write (DxfFile *fp, DxfSpatialFilter *spatial_filter);
 int dxf_spatial_filter_free (DxfSpatialFilter *spatial_filter);
 void dxf_spatial_filter_free_list (DxfSpatialFilter *spatial_filters);
-int dxf_spatial_filter_get_id_code (DxfSpatialFilter *spatial_filter);
-DxfSpatialFilter *dxf_spatial_filter_set_id_code (DxfSpatialFilter *spatial_filter, int id_code);
-char *dxf_spatial_filter_get_dictionary_owner_soft (DxfSpatialFilter *spatial_filter);
-DxfSpatialFilter *dxf_spatial_filter_set_dictionary_owner_soft (DxfSpatialFilter *spatial_filter, char *dictionary_owner_soft);
-char *dxf_spatial_filter_get_dictionary_owner_hard (DxfSpatialFilter *spatial_filter);
-DxfSpatialFilter *dxf_spatial_filter_set_dictionary_owner_hard (DxfSpatialFilter *spatial_filter, char *dictionary_owner_hard);
+uint64_t dxf_spatial_filter_get_id_code (DxfSpatialFilter *spatial_filter);
+DxfSpatialFilter *dxf_spatial_filter_set_id_code (DxfSpatialFilter *spatial_filter, uint64_t id_code);
+uint64_t dxf_spatial_filter_get_dictionary_owner_soft (DxfSpatialFilter *spatial_filter);
+DxfSpatialFilter *dxf_spatial_filter_set_dictionary_owner_soft (DxfSpatialFilter *spatial_filter, uint64_t dictionary_owner_soft);
+uint64_t dxf_spatial_filter_get_dictionary_owner_hard (DxfSpatialFilter *spatial_filter);
+DxfSpatialFilter *dxf_spatial_filter_set_dictionary_owner_hard (DxfSpatialFilter *spatial_filter, uint64_t dictionary_owner_hard);
 DxfPoint *dxf_spatial_filter_get_p0 (DxfSpatialFilter *spatial_filter);
 DxfSpatialFilter *dxf_spatial_filter_set_p0 (DxfSpatialFilter *spatial_filter, DxfPoint *p0);
 double dxf_spatial_filter_get_x0 (DxfSpatialFilter *spatial_filter);
@@ -195,6 +196,10 @@ double dxf_spatial_filter_get_y1 (DxfSpatialFilter *spatial_filter);
 DxfSpatialFilter *dxf_spatial_filter_set_y1 (DxfSpatialFilter *spatial_filter, double y1);
 double dxf_spatial_filter_get_z1 (DxfSpatialFilter *spatial_filter);
 DxfSpatialFilter *dxf_spatial_filter_set_z1 (DxfSpatialFilter *spatial_filter, double z1);
+DxfTransform *dxf_spatial_filter_get_inverse_block_transformation (DxfSpatialFilter *spatial_filter, DxfTransform *transform);
+DxfSpatialFilter *dxf_spatial_filter_set_inverse_block_transformation (DxfSpatialFilter *spatial_filter, DxfTransform *transform);
+DxfTransform *dxf_spatial_filter_get_block_transformation (DxfSpatialFilter *spatial_filter, DxfTransform *transform);
+DxfSpatialFilter *dxf_spatial_filter_set_block_transformation (DxfSpatialFilter *spatial_filter, DxfTransform *transform);
 double dxf_spatial_filter_get_front_clipping_plane_distance (DxfSpatialFilter *spatial_filter);
 DxfSpatialFilter *dxf_spatial_filter_set_front_clipping_plane_distance (DxfSpatialFilter *spatial_filter, double front_clipping_plane_distance);
 double dxf_spatial_filter_get_back_clipping_plane_distance (DxfSpatialFilter *spatial_filter);
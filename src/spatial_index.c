@@ -7,7 +7,9 @@
  * \brief Functions for a DXF spatial_index object (\c SPATIAL_INDEX).
  *
  * The SPATIAL_INDEX is always written out empty to a DXF file.\n
- * This object can be ignored.
+ * This object can be ignored.\n
+ * The R-tree of a drawing (\c DxfSpatialIndexTree) is kept in memory
+ * only, and rebuilt from the bounding boxes of the entities.
  *
  * \since The \c SPATIAL_INDEX object was introduced in DXF R14.
  *
@@ -44,7 +46,11 @@
  */
 
 
+#include <float.h>
+
 #include "spatial_index.h"
+#include "bbox.h"
+#include "util.h"
 
 
 /*!
@@ -64,7 +70,7 @@ dxf_spatial_index_new ()
         size = sizeof (DxfSpatialIndex);
         /* avoid malloc of 0 bytes */
         if (size == 0) size = 1;
-        if ((spatial_index = malloc (size)) == NULL)
+        if ((spatial_index = dxf_malloc (size)) == NULL)
         {
                 fprintf (stderr,
                   (_("Error in %s () could not allocate memory for a DxfSpatialIndex struct.\n")),
@@ -116,9 +122,9 @@ dxf_spatial_index_init
                   __FUNCTION__);
                 return (NULL);
         }
-        spatial_index->id_code = 0;
-        spatial_index->dictionary_owner_soft = strdup ("");
-        spatial_index->dictionary_owner_hard = strdup ("");
+        spatial_index->id_code = DXF_HANDLE_NONE;
+        spatial_index->dictionary_owner_soft = 0;
+        spatial_index->dictionary_owner_hard = 0;
         if (time (&now) != (time_t)(-1))
         {
                 float fraction_day;
@@ -163,7 +169,8 @@ dxf_spatial_index_read
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        char *temp_string = NULL;
+        char temp_string[DXF_MAX_STRING_LENGTH];
+        int group_code;
 
         /* Do some basic checks. */
         if (fp == NULL)
@@ -171,8 +178,6 @@ dxf_spatial_index_read
                 fprintf (stderr,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
-                /* Clean up. */
-                free (temp_string);
                 return (NULL);
         }
         if (fp->acad_version_number < AutoCAD_14)
@@ -188,79 +193,76 @@ dxf_spatial_index_read
                   __FUNCTION__);
                 spatial_index = dxf_spatial_index_init (spatial_index);
         }
-        (fp->line_number)++;
-        fscanf (fp->fp, "%[^\n]", temp_string);
-        while (strcmp (temp_string, "0") != 0)
+        while ((dxf_read_group_code (fp, &group_code) == EXIT_SUCCESS)
+          && (group_code != 0))
         {
-                if (ferror (fp->fp))
+                if (dxf_read_error (fp))
                 {
                         fprintf (stderr,
                           (_("Error in %s () while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
                         /* Clean up. */
-                        free (temp_string);
-                        fclose (fp->fp);
                         return (NULL);
                 }
-                if (strcmp (temp_string, "5") == 0)
-                {
-                        /* Now follows a string containing a sequential
-                         * id number. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%x\n", (uint *) &spatial_index->id_code);
-                }
-                if (strcmp (temp_string, "40") == 0)
-                {
-                        /* Now follows a string containing a timestamp
-                         * (Julian date). */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &spatial_index->time_stamp);
-                }
-                else if ((fp->acad_version_number >= AutoCAD_13)
-                        && (strcmp (temp_string, "100") == 0))
+                switch (group_code)
                 {
-                        /* Now follows a string containing the
-                         * subclass marker value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
-                        if ((strcmp (temp_string, "AcDbIndex") != 0)
-                          && (strcmp (temp_string, "AcDbSpatialIndex") != 0))
-                        {
+                        case 5:
+                                /* Now follows a string containing a sequential
+                                 * id number. */
+                                dxf_read_handle (fp, &spatial_index->id_code);
+                                break;
+                        case 40:
+                                /* Now follows a string containing a timestamp
+                                 * (Julian date). */
+                                dxf_read_double (fp, &spatial_index->time_stamp);
+                                break;
+                        case 100:
+                                if (fp->acad_version_number >= AutoCAD_13)
+                                {
+                                        /* Now follows a string containing the
+                                         * subclass marker value. */
+                                        dxf_read_line (temp_string, fp);
+                                        if ((strcmp (temp_string, "AcDbIndex") != 0)
+                                          && (strcmp (temp_string, "AcDbSpatialIndex") != 0))
+                                        {
+                                                fprintf (stderr,
+                                                  (_("Warning in %s () found a bad subclass marker in: %s in line: %d.\n")),
+                                                  __FUNCTION__, fp->filename, fp->line_number);
+                                        }
+                                }
+                                else
+                                {
+                                        fprintf (stderr,
+                                          (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
+                                          __FUNCTION__, fp->filename, fp->line_number);
+                                        /* Skip the value of the unknown group code. */
+                                        dxf_read_line (temp_string, fp);
+                                }
+                                break;
+                        case 330:
+                                /* Now follows a string containing Soft-pointer
+                                 * ID/handle to owner dictionary. */
+                                dxf_read_handle (fp, &spatial_index->dictionary_owner_soft);
+                                break;
+                        case 360:
+                                /* Now follows a string containing Hard owner
+                                 * ID/handle to owner dictionary. */
+                                dxf_read_handle (fp, &spatial_index->dictionary_owner_hard);
+                                break;
+                        case 999:
+                                /* Now follows a string containing a comment. */
+                                dxf_read_line (temp_string, fp);
+                                fprintf (stdout, (_("DXF comment: %s\n")), temp_string);
+                                break;
+                        default:
                                 fprintf (stderr,
-                                  (_("Warning in %s () found a bad subclass marker in: %s in line: %d.\n")),
+                                  (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
                                   __FUNCTION__, fp->filename, fp->line_number);
-                        }
-                }
-                else if (strcmp (temp_string, "330") == 0)
-                {
-                        /* Now follows a string containing Soft-pointer
-                         * ID/handle to owner dictionary. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, spatial_index->dictionary_owner_soft);
-                }
-                else if (strcmp (temp_string, "360") == 0)
-                {
-                        /* Now follows a string containing Hard owner
-                         * ID/handle to owner dictionary. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, spatial_index->dictionary_owner_hard);
-                }
-                else if (strcmp (temp_string, "999") == 0)
-                {
-                        /* Now follows a string containing a comment. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
-                        fprintf (stdout, (_("DXF comment: %s\n")), temp_string);
-                }
-                else
-                {
-                        fprintf (stderr,
-                          (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
-                          __FUNCTION__, fp->filename, fp->line_number);
+                                /* Skip the value of the unknown group code. */
+                                dxf_read_line (temp_string, fp);
+                                break;
                 }
         }
-        /* Clean up. */
-        free (temp_string);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -289,7 +291,7 @@ dxf_spatial_index_write
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        char *dxf_entity_name = strdup ("SPATIAL_INDEX");
+        char *dxf_entity_name = dxf_strdup ("SPATIAL_INDEX");
 
         /* Do some basic checks. */
         if (fp == NULL)
@@ -298,7 +300,7 @@ dxf_spatial_index_write
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (spatial_index == NULL)
@@ -307,20 +309,20 @@ dxf_spatial_index_write
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (fp->acad_version_number < AutoCAD_14)
         {
                 fprintf (stderr,
-                  (_("Warning in %s () illegal DXF version for this %s entity with id-code: %x.\n")),
+                  (_("Warning in %s () illegal DXF version for this %s entity with id-code: %" PRIx64 ".\n")),
                   __FUNCTION__, dxf_entity_name, spatial_index->id_code);
         }
         /* Start writing output. */
-        fprintf (fp->fp, "  0\n%s\n", dxf_entity_name);
-        if (spatial_index->id_code != -1)
+        dxf_write_string (fp, 0, dxf_entity_name);
+        if (spatial_index->id_code != DXF_HANDLE_NONE)
         {
-                fprintf (fp->fp, "  5\n%x\n", spatial_index->id_code);
+                dxf_write_hex (fp, 5, spatial_index->id_code);
         }
         /*!
          * \todo for version R14.\n
@@ -332,31 +334,31 @@ dxf_spatial_index_write
          * 102 groups are application defined (optional).\n\n
          * End of group, "}" (optional), with Group code 102.
          */
-        if ((strcmp (spatial_index->dictionary_owner_soft, "") != 0)
+        if ((spatial_index->dictionary_owner_soft != 0)
           && (fp->acad_version_number >= AutoCAD_14))
         {
-                fprintf (fp->fp, "102\n{ACAD_REACTORS\n");
-                fprintf (fp->fp, "330\n%s\n", spatial_index->dictionary_owner_soft);
-                fprintf (fp->fp, "102\n}\n");
+                dxf_write_string (fp, 102, "{ACAD_REACTORS");
+                dxf_write_hex (fp, 330, spatial_index->dictionary_owner_soft);
+                dxf_write_string (fp, 102, "}");
         }
-        if ((strcmp (spatial_index->dictionary_owner_hard, "") != 0)
+        if ((spatial_index->dictionary_owner_hard != 0)
           && (fp->acad_version_number >= AutoCAD_14))
         {
-                fprintf (fp->fp, "102\n{ACAD_XDICTIONARY\n");
-                fprintf (fp->fp, "360\n%s\n", spatial_index->dictionary_owner_hard);
-                fprintf (fp->fp, "102\n}\n");
+                dxf_write_string (fp, 102, "{ACAD_XDICTIONARY");
+                dxf_write_hex (fp, 360, spatial_index->dictionary_owner_hard);
+                dxf_write_string (fp, 102, "}");
         }
         if (fp->acad_version_number >= AutoCAD_13)
         {
-                fprintf (fp->fp, "100\nAcDbIndex\n");
+                dxf_write_string (fp, 100, "AcDbIndex");
         }
-        fprintf (fp->fp, " 40\n%f\n", spatial_index->time_stamp);
+        dxf_write_double (fp, 40, spatial_index->time_stamp);
         if (fp->acad_version_number >= AutoCAD_13)
         {
-                fprintf (fp->fp, "100\nAcDbSpatialIndex\n");
+                dxf_write_string (fp, 100, "AcDbSpatialIndex");
         }
         /* Clean up. */
-        free (dxf_entity_name);
+        dxf_free (dxf_entity_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -397,9 +399,7 @@ dxf_spatial_index_free
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        free (spatial_index->dictionary_owner_soft);
-        free (spatial_index->dictionary_owner_hard);
-        free (spatial_index);
+        dxf_free (spatial_index);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -445,7 +445,7 @@ dxf_spatial_index_free_list
  *
  * \return \c id_code.
  */
-int
+uint64_t
 dxf_spatial_index_get_id_code
 (
         DxfSpatialIndex *spatial_index
@@ -463,12 +463,6 @@ dxf_spatial_index_get_id_code
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (spatial_index->id_code < 0)
-        {
-                fprintf (stderr,
-                  (_("Warning in %s () a negative value was found.\n")),
-                  __FUNCTION__);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -484,7 +478,7 @@ dxf_spatial_index_set_id_code
 (
         DxfSpatialIndex *spatial_index,
                 /*!< a pointer to a DXF \c SPATIAL_INDEX object. */
-        int id_code
+        uint64_t id_code
                 /*!< the \c id_code to be set for the object.\n
                  * This is to be an unique (sequential) number in the
                  * DXF file. */
@@ -501,12 +495,6 @@ dxf_spatial_index_set_id_code
                   __FUNCTION__);
                 return (NULL);
         }
-        if (id_code < 0)
-        {
-                fprintf (stderr,
-                  (_("Warning in %s () a negative value was passed.\n")),
-                  __FUNCTION__);
-        }
         spatial_index->id_code = id_code;
 #if DEBUG
         DXF_DEBUG_END
@@ -519,11 +507,9 @@ dxf_spatial_index_set_id_code
  * \brief Get the pointer to the \c dictionary_owner_soft from a DXF 
  * \c SPATIAL_INDEX object.
  *
- * \return pointer to the \c dictionary_owner_soft.
- *
- * \warning No checks are performed on the returned pointer (string).
+ * \return the handle of the \c dictionary_owner_soft.
  */
-char *
+uint64_t
 dxf_spatial_index_get_dictionary_owner_soft
 (
         DxfSpatialIndex *spatial_index
@@ -539,19 +525,12 @@ dxf_spatial_index_get_dictionary_owner_soft
                 fprintf (stderr,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
-                return (NULL);
-        }
-        if (spatial_index->dictionary_owner_soft ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
+                return (0);
         }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (spatial_index->dictionary_owner_soft));
+        return (spatial_index->dictionary_owner_soft);
 }
 
 
@@ -564,8 +543,8 @@ dxf_spatial_index_set_dictionary_owner_soft
 (
         DxfSpatialIndex *spatial_index,
                 /*!< a pointer to a DXF \c SPATIAL_INDEX object. */
-        char *dictionary_owner_soft
-                /*!< a string containing the pointer to the \c
+        uint64_t dictionary_owner_soft
+                /*!< the handle of the \c
                  * dictionary_owner_soft for the object. */
 )
 {
@@ -580,14 +559,7 @@ dxf_spatial_index_set_dictionary_owner_soft
                   __FUNCTION__);
                 return (NULL);
         }
-        if (dictionary_owner_soft == NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was passed.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
-        spatial_index->dictionary_owner_soft = strdup (dictionary_owner_soft);
+        spatial_index->dictionary_owner_soft = dictionary_owner_soft;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -599,11 +571,9 @@ dxf_spatial_index_set_dictionary_owner_soft
  * \brief Get the pointer to the \c dictionary_owner_hard from a DXF 
  * \c SPATIAL_INDEX object.
  *
- * \return pointer to the \c dictionary_owner_hard.
- *
- * \warning No checks are performed on the returned pointer (string).
+ * \return the handle of the \c dictionary_owner_hard.
  */
-char *
+uint64_t
 dxf_spatial_index_get_dictionary_owner_hard
 (
         DxfSpatialIndex *spatial_index
@@ -619,19 +589,12 @@ dxf_spatial_index_get_dictionary_owner_hard
                 fprintf (stderr,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
-                return (NULL);
-        }
-        if (spatial_index->dictionary_owner_hard ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
+                return (0);
         }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (spatial_index->dictionary_owner_hard));
+        return (spatial_index->dictionary_owner_hard);
 }
 
 
@@ -644,8 +607,8 @@ dxf_spatial_index_set_dictionary_owner_hard
 (
         DxfSpatialIndex *spatial_index,
                 /*!< a pointer to a DXF \c SPATIAL_INDEX object. */
-        char *dictionary_owner_hard
-                /*!< a string containing the pointer to the \c
+        uint64_t dictionary_owner_hard
+                /*!< the handle of the \c
                  * dictionary_owner_hard for the object. */
 )
 {
@@ -660,14 +623,7 @@ dxf_spatial_index_set_dictionary_owner_hard
                   __FUNCTION__);
                 return (NULL);
         }
-        if (dictionary_owner_hard == NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was passed.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
-        spatial_index->dictionary_owner_hard = strdup (dictionary_owner_hard);
+        spatial_index->dictionary_owner_hard = dictionary_owner_hard;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -868,4 +824,1250 @@ dxf_spatial_index_get_last
 }
 
 
+/*!
+ * \brief Free a node of a \c DxfSpatialIndexTree and all it's child
+ * nodes.
+ */
+static void
+dxf_spatial_index_node_free
+(
+        DxfSpatialIndexNode *node
+                /*!< a pointer to a node. */
+)
+{
+        int i;
+
+        if (node == NULL)
+        {
+                return;
+        }
+        if (!node->leaf)
+        {
+                for (i = 0; i < node->number_of_entries; i++)
+                {
+                        dxf_spatial_index_node_free ((DxfSpatialIndexNode *) node->entries[i].child);
+                }
+        }
+        free (node);
+}
+
+
+/*!
+ * \brief Compute the bounding box of all entries of a node of a
+ * \c DxfSpatialIndexTree.
+ */
+static void
+dxf_spatial_index_node_get_bbox
+(
+        DxfSpatialIndexNode *node,
+                /*!< a pointer to a node. */
+        DxfBbox *bbox
+                /*!< a pointer to the bounding box to fill. */
+)
+{
+        int i;
+
+        dxf_bbox_init (bbox);
+        for (i = 0; i < node->number_of_entries; i++)
+        {
+                dxf_bbox_add_bbox (bbox, &node->entries[i].bbox);
+        }
+}
+
+
+/*!
+ * \brief Test if two bounding boxes overlap in plan (the XY plane).
+ *
+ * \return \c TRUE when they overlap or touch, \c FALSE otherwise.
+ */
+static int
+dxf_spatial_index_overlaps
+(
+        const DxfBbox *a,
+                /*!< a pointer to a bounding box. */
+        const DxfBbox *b
+                /*!< a pointer to another bounding box. */
+)
+{
+        return ((a->min.x <= b->max.x)
+          && (b->min.x <= a->max.x)
+          && (a->min.y <= b->max.y)
+          && (b->min.y <= a->max.y));
+}
+
+
+/*!
+ * \brief Compute the area of a bounding box in plan (the XY plane).
+ */
+static double
+dxf_spatial_index_area
+(
+        const DxfBbox *bbox
+                /*!< a pointer to a bounding box. */
+)
+{
+        return ((bbox->max.x - bbox->min.x) * (bbox->max.y - bbox->min.y));
+}
+
+
+/*!
+ * \brief Compute the square of the distance in plan (the XY plane)
+ * from a point to a bounding box.
+ *
+ * \return 0.0 for a point inside the box.
+ */
+static double
+dxf_spatial_index_distance
+(
+        const DxfBbox *bbox,
+                /*!< a pointer to a bounding box. */
+        double x,
+                /*!< X-value of the point. */
+        double y
+                /*!< Y-value of the point. */
+)
+{
+        double dx = 0.0;
+        double dy = 0.0;
+
+        if (x < bbox->min.x)
+        {
+                dx = bbox->min.x - x;
+        }
+        else if (x > bbox->max.x)
+        {
+                dx = x - bbox->max.x;
+        }
+        if (y < bbox->min.y)
+        {
+                dy = bbox->min.y - y;
+        }
+        else if (y > bbox->max.y)
+        {
+                dy = y - bbox->max.y;
+        }
+        return ((dx * dx) + (dy * dy));
+}
+
+
+/*!
+ * \brief Compare the X-values of the centers of two entries, for
+ * qsort ().
+ */
+static int
+dxf_spatial_index_compare_x
+(
+        const void *a,
+        const void *b
+)
+{
+        const DxfBbox *p = &((const DxfSpatialIndexEntry *) a)->bbox;
+        const DxfBbox *q = &((const DxfSpatialIndexEntry *) b)->bbox;
+        double u = p->min.x + p->max.x;
+        double v = q->min.x + q->max.x;
+
+        return ((u > v) - (u < v));
+}
+
+
+/*!
+ * \brief Compare the Y-values of the centers of two entries, for
+ * qsort ().
+ */
+static int
+dxf_spatial_index_compare_y
+(
+        const void *a,
+        const void *b
+)
+{
+        const DxfBbox *p = &((const DxfSpatialIndexEntry *) a)->bbox;
+        const DxfBbox *q = &((const DxfSpatialIndexEntry *) b)->bbox;
+        double u = p->min.y + p->max.y;
+        double v = q->min.y + q->max.y;
+
+        return ((u > v) - (u < v));
+}
+
+
+/*!
+ * \brief Pack entries into the nodes of a \c DxfSpatialIndexTree with
+ * Sort-Tile-Recursive (STR) bulk loading.
+ *
+ * The entries are sorted on the X-value of their centers and cut into
+ * vertical slices, the entries of a slice are sorted on the Y-value of
+ * their centers and packed into full nodes.\n
+ * The nodes of a level are packed the same way into the nodes of the
+ * level above, up to a single root node.
+ *
+ * \return the root node, or \c NULL when an error occurred.
+ */
+static DxfSpatialIndexNode *
+dxf_spatial_index_tree_pack
+(
+        DxfSpatialIndexTree *tree,
+                /*!< a pointer to a libDXF spatial index tree, it's
+                 * height is set. */
+        DxfSpatialIndexEntry *entries,
+                /*!< the entities to pack (reordered), at least one. */
+        size_t count
+                /*!< number of \c entries. */
+)
+{
+        DxfSpatialIndexEntry *level = entries;
+        DxfSpatialIndexEntry *parents = NULL;
+        DxfSpatialIndexNode *node = NULL;
+        size_t number_of_nodes;
+        size_t slice_size;
+        size_t i;
+        size_t j;
+        size_t n;
+        int leaf = TRUE;
+        int k;
+
+        tree->height = 0;
+        while (TRUE)
+        {
+                number_of_nodes = (count + DXF_SPATIAL_INDEX_NODE_ENTRIES - 1)
+                  / DXF_SPATIAL_INDEX_NODE_ENTRIES;
+                slice_size = (size_t) ceil (sqrt ((double) number_of_nodes))
+                  * DXF_SPATIAL_INDEX_NODE_ENTRIES;
+                qsort (level, count, sizeof (DxfSpatialIndexEntry),
+                  dxf_spatial_index_compare_x);
+                for (i = 0; i < count; i += slice_size)
+                {
+                        qsort (level + i, ((count - i) < slice_size) ? (count - i) : slice_size,
+                          sizeof (DxfSpatialIndexEntry), dxf_spatial_index_compare_y);
+                }
+                j = 0;
+                parents = malloc (number_of_nodes * sizeof (DxfSpatialIndexEntry));
+                if (parents == NULL)
+                {
+                        break;
+                }
+                for (i = 0, j = 0; i < count; i += n, j++)
+                {
+                        node = calloc (1, sizeof (DxfSpatialIndexNode));
+                        if (node == NULL)
+                        {
+                                break;
+                        }
+                        n = ((count - i) < DXF_SPATIAL_INDEX_NODE_ENTRIES)
+                          ? (count - i) : DXF_SPATIAL_INDEX_NODE_ENTRIES;
+                        memcpy (node->entries, level + i, n * sizeof (DxfSpatialIndexEntry));
+                        node->number_of_entries = (int) n;
+                        node->leaf = leaf;
+                        for (k = 0; !leaf && (k < node->number_of_entries); k++)
+                        {
+                                ((DxfSpatialIndexNode *) node->entries[k].child)->parent = node;
+                        }
+                        parents[j].child = node;
+                        parents[j].type = NULL;
+                        dxf_spatial_index_node_get_bbox (node, &parents[j].bbox);
+                }
+                if (node == NULL)
+                {
+                        break;
+                }
+                tree->height++;
+                if (level != entries)
+                {
+                        free (level);
+                }
+                level = parents;
+                parents = NULL;
+                count = number_of_nodes;
+                leaf = FALSE;
+                if (count == 1)
+                {
+                        node = (DxfSpatialIndexNode *) level[0].child;
+                        free (level);
+                        return (node);
+                }
+        }
+        /* Out of memory, free the nodes packed so far. */
+        fprintf (stderr,
+          (_("Error in %s () could not allocate memory.\n")),
+          __FUNCTION__);
+        for (n = 0; n < j; n++)
+        {
+                dxf_spatial_index_node_free ((DxfSpatialIndexNode *) parents[n].child);
+        }
+        for (i = j * DXF_SPATIAL_INDEX_NODE_ENTRIES; !leaf && (i < count); i++)
+        {
+                dxf_spatial_index_node_free ((DxfSpatialIndexNode *) level[i].child);
+        }
+        if (level != entries)
+        {
+                free (level);
+        }
+        free (parents);
+        tree->height = 0;
+        return (NULL);
+}
+
+
+/*!
+ * \brief Split an overfull node of a \c DxfSpatialIndexTree in two.
+ *
+ * The entries are sorted on the centers along the axis with the
+ * largest spread, the upper half moves to \c sibling.
+ */
+static void
+dxf_spatial_index_node_split
+(
+        DxfSpatialIndexNode *node,
+                /*!< a pointer to the overfull node. */
+        DxfSpatialIndexNode *sibling
+                /*!< a pointer to a zeroed node receiving the upper
+                 * half of the entries. */
+)
+{
+        DxfBbox centers;
+        int half;
+        int i;
+
+        dxf_bbox_init (&centers);
+        for (i = 0; i < node->number_of_entries; i++)
+        {
+                dxf_bbox_add_point (&centers,
+                  (node->entries[i].bbox.min.x + node->entries[i].bbox.max.x) / 2.0,
+                  (node->entries[i].bbox.min.y + node->entries[i].bbox.max.y) / 2.0,
+                  0.0);
+        }
+        qsort (node->entries, (size_t) node->number_of_entries,
+          sizeof (DxfSpatialIndexEntry),
+          ((centers.max.x - centers.min.x) >= (centers.max.y - centers.min.y))
+          ? dxf_spatial_index_compare_x : dxf_spatial_index_compare_y);
+        half = node->number_of_entries / 2;
+        sibling->leaf = node->leaf;
+        sibling->parent = node->parent;
+        sibling->number_of_entries = node->number_of_entries - half;
+        memcpy (sibling->entries, node->entries + half,
+          (size_t) sibling->number_of_entries * sizeof (DxfSpatialIndexEntry));
+        node->number_of_entries = half;
+        for (i = 0; !sibling->leaf && (i < sibling->number_of_entries); i++)
+        {
+                ((DxfSpatialIndexNode *) sibling->entries[i].child)->parent = sibling;
+        }
+}
+
+
+/*!
+ * \brief Insert an entry into a \c DxfSpatialIndexTree.
+ *
+ * The entry goes into the leaf whose box needs the least enlargement,
+ * overfull nodes are split on the way back up to the root.\n
+ * The nodes needed for the splits are allocated up front, so a failed
+ * allocation leaves the tree untouched.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+static int
+dxf_spatial_index_tree_insert_entry
+(
+        DxfSpatialIndexTree *tree,
+                /*!< a pointer to a libDXF spatial index tree. */
+        DxfSpatialIndexEntry *entry
+                /*!< a pointer to the entry of an entity. */
+)
+{
+        DxfSpatialIndexNode *spares[64];
+        DxfSpatialIndexNode *node;
+        DxfSpatialIndexNode *sibling;
+        DxfSpatialIndexNode *parent;
+        DxfBbox bbox;
+        double area;
+        double enlargement;
+        double best_area;
+        double best_enlargement;
+        int number_of_spares = 0;
+        int best;
+        int i;
+
+        if (tree->root == NULL)
+        {
+                tree->root = calloc (1, sizeof (DxfSpatialIndexNode));
+                if (tree->root == NULL)
+                {
+                        fprintf (stderr,
+                          (_("Error in %s () could not allocate memory.\n")),
+                          __FUNCTION__);
+                        return (EXIT_FAILURE);
+                }
+                tree->root->leaf = TRUE;
+                tree->height = 1;
+        }
+        /* Choose the leaf. */
+        node = tree->root;
+        while (!node->leaf)
+        {
+                best = 0;
+                best_area = DBL_MAX;
+                best_enlargement = DBL_MAX;
+                for (i = 0; i < node->number_of_entries; i++)
+                {
+                        area = dxf_spatial_index_area (&node->entries[i].bbox);
+                        bbox = node->entries[i].bbox;
+                        dxf_bbox_add_bbox (&bbox, &entry->bbox);
+                        enlargement = dxf_spatial_index_area (&bbox) - area;
+                        if ((enlargement < best_enlargement)
+                          || ((enlargement == best_enlargement) && (area < best_area)))
+                        {
+                                best = i;
+                                best_area = area;
+                                best_enlargement = enlargement;
+                        }
+                }
+                node = (DxfSpatialIndexNode *) node->entries[best].child;
+        }
+        /* One node for every full node on the path up, and one for a
+         * new root when the root is full too. */
+        for (parent = node; parent != NULL; parent = parent->parent)
+        {
+                if (parent->number_of_entries < DXF_SPATIAL_INDEX_NODE_ENTRIES)
+                {
+                        break;
+                }
+                if (parent->parent == NULL)
+                {
+                        number_of_spares++;
+                }
+                number_of_spares++;
+        }
+        for (i = 0; i < number_of_spares; i++)
+        {
+                if ((number_of_spares > (int) (sizeof (spares) / sizeof (spares[0])))
+                  || ((spares[i] = calloc (1, sizeof (DxfSpatialIndexNode))) == NULL))
+                {
+                        fprintf (stderr,
+                          (_("Error in %s () could not allocate memory.\n")),
+                          __FUNCTION__);
+                        while (--i >= 0)
+                        {
+                                free (spares[i]);
+                        }
+                        return (EXIT_FAILURE);
+                }
+        }
+        node->entries[node->number_of_entries] = *entry;
+        node->number_of_entries++;
+        tree->count++;
+        /* Split overfull nodes and adjust the boxes up to the root. */
+        while (TRUE)
+        {
+                sibling = NULL;
+                if (node->number_of_entries > DXF_SPATIAL_INDEX_NODE_ENTRIES)
+                {
+                        sibling = spares[--number_of_spares];
+                        dxf_spatial_index_node_split (node, sibling);
+                }
+                parent = node->parent;
+                if (parent == NULL)
+                {
+                        if (sibling != NULL)
+                        {
+                                parent = spares[--number_of_spares];
+                                parent->number_of_entries = 2;
+                                parent->entries[0].child = node;
+                                dxf_spatial_index_node_get_bbox (node, &parent->entries[0].bbox);
+                                parent->entries[1].child = sibling;
+                                dxf_spatial_index_node_get_bbox (sibling, &parent->entries[1].bbox);
+                                node->parent = parent;
+                                sibling->parent = parent;
+                                tree->root = parent;
+                                tree->height++;
+                        }
+                        break;
+                }
+                for (i = 0; parent->entries[i].child != node; i++)
+                {
+                        /* Find the entry of node. */
+                }
+                dxf_spatial_index_node_get_bbox (node, &parent->entries[i].bbox);
+                if (sibling != NULL)
+                {
+                        i = parent->number_of_entries;
+                        parent->entries[i].child = sibling;
+                        parent->entries[i].type = NULL;
+                        dxf_spatial_index_node_get_bbox (sibling, &parent->entries[i].bbox);
+                        parent->number_of_entries++;
+                }
+                node = parent;
+        }
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Find the leaf of a \c DxfSpatialIndexTree holding an entity.
+ *
+ * \return the leaf, or \c NULL when the entity was not found.
+ */
+static DxfSpatialIndexNode *
+dxf_spatial_index_node_find_leaf
+(
+        DxfSpatialIndexNode *node,
+                /*!< a pointer to the node to search. */
+        void *entity,
+                /*!< a pointer to the entity. */
+        DxfBbox *bbox,
+                /*!< the bounding box of the entity, only nodes
+                 * overlapping it are searched, or \c NULL to search
+                 * all nodes. */
+        int *index
+                /*!< returns the index of the entry of the entity in
+                 * the leaf. */
+)
+{
+        DxfSpatialIndexNode *leaf;
+        int i;
+
+        for (i = 0; i < node->number_of_entries; i++)
+        {
+                if ((bbox != NULL)
+                  && !dxf_spatial_index_overlaps (&node->entries[i].bbox, bbox))
+                {
+                        continue;
+                }
+                if (node->leaf)
+                {
+                        if (node->entries[i].child == entity)
+                        {
+                                *index = i;
+                                return (node);
+                        }
+                }
+                else if ((leaf = dxf_spatial_index_node_find_leaf ((DxfSpatialIndexNode *) node->entries[i].child,
+                  entity, bbox, index)) != NULL)
+                {
+                        return (leaf);
+                }
+        }
+        return (NULL);
+}
+
+
+/*!
+ * \brief Report the entities of a \c DxfSpatialIndexTree with a box
+ * overlapping a window.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when the
+ * callback stopped the search.
+ */
+static int
+dxf_spatial_index_node_search
+(
+        DxfSpatialIndexNode *node,
+                /*!< a pointer to the node to search. */
+        DxfBbox *window,
+                /*!< a pointer to the window. */
+        DxfEntityCallback on_entity,
+                /*!< function called for every entity found. */
+        void *user_data
+                /*!< passed on to \c on_entity. */
+)
+{
+        int i;
+
+        for (i = 0; i < node->number_of_entries; i++)
+        {
+                if (!dxf_spatial_index_overlaps (&node->entries[i].bbox, window))
+                {
+                        continue;
+                }
+                if (node->leaf)
+                {
+                        if (on_entity (node->entries[i].type, node->entries[i].child,
+                          user_data) != EXIT_SUCCESS)
+                        {
+                                return (EXIT_FAILURE);
+                        }
+                }
+                else if (dxf_spatial_index_node_search ((DxfSpatialIndexNode *) node->entries[i].child,
+                  window, on_entity, user_data) != EXIT_SUCCESS)
+                {
+                        return (EXIT_FAILURE);
+                }
+        }
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Allocate memory for an empty libDXF \c DxfSpatialIndexTree.
+ *
+ * \return a pointer to the tree, or \c NULL when an error occurred.
+ */
+DxfSpatialIndexTree *
+dxf_spatial_index_tree_new ()
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfSpatialIndexTree *tree = NULL;
+
+        tree = calloc (1, sizeof (DxfSpatialIndexTree));
+        if (tree == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () could not allocate memory.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (tree);
+}
+
+
+/*!
+ * \brief Free a libDXF \c DxfSpatialIndexTree and all it's nodes.
+ *
+ * The entities are not freed.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_spatial_index_tree_free
+(
+        DxfSpatialIndexTree *tree
+                /*!< a pointer to a libDXF spatial index tree. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        /* Do some basic checks. */
+        if (tree == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        dxf_spatial_index_node_free (tree->root);
+        free (tree);
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Insert an entity into a libDXF \c DxfSpatialIndexTree.
+ *
+ * Use this for an entity added to a drawing, and after a
+ * dxf_spatial_index_tree_remove () for an entity whose geometry was
+ * edited.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred or the bounding box of \c type entities is not supported.
+ */
+int
+dxf_spatial_index_tree_insert
+(
+        DxfSpatialIndexTree *tree,
+                /*!< a pointer to a libDXF spatial index tree. */
+        const char *type,
+                /*!< Entity type name, for example "LINE". */
+        void *entity
+                /*!< a pointer to the entity. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfSpatialIndexEntry entry;
+
+        /* Do some basic checks. */
+        if ((tree == NULL) || (type == NULL) || (entity == NULL))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        if ((dxf_entity_get_bbox (type, entity, &entry.bbox) == EXIT_FAILURE)
+          || dxf_bbox_is_empty (&entry.bbox))
+        {
+                fprintf (stderr,
+                  (_("Warning in %s () the %s entity has no bounding box.\n")),
+                  __FUNCTION__, type);
+                return (EXIT_FAILURE);
+        }
+        entry.child = entity;
+        entry.type = type;
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (dxf_spatial_index_tree_insert_entry (tree, &entry));
+}
+
+
+/*!
+ * \brief Remove an entity from a libDXF \c DxfSpatialIndexTree.
+ *
+ * The entity is looked up by it's current bounding box, with a search
+ * of the whole tree when it moved since it was inserted.\n
+ * Nodes left empty are removed, and the root is shortened while it
+ * has a single child.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred or \c entity was not found.
+ */
+int
+dxf_spatial_index_tree_remove
+(
+        DxfSpatialIndexTree *tree,
+                /*!< a pointer to a libDXF spatial index tree. */
+        const char *type,
+                /*!< Entity type name, for example "LINE". */
+        void *entity
+                /*!< a pointer to the entity. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfSpatialIndexNode *leaf = NULL;
+        DxfSpatialIndexNode *node;
+        DxfSpatialIndexNode *parent;
+        DxfBbox bbox;
+        int index = 0;
+        int i;
+
+        /* Do some basic checks. */
+        if ((tree == NULL) || (type == NULL) || (entity == NULL))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        if (tree->root != NULL)
+        {
+                if ((dxf_entity_get_bbox (type, entity, &bbox) == EXIT_SUCCESS)
+                  && !dxf_bbox_is_empty (&bbox))
+                {
+                        leaf = dxf_spatial_index_node_find_leaf (tree->root, entity, &bbox, &index);
+                }
+                if (leaf == NULL)
+                {
+                        leaf = dxf_spatial_index_node_find_leaf (tree->root, entity, NULL, &index);
+                }
+        }
+        if (leaf == NULL)
+        {
+                fprintf (stderr,
+                  (_("Warning in %s () the %s entity was not found in the spatial index.\n")),
+                  __FUNCTION__, type);
+                return (EXIT_FAILURE);
+        }
+        leaf->number_of_entries--;
+        leaf->entries[index] = leaf->entries[leaf->number_of_entries];
+        tree->count--;
+        /* Drop empty nodes and adjust the boxes up to the root. */
+        for (node = leaf; node->parent != NULL; node = parent)
+        {
+                parent = node->parent;
+                for (i = 0; parent->entries[i].child != node; i++)
+                {
+                        /* Find the entry of node. */
+                }
+                if (node->number_of_entries == 0)
+                {
+                        parent->number_of_entries--;
+                        parent->entries[i] = parent->entries[parent->number_of_entries];
+                        free (node);
+                }
+                else
+                {
+                        dxf_spatial_index_node_get_bbox (node, &parent->entries[i].bbox);
+                }
+        }
+        while ((!tree->root->leaf) && (tree->root->number_of_entries == 1))
+        {
+                node = tree->root;
+                tree->root = (DxfSpatialIndexNode *) node->entries[0].child;
+                tree->root->parent = NULL;
+                tree->height--;
+                free (node);
+        }
+        if (tree->root->number_of_entries == 0)
+        {
+                free (tree->root);
+                tree->root = NULL;
+                tree->height = 0;
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Add the entities of a DXF \c ENTITIES section to a libDXF
+ * \c DxfSpatialIndexTree.
+ *
+ * An empty tree is bulk loaded with Sort-Tile-Recursive packing, the
+ * entities are inserted one by one into a tree holding entities
+ * already.\n
+ * Entities without a (supported) bounding box are skipped.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_spatial_index_tree_add_entities
+(
+        DxfSpatialIndexTree *tree,
+                /*!< a pointer to a libDXF spatial index tree. */
+        DxfEntities *entities
+                /*!< a pointer to the DXF \c ENTITIES section. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfEntitiesCursor cursor;
+        DxfSpatialIndexEntry *entries = NULL;
+        DxfSpatialIndexEntry *new_entries;
+        size_t count = 0;
+        size_t capacity = 0;
+        size_t i;
+        int result = EXIT_SUCCESS;
+
+        /* Do some basic checks. */
+        if ((tree == NULL) || (entities == NULL))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        dxf_entities_cursor_init (&cursor, entities);
+        while (cursor.entity != NULL)
+        {
+                if (count == capacity)
+                {
+                        capacity = (capacity == 0) ? 1024 : 2 * capacity;
+                        new_entries = realloc (entries, capacity * sizeof (DxfSpatialIndexEntry));
+                        if (new_entries == NULL)
+                        {
+                                fprintf (stderr,
+                                  (_("Error in %s () could not allocate memory.\n")),
+                                  __FUNCTION__);
+                                free (entries);
+                                return (EXIT_FAILURE);
+                        }
+                        entries = new_entries;
+                }
+                entries[count].type = dxf_entities_cursor_get_type (&cursor);
+                entries[count].child = cursor.entity;
+                if ((dxf_entity_get_bbox (entries[count].type, cursor.entity,
+                  &entries[count].bbox) == EXIT_SUCCESS)
+                  && !dxf_bbox_is_empty (&entries[count].bbox))
+                {
+                        count++;
+                }
+                dxf_entities_cursor_skip (&cursor, 1);
+        }
+        if ((tree->root == NULL) && (count > 0))
+        {
+                tree->root = dxf_spatial_index_tree_pack (tree, entries, count);
+                if (tree->root == NULL)
+                {
+                        result = EXIT_FAILURE;
+                }
+                else
+                {
+                        tree->count = count;
+                }
+        }
+        else
+        {
+                for (i = 0; (i < count) && (result == EXIT_SUCCESS); i++)
+                {
+                        result = dxf_spatial_index_tree_insert_entry (tree, &entries[i]);
+                }
+        }
+        free (entries);
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (result);
+}
+
+
+/*!
+ * \brief Find the entities in a libDXF \c DxfSpatialIndexTree with a
+ * bounding box overlapping a window in plan (the XY plane).
+ *
+ * The Z-values of \c window are not used.\n
+ * Entities are reported by their bounding box, use this for viewport
+ * culling or as a first pass before an exact test.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred or \c on_entity stopped the search.
+ */
+int
+dxf_spatial_index_tree_search_window
+(
+        DxfSpatialIndexTree *tree,
+                /*!< a pointer to a libDXF spatial index tree. */
+        DxfBbox *window,
+                /*!< a pointer to the window. */
+        DxfEntityCallback on_entity,
+                /*!< function called with the type name and a pointer
+                 * of every entity found (not owned), return
+                 * \c EXIT_SUCCESS to continue the search. */
+        void *user_data
+                /*!< passed on to \c on_entity. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        /* Do some basic checks. */
+        if ((tree == NULL) || (window == NULL) || (on_entity == NULL))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        if (tree->root == NULL)
+        {
+                return (EXIT_SUCCESS);
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (dxf_spatial_index_node_search (tree->root, window, on_entity, user_data));
+}
+
+
+/*!
+ * \brief Find the entities in a libDXF \c DxfSpatialIndexTree with a
+ * bounding box containing a point in plan (the XY plane), give or
+ * take a tolerance.
+ *
+ * Use this to find the candidates for the entity under the cursor,
+ * with the pick box size as \c tolerance.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred or \c on_entity stopped the search.
+ */
+int
+dxf_spatial_index_tree_search_point
+(
+        DxfSpatialIndexTree *tree,
+                /*!< a pointer to a libDXF spatial index tree. */
+        double x,
+                /*!< X-value of the point. */
+        double y,
+                /*!< Y-value of the point. */
+        double tolerance,
+                /*!< Distance from the point a bounding box may be. */
+        DxfEntityCallback on_entity,
+                /*!< function called with the type name and a pointer
+                 * of every entity found (not owned), return
+                 * \c EXIT_SUCCESS to continue the search. */
+        void *user_data
+                /*!< passed on to \c on_entity. */
+)
+{
+        DxfBbox window;
+
+        window.min.x = x - fabs (tolerance);
+        window.min.y = y - fabs (tolerance);
+        window.min.z = 0.0;
+        window.max.x = x + fabs (tolerance);
+        window.max.y = y + fabs (tolerance);
+        window.max.z = 0.0;
+        return (dxf_spatial_index_tree_search_window (tree, &window, on_entity, user_data));
+}
+
+
+/*!
+ * \brief Item of the priority queue of
+ * dxf_spatial_index_tree_nearest ().
+ */
+typedef struct
+dxf_spatial_index_queue_item_struct
+{
+        double distance;
+                /*!< Square of the distance to the bounding box. */
+        DxfSpatialIndexEntry *entry;
+                /*!< The entry of a node or an entity. */
+} DxfSpatialIndexQueueItem;
+
+
+/*!
+ * \brief Push an item on the binary heap of
+ * dxf_spatial_index_tree_nearest ().
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+static int
+dxf_spatial_index_queue_push
+(
+        DxfSpatialIndexQueueItem **queue,
+                /*!< the heap, reallocated when full. */
+        size_t *count,
+                /*!< number of items on the heap. */
+        size_t *capacity,
+                /*!< number of items the heap has room for. */
+        double distance,
+                /*!< square of the distance to the bounding box. */
+        DxfSpatialIndexEntry *entry
+                /*!< the entry of a node or an entity. */
+)
+{
+        DxfSpatialIndexQueueItem *items;
+        size_t i;
+
+        if (*count == *capacity)
+        {
+                items = realloc (*queue, 2 * (*capacity) * sizeof (DxfSpatialIndexQueueItem));
+                if (items == NULL)
+                {
+                        fprintf (stderr,
+                          (_("Error in %s () could not allocate memory.\n")),
+                          __FUNCTION__);
+                        return (EXIT_FAILURE);
+                }
+                *queue = items;
+                *capacity *= 2;
+        }
+        items = *queue;
+        for (i = (*count)++; (i > 0) && (items[(i - 1) / 2].distance > distance); i = (i - 1) / 2)
+        {
+                items[i] = items[(i - 1) / 2];
+        }
+        items[i].distance = distance;
+        items[i].entry = entry;
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Pop the nearest item from the binary heap of
+ * dxf_spatial_index_tree_nearest ().
+ */
+static DxfSpatialIndexQueueItem
+dxf_spatial_index_queue_pop
+(
+        DxfSpatialIndexQueueItem *queue,
+                /*!< the heap, not empty. */
+        size_t *count
+                /*!< number of items on the heap. */
+)
+{
+        DxfSpatialIndexQueueItem top = queue[0];
+        DxfSpatialIndexQueueItem last = queue[--(*count)];
+        size_t i = 0;
+        size_t child;
+
+        while ((child = (2 * i) + 1) < *count)
+        {
+                if (((child + 1) < *count)
+                  && (queue[child + 1].distance < queue[child].distance))
+                {
+                        child++;
+                }
+                if (queue[child].distance >= last.distance)
+                {
+                        break;
+                }
+                queue[i] = queue[child];
+                i = child;
+        }
+        queue[i] = last;
+        return (top);
+}
+
+
+/*!
+ * \brief Find the entities in a libDXF \c DxfSpatialIndexTree nearest
+ * to a point in plan (the XY plane).
+ *
+ * A best first search on the distance from the point to the bounding
+ * boxes, an entity whose box contains the point is at distance 0.\n
+ * The entries are returned nearest first.
+ *
+ * \return the number of entries stored in \c nearest, at most \c k.
+ */
+size_t
+dxf_spatial_index_tree_nearest
+(
+        DxfSpatialIndexTree *tree,
+                /*!< a pointer to a libDXF spatial index tree. */
+        double x,
+                /*!< X-value of the point. */
+        double y,
+                /*!< Y-value of the point. */
+        size_t k,
+                /*!< maximum number of entities to find. */
+        DxfSpatialIndexEntry *nearest
+                /*!< room for \c k entries, returns the bounding box,
+                 * the entity (\c child) and the type name of the
+                 * entities found. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfSpatialIndexQueueItem *queue;
+        DxfSpatialIndexQueueItem item;
+        DxfSpatialIndexEntry root;
+        DxfSpatialIndexNode *node;
+        size_t count = 0;
+        size_t capacity = 64;
+        size_t found = 0;
+        int i;
+
+        /* Do some basic checks. */
+        if ((tree == NULL) || (nearest == NULL))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (0);
+        }
+        if ((tree->root == NULL) || (k == 0))
+        {
+                return (0);
+        }
+        queue = malloc (capacity * sizeof (DxfSpatialIndexQueueItem));
+        if (queue == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () could not allocate memory.\n")),
+                  __FUNCTION__);
+                return (0);
+        }
+        root.child = tree->root;
+        root.type = NULL;
+        dxf_spatial_index_queue_push (&queue, &count, &capacity, 0.0, &root);
+        while ((count > 0) && (found < k))
+        {
+                item = dxf_spatial_index_queue_pop (queue, &count);
+                if (item.entry->type != NULL)
+                {
+                        /* No box left on the heap is nearer. */
+                        nearest[found++] = *item.entry;
+                        continue;
+                }
+                node = (DxfSpatialIndexNode *) item.entry->child;
+                for (i = 0; i < node->number_of_entries; i++)
+                {
+                        if (dxf_spatial_index_queue_push (&queue, &count, &capacity,
+                          dxf_spatial_index_distance (&node->entries[i].bbox, x, y),
+                          &node->entries[i]) == EXIT_FAILURE)
+                        {
+                                count = 0;
+                                break;
+                        }
+                }
+        }
+        free (queue);
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (found);
+}
+
+
+/*!
+ * \brief Get the number of entities in a libDXF
+ * \c DxfSpatialIndexTree.
+ *
+ * \return the number of entities.
+ */
+size_t
+dxf_spatial_index_tree_get_count
+(
+        DxfSpatialIndexTree *tree
+                /*!< a pointer to a libDXF spatial index tree. */
+)
+{
+        /* Do some basic checks. */
+        if (tree == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (0);
+        }
+        return (tree->count);
+}
+
+
+/*!
+ * \brief Write a \c SPATIAL_INDEX object for a libDXF
+ * \c DxfSpatialIndexTree to a DXF file.
+ *
+ * The layout of the index data AutoCAD keeps in a \c SPATIAL_INDEX is
+ * not documented, the object is written with the time stamp of the
+ * tree only and the tree is rebuilt from the entities when a drawing
+ * is read.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_spatial_index_tree_write
+(
+        DxfFile *fp,
+                /*!< DXF file pointer to an output file (or device). */
+        DxfSpatialIndexTree *tree,
+                /*!< a pointer to a libDXF spatial index tree. */
+        uint64_t owner,
+                /*!< Handle of the dictionary owning the
+                 * \c SPATIAL_INDEX object. */
+        uint64_t *handle_seed
+                /*!< Next free handle, returns the next handle not
+                 * used. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfSpatialIndex *spatial_index = NULL;
+        int result;
+
+        /* Do some basic checks. */
+        if ((fp == NULL) || (tree == NULL) || (handle_seed == NULL))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        spatial_index = dxf_spatial_index_init (dxf_spatial_index_new ());
+        if (spatial_index == NULL)
+        {
+                return (EXIT_FAILURE);
+        }
+        spatial_index->id_code = (*handle_seed)++;
+        spatial_index->dictionary_owner_soft = owner;
+        /* Julian date of the Unix epoch plus the days since. */
+        spatial_index->time_stamp = 2440587.5 + (double) time (NULL) / 86400.0;
+        result = dxf_spatial_index_write (fp, spatial_index);
+        dxf_spatial_index_free (spatial_index);
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (result);
+}
+
+
 /* EOF*/
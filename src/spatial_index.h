@@ -49,6 +49,7 @@
 
 
 #include "global.h"
+#include "entities.h"
 
 
 #ifdef __cplusplus
@@ -63,15 +64,15 @@ typedef struct
 dxf_spatial_index_struct
 {
         /* Members common for all DXF objects. */
-        int id_code;
+        uint64_t id_code;
                 /*!< Identification number for the entity.\n
                  * This is to be an unique (sequential) number in the DXF
                  * file.\n
                  * Group code = 5. */
-        char *dictionary_owner_soft;
+        uint64_t dictionary_owner_soft;
                 /*!< Soft-pointer ID/handle to owner dictionary.\n
                  * Group code = 330. */
-        char *dictionary_owner_hard;
+        uint64_t dictionary_owner_hard;
                 /*!< Hard owner ID/handle to owner dictionary (optional).\n
                  * Group code = 360. */
         /* Specific members for a DXF spatial_index. */
@@ -84,23 +85,100 @@ dxf_spatial_index_struct
 } DxfSpatialIndex;
 
 
+/*!
+ * \brief Maximum number of entries in a node of a
+ * \c DxfSpatialIndexTree.
+ */
+#define DXF_SPATIAL_INDEX_NODE_ENTRIES 16
+
+
+/*!
+ * \brief DXF definition of an entry in a node of a
+ * \c DxfSpatialIndexTree.
+ */
+typedef struct
+dxf_spatial_index_entry_struct
+{
+        DxfBbox bbox;
+                /*!< Bounding box of the entity, or of all entries of
+                 * the child node. */
+        void *child;
+                /*!< The entity in a leaf node, the child node
+                 * otherwise. */
+        const char *type;
+                /*!< Type name of the entity, for example "LINE" (not
+                 * owned), \c NULL in a node that is not a leaf. */
+} DxfSpatialIndexEntry;
+
+
+/*!
+ * \brief DXF definition of a node of a \c DxfSpatialIndexTree.
+ */
+typedef struct
+dxf_spatial_index_node_struct
+{
+        struct dxf_spatial_index_node_struct *parent;
+                /*!< Parent node, \c NULL for the root node. */
+        int leaf;
+                /*!< \c TRUE when the entries hold entities. */
+        int number_of_entries;
+                /*!< Number of entries in use. */
+        DxfSpatialIndexEntry entries[DXF_SPATIAL_INDEX_NODE_ENTRIES + 1];
+                /*!< Entries, with room for one more entry than allowed
+                 * while a node is split. */
+} DxfSpatialIndexNode;
+
+
+/*!
+ * \brief DXF definition of a spatial index tree.
+ *
+ * An R-tree over the bounding boxes of entities, bulk loaded with
+ * Sort-Tile-Recursive packing and kept up to date with incremental
+ * inserts and removals.\n
+ * Queries work in plan (the XY plane), for viewport culling and for
+ * finding the entities under the cursor.\n
+ * The tree does not own the entities, it has to be rebuilt or freed
+ * when entities are freed.
+ */
+typedef struct
+dxf_spatial_index_tree_struct
+{
+        DxfSpatialIndexNode *root;
+                /*!< Root node, \c NULL in an empty tree. */
+        size_t count;
+                /*!< Number of entities in the tree. */
+        int height;
+                /*!< Number of levels of nodes, 0 in an empty tree. */
+} DxfSpatialIndexTree;
+
+
 DxfSpatialIndex *dxf_spatial_index_new ();
 DxfSpatialIndex *dxf_spatial_index_init (DxfSpatialIndex *spatial_index);
 DxfSpatialIndex *dxf_spatial_index_read (DxfFile *fp, DxfSpatialIndex *spatial_index);
 int dxf_spatial_index_write (DxfFile *fp, DxfSpatialIndex *spatial_index);
 int dxf_spatial_index_free (DxfSpatialIndex *spatial_index);
 void dxf_spatial_index_free_list (DxfSpatialIndex *spatial_indices);
-int dxf_spatial_index_get_id_code (DxfSpatialIndex *spatial_index);
-DxfSpatialIndex *dxf_spatial_index_set_id_code (DxfSpatialIndex *spatial_index, int id_code);
-char *dxf_spatial_index_get_dictionary_owner_soft (DxfSpatialIndex *spatial_index);
-DxfSpatialIndex *dxf_spatial_index_set_dictionary_owner_soft (DxfSpatialIndex *spatial_index, char *dictionary_owner_soft);
-char *dxf_spatial_index_get_dictionary_owner_hard (DxfSpatialIndex *spatial_index);
-DxfSpatialIndex *dxf_spatial_index_set_dictionary_owner_hard (DxfSpatialIndex *spatial_index, char *dictionary_owner_hard);
+uint64_t dxf_spatial_index_get_id_code (DxfSpatialIndex *spatial_index);
+DxfSpatialIndex *dxf_spatial_index_set_id_code (DxfSpatialIndex *spatial_index, uint64_t id_code);
+uint64_t dxf_spatial_index_get_dictionary_owner_soft (DxfSpatialIndex *spatial_index);
+DxfSpatialIndex *dxf_spatial_index_set_dictionary_owner_soft (DxfSpatialIndex *spatial_index, uint64_t dictionary_owner_soft);
+uint64_t dxf_spatial_index_get_dictionary_owner_hard (DxfSpatialIndex *spatial_index);
+DxfSpatialIndex *dxf_spatial_index_set_dictionary_owner_hard (DxfSpatialIndex *spatial_index, uint64_t dictionary_owner_hard);
 double dxf_spatial_index_get_time_stamp (DxfSpatialIndex *spatial_index);
 DxfSpatialIndex *dxf_spatial_index_set_time_stamp (DxfSpatialIndex *spatial_index, double time_stamp);
 DxfSpatialIndex *dxf_spatial_index_get_next (DxfSpatialIndex *spatial_index);
 DxfSpatialIndex *dxf_spatial_index_set_next (DxfSpatialIndex *spatial_index, DxfSpatialIndex *next);
 DxfSpatialIndex *dxf_spatial_index_get_last (DxfSpatialIndex *spatial_index);
+DxfSpatialIndexTree *dxf_spatial_index_tree_new ();
+int dxf_spatial_index_tree_free (DxfSpatialIndexTree *tree);
+int dxf_spatial_index_tree_insert (DxfSpatialIndexTree *tree, const char *type, void *entity);
+int dxf_spatial_index_tree_remove (DxfSpatialIndexTree *tree, const char *type, void *entity);
+int dxf_spatial_index_tree_add_entities (DxfSpatialIndexTree *tree, DxfEntities *entities);
+int dxf_spatial_index_tree_search_window (DxfSpatialIndexTree *tree, DxfBbox *window, DxfEntityCallback on_entity, void *user_data);
+int dxf_spatial_index_tree_search_point (DxfSpatialIndexTree *tree, double x, double y, double tolerance, DxfEntityCallback on_entity, void *user_data);
+size_t dxf_spatial_index_tree_nearest (DxfSpatialIndexTree *tree, double x, double y, size_t k, DxfSpatialIndexEntry *nearest);
+size_t dxf_spatial_index_tree_get_count (DxfSpatialIndexTree *tree);
+int dxf_spatial_index_tree_write (DxfFile *fp, DxfSpatialIndexTree *tree, uint64_t owner, uint64_t *handle_seed);
 
 
 #ifdef __cplusplus
@@ -231,6 +231,7 @@
 
 
 #include "spline.h"
+#include "bbox.h"
 
 
 /*!
@@ -253,7 +254,7 @@ dxf_spline_new ()
         size = sizeof (DxfSpline);
         /* avoid malloc of 0 bytes */
         if (size == 0) size = 1;
-        if ((spline = malloc (size)) == NULL)
+        if ((spline = dxf_malloc (size)) == NULL)
         {
                 fprintf (stderr,
                   (_("Error in %s () could not allocate memory for a DxfSpline struct.\n")),
@@ -303,9 +304,9 @@ dxf_spline_init
                   __FUNCTION__);
                 return (NULL);
         }
-        spline->id_code = 0;
-        spline->linetype = strdup (DXF_DEFAULT_LINETYPE);
-        spline->layer = strdup (DXF_DEFAULT_LAYER);
+        spline->id_code = DXF_HANDLE_NONE;
+        spline->linetype = dxf_strdup (DXF_DEFAULT_LINETYPE);
+        spline->layer = dxf_strdup (DXF_DEFAULT_LAYER);
         spline->elevation = 0.0;
         spline->thickness = 0.0;
         spline->linetype_scale = 1.0;
@@ -315,22 +316,24 @@ dxf_spline_init
         spline->graphics_data_size = 0;
         spline->shadow_mode = 0;
         dxf_binary_graphics_data_init ((DxfBinaryGraphicsData *) spline->binary_graphics_data);
-        spline->dictionary_owner_soft = strdup ("");
-        spline->material = strdup ("");
-        spline->dictionary_owner_hard = strdup ("");
+        spline->dictionary_owner_soft = 0;
+        spline->material = 0;
+        spline->dictionary_owner_hard = 0;
         spline->lineweight = 0;
-        spline->plot_style_name = strdup ("");
+        spline->plot_style_name = 0;
         spline->color_value = 0;
-        spline->color_name = strdup ("");
+        spline->color_name = dxf_strdup ("");
         spline->transparency = 0;
         spline->p0 = dxf_point_new ();
         spline->p0 = dxf_point_init (spline->p0);
         spline->p1 = dxf_point_new ();
         spline->p1 = dxf_point_init (spline->p1);
-        spline->p2 = dxf_point_new ();
-        spline->p2 = dxf_point_init (spline->p2);
-        spline->p3 = dxf_point_new ();
-        spline->p3 = dxf_point_init (spline->p3);
+        spline->p2.x = 0.0;
+        spline->p2.y = 0.0;
+        spline->p2.z = 0.0;
+        spline->p3.x = 0.0;
+        spline->p3.y = 0.0;
+        spline->p3.z = 0.0;
         dxf_double_new (spline->knot_value);
         spline->knot_value = dxf_double_init (spline->knot_value);
         spline->knot_value->value = 0.0;
@@ -379,12 +382,11 @@ dxf_spline_read
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        char *temp_string = NULL;
+        char temp_string[DXF_MAX_STRING_LENGTH];
+        int group_code;
         DxfBinaryGraphicsData *binary_graphics_data = NULL;
         DxfPoint *p0 = NULL;
         DxfPoint *p1 = NULL;
-        DxfPoint *p2 = NULL;
-        DxfPoint *p3 = NULL;
         DxfDouble *kv = NULL; /* knot_value iter. */
         DxfDouble *wv = NULL; /* weight value iter. */
 
@@ -394,8 +396,6 @@ dxf_spline_read
                 fprintf (stderr,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
-                /* Clean up. */
-                free (temp_string);
                 return (NULL);
         }
         if (spline == NULL)
@@ -408,353 +408,272 @@ dxf_spline_read
         binary_graphics_data = (DxfBinaryGraphicsData *) spline->binary_graphics_data;
         p0 = (DxfPoint *) spline->p0;
         p1 = (DxfPoint *) spline->p1;
-        p2 = (DxfPoint *) spline->p2;
-        p3 = (DxfPoint *) spline->p3;
         kv = (DxfDouble *) spline->knot_value;
         wv = (DxfDouble *) spline->weight_value;
-        (fp->line_number)++;
-        fscanf (fp->fp, "%[^\n]", temp_string);
-        while (strcmp (temp_string, "0") != 0)
+        while ((dxf_read_group_code (fp, &group_code) == EXIT_SUCCESS)
+          && (group_code != 0))
         {
-                if (ferror (fp->fp))
+                if (dxf_read_error (fp))
                 {
                         fprintf (stderr,
                           (_("Error in %s () while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
-                        fclose (fp->fp);
-                        /* Clean up. */
-                        free (temp_string);
                         return (NULL);
                 }
-                if (strcmp (temp_string, "5") == 0)
-                {
-                        /* Now follows a string containing a sequential
-                         * id number. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%x\n", (uint *) &spline->id_code);
-                }
-                else if (strcmp (temp_string, "6") == 0)
-                {
-                        /* Now follows a string containing a linetype
-                         * name. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, spline->linetype);
-                }
-                else if (strcmp (temp_string, "8") == 0)
-                {
-                        /* Now follows a string containing a layer name. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, spline->layer);
-                }
-                else if (strcmp (temp_string, "10") == 0)
-                {
-                        /* Now follows a string containing the
-                         * X-value of the control point coordinate
-                         * (multiple entries). */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &p0->x0);
-                }
-                else if (strcmp (temp_string, "20") == 0)
-                {
-                        /* Now follows a string containing the
-                         * Y-coordinate of control point coordinate
-                         * (multiple entries). */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &p0->y0);
-                }
-                else if (strcmp (temp_string, "30") == 0)
-                {
-                        /* Now follows a string containing the
-                         * Z-coordinate of the control point coordinate
-                         * (multiple entries). */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &p0->z0);
-                        dxf_point_init ((DxfPoint *) p0->next);
-                        p0 = (DxfPoint *) p0->next;
-                }
-                else if (strcmp (temp_string, "11") == 0)
-                {
-                        /* Now follows a string containing the
-                         * X-coordinate of the fit point coordinate
-                         * (multiple entries). */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &p1->x0);
-                }
-                else if (strcmp (temp_string, "21") == 0)
-                {
-                        /* Now follows a string containing the
-                         * Y-coordinate of the fit point coordinate
-                         * (multiple entries). */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &p1->y0);
-                }
-                else if (strcmp (temp_string, "31") == 0)
-                {
-                        /* Now follows a string containing the
-                         * Z-coordinate of the fit point coordinate
-                         * (multiple entries). */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &p1->z0);
-                        dxf_point_init ((DxfPoint *) p1->next);
-                        p1 = (DxfPoint *) p1->next;
-                }
-                else if (strcmp (temp_string, "12") == 0)
-                {
-                        /* Now follows a string containing the
-                         * X-coordinate of the start tangent,
-                         * may be omitted (in WCS). */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &p2->x0);
-                }
-                else if (strcmp (temp_string, "22") == 0)
-                {
-                        /* Now follows a string containing the
-                         * Y-coordinate of the start tangent,
-                         * may be omitted (in WCS). */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &p2->y0);
-                }
-                else if (strcmp (temp_string, "32") == 0)
-                {
-                        /* Now follows a string containing the
-                         * Z-coordinate of the start tangent,
-                         * may be omitted (in WCS). */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &p2->z0);
-                }
-                else if (strcmp (temp_string, "13") == 0)
-                {
-                        /* Now follows a string containing the
-                         * X-coordinate of the end tangent,
-                         * may be omitted (in WCS). */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &p3->x0);
-                }
-                else if (strcmp (temp_string, "23") == 0)
-                {
-                        /* Now follows a string containing the
-                         * Y-coordinate of the end tangent,
-                         * may be omitted (in WCS). */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &p3->y0);
-                }
-                else if (strcmp (temp_string, "33") == 0)
-                {
-                        /* Now follows a string containing the
-                         * Z-coordinate of the end tangent,
-                         * may be omitted (in WCS). */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &p3->z0);
-                }
-                else if ((fp->acad_version_number <= AutoCAD_11)
-                        && (strcmp (temp_string, "38") == 0)
-                        && (spline->elevation != 0.0))
-                {
-                        /* Now follows a string containing the
-                         * elevation. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &spline->elevation);
-                }
-                else if (strcmp (temp_string, "39") == 0)
-                {
-                        /* Now follows a thickness value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &spline->thickness);
-                }
-                else if (strcmp (temp_string, "40") == 0)
-                {
-                        /* Now follows a knot value (one entry per knot, multiple entries). */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &kv->value);
-                        dxf_double_init ((DxfDouble *) kv->next);
-                        kv = (DxfDouble *) kv->next;
-                }
-                else if (strcmp (temp_string, "41") == 0)
-                {
-                        /* Now follows a weight value (one entry per knot, multiple entries). */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &wv->value);
-                        dxf_double_init ((DxfDouble *) wv->next);
-                        wv = (DxfDouble *) wv->next;
-                }
-                else if (strcmp (temp_string, "42") == 0)
-                {
-                        /* Now follows a knot tolerance value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &spline->knot_tolerance);
-                }
-                else if (strcmp (temp_string, "43") == 0)
-                {
-                        /* Now follows a control point tolerance value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &spline->control_point_tolerance);
-                }
-                else if (strcmp (temp_string, "44") == 0)
-                {
-                        /* Now follows a fit point tolerance value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &spline->fit_tolerance);
-                }
-                else if (strcmp (temp_string, "48") == 0)
-                {
-                        /* Now follows a linetype scale value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &spline->linetype_scale);
-                }
-                else if (strcmp (temp_string, "60") == 0)
-                {
-                        /* Now follows a string containing the
-                         * visibility value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%hd\n", &spline->visibility);
-                }
-                else if (strcmp (temp_string, "62") == 0)
-                {
-                        /* Now follows a string containing the
-                         * color value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%hd\n", &spline->color);
-                }
-                else if (strcmp (temp_string, "67") == 0)
-                {
-                        /* Now follows a string containing the
-                         * paperspace value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%hd\n", &spline->paperspace);
-                }
-                else if (strcmp (temp_string, "70") == 0)
-                {
-                        /* Now follows a flag value (bit coded). */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%hd\n", &spline->flag);
-                }
-                else if (strcmp (temp_string, "71") == 0)
-                {
-                        /* Now follows a degree of spline curve value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%hd\n", &spline->degree);
-                }
-                else if (strcmp (temp_string, "72") == 0)
-                {
-                        /* Now follows a number of knots value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%hd\n", &spline->number_of_knots);
-                }
-                else if (strcmp (temp_string, "73") == 0)
-                {
-                        /* Now follows a number of control points value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%hd\n", &spline->number_of_control_points);
-                }
-                else if (strcmp (temp_string, "74") == 0)
-                {
-                        /* Now follows a number of fit points value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%hd\n", &spline->number_of_fit_points);
-                }
-                else if (strcmp (temp_string, "92") == 0)
-                {
-                        /* Now follows a string containing the
-                         * paperspace value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%" PRIi32 "\n", &spline->graphics_data_size);
-                }
-                else if (strcmp (temp_string, "284") == 0)
-                {
-                        /* Now follows a string containing the shadow
-                         * mode value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%hd\n", &spline->shadow_mode);
-                }
-                else if (strcmp (temp_string, "310") == 0)
-                {
-                        /* Now follows a string containing binary
-                         * graphics data. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, binary_graphics_data->data_line);
-                        dxf_binary_graphics_data_init ((DxfBinaryGraphicsData *) binary_graphics_data->next);
-                        binary_graphics_data = (DxfBinaryGraphicsData *) binary_graphics_data->next;
-                }
-                else if (strcmp (temp_string, "330") == 0)
-                {
-                        /* Now follows a string containing a
-                         * soft-pointer ID/handle to owner dictionary. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, spline->dictionary_owner_soft);
-                }
-                else if (strcmp (temp_string, "347") == 0)
-                {
-                        /* Now follows a string containing a
-                         * hard-pointer ID/handle to material object. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, spline->material);
-                }
-                else if (strcmp (temp_string, "360") == 0)
-                {
-                        /* Now follows a string containing a
-                         * hard-pointer ID/handle to owner dictionary. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, spline->dictionary_owner_hard);
-                }
-                else if (strcmp (temp_string, "370") == 0)
-                {
-                        /* Now follows a string containing the lineweight
-                         * value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%hd\n", &spline->lineweight);
-                }
-                else if (strcmp (temp_string, "390") == 0)
-                {
-                        /* Now follows a string containing a plot style
-                         * name value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, spline->plot_style_name);
-                }
-                else if (strcmp (temp_string, "420") == 0)
+                switch (group_code)
                 {
-                        /* Now follows a string containing a color value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%" PRIi32 "\n", &spline->color_value);
-                }
-                else if (strcmp (temp_string, "430") == 0)
-                {
-                        /* Now follows a string containing a color
-                         * name value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, spline->color_name);
-                }
-                else if (strcmp (temp_string, "440") == 0)
-                {
-                        /* Now follows a string containing a transparency
-                         * value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%" PRIi32 "\n", &spline->transparency);
-                }
-                else if (strcmp (temp_string, "999") == 0)
-                {
-                        /* Now follows a string containing a comment. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
-                        fprintf (stdout, "DXF comment: %s\n", temp_string);
-                }
-                else
-                {
-                        fprintf (stderr,
-                          (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
-                          __FUNCTION__, fp->filename, fp->line_number);
+                        case 5:
+                                /* Now follows a string containing a sequential
+                                 * id number. */
+                                dxf_read_handle (fp, &spline->id_code);
+                                break;
+                        case 6:
+                                /* Now follows a string containing a linetype
+                                 * name. */
+                                dxf_read_string_interned (fp, &spline->linetype);
+                                break;
+                        case 8:
+                                /* Now follows a string containing a layer name. */
+                                dxf_read_string_interned (fp, &spline->layer);
+                                break;
+                        case 10:
+                                /* Now follows a string containing the
+                                 * X-value of the control point coordinate
+                                 * (multiple entries). */
+                                dxf_read_double (fp, &p0->x0);
+                                break;
+                        case 20:
+                                /* Now follows a string containing the
+                                 * Y-coordinate of control point coordinate
+                                 * (multiple entries). */
+                                dxf_read_double (fp, &p0->y0);
+                                break;
+                        case 30:
+                                /* Now follows a string containing the
+                                 * Z-coordinate of the control point coordinate
+                                 * (multiple entries). */
+                                dxf_read_double (fp, &p0->z0);
+                                dxf_point_init ((DxfPoint *) p0->next);
+                                p0 = (DxfPoint *) p0->next;
+                                break;
+                        case 11:
+                                /* Now follows a string containing the
+                                 * X-coordinate of the fit point coordinate
+                                 * (multiple entries). */
+                                dxf_read_double (fp, &p1->x0);
+                                break;
+                        case 21:
+                                /* Now follows a string containing the
+                                 * Y-coordinate of the fit point coordinate
+                                 * (multiple entries). */
+                                dxf_read_double (fp, &p1->y0);
+                                break;
+                        case 31:
+                                /* Now follows a string containing the
+                                 * Z-coordinate of the fit point coordinate
+                                 * (multiple entries). */
+                                dxf_read_double (fp, &p1->z0);
+                                dxf_point_init ((DxfPoint *) p1->next);
+                                p1 = (DxfPoint *) p1->next;
+                                break;
+                        case 12:
+                                /* Now follows a string containing the
+                                 * X-coordinate of the start tangent,
+                                 * may be omitted (in WCS). */
+                                dxf_read_double (fp, &spline->p2.x);
+                                break;
+                        case 22:
+                                /* Now follows a string containing the
+                                 * Y-coordinate of the start tangent,
+                                 * may be omitted (in WCS). */
+                                dxf_read_double (fp, &spline->p2.y);
+                                break;
+                        case 32:
+                                /* Now follows a string containing the
+                                 * Z-coordinate of the start tangent,
+                                 * may be omitted (in WCS). */
+                                dxf_read_double (fp, &spline->p2.z);
+                                break;
+                        case 13:
+                                /* Now follows a string containing the
+                                 * X-coordinate of the end tangent,
+                                 * may be omitted (in WCS). */
+                                dxf_read_double (fp, &spline->p3.x);
+                                break;
+                        case 23:
+                                /* Now follows a string containing the
+                                 * Y-coordinate of the end tangent,
+                                 * may be omitted (in WCS). */
+                                dxf_read_double (fp, &spline->p3.y);
+                                break;
+                        case 33:
+                                /* Now follows a string containing the
+                                 * Z-coordinate of the end tangent,
+                                 * may be omitted (in WCS). */
+                                dxf_read_double (fp, &spline->p3.z);
+                                break;
+                        case 38:
+                                if ((fp->acad_version_number <= AutoCAD_11) && (spline->elevation != 0.0))
+                                {
+                                        /* Now follows a string containing the
+                                         * elevation. */
+                                        dxf_read_double (fp, &spline->elevation);
+                                }
+                                else
+                                {
+                                        fprintf (stderr,
+                                          (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
+                                          __FUNCTION__, fp->filename, fp->line_number);
+                                        /* Skip the value of the unknown group code. */
+                                        dxf_read_line (temp_string, fp);
+                                }
+                                break;
+                        case 39:
+                                /* Now follows a thickness value. */
+                                dxf_read_double (fp, &spline->thickness);
+                                break;
+                        case 40:
+                                /* Now follows a knot value (one entry per knot, multiple entries). */
+                                dxf_read_double (fp, &kv->value);
+                                dxf_double_init ((DxfDouble *) kv->next);
+                                kv = (DxfDouble *) kv->next;
+                                break;
+                        case 41:
+                                /* Now follows a weight value (one entry per knot, multiple entries). */
+                                dxf_read_double (fp, &wv->value);
+                                dxf_double_init ((DxfDouble *) wv->next);
+                                wv = (DxfDouble *) wv->next;
+                                break;
+                        case 42:
+                                /* Now follows a knot tolerance value. */
+                                dxf_read_double (fp, &spline->knot_tolerance);
+                                break;
+                        case 43:
+                                /* Now follows a control point tolerance value. */
+                                dxf_read_double (fp, &spline->control_point_tolerance);
+                                break;
+                        case 44:
+                                /* Now follows a fit point tolerance value. */
+                                dxf_read_double (fp, &spline->fit_tolerance);
+                                break;
+                        case 48:
+                                /* Now follows a linetype scale value. */
+                                dxf_read_double (fp, &spline->linetype_scale);
+                                break;
+                        case 60:
+                                /* Now follows a string containing the
+                                 * visibility value. */
+                                dxf_read_int16 (fp, &spline->visibility);
+                                break;
+                        case 62:
+                                /* Now follows a string containing the
+                                 * color value. */
+                                dxf_read_int16 (fp, &spline->color);
+                                break;
+                        case 67:
+                                /* Now follows a string containing the
+                                 * paperspace value. */
+                                dxf_read_int16 (fp, &spline->paperspace);
+                                break;
+                        case 70:
+                                /* Now follows a flag value (bit coded). */
+                                dxf_read_int16 (fp, &spline->flag);
+                                break;
+                        case 71:
+                                /* Now follows a degree of spline curve value. */
+                                dxf_read_int16 (fp, &spline->degree);
+                                break;
+                        case 72:
+                                /* Now follows a number of knots value. */
+                                dxf_read_int16 (fp, &spline->number_of_knots);
+                                break;
+                        case 73:
+                                /* Now follows a number of control points value. */
+                                dxf_read_int16 (fp, &spline->number_of_control_points);
+                                break;
+                        case 74:
+                                /* Now follows a number of fit points value. */
+                                dxf_read_int16 (fp, &spline->number_of_fit_points);
+                                break;
+                        case 92:
+                                /* Now follows a string containing the
+                                 * paperspace value. */
+                                dxf_read_int32 (fp, &spline->graphics_data_size);
+                                break;
+                        case 284:
+                                /* Now follows a string containing the shadow
+                                 * mode value. */
+                                dxf_read_int16 (fp, &spline->shadow_mode);
+                                break;
+                        case 310:
+                                /* Now follows a string containing binary
+                                 * graphics data. */
+                                dxf_read_string (fp, &binary_graphics_data->data_line);
+                                dxf_binary_graphics_data_init ((DxfBinaryGraphicsData *) binary_graphics_data->next);
+                                binary_graphics_data = (DxfBinaryGraphicsData *) binary_graphics_data->next;
+                                break;
+                        case 330:
+                                /* Now follows a string containing a
+                                 * soft-pointer ID/handle to owner dictionary. */
+                                dxf_read_handle (fp, &spline->dictionary_owner_soft);
+                                break;
+                        case 347:
+                                /* Now follows a string containing a
+                                 * hard-pointer ID/handle to material object. */
+                                dxf_read_handle (fp, &spline->material);
+                                break;
+                        case 360:
+                                /* Now follows a string containing a
+                                 * hard-pointer ID/handle to owner dictionary. */
+                                dxf_read_handle (fp, &spline->dictionary_owner_hard);
+                                break;
+                        case 370:
+                                /* Now follows a string containing the lineweight
+                                 * value. */
+                                dxf_read_int16 (fp, &spline->lineweight);
+                                break;
+                        case 390:
+                                /* Now follows a string containing a plot style
+                                 * name value. */
+                                dxf_read_handle (fp, &spline->plot_style_name);
+                                break;
+                        case 420:
+                                /* Now follows a string containing a color value. */
+                                dxf_read_int32 (fp, &spline->color_value);
+                                break;
+                        case 430:
+                                /* Now follows a string containing a color
+                                 * name value. */
+                                dxf_read_string_interned (fp, &spline->color_name);
+                                break;
+                        case 440:
+                                /* Now follows a string containing a transparency
+                                 * value. */
+                                dxf_read_int32 (fp, &spline->transparency);
+                                break;
+                        case 999:
+                                /* Now follows a string containing a comment. */
+                                dxf_read_line (temp_string, fp);
+                                fprintf (stdout, "DXF comment: %s\n", temp_string);
+                                break;
+                        default:
+                                fprintf (stderr,
+                                  (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
+                                  __FUNCTION__, fp->filename, fp->line_number);
+                                /* Skip the value of the unknown group code. */
+                                dxf_read_line (temp_string, fp);
+                                break;
                 }
         }
         /* Handle omitted members and/or illegal values. */
         if (strcmp (spline->linetype, "") == 0)
         {
-                spline->linetype = strdup (DXF_DEFAULT_LINETYPE);
+                spline->linetype = dxf_strdup (DXF_DEFAULT_LINETYPE);
         }
         if (strcmp (spline->layer, "") == 0)
         {
-                spline->layer = strdup (DXF_DEFAULT_LAYER);
+                spline->layer = dxf_strdup (DXF_DEFAULT_LAYER);
         }
-        /* Clean up. */
-        free (temp_string);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -780,13 +699,11 @@ dxf_spline_write
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        char *dxf_entity_name = strdup ("SPLINE");
+        char *dxf_entity_name = dxf_strdup ("SPLINE");
         int i;
         DxfBinaryGraphicsData *binary_graphics_data = NULL;
         DxfPoint *p0 = NULL;
         DxfPoint *p1 = NULL;
-        DxfPoint *p2 = NULL;
-        DxfPoint *p3 = NULL;
 
         /* Do some basic checks. */
         if (fp == NULL)
@@ -795,7 +712,7 @@ dxf_spline_write
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (spline == NULL)
@@ -804,7 +721,7 @@ dxf_spline_write
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (fp->acad_version_number < AutoCAD_13)
@@ -816,17 +733,17 @@ dxf_spline_write
         if (strcmp (spline->linetype, "") == 0)
         {
                 fprintf (stderr,
-                  (_("Warning in %s () empty linetype string for the %s entity with id-code: %x\n")),
+                  (_("Warning in %s () empty linetype string for the %s entity with id-code: %" PRIx64 "\n")),
                   __FUNCTION__, dxf_entity_name, spline->id_code);
                 fprintf (stderr,
                   (_("\t%s entity is reset to default linetype")),
                   dxf_entity_name);
-                spline->linetype = strdup (DXF_DEFAULT_LINETYPE);
+                spline->linetype = dxf_strdup (DXF_DEFAULT_LINETYPE);
         }
         if (strcmp (spline->layer, "") == 0)
         {
                 fprintf (stderr,
-                  (_("Warning in %s () empty layer string for the %s entity with id-code: %x.\n")),
+                  (_("Warning in %s () empty layer string for the %s entity with id-code: %" PRIx64 ".\n")),
                   __FUNCTION__, dxf_entity_name, spline->id_code);
                 fprintf (stderr,
                   (_("\t%s entity is relocated to default layer.\n")),
@@ -837,12 +754,10 @@ dxf_spline_write
         binary_graphics_data = (DxfBinaryGraphicsData *) spline->binary_graphics_data;
         p0 = (DxfPoint *) spline->p0;
         p1 = (DxfPoint *) spline->p1;
-        p2 = (DxfPoint *) spline->p2;
-        p3 = (DxfPoint *) spline->p3;
-        fprintf (fp->fp, "  0\n%s\n", dxf_entity_name);
-        if (spline->id_code != -1)
+        dxf_write_string (fp, 0, dxf_entity_name);
+        if (spline->id_code != DXF_HANDLE_NONE)
         {
-                fprintf (fp->fp, "  5\n%x\n", spline->id_code);
+                dxf_write_hex (fp, 5, spline->id_code);
         }
         /*!
          * \todo for version R14.\n
@@ -854,124 +769,124 @@ dxf_spline_write
          * 102 groups are application defined (optional).\n\n
          * End of group, "}" (optional), with Group code 102.
          */
-        if ((strcmp (spline->dictionary_owner_soft, "") != 0)
+        if ((spline->dictionary_owner_soft != 0)
           && (fp->acad_version_number >= AutoCAD_14))
         {
-                fprintf (fp->fp, "102\n{ACAD_REACTORS\n");
-                fprintf (fp->fp, "330\n%s\n", spline->dictionary_owner_soft);
-                fprintf (fp->fp, "102\n}\n");
+                dxf_write_string (fp, 102, "{ACAD_REACTORS");
+                dxf_write_hex (fp, 330, spline->dictionary_owner_soft);
+                dxf_write_string (fp, 102, "}");
         }
-        if ((strcmp (spline->dictionary_owner_hard, "") != 0)
+        if ((spline->dictionary_owner_hard != 0)
           && (fp->acad_version_number >= AutoCAD_14))
         {
-                fprintf (fp->fp, "102\n{ACAD_XDICTIONARY\n");
-                fprintf (fp->fp, "360\n%s\n", spline->dictionary_owner_hard);
-                fprintf (fp->fp, "102\n}\n");
+                dxf_write_string (fp, 102, "{ACAD_XDICTIONARY");
+                dxf_write_hex (fp, 360, spline->dictionary_owner_hard);
+                dxf_write_string (fp, 102, "}");
         }
         if (fp->acad_version_number >= AutoCAD_13)
         {
-                fprintf (fp->fp, "100\nAcDbEntity\n");
+                dxf_write_string (fp, 100, "AcDbEntity");
         }
         if (spline->paperspace == DXF_PAPERSPACE)
         {
-                fprintf (fp->fp, " 67\n%hd\n", (int16_t) DXF_PAPERSPACE);
+                dxf_write_int (fp, 67, (int16_t) DXF_PAPERSPACE);
         }
-        fprintf (fp->fp, "  8\n%s\n", spline->layer);
+        dxf_write_string (fp, 8, spline->layer);
         if (strcmp (spline->linetype, DXF_DEFAULT_LINETYPE) != 0)
         {
-                fprintf (fp->fp, "  6\n%s\n", spline->linetype);
+                dxf_write_string (fp, 6, spline->linetype);
         }
         if ((fp->acad_version_number <= AutoCAD_11)
           && DXF_FLATLAND
           && (spline->elevation != 0.0))
         {
-                fprintf (fp->fp, " 38\n%f\n", spline->elevation);
+                dxf_write_double (fp, 38, spline->elevation);
         }
         if ((fp->acad_version_number >= AutoCAD_2007)
-          && (strcmp (spline->material, "") != 0))
+          && (spline->material != 0))
         {
-                fprintf (fp->fp, "347\n%s\n", spline->material);
+                dxf_write_hex (fp, 347, spline->material);
         }
         if (spline->color != DXF_COLOR_BYLAYER)
         {
-                fprintf (fp->fp, " 62\n%hd\n", spline->color);
+                dxf_write_int (fp, 62, spline->color);
         }
         if (spline->thickness != 0.0)
         {
-                fprintf (fp->fp, " 39\n%f\n", spline->thickness);
+                dxf_write_double (fp, 39, spline->thickness);
         }
-        fprintf (fp->fp, "370\n%d\n", spline->lineweight);
-        fprintf (fp->fp, " 48\n%f\n", spline->linetype_scale);
+        dxf_write_int (fp, 370, spline->lineweight);
+        dxf_write_double (fp, 48, spline->linetype_scale);
         if (spline->visibility != 0)
         {
-                fprintf (fp->fp, " 60\n%hd\n", spline->visibility);
+                dxf_write_int (fp, 60, spline->visibility);
         }
-        fprintf (fp->fp, " 92\n%" PRIi32 "\n", spline->graphics_data_size);
+        dxf_write_int (fp, 92, spline->graphics_data_size);
         /*!
          * \todo On 64 bit machines use group code 160.
          */
         while (binary_graphics_data != NULL)
         {
-                fprintf (fp->fp, "310\n%s\n", binary_graphics_data->data_line);
+                dxf_write_string (fp, 310, binary_graphics_data->data_line);
                 binary_graphics_data = (DxfBinaryGraphicsData *) dxf_binary_graphics_data_get_next (binary_graphics_data);
         }
-        fprintf (fp->fp, "420\n%" PRIi32 "\n", spline->color_value);
-        fprintf (fp->fp, "430\n%s\n", spline->color_name);
-        fprintf (fp->fp, "440\n%" PRIi32 "\n", spline->transparency);
-        fprintf (fp->fp, "390\n%s\n", spline->plot_style_name);
-        fprintf (fp->fp, "284\n%hd\n", spline->shadow_mode);
-        fprintf (fp->fp, "100\nAcDbSpline\n");
+        dxf_write_int (fp, 420, spline->color_value);
+        dxf_write_string (fp, 430, spline->color_name);
+        dxf_write_int (fp, 440, spline->transparency);
+        dxf_write_hex (fp, 390, spline->plot_style_name);
+        dxf_write_int (fp, 284, spline->shadow_mode);
+        dxf_write_string (fp, 100, "AcDbSpline");
         if ((fp->acad_version_number >= AutoCAD_12)
                 && (spline->extr_x0 != 0.0)
                 && (spline->extr_y0 != 0.0)
                 && (spline->extr_z0 != 1.0))
         {
-                fprintf (fp->fp, "210\n%f\n", spline->extr_x0);
-                fprintf (fp->fp, "220\n%f\n", spline->extr_y0);
-                fprintf (fp->fp, "230\n%f\n", spline->extr_z0);
-        }
-        fprintf (fp->fp, " 70\n%hd\n", spline->flag);
-        fprintf (fp->fp, " 71\n%hd\n", spline->degree);
-        fprintf (fp->fp, " 72\n%hd\n", spline->number_of_knots);
-        fprintf (fp->fp, " 73\n%hd\n", spline->number_of_control_points);
-        fprintf (fp->fp, " 74\n%hd\n", spline->number_of_fit_points);
-        fprintf (fp->fp, " 42\n%f\n", spline->knot_tolerance);
-        fprintf (fp->fp, " 43\n%f\n", spline->control_point_tolerance);
-        fprintf (fp->fp, " 12\n%f\n", p2->x0);
-        fprintf (fp->fp, " 22\n%f\n", p2->y0);
-        fprintf (fp->fp, " 32\n%f\n", p2->z0);
-        fprintf (fp->fp, " 13\n%f\n", p3->x0);
-        fprintf (fp->fp, " 23\n%f\n", p3->y0);
-        fprintf (fp->fp, " 33\n%f\n", p3->z0);
+                dxf_write_double (fp, 210, spline->extr_x0);
+                dxf_write_double (fp, 220, spline->extr_y0);
+                dxf_write_double (fp, 230, spline->extr_z0);
+        }
+        dxf_write_int (fp, 70, spline->flag);
+        dxf_write_int (fp, 71, spline->degree);
+        dxf_write_int (fp, 72, spline->number_of_knots);
+        dxf_write_int (fp, 73, spline->number_of_control_points);
+        dxf_write_int (fp, 74, spline->number_of_fit_points);
+        dxf_write_double (fp, 42, spline->knot_tolerance);
+        dxf_write_double (fp, 43, spline->control_point_tolerance);
+        dxf_write_double (fp, 12, spline->p2.x);
+        dxf_write_double (fp, 22, spline->p2.y);
+        dxf_write_double (fp, 32, spline->p2.z);
+        dxf_write_double (fp, 13, spline->p3.x);
+        dxf_write_double (fp, 23, spline->p3.y);
+        dxf_write_double (fp, 33, spline->p3.z);
         for (i = 0; i < spline->number_of_knots; i++)
         {
-                fprintf (fp->fp, " 40\n%f\n", spline->knot_value->value);
+                dxf_write_double (fp, 40, spline->knot_value->value);
                 /*! \todo implement as a single linked list of double. */
         }
         if (spline->number_of_fit_points != 0)
         {
         for (i = 0; i < spline->number_of_fit_points; i++)
                 {
-                        fprintf (fp->fp, " 41\n%f\n", spline->weight_value->value);
+                        dxf_write_double (fp, 41, spline->weight_value->value);
                         /*! \todo implement as a single linked list of double. */
                 }
         }
         while (spline->p0 != NULL)
         {
-                fprintf (fp->fp, " 10\n%f\n", p0->x0);
-                fprintf (fp->fp, " 20\n%f\n", p0->y0);
-                fprintf (fp->fp, " 30\n%f\n", p0->z0);
+                dxf_write_double (fp, 10, p0->x0);
+                dxf_write_double (fp, 20, p0->y0);
+                dxf_write_double (fp, 30, p0->z0);
                 p0 = (DxfPoint *) dxf_point_get_next (p0);
         }
         while (spline->p1 != NULL)
         {
-                fprintf (fp->fp, " 11\n%f\n", p1->x0);
-                fprintf (fp->fp, " 21\n%f\n", p1->y0);
-                fprintf (fp->fp, " 31\n%f\n", p1->z0);
+                dxf_write_double (fp, 11, p1->x0);
+                dxf_write_double (fp, 21, p1->y0);
+                dxf_write_double (fp, 31, p1->z0);
                 p1 = (DxfPoint *) dxf_point_get_next (p1);
         }
         /* Clean up. */
-        free (dxf_entity_name);
+        dxf_free (dxf_entity_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1012,21 +927,15 @@ dxf_spline_free
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        free (spline->linetype);
-        free (spline->layer);
+        dxf_string_free (spline->linetype);
+        dxf_string_free (spline->layer);
         dxf_binary_graphics_data_free_list ((DxfBinaryGraphicsData *) spline->binary_graphics_data);
-        free (spline->dictionary_owner_soft);
-        free (spline->material);
-        free (spline->dictionary_owner_hard);
-        free (spline->plot_style_name);
-        free (spline->color_name);
+        dxf_string_free (spline->color_name);
         dxf_point_free_list (spline->p0);
         dxf_point_free_list (spline->p1);
-        dxf_point_free (spline->p2);
-        dxf_point_free (spline->p3);
         dxf_double_free_list (spline->knot_value);
         dxf_double_free_list (spline->weight_value);
-        free (spline);
+        dxf_free (spline);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1073,7 +982,7 @@ dxf_spline_free_list
  * \return \c id_code when successful, or \c EXIT_FAILURE when an error
  * occurred.
  */
-int
+uint64_t
 dxf_spline_get_id_code
 (
         DxfSpline *spline
@@ -1091,12 +1000,6 @@ dxf_spline_get_id_code
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (spline->id_code < 0)
-        {
-                fprintf (stderr,
-                  (_("Warning in %s () a negative value was found.\n")),
-                  __FUNCTION__);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1114,7 +1017,7 @@ dxf_spline_set_id_code
 (
         DxfSpline *spline,
                 /*!< a pointer to a DXF \c SPLINE entity. */
-        int id_code
+        uint64_t id_code
                 /*!< Identification number for the entity.\n
                  * This is to be an unique (sequential) number in the DXF
                  * file. */
@@ -1131,12 +1034,6 @@ dxf_spline_set_id_code
                   __FUNCTION__);
                 return (NULL);
         }
-        if (id_code < 0)
-        {
-                fprintf (stderr,
-                  (_("Warning in %s () a negative value was passed.\n")),
-                  __FUNCTION__);
-        }
         spline->id_code = id_code;
 #if DEBUG
         DXF_DEBUG_END
@@ -1178,7 +1075,7 @@ dxf_spline_get_linetype
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (spline->linetype));
+        return (dxf_strdup (spline->linetype));
 }
 
 
@@ -1215,7 +1112,7 @@ dxf_spline_set_linetype
                   __FUNCTION__);
                 return (NULL);
         }
-        spline->linetype = strdup (linetype);
+        spline->linetype = dxf_strdup (linetype);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1256,7 +1153,7 @@ dxf_spline_get_layer
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (spline->layer));
+        return (dxf_strdup (spline->layer));
 }
 
 
@@ -1293,7 +1190,7 @@ dxf_spline_set_layer
                   __FUNCTION__);
                 return (NULL);
         }
-        spline->layer = strdup (layer);
+        spline->layer = dxf_strdup (layer);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2059,12 +1956,10 @@ dxf_spline_set_binary_graphics_data
  * \brief Get the pointer to the \c dictionary_owner_soft from a DXF
  * \c SPLINE entity.
  *
- * \return a pointer to \c dictionary_owner_soft when successful, or
- * \c NULL when an error occurred.
- *
- * \warning No checks are performed on the returned pointer.
+ * \return the handle \c dictionary_owner_soft when successful, or
+ * 0 when an error occurred.
  */
-char *
+uint64_t
 dxf_spline_get_dictionary_owner_soft
 (
         DxfSpline *spline
@@ -2080,19 +1975,12 @@ dxf_spline_get_dictionary_owner_soft
                 fprintf (stderr,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
-                return (NULL);
-        }
-        if (spline->dictionary_owner_soft ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found in the dictionary_owner_soft member.\n")),
-                  __FUNCTION__);
-                return (NULL);
+                return (0);
         }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (spline->dictionary_owner_soft));
+        return (spline->dictionary_owner_soft);
 }
 
 
@@ -2108,8 +1996,8 @@ dxf_spline_set_dictionary_owner_soft
 (
         DxfSpline *spline,
                 /*!< a pointer to a DXF \c SPLINE entity. */
-        char *dictionary_owner_soft
-                /*!< a string containing the pointer to the \c
+        uint64_t dictionary_owner_soft
+                /*!< the handle of the \c
                  * dictionary_owner_soft for the entity. */
 )
 {
@@ -2124,14 +2012,7 @@ dxf_spline_set_dictionary_owner_soft
                   __FUNCTION__);
                 return (NULL);
         }
-        if (dictionary_owner_soft == NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was passed.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
-        spline->dictionary_owner_soft = strdup (dictionary_owner_soft);
+        spline->dictionary_owner_soft = dictionary_owner_soft;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2142,12 +2023,10 @@ dxf_spline_set_dictionary_owner_soft
 /*!
  * \brief Get the pointer to the \c material from a DXF \c SPLINE entity.
  *
- * \return a pointer to \c material when successful, or \c NULL when an
+ * \return the handle \c material when successful, or 0 when an
  * error occurred.
- *
- * \warning No checks are performed on the returned pointer.
  */
-char *
+uint64_t
 dxf_spline_get_material
 (
         DxfSpline *spline
@@ -2163,19 +2042,12 @@ dxf_spline_get_material
                 fprintf (stderr,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
-                return (NULL);
-        }
-        if (spline->material ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found in the material member.\n")),
-                  __FUNCTION__);
-                return (NULL);
+                return (0);
         }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (spline->material));
+        return (spline->material);
 }
 
 
@@ -2190,8 +2062,8 @@ dxf_spline_set_material
 (
         DxfSpline *spline,
                 /*!< a pointer to a DXF \c SPLINE entity. */
-        char *material
-                /*!< a string containing the pointer to the \c
+        uint64_t material
+                /*!< the handle of the \c
                  * material for the entity. */
 )
 {
@@ -2206,14 +2078,7 @@ dxf_spline_set_material
                   __FUNCTION__);
                 return (NULL);
         }
-        if (material == NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was passed.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
-        spline->material = strdup (material);
+        spline->material = material;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2225,12 +2090,10 @@ dxf_spline_set_material
  * \brief Get the pointer to the \c dictionary_owner_hard from a DXF
  * \c SPLINE entity.
  *
- * \return a pointer to \c dictionary_owner_hard when successful, or
- * \c NULL when an error occurred.
- *
- * \warning No checks are performed on the returned pointer.
+ * \return the handle \c dictionary_owner_hard when successful, or
+ * 0 when an error occurred.
  */
-char *
+uint64_t
 dxf_spline_get_dictionary_owner_hard
 (
         DxfSpline *spline
@@ -2246,19 +2109,12 @@ dxf_spline_get_dictionary_owner_hard
                 fprintf (stderr,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
-                return (NULL);
-        }
-        if (spline->dictionary_owner_hard ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found in the dictionary_owner_hard member.\n")),
-                  __FUNCTION__);
-                return (NULL);
+                return (0);
         }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (spline->dictionary_owner_hard));
+        return (spline->dictionary_owner_hard);
 }
 
 
@@ -2274,8 +2130,8 @@ dxf_spline_set_dictionary_owner_hard
 (
         DxfSpline *spline,
                 /*!< a pointer to a DXF \c SPLINE entity. */
-        char *dictionary_owner_hard
-                /*!< a string containing the pointer to the \c
+        uint64_t dictionary_owner_hard
+                /*!< the handle of the \c
                  * dictionary_owner_hard for the entity. */
 )
 {
@@ -2290,14 +2146,7 @@ dxf_spline_set_dictionary_owner_hard
                   __FUNCTION__);
                 return (NULL);
         }
-        if (dictionary_owner_hard == NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was passed.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
-        spline->dictionary_owner_hard = strdup (dictionary_owner_hard);
+        spline->dictionary_owner_hard = dictionary_owner_hard;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2373,10 +2222,10 @@ dxf_spline_set_lineweight
 /*!
  * \brief Get the \c plot_style_name from a DXF \c SPLINE entity.
  *
- * \return \c plot_style_name when sucessful, or \c NULL when an error
+ * \return \c plot_style_name when sucessful, or 0 when an error
  * occurred.
  */
-char *
+uint64_t
 dxf_spline_get_plot_style_name
 (
         DxfSpline *spline
@@ -2392,19 +2241,12 @@ dxf_spline_get_plot_style_name
                 fprintf (stderr,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
-                return (NULL);
-        }
-        if (spline->plot_style_name ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found in the plot_style_name member.\n")),
-                  __FUNCTION__);
-                return (NULL);
+                return (0);
         }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (spline->plot_style_name));
+        return (spline->plot_style_name);
 }
 
 
@@ -2419,7 +2261,7 @@ dxf_spline_set_plot_style_name
 (
         DxfSpline *spline,
                 /*!< a pointer to a DXF \c SPLINE entity. */
-        char *plot_style_name
+        uint64_t plot_style_name
                 /*!< a string containing the \c plot_style_name for the
                  * entity. */
 )
@@ -2435,14 +2277,7 @@ dxf_spline_set_plot_style_name
                   __FUNCTION__);
                 return (NULL);
         }
-        if (plot_style_name == NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was passed.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
-        spline->plot_style_name = strdup (plot_style_name);
+        spline->plot_style_name = plot_style_name;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2549,7 +2384,7 @@ dxf_spline_get_color_name
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (spline->color_name));
+        return (dxf_strdup (spline->color_name));
 }
 
 
@@ -2587,7 +2422,7 @@ dxf_spline_set_color_name
                   __FUNCTION__);
                 return (NULL);
         }
-        spline->color_name = strdup (color_name);
+        spline->color_name = dxf_strdup (color_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -3326,7 +3161,7 @@ dxf_spline_set_z1
  * \return start tangent point \c p2 when sucessful, or \c NULL when an error
  * occurred.
  */
-DxfPoint *
+DxfVec3 *
 dxf_spline_get_p2
 (
         DxfSpline *spline
@@ -3344,17 +3179,10 @@ dxf_spline_get_p2
                   __FUNCTION__);
                 return (NULL);
         }
-        if (spline->p2 ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found in the p1 member.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return ((DxfPoint *) spline->p2);
+        return (&spline->p2);
 }
 
 
@@ -3369,8 +3197,8 @@ dxf_spline_set_p2
 (
         DxfSpline *spline,
                 /*!< a pointer to a DXF \c SPLINE entity. */
-        DxfPoint *p2
-                /*!< a start tangent point \c p2 for the entity. */
+        DxfVec3 *p2
+                /*!< a pointer to the coordinates. */
 )
 {
 #if DEBUG
@@ -3391,7 +3219,7 @@ dxf_spline_set_p2
                   __FUNCTION__);
                 return (NULL);
         }
-        spline->p2 = (DxfPoint *) p2;
+        spline->p2 = *p2;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -3424,17 +3252,10 @@ dxf_spline_get_x2
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (spline->p2 == NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (EXIT_FAILURE);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (spline->p2->x0);
+        return (spline->p2.x);
 }
 
 
@@ -3466,14 +3287,7 @@ dxf_spline_set_x2
                   __FUNCTION__);
                 return (NULL);
         }
-        if (spline->p2 == NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
-        spline->p2->x0 = x2;
+        spline->p2.x = x2;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -3506,17 +3320,10 @@ dxf_spline_get_y2
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (spline->p2 == NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (EXIT_FAILURE);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (spline->p2->y0);
+        return (spline->p2.y);
 }
 
 
@@ -3548,14 +3355,7 @@ dxf_spline_set_y2
                   __FUNCTION__);
                 return (NULL);
         }
-        if (spline->p2 == NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
-        spline->p2->y0 = y2;
+        spline->p2.y = y2;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -3588,17 +3388,10 @@ dxf_spline_get_z2
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (spline->p2 == NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (EXIT_FAILURE);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (spline->p2->z0);
+        return (spline->p2.z);
 }
 
 
@@ -3630,14 +3423,7 @@ dxf_spline_set_z2
                   __FUNCTION__);
                 return (NULL);
         }
-        if (spline->p2 == NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
-        spline->p2->z0 = z2;
+        spline->p2.z = z2;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -3651,7 +3437,7 @@ dxf_spline_set_z2
  * \return end tangent point \c p3 when sucessful, or \c NULL when an
  * error occurred.
  */
-DxfPoint *
+DxfVec3 *
 dxf_spline_get_p3
 (
         DxfSpline *spline
@@ -3669,17 +3455,10 @@ dxf_spline_get_p3
                   __FUNCTION__);
                 return (NULL);
         }
-        if (spline->p3 ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found in the p1 member.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return ((DxfPoint *) spline->p3);
+        return (&spline->p3);
 }
 
 
@@ -3694,8 +3473,8 @@ dxf_spline_set_p3
 (
         DxfSpline *spline,
                 /*!< a pointer to a DXF \c SPLINE entity. */
-        DxfPoint *p3
-                /*!< a end tangent point \c p3 for the entity. */
+        DxfVec3 *p3
+                /*!< a pointer to the coordinates. */
 )
 {
 #if DEBUG
@@ -3716,7 +3495,7 @@ dxf_spline_set_p3
                   __FUNCTION__);
                 return (NULL);
         }
-        spline->p3 = (DxfPoint *) p3;
+        spline->p3 = *p3;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -3749,17 +3528,10 @@ dxf_spline_get_x3
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (spline->p3 == NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (EXIT_FAILURE);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (spline->p3->x0);
+        return (spline->p3.x);
 }
 
 
@@ -3791,14 +3563,7 @@ dxf_spline_set_x3
                   __FUNCTION__);
                 return (NULL);
         }
-        if (spline->p3 == NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
-        spline->p3->x0 = x3;
+        spline->p3.x = x3;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -3831,17 +3596,10 @@ dxf_spline_get_y3
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (spline->p3 == NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (EXIT_FAILURE);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (spline->p3->y0);
+        return (spline->p3.y);
 }
 
 
@@ -3873,14 +3631,7 @@ dxf_spline_set_y3
                   __FUNCTION__);
                 return (NULL);
         }
-        if (spline->p3 == NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
-        spline->p3->y0 = y3;
+        spline->p3.y = y3;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -3913,17 +3664,10 @@ dxf_spline_get_z3
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (spline->p3 == NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (EXIT_FAILURE);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (spline->p3->z0);
+        return (spline->p3.z);
 }
 
 
@@ -3955,14 +3699,7 @@ dxf_spline_set_z3
                   __FUNCTION__);
                 return (NULL);
         }
-        if (spline->p3 == NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
-        spline->p3->z0 = z3;
+        spline->p3.z = z3;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -5014,4 +4751,152 @@ dxf_spline_get_last
 }
 
 
+/*!
+ * \brief Get the bounding box of a DXF \c SPLINE.
+ *
+ * The box of the control points of \c spline, which holds the spline
+ * as a (rational) B-spline lies in the convex hull of it's control
+ * points.\n
+ * A \c spline defined by fit points only gives the box of the fit
+ * points, which the curve may slightly overshoot.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_spline_get_bbox
+(
+        DxfSpline *spline,
+                /*!< a pointer to a DXF \c SPLINE entity. */
+        DxfBbox *bbox
+                /*!< a pointer to the libDXF bounding box to fill. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfPoint *point;
+        int number;
+        int i;
+
+        /* Do some basic checks. */
+        if ((spline == NULL) || (bbox == NULL))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        point = (DxfPoint *) spline->p0;
+        number = spline->number_of_control_points;
+        if (number <= 0)
+        {
+                point = (DxfPoint *) spline->p1;
+                number = spline->number_of_fit_points;
+        }
+        dxf_bbox_init (bbox);
+        for (i = 0; (point != NULL) && (i < number); i++)
+        {
+                dxf_bbox_add_point (bbox, point->x0, point->y0, point->z0);
+                point = (DxfPoint *) point->next;
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Transform a DXF \c SPLINE entity in place.
+ *
+ * The control points and fit points of \c spline are in world
+ * coordinates.  A B-spline is invariant under affine transformations,
+ * the control points are mapped with \c transform, as are the fit
+ * points.  The start and end tangents are mapped as directions, and
+ * the normal vector of a planar spline is mapped to the normal of the
+ * mapped plane.\n
+ * Any affine transformation is supported.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_spline_transform
+(
+        DxfSpline *spline,
+                /*!< a pointer to a DXF \c SPLINE entity. */
+        DxfTransform *transform
+                /*!< a pointer to a libDXF affine transformation. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfPoint *iter;
+        DxfVec3 point;
+        DxfVec3 normal;
+        double c[3][3];
+        double length;
+        int i;
+        int j;
+        int k;
+
+        /* Do some basic checks. */
+        if ((spline == NULL) || (transform == NULL))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        for (iter = (DxfPoint *) spline->p0; iter != NULL; iter = (DxfPoint *) iter->next)
+        {
+                point.x = iter->x0;
+                point.y = iter->y0;
+                point.z = iter->z0;
+                dxf_transform_apply_point (transform, &point, &point);
+                iter->x0 = point.x;
+                iter->y0 = point.y;
+                iter->z0 = point.z;
+        }
+        for (iter = (DxfPoint *) spline->p1; iter != NULL; iter = (DxfPoint *) iter->next)
+        {
+                point.x = iter->x0;
+                point.y = iter->y0;
+                point.z = iter->z0;
+                dxf_transform_apply_point (transform, &point, &point);
+                iter->x0 = point.x;
+                iter->y0 = point.y;
+                iter->z0 = point.z;
+        }
+        dxf_transform_apply_vector (transform, &spline->p2, &spline->p2);
+        dxf_transform_apply_vector (transform, &spline->p3, &spline->p3);
+        /* A normal maps with the cofactor matrix of the linear part,
+         * column i of which is column j cross column k. */
+        for (i = 0; i < 3; i++)
+        {
+                j = (i + 1) % 3;
+                k = (i + 2) % 3;
+                c[0][i] = (transform->m[1][j] * transform->m[2][k]) - (transform->m[2][j] * transform->m[1][k]);
+                c[1][i] = (transform->m[2][j] * transform->m[0][k]) - (transform->m[0][j] * transform->m[2][k]);
+                c[2][i] = (transform->m[0][j] * transform->m[1][k]) - (transform->m[1][j] * transform->m[0][k]);
+        }
+        normal.x = (c[0][0] * spline->extr_x0) + (c[0][1] * spline->extr_y0) + (c[0][2] * spline->extr_z0);
+        normal.y = (c[1][0] * spline->extr_x0) + (c[1][1] * spline->extr_y0) + (c[1][2] * spline->extr_z0);
+        normal.z = (c[2][0] * spline->extr_x0) + (c[2][1] * spline->extr_y0) + (c[2][2] * spline->extr_z0);
+        length = sqrt ((normal.x * normal.x) + (normal.y * normal.y) + (normal.z * normal.z));
+        if (length > 0.0)
+        {
+                spline->extr_x0 = normal.x / length;
+                spline->extr_y0 = normal.y / length;
+                spline->extr_z0 = normal.z / length;
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (EXIT_SUCCESS);
+}
+
+
 /* EOF */
@@ -47,6 +47,7 @@
 #include "binary_graphics_data.h"
 #include "point.h"
 #include "util.h"
+#include "transform.h"
 
 
 #ifdef __cplusplus
@@ -66,7 +67,7 @@ typedef struct
 dxf_spline_struct
 {
         /* Members common for all DXF drawable entities. */
-        int id_code;
+        uint64_t id_code;
                 /*!< Identification number for the entity.\n
                  * This is to be an unique (sequential) number in the DXF
                  * file.\n
@@ -129,21 +130,21 @@ dxf_spline_struct
                  * Multiple lines of 256 characters maximum per line
                  * (optional).\n
                  * Group code = 310. */
-        char *dictionary_owner_soft;
+        uint64_t dictionary_owner_soft;
                 /*!< Soft-pointer ID/handle to owner dictionary (optional).\n
                  * Group code = 330. */
-        char *material;
+        uint64_t material;
                 /*!< Hard-pointer ID/handle to material object (present if
                  * not BYLAYER).\n
                  * Group code = 347. */
-        char *dictionary_owner_hard;
+        uint64_t dictionary_owner_hard;
                 /*!< Hard owner ID/handle to owner dictionary (optional).\n
                  * Group code = 360. */
         int16_t lineweight;
                 /*!< Lineweight enum value.\n
                  * Stored and moved around as a 16-bit integer.\n
                  * Group code = 370. */
-        char *plot_style_name;
+        uint64_t plot_style_name;
                 /*!< Hard pointer ID / handle of PlotStyleName object.\n
                  * Group code = 390. */
         int32_t color_value;
@@ -178,11 +179,11 @@ dxf_spline_struct
         DxfPoint *p1;
                 /*!< Fit point (multiple entries).\n
                  * Group codes = 11, 21 and 31.*/
-        DxfPoint *p2;
+        DxfVec3 p2;
                 /*!< Start tangent point.\n
                  * May be omitted (in WCS).\n
                  * Group codes = 12, 22 and 32.*/
-        DxfPoint *p3;
+        DxfVec3 p3;
                 /*!< End tangent point.\n
                  * May be omitted (in WCS).\n
                  * Group codes = 13, 23 and 33. */
@@ -248,8 +249,8 @@ DxfSpline *dxf_spline_read (DxfFile *fp, DxfSpline *spline);
 int dxf_spline_write (DxfFile *fp, DxfSpline *spline);
 int dxf_spline_free (DxfSpline *spline);
 void dxf_spline_free_list (DxfSpline *splines);
-int dxf_spline_get_id_code (DxfSpline *spline);
-DxfSpline *dxf_spline_set_id_code (DxfSpline *spline, int id_code);
+uint64_t dxf_spline_get_id_code (DxfSpline *spline);
+DxfSpline *dxf_spline_set_id_code (DxfSpline *spline, uint64_t id_code);
 char *dxf_spline_get_linetype (DxfSpline *spline);
 DxfSpline *dxf_spline_set_linetype (DxfSpline *spline, char *linetype);
 char *dxf_spline_get_layer (DxfSpline *spline);
@@ -272,16 +273,16 @@ int16_t dxf_spline_get_shadow_mode (DxfSpline *spline);
 DxfSpline *dxf_spline_set_shadow_mode (DxfSpline *spline, int16_t shadow_mode);
 DxfBinaryGraphicsData *dxf_spline_get_binary_graphics_data (DxfSpline *spline);
 DxfSpline *dxf_spline_set_binary_graphics_data (DxfSpline *spline, DxfBinaryGraphicsData *data);
-char *dxf_spline_get_dictionary_owner_soft (DxfSpline *spline);
-DxfSpline *dxf_spline_set_dictionary_owner_soft (DxfSpline *spline, char *dictionary_owner_soft);
-char *dxf_spline_get_material (DxfSpline *spline);
-DxfSpline *dxf_spline_set_material (DxfSpline *spline, char *material);
-char *dxf_spline_get_dictionary_owner_hard (DxfSpline *spline);
-DxfSpline *dxf_spline_set_dictionary_owner_hard (DxfSpline *spline, char *dictionary_owner_hard);
+uint64_t dxf_spline_get_dictionary_owner_soft (DxfSpline *spline);
+DxfSpline *dxf_spline_set_dictionary_owner_soft (DxfSpline *spline, uint64_t dictionary_owner_soft);
+uint64_t dxf_spline_get_material (DxfSpline *spline);
+DxfSpline *dxf_spline_set_material (DxfSpline *spline, uint64_t material);
+uint64_t dxf_spline_get_dictionary_owner_hard (DxfSpline *spline);
+DxfSpline *dxf_spline_set_dictionary_owner_hard (DxfSpline *spline, uint64_t dictionary_owner_hard);
 int16_t dxf_spline_get_lineweight (DxfSpline *spline);
 DxfSpline *dxf_spline_set_lineweight (DxfSpline *spline, int16_t lineweight);
-char *dxf_spline_get_plot_style_name (DxfSpline *spline);
-DxfSpline *dxf_spline_set_plot_style_name (DxfSpline *spline, char *plot_style_name);
+uint64_t dxf_spline_get_plot_style_name (DxfSpline *spline);
+DxfSpline *dxf_spline_set_plot_style_name (DxfSpline *spline, uint64_t plot_style_name);
 int32_t dxf_spline_get_color_value (DxfSpline *spline);
 DxfSpline *dxf_spline_set_color_value (DxfSpline *spline, int32_t color_value);
 char *dxf_spline_get_color_name (DxfSpline *spline);
@@ -304,16 +305,16 @@ double dxf_spline_get_y1 (DxfSpline *spline);
 DxfSpline *dxf_spline_set_y1 (DxfSpline *spline, double y1);
 double dxf_spline_get_z1 (DxfSpline *spline);
 DxfSpline *dxf_spline_set_z1 (DxfSpline *spline, double z1);
-DxfPoint *dxf_spline_get_p2 (DxfSpline *spline);
-DxfSpline *dxf_spline_set_p2 (DxfSpline *spline, DxfPoint *p2);
+DxfVec3 *dxf_spline_get_p2 (DxfSpline *spline);
+DxfSpline *dxf_spline_set_p2 (DxfSpline *spline, DxfVec3 *p2);
 double dxf_spline_get_x2 (DxfSpline *spline);
 DxfSpline *dxf_spline_set_x2 (DxfSpline *spline, double x2);
 double dxf_spline_get_y2 (DxfSpline *spline);
 DxfSpline *dxf_spline_set_y2 (DxfSpline *spline, double y2);
 double dxf_spline_get_z2 (DxfSpline *spline);
 DxfSpline *dxf_spline_set_z2 (DxfSpline *spline, double z2);
-DxfPoint *dxf_spline_get_p3 (DxfSpline *spline);
-DxfSpline *dxf_spline_set_p3 (DxfSpline *spline, DxfPoint *p3);
+DxfVec3 *dxf_spline_get_p3 (DxfSpline *spline);
+DxfSpline *dxf_spline_set_p3 (DxfSpline *spline, DxfVec3 *p3);
 double dxf_spline_get_x3 (DxfSpline *spline);
 DxfSpline *dxf_spline_set_x3 (DxfSpline *spline, double x3);
 double dxf_spline_get_y3 (DxfSpline *spline);
@@ -348,6 +349,8 @@ DxfSpline *dxf_spline_set_extr_z0 (DxfSpline *spline, double extr_z0);
 DxfSpline *dxf_spline_get_next (DxfSpline *spline);
 DxfSpline *dxf_spline_set_next (DxfSpline *spline, DxfSpline *next);
 DxfSpline *dxf_spline_get_last (DxfSpline *spline);
+int dxf_spline_get_bbox (DxfSpline *spline, DxfBbox *bbox);
+int dxf_spline_transform (DxfSpline *spline, DxfTransform *transform);
 
 
 #ifdef __cplusplus
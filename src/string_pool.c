@@ -0,0 +1,554 @@
+/*!
+ * \file string_pool.c
+ *
+ * \author Copyright (C) 2026
+ * by Bert Timmerman <bert.timmerman@xs4all.nl>.
+ *
+ * \brief Functions for a libDXF string pool (interned strings).
+ *
+ * A drawing holds millions of entities, but only a handful of distinct
+ * layer names, linetype names, style names, materials and owner
+ * handles.\n
+ * Interning these strings keeps one immutable copy of each distinct
+ * string and turns comparisons into pointer comparisons.
+ *
+ * <hr>
+ * <h1><b>Copyright Notices.</b></h1>\n
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License,
+ * or (at your option) any later version.\n\n
+ * This program is distributed in the hope that it will be useful, but
+ * <b>WITHOUT ANY WARRANTY</b>; without even the implied warranty of
+ * <b>MERCHANTABILITY</b> or <b>FITNESS FOR A PARTICULAR PURPOSE</b>.\n
+ * See the GNU General Public License for more details.\n\n
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to:\n
+ * Free Software Foundation, Inc.,\n
+ * 59 Temple Place,\n
+ * Suite 330,\n
+ * Boston,\n
+ * MA 02111 USA.\n
+ * \n
+ * Drawing eXchange Format (DXF) is a defacto industry standard for the
+ * exchange of drawing files between various Computer Aided Drafting
+ * programs.\n
+ * DXF is an industry standard designed by Autodesk(TM).\n
+ * For more details see http://www.autodesk.com.
+ * <hr>
+ */
+
+
+#include "string_pool.h"
+
+#if !defined (_WIN32)
+#  include <pthread.h>
+#  define DXF_STRING_POOL_PTHREADS 1
+#endif
+
+
+/*!
+ * \brief Initial number of slots in the hash table of a
+ * \c DxfStringPool.
+ */
+#define DXF_STRING_POOL_INITIAL_CAPACITY 64
+
+
+#if DXF_STRING_POOL_PTHREADS
+/*!
+ * \brief Lock serializing the caches interning a miss in their shared
+ * pool.
+ */
+static pthread_mutex_t dxf_string_pool_lock = PTHREAD_MUTEX_INITIALIZER;
+#endif
+
+
+/*!
+ * \brief Compute the FNV-1a hash of a string slice.
+ */
+static size_t
+dxf_string_pool_hash
+(
+        const char *s,
+                /*!< Pointer to the first char of the slice. */
+        size_t length
+                /*!< Length of the slice. */
+)
+{
+        uint64_t hash = 14695981039346656037ULL;
+        size_t i;
+
+        for (i = 0; i < length; i++)
+        {
+                hash ^= (unsigned char) s[i];
+                hash *= 1099511628211ULL;
+        }
+        return ((size_t) hash);
+}
+
+
+/*!
+ * \brief Find the slot holding a string slice, or the empty slot
+ * where it should be inserted.
+ */
+static size_t
+dxf_string_pool_find_slot
+(
+        DxfStringPool *pool,
+                /*!< a pointer to a libDXF string pool. */
+        const char *s,
+                /*!< Pointer to the first char of the slice. */
+        size_t length
+                /*!< Length of the slice. */
+)
+{
+        size_t mask = pool->capacity - 1;
+        size_t i = dxf_string_pool_hash (s, length) & mask;
+
+        while (pool->slots[i] != NULL)
+        {
+                if ((strncmp (pool->slots[i], s, length) == 0)
+                  && (pool->slots[i][length] == '\0'))
+                {
+                        break;
+                }
+                i = (i + 1) & mask;
+        }
+        return (i);
+}
+
+
+/*!
+ * \brief Double the number of slots in the hash table of a
+ * \c DxfStringPool.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+static int
+dxf_string_pool_grow
+(
+        DxfStringPool *pool
+                /*!< a pointer to a libDXF string pool. */
+)
+{
+        const char **old_slots = pool->slots;
+        size_t old_capacity = pool->capacity;
+        size_t i;
+
+        pool->capacity = old_capacity * 2;
+        pool->slots = calloc (pool->capacity, sizeof (const char *));
+        if (pool->slots == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () could not allocate memory.\n")),
+                  __FUNCTION__);
+                pool->slots = old_slots;
+                pool->capacity = old_capacity;
+                return (EXIT_FAILURE);
+        }
+        for (i = 0; i < old_capacity; i++)
+        {
+                if (old_slots[i] != NULL)
+                {
+                        pool->slots[dxf_string_pool_find_slot (pool,
+                          old_slots[i], strlen (old_slots[i]))] = old_slots[i];
+                }
+        }
+        free (old_slots);
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Allocate memory for a libDXF \c DxfStringPool.
+ *
+ * \return \c NULL when no memory was allocated, a pointer to the
+ * allocated memory when successful.
+ */
+DxfStringPool *
+dxf_string_pool_new ()
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfStringPool *pool = NULL;
+
+        if ((pool = malloc (sizeof (DxfStringPool))) == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () could not allocate memory.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        memset (pool, 0, sizeof (DxfStringPool));
+        pool->capacity = DXF_STRING_POOL_INITIAL_CAPACITY;
+        pool->slots = calloc (pool->capacity, sizeof (const char *));
+        if (pool->slots == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () could not allocate memory.\n")),
+                  __FUNCTION__);
+                free (pool);
+                return (NULL);
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (pool);
+}
+
+
+/*!
+ * \brief Allocate memory for a libDXF \c DxfStringPool caching the
+ * strings of a shared pool, for use by a single worker thread.
+ *
+ * Interning in the cache returns the pointer interned in \c parent, so
+ * strings read by several threads compare equal with \c ==.\n
+ * Only strings not seen by the cache yet take the lock of the shared
+ * pools, the cache holds no strings of it's own.\n
+ * \c parent must not be used otherwise while caches intern in it, and
+ * must outlive the cache.
+ *
+ * \return \c NULL when no memory was allocated, a pointer to the
+ * allocated memory when successful.
+ */
+DxfStringPool *
+dxf_string_pool_new_cache
+(
+        DxfStringPool *parent
+                /*!< a pointer to the shared libDXF string pool. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfStringPool *pool = NULL;
+
+        /* Do some basic checks. */
+        if (parent == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        pool = dxf_string_pool_new ();
+        if (pool != NULL)
+        {
+                /* A cache of a cache interns in the shared pool. */
+                pool->parent = (parent->parent != NULL) ? parent->parent : parent;
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (pool);
+}
+
+
+/*!
+ * \brief Free the allocated memory for a libDXF \c DxfStringPool and
+ * all strings interned in it.
+ *
+ * Any pointer returned by dxf_string_pool_intern () for this pool
+ * becomes invalid, except for a cache, whose strings are owned by the
+ * shared pool.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_string_pool_free
+(
+        DxfStringPool *pool
+                /*!< a pointer to the memory occupied by the libDXF
+                 * string pool. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfStringPoolChunk *chunk;
+
+        /* Do some basic checks. */
+        if (pool == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        if (pool->chunks != NULL)
+        {
+                dxf_arena_unregister_chunks (pool);
+        }
+        while (pool->chunks != NULL)
+        {
+                chunk = pool->chunks;
+                pool->chunks = chunk->next;
+                free (chunk);
+        }
+        free (pool->slots);
+        free (pool);
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Intern a string slice in a libDXF \c DxfStringPool.
+ *
+ * The slice does not need to be terminated with a '\\0'.
+ *
+ * \return a pointer to the immutable interned copy of the slice, the
+ * same pointer for every slice with the same contents, or \c NULL when
+ * an error occurred.
+ */
+const char *
+dxf_string_pool_intern
+(
+        DxfStringPool *pool,
+                /*!< a pointer to a libDXF string pool. */
+        const char *s,
+                /*!< Pointer to the first char of the slice. */
+        size_t length
+                /*!< Length of the slice. */
+)
+{
+        DxfStringPoolChunk *chunk;
+        char *result;
+        size_t i;
+        size_t size;
+
+        /* Do some basic checks. */
+        if ((pool == NULL) || (s == NULL))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        i = dxf_string_pool_find_slot (pool, s, length);
+        if (pool->slots[i] != NULL)
+        {
+                return (pool->slots[i]);
+        }
+        /* Keep the load factor at or below one half. */
+        if (2 * (pool->count + 1) > pool->capacity)
+        {
+                if (dxf_string_pool_grow (pool) == EXIT_FAILURE)
+                {
+                        return (NULL);
+                }
+                i = dxf_string_pool_find_slot (pool, s, length);
+        }
+        if (pool->parent != NULL)
+        {
+                /* A cache miss, intern in the shared pool and remember
+                 * it's copy. */
+#if DXF_STRING_POOL_PTHREADS
+                pthread_mutex_lock (&dxf_string_pool_lock);
+#endif
+                result = (char *) dxf_string_pool_intern (pool->parent, s, length);
+#if DXF_STRING_POOL_PTHREADS
+                pthread_mutex_unlock (&dxf_string_pool_lock);
+#endif
+                if (result != NULL)
+                {
+                        pool->slots[i] = result;
+                        pool->count++;
+                }
+                return (result);
+        }
+        chunk = pool->chunks;
+        if ((chunk == NULL) || (chunk->size - chunk->used < length + 1))
+        {
+                size = DXF_STRING_POOL_CHUNK_SIZE;
+                if (size < length + 1)
+                {
+                        size = length + 1;
+                }
+                chunk = malloc (sizeof (DxfStringPoolChunk) + size);
+                if (chunk == NULL)
+                {
+                        fprintf (stderr,
+                          (_("Error in %s () could not allocate memory.\n")),
+                          __FUNCTION__);
+                        return (NULL);
+                }
+                /* Register the chunk, so dxf_free () leaves the
+                 * interned strings alone. */
+                if (dxf_arena_register_chunk (pool, DXF_ARENA_OWNER_STRING_POOL,
+                  chunk->data, size) == EXIT_FAILURE)
+                {
+                        free (chunk);
+                        return (NULL);
+                }
+                chunk->size = size;
+                chunk->used = 0;
+                chunk->next = pool->chunks;
+                pool->chunks = chunk;
+        }
+        result = chunk->data + chunk->used;
+        memcpy (result, s, length);
+        result[length] = '\0';
+        chunk->used += length + 1;
+        pool->slots[i] = result;
+        pool->count++;
+        return (result);
+}
+
+
+/*!
+ * \brief Look up a string slice in a libDXF \c DxfStringPool without
+ * interning it.
+ *
+ * \return a pointer to the interned copy of the slice, or \c NULL when
+ * the slice was not interned in \c pool.
+ */
+const char *
+dxf_string_pool_lookup
+(
+        DxfStringPool *pool,
+                /*!< a pointer to a libDXF string pool. */
+        const char *s,
+                /*!< Pointer to the first char of the slice. */
+        size_t length
+                /*!< Length of the slice. */
+)
+{
+        const char *result;
+
+        /* Do some basic checks. */
+        if ((pool == NULL) || (s == NULL))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        result = pool->slots[dxf_string_pool_find_slot (pool, s, length)];
+        if ((result == NULL) && (pool->parent != NULL))
+        {
+#if DXF_STRING_POOL_PTHREADS
+                pthread_mutex_lock (&dxf_string_pool_lock);
+#endif
+                result = dxf_string_pool_lookup (pool->parent, s, length);
+#if DXF_STRING_POOL_PTHREADS
+                pthread_mutex_unlock (&dxf_string_pool_lock);
+#endif
+        }
+        return (result);
+}
+
+
+/*!
+ * \brief Test if a string is stored in a libDXF \c DxfStringPool.
+ *
+ * \return \c TRUE when \c s points into the storage of \c pool,
+ * \c FALSE otherwise.
+ */
+int
+dxf_string_pool_owns
+(
+        DxfStringPool *pool,
+                /*!< a pointer to a libDXF string pool. */
+        const char *s
+                /*!< Pointer to the string to test. */
+)
+{
+        DxfStringPoolChunk *chunk;
+        uintptr_t p = (uintptr_t) s;
+
+        if ((pool == NULL) || (s == NULL))
+        {
+                return (FALSE);
+        }
+        if (pool->parent != NULL)
+        {
+                return (dxf_string_pool_owns (pool->parent, s));
+        }
+        for (chunk = pool->chunks; chunk != NULL; chunk = chunk->next)
+        {
+                if ((p >= (uintptr_t) chunk->data)
+                  && (p < (uintptr_t) (chunk->data + chunk->used)))
+                {
+                        return (TRUE);
+                }
+        }
+        return (FALSE);
+}
+
+
+/*!
+ * \brief Get the number of distinct strings interned in a libDXF
+ * \c DxfStringPool.
+ *
+ * \return the number of interned strings.
+ */
+size_t
+dxf_string_pool_get_count
+(
+        DxfStringPool *pool
+                /*!< a pointer to a libDXF string pool. */
+)
+{
+        /* Do some basic checks. */
+        if (pool == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (0);
+        }
+        return (pool->count);
+}
+
+
+/*!
+ * \brief Test if a string is owned by any live libDXF
+ * \c DxfStringPool.
+ *
+ * The owner of the chunk holding \c s is looked up in the chunk table
+ * shared with the arenas (see dxf_arena_find_owner ()), in
+ * O(log chunks), safe to call from several threads at once.
+ *
+ * \return \c TRUE when \c s was interned in a pool which was not freed
+ * yet, \c FALSE otherwise.
+ */
+int
+dxf_string_is_interned
+(
+        const char *s
+                /*!< Pointer to the string to test. */
+)
+{
+        int type;
+
+        return ((dxf_arena_find_owner (s, &type) != NULL)
+          && (type == DXF_ARENA_OWNER_STRING_POOL));
+}
+
+
+/*!
+ * \brief Free a string member which may hold an interned string.
+ *
+ * Strings owned by a live \c DxfStringPool are left alone, they are
+ * released with the pool, any other string is passed to dxf_free ().\n
+ * The chunks of a pool are registered with the arenas, so this is the
+ * same single lookup as dxf_free ().
+ */
+void
+dxf_string_free
+(
+        char *s
+                /*!< Pointer to the string to free, may be \c NULL. */
+)
+{
+        dxf_free (s);
+}
+
+
+/* EOF */
@@ -0,0 +1,129 @@
+/*!
+ * \file string_pool.h
+ *
+ * \author Copyright (C) 2026
+ * by Bert Timmerman <bert.timmerman@xs4all.nl>.
+ *
+ * \brief Prototypes for a libDXF string pool (interned strings).
+ *
+ * <hr>
+ * <h1><b>Copyright Notices.</b></h1>\n
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License,
+ * or (at your option) any later version.\n\n
+ * This program is distributed in the hope that it will be useful, but
+ * <b>WITHOUT ANY WARRANTY</b>; without even the implied warranty of
+ * <b>MERCHANTABILITY</b> or <b>FITNESS FOR A PARTICULAR PURPOSE</b>.\n
+ * See the GNU General Public License for more details.\n\n
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to:\n
+ * Free Software Foundation, Inc.,\n
+ * 59 Temple Place,\n
+ * Suite 330,\n
+ * Boston,\n
+ * MA 02111 USA.\n
+ * \n
+ * Drawing eXchange Format (DXF) is a defacto industry standard for the
+ * exchange of drawing files between various Computer Aided Drafting
+ * programs.\n
+ * DXF is an industry standard designed by Autodesk(TM).\n
+ * For more details see http://www.autodesk.com.
+ * <hr>
+ */
+
+
+#ifndef LIBDXF_SRC_STRING_POOL_H
+#define LIBDXF_SRC_STRING_POOL_H
+
+
+#include "global.h"
+
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+/*!
+ * \brief Default size of a block of string storage in a
+ * \c DxfStringPool.
+ */
+#define DXF_STRING_POOL_CHUNK_SIZE 65536
+
+
+/*!
+ * \brief DXF definition of a block of string storage in a
+ * \c DxfStringPool.
+ */
+typedef struct
+dxf_string_pool_chunk_struct
+{
+    struct dxf_string_pool_chunk_struct *next;
+        /*!< Pointer to the next (older) chunk.\n
+         * \c NULL in the last chunk. */
+    size_t size;
+        /*!< Number of bytes available in \c data. */
+    size_t used;
+        /*!< Number of bytes in use in \c data. */
+    char data[];
+        /*!< The interned strings, each terminated with a '\\0'. */
+} DxfStringPoolChunk;
+
+
+/*!
+ * \brief DXF definition of a string pool.
+ *
+ * A hash set of immutable, '\\0' terminated strings.\n
+ * Interning the same contents twice returns the same pointer, so
+ * interned strings can be compared for equality with \c ==.\n
+ * The strings are owned by the pool and released all at once by
+ * dxf_string_pool_free ().\n
+ * Members of entities and objects which may hold an interned string
+ * are released with dxf_string_free (), which skips strings owned by
+ * a live pool.\n
+ * A pool is not thread safe, worker threads intern through a cache of
+ * their own (see dxf_string_pool_new_cache ()), which forwards misses
+ * to the shared pool under a lock.
+ */
+typedef struct
+dxf_string_pool_struct
+{
+    const char **slots;
+        /*!< Open addressing hash table of interned strings,
+         * \c NULL for an empty slot. */
+    size_t capacity;
+        /*!< Number of slots, always a power of two. */
+    size_t count;
+        /*!< Number of interned strings. */
+    DxfStringPoolChunk *chunks;
+        /*!< Storage for the interned strings (single linked list,
+         * newest first), each chunk registered with
+         * dxf_arena_register_chunk ().\n
+         * Always \c NULL in a cache. */
+    struct dxf_string_pool_struct *parent;
+        /*!< The shared pool a cache interns in (borrowed), \c NULL
+         * for a pool owning it's strings. */
+} DxfStringPool;
+
+
+DxfStringPool *dxf_string_pool_new ();
+DxfStringPool *dxf_string_pool_new_cache (DxfStringPool *parent);
+int dxf_string_pool_free (DxfStringPool *pool);
+const char *dxf_string_pool_intern (DxfStringPool *pool, const char *s, size_t length);
+const char *dxf_string_pool_lookup (DxfStringPool *pool, const char *s, size_t length);
+int dxf_string_pool_owns (DxfStringPool *pool, const char *s);
+size_t dxf_string_pool_get_count (DxfStringPool *pool);
+int dxf_string_is_interned (const char *s);
+void dxf_string_free (char *s);
+
+
+#ifdef __cplusplus
+}
+#endif
+
+
+#endif /* LIBDXF_SRC_STRING_POOL_H */
+
+
+/* EOF */
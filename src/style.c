@@ -47,6 +47,7 @@
 
 
 #include "style.h"
+#include "util.h"
 
 
 /*!
@@ -69,7 +70,7 @@ dxf_style_new ()
         size = sizeof (DxfStyle);
         /* avoid malloc of 0 bytes */
         if (size == 0) size = 1;
-        if ((style = malloc (size)) == NULL)
+        if ((style = dxf_malloc (size)) == NULL)
         {
                 fprintf (stderr,
                   (_("Error in %s () could not allocate memory for a DxfStyle struct.\n")),
@@ -119,18 +120,18 @@ dxf_style_init
                 __FUNCTION__);
               return (NULL);
         }
-        style->id_code = 0;
-        style->style_name = strdup ("");
-        style->primary_font_filename = strdup ("");
-        style->big_font_filename = strdup ("");
+        style->id_code = DXF_HANDLE_NONE;
+        style->style_name = dxf_strdup ("");
+        style->primary_font_filename = dxf_strdup ("");
+        style->big_font_filename = dxf_strdup ("");
         style->height = 0.0;
         style->width = 0.0;
         style->last_height = 0.0;
         style->oblique_angle = 0.0;
         style->flag = 0;
         style->text_generation_flag = 0;
-        style->dictionary_owner_soft = strdup ("");
-        style->dictionary_owner_hard = strdup ("");
+        style->dictionary_owner_soft = 0;
+        style->dictionary_owner_hard = 0;
         style->ttf_flags = 0;
         style->next = NULL;
 #if DEBUG
@@ -163,7 +164,9 @@ dxf_style_read
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        char *temp_string = NULL;
+        char temp_string[DXF_MAX_STRING_LENGTH];
+        char id_string[DXF_MAX_STRING_LENGTH];
+        int group_code;
 
         /* Do some basic checks. */
         if (fp == NULL)
@@ -171,8 +174,6 @@ dxf_style_read
                 fprintf (stderr,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
-                /* Clean up. */
-                free (temp_string);
                 return (NULL);
         }
         if (style == NULL)
@@ -182,142 +183,124 @@ dxf_style_read
                   __FUNCTION__);
                 style = dxf_style_init (style);
         }
-        (fp->line_number)++;
-        fscanf (fp->fp, "%[^\n]", temp_string);
-        while (strcmp (temp_string, "0") != 0)
+        while ((dxf_read_group_code (fp, &group_code) == EXIT_SUCCESS)
+          && (group_code != 0))
         {
-                if (ferror (fp->fp))
+                if (dxf_read_error (fp))
                 {
                         fprintf (stderr,
                           (_("Error in %s () while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
-                        fclose (fp->fp);
-                        /* Clean up. */
-                        free (temp_string);
                         return (NULL);
                 }
-                if (strcmp (temp_string, "5") == 0)
-                {
-                        /* Now follows a string containing a sequential
-                         * id number. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%x\n", (uint *) &style->id_code);
-                }
-                else if (strcmp (temp_string, "2") == 0)
-                {
-                        /* Now follows a string containing a style name. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, style->style_name);
-                }
-                else if (strcmp (temp_string, "3") == 0)
-                {
-                        /* Now follows a string containing a primary
-                         * font filename. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, style->primary_font_filename);
-                }
-                else if (strcmp (temp_string, "4") == 0)
-                {
-                        /* Now follows a string containing a big font
-                         * filename. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, style->big_font_filename);
-                }
-                else if (strcmp (temp_string, "40") == 0)
-                {
-                        /* Now follows a string containing the
-                         * height. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &style->height);
-                }
-                else if (strcmp (temp_string, "41") == 0)
-                {
-                        /* Now follows a string containing the
-                         * width. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &style->width);
-                }
-                else if (strcmp (temp_string, "42") == 0)
-                {
-                        /* Now follows a string containing the
-                         * last used height. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &style->last_height);
-                }
-                else if (strcmp (temp_string, "50") == 0)
-                {
-                        /* Now follows a string containing the
-                         * oblique angle. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &style->oblique_angle);
-                }
-                else if (strcmp (temp_string, "70") == 0)
-                {
-                        /* Now follows a string containing the
-                         * standard flag value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%d\n", &style->flag);
-                }
-                else if (strcmp (temp_string, "71") == 0)
+                switch (group_code)
                 {
-                        /* Now follows a string containing the
-                         * text generation flag value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%d\n", &style->text_generation_flag);
-                }
-                else if ((fp->acad_version_number >= AutoCAD_13)
-                        && (strcmp (temp_string, "100") == 0))
-                {
-                        /* Now follows a string containing the
-                         * subclass marker value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
-                        if ((strcmp (temp_string, "AcDbSymbolTableRecord") != 0)
-                        && ((strcmp (temp_string, "AcDbTextStyleTableRecord") != 0)))
-                        {
+                        case 5:
+                                /* Now follows a string containing a sequential
+                                 * id number. */
+                                dxf_read_handle (fp, &style->id_code);
+                                break;
+                        case 2:
+                                /* Now follows a string containing a style name. */
+                                dxf_read_string_interned (fp, &style->style_name);
+                                break;
+                        case 3:
+                                /* Now follows a string containing a primary
+                                 * font filename. */
+                                dxf_read_string (fp, &style->primary_font_filename);
+                                break;
+                        case 4:
+                                /* Now follows a string containing a big font
+                                 * filename. */
+                                dxf_read_string (fp, &style->big_font_filename);
+                                break;
+                        case 40:
+                                /* Now follows a string containing the
+                                 * height. */
+                                dxf_read_double (fp, &style->height);
+                                break;
+                        case 41:
+                                /* Now follows a string containing the
+                                 * width. */
+                                dxf_read_double (fp, &style->width);
+                                break;
+                        case 42:
+                                /* Now follows a string containing the
+                                 * last used height. */
+                                dxf_read_double (fp, &style->last_height);
+                                break;
+                        case 50:
+                                /* Now follows a string containing the
+                                 * oblique angle. */
+                                dxf_read_double (fp, &style->oblique_angle);
+                                break;
+                        case 70:
+                                /* Now follows a string containing the
+                                 * standard flag value. */
+                                dxf_read_int (fp, &style->flag);
+                                break;
+                        case 71:
+                                /* Now follows a string containing the
+                                 * text generation flag value. */
+                                dxf_read_int (fp, &style->text_generation_flag);
+                                break;
+                        case 100:
+                                if (fp->acad_version_number >= AutoCAD_13)
+                                {
+                                        /* Now follows a string containing the
+                                         * subclass marker value. */
+                                        dxf_read_line (temp_string, fp);
+                                        if ((strcmp (temp_string, "AcDbSymbolTableRecord") != 0)
+                                        && ((strcmp (temp_string, "AcDbTextStyleTableRecord") != 0)))
+                                        {
+                                                fprintf (stderr,
+                                                  (_("Warning in %s () found a bad subclass marker in: %s in line: %d.\n")),
+                                                  __FUNCTION__, fp->filename, fp->line_number);
+                                        }
+                                }
+                                else
+                                {
+                                        fprintf (stderr,
+                                          (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
+                                          __FUNCTION__, fp->filename, fp->line_number);
+                                        /* Skip the value of the unknown group code. */
+                                        dxf_read_line (temp_string, fp);
+                                }
+                                break;
+                        case 330:
+                                /* Now follows a string containing Soft-pointer
+                                 * ID/handle to owner dictionary. */
+                                dxf_read_handle (fp, &style->dictionary_owner_soft);
+                                break;
+                        case 360:
+                                /* Now follows a string containing Hard owner
+                                 * ID/handle to owner dictionary. */
+                                dxf_read_handle (fp, &style->dictionary_owner_hard);
+                                break;
+                        case 999:
+                                /* Now follows a string containing a comment. */
+                                dxf_read_line (temp_string, fp);
+                                fprintf (stdout, "DXF comment: %s\n", temp_string);
+                                break;
+                        case 1071:
+                                /* Now follows a string containing true type font flags. */
+                                dxf_read_int (fp, &style->ttf_flags);
+                                break;
+                        default:
                                 fprintf (stderr,
-                                  (_("Warning in %s () found a bad subclass marker in: %s in line: %d.\n")),
+                                  (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
                                   __FUNCTION__, fp->filename, fp->line_number);
-                        }
-                }
-                else if (strcmp (temp_string, "330") == 0)
-                {
-                        /* Now follows a string containing Soft-pointer
-                         * ID/handle to owner dictionary. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, style->dictionary_owner_soft);
-                }
-                else if (strcmp (temp_string, "360") == 0)
-                {
-                        /* Now follows a string containing Hard owner
-                         * ID/handle to owner dictionary. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, style->dictionary_owner_hard);
-                }
-                else if (strcmp (temp_string, "999") == 0)
-                {
-                        /* Now follows a string containing a comment. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
-                        fprintf (stdout, "DXF comment: %s\n", temp_string);
-                }
-                else if (strcmp (temp_string, "1071") == 0)
-                {
-                        /* Now follows a string containing true type font flags. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%d\n", &style->ttf_flags);
-                }
-                else
-                {
-                        fprintf (stderr,
-                          (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
-                          __FUNCTION__, fp->filename, fp->line_number);
+                                /* Skip the value of the unknown group code. */
+                                dxf_read_line (temp_string, fp);
+                                break;
                 }
         }
         /* Handle omitted members and/or illegal values. */
         if (strcmp (style->style_name, "") == 0)
         {
-                sprintf (style->style_name, "%i", style->id_code);
+                snprintf (id_string, sizeof (id_string), "%" PRIu64, style->id_code);
+                dxf_string_free (style->style_name);
+                style->style_name = dxf_strdup (id_string);
                 fprintf (stderr,
                   (_("Warning in %s () illegal style name value found while reading from: %s in line: %d.\n")),
                   __FUNCTION__, fp->filename, fp->line_number);
@@ -325,13 +308,13 @@ dxf_style_read
         if ((strcmp (style->primary_font_filename, "") == 0)
           && (style->flag == 1))
         {
-                sprintf (style->primary_font_filename, "%i", style->id_code);
+                snprintf (id_string, sizeof (id_string), "%" PRIu64, style->id_code);
+                dxf_free (style->primary_font_filename);
+                style->primary_font_filename = dxf_strdup (id_string);
                 fprintf (stderr,
                   (_("Warning in %s () illegal primary font filename value found while reading from: %s in line: %d.\n")),
                   __FUNCTION__, fp->filename, fp->line_number);
         }
-        /* Clean up. */
-        free (temp_string);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -357,7 +340,7 @@ dxf_style_write
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        char *dxf_entity_name = strdup ("STYLE");
+        char *dxf_entity_name = dxf_strdup ("STYLE");
 
         /* Do some basic checks. */
         if (fp == NULL)
@@ -366,7 +349,7 @@ dxf_style_write
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (style == NULL)
@@ -375,14 +358,14 @@ dxf_style_write
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         /* Start writing output. */
-        fprintf (fp->fp, "  0\n%s\n", dxf_entity_name);
-        if (style->id_code != -1)
+        dxf_write_string (fp, 0, dxf_entity_name);
+        if (style->id_code != DXF_HANDLE_NONE)
         {
-                fprintf (fp->fp, "  5\n%x\n", style->id_code);
+                dxf_write_hex (fp, 5, style->id_code);
         }
         /*!
          * \todo for version R14.\n
@@ -394,37 +377,37 @@ dxf_style_write
          * 102 groups are application defined (optional).\n\n
          * End of group, "}" (optional), with Group code 102.
          */
-        if ((strcmp (style->dictionary_owner_soft, "") != 0)
+        if ((style->dictionary_owner_soft != 0)
           && (fp->acad_version_number >= AutoCAD_14))
         {
-                fprintf (fp->fp, "102\n{ACAD_REACTORS\n");
-                fprintf (fp->fp, "330\n%s\n", style->dictionary_owner_soft);
-                fprintf (fp->fp, "102\n}\n");
+                dxf_write_string (fp, 102, "{ACAD_REACTORS");
+                dxf_write_hex (fp, 330, style->dictionary_owner_soft);
+                dxf_write_string (fp, 102, "}");
         }
-        if ((strcmp (style->dictionary_owner_hard, "") != 0)
+        if ((style->dictionary_owner_hard != 0)
           && (fp->acad_version_number >= AutoCAD_14))
         {
-                fprintf (fp->fp, "102\n{ACAD_XDICTIONARY\n");
-                fprintf (fp->fp, "360\n%s\n", style->dictionary_owner_hard);
-                fprintf (fp->fp, "102\n}\n");
+                dxf_write_string (fp, 102, "{ACAD_XDICTIONARY");
+                dxf_write_hex (fp, 360, style->dictionary_owner_hard);
+                dxf_write_string (fp, 102, "}");
         }
         if (fp->acad_version_number >= AutoCAD_13)
         {
-                fprintf (fp->fp, "100\nAcDbSymbolTableRecord\n");
-                fprintf (fp->fp, "100\nAcDbTextStyleTableRecord\n");
-        }
-        fprintf (fp->fp, "  2\n%s\n", style->style_name);
-        fprintf (fp->fp, " 70\n%d\n", style->flag);
-        fprintf (fp->fp, " 40\n%f\n", style->height);
-        fprintf (fp->fp, " 41\n%f\n", style->width);
-        fprintf (fp->fp, " 50\n%f\n", style->oblique_angle);
-        fprintf (fp->fp, " 71\n%d\n", style->text_generation_flag);
-        fprintf (fp->fp, " 42\n%f\n", style->last_height);
-        fprintf (fp->fp, "  3\n%s\n", style->primary_font_filename);
-        fprintf (fp->fp, "  4\n%s\n", style->big_font_filename);
-        fprintf (fp->fp, "1071\n%d\n", style->ttf_flags);
+                dxf_write_string (fp, 100, "AcDbSymbolTableRecord");
+                dxf_write_string (fp, 100, "AcDbTextStyleTableRecord");
+        }
+        dxf_write_string (fp, 2, style->style_name);
+        dxf_write_int (fp, 70, style->flag);
+        dxf_write_double (fp, 40, style->height);
+        dxf_write_double (fp, 41, style->width);
+        dxf_write_double (fp, 50, style->oblique_angle);
+        dxf_write_int (fp, 71, style->text_generation_flag);
+        dxf_write_double (fp, 42, style->last_height);
+        dxf_write_string (fp, 3, style->primary_font_filename);
+        dxf_write_string (fp, 4, style->big_font_filename);
+        dxf_write_int (fp, 1071, style->ttf_flags);
         /* Clean up. */
-        free (dxf_entity_name);
+        dxf_free (dxf_entity_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -465,12 +448,10 @@ dxf_style_free
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        free (style->style_name);
-        free (style->primary_font_filename);
-        free (style->big_font_filename);
-        free (style->dictionary_owner_soft);
-        free (style->dictionary_owner_hard);
-        free (style);
+        dxf_string_free (style->style_name);
+        dxf_free (style->primary_font_filename);
+        dxf_free (style->big_font_filename);
+        dxf_free (style);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -516,7 +497,7 @@ dxf_style_free_list
  *
  * \return \c id_code.
  */
-int
+uint64_t
 dxf_style_get_id_code
 (
         DxfStyle *style
@@ -535,12 +516,6 @@ dxf_style_get_id_code
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (style->id_code < 0)
-        {
-                fprintf (stderr,
-                  (_("Warning in %s () a negative value was found.\n")),
-                  __FUNCTION__);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -556,7 +531,7 @@ dxf_style_set_id_code
 (
         DxfStyle *style,
                 /*!< a pointer to a DXF \c STYLE symbol table entries. */
-        int id_code
+        uint64_t id_code
                 /*!< the \c id_code to be set for the entity.\n
                  * This is to be an unique (sequential) number in the
                  * DXF file. */
@@ -573,12 +548,6 @@ dxf_style_set_id_code
                   __FUNCTION__);
                 return (NULL);
         }
-        if (id_code < 0)
-        {
-                fprintf (stderr,
-                  (_("Warning in %s () a negative value was passed.\n")),
-                  __FUNCTION__);
-        }
         style->id_code = id_code;
 #if DEBUG
         DXF_DEBUG_END
@@ -621,7 +590,7 @@ dxf_style_get_style_name
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (style->style_name));
+        return (dxf_strdup (style->style_name));
 }
 
 
@@ -659,7 +628,7 @@ dxf_style_set_color_name
                   __FUNCTION__);
                 return (NULL);
         }
-        style->style_name = strdup (style_name);
+        style->style_name = dxf_strdup (style_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -702,7 +671,7 @@ dxf_style_get_primary_font_filename
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (style->primary_font_filename));
+        return (dxf_strdup (style->primary_font_filename));
 }
 
 
@@ -741,7 +710,7 @@ dxf_style_set_primary_font_filename
                   __FUNCTION__);
                 return (NULL);
         }
-        style->primary_font_filename = strdup (primary_font_filename);
+        style->primary_font_filename = dxf_strdup (primary_font_filename);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -784,7 +753,7 @@ dxf_style_get_big_font_filename
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (style->big_font_filename));
+        return (dxf_strdup (style->big_font_filename));
 }
 
 
@@ -823,7 +792,7 @@ dxf_style_set_big_font_filename
                   __FUNCTION__);
                 return (NULL);
         }
-        style->big_font_filename = strdup (big_font_filename);
+        style->big_font_filename = dxf_strdup (big_font_filename);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1501,11 +1470,9 @@ dxf_style_is_text_upside_down
  * \brief Get the pointer to the \c dictionary_owner_soft from a DXF 
  * \c STYLE symbol table entry.
  *
- * \return pointer to the \c dictionary_owner_soft.
- *
- * \warning No checks are performed on the returned pointer (string).
+ * \return the handle of the \c dictionary_owner_soft.
  */
-char *
+uint64_t
 dxf_style_get_dictionary_owner_soft
 (
         DxfStyle *style
@@ -1521,19 +1488,12 @@ dxf_style_get_dictionary_owner_soft
                 fprintf (stderr,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
-                return (NULL);
-        }
-        if (style->dictionary_owner_soft ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
+                return (0);
         }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (style->dictionary_owner_soft));
+        return (style->dictionary_owner_soft);
 }
 
 
@@ -1546,8 +1506,8 @@ dxf_style_set_dictionary_owner_soft
 (
         DxfStyle *style,
                 /*!< a pointer to a DXF \c STYLE symbol table entry. */
-        char *dictionary_owner_soft
-                /*!< a string containing the pointer to the \c
+        uint64_t dictionary_owner_soft
+                /*!< the handle of the \c
                  * dictionary_owner_soft for the entity. */
 )
 {
@@ -1562,14 +1522,7 @@ dxf_style_set_dictionary_owner_soft
                   __FUNCTION__);
                 return (NULL);
         }
-        if (dictionary_owner_soft == NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was passed.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
-        style->dictionary_owner_soft = strdup (dictionary_owner_soft);
+        style->dictionary_owner_soft = dictionary_owner_soft;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1581,11 +1534,9 @@ dxf_style_set_dictionary_owner_soft
  * \brief Get the pointer to the \c dictionary_owner_hard from a DXF 
  * \c STYLE symbol table entry.
  *
- * \return pointer to the \c dictionary_owner_hard.
- *
- * \warning No checks are performed on the returned pointer (string).
+ * \return the handle of the \c dictionary_owner_hard.
  */
-char *
+uint64_t
 dxf_style_get_dictionary_owner_hard
 (
         DxfStyle *style
@@ -1601,19 +1552,12 @@ dxf_style_get_dictionary_owner_hard
                 fprintf (stderr,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
-                return (NULL);
-        }
-        if (style->dictionary_owner_hard ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
+                return (0);
         }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (style->dictionary_owner_hard));
+        return (style->dictionary_owner_hard);
 }
 
 
@@ -1626,8 +1570,8 @@ dxf_style_set_dictionary_owner_hard
 (
         DxfStyle *style,
                 /*!< a pointer to a DXF \c STYLE symbol table entry. */
-        char *dictionary_owner_hard
-                /*!< a string containing the pointer to the \c
+        uint64_t dictionary_owner_hard
+                /*!< the handle of the \c
                  * dictionary_owner_hard for the symbol table entry. */
 )
 {
@@ -1642,14 +1586,7 @@ dxf_style_set_dictionary_owner_hard
                   __FUNCTION__);
                 return (NULL);
         }
-        if (dictionary_owner_hard == NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was passed.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
-        style->dictionary_owner_hard = strdup (dictionary_owner_hard);
+        style->dictionary_owner_hard = dictionary_owner_hard;
 #if DEBUG
         DXF_DEBUG_END
 #endif
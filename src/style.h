@@ -70,7 +70,7 @@ extern "C" {
 typedef struct
 dxf_style_struct
 {
-        int id_code;
+        uint64_t id_code;
                 /*!< Identification number for the entity.\n
                  * This is to be an unique (sequential) number in the DXF
                  * file.\n
@@ -125,10 +125,10 @@ dxf_style_struct
                  * <li value = "4"> Text is upside down (mirrored in Y).</li>
                  * </ol>\n
                  * Group code = 71. */
-        char *dictionary_owner_soft;
+        uint64_t dictionary_owner_soft;
                 /*!< Soft-pointer ID/handle to owner dictionary (optional).\n
                  * Group code = 330. */
-        char *dictionary_owner_hard;
+        uint64_t dictionary_owner_hard;
                 /*!< Hard owner ID/handle to owner dictionary (optional).\n
                  * Group code = 360. */
         int32_t ttf_flags;
@@ -147,8 +147,8 @@ DxfStyle *dxf_style_read (DxfFile *fp, DxfStyle *style);
 int dxf_style_write (DxfFile *fp, DxfStyle *style);
 int dxf_style_free (DxfStyle *style);
 void dxf_style_free_list (DxfStyle *styles);
-int dxf_style_get_id_code (DxfStyle *style);
-DxfStyle *dxf_style_set_id_code (DxfStyle *style, int id_code);
+uint64_t dxf_style_get_id_code (DxfStyle *style);
+DxfStyle *dxf_style_set_id_code (DxfStyle *style, uint64_t id_code);
 char *dxf_style_get_style_name (DxfStyle *style);
 DxfStyle *dxf_style_set_color_name (DxfStyle *style, char *style_name);
 char *dxf_style_get_primary_font_filename (DxfStyle *style);
@@ -174,10 +174,10 @@ int dxf_style_get_text_generation_flag (DxfStyle *style);
 DxfStyle *dxf_style_set_text_generation_flag (DxfStyle *style, int text_generation_flag);
 int dxf_style_is_text_backward (DxfStyle *style);
 int dxf_style_is_text_upside_down (DxfStyle *style);
-char *dxf_style_get_dictionary_owner_soft (DxfStyle *style);
-DxfStyle *dxf_style_set_dictionary_owner_soft (DxfStyle *style, char *dictionary_owner_soft);
-char *dxf_style_get_dictionary_owner_hard (DxfStyle *style);
-DxfStyle *dxf_style_set_dictionary_owner_hard (DxfStyle *style, char *dictionary_owner_soft);
+uint64_t dxf_style_get_dictionary_owner_soft (DxfStyle *style);
+DxfStyle *dxf_style_set_dictionary_owner_soft (DxfStyle *style, uint64_t dictionary_owner_soft);
+uint64_t dxf_style_get_dictionary_owner_hard (DxfStyle *style);
+DxfStyle *dxf_style_set_dictionary_owner_hard (DxfStyle *style, uint64_t dictionary_owner_hard);
 int32_t dxf_style_get_ttf_flags (DxfStyle *style);
 DxfStyle *dxf_style_set_ttf_flags (DxfStyle *style, int32_t ttf_flags);
 DxfStyle *dxf_style_get_next (DxfStyle *style);
@@ -42,6 +42,7 @@
 
 
 #include "sun.h"
+#include "util.h"
 
 
 /*!
@@ -64,7 +65,7 @@ dxf_sun_new ()
         size = sizeof (DxfSun);
         /* avoid malloc of 0 bytes */
         if (size == 0) size = 1;
-        if ((sun = malloc (size)) == NULL)
+        if ((sun = dxf_malloc (size)) == NULL)
         {
                 fprintf (stderr,
                   (_("Error in %s () could not allocate memory.\n")),
@@ -114,9 +115,9 @@ dxf_sun_init
                   __FUNCTION__);
                 return (NULL);
         }
-        sun->id_code = 0;
-        sun->linetype = strdup (DXF_DEFAULT_LINETYPE);
-        sun->layer = strdup (DXF_DEFAULT_LAYER);
+        sun->id_code = DXF_HANDLE_NONE;
+        sun->linetype = dxf_strdup (DXF_DEFAULT_LINETYPE);
+        sun->layer = dxf_strdup (DXF_DEFAULT_LAYER);
         sun->elevation = 0.0;
         sun->thickness = 0.0;
         sun->linetype_scale = DXF_DEFAULT_LINETYPE_SCALE;
@@ -127,14 +128,14 @@ dxf_sun_init
         sun->shadow_mode = 0;
         sun->binary_graphics_data = (DxfBinaryGraphicsData *) dxf_binary_graphics_data_new ();
         sun->binary_graphics_data = (DxfBinaryGraphicsData *) dxf_binary_graphics_data_init (sun->binary_graphics_data);
-        sun->dictionary_owner_soft = strdup ("");
-        sun->object_owner_soft = strdup ("");
-        sun->material = strdup ("");
-        sun->dictionary_owner_hard = strdup ("");
+        sun->dictionary_owner_soft = 0;
+        sun->object_owner_soft = 0;
+        sun->material = 0;
+        sun->dictionary_owner_hard = 0;
         sun->lineweight = 0;
-        sun->plot_style_name = strdup ("");
+        sun->plot_style_name = 0;
         sun->color_value = 0;
-        sun->color_name = strdup ("");
+        sun->color_name = dxf_strdup ("");
         sun->transparency = 0;
         sun->intensity = 0.0;
         sun->sun_color = DXF_COLOR_BYLAYER;
@@ -178,7 +179,8 @@ dxf_sun_read
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        char *temp_string = NULL;
+        char temp_string[DXF_MAX_STRING_LENGTH];
+        int group_code;
         int iter92;
         DxfBinaryGraphicsData *iter310 = NULL;
         int iter330;
@@ -189,8 +191,6 @@ dxf_sun_read
                 fprintf (stderr,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
-                /* Clean up. */
-                free (temp_string);
                 return (NULL);
         }
         if (sun == NULL)
@@ -203,300 +203,250 @@ dxf_sun_read
         iter92 = 0;
         iter310 = (DxfBinaryGraphicsData *) sun->binary_graphics_data;
         iter330 = 0;
-        (fp->line_number)++;
-        fscanf (fp->fp, "%[^\n]", temp_string);
-        while (strcmp (temp_string, "0") != 0)
+        while ((dxf_read_group_code (fp, &group_code) == EXIT_SUCCESS)
+          && (group_code != 0))
         {
-                if (ferror (fp->fp))
+                if (dxf_read_error (fp))
                 {
                         fprintf (stderr,
                           (_("Error in %s () while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
-                        fclose (fp->fp);
-                        /* Clean up. */
-                        free (temp_string);
                         return (NULL);
                 }
-                if (strcmp (temp_string, "5") == 0)
-                {
-                        /* Now follows a string containing a sequential
-                         * id number. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%x\n", (uint *) &sun->id_code);
-                }
-                else if (strcmp (temp_string, "6") == 0)
-                {
-                        /* Now follows a string containing a linetype
-                         * name. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, sun->linetype);
-                }
-                else if (strcmp (temp_string, "8") == 0)
-                {
-                        /* Now follows a string containing a layer name. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, sun->layer);
-                }
-                else if ((fp->acad_version_number <= AutoCAD_11)
-                        && (strcmp (temp_string, "38") == 0))
-                {
-                        /* Now follows a string containing the
-                         * elevation. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &sun->elevation);
-                }
-                else if (strcmp (temp_string, "39") == 0)
-                {
-                        /* Now follows a string containing the
-                         * thickness. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &sun->thickness);
-                }
-                else if (strcmp (temp_string, "40") == 0)
-                {
-                        /* Now follows a string containing the
-                         * intensity. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &sun->intensity);
-                }
-                else if (strcmp (temp_string, "48") == 0)
-                {
-                        /* Now follows a string containing the linetype
-                         * scale. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &sun->linetype_scale);
-                }
-                else if (strcmp (temp_string, "60") == 0)
-                {
-                        /* Now follows a string containing the
-                         * visibility value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%hd\n", &sun->visibility);
-                }
-                else if (strcmp (temp_string, "62") == 0)
-                {
-                        /* Now follows a string containing the
-                         * color value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%d\n", &sun->color);
-                }
-                else if (strcmp (temp_string, "63") == 0)
-                {
-                        /* Now follows a string containing the sun
-                         * color value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%d\n", &sun->sun_color);
-                }
-                else if (strcmp (temp_string, "67") == 0)
-                {
-                        /* Now follows a string containing the
-                         * paperspace value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%d\n", &sun->paperspace);
-                }
-                else if (strcmp (temp_string, "70") == 0)
+                switch (group_code)
                 {
-                        /* Now follows a string containing the
-                         * shadow_type value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%d\n", &sun->shadow_type);
-                }
-                else if (strcmp (temp_string, "71") == 0)
-                {
-                        /* Now follows a string containing the
-                         * shadow_map_size value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%d\n", &sun->shadow_map_size);
-                }
-                else if (strcmp (temp_string, "90") == 0)
-                {
-                        /* Now follows a string containing the
-                         * version value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%" PRIi32 "\n", &sun->version);
-                }
-                else if (strcmp (temp_string, "91") == 0)
-                {
-                        /* Now follows a string containing the
-                         * julian_day value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%" PRIi32 "\n", &sun->julian_day);
-                }
-                else if (strcmp (temp_string, "92") == 0)
-                {
-                        if (iter92 == 0)
-                        {
+                        case 5:
+                                /* Now follows a string containing a sequential
+                                 * id number. */
+                                dxf_read_handle (fp, &sun->id_code);
+                                break;
+                        case 6:
+                                /* Now follows a string containing a linetype
+                                 * name. */
+                                dxf_read_string_interned (fp, &sun->linetype);
+                                break;
+                        case 8:
+                                /* Now follows a string containing a layer name. */
+                                dxf_read_string_interned (fp, &sun->layer);
+                                break;
+                        case 38:
+                                if (fp->acad_version_number <= AutoCAD_11)
+                                {
+                                        /* Now follows a string containing the
+                                         * elevation. */
+                                        dxf_read_double (fp, &sun->elevation);
+                                }
+                                else
+                                {
+                                        fprintf (stderr,
+                                          (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
+                                          __FUNCTION__, fp->filename, fp->line_number);
+                                        /* Skip the value of the unknown group code. */
+                                        dxf_read_line (temp_string, fp);
+                                }
+                                break;
+                        case 39:
                                 /* Now follows a string containing the
-                                 * graphics data size value. */
-                                (fp->line_number)++;
-                                fscanf (fp->fp, "%" PRIi32 "\n", &sun->graphics_data_size);
-                        }
-                        if (iter92 == 1)
-                        {
+                                 * thickness. */
+                                dxf_read_double (fp, &sun->thickness);
+                                break;
+                        case 40:
                                 /* Now follows a string containing the
-                                 * time value. */
-                                (fp->line_number)++;
-                                fscanf (fp->fp, "%" PRIi32 "\n", &sun->time);
-                        }
-                        iter92++;
-                }
-                else if ((fp->acad_version_number >= AutoCAD_13)
-                        && (strcmp (temp_string, "100") == 0))
-                {
-                        /* Now follows a string containing the
-                         * subclass marker value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
-                        if ((strcmp (temp_string, "AcDbEntity") != 0)
-                        && ((strcmp (temp_string, "AcDbSun") != 0)))
-                        {
+                                 * intensity. */
+                                dxf_read_double (fp, &sun->intensity);
+                                break;
+                        case 48:
+                                /* Now follows a string containing the linetype
+                                 * scale. */
+                                dxf_read_double (fp, &sun->linetype_scale);
+                                break;
+                        case 60:
+                                /* Now follows a string containing the
+                                 * visibility value. */
+                                dxf_read_int16 (fp, &sun->visibility);
+                                break;
+                        case 62:
+                                /* Now follows a string containing the
+                                 * color value. */
+                                dxf_read_int (fp, &sun->color);
+                                break;
+                        case 63:
+                                /* Now follows a string containing the sun
+                                 * color value. */
+                                dxf_read_int (fp, &sun->sun_color);
+                                break;
+                        case 67:
+                                /* Now follows a string containing the
+                                 * paperspace value. */
+                                dxf_read_int (fp, &sun->paperspace);
+                                break;
+                        case 70:
+                                /* Now follows a string containing the
+                                 * shadow_type value. */
+                                dxf_read_int (fp, &sun->shadow_type);
+                                break;
+                        case 71:
+                                /* Now follows a string containing the
+                                 * shadow_map_size value. */
+                                dxf_read_int (fp, &sun->shadow_map_size);
+                                break;
+                        case 90:
+                                /* Now follows a string containing the
+                                 * version value. */
+                                dxf_read_int32 (fp, &sun->version);
+                                break;
+                        case 91:
+                                /* Now follows a string containing the
+                                 * julian_day value. */
+                                dxf_read_int32 (fp, &sun->julian_day);
+                                break;
+                        case 92:
+                                if (iter92 == 0)
+                                {
+                                        /* Now follows a string containing the
+                                         * graphics data size value. */
+                                        dxf_read_int32 (fp, &sun->graphics_data_size);
+                                }
+                                if (iter92 == 1)
+                                {
+                                        /* Now follows a string containing the
+                                         * time value. */
+                                        dxf_read_int32 (fp, &sun->time);
+                                }
+                                iter92++;
+                                break;
+                        case 100:
+                                if (fp->acad_version_number >= AutoCAD_13)
+                                {
+                                        /* Now follows a string containing the
+                                         * subclass marker value. */
+                                        dxf_read_line (temp_string, fp);
+                                        if ((strcmp (temp_string, "AcDbEntity") != 0)
+                                        && ((strcmp (temp_string, "AcDbSun") != 0)))
+                                        {
+                                                fprintf (stderr,
+                                                  (_("Warning in %s () found a bad subclass marker in: %s in line: %d.\n")),
+                                                  __FUNCTION__, fp->filename, fp->line_number);
+                                        }
+                                }
+                                else
+                                {
+                                        fprintf (stderr,
+                                          (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
+                                          __FUNCTION__, fp->filename, fp->line_number);
+                                        /* Skip the value of the unknown group code. */
+                                        dxf_read_line (temp_string, fp);
+                                }
+                                break;
+                        case 160:
+                                /* Now follows a string containing the
+                                 * graphics data size value. */
+                                dxf_read_int (fp, &sun->graphics_data_size);
+                                break;
+                        case 280:
+                                /* Now follows a string containing the shadow
+                                 * softness value. */
+                                dxf_read_int16 (fp, &sun->shadow_softness);
+                                break;
+                        case 284:
+                                /* Now follows a string containing the shadow
+                                 * mode value. */
+                                dxf_read_int16 (fp, &sun->shadow_mode);
+                                break;
+                        case 290:
+                                /* Now follows a string containing the status
+                                 * value. */
+                                dxf_read_int (fp, &sun->status);
+                                break;
+                        case 291:
+                                /* Now follows a string containing the shadows
+                                 * value. */
+                                dxf_read_int (fp, &sun->shadows);
+                                break;
+                        case 292:
+                                /* Now follows a string containing the daylight
+                                 * savings time value. */
+                                dxf_read_int (fp, &sun->daylight_savings_time);
+                                break;
+                        case 310:
+                                /* Now follows a string containing binary
+                                 * graphics data. */
+                                dxf_read_string (fp, &iter310->data_line);
+                                dxf_binary_graphics_data_init ((DxfBinaryGraphicsData *) iter310->next);
+                                iter310 = (DxfBinaryGraphicsData *) iter310->next;
+                                break;
+                        case 330:
+                                if (iter330 == 0)
+                                {
+                                        /* Now follows a string containing a soft-pointer
+                                         * ID/handle to owner dictionary. */
+                                        dxf_read_handle (fp, &sun->dictionary_owner_soft);
+                                }
+                                if (iter330 == 1)
+                                {
+                                        /* Now follows a string containing a soft-pointer
+                                         * ID/handle to owner object. */
+                                        dxf_read_handle (fp, &sun->object_owner_soft);
+                                }
+                                iter330++;
+                                break;
+                        case 347:
+                                /* Now follows a string containing a
+                                 * hard-pointer ID/handle to material object. */
+                                dxf_read_handle (fp, &sun->material);
+                                break;
+                        case 360:
+                                /* Now follows a string containing Hard owner
+                                 * ID/handle to owner dictionary. */
+                                dxf_read_handle (fp, &sun->dictionary_owner_hard);
+                                break;
+                        case 370:
+                                /* Now follows a string containing the lineweight
+                                 * value. */
+                                dxf_read_int16 (fp, &sun->lineweight);
+                                break;
+                        case 390:
+                                /* Now follows a string containing a plot style
+                                 * name value. */
+                                dxf_read_handle (fp, &sun->plot_style_name);
+                                break;
+                        case 420:
+                                /* Now follows a string containing a color value. */
+                                dxf_read_long (fp, &sun->color_value);
+                                break;
+                        case 430:
+                                /* Now follows a string containing a color
+                                 * name value. */
+                                dxf_read_string_interned (fp, &sun->color_name);
+                                break;
+                        case 440:
+                                /* Now follows a string containing a transparency
+                                 * value. */
+                                dxf_read_long (fp, &sun->transparency);
+                                break;
+                        case 999:
+                                /* Now follows a string containing a comment. */
+                                dxf_read_line (temp_string, fp);
+                                fprintf (stdout, "DXF comment: %s\n", temp_string);
+                                break;
+                        default:
                                 fprintf (stderr,
-                                  (_("Warning in %s () found a bad subclass marker in: %s in line: %d.\n")),
+                                  (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
                                   __FUNCTION__, fp->filename, fp->line_number);
-                        }
-                }
-                else if (strcmp (temp_string, "160") == 0)
-                {
-                        /* Now follows a string containing the
-                         * graphics data size value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%d\n", &sun->graphics_data_size);
-                }
-                else if (strcmp (temp_string, "280") == 0)
-                {
-                        /* Now follows a string containing the shadow
-                         * softness value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%hd\n", &sun->shadow_softness);
-                }
-                else if (strcmp (temp_string, "284") == 0)
-                {
-                        /* Now follows a string containing the shadow
-                         * mode value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%hd\n", &sun->shadow_mode);
-                }
-                else if (strcmp (temp_string, "290") == 0)
-                {
-                        /* Now follows a string containing the status
-                         * value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%d\n", &sun->status);
-                }
-                else if (strcmp (temp_string, "291") == 0)
-                {
-                        /* Now follows a string containing the shadows
-                         * value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%d\n", &sun->shadows);
-                }
-                else if (strcmp (temp_string, "292") == 0)
-                {
-                        /* Now follows a string containing the daylight
-                         * savings time value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%d\n", &sun->daylight_savings_time);
-                }
-                else if (strcmp (temp_string, "310") == 0)
-                {
-                        /* Now follows a string containing binary
-                         * graphics data. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, iter310->data_line);
-                        dxf_binary_graphics_data_init ((DxfBinaryGraphicsData *) iter310->next);
-                        iter310 = (DxfBinaryGraphicsData *) iter310->next;
-                }
-                else if (strcmp (temp_string, "330") == 0)
-                {
-                        if (iter330 == 0)
-                        {
-                                /* Now follows a string containing a soft-pointer
-                                 * ID/handle to owner dictionary. */
-                                (fp->line_number)++;
-                                fscanf (fp->fp, DXF_MAX_STRING_FORMAT, sun->dictionary_owner_soft);
-                        }
-                        if (iter330 == 1)
-                        {
-                                /* Now follows a string containing a soft-pointer
-                                 * ID/handle to owner object. */
-                                (fp->line_number)++;
-                                fscanf (fp->fp, DXF_MAX_STRING_FORMAT, sun->object_owner_soft);
-                        }
-                        iter330++;
-                }
-                else if (strcmp (temp_string, "347") == 0)
-                {
-                        /* Now follows a string containing a
-                         * hard-pointer ID/handle to material object. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, sun->material);
-                }
-                else if (strcmp (temp_string, "360") == 0)
-                {
-                        /* Now follows a string containing Hard owner
-                         * ID/handle to owner dictionary. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, sun->dictionary_owner_hard);
-                }
-                else if (strcmp (temp_string, "370") == 0)
-                {
-                        /* Now follows a string containing the lineweight
-                         * value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%hd\n", &sun->lineweight);
-                }
-                else if (strcmp (temp_string, "390") == 0)
-                {
-                        /* Now follows a string containing a plot style
-                         * name value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, sun->plot_style_name);
-                }
-                else if (strcmp (temp_string, "420") == 0)
-                {
-                        /* Now follows a string containing a color value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%ld\n", &sun->color_value);
-                }
-                else if (strcmp (temp_string, "430") == 0)
-                {
-                        /* Now follows a string containing a color
-                         * name value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, sun->color_name);
-                }
-                else if (strcmp (temp_string, "440") == 0)
-                {
-                        /* Now follows a string containing a transparency
-                         * value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%ld\n", &sun->transparency);
-                }
-                else if (strcmp (temp_string, "999") == 0)
-                {
-                        /* Now follows a string containing a comment. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
-                        fprintf (stdout, "DXF comment: %s\n", temp_string);
-                }
-                else
-                {
-                        fprintf (stderr,
-                          (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
-                          __FUNCTION__, fp->filename, fp->line_number);
+                                /* Skip the value of the unknown group code. */
+                                dxf_read_line (temp_string, fp);
+                                break;
                 }
         }
         /* Handle omitted members and/or illegal values. */
         if (strcmp (sun->linetype, "") == 0)
         {
-                sun->linetype = strdup (DXF_DEFAULT_LINETYPE);
+                sun->linetype = dxf_strdup (DXF_DEFAULT_LINETYPE);
         }
         if (strcmp (sun->layer, "") == 0)
         {
-                sun->layer = strdup (DXF_DEFAULT_LAYER);
+                sun->layer = dxf_strdup (DXF_DEFAULT_LAYER);
         }
-        /* Clean up. */
-        free (temp_string);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -522,7 +472,7 @@ dxf_sun_write
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        char *dxf_entity_name = strdup ("SUN");
+        char *dxf_entity_name = dxf_strdup ("SUN");
 
         /* Do some basic checks. */
         if (fp == NULL)
@@ -531,7 +481,7 @@ dxf_sun_write
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (sun == NULL)
@@ -540,34 +490,34 @@ dxf_sun_write
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (strcmp (sun->linetype, "") == 0)
         {
                 fprintf (stderr,
-                  (_("Warning in %s () empty linetype string for the %s entity with id-code: %x\n")),
-                  __FUNCTION__, dxf_entity_name, (uint) sun->id_code);
+                  (_("Warning in %s () empty linetype string for the %s entity with id-code: %" PRIx64 "\n")),
+                  __FUNCTION__, dxf_entity_name, sun->id_code);
                 fprintf (stderr,
                   (_("\t%s entity is reset to default linetype")),
                   dxf_entity_name);
-                sun->linetype = strdup (DXF_DEFAULT_LINETYPE);
+                sun->linetype = dxf_strdup (DXF_DEFAULT_LINETYPE);
         }
         if (strcmp (sun->layer, "") == 0)
         {
                 fprintf (stderr,
-                  (_("Warning in %s () empty layer string for the %s entity with id-code: %x\n")),
-                  __FUNCTION__, dxf_entity_name, (uint) sun->id_code);
+                  (_("Warning in %s () empty layer string for the %s entity with id-code: %" PRIx64 "\n")),
+                  __FUNCTION__, dxf_entity_name, sun->id_code);
                 fprintf (stderr,
                   (_("\t%s entity is relocated to layer 0")),
                   dxf_entity_name);
                 sun->layer = DXF_DEFAULT_LAYER;
         }
         /* Start writing output. */
-        fprintf (fp->fp, "  0\n%s\n", dxf_entity_name);
-        if (sun->id_code != -1)
+        dxf_write_string (fp, 0, dxf_entity_name);
+        if (sun->id_code != DXF_HANDLE_NONE)
         {
-                fprintf (fp->fp, "  5\n%x\n", (uint) sun->id_code);
+                dxf_write_hex (fp, 5, sun->id_code);
         }
         /*!
          * \todo for version R14.\n
@@ -579,71 +529,71 @@ dxf_sun_write
          * 102 groups are application defined (optional).\n\n
          * End of group, "}" (optional), with Group code 102.
          */
-        if ((strcmp (sun->dictionary_owner_soft, "") != 0)
+        if ((sun->dictionary_owner_soft != 0)
           && (fp->acad_version_number >= AutoCAD_14))
         {
-                fprintf (fp->fp, "102\n{ACAD_REACTORS\n");
-                fprintf (fp->fp, "330\n%s\n", sun->dictionary_owner_soft);
-                fprintf (fp->fp, "102\n}\n");
+                dxf_write_string (fp, 102, "{ACAD_REACTORS");
+                dxf_write_hex (fp, 330, sun->dictionary_owner_soft);
+                dxf_write_string (fp, 102, "}");
         }
-        if ((strcmp (sun->dictionary_owner_hard, "") != 0)
+        if ((sun->dictionary_owner_hard != 0)
           && (fp->acad_version_number >= AutoCAD_14))
         {
-                fprintf (fp->fp, "102\n{ACAD_XDICTIONARY\n");
-                fprintf (fp->fp, "360\n%s\n", sun->dictionary_owner_hard);
-                fprintf (fp->fp, "102\n}\n");
+                dxf_write_string (fp, 102, "{ACAD_XDICTIONARY");
+                dxf_write_hex (fp, 360, sun->dictionary_owner_hard);
+                dxf_write_string (fp, 102, "}");
         }
-        if ((strcmp (sun->object_owner_soft, "") != 0)
+        if ((sun->object_owner_soft != 0)
           && (fp->acad_version_number >= AutoCAD_2000))
         {
-                fprintf (fp->fp, "330\n%s\n", sun->object_owner_soft);
+                dxf_write_hex (fp, 330, sun->object_owner_soft);
         }
         if (fp->acad_version_number >= AutoCAD_13)
         {
-                fprintf (fp->fp, "100\nAcDbEntity\n");
+                dxf_write_string (fp, 100, "AcDbEntity");
         }
         if (sun->paperspace == DXF_PAPERSPACE)
         {
-                fprintf (fp->fp, " 67\n%d\n", (int16_t) DXF_PAPERSPACE);
+                dxf_write_int (fp, 67, (int16_t) DXF_PAPERSPACE);
         }
-        fprintf (fp->fp, "  8\n%s\n", sun->layer);
+        dxf_write_string (fp, 8, sun->layer);
         if (strcmp (sun->linetype, DXF_DEFAULT_LINETYPE) != 0)
         {
-                fprintf (fp->fp, "  6\n%s\n", sun->linetype);
+                dxf_write_string (fp, 6, sun->linetype);
         }
         if ((fp->acad_version_number >= AutoCAD_2008)
-          && (strcmp (sun->material, "") != 0))
+          && (sun->material != 0))
         {
-                fprintf (fp->fp, "347\n%s\n", sun->material);
+                dxf_write_hex (fp, 347, sun->material);
         }
         if ((fp->acad_version_number <= AutoCAD_11)
           && DXF_FLATLAND
           && (sun->elevation != 0.0))
         {
-                fprintf (fp->fp, " 38\n%f\n", sun->elevation);
+                dxf_write_double (fp, 38, sun->elevation);
         }
         if (sun->color != DXF_COLOR_BYLAYER)
         {
-                fprintf (fp->fp, " 62\n%d\n", sun->color);
+                dxf_write_int (fp, 62, sun->color);
         }
         if (fp->acad_version_number >= AutoCAD_2002)
         {
-                fprintf (fp->fp, "370\n%d\n", sun->lineweight);
+                dxf_write_int (fp, 370, sun->lineweight);
         }
         if (sun->linetype_scale != 1.0)
         {
-                fprintf (fp->fp, " 48\n%f\n", sun->linetype_scale);
+                dxf_write_double (fp, 48, sun->linetype_scale);
         }
         if (sun->visibility != 0)
         {
-                fprintf (fp->fp, " 60\n%d\n", sun->visibility);
+                dxf_write_int (fp, 60, sun->visibility);
         }
         if (fp->acad_version_number >= AutoCAD_2000)
         {
 #ifdef BUILD_64
-                fprintf (fp->fp, "160\n%d\n", sun->graphics_data_size);
+                dxf_write_int (fp, 160, sun->graphics_data_size);
 #else
-                fprintf (fp->fp, " 92\n%d\n", sun->graphics_data_size);
+                dxf_write_int (fp, 92, sun->graphics_data_size);
 #endif
                 if (sun->binary_graphics_data != NULL)
                 {
@@ -651,43 +601,43 @@ dxf_sun_write
                         iter = (DxfBinaryGraphicsData *) sun->binary_graphics_data;
                         while (iter != NULL)
                         {
-                                fprintf (fp->fp, "310\n%s\n", iter->data_line);
+                                dxf_write_string (fp, 310, iter->data_line);
                                 iter = (DxfBinaryGraphicsData *) iter->next;
                         }
                 }
         }
         if (fp->acad_version_number >= AutoCAD_2004)
         {
-                fprintf (fp->fp, "420\n%ld\n", sun->color_value);
-                fprintf (fp->fp, "430\n%s\n", sun->color_name);
-                fprintf (fp->fp, "440\n%ld\n", sun->transparency);
+                dxf_write_int (fp, 420, sun->color_value);
+                dxf_write_string (fp, 430, sun->color_name);
+                dxf_write_int (fp, 440, sun->transparency);
         }
         if (fp->acad_version_number >= AutoCAD_2009)
         {
-                fprintf (fp->fp, "390\n%s\n", sun->plot_style_name);
-                fprintf (fp->fp, "284\n%d\n", sun->shadow_mode);
+                dxf_write_hex (fp, 390, sun->plot_style_name);
+                dxf_write_int (fp, 284, sun->shadow_mode);
         }
         if (fp->acad_version_number >= AutoCAD_13)
         {
-                fprintf (fp->fp, "100\nAcDbSun\n");
+                dxf_write_string (fp, 100, "AcDbSun");
         }
         if (sun->thickness != 0.0)
         {
-                fprintf (fp->fp, " 39\n%f\n", sun->thickness);
-        }
-        fprintf (fp->fp, " 90\n%" PRIi32 "\n", sun->version);
-        fprintf (fp->fp, "290\n%d\n", sun->status);
-        fprintf (fp->fp, " 63\n%d\n", sun->sun_color);
-        fprintf (fp->fp, " 40\n%f\n", sun->intensity);
-        fprintf (fp->fp, "291\n%d\n", sun->shadows);
-        fprintf (fp->fp, " 91\n%" PRIi32 "\n", sun->julian_day);
-        fprintf (fp->fp, " 92\n%" PRIi32 "\n", sun->time);
-        fprintf (fp->fp, "292\n%d\n", sun->daylight_savings_time);
-        fprintf (fp->fp, " 70\n%d\n", sun->shadow_type);
-        fprintf (fp->fp, " 71\n%d\n", sun->shadow_map_size);
-        fprintf (fp->fp, "280\n%" PRIi16 "\n", sun->shadow_softness);
+                dxf_write_double (fp, 39, sun->thickness);
+        }
+        dxf_write_int (fp, 90, sun->version);
+        dxf_write_int (fp, 290, sun->status);
+        dxf_write_int (fp, 63, sun->sun_color);
+        dxf_write_double (fp, 40, sun->intensity);
+        dxf_write_int (fp, 291, sun->shadows);
+        dxf_write_int (fp, 91, sun->julian_day);
+        dxf_write_int (fp, 92, sun->time);
+        dxf_write_int (fp, 292, sun->daylight_savings_time);
+        dxf_write_int (fp, 70, sun->shadow_type);
+        dxf_write_int (fp, 71, sun->shadow_map_size);
+        dxf_write_int (fp, 280, sun->shadow_softness);
         /* Clean up. */
-        free (dxf_entity_name);
+        dxf_free (dxf_entity_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -728,15 +678,10 @@ dxf_sun_free
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        free (sun->linetype);
-        free (sun->layer);
-        free (sun->dictionary_owner_soft);
-        free (sun->object_owner_soft);
-        free (sun->material);
-        free (sun->dictionary_owner_hard);
-        free (sun->plot_style_name);
-        free (sun->color_name);
-        free (sun);
+        dxf_string_free (sun->linetype);
+        dxf_string_free (sun->layer);
+        dxf_string_free (sun->color_name);
+        dxf_free (sun);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -782,7 +727,7 @@ dxf_sun_free_list
  *
  * \return \c id_code.
  */
-int
+uint64_t
 dxf_sun_get_id_code
 (
         DxfSun *sun
@@ -800,12 +745,6 @@ dxf_sun_get_id_code
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (sun->id_code < 0)
-        {
-                fprintf (stderr,
-                  (_("Warning in %s () a negative value was found.\n")),
-                  __FUNCTION__);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -824,7 +763,7 @@ dxf_sun_set_id_code
 (
         DxfSun *sun,
                 /*!< a pointer to a DXF \c SUN entity. */
-        int id_code
+        uint64_t id_code
                 /*!< the \c id_code to be set for the entity.\n
                  * This is to be an unique (sequential) number in the
                  * DXF file. */
@@ -841,12 +780,6 @@ dxf_sun_set_id_code
                   __FUNCTION__);
                 return (NULL);
         }
-        if (id_code < 0)
-        {
-                fprintf (stderr,
-                  (_("Warning in %s () a negative value was passed.\n")),
-                  __FUNCTION__);
-        }
         sun->id_code = id_code;
 #if DEBUG
         DXF_DEBUG_END
@@ -888,7 +821,7 @@ dxf_sun_get_linetype
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (sun->linetype));
+        return (dxf_strdup (sun->linetype));
 }
 
 
@@ -926,7 +859,7 @@ dxf_sun_set_linetype
                   __FUNCTION__);
                 return (NULL);
         }
-        sun->linetype = strdup (linetype);
+        sun->linetype = dxf_strdup (linetype);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -967,7 +900,7 @@ dxf_sun_get_layer
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (sun->layer));
+        return (dxf_strdup (sun->layer));
 }
 
 
@@ -1005,7 +938,7 @@ dxf_sun_set_layer
                   __FUNCTION__);
                 return (NULL);
         }
-        sun->layer = strdup (layer);
+        sun->layer = dxf_strdup (layer);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1749,11 +1682,9 @@ dxf_sun_set_binary_graphics_data
  * \brief Get the pointer to the \c dictionary_owner_soft from a DXF 
  * \c SUN entity.
  *
- * \return pointer to the \c dictionary_owner_soft.
- *
- * \warning No checks are performed on the returned pointer (string).
+ * \return the handle of the \c dictionary_owner_soft.
  */
-char *
+uint64_t
 dxf_sun_get_dictionary_owner_soft
 (
         DxfSun *sun
@@ -1769,19 +1700,12 @@ dxf_sun_get_dictionary_owner_soft
                 fprintf (stderr,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
-                return (NULL);
-        }
-        if (sun->dictionary_owner_soft ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
+                return (0);
         }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (sun->dictionary_owner_soft));
+        return (sun->dictionary_owner_soft);
 }
 
 
@@ -1797,8 +1721,8 @@ dxf_sun_set_dictionary_owner_soft
 (
         DxfSun *sun,
                 /*!< a pointer to a DXF \c SUN entity. */
-        char *dictionary_owner_soft
-                /*!< a string containing the pointer to the \c
+        uint64_t dictionary_owner_soft
+                /*!< the handle of the \c
                  * dictionary_owner_soft for the entity. */
 )
 {
@@ -1813,14 +1737,7 @@ dxf_sun_set_dictionary_owner_soft
                   __FUNCTION__);
                 return (NULL);
         }
-        if (dictionary_owner_soft == NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was passed.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
-        sun->dictionary_owner_soft = strdup (dictionary_owner_soft);
+        sun->dictionary_owner_soft = dictionary_owner_soft;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1833,10 +1750,8 @@ dxf_sun_set_dictionary_owner_soft
  * \c SUN entity.
  *
  * \return soft pointer to the object owner.
- *
- * \warning No checks are performed on the returned pointer (string).
  */
-char *
+uint64_t
 dxf_sun_get_object_owner_soft
 (
         DxfSun *sun
@@ -1852,19 +1767,12 @@ dxf_sun_get_object_owner_soft
                 fprintf (stderr,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
-                return (NULL);
-        }
-        if (sun->object_owner_soft ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
+                return (0);
         }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (sun->object_owner_soft));
+        return (sun->object_owner_soft);
 }
 
 
@@ -1877,8 +1785,8 @@ dxf_sun_set_object_owner_soft
 (
         DxfSun *sun,
                 /*!< a pointer to a DXF \c SUN entity. */
-        char *object_owner_soft
-                /*!< a string containing the pointer to the
+        uint64_t object_owner_soft
+                /*!< the handle of the
                  * \c object_owner_soft for the entity. */
 )
 {
@@ -1893,14 +1801,7 @@ dxf_sun_set_object_owner_soft
                   __FUNCTION__);
                 return (NULL);
         }
-        if (object_owner_soft == NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was passed.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
-        sun->object_owner_soft = strdup (object_owner_soft);
+        sun->object_owner_soft = object_owner_soft;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1911,12 +1812,10 @@ dxf_sun_set_object_owner_soft
 /*!
  * \brief Get the pointer to the \c material from a DXF \c SUN entity.
  *
- * \return a pointer to \c material when successful, or \c NULL when an
+ * \return the handle \c material when successful, or 0 when an
  * error occurred.
- *
- * \warning No checks are performed on the returned pointer.
  */
-char *
+uint64_t
 dxf_sun_get_material
 (
         DxfSun *sun
@@ -1932,19 +1831,12 @@ dxf_sun_get_material
                 fprintf (stderr,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
-                return (NULL);
-        }
-        if (sun->material ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
+                return (0);
         }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (sun->material));
+        return (sun->material);
 }
 
 
@@ -1959,8 +1851,8 @@ dxf_sun_set_material
 (
         DxfSun *sun,
                 /*!< a pointer to a DXF \c SUN entity. */
-        char *material
-                /*!< a string containing the pointer to the \c
+        uint64_t material
+                /*!< the handle of the \c
                  * material for the entity. */
 )
 {
@@ -1975,14 +1867,7 @@ dxf_sun_set_material
                   __FUNCTION__);
                 return (NULL);
         }
-        if (material == NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was passed.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
-        sun->material = strdup (material);
+        sun->material = material;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1994,11 +1879,9 @@ dxf_sun_set_material
  * \brief Get the pointer to the \c dictionary_owner_hard from a DXF 
  * \c SUN entity.
  *
- * \return pointer to the \c dictionary_owner_hard.
- *
- * \warning No checks are performed on the returned pointer (string).
+ * \return the handle of the \c dictionary_owner_hard.
  */
-char *
+uint64_t
 dxf_sun_get_dictionary_owner_hard
 (
         DxfSun *sun
@@ -2014,19 +1897,12 @@ dxf_sun_get_dictionary_owner_hard
                 fprintf (stderr,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
-                return (NULL);
-        }
-        if (sun->dictionary_owner_hard ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
+                return (0);
         }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (sun->dictionary_owner_hard));
+        return (sun->dictionary_owner_hard);
 }
 
 
@@ -2042,8 +1918,8 @@ dxf_sun_set_dictionary_owner_hard
 (
         DxfSun *sun,
                 /*!< a pointer to a DXF \c SUN entity. */
-        char *dictionary_owner_hard
-                /*!< a string containing the pointer to the \c
+        uint64_t dictionary_owner_hard
+                /*!< the handle of the \c
                  * dictionary_owner_hard for the entity. */
 )
 {
@@ -2058,14 +1934,7 @@ dxf_sun_set_dictionary_owner_hard
                   __FUNCTION__);
                 return (NULL);
         }
-        if (dictionary_owner_hard == NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was passed.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
-        sun->dictionary_owner_hard = strdup (dictionary_owner_hard);
+        sun->dictionary_owner_hard = dictionary_owner_hard;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2141,10 +2010,10 @@ dxf_sun_set_lineweight
 /*!
  * \brief Get the \c plot_style_name from a DXF \c SUN entity.
  *
- * \return a pointer to \c plot_style_name when successful, or \c NULL
+ * \return the handle \c plot_style_name when successful, or 0
  * when an error occurred.
  */
-char *
+uint64_t
 dxf_sun_get_plot_style_name
 (
         DxfSun *sun
@@ -2160,19 +2029,12 @@ dxf_sun_get_plot_style_name
                 fprintf (stderr,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
-                return (NULL);
-        }
-        if (sun->plot_style_name ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
+                return (0);
         }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (sun->plot_style_name));
+        return (sun->plot_style_name);
 }
 
 
@@ -2187,7 +2049,7 @@ dxf_sun_set_plot_style_name
 (
         DxfSun *sun,
                 /*!< a pointer to a DXF \c SUN entity. */
-        char *plot_style_name
+        uint64_t plot_style_name
                 /*!< a string containing the \c plot_style_name for the
                  * entity. */
 )
@@ -2203,14 +2065,7 @@ dxf_sun_set_plot_style_name
                   __FUNCTION__);
                 return (NULL);
         }
-        if (plot_style_name == NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was passed.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
-        sun->plot_style_name = strdup (plot_style_name);
+        sun->plot_style_name = plot_style_name;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2317,7 +2172,7 @@ dxf_sun_get_color_name
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (sun->color_name));
+        return (dxf_strdup (sun->color_name));
 }
 
 
@@ -2355,7 +2210,7 @@ dxf_sun_set_color_name
                   __FUNCTION__);
                 return (NULL);
         }
-        sun->color_name = strdup (color_name);
+        sun->color_name = dxf_strdup (color_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -61,7 +61,7 @@ typedef struct
 dxf_sun_struct
 {
         /* Members common for all DXF drawable entities. */
-        int id_code;
+        uint64_t id_code;
                 /*!< Identification number for the entity.\n
                  * This is to be an unique (sequential) number in the DXF
                  * file.\n
@@ -134,20 +134,20 @@ dxf_sun_struct
                  * (optional).\n
                  * Group code = 310.\n
                  * \since Introduced in version R2000. */
-        char *dictionary_owner_soft;
+        uint64_t dictionary_owner_soft;
                 /*!< Soft-pointer ID/handle to owner dictionary (optional).\n
                  * Group code = 330.\n
                  * \since Introduced in version R14. */
-        char *object_owner_soft;
+        uint64_t object_owner_soft;
                 /*!< Soft-pointer ID/handle  to owner BLOCK_RECORD object.\n
                  * Group code = 330.\n
                  * \since Introduced in version R2000. */
-        char *material;
+        uint64_t material;
                 /*!< Hard-pointer ID/handle to material object (present if
                  * not BYLAYER).\n
                  * Group code = 347.\n
                  * \since Introduced in version R2008. */
-        char *dictionary_owner_hard;
+        uint64_t dictionary_owner_hard;
                 /*!< Hard owner ID/handle to owner dictionary (optional).\n
                  * Group code = 360.\n
                  * \since Introduced in version R14. */
@@ -156,7 +156,7 @@ dxf_sun_struct
                  * Stored and moved around as a 16-bit integer.\n
                  * Group code = 370.\n
                  * \since Introduced in version R2002. */
-        char *plot_style_name;
+        uint64_t plot_style_name;
                 /*!< Hard pointer ID / handle of PlotStyleName object.\n
                  * Group code = 390.\n
                  * \since Introduced in version R2009. */
@@ -244,8 +244,8 @@ DxfSun *dxf_sun_read (DxfFile *fp, DxfSun *sun);
 int dxf_sun_write (DxfFile *fp, DxfSun *sun);
 int dxf_sun_free (DxfSun *sun);
 void dxf_sun_free_list (DxfSun *suns);
-int dxf_sun_get_id_code (DxfSun *sun);
-DxfSun *dxf_sun_set_id_code (DxfSun *sun, int id_code);
+uint64_t dxf_sun_get_id_code (DxfSun *sun);
+DxfSun *dxf_sun_set_id_code (DxfSun *sun, uint64_t id_code);
 char *dxf_sun_get_linetype (DxfSun *sun);
 DxfSun *dxf_sun_set_linetype (DxfSun *sun, char *linetype);
 char *dxf_sun_get_layer (DxfSun *sun);
@@ -268,18 +268,18 @@ int16_t dxf_sun_get_shadow_mode (DxfSun *sun);
 DxfSun *dxf_sun_set_shadow_mode (DxfSun *sun, int16_t shadow_mode);
 DxfBinaryGraphicsData *dxf_sun_get_binary_graphics_data (DxfSun *sun);
 DxfSun *dxf_sun_set_binary_graphics_data (DxfSun *sun, DxfBinaryGraphicsData *data);
-char *dxf_sun_get_dictionary_owner_soft (DxfSun *sun);
-DxfSun *dxf_sun_set_dictionary_owner_soft (DxfSun *sun, char *dictionary_owner_soft);
-char *dxf_sun_get_object_owner_soft (DxfSun *sun);
-DxfSun *dxf_sun_set_object_owner_soft (DxfSun *sun, char *object_owner_soft);
-char *dxf_sun_get_material (DxfSun *sun);
-DxfSun *dxf_sun_set_material (DxfSun *sun, char *material);
-char *dxf_sun_get_dictionary_owner_hard (DxfSun *sun);
-DxfSun *dxf_sun_set_dictionary_owner_hard (DxfSun *sun, char *dictionary_owner_hard);
+uint64_t dxf_sun_get_dictionary_owner_soft (DxfSun *sun);
+DxfSun *dxf_sun_set_dictionary_owner_soft (DxfSun *sun, uint64_t dictionary_owner_soft);
+uint64_t dxf_sun_get_object_owner_soft (DxfSun *sun);
+DxfSun *dxf_sun_set_object_owner_soft (DxfSun *sun, uint64_t object_owner_soft);
+uint64_t dxf_sun_get_material (DxfSun *sun);
+DxfSun *dxf_sun_set_material (DxfSun *sun, uint64_t material);
+uint64_t dxf_sun_get_dictionary_owner_hard (DxfSun *sun);
+DxfSun *dxf_sun_set_dictionary_owner_hard (DxfSun *sun, uint64_t dictionary_owner_hard);
 int16_t dxf_sun_get_lineweight (DxfSun *sun);
 DxfSun *dxf_sun_set_lineweight (DxfSun *sun, int16_t lineweight);
-char *dxf_sun_get_plot_style_name (DxfSun *sun);
-DxfSun *dxf_sun_set_plot_style_name (DxfSun *sun, char *plot_style_name);
+uint64_t dxf_sun_get_plot_style_name (DxfSun *sun);
+DxfSun *dxf_sun_set_plot_style_name (DxfSun *sun, uint64_t plot_style_name);
 long dxf_sun_get_color_value (DxfSun *sun);
 DxfSun *dxf_sun_set_color_value (DxfSun *sun, long color_value);
 char *dxf_sun_get_color_name (DxfSun *sun);
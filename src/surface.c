@@ -63,7 +63,7 @@ dxf_surface_new ()
         size = sizeof (DxfSurface);
         /* avoid malloc of 0 bytes */
         if (size == 0) size = 1;
-        if ((surface = malloc (size)) == NULL)
+        if ((surface = dxf_malloc (size)) == NULL)
         {
                 fprintf (stderr,
                   (_("Error in %s () could not allocate memory.\n")),
@@ -139,9 +139,9 @@ dxf_surface_init
                 return (NULL);
         }
         /* Assign initial values to members. */
-        surface->id_code = 0;
-        surface->linetype = strdup (DXF_DEFAULT_LINETYPE);
-        surface->layer = strdup (DXF_DEFAULT_LAYER);
+        surface->id_code = DXF_HANDLE_NONE;
+        surface->linetype = dxf_strdup (DXF_DEFAULT_LINETYPE);
+        surface->layer = dxf_strdup (DXF_DEFAULT_LAYER);
         surface->elevation = 0.0;
         surface->thickness = 0.0;
         surface->linetype_scale = DXF_DEFAULT_LINETYPE_SCALE;
@@ -150,14 +150,14 @@ dxf_surface_init
         surface->paperspace = DXF_MODELSPACE;
         surface->graphics_data_size = 0;
         surface->shadow_mode = 0;
-        surface->dictionary_owner_soft = strdup ("");
-        surface->object_owner_soft = strdup ("");
-        surface->material = strdup ("");
-        surface->dictionary_owner_hard = strdup ("");
+        surface->dictionary_owner_soft = 0;
+        surface->object_owner_soft = 0;
+        surface->material = 0;
+        surface->dictionary_owner_hard = 0;
         surface->lineweight = 0;
-        surface->plot_style_name = strdup ("");
+        surface->plot_style_name = 0;
         surface->color_value = 0;
-        surface->color_name = strdup ("");
+        surface->color_name = dxf_strdup ("");
         surface->transparency = 0;
         surface->modeler_format_version_number = 1;
         surface->number_of_U_isolines = 0;
@@ -194,7 +194,8 @@ dxf_surface_read
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        char *temp_string = NULL;
+        char temp_string[DXF_MAX_STRING_LENGTH];
+        int group_code;
         DxfBinaryData *iter310 = NULL;
         int iter330;
         int i;
@@ -205,8 +206,6 @@ dxf_surface_read
                 fprintf (stderr,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
-                /* Clean up. */
-                free (temp_string);
                 return (NULL);
         }
         if (fp->acad_version_number < AutoCAD_2007)
@@ -225,306 +224,246 @@ dxf_surface_read
         iter310 = (DxfBinaryData *) surface->binary_graphics_data;
         iter330 = 0;
         i = 1;
-        (fp->line_number)++;
-        fscanf (fp->fp, "%[^\n]", temp_string);
-        while (strcmp (temp_string, "0") != 0)
+        while ((dxf_read_group_code (fp, &group_code) == EXIT_SUCCESS)
+          && (group_code != 0))
         {
-                if (ferror (fp->fp))
+                if (dxf_read_error (fp))
                 {
                         fprintf (stderr,
                           (_("Error in %s () while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
                         /* Clean up. */
-                        free (temp_string);
-                        fclose (fp->fp);
                         return (NULL);
                 }
-                else if (strcmp (temp_string, "  1") == 0)
-                {
-                        /* Now follows a string containing proprietary
-                         * data. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, surface->proprietary_data->line);
-                        surface->proprietary_data->order = i;
-                        i++;
-                        dxf_proprietary_data_init ((DxfProprietaryData *) surface->proprietary_data->next);
-                        surface->proprietary_data = (DxfProprietaryData *) surface->proprietary_data->next;
-                }
-                else if (strcmp (temp_string, "  3") == 0)
-                {
-                        /* Now follows a string containing additional
-                         * proprietary data. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, surface->additional_proprietary_data->line);
-                        surface->additional_proprietary_data->order = i;
-                        i++;
-                        dxf_proprietary_data_init ((DxfProprietaryData *) surface->additional_proprietary_data->next);
-                        surface->additional_proprietary_data = (DxfProprietaryData *) surface->additional_proprietary_data->next;
-                }
-                if (strcmp (temp_string, "5") == 0)
-                {
-                        /* Now follows a string containing a sequential
-                         * id number. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%x\n", (uint *) &surface->id_code);
-                }
-                else if (strcmp (temp_string, "6") == 0)
-                {
-                        /* Now follows a string containing a linetype
-                         * name. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, surface->linetype);
-                }
-                else if (strcmp (temp_string, "8") == 0)
-                {
-                        /* Now follows a string containing a layer name. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, surface->layer);
-                }
-                else if (strcmp (temp_string, "38") == 0)
-                {
-                        /* Now follows a string containing the
-                         * elevation. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &surface->elevation);
-                }
-                else if (strcmp (temp_string, "39") == 0)
-                {
-                        /* Now follows a string containing the
-                         * thickness. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &surface->thickness);
-                }
-                else if (strcmp (temp_string, "48") == 0)
-                {
-                        /* Now follows a string containing the linetype
-                         * scale. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &surface->linetype_scale);
-                }
-                else if (strcmp (temp_string, "60") == 0)
-                {
-                        /* Now follows a string containing the
-                         * visibility value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%hd\n", &surface->visibility);
-                }
-                else if (strcmp (temp_string, "62") == 0)
-                {
-                        /* Now follows a string containing the
-                         * color value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%hd\n", &surface->color);
-                }
-                else if (strcmp (temp_string, "67") == 0)
-                {
-                        /* Now follows a string containing the
-                         * paperspace value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%hd\n", &surface->paperspace);
-                }
-                else if (strcmp (temp_string, "70") == 0)
-                {
-                        /* Now follows a string containing the modeler
-                         * format version number. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%hd\n", &surface->modeler_format_version_number);
-                }
-                else if (strcmp (temp_string, "71") == 0)
-                {
-                        /* Now follows a string containing the modeler
-                         * format version number. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%hd\n", &surface->number_of_U_isolines);
-                }
-                else if (strcmp (temp_string, "72") == 0)
+                switch (group_code)
                 {
-                        /* Now follows a string containing the modeler
-                         * format version number. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%hd\n", &surface->number_of_V_isolines);
-                }
-                else if (strcmp (temp_string, "92") == 0)
-                {
-                        /* Now follows a string containing the
-                         * graphics data size value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%" PRIi32 "\n", &surface->graphics_data_size);
-                }
-                else if (strcmp (temp_string, "100") == 0)
-                {
-                        /* Now follows a string containing the
-                         * subclass marker value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
-                        if ((strcmp (temp_string, "AcDbModelerGeometry") == 0)
-                          || (strcmp (temp_string, "AcDbSurface") == 0))
-                        {
-                                /* Do nothing. */
-                        }
-                        else if ((strcmp (temp_string, "AcDbExtrudedSurface") == 0))
-                        {
-                                surface->type = EXTRUDED;
-                                if (surface->extruded_surface == NULL)
+                        case 1:
+                                /* Now follows a string containing proprietary
+                                 * data. */
+                                dxf_read_string (fp, &surface->proprietary_data->line);
+                                surface->proprietary_data->order = i;
+                                i++;
+                                dxf_proprietary_data_init ((DxfProprietaryData *) surface->proprietary_data->next);
+                                surface->proprietary_data = (DxfProprietaryData *) surface->proprietary_data->next;
+                                break;
+                        case 3:
+                                /* Now follows a string containing additional
+                                 * proprietary data. */
+                                dxf_read_string (fp, &surface->additional_proprietary_data->line);
+                                surface->additional_proprietary_data->order = i;
+                                i++;
+                                dxf_proprietary_data_init ((DxfProprietaryData *) surface->additional_proprietary_data->next);
+                                surface->additional_proprietary_data = (DxfProprietaryData *) surface->additional_proprietary_data->next;
+                                break;
+                        case 5:
+                                /* Now follows a string containing a sequential
+                                 * id number. */
+                                dxf_read_handle (fp, &surface->id_code);
+                                break;
+                        case 6:
+                                /* Now follows a string containing a linetype
+                                 * name. */
+                                dxf_read_string_interned (fp, &surface->linetype);
+                                break;
+                        case 8:
+                                /* Now follows a string containing a layer name. */
+                                dxf_read_string_interned (fp, &surface->layer);
+                                break;
+                        case 38:
+                                /* Now follows a string containing the
+                                 * elevation. */
+                                dxf_read_double (fp, &surface->elevation);
+                                break;
+                        case 39:
+                                /* Now follows a string containing the
+                                 * thickness. */
+                                dxf_read_double (fp, &surface->thickness);
+                                break;
+                        case 48:
+                                /* Now follows a string containing the linetype
+                                 * scale. */
+                                dxf_read_double (fp, &surface->linetype_scale);
+                                break;
+                        case 60:
+                                /* Now follows a string containing the
+                                 * visibility value. */
+                                dxf_read_int16 (fp, &surface->visibility);
+                                break;
+                        case 62:
+                                /* Now follows a string containing the
+                                 * color value. */
+                                dxf_read_int16 (fp, &surface->color);
+                                break;
+                        case 67:
+                                /* Now follows a string containing the
+                                 * paperspace value. */
+                                dxf_read_int16 (fp, &surface->paperspace);
+                                break;
+                        case 70:
+                                /* Now follows a string containing the modeler
+                                 * format version number. */
+                                dxf_read_int16 (fp, &surface->modeler_format_version_number);
+                                break;
+                        case 71:
+                                /* Now follows a string containing the modeler
+                                 * format version number. */
+                                dxf_read_int16 (fp, &surface->number_of_U_isolines);
+                                break;
+                        case 72:
+                                /* Now follows a string containing the modeler
+                                 * format version number. */
+                                dxf_read_int16 (fp, &surface->number_of_V_isolines);
+                                break;
+                        case 92:
+                                /* Now follows a string containing the
+                                 * graphics data size value. */
+                                dxf_read_int32 (fp, &surface->graphics_data_size);
+                                break;
+                        case 100:
+                                /* Now follows a string containing the
+                                 * subclass marker value. */
+                                dxf_read_line (temp_string, fp);
+                                if ((strcmp (temp_string, "AcDbModelerGeometry") == 0)
+                                  || (strcmp (temp_string, "AcDbSurface") == 0))
                                 {
-                                        surface->extruded_surface = (struct DxfSurfaceExtruded *) dxf_surface_extruded_new ();
+                                        /* Do nothing. */
                                 }
-//                                surface->extruded_surface = dxf_surface_extruded_read (fp, surface->extruded_surface);
-                                return (surface);
-                        }
-                        else if ((strcmp (temp_string, "AcDbLoftedSurface") == 0))
-                        {
-                                surface->type = LOFTED;
-                                if (surface->lofted_surface == NULL)
+                                else if ((strcmp (temp_string, "AcDbExtrudedSurface") == 0))
                                 {
-                                        surface->lofted_surface = (struct DxfSurfaceLofted *) dxf_surface_lofted_new ();
+                                        surface->type = EXTRUDED;
+                                        if (surface->extruded_surface == NULL)
+                                        {
+                                                surface->extruded_surface = (struct DxfSurfaceExtruded *) dxf_surface_extruded_new ();
+                                        }
+//                                surface->extruded_surface = dxf_surface_extruded_read (fp, surface->extruded_surface);
+                                        return (surface);
                                 }
-//                                surface->lofted_surface = dxf_surface_lofted_read (fp, surface->lofted_surface);
-                                return (surface);
-                        }
-                        else if ((strcmp (temp_string, "AcDbRevolvedSurface") == 0))
-                        {
-                                surface->type = REVOLVED;
-                                if (surface->revolved_surface == NULL)
+                                else if ((strcmp (temp_string, "AcDbLoftedSurface") == 0))
                                 {
-                                        surface->revolved_surface = (struct DxfSurfaceRevolved *) dxf_surface_revolved_new ();
+                                        surface->type = LOFTED;
+                                        if (surface->lofted_surface == NULL)
+                                        {
+                                                surface->lofted_surface = (struct DxfSurfaceLofted *) dxf_surface_lofted_new ();
+                                        }
+//                                surface->lofted_surface = dxf_surface_lofted_read (fp, surface->lofted_surface);
+                                        return (surface);
                                 }
-//                                surface->revolved_surface = dxf_surface_revolved_read (fp, surface->revolved_surface);
-                                return (surface);
-                        }
-                        else if ((strcmp (temp_string, "AcDbSweptSurface") == 0))
-                        {
-                                surface->type = SWEPT;
-                                if (surface->swept_surface == NULL)
+                                else if ((strcmp (temp_string, "AcDbRevolvedSurface") == 0))
                                 {
-                                        surface->swept_surface = (struct DxfSurfaceSwept *) dxf_surface_swept_new ();
+                                        surface->type = REVOLVED;
+                                        if (surface->revolved_surface == NULL)
+                                        {
+                                                surface->revolved_surface = (struct DxfSurfaceRevolved *) dxf_surface_revolved_new ();
+                                        }
+//                                surface->revolved_surface = dxf_surface_revolved_read (fp, surface->revolved_surface);
+                                        return (surface);
                                 }
+                                else if ((strcmp (temp_string, "AcDbSweptSurface") == 0))
+                                {
+                                        surface->type = SWEPT;
+                                        if (surface->swept_surface == NULL)
+                                        {
+                                                surface->swept_surface = (struct DxfSurfaceSwept *) dxf_surface_swept_new ();
+                                        }
 //                                surface->swept_surface = dxf_surface_swept_read (fp, surface->swept_surface);
-                                return (surface);
-                        }
-                        else
-                        {
-                                surface->type = NO_TYPE;
+                                        return (surface);
+                                }
+                                else
+                                {
+                                        surface->type = NO_TYPE;
+                                        fprintf (stderr,
+                                          (_("Warning in %s () found a bad subclass marker in: %s in line: %d.\n")),
+                                          __FUNCTION__, fp->filename, fp->line_number);
+                                        return (surface);
+                                }
+                                break;
+                        case 160:
+                                /* Now follows a string containing the
+                                 * graphics data size value. */
+                                dxf_read_int32 (fp, &surface->graphics_data_size);
+                                break;
+                        case 284:
+                                /* Now follows a string containing the shadow
+                                 * mode value. */
+                                dxf_read_int16 (fp, &surface->shadow_mode);
+                                break;
+                        case 310:
+                                /* Now follows a string containing binary
+                                 * graphics data. */
+                                iter310 = dxf_binary_data_read (fp, iter310);
+                                break;
+                        case 330:
+                                if (iter330 == 0)
+                                {
+                                        /* Now follows a string containing a soft-pointer
+                                         * ID/handle to owner dictionary. */
+                                        dxf_read_handle (fp, &surface->dictionary_owner_soft);
+                                }
+                                if (iter330 == 1)
+                                {
+                                        /* Now follows a string containing a soft-pointer
+                                         * ID/handle to owner object. */
+                                        dxf_read_handle (fp, &surface->object_owner_soft);
+                                }
+                                iter330++;
+                                break;
+                        case 347:
+                                /* Now follows a string containing a
+                                 * hard-pointer ID/handle to material object. */
+                                dxf_read_handle (fp, &surface->material);
+                                break;
+                        case 360:
+                                /* Now follows a string containing Hard owner
+                                 * ID/handle to owner dictionary. */
+                                dxf_read_handle (fp, &surface->dictionary_owner_hard);
+                                break;
+                        case 370:
+                                /* Now follows a string containing the lineweight
+                                 * value. */
+                                dxf_read_int16 (fp, &surface->lineweight);
+                                break;
+                        case 390:
+                                /* Now follows a string containing a plot style
+                                 * name value. */
+                                dxf_read_handle (fp, &surface->plot_style_name);
+                                break;
+                        case 420:
+                                /* Now follows a string containing a color value. */
+                                dxf_read_int32 (fp, &surface->color_value);
+                                break;
+                        case 430:
+                                /* Now follows a string containing a color
+                                 * name value. */
+                                dxf_read_string_interned (fp, &surface->color_name);
+                                break;
+                        case 440:
+                                /* Now follows a string containing a transparency
+                                 * value. */
+                                dxf_read_int32 (fp, &surface->transparency);
+                                break;
+                        case 999:
+                                /* Now follows a string containing a comment. */
+                                dxf_read_line (temp_string, fp);
+                                fprintf (stdout, (_("DXF comment: %s\n")), temp_string);
+                                break;
+                        default:
                                 fprintf (stderr,
-                                  (_("Warning in %s () found a bad subclass marker in: %s in line: %d.\n")),
+                                  (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
                                   __FUNCTION__, fp->filename, fp->line_number);
-                                return (surface);
-                        }
-                }
-                else if (strcmp (temp_string, "160") == 0)
-                {
-                        /* Now follows a string containing the
-                         * graphics data size value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%" PRIi32 "\n", &surface->graphics_data_size);
-                }
-                else if (strcmp (temp_string, "284") == 0)
-                {
-                        /* Now follows a string containing the shadow
-                         * mode value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%hd\n", &surface->shadow_mode);
-                }
-                else if (strcmp (temp_string, "310") == 0)
-                {
-                        /* Now follows a string containing binary
-                         * graphics data. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, iter310->data_line);
-                        dxf_binary_data_init ((DxfBinaryData *) iter310->next);
-                        iter310 = (DxfBinaryData *) iter310->next;
-                }
-                else if (strcmp (temp_string, "330") == 0)
-                {
-                        if (iter330 == 0)
-                        {
-                                /* Now follows a string containing a soft-pointer
-                                 * ID/handle to owner dictionary. */
-                                (fp->line_number)++;
-                                fscanf (fp->fp, DXF_MAX_STRING_FORMAT, surface->dictionary_owner_soft);
-                        }
-                        if (iter330 == 1)
-                        {
-                                /* Now follows a string containing a soft-pointer
-                                 * ID/handle to owner object. */
-                                (fp->line_number)++;
-                                fscanf (fp->fp, DXF_MAX_STRING_FORMAT, surface->object_owner_soft);
-                        }
-                        iter330++;
-                }
-                else if (strcmp (temp_string, "347") == 0)
-                {
-                        /* Now follows a string containing a
-                         * hard-pointer ID/handle to material object. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, surface->material);
-                }
-                else if (strcmp (temp_string, "360") == 0)
-                {
-                        /* Now follows a string containing Hard owner
-                         * ID/handle to owner dictionary. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, surface->dictionary_owner_hard);
-                }
-                else if (strcmp (temp_string, "370") == 0)
-                {
-                        /* Now follows a string containing the lineweight
-                         * value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%hd\n", &surface->lineweight);
-                }
-                else if (strcmp (temp_string, "390") == 0)
-                {
-                        /* Now follows a string containing a plot style
-                         * name value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, surface->plot_style_name);
-                }
-                else if (strcmp (temp_string, "420") == 0)
-                {
-                        /* Now follows a string containing a color value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%" PRIi32 "\n", &surface->color_value);
-                }
-                else if (strcmp (temp_string, "430") == 0)
-                {
-                        /* Now follows a string containing a color
-                         * name value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, surface->color_name);
-                }
-                else if (strcmp (temp_string, "440") == 0)
-                {
-                        /* Now follows a string containing a transparency
-                         * value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%" PRIi32 "\n", &surface->transparency);
-                }
-                else if (strcmp (temp_string, "999") == 0)
-                {
-                        /* Now follows a string containing a comment. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
-                        fprintf (stdout, (_("DXF comment: %s\n")), temp_string);
-                }
-                else
-                {
-                        fprintf (stderr,
-                          (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
-                          __FUNCTION__, fp->filename, fp->line_number);
+                                /* Skip the value of the unknown group code. */
+                                dxf_read_line (temp_string, fp);
+                                break;
                 }
         }
         /* Handle omitted members and/or illegal values. */
         if (strcmp (surface->linetype, "") == 0)
         {
-                surface->linetype = strdup (DXF_DEFAULT_LINETYPE);
+                surface->linetype = dxf_strdup (DXF_DEFAULT_LINETYPE);
         }
         if (strcmp (surface->layer, "") == 0)
         {
-                surface->layer = strdup (DXF_DEFAULT_LAYER);
+                surface->layer = dxf_strdup (DXF_DEFAULT_LAYER);
         }
-        /* Clean up. */
-        free (temp_string);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -547,7 +486,7 @@ dxf_surface_write
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        char *dxf_entity_name = strdup ("SURFACE");
+        char *dxf_entity_name = dxf_strdup ("SURFACE");
 
         /* Do some basic checks. */
         if (fp == NULL)
@@ -556,7 +495,7 @@ dxf_surface_write
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (surface == NULL)
@@ -565,24 +504,24 @@ dxf_surface_write
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (strcmp (surface->layer, "") == 0)
         {
                 fprintf (stderr,
-                  (_("Warning in %s () empty layer string for the %s entity with id-code: %x\n")),
+                  (_("Warning in %s () empty layer string for the %s entity with id-code: %" PRIx64 "\n")),
                   __FUNCTION__, dxf_entity_name, surface->id_code);
                 fprintf (stderr,
                   (_("\t%s entity is relocated to layer 0")),
                   dxf_entity_name);
-                surface->layer = strdup (DXF_DEFAULT_LAYER);
+                surface->layer = dxf_strdup (DXF_DEFAULT_LAYER);
         }
         /* Start writing output. */
-        fprintf (fp->fp, "  0\n%s\n", dxf_entity_name);
-        if (surface->id_code != -1)
+        dxf_write_string (fp, 0, dxf_entity_name);
+        if (surface->id_code != DXF_HANDLE_NONE)
         {
-                fprintf (fp->fp, "  5\n%x\n", surface->id_code);
+                dxf_write_hex (fp, 5, surface->id_code);
         }
         /*!
          * \todo for version R14.\n
@@ -594,67 +533,67 @@ dxf_surface_write
          * 102 groups are application defined (optional).\n\n
          * End of group, "}" (optional), with Group code 102.
          */
-        if ((strcmp (surface->dictionary_owner_soft, "") != 0)
+        if ((surface->dictionary_owner_soft != 0)
           && (fp->acad_version_number >= AutoCAD_14))
         {
-                fprintf (fp->fp, "102\n{ACAD_REACTORS\n");
-                fprintf (fp->fp, "330\n%s\n", surface->dictionary_owner_soft);
-                fprintf (fp->fp, "102\n}\n");
+                dxf_write_string (fp, 102, "{ACAD_REACTORS");
+                dxf_write_hex (fp, 330, surface->dictionary_owner_soft);
+                dxf_write_string (fp, 102, "}");
         }
-        if ((strcmp (surface->dictionary_owner_hard, "") != 0)
+        if ((surface->dictionary_owner_hard != 0)
           && (fp->acad_version_number >= AutoCAD_14))
         {
-                fprintf (fp->fp, "102\n{ACAD_XDICTIONARY\n");
-                fprintf (fp->fp, "360\n%s\n", surface->dictionary_owner_hard);
-                fprintf (fp->fp, "102\n}\n");
+                dxf_write_string (fp, 102, "{ACAD_XDICTIONARY");
+                dxf_write_hex (fp, 360, surface->dictionary_owner_hard);
+                dxf_write_string (fp, 102, "}");
         }
         if (fp->acad_version_number >= AutoCAD_13)
         {
-                fprintf (fp->fp, "100\nAcDbEntity\n");
+                dxf_write_string (fp, 100, "AcDbEntity");
         }
         if (surface->paperspace == 1)
         {
-                fprintf (fp->fp, " 67\n%d\n", (int16_t) DXF_PAPERSPACE);
+                dxf_write_int (fp, 67, (int16_t) DXF_PAPERSPACE);
         }
-        fprintf (fp->fp, "  8\n%s\n", surface->layer);
+        dxf_write_string (fp, 8, surface->layer);
         if (strcmp (surface->linetype, DXF_DEFAULT_LINETYPE) != 0)
         {
-                fprintf (fp->fp, "  6\n%s\n", surface->linetype);
+                dxf_write_string (fp, 6, surface->linetype);
         }
         if ((fp->acad_version_number >= AutoCAD_2008)
-          && (strcmp (surface->material, "") != 0))
+          && (surface->material != 0))
         {
-                fprintf (fp->fp, "347\n%s\n", surface->material);
+                dxf_write_hex (fp, 347, surface->material);
         }
         if (surface->color != DXF_COLOR_BYLAYER)
         {
-                fprintf (fp->fp, " 62\n%d\n", surface->color);
+                dxf_write_int (fp, 62, surface->color);
         }
         if (fp->acad_version_number >= AutoCAD_2002)
         {
-                fprintf (fp->fp, "370\n%d\n", surface->lineweight);
+                dxf_write_int (fp, 370, surface->lineweight);
         }
         if ((fp->acad_version_number <= AutoCAD_11)
           && DXF_FLATLAND
           && (surface->elevation != 0.0))
         {
-                fprintf (fp->fp, " 38\n%f\n", surface->elevation);
+                dxf_write_double (fp, 38, surface->elevation);
         }
         if (surface->linetype_scale != 1.0)
         {
-                fprintf (fp->fp, " 48\n%f\n", surface->linetype_scale);
+                dxf_write_double (fp, 48, surface->linetype_scale);
         }
         if (surface->visibility != 0)
         {
-                fprintf (fp->fp, " 60\n%d\n", surface->visibility);
+                dxf_write_int (fp, 60, surface->visibility);
         }
         if ((fp->acad_version_number >= AutoCAD_2000)
           && (surface->graphics_data_size > 0))
         {
 #ifdef BUILD_64
-                fprintf (fp->fp, "160\n%d\n", surface->graphics_data_size);
+                dxf_write_int (fp, 160, surface->graphics_data_size);
 #else
-                fprintf (fp->fp, " 92\n%d\n", surface->graphics_data_size);
+                dxf_write_int (fp, 92, surface->graphics_data_size);
 #endif
                 if (surface->binary_graphics_data != NULL)
                 {
@@ -662,33 +601,33 @@ dxf_surface_write
                         iter = surface->binary_graphics_data;
                         while (iter != NULL)
                         {
-                                fprintf (fp->fp, "310\n%s\n", dxf_binary_data_get_data_line (iter));
+                                dxf_binary_data_write (fp, iter);
                                 iter = (DxfBinaryData *) dxf_binary_data_get_next (iter);
                         }
                 }
         }
         if (fp->acad_version_number >= AutoCAD_2004)
         {
-                fprintf (fp->fp, "420\n%" PRIi32 "\n", surface->color_value);
-                fprintf (fp->fp, "430\n%s\n", surface->color_name);
-                fprintf (fp->fp, "440\n%" PRIi32 "\n", surface->transparency);
+                dxf_write_int (fp, 420, surface->color_value);
+                dxf_write_string (fp, 430, surface->color_name);
+                dxf_write_int (fp, 440, surface->transparency);
         }
         if (fp->acad_version_number >= AutoCAD_2009)
         {
-                fprintf (fp->fp, "390\n%s\n", surface->plot_style_name);
-                fprintf (fp->fp, "284\n%d\n", surface->shadow_mode);
+                dxf_write_hex (fp, 390, surface->plot_style_name);
+                dxf_write_int (fp, 284, surface->shadow_mode);
         }
         if (fp->acad_version_number >= AutoCAD_13)
         {
-                fprintf (fp->fp, "100\nAcDbModelerGeometry\n");
+                dxf_write_string (fp, 100, "AcDbModelerGeometry");
         }
         if (surface->thickness != 0.0)
         {
-                fprintf (fp->fp, " 39\n%f\n", surface->thickness);
+                dxf_write_double (fp, 39, surface->thickness);
         }
         if (surface->modeler_format_version_number != 0)
         {
-                fprintf (fp->fp, " 70\n%hd\n", surface->modeler_format_version_number);
+                dxf_write_int (fp, 70, surface->modeler_format_version_number);
         }
         if (surface->proprietary_data != NULL)
         {
@@ -696,7 +635,7 @@ dxf_surface_write
                 iter1a = (DxfProprietaryData *) surface->proprietary_data;
                 while (iter1a != NULL)
                 {
-                        fprintf (fp->fp, "  1\n%s\n", iter1a->line);
+                        dxf_write_string (fp, 1, iter1a->line);
                         iter1a = (DxfProprietaryData *) iter1a->next;
                 }
         }
@@ -706,18 +645,18 @@ dxf_surface_write
                 iter3a = (DxfProprietaryData *) surface->additional_proprietary_data;
                 while (iter3a != NULL)
                 {
-                        fprintf (fp->fp, "  3\n%s\n", iter3a->line);
+                        dxf_write_string (fp, 3, iter3a->line);
                         iter3a = (DxfProprietaryData *) iter3a->next;
                 }
         }
         if (fp->acad_version_number >= AutoCAD_13)
         {
-                fprintf (fp->fp, "100\nAcDbSurface\n");
+                dxf_write_string (fp, 100, "AcDbSurface");
         }
         if (fp->acad_version_number >= AutoCAD_13)
         {
-                fprintf (fp->fp, " 71\n%hd\n", surface->number_of_U_isolines);
-                fprintf (fp->fp, " 72\n%hd\n", surface->number_of_V_isolines);
+                dxf_write_int (fp, 71, surface->number_of_U_isolines);
+                dxf_write_int (fp, 72, surface->number_of_V_isolines);
         }
         if (surface->type == EXTRUDED)
         {
@@ -748,7 +687,7 @@ dxf_surface_write
                   __FUNCTION__);
         }
         /* Clean up. */
-        free (dxf_entity_name);
+        dxf_free (dxf_entity_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -789,17 +728,12 @@ dxf_surface_free
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        free (surface->linetype);
-        free (surface->layer);
-        free (surface->dictionary_owner_soft);
-        free (surface->object_owner_soft);
-        free (surface->material);
-        free (surface->dictionary_owner_hard);
-        free (surface->plot_style_name);
-        free (surface->color_name);
+        dxf_string_free (surface->linetype);
+        dxf_string_free (surface->layer);
+        dxf_string_free (surface->color_name);
         dxf_proprietary_data_free_list (surface->proprietary_data);
         dxf_proprietary_data_free_list (surface->additional_proprietary_data);
-        free (surface);
+        dxf_free (surface);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -845,7 +779,7 @@ dxf_surface_free_list
  *
  * \return \c id_code.
  */
-int
+uint64_t
 dxf_surface_get_id_code
 (
         DxfSurface *surface
@@ -863,12 +797,6 @@ dxf_surface_get_id_code
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (surface->id_code < 0)
-        {
-                fprintf (stderr,
-                  (_("Warning in %s () a negative value was found.\n")),
-                  __FUNCTION__);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -887,7 +815,7 @@ dxf_surface_set_id_code
 (
         DxfSurface *surface,
                 /*!< a pointer to a DXF \c SURFACE entity. */
-        int id_code
+        uint64_t id_code
                 /*!< the \c id_code to be set for the entity.\n
                  * This is to be an unique (sequential) number in the
                  * DXF file. */
@@ -904,12 +832,6 @@ dxf_surface_set_id_code
                   __FUNCTION__);
                 return (NULL);
         }
-        if (id_code < 0)
-        {
-                fprintf (stderr,
-                  (_("Warning in %s () a negative value was passed.\n")),
-                  __FUNCTION__);
-        }
         surface->id_code = id_code;
 #if DEBUG
         DXF_DEBUG_END
@@ -951,7 +873,7 @@ dxf_surface_get_linetype
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (surface->linetype));
+        return (dxf_strdup (surface->linetype));
 }
 
 
@@ -991,7 +913,7 @@ dxf_surface_set_linetype
                   __FUNCTION__);
                 return (NULL);
         }
-        surface->linetype = strdup (linetype);
+        surface->linetype = dxf_strdup (linetype);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1032,7 +954,7 @@ dxf_surface_get_layer
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (surface->layer));
+        return (dxf_strdup (surface->layer));
 }
 
 
@@ -1070,7 +992,7 @@ dxf_surface_set_layer
                   __FUNCTION__);
                 return (NULL);
         }
-        surface->layer = strdup (layer);
+        surface->layer = dxf_strdup (layer);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1839,11 +1761,9 @@ dxf_surface_set_binary_graphics_data
  * \brief Get the pointer to the \c dictionary_owner_soft from a DXF 
  * \c SURFACE entity.
  *
- * \return pointer to the \c dictionary_owner_soft.
- *
- * \warning No checks are performed on the returned pointer (string).
+ * \return the handle of the \c dictionary_owner_soft.
  */
-char *
+uint64_t
 dxf_surface_get_dictionary_owner_soft
 (
         DxfSurface *surface
@@ -1859,19 +1779,12 @@ dxf_surface_get_dictionary_owner_soft
                 fprintf (stderr,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
-                return (NULL);
-        }
-        if (surface->dictionary_owner_soft ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
+                return (0);
         }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (surface->dictionary_owner_soft));
+        return (surface->dictionary_owner_soft);
 }
 
 
@@ -1887,8 +1800,8 @@ dxf_surface_set_dictionary_owner_soft
 (
         DxfSurface *surface,
                 /*!< a pointer to a DXF \c SURFACE entity. */
-        char *dictionary_owner_soft
-                /*!< a string containing the pointer to the \c
+        uint64_t dictionary_owner_soft
+                /*!< the handle of the \c
                  * dictionary_owner_soft for the entity. */
 )
 {
@@ -1903,14 +1816,7 @@ dxf_surface_set_dictionary_owner_soft
                   __FUNCTION__);
                 return (NULL);
         }
-        if (dictionary_owner_soft == NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was passed.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
-        surface->dictionary_owner_soft = strdup (dictionary_owner_soft);
+        surface->dictionary_owner_soft = dictionary_owner_soft;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1923,10 +1829,8 @@ dxf_surface_set_dictionary_owner_soft
  * \c SURFACE entity.
  *
  * \return soft pointer to the object owner.
- *
- * \warning No checks are performed on the returned pointer (string).
  */
-char *
+uint64_t
 dxf_surface_get_object_owner_soft
 (
         DxfSurface *surface
@@ -1942,19 +1846,12 @@ dxf_surface_get_object_owner_soft
                 fprintf (stderr,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
-                return (NULL);
-        }
-        if (surface->object_owner_soft ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
+                return (0);
         }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (surface->object_owner_soft));
+        return (surface->object_owner_soft);
 }
 
 
@@ -1967,8 +1864,8 @@ dxf_surface_set_object_owner_soft
 (
         DxfSurface *surface,
                 /*!< a pointer to a DXF \c SURFACE entity. */
-        char *object_owner_soft
-                /*!< a string containing the pointer to the
+        uint64_t object_owner_soft
+                /*!< the handle of the
                  * \c object_owner_soft for the entity. */
 )
 {
@@ -1983,14 +1880,7 @@ dxf_surface_set_object_owner_soft
                   __FUNCTION__);
                 return (NULL);
         }
-        if (object_owner_soft == NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was passed.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
-        surface->object_owner_soft = strdup (object_owner_soft);
+        surface->object_owner_soft = object_owner_soft;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2002,12 +1892,10 @@ dxf_surface_set_object_owner_soft
  * \brief Get the pointer to the \c material from a DXF \c SURFACE
  * entity.
  *
- * \return a pointer to \c material when successful, or \c NULL when an
+ * \return the handle \c material when successful, or 0 when an
  * error occurred.
- *
- * \warning No checks are performed on the returned pointer.
  */
-char *
+uint64_t
 dxf_surface_get_material
 (
         DxfSurface *surface
@@ -2023,19 +1911,12 @@ dxf_surface_get_material
                 fprintf (stderr,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
-                return (NULL);
-        }
-        if (surface->material ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
+                return (0);
         }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (surface->material));
+        return (surface->material);
 }
 
 
@@ -2051,8 +1932,8 @@ dxf_surface_set_material
 (
         DxfSurface *surface,
                 /*!< a pointer to a DXF \c SURFACE entity. */
-        char *material
-                /*!< a string containing the pointer to the \c
+        uint64_t material
+                /*!< the handle of the \c
                  * material for the entity. */
 )
 {
@@ -2067,14 +1948,7 @@ dxf_surface_set_material
                   __FUNCTION__);
                 return (NULL);
         }
-        if (material == NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was passed.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
-        surface->material = strdup (material);
+        surface->material = material;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2086,11 +1960,9 @@ dxf_surface_set_material
  * \brief Get the pointer to the \c dictionary_owner_hard from a DXF 
  * \c SURFACE entity.
  *
- * \return pointer to the \c dictionary_owner_hard.
- *
- * \warning No checks are performed on the returned pointer (string).
+ * \return the handle of the \c dictionary_owner_hard.
  */
-char *
+uint64_t
 dxf_surface_get_dictionary_owner_hard
 (
         DxfSurface *surface
@@ -2106,19 +1978,12 @@ dxf_surface_get_dictionary_owner_hard
                 fprintf (stderr,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
-                return (NULL);
-        }
-        if (surface->dictionary_owner_hard ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
+                return (0);
         }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (surface->dictionary_owner_hard));
+        return (surface->dictionary_owner_hard);
 }
 
 
@@ -2134,8 +1999,8 @@ dxf_surface_set_dictionary_owner_hard
 (
         DxfSurface *surface,
                 /*!< a pointer to a DXF \c SURFACE entity. */
-        char *dictionary_owner_hard
-                /*!< a string containing the pointer to the \c
+        uint64_t dictionary_owner_hard
+                /*!< the handle of the \c
                  * dictionary_owner_hard for the entity. */
 )
 {
@@ -2150,14 +2015,7 @@ dxf_surface_set_dictionary_owner_hard
                   __FUNCTION__);
                 return (NULL);
         }
-        if (dictionary_owner_hard == NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was passed.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
-        surface->dictionary_owner_hard = strdup (dictionary_owner_hard);
+        surface->dictionary_owner_hard = dictionary_owner_hard;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2233,10 +2091,10 @@ dxf_surface_set_lineweight
 /*!
  * \brief Get the \c plot_style_name from a DXF \c SURFACE entity.
  *
- * \return a pointer to \c plot_style_name when successful, or \c NULL
+ * \return the handle \c plot_style_name when successful, or 0
  * when an error occurred.
  */
-char *
+uint64_t
 dxf_surface_get_plot_style_name
 (
         DxfSurface *surface
@@ -2252,19 +2110,12 @@ dxf_surface_get_plot_style_name
                 fprintf (stderr,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
-                return (NULL);
-        }
-        if (surface->plot_style_name ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
+                return (0);
         }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (surface->plot_style_name));
+        return (surface->plot_style_name);
 }
 
 
@@ -2279,7 +2130,7 @@ dxf_surface_set_plot_style_name
 (
         DxfSurface *surface,
                 /*!< a pointer to a DXF \c SURFACE entity. */
-        char *plot_style_name
+        uint64_t plot_style_name
                 /*!< a string containing the \c plot_style_name for the
                  * entity. */
 )
@@ -2295,14 +2146,7 @@ dxf_surface_set_plot_style_name
                   __FUNCTION__);
                 return (NULL);
         }
-        if (plot_style_name == NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was passed.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
-        surface->plot_style_name = strdup (plot_style_name);
+        surface->plot_style_name = plot_style_name;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2409,7 +2253,7 @@ dxf_surface_get_color_name
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (surface->color_name));
+        return (dxf_strdup (surface->color_name));
 }
 
 
@@ -2447,7 +2291,7 @@ dxf_surface_set_color_name
                   __FUNCTION__);
                 return (NULL);
         }
-        surface->color_name = strdup (color_name);
+        surface->color_name = dxf_strdup (color_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -3073,7 +2917,7 @@ dxf_surface_extruded_new ()
         size = sizeof (DxfSurfaceExtruded);
         /* avoid malloc of 0 bytes */
         if (size == 0) size = 1;
-        if ((extruded_surface = malloc (size)) == NULL)
+        if ((extruded_surface = dxf_malloc (size)) == NULL)
         {
                 fprintf (stderr,
                   (_("Error in %s () could not allocate memory.\n")),
@@ -3221,7 +3065,8 @@ dxf_surface_extruded_read
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        char *temp_string = NULL;
+        char temp_string[DXF_MAX_STRING_LENGTH];
+        int group_code;
         DxfDouble *iter40 = NULL;
         DxfDouble *iter46 = NULL;
         DxfDouble *iter47 = NULL;
@@ -3234,8 +3079,6 @@ dxf_surface_extruded_read
                 fprintf (stderr,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
-                /* Clean up. */
-                free (temp_string);
                 return (NULL);
         }
         if (fp->acad_version_number < AutoCAD_2007)
@@ -3256,225 +3099,171 @@ dxf_surface_extruded_read
         iter47 = (DxfDouble *) extruded_surface->path_matrix;
         iter90 = 0;
         iter310 = (DxfBinaryData *) extruded_surface->binary_data;
-        (fp->line_number)++;
-        fscanf (fp->fp, "%[^\n]", temp_string);
-        while (strcmp (temp_string, "0") != 0)
+        while ((dxf_read_group_code (fp, &group_code) == EXIT_SUCCESS)
+          && (group_code != 0))
         {
-                if (ferror (fp->fp))
+                if (dxf_read_error (fp))
                 {
                         fprintf (stderr,
                           (_("Error in %s () while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
                         /* Clean up. */
-                        free (temp_string);
-                        fclose (fp->fp);
                         return (NULL);
                 }
-                else if (strcmp (temp_string, "10") == 0)
-                {
-                        /* Now follows a string containing the
-                         * X-coordinate of the sweep vector. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &extruded_surface->p0->x0);
-                }
-                else if (strcmp (temp_string, "20") == 0)
-                {
-                        /* Now follows a string containing the
-                         * Y-coordinate of the sweep vector. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &extruded_surface->p0->y0);
-                }
-                else if (strcmp (temp_string, "30") == 0)
-                {
-                        /* Now follows a string containing the
-                         * Z-coordinate of the sweep vector. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &extruded_surface->p0->z0);
-                }
-                else if (strcmp (temp_string, "11") == 0)
-                {
-                        /* Now follows a string containing the
-                         * X-coordinate of the reference vector for
-                         * controlling twist. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &extruded_surface->p1->x0);
-                }
-                else if (strcmp (temp_string, "21") == 0)
-                {
-                        /* Now follows a string containing the
-                         * Y-coordinate of the reference vector for
-                         * controlling twist. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &extruded_surface->p1->y0);
-                }
-                else if (strcmp (temp_string, "31") == 0)
-                {
-                        /* Now follows a string containing the
-                         * Z-coordinate of the reference vector for
-                         * controlling twist. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &extruded_surface->p1->z0);
-                }
-                else if (strcmp (temp_string, "40") == 0)
-                {
-                        /* Now follows a string containing the
-                         * transform matrix value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &iter40->value);
-                        iter40->next = (struct DxfDouble *) dxf_double_init ((DxfDouble *) iter40->next);
-                        iter40 = (DxfDouble *) iter40->next;
-                }
-                else if (strcmp (temp_string, "42") == 0)
-                {
-                        /* Now follows a string containing the
-                         * draft angle. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &extruded_surface->draft_angle);
-                }
-                else if (strcmp (temp_string, "43") == 0)
+                switch (group_code)
                 {
-                        /* Now follows a string containing the
-                         * draft start distance. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &extruded_surface->draft_start_distance);
-                }
-                else if (strcmp (temp_string, "44") == 0)
-                {
-                        /* Now follows a string containing the
-                         * draft end distance. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &extruded_surface->draft_end_distance);
-                }
-                else if (strcmp (temp_string, "45") == 0)
-                {
-                        /* Now follows a string containing the
-                         * twist angle. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &extruded_surface->twist_angle);
-                }
-                else if (strcmp (temp_string, "46") == 0)
-                {
-                        /* Now follows a string containing a sweep
-                         * matrix value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &iter46->value);
-                        iter46->next = (struct DxfDouble *) dxf_double_init ((DxfDouble *) iter46->next);
-                        iter46 = (DxfDouble *) iter46->next;
-                }
-                else if (strcmp (temp_string, "47") == 0)
-                {
-                        /* Now follows a string containing a path
-                         * matrix value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &iter47->value);
-                        iter47->next = (struct DxfDouble *) dxf_double_init ((DxfDouble *) iter47->next);
-                        iter47 = (DxfDouble *) iter47->next;
-                }
-                else if (strcmp (temp_string, "48") == 0)
-                {
-                        /* Now follows a string containing the
-                         * scale factor. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &extruded_surface->scale_factor);
-                }
-                else if (strcmp (temp_string, "49") == 0)
-                {
-                        /* Now follows a string containing the
-                         * align angle. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &extruded_surface->align_angle);
-                }
-                else if (strcmp (temp_string, "70") == 0)
-                {
-                        /* Now follows a string containing the sweep
-                         * alignment option number. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%hd\n", &extruded_surface->sweep_alignment_option);
-                }
-                else if (strcmp (temp_string, "90") == 0)
-                {
-                        if (iter90 == 0)
-                        {
+                        case 10:
                                 /* Now follows a string containing the
-                                 * class ID value. */
-                                (fp->line_number)++;
-                                fscanf (fp->fp, "%" PRIi32 "\n", &extruded_surface->class_ID);
-                        }
-                        if (iter90 == 1)
-                        {
+                                 * X-coordinate of the sweep vector. */
+                                dxf_read_double (fp, &extruded_surface->p0->x0);
+                                break;
+                        case 20:
                                 /* Now follows a string containing the
-                                 * class ID value. */
-                                (fp->line_number)++;
-                                fscanf (fp->fp, "%" PRIi32 "\n", &extruded_surface->binary_data_size);
-                        }
-                        iter90++;
-
-                }
-                else if (strcmp (temp_string, "290") == 0)
-                {
-                        /* Now follows a string containing the solid
-                         * flag. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%d\n", &extruded_surface->solid_flag);
-                }
-                else if (strcmp (temp_string, "292") == 0)
-                {
-                        /* Now follows a string containing the align
-                         * start fla. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%d\n", &extruded_surface->align_start_flag);
-                }
-                else if (strcmp (temp_string, "293") == 0)
-                {
-                        /* Now follows a string containing the bank flag. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%d\n", &extruded_surface->bank_flag);
-                }
-                else if (strcmp (temp_string, "294") == 0)
-                {
-                        /* Now follows a string containing the base
-                         * point set flag. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%d\n", &extruded_surface->base_point_set_flag);
-                }
-                else if (strcmp (temp_string, "295") == 0)
-                {
-                        /* Now follows a string containing the sweep
-                         * entity transform computed flag. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%d\n", &extruded_surface->sweep_transform_computed_flag);
-                }
-                else if (strcmp (temp_string, "296") == 0)
-                {
-                        /* Now follows a string containing the path
-                         * entity transform computed flag. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%d\n", &extruded_surface->path_transform_computed_flag);
-                }
-                else if (strcmp (temp_string, "310") == 0)
-                {
-                        /* Now follows a string containing binary data. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, iter310->data_line);
-                        dxf_binary_data_init ((DxfBinaryData *) iter310->next);
-                        iter310 = (DxfBinaryData *) iter310->next;
-                }
-                else if (strcmp (temp_string, "999") == 0)
-                {
-                        /* Now follows a string containing a comment. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
-                        fprintf (stdout, (_("DXF comment: %s\n")), temp_string);
-                }
-                else
-                {
-                        fprintf (stderr,
-                          (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
-                          __FUNCTION__, fp->filename, fp->line_number);
+                                 * Y-coordinate of the sweep vector. */
+                                dxf_read_double (fp, &extruded_surface->p0->y0);
+                                break;
+                        case 30:
+                                /* Now follows a string containing the
+                                 * Z-coordinate of the sweep vector. */
+                                dxf_read_double (fp, &extruded_surface->p0->z0);
+                                break;
+                        case 11:
+                                /* Now follows a string containing the
+                                 * X-coordinate of the reference vector for
+                                 * controlling twist. */
+                                dxf_read_double (fp, &extruded_surface->p1->x0);
+                                break;
+                        case 21:
+                                /* Now follows a string containing the
+                                 * Y-coordinate of the reference vector for
+                                 * controlling twist. */
+                                dxf_read_double (fp, &extruded_surface->p1->y0);
+                                break;
+                        case 31:
+                                /* Now follows a string containing the
+                                 * Z-coordinate of the reference vector for
+                                 * controlling twist. */
+                                dxf_read_double (fp, &extruded_surface->p1->z0);
+                                break;
+                        case 40:
+                                /* Now follows a string containing the
+                                 * transform matrix value. */
+                                dxf_read_double (fp, &iter40->value);
+                                iter40->next = (struct DxfDouble *) dxf_double_init ((DxfDouble *) iter40->next);
+                                iter40 = (DxfDouble *) iter40->next;
+                                break;
+                        case 42:
+                                /* Now follows a string containing the
+                                 * draft angle. */
+                                dxf_read_double (fp, &extruded_surface->draft_angle);
+                                break;
+                        case 43:
+                                /* Now follows a string containing the
+                                 * draft start distance. */
+                                dxf_read_double (fp, &extruded_surface->draft_start_distance);
+                                break;
+                        case 44:
+                                /* Now follows a string containing the
+                                 * draft end distance. */
+                                dxf_read_double (fp, &extruded_surface->draft_end_distance);
+                                break;
+                        case 45:
+                                /* Now follows a string containing the
+                                 * twist angle. */
+                                dxf_read_double (fp, &extruded_surface->twist_angle);
+                                break;
+                        case 46:
+                                /* Now follows a string containing a sweep
+                                 * matrix value. */
+                                dxf_read_double (fp, &iter46->value);
+                                iter46->next = (struct DxfDouble *) dxf_double_init ((DxfDouble *) iter46->next);
+                                iter46 = (DxfDouble *) iter46->next;
+                                break;
+                        case 47:
+                                /* Now follows a string containing a path
+                                 * matrix value. */
+                                dxf_read_double (fp, &iter47->value);
+                                iter47->next = (struct DxfDouble *) dxf_double_init ((DxfDouble *) iter47->next);
+                                iter47 = (DxfDouble *) iter47->next;
+                                break;
+                        case 48:
+                                /* Now follows a string containing the
+                                 * scale factor. */
+                                dxf_read_double (fp, &extruded_surface->scale_factor);
+                                break;
+                        case 49:
+                                /* Now follows a string containing the
+                                 * align angle. */
+                                dxf_read_double (fp, &extruded_surface->align_angle);
+                                break;
+                        case 70:
+                                /* Now follows a string containing the sweep
+                                 * alignment option number. */
+                                dxf_read_int16 (fp, &extruded_surface->sweep_alignment_option);
+                                break;
+                        case 90:
+                                if (iter90 == 0)
+                                {
+                                        /* Now follows a string containing the
+                                         * class ID value. */
+                                        dxf_read_int32 (fp, &extruded_surface->class_ID);
+                                }
+                                if (iter90 == 1)
+                                {
+                                        /* Now follows a string containing the
+                                         * class ID value. */
+                                        dxf_read_int32 (fp, &extruded_surface->binary_data_size);
+                                }
+                                iter90++;
+
+                                break;
+                        case 290:
+                                /* Now follows a string containing the solid
+                                 * flag. */
+                                dxf_read_int (fp, &extruded_surface->solid_flag);
+                                break;
+                        case 292:
+                                /* Now follows a string containing the align
+                                 * start fla. */
+                                dxf_read_int (fp, &extruded_surface->align_start_flag);
+                                break;
+                        case 293:
+                                /* Now follows a string containing the bank flag. */
+                                dxf_read_int (fp, &extruded_surface->bank_flag);
+                                break;
+                        case 294:
+                                /* Now follows a string containing the base
+                                 * point set flag. */
+                                dxf_read_int (fp, &extruded_surface->base_point_set_flag);
+                                break;
+                        case 295:
+                                /* Now follows a string containing the sweep
+                                 * entity transform computed flag. */
+                                dxf_read_int (fp, &extruded_surface->sweep_transform_computed_flag);
+                                break;
+                        case 296:
+                                /* Now follows a string containing the path
+                                 * entity transform computed flag. */
+                                dxf_read_int (fp, &extruded_surface->path_transform_computed_flag);
+                                break;
+                        case 310:
+                                /* Now follows a string containing binary data. */
+                                iter310 = dxf_binary_data_read (fp, iter310);
+                                break;
+                        case 999:
+                                /* Now follows a string containing a comment. */
+                                dxf_read_line (temp_string, fp);
+                                fprintf (stdout, (_("DXF comment: %s\n")), temp_string);
+                                break;
+                        default:
+                                fprintf (stderr,
+                                  (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
+                                  __FUNCTION__, fp->filename, fp->line_number);
+                                /* Skip the value of the unknown group code. */
+                                dxf_read_line (temp_string, fp);
+                                break;
                 }
         }
-        /* Clean up. */
-        free (temp_string);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -3514,46 +3303,46 @@ dxf_surface_extruded_write
         }
         if (fp->acad_version_number >= AutoCAD_13)
         {
-                fprintf (fp->fp, "100\nAcDbExtrudedSurface\n");
+                dxf_write_string (fp, 100, "AcDbExtrudedSurface");
         }
-        fprintf (fp->fp, " 90\n%" PRIi32 "\n", extruded_surface->class_ID);
-        fprintf (fp->fp, " 90\n%" PRIi32 "\n", extruded_surface->binary_data_size);
+        dxf_write_int (fp, 90, extruded_surface->class_ID);
+        dxf_write_int (fp, 90, extruded_surface->binary_data_size);
         if (extruded_surface->binary_data != NULL)
         {
                 DxfBinaryData *iter310;
                 iter310 = (DxfBinaryData *) extruded_surface->binary_data;
                 while (iter310 != NULL)
                 {
-                        fprintf (fp->fp, "310\n%s\n", iter310->data_line);
+                        dxf_binary_data_write (fp, iter310);
                         iter310 = (DxfBinaryData *) iter310->next;
                 }
         }
-        fprintf (fp->fp, " 10\n%f\n", extruded_surface->p0->x0);
-        fprintf (fp->fp, " 20\n%f\n", extruded_surface->p0->y0);
-        fprintf (fp->fp, " 30\n%f\n", extruded_surface->p0->z0);
+        dxf_write_double (fp, 10, extruded_surface->p0->x0);
+        dxf_write_double (fp, 20, extruded_surface->p0->y0);
+        dxf_write_double (fp, 30, extruded_surface->p0->z0);
         if (extruded_surface->transform_matrix != NULL)
         {
                 DxfDouble *iter40;
                 iter40 = (DxfDouble *) extruded_surface->transform_matrix;
                 while (iter40 != NULL)
                 {
-                        fprintf (fp->fp, " 40\n%f\n", iter40->value);
+                        dxf_write_double (fp, 40, iter40->value);
                         iter40 = (DxfDouble *) iter40->next;
                 }
         }
-        fprintf (fp->fp, " 42\n%f\n", extruded_surface->draft_angle);
-        fprintf (fp->fp, " 43\n%f\n", extruded_surface->draft_start_distance);
-        fprintf (fp->fp, " 44\n%f\n", extruded_surface->draft_end_distance);
-        fprintf (fp->fp, " 45\n%f\n", extruded_surface->twist_angle);
-        fprintf (fp->fp, " 48\n%f\n", extruded_surface->scale_factor);
-        fprintf (fp->fp, " 49\n%f\n", extruded_surface->align_angle);
+        dxf_write_double (fp, 42, extruded_surface->draft_angle);
+        dxf_write_double (fp, 43, extruded_surface->draft_start_distance);
+        dxf_write_double (fp, 44, extruded_surface->draft_end_distance);
+        dxf_write_double (fp, 45, extruded_surface->twist_angle);
+        dxf_write_double (fp, 48, extruded_surface->scale_factor);
+        dxf_write_double (fp, 49, extruded_surface->align_angle);
         if (extruded_surface->sweep_matrix != NULL)
         {
                 DxfDouble *iter46;
                 iter46 = (DxfDouble *) extruded_surface->sweep_matrix;
                 while (iter46 != NULL)
                 {
-                        fprintf (fp->fp, " 46\n%f\n", iter46->value);
+                        dxf_write_double (fp, 46, iter46->value);
                         iter46 = (DxfDouble *) iter46->next;
                 }
         }
@@ -3563,20 +3352,20 @@ dxf_surface_extruded_write
                 iter47 = (DxfDouble *) extruded_surface->path_matrix;
                 while (iter47 != NULL)
                 {
-                        fprintf (fp->fp, " 47\n%f\n", iter47->value);
+                        dxf_write_double (fp, 47, iter47->value);
                         iter47 = (DxfDouble *) iter47->next;
                 }
         }
-        fprintf (fp->fp, "290\n%d\n", extruded_surface->solid_flag);
-        fprintf (fp->fp, " 70\n%hd\n", extruded_surface->sweep_alignment_option);
-        fprintf (fp->fp, "292\n%d\n", extruded_surface->align_start_flag);
-        fprintf (fp->fp, "293\n%d\n", extruded_surface->bank_flag);
-        fprintf (fp->fp, "294\n%d\n", extruded_surface->base_point_set_flag);
-        fprintf (fp->fp, "295\n%d\n", extruded_surface->sweep_transform_computed_flag);
-        fprintf (fp->fp, "296\n%d\n", extruded_surface->path_transform_computed_flag);
-        fprintf (fp->fp, " 11\n%f\n", extruded_surface->p1->x0);
-        fprintf (fp->fp, " 21\n%f\n", extruded_surface->p1->y0);
-        fprintf (fp->fp, " 31\n%f\n", extruded_surface->p1->z0);
+        dxf_write_int (fp, 290, extruded_surface->solid_flag);
+        dxf_write_int (fp, 70, extruded_surface->sweep_alignment_option);
+        dxf_write_int (fp, 292, extruded_surface->align_start_flag);
+        dxf_write_int (fp, 293, extruded_surface->bank_flag);
+        dxf_write_int (fp, 294, extruded_surface->base_point_set_flag);
+        dxf_write_int (fp, 295, extruded_surface->sweep_transform_computed_flag);
+        dxf_write_int (fp, 296, extruded_surface->path_transform_computed_flag);
+        dxf_write_double (fp, 11, extruded_surface->p1->x0);
+        dxf_write_double (fp, 21, extruded_surface->p1->y0);
+        dxf_write_double (fp, 31, extruded_surface->p1->z0);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -3623,7 +3412,7 @@ dxf_surface_extruded_free
         dxf_double_free_list (extruded_surface->sweep_matrix);
         dxf_double_free_list (extruded_surface->path_matrix);
         dxf_binary_data_free_list (extruded_surface->binary_data);
-        free (extruded_surface);
+        dxf_free (extruded_surface);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -5851,7 +5640,7 @@ dxf_surface_lofted_new ()
         size = sizeof (DxfSurfaceLofted);
         /* avoid malloc of 0 bytes */
         if (size == 0) size = 1;
-        if ((lofted_surface = malloc (size)) == NULL)
+        if ((lofted_surface = dxf_malloc (size)) == NULL)
         {
                 fprintf (stderr,
                   (_("Error in %s () could not allocate memory.\n")),
@@ -5957,7 +5746,8 @@ dxf_surface_lofted_read
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        char *temp_string = NULL;
+        char temp_string[DXF_MAX_STRING_LENGTH];
+        int group_code;
         DxfDouble *iter40 = NULL;
 
         /* Do some basic checks. */
@@ -5966,8 +5756,6 @@ dxf_surface_lofted_read
                 fprintf (stderr,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
-                /* Clean up. */
-                free (temp_string);
                 return (NULL);
         }
         if (fp->acad_version_number < AutoCAD_2007)
@@ -5984,123 +5772,97 @@ dxf_surface_lofted_read
                 lofted_surface = dxf_surface_lofted_init (lofted_surface);
         }
         iter40 = (DxfDouble *) lofted_surface->transform_matrix;
-        (fp->line_number)++;
-        fscanf (fp->fp, "%[^\n]", temp_string);
-        while (strcmp (temp_string, "0") != 0)
+        while ((dxf_read_group_code (fp, &group_code) == EXIT_SUCCESS)
+          && (group_code != 0))
         {
-                if (ferror (fp->fp))
+                if (dxf_read_error (fp))
                 {
                         fprintf (stderr,
                           (_("Error in %s () while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
                         /* Clean up. */
-                        free (temp_string);
-                        fclose (fp->fp);
                         return (NULL);
                 }
-                else if (strcmp (temp_string, "40") == 0)
-                {
-                        /* Now follows a string containing the
-                         * transform matrix value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &iter40->value);
-                        iter40->next = (struct DxfDouble *) dxf_double_init ((DxfDouble *) iter40->next);
-                        iter40 = (DxfDouble *) iter40->next;
-                }
-                else if (strcmp (temp_string, "41") == 0)
-                {
-                        /* Now follows a string containing the start
-                         * draft angle. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &lofted_surface->start_draft_angle);
-                }
-                else if (strcmp (temp_string, "42") == 0)
-                {
-                        /* Now follows a string containing the end
-                         * draft angle. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &lofted_surface->end_draft_angle);
-                }
-                else if (strcmp (temp_string, "43") == 0)
-                {
-                        /* Now follows a string containing the start
-                         * draft magnitude. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &lofted_surface->start_draft_magnitude);
-                }
-                else if (strcmp (temp_string, "44") == 0)
-                {
-                        /* Now follows a string containing the end
-                         * draft magnitude. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &lofted_surface->end_draft_magnitude);
-                }
-                else if (strcmp (temp_string, "70") == 0)
-                {
-                        /* Now follows a string containing the plane
-                         * normal lofting type. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%hd\n", &lofted_surface->plane_normal_lofting_type);
-                }
-                else if (strcmp (temp_string, "290") == 0)
-                {
-                        /* Now follows a string containing the arc
-                         * length parameterization flag. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%d\n", &lofted_surface->arc_length_parameterization_flag);
-                }
-                else if (strcmp (temp_string, "291") == 0)
+                switch (group_code)
                 {
-                        /* Now follows a string containing the no twist
-                         * flag. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%d\n", &lofted_surface->no_twist_flag);
-                }
-                else if (strcmp (temp_string, "292") == 0)
-                {
-                        /* Now follows a string containing the align
-                         * direction flag. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%d\n", &lofted_surface->align_direction_flag);
-                }
-                else if (strcmp (temp_string, "293") == 0)
-                {
-                        /* Now follows a string containing the create
-                         * simple surfaces flag. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%d\n", &lofted_surface->create_simple_surfaces_flag);
-                }
-                else if (strcmp (temp_string, "294") == 0)
-                {
-                        /* Now follows a string containing the create
-                         * closed surface flag. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%d\n", &lofted_surface->create_closed_surface_flag);
-                }
-                else if (strcmp (temp_string, "295") == 0)
-                {
-                        /* Now follows a string containing the solid
-                         * flag. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%d\n", &lofted_surface->solid_flag);
-                }
-                else if (strcmp (temp_string, "296") == 0)
-                {
-                        /* Now follows a string containing the create
-                         * ruled surface flag. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%d\n", &lofted_surface->create_ruled_surface_flag);
-                }
-                else if (strcmp (temp_string, "297") == 0)
-                {
-                        /* Now follows a string containing the virtual
-                         * guide flag. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%d\n", &lofted_surface->virtual_guide_flag);
+                        case 40:
+                                /* Now follows a string containing the
+                                 * transform matrix value. */
+                                dxf_read_double (fp, &iter40->value);
+                                iter40->next = (struct DxfDouble *) dxf_double_init ((DxfDouble *) iter40->next);
+                                iter40 = (DxfDouble *) iter40->next;
+                                break;
+                        case 41:
+                                /* Now follows a string containing the start
+                                 * draft angle. */
+                                dxf_read_double (fp, &lofted_surface->start_draft_angle);
+                                break;
+                        case 42:
+                                /* Now follows a string containing the end
+                                 * draft angle. */
+                                dxf_read_double (fp, &lofted_surface->end_draft_angle);
+                                break;
+                        case 43:
+                                /* Now follows a string containing the start
+                                 * draft magnitude. */
+                                dxf_read_double (fp, &lofted_surface->start_draft_magnitude);
+                                break;
+                        case 44:
+                                /* Now follows a string containing the end
+                                 * draft magnitude. */
+                                dxf_read_double (fp, &lofted_surface->end_draft_magnitude);
+                                break;
+                        case 70:
+                                /* Now follows a string containing the plane
+                                 * normal lofting type. */
+                                dxf_read_int16 (fp, &lofted_surface->plane_normal_lofting_type);
+                                break;
+                        case 290:
+                                /* Now follows a string containing the arc
+                                 * length parameterization flag. */
+                                dxf_read_int (fp, &lofted_surface->arc_length_parameterization_flag);
+                                break;
+                        case 291:
+                                /* Now follows a string containing the no twist
+                                 * flag. */
+                                dxf_read_int (fp, &lofted_surface->no_twist_flag);
+                                break;
+                        case 292:
+                                /* Now follows a string containing the align
+                                 * direction flag. */
+                                dxf_read_int (fp, &lofted_surface->align_direction_flag);
+                                break;
+                        case 293:
+                                /* Now follows a string containing the create
+                                 * simple surfaces flag. */
+                                dxf_read_int (fp, &lofted_surface->create_simple_surfaces_flag);
+                                break;
+                        case 294:
+                                /* Now follows a string containing the create
+                                 * closed surface flag. */
+                                dxf_read_int (fp, &lofted_surface->create_closed_surface_flag);
+                                break;
+                        case 295:
+                                /* Now follows a string containing the solid
+                                 * flag. */
+                                dxf_read_int (fp, &lofted_surface->solid_flag);
+                                break;
+                        case 296:
+                                /* Now follows a string containing the create
+                                 * ruled surface flag. */
+                                dxf_read_int (fp, &lofted_surface->create_ruled_surface_flag);
+                                break;
+                        case 297:
+                                /* Now follows a string containing the virtual
+                                 * guide flag. */
+                                dxf_read_int (fp, &lofted_surface->virtual_guide_flag);
+                                break;
+                        default:
+                                /* Skip the value of the unknown group code. */
+                                dxf_read_line (temp_string, fp);
+                                break;
                 }
         }
-        /* Clean up. */
-        free (temp_string);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -6140,7 +5902,7 @@ dxf_surface_lofted_write
         }
         if (fp->acad_version_number >= AutoCAD_13)
         {
-                fprintf (fp->fp, "100\nAcDbLoftedSurface\n");
+                dxf_write_string (fp, 100, "AcDbLoftedSurface");
         }
         if (lofted_surface->transform_matrix != NULL)
         {
@@ -6148,26 +5910,26 @@ dxf_surface_lofted_write
                 iter40 = (DxfDouble *) lofted_surface->transform_matrix;
                 while (iter40 != NULL)
                 {
-                        fprintf (fp->fp, " 40\n%f\n", iter40->value);
+                        dxf_write_double (fp, 40, iter40->value);
                         iter40 = (DxfDouble *) iter40->next;
                 }
         }
         /*! \todo add Entity data for cross sections. */
         /*! \todo add Entity data for guide curves. */
         /*! \todo add Entity data for path curves. */
-        fprintf (fp->fp, " 70\n%hd\n", lofted_surface->plane_normal_lofting_type);
-        fprintf (fp->fp, " 41\n%f\n", lofted_surface->start_draft_angle);
-        fprintf (fp->fp, " 42\n%f\n", lofted_surface->end_draft_angle);
-        fprintf (fp->fp, " 43\n%f\n", lofted_surface->start_draft_magnitude);
-        fprintf (fp->fp, " 44\n%f\n", lofted_surface->end_draft_magnitude);
-        fprintf (fp->fp, "290\n%d\n", lofted_surface->arc_length_parameterization_flag);
-        fprintf (fp->fp, "291\n%d\n", lofted_surface->no_twist_flag);
-        fprintf (fp->fp, "292\n%d\n", lofted_surface->align_direction_flag);
-        fprintf (fp->fp, "293\n%d\n", lofted_surface->create_simple_surfaces_flag);
-        fprintf (fp->fp, "294\n%d\n", lofted_surface->create_closed_surface_flag);
-        fprintf (fp->fp, "295\n%d\n", lofted_surface->solid_flag);
-        fprintf (fp->fp, "296\n%d\n", lofted_surface->create_ruled_surface_flag);
-        fprintf (fp->fp, "297\n%d\n", lofted_surface->virtual_guide_flag);
+        dxf_write_int (fp, 70, lofted_surface->plane_normal_lofting_type);
+        dxf_write_double (fp, 41, lofted_surface->start_draft_angle);
+        dxf_write_double (fp, 42, lofted_surface->end_draft_angle);
+        dxf_write_double (fp, 43, lofted_surface->start_draft_magnitude);
+        dxf_write_double (fp, 44, lofted_surface->end_draft_magnitude);
+        dxf_write_int (fp, 290, lofted_surface->arc_length_parameterization_flag);
+        dxf_write_int (fp, 291, lofted_surface->no_twist_flag);
+        dxf_write_int (fp, 292, lofted_surface->align_direction_flag);
+        dxf_write_int (fp, 293, lofted_surface->create_simple_surfaces_flag);
+        dxf_write_int (fp, 294, lofted_surface->create_closed_surface_flag);
+        dxf_write_int (fp, 295, lofted_surface->solid_flag);
+        dxf_write_int (fp, 296, lofted_surface->create_ruled_surface_flag);
+        dxf_write_int (fp, 297, lofted_surface->virtual_guide_flag);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -6208,7 +5970,7 @@ dxf_surface_lofted_free
                 return (EXIT_FAILURE);
         }
         dxf_double_free_list (lofted_surface->transform_matrix);
-        free (lofted_surface);
+        dxf_free (lofted_surface);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -7344,7 +7106,7 @@ dxf_surface_revolved_new ()
         size = sizeof (DxfSurfaceRevolved);
         /* avoid malloc of 0 bytes */
         if (size == 0) size = 1;
-        if ((revolved_surface = malloc (size)) == NULL)
+        if ((revolved_surface = dxf_malloc (size)) == NULL)
         {
                 fprintf (stderr,
                   (_("Error in %s () could not allocate memory.\n")),
@@ -7471,7 +7233,8 @@ dxf_surface_revolved_read
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        char *temp_string = NULL;
+        char temp_string[DXF_MAX_STRING_LENGTH];
+        int group_code;
         DxfDouble *iter42 = NULL;
         int iter90;
         DxfBinaryData *iter310 = NULL;
@@ -7482,8 +7245,6 @@ dxf_surface_revolved_read
                 fprintf (stderr,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
-                /* Clean up. */
-                free (temp_string);
                 return (NULL);
         }
         if (fp->acad_version_number < AutoCAD_2007)
@@ -7502,156 +7263,121 @@ dxf_surface_revolved_read
         iter42 = (DxfDouble *) revolved_surface->transform_matrix;
         iter90 = 0;
         iter310 = (DxfBinaryData *) revolved_surface->binary_data;
-        (fp->line_number)++;
-        fscanf (fp->fp, "%[^\n]", temp_string);
-        while (strcmp (temp_string, "0") != 0)
+        while ((dxf_read_group_code (fp, &group_code) == EXIT_SUCCESS)
+          && (group_code != 0))
         {
-                if (ferror (fp->fp))
+                if (dxf_read_error (fp))
                 {
                         fprintf (stderr,
                           (_("Error in %s () while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
                         /* Clean up. */
-                        free (temp_string);
-                        fclose (fp->fp);
                         return (NULL);
                 }
-                else if (strcmp (temp_string, "10") == 0)
-                {
-                        /* Now follows a string containing the
-                         * X-coordinate of the axis point. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &revolved_surface->p0->x0);
-                }
-                else if (strcmp (temp_string, "20") == 0)
-                {
-                        /* Now follows a string containing the
-                         * Y-coordinate of the axis point. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &revolved_surface->p0->y0);
-                }
-                else if (strcmp (temp_string, "30") == 0)
-                {
-                        /* Now follows a string containing the
-                         * Z-coordinate of the axis point. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &revolved_surface->p0->z0);
-                }
-                else if (strcmp (temp_string, "11") == 0)
-                {
-                        /* Now follows a string containing the
-                         * X-coordinate of the axis vector. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &revolved_surface->p1->x0);
-                }
-                else if (strcmp (temp_string, "21") == 0)
-                {
-                        /* Now follows a string containing the
-                         * Y-coordinate of the axis vector. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &revolved_surface->p1->y0);
-                }
-                else if (strcmp (temp_string, "31") == 0)
-                {
-                        /* Now follows a string containing the
-                         * Z-coordinate of the axis vector. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &revolved_surface->p1->z0);
-                }
-                else if (strcmp (temp_string, "40") == 0)
-                {
-                        /* Now follows a string containing the revolve
-                         * angle. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &revolved_surface->revolve_angle);
-                }
-                else if (strcmp (temp_string, "41") == 0)
-                {
-                        /* Now follows a string containing the start
-                         * angle. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &revolved_surface->start_angle);
-                }
-                else if (strcmp (temp_string, "42") == 0)
-                {
-                        /* Now follows a string containing the
-                         * transform matrix value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &iter42->value);
-                        iter42->next = (struct DxfDouble *) dxf_double_init ((DxfDouble *) iter42->next);
-                        iter42 = (DxfDouble *) iter42->next;
-                }
-                else if (strcmp (temp_string, "43") == 0)
-                {
-                        /* Now follows a string containing the draft
-                         * angle. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &revolved_surface->draft_angle);
-                }
-                else if (strcmp (temp_string, "44") == 0)
-                {
-                        /* Now follows a string containing the start
-                         * draft distance. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &revolved_surface->start_draft_distance);
-                }
-                else if (strcmp (temp_string, "45") == 0)
-                {
-                        /* Now follows a string containing the end draft
-                         * distance. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &revolved_surface->end_draft_distance);
-                }
-                else if (strcmp (temp_string, "46") == 0)
-                {
-                        /* Now follows a string containing the twist
-                         * angle. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &revolved_surface->twist_angle);
-                }
-                else if (strcmp (temp_string, "90") == 0)
+                switch (group_code)
                 {
-                        if (iter90 == 0)
-                        {
+                        case 10:
                                 /* Now follows a string containing the
-                                 * ID of the revolve entity. */
-                                (fp->line_number)++;
-                                fscanf (fp->fp, "%" PRIi32 "\n", &revolved_surface->ID);
-                        }
-                        if (iter90 == 1)
-                        {
+                                 * X-coordinate of the axis point. */
+                                dxf_read_double (fp, &revolved_surface->p0->x0);
+                                break;
+                        case 20:
                                 /* Now follows a string containing the
-                                 * binary data size. */
-                                (fp->line_number)++;
-                                fscanf (fp->fp, "%" PRIi32 "\n", &revolved_surface->binary_data_size);
-                        }
-                        iter90++;
-                }
-                else if (strcmp (temp_string, "290") == 0)
-                {
-                        /* Now follows a string containing the solid
-                         * flag. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%d\n", &revolved_surface->solid_flag);
-                }
-                else if (strcmp (temp_string, "291") == 0)
-                {
-                        /* Now follows a string containing the close to
-                         * axis flag. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%d\n", &revolved_surface->close_to_axis_flag);
-                }
-                else if (strcmp (temp_string, "310") == 0)
-                {
-                        /* Now follows a string containing binary data. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, iter310->data_line);
-                        dxf_binary_data_init ((DxfBinaryData *) iter310->next);
-                        iter310 = (DxfBinaryData *) iter310->next;
+                                 * Y-coordinate of the axis point. */
+                                dxf_read_double (fp, &revolved_surface->p0->y0);
+                                break;
+                        case 30:
+                                /* Now follows a string containing the
+                                 * Z-coordinate of the axis point. */
+                                dxf_read_double (fp, &revolved_surface->p0->z0);
+                                break;
+                        case 11:
+                                /* Now follows a string containing the
+                                 * X-coordinate of the axis vector. */
+                                dxf_read_double (fp, &revolved_surface->p1->x0);
+                                break;
+                        case 21:
+                                /* Now follows a string containing the
+                                 * Y-coordinate of the axis vector. */
+                                dxf_read_double (fp, &revolved_surface->p1->y0);
+                                break;
+                        case 31:
+                                /* Now follows a string containing the
+                                 * Z-coordinate of the axis vector. */
+                                dxf_read_double (fp, &revolved_surface->p1->z0);
+                                break;
+                        case 40:
+                                /* Now follows a string containing the revolve
+                                 * angle. */
+                                dxf_read_double (fp, &revolved_surface->revolve_angle);
+                                break;
+                        case 41:
+                                /* Now follows a string containing the start
+                                 * angle. */
+                                dxf_read_double (fp, &revolved_surface->start_angle);
+                                break;
+                        case 42:
+                                /* Now follows a string containing the
+                                 * transform matrix value. */
+                                dxf_read_double (fp, &iter42->value);
+                                iter42->next = (struct DxfDouble *) dxf_double_init ((DxfDouble *) iter42->next);
+                                iter42 = (DxfDouble *) iter42->next;
+                                break;
+                        case 43:
+                                /* Now follows a string containing the draft
+                                 * angle. */
+                                dxf_read_double (fp, &revolved_surface->draft_angle);
+                                break;
+                        case 44:
+                                /* Now follows a string containing the start
+                                 * draft distance. */
+                                dxf_read_double (fp, &revolved_surface->start_draft_distance);
+                                break;
+                        case 45:
+                                /* Now follows a string containing the end draft
+                                 * distance. */
+                                dxf_read_double (fp, &revolved_surface->end_draft_distance);
+                                break;
+                        case 46:
+                                /* Now follows a string containing the twist
+                                 * angle. */
+                                dxf_read_double (fp, &revolved_surface->twist_angle);
+                                break;
+                        case 90:
+                                if (iter90 == 0)
+                                {
+                                        /* Now follows a string containing the
+                                         * ID of the revolve entity. */
+                                        dxf_read_int32 (fp, &revolved_surface->ID);
+                                }
+                                if (iter90 == 1)
+                                {
+                                        /* Now follows a string containing the
+                                         * binary data size. */
+                                        dxf_read_int32 (fp, &revolved_surface->binary_data_size);
+                                }
+                                iter90++;
+                                break;
+                        case 290:
+                                /* Now follows a string containing the solid
+                                 * flag. */
+                                dxf_read_int (fp, &revolved_surface->solid_flag);
+                                break;
+                        case 291:
+                                /* Now follows a string containing the close to
+                                 * axis flag. */
+                                dxf_read_int (fp, &revolved_surface->close_to_axis_flag);
+                                break;
+                        case 310:
+                                /* Now follows a string containing binary data. */
+                                iter310 = dxf_binary_data_read (fp, iter310);
+                                break;
+                        default:
+                                /* Skip the value of the unknown group code. */
+                                dxf_read_line (temp_string, fp);
+                                break;
                 }
         }
-        /* Clean up. */
-        free (temp_string);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -7691,44 +7417,44 @@ dxf_surface_revolved_write
         }
         if (fp->acad_version_number >= AutoCAD_13)
         {
-                fprintf (fp->fp, "100\nAcDbRevolvedSurface\n");
+                dxf_write_string (fp, 100, "AcDbRevolvedSurface");
         }
-        fprintf (fp->fp, " 90\n%" PRIi32 "\n", revolved_surface->ID);
-        fprintf (fp->fp, " 90\n%" PRIi32 "\n", revolved_surface->binary_data_size);
+        dxf_write_int (fp, 90, revolved_surface->ID);
+        dxf_write_int (fp, 90, revolved_surface->binary_data_size);
         if (revolved_surface->binary_data != NULL)
         {
                 DxfBinaryData *iter310;
                 iter310 = (DxfBinaryData *) revolved_surface->binary_data;
                 while (iter310 != NULL)
                 {
-                        fprintf (fp->fp, "310\n%s\n", iter310->data_line);
+                        dxf_binary_data_write (fp, iter310);
                         iter310 = (DxfBinaryData *) iter310->next;
                 }
         }
-        fprintf (fp->fp, " 10\n%f\n", revolved_surface->p0->x0);
-        fprintf (fp->fp, " 20\n%f\n", revolved_surface->p0->y0);
-        fprintf (fp->fp, " 30\n%f\n", revolved_surface->p0->z0);
-        fprintf (fp->fp, " 11\n%f\n", revolved_surface->p1->x0);
-        fprintf (fp->fp, " 21\n%f\n", revolved_surface->p1->y0);
-        fprintf (fp->fp, " 31\n%f\n", revolved_surface->p1->z0);
-        fprintf (fp->fp, " 40\n%f\n", revolved_surface->revolve_angle);
-        fprintf (fp->fp, " 41\n%f\n", revolved_surface->start_angle);
+        dxf_write_double (fp, 10, revolved_surface->p0->x0);
+        dxf_write_double (fp, 20, revolved_surface->p0->y0);
+        dxf_write_double (fp, 30, revolved_surface->p0->z0);
+        dxf_write_double (fp, 11, revolved_surface->p1->x0);
+        dxf_write_double (fp, 21, revolved_surface->p1->y0);
+        dxf_write_double (fp, 31, revolved_surface->p1->z0);
+        dxf_write_double (fp, 40, revolved_surface->revolve_angle);
+        dxf_write_double (fp, 41, revolved_surface->start_angle);
         if (revolved_surface->transform_matrix != NULL)
         {
                 DxfDouble *iter42;
                 iter42 = (DxfDouble *) revolved_surface->transform_matrix;
                 while (iter42 != NULL)
                 {
-                        fprintf (fp->fp, " 40\n%f\n", iter42->value);
+                        dxf_write_double (fp, 40, iter42->value);
                         iter42 = (DxfDouble *) iter42->next;
                 }
         }
-        fprintf (fp->fp, " 43\n%f\n", revolved_surface->draft_angle);
-        fprintf (fp->fp, " 44\n%f\n", revolved_surface->start_draft_distance);
-        fprintf (fp->fp, " 45\n%f\n", revolved_surface->end_draft_distance);
-        fprintf (fp->fp, " 46\n%f\n", revolved_surface->twist_angle);
-        fprintf (fp->fp, "290\n%d\n", revolved_surface->solid_flag);
-        fprintf (fp->fp, "291\n%d\n", revolved_surface->close_to_axis_flag);
+        dxf_write_double (fp, 43, revolved_surface->draft_angle);
+        dxf_write_double (fp, 44, revolved_surface->start_draft_distance);
+        dxf_write_double (fp, 45, revolved_surface->end_draft_distance);
+        dxf_write_double (fp, 46, revolved_surface->twist_angle);
+        dxf_write_int (fp, 290, revolved_surface->solid_flag);
+        dxf_write_int (fp, 291, revolved_surface->close_to_axis_flag);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -7773,7 +7499,7 @@ dxf_surface_revolved_free
         dxf_point_free (revolved_surface->p1);
         dxf_double_free_list (revolved_surface->transform_matrix);
         dxf_binary_data_free_list (revolved_surface->binary_data);
-        free (revolved_surface);
+        dxf_free (revolved_surface);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -9439,7 +9165,7 @@ dxf_surface_swept_new ()
         size = sizeof (DxfSurfaceSwept);
         /* avoid malloc of 0 bytes */
         if (size == 0) size = 1;
-        if ((swept_surface = malloc (size)) == NULL)
+        if ((swept_surface = dxf_malloc (size)) == NULL)
         {
                 fprintf (stderr,
                   (_("Error in %s () could not allocate memory.\n")),
@@ -9597,7 +9323,8 @@ dxf_surface_swept_read
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        char *temp_string = NULL;
+        char temp_string[DXF_MAX_STRING_LENGTH];
+        int group_code;
         DxfDouble *iter40 = NULL;
         DxfDouble *iter41 = NULL;
         DxfDouble *iter46 = NULL;
@@ -9611,8 +9338,6 @@ dxf_surface_swept_read
                 fprintf (stderr,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
-                /* Clean up. */
-                free (temp_string);
                 return (NULL);
         }
         if (fp->acad_version_number < AutoCAD_2007)
@@ -9634,215 +9359,168 @@ dxf_surface_swept_read
         iter47 = (DxfDouble *) swept_surface->transform_path_matrix2;
         iter90 = 0;
         iter310 = (DxfBinaryData *) swept_surface->sweep_binary_data;
-        (fp->line_number)++;
-        fscanf (fp->fp, "%[^\n]", temp_string);
-        while (strcmp (temp_string, "0") != 0)
+        while ((dxf_read_group_code (fp, &group_code) == EXIT_SUCCESS)
+          && (group_code != 0))
         {
-                if (ferror (fp->fp))
+                if (dxf_read_error (fp))
                 {
                         fprintf (stderr,
                           (_("Error in %s () while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
                         /* Clean up. */
-                        free (temp_string);
-                        fclose (fp->fp);
                         return (NULL);
                 }
-                else if (strcmp (temp_string, "11") == 0)
-                {
-                        /* Now follows a string containing the
-                         * X-coordinate of the reference vector for
-                         * controling twist. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &swept_surface->p1->x0);
-                }
-                else if (strcmp (temp_string, "21") == 0)
-                {
-                        /* Now follows a string containing the
-                         * Y-coordinate of the reference vector for
-                         * controling twist. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &swept_surface->p1->y0);
-                }
-                else if (strcmp (temp_string, "31") == 0)
-                {
-                        /* Now follows a string containing the
-                         * Z-coordinate of the reference vector for
-                         * controling twist. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &swept_surface->p1->z0);
-                }
-                else if (strcmp (temp_string, "40") == 0)
-                {
-                        /* Now follows a string containing the
-                         * transform sweep matrix value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &iter40->value);
-                        iter40->next = (struct DxfDouble *) dxf_double_init ((DxfDouble *) iter40->next);
-                        iter40 = (DxfDouble *) iter40->next;
-                }
-                else if (strcmp (temp_string, "41") == 0)
-                {
-                        /* Now follows a string containing the
-                         * transform path matrix value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &iter41->value);
-                        iter41->next = (struct DxfDouble *) dxf_double_init ((DxfDouble *) iter41->next);
-                        iter41 = (DxfDouble *) iter41->next;
-                }
-                else if (strcmp (temp_string, "42") == 0)
-                {
-                        /* Now follows a string containing the draft
-                         * angle. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &swept_surface->draft_angle);
-                }
-                else if (strcmp (temp_string, "43") == 0)
-                {
-                        /* Now follows a string containing the start
-                         * draft distance. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &swept_surface->start_draft_distance);
-                }
-                else if (strcmp (temp_string, "44") == 0)
-                {
-                        /* Now follows a string containing the end draft
-                         * distance. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &swept_surface->end_draft_distance);
-                }
-                else if (strcmp (temp_string, "45") == 0)
-                {
-                        /* Now follows a string containing the twist
-                         * angle. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &swept_surface->twist_angle);
-                }
-                else if (strcmp (temp_string, "46") == 0)
-                {
-                        /* Now follows a string containing the
-                         * transform sweep matrix 2 value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &iter46->value);
-                        iter46->next = (struct DxfDouble *) dxf_double_init ((DxfDouble *) iter46->next);
-                        iter46 = (DxfDouble *) iter46->next;
-                }
-                else if (strcmp (temp_string, "47") == 0)
-                {
-                        /* Now follows a string containing the
-                         * transform path matrix 2 value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &iter47->value);
-                        iter47->next = (struct DxfDouble *) dxf_double_init ((DxfDouble *) iter47->next);
-                        iter47 = (DxfDouble *) iter47->next;
-                }
-                else if (strcmp (temp_string, "48") == 0)
-                {
-                        /* Now follows a string containing the scale
-                         * factor. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &swept_surface->scale_factor);
-                }
-                else if (strcmp (temp_string, "49") == 0)
+                switch (group_code)
                 {
-                        /* Now follows a string containing the align
-                         * angle. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &swept_surface->align_angle);
-                }
-                else if (strcmp (temp_string, "70") == 0)
-                {
-                        /* Now follows a string containing the sweep
-                         * alignment option number. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%hd\n", &swept_surface->sweep_alignment_option);
-                }
-                else if (strcmp (temp_string, "90") == 0)
-                {
-                        if (iter90 == 0)
-                        {
+                        case 11:
                                 /* Now follows a string containing the
-                                 * ID of the sweep entity. */
-                                (fp->line_number)++;
-                                fscanf (fp->fp, "%" PRIi32 "\n", &swept_surface->sweep_ID);
-                        }
-                        if (iter90 == 1)
-                        {
+                                 * X-coordinate of the reference vector for
+                                 * controling twist. */
+                                dxf_read_double (fp, &swept_surface->p1->x0);
+                                break;
+                        case 21:
                                 /* Now follows a string containing the
-                                 * sweep binary data size. */
-                                (fp->line_number)++;
-                                fscanf (fp->fp, "%" PRIi32 "\n", &swept_surface->sweep_binary_data_size);
-                        }
-                        if (iter90 == 2)
-                        {
+                                 * Y-coordinate of the reference vector for
+                                 * controling twist. */
+                                dxf_read_double (fp, &swept_surface->p1->y0);
+                                break;
+                        case 31:
                                 /* Now follows a string containing the
-                                 * ID of the path entity. */
-                                (fp->line_number)++;
-                                fscanf (fp->fp, "%" PRIi32 "\n", &swept_surface->path_ID);
-                        }
-                        if (iter90 == 3)
-                        {
+                                 * Z-coordinate of the reference vector for
+                                 * controling twist. */
+                                dxf_read_double (fp, &swept_surface->p1->z0);
+                                break;
+                        case 40:
                                 /* Now follows a string containing the
-                                 * path binary data size. */
-                                (fp->line_number)++;
-                                fscanf (fp->fp, "%" PRIi32 "\n", &swept_surface->path_binary_data_size);
-                        }
-                        iter90++;
-                }
-                else if (strcmp (temp_string, "290") == 0)
-                {
-                        /* Now follows a string containing the solid
-                         * flag. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%d\n", &swept_surface->solid_flag);
-                }
-                else if (strcmp (temp_string, "292") == 0)
-                {
-                        /* Now follows a string containing the align
-                         * start flag. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%d\n", &swept_surface->align_start_flag);
-                }
-                else if (strcmp (temp_string, "293") == 0)
-                {
-                        /* Now follows a string containing the bank
-                         * flag. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%d\n", &swept_surface->bank_flag);
-                }
-                else if (strcmp (temp_string, "294") == 0)
-                {
-                        /* Now follows a string containing the base
-                         * point set flag. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%d\n", &swept_surface->base_point_set_flag);
-                }
-                else if (strcmp (temp_string, "295") == 0)
-                {
-                        /* Now follows a string containing the sweep
-                         * transform computed flag. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%d\n", &swept_surface->sweep_transform_computed_flag);
-                }
-                else if (strcmp (temp_string, "296") == 0)
-                {
-                        /* Now follows a string containing the path
-                         * transform completed flag. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%d\n", &swept_surface->path_transform_computed_flag);
-                }
-                else if (strcmp (temp_string, "310") == 0)
-                {
-                        /*! \todo Fix the parsing of binary data. */
-                        /* Now follows a string containing binary data. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, iter310->data_line);
-                        dxf_binary_data_init ((DxfBinaryData *) iter310->next);
-                        iter310 = (DxfBinaryData *) iter310->next;
+                                 * transform sweep matrix value. */
+                                dxf_read_double (fp, &iter40->value);
+                                iter40->next = (struct DxfDouble *) dxf_double_init ((DxfDouble *) iter40->next);
+                                iter40 = (DxfDouble *) iter40->next;
+                                break;
+                        case 41:
+                                /* Now follows a string containing the
+                                 * transform path matrix value. */
+                                dxf_read_double (fp, &iter41->value);
+                                iter41->next = (struct DxfDouble *) dxf_double_init ((DxfDouble *) iter41->next);
+                                iter41 = (DxfDouble *) iter41->next;
+                                break;
+                        case 42:
+                                /* Now follows a string containing the draft
+                                 * angle. */
+                                dxf_read_double (fp, &swept_surface->draft_angle);
+                                break;
+                        case 43:
+                                /* Now follows a string containing the start
+                                 * draft distance. */
+                                dxf_read_double (fp, &swept_surface->start_draft_distance);
+                                break;
+                        case 44:
+                                /* Now follows a string containing the end draft
+                                 * distance. */
+                                dxf_read_double (fp, &swept_surface->end_draft_distance);
+                                break;
+                        case 45:
+                                /* Now follows a string containing the twist
+                                 * angle. */
+                                dxf_read_double (fp, &swept_surface->twist_angle);
+                                break;
+                        case 46:
+                                /* Now follows a string containing the
+                                 * transform sweep matrix 2 value. */
+                                dxf_read_double (fp, &iter46->value);
+                                iter46->next = (struct DxfDouble *) dxf_double_init ((DxfDouble *) iter46->next);
+                                iter46 = (DxfDouble *) iter46->next;
+                                break;
+                        case 47:
+                                /* Now follows a string containing the
+                                 * transform path matrix 2 value. */
+                                dxf_read_double (fp, &iter47->value);
+                                iter47->next = (struct DxfDouble *) dxf_double_init ((DxfDouble *) iter47->next);
+                                iter47 = (DxfDouble *) iter47->next;
+                                break;
+                        case 48:
+                                /* Now follows a string containing the scale
+                                 * factor. */
+                                dxf_read_double (fp, &swept_surface->scale_factor);
+                                break;
+                        case 49:
+                                /* Now follows a string containing the align
+                                 * angle. */
+                                dxf_read_double (fp, &swept_surface->align_angle);
+                                break;
+                        case 70:
+                                /* Now follows a string containing the sweep
+                                 * alignment option number. */
+                                dxf_read_int16 (fp, &swept_surface->sweep_alignment_option);
+                                break;
+                        case 90:
+                                if (iter90 == 0)
+                                {
+                                        /* Now follows a string containing the
+                                         * ID of the sweep entity. */
+                                        dxf_read_int32 (fp, &swept_surface->sweep_ID);
+                                }
+                                if (iter90 == 1)
+                                {
+                                        /* Now follows a string containing the
+                                         * sweep binary data size. */
+                                        dxf_read_int32 (fp, &swept_surface->sweep_binary_data_size);
+                                }
+                                if (iter90 == 2)
+                                {
+                                        /* Now follows a string containing the
+                                         * ID of the path entity. */
+                                        dxf_read_int32 (fp, &swept_surface->path_ID);
+                                }
+                                if (iter90 == 3)
+                                {
+                                        /* Now follows a string containing the
+                                         * path binary data size. */
+                                        dxf_read_int32 (fp, &swept_surface->path_binary_data_size);
+                                }
+                                iter90++;
+                                break;
+                        case 290:
+                                /* Now follows a string containing the solid
+                                 * flag. */
+                                dxf_read_int (fp, &swept_surface->solid_flag);
+                                break;
+                        case 292:
+                                /* Now follows a string containing the align
+                                 * start flag. */
+                                dxf_read_int (fp, &swept_surface->align_start_flag);
+                                break;
+                        case 293:
+                                /* Now follows a string containing the bank
+                                 * flag. */
+                                dxf_read_int (fp, &swept_surface->bank_flag);
+                                break;
+                        case 294:
+                                /* Now follows a string containing the base
+                                 * point set flag. */
+                                dxf_read_int (fp, &swept_surface->base_point_set_flag);
+                                break;
+                        case 295:
+                                /* Now follows a string containing the sweep
+                                 * transform computed flag. */
+                                dxf_read_int (fp, &swept_surface->sweep_transform_computed_flag);
+                                break;
+                        case 296:
+                                /* Now follows a string containing the path
+                                 * transform completed flag. */
+                                dxf_read_int (fp, &swept_surface->path_transform_computed_flag);
+                                break;
+                        case 310:
+                                /*! \todo Fix the parsing of binary data. */
+                                /* Now follows a string containing binary data. */
+                                iter310 = dxf_binary_data_read (fp, iter310);
+                                break;
+                        default:
+                                /* Skip the value of the unknown group code. */
+                                dxf_read_line (temp_string, fp);
+                                break;
                 }
         }
-        /* Clean up. */
-        free (temp_string);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -9882,17 +9560,17 @@ dxf_surface_swept_write
         }
         if (fp->acad_version_number >= AutoCAD_13)
         {
-                fprintf (fp->fp, "100\nAcDbSweptSurface\n");
+                dxf_write_string (fp, 100, "AcDbSweptSurface");
         }
-        fprintf (fp->fp, " 90\n%" PRIi32 "\n", swept_surface->sweep_ID);
-        fprintf (fp->fp, " 90\n%" PRIi32 "\n", swept_surface->sweep_binary_data_size);
+        dxf_write_int (fp, 90, swept_surface->sweep_ID);
+        dxf_write_int (fp, 90, swept_surface->sweep_binary_data_size);
         if (swept_surface->sweep_binary_data != NULL)
         {
                 DxfBinaryData *iter310;
                 iter310 = (DxfBinaryData *) swept_surface->sweep_binary_data;
                 while (iter310 != NULL)
                 {
-                        fprintf (fp->fp, "310\n%s\n", iter310->data_line);
+                        dxf_binary_data_write (fp, iter310);
                         iter310 = (DxfBinaryData *) iter310->next;
                 }
         }
@@ -9945,7 +9623,7 @@ dxf_surface_swept_free
         dxf_double_free_list (swept_surface->transform_path_matrix2);
         dxf_binary_data_free_list (swept_surface->sweep_binary_data);
         dxf_binary_data_free_list (swept_surface->path_binary_data);
-        free (swept_surface);
+        dxf_free (swept_surface);
 #if DEBUG
         DXF_DEBUG_END
 #endif
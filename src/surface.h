@@ -73,7 +73,7 @@ typedef struct
 dxf_surface_struct
 {
         /* Members common for all DXF drawable entities. */
-        int id_code;
+        uint64_t id_code;
                 /*!< Identification number for the entity.\n
                  * This is to be an unique (sequential) number in the DXF
                  * file.\n
@@ -146,20 +146,20 @@ dxf_surface_struct
                  * (optional).\n
                  * Group code = 310.\n
                  * \since Introduced in version R2000. */
-        char *dictionary_owner_soft;
+        uint64_t dictionary_owner_soft;
                 /*!< Soft-pointer ID/handle to owner dictionary (optional).\n
                  * Group code = 330.\n
                  * \since Introduced in version R14. */
-        char *object_owner_soft;
+        uint64_t object_owner_soft;
                 /*!< Soft-pointer ID/handle  to owner BLOCK_RECORD object.\n
                  * Group code = 330.\n
                  * \since Introduced in version R2000. */
-        char *material;
+        uint64_t material;
                 /*!< Hard-pointer ID/handle to material object (present if
                  * not BYLAYER).\n
                  * Group code = 347.\n
                  * \since Introduced in version R2008. */
-        char *dictionary_owner_hard;
+        uint64_t dictionary_owner_hard;
                 /*!< Hard owner ID/handle to owner dictionary (optional).\n
                  * Group code = 360.\n
                  * \since Introduced in version R14. */
@@ -168,7 +168,7 @@ dxf_surface_struct
                  * Stored and moved around as a 16-bit integer.\n
                  * Group code = 370.\n
                  * \since Introduced in version R2002. */
-        char *plot_style_name;
+        uint64_t plot_style_name;
                 /*!< Hard pointer ID / handle of PlotStyleName object.\n
                  * Group code = 390.\n
                  * \since Introduced in version R2009. */
@@ -555,8 +555,8 @@ DxfSurface *dxf_surface_read (DxfFile *fp, DxfSurface *surface);
 int dxf_surface_write (DxfFile *fp, DxfSurface *surface);
 int dxf_surface_free (DxfSurface *surface);
 void dxf_surface_free_list (DxfSurface *surfaces);
-int dxf_surface_get_id_code (DxfSurface *surface);
-DxfSurface *dxf_surface_set_id_code (DxfSurface *surface, int id_code);
+uint64_t dxf_surface_get_id_code (DxfSurface *surface);
+DxfSurface *dxf_surface_set_id_code (DxfSurface *surface, uint64_t id_code);
 char *dxf_surface_get_linetype (DxfSurface *surface);
 DxfSurface *dxf_surface_set_linetype (DxfSurface *surface, char *linetype);
 char *dxf_surface_get_layer (DxfSurface *surface);
@@ -579,17 +579,17 @@ int16_t dxf_surface_get_shadow_mode (DxfSurface *surface);
 DxfSurface *dxf_surface_set_shadow_mode (DxfSurface *surface, int16_t shadow_mode);
 DxfBinaryData *dxf_surface_get_binary_graphics_data (DxfSurface *surface);
 DxfSurface *dxf_surface_set_binary_graphics_data (DxfSurface *surface, DxfBinaryData *data);
-char *dxf_surface_get_dictionary_owner_soft (DxfSurface *surface);
-DxfSurface *dxf_surface_set_dictionary_owner_soft (DxfSurface *surface, char *dictionary_owner_soft);
-char *dxf_surface_get_object_owner_soft (DxfSurface *surface);
-DxfSurface *dxf_surface_set_object_owner_soft (DxfSurface *surface, char *object_owner_soft);
-char *dxf_surface_get_material (DxfSurface *surface);
-DxfSurface *dxf_surface_set_material (DxfSurface *surface, char *material);
-char *dxf_surface_get_dictionary_owner_hard (DxfSurface *surface);
-DxfSurface *dxf_surface_set_dictionary_owner_hard (DxfSurface *surface, char *dictionary_owner_hard);
+uint64_t dxf_surface_get_dictionary_owner_soft (DxfSurface *surface);
+DxfSurface *dxf_surface_set_dictionary_owner_soft (DxfSurface *surface, uint64_t dictionary_owner_soft);
+uint64_t dxf_surface_get_object_owner_soft (DxfSurface *surface);
+DxfSurface *dxf_surface_set_object_owner_soft (DxfSurface *surface, uint64_t object_owner_soft);
+uint64_t dxf_surface_get_material (DxfSurface *surface);
+DxfSurface *dxf_surface_set_material (DxfSurface *surface, uint64_t material);
+uint64_t dxf_surface_get_dictionary_owner_hard (DxfSurface *surface);
+DxfSurface *dxf_surface_set_dictionary_owner_hard (DxfSurface *surface, uint64_t dictionary_owner_hard);
 int16_t dxf_surface_get_lineweight (DxfSurface *surface);
-char *dxf_surface_get_plot_style_name (DxfSurface *surface);
-DxfSurface *dxf_surface_set_plot_style_name (DxfSurface *surface, char *plot_style_name);
+uint64_t dxf_surface_get_plot_style_name (DxfSurface *surface);
+DxfSurface *dxf_surface_set_plot_style_name (DxfSurface *surface, uint64_t plot_style_name);
 int32_t dxf_surface_get_color_value (DxfSurface *surface);
 DxfSurface *dxf_surface_set_color_value (DxfSurface *surface, int32_t color_value);
 char *dxf_surface_get_color_name (DxfSurface *surface);
@@ -45,6 +45,7 @@
 
 
 #include "table.h"
+#include "util.h"
 
 
 /*!
@@ -67,7 +68,7 @@ dxf_table_cell_new ()
         size = sizeof (DxfTableCell);
         /* avoid malloc of 0 bytes */
         if (size == 0) size = 1;
-        if ((cell = malloc (size)) == NULL)
+        if ((cell = dxf_malloc (size)) == NULL)
         {
                 fprintf (stderr,
                   (_("Error in %s () could not allocate memory for a DxfTableCell struct.\n")),
@@ -119,13 +120,13 @@ dxf_table_cell_init
                   __FUNCTION__);
                 return (NULL);
         }
-        cell->text_string = strdup ("");
+        cell->text_string = dxf_strdup ("");
         for (i = 0; i < DXF_MAX_PARAM; i++)
         {
-                cell->optional_text_string[i] = strdup ("");
-                cell->attdef_soft_pointer[i] = strdup ("");
+                cell->optional_text_string[i] = dxf_strdup ("");
+                cell->attdef_soft_pointer[i] = dxf_strdup ("");
         }
-        cell->text_style_name = strdup (DXF_DEFAULT_TEXTSTYLE);
+        cell->text_style_name = dxf_strdup (DXF_DEFAULT_TEXTSTYLE);
         cell->color_bg = 0;
         cell->color_fg = DXF_COLOR_BYLAYER;
         cell->border_color_right = DXF_COLOR_BYLAYER;
@@ -154,9 +155,9 @@ dxf_table_cell_init
         cell->border_visibility_override_bottom = 0;
         cell->border_visibility_override_left = 0;
         cell->border_visibility_override_top = 0;
-        cell->attdef_text_string = strdup ("");
-        cell->block_table_record_hard_pointer = strdup ("");
-        cell->field_object_pointer = strdup ("");
+        cell->attdef_text_string = dxf_strdup ("");
+        cell->block_table_record_hard_pointer = dxf_strdup ("");
+        cell->field_object_pointer = dxf_strdup ("");
         cell->next = NULL;
 #if DEBUG
         DXF_DEBUG_END
@@ -201,32 +202,32 @@ dxf_table_cell_write
                 return (EXIT_FAILURE);
         }
         /* Start writing output. */
-        fprintf (fp->fp, "171\n%d\n", cell->type);
-        fprintf (fp->fp, "172\n%d\n", cell->flag);
-        fprintf (fp->fp, "173\n%d\n", cell->merged);
-        fprintf (fp->fp, "174\n%d\n", cell->autofit);
-        fprintf (fp->fp, "175\n%lf\n", cell->border_width);
-        fprintf (fp->fp, "176\n%lf\n", cell->border_height);
-        fprintf (fp->fp, " 91\n%d\n", cell->override_flag);
-        fprintf (fp->fp, "178\n%d\n", cell->virtual_edge);
-        fprintf (fp->fp, "145\n%lf\n", cell->block_rotation);
-        fprintf (fp->fp, "344\n%s\n", cell->field_object_pointer);
+        dxf_write_int (fp, 171, cell->type);
+        dxf_write_int (fp, 172, cell->flag);
+        dxf_write_int (fp, 173, cell->merged);
+        dxf_write_int (fp, 174, cell->autofit);
+        dxf_write_double (fp, 175, cell->border_width);
+        dxf_write_double (fp, 176, cell->border_height);
+        dxf_write_int (fp, 91, cell->override_flag);
+        dxf_write_int (fp, 178, cell->virtual_edge);
+        dxf_write_double (fp, 145, cell->block_rotation);
+        dxf_write_string (fp, 344, cell->field_object_pointer);
         i = 0;
         while ((cell->optional_text_string[i] != NULL)
           && (strcmp (cell->optional_text_string[i], "") != 0))
         {
-                fprintf (fp->fp, "  2\n%s\n", cell->optional_text_string[i]);
+                dxf_write_string (fp, 2, cell->optional_text_string[i]);
                 i++;
         }
-        fprintf (fp->fp, "  1\n%s\n", cell->text_string);
-        fprintf (fp->fp, "340\n%s\n", cell->block_table_record_hard_pointer);
-        fprintf (fp->fp, "144\n%lf\n", cell->block_scale);
-        fprintf (fp->fp, "179\n%d\n", cell->number_of_block_attdefs);
+        dxf_write_string (fp, 1, cell->text_string);
+        dxf_write_string (fp, 340, cell->block_table_record_hard_pointer);
+        dxf_write_double (fp, 144, cell->block_scale);
+        dxf_write_int (fp, 179, cell->number_of_block_attdefs);
         i = 0;
         while ((cell->attdef_soft_pointer[i] != NULL)
           && (strcmp (cell->attdef_soft_pointer[i], "") != 0))
         {
-                fprintf (fp->fp, "331\n%s\n", cell->attdef_soft_pointer[i]);
+                dxf_write_string (fp, 331, cell->attdef_soft_pointer[i]);
                 i++;
         }
         if (cell->number_of_block_attdefs < (i + 1))
@@ -283,17 +284,17 @@ dxf_table_cell_free
                 __FUNCTION__);
               return (EXIT_FAILURE);
         }
-        free (cell->text_string);
+        dxf_free (cell->text_string);
         for (i = 0; i < DXF_MAX_PARAM; i++)
         {
-                free (cell->optional_text_string[i]);
-                free (cell->attdef_soft_pointer[i]);
+                dxf_free (cell->optional_text_string[i]);
+                dxf_free (cell->attdef_soft_pointer[i]);
         }
-        free (cell->text_style_name);
-        free (cell->attdef_text_string);
-        free (cell->block_table_record_hard_pointer);
-        free (cell->field_object_pointer);
-        free (cell);
+        dxf_free (cell->text_style_name);
+        dxf_free (cell->attdef_text_string);
+        dxf_free (cell->block_table_record_hard_pointer);
+        dxf_free (cell->field_object_pointer);
+        dxf_free (cell);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -483,7 +484,7 @@ dxf_table_new ()
         size = sizeof (DxfTable);
         /* avoid malloc of 0 bytes */
         if (size == 0) size = 1;
-        if ((table = malloc (size)) == NULL)
+        if ((table = dxf_malloc (size)) == NULL)
         {
                 fprintf (stderr,
                   (_("Error in %s () could not allocate memory for a DxfTable struct.\n")),
@@ -534,9 +535,9 @@ dxf_table_init
                 return (NULL);
         }
         /* Assign initial values to members. */
-        table->id_code = 0;
-        table->linetype = strdup (DXF_DEFAULT_LINETYPE);
-        table->layer = strdup (DXF_DEFAULT_LAYER);
+        table->id_code = DXF_HANDLE_NONE;
+        table->linetype = dxf_strdup (DXF_DEFAULT_LINETYPE);
+        table->layer = dxf_strdup (DXF_DEFAULT_LAYER);
         table->elevation = 0.0;
         table->thickness = 0.0;
         table->visibility = 0;
@@ -545,10 +546,10 @@ dxf_table_init
         table->graphics_data_size = 0;
         table->row_height = 0.0;
         table->column_height = 0.0;
-        table->dictionary_owner_soft = strdup ("");
-        table->dictionary_owner_hard = strdup ("");
-        table->block_name = strdup ("");
-        table->table_text_style_name = strdup ("");
+        table->dictionary_owner_soft = 0;
+        table->dictionary_owner_hard = 0;
+        table->block_name = dxf_strdup ("");
+        table->table_text_style_name = dxf_strdup ("");
         table->horizontal_cell_margin = 0.0;
         table->vertical_cell_margin = 0.0;
         table->table_cell_color_bg = 0;
@@ -571,8 +572,8 @@ dxf_table_init
         table->suppress_table_title = 0;
         table->suppress_header_row = 0;
         table->table_cell_color_fill_override = 0;
-        table->tablestyle_object_pointer = strdup ("");
-        table->owning_block_pointer = strdup ("");
+        table->tablestyle_object_pointer = dxf_strdup ("");
+        table->owning_block_pointer = dxf_strdup ("");
         /* Initialize new structs for the following members later,
          * when they are required and when we have content. */
         table->binary_graphics_data = NULL;
@@ -610,7 +611,8 @@ dxf_table_read
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        char *temp_string = NULL;
+        char temp_string[DXF_MAX_STRING_LENGTH];
+        int group_code;
         DxfBinaryData *iter310 = NULL;
         int i;
         int k;
@@ -622,8 +624,6 @@ dxf_table_read
                 fprintf (stderr,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
-                /* Clean up. */
-                free (temp_string);
                 return (NULL);
         }
         if (table == NULL)
@@ -686,222 +686,189 @@ dxf_table_read
         k = 0;
         l = 0;
         iter310 = (DxfBinaryData *) table->binary_graphics_data;
-        (fp->line_number)++;
-        fscanf (fp->fp, "%[^\n]", temp_string);
-        while (strcmp (temp_string, "0") != 0)
+        while ((dxf_read_group_code (fp, &group_code) == EXIT_SUCCESS)
+          && (group_code != 0))
         {
-                if (ferror (fp->fp))
+                if (dxf_read_error (fp))
                 {
                         fprintf (stderr,
                           (_("Error in %s () while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
-                        fclose (fp->fp);
-                        /* Clean up. */
-                        free (temp_string);
                         return (NULL);
                 }
-                else if (strcmp (temp_string, "2") == 0)
-                {
-                        /* Now follows a string containing a block name;
-                         * an anonymous block begins with a *T value. */
-                        fscanf (fp->fp, "%s\n", table->block_name);
-                }
-                if (strcmp (temp_string, "5") == 0)
-                {
-                        /* Now follows a string containing a sequential
-                         * id number. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%x\n", (uint *) &table->id_code);
-                }
-                else if (strcmp (temp_string, "10") == 0)
-                {
-                        /* Now follows a string containing the
-                         * X-coordinate of the insertion point. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &table->p0->x0);
-                }
-                else if (strcmp (temp_string, "11") == 0)
-                {
-                        /* Now follows a string containing the
-                         * X-coordinate of the horizontal direction
-                         * vector. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &table->p1->x0);
-                }
-                else if (strcmp (temp_string, "20") == 0)
-                {
-                        /* Now follows a string containing the
-                         * Y-coordinate of the insertion point. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &table->p0->y0);
-                }
-                else if (strcmp (temp_string, "21") == 0)
-                {
-                        /* Now follows a string containing the
-                         * Y-coordinate of the horizontal direction
-                         * vector. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &table->p1->y0);
-                }
-                else if (strcmp (temp_string, "30") == 0)
-                {
-                        /* Now follows a string containing the
-                         * Z-coordinate of the insertion point. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &table->p0->z0);
-                }
-                else if (strcmp (temp_string, "31") == 0)
-                {
-                        /* Now follows a string containing the
-                         * Z-coordinate of the horizontal direction
-                         * vector. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &table->p1->z0);
-                }
-                else if (strcmp (temp_string, "90") == 0)
-                {
-                        /* Now follows a string containing the flag for
-                         * table value (unsigned integer). */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%d\n", &table->table_value_flag);
-                }
-                else if (strcmp (temp_string, "91") == 0)
+                switch (group_code)
                 {
-                        /* Now follows a string containing the number of
-                         * rows. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%d\n", &table->number_of_rows);
-                }
-                else if ((strcmp (temp_string, "92") == 0)
-                  && (i == 0))
-                {
-                        /* Now follows a string containing the
-                         * number of bytes in the proxy entity graphics. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%d\n", &table->graphics_data_size);
-                        i++;
-                }
-                else if ((strcmp (temp_string, "92") == 0)
-                  && (i == 1))
-                {
-                        /* Now follows a string containing the number of
-                         * columns. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%d\n", &table->number_of_columns);
-                }
-                else if (strcmp (temp_string, "93") == 0)
-                {
-                        /* Now follows a string containing the flag for
-                         * an override. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%d\n", &table->override_flag);
-                }
-                else if (strcmp (temp_string, "94") == 0)
-                {
-                        /* Now follows a string containing the flag for
-                         * an override of the border color. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%d\n", &table->border_color_override_flag);
-                }
-                else if (strcmp (temp_string, "95") == 0)
-                {
-                        /* Now follows a string containing the flag for
-                         * an override of the border lineweight. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%d\n", &table->border_lineweight_override_flag);
-                }
-                else if (strcmp (temp_string, "96") == 0)
-                {
-                        /* Now follows a string containing the flag for
-                         * an override of the border visibility. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%d\n", &table->border_visibility_override_flag);
-                }
-                else if ((fp->acad_version_number >= AutoCAD_13)
-                        && (strcmp (temp_string, "100") == 0))
-                {
-                        /* Now follows a string containing the
-                         * subclass marker value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", temp_string);
-                        if ((strcmp (temp_string, "AcDbEntity") != 0)
-                        && ((strcmp (temp_string, "AcDbBlockReference") != 0))
-                        && ((strcmp (temp_string, "AcDbBlockTable") != 0)))
-                        {
+                        case 2:
+                                /* Now follows a string containing a block name;
+                                 * an anonymous block begins with a *T value. */
+                                dxf_read_string (fp, &table->block_name);
+                                break;
+                        case 5:
+                                /* Now follows a string containing a sequential
+                                 * id number. */
+                                dxf_read_handle (fp, &table->id_code);
+                                break;
+                        case 10:
+                                /* Now follows a string containing the
+                                 * X-coordinate of the insertion point. */
+                                dxf_read_double (fp, &table->p0->x0);
+                                break;
+                        case 11:
+                                /* Now follows a string containing the
+                                 * X-coordinate of the horizontal direction
+                                 * vector. */
+                                dxf_read_double (fp, &table->p1->x0);
+                                break;
+                        case 20:
+                                /* Now follows a string containing the
+                                 * Y-coordinate of the insertion point. */
+                                dxf_read_double (fp, &table->p0->y0);
+                                break;
+                        case 21:
+                                /* Now follows a string containing the
+                                 * Y-coordinate of the horizontal direction
+                                 * vector. */
+                                dxf_read_double (fp, &table->p1->y0);
+                                break;
+                        case 30:
+                                /* Now follows a string containing the
+                                 * Z-coordinate of the insertion point. */
+                                dxf_read_double (fp, &table->p0->z0);
+                                break;
+                        case 31:
+                                /* Now follows a string containing the
+                                 * Z-coordinate of the horizontal direction
+                                 * vector. */
+                                dxf_read_double (fp, &table->p1->z0);
+                                break;
+                        case 90:
+                                /* Now follows a string containing the flag for
+                                 * table value (unsigned integer). */
+                                dxf_read_int (fp, &table->table_value_flag);
+                                break;
+                        case 91:
+                                /* Now follows a string containing the number of
+                                 * rows. */
+                                dxf_read_int (fp, &table->number_of_rows);
+                                break;
+                        case 92:
+                                if (i == 0)
+                                {
+                                        /* Now follows a string containing the
+                                         * number of bytes in the proxy entity graphics. */
+                                        dxf_read_int (fp, &table->graphics_data_size);
+                                        i++;
+                                }
+                                else if (i == 1)
+                                {
+                                        /* Now follows a string containing the number of
+                                         * columns. */
+                                        dxf_read_int (fp, &table->number_of_columns);
+                                }
+                                else
+                                {
+                                        fprintf (stderr,
+                                          (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
+                                          __FUNCTION__, fp->filename, fp->line_number);
+                                        /* Skip the value of the unknown group code. */
+                                        dxf_read_line (temp_string, fp);
+                                }
+                                break;
+                        case 93:
+                                /* Now follows a string containing the flag for
+                                 * an override. */
+                                dxf_read_int (fp, &table->override_flag);
+                                break;
+                        case 94:
+                                /* Now follows a string containing the flag for
+                                 * an override of the border color. */
+                                dxf_read_int (fp, &table->border_color_override_flag);
+                                break;
+                        case 95:
+                                /* Now follows a string containing the flag for
+                                 * an override of the border lineweight. */
+                                dxf_read_int (fp, &table->border_lineweight_override_flag);
+                                break;
+                        case 96:
+                                /* Now follows a string containing the flag for
+                                 * an override of the border visibility. */
+                                dxf_read_int (fp, &table->border_visibility_override_flag);
+                                break;
+                        case 100:
+                                if (fp->acad_version_number >= AutoCAD_13)
+                                {
+                                        /* Now follows a string containing the
+                                         * subclass marker value. */
+                                        dxf_read_line (temp_string, fp);
+                                        if ((strcmp (temp_string, "AcDbEntity") != 0)
+                                        && ((strcmp (temp_string, "AcDbBlockReference") != 0))
+                                        && ((strcmp (temp_string, "AcDbBlockTable") != 0)))
+                                        {
+                                                fprintf (stderr,
+                                                  (_("Warning in %s () found a bad subclass marker in: %s in line: %d.\n")),
+                                                  __FUNCTION__, fp->filename, fp->line_number);
+                                        }
+                                }
+                                else
+                                {
+                                        fprintf (stderr,
+                                          (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
+                                          __FUNCTION__, fp->filename, fp->line_number);
+                                        /* Skip the value of the unknown group code. */
+                                        dxf_read_line (temp_string, fp);
+                                }
+                                break;
+                        case 141:
+                                /* Now follows a string containing the row
+                                 * height. */
+                                dxf_read_double (fp, &table->row_height);
+                                k++;
+                                break;
+                        case 142:
+                                /* Now follows a string containing the column
+                                 * height. */
+                                dxf_read_double (fp, &table->column_height);
+                                l++;
+                                break;
+                        case 310:
+                                /* Now follows a string containing binary
+                                 * graphics data. */
+                                iter310 = dxf_binary_data_read (fp, iter310);
+                                break;
+                        case 330:
+                                /* Now follows a string containing a soft-pointer
+                                 * ID/handle to owner dictionary. */
+                                dxf_read_handle (fp, &table->dictionary_owner_soft);
+                                break;
+                        case 342:
+                                /* Now follows a string containing a hard pointer
+                                 * ID of the TABLESTYLE object. */
+                                dxf_read_string (fp, &table->tablestyle_object_pointer);
+                                break;
+                        case 343:
+                                /* Now follows a string containing a hard pointer
+                                 * ID of the owning BLOCK record. */
+                                dxf_read_string (fp, &table->owning_block_pointer);
+                                break;
+                        case 360:
+                                /* Now follows a string containing a hard owner
+                                 * ID/handle to owner dictionary. */
+                                dxf_read_handle (fp, &table->dictionary_owner_hard);
+                                break;
+                        case 999:
+                                /* Now follows a string containing a comment. */
+                                dxf_read_line (temp_string, fp);
+                                fprintf (stdout, "DXF comment: %s\n", temp_string);
+                                break;
+                        default:
                                 fprintf (stderr,
-                                  (_("Warning in %s () found a bad subclass marker in: %s in line: %d.\n")),
+                                  (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
                                   __FUNCTION__, fp->filename, fp->line_number);
-                        }
-                }
-                else if (strcmp (temp_string, "141") == 0)
-                {
-                        /* Now follows a string containing the row
-                         * height. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &table->row_height);
-                        k++;
-                }
-                else if (strcmp (temp_string, "142") == 0)
-                {
-                        /* Now follows a string containing the column
-                         * height. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &table->column_height);
-                        l++;
-                }
-                else if (strcmp (temp_string, "310") == 0)
-                {
-                        /* Now follows a string containing binary
-                         * graphics data. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, iter310->data_line);
-                        dxf_binary_data_init ((DxfBinaryData *) iter310->next);
-                        iter310 = (DxfBinaryData *) iter310->next;
-                }
-                else if (strcmp (temp_string, "330") == 0)
-                {
-                        /* Now follows a string containing a soft-pointer
-                         * ID/handle to owner dictionary. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", table->dictionary_owner_soft);
-                }
-                else if (strcmp (temp_string, "342") == 0)
-                {
-                        /* Now follows a string containing a hard pointer
-                         * ID of the TABLESTYLE object. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", table->tablestyle_object_pointer);
-                }
-                else if (strcmp (temp_string, "343") == 0)
-                {
-                        /* Now follows a string containing a hard pointer
-                         * ID of the owning BLOCK record. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", table->owning_block_pointer);
-                }
-                else if (strcmp (temp_string, "360") == 0)
-                {
-                        /* Now follows a string containing a hard owner
-                         * ID/handle to owner dictionary. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", table->dictionary_owner_hard);
-                }
-                else if (strcmp (temp_string, "999") == 0)
-                {
-                        /* Now follows a string containing a comment. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", temp_string);
-                        fprintf (stdout, "DXF comment: %s\n", temp_string);
-                }
-                else
-                {
-                        fprintf (stderr,
-                          (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
-                          __FUNCTION__, fp->filename, fp->line_number);
+                                /* Skip the value of the unknown group code. */
+                                dxf_read_line (temp_string, fp);
+                                break;
                 }
         }
-        /* Clean up. */
-        free (temp_string);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -927,7 +894,7 @@ dxf_table_write
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        char *dxf_entity_name = strdup ("ACAD_TABLE");
+        char *dxf_entity_name = dxf_strdup ("ACAD_TABLE");
         int i;
 
         /* Do some basic checks. */
@@ -944,7 +911,7 @@ dxf_table_write
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (table == NULL)
@@ -953,7 +920,7 @@ dxf_table_write
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (table->layer == NULL)
@@ -963,7 +930,7 @@ dxf_table_write
                   __FUNCTION__);
                 fprintf (stderr,
                   (_("\tSetting entity to default layer.\n")));
-                table->layer = strdup (DXF_DEFAULT_LAYER);
+                table->layer = dxf_strdup (DXF_DEFAULT_LAYER);
         }
         if (table->linetype == NULL)
         {
@@ -972,31 +939,25 @@ dxf_table_write
                   __FUNCTION__);
                 fprintf (stderr,
                   (_("\tSetting entity to default linetype.\n")));
-                table->layer = strdup (DXF_DEFAULT_LINETYPE);
+                table->layer = dxf_strdup (DXF_DEFAULT_LINETYPE);
         }
         /* Start writing output. */
-        fprintf (fp->fp, "  0\n%s\n", dxf_entity_name);
-        if (table->id_code != -1)
+        dxf_write_string (fp, 0, dxf_entity_name);
+        if (table->id_code != DXF_HANDLE_NONE)
         {
-                fprintf (fp->fp, "  5\n%x\n", table->id_code);
+                dxf_write_hex (fp, 5, table->id_code);
         }
-        if (table->dictionary_owner_soft == NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-        }
-        else fprintf (fp->fp, "330\n%s\n", table->dictionary_owner_soft);
+        dxf_write_hex (fp, 330, table->dictionary_owner_soft);
         if (fp->acad_version_number >= AutoCAD_13)
         {
-                fprintf (fp->fp, "100\nAcDbEntity\n");
+                dxf_write_string (fp, 100, "AcDbEntity");
         }
         if (fp->acad_version_number >= AutoCAD_2000)
         {
 #ifdef BUILD_64
-                fprintf (fp->fp, "160\n%" PRIi32 "\n", table->graphics_data_size);
+                dxf_write_int (fp, 160, table->graphics_data_size);
 #else
-                fprintf (fp->fp, " 92\n%" PRIi32 "\n", table->graphics_data_size);
+                dxf_write_int (fp, 92, table->graphics_data_size);
 #endif
         }
         if (table->binary_graphics_data == NULL)
@@ -1011,13 +972,13 @@ dxf_table_write
                 iter = (DxfBinaryData *) table->binary_graphics_data;
                 while (iter != NULL)
                 {
-                        fprintf (fp->fp, "310\n%s\n", iter->data_line);
+                        dxf_binary_data_write (fp, iter);
                         iter = (DxfBinaryData *) iter->next;
                 }
         }
         if (fp->acad_version_number >= AutoCAD_13)
         {
-                fprintf (fp->fp, "100\nAcDbBlockReference\n");
+                dxf_write_string (fp, 100, "AcDbBlockReference");
         }
         if (table->block_name == NULL)
         {
@@ -1025,52 +986,52 @@ dxf_table_write
                   (_("Error in %s () a NULL pointer was found.\n")),
                   __FUNCTION__);
         }
-        else fprintf (fp->fp, "  2\n%s\n", table->block_name);
-        fprintf (fp->fp, " 10\n%f\n", table->p0->x0);
-        fprintf (fp->fp, " 20\n%f\n", table->p0->y0);
-        fprintf (fp->fp, " 30\n%f\n", table->p0->z0);
+        else dxf_write_string (fp, 2, table->block_name);
+        dxf_write_double (fp, 10, table->p0->x0);
+        dxf_write_double (fp, 20, table->p0->y0);
+        dxf_write_double (fp, 30, table->p0->z0);
         if (fp->acad_version_number >= AutoCAD_13)
         {
-                fprintf (fp->fp, "100\nAcDbTable\n");
+                dxf_write_string (fp, 100, "AcDbTable");
         }
-        fprintf (fp->fp, "280\n%d\n", table->table_data_version);
+        dxf_write_int (fp, 280, table->table_data_version);
         if (table->tablestyle_object_pointer == NULL)
         {
                 fprintf (stderr,
                   (_("Error in %s () a NULL pointer was found.\n")),
                   __FUNCTION__);
         }
-        else fprintf (fp->fp, "342\n%s\n", table->tablestyle_object_pointer);
+        else dxf_write_string (fp, 342, table->tablestyle_object_pointer);
         if (table->owning_block_pointer == NULL)
         {
                 fprintf (stderr,
                   (_("Error in %s () a NULL pointer was found.\n")),
                   __FUNCTION__);
         }
-        else fprintf (fp->fp, "343\n%s\n", table->owning_block_pointer);
-        fprintf (fp->fp, " 11\n%f\n", table->p1->x0);
-        fprintf (fp->fp, " 21\n%f\n", table->p1->y0);
-        fprintf (fp->fp, " 31\n%f\n", table->p1->z0);
-        fprintf (fp->fp, " 90\n%d\n", table->table_value_flag);
-        fprintf (fp->fp, " 91\n%d\n", table->number_of_rows);
-        fprintf (fp->fp, " 92\n%d\n", table->number_of_columns);
-        fprintf (fp->fp, " 93\n%d\n", table->override_flag);
-        fprintf (fp->fp, " 94\n%d\n", table->border_color_override_flag);
-        fprintf (fp->fp, " 95\n%d\n", table->border_lineweight_override_flag);
-        fprintf (fp->fp, " 96\n%d\n", table->border_visibility_override_flag);
+        else dxf_write_string (fp, 343, table->owning_block_pointer);
+        dxf_write_double (fp, 11, table->p1->x0);
+        dxf_write_double (fp, 21, table->p1->y0);
+        dxf_write_double (fp, 31, table->p1->z0);
+        dxf_write_int (fp, 90, table->table_value_flag);
+        dxf_write_int (fp, 91, table->number_of_rows);
+        dxf_write_int (fp, 92, table->number_of_columns);
+        dxf_write_int (fp, 93, table->override_flag);
+        dxf_write_int (fp, 94, table->border_color_override_flag);
+        dxf_write_int (fp, 95, table->border_lineweight_override_flag);
+        dxf_write_int (fp, 96, table->border_visibility_override_flag);
         /*! \todo implement a linked list of dxf_doubles. */
         for (i = 0; i < table->number_of_rows; i++)
         {
-                fprintf (fp->fp, "141\n%f\n", table->row_height);
+                dxf_write_double (fp, 141, table->row_height);
         }
         /*! \todo implemnet a linked list of doubles. */
         for (i = 0; i < table->number_of_columns; i++)
         {
-                fprintf (fp->fp, "142\n%f\n", table->column_height);
+                dxf_write_double (fp, 142, table->column_height);
         }
 
         /* Clean up. */
-        free (dxf_entity_name);
+        dxf_free (dxf_entity_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1110,19 +1071,17 @@ dxf_table_free
                 __FUNCTION__);
               return (EXIT_FAILURE);
         }
-        free (table->linetype);
-        free (table->layer);
+        dxf_string_free (table->linetype);
+        dxf_string_free (table->layer);
         dxf_binary_data_free_list (table->binary_graphics_data);
-        free (table->dictionary_owner_soft);
-        free (table->dictionary_owner_hard);
-        free (table->block_name);
-        free (table->table_text_style_name);
+        dxf_free (table->block_name);
+        dxf_free (table->table_text_style_name);
         dxf_point_free_list ((DxfPoint *) table->p0);
         dxf_point_free_list ((DxfPoint *) table->p1);
-        free (table->tablestyle_object_pointer);
-        free (table->owning_block_pointer);
+        dxf_free (table->tablestyle_object_pointer);
+        dxf_free (table->owning_block_pointer);
         dxf_table_cell_free_list ((DxfTableCell *) table->cells);
-        free (table);
+        dxf_free (table);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1169,7 +1128,7 @@ dxf_table_free_list
  *
  * \return \c id_code, or \c EXIT_FAILURE when an error occurred.
  */
-int
+uint64_t
 dxf_table_get_id_code
 (
         DxfTable *table
@@ -1187,12 +1146,6 @@ dxf_table_get_id_code
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (table->id_code < 0)
-        {
-                fprintf (stderr,
-                  (_("Warning in %s () a negative value was found.\n")),
-                  __FUNCTION__);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1211,7 +1164,7 @@ dxf_table_set_id_code
 (
         DxfTable *table,
                 /*!< a pointer to a DXF \c TABLE entity. */
-        int id_code
+        uint64_t id_code
                 /*!< Identification number for the entity.\n
                  * This is to be an unique (sequential) number in the DXF
                  * file. */
@@ -1228,12 +1181,6 @@ dxf_table_set_id_code
                   __FUNCTION__);
                 return (NULL);
         }
-        if (id_code < 0)
-        {
-                fprintf (stderr,
-                  (_("Warning in %s () a negative value was passed.\n")),
-                  __FUNCTION__);
-        }
         table->id_code = id_code;
 #if DEBUG
         DXF_DEBUG_END
@@ -1276,7 +1223,7 @@ dxf_table_get_linetype
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (table->linetype));
+        return (dxf_strdup (table->linetype));
 }
 
 
@@ -1316,7 +1263,7 @@ dxf_table_set_linetype
                   __FUNCTION__);
                 return (NULL);
         }
-        table->linetype = strdup (linetype);
+        table->linetype = dxf_strdup (linetype);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1358,7 +1305,7 @@ dxf_table_get_layer
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (table->layer));
+        return (dxf_strdup (table->layer));
 }
 
 
@@ -1397,7 +1344,7 @@ dxf_table_set_layer
                   __FUNCTION__);
                 return (NULL);
         }
-        table->layer = strdup (layer);
+        table->layer = dxf_strdup (layer);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2149,12 +2096,10 @@ dxf_table_set_binary_graphics_data
  * \brief Get the soft pointer to the \c dictionary_owner_soft from a
  * DXF \c TABLE entity.
  *
- * \return a pointer to the \c dictionary_owner_soft if successful, or
- * \c NULL when an error occurred.
- *
- * \warning No checks are performed on the returned pointer.
+ * \return the handle of the \c dictionary_owner_soft if successful, or
+ * 0 when an error occurred.
  */
-char *
+uint64_t
 dxf_table_get_dictionary_owner_soft
 (
         DxfTable *table
@@ -2170,19 +2115,12 @@ dxf_table_get_dictionary_owner_soft
                 fprintf (stderr,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
-                return (NULL);
-        }
-        if (table->dictionary_owner_soft ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
+                return (0);
         }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (table->dictionary_owner_soft));
+        return (table->dictionary_owner_soft);
 }
 
 
@@ -2198,8 +2136,8 @@ dxf_table_set_dictionary_owner_soft
 (
         DxfTable *table,
                 /*!< a pointer to a DXF \c TABLE entity. */
-        char *dictionary_owner_soft
-                /*!< a string containing the pointer to the
+        uint64_t dictionary_owner_soft
+                /*!< the handle of the
                  * \c dictionary_owner_soft for the entity. */
 )
 {
@@ -2214,14 +2152,7 @@ dxf_table_set_dictionary_owner_soft
                   __FUNCTION__);
                 return (NULL);
         }
-        if (dictionary_owner_soft == NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was passed.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
-        table->dictionary_owner_soft = strdup (dictionary_owner_soft);
+        table->dictionary_owner_soft = dictionary_owner_soft;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2233,12 +2164,10 @@ dxf_table_set_dictionary_owner_soft
  * \brief Get the soft pointer to the object owner from a DXF 
  * \c TABLE entity.
  *
- * \return a pointer to \c object_owner_soft if successful, or \c NULL
+ * \return the handle \c object_owner_soft if successful, or 0
  * when an error occurred.
- *
- * \warning No checks are performed on the returned pointer (string).
  */
-char *
+uint64_t
 dxf_table_get_object_owner_soft
 (
         DxfTable *table
@@ -2254,19 +2183,12 @@ dxf_table_get_object_owner_soft
                 fprintf (stderr,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
-                return (NULL);
-        }
-        if (table->object_owner_soft ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
+                return (0);
         }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (table->object_owner_soft));
+        return (table->object_owner_soft);
 }
 
 
@@ -2282,8 +2204,8 @@ dxf_table_set_object_owner_soft
 (
         DxfTable *table,
                 /*!< a pointer to a DXF \c TABLE entity. */
-        char *object_owner_soft
-                /*!< a string containing the pointer to the
+        uint64_t object_owner_soft
+                /*!< the handle of the
                  * \c object_owner_soft for the entity. */
 )
 {
@@ -2298,14 +2220,7 @@ dxf_table_set_object_owner_soft
                   __FUNCTION__);
                 return (NULL);
         }
-        if (object_owner_soft == NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was passed.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
-        table->object_owner_soft = strdup (object_owner_soft);
+        table->object_owner_soft = object_owner_soft;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2316,12 +2231,10 @@ dxf_table_set_object_owner_soft
 /*!
  * \brief Get the pointer to the \c material from a DXF \c TABLE entity.
  *
- * \return a pointer to \c material when successful, or \c NULL when an
+ * \return the handle \c material when successful, or 0 when an
  * error occurred.
- *
- * \warning No checks are performed on the returned pointer.
  */
-char *
+uint64_t
 dxf_table_get_material
 (
         DxfTable *table
@@ -2337,19 +2250,12 @@ dxf_table_get_material
                 fprintf (stderr,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
-                return (NULL);
-        }
-        if (table->material ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
+                return (0);
         }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (table->material));
+        return (table->material);
 }
 
 
@@ -2364,8 +2270,8 @@ dxf_table_set_material
 (
         DxfTable *table,
                 /*!< a pointer to a DXF \c TABLE entity. */
-        char *material
-                /*!< a string containing the pointer to the \c
+        uint64_t material
+                /*!< the handle of the \c
                  * material for the entity. */
 )
 {
@@ -2380,14 +2286,7 @@ dxf_table_set_material
                   __FUNCTION__);
                 return (NULL);
         }
-        if (material == NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was passed.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
-        table->material = strdup (material);
+        table->material = material;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2399,12 +2298,10 @@ dxf_table_set_material
  * \brief Get the pointer to the \c dictionary_owner_hard from a DXF 
  * \c TABLE entity.
  *
- * \return a pointer to the \c dictionary_owner_hard when successful,
- * or \c NULL if an error occurred.
- *
- * \warning No checks are performed on the returned pointer.
+ * \return the handle of the \c dictionary_owner_hard when successful,
+ * or 0 if an error occurred.
  */
-char *
+uint64_t
 dxf_table_get_dictionary_owner_hard
 (
         DxfTable *table
@@ -2420,19 +2317,12 @@ dxf_table_get_dictionary_owner_hard
                 fprintf (stderr,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
-                return (NULL);
-        }
-        if (table->dictionary_owner_hard ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
+                return (0);
         }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (table->dictionary_owner_hard));
+        return (table->dictionary_owner_hard);
 }
 
 
@@ -2448,8 +2338,8 @@ dxf_table_set_dictionary_owner_hard
 (
         DxfTable *table,
                 /*!< a pointer to a DXF \c TABLE entity. */
-        char *dictionary_owner_hard
-                /*!< a string containing the pointer to the \c
+        uint64_t dictionary_owner_hard
+                /*!< the handle of the \c
                  * dictionary_owner_hard for the entity. */
 )
 {
@@ -2464,14 +2354,7 @@ dxf_table_set_dictionary_owner_hard
                   __FUNCTION__);
                 return (NULL);
         }
-        if (dictionary_owner_hard == NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was passed.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
-        table->dictionary_owner_hard = strdup (dictionary_owner_hard);
+        table->dictionary_owner_hard = dictionary_owner_hard;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2547,10 +2430,10 @@ dxf_table_set_lineweight
 /*!
  * \brief Get the \c plot_style_name from a DXF \c TABLE entity.
  *
- * \return a pointer to \c plot_style_name when sucessful, or \c NULL
+ * \return the handle \c plot_style_name when sucessful, or 0
  * when an error occurred.
  */
-char *
+uint64_t
 dxf_table_get_plot_style_name
 (
         DxfTable *table
@@ -2566,19 +2449,12 @@ dxf_table_get_plot_style_name
                 fprintf (stderr,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
-                return (NULL);
-        }
-        if (table->plot_style_name ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
+                return (0);
         }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (table->plot_style_name));
+        return (table->plot_style_name);
 }
 
 
@@ -2593,7 +2469,7 @@ dxf_table_set_plot_style_name
 (
         DxfTable *table,
                 /*!< a pointer to a DXF \c TABLE entity. */
-        char *plot_style_name
+        uint64_t plot_style_name
                 /*!< a string containing the \c plot_style_name for the
                  * entity. */
 )
@@ -2609,14 +2485,7 @@ dxf_table_set_plot_style_name
                   __FUNCTION__);
                 return (NULL);
         }
-        if (plot_style_name == NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was passed.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
-        table->plot_style_name = strdup (plot_style_name);
+        table->plot_style_name = plot_style_name;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2723,7 +2592,7 @@ dxf_table_get_color_name
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (table->color_name));
+        return (dxf_strdup (table->color_name));
 }
 
 
@@ -2761,7 +2630,7 @@ dxf_table_set_color_name
                   __FUNCTION__);
                 return (NULL);
         }
-        table->color_name = strdup (color_name);
+        table->color_name = dxf_strdup (color_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2868,7 +2737,7 @@ dxf_table_get_block_name
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (table->block_name));
+        return (dxf_strdup (table->block_name));
 }
 
 
@@ -2906,7 +2775,7 @@ dxf_table_set_block_name
                   __FUNCTION__);
                 return (NULL);
         }
-        table->block_name = strdup (block_name);
+        table->block_name = dxf_strdup (block_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2948,7 +2817,7 @@ dxf_table_get_table_text_style_name
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (table->table_text_style_name));
+        return (dxf_strdup (table->table_text_style_name));
 }
 
 
@@ -2986,7 +2855,7 @@ dxf_table_set_table_text_style_name
                   __FUNCTION__);
                 return (NULL);
         }
-        table->table_text_style_name = strdup (table_text_style_name);
+        table->table_text_style_name = dxf_strdup (table_text_style_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -258,7 +258,7 @@ typedef struct
 dxf_table_struct
 {
         /* Members common for all DXF drawable entities. */
-        int id_code;
+        uint64_t id_code;
                 /*!< Identification number for the entity.\n
                  * This is to be an unique (sequential) number in the DXF
                  * file.\n
@@ -331,20 +331,20 @@ dxf_table_struct
                  * (optional).\n
                  * Group code = 310.\n
                  * \since Introduced in version R2000. */
-        char *dictionary_owner_soft;
+        uint64_t dictionary_owner_soft;
                 /*!< Soft-pointer ID/handle to owner dictionary (optional).\n
                  * Group code = 330.\n
                  * \since Introduced in version R14. */
-        char *object_owner_soft;
+        uint64_t object_owner_soft;
                 /*!< Soft-pointer ID/handle  to owner BLOCK_RECORD object.\n
                  * Group code = 330.\n
                  * \since Introduced in version R2000. */
-        char *material;
+        uint64_t material;
                 /*!< Hard-pointer ID/handle to material object (present if
                  * not BYLAYER).\n
                  * Group code = 347.\n
                  * \since Introduced in version R2008. */
-        char *dictionary_owner_hard;
+        uint64_t dictionary_owner_hard;
                 /*!< Hard owner ID/handle to owner dictionary (optional).\n
                  * Group code = 360.\n
                  * \since Introduced in version R14. */
@@ -353,7 +353,7 @@ dxf_table_struct
                  * Stored and moved around as a 16-bit integer.\n
                  * Group code = 370.\n
                  * \since Introduced in version R2002. */
-        char *plot_style_name;
+        uint64_t plot_style_name;
                 /*!< Hard pointer ID / handle of PlotStyleName object.\n
                  * Group code = 390.\n
                  * \since Introduced in version R2009. */
@@ -540,8 +540,8 @@ DxfTable *dxf_table_read (DxfFile *fp, DxfTable *table);
 int dxf_table_write (DxfFile *fp, DxfTable *table);
 int dxf_table_free (DxfTable *table);
 void dxf_table_free_list (DxfTable *tables);
-int dxf_table_get_id_code (DxfTable *table);
-DxfTable *dxf_table_set_id_code (DxfTable *table, int id_code);
+uint64_t dxf_table_get_id_code (DxfTable *table);
+DxfTable *dxf_table_set_id_code (DxfTable *table, uint64_t id_code);
 char *dxf_table_get_linetype (DxfTable *table);
 DxfTable *dxf_table_set_linetype (DxfTable *table, char *linetype);
 char *dxf_table_get_layer (DxfTable *table);
@@ -564,18 +564,18 @@ int16_t dxf_table_get_shadow_mode (DxfTable *table);
 DxfTable *dxf_table_set_shadow_mode (DxfTable *table, int16_t shadow_mode);
 DxfBinaryData *dxf_table_get_binary_graphics_data (DxfTable *table);
 DxfTable *dxf_table_set_binary_graphics_data (DxfTable *table, DxfBinaryData *data);
-char *dxf_table_get_dictionary_owner_soft (DxfTable *table);
-DxfTable *dxf_table_set_dictionary_owner_soft (DxfTable *table, char *dictionary_owner_soft);
-char *dxf_table_get_object_owner_soft (DxfTable *table);
-DxfTable *dxf_table_set_object_owner_soft (DxfTable *table, char *object_owner_soft);
-char *dxf_table_get_material (DxfTable *table);
-DxfTable *dxf_table_set_material (DxfTable *table, char *material);
-char *dxf_table_get_dictionary_owner_hard (DxfTable *table);
-DxfTable *dxf_table_set_dictionary_owner_hard (DxfTable *table, char *dictionary_owner_hard);
+uint64_t dxf_table_get_dictionary_owner_soft (DxfTable *table);
+DxfTable *dxf_table_set_dictionary_owner_soft (DxfTable *table, uint64_t dictionary_owner_soft);
+uint64_t dxf_table_get_object_owner_soft (DxfTable *table);
+DxfTable *dxf_table_set_object_owner_soft (DxfTable *table, uint64_t object_owner_soft);
+uint64_t dxf_table_get_material (DxfTable *table);
+DxfTable *dxf_table_set_material (DxfTable *table, uint64_t material);
+uint64_t dxf_table_get_dictionary_owner_hard (DxfTable *table);
+DxfTable *dxf_table_set_dictionary_owner_hard (DxfTable *table, uint64_t dictionary_owner_hard);
 int16_t dxf_table_get_lineweight (DxfTable *table);
 DxfTable *dxf_table_set_lineweight (DxfTable *table, int16_t lineweight);
-char *dxf_table_get_plot_style_name (DxfTable *table);
-DxfTable *dxf_table_set_plot_style_name (DxfTable *table, char *plot_style_name);
+uint64_t dxf_table_get_plot_style_name (DxfTable *table);
+DxfTable *dxf_table_set_plot_style_name (DxfTable *table, uint64_t plot_style_name);
 int32_t dxf_table_get_color_value (DxfTable *table);
 DxfTable *dxf_table_set_color_value (DxfTable *table, int32_t color_value);
 char *dxf_table_get_color_name (DxfTable *table);
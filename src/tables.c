@@ -35,6 +35,79 @@
 
 #include "tables.h"
 #include "section.h"
+#include "endtab.h"
+#include <stddef.h>
+
+
+/*!
+ * \brief Define the read and write wrappers of a symbol table entry
+ * type for the dispatch table of dxf_tables_read () and
+ * dxf_tables_write ().
+ */
+#define DXF_TABLES_READ_WRAPPER(type, Type) \
+static void * \
+dxf_tables_dispatch_read_##type (DxfFile *fp) \
+{ \
+        Type *entry = dxf_##type##_init (dxf_##type##_new ()); \
+        if (entry == NULL) \
+        { \
+                return (NULL); \
+        } \
+        return (dxf_##type##_read (fp, entry)); \
+} \
+static int \
+dxf_tables_dispatch_write_##type (DxfFile *fp, void *entry) \
+{ \
+        return (dxf_##type##_write (fp, (Type *) entry)); \
+}
+
+
+DXF_TABLES_READ_WRAPPER (appid, DxfAppid)
+DXF_TABLES_READ_WRAPPER (block_record, DxfBlockRecord)
+DXF_TABLES_READ_WRAPPER (dimstyle, DxfDimStyle)
+DXF_TABLES_READ_WRAPPER (layer, DxfLayer)
+DXF_TABLES_READ_WRAPPER (ltype, DxfLType)
+DXF_TABLES_READ_WRAPPER (style, DxfStyle)
+DXF_TABLES_READ_WRAPPER (ucs, DxfUcs)
+DXF_TABLES_READ_WRAPPER (view, DxfView)
+DXF_TABLES_READ_WRAPPER (vport, DxfVPort)
+
+
+/*!
+ * \brief Dispatch table of dxf_tables_read () and dxf_tables_write (),
+ * one entry per symbol table.
+ *
+ * In the order the tables appear in a DXF file.
+ */
+static const struct dxf_tables_reader_struct
+{
+        const char *name;
+                /*!< Symbol table entry type name as found after group
+                 * code 0 (and the table name after group code 2). */
+        void *(*read) (DxfFile *fp);
+                /*!< Allocate, initialize and read a table entry. */
+        int (*write) (DxfFile *fp, void *entry);
+                /*!< Write a table entry. */
+        size_t list_offset;
+                /*!< Offset of the list in \c DxfTables. */
+        size_t next_offset;
+                /*!< Offset of the \c next member in the entry. */
+} dxf_tables_readers[] =
+{
+#define DXF_TABLES_READER(name, type, Type, list) \
+        {name, dxf_tables_dispatch_read_##type, dxf_tables_dispatch_write_##type, \
+          offsetof (DxfTables, list), offsetof (Type, next)}
+        DXF_TABLES_READER ("VPORT", vport, DxfVPort, vports),
+        DXF_TABLES_READER ("LTYPE", ltype, DxfLType, ltypes),
+        DXF_TABLES_READER ("LAYER", layer, DxfLayer, layers),
+        DXF_TABLES_READER ("STYLE", style, DxfStyle, styles),
+        DXF_TABLES_READER ("VIEW", view, DxfView, views),
+        DXF_TABLES_READER ("UCS", ucs, DxfUcs, ucss),
+        DXF_TABLES_READER ("APPID", appid, DxfAppid, appids),
+        DXF_TABLES_READER ("DIMSTYLE", dimstyle, DxfDimStyle, dimstyles),
+        DXF_TABLES_READER ("BLOCK_RECORD", block_record, DxfBlockRecord, block_records)
+#undef DXF_TABLES_READER
+};
 
 
 /*!
@@ -57,7 +130,7 @@ dxf_tables_new ()
         size = sizeof (DxfTables);
         /* avoid malloc of 0 bytes */
         if (size == 0) size = 1;
-        if ((tables = malloc (size)) == NULL)
+        if ((tables = dxf_malloc (size)) == NULL)
         {
                 fprintf (stderr,
                   (_("Error in %s () could not allocate memory for a DxfTables struct.\n")),
@@ -124,9 +197,167 @@ dxf_tables_init
 }
 
 
+/*!
+ * \brief Read and parse the \c TABLES section from a DXF file.
+ *
+ * The last line read from file contained the string "TABLES".\n
+ * Every symbol table entry up to the \c ENDSEC marker is read with the
+ * matching \c dxf_<type>_read () function and appended to the list for
+ * its table, in file order.\n
+ * Unsupported tables are skipped with a warning.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_tables_read
+(
+        DxfFile *fp,
+                /*!< DXF file pointer to an input file (or device). */
+        DxfTables *tables
+                /*!< Pointer to the DXF \c TABLES section. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        const struct dxf_tables_reader_struct *reader;
+        const char *value;
+        size_t length;
+        int group_code;
+        size_t i;
+        void **head;
+        void *tail;
+        void *entry;
+
+        /* Do some basic checks. */
+        if (fp == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL file pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        if (tables == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        reader = NULL;
+        tail = NULL;
+        if (dxf_read_group_code (fp, &group_code) == EXIT_FAILURE)
+        {
+                group_code = -1;
+        }
+        for (;;)
+        {
+                if ((group_code != 0)
+                  || (dxf_read_string_view (fp, &value, &length) == EXIT_FAILURE))
+                {
+                        fprintf (stderr,
+                          (_("Error in %s () ENDSEC expected while reading from: %s in line: %d.\n")),
+                          __FUNCTION__, fp->filename, fp->line_number);
+                        return (EXIT_FAILURE);
+                }
+                if ((length == 6) && (memcmp (value, "ENDSEC", 6) == 0))
+                {
+                        break;
+                }
+                if ((length == 5) && (memcmp (value, "TABLE", 5) == 0))
+                {
+                        /* The table name follows with group code 2,
+                         * skip the other pairs of the table header. */
+                        reader = NULL;
+                        while ((dxf_read_group_code (fp, &group_code) == EXIT_SUCCESS)
+                          && (group_code != 0))
+                        {
+                                dxf_read_string_view (fp, &value, &length);
+                                if (group_code != 2)
+                                {
+                                        continue;
+                                }
+                                for (i = 0; i < sizeof (dxf_tables_readers) / sizeof (dxf_tables_readers[0]); i++)
+                                {
+                                        if ((strlen (dxf_tables_readers[i].name) == length)
+                                          && (memcmp (dxf_tables_readers[i].name, value, length) == 0))
+                                        {
+                                                reader = &dxf_tables_readers[i];
+                                        }
+                                }
+                        }
+                        if (reader != NULL)
+                        {
+                                /* Find the end of a list which was not
+                                 * empty when reading started. */
+                                head = (void **) ((char *) tables + reader->list_offset);
+                                tail = *head;
+                                while ((tail != NULL)
+                                  && (*(void **) ((char *) tail + reader->next_offset) != NULL))
+                                {
+                                        tail = *(void **) ((char *) tail + reader->next_offset);
+                                }
+                        }
+                        else
+                        {
+                                fprintf (stderr,
+                                  (_("Warning in %s () unsupported table skipped in line: %d.\n")),
+                                  __FUNCTION__, fp->line_number);
+                        }
+                        continue;
+                }
+                if ((reader == NULL)
+                  || (length != strlen (reader->name))
+                  || (memcmp (value, reader->name, length) != 0))
+                {
+                        /* ENDTAB, or an entry of an unsupported table:
+                         * skip the pairs up to the next group code 0. */
+                        while ((dxf_read_group_code (fp, &group_code) == EXIT_SUCCESS)
+                          && (group_code != 0))
+                        {
+                                dxf_read_string_view (fp, &value, &length);
+                        }
+                        continue;
+                }
+                entry = reader->read (fp);
+                if (entry == NULL)
+                {
+                        fprintf (stderr,
+                          (_("Error in %s () could not read a %s table entry from: %s in line: %d.\n")),
+                          __FUNCTION__, reader->name, fp->filename, fp->line_number);
+                        return (EXIT_FAILURE);
+                }
+                /* The entry reader stopped after the next group
+                 * code 0. */
+                group_code = fp->reader->group_code;
+                head = (void **) ((char *) tables + reader->list_offset);
+                if (tail == NULL)
+                {
+                        *head = entry;
+                }
+                else
+                {
+                        *(void **) ((char *) tail + reader->next_offset) = entry;
+                }
+                tail = entry;
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (EXIT_SUCCESS);
+}
+
+
 /*!
  * \brief Write DXF output to a file for a table section.
- * 
+ *
+ * Every non empty symbol table is written as a \c TABLE with the
+ * matching \c dxf_<type>_write () function for each entry, followed
+ * by an \c ENDTAB marker.\n
+ * An entry rejected by it's writer is left out.\n
+ * The \c BLOCK_RECORD table is only written for DXF R13 and later.
+ *
  * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
  * occurred.
  */
@@ -142,7 +373,11 @@ dxf_tables_write
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        char *dxf_section_name = strdup ("TABLES");
+        const struct dxf_tables_reader_struct *reader;
+        char *dxf_section_name = NULL;
+        void *entry;
+        size_t i;
+        int number_entries;
 
         /* Do some basic checks. */
         if (fp == NULL)
@@ -150,17 +385,53 @@ dxf_tables_write
                 fprintf (stderr,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
-                /* Clean up. */
-                free (dxf_section_name);
                 return (EXIT_FAILURE);
         }
+        if (tables == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        dxf_section_name = dxf_strdup ("TABLES");
         dxf_section_write (fp, dxf_section_name);
-        /*! \todo Add code here */
+        for (i = 0; i < sizeof (dxf_tables_readers) / sizeof (dxf_tables_readers[0]); i++)
+        {
+                reader = &dxf_tables_readers[i];
+                entry = *(void **) ((char *) tables + reader->list_offset);
+                if ((entry == NULL)
+                  || ((strcmp (reader->name, "BLOCK_RECORD") == 0)
+                  && (fp->acad_version_number < AutoCAD_13)))
+                {
+                        continue;
+                }
+                number_entries = 0;
+                for (; entry != NULL; entry = *(void **) ((char *) entry + reader->next_offset))
+                {
+                        number_entries++;
+                }
+                dxf_write_string (fp, 0, "TABLE");
+                dxf_write_string (fp, 2, reader->name);
+                if (fp->acad_version_number >= AutoCAD_13)
+                {
+                        dxf_write_string (fp, 100, "AcDbSymbolTable");
+                }
+                dxf_write_int (fp, 70, number_entries);
+                entry = *(void **) ((char *) tables + reader->list_offset);
+                for (; entry != NULL; entry = *(void **) ((char *) entry + reader->next_offset))
+                {
+                        reader->write (fp, entry);
+                }
+                dxf_endtab_write (fp);
+        }
         dxf_endsec_write (fp);
+        /* Clean up. */
+        dxf_free (dxf_section_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (EXIT_SUCCESS);
+        return (((fp->writer != NULL) && fp->writer->error) ? EXIT_FAILURE : EXIT_SUCCESS);
 }
 
 
@@ -188,15 +459,15 @@ dxf_tables_free
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        free (tables->appids);
-        free (tables->block_records);
-        free (tables->dimstyles);
-        free (tables->layers);
-        free (tables->ltypes);
-        free (tables->styles);
-        free (tables->ucss);
-        free (tables->views);
-        free (tables->vports);
+        dxf_free (tables->appids);
+        dxf_free (tables->block_records);
+        dxf_free (tables->dimstyles);
+        dxf_free (tables->layers);
+        dxf_free (tables->ltypes);
+        dxf_free (tables->styles);
+        dxf_free (tables->ucss);
+        dxf_free (tables->views);
+        dxf_free (tables->vports);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -104,6 +104,7 @@ dxf_tables_struct
 
 DxfTables *dxf_tables_new ();
 DxfTables *dxf_tables_init (DxfTables *tables);
+int dxf_tables_read (DxfFile *fp, DxfTables *tables);
 int dxf_tables_write (DxfFile *fp, DxfTables *tables);
 int dxf_tables_free (DxfTables *tables);
 int dxf_tables_get_max_table_entries (DxfTables *tables);
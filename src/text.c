@@ -42,6 +42,8 @@
 
 
 #include "text.h"
+#include "bbox.h"
+#include "util.h"
 
 
 /*!
@@ -61,7 +63,7 @@ dxf_text_new ()
         size = sizeof (DxfText);
         /* avoid malloc of 0 bytes */
         if (size == 0) size = 1;
-        if ((text = malloc (size)) == NULL)
+        if ((text = dxf_malloc (size)) == NULL)
         {
                 fprintf (stderr,
                   (_("Error in %s () could not allocate memory for a DxfText struct.\n")),
@@ -110,9 +112,9 @@ dxf_text_init
                 __FUNCTION__);
               return (NULL);
         }
-        text->id_code = 0;
-        text->linetype = strdup (DXF_DEFAULT_LINETYPE);
-        text->layer = strdup (DXF_DEFAULT_LAYER);
+        text->id_code = DXF_HANDLE_NONE;
+        text->linetype = dxf_strdup (DXF_DEFAULT_LINETYPE);
+        text->layer = dxf_strdup (DXF_DEFAULT_LAYER);
         text->elevation = 0.0;
         text->thickness = 0.0;
         text->linetype_scale = DXF_DEFAULT_LINETYPE_SCALE;
@@ -123,16 +125,16 @@ dxf_text_init
         text->shadow_mode = 0;
         text->binary_graphics_data = (DxfBinaryGraphicsData *) dxf_binary_graphics_data_new ();
         text->binary_graphics_data = (DxfBinaryGraphicsData *) dxf_binary_graphics_data_init ((DxfBinaryGraphicsData *) text->binary_graphics_data);
-        text->dictionary_owner_soft = strdup ("");
-        text->material = strdup ("");
-        text->dictionary_owner_hard = strdup ("");
+        text->dictionary_owner_soft = 0;
+        text->material = 0;
+        text->dictionary_owner_hard = 0;
         text->lineweight = 0;
-        text->plot_style_name = strdup ("");
+        text->plot_style_name = 0;
         text->color_value = 0;
-        text->color_name = strdup ("");
+        text->color_name = dxf_strdup ("");
         text->transparency = 0;
-        text->text_value = strdup ("");
-        text->text_style = strdup ("");
+        text->text_value = dxf_strdup ("");
+        text->text_style = dxf_strdup ("");
         text->p0 = (DxfPoint *) dxf_point_new ();
         text->p0 = dxf_point_init ((DxfPoint *) text->p0);
         text->p0->x0 = 0.0;
@@ -185,8 +187,9 @@ dxf_text_read
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        char *dxf_entity_name = strdup ("TEXT");
-        char *temp_string = NULL;
+        char *dxf_entity_name = dxf_strdup ("TEXT");
+        char temp_string[DXF_MAX_STRING_LENGTH];
+        int group_code;
 
         /* Do some basic checks. */
         if (fp == NULL)
@@ -194,8 +197,6 @@ dxf_text_read
                 fprintf (stderr,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
-                /* Clean up. */
-                free (temp_string);
                 return (NULL);
         }
         if (text == NULL)
@@ -205,342 +206,277 @@ dxf_text_read
                   __FUNCTION__);
                 text = dxf_text_init (text);
         }
-        (fp->line_number)++;
-        fscanf (fp->fp, "%[^\n]", temp_string);
-        while (strcmp (temp_string, "0") != 0)
+        while ((dxf_read_group_code (fp, &group_code) == EXIT_SUCCESS)
+          && (group_code != 0))
         {
-                if (ferror (fp->fp))
+                if (dxf_read_error (fp))
                 {
                         fprintf (stderr,
                           (_("Error in %s () while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
-                        fclose (fp->fp);
-                        /* Clean up. */
-                        free (temp_string);
                         return (NULL);
                 }
-                if (strcmp (temp_string, "1") == 0)
-                {
-                        /* Now follows a string containing a text value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, text->text_value);
-                }
-                else if (strcmp (temp_string, "5") == 0)
-                {
-                        /* Now follows a string containing a sequential
-                         * id number. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%x\n", (uint *) &text->id_code);
-                }
-                else if (strcmp (temp_string, "6") == 0)
-                {
-                        /* Now follows a string containing a linetype
-                         * name. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, text->linetype);
-                }
-                else if (strcmp (temp_string, "7") == 0)
-                {
-                        /* Now follows a string containing a text style
-                         * name. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, text->text_style);
-                }
-                else if (strcmp (temp_string, "8") == 0)
-                {
-                        /* Now follows a string containing a layer name. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, text->layer);
-                }
-                else if (strcmp (temp_string, "10") == 0)
-                {
-                        /* Now follows a string containing the
-                         * X-coordinate of the first alignment point. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &text->p0->x0);
-                }
-                else if (strcmp (temp_string, "20") == 0)
-                {
-                        /* Now follows a string containing the
-                         * Y-coordinate of the first alignment point. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &text->p0->y0);
-                }
-                else if (strcmp (temp_string, "30") == 0)
-                {
-                        /* Now follows a string containing the
-                         * Z-coordinate of the first alignment point. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &text->p0->z0);
-                }
-                else if (strcmp (temp_string, "11") == 0)
-                {
-                        /* Now follows a string containing the
-                         * X-coordinate of the second alignment point. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &text->p1->x0);
-                }
-                else if (strcmp (temp_string, "21") == 0)
-                {
-                        /* Now follows a string containing the
-                         * Y-coordinate of the second alignment point. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &text->p1->y0);
-                }
-                else if (strcmp (temp_string, "31") == 0)
-                {
-                        /* Now follows a string containing the
-                         * Z-coordinate of the second alignment point. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &text->p1->z0);
-                }
-                else if ((fp->acad_version_number <= AutoCAD_11)
-                        && (strcmp (temp_string, "38") == 0)
-                        && (text->elevation != 0.0))
-                {
-                        /* Now follows a string containing the
-                         * elevation. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &text->elevation);
-                }
-                else if (strcmp (temp_string, "39") == 0)
-                {
-                        /* Now follows a string containing the
-                         * thickness. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &text->thickness);
-                }
-                else if (strcmp (temp_string, "40") == 0)
-                {
-                        /* Now follows a string containing the
-                         * height. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &text->height);
-                }
-                else if (strcmp (temp_string, "41") == 0)
-                {
-                        /* Now follows a string containing the
-                         * relative X-scale. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &text->rel_x_scale);
-                }
-                else if (strcmp (temp_string, "48") == 0)
+                switch (group_code)
                 {
-                        /* Now follows a string containing the linetype
-                         * scale. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &text->linetype_scale);
-                }
-                else if (strcmp (temp_string, "50") == 0)
-                {
-                        /* Now follows a string containing the
-                         * rotation angle. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &text->rot_angle);
-                }
-                else if (strcmp (temp_string, "51") == 0)
-                {
-                        /* Now follows a string containing the
-                         * oblique angle. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &text->obl_angle);
-                }
-                else if (strcmp (temp_string, "60") == 0)
-                {
-                        /* Now follows a string containing the
-                         * visibility value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%hd\n", &text->visibility);
-                }
-                else if (strcmp (temp_string, "62") == 0)
-                {
-                        /* Now follows a string containing the
-                         * color value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%d\n", &text->color);
-                }
-                else if (strcmp (temp_string, "67") == 0)
-                {
-                        /* Now follows a string containing the
-                         * paperspace value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%d\n", &text->paperspace);
-                }
-                else if (strcmp (temp_string, "71") == 0)
-                {
-                        /* Now follows a string containing the
-                         * text flags value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%d\n", &text->text_flags);
-                }
-                else if (strcmp (temp_string, "72") == 0)
-                {
-                        /* Now follows a string containing the
-                         * horizontal alignment flag value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%d\n", &text->hor_align);
-                }
-                else if (strcmp (temp_string, "73") == 0)
-                {
-                        /* Now follows a string containing the
-                         * vertical alignment flag value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%d\n", &text->vert_align);
-                }
-                else if (strcmp (temp_string, "92") == 0)
-                {
-                        /* Now follows a string containing the
-                         * graphics data size value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%d\n", &text->graphics_data_size);
-                }
-                else if ((fp->acad_version_number >= AutoCAD_13)
-                        && (strcmp (temp_string, "100") == 0))
-                {
-                        /* Now follows a string containing the
-                         * subclass marker value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
-                        if ((strcmp (temp_string, "AcDbEntity") != 0)
-                        && ((strcmp (temp_string, "AcDbText") != 0)))
-                        {
+                        case 1:
+                                /* Now follows a string containing a text value. */
+                                dxf_read_string (fp, &text->text_value);
+                                break;
+                        case 5:
+                                /* Now follows a string containing a sequential
+                                 * id number. */
+                                dxf_read_handle (fp, &text->id_code);
+                                break;
+                        case 6:
+                                /* Now follows a string containing a linetype
+                                 * name. */
+                                dxf_read_string_interned (fp, &text->linetype);
+                                break;
+                        case 7:
+                                /* Now follows a string containing a text style
+                                 * name. */
+                                dxf_read_string_interned (fp, &text->text_style);
+                                break;
+                        case 8:
+                                /* Now follows a string containing a layer name. */
+                                dxf_read_string_interned (fp, &text->layer);
+                                break;
+                        case 10:
+                                /* Now follows a string containing the
+                                 * X-coordinate of the first alignment point. */
+                                dxf_read_double (fp, &text->p0->x0);
+                                break;
+                        case 20:
+                                /* Now follows a string containing the
+                                 * Y-coordinate of the first alignment point. */
+                                dxf_read_double (fp, &text->p0->y0);
+                                break;
+                        case 30:
+                                /* Now follows a string containing the
+                                 * Z-coordinate of the first alignment point. */
+                                dxf_read_double (fp, &text->p0->z0);
+                                break;
+                        case 11:
+                                /* Now follows a string containing the
+                                 * X-coordinate of the second alignment point. */
+                                dxf_read_double (fp, &text->p1->x0);
+                                break;
+                        case 21:
+                                /* Now follows a string containing the
+                                 * Y-coordinate of the second alignment point. */
+                                dxf_read_double (fp, &text->p1->y0);
+                                break;
+                        case 31:
+                                /* Now follows a string containing the
+                                 * Z-coordinate of the second alignment point. */
+                                dxf_read_double (fp, &text->p1->z0);
+                                break;
+                        case 38:
+                                if ((fp->acad_version_number <= AutoCAD_11) && (text->elevation != 0.0))
+                                {
+                                        /* Now follows a string containing the
+                                         * elevation. */
+                                        dxf_read_double (fp, &text->elevation);
+                                }
+                                else
+                                {
+                                        fprintf (stderr,
+                                          (_("Warning: in %s () unknown string tag found while reading from: %s in line: %d.\n")),
+                                          __FUNCTION__, fp->filename, fp->line_number);
+                                        /* Skip the value of the unknown group code. */
+                                        dxf_read_line (temp_string, fp);
+                                }
+                                break;
+                        case 39:
+                                /* Now follows a string containing the
+                                 * thickness. */
+                                dxf_read_double (fp, &text->thickness);
+                                break;
+                        case 40:
+                                /* Now follows a string containing the
+                                 * height. */
+                                dxf_read_double (fp, &text->height);
+                                break;
+                        case 41:
+                                /* Now follows a string containing the
+                                 * relative X-scale. */
+                                dxf_read_double (fp, &text->rel_x_scale);
+                                break;
+                        case 48:
+                                /* Now follows a string containing the linetype
+                                 * scale. */
+                                dxf_read_double (fp, &text->linetype_scale);
+                                break;
+                        case 50:
+                                /* Now follows a string containing the
+                                 * rotation angle. */
+                                dxf_read_double (fp, &text->rot_angle);
+                                break;
+                        case 51:
+                                /* Now follows a string containing the
+                                 * oblique angle. */
+                                dxf_read_double (fp, &text->obl_angle);
+                                break;
+                        case 60:
+                                /* Now follows a string containing the
+                                 * visibility value. */
+                                dxf_read_int16 (fp, &text->visibility);
+                                break;
+                        case 62:
+                                /* Now follows a string containing the
+                                 * color value. */
+                                dxf_read_int (fp, &text->color);
+                                break;
+                        case 67:
+                                /* Now follows a string containing the
+                                 * paperspace value. */
+                                dxf_read_int (fp, &text->paperspace);
+                                break;
+                        case 71:
+                                /* Now follows a string containing the
+                                 * text flags value. */
+                                dxf_read_int (fp, &text->text_flags);
+                                break;
+                        case 72:
+                                /* Now follows a string containing the
+                                 * horizontal alignment flag value. */
+                                dxf_read_int (fp, &text->hor_align);
+                                break;
+                        case 73:
+                                /* Now follows a string containing the
+                                 * vertical alignment flag value. */
+                                dxf_read_int (fp, &text->vert_align);
+                                break;
+                        case 92:
+                                /* Now follows a string containing the
+                                 * graphics data size value. */
+                                dxf_read_int (fp, &text->graphics_data_size);
+                                break;
+                        case 100:
+                                if (fp->acad_version_number >= AutoCAD_13)
+                                {
+                                        /* Now follows a string containing the
+                                         * subclass marker value. */
+                                        dxf_read_line (temp_string, fp);
+                                        if ((strcmp (temp_string, "AcDbEntity") != 0)
+                                        && ((strcmp (temp_string, "AcDbText") != 0)))
+                                        {
+                                                fprintf (stderr,
+                                                  (_("Warning in %s () found a bad subclass marker in: %s in line: %d.\n")),
+                                                  __FUNCTION__, fp->filename, fp->line_number);
+                                        }
+                                }
+                                else
+                                {
+                                        fprintf (stderr,
+                                          (_("Warning: in %s () unknown string tag found while reading from: %s in line: %d.\n")),
+                                          __FUNCTION__, fp->filename, fp->line_number);
+                                        /* Skip the value of the unknown group code. */
+                                        dxf_read_line (temp_string, fp);
+                                }
+                                break;
+                        case 160:
+                                /* Now follows a string containing the
+                                 * graphics data size value. */
+                                dxf_read_int (fp, &text->graphics_data_size);
+                                break;
+                        case 210:
+                                /* Now follows a string containing the
+                                 * X-value of the extrusion vector. */
+                                dxf_read_double (fp, &text->extr_x0);
+                                break;
+                        case 220:
+                                /* Now follows a string containing the
+                                 * Y-value of the extrusion vector. */
+                                dxf_read_double (fp, &text->extr_y0);
+                                break;
+                        case 230:
+                                /* Now follows a string containing the
+                                 * Z-value of the extrusion vector. */
+                                dxf_read_double (fp, &text->extr_z0);
+                                break;
+                        case 284:
+                                /* Now follows a string containing the shadow
+                                 * mode value. */
+                                dxf_read_int16 (fp, &text->shadow_mode);
+                                break;
+                        case 310:
+                                /* Now follows a string containing binary
+                                 * graphics data. */
+                                dxf_read_string (fp, &text->binary_graphics_data->data_line);
+                                dxf_binary_graphics_data_init ((DxfBinaryGraphicsData *) text->binary_graphics_data->next);
+                                text->binary_graphics_data = (DxfBinaryGraphicsData *) text->binary_graphics_data->next;
+                                break;
+                        case 330:
+                                /* Now follows a string containing Soft-pointer
+                                 * ID/handle to owner dictionary. */
+                                dxf_read_handle (fp, &text->dictionary_owner_soft);
+                                break;
+                        case 347:
+                                /* Now follows a string containing a
+                                 * hard-pointer ID/handle to material object. */
+                                dxf_read_handle (fp, &text->material);
+                                break;
+                        case 360:
+                                /* Now follows a string containing Hard owner
+                                 * ID/handle to owner dictionary. */
+                                dxf_read_handle (fp, &text->dictionary_owner_hard);
+                                break;
+                        case 370:
+                                /* Now follows a string containing the lineweight
+                                 * value. */
+                                dxf_read_int16 (fp, &text->lineweight);
+                                break;
+                        case 390:
+                                /* Now follows a string containing a plot style
+                                 * name value. */
+                                dxf_read_handle (fp, &text->plot_style_name);
+                                break;
+                        case 420:
+                                /* Now follows a string containing a color value. */
+                                dxf_read_long (fp, &text->color_value);
+                                break;
+                        case 430:
+                                /* Now follows a string containing a color
+                                 * name value. */
+                                dxf_read_string_interned (fp, &text->color_name);
+                                break;
+                        case 440:
+                                /* Now follows a string containing a transparency
+                                 * value. */
+                                dxf_read_long (fp, &text->transparency);
+                                break;
+                        case 999:
+                                /* Now follows a string containing a comment. */
+                                dxf_read_line (temp_string, fp);
+                                fprintf (stdout, "DXF comment: %s\n", temp_string);
+                                break;
+                        default:
                                 fprintf (stderr,
-                                  (_("Warning in %s () found a bad subclass marker in: %s in line: %d.\n")),
+                                  (_("Warning: in %s () unknown string tag found while reading from: %s in line: %d.\n")),
                                   __FUNCTION__, fp->filename, fp->line_number);
-                        }
-                }
-                else if (strcmp (temp_string, "160") == 0)
-                {
-                        /* Now follows a string containing the
-                         * graphics data size value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%d\n", &text->graphics_data_size);
-                }
-                else if (strcmp (temp_string, "210") == 0)
-                {
-                        /* Now follows a string containing the
-                         * X-value of the extrusion vector. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &text->extr_x0);
-                }
-                else if (strcmp (temp_string, "220") == 0)
-                {
-                        /* Now follows a string containing the
-                         * Y-value of the extrusion vector. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &text->extr_y0);
-                }
-                else if (strcmp (temp_string, "230") == 0)
-                {
-                        /* Now follows a string containing the
-                         * Z-value of the extrusion vector. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &text->extr_z0);
-                }
-                else if (strcmp (temp_string, "284") == 0)
-                {
-                        /* Now follows a string containing the shadow
-                         * mode value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%hd\n", &text->shadow_mode);
-                }
-                else if (strcmp (temp_string, "310") == 0)
-                {
-                        /* Now follows a string containing binary
-                         * graphics data. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, text->binary_graphics_data->data_line);
-                        dxf_binary_graphics_data_init ((DxfBinaryGraphicsData *) text->binary_graphics_data->next);
-                        text->binary_graphics_data = (DxfBinaryGraphicsData *) text->binary_graphics_data->next;
-                }
-                else if (strcmp (temp_string, "330") == 0)
-                {
-                        /* Now follows a string containing Soft-pointer
-                         * ID/handle to owner dictionary. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, text->dictionary_owner_soft);
-                }
-                else if (strcmp (temp_string, "347") == 0)
-                {
-                        /* Now follows a string containing a
-                         * hard-pointer ID/handle to material object. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, text->material);
-                }
-                else if (strcmp (temp_string, "360") == 0)
-                {
-                        /* Now follows a string containing Hard owner
-                         * ID/handle to owner dictionary. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, text->dictionary_owner_hard);
-                }
-                else if (strcmp (temp_string, "370") == 0)
-                {
-                        /* Now follows a string containing the lineweight
-                         * value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%hd\n", &text->lineweight);
-                }
-                else if (strcmp (temp_string, "390") == 0)
-                {
-                        /* Now follows a string containing a plot style
-                         * name value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, text->plot_style_name);
-                }
-                else if (strcmp (temp_string, "420") == 0)
-                {
-                        /* Now follows a string containing a color value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%ld\n", &text->color_value);
-                }
-                else if (strcmp (temp_string, "430") == 0)
-                {
-                        /* Now follows a string containing a color
-                         * name value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, text->color_name);
-                }
-                else if (strcmp (temp_string, "440") == 0)
-                {
-                        /* Now follows a string containing a transparency
-                         * value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%ld\n", &text->transparency);
-                }
-                else if (strcmp (temp_string, "999") == 0)
-                {
-                        /* Now follows a string containing a comment. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
-                        fprintf (stdout, "DXF comment: %s\n", temp_string);
-                }
-                else
-                {
-                        fprintf (stderr,
-                          (_("Warning: in %s () unknown string tag found while reading from: %s in line: %d.\n")),
-                          __FUNCTION__, fp->filename, fp->line_number);
+                                /* Skip the value of the unknown group code. */
+                                dxf_read_line (temp_string, fp);
+                                break;
                 }
         }
         /* Handle omitted members and/or illegal values. */
         if (strcmp (text->text_value, "") == 0)
         {
                 fprintf (stderr,
-                  (_("Error in %s () text value string is empty for the %s entity with id-code: %x\n")),
+                  (_("Error in %s () text value string is empty for the %s entity with id-code: %" PRIx64 "\n")),
                   __FUNCTION__, dxf_entity_name, text->id_code);
                 dxf_entity_skip (dxf_entity_name);
                 return (NULL);
         }
         if (strcmp (text->linetype, "") == 0)
         {
-                text->linetype = strdup (DXF_DEFAULT_LINETYPE);
+                text->linetype = dxf_strdup (DXF_DEFAULT_LINETYPE);
         }
         if (strcmp (text->layer, "") == 0)
         {
-                text->layer = strdup (DXF_DEFAULT_LAYER);
+                text->layer = dxf_strdup (DXF_DEFAULT_LAYER);
         }
-        /* Clean up. */
-        free (temp_string);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -563,7 +499,7 @@ dxf_text_write
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        char *dxf_entity_name = strdup ("TEXT");
+        char *dxf_entity_name = dxf_strdup ("TEXT");
 
         /* Do some basic checks. */
         if (fp == NULL)
@@ -572,7 +508,7 @@ dxf_text_write
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (text == NULL)
@@ -581,52 +517,52 @@ dxf_text_write
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (strcmp (text->text_value, "") == 0)
         {
                 fprintf (stderr,
-                  (_("Error in %s () text value string is empty for the %s entity with id-code: %x\n")),
+                  (_("Error in %s () text value string is empty for the %s entity with id-code: %" PRIx64 "\n")),
                   __FUNCTION__, dxf_entity_name, text->id_code);
                 dxf_entity_skip (dxf_entity_name);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (strcmp (text->text_style, "") == 0)
         {
                 fprintf (stderr,
-                  (_("Warning in %s () text style string is empty for the %s entity with id-code: %x\n")),
+                  (_("Warning in %s () text style string is empty for the %s entity with id-code: %" PRIx64 "\n")),
                   __FUNCTION__, dxf_entity_name, text->id_code);
-                text->text_style = strdup (DXF_DEFAULT_TEXTSTYLE);        }
+                text->text_style = dxf_strdup (DXF_DEFAULT_TEXTSTYLE);        }
         if (strcmp (text->layer, "") == 0)
         {
                 fprintf (stderr,
-                  (_("Warning in %s () empty layer string for the %s entity with id-code: %x\n")),
+                  (_("Warning in %s () empty layer string for the %s entity with id-code: %" PRIx64 "\n")),
                   __FUNCTION__, dxf_entity_name, text->id_code);
                 fprintf (stderr,
                   (_("\t%s entity is relocated to layer 0")),
                   dxf_entity_name);
-                text->layer = strdup (DXF_DEFAULT_LAYER);
+                text->layer = dxf_strdup (DXF_DEFAULT_LAYER);
         }
         if (text->height == 0.0)
         {
                 fprintf (stderr,
-                  (_("Warning in %s () height has a value of 0.0 for the %s entity with id-code: %x\n")),
+                  (_("Warning in %s () height has a value of 0.0 for the %s entity with id-code: %" PRIx64 "\n")),
                   __FUNCTION__, dxf_entity_name, text->id_code);
         }
         if (text->rel_x_scale == 0.0)
         {
                 fprintf (stderr,
-                  (_("Warning in %s () relative X-scale factor has a value of 0.0 for the %s entity with id-code: %x\n")),
+                  (_("Warning in %s () relative X-scale factor has a value of 0.0 for the %s entity with id-code: %" PRIx64 "\n")),
                   __FUNCTION__, dxf_entity_name, text->id_code);
         }
         /* Start writing output. */
-        fprintf (fp->fp, "  0\n%s\n", dxf_entity_name);
-        if (text->id_code != -1)
+        dxf_write_string (fp, 0, dxf_entity_name);
+        if (text->id_code != DXF_HANDLE_NONE)
         {
-                fprintf (fp->fp, "  5\n%x\n", text->id_code);
+                dxf_write_hex (fp, 5, text->id_code);
         }
         /*!
          * \todo for version R14.\n
@@ -638,67 +574,67 @@ dxf_text_write
          * 102 groups are application defined (optional).\n\n
          * End of group, "}" (optional), with Group code 102.
          */
-        if ((strcmp (text->dictionary_owner_soft, "") != 0)
+        if ((text->dictionary_owner_soft != 0)
           && (fp->acad_version_number >= AutoCAD_14))
         {
-                fprintf (fp->fp, "102\n{ACAD_REACTORS\n");
-                fprintf (fp->fp, "330\n%s\n", text->dictionary_owner_soft);
-                fprintf (fp->fp, "102\n}\n");
+                dxf_write_string (fp, 102, "{ACAD_REACTORS");
+                dxf_write_hex (fp, 330, text->dictionary_owner_soft);
+                dxf_write_string (fp, 102, "}");
         }
-        if ((strcmp (text->dictionary_owner_hard, "") != 0)
+        if ((text->dictionary_owner_hard != 0)
           && (fp->acad_version_number >= AutoCAD_14))
         {
-                fprintf (fp->fp, "102\n{ACAD_XDICTIONARY\n");
-                fprintf (fp->fp, "360\n%s\n", text->dictionary_owner_hard);
-                fprintf (fp->fp, "102\n}\n");
+                dxf_write_string (fp, 102, "{ACAD_XDICTIONARY");
+                dxf_write_hex (fp, 360, text->dictionary_owner_hard);
+                dxf_write_string (fp, 102, "}");
         }
         if (fp->acad_version_number >= AutoCAD_13)
         {
-                fprintf (fp->fp, "100\nAcDbEntity\n");
+                dxf_write_string (fp, 100, "AcDbEntity");
         }
         if (text->paperspace == 1)
         {
-                fprintf (fp->fp, " 67\n%d\n", (int16_t) DXF_PAPERSPACE);
+                dxf_write_int (fp, 67, (int16_t) DXF_PAPERSPACE);
         }
-        fprintf (fp->fp, "  8\n%s\n", text->layer);
+        dxf_write_string (fp, 8, text->layer);
         if (strcmp (text->linetype, DXF_DEFAULT_LINETYPE) != 0)
         {
-                fprintf (fp->fp, "  6\n%s\n", text->linetype);
+                dxf_write_string (fp, 6, text->linetype);
         }
         if ((fp->acad_version_number >= AutoCAD_2008)
-          && (strcmp (text->material, "") != 0))
+          && (text->material != 0))
         {
-                fprintf (fp->fp, "347\n%s\n", text->material);
+                dxf_write_hex (fp, 347, text->material);
         }
         if (text->color != DXF_COLOR_BYLAYER)
         {
-                fprintf (fp->fp, " 62\n%d\n", text->color);
+                dxf_write_int (fp, 62, text->color);
         }
         if (fp->acad_version_number >= AutoCAD_2002)
         {
-                fprintf (fp->fp, "370\n%d\n", text->lineweight);
+                dxf_write_int (fp, 370, text->lineweight);
         }
         if ((fp->acad_version_number <= AutoCAD_11)
           && DXF_FLATLAND
           && (text->elevation != 0.0))
         {
-                fprintf (fp->fp, " 38\n%f\n", text->elevation);
+                dxf_write_double (fp, 38, text->elevation);
         }
         if (text->linetype_scale != 1.0)
         {
-                fprintf (fp->fp, " 48\n%f\n", text->linetype_scale);
+                dxf_write_double (fp, 48, text->linetype_scale);
         }
         if (text->visibility != 0)
         {
-                fprintf (fp->fp, " 60\n%d\n", text->visibility);
+                dxf_write_int (fp, 60, text->visibility);
         }
         if ((fp->acad_version_number >= AutoCAD_2000)
           && (text->graphics_data_size > 0))
         {
 #ifdef BUILD_64
-                fprintf (fp->fp, "160\n%d\n", text->graphics_data_size);
+                dxf_write_int (fp, 160, text->graphics_data_size);
 #else
-                fprintf (fp->fp, " 92\n%d\n", text->graphics_data_size);
+                dxf_write_int (fp, 92, text->graphics_data_size);
 #endif
                 if (text->binary_graphics_data != NULL)
                 {
@@ -706,58 +642,58 @@ dxf_text_write
                         iter = text->binary_graphics_data;
                         while (iter != NULL)
                         {
-                                fprintf (fp->fp, "310\n%s\n", dxf_binary_graphics_data_get_data_line (iter));
+                                dxf_write_string (fp, 310, dxf_binary_graphics_data_get_data_line (iter));
                                 iter = (DxfBinaryGraphicsData *) dxf_binary_graphics_data_get_next (iter);
                         }
                 }
         }
         if (fp->acad_version_number >= AutoCAD_2004)
         {
-                fprintf (fp->fp, "420\n%ld\n", text->color_value);
-                fprintf (fp->fp, "430\n%s\n", text->color_name);
-                fprintf (fp->fp, "440\n%ld\n", text->transparency);
+                dxf_write_int (fp, 420, text->color_value);
+                dxf_write_string (fp, 430, text->color_name);
+                dxf_write_int (fp, 440, text->transparency);
         }
         if (fp->acad_version_number >= AutoCAD_2009)
         {
-                fprintf (fp->fp, "390\n%s\n", text->plot_style_name);
-                fprintf (fp->fp, "284\n%d\n", text->shadow_mode);
+                dxf_write_hex (fp, 390, text->plot_style_name);
+                dxf_write_int (fp, 284, text->shadow_mode);
         }
         if (fp->acad_version_number >= AutoCAD_13)
         {
-                fprintf (fp->fp, "100\nAcDbText\n");
+                dxf_write_string (fp, 100, "AcDbText");
         }
         if (text->thickness != 0.0)
         {
-                fprintf (fp->fp, " 39\n%f\n", text->thickness);
+                dxf_write_double (fp, 39, text->thickness);
         }
-        fprintf (fp->fp, " 10\n%f\n", text->p0->x0);
-        fprintf (fp->fp, " 20\n%f\n", text->p0->y0);
-        fprintf (fp->fp, " 30\n%f\n", text->p0->z0);
-        fprintf (fp->fp, " 40\n%f\n", text->height);
-        fprintf (fp->fp, "  1\n%s\n", text->text_value);
+        dxf_write_double (fp, 10, text->p0->x0);
+        dxf_write_double (fp, 20, text->p0->y0);
+        dxf_write_double (fp, 30, text->p0->z0);
+        dxf_write_double (fp, 40, text->height);
+        dxf_write_string (fp, 1, text->text_value);
         if (text->rot_angle != 0.0)
         {
-                fprintf (fp->fp, " 50\n%f\n", text->rot_angle);
+                dxf_write_double (fp, 50, text->rot_angle);
         }
         if (text->rel_x_scale != 1.0)
         {
-                fprintf (fp->fp, " 41\n%f\n", text->rel_x_scale);
+                dxf_write_double (fp, 41, text->rel_x_scale);
         }
         if (text->obl_angle != 0.0)
         {
-                fprintf (fp->fp, " 51\n%f\n", text->obl_angle);
+                dxf_write_double (fp, 51, text->obl_angle);
         }
         if (strcmp (text->text_style, DXF_DEFAULT_TEXTSTYLE) != 0)
         {
-                fprintf (fp->fp, "  7\n%s\n", text->text_style);
+                dxf_write_string (fp, 7, text->text_style);
         }
         if (text->text_flags != 0)
         {
-                fprintf (fp->fp, " 71\n%d\n", text->text_flags);
+                dxf_write_int (fp, 71, text->text_flags);
         }
         if (text->hor_align != 0)
         {
-                fprintf (fp->fp, " 72\n%d\n", text->hor_align);
+                dxf_write_int (fp, 72, text->hor_align);
         }
         if ((text->hor_align != 0) || (text->vert_align != 0))
         {
@@ -766,7 +702,7 @@ dxf_text_write
                   && (text->p0->z0 == text->p1->z0))
                 {
                         fprintf (stderr,
-                          (_("Warning in %s () insertion point and alignment point are identical for the %s entity with id-code: %x\n")),
+                          (_("Warning in %s () insertion point and alignment point are identical for the %s entity with id-code: %" PRIx64 "\n")),
                           __FUNCTION__, dxf_entity_name, text->id_code);
                         fprintf (stderr,
                           (_("\tdefault justification applied to %s entity\n")),
@@ -776,9 +712,9 @@ dxf_text_write
                 }
                 else
                 {
-                        fprintf (fp->fp, " 11\n%f\n", text->p1->x0);
-                        fprintf (fp->fp, " 21\n%f\n", text->p1->y0);
-                        fprintf (fp->fp, " 31\n%f\n", text->p1->z0);
+                        dxf_write_double (fp, 11, text->p1->x0);
+                        dxf_write_double (fp, 21, text->p1->y0);
+                        dxf_write_double (fp, 31, text->p1->z0);
                 }
         }
         if ((fp->acad_version_number >= AutoCAD_12)
@@ -786,20 +722,20 @@ dxf_text_write
                 && (text->extr_y0 != 0.0)
                 && (text->extr_z0 != 1.0))
         {
-                fprintf (fp->fp, "210\n%f\n", text->extr_x0);
-                fprintf (fp->fp, "220\n%f\n", text->extr_y0);
-                fprintf (fp->fp, "230\n%f\n", text->extr_z0);
+                dxf_write_double (fp, 210, text->extr_x0);
+                dxf_write_double (fp, 220, text->extr_y0);
+                dxf_write_double (fp, 230, text->extr_z0);
         }
         if (fp->acad_version_number >= AutoCAD_13)
         {
-                fprintf (fp->fp, "100\nAcDbText\n");
+                dxf_write_string (fp, 100, "AcDbText");
         }
         if (text->vert_align != 0)
         {
-                fprintf (fp->fp, " 73\n%d\n", text->vert_align);
+                dxf_write_int (fp, 73, text->vert_align);
         }
         /* Clean up. */
-        free (dxf_entity_name);
+        dxf_free (dxf_entity_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -839,19 +775,15 @@ dxf_text_free
                 __FUNCTION__);
               return (EXIT_FAILURE);
         }
-        free (text->linetype);
-        free (text->layer);
+        dxf_string_free (text->linetype);
+        dxf_string_free (text->layer);
         dxf_binary_graphics_data_free_list (text->binary_graphics_data);
-        free (text->dictionary_owner_soft);
-        free (text->material);
-        free (text->dictionary_owner_hard);
-        free (text->plot_style_name);
-        free (text->color_name);
-        free (text->text_value);
-        free (text->text_style);
+        dxf_string_free (text->color_name);
+        dxf_free (text->text_value);
+        dxf_string_free (text->text_style);
         dxf_point_free (text->p0);
         dxf_point_free (text->p1);
-        free (text);
+        dxf_free (text);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -897,7 +829,7 @@ dxf_text_free_list
  *
  * \return \c id_code.
  */
-int
+uint64_t
 dxf_text_get_id_code
 (
         DxfText *text
@@ -915,12 +847,6 @@ dxf_text_get_id_code
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (text->id_code < 0)
-        {
-                fprintf (stderr,
-                  (_("Warning in %s () a negative value was found.\n")),
-                  __FUNCTION__);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -936,7 +862,7 @@ dxf_text_set_id_code
 (
         DxfText *text,
                 /*!< a pointer to a DXF \c TEXT entity. */
-        int id_code
+        uint64_t id_code
                 /*!< the \c id_code to be set for the entity.\n
                  * This is to be an unique (sequential) number in the
                  * DXF file. */
@@ -953,12 +879,6 @@ dxf_text_set_id_code
                   __FUNCTION__);
                 return (NULL);
         }
-        if (id_code < 0)
-        {
-                fprintf (stderr,
-                  (_("Warning in %s () a negative value was passed.\n")),
-                  __FUNCTION__);
-        }
         text->id_code = id_code;
 #if DEBUG
         DXF_DEBUG_END
@@ -1000,7 +920,7 @@ dxf_text_get_linetype
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (text->linetype));
+        return (dxf_strdup (text->linetype));
 }
 
 
@@ -1035,7 +955,7 @@ dxf_text_set_linetype
                   __FUNCTION__);
                 return (NULL);
         }
-        text->linetype = strdup (linetype);
+        text->linetype = dxf_strdup (linetype);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1076,7 +996,7 @@ dxf_text_get_layer
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (text->layer));
+        return (dxf_strdup (text->layer));
 }
 
 
@@ -1111,7 +1031,7 @@ dxf_text_set_layer
                   __FUNCTION__);
                 return (NULL);
         }
-        text->layer = strdup (layer);
+        text->layer = dxf_strdup (layer);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1833,11 +1753,9 @@ dxf_text_set_binary_graphics_data
  * \brief Get the pointer to the \c dictionary_owner_soft from a DXF 
  * \c TEXT entity.
  *
- * \return pointer to the \c dictionary_owner_soft.
- *
- * \warning No checks are performed on the returned pointer (string).
+ * \return the handle of the \c dictionary_owner_soft.
  */
-char *
+uint64_t
 dxf_text_get_dictionary_owner_soft
 (
         DxfText *text
@@ -1853,19 +1771,12 @@ dxf_text_get_dictionary_owner_soft
                 fprintf (stderr,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
-                return (NULL);
-        }
-        if (text->dictionary_owner_soft ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
+                return (0);
         }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (text->dictionary_owner_soft));
+        return (text->dictionary_owner_soft);
 }
 
 
@@ -1878,8 +1789,8 @@ dxf_text_set_dictionary_owner_soft
 (
         DxfText *text,
                 /*!< a pointer to a DXF \c TEXT entity. */
-        char *dictionary_owner_soft
-                /*!< a string containing the pointer to the \c
+        uint64_t dictionary_owner_soft
+                /*!< the handle of the \c
                  * dictionary_owner_soft for the entity. */
 )
 {
@@ -1894,14 +1805,7 @@ dxf_text_set_dictionary_owner_soft
                   __FUNCTION__);
                 return (NULL);
         }
-        if (dictionary_owner_soft == NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was passed.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
-        text->dictionary_owner_soft = strdup (dictionary_owner_soft);
+        text->dictionary_owner_soft = dictionary_owner_soft;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1912,12 +1816,10 @@ dxf_text_set_dictionary_owner_soft
 /*!
  * \brief Get the pointer to the \c material from a DXF \c TEXT entity.
  *
- * \return a pointer to \c material when successful, or \c NULL when an
+ * \return the handle \c material when successful, or 0 when an
  * error occurred.
- *
- * \warning No checks are performed on the returned pointer.
  */
-char *
+uint64_t
 dxf_text_get_material
 (
         DxfText *text
@@ -1933,19 +1835,12 @@ dxf_text_get_material
                 fprintf (stderr,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
-                return (NULL);
-        }
-        if (text->material ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
+                return (0);
         }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (text->material));
+        return (text->material);
 }
 
 
@@ -1960,8 +1855,8 @@ dxf_text_set_material
 (
         DxfText *text,
                 /*!< a pointer to a DXF \c TEXT entity. */
-        char *material
-                /*!< a string containing the pointer to the \c
+        uint64_t material
+                /*!< the handle of the \c
                  * material for the entity. */
 )
 {
@@ -1976,14 +1871,7 @@ dxf_text_set_material
                   __FUNCTION__);
                 return (NULL);
         }
-        if (material == NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was passed.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
-        text->material = strdup (material);
+        text->material = material;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1995,11 +1883,9 @@ dxf_text_set_material
  * \brief Get the pointer to the \c dictionary_owner_hard from a DXF 
  * \c TEXT entity.
  *
- * \return pointer to the \c dictionary_owner_hard.
- *
- * \warning No checks are performed on the returned pointer (string).
+ * \return the handle of the \c dictionary_owner_hard.
  */
-char *
+uint64_t
 dxf_text_get_dictionary_owner_hard
 (
         DxfText *text
@@ -2015,19 +1901,12 @@ dxf_text_get_dictionary_owner_hard
                 fprintf (stderr,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
-                return (NULL);
-        }
-        if (text->dictionary_owner_hard ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
+                return (0);
         }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (text->dictionary_owner_hard));
+        return (text->dictionary_owner_hard);
 }
 
 
@@ -2040,8 +1919,8 @@ dxf_text_set_dictionary_owner_hard
 (
         DxfText *text,
                 /*!< a pointer to a DXF \c TEXT entity. */
-        char *dictionary_owner_hard
-                /*!< a string containing the pointer to the \c
+        uint64_t dictionary_owner_hard
+                /*!< the handle of the \c
                  * dictionary_owner_hard for the entity. */
 )
 {
@@ -2056,14 +1935,7 @@ dxf_text_set_dictionary_owner_hard
                   __FUNCTION__);
                 return (NULL);
         }
-        if (dictionary_owner_hard == NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was passed.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
-        text->dictionary_owner_hard = strdup (dictionary_owner_hard);
+        text->dictionary_owner_hard = dictionary_owner_hard;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2139,10 +2011,10 @@ dxf_text_set_lineweight
 /*!
  * \brief Get the \c plot_style_name from a DXF \c TEXT entity.
  *
- * \return a pointer to \c plot_style_name when sucessful, or \c NULL
+ * \return the handle \c plot_style_name when sucessful, or 0
  * when an error occurred.
  */
-char *
+uint64_t
 dxf_text_get_plot_style_name
 (
         DxfText *text
@@ -2158,19 +2030,12 @@ dxf_text_get_plot_style_name
                 fprintf (stderr,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
-                return (NULL);
-        }
-        if (text->plot_style_name ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
+                return (0);
         }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (text->plot_style_name));
+        return (text->plot_style_name);
 }
 
 
@@ -2185,7 +2050,7 @@ dxf_text_set_plot_style_name
 (
         DxfText *text,
                 /*!< a pointer to a DXF \c TEXT entity. */
-        char *plot_style_name
+        uint64_t plot_style_name
                 /*!< a string containing the \c plot_style_name for the
                  * entity. */
 )
@@ -2201,14 +2066,7 @@ dxf_text_set_plot_style_name
                   __FUNCTION__);
                 return (NULL);
         }
-        if (plot_style_name == NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was passed.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
-        text->plot_style_name = strdup (plot_style_name);
+        text->plot_style_name = plot_style_name;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2315,7 +2173,7 @@ dxf_text_get_color_name
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (text->color_name));
+        return (dxf_strdup (text->color_name));
 }
 
 
@@ -2353,7 +2211,7 @@ dxf_text_set_color_name
                   __FUNCTION__);
                 return (NULL);
         }
-        text->color_name = strdup (color_name);
+        text->color_name = dxf_strdup (color_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2460,7 +2318,7 @@ dxf_text_get_text_value
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (text->text_value));
+        return (dxf_strdup (text->text_value));
 }
 
 
@@ -2498,7 +2356,7 @@ dxf_text_set_text_value
                   __FUNCTION__);
                 return (NULL);
         }
-        text->text_value = strdup (text_value);
+        text->text_value = dxf_strdup (text_value);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2540,7 +2398,7 @@ dxf_text_get_text_style
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (text->text_style));
+        return (dxf_strdup (text->text_style));
 }
 
 
@@ -2578,7 +2436,7 @@ dxf_text_set_text_style
                   __FUNCTION__);
                 return (NULL);
         }
-        text->text_style = strdup (text_style);
+        text->text_style = dxf_strdup (text_style);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -4237,4 +4095,202 @@ dxf_text_get_last
 }
 
 
+/*!
+ * \brief Get the bounding box of a DXF \c TEXT.
+ *
+ * An approximate box of \c text: every character is taken to be a
+ * square of the text height, stretched by the relative X scale
+ * factor, the box is placed at the alignment point according to the
+ * horizontal and vertical justification and rotated.\n
+ * Aligned and fit text spans the first and the second alignment
+ * point.\n
+ * The box is computed in the Object Coordinate System (OCS) of
+ * \c text and mapped to world coordinates, see
+ * dxf_bbox_ocs_to_wcs ().\n
+ * \todo Take the text style, oblique angle and mirroring into account.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_text_get_bbox
+(
+        DxfText *text,
+                /*!< a pointer to a DXF \c TEXT entity. */
+        DxfBbox *bbox
+                /*!< a pointer to the libDXF bounding box to fill. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfPoint *anchor;
+        DxfVec3 extrusion;
+        double width;
+        double height;
+        double angle;
+        double dx = 0.0;
+        double dy = 0.0;
+        double u;
+        double v;
+        int i;
+
+        /* Do some basic checks. */
+        if ((text == NULL) || (bbox == NULL))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        if (text->p0 == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer to the insertion point was found.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        anchor = text->p0;
+        height = fabs (text->height);
+        width = ((text->text_value != NULL) ? strlen (text->text_value) : 0)
+          * height * ((text->rel_x_scale > 0.0) ? text->rel_x_scale : 1.0);
+        angle = text->rot_angle * M_PI / 180.0;
+        if (((text->hor_align == 3) || (text->hor_align == 5))
+          && (text->p1 != NULL))
+        {
+                /* Aligned or fit between both alignment points. */
+                width = hypot (text->p1->x0 - text->p0->x0, text->p1->y0 - text->p0->y0);
+                angle = atan2 (text->p1->y0 - text->p0->y0, text->p1->x0 - text->p0->x0);
+        }
+        else if (((text->hor_align != 0) || (text->vert_align != 0))
+          && (text->p1 != NULL))
+        {
+                anchor = text->p1;
+                if ((text->hor_align == 1) || (text->hor_align == 4))
+                {
+                        dx = -width / 2.0;
+                }
+                else if (text->hor_align == 2)
+                {
+                        dx = -width;
+                }
+                if ((text->vert_align == 2) || (text->hor_align == 4))
+                {
+                        dy = -height / 2.0;
+                }
+                else if (text->vert_align == 3)
+                {
+                        dy = -height;
+                }
+        }
+        dxf_bbox_init (bbox);
+        for (i = 0; i < 4; i++)
+        {
+                u = dx + (((i == 1) || (i == 2)) ? width : 0.0);
+                v = dy + ((i >= 2) ? height : 0.0);
+                dxf_bbox_add_point (bbox,
+                  anchor->x0 + (u * cos (angle)) - (v * sin (angle)),
+                  anchor->y0 + (u * sin (angle)) + (v * cos (angle)),
+                  anchor->z0);
+        }
+        extrusion.x = text->extr_x0;
+        extrusion.y = text->extr_y0;
+        extrusion.z = text->extr_z0;
+        dxf_bbox_ocs_to_wcs (bbox, &extrusion);
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Transform a DXF \c TEXT entity in place.
+ *
+ * The entity lies in the plane of it's Object Coordinate System
+ * (OCS), \c transform has to map this plane with a uniform scale,
+ * see dxf_transform_get_ocs_transform ().
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred, or when \c transform does not map the entity without
+ * distortion.
+ */
+int
+dxf_text_transform
+(
+        DxfText *text,
+                /*!< a pointer to a DXF \c TEXT entity. */
+        DxfTransform *transform
+                /*!< a pointer to a libDXF affine transformation. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfTransform ocs;
+        DxfVec3 extrusion;
+        DxfVec3 point;
+        double scale;
+        double rotation;
+
+        /* Do some basic checks. */
+        if ((text == NULL) || (transform == NULL))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        if (text->p0 == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer to the insertion point was found.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        extrusion.x = text->extr_x0;
+        extrusion.y = text->extr_y0;
+        extrusion.z = text->extr_z0;
+        if (dxf_transform_get_ocs_transform (transform, &extrusion, &ocs, &scale) == EXIT_FAILURE)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () the transformation distorts the TEXT entity with id-code: %" PRIx64 "\n")),
+                  __FUNCTION__, text->id_code);
+                return (EXIT_FAILURE);
+        }
+        point.x = text->p0->x0;
+        point.y = text->p0->y0;
+        point.z = text->p0->z0;
+        dxf_transform_apply_point (&ocs, &point, &point);
+        text->p0->x0 = point.x;
+        text->p0->y0 = point.y;
+        text->p0->z0 = point.z;
+        if (text->p1 != NULL)
+        {
+                point.x = text->p1->x0;
+                point.y = text->p1->y0;
+                point.z = text->p1->z0;
+                dxf_transform_apply_point (&ocs, &point, &point);
+                text->p1->x0 = point.x;
+                text->p1->y0 = point.y;
+                text->p1->z0 = point.z;
+        }
+        rotation = atan2 (ocs.m[1][0], ocs.m[0][0]) * 180.0 / M_PI;
+        text->rot_angle = fmod (text->rot_angle + rotation, 360.0);
+        if (text->rot_angle < 0.0)
+        {
+                text->rot_angle += 360.0;
+        }
+        text->height *= scale;
+        text->extr_x0 = extrusion.x;
+        text->extr_y0 = extrusion.y;
+        text->extr_z0 = extrusion.z;
+        text->thickness *= ocs.m[2][2];
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (EXIT_SUCCESS);
+}
+
+
 /* EOF */
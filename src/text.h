@@ -48,6 +48,7 @@
 #include "global.h"
 #include "point.h"
 #include "binary_graphics_data.h"
+#include "transform.h"
 
 
 #ifdef __cplusplus
@@ -69,7 +70,7 @@ typedef struct
 dxf_text_struct
 {
         /* Members common for all DXF drawable entities. */
-        int id_code;
+        uint64_t id_code;
                 /*!< Identification number for the entity.\n
                  * This is to be an unique (sequential) number in the DXF
                  * file.\n
@@ -142,16 +143,16 @@ dxf_text_struct
                  * (optional).\n
                  * Group code = 310.\n
                  * \since Introduced in version R2000. */
-        char *dictionary_owner_soft;
+        uint64_t dictionary_owner_soft;
                 /*!< Soft-pointer ID/handle to owner dictionary (optional).\n
                  * Group code = 330.\n
                  * \since Introduced in version R14. */
-        char *material;
+        uint64_t material;
                 /*!< Hard-pointer ID/handle to material object (present if
                  * not BYLAYER).\n
                  * Group code = 347.\n
                  * \since Introduced in version R2008. */
-        char *dictionary_owner_hard;
+        uint64_t dictionary_owner_hard;
                 /*!< Hard owner ID/handle to owner dictionary (optional).\n
                  * Group code = 360.\n
                  * \since Introduced in version R14. */
@@ -160,7 +161,7 @@ dxf_text_struct
                  * Stored and moved around as a 16-bit integer.\n
                  * Group code = 370.\n
                  * \since Introduced in version R2002. */
-        char *plot_style_name;
+        uint64_t plot_style_name;
                 /*!< Hard pointer ID / handle of PlotStyleName object.\n
                  * Group code = 390.\n
                  * \since Introduced in version R2009. */
@@ -277,8 +278,8 @@ DxfText *dxf_text_read (DxfFile *fp, DxfText *text);
 int dxf_text_write (DxfFile *fp, DxfText *text);
 int dxf_text_free (DxfText *text);
 void dxf_text_free_list (DxfText *texts);
-int dxf_text_get_id_code (DxfText *text);
-DxfText *dxf_text_set_id_code (DxfText *text, int id_code);
+uint64_t dxf_text_get_id_code (DxfText *text);
+DxfText *dxf_text_set_id_code (DxfText *text, uint64_t id_code);
 char *dxf_text_get_linetype (DxfText *text);
 DxfText *dxf_text_set_linetype (DxfText *text, char *linetype);
 char *dxf_text_get_layer (DxfText *text);
@@ -301,16 +302,16 @@ int16_t dxf_text_get_shadow_mode (DxfText *text);
 DxfText *dxf_text_set_shadow_mode (DxfText *text, int16_t shadow_mode);
 DxfBinaryGraphicsData *dxf_text_get_binary_graphics_data (DxfText *text);
 DxfText *dxf_text_set_binary_graphics_data (DxfText *text, DxfBinaryGraphicsData *data);
-char *dxf_text_get_dictionary_owner_soft (DxfText *text);
-DxfText *dxf_text_set_dictionary_owner_soft (DxfText *text, char *dictionary_owner_soft);
-char *dxf_text_get_material (DxfText *text);
-DxfText *dxf_text_set_material (DxfText *text, char *material);
-char *dxf_text_get_dictionary_owner_hard (DxfText *text);
-DxfText *dxf_text_set_dictionary_owner_hard (DxfText *text, char *dictionary_owner_hard);
+uint64_t dxf_text_get_dictionary_owner_soft (DxfText *text);
+DxfText *dxf_text_set_dictionary_owner_soft (DxfText *text, uint64_t dictionary_owner_soft);
+uint64_t dxf_text_get_material (DxfText *text);
+DxfText *dxf_text_set_material (DxfText *text, uint64_t material);
+uint64_t dxf_text_get_dictionary_owner_hard (DxfText *text);
+DxfText *dxf_text_set_dictionary_owner_hard (DxfText *text, uint64_t dictionary_owner_hard);
 int16_t dxf_text_get_lineweight (DxfText *text);
 DxfText *dxf_text_set_lineweight (DxfText *text, int16_t lineweight);
-char *dxf_text_get_plot_style_name (DxfText *text);
-DxfText *dxf_text_set_plot_style_name (DxfText *text, char *plot_style_name);
+uint64_t dxf_text_get_plot_style_name (DxfText *text);
+DxfText *dxf_text_set_plot_style_name (DxfText *text, uint64_t plot_style_name);
 long dxf_text_get_color_value (DxfText *text);
 DxfText *dxf_text_set_color_value (DxfText *text, long color_value);
 char *dxf_text_get_color_name (DxfText *text);
@@ -363,6 +364,8 @@ DxfText *dxf_text_set_extrusion_vector (DxfText *text, double extr_x0, double ex
 DxfText *dxf_text_get_next (DxfText *text);
 DxfText *dxf_text_set_next (DxfText *text, DxfText *next);
 DxfText *dxf_text_get_last (DxfText *text);
+int dxf_text_get_bbox (DxfText *text, DxfBbox *bbox);
+int dxf_text_transform (DxfText *text, DxfTransform *transform);
 
 
 #ifdef __cplusplus
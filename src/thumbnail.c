@@ -55,6 +55,7 @@
 
 
 #include "thumbnail.h"
+#include "util.h"
 
 
 /*!
@@ -77,7 +78,7 @@ dxf_thumbnail_new ()
         size = sizeof (DxfThumbnail);
         /* avoid malloc of 0 bytes */
         if (size == 0) size = 1;
-        if ((thumbnail = malloc (size)) == NULL)
+        if ((thumbnail = dxf_malloc (size)) == NULL)
         {
                 fprintf (stderr,
                   (_("Error in %s () could not allocate memory for a DxfThumbnail struct.\n")),
@@ -129,8 +130,6 @@ dxf_thumbnail_init
         }
         thumbnail->number_of_bytes = 0;
         thumbnail->preview_image_data = NULL;
-        thumbnail->preview_image_data->length = 0;
-        thumbnail->preview_image_data->value = strdup ("");
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -146,8 +145,12 @@ dxf_thumbnail_init
  * with a "  0" string announcing the following entity, or the end of
  * the \c ENTITY section marker \c ENDSEC. \n
  * While parsing the DXF file store data in \c thumbnail. \n
+ * The hexadecimal digits of the group code 310 lines are decoded with
+ * dxf_reader_decode_hex () straight into one buffer, which is sized
+ * from the number of bytes (group code 90) that precedes them.
  *
- * \return a pointer to \c thumbnail.
+ * \return a pointer to \c thumbnail, or \c NULL when an error
+ * occurred.
  */
 DxfThumbnail *
 dxf_thumbnail_read
@@ -161,7 +164,15 @@ dxf_thumbnail_read
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        char *temp_string = NULL;
+        char temp_string[DXF_MAX_STRING_LENGTH];
+        const char *value;
+        size_t length;
+        size_t count;
+        size_t number_bytes = 0;
+        size_t size = 0;
+        size_t new_size;
+        uint8_t *bytes;
+        int group_code;
 
         /* Do some basic checks. */
         if (fp == NULL)
@@ -169,8 +180,6 @@ dxf_thumbnail_read
                 fprintf (stderr,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
-                /* Clean up. */
-                free (temp_string);
                 return (NULL);
         }
         if (thumbnail == NULL)
@@ -179,60 +188,97 @@ dxf_thumbnail_read
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 thumbnail = dxf_thumbnail_init (thumbnail);
+                if (thumbnail == NULL)
+                {
+                        return (NULL);
+                }
         }
+        dxf_free (thumbnail->preview_image_data);
+        thumbnail->preview_image_data = NULL;
         if (fp->acad_version_number < AutoCAD_2000)
         {
                 fprintf (stderr,
                   (_("Warning in %s () illegal DXF version for this entity.\n")),
                   __FUNCTION__);
         }
-        (fp->line_number)++;
-        fscanf (fp->fp, "%[^\n]", temp_string);
-        while (strcmp (temp_string, "0") != 0)
+        while ((dxf_read_group_code (fp, &group_code) == EXIT_SUCCESS)
+          && (group_code != 0))
         {
-                if (ferror (fp->fp))
+                if (dxf_read_error (fp))
                 {
                         fprintf (stderr,
                           (_("Error in %s () while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
-                        fclose (fp->fp);
-                        /* Clean up. */
-                        free (temp_string);
                         return (NULL);
                 }
-                else if (strcmp (temp_string, "90") == 0)
-                {
-                        /* Now follows a string containing the
-                         * number of bytes value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%d\n", &thumbnail->number_of_bytes);
-                }
-                else if (strcmp (temp_string, "310") == 0)
-                {
-                        /* Now follows a string containing additional
-                         * proprietary data. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, thumbnail->preview_image_data->value);
-                        /*! \todo preview_image_data needs a proper implementation. */
-                }
-                else if (strcmp (temp_string, "999") == 0)
+                switch (group_code)
                 {
-                        /* Now follows a string containing a comment. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
-                        fprintf (stdout, "DXF comment: %s\n", temp_string);
-                }
-                else
-                {
-                        fprintf (stderr,
-                          (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
-                          __FUNCTION__, fp->filename, fp->line_number);
+                        case 90:
+                                /* Now follows a string containing the
+                                 * number of bytes value. */
+                                dxf_read_int (fp, &thumbnail->number_of_bytes);
+                                break;
+                        case 310:
+                                /* Now follows a string containing
+                                 * preview image data. */
+                                if (dxf_read_string_view (fp, &value, &length) == EXIT_FAILURE)
+                                {
+                                        fprintf (stderr,
+                                          (_("Error in %s () while reading from: %s in line: %d.\n")),
+                                          __FUNCTION__, fp->filename, fp->line_number);
+                                        return (NULL);
+                                }
+                                if (number_bytes + length / 2 > size)
+                                {
+                                        new_size = 2 * size + length / 2;
+                                        if ((thumbnail->number_of_bytes > 0)
+                                          && ((size_t) thumbnail->number_of_bytes >= number_bytes + length / 2))
+                                        {
+                                                new_size = (size_t) thumbnail->number_of_bytes;
+                                        }
+                                        bytes = dxf_realloc (thumbnail->preview_image_data, size, new_size);
+                                        if (bytes == NULL)
+                                        {
+                                                fprintf (stderr,
+                                                  (_("Error in %s () could not allocate memory.\n")),
+                                                  __FUNCTION__);
+                                                return (NULL);
+                                        }
+                                        thumbnail->preview_image_data = bytes;
+                                        size = new_size;
+                                }
+                                count = dxf_reader_decode_hex (value, length,
+                                  thumbnail->preview_image_data + number_bytes);
+                                number_bytes += count;
+                                if (2 * count != length)
+                                {
+                                        fprintf (stderr,
+                                          (_("Warning in %s () invalid hexadecimal data found while reading from: %s in line: %d.\n")),
+                                          __FUNCTION__, fp->filename, fp->line_number);
+                                }
+                                break;
+                        case 999:
+                                /* Now follows a string containing a comment. */
+                                dxf_read_line (temp_string, fp);
+                                fprintf (stdout, "DXF comment: %s\n", temp_string);
+                                break;
+                        default:
+                                fprintf (stderr,
+                                  (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
+                                  __FUNCTION__, fp->filename, fp->line_number);
+                                /* Skip the value of the unknown group code. */
+                                dxf_read_line (temp_string, fp);
+                                break;
                 }
         }
         /* Handle omitted members and/or illegal values. */
-        /*! \todo preview_image_data needs a proper checking for data length. */
-        /* Clean up. */
-        free (temp_string);
+        if (number_bytes != (size_t) thumbnail->number_of_bytes)
+        {
+                fprintf (stderr,
+                  (_("Warning in %s () %d bytes announced, %d bytes of preview image data found.\n")),
+                  __FUNCTION__, thumbnail->number_of_bytes, (int) number_bytes);
+                thumbnail->number_of_bytes = (int) number_bytes;
+        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -255,7 +301,13 @@ dxf_thumbnail_write
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        char *dxf_entity_name = strdup ("THUMBNAILIMAGE");
+        static const char digits[] = "0123456789ABCDEF";
+        char *dxf_entity_name = dxf_strdup ("THUMBNAILIMAGE");
+        char line[2 * DXF_THUMBNAIL_BYTES_PER_LINE];
+        const uint8_t *bytes;
+        int number_bytes;
+        int i;
+        int j;
 
         /* Do some basic checks. */
         if (fp == NULL)
@@ -264,7 +316,7 @@ dxf_thumbnail_write
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (thumbnail == NULL)
@@ -273,7 +325,7 @@ dxf_thumbnail_write
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (thumbnail->number_of_bytes < 1)
@@ -282,7 +334,16 @@ dxf_thumbnail_write
                   (_("Error in %s () number of bytes was 0 or less.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
+                return (EXIT_FAILURE);
+        }
+        if (thumbnail->preview_image_data == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was found.\n")),
+                  __FUNCTION__);
+                /* Clean up. */
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (fp->acad_version_number < AutoCAD_2000)
@@ -292,12 +353,25 @@ dxf_thumbnail_write
                   __FUNCTION__);
         }
         /* Start writing output. */
-        fprintf (fp->fp, "  0\n%s\n", dxf_entity_name);
-        fprintf (fp->fp, " 90\n%d\n", thumbnail->number_of_bytes);
-        fprintf (fp->fp, "310\n%s\n", thumbnail->preview_image_data->value);
-        /*! \todo preview_image_data needs a proper implementation. */
+        dxf_write_string (fp, 0, dxf_entity_name);
+        dxf_write_int (fp, 90, thumbnail->number_of_bytes);
+        for (i = 0; i < thumbnail->number_of_bytes; i += DXF_THUMBNAIL_BYTES_PER_LINE)
+        {
+                bytes = thumbnail->preview_image_data + i;
+                number_bytes = thumbnail->number_of_bytes - i;
+                if (number_bytes > DXF_THUMBNAIL_BYTES_PER_LINE)
+                {
+                        number_bytes = DXF_THUMBNAIL_BYTES_PER_LINE;
+                }
+                for (j = 0; j < number_bytes; j++)
+                {
+                        line[2 * j] = digits[bytes[j] >> 4];
+                        line[2 * j + 1] = digits[bytes[j] & 0x0f];
+                }
+                dxf_write_slice (fp, 310, line, 2 * number_bytes);
+        }
         /* Clean up. */
-        free (dxf_entity_name);
+        dxf_free (dxf_entity_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -331,10 +405,8 @@ dxf_thumbnail_free
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        free (thumbnail->preview_image_data->value);
-        free (thumbnail->preview_image_data);
-        /*! \todo preview_image_data needs a proper implementation. */
-        free (thumbnail);
+        dxf_free (thumbnail->preview_image_data);
+        dxf_free (thumbnail);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -422,7 +494,7 @@ dxf_thumbnail_set_number_of_bytes
  * \return \c preview_image_data when sucessful, \c NULL when an error
  * occurred.
  */
-DxfChar *
+uint8_t *
 dxf_thumbnail_get_preview_image_data
 (
         DxfThumbnail *thumbnail
@@ -457,13 +529,17 @@ dxf_thumbnail_get_preview_image_data
 /*!
  * \brief Set the \c preview_image_data for a DXF \c THUMBNAILIMAGE
  * object.
+ *
+ * The \c number_of_bytes of the object has to be set to the length of
+ * \c preview_image_data, which is freed with dxf_free () when the
+ * object is freed.
  */
 DxfThumbnail *
 dxf_thumbnail_set_preview_image_data
 (
         DxfThumbnail *thumbnail,
                 /*!< a pointer to a DXF \c THUMBNAILIMAGE object. */
-        DxfChar *preview_image_data
+        uint8_t *preview_image_data
                 /*!< a pointer to the \c preview_image_data to be set
                  * for the object. */
 )
@@ -495,277 +571,198 @@ dxf_thumbnail_set_preview_image_data
 
 
 /*!
- * \brief Get the \c preview_image_data value from a DXF
- * \c THUMBNAILIMAGE object.
- *
- * \return \c preview_image_data value when sucessful, \c NULL when an
- * error occurred.
+ * \brief Read a little endian 32 bit value from an image header.
  */
-char *
-dxf_thumbnail_get_preview_image_data_value
+static uint32_t
+dxf_thumbnail_get_uint32
 (
-        DxfChar *preview_image_data
-                /*!< a pointer to a DXF \c preview_image_data object. */
+        const uint8_t *bytes
+                /*!< a pointer to the first byte of the value. */
 )
 {
-#if DEBUG
-        DXF_DEBUG_BEGIN
-#endif
-        /* Do some basic checks. */
-        if (preview_image_data ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was passed.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
-        if (preview_image_data->value ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
-#if DEBUG
-        DXF_DEBUG_END
-#endif
-        return (preview_image_data->value);
+        return ((uint32_t) bytes[0]
+          | ((uint32_t) bytes[1] << 8)
+          | ((uint32_t) bytes[2] << 16)
+          | ((uint32_t) bytes[3] << 24));
 }
 
 
 /*!
- * \brief Set the \c value for a DXF \c preview_image_data of a DXF
- * \c THUMBNAILIMAGE object.
+ * \brief Store a little endian 32 bit value in an image header.
  */
-DxfChar *
-dxf_thumbnail_set_preview_image_data_value
+static void
+dxf_thumbnail_set_uint32
 (
-        DxfChar *preview_image_data,
-                /*!< a pointer to a DXF \c preview_image_data. */
-        char *value
-                /*!< a pointer to the \c preview_image_data value to be
-                 * set for the object. */
+        uint8_t *bytes,
+                /*!< a pointer to the first byte of the value. */
+        uint32_t value
+                /*!< the value to store. */
 )
 {
-#if DEBUG
-        DXF_DEBUG_BEGIN
-#endif
-        /* Do some basic checks. */
-        if (preview_image_data == NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was passed.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
-        if (value == NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was passed.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
-        preview_image_data->value = value;
-#if DEBUG
-        DXF_DEBUG_END
-#endif
-        return (preview_image_data);
+        bytes[0] = (uint8_t) value;
+        bytes[1] = (uint8_t) (value >> 8);
+        bytes[2] = (uint8_t) (value >> 16);
+        bytes[3] = (uint8_t) (value >> 24);
 }
 
 
 /*!
- * \brief Get the \c length of a \c preview_image_data \c value from a
- * DXF \c THUMBNAILIMAGE object.
+ * \brief Get the preview image of a DXF \c THUMBNAILIMAGE object as a
+ * Windows bitmap (BMP) file.
+ *
+ * A \c THUMBNAILIMAGE holds a device independent bitmap without the
+ * 14 byte file header, the header is computed from the bitmap info
+ * header and put in front of a copy of the image.\n
+ * To load only the preview of a drawing, read its
+ * \c DXF_SECTION_THUMBNAIL with dxf_drawing_read_sections ().
  *
- * \return \c length when sucessful, \c NULL when an error occurred.
+ * \return a pointer to the bitmap file, to be freed with dxf_free (),
+ * or \c NULL when the preview image is not a bitmap or an error
+ * occurred.
  */
-int
-dxf_thumbnail_get_preview_image_data_length
+uint8_t *
+dxf_thumbnail_get_bmp
 (
-        DxfChar *preview_image_data
-                /*!< a pointer to a DXF \c preview_image_data object
-                 * (linked list). */
+        DxfThumbnail *thumbnail,
+                /*!< a pointer to a DXF \c THUMBNAILIMAGE object. */
+        size_t *size
+                /*!< Returns the size of the bitmap file. */
 )
 {
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        /* Do some basic checks. */
-        if (preview_image_data == NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was passed.\n")),
-                  __FUNCTION__);
-                return (EXIT_FAILURE);
-        }
-#if DEBUG
-        DXF_DEBUG_END
-#endif
-        return (preview_image_data->length);
-}
-
+        const uint8_t *dib;
+        uint8_t *bmp;
+        size_t number_bytes;
+        uint32_t header_size;
+        uint32_t number_colors = 0;
+        uint32_t masks_size = 0;
+        uint32_t entry_size = 4;
+        int bit_count;
 
-/*!
- * \brief Set the \c length of the \c value for a DXF
- * \c preview_image_data of a DXF \c THUMBNAILIMAGE object.
- */
-DxfChar *
-dxf_thumbnail_set_preview_image_data_length
-(
-        DxfChar *preview_image_data,
-                /*!< a pointer to a DXF \c preview_image_data. */
-        int length
-                /*!< the \c length of the \c preview_image_data value to
-                 * be set for the object. */
-)
-{
-#if DEBUG
-        DXF_DEBUG_BEGIN
-#endif
         /* Do some basic checks. */
-        if (preview_image_data == NULL)
+        if ((thumbnail == NULL) || (size == NULL))
         {
                 fprintf (stderr,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
-        if (length < 0)
+        if (thumbnail->preview_image_data == NULL)
         {
                 fprintf (stderr,
-                  (_("Warning in %s () a negative value was passed.\n")),
+                  (_("Error in %s () a NULL pointer was found.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
-        preview_image_data->length = length;
-#if DEBUG
-        DXF_DEBUG_END
-#endif
-        return (preview_image_data);
-}
-
-
-/*!
- * \brief Get the \c next \c preview_image_data \c (linked list) from a
- * DXF \c THUMBNAILIMAGE object.
- *
- * \return \c next when sucessful, \c NULL when an error occurred.
- */
-DxfChar *
-dxf_thumbnail_get_preview_image_data_next
-(
-        DxfChar *preview_image_data
-                /*!< a pointer to a DXF \c preview_image_data object
-                 * (linked list). */
-)
-{
-#if DEBUG
-        DXF_DEBUG_BEGIN
-#endif
-        /* Do some basic checks. */
-        if (preview_image_data == NULL)
+        dib = thumbnail->preview_image_data;
+        number_bytes = (thumbnail->number_of_bytes > 0) ? (size_t) thumbnail->number_of_bytes : 0;
+        header_size = (number_bytes >= 16) ? dxf_thumbnail_get_uint32 (dib) : 0;
+        if (header_size == 12)
         {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was passed.\n")),
-                  __FUNCTION__);
-                return (NULL);
+                /* BITMAPCOREHEADER, with 3 byte palette entries. */
+                bit_count = dib[10] | (dib[11] << 8);
+                entry_size = 3;
         }
-        if (preview_image_data->next == NULL)
+        else if ((header_size >= 40) && (header_size <= number_bytes))
         {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
+                bit_count = dib[14] | (dib[15] << 8);
+                number_colors = dxf_thumbnail_get_uint32 (dib + 32);
+                if ((header_size == 40)
+                  && (dxf_thumbnail_get_uint32 (dib + 16) == 3))
+                {
+                        /* BI_BITFIELDS, three color masks follow. */
+                        masks_size = 12;
+                }
         }
-#if DEBUG
-        DXF_DEBUG_END
-#endif
-        return ((DxfChar *) preview_image_data->next);
-}
-
-
-/*!
- * \brief Set the pointer to the \c next DXF \c preview_image_data
- * (linked list) for a DXF \c THUMBNAILIMAGE object.
- */
-DxfChar *
-dxf_thumbnail_set_preview_image_data_next
-(
-        DxfChar *preview_image_data,
-                /*!< a pointer to a DXF \c preview_image_data. */
-        DxfChar *next
-                /*!< a pointer to the the \c next \c preview_image_data
-                 * to be set for the object. */
-)
-{
-#if DEBUG
-        DXF_DEBUG_BEGIN
-#endif
-        /* Do some basic checks. */
-        if (preview_image_data == NULL)
+        else
         {
                 fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  (_("Warning in %s () the preview image is not a bitmap.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
-        if (next == NULL)
+        if ((number_colors == 0) && (bit_count <= 8))
+        {
+                number_colors = 1u << bit_count;
+        }
+        bmp = dxf_malloc (number_bytes + 14);
+        if (bmp == NULL)
         {
                 fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  (_("Error in %s () could not allocate memory.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
-        preview_image_data->next = (struct DxfChar *) next;
+        bmp[0] = 'B';
+        bmp[1] = 'M';
+        dxf_thumbnail_set_uint32 (bmp + 2, (uint32_t) (number_bytes + 14));
+        dxf_thumbnail_set_uint32 (bmp + 6, 0);
+        dxf_thumbnail_set_uint32 (bmp + 10,
+          14 + header_size + masks_size + number_colors * entry_size);
+        memcpy (bmp + 14, dib, number_bytes);
+        *size = number_bytes + 14;
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (preview_image_data);
+        return (bmp);
 }
 
 
 /*!
- * \brief Get the pointer to the last \c preview_image_data object from a linked list
- * of DXF \c preview_image_data objects.
+ * \brief Get the preview image of a DXF \c THUMBNAILIMAGE object as a
+ * PNG file.
  *
- * \return pointer to the last \c preview_image_data object.
+ * Newer releases of AutoCAD store the preview as a complete PNG file,
+ * which is returned without copying.
  *
- * \warning No checks are performed on the returned pointer.
+ * \return a pointer to the PNG file in \c preview_image_data, or
+ * \c NULL when the preview image is not a PNG file or an error
+ * occurred.
  */
-DxfChar *
-dxf_thumbnail_get_preview_image_data_last
+const uint8_t *
+dxf_thumbnail_get_png
 (
-        DxfChar *preview_image_data
-                /*!< a pointer to a DXF \c preview_image_data object. */
+        DxfThumbnail *thumbnail,
+                /*!< a pointer to a DXF \c THUMBNAILIMAGE object. */
+        size_t *size
+                /*!< Returns the size of the PNG file. */
 )
 {
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
+        static const uint8_t signature[8] = {0x89, 'P', 'N', 'G', '\r', '\n', 0x1a, '\n'};
+
         /* Do some basic checks. */
-        if (preview_image_data == NULL)
+        if ((thumbnail == NULL) || (size == NULL))
         {
                 fprintf (stderr,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
-        if (preview_image_data->next == NULL)
+        if (thumbnail->preview_image_data == NULL)
         {
                 fprintf (stderr,
-                  (_("Warning in %s () a NULL pointer was found.\n")),
+                  (_("Error in %s () a NULL pointer was found.\n")),
                   __FUNCTION__);
-                return ((DxfChar *) preview_image_data);
+                return (NULL);
         }
-        DxfChar *iter = (DxfChar *) preview_image_data->next;
-        while (iter->next != NULL)
+        if ((thumbnail->number_of_bytes < 8)
+          || (memcmp (thumbnail->preview_image_data, signature, 8) != 0))
         {
-                iter = (DxfChar *) iter->next;
+                fprintf (stderr,
+                  (_("Warning in %s () the preview image is not a PNG file.\n")),
+                  __FUNCTION__);
+                return (NULL);
         }
+        *size = (size_t) thumbnail->number_of_bytes;
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return ((DxfChar *) iter);
+        return (thumbnail->preview_image_data);
 }
 
 
@@ -66,6 +66,12 @@ extern "C" {
 #endif
 
 
+/*!
+ * \brief Number of image bytes written per group code 310 line.
+ */
+#define DXF_THUMBNAIL_BYTES_PER_LINE 127
+
+
 /*!
  * \brief DXF definition of an AutoCAD arc entity (\c THUMBNAILIMAGE).
  */
@@ -76,8 +82,10 @@ dxf_thumbnail_struct
                 /*!< The number of bytes in the image (and subsequent
                  * binary chunk records).\n
                  * Group code = 90. */
-        DxfChar *preview_image_data;
-                /*!< Multiple lines (256 characters maximum per line).\n
+        uint8_t *preview_image_data;
+                /*!< The image, \c number_of_bytes long, decoded from
+                 * multiple lines of hexadecimal digits (256 characters
+                 * maximum per line).\n
                  * Group code = 310. */
 } DxfThumbnail;
 
@@ -89,15 +97,10 @@ int dxf_thumbnail_write (DxfFile *fp, DxfThumbnail *thumbnail);
 int dxf_thumbnail_free (DxfThumbnail *thumbnail);
 int dxf_thumbnail_get_number_of_bytes (DxfThumbnail *thumbnail);
 DxfThumbnail *dxf_thumbnail_set_number_of_bytes (DxfThumbnail *thumbnail, int number_of_bytes);
-DxfChar *dxf_thumbnail_get_preview_image_data (DxfThumbnail *thumbnail);
-DxfThumbnail *dxf_thumbnail_set_preview_image_data (DxfThumbnail *thumbnail, DxfChar *preview_image_data);
-char *dxf_thumbnail_get_preview_image_data_value (DxfChar *preview_image_data);
-DxfChar *dxf_thumbnail_set_preview_image_data_value (DxfChar *preview_image_data, char *value);
-int dxf_thumbnail_get_preview_image_data_length (DxfChar *preview_image_data);
-DxfChar *dxf_thumbnail_set_preview_image_data_length (DxfChar *preview_image_data, int length);
-DxfChar *dxf_thumbnail_get_preview_image_data_next (DxfChar *preview_image_data);
-DxfChar *dxf_thumbnail_set_preview_image_data_next (DxfChar *preview_image_data, DxfChar *next);
-DxfChar *dxf_thumbnail_get_preview_image_data_last (DxfChar *preview_image_data);
+uint8_t *dxf_thumbnail_get_preview_image_data (DxfThumbnail *thumbnail);
+DxfThumbnail *dxf_thumbnail_set_preview_image_data (DxfThumbnail *thumbnail, uint8_t *preview_image_data);
+uint8_t *dxf_thumbnail_get_bmp (DxfThumbnail *thumbnail, size_t *size);
+const uint8_t *dxf_thumbnail_get_png (DxfThumbnail *thumbnail, size_t *size);
 
 
 #ifdef __cplusplus
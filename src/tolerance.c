@@ -40,6 +40,7 @@
 
 
 #include "tolerance.h"
+#include "util.h"
 
 
 /*!
@@ -62,7 +63,7 @@ dxf_tolerance_new ()
         size = sizeof (DxfTolerance);
         /* avoid malloc of 0 bytes */
         if (size == 0) size = 1;
-        if ((tolerance = malloc (size)) == NULL)
+        if ((tolerance = dxf_malloc (size)) == NULL)
         {
                 fprintf (stderr,
                   (_("Error in %s () could not allocate memory for a DxfTolerance struct.\n")),
@@ -112,9 +113,9 @@ dxf_tolerance_init
                   __FUNCTION__);
                 return (NULL);
         }
-        tolerance->id_code = 0;
-        tolerance->linetype = strdup (DXF_DEFAULT_LINETYPE);
-        tolerance->layer = strdup (DXF_DEFAULT_LAYER);
+        tolerance->id_code = DXF_HANDLE_NONE;
+        tolerance->linetype = dxf_strdup (DXF_DEFAULT_LINETYPE);
+        tolerance->layer = dxf_strdup (DXF_DEFAULT_LAYER);
         tolerance->elevation = 0.0;
         tolerance->thickness = 0.0;
         tolerance->linetype_scale = DXF_DEFAULT_LINETYPE_SCALE;
@@ -125,15 +126,15 @@ dxf_tolerance_init
         tolerance->shadow_mode = 0;
         tolerance->binary_graphics_data = (DxfBinaryGraphicsData *) dxf_binary_graphics_data_new ();
         tolerance->binary_graphics_data = (DxfBinaryGraphicsData *) dxf_binary_graphics_data_init ((DxfBinaryGraphicsData *) tolerance->binary_graphics_data);
-        tolerance->dictionary_owner_soft = strdup ("");
-        tolerance->material = strdup ("");
-        tolerance->dictionary_owner_hard = strdup ("");
+        tolerance->dictionary_owner_soft = 0;
+        tolerance->material = 0;
+        tolerance->dictionary_owner_hard = 0;
         tolerance->lineweight = 0;
-        tolerance->plot_style_name = strdup ("");
+        tolerance->plot_style_name = 0;
         tolerance->color_value = 0;
-        tolerance->color_name = strdup ("");
+        tolerance->color_name = dxf_strdup ("");
         tolerance->transparency = 0;
-        tolerance->dimstyle_name = strdup ("");
+        tolerance->dimstyle_name = dxf_strdup ("");
         tolerance->p0 = (DxfPoint *) dxf_point_new ();
         tolerance->p0 = dxf_point_init ((DxfPoint *) tolerance->p0);
         tolerance->p0->x0 = 0.0;
@@ -178,7 +179,8 @@ dxf_tolerance_read
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        char *temp_string = NULL;
+        char temp_string[DXF_MAX_STRING_LENGTH];
+        int group_code;
 
         /* Do some basic checks. */
         if (fp == NULL)
@@ -186,8 +188,6 @@ dxf_tolerance_read
                 fprintf (stderr,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
-                /* Clean up. */
-                free (temp_string);
                 return (NULL);
         }
         if (tolerance == NULL)
@@ -197,265 +197,219 @@ dxf_tolerance_read
                   __FUNCTION__);
                 tolerance = dxf_tolerance_init (tolerance);
         }
-        (fp->line_number)++;
-        fscanf (fp->fp, "%[^\n]", temp_string);
-        while (strcmp (temp_string, "0") != 0)
+        while ((dxf_read_group_code (fp, &group_code) == EXIT_SUCCESS)
+          && (group_code != 0))
         {
-                if (ferror (fp->fp))
+                if (dxf_read_error (fp))
                 {
                         fprintf (stderr,
                           (_("Error in %s () while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
-                        fclose (fp->fp);
-                        /* Clean up. */
-                        free (temp_string);
                         return (NULL);
                 }
-                if (strcmp (temp_string, "3") == 0)
-                {
-                        /* Now follows a string containing the dimension
-                         * style name. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, tolerance->dimstyle_name);
-                }
-                if (strcmp (temp_string, "5") == 0)
-                {
-                        /* Now follows a string containing a sequential
-                         * id number. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%x\n", (uint *) &tolerance->id_code);
-                }
-                else if (strcmp (temp_string, "6") == 0)
-                {
-                        /* Now follows a string containing a linetype
-                         * name. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, tolerance->linetype);
-                }
-                else if (strcmp (temp_string, "8") == 0)
-                {
-                        /* Now follows a string containing a layer name. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, tolerance->layer);
-                }
-                else if (strcmp (temp_string, "10") == 0)
-                {
-                        /* Now follows a string containing the
-                         * X-coordinate of the insertion point. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &tolerance->p0->x0);
-                }
-                else if (strcmp (temp_string, "20") == 0)
-                {
-                        /* Now follows a string containing the
-                         * Y-coordinate of the insertion point. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &tolerance->p0->y0);
-                }
-                else if (strcmp (temp_string, "30") == 0)
-                {
-                        /* Now follows a string containing the
-                         * Z-coordinate of the insertion point. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &tolerance->p0->z0);
-                }
-                else if (strcmp (temp_string, "11") == 0)
-                {
-                        /* Now follows a string containing the
-                         * X-coordinate of the direction vector. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &tolerance->p1->x0);
-                }
-                else if (strcmp (temp_string, "21") == 0)
-                {
-                        /* Now follows a string containing the
-                         * Y-coordinate of the direction vector. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &tolerance->p1->y0);
-                }
-                else if (strcmp (temp_string, "31") == 0)
-                {
-                        /* Now follows a string containing the
-                         * Z-coordinate of the direction vector. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &tolerance->p1->z0);
-                }
-                else if ((fp->acad_version_number <= AutoCAD_11)
-                        && (strcmp (temp_string, "38") == 0))
-                {
-                        /* Now follows a string containing the
-                         * elevation. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &tolerance->elevation);
-                }
-                else if (strcmp (temp_string, "39") == 0)
-                {
-                        /* Now follows a string containing the
-                         * thickness. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &tolerance->thickness);
-                }
-                else if (strcmp (temp_string, "48") == 0)
-                {
-                        /* Now follows a string containing the linetype
-                         * scale. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &tolerance->linetype_scale);
-                }
-                else if (strcmp (temp_string, "60") == 0)
+                switch (group_code)
                 {
-                        /* Now follows a string containing the
-                         * visibility value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%hd\n", &tolerance->visibility);
-                }
-                else if (strcmp (temp_string, "62") == 0)
-                {
-                        /* Now follows a string containing the
-                         * color value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%d\n", &tolerance->color);
-                }
-                else if (strcmp (temp_string, "67") == 0)
-                {
-                        /* Now follows a string containing the
-                         * paperspace value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%d\n", &tolerance->paperspace);
-                }
-                else if (strcmp (temp_string, "92") == 0)
-                {
-                        /* Now follows a string containing the
-                         * graphics data size value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%d\n", &tolerance->graphics_data_size);
-                }
-                else if ((fp->acad_version_number >= AutoCAD_13)
-                        && (strcmp (temp_string, "100") == 0))
-                {
-                        /* Now follows a string containing the
-                         * subclass marker value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
-                        if ((strcmp (temp_string, "AcDbEntity") != 0)
-                        && ((strcmp (temp_string, "AcDbFcf") != 0)))
-                        {
+                        case 3:
+                                /* Now follows a string containing the dimension
+                                 * style name. */
+                                dxf_read_string_interned (fp, &tolerance->dimstyle_name);
+                                break;
+                        case 5:
+                                /* Now follows a string containing a sequential
+                                 * id number. */
+                                dxf_read_handle (fp, &tolerance->id_code);
+                                break;
+                        case 6:
+                                /* Now follows a string containing a linetype
+                                 * name. */
+                                dxf_read_string_interned (fp, &tolerance->linetype);
+                                break;
+                        case 8:
+                                /* Now follows a string containing a layer name. */
+                                dxf_read_string_interned (fp, &tolerance->layer);
+                                break;
+                        case 10:
+                                /* Now follows a string containing the
+                                 * X-coordinate of the insertion point. */
+                                dxf_read_double (fp, &tolerance->p0->x0);
+                                break;
+                        case 20:
+                                /* Now follows a string containing the
+                                 * Y-coordinate of the insertion point. */
+                                dxf_read_double (fp, &tolerance->p0->y0);
+                                break;
+                        case 30:
+                                /* Now follows a string containing the
+                                 * Z-coordinate of the insertion point. */
+                                dxf_read_double (fp, &tolerance->p0->z0);
+                                break;
+                        case 11:
+                                /* Now follows a string containing the
+                                 * X-coordinate of the direction vector. */
+                                dxf_read_double (fp, &tolerance->p1->x0);
+                                break;
+                        case 21:
+                                /* Now follows a string containing the
+                                 * Y-coordinate of the direction vector. */
+                                dxf_read_double (fp, &tolerance->p1->y0);
+                                break;
+                        case 31:
+                                /* Now follows a string containing the
+                                 * Z-coordinate of the direction vector. */
+                                dxf_read_double (fp, &tolerance->p1->z0);
+                                break;
+                        case 38:
+                                if (fp->acad_version_number <= AutoCAD_11)
+                                {
+                                        /* Now follows a string containing the
+                                         * elevation. */
+                                        dxf_read_double (fp, &tolerance->elevation);
+                                }
+                                else
+                                {
+                                        fprintf (stderr,
+                                          (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
+                                          __FUNCTION__, fp->filename, fp->line_number);
+                                        /* Skip the value of the unknown group code. */
+                                        dxf_read_line (temp_string, fp);
+                                }
+                                break;
+                        case 39:
+                                /* Now follows a string containing the
+                                 * thickness. */
+                                dxf_read_double (fp, &tolerance->thickness);
+                                break;
+                        case 48:
+                                /* Now follows a string containing the linetype
+                                 * scale. */
+                                dxf_read_double (fp, &tolerance->linetype_scale);
+                                break;
+                        case 60:
+                                /* Now follows a string containing the
+                                 * visibility value. */
+                                dxf_read_int16 (fp, &tolerance->visibility);
+                                break;
+                        case 62:
+                                /* Now follows a string containing the
+                                 * color value. */
+                                dxf_read_int (fp, &tolerance->color);
+                                break;
+                        case 67:
+                                /* Now follows a string containing the
+                                 * paperspace value. */
+                                dxf_read_int (fp, &tolerance->paperspace);
+                                break;
+                        case 92:
+                                /* Now follows a string containing the
+                                 * graphics data size value. */
+                                dxf_read_int (fp, &tolerance->graphics_data_size);
+                                break;
+                        case 100:
+                                if (fp->acad_version_number >= AutoCAD_13)
+                                {
+                                        /* Now follows a string containing the
+                                         * subclass marker value. */
+                                        dxf_read_line (temp_string, fp);
+                                        if ((strcmp (temp_string, "AcDbEntity") != 0)
+                                        && ((strcmp (temp_string, "AcDbFcf") != 0)))
+                                        {
+                                                fprintf (stderr,
+                                                  (_("Warning in %s () found a bad subclass marker in: %s in line: %d.\n")),
+                                                  __FUNCTION__, fp->filename, fp->line_number);
+                                        }
+                                }
+                                else
+                                {
+                                        fprintf (stderr,
+                                          (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
+                                          __FUNCTION__, fp->filename, fp->line_number);
+                                        /* Skip the value of the unknown group code. */
+                                        dxf_read_line (temp_string, fp);
+                                }
+                                break;
+                        case 160:
+                                /* Now follows a string containing the
+                                 * graphics data size value. */
+                                dxf_read_int (fp, &tolerance->graphics_data_size);
+                                break;
+                        case 210:
+                                /* Now follows a string containing the
+                                 * X-value of the extrusion vector. */
+                                dxf_read_double (fp, &tolerance->extr_x0);
+                                break;
+                        case 220:
+                                /* Now follows a string containing the
+                                 * Y-value of the extrusion vector. */
+                                dxf_read_double (fp, &tolerance->extr_y0);
+                                break;
+                        case 230:
+                                /* Now follows a string containing the
+                                 * Z-value of the extrusion vector. */
+                                dxf_read_double (fp, &tolerance->extr_z0);
+                                break;
+                        case 284:
+                                /* Now follows a string containing the shadow
+                                 * mode value. */
+                                dxf_read_int16 (fp, &tolerance->shadow_mode);
+                                break;
+                        case 310:
+                                /* Now follows a string containing binary
+                                 * graphics data. */
+                                dxf_read_string (fp, &tolerance->binary_graphics_data->data_line);
+                                dxf_binary_graphics_data_init ((DxfBinaryGraphicsData *) tolerance->binary_graphics_data->next);
+                                tolerance->binary_graphics_data = (DxfBinaryGraphicsData *) tolerance->binary_graphics_data->next;
+                                break;
+                        case 330:
+                                /* Now follows a string containing Soft-pointer
+                                 * ID/handle to owner dictionary. */
+                                dxf_read_handle (fp, &tolerance->dictionary_owner_soft);
+                                break;
+                        case 347:
+                                /* Now follows a string containing a
+                                 * hard-pointer ID/handle to material object. */
+                                dxf_read_handle (fp, &tolerance->material);
+                                break;
+                        case 360:
+                                /* Now follows a string containing Hard owner
+                                 * ID/handle to owner dictionary. */
+                                dxf_read_handle (fp, &tolerance->dictionary_owner_hard);
+                                break;
+                        case 370:
+                                /* Now follows a string containing the lineweight
+                                 * value. */
+                                dxf_read_int16 (fp, &tolerance->lineweight);
+                                break;
+                        case 390:
+                                /* Now follows a string containing a plot style
+                                 * name value. */
+                                dxf_read_handle (fp, &tolerance->plot_style_name);
+                                break;
+                        case 420:
+                                /* Now follows a string containing a color value. */
+                                dxf_read_long (fp, &tolerance->color_value);
+                                break;
+                        case 430:
+                                /* Now follows a string containing a color
+                                 * name value. */
+                                dxf_read_string_interned (fp, &tolerance->color_name);
+                                break;
+                        case 440:
+                                /* Now follows a string containing a transparency
+                                 * value. */
+                                dxf_read_long (fp, &tolerance->transparency);
+                                break;
+                        case 999:
+                                /* Now follows a string containing a comment. */
+                                dxf_read_line (temp_string, fp);
+                                fprintf (stdout, "DXF comment: %s\n", temp_string);
+                                break;
+                        default:
                                 fprintf (stderr,
-                                  (_("Warning in %s () found a bad subclass marker in: %s in line: %d.\n")),
+                                  (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
                                   __FUNCTION__, fp->filename, fp->line_number);
-                        }
-                }
-                else if (strcmp (temp_string, "160") == 0)
-                {
-                        /* Now follows a string containing the
-                         * graphics data size value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%d\n", &tolerance->graphics_data_size);
-                }
-                else if (strcmp (temp_string, "210") == 0)
-                {
-                        /* Now follows a string containing the
-                         * X-value of the extrusion vector. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &tolerance->extr_x0);
-                }
-                else if (strcmp (temp_string, "220") == 0)
-                {
-                        /* Now follows a string containing the
-                         * Y-value of the extrusion vector. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &tolerance->extr_y0);
-                }
-                else if (strcmp (temp_string, "230") == 0)
-                {
-                        /* Now follows a string containing the
-                         * Z-value of the extrusion vector. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &tolerance->extr_z0);
-                }
-                else if (strcmp (temp_string, "284") == 0)
-                {
-                        /* Now follows a string containing the shadow
-                         * mode value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%hd\n", &tolerance->shadow_mode);
-                }
-                else if (strcmp (temp_string, "310") == 0)
-                {
-                        /* Now follows a string containing binary
-                         * graphics data. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, tolerance->binary_graphics_data->data_line);
-                        dxf_binary_graphics_data_init ((DxfBinaryGraphicsData *) tolerance->binary_graphics_data->next);
-                        tolerance->binary_graphics_data = (DxfBinaryGraphicsData *) tolerance->binary_graphics_data->next;
-                }
-                else if (strcmp (temp_string, "330") == 0)
-                {
-                        /* Now follows a string containing Soft-pointer
-                         * ID/handle to owner dictionary. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, tolerance->dictionary_owner_soft);
-                }
-                else if (strcmp (temp_string, "347") == 0)
-                {
-                        /* Now follows a string containing a
-                         * hard-pointer ID/handle to material object. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, tolerance->material);
-                }
-                else if (strcmp (temp_string, "360") == 0)
-                {
-                        /* Now follows a string containing Hard owner
-                         * ID/handle to owner dictionary. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, tolerance->dictionary_owner_hard);
-                }
-                else if (strcmp (temp_string, "370") == 0)
-                {
-                        /* Now follows a string containing the lineweight
-                         * value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%hd\n", &tolerance->lineweight);
-                }
-                else if (strcmp (temp_string, "390") == 0)
-                {
-                        /* Now follows a string containing a plot style
-                         * name value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, tolerance->plot_style_name);
-                }
-                else if (strcmp (temp_string, "420") == 0)
-                {
-                        /* Now follows a string containing a color value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%ld\n", &tolerance->color_value);
-                }
-                else if (strcmp (temp_string, "430") == 0)
-                {
-                        /* Now follows a string containing a color
-                         * name value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, tolerance->color_name);
-                }
-                else if (strcmp (temp_string, "440") == 0)
-                {
-                        /* Now follows a string containing a transparency
-                         * value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%ld\n", &tolerance->transparency);
-                }
-                else if (strcmp (temp_string, "999") == 0)
-                {
-                        /* Now follows a string containing a comment. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
-                        fprintf (stdout, "DXF comment: %s\n", temp_string);
-                }
-                else
-                {
-                        fprintf (stderr,
-                          (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
-                          __FUNCTION__, fp->filename, fp->line_number);
+                                /* Skip the value of the unknown group code. */
+                                dxf_read_line (temp_string, fp);
+                                break;
                 }
         }
         /* Handle omitted members and/or illegal values. */
@@ -465,14 +419,12 @@ dxf_tolerance_read
         }
         if (strcmp (tolerance->linetype, "") == 0)
         {
-                tolerance->linetype = strdup (DXF_DEFAULT_LINETYPE);
+                tolerance->linetype = dxf_strdup (DXF_DEFAULT_LINETYPE);
         }
         if (strcmp (tolerance->layer, "") == 0)
         {
-                tolerance->layer = strdup (DXF_DEFAULT_LAYER);
+                tolerance->layer = dxf_strdup (DXF_DEFAULT_LAYER);
         }
-        /* Clean up. */
-        free (temp_string);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -498,7 +450,7 @@ dxf_tolerance_write
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        char *dxf_entity_name = strdup ("TOLERANCE");
+        char *dxf_entity_name = dxf_strdup ("TOLERANCE");
 
         /* Do some basic checks. */
         if (fp == NULL)
@@ -507,7 +459,7 @@ dxf_tolerance_write
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (tolerance == NULL)
@@ -516,33 +468,33 @@ dxf_tolerance_write
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (strcmp (tolerance->dimstyle_name, "") == 0)
         {
-                fprintf (stderr, "Error in dxf_tolerance_write () empty dimstyle name for the %s entity with id-code: %x.\n",
+                fprintf (stderr, "Error in dxf_tolerance_write () empty dimstyle name for the %s entity with id-code: %" PRIx64 ".\n",
                         dxf_entity_name, tolerance->id_code);
                 fprintf (stderr, "\tskipping %s entity.\n",
                         dxf_entity_name);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (strcmp (tolerance->linetype, "") == 0)
         {
                 fprintf (stderr,
-                  (_("Warning in %s () empty linetype string for the %s entity with id-code: %x\n")),
+                  (_("Warning in %s () empty linetype string for the %s entity with id-code: %" PRIx64 "\n")),
                   __FUNCTION__, dxf_entity_name, tolerance->id_code);
                 fprintf (stderr,
                   (_("\t%s entity is reset to default linetype")),
                   dxf_entity_name);
-                tolerance->linetype = strdup (DXF_DEFAULT_LINETYPE);
+                tolerance->linetype = dxf_strdup (DXF_DEFAULT_LINETYPE);
         }
         if (strcmp (tolerance->layer, "") == 0)
         {
                 fprintf (stderr,
-                  (_("Warning in %s () empty layer string for the %s entity with id-code: %x\n")),
+                  (_("Warning in %s () empty layer string for the %s entity with id-code: %" PRIx64 "\n")),
                   __FUNCTION__, dxf_entity_name, tolerance->id_code);
                 fprintf (stderr,
                   (_("\t%s entity is relocated to layer 0")),
@@ -550,10 +502,10 @@ dxf_tolerance_write
                 tolerance->layer = DXF_DEFAULT_LAYER;
         }
         /* Start writing output. */
-        fprintf (fp->fp, "  0\n%s\n", dxf_entity_name);
-        if (tolerance->id_code != -1)
+        dxf_write_string (fp, 0, dxf_entity_name);
+        if (tolerance->id_code != DXF_HANDLE_NONE)
         {
-                fprintf (fp->fp, "  5\n%x\n", tolerance->id_code);
+                dxf_write_hex (fp, 5, tolerance->id_code);
         }
         /*!
          * \todo for version R14.\n
@@ -565,67 +517,67 @@ dxf_tolerance_write
          * 102 groups are application defined (optional).\n\n
          * End of group, "}" (optional), with Group code 102.
          */
-        if ((strcmp (tolerance->dictionary_owner_soft, "") != 0)
+        if ((tolerance->dictionary_owner_soft != 0)
           && (fp->acad_version_number >= AutoCAD_14))
         {
-                fprintf (fp->fp, "102\n{ACAD_REACTORS\n");
-                fprintf (fp->fp, "330\n%s\n", tolerance->dictionary_owner_soft);
-                fprintf (fp->fp, "102\n}\n");
+                dxf_write_string (fp, 102, "{ACAD_REACTORS");
+                dxf_write_hex (fp, 330, tolerance->dictionary_owner_soft);
+                dxf_write_string (fp, 102, "}");
         }
-        if ((strcmp (tolerance->dictionary_owner_hard, "") != 0)
+        if ((tolerance->dictionary_owner_hard != 0)
           && (fp->acad_version_number >= AutoCAD_14))
         {
-                fprintf (fp->fp, "102\n{ACAD_XDICTIONARY\n");
-                fprintf (fp->fp, "360\n%s\n", tolerance->dictionary_owner_hard);
-                fprintf (fp->fp, "102\n}\n");
+                dxf_write_string (fp, 102, "{ACAD_XDICTIONARY");
+                dxf_write_hex (fp, 360, tolerance->dictionary_owner_hard);
+                dxf_write_string (fp, 102, "}");
         }
         if (fp->acad_version_number >= AutoCAD_13)
         {
-                fprintf (fp->fp, "100\nAcDbEntity\n");
+                dxf_write_string (fp, 100, "AcDbEntity");
         }
         if (tolerance->paperspace == DXF_PAPERSPACE)
         {
-                fprintf (fp->fp, " 67\n%d\n", (int16_t) DXF_PAPERSPACE);
+                dxf_write_int (fp, 67, (int16_t) DXF_PAPERSPACE);
         }
-        fprintf (fp->fp, "  8\n%s\n", tolerance->layer);
+        dxf_write_string (fp, 8, tolerance->layer);
         if (strcmp (tolerance->linetype, DXF_DEFAULT_LINETYPE) != 0)
         {
-                fprintf (fp->fp, "  6\n%s\n", tolerance->linetype);
+                dxf_write_string (fp, 6, tolerance->linetype);
         }
         if ((fp->acad_version_number >= AutoCAD_2008)
-          && (strcmp (tolerance->material, "") != 0))
+          && (tolerance->material != 0))
         {
-                fprintf (fp->fp, "347\n%s\n", tolerance->material);
+                dxf_write_hex (fp, 347, tolerance->material);
         }
         if (tolerance->color != DXF_COLOR_BYLAYER)
         {
-                fprintf (fp->fp, " 62\n%d\n", tolerance->color);
+                dxf_write_int (fp, 62, tolerance->color);
         }
         if (fp->acad_version_number >= AutoCAD_2002)
         {
-                fprintf (fp->fp, "370\n%d\n", tolerance->lineweight);
+                dxf_write_int (fp, 370, tolerance->lineweight);
         }
         if ((fp->acad_version_number <= AutoCAD_11)
           && DXF_FLATLAND
           && (tolerance->elevation != 0.0))
         {
-                fprintf (fp->fp, " 38\n%f\n", tolerance->elevation);
+                dxf_write_double (fp, 38, tolerance->elevation);
         }
         if (tolerance->linetype_scale != 1.0)
         {
-                fprintf (fp->fp, " 48\n%f\n", tolerance->linetype_scale);
+                dxf_write_double (fp, 48, tolerance->linetype_scale);
         }
         if (tolerance->visibility != 0)
         {
-                fprintf (fp->fp, " 60\n%d\n", tolerance->visibility);
+                dxf_write_int (fp, 60, tolerance->visibility);
         }
         if ((fp->acad_version_number >= AutoCAD_2000)
           && (tolerance->graphics_data_size > 0))
         {
 #ifdef BUILD_64
-                fprintf (fp->fp, "160\n%d\n", tolerance->graphics_data_size);
+                dxf_write_int (fp, 160, tolerance->graphics_data_size);
 #else
-                fprintf (fp->fp, " 92\n%d\n", tolerance->graphics_data_size);
+                dxf_write_int (fp, 92, tolerance->graphics_data_size);
 #endif
                 if (tolerance->binary_graphics_data != NULL)
                 {
@@ -633,48 +585,48 @@ dxf_tolerance_write
                         iter = tolerance->binary_graphics_data;
                         while (iter != NULL)
                         {
-                                fprintf (fp->fp, "310\n%s\n", dxf_binary_graphics_data_get_data_line (iter));
+                                dxf_write_string (fp, 310, dxf_binary_graphics_data_get_data_line (iter));
                                 iter = (DxfBinaryGraphicsData *) dxf_binary_graphics_data_get_next (iter);
                         }
                 }
         }
         if (fp->acad_version_number >= AutoCAD_2004)
         {
-                fprintf (fp->fp, "420\n%ld\n", tolerance->color_value);
-                fprintf (fp->fp, "430\n%s\n", tolerance->color_name);
-                fprintf (fp->fp, "440\n%ld\n", tolerance->transparency);
+                dxf_write_int (fp, 420, tolerance->color_value);
+                dxf_write_string (fp, 430, tolerance->color_name);
+                dxf_write_int (fp, 440, tolerance->transparency);
         }
         if (fp->acad_version_number >= AutoCAD_2009)
         {
-                fprintf (fp->fp, "390\n%s\n", tolerance->plot_style_name);
-                fprintf (fp->fp, "284\n%d\n", tolerance->shadow_mode);
+                dxf_write_hex (fp, 390, tolerance->plot_style_name);
+                dxf_write_int (fp, 284, tolerance->shadow_mode);
         }
         if (fp->acad_version_number >= AutoCAD_13)
         {
-                fprintf (fp->fp, "100\nAcDbFcf\n");
+                dxf_write_string (fp, 100, "AcDbFcf");
         }
         if (tolerance->thickness != 0.0)
         {
-                fprintf (fp->fp, " 39\n%f\n", tolerance->thickness);
+                dxf_write_double (fp, 39, tolerance->thickness);
         }
-        fprintf (fp->fp, "  3\n%s\n", tolerance->dimstyle_name);
-        fprintf (fp->fp, " 10\n%f\n", tolerance->p0->x0);
-        fprintf (fp->fp, " 20\n%f\n", tolerance->p0->y0);
-        fprintf (fp->fp, " 30\n%f\n", tolerance->p0->z0);
+        dxf_write_string (fp, 3, tolerance->dimstyle_name);
+        dxf_write_double (fp, 10, tolerance->p0->x0);
+        dxf_write_double (fp, 20, tolerance->p0->y0);
+        dxf_write_double (fp, 30, tolerance->p0->z0);
         if ((fp->acad_version_number >= AutoCAD_12)
                 && (tolerance->extr_x0 != 0.0)
                 && (tolerance->extr_y0 != 0.0)
                 && (tolerance->extr_z0 != 1.0))
         {
-                fprintf (fp->fp, "210\n%f\n", tolerance->extr_x0);
-                fprintf (fp->fp, "220\n%f\n", tolerance->extr_y0);
-                fprintf (fp->fp, "230\n%f\n", tolerance->extr_z0);
+                dxf_write_double (fp, 210, tolerance->extr_x0);
+                dxf_write_double (fp, 220, tolerance->extr_y0);
+                dxf_write_double (fp, 230, tolerance->extr_z0);
         }
-        fprintf (fp->fp, " 11\n%f\n", tolerance->p1->x0);
-        fprintf (fp->fp, " 21\n%f\n", tolerance->p1->y0);
-        fprintf (fp->fp, " 31\n%f\n", tolerance->p1->z0);
+        dxf_write_double (fp, 11, tolerance->p1->x0);
+        dxf_write_double (fp, 21, tolerance->p1->y0);
+        dxf_write_double (fp, 31, tolerance->p1->z0);
         /* Clean up. */
-        free (dxf_entity_name);
+        dxf_free (dxf_entity_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -715,12 +667,10 @@ dxf_tolerance_free
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        free (tolerance->dimstyle_name);
-        free (tolerance->linetype);
-        free (tolerance->layer);
-        free (tolerance->dictionary_owner_soft);
-        free (tolerance->dictionary_owner_hard);
-        free (tolerance);
+        dxf_string_free (tolerance->dimstyle_name);
+        dxf_string_free (tolerance->linetype);
+        dxf_string_free (tolerance->layer);
+        dxf_free (tolerance);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -766,7 +716,7 @@ dxf_tolerance_free_list
  *
  * \return \c id_code.
  */
-int
+uint64_t
 dxf_tolerance_get_id_code
 (
         DxfTolerance *tolerance
@@ -784,12 +734,6 @@ dxf_tolerance_get_id_code
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (tolerance->id_code < 0)
-        {
-                fprintf (stderr,
-                  (_("Warning in %s () a negative value was found.\n")),
-                  __FUNCTION__);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -805,7 +749,7 @@ dxf_tolerance_set_id_code
 (
         DxfTolerance *tolerance,
                 /*!< a pointer to a DXF \c TOLERANCE entity. */
-        int id_code
+        uint64_t id_code
                 /*!< the \c id_code to be set for the entity.\n
                  * This is to be an unique (sequential) number in the
                  * DXF file. */
@@ -822,12 +766,6 @@ dxf_tolerance_set_id_code
                   __FUNCTION__);
                 return (NULL);
         }
-        if (id_code < 0)
-        {
-                fprintf (stderr,
-                  (_("Warning in %s () a negative value was passed.\n")),
-                  __FUNCTION__);
-        }
         tolerance->id_code = id_code;
 #if DEBUG
         DXF_DEBUG_END
@@ -869,7 +807,7 @@ dxf_tolerance_get_linetype
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (tolerance->linetype));
+        return (dxf_strdup (tolerance->linetype));
 }
 
 
@@ -904,7 +842,7 @@ dxf_tolerance_set_linetype
                   __FUNCTION__);
                 return (NULL);
         }
-        tolerance->linetype = strdup (linetype);
+        tolerance->linetype = dxf_strdup (linetype);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -945,7 +883,7 @@ dxf_tolerance_get_layer
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (tolerance->layer));
+        return (dxf_strdup (tolerance->layer));
 }
 
 
@@ -980,7 +918,7 @@ dxf_tolerance_set_layer
                   __FUNCTION__);
                 return (NULL);
         }
-        tolerance->layer = strdup (layer);
+        tolerance->layer = dxf_strdup (layer);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1705,11 +1643,9 @@ dxf_tolerance_set_binary_graphics_data
  * \brief Get the pointer to the \c dictionary_owner_soft from a DXF 
  * \c TOLERANCE entity.
  *
- * \return pointer to the \c dictionary_owner_soft.
- *
- * \warning No checks are performed on the returned pointer (string).
+ * \return the handle of the \c dictionary_owner_soft.
  */
-char *
+uint64_t
 dxf_tolerance_get_dictionary_owner_soft
 (
         DxfTolerance *tolerance
@@ -1725,19 +1661,12 @@ dxf_tolerance_get_dictionary_owner_soft
                 fprintf (stderr,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
-                return (NULL);
-        }
-        if (tolerance->dictionary_owner_soft ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
+                return (0);
         }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (tolerance->dictionary_owner_soft));
+        return (tolerance->dictionary_owner_soft);
 }
 
 
@@ -1750,8 +1679,8 @@ dxf_tolerance_set_dictionary_owner_soft
 (
         DxfTolerance *tolerance,
                 /*!< a pointer to a DXF \c TOLERANCE entity. */
-        char *dictionary_owner_soft
-                /*!< a string containing the pointer to the \c
+        uint64_t dictionary_owner_soft
+                /*!< the handle of the \c
                  * dictionary_owner_soft for the entity. */
 )
 {
@@ -1766,14 +1695,7 @@ dxf_tolerance_set_dictionary_owner_soft
                   __FUNCTION__);
                 return (NULL);
         }
-        if (dictionary_owner_soft == NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was passed.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
-        tolerance->dictionary_owner_soft = strdup (dictionary_owner_soft);
+        tolerance->dictionary_owner_soft = dictionary_owner_soft;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1785,12 +1707,10 @@ dxf_tolerance_set_dictionary_owner_soft
  * \brief Get the pointer to the \c material from a DXF \c TOLERANCE
  * entity.
  *
- * \return a pointer to \c material when successful, or \c NULL when an
+ * \return the handle \c material when successful, or 0 when an
  * error occurred.
- *
- * \warning No checks are performed on the returned pointer.
  */
-char *
+uint64_t
 dxf_tolerance_get_material
 (
         DxfTolerance *tolerance
@@ -1806,19 +1726,12 @@ dxf_tolerance_get_material
                 fprintf (stderr,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
-                return (NULL);
-        }
-        if (tolerance->material ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
+                return (0);
         }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (tolerance->material));
+        return (tolerance->material);
 }
 
 
@@ -1834,8 +1747,8 @@ dxf_tolerance_set_material
 (
         DxfTolerance *tolerance,
                 /*!< a pointer to a DXF \c TOLERANCE entity. */
-        char *material
-                /*!< a string containing the pointer to the \c
+        uint64_t material
+                /*!< the handle of the \c
                  * material for the entity. */
 )
 {
@@ -1850,14 +1763,7 @@ dxf_tolerance_set_material
                   __FUNCTION__);
                 return (NULL);
         }
-        if (material == NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was passed.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
-        tolerance->material = strdup (material);
+        tolerance->material = material;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1869,11 +1775,9 @@ dxf_tolerance_set_material
  * \brief Get the pointer to the \c dictionary_owner_hard from a DXF 
  * \c TOLERANCE entity.
  *
- * \return pointer to the \c dictionary_owner_hard.
- *
- * \warning No checks are performed on the returned pointer (string).
+ * \return the handle of the \c dictionary_owner_hard.
  */
-char *
+uint64_t
 dxf_tolerance_get_dictionary_owner_hard
 (
         DxfTolerance *tolerance
@@ -1889,19 +1793,12 @@ dxf_tolerance_get_dictionary_owner_hard
                 fprintf (stderr,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
-                return (NULL);
-        }
-        if (tolerance->dictionary_owner_hard ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
+                return (0);
         }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (tolerance->dictionary_owner_hard));
+        return (tolerance->dictionary_owner_hard);
 }
 
 
@@ -1914,8 +1811,8 @@ dxf_tolerance_set_dictionary_owner_hard
 (
         DxfTolerance *tolerance,
                 /*!< a pointer to a DXF \c TOLERANCE entity. */
-        char *dictionary_owner_hard
-                /*!< a string containing the pointer to the \c
+        uint64_t dictionary_owner_hard
+                /*!< the handle of the \c
                  * dictionary_owner_hard for the entity. */
 )
 {
@@ -1930,14 +1827,7 @@ dxf_tolerance_set_dictionary_owner_hard
                   __FUNCTION__);
                 return (NULL);
         }
-        if (dictionary_owner_hard == NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was passed.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
-        tolerance->dictionary_owner_hard = strdup (dictionary_owner_hard);
+        tolerance->dictionary_owner_hard = dictionary_owner_hard;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2013,10 +1903,10 @@ dxf_tolerance_set_lineweight
 /*!
  * \brief Get the \c plot_style_name from a DXF \c TOLERANCE entity.
  *
- * \return a pointer to \c plot_style_name when sucessful, or \c NULL
+ * \return the handle \c plot_style_name when sucessful, or 0
  * when an error occurred.
  */
-char *
+uint64_t
 dxf_tolerance_get_plot_style_name
 (
         DxfTolerance *tolerance
@@ -2032,19 +1922,12 @@ dxf_tolerance_get_plot_style_name
                 fprintf (stderr,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
-                return (NULL);
-        }
-        if (tolerance->plot_style_name ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
+                return (0);
         }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (tolerance->plot_style_name));
+        return (tolerance->plot_style_name);
 }
 
 
@@ -2059,7 +1942,7 @@ dxf_tolerance_set_plot_style_name
 (
         DxfTolerance *tolerance,
                 /*!< a pointer to a DXF \c TOLERANCE entity. */
-        char *plot_style_name
+        uint64_t plot_style_name
                 /*!< a string containing the \c plot_style_name for the
                  * entity. */
 )
@@ -2075,14 +1958,7 @@ dxf_tolerance_set_plot_style_name
                   __FUNCTION__);
                 return (NULL);
         }
-        if (plot_style_name == NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was passed.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
-        tolerance->plot_style_name = strdup (plot_style_name);
+        tolerance->plot_style_name = plot_style_name;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2189,7 +2065,7 @@ dxf_tolerance_get_color_name
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (tolerance->color_name));
+        return (dxf_strdup (tolerance->color_name));
 }
 
 
@@ -2227,7 +2103,7 @@ dxf_tolerance_set_color_name
                   __FUNCTION__);
                 return (NULL);
         }
-        tolerance->color_name = strdup (color_name);
+        tolerance->color_name = dxf_strdup (color_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2334,7 +2210,7 @@ dxf_tolerance_get_dimstyle_name
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (tolerance->dimstyle_name));
+        return (dxf_strdup (tolerance->dimstyle_name));
 }
 
 
@@ -2372,7 +2248,7 @@ dxf_tolerance_set_dimstyle_name
                   __FUNCTION__);
                 return (NULL);
         }
-        tolerance->dimstyle_name = strdup (dimstyle_name);
+        tolerance->dimstyle_name = dxf_strdup (dimstyle_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -60,7 +60,7 @@ typedef struct
 dxf_tolerance_struct
 {
         /* Members common for all DXF drawable entities. */
-        int id_code;
+        uint64_t id_code;
                 /*!< Identification number for the entity.\n
                  * This is to be an unique (sequential) number in the DXF
                  * file.\n
@@ -133,16 +133,16 @@ dxf_tolerance_struct
                  * (optional).\n
                  * Group code = 310.\n
                  * \since Introduced in version R2000. */
-        char *dictionary_owner_soft;
+        uint64_t dictionary_owner_soft;
                 /*!< Soft-pointer ID/handle to owner dictionary (optional).\n
                  * Group code = 330.\n
                  * \since Introduced in version R14. */
-        char *material;
+        uint64_t material;
                 /*!< Hard-pointer ID/handle to material object (present if
                  * not BYLAYER).\n
                  * Group code = 347.\n
                  * \since Introduced in version R2008. */
-        char *dictionary_owner_hard;
+        uint64_t dictionary_owner_hard;
                 /*!< Hard owner ID/handle to owner dictionary (optional).\n
                  * Group code = 360.\n
                  * \since Introduced in version R14. */
@@ -151,7 +151,7 @@ dxf_tolerance_struct
                  * Stored and moved around as a 16-bit integer.\n
                  * Group code = 370.\n
                  * \since Introduced in version R2002. */
-        char *plot_style_name;
+        uint64_t plot_style_name;
                 /*!< Hard pointer ID / handle of PlotStyleName object.\n
                  * Group code = 390.\n
                  * \since Introduced in version R2009. */
@@ -217,8 +217,8 @@ DxfTolerance *dxf_tolerance_read (DxfFile *fp, DxfTolerance *tolerance);
 int dxf_tolerance_write (DxfFile *fp, DxfTolerance *tolerance);
 int dxf_tolerance_free (DxfTolerance *tolerance);
 void dxf_tolerance_free_list (DxfTolerance *tolerances);
-int dxf_tolerance_get_id_code (DxfTolerance *tolerance);
-DxfTolerance *dxf_tolerance_set_id_code (DxfTolerance *tolerance, int id_code);
+uint64_t dxf_tolerance_get_id_code (DxfTolerance *tolerance);
+DxfTolerance *dxf_tolerance_set_id_code (DxfTolerance *tolerance, uint64_t id_code);
 char *dxf_tolerance_get_linetype (DxfTolerance *tolerance);
 DxfTolerance *dxf_tolerance_set_linetype (DxfTolerance *tolerance, char *linetype);
 char *dxf_tolerance_get_layer (DxfTolerance *tolerance);
@@ -241,16 +241,16 @@ int16_t dxf_tolerance_get_shadow_mode (DxfTolerance *tolerance);
 DxfTolerance *dxf_tolerance_set_shadow_mode (DxfTolerance *tolerance, int16_t shadow_mode);
 DxfBinaryGraphicsData *dxf_tolerance_get_binary_graphics_data (DxfTolerance *tolerance);
 DxfTolerance *dxf_tolerance_set_binary_graphics_data (DxfTolerance *tolerance, DxfBinaryGraphicsData *data);
-char *dxf_tolerance_get_dictionary_owner_soft (DxfTolerance *tolerance);
-DxfTolerance *dxf_tolerance_set_dictionary_owner_soft (DxfTolerance *tolerance, char *dictionary_owner_soft);
-char *dxf_tolerance_get_material (DxfTolerance *tolerance);
-DxfTolerance *dxf_tolerance_set_material (DxfTolerance *tolerance, char *material);
-char *dxf_tolerance_get_dictionary_owner_hard (DxfTolerance *tolerance);
-DxfTolerance *dxf_tolerance_set_dictionary_owner_hard (DxfTolerance *tolerance, char *dictionary_owner_hard);
+uint64_t dxf_tolerance_get_dictionary_owner_soft (DxfTolerance *tolerance);
+DxfTolerance *dxf_tolerance_set_dictionary_owner_soft (DxfTolerance *tolerance, uint64_t dictionary_owner_soft);
+uint64_t dxf_tolerance_get_material (DxfTolerance *tolerance);
+DxfTolerance *dxf_tolerance_set_material (DxfTolerance *tolerance, uint64_t material);
+uint64_t dxf_tolerance_get_dictionary_owner_hard (DxfTolerance *tolerance);
+DxfTolerance *dxf_tolerance_set_dictionary_owner_hard (DxfTolerance *tolerance, uint64_t dictionary_owner_hard);
 int16_t dxf_tolerance_get_lineweight (DxfTolerance *tolerance);
 DxfTolerance *dxf_tolerance_set_lineweight (DxfTolerance *tolerance, int16_t lineweight);
-char *dxf_tolerance_get_plot_style_name (DxfTolerance *tolerance);
-DxfTolerance *dxf_tolerance_set_plot_style_name (DxfTolerance *tolerance, char *plot_style_name);
+uint64_t dxf_tolerance_get_plot_style_name (DxfTolerance *tolerance);
+DxfTolerance *dxf_tolerance_set_plot_style_name (DxfTolerance *tolerance, uint64_t plot_style_name);
 long dxf_tolerance_get_color_value (DxfTolerance *tolerance);
 DxfTolerance *dxf_tolerance_set_color_value (DxfTolerance *tolerance, long color_value);
 char *dxf_tolerance_get_color_name (DxfTolerance *tolerance);
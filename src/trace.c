@@ -42,6 +42,8 @@
 
 
 #include "trace.h"
+#include "bbox.h"
+#include "util.h"
 
 
 /*!
@@ -64,7 +66,7 @@ dxf_trace_new ()
         size = sizeof (DxfTrace);
         /* avoid malloc of 0 bytes */
         if (size == 0) size = 1;
-        if ((trace = malloc (size)) == NULL)
+        if ((trace = dxf_malloc (size)) == NULL)
         {
                 fprintf (stderr,
                   (_("Error in %s () could not allocate memory for a DxfTrace struct.\n")),
@@ -114,9 +116,9 @@ dxf_trace_init
                   __FUNCTION__);
                 return (NULL);
         }
-        trace->id_code = 0;
-        trace->linetype = strdup (DXF_DEFAULT_LINETYPE);
-        trace->layer = strdup (DXF_DEFAULT_LAYER);
+        trace->id_code = DXF_HANDLE_NONE;
+        trace->linetype = dxf_strdup (DXF_DEFAULT_LINETYPE);
+        trace->layer = dxf_strdup (DXF_DEFAULT_LAYER);
         trace->elevation = 0.0;
         trace->thickness = 0.0;
         trace->linetype_scale = DXF_DEFAULT_LINETYPE_SCALE;
@@ -127,23 +129,31 @@ dxf_trace_init
         trace->shadow_mode = 0;
         trace->binary_graphics_data = (DxfBinaryGraphicsData *) dxf_binary_graphics_data_new ();
         trace->binary_graphics_data = (DxfBinaryGraphicsData *) dxf_binary_graphics_data_init ((DxfBinaryGraphicsData *) trace->binary_graphics_data);
-        trace->dictionary_owner_soft = strdup ("");
-        trace->material = strdup ("");
-        trace->dictionary_owner_hard = strdup ("");
+        trace->dictionary_owner_soft = 0;
+        trace->material = 0;
+        trace->dictionary_owner_hard = 0;
         trace->lineweight = 0;
-        trace->plot_style_name = strdup ("");
+        trace->plot_style_name = 0;
         trace->color_value = 0;
-        trace->color_name = strdup ("");
+        trace->color_name = dxf_strdup ("");
         trace->transparency = 0;
+        trace->p0 = (DxfPoint *) dxf_point_new ();
+        trace->p0 = dxf_point_init ((DxfPoint *) trace->p0);
         trace->p0->x0 = 0.0;
         trace->p0->y0 = 0.0;
         trace->p0->z0 = 0.0;
+        trace->p1 = (DxfPoint *) dxf_point_new ();
+        trace->p1 = dxf_point_init ((DxfPoint *) trace->p1);
         trace->p1->x0 = 0.0;
         trace->p1->y0 = 0.0;
         trace->p1->z0 = 0.0;
+        trace->p2 = (DxfPoint *) dxf_point_new ();
+        trace->p2 = dxf_point_init ((DxfPoint *) trace->p2);
         trace->p2->x0 = 0.0;
         trace->p2->y0 = 0.0;
         trace->p2->z0 = 0.0;
+        trace->p3 = (DxfPoint *) dxf_point_new ();
+        trace->p3 = dxf_point_init ((DxfPoint *) trace->p3);
         trace->p3->x0 = 0.0;
         trace->p3->y0 = 0.0;
         trace->p3->z0 = 0.0;
@@ -179,7 +189,8 @@ dxf_trace_read
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        char *temp_string = NULL;
+        char temp_string[DXF_MAX_STRING_LENGTH];
+        int group_code;
 
         /* Do some basic checks. */
         if (fp == NULL)
@@ -187,8 +198,6 @@ dxf_trace_read
                 fprintf (stderr,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
-                /* Clean up. */
-                free (temp_string);
                 return (NULL);
         }
         if (trace == NULL)
@@ -198,314 +207,255 @@ dxf_trace_read
                   __FUNCTION__);
                 trace = dxf_trace_init (trace);
         }
-        (fp->line_number)++;
-        fscanf (fp->fp, "%[^\n]", temp_string);
-        while (strcmp (temp_string, "0") != 0)
+        while ((dxf_read_group_code (fp, &group_code) == EXIT_SUCCESS)
+          && (group_code != 0))
         {
-                if (ferror (fp->fp))
+                if (dxf_read_error (fp))
                 {
                         fprintf (stderr,
                           (_("Error in %s () while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
-                        fclose (fp->fp);
-                        /* Clean up. */
-                        free (temp_string);
                         return (NULL);
                 }
-                if (strcmp (temp_string, "5") == 0)
-                {
-                        /* Now follows a string containing a sequential
-                         * id number. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%x\n", (uint *) &trace->id_code);
-                }
-                else if (strcmp (temp_string, "6") == 0)
-                {
-                        /* Now follows a string containing a linetype
-                         * name. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, trace->linetype);
-                }
-                else if (strcmp (temp_string, "8") == 0)
-                {
-                        /* Now follows a string containing a layer name. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, trace->layer);
-                }
-                else if (strcmp (temp_string, "10") == 0)
-                {
-                        /* Now follows a string containing the
-                         * X-coordinate of the base point. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &trace->p0->x0);
-                }
-                else if (strcmp (temp_string, "11") == 0)
-                {
-                        /* Now follows a string containing the
-                         * X-coordinate of the alignment point. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &trace->p1->x0);
-                }
-                else if (strcmp (temp_string, "12") == 0)
-                {
-                        /* Now follows a string containing the
-                         * X-coordinate of the alignment point. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &trace->p2->x0);
-                }
-                else if (strcmp (temp_string, "13") == 0)
-                {
-                        /* Now follows a string containing the
-                         * X-coordinate of the alignment point. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &trace->p3->x0);
-                }
-                else if (strcmp (temp_string, "20") == 0)
-                {
-                        /* Now follows a string containing the
-                         * Y-coordinate of the base point. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &trace->p0->y0);
-                }
-                else if (strcmp (temp_string, "21") == 0)
-                {
-                        /* Now follows a string containing the
-                         * Y-coordinate of the alignment point. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &trace->p1->y0);
-                }
-                else if (strcmp (temp_string, "22") == 0)
-                {
-                        /* Now follows a string containing the
-                         * Y-coordinate of the alignment point. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &trace->p2->y0);
-                }
-                else if (strcmp (temp_string, "23") == 0)
-                {
-                        /* Now follows a string containing the
-                         * Y-coordinate of the alignment point. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &trace->p3->y0);
-                }
-                else if (strcmp (temp_string, "30") == 0)
-                {
-                        /* Now follows a string containing the
-                         * Z-coordinate of the base point. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &trace->p0->z0);
-                }
-                else if (strcmp (temp_string, "31") == 0)
-                {
-                        /* Now follows a string containing the
-                         * Z-coordinate of the alignment point. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &trace->p1->z0);
-                }
-                else if (strcmp (temp_string, "32") == 0)
-                {
-                        /* Now follows a string containing the
-                         * Z-coordinate of the alignment point. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &trace->p2->z0);
-                }
-                else if (strcmp (temp_string, "33") == 0)
+                switch (group_code)
                 {
-                        /* Now follows a string containing the
-                         * Z-coordinate of the alignment point. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &trace->p3->z0);
-                }
-                else if ((fp->acad_version_number <= AutoCAD_11)
-                        && (strcmp (temp_string, "38") == 0)
-                        && (trace->elevation != 0.0))
-                {
-                        /* Now follows a string containing the
-                         * elevation. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &trace->elevation);
-                }
-                else if (strcmp (temp_string, "39") == 0)
-                {
-                        /* Now follows a string containing the
-                         * thickness. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &trace->thickness);
-                }
-                else if (strcmp (temp_string, "48") == 0)
-                {
-                        /* Now follows a string containing the linetype
-                         * scale. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &trace->linetype_scale);
-                }
-                else if (strcmp (temp_string, "60") == 0)
-                {
-                        /* Now follows a string containing the
-                         * visibility value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%hd\n", &trace->visibility);
-                }
-                else if (strcmp (temp_string, "62") == 0)
-                {
-                        /* Now follows a string containing the
-                         * color value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%d\n", &trace->color);
-                }
-                else if (strcmp (temp_string, "67") == 0)
-                {
-                        /* Now follows a string containing the
-                         * paperspace value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%d\n", &trace->paperspace);
-                }
-                else if (strcmp (temp_string, "92") == 0)
-                {
-                        /* Now follows a string containing the
-                         * graphics data size value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%d\n", &trace->graphics_data_size);
-                }
-                else if ((fp->acad_version_number >= AutoCAD_13)
-                        && (strcmp (temp_string, "100") == 0))
-                {
-                        /* Now follows a string containing the
-                         * subclass marker value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
-                        if ((strcmp (temp_string, "AcDbEntity") != 0)
-                        && ((strcmp (temp_string, "AcDbTrace") != 0)))
-                        {
+                        case 5:
+                                /* Now follows a string containing a sequential
+                                 * id number. */
+                                dxf_read_handle (fp, &trace->id_code);
+                                break;
+                        case 6:
+                                /* Now follows a string containing a linetype
+                                 * name. */
+                                dxf_read_string_interned (fp, &trace->linetype);
+                                break;
+                        case 8:
+                                /* Now follows a string containing a layer name. */
+                                dxf_read_string_interned (fp, &trace->layer);
+                                break;
+                        case 10:
+                                /* Now follows a string containing the
+                                 * X-coordinate of the base point. */
+                                dxf_read_double (fp, &trace->p0->x0);
+                                break;
+                        case 11:
+                                /* Now follows a string containing the
+                                 * X-coordinate of the alignment point. */
+                                dxf_read_double (fp, &trace->p1->x0);
+                                break;
+                        case 12:
+                                /* Now follows a string containing the
+                                 * X-coordinate of the alignment point. */
+                                dxf_read_double (fp, &trace->p2->x0);
+                                break;
+                        case 13:
+                                /* Now follows a string containing the
+                                 * X-coordinate of the alignment point. */
+                                dxf_read_double (fp, &trace->p3->x0);
+                                break;
+                        case 20:
+                                /* Now follows a string containing the
+                                 * Y-coordinate of the base point. */
+                                dxf_read_double (fp, &trace->p0->y0);
+                                break;
+                        case 21:
+                                /* Now follows a string containing the
+                                 * Y-coordinate of the alignment point. */
+                                dxf_read_double (fp, &trace->p1->y0);
+                                break;
+                        case 22:
+                                /* Now follows a string containing the
+                                 * Y-coordinate of the alignment point. */
+                                dxf_read_double (fp, &trace->p2->y0);
+                                break;
+                        case 23:
+                                /* Now follows a string containing the
+                                 * Y-coordinate of the alignment point. */
+                                dxf_read_double (fp, &trace->p3->y0);
+                                break;
+                        case 30:
+                                /* Now follows a string containing the
+                                 * Z-coordinate of the base point. */
+                                dxf_read_double (fp, &trace->p0->z0);
+                                break;
+                        case 31:
+                                /* Now follows a string containing the
+                                 * Z-coordinate of the alignment point. */
+                                dxf_read_double (fp, &trace->p1->z0);
+                                break;
+                        case 32:
+                                /* Now follows a string containing the
+                                 * Z-coordinate of the alignment point. */
+                                dxf_read_double (fp, &trace->p2->z0);
+                                break;
+                        case 33:
+                                /* Now follows a string containing the
+                                 * Z-coordinate of the alignment point. */
+                                dxf_read_double (fp, &trace->p3->z0);
+                                break;
+                        case 38:
+                                if ((fp->acad_version_number <= AutoCAD_11) && (trace->elevation != 0.0))
+                                {
+                                        /* Now follows a string containing the
+                                         * elevation. */
+                                        dxf_read_double (fp, &trace->elevation);
+                                }
+                                else
+                                {
+                                        fprintf (stderr,
+                                          (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
+                                          __FUNCTION__, fp->filename, fp->line_number);
+                                        /* Skip the value of the unknown group code. */
+                                        dxf_read_line (temp_string, fp);
+                                }
+                                break;
+                        case 39:
+                                /* Now follows a string containing the
+                                 * thickness. */
+                                dxf_read_double (fp, &trace->thickness);
+                                break;
+                        case 48:
+                                /* Now follows a string containing the linetype
+                                 * scale. */
+                                dxf_read_double (fp, &trace->linetype_scale);
+                                break;
+                        case 60:
+                                /* Now follows a string containing the
+                                 * visibility value. */
+                                dxf_read_int16 (fp, &trace->visibility);
+                                break;
+                        case 62:
+                                /* Now follows a string containing the
+                                 * color value. */
+                                dxf_read_int (fp, &trace->color);
+                                break;
+                        case 67:
+                                /* Now follows a string containing the
+                                 * paperspace value. */
+                                dxf_read_int (fp, &trace->paperspace);
+                                break;
+                        case 92:
+                                /* Now follows a string containing the
+                                 * graphics data size value. */
+                                dxf_read_int (fp, &trace->graphics_data_size);
+                                break;
+                        case 100:
+                                if (fp->acad_version_number >= AutoCAD_13)
+                                {
+                                        /* Now follows a string containing the
+                                         * subclass marker value. */
+                                        dxf_read_line (temp_string, fp);
+                                        if ((strcmp (temp_string, "AcDbEntity") != 0)
+                                        && ((strcmp (temp_string, "AcDbTrace") != 0)))
+                                        {
+                                                fprintf (stderr,
+                                                  (_("Warning in %s () found a bad subclass marker in: %s in line: %d.\n")),
+                                                  __FUNCTION__, fp->filename, fp->line_number);
+                                        }
+                                }
+                                else
+                                {
+                                        fprintf (stderr,
+                                          (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
+                                          __FUNCTION__, fp->filename, fp->line_number);
+                                        /* Skip the value of the unknown group code. */
+                                        dxf_read_line (temp_string, fp);
+                                }
+                                break;
+                        case 160:
+                                /* Now follows a string containing the
+                                 * graphics data size value. */
+                                dxf_read_int (fp, &trace->graphics_data_size);
+                                break;
+                        case 210:
+                                /* Now follows a string containing the
+                                 * X-value of the extrusion vector. */
+                                dxf_read_double (fp, &trace->extr_x0);
+                                break;
+                        case 220:
+                                /* Now follows a string containing the
+                                 * Y-value of the extrusion vector. */
+                                dxf_read_double (fp, &trace->extr_y0);
+                                break;
+                        case 230:
+                                /* Now follows a string containing the
+                                 * Z-value of the extrusion vector. */
+                                dxf_read_double (fp, &trace->extr_z0);
+                                break;
+                        case 284:
+                                /* Now follows a string containing the shadow
+                                 * mode value. */
+                                dxf_read_int16 (fp, &trace->shadow_mode);
+                                break;
+                        case 310:
+                                /* Now follows a string containing binary
+                                 * graphics data. */
+                                dxf_read_string (fp, &trace->binary_graphics_data->data_line);
+                                dxf_binary_graphics_data_init ((DxfBinaryGraphicsData *) trace->binary_graphics_data->next);
+                                trace->binary_graphics_data = (DxfBinaryGraphicsData *) trace->binary_graphics_data->next;
+                                break;
+                        case 330:
+                                /* Now follows a string containing Soft-pointer
+                                 * ID/handle to owner dictionary. */
+                                dxf_read_handle (fp, &trace->dictionary_owner_soft);
+                                break;
+                        case 347:
+                                /* Now follows a string containing a
+                                 * hard-pointer ID/handle to material object. */
+                                dxf_read_handle (fp, &trace->material);
+                                break;
+                        case 360:
+                                /* Now follows a string containing Hard owner
+                                 * ID/handle to owner dictionary. */
+                                dxf_read_handle (fp, &trace->dictionary_owner_hard);
+                                break;
+                        case 370:
+                                /* Now follows a string containing the lineweight
+                                 * value. */
+                                dxf_read_int16 (fp, &trace->lineweight);
+                                break;
+                        case 390:
+                                /* Now follows a string containing a plot style
+                                 * name value. */
+                                dxf_read_handle (fp, &trace->plot_style_name);
+                                break;
+                        case 420:
+                                /* Now follows a string containing a color value. */
+                                dxf_read_long (fp, &trace->color_value);
+                                break;
+                        case 430:
+                                /* Now follows a string containing a color
+                                 * name value. */
+                                dxf_read_string_interned (fp, &trace->color_name);
+                                break;
+                        case 440:
+                                /* Now follows a string containing a transparency
+                                 * value. */
+                                dxf_read_long (fp, &trace->transparency);
+                                break;
+                        case 999:
+                                /* Now follows a string containing a comment. */
+                                dxf_read_line (temp_string, fp);
+                                fprintf (stdout, "DXF comment: %s\n", temp_string);
+                                break;
+                        default:
                                 fprintf (stderr,
-                                  (_("Warning in %s () found a bad subclass marker in: %s in line: %d.\n")),
+                                  (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
                                   __FUNCTION__, fp->filename, fp->line_number);
-                        }
-                }
-                else if (strcmp (temp_string, "160") == 0)
-                {
-                        /* Now follows a string containing the
-                         * graphics data size value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%d\n", &trace->graphics_data_size);
-                }
-                else if (strcmp (temp_string, "210") == 0)
-                {
-                        /* Now follows a string containing the
-                         * X-value of the extrusion vector. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &trace->extr_x0);
-                }
-                else if (strcmp (temp_string, "220") == 0)
-                {
-                        /* Now follows a string containing the
-                         * Y-value of the extrusion vector. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &trace->extr_y0);
-                }
-                else if (strcmp (temp_string, "230") == 0)
-                {
-                        /* Now follows a string containing the
-                         * Z-value of the extrusion vector. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &trace->extr_z0);
-                }
-                else if (strcmp (temp_string, "284") == 0)
-                {
-                        /* Now follows a string containing the shadow
-                         * mode value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%hd\n", &trace->shadow_mode);
-                }
-                else if (strcmp (temp_string, "310") == 0)
-                {
-                        /* Now follows a string containing binary
-                         * graphics data. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, trace->binary_graphics_data->data_line);
-                        dxf_binary_graphics_data_init ((DxfBinaryGraphicsData *) trace->binary_graphics_data->next);
-                        trace->binary_graphics_data = (DxfBinaryGraphicsData *) trace->binary_graphics_data->next;
-                }
-                else if (strcmp (temp_string, "330") == 0)
-                {
-                        /* Now follows a string containing Soft-pointer
-                         * ID/handle to owner dictionary. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, trace->dictionary_owner_soft);
-                }
-                else if (strcmp (temp_string, "347") == 0)
-                {
-                        /* Now follows a string containing a
-                         * hard-pointer ID/handle to material object. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, trace->material);
-                }
-                else if (strcmp (temp_string, "360") == 0)
-                {
-                        /* Now follows a string containing Hard owner
-                         * ID/handle to owner dictionary. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, trace->dictionary_owner_hard);
-                }
-                else if (strcmp (temp_string, "370") == 0)
-                {
-                        /* Now follows a string containing the lineweight
-                         * value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%hd\n", &trace->lineweight);
-                }
-                else if (strcmp (temp_string, "390") == 0)
-                {
-                        /* Now follows a string containing a plot style
-                         * name value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, trace->plot_style_name);
-                }
-                else if (strcmp (temp_string, "420") == 0)
-                {
-                        /* Now follows a string containing a color value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%ld\n", &trace->color_value);
-                }
-                else if (strcmp (temp_string, "430") == 0)
-                {
-                        /* Now follows a string containing a color
-                         * name value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, trace->color_name);
-                }
-                else if (strcmp (temp_string, "440") == 0)
-                {
-                        /* Now follows a string containing a transparency
-                         * value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%ld\n", &trace->transparency);
-                }
-                else if (strcmp (temp_string, "999") == 0)
-                {
-                        /* Now follows a string containing a comment. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
-                        fprintf (stdout, "DXF comment: %s\n", temp_string);
-                }
-                else
-                {
-                        fprintf (stderr,
-                          (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
-                          __FUNCTION__, fp->filename, fp->line_number);
+                                /* Skip the value of the unknown group code. */
+                                dxf_read_line (temp_string, fp);
+                                break;
                 }
         }
         /* Handle omitted members and/or illegal values. */
         if (strcmp (trace->linetype, "") == 0)
         {
-                trace->linetype = strdup (DXF_DEFAULT_LINETYPE);
+                trace->linetype = dxf_strdup (DXF_DEFAULT_LINETYPE);
         }
         if (strcmp (trace->layer, "") == 0)
         {
-                trace->layer = strdup (DXF_DEFAULT_LAYER);
+                trace->layer = dxf_strdup (DXF_DEFAULT_LAYER);
         }
-        /* Clean up. */
-        free (temp_string);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -531,7 +481,7 @@ dxf_trace_write
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        char *dxf_entity_name = strdup ("TRACE");
+        char *dxf_entity_name = dxf_strdup ("TRACE");
 
         /* Do some basic checks. */
         if (fp == NULL)
@@ -540,7 +490,7 @@ dxf_trace_write
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (trace == NULL)
@@ -549,34 +499,34 @@ dxf_trace_write
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (strcmp (trace->linetype, "") == 0)
         {
                 fprintf (stderr,
-                  (_("Warning in %s () empty linetype string for the %s entity with id-code: %x\n")),
+                  (_("Warning in %s () empty linetype string for the %s entity with id-code: %" PRIx64 "\n")),
                   __FUNCTION__, dxf_entity_name, trace->id_code);
                 fprintf (stderr,
                   (_("\t%s entity is reset to default linetype")),
                   dxf_entity_name);
-                trace->linetype = strdup (DXF_DEFAULT_LINETYPE);
+                trace->linetype = dxf_strdup (DXF_DEFAULT_LINETYPE);
         }
         if (strcmp (trace->layer, "") == 0)
         {
                 fprintf (stderr,
-                  (_("Warning in %s () empty layer string for the %s entity with id-code: %x\n")),
+                  (_("Warning in %s () empty layer string for the %s entity with id-code: %" PRIx64 "\n")),
                   __FUNCTION__, dxf_entity_name, trace->id_code);
                 fprintf (stderr,
                   (_("\t%s entity is relocated to layer 0")),
                   dxf_entity_name);
-                trace->layer = strdup (DXF_DEFAULT_LAYER);
+                trace->layer = dxf_strdup (DXF_DEFAULT_LAYER);
         }
         /* Start writing output. */
-        fprintf (fp->fp, "  0\n%s\n", dxf_entity_name);
-        if (trace->id_code != -1)
+        dxf_write_string (fp, 0, dxf_entity_name);
+        if (trace->id_code != DXF_HANDLE_NONE)
         {
-                fprintf (fp->fp, "  5\n%x\n", trace->id_code);
+                dxf_write_hex (fp, 5, trace->id_code);
         }
         /*!
          * \todo for version R14.\n
@@ -588,67 +538,67 @@ dxf_trace_write
          * 102 groups are application defined (optional).\n\n
          * End of group, "}" (optional), with Group code 102.
          */
-        if ((strcmp (trace->dictionary_owner_soft, "") != 0)
+        if ((trace->dictionary_owner_soft != 0)
           && (fp->acad_version_number >= AutoCAD_14))
         {
-                fprintf (fp->fp, "102\n{ACAD_REACTORS\n");
-                fprintf (fp->fp, "330\n%s\n", trace->dictionary_owner_soft);
-                fprintf (fp->fp, "102\n}\n");
+                dxf_write_string (fp, 102, "{ACAD_REACTORS");
+                dxf_write_hex (fp, 330, trace->dictionary_owner_soft);
+                dxf_write_string (fp, 102, "}");
         }
-        if ((strcmp (trace->dictionary_owner_hard, "") != 0)
+        if ((trace->dictionary_owner_hard != 0)
           && (fp->acad_version_number >= AutoCAD_14))
         {
-                fprintf (fp->fp, "102\n{ACAD_XDICTIONARY\n");
-                fprintf (fp->fp, "360\n%s\n", trace->dictionary_owner_hard);
-                fprintf (fp->fp, "102\n}\n");
+                dxf_write_string (fp, 102, "{ACAD_XDICTIONARY");
+                dxf_write_hex (fp, 360, trace->dictionary_owner_hard);
+                dxf_write_string (fp, 102, "}");
         }
         if (fp->acad_version_number >= AutoCAD_13)
         {
-                fprintf (fp->fp, "100\nAcDbEntity\n");
+                dxf_write_string (fp, 100, "AcDbEntity");
         }
         if (trace->paperspace == DXF_PAPERSPACE)
         {
-                fprintf (fp->fp, " 67\n%d\n", (int16_t) DXF_PAPERSPACE);
+                dxf_write_int (fp, 67, (int16_t) DXF_PAPERSPACE);
         }
-        fprintf (fp->fp, "  8\n%s\n", trace->layer);
+        dxf_write_string (fp, 8, trace->layer);
         if (strcmp (trace->linetype, DXF_DEFAULT_LINETYPE) != 0)
         {
-                fprintf (fp->fp, "  6\n%s\n", trace->linetype);
+                dxf_write_string (fp, 6, trace->linetype);
         }
         if ((fp->acad_version_number >= AutoCAD_2008)
-          && (strcmp (trace->material, "") != 0))
+          && (trace->material != 0))
         {
-                fprintf (fp->fp, "347\n%s\n", trace->material);
+                dxf_write_hex (fp, 347, trace->material);
         }
         if (trace->color != DXF_COLOR_BYLAYER)
         {
-                fprintf (fp->fp, " 62\n%d\n", trace->color);
+                dxf_write_int (fp, 62, trace->color);
         }
         if (fp->acad_version_number >= AutoCAD_2002)
         {
-                fprintf (fp->fp, "370\n%d\n", trace->lineweight);
+                dxf_write_int (fp, 370, trace->lineweight);
         }
         if ((fp->acad_version_number <= AutoCAD_11)
           && DXF_FLATLAND
           && (trace->elevation != 0.0))
         {
-                fprintf (fp->fp, " 38\n%f\n", trace->elevation);
+                dxf_write_double (fp, 38, trace->elevation);
         }
         if (trace->linetype_scale != 1.0)
         {
-                fprintf (fp->fp, " 48\n%f\n", trace->linetype_scale);
+                dxf_write_double (fp, 48, trace->linetype_scale);
         }
         if (trace->visibility != 0)
         {
-                fprintf (fp->fp, " 60\n%d\n", trace->visibility);
+                dxf_write_int (fp, 60, trace->visibility);
         }
         if ((fp->acad_version_number >= AutoCAD_2000)
           && (trace->graphics_data_size > 0))
         {
 #ifdef BUILD_64
-                fprintf (fp->fp, "160\n%d\n", trace->graphics_data_size);
+                dxf_write_int (fp, 160, trace->graphics_data_size);
 #else
-                fprintf (fp->fp, " 92\n%d\n", trace->graphics_data_size);
+                dxf_write_int (fp, 92, trace->graphics_data_size);
 #endif
                 if (trace->binary_graphics_data != NULL)
                 {
@@ -656,53 +606,53 @@ dxf_trace_write
                         iter = trace->binary_graphics_data;
                         while (iter != NULL)
                         {
-                                fprintf (fp->fp, "310\n%s\n", dxf_binary_graphics_data_get_data_line (iter));
+                                dxf_write_string (fp, 310, dxf_binary_graphics_data_get_data_line (iter));
                                 iter = (DxfBinaryGraphicsData *) dxf_binary_graphics_data_get_next (iter);
                         }
                 }
         }
         if (fp->acad_version_number >= AutoCAD_2004)
         {
-                fprintf (fp->fp, "420\n%ld\n", trace->color_value);
-                fprintf (fp->fp, "430\n%s\n", trace->color_name);
-                fprintf (fp->fp, "440\n%ld\n", trace->transparency);
+                dxf_write_int (fp, 420, trace->color_value);
+                dxf_write_string (fp, 430, trace->color_name);
+                dxf_write_int (fp, 440, trace->transparency);
         }
         if (fp->acad_version_number >= AutoCAD_2009)
         {
-                fprintf (fp->fp, "390\n%s\n", trace->plot_style_name);
-                fprintf (fp->fp, "284\n%d\n", trace->shadow_mode);
+                dxf_write_hex (fp, 390, trace->plot_style_name);
+                dxf_write_int (fp, 284, trace->shadow_mode);
         }
         if (fp->acad_version_number >= AutoCAD_13)
         {
-                fprintf (fp->fp, "100\nAcDbTrace\n");
+                dxf_write_string (fp, 100, "AcDbTrace");
         }
         if (trace->thickness != 0.0)
         {
-                fprintf (fp->fp, " 39\n%f\n", trace->thickness);
-        }
-        fprintf (fp->fp, " 10\n%f\n", trace->p0->x0);
-        fprintf (fp->fp, " 20\n%f\n", trace->p0->y0);
-        fprintf (fp->fp, " 30\n%f\n", trace->p0->z0);
-        fprintf (fp->fp, " 11\n%f\n", trace->p1->x0);
-        fprintf (fp->fp, " 21\n%f\n", trace->p1->y0);
-        fprintf (fp->fp, " 31\n%f\n", trace->p1->z0);
-        fprintf (fp->fp, " 12\n%f\n", trace->p2->x0);
-        fprintf (fp->fp, " 22\n%f\n", trace->p2->y0);
-        fprintf (fp->fp, " 32\n%f\n", trace->p2->z0);
-        fprintf (fp->fp, " 13\n%f\n", trace->p3->x0);
-        fprintf (fp->fp, " 23\n%f\n", trace->p3->y0);
-        fprintf (fp->fp, " 33\n%f\n", trace->p3->z0);
+                dxf_write_double (fp, 39, trace->thickness);
+        }
+        dxf_write_double (fp, 10, trace->p0->x0);
+        dxf_write_double (fp, 20, trace->p0->y0);
+        dxf_write_double (fp, 30, trace->p0->z0);
+        dxf_write_double (fp, 11, trace->p1->x0);
+        dxf_write_double (fp, 21, trace->p1->y0);
+        dxf_write_double (fp, 31, trace->p1->z0);
+        dxf_write_double (fp, 12, trace->p2->x0);
+        dxf_write_double (fp, 22, trace->p2->y0);
+        dxf_write_double (fp, 32, trace->p2->z0);
+        dxf_write_double (fp, 13, trace->p3->x0);
+        dxf_write_double (fp, 23, trace->p3->y0);
+        dxf_write_double (fp, 33, trace->p3->z0);
         if ((fp->acad_version_number >= AutoCAD_12)
                 && (trace->extr_x0 != 0.0)
                 && (trace->extr_y0 != 0.0)
                 && (trace->extr_z0 != 1.0))
         {
-                fprintf (fp->fp, "210\n%f\n", trace->extr_x0);
-                fprintf (fp->fp, "220\n%f\n", trace->extr_y0);
-                fprintf (fp->fp, "230\n%f\n", trace->extr_z0);
+                dxf_write_double (fp, 210, trace->extr_x0);
+                dxf_write_double (fp, 220, trace->extr_y0);
+                dxf_write_double (fp, 230, trace->extr_z0);
         }
         /* Clean up. */
-        free (dxf_entity_name);
+        dxf_free (dxf_entity_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -743,19 +693,15 @@ dxf_trace_free
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        free (trace->linetype);
-        free (trace->layer);
+        dxf_string_free (trace->linetype);
+        dxf_string_free (trace->layer);
         dxf_binary_graphics_data_free_list (trace->binary_graphics_data);
-        free (trace->dictionary_owner_soft);
-        free (trace->material);
-        free (trace->dictionary_owner_hard);
-        free (trace->plot_style_name);
-        free (trace->color_name);
+        dxf_string_free (trace->color_name);
         dxf_point_free (trace->p0);
         dxf_point_free (trace->p1);
         dxf_point_free (trace->p2);
         dxf_point_free (trace->p3);
-        free (trace);
+        dxf_free (trace);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -801,7 +747,7 @@ dxf_trace_free_list
  *
  * \return \c id_code.
  */
-int
+uint64_t
 dxf_trace_get_id_code
 (
         DxfTrace *trace
@@ -819,12 +765,6 @@ dxf_trace_get_id_code
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (trace->id_code < 0)
-        {
-                fprintf (stderr,
-                  (_("Warning in %s () a negative value was found.\n")),
-                  __FUNCTION__);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -840,7 +780,7 @@ dxf_trace_set_id_code
 (
         DxfTrace *trace,
                 /*!< a pointer to a DXF \c TRACE entity. */
-        int id_code
+        uint64_t id_code
                 /*!< the \c id_code to be set for the entity.\n
                  * This is to be an unique (sequential) number in the
                  * DXF file. */
@@ -857,12 +797,6 @@ dxf_trace_set_id_code
                   __FUNCTION__);
                 return (NULL);
         }
-        if (id_code < 0)
-        {
-                fprintf (stderr,
-                  (_("Warning in %s () a negative value was passed.\n")),
-                  __FUNCTION__);
-        }
         trace->id_code = id_code;
 #if DEBUG
         DXF_DEBUG_END
@@ -904,7 +838,7 @@ dxf_trace_get_linetype
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (trace->linetype));
+        return (dxf_strdup (trace->linetype));
 }
 
 
@@ -939,7 +873,7 @@ dxf_trace_set_linetype
                   __FUNCTION__);
                 return (NULL);
         }
-        trace->linetype = strdup (linetype);
+        trace->linetype = dxf_strdup (linetype);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -980,7 +914,7 @@ dxf_trace_get_layer
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (trace->layer));
+        return (dxf_strdup (trace->layer));
 }
 
 
@@ -1015,7 +949,7 @@ dxf_trace_set_layer
                   __FUNCTION__);
                 return (NULL);
         }
-        trace->layer = strdup (layer);
+        trace->layer = dxf_strdup (layer);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1737,11 +1671,9 @@ dxf_trace_set_binary_graphics_data
  * \brief Get the pointer to the \c dictionary_owner_soft from a DXF 
  * \c TRACE entity.
  *
- * \return pointer to the \c dictionary_owner_soft.
- *
- * \warning No checks are performed on the returned pointer (string).
+ * \return the handle of the \c dictionary_owner_soft.
  */
-char *
+uint64_t
 dxf_trace_get_dictionary_owner_soft
 (
         DxfTrace *trace
@@ -1757,19 +1689,12 @@ dxf_trace_get_dictionary_owner_soft
                 fprintf (stderr,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
-                return (NULL);
-        }
-        if (trace->dictionary_owner_soft ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
+                return (0);
         }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (trace->dictionary_owner_soft));
+        return (trace->dictionary_owner_soft);
 }
 
 
@@ -1782,8 +1707,8 @@ dxf_trace_set_dictionary_owner_soft
 (
         DxfTrace *trace,
                 /*!< a pointer to a DXF \c TRACE entity. */
-        char *dictionary_owner_soft
-                /*!< a string containing the pointer to the \c
+        uint64_t dictionary_owner_soft
+                /*!< the handle of the \c
                  * dictionary_owner_soft for the entity. */
 )
 {
@@ -1798,14 +1723,7 @@ dxf_trace_set_dictionary_owner_soft
                   __FUNCTION__);
                 return (NULL);
         }
-        if (dictionary_owner_soft == NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was passed.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
-        trace->dictionary_owner_soft = strdup (dictionary_owner_soft);
+        trace->dictionary_owner_soft = dictionary_owner_soft;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1816,12 +1734,10 @@ dxf_trace_set_dictionary_owner_soft
 /*!
  * \brief Get the pointer to the \c material from a DXF \c TRACE entity.
  *
- * \return a pointer to \c material when successful, or \c NULL when an
+ * \return the handle \c material when successful, or 0 when an
  * error occurred.
- *
- * \warning No checks are performed on the returned pointer.
  */
-char *
+uint64_t
 dxf_trace_get_material
 (
         DxfTrace *trace
@@ -1837,19 +1753,12 @@ dxf_trace_get_material
                 fprintf (stderr,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
-                return (NULL);
-        }
-        if (trace->material ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
+                return (0);
         }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (trace->material));
+        return (trace->material);
 }
 
 
@@ -1864,8 +1773,8 @@ dxf_trace_set_material
 (
         DxfTrace *trace,
                 /*!< a pointer to a DXF \c TRACE entity. */
-        char *material
-                /*!< a string containing the pointer to the \c
+        uint64_t material
+                /*!< the handle of the \c
                  * material for the entity. */
 )
 {
@@ -1880,14 +1789,7 @@ dxf_trace_set_material
                   __FUNCTION__);
                 return (NULL);
         }
-        if (material == NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was passed.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
-        trace->material = strdup (material);
+        trace->material = material;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1899,11 +1801,9 @@ dxf_trace_set_material
  * \brief Get the pointer to the \c dictionary_owner_hard from a DXF 
  * \c TRACE entity.
  *
- * \return pointer to the \c dictionary_owner_hard.
- *
- * \warning No checks are performed on the returned pointer (string).
+ * \return the handle of the \c dictionary_owner_hard.
  */
-char *
+uint64_t
 dxf_trace_get_dictionary_owner_hard
 (
         DxfTrace *trace
@@ -1919,19 +1819,12 @@ dxf_trace_get_dictionary_owner_hard
                 fprintf (stderr,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
-                return (NULL);
-        }
-        if (trace->dictionary_owner_hard ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
+                return (0);
         }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (trace->dictionary_owner_hard));
+        return (trace->dictionary_owner_hard);
 }
 
 
@@ -1944,8 +1837,8 @@ dxf_trace_set_dictionary_owner_hard
 (
         DxfTrace *trace,
                 /*!< a pointer to a DXF \c TRACE entity. */
-        char *dictionary_owner_hard
-                /*!< a string containing the pointer to the \c
+        uint64_t dictionary_owner_hard
+                /*!< the handle of the \c
                  * dictionary_owner_hard for the entity. */
 )
 {
@@ -1960,14 +1853,7 @@ dxf_trace_set_dictionary_owner_hard
                   __FUNCTION__);
                 return (NULL);
         }
-        if (dictionary_owner_hard == NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was passed.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
-        trace->dictionary_owner_hard = strdup (dictionary_owner_hard);
+        trace->dictionary_owner_hard = dictionary_owner_hard;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2043,10 +1929,10 @@ dxf_trace_set_lineweight
 /*!
  * \brief Get the \c plot_style_name from a DXF \c TRACE entity.
  *
- * \return a pointer to \c plot_style_name when sucessful, or \c NULL
+ * \return the handle \c plot_style_name when sucessful, or 0
  * when an error occurred.
  */
-char *
+uint64_t
 dxf_trace_get_plot_style_name
 (
         DxfTrace *trace
@@ -2062,19 +1948,12 @@ dxf_trace_get_plot_style_name
                 fprintf (stderr,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
-                return (NULL);
-        }
-        if (trace->plot_style_name ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
+                return (0);
         }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (trace->plot_style_name));
+        return (trace->plot_style_name);
 }
 
 
@@ -2089,7 +1968,7 @@ dxf_trace_set_plot_style_name
 (
         DxfTrace *trace,
                 /*!< a pointer to a DXF \c TRACE entity. */
-        char *plot_style_name
+        uint64_t plot_style_name
                 /*!< a string containing the \c plot_style_name for the
                  * entity. */
 )
@@ -2105,14 +1984,7 @@ dxf_trace_set_plot_style_name
                   __FUNCTION__);
                 return (NULL);
         }
-        if (plot_style_name == NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was passed.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
-        trace->plot_style_name = strdup (plot_style_name);
+        trace->plot_style_name = plot_style_name;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2219,7 +2091,7 @@ dxf_trace_get_color_name
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (trace->color_name));
+        return (dxf_strdup (trace->color_name));
 }
 
 
@@ -2257,7 +2129,7 @@ dxf_trace_set_color_name
                   __FUNCTION__);
                 return (NULL);
         }
-        trace->color_name = strdup (color_name);
+        trace->color_name = dxf_strdup (color_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -4074,4 +3946,148 @@ dxf_trace_get_last
 }
 
 
+/*!
+ * \brief Get the bounding box of a DXF \c TRACE.
+ *
+ * The box of the four corners of \c trace in it's Object Coordinate
+ * System (OCS), mapped to world coordinates, see
+ * dxf_bbox_ocs_to_wcs ().
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_trace_get_bbox
+(
+        DxfTrace *trace,
+                /*!< a pointer to a DXF \c TRACE entity. */
+        DxfBbox *bbox
+                /*!< a pointer to the libDXF bounding box to fill. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfPoint *corners[4];
+        DxfVec3 extrusion;
+        int i;
+
+        /* Do some basic checks. */
+        if ((trace == NULL) || (bbox == NULL))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        corners[0] = trace->p0;
+        corners[1] = trace->p1;
+        corners[2] = trace->p2;
+        corners[3] = trace->p3;
+        dxf_bbox_init (bbox);
+        for (i = 0; i < 4; i++)
+        {
+                if (corners[i] == NULL)
+                {
+                        fprintf (stderr,
+                          (_("Error in %s () a NULL pointer to a corner was found.\n")),
+                          __FUNCTION__);
+                        return (EXIT_FAILURE);
+                }
+                dxf_bbox_add_point (bbox, corners[i]->x0, corners[i]->y0, corners[i]->z0);
+        }
+        extrusion.x = trace->extr_x0;
+        extrusion.y = trace->extr_y0;
+        extrusion.z = trace->extr_z0;
+        dxf_bbox_ocs_to_wcs (bbox, &extrusion);
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Transform a DXF \c TRACE entity in place.
+ *
+ * The corners of the entity are in it's Object Coordinate System
+ * (OCS), \c transform has to map the plane of the OCS with a uniform
+ * scale, see dxf_transform_get_ocs_transform ().
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred, or when \c transform does not map the entity without
+ * distortion.
+ */
+int
+dxf_trace_transform
+(
+        DxfTrace *trace,
+                /*!< a pointer to a DXF \c TRACE entity. */
+        DxfTransform *transform
+                /*!< a pointer to a libDXF affine transformation. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfTransform ocs;
+        DxfVec3 extrusion;
+        DxfVec3 point;
+        DxfPoint *corners[4];
+        double scale;
+        int i;
+
+        /* Do some basic checks. */
+        if ((trace == NULL) || (transform == NULL))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        corners[0] = trace->p0;
+        corners[1] = trace->p1;
+        corners[2] = trace->p2;
+        corners[3] = trace->p3;
+        for (i = 0; i < 4; i++)
+        {
+                if (corners[i] == NULL)
+                {
+                        fprintf (stderr,
+                          (_("Error in %s () a NULL pointer to a corner was found.\n")),
+                          __FUNCTION__);
+                        return (EXIT_FAILURE);
+                }
+        }
+        extrusion.x = trace->extr_x0;
+        extrusion.y = trace->extr_y0;
+        extrusion.z = trace->extr_z0;
+        if (dxf_transform_get_ocs_transform (transform, &extrusion, &ocs, &scale) == EXIT_FAILURE)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () the transformation distorts the TRACE entity with id-code: %" PRIx64 "\n")),
+                  __FUNCTION__, trace->id_code);
+                return (EXIT_FAILURE);
+        }
+        for (i = 0; i < 4; i++)
+        {
+                point.x = corners[i]->x0;
+                point.y = corners[i]->y0;
+                point.z = corners[i]->z0;
+                dxf_transform_apply_point (&ocs, &point, &point);
+                corners[i]->x0 = point.x;
+                corners[i]->y0 = point.y;
+                corners[i]->z0 = point.z;
+        }
+        trace->extr_x0 = extrusion.x;
+        trace->extr_y0 = extrusion.y;
+        trace->extr_z0 = extrusion.z;
+        trace->thickness *= ocs.m[2][2];
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (EXIT_SUCCESS);
+}
+
+
 /* EOF */
@@ -46,6 +46,7 @@
 #include "global.h"
 #include "point.h"
 #include "binary_graphics_data.h"
+#include "transform.h"
 
 
 #ifdef __cplusplus
@@ -60,7 +61,7 @@ typedef struct
 dxf_trace_struct
 {
         /* Members common for all DXF drawable entities. */
-        int id_code;
+        uint64_t id_code;
                 /*!< Identification number for the entity.\n
                  * This is to be an unique (sequential) number in the DXF
                  * file.\n
@@ -133,16 +134,16 @@ dxf_trace_struct
                  * (optional).\n
                  * Group code = 310.\n
                  * \since Introduced in version R2000. */
-        char *dictionary_owner_soft;
+        uint64_t dictionary_owner_soft;
                 /*!< Soft-pointer ID/handle to owner dictionary (optional).\n
                  * Group code = 330.\n
                  * \since Introduced in version R14. */
-        char *material;
+        uint64_t material;
                 /*!< Hard-pointer ID/handle to material object (present if
                  * not BYLAYER).\n
                  * Group code = 347.\n
                  * \since Introduced in version R2008. */
-        char *dictionary_owner_hard;
+        uint64_t dictionary_owner_hard;
                 /*!< Hard owner ID/handle to owner dictionary (optional).\n
                  * Group code = 360.\n
                  * \since Introduced in version R14. */
@@ -151,7 +152,7 @@ dxf_trace_struct
                  * Stored and moved around as a 16-bit integer.\n
                  * Group code = 370.\n
                  * \since Introduced in version R2002. */
-        char *plot_style_name;
+        uint64_t plot_style_name;
                 /*!< Hard pointer ID / handle of PlotStyleName object.\n
                  * Group code = 390.\n
                  * \since Introduced in version R2009. */
@@ -220,8 +221,8 @@ DxfTrace *dxf_trace_read (DxfFile *fp, DxfTrace *trace);
 int dxf_trace_write (DxfFile *fp, DxfTrace *trace);
 int dxf_trace_free (DxfTrace *trace);
 void dxf_trace_free_list (DxfTrace *traces);
-int dxf_trace_get_id_code (DxfTrace *trace);
-DxfTrace *dxf_trace_set_id_code (DxfTrace *trace, int id_code);
+uint64_t dxf_trace_get_id_code (DxfTrace *trace);
+DxfTrace *dxf_trace_set_id_code (DxfTrace *trace, uint64_t id_code);
 char *dxf_trace_get_linetype (DxfTrace *trace);
 DxfTrace *dxf_trace_set_linetype (DxfTrace *trace, char *linetype);
 char *dxf_trace_get_layer (DxfTrace *trace);
@@ -244,16 +245,16 @@ int16_t dxf_trace_get_shadow_mode (DxfTrace *trace);
 DxfTrace *dxf_trace_set_shadow_mode (DxfTrace *trace, int16_t shadow_mode);
 DxfBinaryGraphicsData *dxf_trace_get_binary_graphics_data (DxfTrace *trace);
 DxfTrace *dxf_trace_set_binary_graphics_data (DxfTrace *trace, DxfBinaryGraphicsData *data);
-char *dxf_trace_get_dictionary_owner_soft (DxfTrace *trace);
-DxfTrace *dxf_trace_set_dictionary_owner_soft (DxfTrace *trace, char *dictionary_owner_soft);
-char *dxf_trace_get_material (DxfTrace *trace);
-DxfTrace *dxf_trace_set_material (DxfTrace *trace, char *material);
-char *dxf_trace_get_dictionary_owner_hard (DxfTrace *trace);
-DxfTrace *dxf_trace_set_dictionary_owner_hard (DxfTrace *trace, char *dictionary_owner_hard);
+uint64_t dxf_trace_get_dictionary_owner_soft (DxfTrace *trace);
+DxfTrace *dxf_trace_set_dictionary_owner_soft (DxfTrace *trace, uint64_t dictionary_owner_soft);
+uint64_t dxf_trace_get_material (DxfTrace *trace);
+DxfTrace *dxf_trace_set_material (DxfTrace *trace, uint64_t material);
+uint64_t dxf_trace_get_dictionary_owner_hard (DxfTrace *trace);
+DxfTrace *dxf_trace_set_dictionary_owner_hard (DxfTrace *trace, uint64_t dictionary_owner_hard);
 int16_t dxf_trace_get_lineweight (DxfTrace *trace);
 DxfTrace *dxf_trace_set_lineweight (DxfTrace *trace, int16_t lineweight);
-char *dxf_trace_get_plot_style_name (DxfTrace *trace);
-DxfTrace *dxf_trace_set_plot_style_name (DxfTrace *trace, char *plot_style_name);
+uint64_t dxf_trace_get_plot_style_name (DxfTrace *trace);
+DxfTrace *dxf_trace_set_plot_style_name (DxfTrace *trace, uint64_t plot_style_name);
 long dxf_trace_get_color_value (DxfTrace *trace);
 DxfTrace *dxf_trace_set_color_value (DxfTrace *trace, long color_value);
 char *dxf_trace_get_color_name (DxfTrace *trace);
@@ -304,6 +305,8 @@ DxfTrace *dxf_trace_set_extr_z0 (DxfTrace *trace, double extr_z0);
 DxfTrace *dxf_trace_get_next (DxfTrace *trace);
 DxfTrace *dxf_trace_set_next (DxfTrace *trace, DxfTrace *next);
 DxfTrace *dxf_trace_get_last (DxfTrace *trace);
+int dxf_trace_get_bbox (DxfTrace *trace, DxfBbox *bbox);
+int dxf_trace_transform (DxfTrace *trace, DxfTransform *transform);
 
 
 #ifdef __cplusplus
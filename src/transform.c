@@ -0,0 +1,1213 @@
+/*!
+ * \file transform.c
+ *
+ * \author Copyright (C) 2026
+ * by Bert Timmerman <bert.timmerman@xs4all.nl>.
+ *
+ * \brief Functions for libDXF affine transformations.
+ *
+ * A transformation is a 3 by 4 matrix, it maps block coordinates to
+ * the coordinates of an \c INSERT, \c UCS coordinates to world
+ * coordinates, or the coordinates of an entity to it's place after a
+ * move, rotate, scale or mirror.\n
+ * Large numbers of coordinates are transformed in batches, four at a
+ * time when compiled for AVX2 (for example with -mavx2), two at a time
+ * when compiled for SSE2 (any x86-64 compiler), and one at a time
+ * otherwise.\n
+ * The per type functions (dxf_line_transform () and such) live with
+ * their entity, dxf_entity_transform () dispatches on the type name.
+ *
+ * <hr>
+ * <h1><b>Copyright Notices.</b></h1>\n
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License,
+ * or (at your option) any later version.\n\n
+ * This program is distributed in the hope that it will be useful, but
+ * <b>WITHOUT ANY WARRANTY</b>; without even the implied warranty of
+ * <b>MERCHANTABILITY</b> or <b>FITNESS FOR A PARTICULAR PURPOSE</b>.\n
+ * See the GNU General Public License for more details.\n\n
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to:\n
+ * Free Software Foundation, Inc.,\n
+ * 59 Temple Place,\n
+ * Suite 330,\n
+ * Boston,\n
+ * MA 02111 USA.\n
+ * \n
+ */
+
+
+
+#include <math.h>
+#if defined (__AVX2__)
+#include <immintrin.h>
+#elif defined (__SSE2__)
+#include <emmintrin.h>
+#endif
+
+#include "transform.h"
+#include "3dface.h"
+#include "arc.h"
+#include "circle.h"
+#include "ellipse.h"
+#include "hatch.h"
+#include "insert.h"
+#include "line.h"
+#include "lwpolyline.h"
+#include "mtext.h"
+#include "point.h"
+#include "polyline.h"
+#include "solid.h"
+#include "spline.h"
+#include "text.h"
+#include "trace.h"
+
+
+/*!
+ * \brief Initialize a libDXF affine transformation to the identity.
+ *
+ * \return a pointer to \c transform, or \c NULL when a \c NULL pointer
+ * was passed.
+ */
+DxfTransform *
+dxf_transform_init
+(
+        DxfTransform *transform
+                /*!< a pointer to a libDXF affine transformation. */
+)
+{
+        /* Do some basic checks. */
+        if (transform == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        memset (transform, 0, sizeof (DxfTransform));
+        transform->m[0][0] = 1.0;
+        transform->m[1][1] = 1.0;
+        transform->m[2][2] = 1.0;
+        return (transform);
+}
+
+
+/*!
+ * \brief Compose two libDXF affine transformations.
+ *
+ * \c result maps a point as \c b followed by \c a, and may be the same
+ * as \c a or \c b.
+ *
+ * \return a pointer to \c result, or \c NULL when a \c NULL pointer
+ * was passed.
+ */
+DxfTransform *
+dxf_transform_multiply
+(
+        DxfTransform *result,
+                /*!< a pointer to the composed transformation. */
+        DxfTransform *a,
+                /*!< a pointer to the transformation applied last. */
+        DxfTransform *b
+                /*!< a pointer to the transformation applied first. */
+)
+{
+        DxfTransform product;
+        int i;
+        int j;
+
+        /* Do some basic checks. */
+        if ((result == NULL) || (a == NULL) || (b == NULL))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        for (i = 0; i < 3; i++)
+        {
+                for (j = 0; j < 4; j++)
+                {
+                        product.m[i][j] = (a->m[i][0] * b->m[0][j])
+                          + (a->m[i][1] * b->m[1][j])
+                          + (a->m[i][2] * b->m[2][j]);
+                }
+                product.m[i][3] += a->m[i][3];
+        }
+        *result = product;
+        return (result);
+}
+
+
+/*!
+ * \brief Map a point with a libDXF affine transformation.
+ *
+ * \c result may be the same as \c point.
+ *
+ * \return a pointer to \c result, or \c NULL when a \c NULL pointer
+ * was passed.
+ */
+DxfVec3 *
+dxf_transform_apply_point
+(
+        DxfTransform *transform,
+                /*!< a pointer to a libDXF affine transformation. */
+        DxfVec3 *point,
+                /*!< a pointer to the point to map. */
+        DxfVec3 *result
+                /*!< a pointer to the mapped point. */
+)
+{
+        double x;
+        double y;
+        double z;
+
+        /* Do some basic checks. */
+        if ((transform == NULL) || (point == NULL) || (result == NULL))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        x = point->x;
+        y = point->y;
+        z = point->z;
+        result->x = (transform->m[0][0] * x) + (transform->m[0][1] * y)
+          + (transform->m[0][2] * z) + transform->m[0][3];
+        result->y = (transform->m[1][0] * x) + (transform->m[1][1] * y)
+          + (transform->m[1][2] * z) + transform->m[1][3];
+        result->z = (transform->m[2][0] * x) + (transform->m[2][1] * y)
+          + (transform->m[2][2] * z) + transform->m[2][3];
+        return (result);
+}
+
+
+/*!
+ * \brief Map a direction or displacement with a libDXF affine
+ * transformation, leaving out the translation.
+ *
+ * \c result may be the same as \c vector.
+ *
+ * \return a pointer to \c result, or \c NULL when a \c NULL pointer
+ * was passed.
+ */
+DxfVec3 *
+dxf_transform_apply_vector
+(
+        DxfTransform *transform,
+                /*!< a pointer to a libDXF affine transformation. */
+        DxfVec3 *vector,
+                /*!< a pointer to the vector to map. */
+        DxfVec3 *result
+                /*!< a pointer to the mapped vector. */
+)
+{
+        double x;
+        double y;
+        double z;
+
+        /* Do some basic checks. */
+        if ((transform == NULL) || (vector == NULL) || (result == NULL))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        x = vector->x;
+        y = vector->y;
+        z = vector->z;
+        result->x = (transform->m[0][0] * x) + (transform->m[0][1] * y)
+          + (transform->m[0][2] * z);
+        result->y = (transform->m[1][0] * x) + (transform->m[1][1] * y)
+          + (transform->m[1][2] * z);
+        result->z = (transform->m[2][0] * x) + (transform->m[2][1] * y)
+          + (transform->m[2][2] * z);
+        return (result);
+}
+
+
+/*!
+ * \brief Set a libDXF affine transformation from a 4x3 matrix written
+ * out in column major order.
+ *
+ * This is the layout of the 12 group code 40 values of a DXF
+ * \c SPATIAL_FILTER object.
+ *
+ * \return a pointer to \c transform, or \c NULL when a \c NULL pointer
+ * was passed.
+ */
+DxfTransform *
+dxf_transform_set_column_major
+(
+        DxfTransform *transform,
+                /*!< a pointer to a libDXF affine transformation. */
+        double *matrix
+                /*!< 12 values, the columns of the linear part
+                 * followed by the translation. */
+)
+{
+        int i;
+        int j;
+
+        /* Do some basic checks. */
+        if ((transform == NULL) || (matrix == NULL))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        for (j = 0; j < 4; j++)
+        {
+                for (i = 0; i < 3; i++)
+                {
+                        transform->m[i][j] = matrix[(3 * j) + i];
+                }
+        }
+        return (transform);
+}
+
+
+/*!
+ * \brief Get a libDXF affine transformation as a 4x3 matrix written
+ * out in column major order.
+ *
+ * \return a pointer to \c matrix, or \c NULL when a \c NULL pointer was
+ * passed.
+ */
+double *
+dxf_transform_get_column_major
+(
+        DxfTransform *transform,
+                /*!< a pointer to a libDXF affine transformation. */
+        double *matrix
+                /*!< returns 12 values, the columns of the linear part
+                 * followed by the translation. */
+)
+{
+        int i;
+        int j;
+
+        /* Do some basic checks. */
+        if ((transform == NULL) || (matrix == NULL))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        for (j = 0; j < 4; j++)
+        {
+                for (i = 0; i < 3; i++)
+                {
+                        matrix[(3 * j) + i] = transform->m[i][j];
+                }
+        }
+        return (matrix);
+}
+
+
+/*!
+ * \brief Compute the axes of the Object Coordinate System (OCS) of an
+ * extrusion direction with the arbitrary axis algorithm.
+ *
+ * A zero extrusion direction is taken as the world Z-axis.\n
+ * The operations are done in the same order as in the vector code of
+ * dxf_transform_ocs_to_wcs (), so both give identical results.
+ */
+static void
+dxf_transform_arbitrary_axis
+(
+        double nx,
+                /*!< X-value of the extrusion direction. */
+        double ny,
+                /*!< Y-value of the extrusion direction. */
+        double nz,
+                /*!< Z-value of the extrusion direction. */
+        DxfVec3 *ax,
+                /*!< returns the X-axis of the OCS. */
+        DxfVec3 *ay,
+                /*!< returns the Y-axis of the OCS. */
+        DxfVec3 *az
+                /*!< returns the Z-axis of the OCS. */
+)
+{
+        double length;
+
+        length = sqrt ((nx * nx) + (ny * ny) + (nz * nz));
+        if (length == 0.0)
+        {
+                nx = 0.0;
+                ny = 0.0;
+                nz = 1.0;
+                length = 1.0;
+        }
+        az->x = nx / length;
+        az->y = ny / length;
+        az->z = nz / length;
+        if ((fabs (az->x) < (1.0 / 64.0)) && (fabs (az->y) < (1.0 / 64.0)))
+        {
+                /* World Y-axis cross the extrusion direction. */
+                ax->x = az->z;
+                ax->y = 0.0;
+                ax->z = -az->x;
+        }
+        else
+        {
+                /* World Z-axis cross the extrusion direction. */
+                ax->x = -az->y;
+                ax->y = az->x;
+                ax->z = 0.0;
+        }
+        length = sqrt ((ax->x * ax->x) + (ax->y * ax->y) + (ax->z * ax->z));
+        ax->x = ax->x / length;
+        ax->y = ax->y / length;
+        ax->z = ax->z / length;
+        ay->x = (az->y * ax->z) - (az->z * ax->y);
+        ay->y = (az->z * ax->x) - (az->x * ax->z);
+        ay->z = (az->x * ax->y) - (az->y * ax->x);
+}
+
+
+/*!
+ * \brief Set a libDXF affine transformation to the mapping of Object
+ * Coordinate System (OCS) coordinates to world coordinates.
+ *
+ * The OCS of an entity follows from it's extrusion direction with the
+ * arbitrary axis algorithm.
+ *
+ * \return a pointer to \c transform, or \c NULL when a \c NULL pointer
+ * was passed.
+ */
+DxfTransform *
+dxf_transform_set_ocs
+(
+        DxfTransform *transform,
+                /*!< a pointer to a libDXF affine transformation. */
+        DxfVec3 *extrusion
+                /*!< a pointer to the extrusion direction. */
+)
+{
+        DxfVec3 ax;
+        DxfVec3 ay;
+        DxfVec3 az;
+
+        /* Do some basic checks. */
+        if ((transform == NULL) || (extrusion == NULL))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        dxf_transform_arbitrary_axis (extrusion->x, extrusion->y,
+          extrusion->z, &ax, &ay, &az);
+        transform->m[0][0] = ax.x;
+        transform->m[1][0] = ax.y;
+        transform->m[2][0] = ax.z;
+        transform->m[0][1] = ay.x;
+        transform->m[1][1] = ay.y;
+        transform->m[2][1] = ay.z;
+        transform->m[0][2] = az.x;
+        transform->m[1][2] = az.y;
+        transform->m[2][2] = az.z;
+        transform->m[0][3] = 0.0;
+        transform->m[1][3] = 0.0;
+        transform->m[2][3] = 0.0;
+        return (transform);
+}
+
+
+/*!
+ * \brief Get the transformation of the Object Coordinate System (OCS)
+ * coordinates of a planar entity.
+ *
+ * The plane of the entity is mapped by \c transform on a new plane,
+ * with a new extrusion direction and OCS.  \c result maps the OCS
+ * coordinates of the entity before the transformation to it's OCS
+ * coordinates after the transformation.\n
+ * The extrusion direction is the normal of the mapped plane, so
+ * \c result never mirrors within the plane, a mirrored entity gets an
+ * opposite extrusion direction instead.\n
+ * <tt>result->m[2][2]</tt> is the factor for the thickness of the
+ * entity, it is negative when the thickness direction is reversed.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when a \c NULL
+ * pointer was passed or when \c transform does not map the plane of the
+ * entity without distortion (with a uniform scale), in which case a
+ * circle would not stay a circle.
+ */
+int
+dxf_transform_get_ocs_transform
+(
+        DxfTransform *transform,
+                /*!< a pointer to the transformation in world
+                 * coordinates. */
+        DxfVec3 *extrusion,
+                /*!< a pointer to the extrusion direction of the entity,
+                 * returns the extrusion direction after the
+                 * transformation. */
+        DxfTransform *result,
+                /*!< returns the transformation of the OCS
+                 * coordinates. */
+        double *scale
+                /*!< returns the scale factor in the plane of the
+                 * entity, may be \c NULL. */
+)
+{
+        DxfTransform ocs_to_wcs;
+        DxfTransform wcs_to_ocs;
+        DxfVec3 ax;
+        DxfVec3 ay;
+        DxfVec3 normal;
+        double lx;
+        double ly;
+        int i;
+        int j;
+
+        /* Do some basic checks. */
+        if ((transform == NULL) || (extrusion == NULL) || (result == NULL))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        dxf_transform_set_ocs (&ocs_to_wcs, extrusion);
+        ax.x = ocs_to_wcs.m[0][0];
+        ax.y = ocs_to_wcs.m[1][0];
+        ax.z = ocs_to_wcs.m[2][0];
+        ay.x = ocs_to_wcs.m[0][1];
+        ay.y = ocs_to_wcs.m[1][1];
+        ay.z = ocs_to_wcs.m[2][1];
+        dxf_transform_apply_vector (transform, &ax, &ax);
+        dxf_transform_apply_vector (transform, &ay, &ay);
+        lx = sqrt ((ax.x * ax.x) + (ax.y * ax.y) + (ax.z * ax.z));
+        ly = sqrt ((ay.x * ay.x) + (ay.y * ay.y) + (ay.z * ay.z));
+        if ((lx == 0.0)
+          || (fabs (lx - ly) > (DXF_TRANSFORM_TOLERANCE * lx))
+          || (fabs ((ax.x * ay.x) + (ax.y * ay.y) + (ax.z * ay.z)) > (DXF_TRANSFORM_TOLERANCE * lx * ly)))
+        {
+                return (EXIT_FAILURE);
+        }
+        normal.x = (ax.y * ay.z) - (ax.z * ay.y);
+        normal.y = (ax.z * ay.x) - (ax.x * ay.z);
+        normal.z = (ax.x * ay.y) - (ax.y * ay.x);
+        /* The OCS axes are orthonormal, the inverse of the linear part
+         * is it's transpose. */
+        dxf_transform_set_ocs (&wcs_to_ocs, &normal);
+        for (i = 0; i < 3; i++)
+        {
+                for (j = i + 1; j < 3; j++)
+                {
+                        lx = wcs_to_ocs.m[i][j];
+                        wcs_to_ocs.m[i][j] = wcs_to_ocs.m[j][i];
+                        wcs_to_ocs.m[j][i] = lx;
+                }
+        }
+        dxf_transform_multiply (result, transform, &ocs_to_wcs);
+        dxf_transform_multiply (result, &wcs_to_ocs, result);
+        extrusion->x = wcs_to_ocs.m[2][0];
+        extrusion->y = wcs_to_ocs.m[2][1];
+        extrusion->z = wcs_to_ocs.m[2][2];
+        if (scale != NULL)
+        {
+                *scale = ly;
+        }
+        return (EXIT_SUCCESS);
+}
+
+
+#if defined (__AVX2__)
+/*!
+ * \brief Load four consecutive points and split them in vectors of
+ * their X-, Y- and Z-values.
+ */
+static inline void
+dxf_transform_load4
+(
+        const double *p,
+                /*!< the X-value of the first point. */
+        __m256d *x,
+                /*!< returns the X-values. */
+        __m256d *y,
+                /*!< returns the Y-values. */
+        __m256d *z
+                /*!< returns the Z-values. */
+)
+{
+        __m256d a;
+        __m256d b;
+        __m256d c;
+        __m256d p03;
+        __m256d q;
+
+        /* a = x0 y0 z0 x1, b = y1 z1 x2 y2, c = z2 x3 y3 z3. */
+        a = _mm256_loadu_pd (p);
+        b = _mm256_loadu_pd (p + 4);
+        c = _mm256_loadu_pd (p + 8);
+        /* p03 = x0 y0 y3 z3, q = z0 x1 z2 x3. */
+        p03 = _mm256_permute2f128_pd (a, c, 0x30);
+        q = _mm256_permute2f128_pd (a, c, 0x21);
+        *x = _mm256_blend_pd (_mm256_blend_pd (p03, q, 0xa), b, 0x4);
+        *y = _mm256_permute_pd (_mm256_shuffle_pd (p03, b, 0x9), 0x6);
+        *z = _mm256_blend_pd (_mm256_shuffle_pd (q, b, 0x2), p03, 0x8);
+}
+
+
+/*!
+ * \brief Store vectors of X-, Y- and Z-values as four consecutive
+ * points, the inverse of dxf_transform_load4 ().
+ */
+static inline void
+dxf_transform_store4
+(
+        double *p,
+                /*!< the X-value of the first point. */
+        __m256d x,
+                /*!< the X-values. */
+        __m256d y,
+                /*!< the Y-values. */
+        __m256d z
+                /*!< the Z-values. */
+)
+{
+        __m256d xy;
+        __m256d yz;
+        __m256d p03;
+        __m256d q;
+
+        /* xy = x0 y0 x2 y2, yz = y1 z1 y3 z3. */
+        xy = _mm256_unpacklo_pd (x, y);
+        yz = _mm256_unpackhi_pd (y, z);
+        p03 = _mm256_blend_pd (xy, yz, 0xc);
+        q = _mm256_blend_pd (z, x, 0xa);
+        _mm256_storeu_pd (p, _mm256_permute2f128_pd (p03, q, 0x20));
+        _mm256_storeu_pd (p + 4, _mm256_blend_pd (yz, xy, 0xc));
+        _mm256_storeu_pd (p + 8, _mm256_permute2f128_pd (q, p03, 0x31));
+}
+#elif defined (__SSE2__)
+/*!
+ * \brief Load two consecutive points and split them in vectors of
+ * their X-, Y- and Z-values.
+ */
+static inline void
+dxf_transform_load2
+(
+        const double *p,
+                /*!< the X-value of the first point. */
+        __m128d *x,
+                /*!< returns the X-values. */
+        __m128d *y,
+                /*!< returns the Y-values. */
+        __m128d *z
+                /*!< returns the Z-values. */
+)
+{
+        __m128d a;
+        __m128d b;
+        __m128d c;
+
+        /* a = x0 y0, b = z0 x1, c = y1 z1. */
+        a = _mm_loadu_pd (p);
+        b = _mm_loadu_pd (p + 2);
+        c = _mm_loadu_pd (p + 4);
+        *x = _mm_shuffle_pd (a, b, 0x2);
+        *y = _mm_shuffle_pd (a, c, 0x1);
+        *z = _mm_shuffle_pd (b, c, 0x2);
+}
+
+
+/*!
+ * \brief Store vectors of X-, Y- and Z-values as two consecutive
+ * points, the inverse of dxf_transform_load2 ().
+ */
+static inline void
+dxf_transform_store2
+(
+        double *p,
+                /*!< the X-value of the first point. */
+        __m128d x,
+                /*!< the X-values. */
+        __m128d y,
+                /*!< the Y-values. */
+        __m128d z
+                /*!< the Z-values. */
+)
+{
+        _mm_storeu_pd (p, _mm_unpacklo_pd (x, y));
+        _mm_storeu_pd (p + 2, _mm_shuffle_pd (z, x, 0x2));
+        _mm_storeu_pd (p + 4, _mm_unpackhi_pd (y, z));
+}
+
+
+/*!
+ * \brief Select the lanes of \c b where \c mask is set, and the lanes of
+ * \c a elsewhere.
+ */
+static inline __m128d
+dxf_transform_select2
+(
+        __m128d a,
+                /*!< the lanes for a clear mask. */
+        __m128d b,
+                /*!< the lanes for a set mask. */
+        __m128d mask
+                /*!< all ones or all zeros per lane. */
+)
+{
+        return (_mm_or_pd (_mm_and_pd (mask, b), _mm_andnot_pd (mask, a)));
+}
+#endif
+
+
+/*!
+ * \brief Map an array of points with a libDXF affine transformation.
+ *
+ * \c result may be the same array as \c points.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when a \c NULL
+ * pointer was passed.
+ */
+int
+dxf_transform_apply_points
+(
+        DxfTransform *transform,
+                /*!< a pointer to a libDXF affine transformation. */
+        DxfVec3 *points,
+                /*!< a pointer to the points to map. */
+        DxfVec3 *result,
+                /*!< a pointer to the mapped points. */
+        size_t number_points
+                /*!< Number of points. */
+)
+{
+        size_t i = 0;
+        double x;
+        double y;
+        double z;
+#if defined (__AVX2__)
+        __m256d m[3][4];
+        __m256d vx;
+        __m256d vy;
+        __m256d vz;
+        int j;
+        int k;
+#elif defined (__SSE2__)
+        __m128d m[3][4];
+        __m128d vx;
+        __m128d vy;
+        __m128d vz;
+        int j;
+        int k;
+#endif
+
+        /* Do some basic checks. */
+        if ((transform == NULL)
+          || (((points == NULL) || (result == NULL)) && (number_points > 0)))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+#if defined (__AVX2__)
+        for (j = 0; j < 3; j++)
+        {
+                for (k = 0; k < 4; k++)
+                {
+                        m[j][k] = _mm256_set1_pd (transform->m[j][k]);
+                }
+        }
+        for (; i + 4 <= number_points; i += 4)
+        {
+                dxf_transform_load4 (&points[i].x, &vx, &vy, &vz);
+                dxf_transform_store4 (&result[i].x,
+                  _mm256_add_pd (_mm256_add_pd (_mm256_add_pd (_mm256_mul_pd (m[0][0], vx),
+                    _mm256_mul_pd (m[0][1], vy)), _mm256_mul_pd (m[0][2], vz)), m[0][3]),
+                  _mm256_add_pd (_mm256_add_pd (_mm256_add_pd (_mm256_mul_pd (m[1][0], vx),
+                    _mm256_mul_pd (m[1][1], vy)), _mm256_mul_pd (m[1][2], vz)), m[1][3]),
+                  _mm256_add_pd (_mm256_add_pd (_mm256_add_pd (_mm256_mul_pd (m[2][0], vx),
+                    _mm256_mul_pd (m[2][1], vy)), _mm256_mul_pd (m[2][2], vz)), m[2][3]));
+        }
+#elif defined (__SSE2__)
+        for (j = 0; j < 3; j++)
+        {
+                for (k = 0; k < 4; k++)
+                {
+                        m[j][k] = _mm_set1_pd (transform->m[j][k]);
+                }
+        }
+        for (; i + 2 <= number_points; i += 2)
+        {
+                dxf_transform_load2 (&points[i].x, &vx, &vy, &vz);
+                dxf_transform_store2 (&result[i].x,
+                  _mm_add_pd (_mm_add_pd (_mm_add_pd (_mm_mul_pd (m[0][0], vx),
+                    _mm_mul_pd (m[0][1], vy)), _mm_mul_pd (m[0][2], vz)), m[0][3]),
+                  _mm_add_pd (_mm_add_pd (_mm_add_pd (_mm_mul_pd (m[1][0], vx),
+                    _mm_mul_pd (m[1][1], vy)), _mm_mul_pd (m[1][2], vz)), m[1][3]),
+                  _mm_add_pd (_mm_add_pd (_mm_add_pd (_mm_mul_pd (m[2][0], vx),
+                    _mm_mul_pd (m[2][1], vy)), _mm_mul_pd (m[2][2], vz)), m[2][3]));
+        }
+#endif
+        for (; i < number_points; i++)
+        {
+                x = points[i].x;
+                y = points[i].y;
+                z = points[i].z;
+                result[i].x = (transform->m[0][0] * x) + (transform->m[0][1] * y)
+                  + (transform->m[0][2] * z) + transform->m[0][3];
+                result[i].y = (transform->m[1][0] * x) + (transform->m[1][1] * y)
+                  + (transform->m[1][2] * z) + transform->m[1][3];
+                result[i].z = (transform->m[2][0] * x) + (transform->m[2][1] * y)
+                  + (transform->m[2][2] * z) + transform->m[2][3];
+        }
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Map points stored as separate arrays of X-, Y- and Z-values
+ * in place with a libDXF affine transformation.
+ *
+ * When \c z is \c NULL the points are taken in the plane Z = 0 and the
+ * mapped Z-values are dropped, as for the vertices of a
+ * \c LWPOLYLINE entity.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when a \c NULL
+ * pointer was passed.
+ */
+int
+dxf_transform_apply_arrays
+(
+        DxfTransform *transform,
+                /*!< a pointer to a libDXF affine transformation. */
+        double *x,
+                /*!< a pointer to the X-values. */
+        double *y,
+                /*!< a pointer to the Y-values. */
+        double *z,
+                /*!< a pointer to the Z-values, may be \c NULL. */
+        size_t number_points
+                /*!< Number of points. */
+)
+{
+        size_t i = 0;
+        double px;
+        double py;
+        double pz;
+#if defined (__AVX2__)
+        __m256d m[3][4];
+        __m256d vx;
+        __m256d vy;
+        __m256d vz;
+        int j;
+        int k;
+#elif defined (__SSE2__)
+        __m128d m[3][4];
+        __m128d vx;
+        __m128d vy;
+        __m128d vz;
+        int j;
+        int k;
+#endif
+
+        /* Do some basic checks. */
+        if ((transform == NULL)
+          || (((x == NULL) || (y == NULL)) && (number_points > 0)))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+#if defined (__AVX2__)
+        for (j = 0; j < 3; j++)
+        {
+                for (k = 0; k < 4; k++)
+                {
+                        m[j][k] = _mm256_set1_pd (transform->m[j][k]);
+                }
+        }
+        if (z == NULL)
+        {
+                for (; i + 4 <= number_points; i += 4)
+                {
+                        vx = _mm256_loadu_pd (x + i);
+                        vy = _mm256_loadu_pd (y + i);
+                        _mm256_storeu_pd (x + i, _mm256_add_pd (_mm256_add_pd (_mm256_mul_pd (m[0][0], vx),
+                          _mm256_mul_pd (m[0][1], vy)), m[0][3]));
+                        _mm256_storeu_pd (y + i, _mm256_add_pd (_mm256_add_pd (_mm256_mul_pd (m[1][0], vx),
+                          _mm256_mul_pd (m[1][1], vy)), m[1][3]));
+                }
+        }
+        else
+        {
+                for (; i + 4 <= number_points; i += 4)
+                {
+                        vx = _mm256_loadu_pd (x + i);
+                        vy = _mm256_loadu_pd (y + i);
+                        vz = _mm256_loadu_pd (z + i);
+                        _mm256_storeu_pd (x + i, _mm256_add_pd (_mm256_add_pd (_mm256_add_pd (_mm256_mul_pd (m[0][0], vx),
+                          _mm256_mul_pd (m[0][1], vy)), _mm256_mul_pd (m[0][2], vz)), m[0][3]));
+                        _mm256_storeu_pd (y + i, _mm256_add_pd (_mm256_add_pd (_mm256_add_pd (_mm256_mul_pd (m[1][0], vx),
+                          _mm256_mul_pd (m[1][1], vy)), _mm256_mul_pd (m[1][2], vz)), m[1][3]));
+                        _mm256_storeu_pd (z + i, _mm256_add_pd (_mm256_add_pd (_mm256_add_pd (_mm256_mul_pd (m[2][0], vx),
+                          _mm256_mul_pd (m[2][1], vy)), _mm256_mul_pd (m[2][2], vz)), m[2][3]));
+                }
+        }
+#elif defined (__SSE2__)
+        for (j = 0; j < 3; j++)
+        {
+                for (k = 0; k < 4; k++)
+                {
+                        m[j][k] = _mm_set1_pd (transform->m[j][k]);
+                }
+        }
+        if (z == NULL)
+        {
+                for (; i + 2 <= number_points; i += 2)
+                {
+                        vx = _mm_loadu_pd (x + i);
+                        vy = _mm_loadu_pd (y + i);
+                        _mm_storeu_pd (x + i, _mm_add_pd (_mm_add_pd (_mm_mul_pd (m[0][0], vx),
+                          _mm_mul_pd (m[0][1], vy)), m[0][3]));
+                        _mm_storeu_pd (y + i, _mm_add_pd (_mm_add_pd (_mm_mul_pd (m[1][0], vx),
+                          _mm_mul_pd (m[1][1], vy)), m[1][3]));
+                }
+        }
+        else
+        {
+                for (; i + 2 <= number_points; i += 2)
+                {
+                        vx = _mm_loadu_pd (x + i);
+                        vy = _mm_loadu_pd (y + i);
+                        vz = _mm_loadu_pd (z + i);
+                        _mm_storeu_pd (x + i, _mm_add_pd (_mm_add_pd (_mm_add_pd (_mm_mul_pd (m[0][0], vx),
+                          _mm_mul_pd (m[0][1], vy)), _mm_mul_pd (m[0][2], vz)), m[0][3]));
+                        _mm_storeu_pd (y + i, _mm_add_pd (_mm_add_pd (_mm_add_pd (_mm_mul_pd (m[1][0], vx),
+                          _mm_mul_pd (m[1][1], vy)), _mm_mul_pd (m[1][2], vz)), m[1][3]));
+                        _mm_storeu_pd (z + i, _mm_add_pd (_mm_add_pd (_mm_add_pd (_mm_mul_pd (m[2][0], vx),
+                          _mm_mul_pd (m[2][1], vy)), _mm_mul_pd (m[2][2], vz)), m[2][3]));
+                }
+        }
+#endif
+        for (; i < number_points; i++)
+        {
+                px = x[i];
+                py = y[i];
+                if (z == NULL)
+                {
+                        x[i] = (transform->m[0][0] * px) + (transform->m[0][1] * py)
+                          + transform->m[0][3];
+                        y[i] = (transform->m[1][0] * px) + (transform->m[1][1] * py)
+                          + transform->m[1][3];
+                        continue;
+                }
+                pz = z[i];
+                x[i] = (transform->m[0][0] * px) + (transform->m[0][1] * py)
+                  + (transform->m[0][2] * pz) + transform->m[0][3];
+                y[i] = (transform->m[1][0] * px) + (transform->m[1][1] * py)
+                  + (transform->m[1][2] * pz) + transform->m[1][3];
+                z[i] = (transform->m[2][0] * px) + (transform->m[2][1] * py)
+                  + (transform->m[2][2] * pz) + transform->m[2][3];
+        }
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Map Object Coordinate System (OCS) coordinates of many
+ * entities to world coordinates.
+ *
+ * Point \c i is in the OCS of extrusion direction \c i, the OCS
+ * follows from the extrusion direction with the arbitrary axis
+ * algorithm (see dxf_transform_set_ocs ()).\n
+ * Gather the extrusion directions and OCS points of a batch of
+ * entities (for example the centers of all \c CIRCLE entities of a
+ * drawing) to map them in one call, the arbitrary axis algorithm is
+ * vectorized across entities.\n
+ * \c result may be the same array as \c points.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when a \c NULL
+ * pointer was passed.
+ */
+int
+dxf_transform_ocs_to_wcs
+(
+        DxfVec3 *extrusions,
+                /*!< a pointer to the extrusion directions. */
+        DxfVec3 *points,
+                /*!< a pointer to the points in OCS coordinates. */
+        DxfVec3 *result,
+                /*!< a pointer to the points in world coordinates. */
+        size_t number_points
+                /*!< Number of extrusion directions and points. */
+)
+{
+        size_t i = 0;
+        DxfVec3 ax;
+        DxfVec3 ay;
+        DxfVec3 az;
+        double x;
+        double y;
+        double z;
+#if defined (__AVX2__)
+        const __m256d sign = _mm256_set1_pd (-0.0);
+        const __m256d zero = _mm256_setzero_pd ();
+        const __m256d one = _mm256_set1_pd (1.0);
+        const __m256d limit = _mm256_set1_pd (1.0 / 64.0);
+        __m256d nx;
+        __m256d ny;
+        __m256d nz;
+        __m256d axx;
+        __m256d axy;
+        __m256d axz;
+        __m256d vx;
+        __m256d vy;
+        __m256d vz;
+        __m256d length;
+        __m256d mask;
+#elif defined (__SSE2__)
+        const __m128d sign = _mm_set1_pd (-0.0);
+        const __m128d zero = _mm_setzero_pd ();
+        const __m128d one = _mm_set1_pd (1.0);
+        const __m128d limit = _mm_set1_pd (1.0 / 64.0);
+        __m128d nx;
+        __m128d ny;
+        __m128d nz;
+        __m128d axx;
+        __m128d axy;
+        __m128d axz;
+        __m128d vx;
+        __m128d vy;
+        __m128d vz;
+        __m128d length;
+        __m128d mask;
+#endif
+
+        /* Do some basic checks. */
+        if (((extrusions == NULL) || (points == NULL) || (result == NULL))
+          && (number_points > 0))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+#if defined (__AVX2__)
+        for (; i + 4 <= number_points; i += 4)
+        {
+                dxf_transform_load4 (&extrusions[i].x, &nx, &ny, &nz);
+                length = _mm256_sqrt_pd (_mm256_add_pd (_mm256_add_pd (_mm256_mul_pd (nx, nx),
+                  _mm256_mul_pd (ny, ny)), _mm256_mul_pd (nz, nz)));
+                /* A zero extrusion direction is the world Z-axis. */
+                mask = _mm256_cmp_pd (length, zero, _CMP_EQ_OQ);
+                nz = _mm256_blendv_pd (nz, one, mask);
+                length = _mm256_blendv_pd (length, one, mask);
+                nx = _mm256_div_pd (nx, length);
+                ny = _mm256_div_pd (ny, length);
+                nz = _mm256_div_pd (nz, length);
+                /* World Y-axis or world Z-axis cross the extrusion
+                 * direction. */
+                mask = _mm256_and_pd (
+                  _mm256_cmp_pd (_mm256_andnot_pd (sign, nx), limit, _CMP_LT_OQ),
+                  _mm256_cmp_pd (_mm256_andnot_pd (sign, ny), limit, _CMP_LT_OQ));
+                axx = _mm256_blendv_pd (_mm256_xor_pd (ny, sign), nz, mask);
+                axy = _mm256_blendv_pd (nx, zero, mask);
+                axz = _mm256_blendv_pd (zero, _mm256_xor_pd (nx, sign), mask);
+                length = _mm256_sqrt_pd (_mm256_add_pd (_mm256_add_pd (_mm256_mul_pd (axx, axx),
+                  _mm256_mul_pd (axy, axy)), _mm256_mul_pd (axz, axz)));
+                axx = _mm256_div_pd (axx, length);
+                axy = _mm256_div_pd (axy, length);
+                axz = _mm256_div_pd (axz, length);
+                dxf_transform_load4 (&points[i].x, &vx, &vy, &vz);
+                /* The Y-axis is the extrusion direction cross the
+                 * X-axis. */
+                dxf_transform_store4 (&result[i].x,
+                  _mm256_add_pd (_mm256_add_pd (_mm256_mul_pd (vx, axx),
+                    _mm256_mul_pd (vy, _mm256_sub_pd (_mm256_mul_pd (ny, axz), _mm256_mul_pd (nz, axy)))),
+                    _mm256_mul_pd (vz, nx)),
+                  _mm256_add_pd (_mm256_add_pd (_mm256_mul_pd (vx, axy),
+                    _mm256_mul_pd (vy, _mm256_sub_pd (_mm256_mul_pd (nz, axx), _mm256_mul_pd (nx, axz)))),
+                    _mm256_mul_pd (vz, ny)),
+                  _mm256_add_pd (_mm256_add_pd (_mm256_mul_pd (vx, axz),
+                    _mm256_mul_pd (vy, _mm256_sub_pd (_mm256_mul_pd (nx, axy), _mm256_mul_pd (ny, axx)))),
+                    _mm256_mul_pd (vz, nz)));
+        }
+#elif defined (__SSE2__)
+        for (; i + 2 <= number_points; i += 2)
+        {
+                dxf_transform_load2 (&extrusions[i].x, &nx, &ny, &nz);
+                length = _mm_sqrt_pd (_mm_add_pd (_mm_add_pd (_mm_mul_pd (nx, nx),
+                  _mm_mul_pd (ny, ny)), _mm_mul_pd (nz, nz)));
+                /* A zero extrusion direction is the world Z-axis. */
+                mask = _mm_cmpeq_pd (length, zero);
+                nz = dxf_transform_select2 (nz, one, mask);
+                length = dxf_transform_select2 (length, one, mask);
+                nx = _mm_div_pd (nx, length);
+                ny = _mm_div_pd (ny, length);
+                nz = _mm_div_pd (nz, length);
+                /* World Y-axis or world Z-axis cross the extrusion
+                 * direction. */
+                mask = _mm_and_pd (_mm_cmplt_pd (_mm_andnot_pd (sign, nx), limit),
+                  _mm_cmplt_pd (_mm_andnot_pd (sign, ny), limit));
+                axx = dxf_transform_select2 (_mm_xor_pd (ny, sign), nz, mask);
+                axy = dxf_transform_select2 (nx, zero, mask);
+                axz = dxf_transform_select2 (zero, _mm_xor_pd (nx, sign), mask);
+                length = _mm_sqrt_pd (_mm_add_pd (_mm_add_pd (_mm_mul_pd (axx, axx),
+                  _mm_mul_pd (axy, axy)), _mm_mul_pd (axz, axz)));
+                axx = _mm_div_pd (axx, length);
+                axy = _mm_div_pd (axy, length);
+                axz = _mm_div_pd (axz, length);
+                dxf_transform_load2 (&points[i].x, &vx, &vy, &vz);
+                /* The Y-axis is the extrusion direction cross the
+                 * X-axis. */
+                dxf_transform_store2 (&result[i].x,
+                  _mm_add_pd (_mm_add_pd (_mm_mul_pd (vx, axx),
+                    _mm_mul_pd (vy, _mm_sub_pd (_mm_mul_pd (ny, axz), _mm_mul_pd (nz, axy)))),
+                    _mm_mul_pd (vz, nx)),
+                  _mm_add_pd (_mm_add_pd (_mm_mul_pd (vx, axy),
+                    _mm_mul_pd (vy, _mm_sub_pd (_mm_mul_pd (nz, axx), _mm_mul_pd (nx, axz)))),
+                    _mm_mul_pd (vz, ny)),
+                  _mm_add_pd (_mm_add_pd (_mm_mul_pd (vx, axz),
+                    _mm_mul_pd (vy, _mm_sub_pd (_mm_mul_pd (nx, axy), _mm_mul_pd (ny, axx)))),
+                    _mm_mul_pd (vz, nz)));
+        }
+#endif
+        for (; i < number_points; i++)
+        {
+                dxf_transform_arbitrary_axis (extrusions[i].x,
+                  extrusions[i].y, extrusions[i].z, &ax, &ay, &az);
+                x = points[i].x;
+                y = points[i].y;
+                z = points[i].z;
+                result[i].x = (x * ax.x) + (y * ay.x) + (z * az.x);
+                result[i].y = (x * ax.y) + (y * ay.y) + (z * az.y);
+                result[i].z = (x * ax.z) + (y * ay.z) + (z * az.z);
+        }
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Define the wrapper of an entity type for the dispatch table
+ * of dxf_entity_transform ().
+ */
+#define DXF_TRANSFORM_WRAPPER(type, Type) \
+static int \
+dxf_transform_dispatch_##type (void *entity, DxfTransform *transform) \
+{ \
+        return (dxf_##type##_transform ((Type *) entity, transform)); \
+}
+
+
+DXF_TRANSFORM_WRAPPER (3dface, Dxf3dface)
+DXF_TRANSFORM_WRAPPER (arc, DxfArc)
+DXF_TRANSFORM_WRAPPER (circle, DxfCircle)
+DXF_TRANSFORM_WRAPPER (ellipse, DxfEllipse)
+DXF_TRANSFORM_WRAPPER (hatch, DxfHatch)
+DXF_TRANSFORM_WRAPPER (insert, DxfInsert)
+DXF_TRANSFORM_WRAPPER (line, DxfLine)
+DXF_TRANSFORM_WRAPPER (lwpolyline, DxfLWPolyline)
+DXF_TRANSFORM_WRAPPER (mtext, DxfMtext)
+DXF_TRANSFORM_WRAPPER (point, DxfPoint)
+DXF_TRANSFORM_WRAPPER (polyline, DxfPolyline)
+DXF_TRANSFORM_WRAPPER (solid, DxfSolid)
+DXF_TRANSFORM_WRAPPER (spline, DxfSpline)
+DXF_TRANSFORM_WRAPPER (text, DxfText)
+DXF_TRANSFORM_WRAPPER (trace, DxfTrace)
+
+
+/*!
+ * \brief Dispatch table of dxf_entity_transform ().
+ *
+ * Sorted on \c name for bsearch ().
+ */
+static const struct dxf_transform_dispatcher_struct
+{
+        const char *name;
+                /*!< Entity type name as found after group code 0. */
+        int (*transform) (void *entity, DxfTransform *transform);
+                /*!< Transform an entity. */
+} dxf_transform_dispatchers[] =
+{
+        {"3DFACE", dxf_transform_dispatch_3dface},
+        {"ARC", dxf_transform_dispatch_arc},
+        {"CIRCLE", dxf_transform_dispatch_circle},
+        {"ELLIPSE", dxf_transform_dispatch_ellipse},
+        {"HATCH", dxf_transform_dispatch_hatch},
+        {"INSERT", dxf_transform_dispatch_insert},
+        {"LINE", dxf_transform_dispatch_line},
+        {"LWPOLYLINE", dxf_transform_dispatch_lwpolyline},
+        {"MTEXT", dxf_transform_dispatch_mtext},
+        {"POINT", dxf_transform_dispatch_point},
+        {"POLYLINE", dxf_transform_dispatch_polyline},
+        {"SOLID", dxf_transform_dispatch_solid},
+        {"SPLINE", dxf_transform_dispatch_spline},
+        {"TEXT", dxf_transform_dispatch_text},
+        {"TRACE", dxf_transform_dispatch_trace}
+};
+
+
+/*!
+ * \brief Compare a name with an entry of the dispatch table, for
+ * bsearch ().
+ */
+static int
+dxf_transform_dispatcher_compare
+(
+        const void *name,
+                /*!< a pointer to the entity type name. */
+        const void *dispatcher
+                /*!< a pointer to an entry of the dispatch table. */
+)
+{
+        return (strcmp ((const char *) name,
+          ((const struct dxf_transform_dispatcher_struct *) dispatcher)->name));
+}
+
+
+/*!
+ * \brief Transform a DXF entity in place by it's type name.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred or when transforming \c type entities is not supported
+ * (yet), in which case \c entity is left unchanged.
+ */
+int
+dxf_entity_transform
+(
+        const char *type,
+                /*!< Entity type name, for example "LINE". */
+        void *entity,
+                /*!< a pointer to the entity. */
+        DxfTransform *transform
+                /*!< a pointer to a libDXF affine transformation. */
+)
+{
+        const struct dxf_transform_dispatcher_struct *dispatcher;
+
+        /* Do some basic checks. */
+        if ((type == NULL) || (entity == NULL) || (transform == NULL))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        dispatcher = bsearch (type, dxf_transform_dispatchers,
+          sizeof (dxf_transform_dispatchers) / sizeof (dxf_transform_dispatchers[0]),
+          sizeof (dxf_transform_dispatchers[0]), dxf_transform_dispatcher_compare);
+        if (dispatcher == NULL)
+        {
+                return (EXIT_FAILURE);
+        }
+        return (dispatcher->transform (entity, transform));
+}
+
+
+/* EOF */
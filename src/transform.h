@@ -0,0 +1,94 @@
+/*!
+ * \file transform.h
+ *
+ * \author Copyright (C) 2026
+ * by Bert Timmerman <bert.timmerman@xs4all.nl>.
+ *
+ * \brief Prototypes for libDXF affine transformations.
+ *
+ * <hr>
+ * <h1><b>Copyright Notices.</b></h1>\n
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License,
+ * or (at your option) any later version.\n\n
+ * This program is distributed in the hope that it will be useful, but
+ * <b>WITHOUT ANY WARRANTY</b>; without even the implied warranty of
+ * <b>MERCHANTABILITY</b> or <b>FITNESS FOR A PARTICULAR PURPOSE</b>.\n
+ * See the GNU General Public License for more details.\n\n
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to:\n
+ * Free Software Foundation, Inc.,\n
+ * 59 Temple Place,\n
+ * Suite 330,\n
+ * Boston,\n
+ * MA 02111 USA.\n
+ * \n
+ * Drawing eXchange Format (DXF) is a defacto industry standard for the
+ * exchange of drawing files between various Computer Aided Drafting
+ * programs.\n
+ * DXF is an industry standard designed by Autodesk(TM).\n
+ * For more details see http://www.autodesk.com.
+ * <hr>
+ */
+
+
+
+#ifndef LIBDXF_SRC_TRANSFORM_H
+#define LIBDXF_SRC_TRANSFORM_H
+
+
+#include "global.h"
+
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+/*!
+ * \brief Relative tolerance for the test if a transformation maps the
+ * plane of an entity without distortion, see
+ * dxf_transform_get_ocs_transform ().
+ */
+#define DXF_TRANSFORM_TOLERANCE 1e-9
+
+
+/*!
+ * \brief Definition of an affine transformation of 3D coordinates.
+ *
+ * A 3 by 4 matrix in row major order, a point (x, y, z) maps to
+ * (m[i][0] * x + m[i][1] * y + m[i][2] * z + m[i][3]) for row \c i.
+ */
+typedef struct
+dxf_transform_struct
+{
+        double m[3][4];
+                /*!< Rows of the linear part, followed by the
+                 * translation in the last column. */
+} DxfTransform;
+
+
+DxfTransform *dxf_transform_init (DxfTransform *transform);
+DxfTransform *dxf_transform_multiply (DxfTransform *result, DxfTransform *a, DxfTransform *b);
+DxfVec3 *dxf_transform_apply_point (DxfTransform *transform, DxfVec3 *point, DxfVec3 *result);
+DxfVec3 *dxf_transform_apply_vector (DxfTransform *transform, DxfVec3 *vector, DxfVec3 *result);
+DxfTransform *dxf_transform_set_column_major (DxfTransform *transform, double *matrix);
+double *dxf_transform_get_column_major (DxfTransform *transform, double *matrix);
+DxfTransform *dxf_transform_set_ocs (DxfTransform *transform, DxfVec3 *extrusion);
+int dxf_transform_get_ocs_transform (DxfTransform *transform, DxfVec3 *extrusion, DxfTransform *result, double *scale);
+int dxf_transform_apply_points (DxfTransform *transform, DxfVec3 *points, DxfVec3 *result, size_t number_points);
+int dxf_transform_apply_arrays (DxfTransform *transform, double *x, double *y, double *z, size_t number_points);
+int dxf_transform_ocs_to_wcs (DxfVec3 *extrusions, DxfVec3 *points, DxfVec3 *result, size_t number_points);
+int dxf_entity_transform (const char *type, void *entity, DxfTransform *transform);
+
+
+#ifdef __cplusplus
+}
+#endif
+
+
+#endif /* LIBDXF_SRC_TRANSFORM_H */
+
+
+/* EOF */
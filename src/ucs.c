@@ -40,6 +40,7 @@
 
 
 #include "ucs.h"
+#include "util.h"
 
 
 /*!
@@ -62,7 +63,7 @@ dxf_ucs_new ()
         size = sizeof (DxfUcs);
         /* avoid malloc of 0 bytes */
         if (size == 0) size = 1;
-        if ((ucs = malloc (size)) == NULL)
+        if ((ucs = dxf_malloc (size)) == NULL)
         {
                 fprintf (stderr,
                   (_("Error in %s () could not allocate memory for a DxfUcs struct.\n")),
@@ -112,8 +113,8 @@ dxf_ucs_init
                   __FUNCTION__);
                 return (NULL);
         }
-        ucs->id_code = 0;
-        ucs->UCS_name = strdup ("");
+        ucs->id_code = DXF_HANDLE_NONE;
+        ucs->UCS_name = dxf_strdup ("");
         ucs->origin = dxf_point_new ();
         ucs->origin = dxf_point_init (ucs->origin);
         ucs->origin->x0 = 0.0;
@@ -138,10 +139,10 @@ dxf_ucs_init
         ucs->orthographic_type = 0;
         ucs->other_base_UCS = 0;
         ucs->elevation = 0.0;
-        ucs->dictionary_owner_soft = strdup ("");
-        ucs->object_owner_soft = strdup ("");
-        ucs->base_UCS = strdup ("");
-        ucs->dictionary_owner_hard = strdup ("");
+        ucs->dictionary_owner_soft = 0;
+        ucs->object_owner_soft = 0;
+        ucs->base_UCS = dxf_strdup ("");
+        ucs->dictionary_owner_hard = 0;
         ucs->next = NULL;
 #if DEBUG
         DXF_DEBUG_END
@@ -173,7 +174,8 @@ dxf_ucs_read
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        char *temp_string = NULL;
+        char temp_string[DXF_MAX_STRING_LENGTH];
+        int group_code;
         int i;
 
         /* Do some basic checks. */
@@ -182,8 +184,6 @@ dxf_ucs_read
                 fprintf (stderr,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
-                /* Clean up. */
-                free (temp_string);
                 return (NULL);
         }
         if (ucs == NULL)
@@ -194,227 +194,191 @@ dxf_ucs_read
                 ucs = dxf_ucs_init (ucs);
         }
         i = 0;
-        (fp->line_number)++;
-        fscanf (fp->fp, "%[^\n]", temp_string);
-        while (strcmp (temp_string, "0") != 0)
+        while ((dxf_read_group_code (fp, &group_code) == EXIT_SUCCESS)
+          && (group_code != 0))
         {
-                if (ferror (fp->fp))
+                if (dxf_read_error (fp))
                 {
                         fprintf (stderr,
                           (_("Error in %s () while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
-                        fclose (fp->fp);
-                        /* Clean up. */
-                        free (temp_string);
                         return (NULL);
                 }
-                if (strcmp (temp_string, "5") == 0)
-                {
-                        /* Now follows a string containing a sequential
-                         * id number. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%x\n", (uint *) &ucs->id_code);
-                }
-                else if (strcmp (temp_string, "2") == 0)
-                {
-                        /* Now follows a string containing an UCS
-                         * name. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, ucs->UCS_name);
-                }
-                else if (strcmp (temp_string, "10") == 0)
-                {
-                        /* Now follows a string containing the
-                         * X-coordinate of the base point. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &ucs->origin->x0);
-                }
-                else if (strcmp (temp_string, "20") == 0)
-                {
-                        /* Now follows a string containing the
-                         * Y-coordinate of the base point. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &ucs->origin->y0);
-                }
-                else if (strcmp (temp_string, "30") == 0)
-                {
-                        /* Now follows a string containing the
-                         * Z-coordinate of the base point. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &ucs->origin->z0);
-                }
-                else if (strcmp (temp_string, "11") == 0)
-                {
-                        /* Now follows a string containing the
-                         * X-coordinate of the reference point for the
-                         * X-axis direction. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &ucs->X_dir->x0);
-                }
-                else if (strcmp (temp_string, "21") == 0)
-                {
-                        /* Now follows a string containing the
-                         * Y-coordinate of the reference point for the
-                         * X-axis direction. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &ucs->X_dir->y0);
-                }
-                else if (strcmp (temp_string, "31") == 0)
-                {
-                        /* Now follows a string containing the
-                         * Z-coordinate of the reference point for the
-                         * X-axis direction. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &ucs->X_dir->z0);
-                }
-                else if (strcmp (temp_string, "12") == 0)
-                {
-                        /* Now follows a string containing the
-                         * X-coordinate of the reference point for the
-                         * Y-axis direction. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &ucs->Y_dir->x0);
-                }
-                else if (strcmp (temp_string, "22") == 0)
-                {
-                        /* Now follows a string containing the
-                         * Y-coordinate of the reference point for the
-                         * Y-axis direction. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &ucs->Y_dir->y0);
-                }
-                else if (strcmp (temp_string, "32") == 0)
-                {
-                        /* Now follows a string containing the
-                         * Z-coordinate of the reference point for the
-                         * Y-axis direction. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &ucs->Y_dir->z0);
-                }
-                else if (strcmp (temp_string, "13") == 0)
-                {
-                        /* Now follows a string containing the
-                         * X-coordinate of the Origin for this
-                         * orthographic type relative to this UCS. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &ucs->orthographic_type_origin->x0);
-                }
-                else if (strcmp (temp_string, "23") == 0)
-                {
-                        /* Now follows a string containing the
-                         * Y-coordinate of the Origin for this
-                         * orthographic type relative to this UCS. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &ucs->orthographic_type_origin->y0);
-                }
-                else if (strcmp (temp_string, "33") == 0)
-                {
-                        /* Now follows a string containing the
-                         * Z-coordinate of the Origin for this
-                         * orthographic type relative to this UCS. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &ucs->orthographic_type_origin->z0);
-                }
-                else if (strcmp (temp_string, "70") == 0)
-                {
-                        /* Now follows a string containing the
-                         * standard flag value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%d\n", &ucs->flag);
-                }
-                else if (strcmp (temp_string, "71") == 0)
-                {
-                        /* Now follows a string containing the
-                         * standard flag value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%d\n", &ucs->orthographic_type);
-                        if ((ucs->orthographic_type < 1)
-                          || (ucs->orthographic_type > 6))
-                        {
-                                fprintf (stderr,
-                                  (_("Warning in %s () found a bad orthographic_type value in: %s in line: %d.\n")),
-                                  __FUNCTION__, fp->filename, fp->line_number);
-                        }
-                }
-                else if (strcmp (temp_string, "79") == 0)
-                {
-                        /* Now follows a string containing the other base
-                         * UCS flag value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%d\n", &ucs->other_base_UCS);
-                        if (ucs->other_base_UCS != 0)
-                        {
-                                fprintf (stderr,
-                                  (_("Warning in %s () found a bad spare value in: %s in line: %d.\n")),
-                                  __FUNCTION__, fp->filename, fp->line_number);
-                        }
-                }
-                else if ((fp->acad_version_number >= AutoCAD_13)
-                        && (strcmp (temp_string, "100") == 0))
+                switch (group_code)
                 {
-                        /* Now follows a string containing the
-                         * subclass marker value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
-                        if ((strcmp (temp_string, "AcDbSymbolTableRecord") != 0)
-                        && ((strcmp (temp_string, "AcDbUCSTableRecord") != 0)))
-                        {
+                        case 5:
+                                /* Now follows a string containing a sequential
+                                 * id number. */
+                                dxf_read_handle (fp, &ucs->id_code);
+                                break;
+                        case 2:
+                                /* Now follows a string containing an UCS
+                                 * name. */
+                                dxf_read_string (fp, &ucs->UCS_name);
+                                break;
+                        case 10:
+                                /* Now follows a string containing the
+                                 * X-coordinate of the base point. */
+                                dxf_read_double (fp, &ucs->origin->x0);
+                                break;
+                        case 20:
+                                /* Now follows a string containing the
+                                 * Y-coordinate of the base point. */
+                                dxf_read_double (fp, &ucs->origin->y0);
+                                break;
+                        case 30:
+                                /* Now follows a string containing the
+                                 * Z-coordinate of the base point. */
+                                dxf_read_double (fp, &ucs->origin->z0);
+                                break;
+                        case 11:
+                                /* Now follows a string containing the
+                                 * X-coordinate of the reference point for the
+                                 * X-axis direction. */
+                                dxf_read_double (fp, &ucs->X_dir->x0);
+                                break;
+                        case 21:
+                                /* Now follows a string containing the
+                                 * Y-coordinate of the reference point for the
+                                 * X-axis direction. */
+                                dxf_read_double (fp, &ucs->X_dir->y0);
+                                break;
+                        case 31:
+                                /* Now follows a string containing the
+                                 * Z-coordinate of the reference point for the
+                                 * X-axis direction. */
+                                dxf_read_double (fp, &ucs->X_dir->z0);
+                                break;
+                        case 12:
+                                /* Now follows a string containing the
+                                 * X-coordinate of the reference point for the
+                                 * Y-axis direction. */
+                                dxf_read_double (fp, &ucs->Y_dir->x0);
+                                break;
+                        case 22:
+                                /* Now follows a string containing the
+                                 * Y-coordinate of the reference point for the
+                                 * Y-axis direction. */
+                                dxf_read_double (fp, &ucs->Y_dir->y0);
+                                break;
+                        case 32:
+                                /* Now follows a string containing the
+                                 * Z-coordinate of the reference point for the
+                                 * Y-axis direction. */
+                                dxf_read_double (fp, &ucs->Y_dir->z0);
+                                break;
+                        case 13:
+                                /* Now follows a string containing the
+                                 * X-coordinate of the Origin for this
+                                 * orthographic type relative to this UCS. */
+                                dxf_read_double (fp, &ucs->orthographic_type_origin->x0);
+                                break;
+                        case 23:
+                                /* Now follows a string containing the
+                                 * Y-coordinate of the Origin for this
+                                 * orthographic type relative to this UCS. */
+                                dxf_read_double (fp, &ucs->orthographic_type_origin->y0);
+                                break;
+                        case 33:
+                                /* Now follows a string containing the
+                                 * Z-coordinate of the Origin for this
+                                 * orthographic type relative to this UCS. */
+                                dxf_read_double (fp, &ucs->orthographic_type_origin->z0);
+                                break;
+                        case 70:
+                                /* Now follows a string containing the
+                                 * standard flag value. */
+                                dxf_read_int (fp, &ucs->flag);
+                                break;
+                        case 71:
+                                /* Now follows a string containing the
+                                 * standard flag value. */
+                                dxf_read_int (fp, &ucs->orthographic_type);
+                                if ((ucs->orthographic_type < 1)
+                                  || (ucs->orthographic_type > 6))
+                                {
+                                        fprintf (stderr,
+                                          (_("Warning in %s () found a bad orthographic_type value in: %s in line: %d.\n")),
+                                          __FUNCTION__, fp->filename, fp->line_number);
+                                }
+                                break;
+                        case 79:
+                                /* Now follows a string containing the other base
+                                 * UCS flag value. */
+                                dxf_read_int (fp, &ucs->other_base_UCS);
+                                if (ucs->other_base_UCS != 0)
+                                {
+                                        fprintf (stderr,
+                                          (_("Warning in %s () found a bad spare value in: %s in line: %d.\n")),
+                                          __FUNCTION__, fp->filename, fp->line_number);
+                                }
+                                break;
+                        case 100:
+                                if (fp->acad_version_number >= AutoCAD_13)
+                                {
+                                        /* Now follows a string containing the
+                                         * subclass marker value. */
+                                        dxf_read_line (temp_string, fp);
+                                        if ((strcmp (temp_string, "AcDbSymbolTableRecord") != 0)
+                                        && ((strcmp (temp_string, "AcDbUCSTableRecord") != 0)))
+                                        {
+                                                fprintf (stderr,
+                                                  (_("Warning in %s () found a bad subclass marker in: %s in line: %d.\n")),
+                                                  __FUNCTION__, fp->filename, fp->line_number);
+                                        }
+                                }
+                                else
+                                {
+                                        fprintf (stderr,
+                                          (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
+                                          __FUNCTION__, fp->filename, fp->line_number);
+                                        /* Skip the value of the unknown group code. */
+                                        dxf_read_line (temp_string, fp);
+                                }
+                                break;
+                        case 146:
+                                /* Now follows a string containing the
+                                 * elevation of this UCS. */
+                                dxf_read_double (fp, &ucs->elevation);
+                                break;
+                        case 330:
+                                if (i < 1)
+                                {
+                                        /* Now follows a string containing Soft-pointer
+                                         * ID/handle to owner dictionary. */
+                                        dxf_read_handle (fp, &ucs->dictionary_owner_soft);
+                                        i++;
+                                }
+                                else
+                                {
+                                        /* Now follows a string containing Soft-pointer
+                                         * ID/handle to object owner. */
+                                        dxf_read_handle (fp, &ucs->object_owner_soft);
+                                }
+                                break;
+                        case 346:
+                                /* Now follows a string containing a base UCS. */
+                                dxf_read_string (fp, &ucs->base_UCS);
+                                break;
+                        case 360:
+                                /* Now follows a string containing Hard owner
+                                 * ID/handle to owner dictionary. */
+                                dxf_read_handle (fp, &ucs->dictionary_owner_hard);
+                                break;
+                        case 999:
+                                /* Now follows a string containing a comment. */
+                                dxf_read_line (temp_string, fp);
+                                fprintf (stdout, "DXF comment: %s\n", temp_string);
+                                break;
+                        default:
                                 fprintf (stderr,
-                                  (_("Warning in %s () found a bad subclass marker in: %s in line: %d.\n")),
+                                  (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
                                   __FUNCTION__, fp->filename, fp->line_number);
-                        }
-                }
-                else if (strcmp (temp_string, "146") == 0)
-                {
-                        /* Now follows a string containing the
-                         * elevation of this UCS. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &ucs->elevation);
-                }
-                else if ((i < 1) && (strcmp (temp_string, "330") == 0))
-                {
-                        /* Now follows a string containing Soft-pointer
-                         * ID/handle to owner dictionary. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, ucs->dictionary_owner_soft);
-                        i++;
-                }
-                else if (strcmp (temp_string, "330") == 0)
-                {
-                        /* Now follows a string containing Soft-pointer
-                         * ID/handle to object owner. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, ucs->object_owner_soft);
-                }
-                else if (strcmp (temp_string, "346") == 0)
-                {
-                        /* Now follows a string containing a base UCS. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, ucs->base_UCS);
-                }
-                else if (strcmp (temp_string, "360") == 0)
-                {
-                        /* Now follows a string containing Hard owner
-                         * ID/handle to owner dictionary. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, ucs->dictionary_owner_hard);
-                }
-                else if (strcmp (temp_string, "999") == 0)
-                {
-                        /* Now follows a string containing a comment. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
-                        fprintf (stdout, "DXF comment: %s\n", temp_string);
-                }
-                else
-                {
-                        fprintf (stderr,
-                          (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
-                          __FUNCTION__, fp->filename, fp->line_number);
+                                /* Skip the value of the unknown group code. */
+                                dxf_read_line (temp_string, fp);
+                                break;
                 }
         }
-        /* Clean up. */
-        free (temp_string);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -440,7 +404,7 @@ dxf_ucs_write
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        char *dxf_entity_name = strdup ("UCS");
+        char *dxf_entity_name = dxf_strdup ("UCS");
 
         /* Do some basic checks. */
         if (fp == NULL)
@@ -449,7 +413,7 @@ dxf_ucs_write
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (ucs == NULL)
@@ -458,27 +422,27 @@ dxf_ucs_write
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if ((ucs->UCS_name == NULL)
           || (strcmp (ucs->UCS_name, "") == 0))
         {
                 fprintf (stderr,
-                  (_("Error in %s () empty UCS name string for the %s entity with id-code: %x\n")),
+                  (_("Error in %s () empty UCS name string for the %s entity with id-code: %" PRIx64 "\n")),
                   __FUNCTION__, dxf_entity_name, ucs->id_code);
                 fprintf (stderr,
                   (_("\t%s entity is discarded from output.\n")),
                   dxf_entity_name);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         /* Start writing output. */
-        fprintf (fp->fp, "  0\n%s\n", dxf_entity_name);
-        if (ucs->id_code != -1)
+        dxf_write_string (fp, 0, dxf_entity_name);
+        if (ucs->id_code != DXF_HANDLE_NONE)
         {
-                fprintf (fp->fp, "  5\n%x\n", ucs->id_code);
+                dxf_write_hex (fp, 5, ucs->id_code);
         }
         /*!
          * \todo for version R14.\n
@@ -490,47 +454,47 @@ dxf_ucs_write
          * 102 groups are application defined (optional).\n\n
          * End of group, "}" (optional), with Group code 102.
          */
-        if ((strcmp (ucs->dictionary_owner_soft, "") != 0)
+        if ((ucs->dictionary_owner_soft != 0)
           && (fp->acad_version_number >= AutoCAD_14))
         {
-                fprintf (fp->fp, "102\n{ACAD_REACTORS\n");
-                fprintf (fp->fp, "330\n%s\n", ucs->dictionary_owner_soft);
-                fprintf (fp->fp, "102\n}\n");
+                dxf_write_string (fp, 102, "{ACAD_REACTORS");
+                dxf_write_hex (fp, 330, ucs->dictionary_owner_soft);
+                dxf_write_string (fp, 102, "}");
         }
-        if ((strcmp (ucs->dictionary_owner_hard, "") != 0)
+        if ((ucs->dictionary_owner_hard != 0)
           && (fp->acad_version_number >= AutoCAD_14))
         {
-                fprintf (fp->fp, "102\n{ACAD_XDICTIONARY\n");
-                fprintf (fp->fp, "360\n%s\n", ucs->dictionary_owner_hard);
-                fprintf (fp->fp, "102\n}\n");
+                dxf_write_string (fp, 102, "{ACAD_XDICTIONARY");
+                dxf_write_hex (fp, 360, ucs->dictionary_owner_hard);
+                dxf_write_string (fp, 102, "}");
         }
         if (fp->acad_version_number >= AutoCAD_13)
         {
-                fprintf (fp->fp, "100\nAcDbSymbolTableRecord\n");
-                fprintf (fp->fp, "100\nAcDbUCSTableRecord\n");
-        }
-        fprintf (fp->fp, "  2\n%s\n", ucs->UCS_name);
-        fprintf (fp->fp, " 70\n%d\n", ucs->flag);
-        fprintf (fp->fp, " 10\n%f\n", ucs->origin->x0);
-        fprintf (fp->fp, " 20\n%f\n", ucs->origin->y0);
-        fprintf (fp->fp, " 30\n%f\n", ucs->origin->z0);
-        fprintf (fp->fp, " 11\n%f\n", ucs->X_dir->x0);
-        fprintf (fp->fp, " 21\n%f\n", ucs->X_dir->y0);
-        fprintf (fp->fp, " 31\n%f\n", ucs->X_dir->z0);
-        fprintf (fp->fp, " 12\n%f\n", ucs->Y_dir->x0);
-        fprintf (fp->fp, " 22\n%f\n", ucs->Y_dir->y0);
-        fprintf (fp->fp, " 32\n%f\n", ucs->Y_dir->z0);
-        fprintf (fp->fp, " 79\n%d\n", ucs->other_base_UCS);
-        fprintf (fp->fp, "146\n%f\n", ucs->elevation);
+                dxf_write_string (fp, 100, "AcDbSymbolTableRecord");
+                dxf_write_string (fp, 100, "AcDbUCSTableRecord");
+        }
+        dxf_write_string (fp, 2, ucs->UCS_name);
+        dxf_write_int (fp, 70, ucs->flag);
+        dxf_write_double (fp, 10, ucs->origin->x0);
+        dxf_write_double (fp, 20, ucs->origin->y0);
+        dxf_write_double (fp, 30, ucs->origin->z0);
+        dxf_write_double (fp, 11, ucs->X_dir->x0);
+        dxf_write_double (fp, 21, ucs->X_dir->y0);
+        dxf_write_double (fp, 31, ucs->X_dir->z0);
+        dxf_write_double (fp, 12, ucs->Y_dir->x0);
+        dxf_write_double (fp, 22, ucs->Y_dir->y0);
+        dxf_write_double (fp, 32, ucs->Y_dir->z0);
+        dxf_write_int (fp, 79, ucs->other_base_UCS);
+        dxf_write_double (fp, 146, ucs->elevation);
         if (ucs->other_base_UCS != 0)
         {
                 if (strcmp (ucs->base_UCS, "") == 0)
                 {
-                        fprintf (fp->fp, "346\nWORLD\n");
+                        dxf_write_string (fp, 346, "WORLD");
                 }
                 else
                 {
-                        fprintf (fp->fp, "346\n%s\n", ucs->base_UCS);
+                        dxf_write_string (fp, 346, ucs->base_UCS);
                 }
         }
         else
@@ -539,13 +503,13 @@ dxf_ucs_write
         }
         if (ucs->orthographic_type > 0)
         {
-                fprintf (fp->fp, " 71\n%d\n", ucs->orthographic_type);
-                fprintf (fp->fp, " 13\n%f\n", ucs->orthographic_type_origin->x0);
-                fprintf (fp->fp, " 23\n%f\n", ucs->orthographic_type_origin->y0);
-                fprintf (fp->fp, " 33\n%f\n", ucs->orthographic_type_origin->z0);
+                dxf_write_int (fp, 71, ucs->orthographic_type);
+                dxf_write_double (fp, 13, ucs->orthographic_type_origin->x0);
+                dxf_write_double (fp, 23, ucs->orthographic_type_origin->y0);
+                dxf_write_double (fp, 33, ucs->orthographic_type_origin->z0);
         }
         /* Clean up. */
-        free (dxf_entity_name);
+        dxf_free (dxf_entity_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -586,10 +550,8 @@ dxf_ucs_free
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        free (ucs->UCS_name);
-        free (ucs->dictionary_owner_soft);
-        free (ucs->dictionary_owner_hard);
-        free (ucs);
+        dxf_free (ucs->UCS_name);
+        dxf_free (ucs);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -635,7 +597,7 @@ dxf_ucs_free_list
  *
  * \return \c id_code.
  */
-int
+uint64_t
 dxf_ucs_get_id_code
 (
         DxfUcs *ucs
@@ -653,12 +615,6 @@ dxf_ucs_get_id_code
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (ucs->id_code < 0)
-        {
-                fprintf (stderr,
-                  (_("Warning in %s () a negative value was found.\n")),
-                  __FUNCTION__);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -674,7 +630,7 @@ dxf_ucs_set_id_code
 (
         DxfUcs *ucs,
                 /*!< a pointer to a DXF \c UCS symbol table entry. */
-        int id_code
+        uint64_t id_code
                 /*!< the \c id_code to be set for the entry.\n
                  * This is to be an unique (sequential) number in the
                  * DXF file. */
@@ -691,12 +647,6 @@ dxf_ucs_set_id_code
                   __FUNCTION__);
                 return (NULL);
         }
-        if (id_code < 0)
-        {
-                fprintf (stderr,
-                  (_("Warning in %s () a negative value was passed.\n")),
-                  __FUNCTION__);
-        }
         ucs->id_code = id_code;
 #if DEBUG
         DXF_DEBUG_END
@@ -738,7 +688,7 @@ dxf_ucs_get_UCS_name
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (ucs->UCS_name));
+        return (dxf_strdup (ucs->UCS_name));
 }
 
 
@@ -773,7 +723,7 @@ dxf_ucs_set_UCS_name
                   __FUNCTION__);
                 return (NULL);
         }
-        ucs->UCS_name = strdup (UCS_name);
+        ucs->UCS_name = dxf_strdup (UCS_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2235,11 +2185,9 @@ dxf_ucs_set_elevation
  * \brief Get the pointer to the \c dictionary_owner_soft from a DXF 
  * \c UCS symbol table entry.
  *
- * \return pointer to the \c dictionary_owner_soft.
- *
- * \warning No checks are performed on the returned pointer (string).
+ * \return the handle of the \c dictionary_owner_soft.
  */
-char *
+uint64_t
 dxf_ucs_get_dictionary_owner_soft
 (
         DxfUcs *ucs
@@ -2255,19 +2203,12 @@ dxf_ucs_get_dictionary_owner_soft
                 fprintf (stderr,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
-                return (NULL);
-        }
-        if (ucs->dictionary_owner_soft ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
+                return (0);
         }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (ucs->dictionary_owner_soft));
+        return (ucs->dictionary_owner_soft);
 }
 
 
@@ -2280,8 +2221,8 @@ dxf_ucs_set_dictionary_owner_soft
 (
         DxfUcs *ucs,
                 /*!< a pointer to a DXF \c UCS symbol table entry. */
-        char *dictionary_owner_soft
-                /*!< a string containing the pointer to the \c
+        uint64_t dictionary_owner_soft
+                /*!< the handle of the \c
                  * dictionary_owner_soft for the entry. */
 )
 {
@@ -2296,14 +2237,7 @@ dxf_ucs_set_dictionary_owner_soft
                   __FUNCTION__);
                 return (NULL);
         }
-        if (dictionary_owner_soft == NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was passed.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
-        ucs->dictionary_owner_soft = strdup (dictionary_owner_soft);
+        ucs->dictionary_owner_soft = dictionary_owner_soft;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2315,11 +2249,9 @@ dxf_ucs_set_dictionary_owner_soft
  * \brief Get the pointer to the \c object_owner_soft from a DXF 
  * \c UCS symbol table entry.
  *
- * \return pointer to the \c object_owner_soft.
- *
- * \warning No checks are performed on the returned pointer (string).
+ * \return the handle of the \c object_owner_soft.
  */
-char *
+uint64_t
 dxf_ucs_get_object_owner_soft
 (
         DxfUcs *ucs
@@ -2335,19 +2267,12 @@ dxf_ucs_get_object_owner_soft
                 fprintf (stderr,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
-                return (NULL);
-        }
-        if (ucs->object_owner_soft ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
+                return (0);
         }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (ucs->object_owner_soft));
+        return (ucs->object_owner_soft);
 }
 
 
@@ -2360,8 +2285,8 @@ dxf_ucs_set_object_owner_soft
 (
         DxfUcs *ucs,
                 /*!< a pointer to a DXF \c UCS symbol table entry. */
-        char *object_owner_soft
-                /*!< a string containing the pointer to the \c
+        uint64_t object_owner_soft
+                /*!< the handle of the \c
                  * object_owner_soft for the entry. */
 )
 {
@@ -2376,14 +2301,7 @@ dxf_ucs_set_object_owner_soft
                   __FUNCTION__);
                 return (NULL);
         }
-        if (object_owner_soft == NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was passed.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
-        ucs->object_owner_soft = strdup (object_owner_soft);
+        ucs->object_owner_soft = object_owner_soft;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2427,7 +2345,7 @@ dxf_ucs_get_base_UCS
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (ucs->base_UCS));
+        return (dxf_strdup (ucs->base_UCS));
 }
 
 
@@ -2463,7 +2381,7 @@ dxf_ucs_set_object_base_UCS
                   __FUNCTION__);
                 return (NULL);
         }
-        ucs->base_UCS = strdup (base_UCS);
+        ucs->base_UCS = dxf_strdup (base_UCS);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2475,11 +2393,9 @@ dxf_ucs_set_object_base_UCS
  * \brief Get the pointer to the \c dictionary_owner_hard from a DXF 
  * \c UCS symbol table entry.
  *
- * \return pointer to the \c dictionary_owner_hard.
- *
- * \warning No checks are performed on the returned pointer (string).
+ * \return the handle of the \c dictionary_owner_hard.
  */
-char *
+uint64_t
 dxf_ucs_get_dictionary_owner_hard
 (
         DxfUcs *ucs
@@ -2495,19 +2411,12 @@ dxf_ucs_get_dictionary_owner_hard
                 fprintf (stderr,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
-                return (NULL);
-        }
-        if (ucs->dictionary_owner_hard ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
+                return (0);
         }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (ucs->dictionary_owner_hard));
+        return (ucs->dictionary_owner_hard);
 }
 
 
@@ -2520,8 +2429,8 @@ dxf_ucs_set_dictionary_owner_hard
 (
         DxfUcs *ucs,
                 /*!< a pointer to a DXF \c UCS symbol table entry. */
-        char *dictionary_owner_hard
-                /*!< a string containing the pointer to the \c
+        uint64_t dictionary_owner_hard
+                /*!< the handle of the \c
                  * dictionary_owner_hard for the entry. */
 )
 {
@@ -2536,14 +2445,7 @@ dxf_ucs_set_dictionary_owner_hard
                   __FUNCTION__);
                 return (NULL);
         }
-        if (dictionary_owner_hard == NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was passed.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
-        ucs->dictionary_owner_hard = strdup (dictionary_owner_hard);
+        ucs->dictionary_owner_hard = dictionary_owner_hard;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2676,4 +2578,88 @@ dxf_ucs_get_last
 }
 
 
+/*!
+ * \brief Get the transformation of a DXF \c UCS symbol table entry,
+ * mapping \c UCS coordinates to world coordinates.
+ *
+ * The Z-axis is the X-axis direction \c X_dir cross the Y-axis
+ * direction \c Y_dir, the Y-axis is made perpendicular to the X-axis.
+ *
+ * \return a pointer to \c transform, or \c NULL when an error
+ * occurred.
+ */
+DxfTransform *
+dxf_ucs_get_transform
+(
+        DxfUcs *ucs,
+                /*!< a pointer to a DXF \c UCS symbol table entry. */
+        DxfTransform *transform
+                /*!< a pointer to the libDXF affine transformation to
+                 * fill. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfVec3 ax;
+        DxfVec3 ay;
+        DxfVec3 az;
+        double length;
+
+        /* Do some basic checks. */
+        if ((ucs == NULL) || (transform == NULL))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        if ((ucs->origin == NULL) || (ucs->X_dir == NULL) || (ucs->Y_dir == NULL))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer to the origin or an axis direction was found.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        ax.x = ucs->X_dir->x0;
+        ax.y = ucs->X_dir->y0;
+        ax.z = ucs->X_dir->z0;
+        az.x = (ax.y * ucs->Y_dir->z0) - (ax.z * ucs->Y_dir->y0);
+        az.y = (ax.z * ucs->Y_dir->x0) - (ax.x * ucs->Y_dir->z0);
+        az.z = (ax.x * ucs->Y_dir->y0) - (ax.y * ucs->Y_dir->x0);
+        ay.x = (az.y * ax.z) - (az.z * ax.y);
+        ay.y = (az.z * ax.x) - (az.x * ax.z);
+        ay.z = (az.x * ax.y) - (az.y * ax.x);
+        length = sqrt ((ax.x * ax.x) + (ax.y * ax.y) + (ax.z * ax.z))
+          * sqrt ((ay.x * ay.x) + (ay.y * ay.y) + (ay.z * ay.z))
+          * sqrt ((az.x * az.x) + (az.y * az.y) + (az.z * az.z));
+        if (length == 0.0)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () the axis directions of the UCS %s are parallel.\n")),
+                  __FUNCTION__, (ucs->UCS_name != NULL) ? ucs->UCS_name : "");
+                return (NULL);
+        }
+        length = sqrt ((ax.x * ax.x) + (ax.y * ax.y) + (ax.z * ax.z));
+        transform->m[0][0] = ax.x / length;
+        transform->m[1][0] = ax.y / length;
+        transform->m[2][0] = ax.z / length;
+        length = sqrt ((ay.x * ay.x) + (ay.y * ay.y) + (ay.z * ay.z));
+        transform->m[0][1] = ay.x / length;
+        transform->m[1][1] = ay.y / length;
+        transform->m[2][1] = ay.z / length;
+        length = sqrt ((az.x * az.x) + (az.y * az.y) + (az.z * az.z));
+        transform->m[0][2] = az.x / length;
+        transform->m[1][2] = az.y / length;
+        transform->m[2][2] = az.z / length;
+        transform->m[0][3] = ucs->origin->x0;
+        transform->m[1][3] = ucs->origin->y0;
+        transform->m[2][3] = ucs->origin->z0;
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (transform);
+}
+
+
 /* EOF */
@@ -45,6 +45,7 @@
 
 #include "global.h"
 #include "point.h"
+#include "transform.h"
 
 
 #ifdef __cplusplus
@@ -59,7 +60,7 @@ extern "C" {
 typedef struct
 dxf_ucs_struct
 {
-        int id_code;
+        uint64_t id_code;
                 /*!< Identification number for the entity.\n
                  * This is to be an unique (sequential) number in the DXF
                  * file.\n
@@ -132,11 +133,11 @@ dxf_ucs_struct
                 /*!< Elevation.\n
                  * Group code = 146.\n
                  * \since Introduced in version R2000.\n */
-        char *dictionary_owner_soft;
+        uint64_t dictionary_owner_soft;
                 /*!< Soft-pointer ID/handle to owner dictionary
                  * (optional).\n
                  * Group code = 330. */
-        char *object_owner_soft;
+        uint64_t object_owner_soft;
                 /*!< Soft-pointer ID/handle to owner object.\n
                  * Group code = 330.\n
                  * \since Introduced in version R2000.\n */
@@ -147,7 +148,7 @@ dxf_ucs_struct
                  * then base UCS is assumed to be WORLD.\n
                  * Group code = 346.\n
                  * \since Introduced in version R2000.\n */
-        char *dictionary_owner_hard;
+        uint64_t dictionary_owner_hard;
                 /*!< Hard owner ID/handle to owner dictionary
                  * (optional).\n
                  * Group code = 360. */
@@ -163,8 +164,8 @@ DxfUcs *dxf_ucs_read (DxfFile *fp, DxfUcs *ucs);
 int dxf_ucs_write (DxfFile *fp, DxfUcs *ucs);
 int dxf_ucs_free (DxfUcs *ucs);
 void dxf_ucs_free_list (DxfUcs *ucss);
-int dxf_ucs_get_id_code (DxfUcs *ucs);
-DxfUcs *dxf_ucs_set_id_code (DxfUcs *ucs, int id_code);
+uint64_t dxf_ucs_get_id_code (DxfUcs *ucs);
+DxfUcs *dxf_ucs_set_id_code (DxfUcs *ucs, uint64_t id_code);
 char *dxf_ucs_get_UCS_name (DxfUcs *ucs);
 DxfUcs *dxf_ucs_set_UCS_name (DxfUcs *ucs, char *UCS_name);
 DxfPoint *dxf_ucs_get_origin (DxfUcs *ucs);
@@ -203,17 +204,18 @@ int dxf_ucs_get_other_base_UCS (DxfUcs *ucs);
 DxfUcs *dxf_ucs_set_other_base_UCS (DxfUcs *ucs, int other_base_UCS);
 double dxf_ucs_get_elevation (DxfUcs *ucs);
 DxfUcs *dxf_ucs_set_elevation (DxfUcs *ucs, double elevation);
-char *dxf_ucs_get_dictionary_owner_soft (DxfUcs *ucs);
-DxfUcs *dxf_ucs_set_dictionary_owner_soft (DxfUcs *ucs, char *dictionary_owner_soft);
-char *dxf_ucs_get_object_owner_soft (DxfUcs *ucs);
-DxfUcs *dxf_ucs_set_object_owner_soft (DxfUcs *ucs, char *object_owner_soft);
+uint64_t dxf_ucs_get_dictionary_owner_soft (DxfUcs *ucs);
+DxfUcs *dxf_ucs_set_dictionary_owner_soft (DxfUcs *ucs, uint64_t dictionary_owner_soft);
+uint64_t dxf_ucs_get_object_owner_soft (DxfUcs *ucs);
+DxfUcs *dxf_ucs_set_object_owner_soft (DxfUcs *ucs, uint64_t object_owner_soft);
 char *dxf_ucs_get_base_UCS (DxfUcs *ucs);
 DxfUcs *dxf_ucs_set_object_base_UCS (DxfUcs *ucs, char *base_UCS);
-char *dxf_ucs_get_dictionary_owner_hard (DxfUcs *ucs);
-DxfUcs *dxf_ucs_set_dictionary_owner_hard (DxfUcs *ucs, char *dictionary_owner_hard);
+uint64_t dxf_ucs_get_dictionary_owner_hard (DxfUcs *ucs);
+DxfUcs *dxf_ucs_set_dictionary_owner_hard (DxfUcs *ucs, uint64_t dictionary_owner_hard);
 DxfUcs *dxf_ucs_get_next (DxfUcs *ucs);
 DxfUcs *dxf_ucs_set_next (DxfUcs *ucs, DxfUcs *next);
 DxfUcs *dxf_ucs_get_last (DxfUcs *ucs);
+DxfTransform *dxf_ucs_get_transform (DxfUcs *ucs, DxfTransform *transform);
 
 
 #ifdef __cplusplus
@@ -35,8 +35,23 @@
  */
 
 
+#include <float.h>
+#include <locale.h>
+#include <math.h>
 #include <stdarg.h>
+#if defined (__AVX2__)
+#include <immintrin.h>
+#elif defined (__SSE2__)
+#include <emmintrin.h>
+#endif
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
 #include "util.h"
+#include "string_pool.h"
 
 
 /*!
@@ -2381,101 +2396,149 @@ dxf_read_is_string
         }
 }
 
+
 /*!
- * \brief Opens a DxfFile, does error checking and resets the line number
- * counter.
- * 
- * Reset the line counting to 0.
+ * \brief Allocate memory for a \c DxfReader and it's block buffer.
  *
- * \todo add a test for invalid characters in \c filename.
- * You may use any character in the current code page (Unicode/ANSI
- * above 127), except:
- * <ul>
- * <li> < > : " / \ | ? * </li>
- * <li> Characters whose integer representations are 0-31 (less than
- *      ASCII space)</li>
- * <li> Any other character that the target file system does not allow
- *      (say, trailing periods or spaces)</li>
- * <li> Any of the DOS names: CON, PRN, AUX, NUL, COM0, COM1, COM2,
- *      COM3, COM4, COM5, COM6, COM7, COM8, COM9, LPT0, LPT1, LPT2,
- *      LPT3, LPT4, LPT5, LPT6, LPT7, LPT8, LPT9 (and avoid AUX.txt,
- *      etc)</li>
- * <li> The file name is all periods</li>
- * <li> File paths (including the file name) may not have more than 260
- *      characters (that don't use the \?\ prefix)</li>
- * <li> Unicode file paths (including the file name) with more than
- *      32,000 characters when using \?\ (note that prefix may expand
- *      directory components and cause it to overflow the 32,000 limit)</li>
- * </ul>
+ * \return \c NULL when no memory was allocated, a pointer to the
+ * allocated memory when successful.
  */
-DxfFile *
-dxf_read_init
+DxfReader *
+dxf_reader_new
 (
-        const char *filename
-                /*!< Filename. */
+        FILE *fp
+                /*!< File handle to read blocks from. */
 )
 {
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        DxfFile * file = NULL;
-        FILE *fp;
-        if (!filename)
+        DxfReader *reader = NULL;
+
+        /* Do some basic checks. */
+        if (fp == NULL)
         {
                 fprintf (stderr,
-                  (_("Error: filename is not initialised (NULL pointer).\n")));
+                  (_("Error in %s () a NULL file pointer was passed.\n")),
+                  __FUNCTION__);
                 return (NULL);
         }
-        if (strcmp (filename, "") == 0)
+        if ((reader = malloc (sizeof (DxfReader))) == NULL)
         {
                 fprintf (stderr,
-                  (_("Error: filename contains an empty string.\n")));
+                  (_("Error in %s () could not allocate memory.\n")),
+                  __FUNCTION__);
                 return (NULL);
         }
-        fp = fopen (filename, "r");
-        if (!fp)
+        memset (reader, 0, sizeof (DxfReader));
+        reader->size = DXF_READER_BUFFER_SIZE;
+        if ((reader->buffer = malloc (reader->size)) == NULL)
         {
                 fprintf (stderr,
-                  (_("Error: could not open file: %s for reading (NULL pointer).\n")),
-                  filename);
+                  (_("Error in %s () could not allocate memory.\n")),
+                  __FUNCTION__);
+                free (reader);
                 return (NULL);
         }
-        file = malloc (sizeof(DxfFile));
-        file->fp = fp;
-        file->filename = strdup(filename);
-        file->line_number = 0;
-        /*! \todo do dxf header and blocks need initialized ?
-         * dxf_header_init (file->dxf_header);
-         * dxf_block_init (file->dxf_block);
-         */
+        reader->fp = fp;
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return file;
+        return (reader);
+}
+
+
+/*!
+ * \brief Add a reference to a shared memory map.
+ *
+ * Safe to call from several threads at once.
+ *
+ * \return \c mapping.
+ */
+DxfMapping *
+dxf_mapping_retain
+(
+        DxfMapping *mapping
+                /*!< a pointer to the \c DxfMapping. */
+)
+{
+        if (mapping != NULL)
+        {
+#ifdef __GNUC__
+                __atomic_add_fetch (&mapping->references, 1, __ATOMIC_RELAXED);
+#else
+                mapping->references++;
+#endif
+        }
+        return (mapping);
 }
 
 
+/*!
+ * \brief Release a reference to a shared memory map, the map is
+ * removed with the last reference.
+ *
+ * Safe to call from several threads at once.
+ */
 void
-dxf_read_close
+dxf_mapping_release
 (
-        DxfFile *file
-                /*!< DXF file pointer to an output file (or device). */
+        DxfMapping *mapping
+                /*!< a pointer to the \c DxfMapping, may be \c NULL. */
 )
 {
-#if DEBUG
-        DXF_DEBUG_BEGIN
+        int references;
+
+        if (mapping == NULL)
+        {
+                return;
+        }
+#ifdef __GNUC__
+        references = __atomic_sub_fetch (&mapping->references, 1, __ATOMIC_ACQ_REL);
+#else
+        references = --mapping->references;
 #endif
-        if (file == NULL)
+        if (references == 0)
         {
-                fprintf (stderr,
-                  (_("Error: file is not initialised (NULL pointer).\n")));
+#ifndef _WIN32
+                munmap (mapping->address, mapping->size);
+#endif
+                free (mapping);
         }
-        else
+}
+
+
+/*!
+ * \brief Free the allocated memory for a \c DxfReader.
+ *
+ * The file handle is not closed, it is owned by the \c DxfFile.\n
+ * A memory mapped file is unmapped.
+ */
+void
+dxf_reader_free
+(
+        DxfReader *reader
+                /*!< a pointer to the \c DxfReader. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        if (reader != NULL)
         {
-                fclose (file->fp);
-                free (file->filename);
-                /*! \todo free other sub structures */
-                free (file);
+#ifndef _WIN32
+                if (reader->mapped)
+                {
+                        dxf_mapping_release (reader->mapping);
+                }
+                else
+                {
+                        free (reader->buffer);
+                }
+#else
+                free (reader->buffer);
+#endif
+                free (reader);
         }
 #if DEBUG
         DXF_DEBUG_END
@@ -2484,86 +2547,3337 @@ dxf_read_close
 
 
 /*!
- * \brief Reads a line from a file.
- * 
- * Reads the next line from \c fp file and stores it into the temp_string.
- * 
+ * \brief Find the line terminators ('\\n') in a part of a buffer.
+ *
+ * The offsets of the line terminators from \c start up to \c end are
+ * stored in \c offsets, in increasing order, until \c max_offsets
+ * offsets are found.\n
+ * A "\\r\\n" line terminator is found by its '\\n', the caller strips
+ * the '\\r'.\n
+ * The buffer is compared 32 bytes at a time when compiled for AVX2
+ * (for example with -mavx2), 16 bytes at a time when compiled for
+ * SSE2 (any x86-64 compiler), and one byte at a time otherwise.
+ *
+ * \return the number of offsets stored.
  */
-int
-dxf_read_line (char * temp_string, DxfFile *fp)
+size_t
+dxf_reader_index_lines
+(
+        const char *buffer,
+                /*!< Buffer to scan. */
+        size_t start,
+                /*!< Offset of the first byte to scan. */
+        size_t end,
+                /*!< Offset past the last byte to scan. */
+        size_t *offsets,
+                /*!< Returns the offsets of the line terminators. */
+        size_t max_offsets,
+                /*!< Maximum number of offsets to store. */
+        size_t *scanned
+                /*!< Returns the offset past the last byte scanned,
+                 * \c end when less than \c max_offsets line
+                 * terminators were found. */
+)
 {
-#if DEBUG
-        DXF_DEBUG_BEGIN
+        size_t pos = start;
+        size_t count = 0;
+#if defined (__AVX2__) || defined (__SSE2__)
+        unsigned int mask;
 #endif
-        int ret;
+#if defined (__AVX2__)
+        const __m256i newlines = _mm256_set1_epi8 ('\n');
+
+        for (; pos + 32 <= end; pos += 32)
+        {
+                mask = (unsigned int) _mm256_movemask_epi8 (_mm256_cmpeq_epi8 (
+                  _mm256_loadu_si256 ((const __m256i *) (buffer + pos)), newlines));
+#elif defined (__SSE2__)
+        const __m128i newlines = _mm_set1_epi8 ('\n');
 
-        ret = fscanf (fp->fp, "%[^\n]\n", temp_string);
-        if (ret == EOF)
+        for (; pos + 16 <= end; pos += 16)
         {
-                if (ferror (fp->fp))
+                mask = (unsigned int) _mm_movemask_epi8 (_mm_cmpeq_epi8 (
+                  _mm_loadu_si128 ((const __m128i *) (buffer + pos)), newlines));
+#endif
+#if defined (__AVX2__) || defined (__SSE2__)
+                while (mask != 0)
                 {
-                        fprintf (stderr,
-                          (_("Error: while reading from: %s in line: %d.\n")),
-                          fp->filename, fp->line_number);
+                        if (count == max_offsets)
+                        {
+                                *scanned = offsets[count - 1] + 1;
+                                return (count);
+                        }
+                        offsets[count++] = pos + __builtin_ctz (mask);
+                        mask &= mask - 1;
                 }
-                /* Return failure on EOF or error. */
-                return (EXIT_FAILURE);
         }
-        if (ret == 1)
+#endif
+        for (; pos < end; pos++)
         {
-                fp->line_number++;
+                if (buffer[pos] == '\n')
+                {
+                        if (count == max_offsets)
+                        {
+                                *scanned = offsets[count - 1] + 1;
+                                return (count);
+                        }
+                        offsets[count++] = pos;
+                }
         }
-        else
+        *scanned = end;
+        return (count);
+}
+
+
+/*!
+ * \brief Forget the line terminators indexed by a \c DxfReader, after
+ * the contents of its buffer changed.
+ */
+static void
+dxf_reader_reset_line_index
+(
+        DxfReader *reader
+                /*!< a pointer to the \c DxfReader. */
+)
+{
+        reader->line_index_from = 0;
+        reader->line_index_to = 0;
+        reader->line_index_count = 0;
+        reader->line_index_next = 0;
+}
+
+
+/*!
+ * \brief Find the end of the line at \c start in the buffer of a
+ * \c DxfReader.
+ *
+ * The line terminators are indexed \c DXF_READER_LINE_INDEX_SIZE at a
+ * time with dxf_reader_index_lines ().
+ *
+ * \return the offset of the line terminator, or \c end when the
+ * buffer holds no line terminator after \c start.
+ */
+static size_t
+dxf_reader_find_line_end
+(
+        DxfReader *reader
+                /*!< a pointer to the \c DxfReader. */
+)
+{
+        if ((reader->start < reader->line_index_from)
+          || (reader->start >= reader->line_index_to)
+          || (reader->line_index_to > reader->end))
         {
-                /* No items read; treat as a failure. */
-                return (EXIT_FAILURE);
+                reader->line_index_count = (int) dxf_reader_index_lines (
+                  reader->buffer, reader->start, reader->end,
+                  reader->line_index, DXF_READER_LINE_INDEX_SIZE,
+                  &reader->line_index_to);
+                reader->line_index_from = reader->start;
+                reader->line_index_next = 0;
         }
-#if DEBUG
-        DXF_DEBUG_END
-#endif
-        return ret;
+        /* The start moves back after a pair was pushed back. */
+        while ((reader->line_index_next > 0)
+          && (reader->line_index[reader->line_index_next - 1] >= reader->start))
+        {
+                reader->line_index_next--;
+        }
+        while ((reader->line_index_next < reader->line_index_count)
+          && (reader->line_index[reader->line_index_next] < reader->start))
+        {
+                reader->line_index_next++;
+        }
+        if (reader->line_index_next == reader->line_index_count)
+        {
+                return (reader->end);
+        }
+        return (reader->line_index[reader->line_index_next]);
 }
 
+
 /*!
- * \brief Uses of fscanf with other features.
- * 
- * Uses fscanf for file parsing, but also tracks the lines it reads;
- * 
+ * \brief Read the next block from file into the buffer of a
+ * \c DxfReader.
+ *
+ * Bytes already handed out (before the last pair) are discarded, the
+ * buffer is grown when a single line does not fit.
+ *
+ * \return the number of bytes read.
  */
-int
-dxf_read_scanf (DxfFile *fp, const char *template, ...)
+static size_t
+dxf_reader_fill
+(
+        DxfReader *reader
+                /*!< a pointer to the \c DxfReader. */
+)
 {
-#if DEBUG
-        DXF_DEBUG_BEGIN
-#endif
-        int ret;
-        va_list lst;
-        va_start (lst, template);
-        ret = vfscanf (fp->fp, template, lst);
-        if (ferror (fp->fp))
+        size_t keep;
+        size_t n;
+        char *buffer;
+
+        if (reader->eof)
         {
-                fprintf (stderr,
-                  (_("Error: while reading from: %s in line: %d.\n")),
-                  fp->filename, fp->line_number);
-                return (EXIT_FAILURE);
+                return (0);
         }
-        va_end (lst);
-        if (ret)
-        {
-                /*
-                 * we have to find each \n from the template to know how many lines will we read;
-                 */
-                char * search_result;
-                search_result = (char *) template;
-                while (TRUE)
+        /* The line index holds offsets into the old contents. */
+        dxf_reader_reset_line_index (reader);
+        /* Move the bytes still needed to the front of the buffer. */
+        keep = (reader->pair_start < reader->start) ? reader->pair_start : reader->start;
+        if (keep > 0)
+        {
+                memmove (reader->buffer, reader->buffer + keep, reader->end - keep);
+                reader->offset += keep;
+                reader->end -= keep;
+                reader->start -= keep;
+                reader->pair_start -= keep;
+        }
+        if (reader->end == reader->size)
+        {
+                buffer = realloc (reader->buffer, 2 * reader->size);
+                if (buffer == NULL)
                 {
-                        search_result = strstr (search_result, "\n");
-                        if (search_result == NULL)
-                                break;
-                        fp->line_number++;
-                        *++search_result;
+                        fprintf (stderr,
+                          (_("Error in %s () could not allocate memory.\n")),
+                          __FUNCTION__);
+                        reader->error = TRUE;
+                        return (0);
+                }
+                reader->buffer = buffer;
+                reader->size *= 2;
+        }
+        n = fread (reader->buffer + reader->end, 1, reader->size - reader->end, reader->fp);
+        if (n == 0)
+        {
+                if (ferror (reader->fp))
+                {
+                        reader->error = TRUE;
+                }
+                reader->eof = TRUE;
+        }
+        reader->end += n;
+        return (n);
+}
+
+
+/*!
+ * \brief Value types of the records in a binary DXF file.
+ */
+enum dxf_binary_type
+{
+        DXF_BINARY_STRING,
+                /*!< '\0' terminated string. */
+        DXF_BINARY_DOUBLE,
+                /*!< 8 byte IEEE double. */
+        DXF_BINARY_INT16,
+                /*!< 2 byte integer. */
+        DXF_BINARY_INT32,
+                /*!< 4 byte integer. */
+        DXF_BINARY_INT64,
+                /*!< 8 byte integer. */
+        DXF_BINARY_BOOL,
+                /*!< 1 byte boolean. */
+        DXF_BINARY_CHUNK
+                /*!< Length byte followed by up to 255 bytes of binary
+                 * data. */
+};
+
+
+/*!
+ * \brief Get the value type of a group code in a binary DXF file.
+ *
+ * \return one of the \c DXF_BINARY_* value types.
+ */
+static int
+dxf_binary_type
+(
+        int group_code
+                /*!< Group code. */
+)
+{
+        if (group_code < 10) return (DXF_BINARY_STRING);
+        if (group_code < 60) return (DXF_BINARY_DOUBLE);
+        if (group_code < 80) return (DXF_BINARY_INT16);
+        if (group_code < 100) return (DXF_BINARY_INT32);
+        if (group_code < 110) return (DXF_BINARY_STRING);
+        if (group_code < 160) return (DXF_BINARY_DOUBLE);
+        if (group_code < 170) return (DXF_BINARY_INT64);
+        if (group_code < 210) return (DXF_BINARY_INT16);
+        if (group_code < 270) return (DXF_BINARY_DOUBLE);
+        if (group_code < 290) return (DXF_BINARY_INT16);
+        if (group_code < 300) return (DXF_BINARY_BOOL);
+        if (group_code < 310) return (DXF_BINARY_STRING);
+        if (group_code < 320) return (DXF_BINARY_CHUNK);
+        if (group_code < 370) return (DXF_BINARY_STRING);
+        if (group_code < 390) return (DXF_BINARY_INT16);
+        if (group_code < 400) return (DXF_BINARY_STRING);
+        if (group_code < 410) return (DXF_BINARY_INT16);
+        if (group_code < 420) return (DXF_BINARY_STRING);
+        if (group_code < 430) return (DXF_BINARY_INT32);
+        if (group_code < 440) return (DXF_BINARY_STRING);
+        if (group_code < 460) return (DXF_BINARY_INT32);
+        if (group_code < 470) return (DXF_BINARY_DOUBLE);
+        if (group_code < 1004) return (DXF_BINARY_STRING);
+        if (group_code == 1004) return (DXF_BINARY_CHUNK);
+        if (group_code < 1010) return (DXF_BINARY_STRING);
+        if (group_code < 1060) return (DXF_BINARY_DOUBLE);
+        if (group_code < 1071) return (DXF_BINARY_INT16);
+        if (group_code == 1071) return (DXF_BINARY_INT32);
+        return (DXF_BINARY_STRING);
+}
+
+
+/*!
+ * \brief Get a little endian unsigned integer of \c size bytes.
+ *
+ * \return the value.
+ */
+static uint64_t
+dxf_binary_get
+(
+        const unsigned char *p,
+                /*!< Pointer to the first byte. */
+        int size
+                /*!< Number of bytes, at most 8. */
+)
+{
+        uint64_t value = 0;
+
+        while (size-- > 0)
+        {
+                value = (value << 8) | p[size];
+        }
+        return (value);
+}
+
+
+/*!
+ * \brief Make sure at least \c n unread bytes are in the buffer of a
+ * \c DxfReader.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when the end
+ * of the file was reached first.
+ */
+static int
+dxf_reader_ensure
+(
+        DxfReader *reader,
+                /*!< a pointer to the \c DxfReader. */
+        size_t n
+                /*!< Number of bytes needed. */
+)
+{
+        while (reader->end - reader->start < n)
+        {
+                if (dxf_reader_fill (reader) == 0)
+                {
+                        return (EXIT_FAILURE);
                 }
         }
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Detect the sentinel of a binary DXF file at the start of the
+ * input of a \c DxfFile.
+ *
+ * For a binary file the sentinel is skipped and the size of the group
+ * codes is guessed from the first record: R12 files use a single byte,
+ * later releases two bytes.
+ */
+static void
+dxf_reader_detect_binary
+(
+        DxfFile *fp
+                /*!< DXF file pointer to an input file (or device). */
+)
+{
+        DxfReader *reader = fp->reader;
+
+        if ((dxf_reader_ensure (reader, DXF_BINARY_SENTINEL_LENGTH) == EXIT_FAILURE)
+          || (memcmp (reader->buffer + reader->start, DXF_BINARY_SENTINEL,
+          DXF_BINARY_SENTINEL_LENGTH) != 0))
+        {
+                return;
+        }
+        reader->start += DXF_BINARY_SENTINEL_LENGTH;
+        reader->pair_start = reader->start;
+        reader->binary = 2;
+        /* The first record is a group code 0 followed by "SECTION", or
+         * a comment (999). With 2 byte group codes the second byte is
+         * the high byte of the group code (at most 4), with 1 byte
+         * group codes it is the first char of the value, or the low
+         * byte of an extended group code. */
+        if ((dxf_reader_ensure (reader, 2) == EXIT_SUCCESS)
+          && ((unsigned char) reader->buffer[reader->start + 1] > 4))
+        {
+                reader->binary = 1;
+        }
+}
+
+
+/*!
+ * \brief Get the next record from a binary DXF file.
+ *
+ * The group code is stored in \c binary_group_code, the value is
+ * decoded and kept until it is read as the next line, or with one of
+ * the typed dxf_read_* functions.
+ *
+ * \return \c EXIT_SUCCESS when a record was found, or \c EXIT_FAILURE
+ * at the end of the file or when an error occurred.
+ */
+static int
+dxf_reader_next_binary_record
+(
+        DxfFile *fp
+                /*!< DXF file pointer to an input file (or device). */
+)
+{
+        DxfReader *reader = fp->reader;
+        const unsigned char *p;
+        const char *nul;
+        size_t header;
+        size_t size;
+        size_t scanned;
+        uint64_t bits;
+        int group_code;
+        int type;
+
+        reader->binary_pending = FALSE;
+        if (dxf_reader_ensure (reader, (size_t) reader->binary) == EXIT_FAILURE)
+        {
+                if (reader->start < reader->end)
+                {
+                        goto truncated;
+                }
+                return (EXIT_FAILURE);
+        }
+        p = (const unsigned char *) reader->buffer + reader->start;
+        if (reader->binary == 1)
+        {
+                group_code = p[0];
+                header = 1;
+                if (group_code == 255)
+                {
+                        /* Extended group code in the next 2 bytes. */
+                        if (dxf_reader_ensure (reader, 3) == EXIT_FAILURE)
+                        {
+                                goto truncated;
+                        }
+                        p = (const unsigned char *) reader->buffer + reader->start;
+                        group_code = (int) dxf_binary_get (p + 1, 2);
+                        header = 3;
+                }
+        }
+        else
+        {
+                group_code = (int) dxf_binary_get (p, 2);
+                header = 2;
+        }
+        type = dxf_binary_type (group_code);
+        switch (type)
+        {
+                case DXF_BINARY_DOUBLE:
+                case DXF_BINARY_INT64:
+                        size = 8;
+                        break;
+                case DXF_BINARY_INT32:
+                        size = 4;
+                        break;
+                case DXF_BINARY_INT16:
+                        size = 2;
+                        break;
+                case DXF_BINARY_BOOL:
+                        size = 1;
+                        break;
+                case DXF_BINARY_CHUNK:
+                        if (dxf_reader_ensure (reader, header + 1) == EXIT_FAILURE)
+                        {
+                                goto truncated;
+                        }
+                        size = 1 + (unsigned char) reader->buffer[reader->start + header];
+                        break;
+                default:
+                        scanned = 0;
+                        while (TRUE)
+                        {
+                                nul = memchr (reader->buffer + reader->start + header + scanned,
+                                  '\0', reader->end - reader->start - header - scanned);
+                                if (nul != NULL)
+                                {
+                                        size = nul - (reader->buffer + reader->start + header) + 1;
+                                        break;
+                                }
+                                scanned = reader->end - reader->start - header;
+                                if (dxf_reader_fill (reader) == 0)
+                                {
+                                        goto truncated;
+                                }
+                        }
+                        break;
+        }
+        if (dxf_reader_ensure (reader, header + size) == EXIT_FAILURE)
+        {
+                goto truncated;
+        }
+        p = (const unsigned char *) reader->buffer + reader->start + header;
+        switch (type)
+        {
+                case DXF_BINARY_DOUBLE:
+                        bits = dxf_binary_get (p, 8);
+                        memcpy (&reader->binary_double, &bits, sizeof (double));
+                        break;
+                case DXF_BINARY_INT64:
+                        reader->binary_integer = (long long) (int64_t) dxf_binary_get (p, 8);
+                        break;
+                case DXF_BINARY_INT32:
+                        reader->binary_integer = (int32_t) (uint32_t) dxf_binary_get (p, 4);
+                        break;
+                case DXF_BINARY_INT16:
+                        reader->binary_integer = (int16_t) (uint16_t) dxf_binary_get (p, 2);
+                        break;
+                case DXF_BINARY_BOOL:
+                        reader->binary_integer = p[0];
+                        break;
+                case DXF_BINARY_CHUNK:
+                        reader->binary_value = (const char *) p + 1;
+                        reader->binary_length = size - 1;
+                        break;
+                default:
+                        reader->binary_value = (const char *) p;
+                        reader->binary_length = size - 1;
+                        break;
+        }
+        reader->start += header + size;
+        reader->binary_group_code = group_code;
+        reader->binary_type = type;
+        reader->binary_pending = TRUE;
+        fp->line_number++;
+        return (EXIT_SUCCESS);
+truncated:
+        fprintf (stderr,
+          (_("Error in %s () truncated binary record while reading from: %s in line: %d.\n")),
+          __FUNCTION__, fp->filename, fp->line_number);
+        reader->error = TRUE;
+        return (EXIT_FAILURE);
+}
+
+
+/*!
+ * \brief Get the next line from a binary DXF file.
+ *
+ * Each record is handed out as two lines, as in an ASCII DXF file: the
+ * group code, followed by the value.\n
+ * Numbers are formatted, binary chunks are formatted as hexadecimal
+ * text.
+ *
+ * \return \c EXIT_SUCCESS when a line was found, or \c EXIT_FAILURE at
+ * the end of the file or when an error occurred.
+ */
+static int
+dxf_reader_next_binary_line
+(
+        DxfFile *fp,
+                /*!< DXF file pointer to an input file (or device). */
+        const char **line,
+                /*!< Returns a pointer to the first char of the line. */
+        size_t *length
+                /*!< Returns the length of the line. */
+)
+{
+        static const char hex[] = "0123456789ABCDEF";
+        DxfReader *reader = fp->reader;
+        const unsigned char *p;
+        size_t i;
+
+        if (!reader->binary_pending)
+        {
+                if (dxf_reader_next_binary_record (fp) == EXIT_FAILURE)
+                {
+                        return (EXIT_FAILURE);
+                }
+                *line = reader->binary_line;
+                *length = snprintf (reader->binary_line, DXF_BINARY_LINE_LENGTH,
+                  "%d", reader->binary_group_code);
+                return (EXIT_SUCCESS);
+        }
+        reader->binary_pending = FALSE;
+        *line = reader->binary_line;
+        switch (reader->binary_type)
+        {
+                case DXF_BINARY_STRING:
+                        *line = reader->binary_value;
+                        *length = reader->binary_length;
+                        break;
+                case DXF_BINARY_DOUBLE:
+                        *length = dxf_format_double (reader->binary_line,
+                          reader->binary_double);
+                        break;
+                case DXF_BINARY_CHUNK:
+                        p = (const unsigned char *) reader->binary_value;
+                        for (i = 0; i < reader->binary_length; i++)
+                        {
+                                reader->binary_line[2 * i] = hex[p[i] >> 4];
+                                reader->binary_line[2 * i + 1] = hex[p[i] & 0x0f];
+                        }
+                        *length = 2 * reader->binary_length;
+                        break;
+                default:
+                        *length = snprintf (reader->binary_line, DXF_BINARY_LINE_LENGTH,
+                          "%lld", reader->binary_integer);
+                        break;
+        }
+        fp->line_number++;
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Take the pending value of a binary record as a number,
+ * without formatting it as a line.
+ *
+ * \return \c TRUE when a numeric value was taken, \c FALSE when the
+ * file is not binary or the pending value is not a number.
+ */
+static int
+dxf_reader_take_binary_number
+(
+        DxfFile *fp,
+                /*!< DXF file pointer to an input file (or device). */
+        int real,
+                /*!< Take a real (\c TRUE) or an integer (\c FALSE). */
+        double *d,
+                /*!< Returns the real value. */
+        long long *l
+                /*!< Returns the integer value. */
+)
+{
+        DxfReader *reader;
+
+        if ((fp == NULL) || (fp->reader == NULL)
+          || (!fp->reader->binary_pending))
+        {
+                return (FALSE);
+        }
+        reader = fp->reader;
+        switch (reader->binary_type)
+        {
+                case DXF_BINARY_STRING:
+                case DXF_BINARY_CHUNK:
+                        return (FALSE);
+                case DXF_BINARY_DOUBLE:
+                        if (!real)
+                        {
+                                return (FALSE);
+                        }
+                        *d = reader->binary_double;
+                        break;
+                default:
+                        if (real)
+                        {
+                                *d = (double) reader->binary_integer;
+                        }
+                        else
+                        {
+                                *l = reader->binary_integer;
+                        }
+                        break;
+        }
+        reader->binary_pending = FALSE;
+        fp->line_number++;
+        return (TRUE);
+}
+
+
+/*!
+ * \brief Get the next line from a \c DxfFile.
+ *
+ * The line terminator ("\\n" or "\\r\\n") is not part of the slice.
+ *
+ * \return \c EXIT_SUCCESS when a line was found, or \c EXIT_FAILURE at
+ * the end of the file or when an error occurred.
+ */
+int
+dxf_reader_next_line
+(
+        DxfFile *fp,
+                /*!< DXF file pointer to an input file (or device). */
+        const char **line,
+                /*!< Returns a pointer to the first char of the line. */
+        size_t *length
+                /*!< Returns the length of the line. */
+)
+{
+        DxfReader *reader;
+        size_t newline;
+        size_t next;
+        size_t n;
+
+        if ((fp == NULL) || (fp->reader == NULL))
+        {
+                return (EXIT_FAILURE);
+        }
+        reader = fp->reader;
+        if (reader->binary)
+        {
+                return (dxf_reader_next_binary_line (fp, line, length));
+        }
+        while (TRUE)
+        {
+                newline = dxf_reader_find_line_end (reader);
+                if (newline < reader->end)
+                {
+                        n = newline - reader->start;
+                        next = newline + 1;
+                        break;
+                }
+                if (dxf_reader_fill (reader) == 0)
+                {
+                        if (reader->start >= reader->end)
+                        {
+                                return (EXIT_FAILURE);
+                        }
+                        /* Last line without a line terminator. */
+                        n = reader->end - reader->start;
+                        next = reader->end;
+                        break;
+                }
+        }
+        *line = reader->buffer + reader->start;
+        if ((n > 0) && ((*line)[n - 1] == '\r'))
+        {
+                n--;
+        }
+        *length = n;
+        reader->start = next;
+        fp->line_number++;
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Parse a (possibly padded) decimal or hexadecimal integer from
+ * a slice.
+ *
+ * \return \c EXIT_SUCCESS when a number was found, or \c EXIT_FAILURE
+ * when the slice does not contain a number.
+ */
+int
+dxf_reader_parse_long
+(
+        const char *s,
+                /*!< Pointer to the slice. */
+        size_t length,
+                /*!< Length of the slice. */
+        int base,
+                /*!< Number base, 10 or 16. */
+        long long *value
+                /*!< Returns the parsed value. */
+)
+{
+        char temp[32];
+        char *tail;
+
+        while ((length > 0) && isspace ((unsigned char) *s))
+        {
+                s++;
+                length--;
+        }
+        while ((length > 0) && isspace ((unsigned char) s[length - 1]))
+        {
+                length--;
+        }
+        if ((length == 0) || (length >= sizeof (temp)))
+        {
+                return (EXIT_FAILURE);
+        }
+        memcpy (temp, s, length);
+        temp[length] = '\0';
+        if (base == 16)
+        {
+                *value = (long long) strtoull (temp, &tail, 16);
+        }
+        else
+        {
+                *value = strtoll (temp, &tail, 10);
+        }
+        return ((tail == temp) ? EXIT_FAILURE : EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Powers of ten that are exactly representable as a double.
+ */
+static const double dxf_exact_powers_of_ten[] =
+{
+        1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11,
+        1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22
+};
+
+
+/*!
+ * \brief Parse a floating point number with strtod (), independent of
+ * the current locale.
+ *
+ * This is the slow path of dxf_reader_parse_double ().
+ *
+ * \return \c EXIT_SUCCESS when a number was found, or \c EXIT_FAILURE
+ * when the slice does not contain a number.
+ */
+static int
+dxf_reader_parse_double_slow
+(
+        const char *s,
+                /*!< Pointer to the slice, without leading white space. */
+        size_t length,
+                /*!< Length of the slice. */
+        double *value
+                /*!< Returns the parsed value. */
+)
+{
+        char temp[128];
+        char *tail;
+        char *dot;
+        const char *decimal_point;
+
+        if ((length == 0) || (length >= sizeof (temp)))
+        {
+                return (EXIT_FAILURE);
+        }
+        memcpy (temp, s, length);
+        temp[length] = '\0';
+        /* strtod () expects the decimal point of the current locale. */
+        decimal_point = localeconv ()->decimal_point;
+        if ((decimal_point[0] != '.')
+          && (decimal_point[1] == '\0')
+          && ((dot = strchr (temp, '.')) != NULL))
+        {
+                *dot = decimal_point[0];
+        }
+        *value = strtod (temp, &tail);
+        return ((tail == temp) ? EXIT_FAILURE : EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Parse a (possibly padded) floating point number from a slice.
+ *
+ * The decimal point is always a '.', regardless of the current
+ * locale.\n
+ * Up to 19 significant digits are accumulated in a 64 bit integer.
+ * When this mantissa is at most 2^53 and the decimal exponent is within
+ * [-22, 22] both operands are exact doubles and a single correctly
+ * rounded multiplication or division gives the exact result (Clinger's
+ * fast path).\n
+ * This covers nearly all coordinates found in DXF files, all other
+ * input (long mantissas, large exponents, "inf", "nan", ...) falls back
+ * to strtod ().
+ *
+ * \return \c EXIT_SUCCESS when a number was found, or \c EXIT_FAILURE
+ * when the slice does not contain a number.
+ */
+int
+dxf_reader_parse_double
+(
+        const char *s,
+                /*!< Pointer to the slice. */
+        size_t length,
+                /*!< Length of the slice. */
+        double *value
+                /*!< Returns the parsed value. */
+)
+{
+        const char *p;
+        const char *end;
+        uint64_t mantissa;
+        int digits;
+        int exponent;
+        int exponent_value;
+        int negative;
+        int negative_exponent;
+        int truncated;
+        int found;
+        double result;
+
+        while ((length > 0) && isspace ((unsigned char) *s))
+        {
+                s++;
+                length--;
+        }
+        while ((length > 0) && isspace ((unsigned char) s[length - 1]))
+        {
+                length--;
+        }
+        if (length == 0)
+        {
+                return (EXIT_FAILURE);
+        }
+        p = s;
+        end = s + length;
+        negative = FALSE;
+        if ((*p == '-') || (*p == '+'))
+        {
+                negative = (*p == '-');
+                p++;
+        }
+        mantissa = 0;
+        digits = 0;
+        exponent = 0;
+        truncated = FALSE;
+        found = FALSE;
+        /* Integer part. */
+        while ((p < end) && (*p >= '0') && (*p <= '9'))
+        {
+                found = TRUE;
+                if (digits < 19)
+                {
+                        mantissa = (10 * mantissa) + (*p - '0');
+                        if (mantissa != 0)
+                        {
+                                digits++;
+                        }
+                }
+                else
+                {
+                        exponent++;
+                        truncated |= (*p != '0');
+                }
+                p++;
+        }
+        /* Fractional part. */
+        if ((p < end) && (*p == '.'))
+        {
+                p++;
+                while ((p < end) && (*p >= '0') && (*p <= '9'))
+                {
+                        found = TRUE;
+                        if (digits < 19)
+                        {
+                                mantissa = (10 * mantissa) + (*p - '0');
+                                if (mantissa != 0)
+                                {
+                                        digits++;
+                                }
+                                exponent--;
+                        }
+                        else
+                        {
+                                truncated |= (*p != '0');
+                        }
+                        p++;
+                }
+        }
+        if (!found)
+        {
+                return (dxf_reader_parse_double_slow (s, length, value));
+        }
+        /* Exponent part. */
+        if ((p < end) && ((*p == 'e') || (*p == 'E')))
+        {
+                p++;
+                negative_exponent = FALSE;
+                if ((p < end) && ((*p == '-') || (*p == '+')))
+                {
+                        negative_exponent = (*p == '-');
+                        p++;
+                }
+                if ((p == end) || (*p < '0') || (*p > '9'))
+                {
+                        return (dxf_reader_parse_double_slow (s, length, value));
+                }
+                exponent_value = 0;
+                while ((p < end) && (*p >= '0') && (*p <= '9'))
+                {
+                        if (exponent_value < 10000)
+                        {
+                                exponent_value = (10 * exponent_value) + (*p - '0');
+                        }
+                        p++;
+                }
+                exponent += negative_exponent ? -exponent_value : exponent_value;
+        }
+#if defined (FLT_EVAL_METHOD) && (FLT_EVAL_METHOD == 0)
+        if ((p == end)
+          && (!truncated)
+          && (mantissa <= ((uint64_t) 1 << 53))
+          && (exponent >= -22)
+          && (exponent <= 22))
+        {
+                result = (double) mantissa;
+                if (exponent < 0)
+                {
+                        result /= dxf_exact_powers_of_ten[-exponent];
+                }
+                else
+                {
+                        result *= dxf_exact_powers_of_ten[exponent];
+                }
+                *value = negative ? -result : result;
+                return (EXIT_SUCCESS);
+        }
+#endif
+        return (dxf_reader_parse_double_slow (s, length, value));
+}
+
+
+/*!
+ * \brief Value of a hexadecimal digit.
+ *
+ * \return the value of \c c, or -1 when \c c is not a hexadecimal
+ * digit.
+ */
+static int
+dxf_reader_hex_digit
+(
+        char c
+                /*!< the digit. */
+)
+{
+        if ((c >= '0') && (c <= '9'))
+                return (c - '0');
+        if ((c >= 'A') && (c <= 'F'))
+                return (c - 'A' + 10);
+        if ((c >= 'a') && (c <= 'f'))
+                return (c - 'a' + 10);
+        return (-1);
+}
+
+
+/*!
+ * \brief Decode a string of hexadecimal digit pairs into bytes.
+ *
+ * Upper and lower case digits are accepted.  Decoding stops at the
+ * first pair that is not two hexadecimal digits, a trailing single
+ * digit is not decoded.\n
+ * The digits are decoded 32 at a time when compiled for AVX2 (for
+ * example with -mavx2), 16 at a time when compiled for SSE2 (any
+ * x86-64 compiler), and one pair at a time otherwise.
+ *
+ * \return the number of bytes stored in \c bytes, at most
+ * \c length / 2.
+ */
+size_t
+dxf_reader_decode_hex
+(
+        const char *s,
+                /*!< Hexadecimal digits, not necessarily terminated. */
+        size_t length,
+                /*!< Number of chars in \c s. */
+        uint8_t *bytes
+                /*!< Returns the decoded bytes. */
+)
+{
+        size_t pos = 0;
+        size_t count = 0;
+        int high;
+        int low;
+#if defined (__AVX2__)
+        const __m256i zeros = _mm256_set1_epi8 ('0');
+        const __m256i letters = _mm256_set1_epi8 ('a');
+        const __m256i case_bit = _mm256_set1_epi8 (0x20);
+        const __m256i minus_one = _mm256_set1_epi8 (-1);
+        const __m256i ten = _mm256_set1_epi8 (10);
+        const __m256i six = _mm256_set1_epi8 (6);
+        const __m256i low_byte = _mm256_set1_epi16 (0x00ff);
+        __m256i v;
+        __m256i digits;
+        __m256i alphas;
+        __m256i is_digit;
+        __m256i is_alpha;
+        __m256i nibbles;
+
+        for (; pos + 32 <= length; pos += 32, count += 16)
+        {
+                v = _mm256_loadu_si256 ((const __m256i *) (s + pos));
+                digits = _mm256_sub_epi8 (v, zeros);
+                alphas = _mm256_sub_epi8 (_mm256_or_si256 (v, case_bit), letters);
+                is_digit = _mm256_and_si256 (_mm256_cmpgt_epi8 (digits, minus_one),
+                  _mm256_cmpgt_epi8 (ten, digits));
+                is_alpha = _mm256_and_si256 (_mm256_cmpgt_epi8 (alphas, minus_one),
+                  _mm256_cmpgt_epi8 (six, alphas));
+                if (_mm256_movemask_epi8 (_mm256_or_si256 (is_digit, is_alpha)) != -1)
+                {
+                        break;
+                }
+                nibbles = _mm256_or_si256 (_mm256_and_si256 (is_digit, digits),
+                  _mm256_and_si256 (is_alpha, _mm256_add_epi8 (alphas, ten)));
+                /* Each 16 bit lane holds the high digit in its low
+                 * byte and the low digit in its high byte. */
+                nibbles = _mm256_and_si256 (_mm256_or_si256 (_mm256_slli_epi16 (nibbles, 4),
+                  _mm256_srli_epi16 (nibbles, 8)), low_byte);
+                nibbles = _mm256_permute4x64_epi64 (_mm256_packus_epi16 (nibbles, nibbles), 0x08);
+                _mm_storeu_si128 ((__m128i *) (bytes + count), _mm256_castsi256_si128 (nibbles));
+        }
+#elif defined (__SSE2__)
+        const __m128i zeros = _mm_set1_epi8 ('0');
+        const __m128i letters = _mm_set1_epi8 ('a');
+        const __m128i case_bit = _mm_set1_epi8 (0x20);
+        const __m128i minus_one = _mm_set1_epi8 (-1);
+        const __m128i ten = _mm_set1_epi8 (10);
+        const __m128i six = _mm_set1_epi8 (6);
+        const __m128i low_byte = _mm_set1_epi16 (0x00ff);
+        __m128i v;
+        __m128i digits;
+        __m128i alphas;
+        __m128i is_digit;
+        __m128i is_alpha;
+        __m128i nibbles;
+
+        for (; pos + 16 <= length; pos += 16, count += 8)
+        {
+                v = _mm_loadu_si128 ((const __m128i *) (s + pos));
+                digits = _mm_sub_epi8 (v, zeros);
+                alphas = _mm_sub_epi8 (_mm_or_si128 (v, case_bit), letters);
+                is_digit = _mm_and_si128 (_mm_cmpgt_epi8 (digits, minus_one),
+                  _mm_cmplt_epi8 (digits, ten));
+                is_alpha = _mm_and_si128 (_mm_cmpgt_epi8 (alphas, minus_one),
+                  _mm_cmplt_epi8 (alphas, six));
+                if (_mm_movemask_epi8 (_mm_or_si128 (is_digit, is_alpha)) != 0xffff)
+                {
+                        break;
+                }
+                nibbles = _mm_or_si128 (_mm_and_si128 (is_digit, digits),
+                  _mm_and_si128 (is_alpha, _mm_add_epi8 (alphas, ten)));
+                /* Each 16 bit lane holds the high digit in its low
+                 * byte and the low digit in its high byte. */
+                nibbles = _mm_and_si128 (_mm_or_si128 (_mm_slli_epi16 (nibbles, 4),
+                  _mm_srli_epi16 (nibbles, 8)), low_byte);
+                _mm_storel_epi64 ((__m128i *) (bytes + count), _mm_packus_epi16 (nibbles, nibbles));
+        }
+#endif
+        for (; pos + 2 <= length; pos += 2)
+        {
+                high = dxf_reader_hex_digit (s[pos]);
+                low = dxf_reader_hex_digit (s[pos + 1]);
+                if ((high < 0) || (low < 0))
+                {
+                        break;
+                }
+                bytes[count++] = (uint8_t) ((high << 4) | low);
+        }
+        return (count);
+}
+
+
+/*!
+ * \brief Format a double as the shortest string that reads back to the
+ * same value.
+ *
+ * The value is printed with 15, 16 and 17 significant digits, the
+ * first one that parses back to \c value is kept.\n
+ * Trailing zeros are not printed, the decimal point is always a '.',
+ * regardless of the current locale, and integral values get a ".0"
+ * appended so that they still read as a real.
+ *
+ * \return the length of the formatted string.
+ */
+int
+dxf_format_double
+(
+        char *s,
+                /*!< Buffer of at least \c DXF_DOUBLE_STRING_LENGTH
+                 * chars. */
+        double value
+                /*!< The value to format. */
+)
+{
+        const char *decimal_point;
+        double check;
+        double magnitude;
+        double scaled;
+        uint64_t m;
+        char digits[DXF_DOUBLE_STRING_LENGTH];
+        int precision;
+        int length;
+        int n;
+        int k;
+        int i;
+
+        if (!isfinite (value))
+        {
+                return (snprintf (s, DXF_DOUBLE_STRING_LENGTH, "%g", value));
+        }
+        if (value == 0.0)
+        {
+                strcpy (s, signbit (value) ? "-0.0" : "0.0");
+                return (signbit (value) ? 4 : 3);
+        }
+        /* Fast path: most values have a short fixed point
+         * representation, m / 10^k with m of at most 15 digits.\n
+         * Dividing two exact doubles is correctly rounded, just like
+         * parsing the decimal string, so the check below is exact, and
+         * the result is the same as printed with "%.15g" below. */
+        magnitude = fabs (value);
+        if ((magnitude >= 1e-4) && (magnitude < 1e15))
+        {
+                for (k = 0; k <= 17; k++)
+                {
+                        scaled = magnitude * dxf_exact_powers_of_ten[k];
+                        if (scaled >= 999999999999999.0)
+                        {
+                                break;
+                        }
+                        m = (uint64_t) (scaled + 0.5);
+                        if ((double) m / dxf_exact_powers_of_ten[k] != magnitude)
+                        {
+                                continue;
+                        }
+                        n = 0;
+                        do
+                        {
+                                digits[n++] = (char) ('0' + (m % 10));
+                                m /= 10;
+                        }
+                        while ((m > 0) || (n <= k));
+                        length = 0;
+                        if (value < 0.0)
+                        {
+                                s[length++] = '-';
+                        }
+                        while (n > k)
+                        {
+                                s[length++] = digits[--n];
+                        }
+                        s[length++] = '.';
+                        if (k == 0)
+                        {
+                                s[length++] = '0';
+                        }
+                        while (n > 0)
+                        {
+                                s[length++] = digits[--n];
+                        }
+                        s[length] = '\0';
+                        return (length);
+                }
+        }
+        decimal_point = localeconv ()->decimal_point;
+        for (precision = 15; precision <= 17; precision++)
+        {
+                length = snprintf (s, DXF_DOUBLE_STRING_LENGTH, "%.*g", precision, value);
+                if ((decimal_point[0] != '.') && (decimal_point[1] == '\0'))
+                {
+                        for (i = 0; i < length; i++)
+                        {
+                                if (s[i] == decimal_point[0])
+                                {
+                                        s[i] = '.';
+                                }
+                        }
+                }
+                if ((dxf_reader_parse_double (s, length, &check) == EXIT_SUCCESS)
+                  && (check == value))
+                {
+                        break;
+                }
+        }
+        if (strpbrk (s, ".e") == NULL)
+        {
+                s[length++] = '.';
+                s[length++] = '0';
+                s[length] = '\0';
+        }
+        return (length);
+}
+
+
+/*!
+ * \brief Allocate memory for a \c DxfWriter and it's block buffer.
+ *
+ * A writer without a file handle keeps all output in memory, it's
+ * block buffer grows as needed.
+ *
+ * \return \c NULL when no memory was allocated, a pointer to the
+ * allocated memory when successful.
+ */
+DxfWriter *
+dxf_writer_new
+(
+        FILE *fp
+                /*!< File handle to write blocks to, or \c NULL to
+                 * collect the output in memory. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfWriter *writer = NULL;
+        int i;
+
+        if ((writer = malloc (sizeof (DxfWriter))) == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () could not allocate memory.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        memset (writer, 0, sizeof (DxfWriter));
+        writer->size = DXF_WRITER_BUFFER_SIZE;
+        if ((writer->buffer = malloc (writer->size)) == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () could not allocate memory.\n")),
+                  __FUNCTION__);
+                free (writer);
+                return (NULL);
+        }
+        for (i = 0; i < DXF_WRITER_PREFIXES; i++)
+        {
+                snprintf (writer->prefixes[i], sizeof (writer->prefixes[i]), "%3d\n", i);
+        }
+        writer->fp = fp;
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (writer);
+}
+
+
+/*!
+ * \brief Write the contents of the block buffer of a \c DxfWriter to
+ * file.
+ *
+ * The output of a writer without a file handle stays in memory.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_writer_flush
+(
+        DxfWriter *writer
+                /*!< a pointer to the \c DxfWriter. */
+)
+{
+        if (writer == NULL)
+        {
+                return (EXIT_FAILURE);
+        }
+        if (writer->fp == NULL)
+        {
+                return ((writer->error) ? EXIT_FAILURE : EXIT_SUCCESS);
+        }
+        if ((writer->used > 0)
+          && (fwrite (writer->buffer, 1, writer->used, writer->fp) != writer->used))
+        {
+                writer->error = TRUE;
+        }
+        writer->used = 0;
+        return ((writer->error) ? EXIT_FAILURE : EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Flush and free the allocated memory for a \c DxfWriter.
+ *
+ * The file handle is not closed, it is owned by the \c DxfFile.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred while writing.
+ */
+int
+dxf_writer_free
+(
+        DxfWriter *writer
+                /*!< a pointer to the \c DxfWriter. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        int result;
+
+        if (writer == NULL)
+        {
+                return (EXIT_SUCCESS);
+        }
+        result = dxf_writer_flush (writer);
+        free (writer->buffer);
+        free (writer);
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (result);
+}
+
+
+/*!
+ * \brief Make room for \c length bytes in the block buffer of a
+ * \c DxfWriter.
+ *
+ * The block buffer is flushed to file, or grown for a writer without a
+ * file handle.
+ *
+ * \return \c TRUE when \c length bytes fit in the block buffer,
+ * \c FALSE when they have to be written to file directly or when no
+ * memory could be allocated.
+ */
+static int
+dxf_writer_reserve
+(
+        DxfWriter *writer,
+                /*!< a pointer to the \c DxfWriter. */
+        size_t length
+                /*!< Number of bytes to make room for. */
+)
+{
+        char *buffer;
+        size_t size;
+
+        if (writer->size - writer->used >= length)
+        {
+                return (TRUE);
+        }
+        if (writer->fp != NULL)
+        {
+                dxf_writer_flush (writer);
+                return (writer->size >= length);
+        }
+        size = writer->size * 2;
+        while (size - writer->used < length)
+        {
+                size *= 2;
+        }
+        if ((buffer = realloc (writer->buffer, size)) == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () could not allocate memory.\n")),
+                  __FUNCTION__);
+                writer->error = TRUE;
+                return (FALSE);
+        }
+        writer->buffer = buffer;
+        writer->size = size;
+        return (TRUE);
+}
+
+
+/*!
+ * \brief Append \c length bytes to the output of a \c DxfWriter.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+static int
+dxf_writer_put
+(
+        DxfWriter *writer,
+                /*!< a pointer to the \c DxfWriter. */
+        const void *data,
+                /*!< Pointer to the first byte. */
+        size_t length
+                /*!< Number of bytes. */
+)
+{
+        if (!dxf_writer_reserve (writer, length))
+        {
+                /* Longer than the block buffer. */
+                if ((writer->fp != NULL)
+                  && (fwrite (data, 1, length, writer->fp) != length))
+                {
+                        writer->error = TRUE;
+                }
+                return ((writer->error) ? EXIT_FAILURE : EXIT_SUCCESS);
+        }
+        memcpy (writer->buffer + writer->used, data, length);
+        writer->used += length;
+        return ((writer->error) ? EXIT_FAILURE : EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Write the group code of a binary DXF record.
+ *
+ * DXF R12 and earlier use a single byte, with 255 followed by a 2 byte
+ * group code for group codes of 255 and up, DXF R13 and later use 2
+ * bytes.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+static int
+dxf_write_binary_group_code
+(
+        DxfFile *fp,
+                /*!< DXF file pointer to an output file (or device). */
+        int group_code
+                /*!< Group code. */
+)
+{
+        unsigned char bytes[3];
+        size_t size;
+
+        if ((fp->acad_version_number < AutoCAD_13)
+          && (group_code >= 0)
+          && (group_code < 255))
+        {
+                bytes[0] = (unsigned char) group_code;
+                size = 1;
+        }
+        else if (fp->acad_version_number < AutoCAD_13)
+        {
+                bytes[0] = 255;
+                bytes[1] = (unsigned char) (group_code & 0xff);
+                bytes[2] = (unsigned char) ((group_code >> 8) & 0xff);
+                size = 3;
+        }
+        else
+        {
+                bytes[0] = (unsigned char) (group_code & 0xff);
+                bytes[1] = (unsigned char) ((group_code >> 8) & 0xff);
+                size = 2;
+        }
+        return (dxf_writer_put (fp->writer, bytes, size));
+}
+
+
+/*!
+ * \brief Write a binary DXF record holding a number.
+ *
+ * \c real is written for a group code of type \c DXF_BINARY_DOUBLE,
+ * \c integer in the size of \c type otherwise.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+static int
+dxf_write_binary_number
+(
+        DxfFile *fp,
+                /*!< DXF file pointer to an output file (or device). */
+        int group_code,
+                /*!< Group code. */
+        int type,
+                /*!< The \c DXF_BINARY_* value type of \c group_code. */
+        int64_t integer,
+                /*!< The value of an integer record. */
+        double real
+                /*!< The value of a real record. */
+)
+{
+        unsigned char bytes[8];
+        uint64_t bits;
+        size_t size;
+        size_t i;
+
+        if (type == DXF_BINARY_DOUBLE)
+        {
+                memcpy (&bits, &real, sizeof (double));
+                size = 8;
+        }
+        else
+        {
+                bits = (uint64_t) integer;
+                size = (type == DXF_BINARY_INT64) ? 8
+                  : (type == DXF_BINARY_INT32) ? 4
+                  : (type == DXF_BINARY_INT16) ? 2
+                  : 1;
+        }
+        for (i = 0; i < size; i++)
+        {
+                bytes[i] = (unsigned char) (bits >> (8 * i));
+        }
+        dxf_write_binary_group_code (fp, group_code);
+        return (dxf_writer_put (fp->writer, bytes, size));
+}
+
+
+/*!
+ * \brief Write a group code and a formatted value as a binary DXF
+ * record.
+ *
+ * The value is converted to the type of the group code: numbers are
+ * parsed, binary chunks are decoded from hexadecimal text.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when the value
+ * does not match the type of the group code or an error occurred.
+ */
+static int
+dxf_write_binary_pair
+(
+        DxfFile *fp,
+                /*!< DXF file pointer to an output file (or device). */
+        int group_code,
+                /*!< Group code. */
+        const char *value,
+                /*!< Pointer to the first char of the value. */
+        size_t length
+                /*!< Length of the value. */
+)
+{
+        DxfWriter *writer = fp->writer;
+        unsigned char bytes[256];
+        long long l = 0;
+        double d = 0.0;
+        size_t i;
+        int type;
+        int hi;
+        int lo;
+
+        type = dxf_binary_type (group_code);
+        switch (type)
+        {
+                case DXF_BINARY_STRING:
+                        dxf_write_binary_group_code (fp, group_code);
+                        dxf_writer_put (writer, value, length);
+                        return (dxf_writer_put (writer, "", 1));
+                case DXF_BINARY_CHUNK:
+                        while ((length > 0) && isspace ((unsigned char) value[length - 1]))
+                        {
+                                length--;
+                        }
+                        if (((length % 2) != 0) || (length / 2 > 255))
+                        {
+                                goto invalid;
+                        }
+                        bytes[0] = (unsigned char) (length / 2);
+                        for (i = 0; i < length / 2; i++)
+                        {
+                                hi = isdigit ((unsigned char) value[2 * i])
+                                  ? value[2 * i] - '0'
+                                  : (toupper ((unsigned char) value[2 * i]) - 'A' + 10);
+                                lo = isdigit ((unsigned char) value[2 * i + 1])
+                                  ? value[2 * i + 1] - '0'
+                                  : (toupper ((unsigned char) value[2 * i + 1]) - 'A' + 10);
+                                if ((hi < 0) || (hi > 15) || (lo < 0) || (lo > 15))
+                                {
+                                        goto invalid;
+                                }
+                                bytes[i + 1] = (unsigned char) ((hi << 4) | lo);
+                        }
+                        dxf_write_binary_group_code (fp, group_code);
+                        return (dxf_writer_put (writer, bytes, length / 2 + 1));
+                case DXF_BINARY_DOUBLE:
+                        if (dxf_reader_parse_double (value, length, &d) == EXIT_FAILURE)
+                        {
+                                goto invalid;
+                        }
+                        break;
+                default:
+                        if (dxf_reader_parse_long (value, length, 10, &l) == EXIT_FAILURE)
+                        {
+                                /* Some writers format integers as
+                                 * reals. */
+                                if (dxf_reader_parse_double (value, length, &d) == EXIT_FAILURE)
+                                {
+                                        goto invalid;
+                                }
+                                l = (long long) d;
+                        }
+                        break;
+        }
+        return (dxf_write_binary_number (fp, group_code, type, (int64_t) l, d));
+invalid:
+        fprintf (stderr,
+          (_("Error in %s () invalid value \"%.*s\" for group code %d while writing to: %s.\n")),
+          __FUNCTION__, (int) length, value, group_code, fp->filename);
+        writer->error = TRUE;
+        return (EXIT_FAILURE);
+}
+
+
+/*!
+ * \brief Write a group code and a formatted value to a \c DxfFile.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+static int
+dxf_write_pair
+(
+        DxfFile *fp,
+                /*!< DXF file pointer to an output file (or device). */
+        int group_code,
+                /*!< Group code. */
+        const char *value,
+                /*!< Pointer to the first char of the value. */
+        size_t length
+                /*!< Length of the value. */
+)
+{
+        DxfWriter *writer;
+        char prefix[16];
+        size_t prefix_length;
+
+        if (fp == NULL)
+        {
+                return (EXIT_FAILURE);
+        }
+        writer = fp->writer;
+        if (writer == NULL)
+        {
+                if (fprintf (fp->fp, "%3d\n%.*s\n", group_code, (int) length, value) < 0)
+                {
+                        return (EXIT_FAILURE);
+                }
+                return (EXIT_SUCCESS);
+        }
+        if (writer->binary)
+        {
+                return (dxf_write_binary_pair (fp, group_code, value, length));
+        }
+        if ((group_code >= 0) && (group_code < DXF_WRITER_PREFIXES))
+        {
+                prefix_length = (group_code < 1000) ? 4 : 5;
+                memcpy (prefix, writer->prefixes[group_code], prefix_length);
+        }
+        else
+        {
+                prefix_length = (size_t) snprintf (prefix, sizeof (prefix), "%3d\n", group_code);
+        }
+        if (!dxf_writer_reserve (writer, prefix_length + length + 1))
+        {
+                if (writer->fp != NULL)
+                {
+                        /* Longer than the block buffer. */
+                        if ((fwrite (prefix, 1, prefix_length, writer->fp) != prefix_length)
+                          || (fwrite (value, 1, length, writer->fp) != length)
+                          || (fputc ('\n', writer->fp) == EOF))
+                        {
+                                writer->error = TRUE;
+                        }
+                }
+                return ((writer->error) ? EXIT_FAILURE : EXIT_SUCCESS);
+        }
+        memcpy (writer->buffer + writer->used, prefix, prefix_length);
+        writer->used += prefix_length;
+        memcpy (writer->buffer + writer->used, value, length);
+        writer->used += length;
+        writer->buffer[writer->used++] = '\n';
+        return ((writer->error) ? EXIT_FAILURE : EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Write a group code and a string value to a \c DxfFile.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_write_string
+(
+        DxfFile *fp,
+                /*!< DXF file pointer to an output file (or device). */
+        int group_code,
+                /*!< Group code. */
+        const char *value
+                /*!< The value to write, \c NULL writes an empty
+                 * string. */
+)
+{
+        if (value == NULL)
+        {
+                value = "";
+        }
+        return (dxf_write_pair (fp, group_code, value, strlen (value)));
+}
+
+
+/*!
+ * \brief Write a group code with a string value given as a slice
+ * (pointer and length, not '\\0' terminated).
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_write_slice
+(
+        DxfFile *fp,
+                /*!< DXF file pointer to an output file (or device). */
+        int group_code,
+                /*!< Group code. */
+        const char *value,
+                /*!< Pointer to the first char of the value. */
+        size_t length
+                /*!< Length of the value. */
+)
+{
+        return (dxf_write_pair (fp, group_code, value, length));
+}
+
+
+/*!
+ * \brief Write a group code and an integer value to a \c DxfFile.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_write_int
+(
+        DxfFile *fp,
+                /*!< DXF file pointer to an output file (or device). */
+        int group_code,
+                /*!< Group code. */
+        int64_t value
+                /*!< The value to write. */
+)
+{
+        char s[24];
+        char *p = s + sizeof (s);
+        uint64_t magnitude;
+        int type;
+
+        if ((fp != NULL) && (fp->writer != NULL) && fp->writer->binary)
+        {
+                type = dxf_binary_type (group_code);
+                if ((type != DXF_BINARY_STRING) && (type != DXF_BINARY_CHUNK))
+                {
+                        return (dxf_write_binary_number (fp, group_code,
+                          type, value, (double) value));
+                }
+        }
+        magnitude = (value < 0) ? (uint64_t) 0 - (uint64_t) value : (uint64_t) value;
+        do
+        {
+                *--p = (char) ('0' + (magnitude % 10));
+                magnitude /= 10;
+        }
+        while (magnitude > 0);
+        if (value < 0)
+        {
+                *--p = '-';
+        }
+        return (dxf_write_pair (fp, group_code, p, (size_t) (s + sizeof (s) - p)));
+}
+
+
+/*!
+ * \brief Write a group code and a hexadecimal value (an id-code or
+ * handle) to a \c DxfFile.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_write_hex
+(
+        DxfFile *fp,
+                /*!< DXF file pointer to an output file (or device). */
+        int group_code,
+                /*!< Group code. */
+        uint64_t value
+                /*!< The value to write. */
+)
+{
+        static const char hex[] = "0123456789abcdef";
+        char s[16];
+        char *p = s + sizeof (s);
+
+        do
+        {
+                *--p = hex[value & 0x0f];
+                value >>= 4;
+        }
+        while (value > 0);
+        return (dxf_write_pair (fp, group_code, p, (size_t) (s + sizeof (s) - p)));
+}
+
+
+/*!
+ * \brief Write a group code and a double value to a \c DxfFile.
+ *
+ * The value is written with dxf_format_double (), so it keeps its full
+ * precision.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_write_double
+(
+        DxfFile *fp,
+                /*!< DXF file pointer to an output file (or device). */
+        int group_code,
+                /*!< Group code. */
+        double value
+                /*!< The value to write. */
+)
+{
+        char s[DXF_DOUBLE_STRING_LENGTH];
+        int length;
+        int type;
+
+        if ((fp != NULL) && (fp->writer != NULL) && fp->writer->binary)
+        {
+                type = dxf_binary_type (group_code);
+                if ((type != DXF_BINARY_STRING) && (type != DXF_BINARY_CHUNK))
+                {
+                        return (dxf_write_binary_number (fp, group_code,
+                          type, (int64_t) value, value));
+                }
+        }
+        length = dxf_format_double (s, value);
+        return (dxf_write_pair (fp, group_code, s, (size_t) length));
+}
+
+
+/*!
+ * \brief Get the next group code / value pair from a \c DxfFile.
+ *
+ * The group code is returned as an int, the value as a slice into the
+ * buffer of the \c DxfReader.
+ *
+ * \return \c EXIT_SUCCESS when a pair was found, or \c EXIT_FAILURE at
+ * the end of the file or when an error occurred.
+ */
+int
+dxf_reader_next_pair
+(
+        DxfFile *fp,
+                /*!< DXF file pointer to an input file (or device). */
+        int *group_code,
+                /*!< Returns the group code. */
+        const char **value,
+                /*!< Returns a pointer to the first char of the value. */
+        size_t *length
+                /*!< Returns the length of the value. */
+)
+{
+        DxfReader *reader;
+        const char *line;
+        size_t n;
+        long long code;
+
+        if ((fp == NULL) || (fp->reader == NULL))
+        {
+                return (EXIT_FAILURE);
+        }
+        reader = fp->reader;
+        reader->pair_start = reader->start;
+        if (reader->binary)
+        {
+                if (dxf_reader_next_binary_record (fp) == EXIT_FAILURE)
+                {
+                        return (EXIT_FAILURE);
+                }
+                code = reader->binary_group_code;
+        }
+        else
+        {
+                if (dxf_reader_next_line (fp, &line, &n) == EXIT_FAILURE)
+                {
+                        return (EXIT_FAILURE);
+                }
+                if (dxf_reader_parse_long (line, n, 10, &code) == EXIT_FAILURE)
+                {
+                        fprintf (stderr,
+                          (_("Error in %s () invalid group code while reading from: %s in line: %d.\n")),
+                          __FUNCTION__, fp->filename, fp->line_number);
+                        reader->error = TRUE;
+                        return (EXIT_FAILURE);
+                }
+        }
+        if (dxf_reader_next_line (fp, &line, &n) == EXIT_FAILURE)
+        {
+                return (EXIT_FAILURE);
+        }
+        reader->pair_lines = 2;
+        reader->group_code = (int) code;
+        reader->value = line;
+        reader->length = n;
+        *group_code = (int) code;
+        *value = line;
+        *length = n;
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Push back the last group code / value pair read from a
+ * \c DxfFile.
+ *
+ * The next call to dxf_reader_next_pair () returns the same pair
+ * again.\n
+ * Only one pair can be pushed back.
+ */
+void
+dxf_reader_push_back
+(
+        DxfFile *fp
+                /*!< DXF file pointer to an input file (or device). */
+)
+{
+        if ((fp == NULL) || (fp->reader == NULL))
+        {
+                return;
+        }
+        fp->reader->start = fp->reader->pair_start;
+        fp->line_number -= fp->reader->pair_lines;
+        fp->reader->pair_lines = 0;
+        fp->reader->binary_pending = FALSE;
+}
+
+
+/*!
+ * \brief Get the file offset of the next line to be read from a
+ * \c DxfFile.
+ *
+ * \return the offset in bytes from the start of the file, or -1 when an
+ * error occurred.
+ */
+int64_t
+dxf_read_tell
+(
+        DxfFile *fp
+                /*!< DXF file pointer to an input file (or device). */
+)
+{
+        if ((fp == NULL) || (fp->reader == NULL))
+        {
+                return (-1);
+        }
+        return (fp->reader->offset + (int64_t) fp->reader->start);
+}
+
+
+/*!
+ * \brief Continue reading a \c DxfFile at a file offset obtained with
+ * dxf_read_tell ().
+ *
+ * A memory mapped file only moves the read position, otherwise the
+ * file is repositioned and the block buffer is discarded.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_read_seek
+(
+        DxfFile *fp,
+                /*!< DXF file pointer to an input file (or device). */
+        int64_t offset,
+                /*!< File offset of the first line to read. */
+        int line_number
+                /*!< Number of lines before \c offset, the value of
+                 * \c fp->line_number when dxf_read_tell () returned
+                 * \c offset. */
+)
+{
+        DxfReader *reader;
+        int result;
+
+        if ((fp == NULL) || (fp->reader == NULL))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL file pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        reader = fp->reader;
+        if (offset < 0)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a negative offset was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        if (reader->mapped)
+        {
+                if ((uint64_t) offset > (uint64_t) reader->end)
+                {
+                        fprintf (stderr,
+                          (_("Error in %s () offset past the end of: %s.\n")),
+                          __FUNCTION__, fp->filename);
+                        return (EXIT_FAILURE);
+                }
+                reader->start = (size_t) offset;
+        }
+        else if ((offset >= reader->offset)
+          && (offset <= reader->offset + (int64_t) reader->end))
+        {
+                /* Still in the block buffer. */
+                reader->start = (size_t) (offset - reader->offset);
+        }
+        else
+        {
+#ifdef _WIN32
+                result = _fseeki64 (reader->fp, offset, SEEK_SET);
+#else
+                result = fseeko (reader->fp, (off_t) offset, SEEK_SET);
+#endif
+                if (result != 0)
+                {
+                        fprintf (stderr,
+                          (_("Error in %s () could not seek in: %s.\n")),
+                          __FUNCTION__, fp->filename);
+                        reader->error = TRUE;
+                        return (EXIT_FAILURE);
+                }
+                reader->offset = offset;
+                reader->start = 0;
+                reader->end = 0;
+                reader->eof = FALSE;
+                dxf_reader_reset_line_index (reader);
+        }
+        reader->pair_start = reader->start;
+        reader->pair_lines = 0;
+        reader->binary_pending = FALSE;
+        reader->error = FALSE;
+        fp->line_number = line_number;
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Read a group code from a \c DxfFile.
+ *
+ * The group code line is parsed once into an integer, so that entity
+ * readers can dispatch on it with a \c switch instead of comparing
+ * strings.\n
+ * The value belonging to the group code is left in the file and is
+ * read by one of the typed dxf_read_* functions.
+ *
+ * \return \c EXIT_SUCCESS when a group code was read, or
+ * \c EXIT_FAILURE at the end of the file or when an invalid group
+ * code was found.
+ */
+int
+dxf_read_group_code
+(
+        DxfFile *fp,
+                /*!< DXF file pointer to an input file (or device). */
+        int *group_code
+                /*!< Returns the group code. */
+)
+{
+        DxfReader *reader;
+        const char *line;
+        size_t length;
+        long long code;
+
+        if ((fp == NULL) || (fp->reader == NULL))
+        {
+                return (EXIT_FAILURE);
+        }
+        reader = fp->reader;
+        reader->pair_start = reader->start;
+        if (reader->binary)
+        {
+                if (dxf_reader_next_binary_record (fp) == EXIT_FAILURE)
+                {
+                        return (EXIT_FAILURE);
+                }
+                code = reader->binary_group_code;
+        }
+        else
+        {
+                if (dxf_reader_next_line (fp, &line, &length) == EXIT_FAILURE)
+                {
+                        return (EXIT_FAILURE);
+                }
+                if (dxf_reader_parse_long (line, length, 10, &code) == EXIT_FAILURE)
+                {
+                        fprintf (stderr,
+                          (_("Error in %s () invalid group code while reading from: %s in line: %d.\n")),
+                          __FUNCTION__, fp->filename, fp->line_number);
+                        reader->error = TRUE;
+                        return (EXIT_FAILURE);
+                }
+        }
+        reader->pair_lines = 1;
+        reader->group_code = (int) code;
+        *group_code = (int) code;
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Test for a read error on a \c DxfFile.
+ *
+ * \return \c TRUE when an error occurred, \c FALSE otherwise.
+ */
+int
+dxf_read_error
+(
+        DxfFile *fp
+                /*!< DXF file pointer to an input file (or device). */
+)
+{
+        if ((fp == NULL) || (fp->reader == NULL))
+        {
+                return (TRUE);
+        }
+        return (fp->reader->error);
+}
+
+
+/*!
+ * \brief Test for the end of a \c DxfFile.
+ *
+ * \return \c TRUE when all input was consumed, \c FALSE otherwise.
+ */
+int
+dxf_read_eof
+(
+        DxfFile *fp
+                /*!< DXF file pointer to an input file (or device). */
+)
+{
+        if ((fp == NULL) || (fp->reader == NULL))
+        {
+                return (TRUE);
+        }
+        if ((fp->reader->start < fp->reader->end)
+          || (fp->reader->binary_pending))
+        {
+                return (FALSE);
+        }
+        dxf_reader_fill (fp->reader);
+        return (fp->reader->start >= fp->reader->end);
+}
+
+
+/*!
+ * \brief Read a double value line from a \c DxfFile.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_read_double
+(
+        DxfFile *fp,
+                /*!< DXF file pointer to an input file (or device). */
+        double *value
+                /*!< Returns the value. */
+)
+{
+        const char *line;
+        size_t length;
+
+        if (dxf_reader_take_binary_number (fp, TRUE, value, NULL))
+        {
+                return (EXIT_SUCCESS);
+        }
+        if (dxf_reader_next_line (fp, &line, &length) == EXIT_FAILURE)
+        {
+                return (EXIT_FAILURE);
+        }
+        if (dxf_reader_parse_double (line, length, value) == EXIT_FAILURE)
+        {
+                fprintf (stderr,
+                  (_("Warning in %s () invalid value while reading from: %s in line: %d.\n")),
+                  __FUNCTION__, fp->filename, fp->line_number);
+                return (EXIT_FAILURE);
+        }
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Read a float value line from a \c DxfFile.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_read_float
+(
+        DxfFile *fp,
+                /*!< DXF file pointer to an input file (or device). */
+        float *value
+                /*!< Returns the value. */
+)
+{
+        double d;
+
+        if (dxf_read_double (fp, &d) == EXIT_FAILURE)
+        {
+                return (EXIT_FAILURE);
+        }
+        *value = (float) d;
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Read an integer value line (with number base \c base) from a
+ * \c DxfFile.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+static int
+dxf_read_integer
+(
+        DxfFile *fp,
+                /*!< DXF file pointer to an input file (or device). */
+        int base,
+                /*!< Number base, 10 or 16. */
+        long long *value
+                /*!< Returns the value. */
+)
+{
+        const char *line;
+        size_t length;
+
+        if (dxf_reader_take_binary_number (fp, FALSE, NULL, value))
+        {
+                return (EXIT_SUCCESS);
+        }
+        if (dxf_reader_next_line (fp, &line, &length) == EXIT_FAILURE)
+        {
+                return (EXIT_FAILURE);
+        }
+        if (dxf_reader_parse_long (line, length, base, value) == EXIT_FAILURE)
+        {
+                fprintf (stderr,
+                  (_("Warning in %s () invalid value while reading from: %s in line: %d.\n")),
+                  __FUNCTION__, fp->filename, fp->line_number);
+                return (EXIT_FAILURE);
+        }
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Read an int value line from a \c DxfFile.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_read_int
+(
+        DxfFile *fp,
+                /*!< DXF file pointer to an input file (or device). */
+        int *value
+                /*!< Returns the value. */
+)
+{
+        long long l;
+
+        if (dxf_read_integer (fp, 10, &l) == EXIT_FAILURE)
+        {
+                return (EXIT_FAILURE);
+        }
+        *value = (int) l;
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Read an int16_t value line from a \c DxfFile.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_read_int16
+(
+        DxfFile *fp,
+                /*!< DXF file pointer to an input file (or device). */
+        int16_t *value
+                /*!< Returns the value. */
+)
+{
+        long long l;
+
+        if (dxf_read_integer (fp, 10, &l) == EXIT_FAILURE)
+        {
+                return (EXIT_FAILURE);
+        }
+        *value = (int16_t) l;
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Read an int32_t value line from a \c DxfFile.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_read_int32
+(
+        DxfFile *fp,
+                /*!< DXF file pointer to an input file (or device). */
+        int32_t *value
+                /*!< Returns the value. */
+)
+{
+        long long l;
+
+        if (dxf_read_integer (fp, 10, &l) == EXIT_FAILURE)
+        {
+                return (EXIT_FAILURE);
+        }
+        *value = (int32_t) l;
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Read a long value line from a \c DxfFile.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_read_long
+(
+        DxfFile *fp,
+                /*!< DXF file pointer to an input file (or device). */
+        long *value
+                /*!< Returns the value. */
+)
+{
+        long long l;
+
+        if (dxf_read_integer (fp, 10, &l) == EXIT_FAILURE)
+        {
+                return (EXIT_FAILURE);
+        }
+        *value = (long) l;
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Read an int64_t value line from a \c DxfFile.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_read_int64
+(
+        DxfFile *fp,
+                /*!< DXF file pointer to an input file (or device). */
+        int64_t *value
+                /*!< Returns the value. */
+)
+{
+        long long l;
+
+        if (dxf_read_integer (fp, 10, &l) == EXIT_FAILURE)
+        {
+                return (EXIT_FAILURE);
+        }
+        *value = (int64_t) l;
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Read a hexadecimal value line from a \c DxfFile.
+ *
+ * Use dxf_read_handle () for id-codes and handles, which do not fit in
+ * an \c int.
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_read_hex
+(
+        DxfFile *fp,
+                /*!< DXF file pointer to an input file (or device). */
+        int *value
+                /*!< Returns the value. */
+)
+{
+        long long l;
+
+        if (dxf_read_integer (fp, 16, &l) == EXIT_FAILURE)
+        {
+                return (EXIT_FAILURE);
+        }
+        *value = (int) l;
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Read a handle (an id-code or a soft or hard pointer) from a
+ * \c DxfFile.
+ *
+ * The hexadecimal text is parsed once, a handle is kept as a 64 bit
+ * integer and only formatted again by dxf_write_hex ().
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_read_handle
+(
+        DxfFile *fp,
+                /*!< DXF file pointer to an input file (or device). */
+        uint64_t *value
+                /*!< Returns the handle. */
+)
+{
+        long long l;
+
+        if (dxf_read_integer (fp, 16, &l) == EXIT_FAILURE)
+        {
+                return (EXIT_FAILURE);
+        }
+        *value = (uint64_t) l;
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Read a string value line from a \c DxfFile.
+ *
+ * The previous contents of \c value is freed, a copy of the line is
+ * stored in \c value.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_read_string
+(
+        DxfFile *fp,
+                /*!< DXF file pointer to an input file (or device). */
+        char **value
+                /*!< Returns a newly allocated copy of the line. */
+)
+{
+        const char *line;
+        size_t length;
+        char *s;
+
+        if (dxf_reader_next_line (fp, &line, &length) == EXIT_FAILURE)
+        {
+                return (EXIT_FAILURE);
+        }
+        if ((s = dxf_malloc (length + 1)) == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () could not allocate memory.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        memcpy (s, line, length);
+        s[length] = '\0';
+        dxf_string_free (*value);
+        *value = s;
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Read a string value line from a \c DxfFile without copying
+ * it.
+ *
+ * The slice is \b not terminated with a '\\0'.\n
+ * For a file opened with dxf_read_init_mapped () the slice points into
+ * the memory map and stays valid until dxf_read_close () is called,
+ * otherwise it is only valid until the next read from \c fp.\n
+ * Use dxf_read_string_dup () to obtain an owned copy.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_read_string_view
+(
+        DxfFile *fp,
+                /*!< DXF file pointer to an input file (or device). */
+        const char **value,
+                /*!< Returns a pointer to the first char of the line. */
+        size_t *length
+                /*!< Returns the length of the line. */
+)
+{
+        return (dxf_reader_next_line (fp, value, length));
+}
+
+
+/*!
+ * \brief Make an owned, '\\0' terminated copy of a string slice.
+ *
+ * \return a pointer to the newly allocated string, or \c NULL when no
+ * memory was allocated.
+ */
+char *
+dxf_read_string_dup
+(
+        const char *value,
+                /*!< Pointer to the first char of the slice. */
+        size_t length
+                /*!< Length of the slice. */
+)
+{
+        char *s;
+
+        if ((s = dxf_malloc (length + 1)) == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () could not allocate memory.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        memcpy (s, value, length);
+        s[length] = '\0';
+        return (s);
+}
+
+
+/*!
+ * \brief Read a name or handle value line from a \c DxfFile into an
+ * interned string.
+ *
+ * When a string pool was set with dxf_read_set_string_pool () the
+ * value is interned in that pool, so every member read with the same
+ * contents shares one immutable copy owned by the pool, otherwise this
+ * behaves like dxf_read_string ().\n
+ * The previous contents of \c value are released with
+ * dxf_string_free ().
+ *
+ * \warning An interned string must not be modified or passed to
+ * free ().
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_read_string_interned
+(
+        DxfFile *fp,
+                /*!< DXF file pointer to an input file (or device). */
+        char **value
+                /*!< Returns the interned string. */
+)
+{
+        const char *line;
+        const char *s;
+        size_t length;
+
+        if (fp->string_pool == NULL)
+        {
+                return (dxf_read_string (fp, value));
+        }
+        if (dxf_reader_next_line (fp, &line, &length) == EXIT_FAILURE)
+        {
+                return (EXIT_FAILURE);
+        }
+        s = dxf_string_pool_intern (fp->string_pool, line, length);
+        if (s == NULL)
+        {
+                return (EXIT_FAILURE);
+        }
+        dxf_string_free (*value);
+        *value = (char *) s;
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Set the string pool used for interning names and handles
+ * read from a \c DxfFile.
+ *
+ * The pool is borrowed, usually from the \c DxfDrawing being read
+ * (see dxf_drawing_get_string_pool ()), and must outlive the entities
+ * read from \c fp.\n
+ * Pass \c NULL to stop interning.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_read_set_string_pool
+(
+        DxfFile *fp,
+                /*!< DXF file pointer to an input file (or device). */
+        DxfStringPool *pool
+                /*!< a pointer to a libDXF string pool, or \c NULL. */
+)
+{
+        /* Do some basic checks. */
+        if (fp == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL file pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        fp->string_pool = pool;
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Set the number of worker threads reading the \c ENTITIES
+ * section of a \c DxfFile.
+ *
+ * A memory mapped ASCII DXF file (see dxf_read_init_mapped ()) is
+ * split at entity boundaries into ranges of at least
+ * \c DXF_READER_CHUNK_SIZE bytes by dxf_entities_read_table (), which
+ * are read concurrently.\n
+ * The default is 1, reading in the calling thread only.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_read_set_number_threads
+(
+        DxfFile *fp,
+                /*!< DXF file pointer to an input file (or device). */
+        int number_threads
+                /*!< Number of worker threads, 0 for one per
+                 * processor. */
+)
+{
+        /* Do some basic checks. */
+        if (fp == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL file pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        if (number_threads < 0)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a negative number of threads was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        fp->number_threads = number_threads;
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Opens a DxfFile, does error checking and resets the line number
+ * counter.
+ * 
+ * Reset the line counting to 0.
+ *
+ * \todo add a test for invalid characters in \c filename.
+ * You may use any character in the current code page (Unicode/ANSI
+ * above 127), except:
+ * <ul>
+ * <li> < > : " / \ | ? * </li>
+ * <li> Characters whose integer representations are 0-31 (less than
+ *      ASCII space)</li>
+ * <li> Any other character that the target file system does not allow
+ *      (say, trailing periods or spaces)</li>
+ * <li> Any of the DOS names: CON, PRN, AUX, NUL, COM0, COM1, COM2,
+ *      COM3, COM4, COM5, COM6, COM7, COM8, COM9, LPT0, LPT1, LPT2,
+ *      LPT3, LPT4, LPT5, LPT6, LPT7, LPT8, LPT9 (and avoid AUX.txt,
+ *      etc)</li>
+ * <li> The file name is all periods</li>
+ * <li> File paths (including the file name) may not have more than 260
+ *      characters (that don't use the \?\ prefix)</li>
+ * <li> Unicode file paths (including the file name) with more than
+ *      32,000 characters when using \?\ (note that prefix may expand
+ *      directory components and cause it to overflow the 32,000 limit)</li>
+ * </ul>
+ */
+DxfFile *
+dxf_read_init
+(
+        const char *filename
+                /*!< Filename. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfFile * file = NULL;
+        FILE *fp;
+        if (!filename)
+        {
+                fprintf (stderr,
+                  (_("Error: filename is not initialised (NULL pointer).\n")));
+                return (NULL);
+        }
+        if (strcmp (filename, "") == 0)
+        {
+                fprintf (stderr,
+                  (_("Error: filename contains an empty string.\n")));
+                return (NULL);
+        }
+        fp = fopen (filename, "rb");
+        if (!fp)
+        {
+                fprintf (stderr,
+                  (_("Error: could not open file: %s for reading (NULL pointer).\n")),
+                  filename);
+                return (NULL);
+        }
+        file = malloc (sizeof(DxfFile));
+        if (file == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () could not allocate memory.\n")),
+                  __FUNCTION__);
+                fclose (fp);
+                return (NULL);
+        }
+        memset (file, 0, sizeof (DxfFile));
+        file->fp = fp;
+        file->reader = dxf_reader_new (fp);
+        if (file->reader == NULL)
+        {
+                fclose (fp);
+                free (file);
+                return (NULL);
+        }
+        file->filename = strdup(filename);
+        file->line_number = 0;
+        file->number_threads = 1;
+        dxf_reader_detect_binary (file);
+        /*! \todo do dxf header and blocks need initialized ?
+         * dxf_header_init (file->dxf_header);
+         * dxf_block_init (file->dxf_block);
+         */
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return file;
+}
+
+
+/*!
+ * \brief Opens a DxfFile by memory mapping the whole file.
+ *
+ * The reader walks the mapping in place, no block buffer is allocated
+ * and no data is copied through stdio.\n
+ * String values obtained with dxf_read_string_view () point into the
+ * mapping and stay valid until dxf_read_close () is called.\n
+ * When the platform has no \c mmap (), or the file can not be mapped
+ * (for instance an empty file or a pipe), the file is opened with
+ * dxf_read_init () instead.
+ *
+ * \return a pointer to the \c DxfFile, or \c NULL when the file could
+ * not be opened.
+ */
+DxfFile *
+dxf_read_init_mapped
+(
+        const char *filename
+                /*!< Filename. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+#ifndef _WIN32
+        DxfFile *file = NULL;
+        DxfMapping *mapping;
+        struct stat st;
+        void *map;
+        int fd;
+
+        if ((filename == NULL) || (strcmp (filename, "") == 0))
+        {
+                return (dxf_read_init (filename));
+        }
+        fd = open (filename, O_RDONLY);
+        if (fd < 0)
+        {
+                return (dxf_read_init (filename));
+        }
+        if ((fstat (fd, &st) != 0)
+          || (!S_ISREG (st.st_mode))
+          || (st.st_size == 0))
+        {
+                close (fd);
+                return (dxf_read_init (filename));
+        }
+        map = mmap (NULL, (size_t) st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+        /* The mapping holds a reference to the file. */
+        close (fd);
+        if (map == MAP_FAILED)
+        {
+                return (dxf_read_init (filename));
+        }
+#ifdef MADV_SEQUENTIAL
+        madvise (map, (size_t) st.st_size, MADV_SEQUENTIAL);
+#endif
+        mapping = malloc (sizeof (DxfMapping));
+        if (mapping == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () could not allocate memory.\n")),
+                  __FUNCTION__);
+                munmap (map, (size_t) st.st_size);
+                return (NULL);
+        }
+        mapping->address = map;
+        mapping->size = (size_t) st.st_size;
+        mapping->references = 1;
+        file = malloc (sizeof (DxfFile));
+        if (file == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () could not allocate memory.\n")),
+                  __FUNCTION__);
+                dxf_mapping_release (mapping);
+                return (NULL);
+        }
+        memset (file, 0, sizeof (DxfFile));
+        file->reader = malloc (sizeof (DxfReader));
+        if (file->reader == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () could not allocate memory.\n")),
+                  __FUNCTION__);
+                dxf_mapping_release (mapping);
+                free (file);
+                return (NULL);
+        }
+        memset (file->reader, 0, sizeof (DxfReader));
+        file->reader->mapping = mapping;
+        file->reader->buffer = (char *) map;
+        file->reader->size = (size_t) st.st_size;
+        file->reader->end = (size_t) st.st_size;
+        file->reader->eof = TRUE;
+        file->reader->mapped = TRUE;
+        file->fp = NULL;
+        file->filename = strdup (filename);
+        file->line_number = 0;
+        file->number_threads = 1;
+        dxf_reader_detect_binary (file);
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (file);
+#else
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (dxf_read_init (filename));
+#endif
+}
+
+
+void
+dxf_read_close
+(
+        DxfFile *file
+                /*!< DXF file pointer to an output file (or device). */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        if (file == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error: file is not initialised (NULL pointer).\n")));
+        }
+        else
+        {
+                dxf_reader_free (file->reader);
+                if (file->fp != NULL)
+                {
+                        fclose (file->fp);
+                }
+                free (file->filename);
+                /*! \todo free other sub structures */
+                free (file);
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+}
+
+
+/*!
+ * \brief Opens a DxfFile for writing ASCII DXF.
+ *
+ * Output is collected by a \c DxfWriter, so the file has to be
+ * closed with dxf_write_close ().
+ *
+ * \return a pointer to the \c DxfFile, or \c NULL when the file could
+ * not be opened.
+ */
+DxfFile *
+dxf_write_init
+(
+        const char *filename
+                /*!< Filename. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfFile *file = NULL;
+        FILE *fp;
+
+        if ((filename == NULL) || (strcmp (filename, "") == 0))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer or an empty filename was passed.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        fp = fopen (filename, "w");
+        if (fp == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error: could not open file: %s for writing (NULL pointer).\n")),
+                  filename);
+                return (NULL);
+        }
+        file = malloc (sizeof (DxfFile));
+        if (file == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () could not allocate memory.\n")),
+                  __FUNCTION__);
+                fclose (fp);
+                return (NULL);
+        }
+        memset (file, 0, sizeof (DxfFile));
+        file->fp = fp;
+        file->writer = dxf_writer_new (fp);
+        if (file->writer == NULL)
+        {
+                fclose (fp);
+                free (file);
+                return (NULL);
+        }
+        file->filename = strdup (filename);
+        file->line_number = 0;
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (file);
+}
+
+
+/*!
+ * \brief Opens a DxfFile for writing binary DXF.
+ *
+ * The binary sentinel is written, after which the writers of libDXF
+ * produce binary records directly: with 1 byte group codes when the
+ * \c acad_version_number of the file is below DXF R13, with 2 byte
+ * group codes otherwise.\n
+ * The file has to be closed with dxf_write_close ().
+ *
+ * \return a pointer to the \c DxfFile, or \c NULL when the file could
+ * not be opened.
+ */
+DxfFile *
+dxf_write_init_binary
+(
+        const char *filename
+                /*!< Filename. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfFile *file = NULL;
+
+        if ((file = dxf_write_init (filename)) == NULL)
+        {
+                return (NULL);
+        }
+        /* Reopen in binary mode. */
+        fclose (file->fp);
+        file->fp = fopen (filename, "wb");
+        if ((file->fp == NULL)
+          || (fwrite (DXF_BINARY_SENTINEL, 1, DXF_BINARY_SENTINEL_LENGTH,
+          file->fp) != DXF_BINARY_SENTINEL_LENGTH))
+        {
+                fprintf (stderr,
+                  (_("Error: could not open file: %s for writing (NULL pointer).\n")),
+                  filename);
+                if (file->fp != NULL)
+                {
+                        fclose (file->fp);
+                }
+                dxf_writer_free (file->writer);
+                free (file->filename);
+                free (file);
+                return (NULL);
+        }
+        file->writer->fp = file->fp;
+        file->writer->binary = TRUE;
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (file);
+}
+
+
+/*!
+ * \brief Opens a DxfFile collecting it's output in memory.
+ *
+ * The output takes the DXF version, strictness and encoding (ASCII or
+ * binary) of \c fp, and is copied to \c fp with dxf_write_append ().\n
+ * Buffers of several sections can be written concurrently, each by
+ * it's own thread.\n
+ * The buffer has to be closed with dxf_write_close ().
+ *
+ * \return a pointer to the \c DxfFile, or \c NULL when no memory
+ * was allocated.
+ */
+DxfFile *
+dxf_write_init_buffer
+(
+        DxfFile *fp
+                /*!< DXF file pointer to the output file (or device)
+                 * the buffer is meant for. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfFile *file = NULL;
+
+        if (fp == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL file pointer was passed.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        file = malloc (sizeof (DxfFile));
+        if (file == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () could not allocate memory.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        memset (file, 0, sizeof (DxfFile));
+        file->writer = dxf_writer_new (NULL);
+        if (file->writer == NULL)
+        {
+                free (file);
+                return (NULL);
+        }
+        if (fp->filename != NULL)
+        {
+                file->filename = strdup (fp->filename);
+        }
+        file->writer->binary = ((fp->writer != NULL) && fp->writer->binary);
+        file->acad_version_number = fp->acad_version_number;
+        file->follow_strict_version_rules = fp->follow_strict_version_rules;
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (file);
+}
+
+
+/*!
+ * \brief Append the output collected by a DxfFile opened with
+ * dxf_write_init_buffer () to a DxfFile.
+ *
+ * The contents of \c buffer are consumed, more output can be written
+ * to it afterwards.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_write_append
+(
+        DxfFile *fp,
+                /*!< DXF file pointer to an output file (or device). */
+        DxfFile *buffer
+                /*!< DXF file pointer to a buffer. */
+)
+{
+        DxfWriter *source;
+        DxfWriter *writer;
+
+        if ((fp == NULL) || (buffer == NULL) || (buffer->writer == NULL))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL file pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        source = buffer->writer;
+        if (source->error)
+        {
+                return (EXIT_FAILURE);
+        }
+        writer = fp->writer;
+        if (writer == NULL)
+        {
+                if (fwrite (source->buffer, 1, source->used, fp->fp) != source->used)
+                {
+                        return (EXIT_FAILURE);
+                }
+        }
+        else if (dxf_writer_reserve (writer, source->used))
+        {
+                memcpy (writer->buffer + writer->used, source->buffer, source->used);
+                writer->used += source->used;
+        }
+        else if ((writer->fp == NULL)
+          || (fwrite (source->buffer, 1, source->used, writer->fp) != source->used))
+        {
+                writer->error = TRUE;
+        }
+        source->used = 0;
+        return (((writer != NULL) && writer->error) ? EXIT_FAILURE : EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Closes a DxfFile opened with dxf_write_init (),
+ * dxf_write_init_binary () or dxf_write_init_buffer ().
+ *
+ * The output still held by the \c DxfWriter is flushed first.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_write_close
+(
+        DxfFile *file
+                /*!< DXF file pointer to an output file (or device). */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        int result = EXIT_SUCCESS;
+
+        if (file == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL file pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        if (dxf_writer_free (file->writer) == EXIT_FAILURE)
+        {
+                result = EXIT_FAILURE;
+        }
+        file->writer = NULL;
+        if ((file->fp != NULL)
+          && (fclose (file->fp) != 0))
+        {
+                result = EXIT_FAILURE;
+        }
+        free (file->filename);
+        free (file);
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (result);
+}
+
+
+/*!
+ * \brief Reads a line from a file.
+ * 
+ * Reads the next line from \c fp file and stores it into the temp_string.
+ *
+ * Leading and trailing white space is stripped, the line is truncated
+ * to \c DXF_MAX_STRING_LENGTH - 1 chars.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE at the end of
+ * the file or when an error occurred.
+ */
+int
+dxf_read_line (char * temp_string, DxfFile *fp)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        const char *line;
+        size_t length;
+
+        if (dxf_reader_next_line (fp, &line, &length) == EXIT_FAILURE)
+        {
+                if (dxf_read_error (fp))
+                {
+                        fprintf (stderr,
+                          (_("Error: while reading from: %s in line: %d.\n")),
+                          fp->filename, fp->line_number);
+                }
+                temp_string[0] = '\0';
+                /* Return failure on EOF or error. */
+                return (EXIT_FAILURE);
+        }
+        while ((length > 0) && isspace ((unsigned char) *line))
+        {
+                line++;
+                length--;
+        }
+        while ((length > 0) && isspace ((unsigned char) line[length - 1]))
+        {
+                length--;
+        }
+        if (length >= DXF_MAX_STRING_LENGTH)
+        {
+                length = DXF_MAX_STRING_LENGTH - 1;
+        }
+        memcpy (temp_string, line, length);
+        temp_string[length] = '\0';
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (EXIT_SUCCESS);
+}
+
+/*!
+ * \brief Uses of fscanf with other features.
+ * 
+ * Uses sscanf for parsing as many lines as there are "\n" in the
+ * template, and tracks the lines it reads.
+ * 
+ */
+int
+dxf_read_scanf (DxfFile *fp, const char *template, ...)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        int ret;
+        int lines;
+        const char *line;
+        size_t length;
+        size_t used;
+        char temp_string[DXF_MAX_STRING_LENGTH];
+        const char *search_result;
+        va_list lst;
+
+        /* We have to find each \n from the template to know how many
+         * lines we will read. */
+        lines = 0;
+        search_result = template;
+        while ((search_result = strchr (search_result, '\n')) != NULL)
+        {
+                lines++;
+                search_result++;
+        }
+        used = 0;
+        while (lines-- > 0)
+        {
+                if (dxf_reader_next_line (fp, &line, &length) == EXIT_FAILURE)
+                {
+                        break;
+                }
+                if (used + length + 2 > sizeof (temp_string))
+                {
+                        length = sizeof (temp_string) - used - 2;
+                }
+                memcpy (temp_string + used, line, length);
+                used += length;
+                temp_string[used++] = '\n';
+        }
+        temp_string[used] = '\0';
+        if (dxf_read_error (fp))
+        {
+                fprintf (stderr,
+                  (_("Error: while reading from: %s in line: %d.\n")),
+                  fp->filename, fp->line_number);
+                return (EXIT_FAILURE);
+        }
+        va_start (lst, template);
+        ret = vsscanf (temp_string, template, lst);
+        va_end (lst);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -40,6 +40,7 @@
 
 #include "global.h"
 #include "file.h"
+#include "string_pool.h"
 
 
 #ifdef __cplusplus
@@ -118,16 +119,64 @@ DxfInt64 *dxf_int64_set_value (DxfInt64 *i, int64_t value);
 DxfInt64 *dxf_int64_get_next (DxfInt64 *i);
 DxfInt64 *dxf_int64_set_next (DxfInt64 *i, DxfInt64 *next);
 DxfInt64 *dxf_int64_get_last (DxfInt64 *i);
+int dxf_int64_free (DxfInt64 *i);
+int dxf_int64_free_list (DxfInt64 *ints);
 int dxf_read_is_double (int type);
 int dxf_read_is_int (int type);
 int dxf_read_is_int16_t (int type);
 int dxf_read_is_int32_t (int type);
 int dxf_read_is_int64_t (int type);
 int dxf_read_is_string (int type);
+DxfReader *dxf_reader_new (FILE *fp);
+void dxf_reader_free (DxfReader *reader);
+DxfMapping *dxf_mapping_retain (DxfMapping *mapping);
+void dxf_mapping_release (DxfMapping *mapping);
+int dxf_reader_next_line (DxfFile *fp, const char **line, size_t *length);
+size_t dxf_reader_index_lines (const char *buffer, size_t start, size_t end, size_t *offsets, size_t max_offsets, size_t *scanned);
+int dxf_reader_parse_long (const char *s, size_t length, int base, long long *value);
+int dxf_reader_parse_double (const char *s, size_t length, double *value);
+size_t dxf_reader_decode_hex (const char *s, size_t length, uint8_t *bytes);
+int dxf_format_double (char *s, double value);
+DxfWriter *dxf_writer_new (FILE *fp);
+int dxf_writer_flush (DxfWriter *writer);
+int dxf_writer_free (DxfWriter *writer);
+int dxf_write_string (DxfFile *fp, int group_code, const char *value);
+int dxf_write_slice (DxfFile *fp, int group_code, const char *value, size_t length);
+int dxf_write_int (DxfFile *fp, int group_code, int64_t value);
+int dxf_write_hex (DxfFile *fp, int group_code, uint64_t value);
+int dxf_write_double (DxfFile *fp, int group_code, double value);
+int dxf_reader_next_pair (DxfFile *fp, int *group_code, const char **value, size_t *length);
+void dxf_reader_push_back (DxfFile *fp);
+int dxf_read_group_code (DxfFile *fp, int *group_code);
+int64_t dxf_read_tell (DxfFile *fp);
+int dxf_read_seek (DxfFile *fp, int64_t offset, int line_number);
+int dxf_read_error (DxfFile *fp);
+int dxf_read_eof (DxfFile *fp);
+int dxf_read_double (DxfFile *fp, double *value);
+int dxf_read_float (DxfFile *fp, float *value);
+int dxf_read_int (DxfFile *fp, int *value);
+int dxf_read_int16 (DxfFile *fp, int16_t *value);
+int dxf_read_int32 (DxfFile *fp, int32_t *value);
+int dxf_read_int64 (DxfFile *fp, int64_t *value);
+int dxf_read_long (DxfFile *fp, long *value);
+int dxf_read_hex (DxfFile *fp, int *value);
+int dxf_read_handle (DxfFile *fp, uint64_t *value);
+int dxf_read_string (DxfFile *fp, char **value);
+int dxf_read_string_view (DxfFile *fp, const char **value, size_t *length);
+char *dxf_read_string_dup (const char *value, size_t length);
+int dxf_read_string_interned (DxfFile *fp, char **value);
+int dxf_read_set_string_pool (DxfFile *fp, DxfStringPool *pool);
+int dxf_read_set_number_threads (DxfFile *fp, int number_threads);
 int dxf_read_line (char * temp_string, DxfFile *fp);
 int dxf_read_scanf (DxfFile *fp, const char *template, ...);
 DxfFile *dxf_read_init (const char *filename);
+DxfFile *dxf_read_init_mapped (const char *filename);
 void dxf_read_close (DxfFile *file);
+DxfFile *dxf_write_init (const char *filename);
+DxfFile *dxf_write_init_binary (const char *filename);
+DxfFile *dxf_write_init_buffer (DxfFile *fp);
+int dxf_write_append (DxfFile *fp, DxfFile *buffer);
+int dxf_write_close (DxfFile *file);
 
 
 #ifdef __cplusplus
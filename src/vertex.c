@@ -42,6 +42,7 @@
 
 
 #include "vertex.h"
+#include "util.h"
 
 
 /*!
@@ -61,7 +62,7 @@ dxf_vertex_new ()
         size = sizeof (DxfVertex);
         /* avoid malloc of 0 bytes */
         if (size == 0) size = 1;
-        if ((vertex = malloc (size)) == NULL)
+        if ((vertex = dxf_malloc (size)) == NULL)
         {
                 fprintf (stderr,
                   (_("Error in %s () could not allocate memory for a DxfVertex struct.\n")),
@@ -110,9 +111,9 @@ dxf_vertex_init
                 __FUNCTION__);
               return (NULL);
         }
-        vertex->id_code = 0;
-        vertex->linetype = strdup (DXF_DEFAULT_LINETYPE);
-        vertex->layer = strdup (DXF_DEFAULT_LAYER);
+        vertex->id_code = DXF_HANDLE_NONE;
+        vertex->linetype = dxf_strdup (DXF_DEFAULT_LINETYPE);
+        vertex->layer = dxf_strdup (DXF_DEFAULT_LAYER);
         vertex->elevation = 0.0;
         vertex->thickness = 0.0;
         vertex->linetype_scale = DXF_DEFAULT_LINETYPE_SCALE;
@@ -123,19 +124,17 @@ dxf_vertex_init
         vertex->shadow_mode = 0;
         vertex->binary_graphics_data = (DxfBinaryGraphicsData *) dxf_binary_graphics_data_new ();
         vertex->binary_graphics_data = (DxfBinaryGraphicsData *) dxf_binary_graphics_data_init ((DxfBinaryGraphicsData *) vertex->binary_graphics_data);
-        vertex->dictionary_owner_soft = strdup ("");
-        vertex->material = strdup ("");
-        vertex->dictionary_owner_hard = strdup ("");
+        vertex->dictionary_owner_soft = 0;
+        vertex->material = 0;
+        vertex->dictionary_owner_hard = 0;
         vertex->lineweight = 0;
-        vertex->plot_style_name = strdup ("");
+        vertex->plot_style_name = 0;
         vertex->color_value = 0;
-        vertex->color_name = strdup ("");
+        vertex->color_name = dxf_strdup ("");
         vertex->transparency = 0;
-        vertex->p0 = (DxfPoint *) dxf_point_new ();
-        vertex->p0 = dxf_point_init ((DxfPoint *) vertex->p0);
-        vertex->p0->x0 = 0.0;
-        vertex->p0->y0 = 0.0;
-        vertex->p0->z0 = 0.0;
+        vertex->p0.x = 0.0;
+        vertex->p0.y = 0.0;
+        vertex->p0.z = 0.0;
         vertex->start_width = 0.0;
         vertex->end_width = 0.0;
         vertex->bulge = 0.0;
@@ -176,7 +175,8 @@ dxf_vertex_read
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        char *temp_string = NULL;
+        char temp_string[DXF_MAX_STRING_LENGTH];
+        int group_code;
 
         /* Do some basic checks. */
         if (fp == NULL)
@@ -184,8 +184,6 @@ dxf_vertex_read
                 fprintf (stderr,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
-                /* Clean up. */
-                free (temp_string);
                 return (NULL);
         }
         if (vertex == NULL)
@@ -195,295 +193,242 @@ dxf_vertex_read
                   __FUNCTION__);
                 vertex = dxf_vertex_init (vertex);
         }
-        (fp->line_number)++;
-        fscanf (fp->fp, "%[^\n]", temp_string);
-        while (strcmp (temp_string, "0") != 0)
+        while ((dxf_read_group_code (fp, &group_code) == EXIT_SUCCESS)
+          && (group_code != 0))
         {
-                if (ferror (fp->fp))
+                if (dxf_read_error (fp))
                 {
                         fprintf (stderr,
                           (_("Error in %s () while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
-                        fclose (fp->fp);
-                        /* Clean up. */
-                        free (temp_string);
                         return (NULL);
                 }
-                if (strcmp (temp_string, "5") == 0)
-                {
-                        /* Now follows a string containing a sequential
-                         * id number. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%x\n", (uint *) &vertex->id_code);
-                }
-                else if (strcmp (temp_string, "6") == 0)
-                {
-                        /* Now follows a string containing a linetype
-                         * name. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, vertex->linetype);
-                }
-                else if (strcmp (temp_string, "8") == 0)
-                {
-                        /* Now follows a string containing a layer name. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, vertex->layer);
-                }
-                else if (strcmp (temp_string, "10") == 0)
-                {
-                        /* Now follows a string containing the
-                         * X-coordinate of the point. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &vertex->p0->x0);
-                }
-                else if (strcmp (temp_string, "20") == 0)
-                {
-                        /* Now follows a string containing the
-                         * Y-coordinate of the point. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &vertex->p0->y0);
-                }
-                else if (strcmp (temp_string, "30") == 0)
-                {
-                        /* Now follows a string containing the
-                         * Z-coordinate of the point. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &vertex->p0->z0);
-                }
-                else if ((fp->acad_version_number <= AutoCAD_11)
-                        && (strcmp (temp_string, "38") == 0)
-                        && (vertex->elevation != 0.0))
-                {
-                        /* Now follows a string containing the
-                         * elevation. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &vertex->elevation);
-                }
-                else if (strcmp (temp_string, "39") == 0)
-                {
-                        /* Now follows a string containing the
-                         * thickness. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &vertex->thickness);
-                }
-                else if (strcmp (temp_string, "40") == 0)
-                {
-                        /* Now follows a string containing the
-                         * start width. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &vertex->start_width);
-                }
-                else if (strcmp (temp_string, "41") == 0)
-                {
-                        /* Now follows a string containing the
-                         * end width. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &vertex->end_width);
-                }
-                else if (strcmp (temp_string, "42") == 0)
+                switch (group_code)
                 {
-                        /* Now follows a string containing the
-                         * bulge. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &vertex->bulge);
-                }
-                else if (strcmp (temp_string, "48") == 0)
-                {
-                        /* Now follows a string containing the linetype
-                         * scale. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &vertex->linetype_scale);
-                }
-                else if (strcmp (temp_string, "50") == 0)
-                {
-                        /* Now follows a string containing the
-                         * curve fitting tangent. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &vertex->curve_fit_tangent_direction);
-                }
-                else if (strcmp (temp_string, "60") == 0)
-                {
-                        /* Now follows a string containing the
-                         * visibility value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%hd\n", &vertex->visibility);
-                }
-                else if (strcmp (temp_string, "62") == 0)
-                {
-                        /* Now follows a string containing the
-                         * color value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%d\n", &vertex->color);
-                }
-                else if (strcmp (temp_string, "67") == 0)
-                {
-                        /* Now follows a string containing the
-                         * paperspace value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%d\n", &vertex->paperspace);
-                }
-                else if (strcmp (temp_string, "70") == 0)
-                {
-                        /* Now follows a string containing the flag
-                         * value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%d\n", &vertex->flag);
-                }
-                else if (strcmp (temp_string, "71") == 0)
-                {
-                        /* Now follows a string containing the Polyface
-                         * mesh vertex index value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%d\n", &vertex->polyface_mesh_vertex_index_1);
-                }
-                else if (strcmp (temp_string, "72") == 0)
-                {
-                        /* Now follows a string containing the Polyface
-                         * mesh vertex index value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%d\n", &vertex->polyface_mesh_vertex_index_2);
-                }
-                else if (strcmp (temp_string, "73") == 0)
-                {
-                        /* Now follows a string containing the Polyface
-                         * mesh vertex index value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%d\n", &vertex->polyface_mesh_vertex_index_3);
-                }
-                else if (strcmp (temp_string, "74") == 0)
-                {
-                        /* Now follows a string containing the Polyface
-                         * mesh vertex index value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%d\n", &vertex->polyface_mesh_vertex_index_4);
-                }
-                else if (strcmp (temp_string, "92") == 0)
-                {
-                        /* Now follows a string containing the
-                         * graphics data size value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%d\n", &vertex->graphics_data_size);
-                }
-                else if ((fp->acad_version_number >= AutoCAD_13)
-                        && (strcmp (temp_string, "100") == 0))
-                {
-                        /* Now follows a string containing the
-                         * subclass marker value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
-                        if ((strcmp (temp_string, "AcDbEntity") != 0)
-                        && (strcmp (temp_string, "AcDbVertex") != 0)
-                        && (strcmp (temp_string, "AcDb2dVertex") != 0)
-                        && (strcmp (temp_string, "AcDb3dPolylineVertex") != 0))
-                        {
+                        case 5:
+                                /* Now follows a string containing a sequential
+                                 * id number. */
+                                dxf_read_handle (fp, &vertex->id_code);
+                                break;
+                        case 6:
+                                /* Now follows a string containing a linetype
+                                 * name. */
+                                dxf_read_string_interned (fp, &vertex->linetype);
+                                break;
+                        case 8:
+                                /* Now follows a string containing a layer name. */
+                                dxf_read_string_interned (fp, &vertex->layer);
+                                break;
+                        case 10:
+                                /* Now follows a string containing the
+                                 * X-coordinate of the point. */
+                                dxf_read_double (fp, &vertex->p0.x);
+                                break;
+                        case 20:
+                                /* Now follows a string containing the
+                                 * Y-coordinate of the point. */
+                                dxf_read_double (fp, &vertex->p0.y);
+                                break;
+                        case 30:
+                                /* Now follows a string containing the
+                                 * Z-coordinate of the point. */
+                                dxf_read_double (fp, &vertex->p0.z);
+                                break;
+                        case 38:
+                                if ((fp->acad_version_number <= AutoCAD_11) && (vertex->elevation != 0.0))
+                                {
+                                        /* Now follows a string containing the
+                                         * elevation. */
+                                        dxf_read_double (fp, &vertex->elevation);
+                                }
+                                else
+                                {
+                                        fprintf (stderr,
+                                          (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
+                                          __FUNCTION__, fp->filename, fp->line_number);
+                                        /* Skip the value of the unknown group code. */
+                                        dxf_read_line (temp_string, fp);
+                                }
+                                break;
+                        case 39:
+                                /* Now follows a string containing the
+                                 * thickness. */
+                                dxf_read_double (fp, &vertex->thickness);
+                                break;
+                        case 40:
+                                /* Now follows a string containing the
+                                 * start width. */
+                                dxf_read_double (fp, &vertex->start_width);
+                                break;
+                        case 41:
+                                /* Now follows a string containing the
+                                 * end width. */
+                                dxf_read_double (fp, &vertex->end_width);
+                                break;
+                        case 42:
+                                /* Now follows a string containing the
+                                 * bulge. */
+                                dxf_read_double (fp, &vertex->bulge);
+                                break;
+                        case 48:
+                                /* Now follows a string containing the linetype
+                                 * scale. */
+                                dxf_read_double (fp, &vertex->linetype_scale);
+                                break;
+                        case 50:
+                                /* Now follows a string containing the
+                                 * curve fitting tangent. */
+                                dxf_read_double (fp, &vertex->curve_fit_tangent_direction);
+                                break;
+                        case 60:
+                                /* Now follows a string containing the
+                                 * visibility value. */
+                                dxf_read_int16 (fp, &vertex->visibility);
+                                break;
+                        case 62:
+                                /* Now follows a string containing the
+                                 * color value. */
+                                dxf_read_int (fp, &vertex->color);
+                                break;
+                        case 67:
+                                /* Now follows a string containing the
+                                 * paperspace value. */
+                                dxf_read_int (fp, &vertex->paperspace);
+                                break;
+                        case 70:
+                                /* Now follows a string containing the flag
+                                 * value. */
+                                dxf_read_int (fp, &vertex->flag);
+                                break;
+                        case 71:
+                                /* Now follows a string containing the Polyface
+                                 * mesh vertex index value. */
+                                dxf_read_int (fp, &vertex->polyface_mesh_vertex_index_1);
+                                break;
+                        case 72:
+                                /* Now follows a string containing the Polyface
+                                 * mesh vertex index value. */
+                                dxf_read_int (fp, &vertex->polyface_mesh_vertex_index_2);
+                                break;
+                        case 73:
+                                /* Now follows a string containing the Polyface
+                                 * mesh vertex index value. */
+                                dxf_read_int (fp, &vertex->polyface_mesh_vertex_index_3);
+                                break;
+                        case 74:
+                                /* Now follows a string containing the Polyface
+                                 * mesh vertex index value. */
+                                dxf_read_int (fp, &vertex->polyface_mesh_vertex_index_4);
+                                break;
+                        case 92:
+                                /* Now follows a string containing the
+                                 * graphics data size value. */
+                                dxf_read_int (fp, &vertex->graphics_data_size);
+                                break;
+                        case 100:
+                                if (fp->acad_version_number >= AutoCAD_13)
+                                {
+                                        /* Now follows a string containing the
+                                         * subclass marker value. */
+                                        dxf_read_line (temp_string, fp);
+                                        if ((strcmp (temp_string, "AcDbEntity") != 0)
+                                        && (strcmp (temp_string, "AcDbVertex") != 0)
+                                        && (strcmp (temp_string, "AcDb2dVertex") != 0)
+                                        && (strcmp (temp_string, "AcDb3dPolylineVertex") != 0))
+                                        {
+                                                fprintf (stderr,
+                                                  (_("Warning in %s () found a bad subclass marker in: %s in line: %d.\n")),
+                                                  __FUNCTION__, fp->filename, fp->line_number);
+                                        }
+                                }
+                                else
+                                {
+                                        fprintf (stderr,
+                                          (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
+                                          __FUNCTION__, fp->filename, fp->line_number);
+                                        /* Skip the value of the unknown group code. */
+                                        dxf_read_line (temp_string, fp);
+                                }
+                                break;
+                        case 160:
+                                /* Now follows a string containing the
+                                 * graphics data size value. */
+                                dxf_read_int (fp, &vertex->graphics_data_size);
+                                break;
+                        case 284:
+                                /* Now follows a string containing the shadow
+                                 * mode value. */
+                                dxf_read_int16 (fp, &vertex->shadow_mode);
+                                break;
+                        case 310:
+                                /* Now follows a string containing binary
+                                 * graphics data. */
+                                dxf_read_string (fp, &vertex->binary_graphics_data->data_line);
+                                dxf_binary_graphics_data_init ((DxfBinaryGraphicsData *) vertex->binary_graphics_data->next);
+                                vertex->binary_graphics_data = (DxfBinaryGraphicsData *) vertex->binary_graphics_data->next;
+                                break;
+                        case 330:
+                                /* Now follows a string containing Soft-pointer
+                                 * ID/handle to owner dictionary. */
+                                dxf_read_handle (fp, &vertex->dictionary_owner_soft);
+                                break;
+                        case 347:
+                                /* Now follows a string containing a
+                                 * hard-pointer ID/handle to material object. */
+                                dxf_read_handle (fp, &vertex->material);
+                                break;
+                        case 360:
+                                /* Now follows a string containing Hard owner
+                                 * ID/handle to owner dictionary. */
+                                dxf_read_handle (fp, &vertex->dictionary_owner_hard);
+                                break;
+                        case 370:
+                                /* Now follows a string containing the lineweight
+                                 * value. */
+                                dxf_read_int16 (fp, &vertex->lineweight);
+                                break;
+                        case 390:
+                                /* Now follows a string containing a plot style
+                                 * name value. */
+                                dxf_read_handle (fp, &vertex->plot_style_name);
+                                break;
+                        case 420:
+                                /* Now follows a string containing a color value. */
+                                dxf_read_long (fp, &vertex->color_value);
+                                break;
+                        case 430:
+                                /* Now follows a string containing a color
+                                 * name value. */
+                                dxf_read_string_interned (fp, &vertex->color_name);
+                                break;
+                        case 440:
+                                /* Now follows a string containing a transparency
+                                 * value. */
+                                dxf_read_long (fp, &vertex->transparency);
+                                break;
+                        case 999:
+                                /* Now follows a string containing a comment. */
+                                dxf_read_line (temp_string, fp);
+                                fprintf (stdout, "DXF comment: %s\n", temp_string);
+                                break;
+                        default:
                                 fprintf (stderr,
-                                  (_("Warning in %s () found a bad subclass marker in: %s in line: %d.\n")),
+                                  (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
                                   __FUNCTION__, fp->filename, fp->line_number);
-                        }
-                }
-                else if (strcmp (temp_string, "160") == 0)
-                {
-                        /* Now follows a string containing the
-                         * graphics data size value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%d\n", &vertex->graphics_data_size);
-                }
-                else if (strcmp (temp_string, "284") == 0)
-                {
-                        /* Now follows a string containing the shadow
-                         * mode value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%hd\n", &vertex->shadow_mode);
-                }
-                else if (strcmp (temp_string, "310") == 0)
-                {
-                        /* Now follows a string containing binary
-                         * graphics data. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, vertex->binary_graphics_data->data_line);
-                        dxf_binary_graphics_data_init ((DxfBinaryGraphicsData *) vertex->binary_graphics_data->next);
-                        vertex->binary_graphics_data = (DxfBinaryGraphicsData *) vertex->binary_graphics_data->next;
-                }
-                else if (strcmp (temp_string, "330") == 0)
-                {
-                        /* Now follows a string containing Soft-pointer
-                         * ID/handle to owner dictionary. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, vertex->dictionary_owner_soft);
-                }
-                else if (strcmp (temp_string, "347") == 0)
-                {
-                        /* Now follows a string containing a
-                         * hard-pointer ID/handle to material object. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, vertex->material);
-                }
-                else if (strcmp (temp_string, "360") == 0)
-                {
-                        /* Now follows a string containing Hard owner
-                         * ID/handle to owner dictionary. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, vertex->dictionary_owner_hard);
-                }
-                else if (strcmp (temp_string, "370") == 0)
-                {
-                        /* Now follows a string containing the lineweight
-                         * value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%hd\n", &vertex->lineweight);
-                }
-                else if (strcmp (temp_string, "390") == 0)
-                {
-                        /* Now follows a string containing a plot style
-                         * name value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, vertex->plot_style_name);
-                }
-                else if (strcmp (temp_string, "420") == 0)
-                {
-                        /* Now follows a string containing a color value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%ld\n", &vertex->color_value);
-                }
-                else if (strcmp (temp_string, "430") == 0)
-                {
-                        /* Now follows a string containing a color
-                         * name value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, vertex->color_name);
-                }
-                else if (strcmp (temp_string, "440") == 0)
-                {
-                        /* Now follows a string containing a transparency
-                         * value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%ld\n", &vertex->transparency);
-                }
-                else if (strcmp (temp_string, "999") == 0)
-                {
-                        /* Now follows a string containing a comment. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
-                        fprintf (stdout, "DXF comment: %s\n", temp_string);
-                }
-                else
-                {
-                        fprintf (stderr,
-                          (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
-                          __FUNCTION__, fp->filename, fp->line_number);
+                                /* Skip the value of the unknown group code. */
+                                dxf_read_line (temp_string, fp);
+                                break;
                 }
         }
         /* Handle omitted members and/or illegal values. */
         if (strcmp (vertex->linetype, "") == 0)
         {
-                vertex->linetype = strdup (DXF_DEFAULT_LINETYPE);
+                vertex->linetype = dxf_strdup (DXF_DEFAULT_LINETYPE);
         }
         if (strcmp (vertex->layer, "") == 0)
         {
-                vertex->layer = strdup (DXF_DEFAULT_LAYER);
+                vertex->layer = dxf_strdup (DXF_DEFAULT_LAYER);
         }
-        /* Clean up. */
-        free (temp_string);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -509,7 +454,7 @@ dxf_vertex_write
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        char *dxf_entity_name = strdup ("VERTEX");
+        char *dxf_entity_name = dxf_strdup ("VERTEX");
 
         /* Do some basic checks. */
         if (fp == NULL)
@@ -518,7 +463,7 @@ dxf_vertex_write
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (vertex == NULL)
@@ -527,34 +472,34 @@ dxf_vertex_write
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (strcmp (vertex->linetype, "") == 0)
         {
                 fprintf (stderr,
-                  (_("Warning in %s () empty linetype string for the %s entity with id-code: %x\n")),
+                  (_("Warning in %s () empty linetype string for the %s entity with id-code: %" PRIx64 "\n")),
                   __FUNCTION__, dxf_entity_name, vertex->id_code);
                 fprintf (stderr,
                   (_("    %s entity is reset to default linetype")),
                   dxf_entity_name);
-                vertex->linetype = strdup (DXF_DEFAULT_LINETYPE);
+                vertex->linetype = dxf_strdup (DXF_DEFAULT_LINETYPE);
         }
         if (strcmp (vertex->layer, "") == 0)
         {
                 fprintf (stderr,
-                  (_("Warning in %s () empty layer string for the %s entity with id-code: %x\n")),
+                  (_("Warning in %s () empty layer string for the %s entity with id-code: %" PRIx64 "\n")),
                   __FUNCTION__, dxf_entity_name, vertex->id_code);
                 fprintf (stderr,
                   (_("    %s entity is relocated to layer 0")),
                   dxf_entity_name);
-                vertex->layer = strdup (DXF_DEFAULT_LAYER);
+                vertex->layer = dxf_strdup (DXF_DEFAULT_LAYER);
         }
         /* Start writing output. */
-        fprintf (fp->fp, "  0\n%s\n", dxf_entity_name);
-        if (vertex->id_code != -1)
+        dxf_write_string (fp, 0, dxf_entity_name);
+        if (vertex->id_code != DXF_HANDLE_NONE)
         {
-                fprintf (fp->fp, "  5\n%x\n", vertex->id_code);
+                dxf_write_hex (fp, 5, vertex->id_code);
         }
         /*!
          * \todo for version R14.\n
@@ -566,111 +511,111 @@ dxf_vertex_write
          * 102 groups are application defined (optional).\n\n
          * End of group, "}" (optional), with Group code 102.
          */
-        if ((strcmp (vertex->dictionary_owner_soft, "") != 0)
+        if ((vertex->dictionary_owner_soft != 0)
           && (fp->acad_version_number >= AutoCAD_14))
         {
-                fprintf (fp->fp, "102\n{ACAD_REACTORS\n");
-                fprintf (fp->fp, "330\n%s\n", vertex->dictionary_owner_soft);
-                fprintf (fp->fp, "102\n}\n");
+                dxf_write_string (fp, 102, "{ACAD_REACTORS");
+                dxf_write_hex (fp, 330, vertex->dictionary_owner_soft);
+                dxf_write_string (fp, 102, "}");
         }
-        if ((strcmp (vertex->dictionary_owner_hard, "") != 0)
+        if ((vertex->dictionary_owner_hard != 0)
           && (fp->acad_version_number >= AutoCAD_14))
         {
-                fprintf (fp->fp, "102\n{ACAD_XDICTIONARY\n");
-                fprintf (fp->fp, "360\n%s\n", vertex->dictionary_owner_hard);
-                fprintf (fp->fp, "102\n}\n");
+                dxf_write_string (fp, 102, "{ACAD_XDICTIONARY");
+                dxf_write_hex (fp, 360, vertex->dictionary_owner_hard);
+                dxf_write_string (fp, 102, "}");
         }
         if (fp->acad_version_number >= AutoCAD_13)
         {
-                fprintf (fp->fp, "100\nAcDbEntity\n");
+                dxf_write_string (fp, 100, "AcDbEntity");
         }
         if (vertex->paperspace == DXF_PAPERSPACE)
         {
-                fprintf (fp->fp, " 67\n%d\n", (int16_t) DXF_PAPERSPACE);
+                dxf_write_int (fp, 67, (int16_t) DXF_PAPERSPACE);
         }
-        fprintf (fp->fp, "  8\n%s\n", vertex->layer);
+        dxf_write_string (fp, 8, vertex->layer);
         if (strcmp (vertex->linetype, DXF_DEFAULT_LINETYPE) != 0)
         {
-                fprintf (fp->fp, "  6\n%s\n", vertex->linetype);
+                dxf_write_string (fp, 6, vertex->linetype);
         }
         if ((fp->acad_version_number <= AutoCAD_11)
           && DXF_FLATLAND
           && (vertex->elevation != 0.0))
         {
-                fprintf (fp->fp, " 38\n%f\n", vertex->elevation);
+                dxf_write_double (fp, 38, vertex->elevation);
         }
         if (vertex->color != DXF_COLOR_BYLAYER)
         {
-                fprintf (fp->fp, " 62\n%d\n", vertex->color);
+                dxf_write_int (fp, 62, vertex->color);
         }
         if (vertex->linetype_scale != 1.0)
         {
-                fprintf (fp->fp, " 48\n%f\n", vertex->linetype_scale);
+                dxf_write_double (fp, 48, vertex->linetype_scale);
         }
         if (vertex->visibility != 0)
         {
-                fprintf (fp->fp, " 60\n%d\n", vertex->visibility);
+                dxf_write_int (fp, 60, vertex->visibility);
         }
         /*! \todo Put \c thickness in the correct order. */ 
         if (vertex->thickness != 0.0)
         {
-                fprintf (fp->fp, " 39\n%f\n", vertex->thickness);
+                dxf_write_double (fp, 39, vertex->thickness);
         }
-        fprintf (fp->fp, "100\nAcDbVertex\n");
+        dxf_write_string (fp, 100, "AcDbVertex");
         if ((DXF_CHECK_BIT (vertex->flag, 0))
           || (DXF_CHECK_BIT (vertex->flag, 1))
           || (DXF_CHECK_BIT (vertex->flag, 2))
           || (DXF_CHECK_BIT (vertex->flag, 3))
           || (DXF_CHECK_BIT (vertex->flag, 4)))
         {
-                fprintf (fp->fp, "100\nAcDb2dVertex\n");
+                dxf_write_string (fp, 100, "AcDb2dVertex");
         }
         if ((DXF_CHECK_BIT (vertex->flag, 5))
           || (DXF_CHECK_BIT (vertex->flag, 6))
           || (DXF_CHECK_BIT (vertex->flag, 7)))
         {
-                fprintf (fp->fp, "100\nAcDb3dPolylineVertex\n");
+                dxf_write_string (fp, 100, "AcDb3dPolylineVertex");
         }
-        fprintf (fp->fp, "100\nAcDb3dPolylineVertex\n");
-        fprintf (fp->fp, " 10\n%f\n", vertex->p0->x0);
-        fprintf (fp->fp, " 20\n%f\n", vertex->p0->y0);
-        fprintf (fp->fp, " 30\n%f\n", vertex->p0->z0);
+        dxf_write_string (fp, 100, "AcDb3dPolylineVertex");
+        dxf_write_double (fp, 10, vertex->p0.x);
+        dxf_write_double (fp, 20, vertex->p0.y);
+        dxf_write_double (fp, 30, vertex->p0.z);
         if (vertex->start_width != 0.0)
         {
-                fprintf (fp->fp, " 40\n%f\n", vertex->start_width);
+                dxf_write_double (fp, 40, vertex->start_width);
         }
         if (vertex->end_width != 0.0)
         {
-                fprintf (fp->fp, " 41\n%f\n", vertex->end_width);
+                dxf_write_double (fp, 41, vertex->end_width);
         }
         if (vertex->bulge != 0.0)
         {
-                fprintf (fp->fp, " 42\n%f\n", vertex->bulge);
+                dxf_write_double (fp, 42, vertex->bulge);
         }
-        fprintf (fp->fp, " 70\n%d\n", vertex->flag);
+        dxf_write_int (fp, 70, vertex->flag);
         if (vertex->curve_fit_tangent_direction != 0.0)
         {
-                fprintf (fp->fp, " 50\n%f\n", vertex->curve_fit_tangent_direction);
+                dxf_write_double (fp, 50, vertex->curve_fit_tangent_direction);
         }
         if (vertex->polyface_mesh_vertex_index_1 != 0)
         {
-                fprintf (fp->fp, " 71\n%d\n", vertex->polyface_mesh_vertex_index_1);
+                dxf_write_int (fp, 71, vertex->polyface_mesh_vertex_index_1);
         }
         if (vertex->polyface_mesh_vertex_index_2 != 0)
         {
-                fprintf (fp->fp, " 72\n%d\n", vertex->polyface_mesh_vertex_index_2);
+                dxf_write_int (fp, 72, vertex->polyface_mesh_vertex_index_2);
         }
         if (vertex->polyface_mesh_vertex_index_3 != 0)
         {
-                fprintf (fp->fp, " 73\n%d\n", vertex->polyface_mesh_vertex_index_3);
+                dxf_write_int (fp, 73, vertex->polyface_mesh_vertex_index_3);
         }
         if (vertex->polyface_mesh_vertex_index_4 != 0)
         {
-                fprintf (fp->fp, " 74\n%d\n", vertex->polyface_mesh_vertex_index_4);
+                dxf_write_int (fp, 74, vertex->polyface_mesh_vertex_index_4);
         }
-        fprintf (fp->fp, " 91\n%d\n", vertex->vertex_identifier);
+        dxf_write_int (fp, 91, vertex->vertex_identifier);
         /* Clean up. */
-        free (dxf_entity_name);
+        dxf_free (dxf_entity_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -710,16 +655,11 @@ dxf_vertex_free
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        free (vertex->linetype);
-        free (vertex->layer);
+        dxf_string_free (vertex->linetype);
+        dxf_string_free (vertex->layer);
         dxf_binary_graphics_data_free_list (vertex->binary_graphics_data);
-        free (vertex->dictionary_owner_soft);
-        free (vertex->material);
-        free (vertex->dictionary_owner_hard);
-        free (vertex->plot_style_name);
-        free (vertex->color_name);
-        dxf_point_free (vertex->p0);
-        free (vertex);
+        dxf_string_free (vertex->color_name);
+        dxf_free (vertex);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -765,7 +705,7 @@ dxf_vertex_free_list
  *
  * \return \c id_code.
  */
-int
+uint64_t
 dxf_vertex_get_id_code
 (
         DxfVertex *vertex
@@ -783,12 +723,6 @@ dxf_vertex_get_id_code
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (vertex->id_code < 0)
-        {
-                fprintf (stderr,
-                  (_("Warning in %s () a negative value was found.\n")),
-                  __FUNCTION__);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -804,7 +738,7 @@ dxf_vertex_set_id_code
 (
         DxfVertex *vertex,
                 /*!< a pointer to a DXF \c VERTEX entity. */
-        int id_code
+        uint64_t id_code
                 /*!< the \c id_code to be set for the entity.\n
                  * This is to be an unique (sequential) number in the
                  * DXF file. */
@@ -821,12 +755,6 @@ dxf_vertex_set_id_code
                   __FUNCTION__);
                 return (NULL);
         }
-        if (id_code < 0)
-        {
-                fprintf (stderr,
-                  (_("Warning in %s () a negative value was passed.\n")),
-                  __FUNCTION__);
-        }
         vertex->id_code = id_code;
 #if DEBUG
         DXF_DEBUG_END
@@ -868,7 +796,7 @@ dxf_vertex_get_linetype
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (vertex->linetype));
+        return (dxf_strdup (vertex->linetype));
 }
 
 
@@ -903,7 +831,7 @@ dxf_vertex_set_linetype
                   __FUNCTION__);
                 return (NULL);
         }
-        vertex->linetype = strdup (linetype);
+        vertex->linetype = dxf_strdup (linetype);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -944,7 +872,7 @@ dxf_vertex_get_layer
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (vertex->layer));
+        return (dxf_strdup (vertex->layer));
 }
 
 
@@ -979,7 +907,7 @@ dxf_vertex_set_layer
                   __FUNCTION__);
                 return (NULL);
         }
-        vertex->layer = strdup (layer);
+        vertex->layer = dxf_strdup (layer);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1709,11 +1637,9 @@ dxf_vertex_set_binary_graphics_data
  * \brief Get the pointer to the \c dictionary_owner_soft from a DXF 
  * \c VERTEX entity.
  *
- * \return pointer to the \c dictionary_owner_soft.
- *
- * \warning No checks are performed on the returned pointer (string).
+ * \return the handle of the \c dictionary_owner_soft.
  */
-char *
+uint64_t
 dxf_vertex_get_dictionary_owner_soft
 (
         DxfVertex *vertex
@@ -1729,19 +1655,12 @@ dxf_vertex_get_dictionary_owner_soft
                 fprintf (stderr,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
-                return (NULL);
-        }
-        if (vertex->dictionary_owner_soft ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
+                return (0);
         }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (vertex->dictionary_owner_soft));
+        return (vertex->dictionary_owner_soft);
 }
 
 
@@ -1754,8 +1673,8 @@ dxf_vertex_set_dictionary_owner_soft
 (
         DxfVertex *vertex,
                 /*!< a pointer to a DXF \c VERTEX entity. */
-        char *dictionary_owner_soft
-                /*!< a string containing the pointer to the \c
+        uint64_t dictionary_owner_soft
+                /*!< the handle of the \c
                  * dictionary_owner_soft for the entity. */
 )
 {
@@ -1770,14 +1689,7 @@ dxf_vertex_set_dictionary_owner_soft
                   __FUNCTION__);
                 return (NULL);
         }
-        if (dictionary_owner_soft == NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was passed.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
-        vertex->dictionary_owner_soft = strdup (dictionary_owner_soft);
+        vertex->dictionary_owner_soft = dictionary_owner_soft;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1788,12 +1700,10 @@ dxf_vertex_set_dictionary_owner_soft
 /*!
  * \brief Get the pointer to the \c material from a DXF \c VERTEX entity.
  *
- * \return a pointer to \c material when successful, or \c NULL when an
+ * \return the handle \c material when successful, or 0 when an
  * error occurred.
- *
- * \warning No checks are performed on the returned pointer.
  */
-char *
+uint64_t
 dxf_vertex_get_material
 (
         DxfVertex *vertex
@@ -1809,19 +1719,12 @@ dxf_vertex_get_material
                 fprintf (stderr,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
-                return (NULL);
-        }
-        if (vertex->material ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
+                return (0);
         }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (vertex->material));
+        return (vertex->material);
 }
 
 
@@ -1836,8 +1739,8 @@ dxf_vertex_set_material
 (
         DxfVertex *vertex,
                 /*!< a pointer to a DXF \c VERTEX entity. */
-        char *material
-                /*!< a string containing the pointer to the \c
+        uint64_t material
+                /*!< the handle of the \c
                  * material for the entity. */
 )
 {
@@ -1852,14 +1755,7 @@ dxf_vertex_set_material
                   __FUNCTION__);
                 return (NULL);
         }
-        if (material == NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was passed.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
-        vertex->material = strdup (material);
+        vertex->material = material;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1871,11 +1767,9 @@ dxf_vertex_set_material
  * \brief Get the pointer to the \c dictionary_owner_hard from a DXF 
  * \c VERTEX entity.
  *
- * \return pointer to the \c dictionary_owner_hard.
- *
- * \warning No checks are performed on the returned pointer (string).
+ * \return the handle of the \c dictionary_owner_hard.
  */
-char *
+uint64_t
 dxf_vertex_get_dictionary_owner_hard
 (
         DxfVertex *vertex
@@ -1891,19 +1785,12 @@ dxf_vertex_get_dictionary_owner_hard
                 fprintf (stderr,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
-                return (NULL);
-        }
-        if (vertex->dictionary_owner_hard ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
+                return (0);
         }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (vertex->dictionary_owner_hard));
+        return (vertex->dictionary_owner_hard);
 }
 
 
@@ -1916,8 +1803,8 @@ dxf_vertex_set_dictionary_owner_hard
 (
         DxfVertex *vertex,
                 /*!< a pointer to a DXF \c VERTEX entity. */
-        char *dictionary_owner_hard
-                /*!< a string containing the pointer to the \c
+        uint64_t dictionary_owner_hard
+                /*!< the handle of the \c
                  * dictionary_owner_hard for the entity. */
 )
 {
@@ -1932,14 +1819,7 @@ dxf_vertex_set_dictionary_owner_hard
                   __FUNCTION__);
                 return (NULL);
         }
-        if (dictionary_owner_hard == NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was passed.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
-        vertex->dictionary_owner_hard = strdup (dictionary_owner_hard);
+        vertex->dictionary_owner_hard = dictionary_owner_hard;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2015,10 +1895,10 @@ dxf_vertex_set_lineweight
 /*!
  * \brief Get the \c plot_style_name from a DXF \c VERTEX entity.
  *
- * \return a pointer to \c plot_style_name when sucessful, or \c NULL
+ * \return the handle \c plot_style_name when sucessful, or 0
  * when an error occurred.
  */
-char *
+uint64_t
 dxf_vertex_get_plot_style_name
 (
         DxfVertex *vertex
@@ -2034,19 +1914,12 @@ dxf_vertex_get_plot_style_name
                 fprintf (stderr,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
-                return (NULL);
-        }
-        if (vertex->plot_style_name ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
+                return (0);
         }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (vertex->plot_style_name));
+        return (vertex->plot_style_name);
 }
 
 
@@ -2061,7 +1934,7 @@ dxf_vertex_set_plot_style_name
 (
         DxfVertex *vertex,
                 /*!< a pointer to a DXF \c VERTEX entity. */
-        char *plot_style_name
+        uint64_t plot_style_name
                 /*!< a string containing the \c plot_style_name for the
                  * entity. */
 )
@@ -2077,14 +1950,7 @@ dxf_vertex_set_plot_style_name
                   __FUNCTION__);
                 return (NULL);
         }
-        if (plot_style_name == NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was passed.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
-        vertex->plot_style_name = strdup (plot_style_name);
+        vertex->plot_style_name = plot_style_name;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2191,7 +2057,7 @@ dxf_vertex_get_color_name
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (vertex->color_name));
+        return (dxf_strdup (vertex->color_name));
 }
 
 
@@ -2229,7 +2095,7 @@ dxf_vertex_set_color_name
                   __FUNCTION__);
                 return (NULL);
         }
-        vertex->color_name = strdup (color_name);
+        vertex->color_name = dxf_strdup (color_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2307,7 +2173,7 @@ dxf_vertex_set_transparency
  *
  * \return the location point \c p0.
  */
-DxfPoint *
+DxfVec3 *
 dxf_vertex_get_p0
 (
         DxfVertex *vertex
@@ -2325,17 +2191,10 @@ dxf_vertex_get_p0
                   __FUNCTION__);
                 return (NULL);
         }
-        if (vertex->p0 == NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (vertex->p0);
+        return (&vertex->p0);
 }
 
 
@@ -2349,8 +2208,8 @@ dxf_vertex_set_p0
 (
         DxfVertex *vertex,
                 /*!< a pointer to a DXF \c VERTEX entity. */
-        DxfPoint *p0
-                /*!< a pointer to a DXF \c POINT entity. */
+        DxfVec3 *p0
+                /*!< a pointer to the coordinates. */
 )
 {
 #ifdef DEBUG
@@ -2371,7 +2230,7 @@ dxf_vertex_set_p0
                   __FUNCTION__);
                 return (NULL);
         }
-        vertex->p0 = p0;
+        vertex->p0 = *p0;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2404,17 +2263,10 @@ dxf_vertex_get_x0
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (vertex->p0 == NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (EXIT_FAILURE);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (vertex->p0->x0);
+        return (vertex->p0.x);
 }
 
 
@@ -2446,14 +2298,7 @@ dxf_vertex_set_x0
                   __FUNCTION__);
                 return (NULL);
         }
-        if (vertex->p0 == NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
-        vertex->p0->x0 = x0;
+        vertex->p0.x = x0;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2486,17 +2331,10 @@ dxf_vertex_get_y0
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (vertex->p0 == NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (EXIT_FAILURE);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (vertex->p0->y0);
+        return (vertex->p0.y);
 }
 
 
@@ -2528,14 +2366,7 @@ dxf_vertex_set_y0
                   __FUNCTION__);
                 return (NULL);
         }
-        if (vertex->p0 == NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
-        vertex->p0->y0 = y0;
+        vertex->p0.y = y0;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2568,17 +2399,10 @@ dxf_vertex_get_z0
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (vertex->p0 == NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (EXIT_FAILURE);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (vertex->p0->z0);
+        return (vertex->p0.z);
 }
 
 
@@ -2610,14 +2434,7 @@ dxf_vertex_set_z0
                   __FUNCTION__);
                 return (NULL);
         }
-        if (vertex->p0 == NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
-        vertex->p0->z0 = z0;
+        vertex->p0.z = z0;
 #if DEBUG
         DXF_DEBUG_END
 #endif
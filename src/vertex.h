@@ -81,7 +81,7 @@ typedef struct
 dxf_vertex_struct
 {
         /* Members common for all DXF drawable entities. */
-        int id_code;
+        uint64_t id_code;
                 /*!< Identification number for the entity.\n
                  * This is to be an unique (sequential) number in the DXF
                  * file.\n
@@ -154,16 +154,16 @@ dxf_vertex_struct
                  * (optional).\n
                  * Group code = 310.\n
                  * \since Introduced in version R2000. */
-        char *dictionary_owner_soft;
+        uint64_t dictionary_owner_soft;
                 /*!< Soft-pointer ID/handle to owner dictionary (optional).\n
                  * Group code = 330.\n
                  * \since Introduced in version R14. */
-        char *material;
+        uint64_t material;
                 /*!< Hard-pointer ID/handle to material object (present if
                  * not BYLAYER).\n
                  * Group code = 347.\n
                  * \since Introduced in version R2008. */
-        char *dictionary_owner_hard;
+        uint64_t dictionary_owner_hard;
                 /*!< Hard owner ID/handle to owner dictionary (optional).\n
                  * Group code = 360.\n
                  * \since Introduced in version R14. */
@@ -172,7 +172,7 @@ dxf_vertex_struct
                  * Stored and moved around as a 16-bit integer.\n
                  * Group code = 370.\n
                  * \since Introduced in version R2002. */
-        char *plot_style_name;
+        uint64_t plot_style_name;
                 /*!< Hard pointer ID / handle of PlotStyleName object.\n
                  * Group code = 390.\n
                  * \since Introduced in version R2009. */
@@ -205,7 +205,7 @@ dxf_vertex_struct
                  * Group code = 440.\n
                  * \since Introduced in version R2004. */
         /* Specific members for a DXF vertex. */
-        DxfPoint *p0;
+        DxfVec3 p0;
                 /*!< Location point.\n
                  * Group codes = 10, 20 and 30.*/
         double start_width;
@@ -278,8 +278,8 @@ DxfVertex *dxf_vertex_read (DxfFile *fp, DxfVertex *vertex);
 int dxf_vertex_write (DxfFile *fp, DxfVertex *vertex);
 int dxf_vertex_free (DxfVertex *vertex);
 void dxf_vertex_free_list (DxfVertex *vertices);
-int dxf_vertex_get_id_code (DxfVertex *vertex);
-DxfVertex *dxf_vertex_set_id_code (DxfVertex *vertex, int id_code);
+uint64_t dxf_vertex_get_id_code (DxfVertex *vertex);
+DxfVertex *dxf_vertex_set_id_code (DxfVertex *vertex, uint64_t id_code);
 char *dxf_vertex_get_linetype (DxfVertex *vertex);
 DxfVertex *dxf_vertex_set_linetype (DxfVertex *vertex, char *linetype);
 char *dxf_vertex_get_layer (DxfVertex *vertex);
@@ -302,24 +302,24 @@ int16_t dxf_vertex_get_shadow_mode (DxfVertex *vertex);
 DxfVertex *dxf_vertex_set_shadow_mode (DxfVertex *vertex, int16_t shadow_mode);
 DxfBinaryGraphicsData *dxf_vertex_get_binary_graphics_data (DxfVertex *vertex);
 DxfVertex *dxf_vertex_set_binary_graphics_data (DxfVertex *vertex, DxfBinaryGraphicsData *data);
-char *dxf_vertex_get_dictionary_owner_soft (DxfVertex *vertex);
-DxfVertex *dxf_vertex_set_dictionary_owner_soft (DxfVertex *vertex, char *dictionary_owner_soft);
-char *dxf_vertex_get_material (DxfVertex *vertex);
-DxfVertex *dxf_vertex_set_material (DxfVertex *vertex, char *material);
-char *dxf_vertex_get_dictionary_owner_hard (DxfVertex *vertex);
-DxfVertex *dxf_vertex_set_dictionary_owner_hard (DxfVertex *vertex, char *dictionary_owner_hard);
+uint64_t dxf_vertex_get_dictionary_owner_soft (DxfVertex *vertex);
+DxfVertex *dxf_vertex_set_dictionary_owner_soft (DxfVertex *vertex, uint64_t dictionary_owner_soft);
+uint64_t dxf_vertex_get_material (DxfVertex *vertex);
+DxfVertex *dxf_vertex_set_material (DxfVertex *vertex, uint64_t material);
+uint64_t dxf_vertex_get_dictionary_owner_hard (DxfVertex *vertex);
+DxfVertex *dxf_vertex_set_dictionary_owner_hard (DxfVertex *vertex, uint64_t dictionary_owner_hard);
 int16_t dxf_vertex_get_lineweight (DxfVertex *vertex);
 DxfVertex *dxf_vertex_set_lineweight (DxfVertex *vertex, int16_t lineweight);
-char *dxf_vertex_get_plot_style_name (DxfVertex *vertex);
-DxfVertex *dxf_vertex_set_plot_style_name (DxfVertex *vertex, char *plot_style_name);
+uint64_t dxf_vertex_get_plot_style_name (DxfVertex *vertex);
+DxfVertex *dxf_vertex_set_plot_style_name (DxfVertex *vertex, uint64_t plot_style_name);
 long dxf_vertex_get_color_value (DxfVertex *vertex);
 DxfVertex *dxf_vertex_set_color_value (DxfVertex *vertex, long color_value);
 char *dxf_vertex_get_color_name (DxfVertex *vertex);
 DxfVertex *dxf_vertex_set_color_name (DxfVertex *vertex, char *color_name);
 long dxf_vertex_get_transparency (DxfVertex *vertex);
 DxfVertex *dxf_vertex_set_transparency (DxfVertex *vertex, long transparency);
-DxfPoint *dxf_vertex_get_p0 (DxfVertex *vertex);
-DxfVertex *dxf_vertex_set_p0 (DxfVertex *vertex, DxfPoint *p0);
+DxfVec3 *dxf_vertex_get_p0 (DxfVertex *vertex);
+DxfVertex *dxf_vertex_set_p0 (DxfVertex *vertex, DxfVec3 *p0);
 double dxf_vertex_get_x0 (DxfVertex *vertex);
 DxfVertex *dxf_vertex_set_x0 (DxfVertex *vertex, double x0);
 double dxf_vertex_get_y0 (DxfVertex *vertex);
@@ -40,6 +40,7 @@
 
 
 #include "view.h"
+#include "util.h"
 
 
 /*!
@@ -62,7 +63,7 @@ dxf_view_new ()
         size = sizeof (DxfView);
         /* avoid malloc of 0 bytes */
         if (size == 0) size = 1;
-        if ((view = malloc (size)) == NULL)
+        if ((view = dxf_malloc (size)) == NULL)
         {
                 fprintf (stderr,
                   (_("Error in %s () could not allocate memory for a DxfView struct.\n")),
@@ -112,8 +113,8 @@ dxf_view_init
                   __FUNCTION__);
                 return (NULL);
         }
-        view->id_code = 0;
-        view->name = strdup ("");
+        view->id_code = DXF_HANDLE_NONE;
+        view->name = dxf_strdup ("");
         view->p0 = dxf_point_new ();
         view->p0 = dxf_point_init (view->p0);
         view->p0->x0 = 0.0;
@@ -136,8 +137,8 @@ dxf_view_init
         view->twist_angle = 0.0;
         view->flag = 0;
         view->mode = 0;
-        view->dictionary_owner_soft = strdup ("");
-        view->dictionary_owner_hard = strdup ("");
+        view->dictionary_owner_soft = 0;
+        view->dictionary_owner_hard = 0;
         view->next = NULL;
 #if DEBUG
         DXF_DEBUG_END
@@ -169,7 +170,8 @@ dxf_view_read
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        char *temp_string = NULL;
+        char temp_string[DXF_MAX_STRING_LENGTH];
+        int group_code;
 
         /* Do some basic checks. */
         if (fp == NULL)
@@ -177,8 +179,6 @@ dxf_view_read
                 fprintf (stderr,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
-                /* Clean up. */
-                free (temp_string);
                 return (NULL);
         }
         if (view == NULL)
@@ -188,194 +188,158 @@ dxf_view_read
                   __FUNCTION__);
                 view = dxf_view_init (view);
         }
-        (fp->line_number)++;
-        fscanf (fp->fp, "%[^\n]", temp_string);
-        while (strcmp (temp_string, "0") != 0)
+        while ((dxf_read_group_code (fp, &group_code) == EXIT_SUCCESS)
+          && (group_code != 0))
         {
-                if (ferror (fp->fp))
+                if (dxf_read_error (fp))
                 {
                         fprintf (stderr,
                           (_("Error in %s () while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
-                        fclose (fp->fp);
-                        /* Clean up. */
-                        free (temp_string);
                         return (NULL);
                 }
-                if (strcmp (temp_string, "5") == 0)
-                {
-                        /* Now follows a string containing a sequential
-                         * id number. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%x\n", (uint *) &view->id_code);
-                }
-                else if (strcmp (temp_string, "2") == 0)
-                {
-                        /* Now follows a string containing a view
-                         * name. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, view->name);
-                }
-                else if (strcmp (temp_string, "10") == 0)
-                {
-                        /* Now follows a string containing the
-                         * X-coordinate of the View center point. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &view->p0->x0);
-                }
-                else if (strcmp (temp_string, "20") == 0)
-                {
-                        /* Now follows a string containing the
-                         * Y-coordinate of the View center point. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &view->p0->y0);
-                }
-                else if (strcmp (temp_string, "11") == 0)
-                {
-                        /* Now follows a string containing the
-                         * X-coordinate of the View direction from
-                         * target. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &view->p1->x0);
-                }
-                else if (strcmp (temp_string, "21") == 0)
-                {
-                        /* Now follows a string containing the
-                         * Y-coordinate of the View direction from
-                         * target. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &view->p1->y0);
-                }
-                else if (strcmp (temp_string, "31") == 0)
-                {
-                        /* Now follows a string containing the
-                         * Z-coordinate of the View direction from
-                         * target. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &view->p1->z0);
-                }
-                else if (strcmp (temp_string, "12") == 0)
-                {
-                        /* Now follows a string containing the
-                         * X-coordinate of the Target point. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &view->p2->x0);
-                }
-                else if (strcmp (temp_string, "22") == 0)
-                {
-                        /* Now follows a string containing the
-                         * Y-coordinate of the Target point. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &view->p2->y0);
-                }
-                else if (strcmp (temp_string, "32") == 0)
-                {
-                        /* Now follows a string containing the
-                         * Z-coordinate of the Target point. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &view->p2->z0);
-                }
-                else if (strcmp (temp_string, "40") == 0)
-                {
-                        /* Now follows a string containing the view
-                         * height. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &view->height);
-                }
-                else if (strcmp (temp_string, "41") == 0)
+                switch (group_code)
                 {
-                        /* Now follows a string containing the view
-                         * width. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &view->width);
-                }
-                else if (strcmp (temp_string, "42") == 0)
-                {
-                        /* Now follows a string containing the lens
-                         * length. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &view->lens_length);
-                }
-                else if (strcmp (temp_string, "43") == 0)
-                {
-                        /* Now follows a string containing the Front
-                         * clipping plane - offset from target point. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &view->front_plane_offset);
-                }
-                else if (strcmp (temp_string, "44") == 0)
-                {
-                        /* Now follows a string containing the Back
-                         * clipping plane - offset from target point. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &view->back_plane_offset);
-                }
-                else if (strcmp (temp_string, "50") == 0)
-                {
-                        /* Now follows a string containing the view
-                         * twist angle. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &view->twist_angle);
-                }
-                else if (strcmp (temp_string, "70") == 0)
-                {
-                        /* Now follows a string containing the
-                         * standard flag value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%d\n", &view->flag);
-                }
-                else if (strcmp (temp_string, "71") == 0)
-                {
-                        /* Now follows a string containing the view mode
-                         * value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%d\n", &view->mode);
-                }
-                else if ((fp->acad_version_number >= AutoCAD_13)
-                        && (strcmp (temp_string, "100") == 0))
-                {
-                        /* Now follows a string containing the
-                         * subclass marker value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
-                        if ((strcmp (temp_string, "AcDbSymbolTableRecord") != 0)
-                        && ((strcmp (temp_string, "AcDbViewTableRecord") != 0)))
-                        {
+                        case 5:
+                                /* Now follows a string containing a sequential
+                                 * id number. */
+                                dxf_read_handle (fp, &view->id_code);
+                                break;
+                        case 2:
+                                /* Now follows a string containing a view
+                                 * name. */
+                                dxf_read_string (fp, &view->name);
+                                break;
+                        case 10:
+                                /* Now follows a string containing the
+                                 * X-coordinate of the View center point. */
+                                dxf_read_double (fp, &view->p0->x0);
+                                break;
+                        case 20:
+                                /* Now follows a string containing the
+                                 * Y-coordinate of the View center point. */
+                                dxf_read_double (fp, &view->p0->y0);
+                                break;
+                        case 11:
+                                /* Now follows a string containing the
+                                 * X-coordinate of the View direction from
+                                 * target. */
+                                dxf_read_double (fp, &view->p1->x0);
+                                break;
+                        case 21:
+                                /* Now follows a string containing the
+                                 * Y-coordinate of the View direction from
+                                 * target. */
+                                dxf_read_double (fp, &view->p1->y0);
+                                break;
+                        case 31:
+                                /* Now follows a string containing the
+                                 * Z-coordinate of the View direction from
+                                 * target. */
+                                dxf_read_double (fp, &view->p1->z0);
+                                break;
+                        case 12:
+                                /* Now follows a string containing the
+                                 * X-coordinate of the Target point. */
+                                dxf_read_double (fp, &view->p2->x0);
+                                break;
+                        case 22:
+                                /* Now follows a string containing the
+                                 * Y-coordinate of the Target point. */
+                                dxf_read_double (fp, &view->p2->y0);
+                                break;
+                        case 32:
+                                /* Now follows a string containing the
+                                 * Z-coordinate of the Target point. */
+                                dxf_read_double (fp, &view->p2->z0);
+                                break;
+                        case 40:
+                                /* Now follows a string containing the view
+                                 * height. */
+                                dxf_read_double (fp, &view->height);
+                                break;
+                        case 41:
+                                /* Now follows a string containing the view
+                                 * width. */
+                                dxf_read_double (fp, &view->width);
+                                break;
+                        case 42:
+                                /* Now follows a string containing the lens
+                                 * length. */
+                                dxf_read_double (fp, &view->lens_length);
+                                break;
+                        case 43:
+                                /* Now follows a string containing the Front
+                                 * clipping plane - offset from target point. */
+                                dxf_read_double (fp, &view->front_plane_offset);
+                                break;
+                        case 44:
+                                /* Now follows a string containing the Back
+                                 * clipping plane - offset from target point. */
+                                dxf_read_double (fp, &view->back_plane_offset);
+                                break;
+                        case 50:
+                                /* Now follows a string containing the view
+                                 * twist angle. */
+                                dxf_read_double (fp, &view->twist_angle);
+                                break;
+                        case 70:
+                                /* Now follows a string containing the
+                                 * standard flag value. */
+                                dxf_read_int (fp, &view->flag);
+                                break;
+                        case 71:
+                                /* Now follows a string containing the view mode
+                                 * value. */
+                                dxf_read_int (fp, &view->mode);
+                                break;
+                        case 100:
+                                if (fp->acad_version_number >= AutoCAD_13)
+                                {
+                                        /* Now follows a string containing the
+                                         * subclass marker value. */
+                                        dxf_read_line (temp_string, fp);
+                                        if ((strcmp (temp_string, "AcDbSymbolTableRecord") != 0)
+                                        && ((strcmp (temp_string, "AcDbViewTableRecord") != 0)))
+                                        {
+                                                fprintf (stderr,
+                                                  (_("Warning in %s () found a bad subclass marker in: %s in line: %d.\n")),
+                                                  __FUNCTION__, fp->filename, fp->line_number);
+                                        }
+                                }
+                                else
+                                {
+                                        fprintf (stderr,
+                                          (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
+                                          __FUNCTION__, fp->filename, fp->line_number);
+                                        /* Skip the value of the unknown group code. */
+                                        dxf_read_line (temp_string, fp);
+                                }
+                                break;
+                        case 330:
+                                /* Now follows a string containing Soft-pointer
+                                 * ID/handle to owner dictionary. */
+                                dxf_read_handle (fp, &view->dictionary_owner_soft);
+                                break;
+                        case 360:
+                                /* Now follows a string containing Hard owner
+                                 * ID/handle to owner dictionary. */
+                                dxf_read_handle (fp, &view->dictionary_owner_hard);
+                                break;
+                        case 999:
+                                /* Now follows a string containing a comment. */
+                                dxf_read_line (temp_string, fp);
+                                fprintf (stdout, "DXF comment: %s\n", temp_string);
+                                break;
+                        default:
                                 fprintf (stderr,
-                                  (_("Warning in %s () found a bad subclass marker in: %s in line: %d.\n")),
+                                  (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
                                   __FUNCTION__, fp->filename, fp->line_number);
-                        }
-                }
-                else if (strcmp (temp_string, "330") == 0)
-                {
-                        /* Now follows a string containing Soft-pointer
-                         * ID/handle to owner dictionary. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, view->dictionary_owner_soft);
-                }
-                else if (strcmp (temp_string, "360") == 0)
-                {
-                        /* Now follows a string containing Hard owner
-                         * ID/handle to owner dictionary. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, view->dictionary_owner_hard);
-                }
-                else if (strcmp (temp_string, "999") == 0)
-                {
-                        /* Now follows a string containing a comment. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
-                        fprintf (stdout, "DXF comment: %s\n", temp_string);
-                }
-                else
-                {
-                        fprintf (stderr,
-                          (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
-                          __FUNCTION__, fp->filename, fp->line_number);
+                                /* Skip the value of the unknown group code. */
+                                dxf_read_line (temp_string, fp);
+                                break;
                 }
         }
-        /* Clean up. */
-        free (temp_string);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -401,7 +365,7 @@ dxf_view_write
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        char *dxf_entity_name = strdup ("VIEW");
+        char *dxf_entity_name = dxf_strdup ("VIEW");
 
         /* Do some basic checks. */
         if (fp == NULL)
@@ -410,7 +374,7 @@ dxf_view_write
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (view == NULL)
@@ -419,27 +383,27 @@ dxf_view_write
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if ((view->name == NULL)
           || (strcmp (view->name, "") == 0))
         {
                 fprintf (stderr,
-                  (_("Error in %s () empty UCS name string for the %s entity with id-code: %x\n")),
+                  (_("Error in %s () empty UCS name string for the %s entity with id-code: %" PRIx64 "\n")),
                   __FUNCTION__, dxf_entity_name, view->id_code);
                 fprintf (stderr,
                   (_("\t%s entity is discarded from output.\n")),
                   dxf_entity_name);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         /* Start writing output. */
-        fprintf (fp->fp, "  0\n%s\n", dxf_entity_name);
-        if (view->id_code != -1)
+        dxf_write_string (fp, 0, dxf_entity_name);
+        if (view->id_code != DXF_HANDLE_NONE)
         {
-                fprintf (fp->fp, "  5\n%x\n", view->id_code);
+                dxf_write_hex (fp, 5, view->id_code);
         }
         /*!
          * \todo for version R14.\n
@@ -451,44 +415,44 @@ dxf_view_write
          * 102 groups are application defined (optional).\n\n
          * End of group, "}" (optional), with Group code 102.
          */
-        if ((strcmp (view->dictionary_owner_soft, "") != 0)
+        if ((view->dictionary_owner_soft != 0)
           && (fp->acad_version_number >= AutoCAD_14))
         {
-                fprintf (fp->fp, "102\n{ACAD_REACTORS\n");
-                fprintf (fp->fp, "330\n%s\n", view->dictionary_owner_soft);
-                fprintf (fp->fp, "102\n}\n");
+                dxf_write_string (fp, 102, "{ACAD_REACTORS");
+                dxf_write_hex (fp, 330, view->dictionary_owner_soft);
+                dxf_write_string (fp, 102, "}");
         }
-        if ((strcmp (view->dictionary_owner_hard, "") != 0)
+        if ((view->dictionary_owner_hard != 0)
           && (fp->acad_version_number >= AutoCAD_14))
         {
-                fprintf (fp->fp, "102\n{ACAD_XDICTIONARY\n");
-                fprintf (fp->fp, "360\n%s\n", view->dictionary_owner_hard);
-                fprintf (fp->fp, "102\n}\n");
+                dxf_write_string (fp, 102, "{ACAD_XDICTIONARY");
+                dxf_write_hex (fp, 360, view->dictionary_owner_hard);
+                dxf_write_string (fp, 102, "}");
         }
         if (fp->acad_version_number >= AutoCAD_13)
         {
-                fprintf (fp->fp, "100\nAcDbSymbolTableRecord\n");
-                fprintf (fp->fp, "100\nAcDbViewTableRecord\n");
-        }
-        fprintf (fp->fp, "  2\n%s\n", view->name);
-        fprintf (fp->fp, " 40\n%f\n", view->height);
-        fprintf (fp->fp, " 70\n%d\n", view->flag);
-        fprintf (fp->fp, " 10\n%f\n", view->p0->x0);
-        fprintf (fp->fp, " 20\n%f\n", view->p0->y0);
-        fprintf (fp->fp, " 41\n%f\n", view->width);
-        fprintf (fp->fp, " 11\n%f\n", view->p1->x0);
-        fprintf (fp->fp, " 21\n%f\n", view->p1->y0);
-        fprintf (fp->fp, " 31\n%f\n", view->p1->z0);
-        fprintf (fp->fp, " 12\n%f\n", view->p2->x0);
-        fprintf (fp->fp, " 22\n%f\n", view->p2->y0);
-        fprintf (fp->fp, " 32\n%f\n", view->p2->z0);
-        fprintf (fp->fp, " 42\n%f\n", view->lens_length);
-        fprintf (fp->fp, " 43\n%f\n", view->front_plane_offset);
-        fprintf (fp->fp, " 44\n%f\n", view->back_plane_offset);
-        fprintf (fp->fp, " 50\n%f\n", view->twist_angle);
-        fprintf (fp->fp, " 71\n%d\n", view->mode);
+                dxf_write_string (fp, 100, "AcDbSymbolTableRecord");
+                dxf_write_string (fp, 100, "AcDbViewTableRecord");
+        }
+        dxf_write_string (fp, 2, view->name);
+        dxf_write_double (fp, 40, view->height);
+        dxf_write_int (fp, 70, view->flag);
+        dxf_write_double (fp, 10, view->p0->x0);
+        dxf_write_double (fp, 20, view->p0->y0);
+        dxf_write_double (fp, 41, view->width);
+        dxf_write_double (fp, 11, view->p1->x0);
+        dxf_write_double (fp, 21, view->p1->y0);
+        dxf_write_double (fp, 31, view->p1->z0);
+        dxf_write_double (fp, 12, view->p2->x0);
+        dxf_write_double (fp, 22, view->p2->y0);
+        dxf_write_double (fp, 32, view->p2->z0);
+        dxf_write_double (fp, 42, view->lens_length);
+        dxf_write_double (fp, 43, view->front_plane_offset);
+        dxf_write_double (fp, 44, view->back_plane_offset);
+        dxf_write_double (fp, 50, view->twist_angle);
+        dxf_write_int (fp, 71, view->mode);
         /* Clean up. */
-        free (dxf_entity_name);
+        dxf_free (dxf_entity_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -528,10 +492,8 @@ dxf_view_free
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        free (view->name);
-        free (view->dictionary_owner_soft);
-        free (view->dictionary_owner_hard);
-        free (view);
+        dxf_free (view->name);
+        dxf_free (view);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -577,7 +539,7 @@ dxf_view_free_list
  *
  * \return \c id_code.
  */
-int
+uint64_t
 dxf_view_get_id_code
 (
         DxfView *view
@@ -595,12 +557,6 @@ dxf_view_get_id_code
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (view->id_code < 0)
-        {
-                fprintf (stderr,
-                  (_("Warning in %s () a negative value was found.\n")),
-                  __FUNCTION__);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -616,7 +572,7 @@ dxf_view_set_id_code
 (
         DxfView *view,
                 /*!< a pointer to a DXF \c VIEW symbol table entry. */
-        int id_code
+        uint64_t id_code
                 /*!< the \c id_code to be set for the entry.\n
                  * This is to be an unique (sequential) number in the
                  * DXF file. */
@@ -633,12 +589,6 @@ dxf_view_set_id_code
                   __FUNCTION__);
                 return (NULL);
         }
-        if (id_code < 0)
-        {
-                fprintf (stderr,
-                  (_("Warning in %s () a negative value was passed.\n")),
-                  __FUNCTION__);
-        }
         view->id_code = id_code;
 #if DEBUG
         DXF_DEBUG_END
@@ -680,7 +630,7 @@ dxf_view_get_name
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (view->name));
+        return (dxf_strdup (view->name));
 }
 
 
@@ -715,7 +665,7 @@ dxf_view_set_name
                   __FUNCTION__);
                 return (NULL);
         }
-        view->name = strdup (name);
+        view->name = dxf_strdup (name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2168,11 +2118,9 @@ dxf_view_set_mode
  * \brief Get the pointer to the \c dictionary_owner_soft from a DXF 
  * \c VIEW symbol table entry.
  *
- * \return pointer to the \c dictionary_owner_soft.
- *
- * \warning No checks are performed on the returned pointer (string).
+ * \return the handle of the \c dictionary_owner_soft.
  */
-char *
+uint64_t
 dxf_view_get_dictionary_owner_soft
 (
         DxfView *view
@@ -2188,19 +2136,12 @@ dxf_view_get_dictionary_owner_soft
                 fprintf (stderr,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
-                return (NULL);
-        }
-        if (view->dictionary_owner_soft ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
+                return (0);
         }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (view->dictionary_owner_soft));
+        return (view->dictionary_owner_soft);
 }
 
 
@@ -2213,8 +2154,8 @@ dxf_view_set_dictionary_owner_soft
 (
         DxfView *view,
                 /*!< a pointer to a DXF \c VIEW symbol table entry. */
-        char *dictionary_owner_soft
-                /*!< a string containing the pointer to the \c
+        uint64_t dictionary_owner_soft
+                /*!< the handle of the \c
                  * dictionary_owner_soft for the entity. */
 )
 {
@@ -2229,14 +2170,7 @@ dxf_view_set_dictionary_owner_soft
                   __FUNCTION__);
                 return (NULL);
         }
-        if (dictionary_owner_soft == NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was passed.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
-        view->dictionary_owner_soft = strdup (dictionary_owner_soft);
+        view->dictionary_owner_soft = dictionary_owner_soft;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2248,11 +2182,9 @@ dxf_view_set_dictionary_owner_soft
  * \brief Get the pointer to the \c dictionary_owner_hard from a DXF 
  * \c VIEW symbol table entry.
  *
- * \return pointer to the \c dictionary_owner_hard.
- *
- * \warning No checks are performed on the returned pointer (string).
+ * \return the handle of the \c dictionary_owner_hard.
  */
-char *
+uint64_t
 dxf_view_get_dictionary_owner_hard
 (
         DxfView *view
@@ -2268,19 +2200,12 @@ dxf_view_get_dictionary_owner_hard
                 fprintf (stderr,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
-                return (NULL);
-        }
-        if (view->dictionary_owner_hard ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
+                return (0);
         }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (view->dictionary_owner_hard));
+        return (view->dictionary_owner_hard);
 }
 
 
@@ -2293,8 +2218,8 @@ dxf_view_set_dictionary_owner_hard
 (
         DxfView *view,
                 /*!< a pointer to a DXF \c VIEW symbol table entry. */
-        char *dictionary_owner_hard
-                /*!< a string containing the pointer to the \c
+        uint64_t dictionary_owner_hard
+                /*!< the handle of the \c
                  * dictionary_owner_hard for the entity. */
 )
 {
@@ -2309,14 +2234,7 @@ dxf_view_set_dictionary_owner_hard
                   __FUNCTION__);
                 return (NULL);
         }
-        if (dictionary_owner_hard == NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was passed.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
-        view->dictionary_owner_hard = strdup (dictionary_owner_hard);
+        view->dictionary_owner_hard = dictionary_owner_hard;
 #if DEBUG
         DXF_DEBUG_END
 #endif
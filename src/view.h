@@ -60,7 +60,7 @@ extern "C" {
 typedef struct
 dxf_view_struct
 {
-        int id_code;
+        uint64_t id_code;
                 /*!< Identification number for the entity.\n
                  * This is to be an unique (sequential) number in the DXF
                  * file.\n
@@ -116,11 +116,11 @@ dxf_view_struct
         int mode;
                 /*!< View mode (see \c VIEWMODE system variable).\n
                  * Group code = 71. */
-        char *dictionary_owner_soft;
+        uint64_t dictionary_owner_soft;
                 /*!< Soft-pointer ID/handle to owner dictionary
                  * (optional).\n
                  * Group code = 330. */
-        char *dictionary_owner_hard;
+        uint64_t dictionary_owner_hard;
                 /*!< Hard owner ID/handle to owner dictionary
                  * (optional).\n
                  * Group code = 360. */
@@ -136,8 +136,8 @@ DxfView *dxf_view_read (DxfFile *fp, DxfView *view);
 int dxf_view_write (DxfFile *fp, DxfView *view);
 int dxf_view_free (DxfView *view);
 void dxf_view_free_list (DxfView *views);
-int dxf_view_get_id_code (DxfView *view);
-DxfView *dxf_view_set_id_code (DxfView *view, int id_code);
+uint64_t dxf_view_get_id_code (DxfView *view);
+DxfView *dxf_view_set_id_code (DxfView *view, uint64_t id_code);
 char *dxf_view_get_name (DxfView *view);
 DxfView *dxf_view_set_name (DxfView *view, char *view_name);
 DxfPoint *dxf_view_get_p0 (DxfView *view);
@@ -178,10 +178,10 @@ int dxf_view_get_flag (DxfView *view);
 DxfView *dxf_view_set_flag (DxfView *view, int flag);
 int dxf_view_get_mode (DxfView *view);
 DxfView *dxf_view_set_mode (DxfView *view, int view_mode);
-char *dxf_view_get_dictionary_owner_soft (DxfView *view);
-DxfView *dxf_view_set_dictionary_owner_soft (DxfView *view, char *dictionary_owner_soft);
-char *dxf_view_get_dictionary_owner_hard (DxfView *view);
-DxfView *dxf_view_set_dictionary_owner_hard (DxfView *view, char *dictionary_owner_hard);
+uint64_t dxf_view_get_dictionary_owner_soft (DxfView *view);
+DxfView *dxf_view_set_dictionary_owner_soft (DxfView *view, uint64_t dictionary_owner_soft);
+uint64_t dxf_view_get_dictionary_owner_hard (DxfView *view);
+DxfView *dxf_view_set_dictionary_owner_hard (DxfView *view, uint64_t dictionary_owner_hard);
 DxfView *dxf_view_get_next (DxfView *view);
 DxfView *dxf_view_set_next (DxfView *view, DxfView *next);
 DxfView *dxf_view_get_last (DxfView *view);
@@ -59,7 +59,7 @@ dxf_viewport_new ()
         size = sizeof (DxfViewport);
         /* avoid malloc of 0 bytes */
         if (size == 0) size = 1;
-        if ((viewport = malloc (size)) == NULL)
+        if ((viewport = dxf_malloc (size)) == NULL)
         {
                 fprintf (stderr,
                   (_("Error in %s () could not allocate memory for a DxfViewport struct.\n")),
@@ -109,9 +109,9 @@ dxf_viewport_init
                   __FUNCTION__);
                 return (NULL);
         }
-        viewport->id_code = 0;
-        viewport->linetype = strdup (DXF_DEFAULT_LINETYPE);
-        viewport->layer = strdup (DXF_DEFAULT_LAYER);
+        viewport->id_code = DXF_HANDLE_NONE;
+        viewport->linetype = dxf_strdup (DXF_DEFAULT_LINETYPE);
+        viewport->layer = dxf_strdup (DXF_DEFAULT_LAYER);
         viewport->center = dxf_point_new ();
         viewport->center = dxf_point_init (viewport->center);
         viewport->center->x0 = 0.0;
@@ -127,9 +127,9 @@ dxf_viewport_init
         viewport->id = 1; /* Always 1. */
         viewport->color = DXF_COLOR_BYLAYER;
         viewport->paperspace = DXF_PAPERSPACE; /* Always on PAPERSPACE. */
-        viewport->app_name = strdup ("ACAD"); /* Always "ACAD". */
-        viewport->viewport_data = strdup ("MVIEW"); /* Always "MVIEW". */
-        viewport->window_descriptor_begin = strdup ("{"); /* Always "{". */
+        viewport->app_name = dxf_strdup ("ACAD"); /* Always "ACAD". */
+        viewport->viewport_data = dxf_strdup ("MVIEW"); /* Always "MVIEW". */
+        viewport->window_descriptor_begin = dxf_strdup ("{"); /* Always "{". */
         viewport->extended_entity_data_version = 16;
         viewport->target = dxf_point_new ();
         viewport->target = dxf_point_init (viewport->target);
@@ -172,16 +172,16 @@ dxf_viewport_init
         viewport->grid_spacing->x0 = 0.0;
         viewport->grid_spacing->y0 = 0.0;
         viewport->plot_flag = 0;
-        viewport->frozen_layer_list_begin = strdup ("{"); /* Always "{". */
+        viewport->frozen_layer_list_begin = dxf_strdup ("{"); /* Always "{". */
         viewport->frozen_layers = dxf_char_new ();
         viewport->frozen_layers = dxf_char_init (viewport->frozen_layers);
-        viewport->frozen_layers->value = strdup ("");
+        viewport->frozen_layers->value = dxf_strdup ("");
         viewport->frozen_layers->length = 0;
         viewport->frozen_layers->next = NULL;
-        viewport->frozen_layer_list_end = strdup ("}"); /* Always "}". */
-        viewport->window_descriptor_end = strdup ("}"); /* Always "}". */
-        viewport->dictionary_owner_soft = strdup ("");
-        viewport->dictionary_owner_hard = strdup ("");
+        viewport->frozen_layer_list_end = dxf_strdup ("}"); /* Always "}". */
+        viewport->window_descriptor_end = dxf_strdup ("}"); /* Always "}". */
+        viewport->dictionary_owner_soft = 0;
+        viewport->dictionary_owner_hard = 0;
         viewport->next = NULL;
 #if DEBUG
         DXF_DEBUG_END
@@ -214,7 +214,8 @@ dxf_viewport_read
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        char *temp_string = NULL;
+        char temp_string[DXF_MAX_STRING_LENGTH];
+        int group_code;
         DxfChar *iter = NULL;
 
         /* Do some basic checks. */
@@ -223,8 +224,6 @@ dxf_viewport_read
                 fprintf (stderr,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
-                /* Clean up. */
-                free (temp_string);
                 return (NULL);
         }
         if (viewport == NULL)
@@ -234,781 +233,685 @@ dxf_viewport_read
                   __FUNCTION__);
                 viewport = dxf_viewport_init (viewport);
         }
-        (fp->line_number)++;
-        fscanf (fp->fp, "%[^\n]", temp_string);
-        while (strcmp (temp_string, "0") != 0)
+        while ((dxf_read_group_code (fp, &group_code) == EXIT_SUCCESS)
+          && (group_code != 0))
         {
-                if (ferror (fp->fp))
+                if (dxf_read_error (fp))
                 {
                         fprintf (stderr,
                           (_("Error in %s () while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
-                        fclose (fp->fp);
-                        /* Clean up. */
-                        free (temp_string);
                         return (NULL);
                 }
-                if (strcmp (temp_string, "5") == 0)
-                {
-                        /* Now follows a string containing a sequential
-                         * id number. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%x\n", (uint *) &viewport->id_code);
-                }
-                else if (strcmp (temp_string, "6") == 0)
-                {
-                        /* Now follows a string containing a linetype
-                         * name. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, viewport->linetype);
-                }
-                else if (strcmp (temp_string, "8") == 0)
-                {
-                        /* Now follows a string containing a layer name. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, viewport->layer);
-                }
-                else if (strcmp (temp_string, "10") == 0)
-                {
-                        /* Now follows a string containing the
-                         * X-coordinate of the center point. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &viewport->center->x0);
-                }
-                else if (strcmp (temp_string, "20") == 0)
-                {
-                        /* Now follows a string containing the
-                         * Y-coordinate of the center point. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &viewport->center->y0);
-                }
-                else if (strcmp (temp_string, "30") == 0)
-                {
-                        /* Now follows a string containing the
-                         * Z-coordinate of the center point. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &viewport->center->z0);
-                }
-                else if ((fp->acad_version_number <= AutoCAD_11)
-                        && (strcmp (temp_string, "38") == 0))
-                {
-                        /* Elevation is a pre AutoCAD R11 variable
-                         * so additional testing for the version should
-                         * probably be added.
-                         * Now follows a string containing the
-                         * elevation. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &viewport->elevation);
-                }
-                else if (strcmp (temp_string, "39") == 0)
+                switch (group_code)
                 {
-                        /* Now follows a string containing the
-                         * thickness. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &viewport->thickness);
-                }
-                else if (strcmp (temp_string, "40") == 0)
-                {
-                        /* Now follows a string containing the
-                         * width. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &viewport->width);
-                }
-                else if (strcmp (temp_string, "41") == 0)
-                {
-                        /* Now follows a string containing the
-                         * height. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &viewport->height);
-                }
-                else if (strcmp (temp_string, "48") == 0)
-                {
-                        /* Now follows a string containing the linetype
-                         * scale. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &viewport->linetype_scale);
-                }
-                else if (strcmp (temp_string, "60") == 0)
-                {
-                        /* Now follows a string containing the
-                         * visibility value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%hd\n", &viewport->visibility);
-                }
-                else if (strcmp (temp_string, "62") == 0)
-                {
-                        /* Now follows a string containing the
-                         * color value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%d\n", &viewport->color);
-                }
-                else if (strcmp (temp_string, "67") == 0)
-                {
-                        /* Now follows a string containing the
-                         * paperspace value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%d\n", &viewport->paperspace);
-                }
-                else if (strcmp (temp_string, "68") == 0)
-                {
-                        /* Now follows a string containing the
-                         * status value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%d\n", &viewport->status);
-                }
-                else if (strcmp (temp_string, "69") == 0)
-                {
-                        /* Now follows a string containing the
-                         * id. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%d\n", &viewport->id);
-                }
-                else if (strcmp (temp_string, "999") == 0)
-                {
-                        /* Now follows a string containing a comment. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
-                        fprintf (stdout, "DXF comment: %s\n", temp_string);
-                }
-                else if (strcmp (temp_string, "1001") == 0)
-                {
-                        /* Now follows a sequence of ordered data fields. */
-                        /* Now follows a string containing the appname,
-                         * always "ACAD". */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, viewport->app_name);
-                        if (strcmp (viewport->app_name, "ACAD") == 1)
-                        {
-                                fprintf (stderr,
-                                  (_("Error in %s () while reading from: %s in line: %d.\n")),
-                                  __FUNCTION__, fp->filename, fp->line_number);
-                                fprintf (stderr,
-                                  (_("\tunexpected content in string followed after group code 1001.\n")));
-                                return (NULL);
-                        }
-                        /* Now follows a string containing a group code. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
-                        if (strcmp (temp_string, "1000") == 1)
-                        {
-                                fprintf (stderr,
-                                  (_("Error in %s () while reading from: %s in line: %d.\n")),
-                                  __FUNCTION__, fp->filename, fp->line_number);
-                                fprintf (stderr,
-                                  (_("\tunexpected content in string sequence found.\n")));
-                                return (NULL);
-                        }
-                        /* Now follows a string containing the viewport
-                         * data, always "MVIEW". */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, viewport->viewport_data);
-                        if (strcmp (viewport->viewport_data, "MVIEW") == 1)
-                        {
-                                fprintf (stderr,
-                                  (_("Error in %s () while reading from: %s in line: %d.\n")),
-                                  __FUNCTION__, fp->filename, fp->line_number);
-                                fprintf (stderr,
-                                  (_("\tunexpected content in string.\n")));
-                                return (NULL);
-                        }
-                        /* Now follows a string containing a group code. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
-                        if (strcmp (temp_string, "1002") == 1)
-                        {
-                                fprintf (stderr,
-                                  (_("Error in %s () while reading from: %s in line: %d.\n")),
-                                  __FUNCTION__, fp->filename, fp->line_number);
-                                fprintf (stderr,
-                                  (_("\tunexpected content in string sequence found.\n")));
-                                return (NULL);
-                        }
-                        /* Now follows a string containing the window
-                         * begin descriptor, always "{". */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, viewport->window_descriptor_begin);
-                        if (strcmp (viewport->window_descriptor_begin, "{") == 1)
-                        {
-                                fprintf (stderr,
-                                  (_("Error in %s () while reading from: %s in line: %d.\n")),
-                                  __FUNCTION__, fp->filename, fp->line_number);
-                                fprintf (stderr, "    unexpected content in string.\n");
-                                return (NULL);
-                        }
-                        /* Now follows a string containing a group code. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
-                        if (strcmp (temp_string, "1070") == 1)
-                        {
-                                fprintf (stderr,
-                                  (_("Error in %s () while reading from: %s in line: %d.\n")),
-                                  __FUNCTION__, fp->filename, fp->line_number);
-                                fprintf (stderr,
-                                  (_("\tunexpected content in string sequence found.\n")));
-                                return (NULL);
-                        }
-                        /* Now follows a string containing the extended
-                         * entity data version number. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%d\n", &viewport->extended_entity_data_version);
-                        /* Now follows a string containing a group code. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
-                        if (strcmp (temp_string, "1010") == 1)
-                        {
-                                fprintf (stderr,
-                                  (_("Error in %s () while reading from: %s in line: %d.\n")),
-                                  __FUNCTION__, fp->filename, fp->line_number);
-                                fprintf (stderr,
-                                  (_("\tunexpected content in string sequence found.\n")));
-                                return (NULL);
-                        }
-                        /* Now follows a string containing the X-target. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &viewport->target->x0);
-                        /* Now follows a string containing a group code. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
-                        if (strcmp (temp_string, "1020") == 1)
-                        {
-                                fprintf (stderr,
-                                  (_("Error in %s () while reading from: %s in line: %d.\n")),
-                                  __FUNCTION__, fp->filename, fp->line_number);
-                                fprintf (stderr,
-                                  (_("\tunexpected content in string sequence found.\n")));
-                                return (NULL);
-                        }
-                        /* Now follows a string containing the Y-target. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &viewport->target->y0);
-                        /* Now follows a string containing a group code. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
-                        if (strcmp (temp_string, "1030") == 1)
-                        {
-                                fprintf (stderr,
-                                  (_("Error in %s () while reading from: %s in line: %d.\n")),
-                                  __FUNCTION__, fp->filename, fp->line_number);
-                                fprintf (stderr,
-                                  (_("\tunexpected content in string sequence found.\n")));
-                                return (NULL);
-                        }
-                        /* Now follows a string containing the Z-target. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &viewport->target->z0);
-                        /* Now follows a string containing a group code. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
-                        if (strcmp (temp_string, "1010") == 1)
-                        {
-                                fprintf (stderr,
-                                  (_("Error in %s () while reading from: %s in line: %d.\n")),
-                                  __FUNCTION__, fp->filename, fp->line_number);
-                                fprintf (stderr,
-                                  (_("\tunexpected content in string sequence found.\n")));
-                                return (NULL);
-                        }
-                        /* Now follows a string containing the X-direction. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &viewport->direction->x0);
-                        /* Now follows a string containing a group code. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
-                        if (strcmp (temp_string, "1020") == 1)
-                        {
-                                fprintf (stderr,
-                                  (_("Error in %s () while reading from: %s in line: %d.\n")),
-                                  __FUNCTION__, fp->filename, fp->line_number);
-                                fprintf (stderr,
-                                  (_("\tunexpected content in string sequence found.\n")));
-                                return (NULL);
-                        }
-                        /* Now follows a string containing the Y-direction. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &viewport->direction->y0);
-                        /* Now follows a string containing a group code. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
-                        if (strcmp (temp_string, "1030") == 1)
-                        {
-                                fprintf (stderr,
-                                  (_("Error in %s () while reading from: %s in line: %d.\n")),
-                                  __FUNCTION__, fp->filename, fp->line_number);
-                                fprintf (stderr,
-                                  (_("\tunexpected content in string sequence found.\n")));
-                                return (NULL);
-                        }
-                        /* Now follows a string containing the Z-direction. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &viewport->direction->z0);
-                        /* Now follows a string containing a group code. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
-                        if (strcmp (temp_string, "1040") == 1)
-                        {
-                                fprintf (stderr,
-                                  (_("Error in %s () while reading from: %s in line: %d.\n")),
-                                  __FUNCTION__, fp->filename, fp->line_number);
-                                fprintf (stderr,
-                                  (_("\tunexpected content in string sequence found.\n")));
-                                return (NULL);
-                        }
-                        /* Now follows a string containing the view
-                         * twist angle. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &viewport->view_twist_angle);
-                        /* Now follows a string containing a group code. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
-                        if (strcmp (temp_string, "1040") == 1)
-                        {
-                                fprintf (stderr,
-                                  (_("Error in %s () while reading from: %s in line: %d.\n")),
-                                  __FUNCTION__, fp->filename, fp->line_number);
-                                fprintf (stderr,
-                                  (_("\tunexpected content in string sequence found.\n")));
-                                return (NULL);
-                        }
-                        /* Now follows a string containing the view
-                         * height. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &viewport->view_height);
-                        /* Now follows a string containing a group code. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
-                        if (strcmp (temp_string, "1040") == 1)
-                        {
-                                fprintf (stderr,
-                                  (_("Error in %s () while reading from: %s in line: %d.\n")),
-                                  __FUNCTION__, fp->filename, fp->line_number);
-                                fprintf (stderr,
-                                  (_("\tunexpected content in string sequence found.\n")));
-                                return (NULL);
-                        }
-                        /* Now follows a string containing the
-                         * X-coordinate of the view center point. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &viewport->view_center->x0);
-                        /* Now follows a string containing a group code. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
-                        if (strcmp (temp_string, "1040") == 1)
-                        {
-                                fprintf (stderr,
-                                  (_("Error in %s () while reading from: %s in line: %d.\n")),
-                                  __FUNCTION__, fp->filename, fp->line_number);
-                                fprintf (stderr,
-                                  (_("\tunexpected content in string sequence found.\n")));
-                                return (NULL);
-                        }
-                        /* Now follows a string containing the
-                         * Y-coordinate of the view center point. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &viewport->view_center->y0);
-                        /* Now follows a string containing a group code. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
-                        if (strcmp (temp_string, "1040") == 1)
-                        {
-                                fprintf (stderr,
-                                  (_("Error in %s () while reading from: %s in line: %d.\n")),
-                                  __FUNCTION__, fp->filename, fp->line_number);
-                                fprintf (stderr,
-                                  (_("\tunexpected content in string sequence found.\n")));
-                                return (NULL);
-                        }
-                        /* Now follows a string containing the
-                         * perspective lens length. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &viewport->perspective_lens_length);
-                        /* Now follows a string containing a group code. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
-                        if (strcmp (temp_string, "1040") == 1)
-                        {
-                                fprintf (stderr,
-                                  (_("Error in %s () while reading from: %s in line: %d.\n")),
-                                  __FUNCTION__, fp->filename, fp->line_number);
-                                fprintf (stderr,
-                                  (_("\tunexpected content in string sequence found.\n")));
-                                return (NULL);
-                        }
-                        /* Now follows a string containing the front
-                         * clipping plane offset. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &viewport->front_plane_offset);
-                        /* Now follows a string containing a group code. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
-                        if (strcmp (temp_string, "1040") == 1)
-                        {
-                                fprintf (stderr,
-                                  (_("Error in %s () while reading from: %s in line: %d.\n")),
-                                  __FUNCTION__, fp->filename, fp->line_number);
-                                fprintf (stderr,
-                                  (_("\tunexpected content in string sequence found.\n")));
-                                return (NULL);
-                        }
-                        /* Now follows a string containing the back
-                         * clipping plane offset. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &viewport->back_plane_offset);
-                        /* Now follows a string containing a group code. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
-                        if (strcmp (temp_string, "1070") == 1)
-                        {
-                                fprintf (stderr,
-                                  (_("Error in %s () while reading from: %s in line: %d.\n")),
-                                  __FUNCTION__, fp->filename, fp->line_number);
-                                fprintf (stderr,
-                                  (_("\tunexpected content in string sequence found.\n")));
-                                return (NULL);
-                        }
-                        /* Now follows a string containing the view mode. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%d\n", &viewport->view_mode);
-                        /* Now follows a string containing a group code. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
-                        if (strcmp (temp_string, "1070") == 1)
-                        {
-                                fprintf (stderr,
-                                  (_("Error in %s () while reading from: %s in line: %d.\n")),
-                                  __FUNCTION__, fp->filename, fp->line_number);
-                                fprintf (stderr,
-                                  (_("\tunexpected content in string sequence found.\n")));
-                                return (NULL);
-                        }
-                        /* Now follows a string containing the circle
-                         * zoom percent. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%d\n", &viewport->circle_zoom_percent);
-                        /* Now follows a string containing a group code. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
-                        if (strcmp (temp_string, "1070") == 1)
-                        {
-                                fprintf (stderr,
-                                  (_("Error in %s () while reading from: %s in line: %d.\n")),
-                                  __FUNCTION__, fp->filename, fp->line_number);
-                                fprintf (stderr,
-                                  (_("\tunexpected content in string sequence found.\n")));
-                                return (NULL);
-                        }
-                        /* Now follows a string containing the fast zoom
-                         * setting. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%d\n", &viewport->fast_zoom_setting);
-                        /* Now follows a string containing a group code. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
-                        if (strcmp (temp_string, "1070") == 1)
-                        {
-                                fprintf (stderr,
-                                  (_("Error in %s () while reading from: %s in line: %d.\n")),
-                                  __FUNCTION__, fp->filename, fp->line_number);
-                                fprintf (stderr,
-                                  (_("\tunexpected content in string sequence found.\n")));
-                                return (NULL);
-                        }
-                        /* Now follows a string containing the ICS ICON
-                         * setting. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%d\n", &viewport->UCSICON_setting);
-                        /* Now follows a string containing a group code. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
-                        if (strcmp (temp_string, "1070") == 1)
-                        {
-                                fprintf (stderr,
-                                  (_("Error in %s () while reading from: %s in line: %d.\n")),
-                                  __FUNCTION__, fp->filename, fp->line_number);
-                                fprintf (stderr,
-                                  (_("\tunexpected content in string sequence found.\n")));
-                                return (NULL);
-                        }
-                        /* Now follows a string containing the snap on
-                         * setting. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%d\n", &viewport->snap_on);
-                        /* Now follows a string containing a group code. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
-                        if (strcmp (temp_string, "1070") == 1)
-                        {
-                                fprintf (stderr,
-                                  (_("Error in %s () while reading from: %s in line: %d.\n")),
-                                  __FUNCTION__, fp->filename, fp->line_number);
-                                fprintf (stderr,
-                                  (_("\tunexpected content in string sequence found.\n")));
-                                return (NULL);
-                        }
-                        /* Now follows a string containing the grid on
-                         * setting. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%d\n", &viewport->grid_on);
-                        /* Now follows a string containing a group code. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
-                        if (strcmp (temp_string, "1070") == 1)
-                        {
-                                fprintf (stderr,
-                                  (_("Error in %s () while reading from: %s in line: %d.\n")),
-                                  __FUNCTION__, fp->filename, fp->line_number);
-                                fprintf (stderr,
-                                  (_("\tunexpected content in string sequence found.\n")));
-                                return (NULL);
-                        }
-                        /* Now follows a string containing the snap
-                         * style setting. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%d\n", &viewport->snap_style);
-                        /* Now follows a string containing a group code. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
-                        if (strcmp (temp_string, "1070") == 1)
-                        {
-                                fprintf (stderr,
-                                  (_("Error in %s () while reading from: %s in line: %d.\n")),
-                                  __FUNCTION__, fp->filename, fp->line_number);
-                                fprintf (stderr,
-                                  (_("\tunexpected content in string sequence found.\n")));
-                                return (NULL);
-                        }
-                        /* Now follows a string containing the snap
-                         * isopair setting. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%d\n", &viewport->snap_isopair);
-                        /* Now follows a string containing a group code. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
-                        if (strcmp (temp_string, "1040") == 1)
-                        {
-                                fprintf (stderr,
-                                  (_("Error in %s () while reading from: %s in line: %d.\n")),
-                                  __FUNCTION__, fp->filename, fp->line_number);
-                                fprintf (stderr,
-                                  (_("\tunexpected content in string sequence found.\n")));
-                                return (NULL);
-                        }
-                        /* Now follows a string containing the snap
-                         * rotation angle. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &viewport->snap_rotation_angle);
-                        /* Now follows a string containing a group code. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
-                        if (strcmp (temp_string, "1040") == 1)
-                        {
-                                fprintf (stderr,
-                                  (_("Error in %s () while reading from: %s in line: %d.\n")),
-                                  __FUNCTION__, fp->filename, fp->line_number);
-                                fprintf (stderr,
-                                  (_("\tunexpected content in string sequence found.\n")));
-                                return (NULL);
-                        }
-                        /* Now follows a string containing the X snap
-                         * base. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &viewport->snap_base->x0);
-                        /* Now follows a string containing a group code. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
-                        if (strcmp (temp_string, "1040") == 1)
-                        {
-                                fprintf (stderr,
-                                  (_("Error in %s () while reading from: %s in line: %d.\n")),
-                                  __FUNCTION__, fp->filename, fp->line_number);
-                                fprintf (stderr,
-                                  (_("\tunexpected content in string sequence found.\n")));
-                                return (NULL);
-                        }
-                        /* Now follows a string containing the Y snap
-                         * base. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &viewport->snap_base->y0);
-                        /* Now follows a string containing a group code. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
-                        if (strcmp (temp_string, "1040") == 1)
-                        {
-                                fprintf (stderr,
-                                  (_("Error in %s () while reading from: %s in line: %d.\n")),
-                                  __FUNCTION__, fp->filename, fp->line_number);
-                                fprintf (stderr,
-                                  (_("\tunexpected content in string sequence found.\n")));
-                                return (NULL);
-                        }
-                        /* Now follows a string containing the X snap
-                         * spacing. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &viewport->snap_spacing->x0);
-                        /* Now follows a string containing a group code. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
-                        if (strcmp (temp_string, "1040") == 1)
-                        {
-                                fprintf (stderr,
-                                  (_("Error in %s () while reading from: %s in line: %d.\n")),
-                                  __FUNCTION__, fp->filename, fp->line_number);
-                                fprintf (stderr,
-                                  (_("\tunexpected content in string sequence found.\n")));
-                                return (NULL);
-                        }
-                        /* Now follows a string containing the Y snap
-                         * spacing. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &viewport->snap_spacing->y0);
-                        /* Now follows a string containing a group code. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
-                        if (strcmp (temp_string, "1070") == 1)
-                        {
-                                fprintf (stderr,
-                                  (_("Error in %s () while reading from: %s in line: %d.\n")),
-                                  __FUNCTION__, fp->filename, fp->line_number);
-                                fprintf (stderr,
-                                  (_("\tunexpected content in string sequence found.\n")));
-                                return (NULL);
-                        }
-                        /* Now follows a string containing the plot flag. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%d\n", &viewport->plot_flag);
-                        /* Now follows a string containing a group code. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
-                        if (strcmp (temp_string, "1002") == 1)
-                        {
-                                fprintf (stderr,
-                                  (_("Error in %s () while reading from: %s in line: %d.\n")),
-                                  __FUNCTION__, fp->filename, fp->line_number);
-                                fprintf (stderr,
-                                  (_("\tunexpected content in string sequence found.\n")));
-                                return (NULL);
-                        }
-                        /* Now follows a string containing the frozen
-                         * layer list begin descriptor, always "{". */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, viewport->frozen_layer_list_begin);
-                        if (strcmp (viewport->frozen_layer_list_begin, "{") == 1)
-                        {
-                                fprintf (stderr,
-                                  (_("Error in %s () while reading from: %s in line: %d.\n")),
-                                  __FUNCTION__, fp->filename, fp->line_number);
-                                fprintf (stderr,
-                                  (_("\tunexpected content in string.\n")));
-                                return (NULL);
-                        }
-                        /* Now follows a string containing a group code
-                         * value of "1003". */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
-                        if (strcmp (temp_string, "1003") == 0)
-                        {
-                                /* Start a loop reading all frozen layer
-                                 * names and bail out when a group code
-                                 * with a value of "1002" is encountered.*/
-                                /*! \todo Do a proper implementation of reading frozen layers.*/
-                                iter = (DxfChar *) viewport->frozen_layers;
-                                do
+                        case 5:
+                                /* Now follows a string containing a sequential
+                                 * id number. */
+                                dxf_read_handle (fp, &viewport->id_code);
+                                break;
+                        case 6:
+                                /* Now follows a string containing a linetype
+                                 * name. */
+                                dxf_read_string_interned (fp, &viewport->linetype);
+                                break;
+                        case 8:
+                                /* Now follows a string containing a layer name. */
+                                dxf_read_string_interned (fp, &viewport->layer);
+                                break;
+                        case 10:
+                                /* Now follows a string containing the
+                                 * X-coordinate of the center point. */
+                                dxf_read_double (fp, &viewport->center->x0);
+                                break;
+                        case 20:
+                                /* Now follows a string containing the
+                                 * Y-coordinate of the center point. */
+                                dxf_read_double (fp, &viewport->center->y0);
+                                break;
+                        case 30:
+                                /* Now follows a string containing the
+                                 * Z-coordinate of the center point. */
+                                dxf_read_double (fp, &viewport->center->z0);
+                                break;
+                        case 38:
+                                if (fp->acad_version_number <= AutoCAD_11)
                                 {
-                                        (fp->line_number)++;
-                                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, iter->value);
-                                        /* Now follows a string containing a group code. */
-                                        (fp->line_number)++;
-                                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
-                                        iter->next = (DxfChar *) dxf_char_init ((DxfChar *) iter->next);
-                                        iter = (DxfChar *) iter->next;
+                                        /* Elevation is a pre AutoCAD R11 variable
+                                         * so additional testing for the version should
+                                         * probably be added.
+                                         * Now follows a string containing the
+                                         * elevation. */
+                                        dxf_read_double (fp, &viewport->elevation);
                                 }
-                                while ((strcmp (temp_string, "1003") == 0));
-                                /* We have initialised the next DxfChar
-                                 * and then left the loop.
-                                 * The next DxfChar contains no valid
-                                 * value, so we have to clean up. */
-                                dxf_char_free ((DxfChar *) iter->next);
-                                iter->next = NULL;
-                        }
-                        else
-                        {
-                                /* Either we found an empty list or we
-                                 * have found an exception. */
-                                fprintf (stderr,
-                                  (_("Error in %s () while reading from: %s in line: %d.\n")),
-                                  __FUNCTION__, fp->filename, fp->line_number);
-                                fprintf (stderr,
-                                  (_("\tunexpected end of frozen layer list found.\n")));
-                                return (NULL);
-                        }
-                        /* Now we are expecting temp_string to contain a
-                         * group code value of "1002". */
-                        if (strcmp (temp_string, "1002") == 1)
-                        {
-                                fprintf (stderr,
-                                  (_("Error in %s () while reading from: %s in line: %d.\n")),
-                                  __FUNCTION__, fp->filename, fp->line_number);
-                                fprintf (stderr,
-                                  (_("\tunexpected content in string sequence found.\n")));
-                                return (NULL);
-                        }
-                        /* Now follows a string containing the frozen
-                         * layer list end descriptor, always "}". */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, viewport->frozen_layer_list_end);
-                        if (strcmp (viewport->frozen_layer_list_end, "}") == 1)
-                        {
-                                fprintf (stderr,
-                                  (_("Error in %s () while reading from: %s in line: %d.\n")),
-                                  __FUNCTION__, fp->filename, fp->line_number);
-                                fprintf (stderr,
-                                  (_("\tunexpected content in string.\n")));
-                                return (NULL);
-                        }
-                        /* Now follows a string containing a group code. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
-                        if (strcmp (temp_string, "1002") == 1)
-                        {
-                                fprintf (stderr,
-                                  (_("Error in %s () while reading from: %s in line: %d.\n")),
-                                  __FUNCTION__, fp->filename, fp->line_number);
-                                fprintf (stderr,
-                                  (_("\tunexpected content in string sequence found.\n")));
-                                return (NULL);
-                        }
-                        /* Now follows a string containing the window
-                         * end descriptor, always "}". */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, viewport->window_descriptor_end);
-                        if (strcmp (viewport->window_descriptor_end, "}") == 1)
-                        {
+                                else
+                                {
+                                        fprintf (stderr,
+                                          (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
+                                          __FUNCTION__, fp->filename, fp->line_number);
+                                        /* Skip the value of the unknown group code. */
+                                        dxf_read_line (temp_string, fp);
+                                }
+                                break;
+                        case 39:
+                                /* Now follows a string containing the
+                                 * thickness. */
+                                dxf_read_double (fp, &viewport->thickness);
+                                break;
+                        case 40:
+                                /* Now follows a string containing the
+                                 * width. */
+                                dxf_read_double (fp, &viewport->width);
+                                break;
+                        case 41:
+                                /* Now follows a string containing the
+                                 * height. */
+                                dxf_read_double (fp, &viewport->height);
+                                break;
+                        case 48:
+                                /* Now follows a string containing the linetype
+                                 * scale. */
+                                dxf_read_double (fp, &viewport->linetype_scale);
+                                break;
+                        case 60:
+                                /* Now follows a string containing the
+                                 * visibility value. */
+                                dxf_read_int16 (fp, &viewport->visibility);
+                                break;
+                        case 62:
+                                /* Now follows a string containing the
+                                 * color value. */
+                                dxf_read_int (fp, &viewport->color);
+                                break;
+                        case 67:
+                                /* Now follows a string containing the
+                                 * paperspace value. */
+                                dxf_read_int (fp, &viewport->paperspace);
+                                break;
+                        case 68:
+                                /* Now follows a string containing the
+                                 * status value. */
+                                dxf_read_int (fp, &viewport->status);
+                                break;
+                        case 69:
+                                /* Now follows a string containing the
+                                 * id. */
+                                dxf_read_int (fp, &viewport->id);
+                                break;
+                        case 999:
+                                /* Now follows a string containing a comment. */
+                                dxf_read_line (temp_string, fp);
+                                fprintf (stdout, "DXF comment: %s\n", temp_string);
+                                break;
+                        case 1001:
+                                /* Now follows a sequence of ordered data fields. */
+                                /* Now follows a string containing the appname,
+                                 * always "ACAD". */
+                                dxf_read_string (fp, &viewport->app_name);
+                                if (strcmp (viewport->app_name, "ACAD") == 1)
+                                {
+                                        fprintf (stderr,
+                                          (_("Error in %s () while reading from: %s in line: %d.\n")),
+                                          __FUNCTION__, fp->filename, fp->line_number);
+                                        fprintf (stderr,
+                                          (_("\tunexpected content in string followed after group code 1001.\n")));
+                                        return (NULL);
+                                }
+                                /* Now follows a string containing a group code. */
+                                dxf_read_group_code (fp, &group_code);
+                                if (group_code != 1000)
+                                {
+                                        fprintf (stderr,
+                                          (_("Error in %s () while reading from: %s in line: %d.\n")),
+                                          __FUNCTION__, fp->filename, fp->line_number);
+                                        fprintf (stderr,
+                                          (_("\tunexpected content in string sequence found.\n")));
+                                        return (NULL);
+                                }
+                                /* Now follows a string containing the viewport
+                                 * data, always "MVIEW". */
+                                dxf_read_string (fp, &viewport->viewport_data);
+                                if (strcmp (viewport->viewport_data, "MVIEW") == 1)
+                                {
+                                        fprintf (stderr,
+                                          (_("Error in %s () while reading from: %s in line: %d.\n")),
+                                          __FUNCTION__, fp->filename, fp->line_number);
+                                        fprintf (stderr,
+                                          (_("\tunexpected content in string.\n")));
+                                        return (NULL);
+                                }
+                                /* Now follows a string containing a group code. */
+                                dxf_read_group_code (fp, &group_code);
+                                if (group_code != 1002)
+                                {
+                                        fprintf (stderr,
+                                          (_("Error in %s () while reading from: %s in line: %d.\n")),
+                                          __FUNCTION__, fp->filename, fp->line_number);
+                                        fprintf (stderr,
+                                          (_("\tunexpected content in string sequence found.\n")));
+                                        return (NULL);
+                                }
+                                /* Now follows a string containing the window
+                                 * begin descriptor, always "{". */
+                                dxf_read_string (fp, &viewport->window_descriptor_begin);
+                                if (strcmp (viewport->window_descriptor_begin, "{") == 1)
+                                {
+                                        fprintf (stderr,
+                                          (_("Error in %s () while reading from: %s in line: %d.\n")),
+                                          __FUNCTION__, fp->filename, fp->line_number);
+                                        fprintf (stderr, "    unexpected content in string.\n");
+                                        return (NULL);
+                                }
+                                /* Now follows a string containing a group code. */
+                                dxf_read_group_code (fp, &group_code);
+                                if (group_code != 1070)
+                                {
+                                        fprintf (stderr,
+                                          (_("Error in %s () while reading from: %s in line: %d.\n")),
+                                          __FUNCTION__, fp->filename, fp->line_number);
+                                        fprintf (stderr,
+                                          (_("\tunexpected content in string sequence found.\n")));
+                                        return (NULL);
+                                }
+                                /* Now follows a string containing the extended
+                                 * entity data version number. */
+                                dxf_read_int (fp, &viewport->extended_entity_data_version);
+                                /* Now follows a string containing a group code. */
+                                dxf_read_group_code (fp, &group_code);
+                                if (group_code != 1010)
+                                {
+                                        fprintf (stderr,
+                                          (_("Error in %s () while reading from: %s in line: %d.\n")),
+                                          __FUNCTION__, fp->filename, fp->line_number);
+                                        fprintf (stderr,
+                                          (_("\tunexpected content in string sequence found.\n")));
+                                        return (NULL);
+                                }
+                                /* Now follows a string containing the X-target. */
+                                dxf_read_double (fp, &viewport->target->x0);
+                                /* Now follows a string containing a group code. */
+                                dxf_read_group_code (fp, &group_code);
+                                if (group_code != 1020)
+                                {
+                                        fprintf (stderr,
+                                          (_("Error in %s () while reading from: %s in line: %d.\n")),
+                                          __FUNCTION__, fp->filename, fp->line_number);
+                                        fprintf (stderr,
+                                          (_("\tunexpected content in string sequence found.\n")));
+                                        return (NULL);
+                                }
+                                /* Now follows a string containing the Y-target. */
+                                dxf_read_double (fp, &viewport->target->y0);
+                                /* Now follows a string containing a group code. */
+                                dxf_read_group_code (fp, &group_code);
+                                if (group_code != 1030)
+                                {
+                                        fprintf (stderr,
+                                          (_("Error in %s () while reading from: %s in line: %d.\n")),
+                                          __FUNCTION__, fp->filename, fp->line_number);
+                                        fprintf (stderr,
+                                          (_("\tunexpected content in string sequence found.\n")));
+                                        return (NULL);
+                                }
+                                /* Now follows a string containing the Z-target. */
+                                dxf_read_double (fp, &viewport->target->z0);
+                                /* Now follows a string containing a group code. */
+                                dxf_read_group_code (fp, &group_code);
+                                if (group_code != 1010)
+                                {
+                                        fprintf (stderr,
+                                          (_("Error in %s () while reading from: %s in line: %d.\n")),
+                                          __FUNCTION__, fp->filename, fp->line_number);
+                                        fprintf (stderr,
+                                          (_("\tunexpected content in string sequence found.\n")));
+                                        return (NULL);
+                                }
+                                /* Now follows a string containing the X-direction. */
+                                dxf_read_double (fp, &viewport->direction->x0);
+                                /* Now follows a string containing a group code. */
+                                dxf_read_group_code (fp, &group_code);
+                                if (group_code != 1020)
+                                {
+                                        fprintf (stderr,
+                                          (_("Error in %s () while reading from: %s in line: %d.\n")),
+                                          __FUNCTION__, fp->filename, fp->line_number);
+                                        fprintf (stderr,
+                                          (_("\tunexpected content in string sequence found.\n")));
+                                        return (NULL);
+                                }
+                                /* Now follows a string containing the Y-direction. */
+                                dxf_read_double (fp, &viewport->direction->y0);
+                                /* Now follows a string containing a group code. */
+                                dxf_read_group_code (fp, &group_code);
+                                if (group_code != 1030)
+                                {
+                                        fprintf (stderr,
+                                          (_("Error in %s () while reading from: %s in line: %d.\n")),
+                                          __FUNCTION__, fp->filename, fp->line_number);
+                                        fprintf (stderr,
+                                          (_("\tunexpected content in string sequence found.\n")));
+                                        return (NULL);
+                                }
+                                /* Now follows a string containing the Z-direction. */
+                                dxf_read_double (fp, &viewport->direction->z0);
+                                /* Now follows a string containing a group code. */
+                                dxf_read_group_code (fp, &group_code);
+                                if (group_code != 1040)
+                                {
+                                        fprintf (stderr,
+                                          (_("Error in %s () while reading from: %s in line: %d.\n")),
+                                          __FUNCTION__, fp->filename, fp->line_number);
+                                        fprintf (stderr,
+                                          (_("\tunexpected content in string sequence found.\n")));
+                                        return (NULL);
+                                }
+                                /* Now follows a string containing the view
+                                 * twist angle. */
+                                dxf_read_double (fp, &viewport->view_twist_angle);
+                                /* Now follows a string containing a group code. */
+                                dxf_read_group_code (fp, &group_code);
+                                if (group_code != 1040)
+                                {
+                                        fprintf (stderr,
+                                          (_("Error in %s () while reading from: %s in line: %d.\n")),
+                                          __FUNCTION__, fp->filename, fp->line_number);
+                                        fprintf (stderr,
+                                          (_("\tunexpected content in string sequence found.\n")));
+                                        return (NULL);
+                                }
+                                /* Now follows a string containing the view
+                                 * height. */
+                                dxf_read_double (fp, &viewport->view_height);
+                                /* Now follows a string containing a group code. */
+                                dxf_read_group_code (fp, &group_code);
+                                if (group_code != 1040)
+                                {
+                                        fprintf (stderr,
+                                          (_("Error in %s () while reading from: %s in line: %d.\n")),
+                                          __FUNCTION__, fp->filename, fp->line_number);
+                                        fprintf (stderr,
+                                          (_("\tunexpected content in string sequence found.\n")));
+                                        return (NULL);
+                                }
+                                /* Now follows a string containing the
+                                 * X-coordinate of the view center point. */
+                                dxf_read_double (fp, &viewport->view_center->x0);
+                                /* Now follows a string containing a group code. */
+                                dxf_read_group_code (fp, &group_code);
+                                if (group_code != 1040)
+                                {
+                                        fprintf (stderr,
+                                          (_("Error in %s () while reading from: %s in line: %d.\n")),
+                                          __FUNCTION__, fp->filename, fp->line_number);
+                                        fprintf (stderr,
+                                          (_("\tunexpected content in string sequence found.\n")));
+                                        return (NULL);
+                                }
+                                /* Now follows a string containing the
+                                 * Y-coordinate of the view center point. */
+                                dxf_read_double (fp, &viewport->view_center->y0);
+                                /* Now follows a string containing a group code. */
+                                dxf_read_group_code (fp, &group_code);
+                                if (group_code != 1040)
+                                {
+                                        fprintf (stderr,
+                                          (_("Error in %s () while reading from: %s in line: %d.\n")),
+                                          __FUNCTION__, fp->filename, fp->line_number);
+                                        fprintf (stderr,
+                                          (_("\tunexpected content in string sequence found.\n")));
+                                        return (NULL);
+                                }
+                                /* Now follows a string containing the
+                                 * perspective lens length. */
+                                dxf_read_double (fp, &viewport->perspective_lens_length);
+                                /* Now follows a string containing a group code. */
+                                dxf_read_group_code (fp, &group_code);
+                                if (group_code != 1040)
+                                {
+                                        fprintf (stderr,
+                                          (_("Error in %s () while reading from: %s in line: %d.\n")),
+                                          __FUNCTION__, fp->filename, fp->line_number);
+                                        fprintf (stderr,
+                                          (_("\tunexpected content in string sequence found.\n")));
+                                        return (NULL);
+                                }
+                                /* Now follows a string containing the front
+                                 * clipping plane offset. */
+                                dxf_read_double (fp, &viewport->front_plane_offset);
+                                /* Now follows a string containing a group code. */
+                                dxf_read_group_code (fp, &group_code);
+                                if (group_code != 1040)
+                                {
+                                        fprintf (stderr,
+                                          (_("Error in %s () while reading from: %s in line: %d.\n")),
+                                          __FUNCTION__, fp->filename, fp->line_number);
+                                        fprintf (stderr,
+                                          (_("\tunexpected content in string sequence found.\n")));
+                                        return (NULL);
+                                }
+                                /* Now follows a string containing the back
+                                 * clipping plane offset. */
+                                dxf_read_double (fp, &viewport->back_plane_offset);
+                                /* Now follows a string containing a group code. */
+                                dxf_read_group_code (fp, &group_code);
+                                if (group_code != 1070)
+                                {
+                                        fprintf (stderr,
+                                          (_("Error in %s () while reading from: %s in line: %d.\n")),
+                                          __FUNCTION__, fp->filename, fp->line_number);
+                                        fprintf (stderr,
+                                          (_("\tunexpected content in string sequence found.\n")));
+                                        return (NULL);
+                                }
+                                /* Now follows a string containing the view mode. */
+                                dxf_read_int (fp, &viewport->view_mode);
+                                /* Now follows a string containing a group code. */
+                                dxf_read_group_code (fp, &group_code);
+                                if (group_code != 1070)
+                                {
+                                        fprintf (stderr,
+                                          (_("Error in %s () while reading from: %s in line: %d.\n")),
+                                          __FUNCTION__, fp->filename, fp->line_number);
+                                        fprintf (stderr,
+                                          (_("\tunexpected content in string sequence found.\n")));
+                                        return (NULL);
+                                }
+                                /* Now follows a string containing the circle
+                                 * zoom percent. */
+                                dxf_read_int (fp, &viewport->circle_zoom_percent);
+                                /* Now follows a string containing a group code. */
+                                dxf_read_group_code (fp, &group_code);
+                                if (group_code != 1070)
+                                {
+                                        fprintf (stderr,
+                                          (_("Error in %s () while reading from: %s in line: %d.\n")),
+                                          __FUNCTION__, fp->filename, fp->line_number);
+                                        fprintf (stderr,
+                                          (_("\tunexpected content in string sequence found.\n")));
+                                        return (NULL);
+                                }
+                                /* Now follows a string containing the fast zoom
+                                 * setting. */
+                                dxf_read_int (fp, &viewport->fast_zoom_setting);
+                                /* Now follows a string containing a group code. */
+                                dxf_read_group_code (fp, &group_code);
+                                if (group_code != 1070)
+                                {
+                                        fprintf (stderr,
+                                          (_("Error in %s () while reading from: %s in line: %d.\n")),
+                                          __FUNCTION__, fp->filename, fp->line_number);
+                                        fprintf (stderr,
+                                          (_("\tunexpected content in string sequence found.\n")));
+                                        return (NULL);
+                                }
+                                /* Now follows a string containing the ICS ICON
+                                 * setting. */
+                                dxf_read_int (fp, &viewport->UCSICON_setting);
+                                /* Now follows a string containing a group code. */
+                                dxf_read_group_code (fp, &group_code);
+                                if (group_code != 1070)
+                                {
+                                        fprintf (stderr,
+                                          (_("Error in %s () while reading from: %s in line: %d.\n")),
+                                          __FUNCTION__, fp->filename, fp->line_number);
+                                        fprintf (stderr,
+                                          (_("\tunexpected content in string sequence found.\n")));
+                                        return (NULL);
+                                }
+                                /* Now follows a string containing the snap on
+                                 * setting. */
+                                dxf_read_int (fp, &viewport->snap_on);
+                                /* Now follows a string containing a group code. */
+                                dxf_read_group_code (fp, &group_code);
+                                if (group_code != 1070)
+                                {
+                                        fprintf (stderr,
+                                          (_("Error in %s () while reading from: %s in line: %d.\n")),
+                                          __FUNCTION__, fp->filename, fp->line_number);
+                                        fprintf (stderr,
+                                          (_("\tunexpected content in string sequence found.\n")));
+                                        return (NULL);
+                                }
+                                /* Now follows a string containing the grid on
+                                 * setting. */
+                                dxf_read_int (fp, &viewport->grid_on);
+                                /* Now follows a string containing a group code. */
+                                dxf_read_group_code (fp, &group_code);
+                                if (group_code != 1070)
+                                {
+                                        fprintf (stderr,
+                                          (_("Error in %s () while reading from: %s in line: %d.\n")),
+                                          __FUNCTION__, fp->filename, fp->line_number);
+                                        fprintf (stderr,
+                                          (_("\tunexpected content in string sequence found.\n")));
+                                        return (NULL);
+                                }
+                                /* Now follows a string containing the snap
+                                 * style setting. */
+                                dxf_read_int (fp, &viewport->snap_style);
+                                /* Now follows a string containing a group code. */
+                                dxf_read_group_code (fp, &group_code);
+                                if (group_code != 1070)
+                                {
+                                        fprintf (stderr,
+                                          (_("Error in %s () while reading from: %s in line: %d.\n")),
+                                          __FUNCTION__, fp->filename, fp->line_number);
+                                        fprintf (stderr,
+                                          (_("\tunexpected content in string sequence found.\n")));
+                                        return (NULL);
+                                }
+                                /* Now follows a string containing the snap
+                                 * isopair setting. */
+                                dxf_read_int (fp, &viewport->snap_isopair);
+                                /* Now follows a string containing a group code. */
+                                dxf_read_group_code (fp, &group_code);
+                                if (group_code != 1040)
+                                {
+                                        fprintf (stderr,
+                                          (_("Error in %s () while reading from: %s in line: %d.\n")),
+                                          __FUNCTION__, fp->filename, fp->line_number);
+                                        fprintf (stderr,
+                                          (_("\tunexpected content in string sequence found.\n")));
+                                        return (NULL);
+                                }
+                                /* Now follows a string containing the snap
+                                 * rotation angle. */
+                                dxf_read_double (fp, &viewport->snap_rotation_angle);
+                                /* Now follows a string containing a group code. */
+                                dxf_read_group_code (fp, &group_code);
+                                if (group_code != 1040)
+                                {
+                                        fprintf (stderr,
+                                          (_("Error in %s () while reading from: %s in line: %d.\n")),
+                                          __FUNCTION__, fp->filename, fp->line_number);
+                                        fprintf (stderr,
+                                          (_("\tunexpected content in string sequence found.\n")));
+                                        return (NULL);
+                                }
+                                /* Now follows a string containing the X snap
+                                 * base. */
+                                dxf_read_double (fp, &viewport->snap_base->x0);
+                                /* Now follows a string containing a group code. */
+                                dxf_read_group_code (fp, &group_code);
+                                if (group_code != 1040)
+                                {
+                                        fprintf (stderr,
+                                          (_("Error in %s () while reading from: %s in line: %d.\n")),
+                                          __FUNCTION__, fp->filename, fp->line_number);
+                                        fprintf (stderr,
+                                          (_("\tunexpected content in string sequence found.\n")));
+                                        return (NULL);
+                                }
+                                /* Now follows a string containing the Y snap
+                                 * base. */
+                                dxf_read_double (fp, &viewport->snap_base->y0);
+                                /* Now follows a string containing a group code. */
+                                dxf_read_group_code (fp, &group_code);
+                                if (group_code != 1040)
+                                {
+                                        fprintf (stderr,
+                                          (_("Error in %s () while reading from: %s in line: %d.\n")),
+                                          __FUNCTION__, fp->filename, fp->line_number);
+                                        fprintf (stderr,
+                                          (_("\tunexpected content in string sequence found.\n")));
+                                        return (NULL);
+                                }
+                                /* Now follows a string containing the X snap
+                                 * spacing. */
+                                dxf_read_double (fp, &viewport->snap_spacing->x0);
+                                /* Now follows a string containing a group code. */
+                                dxf_read_group_code (fp, &group_code);
+                                if (group_code != 1040)
+                                {
+                                        fprintf (stderr,
+                                          (_("Error in %s () while reading from: %s in line: %d.\n")),
+                                          __FUNCTION__, fp->filename, fp->line_number);
+                                        fprintf (stderr,
+                                          (_("\tunexpected content in string sequence found.\n")));
+                                        return (NULL);
+                                }
+                                /* Now follows a string containing the Y snap
+                                 * spacing. */
+                                dxf_read_double (fp, &viewport->snap_spacing->y0);
+                                /* Now follows a string containing a group code. */
+                                dxf_read_group_code (fp, &group_code);
+                                if (group_code != 1070)
+                                {
+                                        fprintf (stderr,
+                                          (_("Error in %s () while reading from: %s in line: %d.\n")),
+                                          __FUNCTION__, fp->filename, fp->line_number);
+                                        fprintf (stderr,
+                                          (_("\tunexpected content in string sequence found.\n")));
+                                        return (NULL);
+                                }
+                                /* Now follows a string containing the plot flag. */
+                                dxf_read_int (fp, &viewport->plot_flag);
+                                /* Now follows a string containing a group code. */
+                                dxf_read_group_code (fp, &group_code);
+                                if (group_code != 1002)
+                                {
+                                        fprintf (stderr,
+                                          (_("Error in %s () while reading from: %s in line: %d.\n")),
+                                          __FUNCTION__, fp->filename, fp->line_number);
+                                        fprintf (stderr,
+                                          (_("\tunexpected content in string sequence found.\n")));
+                                        return (NULL);
+                                }
+                                /* Now follows a string containing the frozen
+                                 * layer list begin descriptor, always "{". */
+                                dxf_read_string (fp, &viewport->frozen_layer_list_begin);
+                                if (strcmp (viewport->frozen_layer_list_begin, "{") == 1)
+                                {
+                                        fprintf (stderr,
+                                          (_("Error in %s () while reading from: %s in line: %d.\n")),
+                                          __FUNCTION__, fp->filename, fp->line_number);
+                                        fprintf (stderr,
+                                          (_("\tunexpected content in string.\n")));
+                                        return (NULL);
+                                }
+                                /* Now follows a string containing a group code
+                                 * value of "1003". */
+                                dxf_read_group_code (fp, &group_code);
+                                if (group_code == 1003)
+                                {
+                                        /* Start a loop reading all frozen layer
+                                         * names and bail out when a group code
+                                         * with a value of "1002" is encountered.*/
+                                        /*! \todo Do a proper implementation of reading frozen layers.*/
+                                        iter = (DxfChar *) viewport->frozen_layers;
+                                        do
+                                        {
+                                                dxf_read_string (fp, &iter->value);
+                                                /* Now follows a string containing a group code. */
+                                                dxf_read_group_code (fp, &group_code);
+                                                iter->next = (DxfChar *) dxf_char_init ((DxfChar *) iter->next);
+                                                iter = (DxfChar *) iter->next;
+                                        }
+                                        while ((group_code == 1003));
+                                        /* We have initialised the next DxfChar
+                                         * and then left the loop.
+                                         * The next DxfChar contains no valid
+                                         * value, so we have to clean up. */
+                                        dxf_char_free ((DxfChar *) iter->next);
+                                        iter->next = NULL;
+                                }
+                                else
+                                {
+                                        /* Either we found an empty list or we
+                                         * have found an exception. */
+                                        fprintf (stderr,
+                                          (_("Error in %s () while reading from: %s in line: %d.\n")),
+                                          __FUNCTION__, fp->filename, fp->line_number);
+                                        fprintf (stderr,
+                                          (_("\tunexpected end of frozen layer list found.\n")));
+                                        return (NULL);
+                                }
+                                /* Now we are expecting group_code to contain a
+                                 * group code value of "1002". */
+                                if (group_code != 1002)
+                                {
+                                        fprintf (stderr,
+                                          (_("Error in %s () while reading from: %s in line: %d.\n")),
+                                          __FUNCTION__, fp->filename, fp->line_number);
+                                        fprintf (stderr,
+                                          (_("\tunexpected content in string sequence found.\n")));
+                                        return (NULL);
+                                }
+                                /* Now follows a string containing the frozen
+                                 * layer list end descriptor, always "}". */
+                                dxf_read_string (fp, &viewport->frozen_layer_list_end);
+                                if (strcmp (viewport->frozen_layer_list_end, "}") == 1)
+                                {
+                                        fprintf (stderr,
+                                          (_("Error in %s () while reading from: %s in line: %d.\n")),
+                                          __FUNCTION__, fp->filename, fp->line_number);
+                                        fprintf (stderr,
+                                          (_("\tunexpected content in string.\n")));
+                                        return (NULL);
+                                }
+                                /* Now follows a string containing a group code. */
+                                dxf_read_group_code (fp, &group_code);
+                                if (group_code != 1002)
+                                {
+                                        fprintf (stderr,
+                                          (_("Error in %s () while reading from: %s in line: %d.\n")),
+                                          __FUNCTION__, fp->filename, fp->line_number);
+                                        fprintf (stderr,
+                                          (_("\tunexpected content in string sequence found.\n")));
+                                        return (NULL);
+                                }
+                                /* Now follows a string containing the window
+                                 * end descriptor, always "}". */
+                                dxf_read_string (fp, &viewport->window_descriptor_end);
+                                if (strcmp (viewport->window_descriptor_end, "}") == 1)
+                                {
+                                        fprintf (stderr,
+                                          (_("Error in %s () while reading from: %s in line: %d.\n")),
+                                          __FUNCTION__, fp->filename, fp->line_number);
+                                        fprintf (stderr,
+                                          (_("\tunexpected content in string.\n")));
+                                        return (NULL);
+                                }
+                                break;
+                        default:
+                                /* End of sequential ordered data fields. */
                                 fprintf (stderr,
-                                  (_("Error in %s () while reading from: %s in line: %d.\n")),
+                                  (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
                                   __FUNCTION__, fp->filename, fp->line_number);
-                                fprintf (stderr,
-                                  (_("\tunexpected content in string.\n")));
-                                return (NULL);
-                        }
-                }
-                /* End of sequential ordered data fields. */
-                else 
-                {
-                        fprintf (stderr,
-                          (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
-                          __FUNCTION__, fp->filename, fp->line_number);
+                                /* Skip the value of the unknown group code. */
+                                dxf_read_line (temp_string, fp);
+                                break;
                 }
         }
         /* Handle omitted members and/or illegal values. */
         if (strcmp (viewport->linetype, "") == 0)
         {
-                viewport->linetype = strdup (DXF_DEFAULT_LINETYPE);
+                viewport->linetype = dxf_strdup (DXF_DEFAULT_LINETYPE);
         }
         if (strcmp (viewport->layer, "") == 0)
         {
-                viewport->layer = strdup (DXF_DEFAULT_LAYER);
+                viewport->layer = dxf_strdup (DXF_DEFAULT_LAYER);
         }
-        /* Clean up. */
-        free (temp_string);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1034,7 +937,7 @@ dxf_viewport_write
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        char *dxf_entity_name = strdup ("VIEWPORT");
+        char *dxf_entity_name = dxf_strdup ("VIEWPORT");
         DxfChar *iter = NULL;
 
         /* Do some basic checks. */
@@ -1044,7 +947,7 @@ dxf_viewport_write
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (viewport == NULL)
@@ -1053,34 +956,34 @@ dxf_viewport_write
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (strcmp (viewport->linetype, "") == 0)
         {
                 fprintf (stderr,
-                  (_("Warning in %s () empty linetype string for the %s entity with id-code: %x\n")),
+                  (_("Warning in %s () empty linetype string for the %s entity with id-code: %" PRIx64 "\n")),
                   __FUNCTION__, dxf_entity_name, viewport->id_code);
                 fprintf (stderr,
                   (_("\t%s entity is reset to default linetype")),
                   dxf_entity_name);
-                viewport->linetype = strdup (DXF_DEFAULT_LINETYPE);
+                viewport->linetype = dxf_strdup (DXF_DEFAULT_LINETYPE);
         }
         if (strcmp (viewport->layer, "") == 0)
         {
                 fprintf (stderr,
-                  (_("Warning in %s () empty layer string for the %s entity with id-code: %x.\n")),
+                  (_("Warning in %s () empty layer string for the %s entity with id-code: %" PRIx64 ".\n")),
                   __FUNCTION__, dxf_entity_name, viewport->id_code);
                 fprintf (stderr,
                   (_("\t%s entity is relocated to default layer.\n")),
                   dxf_entity_name);
-                viewport->layer = strdup (DXF_DEFAULT_LAYER);
+                viewport->layer = dxf_strdup (DXF_DEFAULT_LAYER);
         }
         /* Start writing output. */
-        fprintf (fp->fp, "  0\n%s\n", dxf_entity_name);
-        if (viewport->id_code != -1)
+        dxf_write_string (fp, 0, dxf_entity_name);
+        if (viewport->id_code != DXF_HANDLE_NONE)
         {
-                fprintf (fp->fp, "  5\n%x\n", viewport->id_code);
+                dxf_write_hex (fp, 5, viewport->id_code);
         }
         /*!
          * \todo for version R14.\n
@@ -1092,116 +995,116 @@ dxf_viewport_write
          * 102 groups are application defined (optional).\n\n
          * End of group, "}" (optional), with Group code 102.
          */
-        if ((strcmp (viewport->dictionary_owner_soft, "") != 0)
+        if ((viewport->dictionary_owner_soft != 0)
           && (fp->acad_version_number >= AutoCAD_14))
         {
-                fprintf (fp->fp, "102\n{ACAD_REACTORS\n");
-                fprintf (fp->fp, "330\n%s\n", viewport->dictionary_owner_soft);
-                fprintf (fp->fp, "102\n}\n");
+                dxf_write_string (fp, 102, "{ACAD_REACTORS");
+                dxf_write_hex (fp, 330, viewport->dictionary_owner_soft);
+                dxf_write_string (fp, 102, "}");
         }
-        if ((strcmp (viewport->dictionary_owner_hard, "") != 0)
+        if ((viewport->dictionary_owner_hard != 0)
           && (fp->acad_version_number >= AutoCAD_14))
         {
-                fprintf (fp->fp, "102\n{ACAD_XDICTIONARY\n");
-                fprintf (fp->fp, "360\n%s\n", viewport->dictionary_owner_hard);
-                fprintf (fp->fp, "102\n}\n");
+                dxf_write_string (fp, 102, "{ACAD_XDICTIONARY");
+                dxf_write_hex (fp, 360, viewport->dictionary_owner_hard);
+                dxf_write_string (fp, 102, "}");
         }
         if (fp->acad_version_number >= AutoCAD_13)
         {
-                fprintf (fp->fp, "100\nAcDbEntity\n");
+                dxf_write_string (fp, 100, "AcDbEntity");
         }
         if (viewport->paperspace == DXF_PAPERSPACE)
         {
-                fprintf (fp->fp, " 67\n%d\n", (int16_t) DXF_PAPERSPACE);
+                dxf_write_int (fp, 67, (int16_t) DXF_PAPERSPACE);
         }
-        fprintf (fp->fp, "  8\n%s\n", viewport->layer);
+        dxf_write_string (fp, 8, viewport->layer);
         if (strcmp (viewport->linetype, DXF_DEFAULT_LINETYPE) != 0)
         {
-                fprintf (fp->fp, "  6\n%s\n", viewport->linetype);
+                dxf_write_string (fp, 6, viewport->linetype);
         }
         if ((fp->acad_version_number <= AutoCAD_11)
           && DXF_FLATLAND
           && (viewport->elevation != 0.0))
         {
-                fprintf (fp->fp, " 38\n%f\n", viewport->elevation);
+                dxf_write_double (fp, 38, viewport->elevation);
         }
         if (viewport->color != DXF_COLOR_BYLAYER)
         {
-                fprintf (fp->fp, " 62\n%d\n", viewport->color);
+                dxf_write_int (fp, 62, viewport->color);
         }
         if (viewport->linetype_scale != 1.0)
         {
-                fprintf (fp->fp, " 48\n%f\n", viewport->linetype_scale);
+                dxf_write_double (fp, 48, viewport->linetype_scale);
         }
         if (viewport->visibility != 0)
         {
-                fprintf (fp->fp, " 60\n%d\n", viewport->visibility);
+                dxf_write_int (fp, 60, viewport->visibility);
         }
         if (fp->acad_version_number >= AutoCAD_13)
         {
-                fprintf (fp->fp, "100\nAcDbViewport\n");
+                dxf_write_string (fp, 100, "AcDbViewport");
         }
         if (viewport->thickness != 0.0)
         {
-                fprintf (fp->fp, " 39\n%f\n", viewport->thickness);
-        }
-        fprintf (fp->fp, " 10\n%f\n", viewport->center->x0);
-        fprintf (fp->fp, " 20\n%f\n", viewport->center->y0);
-        fprintf (fp->fp, " 30\n%f\n", viewport->center->z0);
-        fprintf (fp->fp, " 40\n%f\n", viewport->width);
-        fprintf (fp->fp, " 41\n%f\n", viewport->height);
-        fprintf (fp->fp, " 68\n%d\n", viewport->status);
-        fprintf (fp->fp, " 69\n%d\n", viewport->id);
-        fprintf (fp->fp, "1001\n%s\n", DXF_VIEWPORT_APP_NAME);
-        fprintf (fp->fp, "1000\n%s\n", DXF_VIEWPORT_DATA);
-        fprintf (fp->fp, "1002\n%s\n", DXF_VIEWPORT_WINDOW_BEGIN);
-        fprintf (fp->fp, "1070\n%d\n", viewport->extended_entity_data_version);
-        fprintf (fp->fp, "1010\n%f\n", viewport->target->x0);
-        fprintf (fp->fp, "1020\n%f\n", viewport->target->y0);
-        fprintf (fp->fp, "1030\n%f\n", viewport->target->z0);
-        fprintf (fp->fp, "1010\n%f\n", viewport->direction->x0);
-        fprintf (fp->fp, "1020\n%f\n", viewport->direction->y0);
-        fprintf (fp->fp, "1030\n%f\n", viewport->direction->z0);
-        fprintf (fp->fp, "1040\n%f\n", viewport->view_twist_angle);
-        fprintf (fp->fp, "1040\n%f\n", viewport->view_height);
-        fprintf (fp->fp, "1040\n%f\n", viewport->view_center->x0);
-        fprintf (fp->fp, "1040\n%f\n", viewport->view_center->y0);
-        fprintf (fp->fp, "1040\n%f\n", viewport->perspective_lens_length);
-        fprintf (fp->fp, "1040\n%f\n", viewport->front_plane_offset);
-        fprintf (fp->fp, "1040\n%f\n", viewport->back_plane_offset);
-        fprintf (fp->fp, "1070\n%d\n", viewport->view_mode);
-        fprintf (fp->fp, "1070\n%d\n", viewport->circle_zoom_percent);
-        fprintf (fp->fp, "1070\n%d\n", viewport->fast_zoom_setting);
-        fprintf (fp->fp, "1070\n%d\n", viewport->UCSICON_setting);
-        fprintf (fp->fp, "1070\n%d\n", viewport->snap_on);
-        fprintf (fp->fp, "1070\n%d\n", viewport->grid_on);
-        fprintf (fp->fp, "1070\n%d\n", viewport->snap_style);
-        fprintf (fp->fp, "1070\n%d\n", viewport->snap_isopair);
-        fprintf (fp->fp, "1040\n%f\n", viewport->snap_rotation_angle);
-        fprintf (fp->fp, "1040\n%f\n", viewport->snap_base->x0);
-        fprintf (fp->fp, "1040\n%f\n", viewport->snap_base->y0);
-        fprintf (fp->fp, "1040\n%f\n", viewport->snap_spacing->x0);
-        fprintf (fp->fp, "1040\n%f\n", viewport->snap_spacing->y0);
-        fprintf (fp->fp, "1040\n%f\n", viewport->grid_spacing->x0);
-        fprintf (fp->fp, "1040\n%f\n", viewport->grid_spacing->y0);
-        fprintf (fp->fp, "1070\n%d\n", viewport->plot_flag);
-        fprintf (fp->fp, "1002\n%s\n", DXF_VIEWPORT_FROZEN_LAYER_LIST_BEGIN);
+                dxf_write_double (fp, 39, viewport->thickness);
+        }
+        dxf_write_double (fp, 10, viewport->center->x0);
+        dxf_write_double (fp, 20, viewport->center->y0);
+        dxf_write_double (fp, 30, viewport->center->z0);
+        dxf_write_double (fp, 40, viewport->width);
+        dxf_write_double (fp, 41, viewport->height);
+        dxf_write_int (fp, 68, viewport->status);
+        dxf_write_int (fp, 69, viewport->id);
+        dxf_write_string (fp, 1001, DXF_VIEWPORT_APP_NAME);
+        dxf_write_string (fp, 1000, DXF_VIEWPORT_DATA);
+        dxf_write_string (fp, 1002, DXF_VIEWPORT_WINDOW_BEGIN);
+        dxf_write_int (fp, 1070, viewport->extended_entity_data_version);
+        dxf_write_double (fp, 1010, viewport->target->x0);
+        dxf_write_double (fp, 1020, viewport->target->y0);
+        dxf_write_double (fp, 1030, viewport->target->z0);
+        dxf_write_double (fp, 1010, viewport->direction->x0);
+        dxf_write_double (fp, 1020, viewport->direction->y0);
+        dxf_write_double (fp, 1030, viewport->direction->z0);
+        dxf_write_double (fp, 1040, viewport->view_twist_angle);
+        dxf_write_double (fp, 1040, viewport->view_height);
+        dxf_write_double (fp, 1040, viewport->view_center->x0);
+        dxf_write_double (fp, 1040, viewport->view_center->y0);
+        dxf_write_double (fp, 1040, viewport->perspective_lens_length);
+        dxf_write_double (fp, 1040, viewport->front_plane_offset);
+        dxf_write_double (fp, 1040, viewport->back_plane_offset);
+        dxf_write_int (fp, 1070, viewport->view_mode);
+        dxf_write_int (fp, 1070, viewport->circle_zoom_percent);
+        dxf_write_int (fp, 1070, viewport->fast_zoom_setting);
+        dxf_write_int (fp, 1070, viewport->UCSICON_setting);
+        dxf_write_int (fp, 1070, viewport->snap_on);
+        dxf_write_int (fp, 1070, viewport->grid_on);
+        dxf_write_int (fp, 1070, viewport->snap_style);
+        dxf_write_int (fp, 1070, viewport->snap_isopair);
+        dxf_write_double (fp, 1040, viewport->snap_rotation_angle);
+        dxf_write_double (fp, 1040, viewport->snap_base->x0);
+        dxf_write_double (fp, 1040, viewport->snap_base->y0);
+        dxf_write_double (fp, 1040, viewport->snap_spacing->x0);
+        dxf_write_double (fp, 1040, viewport->snap_spacing->y0);
+        dxf_write_double (fp, 1040, viewport->grid_spacing->x0);
+        dxf_write_double (fp, 1040, viewport->grid_spacing->y0);
+        dxf_write_int (fp, 1070, viewport->plot_flag);
+        dxf_write_string (fp, 1002, DXF_VIEWPORT_FROZEN_LAYER_LIST_BEGIN);
         /* Start a loop writing all frozen layer names. */
         iter = viewport->frozen_layers;
         while ((!iter->value) /* Do not allow NULL pointers. */
           || (strcmp (iter->value, "") == 1)) /* Do not allow empty strings. */
         {
-                fprintf (fp->fp, "1003\n%s\n", iter->value);
+                dxf_write_string (fp, 1003, iter->value);
                 iter = (DxfChar *) iter->next;
                 if (iter->next == NULL)
                 {
                         break;
                 }
         }
-        fprintf (fp->fp, "1002\n%s\n", DXF_VIEWPORT_FROZEN_LAYER_LIST_END);
-        fprintf (fp->fp, "1002\n%s\n", DXF_VIEWPORT_WINDOW_END);
+        dxf_write_string (fp, 1002, DXF_VIEWPORT_FROZEN_LAYER_LIST_END);
+        dxf_write_string (fp, 1002, DXF_VIEWPORT_WINDOW_END);
         /* Clean up. */
-        free (dxf_entity_name);
+        dxf_free (dxf_entity_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1242,16 +1145,16 @@ dxf_viewport_free
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        free (viewport->linetype);
-        free (viewport->layer);
-        free (viewport->app_name);
-        free (viewport->viewport_data);
-        free (viewport->window_descriptor_begin);
-        free (viewport->frozen_layer_list_begin);
+        dxf_string_free (viewport->linetype);
+        dxf_string_free (viewport->layer);
+        dxf_free (viewport->app_name);
+        dxf_free (viewport->viewport_data);
+        dxf_free (viewport->window_descriptor_begin);
+        dxf_free (viewport->frozen_layer_list_begin);
         dxf_char_free_list (viewport->frozen_layers);
-        free (viewport->frozen_layer_list_end);
-        free (viewport->window_descriptor_end);
-        free (viewport);
+        dxf_free (viewport->frozen_layer_list_end);
+        dxf_free (viewport->window_descriptor_end);
+        dxf_free (viewport);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1297,7 +1200,7 @@ dxf_viewport_free_list
  *
  * \return \c id_code.
  */
-int
+uint64_t
 dxf_viewport_get_id_code
 (
         DxfViewport *viewport
@@ -1315,12 +1218,6 @@ dxf_viewport_get_id_code
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (viewport->id_code < 0)
-        {
-                fprintf (stderr,
-                  (_("Warning in %s () a negative value was found.\n")),
-                  __FUNCTION__);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1336,7 +1233,7 @@ dxf_viewport_set_id_code
 (
         DxfViewport *viewport,
                 /*!< a pointer to a DXF \c VIEWPORT entity. */
-        int id_code
+        uint64_t id_code
                 /*!< the \c id_code to be set for the entity.\n
                  * This is to be an unique (sequential) number in the
                  * DXF file. */
@@ -1353,12 +1250,6 @@ dxf_viewport_set_id_code
                   __FUNCTION__);
                 return (NULL);
         }
-        if (id_code < 0)
-        {
-                fprintf (stderr,
-                  (_("Warning in %s () a negative value was passed.\n")),
-                  __FUNCTION__);
-        }
         viewport->id_code = id_code;
 #if DEBUG
         DXF_DEBUG_END
@@ -1400,7 +1291,7 @@ dxf_viewport_get_linetype
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (viewport->linetype));
+        return (dxf_strdup (viewport->linetype));
 }
 
 
@@ -1435,7 +1326,7 @@ dxf_viewport_set_linetype
                   __FUNCTION__);
                 return (NULL);
         }
-        viewport->linetype = strdup (linetype);
+        viewport->linetype = dxf_strdup (linetype);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1476,7 +1367,7 @@ dxf_viewport_get_layer
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (viewport->layer));
+        return (dxf_strdup (viewport->layer));
 }
 
 
@@ -1511,7 +1402,7 @@ dxf_viewport_set_layer
                   __FUNCTION__);
                 return (NULL);
         }
-        viewport->layer = strdup (layer);
+        viewport->layer = dxf_strdup (layer);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2249,11 +2140,9 @@ dxf_viewport_set_binary_graphics_data
  * \brief Get the pointer to the \c dictionary_owner_soft from a DXF 
  * \c VIEWPORT entity.
  *
- * \return pointer to the \c dictionary_owner_soft.
- *
- * \warning No checks are performed on the returned pointer (string).
+ * \return the handle of the \c dictionary_owner_soft.
  */
-char *
+uint64_t
 dxf_viewport_get_dictionary_owner_soft
 (
         DxfViewport *viewport
@@ -2269,19 +2158,12 @@ dxf_viewport_get_dictionary_owner_soft
                 fprintf (stderr,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
-                return (NULL);
-        }
-        if (viewport->dictionary_owner_soft ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
+                return (0);
         }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (viewport->dictionary_owner_soft));
+        return (viewport->dictionary_owner_soft);
 }
 
 
@@ -2294,8 +2176,8 @@ dxf_viewport_set_dictionary_owner_soft
 (
         DxfViewport *viewport,
                 /*!< a pointer to a DXF \c VIEWPORT entity. */
-        char *dictionary_owner_soft
-                /*!< a string containing the pointer to the \c
+        uint64_t dictionary_owner_soft
+                /*!< the handle of the \c
                  * dictionary_owner_soft for the entity. */
 )
 {
@@ -2310,14 +2192,7 @@ dxf_viewport_set_dictionary_owner_soft
                   __FUNCTION__);
                 return (NULL);
         }
-        if (dictionary_owner_soft == NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was passed.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
-        viewport->dictionary_owner_soft = strdup (dictionary_owner_soft);
+        viewport->dictionary_owner_soft = dictionary_owner_soft;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2329,12 +2204,10 @@ dxf_viewport_set_dictionary_owner_soft
  * \brief Get the pointer to the \c material from a DXF \c VIEWPORT
  * entity.
  *
- * \return a pointer to \c material when successful, or \c NULL when an
+ * \return the handle \c material when successful, or 0 when an
  * error occurred.
- *
- * \warning No checks are performed on the returned pointer.
  */
-char *
+uint64_t
 dxf_viewport_get_material
 (
         DxfViewport *viewport
@@ -2350,19 +2223,12 @@ dxf_viewport_get_material
                 fprintf (stderr,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
-                return (NULL);
-        }
-        if (viewport->material ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
+                return (0);
         }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (viewport->material));
+        return (viewport->material);
 }
 
 
@@ -2378,8 +2244,8 @@ dxf_viewport_set_material
 (
         DxfViewport *viewport,
                 /*!< a pointer to a DXF \c VIEWPORT entity. */
-        char *material
-                /*!< a string containing the pointer to the \c
+        uint64_t material
+                /*!< the handle of the \c
                  * material for the entity. */
 )
 {
@@ -2394,14 +2260,7 @@ dxf_viewport_set_material
                   __FUNCTION__);
                 return (NULL);
         }
-        if (material == NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was passed.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
-        viewport->material = strdup (material);
+        viewport->material = material;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2413,11 +2272,9 @@ dxf_viewport_set_material
  * \brief Get the pointer to the \c dictionary_owner_hard from a DXF 
  * \c VIEWPORT entity.
  *
- * \return pointer to the \c dictionary_owner_hard.
- *
- * \warning No checks are performed on the returned pointer (string).
+ * \return the handle of the \c dictionary_owner_hard.
  */
-char *
+uint64_t
 dxf_viewport_get_dictionary_owner_hard
 (
         DxfViewport *viewport
@@ -2433,19 +2290,12 @@ dxf_viewport_get_dictionary_owner_hard
                 fprintf (stderr,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
-                return (NULL);
-        }
-        if (viewport->dictionary_owner_hard ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
+                return (0);
         }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (viewport->dictionary_owner_hard));
+        return (viewport->dictionary_owner_hard);
 }
 
 
@@ -2458,8 +2308,8 @@ dxf_viewport_set_dictionary_owner_hard
 (
         DxfViewport *viewport,
                 /*!< a pointer to a DXF \c VIEWPORT entity. */
-        char *dictionary_owner_hard
-                /*!< a string containing the pointer to the \c
+        uint64_t dictionary_owner_hard
+                /*!< the handle of the \c
                  * dictionary_owner_hard for the entity. */
 )
 {
@@ -2474,14 +2324,7 @@ dxf_viewport_set_dictionary_owner_hard
                   __FUNCTION__);
                 return (NULL);
         }
-        if (dictionary_owner_hard == NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was passed.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
-        viewport->dictionary_owner_hard = strdup (dictionary_owner_hard);
+        viewport->dictionary_owner_hard = dictionary_owner_hard;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2557,10 +2400,10 @@ dxf_viewport_set_lineweight
 /*!
  * \brief Get the \c plot_style_name from a DXF \c VIEWPORT entity.
  *
- * \return a pointer to \c plot_style_name when sucessful, or \c NULL
+ * \return the handle \c plot_style_name when sucessful, or 0
  * when an error occurred.
  */
-char *
+uint64_t
 dxf_viewport_get_plot_style_name
 (
         DxfViewport *viewport
@@ -2576,19 +2419,12 @@ dxf_viewport_get_plot_style_name
                 fprintf (stderr,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
-                return (NULL);
-        }
-        if (viewport->plot_style_name ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
+                return (0);
         }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (viewport->plot_style_name));
+        return (viewport->plot_style_name);
 }
 
 
@@ -2603,7 +2439,7 @@ dxf_viewport_set_plot_style_name
 (
         DxfViewport *viewport,
                 /*!< a pointer to a DXF \c VIEWPORT entity. */
-        char *plot_style_name
+        uint64_t plot_style_name
                 /*!< a string containing the \c plot_style_name for the
                  * entity. */
 )
@@ -2619,14 +2455,7 @@ dxf_viewport_set_plot_style_name
                   __FUNCTION__);
                 return (NULL);
         }
-        if (plot_style_name == NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was passed.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
-        viewport->plot_style_name = strdup (plot_style_name);
+        viewport->plot_style_name = plot_style_name;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2733,7 +2562,7 @@ dxf_viewport_get_color_name
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (viewport->color_name));
+        return (dxf_strdup (viewport->color_name));
 }
 
 
@@ -2771,7 +2600,7 @@ dxf_viewport_set_color_name
                   __FUNCTION__);
                 return (NULL);
         }
-        viewport->color_name = strdup (color_name);
+        viewport->color_name = dxf_strdup (color_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -3446,7 +3275,7 @@ dxf_viewport_get_app_name
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (viewport->app_name));
+        return (dxf_strdup (viewport->app_name));
 }
 
 
@@ -3484,7 +3313,7 @@ dxf_viewport_set_app_name
                   __FUNCTION__);
                 return (NULL);
         }
-        viewport->app_name = strdup (app_name);
+        viewport->app_name = dxf_strdup (app_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -3526,7 +3355,7 @@ dxf_viewport_get_viewport_data
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (viewport->viewport_data));
+        return (dxf_strdup (viewport->viewport_data));
 }
 
 
@@ -3564,7 +3393,7 @@ dxf_viewport_set_viewport_data
                   __FUNCTION__);
                 return (NULL);
         }
-        viewport->viewport_data = strdup (viewport_data);
+        viewport->viewport_data = dxf_strdup (viewport_data);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -3607,7 +3436,7 @@ dxf_viewport_get_window_descriptor_begin
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (viewport->window_descriptor_begin));
+        return (dxf_strdup (viewport->window_descriptor_begin));
 }
 
 
@@ -3646,7 +3475,7 @@ dxf_viewport_set_window_descriptor_begin
                   __FUNCTION__);
                 return (NULL);
         }
-        viewport->window_descriptor_begin = strdup (window_descriptor_begin);
+        viewport->window_descriptor_begin = dxf_strdup (window_descriptor_begin);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -6287,7 +6116,7 @@ dxf_viewport_get_frozen_layer_list_begin
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (viewport->frozen_layer_list_begin));
+        return (dxf_strdup (viewport->frozen_layer_list_begin));
 }
 
 
@@ -6323,7 +6152,7 @@ dxf_viewport_set_frozen_layer_list_begin
                   __FUNCTION__);
                 return (NULL);
         }
-        viewport->frozen_layer_list_begin = strdup (frozen_layer_list_begin);
+        viewport->frozen_layer_list_begin = dxf_strdup (frozen_layer_list_begin);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -6443,7 +6272,7 @@ dxf_viewport_get_frozen_layer_list_end
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (viewport->frozen_layer_list_end));
+        return (dxf_strdup (viewport->frozen_layer_list_end));
 }
 
 
@@ -6479,7 +6308,7 @@ dxf_viewport_set_frozen_layer_list_end
                   __FUNCTION__);
                 return (NULL);
         }
-        viewport->frozen_layer_list_end = strdup (frozen_layer_list_end);
+        viewport->frozen_layer_list_end = dxf_strdup (frozen_layer_list_end);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -6522,7 +6351,7 @@ dxf_viewport_get_window_descriptor_end
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (viewport->window_descriptor_end));
+        return (dxf_strdup (viewport->window_descriptor_end));
 }
 
 
@@ -6558,7 +6387,7 @@ dxf_viewport_set_window_descriptor_end
                   __FUNCTION__);
                 return (NULL);
         }
-        viewport->window_descriptor_end = strdup (window_descriptor_end);
+        viewport->window_descriptor_end = dxf_strdup (window_descriptor_end);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -67,7 +67,7 @@ typedef struct
 dxf_viewport_struct
 {
         /* Members common for all DXF drawable entities. */
-        int id_code;
+        uint64_t id_code;
                 /*!< Identification number for the entity.\n
                  * This is to be an unique (sequential) number in the DXF
                  * file.\n
@@ -140,16 +140,16 @@ dxf_viewport_struct
                  * (optional).\n
                  * Group code = 310.\n
                  * \since Introduced in version R2000. */
-        char *dictionary_owner_soft;
+        uint64_t dictionary_owner_soft;
                 /*!< Soft-pointer ID/handle to owner dictionary (optional).\n
                  * Group code = 330.\n
                  * \since Introduced in version R14. */
-        char *material;
+        uint64_t material;
                 /*!< Hard-pointer ID/handle to material object (present if
                  * not BYLAYER).\n
                  * Group code = 347.\n
                  * \since Introduced in version R2008. */
-        char *dictionary_owner_hard;
+        uint64_t dictionary_owner_hard;
                 /*!< Hard owner ID/handle to owner dictionary (optional).\n
                  * Group code = 360.\n
                  * \since Introduced in version R14. */
@@ -158,7 +158,7 @@ dxf_viewport_struct
                  * Stored and moved around as a 16-bit integer.\n
                  * Group code = 370.\n
                  * \since Introduced in version R2002. */
-        char *plot_style_name;
+        uint64_t plot_style_name;
                 /*!< Hard pointer ID / handle of PlotStyleName object.\n
                  * Group code = 390.\n
                  * \since Introduced in version R2009. */
@@ -338,8 +338,8 @@ DxfViewport *dxf_viewport_read (DxfFile *fp, DxfViewport *viewport);
 int dxf_viewport_write (DxfFile *fp, DxfViewport *viewport);
 int dxf_viewport_free (DxfViewport *viewport);
 void dxf_viewport_free_list (DxfViewport *viewports);
-int dxf_viewport_get_id_code (DxfViewport *viewport);
-DxfViewport *dxf_viewport_set_id_code (DxfViewport *viewport, int id_code);
+uint64_t dxf_viewport_get_id_code (DxfViewport *viewport);
+DxfViewport *dxf_viewport_set_id_code (DxfViewport *viewport, uint64_t id_code);
 char *dxf_viewport_get_linetype (DxfViewport *viewport);
 DxfViewport *dxf_viewport_set_linetype (DxfViewport *viewport, char *linetype);
 char *dxf_viewport_get_layer (DxfViewport *viewport);
@@ -362,16 +362,16 @@ int16_t dxf_viewport_get_shadow_mode (DxfViewport *viewport);
 DxfViewport *dxf_viewport_set_shadow_mode (DxfViewport *viewport, int16_t shadow_mode);
 DxfBinaryGraphicsData *dxf_viewport_get_binary_graphics_data (DxfViewport *viewport);
 DxfViewport *dxf_viewport_set_binary_graphics_data (DxfViewport *viewport, DxfBinaryGraphicsData *data);
-char *dxf_viewport_get_dictionary_owner_soft (DxfViewport *viewport);
-DxfViewport *dxf_viewport_set_dictionary_owner_soft (DxfViewport *viewport, char *dictionary_owner_soft);
-char *dxf_viewport_get_material (DxfViewport *viewport);
-DxfViewport *dxf_viewport_set_material (DxfViewport *viewport, char *material);
-char *dxf_viewport_get_dictionary_owner_hard (DxfViewport *viewport);
-DxfViewport *dxf_viewport_set_dictionary_owner_hard (DxfViewport *viewport, char *dictionary_owner_hard);
+uint64_t dxf_viewport_get_dictionary_owner_soft (DxfViewport *viewport);
+DxfViewport *dxf_viewport_set_dictionary_owner_soft (DxfViewport *viewport, uint64_t dictionary_owner_soft);
+uint64_t dxf_viewport_get_material (DxfViewport *viewport);
+DxfViewport *dxf_viewport_set_material (DxfViewport *viewport, uint64_t material);
+uint64_t dxf_viewport_get_dictionary_owner_hard (DxfViewport *viewport);
+DxfViewport *dxf_viewport_set_dictionary_owner_hard (DxfViewport *viewport, uint64_t dictionary_owner_hard);
 int16_t dxf_viewport_get_lineweight (DxfViewport *viewport);
 DxfViewport *dxf_viewport_set_lineweight (DxfViewport *viewport, int16_t lineweight);
-char *dxf_viewport_get_plot_style_name (DxfViewport *viewport);
-DxfViewport *dxf_viewport_set_plot_style_name (DxfViewport *viewport, char *plot_style_name);
+uint64_t dxf_viewport_get_plot_style_name (DxfViewport *viewport);
+DxfViewport *dxf_viewport_set_plot_style_name (DxfViewport *viewport, uint64_t plot_style_name);
 long dxf_viewport_get_color_value (DxfViewport *viewport);
 DxfViewport *dxf_viewport_set_color_value (DxfViewport *viewport, long color_value);
 char *dxf_viewport_get_color_name (DxfViewport *viewport);
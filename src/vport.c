@@ -46,6 +46,7 @@
 
 
 #include "vport.h"
+#include "util.h"
 
 
 /*!
@@ -65,7 +66,7 @@ dxf_vport_new ()
         size = sizeof (DxfVPort);
         /* avoid malloc of 0 bytes */
         if (size == 0) size = 1;
-        if ((vport = malloc (size)) == NULL)
+        if ((vport = dxf_malloc (size)) == NULL)
         {
                 fprintf (stderr,
                   (_("Error in %s () could not allocate memory for a DxfVPort struct.\n")),
@@ -115,8 +116,8 @@ dxf_vport_init
                   __FUNCTION__);
                 return (NULL);
         }
-        vport->id_code = 0;
-        vport->viewport_name = strdup ("");
+        vport->id_code = DXF_HANDLE_NONE;
+        vport->viewport_name = dxf_strdup ("");
         vport->min = dxf_point_new ();
         vport->min = dxf_point_init (vport->min);
         vport->min->x0 = 0.0;
@@ -169,8 +170,8 @@ dxf_vport_init
         vport->grid_on = 0;
         vport->snap_style = 0;
         vport->snap_isopair = 0;
-        vport->dictionary_owner_soft = strdup ("");
-        vport->dictionary_owner_hard = strdup ("");
+        vport->dictionary_owner_soft = 0;
+        vport->dictionary_owner_hard = 0;
         vport->next = NULL;
 #if DEBUG
         DXF_DEBUG_END
@@ -203,7 +204,8 @@ dxf_vport_read
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        char *temp_string = NULL;
+        char temp_string[DXF_MAX_STRING_LENGTH];
+        int group_code;
 
         /* Do some basic checks. */
         if (fp == NULL)
@@ -211,8 +213,6 @@ dxf_vport_read
                 fprintf (stderr,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
-                /* Clean up. */
-                free (temp_string);
                 return (NULL);
         }
         if (vport == NULL)
@@ -279,306 +279,227 @@ dxf_vport_read
                 vport->target = dxf_point_new ();
                 vport->target = dxf_point_init (vport->target);
         }
-        (fp->line_number)++;
-        fscanf (fp->fp, "%[^\n]", temp_string);
-        while (strcmp (temp_string, "0") != 0)
+        while ((dxf_read_group_code (fp, &group_code) == EXIT_SUCCESS)
+          && (group_code != 0))
         {
-                if (ferror (fp->fp))
+                if (dxf_read_error (fp))
                 {
                         fprintf (stderr,
                           (_("Error in %s () while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
-                        fclose (fp->fp);
-                        /* Clean up. */
-                        free (temp_string);
                         return (NULL);
                 }
-                if (strcmp (temp_string, "5") == 0)
-                {
-                        /* Now follows a string containing a sequential
-                         * id number. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%x\n", (uint *) &vport->id_code);
-                }
-                else if (strcmp (temp_string, "2") == 0)
-                {
-                        /* Now follows a string containing a viewport
-                         * name. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, vport->viewport_name);
-                }
-                else if (strcmp (temp_string, "10") == 0)
-                {
-                        /* Now follows a string containing the
-                         * X value of the lower-left corner of viewport. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &vport->min->x0);
-                }
-                else if (strcmp (temp_string, "20") == 0)
-                {
-                        /* Now follows a string containing the
-                         * Y value of the lower-left corner of viewport. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &vport->min->y0);
-                }
-                else if (strcmp (temp_string, "11") == 0)
-                {
-                        /* Now follows a string containing the
-                         * X value of the upper-right corner of viewport. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &vport->max->x0);
-                }
-                else if (strcmp (temp_string, "21") == 0)
-                {
-                        /* Now follows a string containing the
-                         * Y value of the upper-right corner of viewport. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &vport->max->y0);
-                }
-                else if (strcmp (temp_string, "12") == 0)
-                {
-                        /* Now follows a string containing the
-                         * X value of the view center point. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &vport->center->x0);
-                }
-                else if (strcmp (temp_string, "22") == 0)
-                {
-                        /* Now follows a string containing the
-                         * Y value of the view center point. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &vport->center->y0);
-                }
-                else if (strcmp (temp_string, "13") == 0)
-                {
-                        /* Now follows a string containing the
-                         * X value of the snap base point. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &vport->snap_base->x0);
-                }
-                else if (strcmp (temp_string, "23") == 0)
-                {
-                        /* Now follows a string containing the
-                         * Y value of the snap base point. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &vport->snap_base->y0);
-                }
-                else if (strcmp (temp_string, "14") == 0)
-                {
-                        /* Now follows a string containing the
-                         * X value of snap spacing X and Y. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &vport->snap_spacing->x0);
-                }
-                else if (strcmp (temp_string, "24") == 0)
-                {
-                        /* Now follows a string containing the
-                         * Y value of snap spacing X and Y. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &vport->snap_spacing->y0);
-                }
-                else if (strcmp (temp_string, "15") == 0)
-                {
-                        /* Now follows a string containing the
-                         * X value of grid spacing X and Y. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &vport->grid_spacing->x0);
-                }
-                else if (strcmp (temp_string, "25") == 0)
-                {
-                        /* Now follows a string containing the
-                         * Y value of grid spacing X and Y. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &vport->grid_spacing->y0);
-                }
-                else if (strcmp (temp_string, "16") == 0)
-                {
-                        /* Now follows a string containing the
-                         * X value of the view direction from target point. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &vport->direction->x0);
-                }
-                else if (strcmp (temp_string, "26") == 0)
+                switch (group_code)
                 {
-                        /* Now follows a string containing the
-                         * Y value of the view direction from target point. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &vport->direction->y0);
-                }
-                else if (strcmp (temp_string, "36") == 0)
-                {
-                        /* Now follows a string containing the
-                         * Z value of the view direction from target point. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &vport->direction->z0);
-                }
-                else if (strcmp (temp_string, "17") == 0)
-                {
-                        /* Now follows a string containing the
-                         * X value of the view target point. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &vport->target->x0);
-                }
-                else if (strcmp (temp_string, "27") == 0)
-                {
-                        /* Now follows a string containing the
-                         * Y value of the view target point. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &vport->target->y0);
-                }
-                else if (strcmp (temp_string, "37") == 0)
-                {
-                        /* Now follows a string containing the
-                         * Z value of the view target point. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &vport->target->z0);
-                }
-                else if (strcmp (temp_string, "40") == 0)
-                {
-                        /* Now follows a string containing the view
-                         * height. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &vport->view_height);
-                }
-                else if (strcmp (temp_string, "41") == 0)
-                {
-                        /* Now follows a string containing the viewport
-                         * aspect ratio. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &vport->viewport_aspect_ratio);
-                }
-                else if (strcmp (temp_string, "42") == 0)
-                {
-                        /* Now follows a string containing the lens
-                         * length. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &vport->viewport_aspect_ratio);
-                }
-                else if (strcmp (temp_string, "43") == 0)
-                {
-                        /* Now follows a string containing the front
-                         * clipping plane - offset from target point. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &vport->front_plane_offset);
-                }
-                else if (strcmp (temp_string, "44") == 0)
-                {
-                        /* Now follows a string containing the back
-                         * clipping plane - offset from target point. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &vport->back_plane_offset);
-                }
-                else if (strcmp (temp_string, "50") == 0)
-                {
-                        /* Now follows a string containing the snap
-                         * rotation angle. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &vport->snap_rotation_angle);
-                }
-                else if (strcmp (temp_string, "51") == 0)
-                {
-                        /* Now follows a string containing the view
-                         * twist angle. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &vport->view_twist_angle);
-                }
-                else if (strcmp (temp_string, "68") == 0)
-                {
-                        /* Now follows a string containing the
-                         * status field value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%d\n", &vport->status_field);
-                }
-                else if (strcmp (temp_string, "69") == 0)
-                {
-                        /* Now follows a string containing the
-                         * ID value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%d\n", &vport->id);
-                }
-                else if (strcmp (temp_string, "70") == 0)
-                {
-                        /* Now follows a string containing the
-                         * standard flag value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%d\n", &vport->standard_flag);
-                }
-                else if (strcmp (temp_string, "71") == 0)
-                {
-                        /* Now follows a string containing the
-                         * view mode value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%d\n", &vport->view_mode);
-                }
-                else if (strcmp (temp_string, "72") == 0)
-                {
-                        /* Now follows a string containing the circle
-                         * zoom percent value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%d\n", &vport->circle_zoom_percent);
-                }
-                else if (strcmp (temp_string, "73") == 0)
-                {
-                        /* Now follows a string containing the fast
-                         * zoom setting value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%d\n", &vport->fast_zoom_setting);
-                }
-                else if (strcmp (temp_string, "74") == 0)
-                {
-                        /* Now follows a string containing the UCSICON
-                         * setting value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%d\n", &vport->UCSICON_setting);
-                }
-                else if (strcmp (temp_string, "75") == 0)
-                {
-                        /* Now follows a string containing the snap
-                         * on/off value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%d\n", &vport->snap_on);
-                }
-                else if (strcmp (temp_string, "76") == 0)
-                {
-                        /* Now follows a string containing the grid
-                         * on/off value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%d\n", &vport->grid_on);
-                }
-                else if (strcmp (temp_string, "77") == 0)
-                {
-                        /* Now follows a string containing the snap
-                         * style value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%d\n", &vport->snap_style);
-                }
-                else if (strcmp (temp_string, "78") == 0)
-                {
-                        /* Now follows a string containing the snap
-                         * isopair value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%d\n", &vport->snap_isopair);
-                }
-                else if (strcmp (temp_string, "330") == 0)
-                {
-                        /* Now follows a string containing Soft-pointer
-                         * ID/handle to owner dictionary. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, vport->dictionary_owner_soft);
-                }
-                else if (strcmp (temp_string, "360") == 0)
-                {
-                        /* Now follows a string containing Hard owner
-                         * ID/handle to owner dictionary. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, vport->dictionary_owner_hard);
-                }
-                else if (strcmp (temp_string, "999") == 0)
-                {
-                        /* Now follows a string containing a comment. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
-                        fprintf (stdout, "DXF comment: %s\n", temp_string);
+                        case 5:
+                                /* Now follows a string containing a sequential
+                                 * id number. */
+                                dxf_read_handle (fp, &vport->id_code);
+                                break;
+                        case 2:
+                                /* Now follows a string containing a viewport
+                                 * name. */
+                                dxf_read_string (fp, &vport->viewport_name);
+                                break;
+                        case 10:
+                                /* Now follows a string containing the
+                                 * X value of the lower-left corner of viewport. */
+                                dxf_read_double (fp, &vport->min->x0);
+                                break;
+                        case 20:
+                                /* Now follows a string containing the
+                                 * Y value of the lower-left corner of viewport. */
+                                dxf_read_double (fp, &vport->min->y0);
+                                break;
+                        case 11:
+                                /* Now follows a string containing the
+                                 * X value of the upper-right corner of viewport. */
+                                dxf_read_double (fp, &vport->max->x0);
+                                break;
+                        case 21:
+                                /* Now follows a string containing the
+                                 * Y value of the upper-right corner of viewport. */
+                                dxf_read_double (fp, &vport->max->y0);
+                                break;
+                        case 12:
+                                /* Now follows a string containing the
+                                 * X value of the view center point. */
+                                dxf_read_double (fp, &vport->center->x0);
+                                break;
+                        case 22:
+                                /* Now follows a string containing the
+                                 * Y value of the view center point. */
+                                dxf_read_double (fp, &vport->center->y0);
+                                break;
+                        case 13:
+                                /* Now follows a string containing the
+                                 * X value of the snap base point. */
+                                dxf_read_double (fp, &vport->snap_base->x0);
+                                break;
+                        case 23:
+                                /* Now follows a string containing the
+                                 * Y value of the snap base point. */
+                                dxf_read_double (fp, &vport->snap_base->y0);
+                                break;
+                        case 14:
+                                /* Now follows a string containing the
+                                 * X value of snap spacing X and Y. */
+                                dxf_read_double (fp, &vport->snap_spacing->x0);
+                                break;
+                        case 24:
+                                /* Now follows a string containing the
+                                 * Y value of snap spacing X and Y. */
+                                dxf_read_double (fp, &vport->snap_spacing->y0);
+                                break;
+                        case 15:
+                                /* Now follows a string containing the
+                                 * X value of grid spacing X and Y. */
+                                dxf_read_double (fp, &vport->grid_spacing->x0);
+                                break;
+                        case 25:
+                                /* Now follows a string containing the
+                                 * Y value of grid spacing X and Y. */
+                                dxf_read_double (fp, &vport->grid_spacing->y0);
+                                break;
+                        case 16:
+                                /* Now follows a string containing the
+                                 * X value of the view direction from target point. */
+                                dxf_read_double (fp, &vport->direction->x0);
+                                break;
+                        case 26:
+                                /* Now follows a string containing the
+                                 * Y value of the view direction from target point. */
+                                dxf_read_double (fp, &vport->direction->y0);
+                                break;
+                        case 36:
+                                /* Now follows a string containing the
+                                 * Z value of the view direction from target point. */
+                                dxf_read_double (fp, &vport->direction->z0);
+                                break;
+                        case 17:
+                                /* Now follows a string containing the
+                                 * X value of the view target point. */
+                                dxf_read_double (fp, &vport->target->x0);
+                                break;
+                        case 27:
+                                /* Now follows a string containing the
+                                 * Y value of the view target point. */
+                                dxf_read_double (fp, &vport->target->y0);
+                                break;
+                        case 37:
+                                /* Now follows a string containing the
+                                 * Z value of the view target point. */
+                                dxf_read_double (fp, &vport->target->z0);
+                                break;
+                        case 40:
+                                /* Now follows a string containing the view
+                                 * height. */
+                                dxf_read_double (fp, &vport->view_height);
+                                break;
+                        case 41:
+                                /* Now follows a string containing the viewport
+                                 * aspect ratio. */
+                                dxf_read_double (fp, &vport->viewport_aspect_ratio);
+                                break;
+                        case 42:
+                                /* Now follows a string containing the lens
+                                 * length. */
+                                dxf_read_double (fp, &vport->viewport_aspect_ratio);
+                                break;
+                        case 43:
+                                /* Now follows a string containing the front
+                                 * clipping plane - offset from target point. */
+                                dxf_read_double (fp, &vport->front_plane_offset);
+                                break;
+                        case 44:
+                                /* Now follows a string containing the back
+                                 * clipping plane - offset from target point. */
+                                dxf_read_double (fp, &vport->back_plane_offset);
+                                break;
+                        case 50:
+                                /* Now follows a string containing the snap
+                                 * rotation angle. */
+                                dxf_read_double (fp, &vport->snap_rotation_angle);
+                                break;
+                        case 51:
+                                /* Now follows a string containing the view
+                                 * twist angle. */
+                                dxf_read_double (fp, &vport->view_twist_angle);
+                                break;
+                        case 68:
+                                /* Now follows a string containing the
+                                 * status field value. */
+                                dxf_read_int (fp, &vport->status_field);
+                                break;
+                        case 69:
+                                /* Now follows a string containing the
+                                 * ID value. */
+                                dxf_read_int (fp, &vport->id);
+                                break;
+                        case 70:
+                                /* Now follows a string containing the
+                                 * standard flag value. */
+                                dxf_read_int (fp, &vport->standard_flag);
+                                break;
+                        case 71:
+                                /* Now follows a string containing the
+                                 * view mode value. */
+                                dxf_read_int (fp, &vport->view_mode);
+                                break;
+                        case 72:
+                                /* Now follows a string containing the circle
+                                 * zoom percent value. */
+                                dxf_read_int (fp, &vport->circle_zoom_percent);
+                                break;
+                        case 73:
+                                /* Now follows a string containing the fast
+                                 * zoom setting value. */
+                                dxf_read_int (fp, &vport->fast_zoom_setting);
+                                break;
+                        case 74:
+                                /* Now follows a string containing the UCSICON
+                                 * setting value. */
+                                dxf_read_int (fp, &vport->UCSICON_setting);
+                                break;
+                        case 75:
+                                /* Now follows a string containing the snap
+                                 * on/off value. */
+                                dxf_read_int (fp, &vport->snap_on);
+                                break;
+                        case 76:
+                                /* Now follows a string containing the grid
+                                 * on/off value. */
+                                dxf_read_int (fp, &vport->grid_on);
+                                break;
+                        case 77:
+                                /* Now follows a string containing the snap
+                                 * style value. */
+                                dxf_read_int (fp, &vport->snap_style);
+                                break;
+                        case 78:
+                                /* Now follows a string containing the snap
+                                 * isopair value. */
+                                dxf_read_int (fp, &vport->snap_isopair);
+                                break;
+                        case 330:
+                                /* Now follows a string containing Soft-pointer
+                                 * ID/handle to owner dictionary. */
+                                dxf_read_handle (fp, &vport->dictionary_owner_soft);
+                                break;
+                        case 360:
+                                /* Now follows a string containing Hard owner
+                                 * ID/handle to owner dictionary. */
+                                dxf_read_handle (fp, &vport->dictionary_owner_hard);
+                                break;
+                        case 999:
+                                /* Now follows a string containing a comment. */
+                                dxf_read_line (temp_string, fp);
+                                fprintf (stdout, "DXF comment: %s\n", temp_string);
+                                break;
+                        default:
+                                /* Skip the value of the unknown group code. */
+                                dxf_read_line (temp_string, fp);
+                                break;
                 }
 
         }
@@ -591,8 +512,6 @@ dxf_vport_read
                   __FUNCTION__, fp->filename, fp->line_number);
                 return (NULL);
         }
-        /* Clean up. */
-        free (temp_string);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -616,7 +535,7 @@ dxf_vport_write
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        char *dxf_entity_name = strdup ("VPORT");
+        char *dxf_entity_name = dxf_strdup ("VPORT");
 
         /* Do some basic checks. */
         if (fp == NULL)
@@ -625,7 +544,7 @@ dxf_vport_write
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (vport == NULL)
@@ -634,20 +553,20 @@ dxf_vport_write
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if ((vport->viewport_name == NULL)
           || (strcmp (vport->viewport_name, "") == 0))
         {
                 fprintf (stderr,
-                  (_("Error: empty viewport name string for the %s entity with id-code: %x\n")),
+                  (_("Error: empty viewport name string for the %s entity with id-code: %" PRIx64 "\n")),
                   dxf_entity_name, vport->id_code);
                 fprintf (stderr,
                   (_("\t%s entity is discarded from output.\n")),
                   dxf_entity_name);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (vport->min == NULL)
@@ -656,7 +575,7 @@ dxf_vport_write
                   (_("Error in %s () a NULL pointer was found.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (vport->max == NULL)
@@ -665,7 +584,7 @@ dxf_vport_write
                   (_("Error in %s () a NULL pointer was found.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (vport->center == NULL)
@@ -674,7 +593,7 @@ dxf_vport_write
                   (_("Error in %s () a NULL pointer was found.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (vport->snap_base == NULL)
@@ -683,7 +602,7 @@ dxf_vport_write
                   (_("Error in %s () a NULL pointer was found.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (vport->snap_spacing == NULL)
@@ -692,7 +611,7 @@ dxf_vport_write
                   (_("Error in %s () a NULL pointer was found.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (vport->grid_spacing == NULL)
@@ -701,7 +620,7 @@ dxf_vport_write
                   (_("Error in %s () a NULL pointer was found.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (vport->direction == NULL)
@@ -710,7 +629,7 @@ dxf_vport_write
                   (_("Error in %s () a NULL pointer was found.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (vport->target == NULL)
@@ -719,14 +638,14 @@ dxf_vport_write
                   (_("Error in %s () a NULL pointer was found.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         /* Start writing output. */
-        fprintf (fp->fp, "  0\n%s\n", dxf_entity_name);
-        if (vport->id_code != -1)
+        dxf_write_string (fp, 0, dxf_entity_name);
+        if (vport->id_code != DXF_HANDLE_NONE)
         {
-                fprintf (fp->fp, "  5\n%x\n", vport->id_code);
+                dxf_write_hex (fp, 5, vport->id_code);
         }
         /*!
          * \todo for version R14.\n
@@ -738,64 +657,64 @@ dxf_vport_write
          * 102 groups are application defined (optional).\n\n
          * End of group, "}" (optional), with Group code 102.
          */
-        if ((strcmp (vport->dictionary_owner_soft, "") != 0)
+        if ((vport->dictionary_owner_soft != 0)
           && (fp->acad_version_number >= AutoCAD_14))
         {
-                fprintf (fp->fp, "102\n{ACAD_REACTORS\n");
-                fprintf (fp->fp, "330\n%s\n", vport->dictionary_owner_soft);
-                fprintf (fp->fp, "102\n}\n");
+                dxf_write_string (fp, 102, "{ACAD_REACTORS");
+                dxf_write_hex (fp, 330, vport->dictionary_owner_soft);
+                dxf_write_string (fp, 102, "}");
         }
-        if ((strcmp (vport->dictionary_owner_hard, "") != 0)
+        if ((vport->dictionary_owner_hard != 0)
           && (fp->acad_version_number >= AutoCAD_14))
         {
-                fprintf (fp->fp, "102\n{ACAD_XDICTIONARY\n");
-                fprintf (fp->fp, "360\n%s\n", vport->dictionary_owner_hard);
-                fprintf (fp->fp, "102\n}\n");
+                dxf_write_string (fp, 102, "{ACAD_XDICTIONARY");
+                dxf_write_hex (fp, 360, vport->dictionary_owner_hard);
+                dxf_write_string (fp, 102, "}");
         }
         if (fp->acad_version_number >= AutoCAD_13)
         {
-                fprintf (fp->fp, "100\nAcDbSymbolTableRecord\n");
-                fprintf (fp->fp, "100\nAcDbViewportTableRecord\n");
-        }
-        fprintf (fp->fp, "  2\n%s\n", vport->viewport_name);
-        fprintf (fp->fp, " 70\n%d\n", vport->standard_flag);
-        fprintf (fp->fp, " 10\n%f\n", vport->min->x0);
-        fprintf (fp->fp, " 20\n%f\n", vport->min->y0);
-        fprintf (fp->fp, " 11\n%f\n", vport->max->x0);
-        fprintf (fp->fp, " 21\n%f\n", vport->max->y0);
-        fprintf (fp->fp, " 12\n%f\n", vport->center->y0);
-        fprintf (fp->fp, " 22\n%f\n", vport->center->y0);
-        fprintf (fp->fp, " 13\n%f\n", vport->snap_base->x0);
-        fprintf (fp->fp, " 23\n%f\n", vport->snap_base->y0);
-        fprintf (fp->fp, " 14\n%f\n", vport->snap_spacing->x0);
-        fprintf (fp->fp, " 24\n%f\n", vport->snap_spacing->y0);
-        fprintf (fp->fp, " 15\n%f\n", vport->grid_spacing->x0);
-        fprintf (fp->fp, " 25\n%f\n", vport->grid_spacing->y0);
-        fprintf (fp->fp, " 16\n%f\n", vport->direction->x0);
-        fprintf (fp->fp, " 26\n%f\n", vport->direction->y0);
-        fprintf (fp->fp, " 36\n%f\n", vport->direction->z0);
-        fprintf (fp->fp, " 17\n%f\n", vport->target->x0);
-        fprintf (fp->fp, " 27\n%f\n", vport->target->y0);
-        fprintf (fp->fp, " 37\n%f\n", vport->target->z0);
-        fprintf (fp->fp, " 40\n%f\n", vport->view_height);
-        fprintf (fp->fp, " 41\n%f\n", vport->viewport_aspect_ratio);
-        fprintf (fp->fp, " 42\n%f\n", vport->lens_length);
-        fprintf (fp->fp, " 43\n%f\n", vport->front_plane_offset);
-        fprintf (fp->fp, " 44\n%f\n", vport->back_plane_offset);
-        fprintf (fp->fp, " 50\n%f\n", vport->snap_rotation_angle);
-        fprintf (fp->fp, " 51\n%f\n", vport->view_twist_angle);
+                dxf_write_string (fp, 100, "AcDbSymbolTableRecord");
+                dxf_write_string (fp, 100, "AcDbViewportTableRecord");
+        }
+        dxf_write_string (fp, 2, vport->viewport_name);
+        dxf_write_int (fp, 70, vport->standard_flag);
+        dxf_write_double (fp, 10, vport->min->x0);
+        dxf_write_double (fp, 20, vport->min->y0);
+        dxf_write_double (fp, 11, vport->max->x0);
+        dxf_write_double (fp, 21, vport->max->y0);
+        dxf_write_double (fp, 12, vport->center->y0);
+        dxf_write_double (fp, 22, vport->center->y0);
+        dxf_write_double (fp, 13, vport->snap_base->x0);
+        dxf_write_double (fp, 23, vport->snap_base->y0);
+        dxf_write_double (fp, 14, vport->snap_spacing->x0);
+        dxf_write_double (fp, 24, vport->snap_spacing->y0);
+        dxf_write_double (fp, 15, vport->grid_spacing->x0);
+        dxf_write_double (fp, 25, vport->grid_spacing->y0);
+        dxf_write_double (fp, 16, vport->direction->x0);
+        dxf_write_double (fp, 26, vport->direction->y0);
+        dxf_write_double (fp, 36, vport->direction->z0);
+        dxf_write_double (fp, 17, vport->target->x0);
+        dxf_write_double (fp, 27, vport->target->y0);
+        dxf_write_double (fp, 37, vport->target->z0);
+        dxf_write_double (fp, 40, vport->view_height);
+        dxf_write_double (fp, 41, vport->viewport_aspect_ratio);
+        dxf_write_double (fp, 42, vport->lens_length);
+        dxf_write_double (fp, 43, vport->front_plane_offset);
+        dxf_write_double (fp, 44, vport->back_plane_offset);
+        dxf_write_double (fp, 50, vport->snap_rotation_angle);
+        dxf_write_double (fp, 51, vport->view_twist_angle);
 //        fprintf (fp->fp, " 68\n%d\n", vport->status_field);
 //        fprintf (fp->fp, " 69\n%d\n", vport->id);
-        fprintf (fp->fp, " 71\n%d\n", vport->view_mode);
-        fprintf (fp->fp, " 72\n%d\n", vport->circle_zoom_percent);
-        fprintf (fp->fp, " 73\n%d\n", vport->fast_zoom_setting);
-        fprintf (fp->fp, " 74\n%d\n", vport->UCSICON_setting);
-        fprintf (fp->fp, " 75\n%d\n", vport->snap_on);
-        fprintf (fp->fp, " 76\n%d\n", vport->grid_on);
-        fprintf (fp->fp, " 77\n%d\n", vport->snap_style);
-        fprintf (fp->fp, " 78\n%d\n", vport->snap_isopair);
+        dxf_write_int (fp, 71, vport->view_mode);
+        dxf_write_int (fp, 72, vport->circle_zoom_percent);
+        dxf_write_int (fp, 73, vport->fast_zoom_setting);
+        dxf_write_int (fp, 74, vport->UCSICON_setting);
+        dxf_write_int (fp, 75, vport->snap_on);
+        dxf_write_int (fp, 76, vport->grid_on);
+        dxf_write_int (fp, 77, vport->snap_style);
+        dxf_write_int (fp, 78, vport->snap_isopair);
         /* Clean up. */
-        free (dxf_entity_name);
+        dxf_free (dxf_entity_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -836,7 +755,7 @@ dxf_vport_free
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        free (vport->viewport_name);
+        dxf_free (vport->viewport_name);
         dxf_point_free (vport->min);
         dxf_point_free (vport->max);
         dxf_point_free (vport->center);
@@ -845,9 +764,7 @@ dxf_vport_free
         dxf_point_free (vport->grid_spacing);
         dxf_point_free (vport->direction);
         dxf_point_free (vport->target);
-        free (vport->dictionary_owner_soft);
-        free (vport->dictionary_owner_hard);
-        free (vport);
+        dxf_free (vport);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -893,7 +810,7 @@ dxf_vport_free_list
  *
  * \return \c id_code.
  */
-int
+uint64_t
 dxf_vport_get_id_code
 (
         DxfVPort *vport
@@ -911,12 +828,6 @@ dxf_vport_get_id_code
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (vport->id_code < 0)
-        {
-                fprintf (stderr,
-                  (_("Warning in %s () a negative value was found.\n")),
-                  __FUNCTION__);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -932,7 +843,7 @@ dxf_vport_set_id_code
 (
         DxfVPort *vport,
                 /*!< a pointer to a DXF \c VPORT symbol table entry. */
-        int id_code
+        uint64_t id_code
                 /*!< the \c id_code to be set for the entry. */
 )
 {
@@ -947,12 +858,6 @@ dxf_vport_set_id_code
                   __FUNCTION__);
                 return (NULL);
         }
-        if (id_code < 0)
-        {
-                fprintf (stderr,
-                  (_("Warning in %s () a negative value was passed.\n")),
-                  __FUNCTION__);
-        }
         vport->id_code = id_code;
 #if DEBUG
         DXF_DEBUG_END
@@ -996,7 +901,7 @@ dxf_vport_get_viewport_name
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (vport->viewport_name));
+        return (dxf_strdup (vport->viewport_name));
 }
 
 
@@ -1031,7 +936,7 @@ dxf_vport_set_viewport_name
                   __FUNCTION__);
                 return (NULL);
         }
-        vport->viewport_name = strdup (viewport_name);
+        vport->viewport_name = dxf_strdup (viewport_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -4431,11 +4336,9 @@ dxf_vport_set_snap_isopair
  * \brief Get the pointer to the \c dictionary_owner_soft from a DXF 
  * \c VPORT symbol table entry.
  *
- * \return pointer to the \c dictionary_owner_soft.
- *
- * \warning No checks are performed on the returned pointer (string).
+ * \return the handle of the \c dictionary_owner_soft.
  */
-char *
+uint64_t
 dxf_vport_get_dictionary_owner_soft
 (
         DxfVPort *vport
@@ -4451,19 +4354,12 @@ dxf_vport_get_dictionary_owner_soft
                 fprintf (stderr,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
-                return (NULL);
-        }
-        if (vport->dictionary_owner_soft ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
+                return (0);
         }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (vport->dictionary_owner_soft));
+        return (vport->dictionary_owner_soft);
 }
 
 
@@ -4476,8 +4372,8 @@ dxf_vport_set_dictionary_owner_soft
 (
         DxfVPort *vport,
                 /*!< a pointer to a DXF \c VPORT symbol table entry. */
-        char *dictionary_owner_soft
-                /*!< a string containing the pointer to the \c
+        uint64_t dictionary_owner_soft
+                /*!< the handle of the \c
                  * dictionary_owner_soft for the symbol table entry. */
 )
 {
@@ -4492,14 +4388,7 @@ dxf_vport_set_dictionary_owner_soft
                   __FUNCTION__);
                 return (NULL);
         }
-        if (dictionary_owner_soft == NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was passed.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
-        vport->dictionary_owner_soft = strdup (dictionary_owner_soft);
+        vport->dictionary_owner_soft = dictionary_owner_soft;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -4511,11 +4400,9 @@ dxf_vport_set_dictionary_owner_soft
  * \brief Get the pointer to the \c dictionary_owner_hard from a DXF 
  * \c VPORT symbol table entry.
  *
- * \return pointer to the \c dictionary_owner_hard.
- *
- * \warning No checks are performed on the returned pointer (string).
+ * \return the handle of the \c dictionary_owner_hard.
  */
-char *
+uint64_t
 dxf_vport_get_dictionary_owner_hard
 (
         DxfVPort *vport
@@ -4531,19 +4418,12 @@ dxf_vport_get_dictionary_owner_hard
                 fprintf (stderr,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
-                return (NULL);
-        }
-        if (vport->dictionary_owner_hard ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
+                return (0);
         }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (vport->dictionary_owner_hard));
+        return (vport->dictionary_owner_hard);
 }
 
 
@@ -4556,8 +4436,8 @@ dxf_vport_set_dictionary_owner_hard
 (
         DxfVPort *vport,
                 /*!< a pointer to a DXF \c VPORT symbol table entry. */
-        char *dictionary_owner_hard
-                /*!< a string containing the pointer to the \c
+        uint64_t dictionary_owner_hard
+                /*!< the handle of the \c
                  * dictionary_owner_hard for the symbol table entry. */
 )
 {
@@ -4572,14 +4452,7 @@ dxf_vport_set_dictionary_owner_hard
                   __FUNCTION__);
                 return (NULL);
         }
-        if (dictionary_owner_hard == NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was passed.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
-        vport->dictionary_owner_hard = strdup (dictionary_owner_hard);
+        vport->dictionary_owner_hard = dictionary_owner_hard;
 #if DEBUG
         DXF_DEBUG_END
 #endif
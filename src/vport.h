@@ -64,7 +64,7 @@ extern "C" {
 typedef struct
 dxf_vport_struct
 {
-        int id_code;
+        uint64_t id_code;
                 /*!< Identification number for the symbol table entry.\n
                  * This is to be an unique (sequential) number in the DXF
                  * file.\n
@@ -164,11 +164,11 @@ dxf_vport_struct
         int snap_isopair;
                 /*!< Snap isopair.\n
                  * Group code = 78. */
-        char *dictionary_owner_soft;
+        uint64_t dictionary_owner_soft;
                 /*!< Soft-pointer ID/handle to owner dictionary
                  * (optional).\n
                  * Group code = 330. */
-        char *dictionary_owner_hard;
+        uint64_t dictionary_owner_hard;
                 /*!< Hard owner ID/handle to owner dictionary
                  * (optional).\n
                  * Group code = 360. */
@@ -184,8 +184,8 @@ DxfVPort *dxf_vport_read (DxfFile *fp, DxfVPort *vport);
 int dxf_vport_write (DxfFile *fp, DxfVPort *vport);
 int dxf_vport_free (DxfVPort *vport);
 void dxf_vport_free_list (DxfVPort *vports);
-int dxf_vport_get_id_code (DxfVPort *vport);
-DxfVPort *dxf_vport_set_id_code (DxfVPort *vport, int id_code);
+uint64_t dxf_vport_get_id_code (DxfVPort *vport);
+DxfVPort *dxf_vport_set_id_code (DxfVPort *vport, uint64_t id_code);
 char *dxf_vport_get_viewport_name (DxfVPort *vport);
 DxfVPort *dxf_vport_set_viewport_name (DxfVPort *vport, char *viewport_name);
 DxfPoint *dxf_vport_get_min (DxfVPort *vport);
@@ -276,10 +276,10 @@ int dxf_vport_get_snap_style (DxfVPort *vport);
 DxfVPort *dxf_vport_set_snap_style (DxfVPort *vport, int snap_style);
 int dxf_vport_get_snap_isopair (DxfVPort *vport);
 DxfVPort *dxf_vport_set_snap_isopair (DxfVPort *vport, int snap_isopair);
-char *dxf_vport_get_dictionary_owner_soft (DxfVPort *vport);
-DxfVPort *dxf_vport_set_dictionary_owner_soft (DxfVPort *vport, char *dictionary_owner_soft);
-char *dxf_vport_get_dictionary_owner_hard (DxfVPort *vport);
-DxfVPort *dxf_vport_set_dictionary_owner_hard (DxfVPort *vport, char *dictionary_owner_hard);
+uint64_t dxf_vport_get_dictionary_owner_soft (DxfVPort *vport);
+DxfVPort *dxf_vport_set_dictionary_owner_soft (DxfVPort *vport, uint64_t dictionary_owner_soft);
+uint64_t dxf_vport_get_dictionary_owner_hard (DxfVPort *vport);
+DxfVPort *dxf_vport_set_dictionary_owner_hard (DxfVPort *vport, uint64_t dictionary_owner_hard);
 DxfVPort *dxf_vport_get_next (DxfVPort *vport);
 DxfVPort *dxf_vport_set_next (DxfVPort *vport, DxfVPort *next);
 DxfVPort *dxf_vport_get_last (DxfVPort *vport);
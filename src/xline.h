@@ -60,7 +60,7 @@ typedef struct
 dxf_xline_struct
 {
         /* Members common for all DXF drawable entities. */
-        int id_code;
+        uint64_t id_code;
                 /*!< Identification number for the entity.\n
                  * This is to be an unique (sequential) number in the DXF
                  * file.\n
@@ -133,16 +133,16 @@ dxf_xline_struct
                  * (optional).\n
                  * Group code = 310.\n
                  * \since Introduced in version R2000. */
-        char *dictionary_owner_soft;
+        uint64_t dictionary_owner_soft;
                 /*!< Soft-pointer ID/handle to owner dictionary (optional).\n
                  * Group code = 330.\n
                  * \since Introduced in version R14. */
-        char *material;
+        uint64_t material;
                 /*!< Hard-pointer ID/handle to material object (present if
                  * not BYLAYER).\n
                  * Group code = 347.\n
                  * \since Introduced in version R2008. */
-        char *dictionary_owner_hard;
+        uint64_t dictionary_owner_hard;
                 /*!< Hard owner ID/handle to owner dictionary (optional).\n
                  * Group code = 360.\n
                  * \since Introduced in version R14. */
@@ -151,7 +151,7 @@ dxf_xline_struct
                  * Stored and moved around as a 16-bit integer.\n
                  * Group code = 370.\n
                  * \since Introduced in version R2002. */
-        char *plot_style_name;
+        uint64_t plot_style_name;
                 /*!< Hard pointer ID / handle of PlotStyleName object.\n
                  * Group code = 390.\n
                  * \since Introduced in version R2009. */
@@ -202,8 +202,8 @@ DxfXLine *dxf_xline_read (DxfFile *fp, DxfXLine *xline);
 int dxf_xline_write (DxfFile *fp, DxfXLine *xline);
 int dxf_xline_free (DxfXLine *xline);
 void dxf_xline_free_list (DxfXLine *xlines);
-int dxf_xline_get_id_code (DxfXLine *xline);
-DxfXLine *dxf_xline_set_id_code (DxfXLine *xline, int id_code);
+uint64_t dxf_xline_get_id_code (DxfXLine *xline);
+DxfXLine *dxf_xline_set_id_code (DxfXLine *xline, uint64_t id_code);
 char *dxf_xline_get_linetype (DxfXLine *xline);
 DxfXLine *dxf_xline_set_linetype (DxfXLine *xline, char *linetype);
 char *dxf_xline_get_layer (DxfXLine *xline);
@@ -226,16 +226,16 @@ int16_t dxf_xline_get_shadow_mode (DxfXLine *xline);
 DxfXLine *dxf_xline_set_shadow_mode (DxfXLine *xline, int16_t shadow_mode);
 DxfBinaryGraphicsData *dxf_xline_get_binary_graphics_data (DxfXLine *xline);
 DxfXLine *dxf_xline_set_binary_graphics_data (DxfXLine *xline, DxfBinaryGraphicsData *data);
-char *dxf_xline_get_dictionary_owner_soft (DxfXLine *xline);
-DxfXLine *dxf_xline_set_dictionary_owner_soft (DxfXLine *xline, char *dictionary_owner_soft);
-char *dxf_xline_get_material (DxfXLine *xline);
-DxfXLine *dxf_xline_set_material (DxfXLine *xline, char *material);
-char *dxf_xline_get_dictionary_owner_hard (DxfXLine *xline);
-DxfXLine *dxf_xline_set_dictionary_owner_hard (DxfXLine *xline, char *dictionary_owner_hard);
+uint64_t dxf_xline_get_dictionary_owner_soft (DxfXLine *xline);
+DxfXLine *dxf_xline_set_dictionary_owner_soft (DxfXLine *xline, uint64_t dictionary_owner_soft);
+uint64_t dxf_xline_get_material (DxfXLine *xline);
+DxfXLine *dxf_xline_set_material (DxfXLine *xline, uint64_t material);
+uint64_t dxf_xline_get_dictionary_owner_hard (DxfXLine *xline);
+DxfXLine *dxf_xline_set_dictionary_owner_hard (DxfXLine *xline, uint64_t dictionary_owner_hard);
 int16_t dxf_xline_get_lineweight (DxfXLine *xline);
 DxfXLine *dxf_xline_set_lineweight (DxfXLine *xline, int16_t lineweight);
-char *dxf_xline_get_plot_style_name (DxfXLine *xline);
-DxfXLine *dxf_xline_set_plot_style_name (DxfXLine *xline, char *plot_style_name);
+uint64_t dxf_xline_get_plot_style_name (DxfXLine *xline);
+DxfXLine *dxf_xline_set_plot_style_name (DxfXLine *xline, uint64_t plot_style_name);
 long dxf_xline_get_color_value (DxfXLine *xline);
 DxfXLine *dxf_xline_set_color_value (DxfXLine *xline, long color_value);
 char *dxf_xline_get_color_name (DxfXLine *xline);
@@ -42,6 +42,7 @@
 
 
 #include "xrecord.h"
+#include "util.h"
 
 
 /*!
@@ -61,7 +62,7 @@ dxf_xrecord_new ()
         size = sizeof (DxfXrecord);
         /* avoid malloc of 0 bytes */
         if (size == 0) size = 1;
-        if ((xrecord = malloc (size)) == NULL)
+        if ((xrecord = dxf_malloc (size)) == NULL)
         {
                 fprintf (stderr,
                   (_("Error in %s () could not allocate memory for a DxfXrecord struct.\n")),
@@ -111,16 +112,16 @@ dxf_xrecord_init
                   __FUNCTION__);
                 return (NULL);
         }
-        xrecord->id_code = 0;
-        xrecord->dictionary_owner_soft = strdup ("");
-        xrecord->dictionary_owner_hard = strdup ("");
+        xrecord->id_code = DXF_HANDLE_NONE;
+        xrecord->dictionary_owner_soft = 0;
+        xrecord->dictionary_owner_hard = 0;
         xrecord->group_code = 0;
         xrecord->I8 = 0;
         xrecord->I16 = 0;
         xrecord->I32 = 0;
         xrecord->D = 0.0;
         xrecord->F = 0.0;
-        xrecord->S = strdup ("");
+        xrecord->S = dxf_strdup ("");
         xrecord->next = NULL;
 #if DEBUG
         DXF_DEBUG_END
@@ -152,7 +153,9 @@ dxf_xrecord_read
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        char *temp_string = NULL;
+        char temp_string[DXF_MAX_STRING_LENGTH];
+        int group_code;
+        int16_t i8;
 
         /* Do some basic checks. */
         if (fp == NULL)
@@ -160,8 +163,6 @@ dxf_xrecord_read
                 fprintf (stderr,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
-                /* Clean up. */
-                free (temp_string);
                 return (NULL);
         }
         if (fp->acad_version_number < AutoCAD_14)
@@ -177,34 +178,29 @@ dxf_xrecord_read
                   __FUNCTION__);
                 xrecord = dxf_xrecord_init (xrecord);
         }
-        (fp->line_number)++;
-        fscanf (fp->fp, "%[^\n]", temp_string);
-        while (strcmp (temp_string, "0") != 0)
+        while ((dxf_read_group_code (fp, &group_code) == EXIT_SUCCESS)
+          && (group_code != 0))
         {
-                if (ferror (fp->fp))
+                if (dxf_read_error (fp))
                 {
                         fprintf (stderr,
                           (_("Error in %s () while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
                         /* Clean up. */
-                        free (temp_string);
-                        fclose (fp->fp);
                         return (NULL);
                 }
-                if (strcmp (temp_string, "5") == 0)
+                if (group_code == 5)
                 {
                         /* Now follows a string containing a sequential
                          * id number. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%x\n", (uint *) &xrecord->id_code);
+                        dxf_read_handle (fp, &xrecord->id_code);
                 }
                 else if ((fp->acad_version_number >= AutoCAD_13)
-                        && (strcmp (temp_string, "100") == 0))
+                        && (group_code == 100))
                 {
                         /* Now follows a string containing the
                          * subclass marker value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
+                        dxf_read_line (temp_string, fp);
                         if (strcmp (temp_string, "AcDbXrecord") != 0)
                         {
                                 fprintf (stderr,
@@ -212,100 +208,92 @@ dxf_xrecord_read
                                   __FUNCTION__, fp->filename, fp->line_number);
                         }
                 }
-                else if (strcmp (temp_string, "330") == 0)
+                else if (group_code == 330)
                 {
                         /* Now follows a string containing Soft-pointer
                          * ID/handle to owner dictionary. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, xrecord->dictionary_owner_soft);
+                        dxf_read_handle (fp, &xrecord->dictionary_owner_soft);
                 }
-                else if (strcmp (temp_string, "360") == 0)
+                else if (group_code == 360)
                 {
                         /* Now follows a string containing Hard owner
                          * ID/handle to owner dictionary. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, xrecord->dictionary_owner_hard);
+                        dxf_read_handle (fp, &xrecord->dictionary_owner_hard);
                 }
-                else if (strcmp (temp_string, "999") == 0)
+                else if (group_code == 999)
                 {
                         /* Now follows a string containing a comment. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
+                        dxf_read_line (temp_string, fp);
                         fprintf (stdout, (_("DXF comment: %s\n")), temp_string);
                 }
                 else if
                   (
-                    ((scanf (temp_string, "%d") >= 1) &&  (scanf (temp_string, "%d") <= 9))
-                    || (strcmp (temp_string, "102") == 0)
-                    || (strcmp (temp_string, "105") == 0)
-                    || ((scanf (temp_string, "%d") >= 300) &&  (scanf (temp_string, "%d") <= 369))
+                    ((group_code >= 1) &&  (group_code <= 9))
+                    || (group_code == 102)
+                    || (group_code == 105)
+                    || ((group_code >= 300) &&  (group_code <= 369))
                   )
                 {
-                        xrecord->group_code = scanf (temp_string, "%d");
+                        xrecord->group_code = group_code;
                         /* Now follows a string value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, xrecord->S);
+                        dxf_read_string (fp, &xrecord->S);
                 }
                 else if
                   (
-                    ((scanf (temp_string, "%d") >= 10) &&  (scanf (temp_string, "%d") <= 59))
+                    ((group_code >= 10) &&  (group_code <= 59))
                   )
                 {
-                        xrecord->group_code = scanf (temp_string, "%d");
+                        xrecord->group_code = group_code;
                         /* Now follows a double value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &xrecord->D);
+                        dxf_read_double (fp, &xrecord->D);
                 }
                 else if
                   (
-                    ((scanf (temp_string, "%d") >= 60) &&  (scanf (temp_string, "%d") <= 79))
-                    || ((scanf (temp_string, "%d") >= 170) &&  (scanf (temp_string, "%d") <= 175))
+                    ((group_code >= 60) &&  (group_code <= 79))
+                    || ((group_code >= 170) &&  (group_code <= 175))
                   )
                 {
-                        xrecord->group_code = scanf (temp_string, "%d");
+                        xrecord->group_code = group_code;
                         /* Now follows a 16-bit integer value.. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%hi\n", &xrecord->I16);
+                        dxf_read_int16 (fp, &xrecord->I16);
                 }
                 else if
                   (
-                    ((scanf (temp_string, "%d") >= 90) &&  (scanf (temp_string, "%d") <= 99))
+                    ((group_code >= 90) &&  (group_code <= 99))
                   )
                 {
-                        xrecord->group_code = scanf (temp_string, "%d");
+                        xrecord->group_code = group_code;
                         /* Now follows a 32-bit integer value.. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%" PRIi32 "\n", &xrecord->I32);
+                        dxf_read_int32 (fp, &xrecord->I32);
                 }
                 else if
                   (
-                    ((scanf (temp_string, "%d") >= 140) &&  (scanf (temp_string, "%d") <= 147))
+                    ((group_code >= 140) &&  (group_code <= 147))
                   )
                 {
-                        xrecord->group_code = scanf (temp_string, "%d");
+                        xrecord->group_code = group_code;
                         /* Now follows a float value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%f\n", &xrecord->F);
+                        dxf_read_float (fp, &xrecord->F);
                 }
                 else if
                   (
-                    ((scanf (temp_string, "%d") >= 280) &&  (scanf (temp_string, "%d") <= 289))
+                    ((group_code >= 280) &&  (group_code <= 289))
                   )
                 {
-                        xrecord->group_code = scanf (temp_string, "%d");
+                        xrecord->group_code = group_code;
                         /* Now follows a 8-bit integer value.. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%hhi\n", &xrecord->I8);
+                        dxf_read_int16 (fp, &i8);
+                        xrecord->I8 = (int8_t) i8;
                 }
                 else
                 {
                         fprintf (stderr,
                           (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
+                        /* Skip the value of the unknown group code. */
+                        dxf_read_line (temp_string, fp);
                 }
         }
-        /* Clean up. */
-        free (temp_string);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -331,7 +319,7 @@ dxf_xrecord_write
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        char *dxf_entity_name = strdup ("XRECORD");
+        char *dxf_entity_name = dxf_strdup ("XRECORD");
 
         /* Do some basic checks. */
         if (fp == NULL)
@@ -340,7 +328,7 @@ dxf_xrecord_write
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (xrecord == NULL)
@@ -349,20 +337,20 @@ dxf_xrecord_write
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (fp->acad_version_number < AutoCAD_14)
         {
                 fprintf (stderr,
-                  (_("Warning in %s () illegal DXF version for this %s object with id-code: %x.\n")),
+                  (_("Warning in %s () illegal DXF version for this %s object with id-code: %" PRIx64 ".\n")),
                   __FUNCTION__, dxf_entity_name, xrecord->id_code);
         }
         /* Start writing output. */
-        fprintf (fp->fp, "  0\n%s\n", dxf_entity_name);
-        if (xrecord->id_code != -1)
+        dxf_write_string (fp, 0, dxf_entity_name);
+        if (xrecord->id_code != DXF_HANDLE_NONE)
         {
-                fprintf (fp->fp, "  5\n%x\n", xrecord->id_code);
+                dxf_write_hex (fp, 5, xrecord->id_code);
         }
         /*!
          * \todo for version R14.\n
@@ -374,25 +362,24 @@ dxf_xrecord_write
          * 102 groups are application defined (optional).\n\n
          * End of group, "}" (optional), with Group code 102.
          */
-        if ((strcmp (xrecord->dictionary_owner_soft, "") != 0)
+        if ((xrecord->dictionary_owner_soft != 0)
           && (fp->acad_version_number >= AutoCAD_14))
         {
-                fprintf (fp->fp, "102\n{ACAD_REACTORS\n");
-                fprintf (fp->fp, "330\n%s\n", xrecord->dictionary_owner_soft);
-                fprintf (fp->fp, "102\n}\n");
+                dxf_write_string (fp, 102, "{ACAD_REACTORS");
+                dxf_write_hex (fp, 330, xrecord->dictionary_owner_soft);
+                dxf_write_string (fp, 102, "}");
         }
-        if ((strcmp (xrecord->dictionary_owner_hard, "") != 0)
+        if ((xrecord->dictionary_owner_hard != 0)
           && (fp->acad_version_number >= AutoCAD_14))
         {
-                fprintf (fp->fp, "102\n{ACAD_XDICTIONARY\n");
-                fprintf (fp->fp, "360\n%s\n", xrecord->dictionary_owner_hard);
-                fprintf (fp->fp, "102\n}\n");
+                dxf_write_string (fp, 102, "{ACAD_XDICTIONARY");
+                dxf_write_hex (fp, 360, xrecord->dictionary_owner_hard);
+                dxf_write_string (fp, 102, "}");
         }
         if (fp->acad_version_number >= AutoCAD_13)
         {
-                fprintf (fp->fp, "100\nAcDbXrecord\n");
+                dxf_write_string (fp, 100, "AcDbXrecord");
         }
-        fprintf (fp->fp, "%d\n", xrecord->group_code);
         if
         (
           ((xrecord->group_code >= 1) && (xrecord->group_code <= 9))
@@ -401,14 +388,14 @@ dxf_xrecord_write
           || ((xrecord->group_code >= 300) &&  (xrecord->group_code <= 369))
         )
         {
-                fprintf (fp->fp, DXF_MAX_STRING_FORMAT, xrecord->S);
+                dxf_write_string (fp, xrecord->group_code, xrecord->S);
         }
         else if
         (
           ((xrecord->group_code >= 10) && (xrecord->group_code <= 59))
         )
         {
-                fprintf (fp->fp, "%lf\n", xrecord->D);
+                dxf_write_double (fp, xrecord->group_code, xrecord->D);
         }
         else if
         (
@@ -416,37 +403,37 @@ dxf_xrecord_write
           || ((xrecord->group_code >= 170) && (xrecord->group_code <= 175))
         )
         {
-                fprintf (fp->fp, "%" PRIi16 "\n", xrecord->I16);
+                dxf_write_int (fp, xrecord->group_code, xrecord->I16);
         }
         else if
         (
           ((xrecord->group_code >= 90) && (xrecord->group_code <= 99))
         )
         {
-                fprintf (fp->fp, "%" PRIi32 "\n", xrecord->I32);
+                dxf_write_int (fp, xrecord->group_code, xrecord->I32);
         }
         else if
         (
           ((xrecord->group_code >= 140) && (xrecord->group_code <= 147))
         )
         {
-                fprintf (fp->fp, "%f\n", xrecord->F);
+                dxf_write_double (fp, xrecord->group_code, xrecord->F);
         }
         else if
         (
           ((xrecord->group_code >= 280) && (xrecord->group_code <= 289))
         )
         {
-                fprintf (fp->fp, "%" PRIi8 "\n", xrecord->I8);
+                dxf_write_int (fp, xrecord->group_code, xrecord->I8);
         }
         else
         {
                 fprintf (stderr,
-                  (_("Warning in %s () unknown group code %d found in DxfXrecord struct with id-code: %x.\n")),
+                  (_("Warning in %s () unknown group code %d found in DxfXrecord struct with id-code: %" PRIx64 ".\n")),
                   __FUNCTION__, xrecord->group_code, xrecord->id_code);
         }
         /* Clean up. */
-        free (dxf_entity_name);
+        dxf_free (dxf_entity_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -487,10 +474,8 @@ dxf_xrecord_free
                 __FUNCTION__);
               return (EXIT_FAILURE);
         }
-        free (xrecord->dictionary_owner_soft);
-        free (xrecord->dictionary_owner_hard);
-        free (xrecord->S);
-        free (xrecord);
+        dxf_free (xrecord->S);
+        dxf_free (xrecord);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -536,7 +521,7 @@ dxf_xrecord_free_list
  *
  * \return ID code.
  */
-int
+uint64_t
 dxf_xrecord_get_id_code
 (
         DxfXrecord *xrecord
@@ -554,13 +539,6 @@ dxf_xrecord_get_id_code
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (xrecord->id_code < 0)
-        {
-                fprintf (stderr,
-                  (_("Warning in %s () a negative value was found.\n")),
-                  __FUNCTION__);
-                return (EXIT_FAILURE);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -576,7 +554,7 @@ dxf_xrecord_set_id_code
 (
         DxfXrecord *xrecord,
                 /*!< a pointer to a DXF \c XRECORD object. */
-        int id_code
+        uint64_t id_code
                 /*!< Identification number for the object.\n
                  * This is to be an unique (sequential) number in the DXF
                  * file. */
@@ -593,13 +571,6 @@ dxf_xrecord_set_id_code
                   __FUNCTION__);
                 return (NULL);
         }
-        if (id_code < 0)
-        {
-                fprintf (stderr,
-                  (_("Warning in %s () a negative value was passed.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
         xrecord->id_code = id_code;
 #if DEBUG
         DXF_DEBUG_END
@@ -613,10 +584,8 @@ dxf_xrecord_set_id_code
  * \c XRECORD object.
  *
  * \return soft pointer to the dictionary owner.
- *
- * \warning No checks are performed on the returned pointer (string).
  */
-char *
+uint64_t
 dxf_xrecord_get_dictionary_owner_soft
 (
         DxfXrecord *xrecord
@@ -632,19 +601,12 @@ dxf_xrecord_get_dictionary_owner_soft
                 fprintf (stderr,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
-                return (NULL);
-        }
-        if (xrecord->dictionary_owner_soft ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
+                return (0);
         }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (xrecord->dictionary_owner_soft));
+        return (xrecord->dictionary_owner_soft);
 }
 
 
@@ -657,8 +619,8 @@ dxf_xrecord_set_dictionary_owner_soft
 (
         DxfXrecord *xrecord,
                 /*!< a pointer to a DXF \c XRECORD object. */
-        char *dictionary_owner_soft
-                /*!< a string containing the pointer to the
+        uint64_t dictionary_owner_soft
+                /*!< the handle of the
                  * dictionary_owner_soft for the object. */
 )
 {
@@ -673,14 +635,7 @@ dxf_xrecord_set_dictionary_owner_soft
                   __FUNCTION__);
                 return (NULL);
         }
-        if (dictionary_owner_soft == NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was passed.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
-        xrecord->dictionary_owner_soft = strdup (dictionary_owner_soft);
+        xrecord->dictionary_owner_soft = dictionary_owner_soft;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -693,10 +648,8 @@ dxf_xrecord_set_dictionary_owner_soft
  * \c XRECORD object.
  *
  * \return hard pointer to the dictionary owner.
- *
- * \warning No checks are performed on the returned pointer (string).
  */
-char *
+uint64_t
 dxf_xrecord_get_dictionary_owner_hard
 (
         DxfXrecord *xrecord
@@ -712,19 +665,12 @@ dxf_xrecord_get_dictionary_owner_hard
                 fprintf (stderr,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
-                return (NULL);
-        }
-        if (xrecord->dictionary_owner_hard ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
+                return (0);
         }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (xrecord->dictionary_owner_hard));
+        return (xrecord->dictionary_owner_hard);
 }
 
 
@@ -737,8 +683,8 @@ dxf_xrecord_set_dictionary_owner_hard
 (
         DxfXrecord *xrecord,
                 /*!< a pointer to a DXF \c XRECORD object. */
-        char *dictionary_owner_hard
-                /*!< a string containing the pointer to the
+        uint64_t dictionary_owner_hard
+                /*!< the handle of the
                  * dictionary_owner_hard for the object. */
 )
 {
@@ -753,14 +699,7 @@ dxf_xrecord_set_dictionary_owner_hard
                   __FUNCTION__);
                 return (NULL);
         }
-        if (dictionary_owner_hard == NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was passed.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
-        xrecord->dictionary_owner_hard = strdup (dictionary_owner_hard);
+        xrecord->dictionary_owner_hard = dictionary_owner_hard;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1183,7 +1122,7 @@ dxf_xrecord_get_S
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (xrecord->S));
+        return (dxf_strdup (xrecord->S));
 }
 
 
@@ -1217,7 +1156,7 @@ dxf_xrecord_set_S
                   __FUNCTION__);
                 return (NULL);
         }
-        xrecord->S = strdup (S);
+        xrecord->S = dxf_strdup (S);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -60,15 +60,15 @@ typedef struct
 dxf_xrecord_struct
 {
         /* Members common for all DXF objects. */
-        int id_code;
+        uint64_t id_code;
                 /*!< Identification number for the entity.\n
                  * This is to be an unique (sequential) number in the DXF
                  * file.\n
                  * Group code = 5. */
-        char *dictionary_owner_soft;
+        uint64_t dictionary_owner_soft;
                 /*!< Soft-pointer ID/handle to owner dictionary (optional).\n
                  * Group code = 330. */
-        char *dictionary_owner_hard;
+        uint64_t dictionary_owner_hard;
                 /*!< Hard owner ID/handle to owner dictionary (optional).\n
                  * Group code = 360. */
         /* Specific members for a DXF xrecord. */
@@ -104,12 +104,12 @@ DxfXrecord *dxf_xrecord_read (DxfFile *fp, DxfXrecord *xrecord);
 int dxf_xrecord_write (DxfFile *fp, DxfXrecord *xrecord);
 int dxf_xrecord_free (DxfXrecord *xrecord);
 void dxf_xrecord_free_list (DxfXrecord *xrecords);
-int dxf_xrecord_get_id_code (DxfXrecord *xrecord);
-DxfXrecord *dxf_xrecord_set_id_code (DxfXrecord *xrecord, int id_code);
-char *dxf_xrecord_get_dictionary_owner_soft (DxfXrecord *xrecord);
-DxfXrecord *dxf_xrecord_set_dictionary_owner_soft (DxfXrecord *xrecord, char *dictionary_owner_soft);
-char *dxf_xrecord_get_dictionary_owner_hard (DxfXrecord *xrecord);
-DxfXrecord *dxf_xrecord_set_dictionary_owner_hard (DxfXrecord *xrecord, char *dictionary_owner_hard);
+uint64_t dxf_xrecord_get_id_code (DxfXrecord *xrecord);
+DxfXrecord *dxf_xrecord_set_id_code (DxfXrecord *xrecord, uint64_t id_code);
+uint64_t dxf_xrecord_get_dictionary_owner_soft (DxfXrecord *xrecord);
+DxfXrecord *dxf_xrecord_set_dictionary_owner_soft (DxfXrecord *xrecord, uint64_t dictionary_owner_soft);
+uint64_t dxf_xrecord_get_dictionary_owner_hard (DxfXrecord *xrecord);
+DxfXrecord *dxf_xrecord_set_dictionary_owner_hard (DxfXrecord *xrecord, uint64_t dictionary_owner_hard);
 int dxf_xrecord_get_group_code (DxfXrecord *xrecord);
 DxfXrecord *dxf_xrecord_set_group_code (DxfXrecord *xrecord, int group_code);
 int8_t dxf_xrecord_get_I8 (DxfXrecord *xrecord);
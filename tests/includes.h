@@ -39,6 +39,25 @@
 #include "src/dxf.h"
 
 
+/*!
+ * \brief Directory holding the example DXF files, relative to the
+ * directory the tests run in.
+ */
+#define TESTS_EXAMPLES_DIR "../../examples/"
+
+
+int test_bbox (void);
+int test_binary (void);
+int test_double (void);
+int test_header (void);
+int test_line_index (void);
+int test_read_compare (const char *filename_1, const char *filename_2);
+int test_read_mapped (void);
+int test_read_parallel (void);
+int test_spatial_index (void);
+int test_transform (void);
+
+
 #endif /* LIBDXF_TESTS_INCLUDES_H */
 
 
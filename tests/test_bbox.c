@@ -0,0 +1,962 @@
+/*!
+ * \file test_bbox.c
+ *
+ * \author Copyright (C) 2026
+ * by Bert Timmerman <bert.timmerman@xs4all.nl>.
+ *
+ * \brief Testing program for bounding boxes, the boxes of arcs,
+ * ellipses, bulged segments and entities in an Object Coordinate System
+ * (OCS) have to be the tightest boxes around densely sampled points, and
+ * the extents of a drawing have to be the union of the boxes of it's
+ * entities.
+ *
+ * <hr>
+ * <h1><b>Copyright Notices.</b></h1>\n
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License,
+ * or (at your option) any later version.\n\n
+ * This program is distributed in the hope that it will be useful, but
+ * <b>WITHOUT ANY WARRANTY</b>; without even the implied warranty of
+ * <b>MERCHANTABILITY</b> or <b>FITNESS FOR A PARTICULAR PURPOSE</b>.\n
+ * See the GNU General Public License for more details.\n\n
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to:\n
+ * Free Software Foundation, Inc.,\n
+ * 59 Temple Place,\n
+ * Suite 330,\n
+ * Boston,\n
+ * MA 02111 USA.\n
+ * \n
+ * Drawing eXchange Format (DXF) is a defacto industry standard for the
+ * exchange of drawing files between various Computer Aided Drafting
+ * programs.\n
+ * DXF is an industry standard designed by Autodesk(TM).\n
+ * For more details see http://www.autodesk.com.
+ * <hr>
+ */
+
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <math.h>
+#include "includes.h"
+
+
+/*!
+ * \brief Number of points sampled along a curve.
+ */
+#define TEST_BBOX_NUMBER_SAMPLES 4096
+
+
+/*!
+ * \brief Number of random curves of each kind.
+ */
+#define TEST_BBOX_NUMBER_CURVES 400
+
+
+/*!
+ * \brief Number of \c LINE entities in the drawing of
+ * test_bbox_extents (), enough for several ranges of
+ * \c DXF_WRITER_CHUNK_ENTITIES entities.
+ */
+#define TEST_BBOX_NUMBER_LINES 10000
+
+
+/*!
+ * \brief Return a pseudo random number in [\c low, \c high).
+ *
+ * The sequence is the same on every run.
+ */
+static double
+test_bbox_random
+(
+        uint32_t *state,
+                /*!< State of the generator. */
+        double low,
+                /*!< Lower limit of the number. */
+        double high
+                /*!< Upper limit of the number. */
+)
+{
+        *state = (*state * 1664525) + 1013904223;
+        return (low + ((high - low) * (*state >> 8) / 16777216.0));
+}
+
+
+/*!
+ * \brief Return an extrusion direction, cycling through the world
+ * Z-axis, the negative Z-axis, a direction close to the Z-axis (taking
+ * the other branch of the arbitrary axis algorithm) and a random
+ * direction, not always of unit length.
+ */
+static DxfVec3
+test_bbox_extrusion
+(
+        uint32_t *state,
+                /*!< State of the generator. */
+        int i
+                /*!< Number of the curve. */
+)
+{
+        DxfVec3 extrusion;
+
+        switch (i % 4)
+        {
+                case 0:
+                        extrusion.x = 0.0;
+                        extrusion.y = 0.0;
+                        extrusion.z = 1.0;
+                        break;
+                case 1:
+                        extrusion.x = 0.0;
+                        extrusion.y = 0.0;
+                        extrusion.z = -2.0;
+                        break;
+                case 2:
+                        extrusion.x = test_bbox_random (state, -0.01, 0.01);
+                        extrusion.y = test_bbox_random (state, -0.01, 0.01);
+                        extrusion.z = 1.0;
+                        break;
+                default:
+                        do
+                        {
+                                extrusion.x = test_bbox_random (state, -3.0, 3.0);
+                                extrusion.y = test_bbox_random (state, -3.0, 3.0);
+                                extrusion.z = test_bbox_random (state, -3.0, 3.0);
+                        }
+                        while ((fabs (extrusion.x) + fabs (extrusion.y) + fabs (extrusion.z)) < 0.1);
+                        break;
+        }
+        return (extrusion);
+}
+
+
+/*!
+ * \brief Compute the axes of an Object Coordinate System (OCS) with the
+ * arbitrary axis algorithm.
+ */
+static void
+test_bbox_ocs_axes
+(
+        DxfVec3 *extrusion,
+                /*!< Extrusion direction, not necessarily of unit
+                 * length. */
+        DxfVec3 *ax,
+                /*!< Returns the X-axis. */
+        DxfVec3 *ay,
+                /*!< Returns the Y-axis. */
+        DxfVec3 *az
+                /*!< Returns the Z-axis. */
+)
+{
+        double length;
+
+        length = sqrt ((extrusion->x * extrusion->x)
+          + (extrusion->y * extrusion->y)
+          + (extrusion->z * extrusion->z));
+        az->x = extrusion->x / length;
+        az->y = extrusion->y / length;
+        az->z = extrusion->z / length;
+        if ((fabs (az->x) < 1.0 / 64.0) && (fabs (az->y) < 1.0 / 64.0))
+        {
+                /* World Y-axis cross Z-axis. */
+                ax->x = az->z;
+                ax->y = 0.0;
+                ax->z = -az->x;
+        }
+        else
+        {
+                /* World Z-axis cross Z-axis. */
+                ax->x = -az->y;
+                ax->y = az->x;
+                ax->z = 0.0;
+        }
+        length = sqrt ((ax->x * ax->x) + (ax->y * ax->y) + (ax->z * ax->z));
+        ax->x /= length;
+        ax->y /= length;
+        ax->z /= length;
+        ay->x = (az->y * ax->z) - (az->z * ax->y);
+        ay->y = (az->z * ax->x) - (az->x * ax->z);
+        ay->z = (az->x * ax->y) - (az->y * ax->x);
+}
+
+
+/*!
+ * \brief Map a point from an Object Coordinate System (OCS) to world
+ * coordinates.
+ */
+static DxfVec3
+test_bbox_ocs_point
+(
+        DxfVec3 *ax,
+                /*!< X-axis of the OCS. */
+        DxfVec3 *ay,
+                /*!< Y-axis of the OCS. */
+        DxfVec3 *az,
+                /*!< Z-axis of the OCS. */
+        double x,
+                /*!< X-value of the point in the OCS. */
+        double y,
+                /*!< Y-value of the point in the OCS. */
+        double z
+                /*!< Z-value of the point in the OCS. */
+)
+{
+        DxfVec3 point;
+
+        point.x = (x * ax->x) + (y * ay->x) + (z * az->x);
+        point.y = (x * ax->y) + (y * ay->y) + (z * az->y);
+        point.z = (x * ax->z) + (y * ay->z) + (z * az->z);
+        return (point);
+}
+
+
+/*!
+ * \brief Sample a polyline segment with a bulge in the XY plane.
+ */
+static void
+test_bbox_sample_bulge
+(
+        double x0,
+                /*!< X-value of the start point. */
+        double y0,
+                /*!< Y-value of the start point. */
+        double x1,
+                /*!< X-value of the end point. */
+        double y1,
+                /*!< Y-value of the end point. */
+        double bulge,
+                /*!< Bulge of the segment. */
+        double *x,
+                /*!< Returns \c TEST_BBOX_NUMBER_SAMPLES X-values. */
+        double *y
+                /*!< Returns \c TEST_BBOX_NUMBER_SAMPLES Y-values. */
+)
+{
+        double chord;
+        double offset;
+        double cx;
+        double cy;
+        double radius;
+        double start;
+        double sweep;
+        double t;
+        int i;
+
+        chord = sqrt (((x1 - x0) * (x1 - x0)) + ((y1 - y0) * (y1 - y0)));
+        for (i = 0; i < TEST_BBOX_NUMBER_SAMPLES; i++)
+        {
+                t = (double) i / (TEST_BBOX_NUMBER_SAMPLES - 1);
+                x[i] = x0 + (t * (x1 - x0));
+                y[i] = y0 + (t * (y1 - y0));
+        }
+        if ((bulge == 0.0) || (chord == 0.0))
+        {
+                return;
+        }
+        /* The center lies on the perpendicular bisector of the chord, to
+         * the left of the direction from start to end point for a
+         * counterclockwise arc of less than half a circle. */
+        offset = (1.0 - (bulge * bulge)) / (4.0 * bulge);
+        cx = ((x0 + x1) / 2.0) - (offset * (y1 - y0));
+        cy = ((y0 + y1) / 2.0) + (offset * (x1 - x0));
+        radius = chord * (1.0 + (bulge * bulge)) / (4.0 * fabs (bulge));
+        start = atan2 (y0 - cy, x0 - cx);
+        sweep = 4.0 * atan (bulge);
+        for (i = 0; i < TEST_BBOX_NUMBER_SAMPLES; i++)
+        {
+                t = start + (sweep * i / (TEST_BBOX_NUMBER_SAMPLES - 1));
+                x[i] = cx + (radius * cos (t));
+                y[i] = cy + (radius * sin (t));
+        }
+}
+
+
+/*!
+ * \brief Compare a bounding box with sampled points.
+ *
+ * Every point has to be inside the box, and when \c tight every face
+ * of the box has to be touched by a point, within a tolerance relative
+ * to the size of the box.
+ *
+ * \return \c EXIT_SUCCESS when the box fits, or \c EXIT_FAILURE
+ * otherwise.
+ */
+static int
+test_bbox_check
+(
+        DxfBbox *bbox,
+                /*!< The box to check. */
+        DxfVec3 *points,
+                /*!< The sampled points. */
+        int number_points,
+                /*!< Number of \c points. */
+        int tight,
+                /*!< The box has to be the tightest box. */
+        const char *name,
+                /*!< Name of the curve, for the error message. */
+        int i
+                /*!< Number of the curve, for the error message. */
+)
+{
+        DxfVec3 low;
+        DxfVec3 high;
+        double size;
+        double tolerance;
+        int j;
+
+        low = points[0];
+        high = points[0];
+        for (j = 1; j < number_points; j++)
+        {
+                low.x = fmin (low.x, points[j].x);
+                low.y = fmin (low.y, points[j].y);
+                low.z = fmin (low.z, points[j].z);
+                high.x = fmax (high.x, points[j].x);
+                high.y = fmax (high.y, points[j].y);
+                high.z = fmax (high.z, points[j].z);
+        }
+        size = fmax (high.x - low.x, fmax (high.y - low.y, high.z - low.z));
+        tolerance = 1e-9 * (1.0 + fabs (low.x) + fabs (low.y) + fabs (low.z) + size);
+        if (dxf_bbox_is_empty (bbox)
+          || (bbox->min.x > low.x + tolerance)
+          || (bbox->min.y > low.y + tolerance)
+          || (bbox->min.z > low.z + tolerance)
+          || (bbox->max.x < high.x - tolerance)
+          || (bbox->max.y < high.y - tolerance)
+          || (bbox->max.z < high.z - tolerance))
+        {
+                fprintf (stderr, "Error in %s () %s %d is not inside it's bounding box.\n",
+                  __FUNCTION__, name, i);
+                return (EXIT_FAILURE);
+        }
+        /* The sampling misses the extremes by less than the sagitta of
+         * a sample step. */
+        tolerance += 1e-5 * size;
+        if ((tight)
+          && ((bbox->min.x < low.x - tolerance)
+          || (bbox->min.y < low.y - tolerance)
+          || (bbox->min.z < low.z - tolerance)
+          || (bbox->max.x > high.x + tolerance)
+          || (bbox->max.y > high.y + tolerance)
+          || (bbox->max.z > high.z + tolerance)))
+        {
+                fprintf (stderr, "Error in %s () the bounding box of %s %d is not tight.\n",
+                  __FUNCTION__, name, i);
+                return (EXIT_FAILURE);
+        }
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Test the bounding boxes of \c ARC entities, in the plane of
+ * their OCS.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+static int
+test_bbox_arcs
+(
+        DxfVec3 *points
+                /*!< Room for \c TEST_BBOX_NUMBER_SAMPLES points. */
+)
+{
+        DxfArc *arc;
+        DxfBbox bbox;
+        DxfVec3 extrusion;
+        DxfVec3 ax;
+        DxfVec3 ay;
+        DxfVec3 az;
+        uint32_t state = 1;
+        double sweep;
+        double angle;
+        int i;
+        int j;
+        int result = EXIT_SUCCESS;
+
+        arc = dxf_arc_init (dxf_arc_new ());
+        if (arc == NULL)
+        {
+                return (EXIT_FAILURE);
+        }
+        for (i = 0; i < TEST_BBOX_NUMBER_CURVES; i++)
+        {
+                extrusion = test_bbox_extrusion (&state, i);
+                arc->extr_x0 = extrusion.x;
+                arc->extr_y0 = extrusion.y;
+                arc->extr_z0 = extrusion.z;
+                arc->p0.x = test_bbox_random (&state, -100.0, 100.0);
+                arc->p0.y = test_bbox_random (&state, -100.0, 100.0);
+                arc->p0.z = test_bbox_random (&state, -100.0, 100.0);
+                arc->radius = test_bbox_random (&state, 0.1, 50.0);
+                arc->start_angle = test_bbox_random (&state, -720.0, 720.0);
+                /* Every tenth arc is a full circle. */
+                arc->end_angle = (i % 10 == 0) ? arc->start_angle
+                  : test_bbox_random (&state, -720.0, 720.0);
+                sweep = fmod (arc->end_angle - arc->start_angle, 360.0);
+                if (sweep <= 0.0)
+                {
+                        sweep += 360.0;
+                }
+                test_bbox_ocs_axes (&extrusion, &ax, &ay, &az);
+                for (j = 0; j < TEST_BBOX_NUMBER_SAMPLES; j++)
+                {
+                        angle = (arc->start_angle + (sweep * j / (TEST_BBOX_NUMBER_SAMPLES - 1))) * M_PI / 180.0;
+                        points[j] = test_bbox_ocs_point (&ax, &ay, &az,
+                          arc->p0.x + (arc->radius * cos (angle)),
+                          arc->p0.y + (arc->radius * sin (angle)),
+                          arc->p0.z);
+                }
+                if ((dxf_entity_get_bbox ("ARC", arc, &bbox) == EXIT_FAILURE)
+                  || (test_bbox_check (&bbox, points, TEST_BBOX_NUMBER_SAMPLES, TRUE, "ARC", i) == EXIT_FAILURE))
+                {
+                        result = EXIT_FAILURE;
+                }
+        }
+        dxf_arc_free (arc);
+        return (result);
+}
+
+
+/*!
+ * \brief Test the bounding boxes of \c ELLIPSE entities.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+static int
+test_bbox_ellipses
+(
+        DxfVec3 *points
+                /*!< Room for \c TEST_BBOX_NUMBER_SAMPLES points. */
+)
+{
+        DxfEllipse *ellipse;
+        DxfBbox bbox;
+        DxfVec3 extrusion;
+        DxfVec3 ax;
+        DxfVec3 ay;
+        DxfVec3 az;
+        DxfVec3 major;
+        DxfVec3 minor;
+        uint32_t state = 2;
+        double sweep;
+        double angle;
+        double a;
+        double b;
+        int i;
+        int j;
+        int result = EXIT_SUCCESS;
+
+        ellipse = dxf_ellipse_init (dxf_ellipse_new ());
+        if (ellipse == NULL)
+        {
+                return (EXIT_FAILURE);
+        }
+        ellipse->p0 = dxf_point_init (dxf_point_new ());
+        ellipse->p1 = dxf_point_init (dxf_point_new ());
+        if ((ellipse->p0 == NULL) || (ellipse->p1 == NULL))
+        {
+                dxf_ellipse_free (ellipse);
+                return (EXIT_FAILURE);
+        }
+        for (i = 0; i < TEST_BBOX_NUMBER_CURVES; i++)
+        {
+                extrusion = test_bbox_extrusion (&state, i);
+                test_bbox_ocs_axes (&extrusion, &ax, &ay, &az);
+                /* A major axis in the plane of the ellipse. */
+                a = test_bbox_random (&state, 1.0, 50.0);
+                angle = test_bbox_random (&state, 0.0, 2.0 * M_PI);
+                major = test_bbox_ocs_point (&ax, &ay, &az,
+                  a * cos (angle), a * sin (angle), 0.0);
+                ellipse->extr_x0 = extrusion.x;
+                ellipse->extr_y0 = extrusion.y;
+                ellipse->extr_z0 = extrusion.z;
+                ellipse->p0->x0 = test_bbox_random (&state, -100.0, 100.0);
+                ellipse->p0->y0 = test_bbox_random (&state, -100.0, 100.0);
+                ellipse->p0->z0 = test_bbox_random (&state, -100.0, 100.0);
+                ellipse->p1->x0 = major.x;
+                ellipse->p1->y0 = major.y;
+                ellipse->p1->z0 = major.z;
+                ellipse->ratio = test_bbox_random (&state, 0.05, 1.0);
+                ellipse->start_angle = test_bbox_random (&state, -2.0 * M_PI, 4.0 * M_PI);
+                /* Every tenth ellipse is closed. */
+                ellipse->end_angle = (i % 10 == 0) ? ellipse->start_angle
+                  : test_bbox_random (&state, -2.0 * M_PI, 4.0 * M_PI);
+                sweep = fmod (ellipse->end_angle - ellipse->start_angle, 2.0 * M_PI);
+                if (sweep <= 0.0)
+                {
+                        sweep += 2.0 * M_PI;
+                }
+                /* The minor axis is the major axis turned a quarter
+                 * counterclockwise around the extrusion direction. */
+                b = ellipse->ratio;
+                minor.x = b * ((az.y * major.z) - (az.z * major.y));
+                minor.y = b * ((az.z * major.x) - (az.x * major.z));
+                minor.z = b * ((az.x * major.y) - (az.y * major.x));
+                for (j = 0; j < TEST_BBOX_NUMBER_SAMPLES; j++)
+                {
+                        angle = ellipse->start_angle + (sweep * j / (TEST_BBOX_NUMBER_SAMPLES - 1));
+                        points[j].x = ellipse->p0->x0 + (cos (angle) * major.x) + (sin (angle) * minor.x);
+                        points[j].y = ellipse->p0->y0 + (cos (angle) * major.y) + (sin (angle) * minor.y);
+                        points[j].z = ellipse->p0->z0 + (cos (angle) * major.z) + (sin (angle) * minor.z);
+                }
+                if ((dxf_entity_get_bbox ("ELLIPSE", ellipse, &bbox) == EXIT_FAILURE)
+                  || (test_bbox_check (&bbox, points, TEST_BBOX_NUMBER_SAMPLES, TRUE, "ELLIPSE", i) == EXIT_FAILURE))
+                {
+                        result = EXIT_FAILURE;
+                }
+        }
+        dxf_ellipse_free (ellipse);
+        return (result);
+}
+
+
+/*!
+ * \brief Test the bounding boxes of bulged segments and of
+ * \c LWPOLYLINE entities in the plane of their OCS.
+ *
+ * A box computed in an OCS and mapped to world coordinates is not the
+ * tightest box, so the box of an \c LWPOLYLINE is only required to be
+ * tight for the world Z-axis as extrusion direction.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+static int
+test_bbox_bulges
+(
+        DxfVec3 *points
+                /*!< Room for 4 times \c TEST_BBOX_NUMBER_SAMPLES
+                 * points. */
+)
+{
+        static double x[TEST_BBOX_NUMBER_SAMPLES];
+        static double y[TEST_BBOX_NUMBER_SAMPLES];
+        DxfLWPolyline *lwpolyline;
+        DxfBbox bbox;
+        DxfVec3 extrusion;
+        DxfVec3 ax;
+        DxfVec3 ay;
+        DxfVec3 az;
+        uint32_t state = 3;
+        double vx[4];
+        double vy[4];
+        double vb[4];
+        double z;
+        int number_points;
+        int i;
+        int j;
+        int k;
+        int result = EXIT_SUCCESS;
+
+        for (i = 0; i < TEST_BBOX_NUMBER_CURVES; i++)
+        {
+                vx[0] = test_bbox_random (&state, -100.0, 100.0);
+                vy[0] = test_bbox_random (&state, -100.0, 100.0);
+                vx[1] = vx[0] + test_bbox_random (&state, -50.0, 50.0);
+                vy[1] = vy[0] + test_bbox_random (&state, -50.0, 50.0);
+                vb[0] = (i % 10 == 0) ? 0.0 : test_bbox_random (&state, -4.0, 4.0);
+                z = test_bbox_random (&state, -10.0, 10.0);
+                test_bbox_sample_bulge (vx[0], vy[0], vx[1], vy[1], vb[0], x, y);
+                for (j = 0; j < TEST_BBOX_NUMBER_SAMPLES; j++)
+                {
+                        points[j].x = x[j];
+                        points[j].y = y[j];
+                        points[j].z = z;
+                }
+                dxf_bbox_init (&bbox);
+                if ((dxf_bbox_add_bulge (&bbox, vx[0], vy[0], vx[1], vy[1], z, vb[0]) == NULL)
+                  || (test_bbox_check (&bbox, points, TEST_BBOX_NUMBER_SAMPLES, TRUE, "bulge", i) == EXIT_FAILURE))
+                {
+                        result = EXIT_FAILURE;
+                }
+        }
+        for (i = 0; i < TEST_BBOX_NUMBER_CURVES; i++)
+        {
+                lwpolyline = dxf_lwpolyline_init (dxf_lwpolyline_new ());
+                if (lwpolyline == NULL)
+                {
+                        return (EXIT_FAILURE);
+                }
+                extrusion = test_bbox_extrusion (&state, i);
+                lwpolyline->extr_x0 = extrusion.x;
+                lwpolyline->extr_y0 = extrusion.y;
+                lwpolyline->extr_z0 = extrusion.z;
+                lwpolyline->elevation = test_bbox_random (&state, -10.0, 10.0);
+                /* Every other polyline is closed. */
+                lwpolyline->flag = i % 2;
+                for (j = 0; j < 4; j++)
+                {
+                        vx[j] = test_bbox_random (&state, -100.0, 100.0);
+                        vy[j] = test_bbox_random (&state, -100.0, 100.0);
+                        vb[j] = (j == i % 4) ? 0.0 : test_bbox_random (&state, -2.0, 2.0);
+                        if (dxf_lwpolyline_append_vertex (lwpolyline, vx[j], vy[j], 0.0, 0.0, vb[j]) == NULL)
+                        {
+                                result = EXIT_FAILURE;
+                        }
+                }
+                test_bbox_ocs_axes (&extrusion, &ax, &ay, &az);
+                number_points = 0;
+                for (j = 0; j < ((i % 2) ? 4 : 3); j++)
+                {
+                        test_bbox_sample_bulge (vx[j], vy[j], vx[(j + 1) % 4],
+                          vy[(j + 1) % 4], vb[j], x, y);
+                        for (k = 0; k < TEST_BBOX_NUMBER_SAMPLES; k++)
+                        {
+                                points[number_points++] = test_bbox_ocs_point (&ax, &ay, &az,
+                                  x[k], y[k], lwpolyline->elevation);
+                        }
+                }
+                if ((dxf_entity_get_bbox ("LWPOLYLINE", lwpolyline, &bbox) == EXIT_FAILURE)
+                  || (test_bbox_check (&bbox, points, number_points, (i % 4 == 0),
+                  "LWPOLYLINE", i) == EXIT_FAILURE))
+                {
+                        result = EXIT_FAILURE;
+                }
+                dxf_lwpolyline_free (lwpolyline);
+        }
+        return (result);
+}
+
+
+/*!
+ * \brief Test updating the extents of a drawing.
+ *
+ * The drawing holds \c LINE entities in model space, \c CIRCLE entities
+ * in paper space, and \c RAY entities and unresolved \c INSERT entities
+ * without a bounding box.\n
+ * The extents have to replace stale header variables, leave those of a
+ * space without entities alone, count the entities without a bounding
+ * box, and be the same for any number of threads.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+static int
+test_bbox_extents (void)
+{
+        DxfDrawing *drawing;
+        DxfHeader *header;
+        DxfEntities *entities;
+        DxfLine *line;
+        DxfCircle *circle;
+        DxfRay *ray;
+        DxfInsert *insert;
+        DxfBbox model;
+        DxfBbox paper;
+        uint32_t state = 4;
+        size_t number_skipped;
+        int number_threads;
+        int i;
+        int result = EXIT_SUCCESS;
+
+        drawing = dxf_drawing_new ();
+        header = dxf_header_init (dxf_header_new (), AutoCAD_2000);
+        entities = dxf_entities_new ();
+        if ((drawing == NULL) || (header == NULL) || (entities == NULL))
+        {
+                return (EXIT_FAILURE);
+        }
+        dxf_drawing_set_header (drawing, header);
+        drawing->entities_list = (struct DxfEntities *) entities;
+        dxf_bbox_init (&model);
+        dxf_bbox_init (&paper);
+        for (i = 0; i < TEST_BBOX_NUMBER_LINES; i++)
+        {
+                line = dxf_line_init (dxf_line_new ());
+                if (line == NULL)
+                {
+                        return (EXIT_FAILURE);
+                }
+                line->p0.x = test_bbox_random (&state, -500.0, 1500.0);
+                line->p0.y = test_bbox_random (&state, -800.0, 200.0);
+                line->p0.z = test_bbox_random (&state, -5.0, 5.0);
+                line->p1.x = line->p0.x + test_bbox_random (&state, -20.0, 20.0);
+                line->p1.y = line->p0.y + test_bbox_random (&state, -20.0, 20.0);
+                line->p1.z = line->p0.z;
+                line->next = entities->line_list;
+                entities->line_list = (struct DxfLine *) line;
+                dxf_bbox_add_point (&model, line->p0.x, line->p0.y, line->p0.z);
+                dxf_bbox_add_point (&model, line->p1.x, line->p1.y, line->p1.z);
+        }
+        for (i = 0; i < 25; i++)
+        {
+                ray = dxf_ray_init (dxf_ray_new ());
+                insert = dxf_insert_init (dxf_insert_new ());
+                if ((ray == NULL) || (insert == NULL))
+                {
+                        return (EXIT_FAILURE);
+                }
+                ray->next = entities->ray_list;
+                entities->ray_list = (struct DxfRay *) ray;
+                dxf_free (insert->block_name);
+                insert->block_name = dxf_strdup ("NO_SUCH_BLOCK");
+                insert->next = entities->insert_list;
+                entities->insert_list = (struct DxfInsert *) insert;
+        }
+        /* Stale extents, and paper space extents without paper space
+         * entities. */
+        header->ExtMin.x0 = header->ExtMin.y0 = header->ExtMin.z0 = -1e9;
+        header->ExtMax.x0 = header->ExtMax.y0 = header->ExtMax.z0 = 1e9;
+        header->PExtMin.x0 = header->PExtMin.y0 = header->PExtMin.z0 = 1.0;
+        header->PExtMax.x0 = header->PExtMax.y0 = header->PExtMax.z0 = 2.0;
+        if ((dxf_drawing_update_extents (drawing, 1, &number_skipped) == EXIT_FAILURE)
+          || (number_skipped != 50)
+          || (header->ExtMin.x0 != model.min.x) || (header->ExtMin.y0 != model.min.y)
+          || (header->ExtMin.z0 != model.min.z) || (header->ExtMax.x0 != model.max.x)
+          || (header->ExtMax.y0 != model.max.y) || (header->ExtMax.z0 != model.max.z)
+          || (header->PExtMin.x0 != 1.0) || (header->PExtMax.x0 != 2.0))
+        {
+                fprintf (stderr, "Error in %s () updating the model space extents.\n",
+                  __FUNCTION__);
+                result = EXIT_FAILURE;
+        }
+        for (i = 0; i < 40; i++)
+        {
+                circle = dxf_circle_init (dxf_circle_new ());
+                if (circle == NULL)
+                {
+                        return (EXIT_FAILURE);
+                }
+                if (circle->p0 == NULL)
+                {
+                        circle->p0 = dxf_point_init (dxf_point_new ());
+                }
+                circle->paperspace = DXF_PAPERSPACE;
+                circle->extr_x0 = 0.0;
+                circle->extr_y0 = 0.0;
+                circle->extr_z0 = 1.0;
+                circle->p0->x0 = test_bbox_random (&state, 0.0, 420.0);
+                circle->p0->y0 = test_bbox_random (&state, 0.0, 297.0);
+                circle->radius = test_bbox_random (&state, 1.0, 10.0);
+                circle->next = entities->circle_list;
+                entities->circle_list = (struct DxfCircle *) circle;
+                dxf_bbox_add_point (&paper, circle->p0->x0 - circle->radius,
+                  circle->p0->y0 - circle->radius, 0.0);
+                dxf_bbox_add_point (&paper, circle->p0->x0 + circle->radius,
+                  circle->p0->y0 + circle->radius, 0.0);
+        }
+        for (number_threads = 1; number_threads <= 4; number_threads += 3)
+        {
+                if ((dxf_drawing_update_extents (drawing, number_threads, &number_skipped) == EXIT_FAILURE)
+                  || (number_skipped != 50)
+                  || (header->ExtMin.x0 != model.min.x) || (header->ExtMin.y0 != model.min.y)
+                  || (header->ExtMin.z0 != model.min.z) || (header->ExtMax.x0 != model.max.x)
+                  || (header->ExtMax.y0 != model.max.y) || (header->ExtMax.z0 != model.max.z)
+                  || (fabs (header->PExtMin.x0 - paper.min.x) > 1e-9)
+                  || (fabs (header->PExtMin.y0 - paper.min.y) > 1e-9)
+                  || (fabs (header->PExtMax.x0 - paper.max.x) > 1e-9)
+                  || (fabs (header->PExtMax.y0 - paper.max.y) > 1e-9))
+                {
+                        fprintf (stderr, "Error in %s () updating the extents with %d threads.\n",
+                          __FUNCTION__, number_threads);
+                        result = EXIT_FAILURE;
+                }
+        }
+        dxf_drawing_free (drawing);
+        return (result);
+}
+
+
+/*!
+ * \brief Count the \c POLYLINE entities found by a spatial index
+ * search.
+ */
+static int
+test_bbox_on_polyline
+(
+        const char *type,
+        void *entity,
+        void *user_data
+)
+{
+        (void) entity;
+        if (strcmp (type, "POLYLINE") == 0)
+        {
+                (*(int *) user_data)++;
+        }
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Test the bounding box and the extents of a \c POLYLINE read
+ * from a file.
+ *
+ * The \c VERTEX entities following the \c POLYLINE entity have to be
+ * read into it's list of vertices, so the polyline reaches outside the
+ * \c LINE entities of the drawing, in the extents and in a spatial
+ * index.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+static int
+test_bbox_read_polyline (void)
+{
+        static const double vertices[][3] =
+        {
+                {-50.0, 10.0, 2.0},
+                {30.0, 80.0, -4.0},
+                {120.0, -60.0, 6.0}
+        };
+        DxfDrawing *drawing;
+        DxfHeader *header;
+        DxfEntities *entities;
+        DxfPolyline *polyline;
+        DxfVertex *vertex;
+        DxfSpatialIndexTree *tree;
+        DxfBbox bbox;
+        DxfBbox window;
+        DxfFile *fp;
+        FILE *file;
+        size_t number_skipped;
+        int found = 0;
+        int i;
+        int result = EXIT_SUCCESS;
+
+        file = fopen ("test_bbox.dxf", "w");
+        if (file == NULL)
+        {
+                return (EXIT_FAILURE);
+        }
+        fprintf (file, "  0\nSECTION\n  2\nHEADER\n  9\n$ACADVER\n  1\nAC1015\n  0\nENDSEC\n");
+        fprintf (file, "  0\nSECTION\n  2\nENTITIES\n");
+        fprintf (file, "  0\nLINE\n  5\n100\n  8\n0\n"
+          " 10\n0.0\n 20\n0.0\n 30\n0.0\n 11\n10.0\n 21\n10.0\n 31\n0.0\n");
+        fprintf (file, "  0\nPOLYLINE\n  5\n101\n  8\n0\n 66\n1\n"
+          " 10\n0.0\n 20\n0.0\n 30\n0.0\n 70\n8\n");
+        for (i = 0; i < 3; i++)
+        {
+                fprintf (file, "  0\nVERTEX\n  5\n%X\n  8\n0\n"
+                  " 10\n%f\n 20\n%f\n 30\n%f\n 70\n32\n",
+                  0x102 + i, vertices[i][0], vertices[i][1], vertices[i][2]);
+        }
+        fprintf (file, "  0\nSEQEND\n  5\n105\n  8\n0\n");
+        fprintf (file, "  0\nLINE\n  5\n106\n  8\n0\n"
+          " 10\n5.0\n 20\n5.0\n 30\n0.0\n 11\n15.0\n 21\n15.0\n 31\n0.0\n");
+        fprintf (file, "  0\nENDSEC\n  0\nEOF\n");
+        if (fclose (file) != 0)
+        {
+                return (EXIT_FAILURE);
+        }
+        drawing = dxf_drawing_new ();
+        fp = dxf_read_init ("test_bbox.dxf");
+        if ((drawing == NULL) || (fp == NULL))
+        {
+                return (EXIT_FAILURE);
+        }
+        result = dxf_drawing_read_sections (drawing, fp, NULL,
+          DXF_SECTION_HEADER | DXF_SECTION_ENTITIES);
+        dxf_read_close (fp);
+        remove ("test_bbox.dxf");
+        header = (DxfHeader *) drawing->header;
+        entities = (DxfEntities *) drawing->entities_list;
+        if ((result == EXIT_FAILURE) || (header == NULL) || (entities == NULL)
+          || (entities->polyline_list == NULL) || (entities->vertex_list != NULL))
+        {
+                fprintf (stderr, "Error in %s () reading the polyline.\n",
+                  __FUNCTION__);
+                dxf_drawing_free (drawing);
+                return (EXIT_FAILURE);
+        }
+        polyline = (DxfPolyline *) entities->polyline_list;
+        for (i = 0, vertex = polyline->vertices;
+          vertex != NULL;
+          i++, vertex = (DxfVertex *) vertex->next)
+        {
+                if ((i >= 3)
+                  || (vertex->p0.x != vertices[i][0])
+                  || (vertex->p0.y != vertices[i][1])
+                  || (vertex->p0.z != vertices[i][2]))
+                {
+                        break;
+                }
+        }
+        if ((vertex != NULL) || (i != 3))
+        {
+                fprintf (stderr, "Error in %s () the vertices are not read into the polyline.\n",
+                  __FUNCTION__);
+                result = EXIT_FAILURE;
+        }
+        if ((dxf_polyline_get_bbox (polyline, &bbox) == EXIT_FAILURE)
+          || (bbox.min.x != -50.0) || (bbox.min.y != -60.0) || (bbox.min.z != -4.0)
+          || (bbox.max.x != 120.0) || (bbox.max.y != 80.0) || (bbox.max.z != 6.0))
+        {
+                fprintf (stderr, "Error in %s () bounding box of the polyline.\n",
+                  __FUNCTION__);
+                result = EXIT_FAILURE;
+        }
+        if ((dxf_drawing_update_extents (drawing, 1, &number_skipped) == EXIT_FAILURE)
+          || (number_skipped != 0)
+          || (header->ExtMin.x0 != -50.0) || (header->ExtMin.y0 != -60.0)
+          || (header->ExtMin.z0 != -4.0) || (header->ExtMax.x0 != 120.0)
+          || (header->ExtMax.y0 != 80.0) || (header->ExtMax.z0 != 6.0))
+        {
+                fprintf (stderr, "Error in %s () extents of the polyline.\n",
+                  __FUNCTION__);
+                result = EXIT_FAILURE;
+        }
+        tree = dxf_spatial_index_tree_new ();
+        dxf_bbox_init (&window);
+        dxf_bbox_add_point (&window, 100.0, -50.0, 0.0);
+        dxf_bbox_add_point (&window, 130.0, -40.0, 0.0);
+        if ((tree == NULL)
+          || (dxf_spatial_index_tree_add_entities (tree, entities) == EXIT_FAILURE)
+          || (dxf_spatial_index_tree_search_window (tree, &window,
+          test_bbox_on_polyline, &found) == EXIT_FAILURE)
+          || (found != 1))
+        {
+                fprintf (stderr, "Error in %s () spatial index search for the polyline.\n",
+                  __FUNCTION__);
+                result = EXIT_FAILURE;
+        }
+        if (tree != NULL)
+        {
+                dxf_spatial_index_tree_free (tree);
+        }
+        dxf_drawing_free (drawing);
+        return (result);
+}
+
+
+/*!
+ * \brief Test bounding boxes and the extents of a drawing.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+test_bbox (void)
+{
+        DxfVec3 *points;
+        int result = EXIT_SUCCESS;
+
+        points = malloc (4 * TEST_BBOX_NUMBER_SAMPLES * sizeof (DxfVec3));
+        if (points == NULL)
+        {
+                return (EXIT_FAILURE);
+        }
+        if ((test_bbox_arcs (points) == EXIT_FAILURE)
+          || (test_bbox_ellipses (points) == EXIT_FAILURE)
+          || (test_bbox_bulges (points) == EXIT_FAILURE))
+        {
+                result = EXIT_FAILURE;
+        }
+        free (points);
+        if ((test_bbox_extents () == EXIT_FAILURE)
+          || (test_bbox_read_polyline () == EXIT_FAILURE))
+        {
+                result = EXIT_FAILURE;
+        }
+        return (result);
+}
+
+
+/* EOF */
@@ -0,0 +1,329 @@
+/*!
+ * \file test_binary.c
+ *
+ * \author Copyright (C) 2026
+ * by Bert Timmerman <bert.timmerman@xs4all.nl>.
+ *
+ * \brief Testing program for writing binary DXF files, records written
+ * in binary have to read back as the same records written in ASCII, for
+ * DXF R12 (1 byte group codes) and later releases (2 byte group codes).
+ *
+ * <hr>
+ * <h1><b>Copyright Notices.</b></h1>\n
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License,
+ * or (at your option) any later version.\n\n
+ * This program is distributed in the hope that it will be useful, but
+ * <b>WITHOUT ANY WARRANTY</b>; without even the implied warranty of
+ * <b>MERCHANTABILITY</b> or <b>FITNESS FOR A PARTICULAR PURPOSE</b>.\n
+ * See the GNU General Public License for more details.\n\n
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to:\n
+ * Free Software Foundation, Inc.,\n
+ * 59 Temple Place,\n
+ * Suite 330,\n
+ * Boston,\n
+ * MA 02111 USA.\n
+ * \n
+ * Drawing eXchange Format (DXF) is a defacto industry standard for the
+ * exchange of drawing files between various Computer Aided Drafting
+ * programs.\n
+ * DXF is an industry standard designed by Autodesk(TM).\n
+ * For more details see http://www.autodesk.com.
+ * <hr>
+ */
+
+
+#include <stdio.h>
+#include <string.h>
+#include "includes.h"
+
+
+/*!
+ * \brief The example files written by the tests, with the version they
+ * are written as.
+ *
+ * The version written has to match the \c $ACADVER of the drawing read
+ * back, DXF R2000 drawings are written as DXF R13, which has no
+ * \c OBJECTS section with a time stamp.
+ */
+static const struct
+{
+        const char *filename;
+        int acad_version_number;
+} test_binary_examples[] =
+{
+        {"all_R10_entities.dxf", AutoCAD_12},
+        {"blender-monkey_head_example_R12.dxf", AutoCAD_12},
+        {"qcad-example_R12.dxf", AutoCAD_12},
+        {"qcad-example_R2000.dxf", AutoCAD_13},
+        {"zcad-teapot_R2000.dxf", AutoCAD_13}
+};
+
+
+/*!
+ * \brief Write a set of records of every value type.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+static int
+test_binary_write_records
+(
+        const char *filename,
+                /*!< Name of the file to write. */
+        int binary,
+                /*!< Write a binary DXF file. */
+        int acad_version_number
+                /*!< AutoCAD version number of the file. */
+)
+{
+        DxfFile *fp;
+        int result = EXIT_SUCCESS;
+
+        fp = (binary) ? dxf_write_init_binary (filename) : dxf_write_init (filename);
+        if (fp == NULL)
+        {
+                return (EXIT_FAILURE);
+        }
+        fp->acad_version_number = acad_version_number;
+        result |= dxf_write_string (fp, 0, "SECTION");
+        result |= dxf_write_string (fp, 2, "ENTITIES");
+        result |= dxf_write_string (fp, 0, "LINE");
+        result |= dxf_write_hex (fp, 5, 0x2F4A);
+        result |= dxf_write_string (fp, 8, "Layer with spaces");
+        result |= dxf_write_int (fp, 62, -7);
+        result |= dxf_write_double (fp, 10, 1.0 / 3.0);
+        result |= dxf_write_double (fp, 20, -1e-300);
+        result |= dxf_write_double (fp, 30, 0.0);
+        result |= dxf_write_double (fp, 39, 12345678.875);
+        result |= dxf_write_int (fp, 70, 32767);
+        result |= dxf_write_int (fp, 90, -2147483647);
+        result |= dxf_write_int (fp, 160, 1234567890123LL);
+        result |= dxf_write_int (fp, 290, 1);
+        result |= dxf_write_string (fp, 310, "00FF10A5C3");
+        result |= dxf_write_slice (fp, 1, "text slice, cut here", 10);
+        result |= dxf_write_string (fp, 1001, "APPLICATION");
+        result |= dxf_write_string (fp, 1000, "extended string");
+        result |= dxf_write_double (fp, 1010, 2.5);
+        result |= dxf_write_double (fp, 1020, -3.75);
+        result |= dxf_write_double (fp, 1030, 1e22);
+        result |= dxf_write_double (fp, 1040, 0.1);
+        result |= dxf_write_int (fp, 1070, -12);
+        result |= dxf_write_int (fp, 1071, 2000000000);
+        result |= dxf_write_string (fp, 1004, "DEADBEEF");
+        result |= dxf_write_string (fp, 0, "ENDSEC");
+        result |= dxf_write_string (fp, 0, "EOF");
+        if (dxf_write_close (fp) == EXIT_FAILURE)
+        {
+                result = EXIT_FAILURE;
+        }
+        return ((result == EXIT_SUCCESS) ? EXIT_SUCCESS : EXIT_FAILURE);
+}
+
+
+/*!
+ * \brief Compare the records of an ASCII and a binary DXF file.
+ *
+ * Group codes and strings have to be identical, numbers have to read
+ * as the same value.
+ *
+ * \return \c EXIT_SUCCESS when the files hold the same records, or
+ * \c EXIT_FAILURE otherwise.
+ */
+static int
+test_binary_compare_records
+(
+        const char *ascii_filename,
+                /*!< Name of the ASCII file. */
+        const char *binary_filename,
+                /*!< Name of the binary file. */
+        int group_code_size
+                /*!< Size of a group code in the binary file. */
+)
+{
+        DxfFile *ascii;
+        DxfFile *binary;
+        const char *ascii_value;
+        const char *binary_value;
+        size_t ascii_length;
+        size_t binary_length;
+        double ascii_double;
+        double binary_double;
+        int ascii_group_code;
+        int binary_group_code;
+        int number_records = 0;
+        int result = EXIT_SUCCESS;
+
+        ascii = dxf_read_init (ascii_filename);
+        binary = dxf_read_init (binary_filename);
+        if ((ascii == NULL) || (binary == NULL)
+          || (ascii->reader->binary != 0)
+          || (binary->reader->binary != group_code_size))
+        {
+                result = EXIT_FAILURE;
+        }
+        while (result == EXIT_SUCCESS)
+        {
+                if (dxf_reader_next_pair (ascii, &ascii_group_code, &ascii_value, &ascii_length) == EXIT_FAILURE)
+                {
+                        /* Both files have to end at the same record. */
+                        if (dxf_reader_next_pair (binary, &binary_group_code, &binary_value, &binary_length) == EXIT_SUCCESS)
+                        {
+                                result = EXIT_FAILURE;
+                        }
+                        break;
+                }
+                number_records++;
+                if ((dxf_reader_next_pair (binary, &binary_group_code, &binary_value, &binary_length) == EXIT_FAILURE)
+                  || (ascii_group_code != binary_group_code))
+                {
+                        result = EXIT_FAILURE;
+                }
+                else if (((ascii_length != binary_length)
+                  || (memcmp (ascii_value, binary_value, ascii_length) != 0))
+                  && ((dxf_reader_parse_double (ascii_value, ascii_length, &ascii_double) == EXIT_FAILURE)
+                  || (dxf_reader_parse_double (binary_value, binary_length, &binary_double) == EXIT_FAILURE)
+                  || (ascii_double != binary_double)))
+                {
+                        result = EXIT_FAILURE;
+                }
+                if (result == EXIT_FAILURE)
+                {
+                        fprintf (stderr, "Error in %s () record %d of %s differs.\n",
+                          __FUNCTION__, number_records, binary_filename);
+                }
+        }
+        if (number_records == 0)
+        {
+                result = EXIT_FAILURE;
+        }
+        if (ascii != NULL)
+        {
+                dxf_read_close (ascii);
+        }
+        if (binary != NULL)
+        {
+                dxf_read_close (binary);
+        }
+        return (result);
+}
+
+
+/*!
+ * \brief Read the sections of a DXF file into a new drawing and write
+ * the drawing back.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+static int
+test_binary_copy
+(
+        const char *filename,
+                /*!< Name of the file to read. */
+        const char *output,
+                /*!< Name of the file to write. */
+        int binary,
+                /*!< Write a binary DXF file. */
+        int acad_version_number
+                /*!< AutoCAD version number of the file to write. */
+)
+{
+        DxfDrawing *drawing;
+        DxfFile *fp;
+        int result;
+
+        drawing = dxf_drawing_new ();
+        fp = dxf_read_init (filename);
+        if ((drawing == NULL) || (fp == NULL))
+        {
+                return (EXIT_FAILURE);
+        }
+        result = dxf_drawing_read_sections (drawing, fp, NULL,
+          DXF_SECTION_HEADER | DXF_SECTION_TABLES | DXF_SECTION_BLOCKS
+          | DXF_SECTION_ENTITIES);
+        dxf_read_close (fp);
+        fp = (binary) ? dxf_write_init_binary (output) : dxf_write_init (output);
+        if (fp == NULL)
+        {
+                dxf_drawing_free (drawing);
+                return (EXIT_FAILURE);
+        }
+        fp->acad_version_number = acad_version_number;
+        if (dxf_file_write (fp, drawing, 1) == EXIT_FAILURE)
+        {
+                result = EXIT_FAILURE;
+        }
+        if (dxf_write_close (fp) == EXIT_FAILURE)
+        {
+                result = EXIT_FAILURE;
+        }
+        dxf_drawing_free (drawing);
+        return (result);
+}
+
+
+/*!
+ * \brief Test writing binary DXF files.
+ *
+ * A set of records of every value type is written in ASCII and in
+ * binary, for DXF R12 and DXF R2000, both files have to hold the same
+ * records.\n
+ * Every example drawing is written as ASCII DXF and as binary DXF,
+ * both files have to hold the same records, and both files read back
+ * and written as ASCII DXF have to be identical.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+test_binary (void)
+{
+        static const int versions[] = {AutoCAD_12, AutoCAD_13, AutoCAD_2000};
+        char filename[256];
+        size_t i;
+        size_t j;
+        int version;
+        int result = EXIT_SUCCESS;
+
+        for (j = 0; j < sizeof (versions) / sizeof (versions[0]); j++)
+        {
+                if ((test_binary_write_records ("test_binary_ascii.dxf", FALSE, versions[j]) == EXIT_FAILURE)
+                  || (test_binary_write_records ("test_binary.dxf", TRUE, versions[j]) == EXIT_FAILURE)
+                  || (test_binary_compare_records ("test_binary_ascii.dxf", "test_binary.dxf",
+                  (versions[j] < AutoCAD_13) ? 1 : 2) == EXIT_FAILURE))
+                {
+                        fprintf (stderr, "Error in %s () writing records for version %d.\n",
+                          __FUNCTION__, versions[j]);
+                        result = EXIT_FAILURE;
+                }
+        }
+        for (i = 0; i < sizeof (test_binary_examples) / sizeof (test_binary_examples[0]); i++)
+        {
+                snprintf (filename, sizeof (filename), "%s%s",
+                  TESTS_EXAMPLES_DIR, test_binary_examples[i].filename);
+                version = test_binary_examples[i].acad_version_number;
+                if ((test_binary_copy (filename, "test_binary_ascii.dxf", FALSE, version) == EXIT_FAILURE)
+                  || (test_binary_copy (filename, "test_binary.dxf", TRUE, version) == EXIT_FAILURE)
+                  || (test_binary_compare_records ("test_binary_ascii.dxf", "test_binary.dxf",
+                  (version < AutoCAD_13) ? 1 : 2) == EXIT_FAILURE)
+                  || (test_binary_copy ("test_binary_ascii.dxf", "test_binary_ascii_copy.dxf", FALSE, version) == EXIT_FAILURE)
+                  || (test_binary_copy ("test_binary.dxf", "test_binary_copy.dxf", FALSE, version) == EXIT_FAILURE)
+                  || (test_read_compare ("test_binary_ascii_copy.dxf", "test_binary_copy.dxf") == EXIT_FAILURE))
+                {
+                        fprintf (stderr, "Error in %s () writing %s for version %d.\n",
+                          __FUNCTION__, filename, version);
+                        result = EXIT_FAILURE;
+                }
+        }
+        remove ("test_binary_ascii.dxf");
+        remove ("test_binary.dxf");
+        remove ("test_binary_ascii_copy.dxf");
+        remove ("test_binary_copy.dxf");
+        return (result);
+}
+
+
+/* EOF */
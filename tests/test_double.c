@@ -0,0 +1,238 @@
+/*!
+ * \file test_double.c
+ *
+ * \author Copyright (C) 2026
+ * by Bert Timmerman <bert.timmerman@xs4all.nl>.
+ *
+ * \brief Testing program for formatting and parsing doubles, values
+ * formatted by dxf_format_double () have to parse back to the same value
+ * and dxf_reader_parse_double () has to agree with strtod ().
+ *
+ * <hr>
+ * <h1><b>Copyright Notices.</b></h1>\n
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License,
+ * or (at your option) any later version.\n\n
+ * This program is distributed in the hope that it will be useful, but
+ * <b>WITHOUT ANY WARRANTY</b>; without even the implied warranty of
+ * <b>MERCHANTABILITY</b> or <b>FITNESS FOR A PARTICULAR PURPOSE</b>.\n
+ * See the GNU General Public License for more details.\n\n
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to:\n
+ * Free Software Foundation, Inc.,\n
+ * 59 Temple Place,\n
+ * Suite 330,\n
+ * Boston,\n
+ * MA 02111 USA.\n
+ * \n
+ * Drawing eXchange Format (DXF) is a defacto industry standard for the
+ * exchange of drawing files between various Computer Aided Drafting
+ * programs.\n
+ * DXF is an industry standard designed by Autodesk(TM).\n
+ * For more details see http://www.autodesk.com.
+ * <hr>
+ */
+
+
+#include <stdio.h>
+#include <string.h>
+#include <stdlib.h>
+#include <inttypes.h>
+#include <math.h>
+#include <float.h>
+#include "includes.h"
+
+
+/*!
+ * \brief Number of random values tested.
+ */
+#define TEST_DOUBLE_NUMBER_VALUES 200000
+
+
+/*!
+ * \brief Values formatting and parsing tends to get wrong.
+ */
+static const double test_double_values[] =
+{
+        0.0, 1.0, -1.0, 0.1, -0.1, 0.5, 1.5, 2.0, 10.0, 100.0, 0.3,
+        1.0 / 3.0, 2.0 / 3.0, 123.456, -123.456, 1e-4, 9.9999e-5, 1e-5,
+        1e15, 999999999999999.0, 1e16, 1e22, 1e23, 1e-22, 1e-300, 1e300,
+        9007199254740992.0, 9007199254740993.0, 4503599627370497.5,
+        5e-324, 2.2250738585072009e-308, DBL_MIN, DBL_MAX, -DBL_MAX,
+        DBL_EPSILON, 1.0 + DBL_EPSILON, 1.0 - DBL_EPSILON / 2.0,
+        0.30000000000000004, 3.141592653589793, 2.718281828459045,
+        1234567.890123, 0.000123456789, 17.25, -0.0625
+};
+
+
+/*!
+ * \brief Return the next pseudo random number of a xorshift generator.
+ *
+ * The sequence is the same on every run.
+ */
+static uint64_t
+test_double_random
+(
+        uint64_t *state
+                /*!< State of the generator. */
+)
+{
+        *state ^= *state << 13;
+        *state ^= *state >> 7;
+        *state ^= *state << 17;
+        return (*state);
+}
+
+
+/*!
+ * \brief Compare two doubles bit for bit, telling 0.0 from -0.0.
+ *
+ * \return \c TRUE when the doubles are identical, \c FALSE otherwise.
+ */
+static int
+test_double_identical
+(
+        double a,
+                /*!< The first double. */
+        double b
+                /*!< The second double. */
+)
+{
+        return (memcmp (&a, &b, sizeof (double)) == 0);
+}
+
+
+/*!
+ * \brief Format a double and parse it back.
+ *
+ * The formatted string has to read back to the identical value, both by
+ * dxf_reader_parse_double () and strtod (), it has to be a real (contain
+ * a '.' or an exponent) and fit in \c DXF_DOUBLE_STRING_LENGTH chars.
+ *
+ * \return \c EXIT_SUCCESS when the value survived the round trip, or
+ * \c EXIT_FAILURE otherwise.
+ */
+static int
+test_double_round_trip
+(
+        double value
+                /*!< The value to format and parse. */
+)
+{
+        char s[DXF_DOUBLE_STRING_LENGTH];
+        char reference[DXF_DOUBLE_STRING_LENGTH];
+        double parsed;
+        int length;
+
+        snprintf (reference, sizeof (reference), "%.17g", value);
+        length = dxf_format_double (s, value);
+        if ((length != (int) strlen (s))
+          || (strpbrk (s, ".e") == NULL)
+          || (length >= DXF_DOUBLE_STRING_LENGTH)
+          || (dxf_reader_parse_double (s, length, &parsed) == EXIT_FAILURE)
+          || (!test_double_identical (parsed, value))
+          || (!test_double_identical (strtod (s, NULL), value)))
+        {
+                fprintf (stderr, "Error in %s () formatting %s as %s.\n",
+                  __FUNCTION__, reference, s);
+                return (EXIT_FAILURE);
+        }
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Parse a string with dxf_reader_parse_double () and strtod ().
+ *
+ * \return \c EXIT_SUCCESS when both give the identical value, or
+ * \c EXIT_FAILURE otherwise.
+ */
+static int
+test_double_parse
+(
+        const char *s
+                /*!< The string to parse. */
+)
+{
+        double parsed;
+
+        if ((dxf_reader_parse_double (s, strlen (s), &parsed) == EXIT_FAILURE)
+          || (!test_double_identical (parsed, strtod (s, NULL))))
+        {
+                fprintf (stderr, "Error in %s () parsing %s.\n",
+                  __FUNCTION__, s);
+                return (EXIT_FAILURE);
+        }
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Test formatting and parsing doubles.
+ *
+ * Special values, random bit patterns and random short decimals (the
+ * bulk of the coordinates in a DXF file) are formatted and parsed back,
+ * random decimal strings of up to 25 digits are parsed and compared with
+ * strtod ().
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+test_double (void)
+{
+        char s[64];
+        uint64_t state = 0x9E3779B97F4A7C15ULL;
+        uint64_t bits;
+        double value;
+        size_t i;
+        int result = EXIT_SUCCESS;
+
+        for (i = 0; i < sizeof (test_double_values) / sizeof (test_double_values[0]); i++)
+        {
+                if ((test_double_round_trip (test_double_values[i]) == EXIT_FAILURE)
+                  || (test_double_round_trip (-test_double_values[i]) == EXIT_FAILURE))
+                {
+                        result = EXIT_FAILURE;
+                }
+        }
+        for (i = 0; i < TEST_DOUBLE_NUMBER_VALUES; i++)
+        {
+                /* Any finite bit pattern. */
+                bits = test_double_random (&state);
+                memcpy (&value, &bits, sizeof (double));
+                if (isfinite (value)
+                  && (test_double_round_trip (value) == EXIT_FAILURE))
+                {
+                        result = EXIT_FAILURE;
+                }
+                /* A decimal with up to 15 digits and up to 8 decimals. */
+                value = (double) (int64_t) (test_double_random (&state) % 1000000000000000ULL)
+                  / pow (10.0, (double) (test_double_random (&state) % 9));
+                if (test_double_round_trip (value) == EXIT_FAILURE)
+                {
+                        result = EXIT_FAILURE;
+                }
+                /* A random decimal string, in fixed and scientific
+                 * notation. */
+                snprintf (s, sizeof (s), "%s%" PRIu64 ".%" PRIu64 "e%d",
+                  (test_double_random (&state) & 1) ? "-" : "",
+                  (uint64_t) (test_double_random (&state) % 10000000000ULL),
+                  (uint64_t) (test_double_random (&state) >> (test_double_random (&state) % 64)),
+                  (int) (test_double_random (&state) % 640) - 320);
+                if (test_double_parse (s) == EXIT_FAILURE)
+                {
+                        result = EXIT_FAILURE;
+                }
+                *strchr (s, 'e') = '\0';
+                if (test_double_parse (s) == EXIT_FAILURE)
+                {
+                        result = EXIT_FAILURE;
+                }
+        }
+        return (result);
+}
+
+
+/* EOF */
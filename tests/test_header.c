@@ -0,0 +1,141 @@
+/*!
+ * \file test_header.c
+ *
+ * \author Copyright (C) 2026
+ * by Bert Timmerman <bert.timmerman@xs4all.nl>.
+ *
+ * \brief Testing program for reading the \c HEADER section, every
+ * variable written to a file has to be read back into its member.
+ *
+ * <hr>
+ * <h1><b>Copyright Notices.</b></h1>\n
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License,
+ * or (at your option) any later version.\n\n
+ * This program is distributed in the hope that it will be useful, but
+ * <b>WITHOUT ANY WARRANTY</b>; without even the implied warranty of
+ * <b>MERCHANTABILITY</b> or <b>FITNESS FOR A PARTICULAR PURPOSE</b>.\n
+ * See the GNU General Public License for more details.\n\n
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to:\n
+ * Free Software Foundation, Inc.,\n
+ * 59 Temple Place,\n
+ * Suite 330,\n
+ * Boston,\n
+ * MA 02111 USA.\n
+ * \n
+ * Drawing eXchange Format (DXF) is a defacto industry standard for the
+ * exchange of drawing files between various Computer Aided Drafting
+ * programs.\n
+ * DXF is an industry standard designed by Autodesk(TM).\n
+ * For more details see http://www.autodesk.com.
+ * <hr>
+ */
+
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "includes.h"
+
+
+#define TEST_HEADER_FILENAME "test_header.dxf"
+
+
+/*!
+ * \brief Write a \c HEADER section holding the variables to read back.
+ *
+ * \c $GRIDUNIT is a 2D point, the next variable has to be read after
+ * its coordinates.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+static int
+test_header_generate
+(
+        const char *filename
+                /*!< Name of the file to write. */
+)
+{
+        FILE *fp;
+
+        fp = fopen (filename, "w");
+        if (fp == NULL)
+        {
+                return (EXIT_FAILURE);
+        }
+        fprintf (fp, "  0\nSECTION\n  2\nHEADER\n"
+          "  9\n$ACADVER\n  1\nAC1015\n"
+          "  9\n$MIRRTEXT\n 70\n1\n"
+          "  9\n$DRAGMODE\n 70\n2\n"
+          "  9\n$LTSCALE\n 40\n2.5\n"
+          "  9\n$OSMODE\n 70\n4133\n"
+          "  9\n$DELOBJ\n 70\n0\n"
+          "  9\n$GRIDUNIT\n 10\n0.5\n 20\n0.25\n"
+          "  9\n$GRIDMODE\n 70\n1\n"
+          "  0\nENDSEC\n  0\nEOF\n");
+        return ((fclose (fp) == 0) ? EXIT_SUCCESS : EXIT_FAILURE);
+}
+
+
+/*!
+ * \brief Test reading header variables.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+test_header (void)
+{
+        DxfDrawing *drawing;
+        DxfHeader *header;
+        DxfFile *fp;
+        int result;
+
+        if (test_header_generate (TEST_HEADER_FILENAME) == EXIT_FAILURE)
+        {
+                return (EXIT_FAILURE);
+        }
+        drawing = dxf_drawing_new ();
+        header = dxf_header_new ();
+        fp = dxf_read_init (TEST_HEADER_FILENAME);
+        if ((drawing == NULL) || (header == NULL) || (fp == NULL))
+        {
+                return (EXIT_FAILURE);
+        }
+        /* Start from known values, so every variable has to be read. */
+        header->MirrText = -1;
+        header->DragMode = -1;
+        header->LTScale = -1.0;
+        header->OSMode = -1;
+        header->DelObj = -1;
+        header->GridUnit.x0 = -1.0;
+        header->GridUnit.y0 = -1.0;
+        header->GridMode = -1;
+        dxf_drawing_set_header (drawing, header);
+        result = dxf_drawing_read_sections (drawing, fp, NULL,
+          DXF_SECTION_HEADER);
+        dxf_read_close (fp);
+        header = dxf_drawing_get_header (drawing);
+        if ((result == EXIT_FAILURE)
+          || (header->MirrText != 1)
+          || (header->DragMode != 2)
+          || (header->LTScale != 2.5)
+          || (header->OSMode != 4133)
+          || (header->DelObj != 0)
+          || (header->GridUnit.x0 != 0.5)
+          || (header->GridUnit.y0 != 0.25)
+          || (header->GridMode != 1))
+        {
+                fprintf (stderr, "Error in %s () header variables not read.\n",
+                  __FUNCTION__);
+                result = EXIT_FAILURE;
+        }
+        dxf_drawing_free (drawing);
+        remove (TEST_HEADER_FILENAME);
+        return (result);
+}
+
+
+/* EOF */
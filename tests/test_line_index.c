@@ -0,0 +1,226 @@
+/*!
+ * \file test_line_index.c
+ *
+ * \author Copyright (C) 2026
+ * by Bert Timmerman <bert.timmerman@xs4all.nl>.
+ *
+ * \brief Testing program for indexing the lines of a buffer, the
+ * vectorized dxf_reader_index_lines () has to find the same line
+ * terminators as a byte by byte scan.
+ *
+ * <hr>
+ * <h1><b>Copyright Notices.</b></h1>\n
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License,
+ * or (at your option) any later version.\n\n
+ * This program is distributed in the hope that it will be useful, but
+ * <b>WITHOUT ANY WARRANTY</b>; without even the implied warranty of
+ * <b>MERCHANTABILITY</b> or <b>FITNESS FOR A PARTICULAR PURPOSE</b>.\n
+ * See the GNU General Public License for more details.\n\n
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to:\n
+ * Free Software Foundation, Inc.,\n
+ * 59 Temple Place,\n
+ * Suite 330,\n
+ * Boston,\n
+ * MA 02111 USA.\n
+ * \n
+ * Drawing eXchange Format (DXF) is a defacto industry standard for the
+ * exchange of drawing files between various Computer Aided Drafting
+ * programs.\n
+ * DXF is an industry standard designed by Autodesk(TM).\n
+ * For more details see http://www.autodesk.com.
+ * <hr>
+ */
+
+
+#include <stdio.h>
+#include <string.h>
+#include <stdint.h>
+#include "includes.h"
+
+
+/*!
+ * \brief Size of the buffer scanned by the tests.
+ */
+#define TEST_LINE_INDEX_BUFFER_SIZE 4096
+
+
+/*!
+ * \brief Maximum number of offsets stored by the tests.
+ */
+#define TEST_LINE_INDEX_MAX_OFFSETS TEST_LINE_INDEX_BUFFER_SIZE
+
+
+/*!
+ * \brief Find the line terminators in a part of a buffer one byte at a
+ * time.
+ *
+ * The reference for dxf_reader_index_lines ().
+ *
+ * \return the number of offsets stored.
+ */
+static size_t
+test_line_index_scalar
+(
+        const char *buffer,
+                /*!< Buffer to scan. */
+        size_t start,
+                /*!< Offset of the first byte to scan. */
+        size_t end,
+                /*!< Offset past the last byte to scan. */
+        size_t *offsets,
+                /*!< Returns the offsets of the line terminators. */
+        size_t max_offsets,
+                /*!< Maximum number of offsets to store. */
+        size_t *scanned
+                /*!< Returns the offset past the last byte scanned. */
+)
+{
+        size_t pos;
+        size_t count = 0;
+
+        for (pos = start; pos < end; pos++)
+        {
+                if (buffer[pos] == '\n')
+                {
+                        if (count == max_offsets)
+                        {
+                                *scanned = offsets[count - 1] + 1;
+                                return (count);
+                        }
+                        offsets[count++] = pos;
+                }
+        }
+        *scanned = end;
+        return (count);
+}
+
+
+/*!
+ * \brief Index a part of a buffer with dxf_reader_index_lines () and
+ * with the byte by byte reference.
+ *
+ * \return \c EXIT_SUCCESS when both give the same offsets, or
+ * \c EXIT_FAILURE otherwise.
+ */
+static int
+test_line_index_compare
+(
+        const char *buffer,
+                /*!< Buffer to scan. */
+        size_t start,
+                /*!< Offset of the first byte to scan. */
+        size_t end,
+                /*!< Offset past the last byte to scan. */
+        size_t max_offsets
+                /*!< Maximum number of offsets to store. */
+)
+{
+        static size_t offsets[TEST_LINE_INDEX_MAX_OFFSETS];
+        static size_t expected[TEST_LINE_INDEX_MAX_OFFSETS];
+        size_t scanned;
+        size_t expected_scanned;
+        size_t count;
+        size_t expected_count;
+
+        count = dxf_reader_index_lines (buffer, start, end, offsets,
+          max_offsets, &scanned);
+        expected_count = test_line_index_scalar (buffer, start, end,
+          expected, max_offsets, &expected_scanned);
+        if ((count != expected_count)
+          || (scanned != expected_scanned)
+          || (memcmp (offsets, expected, count * sizeof (size_t)) != 0))
+        {
+                fprintf (stderr, "Error in %s () indexing [%zu, %zu) with at most %zu offsets.\n",
+                  __FUNCTION__, start, end, max_offsets);
+                return (EXIT_FAILURE);
+        }
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Test indexing the lines of a buffer.
+ *
+ * Buffers with sparse, dense and no line terminators, "\\r\\n" line
+ * terminators and bytes with the high bit set are indexed from every
+ * alignment, with lengths around the vector sizes and limits on the
+ * number of offsets that stop the scan in the middle of a vector.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+test_line_index (void)
+{
+        static char buffer[TEST_LINE_INDEX_BUFFER_SIZE];
+        static const size_t max_offsets[] =
+        {
+                1, 2, 3, 7, 15, 16, 17, 31, 32, 33, 64, 100,
+                TEST_LINE_INDEX_MAX_OFFSETS
+        };
+        uint32_t state = 12345;
+        size_t start;
+        size_t length;
+        size_t i;
+        int density;
+        int result = EXIT_SUCCESS;
+
+        for (density = 0; density < 4; density++)
+        {
+                for (i = 0; i < TEST_LINE_INDEX_BUFFER_SIZE; i++)
+                {
+                        state = (state * 1103515245) + 12345;
+                        switch (density)
+                        {
+                                case 0:
+                                        /* No line terminators. */
+                                        buffer[i] = (char) (0x80 | (state >> 24));
+                                        break;
+                                case 1:
+                                        /* Lines of a DXF file. */
+                                        buffer[i] = ((state >> 16) % 7 == 0) ? '\n' : (char) ('0' + (state >> 16) % 10);
+                                        break;
+                                case 2:
+                                        /* "\r\n" line terminators and
+                                         * bytes with the high bit set. */
+                                        buffer[i] = ((state >> 16) % 5 == 0) ? '\r' : (char) (state >> 24);
+                                        if ((i > 0) && (buffer[i - 1] == '\r'))
+                                        {
+                                                buffer[i] = '\n';
+                                        }
+                                        break;
+                                default:
+                                        /* Nothing but line terminators. */
+                                        buffer[i] = '\n';
+                                        break;
+                        }
+                }
+                for (start = 0; start < 72; start++)
+                {
+                        for (length = 0; length < 200; length++)
+                        {
+                                for (i = 0; i < sizeof (max_offsets) / sizeof (max_offsets[0]); i++)
+                                {
+                                        if (test_line_index_compare (buffer, start, start + length, max_offsets[i]) == EXIT_FAILURE)
+                                        {
+                                                result = EXIT_FAILURE;
+                                        }
+                                }
+                        }
+                        for (i = 0; i < sizeof (max_offsets) / sizeof (max_offsets[0]); i++)
+                        {
+                                if (test_line_index_compare (buffer, start, TEST_LINE_INDEX_BUFFER_SIZE, max_offsets[i]) == EXIT_FAILURE)
+                                {
+                                        result = EXIT_FAILURE;
+                                }
+                        }
+                }
+        }
+        return (result);
+}
+
+
+/* EOF */
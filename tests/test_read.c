@@ -0,0 +1,384 @@
+/*!
+ * \file test_read.c
+ *
+ * \author Copyright (C) 2026
+ * by Bert Timmerman <bert.timmerman@xs4all.nl>.
+ *
+ * \brief Testing program for reading a DXF file, comparing the
+ * drawings read from a memory mapped file or by several threads with
+ * those read serially through the buffered reader.
+ *
+ * <hr>
+ * <h1><b>Copyright Notices.</b></h1>\n
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License,
+ * or (at your option) any later version.\n\n
+ * This program is distributed in the hope that it will be useful, but
+ * <b>WITHOUT ANY WARRANTY</b>; without even the implied warranty of
+ * <b>MERCHANTABILITY</b> or <b>FITNESS FOR A PARTICULAR PURPOSE</b>.\n
+ * See the GNU General Public License for more details.\n\n
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to:\n
+ * Free Software Foundation, Inc.,\n
+ * 59 Temple Place,\n
+ * Suite 330,\n
+ * Boston,\n
+ * MA 02111 USA.\n
+ * \n
+ * Drawing eXchange Format (DXF) is a defacto industry standard for the
+ * exchange of drawing files between various Computer Aided Drafting
+ * programs.\n
+ * DXF is an industry standard designed by Autodesk(TM).\n
+ * For more details see http://www.autodesk.com.
+ * <hr>
+ */
+
+
+#include <stdio.h>
+#include <string.h>
+#include "includes.h"
+
+
+/*!
+ * \brief The example files read by the tests.
+ */
+static const char *test_read_examples[] =
+{
+        "all_R10_entities.dxf",
+        "blender-monkey_head_example_R12.dxf",
+        "parametric_constraints_R2010.dxf",
+        "qcad-example_R12.dxf",
+        "qcad-example_R2000.dxf",
+        "zcad-teapot_R2000.dxf"
+};
+
+
+/*!
+ * \brief Number of \c LINE entities in the generated drawing read by
+ * test_read_parallel ().
+ *
+ * Large enough to have the \c ENTITIES section split over several
+ * chunks of \c DXF_READER_CHUNK_SIZE bytes.
+ */
+#define TEST_READ_NUMBER_LINES 160000
+
+
+/*!
+ * \brief Number of layers the generated \c LINE entities are spread
+ * over.
+ */
+#define TEST_READ_NUMBER_LAYERS 7
+
+
+/*!
+ * \brief Read the sections of a DXF file into a new drawing and write
+ * the drawing back as ASCII DXF R13.
+ *
+ * DXF R13 has no \c OBJECTS section, so the output does not depend on
+ * the time it was written.\n
+ * When reading with a string pool the layer names of all \c LINE
+ * entities have to be interned, equal names sharing one copy.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+static int
+test_read_copy
+(
+        const char *filename,
+                /*!< Name of the file to read. */
+        const char *output,
+                /*!< Name of the file to write. */
+        int mapped,
+                /*!< Read \c filename through a memory map. */
+        int number_threads,
+                /*!< Number of threads reading the \c ENTITIES
+                 * section. */
+        int arena,
+                /*!< Allocate the entities from the arena of the
+                 * drawing. */
+        int string_pool,
+                /*!< Intern strings in the string pool of the
+                 * drawing. */
+        size_t *number_interned
+                /*!< Returns the number of strings interned in the
+                 * string pool of the drawing, may be \c NULL. */
+)
+{
+        DxfDrawing *drawing;
+        DxfFile *fp;
+        DxfArena *previous = NULL;
+        DxfEntities *entities;
+        DxfLine *line;
+        DxfLine *iter;
+        int result;
+
+        drawing = dxf_drawing_new ();
+        fp = (mapped) ? dxf_read_init_mapped (filename) : dxf_read_init (filename);
+        if ((drawing == NULL) || (fp == NULL))
+        {
+                return (EXIT_FAILURE);
+        }
+        dxf_read_set_number_threads (fp, number_threads);
+        if (arena)
+        {
+                previous = dxf_arena_set_current (dxf_drawing_get_arena (drawing));
+        }
+        if (string_pool)
+        {
+                dxf_read_set_string_pool (fp, dxf_drawing_get_string_pool (drawing));
+        }
+        result = dxf_drawing_read_sections (drawing, fp, NULL,
+          DXF_SECTION_HEADER | DXF_SECTION_TABLES | DXF_SECTION_BLOCKS
+          | DXF_SECTION_ENTITIES);
+        if (arena)
+        {
+                dxf_arena_set_current (previous);
+        }
+        dxf_read_close (fp);
+        if (number_interned != NULL)
+        {
+                *number_interned = (string_pool)
+                  ? dxf_string_pool_get_count (dxf_drawing_get_string_pool (drawing))
+                  : 0;
+        }
+        entities = dxf_drawing_get_entities_list (drawing);
+        if ((string_pool) && (entities != NULL))
+        {
+                for (line = (DxfLine *) entities->line_list; line != NULL; line = (DxfLine *) line->next)
+                {
+                        if (!dxf_string_is_interned (line->layer))
+                        {
+                                result = EXIT_FAILURE;
+                        }
+                        for (iter = (DxfLine *) entities->line_list; iter != line; iter = (DxfLine *) iter->next)
+                        {
+                                if (strcmp (iter->layer, line->layer) == 0)
+                                {
+                                        if (iter->layer != line->layer)
+                                        {
+                                                result = EXIT_FAILURE;
+                                        }
+                                        break;
+                                }
+                        }
+                }
+        }
+        fp = dxf_write_init (output);
+        if (fp == NULL)
+        {
+                dxf_drawing_free (drawing);
+                return (EXIT_FAILURE);
+        }
+        fp->acad_version_number = AutoCAD_13;
+        if (dxf_file_write (fp, drawing, 1) == EXIT_FAILURE)
+        {
+                result = EXIT_FAILURE;
+        }
+        if (dxf_write_close (fp) == EXIT_FAILURE)
+        {
+                result = EXIT_FAILURE;
+        }
+        dxf_drawing_free (drawing);
+        return (result);
+}
+
+
+/*!
+ * \brief Compare the contents of two files.
+ *
+ * \return \c EXIT_SUCCESS when the files are identical, or
+ * \c EXIT_FAILURE otherwise.
+ */
+int
+test_read_compare
+(
+        const char *filename_1,
+                /*!< Name of the first file. */
+        const char *filename_2
+                /*!< Name of the second file. */
+)
+{
+        FILE *fp_1;
+        FILE *fp_2;
+        int c;
+        int result = EXIT_SUCCESS;
+
+        fp_1 = fopen (filename_1, "rb");
+        fp_2 = fopen (filename_2, "rb");
+        if ((fp_1 == NULL) || (fp_2 == NULL))
+        {
+                result = EXIT_FAILURE;
+        }
+        else
+        {
+                do
+                {
+                        c = fgetc (fp_1);
+                        if (c != fgetc (fp_2))
+                        {
+                                result = EXIT_FAILURE;
+                                break;
+                        }
+                }
+                while (c != EOF);
+        }
+        if (fp_1 != NULL)
+        {
+                fclose (fp_1);
+        }
+        if (fp_2 != NULL)
+        {
+                fclose (fp_2);
+        }
+        return (result);
+}
+
+
+/*!
+ * \brief Test reading memory mapped DXF files.
+ *
+ * Every example file is read with the buffered reader and through a
+ * memory map, both drawings have to be written identically.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+test_read_mapped (void)
+{
+        char filename[256];
+        size_t i;
+        int result = EXIT_SUCCESS;
+
+        for (i = 0; i < sizeof (test_read_examples) / sizeof (test_read_examples[0]); i++)
+        {
+                snprintf (filename, sizeof (filename), "%s%s",
+                  TESTS_EXAMPLES_DIR, test_read_examples[i]);
+                if ((test_read_copy (filename, "test_read_buffered.dxf", FALSE, 1, FALSE, FALSE, NULL) == EXIT_FAILURE)
+                  || (test_read_copy (filename, "test_read_mapped.dxf", TRUE, 1, FALSE, FALSE, NULL) == EXIT_FAILURE)
+                  || (test_read_compare ("test_read_buffered.dxf", "test_read_mapped.dxf") == EXIT_FAILURE))
+                {
+                        fprintf (stderr, "Error in %s () reading %s.\n",
+                          __FUNCTION__, filename);
+                        result = EXIT_FAILURE;
+                }
+        }
+        remove ("test_read_buffered.dxf");
+        remove ("test_read_mapped.dxf");
+        return (result);
+}
+
+
+/*!
+ * \brief Write a drawing with \c TEST_READ_NUMBER_LINES \c LINE
+ * entities to a file.
+ *
+ * Every 16th \c LINE entity is followed by a \c POLYLINE entity with
+ * three \c VERTEX entities and a \c SEQEND marker, a range boundary
+ * must not separate them.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+static int
+test_read_generate
+(
+        const char *filename
+                /*!< Name of the file to write. */
+)
+{
+        FILE *fp;
+        int i;
+        int j;
+
+        fp = fopen (filename, "w");
+        if (fp == NULL)
+        {
+                return (EXIT_FAILURE);
+        }
+        fprintf (fp, "  0\nSECTION\n  2\nHEADER\n  9\n$ACADVER\n  1\nAC1012\n  0\nENDSEC\n");
+        fprintf (fp, "  0\nSECTION\n  2\nENTITIES\n");
+        for (i = 0; i < TEST_READ_NUMBER_LINES; i++)
+        {
+                fprintf (fp, "  0\nLINE\n  5\n%X\n  8\nLAYER_%d\n"
+                  " 10\n%d.5\n 20\n%d.25\n 30\n0.0\n"
+                  " 11\n%d.125\n 21\n%d.0\n 31\n0.0\n",
+                  i + 0x100, i % TEST_READ_NUMBER_LAYERS,
+                  i, -i, i + 1, i % 1000);
+                if ((i % 16) != 0)
+                {
+                        continue;
+                }
+                fprintf (fp, "  0\nPOLYLINE\n  5\n%X\n  8\nLAYER_%d\n 66\n1\n"
+                  " 10\n0.0\n 20\n0.0\n 30\n0.0\n 70\n8\n",
+                  0x100000 + i, i % TEST_READ_NUMBER_LAYERS);
+                for (j = 1; j <= 3; j++)
+                {
+                        fprintf (fp, "  0\nVERTEX\n  5\n%X\n  8\nLAYER_%d\n"
+                          " 10\n%d.5\n 20\n%d.0\n 30\n%d.0\n 70\n32\n",
+                          0x100000 + i + j, i % TEST_READ_NUMBER_LAYERS,
+                          i, j, -j);
+                }
+                fprintf (fp, "  0\nSEQEND\n  5\n%X\n  8\nLAYER_%d\n",
+                  0x100000 + i + 4, i % TEST_READ_NUMBER_LAYERS);
+        }
+        fprintf (fp, "  0\nENDSEC\n  0\nEOF\n");
+        return ((fclose (fp) == 0) ? EXIT_SUCCESS : EXIT_FAILURE);
+}
+
+
+/*!
+ * \brief Test reading the \c ENTITIES section by several threads.
+ *
+ * A generated drawing large enough to be split in several ranges is read
+ * serially and by four threads, allocating from the heap, an arena, a
+ * string pool or both.\n
+ * Every parallel read has to be written identically to the serial read
+ * and intern as many strings.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+test_read_parallel (void)
+{
+        size_t number_serial;
+        size_t number_parallel;
+        int arena;
+        int string_pool;
+        int result = EXIT_SUCCESS;
+
+        if (test_read_generate ("test_read_lines.dxf") == EXIT_FAILURE)
+        {
+                fprintf (stderr, "Error in %s () writing test_read_lines.dxf.\n",
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        for (arena = FALSE; arena <= TRUE; arena++)
+        {
+                for (string_pool = FALSE; string_pool <= TRUE; string_pool++)
+                {
+                        if ((test_read_copy ("test_read_lines.dxf", "test_read_serial.dxf",
+                          TRUE, 1, arena, string_pool, &number_serial) == EXIT_FAILURE)
+                          || (test_read_copy ("test_read_lines.dxf", "test_read_parallel.dxf",
+                          TRUE, 4, arena, string_pool, &number_parallel) == EXIT_FAILURE)
+                          || (number_serial != number_parallel)
+                          || (test_read_compare ("test_read_serial.dxf", "test_read_parallel.dxf") == EXIT_FAILURE))
+                        {
+                                fprintf (stderr, "Error in %s () reading with%s arena and with%s string pool.\n",
+                                  __FUNCTION__, (arena) ? "" : "out",
+                                  (string_pool) ? "" : "out");
+                                result = EXIT_FAILURE;
+                        }
+                }
+        }
+        remove ("test_read_lines.dxf");
+        remove ("test_read_serial.dxf");
+        remove ("test_read_parallel.dxf");
+        return (result);
+}
+
+
+/* EOF */
@@ -0,0 +1,468 @@
+/*!
+ * \file test_spatial_index.c
+ *
+ * \author Copyright (C) 2026
+ * by Bert Timmerman <bert.timmerman@xs4all.nl>.
+ *
+ * \brief Testing program for the R-tree spatial index, window, point
+ * and nearest neighbour queries have to find the same entities as a
+ * brute force search.
+ *
+ * <hr>
+ * <h1><b>Copyright Notices.</b></h1>\n
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License,
+ * or (at your option) any later version.\n\n
+ * This program is distributed in the hope that it will be useful, but
+ * <b>WITHOUT ANY WARRANTY</b>; without even the implied warranty of
+ * <b>MERCHANTABILITY</b> or <b>FITNESS FOR A PARTICULAR PURPOSE</b>.\n
+ * See the GNU General Public License for more details.\n\n
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to:\n
+ * Free Software Foundation, Inc.,\n
+ * 59 Temple Place,\n
+ * Suite 330,\n
+ * Boston,\n
+ * MA 02111 USA.\n
+ * \n
+ * Drawing eXchange Format (DXF) is a defacto industry standard for the
+ * exchange of drawing files between various Computer Aided Drafting
+ * programs.\n
+ * DXF is an industry standard designed by Autodesk(TM).\n
+ * For more details see http://www.autodesk.com.
+ * <hr>
+ */
+
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include "includes.h"
+
+
+/*!
+ * \brief Number of \c LINE entities in the spatial index.
+ */
+#define TEST_SPATIAL_INDEX_NUMBER_LINES 3000
+
+
+/*!
+ * \brief Number of queries of each kind.
+ */
+#define TEST_SPATIAL_INDEX_NUMBER_QUERIES 200
+
+
+/*!
+ * \brief Maximum number of nearest entities asked for.
+ */
+#define TEST_SPATIAL_INDEX_MAX_NEAREST 40
+
+
+/*!
+ * \brief The entities of the test, with the bounding boxes a brute force
+ * search compares with.
+ */
+typedef struct
+test_spatial_index_data_struct
+{
+        DxfLine *lines[TEST_SPATIAL_INDEX_NUMBER_LINES];
+                /*!< The entities, the \c id_code of each line is it's
+                 * index. */
+        DxfBbox bbox[TEST_SPATIAL_INDEX_NUMBER_LINES];
+                /*!< Bounding box of each line. */
+        int present[TEST_SPATIAL_INDEX_NUMBER_LINES];
+                /*!< \c TRUE when the line is in the tree. */
+        int found[TEST_SPATIAL_INDEX_NUMBER_LINES];
+                /*!< Number of times the line was found by a query. */
+} TestSpatialIndexData;
+
+
+/*!
+ * \brief Return a pseudo random number in [0, \c range).
+ *
+ * The sequence is the same on every run.
+ */
+static double
+test_spatial_index_random
+(
+        uint32_t *state,
+                /*!< State of the generator. */
+        double range
+                /*!< Upper limit of the number. */
+)
+{
+        *state = (*state * 1664525) + 1013904223;
+        return (range * (*state >> 8) / 16777216.0);
+}
+
+
+/*!
+ * \brief Count an entity found by a query, callback of
+ * dxf_spatial_index_tree_search_window ().
+ */
+static int
+test_spatial_index_on_entity
+(
+        const char *type,
+        void *entity,
+        void *user_data
+)
+{
+        TestSpatialIndexData *data = (TestSpatialIndexData *) user_data;
+
+        if (strcmp (type, "LINE") != 0)
+        {
+                return (EXIT_FAILURE);
+        }
+        data->found[((DxfLine *) entity)->id_code]++;
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Compute the square of the distance in plan from a point to a
+ * bounding box.
+ */
+static double
+test_spatial_index_distance
+(
+        const DxfBbox *bbox,
+        double x,
+        double y
+)
+{
+        double dx = 0.0;
+        double dy = 0.0;
+
+        if (x < bbox->min.x)
+        {
+                dx = bbox->min.x - x;
+        }
+        else if (x > bbox->max.x)
+        {
+                dx = x - bbox->max.x;
+        }
+        if (y < bbox->min.y)
+        {
+                dy = bbox->min.y - y;
+        }
+        else if (y > bbox->max.y)
+        {
+                dy = y - bbox->max.y;
+        }
+        return ((dx * dx) + (dy * dy));
+}
+
+
+/*!
+ * \brief Compare two doubles, for qsort ().
+ */
+static int
+test_spatial_index_compare_double
+(
+        const void *a,
+        const void *b
+)
+{
+        double da = *(const double *) a;
+        double db = *(const double *) b;
+
+        return ((da > db) - (da < db));
+}
+
+
+/*!
+ * \brief Run a window query and compare it with a brute force search.
+ *
+ * Every line in the tree with a bounding box overlapping or touching
+ * \c window in plan has to be found exactly once, no other line may be
+ * found.
+ *
+ * \return \c EXIT_SUCCESS when both agree, or \c EXIT_FAILURE
+ * otherwise.
+ */
+static int
+test_spatial_index_window
+(
+        DxfSpatialIndexTree *tree,
+        TestSpatialIndexData *data,
+        DxfBbox *window
+)
+{
+        int expected;
+        int i;
+
+        memset (data->found, 0, sizeof (data->found));
+        if (dxf_spatial_index_tree_search_window (tree, window,
+          test_spatial_index_on_entity, data) == EXIT_FAILURE)
+        {
+                return (EXIT_FAILURE);
+        }
+        for (i = 0; i < TEST_SPATIAL_INDEX_NUMBER_LINES; i++)
+        {
+                expected = (data->present[i]
+                  && (data->bbox[i].min.x <= window->max.x)
+                  && (window->min.x <= data->bbox[i].max.x)
+                  && (data->bbox[i].min.y <= window->max.y)
+                  && (window->min.y <= data->bbox[i].max.y));
+                if (data->found[i] != expected)
+                {
+                        fprintf (stderr, "Error in %s () line %d found %d times.\n",
+                          __FUNCTION__, i, data->found[i]);
+                        return (EXIT_FAILURE);
+                }
+        }
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Run a point query and compare it with a brute force search.
+ *
+ * \return \c EXIT_SUCCESS when both agree, or \c EXIT_FAILURE
+ * otherwise.
+ */
+static int
+test_spatial_index_point
+(
+        DxfSpatialIndexTree *tree,
+        TestSpatialIndexData *data,
+        double x,
+        double y,
+        double tolerance
+)
+{
+        DxfBbox window;
+        int i;
+
+        memset (data->found, 0, sizeof (data->found));
+        if (dxf_spatial_index_tree_search_point (tree, x, y, tolerance,
+          test_spatial_index_on_entity, data) == EXIT_FAILURE)
+        {
+                return (EXIT_FAILURE);
+        }
+        window.min.x = x - tolerance;
+        window.min.y = y - tolerance;
+        window.max.x = x + tolerance;
+        window.max.y = y + tolerance;
+        for (i = 0; i < TEST_SPATIAL_INDEX_NUMBER_LINES; i++)
+        {
+                if (data->found[i] != (data->present[i]
+                  && (data->bbox[i].min.x <= window.max.x)
+                  && (window.min.x <= data->bbox[i].max.x)
+                  && (data->bbox[i].min.y <= window.max.y)
+                  && (window.min.y <= data->bbox[i].max.y)))
+                {
+                        fprintf (stderr, "Error in %s () line %d found %d times.\n",
+                          __FUNCTION__, i, data->found[i]);
+                        return (EXIT_FAILURE);
+                }
+        }
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Run a nearest neighbour query and compare it with a brute
+ * force search.
+ *
+ * The entities found have to be distinct lines in the tree, nearest
+ * first, at the same distances as the \c k nearest lines found by brute
+ * force (which of several lines at the same distance is found may
+ * differ).
+ *
+ * \return \c EXIT_SUCCESS when both agree, or \c EXIT_FAILURE
+ * otherwise.
+ */
+static int
+test_spatial_index_nearest
+(
+        DxfSpatialIndexTree *tree,
+        TestSpatialIndexData *data,
+        double x,
+        double y,
+        size_t k
+)
+{
+        static double distances[TEST_SPATIAL_INDEX_NUMBER_LINES];
+        DxfSpatialIndexEntry nearest[TEST_SPATIAL_INDEX_MAX_NEAREST];
+        DxfLine *line;
+        size_t number_present = 0;
+        size_t number_found;
+        size_t i;
+
+        for (i = 0; i < TEST_SPATIAL_INDEX_NUMBER_LINES; i++)
+        {
+                if (data->present[i])
+                {
+                        distances[number_present++] = test_spatial_index_distance (&data->bbox[i], x, y);
+                }
+        }
+        qsort (distances, number_present, sizeof (double),
+          test_spatial_index_compare_double);
+        memset (data->found, 0, sizeof (data->found));
+        number_found = dxf_spatial_index_tree_nearest (tree, x, y, k, nearest);
+        if (number_found != ((k < number_present) ? k : number_present))
+        {
+                fprintf (stderr, "Error in %s () found %zu of %zu lines.\n",
+                  __FUNCTION__, number_found, k);
+                return (EXIT_FAILURE);
+        }
+        for (i = 0; i < number_found; i++)
+        {
+                line = (DxfLine *) nearest[i].child;
+                if ((nearest[i].type == NULL)
+                  || (strcmp (nearest[i].type, "LINE") != 0)
+                  || (!data->present[line->id_code])
+                  || (data->found[line->id_code]++ != 0)
+                  || (test_spatial_index_distance (&data->bbox[line->id_code], x, y) != distances[i]))
+                {
+                        fprintf (stderr, "Error in %s () entry %zu is not the next nearest line.\n",
+                          __FUNCTION__, i);
+                        return (EXIT_FAILURE);
+                }
+        }
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Run all kinds of queries on a tree.
+ *
+ * \return \c EXIT_SUCCESS when all queries agree with a brute force
+ * search, or \c EXIT_FAILURE otherwise.
+ */
+static int
+test_spatial_index_queries
+(
+        DxfSpatialIndexTree *tree,
+        TestSpatialIndexData *data,
+        uint32_t *state
+)
+{
+        DxfBbox window;
+        double x;
+        double y;
+        int i;
+        int result = EXIT_SUCCESS;
+
+        for (i = 0; i < TEST_SPATIAL_INDEX_NUMBER_QUERIES; i++)
+        {
+                window.min.x = test_spatial_index_random (state, 1200.0) - 100.0;
+                window.min.y = test_spatial_index_random (state, 1200.0) - 100.0;
+                window.min.z = 0.0;
+                window.max.x = window.min.x + test_spatial_index_random (state, (i % 2) ? 20.0 : 300.0);
+                window.max.y = window.min.y + test_spatial_index_random (state, (i % 2) ? 20.0 : 300.0);
+                window.max.z = 0.0;
+                x = test_spatial_index_random (state, 1200.0) - 100.0;
+                y = test_spatial_index_random (state, 1200.0) - 100.0;
+                if ((test_spatial_index_window (tree, data, &window) == EXIT_FAILURE)
+                  || (test_spatial_index_point (tree, data, x, y, (i % 3) * 2.5) == EXIT_FAILURE)
+                  || (test_spatial_index_nearest (tree, data, x, y,
+                  1 + (i % TEST_SPATIAL_INDEX_MAX_NEAREST)) == EXIT_FAILURE))
+                {
+                        result = EXIT_FAILURE;
+                }
+        }
+        return (result);
+}
+
+
+/*!
+ * \brief Test the R-tree spatial index.
+ *
+ * A tree bulk loaded from an \c ENTITIES section and a tree built by
+ * inserting one entity at a time are queried with random windows,
+ * points and nearest neighbour searches, the last one again after
+ * removing every other entity.\n
+ * Every query has to agree with a brute force search over the bounding
+ * boxes of the entities.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+test_spatial_index (void)
+{
+        TestSpatialIndexData *data;
+        DxfEntities *entities;
+        DxfSpatialIndexTree *packed;
+        DxfSpatialIndexTree *inserted;
+        DxfLine *line;
+        uint32_t state = 4711;
+        double length;
+        int i;
+        int result = EXIT_SUCCESS;
+
+        data = calloc (1, sizeof (TestSpatialIndexData));
+        entities = dxf_entities_new ();
+        packed = dxf_spatial_index_tree_new ();
+        inserted = dxf_spatial_index_tree_new ();
+        if ((data == NULL) || (entities == NULL) || (packed == NULL)
+          || (inserted == NULL))
+        {
+                return (EXIT_FAILURE);
+        }
+        for (i = TEST_SPATIAL_INDEX_NUMBER_LINES - 1; i >= 0; i--)
+        {
+                line = dxf_line_init (dxf_line_new ());
+                if (line == NULL)
+                {
+                        return (EXIT_FAILURE);
+                }
+                /* Mostly short lines, some long ones, in clusters. */
+                length = (i % 50 == 0) ? 400.0 : 10.0;
+                line->id_code = i;
+                line->p0.x = ((i % 4) * 250.0) + test_spatial_index_random (&state, 250.0);
+                line->p0.y = ((i % 7) * 140.0) + test_spatial_index_random (&state, 140.0);
+                line->p1.x = line->p0.x + test_spatial_index_random (&state, length) - (length / 2.0);
+                line->p1.y = line->p0.y + test_spatial_index_random (&state, length) - (length / 2.0);
+                line->next = (struct DxfLine *) entities->line_list;
+                entities->line_list = (struct DxfLine *) line;
+                data->lines[i] = line;
+                data->present[i] = TRUE;
+                if ((dxf_entity_get_bbox ("LINE", line, &data->bbox[i]) == EXIT_FAILURE)
+                  || (dxf_spatial_index_tree_insert (inserted, "LINE", line) == EXIT_FAILURE))
+                {
+                        result = EXIT_FAILURE;
+                }
+        }
+        if ((dxf_spatial_index_tree_add_entities (packed, entities) == EXIT_FAILURE)
+          || (dxf_spatial_index_tree_get_count (packed) != TEST_SPATIAL_INDEX_NUMBER_LINES)
+          || (dxf_spatial_index_tree_get_count (inserted) != TEST_SPATIAL_INDEX_NUMBER_LINES))
+        {
+                fprintf (stderr, "Error in %s () building the trees.\n",
+                  __FUNCTION__);
+                result = EXIT_FAILURE;
+        }
+        if ((test_spatial_index_queries (packed, data, &state) == EXIT_FAILURE)
+          || (test_spatial_index_queries (inserted, data, &state) == EXIT_FAILURE))
+        {
+                result = EXIT_FAILURE;
+        }
+        for (i = 0; i < TEST_SPATIAL_INDEX_NUMBER_LINES; i += 2)
+        {
+                data->present[i] = FALSE;
+                if (dxf_spatial_index_tree_remove (inserted, "LINE", data->lines[i]) == EXIT_FAILURE)
+                {
+                        result = EXIT_FAILURE;
+                }
+        }
+        if ((dxf_spatial_index_tree_get_count (inserted) != TEST_SPATIAL_INDEX_NUMBER_LINES / 2)
+          || (test_spatial_index_queries (inserted, data, &state) == EXIT_FAILURE))
+        {
+                fprintf (stderr, "Error in %s () querying after removing lines.\n",
+                  __FUNCTION__);
+                result = EXIT_FAILURE;
+        }
+        dxf_spatial_index_tree_free (packed);
+        dxf_spatial_index_tree_free (inserted);
+        dxf_entities_free (entities);
+        free (data);
+        return (result);
+}
+
+
+/* EOF */
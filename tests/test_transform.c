@@ -0,0 +1,487 @@
+/*!
+ * \file test_transform.c
+ *
+ * \author Copyright (C) 2026
+ * by Bert Timmerman <bert.timmerman@xs4all.nl>.
+ *
+ * \brief Testing program for the batch transformation kernels, mapping
+ * arrays of points has to give the same points as mapping them one at a
+ * time with dxf_transform_apply_point ().
+ *
+ * <hr>
+ * <h1><b>Copyright Notices.</b></h1>\n
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License,
+ * or (at your option) any later version.\n\n
+ * This program is distributed in the hope that it will be useful, but
+ * <b>WITHOUT ANY WARRANTY</b>; without even the implied warranty of
+ * <b>MERCHANTABILITY</b> or <b>FITNESS FOR A PARTICULAR PURPOSE</b>.\n
+ * See the GNU General Public License for more details.\n\n
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to:\n
+ * Free Software Foundation, Inc.,\n
+ * 59 Temple Place,\n
+ * Suite 330,\n
+ * Boston,\n
+ * MA 02111 USA.\n
+ * \n
+ * Drawing eXchange Format (DXF) is a defacto industry standard for the
+ * exchange of drawing files between various Computer Aided Drafting
+ * programs.\n
+ * DXF is an industry standard designed by Autodesk(TM).\n
+ * For more details see http://www.autodesk.com.
+ * <hr>
+ */
+
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <math.h>
+#include "includes.h"
+
+
+/*!
+ * \brief Maximum number of points mapped in one batch, enough to
+ * exercise the vector loops and their tails.
+ */
+#define TEST_TRANSFORM_MAX_POINTS 67
+
+
+/*!
+ * \brief Return a pseudo random number in [\c low, \c high).
+ *
+ * The sequence is the same on every run.
+ */
+static double
+test_transform_random
+(
+        uint32_t *state,
+                /*!< State of the generator. */
+        double low,
+                /*!< Lower limit of the number. */
+        double high
+                /*!< Upper limit of the number. */
+)
+{
+        *state = (*state * 1664525) + 1013904223;
+        return (low + ((high - low) * (*state >> 8) / 16777216.0));
+}
+
+
+/*!
+ * \brief Compare two points, allowing for a different rounding of the
+ * sums in a vectorized kernel.
+ *
+ * \return \c TRUE when the points are equal, \c FALSE otherwise.
+ */
+static int
+test_transform_equal
+(
+        DxfVec3 *a,
+                /*!< The first point. */
+        DxfVec3 *b,
+                /*!< The second point. */
+        double scale
+                /*!< Magnitude of the terms summed. */
+)
+{
+        double tolerance = 1e-13 * scale;
+
+        return ((fabs (a->x - b->x) <= tolerance)
+          && (fabs (a->y - b->y) <= tolerance)
+          && (fabs (a->z - b->z) <= tolerance));
+}
+
+
+/*!
+ * \brief Test dxf_transform_apply_points () and
+ * dxf_transform_apply_arrays ().
+ *
+ * Random transformations map batches of every size up to
+ * \c TEST_TRANSFORM_MAX_POINTS points, at an aligned and an unaligned
+ * start, into a separate array and in place.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+static int
+test_transform_points (void)
+{
+        static DxfVec3 points[TEST_TRANSFORM_MAX_POINTS + 1];
+        static DxfVec3 mapped[TEST_TRANSFORM_MAX_POINTS + 1];
+        static DxfVec3 expected[TEST_TRANSFORM_MAX_POINTS + 1];
+        static double x[TEST_TRANSFORM_MAX_POINTS + 1];
+        static double y[TEST_TRANSFORM_MAX_POINTS + 1];
+        static double z[TEST_TRANSFORM_MAX_POINTS + 1];
+        DxfTransform transform;
+        DxfVec3 point;
+        uint32_t state = 5;
+        size_t number_points;
+        size_t offset;
+        size_t i;
+        int row;
+        int column;
+        int result = EXIT_SUCCESS;
+
+        for (number_points = 0; number_points <= TEST_TRANSFORM_MAX_POINTS; number_points++)
+        {
+                for (offset = 0; offset <= 1; offset++)
+                {
+                        for (row = 0; row < 3; row++)
+                        {
+                                for (column = 0; column < 4; column++)
+                                {
+                                        transform.m[row][column] = test_transform_random (&state, -10.0, 10.0);
+                                }
+                        }
+                        for (i = offset; i < offset + number_points; i++)
+                        {
+                                points[i].x = test_transform_random (&state, -1000.0, 1000.0);
+                                points[i].y = test_transform_random (&state, -1000.0, 1000.0);
+                                points[i].z = test_transform_random (&state, -1000.0, 1000.0);
+                                dxf_transform_apply_point (&transform, &points[i], &expected[i]);
+                                x[i] = points[i].x;
+                                y[i] = points[i].y;
+                                z[i] = points[i].z;
+                        }
+                        if (dxf_transform_apply_points (&transform, points + offset,
+                          mapped + offset, number_points) == EXIT_FAILURE)
+                        {
+                                result = EXIT_FAILURE;
+                        }
+                        for (i = offset; i < offset + number_points; i++)
+                        {
+                                if (!test_transform_equal (&mapped[i], &expected[i], 40000.0))
+                                {
+                                        fprintf (stderr, "Error in %s () point %zu of %zu differs.\n",
+                                          __FUNCTION__, i - offset, number_points);
+                                        result = EXIT_FAILURE;
+                                }
+                        }
+                        /* In place. */
+                        if (dxf_transform_apply_points (&transform, points + offset,
+                          points + offset, number_points) == EXIT_FAILURE)
+                        {
+                                result = EXIT_FAILURE;
+                        }
+                        for (i = offset; i < offset + number_points; i++)
+                        {
+                                if (!test_transform_equal (&points[i], &mapped[i], 0.0))
+                                {
+                                        fprintf (stderr, "Error in %s () point %zu of %zu differs when mapped in place.\n",
+                                          __FUNCTION__, i - offset, number_points);
+                                        result = EXIT_FAILURE;
+                                }
+                        }
+                        /* Separate arrays. */
+                        if (dxf_transform_apply_arrays (&transform, x + offset,
+                          y + offset, z + offset, number_points) == EXIT_FAILURE)
+                        {
+                                result = EXIT_FAILURE;
+                        }
+                        for (i = offset; i < offset + number_points; i++)
+                        {
+                                point.x = x[i];
+                                point.y = y[i];
+                                point.z = z[i];
+                                if (!test_transform_equal (&point, &expected[i], 40000.0))
+                                {
+                                        fprintf (stderr, "Error in %s () point %zu of %zu differs when mapped as arrays.\n",
+                                          __FUNCTION__, i - offset, number_points);
+                                        result = EXIT_FAILURE;
+                                }
+                        }
+                        /* Separate arrays in the plane Z = 0. */
+                        for (i = offset; i < offset + number_points; i++)
+                        {
+                                x[i] = points[i].x = test_transform_random (&state, -1000.0, 1000.0);
+                                y[i] = points[i].y = test_transform_random (&state, -1000.0, 1000.0);
+                                points[i].z = 0.0;
+                                dxf_transform_apply_point (&transform, &points[i], &expected[i]);
+                        }
+                        if (dxf_transform_apply_arrays (&transform, x + offset,
+                          y + offset, NULL, number_points) == EXIT_FAILURE)
+                        {
+                                result = EXIT_FAILURE;
+                        }
+                        for (i = offset; i < offset + number_points; i++)
+                        {
+                                point.x = x[i];
+                                point.y = y[i];
+                                point.z = expected[i].z;
+                                if (!test_transform_equal (&point, &expected[i], 40000.0))
+                                {
+                                        fprintf (stderr, "Error in %s () point %zu of %zu differs when mapped as 2D arrays.\n",
+                                          __FUNCTION__, i - offset, number_points);
+                                        result = EXIT_FAILURE;
+                                }
+                        }
+                }
+        }
+        return (result);
+}
+
+
+/*!
+ * \brief Test dxf_transform_ocs_to_wcs ().
+ *
+ * Every point is mapped with it's own extrusion direction: the world
+ * Z-axis, the negative Z-axis, directions close to the Z-axis (taking
+ * the other branch of the arbitrary axis algorithm) and random
+ * directions of any length, in batches of every size up to
+ * \c TEST_TRANSFORM_MAX_POINTS points, into a separate array and in
+ * place.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+static int
+test_transform_ocs (void)
+{
+        static DxfVec3 extrusions[TEST_TRANSFORM_MAX_POINTS];
+        static DxfVec3 points[TEST_TRANSFORM_MAX_POINTS];
+        static DxfVec3 mapped[TEST_TRANSFORM_MAX_POINTS];
+        static DxfVec3 expected[TEST_TRANSFORM_MAX_POINTS];
+        DxfTransform transform;
+        uint32_t state = 6;
+        size_t number_points;
+        size_t i;
+        int result = EXIT_SUCCESS;
+
+        for (number_points = 0; number_points <= TEST_TRANSFORM_MAX_POINTS; number_points++)
+        {
+                for (i = 0; i < number_points; i++)
+                {
+                        switch ((i + number_points) % 5)
+                        {
+                                case 0:
+                                        extrusions[i].x = 0.0;
+                                        extrusions[i].y = 0.0;
+                                        extrusions[i].z = 1.0;
+                                        break;
+                                case 1:
+                                        extrusions[i].x = 0.0;
+                                        extrusions[i].y = 0.0;
+                                        extrusions[i].z = -1.0;
+                                        break;
+                                case 2:
+                                        /* Just inside and outside of
+                                         * the 1/64 threshold. */
+                                        extrusions[i].x = test_transform_random (&state, -0.02, 0.02);
+                                        extrusions[i].y = test_transform_random (&state, -0.02, 0.02);
+                                        extrusions[i].z = test_transform_random (&state, -1.0, 1.0) < 0.0 ? -1.0 : 1.0;
+                                        break;
+                                default:
+                                        do
+                                        {
+                                                extrusions[i].x = test_transform_random (&state, -5.0, 5.0);
+                                                extrusions[i].y = test_transform_random (&state, -5.0, 5.0);
+                                                extrusions[i].z = test_transform_random (&state, -5.0, 5.0);
+                                        }
+                                        while ((fabs (extrusions[i].x) + fabs (extrusions[i].y)
+                                          + fabs (extrusions[i].z)) < 0.1);
+                                        break;
+                        }
+                        points[i].x = test_transform_random (&state, -1000.0, 1000.0);
+                        points[i].y = test_transform_random (&state, -1000.0, 1000.0);
+                        points[i].z = test_transform_random (&state, -1000.0, 1000.0);
+                        if ((dxf_transform_set_ocs (&transform, &extrusions[i]) == NULL)
+                          || (dxf_transform_apply_point (&transform, &points[i], &expected[i]) == NULL))
+                        {
+                                result = EXIT_FAILURE;
+                        }
+                }
+                if (dxf_transform_ocs_to_wcs (extrusions, points, mapped, number_points) == EXIT_FAILURE)
+                {
+                        result = EXIT_FAILURE;
+                }
+                for (i = 0; i < number_points; i++)
+                {
+                        if (!test_transform_equal (&mapped[i], &expected[i], 4000.0))
+                        {
+                                fprintf (stderr, "Error in %s () point %zu of %zu differs.\n",
+                                  __FUNCTION__, i, number_points);
+                                result = EXIT_FAILURE;
+                        }
+                }
+                /* In place. */
+                if (dxf_transform_ocs_to_wcs (extrusions, points, points, number_points) == EXIT_FAILURE)
+                {
+                        result = EXIT_FAILURE;
+                }
+                for (i = 0; i < number_points; i++)
+                {
+                        if (!test_transform_equal (&points[i], &mapped[i], 0.0))
+                        {
+                                fprintf (stderr, "Error in %s () point %zu of %zu differs when mapped in place.\n",
+                                  __FUNCTION__, i, number_points);
+                                result = EXIT_FAILURE;
+                        }
+                }
+        }
+        return (result);
+}
+
+
+/*!
+ * \brief Test dxf_entity_transform () on \c POLYLINE entities read
+ * from a file.
+ *
+ * A closed 2D polyline at an elevation and a 3D polyline are turned a
+ * quarter turn about the Z-axis, scaled by 2 and moved, the vertices
+ * read into the polylines have to follow.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+static int
+test_transform_read_polyline (void)
+{
+        static const double vertices[][3] =
+        {
+                {1.0, 2.0, 3.0},
+                {-4.0, 5.0, -6.0},
+                {7.0, -8.0, 9.0}
+        };
+        DxfDrawing *drawing;
+        DxfEntities *entities;
+        DxfPolyline *polyline;
+        DxfVertex *vertex;
+        DxfTransform transform;
+        DxfVec3 point;
+        DxfVec3 expected;
+        DxfFile *fp;
+        FILE *file;
+        int flag;
+        int i;
+        int result = EXIT_SUCCESS;
+
+        file = fopen ("test_transform.dxf", "w");
+        if (file == NULL)
+        {
+                return (EXIT_FAILURE);
+        }
+        fprintf (file, "  0\nSECTION\n  2\nHEADER\n  9\n$ACADVER\n  1\nAC1015\n  0\nENDSEC\n");
+        fprintf (file, "  0\nSECTION\n  2\nENTITIES\n");
+        for (flag = 1; flag <= 8; flag += 7)
+        {
+                fprintf (file, "  0\nPOLYLINE\n  5\n%X\n  8\n0\n 66\n1\n"
+                  " 10\n0.0\n 20\n0.0\n 30\n%f\n 70\n%d\n",
+                  0x100 + (16 * flag), (flag == 1) ? 2.0 : 0.0, flag);
+                for (i = 0; i < 3; i++)
+                {
+                        fprintf (file, "  0\nVERTEX\n  5\n%X\n  8\n0\n"
+                          " 10\n%f\n 20\n%f\n 30\n%f\n 40\n0.5\n 41\n0.25\n"
+                          " 42\n0.5\n 50\n30.0\n 70\n%d\n",
+                          0x101 + (16 * flag) + i, vertices[i][0], vertices[i][1],
+                          (flag == 1) ? 0.0 : vertices[i][2],
+                          (flag == 1) ? 2 : 32);
+                }
+                fprintf (file, "  0\nSEQEND\n  5\n%X\n  8\n0\n", 0x104 + (16 * flag));
+        }
+        fprintf (file, "  0\nENDSEC\n  0\nEOF\n");
+        if (fclose (file) != 0)
+        {
+                return (EXIT_FAILURE);
+        }
+        drawing = dxf_drawing_new ();
+        fp = dxf_read_init ("test_transform.dxf");
+        if ((drawing == NULL) || (fp == NULL))
+        {
+                return (EXIT_FAILURE);
+        }
+        if (dxf_drawing_read_sections (drawing, fp, NULL,
+          DXF_SECTION_HEADER | DXF_SECTION_ENTITIES) == EXIT_FAILURE)
+        {
+                result = EXIT_FAILURE;
+        }
+        dxf_read_close (fp);
+        remove ("test_transform.dxf");
+        entities = (DxfEntities *) drawing->entities_list;
+        memset (&transform, 0, sizeof (transform));
+        transform.m[0][1] = -2.0;
+        transform.m[1][0] = 2.0;
+        transform.m[2][2] = 2.0;
+        transform.m[0][3] = 10.0;
+        transform.m[1][3] = 20.0;
+        transform.m[2][3] = 30.0;
+        for (polyline = (entities != NULL) ? (DxfPolyline *) entities->polyline_list : NULL;
+          polyline != NULL;
+          polyline = (DxfPolyline *) polyline->next)
+        {
+                flag = polyline->flag;
+                if (dxf_entity_transform ("POLYLINE", polyline, &transform) == EXIT_FAILURE)
+                {
+                        fprintf (stderr, "Error in %s () transforming the polyline with flag %d.\n",
+                          __FUNCTION__, flag);
+                        result = EXIT_FAILURE;
+                        continue;
+                }
+                if ((flag == 1) && (fabs (polyline->p0->z0 - 34.0) > 1e-12))
+                {
+                        fprintf (stderr, "Error in %s () elevation of the 2D polyline.\n",
+                          __FUNCTION__);
+                        result = EXIT_FAILURE;
+                }
+                for (i = 0, vertex = polyline->vertices;
+                  (i < 3) && (vertex != NULL);
+                  i++, vertex = (DxfVertex *) vertex->next)
+                {
+                        point.x = vertex->p0.x;
+                        point.y = vertex->p0.y;
+                        point.z = vertex->p0.z;
+                        expected.x = 10.0 - (2.0 * vertices[i][1]);
+                        expected.y = 20.0 + (2.0 * vertices[i][0]);
+                        expected.z = (flag == 1) ? 0.0 : 30.0 + (2.0 * vertices[i][2]);
+                        if ((!test_transform_equal (&point, &expected, 100.0))
+                          || ((flag == 1)
+                          && ((fabs (vertex->start_width - 1.0) > 1e-12)
+                          || (fabs (vertex->end_width - 0.5) > 1e-12)
+                          || (fabs (vertex->curve_fit_tangent_direction - 120.0) > 1e-9))))
+                        {
+                                fprintf (stderr, "Error in %s () vertex %d of the polyline with flag %d differs.\n",
+                                  __FUNCTION__, i, flag);
+                                result = EXIT_FAILURE;
+                        }
+                }
+                if ((i != 3) || (vertex != NULL))
+                {
+                        fprintf (stderr, "Error in %s () the polyline with flag %d has no 3 vertices.\n",
+                          __FUNCTION__, flag);
+                        result = EXIT_FAILURE;
+                }
+        }
+        if ((entities == NULL) || (entities->polyline_list == NULL))
+        {
+                result = EXIT_FAILURE;
+        }
+        dxf_drawing_free (drawing);
+        return (result);
+}
+
+
+/*!
+ * \brief Test the batch transformation kernels.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+test_transform (void)
+{
+        int result = EXIT_SUCCESS;
+
+        if ((test_transform_points () == EXIT_FAILURE)
+          || (test_transform_ocs () == EXIT_FAILURE)
+          || (test_transform_read_polyline () == EXIT_FAILURE))
+        {
+                result = EXIT_FAILURE;
+        }
+        return (result);
+}
+
+
+/* EOF */
@@ -47,6 +47,42 @@ int main (void)
         fprintf (stdout, "TESTS: R2000 exited with error\n");
     else
         fprintf (stdout, "TESTS: R2000 exited with no error\n");
+    if (test_bbox ())
+        fprintf (stdout, "TESTS: bbox exited with error\n");
+    else
+        fprintf (stdout, "TESTS: bbox exited with no error\n");
+    if (test_binary ())
+        fprintf (stdout, "TESTS: binary exited with error\n");
+    else
+        fprintf (stdout, "TESTS: binary exited with no error\n");
+    if (test_double ())
+        fprintf (stdout, "TESTS: double exited with error\n");
+    else
+        fprintf (stdout, "TESTS: double exited with no error\n");
+    if (test_header ())
+        fprintf (stdout, "TESTS: header exited with error\n");
+    else
+        fprintf (stdout, "TESTS: header exited with no error\n");
+    if (test_line_index ())
+        fprintf (stdout, "TESTS: line index exited with error\n");
+    else
+        fprintf (stdout, "TESTS: line index exited with no error\n");
+    if (test_spatial_index ())
+        fprintf (stdout, "TESTS: spatial index exited with error\n");
+    else
+        fprintf (stdout, "TESTS: spatial index exited with no error\n");
+    if (test_transform ())
+        fprintf (stdout, "TESTS: transform exited with error\n");
+    else
+        fprintf (stdout, "TESTS: transform exited with no error\n");
+    if (test_read_mapped ())
+        fprintf (stdout, "TESTS: mapped read exited with error\n");
+    else
+        fprintf (stdout, "TESTS: mapped read exited with no error\n");
+    if (test_read_parallel ())
+        fprintf (stdout, "TESTS: parallel read exited with error\n");
+    else
+        fprintf (stdout, "TESTS: parallel read exited with no error\n");
     
     return 1;
 }